@@ -4,6 +4,8 @@
 
 #define GL_NATIVE(func) Java_org_eclipse_opengl_GL_##func
 
+#define GL_CRITICAL(func) JavaCritical_org_eclipse_opengl_GL_##func
+
 #ifndef NO_glAccum
 JNIEXPORT void JNICALL GL_NATIVE(glAccum)
 	(JNIEnv *env, jclass that, jint arg0, jfloat arg1)
@@ -46,12 +48,12 @@ JNIEXPORT jboolean JNICALL GL_NATIVE(glAreTexturesResident)
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
 		if (arg2) (*env)->ReleasePrimitiveArrayCritical(env, arg2, lparg2, 0);
-		if (arg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, 0);
+		if (arg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, JNI_ABORT);
 	} else
 #endif
 	{
 		if (arg2) (*env)->ReleaseBooleanArrayElements(env, arg2, lparg2, 0);
-		if (arg1) (*env)->ReleaseIntArrayElements(env, arg1, lparg1, 0);
+		if (arg1) (*env)->ReleaseIntArrayElements(env, arg1, lparg1, JNI_ABORT);
 	}
 	GL_NATIVE_EXIT(env, that, glAreTexturesResident_FUNC);
 	return rc;
@@ -105,11 +107,11 @@ JNIEXPORT void JNICALL GL_NATIVE(glBitmap)
 	glBitmap(arg0, arg1, arg2, arg3, arg4, arg5, (const GLubyte *)lparg6);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
-		if (arg6) (*env)->ReleasePrimitiveArrayCritical(env, arg6, lparg6, 0);
+		if (arg6) (*env)->ReleasePrimitiveArrayCritical(env, arg6, lparg6, JNI_ABORT);
 	} else
 #endif
 	{
-		if (arg6) (*env)->ReleaseByteArrayElements(env, arg6, lparg6, 0);
+		if (arg6) (*env)->ReleaseByteArrayElements(env, arg6, lparg6, JNI_ABORT);
 	}
 	GL_NATIVE_EXIT(env, that, glBitmap_FUNC);
 }
@@ -515,11 +517,11 @@ JNIEXPORT void JNICALL GL_NATIVE(glColor3ubv)
 	glColor3ubv((const GLubyte *)lparg0);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
-		if (arg0) (*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, 0);
+		if (arg0) (*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, JNI_ABORT);
 	} else
 #endif
 	{
-		if (arg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+		if (arg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	}
 	GL_NATIVE_EXIT(env, that, glColor3ubv_FUNC);
 }
@@ -552,11 +554,11 @@ JNIEXPORT void JNICALL GL_NATIVE(glColor3uiv)
 	glColor3uiv((const GLuint *)lparg0);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
-		if (arg0) (*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, 0);
+		if (arg0) (*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, JNI_ABORT);
 	} else
 #endif
 	{
-		if (arg0) (*env)->ReleaseIntArrayElements(env, arg0, lparg0, 0);
+		if (arg0) (*env)->ReleaseIntArrayElements(env, arg0, lparg0, JNI_ABORT);
 	}
 	GL_NATIVE_EXIT(env, that, glColor3uiv_FUNC);
 }
@@ -589,11 +591,11 @@ JNIEXPORT void JNICALL GL_NATIVE(glColor3usv)
 	glColor3usv((const GLushort *)lparg0);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
-		if (arg0) (*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, 0);
+		if (arg0) (*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, JNI_ABORT);
 	} else
 #endif
 	{
-		if (arg0) (*env)->ReleaseShortArrayElements(env, arg0, lparg0, 0);
+		if (arg0) (*env)->ReleaseShortArrayElements(env, arg0, lparg0, JNI_ABORT);
 	}
 	GL_NATIVE_EXIT(env, that, glColor3usv_FUNC);
 }
@@ -775,7 +777,7 @@ JNIEXPORT void JNICALL GL_NATIVE(glColor4ubv)
 	GL_NATIVE_ENTER(env, that, glColor4ubv_FUNC);
 	if (arg0) lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL);
 	glColor4ubv((const GLubyte *)lparg0);
-	if (arg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	GL_NATIVE_EXIT(env, that, glColor4ubv_FUNC);
 }
 #endif
@@ -807,11 +809,11 @@ JNIEXPORT void JNICALL GL_NATIVE(glColor4uiv)
 	glColor4uiv((const GLuint *)lparg0);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
-		if (arg0) (*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, 0);
+		if (arg0) (*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, JNI_ABORT);
 	} else
 #endif
 	{
-		if (arg0) (*env)->ReleaseIntArrayElements(env, arg0, lparg0, 0);
+		if (arg0) (*env)->ReleaseIntArrayElements(env, arg0, lparg0, JNI_ABORT);
 	}
 	GL_NATIVE_EXIT(env, that, glColor4uiv_FUNC);
 }
@@ -844,11 +846,11 @@ JNIEXPORT void JNICALL GL_NATIVE(glColor4usv)
 	glColor4usv((const GLushort *)lparg0);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
-		if (arg0) (*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, 0);
+		if (arg0) (*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, JNI_ABORT);
 	} else
 #endif
 	{
-		if (arg0) (*env)->ReleaseShortArrayElements(env, arg0, lparg0, 0);
+		if (arg0) (*env)->ReleaseShortArrayElements(env, arg0, lparg0, JNI_ABORT);
 	}
 	GL_NATIVE_EXIT(env, that, glColor4usv_FUNC);
 }
@@ -874,12 +876,12 @@ JNIEXPORT void JNICALL GL_NATIVE(glColorMaterial)
 }
 #endif
 
-#ifndef NO_glColorPointer
-JNIEXPORT void JNICALL GL_NATIVE(glColorPointer)
+#ifndef NO_glColorPointer__III_3I
+JNIEXPORT void JNICALL GL_NATIVE(glColorPointer__III_3I)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jintArray arg3)
 {
 	jint *lparg3=NULL;
-	GL_NATIVE_ENTER(env, that, glColorPointer_FUNC);
+	GL_NATIVE_ENTER(env, that, glColorPointer__III_3I_FUNC);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
 		if (arg3) lparg3 = (*env)->GetPrimitiveArrayCritical(env, arg3, NULL);
@@ -897,7 +899,7 @@ JNIEXPORT void JNICALL GL_NATIVE(glColorPointer)
 	{
 		if (arg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
 	}
-	GL_NATIVE_EXIT(env, that, glColorPointer_FUNC);
+	GL_NATIVE_EXIT(env, that, glColorPointer__III_3I_FUNC);
 }
 #endif
 
@@ -988,11 +990,11 @@ JNIEXPORT void JNICALL GL_NATIVE(glDeleteTextures)
 	glDeleteTextures(arg0, (const GLuint *)lparg1);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
-		if (arg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, 0);
+		if (arg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, JNI_ABORT);
 	} else
 #endif
 	{
-		if (arg1) (*env)->ReleaseIntArrayElements(env, arg1, lparg1, 0);
+		if (arg1) (*env)->ReleaseIntArrayElements(env, arg1, lparg1, JNI_ABORT);
 	}
 	GL_NATIVE_EXIT(env, that, glDeleteTextures_FUNC);
 }
@@ -1068,12 +1070,12 @@ JNIEXPORT void JNICALL GL_NATIVE(glDrawBuffer)
 }
 #endif
 
-#ifndef NO_glDrawElements
-JNIEXPORT void JNICALL GL_NATIVE(glDrawElements)
+#ifndef NO_glDrawElements__III_3I
+JNIEXPORT void JNICALL GL_NATIVE(glDrawElements__III_3I)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jintArray arg3)
 {
 	jint *lparg3=NULL;
-	GL_NATIVE_ENTER(env, that, glDrawElements_FUNC);
+	GL_NATIVE_ENTER(env, that, glDrawElements__III_3I_FUNC);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
 		if (arg3) lparg3 = (*env)->GetPrimitiveArrayCritical(env, arg3, NULL);
@@ -1091,7 +1093,7 @@ JNIEXPORT void JNICALL GL_NATIVE(glDrawElements)
 	{
 		if (arg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
 	}
-	GL_NATIVE_EXIT(env, that, glDrawElements_FUNC);
+	GL_NATIVE_EXIT(env, that, glDrawElements__III_3I_FUNC);
 }
 #endif
 
@@ -2538,12 +2540,12 @@ JNIEXPORT void JNICALL GL_NATIVE(glInitNames)
 }
 #endif
 
-#ifndef NO_glInterleavedArrays
-JNIEXPORT void JNICALL GL_NATIVE(glInterleavedArrays)
+#ifndef NO_glInterleavedArrays__II_3I
+JNIEXPORT void JNICALL GL_NATIVE(glInterleavedArrays__II_3I)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jintArray arg2)
 {
 	jint *lparg2=NULL;
-	GL_NATIVE_ENTER(env, that, glInterleavedArrays_FUNC);
+	GL_NATIVE_ENTER(env, that, glInterleavedArrays__II_3I_FUNC);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
 		if (arg2) lparg2 = (*env)->GetPrimitiveArrayCritical(env, arg2, NULL);
@@ -2561,7 +2563,7 @@ JNIEXPORT void JNICALL GL_NATIVE(glInterleavedArrays)
 	{
 		if (arg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, 0);
 	}
-	GL_NATIVE_EXIT(env, that, glInterleavedArrays_FUNC);
+	GL_NATIVE_EXIT(env, that, glInterleavedArrays__II_3I_FUNC);
 }
 #endif
 
@@ -3344,12 +3346,12 @@ JNIEXPORT void JNICALL GL_NATIVE(glNormal3sv)
 }
 #endif
 
-#ifndef NO_glNormalPointer
-JNIEXPORT void JNICALL GL_NATIVE(glNormalPointer)
+#ifndef NO_glNormalPointer__II_3I
+JNIEXPORT void JNICALL GL_NATIVE(glNormalPointer__II_3I)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jintArray arg2)
 {
 	jint *lparg2=NULL;
-	GL_NATIVE_ENTER(env, that, glNormalPointer_FUNC);
+	GL_NATIVE_ENTER(env, that, glNormalPointer__II_3I_FUNC);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
 		if (arg2) lparg2 = (*env)->GetPrimitiveArrayCritical(env, arg2, NULL);
@@ -3367,7 +3369,7 @@ JNIEXPORT void JNICALL GL_NATIVE(glNormalPointer)
 	{
 		if (arg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, 0);
 	}
-	GL_NATIVE_EXIT(env, that, glNormalPointer_FUNC);
+	GL_NATIVE_EXIT(env, that, glNormalPointer__II_3I_FUNC);
 }
 #endif
 
@@ -3435,11 +3437,11 @@ JNIEXPORT void JNICALL GL_NATIVE(glPixelMapuiv)
 	glPixelMapuiv(arg0, arg1, (const GLuint *)lparg2);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
-		if (arg2) (*env)->ReleasePrimitiveArrayCritical(env, arg2, lparg2, 0);
+		if (arg2) (*env)->ReleasePrimitiveArrayCritical(env, arg2, lparg2, JNI_ABORT);
 	} else
 #endif
 	{
-		if (arg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, 0);
+		if (arg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, JNI_ABORT);
 	}
 	GL_NATIVE_EXIT(env, that, glPixelMapuiv_FUNC);
 }
@@ -3462,11 +3464,11 @@ JNIEXPORT void JNICALL GL_NATIVE(glPixelMapusv)
 	glPixelMapusv(arg0, arg1, (const GLushort *)lparg2);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
-		if (arg2) (*env)->ReleasePrimitiveArrayCritical(env, arg2, lparg2, 0);
+		if (arg2) (*env)->ReleasePrimitiveArrayCritical(env, arg2, lparg2, JNI_ABORT);
 	} else
 #endif
 	{
-		if (arg2) (*env)->ReleaseShortArrayElements(env, arg2, lparg2, 0);
+		if (arg2) (*env)->ReleaseShortArrayElements(env, arg2, lparg2, JNI_ABORT);
 	}
 	GL_NATIVE_EXIT(env, that, glPixelMapusv_FUNC);
 }
@@ -3640,12 +3642,12 @@ JNIEXPORT void JNICALL GL_NATIVE(glPrioritizeTextures)
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
 		if (arg2) (*env)->ReleasePrimitiveArrayCritical(env, arg2, lparg2, 0);
-		if (arg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, 0);
+		if (arg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, JNI_ABORT);
 	} else
 #endif
 	{
 		if (arg2) (*env)->ReleaseFloatArrayElements(env, arg2, lparg2, 0);
-		if (arg1) (*env)->ReleaseIntArrayElements(env, arg1, lparg1, 0);
+		if (arg1) (*env)->ReleaseIntArrayElements(env, arg1, lparg1, JNI_ABORT);
 	}
 	GL_NATIVE_EXIT(env, that, glPrioritizeTextures_FUNC);
 }
@@ -4145,12 +4147,12 @@ JNIEXPORT void JNICALL GL_NATIVE(glReadBuffer)
 }
 #endif
 
-#ifndef NO_glReadPixels
-JNIEXPORT void JNICALL GL_NATIVE(glReadPixels)
+#ifndef NO_glReadPixels__IIIIII_3I
+JNIEXPORT void JNICALL GL_NATIVE(glReadPixels__IIIIII_3I)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jintArray arg6)
 {
 	jint *lparg6=NULL;
-	GL_NATIVE_ENTER(env, that, glReadPixels_FUNC);
+	GL_NATIVE_ENTER(env, that, glReadPixels__IIIIII_3I_FUNC);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
 		if (arg6) lparg6 = (*env)->GetPrimitiveArrayCritical(env, arg6, NULL);
@@ -4168,7 +4170,7 @@ JNIEXPORT void JNICALL GL_NATIVE(glReadPixels)
 	{
 		if (arg6) (*env)->ReleaseIntArrayElements(env, arg6, lparg6, 0);
 	}
-	GL_NATIVE_EXIT(env, that, glReadPixels_FUNC);
+	GL_NATIVE_EXIT(env, that, glReadPixels__IIIIII_3I_FUNC);
 }
 #endif
 
@@ -5044,12 +5046,12 @@ JNIEXPORT void JNICALL GL_NATIVE(glTexCoord4sv)
 }
 #endif
 
-#ifndef NO_glTexCoordPointer
-JNIEXPORT void JNICALL GL_NATIVE(glTexCoordPointer)
+#ifndef NO_glTexCoordPointer__III_3I
+JNIEXPORT void JNICALL GL_NATIVE(glTexCoordPointer__III_3I)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jintArray arg3)
 {
 	jint *lparg3=NULL;
-	GL_NATIVE_ENTER(env, that, glTexCoordPointer_FUNC);
+	GL_NATIVE_ENTER(env, that, glTexCoordPointer__III_3I_FUNC);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
 		if (arg3) lparg3 = (*env)->GetPrimitiveArrayCritical(env, arg3, NULL);
@@ -5067,7 +5069,7 @@ JNIEXPORT void JNICALL GL_NATIVE(glTexCoordPointer)
 	{
 		if (arg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
 	}
-	GL_NATIVE_EXIT(env, that, glTexCoordPointer_FUNC);
+	GL_NATIVE_EXIT(env, that, glTexCoordPointer__III_3I_FUNC);
 }
 #endif
 
@@ -5283,12 +5285,12 @@ JNIEXPORT void JNICALL GL_NATIVE(glTexImage1D)
 }
 #endif
 
-#ifndef NO_glTexImage2D
-JNIEXPORT void JNICALL GL_NATIVE(glTexImage2D)
+#ifndef NO_glTexImage2D__IIIIIIII_3B
+JNIEXPORT void JNICALL GL_NATIVE(glTexImage2D__IIIIIIII_3B)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jbyteArray arg8)
 {
 	jbyte *lparg8=NULL;
-	GL_NATIVE_ENTER(env, that, glTexImage2D_FUNC);
+	GL_NATIVE_ENTER(env, that, glTexImage2D__IIIIIIII_3B_FUNC);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
 		if (arg8) lparg8 = (*env)->GetPrimitiveArrayCritical(env, arg8, NULL);
@@ -5306,7 +5308,7 @@ JNIEXPORT void JNICALL GL_NATIVE(glTexImage2D)
 	{
 		if (arg8) (*env)->ReleaseByteArrayElements(env, arg8, lparg8, 0);
 	}
-	GL_NATIVE_EXIT(env, that, glTexImage2D_FUNC);
+	GL_NATIVE_EXIT(env, that, glTexImage2D__IIIIIIII_3B_FUNC);
 }
 #endif
 
@@ -5411,12 +5413,12 @@ JNIEXPORT void JNICALL GL_NATIVE(glTexSubImage1D)
 }
 #endif
 
-#ifndef NO_glTexSubImage2D
-JNIEXPORT void JNICALL GL_NATIVE(glTexSubImage2D)
+#ifndef NO_glTexSubImage2D__IIIIIIII_3I
+JNIEXPORT void JNICALL GL_NATIVE(glTexSubImage2D__IIIIIIII_3I)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jintArray arg8)
 {
 	jint *lparg8=NULL;
-	GL_NATIVE_ENTER(env, that, glTexSubImage2D_FUNC);
+	GL_NATIVE_ENTER(env, that, glTexSubImage2D__IIIIIIII_3I_FUNC);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
 		if (arg8) lparg8 = (*env)->GetPrimitiveArrayCritical(env, arg8, NULL);
@@ -5434,7 +5436,7 @@ JNIEXPORT void JNICALL GL_NATIVE(glTexSubImage2D)
 	{
 		if (arg8) (*env)->ReleaseIntArrayElements(env, arg8, lparg8, 0);
 	}
-	GL_NATIVE_EXIT(env, that, glTexSubImage2D_FUNC);
+	GL_NATIVE_EXIT(env, that, glTexSubImage2D__IIIIIIII_3I_FUNC);
 }
 #endif
 
@@ -5637,6 +5639,12 @@ JNIEXPORT void JNICALL GL_NATIVE(glVertex3f)
 	glVertex3f(arg0, arg1, arg2);
 	GL_NATIVE_EXIT(env, that, glVertex3f_FUNC);
 }
+
+JNIEXPORT void JNICALL GL_CRITICAL(glVertex3f)
+	(jfloat arg0, jfloat arg1, jfloat arg2)
+{
+	glVertex3f(arg0, arg1, arg2);
+}
 #endif
 
 #ifndef NO_glVertex3fv
@@ -5888,12 +5896,12 @@ JNIEXPORT void JNICALL GL_NATIVE(glVertex4sv)
 }
 #endif
 
-#ifndef NO_glVertexPointer
-JNIEXPORT void JNICALL GL_NATIVE(glVertexPointer)
+#ifndef NO_glVertexPointer__III_3I
+JNIEXPORT void JNICALL GL_NATIVE(glVertexPointer__III_3I)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jintArray arg3)
 {
 	jint *lparg3=NULL;
-	GL_NATIVE_ENTER(env, that, glVertexPointer_FUNC);
+	GL_NATIVE_ENTER(env, that, glVertexPointer__III_3I_FUNC);
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
 		if (arg3) lparg3 = (*env)->GetPrimitiveArrayCritical(env, arg3, NULL);
@@ -5911,7 +5919,7 @@ JNIEXPORT void JNICALL GL_NATIVE(glVertexPointer)
 	{
 		if (arg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
 	}
-	GL_NATIVE_EXIT(env, that, glVertexPointer_FUNC);
+	GL_NATIVE_EXIT(env, that, glVertexPointer__III_3I_FUNC);
 }
 #endif
 
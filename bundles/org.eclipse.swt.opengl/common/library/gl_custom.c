@@ -0,0 +1,638 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at 
+ * http://www.eclipse.org/legal/epl-v10.html
+ * 
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+
+#include "swt.h"
+#include "gl_structs.h"
+#include "gl_stats.h"
+#include <stddef.h>
+#ifdef WIN32
+#elif defined(__APPLE__)
+#include <dlfcn.h>
+#else
+#include <GL/glx.h>
+#endif
+
+#define GL_NATIVE(func) Java_org_eclipse_opengl_GL_##func
+
+/*
+ * The array pointer natives pin the array only for the duration of the call,
+ * so GL may read from memory that has been released.  These versions take
+ * direct buffers instead, whose memory stays put until the buffer is
+ * collected.  A buffer that is not direct has no address and the call is
+ * ignored.
+ */
+#ifdef JNI_VERSION_1_4
+#define GET_BUFFER_ADDRESS(env, buffer) (*env)->GetDirectBufferAddress(env, buffer)
+#else
+#define GET_BUFFER_ADDRESS(env, buffer) NULL
+#endif
+
+#ifndef NO_glColorPointer__IIILjava_nio_Buffer_2
+JNIEXPORT void JNICALL GL_NATIVE(glColorPointer__IIILjava_nio_Buffer_2)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jobject arg3)
+{
+	void *lparg3=NULL;
+	GL_NATIVE_ENTER(env, that, glColorPointer__IIILjava_nio_Buffer_2_FUNC);
+	if (arg3) lparg3 = GET_BUFFER_ADDRESS(env, arg3);
+	if (arg3 == NULL || lparg3 != NULL) glColorPointer(arg0, arg1, arg2, lparg3);
+	GL_NATIVE_EXIT(env, that, glColorPointer__IIILjava_nio_Buffer_2_FUNC);
+}
+#endif
+
+#ifndef NO_glDrawElements__IIILjava_nio_Buffer_2
+JNIEXPORT void JNICALL GL_NATIVE(glDrawElements__IIILjava_nio_Buffer_2)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jobject arg3)
+{
+	void *lparg3=NULL;
+	GL_NATIVE_ENTER(env, that, glDrawElements__IIILjava_nio_Buffer_2_FUNC);
+	if (arg3) lparg3 = GET_BUFFER_ADDRESS(env, arg3);
+	if (arg3 == NULL || lparg3 != NULL) glDrawElements(arg0, arg1, arg2, lparg3);
+	GL_NATIVE_EXIT(env, that, glDrawElements__IIILjava_nio_Buffer_2_FUNC);
+}
+#endif
+
+#ifndef NO_glInterleavedArrays__IILjava_nio_Buffer_2
+JNIEXPORT void JNICALL GL_NATIVE(glInterleavedArrays__IILjava_nio_Buffer_2)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jobject arg2)
+{
+	void *lparg2=NULL;
+	GL_NATIVE_ENTER(env, that, glInterleavedArrays__IILjava_nio_Buffer_2_FUNC);
+	if (arg2) lparg2 = GET_BUFFER_ADDRESS(env, arg2);
+	if (arg2 == NULL || lparg2 != NULL) glInterleavedArrays(arg0, arg1, lparg2);
+	GL_NATIVE_EXIT(env, that, glInterleavedArrays__IILjava_nio_Buffer_2_FUNC);
+}
+#endif
+
+#ifndef NO_glNormalPointer__IILjava_nio_Buffer_2
+JNIEXPORT void JNICALL GL_NATIVE(glNormalPointer__IILjava_nio_Buffer_2)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jobject arg2)
+{
+	void *lparg2=NULL;
+	GL_NATIVE_ENTER(env, that, glNormalPointer__IILjava_nio_Buffer_2_FUNC);
+	if (arg2) lparg2 = GET_BUFFER_ADDRESS(env, arg2);
+	if (arg2 == NULL || lparg2 != NULL) glNormalPointer(arg0, arg1, lparg2);
+	GL_NATIVE_EXIT(env, that, glNormalPointer__IILjava_nio_Buffer_2_FUNC);
+}
+#endif
+
+#ifndef NO_glTexCoordPointer__IIILjava_nio_Buffer_2
+JNIEXPORT void JNICALL GL_NATIVE(glTexCoordPointer__IIILjava_nio_Buffer_2)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jobject arg3)
+{
+	void *lparg3=NULL;
+	GL_NATIVE_ENTER(env, that, glTexCoordPointer__IIILjava_nio_Buffer_2_FUNC);
+	if (arg3) lparg3 = GET_BUFFER_ADDRESS(env, arg3);
+	if (arg3 == NULL || lparg3 != NULL) glTexCoordPointer(arg0, arg1, arg2, lparg3);
+	GL_NATIVE_EXIT(env, that, glTexCoordPointer__IIILjava_nio_Buffer_2_FUNC);
+}
+#endif
+
+#ifndef NO_glTexImage2D__IIIIIIIILjava_nio_Buffer_2
+JNIEXPORT void JNICALL GL_NATIVE(glTexImage2D__IIIIIIIILjava_nio_Buffer_2)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jobject arg8)
+{
+	void *lparg8=NULL;
+	GL_NATIVE_ENTER(env, that, glTexImage2D__IIIIIIIILjava_nio_Buffer_2_FUNC);
+	if (arg8) lparg8 = GET_BUFFER_ADDRESS(env, arg8);
+	if (arg8 == NULL || lparg8 != NULL) glTexImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, lparg8);
+	GL_NATIVE_EXIT(env, that, glTexImage2D__IIIIIIIILjava_nio_Buffer_2_FUNC);
+}
+#endif
+
+#ifndef NO_glTexSubImage2D__IIIIIIIILjava_nio_Buffer_2
+JNIEXPORT void JNICALL GL_NATIVE(glTexSubImage2D__IIIIIIIILjava_nio_Buffer_2)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jobject arg8)
+{
+	void *lparg8=NULL;
+	GL_NATIVE_ENTER(env, that, glTexSubImage2D__IIIIIIIILjava_nio_Buffer_2_FUNC);
+	if (arg8) lparg8 = GET_BUFFER_ADDRESS(env, arg8);
+	if (arg8 == NULL || lparg8 != NULL) glTexSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, lparg8);
+	GL_NATIVE_EXIT(env, that, glTexSubImage2D__IIIIIIIILjava_nio_Buffer_2_FUNC);
+}
+#endif
+
+#ifndef NO_glVertexPointer__IIILjava_nio_Buffer_2
+JNIEXPORT void JNICALL GL_NATIVE(glVertexPointer__IIILjava_nio_Buffer_2)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jobject arg3)
+{
+	void *lparg3=NULL;
+	GL_NATIVE_ENTER(env, that, glVertexPointer__IIILjava_nio_Buffer_2_FUNC);
+	if (arg3) lparg3 = GET_BUFFER_ADDRESS(env, arg3);
+	if (arg3 == NULL || lparg3 != NULL) glVertexPointer(arg0, arg1, arg2, lparg3);
+	GL_NATIVE_EXIT(env, that, glVertexPointer__IIILjava_nio_Buffer_2_FUNC);
+}
+#endif
+
+/*
+ * Replays a stream of immediate mode calls built by GLCommandBuffer.  Each
+ * command is one of its opcodes followed by the arguments, all stored as
+ * floats.  The replay stops at an unknown opcode or a truncated command.
+ */
+static void replayCommands(const jfloat *commands, jint length)
+{
+	const jfloat *args;
+	jint i = 0;
+	while (i < length) {
+		jint op = (jint)commands[i++], count;
+		switch (op) {
+			case 1: case 9: case 15: case 16: case 17: case 18: count = 1; break;
+			case 2: case 13: case 14: count = 0; break;
+			case 3: case 8: count = 2; break;
+			case 4: case 5: case 7: case 10: case 12: count = 3; break;
+			case 6: case 11: count = 4; break;
+			default: return;
+		}
+		if (length - i < count) return;
+		args = commands + i;
+		i += count;
+		switch (op) {
+			case 1: glBegin((GLenum)args[0]); break;
+			case 2: glEnd(); break;
+			case 3: glVertex2f(args[0], args[1]); break;
+			case 4: glVertex3f(args[0], args[1], args[2]); break;
+			case 5: glColor3f(args[0], args[1], args[2]); break;
+			case 6: glColor4f(args[0], args[1], args[2], args[3]); break;
+			case 7: glNormal3f(args[0], args[1], args[2]); break;
+			case 8: glTexCoord2f(args[0], args[1]); break;
+			case 9: glCallList((GLuint)args[0]); break;
+			case 10: glTranslatef(args[0], args[1], args[2]); break;
+			case 11: glRotatef(args[0], args[1], args[2], args[3]); break;
+			case 12: glScalef(args[0], args[1], args[2]); break;
+			case 13: glPushMatrix(); break;
+			case 14: glPopMatrix(); break;
+			case 15: glEnable((GLenum)args[0]); break;
+			case 16: glDisable((GLenum)args[0]); break;
+			case 17: glLineWidth(args[0]); break;
+			case 18: glPointSize(args[0]); break;
+		}
+	}
+}
+
+#ifndef NO_glCommands___3FI
+JNIEXPORT void JNICALL GL_NATIVE(glCommands___3FI)
+	(JNIEnv *env, jclass that, jfloatArray arg0, jint arg1)
+{
+	jfloat *lparg0=NULL;
+	GL_NATIVE_ENTER(env, that, glCommands___3FI_FUNC);
+	if (arg0 && arg1 <= (*env)->GetArrayLength(env, arg0)) {
+#ifdef JNI_VERSION_1_2
+		if (IS_JNI_1_2) {
+			lparg0 = (*env)->GetPrimitiveArrayCritical(env, arg0, NULL);
+		} else
+#endif
+		{
+			lparg0 = (*env)->GetFloatArrayElements(env, arg0, NULL);
+		}
+	}
+	if (lparg0) {
+		replayCommands(lparg0, arg1);
+#ifdef JNI_VERSION_1_2
+		if (IS_JNI_1_2) {
+			(*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, JNI_ABORT);
+		} else
+#endif
+		{
+			(*env)->ReleaseFloatArrayElements(env, arg0, lparg0, JNI_ABORT);
+		}
+	}
+	GL_NATIVE_EXIT(env, that, glCommands___3FI_FUNC);
+}
+#endif
+
+#ifndef NO_glCommands__Ljava_nio_FloatBuffer_2I
+JNIEXPORT void JNICALL GL_NATIVE(glCommands__Ljava_nio_FloatBuffer_2I)
+	(JNIEnv *env, jclass that, jobject arg0, jint arg1)
+{
+	jfloat *lparg0=NULL;
+	GL_NATIVE_ENTER(env, that, glCommands__Ljava_nio_FloatBuffer_2I_FUNC);
+	if (arg0) lparg0 = GET_BUFFER_ADDRESS(env, arg0);
+#ifdef JNI_VERSION_1_4
+	if (lparg0 && arg1 > (*env)->GetDirectBufferCapacity(env, arg0)) lparg0 = NULL;
+#endif
+	if (lparg0) replayCommands(lparg0, arg1);
+	GL_NATIVE_EXIT(env, that, glCommands__Ljava_nio_FloatBuffer_2I_FUNC);
+}
+#endif
+
+/*
+ * Buffer objects, framebuffer objects and fences are not part of OpenGL
+ * 1.1, so they are looked up at run time.  All entry points are resolved
+ * together into one table the first time any of them is used with a
+ * context, and resolved again only when a different context is current,
+ * since the addresses returned by wglGetProcAddress are specific to the
+ * context.  A native returns without doing anything when the current
+ * context does not provide the function it needs.
+ */
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+#ifndef GL_WAIT_FAILED
+#define GL_WAIT_FAILED 0x911D
+#endif
+
+typedef void (APIENTRY *SWT_PFNGLGENBUFFERS)(GLsizei, GLuint *);
+typedef void (APIENTRY *SWT_PFNGLDELETEBUFFERS)(GLsizei, const GLuint *);
+typedef void (APIENTRY *SWT_PFNGLBINDBUFFER)(GLenum, GLuint);
+typedef void (APIENTRY *SWT_PFNGLBUFFERDATA)(GLenum, ptrdiff_t, const GLvoid *, GLenum);
+typedef GLvoid *(APIENTRY *SWT_PFNGLMAPBUFFER)(GLenum, GLenum);
+typedef GLboolean (APIENTRY *SWT_PFNGLUNMAPBUFFER)(GLenum);
+typedef void *(APIENTRY *SWT_PFNGLFENCESYNC)(GLenum, GLbitfield);
+typedef GLenum (APIENTRY *SWT_PFNGLCLIENTWAITSYNC)(void *, GLbitfield, jlong);
+typedef void (APIENTRY *SWT_PFNGLDELETESYNC)(void *);
+typedef void (APIENTRY *SWT_PFNGLBINDFRAMEBUFFER)(GLenum, GLuint);
+typedef void (APIENTRY *SWT_PFNGLBINDRENDERBUFFER)(GLenum, GLuint);
+typedef GLenum (APIENTRY *SWT_PFNGLCHECKFRAMEBUFFERSTATUS)(GLenum);
+typedef void (APIENTRY *SWT_PFNGLDELETEFRAMEBUFFERS)(GLsizei, const GLuint *);
+typedef void (APIENTRY *SWT_PFNGLDELETERENDERBUFFERS)(GLsizei, const GLuint *);
+typedef void (APIENTRY *SWT_PFNGLFRAMEBUFFERRENDERBUFFER)(GLenum, GLenum, GLenum, GLuint);
+typedef void (APIENTRY *SWT_PFNGLFRAMEBUFFERTEXTURE2D)(GLenum, GLenum, GLenum, GLuint, GLint);
+typedef void (APIENTRY *SWT_PFNGLGENFRAMEBUFFERS)(GLsizei, GLuint *);
+typedef void (APIENTRY *SWT_PFNGLGENRENDERBUFFERS)(GLsizei, GLuint *);
+typedef void (APIENTRY *SWT_PFNGLRENDERBUFFERSTORAGE)(GLenum, GLenum, GLsizei, GLsizei);
+
+enum {
+	PROC_glBindBuffer,
+	PROC_glBindFramebuffer,
+	PROC_glBindRenderbuffer,
+	PROC_glBufferData,
+	PROC_glCheckFramebufferStatus,
+	PROC_glClientWaitSync,
+	PROC_glDeleteBuffers,
+	PROC_glDeleteFramebuffers,
+	PROC_glDeleteRenderbuffers,
+	PROC_glDeleteSync,
+	PROC_glFenceSync,
+	PROC_glFramebufferRenderbuffer,
+	PROC_glFramebufferTexture2D,
+	PROC_glGenBuffers,
+	PROC_glGenFramebuffers,
+	PROC_glGenRenderbuffers,
+	PROC_glMapBuffer,
+	PROC_glRenderbufferStorage,
+	PROC_glUnmapBuffer,
+	PROC_COUNT
+};
+
+static const char *procNames[PROC_COUNT] = {
+	"glBindBuffer",
+	"glBindFramebuffer",
+	"glBindRenderbuffer",
+	"glBufferData",
+	"glCheckFramebufferStatus",
+	"glClientWaitSync",
+	"glDeleteBuffers",
+	"glDeleteFramebuffers",
+	"glDeleteRenderbuffers",
+	"glDeleteSync",
+	"glFenceSync",
+	"glFramebufferRenderbuffer",
+	"glFramebufferTexture2D",
+	"glGenBuffers",
+	"glGenFramebuffers",
+	"glGenRenderbuffers",
+	"glMapBuffer",
+	"glRenderbufferStorage",
+	"glUnmapBuffer",
+};
+static void *procs[PROC_COUNT];
+static void *procsContext = NULL;
+
+static void *lookupProc(const char *name)
+{
+#ifdef WIN32
+	return (void *)wglGetProcAddress(name);
+#elif defined(__APPLE__)
+	return dlsym(RTLD_DEFAULT, name);
+#else
+	return (void *)glXGetProcAddressARB((const GLubyte *)name);
+#endif
+}
+
+static void *currentContext()
+{
+#ifdef WIN32
+	return (void *)wglGetCurrentContext();
+#elif defined(__APPLE__)
+	/* dlsym does not depend on the context */
+	return (void *)procs;
+#else
+	return (void *)glXGetCurrentContext();
+#endif
+}
+
+static void *loadProc(int index)
+{
+	void *context = currentContext();
+	if (context == NULL) return NULL;
+	if (context != procsContext) {
+		int i;
+		for (i = 0; i < PROC_COUNT; i++) {
+			procs[i] = lookupProc(procNames[i]);
+		}
+		procsContext = context;
+	}
+	return procs[index];
+}
+
+#define LOAD_PROC(type, var, name) \
+	type var = (type)loadProc(PROC_##name);
+
+#ifndef NO_glBindBuffer
+JNIEXPORT void JNICALL GL_NATIVE(glBindBuffer)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1)
+{
+	LOAD_PROC(SWT_PFNGLBINDBUFFER, proc, glBindBuffer)
+	GL_NATIVE_ENTER(env, that, glBindBuffer_FUNC);
+	if (proc) proc(arg0, arg1);
+	GL_NATIVE_EXIT(env, that, glBindBuffer_FUNC);
+}
+#endif
+
+#ifndef NO_glBindFramebuffer
+JNIEXPORT void JNICALL GL_NATIVE(glBindFramebuffer)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1)
+{
+	LOAD_PROC(SWT_PFNGLBINDFRAMEBUFFER, proc, glBindFramebuffer)
+	GL_NATIVE_ENTER(env, that, glBindFramebuffer_FUNC);
+	if (proc) proc(arg0, arg1);
+	GL_NATIVE_EXIT(env, that, glBindFramebuffer_FUNC);
+}
+#endif
+
+#ifndef NO_glBindRenderbuffer
+JNIEXPORT void JNICALL GL_NATIVE(glBindRenderbuffer)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1)
+{
+	LOAD_PROC(SWT_PFNGLBINDRENDERBUFFER, proc, glBindRenderbuffer)
+	GL_NATIVE_ENTER(env, that, glBindRenderbuffer_FUNC);
+	if (proc) proc(arg0, arg1);
+	GL_NATIVE_EXIT(env, that, glBindRenderbuffer_FUNC);
+}
+#endif
+
+#ifndef NO_glBufferData
+JNIEXPORT void JNICALL GL_NATIVE(glBufferData)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jobject arg2, jint arg3)
+{
+	void *lparg2=NULL;
+	LOAD_PROC(SWT_PFNGLBUFFERDATA, proc, glBufferData)
+	GL_NATIVE_ENTER(env, that, glBufferData_FUNC);
+	if (arg2) lparg2 = GET_BUFFER_ADDRESS(env, arg2);
+	if (proc && (arg2 == NULL || lparg2 != NULL)) proc(arg0, arg1, lparg2, arg3);
+	GL_NATIVE_EXIT(env, that, glBufferData_FUNC);
+}
+#endif
+
+#ifndef NO_glCheckFramebufferStatus
+JNIEXPORT jint JNICALL GL_NATIVE(glCheckFramebufferStatus)
+	(JNIEnv *env, jclass that, jint arg0)
+{
+	jint rc = 0;
+	LOAD_PROC(SWT_PFNGLCHECKFRAMEBUFFERSTATUS, proc, glCheckFramebufferStatus)
+	GL_NATIVE_ENTER(env, that, glCheckFramebufferStatus_FUNC);
+	if (proc) rc = (jint)proc(arg0);
+	GL_NATIVE_EXIT(env, that, glCheckFramebufferStatus_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_glClientWaitSync
+JNIEXPORT jint JNICALL GL_NATIVE(glClientWaitSync)
+	(JNIEnv *env, jclass that, jlong arg0, jint arg1, jlong arg2)
+{
+	jint rc = GL_WAIT_FAILED;
+	LOAD_PROC(SWT_PFNGLCLIENTWAITSYNC, proc, glClientWaitSync)
+	GL_NATIVE_ENTER(env, that, glClientWaitSync_FUNC);
+	if (proc && arg0) rc = (jint)proc((void *)(size_t)arg0, arg1, arg2);
+	GL_NATIVE_EXIT(env, that, glClientWaitSync_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_glDeleteBuffers
+JNIEXPORT void JNICALL GL_NATIVE(glDeleteBuffers)
+	(JNIEnv *env, jclass that, jint arg0, jintArray arg1)
+{
+	jint *lparg1=NULL;
+	LOAD_PROC(SWT_PFNGLDELETEBUFFERS, proc, glDeleteBuffers)
+	GL_NATIVE_ENTER(env, that, glDeleteBuffers_FUNC);
+	if (proc && arg1 && arg0 <= (*env)->GetArrayLength(env, arg1)) {
+		if ((lparg1 = (*env)->GetIntArrayElements(env, arg1, NULL)) != NULL) {
+			proc(arg0, (const GLuint *)lparg1);
+			(*env)->ReleaseIntArrayElements(env, arg1, lparg1, JNI_ABORT);
+		}
+	}
+	GL_NATIVE_EXIT(env, that, glDeleteBuffers_FUNC);
+}
+#endif
+
+#ifndef NO_glDeleteFramebuffers
+JNIEXPORT void JNICALL GL_NATIVE(glDeleteFramebuffers)
+	(JNIEnv *env, jclass that, jint arg0, jintArray arg1)
+{
+	jint *lparg1=NULL;
+	LOAD_PROC(SWT_PFNGLDELETEFRAMEBUFFERS, proc, glDeleteFramebuffers)
+	GL_NATIVE_ENTER(env, that, glDeleteFramebuffers_FUNC);
+	if (proc && arg1 && arg0 <= (*env)->GetArrayLength(env, arg1)) {
+		if ((lparg1 = (*env)->GetIntArrayElements(env, arg1, NULL)) != NULL) {
+			proc(arg0, (const GLuint *)lparg1);
+			(*env)->ReleaseIntArrayElements(env, arg1, lparg1, JNI_ABORT);
+		}
+	}
+	GL_NATIVE_EXIT(env, that, glDeleteFramebuffers_FUNC);
+}
+#endif
+
+#ifndef NO_glDeleteRenderbuffers
+JNIEXPORT void JNICALL GL_NATIVE(glDeleteRenderbuffers)
+	(JNIEnv *env, jclass that, jint arg0, jintArray arg1)
+{
+	jint *lparg1=NULL;
+	LOAD_PROC(SWT_PFNGLDELETERENDERBUFFERS, proc, glDeleteRenderbuffers)
+	GL_NATIVE_ENTER(env, that, glDeleteRenderbuffers_FUNC);
+	if (proc && arg1 && arg0 <= (*env)->GetArrayLength(env, arg1)) {
+		if ((lparg1 = (*env)->GetIntArrayElements(env, arg1, NULL)) != NULL) {
+			proc(arg0, (const GLuint *)lparg1);
+			(*env)->ReleaseIntArrayElements(env, arg1, lparg1, JNI_ABORT);
+		}
+	}
+	GL_NATIVE_EXIT(env, that, glDeleteRenderbuffers_FUNC);
+}
+#endif
+
+#ifndef NO_glDeleteSync
+JNIEXPORT void JNICALL GL_NATIVE(glDeleteSync)
+	(JNIEnv *env, jclass that, jlong arg0)
+{
+	LOAD_PROC(SWT_PFNGLDELETESYNC, proc, glDeleteSync)
+	GL_NATIVE_ENTER(env, that, glDeleteSync_FUNC);
+	if (proc && arg0) proc((void *)(size_t)arg0);
+	GL_NATIVE_EXIT(env, that, glDeleteSync_FUNC);
+}
+#endif
+
+#ifndef NO_glFenceSync
+JNIEXPORT jlong JNICALL GL_NATIVE(glFenceSync)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1)
+{
+	jlong rc = 0;
+	LOAD_PROC(SWT_PFNGLFENCESYNC, proc, glFenceSync)
+	GL_NATIVE_ENTER(env, that, glFenceSync_FUNC);
+	if (proc) rc = (jlong)(size_t)proc(arg0, arg1);
+	GL_NATIVE_EXIT(env, that, glFenceSync_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_glFramebufferRenderbuffer
+JNIEXPORT void JNICALL GL_NATIVE(glFramebufferRenderbuffer)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3)
+{
+	LOAD_PROC(SWT_PFNGLFRAMEBUFFERRENDERBUFFER, proc, glFramebufferRenderbuffer)
+	GL_NATIVE_ENTER(env, that, glFramebufferRenderbuffer_FUNC);
+	if (proc) proc(arg0, arg1, arg2, arg3);
+	GL_NATIVE_EXIT(env, that, glFramebufferRenderbuffer_FUNC);
+}
+#endif
+
+#ifndef NO_glFramebufferTexture2D
+JNIEXPORT void JNICALL GL_NATIVE(glFramebufferTexture2D)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jint arg4)
+{
+	LOAD_PROC(SWT_PFNGLFRAMEBUFFERTEXTURE2D, proc, glFramebufferTexture2D)
+	GL_NATIVE_ENTER(env, that, glFramebufferTexture2D_FUNC);
+	if (proc) proc(arg0, arg1, arg2, arg3, arg4);
+	GL_NATIVE_EXIT(env, that, glFramebufferTexture2D_FUNC);
+}
+#endif
+
+#ifndef NO_glGenBuffers
+JNIEXPORT void JNICALL GL_NATIVE(glGenBuffers)
+	(JNIEnv *env, jclass that, jint arg0, jintArray arg1)
+{
+	jint *lparg1=NULL;
+	LOAD_PROC(SWT_PFNGLGENBUFFERS, proc, glGenBuffers)
+	GL_NATIVE_ENTER(env, that, glGenBuffers_FUNC);
+	if (proc && arg1 && arg0 <= (*env)->GetArrayLength(env, arg1)) {
+		if ((lparg1 = (*env)->GetIntArrayElements(env, arg1, NULL)) != NULL) {
+			proc(arg0, (GLuint *)lparg1);
+			(*env)->ReleaseIntArrayElements(env, arg1, lparg1, 0);
+		}
+	}
+	GL_NATIVE_EXIT(env, that, glGenBuffers_FUNC);
+}
+#endif
+
+#ifndef NO_glGenFramebuffers
+JNIEXPORT void JNICALL GL_NATIVE(glGenFramebuffers)
+	(JNIEnv *env, jclass that, jint arg0, jintArray arg1)
+{
+	jint *lparg1=NULL;
+	LOAD_PROC(SWT_PFNGLGENFRAMEBUFFERS, proc, glGenFramebuffers)
+	GL_NATIVE_ENTER(env, that, glGenFramebuffers_FUNC);
+	if (proc && arg1 && arg0 <= (*env)->GetArrayLength(env, arg1)) {
+		if ((lparg1 = (*env)->GetIntArrayElements(env, arg1, NULL)) != NULL) {
+			proc(arg0, (GLuint *)lparg1);
+			(*env)->ReleaseIntArrayElements(env, arg1, lparg1, 0);
+		}
+	}
+	GL_NATIVE_EXIT(env, that, glGenFramebuffers_FUNC);
+}
+#endif
+
+#ifndef NO_glGenRenderbuffers
+JNIEXPORT void JNICALL GL_NATIVE(glGenRenderbuffers)
+	(JNIEnv *env, jclass that, jint arg0, jintArray arg1)
+{
+	jint *lparg1=NULL;
+	LOAD_PROC(SWT_PFNGLGENRENDERBUFFERS, proc, glGenRenderbuffers)
+	GL_NATIVE_ENTER(env, that, glGenRenderbuffers_FUNC);
+	if (proc && arg1 && arg0 <= (*env)->GetArrayLength(env, arg1)) {
+		if ((lparg1 = (*env)->GetIntArrayElements(env, arg1, NULL)) != NULL) {
+			proc(arg0, (GLuint *)lparg1);
+			(*env)->ReleaseIntArrayElements(env, arg1, lparg1, 0);
+		}
+	}
+	GL_NATIVE_EXIT(env, that, glGenRenderbuffers_FUNC);
+}
+#endif
+
+#ifndef NO_glMapBuffer
+JNIEXPORT jobject JNICALL GL_NATIVE(glMapBuffer)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
+{
+	jobject rc = NULL;
+	LOAD_PROC(SWT_PFNGLMAPBUFFER, proc, glMapBuffer)
+	GL_NATIVE_ENTER(env, that, glMapBuffer_FUNC);
+#ifdef JNI_VERSION_1_4
+	if (proc) {
+		void *address = proc(arg0, arg1);
+		if (address) rc = (*env)->NewDirectByteBuffer(env, address, arg2);
+	}
+#endif
+	GL_NATIVE_EXIT(env, that, glMapBuffer_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_glReadPixels__IIIIIII
+JNIEXPORT void JNICALL GL_NATIVE(glReadPixels__IIIIIII)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6)
+{
+	GL_NATIVE_ENTER(env, that, glReadPixels__IIIIIII_FUNC);
+	glReadPixels(arg0, arg1, arg2, arg3, arg4, arg5, (GLvoid *)(size_t)arg6);
+	GL_NATIVE_EXIT(env, that, glReadPixels__IIIIIII_FUNC);
+}
+#endif
+
+#ifndef NO_glRenderbufferStorage
+JNIEXPORT void JNICALL GL_NATIVE(glRenderbufferStorage)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3)
+{
+	LOAD_PROC(SWT_PFNGLRENDERBUFFERSTORAGE, proc, glRenderbufferStorage)
+	GL_NATIVE_ENTER(env, that, glRenderbufferStorage_FUNC);
+	if (proc) proc(arg0, arg1, arg2, arg3);
+	GL_NATIVE_EXIT(env, that, glRenderbufferStorage_FUNC);
+}
+#endif
+
+#ifndef NO_glTexImage2D__IIIIIIIII
+JNIEXPORT void JNICALL GL_NATIVE(glTexImage2D__IIIIIIIII)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jint arg8)
+{
+	GL_NATIVE_ENTER(env, that, glTexImage2D__IIIIIIIII_FUNC);
+	glTexImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, (const GLvoid *)(size_t)arg8);
+	GL_NATIVE_EXIT(env, that, glTexImage2D__IIIIIIIII_FUNC);
+}
+#endif
+
+#ifndef NO_glTexSubImage2D__IIIIIIIII
+JNIEXPORT void JNICALL GL_NATIVE(glTexSubImage2D__IIIIIIIII)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jint arg8)
+{
+	GL_NATIVE_ENTER(env, that, glTexSubImage2D__IIIIIIIII_FUNC);
+	glTexSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, (const GLvoid *)(size_t)arg8);
+	GL_NATIVE_EXIT(env, that, glTexSubImage2D__IIIIIIIII_FUNC);
+}
+#endif
+
+#ifndef NO_glUnmapBuffer
+JNIEXPORT jboolean JNICALL GL_NATIVE(glUnmapBuffer)
+	(JNIEnv *env, jclass that, jint arg0)
+{
+	jboolean rc = JNI_FALSE;
+	LOAD_PROC(SWT_PFNGLUNMAPBUFFER, proc, glUnmapBuffer)
+	GL_NATIVE_ENTER(env, that, glUnmapBuffer_FUNC);
+	if (proc) rc = (jboolean)proc(arg0);
+	GL_NATIVE_EXIT(env, that, glUnmapBuffer_FUNC);
+	return rc;
+}
+#endif
@@ -3,27 +3,33 @@
 
 #ifdef NATIVE_STATS
 
-int GL_nativeFunctionCount = 335;
-int GL_nativeFunctionCallCount[335];
+int GL_nativeFunctionCount = 355;
+int GL_nativeFunctionCallCount[355];
 char * GL_nativeFunctionNames[] = {
 	"glAccum", 
 	"glAlphaFunc", 
 	"glAreTexturesResident", 
 	"glArrayElement", 
 	"glBegin", 
+	"glBindBuffer", 
+	"glBindFramebuffer", 
+	"glBindRenderbuffer", 
 	"glBindTexture", 
 	"glBitmap", 
 	"glBlendFunc", 
+	"glBufferData", 
 	"glCallList", 
 	"glCallLists__II_3B", 
 	"glCallLists__II_3C", 
 	"glCallLists__II_3I", 
+	"glCheckFramebufferStatus", 
 	"glClear", 
 	"glClearAccum", 
 	"glClearColor", 
 	"glClearDepth", 
 	"glClearIndex", 
 	"glClearStencil", 
+	"glClientWaitSync", 
 	"glClipPlane", 
 	"glColor3b", 
 	"glColor3bv", 
@@ -58,14 +64,21 @@ char * GL_nativeFunctionNames[] = {
 	"glColor4usv", 
 	"glColorMask", 
 	"glColorMaterial", 
-	"glColorPointer", 
+	"glColorPointer__III_3I", 
+	"glColorPointer__IIILjava_nio_Buffer_2", 
+	"glCommands___3FI", 
+	"glCommands__Ljava_nio_FloatBuffer_2I", 
 	"glCopyPixels", 
 	"glCopyTexImage1D", 
 	"glCopyTexImage2D", 
 	"glCopyTexSubImage1D", 
 	"glCopyTexSubImage2D", 
 	"glCullFace", 
+	"glDeleteBuffers", 
+	"glDeleteFramebuffers", 
 	"glDeleteLists", 
+	"glDeleteRenderbuffers", 
+	"glDeleteSync", 
 	"glDeleteTextures", 
 	"glDepthFunc", 
 	"glDepthMask", 
@@ -74,7 +87,8 @@ char * GL_nativeFunctionNames[] = {
 	"glDisableClientState", 
 	"glDrawArrays", 
 	"glDrawBuffer", 
-	"glDrawElements", 
+	"glDrawElements__III_3I", 
+	"glDrawElements__IIILjava_nio_Buffer_2", 
 	"glDrawPixels", 
 	"glEdgeFlag", 
 	"glEdgeFlagPointer", 
@@ -96,15 +110,21 @@ char * GL_nativeFunctionNames[] = {
 	"glEvalPoint1", 
 	"glEvalPoint2", 
 	"glFeedbackBuffer", 
+	"glFenceSync", 
 	"glFinish", 
 	"glFlush", 
 	"glFogf", 
 	"glFogfv", 
 	"glFogi", 
 	"glFogiv", 
+	"glFramebufferRenderbuffer", 
+	"glFramebufferTexture2D", 
 	"glFrontFace", 
 	"glFrustum", 
+	"glGenBuffers", 
+	"glGenFramebuffers", 
 	"glGenLists", 
+	"glGenRenderbuffers", 
 	"glGenTextures", 
 	"glGetBooleanv", 
 	"glGetClipPlane", 
@@ -147,7 +167,8 @@ char * GL_nativeFunctionNames[] = {
 	"glIndexs", 
 	"glIndexsv", 
 	"glInitNames", 
-	"glInterleavedArrays", 
+	"glInterleavedArrays__II_3I", 
+	"glInterleavedArrays__IILjava_nio_Buffer_2", 
 	"glIsEnabled", 
 	"glIsList", 
 	"glIsTexture", 
@@ -171,6 +192,7 @@ char * GL_nativeFunctionNames[] = {
 	"glMap1f", 
 	"glMap2d", 
 	"glMap2f", 
+	"glMapBuffer", 
 	"glMapGrid1d", 
 	"glMapGrid1f", 
 	"glMapGrid2d", 
@@ -193,7 +215,8 @@ char * GL_nativeFunctionNames[] = {
 	"glNormal3iv", 
 	"glNormal3s", 
 	"glNormal3sv", 
-	"glNormalPointer", 
+	"glNormalPointer__II_3I", 
+	"glNormalPointer__IILjava_nio_Buffer_2", 
 	"glOrtho", 
 	"glPassThrough", 
 	"glPixelMapfv", 
@@ -242,7 +265,8 @@ char * GL_nativeFunctionNames[] = {
 	"glRasterPos4s", 
 	"glRasterPos4sv", 
 	"glReadBuffer", 
-	"glReadPixels", 
+	"glReadPixels__IIIIII_3I", 
+	"glReadPixels__IIIIIII", 
 	"glRectd", 
 	"glRectdv", 
 	"glRectf", 
@@ -251,6 +275,7 @@ char * GL_nativeFunctionNames[] = {
 	"glRectiv", 
 	"glRects", 
 	"glRectsv", 
+	"glRenderbufferStorage", 
 	"glRenderMode", 
 	"glRotated", 
 	"glRotatef", 
@@ -294,7 +319,8 @@ char * GL_nativeFunctionNames[] = {
 	"glTexCoord4iv", 
 	"glTexCoord4s", 
 	"glTexCoord4sv", 
-	"glTexCoordPointer", 
+	"glTexCoordPointer__III_3I", 
+	"glTexCoordPointer__IIILjava_nio_Buffer_2", 
 	"glTexEnvf", 
 	"glTexEnvfv", 
 	"glTexEnvi", 
@@ -306,15 +332,20 @@ char * GL_nativeFunctionNames[] = {
 	"glTexGeni", 
 	"glTexGeniv", 
 	"glTexImage1D", 
-	"glTexImage2D", 
+	"glTexImage2D__IIIIIIII_3B", 
+	"glTexImage2D__IIIIIIIII", 
+	"glTexImage2D__IIIIIIIILjava_nio_Buffer_2", 
 	"glTexParameterf", 
 	"glTexParameterfv", 
 	"glTexParameteri", 
 	"glTexParameteriv", 
 	"glTexSubImage1D", 
-	"glTexSubImage2D", 
+	"glTexSubImage2D__IIIIIIII_3I", 
+	"glTexSubImage2D__IIIIIIIII", 
+	"glTexSubImage2D__IIIIIIIILjava_nio_Buffer_2", 
 	"glTranslated", 
 	"glTranslatef", 
+	"glUnmapBuffer", 
 	"glVertex2d", 
 	"glVertex2dv", 
 	"glVertex2f", 
@@ -339,7 +370,8 @@ char * GL_nativeFunctionNames[] = {
 	"glVertex4iv", 
 	"glVertex4s", 
 	"glVertex4sv", 
-	"glVertexPointer", 
+	"glVertexPointer__III_3I", 
+	"glVertexPointer__IIILjava_nio_Buffer_2", 
 	"glViewport", 
 };
 
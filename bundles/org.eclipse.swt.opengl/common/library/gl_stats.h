@@ -15,19 +15,25 @@ typedef enum {
 	glAreTexturesResident_FUNC,
 	glArrayElement_FUNC,
 	glBegin_FUNC,
+	glBindBuffer_FUNC,
+	glBindFramebuffer_FUNC,
+	glBindRenderbuffer_FUNC,
 	glBindTexture_FUNC,
 	glBitmap_FUNC,
 	glBlendFunc_FUNC,
+	glBufferData_FUNC,
 	glCallList_FUNC,
 	glCallLists__II_3B_FUNC,
 	glCallLists__II_3C_FUNC,
 	glCallLists__II_3I_FUNC,
+	glCheckFramebufferStatus_FUNC,
 	glClear_FUNC,
 	glClearAccum_FUNC,
 	glClearColor_FUNC,
 	glClearDepth_FUNC,
 	glClearIndex_FUNC,
 	glClearStencil_FUNC,
+	glClientWaitSync_FUNC,
 	glClipPlane_FUNC,
 	glColor3b_FUNC,
 	glColor3bv_FUNC,
@@ -62,14 +68,21 @@ typedef enum {
 	glColor4usv_FUNC,
 	glColorMask_FUNC,
 	glColorMaterial_FUNC,
-	glColorPointer_FUNC,
+	glColorPointer__III_3I_FUNC,
+	glColorPointer__IIILjava_nio_Buffer_2_FUNC,
+	glCommands___3FI_FUNC,
+	glCommands__Ljava_nio_FloatBuffer_2I_FUNC,
 	glCopyPixels_FUNC,
 	glCopyTexImage1D_FUNC,
 	glCopyTexImage2D_FUNC,
 	glCopyTexSubImage1D_FUNC,
 	glCopyTexSubImage2D_FUNC,
 	glCullFace_FUNC,
+	glDeleteBuffers_FUNC,
+	glDeleteFramebuffers_FUNC,
 	glDeleteLists_FUNC,
+	glDeleteRenderbuffers_FUNC,
+	glDeleteSync_FUNC,
 	glDeleteTextures_FUNC,
 	glDepthFunc_FUNC,
 	glDepthMask_FUNC,
@@ -78,7 +91,8 @@ typedef enum {
 	glDisableClientState_FUNC,
 	glDrawArrays_FUNC,
 	glDrawBuffer_FUNC,
-	glDrawElements_FUNC,
+	glDrawElements__III_3I_FUNC,
+	glDrawElements__IIILjava_nio_Buffer_2_FUNC,
 	glDrawPixels_FUNC,
 	glEdgeFlag_FUNC,
 	glEdgeFlagPointer_FUNC,
@@ -100,15 +114,21 @@ typedef enum {
 	glEvalPoint1_FUNC,
 	glEvalPoint2_FUNC,
 	glFeedbackBuffer_FUNC,
+	glFenceSync_FUNC,
 	glFinish_FUNC,
 	glFlush_FUNC,
 	glFogf_FUNC,
 	glFogfv_FUNC,
 	glFogi_FUNC,
 	glFogiv_FUNC,
+	glFramebufferRenderbuffer_FUNC,
+	glFramebufferTexture2D_FUNC,
 	glFrontFace_FUNC,
 	glFrustum_FUNC,
+	glGenBuffers_FUNC,
+	glGenFramebuffers_FUNC,
 	glGenLists_FUNC,
+	glGenRenderbuffers_FUNC,
 	glGenTextures_FUNC,
 	glGetBooleanv_FUNC,
 	glGetClipPlane_FUNC,
@@ -151,7 +171,8 @@ typedef enum {
 	glIndexs_FUNC,
 	glIndexsv_FUNC,
 	glInitNames_FUNC,
-	glInterleavedArrays_FUNC,
+	glInterleavedArrays__II_3I_FUNC,
+	glInterleavedArrays__IILjava_nio_Buffer_2_FUNC,
 	glIsEnabled_FUNC,
 	glIsList_FUNC,
 	glIsTexture_FUNC,
@@ -175,6 +196,7 @@ typedef enum {
 	glMap1f_FUNC,
 	glMap2d_FUNC,
 	glMap2f_FUNC,
+	glMapBuffer_FUNC,
 	glMapGrid1d_FUNC,
 	glMapGrid1f_FUNC,
 	glMapGrid2d_FUNC,
@@ -197,7 +219,8 @@ typedef enum {
 	glNormal3iv_FUNC,
 	glNormal3s_FUNC,
 	glNormal3sv_FUNC,
-	glNormalPointer_FUNC,
+	glNormalPointer__II_3I_FUNC,
+	glNormalPointer__IILjava_nio_Buffer_2_FUNC,
 	glOrtho_FUNC,
 	glPassThrough_FUNC,
 	glPixelMapfv_FUNC,
@@ -246,7 +269,8 @@ typedef enum {
 	glRasterPos4s_FUNC,
 	glRasterPos4sv_FUNC,
 	glReadBuffer_FUNC,
-	glReadPixels_FUNC,
+	glReadPixels__IIIIII_3I_FUNC,
+	glReadPixels__IIIIIII_FUNC,
 	glRectd_FUNC,
 	glRectdv_FUNC,
 	glRectf_FUNC,
@@ -255,6 +279,7 @@ typedef enum {
 	glRectiv_FUNC,
 	glRects_FUNC,
 	glRectsv_FUNC,
+	glRenderbufferStorage_FUNC,
 	glRenderMode_FUNC,
 	glRotated_FUNC,
 	glRotatef_FUNC,
@@ -298,7 +323,8 @@ typedef enum {
 	glTexCoord4iv_FUNC,
 	glTexCoord4s_FUNC,
 	glTexCoord4sv_FUNC,
-	glTexCoordPointer_FUNC,
+	glTexCoordPointer__III_3I_FUNC,
+	glTexCoordPointer__IIILjava_nio_Buffer_2_FUNC,
 	glTexEnvf_FUNC,
 	glTexEnvfv_FUNC,
 	glTexEnvi_FUNC,
@@ -310,15 +336,20 @@ typedef enum {
 	glTexGeni_FUNC,
 	glTexGeniv_FUNC,
 	glTexImage1D_FUNC,
-	glTexImage2D_FUNC,
+	glTexImage2D__IIIIIIII_3B_FUNC,
+	glTexImage2D__IIIIIIIII_FUNC,
+	glTexImage2D__IIIIIIIILjava_nio_Buffer_2_FUNC,
 	glTexParameterf_FUNC,
 	glTexParameterfv_FUNC,
 	glTexParameteri_FUNC,
 	glTexParameteriv_FUNC,
 	glTexSubImage1D_FUNC,
-	glTexSubImage2D_FUNC,
+	glTexSubImage2D__IIIIIIII_3I_FUNC,
+	glTexSubImage2D__IIIIIIIII_FUNC,
+	glTexSubImage2D__IIIIIIIILjava_nio_Buffer_2_FUNC,
 	glTranslated_FUNC,
 	glTranslatef_FUNC,
+	glUnmapBuffer_FUNC,
 	glVertex2d_FUNC,
 	glVertex2dv_FUNC,
 	glVertex2f_FUNC,
@@ -343,6 +374,7 @@ typedef enum {
 	glVertex4iv_FUNC,
 	glVertex4s_FUNC,
 	glVertex4sv_FUNC,
-	glVertexPointer_FUNC,
+	glVertexPointer__III_3I_FUNC,
+	glVertexPointer__IIILjava_nio_Buffer_2_FUNC,
 	glViewport_FUNC,
 } GL_FUNCS;
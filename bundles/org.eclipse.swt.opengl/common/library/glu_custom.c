@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at 
+ * http://www.eclipse.org/legal/epl-v10.html
+ * 
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+
+#include "swt.h"
+#include "glu_structs.h"
+#include "glu_stats.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define GLU_NATIVE(func) Java_org_eclipse_opengl_GLU_##func
+
+#ifndef CALLBACK
+#define CALLBACK
+#endif
+
+/*
+ * Collects the triangles produced by the tessellator.  Vertex data is the
+ * index of the vertex, either one of the input vertices or one created by
+ * the combine callback at an intersection, which follow the input vertices.
+ * Setting an edge flag callback makes GLU emit independent triangles only.
+ */
+typedef struct TessResult {
+	jint inputCount;
+	GLdouble *vertices;
+	jint vertexCount, vertexCapacity;
+	jint *indices;
+	jint indexCount, indexCapacity;
+	GLenum error;
+} TessResult;
+
+static int ensureCapacity(void **array, jint *capacity, jint count, size_t size)
+{
+	void *newArray;
+	jint newCapacity;
+	if (count <= *capacity) return 1;
+	newCapacity = *capacity * 2;
+	if (newCapacity < count) newCapacity = count;
+	if ((newArray = realloc(*array, newCapacity * size)) == NULL) return 0;
+	*array = newArray;
+	*capacity = newCapacity;
+	return 1;
+}
+
+static void CALLBACK tessEdgeFlag(GLboolean flag, void *data)
+{
+}
+
+static void CALLBACK tessVertex(void *vertex, void *data)
+{
+	TessResult *result = (TessResult *)data;
+	if (result->error) return;
+	if (!ensureCapacity((void **)&result->indices, &result->indexCapacity, result->indexCount + 1, sizeof(jint))) {
+		result->error = GLU_OUT_OF_MEMORY;
+		return;
+	}
+	result->indices[result->indexCount++] = (jint)(size_t)vertex;
+}
+
+static void CALLBACK tessCombine(GLdouble coords[3], void *vertexData[4], GLfloat weight[4], void **outData, void *data)
+{
+	TessResult *result = (TessResult *)data;
+	jint index = result->vertexCount;
+	*outData = NULL;
+	if (!ensureCapacity((void **)&result->vertices, &result->vertexCapacity, index + 1, 3 * sizeof(GLdouble))) {
+		result->error = GLU_OUT_OF_MEMORY;
+		return;
+	}
+	memcpy(result->vertices + 3 * index, coords, 3 * sizeof(GLdouble));
+	result->vertexCount++;
+	*outData = (void *)(size_t)(result->inputCount + index);
+}
+
+static void CALLBACK tessError(GLenum error, void *data)
+{
+	TessResult *result = (TessResult *)data;
+	if (!result->error) result->error = error;
+}
+
+#ifndef NO_gluTessTriangles
+JNIEXPORT jdoubleArray JNICALL GLU_NATIVE(gluTessTriangles)
+	(JNIEnv *env, jclass that, jdoubleArray arg0, jintArray arg1, jint arg2, jdouble arg3, jdouble arg4, jdouble arg5)
+{
+	TessResult result;
+	GLUtesselator *tess = NULL;
+	GLdouble *input = NULL;
+	jint *lparg1 = NULL;
+	jdoubleArray rc = NULL;
+	jint i, j, contourCount, total = 0;
+	GLU_NATIVE_ENTER(env, that, gluTessTriangles_FUNC);
+	memset(&result, 0, sizeof(result));
+	if (arg0 == NULL || arg1 == NULL) goto fail;
+	contourCount = (*env)->GetArrayLength(env, arg1);
+	if ((lparg1 = (*env)->GetIntArrayElements(env, arg1, NULL)) == NULL) goto fail;
+	for (i = 0; i < contourCount; i++) {
+		if (lparg1[i] < 0 || lparg1[i] > (*env)->GetArrayLength(env, arg0) / 3 - total) goto fail;
+		total += lparg1[i];
+	}
+
+	/* The input vertices must stay in place until the polygon ends */
+	if ((input = malloc((total > 0 ? total : 1) * 3 * sizeof(GLdouble))) == NULL) goto fail;
+	(*env)->GetDoubleArrayRegion(env, arg0, 0, total * 3, input);
+	result.inputCount = total;
+	if ((tess = gluNewTess()) == NULL) goto fail;
+	gluTessProperty(tess, GLU_TESS_WINDING_RULE, arg2);
+	gluTessNormal(tess, arg3, arg4, arg5);
+	gluTessCallback(tess, GLU_TESS_EDGE_FLAG_DATA, (GLvoid (CALLBACK *)())tessEdgeFlag);
+	gluTessCallback(tess, GLU_TESS_VERTEX_DATA, (GLvoid (CALLBACK *)())tessVertex);
+	gluTessCallback(tess, GLU_TESS_COMBINE_DATA, (GLvoid (CALLBACK *)())tessCombine);
+	gluTessCallback(tess, GLU_TESS_ERROR_DATA, (GLvoid (CALLBACK *)())tessError);
+	gluTessBeginPolygon(tess, &result);
+	for (i = 0, total = 0; i < contourCount; i++) {
+		gluTessBeginContour(tess);
+		for (j = 0; j < lparg1[i]; j++, total++) {
+			gluTessVertex(tess, input + 3 * total, (void *)(size_t)total);
+		}
+		gluTessEndContour(tess);
+	}
+	gluTessEndPolygon(tess);
+	if (result.error) goto fail;
+
+	/* vertex count, index count, the vertices and then the indices */
+	total = result.inputCount + result.vertexCount;
+	if ((rc = (*env)->NewDoubleArray(env, 2 + 3 * total + result.indexCount)) != NULL) {
+		jdouble *lprc = (*env)->GetDoubleArrayElements(env, rc, NULL);
+		if (lprc != NULL) {
+			lprc[0] = total;
+			lprc[1] = result.indexCount;
+			memcpy(lprc + 2, input, 3 * result.inputCount * sizeof(GLdouble));
+			memcpy(lprc + 2 + 3 * result.inputCount, result.vertices, 3 * result.vertexCount * sizeof(GLdouble));
+			for (i = 0; i < result.indexCount; i++) {
+				lprc[2 + 3 * total + i] = result.indices[i];
+			}
+			(*env)->ReleaseDoubleArrayElements(env, rc, lprc, 0);
+		} else {
+			rc = NULL;
+		}
+	}
+fail:
+	if (tess) gluDeleteTess(tess);
+	if (lparg1) (*env)->ReleaseIntArrayElements(env, arg1, lparg1, JNI_ABORT);
+	free(input);
+	free(result.vertices);
+	free(result.indices);
+	GLU_NATIVE_EXIT(env, that, gluTessTriangles_FUNC);
+	return rc;
+}
+#endif
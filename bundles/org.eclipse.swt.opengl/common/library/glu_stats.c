@@ -3,8 +3,8 @@
 
 #ifdef NATIVE_STATS
 
-int GLU_nativeFunctionCount = 51;
-int GLU_nativeFunctionCallCount[51];
+int GLU_nativeFunctionCount = 52;
+int GLU_nativeFunctionCallCount[52];
 char * GLU_nativeFunctionNames[] = {
 	"gluBeginCurve", 
 	"gluBeginPolygon", 
@@ -55,6 +55,7 @@ char * GLU_nativeFunctionNames[] = {
 	"gluTessEndPolygon", 
 	"gluTessNormal", 
 	"gluTessProperty", 
+	"gluTessTriangles", 
 	"gluTessVertex", 
 	"gluUnProject", 
 };
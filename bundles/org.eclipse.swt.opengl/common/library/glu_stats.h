@@ -59,6 +59,7 @@ typedef enum {
 	gluTessEndPolygon_FUNC,
 	gluTessNormal_FUNC,
 	gluTessProperty_FUNC,
+	gluTessTriangles_FUNC,
 	gluTessVertex_FUNC,
 	gluUnProject_FUNC,
 } GLU_FUNCS;
@@ -10,6 +10,10 @@
  *******************************************************************************/
 package org.eclipse.opengl;
 
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.FloatBuffer;
+
 public class GL {
 
 	public static final int GL_VERSION_1_1 = 1;
@@ -1094,6 +1098,32 @@ public class GL {
 	/* WIN_specular_fog */
 	public static final int GL_FOG_SPECULAR_TEXTURE_WIN = 0x80EC;
 
+	/* ARB_pixel_buffer_object, looked up at run time */
+	public static final int GL_PIXEL_PACK_BUFFER = 0x88EB;
+	public static final int GL_PIXEL_UNPACK_BUFFER = 0x88EC;
+	public static final int GL_STREAM_READ = 0x88E1;
+	public static final int GL_STATIC_READ = 0x88E5;
+	public static final int GL_DYNAMIC_READ = 0x88E9;
+	public static final int GL_READ_ONLY = 0x88B8;
+
+	/* ARB_sync, looked up at run time */
+	public static final int GL_SYNC_GPU_COMMANDS_COMPLETE = 0x9117;
+	public static final int GL_SYNC_FLUSH_COMMANDS_BIT = 0x00000001;
+	public static final int GL_ALREADY_SIGNALED = 0x911A;
+	public static final int GL_TIMEOUT_EXPIRED = 0x911B;
+	public static final int GL_CONDITION_SATISFIED = 0x911C;
+	public static final int GL_WAIT_FAILED = 0x911D;
+
+	/* ARB_framebuffer_object, looked up at run time */
+	public static final int GL_FRAMEBUFFER = 0x8D40;
+	public static final int GL_READ_FRAMEBUFFER = 0x8CA8;
+	public static final int GL_DRAW_FRAMEBUFFER = 0x8CA9;
+	public static final int GL_RENDERBUFFER = 0x8D41;
+	public static final int GL_COLOR_ATTACHMENT0 = 0x8CE0;
+	public static final int GL_DEPTH_ATTACHMENT = 0x8D00;
+	public static final int GL_DEPTH_COMPONENT24 = 0x81A6;
+	public static final int GL_FRAMEBUFFER_COMPLETE = 0x8CD5;
+
 	/* For compatibility with OpenGL v1.0 */
 	public static final int GL_LOGIC_OP = GL_INDEX_LOGIC_OP;
 	public static final int GL_TEXTURE_COMPONENTS = GL_TEXTURE_INTERNAL_FORMAT;
@@ -1103,6 +1133,16 @@ public class GL {
 	public static final native boolean glAreTexturesResident (int n, int[] textures, boolean[] residences);
 	public static final native void glArrayElement (int index);
 	public static final native void glBegin (int mode);
+	public static final native void glBindBuffer (int target, int buffer); /* RUN TIME LOOKUP */
+	public static final native void glBindFramebuffer (int target, int framebuffer); /* RUN TIME LOOKUP */
+	public static final native void glBindRenderbuffer (int target, int renderbuffer); /* RUN TIME LOOKUP */
+	public static final native void glBufferData (int target, int size, Buffer data, int usage); /* RUN TIME LOOKUP, DIRECT BUFFER */
+	public static final native int glCheckFramebufferStatus (int target); /* RUN TIME LOOKUP */
+	public static final native int glClientWaitSync (long sync, int flags, long timeout); /* RUN TIME LOOKUP */
+	public static final native void glDeleteBuffers (int n, int[] buffers); /* RUN TIME LOOKUP */
+	public static final native void glDeleteFramebuffers (int n, int[] framebuffers); /* RUN TIME LOOKUP */
+	public static final native void glDeleteRenderbuffers (int n, int[] renderbuffers); /* RUN TIME LOOKUP */
+	public static final native void glDeleteSync (long sync); /* RUN TIME LOOKUP */
 	public static final native void glEnd ();
 	public static final native void glBindTexture (int target, int texture);
 	public static final native void glBitmap (int width, int height, float xorig, float yorig, float xmove, float ymove, byte[] bitmap);
@@ -1152,6 +1192,9 @@ public class GL {
 	public static final native void glColorMask (boolean red, boolean green, boolean blue, boolean alpha);
 	public static final native void glColorMaterial (int face, int mode);
 	public static final native void glColorPointer (int size, int type, int stride, int[] pointer);
+	public static final native void glColorPointer (int size, int type, int stride, Buffer pointer); /* DIRECT BUFFER */
+	public static final native void glCommands (float[] commands, int length); /* SEE GLCommandBuffer */
+	public static final native void glCommands (FloatBuffer commands, int length); /* DIRECT BUFFER, SEE GLCommandBuffer */
 	//public static final native void glColorTableEXT (int target, int internalFormat, int width, int format, int type, int[] data);
 	//public static final native void glColorSubTableEXT (int target, int start, int count, int format, int type, int[] data);
 	public static final native void glCopyPixels (int x, int y, int width, int height, int type);
@@ -1168,6 +1211,7 @@ public class GL {
 	public static final native void glDrawArrays (int mode, int first, int count);
 	public static final native void glDrawBuffer (int mode);
 	public static final native void glDrawElements (int mode, int count, int type, int[] indices); /* MULTIPLES TYPES */
+	public static final native void glDrawElements (int mode, int count, int type, Buffer indices); /* DIRECT BUFFER */
 	public static final native void glDrawPixels (int width, int height, int format, int type, int[] pixels); /* MULTIPLES TYPES */
 	public static final native void glEdgeFlag (boolean flag);
 	public static final native void glEdgeFlagv (boolean[] flag);
@@ -1189,15 +1233,21 @@ public class GL {
 	public static final native void glEvalPoint1 (int i);
 	public static final native void glEvalPoint2 (int i, int j);
 	public static final native void glFeedbackBuffer (int size, int type, float[] buffer);
+	public static final native long glFenceSync (int condition, int flags); /* RUN TIME LOOKUP */
 	public static final native void glFinish ();
 	public static final native void glFlush ();
 	public static final native void glFogf (int pname, float param);
 	public static final native void glFogi (int pname, int param);
 	public static final native void glFogfv (int pname, float[] params);
 	public static final native void glFogiv (int pname, int[] params);
+	public static final native void glFramebufferRenderbuffer (int target, int attachment, int renderbuffertarget, int renderbuffer); /* RUN TIME LOOKUP */
+	public static final native void glFramebufferTexture2D (int target, int attachment, int textarget, int texture, int level); /* RUN TIME LOOKUP */
 	public static final native void glFrontFace (int mode);
 	public static final native void glFrustum (double left, double right, double bottom, double top, double znear, double zfar);
+	public static final native void glGenBuffers (int n, int[] buffers); /* RUN TIME LOOKUP */
+	public static final native void glGenFramebuffers (int n, int[] framebuffers); /* RUN TIME LOOKUP */
 	public static final native int glGenLists (int range);
+	public static final native void glGenRenderbuffers (int n, int[] renderbuffers); /* RUN TIME LOOKUP */
 	public static final native void glGenTextures (int n, int[] textures);
 	public static final native void glGetBooleanv (int pname, boolean[] params);
 	public static final native void glGetDoublev (int pname, double[] params);
@@ -1247,6 +1297,7 @@ public class GL {
 	/* MULTIPLES TYPES */
 	public static final native void glInitNames ();
 	public static final native void glInterleavedArrays (int format, int stride, int[] pointer);
+	public static final native void glInterleavedArrays (int format, int stride, Buffer pointer); /* DIRECT BUFFER */
 	/* CHECK */
 	public static final native boolean glIsEnabled (int cap);
 	public static final native boolean glIsList (int list);
@@ -1272,6 +1323,7 @@ public class GL {
 	public static final native void glMap1f (int target, float u1, float u2, int stride, int order, float[] points);
 	public static final native void glMap2d (int target, double u1, double u2, int ustride, int uorder, double v1, double v2, int vstride, int vorder, double[] points);
 	public static final native void glMap2f (int target, float u1, float u2, int ustride, int uorder, float v1, float v2, int vstride, int vorder, float[] points);
+	public static final native ByteBuffer glMapBuffer (int target, int access, int size); /* RUN TIME LOOKUP, size IS THE LENGTH OF THE RETURNED BUFFER */
 	public static final native void glMapGrid1d (int un, double u1, double u2);
 	public static final native void glMapGrid1f (int un, float u1, float u2);
 	public static final native void glMapGrid2d (int un, double u1, double u2, int vm, double v1, double v2);
@@ -1296,6 +1348,7 @@ public class GL {
 	public static final native void glNormal3iv (int[] v);
 	public static final native void glNormal3sv (short[] v);
 	public static final native void glNormalPointer (int type, int stride, int[] pointer); /* MULTIPLES TYPES ARRAY */
+	public static final native void glNormalPointer (int type, int stride, Buffer pointer); /* DIRECT BUFFER */
 	public static final native void glOrtho (double left, double right, double bottom, double top, double znear, double zfar);
 	public static final native void glPassThrough (float token);
 	public static final native void glPixelMapfv (int map, int mapsize, float[] values);
@@ -1345,6 +1398,7 @@ public class GL {
 	public static final native void glRasterPos4sv (short[] v);
 	public static final native void glReadBuffer (int mode);
 	public static final native void glReadPixels (int x, int y, int width, int height, int format, int type, int[] pixels); /* MULTIPLES TYPES ARRAY */
+	public static final native void glReadPixels (int x, int y, int width, int height, int format, int type, int offset); /* OFFSET INTO THE BOUND PIXEL PACK BUFFER */
 	public static final native void glRectd (double x1, double y1, double x2, double y2);
 	public static final native void glRectf (float x1, float y1, float x2, float y2);
 	public static final native void glRecti (int x1, int y1, int x2, int y2);
@@ -1353,6 +1407,7 @@ public class GL {
 	public static final native void glRectfv (float[] v1, float[] v2);
 	public static final native void glRectiv (int[] v1, int[] v2);
 	public static final native void glRectsv (short[] v, short[] v2);
+	public static final native void glRenderbufferStorage (int target, int internalformat, int width, int height); /* RUN TIME LOOKUP */
 	public static final native int glRenderMode (int mode);
 	public static final native void glRotated (double angle, double x, double y, double z);
 	public static final native void glRotatef (float angle, float x, float y, float z);
@@ -1398,6 +1453,7 @@ public class GL {
 	public static final native void glTexCoord4iv (int[] v);
 	public static final native void glTexCoord4sv (short[] v);
 	public static final native void glTexCoordPointer (int size, int type, int stride, int[] pointer); /*MULTIPLES ARRAYS - CHECK MSDK, COUNT PARAM MISSING */
+	public static final native void glTexCoordPointer (int size, int type, int stride, Buffer pointer); /* DIRECT BUFFER */
 	public static final native void glTexEnvf (int target, int pname, float param);
 	public static final native void glTexEnvi (int target, int pname, int param);
 	public static final native void glTexEnvfv (int target, int pname, float[] params);
@@ -1410,19 +1466,25 @@ public class GL {
 	public static final native void glTexGeniv (int coord, int pname, int[] params);
 	public static final native void glTexImage1D (int target, int level, int internalFormat, int width, int border, int format, int type, int[] pixels); /* MULTIPLES ARRAYS */
 	public static final native void glTexImage2D (int target, int level, int internalFormat, int width, int height, int border, int format, int type, byte[] pixels); /* MULTIPLES ARRAYS */
+	public static final native void glTexImage2D (int target, int level, int internalFormat, int width, int height, int border, int format, int type, Buffer pixels); /* DIRECT BUFFER */
+	public static final native void glTexImage2D (int target, int level, int internalFormat, int width, int height, int border, int format, int type, int pixels); /* ADDRESS, OR OFFSET INTO THE BOUND PIXEL UNPACK BUFFER */
 	public static final native void glTexParameterf (int target, int pname, float param);
 	public static final native void glTexParameteri (int target, int pname, int param);
 	public static final native void glTexParameterfv (int target, int pname, float[] params);
 	public static final native void glTexParameteriv (int target, int pname, int[] params);
 	public static final native void glTexSubImage1D (int target, int level, int xoffset, int width, int format, int type, int[] pixels); /* MULTIPLES ARRAYS */
 	public static final native void glTexSubImage2D (int target, int level, int xoffset, int yoffset, int width, int height, int format, int type, int[] pixels); /* MULTIPLES ARRAYS */
+	public static final native void glTexSubImage2D (int target, int level, int xoffset, int yoffset, int width, int height, int format, int type, Buffer pixels); /* DIRECT BUFFER */
+	public static final native void glTexSubImage2D (int target, int level, int xoffset, int yoffset, int width, int height, int format, int type, int pixels); /* ADDRESS, OR OFFSET INTO THE BOUND PIXEL UNPACK BUFFER */
 	public static final native void glTranslated (double x, double y, double z);
 	public static final native void glTranslatef (float x, float y, float z);
+	public static final native boolean glUnmapBuffer (int target); /* RUN TIME LOOKUP */
 	public static final native void glVertex2d (double x, double y);
 	public static final native void glVertex2f (float x, float y);
 	public static final native void glVertex2i (int x, int y);
 	public static final native void glVertex2s (short x, short y);
 	public static final native void glVertex3d (double x, double y, double z);
+	/** @method flags=leaf */
 	public static final native void glVertex3f (float x, float y, float z);
 	public static final native void glVertex3i (int x, int y, int z);
 	public static final native void glVertex3s (short x, short y, short z);
@@ -1443,5 +1505,6 @@ public class GL {
 	public static final native void glVertex4iv (int[] v);
 	public static final native void glVertex4sv (short[] v);
 	public static final native void glVertexPointer (int size, int type, int stride, int[] pointer); /* MULTIPLES ARRAYS */
+	public static final native void glVertexPointer (int size, int type, int stride, Buffer pointer); /* DIRECT BUFFER */
 	public static final native void glViewport (int x, int y, int width, int height);
 }
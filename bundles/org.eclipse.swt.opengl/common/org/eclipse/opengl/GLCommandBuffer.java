@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.opengl;
+
+/**
+ * Records immediate mode calls so that they can be replayed with a
+ * single native call, or compiled into a display list that is drawn
+ * again without any further calls from Java.
+ * <p>
+ * Every command is an opcode followed by its arguments, all stored as
+ * floats, so enumerations and display list names must be exactly
+ * representable as floats.  The same stream can be stored in a direct
+ * <code>FloatBuffer</code> in native byte order and replayed with
+ * <code>GL.glCommands</code>.
+ * </p>
+ */
+public class GLCommandBuffer {
+	float[] commands = new float[256];
+	int length;
+
+	public static final int BEGIN = 1;
+	public static final int END = 2;
+	public static final int VERTEX2 = 3;
+	public static final int VERTEX3 = 4;
+	public static final int COLOR3 = 5;
+	public static final int COLOR4 = 6;
+	public static final int NORMAL3 = 7;
+	public static final int TEX_COORD2 = 8;
+	public static final int CALL_LIST = 9;
+	public static final int TRANSLATE = 10;
+	public static final int ROTATE = 11;
+	public static final int SCALE = 12;
+	public static final int PUSH_MATRIX = 13;
+	public static final int POP_MATRIX = 14;
+	public static final int ENABLE = 15;
+	public static final int DISABLE = 16;
+	public static final int LINE_WIDTH = 17;
+	public static final int POINT_SIZE = 18;
+
+void add(int op, int count) {
+	if (length + count + 1 > commands.length) {
+		float[] newCommands = new float[Math.max(commands.length * 2, length + count + 1)];
+		System.arraycopy(commands, 0, newCommands, 0, length);
+		commands = newCommands;
+	}
+	commands[length++] = op;
+}
+
+public void glBegin(int mode) {
+	add(BEGIN, 1);
+	commands[length++] = mode;
+}
+
+public void glEnd() {
+	add(END, 0);
+}
+
+public void glVertex2f(float x, float y) {
+	add(VERTEX2, 2);
+	commands[length++] = x;
+	commands[length++] = y;
+}
+
+public void glVertex3f(float x, float y, float z) {
+	add(VERTEX3, 3);
+	commands[length++] = x;
+	commands[length++] = y;
+	commands[length++] = z;
+}
+
+public void glColor3f(float red, float green, float blue) {
+	add(COLOR3, 3);
+	commands[length++] = red;
+	commands[length++] = green;
+	commands[length++] = blue;
+}
+
+public void glColor4f(float red, float green, float blue, float alpha) {
+	add(COLOR4, 4);
+	commands[length++] = red;
+	commands[length++] = green;
+	commands[length++] = blue;
+	commands[length++] = alpha;
+}
+
+public void glNormal3f(float nx, float ny, float nz) {
+	add(NORMAL3, 3);
+	commands[length++] = nx;
+	commands[length++] = ny;
+	commands[length++] = nz;
+}
+
+public void glTexCoord2f(float s, float t) {
+	add(TEX_COORD2, 2);
+	commands[length++] = s;
+	commands[length++] = t;
+}
+
+public void glCallList(int list) {
+	add(CALL_LIST, 1);
+	commands[length++] = list;
+}
+
+public void glTranslatef(float x, float y, float z) {
+	add(TRANSLATE, 3);
+	commands[length++] = x;
+	commands[length++] = y;
+	commands[length++] = z;
+}
+
+public void glRotatef(float angle, float x, float y, float z) {
+	add(ROTATE, 4);
+	commands[length++] = angle;
+	commands[length++] = x;
+	commands[length++] = y;
+	commands[length++] = z;
+}
+
+public void glScalef(float x, float y, float z) {
+	add(SCALE, 3);
+	commands[length++] = x;
+	commands[length++] = y;
+	commands[length++] = z;
+}
+
+public void glPushMatrix() {
+	add(PUSH_MATRIX, 0);
+}
+
+public void glPopMatrix() {
+	add(POP_MATRIX, 0);
+}
+
+public void glEnable(int cap) {
+	add(ENABLE, 1);
+	commands[length++] = cap;
+}
+
+public void glDisable(int cap) {
+	add(DISABLE, 1);
+	commands[length++] = cap;
+}
+
+public void glLineWidth(float width) {
+	add(LINE_WIDTH, 1);
+	commands[length++] = width;
+}
+
+public void glPointSize(float size) {
+	add(POINT_SIZE, 1);
+	commands[length++] = size;
+}
+
+/**
+ * Compiles the recorded commands into the display list <code>list</code>
+ * without executing them.
+ */
+public void compile(int list) {
+	GL.glNewList(list, GL.GL_COMPILE);
+	GL.glCommands(commands, length);
+	GL.glEndList();
+}
+
+/**
+ * Executes the recorded commands.
+ */
+public void replay() {
+	GL.glCommands(commands, length);
+}
+
+/**
+ * Discards the recorded commands.
+ */
+public void reset() {
+	length = 0;
+}
+}
@@ -240,6 +240,16 @@ public class GLU {
 	public static final native void gluTessCallback (int tess, int which, int fn);
 	public static final native void gluTessNormal (int tess, double x, double y, double z);
 	public static final native void gluTessProperty (int tess, int property, double value); /* CHECK MSDN, VALUE'S TYPE IS DOUBLE */
+	/**
+	 * Tessellates the contours into triangles without any callbacks.  The
+	 * contours hold the number of vertices of each contour, whose x, y and
+	 * z coordinates are stored one after the other in <code>coords</code>.
+	 * The result holds the vertex count, the index count, the coordinates
+	 * of the vertices, which are the input vertices followed by the ones
+	 * created at intersections, and then three vertex indices for each
+	 * triangle.  Returns <code>null</code> when the tessellation fails.
+	 */
+	public static final native double[] gluTessTriangles (double[] coords, int[] contours, int winding, double normalX, double normalY, double normalZ);
 	public static final native void gluTessVertex (int tess, double[] coords, int data);
 	public static final native int gluUnProject (double winx, double winy, double winz, double[] modelMatrix, double[] projMatrix, int[] viewport, double[] objx, double[] objy, double[] objz);
 }
@@ -17,7 +17,7 @@ LD=gcc
 WS_PREFIX   = gtk
 GL_PREFIX   = gl
 GL_DLL      = lib$(GL_PREFIX)-$(WS_PREFIX).so
-GL_OBJ      = swt.o gl.o glu.o structs.o glx.o
+GL_OBJ      = swt.o gl.o gl_custom.o glu.o glu_custom.o structs.o glx.o
 GL_LIB      = -shared -L/usr/X11R6/lib -lGL -lGLU -lm
 
 CFLAGS = -O2 -Wall -I.
@@ -16,7 +16,7 @@ JAVA_HOME   = /bluebird/teamswt/swt-builddir/ive/bin
 SWT_PREFIX   = gl
 WS_PREFIX    = motif
 SWT_DLL      = lib$(SWT_PREFIX)-$(WS_PREFIX).so
-SWT_OBJ      = swt.o gl.o glu.o structs.o glx.o
+SWT_OBJ      = swt.o gl.o gl_custom.o glu.o glu_custom.o structs.o glx.o
 SWT_LIB      = -G -L/usr/lib -lm -lGL -lGLU
 
 #
@@ -0,0 +1,329 @@
+/*******************************************************************************
+ * Copyright (c) 2004, 2014 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tools.internal;
+
+import java.lang.reflect.Modifier;
+import java.util.HashSet;
+
+/*
+* Generates Java bindings that use the Foreign Function & Memory API instead
+* of JNI, from the same meta data as the C natives.  Each native becomes a
+* downcall handle and each struct a memory layout, so a struct is passed as
+* a MemorySegment the caller reads and writes in place rather than being
+* copied field by field by the generated get and set functions.
+*
+* The bindings need a JDK with java.lang.foreign and 64 bit natives, so they
+* are written next to the C sources rather than compiled into the bundles.
+* Natives that need the JNIEnv, C++ or an object argument are skipped, as
+* are structs with array or nested struct fields, which have no layout
+* that can be derived from the Java fields alone.
+*/
+public class FFMGenerator extends JNIGenerator {
+
+	HashSet<String> signatures = new HashSet<String>();
+
+@Override
+public void generateCopyright() {
+	outputln(fixDelimiter(getMetaData().getCopyright()));
+}
+
+@Override
+public void generateIncludes() {
+	String className = getMainClass().getName();
+	output("package ");
+	output(className.substring(0, className.lastIndexOf('.')));
+	outputln(";");
+	outputln();
+	outputln("import java.lang.foreign.*;");
+	outputln("import java.lang.invoke.*;");
+	outputln();
+	outputln("import static java.lang.foreign.ValueLayout.*;");
+	outputln();
+}
+
+@Override
+public void generate() {
+	if (classes == null) return;
+	signatures.clear();
+	generateCopyright();
+	generateIncludes();
+	output("public class ");
+	output(getOutputClassName());
+	outputln(" {");
+	outputln();
+	outputln("\tstatic final Linker LINKER = Linker.nativeLinker();");
+	outputln("\tstatic final SymbolLookup LOOKUP = SymbolLookup.loaderLookup().or(LINKER.defaultLookup());");
+	outputln();
+	outputln("static MethodHandle downcall(String name, FunctionDescriptor descriptor) {");
+	outputln("\tMemorySegment address = LOOKUP.find(name).orElse(null);");
+	outputln("\tif (address != null) return LINKER.downcallHandle(address, descriptor);");
+	outputln("\tMethodType type = descriptor.toMethodType();");
+	outputln("\tMethodHandle thrower = MethodHandles.throwException(type.returnType(), UnsupportedOperationException.class);");
+	outputln("\tthrower = thrower.bindTo(new UnsupportedOperationException(name));");
+	outputln("\treturn MethodHandles.dropArguments(thrower, 0, type.parameterList());");
+	outputln("}");
+	outputln();
+	outputln("static RuntimeException rethrow(Throwable e) {");
+	outputln("\tif (e instanceof RuntimeException) return (RuntimeException)e;");
+	outputln("\tif (e instanceof Error) throw (Error)e;");
+	outputln("\treturn new RuntimeException(e);");
+	outputln("}");
+	outputln();
+	sort(classes);
+	for (int i = 0; i < classes.length; i++) {
+		JNIClass clazz = classes[i];
+		if (getGenerate(clazz)) generate(clazz);
+		if (progress != null) progress.step();
+	}
+	outputln("}");
+	output.flush();
+}
+
+@Override
+public void generate(JNIClass clazz) {
+	JNIMethod[] methods = clazz.getDeclaredMethods();
+	boolean hasNatives = false;
+	for (int i = 0; i < methods.length; i++) {
+		if ((methods[i].getModifiers() & Modifier.NATIVE) != 0) hasNatives = true;
+	}
+	if (hasNatives) {
+		sort(methods);
+		for (int i = 0; i < methods.length; i++) {
+			JNIMethod method = methods[i];
+			if ((method.getModifiers() & Modifier.NATIVE) == 0) continue;
+			if (isDowncall(method)) generateDowncall(method);
+		}
+	} else if (isStruct(clazz)) {
+		generateLayout(clazz);
+	}
+}
+
+@Override
+public String getExtension() {
+	return ".java";
+}
+
+@Override
+public String getFileName() {
+	return getOutputClassName() + getExtension();
+}
+
+String getOutputClassName() {
+	return getMainClass().getSimpleName() + "FFM";
+}
+
+boolean isStruct(JNIClass clazz) {
+	JNIField[] fields = clazz.getDeclaredFields();
+	for (int i = 0; i < fields.length; i++) {
+		int mods = fields[i].getModifiers();
+		if ((mods & Modifier.PUBLIC) != 0 && (mods & Modifier.STATIC) == 0) return true;
+	}
+	return false;
+}
+
+boolean isDowncall(JNIMethod method) {
+	if (method.getFlag(FLAG_NO_GEN) || (method.getModifiers() & Modifier.STATIC) == 0) return false;
+	String[] flags = {FLAG_JNI, FLAG_BATCH, FLAG_SIZEOF, FLAG_CPP, FLAG_NEW, FLAG_DELETE, FLAG_GCNEW, FLAG_OBJECT, FLAG_SETTER, FLAG_GETTER, FLAG_ADDER, FLAG_CONST, FLAG_ADDRESS};
+	for (int i = 0; i < flags.length; i++) {
+		if (method.getFlag(flags[i])) return false;
+	}
+	String name = getNativeName(method);
+	if (name.endsWith("_sizeof") || name.equals("memmove") || name.equals("MoveMemory")) return false;
+	if (name.equalsIgnoreCase("call") || name.startsWith("callFunc") || name.startsWith("VtblCall")) return false;
+	JNIType returnType = method.getReturnType64();
+	if (!(returnType.isType("void") || returnType.isPrimitive())) return false;
+	JNIParameter[] params = method.getParameters();
+	for (int i = 0; i < params.length; i++) {
+		JNIParameter param = params[i];
+		JNIType paramType = param.getType64();
+		if (param.getFlag(FLAG_STRUCT) || param.getFlag(FLAG_OBJECT)) return false;
+		if (paramType.isPrimitive()) continue;
+		if (paramType.isArray() && paramType.getComponentType().isPrimitive()) continue;
+		if (paramType.isArray() || paramType.isType("java.lang.String") || paramType.isType("java.lang.Object") || paramType.isType("java.lang.Class")) return false;
+		if (!isStruct(param.getTypeClass())) return false;
+	}
+	return true;
+}
+
+String getNativeName(JNIMethod method) {
+	String accessor = method.getAccessor();
+	if (accessor.length() != 0) return accessor;
+	String name = method.getName();
+	return name.startsWith("_") ? name.substring(1) : name;
+}
+
+/* Booleans are passed and returned as the int sized BOOL and gboolean */
+String getLayout(JNIType type) {
+	if (type.isArray() || !type.isPrimitive()) return "ADDRESS";
+	if (type.isType("int") || type.isType("boolean")) return "JAVA_INT";
+	if (type.isType("long")) return "JAVA_LONG";
+	if (type.isType("short")) return "JAVA_SHORT";
+	if (type.isType("char")) return "JAVA_CHAR";
+	if (type.isType("byte")) return "JAVA_BYTE";
+	if (type.isType("float")) return "JAVA_FLOAT";
+	if (type.isType("double")) return "JAVA_DOUBLE";
+	throw new Error("bad type " + type.getName());
+}
+
+String getJavaType(JNIType type) {
+	if (type.isArray() || !type.isPrimitive()) return "MemorySegment";
+	return type.getName();
+}
+
+int getSize(JNIType type) {
+	if (type.isType("long") || type.isType("double")) return 8;
+	if (type.isType("int") || type.isType("boolean") || type.isType("float")) return 4;
+	if (type.isType("short") || type.isType("char")) return 2;
+	return 1;
+}
+
+void generateDowncall(JNIMethod method) {
+	JNIParameter[] params = method.getParameters();
+	JNIType returnType = method.getReturnType64();
+	StringBuffer signature = new StringBuffer(method.getName());
+	for (int i = 0; i < params.length; i++) {
+		signature.append(',');
+		signature.append(getJavaType(params[i].getType64()));
+	}
+	if (!signatures.add(signature.toString())) return;
+	String handle = "MH_" + getFunctionName(method, method.getParameterTypes64());
+	boolean isVoid = returnType.isType("void");
+	output("\tstatic final MethodHandle ");
+	output(handle);
+	output(" = downcall(\"");
+	output(getNativeName(method));
+	output("\", FunctionDescriptor.");
+	if (isVoid) {
+		output("ofVoid(");
+	} else {
+		output("of(");
+		output(getLayout(returnType));
+		if (params.length != 0) output(", ");
+	}
+	for (int i = 0; i < params.length; i++) {
+		if (i != 0) output(", ");
+		output(getLayout(params[i].getType64()));
+	}
+	outputln("));");
+	output("public static ");
+	output(getJavaType(returnType));
+	output(" ");
+	output(method.getName());
+	output("(");
+	for (int i = 0; i < params.length; i++) {
+		if (i != 0) output(", ");
+		output(getJavaType(params[i].getType64()));
+		output(" arg" + i);
+	}
+	outputln(") {");
+	outputln("\ttry {");
+	output("\t\t");
+	if (!isVoid) {
+		output("return (");
+		output(returnType.isType("boolean") ? "int" : returnType.getName());
+		output(")");
+	}
+	output(handle);
+	output(".invokeExact(");
+	for (int i = 0; i < params.length; i++) {
+		if (i != 0) output(", ");
+		if (params[i].getType64().isType("boolean")) {
+			output("arg" + i + " ? 1 : 0");
+		} else {
+			output("arg" + i);
+		}
+	}
+	output(")");
+	if (returnType.isType("boolean")) output(" != 0");
+	outputln(";");
+	outputln("\t} catch (Throwable e) {");
+	outputln("\t\tthrow rethrow(e);");
+	outputln("\t}");
+	outputln("}");
+	outputln();
+}
+
+/*
+* The fields are laid out in declaration order after those of the super
+* class, each aligned to its size as the C compiler does, and the struct
+* is padded to the alignment of its largest field.
+*/
+void generateLayout(JNIClass clazz) {
+	JNIField[] fields = getLayoutFields(clazz);
+	if (fields == null) return;
+	String clazzName = clazz.getSimpleName();
+	output("\t/** ");
+	output(clazzName);
+	outputln(" */");
+	output("\tpublic static final StructLayout ");
+	output(clazzName);
+	output("_LAYOUT = MemoryLayout.structLayout(");
+	int offset = 0, alignment = 1;
+	for (int i = 0; i < fields.length; i++) {
+		JNIField field = fields[i];
+		JNIType type = field.getType64();
+		int size = getSize(type);
+		alignment = Math.max(alignment, size);
+		int padding = (size - offset % size) % size;
+		if (i != 0) output(",");
+		outputln();
+		if (padding != 0) {
+			outputln("\t\tMemoryLayout.paddingLayout(" + padding + "),");
+			offset += padding;
+		}
+		output("\t\t");
+		output(getLayout(type));
+		output(".withName(\"");
+		String accessor = field.getAccessor();
+		output(accessor.length() != 0 ? accessor : field.getName());
+		output("\")");
+		offset += size;
+	}
+	int padding = (alignment - offset % alignment) % alignment;
+	if (padding != 0) {
+		outputln(",");
+		output("\t\tMemoryLayout.paddingLayout(" + padding + ")");
+	}
+	outputln();
+	outputln("\t);");
+	outputln();
+}
+
+/* Answers the fields of the struct and its super classes, or null if one has no layout */
+JNIField[] getLayoutFields(JNIClass clazz) {
+	JNIField[] superFields = new JNIField[0];
+	JNIClass superclazz = clazz.getSuperclass();
+	if (!superclazz.getName().equals("java.lang.Object")) {
+		superFields = getLayoutFields(superclazz);
+		if (superFields == null) return null;
+	}
+	JNIField[] fields = clazz.getDeclaredFields();
+	int count = 0;
+	for (int i = 0; i < fields.length; i++) {
+		JNIField field = fields[i];
+		int mods = field.getModifiers();
+		if ((mods & Modifier.PUBLIC) == 0 || (mods & (Modifier.STATIC | Modifier.FINAL)) != 0) continue;
+		if (!field.getType64().isPrimitive() || field.getFlag(FLAG_STRUCT)) return null;
+		count++;
+	}
+	JNIField[] result = new JNIField[superFields.length + count];
+	System.arraycopy(superFields, 0, result, 0, superFields.length);
+	count = superFields.length;
+	for (int i = 0; i < fields.length; i++) {
+		JNIField field = fields[i];
+		int mods = field.getModifiers();
+		if ((mods & Modifier.PUBLIC) == 0 || (mods & (Modifier.STATIC | Modifier.FINAL)) != 0) continue;
+		result[count++] = field;
+	}
+	return result;
+}
+
+}
@@ -22,6 +22,7 @@ public interface Flags {
 	public static final String FLAG_UNICODE = "unicode";
 	public static final String FLAG_SENTINEL = "sentinel";
 	public static final String FLAG_CPP = "cpp";
+	public static final String FLAG_PRELOAD = "preload";
 	public static final String FLAG_M = "m";
 	public static final String FLAG_NEW = "new";
 	public static final String FLAG_DELETE ="delete";
@@ -36,4 +37,8 @@ public interface Flags {
 	public static final String FLAG_SETTER = "setter";
 	public static final String FLAG_GETTER = "getter";
 	public static final String FLAG_ADDER = "adder";
+	public static final String FLAG_BATCH = "batch";
+	public static final String FLAG_DESTROY = "destroy";
+	public static final String FLAG_SIZEOF = "sizeof";
+	public static final String FLAG_LEAF = "leaf";
 }
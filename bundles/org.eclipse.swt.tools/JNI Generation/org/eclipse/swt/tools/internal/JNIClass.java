@@ -12,7 +12,7 @@ package org.eclipse.swt.tools.internal;
 
 public interface JNIClass extends JNIItem {
 	
-public static String[] FLAGS = {FLAG_NO_GEN, FLAG_CPP};
+public static String[] FLAGS = {FLAG_NO_GEN, FLAG_CPP, FLAG_PRELOAD};
 
 public String getName();
 
@@ -29,6 +29,9 @@ public class JNIGeneratorApp {
 	
 	static boolean USE_AST = true;
 
+	/* Also write the Foreign Function & Memory bindings when -Dswt.jnigen.ffm=true */
+	static boolean GENERATE_FFM = Boolean.getBoolean("swt.jnigen.ffm");
+
 public JNIGeneratorApp() {
 }
 
@@ -175,6 +178,24 @@ void generateSWT_C(JNIClass[] classes) {
 	}
 }
 
+void generateFFM(JNIClass[] classes) {
+	try {
+		FFMGenerator gen = new FFMGenerator();
+		gen.setMainClass(mainClass);
+		gen.setClasses(classes);
+		gen.setMetaData(metaData);
+		gen.setProgressMonitor(progress);
+		ByteArrayOutputStream out = new ByteArrayOutputStream();
+		gen.setOutput(new PrintStream(out));
+		String fileName = outputDir + gen.getFileName();
+		gen.setDelimiter(JNIGenerator.getDelimiter(fileName));
+		gen.generate();
+		if (out.size() > 0) JNIGenerator.output(out.toByteArray(), fileName);
+	} catch (Exception e) {
+		System.out.println("Problem");
+		e.printStackTrace(System.out);
+	}
+}
 
 void generateMetaData(JNIClass[] classes) {
 	try {
@@ -241,6 +262,7 @@ public void generate(ProgressMonitor progress) {
 		total += classes.length;
 		total += natives.length * (3);
 		total += structs.length * 2;
+		if (GENERATE_FFM) total += classes.length;
 		progress.setTotal(total);
 		progress.setMessage("Generating structs.h ...");
 	}
@@ -253,6 +275,10 @@ public void generate(ProgressMonitor progress) {
 	generateSTATS_H(natives);
 	if (progress != null) progress.setMessage("Generating stats.c ...");
 	generateSTATS_C(natives);
+	if (GENERATE_FFM) {
+		if (progress != null) progress.setMessage("Generating FFM bindings ...");
+		generateFFM(classes);
+	}
 	if (progress != null) progress.setMessage("Generating meta data ...");
 	generateMetaData(classes);
 //	if (progress != null) progress.setMessage("Generating embeded meta data ...");
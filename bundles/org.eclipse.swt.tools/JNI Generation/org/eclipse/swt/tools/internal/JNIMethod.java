@@ -12,7 +12,7 @@ package org.eclipse.swt.tools.internal;
 
 public interface JNIMethod extends JNIItem {
 
-	public static final String[] FLAGS = {FLAG_NO_GEN, FLAG_ADDRESS, FLAG_CONST, FLAG_DYNAMIC, FLAG_JNI, FLAG_CAST, FLAG_CPP, FLAG_NEW, FLAG_DELETE, FLAG_GCNEW, FLAG_OBJECT, FLAG_SETTER, FLAG_GETTER, FLAG_ADDER};
+	public static final String[] FLAGS = {FLAG_NO_GEN, FLAG_ADDRESS, FLAG_CONST, FLAG_DYNAMIC, FLAG_JNI, FLAG_CAST, FLAG_CPP, FLAG_NEW, FLAG_DELETE, FLAG_GCNEW, FLAG_OBJECT, FLAG_SETTER, FLAG_GETTER, FLAG_ADDER, FLAG_BATCH, FLAG_DESTROY, FLAG_SIZEOF, FLAG_LEAF};
 	
 public String getName();
 
@@ -36,7 +36,15 @@ public String getAccessor();
 
 public String getExclude();
 
+public String getResource();
+
+public String getResourceSize();
+
 public void setAccessor(String str);
 
 public void setExclude(String str);
+
+public void setResource(String str);
+
+public void setResourceSize(String str);
 }
@@ -15,6 +15,11 @@ import java.util.regex.Matcher;
 import java.util.regex.Pattern;
 
 public class LockGenerator extends CleanupClass {
+
+	static final String LOCK_LIBRARY = "library";
+	static final String LOCK_READ = "read";
+	static final String LOCK_OBJECT = "object";
+	static final String LOCK_NONE = "none";
 	
 public LockGenerator() {
 }
@@ -72,9 +77,34 @@ public void generate(JNIMethod[] methods) {
 	}
 }
 
+/*
+* Answers the lock class of a synchronized native, from the "lock" meta data
+* of the method or else of its class:
+*   library - the lock of the library, held exclusively (the default)
+*   read    - the lock of the library, shared with the other readers
+*   object  - the lock of the object passed as the first argument
+*   none    - no lock, the function is thread safe
+* A read lock must not be taken by a native that can call back into Java,
+* and an object lock needs a handle as the first argument.
+*/
+String getLockClass(JNIMethod method) {
+	String lockClass = (String)method.getParam("lock");
+	if (lockClass.length() == 0) lockClass = (String)method.getDeclaringClass().getParam("lock");
+	if (lockClass.equals(LOCK_OBJECT)) {
+		JNIParameter[] params = method.getParameters();
+		if (params.length == 0 || !(params[0].getType64().isType("long") || params[0].getType().isType("long"))) {
+			return LOCK_LIBRARY;
+		}
+	}
+	if (lockClass.equals(LOCK_READ) || lockClass.equals(LOCK_OBJECT) || lockClass.equals(LOCK_NONE)) return lockClass;
+	return LOCK_LIBRARY;
+}
+
 public void generate(JNIMethod method) {
 	int modifiers = method.getModifiers();
 	boolean lock = (modifiers & Modifier.SYNCHRONIZED) != 0;
+	String lockClass = lock ? getLockClass(method) : LOCK_NONE;
+	if (lockClass.equals(LOCK_NONE)) lock = false;
 	String returnStr = getReturn(method);
 	String paramsStr = getParams(method);
 	if (lock) {
@@ -99,7 +129,14 @@ public void generate(JNIMethod method) {
 	output(")");
 	if (lock) {
 		outputln(" {");
-		outputln("\tlock.lock();");
+		String[] paramNames = getArgNames(method);
+		boolean read = lockClass.equals(LOCK_READ);
+		if (lockClass.equals(LOCK_OBJECT)) {
+			output("\tLock lock = Lock.forObject(");
+			output(paramNames[0]);
+			outputln(");");
+		}
+		outputln(read ? "\tlock.lockRead();" : "\tlock.lock();");
 		outputln("\ttry {");
 		output("\t\t");
 		if (!method.getReturnType().isType("void")) {
@@ -108,14 +145,13 @@ public void generate(JNIMethod method) {
 		output("_");
 		output(method.getName());
 		output("(");
-		String[] paramNames = getArgNames(method);
 		for (int i = 0; i < paramNames.length; i++) {
 			if (i != 0) output(", ");
 			output(paramNames[i]);
 		}
 		outputln(");");
 		outputln("\t} finally {");
-		outputln("\t\tlock.unlock();");
+		outputln(read ? "\t\tlock.unlockRead();" : "\t\tlock.unlock();");
 		outputln("\t}");
 		outputln("}");
 	} else {
@@ -68,6 +68,14 @@ public void generate(JNIClass clazz) {
 	generate(methods);
 }
 
+@Override
+public void generate() {
+	super.generate();
+	if (getClasses() == null) return;
+	generateRegistration(getClasses());
+	getOutput().flush();
+}
+
 public void generate(JNIMethod[] methods) {
 	sort(methods);	
 	for (int i = 0; i < methods.length; i++) {
@@ -211,6 +219,7 @@ public void generate(JNIMethod method) {
 		outputln("#endif");
 	}
 	generateFunctionBody(method, function, function64, params, returnType, returnType64);
+	if (isLeaf(method)) generateCriticalFunction(method, function, function64, params, returnType, returnType64);
 	generateSourceEnd(function);
 	outputln();
 }
@@ -245,6 +254,96 @@ void generateExcludes(JNIMethod[] methods) {
 	}
 }
 
+/*
+* Emits the tables of the generated natives of the classes that JNI_OnLoad
+* in swt.c registers with RegisterNatives, so that the VM does not look each
+* native up by its mangled name on its first call.  The array of the tables
+* is named after the main class, which is how swt.c finds it.  The natives
+* are declared SWT_NATIVE_EXPORT, which only stops exporting them by name
+* in a library built with SWT_HIDE_NATIVES.
+*/
+void generateRegistration(JNIClass[] classes) {
+	boolean isCPP = getCPP();
+	outputln("#ifndef NO_REGISTER_NATIVES");
+	for (int i = 0; i < classes.length; i++) {
+		JNIClass clazz = classes[i];
+		if (!getGenerate(clazz) || !hasNatives(clazz)) continue;
+		JNIMethod[] methods = clazz.getDeclaredMethods();
+		sort(methods);
+		String className = clazz.getSimpleName();
+		output("static JNINativeMethod ");
+		output(className);
+		outputln("_nativeMethods[] = {");
+		for (int j = 0; j < methods.length; j++) {
+			JNIMethod method = methods[j];
+			if ((method.getModifiers() & Modifier.NATIVE) == 0) continue;
+			if (method.getFlag(FLAG_NO_GEN)) continue;
+			String function = getFunctionName(method), function64 = getFunctionName(method, method.getParameterTypes64());
+			generateSourceStart(function, function64);
+			if (function.equals(function64) && getSignature(method.getParameterTypes(), method.getReturnType()).equals(getSignature(method.getParameterTypes64(), method.getReturnType64()))) {
+				generateRegistrationEntry(className, method, function, method.getParameterTypes(), method.getReturnType());
+			} else {
+				output("#ifndef ");
+				outputln(JNI64);
+				generateRegistrationEntry(className, method, function, method.getParameterTypes(), method.getReturnType());
+				outputln("#else");
+				generateRegistrationEntry(className, method, function64, method.getParameterTypes64(), method.getReturnType64());
+				outputln("#endif");
+			}
+			generateSourceEnd(function);
+		}
+		outputln("\t{NULL, NULL, NULL}");
+		outputln("};");
+	}
+	if (isCPP) output("extern \"C\" ");
+	output("JNIEXPORT SWT_NATIVE_CLASS ");
+	output(getMainClass().getSimpleName());
+	outputln("_nativeClasses[] = {");
+	for (int i = 0; i < classes.length; i++) {
+		JNIClass clazz = classes[i];
+		if (!getGenerate(clazz) || !hasNatives(clazz)) continue;
+		output("\t{\"");
+		output(clazz.getName().replace('.', '/'));
+		output("\", ");
+		output(clazz.getSimpleName());
+		outputln("_nativeMethods},");
+	}
+	outputln("\t{NULL, NULL}");
+	outputln("};");
+	outputln("#endif");
+}
+
+void generateRegistrationEntry(String className, JNIMethod method, String function, JNIType[] paramTypes, JNIType returnType) {
+	output("\t{(char *)\"");
+	output(method.getName());
+	output("\", (char *)\"");
+	output(getSignature(paramTypes, returnType));
+	output("\", (void *)");
+	output(className);
+	output("_NATIVE(");
+	output(function);
+	outputln(")},");
+}
+
+String getSignature(JNIType[] paramTypes, JNIType returnType) {
+	StringBuffer buffer = new StringBuffer();
+	buffer.append("(");
+	for (int i = 0; i < paramTypes.length; i++) {
+		buffer.append(paramTypes[i].getTypeSignature(false));
+	}
+	buffer.append(")");
+	buffer.append(returnType.getTypeSignature(false));
+	return buffer.toString();
+}
+
+boolean hasNatives(JNIClass clazz) {
+	JNIMethod[] methods = clazz.getDeclaredMethods();
+	for (int i = 0; i < methods.length; i++) {
+		if ((methods[i].getModifiers() & Modifier.NATIVE) != 0) return true;
+	}
+	return false;
+}
+
 void generateNativeMacro(JNIClass clazz) {
 	output("#ifndef ");
 	output(clazz.getSimpleName());
@@ -256,6 +355,28 @@ void generateNativeMacro(JNIClass clazz) {
 	outputln("_##func");
 	outputln("#endif");
 	outputln();
+	if (hasLeafNatives(clazz)) {
+		output("#ifndef ");
+		output(clazz.getSimpleName());
+		outputln("_CRITICAL");
+		output("#define ");
+		output(clazz.getSimpleName());
+		output("_CRITICAL(func) JavaCritical_");
+		output(toC(clazz.getName()));
+		outputln("_##func");
+		outputln("#endif");
+		outputln();
+	}
+}
+
+boolean hasLeafNatives(JNIClass clazz) {
+	JNIMethod[] methods = clazz.getDeclaredMethods();
+	for (int i = 0; i < methods.length; i++) {
+		JNIMethod method = methods[i];
+		if ((method.getModifiers() & Modifier.NATIVE) == 0) continue;
+		if (!method.getFlag(FLAG_NO_GEN) && isLeaf(method)) return true;
+	}
+	return false;
 }
 
 boolean generateGetParameter(JNIMethod method, JNIParameter param, boolean critical, int indent) {
@@ -301,6 +422,14 @@ boolean generateGetParameter(JNIMethod method, JNIParameter param, boolean criti
 		} else {
 			throw new Error("not done");
 		}
+	} else if (isDirectBuffer(paramType)) {
+		if (isCPP) {
+			output("env->GetDirectBufferAddress(arg");
+		} else {
+			output("(*env)->GetDirectBufferAddress(env, arg");
+		}
+		output(iStr);
+		output(")");
 	} else if (paramType.isType("java.lang.String")) {
 		if (param.getFlag(FLAG_UNICODE)) {
 			if (isCPP) {
@@ -339,7 +468,7 @@ boolean generateGetParameter(JNIMethod method, JNIParameter param, boolean criti
 
 void generateSetParameter(JNIParameter param, boolean critical) {
 	JNIType paramType = param.getType(), paramType64 = param.getType64();
-	if (paramType.isPrimitive() || isSystemClass(paramType)) return;
+	if (paramType.isPrimitive() || isSystemClass(paramType) || isDirectBuffer(paramType)) return;
 	String iStr = String.valueOf(param.getParameter());
 	boolean isCPP = getCPP();
 	if (paramType.isArray()) {
@@ -374,7 +503,7 @@ void generateSetParameter(JNIParameter param, boolean critical) {
 			output(", lparg");
 			output(iStr);
 			output(", ");
-			if (param.getFlag(FLAG_NO_OUT)) {
+			if (isNoOut(param)) {
 				output("JNI_ABORT");
 			} else {				
 				output("0");
@@ -408,7 +537,7 @@ void generateSetParameter(JNIParameter param, boolean critical) {
 		output(iStr);
 		outputln(");");
 	} else {
-		if (!param.getFlag(FLAG_NO_OUT)) {
+		if (!isNoOut(param)) {
 			output("\tif (arg");
 			output(iStr);
 			output(" && lparg");
@@ -425,6 +554,29 @@ void generateSetParameter(JNIParameter param, boolean critical) {
 	}
 }
 
+/*
+* Natives that create a native resource are tracked once the arrays are
+* released, so that the tracking does not call into JNI in a critical region.
+* The destroyed handle is forgotten before the call, as it may be reused as
+* soon as the call returns.
+*/
+void generateResourceMacro(JNIMethod method, boolean needsReturn, boolean create) {
+	if (!enterExitMacro) return;
+	if (create) {
+		String resource = method.getResource();
+		if (resource.length() == 0 || !needsReturn) return;
+		String size = method.getResourceSize();
+		output("\tNATIVE_RESOURCE_CREATE(env, \"");
+		output(resource);
+		output("\", rc, ");
+		output(size.length() != 0 ? size : "0");
+		outputln(");");
+	} else {
+		if (!method.getFlag(FLAG_DESTROY) || method.getParameters().length == 0) return;
+		outputln("\tNATIVE_RESOURCE_DESTROY(env, arg0);");
+	}
+}
+
 void generateEnterExitMacro(JNIMethod method, String function, String function64, boolean enter) {
 	if (!enterExitMacro) return;
 	boolean tryCatch = method.getFlag(FLAG_TRYCATCH);
@@ -471,6 +623,9 @@ boolean generateLocalVars(JNIMethod method, JNIParameter[] params, JNIType retur
 			} else {
 				throw new Error("not done");
 			}
+		} else if (isDirectBuffer(paramType)) {
+			output("void *lparg" + i);
+			output("=NULL;");
 		} else if (paramType.isType("java.lang.String")) {
 			if (param.getFlag(FLAG_UNICODE)) {
 				output("const jchar *lparg" + i);				
@@ -506,7 +661,7 @@ boolean generateGetters(JNIMethod method, JNIParameter[] params) {
 	int criticalCount = 0;
 	for (int i = 0; i < params.length; i++) {
 		JNIParameter param = params[i];
-		if (!isCritical(param)) {
+		if (!isCritical(method, param)) {
 			genFailTag |= generateGetParameter(method, param, false, 1);
 		} else {
 			criticalCount++;
@@ -517,7 +672,7 @@ boolean generateGetters(JNIMethod method, JNIParameter[] params) {
 		outputln("\tif (IS_JNI_1_2) {");
 		for (int i = 0; i < params.length; i++) {
 			JNIParameter param = params[i];
-			if (isCritical(param)) {
+			if (isCritical(method, param)) {
 				genFailTag |= generateGetParameter(method, param, true, 2);
 			}
 		}
@@ -526,7 +681,7 @@ boolean generateGetters(JNIMethod method, JNIParameter[] params) {
 		outputln("\t{");
 		for (int i = 0; i < params.length; i++) {
 			JNIParameter param = params[i];
-			if (isCritical(param)) {
+			if (isCritical(method, param)) {
 				genFailTag |= generateGetParameter(method, param, false, 2);
 			}
 		}
@@ -539,7 +694,7 @@ void generateSetters(JNIMethod method, JNIParameter[] params) {
 	int criticalCount = 0;
 	for (int i = params.length - 1; i >= 0; i--) {
 		JNIParameter param = params[i];
-		if (isCritical(param)) {
+		if (isCritical(method, param)) {
 			criticalCount++;
 		}
 	}
@@ -548,7 +703,7 @@ void generateSetters(JNIMethod method, JNIParameter[] params) {
 		outputln("\tif (IS_JNI_1_2) {");
 		for (int i = params.length - 1; i >= 0; i--) {
 			JNIParameter param = params[i];
-			if (isCritical(param)) {
+			if (isCritical(method, param)) {
 				output("\t");
 				generateSetParameter(param, true);
 			}
@@ -558,7 +713,7 @@ void generateSetters(JNIMethod method, JNIParameter[] params) {
 		outputln("\t{");
 		for (int i = params.length - 1; i >= 0; i--) {
 			JNIParameter param = params[i];
-			if (isCritical(param)) {
+			if (isCritical(method, param)) {
 				output("\t");
 				generateSetParameter(param, false);
 			}
@@ -567,7 +722,7 @@ void generateSetters(JNIMethod method, JNIParameter[] params) {
 	}
 	for (int i = params.length - 1; i >= 0; i--) {
 		JNIParameter param = params[i];
-		if (!isCritical(param)) {
+		if (!isCritical(method, param)) {
 			generateSetParameter(param, false);
 		}
 	}
@@ -723,16 +878,22 @@ void generateFunctionCall(JNIMethod method, JNIParameter[] params, JNIType retur
 		output("(");
 		JNIParameter param = params[0];
 		if (param.getFlag(FLAG_STRUCT)) output("*");
-		String cast = param.getCast(); 
-		if (cast.length() != 0 && !cast.equals("()")) {
-			output(cast);
-		}
-		if (param.getFlag(FLAG_OBJECT)) {
-			output("TO_OBJECT(");
-		}
-		output("arg0");
-		if (param.getFlag(FLAG_OBJECT)) {
-			output(")");
+		String cast = param.getCast();
+		if (param.getFlag(FLAG_OBJECT) && cast.endsWith("^)")) {
+			output("TO_OBJECT_AS(");
+			output(cast.substring(1, cast.length() - 1));
+			output(", arg0)");
+		} else {
+			if (cast.length() != 0 && !cast.equals("()")) {
+				output(cast);
+			}
+			if (param.getFlag(FLAG_OBJECT)) {
+				output("TO_OBJECT(");
+			}
+			output("arg0");
+			if (param.getFlag(FLAG_OBJECT)) {
+				output(")");
+			}
 		}
 		output(")->");
 		String accessor = method.getAccessor();
@@ -811,12 +972,16 @@ void generateFunctionCall(JNIMethod method, JNIParameter[] params, JNIType retur
 					output(cast);
 				} else {
 					JNIType paramType = param.getType(), paramType64 = param.getType64();
-					if (!(paramType.isPrimitive() || paramType.isArray())) {
-						if (param.getTypeClass().getFlag(FLAG_STRUCT)) {
-							output("struct ");
+					if (isDirectBuffer(paramType)) {
+						output("void *");
+					} else {
+						if (!(paramType.isPrimitive() || paramType.isArray())) {
+							if (param.getTypeClass().getFlag(FLAG_STRUCT)) {
+								output("struct ");
+							}
 						}
+						output(paramType.getTypeSignature4(!paramType.equals(paramType64), param.getFlag(FLAG_STRUCT)));
 					}
-					output(paramType.getTypeSignature4(!paramType.equals(paramType64), param.getFlag(FLAG_STRUCT)));
 				}
 			}
 			output("))");
@@ -873,6 +1038,128 @@ void generateFunctionCall(JNIMethod method, JNIParameter[] params, JNIType retur
 	}
 }
 
+/*
+* Answers the sizes of all the structs that have a *_sizeof native in the
+* class in one call.  The sizes are copied into the int[] argument and the
+* names of the structs, separated by commas, are returned in the same order.
+*/
+void generateSizeofs(JNIMethod method, String function, String function64) {
+	boolean isCPP = getCPP();
+	JNIMethod[] methods = method.getDeclaringClass().getDeclaredMethods();
+	sort(methods);
+	ArrayList<JNIMethod> sizeofs = new ArrayList<JNIMethod>();
+	for (int i = 0; i < methods.length; i++) {
+		JNIMethod sizeof = methods[i];
+		if ((sizeof.getModifiers() & Modifier.NATIVE) == 0) continue;
+		if (sizeof.getFlag(FLAG_NO_GEN) || sizeof.getParameters().length != 0) continue;
+		if (!sizeof.getName().endsWith("_sizeof")) continue;
+		sizeofs.add(sizeof);
+	}
+	outputln("\tstatic const char *names =");
+	for (JNIMethod sizeof : sizeofs) {
+		String name = sizeof.getName();
+		output("#ifndef NO_");
+		outputln(getFunctionName(sizeof));
+		output("\t\t\"");
+		output(name.substring(0, name.length() - "_sizeof".length()));
+		outputln(",\"");
+		outputln("#endif");
+	}
+	outputln("\t\t\"\";");
+	outputln("\tjint sizes[] = {");
+	for (JNIMethod sizeof : sizeofs) {
+		output("#ifndef NO_");
+		outputln(getFunctionName(sizeof));
+		output("\t\t(jint)");
+		output(sizeof.getName());
+		outputln("(),");
+		outputln("#endif");
+	}
+	outputln("\t\t0");
+	outputln("\t};");
+	outputln("\tjint count = (jint)(sizeof(sizes) / sizeof(sizes[0])) - 1;");
+	outputln("\tjstring rc = NULL;");
+	generateEnterExitMacro(method, function, function64, true);
+	if (isCPP) {
+		outputln("\tif (arg0 && env->GetArrayLength(arg0) >= count) env->SetIntArrayRegion(arg0, 0, count, sizes);");
+		outputln("\trc = env->NewStringUTF(names);");
+	} else {
+		outputln("\tif (arg0 && (*env)->GetArrayLength(env, arg0) >= count) (*env)->SetIntArrayRegion(env, arg0, 0, count, sizes);");
+		outputln("\trc = (*env)->NewStringUTF(env, names);");
+	}
+	generateEnterExitMacro(method, function, function64, false);
+	outputln("\treturn rc;");
+}
+
+/*
+* A batch native calls the function named like the method without the
+* "_batch" suffix once per array element.  Array parameters supply one
+* argument per call and all other parameters are passed unchanged to every
+* call.  When the last parameter is an array flagged no_in, it receives the
+* results instead.  The number of calls is the length of the shortest array.
+*/
+void generateBatchFunctionCall(JNIMethod method, JNIParameter[] params) {
+	String name = method.getName();
+	if (name.startsWith("_")) name = name.substring(1);
+	if (name.endsWith("_batch")) name = name.substring(0, name.length() - "_batch".length());
+	int result = -1;
+	if (params.length > 0) {
+		JNIParameter param = params[params.length - 1];
+		if (param.getType().isArray() && param.getFlag(FLAG_NO_IN)) result = params.length - 1;
+	}
+	boolean isCPP = getCPP();
+	int first = -1;
+	output("\tif (");
+	for (int i = 0; i < params.length; i++) {
+		if (!params[i].getType().isArray()) continue;
+		if (first != -1) output(" && ");
+		output("lparg" + i);
+		if (first == -1) first = i;
+	}
+	if (first == -1) throw new Error("batch method without array parameters: " + method);
+	outputln(") {");
+	output("\t\tjint i, count = ");
+	output(isCPP ? "env->GetArrayLength(arg" : "(*env)->GetArrayLength(env, arg");
+	output(first + ");");
+	outputln();
+	for (int i = first + 1; i < params.length; i++) {
+		if (!params[i].getType().isArray()) continue;
+		String length = (isCPP ? "env->GetArrayLength(arg" : "(*env)->GetArrayLength(env, arg") + i + ")";
+		output("\t\tif (count > ");
+		output(length);
+		output(") count = ");
+		output(length);
+		outputln(";");
+	}
+	outputln("\t\tfor (i = 0; i < count; i++) {");
+	output("\t\t\t");
+	if (result != -1) {
+		JNIType paramType = params[result].getType(), paramType64 = params[result].getType64();
+		output("lparg" + result + "[i] = (");
+		output(paramType.getComponentType().getTypeSignature2(!paramType.equals(paramType64)));
+		output(")");
+	}
+	output(name);
+	output("(");
+	for (int i = 0; i < params.length; i++) {
+		if (i == result) continue;
+		JNIParameter param = params[i];
+		JNIType paramType = param.getType();
+		if (i != 0) output(", ");
+		if (param.getFlag(FLAG_STRUCT)) output("*");
+		output(param.getCast());
+		if (paramType.isArray()) {
+			output("lparg" + i + "[i]");
+		} else {
+			if (!paramType.isPrimitive() && !isSystemClass(paramType)) output("lp");
+			output("arg" + i);
+		}
+	}
+	outputln(");");
+	outputln("\t\t}");
+	outputln("\t}");
+}
+
 void generate_objc_msgSend_stret (JNIMethod method, JNIParameter[] params, String func) {
 	output("\t\t*lparg0 = (*(");
 	JNIType paramType = params[0].getType(), paramType64 = params[0].getType64();
@@ -888,12 +1175,16 @@ void generate_objc_msgSend_stret (JNIMethod method, JNIParameter[] params, Strin
 			output(cast);
 		} else {
 			paramType = param.getType(); paramType64 = param.getType64();
-			if (!(paramType.isPrimitive() || paramType.isArray())) {
-				if (param.getTypeClass().getFlag(FLAG_STRUCT)) {
-					output("struct ");
+			if (isDirectBuffer(paramType)) {
+				output("void *");
+			} else {
+				if (!(paramType.isPrimitive() || paramType.isArray())) {
+					if (param.getTypeClass().getFlag(FLAG_STRUCT)) {
+						output("struct ");
+					}
 				}
+				output(paramType.getTypeSignature4(!paramType.equals(paramType64), param.getFlag(FLAG_STRUCT)));
 			}
-			output(paramType.getTypeSignature4(!paramType.equals(paramType64), param.getFlag(FLAG_STRUCT)));
 		}
 	}
 	output("))");
@@ -930,17 +1221,23 @@ void generateFunctionBody(JNIMethod method, String function, String function64,
 	boolean isMemove = (name.equals("memmove") || name.equals("MoveMemory")) && params.length == 2 && returnType.isType("void");
 	if (isMemove) {
 		generateMemmove(method, function, function64, params);
+	} else if (method.getFlag(FLAG_SIZEOF)) {
+		generateSizeofs(method, function, function64);
 	} else {
 		boolean needsReturn = generateLocalVars(method, params, returnType, returnType64);
 		generateEnterExitMacro(method, function, function64, true);
+		generateResourceMacro(method, needsReturn, false);
 		boolean genFailTag = generateGetters(method, params);
-		if (method.getFlag(FLAG_DYNAMIC)) {
+		if (method.getFlag(FLAG_BATCH)) {
+			generateBatchFunctionCall(method, params);
+		} else if (method.getFlag(FLAG_DYNAMIC)) {
 			generateDynamicFunctionCall(method, params, returnType, returnType64, needsReturn);
 		} else {
 			generateFunctionCall(method, params, returnType, returnType64, needsReturn);
 		}
 		if (genFailTag) outputln("fail:");
 		generateSetters(method, params);
+		generateResourceMacro(method, needsReturn, true);
 		generateEnterExitMacro(method, function, function64, false);
 		generateReturn(method, returnType, needsReturn);
 	}
@@ -948,11 +1245,55 @@ void generateFunctionBody(JNIMethod method, String function, String function64,
 	outputln("}");
 }
 
-void generateFunctionPrototype(JNIMethod method, String function, JNIParameter[] params, JNIType returnType, JNIType returnType64, boolean singleLine) {
+/*
+* A leaf native also gets a JavaCritical_ entry point, which HotSpot calls
+* instead of the JNI one once the caller is compiled.  It is passed neither
+* the JNIEnv nor the class, makes no JNI transition and skips the enter and
+* exit macros.  Other VMs keep calling the JNI entry point.
+*/
+void generateCriticalFunction(JNIMethod method, String function, String function64, JNIParameter[] params, JNIType returnType, JNIType returnType64) {
+	boolean sameFunction = function.equals(function64);
+	outputln();
+	if (!sameFunction) {
+		output("#ifndef ");
+		outputln(JNI64);
+	}
+	generateCriticalPrototype(method, function, params, returnType, returnType64);
+	if (!sameFunction) {
+		outputln("#else");
+		generateCriticalPrototype(method, function64, params, returnType, returnType64);
+		outputln("#endif");
+	}
+	outputln("{");
+	generateFunctionCall(method, params, returnType, returnType64, false);
+	outputln("}");
+}
+
+void generateCriticalPrototype(JNIMethod method, String function, JNIParameter[] params, JNIType returnType, JNIType returnType64) {
+	if (getCPP()) output("extern \"C\" ");
 	output("JNIEXPORT ");
 	output(returnType.getTypeSignature2(!returnType.equals(returnType64)));
 	output(" JNICALL ");
 	output(method.getDeclaringClass().getSimpleName());
+	output("_CRITICAL(");
+	output(function);
+	outputln(")");
+	output("\t(");
+	if (params.length == 0) output("void");
+	for (int i = 0; i < params.length; i++) {
+		if (i != 0) output(", ");
+		JNIType paramType = params[i].getType(), paramType64 = params[i].getType64();
+		output(paramType.getTypeSignature2(!paramType.equals(paramType64)));
+		output(" arg" + i);
+	}
+	outputln(")");
+}
+
+void generateFunctionPrototype(JNIMethod method, String function, JNIParameter[] params, JNIType returnType, JNIType returnType64, boolean singleLine) {
+	output("SWT_NATIVE_EXPORT ");
+	output(returnType.getTypeSignature2(!returnType.equals(returnType64)));
+	output(" JNICALL ");
+	output(method.getDeclaringClass().getSimpleName());
 	output("_NATIVE(");
 	output(function);
 	if (singleLine) {
@@ -999,13 +1340,72 @@ void generateSourceEnd(String function) {
 	outputln("#endif");
 }
 
-boolean isCritical(JNIParameter param) {
+/*
+* The leaf flag is only honored on static natives that take and return
+* primitives and call a plain function, since a critical entry point has no
+* JNIEnv to convert objects, throw or call back with.
+*/
+boolean isLeaf(JNIMethod method) {
+	if (!method.getFlag(FLAG_LEAF)) return false;
+	if ((method.getModifiers() & Modifier.STATIC) == 0) return false;
+	String[] flags = {FLAG_JNI, FLAG_DYNAMIC, FLAG_BATCH, FLAG_SIZEOF, FLAG_CPP, FLAG_NEW, FLAG_DELETE, FLAG_GCNEW, FLAG_OBJECT, FLAG_SETTER, FLAG_GETTER, FLAG_ADDER};
+	for (int i = 0; i < flags.length; i++) {
+		if (method.getFlag(flags[i])) return false;
+	}
+	JNIType returnType = method.getReturnType();
+	if (!(returnType.isType("void") || returnType.isPrimitive())) return false;
+	JNIParameter[] params = method.getParameters();
+	for (int i = 0; i < params.length; i++) {
+		JNIParameter param = params[i];
+		if (!param.getType().isPrimitive() || param.getFlag(FLAG_STRUCT) || param.getFlag(FLAG_OBJECT)) return false;
+	}
+	return ((String)method.getParam("copy")).length() == 0;
+}
+
+boolean isCritical(JNIMethod method, JNIParameter param) {
 	JNIType paramType = param.getType();
-	return paramType.isArray() && paramType.getComponentType().isPrimitive() && param.getFlag(FLAG_CRITICAL);
+	return paramType.isArray() && paramType.getComponentType().isPrimitive() && param.getFlag(FLAG_CRITICAL) && isCriticalSafe(method);
+}
+
+/*
+* No JNI function may be called and no managed object may be allocated
+* while an array is pinned, so the critical flag is ignored on natives
+* that call back into JNI or allocate with gcnew.
+*/
+boolean isCriticalSafe(JNIMethod method) {
+	return !(method.getFlag(FLAG_JNI) || method.getFlag(FLAG_GCNEW));
+}
+
+/*
+* A parameter is not copied back when it is flagged no_out, or when it is
+* cast to a pointer to const data, such as (const PointF *) or (LPCRECT).
+* A pointer to const pointers, such as (const char **), is still copied back.
+*/
+boolean isNoOut(JNIParameter param) {
+	if (param.getFlag(FLAG_NO_OUT)) return true;
+	String cast = param.getCast();
+	if (cast == null || cast.length() == 0) return false;
+	cast = cast.substring(1, cast.length() - 1).trim();
+	int pointers = 0;
+	for (int i = 0; i < cast.length(); i++) {
+		if (cast.charAt(i) == '*') pointers++;
+	}
+	if (cast.startsWith("const ") || cast.startsWith("CONST ")) return pointers == 1;
+	return pointers == 0 && cast.length() > 3 && cast.startsWith("LPC") && Character.isUpperCase(cast.charAt(3));
 }
 
 boolean isSystemClass(JNIType type) {
 	return type.isType("java.lang.Object") || type.isType("java.lang.Class") ;
 }
 
+/*
+* A direct buffer parameter is passed to the native as the address of its
+* contents. It holds the native struct laid out by Java, so nothing is copied
+* in or out, and the call fails if the buffer is not direct.
+*/
+boolean isDirectBuffer(JNIType type) {
+	String name = type.getName();
+	return name.startsWith("java.nio.") && name.endsWith("Buffer");
+}
+
 }
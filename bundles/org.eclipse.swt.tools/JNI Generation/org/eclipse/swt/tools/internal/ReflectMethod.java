@@ -175,6 +175,14 @@ public String getExclude() {
 	return (String)getParam("exclude");
 }
 
+public String getResource() {
+	return (String)getParam("resource");
+}
+
+public String getResourceSize() {
+	return (String)getParam("size");
+}
+
 @Override
 public String getMetaData() {
 	String className = getDeclaringClass().getSimpleName();
@@ -225,6 +233,14 @@ public void setExclude(String str) {
 	setParam("exclude", str);
 }
 
+public void setResource(String str) { 
+	setParam("resource", str);
+}
+
+public void setResourceSize(String str) { 
+	setParam("size", str);
+}
+
 @Override
 public void setMetaData(String value) {
 	String key;
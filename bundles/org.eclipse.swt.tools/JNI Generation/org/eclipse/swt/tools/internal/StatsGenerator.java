@@ -74,14 +74,19 @@ void generateNATIVEMacros(JNIClass clazz) {
 	output("extern char* ");
 	output(className);
 	outputln("_nativeFunctionNames[];");
+	output("extern NATIVE_STATS_CLASS ");
+	output(className);
+	outputln("_nativeStats;");
 	output("#define ");
 	output(className);
-	output("_NATIVE_ENTER(env, that, func) ");
+	output("_NATIVE_ENTER(env, that, func) nativeStatsEnter(&");
 	output(className);
-	outputln("_nativeFunctionCallCount[func]++;");
+	outputln("_nativeStats, func);");
 	output("#define ");
 	output(className);
-	outputln("_NATIVE_EXIT(env, that, func) ");
+	output("_NATIVE_EXIT(env, that, func) nativeStatsExit(&");
+	output(className);
+	outputln("_nativeStats, func);");
 	outputln("#else");
 	output("#ifndef ");
 	output(className);
@@ -141,6 +146,25 @@ void generateSourceFile(JNIClass clazz) {
 	output("int ");
 	output(className);
 	outputln("_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];");
+	output("jlong ");
+	output(className);
+	outputln("_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];");
+	output("NATIVE_STATS_EVENT ");
+	output(className);
+	outputln("_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];");
+	output("NATIVE_STATS_CLASS ");
+	output(className);
+	output("_nativeStats = {");
+	output(className);
+	output("_nativeFunctionCallCount, ");
+	output(className);
+	output("_nativeFunctionCallTime, ");
+	output(className);
+	output("_nativeFunctionEvents, 0, \"");
+	output(className);
+	output("\", ");
+	output(className);
+	outputln("_nativeFunctionNames};");
 	outputln();
 	generateStatsNatives(className);
 	outputln();
@@ -188,6 +212,85 @@ void generateStatsNatives(String className) {
 	output(className);
 	outputln("_nativeFunctionCallCount[index];");
 	outputln("}");
+	outputln();
+
+	output("JNIEXPORT jlong JNICALL STATS_NATIVE(");
+	output(toC(className + "_GetFunctionCallTime"));
+	outputln(")");
+	outputln("\t(JNIEnv *env, jclass that, jint index)");
+	outputln("{");
+	output("\treturn ");
+	output(className);
+	outputln("_nativeFunctionCallTime[index];");
+	outputln("}");
+	outputln();
+
+	output("JNIEXPORT void JNICALL STATS_NATIVE(");
+	output(toC(className + "_SetTracing"));
+	outputln(")");
+	outputln("\t(JNIEnv *env, jclass that, jboolean enabled)");
+	outputln("{");
+	outputln("\tnativeStatsTracing = enabled;");
+	outputln("}");
+	outputln();
+
+	output("JNIEXPORT jint JNICALL STATS_NATIVE(");
+	output(toC(className + "_GetEvents"));
+	outputln(")");
+	outputln("\t(JNIEnv *env, jclass that, jlongArray buffer)");
+	outputln("{");
+	output("\treturn nativeStatsGetEvents(env, &");
+	output(className);
+	outputln("_nativeStats, buffer);");
+	outputln("}");
+	outputln();
+
+	output("JNIEXPORT jint JNICALL STATS_NATIVE(");
+	output(toC(className + "_GetLoads"));
+	outputln(")");
+	outputln("\t(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)");
+	outputln("{");
+	outputln("\treturn nativeStatsGetLoads(env, names, values);");
+	outputln("}");
+	outputln();
+
+	output("JNIEXPORT void JNICALL STATS_NATIVE(");
+	output(toC(className + "_SetResourceStacks"));
+	outputln(")");
+	outputln("\t(JNIEnv *env, jclass that, jboolean enabled)");
+	outputln("{");
+	outputln("\tnativeStatsResourceStacks = enabled;");
+	outputln("}");
+	outputln();
+
+	output("JNIEXPORT jint JNICALL STATS_NATIVE(");
+	output(toC(className + "_GetResources"));
+	outputln(")");
+	outputln("\t(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)");
+	outputln("{");
+	outputln("\treturn nativeStatsGetResources(env, names, values);");
+	outputln("}");
+	outputln();
+
+	output("JNIEXPORT jint JNICALL STATS_NATIVE(");
+	output(toC(className + "_GetLiveResources"));
+	outputln(")");
+	outputln("\t(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)");
+	outputln("{");
+	outputln("\treturn nativeStatsGetLiveResources(env, objects, values);");
+	outputln("}");
+	outputln();
+
+	outputln("#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func");
+	outputln();
+
+	output("JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(");
+	output(toC(className + "_Watch"));
+	outputln(")");
+	outputln("\t(JNIEnv *env, jclass that)");
+	outputln("{");
+	outputln("\treturn nativeStatsWatch();");
+	outputln("}");
 }
 
 void generateFunctionEnum(JNIMethod[] methods) {
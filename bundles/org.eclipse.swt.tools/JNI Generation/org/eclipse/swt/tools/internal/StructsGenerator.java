@@ -67,6 +67,8 @@ public void generate(JNIClass clazz) {
 public void generate() {
 	if (!header && getClasses().length == 0) return;
 	super.generate();
+	generatePreloadFunction();
+	getOutput().flush();
 }
 
 @Override
@@ -104,6 +106,59 @@ void generateExcludes(JNIClass[] classes) {
 	}
 }
 
+boolean isPreload(JNIClass clazz) {
+	JNIClass[] classes = getClasses();
+	for (int i = 0; i < classes.length; i++) {
+		JNIClass preload = classes[i];
+		if (!preload.getFlag(Flags.FLAG_PRELOAD)) continue;
+		while (!preload.getName().equals("java.lang.Object")) {
+			if (preload.getName().equals(clazz.getName())) return true;
+			preload = preload.getSuperclass();
+		}
+	}
+	return false;
+}
+
+/* Emits cache<NAME>StructFields() which resolves the field IDs of the
+ * classes flagged "preload" up front, so that the first get/set of those
+ * structs does not pay for the lookups. Classes that fail to resolve are
+ * left uncached and fall back to the lazy path. */
+void generatePreloadFunction() {
+	JNIClass[] classes = getClasses();
+	boolean found = false;
+	for (int i = 0; i < classes.length; i++) {
+		JNIClass clazz = classes[i];
+		if (getGenerate(clazz) && clazz.getFlag(Flags.FLAG_PRELOAD)) found = true;
+	}
+	if (!found) return;
+	output("void cache");
+	output(getOutputName().toUpperCase());
+	output("StructFields(JNIEnv *env)");
+	if (header) {
+		outputln(";");
+		outputln();
+		return;
+	}
+	outputln();
+	outputln("{");
+	for (int i = 0; i < classes.length; i++) {
+		JNIClass clazz = classes[i];
+		if (!getGenerate(clazz) || !clazz.getFlag(Flags.FLAG_PRELOAD)) continue;
+		generateSourceStart(clazz);
+		output("\tcache");
+		output(clazz.getSimpleName());
+		outputln("Fields(env, NULL);");
+		generateSourceEnd(clazz);
+	}
+	if (getCPP()) {
+		outputln("\tenv->ExceptionClear();");
+	} else {
+		outputln("\t(*env)->ExceptionClear(env);");
+	}
+	outputln("}");
+	outputln();
+}
+
 void generateHeaderFile(JNIClass clazz) {
 	generateSourceStart(clazz);
 	generatePrototypes(clazz);
@@ -232,9 +287,14 @@ void generateCacheFunction(JNIClass clazz) {
 		output(superName);
 		outputln("Fields(env, lpObject);");
 	}
+	boolean isCPP = getCPP();
+	boolean preload = isPreload(clazz);
+	if (preload) {
+		outputln("\tif (lpObject != NULL) {");
+		output("\t");
+	}
 	output("\t");
 	output(clazzName);
-	boolean isCPP = getCPP();
 	if (isCPP) {
 		if (GLOBAL_REF) {
 			output("Fc.clazz = (jclass)env->NewGlobalRef(env->GetObjectClass(lpObject));");
@@ -249,6 +309,23 @@ void generateCacheFunction(JNIClass clazz) {
 		}
 	}
 	outputln();
+	if (preload) {
+		/* No instance to ask when called from the preload function */
+		outputln("\t} else {");
+		output("\t\t");
+		output(clazzName);
+		if (isCPP) {
+			output("Fc.clazz = env->FindClass(\"");
+		} else {
+			output("Fc.clazz = (*env)->FindClass(env, \"");
+		}
+		output(clazz.getName().replace('.', '/'));
+		outputln("\");");
+		output("\t\tif (");
+		output(clazzName);
+		outputln("Fc.clazz == NULL) return;");
+		outputln("\t}");
+	}
 	JNIField[] fields = clazz.getDeclaredFields();
 	for (int i = 0; i < fields.length; i++) {
 		JNIField field = fields[i];
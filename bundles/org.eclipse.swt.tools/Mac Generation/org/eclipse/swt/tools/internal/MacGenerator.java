@@ -1302,17 +1302,7 @@ void generateSelectorsConst() {
 		set.add("alloc");
 		set.add("dealloc");
 	}
-	for (Iterator<String> iterator = set.iterator(); iterator.hasNext();) {
-		String sel = iterator.next();
-		String selConst = getSelConst(sel);
-		out("public static final int /*long*/ ");
-		out(selConst);
-		out(" = ");
-		out("sel_registerName(\"");
-		out(sel);
-		out("\");");
-		outln();
-	}
+	generatePackedConsts(set, "SELECTORS", "sel_registerNames", false);
 }
 
 void generateStructNatives() {
@@ -1657,15 +1647,33 @@ void generateClassesConst() {
 			}
 		}
 	}
+	generatePackedConsts(set, "CLASSES", "objc_getClasses", true);
+}
+
+void generatePackedConsts(TreeSet<String> set, String array, String lookup, boolean classes) {
+	if (set.size() == 0) return;
+	out("static final int /*long*/ [] ");
+	out(array);
+	out(" = ");
+	out(lookup);
+	out("(");
+	outln();
+	for (Iterator<String> iterator = set.iterator(); iterator.hasNext();) {
+		out("\t\"");
+		out(iterator.next());
+		out(iterator.hasNext() ? "\\0\" +" : "\\0\");");
+		outln();
+	}
+	int index = 0;
 	for (Iterator<String> iterator = set.iterator(); iterator.hasNext();) {
-		String cls = iterator.next();
-		String clsConst = "class_" + cls;
+		String name = iterator.next();
 		out("public static final int /*long*/ ");
-		out(clsConst);
+		out(classes ? "class_" + name : getSelConst(name));
 		out(" = ");
-		out("objc_getClass(\"");
-		out(cls);
-		out("\");");
+		out(array);
+		out("[");
+		out(String.valueOf(index++));
+		out("];");
 		outln();
 	}
 }
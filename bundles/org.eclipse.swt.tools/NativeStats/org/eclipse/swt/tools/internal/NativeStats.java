@@ -31,31 +31,85 @@ import java.util.*;
  * the native calls done until that point.
  * 
  * 		new NativeStats().dumpSnapshot(System.out); 
+ * 
+ * 4) Or trace the native calls done in a section and dump them as a profile
+ * in the folded stack format read by flame graph tools (one line per call
+ * stack, followed by the time spent in its top frame in microseconds).
+ * 
+ * 		NativeStats stats = new NativeStats();
+ * 		stats.startTracing();
+ * 		...
+ * 		<code section>
+ * 		...
+ * 		stats.stopTracing();
+ * 		stats.dumpProfile(System.out);
+ * 
+ * Only the most recent calls of each class are traced (see NATIVE_STATS_EVENT_COUNT
+ * in swt.h).
+ * 
+ * 5) Or dump the dynamic functions resolved so far (see LOAD_FUNCTION in swt.h),
+ * per library, with the time spent opening the library and looking up each
+ * symbol and whether it was found, to pick the symbols worth binding eagerly.
+ * 
+ * 		new NativeStats().dumpLoads(System.out);
+ * 
+ * 6) Or dump the native resources (bitmaps, regions, cairo surfaces, GDI+ objects,
+ * memory...) that are alive, per type, with the bytes they hold when known. The
+ * natives that create and destroy them are marked in the metadata (resource= and
+ * flags=destroy). To also find where the live resources were created, capture
+ * the stacks before the section of interest (this slows every creation down).
+ * 
+ * 		NativeStats stats = new NativeStats();
+ * 		stats.setResourceStacks(true);
+ * 		...
+ * 		<code section>
+ * 		...
+ * 		stats.dumpResources(System.out);
  */
 public class NativeStats {
 	
 	Hashtable<String, NativeFunction[]> snapshot;
 	
-	final static String[] classes = new String[]{"OS", "ATK", "CDE", "GNOME", "GTK", "XPCOM", "COM", "AGL", "Gdip", "GLX", "Cairo", "WGL"};
+	final static String[] classes = new String[]{"OS", "C", "ATK", "CDE", "GNOME", "GTK", "XPCOM", "COM", "AGL", "Gdip", "GLX", "Cairo", "WGL"};
 
+	final static int EVENT_COUNT = 8192;
+	final static int EVENT_SIZE = 5;
+	final static int LOAD_COUNT = 2048;
+	final static int RESOURCE_TYPES = 64;
+	final static int RESOURCE_SIZE = 4;
 	
 	public static class NativeFunction implements Comparable<Object> {
 		String name;
 		int callCount;
+		long callTime;
 		
 	public NativeFunction(String name, int callCount) {
+		this(name, callCount, 0);
+	}
+
+	public NativeFunction(String name, int callCount, long callTime) {
 		this.name = name;
 		this.callCount = callCount;
+		this.callTime = callTime;
 	}
 
 	void subtract(NativeFunction func) {
 		this.callCount -= func.callCount;
+		this.callTime -= func.callTime;
 	}
 
 	public int getCallCount() {
 		return callCount;
 	}
 
+	/**
+	 * Returns the time spent in the function in nanoseconds, including
+	 * the time spent in the natives it called back into.
+	 */
+	public long getCallTime() {
+		return callTime;
+	}
+
 	public String getName() {
 		return name;
 	}
@@ -64,6 +118,114 @@ public class NativeStats {
 	}
 	}
 	
+	public static class NativeResource implements Comparable<Object> {
+		String type;
+		long count, bytes, created, peak;
+
+	NativeResource(String type) {
+		this.type = type;
+	}
+
+	/**
+	 * Returns the number of resources of this type that are alive.
+	 */
+	public long getCount() {
+		return count;
+	}
+
+	/**
+	 * Returns the bytes held by the resources of this type that are alive,
+	 * as far as the natives that create them know their size.
+	 */
+	public long getBytes() {
+		return bytes;
+	}
+
+	/**
+	 * Returns the number of resources of this type created since the library
+	 * was loaded.
+	 */
+	public long getCreated() {
+		return created;
+	}
+
+	/**
+	 * Returns the largest number of resources of this type that were alive at
+	 * the same time.
+	 */
+	public long getPeak() {
+		return peak;
+	}
+
+	public String getType() {
+		return type;
+	}
+
+	public int compareTo(Object resource) {
+		NativeResource other = (NativeResource)resource;
+		if (bytes != other.bytes) return bytes > other.bytes ? -1 : 1;
+		if (count != other.count) return count > other.count ? -1 : 1;
+		return type.compareTo(other.type);
+	}
+	}
+
+	public static class LiveResource {
+		String type;
+		long handle, size;
+		Error stack;
+
+	LiveResource(String type, long handle, long size, Error stack) {
+		this.type = type;
+		this.handle = handle;
+		this.size = size;
+		this.stack = stack;
+	}
+
+	public long getHandle() {
+		return handle;
+	}
+
+	public long getSize() {
+		return size;
+	}
+
+	/**
+	 * Returns an error created when the resource was, or <code>null</code>
+	 * if stacks were not captured at the time.
+	 */
+	public Error getStack() {
+		return stack;
+	}
+
+	public String getType() {
+		return type;
+	}
+
+	@Override
+	public String toString() {
+		return type + " 0x" + Long.toHexString(handle) + (size != 0 ? " (" + size + " bytes)" : "");
+	}
+	}
+
+	static class NativeCall {
+		String name;
+		int thread, depth;
+		long start, duration, self;
+		NativeCall parent;
+
+	NativeCall(String name, long[] buffer, int offset) {
+		this.name = name;
+		thread = (int)buffer[offset + 1];
+		depth = (int)buffer[offset + 2];
+		start = buffer[offset + 3];
+		duration = self = buffer[offset + 4];
+	}
+
+	String getStack() {
+		return parent != null ? parent.getStack() + ";" + name : name;
+	}
+	}
+
 public NativeStats() {
 	snapshot = snapshot();
 }
@@ -125,6 +287,11 @@ void dump(String className, NativeFunction[] funcs, PrintStream ps) {
 			ps.print(func.getName());
 			ps.print("=");
 			ps.print(func.getCallCount());
+			if (func.getCallTime() > 0) {
+				ps.print(" (");
+				ps.print(func.getCallTime() / 1000);
+				ps.print("us)");
+			}
 			ps.println();
 		}
 	}
@@ -149,6 +316,7 @@ public Hashtable<String, NativeFunction[]> snapshot(String className, Hashtable<
 		Method functionCount = clazz.getMethod(className + "_GetFunctionCount", new Class[0]);
 		Method functionCallCount = clazz.getMethod(className + "_GetFunctionCallCount", new Class[]{int.class});
 		Method functionName = clazz.getMethod(className + "_GetFunctionName", new Class[]{int.class});
+		Method functionCallTime = clazz.getMethod(className + "_GetFunctionCallTime", new Class[]{int.class});
 		int count = ((Integer)functionCount.invoke(clazz, new Object[0])).intValue();
 		NativeFunction[] funcs = new NativeFunction[count];
 		Object[] index = new Object[1];
@@ -156,7 +324,14 @@ public Hashtable<String, NativeFunction[]> snapshot(String className, Hashtable<
 			index[0] = new Integer(i);
 			int callCount = ((Integer)functionCallCount.invoke(clazz, index)).intValue();
 			String name = (String)functionName.invoke(clazz, index);
-			funcs[i] = new NativeFunction(name, callCount);
+			long callTime = 0;
+			try {
+				if (functionCallTime != null) callTime = ((Long)functionCallTime.invoke(clazz, index)).longValue();
+			} catch (InvocationTargetException e) {
+				/* library built without call times */
+				functionCallTime = null;
+			}
+			funcs[i] = new NativeFunction(name, callCount, callTime);
 		}
 		snapshot.put(className, funcs);
 	} catch (Throwable e) {
@@ -164,53 +339,454 @@ public Hashtable<String, NativeFunction[]> snapshot(String className, Hashtable<
 	}
 	return snapshot;
 }
+
+/**
+ * Starts recording the native calls of all the classes. The calls that were
+ * recorded before are discarded.
+ */
+public void startTracing() {
+	setTracing(false);
+	traces();
+	setTracing(true);
+}
+
+public void stopTracing() {
+	setTracing(false);
+}
+
+void setTracing(boolean enabled) {
+	Class<? extends NativeStats> clazz = getClass();
+	for (int i = 0; i < classes.length; i++) {
+		try {
+			Method setTracing = clazz.getMethod(classes[i] + "_SetTracing", new Class[]{boolean.class});
+			setTracing.invoke(clazz, new Object[]{Boolean.valueOf(enabled)});
+		} catch (Throwable e) {
+//			e.printStackTrace(System.out);
+		}
+	}
+}
+
+/**
+ * Answers the native calls recorded since tracing was started, sorted per thread
+ * in the order they were made, and empties the trace buffers.
+ */
+ArrayList<NativeCall> traces() {
+	ArrayList<NativeCall> calls = new ArrayList<NativeCall>();
+	for (int i = 0; i < classes.length; i++) {
+		String className = classes[i];
+		try {
+			Class<? extends NativeStats> clazz = getClass();
+			Method getEvents = clazz.getMethod(className + "_GetEvents", new Class[]{long[].class});
+			Method functionName = clazz.getMethod(className + "_GetFunctionName", new Class[]{int.class});
+			long[] buffer = new long[EVENT_COUNT * EVENT_SIZE];
+			int count = ((Integer)getEvents.invoke(clazz, new Object[]{buffer})).intValue();
+			for (int j = 0; j < count; j++) {
+				int offset = j * EVENT_SIZE;
+				String name = (String)functionName.invoke(clazz, new Object[]{new Integer((int)buffer[offset])});
+				calls.add(new NativeCall(className + "." + name, buffer, offset));
+			}
+		} catch (Throwable e) {
+//			e.printStackTrace(System.out);
+		}
+	}
+	Collections.sort(calls, new Comparator<NativeCall>() {
+		public int compare(NativeCall call1, NativeCall call2) {
+			if (call1.thread != call2.thread) return call1.thread < call2.thread ? -1 : 1;
+			if (call1.start != call2.start) return call1.start < call2.start ? -1 : 1;
+			if (call1.duration != call2.duration) return call1.duration > call2.duration ? -1 : 1;
+			return call1.depth - call2.depth;
+		}
+	});
+	return calls;
+}
+
+/**
+ * Dumps the native calls recorded since tracing was started in the folded
+ * stack format, aggregating the time spent in the same call stack. Natives
+ * called from callbacks are nested under the native that ran the callback,
+ * also when they live in different libraries.
+ */
+public void dumpProfile(PrintStream ps) {
+	ArrayList<NativeCall> calls = traces();
+	ArrayList<NativeCall> stack = new ArrayList<NativeCall>();
+	int thread = -1;
+	for (int i = 0; i < calls.size(); i++) {
+		NativeCall call = calls.get(i);
+		if (call.thread != thread) {
+			stack.clear();
+			thread = call.thread;
+		}
+		while (!stack.isEmpty()) {
+			NativeCall top = stack.get(stack.size() - 1);
+			if (call.start + call.duration <= top.start + top.duration) break;
+			stack.remove(stack.size() - 1);
+		}
+		if (!stack.isEmpty()) {
+			call.parent = stack.get(stack.size() - 1);
+			call.parent.self -= call.duration;
+		}
+		stack.add(call);
+	}
+	TreeMap<String, long[]> profile = new TreeMap<String, long[]>();
+	for (int i = 0; i < calls.size(); i++) {
+		NativeCall call = calls.get(i);
+		String key = call.getStack();
+		long[] time = profile.get(key);
+		if (time == null) profile.put(key, time = new long[1]);
+		time[0] += Math.max(0, call.self);
+	}
+	Iterator<Map.Entry<String, long[]>> iterator = profile.entrySet().iterator();
+	while (iterator.hasNext()) {
+		Map.Entry<String, long[]> entry = iterator.next();
+		long time = entry.getValue()[0] / 1000;
+		if (time == 0) continue;
+		ps.print(entry.getKey());
+		ps.print(" ");
+		ps.print(time);
+		ps.println();
+	}
+}
+	
+/**
+ * Dumps the dynamic functions resolved since the last call, grouped by
+ * library and slowest first. Each resolution is reported once.
+ */
+public void dumpLoads(PrintStream ps) {
+	TreeMap<String, ArrayList<Object[]>> libraries = new TreeMap<String, ArrayList<Object[]>>();
+	for (int i = 0; i < classes.length; i++) {
+		try {
+			Class<? extends NativeStats> clazz = getClass();
+			Method getLoads = clazz.getMethod(classes[i] + "_GetLoads", new Class[]{String[].class, long[].class});
+			String[] names = new String[LOAD_COUNT * 2];
+			long[] values = new long[LOAD_COUNT * 2];
+			int count = ((Integer)getLoads.invoke(clazz, new Object[]{names, values})).intValue();
+			for (int j = 0; j < count; j++) {
+				ArrayList<Object[]> loads = libraries.get(names[j * 2]);
+				if (loads == null) libraries.put(names[j * 2], loads = new ArrayList<Object[]>());
+				loads.add(new Object[]{names[j * 2 + 1], new Long(values[j * 2]), Boolean.valueOf(values[j * 2 + 1] != 0)});
+			}
+		} catch (Throwable e) {
+//			e.printStackTrace(System.out);
+		}
+	}
+	Iterator<Map.Entry<String, ArrayList<Object[]>>> iterator = libraries.entrySet().iterator();
+	while (iterator.hasNext()) {
+		Map.Entry<String, ArrayList<Object[]>> entry = iterator.next();
+		ArrayList<Object[]> loads = entry.getValue();
+		Collections.sort(loads, new Comparator<Object[]>() {
+			public int compare(Object[] load1, Object[] load2) {
+				return ((Long)load2[1]).compareTo((Long)load1[1]);
+			}
+		});
+		long total = 0;
+		int missing = 0;
+		for (int i = 0; i < loads.size(); i++) {
+			Object[] load = loads.get(i);
+			total += ((Long)load[1]).longValue();
+			if (!((Boolean)load[2]).booleanValue()) missing++;
+		}
+		ps.print(entry.getKey());
+		ps.print("=");
+		ps.print(loads.size());
+		ps.print(" (");
+		ps.print(total / 1000);
+		ps.print("us, ");
+		ps.print(missing);
+		ps.print(" missing)");
+		ps.println();
+		for (int i = 0; i < loads.size(); i++) {
+			Object[] load = loads.get(i);
+			ps.print("\t");
+			ps.print(load[0]);
+			ps.print("=");
+			ps.print(((Long)load[1]).longValue() / 1000);
+			ps.print("us");
+			if (!((Boolean)load[2]).booleanValue()) ps.print(" (missing)");
+			ps.println();
+		}
+	}
+}
+
+/**
+ * Starts or stops capturing where the native resources are created. Only the
+ * resources created while stacks are captured have one.
+ */
+public void setResourceStacks(boolean enabled) {
+	Class<? extends NativeStats> clazz = getClass();
+	for (int i = 0; i < classes.length; i++) {
+		try {
+			Method setResourceStacks = clazz.getMethod(classes[i] + "_SetResourceStacks", new Class[]{boolean.class});
+			setResourceStacks.invoke(clazz, new Object[]{Boolean.valueOf(enabled)});
+		} catch (Throwable e) {
+//			e.printStackTrace(System.out);
+		}
+	}
+}
+
+/**
+ * Answers the counters of each type of native resource, the types that hold
+ * the most bytes first. The classes of a library share their counters, so
+ * each library is only counted once.
+ */
+public NativeResource[] resources() {
+	TreeMap<String, NativeResource> types = new TreeMap<String, NativeResource>();
+	HashSet<Long> tables = new HashSet<Long>();
+	for (int i = 0; i < classes.length; i++) {
+		try {
+			Class<? extends NativeStats> clazz = getClass();
+			Method getResources = clazz.getMethod(classes[i] + "_GetResources", new Class[]{String[].class, long[].class});
+			String[] names = new String[RESOURCE_TYPES];
+			long[] values = new long[1 + RESOURCE_TYPES * RESOURCE_SIZE];
+			int count = ((Integer)getResources.invoke(clazz, new Object[]{names, values})).intValue();
+			if (!tables.add(new Long(values[0]))) continue;
+			for (int j = 0; j < count; j++) {
+				NativeResource resource = types.get(names[j]);
+				if (resource == null) types.put(names[j], resource = new NativeResource(names[j]));
+				int offset = 1 + j * RESOURCE_SIZE;
+				resource.count += values[offset];
+				resource.bytes += values[offset + 1];
+				resource.created += values[offset + 2];
+				resource.peak += values[offset + 3];
+			}
+		} catch (Throwable e) {
+//			e.printStackTrace(System.out);
+		}
+	}
+	NativeResource[] result = types.values().toArray(new NativeResource[types.size()]);
+	Arrays.sort(result);
+	return result;
+}
+
+/**
+ * Answers the native resources that are alive.
+ */
+public LiveResource[] liveResources() {
+	NativeResource[] resources = resources();
+	int length = 0;
+	for (int i = 0; i < resources.length; i++) {
+		length += (int)resources[i].count;
+	}
+	ArrayList<LiveResource> result = new ArrayList<LiveResource>();
+	HashSet<Long> tables = new HashSet<Long>();
+	for (int i = 0; i < classes.length; i++) {
+		try {
+			Class<? extends NativeStats> clazz = getClass();
+			Method getLiveResources = clazz.getMethod(classes[i] + "_GetLiveResources", new Class[]{Object[].class, long[].class});
+			/* Leave room for the resources created since the counters were read */
+			int capacity = length + 1024;
+			Object[] objects = new Object[capacity * 2];
+			long[] values = new long[1 + capacity * 2];
+			int count = ((Integer)getLiveResources.invoke(clazz, new Object[]{objects, values})).intValue();
+			if (!tables.add(new Long(values[0]))) continue;
+			for (int j = 0; j < count; j++) {
+				result.add(new LiveResource((String)objects[j * 2], values[1 + j * 2], values[1 + j * 2 + 1], (Error)objects[j * 2 + 1]));
+			}
+		} catch (Throwable e) {
+//			e.printStackTrace(System.out);
+		}
+	}
+	return result.toArray(new LiveResource[result.size()]);
+}
+
+/**
+ * Dumps the counters of each type of native resource and, for the live
+ * resources whose stack was captured, the places where they were created,
+ * those that hold the most resources first.
+ */
+public void dumpResources(PrintStream ps) {
+	NativeResource[] resources = resources();
+	for (int i = 0; i < resources.length; i++) {
+		NativeResource resource = resources[i];
+		ps.print(resource.getType());
+		ps.print("=");
+		ps.print(resource.getCount());
+		ps.print(" (");
+		ps.print(resource.getBytes());
+		ps.print(" bytes, ");
+		ps.print(resource.getCreated());
+		ps.print(" created, ");
+		ps.print(resource.getPeak());
+		ps.print(" peak)");
+		ps.println();
+	}
+	LiveResource[] live = liveResources();
+	HashMap<String, long[]> sites = new HashMap<String, long[]>();
+	for (int i = 0; i < live.length; i++) {
+		Error stack = live[i].getStack();
+		if (stack == null) continue;
+		StringWriter writer = new StringWriter();
+		stack.printStackTrace(new PrintWriter(writer));
+		String trace = writer.toString();
+		/* The first line is the error itself */
+		String key = live[i].getType() + trace.substring(trace.indexOf('\n'));
+		long[] site = sites.get(key);
+		if (site == null) sites.put(key, site = new long[2]);
+		site[0]++;
+		site[1] += live[i].getSize();
+	}
+	ArrayList<Map.Entry<String, long[]>> entries = new ArrayList<Map.Entry<String, long[]>>(sites.entrySet());
+	Collections.sort(entries, new Comparator<Map.Entry<String, long[]>>() {
+		public int compare(Map.Entry<String, long[]> entry1, Map.Entry<String, long[]> entry2) {
+			long count1 = entry1.getValue()[0], count2 = entry2.getValue()[0];
+			return count1 == count2 ? 0 : count1 > count2 ? -1 : 1;
+		}
+	});
+	for (int i = 0; i < entries.size(); i++) {
+		Map.Entry<String, long[]> entry = entries.get(i);
+		ps.println();
+		ps.print(entry.getValue()[0]);
+		ps.print(" live ");
+		String key = entry.getKey();
+		int index = key.indexOf('\n');
+		ps.print(key.substring(0, index).trim());
+		ps.print(" (");
+		ps.print(entry.getValue()[1]);
+		ps.print(" bytes) created");
+		ps.print(key.substring(index));
+	}
+}
 	
 public static final native int OS_GetFunctionCount();
 public static final native String OS_GetFunctionName(int index);
 public static final native int OS_GetFunctionCallCount(int index);
+public static final native long OS_GetFunctionCallTime(int index);
+public static final native void OS_SetTracing(boolean enabled);
+public static final native int OS_GetEvents(long[] buffer);
+public static final native int OS_GetLoads(String[] names, long[] values);
+public static final native void OS_SetResourceStacks(boolean enabled);
+public static final native int OS_GetResources(String[] names, long[] values);
+public static final native int OS_GetLiveResources(Object[] objects, long[] values);
+
+public static final native int C_GetFunctionCount();
+public static final native String C_GetFunctionName(int index);
+public static final native int C_GetFunctionCallCount(int index);
+public static final native long C_GetFunctionCallTime(int index);
+public static final native void C_SetTracing(boolean enabled);
+public static final native int C_GetEvents(long[] buffer);
+public static final native int C_GetLoads(String[] names, long[] values);
+public static final native void C_SetResourceStacks(boolean enabled);
+public static final native int C_GetResources(String[] names, long[] values);
+public static final native int C_GetLiveResources(Object[] objects, long[] values);
 
 public static final native int ATK_GetFunctionCount();
 public static final native String ATK_GetFunctionName(int index);
 public static final native int ATK_GetFunctionCallCount(int index);
+public static final native long ATK_GetFunctionCallTime(int index);
+public static final native void ATK_SetTracing(boolean enabled);
+public static final native int ATK_GetEvents(long[] buffer);
+public static final native int ATK_GetLoads(String[] names, long[] values);
+public static final native void ATK_SetResourceStacks(boolean enabled);
+public static final native int ATK_GetResources(String[] names, long[] values);
+public static final native int ATK_GetLiveResources(Object[] objects, long[] values);
 
 public static final native int AGL_GetFunctionCount();
 public static final native String AGL_GetFunctionName(int index);
 public static final native int AGL_GetFunctionCallCount(int index);
+public static final native long AGL_GetFunctionCallTime(int index);
+public static final native void AGL_SetTracing(boolean enabled);
+public static final native int AGL_GetEvents(long[] buffer);
+public static final native int AGL_GetLoads(String[] names, long[] values);
+public static final native void AGL_SetResourceStacks(boolean enabled);
+public static final native int AGL_GetResources(String[] names, long[] values);
+public static final native int AGL_GetLiveResources(Object[] objects, long[] values);
 
 public static final native int CDE_GetFunctionCount();
 public static final native String CDE_GetFunctionName(int index);
 public static final native int CDE_GetFunctionCallCount(int index);
+public static final native long CDE_GetFunctionCallTime(int index);
+public static final native void CDE_SetTracing(boolean enabled);
+public static final native int CDE_GetEvents(long[] buffer);
+public static final native int CDE_GetLoads(String[] names, long[] values);
+public static final native void CDE_SetResourceStacks(boolean enabled);
+public static final native int CDE_GetResources(String[] names, long[] values);
+public static final native int CDE_GetLiveResources(Object[] objects, long[] values);
 
 public static final native int Gdip_GetFunctionCount();
 public static final native String Gdip_GetFunctionName(int index);
 public static final native int Gdip_GetFunctionCallCount(int index);
+public static final native long Gdip_GetFunctionCallTime(int index);
+public static final native void Gdip_SetTracing(boolean enabled);
+public static final native int Gdip_GetEvents(long[] buffer);
+public static final native int Gdip_GetLoads(String[] names, long[] values);
+public static final native void Gdip_SetResourceStacks(boolean enabled);
+public static final native int Gdip_GetResources(String[] names, long[] values);
+public static final native int Gdip_GetLiveResources(Object[] objects, long[] values);
 
 public static final native int GLX_GetFunctionCount();
 public static final native String GLX_GetFunctionName(int index);
 public static final native int GLX_GetFunctionCallCount(int index);
+public static final native long GLX_GetFunctionCallTime(int index);
+public static final native void GLX_SetTracing(boolean enabled);
+public static final native int GLX_GetEvents(long[] buffer);
+public static final native int GLX_GetLoads(String[] names, long[] values);
+public static final native void GLX_SetResourceStacks(boolean enabled);
+public static final native int GLX_GetResources(String[] names, long[] values);
+public static final native int GLX_GetLiveResources(Object[] objects, long[] values);
 
 public static final native int GNOME_GetFunctionCount();
 public static final native String GNOME_GetFunctionName(int index);
 public static final native int GNOME_GetFunctionCallCount(int index);
+public static final native long GNOME_GetFunctionCallTime(int index);
+public static final native void GNOME_SetTracing(boolean enabled);
+public static final native int GNOME_GetEvents(long[] buffer);
+public static final native int GNOME_GetLoads(String[] names, long[] values);
+public static final native void GNOME_SetResourceStacks(boolean enabled);
+public static final native int GNOME_GetResources(String[] names, long[] values);
+public static final native int GNOME_GetLiveResources(Object[] objects, long[] values);
 
 public static final native int GTK_GetFunctionCount();
 public static final native String GTK_GetFunctionName(int index);
 public static final native int GTK_GetFunctionCallCount(int index);
+public static final native long GTK_GetFunctionCallTime(int index);
+public static final native void GTK_SetTracing(boolean enabled);
+public static final native int GTK_GetEvents(long[] buffer);
+public static final native int GTK_GetLoads(String[] names, long[] values);
+public static final native void GTK_SetResourceStacks(boolean enabled);
+public static final native int GTK_GetResources(String[] names, long[] values);
+public static final native int GTK_GetLiveResources(Object[] objects, long[] values);
 
 public static final native int XPCOM_GetFunctionCount();
 public static final native String XPCOM_GetFunctionName(int index);
 public static final native int XPCOM_GetFunctionCallCount(int index);
+public static final native long XPCOM_GetFunctionCallTime(int index);
+public static final native void XPCOM_SetTracing(boolean enabled);
+public static final native int XPCOM_GetEvents(long[] buffer);
+public static final native int XPCOM_GetLoads(String[] names, long[] values);
+public static final native void XPCOM_SetResourceStacks(boolean enabled);
+public static final native int XPCOM_GetResources(String[] names, long[] values);
+public static final native int XPCOM_GetLiveResources(Object[] objects, long[] values);
 
 public static final native int COM_GetFunctionCount();
 public static final native String COM_GetFunctionName(int index);
 public static final native int COM_GetFunctionCallCount(int index);
+public static final native long COM_GetFunctionCallTime(int index);
+public static final native void COM_SetTracing(boolean enabled);
+public static final native int COM_GetEvents(long[] buffer);
+public static final native int COM_GetLoads(String[] names, long[] values);
+public static final native void COM_SetResourceStacks(boolean enabled);
+public static final native int COM_GetResources(String[] names, long[] values);
+public static final native int COM_GetLiveResources(Object[] objects, long[] values);
 
 public static final native int WGL_GetFunctionCount();
 public static final native String WGL_GetFunctionName(int index);
 public static final native int WGL_GetFunctionCallCount(int index);
+public static final native long WGL_GetFunctionCallTime(int index);
+public static final native void WGL_SetTracing(boolean enabled);
+public static final native int WGL_GetEvents(long[] buffer);
+public static final native int WGL_GetLoads(String[] names, long[] values);
+public static final native void WGL_SetResourceStacks(boolean enabled);
+public static final native int WGL_GetResources(String[] names, long[] values);
+public static final native int WGL_GetLiveResources(Object[] objects, long[] values);
 
 public static final native int Cairo_GetFunctionCount();
 public static final native String Cairo_GetFunctionName(int index);
 public static final native int Cairo_GetFunctionCallCount(int index);
+public static final native long Cairo_GetFunctionCallTime(int index);
+public static final native void Cairo_SetTracing(boolean enabled);
+public static final native int Cairo_GetEvents(long[] buffer);
+public static final native int Cairo_GetLoads(String[] names, long[] values);
+public static final native void Cairo_SetResourceStacks(boolean enabled);
+public static final native int Cairo_GetResources(String[] names, long[] values);
+public static final native int Cairo_GetLiveResources(Object[] objects, long[] values);
 
 }
@@ -25,7 +25,7 @@ import java.io.*;
 public class Sleak {
 	List list;
 	Canvas canvas;
-	Button start, stop, check;
+	Button start, stop, check, nativeButton, nativeCheck;
 	Text text;
 	Label label;
 	
@@ -33,6 +33,7 @@ public class Sleak {
 	Error [] oldErrors = new Error [0];
 	Object [] objects = new Object [0];
 	Error [] errors = new Error [0];
+	NativeStats nativeStats = new NativeStats ();
 
 public static void main (String [] args) {
 	DeviceData data = new DeviceData();
@@ -99,6 +100,20 @@ public void create (Composite parent) {
 			refreshDifference ();
 		}
 	});
+	nativeCheck = new Button (parent, SWT.CHECK);
+	nativeCheck.setText ("Native Stack");
+	nativeCheck.addListener (SWT.Selection, new Listener () {
+		public void handleEvent (Event e) {
+			nativeStats.setResourceStacks (nativeCheck.getSelection ());
+		}
+	});
+	nativeButton = new Button (parent, SWT.PUSH);
+	nativeButton.setText ("Native");
+	nativeButton.addListener (SWT.Selection, new Listener () {
+		public void handleEvent (Event event) {
+			refreshNative ();
+		}
+	});
 	label = new Label (parent, SWT.BORDER);
 	label.setText ("0 object(s)");
 	parent.addListener (SWT.Resize, new Listener () {
@@ -107,6 +122,7 @@ public void create (Composite parent) {
 		}
 	});
 	check.setSelection (false);
+	nativeCheck.setSelection (false);
 	text.setVisible (false);
 	layout();
 }
@@ -144,6 +160,43 @@ void refreshLabel () {
 	label.setText (string);
 }
 
+/*
+* Lists the native resources that are alive, as tracked by the natives of
+* a library built with NATIVE_STATS.  Their stack is only known when they
+* were created while Native Stack was checked.
+*/
+void refreshNative () {
+	NativeStats.LiveResource [] resources = nativeStats.liveResources ();
+	objects = new Object [resources.length];
+	errors = new Error [resources.length];
+	for (int i=0; i<resources.length; i++) {
+		objects [i] = resources [i];
+		errors [i] = resources [i].getStack ();
+	}
+	list.removeAll ();
+	text.setText ("");
+	canvas.redraw ();
+	for (int i=0; i<objects.length; i++) {
+		list.add (objects [i].toString());
+	}
+	String string = "";
+	NativeStats.NativeResource [] types = nativeStats.resources ();
+	for (int i=0; i<types.length; i++) {
+		NativeStats.NativeResource type = types [i];
+		if (type.getCount () == 0) continue;
+		string += type.getCount () + " " + type.getType ();
+		if (type.getBytes () != 0) string += " (" + type.getBytes () / 1024 + " KB)";
+		string += "\n";
+	}
+	if (string.length () != 0) {
+		string = string.substring (0, string.length () - 1);
+	} else {
+		string = "0 native resource(s)";
+	}
+	label.setText (string);
+	layout ();
+}
+
 void refreshDifference () {
 	Display display = canvas.getDisplay();
 	DeviceData info = display.getDeviceData ();
@@ -272,8 +325,12 @@ void refreshObject () {
 	if (check.getSelection ()) {
 		ByteArrayOutputStream stream = new ByteArrayOutputStream ();
 		PrintStream s = new PrintStream (stream);
-		errors [index].printStackTrace (s);
-		text.setText (stream.toString ());
+		if (errors [index] != null) {
+			errors [index].printStackTrace (s);
+			text.setText (stream.toString ());
+		} else {
+			text.setText ("No stack, check Native Stack before the resource is created");
+		}
 		text.setVisible (true);
 		canvas.setVisible (false);
 	} else {
@@ -305,13 +362,18 @@ void layout () {
 	Point size2 = stop.computeSize (SWT.DEFAULT, SWT.DEFAULT);
 	Point size3 = check.computeSize (SWT.DEFAULT, SWT.DEFAULT);
 	Point size4 = label.computeSize (SWT.DEFAULT, SWT.DEFAULT);
+	Point size5 = nativeButton.computeSize (SWT.DEFAULT, SWT.DEFAULT);
+	Point size6 = nativeCheck.computeSize (SWT.DEFAULT, SWT.DEFAULT);
 	width = Math.max (size1.x, Math.max (size2.x, Math.max (size3.x, width)));
+	width = Math.max (size5.x, Math.max (size6.x, width));
 	width = Math.max (64, Math.max (size4.x, list.computeSize (width, SWT.DEFAULT).x));
 	start.setBounds (0, 0, width, size1.y);
 	stop.setBounds (0, size1.y, width, size2.y);
 	check.setBounds (0, size1.y + size2.y, width, size3.y);
+	nativeButton.setBounds (0, size1.y + size2.y + size3.y, width, size5.y);
+	nativeCheck.setBounds (0, size1.y + size2.y + size3.y + size5.y, width, size6.y);
 	label.setBounds (0, rect.height - size4.y, width, size4.y);
-	int height = size1.y + size2.y + size3.y;
+	int height = size1.y + size2.y + size3.y + size5.y + size6.y;
 	list.setBounds (0, height, width, rect.height - height - size4.y);
 	text.setBounds (width, 0, rect.width - width, rect.height);
 	canvas.setBounds (width, 0, rect.width - width, rect.height);
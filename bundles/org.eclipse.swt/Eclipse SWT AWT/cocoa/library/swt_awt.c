@@ -15,20 +15,36 @@
 
 #define SWT_AWT_NATIVE(func) Java_org_eclipse_swt_awt_SWT_1AWT_##func
 
+/*
+ * The JAWT function table does not change while the process runs, so it
+ * is looked up only once.
+ */
+static JAWT awt;
+static jboolean awtLoaded = JNI_FALSE;
+
+static JAWT *getAWT(JNIEnv *env)
+{
+	if (!awtLoaded) {
+		awt.version = JAWT_VERSION_1_4;
+		if (JAWT_GetAWT(env, &awt) == 0) return NULL;
+		awtLoaded = JNI_TRUE;
+	}
+	return &awt;
+}
+
 #ifndef NO_getAWTHandle
 JNIEXPORT jintLong JNICALL SWT_AWT_NATIVE(getAWTHandle)
 	(JNIEnv *env, jclass that, jobject canvas)
 {
 	jintLong result = 0;
-	JAWT awt;
+	JAWT* jawt;
 	JAWT_DrawingSurface* ds;
 	JAWT_DrawingSurfaceInfo* dsi;
 	JAWT_MacOSXDrawingSurfaceInfo* dsi_cocoa;
 	jint lock;
 
-	awt.version = JAWT_VERSION_1_4;
-	if (JAWT_GetAWT(env, &awt) != 0) {
-		ds = awt.GetDrawingSurface(env, canvas);
+	if ((jawt = getAWT(env)) != NULL) {
+		ds = jawt->GetDrawingSurface(env, canvas);
 		if (ds != NULL) {
 			lock = ds->Lock(ds);
 		 	if ((lock & JAWT_LOCK_ERROR) == 0) {
@@ -38,8 +54,8 @@ JNIEXPORT jintLong JNICALL SWT_AWT_NATIVE(getAWTHandle)
 				ds->FreeDrawingSurfaceInfo(dsi);
 				ds->Unlock(ds);
 			}
+			jawt->FreeDrawingSurface(ds);
 		}
-		awt.FreeDrawingSurface(ds);
 	}
 	return result;
 }
@@ -12,22 +12,40 @@
 #include "swt.h"
 #include "jawt_md.h"
 
+#include <string.h>
+
 #define SWT_AWT_NATIVE(func) Java_org_eclipse_swt_awt_SWT_1AWT_##func
 
+/*
+ * The JAWT function table does not change while the process runs, so it
+ * is looked up only once.
+ */
+static JAWT awt;
+static jboolean awtLoaded = JNI_FALSE;
+
+static JAWT *getAWT(JNIEnv *env)
+{
+	if (!awtLoaded) {
+		awt.version = JAWT_VERSION_1_3;
+		if (JAWT_GetAWT(env, &awt) == 0) return NULL;
+		awtLoaded = JNI_TRUE;
+	}
+	return &awt;
+}
+
 #ifndef NO_getAWTHandle
 JNIEXPORT jintLong JNICALL SWT_AWT_NATIVE(getAWTHandle)
 	(JNIEnv *env, jclass that, jobject canvas)
 {
-	JAWT awt;
+	JAWT* jawt;
 	JAWT_DrawingSurface* ds;
 	JAWT_DrawingSurfaceInfo* dsi;
 	JAWT_X11DrawingSurfaceInfo* dsi_x11;
 	jintLong result = 0;
 	jint lock;
 
-	awt.version = JAWT_VERSION_1_3;
-	if (JAWT_GetAWT(env, &awt) != 0) {
-		ds = awt.GetDrawingSurface(env, canvas);
+	if ((jawt = getAWT(env)) != NULL) {
+		ds = jawt->GetDrawingSurface(env, canvas);
 		if (ds != NULL) {
 			lock = ds->Lock(ds);
 		 	if ((lock & JAWT_LOCK_ERROR) == 0) {
@@ -37,8 +55,8 @@ JNIEXPORT jintLong JNICALL SWT_AWT_NATIVE(getAWTHandle)
 				ds->FreeDrawingSurfaceInfo(dsi);
 				ds->Unlock(ds);
 			}
+			jawt->FreeDrawingSurface(ds);
 		}
-		awt.FreeDrawingSurface(ds);
 	}
 	return result;
 }
@@ -48,15 +66,14 @@ JNIEXPORT jintLong JNICALL SWT_AWT_NATIVE(getAWTHandle)
 JNIEXPORT void JNICALL SWT_AWT_NATIVE(setDebug)
 	(JNIEnv *env, jclass that, jobject frame, jboolean debug)
 {
-	JAWT awt;
+	JAWT* jawt;
 	JAWT_DrawingSurface* ds;
 	JAWT_DrawingSurfaceInfo* dsi;
 	JAWT_X11DrawingSurfaceInfo* dsi_x11;
 	jint lock;
 
-	awt.version = JAWT_VERSION_1_3;
-	if (JAWT_GetAWT(env, &awt) != 0) {
-		ds = awt.GetDrawingSurface(env, frame);
+	if ((jawt = getAWT(env)) != NULL) {
+		ds = jawt->GetDrawingSurface(env, frame);
 		if (ds != NULL) {
 			lock = ds->Lock(ds);
 		 	if ((lock & JAWT_LOCK_ERROR) == 0) {
@@ -66,8 +83,36 @@ JNIEXPORT void JNICALL SWT_AWT_NATIVE(setDebug)
 				ds->FreeDrawingSurfaceInfo(dsi);
 				ds->Unlock(ds);
 			}
+			jawt->FreeDrawingSurface(ds);
+		}
+	}
+}
+#endif
+
+#ifndef NO_copyPixels
+JNIEXPORT jboolean JNICALL SWT_AWT_NATIVE(copyPixels)
+	(JNIEnv *env, jclass that, jintLong data, jint stride, jintArray pixels, jint offset, jint scanline, jint width, jint height, jboolean toData)
+{
+	jint *lpixels;
+	jsize length;
+	jint y;
+
+	if (data == 0 || pixels == NULL || width <= 0 || height <= 0) return JNI_FALSE;
+	if (offset < 0 || scanline < width || stride / 4 < width) return JNI_FALSE;
+	length = (*env)->GetArrayLength(env, pixels);
+	if (offset > length || (jlong)scanline * (height - 1) + width > length - offset) return JNI_FALSE;
+	lpixels = (*env)->GetPrimitiveArrayCritical(env, pixels, NULL);
+	if (lpixels == NULL) return JNI_FALSE;
+	for (y = 0; y < height; y++) {
+		char *row = (char *)data + (jlong)y * stride;
+		jint *line = lpixels + offset + (jlong)y * scanline;
+		if (toData) {
+			memcpy(row, line, width * 4);
+		} else {
+			memcpy(line, row, width * 4);
 		}
-		awt.FreeDrawingSurface(ds);
 	}
+	(*env)->ReleasePrimitiveArrayCritical(env, pixels, lpixels, toData ? JNI_ABORT : 0);
+	return JNI_TRUE;
 }
 #endif
@@ -16,8 +16,10 @@ import java.lang.reflect.Method;
 /* SWT Imports */
 import org.eclipse.swt.*;
 import org.eclipse.swt.internal.*;
+import org.eclipse.swt.internal.cairo.*;
 import org.eclipse.swt.internal.gtk.*;
 import org.eclipse.swt.graphics.Device;
+import org.eclipse.swt.graphics.Image;
 import org.eclipse.swt.graphics.Rectangle;
 import org.eclipse.swt.widgets.Shell;
 import org.eclipse.swt.widgets.Composite;
@@ -37,6 +39,12 @@ import java.awt.event.ComponentAdapter;
 import java.awt.event.ComponentEvent;
 import java.awt.event.ComponentListener;
 import java.awt.event.WindowEvent;
+import java.awt.image.BufferedImage;
+import java.awt.image.DataBuffer;
+import java.awt.image.DataBufferInt;
+import java.awt.image.SampleModel;
+import java.awt.image.SinglePixelPackedSampleModel;
+import java.awt.image.WritableRaster;
 
 
 /**
@@ -67,6 +75,7 @@ static boolean loaded, swingInitialized;
 
 static native final long /*int*/ getAWTHandle (Object canvas);
 static native final void setDebug (Frame canvas, boolean debug);
+static native final boolean copyPixels (long /*int*/ data, int stride, int[] pixels, int offset, int scanline, int width, int height, boolean toData);
 
 static synchronized void loadLibrary () {
 	if (loaded) return;
@@ -339,4 +348,92 @@ public static Shell new_Shell (final Display display, final Canvas parent) {
 	shell.setVisible (true);
 	return shell;
 }
+
+/**
+ * Copies the pixels of an AWT image into an SWT image of the same size
+ * with a single native copy, without converting them through
+ * <code>ImageData</code>.
+ * <p>
+ * The SWT image must keep its pixels in client memory, as the images
+ * created from <code>ImageData</code> do, and the AWT image must have
+ * the same layout: <code>TYPE_INT_ARGB_PRE</code> for an image with
+ * alpha and <code>TYPE_INT_RGB</code> for one without.  The copy is
+ * made while holding the lock of the AWT image, so an AWT thread that
+ * draws into it while holding the same lock is never copied halfway.
+ * </p>
+ * <p>
+ * Note: This operation is only implemented on GTK.  On the other
+ * platforms it always answers <code>false</code>, and the pixels
+ * must be converted through <code>ImageData</code>.
+ * </p>
+ *
+ * @param awtImage the AWT image to copy from
+ * @param image the SWT image to copy into
+ * @return <code>true</code> if the pixels were copied and <code>false</code>
+ * if the images do not share a layout
+ *
+ * @exception IllegalArgumentException <ul>
+ *    <li>ERROR_NULL_ARGUMENT - if either image is null</li>
+ *    <li>ERROR_INVALID_ARGUMENT - if the SWT image has been disposed</li>
+ * </ul>
+ *
+ * @since 3.103
+ */
+public static boolean copyPixels (BufferedImage awtImage, Image image) {
+	return copyPixels (awtImage, image, true);
+}
+
+/**
+ * Copies the pixels of an SWT image into an AWT image of the same size
+ * with a single native copy.  The images must have the layouts described
+ * in <code>copyPixels(BufferedImage, Image)</code>.
+ *
+ * @param image the SWT image to copy from
+ * @param awtImage the AWT image to copy into
+ * @return <code>true</code> if the pixels were copied and <code>false</code>
+ * if the images do not share a layout
+ *
+ * @exception IllegalArgumentException <ul>
+ *    <li>ERROR_NULL_ARGUMENT - if either image is null</li>
+ *    <li>ERROR_INVALID_ARGUMENT - if the SWT image has been disposed</li>
+ * </ul>
+ *
+ * @since 3.103
+ */
+public static boolean copyPixels (Image image, BufferedImage awtImage) {
+	return copyPixels (awtImage, image, false);
+}
+
+static boolean copyPixels (BufferedImage awtImage, Image image, boolean toImage) {
+	if (awtImage == null || image == null) SWT.error (SWT.ERROR_NULL_ARGUMENT);
+	if (image.isDisposed ()) SWT.error (SWT.ERROR_INVALID_ARGUMENT);
+	long /*int*/ surface = image.surface;
+	if (surface == 0) return false;
+	long /*int*/ data = Cairo.cairo_image_surface_get_data (surface);
+	if (data == 0) return false;
+	int width = Cairo.cairo_image_surface_get_width (surface);
+	int height = Cairo.cairo_image_surface_get_height (surface);
+	if (awtImage.getWidth () != width || awtImage.getHeight () != height) return false;
+	int type = Cairo.cairo_image_surface_get_format (surface) == Cairo.CAIRO_FORMAT_ARGB32 ? BufferedImage.TYPE_INT_ARGB_PRE : BufferedImage.TYPE_INT_RGB;
+	if (awtImage.getType () != type) return false;
+	WritableRaster raster = awtImage.getRaster ();
+	DataBuffer buffer = raster.getDataBuffer ();
+	SampleModel model = raster.getSampleModel ();
+	if (!(buffer instanceof DataBufferInt) || !(model instanceof SinglePixelPackedSampleModel)) return false;
+	int scanline = ((SinglePixelPackedSampleModel) model).getScanlineStride ();
+	int offset = buffer.getOffset () - raster.getSampleModelTranslateY () * scanline - raster.getSampleModelTranslateX ();
+	int stride = Cairo.cairo_image_surface_get_stride (surface);
+	synchronized (awtImage) {
+		int[] pixels = ((DataBufferInt) buffer).getData ();
+		try {
+			loadLibrary ();
+		} catch (Throwable e) {
+			SWT.error (SWT.ERROR_NOT_IMPLEMENTED, e);
+		}
+		if (!toImage) Cairo.cairo_surface_flush (surface);
+		if (!copyPixels (data, stride, pixels, offset, scanline, width, height, toImage)) return false;
+		if (toImage) Cairo.cairo_surface_mark_dirty (surface);
+	}
+	return true;
+}
 }
@@ -13,20 +13,36 @@
 
 #define SWT_AWT_NATIVE(func) Java_org_eclipse_swt_awt_SWT_1AWT_##func
 
+/*
+ * The JAWT function table does not change while the process runs, so it
+ * is looked up only once.
+ */
+static JAWT awt;
+static jboolean awtLoaded = JNI_FALSE;
+
+static JAWT *getAWT(JNIEnv *env)
+{
+	if (!awtLoaded) {
+		awt.version = JAWT_VERSION_1_3;
+		if (JAWT_GetAWT(env, &awt) == 0) return NULL;
+		awtLoaded = JNI_TRUE;
+	}
+	return &awt;
+}
+
 #ifndef NO_getAWTHandle
 JNIEXPORT jint JNICALL SWT_AWT_NATIVE(getAWTHandle)
 	(JNIEnv *env, jclass that, jobject canvas)
 {
-	JAWT awt;
+	JAWT* jawt;
 	JAWT_DrawingSurface* ds;
 	JAWT_DrawingSurfaceInfo* dsi;
 	JAWT_X11DrawingSurfaceInfo* dsi_x11;
 	jint result = 0;
 	jint lock;
 
-	awt.version = JAWT_VERSION_1_3;
-	if (JAWT_GetAWT(env, &awt) != 0) {
-		ds = awt.GetDrawingSurface(env, canvas);
+	if ((jawt = getAWT(env)) != NULL) {
+		ds = jawt->GetDrawingSurface(env, canvas);
 		if (ds != NULL) {
 			lock = ds->Lock(ds);
 		 	if ((lock & JAWT_LOCK_ERROR) == 0) {
@@ -36,8 +52,8 @@ JNIEXPORT jint JNICALL SWT_AWT_NATIVE(getAWTHandle)
 				ds->FreeDrawingSurfaceInfo(dsi);
 				ds->Unlock(ds);
 			}
+			jawt->FreeDrawingSurface(ds);
 		}
-		awt.FreeDrawingSurface(ds);
 	}
 	return result;
 }
@@ -47,15 +63,14 @@ JNIEXPORT jint JNICALL SWT_AWT_NATIVE(getAWTHandle)
 JNIEXPORT void JNICALL SWT_AWT_NATIVE(setDebug)
 	(JNIEnv *env, jclass that, jobject frame, jboolean debug)
 {
-	JAWT awt;
+	JAWT* jawt;
 	JAWT_DrawingSurface* ds;
 	JAWT_DrawingSurfaceInfo* dsi;
 	JAWT_X11DrawingSurfaceInfo* dsi_x11;
 	jint lock;
 
-	awt.version = JAWT_VERSION_1_3;
-	if (JAWT_GetAWT(env, &awt) != 0) {
-		ds = awt.GetDrawingSurface(env, frame);
+	if ((jawt = getAWT(env)) != NULL) {
+		ds = jawt->GetDrawingSurface(env, frame);
 		if (ds != NULL) {
 			lock = ds->Lock(ds);
 		 	if ((lock & JAWT_LOCK_ERROR) == 0) {
@@ -65,8 +80,8 @@ JNIEXPORT void JNICALL SWT_AWT_NATIVE(setDebug)
 				ds->FreeDrawingSurfaceInfo(dsi);
 				ds->Unlock(ds);
 			}
+			jawt->FreeDrawingSurface(ds);
 		}
-		awt.FreeDrawingSurface(ds);
 	}
 }
 #endif
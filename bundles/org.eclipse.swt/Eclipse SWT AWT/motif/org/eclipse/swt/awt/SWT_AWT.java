@@ -37,6 +37,8 @@ import java.awt.event.ComponentAdapter;
 import java.awt.event.ComponentEvent;
 import java.awt.event.ComponentListener;
 import java.awt.event.WindowEvent;
+import org.eclipse.swt.graphics.Image;
+import java.awt.image.BufferedImage;
 
 
 /**
@@ -322,4 +324,61 @@ public static Shell new_Shell (final Display display, final Canvas parent) {
 	shell.setVisible (true);
 	return shell;
 }
+
+/**
+ * Copies the pixels of an AWT image into an SWT image of the same size
+ * with a single native copy, without converting them through
+ * <code>ImageData</code>.
+ * <p>
+ * Note: This operation is only implemented on GTK.  On the other
+ * platforms it always answers <code>false</code>, and the pixels
+ * must be converted through <code>ImageData</code>.
+ * </p>
+ *
+ * @param awtImage the AWT image to copy from
+ * @param image the SWT image to copy into
+ * @return <code>true</code> if the pixels were copied and <code>false</code>
+ * if the images do not share a layout
+ *
+ * @exception IllegalArgumentException <ul>
+ *    <li>ERROR_NULL_ARGUMENT - if either image is null</li>
+ *    <li>ERROR_INVALID_ARGUMENT - if the SWT image has been disposed</li>
+ * </ul>
+ *
+ * @since 3.103
+ */
+public static boolean copyPixels (BufferedImage awtImage, Image image) {
+	return copyPixels (awtImage, image, true);
+}
+
+/**
+ * Copies the pixels of an SWT image into an AWT image of the same size
+ * with a single native copy.
+ * <p>
+ * Note: This operation is only implemented on GTK.  On the other
+ * platforms it always answers <code>false</code>, and the pixels
+ * must be converted through <code>ImageData</code>.
+ * </p>
+ *
+ * @param image the SWT image to copy from
+ * @param awtImage the AWT image to copy into
+ * @return <code>true</code> if the pixels were copied and <code>false</code>
+ * if the images do not share a layout
+ *
+ * @exception IllegalArgumentException <ul>
+ *    <li>ERROR_NULL_ARGUMENT - if either image is null</li>
+ *    <li>ERROR_INVALID_ARGUMENT - if the SWT image has been disposed</li>
+ * </ul>
+ *
+ * @since 3.103
+ */
+public static boolean copyPixels (Image image, BufferedImage awtImage) {
+	return copyPixels (awtImage, image, false);
+}
+
+static boolean copyPixels (BufferedImage awtImage, Image image, boolean toImage) {
+	if (awtImage == null || image == null) SWT.error (SWT.ERROR_NULL_ARGUMENT);
+	if (image.isDisposed ()) SWT.error (SWT.ERROR_INVALID_ARGUMENT);
+	return false;
+}
 }
@@ -28,6 +28,11 @@ class AccessibleObject {
 	AccessibleObject parent;
 	AccessibleObject[] children;
 	/*
+	* the ids reported by the last getChildren, a slot in children
+	* stays null until the child at the same index is first queried
+	*/
+	Object[] childIds;
+	/*
 	* a lightweight object does not correspond to a concrete gtk widget, but
 	* to a logical child of a widget (eg.- a CTabItem, which is simply drawn)
 	*/ 
@@ -3430,15 +3435,56 @@ class AccessibleObject {
 				AccessibleObject child = children[i];
 				if (child != null && child.id == childId) return child;
 			}
+			for (int i = 0; i < children.length; i++) {
+				Object child = childIds [i];
+				if (children [i] == null && child instanceof Integer && ((Integer)child).intValue() == childId) {
+					return getChildByIndex (i);
+				}
+			}
 		}
 		return null;
 	}
 	
 	AccessibleObject getChildByIndex (int childIndex) {
-		if (children != null && childIndex < children.length) return children [childIndex];
+		if (children != null && 0 <= childIndex && childIndex < children.length) {
+			if (children [childIndex] == null) {
+				children [childIndex] = createChild (childIds [childIndex], childIndex);
+			}
+			return children [childIndex];
+		}
 		return null;
 	}
 	
+	AccessibleObject createChild (Object child, int childIndex) {
+		AccessibleObject object = null;
+		if (child instanceof Integer) {
+			int id = ((Integer)child).intValue();
+			Vector listeners = accessible.accessibleControlListeners;
+			int length = size(listeners);
+			AccessibleControlEvent event = new AccessibleControlEvent (accessible);
+			event.childID = id;
+			for (int i = 0; i < length; i++) {
+				AccessibleControlListener listener = (AccessibleControlListener)listeners.elementAt (i);
+				listener.getChild (event);
+			}
+			if (event.accessible != null) {
+				object = event.accessible.getAccessibleObject();
+				if (object != null)	OS.g_object_ref(object.handle);
+			} else {
+				object = AccessibleFactory.createChildAccessible (accessible, id);
+			}
+			if (object != null) object.id = id;
+		} else if (child instanceof Accessible) {
+			object = ((Accessible)child).getAccessibleObject();
+			if (object != null)	OS.g_object_ref(object.handle);
+		}
+		if (object != null) {
+			object.index = childIndex;
+			object.parent = this;
+		}
+		return object;
+	}
+	
 	String getText () {
 		Vector listeners = accessible.accessibleControlListeners;
 		int length = size(listeners);
@@ -3582,6 +3628,8 @@ class AccessibleObject {
 
 	void release () {
 		if (DEBUG) print("AccessibleObject.release: " + handle);
+		/* Emit the queued events while the accessible can still answer them */
+		ATK.atk_event_queue_flush ();
 		accessible = null;
 		if (children != null) {
 			for (int i = 0; i < children.length; i++) {
@@ -3590,6 +3638,7 @@ class AccessibleObject {
 			}
 			children = null;
 		}
+		childIds = null;
 		// TODO remove from children from parent?
 		if (isLightweight) {
 			OS.g_object_unref(handle);
@@ -3601,16 +3650,28 @@ class AccessibleObject {
 	}
 	
 	void selectionChanged () {
-		OS.g_signal_emit_by_name (handle, ATK.selection_changed);
+		ATK.atk_event_queue_signal (handle, ATK.selection_changed);
 	}
 	
 	void sendEvent(int event, Object eventData) {
+		switch (event) {
+			case ACC.EVENT_DOCUMENT_LOAD_COMPLETE:
+			case ACC.EVENT_DOCUMENT_LOAD_STOPPED:
+			case ACC.EVENT_DOCUMENT_RELOAD:
+			case ACC.EVENT_HYPERLINK_ACTIVATED:
+			case ACC.EVENT_HYPERTEXT_LINK_SELECTED:
+			case ACC.EVENT_TABLE_CHANGED:
+			case ACC.EVENT_TEXT_CHANGED:
+				/* Keep these in order with the queued events */
+				ATK.atk_event_queue_flush ();
+				break;
+		}
 		switch (event) {
 			case ACC.EVENT_SELECTION_CHANGED:
-				OS.g_signal_emit_by_name (handle, ATK.selection_changed);
+				ATK.atk_event_queue_signal (handle, ATK.selection_changed);
 				break;
 			case ACC.EVENT_TEXT_SELECTION_CHANGED:
-				OS.g_signal_emit_by_name (handle, ATK.text_selection_changed);
+				ATK.atk_event_queue_signal (handle, ATK.text_selection_changed);
 				break;
 			case ACC.EVENT_STATE_CHANGED: {
 				if (!(eventData instanceof int[])) break;
@@ -3644,7 +3705,7 @@ class AccessibleObject {
 					case ACC.STATE_SUPPORTS_AUTOCOMPLETION: atkState = ATK.ATK_STATE_SUPPORTS_AUTOCOMPLETION; break;
 				}
 				if (atkState == -1) break;
-				ATK.atk_object_notify_state_change(handle, atkState, value != 0);
+				ATK.atk_event_queue_state (handle, atkState, value != 0);
 				break;
 			}
 			case ACC.EVENT_LOCATION_CHANGED: {
@@ -3663,17 +3724,17 @@ class AccessibleObject {
 					rect.width = e.width;
 					rect.height = e.height;
 				}
-				OS.g_signal_emit_by_name (handle, ATK.bounds_changed, rect);
+				ATK.atk_event_queue_bounds (handle, ATK.bounds_changed, rect.x, rect.y, rect.width, rect.height);
 				break;
 			}
 			case ACC.EVENT_NAME_CHANGED:
-				OS.g_object_notify(handle, ATK.accessible_name);
+				ATK.atk_event_queue_notify (handle, ATK.accessible_name);
 				break;
 			case ACC.EVENT_DESCRIPTION_CHANGED:
-				OS.g_object_notify(handle, ATK.accessible_description);
+				ATK.atk_event_queue_notify (handle, ATK.accessible_description);
 				break;
 			case ACC.EVENT_VALUE_CHANGED:
-				OS.g_object_notify(handle, ATK.accessible_value);
+				ATK.atk_event_queue_notify (handle, ATK.accessible_value);
 				break;
 			case ACC.EVENT_DOCUMENT_LOAD_COMPLETE:
 				OS.g_signal_emit_by_name (handle, ATK.load_complete);
@@ -3691,16 +3752,16 @@ class AccessibleObject {
 			case ACC.EVENT_ACTION_CHANGED:
 				break;
 			case ACC.EVENT_HYPERLINK_END_INDEX_CHANGED:
-				OS.g_object_notify(handle, ATK.end_index);
+				ATK.atk_event_queue_notify (handle, ATK.end_index);
 				break;
 			case ACC.EVENT_HYPERLINK_ANCHOR_COUNT_CHANGED:
-				OS.g_object_notify(handle, ATK.number_of_anchors);
+				ATK.atk_event_queue_notify (handle, ATK.number_of_anchors);
 				break;
 			case ACC.EVENT_HYPERLINK_SELECTED_LINK_CHANGED:
-				OS.g_object_notify(handle, ATK.selected_link);
+				ATK.atk_event_queue_notify (handle, ATK.selected_link);
 				break;
 			case ACC.EVENT_HYPERLINK_START_INDEX_CHANGED:
-				OS.g_object_notify(handle, ATK.start_index);
+				ATK.atk_event_queue_notify (handle, ATK.start_index);
 				break;
 			case ACC.EVENT_HYPERLINK_ACTIVATED:
 				OS.g_signal_emit_by_name (handle, ATK.link_activated);
@@ -3711,19 +3772,19 @@ class AccessibleObject {
 				OS.g_signal_emit_by_name (handle, ATK.link_selected, index);
 				break;
 			case ACC.EVENT_HYPERTEXT_LINK_COUNT_CHANGED:
-				OS.g_object_notify(handle, ATK.accessible_hypertext_nlinks);
+				ATK.atk_event_queue_notify (handle, ATK.accessible_hypertext_nlinks);
 				break;
 			case ACC.EVENT_ATTRIBUTE_CHANGED:
-				OS.g_signal_emit_by_name (handle, ATK.attributes_changed);
+				ATK.atk_event_queue_signal (handle, ATK.attributes_changed);
 				break;
 			case ACC.EVENT_TABLE_CAPTION_CHANGED:
-				OS.g_object_notify(handle, ATK.accessible_table_caption_object);
+				ATK.atk_event_queue_notify (handle, ATK.accessible_table_caption_object);
 				break;
 			case ACC.EVENT_TABLE_COLUMN_DESCRIPTION_CHANGED:
-				OS.g_object_notify(handle, ATK.accessible_table_column_description);
+				ATK.atk_event_queue_notify (handle, ATK.accessible_table_column_description);
 				break;
 			case ACC.EVENT_TABLE_COLUMN_HEADER_CHANGED:
-				OS.g_object_notify(handle, ATK.accessible_table_column_header);
+				ATK.atk_event_queue_notify (handle, ATK.accessible_table_column_header);
 				break;
 			case ACC.EVENT_TABLE_CHANGED: {
 				if (!(eventData instanceof int[])) break;
@@ -3746,16 +3807,16 @@ class AccessibleObject {
 				break;
 			}
 			case ACC.EVENT_TABLE_ROW_DESCRIPTION_CHANGED:
-				OS.g_object_notify(handle, ATK.accessible_table_row_description);
+				ATK.atk_event_queue_notify (handle, ATK.accessible_table_row_description);
 				break;
 			case ACC.EVENT_TABLE_ROW_HEADER_CHANGED:
-				OS.g_object_notify(handle, ATK.accessible_table_row_header);
+				ATK.atk_event_queue_notify (handle, ATK.accessible_table_row_header);
 				break;
 			case ACC.EVENT_TABLE_SUMMARY_CHANGED:
-				OS.g_object_notify(handle, ATK.accessible_table_summary);
+				ATK.atk_event_queue_notify (handle, ATK.accessible_table_summary);
 				break;
 			case ACC.EVENT_TEXT_ATTRIBUTE_CHANGED:
-				OS.g_signal_emit_by_name (handle, ATK.text_attributes_changed);
+				ATK.atk_event_queue_signal (handle, ATK.text_attributes_changed);
 				break;
 			case ACC.EVENT_TEXT_CARET_MOVED:
 			case ACC.EVENT_TEXT_COLUMN_CHANGED: {
@@ -3780,7 +3841,7 @@ class AccessibleObject {
 					}
 				}
 				offset = e.offset;
-				OS.g_signal_emit_by_name (handle, ATK.text_caret_moved, offset);
+				ATK.atk_event_queue_signal_int (handle, ATK.text_caret_moved, offset);
 				break;
 			}
 			case ACC.EVENT_TEXT_CHANGED: {
@@ -3814,16 +3875,18 @@ class AccessibleObject {
 		updateChildren ();
 		AccessibleObject accObject = getChildByID (childID);
 		if (accObject != null) {
+			ATK.atk_event_queue_flush ();
 			OS.g_signal_emit_by_name (accObject.handle, ATK.focus_event, 1, 0);
 			ATK.atk_object_notify_state_change(accObject.handle, ATK.ATK_STATE_FOCUSED, true);
 		}
 	}
 	
 	void textCaretMoved(int index) {
-		OS.g_signal_emit_by_name (handle, ATK.text_caret_moved, index);
+		ATK.atk_event_queue_signal_int (handle, ATK.text_caret_moved, index);
 	}
 
 	void textChanged(int type, int startIndex, int length) {
+		ATK.atk_event_queue_flush ();
 		if (type == ACC.TEXT_DELETE) {
 			OS.g_signal_emit_by_name (handle, ATK.text_changed_delete, startIndex, length);
 		} else {
@@ -3832,9 +3895,16 @@ class AccessibleObject {
 	}
 
 	void textSelectionChanged() {
-		OS.g_signal_emit_by_name (handle, ATK.text_selection_changed);
+		ATK.atk_event_queue_signal (handle, ATK.text_selection_changed);
 	}
 	
+	/*
+	* Only the ids are fetched here. The child objects are created on
+	* demand by getChildByIndex() and getChildByID(), so that an assistive
+	* technology walking a large tree or table only pays for the rows it
+	* actually queries. Children that kept their id at the same index are
+	* carried over, every other materialized child is released.
+	*/
 	void updateChildren () {
 		Vector listeners = accessible.accessibleControlListeners;
 		int length = size(listeners);
@@ -3850,36 +3920,16 @@ class AccessibleObject {
 		AccessibleObject[] newChildren = new AccessibleObject[count];
 		for (int i = 0; i < count; i++) {
 			Object child = children [i];
-			AccessibleObject object = null;
+			AccessibleObject object = oldChildren != null && i < oldChildren.length ? oldChildren [i] : null;
+			if (object == null) continue;
 			if (child instanceof Integer) {
-				int id = ((Integer)child).intValue();
-				object = oldChildren != null && i < oldChildren.length ? oldChildren [i] : null;
-				if (object == null || object.id != id) {
-					event = new AccessibleControlEvent (accessible);
-					event.childID = id;
-					for (int j = 0; j < length; j++) {
-						AccessibleControlListener listener = (AccessibleControlListener)listeners.elementAt (j);
-						listener.getChild (event);
-					}
-					if (event.accessible != null) {
-						object = event.accessible.getAccessibleObject();
-						if (object != null)	OS.g_object_ref(object.handle);
-					} else {
-						object = AccessibleFactory.createChildAccessible (accessible, id);
-					}
-					object.id = id;
-				} else {
-					OS.g_object_ref(object.handle);
-				}
-			} else if (child instanceof Accessible) {
-				object = ((Accessible)child).getAccessibleObject();
-				if (object != null)	OS.g_object_ref(object.handle);
-			}
-			if (object != null) {
-				object.index = i;
-				object.parent = this;
-				newChildren[i] = object;
+				if (object.id != ((Integer)child).intValue()) continue;
+			} else if (!(child instanceof Accessible) || ((Accessible)child).getAccessibleObject() != object) {
+				continue;
 			}
+			/* Transfer the reference held by the old array */
+			oldChildren [i] = null;
+			newChildren [i] = object;
 		}
 		if (oldChildren != null) {
 			for (int i = 0; i < oldChildren.length; i++) {
@@ -3887,6 +3937,7 @@ class AccessibleObject {
 				if (object != null) OS.g_object_unref(object.handle);
 			}
 		}
+		this.childIds = count != 0 ? children : null;
 		this.children = newChildren;
 	}
 
@@ -57,6 +57,7 @@ public class Accessible {
 		objIAccessibleHypertext, /*objIAccessibleImage,*/ objIAccessibleTable2, objIAccessibleTableCell,
 		objIAccessibleText, objIAccessibleValue; /* objIAccessibleRelation is defined in Relation class */
 	IAccessible iaccessible;
+	IEnumVARIANT ienumvariant;
 	Vector accessibleListeners, accessibleControlListeners, accessibleTextListeners, accessibleActionListeners,
 		accessibleEditableTextListeners, accessibleHyperlinkListeners, accessibleTableListeners, accessibleTableCellListeners,
 		accessibleTextExtendedListeners, accessibleValueListeners, accessibleAttributeListeners;
@@ -889,6 +890,10 @@ public class Accessible {
 			iaccessible.Release();
 		}
 		iaccessible = null;
+		if (ienumvariant != null) {
+			ienumvariant.Release();
+		}
+		ienumvariant = null;
 		Release();
 		for (int i = 0; i < children.size(); i++) {
 			Accessible child = (Accessible) children.elementAt(i);
@@ -2785,13 +2790,10 @@ public class Accessible {
 		 * its IEnumVariant, and get the Next items from it.
 		 */
 		if (iaccessible != null && accessibleControlListenersSize() == 0) {
-			long /*int*/[] ppvObject = new long /*int*/[1];
-			int code = iaccessible.QueryInterface(COM.IIDIEnumVARIANT, ppvObject);
+			int code = getProxyEnumVARIANT();
 			if (code != COM.S_OK) return code;
-			IEnumVARIANT ienumvariant = new IEnumVARIANT(ppvObject[0]);
 			int[] celtFetched = new int[1];
 			code = ienumvariant.Next(celt, rgvar, celtFetched);
-			ienumvariant.Release();
 			COM.MoveMemory(pceltFetched, celtFetched, 4);
 			return code;
 		}
@@ -2825,17 +2827,22 @@ public class Accessible {
 			}
 		}
 		if (nextItems != null) {
+			/* Fill the VARIANTs in one call instead of two MoveMemory calls each */
+			short[] types = new short[nextItems.length];
+			long /*int*/[] values = new long /*int*/[nextItems.length];
 			for (int i = 0; i < nextItems.length; i++) {
 				Object nextItem = nextItems[i];
 				if (nextItem instanceof Integer) {
-					int item = ((Integer) nextItem).intValue();
-					setIntVARIANT(rgvar + i * VARIANT.sizeof, COM.VT_I4, item);
+					types[i] = COM.VT_I4;
+					values[i] = ((Integer) nextItem).intValue();
 				} else {
 					Accessible accessible = (Accessible) nextItem;
 					accessible.AddRef();
-					setPtrVARIANT(rgvar + i * VARIANT.sizeof, COM.VT_DISPATCH, accessible.getAddress());
+					types[i] = COM.VT_DISPATCH;
+					values[i] = accessible.getAddress();
 				}
 			}
+			COM.SetVARIANTs(rgvar, types, values, nextItems.length);
 			if (pceltFetched != 0)
 				COM.MoveMemory(pceltFetched, new int[] {nextItems.length}, 4);
 			if (nextItems.length == celt) return COM.S_OK;
@@ -2846,6 +2853,21 @@ public class Accessible {
 		return COM.S_FALSE;
 	}
 
+	/*
+	 * Queries the proxy for its IEnumVARIANT once and keeps it, instead of
+	 * on every Next, Skip and Reset while a screen reader walks the children.
+	 * The proxy enumerator follows the children of the control itself, so
+	 * it stays valid until the receiver is disposed.
+	 */
+	int getProxyEnumVARIANT() {
+		if (ienumvariant != null) return COM.S_OK;
+		long /*int*/[] ppvObject = new long /*int*/[1];
+		int code = (int)/*64*/iaccessible.QueryInterface(COM.IIDIEnumVARIANT, ppvObject);
+		if (code != COM.S_OK) return code;
+		ienumvariant = new IEnumVARIANT(ppvObject[0]);
+		return COM.S_OK;
+	}
+
 	/* IEnumVARIANT::Skip([in] celt) over the specified number of elements in the enumeration sequence. */
 	int Skip(int celt) {
 		if (DEBUG) print(this + ".IEnumVARIANT::Skip");
@@ -2853,13 +2875,9 @@ public class Accessible {
 		 * for its IEnumVariant, and tell it to Skip.
 		 */
 		if (iaccessible != null && accessibleControlListenersSize() == 0) {
-			long /*int*/[] ppvObject = new long /*int*/[1];
-			int code = iaccessible.QueryInterface(COM.IIDIEnumVARIANT, ppvObject);
+			int code = getProxyEnumVARIANT();
 			if (code != COM.S_OK) return code;
-			IEnumVARIANT ienumvariant = new IEnumVARIANT(ppvObject[0]);
-			code = ienumvariant.Skip(celt);
-			ienumvariant.Release();
-			return code;
+			return ienumvariant.Skip(celt);
 		}
 
 		if (celt < 1 ) return COM.E_INVALIDARG;
@@ -2878,13 +2896,9 @@ public class Accessible {
 		 * for its IEnumVariant, and tell it to Reset.
 		 */
 		if (iaccessible != null && accessibleControlListenersSize() == 0) {
-			long /*int*/[] ppvObject = new long /*int*/[1];
-			int code = (int)/*64*/iaccessible.QueryInterface(COM.IIDIEnumVARIANT, ppvObject);
+			int code = getProxyEnumVARIANT();
 			if (code != COM.S_OK) return code;
-			IEnumVARIANT ienumvariant = new IEnumVARIANT(ppvObject[0]);
-			code = ienumvariant.Reset();
-			ienumvariant.Release();
-			return code;
+			return ienumvariant.Reset();
 		}
 		
 		enumIndex = 0;
@@ -2901,13 +2915,10 @@ public class Accessible {
 		 * its IEnumVariant, and get the Clone from it.
 		 */
 		if (iaccessible != null && accessibleControlListenersSize() == 0) {
-			long /*int*/[] ppvObject = new long /*int*/[1];
-			int code = iaccessible.QueryInterface(COM.IIDIEnumVARIANT, ppvObject);
+			int code = getProxyEnumVARIANT();
 			if (code != COM.S_OK) return code;
-			IEnumVARIANT ienumvariant = new IEnumVARIANT(ppvObject[0]);
 			long /*int*/ [] pEnum = new long /*int*/ [1];
 			code = ienumvariant.Clone(pEnum);
-			ienumvariant.Release();
 			COM.MoveMemory(ppEnum, pEnum, OS.PTR_SIZEOF);
 			return code;
 		}
@@ -48,10 +48,13 @@ public class Browser extends Composite {
 	boolean isClosing;
 
 	static int DefaultType = SWT.DEFAULT;
+	static boolean CreatingSpare;
 
 	static final String NO_INPUT_METHOD = "org.eclipse.swt.internal.gtk.noInputMethod"; //$NON-NLS-1$
 	static final String PACKAGE_PREFIX = "org.eclipse.swt.browser."; //$NON-NLS-1$
 	static final String PROPERTY_DEFAULTTYPE = "org.eclipse.swt.browser.DefaultType"; //$NON-NLS-1$
+	static final String PROPERTY_POOL = "org.eclipse.swt.browser.Pool"; //$NON-NLS-1$
+	static final String SPARE_BROWSER = "org.eclipse.swt.browser.Browser.spare"; //$NON-NLS-1$
 
 /**
  * Constructs a new instance of this class given its parent
@@ -93,16 +96,67 @@ public Browser (Composite parent, int style) {
 	}
 
 	style = getStyle ();
+	boolean pool = !CreatingSpare && Boolean.getBoolean (PROPERTY_POOL);
+	if (pool && takeSpare (parent.getDisplay ())) {
+		createSpare (parent.getDisplay ());
+		return;
+	}
 	webBrowser = new BrowserFactory ().createWebBrowser (style);
 	if (webBrowser != null) {
 		webBrowser.setBrowser (this);
 		webBrowser.create (parent, style);
+		if (pool && webBrowser.isMovable ()) createSpare (parent.getDisplay ());
 		return;
 	}
 	dispose ();
 	SWT.error (SWT.ERROR_NO_HANDLES);
 }
 
+/*
+* When the org.eclipse.swt.browser.Pool java system property is "true",
+* a spare Browser is created in a hidden shell once the current event has
+* been handled, and the next Browser created with the same style takes
+* over its native browser instead of starting a new one.  Spares are only
+* created for engines that can move their native browser into another
+* Browser.
+*/
+void createSpare (final Display display) {
+	if (display.getData (SPARE_BROWSER) != null) return;
+	final int style = userStyle;
+	display.asyncExec (new Runnable () {
+		public void run () {
+			if (display.isDisposed () || display.getData (SPARE_BROWSER) != null) return;
+			Shell shell = new Shell (display);
+			CreatingSpare = true;
+			try {
+				display.setData (SPARE_BROWSER, new Browser (shell, style));
+			} catch (SWTError e) {
+				shell.dispose ();
+			} finally {
+				CreatingSpare = false;
+			}
+		}
+	});
+}
+
+boolean takeSpare (Display display) {
+	Browser spare = (Browser)display.getData (SPARE_BROWSER);
+	if (spare == null) return false;
+	display.setData (SPARE_BROWSER, null);
+	if (spare.isDisposed ()) return false;
+	Shell shell = spare.getShell ();
+	boolean result = false;
+	if (spare.userStyle == userStyle && spare.webBrowser != null) {
+		WebBrowser webBrowser = spare.webBrowser;
+		if (webBrowser.moveTo (this)) {
+			this.webBrowser = webBrowser;
+			result = true;
+		}
+	}
+	shell.dispose ();
+	return result;
+}
+
 static Composite checkParent (Composite parent) {
 	String platform = SWT.getPlatform ();
 	if (!"gtk".equals (platform)) return parent; //$NON-NLS-1$
@@ -325,6 +379,13 @@ public void addCloseWindowListener (CloseWindowListener listener) {
 	webBrowser.addCloseWindowListener (listener);
 }
 
+@Override
+public void addListener (int eventType, Listener listener) {
+	super.addListener (eventType, listener);
+	/* Let the web browser hook the native events it only hooks for listeners */
+	if (webBrowser != null) webBrowser.hookListener (eventType);
+}
+
 /**	 
  * Adds the listener to the collection of listeners who will be
  * notified when the current location has changed or is about to change.
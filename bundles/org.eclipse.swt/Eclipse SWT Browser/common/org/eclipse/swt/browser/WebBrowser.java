@@ -461,6 +461,18 @@ public Object getWebBrowser () {
 	return null;
 }
 
+void hookListener (int eventType) {
+}
+
+boolean isMovable () {
+	return false;
+}
+
+/* Moves the native browser into browser, which takes it over from the Browser that created it */
+boolean moveTo (Browser browser) {
+	return false;
+}
+
 public abstract boolean isBackEnabled ();
 
 public boolean isFocusControl () {
@@ -11,6 +11,8 @@
 package org.eclipse.swt.browser;
 
 import java.net.*;
+import java.nio.*;
+import java.nio.charset.*;
 import java.util.*;
 
 import org.eclipse.swt.*;
@@ -28,6 +30,7 @@ class IE extends WebBrowser {
 	WebSite site;
 	OleAutomation auto;
 	OleListener domListener;
+	Listener listener;
 	OleAutomation[] documents = new OleAutomation[0];
 
 	boolean back, forward, delaySetText, ignoreDispose, ignoreTraverse, performingInitialNavigate;
@@ -340,7 +343,7 @@ public void create(Composite parent, int style) {
 		}
 	};
 
-	Listener listener = new Listener() {
+	listener = new Listener() {
 		public void handleEvent(Event e) {
 			switch (e.type) {
 				case SWT.Dispose: {
@@ -1245,10 +1248,37 @@ public boolean isForwardEnabled() {
 	return forward;
 }
 
+boolean isMovable() {
+	return true;
+}
+
 public boolean isFocusControl () {
 	return site.isFocusControl() || frame.isFocusControl();
 }
 
+/*
+* Moves the OLE frame, and with it the web browser control, from the pooled
+* Browser that created it into browser.  The WebSite finds its Browser
+* through its parents, so only the listeners hooked on the Browser itself
+* need to be moved.
+*/
+boolean moveTo(Browser browser) {
+	Browser oldBrowser = this.browser;
+	if (!frame.setParent(browser)) return false;
+	oldBrowser.removeListener(SWT.Dispose, listener);
+	oldBrowser.removeListener(SWT.FocusIn, listener);
+	oldBrowser.removeListener(SWT.Resize, listener);
+	oldBrowser.removeListener(SWT.Traverse, listener);
+	oldBrowser.webBrowser = null;
+	setBrowser(browser);
+	browser.addListener(SWT.Dispose, listener);
+	browser.addListener(SWT.FocusIn, listener);
+	browser.addListener(SWT.Resize, listener);
+	browser.addListener(SWT.Traverse, listener);
+	frame.setBounds(browser.getClientArea());
+	return true;
+}
+
 boolean navigate(String url, String postData, String headers[], boolean silent) {
 	int count = 1;
 	if (postData != null) count++;
@@ -1332,10 +1362,6 @@ public void refresh() {
 }
 
 void setHTML (String string) {
-	int charCount = string.length();
-	char[] chars = new char[charCount];
-	string.getChars(0, charCount, chars, 0);
-	int byteCount = OS.WideCharToMultiByte(OS.CP_UTF8, 0, chars, charCount, null, 0, null, null);
 	/*
 	* Internet Explorer appears to treat the data loaded with 
 	* nsIPersistStreamInit.Load as if it were encoded using the default
@@ -1344,36 +1370,34 @@ void setHTML (String string) {
 	* prepend the UTF-8 Byte Order Mark signature to the data.
 	*/
 	byte[] UTF8BOM = {(byte)0xEF, (byte)0xBB, (byte)0xBF};
-	long /*int*/ hGlobal = OS.GlobalAlloc(OS.GMEM_FIXED | OS.GMEM_ZEROINIT, UTF8BOM.length + byteCount);
-	if (hGlobal != 0) {
-		OS.MoveMemory(hGlobal, UTF8BOM, UTF8BOM.length);
-		OS.WideCharToMultiByte(OS.CP_UTF8, 0, chars, charCount, hGlobal + UTF8BOM.length, byteCount, null, null);							
-		long /*int*/ [] ppstm = new long /*int*/ [1];
-		/* 
-		* CreateStreamOnHGlobal is called with the flag fDeleteOnRelease.
-		* If the call succeeds the buffer hGlobal is freed automatically
-		* when the IStream object is released. If the call fails, free the
-		* buffer hGlobal.
-		*/
-		if (OS.CreateStreamOnHGlobal(hGlobal, true, ppstm) == OS.S_OK) {
-			int[] rgdispid = auto.getIDsOfNames(new String[] {PROPERTY_DOCUMENT});
-			Variant pVarResult = auto.getProperty(rgdispid[0]);
-			IDispatch dispatchDocument = pVarResult.getDispatch();
-			long /*int*/ [] ppvObject = new long /*int*/ [1];
-			int result = dispatchDocument.QueryInterface(COM.IIDIPersistStreamInit, ppvObject);
-			if (result == OS.S_OK) {
-				IPersistStreamInit persistStreamInit = new IPersistStreamInit(ppvObject[0]);
-				if (persistStreamInit.InitNew() == OS.S_OK) {
-					persistStreamInit.Load(ppstm[0]);
-				}
-				persistStreamInit.Release();
+	CharsetEncoder encoder = Charset.forName ("UTF-8").newEncoder (); //$NON-NLS-1$
+	encoder.onMalformedInput (CodingErrorAction.REPLACE);
+	encoder.onUnmappableCharacter (CodingErrorAction.REPLACE);
+	ByteBuffer buffer = ByteBuffer.allocateDirect (UTF8BOM.length + (int)(string.length () * encoder.maxBytesPerChar ()));
+	buffer.put (UTF8BOM);
+	encoder.encode (CharBuffer.wrap (string), buffer, true);
+	encoder.flush (buffer);
+	/* 
+	* The stream reads the encoded data in place and keeps the buffer
+	* alive until it is released, including by Internet Explorer.
+	*/
+	long /*int*/ pStream = COM.CreateStreamOnBuffer (buffer, buffer.position (), true);
+	if (pStream != 0) {
+		int[] rgdispid = auto.getIDsOfNames(new String[] {PROPERTY_DOCUMENT});
+		Variant pVarResult = auto.getProperty(rgdispid[0]);
+		IDispatch dispatchDocument = pVarResult.getDispatch();
+		long /*int*/ [] ppvObject = new long /*int*/ [1];
+		int result = dispatchDocument.QueryInterface(COM.IIDIPersistStreamInit, ppvObject);
+		if (result == OS.S_OK) {
+			IPersistStreamInit persistStreamInit = new IPersistStreamInit(ppvObject[0]);
+			if (persistStreamInit.InitNew() == OS.S_OK) {
+				persistStreamInit.Load(pStream);
 			}
-			pVarResult.dispose();
-			IUnknown stream = new IUnknown(ppstm[0]);
-			stream.Release();
-		} else {
-			OS.GlobalFree(hGlobal);
+			persistStreamInit.Release();
 		}
+		pVarResult.dispose();
+		IUnknown stream = new IUnknown(pStream);
+		stream.Release();
 	}
 }
 
@@ -11,11 +11,14 @@
 package org.eclipse.swt.dnd;
 
 
+import java.nio.ByteBuffer;
+
 import org.eclipse.swt.*;
+import org.eclipse.swt.internal.Callback;
 import org.eclipse.swt.internal.Converter;
 import org.eclipse.swt.internal.gtk.GtkSelectionData;
 import org.eclipse.swt.internal.gtk.OS;
-import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.*;
 
 /**
  * The <code>Clipboard</code> provides a mechanism for transferring data from one
@@ -36,7 +39,22 @@ public class Clipboard {
 	static long /*int*/ GTKPRIMARYCLIPBOARD;
 	private static long /*int*/ TARGET;
 	
+	/* The pending requests of gtk_request_contents() and gtk_request_data(), indexed by user_data - 1 */
+	static Request[] requests = new Request[4];
+	static Callback RequestContents;
+	
+	static class Request {
+		Clipboard clipboard;
+		Transfer transfer;
+		Listener listener;
+		long /*int*/[] clipboardHandles;
+		int[] typeIds;
+		int next;
+	}
+	
 	static {
+		RequestContents = new Callback(Clipboard.class, "RequestContents", 3); //$NON-NLS-1$
+		if (RequestContents.getAddress() == 0) SWT.error(SWT.ERROR_NO_MORE_CALLBACKS);
 		GTKCLIPBOARD = OS.gtk_clipboard_get(OS.GDK_NONE);
 		byte[] buffer = Converter.wcsToMbcs(null, "PRIMARY", true);
 		long /*int*/ primary = OS.gdk_atom_intern(buffer, false);
@@ -313,6 +331,13 @@ public Object getContents(Transfer transfer, int clipboards) {
 		}
 	}
 	if (selection_data == 0) return null;
+	TransferData tdata = getTransferData(selection_data);
+	Object result = transfer.nativeToJava(tdata);
+	OS.gtk_selection_data_free(selection_data);
+	return result;
+}
+
+TransferData getTransferData(long /*int*/ selection_data) {
 	TransferData tdata = new TransferData();
 	if (OS.GTK_VERSION >= OS.VERSION(2, 14, 0)) {
 		tdata.type = OS.gtk_selection_data_get_data_type(selection_data);
@@ -327,9 +352,135 @@ public Object getContents(Transfer transfer, int clipboards) {
 		tdata.length = gtkSelectionData.length;
 		tdata.format = gtkSelectionData.format;
 	}
-	Object result = transfer.nativeToJava(tdata);
-	OS.gtk_selection_data_free(selection_data);
-	return result;
+	return tdata;
+}
+
+/**
+ * Requests the data of the specified type from the specified clipboards
+ * without waiting for the owner of the selection, and notifies the listener
+ * from the event loop once the data has arrived.  The data is converted by
+ * the transfer and passed in <code>event.data</code>, which is
+ * <code>null</code> when no data of this type is available.  The types and
+ * clipboards are tried in the same order as
+ * <code>getContents(Transfer, int)</code>.  The listener is not notified
+ * when the clipboard is disposed before the data arrives.
+ * <p>
+ * <b>IMPORTANT:</b> This method is <em>not</em> part of the public
+ * API for <code>Clipboard</code>. It is marked public only so that it
+ * can be shared within the packages provided by SWT. It is not
+ * available on all platforms, and should never be called from
+ * application code.
+ * </p>
+ *
+ * @noreference This method is not intended to be referenced by clients.
+ */
+public void gtk_request_contents(Transfer transfer, int clipboards, Listener listener) {
+	checkWidget();
+	if (transfer == null || listener == null) DND.error(SWT.ERROR_NULL_ARGUMENT);
+	request(transfer, transfer.getTypeIds(), clipboards, listener);
+}
+
+/**
+ * Requests the data of the specified type from the specified clipboards
+ * the same way as <code>gtk_request_contents(Transfer, int, Listener)</code>,
+ * but passes the bytes of the selection unconverted in <code>event.data</code>
+ * as a read only direct <code>ByteBuffer</code> over the native data, along
+ * with the format in <code>event.detail</code>.  The buffer is only valid
+ * while the listener runs.
+ * <p>
+ * <b>IMPORTANT:</b> This method is <em>not</em> part of the public
+ * API for <code>Clipboard</code>. It is marked public only so that it
+ * can be shared within the packages provided by SWT. It is not
+ * available on all platforms, and should never be called from
+ * application code.
+ * </p>
+ *
+ * @noreference This method is not intended to be referenced by clients.
+ */
+public void gtk_request_data(int typeId, int clipboards, Listener listener) {
+	checkWidget();
+	if (listener == null) DND.error(SWT.ERROR_NULL_ARGUMENT);
+	request(null, new int[] {typeId}, clipboards, listener);
+}
+
+void request(Transfer transfer, int[] typeIds, int clipboards, Listener listener) {
+	int count = 0;
+	if ((clipboards & DND.CLIPBOARD) != 0) count++;
+	if ((clipboards & DND.SELECTION_CLIPBOARD) != 0) count++;
+	Request request = new Request();
+	request.clipboard = this;
+	request.transfer = transfer;
+	request.listener = listener;
+	request.clipboardHandles = new long /*int*/[typeIds.length * count];
+	request.typeIds = new int[typeIds.length * count];
+	int index = 0;
+	for (int i = 0; i < typeIds.length; i++) {
+		if ((clipboards & DND.CLIPBOARD) != 0) {
+			request.clipboardHandles[index] = GTKCLIPBOARD;
+			request.typeIds[index++] = typeIds[i];
+		}
+		if ((clipboards & DND.SELECTION_CLIPBOARD) != 0) {
+			request.clipboardHandles[index] = GTKPRIMARYCLIPBOARD;
+			request.typeIds[index++] = typeIds[i];
+		}
+	}
+	int id = 0;
+	while (id < requests.length && requests[id] != null) id++;
+	if (id == requests.length) {
+		Request[] newRequests = new Request[requests.length + 4];
+		System.arraycopy(requests, 0, newRequests, 0, requests.length);
+		requests = newRequests;
+	}
+	requests[id] = request;
+	if (!requestNext(id + 1)) complete(id + 1, 0);
+}
+
+boolean requestNext(long /*int*/ id) {
+	Request request = requests[(int)/*64*/id - 1];
+	if (request.next == request.typeIds.length) return false;
+	int index = request.next++;
+	OS.gtk_clipboard_request_contents(request.clipboardHandles[index], request.typeIds[index], RequestContents.getAddress(), id);
+	return true;
+}
+
+static long /*int*/ RequestContents(long /*int*/ clipboard, long /*int*/ selection_data, long /*int*/ user_data) {
+	int index = (int)/*64*/user_data - 1;
+	if (!(0 <= index && index < requests.length)) return 0;
+	Request request = requests[index];
+	if (request == null) return 0;
+	Clipboard receiver = request.clipboard;
+	if (receiver.isDisposed() || receiver.display.isDisposed()) {
+		requests[index] = null;
+		return 0;
+	}
+	/* Like gtk_clipboard_wait_for_contents(), a negative length means the owner failed to convert */
+	if (selection_data != 0 && receiver.getTransferData(selection_data).length >= 0) {
+		receiver.complete(user_data, selection_data);
+	} else if (!receiver.requestNext(user_data)) {
+		receiver.complete(user_data, 0);
+	}
+	return 0;
+}
+
+void complete(long /*int*/ id, long /*int*/ selection_data) {
+	int index = (int)/*64*/id - 1;
+	Request request = requests[index];
+	requests[index] = null;
+	Event event = new Event();
+	event.display = display;
+	if (selection_data != 0) {
+		TransferData tdata = getTransferData(selection_data);
+		if (request.transfer != null) {
+			event.data = request.transfer.nativeToJava(tdata);
+		} else {
+			ByteBuffer buffer = null;
+			if (tdata.pValue != 0) buffer = OS.NewDirectByteBuffer(tdata.pValue, tdata.length);
+			if (buffer == null) buffer = ByteBuffer.allocate(0);
+			event.data = buffer.asReadOnlyBuffer();
+			event.detail = tdata.format;
+		}
+	}
+	request.listener.handleEvent(event);
 }
 
 /**
@@ -134,65 +134,24 @@ public void javaToNative(Object object, TransferData transferData) {
 @Override
 public Object nativeToJava(TransferData transferData) {
 	if ( !isSupportedType(transferData) ||  transferData.pValue == 0 ||  transferData.length <= 0 ) return null;
-	int length = transferData.length;
-	byte[] temp = new byte[length];
-	OS.memmove(temp, transferData.pValue, length);
 	boolean gnomeList = transferData.type == GNOME_LIST_ID;
-	int sepLength = gnomeList ? 1 : 2;
-	long /*int*/[] files = new long /*int*/[0];
-	int offset = 0;
-	for (int i = 0; i < temp.length - 1; i++) {
-		boolean terminator = gnomeList ? temp[i] == '\n' : temp[i] == '\r' && temp[i+1] == '\n';
-		if (terminator) {
-			if (!(gnomeList && offset == 0)) {
-				/* The content of the first line in a gnome-list is always either 'copy' or 'cut' */
-				int size =  i - offset;
-				long /*int*/ file = OS.g_malloc(size + 1);
-				byte[] fileBuffer = new byte[size + 1];
-				System.arraycopy(temp, offset, fileBuffer, 0, size);
-				OS.memmove(file, fileBuffer, size + 1);
-				long /*int*/[] newFiles = new long /*int*/[files.length + 1];
-				System.arraycopy(files, 0, newFiles, 0, files.length);
-				newFiles[files.length] = file;
-				files = newFiles;
-			}
-			offset = i + sepLength;
-		}
-	}
-	if (offset < temp.length - sepLength) {
-		int size =  temp.length - offset;
-		long /*int*/ file = OS.g_malloc(size + 1);
-		byte[] fileBuffer = new byte[size + 1];
-		System.arraycopy(temp, offset, fileBuffer, 0, size);
-		OS.memmove(file, fileBuffer, size + 1);
-		long /*int*/[] newFiles = new long /*int*/[files.length + 1];
-		System.arraycopy(files, 0, newFiles, 0, files.length);
-		newFiles[files.length] = file;
-		files = newFiles;
+	int[] length = new int[1];
+	long /*int*/ utf16Ptr = OS.swt_uri_list_to_utf16(transferData.pValue, transferData.length, gnomeList, length);
+	if (utf16Ptr == 0) return null;
+	char[] buffer = new char[length[0]];
+	OS.memmove(buffer, utf16Ptr, length[0] * 2);
+	OS.g_free(utf16Ptr);
+	/* The names are each followed by a null character */
+	int count = 0;
+	for (int i = 0; i < buffer.length; i++) {
+		if (buffer[i] == 0) count++;
 	}
-	String[] fileNames = new String[0];
-	for (int i = 0; i < files.length; i++) {
-		long /*int*/[] error = new long /*int*/[1];
-		long /*int*/ localePtr = OS.g_filename_from_uri(files[i], null, error);
-		OS.g_free(files[i]);
-		if (error[0] != 0 || localePtr == 0) continue;
-		long /*int*/ utf8Ptr = OS.g_filename_to_utf8(localePtr, -1, null, null, null);
-		if (utf8Ptr == 0) utf8Ptr = OS.g_filename_display_name (localePtr);
-		if (localePtr != utf8Ptr) OS.g_free (localePtr);
-		if (utf8Ptr == 0) continue;
-		long /*int*/[] items_written = new long /*int*/[1];
-		long /*int*/ utf16Ptr = OS.g_utf8_to_utf16(utf8Ptr, -1, null, items_written, null);
-		OS.g_free(utf8Ptr);
-		if (utf16Ptr == 0) continue;
-		length = (int)/*64*/items_written[0];
-		char[] buffer = new char[length];
-		OS.memmove(buffer, utf16Ptr, length * 2);
-		OS.g_free(utf16Ptr);
-		String name = new String(buffer);
-		String[] newFileNames = new String[fileNames.length + 1];
-		System.arraycopy(fileNames, 0, newFileNames, 0, fileNames.length);
-		newFileNames[fileNames.length] = name;
-		fileNames = newFileNames;
+	String[] fileNames = new String[count];
+	for (int i = 0, offset = 0, index = 0; i < buffer.length; i++) {
+		if (buffer[i] == 0) {
+			fileNames[index++] = new String(buffer, offset, i - offset);
+			offset = i + 1;
+		}
 	}
 	if (fileNames.length == 0) return null;
 	return fileNames;
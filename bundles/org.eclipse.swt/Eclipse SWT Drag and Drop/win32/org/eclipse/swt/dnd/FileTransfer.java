@@ -120,16 +120,33 @@ public Object nativeToJava(TransferData transferData) {
 	transferData.result = getData(dataObject, formatetc, stgmedium);
 	dataObject.Release();
 	if (transferData.result != COM.S_OK) return null;
-	// How many files are there?
-	int count = OS.DragQueryFile(stgmedium.unionField, 0xFFFFFFFF, null, 0);
-	String[] fileNames = new String[count];
-	for (int i = 0; i < count; i++) {
-		// How long is the name ?
-		int size = OS.DragQueryFile(stgmedium.unionField, i, null, 0) + 1;
-		TCHAR lpszFile = new TCHAR(0, size);	
-		// Get file name and append it to string
-		OS.DragQueryFile(stgmedium.unionField, i, lpszFile, size);
-		fileNames[i] = lpszFile.toString(0, lpszFile.strlen());
+	String[] fileNames;
+	String files = OS.DragQueryFiles(stgmedium.unionField);
+	if (files != null) {
+		// Each name is null terminated
+		int count = 0;
+		for (int i = 0; i < files.length(); i++) {
+			if (files.charAt(i) == '\0') count++;
+		}
+		fileNames = new String[count];
+		for (int i = 0, offset = 0, index = 0; i < files.length(); i++) {
+			if (files.charAt(i) == '\0') {
+				fileNames[index++] = files.substring(offset, i);
+				offset = i + 1;
+			}
+		}
+	} else {
+		// How many files are there?
+		int count = OS.DragQueryFile(stgmedium.unionField, 0xFFFFFFFF, null, 0);
+		fileNames = new String[count];
+		for (int i = 0; i < count; i++) {
+			// How long is the name ?
+			int size = OS.DragQueryFile(stgmedium.unionField, i, null, 0) + 1;
+			TCHAR lpszFile = new TCHAR(0, size);	
+			// Get file name and append it to string
+			OS.DragQueryFile(stgmedium.unionField, i, lpszFile, size);
+			fileNames[i] = lpszFile.toString(0, lpszFile.strlen());
+		}
 	}
 	OS.DragFinish(stgmedium.unionField); // frees data associated with HDROP data
 	return fileNames;
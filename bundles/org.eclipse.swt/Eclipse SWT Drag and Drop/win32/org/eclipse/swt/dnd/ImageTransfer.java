@@ -36,6 +36,7 @@ public class ImageTransfer extends ByteArrayTransfer {
 	private static ImageTransfer _instance = new ImageTransfer();
 	private static final String CF_DIB = "CF_DIB"; //$NON-NLS-1$
 	private static final int CF_DIBID = COM.CF_DIB;
+	private static final int BITMAPV4HEADER_SIZEOF = 108;
 	
 private ImageTransfer() {}
 
@@ -96,23 +97,12 @@ public void javaToNative(Object object, TransferData transferData) {
 			offset += 4;
 		}
 	}
-	long /*int*/ newPtr = OS.GlobalAlloc(OS.GMEM_FIXED | OS.GMEM_ZEROINIT, BITMAPINFOHEADER.sizeof + colorSize + imageSize);
-	OS.MoveMemory(newPtr, bmi, bmi.length);	
-	long /*int*/ pBitDest = newPtr + BITMAPINFOHEADER.sizeof + colorSize;
-
-	if (imageHeight <= 0) {
-		OS.MoveMemory(pBitDest, imgData.data, imageSize);
-	} else {
-		int offset = 0;
-		pBitDest += bytesPerLine * (imageHeight - 1);
-		byte[] scanline = new byte[bytesPerLine];
-		for (int i = 0; i < imageHeight; i++) {
-			System.arraycopy(imgData.data, offset, scanline, 0, bytesPerLine);
-			OS.MoveMemory(pBitDest, scanline, bytesPerLine);
-			offset += bytesPerLine;
-			pBitDest -= bytesPerLine;
-		}
-	}			
+	long /*int*/ newPtr = OS.GlobalAllocDIB(bmi, imgData.data, bytesPerLine, imageHeight);
+	if (newPtr == 0) {
+		transferData.stgmedium = new STGMEDIUM();
+		transferData.result = COM.DV_E_STGMEDIUM;
+		return;
+	}
 	transferData.stgmedium = new STGMEDIUM();
 	transferData.stgmedium.tymed = COM.TYMED_HGLOBAL;
 	transferData.stgmedium.unionField = newPtr;
@@ -135,8 +125,12 @@ public Object nativeToJava(TransferData transferData) {
 	if (!isSupportedType(transferData) || transferData.pIDataObject == 0) return null;
 	IDataObject dataObject = new IDataObject(transferData.pIDataObject);
 	dataObject.AddRef();
+	/*
+	* Ask for CF_DIBV5 first, which Windows synthesizes from CF_DIB when
+	* needed, so that the alpha channel of the image is not lost.
+	*/
 	FORMATETC formatetc = new FORMATETC();
-	formatetc.cfFormat = COM.CF_DIB;
+	formatetc.cfFormat = COM.CF_DIBV5;
 	formatetc.ptd = 0;
 	formatetc.dwAspect = COM.DVASPECT_CONTENT;
 	formatetc.lindex = -1;
@@ -144,6 +138,12 @@ public Object nativeToJava(TransferData transferData) {
 	STGMEDIUM stgmedium = new STGMEDIUM();
 	stgmedium.tymed = COM.TYMED_HGLOBAL;
 	transferData.result = getData(dataObject, formatetc, stgmedium);
+	if (transferData.result != COM.S_OK) {
+		formatetc.cfFormat = COM.CF_DIB;
+		stgmedium = new STGMEDIUM();
+		stgmedium.tymed = COM.TYMED_HGLOBAL;
+		transferData.result = getData(dataObject, formatetc, stgmedium);
+	}
 
 	if (transferData.result != COM.S_OK) return null;
 	long /*int*/ hMem = stgmedium.unionField;
@@ -154,13 +154,15 @@ public Object nativeToJava(TransferData transferData) {
 		try {
 			BITMAPINFOHEADER bmiHeader = new BITMAPINFOHEADER();				
 			OS.MoveMemory(bmiHeader, ptr, BITMAPINFOHEADER.sizeof);
+			ImageData imageData = getImageData(ptr, OS.GlobalSize(hMem), bmiHeader);
+			if (imageData != null) return imageData;
 			long /*int*/[] pBits = new long /*int*/[1]; 
 			long /*int*/ memDib = OS.CreateDIBSection(0, ptr, OS.DIB_RGB_COLORS, pBits, 0, 0);
 			if (memDib == 0) SWT.error(SWT.ERROR_NO_HANDLES);			
 			long /*int*/ bits = ptr + bmiHeader.biSize;
 			if (bmiHeader.biBitCount <= 8) {
 				bits += (bmiHeader.biClrUsed == 0 ? (1 << bmiHeader.biBitCount) : bmiHeader.biClrUsed) * 4;
-			} else if (bmiHeader.biCompression == OS.BI_BITFIELDS) {
+			} else if (bmiHeader.biCompression == OS.BI_BITFIELDS && bmiHeader.biSize == BITMAPINFOHEADER.sizeof) {
 				bits += 12;
 			}
 			if (bmiHeader.biHeight < 0) {
@@ -191,6 +193,57 @@ public Object nativeToJava(TransferData transferData) {
 	}
 }
 
+/*
+* Answers the image data of an uncompressed 24 or 32 bit DIB, copied from
+* the memory of the DIB in one pass, or null when the DIB has to go through
+* a DIB section.  The alpha mask of a version 4 or 5 header is taken into
+* the image data unless every pixel has zero alpha, which is what most
+* applications that do not use the alpha channel put there.
+*/
+ImageData getImageData(long /*int*/ ptr, int size, BITMAPINFOHEADER bmiHeader) {
+	int depth = bmiHeader.biBitCount;
+	int width = bmiHeader.biWidth, height = Math.abs(bmiHeader.biHeight);
+	if (width <= 0 || height <= 0) return null;
+	PaletteData palette;
+	if (depth == 24 && bmiHeader.biCompression == OS.BI_RGB) {
+		palette = new PaletteData(0xFF, 0xFF00, 0xFF0000);
+	} else if (depth == 32 && bmiHeader.biCompression == OS.BI_RGB) {
+		palette = new PaletteData(0xFF00, 0xFF0000, 0xFF000000);
+	} else if (depth == 32 && bmiHeader.biCompression == OS.BI_BITFIELDS) {
+		/* The masks follow a version 3 header and are the first fields past it in later versions */
+		int[] masks = new int[3];
+		OS.MoveMemory(masks, ptr + BITMAPINFOHEADER.sizeof, 12);
+		palette = new PaletteData(swap(masks[0]), swap(masks[1]), swap(masks[2]));
+	} else {
+		return null;
+	}
+	if (width > (Integer.MAX_VALUE - 31) / depth) return null;
+	int bytesPerLine = ((width * depth + 31) / 32) * 4;
+	if (height > Integer.MAX_VALUE / bytesPerLine) return null;
+	byte[] bits = new byte[bytesPerLine * height];
+	if (!OS.MoveDIBBits(bits, ptr, size)) return null;
+	ImageData data = new ImageData(width, height, depth, palette, 4, bits);
+	if (depth == 32 && bmiHeader.biCompression == OS.BI_BITFIELDS && bmiHeader.biSize >= BITMAPV4HEADER_SIZEOF) {
+		int[] alphaMask = new int[1];
+		OS.MoveMemory(alphaMask, ptr + BITMAPINFOHEADER.sizeof + 12, 4);
+		if (alphaMask[0] == 0xFF000000) {
+			byte[] alphaData = new byte[width * height];
+			boolean hasAlpha = false;
+			for (int y = 0, ap = 0; y < height; y++) {
+				for (int x = 0, sp = y * bytesPerLine + 3; x < width; x++, sp += 4) {
+					hasAlpha |= (alphaData[ap++] = bits[sp]) != 0;
+				}
+			}
+			if (hasAlpha) data.alphaData = alphaData;
+		}
+	}
+	return data;
+}
+
+static int swap(int mask) {
+	return ((mask & 0xFF) << 24) | ((mask & 0xFF00) << 8) | ((mask >> 8) & 0xFF00) | ((mask >> 24) & 0xFF);
+}
+
 protected int[] getTypeIds(){
 	return new int[] {CF_DIBID};
 }
@@ -65,12 +65,12 @@ public void javaToNative (Object object, TransferData transferData){
 	// URL is stored as a null terminated byte array
 	String url = ((String)object);
 	if (transferData.type == CFSTR_INETURLIDW) {
-		int charCount = url.length ();
-		char[] chars = new char[charCount+1];
-		url.getChars (0, charCount, chars, 0);
-		int byteCount = chars.length * 2;
-		long /*int*/ newPtr = OS.GlobalAlloc(COM.GMEM_FIXED | COM.GMEM_ZEROINIT, byteCount);
-		OS.MoveMemory(newPtr, chars, byteCount);
+		long /*int*/ newPtr = OS.GlobalAllocString(url);
+		if (newPtr == 0) {
+			transferData.stgmedium = new STGMEDIUM();
+			transferData.result = COM.DV_E_STGMEDIUM;
+			return;
+		}
 		transferData.stgmedium = new STGMEDIUM();
 		transferData.stgmedium.tymed = COM.TYMED_HGLOBAL;
 		transferData.stgmedium.unionField = newPtr;
@@ -120,25 +120,7 @@ public Object nativeToJava(TransferData transferData){
 	long /*int*/ hMem = stgmedium.unionField;
 	try {
 		if (transferData.type == CFSTR_INETURLIDW) {
-			/* Ensure byteCount is a multiple of 2 bytes */
-			int size = OS.GlobalSize(hMem) / 2 * 2;
-			if (size == 0) return null;
-			char[] chars = new char[size/2];
-			long /*int*/ ptr = OS.GlobalLock(hMem);
-			if (ptr == 0) return null;
-			try {
-				OS.MoveMemory(chars, ptr, size);
-				int length = chars.length;
-				for (int i=0; i<chars.length; i++) {
-					if (chars [i] == '\0') {
-						length = i;
-						break;
-					}
-				}
-				return new String (chars, 0, length);
-			} finally {
-				OS.GlobalUnlock(hMem);	
-			}
+			return OS.GlobalGetString(hMem);
 		} else if (transferData.type == CFSTR_INETURLID) {
 			long /*int*/ lpMultiByteStr = OS.GlobalLock(hMem);
 			if (lpMultiByteStr == 0) return null;
@@ -114,7 +114,7 @@ JNIEXPORT jintLong JNICALL XPCOM_NATIVE(_1Call__JJJ_3BII_3I)(JNIEnv *env, jclass
 	rc = (jintLong)((nsWriteSegmentFun)arg0)((nsIInputStream *)arg1, (void *)arg2, (const char *)lparg3, arg4, arg5, (PRUint32 *)lparg6);
 fail:
 	if (arg6 && lparg6) env->ReleaseIntArrayElements(arg6, lparg6, 0);
-	if (arg3 && lparg3) env->ReleaseByteArrayElements(arg3, lparg3, 0);
+	if (arg3 && lparg3) env->ReleaseByteArrayElements(arg3, lparg3, JNI_ABORT);
 #ifndef JNI64
 	XPCOM_NATIVE_EXIT(env, that, _1Call__III_3BII_3I_FUNC);
 #else
@@ -6850,7 +6850,7 @@ JNIEXPORT jint JNICALL XPCOM_NATIVE(_1XPCOMGlueStartup)
 	if (arg0) if ((lparg0 = env->GetByteArrayElements(arg0, NULL)) == NULL) goto fail;
 	rc = (jint)XPCOMGlueStartup((const char *)lparg0);
 fail:
-	if (arg0 && lparg0) env->ReleaseByteArrayElements(arg0, lparg0, 0);
+	if (arg0 && lparg0) env->ReleaseByteArrayElements(arg0, lparg0, JNI_ABORT);
 	XPCOM_NATIVE_EXIT(env, that, _1XPCOMGlueStartup_FUNC);
 	return rc;
 }
@@ -6942,7 +6942,7 @@ JNIEXPORT jintLong JNICALL XPCOM_NATIVE(_1nsEmbedCString_1new___3BI)
 	if (arg0) if ((lparg0 = env->GetByteArrayElements(arg0, NULL)) == NULL) goto fail;
 	rc = (jintLong)new nsEmbedCString((const char *)lparg0, arg1);
 fail:
-	if (arg0 && lparg0) env->ReleaseByteArrayElements(arg0, lparg0, 0);
+	if (arg0 && lparg0) env->ReleaseByteArrayElements(arg0, lparg0, JNI_ABORT);
 	XPCOM_NATIVE_EXIT(env, that, _1nsEmbedCString_1new___3BI_FUNC);
 	return rc;
 }
@@ -7161,7 +7161,6 @@ JNIEXPORT void JNICALL XPCOM_NATIVE(memmove__JLorg_eclipse_swt_internal_mozilla_
 	if (arg1) if ((lparg1 = getnsIDFields(env, arg1, &_arg1)) == NULL) goto fail;
 	memmove((void *)arg0, (const void *)lparg1, (size_t)arg2);
 fail:
-	if (arg1 && lparg1) setnsIDFields(env, arg1, lparg1);
 #ifndef JNI64
 	XPCOM_NATIVE_EXIT(env, that, memmove__ILorg_eclipse_swt_internal_mozilla_nsID_2I_FUNC);
 #else
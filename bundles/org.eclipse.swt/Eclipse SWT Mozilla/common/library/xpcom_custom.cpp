@@ -35,53 +35,146 @@ JNIEXPORT jint JNICALL XPCOM_NATIVE(strlen_1PRUnichar)
 }
 #endif
 
+/*
+ * Strings are copied between Java and the nsEmbedString and nsEmbedCString
+ * buffers in one call, using the length the string already knows instead
+ * of a separate Length(), get() and memmove.
+ */
+#ifndef NO_PRUnichar_1toString
+JNIEXPORT jstring JNICALL XPCOM_NATIVE(PRUnichar_1toString)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	jstring rc = NULL;
+	XPCOM_NATIVE_ENTER(env, that, PRUnichar_1toString_FUNC);
+	{
+	/* Like strlen_PRUnichar(), a null string is empty */
+	static const jchar empty[1] = {0};
+	const PRUnichar* lparg0 = (const PRUnichar *)arg0;
+	PRUint32 len = 0;
+	if (lparg0 != NULL) while (lparg0[len] != 0) len++;
+	rc = env->NewString(lparg0 != NULL ? (const jchar *)lparg0 : empty, (jsize)len);
+	}
+	XPCOM_NATIVE_EXIT(env, that, PRUnichar_1toString_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1nsEmbedCString_1getBytes
+JNIEXPORT jbyteArray JNICALL XPCOM_NATIVE(_1nsEmbedCString_1getBytes)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	jbyteArray rc = NULL;
+	XPCOM_NATIVE_ENTER(env, that, _1nsEmbedCString_1getBytes_FUNC);
+	if (arg0) {
+		nsEmbedCString *string = (nsEmbedCString *)arg0;
+		jsize length = (jsize)string->Length();
+		rc = env->NewByteArray(length);
+		if (rc != NULL) env->SetByteArrayRegion(rc, 0, length, (const jbyte *)string->get());
+	}
+	XPCOM_NATIVE_EXIT(env, that, _1nsEmbedCString_1getBytes_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1nsEmbedString_1newString
+JNIEXPORT jintLong JNICALL XPCOM_NATIVE(_1nsEmbedString_1newString)
+	(JNIEnv *env, jclass that, jstring arg0)
+{
+	jintLong rc = 0;
+	XPCOM_NATIVE_ENTER(env, that, _1nsEmbedString_1newString_FUNC);
+	if (arg0) {
+		jsize length = env->GetStringLength(arg0);
+		const jchar *lparg0 = env->GetStringCritical(arg0, NULL);
+		if (lparg0 != NULL) {
+			rc = (jintLong)new nsEmbedString((const PRUnichar *)lparg0, (PRUint32)length);
+			env->ReleaseStringCritical(arg0, lparg0);
+		}
+	}
+	XPCOM_NATIVE_EXIT(env, that, _1nsEmbedString_1newString_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1nsEmbedString_1toString
+JNIEXPORT jstring JNICALL XPCOM_NATIVE(_1nsEmbedString_1toString)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	jstring rc = NULL;
+	XPCOM_NATIVE_ENTER(env, that, _1nsEmbedString_1toString_FUNC);
+	if (arg0) {
+		nsEmbedString *string = (nsEmbedString *)arg0;
+		rc = env->NewString((const jchar *)string->get(), (jsize)string->Length());
+	}
+	XPCOM_NATIVE_EXIT(env, that, _1nsEmbedString_1toString_FUNC);
+	return rc;
+}
+#endif
+
+/*
+ * The JS entry points are resolved together the first time any of them
+ * is called, so later calls neither pin the library path nor look up
+ * their function again.
+ */
+typedef struct SWT_JSFunctions {
+	int initialized;
+	void *JS_DefineFunction;
+	void *JS_EvaluateUCScriptForPrincipals;
+	void *JS_GetGlobalObject;
+	void *JS_NewObject;
+} SWT_JSFunctions;
+
+static SWT_JSFunctions jsFunctions;
+
+static SWT_JSFunctions *getJSFunctions(JNIEnv *env, jbyteArray mozillaPath)
+{
+	jbyte *lpmozillaPath=NULL;
+	if (jsFunctions.initialized) return &jsFunctions;
+	if (mozillaPath) if ((lpmozillaPath = env->GetByteArrayElements(mozillaPath, NULL)) == NULL) return NULL;
+	{
+#ifdef _WIN32
+		HMODULE hm = LoadLibrary((const char *)lpmozillaPath);
+		if (hm) {
+			jsFunctions.JS_DefineFunction = (void *)GetProcAddress(hm, "JS_DefineFunction");
+			jsFunctions.JS_EvaluateUCScriptForPrincipals = (void *)GetProcAddress(hm, "JS_EvaluateUCScriptForPrincipals");
+			jsFunctions.JS_GetGlobalObject = (void *)GetProcAddress(hm, "JS_GetGlobalObject");
+			jsFunctions.JS_NewObject = (void *)GetProcAddress(hm, "JS_NewObject");
+		}
+#else
+		void* handle = dlopen((const char *)lpmozillaPath, RTLD_LAZY);
+		if (handle) {
+			jsFunctions.JS_DefineFunction = dlsym(handle, "JS_DefineFunction");
+			jsFunctions.JS_EvaluateUCScriptForPrincipals = dlsym(handle, "JS_EvaluateUCScriptForPrincipals");
+			jsFunctions.JS_GetGlobalObject = dlsym(handle, "JS_GetGlobalObject");
+			jsFunctions.JS_NewObject = dlsym(handle, "JS_NewObject");
+		}
+#endif /* _WIN32 */
+		jsFunctions.initialized = 1;
+	}
+	if (mozillaPath && lpmozillaPath) env->ReleaseByteArrayElements(mozillaPath, lpmozillaPath, JNI_ABORT);
+	return &jsFunctions;
+}
+
 #ifndef NO__1JS_1DefineFunction
 JNIEXPORT jintLong JNICALL XPCOM_NATIVE(_1JS_1DefineFunction)
 	(JNIEnv *env, jclass that, jbyteArray mozillaPath, jintLong arg0, jintLong arg1, jbyteArray arg2, jintLong arg3, jint arg4, jint arg5)
 {
-	jbyte *lpmozillaPath=NULL;
+	SWT_JSFunctions *fns=NULL;
 	jbyte *lparg2=NULL;
 	jintLong rc = 0;
 	XPCOM_NATIVE_ENTER(env, that, _1JS_1DefineFunction_FUNC);
-	if (mozillaPath) if ((lpmozillaPath = env->GetByteArrayElements(mozillaPath, NULL)) == NULL) goto fail;
+	if ((fns = getJSFunctions(env, mozillaPath)) == NULL) goto fail;
 	if (arg2) if ((lparg2 = env->GetByteArrayElements(arg2, NULL)) == NULL) goto fail;
 /*
 	rc = (jintLong)JS_DefineFunction(arg0, arg1, lparg2, arg3, arg4, arg5);
 */
 	{
-	
-#ifdef _WIN32
-		static int initialized = 0;
-		static FARPROC fp = NULL;
-		if (!initialized) {
-			HMODULE hm = LoadLibrary((const char *)lpmozillaPath);
-			if (hm) {
-				fp = GetProcAddress(hm, "JS_DefineFunction");
-			}
-			initialized = 1;
-		}
+		void *fp = fns->JS_DefineFunction;
 		if (fp) {
 			rc = (jintLong)((jintLong (*)(jintLong, jintLong, jbyte *, jintLong, jint, jint))fp)(arg0, arg1, lparg2, arg3, arg4, arg5);
 		}
-#else
-#define CALLING_CONVENTION
-		static int initialized = 0;
-		static void *fp = NULL;
-		if (!initialized) {
-			void* handle = dlopen((const char *)lpmozillaPath, RTLD_LAZY);
-			if (handle) {
-				fp = dlsym(handle, "JS_DefineFunction");
-			}
-			initialized = 1;
-		}
-		if (fp) {
-			rc = (jintLong)((jintLong (CALLING_CONVENTION*)(jintLong, jintLong, jbyte *, jintLong, jint, jint))fp)(arg0, arg1, lparg2, arg3, arg4, arg5);
-		}
-#endif /* _WIN32 */
 	}
 fail:
 	if (arg2 && lparg2) env->ReleaseByteArrayElements(arg2, lparg2, 0);
-	if (mozillaPath && lpmozillaPath) env->ReleaseByteArrayElements(mozillaPath, lpmozillaPath, 0);
 	XPCOM_NATIVE_EXIT(env, that, _1JS_1DefineFunction_FUNC);
 	return rc;
 }
@@ -91,13 +184,13 @@ fail:
 JNIEXPORT jint JNICALL XPCOM_NATIVE(_1JS_1EvaluateUCScriptForPrincipals)
 	(JNIEnv *env, jclass that, jbyteArray mozillaPath, jintLong arg0, jintLong arg1, jintLong arg2, jcharArray arg3, jint arg4, jbyteArray arg5, jint arg6, jintLongArray arg7)
 {
-	jbyte *lpmozillaPath=NULL;
+	SWT_JSFunctions *fns=NULL;
 	jchar *lparg3=NULL;
 	jbyte *lparg5=NULL;
 	jintLong *lparg7=NULL;
 	jint rc = 0;
 	XPCOM_NATIVE_ENTER(env, that, _1JS_1EvaluateUCScriptForPrincipals_FUNC);
-	if (mozillaPath) if ((lpmozillaPath = env->GetByteArrayElements(mozillaPath, NULL)) == NULL) goto fail;
+	if ((fns = getJSFunctions(env, mozillaPath)) == NULL) goto fail;
 	if (arg3) if ((lparg3 = env->GetCharArrayElements(arg3, NULL)) == NULL) goto fail;
 	if (arg5) if ((lparg5 = env->GetByteArrayElements(arg5, NULL)) == NULL) goto fail;
 	if (arg7) if ((lparg7 = env->GetIntLongArrayElements(arg7, NULL)) == NULL) goto fail;
@@ -105,41 +198,15 @@ JNIEXPORT jint JNICALL XPCOM_NATIVE(_1JS_1EvaluateUCScriptForPrincipals)
 	rc = (jint)JS_EvaluateUCScriptForPrincipals(arg0, arg1, arg2, lparg3, arg4, lparg5, arg6, lparg7);
 */
 	{
-	
-#ifdef _WIN32
-		static int initialized = 0;
-		static FARPROC fp = NULL;
-		if (!initialized) {
-			HMODULE hm = LoadLibrary((const char *)lpmozillaPath);
-			if (hm) {
-				fp = GetProcAddress(hm, "JS_EvaluateUCScriptForPrincipals");
-			}
-			initialized = 1;
-		}
+		void *fp = fns->JS_EvaluateUCScriptForPrincipals;
 		if (fp) {
 			rc = (jint)((jint (*)(jintLong, jintLong, jintLong, jchar *, jint, jbyte *, jint, jintLong *))fp)(arg0, arg1, arg2, lparg3, arg4, lparg5, arg6, lparg7);
 		}
-#else
-#define CALLING_CONVENTION
-		static int initialized = 0;
-		static void *fp = NULL;
-		if (!initialized) {
-			void* handle = dlopen((const char *)lpmozillaPath, RTLD_LAZY);
-			if (handle) {
-				fp = dlsym(handle, "JS_EvaluateUCScriptForPrincipals");
-			}
-			initialized = 1;
-		}
-		if (fp) {
-			rc = (jint)((jint (CALLING_CONVENTION*)(jintLong, jintLong, jintLong, jchar *, jint, jbyte *, jint, jintLong *))fp)(arg0, arg1, arg2, lparg3, arg4, lparg5, arg6, lparg7);
-		}
-#endif /* _WIN32 */
 	}
 fail:
 	if (arg7 && lparg7) env->ReleaseIntLongArrayElements(arg7, lparg7, 0);
 	if (arg5 && lparg5) env->ReleaseByteArrayElements(arg5, lparg5, 0);
 	if (arg3 && lparg3) env->ReleaseCharArrayElements(arg3, lparg3, 0);
-	if (mozillaPath && lpmozillaPath) env->ReleaseByteArrayElements(mozillaPath, lpmozillaPath, 0);
 	XPCOM_NATIVE_EXIT(env, that, _1JS_1EvaluateUCScriptForPrincipals_FUNC);
 	return rc;
 }
@@ -149,52 +216,26 @@ fail:
 JNIEXPORT jint JNICALL XPCOM_NATIVE(_1JS_1EvaluateUCScriptForPrincipals191)
 	(JNIEnv *env, jclass that, jbyteArray mozillaPath, jintLong arg0, jintLong arg1, jintLong arg2, jcharArray arg3, jint arg4, jbyteArray arg5, jint arg6, jintLong arg7)
 {
-	jbyte *lpmozillaPath=NULL;
+	SWT_JSFunctions *fns=NULL;
 	jchar *lparg3=NULL;
 	jbyte *lparg5=NULL;
 	jint rc = 0;
 	XPCOM_NATIVE_ENTER(env, that, _1JS_1EvaluateUCScriptForPrincipals191_FUNC);
-	if (mozillaPath) if ((lpmozillaPath = env->GetByteArrayElements(mozillaPath, NULL)) == NULL) goto fail;
+	if ((fns = getJSFunctions(env, mozillaPath)) == NULL) goto fail;
 	if (arg3) if ((lparg3 = env->GetCharArrayElements(arg3, NULL)) == NULL) goto fail;
 	if (arg5) if ((lparg5 = env->GetByteArrayElements(arg5, NULL)) == NULL) goto fail;
 /*
 	rc = (jint)JS_EvaluateUCScriptForPrincipals(arg0, arg1, arg2, lparg3, arg4, lparg5, arg6, arg7);
 */
 	{
-	
-#ifdef _WIN32
-		static int initialized = 0;
-		static FARPROC fp = NULL;
-		if (!initialized) {
-			HMODULE hm = LoadLibrary((const char *)lpmozillaPath);
-			if (hm) {
-				fp = GetProcAddress(hm, "JS_EvaluateUCScriptForPrincipals");
-			}
-			initialized = 1;
-		}
+		void *fp = fns->JS_EvaluateUCScriptForPrincipals;
 		if (fp) {
 			rc = (jint)((jint (*)(jintLong, jintLong, jintLong, jchar *, jint, jbyte *, jint, jintLong))fp)(arg0, arg1, arg2, lparg3, arg4, lparg5, arg6, arg7);
 		}
-#else
-#define CALLING_CONVENTION
-		static int initialized = 0;
-		static void *fp = NULL;
-		if (!initialized) {
-			void* handle = dlopen((const char *)lpmozillaPath, RTLD_LAZY);
-			if (handle) {
-				fp = dlsym(handle, "JS_EvaluateUCScriptForPrincipals");
-			}
-			initialized = 1;
-		}
-		if (fp) {
-			rc = (jint)((jint (CALLING_CONVENTION*)(jintLong, jintLong, jintLong, jchar *, jint, jbyte *, jint, jintLong))fp)(arg0, arg1, arg2, lparg3, arg4, lparg5, arg6, arg7);
-		}
-#endif /* _WIN32 */
 	}
 fail:
 	if (arg5 && lparg5) env->ReleaseByteArrayElements(arg5, lparg5, 0);
 	if (arg3 && lparg3) env->ReleaseCharArrayElements(arg3, lparg3, 0);
-	if (mozillaPath && lpmozillaPath) env->ReleaseByteArrayElements(mozillaPath, lpmozillaPath, 0);
 	XPCOM_NATIVE_EXIT(env, that, _1JS_1EvaluateUCScriptForPrincipals191_FUNC);
 	return rc;
 }
@@ -204,46 +245,20 @@ fail:
 JNIEXPORT jintLong JNICALL XPCOM_NATIVE(_1JS_1GetGlobalObject)
 	(JNIEnv *env, jclass that, jbyteArray mozillaPath, jintLong arg0)
 {
-	jbyte *lpmozillaPath=NULL;
+	SWT_JSFunctions *fns=NULL;
 	jintLong rc = 0;
 	XPCOM_NATIVE_ENTER(env, that, _1JS_1GetGlobalObject_FUNC);
-	if (mozillaPath) if ((lpmozillaPath = env->GetByteArrayElements(mozillaPath, NULL)) == NULL) goto fail;
+	if ((fns = getJSFunctions(env, mozillaPath)) == NULL) goto fail;
 /*
 	rc = (jintLong)JS_GetGlobalObject(arg0);
 */
 	{
-	
-#ifdef _WIN32
-		static int initialized = 0;
-		static FARPROC fp = NULL;
-		if (!initialized) {
-			HMODULE hm = LoadLibrary((const char *)lpmozillaPath);
-			if (hm) {
-				fp = GetProcAddress(hm, "JS_GetGlobalObject");
-			}
-			initialized = 1;
-		}
+		void *fp = fns->JS_GetGlobalObject;
 		if (fp) {
 			rc = (jintLong)((jintLong (*)(jintLong))fp)(arg0);
 		}
-#else
-#define CALLING_CONVENTION
-		static int initialized = 0;
-		static void *fp = NULL;
-		if (!initialized) {
-			void* handle = dlopen((const char *)lpmozillaPath, RTLD_LAZY);
-			if (handle) {
-				fp = dlsym(handle, "JS_GetGlobalObject");
-			}
-			initialized = 1;
-		}
-		if (fp) {
-			rc = (jintLong)((jintLong (CALLING_CONVENTION*)(jintLong))fp)(arg0);
-		}
-#endif /* _WIN32 */
 	}
 fail:
-	if (mozillaPath && lpmozillaPath) env->ReleaseByteArrayElements(mozillaPath, lpmozillaPath, 0);
 	XPCOM_NATIVE_EXIT(env, that, _1JS_1GetGlobalObject_FUNC);
 	return rc;
 }
@@ -253,46 +268,20 @@ fail:
 JNIEXPORT jintLong JNICALL XPCOM_NATIVE(_1JS_1NewObject)
 	(JNIEnv *env, jclass that, jbyteArray mozillaPath, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 {
-	jbyte *lpmozillaPath=NULL;
+	SWT_JSFunctions *fns=NULL;
 	jintLong rc = 0;
 	XPCOM_NATIVE_ENTER(env, that, _1JS_1NewObject_FUNC);
-	if (mozillaPath) if ((lpmozillaPath = env->GetByteArrayElements(mozillaPath, NULL)) == NULL) goto fail;
+	if ((fns = getJSFunctions(env, mozillaPath)) == NULL) goto fail;
 /*
 	rc = (jintLong)JS_NewObject(arg0, arg1, arg2, arg3);
 */
 	{
-	
-#ifdef _WIN32
-		static int initialized = 0;
-		static FARPROC fp = NULL;
-		if (!initialized) {
-			HMODULE hm = LoadLibrary((const char *)lpmozillaPath);
-			if (hm) {
-				fp = GetProcAddress(hm, "JS_NewObject");
-			}
-			initialized = 1;
-		}
+		void *fp = fns->JS_NewObject;
 		if (fp) {
 			rc = (jintLong)((jintLong (*)(jintLong, jintLong, jintLong, jintLong))fp)(arg0, arg1, arg2, arg3);
 		}
-#else
-#define CALLING_CONVENTION
-		static int initialized = 0;
-		static void *fp = NULL;
-		if (!initialized) {
-			void* handle = dlopen((const char *)lpmozillaPath, RTLD_LAZY);
-			if (handle) {
-				fp = dlsym(handle, "JS_NewObject");
-			}
-			initialized = 1;
-		}
-		if (fp) {
-			rc = (jintLong)((jintLong (CALLING_CONVENTION*)(jintLong, jintLong, jintLong, jintLong))fp)(arg0, arg1, arg2, arg3);
-		}
-#endif /* _WIN32 */
 	}
 fail:
-	if (mozillaPath && lpmozillaPath) env->ReleaseByteArrayElements(mozillaPath, lpmozillaPath, 0);
 	XPCOM_NATIVE_EXIT(env, that, _1JS_1NewObject_FUNC);
 	return rc;
 }
@@ -361,4 +350,64 @@ fail:
 	return rc;
 }
 #endif
+
+#ifndef NO__1VtblResolve
+JNIEXPORT jintLong JNICALL XPCOM_NATIVE(_1VtblResolve)
+	(JNIEnv *env, jclass that, jint arg0, jintLong arg1)
+{
+	jintLong rc = 0;
+	XPCOM_NATIVE_ENTER(env, that, _1VtblResolve_FUNC);
+	if (arg1) rc = (*(jintLong **)arg1)[arg0];
+	XPCOM_NATIVE_EXIT(env, that, _1VtblResolve_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1VtblInvoke0
+JNIEXPORT jint JNICALL XPCOM_NATIVE(_1VtblInvoke0)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
+{
+	jint rc = 0;
+	XPCOM_NATIVE_ENTER(env, that, _1VtblInvoke0_FUNC);
+	rc = (jint)((jint (STDMETHODCALLTYPE *)(jintLong))arg0)(arg1);
+	XPCOM_NATIVE_EXIT(env, that, _1VtblInvoke0_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1VtblInvoke1
+JNIEXPORT jint JNICALL XPCOM_NATIVE(_1VtblInvoke1)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
+{
+	jint rc = 0;
+	XPCOM_NATIVE_ENTER(env, that, _1VtblInvoke1_FUNC);
+	rc = (jint)((jint (STDMETHODCALLTYPE *)(jintLong, jintLong))arg0)(arg1, arg2);
+	XPCOM_NATIVE_EXIT(env, that, _1VtblInvoke1_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1VtblInvoke2
+JNIEXPORT jint JNICALL XPCOM_NATIVE(_1VtblInvoke2)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+{
+	jint rc = 0;
+	XPCOM_NATIVE_ENTER(env, that, _1VtblInvoke2_FUNC);
+	rc = (jint)((jint (STDMETHODCALLTYPE *)(jintLong, jintLong, jintLong))arg0)(arg1, arg2, arg3);
+	XPCOM_NATIVE_EXIT(env, that, _1VtblInvoke2_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1VtblInvoke3
+JNIEXPORT jint JNICALL XPCOM_NATIVE(_1VtblInvoke3)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4)
+{
+	jint rc = 0;
+	XPCOM_NATIVE_ENTER(env, that, _1VtblInvoke3_FUNC);
+	rc = (jint)((jint (STDMETHODCALLTYPE *)(jintLong, jintLong, jintLong, jintLong))arg0)(arg1, arg2, arg3, arg4);
+	XPCOM_NATIVE_EXIT(env, that, _1VtblInvoke3_FUNC);
+	return rc;
+}
+#endif
 }
@@ -16,6 +16,7 @@
 
 char * XPCOM_nativeFunctionNames[] = {
 	"CALLBACK_1JSNative",
+	"PRUnichar_1toString",
 #ifndef JNI64
 	"_1Call__I",
 #else
@@ -1104,12 +1105,18 @@ char * XPCOM_nativeFunctionNames[] = {
 #else
 	"_1VtblCall__IJ_3SJ_3I_3J",
 #endif
+	"_1VtblInvoke0",
+	"_1VtblInvoke1",
+	"_1VtblInvoke2",
+	"_1VtblInvoke3",
+	"_1VtblResolve",
 	"_1XPCOMGlueLoadXULFunctions",
 	"_1XPCOMGlueShutdown",
 	"_1XPCOMGlueStartup",
 	"_1nsEmbedCString_1Length",
 	"_1nsEmbedCString_1delete",
 	"_1nsEmbedCString_1get",
+	"_1nsEmbedCString_1getBytes",
 	"_1nsEmbedCString_1new__",
 #ifndef JNI64
 	"_1nsEmbedCString_1new__II",
@@ -1122,6 +1129,8 @@ char * XPCOM_nativeFunctionNames[] = {
 	"_1nsEmbedString_1get",
 	"_1nsEmbedString_1new__",
 	"_1nsEmbedString_1new___3C",
+	"_1nsEmbedString_1newString",
+	"_1nsEmbedString_1toString",
 	"_1nsID_1Equals",
 	"_1nsID_1delete",
 	"_1nsID_1new",
@@ -1155,6 +1164,9 @@ char * XPCOM_nativeFunctionNames[] = {
 #define NATIVE_FUNCTION_COUNT sizeof(XPCOM_nativeFunctionNames) / sizeof(char*)
 int XPCOM_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int XPCOM_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong XPCOM_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT XPCOM_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS XPCOM_nativeStats = {XPCOM_nativeFunctionCallCount, XPCOM_nativeFunctionCallTime, XPCOM_nativeFunctionEvents, 0, "XPCOM", XPCOM_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -1176,4 +1188,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(XPCOM_1GetFunctionCallCount)
 	return XPCOM_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(XPCOM_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return XPCOM_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(XPCOM_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(XPCOM_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &XPCOM_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(XPCOM_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(XPCOM_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(XPCOM_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(XPCOM_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(XPCOM_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
@@ -13,8 +13,9 @@
 extern int XPCOM_nativeFunctionCount;
 extern int XPCOM_nativeFunctionCallCount[];
 extern char* XPCOM_nativeFunctionNames[];
-#define XPCOM_NATIVE_ENTER(env, that, func) XPCOM_nativeFunctionCallCount[func]++;
-#define XPCOM_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS XPCOM_nativeStats;
+#define XPCOM_NATIVE_ENTER(env, that, func) nativeStatsEnter(&XPCOM_nativeStats, func);
+#define XPCOM_NATIVE_EXIT(env, that, func) nativeStatsExit(&XPCOM_nativeStats, func);
 #else
 #ifndef XPCOM_NATIVE_ENTER
 #define XPCOM_NATIVE_ENTER(env, that, func) 
@@ -26,6 +27,7 @@ extern char* XPCOM_nativeFunctionNames[];
 
 typedef enum {
 	CALLBACK_1JSNative_FUNC,
+	PRUnichar_1toString_FUNC,
 #ifndef JNI64
 	_1Call__I_FUNC,
 #else
@@ -1114,12 +1116,18 @@ typedef enum {
 #else
 	_1VtblCall__IJ_3SJ_3I_3J_FUNC,
 #endif
+	_1VtblInvoke0_FUNC,
+	_1VtblInvoke1_FUNC,
+	_1VtblInvoke2_FUNC,
+	_1VtblInvoke3_FUNC,
+	_1VtblResolve_FUNC,
 	_1XPCOMGlueLoadXULFunctions_FUNC,
 	_1XPCOMGlueShutdown_FUNC,
 	_1XPCOMGlueStartup_FUNC,
 	_1nsEmbedCString_1Length_FUNC,
 	_1nsEmbedCString_1delete_FUNC,
 	_1nsEmbedCString_1get_FUNC,
+	_1nsEmbedCString_1getBytes_FUNC,
 	_1nsEmbedCString_1new___FUNC,
 #ifndef JNI64
 	_1nsEmbedCString_1new__II_FUNC,
@@ -1132,6 +1140,8 @@ typedef enum {
 	_1nsEmbedString_1get_FUNC,
 	_1nsEmbedString_1new___FUNC,
 	_1nsEmbedString_1new___3C_FUNC,
+	_1nsEmbedString_1newString_FUNC,
+	_1nsEmbedString_1toString_FUNC,
 	_1nsID_1Equals_FUNC,
 	_1nsID_1delete_FUNC,
 	_1nsID_1new_FUNC,
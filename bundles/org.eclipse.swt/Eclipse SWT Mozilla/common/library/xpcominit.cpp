@@ -56,8 +56,6 @@ JNIEXPORT jint JNICALL XPCOMInit_NATIVE(_1GRE_1GetGREPathWithProperties)
 	if (arg2) if ((lparg2 = getGREPropertyFields(env, arg2, &_arg2)) == NULL) goto fail;
 	rc = (jint)GRE_GetGREPathWithProperties((const GREVersionRange *)lparg0, arg1, (const GREProperty *)lparg2, arg3, (char *)arg4, arg5);
 fail:
-	if (arg2 && lparg2) setGREPropertyFields(env, arg2, lparg2);
-	if (arg0 && lparg0) setGREVersionRangeFields(env, arg0, lparg0);
 	XPCOMInit_NATIVE_EXIT(env, that, _1GRE_1GetGREPathWithProperties_FUNC);
 	return rc;
 }
@@ -87,7 +85,7 @@ JNIEXPORT jint JNICALL XPCOMInit_NATIVE(_1XPCOMGlueStartup)
 	if (arg0) if ((lparg0 = env->GetByteArrayElements(arg0, NULL)) == NULL) goto fail;
 	rc = (jint)XPCOMGlueStartup((const char *)lparg0);
 fail:
-	if (arg0 && lparg0) env->ReleaseByteArrayElements(arg0, lparg0, 0);
+	if (arg0 && lparg0) env->ReleaseByteArrayElements(arg0, lparg0, JNI_ABORT);
 	XPCOMInit_NATIVE_EXIT(env, that, _1XPCOMGlueStartup_FUNC);
 	return rc;
 }
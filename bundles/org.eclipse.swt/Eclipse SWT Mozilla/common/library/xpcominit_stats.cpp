@@ -24,6 +24,9 @@ char * XPCOMInit_nativeFunctionNames[] = {
 #define NATIVE_FUNCTION_COUNT sizeof(XPCOMInit_nativeFunctionNames) / sizeof(char*)
 int XPCOMInit_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int XPCOMInit_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong XPCOMInit_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT XPCOMInit_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS XPCOMInit_nativeStats = {XPCOMInit_nativeFunctionCallCount, XPCOMInit_nativeFunctionCallTime, XPCOMInit_nativeFunctionEvents, 0, "XPCOMInit", XPCOMInit_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -45,4 +48,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(XPCOMInit_1GetFunctionCallCount)
 	return XPCOMInit_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(XPCOMInit_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return XPCOMInit_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(XPCOMInit_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(XPCOMInit_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &XPCOMInit_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(XPCOMInit_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(XPCOMInit_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(XPCOMInit_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(XPCOMInit_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(XPCOMInit_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
@@ -13,8 +13,9 @@
 extern int XPCOMInit_nativeFunctionCount;
 extern int XPCOMInit_nativeFunctionCallCount[];
 extern char* XPCOMInit_nativeFunctionNames[];
-#define XPCOMInit_NATIVE_ENTER(env, that, func) XPCOMInit_nativeFunctionCallCount[func]++;
-#define XPCOMInit_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS XPCOMInit_nativeStats;
+#define XPCOMInit_NATIVE_ENTER(env, that, func) nativeStatsEnter(&XPCOMInit_nativeStats, func);
+#define XPCOMInit_NATIVE_EXIT(env, that, func) nativeStatsExit(&XPCOMInit_nativeStats, func);
 #else
 #ifndef XPCOMInit_NATIVE_ENTER
 #define XPCOMInit_NATIVE_ENTER(env, that, func) 
@@ -272,10 +272,7 @@ int Init (long /*int*/ aSource, long /*int*/ aTarget, long /*int*/ aDisplayName,
 	long /*int*/ aSpec = XPCOM.nsEmbedCString_new ();
 	int rc = source.GetHost (aSpec);
 	if (rc != XPCOM.NS_OK) Mozilla.error(rc);
-	int length = XPCOM.nsEmbedCString_Length (aSpec);
-	long /*int*/ buffer = XPCOM.nsEmbedCString_get (aSpec);
-	byte[] dest = new byte[length];
-	XPCOM.memmove (dest, buffer, length);
+	byte[] dest = XPCOM.nsEmbedCString_getBytes (aSpec);
 	XPCOM.nsEmbedCString_delete (aSpec);
 	String url = new String (dest);
 
@@ -283,10 +280,7 @@ int Init (long /*int*/ aSource, long /*int*/ aTarget, long /*int*/ aDisplayName,
 	long /*int*/ aPath = XPCOM.nsEmbedCString_new ();
 	rc = target.GetPath (aPath);
 	if (rc != XPCOM.NS_OK) Mozilla.error (rc);
-	length = XPCOM.nsEmbedCString_Length (aPath);
-	buffer = XPCOM.nsEmbedCString_get (aPath);
-	dest = new byte[length];
-	XPCOM.memmove (dest, buffer, length);
+	dest = XPCOM.nsEmbedCString_getBytes (aPath);
 	XPCOM.nsEmbedCString_delete (aPath);
 	String filename = new String (dest);
 	int separator = filename.lastIndexOf (System.getProperty ("file.separator"));	//$NON-NLS-1$
@@ -76,6 +76,7 @@ static long /*int*/ callJava (long /*int*/ cx, long /*int*/ argc, long /*int*/ v
 
 	nsIXPConnect connect = new nsIXPConnect (result[0]);
 	result[0] = 0;
+	serviceManager.Release ();
 
 	/* extract the first argument value (the function id) */
 	rc = connect.JSValToVariant (cx, argsPtr, result);
@@ -127,19 +128,13 @@ static long /*int*/ callJava (long /*int*/ cx, long /*int*/ argc, long /*int*/ v
 		componentManager.Release ();
 	}
 
-	/* convert the resulting variant to a jsval */
-	byte[] aContractID = MozillaDelegate.wcsToMbcs (null, XPCOM.NS_MEMORY_CONTRACTID, true);
-	rc = serviceManager.GetServiceByContractID (aContractID, nsIMemory.NS_IMEMORY_24_IID, result);
-	if (rc != XPCOM.NS_OK) {
-		rc = serviceManager.GetServiceByContractID (aContractID, nsIMemory.NS_IMEMORY_IID, result);
-	}
-	if (rc != XPCOM.NS_OK) Mozilla.error (rc);
-	if (result[0] == 0) Mozilla.error (XPCOM.NS_NOINTERFACE);
-	serviceManager.Release();
-
-	nsIMemory memory = new nsIMemory (result[0]);
-	result[0] = 0;
-	long /*int*/ jsVal = memory.Alloc (jsval_sizeof);
+	/*
+	* Convert the resulting variant to a jsval.  The jsval is only a
+	* scratch buffer that is copied to the return value slot, so it
+	* is allocated with malloc() rather than through the nsIMemory
+	* service, which would cost a service lookup on every call.
+	*/
+	long /*int*/ jsVal = C.malloc (jsval_sizeof);
 	C.memset (jsVal, 0, jsval_sizeof);
 	long /*int*/ globalObject = 0;
 	if (nsISupports.IsXULRunner24) {
@@ -157,8 +152,7 @@ static long /*int*/ callJava (long /*int*/ cx, long /*int*/ argc, long /*int*/ v
 		C.memmove (vp, jsVal, jsval_sizeof);
 		returnValue = XPCOM.JS_TRUE;
 	}
-	memory.Free (jsVal);
-	memory.Release ();
+	C.free (jsVal);
 	return returnValue;
 }
 
@@ -300,10 +294,7 @@ static Object convertToJava (nsIVariant variant, short type) {
 							long /*int*/ currentPtr = ptr[0] + i * C.PTR_SIZEOF;
 							long /*int*/[] stringPtr = new long /*int*/[1];
 							C.memmove (stringPtr, currentPtr, C.PTR_SIZEOF);
-							int length = XPCOM.strlen_PRUnichar (stringPtr[0]);
-							char[] dest = new char[length];
-							XPCOM.memmove (dest, stringPtr[0], length * 2);
-							arrayReturn[i] = new String (dest);
+							arrayReturn[i] = XPCOM.PRUnichar_toString (stringPtr[0]);
 						}
 						break;
 					default:
@@ -802,10 +793,7 @@ int canCallMethod (long /*int*/ iid, long /*int*/ methodName, long /*int*/ _retV
 
 	nsIMemory memory = new nsIMemory (result[0]);
 	result[0] = 0;
-	int length = XPCOM.strlen_PRUnichar (methodName);
-	char[] dest = new char[length];
-	XPCOM.memmove (dest, methodName, length * 2);
-	String string = new String (dest);
+	String string = XPCOM.PRUnichar_toString (methodName);
 	byte[] bytes;
 	if (string.equals (CALLJAVA)) {
 		bytes = MozillaDelegate.wcsToMbcs (null, "allAccess", true); //$NON-NLS-1$ 
@@ -239,12 +239,8 @@ int SetDisplayDirectory (long /*int*/ aDisplayDirectory) {
 	long /*int*/ pathname = XPCOM.nsEmbedString_new ();
 	int rc = file.GetPath (pathname);
 	if (rc != XPCOM.NS_OK) Mozilla.error (rc);
-	int length = XPCOM.nsEmbedString_Length (pathname);
-	long /*int*/ buffer = XPCOM.nsEmbedString_get (pathname);
-	char[] chars = new char[length];
-	XPCOM.memmove (chars, buffer, length * 2);
+	directory = XPCOM.nsEmbedString_toString (pathname);
 	XPCOM.nsEmbedString_delete (pathname);
-	directory = new String (chars);
 	return XPCOM.NS_OK;
 }
 
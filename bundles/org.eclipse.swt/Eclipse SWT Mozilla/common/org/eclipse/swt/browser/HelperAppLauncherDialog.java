@@ -174,15 +174,9 @@ int PromptForSaveToFile (long /*int*/ arg0, long /*int*/ arg1, long /*int*/ arg2
 		_retval = arg3;
 	}
 
-	int length = XPCOM.strlen_PRUnichar (aDefaultFile);
-	char[] dest = new char[length];
-	XPCOM.memmove (dest, aDefaultFile, length * 2);
-	String defaultFile = new String (dest);
-
-	length = XPCOM.strlen_PRUnichar (aSuggestedFileExtension);
-	dest = new char[length];
-	XPCOM.memmove (dest, aSuggestedFileExtension, length * 2);
-	String suggestedFileExtension = new String (dest);
+	String defaultFile = XPCOM.PRUnichar_toString (aDefaultFile);
+
+	String suggestedFileExtension = XPCOM.PRUnichar_toString (aSuggestedFileExtension);
 
 	Shell shell = new Shell ();
 	FileDialog fileDialog = new FileDialog (shell, SWT.SAVE);
@@ -40,15 +40,9 @@ int Show (long /*int*/ aLauncher, long /*int*/ aContext, int aReason) {
 
 @Override
 int PromptForSaveToFile (long /*int*/ aLauncher, long /*int*/ aWindowContext, long /*int*/ aDefaultFileName, long /*int*/ aSuggestedFileExtension, int aForcePrompt, long /*int*/ _retval) {
-	int length = XPCOM.strlen_PRUnichar (aDefaultFileName);
-	char[] dest = new char[length];
-	XPCOM.memmove (dest, aDefaultFileName, length * 2);
-	String defaultFile = new String (dest);
+	String defaultFile = XPCOM.PRUnichar_toString (aDefaultFileName);
 
-	length = XPCOM.strlen_PRUnichar (aSuggestedFileExtension);
-	dest = new char[length];
-	XPCOM.memmove (dest, aSuggestedFileExtension, length * 2);
-	String suggestedFileExtension = new String (dest);
+	String suggestedFileExtension = XPCOM.PRUnichar_toString (aSuggestedFileExtension);
 
 	Shell shell = new Shell ();
 	FileDialog fileDialog = new FileDialog (shell, SWT.SAVE);
@@ -17,7 +17,7 @@ class InputStream {
 	XPCOMObject inputStream;
 	int refCount = 0;
 
-	byte[] buffer;
+	byte[] buffer, chunk;
 	int index = 0;
 	
 InputStream (byte[] buffer) {
@@ -92,7 +92,7 @@ int Release () {
 /* nsIInputStream implementation */
 
 int Close () {
-	buffer = null;
+	buffer = chunk = null;
 	index = 0;
 	return XPCOM.NS_OK;
 }
@@ -106,9 +106,10 @@ int Available (long /*int*/ _retval) {
 int Read(long /*int*/ aBuf, int aCount, long /*int*/ _retval) {
 	int max = Math.min (aCount, buffer == null ? 0 : buffer.length - index);
 	if (max > 0) {
-		byte[] src = new byte[max];
-		System.arraycopy (buffer, index, src, 0, max);
-		XPCOM.memmove (aBuf, src, max);
+		/* the stream is read in many small pieces, so reuse the copy */
+		if (chunk == null || chunk.length < max) chunk = new byte[max];
+		System.arraycopy (buffer, index, chunk, 0, max);
+		XPCOM.memmove (aBuf, chunk, max);
 		index += max;
 	}
 	XPCOM.memmove(_retval, new int[] {max}, 4);
@@ -49,6 +49,7 @@ class Mozilla extends WebBrowser {
 	int chromeFlags = nsIWebBrowserChrome.CHROME_DEFAULT;
 	int registerFunctionsOnState = 0;
 	int refCount, lastKeyCode, lastCharCode, authCount;
+	int domEventMask;
 	long /*int*/ request, badCertRequest;
 	Point location, size;
 	boolean visible, isActive, isChild, ignoreDispose, isRetrievingBadCert, isViewingErrorPage, ignoreAllMessages, untrustedText;
@@ -58,6 +59,7 @@ class Mozilla extends WebBrowser {
 	Vector unhookedDOMWindows = new Vector ();
 	String lastNavigateURL;
 	byte[] htmlBytes;
+	TextStream textStream;
 
 	static nsIAppShell AppShell;
 	static AppFileLocProvider LocationProvider;
@@ -81,8 +83,14 @@ class Mozilla extends WebBrowser {
 	static final String GRERANGE_UPPER = "1.9.*"; //$NON-NLS-1$
 	static final boolean UpperRangeInclusive = true;
 	static final String PROPERTY_ABI = "abi"; //$NON-NLS-1$
+	static final String XULRUNNER_CACHE = ".swt" + File.separator + "xulrunner.cache"; //$NON-NLS-1$ //$NON-NLS-2$
 
 	static final int MAX_PORT = 65535;
+	
+	/* The DOM events that are only hooked while the Browser has a listener for them */
+	static final int DOM_MOUSEMOVE = 1 << 0;
+	static final int DOM_MOUSEWHEEL = 1 << 1;
+	static final int DOM_MOUSEDRAG = 1 << 2;
 	static final String DEFAULTVALUE_STRING = "default"; //$NON-NLS-1$
 	static final char SEPARATOR_OS = System.getProperty ("file.separator").charAt (0); //$NON-NLS-1$
 	static final String ABOUT_BLANK = "about:blank"; //$NON-NLS-1$
@@ -636,6 +644,7 @@ static void LoadLibraries () {
 			if (rc != XPCOM.NS_OK) {
 				MozillaPath = MozillaPath.substring (0, MozillaPath.lastIndexOf (SEPARATOR_OS));
 				if (Device.DEBUG) System.out.println ("cannot use detected XULRunner: " + MozillaPath); //$NON-NLS-1$
+				DeleteXULRunnerCache ();
 
 				/* attempt to XPCOMGlueStartup the GRE pointed at by MOZILLA_FIVE_HOME */
 				long /*int*/ ptr = C.getenv (MozillaDelegate.wcsToMbcs (null, MOZILLA_FIVE_HOME, true));
@@ -1071,6 +1080,7 @@ public void create (Composite parent, int style) {
 @Override
 public boolean back () {
 	htmlBytes = null;
+	closeTextStream ();
 
 	long /*int*/[] result = new long /*int*/[1];
 	int rc = webBrowser.QueryInterface (nsIWebNavigation.NS_IWEBNAVIGATION_24_IID, result);
@@ -1104,6 +1114,12 @@ public boolean close () {
 	return result[0];
 }
 
+/* Stops appending the text of a previous setText() before other content is loaded */
+void closeTextStream () {
+	if (textStream != null) textStream.close ();
+	textStream = null;
+}
+
 void createCOMInterfaces () {
 	// Create each of the interfaces that this object implements
 	supports = new XPCOMObject (new int[] {2, 0, 0}) {
@@ -1679,6 +1695,7 @@ static Browser getBrowser (long /*int*/ aDOMWindow) {
 @Override
 public boolean forward () {
 	htmlBytes = null;
+	closeTextStream ();
 
 	long /*int*/[] result = new long /*int*/[1];
 	int rc = webBrowser.QueryInterface (nsIWebNavigation.NS_IWEBNAVIGATION_24_IID, result);
@@ -1756,14 +1773,11 @@ static String getMozillaPath () {
 	long /*int*/ path = XPCOM.nsEmbedString_new ();
 	rc = mozillaDir.GetPath (path);
 	if (rc != XPCOM.NS_OK) error (rc);
-	int length = XPCOM.nsEmbedString_Length (path);
-	long /*int*/ ptr = XPCOM.nsEmbedString_get (path);
-	char[] chars = new char[length];
-	XPCOM.memmove (chars, ptr, length * 2);
+	String mozillaPath = XPCOM.nsEmbedString_toString (path);
 	XPCOM.nsEmbedString_delete (path);
 	mozillaDir.Release ();
 
-	return new String (chars) + SEPARATOR_OS;
+	return mozillaPath + SEPARATOR_OS;
 }
 
 @Override
@@ -1794,7 +1808,7 @@ public String getText () {
 	nsIComponentManager componentManager = new nsIComponentManager (result[0]);
 	result[0] = 0;
 	byte[] contractID = MozillaDelegate.wcsToMbcs (null, XPCOM.NS_DOMSERIALIZER_CONTRACTID, true);
-	char[] chars = null;
+	String text = null;
 
 	rc = componentManager.CreateInstanceByContractID (contractID, 0, nsIDOMSerializer_1_7.NS_IDOMSERIALIZER_IID, result);
 	if (rc == XPCOM.NS_OK) {	/* mozilla >= 1.7 */
@@ -1806,10 +1820,7 @@ public String getText () {
 		rc = serializer.SerializeToString (document, string);
 		serializer.Release ();
 
-		int length = XPCOM.nsEmbedString_Length (string);
-		long /*int*/ buffer = XPCOM.nsEmbedString_get (string);
-		chars = new char[length];
-		XPCOM.memmove (chars, buffer, length * 2);
+		text = XPCOM.nsEmbedString_toString (string);
 		XPCOM.nsEmbedString_delete (string);
 	} else {	/* mozilla < 1.7 */
 		rc = componentManager.CreateInstanceByContractID (contractID, 0, nsIDOMSerializer.NS_IDOMSERIALIZER_IID, result);
@@ -1821,14 +1832,12 @@ public String getText () {
 		rc = serializer.SerializeToString (document, result);
 		serializer.Release ();
 
-		int length = XPCOM.strlen_PRUnichar (result[0]);
-		chars = new char[length];
-		XPCOM.memmove (chars, result[0], length * 2);
+		text = XPCOM.PRUnichar_toString (result[0]);
 	}
 
 	componentManager.Release ();
 	new nsISupports (document).Release ();
-	return new String (chars);
+	return text;
 }
 
 @Override
@@ -1853,10 +1862,7 @@ public String getUrl () {
 		long /*int*/ aSpec = XPCOM.nsEmbedCString_new ();
 		rc = uri.GetSpec (aSpec);
 		if (rc != XPCOM.NS_OK) error (rc);
-		int length = XPCOM.nsEmbedCString_Length (aSpec);
-		long /*int*/ buffer = XPCOM.nsEmbedCString_get (aSpec);
-		dest = new byte[length];
-		XPCOM.memmove (dest, buffer, length);
+		dest = XPCOM.nsEmbedCString_getBytes (aSpec);
 		XPCOM.nsEmbedCString_delete (aSpec);
 		uri.Release ();
 	}
@@ -1905,6 +1911,71 @@ public Object getWebBrowser () {
 }
 
 static String InitDiscoverXULRunner () {
+	/*
+	* Asking the GRE registry for a XULRunner scans the registration files
+	* or registry keys of every installed GRE, so the path found is kept in
+	* a file in the user's home directory and reused by later runs as long
+	* as the XULRunner is still there.  The file is deleted if the XULRunner
+	* it names cannot be started, so the next run searches again.
+	*/
+	String key = GRERANGE_LOWER + ' ' + GRERANGE_UPPER + ' ' + Arch () + GCC3;
+	String result = ReadXULRunnerCache (key);
+	if (result != null) return result;
+	result = DiscoverXULRunner ();
+	if (result.length () > 0) WriteXULRunnerCache (key, result);
+	return result;
+}
+
+static File XULRunnerCacheFile () {
+	String home = System.getProperty ("user.home"); //$NON-NLS-1$
+	if (home == null) return null;
+	return new File (home, XULRUNNER_CACHE);
+}
+
+static String ReadXULRunnerCache (String key) {
+	File file = XULRunnerCacheFile ();
+	if (file == null || !file.exists ()) return null;
+	BufferedReader reader = null;
+	try {
+		reader = new BufferedReader (new InputStreamReader (new FileInputStream (file), "UTF-8")); //$NON-NLS-1$
+		if (!key.equals (reader.readLine ())) return null;
+		String path = reader.readLine ();
+		if (path == null || path.length () == 0 || !new File (path).exists ()) return null;
+		if (Device.DEBUG) System.out.println ("cached XULRunner: " + path); //$NON-NLS-1$
+		return path;
+	} catch (IOException e) {
+		return null;
+	} finally {
+		try {
+			if (reader != null) reader.close ();
+		} catch (IOException e) {}
+	}
+}
+
+static void WriteXULRunnerCache (String key, String path) {
+	File file = XULRunnerCacheFile ();
+	if (file == null) return;
+	Writer writer = null;
+	try {
+		File dir = file.getParentFile ();
+		if (!dir.exists () && !dir.mkdirs ()) return;
+		writer = new OutputStreamWriter (new FileOutputStream (file), "UTF-8"); //$NON-NLS-1$
+		writer.write (key + '\n' + path + '\n');
+	} catch (IOException e) {
+		/* the next run will search again */
+	} finally {
+		try {
+			if (writer != null) writer.close ();
+		} catch (IOException e) {}
+	}
+}
+
+static void DeleteXULRunnerCache () {
+	File file = XULRunnerCacheFile ();
+	if (file != null) file.delete ();
+}
+
+static String DiscoverXULRunner () {
 	/*
 	* Up to three XULRunner detection attempts will be made:
 	*
@@ -2356,10 +2427,7 @@ void initPreferences (nsIServiceManager serviceManager, nsIComponentManager comp
 			browser.dispose ();
 			error (XPCOM.NS_NOINTERFACE);
 		}
-		int length = XPCOM.strlen_PRUnichar (result[0]);
-		char[] dest = new char[length];
-		XPCOM.memmove (dest, result[0], length * 2);
-		prefLocales = new String (dest) + TOKENIZER_LOCALE;
+		prefLocales = XPCOM.PRUnichar_toString (result[0]) + TOKENIZER_LOCALE;
 	}
 	result[0] = 0;
 
@@ -2453,10 +2521,7 @@ void initPreferences (nsIServiceManager serviceManager, nsIComponentManager comp
 			browser.dispose ();
 			error (XPCOM.NS_NOINTERFACE);
 		}
-		int length = XPCOM.strlen_PRUnichar (result[0]);
-		char[] dest = new char[length];
-		XPCOM.memmove (dest, result[0], length * 2);
-		prefCharset = new String (dest);
+		prefCharset = XPCOM.PRUnichar_toString (result[0]);
 	}
 	result[0] = 0;
 
@@ -2517,10 +2582,7 @@ void initPreferences (nsIServiceManager serviceManager, nsIComponentManager comp
 			rc = value.ToString (result);
 			if (rc != XPCOM.NS_OK) error (rc);
 			if (result[0] == 0) error (XPCOM.NS_ERROR_NULL_POINTER);
-			length = XPCOM.strlen_PRUnichar (result[0]);
-			char[] dest = new char[length];
-			XPCOM.memmove (dest, result[0], length * 2);
-			oldProxyHostFTP = new String (dest);
+			oldProxyHostFTP = XPCOM.PRUnichar_toString (result[0]);
 		} else {
 			/* value is default */
 			oldProxyHostFTP = DEFAULTVALUE_STRING;
@@ -2537,10 +2599,7 @@ void initPreferences (nsIServiceManager serviceManager, nsIComponentManager comp
 			rc = value.ToString (result);
 			if (rc != XPCOM.NS_OK) error (rc);
 			if (result[0] == 0) error (XPCOM.NS_ERROR_NULL_POINTER);
-			length = XPCOM.strlen_PRUnichar (result[0]);
-			char[] dest = new char[length];
-			XPCOM.memmove (dest, result[0], length * 2);
-			oldProxyHostHTTP = new String (dest);
+			oldProxyHostHTTP = XPCOM.PRUnichar_toString (result[0]);
 		} else {
 			/* value is default */
 			oldProxyHostHTTP = DEFAULTVALUE_STRING;
@@ -2557,10 +2616,7 @@ void initPreferences (nsIServiceManager serviceManager, nsIComponentManager comp
 			rc = value.ToString (result);
 			if (rc != XPCOM.NS_OK) error (rc);
 			if (result[0] == 0) error (XPCOM.NS_ERROR_NULL_POINTER);
-			length = XPCOM.strlen_PRUnichar (result[0]);
-			char[] dest = new char[length];
-			XPCOM.memmove (dest, result[0], length * 2);
-			oldProxyHostSSL = new String (dest);
+			oldProxyHostSSL = XPCOM.PRUnichar_toString (result[0]);
 		} else {
 			/* value is default */
 			oldProxyHostSSL = DEFAULTVALUE_STRING;
@@ -2887,6 +2943,8 @@ static String error (int code) {
 }
 
 void onDispose (Display display) {
+	closeTextStream ();
+
 	/* invoke onbeforeunload handlers */
 	if (!browser.isClosing && !browser.isDisposed()) {
 		LocationListener[] oldLocationListeners = locationListeners;
@@ -3096,16 +3154,10 @@ void navigate (long /*int*/ requestHandle) {
 			long /*int*/ aHeader = args[0];
 			long /*int*/ aValue = args[1];
 
-			int length = XPCOM.nsEmbedCString_Length (aHeader);
-			long /*int*/ buffer = XPCOM.nsEmbedCString_get (aHeader);
-			byte[] dest = new byte[length];
-			XPCOM.memmove (dest, buffer, length);
+			byte[] dest = XPCOM.nsEmbedCString_getBytes (aHeader);
 			String header = new String (dest);
 
-			length = XPCOM.nsEmbedCString_Length (aValue);
-			buffer = XPCOM.nsEmbedCString_get (aValue);
-			dest = new byte[length];
-			XPCOM.memmove (dest, buffer, length);
+			dest = XPCOM.nsEmbedCString_getBytes (aValue);
 			String value = new String (dest);
 
 			headers.add(header + ':' + value);
@@ -3138,10 +3190,7 @@ void navigate (long /*int*/ requestHandle) {
 	long /*int*/ name = XPCOM.nsEmbedCString_new ();
 	rc = request.GetName (name);
 	if (rc == XPCOM.NS_OK) {
-		int length = XPCOM.nsEmbedCString_Length (name);
-		long /*int*/ buffer = XPCOM.nsEmbedCString_get (name);
-		byte[] bytes = new byte[length];
-		XPCOM.memmove (bytes, buffer, length);
+		byte[] bytes = XPCOM.nsEmbedCString_getBytes (name);
 		String value = new String (bytes);
 		if (value.indexOf (":/") != -1) url = value;	//$NON-NLS-1$
 	}
@@ -3180,6 +3229,7 @@ void onResize () {
 @Override
 public void refresh () {
 	htmlBytes = null;
+	closeTextStream ();
 
 	long /*int*/[] result = new long /*int*/[1];
 	int rc = webBrowser.QueryInterface (nsIWebNavigation.NS_IWEBNAVIGATION_24_IID, result);
@@ -3295,6 +3345,7 @@ public boolean setText (String html, boolean trusted) {
 	*  or one of its children loses focus.
 	*/
 	if (browser != browser.getDisplay ().getFocusControl ()) Deactivate ();
+	closeTextStream ();
 	
 	/* convert the String containing HTML to an array of bytes with UTF-8 data */
 	byte[] data = null;
@@ -3423,6 +3474,7 @@ public boolean setUrl (String url, String postData, String[] headers) {
 
 boolean setUrl (String url, byte[] postData, String[] headers) {
 	htmlBytes = null;
+	closeTextStream ();
 
 	long /*int*/[] result = new long /*int*/[1];
 	int rc = webBrowser.QueryInterface (nsIWebNavigation.NS_IWEBNAVIGATION_24_IID, result);
@@ -3529,6 +3581,7 @@ boolean setUrl (String url, byte[] postData, String[] headers) {
 @Override
 public void stop () {
 	htmlBytes = null;
+	closeTextStream ();
 
 	long /*int*/[] result = new long /*int*/[1];
 	int rc = webBrowser.QueryInterface (nsIWebNavigation.NS_IWEBNAVIGATION_24_IID, result);
@@ -3544,7 +3597,30 @@ public void stop () {
 	webNavigation.Release ();
 }
 
+int getDOMEventMask () {
+	int mask = 0;
+	if (browser.isListening (SWT.MouseMove)) mask |= DOM_MOUSEMOVE;
+	if (browser.isListening (SWT.MouseWheel)) mask |= DOM_MOUSEWHEEL;
+	if (browser.isListening (SWT.DragDetect)) mask |= DOM_MOUSEDRAG;
+	return mask;
+}
+
+@Override
+void hookListener (int eventType) {
+	int mask = getDOMEventMask ();
+	if ((mask & ~domEventMask) == 0) return;
+	/* hooking the same listener twice is ignored by the DOM, so hook every window again */
+	if (webBrowser != null) updateDOMListeners (true);
+}
+
 void hookDOMListeners (nsIDOMEventTarget target, boolean isTop) {
+	/*
+	* Every DOM event crosses into Java through the listener's vtable, so
+	* the mouse move, wheel and drag events that only become SWT events are
+	* not hooked while the Browser has no listener for them.  Unhooking an
+	* event that was not hooked is ignored.
+	*/
+	domEventMask = getDOMEventMask ();
 	nsEmbedString string = new nsEmbedString (XPCOM.DOMEVENT_FOCUS);
 	target.AddEventListener (string.getAddress (), domEventListener.getAddress (), 0, 1, 0);
 	string.dispose ();
@@ -3557,15 +3633,21 @@ void hookDOMListeners (nsIDOMEventTarget target, boolean isTop) {
 	string = new nsEmbedString (XPCOM.DOMEVENT_MOUSEUP);
 	target.AddEventListener (string.getAddress (), domEventListener.getAddress (), 0, 1, 0);
 	string.dispose ();
-	string = new nsEmbedString (XPCOM.DOMEVENT_MOUSEMOVE);
-	target.AddEventListener (string.getAddress (), domEventListener.getAddress (), 0, 1, 0);
-	string.dispose ();
-	string = new nsEmbedString (XPCOM.DOMEVENT_MOUSEWHEEL);
-	target.AddEventListener (string.getAddress (), domEventListener.getAddress (), 0, 1, 0);
-	string.dispose ();
-	string = new nsEmbedString (XPCOM.DOMEVENT_MOUSEDRAG);
-	target.AddEventListener (string.getAddress (), domEventListener.getAddress (), 0, 1, 0);
-	string.dispose ();
+	if ((domEventMask & DOM_MOUSEMOVE) != 0) {
+		string = new nsEmbedString (XPCOM.DOMEVENT_MOUSEMOVE);
+		target.AddEventListener (string.getAddress (), domEventListener.getAddress (), 0, 1, 0);
+		string.dispose ();
+	}
+	if ((domEventMask & DOM_MOUSEWHEEL) != 0) {
+		string = new nsEmbedString (XPCOM.DOMEVENT_MOUSEWHEEL);
+		target.AddEventListener (string.getAddress (), domEventListener.getAddress (), 0, 1, 0);
+		string.dispose ();
+	}
+	if ((domEventMask & DOM_MOUSEDRAG) != 0) {
+		string = new nsEmbedString (XPCOM.DOMEVENT_MOUSEDRAG);
+		target.AddEventListener (string.getAddress (), domEventListener.getAddress (), 0, 1, 0);
+		string.dispose ();
+	}
 
 	/*
 	* Only hook mouseover and mouseout if the target is a top-level frame, so that mouse moves
@@ -3592,6 +3674,10 @@ void hookDOMListeners (nsIDOMEventTarget target, boolean isTop) {
 }
 
 void unhookDOMListeners () {
+	updateDOMListeners (false);
+}
+
+void updateDOMListeners (boolean hook) {
 	long /*int*/[] result = new long /*int*/[1];
 	int rc = webBrowser.GetContentDOMWindow (result);
 	if (rc != XPCOM.NS_OK || result[0] == 0) return;
@@ -3603,10 +3689,14 @@ void unhookDOMListeners () {
 	if (result[0] == 0) error (XPCOM.NS_ERROR_NO_INTERFACE);
 	nsIDOMEventTarget target = new nsIDOMEventTarget (result[0]);
 	result[0] = 0;
-	unhookDOMListeners (target);
+	if (hook) {
+		hookDOMListeners (target, true);
+	} else {
+		unhookDOMListeners (target);
+	}
 	target.Release ();
 
-	/* Listeners must be unhooked in pages contained in frames */
+	/* Listeners must be hooked or unhooked in pages contained in frames */
 	rc = window.GetFrames (result);
 	if (rc != XPCOM.NS_OK) error (rc);
 	if (result[0] == 0) error (XPCOM.NS_ERROR_NO_INTERFACE);
@@ -3631,7 +3721,11 @@ void unhookDOMListeners () {
 
 			target = new nsIDOMEventTarget (result[0]);
 			result[0] = 0;
-			unhookDOMListeners (target);
+			if (hook) {
+				hookDOMListeners (target, false);
+			} else {
+				unhookDOMListeners (target);
+			}
 			target.Release ();
 			frame.Release ();
 		}
@@ -3836,10 +3930,7 @@ int OnStateChange (long /*int*/ aWebProgress, long /*int*/ aRequest, int aStateF
 		long /*int*/ name = XPCOM.nsEmbedCString_new ();
 		int rc = request.GetName (name);
 		if (rc == XPCOM.NS_OK) {
-			int length = XPCOM.nsEmbedCString_Length (name);
-			long /*int*/ buffer = XPCOM.nsEmbedCString_get (name);
-			byte[] bytes = new byte[length];
-			XPCOM.memmove (bytes, buffer, length);
+			byte[] bytes = XPCOM.nsEmbedCString_getBytes (name);
 			String value = new String (bytes);
 			if (value.indexOf (":/") != -1) { //$NON-NLS-1$
 				boolean doit = sendChangingEvent (value);
@@ -3985,10 +4076,7 @@ int OnStateChange (long /*int*/ aWebProgress, long /*int*/ aRequest, int aStateF
 			long /*int*/ name = XPCOM.nsEmbedCString_new ();
 			rc = req.GetName (name);
 			if (rc != XPCOM.NS_OK) error (rc);
-			int length = XPCOM.nsEmbedCString_Length (name);
-			long /*int*/ buffer = XPCOM.nsEmbedCString_get (name);
-			byte[] dest = new byte[length];
-			XPCOM.memmove (dest, buffer, length);
+			byte[] dest = XPCOM.nsEmbedCString_getBytes (name);
 			String url = new String (dest);
 			XPCOM.nsEmbedCString_delete (name);
 
@@ -4061,31 +4149,22 @@ int OnStateChange (long /*int*/ aWebProgress, long /*int*/ aRequest, int aStateF
 				*/
 				registerFunctionsOnState = nsIWebProgressListener.STATE_IS_REQUEST | nsIWebProgressListener.STATE_START;
 
-				long /*int*/ ptr = C.malloc (htmlBytes.length);
-				XPCOM.memmove (ptr, htmlBytes, htmlBytes.length);
-				int pageSize = 8192;
-				int pageCount = htmlBytes.length / pageSize + 1;
-				long /*int*/ current = ptr;
-				for (int i = 0; i < pageCount; i++) {
-					length = i == pageCount - 1 ? htmlBytes.length % pageSize : pageSize;
-					if (length > 0) {
-						rc = stream.AppendToStream (current, length);
-						if (rc != XPCOM.NS_OK) error (rc);
-					}
-					current += pageSize;
-				}
-				rc = stream.CloseStream ();
-				if (rc != XPCOM.NS_OK) error (rc);
-				C.free (ptr);
+				/*
+				* Append the text one chunk per event loop iteration, so that large documents
+				* are painted while they are parsed and the UI is not blocked meanwhile.  The
+				* text stream takes over the reference to the stream and closes it at the end.
+				*/
+				closeTextStream ();
+				textStream = new TextStream (browser.getDisplay (), stream, htmlBytes);
+				textStream.run ();
 				XPCOM.nsEmbedCString_delete (aContentType);
-				stream.Release ();
 				uri.Release ();
 				htmlBytes = null;
 				/*
 				* Browser content that is set via nsIWebBrowserStream is not parsed immediately.
 				* Since clients depend on the Completed event to know when the browser's content
-				* is available, delay the sending of this event so that the stream content will
-				* be parsed first.
+				* is available, delay the sending of this event until the text stream has been
+				* closed, so that the stream content will be parsed first.
 				*/
 				deferCompleted = true;
 
@@ -4148,7 +4227,9 @@ int OnStateChange (long /*int*/ aWebProgress, long /*int*/ aRequest, int aStateF
 					}
 				}
 			};
-			if (deferCompleted) {
+			if (deferCompleted && textStream != null && !textStream.isClosed ()) {
+				textStream.completed = runnable;
+			} else if (deferCompleted) {
 				display.asyncExec (runnable);
 			} else {
 				display.syncExec (runnable);
@@ -4184,10 +4265,7 @@ int OnStateChange (long /*int*/ aWebProgress, long /*int*/ aRequest, int aStateF
 				long /*int*/ aSpec = XPCOM.nsEmbedCString_new ();
 				rc = uri.GetSpec (aSpec);
 				if (rc != XPCOM.NS_OK) error (rc);
-				int length = XPCOM.nsEmbedCString_Length (aSpec);
-				long /*int*/ buffer = XPCOM.nsEmbedCString_get (aSpec);
-				byte[] bytes = new byte[length];
-				XPCOM.memmove (bytes, buffer, length);
+				byte[] bytes = XPCOM.nsEmbedCString_getBytes (aSpec);
 				lastNavigateURL = new String (bytes);
 				XPCOM.nsEmbedCString_delete (aSpec);
 				uri.Release ();
@@ -4286,10 +4364,7 @@ int OnLocationChange (long /*int*/ aWebProgress, long /*int*/ aRequest, long /*i
 	nsIURI location = new nsIURI (aLocation);
 	long /*int*/ aSpec = XPCOM.nsEmbedCString_new ();
 	location.GetSpec (aSpec);
-	int length = XPCOM.nsEmbedCString_Length (aSpec);
-	long /*int*/ buffer = XPCOM.nsEmbedCString_get (aSpec);
-	byte[] dest = new byte[length];
-	XPCOM.memmove (dest, buffer, length);
+	byte[] dest = XPCOM.nsEmbedCString_getBytes (aSpec);
 	XPCOM.nsEmbedCString_delete (aSpec);
 	String url = new String (dest);
 
@@ -4312,7 +4387,7 @@ int OnLocationChange (long /*int*/ aWebProgress, long /*int*/ aRequest, long /*i
 	if (event.location.equals (URI_FILEROOT)) {
 		event.location = ABOUT_BLANK;
 	} else {
-		length = URI_FILEROOT.length ();
+		int length = URI_FILEROOT.length ();
 		if (event.location.startsWith (URI_FILEROOT) && event.location.charAt (length) == '#') {
 			event.location = ABOUT_BLANK + event.location.substring (length);
 		}
@@ -4329,10 +4404,7 @@ int OnStatusChange (long /*int*/ aWebProgress, long /*int*/ aRequest, int aStatu
 	StatusTextEvent event = new StatusTextEvent (browser);
 	event.display = browser.getDisplay ();
 	event.widget = browser;
-	int length = XPCOM.strlen_PRUnichar (aMessage);
-	char[] dest = new char[length];
-	XPCOM.memmove (dest, aMessage, length * 2);
-	event.text = new String (dest);
+	event.text = XPCOM.PRUnichar_toString (aMessage);
 	for (int i = 0; i < statusTextListeners.length; i++) {
 		statusTextListeners[i].changed (event);
 	}
@@ -4350,10 +4422,7 @@ int SetStatus (int statusType, long /*int*/ status) {
 	StatusTextEvent event = new StatusTextEvent (browser);
 	event.display = browser.getDisplay ();
 	event.widget = browser;
-	int length = XPCOM.strlen_PRUnichar (status);
-	char[] dest = new char[length];
-	XPCOM.memmove (dest, status, length * 2);
-	String string = new String (dest);
+	String string = XPCOM.PRUnichar_toString (status);
 	event.text = string;
 	for (int i = 0; i < statusTextListeners.length; i++) {
 		statusTextListeners[i].changed (event);
@@ -4691,11 +4760,7 @@ int OnStartURIOpen (long /*int*/ aURI, long /*int*/ retval) {
 	nsIURI location = new nsIURI (aURI);
 	long /*int*/ aSpec = XPCOM.nsEmbedCString_new ();
 	location.GetSpec (aSpec);
-	int length = XPCOM.nsEmbedCString_Length (aSpec);
-	long /*int*/ buffer = XPCOM.nsEmbedCString_get (aSpec);
-	buffer = XPCOM.nsEmbedCString_get (aSpec);
-	byte[] dest = new byte[length];
-	XPCOM.memmove (dest, buffer, length);
+	byte[] dest = XPCOM.nsEmbedCString_getBytes (aSpec);
 	XPCOM.nsEmbedCString_delete (aSpec);
 	String value = new String (dest);
 
@@ -4801,10 +4866,7 @@ int SetParentContentListener (long /*int*/ aParentContentListener) {
 /* nsITooltipListener */
 
 int OnShowTooltip (int aXCoords, int aYCoords, long /*int*/ aTipText) {
-	int length = XPCOM.strlen_PRUnichar (aTipText);
-	char[] dest = new char[length];
-	XPCOM.memmove (dest, aTipText, length * 2);
-	String text = new String (dest);
+	String text = XPCOM.PRUnichar_toString (aTipText);
 	if (tip != null && !tip.isDisposed ()) tip.dispose ();
 	Display display = browser.getDisplay ();
 	Shell parent = browser.getShell ();
@@ -4841,11 +4903,7 @@ int HandleEvent (long /*int*/ event) {
 	long /*int*/ type = XPCOM.nsEmbedString_new ();
 	int rc = domEvent.GetType (type);
 	if (rc != XPCOM.NS_OK) error (rc);
-	int length = XPCOM.nsEmbedString_Length (type);
-	long /*int*/ buffer = XPCOM.nsEmbedString_get (type);
-	char[] chars = new char[length];
-	XPCOM.memmove (chars, buffer, length * 2);
-	String typeString = new String (chars);
+	String typeString = XPCOM.nsEmbedString_toString (type);
 	XPCOM.nsEmbedString_delete (type);
 
 	if (XPCOM.DOMEVENT_UNLOAD.equals (typeString)) {
@@ -5206,10 +5264,7 @@ int HandleEvent (long /*int*/ event) {
 
 int NotifyCertProblem (long /*int*/ socketInfo, long /*int*/ status, long /*int*/ targetSite, long /*int*/ _suppressError) {
 	/* determine the host name and port */
-	int length = XPCOM.nsEmbedCString_Length (targetSite);
-	long /*int*/ buffer = XPCOM.nsEmbedCString_get (targetSite);
-	byte[] dest = new byte[length];
-	XPCOM.memmove (dest, buffer, length);
+	byte[] dest = XPCOM.nsEmbedCString_getBytes (targetSite);
 	final String urlPort = new String (dest);
 	int index = urlPort.indexOf (':');
 	final String host = urlPort.substring (0,index);
@@ -5243,11 +5298,7 @@ int NotifyCertProblem (long /*int*/ socketInfo, long /*int*/ status, long /*int*
 		long /*int*/ ptr = XPCOM.nsEmbedString_new ();
 		rc = cert.GetCommonName (ptr);
 		if (rc != XPCOM.NS_OK) SWT.error (rc);
-		length = XPCOM.nsEmbedString_Length (ptr);
-		buffer = XPCOM.nsEmbedString_get (ptr);
-		char[] chars = new char[length];
-		XPCOM.memmove (chars, buffer, length * 2);
-		String name = new String (chars);
+		String name = XPCOM.nsEmbedString_toString (ptr);
 		problems[problemCount++] = Compatibility.getMessage ("SWT_InvalidCert_InvalidName", new String[] {name}); //$NON-NLS-1$
 		flags |= nsICertOverrideService.ERROR_MISMATCH;
 		XPCOM.nsEmbedString_delete (ptr);
@@ -5266,21 +5317,13 @@ int NotifyCertProblem (long /*int*/ socketInfo, long /*int*/ status, long /*int*
 		long /*int*/ ptr = XPCOM.nsEmbedString_new ();
 		rc = validity.GetNotBeforeGMT (ptr);
 		if (rc != XPCOM.NS_OK) SWT.error (rc);
-		length = XPCOM.nsEmbedString_Length (ptr);
-		buffer = XPCOM.nsEmbedString_get (ptr);
-		char[] chars = new char[length];
-		XPCOM.memmove (chars, buffer, length * 2);
-		String notBefore = new String (chars);
+		String notBefore = XPCOM.nsEmbedString_toString (ptr);
 		XPCOM.nsEmbedString_delete (ptr);
 
 		ptr = XPCOM.nsEmbedString_new ();
 		rc = validity.GetNotAfterGMT (ptr);
 		if (rc != XPCOM.NS_OK) SWT.error (rc);
-		length = XPCOM.nsEmbedString_Length (ptr);
-		buffer = XPCOM.nsEmbedString_get (ptr);
-		chars = new char[length];
-		XPCOM.memmove (chars, buffer, length * 2);
-		String notAfter = new String (chars);
+		String notAfter = XPCOM.nsEmbedString_toString (ptr);
 		XPCOM.nsEmbedString_delete (ptr);
 
 		String range = notBefore + " - " + notAfter; //$NON-NLS-1$
@@ -5295,11 +5338,7 @@ int NotifyCertProblem (long /*int*/ socketInfo, long /*int*/ status, long /*int*
 		long /*int*/ ptr = XPCOM.nsEmbedString_new ();
 		rc = cert.GetIssuerCommonName (ptr);
 		if (rc != XPCOM.NS_OK) SWT.error (rc);
-		length = XPCOM.nsEmbedString_Length (ptr);
-		buffer = XPCOM.nsEmbedString_get (ptr);
-		char[] chars = new char[length];
-		XPCOM.memmove (chars, buffer, length * 2);
-		String name = new String (chars);
+		String name = XPCOM.nsEmbedString_toString (ptr);
 		problems[problemCount++] = Compatibility.getMessage ("SWT_InvalidCert_NotTrusted", new String[] {name}); //$NON-NLS-1$
 		flags |= nsICertOverrideService.ERROR_UNTRUSTED;
 		XPCOM.nsEmbedString_delete (ptr);
@@ -154,21 +154,13 @@ int PromptAuth(long /*int*/ aChannel, int level, long /*int*/ authInfo, long /*i
 	long /*int*/ ptr = XPCOM.nsEmbedString_new ();
 	int rc = auth.GetUsername (ptr);
 	if (rc != XPCOM.NS_OK) SWT.error (rc);
-	int length = XPCOM.nsEmbedString_Length (ptr);
-	long /*int*/ buffer = XPCOM.nsEmbedString_get (ptr);
-	char[] chars = new char[length];
-	XPCOM.memmove (chars, buffer, length * 2);
-	userLabel[0] = new String (chars);
+	userLabel[0] = XPCOM.nsEmbedString_toString (ptr);
 	XPCOM.nsEmbedString_delete (ptr);
 
 	ptr = XPCOM.nsEmbedString_new ();
 	rc = auth.GetPassword (ptr);
 	if (rc != XPCOM.NS_OK) SWT.error (rc);
-	length = XPCOM.nsEmbedString_Length (ptr);
-	buffer = XPCOM.nsEmbedString_get (ptr);
-	chars = new char[length];
-	XPCOM.memmove (chars, buffer, length * 2);
-	passLabel[0] = new String (chars);
+	passLabel[0] = XPCOM.nsEmbedString_toString (ptr);
 	XPCOM.nsEmbedString_delete (ptr);
 
 	/* compute the message text */
@@ -176,11 +168,7 @@ int PromptAuth(long /*int*/ aChannel, int level, long /*int*/ authInfo, long /*i
 	ptr = XPCOM.nsEmbedString_new ();
 	rc = auth.GetRealm (ptr);
 	if (rc != XPCOM.NS_OK) SWT.error (rc);
-	length = XPCOM.nsEmbedString_Length (ptr);
-	buffer = XPCOM.nsEmbedString_get (ptr);
-	chars = new char[length];
-	XPCOM.memmove (chars, buffer, length * 2);
-	String realm = new String (chars);
+	String realm = XPCOM.nsEmbedString_toString (ptr);
 	XPCOM.nsEmbedString_delete (ptr);
 
 	nsIChannel channel = new nsIChannel (aChannel);
@@ -193,10 +181,7 @@ int PromptAuth(long /*int*/ aChannel, int level, long /*int*/ authInfo, long /*i
 	long /*int*/ host = XPCOM.nsEmbedCString_new ();
 	rc = nsURI.GetHost (host);
 	if (rc != XPCOM.NS_OK) SWT.error (rc);
-	length = XPCOM.nsEmbedCString_Length (host);
-	buffer = XPCOM.nsEmbedCString_get (host);
-	byte[] bytes = new byte[length];
-	XPCOM.memmove (bytes, buffer, length);
+	byte[] bytes = XPCOM.nsEmbedCString_getBytes (host);
 	String hostString = new String (bytes);
 	XPCOM.nsEmbedCString_delete (host);
 	nsURI.Release ();
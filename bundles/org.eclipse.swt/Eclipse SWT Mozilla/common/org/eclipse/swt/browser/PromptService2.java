@@ -165,10 +165,7 @@ String getLabel (int buttonFlag, int index, long /*int*/ buttonTitle) {
 		case nsIPromptService.BUTTON_TITLE_SAVE : label = SWT.getMessage ("SWT_Save"); break; //$NON-NLS-1$
 		case nsIPromptService.BUTTON_TITLE_YES : label = SWT.getMessage ("SWT_Yes"); break; //$NON-NLS-1$
 		case nsIPromptService.BUTTON_TITLE_IS_STRING : {
-			int length = XPCOM.strlen_PRUnichar (buttonTitle);
-			char[] dest = new char[length];
-			XPCOM.memmove (dest, buttonTitle, length * 2);
-			label = new String (dest);
+			label = XPCOM.PRUnichar_toString (buttonTitle);
 		}
 	}
 	return label;
@@ -179,15 +176,9 @@ String getLabel (int buttonFlag, int index, long /*int*/ buttonTitle) {
 int Alert (long /*int*/ aParent, long /*int*/ aDialogTitle, long /*int*/ aText) {
 	final Browser browser = getBrowser (aParent);
 	
-	int length = XPCOM.strlen_PRUnichar (aDialogTitle);
-	char[] dest = new char[length];
-	XPCOM.memmove (dest, aDialogTitle, length * 2);
-	String titleLabel = new String (dest);
+	String titleLabel = XPCOM.PRUnichar_toString (aDialogTitle);
 
-	length = XPCOM.strlen_PRUnichar (aText);
-	dest = new char[length];
-	XPCOM.memmove (dest, aText, length * 2);
-	String textLabel = new String (dest);
+	String textLabel = XPCOM.PRUnichar_toString (aText);
 
 	/*
 	* If mozilla is re-navigating to a page with a bad certificate in order
@@ -209,20 +200,11 @@ int Alert (long /*int*/ aParent, long /*int*/ aDialogTitle, long /*int*/ aText)
 int AlertCheck (long /*int*/ aParent, long /*int*/ aDialogTitle, long /*int*/ aText, long /*int*/ aCheckMsg, long /*int*/ aCheckState) {
 	Browser browser = getBrowser (aParent);
 	
-	int length = XPCOM.strlen_PRUnichar (aDialogTitle);
-	char[] dest = new char[length];
-	XPCOM.memmove (dest, aDialogTitle, length * 2);
-	String titleLabel = new String (dest);
+	String titleLabel = XPCOM.PRUnichar_toString (aDialogTitle);
 
-	length = XPCOM.strlen_PRUnichar (aText);
-	dest = new char[length];
-	XPCOM.memmove (dest, aText, length * 2);
-	String textLabel = new String (dest);
+	String textLabel = XPCOM.PRUnichar_toString (aText);
 
-	length = XPCOM.strlen_PRUnichar (aCheckMsg);
-	dest = new char[length];
-	XPCOM.memmove (dest, aCheckMsg, length * 2);
-	String checkLabel = new String (dest);
+	String checkLabel = XPCOM.PRUnichar_toString (aCheckMsg);
 
 	Shell shell = browser == null ? new Shell () : browser.getShell ();
 	PromptDialog dialog = new PromptDialog (shell);
@@ -245,15 +227,9 @@ int Confirm (long /*int*/ aParent, long /*int*/ aDialogTitle, long /*int*/ aText
 		return XPCOM.NS_OK;
 	}
 
-	int length = XPCOM.strlen_PRUnichar (aDialogTitle);
-	char[] dest = new char[length];
-	XPCOM.memmove (dest, aDialogTitle, length * 2);
-	String titleLabel = new String (dest);
+	String titleLabel = XPCOM.PRUnichar_toString (aDialogTitle);
 
-	length = XPCOM.strlen_PRUnichar (aText);
-	dest = new char[length];
-	XPCOM.memmove (dest, aText, length * 2);
-	String textLabel = new String (dest);
+	String textLabel = XPCOM.PRUnichar_toString (aText);
 
 	Shell shell = browser == null ? new Shell () : browser.getShell ();
 	MessageBox messageBox = new MessageBox (shell, SWT.OK | SWT.CANCEL | SWT.ICON_QUESTION);
@@ -272,22 +248,13 @@ int ConfirmCheck (long /*int*/ aParent, long /*int*/ aDialogTitle, long /*int*/
 int ConfirmEx (long /*int*/ aParent, long /*int*/ aDialogTitle, long /*int*/ aText, int aButtonFlags, long /*int*/ aButton0Title, long /*int*/ aButton1Title, long /*int*/ aButton2Title, long /*int*/ aCheckMsg, long /*int*/ aCheckState, long /*int*/ _retval) {
 	Browser browser = getBrowser (aParent);
 	
-	int length = XPCOM.strlen_PRUnichar (aDialogTitle);
-	char[] dest = new char[length];
-	XPCOM.memmove (dest, aDialogTitle, length * 2);
-	String titleLabel = new String (dest);
-
-	length = XPCOM.strlen_PRUnichar (aText);
-	dest = new char[length];
-	XPCOM.memmove (dest, aText, length * 2);
-	String textLabel = new String (dest);
+	String titleLabel = XPCOM.PRUnichar_toString (aDialogTitle);
+
+	String textLabel = XPCOM.PRUnichar_toString (aText);
 	
 	String checkLabel = null;
 	if (aCheckMsg != 0) {
-		length = XPCOM.strlen_PRUnichar (aCheckMsg);
-		dest = new char[length];
-		XPCOM.memmove (dest, aCheckMsg, length * 2);
-		checkLabel = new String (dest);
+		checkLabel = XPCOM.PRUnichar_toString (aCheckMsg);
 	}
 	
 	String button0Label = getLabel (aButtonFlags, nsIPromptService.BUTTON_POS_0, aButton0Title);
@@ -319,24 +286,15 @@ int Prompt (long /*int*/ aParent, long /*int*/ aDialogTitle, long /*int*/ aText,
 	char[] dest;
 	int length;
 	if (aDialogTitle != 0) {
-		length = XPCOM.strlen_PRUnichar (aDialogTitle);
-		dest = new char[length];
-		XPCOM.memmove (dest, aDialogTitle, length * 2);
-		titleLabel = new String (dest);
+		titleLabel = XPCOM.PRUnichar_toString (aDialogTitle);
 	}
 	
-	length = XPCOM.strlen_PRUnichar (aText);
-	dest = new char[length];
-	XPCOM.memmove (dest, aText, length * 2);
-	textLabel = new String (dest);
+	textLabel = XPCOM.PRUnichar_toString (aText);
 	
 	long /*int*/[] valueAddr = new long /*int*/[1];
 	XPCOM.memmove (valueAddr, aValue, C.PTR_SIZEOF);
 	if (valueAddr[0] != 0) {
-		length = XPCOM.strlen_PRUnichar (valueAddr[0]);
-		dest = new char[length];
-		XPCOM.memmove (dest, valueAddr[0], length * 2);
-		valueLabel[0] = new String (dest);		
+		valueLabel[0] = XPCOM.PRUnichar_toString (valueAddr[0]);		
 	}
 	
 	if (aCheckMsg != 0) {
@@ -443,10 +401,7 @@ int PromptAuth(long /*int*/ aParent, long /*int*/ aChannel, int level, long /*in
 	String title = SWT.getMessage ("SWT_Authentication_Required"); //$NON-NLS-1$
 
 	if (checkboxLabel != 0 && checkboxValue != 0) {
-		int length = XPCOM.strlen_PRUnichar (checkboxLabel);
-		char[] dest = new char[length];
-		XPCOM.memmove (dest, checkboxLabel, length * 2);
-		checkLabel = new String (dest);
+		checkLabel = XPCOM.PRUnichar_toString (checkboxLabel);
 		XPCOM.memmove (checkValue, checkboxValue);
 	}
 
@@ -455,21 +410,13 @@ int PromptAuth(long /*int*/ aParent, long /*int*/ aChannel, int level, long /*in
 	long /*int*/ ptr = XPCOM.nsEmbedString_new ();
 	int rc = auth.GetUsername (ptr);
 	if (rc != XPCOM.NS_OK) SWT.error (rc);
-	int length = XPCOM.nsEmbedString_Length (ptr);
-	long /*int*/ buffer = XPCOM.nsEmbedString_get (ptr);
-	char[] chars = new char[length];
-	XPCOM.memmove (chars, buffer, length * 2);
-	userLabel[0] = new String (chars);
+	userLabel[0] = XPCOM.nsEmbedString_toString (ptr);
 	XPCOM.nsEmbedString_delete (ptr);
 
 	ptr = XPCOM.nsEmbedString_new ();
 	rc = auth.GetPassword (ptr);
 	if (rc != XPCOM.NS_OK) SWT.error (rc);
-	length = XPCOM.nsEmbedString_Length (ptr);
-	buffer = XPCOM.nsEmbedString_get (ptr);
-	chars = new char[length];
-	XPCOM.memmove (chars, buffer, length * 2);
-	passLabel[0] = new String (chars);
+	passLabel[0] = XPCOM.nsEmbedString_toString (ptr);
 	XPCOM.nsEmbedString_delete (ptr);
 
 	/* compute the message text */
@@ -477,11 +424,7 @@ int PromptAuth(long /*int*/ aParent, long /*int*/ aChannel, int level, long /*in
 	ptr = XPCOM.nsEmbedString_new ();
 	rc = auth.GetRealm (ptr);
 	if (rc != XPCOM.NS_OK) SWT.error (rc);
-	length = XPCOM.nsEmbedString_Length (ptr);
-	buffer = XPCOM.nsEmbedString_get (ptr);
-	chars = new char[length];
-	XPCOM.memmove (chars, buffer, length * 2);
-	String realm = new String (chars);
+	String realm = XPCOM.nsEmbedString_toString (ptr);
 	XPCOM.nsEmbedString_delete (ptr);
 
 	nsIChannel channel = new nsIChannel (aChannel);
@@ -494,10 +437,7 @@ int PromptAuth(long /*int*/ aParent, long /*int*/ aChannel, int level, long /*in
 	long /*int*/ host = XPCOM.nsEmbedCString_new ();
 	rc = nsURI.GetHost (host);
 	if (rc != XPCOM.NS_OK) SWT.error (rc);
-	length = XPCOM.nsEmbedCString_Length (host);
-	buffer = XPCOM.nsEmbedCString_get (host);
-	byte[] bytes = new byte[length];
-	XPCOM.memmove (bytes, buffer, length);
+	byte[] bytes = XPCOM.nsEmbedCString_getBytes (host);
 	String hostString = new String (bytes);
 	XPCOM.nsEmbedCString_delete (host);
 	nsURI.Release ();
@@ -570,35 +510,23 @@ int PromptUsernameAndPassword (long /*int*/ aParent, long /*int*/ aDialogTitle,
 		char[] dest;
 		int length;
 		if (aDialogTitle != 0) {
-			length = XPCOM.strlen_PRUnichar (aDialogTitle);
-			dest = new char[length];
-			XPCOM.memmove (dest, aDialogTitle, length * 2);
-			titleLabel = new String (dest);
+			titleLabel = XPCOM.PRUnichar_toString (aDialogTitle);
 		} else {
 			titleLabel = SWT.getMessage ("SWT_Authentication_Required");	//$NON-NLS-1$
 		}
 		
-		length = XPCOM.strlen_PRUnichar (aText);
-		dest = new char[length];
-		XPCOM.memmove (dest, aText, length * 2);
-		textLabel = new String (dest);
+		textLabel = XPCOM.PRUnichar_toString (aText);
 
 		long /*int*/[] userAddr = new long /*int*/[1];
 		XPCOM.memmove (userAddr, aUsername, C.PTR_SIZEOF);
 		if (userAddr[0] != 0) {
-			length = XPCOM.strlen_PRUnichar (userAddr[0]);
-			dest = new char[length];
-			XPCOM.memmove (dest, userAddr[0], length * 2);
-			userLabel[0] = new String (dest);		
+			userLabel[0] = XPCOM.PRUnichar_toString (userAddr[0]);		
 		}
 
 		long /*int*/[] passAddr = new long /*int*/[1];
 		XPCOM.memmove (passAddr, aPassword, C.PTR_SIZEOF);
 		if (passAddr[0] != 0) {
-			length = XPCOM.strlen_PRUnichar (passAddr[0]);
-			dest = new char[length];
-			XPCOM.memmove (dest, passAddr[0], length * 2);
-			passLabel[0] = new String (dest);		
+			passLabel[0] = XPCOM.PRUnichar_toString (passAddr[0]);		
 		}
 		
 		if (aCheckMsg != 0) {
@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * Copyright (c) 2014 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.browser;
+
+import org.eclipse.swt.internal.C;
+import org.eclipse.swt.internal.mozilla.*;
+import org.eclipse.swt.widgets.*;
+
+/*
+* Appends the text of Browser.setText() to an open nsIWebBrowserStream one
+* chunk per event loop iteration, so that Mozilla parses and paints a large
+* document while it is being appended instead of blocking the UI until all
+* of it has been copied in.  Only one chunk is in native memory at a time.
+*/
+class TextStream implements Runnable {
+	Display display;
+	nsIWebBrowserStream stream;
+	byte[] bytes, chunk;
+	int index;
+	long /*int*/ buffer;
+	Runnable completed;
+
+	static final int CHUNK_SIZE = 65536;
+
+/* Takes over the reference to the stream, which must be open */
+TextStream (Display display, nsIWebBrowserStream stream, byte[] bytes) {
+	this.display = display;
+	this.stream = stream;
+	this.bytes = bytes;
+	chunk = new byte[Math.min (CHUNK_SIZE, bytes.length)];
+	if (chunk.length > 0) buffer = C.malloc (chunk.length);
+}
+
+/* Stops appending and closes the stream, leaving the document as far as it got, without a Completed event */
+void close () {
+	if (stream == null) return;
+	stream.CloseStream ();
+	stream.Release ();
+	stream = null;
+	if (buffer != 0) C.free (buffer);
+	buffer = 0;
+	bytes = chunk = null;
+}
+
+boolean isClosed () {
+	return stream == null;
+}
+
+public void run () {
+	if (stream == null) return;
+	int length = Math.min (chunk.length, bytes.length - index);
+	if (length > 0) {
+		System.arraycopy (bytes, index, chunk, 0, length);
+		C.memmove (buffer, chunk, length);
+		/* a failed append ends the document where it is */
+		int rc = stream.AppendToStream (buffer, length);
+		index = rc == XPCOM.NS_OK ? index + length : bytes.length;
+	}
+	if (index < bytes.length) {
+		display.asyncExec (this);
+		return;
+	}
+	close ();
+	/*
+	* Content appended to the stream is not parsed immediately, so the
+	* Completed event of the page is sent after the stream has been closed.
+	*/
+	if (completed != null) display.asyncExec (completed);
+	completed = null;
+}
+}
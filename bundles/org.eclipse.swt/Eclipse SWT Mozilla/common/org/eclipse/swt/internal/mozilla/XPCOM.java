@@ -235,6 +235,8 @@ public static final native void memmove(nsID dest, long /*int*/ src, int nbytes)
 public static final native void memmove(long /*int*/ dest, nsID src, int nbytes);
 /** @method flags=no_gen */
 public static final native int strlen_PRUnichar(long /*int*/ s);
+/** @method flags=no_gen */
+public static final native String PRUnichar_toString(long /*int*/ s);
 
 /** @method flags=no_gen */
 public static final native long /*int*/ CALLBACK_GetScriptableFlags24(long /*int*/ func);
@@ -532,6 +534,16 @@ public static final long /*int*/ nsEmbedCString_get(long /*int*/ ptr) {
 		lock.unlock();
 	}
 }
+/** @method flags=no_gen */
+public static final native byte[] _nsEmbedCString_getBytes(long /*int*/ ptr);
+public static final byte[] nsEmbedCString_getBytes(long /*int*/ ptr) {
+	lock.lock();
+	try {
+		return _nsEmbedCString_getBytes(ptr);
+	} finally {
+		lock.unlock();
+	}
+}
 /**
  * @method flags=delete
  * @param ptr cast=(nsID *)
@@ -631,6 +643,26 @@ public static final long /*int*/ nsEmbedString_get(long /*int*/ ptr) {
 		lock.unlock();
 	}
 }
+/** @method flags=no_gen */
+public static final native long /*int*/ _nsEmbedString_newString(String aString);
+public static final long /*int*/ nsEmbedString_newString(String aString) {
+	lock.lock();
+	try {
+		return _nsEmbedString_newString(aString);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @method flags=no_gen */
+public static final native String _nsEmbedString_toString(long /*int*/ ptr);
+public static final String nsEmbedString_toString(long /*int*/ ptr) {
+	lock.lock();
+	try {
+		return _nsEmbedString_toString(ptr);
+	} finally {
+		lock.unlock();
+	}
+}
 /**
  * @method flags=cpp
  * @param ptr cast=(nsIMemory *)
@@ -750,6 +782,65 @@ public static final int Call(long /*int*/ ptr, long /*int*/ aLibXULDirectory, lo
 	}
 }
 
+/**
+ * Returns the function stored at index <code>fnNumber</code> of the vtable
+ * of <code>ppVtbl</code>.  The result can be called any number of times on
+ * objects of the same class with <code>VtblInvoke</code>, which passes
+ * every argument as a pointer sized value, instead of looking it up on
+ * each call.
+ *
+ * @method flags=no_gen
+ */
+static final native long /*int*/ _VtblResolve(int fnNumber, long /*int*/ ppVtbl);
+static final long /*int*/ VtblResolve(int fnNumber, long /*int*/ ppVtbl) {
+	lock.lock();
+	try {
+		return _VtblResolve(fnNumber, ppVtbl);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @method flags=no_gen */
+static final native int _VtblInvoke0(long /*int*/ fn, long /*int*/ ppVtbl);
+static final int VtblInvoke(long /*int*/ fn, long /*int*/ ppVtbl) {
+	lock.lock();
+	try {
+		return _VtblInvoke0(fn, ppVtbl);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @method flags=no_gen */
+static final native int _VtblInvoke1(long /*int*/ fn, long /*int*/ ppVtbl, long /*int*/ arg0);
+static final int VtblInvoke(long /*int*/ fn, long /*int*/ ppVtbl, long /*int*/ arg0) {
+	lock.lock();
+	try {
+		return _VtblInvoke1(fn, ppVtbl, arg0);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @method flags=no_gen */
+static final native int _VtblInvoke2(long /*int*/ fn, long /*int*/ ppVtbl, long /*int*/ arg0, long /*int*/ arg1);
+static final int VtblInvoke(long /*int*/ fn, long /*int*/ ppVtbl, long /*int*/ arg0, long /*int*/ arg1) {
+	lock.lock();
+	try {
+		return _VtblInvoke2(fn, ppVtbl, arg0, arg1);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @method flags=no_gen */
+static final native int _VtblInvoke3(long /*int*/ fn, long /*int*/ ppVtbl, long /*int*/ arg0, long /*int*/ arg1, long /*int*/ arg2);
+static final int VtblInvoke(long /*int*/ fn, long /*int*/ ppVtbl, long /*int*/ arg0, long /*int*/ arg1, long /*int*/ arg2) {
+	lock.lock();
+	try {
+		return _VtblInvoke3(fn, ppVtbl, arg0, arg1, arg2);
+	} finally {
+		lock.unlock();
+	}
+}
+
 static final native int _VtblCall(int fnNumber, long /*int*/ ppVtbl);
 static final int VtblCall(int fnNumber, long /*int*/ ppVtbl) {
 	lock.lock();
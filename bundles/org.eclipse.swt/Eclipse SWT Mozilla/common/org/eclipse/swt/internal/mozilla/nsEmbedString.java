@@ -36,9 +36,7 @@ public nsEmbedString() {
 
 public nsEmbedString(String string) {
 	if (string != null) {
-	   char[] aString = new char[string.length() + 1];
-	   string.getChars(0, string.length(), aString, 0);
-	   handle = XPCOM.nsEmbedString_new(aString);
+	   handle = XPCOM.nsEmbedString_newString(string);
 	}   
 }
 
@@ -49,11 +47,7 @@ public long /*int*/ getAddress() {
 @Override
 public String toString() {
 	if (handle == 0) return null;
-	int length = XPCOM.nsEmbedString_Length(handle);
-	long /*int*/ buffer = XPCOM.nsEmbedString_get(handle);
-	char[] dest = new char[length];
-	XPCOM.memmove(dest, buffer, length * 2);
-	return new String(dest);
+	return XPCOM.nsEmbedString_toString(handle);
 }	
 	
 public void dispose() {
@@ -46,14 +46,12 @@ public nsID(String id) {
 }
 
 public boolean Equals(nsID other) {
-	long /*int*/ ptr = XPCOM.nsID_new ();
-	XPCOM.memmove (ptr, this, nsID.sizeof);
-	long /*int*/ otherPtr = XPCOM.nsID_new ();
-	XPCOM.memmove (otherPtr, other, nsID.sizeof);
-	boolean result = XPCOM.nsID_Equals (ptr, otherPtr) != 0;
-	XPCOM.nsID_delete (ptr);
-	XPCOM.nsID_delete (otherPtr);
-	return result;
+	/* compare the fields in place of copying both ids to native memory for nsID::Equals */
+	if (m0 != other.m0 || m1 != other.m1 || m2 != other.m2) return false;
+	for (int i = 0; i < m3.length; i++) {
+		if (m3[i] != other.m3[i]) return false;
+	}
+	return true;
 }
 
 public void Parse(String aIDStr) {
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.ole.win32;
+
+import java.nio.*;
+
+import org.eclipse.swt.internal.ole.win32.*;
+
+/**
+ * Packs IDispatch::Invoke() calls into a direct buffer so that they can be
+ * performed with a single call to <code>COM.InvokeBatch()</code>, which
+ * also describes the format of the buffers.
+ */
+final class InvokeBatch {
+	ByteBuffer args, results;
+	int count;
+
+	/* The exception information of the last result read */
+	int wCode, scode;
+	String description;
+
+	static final int SLOT = 8;
+	static final int HEADER_SLOTS = 5;
+	static final int RECORD_SLOTS = 4;
+	/* Room for result strings, longer strings are returned as BSTRs */
+	static final int STRING_SLOTS = 512;
+
+InvokeBatch() {
+	args = allocate(1024);
+	results = allocate(RECORD_SLOTS * SLOT + STRING_SLOTS * SLOT);
+}
+
+static ByteBuffer allocate(int capacity) {
+	ByteBuffer buffer = ByteBuffer.allocateDirect(capacity);
+	buffer.order(ByteOrder.nativeOrder());
+	return buffer;
+}
+
+static ByteBuffer ensure(ByteBuffer buffer, int slots) {
+	int size = slots * SLOT;
+	if (buffer.remaining() >= size) return buffer;
+	int capacity = buffer.capacity();
+	while (capacity - buffer.position() < size) capacity *= 2;
+	ByteBuffer newBuffer = allocate(capacity);
+	buffer.flip();
+	newBuffer.put(buffer);
+	return newBuffer;
+}
+
+void add(int dispIdMember, int wFlags, Variant[] rgvarg, int[] rgdispidNamedArgs, boolean result) {
+	int cArgs = rgvarg != null ? rgvarg.length : 0;
+	int cNamedArgs = rgdispidNamedArgs != null ? rgdispidNamedArgs.length : 0;
+	int slots = HEADER_SLOTS + cNamedArgs;
+	for (int i = 0; i < cArgs; i++) slots += rgvarg[i].getDataSlots();
+	args = ensure(args, slots);
+	args.putLong(dispIdMember);
+	args.putLong(wFlags);
+	args.putLong(cArgs);
+	args.putLong(cNamedArgs);
+	args.putLong(result ? 1 : 0);
+	for (int i = 0; i < cNamedArgs; i++) args.putLong(rgdispidNamedArgs[i]);
+	for (int i = 0; i < cArgs; i++) rgvarg[i].getData(args);
+	count++;
+}
+
+/*
+ * Performs the packed calls and returns the number that were performed.
+ * The results are read in the same order with getResult().
+ */
+int invoke(IDispatch dispatch) {
+	results = ensure(results, count * RECORD_SLOTS + STRING_SLOTS);
+	return COM.InvokeBatch(dispatch.getAddress(), args, args.position(), results, results.capacity());
+}
+
+/*
+ * Reads the next result into pVarResult, which must not be null when the
+ * call asked for a result, and returns its HRESULT.
+ */
+int getResult(Variant pVarResult) {
+	int hResult = (int)results.getLong();
+	long value0 = results.getLong();
+	long value1 = results.getLong();
+	int length = (int)results.getLong();
+	String string = null;
+	if (length >= 0) {
+		char[] buffer = new char[length];
+		int position = results.position();
+		for (int i = 0; i < length; i++) buffer[i] = results.getChar();
+		results.position(position + (length * 2 + SLOT - 1) / SLOT * SLOT);
+		string = new String(buffer);
+	}
+	wCode = scode = 0;
+	description = null;
+	if (hResult == COM.DISP_E_EXCEPTION) {
+		wCode = (int)value0;
+		scode = (int)value1;
+		description = string;
+	} else if (pVarResult != null) {
+		pVarResult.setData((short)value0, value1, string);
+	}
+	return hResult;
+}
+
+/*
+ * Discards the packed calls and their results.  The buffers are kept
+ * for reuse.
+ */
+void reset() {
+	args.clear();
+	results.clear();
+	count = 0;
+}
+}
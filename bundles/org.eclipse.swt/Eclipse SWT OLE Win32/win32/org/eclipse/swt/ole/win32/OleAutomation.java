@@ -88,6 +88,7 @@ public final class OleAutomation {
 	private IDispatch objIDispatch;
 	private String exceptionDescription;
 	private ITypeInfo objITypeInfo;
+	private InvokeBatch batch;
 	
 OleAutomation(IDispatch idispatch) {
 	if (idispatch == null) OLE.error(OLE.ERROR_INVALID_INTERFACE_ADDRESS);
@@ -534,65 +535,68 @@ public Variant invoke(int dispIdMember, Variant[] rgvarg, int[] rgdispidNamedArg
 	int result = invoke(dispIdMember, COM.DISPATCH_METHOD, rgvarg, rgdispidNamedArgs, pVarResult);
 	return (result == COM.S_OK) ? pVarResult : null;
 }
+/** 
+ * Invokes several methods on the OLE Object with a single call to the native
+ * code, in order; the methods have no optional parameters.  The last error
+ * is the one of the last method.
+ *
+ * @param dispIdMembers the IDs of the methods as specified by the IDL of the ActiveX Control; the
+ *        values for the IDs can be obtained using OleAutomation.getIDsOfNames
+ *
+ * @param rgvargs the arguments of each method, or null if no method has arguments.  An entry
+ *        is null for a method without arguments.  All arguments are considered to be
+ *        read only unless the Variant is a By Reference Variant type.
+ *
+ * @return the results of the methods; an entry is null if its method failed to give result information
+ *
+ * @exception IllegalArgumentException <ul>
+ *		<li>ERROR_NULL_ARGUMENT when dispIdMembers is null</li>
+ *		<li>ERROR_INVALID_ARGUMENT when rgvargs does not have one entry per method</li>
+ *	</ul>
+ *
+ * @since 3.103
+ */
+public Variant[] invoke(int[] dispIdMembers, Variant[][] rgvargs) {
+	if (dispIdMembers == null) OLE.error(SWT.ERROR_NULL_ARGUMENT);
+	if (rgvargs != null && rgvargs.length != dispIdMembers.length) OLE.error(SWT.ERROR_INVALID_ARGUMENT);
+	Variant[] pVarResults = new Variant[dispIdMembers.length];
+	if (objIDispatch == null || dispIdMembers.length == 0) return pVarResults;
+	InvokeBatch batch = takeBatch();
+	try {
+		for (int i = 0; i < dispIdMembers.length; i++) {
+			batch.add(dispIdMembers[i], COM.DISPATCH_METHOD, rgvargs != null ? rgvargs[i] : null, null, true);
+		}
+		int count = batch.invoke(objIDispatch);
+		for (int i = 0; i < count; i++) {
+			Variant pVarResult = new Variant();
+			int result = batch.getResult(pVarResult);
+			manageExcepinfo(result, batch);
+			if (result == COM.S_OK) pVarResults[i] = pVarResult;
+		}
+		if (count < dispIdMembers.length) manageExcepinfo(COM.E_INVALIDARG, batch);
+	} finally {
+		releaseBatch(batch);
+	}
+	return pVarResults;
+}
 private int invoke(int dispIdMember, int wFlags, Variant[] rgvarg, int[] rgdispidNamedArgs, Variant pVarResult) {
 
 	// get the IDispatch interface for the control
 	if (objIDispatch == null) return COM.E_FAIL;
-	
-	// create a DISPPARAMS structure for the input parameters
-	DISPPARAMS pDispParams = new DISPPARAMS();
-	// store arguments in rgvarg
-	if (rgvarg != null && rgvarg.length > 0) {
-		pDispParams.cArgs = rgvarg.length;
-		pDispParams.rgvarg = OS.GlobalAlloc(COM.GMEM_FIXED | COM.GMEM_ZEROINIT, VARIANT.sizeof * rgvarg.length);
-		int offset = 0;
-		for (int i = rgvarg.length - 1; i >= 0 ; i--) {
-			rgvarg[i].getData(pDispParams.rgvarg + offset);
-			offset += VARIANT.sizeof;
-		}
-	}
-
-	// if arguments have ids, store the ids in rgdispidNamedArgs
-	if (rgdispidNamedArgs != null && rgdispidNamedArgs.length > 0) {
-		pDispParams.cNamedArgs = rgdispidNamedArgs.length;
-		pDispParams.rgdispidNamedArgs = OS.GlobalAlloc(COM.GMEM_FIXED | COM.GMEM_ZEROINIT, 4 * rgdispidNamedArgs.length);
-		int offset = 0;
-		for (int i = rgdispidNamedArgs.length; i > 0; i--) {
-			COM.MoveMemory(pDispParams.rgdispidNamedArgs + offset, new int[] {rgdispidNamedArgs[i-1]}, 4);
-			offset += 4;
-		}
-	}
 
-	// invoke the method
-	EXCEPINFO excepInfo = new EXCEPINFO();
-	int[] pArgErr = new int[1];
-	long /*int*/ pVarResultAddress = 0;
-	if (pVarResult != null)	pVarResultAddress = OS.GlobalAlloc(OS.GMEM_FIXED | OS.GMEM_ZEROINIT, VARIANT.sizeof);
-	int result = objIDispatch.Invoke(dispIdMember, new GUID(), COM.LOCALE_USER_DEFAULT, wFlags, pDispParams, pVarResultAddress, excepInfo, pArgErr);
+	// pack the arguments and invoke the method with one native call
+	InvokeBatch batch = takeBatch();
+	try {
+		batch.add(dispIdMember, wFlags, rgvarg, rgdispidNamedArgs, pVarResult != null);
+		int result = COM.E_INVALIDARG;
+		if (batch.invoke(objIDispatch) == 1) result = batch.getResult(pVarResult);
 
-	if (pVarResultAddress != 0){
-		pVarResult.setData(pVarResultAddress);
-		COM.VariantClear(pVarResultAddress);
-		OS.GlobalFree(pVarResultAddress);
-	}
-	
-	// free the Dispparams resources
-	if (pDispParams.rgdispidNamedArgs != 0){
-		OS.GlobalFree(pDispParams.rgdispidNamedArgs);
+		// save error string
+		manageExcepinfo(result, batch);
+		return result;
+	} finally {
+		releaseBatch(batch);
 	}
-	if (pDispParams.rgvarg != 0) {
-		int offset = 0;
-		for (int i = 0, length = rgvarg.length; i < length; i++){
-			COM.VariantClear(pDispParams.rgvarg + offset);
-			offset += VARIANT.sizeof;
-		}
-		OS.GlobalFree(pDispParams.rgvarg);
-	}
-
-	// save error string and cleanup EXCEPINFO
-	manageExcepinfo(result, excepInfo);
-		
-	return result;
 }
 /** 
  * Invokes a method on the OLE Object; the method has no parameters.  In the early days of OLE, 
@@ -661,7 +665,7 @@ public void invokeNoReply(int dispIdMember, Variant[] rgvarg, int[] rgdispidName
 	if (result != COM.S_OK)
 		OLE.error(OLE.ERROR_ACTION_NOT_PERFORMED, result);
 }
-private void manageExcepinfo(int hResult, EXCEPINFO excepInfo) {
+private void manageExcepinfo(int hResult, InvokeBatch batch) {
 
 	if (hResult == COM.S_OK){
 		exceptionDescription = "No Error"; //$NON-NLS-1$
@@ -670,30 +674,32 @@ private void manageExcepinfo(int hResult, EXCEPINFO excepInfo) {
 
 	// extract exception info
 	if (hResult == COM.DISP_E_EXCEPTION) {
-		if (excepInfo.bstrDescription != 0){
-			int size = COM.SysStringByteLen(excepInfo.bstrDescription);
-			char[] buffer = new char[(size + 1) /2];
-			COM.MoveMemory(buffer, excepInfo.bstrDescription, size);
-			exceptionDescription = new String(buffer);
+		if (batch.description != null){
+			exceptionDescription = batch.description;
 		} else {
 			exceptionDescription = "OLE Automation Error Exception "; //$NON-NLS-1$
-			if (excepInfo.wCode != 0){
-				exceptionDescription += "code = "+excepInfo.wCode; //$NON-NLS-1$
-			} else if (excepInfo.scode != 0){
-				exceptionDescription += "code = "+excepInfo.scode; //$NON-NLS-1$
+			if (batch.wCode != 0){
+				exceptionDescription += "code = "+batch.wCode; //$NON-NLS-1$
+			} else if (batch.scode != 0){
+				exceptionDescription += "code = "+batch.scode; //$NON-NLS-1$
 			}
 		}
 	} else {
 		exceptionDescription = "OLE Automation Error HResult : " + hResult; //$NON-NLS-1$
 	}
-
-	// cleanup EXCEPINFO struct
-	if (excepInfo.bstrDescription != 0)
-		COM.SysFreeString(excepInfo.bstrDescription);
-	if (excepInfo.bstrHelpFile != 0)
-		COM.SysFreeString(excepInfo.bstrHelpFile);
-	if (excepInfo.bstrSource != 0)
-		COM.SysFreeString(excepInfo.bstrSource);
+}
+/*
+ * Returns the cached batch, or a new one while the cached one is in use
+ * by an invoke() that is dispatching events.
+ */
+private InvokeBatch takeBatch() {
+	InvokeBatch batch = this.batch;
+	this.batch = null;
+	return batch != null ? batch : new InvokeBatch();
+}
+private void releaseBatch(InvokeBatch batch) {
+	batch.reset();
+	this.batch = batch;
 }
 /**
  * Sets the property specified by the dispIdMember to a new value.
@@ -10,6 +10,8 @@
  *******************************************************************************/
 package org.eclipse.swt.ole.win32;
 
+import java.nio.*;
+
 import org.eclipse.swt.*;
 import org.eclipse.swt.internal.ole.win32.*;
 import org.eclipse.swt.internal.win32.*;
@@ -477,6 +479,67 @@ public char getChar() {
 		OS.GlobalFree(newPtr);
 	}
 }
+/* Writes the Variant in the argument format of COM.InvokeBatch() */
+void getData(ByteBuffer buffer){
+	buffer.putLong(type);
+	if ((type & COM.VT_BYREF) == COM.VT_BYREF) {
+		buffer.putLong(byRefPtr);
+		return;
+	}
+
+	switch (type) {
+		case COM.VT_EMPTY :
+		case COM.VT_NULL :
+			buffer.putLong(0);
+			break;
+		case COM.VT_BOOL :
+			buffer.putLong(booleanData ? 1 : 0);
+			break;
+		case COM.VT_I1 :
+			buffer.putLong(byteData);
+			break;
+		case COM.VT_I2 :
+			buffer.putLong(shortData);
+			break;
+		case COM.VT_UI2 :
+			buffer.putLong(charData);
+			break;
+		case COM.VT_I4 :
+			buffer.putLong(intData);
+			break;
+		case COM.VT_I8 :
+			buffer.putLong(longData);
+			break;
+		case COM.VT_R4 :
+			buffer.putLong(Float.floatToIntBits(floatData));
+			break;
+		case COM.VT_R8 :
+			buffer.putLong(Double.doubleToLongBits(doubleData));
+			break;
+		case COM.VT_DISPATCH :
+			buffer.putLong(dispatchData.getAddress());
+			break;
+		case COM.VT_UNKNOWN :
+			buffer.putLong(unknownData.getAddress());
+			break;
+		case COM.VT_BSTR :
+			String data = String.valueOf(stringData);
+			int length = data.length();
+			buffer.putLong(length);
+			int position = buffer.position();
+			for (int i = 0; i < length; i++) buffer.putChar(data.charAt(i));
+			buffer.position(position + (length * 2 + 7) / 8 * 8);
+			break;
+
+		default :
+			OLE.error(SWT.ERROR_NOT_IMPLEMENTED);
+	}
+}
+/* Returns the number of 64 bit slots written by getData(ByteBuffer) */
+int getDataSlots(){
+	if (type == COM.VT_BSTR) return 3 + (String.valueOf(stringData).length() * 2 + 7) / 8;
+	return 2;
+}
 void getData(long /*int*/ pData){
 	if (pData == 0) OLE.error(OLE.ERROR_OUT_OF_MEMORY);
 	
@@ -538,8 +601,7 @@ void getData(long /*int*/ pData){
 			break;
 		case COM.VT_BSTR :
 			COM.MoveMemory(pData, new short[] {type}, 2);
-			char[] data = (stringData+"\0").toCharArray();
-			long /*int*/ ptr = COM.SysAllocString(data);
+			long /*int*/ ptr = COM.BSTRFromString(String.valueOf(stringData));
 			COM.MoveMemory(pData + 8, new long /*int*/[] {ptr}, OS.PTR_SIZEOF);
 			break;
 	
@@ -911,6 +973,63 @@ public void setByRef(short val) {
 	}
 	COM.MoveMemory(byRefPtr, new short[]{val}, 2);
 }
+/*
+ * Sets the Variant from a result of COM.InvokeBatch().  Interfaces are
+ * already referenced for the Variant.  A VT_BSTR without characters is
+ * passed as the BSTR in value, which is freed.
+ */
+void setData(short type, long value, String string){
+	this.type = type;
+
+	if ((type & COM.VT_BYREF) == COM.VT_BYREF) {
+		byRefPtr = (long /*int*/)value;
+		return;
+	}
+
+	switch (type) {
+		case COM.VT_EMPTY :
+		case COM.VT_NULL :
+			break;
+		case COM.VT_BOOL :
+			booleanData = value != 0;
+			break;
+		case COM.VT_I1 :
+			byteData = (byte)value;
+			break;
+		case COM.VT_I2 :
+			shortData = (short)value;
+			break;
+		case COM.VT_UI2 :
+			charData = (char)value;
+			break;
+		case COM.VT_I4 :
+			intData = (int)value;
+			break;
+		case COM.VT_I8 :
+			longData = value;
+			break;
+		case COM.VT_R4 :
+			floatData = Float.intBitsToFloat((int)value);
+			break;
+		case COM.VT_R8 :
+			doubleData = Double.longBitsToDouble(value);
+			break;
+		case COM.VT_DISPATCH :
+			dispatchData = new IDispatch((long /*int*/)value);
+			break;
+		case COM.VT_UNKNOWN :
+			unknownData = new IUnknown((long /*int*/)value);
+			break;
+		case COM.VT_BSTR :
+			if (string == null) {
+				long /*int*/ hMem = (long /*int*/)value;
+				string = COM.BSTRToString(hMem);
+				COM.SysFreeString(hMem);
+			}
+			stringData = string;
+			break;
+	}
+}
 void setData(long /*int*/ pData){
 	if (pData == 0) OLE.error(OLE.ERROR_INVALID_ARGUMENT);
 
@@ -1000,17 +1119,7 @@ void setData(long /*int*/ pData){
 				type = COM.VT_EMPTY;
 				break;
 			}
-			// Get the size of the string from the OS - the size is expressed in number
-			// of bytes - each unicode character is 2 bytes.
-			int size = COM.SysStringByteLen(hMem[0]);
-			if (size > 0){
-				// get the unicode character array from the global memory and create a String
-				char[] buffer = new char[(size + 1) /2]; // add one to avoid rounding errors
-				COM.MoveMemory(buffer, hMem[0], size);
-				stringData = new String(buffer);
-			} else {
-				stringData = ""; //$NON-NLS-1$
-			}
+			stringData = COM.BSTRToString(hMem[0]);
 			break;
 	
 		default :
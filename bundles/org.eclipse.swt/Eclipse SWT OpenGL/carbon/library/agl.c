@@ -27,7 +27,7 @@ JNIEXPORT jint JNICALL AGL_NATIVE(aglChoosePixelFormat)
 	if (arg2) if ((lparg2 = (*env)->GetIntArrayElements(env, arg2, NULL)) == NULL) goto fail;
 	rc = (jint)aglChoosePixelFormat((const AGLDevice *)arg0, arg1, (const GLint *)lparg2);
 fail:
-	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, 0);
+	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, JNI_ABORT);
 	AGL_NATIVE_EXIT(env, that, aglChoosePixelFormat_FUNC);
 	return rc;
 }
@@ -165,7 +165,7 @@ JNIEXPORT jboolean JNICALL AGL_NATIVE(aglSetInteger__II_3I)
 	if (arg2) if ((lparg2 = (*env)->GetIntArrayElements(env, arg2, NULL)) == NULL) goto fail;
 	rc = (jboolean)aglSetInteger((AGLContext)arg0, (GLenum)arg1, (const GLint *)lparg2);
 fail:
-	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, 0);
+	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, JNI_ABORT);
 	AGL_NATIVE_EXIT(env, that, aglSetInteger__II_3I_FUNC);
 	return rc;
 }
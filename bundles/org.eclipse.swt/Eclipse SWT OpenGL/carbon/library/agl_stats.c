@@ -33,6 +33,9 @@ char * AGL_nativeFunctionNames[] = {
 #define NATIVE_FUNCTION_COUNT sizeof(AGL_nativeFunctionNames) / sizeof(char*)
 int AGL_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int AGL_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong AGL_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT AGL_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS AGL_nativeStats = {AGL_nativeFunctionCallCount, AGL_nativeFunctionCallTime, AGL_nativeFunctionEvents, 0, "AGL", AGL_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -54,4 +57,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(AGL_1GetFunctionCallCount)
 	return AGL_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(AGL_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return AGL_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(AGL_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(AGL_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &AGL_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(AGL_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(AGL_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(AGL_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(AGL_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(AGL_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
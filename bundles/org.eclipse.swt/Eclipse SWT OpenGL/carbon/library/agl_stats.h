@@ -13,8 +13,9 @@
 extern int AGL_nativeFunctionCount;
 extern int AGL_nativeFunctionCallCount[];
 extern char* AGL_nativeFunctionNames[];
-#define AGL_NATIVE_ENTER(env, that, func) AGL_nativeFunctionCallCount[func]++;
-#define AGL_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS AGL_nativeStats;
+#define AGL_NATIVE_ENTER(env, that, func) nativeStatsEnter(&AGL_nativeStats, func);
+#define AGL_NATIVE_EXIT(env, that, func) nativeStatsExit(&AGL_nativeStats, func);
 #else
 #ifndef AGL_NATIVE_ENTER
 #define AGL_NATIVE_ENTER(env, that, func) 
@@ -230,6 +230,8 @@ public boolean isCurrent () {
  */
 public void setCurrent () {
 	checkWidget ();
+	NSOpenGLContext current = NSOpenGLContext.currentContext();
+	if (current != null && current.id == context.id) return;
 	context.makeCurrentContext();
 }
 
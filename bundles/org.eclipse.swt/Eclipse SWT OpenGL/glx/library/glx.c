@@ -29,6 +29,28 @@ JNIEXPORT jint JNICALL GLX_NATIVE(XVisualInfo_1sizeof)
 }
 #endif
 
+#ifndef NO__1callFunc_1glXSwapIntervalEXT
+JNIEXPORT void JNICALL GLX_NATIVE(_1callFunc_1glXSwapIntervalEXT)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jint arg3)
+{
+	GLX_NATIVE_ENTER(env, that, _1callFunc_1glXSwapIntervalEXT_FUNC);
+	((void (*)(Display *, GLXDrawable, int))arg0)((Display *)arg1, (GLXDrawable)arg2, arg3);
+	GLX_NATIVE_EXIT(env, that, _1callFunc_1glXSwapIntervalEXT_FUNC);
+}
+#endif
+
+#ifndef NO__1callFunc_1glXSwapIntervalSGI
+JNIEXPORT jint JNICALL GLX_NATIVE(_1callFunc_1glXSwapIntervalSGI)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
+{
+	jint rc = 0;
+	GLX_NATIVE_ENTER(env, that, _1callFunc_1glXSwapIntervalSGI_FUNC);
+	rc = (jint)((int (*)(int))arg0)(arg1);
+	GLX_NATIVE_EXIT(env, that, _1callFunc_1glXSwapIntervalSGI_FUNC);
+	return rc;
+}
+#endif
+
 #ifndef NO__1glGetIntegerv
 JNIEXPORT void JNICALL GLX_NATIVE(_1glGetIntegerv)
 	(JNIEnv *env, jclass that, jint arg0, jintArray arg1)
@@ -186,6 +208,22 @@ JNIEXPORT jintLong JNICALL GLX_NATIVE(_1glXGetCurrentDrawable)
 }
 #endif
 
+#ifndef NO__1glXGetProcAddress
+JNIEXPORT jintLong JNICALL GLX_NATIVE(_1glXGetProcAddress)
+	(JNIEnv *env, jclass that, jbyteArray arg0)
+{
+	jbyte *lparg0=NULL;
+	jintLong rc = 0;
+	GLX_NATIVE_ENTER(env, that, _1glXGetProcAddress_FUNC);
+	if (arg0) if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) goto fail;
+	rc = (jintLong)glXGetProcAddress((const GLubyte *)lparg0);
+fail:
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	GLX_NATIVE_EXIT(env, that, _1glXGetProcAddress_FUNC);
+	return rc;
+}
+#endif
+
 #ifndef NO__1glXIsDirect
 JNIEXPORT jboolean JNICALL GLX_NATIVE(_1glXIsDirect)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
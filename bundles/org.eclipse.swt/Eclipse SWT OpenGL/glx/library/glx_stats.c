@@ -16,6 +16,8 @@
 
 char * GLX_nativeFunctionNames[] = {
 	"XVisualInfo_1sizeof",
+	"_1callFunc_1glXSwapIntervalEXT",
+	"_1callFunc_1glXSwapIntervalSGI",
 	"_1glGetIntegerv",
 	"_1glViewport",
 	"_1glXChooseVisual",
@@ -28,6 +30,7 @@ char * GLX_nativeFunctionNames[] = {
 	"_1glXGetConfig",
 	"_1glXGetCurrentContext",
 	"_1glXGetCurrentDrawable",
+	"_1glXGetProcAddress",
 	"_1glXIsDirect",
 	"_1glXMakeCurrent",
 	"_1glXQueryExtension",
@@ -42,6 +45,9 @@ char * GLX_nativeFunctionNames[] = {
 #define NATIVE_FUNCTION_COUNT sizeof(GLX_nativeFunctionNames) / sizeof(char*)
 int GLX_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int GLX_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong GLX_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT GLX_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS GLX_nativeStats = {GLX_nativeFunctionCallCount, GLX_nativeFunctionCallTime, GLX_nativeFunctionEvents, 0, "GLX", GLX_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -63,4 +69,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(GLX_1GetFunctionCallCount)
 	return GLX_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(GLX_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return GLX_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(GLX_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(GLX_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &GLX_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(GLX_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(GLX_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(GLX_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(GLX_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(GLX_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
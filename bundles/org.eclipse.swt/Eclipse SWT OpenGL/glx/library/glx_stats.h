@@ -13,8 +13,9 @@
 extern int GLX_nativeFunctionCount;
 extern int GLX_nativeFunctionCallCount[];
 extern char* GLX_nativeFunctionNames[];
-#define GLX_NATIVE_ENTER(env, that, func) GLX_nativeFunctionCallCount[func]++;
-#define GLX_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS GLX_nativeStats;
+#define GLX_NATIVE_ENTER(env, that, func) nativeStatsEnter(&GLX_nativeStats, func);
+#define GLX_NATIVE_EXIT(env, that, func) nativeStatsExit(&GLX_nativeStats, func);
 #else
 #ifndef GLX_NATIVE_ENTER
 #define GLX_NATIVE_ENTER(env, that, func) 
@@ -26,6 +27,8 @@ extern char* GLX_nativeFunctionNames[];
 
 typedef enum {
 	XVisualInfo_1sizeof_FUNC,
+	_1callFunc_1glXSwapIntervalEXT_FUNC,
+	_1callFunc_1glXSwapIntervalSGI_FUNC,
 	_1glGetIntegerv_FUNC,
 	_1glViewport_FUNC,
 	_1glXChooseVisual_FUNC,
@@ -38,6 +41,7 @@ typedef enum {
 	_1glXGetConfig_FUNC,
 	_1glXGetCurrentContext_FUNC,
 	_1glXGetCurrentDrawable_FUNC,
+	_1glXGetProcAddress_FUNC,
 	_1glXIsDirect_FUNC,
 	_1glXMakeCurrent_FUNC,
 	_1glXQueryExtension_FUNC,
@@ -201,7 +201,46 @@ public class GLX extends Platform {
 	*/
 	public static final int GL_VIEWPORT = 0x0BA2;
 	
+	/*
+	** GLX_EXT_swap_control
+	*/
+	public static final int GLX_SWAP_INTERVAL_EXT		= 0x20F1;
+	public static final int GLX_MAX_SWAP_INTERVAL_EXT	= 0x20F2;
+	
 public static final native int XVisualInfo_sizeof();
+/**
+ * Calls <code>glXSwapIntervalEXT</code> through the pointer returned by
+ * <code>glXGetProcAddress</code>.
+ *
+ * @param func cast=(void (*)(Display *, GLXDrawable, int))
+ * @param dpy cast=(Display *)
+ * @param drawable cast=(GLXDrawable)
+ */
+public static final native void _callFunc_glXSwapIntervalEXT(long /*int*/ func, long /*int*/ dpy, long /*int*/ drawable, int interval);
+public static final void callFunc_glXSwapIntervalEXT(long /*int*/ func, long /*int*/ dpy, long /*int*/ drawable, int interval) {
+	lock.lock();
+	try {
+		_callFunc_glXSwapIntervalEXT(func, dpy, drawable, interval);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * Calls <code>glXSwapIntervalSGI</code> or <code>glXSwapIntervalMESA</code>,
+ * which set the interval of the current drawable, through the pointer
+ * returned by <code>glXGetProcAddress</code>.
+ *
+ * @param func cast=(int (*)(int))
+ */
+public static final native int _callFunc_glXSwapIntervalSGI(long /*int*/ func, int interval);
+public static final int callFunc_glXSwapIntervalSGI(long /*int*/ func, int interval) {
+	lock.lock();
+	try {
+		return _callFunc_glXSwapIntervalSGI(func, interval);
+	} finally {
+		lock.unlock();
+	}
+}
 /**
  * @param pname cast=(GLenum)
  * @param params cast=(GLint *),flags=no_in
@@ -344,6 +383,16 @@ public static final long /*int*/ glXGetCurrentDrawable() {
 		lock.unlock();
 	}
 }
+/** @param procName cast=(const GLubyte *) */
+public static final native long /*int*/ _glXGetProcAddress(byte[] procName);
+public static final long /*int*/ glXGetProcAddress(byte[] procName) {
+	lock.lock();
+	try {
+		return _glXGetProcAddress(procName);
+	} finally {
+		lock.unlock();
+	}
+}
 /**
  * @param dpy cast=(Display *)
  * @param ctx cast=(GLXContext)
@@ -89,6 +89,46 @@ JNIEXPORT jboolean JNICALL WGL_NATIVE(SwapBuffers)
 }
 #endif
 
+#ifndef NO_callFunc_1wglCreateContextAttribsARB
+JNIEXPORT jintLong JNICALL WGL_NATIVE(callFunc_1wglCreateContextAttribsARB)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintArray arg3)
+{
+	jint *lparg3=NULL;
+	jintLong rc = 0;
+	WGL_NATIVE_ENTER(env, that, callFunc_1wglCreateContextAttribsARB_FUNC);
+	if (arg3) if ((lparg3 = (*env)->GetIntArrayElements(env, arg3, NULL)) == NULL) goto fail;
+	rc = (jintLong)((HGLRC (WINAPI *)(HDC, HGLRC, const int *))arg0)((HDC)arg1, (HGLRC)arg2, (const int *)lparg3);
+fail:
+	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
+	WGL_NATIVE_EXIT(env, that, callFunc_1wglCreateContextAttribsARB_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_callFunc_1wglGetSwapIntervalEXT
+JNIEXPORT jint JNICALL WGL_NATIVE(callFunc_1wglGetSwapIntervalEXT)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	jint rc = 0;
+	WGL_NATIVE_ENTER(env, that, callFunc_1wglGetSwapIntervalEXT_FUNC);
+	rc = (jint)((int (WINAPI *)(void))arg0)();
+	WGL_NATIVE_EXIT(env, that, callFunc_1wglGetSwapIntervalEXT_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_callFunc_1wglSwapIntervalEXT
+JNIEXPORT jboolean JNICALL WGL_NATIVE(callFunc_1wglSwapIntervalEXT)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
+{
+	jboolean rc = 0;
+	WGL_NATIVE_ENTER(env, that, callFunc_1wglSwapIntervalEXT_FUNC);
+	rc = (jboolean)((BOOL (WINAPI *)(int))arg0)(arg1);
+	WGL_NATIVE_EXIT(env, that, callFunc_1wglSwapIntervalEXT_FUNC);
+	return rc;
+}
+#endif
+
 #ifndef NO_wglCopyContext
 JNIEXPORT jboolean JNICALL WGL_NATIVE(wglCopyContext)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
@@ -20,6 +20,9 @@ char * WGL_nativeFunctionNames[] = {
 	"GetPixelFormat",
 	"SetPixelFormat",
 	"SwapBuffers",
+	"callFunc_1wglCreateContextAttribsARB",
+	"callFunc_1wglGetSwapIntervalEXT",
+	"callFunc_1wglSwapIntervalEXT",
 	"wglCopyContext",
 	"wglCreateContext",
 	"wglCreateLayerContext",
@@ -38,6 +41,9 @@ char * WGL_nativeFunctionNames[] = {
 #define NATIVE_FUNCTION_COUNT sizeof(WGL_nativeFunctionNames) / sizeof(char*)
 int WGL_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int WGL_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong WGL_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT WGL_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS WGL_nativeStats = {WGL_nativeFunctionCallCount, WGL_nativeFunctionCallTime, WGL_nativeFunctionEvents, 0, "WGL", WGL_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -59,4 +65,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(WGL_1GetFunctionCallCount)
 	return WGL_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(WGL_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return WGL_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(WGL_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(WGL_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &WGL_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(WGL_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(WGL_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(WGL_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(WGL_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(WGL_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
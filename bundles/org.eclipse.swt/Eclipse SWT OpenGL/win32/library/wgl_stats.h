@@ -13,8 +13,9 @@
 extern int WGL_nativeFunctionCount;
 extern int WGL_nativeFunctionCallCount[];
 extern char* WGL_nativeFunctionNames[];
-#define WGL_NATIVE_ENTER(env, that, func) WGL_nativeFunctionCallCount[func]++;
-#define WGL_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS WGL_nativeStats;
+#define WGL_NATIVE_ENTER(env, that, func) nativeStatsEnter(&WGL_nativeStats, func);
+#define WGL_NATIVE_EXIT(env, that, func) nativeStatsExit(&WGL_nativeStats, func);
 #else
 #ifndef WGL_NATIVE_ENTER
 #define WGL_NATIVE_ENTER(env, that, func) 
@@ -30,6 +31,9 @@ typedef enum {
 	GetPixelFormat_FUNC,
 	SetPixelFormat_FUNC,
 	SwapBuffers_FUNC,
+	callFunc_1wglCreateContextAttribsARB_FUNC,
+	callFunc_1wglGetSwapIntervalEXT_FUNC,
+	callFunc_1wglSwapIntervalEXT_FUNC,
 	wglCopyContext_FUNC,
 	wglCreateContext_FUNC,
 	wglCreateLayerContext_FUNC,
@@ -97,6 +97,14 @@ public class WGL extends Platform {
 	public static final int PFD_DEPTH_DONTCARE          = 0x20000000;
 	public static final int PFD_DOUBLEBUFFER_DONTCARE   = 0x40000000;
 	public static final int PFD_STEREO_DONTCARE         = 0x80000000;
+	
+	/* WGL_ARB_create_context attributes */
+	public static final int WGL_CONTEXT_MAJOR_VERSION_ARB       = 0x2091;
+	public static final int WGL_CONTEXT_MINOR_VERSION_ARB       = 0x2092;
+	public static final int WGL_CONTEXT_FLAGS_ARB               = 0x2094;
+	public static final int WGL_CONTEXT_PROFILE_MASK_ARB        = 0x9126;
+	public static final int WGL_CONTEXT_CORE_PROFILE_BIT_ARB    = 0x00000001;
+	public static final int WGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB = 0x00000002;
 
 /** @param hdc cast=(HDC) */
 public static final native int ChoosePixelFormat(long /*int*/ hdc, PIXELFORMATDESCRIPTOR ppfd);
@@ -108,6 +116,32 @@ public static final native int GetPixelFormat(long /*int*/ hdc);
 public static final native boolean SetPixelFormat(long /*int*/ hdc, int iPixelFormat, PIXELFORMATDESCRIPTOR ppfd);
 /** @param hdc cast=(HDC) */
 public static final native boolean SwapBuffers(long /*int*/ hdc);
+/**
+ * Calls <code>wglCreateContextAttribsARB</code> through the pointer
+ * returned by <code>wglGetProcAddress</code>.  The new context shares
+ * its display lists and textures with <code>hShareContext</code> and
+ * can be made current on another thread.
+ *
+ * @param func cast=(HGLRC (WINAPI *)(HDC, HGLRC, const int *))
+ * @param hdc cast=(HDC)
+ * @param hShareContext cast=(HGLRC)
+ * @param attribList cast=(const int *)
+ */
+public static final native long /*int*/ callFunc_wglCreateContextAttribsARB(long /*int*/ func, long /*int*/ hdc, long /*int*/ hShareContext, int[] attribList);
+/**
+ * Calls <code>wglGetSwapIntervalEXT</code> through the pointer returned
+ * by <code>wglGetProcAddress</code>.
+ *
+ * @param func cast=(int (WINAPI *)(void))
+ */
+public static final native int callFunc_wglGetSwapIntervalEXT(long /*int*/ func);
+/**
+ * Calls <code>wglSwapIntervalEXT</code> through the pointer returned by
+ * <code>wglGetProcAddress</code>.
+ *
+ * @param func cast=(BOOL (WINAPI *)(int))
+ */
+public static final native boolean callFunc_wglSwapIntervalEXT(long /*int*/ func, int interval);
 /**
  * @param hglrcSrc cast=(HGLRC)
  * @param hglrcDst cast=(HGLRC)
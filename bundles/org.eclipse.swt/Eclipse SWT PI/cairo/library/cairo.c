@@ -27,8 +27,12 @@
 #define Cairo_NATIVE(func) Java_org_eclipse_swt_internal_cairo_Cairo_##func
 #endif
 
+#ifndef Cairo_CRITICAL
+#define Cairo_CRITICAL(func) JavaCritical_org_eclipse_swt_internal_cairo_Cairo_##func
+#endif
+
 #ifndef NO_CAIRO_1VERSION_1ENCODE
-JNIEXPORT jint JNICALL Cairo_NATIVE(CAIRO_1VERSION_1ENCODE)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(CAIRO_1VERSION_1ENCODE)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	jint rc = 0;
@@ -40,7 +44,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(CAIRO_1VERSION_1ENCODE)
 #endif
 
 #ifndef NO__1cairo_1append_1path
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1append_1path)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1append_1path)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1append_1path_FUNC);
@@ -50,7 +54,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1append_1path)
 #endif
 
 #ifndef NO__1cairo_1arc
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1arc)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1arc)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2, jdouble arg3, jdouble arg4, jdouble arg5)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1arc_FUNC);
@@ -60,7 +64,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1arc)
 #endif
 
 #ifndef NO__1cairo_1arc_1negative
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1arc_1negative)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1arc_1negative)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2, jdouble arg3, jdouble arg4, jdouble arg5)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1arc_1negative_FUNC);
@@ -70,7 +74,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1arc_1negative)
 #endif
 
 #ifndef NO__1cairo_1clip
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1clip)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1clip)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1clip_FUNC);
@@ -80,17 +84,23 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1clip)
 #endif
 
 #ifndef NO__1cairo_1close_1path
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1close_1path)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1close_1path)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1close_1path_FUNC);
 	cairo_close_path((cairo_t *)arg0);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1close_1path_FUNC);
 }
+
+JNIEXPORT void JNICALL Cairo_CRITICAL(_1cairo_1close_1path)
+	(jintLong arg0)
+{
+	cairo_close_path((cairo_t *)arg0);
+}
 #endif
 
 #ifndef NO__1cairo_1copy_1page
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1copy_1page)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1copy_1page)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1copy_1page_FUNC);
@@ -100,7 +110,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1copy_1page)
 #endif
 
 #ifndef NO__1cairo_1copy_1path
-JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1copy_1path)
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1copy_1path)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -112,7 +122,7 @@ JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1copy_1path)
 #endif
 
 #ifndef NO__1cairo_1copy_1path_1flat
-JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1copy_1path_1flat)
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1copy_1path_1flat)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -124,19 +134,20 @@ JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1copy_1path_1flat)
 #endif
 
 #ifndef NO__1cairo_1create
-JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1create)
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1create)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1create_FUNC);
 	rc = (jintLong)cairo_create((cairo_surface_t *)arg0);
+	NATIVE_RESOURCE_CREATE(env, "cairo_t", rc, 0);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1create_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO__1cairo_1curve_1to
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1curve_1to)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1curve_1to)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2, jdouble arg3, jdouble arg4, jdouble arg5, jdouble arg6)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1curve_1to_FUNC);
@@ -146,27 +157,34 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1curve_1to)
 #endif
 
 #ifndef NO__1cairo_1destroy
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1destroy)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1destroy)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1destroy_FUNC);
+	NATIVE_RESOURCE_DESTROY(env, arg0);
 	cairo_destroy((cairo_t *)arg0);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1destroy_FUNC);
 }
 #endif
 
 #ifndef NO__1cairo_1fill
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1fill)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1fill)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1fill_FUNC);
 	cairo_fill((cairo_t *)arg0);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1fill_FUNC);
 }
+
+JNIEXPORT void JNICALL Cairo_CRITICAL(_1cairo_1fill)
+	(jintLong arg0)
+{
+	cairo_fill((cairo_t *)arg0);
+}
 #endif
 
 #ifndef NO__1cairo_1font_1options_1create
-JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1font_1options_1create)
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1font_1options_1create)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -178,7 +196,7 @@ JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1font_1options_1create)
 #endif
 
 #ifndef NO__1cairo_1font_1options_1destroy
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1font_1options_1destroy)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1font_1options_1destroy)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1font_1options_1destroy_FUNC);
@@ -188,7 +206,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1font_1options_1destroy)
 #endif
 
 #ifndef NO__1cairo_1font_1options_1get_1antialias
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1font_1options_1get_1antialias)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1font_1options_1get_1antialias)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -200,7 +218,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1font_1options_1get_1antialias)
 #endif
 
 #ifndef NO__1cairo_1font_1options_1set_1antialias
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1font_1options_1set_1antialias)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1font_1options_1set_1antialias)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1font_1options_1set_1antialias_FUNC);
@@ -210,7 +228,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1font_1options_1set_1antialias)
 #endif
 
 #ifndef NO__1cairo_1get_1antialias
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1get_1antialias)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1get_1antialias)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -222,7 +240,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1get_1antialias)
 #endif
 
 #ifndef NO__1cairo_1get_1current_1point
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1get_1current_1point)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1get_1current_1point)
 	(JNIEnv *env, jclass that, jintLong arg0, jdoubleArray arg1, jdoubleArray arg2)
 {
 	jdouble *lparg1=NULL;
@@ -239,7 +257,7 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1get_1fill_1rule
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1get_1fill_1rule)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1get_1fill_1rule)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -251,7 +269,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1get_1fill_1rule)
 #endif
 
 #ifndef NO__1cairo_1get_1font_1face
-JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1get_1font_1face)
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1get_1font_1face)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -263,7 +281,7 @@ JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1get_1font_1face)
 #endif
 
 #ifndef NO__1cairo_1get_1matrix
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1get_1matrix)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1get_1matrix)
 	(JNIEnv *env, jclass that, jintLong arg0, jdoubleArray arg1)
 {
 	jdouble *lparg1=NULL;
@@ -277,7 +295,7 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1get_1operator
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1get_1operator)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1get_1operator)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -289,7 +307,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1get_1operator)
 #endif
 
 #ifndef NO__1cairo_1get_1source
-JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1get_1source)
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1get_1source)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -301,7 +319,7 @@ JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1get_1source)
 #endif
 
 #ifndef NO__1cairo_1get_1target
-JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1get_1target)
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1get_1target)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -313,7 +331,7 @@ JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1get_1target)
 #endif
 
 #ifndef NO__1cairo_1get_1tolerance
-JNIEXPORT jdouble JNICALL Cairo_NATIVE(_1cairo_1get_1tolerance)
+SWT_NATIVE_EXPORT jdouble JNICALL Cairo_NATIVE(_1cairo_1get_1tolerance)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jdouble rc = 0;
@@ -325,7 +343,7 @@ JNIEXPORT jdouble JNICALL Cairo_NATIVE(_1cairo_1get_1tolerance)
 #endif
 
 #ifndef NO__1cairo_1identity_1matrix
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1identity_1matrix)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1identity_1matrix)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1identity_1matrix_FUNC);
@@ -335,19 +353,20 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1identity_1matrix)
 #endif
 
 #ifndef NO__1cairo_1image_1surface_1create
-JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1create)
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1create)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	jintLong rc = 0;
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1image_1surface_1create_FUNC);
 	rc = (jintLong)cairo_image_surface_create(arg0, arg1, arg2);
+	NATIVE_RESOURCE_CREATE(env, "cairo_surface_t", rc, (jlong)arg1*arg2*4);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1image_1surface_1create_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO__1cairo_1image_1surface_1get_1data
-JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1get_1data)
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1get_1data)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -367,7 +386,7 @@ JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1get_1data)
 #endif
 
 #ifndef NO__1cairo_1image_1surface_1get_1format
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1get_1format)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1get_1format)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -387,7 +406,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1get_1format)
 #endif
 
 #ifndef NO__1cairo_1image_1surface_1get_1height
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1get_1height)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1get_1height)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -399,7 +418,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1get_1height)
 #endif
 
 #ifndef NO__1cairo_1image_1surface_1get_1stride
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1get_1stride)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1get_1stride)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -419,7 +438,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1get_1stride)
 #endif
 
 #ifndef NO__1cairo_1image_1surface_1get_1width
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1get_1width)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1get_1width)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -431,7 +450,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1image_1surface_1get_1width)
 #endif
 
 #ifndef NO__1cairo_1in_1fill
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1in_1fill)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1in_1fill)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2)
 {
 	jint rc = 0;
@@ -443,7 +462,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1in_1fill)
 #endif
 
 #ifndef NO__1cairo_1in_1stroke
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1in_1stroke)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1in_1stroke)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2)
 {
 	jint rc = 0;
@@ -455,17 +474,62 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1in_1stroke)
 #endif
 
 #ifndef NO__1cairo_1line_1to
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1line_1to)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1line_1to)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1line_1to_FUNC);
 	cairo_line_to((cairo_t *)arg0, arg1, arg2);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1line_1to_FUNC);
 }
+
+JNIEXPORT void JNICALL Cairo_CRITICAL(_1cairo_1line_1to)
+	(jintLong arg0, jdouble arg1, jdouble arg2)
+{
+	cairo_line_to((cairo_t *)arg0, arg1, arg2);
+}
+#endif
+
+#ifndef NO__1cairo_1line_1to_1batch
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1line_1to_1batch)
+	(JNIEnv *env, jclass that, jintLong arg0, jdoubleArray arg1, jdoubleArray arg2)
+{
+	jdouble *lparg1=NULL;
+	jdouble *lparg2=NULL;
+	Cairo_NATIVE_ENTER(env, that, _1cairo_1line_1to_1batch_FUNC);
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (arg1) if ((lparg1 = (*env)->GetPrimitiveArrayCritical(env, arg1, NULL)) == NULL) goto fail;
+		if (arg2) if ((lparg2 = (*env)->GetPrimitiveArrayCritical(env, arg2, NULL)) == NULL) goto fail;
+	} else
+#endif
+	{
+		if (arg1) if ((lparg1 = (*env)->GetDoubleArrayElements(env, arg1, NULL)) == NULL) goto fail;
+		if (arg2) if ((lparg2 = (*env)->GetDoubleArrayElements(env, arg2, NULL)) == NULL) goto fail;
+	}
+	if (lparg1 && lparg2) {
+		jint i, count = (*env)->GetArrayLength(env, arg1);
+		if (count > (*env)->GetArrayLength(env, arg2)) count = (*env)->GetArrayLength(env, arg2);
+		for (i = 0; i < count; i++) {
+			cairo_line_to((cairo_t *)arg0, lparg1[i], lparg2[i]);
+		}
+	}
+fail:
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (arg2 && lparg2) (*env)->ReleasePrimitiveArrayCritical(env, arg2, lparg2, JNI_ABORT);
+		if (arg1 && lparg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, JNI_ABORT);
+	} else
+#endif
+	{
+		if (arg2 && lparg2) (*env)->ReleaseDoubleArrayElements(env, arg2, lparg2, JNI_ABORT);
+		if (arg1 && lparg1) (*env)->ReleaseDoubleArrayElements(env, arg1, lparg1, JNI_ABORT);
+	}
+	Cairo_NATIVE_EXIT(env, that, _1cairo_1line_1to_1batch_FUNC);
+}
 #endif
 
 #ifndef NO__1cairo_1mask
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1mask)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1mask)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1mask_FUNC);
@@ -475,7 +539,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1mask)
 #endif
 
 #ifndef NO__1cairo_1mask_1surface
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1mask_1surface)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1mask_1surface)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2, jdouble arg3)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1mask_1surface_FUNC);
@@ -485,7 +549,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1mask_1surface)
 #endif
 
 #ifndef NO__1cairo_1matrix_1init
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1init)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1init)
 	(JNIEnv *env, jclass that, jdoubleArray arg0, jdouble arg1, jdouble arg2, jdouble arg3, jdouble arg4, jdouble arg5, jdouble arg6)
 {
 	jdouble *lparg0=NULL;
@@ -499,7 +563,7 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1matrix_1init_1identity
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1init_1identity)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1init_1identity)
 	(JNIEnv *env, jclass that, jdoubleArray arg0)
 {
 	jdouble *lparg0=NULL;
@@ -513,7 +577,7 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1matrix_1init_1rotate
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1init_1rotate)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1init_1rotate)
 	(JNIEnv *env, jclass that, jdoubleArray arg0, jdouble arg1)
 {
 	jdouble *lparg0=NULL;
@@ -527,7 +591,7 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1matrix_1init_1scale
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1init_1scale)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1init_1scale)
 	(JNIEnv *env, jclass that, jdoubleArray arg0, jdouble arg1, jdouble arg2)
 {
 	jdouble *lparg0=NULL;
@@ -541,7 +605,7 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1matrix_1init_1translate
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1init_1translate)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1init_1translate)
 	(JNIEnv *env, jclass that, jdoubleArray arg0, jdouble arg1, jdouble arg2)
 {
 	jdouble *lparg0=NULL;
@@ -555,7 +619,7 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1matrix_1invert
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1matrix_1invert)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1matrix_1invert)
 	(JNIEnv *env, jclass that, jdoubleArray arg0)
 {
 	jdouble *lparg0=NULL;
@@ -571,7 +635,7 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1matrix_1multiply
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1multiply)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1multiply)
 	(JNIEnv *env, jclass that, jdoubleArray arg0, jdoubleArray arg1, jdoubleArray arg2)
 {
 	jdouble *lparg0=NULL;
@@ -591,7 +655,7 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1matrix_1rotate
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1rotate)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1rotate)
 	(JNIEnv *env, jclass that, jdoubleArray arg0, jdouble arg1)
 {
 	jdouble *lparg0=NULL;
@@ -605,7 +669,7 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1matrix_1scale
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1scale)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1scale)
 	(JNIEnv *env, jclass that, jdoubleArray arg0, jdouble arg1, jdouble arg2)
 {
 	jdouble *lparg0=NULL;
@@ -619,7 +683,7 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1matrix_1transform_1distance
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1transform_1distance)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1transform_1distance)
 	(JNIEnv *env, jclass that, jdoubleArray arg0, jdoubleArray arg1, jdoubleArray arg2)
 {
 	jdouble *lparg0=NULL;
@@ -639,7 +703,7 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1matrix_1transform_1point
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1transform_1point)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1transform_1point)
 	(JNIEnv *env, jclass that, jdoubleArray arg0, jdoubleArray arg1, jdoubleArray arg2)
 {
 	jdouble *lparg0=NULL;
@@ -659,7 +723,7 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1matrix_1translate
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1translate)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1matrix_1translate)
 	(JNIEnv *env, jclass that, jdoubleArray arg0, jdouble arg1, jdouble arg2)
 {
 	jdouble *lparg0=NULL;
@@ -673,27 +737,39 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1move_1to
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1move_1to)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1move_1to)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1move_1to_FUNC);
 	cairo_move_to((cairo_t *)arg0, arg1, arg2);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1move_1to_FUNC);
 }
+
+JNIEXPORT void JNICALL Cairo_CRITICAL(_1cairo_1move_1to)
+	(jintLong arg0, jdouble arg1, jdouble arg2)
+{
+	cairo_move_to((cairo_t *)arg0, arg1, arg2);
+}
 #endif
 
 #ifndef NO__1cairo_1new_1path
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1new_1path)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1new_1path)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1new_1path_FUNC);
 	cairo_new_path((cairo_t *)arg0);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1new_1path_FUNC);
 }
+
+JNIEXPORT void JNICALL Cairo_CRITICAL(_1cairo_1new_1path)
+	(jintLong arg0)
+{
+	cairo_new_path((cairo_t *)arg0);
+}
 #endif
 
 #ifndef NO__1cairo_1paint
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1paint)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1paint)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1paint_FUNC);
@@ -703,7 +779,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1paint)
 #endif
 
 #ifndef NO__1cairo_1paint_1with_1alpha
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1paint_1with_1alpha)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1paint_1with_1alpha)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1paint_1with_1alpha_FUNC);
@@ -713,7 +789,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1paint_1with_1alpha)
 #endif
 
 #ifndef NO__1cairo_1path_1destroy
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1path_1destroy)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1path_1destroy)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1path_1destroy_FUNC);
@@ -723,7 +799,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1path_1destroy)
 #endif
 
 #ifndef NO__1cairo_1pattern_1add_1color_1stop_1rgba
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1pattern_1add_1color_1stop_1rgba)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1pattern_1add_1color_1stop_1rgba)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2, jdouble arg3, jdouble arg4, jdouble arg5)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1pattern_1add_1color_1stop_1rgba_FUNC);
@@ -733,7 +809,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1pattern_1add_1color_1stop_1rgba)
 #endif
 
 #ifndef NO__1cairo_1pattern_1create_1for_1surface
-JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1pattern_1create_1for_1surface)
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1pattern_1create_1for_1surface)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -745,29 +821,31 @@ JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1pattern_1create_1for_1surface)
 #endif
 
 #ifndef NO__1cairo_1pattern_1create_1linear
-JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1pattern_1create_1linear)
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1pattern_1create_1linear)
 	(JNIEnv *env, jclass that, jdouble arg0, jdouble arg1, jdouble arg2, jdouble arg3)
 {
 	jintLong rc = 0;
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1pattern_1create_1linear_FUNC);
 	rc = (jintLong)cairo_pattern_create_linear(arg0, arg1, arg2, arg3);
+	NATIVE_RESOURCE_CREATE(env, "cairo_pattern_t", rc, 0);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1pattern_1create_1linear_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO__1cairo_1pattern_1destroy
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1pattern_1destroy)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1pattern_1destroy)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1pattern_1destroy_FUNC);
+	NATIVE_RESOURCE_DESTROY(env, arg0);
 	cairo_pattern_destroy((cairo_pattern_t *)arg0);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1pattern_1destroy_FUNC);
 }
 #endif
 
 #ifndef NO__1cairo_1pattern_1get_1extend
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1pattern_1get_1extend)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1pattern_1get_1extend)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -779,7 +857,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1pattern_1get_1extend)
 #endif
 
 #ifndef NO__1cairo_1pattern_1set_1extend
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1pattern_1set_1extend)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1pattern_1set_1extend)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1pattern_1set_1extend_FUNC);
@@ -789,7 +867,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1pattern_1set_1extend)
 #endif
 
 #ifndef NO__1cairo_1pattern_1set_1filter
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1pattern_1set_1filter)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1pattern_1set_1filter)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1pattern_1set_1filter_FUNC);
@@ -799,7 +877,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1pattern_1set_1filter)
 #endif
 
 #ifndef NO__1cairo_1pattern_1set_1matrix
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1pattern_1set_1matrix)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1pattern_1set_1matrix)
 	(JNIEnv *env, jclass that, jintLong arg0, jdoubleArray arg1)
 {
 	jdouble *lparg1=NULL;
@@ -812,8 +890,28 @@ fail:
 }
 #endif
 
+#ifndef NO__1cairo_1pdf_1surface_1create_1for_1stream
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1pdf_1surface_1create_1for_1stream)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2, jdouble arg3)
+{
+	jintLong rc = 0;
+	Cairo_NATIVE_ENTER(env, that, _1cairo_1pdf_1surface_1create_1for_1stream_FUNC);
+/*
+	rc = (jintLong)cairo_pdf_surface_create_for_stream((cairo_write_func_t)arg0, (void *)arg1, arg2, arg3);
+*/
+	{
+		Cairo_LOAD_FUNCTION(fp, cairo_pdf_surface_create_for_stream)
+		if (fp) {
+			rc = (jintLong)((jintLong (CALLING_CONVENTION*)(cairo_write_func_t, void *, jdouble, jdouble))fp)((cairo_write_func_t)arg0, (void *)arg1, arg2, arg3);
+		}
+	}
+	Cairo_NATIVE_EXIT(env, that, _1cairo_1pdf_1surface_1create_1for_1stream_FUNC);
+	return rc;
+}
+#endif
+
 #ifndef NO__1cairo_1pdf_1surface_1set_1size
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1pdf_1surface_1set_1size)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1pdf_1surface_1set_1size)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1pdf_1surface_1set_1size_FUNC);
@@ -831,7 +929,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1pdf_1surface_1set_1size)
 #endif
 
 #ifndef NO__1cairo_1pop_1group_1to_1source
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1pop_1group_1to_1source)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1pop_1group_1to_1source)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1pop_1group_1to_1source_FUNC);
@@ -848,8 +946,28 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1pop_1group_1to_1source)
 }
 #endif
 
+#ifndef NO__1cairo_1ps_1surface_1create_1for_1stream
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1ps_1surface_1create_1for_1stream)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2, jdouble arg3)
+{
+	jintLong rc = 0;
+	Cairo_NATIVE_ENTER(env, that, _1cairo_1ps_1surface_1create_1for_1stream_FUNC);
+/*
+	rc = (jintLong)cairo_ps_surface_create_for_stream((cairo_write_func_t)arg0, (void *)arg1, arg2, arg3);
+*/
+	{
+		Cairo_LOAD_FUNCTION(fp, cairo_ps_surface_create_for_stream)
+		if (fp) {
+			rc = (jintLong)((jintLong (CALLING_CONVENTION*)(cairo_write_func_t, void *, jdouble, jdouble))fp)((cairo_write_func_t)arg0, (void *)arg1, arg2, arg3);
+		}
+	}
+	Cairo_NATIVE_EXIT(env, that, _1cairo_1ps_1surface_1create_1for_1stream_FUNC);
+	return rc;
+}
+#endif
+
 #ifndef NO__1cairo_1ps_1surface_1set_1size
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1ps_1surface_1set_1size)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1ps_1surface_1set_1size)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1ps_1surface_1set_1size_FUNC);
@@ -867,7 +985,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1ps_1surface_1set_1size)
 #endif
 
 #ifndef NO__1cairo_1push_1group
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1push_1group)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1push_1group)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1push_1group_FUNC);
@@ -885,17 +1003,23 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1push_1group)
 #endif
 
 #ifndef NO__1cairo_1rectangle
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1rectangle)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1rectangle)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2, jdouble arg3, jdouble arg4)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1rectangle_FUNC);
 	cairo_rectangle((cairo_t *)arg0, arg1, arg2, arg3, arg4);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1rectangle_FUNC);
 }
+
+JNIEXPORT void JNICALL Cairo_CRITICAL(_1cairo_1rectangle)
+	(jintLong arg0, jdouble arg1, jdouble arg2, jdouble arg3, jdouble arg4)
+{
+	cairo_rectangle((cairo_t *)arg0, arg1, arg2, arg3, arg4);
+}
 #endif
 
 #ifndef NO__1cairo_1reference
-JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1reference)
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1reference)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -907,7 +1031,7 @@ JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1reference)
 #endif
 
 #ifndef NO__1cairo_1region_1get_1rectangle
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1region_1get_1rectangle)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1region_1get_1rectangle)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1region_1get_1rectangle_FUNC);
@@ -925,7 +1049,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1region_1get_1rectangle)
 #endif
 
 #ifndef NO__1cairo_1region_1num_1rectangles
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1region_1num_1rectangles)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1region_1num_1rectangles)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -945,7 +1069,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1region_1num_1rectangles)
 #endif
 
 #ifndef NO__1cairo_1reset_1clip
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1reset_1clip)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1reset_1clip)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1reset_1clip_FUNC);
@@ -955,17 +1079,23 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1reset_1clip)
 #endif
 
 #ifndef NO__1cairo_1restore
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1restore)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1restore)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1restore_FUNC);
 	cairo_restore((cairo_t *)arg0);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1restore_FUNC);
 }
+
+JNIEXPORT void JNICALL Cairo_CRITICAL(_1cairo_1restore)
+	(jintLong arg0)
+{
+	cairo_restore((cairo_t *)arg0);
+}
 #endif
 
 #ifndef NO__1cairo_1rotate
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1rotate)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1rotate)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1rotate_FUNC);
@@ -975,17 +1105,23 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1rotate)
 #endif
 
 #ifndef NO__1cairo_1save
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1save)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1save)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1save_FUNC);
 	cairo_save((cairo_t *)arg0);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1save_FUNC);
 }
+
+JNIEXPORT void JNICALL Cairo_CRITICAL(_1cairo_1save)
+	(jintLong arg0)
+{
+	cairo_save((cairo_t *)arg0);
+}
 #endif
 
 #ifndef NO__1cairo_1scale
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1scale)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1scale)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1scale_FUNC);
@@ -995,7 +1131,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1scale)
 #endif
 
 #ifndef NO__1cairo_1select_1font_1face
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1select_1font_1face)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1select_1font_1face)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jint arg3)
 {
 	jbyte *lparg1=NULL;
@@ -1003,13 +1139,13 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1select_1font_1face)
 	if (arg1) if ((lparg1 = (*env)->GetByteArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	cairo_select_font_face((cairo_t *)arg0, (const char *)lparg1, arg2, arg3);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1select_1font_1face_FUNC);
 }
 #endif
 
 #ifndef NO__1cairo_1set_1antialias
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1antialias)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1antialias)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1set_1antialias_FUNC);
@@ -1019,21 +1155,35 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1antialias)
 #endif
 
 #ifndef NO__1cairo_1set_1dash
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1dash)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1dash)
 	(JNIEnv *env, jclass that, jintLong arg0, jdoubleArray arg1, jint arg2, jdouble arg3)
 {
 	jdouble *lparg1=NULL;
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1set_1dash_FUNC);
-	if (arg1) if ((lparg1 = (*env)->GetDoubleArrayElements(env, arg1, NULL)) == NULL) goto fail;
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (arg1) if ((lparg1 = (*env)->GetPrimitiveArrayCritical(env, arg1, NULL)) == NULL) goto fail;
+	} else
+#endif
+	{
+		if (arg1) if ((lparg1 = (*env)->GetDoubleArrayElements(env, arg1, NULL)) == NULL) goto fail;
+	}
 	cairo_set_dash((cairo_t *)arg0, lparg1, arg2, arg3);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseDoubleArrayElements(env, arg1, lparg1, 0);
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (arg1 && lparg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, JNI_ABORT);
+	} else
+#endif
+	{
+		if (arg1 && lparg1) (*env)->ReleaseDoubleArrayElements(env, arg1, lparg1, JNI_ABORT);
+	}
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1set_1dash_FUNC);
 }
 #endif
 
 #ifndef NO__1cairo_1set_1fill_1rule
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1fill_1rule)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1fill_1rule)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1set_1fill_1rule_FUNC);
@@ -1043,7 +1193,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1fill_1rule)
 #endif
 
 #ifndef NO__1cairo_1set_1font_1face
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1font_1face)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1font_1face)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1set_1font_1face_FUNC);
@@ -1053,7 +1203,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1font_1face)
 #endif
 
 #ifndef NO__1cairo_1set_1font_1size
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1font_1size)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1font_1size)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1set_1font_1size_FUNC);
@@ -1063,7 +1213,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1font_1size)
 #endif
 
 #ifndef NO__1cairo_1set_1line_1cap
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1line_1cap)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1line_1cap)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1set_1line_1cap_FUNC);
@@ -1073,7 +1223,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1line_1cap)
 #endif
 
 #ifndef NO__1cairo_1set_1line_1join
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1line_1join)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1line_1join)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1set_1line_1join_FUNC);
@@ -1083,17 +1233,23 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1line_1join)
 #endif
 
 #ifndef NO__1cairo_1set_1line_1width
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1line_1width)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1line_1width)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1set_1line_1width_FUNC);
 	cairo_set_line_width((cairo_t *)arg0, arg1);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1set_1line_1width_FUNC);
 }
+
+JNIEXPORT void JNICALL Cairo_CRITICAL(_1cairo_1set_1line_1width)
+	(jintLong arg0, jdouble arg1)
+{
+	cairo_set_line_width((cairo_t *)arg0, arg1);
+}
 #endif
 
 #ifndef NO__1cairo_1set_1matrix
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1matrix)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1matrix)
 	(JNIEnv *env, jclass that, jintLong arg0, jdoubleArray arg1)
 {
 	jdouble *lparg1=NULL;
@@ -1107,7 +1263,7 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1set_1miter_1limit
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1miter_1limit)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1miter_1limit)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1set_1miter_1limit_FUNC);
@@ -1117,7 +1273,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1miter_1limit)
 #endif
 
 #ifndef NO__1cairo_1set_1operator
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1operator)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1operator)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1set_1operator_FUNC);
@@ -1127,7 +1283,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1operator)
 #endif
 
 #ifndef NO__1cairo_1set_1source
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1source)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1source)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1set_1source_FUNC);
@@ -1137,27 +1293,39 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1source)
 #endif
 
 #ifndef NO__1cairo_1set_1source_1rgb
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1source_1rgb)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1source_1rgb)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2, jdouble arg3)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1set_1source_1rgb_FUNC);
 	cairo_set_source_rgb((cairo_t *)arg0, arg1, arg2, arg3);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1set_1source_1rgb_FUNC);
 }
+
+JNIEXPORT void JNICALL Cairo_CRITICAL(_1cairo_1set_1source_1rgb)
+	(jintLong arg0, jdouble arg1, jdouble arg2, jdouble arg3)
+{
+	cairo_set_source_rgb((cairo_t *)arg0, arg1, arg2, arg3);
+}
 #endif
 
 #ifndef NO__1cairo_1set_1source_1rgba
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1source_1rgba)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1source_1rgba)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2, jdouble arg3, jdouble arg4)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1set_1source_1rgba_FUNC);
 	cairo_set_source_rgba((cairo_t *)arg0, arg1, arg2, arg3, arg4);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1set_1source_1rgba_FUNC);
 }
+
+JNIEXPORT void JNICALL Cairo_CRITICAL(_1cairo_1set_1source_1rgba)
+	(jintLong arg0, jdouble arg1, jdouble arg2, jdouble arg3, jdouble arg4)
+{
+	cairo_set_source_rgba((cairo_t *)arg0, arg1, arg2, arg3, arg4);
+}
 #endif
 
 #ifndef NO__1cairo_1set_1source_1surface
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1source_1surface)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1source_1surface)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2, jdouble arg3)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1set_1source_1surface_FUNC);
@@ -1167,7 +1335,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1source_1surface)
 #endif
 
 #ifndef NO__1cairo_1set_1tolerance
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1tolerance)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1tolerance)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1set_1tolerance_FUNC);
@@ -1177,7 +1345,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1set_1tolerance)
 #endif
 
 #ifndef NO__1cairo_1show_1page
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1show_1page)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1show_1page)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1show_1page_FUNC);
@@ -1187,17 +1355,23 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1show_1page)
 #endif
 
 #ifndef NO__1cairo_1stroke
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1stroke)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1stroke)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1stroke_FUNC);
 	cairo_stroke((cairo_t *)arg0);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1stroke_FUNC);
 }
+
+JNIEXPORT void JNICALL Cairo_CRITICAL(_1cairo_1stroke)
+	(jintLong arg0)
+{
+	cairo_stroke((cairo_t *)arg0);
+}
 #endif
 
 #ifndef NO__1cairo_1surface_1create_1similar
-JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1surface_1create_1similar)
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1surface_1create_1similar)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3)
 {
 	jintLong rc = 0;
@@ -1209,17 +1383,18 @@ JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1surface_1create_1similar)
 #endif
 
 #ifndef NO__1cairo_1surface_1destroy
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1destroy)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1destroy)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1surface_1destroy_FUNC);
+	NATIVE_RESOURCE_DESTROY(env, arg0);
 	cairo_surface_destroy((cairo_surface_t *)arg0);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1surface_1destroy_FUNC);
 }
 #endif
 
 #ifndef NO__1cairo_1surface_1finish
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1finish)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1finish)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1surface_1finish_FUNC);
@@ -1229,7 +1404,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1finish)
 #endif
 
 #ifndef NO__1cairo_1surface_1flush
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1flush)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1flush)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1surface_1flush_FUNC);
@@ -1239,7 +1414,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1flush)
 #endif
 
 #ifndef NO__1cairo_1surface_1get_1content
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1surface_1get_1content)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1surface_1get_1content)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1259,7 +1434,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1surface_1get_1content)
 #endif
 
 #ifndef NO__1cairo_1surface_1get_1type
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1surface_1get_1type)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1surface_1get_1type)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1279,7 +1454,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1surface_1get_1type)
 #endif
 
 #ifndef NO__1cairo_1surface_1get_1user_1data
-JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1surface_1get_1user_1data)
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1surface_1get_1user_1data)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -1291,7 +1466,7 @@ JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1surface_1get_1user_1data)
 #endif
 
 #ifndef NO__1cairo_1surface_1mark_1dirty
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1mark_1dirty)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1mark_1dirty)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1surface_1mark_1dirty_FUNC);
@@ -1301,7 +1476,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1mark_1dirty)
 #endif
 
 #ifndef NO__1cairo_1surface_1reference
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1reference)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1reference)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1surface_1reference_FUNC);
@@ -1311,7 +1486,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1reference)
 #endif
 
 #ifndef NO__1cairo_1surface_1set_1device_1offset
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1set_1device_1offset)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1set_1device_1offset)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1surface_1set_1device_1offset_FUNC);
@@ -1321,7 +1496,7 @@ JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1surface_1set_1device_1offset)
 #endif
 
 #ifndef NO__1cairo_1transform
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1transform)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1transform)
 	(JNIEnv *env, jclass that, jintLong arg0, jdoubleArray arg1)
 {
 	jdouble *lparg1=NULL;
@@ -1335,17 +1510,23 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1translate
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1translate)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1translate)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2)
 {
 	Cairo_NATIVE_ENTER(env, that, _1cairo_1translate_FUNC);
 	cairo_translate((cairo_t *)arg0, arg1, arg2);
 	Cairo_NATIVE_EXIT(env, that, _1cairo_1translate_FUNC);
 }
+
+JNIEXPORT void JNICALL Cairo_CRITICAL(_1cairo_1translate)
+	(jintLong arg0, jdouble arg1, jdouble arg2)
+{
+	cairo_translate((cairo_t *)arg0, arg1, arg2);
+}
 #endif
 
 #ifndef NO__1cairo_1user_1to_1device_1distance
-JNIEXPORT void JNICALL Cairo_NATIVE(_1cairo_1user_1to_1device_1distance)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(_1cairo_1user_1to_1device_1distance)
 	(JNIEnv *env, jclass that, jintLong arg0, jdoubleArray arg1, jdoubleArray arg2)
 {
 	jdouble *lparg1=NULL;
@@ -1362,7 +1543,7 @@ fail:
 #endif
 
 #ifndef NO__1cairo_1xlib_1surface_1create
-JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1xlib_1surface_1create)
+SWT_NATIVE_EXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1xlib_1surface_1create)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jint arg3, jint arg4)
 {
 	jintLong rc = 0;
@@ -1374,7 +1555,7 @@ JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1cairo_1xlib_1surface_1create)
 #endif
 
 #ifndef NO__1cairo_1xlib_1surface_1get_1height
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1xlib_1surface_1get_1height)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1xlib_1surface_1get_1height)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1394,7 +1575,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1xlib_1surface_1get_1height)
 #endif
 
 #ifndef NO__1cairo_1xlib_1surface_1get_1width
-JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1xlib_1surface_1get_1width)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(_1cairo_1xlib_1surface_1get_1width)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1414,7 +1595,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(_1cairo_1xlib_1surface_1get_1width)
 #endif
 
 #ifndef NO_cairo_1path_1data_1t_1sizeof
-JNIEXPORT jint JNICALL Cairo_NATIVE(cairo_1path_1data_1t_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(cairo_1path_1data_1t_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -1426,7 +1607,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(cairo_1path_1data_1t_1sizeof)
 #endif
 
 #ifndef NO_cairo_1path_1t_1sizeof
-JNIEXPORT jint JNICALL Cairo_NATIVE(cairo_1path_1t_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(cairo_1path_1t_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -1438,7 +1619,7 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(cairo_1path_1t_1sizeof)
 #endif
 
 #ifndef NO_cairo_1version
-JNIEXPORT jint JNICALL Cairo_NATIVE(cairo_1version)
+SWT_NATIVE_EXPORT jint JNICALL Cairo_NATIVE(cairo_1version)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -1451,9 +1632,9 @@ JNIEXPORT jint JNICALL Cairo_NATIVE(cairo_1version)
 
 #if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1data_1t_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1data_1t_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL Cairo_NATIVE(memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1data_1t_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1data_1t_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL Cairo_NATIVE(memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1data_1t_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1data_1t_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	cairo_path_data_t _arg0, *lparg0=NULL;
@@ -1476,9 +1657,9 @@ fail:
 
 #if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1t_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1t_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL Cairo_NATIVE(memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1t_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1t_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL Cairo_NATIVE(memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1t_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1t_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	cairo_path_t _arg0, *lparg0=NULL;
@@ -1501,9 +1682,9 @@ fail:
 
 #if (!defined(NO_memmove___3DII) && !defined(JNI64)) || (!defined(NO_memmove___3DJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL Cairo_NATIVE(memmove___3DII)(JNIEnv *env, jclass that, jdoubleArray arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(memmove___3DII)(JNIEnv *env, jclass that, jdoubleArray arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL Cairo_NATIVE(memmove___3DJJ)(JNIEnv *env, jclass that, jdoubleArray arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL Cairo_NATIVE(memmove___3DJJ)(JNIEnv *env, jclass that, jdoubleArray arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	jdouble *lparg0=NULL;
@@ -1524,3 +1705,788 @@ fail:
 }
 #endif
 
+#ifndef NO_REGISTER_NATIVES
+static JNINativeMethod Cairo_nativeMethods[] = {
+#ifndef NO_CAIRO_1VERSION_1ENCODE
+	{(char *)"CAIRO_VERSION_ENCODE", (char *)"(III)I", (void *)Cairo_NATIVE(CAIRO_1VERSION_1ENCODE)},
+#endif
+#ifndef NO__1cairo_1append_1path
+#ifndef JNI64
+	{(char *)"_cairo_append_path", (char *)"(II)V", (void *)Cairo_NATIVE(_1cairo_1append_1path)},
+#else
+	{(char *)"_cairo_append_path", (char *)"(JJ)V", (void *)Cairo_NATIVE(_1cairo_1append_1path)},
+#endif
+#endif
+#ifndef NO__1cairo_1arc
+#ifndef JNI64
+	{(char *)"_cairo_arc", (char *)"(IDDDDD)V", (void *)Cairo_NATIVE(_1cairo_1arc)},
+#else
+	{(char *)"_cairo_arc", (char *)"(JDDDDD)V", (void *)Cairo_NATIVE(_1cairo_1arc)},
+#endif
+#endif
+#ifndef NO__1cairo_1arc_1negative
+#ifndef JNI64
+	{(char *)"_cairo_arc_negative", (char *)"(IDDDDD)V", (void *)Cairo_NATIVE(_1cairo_1arc_1negative)},
+#else
+	{(char *)"_cairo_arc_negative", (char *)"(JDDDDD)V", (void *)Cairo_NATIVE(_1cairo_1arc_1negative)},
+#endif
+#endif
+#ifndef NO__1cairo_1clip
+#ifndef JNI64
+	{(char *)"_cairo_clip", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1clip)},
+#else
+	{(char *)"_cairo_clip", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1clip)},
+#endif
+#endif
+#ifndef NO__1cairo_1close_1path
+#ifndef JNI64
+	{(char *)"_cairo_close_path", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1close_1path)},
+#else
+	{(char *)"_cairo_close_path", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1close_1path)},
+#endif
+#endif
+#ifndef NO__1cairo_1copy_1page
+#ifndef JNI64
+	{(char *)"_cairo_copy_page", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1copy_1page)},
+#else
+	{(char *)"_cairo_copy_page", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1copy_1page)},
+#endif
+#endif
+#ifndef NO__1cairo_1copy_1path
+#ifndef JNI64
+	{(char *)"_cairo_copy_path", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1copy_1path)},
+#else
+	{(char *)"_cairo_copy_path", (char *)"(J)J", (void *)Cairo_NATIVE(_1cairo_1copy_1path)},
+#endif
+#endif
+#ifndef NO__1cairo_1copy_1path_1flat
+#ifndef JNI64
+	{(char *)"_cairo_copy_path_flat", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1copy_1path_1flat)},
+#else
+	{(char *)"_cairo_copy_path_flat", (char *)"(J)J", (void *)Cairo_NATIVE(_1cairo_1copy_1path_1flat)},
+#endif
+#endif
+#ifndef NO__1cairo_1create
+#ifndef JNI64
+	{(char *)"_cairo_create", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1create)},
+#else
+	{(char *)"_cairo_create", (char *)"(J)J", (void *)Cairo_NATIVE(_1cairo_1create)},
+#endif
+#endif
+#ifndef NO__1cairo_1curve_1to
+#ifndef JNI64
+	{(char *)"_cairo_curve_to", (char *)"(IDDDDDD)V", (void *)Cairo_NATIVE(_1cairo_1curve_1to)},
+#else
+	{(char *)"_cairo_curve_to", (char *)"(JDDDDDD)V", (void *)Cairo_NATIVE(_1cairo_1curve_1to)},
+#endif
+#endif
+#ifndef NO__1cairo_1destroy
+#ifndef JNI64
+	{(char *)"_cairo_destroy", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1destroy)},
+#else
+	{(char *)"_cairo_destroy", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1destroy)},
+#endif
+#endif
+#ifndef NO__1cairo_1fill
+#ifndef JNI64
+	{(char *)"_cairo_fill", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1fill)},
+#else
+	{(char *)"_cairo_fill", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1fill)},
+#endif
+#endif
+#ifndef NO__1cairo_1font_1options_1create
+#ifndef JNI64
+	{(char *)"_cairo_font_options_create", (char *)"()I", (void *)Cairo_NATIVE(_1cairo_1font_1options_1create)},
+#else
+	{(char *)"_cairo_font_options_create", (char *)"()J", (void *)Cairo_NATIVE(_1cairo_1font_1options_1create)},
+#endif
+#endif
+#ifndef NO__1cairo_1font_1options_1destroy
+#ifndef JNI64
+	{(char *)"_cairo_font_options_destroy", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1font_1options_1destroy)},
+#else
+	{(char *)"_cairo_font_options_destroy", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1font_1options_1destroy)},
+#endif
+#endif
+#ifndef NO__1cairo_1font_1options_1get_1antialias
+#ifndef JNI64
+	{(char *)"_cairo_font_options_get_antialias", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1font_1options_1get_1antialias)},
+#else
+	{(char *)"_cairo_font_options_get_antialias", (char *)"(J)I", (void *)Cairo_NATIVE(_1cairo_1font_1options_1get_1antialias)},
+#endif
+#endif
+#ifndef NO__1cairo_1font_1options_1set_1antialias
+#ifndef JNI64
+	{(char *)"_cairo_font_options_set_antialias", (char *)"(II)V", (void *)Cairo_NATIVE(_1cairo_1font_1options_1set_1antialias)},
+#else
+	{(char *)"_cairo_font_options_set_antialias", (char *)"(JI)V", (void *)Cairo_NATIVE(_1cairo_1font_1options_1set_1antialias)},
+#endif
+#endif
+#ifndef NO__1cairo_1get_1antialias
+#ifndef JNI64
+	{(char *)"_cairo_get_antialias", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1get_1antialias)},
+#else
+	{(char *)"_cairo_get_antialias", (char *)"(J)I", (void *)Cairo_NATIVE(_1cairo_1get_1antialias)},
+#endif
+#endif
+#ifndef NO__1cairo_1get_1current_1point
+#ifndef JNI64
+	{(char *)"_cairo_get_current_point", (char *)"(I[D[D)V", (void *)Cairo_NATIVE(_1cairo_1get_1current_1point)},
+#else
+	{(char *)"_cairo_get_current_point", (char *)"(J[D[D)V", (void *)Cairo_NATIVE(_1cairo_1get_1current_1point)},
+#endif
+#endif
+#ifndef NO__1cairo_1get_1fill_1rule
+#ifndef JNI64
+	{(char *)"_cairo_get_fill_rule", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1get_1fill_1rule)},
+#else
+	{(char *)"_cairo_get_fill_rule", (char *)"(J)I", (void *)Cairo_NATIVE(_1cairo_1get_1fill_1rule)},
+#endif
+#endif
+#ifndef NO__1cairo_1get_1font_1face
+#ifndef JNI64
+	{(char *)"_cairo_get_font_face", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1get_1font_1face)},
+#else
+	{(char *)"_cairo_get_font_face", (char *)"(J)J", (void *)Cairo_NATIVE(_1cairo_1get_1font_1face)},
+#endif
+#endif
+#ifndef NO__1cairo_1get_1matrix
+#ifndef JNI64
+	{(char *)"_cairo_get_matrix", (char *)"(I[D)V", (void *)Cairo_NATIVE(_1cairo_1get_1matrix)},
+#else
+	{(char *)"_cairo_get_matrix", (char *)"(J[D)V", (void *)Cairo_NATIVE(_1cairo_1get_1matrix)},
+#endif
+#endif
+#ifndef NO__1cairo_1get_1operator
+#ifndef JNI64
+	{(char *)"_cairo_get_operator", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1get_1operator)},
+#else
+	{(char *)"_cairo_get_operator", (char *)"(J)I", (void *)Cairo_NATIVE(_1cairo_1get_1operator)},
+#endif
+#endif
+#ifndef NO__1cairo_1get_1source
+#ifndef JNI64
+	{(char *)"_cairo_get_source", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1get_1source)},
+#else
+	{(char *)"_cairo_get_source", (char *)"(J)J", (void *)Cairo_NATIVE(_1cairo_1get_1source)},
+#endif
+#endif
+#ifndef NO__1cairo_1get_1target
+#ifndef JNI64
+	{(char *)"_cairo_get_target", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1get_1target)},
+#else
+	{(char *)"_cairo_get_target", (char *)"(J)J", (void *)Cairo_NATIVE(_1cairo_1get_1target)},
+#endif
+#endif
+#ifndef NO__1cairo_1get_1tolerance
+#ifndef JNI64
+	{(char *)"_cairo_get_tolerance", (char *)"(I)D", (void *)Cairo_NATIVE(_1cairo_1get_1tolerance)},
+#else
+	{(char *)"_cairo_get_tolerance", (char *)"(J)D", (void *)Cairo_NATIVE(_1cairo_1get_1tolerance)},
+#endif
+#endif
+#ifndef NO__1cairo_1identity_1matrix
+#ifndef JNI64
+	{(char *)"_cairo_identity_matrix", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1identity_1matrix)},
+#else
+	{(char *)"_cairo_identity_matrix", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1identity_1matrix)},
+#endif
+#endif
+#ifndef NO__1cairo_1image_1surface_1create
+#ifndef JNI64
+	{(char *)"_cairo_image_surface_create", (char *)"(III)I", (void *)Cairo_NATIVE(_1cairo_1image_1surface_1create)},
+#else
+	{(char *)"_cairo_image_surface_create", (char *)"(III)J", (void *)Cairo_NATIVE(_1cairo_1image_1surface_1create)},
+#endif
+#endif
+#ifndef NO__1cairo_1image_1surface_1get_1data
+#ifndef JNI64
+	{(char *)"_cairo_image_surface_get_data", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1image_1surface_1get_1data)},
+#else
+	{(char *)"_cairo_image_surface_get_data", (char *)"(J)J", (void *)Cairo_NATIVE(_1cairo_1image_1surface_1get_1data)},
+#endif
+#endif
+#ifndef NO__1cairo_1image_1surface_1get_1format
+#ifndef JNI64
+	{(char *)"_cairo_image_surface_get_format", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1image_1surface_1get_1format)},
+#else
+	{(char *)"_cairo_image_surface_get_format", (char *)"(J)I", (void *)Cairo_NATIVE(_1cairo_1image_1surface_1get_1format)},
+#endif
+#endif
+#ifndef NO__1cairo_1image_1surface_1get_1height
+#ifndef JNI64
+	{(char *)"_cairo_image_surface_get_height", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1image_1surface_1get_1height)},
+#else
+	{(char *)"_cairo_image_surface_get_height", (char *)"(J)I", (void *)Cairo_NATIVE(_1cairo_1image_1surface_1get_1height)},
+#endif
+#endif
+#ifndef NO__1cairo_1image_1surface_1get_1stride
+#ifndef JNI64
+	{(char *)"_cairo_image_surface_get_stride", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1image_1surface_1get_1stride)},
+#else
+	{(char *)"_cairo_image_surface_get_stride", (char *)"(J)I", (void *)Cairo_NATIVE(_1cairo_1image_1surface_1get_1stride)},
+#endif
+#endif
+#ifndef NO__1cairo_1image_1surface_1get_1width
+#ifndef JNI64
+	{(char *)"_cairo_image_surface_get_width", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1image_1surface_1get_1width)},
+#else
+	{(char *)"_cairo_image_surface_get_width", (char *)"(J)I", (void *)Cairo_NATIVE(_1cairo_1image_1surface_1get_1width)},
+#endif
+#endif
+#ifndef NO__1cairo_1in_1fill
+#ifndef JNI64
+	{(char *)"_cairo_in_fill", (char *)"(IDD)I", (void *)Cairo_NATIVE(_1cairo_1in_1fill)},
+#else
+	{(char *)"_cairo_in_fill", (char *)"(JDD)I", (void *)Cairo_NATIVE(_1cairo_1in_1fill)},
+#endif
+#endif
+#ifndef NO__1cairo_1in_1stroke
+#ifndef JNI64
+	{(char *)"_cairo_in_stroke", (char *)"(IDD)I", (void *)Cairo_NATIVE(_1cairo_1in_1stroke)},
+#else
+	{(char *)"_cairo_in_stroke", (char *)"(JDD)I", (void *)Cairo_NATIVE(_1cairo_1in_1stroke)},
+#endif
+#endif
+#ifndef NO__1cairo_1line_1to
+#ifndef JNI64
+	{(char *)"_cairo_line_to", (char *)"(IDD)V", (void *)Cairo_NATIVE(_1cairo_1line_1to)},
+#else
+	{(char *)"_cairo_line_to", (char *)"(JDD)V", (void *)Cairo_NATIVE(_1cairo_1line_1to)},
+#endif
+#endif
+#ifndef NO__1cairo_1line_1to_1batch
+#ifndef JNI64
+	{(char *)"_cairo_line_to_batch", (char *)"(I[D[D)V", (void *)Cairo_NATIVE(_1cairo_1line_1to_1batch)},
+#else
+	{(char *)"_cairo_line_to_batch", (char *)"(J[D[D)V", (void *)Cairo_NATIVE(_1cairo_1line_1to_1batch)},
+#endif
+#endif
+#ifndef NO__1cairo_1mask
+#ifndef JNI64
+	{(char *)"_cairo_mask", (char *)"(II)V", (void *)Cairo_NATIVE(_1cairo_1mask)},
+#else
+	{(char *)"_cairo_mask", (char *)"(JJ)V", (void *)Cairo_NATIVE(_1cairo_1mask)},
+#endif
+#endif
+#ifndef NO__1cairo_1mask_1surface
+#ifndef JNI64
+	{(char *)"_cairo_mask_surface", (char *)"(IIDD)V", (void *)Cairo_NATIVE(_1cairo_1mask_1surface)},
+#else
+	{(char *)"_cairo_mask_surface", (char *)"(JJDD)V", (void *)Cairo_NATIVE(_1cairo_1mask_1surface)},
+#endif
+#endif
+#ifndef NO__1cairo_1matrix_1init
+	{(char *)"_cairo_matrix_init", (char *)"([DDDDDDD)V", (void *)Cairo_NATIVE(_1cairo_1matrix_1init)},
+#endif
+#ifndef NO__1cairo_1matrix_1init_1identity
+	{(char *)"_cairo_matrix_init_identity", (char *)"([D)V", (void *)Cairo_NATIVE(_1cairo_1matrix_1init_1identity)},
+#endif
+#ifndef NO__1cairo_1matrix_1init_1rotate
+	{(char *)"_cairo_matrix_init_rotate", (char *)"([DD)V", (void *)Cairo_NATIVE(_1cairo_1matrix_1init_1rotate)},
+#endif
+#ifndef NO__1cairo_1matrix_1init_1scale
+	{(char *)"_cairo_matrix_init_scale", (char *)"([DDD)V", (void *)Cairo_NATIVE(_1cairo_1matrix_1init_1scale)},
+#endif
+#ifndef NO__1cairo_1matrix_1init_1translate
+	{(char *)"_cairo_matrix_init_translate", (char *)"([DDD)V", (void *)Cairo_NATIVE(_1cairo_1matrix_1init_1translate)},
+#endif
+#ifndef NO__1cairo_1matrix_1invert
+	{(char *)"_cairo_matrix_invert", (char *)"([D)I", (void *)Cairo_NATIVE(_1cairo_1matrix_1invert)},
+#endif
+#ifndef NO__1cairo_1matrix_1multiply
+	{(char *)"_cairo_matrix_multiply", (char *)"([D[D[D)V", (void *)Cairo_NATIVE(_1cairo_1matrix_1multiply)},
+#endif
+#ifndef NO__1cairo_1matrix_1rotate
+	{(char *)"_cairo_matrix_rotate", (char *)"([DD)V", (void *)Cairo_NATIVE(_1cairo_1matrix_1rotate)},
+#endif
+#ifndef NO__1cairo_1matrix_1scale
+	{(char *)"_cairo_matrix_scale", (char *)"([DDD)V", (void *)Cairo_NATIVE(_1cairo_1matrix_1scale)},
+#endif
+#ifndef NO__1cairo_1matrix_1transform_1distance
+	{(char *)"_cairo_matrix_transform_distance", (char *)"([D[D[D)V", (void *)Cairo_NATIVE(_1cairo_1matrix_1transform_1distance)},
+#endif
+#ifndef NO__1cairo_1matrix_1transform_1point
+	{(char *)"_cairo_matrix_transform_point", (char *)"([D[D[D)V", (void *)Cairo_NATIVE(_1cairo_1matrix_1transform_1point)},
+#endif
+#ifndef NO__1cairo_1matrix_1translate
+	{(char *)"_cairo_matrix_translate", (char *)"([DDD)V", (void *)Cairo_NATIVE(_1cairo_1matrix_1translate)},
+#endif
+#ifndef NO__1cairo_1move_1to
+#ifndef JNI64
+	{(char *)"_cairo_move_to", (char *)"(IDD)V", (void *)Cairo_NATIVE(_1cairo_1move_1to)},
+#else
+	{(char *)"_cairo_move_to", (char *)"(JDD)V", (void *)Cairo_NATIVE(_1cairo_1move_1to)},
+#endif
+#endif
+#ifndef NO__1cairo_1new_1path
+#ifndef JNI64
+	{(char *)"_cairo_new_path", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1new_1path)},
+#else
+	{(char *)"_cairo_new_path", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1new_1path)},
+#endif
+#endif
+#ifndef NO__1cairo_1paint
+#ifndef JNI64
+	{(char *)"_cairo_paint", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1paint)},
+#else
+	{(char *)"_cairo_paint", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1paint)},
+#endif
+#endif
+#ifndef NO__1cairo_1paint_1with_1alpha
+#ifndef JNI64
+	{(char *)"_cairo_paint_with_alpha", (char *)"(ID)V", (void *)Cairo_NATIVE(_1cairo_1paint_1with_1alpha)},
+#else
+	{(char *)"_cairo_paint_with_alpha", (char *)"(JD)V", (void *)Cairo_NATIVE(_1cairo_1paint_1with_1alpha)},
+#endif
+#endif
+#ifndef NO__1cairo_1path_1destroy
+#ifndef JNI64
+	{(char *)"_cairo_path_destroy", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1path_1destroy)},
+#else
+	{(char *)"_cairo_path_destroy", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1path_1destroy)},
+#endif
+#endif
+#ifndef NO__1cairo_1pattern_1add_1color_1stop_1rgba
+#ifndef JNI64
+	{(char *)"_cairo_pattern_add_color_stop_rgba", (char *)"(IDDDDD)V", (void *)Cairo_NATIVE(_1cairo_1pattern_1add_1color_1stop_1rgba)},
+#else
+	{(char *)"_cairo_pattern_add_color_stop_rgba", (char *)"(JDDDDD)V", (void *)Cairo_NATIVE(_1cairo_1pattern_1add_1color_1stop_1rgba)},
+#endif
+#endif
+#ifndef NO__1cairo_1pattern_1create_1for_1surface
+#ifndef JNI64
+	{(char *)"_cairo_pattern_create_for_surface", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1pattern_1create_1for_1surface)},
+#else
+	{(char *)"_cairo_pattern_create_for_surface", (char *)"(J)J", (void *)Cairo_NATIVE(_1cairo_1pattern_1create_1for_1surface)},
+#endif
+#endif
+#ifndef NO__1cairo_1pattern_1create_1linear
+#ifndef JNI64
+	{(char *)"_cairo_pattern_create_linear", (char *)"(DDDD)I", (void *)Cairo_NATIVE(_1cairo_1pattern_1create_1linear)},
+#else
+	{(char *)"_cairo_pattern_create_linear", (char *)"(DDDD)J", (void *)Cairo_NATIVE(_1cairo_1pattern_1create_1linear)},
+#endif
+#endif
+#ifndef NO__1cairo_1pattern_1destroy
+#ifndef JNI64
+	{(char *)"_cairo_pattern_destroy", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1pattern_1destroy)},
+#else
+	{(char *)"_cairo_pattern_destroy", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1pattern_1destroy)},
+#endif
+#endif
+#ifndef NO__1cairo_1pattern_1get_1extend
+#ifndef JNI64
+	{(char *)"_cairo_pattern_get_extend", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1pattern_1get_1extend)},
+#else
+	{(char *)"_cairo_pattern_get_extend", (char *)"(J)I", (void *)Cairo_NATIVE(_1cairo_1pattern_1get_1extend)},
+#endif
+#endif
+#ifndef NO__1cairo_1pattern_1set_1extend
+#ifndef JNI64
+	{(char *)"_cairo_pattern_set_extend", (char *)"(II)V", (void *)Cairo_NATIVE(_1cairo_1pattern_1set_1extend)},
+#else
+	{(char *)"_cairo_pattern_set_extend", (char *)"(JI)V", (void *)Cairo_NATIVE(_1cairo_1pattern_1set_1extend)},
+#endif
+#endif
+#ifndef NO__1cairo_1pattern_1set_1filter
+#ifndef JNI64
+	{(char *)"_cairo_pattern_set_filter", (char *)"(II)V", (void *)Cairo_NATIVE(_1cairo_1pattern_1set_1filter)},
+#else
+	{(char *)"_cairo_pattern_set_filter", (char *)"(JI)V", (void *)Cairo_NATIVE(_1cairo_1pattern_1set_1filter)},
+#endif
+#endif
+#ifndef NO__1cairo_1pattern_1set_1matrix
+#ifndef JNI64
+	{(char *)"_cairo_pattern_set_matrix", (char *)"(I[D)V", (void *)Cairo_NATIVE(_1cairo_1pattern_1set_1matrix)},
+#else
+	{(char *)"_cairo_pattern_set_matrix", (char *)"(J[D)V", (void *)Cairo_NATIVE(_1cairo_1pattern_1set_1matrix)},
+#endif
+#endif
+#ifndef NO__1cairo_1pdf_1surface_1create_1for_1stream
+#ifndef JNI64
+	{(char *)"_cairo_pdf_surface_create_for_stream", (char *)"(IIDD)I", (void *)Cairo_NATIVE(_1cairo_1pdf_1surface_1create_1for_1stream)},
+#else
+	{(char *)"_cairo_pdf_surface_create_for_stream", (char *)"(JJDD)J", (void *)Cairo_NATIVE(_1cairo_1pdf_1surface_1create_1for_1stream)},
+#endif
+#endif
+#ifndef NO__1cairo_1pdf_1surface_1set_1size
+#ifndef JNI64
+	{(char *)"_cairo_pdf_surface_set_size", (char *)"(IDD)V", (void *)Cairo_NATIVE(_1cairo_1pdf_1surface_1set_1size)},
+#else
+	{(char *)"_cairo_pdf_surface_set_size", (char *)"(JDD)V", (void *)Cairo_NATIVE(_1cairo_1pdf_1surface_1set_1size)},
+#endif
+#endif
+#ifndef NO__1cairo_1pop_1group_1to_1source
+#ifndef JNI64
+	{(char *)"_cairo_pop_group_to_source", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1pop_1group_1to_1source)},
+#else
+	{(char *)"_cairo_pop_group_to_source", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1pop_1group_1to_1source)},
+#endif
+#endif
+#ifndef NO__1cairo_1ps_1surface_1create_1for_1stream
+#ifndef JNI64
+	{(char *)"_cairo_ps_surface_create_for_stream", (char *)"(IIDD)I", (void *)Cairo_NATIVE(_1cairo_1ps_1surface_1create_1for_1stream)},
+#else
+	{(char *)"_cairo_ps_surface_create_for_stream", (char *)"(JJDD)J", (void *)Cairo_NATIVE(_1cairo_1ps_1surface_1create_1for_1stream)},
+#endif
+#endif
+#ifndef NO__1cairo_1ps_1surface_1set_1size
+#ifndef JNI64
+	{(char *)"_cairo_ps_surface_set_size", (char *)"(IDD)V", (void *)Cairo_NATIVE(_1cairo_1ps_1surface_1set_1size)},
+#else
+	{(char *)"_cairo_ps_surface_set_size", (char *)"(JDD)V", (void *)Cairo_NATIVE(_1cairo_1ps_1surface_1set_1size)},
+#endif
+#endif
+#ifndef NO__1cairo_1push_1group
+#ifndef JNI64
+	{(char *)"_cairo_push_group", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1push_1group)},
+#else
+	{(char *)"_cairo_push_group", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1push_1group)},
+#endif
+#endif
+#ifndef NO__1cairo_1rectangle
+#ifndef JNI64
+	{(char *)"_cairo_rectangle", (char *)"(IDDDD)V", (void *)Cairo_NATIVE(_1cairo_1rectangle)},
+#else
+	{(char *)"_cairo_rectangle", (char *)"(JDDDD)V", (void *)Cairo_NATIVE(_1cairo_1rectangle)},
+#endif
+#endif
+#ifndef NO__1cairo_1reference
+#ifndef JNI64
+	{(char *)"_cairo_reference", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1reference)},
+#else
+	{(char *)"_cairo_reference", (char *)"(J)J", (void *)Cairo_NATIVE(_1cairo_1reference)},
+#endif
+#endif
+#ifndef NO__1cairo_1region_1get_1rectangle
+#ifndef JNI64
+	{(char *)"_cairo_region_get_rectangle", (char *)"(III)V", (void *)Cairo_NATIVE(_1cairo_1region_1get_1rectangle)},
+#else
+	{(char *)"_cairo_region_get_rectangle", (char *)"(JIJ)V", (void *)Cairo_NATIVE(_1cairo_1region_1get_1rectangle)},
+#endif
+#endif
+#ifndef NO__1cairo_1region_1num_1rectangles
+#ifndef JNI64
+	{(char *)"_cairo_region_num_rectangles", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1region_1num_1rectangles)},
+#else
+	{(char *)"_cairo_region_num_rectangles", (char *)"(J)I", (void *)Cairo_NATIVE(_1cairo_1region_1num_1rectangles)},
+#endif
+#endif
+#ifndef NO__1cairo_1reset_1clip
+#ifndef JNI64
+	{(char *)"_cairo_reset_clip", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1reset_1clip)},
+#else
+	{(char *)"_cairo_reset_clip", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1reset_1clip)},
+#endif
+#endif
+#ifndef NO__1cairo_1restore
+#ifndef JNI64
+	{(char *)"_cairo_restore", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1restore)},
+#else
+	{(char *)"_cairo_restore", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1restore)},
+#endif
+#endif
+#ifndef NO__1cairo_1rotate
+#ifndef JNI64
+	{(char *)"_cairo_rotate", (char *)"(ID)V", (void *)Cairo_NATIVE(_1cairo_1rotate)},
+#else
+	{(char *)"_cairo_rotate", (char *)"(JD)V", (void *)Cairo_NATIVE(_1cairo_1rotate)},
+#endif
+#endif
+#ifndef NO__1cairo_1save
+#ifndef JNI64
+	{(char *)"_cairo_save", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1save)},
+#else
+	{(char *)"_cairo_save", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1save)},
+#endif
+#endif
+#ifndef NO__1cairo_1scale
+#ifndef JNI64
+	{(char *)"_cairo_scale", (char *)"(IDD)V", (void *)Cairo_NATIVE(_1cairo_1scale)},
+#else
+	{(char *)"_cairo_scale", (char *)"(JDD)V", (void *)Cairo_NATIVE(_1cairo_1scale)},
+#endif
+#endif
+#ifndef NO__1cairo_1select_1font_1face
+#ifndef JNI64
+	{(char *)"_cairo_select_font_face", (char *)"(I[BII)V", (void *)Cairo_NATIVE(_1cairo_1select_1font_1face)},
+#else
+	{(char *)"_cairo_select_font_face", (char *)"(J[BII)V", (void *)Cairo_NATIVE(_1cairo_1select_1font_1face)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1antialias
+#ifndef JNI64
+	{(char *)"_cairo_set_antialias", (char *)"(II)V", (void *)Cairo_NATIVE(_1cairo_1set_1antialias)},
+#else
+	{(char *)"_cairo_set_antialias", (char *)"(JI)V", (void *)Cairo_NATIVE(_1cairo_1set_1antialias)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1dash
+#ifndef JNI64
+	{(char *)"_cairo_set_dash", (char *)"(I[DID)V", (void *)Cairo_NATIVE(_1cairo_1set_1dash)},
+#else
+	{(char *)"_cairo_set_dash", (char *)"(J[DID)V", (void *)Cairo_NATIVE(_1cairo_1set_1dash)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1fill_1rule
+#ifndef JNI64
+	{(char *)"_cairo_set_fill_rule", (char *)"(II)V", (void *)Cairo_NATIVE(_1cairo_1set_1fill_1rule)},
+#else
+	{(char *)"_cairo_set_fill_rule", (char *)"(JI)V", (void *)Cairo_NATIVE(_1cairo_1set_1fill_1rule)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1font_1face
+#ifndef JNI64
+	{(char *)"_cairo_set_font_face", (char *)"(II)V", (void *)Cairo_NATIVE(_1cairo_1set_1font_1face)},
+#else
+	{(char *)"_cairo_set_font_face", (char *)"(JJ)V", (void *)Cairo_NATIVE(_1cairo_1set_1font_1face)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1font_1size
+#ifndef JNI64
+	{(char *)"_cairo_set_font_size", (char *)"(ID)V", (void *)Cairo_NATIVE(_1cairo_1set_1font_1size)},
+#else
+	{(char *)"_cairo_set_font_size", (char *)"(JD)V", (void *)Cairo_NATIVE(_1cairo_1set_1font_1size)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1line_1cap
+#ifndef JNI64
+	{(char *)"_cairo_set_line_cap", (char *)"(II)V", (void *)Cairo_NATIVE(_1cairo_1set_1line_1cap)},
+#else
+	{(char *)"_cairo_set_line_cap", (char *)"(JI)V", (void *)Cairo_NATIVE(_1cairo_1set_1line_1cap)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1line_1join
+#ifndef JNI64
+	{(char *)"_cairo_set_line_join", (char *)"(II)V", (void *)Cairo_NATIVE(_1cairo_1set_1line_1join)},
+#else
+	{(char *)"_cairo_set_line_join", (char *)"(JI)V", (void *)Cairo_NATIVE(_1cairo_1set_1line_1join)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1line_1width
+#ifndef JNI64
+	{(char *)"_cairo_set_line_width", (char *)"(ID)V", (void *)Cairo_NATIVE(_1cairo_1set_1line_1width)},
+#else
+	{(char *)"_cairo_set_line_width", (char *)"(JD)V", (void *)Cairo_NATIVE(_1cairo_1set_1line_1width)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1matrix
+#ifndef JNI64
+	{(char *)"_cairo_set_matrix", (char *)"(I[D)V", (void *)Cairo_NATIVE(_1cairo_1set_1matrix)},
+#else
+	{(char *)"_cairo_set_matrix", (char *)"(J[D)V", (void *)Cairo_NATIVE(_1cairo_1set_1matrix)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1miter_1limit
+#ifndef JNI64
+	{(char *)"_cairo_set_miter_limit", (char *)"(ID)V", (void *)Cairo_NATIVE(_1cairo_1set_1miter_1limit)},
+#else
+	{(char *)"_cairo_set_miter_limit", (char *)"(JD)V", (void *)Cairo_NATIVE(_1cairo_1set_1miter_1limit)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1operator
+#ifndef JNI64
+	{(char *)"_cairo_set_operator", (char *)"(II)V", (void *)Cairo_NATIVE(_1cairo_1set_1operator)},
+#else
+	{(char *)"_cairo_set_operator", (char *)"(JI)V", (void *)Cairo_NATIVE(_1cairo_1set_1operator)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1source
+#ifndef JNI64
+	{(char *)"_cairo_set_source", (char *)"(II)V", (void *)Cairo_NATIVE(_1cairo_1set_1source)},
+#else
+	{(char *)"_cairo_set_source", (char *)"(JJ)V", (void *)Cairo_NATIVE(_1cairo_1set_1source)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1source_1rgb
+#ifndef JNI64
+	{(char *)"_cairo_set_source_rgb", (char *)"(IDDD)V", (void *)Cairo_NATIVE(_1cairo_1set_1source_1rgb)},
+#else
+	{(char *)"_cairo_set_source_rgb", (char *)"(JDDD)V", (void *)Cairo_NATIVE(_1cairo_1set_1source_1rgb)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1source_1rgba
+#ifndef JNI64
+	{(char *)"_cairo_set_source_rgba", (char *)"(IDDDD)V", (void *)Cairo_NATIVE(_1cairo_1set_1source_1rgba)},
+#else
+	{(char *)"_cairo_set_source_rgba", (char *)"(JDDDD)V", (void *)Cairo_NATIVE(_1cairo_1set_1source_1rgba)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1source_1surface
+#ifndef JNI64
+	{(char *)"_cairo_set_source_surface", (char *)"(IIDD)V", (void *)Cairo_NATIVE(_1cairo_1set_1source_1surface)},
+#else
+	{(char *)"_cairo_set_source_surface", (char *)"(JJDD)V", (void *)Cairo_NATIVE(_1cairo_1set_1source_1surface)},
+#endif
+#endif
+#ifndef NO__1cairo_1set_1tolerance
+#ifndef JNI64
+	{(char *)"_cairo_set_tolerance", (char *)"(ID)V", (void *)Cairo_NATIVE(_1cairo_1set_1tolerance)},
+#else
+	{(char *)"_cairo_set_tolerance", (char *)"(JD)V", (void *)Cairo_NATIVE(_1cairo_1set_1tolerance)},
+#endif
+#endif
+#ifndef NO__1cairo_1show_1page
+#ifndef JNI64
+	{(char *)"_cairo_show_page", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1show_1page)},
+#else
+	{(char *)"_cairo_show_page", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1show_1page)},
+#endif
+#endif
+#ifndef NO__1cairo_1stroke
+#ifndef JNI64
+	{(char *)"_cairo_stroke", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1stroke)},
+#else
+	{(char *)"_cairo_stroke", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1stroke)},
+#endif
+#endif
+#ifndef NO__1cairo_1surface_1create_1similar
+#ifndef JNI64
+	{(char *)"_cairo_surface_create_similar", (char *)"(IIII)I", (void *)Cairo_NATIVE(_1cairo_1surface_1create_1similar)},
+#else
+	{(char *)"_cairo_surface_create_similar", (char *)"(JIII)J", (void *)Cairo_NATIVE(_1cairo_1surface_1create_1similar)},
+#endif
+#endif
+#ifndef NO__1cairo_1surface_1destroy
+#ifndef JNI64
+	{(char *)"_cairo_surface_destroy", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1surface_1destroy)},
+#else
+	{(char *)"_cairo_surface_destroy", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1surface_1destroy)},
+#endif
+#endif
+#ifndef NO__1cairo_1surface_1finish
+#ifndef JNI64
+	{(char *)"_cairo_surface_finish", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1surface_1finish)},
+#else
+	{(char *)"_cairo_surface_finish", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1surface_1finish)},
+#endif
+#endif
+#ifndef NO__1cairo_1surface_1flush
+#ifndef JNI64
+	{(char *)"_cairo_surface_flush", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1surface_1flush)},
+#else
+	{(char *)"_cairo_surface_flush", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1surface_1flush)},
+#endif
+#endif
+#ifndef NO__1cairo_1surface_1get_1content
+#ifndef JNI64
+	{(char *)"_cairo_surface_get_content", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1surface_1get_1content)},
+#else
+	{(char *)"_cairo_surface_get_content", (char *)"(J)I", (void *)Cairo_NATIVE(_1cairo_1surface_1get_1content)},
+#endif
+#endif
+#ifndef NO__1cairo_1surface_1get_1type
+#ifndef JNI64
+	{(char *)"_cairo_surface_get_type", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1surface_1get_1type)},
+#else
+	{(char *)"_cairo_surface_get_type", (char *)"(J)I", (void *)Cairo_NATIVE(_1cairo_1surface_1get_1type)},
+#endif
+#endif
+#ifndef NO__1cairo_1surface_1get_1user_1data
+#ifndef JNI64
+	{(char *)"_cairo_surface_get_user_data", (char *)"(II)I", (void *)Cairo_NATIVE(_1cairo_1surface_1get_1user_1data)},
+#else
+	{(char *)"_cairo_surface_get_user_data", (char *)"(JJ)J", (void *)Cairo_NATIVE(_1cairo_1surface_1get_1user_1data)},
+#endif
+#endif
+#ifndef NO__1cairo_1surface_1mark_1dirty
+#ifndef JNI64
+	{(char *)"_cairo_surface_mark_dirty", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1surface_1mark_1dirty)},
+#else
+	{(char *)"_cairo_surface_mark_dirty", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1surface_1mark_1dirty)},
+#endif
+#endif
+#ifndef NO__1cairo_1surface_1reference
+#ifndef JNI64
+	{(char *)"_cairo_surface_reference", (char *)"(I)V", (void *)Cairo_NATIVE(_1cairo_1surface_1reference)},
+#else
+	{(char *)"_cairo_surface_reference", (char *)"(J)V", (void *)Cairo_NATIVE(_1cairo_1surface_1reference)},
+#endif
+#endif
+#ifndef NO__1cairo_1surface_1set_1device_1offset
+#ifndef JNI64
+	{(char *)"_cairo_surface_set_device_offset", (char *)"(IDD)V", (void *)Cairo_NATIVE(_1cairo_1surface_1set_1device_1offset)},
+#else
+	{(char *)"_cairo_surface_set_device_offset", (char *)"(JDD)V", (void *)Cairo_NATIVE(_1cairo_1surface_1set_1device_1offset)},
+#endif
+#endif
+#ifndef NO__1cairo_1transform
+#ifndef JNI64
+	{(char *)"_cairo_transform", (char *)"(I[D)V", (void *)Cairo_NATIVE(_1cairo_1transform)},
+#else
+	{(char *)"_cairo_transform", (char *)"(J[D)V", (void *)Cairo_NATIVE(_1cairo_1transform)},
+#endif
+#endif
+#ifndef NO__1cairo_1translate
+#ifndef JNI64
+	{(char *)"_cairo_translate", (char *)"(IDD)V", (void *)Cairo_NATIVE(_1cairo_1translate)},
+#else
+	{(char *)"_cairo_translate", (char *)"(JDD)V", (void *)Cairo_NATIVE(_1cairo_1translate)},
+#endif
+#endif
+#ifndef NO__1cairo_1user_1to_1device_1distance
+#ifndef JNI64
+	{(char *)"_cairo_user_to_device_distance", (char *)"(I[D[D)V", (void *)Cairo_NATIVE(_1cairo_1user_1to_1device_1distance)},
+#else
+	{(char *)"_cairo_user_to_device_distance", (char *)"(J[D[D)V", (void *)Cairo_NATIVE(_1cairo_1user_1to_1device_1distance)},
+#endif
+#endif
+#ifndef NO__1cairo_1xlib_1surface_1create
+#ifndef JNI64
+	{(char *)"_cairo_xlib_surface_create", (char *)"(IIIII)I", (void *)Cairo_NATIVE(_1cairo_1xlib_1surface_1create)},
+#else
+	{(char *)"_cairo_xlib_surface_create", (char *)"(JJJII)J", (void *)Cairo_NATIVE(_1cairo_1xlib_1surface_1create)},
+#endif
+#endif
+#ifndef NO__1cairo_1xlib_1surface_1get_1height
+#ifndef JNI64
+	{(char *)"_cairo_xlib_surface_get_height", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1xlib_1surface_1get_1height)},
+#else
+	{(char *)"_cairo_xlib_surface_get_height", (char *)"(J)I", (void *)Cairo_NATIVE(_1cairo_1xlib_1surface_1get_1height)},
+#endif
+#endif
+#ifndef NO__1cairo_1xlib_1surface_1get_1width
+#ifndef JNI64
+	{(char *)"_cairo_xlib_surface_get_width", (char *)"(I)I", (void *)Cairo_NATIVE(_1cairo_1xlib_1surface_1get_1width)},
+#else
+	{(char *)"_cairo_xlib_surface_get_width", (char *)"(J)I", (void *)Cairo_NATIVE(_1cairo_1xlib_1surface_1get_1width)},
+#endif
+#endif
+#ifndef NO_cairo_1path_1data_1t_1sizeof
+	{(char *)"cairo_path_data_t_sizeof", (char *)"()I", (void *)Cairo_NATIVE(cairo_1path_1data_1t_1sizeof)},
+#endif
+#ifndef NO_cairo_1path_1t_1sizeof
+	{(char *)"cairo_path_t_sizeof", (char *)"()I", (void *)Cairo_NATIVE(cairo_1path_1t_1sizeof)},
+#endif
+#ifndef NO_cairo_1version
+	{(char *)"cairo_version", (char *)"()I", (void *)Cairo_NATIVE(cairo_1version)},
+#endif
+#if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1data_1t_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1data_1t_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cairo/cairo_path_data_t;II)V", (void *)Cairo_NATIVE(memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1data_1t_2II)},
+#else
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cairo/cairo_path_data_t;JJ)V", (void *)Cairo_NATIVE(memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1data_1t_2JJ)},
+#endif
+#endif
+#if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1t_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1t_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cairo/cairo_path_t;II)V", (void *)Cairo_NATIVE(memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1t_2II)},
+#else
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cairo/cairo_path_t;JJ)V", (void *)Cairo_NATIVE(memmove__Lorg_eclipse_swt_internal_cairo_cairo_1path_1t_2JJ)},
+#endif
+#endif
+#if (!defined(NO_memmove___3DII) && !defined(JNI64)) || (!defined(NO_memmove___3DJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"([DII)V", (void *)Cairo_NATIVE(memmove___3DII)},
+#else
+	{(char *)"memmove", (char *)"([DJJ)V", (void *)Cairo_NATIVE(memmove___3DJJ)},
+#endif
+#endif
+	{NULL, NULL, NULL}
+};
+JNIEXPORT SWT_NATIVE_CLASS Cairo_nativeClasses[] = {
+	{"org/eclipse/swt/internal/cairo/Cairo", Cairo_nativeMethods},
+	{NULL, NULL}
+};
+#endif
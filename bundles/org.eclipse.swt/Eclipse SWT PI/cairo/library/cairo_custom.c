@@ -0,0 +1,881 @@
+/* ***** BEGIN LICENSE BLOCK *****
+ * Version: MPL 1.1
+ *
+ * The contents of this file are subject to the Mozilla Public License Version
+ * 1.1 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS" basis,
+ * WITHOUT WARRANTY OF ANY KIND, either express or implied. See the License
+ * for the specific language governing rights and limitations under the
+ * License.
+ *
+ * Contributor(s):
+ *
+ * IBM
+ * -  Binding to permit interfacing between Cairo and SWT
+ * -  Copyright (C) 2005, 2014 IBM Corp.  All Rights Reserved.
+ *
+ * ***** END LICENSE BLOCK ***** */
+
+#include "swt.h"
+#include "cairo_structs.h"
+#include "cairo_stats.h"
+#include <math.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SWT_CAIRO_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifndef Cairo_NATIVE
+#define Cairo_NATIVE(func) Java_org_eclipse_swt_internal_cairo_Cairo_##func
+#endif
+
+#ifndef NO__1cairo_1append_1path_1data
+/* The segment types of PathData, as defined in SWT.java */
+#define PATH_MOVE_TO 1
+#define PATH_LINE_TO 2
+#define PATH_QUAD_TO 3
+#define PATH_CUBIC_TO 4
+#define PATH_CLOSE 5
+
+/*
+* Adds the segments of a PathData to the current path of cr the way
+* the Path methods with the same names do, including the implicit
+* move to the current point before the first segment of a subpath.
+* state holds the moved and closed flags of the Path and is updated.
+* Returns false without changing the path if a type is not valid or
+* there are not enough points.
+*/
+JNIEXPORT jboolean JNICALL Cairo_NATIVE(_1cairo_1append_1path_1data)
+	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jfloatArray arg2, jintArray arg3)
+{
+	cairo_t *cr = (cairo_t *)arg0;
+	jbyte *types = NULL;
+	jfloat *points = NULL;
+	jint *state = NULL;
+	jint count, i, j, needed = 0;
+	jboolean moved, closed, rc = 0;
+	Cairo_NATIVE_ENTER(env, that, _1cairo_1append_1path_1data_FUNC);
+	if (arg0 == 0 || arg1 == NULL || arg2 == NULL || arg3 == NULL) goto fail;
+	if ((*env)->GetArrayLength(env, arg3) < 2) goto fail;
+	count = (*env)->GetArrayLength(env, arg1);
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if ((types = (*env)->GetPrimitiveArrayCritical(env, arg1, NULL)) == NULL) goto fail;
+		if ((points = (*env)->GetPrimitiveArrayCritical(env, arg2, NULL)) == NULL) goto fail;
+		if ((state = (*env)->GetPrimitiveArrayCritical(env, arg3, NULL)) == NULL) goto fail;
+	} else
+#endif
+	{
+		if ((types = (*env)->GetByteArrayElements(env, arg1, NULL)) == NULL) goto fail;
+		if ((points = (*env)->GetFloatArrayElements(env, arg2, NULL)) == NULL) goto fail;
+		if ((state = (*env)->GetIntArrayElements(env, arg3, NULL)) == NULL) goto fail;
+	}
+	for (i = 0; i < count; i++) {
+		switch (types[i]) {
+			case PATH_MOVE_TO:
+			case PATH_LINE_TO: needed += 2; break;
+			case PATH_QUAD_TO: needed += 4; break;
+			case PATH_CUBIC_TO: needed += 6; break;
+			case PATH_CLOSE: break;
+			default: goto fail;
+		}
+	}
+	if (needed > (*env)->GetArrayLength(env, arg2)) goto fail;
+	moved = state[0] != 0;
+	closed = state[1] != 0;
+	for (i = 0, j = 0; i < count; i++) {
+		double currentX, currentY;
+		switch (types[i]) {
+			case PATH_MOVE_TO:
+				cairo_move_to(cr, points[j], points[j + 1]);
+				j += 2;
+				moved = closed = 1;
+				break;
+			case PATH_LINE_TO:
+			case PATH_CUBIC_TO:
+				if (!moved) {
+					cairo_get_current_point(cr, &currentX, &currentY);
+					cairo_move_to(cr, currentX, currentY);
+					moved = 1;
+				}
+				if (types[i] == PATH_LINE_TO) {
+					cairo_line_to(cr, points[j], points[j + 1]);
+					j += 2;
+				} else {
+					cairo_curve_to(cr, points[j], points[j + 1], points[j + 2], points[j + 3], points[j + 4], points[j + 5]);
+					j += 6;
+				}
+				closed = 0;
+				break;
+			case PATH_QUAD_TO: {
+				float x0, y0, cx1, cy1, cx2, cy2;
+				jfloat *p = points + j;
+				cairo_get_current_point(cr, &currentX, &currentY);
+				if (!moved) {
+					cairo_move_to(cr, currentX, currentY);
+					moved = 1;
+				}
+				/* Convert to a cubic curve with the arithmetic of Path.quadTo() */
+				x0 = (float)currentX;
+				y0 = (float)currentY;
+				cx1 = x0 + 2 * (p[0] - x0) / 3;
+				cy1 = y0 + 2 * (p[1] - y0) / 3;
+				cx2 = cx1 + (p[2] - x0) / 3;
+				cy2 = cy1 + (p[3] - y0) / 3;
+				cairo_curve_to(cr, cx1, cy1, cx2, cy2, p[2], p[3]);
+				j += 4;
+				closed = 0;
+				break;
+			}
+			case PATH_CLOSE:
+				cairo_close_path(cr);
+				moved = 0;
+				closed = 1;
+				break;
+		}
+	}
+	state[0] = moved;
+	state[1] = closed;
+	rc = 1;
+fail:
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (state) (*env)->ReleasePrimitiveArrayCritical(env, arg3, state, 0);
+		if (points) (*env)->ReleasePrimitiveArrayCritical(env, arg2, points, JNI_ABORT);
+		if (types) (*env)->ReleasePrimitiveArrayCritical(env, arg1, types, JNI_ABORT);
+	} else
+#endif
+	{
+		if (state) (*env)->ReleaseIntArrayElements(env, arg3, state, 0);
+		if (points) (*env)->ReleaseFloatArrayElements(env, arg2, points, JNI_ABORT);
+		if (types) (*env)->ReleaseByteArrayElements(env, arg1, types, JNI_ABORT);
+	}
+	Cairo_NATIVE_EXIT(env, that, _1cairo_1append_1path_1data_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1cairo_1path_1buffer
+/*
+* Returns a direct buffer over the cairo_path_data_t array of a path
+* returned by cairo_copy_path() or cairo_copy_path_flat(), or NULL if
+* the path is empty or could not be copied.  The buffer is only valid
+* until the path is destroyed.
+*/
+JNIEXPORT jobject JNICALL Cairo_NATIVE(_1cairo_1path_1buffer)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	cairo_path_t *path = (cairo_path_t *)arg0;
+	jobject rc = NULL;
+	Cairo_NATIVE_ENTER(env, that, _1cairo_1path_1buffer_FUNC);
+	if (path != NULL && path->status == CAIRO_STATUS_SUCCESS && path->data != NULL && path->num_data > 0) {
+		rc = (*env)->NewDirectByteBuffer(env, path->data, (jlong)path->num_data * sizeof(cairo_path_data_t));
+	}
+	Cairo_NATIVE_EXIT(env, that, _1cairo_1path_1buffer_FUNC);
+	return rc;
+}
+#endif
+
+#if !defined(NO__1swt_1cairo_1image_1surface_1buffer) || !defined(NO__1swt_1cairo_1copy_1area)
+/* cairo_surface_get_type() and the image surface getters are loaded dynamically */
+static int swt_cairo_surface_is_image(cairo_surface_t *surface)
+{
+	Cairo_LOAD_FUNCTION(fp, cairo_surface_get_type)
+	if (!fp) return 0;
+	return ((cairo_surface_type_t (CALLING_CONVENTION*)(cairo_surface_t *))fp)(surface) == CAIRO_SURFACE_TYPE_IMAGE;
+}
+
+static unsigned char *swt_cairo_image_surface_get_data(cairo_surface_t *surface)
+{
+	Cairo_LOAD_FUNCTION(fp, cairo_image_surface_get_data)
+	if (!fp) return NULL;
+	return ((unsigned char *(CALLING_CONVENTION*)(cairo_surface_t *))fp)(surface);
+}
+
+static int swt_cairo_image_surface_get_stride(cairo_surface_t *surface)
+{
+	Cairo_LOAD_FUNCTION(fp, cairo_image_surface_get_stride)
+	if (!fp) return 0;
+	return ((int (CALLING_CONVENTION*)(cairo_surface_t *))fp)(surface);
+}
+#endif
+
+#ifndef NO__1swt_1cairo_1image_1surface_1buffer
+/*
+* Flushes an image surface and returns a direct buffer over its pixels,
+* stride bytes per row, or NULL if the surface is not an image surface.
+* Callers that change the pixels must call cairo_surface_mark_dirty()
+* when they are done.
+*/
+JNIEXPORT jobject JNICALL Cairo_NATIVE(_1swt_1cairo_1image_1surface_1buffer)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	cairo_surface_t *surface = (cairo_surface_t *)arg0;
+	jobject rc = NULL;
+	Cairo_NATIVE_ENTER(env, that, _1swt_1cairo_1image_1surface_1buffer_FUNC);
+	if (surface != NULL && cairo_surface_status(surface) == CAIRO_STATUS_SUCCESS && swt_cairo_surface_is_image(surface)) {
+		unsigned char *data;
+		jlong size;
+		cairo_surface_flush(surface);
+		data = swt_cairo_image_surface_get_data(surface);
+		size = (jlong)swt_cairo_image_surface_get_stride(surface) * cairo_image_surface_get_height(surface);
+		if (data != NULL && size > 0) {
+			rc = (*env)->NewDirectByteBuffer(env, data, size);
+		}
+	}
+	Cairo_NATIVE_EXIT(env, that, _1swt_1cairo_1image_1surface_1buffer_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_SwtSurfacePool
+/*
+* A small pool of image surfaces for drawing that only lives for the
+* duration of a call.  Surfaces are kept by format and size, so that
+* a surface is only reused for a request of exactly the same size, and
+* are cleared when they are checked out again.  The oldest surface is
+* dropped when the pool is full.  The pool is only used with the lock
+* of the Cairo class held, so it needs no locking of its own.
+*/
+#define SWT_SURFACE_POOL_SIZE 8
+#define SWT_SURFACE_POOL_MAX_BYTES (1024 * 1024)
+
+typedef struct SwtPooledSurface {
+	cairo_surface_t *surface;
+	cairo_format_t format;
+	int width, height;
+} SwtPooledSurface;
+
+static SwtPooledSurface swt_surface_pool[SWT_SURFACE_POOL_SIZE];
+static int swt_surface_pool_count;
+
+static cairo_surface_t *swt_cairo_surface_checkout(cairo_format_t format, int width, int height)
+{
+	int i;
+	cairo_t *cr;
+	cairo_surface_t *surface;
+	for (i = swt_surface_pool_count - 1; i >= 0; i--) {
+		SwtPooledSurface *entry = &swt_surface_pool[i];
+		if (entry->format == format && entry->width == width && entry->height == height) {
+			surface = entry->surface;
+			memmove(entry, entry + 1, (swt_surface_pool_count - i - 1) * sizeof(SwtPooledSurface));
+			swt_surface_pool_count--;
+			cr = cairo_create(surface);
+			cairo_set_operator(cr, CAIRO_OPERATOR_CLEAR);
+			cairo_paint(cr);
+			cairo_destroy(cr);
+			return surface;
+		}
+	}
+	return cairo_image_surface_create(format, width, height);
+}
+
+static void swt_cairo_surface_return(cairo_surface_t *surface, cairo_format_t format, int width, int height)
+{
+	if (surface == NULL) return;
+	if (cairo_surface_status(surface) != CAIRO_STATUS_SUCCESS || (jlong)width * height * 4 > SWT_SURFACE_POOL_MAX_BYTES) {
+		cairo_surface_destroy(surface);
+		return;
+	}
+	if (swt_surface_pool_count == SWT_SURFACE_POOL_SIZE) {
+		cairo_surface_destroy(swt_surface_pool[0].surface);
+		memmove(swt_surface_pool, swt_surface_pool + 1, (SWT_SURFACE_POOL_SIZE - 1) * sizeof(SwtPooledSurface));
+		swt_surface_pool_count--;
+	}
+	swt_surface_pool[swt_surface_pool_count].surface = surface;
+	swt_surface_pool[swt_surface_pool_count].format = format;
+	swt_surface_pool[swt_surface_pool_count].width = width;
+	swt_surface_pool[swt_surface_pool_count].height = height;
+	swt_surface_pool_count++;
+}
+#endif
+
+#ifndef NO__1swt_1cairo_1region_1get_1rectangles
+/* The layout of cairo_rectangle_int_t, which needs cairo 1.10 headers */
+typedef struct SwtRectangleInt {
+	int x, y, width, height;
+} SwtRectangleInt;
+
+static int swt_cairo_region_num_rectangles(void *region)
+{
+	Cairo_LOAD_FUNCTION(fp, cairo_region_num_rectangles)
+	if (!fp) return 0;
+	return ((int (CALLING_CONVENTION*)(void *))fp)(region);
+}
+
+static void swt_cairo_region_get_rectangle(void *region, int nth, SwtRectangleInt *rectangle)
+{
+	Cairo_LOAD_FUNCTION(fp, cairo_region_get_rectangle)
+	if (fp) {
+		((void (CALLING_CONVENTION*)(void *, int, SwtRectangleInt *))fp)(region, nth, rectangle);
+	}
+}
+
+/*
+* Returns the rectangles of a cairo_region_t as x, y, width and height
+* quadruples, or NULL if the region functions are not available.
+*/
+JNIEXPORT jintArray JNICALL Cairo_NATIVE(_1swt_1cairo_1region_1get_1rectangles)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	jintArray rc = NULL;
+	jint *rects = NULL;
+	int count, i;
+	Cairo_NATIVE_ENTER(env, that, _1swt_1cairo_1region_1get_1rectangles_FUNC);
+	if (arg0 == 0) goto fail;
+	count = swt_cairo_region_num_rectangles((void *)arg0);
+	if (count < 0) goto fail;
+	rc = (*env)->NewIntArray(env, count * 4);
+	if (rc == NULL || count == 0) goto fail;
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		rects = (*env)->GetPrimitiveArrayCritical(env, rc, NULL);
+	} else
+#endif
+	{
+		rects = (*env)->GetIntArrayElements(env, rc, NULL);
+	}
+	if (rects == NULL) goto fail;
+	for (i = 0; i < count; i++) {
+		swt_cairo_region_get_rectangle((void *)arg0, i, (SwtRectangleInt *)(rects + i * 4));
+	}
+fail:
+	if (rects != NULL) {
+#ifdef JNI_VERSION_1_2
+		if (IS_JNI_1_2) {
+			(*env)->ReleasePrimitiveArrayCritical(env, rc, rects, 0);
+		} else
+#endif
+		{
+			(*env)->ReleaseIntArrayElements(env, rc, rects, 0);
+		}
+	}
+	Cairo_NATIVE_EXIT(env, that, _1swt_1cairo_1region_1get_1rectangles_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1swt_1cairo_1surface_1checkout
+JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1swt_1cairo_1surface_1checkout)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
+{
+	jintLong rc = 0;
+	Cairo_NATIVE_ENTER(env, that, _1swt_1cairo_1surface_1checkout_FUNC);
+	rc = (jintLong)swt_cairo_surface_checkout((cairo_format_t)arg0, arg1, arg2);
+	Cairo_NATIVE_EXIT(env, that, _1swt_1cairo_1surface_1checkout_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1swt_1cairo_1surface_1pool_1clear
+JNIEXPORT void JNICALL Cairo_NATIVE(_1swt_1cairo_1surface_1pool_1clear)
+	(JNIEnv *env, jclass that)
+{
+	Cairo_NATIVE_ENTER(env, that, _1swt_1cairo_1surface_1pool_1clear_FUNC);
+	while (swt_surface_pool_count > 0) {
+		cairo_surface_destroy(swt_surface_pool[--swt_surface_pool_count].surface);
+	}
+	Cairo_NATIVE_EXIT(env, that, _1swt_1cairo_1surface_1pool_1clear_FUNC);
+}
+#endif
+
+#ifndef NO__1swt_1cairo_1surface_1return
+JNIEXPORT void JNICALL Cairo_NATIVE(_1swt_1cairo_1surface_1return)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3)
+{
+	Cairo_NATIVE_ENTER(env, that, _1swt_1cairo_1surface_1return_FUNC);
+	swt_cairo_surface_return((cairo_surface_t *)arg0, (cairo_format_t)arg1, arg2, arg3);
+	Cairo_NATIVE_EXIT(env, that, _1swt_1cairo_1surface_1return_FUNC);
+}
+#endif
+
+#ifndef NO_SwtPatternCache
+/*
+* A small cache of linear gradient patterns, so that gradients that are
+* filled again on every paint with the same colors are only built once.
+* Patterns are kept by their end points, extend and color stops, and a
+* new reference is returned for every request, so callers destroy them
+* as usual.  A cached pattern must not be changed.  The least recently
+* used pattern is dropped when the cache is full.  The cache is only used
+* with the lock of the Cairo class held, so it needs no locking of its own.
+*/
+#define SWT_PATTERN_CACHE_SIZE 16
+#define SWT_PATTERN_CACHE_MAX_STOPS 4
+
+typedef struct SwtCachedPattern {
+	cairo_pattern_t *pattern;
+	double points[4];
+	cairo_extend_t extend;
+	int count;
+	double stops[SWT_PATTERN_CACHE_MAX_STOPS * 5];
+} SwtCachedPattern;
+
+static SwtCachedPattern swt_pattern_cache[SWT_PATTERN_CACHE_SIZE];
+static int swt_pattern_cache_count;
+
+static cairo_pattern_t *swt_cairo_pattern_create_linear(double *points, cairo_extend_t extend, jdouble *stops, int count)
+{
+	int i;
+	cairo_pattern_t *pattern = cairo_pattern_create_linear(points[0], points[1], points[2], points[3]);
+	for (i = 0; i < count; i++) {
+		jdouble *stop = stops + i * 5;
+		cairo_pattern_add_color_stop_rgba(pattern, stop[0], stop[1], stop[2], stop[3], stop[4]);
+	}
+	cairo_pattern_set_extend(pattern, extend);
+	return pattern;
+}
+
+static cairo_pattern_t *swt_cairo_pattern_lookup_linear(double *points, cairo_extend_t extend, jdouble *stops, int count)
+{
+	int i;
+	SwtCachedPattern entry;
+	cairo_pattern_t *pattern;
+	if (count > SWT_PATTERN_CACHE_MAX_STOPS) {
+		return swt_cairo_pattern_create_linear(points, extend, stops, count);
+	}
+	for (i = swt_pattern_cache_count - 1; i >= 0; i--) {
+		SwtCachedPattern *cached = &swt_pattern_cache[i];
+		if (cached->extend == extend && cached->count == count
+			&& memcmp(cached->points, points, sizeof(cached->points)) == 0
+			&& memcmp(cached->stops, stops, count * 5 * sizeof(double)) == 0)
+		{
+			entry = *cached;
+			memmove(cached, cached + 1, (swt_pattern_cache_count - i - 1) * sizeof(SwtCachedPattern));
+			swt_pattern_cache[swt_pattern_cache_count - 1] = entry;
+			return cairo_pattern_reference(entry.pattern);
+		}
+	}
+	pattern = swt_cairo_pattern_create_linear(points, extend, stops, count);
+	if (cairo_pattern_status(pattern) != CAIRO_STATUS_SUCCESS) return pattern;
+	if (swt_pattern_cache_count == SWT_PATTERN_CACHE_SIZE) {
+		cairo_pattern_destroy(swt_pattern_cache[0].pattern);
+		memmove(swt_pattern_cache, swt_pattern_cache + 1, (SWT_PATTERN_CACHE_SIZE - 1) * sizeof(SwtCachedPattern));
+		swt_pattern_cache_count--;
+	}
+	entry.pattern = cairo_pattern_reference(pattern);
+	memcpy(entry.points, points, sizeof(entry.points));
+	entry.extend = extend;
+	entry.count = count;
+	memcpy(entry.stops, stops, count * 5 * sizeof(double));
+	swt_pattern_cache[swt_pattern_cache_count++] = entry;
+	return pattern;
+}
+#endif
+
+#ifndef NO__1swt_1cairo_1pattern_1cache_1clear
+JNIEXPORT void JNICALL Cairo_NATIVE(_1swt_1cairo_1pattern_1cache_1clear)
+	(JNIEnv *env, jclass that)
+{
+	Cairo_NATIVE_ENTER(env, that, _1swt_1cairo_1pattern_1cache_1clear_FUNC);
+	while (swt_pattern_cache_count > 0) {
+		cairo_pattern_destroy(swt_pattern_cache[--swt_pattern_cache_count].pattern);
+	}
+	Cairo_NATIVE_EXIT(env, that, _1swt_1cairo_1pattern_1cache_1clear_FUNC);
+}
+#endif
+
+#ifndef NO__1swt_1cairo_1pattern_1create_1linear_1cached
+/*
+* Returns a reference to a linear gradient pattern with the given end
+* points, extend and color stops, which are offset, red, green, blue and
+* alpha quintuples.  Returns 0 if the stops are not complete.
+*/
+JNIEXPORT jintLong JNICALL Cairo_NATIVE(_1swt_1cairo_1pattern_1create_1linear_1cached)
+	(JNIEnv *env, jclass that, jdouble arg0, jdouble arg1, jdouble arg2, jdouble arg3, jint arg4, jdoubleArray arg5)
+{
+	jdouble *stops = NULL;
+	double points[4];
+	jint length;
+	jintLong rc = 0;
+	Cairo_NATIVE_ENTER(env, that, _1swt_1cairo_1pattern_1create_1linear_1cached_FUNC);
+	if (arg5 == NULL) goto fail;
+	length = (*env)->GetArrayLength(env, arg5);
+	if (length == 0 || length % 5 != 0) goto fail;
+	if ((stops = (*env)->GetDoubleArrayElements(env, arg5, NULL)) == NULL) goto fail;
+	points[0] = arg0;
+	points[1] = arg1;
+	points[2] = arg2;
+	points[3] = arg3;
+	rc = (jintLong)swt_cairo_pattern_lookup_linear(points, (cairo_extend_t)arg4, stops, length / 5);
+fail:
+	if (stops != NULL) (*env)->ReleaseDoubleArrayElements(env, arg5, stops, JNI_ABORT);
+	Cairo_NATIVE_EXIT(env, that, _1swt_1cairo_1pattern_1create_1linear_1cached_FUNC);
+	return rc;
+}
+#endif
+
+#if !defined(NO__1swt_1cairo_1paths_1contain) || !defined(NO__1swt_1cairo_1path_1contains_1points)
+/*
+* Returns whether the point is in the path of the context path, which
+* must be a path object whose user space has no transformation.  The
+* path is tested with the transformation, fill rule and line attributes
+* of cr, the way Path.contains() does.  When prefilter is set, points that
+* are outside of the extents of the path, grown by how far the stroke can
+* reach, are rejected without copying the path.  extents caches the grown
+* extents of the path between calls and starts out empty.
+*/
+static jboolean swt_cairo_path_extents(cairo_t *path, double *extents)
+{
+	Cairo_LOAD_FUNCTION(fp, cairo_path_extents)
+	if (!fp) return 0;
+	((void (CALLING_CONVENTION*)(cairo_t *, double *, double *, double *, double *))fp)(path, &extents[0], &extents[1], &extents[2], &extents[3]);
+	return 1;
+}
+
+static jboolean swt_cairo_path_contains(cairo_t *cr, cairo_t *path, double x, double y, jboolean outline, jboolean prefilter, double *extents)
+{
+	jboolean rc;
+	cairo_path_t *copy;
+	if (prefilter) {
+		if (extents[0] > extents[2]) {
+			double grow = 0;
+			if (!swt_cairo_path_extents(path, extents)) {
+				extents[0] = extents[1] = -HUGE_VAL;
+				extents[2] = extents[3] = HUGE_VAL;
+			}
+			if (outline) {
+				grow = cairo_get_line_join(cr) == CAIRO_LINE_JOIN_MITER ? cairo_get_miter_limit(cr) : 1;
+				if (grow < 1.5) grow = 1.5;
+				grow *= cairo_get_line_width(cr) / 2;
+			}
+			extents[0] -= grow;
+			extents[1] -= grow;
+			extents[2] += grow;
+			extents[3] += grow;
+		}
+		if (x < extents[0] || y < extents[1] || x > extents[2] || y > extents[3]) return 0;
+	}
+	copy = cairo_copy_path(path);
+	if (copy == NULL) return 0;
+	cairo_append_path(cr, copy);
+	cairo_path_destroy(copy);
+	rc = (jboolean)(outline ? cairo_in_stroke(cr, x, y) : cairo_in_fill(cr, x, y));
+	cairo_new_path(cr);
+	return rc;
+}
+#endif
+
+#ifndef NO__1swt_1cairo_1path_1contains_1points
+/*
+* Tests x, y pairs against one path and sets bit i of mask for each
+* point i that is contained.  Returns false if the arrays are too short.
+*/
+JNIEXPORT jboolean JNICALL Cairo_NATIVE(_1swt_1cairo_1path_1contains_1points)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdoubleArray arg2, jboolean arg3, jboolean arg4, jintArray arg5)
+{
+	jdouble *points = NULL;
+	jint *mask = NULL;
+	jint count, i;
+	jboolean rc = 0;
+	double extents[4] = {1, 1, 0, 0};
+	Cairo_NATIVE_ENTER(env, that, _1swt_1cairo_1path_1contains_1points_FUNC);
+	if (arg0 == 0 || arg1 == 0 || arg2 == NULL || arg5 == NULL) goto fail;
+	count = (*env)->GetArrayLength(env, arg2) / 2;
+	if ((*env)->GetArrayLength(env, arg5) < (count + 31) / 32) goto fail;
+	if ((points = (*env)->GetDoubleArrayElements(env, arg2, NULL)) == NULL) goto fail;
+	if ((mask = (*env)->GetIntArrayElements(env, arg5, NULL)) == NULL) goto fail;
+	memset(mask, 0, ((count + 31) / 32) * sizeof(jint));
+	for (i = 0; i < count; i++) {
+		if (swt_cairo_path_contains((cairo_t *)arg0, (cairo_t *)arg1, points[i * 2], points[i * 2 + 1], arg3, arg4, extents)) {
+			mask[i >> 5] |= 1 << (i & 31);
+		}
+	}
+	rc = 1;
+fail:
+	if (mask != NULL) (*env)->ReleaseIntArrayElements(env, arg5, mask, 0);
+	if (points != NULL) (*env)->ReleaseDoubleArrayElements(env, arg2, points, JNI_ABORT);
+	Cairo_NATIVE_EXIT(env, that, _1swt_1cairo_1path_1contains_1points_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1swt_1cairo_1paths_1contain
+/*
+* Tests one point against path objects and sets bit i of mask for each
+* path i that contains it.  Returns false if the mask is too short.
+*/
+JNIEXPORT jboolean JNICALL Cairo_NATIVE(_1swt_1cairo_1paths_1contain)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLongArray arg1, jdouble arg2, jdouble arg3, jboolean arg4, jboolean arg5, jintArray arg6)
+{
+	jintLong *paths = NULL;
+	jint *mask = NULL;
+	jint count, i;
+	jboolean rc = 0;
+	Cairo_NATIVE_ENTER(env, that, _1swt_1cairo_1paths_1contain_FUNC);
+	if (arg0 == 0 || arg1 == NULL || arg6 == NULL) goto fail;
+	count = (*env)->GetArrayLength(env, arg1);
+	if ((*env)->GetArrayLength(env, arg6) < (count + 31) / 32) goto fail;
+	if ((paths = (*env)->GetIntLongArrayElements(env, arg1, NULL)) == NULL) goto fail;
+	if ((mask = (*env)->GetIntArrayElements(env, arg6, NULL)) == NULL) goto fail;
+	memset(mask, 0, ((count + 31) / 32) * sizeof(jint));
+	for (i = 0; i < count; i++) {
+		double extents[4] = {1, 1, 0, 0};
+		if (paths[i] == 0) continue;
+		if (swt_cairo_path_contains((cairo_t *)arg0, (cairo_t *)paths[i], arg2, arg3, arg4, arg5, extents)) {
+			mask[i >> 5] |= 1 << (i & 31);
+		}
+	}
+	rc = 1;
+fail:
+	if (mask != NULL) (*env)->ReleaseIntArrayElements(env, arg6, mask, 0);
+	if (paths != NULL) (*env)->ReleaseIntLongArrayElements(env, arg1, paths, JNI_ABORT);
+	Cairo_NATIVE_EXIT(env, that, _1swt_1cairo_1paths_1contain_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1swt_1cairo_1matrix_1transform_1points
+/*
+* Transforms count x, y pairs of points in place with matrix, computing
+* in double precision like cairo_matrix_transform_point() does.  Returns
+* false if the array is too short.
+*/
+JNIEXPORT jboolean JNICALL Cairo_NATIVE(_1swt_1cairo_1matrix_1transform_1points)
+	(JNIEnv *env, jclass that, jdoubleArray arg0, jfloatArray arg1, jint arg2)
+{
+	jdouble *m = NULL;
+	jfloat *points = NULL;
+	jint i = 0;
+	jboolean rc = 0;
+	Cairo_NATIVE_ENTER(env, that, _1swt_1cairo_1matrix_1transform_1points_FUNC);
+	if (arg0 == NULL || arg1 == NULL || arg2 < 0) goto fail;
+	if ((*env)->GetArrayLength(env, arg0) < 6 || (*env)->GetArrayLength(env, arg1) / 2 < arg2) goto fail;
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if ((m = (*env)->GetPrimitiveArrayCritical(env, arg0, NULL)) == NULL) goto fail;
+		if ((points = (*env)->GetPrimitiveArrayCritical(env, arg1, NULL)) == NULL) goto fail;
+	} else
+#endif
+	{
+		if ((m = (*env)->GetDoubleArrayElements(env, arg0, NULL)) == NULL) goto fail;
+		if ((points = (*env)->GetFloatArrayElements(env, arg1, NULL)) == NULL) goto fail;
+	}
+	/* m holds xx, yx, xy, yy, x0 and y0 */
+#ifdef SWT_CAIRO_SSE2
+	{
+		__m128d col0 = _mm_set_pd(m[1], m[0]);
+		__m128d col1 = _mm_set_pd(m[3], m[2]);
+		__m128d offset = _mm_set_pd(m[5], m[4]);
+		for (; i + 2 <= arg2; i += 2) {
+			__m128 xy = _mm_loadu_ps(points + i * 2);
+			__m128d p0 = _mm_cvtps_pd(xy);
+			__m128d p1 = _mm_cvtps_pd(_mm_movehl_ps(xy, xy));
+			__m128d r0 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(_mm_unpacklo_pd(p0, p0), col0), _mm_mul_pd(_mm_unpackhi_pd(p0, p0), col1)), offset);
+			__m128d r1 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(_mm_unpacklo_pd(p1, p1), col0), _mm_mul_pd(_mm_unpackhi_pd(p1, p1), col1)), offset);
+			_mm_storeu_ps(points + i * 2, _mm_movelh_ps(_mm_cvtpd_ps(r0), _mm_cvtpd_ps(r1)));
+		}
+	}
+#endif
+	for (; i < arg2; i++) {
+		double x = points[i * 2], y = points[i * 2 + 1];
+		points[i * 2] = (jfloat)(m[0] * x + m[2] * y + m[4]);
+		points[i * 2 + 1] = (jfloat)(m[1] * x + m[3] * y + m[5]);
+	}
+	rc = 1;
+fail:
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (points != NULL) (*env)->ReleasePrimitiveArrayCritical(env, arg1, points, 0);
+		if (m != NULL) (*env)->ReleasePrimitiveArrayCritical(env, arg0, m, JNI_ABORT);
+	} else
+#endif
+	{
+		if (points != NULL) (*env)->ReleaseFloatArrayElements(env, arg1, points, 0);
+		if (m != NULL) (*env)->ReleaseDoubleArrayElements(env, arg0, m, JNI_ABORT);
+	}
+	Cairo_NATIVE_EXIT(env, that, _1swt_1cairo_1matrix_1transform_1points_FUNC);
+	return rc;
+}
+#endif
+
+#if !defined(NO__1swt_1cairo_1set_1line_1width) || !defined(NO__1swt_1cairo_1set_1source_1rgba)
+/*
+* The setters below compare the value with the state cairo already keeps
+* for the context and skip the call when it has not changed.  Skipped
+* calls are counted in the native stats as _1swt_1cairo_1elided_1calls.
+*/
+#define SWT_CAIRO_ELIDED(env, that) \
+	Cairo_NATIVE_ENTER(env, that, _1swt_1cairo_1elided_1calls_FUNC); \
+	Cairo_NATIVE_EXIT(env, that, _1swt_1cairo_1elided_1calls_FUNC);
+#endif
+
+#ifndef NO__1swt_1cairo_1set_1line_1width
+/*
+* Sets the line width of cr unless it already has it.  Returns whether
+* the line width was set.
+*/
+JNIEXPORT jboolean JNICALL Cairo_NATIVE(_1swt_1cairo_1set_1line_1width)
+	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1)
+{
+	jboolean rc = 0;
+	Cairo_NATIVE_ENTER(env, that, _1swt_1cairo_1set_1line_1width_FUNC);
+	if (cairo_get_line_width((cairo_t *)arg0) == arg1) {
+		SWT_CAIRO_ELIDED(env, that)
+	} else {
+		cairo_set_line_width((cairo_t *)arg0, arg1);
+		rc = 1;
+	}
+	Cairo_NATIVE_EXIT(env, that, _1swt_1cairo_1set_1line_1width_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1swt_1cairo_1set_1source_1rgba
+/*
+* Sets the source of cr to a solid color unless the source already is
+* a solid pattern of that color.  Setting the source creates a new
+* pattern, so this also keeps the pattern of the context alive across
+* redundant calls.  cairo_pattern_get_rgba() needs cairo 1.4, with
+* older versions the source is always set.  Returns whether the source
+* was set.
+*/
+JNIEXPORT jboolean JNICALL Cairo_NATIVE(_1swt_1cairo_1set_1source_1rgba)
+	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jdouble arg2, jdouble arg3, jdouble arg4)
+{
+	cairo_t *cr = (cairo_t *)arg0;
+	double red, green, blue, alpha;
+	jboolean rc = 1;
+	Cairo_NATIVE_ENTER(env, that, _1swt_1cairo_1set_1source_1rgba_FUNC);
+	{
+		Cairo_LOAD_FUNCTION(fp, cairo_pattern_get_rgba)
+		if (fp) {
+			cairo_status_t status = ((cairo_status_t (CALLING_CONVENTION*)(cairo_pattern_t *, double *, double *, double *, double *))fp)(cairo_get_source(cr), &red, &green, &blue, &alpha);
+			if (status == CAIRO_STATUS_SUCCESS && red == arg1 && green == arg2 && blue == arg3 && alpha == arg4) {
+				rc = 0;
+			}
+		}
+	}
+	if (rc) {
+		cairo_set_source_rgba(cr, arg1, arg2, arg3, arg4);
+	} else {
+		SWT_CAIRO_ELIDED(env, that)
+	}
+	Cairo_NATIVE_EXIT(env, that, _1swt_1cairo_1set_1source_1rgba_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1swt_1cairo_1copy_1area
+static cairo_format_t swt_cairo_image_surface_get_format(cairo_surface_t *surface)
+{
+	Cairo_LOAD_FUNCTION(fp, cairo_image_surface_get_format)
+	if (!fp) return CAIRO_FORMAT_A1;
+	return ((cairo_format_t (CALLING_CONVENTION*)(cairo_surface_t *))fp)(surface);
+}
+
+/*
+* Returns the clip of cr in user space, within the width by height bounds
+* of its surface, as a single rectangle in rect, or false if the clip is
+* not a single rectangle or cannot be queried.  The clip is intersected
+* with the bounds first, since from cairo 1.12 a context without a clip
+* has no rectangle list.  A clip that excludes everything is returned as
+* an empty rectangle.
+*/
+static jboolean swt_cairo_clip_rectangle(cairo_t *cr, int width, int height, cairo_rectangle_t *rect)
+{
+	cairo_rectangle_list_t *list;
+	double x = 0, y = 0;
+	jboolean rc = 0;
+	Cairo_LOAD_FUNCTION(fp, cairo_copy_clip_rectangle_list)
+	if (!fp) return 0;
+	cairo_save(cr);
+	cairo_device_to_user(cr, &x, &y);
+	cairo_new_path(cr);
+	cairo_rectangle(cr, x, y, width, height);
+	cairo_clip(cr);
+	list = ((cairo_rectangle_list_t *(CALLING_CONVENTION*)(cairo_t *))fp)(cr);
+	cairo_restore(cr);
+	if (list->status == CAIRO_STATUS_SUCCESS && list->num_rectangles <= 1) {
+		if (list->num_rectangles == 1) {
+			*rect = list->rectangles[0];
+		} else {
+			rect->x = rect->y = rect->width = rect->height = 0;
+		}
+		rc = 1;
+	}
+	{
+		Cairo_LOAD_FUNCTION(fp, cairo_rectangle_list_destroy)
+		if (fp) ((void (CALLING_CONVENTION*)(cairo_rectangle_list_t *))fp)(list);
+	}
+	return rc;
+}
+
+/*
+* Moves the pixels of a rectangle of the image surface cr draws to, the
+* way GC.copyArea() does by painting the surface onto itself with
+* CAIRO_OPERATOR_SOURCE, but in place and without the snapshot of the
+* whole surface cairo takes for a self copy.  This only applies when the
+* transformation of cr is an integer translation, the clip is a single
+* rectangle and every copied pixel comes from inside the surface.
+* Returns false without changing the surface otherwise.
+*/
+JNIEXPORT jboolean JNICALL Cairo_NATIVE(_1swt_1cairo_1copy_1area)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6)
+{
+	cairo_t *cr = (cairo_t *)arg0;
+	cairo_surface_t *surface;
+	cairo_matrix_t matrix;
+	cairo_rectangle_t clip;
+	jboolean rc = 0;
+	Cairo_NATIVE_ENTER(env, that, _1swt_1cairo_1copy_1area_FUNC);
+	surface = cairo_get_target(cr);
+	cairo_get_matrix(cr, &matrix);
+	if (cairo_status(cr) == CAIRO_STATUS_SUCCESS && swt_cairo_surface_is_image(surface) &&
+		matrix.xx == 1 && matrix.yx == 0 && matrix.xy == 0 && matrix.yy == 1 &&
+		swt_cairo_clip_rectangle(cr, cairo_image_surface_get_width(surface), cairo_image_surface_get_height(surface), &clip))
+	{
+		int bpp = 0;
+		switch (swt_cairo_image_surface_get_format(surface)) {
+			case CAIRO_FORMAT_ARGB32:
+			case CAIRO_FORMAT_RGB24: bpp = 4; break;
+			case CAIRO_FORMAT_A8: bpp = 1; break;
+			default: break;
+		}
+		if (bpp != 0) {
+			double x = 0, y = 0, x0, y0, x1, y1;
+			int deltaX = arg5 - arg1, deltaY = arg6 - arg2;
+			/* The destination clipped in user space, then moved to device space */
+			x0 = arg5 > clip.x ? arg5 : clip.x;
+			y0 = arg6 > clip.y ? arg6 : clip.y;
+			x1 = arg5 + arg3 < clip.x + clip.width ? arg5 + arg3 : clip.x + clip.width;
+			y1 = arg6 + arg4 < clip.y + clip.height ? arg6 + arg4 : clip.y + clip.height;
+			cairo_user_to_device(cr, &x, &y);
+			if (x0 >= x1 || y0 >= y1) {
+				rc = 1;
+			} else if (x == floor(x) && y == floor(y) && x0 == floor(x0) && y0 == floor(y0) && x1 == floor(x1) && y1 == floor(y1)) {
+				int width = cairo_image_surface_get_width(surface);
+				int height = cairo_image_surface_get_height(surface);
+				int left = (int)(x0 + x), top = (int)(y0 + y), right = (int)(x1 + x), bottom = (int)(y1 + y);
+				if (left < 0) left = 0;
+				if (top < 0) top = 0;
+				if (right > width) right = width;
+				if (bottom > height) bottom = height;
+				if (left >= right || top >= bottom) {
+					rc = 1;
+				} else if (left - deltaX >= 0 && top - deltaY >= 0 && right - deltaX <= width && bottom - deltaY <= height) {
+					unsigned char *data;
+					int stride, row, count = (right - left) * bpp;
+					cairo_surface_flush(surface);
+					data = swt_cairo_image_surface_get_data(surface);
+					stride = swt_cairo_image_surface_get_stride(surface);
+					if (data != NULL && stride > 0) {
+						/* Rows are moved away from the side they overlap from */
+						for (row = 0; row < bottom - top; row++) {
+							int dest = deltaY > 0 ? bottom - 1 - row : top + row;
+							memmove(data + dest * stride + left * bpp, data + (dest - deltaY) * stride + (left - deltaX) * bpp, count);
+						}
+						cairo_surface_mark_dirty(surface);
+						rc = 1;
+					}
+				}
+			}
+		}
+	}
+	Cairo_NATIVE_EXIT(env, that, _1swt_1cairo_1copy_1area_FUNC);
+	return rc;
+}
+#endif
@@ -29,7 +29,9 @@
 #endif
 
 #define cairo_format_stride_for_width_LIB LIB_CAIRO
+#define cairo_pdf_surface_create_for_stream_LIB LIB_CAIRO
 #define cairo_pdf_surface_set_size_LIB LIB_CAIRO
+#define cairo_ps_surface_create_for_stream_LIB LIB_CAIRO
 #define cairo_ps_surface_set_size_LIB LIB_CAIRO
 #define cairo_surface_set_fallback_resolution_LIB LIB_CAIRO
 #define cairo_surface_get_type_LIB LIB_CAIRO
@@ -44,3 +46,7 @@
 #define cairo_pop_group_to_source_LIB LIB_CAIRO
 #define cairo_region_num_rectangles_LIB LIB_CAIRO
 #define cairo_region_get_rectangle_LIB LIB_CAIRO
+#define cairo_path_extents_LIB LIB_CAIRO
+#define cairo_pattern_get_rgba_LIB LIB_CAIRO
+#define cairo_copy_clip_rectangle_list_LIB LIB_CAIRO
+#define cairo_rectangle_list_destroy_LIB LIB_CAIRO
@@ -27,6 +27,7 @@
 char * Cairo_nativeFunctionNames[] = {
 	"CAIRO_1VERSION_1ENCODE",
 	"_1cairo_1append_1path",
+	"_1cairo_1append_1path_1data",
 	"_1cairo_1arc",
 	"_1cairo_1arc_1negative",
 	"_1cairo_1clip",
@@ -61,6 +62,7 @@ char * Cairo_nativeFunctionNames[] = {
 	"_1cairo_1in_1fill",
 	"_1cairo_1in_1stroke",
 	"_1cairo_1line_1to",
+	"_1cairo_1line_1to_1batch",
 	"_1cairo_1mask",
 	"_1cairo_1mask_1surface",
 	"_1cairo_1matrix_1init",
@@ -79,6 +81,7 @@ char * Cairo_nativeFunctionNames[] = {
 	"_1cairo_1new_1path",
 	"_1cairo_1paint",
 	"_1cairo_1paint_1with_1alpha",
+	"_1cairo_1path_1buffer",
 	"_1cairo_1path_1destroy",
 	"_1cairo_1pattern_1add_1color_1stop_1rgba",
 	"_1cairo_1pattern_1create_1for_1surface",
@@ -88,8 +91,10 @@ char * Cairo_nativeFunctionNames[] = {
 	"_1cairo_1pattern_1set_1extend",
 	"_1cairo_1pattern_1set_1filter",
 	"_1cairo_1pattern_1set_1matrix",
+	"_1cairo_1pdf_1surface_1create_1for_1stream",
 	"_1cairo_1pdf_1surface_1set_1size",
 	"_1cairo_1pop_1group_1to_1source",
+	"_1cairo_1ps_1surface_1create_1for_1stream",
 	"_1cairo_1ps_1surface_1set_1size",
 	"_1cairo_1push_1group",
 	"_1cairo_1rectangle",
@@ -136,6 +141,20 @@ char * Cairo_nativeFunctionNames[] = {
 	"_1cairo_1xlib_1surface_1create",
 	"_1cairo_1xlib_1surface_1get_1height",
 	"_1cairo_1xlib_1surface_1get_1width",
+	"_1swt_1cairo_1copy_1area",
+	"_1swt_1cairo_1elided_1calls",
+	"_1swt_1cairo_1image_1surface_1buffer",
+	"_1swt_1cairo_1matrix_1transform_1points",
+	"_1swt_1cairo_1path_1contains_1points",
+	"_1swt_1cairo_1paths_1contain",
+	"_1swt_1cairo_1pattern_1cache_1clear",
+	"_1swt_1cairo_1pattern_1create_1linear_1cached",
+	"_1swt_1cairo_1region_1get_1rectangles",
+	"_1swt_1cairo_1set_1line_1width",
+	"_1swt_1cairo_1set_1source_1rgba",
+	"_1swt_1cairo_1surface_1checkout",
+	"_1swt_1cairo_1surface_1pool_1clear",
+	"_1swt_1cairo_1surface_1return",
 	"cairo_1path_1data_1t_1sizeof",
 	"cairo_1path_1t_1sizeof",
 	"cairo_1version",
@@ -158,6 +177,9 @@ char * Cairo_nativeFunctionNames[] = {
 #define NATIVE_FUNCTION_COUNT sizeof(Cairo_nativeFunctionNames) / sizeof(char*)
 int Cairo_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int Cairo_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong Cairo_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT Cairo_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS Cairo_nativeStats = {Cairo_nativeFunctionCallCount, Cairo_nativeFunctionCallTime, Cairo_nativeFunctionEvents, 0, "Cairo", Cairo_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -179,4 +201,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(Cairo_1GetFunctionCallCount)
 	return Cairo_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(Cairo_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return Cairo_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(Cairo_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Cairo_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &Cairo_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Cairo_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(Cairo_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Cairo_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Cairo_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(Cairo_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
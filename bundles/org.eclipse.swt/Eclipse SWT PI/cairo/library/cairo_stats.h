@@ -23,8 +23,9 @@
 extern int Cairo_nativeFunctionCount;
 extern int Cairo_nativeFunctionCallCount[];
 extern char* Cairo_nativeFunctionNames[];
-#define Cairo_NATIVE_ENTER(env, that, func) Cairo_nativeFunctionCallCount[func]++;
-#define Cairo_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS Cairo_nativeStats;
+#define Cairo_NATIVE_ENTER(env, that, func) nativeStatsEnter(&Cairo_nativeStats, func);
+#define Cairo_NATIVE_EXIT(env, that, func) nativeStatsExit(&Cairo_nativeStats, func);
 #else
 #ifndef Cairo_NATIVE_ENTER
 #define Cairo_NATIVE_ENTER(env, that, func) 
@@ -37,6 +38,7 @@ extern char* Cairo_nativeFunctionNames[];
 typedef enum {
 	CAIRO_1VERSION_1ENCODE_FUNC,
 	_1cairo_1append_1path_FUNC,
+	_1cairo_1append_1path_1data_FUNC,
 	_1cairo_1arc_FUNC,
 	_1cairo_1arc_1negative_FUNC,
 	_1cairo_1clip_FUNC,
@@ -71,6 +73,7 @@ typedef enum {
 	_1cairo_1in_1fill_FUNC,
 	_1cairo_1in_1stroke_FUNC,
 	_1cairo_1line_1to_FUNC,
+	_1cairo_1line_1to_1batch_FUNC,
 	_1cairo_1mask_FUNC,
 	_1cairo_1mask_1surface_FUNC,
 	_1cairo_1matrix_1init_FUNC,
@@ -89,6 +92,7 @@ typedef enum {
 	_1cairo_1new_1path_FUNC,
 	_1cairo_1paint_FUNC,
 	_1cairo_1paint_1with_1alpha_FUNC,
+	_1cairo_1path_1buffer_FUNC,
 	_1cairo_1path_1destroy_FUNC,
 	_1cairo_1pattern_1add_1color_1stop_1rgba_FUNC,
 	_1cairo_1pattern_1create_1for_1surface_FUNC,
@@ -98,8 +102,10 @@ typedef enum {
 	_1cairo_1pattern_1set_1extend_FUNC,
 	_1cairo_1pattern_1set_1filter_FUNC,
 	_1cairo_1pattern_1set_1matrix_FUNC,
+	_1cairo_1pdf_1surface_1create_1for_1stream_FUNC,
 	_1cairo_1pdf_1surface_1set_1size_FUNC,
 	_1cairo_1pop_1group_1to_1source_FUNC,
+	_1cairo_1ps_1surface_1create_1for_1stream_FUNC,
 	_1cairo_1ps_1surface_1set_1size_FUNC,
 	_1cairo_1push_1group_FUNC,
 	_1cairo_1rectangle_FUNC,
@@ -146,6 +152,20 @@ typedef enum {
 	_1cairo_1xlib_1surface_1create_FUNC,
 	_1cairo_1xlib_1surface_1get_1height_FUNC,
 	_1cairo_1xlib_1surface_1get_1width_FUNC,
+	_1swt_1cairo_1copy_1area_FUNC,
+	_1swt_1cairo_1elided_1calls_FUNC,
+	_1swt_1cairo_1image_1surface_1buffer_FUNC,
+	_1swt_1cairo_1matrix_1transform_1points_FUNC,
+	_1swt_1cairo_1path_1contains_1points_FUNC,
+	_1swt_1cairo_1paths_1contain_FUNC,
+	_1swt_1cairo_1pattern_1cache_1clear_FUNC,
+	_1swt_1cairo_1pattern_1create_1linear_1cached_FUNC,
+	_1swt_1cairo_1region_1get_1rectangles_FUNC,
+	_1swt_1cairo_1set_1line_1width_FUNC,
+	_1swt_1cairo_1set_1source_1rgba_FUNC,
+	_1swt_1cairo_1surface_1checkout_FUNC,
+	_1swt_1cairo_1surface_1pool_1clear_FUNC,
+	_1swt_1cairo_1surface_1return_FUNC,
 	cairo_1path_1data_1t_1sizeof_FUNC,
 	cairo_1path_1t_1sizeof_FUNC,
 	cairo_1version_FUNC,
@@ -63,6 +63,7 @@ public class Cairo extends Platform {
 	public static final int CAIRO_STATUS_INVALID_MATRIX = 5;
 	public static final int CAIRO_STATUS_NO_TARGET_SURFACE = 6;
 	public static final int CAIRO_STATUS_NULL_POINTER =7;
+	public static final int CAIRO_STATUS_WRITE_ERROR = 11;
 	public static final int CAIRO_SURFACE_TYPE_IMAGE = 0;
 	public static final int CAIRO_SURFACE_TYPE_PDF = 1;
     public static final int CAIRO_SURFACE_TYPE_PS = 2;
@@ -108,6 +109,25 @@ public static final void cairo_append_path(long /*int*/ cr, long /*int*/ path) {
 		lock.unlock();
 	}
 }
+/**
+ * @method flags=no_gen
+ * @param cr cast=(cairo_t *)
+ */
+public static final native boolean _cairo_append_path_data(long /*int*/ cr, byte[] types, float[] points, int[] state);
+/**
+ * Adds the segments of a PathData to the current path in one call, the
+ * way the Path methods with the same names do.  state holds the moved
+ * and closed flags of the Path and is updated.  Returns false without
+ * changing the path if a type is not valid or there are not enough points.
+ */
+public static final boolean cairo_append_path_data(long /*int*/ cr, byte[] types, float[] points, int[] state) {
+	lock.lock();
+	try {
+		return _cairo_append_path_data(cr, types, points, state);
+	} finally {
+		lock.unlock();
+	}
+}
 /** @param cr cast=(cairo_t *) */
 public static final native void _cairo_arc(long /*int*/ cr, double xc, double yc, double radius, double angle1, double angle2);
 public static final void cairo_arc(long /*int*/ cr, double xc, double yc, double radius, double angle1, double angle2) {
@@ -138,7 +158,10 @@ public static final void cairo_clip(long /*int*/ cr) {
 		lock.unlock();
 	}
 }
-/** @param cr cast=(cairo_t *) */
+/**
+ * @method flags=leaf
+ * @param cr cast=(cairo_t *)
+ */
 public static final native void _cairo_close_path(long /*int*/ cr);
 public static final void cairo_close_path(long /*int*/ cr) {
 	lock.lock();
@@ -178,7 +201,10 @@ public static final long /*int*/ cairo_copy_path_flat(long /*int*/ cr) {
 		lock.unlock();
 	}
 }
-/** @param target cast=(cairo_surface_t *) */
+/**
+ * @method resource=cairo_t
+ * @param target cast=(cairo_surface_t *)
+ */
 public static final native long /*int*/ _cairo_create(long /*int*/ target);
 public static final long /*int*/ cairo_create(long /*int*/ target) {
 	lock.lock();
@@ -198,7 +224,10 @@ public static final void cairo_curve_to(long /*int*/ cr, double x1, double y1, d
 		lock.unlock();
 	}
 }
-/** @param cr cast=(cairo_t *) */
+/**
+ * @method flags=destroy
+ * @param cr cast=(cairo_t *)
+ */
 public static final native void _cairo_destroy(long /*int*/ cr);
 public static final void cairo_destroy(long /*int*/ cr) {
 	lock.lock();
@@ -208,7 +237,10 @@ public static final void cairo_destroy(long /*int*/ cr) {
 		lock.unlock();
 	}
 }
-/** @param cr cast=(cairo_t *) */
+/**
+ * @method flags=leaf
+ * @param cr cast=(cairo_t *)
+ */
 public static final native void _cairo_fill(long /*int*/ cr);
 public static final void cairo_fill(long /*int*/ cr) {
 	lock.lock();
@@ -360,6 +392,7 @@ public static final void cairo_identity_matrix(long /*int*/ cr) {
 		lock.unlock();
 	}
 }
+/** @method resource=cairo_surface_t,size=(jlong)arg1*arg2*4 */
 public static final native long /*int*/ _cairo_image_surface_create(int format, int width, int height);
 public static final long /*int*/ cairo_image_surface_create(int format, int width, int height) {
 	lock.lock();
@@ -370,62 +403,68 @@ public static final long /*int*/ cairo_image_surface_create(int format, int widt
 	}
 }
 /**
- * @method flags=dynamic
+ * @method flags=dynamic,lock=read
  * @param surface cast=(cairo_surface_t *)
  */
 public static final native long /*int*/ _cairo_image_surface_get_data(long /*int*/ surface);
 public static final long /*int*/ cairo_image_surface_get_data(long /*int*/ surface) {
-	lock.lock();
+	lock.lockRead();
 	try {
 		return _cairo_image_surface_get_data(surface);
 	} finally {
-		lock.unlock();
+		lock.unlockRead();
 	}
 }
 /**
- * @method flags=dynamic
+ * @method flags=dynamic,lock=read
  * @param surface cast=(cairo_surface_t *)
  */
 public static final native int _cairo_image_surface_get_format(long /*int*/ surface);
 public static final int cairo_image_surface_get_format(long /*int*/ surface) {
-	lock.lock();
+	lock.lockRead();
 	try {
 		return _cairo_image_surface_get_format(surface);
 	} finally {
-		lock.unlock();
+		lock.unlockRead();
 	}
 }
-/** @param surface cast=(cairo_surface_t *) */
+/**
+ * @method lock=read
+ * @param surface cast=(cairo_surface_t *)
+ */
 public static final native int _cairo_image_surface_get_height(long /*int*/ surface);
 public static final int cairo_image_surface_get_height(long /*int*/ surface) {
-	lock.lock();
+	lock.lockRead();
 	try {
 		return _cairo_image_surface_get_height(surface);
 	} finally {
-		lock.unlock();
+		lock.unlockRead();
 	}
 }
-/** @param surface cast=(cairo_surface_t *) */
+/**
+ * @method lock=read
+ * @param surface cast=(cairo_surface_t *)
+ */
 public static final native int _cairo_image_surface_get_width(long /*int*/ surface);
 public static final int cairo_image_surface_get_width(long /*int*/ surface) {
-	lock.lock();
+	lock.lockRead();
 	try {
 		return _cairo_image_surface_get_width(surface);
 	} finally {
-		lock.unlock();
+		lock.unlockRead();
 	}
 }
 /**
- * @method flags=dynamic
+ * @method flags=dynamic,lock=read
  * @param surface cast=(cairo_surface_t *)
  */
 public static final native int _cairo_image_surface_get_stride(long /*int*/ surface);
 public static final int cairo_image_surface_get_stride(long /*int*/ surface) {
-	lock.lock();
+	lock.lockRead();
 	try {
 		return _cairo_image_surface_get_stride(surface);
 	} finally {
-		lock.unlock();
+		lock.unlockRead();
 	}
 }
 /** @param cr cast=(cairo_t *) */
@@ -448,7 +487,10 @@ public static final int cairo_in_stroke(long /*int*/ cr, double x, double y) {
 		lock.unlock();
 	}
 }
-/** @param cr cast=(cairo_t *) */
+/**
+ * @method flags=leaf
+ * @param cr cast=(cairo_t *)
+ */
 public static final native void _cairo_line_to(long /*int*/ cr, double x, double y);
 public static final void cairo_line_to(long /*int*/ cr, double x, double y) {
 	lock.lock();
@@ -458,6 +500,22 @@ public static final void cairo_line_to(long /*int*/ cr, double x, double y) {
 		lock.unlock();
 	}
 }
+/**
+ * @method flags=batch
+ * @param cr cast=(cairo_t *)
+ * @param x flags=no_out critical
+ * @param y flags=no_out critical
+ */
+public static final native void _cairo_line_to_batch(long /*int*/ cr, double[] x, double[] y);
+/** Calls cairo_line_to() for each point in x and y. */
+public static final void cairo_line_to_batch(long /*int*/ cr, double[] x, double[] y) {
+	lock.lock();
+	try {
+		_cairo_line_to_batch(cr, x, y);
+	} finally {
+		lock.unlock();
+	}
+}
 /**
  * @param cr cast=(cairo_t *)
  * @param pattern cast=(cairo_pattern_t *)
@@ -608,7 +666,10 @@ public static final void cairo_matrix_translate(double[] matrix, double tx, doub
 		lock.unlock();
 	}
 }
-/** @param cr cast=(cairo_t *) */
+/**
+ * @method flags=leaf
+ * @param cr cast=(cairo_t *)
+ */
 public static final native void _cairo_move_to(long /*int*/ cr, double x, double y);
 public static final void cairo_move_to(long /*int*/ cr, double x, double y) {
 	lock.lock();
@@ -618,7 +679,10 @@ public static final void cairo_move_to(long /*int*/ cr, double x, double y) {
 		lock.unlock();
 	}
 }
-/** @param cr cast=(cairo_t *) */
+/**
+ * @method flags=leaf
+ * @param cr cast=(cairo_t *)
+ */
 public static final native void _cairo_new_path(long /*int*/ cr);
 public static final void cairo_new_path(long /*int*/ cr) {
 	lock.lock();
@@ -648,6 +712,24 @@ public static final void cairo_paint_with_alpha(long /*int*/ cr, double alpha) {
 		lock.unlock();
 	}
 }
+/**
+ * @method flags=no_gen
+ * @param path cast=(cairo_path_t *)
+ */
+public static final native java.nio.ByteBuffer _cairo_path_buffer(long /*int*/ path);
+/**
+ * Returns a direct buffer over the cairo_path_data_t array of a copied
+ * path, or null if the path is empty.  The buffer must not be used after
+ * the path is destroyed.
+ */
+public static final java.nio.ByteBuffer cairo_path_buffer(long /*int*/ path) {
+	lock.lock();
+	try {
+		return _cairo_path_buffer(path);
+	} finally {
+		lock.unlock();
+	}
+}
 /** @param path cast=(cairo_path_t *) */
 public static final native void _cairo_path_destroy(long /*int*/ path);
 public static final void cairo_path_destroy(long /*int*/ path) {
@@ -678,6 +760,7 @@ public static final long /*int*/ cairo_pattern_create_for_surface(long /*int*/ s
 		lock.unlock();
 	}
 }
+/** @method resource=cairo_pattern_t */
 public static final native long /*int*/ _cairo_pattern_create_linear(double x0, double y0, double x1, double y1);
 public static final long /*int*/ cairo_pattern_create_linear(double x0, double y0, double x1, double y1) {
 	lock.lock();
@@ -687,7 +770,10 @@ public static final long /*int*/ cairo_pattern_create_linear(double x0, double y
 		lock.unlock();
 	}
 }
-/** @param pattern cast=(cairo_pattern_t *) */
+/**
+ * @method flags=destroy
+ * @param pattern cast=(cairo_pattern_t *)
+ */
 public static final native void _cairo_pattern_destroy(long /*int*/ pattern);
 public static final void cairo_pattern_destroy(long /*int*/ pattern) {
 	lock.lock();
@@ -740,6 +826,20 @@ public static final void cairo_pattern_set_matrix(long /*int*/ pattern, double[]
 		lock.unlock();
 	}
 }
+/**
+ * @method flags=dynamic
+ * @param write_func cast=(cairo_write_func_t)
+ * @param closure cast=(void *)
+ */
+public static final native long /*int*/ _cairo_pdf_surface_create_for_stream(long /*int*/ write_func, long /*int*/ closure, double width_in_points, double height_in_points);
+public static final long /*int*/ cairo_pdf_surface_create_for_stream(long /*int*/ write_func, long /*int*/ closure, double width_in_points, double height_in_points) {
+	lock.lock();
+	try {
+		return _cairo_pdf_surface_create_for_stream(write_func, closure, width_in_points, height_in_points);
+	} finally {
+		lock.unlock();
+	}
+}
 /**
  * @method flags=dynamic
  * @param surface cast=(cairo_surface_t *)
@@ -779,6 +879,20 @@ public static final void cairo_pop_group_to_source(long /*int*/ cairo) {
 		lock.unlock();
 	}
 }
+/**
+ * @method flags=dynamic
+ * @param write_func cast=(cairo_write_func_t)
+ * @param closure cast=(void *)
+ */
+public static final native long /*int*/ _cairo_ps_surface_create_for_stream(long /*int*/ write_func, long /*int*/ closure, double width_in_points, double height_in_points);
+public static final long /*int*/ cairo_ps_surface_create_for_stream(long /*int*/ write_func, long /*int*/ closure, double width_in_points, double height_in_points) {
+	lock.lock();
+	try {
+		return _cairo_ps_surface_create_for_stream(write_func, closure, width_in_points, height_in_points);
+	} finally {
+		lock.unlock();
+	}
+}
 /**
  * @method flags=dynamic
  * @param surface cast=(cairo_surface_t *)
@@ -792,7 +906,10 @@ public static final void cairo_ps_surface_set_size(long /*int*/ surface, double
 		lock.unlock();
 	}
 }
-/** @param cr cast=(cairo_t *) */
+/**
+ * @method flags=leaf
+ * @param cr cast=(cairo_t *)
+ */
 public static final native void _cairo_rectangle(long /*int*/ cr, double x, double y, double width, double height);
 public static final void cairo_rectangle(long /*int*/ cr, double x, double y, double width, double height) {
 	lock.lock();
@@ -822,7 +939,10 @@ public static final void cairo_reset_clip(long /*int*/ cr) {
 		lock.unlock();
 	}
 }
-/** @param cr cast=(cairo_t *) */
+/**
+ * @method flags=leaf
+ * @param cr cast=(cairo_t *)
+ */
 public static final native void _cairo_restore(long /*int*/ cr);
 public static final void cairo_restore(long /*int*/ cr) {
 	lock.lock();
@@ -842,7 +962,10 @@ public static final void cairo_rotate(long /*int*/ cr, double angle) {
 		lock.unlock();
 	}
 }
-/** @param cr cast=(cairo_t *) */
+/**
+ * @method flags=leaf
+ * @param cr cast=(cairo_t *)
+ */
 public static final native void _cairo_save(long /*int*/ cr);
 public static final void cairo_save(long /*int*/ cr) {
 	lock.lock();
@@ -885,7 +1008,10 @@ public static final void cairo_set_antialias(long /*int*/ cr, int antialias) {
 		lock.unlock();
 	}
 }
-/** @param cr cast=(cairo_t *) */
+/**
+ * @param cr cast=(cairo_t *)
+ * @param dashes flags=no_out critical
+ */
 public static final native void _cairo_set_dash(long /*int*/ cr, double[] dashes, int ndash, double offset);
 public static final void cairo_set_dash(long /*int*/ cr, double[] dashes, int ndash, double offset) {
 	lock.lock();
@@ -948,7 +1074,10 @@ public static final void cairo_set_line_join(long /*int*/ cr, int line_join) {
 		lock.unlock();
 	}
 }
-/** @param cr cast=(cairo_t *) */
+/**
+ * @method flags=leaf
+ * @param cr cast=(cairo_t *)
+ */
 public static final native void _cairo_set_line_width(long /*int*/ cr, double width);
 public static final void cairo_set_line_width(long /*int*/ cr, double width) {
 	lock.lock();
@@ -1004,7 +1133,10 @@ public static final void cairo_set_source(long /*int*/ cr, long /*int*/ source)
 		lock.unlock();
 	}
 }
-/** @param cr cast=(cairo_t *) */
+/**
+ * @method flags=leaf
+ * @param cr cast=(cairo_t *)
+ */
 public static final native void _cairo_set_source_rgb(long /*int*/ cr, double red, double green, double blue);
 public static final void cairo_set_source_rgb(long /*int*/ cr, double red, double green, double blue) {
 	lock.lock();
@@ -1014,7 +1146,10 @@ public static final void cairo_set_source_rgb(long /*int*/ cr, double red, doubl
 		lock.unlock();
 	}
 }
-/** @param cr cast=(cairo_t *) */
+/**
+ * @method flags=leaf
+ * @param cr cast=(cairo_t *)
+ */
 public static final native void _cairo_set_source_rgba(long /*int*/ cr, double red, double green, double blue, double alpha);
 public static final void cairo_set_source_rgba(long /*int*/ cr, double red, double green, double blue, double alpha) {
 	lock.lock();
@@ -1057,7 +1192,10 @@ public static final void cairo_show_page(long /*int*/ cr) {
 		lock.unlock();
 	}
 }
-/** @param cr cast=(cairo_t *) */
+/**
+ * @method flags=leaf
+ * @param cr cast=(cairo_t *)
+ */
 public static final native void _cairo_stroke(long /*int*/ cr);
 public static final void cairo_stroke(long /*int*/ cr) {
 	lock.lock();
@@ -1077,7 +1215,10 @@ public static final long /*int*/ cairo_surface_create_similar(long /*int*/ other
 		lock.unlock();
 	}
 }
-/** @param surface cast=(cairo_surface_t *) */
+/**
+ * @method flags=destroy
+ * @param surface cast=(cairo_surface_t *)
+ */
 public static final native void _cairo_surface_destroy(long /*int*/ surface);
 public static final void cairo_surface_destroy(long /*int*/ surface) {
 	lock.lock();
@@ -1189,7 +1330,10 @@ public static final void cairo_transform(long /*int*/ cr, double[] matrix) {
 		lock.unlock();
 	}
 }
-/** @param cr cast=(cairo_t *) */
+/**
+ * @method flags=leaf
+ * @param cr cast=(cairo_t *)
+ */
 public static final native void _cairo_translate(long /*int*/ cr, double tx, double ty);
 public static final void cairo_translate(long /*int*/ cr, double tx, double ty) {
 	lock.lock();
@@ -1270,6 +1414,220 @@ public static final void cairo_region_get_rectangle(long /*int*/ region, int nth
 		lock.unlock();
 	}
 }
+/**
+ * @method flags=no_gen
+ * @param cr cast=(cairo_t *)
+ */
+public static final native boolean _swt_cairo_copy_area(long /*int*/ cr, int srcX, int srcY, int width, int height, int destX, int destY);
+/**
+ * Moves a rectangle of the image surface the context draws to in place,
+ * like painting the surface onto itself with <code>CAIRO_OPERATOR_SOURCE</code>.
+ * Returns false without drawing anything if the context has a transformation
+ * other than an integer translation, a clip that is not a single rectangle,
+ * or the source is not inside the surface.
+ */
+public static final boolean swt_cairo_copy_area(long /*int*/ cr, int srcX, int srcY, int width, int height, int destX, int destY) {
+	lock.lock();
+	try {
+		return _swt_cairo_copy_area(cr, srcX, srcY, width, height, destX, destY);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @method flags=no_gen */
+public static final native java.nio.ByteBuffer _swt_cairo_image_surface_buffer(long /*int*/ surface);
+/**
+ * Flushes an image surface and returns a direct buffer over its pixels,
+ * or null if the surface is not an image surface.  The rows are
+ * <code>cairo_image_surface_get_stride()</code> bytes apart.  Call
+ * <code>cairo_surface_mark_dirty()</code> after changing the pixels.
+ * The buffer must not be used after the surface is destroyed.
+ */
+public static final java.nio.ByteBuffer swt_cairo_image_surface_buffer(long /*int*/ surface) {
+	lock.lock();
+	try {
+		return _swt_cairo_image_surface_buffer(surface);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @method flags=no_gen */
+public static final native boolean _swt_cairo_matrix_transform_points(double[] matrix, float[] points, int count);
+/**
+ * Transforms count x, y pairs of points in place with the matrix.
+ * Returns false if the arrays are too short.
+ */
+public static final boolean swt_cairo_matrix_transform_points(double[] matrix, float[] points, int count) {
+	lock.lock();
+	try {
+		return _swt_cairo_matrix_transform_points(matrix, points, count);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @method flags=no_gen
+ * @param cr cast=(cairo_t *)
+ * @param path cast=(cairo_t *)
+ */
+public static final native boolean _swt_cairo_path_contains_points(long /*int*/ cr, long /*int*/ path, double[] points, boolean outline, boolean prefilter, int[] mask);
+/**
+ * Tests x, y pairs against the path held by the context path with the
+ * transformation, fill rule and line attributes of cr, and sets bit i of
+ * mask for each point i that is contained.  When prefilter is set, points
+ * outside of the extents of the path are rejected without testing the
+ * path.  Returns false if the mask is too short.
+ */
+public static final boolean swt_cairo_path_contains_points(long /*int*/ cr, long /*int*/ path, double[] points, boolean outline, boolean prefilter, int[] mask) {
+	lock.lock();
+	try {
+		return _swt_cairo_path_contains_points(cr, path, points, outline, prefilter, mask);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @method flags=no_gen
+ * @param cr cast=(cairo_t *)
+ */
+public static final native boolean _swt_cairo_paths_contain(long /*int*/ cr, long /*int*/[] paths, double x, double y, boolean outline, boolean prefilter, int[] mask);
+/**
+ * Tests a point against the paths held by the contexts in paths with the
+ * transformation, fill rule and line attributes of cr, and sets bit i of
+ * mask for each path i that contains it.  When prefilter is set, paths
+ * whose extents do not contain the point are rejected without testing
+ * them.  Returns false if the mask is too short.
+ */
+public static final boolean swt_cairo_paths_contain(long /*int*/ cr, long /*int*/[] paths, double x, double y, boolean outline, boolean prefilter, int[] mask) {
+	lock.lock();
+	try {
+		return _swt_cairo_paths_contain(cr, paths, x, y, outline, prefilter, mask);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @method flags=no_gen */
+public static final native void _swt_cairo_pattern_cache_clear();
+/**
+ * Releases the patterns kept by <code>swt_cairo_pattern_create_linear_cached()</code>.
+ */
+public static final void swt_cairo_pattern_cache_clear() {
+	lock.lock();
+	try {
+		_swt_cairo_pattern_cache_clear();
+	} finally {
+		lock.unlock();
+	}
+}
+/** @method flags=no_gen */
+public static final native long /*int*/ _swt_cairo_pattern_create_linear_cached(double x0, double y0, double x1, double y1, int extend, double[] stops);
+/**
+ * Returns a reference to a linear gradient pattern with the given end
+ * points, extend and color stops, reusing the pattern of an earlier call
+ * with the same arguments when possible.  The stops are offset, red,
+ * green, blue and alpha quintuples.  The caller must destroy the pattern
+ * with <code>cairo_pattern_destroy()</code> and must not change it.
+ */
+public static final long /*int*/ swt_cairo_pattern_create_linear_cached(double x0, double y0, double x1, double y1, int extend, double[] stops) {
+	lock.lock();
+	try {
+		return _swt_cairo_pattern_create_linear_cached(x0, y0, x1, y1, extend, stops);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @method flags=no_gen */
+public static final native int[] _swt_cairo_region_get_rectangles(long /*int*/ region);
+/**
+ * Returns the rectangles of a region as x, y, width and height
+ * quadruples, or null if the region functions are not available.
+ */
+public static final int[] swt_cairo_region_get_rectangles(long /*int*/ region) {
+	lock.lock();
+	try {
+		return _swt_cairo_region_get_rectangles(region);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @method flags=no_gen
+ * @param cr cast=(cairo_t *)
+ */
+public static final native boolean _swt_cairo_set_line_width(long /*int*/ cr, double width);
+/**
+ * Sets the line width unless the context already has it.  Returns
+ * whether the line width was set.
+ */
+public static final boolean swt_cairo_set_line_width(long /*int*/ cr, double width) {
+	lock.lock();
+	try {
+		return _swt_cairo_set_line_width(cr, width);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @method flags=no_gen
+ * @param cr cast=(cairo_t *)
+ */
+public static final native boolean _swt_cairo_set_source_rgba(long /*int*/ cr, double red, double green, double blue, double alpha);
+/**
+ * Sets the source to a solid color unless the source already is a
+ * solid pattern of that color.  Returns whether the source was set.
+ */
+public static final boolean swt_cairo_set_source_rgba(long /*int*/ cr, double red, double green, double blue, double alpha) {
+	lock.lock();
+	try {
+		return _swt_cairo_set_source_rgba(cr, red, green, blue, alpha);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @method flags=no_gen */
+public static final native long /*int*/ _swt_cairo_surface_checkout(int format, int width, int height);
+/**
+ * Returns an image surface with the given format and size, reusing one
+ * that was given back with <code>swt_cairo_surface_return()</code> when
+ * possible.  The surface is cleared like a new one.
+ */
+public static final long /*int*/ swt_cairo_surface_checkout(int format, int width, int height) {
+	lock.lock();
+	try {
+		return _swt_cairo_surface_checkout(format, width, height);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @method flags=no_gen */
+public static final native void _swt_cairo_surface_pool_clear();
+/**
+ * Destroys the surfaces that were given back to the pool.
+ */
+public static final void swt_cairo_surface_pool_clear() {
+	lock.lock();
+	try {
+		_swt_cairo_surface_pool_clear();
+	} finally {
+		lock.unlock();
+	}
+}
+/** @method flags=no_gen */
+public static final native void _swt_cairo_surface_return(long /*int*/ surface, int format, int width, int height);
+/**
+ * Gives back a surface from <code>swt_cairo_surface_checkout()</code>
+ * instead of destroying it.  The caller must hold the only reference
+ * to the surface, and the format and size must be the ones it was
+ * checked out with.
+ */
+public static final void swt_cairo_surface_return(long /*int*/ surface, int format, int width, int height) {
+	lock.lock();
+	try {
+		_swt_cairo_surface_return(surface, format, width, height);
+	} finally {
+		lock.unlock();
+	}
+}
 /**
  * @param dest cast=(void *)
  * @param src cast=(const void *)
@@ -172,7 +172,7 @@ JNIEXPORT jint JNICALL Cocoa_NATIVE(objc_1getClass)
 	if (arg0) if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jint)objc_getClass((const char *)lparg0);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	Cocoa_NATIVE_EXIT(env, that, objc_1getClass_FUNC);
 	return rc;
 }
@@ -188,7 +188,7 @@ JNIEXPORT jint JNICALL Cocoa_NATIVE(objc_1getMetaClass)
 	if (arg0) if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jint)objc_getMetaClass((const char *)lparg0);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	Cocoa_NATIVE_EXIT(env, that, objc_1getMetaClass_FUNC);
 	return rc;
 }
@@ -596,7 +596,7 @@ JNIEXPORT jint JNICALL Cocoa_NATIVE(sel_1registerName)
 	if (arg0) if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jint)sel_registerName((const char *)lparg0);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	Cocoa_NATIVE_EXIT(env, that, sel_1registerName_FUNC);
 	return rc;
 }
@@ -62,6 +62,9 @@ char * Cocoa_nativeFunctionNames[] = {
 #define NATIVE_FUNCTION_COUNT sizeof(Cocoa_nativeFunctionNames) / sizeof(char*)
 int Cocoa_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int Cocoa_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong Cocoa_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT Cocoa_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS Cocoa_nativeStats = {Cocoa_nativeFunctionCallCount, Cocoa_nativeFunctionCallTime, Cocoa_nativeFunctionEvents, 0, "Cocoa", Cocoa_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -83,4 +86,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(Cocoa_1GetFunctionCallCount)
 	return Cocoa_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(Cocoa_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return Cocoa_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(Cocoa_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Cocoa_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &Cocoa_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Cocoa_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(Cocoa_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Cocoa_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Cocoa_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(Cocoa_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
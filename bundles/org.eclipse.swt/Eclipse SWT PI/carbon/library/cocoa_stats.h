@@ -13,8 +13,9 @@
 extern int Cocoa_nativeFunctionCount;
 extern int Cocoa_nativeFunctionCallCount[];
 extern char* Cocoa_nativeFunctionNames[];
-#define Cocoa_NATIVE_ENTER(env, that, func) Cocoa_nativeFunctionCallCount[func]++;
-#define Cocoa_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS Cocoa_nativeStats;
+#define Cocoa_NATIVE_ENTER(env, that, func) nativeStatsEnter(&Cocoa_nativeStats, func);
+#define Cocoa_NATIVE_EXIT(env, that, func) nativeStatsExit(&Cocoa_nativeStats, func);
 #else
 #ifndef Cocoa_NATIVE_ENTER
 #define Cocoa_NATIVE_ENTER(env, that, func) 
@@ -36,7 +36,7 @@ LFLAGS = -bundle $(ARCHS) -framework JavaVM -framework Carbon -framework JavaScr
 COCOACFLAGS = $(CFLAGS) -xobjective-c -I /System/Library/Frameworks/Cocoa.framework/Headers -I /System/Library/Frameworks/WebKit.framework/Headers
 COCOALFLAGS = $(LFLAGS) -framework WebKit -framework Cocoa
 AGLLFLAGS = $(LFLAGS) -framework OpenGL -framework AGL
-SWT_OBJECTS = swt.o c.o c_stats.o callback.o
+SWT_OBJECTS = swt.o c.o c_stats.o callback.o blit.o transcode.o pngfilter.o lzw.o tiff.o benchmark.o watchdog.o arena.o pool.o
 SWTPI_OBJECTS = swt.o os.o os_custom.o os_structs.o os_stats.o
 COCOA_OBJECTS = swt.o cocoa.o cocoa_custom.o cocoa_structs.o cocoa_stats.o 
 AGL_OBJECTS = swt.o agl.o agl_stats.o
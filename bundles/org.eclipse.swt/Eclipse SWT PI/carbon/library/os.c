@@ -46,7 +46,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(AECountItems)
 	rc = (jint)AECountItems((const AEDescList *)lparg0, (long *)lparg1);
 fail:
 	if (arg1 && lparg1) (*env)->ReleaseIntArrayElements(env, arg1, lparg1, 0);
-	if (arg0 && lparg0) setAEDescFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, AECountItems_FUNC);
 	return rc;
 }
@@ -65,7 +64,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(AECreateDesc)
 	rc = (jint)AECreateDesc((DescType)arg0, (const void *)lparg1, (Size)arg2, lparg3);
 fail:
 	if (arg3 && lparg3) setAEDescFields(env, arg3, lparg3);
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, AECreateDesc_FUNC);
 	return rc;
 }
@@ -125,7 +124,6 @@ fail:
 	if (arg7 && lparg7) (*env)->ReleaseIntArrayElements(env, arg7, lparg7, 0);
 	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
 	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
-	if (arg0 && lparg0) setAEDescFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, AEGetNthPtr_FUNC);
 	return rc;
 }
@@ -169,7 +167,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(AEProcessAppleEvent)
 	if (arg0) if ((lparg0 = getEventRecordFields(env, arg0, &_arg0)) == NULL) goto fail;
 	rc = (jint)AEProcessAppleEvent((const EventRecord *)lparg0);
 fail:
-	if (arg0 && lparg0) setEventRecordFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, AEProcessAppleEvent_FUNC);
 	return rc;
 }
@@ -200,7 +197,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ATSFontActivateFromFileSpecification)
 	rc = (jint)ATSFontActivateFromFileSpecification((const FSSpec *)lparg0, (ATSFontContext)arg1, (ATSFontFormat)arg2, (void *)arg3, (ATSOptionFlags)arg4, (ATSFontContainerRef *)lparg5);
 fail:
 	if (arg5 && lparg5) (*env)->ReleaseIntArrayElements(env, arg5, lparg5, 0);
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, ATSFontActivateFromFileSpecification_FUNC);
 	return rc;
 }
@@ -406,7 +403,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ATSUCreateTextLayoutWithTextPtr)
 fail:
 	if (arg7 && lparg7) (*env)->ReleaseIntArrayElements(env, arg7, lparg7, 0);
 	if (arg6 && lparg6) (*env)->ReleaseIntArrayElements(env, arg6, lparg6, 0);
-	if (arg5 && lparg5) (*env)->ReleaseIntArrayElements(env, arg5, lparg5, 0);
+	if (arg5 && lparg5) (*env)->ReleaseIntArrayElements(env, arg5, lparg5, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, ATSUCreateTextLayoutWithTextPtr_FUNC);
 	return rc;
 }
@@ -492,7 +489,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ATSUFindFontFromName)
 	rc = (jint)ATSUFindFontFromName((const void *)lparg0, arg1, arg2, arg3, arg4, arg5, (ATSUFontID *)lparg6);
 fail:
 	if (arg6 && lparg6) (*env)->ReleaseIntArrayElements(env, arg6, lparg6, 0);
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, ATSUFindFontFromName_FUNC);
 	return rc;
 }
@@ -806,8 +803,8 @@ JNIEXPORT jint JNICALL OS_NATIVE(ATSUSetFontFeatures)
 	if (arg3) if ((lparg3 = (*env)->GetShortArrayElements(env, arg3, NULL)) == NULL) goto fail;
 	rc = (jint)ATSUSetFontFeatures((ATSUStyle)arg0, (ItemCount)arg1, (const ATSUFontFeatureType *)lparg2, (const ATSUFontFeatureSelector *)lparg3);
 fail:
-	if (arg3 && lparg3) (*env)->ReleaseShortArrayElements(env, arg3, lparg3, 0);
-	if (arg2 && lparg2) (*env)->ReleaseShortArrayElements(env, arg2, lparg2, 0);
+	if (arg3 && lparg3) (*env)->ReleaseShortArrayElements(env, arg3, lparg3, JNI_ABORT);
+	if (arg2 && lparg2) (*env)->ReleaseShortArrayElements(env, arg2, lparg2, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, ATSUSetFontFeatures_FUNC);
 	return rc;
 }
@@ -865,9 +862,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(ATSUSetLineControls)
 	if (arg5) if ((lparg5 = (*env)->GetIntArrayElements(env, arg5, NULL)) == NULL) goto fail;
 	rc = (jint)ATSUSetLineControls((ATSUTextLayout)arg0, (UniCharArrayOffset)arg1, (ItemCount)arg2, (const ATSUAttributeTag *)lparg3, (const ByteCount *)lparg4, (const ATSUAttributeValuePtr *)lparg5);
 fail:
-	if (arg5 && lparg5) (*env)->ReleaseIntArrayElements(env, arg5, lparg5, 0);
-	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
-	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
+	if (arg5 && lparg5) (*env)->ReleaseIntArrayElements(env, arg5, lparg5, JNI_ABORT);
+	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, JNI_ABORT);
+	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, ATSUSetLineControls_FUNC);
 	return rc;
 }
@@ -1111,7 +1108,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(AcquireFirstMatchingEventInQueue)
 	if (arg2) if ((lparg2 = (*env)->GetIntArrayElements(env, arg2, NULL)) == NULL) goto fail;
 	rc = (jint)AcquireFirstMatchingEventInQueue((EventQueueRef)arg0, arg1, (const EventTypeSpec *)lparg2, arg3);
 fail:
-	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, 0);
+	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, AcquireFirstMatchingEventInQueue_FUNC);
 	return rc;
 }
@@ -1151,7 +1148,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(AddDataBrowserItems)
 	if (arg3) if ((lparg3 = (*env)->GetIntArrayElements(env, arg3, NULL)) == NULL) goto fail;
 	rc = (jint)AddDataBrowserItems((ControlRef)arg0, (DataBrowserItemID)arg1, (UInt32)arg2, (const DataBrowserItemID *)lparg3, (DataBrowserPropertyID)arg4);
 fail:
-	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
+	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, AddDataBrowserItems_FUNC);
 	return rc;
 }
@@ -1183,7 +1180,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(AddDragItemFlavor)
 	if (arg3) if ((lparg3 = (*env)->GetByteArrayElements(env, arg3, NULL)) == NULL) goto fail;
 	rc = (jint)AddDragItemFlavor((DragRef)arg0, (DragItemRef)arg1, (FlavorType)arg2, (const void *)lparg3, (Size)arg4, (FlavorFlags)arg5);
 fail:
-	if (arg3 && lparg3) (*env)->ReleaseByteArrayElements(env, arg3, lparg3, 0);
+	if (arg3 && lparg3) (*env)->ReleaseByteArrayElements(env, arg3, lparg3, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, AddDragItemFlavor_FUNC);
 	return rc;
 }
@@ -1641,7 +1638,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CFStringCreateWithBytes)
 	if (arg1) if ((lparg1 = (*env)->GetByteArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	rc = (jint)CFStringCreateWithBytes((CFAllocatorRef)arg0, (const UInt8 *)lparg1, (CFIndex)arg2, (CFStringEncoding)arg3, arg4);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CFStringCreateWithBytes_FUNC);
 	return rc;
 }
@@ -1669,7 +1666,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CFStringCreateWithCharacters__I_3CI)
 	if (arg1) if ((lparg1 = (*env)->GetCharArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	rc = (jint)CFStringCreateWithCharacters((CFAllocatorRef)arg0, (const UniChar *)lparg1, (CFIndex)arg2);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CFStringCreateWithCharacters__I_3CI_FUNC);
 	return rc;
 }
@@ -1832,7 +1829,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CFURLCreateFromFSRef)
 	if (arg1) if ((lparg1 = (*env)->GetByteArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	rc = (jint)CFURLCreateFromFSRef((CFAllocatorRef)arg0, (const struct FSRef *)lparg1);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CFURLCreateFromFSRef_FUNC);
 	return rc;
 }
@@ -1884,7 +1881,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CFURLCreateWithBytes)
 	if (arg1) if ((lparg1 = (*env)->GetByteArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	rc = (jint)CFURLCreateWithBytes((CFAllocatorRef)arg0, (const UInt8 *)lparg1, (CFIndex)arg2, (CFStringEncoding)arg3, (CFURLRef)arg4);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CFURLCreateWithBytes_FUNC);
 	return rc;
 }
@@ -2061,7 +2058,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextAddLines)
 	if (arg1) if ((lparg1 = (*env)->GetFloatArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	CGContextAddLines((CGContextRef)arg0, (const CGPoint *)lparg1, (size_t)arg2);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGContextAddLines_FUNC);
 }
 #endif
@@ -2307,7 +2304,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextSelectFont)
 	if (arg1) if ((lparg1 = (*env)->GetByteArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	CGContextSelectFont((CGContextRef)arg0, (const char *)lparg1, (float)arg2, (CGTextEncoding)arg3);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGContextSelectFont_FUNC);
 }
 #endif
@@ -2349,7 +2346,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextSetFillColor)
 	if (arg1) if ((lparg1 = (*env)->GetFloatArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	CGContextSetFillColor((CGContextRef)arg0, (const float *)lparg1);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGContextSetFillColor_FUNC);
 }
 #endif
@@ -2427,7 +2424,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextSetLineDash)
 	if (arg2) if ((lparg2 = (*env)->GetFloatArrayElements(env, arg2, NULL)) == NULL) goto fail;
 	CGContextSetLineDash((CGContextRef)arg0, (float)arg1, (const float *)lparg2, (size_t)arg3);
 fail:
-	if (arg2 && lparg2) (*env)->ReleaseFloatArrayElements(env, arg2, lparg2, 0);
+	if (arg2 && lparg2) (*env)->ReleaseFloatArrayElements(env, arg2, lparg2, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGContextSetLineDash_FUNC);
 }
 #endif
@@ -2521,7 +2518,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextSetStrokeColor)
 	if (arg1) if ((lparg1 = (*env)->GetFloatArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	CGContextSetStrokeColor((CGContextRef)arg0, (const float *)lparg1);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGContextSetStrokeColor_FUNC);
 }
 #endif
@@ -2593,7 +2590,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextShowText)
 	if (arg1) if ((lparg1 = (*env)->GetByteArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	CGContextShowText((CGContextRef)arg0, (const char *)lparg1, (size_t)arg2);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGContextShowText_FUNC);
 }
 #endif
@@ -2607,7 +2604,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextShowTextAtPoint)
 	if (arg3) if ((lparg3 = (*env)->GetByteArrayElements(env, arg3, NULL)) == NULL) goto fail;
 	CGContextShowTextAtPoint((CGContextRef)arg0, (float)arg1, (float)arg2, (const char *)lparg3, (size_t)arg4);
 fail:
-	if (arg3 && lparg3) (*env)->ReleaseByteArrayElements(env, arg3, lparg3, 0);
+	if (arg3 && lparg3) (*env)->ReleaseByteArrayElements(env, arg3, lparg3, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGContextShowTextAtPoint_FUNC);
 }
 #endif
@@ -2858,9 +2855,8 @@ JNIEXPORT jint JNICALL OS_NATIVE(CGFunctionCreate)
 	if (arg5) if ((lparg5 = getCGFunctionCallbacksFields(env, arg5, &_arg5)) == NULL) goto fail;
 	rc = (jint)CGFunctionCreate((void *)arg0, (size_t)arg1, (const float *)lparg2, (size_t)arg3, (const float *)lparg4, (const CGFunctionCallbacks *)lparg5);
 fail:
-	if (arg5 && lparg5) setCGFunctionCallbacksFields(env, arg5, lparg5);
-	if (arg4 && lparg4) (*env)->ReleaseFloatArrayElements(env, arg4, lparg4, 0);
-	if (arg2 && lparg2) (*env)->ReleaseFloatArrayElements(env, arg2, lparg2, 0);
+	if (arg4 && lparg4) (*env)->ReleaseFloatArrayElements(env, arg4, lparg4, JNI_ABORT);
+	if (arg2 && lparg2) (*env)->ReleaseFloatArrayElements(env, arg2, lparg2, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGFunctionCreate_FUNC);
 	return rc;
 }
@@ -2908,7 +2904,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CGImageCreate)
 	if (arg8) if ((lparg8 = (*env)->GetFloatArrayElements(env, arg8, NULL)) == NULL) goto fail;
 	rc = (jint)CGImageCreate((size_t)arg0, (size_t)arg1, (size_t)arg2, (size_t)arg3, (size_t)arg4, (CGColorSpaceRef)arg5, (CGImageAlphaInfo)arg6, (CGDataProviderRef)arg7, (const float *)lparg8, (Boolean)arg9, (CGColorRenderingIntent)arg10);
 fail:
-	if (arg8 && lparg8) (*env)->ReleaseFloatArrayElements(env, arg8, lparg8, 0);
+	if (arg8 && lparg8) (*env)->ReleaseFloatArrayElements(env, arg8, lparg8, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGImageCreate_FUNC);
 	return rc;
 }
@@ -3117,7 +3113,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGPathAddArc)
 	if (arg1) if ((lparg1 = (*env)->GetFloatArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	CGPathAddArc((CGMutablePathRef)arg0, (const CGAffineTransform *)lparg1, arg2, arg3, arg4, arg5, arg6, arg7);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGPathAddArc_FUNC);
 }
 #endif
@@ -3131,7 +3127,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGPathAddCurveToPoint)
 	if (arg1) if ((lparg1 = (*env)->GetFloatArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	CGPathAddCurveToPoint((CGMutablePathRef)arg0, (const CGAffineTransform *)lparg1, arg2, arg3, arg4, arg5, arg6, arg7);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGPathAddCurveToPoint_FUNC);
 }
 #endif
@@ -3145,7 +3141,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGPathAddLineToPoint)
 	if (arg1) if ((lparg1 = (*env)->GetFloatArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	CGPathAddLineToPoint((CGMutablePathRef)arg0, (const CGAffineTransform *)lparg1, arg2, arg3);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGPathAddLineToPoint_FUNC);
 }
 #endif
@@ -3159,7 +3155,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGPathAddPath)
 	if (arg1) if ((lparg1 = (*env)->GetFloatArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	CGPathAddPath((CGMutablePathRef)arg0, (const CGAffineTransform *)lparg1, (CGPathRef)arg2);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGPathAddPath_FUNC);
 }
 #endif
@@ -3173,7 +3169,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGPathAddQuadCurveToPoint)
 	if (arg1) if ((lparg1 = (*env)->GetFloatArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	CGPathAddQuadCurveToPoint((CGMutablePathRef)arg0, (const CGAffineTransform *)lparg1, arg2, arg3, arg4, arg5);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGPathAddQuadCurveToPoint_FUNC);
 }
 #endif
@@ -3190,7 +3186,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGPathAddRect)
 	CGPathAddRect((CGMutablePathRef)arg0, (const CGAffineTransform *)lparg1, *lparg2);
 fail:
 	if (arg2 && lparg2) setCGRectFields(env, arg2, lparg2);
-	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGPathAddRect_FUNC);
 }
 #endif
@@ -3260,7 +3256,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGPathMoveToPoint)
 	if (arg1) if ((lparg1 = (*env)->GetFloatArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	CGPathMoveToPoint((CGMutablePathRef)arg0, (const CGAffineTransform *)lparg1, arg2, arg3);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseFloatArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CGPathMoveToPoint_FUNC);
 }
 #endif
@@ -3289,7 +3285,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(CGPatternCreate)
 	if (arg7) if ((lparg7 = getCGPatternCallbacksFields(env, arg7, &_arg7)) == NULL) goto fail;
 	rc = (jint)CGPatternCreate((void *)arg0, *lparg1, *(CGAffineTransform *)lparg2, arg3, arg4, (CGPatternTiling)arg5, arg6, (const CGPatternCallbacks *)lparg7);
 fail:
-	if (arg7 && lparg7) setCGPatternCallbacksFields(env, arg7, lparg7);
 	if (arg2 && lparg2) (*env)->ReleaseFloatArrayElements(env, arg2, lparg2, 0);
 	if (arg1 && lparg1) setCGRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, CGPatternCreate_FUNC);
@@ -3577,7 +3572,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(ClipCGContextToRegion)
 	if (arg1) if ((lparg1 = getRectFields(env, arg1, &_arg1)) == NULL) goto fail;
 	rc = (jint)ClipCGContextToRegion((CGContextRef)arg0, (const Rect *)lparg1, (RgnHandle)arg2);
 fail:
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, ClipCGContextToRegion_FUNC);
 	return rc;
 }
@@ -3726,8 +3720,6 @@ JNIEXPORT void JNICALL OS_NATIVE(CopyBits)
 	if (arg3) if ((lparg3 = getRectFields(env, arg3, &_arg3)) == NULL) goto fail;
 	CopyBits((const BitMap *)arg0, (const BitMap *)arg1, (const Rect *)lparg2, (const Rect *)lparg3, (short)arg4, (RgnHandle)arg5);
 fail:
-	if (arg3 && lparg3) setRectFields(env, arg3, lparg3);
-	if (arg2 && lparg2) setRectFields(env, arg2, lparg2);
 	OS_NATIVE_EXIT(env, that, CopyBits_FUNC);
 }
 #endif
@@ -3847,7 +3839,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(CreateBevelButtonControl)
 	rc = (jint)CreateBevelButtonControl((WindowRef)arg0, (const Rect *)lparg1, (CFStringRef)arg2, (ControlBevelThickness)arg3, (ControlBevelButtonBehavior)arg4, (ControlButtonContentInfoPtr)arg5, (SInt16)arg6, (ControlBevelButtonMenuBehavior)arg7, (ControlBevelButtonMenuPlacement)arg8, (ControlRef *)lparg9);
 fail:
 	if (arg9 && lparg9) (*env)->ReleaseIntArrayElements(env, arg9, lparg9, 0);
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, CreateBevelButtonControl_FUNC);
 	return rc;
 }
@@ -3882,7 +3873,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(CreateCheckBoxControl)
 	rc = (jint)CreateCheckBoxControl((WindowRef)arg0, (const Rect *)lparg1, (CFStringRef)arg2, (SInt32)arg3, (Boolean)arg4, (ControlRef *)lparg5);
 fail:
 	if (arg5 && lparg5) (*env)->ReleaseIntArrayElements(env, arg5, lparg5, 0);
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, CreateCheckBoxControl_FUNC);
 	return rc;
 }
@@ -3901,7 +3891,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(CreateClockControl)
 	rc = (jint)CreateClockControl((WindowRef)arg0, (const Rect *)lparg1, (ControlClockType)arg2, (ControlClockFlags)arg3, (ControlRef *)lparg4);
 fail:
 	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, CreateClockControl_FUNC);
 	return rc;
 }
@@ -3920,7 +3909,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(CreateDataBrowserControl)
 	rc = (jint)CreateDataBrowserControl((WindowRef)arg0, (const Rect *)lparg1, (DataBrowserViewStyle)arg2, (ControlRef *)lparg3);
 fail:
 	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, CreateDataBrowserControl_FUNC);
 	return rc;
 }
@@ -3977,7 +3965,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(CreateGroupBoxControl)
 	rc = (jint)CreateGroupBoxControl((WindowRef)arg0, (const Rect *)lparg1, (CFStringRef)arg2, (Boolean)arg3, (ControlRef *)lparg4);
 fail:
 	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, CreateGroupBoxControl_FUNC);
 	return rc;
 }
@@ -4018,7 +4005,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(CreateLittleArrowsControl)
 	rc = (jint)CreateLittleArrowsControl((WindowRef)arg0, (const Rect *)lparg1, arg2, arg3, arg4, arg5, (ControlRef *)lparg6);
 fail:
 	if (arg6 && lparg6) (*env)->ReleaseIntArrayElements(env, arg6, lparg6, 0);
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, CreateLittleArrowsControl_FUNC);
 	return rc;
 }
@@ -4053,7 +4039,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(CreateNewWindow)
 	rc = (jint)CreateNewWindow((WindowClass)arg0, (WindowAttributes)arg1, (const Rect *)lparg2, (WindowRef *)lparg3);
 fail:
 	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
-	if (arg2 && lparg2) setRectFields(env, arg2, lparg2);
 	OS_NATIVE_EXIT(env, that, CreateNewWindow_FUNC);
 	return rc;
 }
@@ -4072,7 +4057,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(CreatePopupArrowControl)
 	rc = (jint)CreatePopupArrowControl((WindowRef)arg0, (const Rect *)lparg1, (ControlPopupArrowOrientation)arg2, (ControlPopupArrowSize)arg3, (ControlRef *)lparg4);
 fail:
 	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, CreatePopupArrowControl_FUNC);
 	return rc;
 }
@@ -4129,7 +4113,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(CreatePushButtonControl)
 	rc = (jint)CreatePushButtonControl((WindowRef)arg0, (const Rect *)lparg1, (CFStringRef)arg2, (ControlRef *)lparg3);
 fail:
 	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, CreatePushButtonControl_FUNC);
 	return rc;
 }
@@ -4170,7 +4153,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(CreateRadioButtonControl)
 	rc = (jint)CreateRadioButtonControl((WindowRef)arg0, (const Rect *)lparg1, (CFStringRef)arg2, (SInt32)arg3, (Boolean)arg4, (ControlRef *)lparg5);
 fail:
 	if (arg5 && lparg5) (*env)->ReleaseIntArrayElements(env, arg5, lparg5, 0);
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, CreateRadioButtonControl_FUNC);
 	return rc;
 }
@@ -4243,7 +4225,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(CreateSliderControl)
 	rc = (jint)CreateSliderControl((WindowRef)arg0, (const Rect *)lparg1, (SInt32)arg2, (SInt32)arg3, (SInt32)arg4, (ControlSliderOrientation)arg5, (UInt16)arg6, (Boolean)arg7, (ControlActionUPP)arg8, (ControlRef *)lparg9);
 fail:
 	if (arg9 && lparg9) (*env)->ReleaseIntArrayElements(env, arg9, lparg9, 0);
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, CreateSliderControl_FUNC);
 	return rc;
 }
@@ -4262,7 +4243,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(CreateStandardAlert)
 	rc = (jint)CreateStandardAlert((AlertType)arg0, (CFStringRef)arg1, (CFStringRef)arg2, (const AlertStdCFStringAlertParamRec *)lparg3, (DialogRef *)lparg4);
 fail:
 	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
-	if (arg3 && lparg3) setAlertStdCFStringAlertParamRecFields(env, arg3, lparg3);
 	OS_NATIVE_EXIT(env, that, CreateStandardAlert_FUNC);
 	return rc;
 }
@@ -4283,7 +4263,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(CreateStaticTextControl)
 	rc = (jint)CreateStaticTextControl((WindowRef)arg0, lparg1, (CFStringRef)arg2, (const ControlFontStyleRec *)lparg3, (ControlRef *)lparg4);
 fail:
 	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
-	if (arg3 && lparg3) setControlFontStyleRecFields(env, arg3, lparg3);
 	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, CreateStaticTextControl_FUNC);
 	return rc;
@@ -4303,7 +4282,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(CreateTabsControl)
 	rc = (jint)CreateTabsControl((WindowRef)arg0, (const Rect *)lparg1, (ControlTabSize)arg2, (ControlTabDirection)arg3, (UInt16)arg4, (const ControlTabEntry *)arg5, (ControlRef *)lparg6);
 fail:
 	if (arg6 && lparg6) (*env)->ReleaseIntArrayElements(env, arg6, lparg6, 0);
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, CreateTabsControl_FUNC);
 	return rc;
 }
@@ -4708,7 +4686,6 @@ JNIEXPORT void JNICALL OS_NATIVE(DrawPicture)
 	if (arg1) if ((lparg1 = getRectFields(env, arg1, &_arg1)) == NULL) goto fail;
 	DrawPicture((PicHandle)arg0, (const Rect *)lparg1);
 fail:
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, DrawPicture_FUNC);
 }
 #endif
@@ -4727,8 +4704,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(DrawThemeButton)
 	if (arg3) if ((lparg3 = getThemeButtonDrawInfoFields(env, arg3, &_arg3)) == NULL) goto fail;
 	rc = (jint)DrawThemeButton((Rect *)lparg0, (ThemeButtonKind)arg1, (const ThemeButtonDrawInfo *)lparg2, (const ThemeButtonDrawInfo *)lparg3, (ThemeEraseUPP)arg4, (ThemeButtonDrawUPP)arg5, (UInt32)arg6);
 fail:
-	if (arg3 && lparg3) setThemeButtonDrawInfoFields(env, arg3, lparg3);
-	if (arg2 && lparg2) setThemeButtonDrawInfoFields(env, arg2, lparg2);
 	if (arg0 && lparg0) setRectFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, DrawThemeButton_FUNC);
 	return rc;
@@ -4745,7 +4720,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(DrawThemeEditTextFrame)
 	if (arg0) if ((lparg0 = getRectFields(env, arg0, &_arg0)) == NULL) goto fail;
 	rc = (jint)DrawThemeEditTextFrame((const Rect *)lparg0, (ThemeDrawState)arg1);
 fail:
-	if (arg0 && lparg0) setRectFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, DrawThemeEditTextFrame_FUNC);
 	return rc;
 }
@@ -4761,7 +4735,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(DrawThemeFocusRect)
 	if (arg0) if ((lparg0 = getRectFields(env, arg0, &_arg0)) == NULL) goto fail;
 	rc = (jint)DrawThemeFocusRect((const Rect *)lparg0, (Boolean)arg1);
 fail:
-	if (arg0 && lparg0) setRectFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, DrawThemeFocusRect_FUNC);
 	return rc;
 }
@@ -4793,7 +4766,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(DrawThemeSeparator)
 	if (arg0) if ((lparg0 = getRectFields(env, arg0, &_arg0)) == NULL) goto fail;
 	rc = (jint)DrawThemeSeparator((const Rect *)lparg0, (ThemeDrawState)arg1);
 fail:
-	if (arg0 && lparg0) setRectFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, DrawThemeSeparator_FUNC);
 	return rc;
 }
@@ -4809,7 +4781,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(DrawThemeTextBox)
 	if (arg4) if ((lparg4 = getRectFields(env, arg4, &_arg4)) == NULL) goto fail;
 	rc = (jint)DrawThemeTextBox((CFStringRef)arg0, (ThemeFontID)arg1, (ThemeDrawState)arg2, (Boolean)arg3, (const Rect *)lparg4, (SInt16)arg5, (void *)arg6);
 fail:
-	if (arg4 && lparg4) setRectFields(env, arg4, lparg4);
 	OS_NATIVE_EXIT(env, that, DrawThemeTextBox_FUNC);
 	return rc;
 }
@@ -4837,7 +4808,6 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(EmptyRect)
 	if (arg0) if ((lparg0 = getRectFields(env, arg0, &_arg0)) == NULL) goto fail;
 	rc = (jboolean)EmptyRect((const Rect *)lparg0);
 fail:
-	if (arg0 && lparg0) setRectFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, EmptyRect_FUNC);
 	return rc;
 }
@@ -4896,7 +4866,6 @@ JNIEXPORT void JNICALL OS_NATIVE(EraseRect)
 	if (arg0) if ((lparg0 = getRectFields(env, arg0, &_arg0)) == NULL) goto fail;
 	EraseRect((const Rect *)lparg0);
 fail:
-	if (arg0 && lparg0) setRectFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, EraseRect_FUNC);
 }
 #endif
@@ -5063,7 +5032,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FSpMakeFSRef)
 	rc = (jint)FSpMakeFSRef((const FSSpec *)lparg0, (FSRef *)lparg1);
 fail:
 	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, FSpMakeFSRef_FUNC);
 	return rc;
 }
@@ -6577,8 +6546,8 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetIconRefFromFileInfo)
 fail:
 	if (arg7 && lparg7) (*env)->ReleaseIntArrayElements(env, arg7, lparg7, 0);
 	if (arg6 && lparg6) (*env)->ReleaseIntArrayElements(env, arg6, lparg6, 0);
-	if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, 0);
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, JNI_ABORT);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, GetIconRefFromFileInfo_FUNC);
 	return rc;
 }
@@ -7600,8 +7569,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(HIComboBoxCreate)
 	rc = (jint)HIComboBoxCreate((const HIRect *)lparg0, (CFStringRef)arg1, (const ControlFontStyleRec *)lparg2, (CFArrayRef)arg3, (OptionBits)arg4, (HIViewRef *)lparg5);
 fail:
 	if (arg5 && lparg5) (*env)->ReleaseIntArrayElements(env, arg5, lparg5, 0);
-	if (arg2 && lparg2) setControlFontStyleRecFields(env, arg2, lparg2);
-	if (arg0 && lparg0) setCGRectFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, HIComboBoxCreate_FUNC);
 	return rc;
 }
@@ -7772,7 +7739,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(HIObjectRegisterSubclass)
 	rc = (jint)HIObjectRegisterSubclass((CFStringRef)arg0, (CFStringRef)arg1, (OptionBits)arg2, (EventHandlerUPP)arg3, (UInt32)arg4, (const EventTypeSpec *)lparg5, (void *)arg6, (HIObjectClassRef *)lparg7);
 fail:
 	if (arg7 && lparg7) (*env)->ReleaseIntArrayElements(env, arg7, lparg7, 0);
-	if (arg5 && lparg5) (*env)->ReleaseIntArrayElements(env, arg5, lparg5, 0);
+	if (arg5 && lparg5) (*env)->ReleaseIntArrayElements(env, arg5, lparg5, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, HIObjectRegisterSubclass_FUNC);
 	return rc;
 }
@@ -8022,7 +7989,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(HIThemeDrawButton)
 	rc = (jint)HIThemeDrawButton((const HIRect *)lparg0, (const HIThemeButtonDrawInfo *)lparg1, (CGContextRef)arg2, (HIThemeOrientation)arg3, (HIRect *)lparg4);
 fail:
 	if (arg4 && lparg4) setCGRectFields(env, arg4, lparg4);
-	if (arg1 && lparg1) setHIThemeButtonDrawInfoFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, HIThemeDrawButton_FUNC);
 	return rc;
 }
@@ -8075,8 +8041,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(HIThemeDrawGenericWell)
 	if (arg1) if ((lparg1 = getHIThemeButtonDrawInfoFields(env, arg1, &_arg1)) == NULL) goto fail;
 	rc = (jint)HIThemeDrawGenericWell((const HIRect *)lparg0, (const HIThemeButtonDrawInfo *)lparg1, (CGContextRef)arg2, (HIThemeOrientation)arg3);
 fail:
-	if (arg1 && lparg1) setHIThemeButtonDrawInfoFields(env, arg1, lparg1);
-	if (arg0 && lparg0) setCGRectFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, HIThemeDrawGenericWell_FUNC);
 	return rc;
 }
@@ -8173,7 +8137,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(HIThemeDrawTab)
 	rc = (jint)HIThemeDrawTab((const HIRect *)lparg0, (const HIThemeTabDrawInfo *)lparg1, (CGContextRef)arg2, (HIThemeOrientation)arg3, (HIRect *)lparg4);
 fail:
 	if (arg4 && lparg4) setCGRectFields(env, arg4, lparg4);
-	if (arg1 && lparg1) setHIThemeTabDrawInfoFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, HIThemeDrawTab_FUNC);
 	return rc;
 }
@@ -8191,8 +8154,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(HIThemeDrawTabPane)
 	if (arg1) if ((lparg1 = getHIThemeTabPaneDrawInfoFields(env, arg1, &_arg1)) == NULL) goto fail;
 	rc = (jint)HIThemeDrawTabPane((const HIRect *)lparg0, (const HIThemeTabPaneDrawInfo *)lparg1, (CGContextRef)arg2, (HIThemeOrientation)arg3);
 fail:
-	if (arg1 && lparg1) setHIThemeTabPaneDrawInfoFields(env, arg1, lparg1);
-	if (arg0 && lparg0) setCGRectFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, HIThemeDrawTabPane_FUNC);
 	return rc;
 }
@@ -8961,7 +8922,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(HIViewSetFrame)
 	if (arg1) if ((lparg1 = getCGRectFields(env, arg1, &_arg1)) == NULL) goto fail;
 	rc = (jint)HIViewSetFrame((HIViewRef)arg0, (const HIRect *)lparg1);
 fail:
-	if (arg1 && lparg1) setCGRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, HIViewSetFrame_FUNC);
 	return rc;
 }
@@ -9093,7 +9053,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(HMDisplayTag)
 	if (arg0) if ((lparg0 = getHMHelpContentRecFields(env, arg0, &_arg0)) == NULL) goto fail;
 	rc = (jint)HMDisplayTag((const HMHelpContentRec *)lparg0);
 fail:
-	if (arg0 && lparg0) setHMHelpContentRecFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, HMDisplayTag_FUNC);
 	return rc;
 }
@@ -9331,7 +9290,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(InstallEventHandler)
 	rc = (jint)InstallEventHandler((EventTargetRef)arg0, (EventHandlerUPP)arg1, (UInt32)arg2, (const EventTypeSpec *)lparg3, (void *)arg4, (EventHandlerRef *)lparg5);
 fail:
 	if (arg5 && lparg5) (*env)->ReleaseIntArrayElements(env, arg5, lparg5, 0);
-	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
+	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, InstallEventHandler_FUNC);
 	return rc;
 }
@@ -9410,7 +9369,6 @@ JNIEXPORT void JNICALL OS_NATIVE(InvalWindowRect)
 	if (arg1) if ((lparg1 = getRectFields(env, arg1, &_arg1)) == NULL) goto fail;
 	InvalWindowRect((WindowRef)arg0, (const Rect *)lparg1);
 fail:
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, InvalWindowRect_FUNC);
 }
 #endif
@@ -9434,7 +9392,6 @@ JNIEXPORT void JNICALL OS_NATIVE(InvertRect)
 	if (arg0) if ((lparg0 = getRectFields(env, arg0, &_arg0)) == NULL) goto fail;
 	InvertRect((const Rect *)lparg0);
 fail:
-	if (arg0 && lparg0) setRectFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, InvertRect_FUNC);
 }
 #endif
@@ -9652,7 +9609,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(JSStringCreateWithUTF8CString)
 	if (arg0) if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jint)JSStringCreateWithUTF8CString((const char *)lparg0);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, JSStringCreateWithUTF8CString_FUNC);
 	return rc;
 }
@@ -9771,7 +9728,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(LSCopyDisplayNameForRef)
 	rc = (jint)LSCopyDisplayNameForRef((const FSRef *)lparg0, (CFStringRef *)lparg1);
 fail:
 	if (arg1 && lparg1) (*env)->ReleaseIntArrayElements(env, arg1, lparg1, 0);
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, LSCopyDisplayNameForRef_FUNC);
 	return rc;
 }
@@ -9790,7 +9747,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(LSCopyItemAttribute)
 	rc = (jint)LSCopyItemAttribute((const FSRef *)lparg0, (LSRolesMask)arg1, (CFStringRef)arg2, (CFTypeRef *)lparg3);
 fail:
 	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, LSCopyItemAttribute_FUNC);
 	return rc;
 }
@@ -9882,7 +9839,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(LSOpenURLsWithRole)
 	rc = (jint)LSOpenURLsWithRole((CFArrayRef)arg0, arg1, (const AEKeyDesc *)arg2, (const LSApplicationParameters *)lparg3, (ProcessSerialNumber *)lparg4, arg5);
 fail:
 	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
-	if (arg3 && lparg3) setLSApplicationParametersFields(env, arg3, lparg3);
 	OS_NATIVE_EXIT(env, that, LSOpenURLsWithRole_FUNC);
 	return rc;
 }
@@ -9981,7 +9937,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(NavCreateChooseFolderDialog)
 	rc = (jint)NavCreateChooseFolderDialog((const NavDialogCreationOptions *)lparg0, (NavEventUPP)arg1, (NavObjectFilterUPP)arg2, (void *)arg3, (NavDialogRef *)lparg4);
 fail:
 	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
-	if (arg0 && lparg0) setNavDialogCreationOptionsFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, NavCreateChooseFolderDialog_FUNC);
 	return rc;
 }
@@ -10000,7 +9955,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(NavCreateGetFileDialog)
 	rc = (jint)NavCreateGetFileDialog((const NavDialogCreationOptions *)lparg0, (NavTypeListHandle)arg1, (NavEventUPP)arg2, (NavPreviewUPP)arg3, (NavObjectFilterUPP)arg4, (void *)arg5, (NavDialogRef *)lparg6);
 fail:
 	if (arg6 && lparg6) (*env)->ReleaseIntArrayElements(env, arg6, lparg6, 0);
-	if (arg0 && lparg0) setNavDialogCreationOptionsFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, NavCreateGetFileDialog_FUNC);
 	return rc;
 }
@@ -10019,7 +9973,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(NavCreatePutFileDialog)
 	rc = (jint)NavCreatePutFileDialog((const NavDialogCreationOptions *)lparg0, (OSType)arg1, (OSType)arg2, (NavEventUPP)arg3, (void *)arg4, (NavDialogRef *)lparg5);
 fail:
 	if (arg5 && lparg5) (*env)->ReleaseIntArrayElements(env, arg5, lparg5, 0);
-	if (arg0 && lparg0) setNavDialogCreationOptionsFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, NavCreatePutFileDialog_FUNC);
 	return rc;
 }
@@ -10208,7 +10161,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(NewControl)
 	rc = (jint)NewControl((WindowRef)arg0, (const Rect *)lparg1, (ConstStr255Param)lparg2, (Boolean)arg3, (SInt16)arg4, (SInt16)arg5, (SInt16)arg6, (SInt16)arg7, (SInt32)arg8);
 fail:
 	if (arg2 && lparg2) (*env)->ReleaseByteArrayElements(env, arg2, lparg2, 0);
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, NewControl_FUNC);
 	return rc;
 }
@@ -10242,7 +10194,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(NewGWorldFromPtr)
 	if (arg2) if ((lparg2 = getRectFields(env, arg2, &_arg2)) == NULL) goto fail;
 	rc = (jint)NewGWorldFromPtr((GWorldPtr *)lparg0, (unsigned long)arg1, (const Rect *)lparg2, (CTabHandle)arg3, (GDHandle)arg4, (GWorldFlags)arg5, (Ptr)arg6, (long)arg7);
 fail:
-	if (arg2 && lparg2) setRectFields(env, arg2, lparg2);
 	if (arg0 && lparg0) (*env)->ReleaseIntArrayElements(env, arg0, lparg0, 0);
 	OS_NATIVE_EXIT(env, that, NewGWorldFromPtr_FUNC);
 	return rc;
@@ -10374,7 +10325,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(OpenPicture)
 	if (arg0) if ((lparg0 = getRectFields(env, arg0, &_arg0)) == NULL) goto fail;
 	rc = (jint)OpenPicture((const Rect *)lparg0);
 fail:
-	if (arg0 && lparg0) setRectFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, OpenPicture_FUNC);
 	return rc;
 }
@@ -10691,7 +10641,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(PMSessionBeginPageNoDialog)
 	if (arg2) if ((lparg2 = getPMRectFields(env, arg2, &_arg2)) == NULL) goto fail;
 	rc = (jint)PMSessionBeginPageNoDialog((PMPrintSession)arg0, (PMPageFormat)arg1, (const PMRect *)lparg2);
 fail:
-	if (arg2 && lparg2) setPMRectFields(env, arg2, lparg2);
 	OS_NATIVE_EXIT(env, that, PMSessionBeginPageNoDialog_FUNC);
 	return rc;
 }
@@ -11169,7 +11118,6 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(PtInRect)
 	if (arg1) if ((lparg1 = getRectFields(env, arg1, &_arg1)) == NULL) goto fail;
 	rc = (jboolean)PtInRect(*(Point *)lparg0, (const Rect *)lparg1);
 fail:
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	if (arg0 && lparg0) setPointFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, PtInRect_FUNC);
 	return rc;
@@ -11202,7 +11150,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PutScrapFlavor__IIII_3B)
 	if (arg4) if ((lparg4 = (*env)->GetByteArrayElements(env, arg4, NULL)) == NULL) goto fail;
 	rc = (jint)PutScrapFlavor((ScrapRef)arg0, (ScrapFlavorType)arg1, (ScrapFlavorFlags)arg2, (Size)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) (*env)->ReleaseByteArrayElements(env, arg4, lparg4, 0);
+	if (arg4 && lparg4) (*env)->ReleaseByteArrayElements(env, arg4, lparg4, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, PutScrapFlavor__IIII_3B_FUNC);
 	return rc;
 }
@@ -11218,7 +11166,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PutScrapFlavor__IIII_3C)
 	if (arg4) if ((lparg4 = (*env)->GetCharArrayElements(env, arg4, NULL)) == NULL) goto fail;
 	rc = (jint)PutScrapFlavor((ScrapRef)arg0, (ScrapFlavorType)arg1, (ScrapFlavorFlags)arg2, (Size)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) (*env)->ReleaseCharArrayElements(env, arg4, lparg4, 0);
+	if (arg4 && lparg4) (*env)->ReleaseCharArrayElements(env, arg4, lparg4, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, PutScrapFlavor__IIII_3C_FUNC);
 	return rc;
 }
@@ -11325,7 +11273,6 @@ JNIEXPORT void JNICALL OS_NATIVE(RGBBackColor)
 	if (arg0) if ((lparg0 = getRGBColorFields(env, arg0, &_arg0)) == NULL) goto fail;
 	RGBBackColor((const RGBColor *)lparg0);
 fail:
-	if (arg0 && lparg0) setRGBColorFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, RGBBackColor_FUNC);
 }
 #endif
@@ -11339,7 +11286,6 @@ JNIEXPORT void JNICALL OS_NATIVE(RGBForeColor)
 	if (arg0) if ((lparg0 = getRGBColorFields(env, arg0, &_arg0)) == NULL) goto fail;
 	RGBForeColor((const RGBColor *)lparg0);
 fail:
-	if (arg0 && lparg0) setRGBColorFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, RGBForeColor_FUNC);
 }
 #endif
@@ -11357,7 +11303,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ReadIconFile)
 	rc = (jint)ReadIconFile((const FSSpec *)lparg0, (IconFamilyHandle *)lparg1);
 fail:
 	if (arg1 && lparg1) (*env)->ReleaseIntArrayElements(env, arg1, lparg1, 0);
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, ReadIconFile_FUNC);
 	return rc;
 }
@@ -11376,7 +11322,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ReceiveNextEvent)
 	rc = (jint)ReceiveNextEvent((UInt32)arg0, (const EventTypeSpec *)lparg1, (EventTimeout)arg2, (Boolean)arg3, (EventRef *)lparg4);
 fail:
 	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
-	if (arg1 && lparg1) (*env)->ReleaseIntArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseIntArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, ReceiveNextEvent_FUNC);
 	return rc;
 }
@@ -11392,7 +11338,6 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(RectInRgn)
 	if (arg0) if ((lparg0 = getRectFields(env, arg0, &_arg0)) == NULL) goto fail;
 	rc = (jboolean)RectInRgn((const Rect *)lparg0, (RgnHandle)arg1);
 fail:
-	if (arg0 && lparg0) setRectFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, RectInRgn_FUNC);
 	return rc;
 }
@@ -11407,7 +11352,6 @@ JNIEXPORT void JNICALL OS_NATIVE(RectRgn)
 	if (arg1) if ((lparg1 = getRectFields(env, arg1, &_arg1)) == NULL) goto fail;
 	RectRgn((RgnHandle)arg0, (const Rect *)lparg1);
 fail:
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, RectRgn_FUNC);
 }
 #endif
@@ -11502,7 +11446,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(RemoveDataBrowserItems)
 	if (arg3) if ((lparg3 = (*env)->GetIntArrayElements(env, arg3, NULL)) == NULL) goto fail;
 	rc = (jint)RemoveDataBrowserItems((ControlRef)arg0, (DataBrowserItemID)arg1, (UInt32)arg2, (const DataBrowserItemID *)lparg3, (DataBrowserPropertyID)arg4);
 fail:
-	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
+	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, RemoveDataBrowserItems_FUNC);
 	return rc;
 }
@@ -11711,7 +11655,6 @@ JNIEXPORT void JNICALL OS_NATIVE(ScrollRect)
 	if (arg0) if ((lparg0 = getRectFields(env, arg0, &_arg0)) == NULL) goto fail;
 	ScrollRect((const Rect *)lparg0, (short)arg1, (short)arg2, (RgnHandle)arg3);
 fail:
-	if (arg0 && lparg0) setRectFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, ScrollRect_FUNC);
 }
 #endif
@@ -11937,7 +11880,6 @@ JNIEXPORT void JNICALL OS_NATIVE(SetControlBounds)
 	if (arg1) if ((lparg1 = getRectFields(env, arg1, &_arg1)) == NULL) goto fail;
 	SetControlBounds((ControlRef)arg0, (const Rect *)lparg1);
 fail:
-	if (arg1 && lparg1) setRectFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, SetControlBounds_FUNC);
 }
 #endif
@@ -11976,7 +11918,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetControlData__IIIILorg_eclipse_swt_internal_c
 	if (arg4) if ((lparg4 = getControlButtonContentInfoFields(env, arg4, &_arg4)) == NULL) goto fail;
 	rc = (jint)SetControlData((ControlRef)arg0, (ControlPartCode)arg1, (ResType)arg2, (Size)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) setControlButtonContentInfoFields(env, arg4, lparg4);
 	OS_NATIVE_EXIT(env, that, SetControlData__IIIILorg_eclipse_swt_internal_carbon_ControlButtonContentInfo_2_FUNC);
 	return rc;
 }
@@ -11992,7 +11933,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetControlData__IIIILorg_eclipse_swt_internal_c
 	if (arg4) if ((lparg4 = getControlEditTextSelectionRecFields(env, arg4, &_arg4)) == NULL) goto fail;
 	rc = (jint)SetControlData((ControlRef)arg0, (ControlPartCode)arg1, (ResType)arg2, (Size)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) setControlEditTextSelectionRecFields(env, arg4, lparg4);
 	OS_NATIVE_EXIT(env, that, SetControlData__IIIILorg_eclipse_swt_internal_carbon_ControlEditTextSelectionRec_2_FUNC);
 	return rc;
 }
@@ -12008,7 +11948,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetControlData__IIIILorg_eclipse_swt_internal_c
 	if (arg4) if ((lparg4 = getControlTabInfoRecV1Fields(env, arg4, &_arg4)) == NULL) goto fail;
 	rc = (jint)SetControlData((ControlRef)arg0, (ControlPartCode)arg1, (ResType)arg2, (Size)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) setControlTabInfoRecV1Fields(env, arg4, lparg4);
 	OS_NATIVE_EXIT(env, that, SetControlData__IIIILorg_eclipse_swt_internal_carbon_ControlTabInfoRecV1_2_FUNC);
 	return rc;
 }
@@ -12024,7 +11963,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetControlData__IIIILorg_eclipse_swt_internal_c
 	if (arg4) if ((lparg4 = getLongDateRecFields(env, arg4, &_arg4)) == NULL) goto fail;
 	rc = (jint)SetControlData((ControlRef)arg0, (ControlPartCode)arg1, (ResType)arg2, (Size)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) setLongDateRecFields(env, arg4, lparg4);
 	OS_NATIVE_EXIT(env, that, SetControlData__IIIILorg_eclipse_swt_internal_carbon_LongDateRec_2_FUNC);
 	return rc;
 }
@@ -12040,7 +11978,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetControlData__IIIILorg_eclipse_swt_internal_c
 	if (arg4) if ((lparg4 = getRectFields(env, arg4, &_arg4)) == NULL) goto fail;
 	rc = (jint)SetControlData((ControlRef)arg0, (ControlPartCode)arg1, (ResType)arg2, (Size)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) setRectFields(env, arg4, lparg4);
 	OS_NATIVE_EXIT(env, that, SetControlData__IIIILorg_eclipse_swt_internal_carbon_Rect_2_FUNC);
 	return rc;
 }
@@ -12056,7 +11993,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetControlData__IIII_3B)
 	if (arg4) if ((lparg4 = (*env)->GetByteArrayElements(env, arg4, NULL)) == NULL) goto fail;
 	rc = (jint)SetControlData((ControlRef)arg0, (ControlPartCode)arg1, (ResType)arg2, (Size)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) (*env)->ReleaseByteArrayElements(env, arg4, lparg4, 0);
+	if (arg4 && lparg4) (*env)->ReleaseByteArrayElements(env, arg4, lparg4, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, SetControlData__IIII_3B_FUNC);
 	return rc;
 }
@@ -12072,7 +12009,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetControlData__IIII_3I)
 	if (arg4) if ((lparg4 = (*env)->GetIntArrayElements(env, arg4, NULL)) == NULL) goto fail;
 	rc = (jint)SetControlData((ControlRef)arg0, (ControlPartCode)arg1, (ResType)arg2, (Size)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
+	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, SetControlData__IIII_3I_FUNC);
 	return rc;
 }
@@ -12088,7 +12025,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetControlData__IIII_3S)
 	if (arg4) if ((lparg4 = (*env)->GetShortArrayElements(env, arg4, NULL)) == NULL) goto fail;
 	rc = (jint)SetControlData((ControlRef)arg0, (ControlPartCode)arg1, (ResType)arg2, (Size)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) (*env)->ReleaseShortArrayElements(env, arg4, lparg4, 0);
+	if (arg4 && lparg4) (*env)->ReleaseShortArrayElements(env, arg4, lparg4, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, SetControlData__IIII_3S_FUNC);
 	return rc;
 }
@@ -12104,7 +12041,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetControlFontStyle)
 	if (arg1) if ((lparg1 = getControlFontStyleRecFields(env, arg1, &_arg1)) == NULL) goto fail;
 	rc = (jint)SetControlFontStyle((ControlRef)arg0, (const ControlFontStyleRec *)lparg1);
 fail:
-	if (arg1 && lparg1) setControlFontStyleRecFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, SetControlFontStyle_FUNC);
 	return rc;
 }
@@ -12130,7 +12066,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetControlProperty)
 	if (arg4) if ((lparg4 = (*env)->GetIntArrayElements(env, arg4, NULL)) == NULL) goto fail;
 	rc = (jint)SetControlProperty((ControlRef)arg0, arg1, arg2, arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
+	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, SetControlProperty_FUNC);
 	return rc;
 }
@@ -12200,7 +12136,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetDataBrowserCallbacks)
 	if (arg1) if ((lparg1 = getDataBrowserCallbacksFields(env, arg1, &_arg1)) == NULL) goto fail;
 	rc = (jint)SetDataBrowserCallbacks((ControlRef)arg0, (const DataBrowserCallbacks *)lparg1);
 fail:
-	if (arg1 && lparg1) setDataBrowserCallbacksFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, SetDataBrowserCallbacks_FUNC);
 	return rc;
 }
@@ -12368,7 +12303,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetDataBrowserSelectedItems)
 	if (arg2) if ((lparg2 = (*env)->GetIntArrayElements(env, arg2, NULL)) == NULL) goto fail;
 	rc = (jint)SetDataBrowserSelectedItems((ControlRef)arg0, (UInt32)arg1, (const DataBrowserItemID *)lparg2, (DataBrowserSetOption)arg3);
 fail:
-	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, 0);
+	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, SetDataBrowserSelectedItems_FUNC);
 	return rc;
 }
@@ -12544,7 +12479,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetDragItemFlavorData)
 	if (arg3) if ((lparg3 = (*env)->GetByteArrayElements(env, arg3, NULL)) == NULL) goto fail;
 	rc = (jint)SetDragItemFlavorData((DragRef)arg0, (DragItemRef)arg1, (FlavorType)arg2, (const void *)lparg3, (Size)arg4, (UInt32)arg5);
 fail:
-	if (arg3 && lparg3) (*env)->ReleaseByteArrayElements(env, arg3, lparg3, 0);
+	if (arg3 && lparg3) (*env)->ReleaseByteArrayElements(env, arg3, lparg3, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, SetDragItemFlavorData_FUNC);
 	return rc;
 }
@@ -12584,7 +12519,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetEventParameter__IIIILorg_eclipse_swt_interna
 	if (arg4) if ((lparg4 = getCGPointFields(env, arg4, &_arg4)) == NULL) goto fail;
 	rc = (jint)SetEventParameter((EventRef)arg0, (EventParamName)arg1, (EventParamType)arg2, (UInt32)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) setCGPointFields(env, arg4, lparg4);
 	OS_NATIVE_EXIT(env, that, SetEventParameter__IIIILorg_eclipse_swt_internal_carbon_CGPoint_2_FUNC);
 	return rc;
 }
@@ -12600,7 +12534,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetEventParameter__IIIILorg_eclipse_swt_interna
 	if (arg4) if ((lparg4 = getHICommandFields(env, arg4, &_arg4)) == NULL) goto fail;
 	rc = (jint)SetEventParameter((EventRef)arg0, (EventParamName)arg1, (EventParamType)arg2, (UInt32)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) setHICommandFields(env, arg4, lparg4);
 	OS_NATIVE_EXIT(env, that, SetEventParameter__IIIILorg_eclipse_swt_internal_carbon_HICommand_2_FUNC);
 	return rc;
 }
@@ -12616,7 +12549,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetEventParameter__IIIILorg_eclipse_swt_interna
 	if (arg4) if ((lparg4 = getPointFields(env, arg4, &_arg4)) == NULL) goto fail;
 	rc = (jint)SetEventParameter((EventRef)arg0, (EventParamName)arg1, (EventParamType)arg2, (UInt32)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) setPointFields(env, arg4, lparg4);
 	OS_NATIVE_EXIT(env, that, SetEventParameter__IIIILorg_eclipse_swt_internal_carbon_Point_2_FUNC);
 	return rc;
 }
@@ -12632,7 +12564,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetEventParameter__IIII_3C)
 	if (arg4) if ((lparg4 = (*env)->GetCharArrayElements(env, arg4, NULL)) == NULL) goto fail;
 	rc = (jint)SetEventParameter((EventRef)arg0, (EventParamName)arg1, (EventParamType)arg2, (UInt32)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) (*env)->ReleaseCharArrayElements(env, arg4, lparg4, 0);
+	if (arg4 && lparg4) (*env)->ReleaseCharArrayElements(env, arg4, lparg4, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, SetEventParameter__IIII_3C_FUNC);
 	return rc;
 }
@@ -12648,7 +12580,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetEventParameter__IIII_3I)
 	if (arg4) if ((lparg4 = (*env)->GetIntArrayElements(env, arg4, NULL)) == NULL) goto fail;
 	rc = (jint)SetEventParameter((EventRef)arg0, (EventParamName)arg1, (EventParamType)arg2, (UInt32)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
+	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, SetEventParameter__IIII_3I_FUNC);
 	return rc;
 }
@@ -12664,7 +12596,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetEventParameter__IIII_3S)
 	if (arg4) if ((lparg4 = (*env)->GetShortArrayElements(env, arg4, NULL)) == NULL) goto fail;
 	rc = (jint)SetEventParameter((EventRef)arg0, (EventParamName)arg1, (EventParamType)arg2, (UInt32)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) (*env)->ReleaseShortArrayElements(env, arg4, lparg4, 0);
+	if (arg4 && lparg4) (*env)->ReleaseShortArrayElements(env, arg4, lparg4, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, SetEventParameter__IIII_3S_FUNC);
 	return rc;
 }
@@ -12680,7 +12612,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetEventParameter__IIII_3Z)
 	if (arg4) if ((lparg4 = (*env)->GetBooleanArrayElements(env, arg4, NULL)) == NULL) goto fail;
 	rc = (jint)SetEventParameter((EventRef)arg0, (EventParamName)arg1, (EventParamType)arg2, (UInt32)arg3, (const void *)lparg4);
 fail:
-	if (arg4 && lparg4) (*env)->ReleaseBooleanArrayElements(env, arg4, lparg4, 0);
+	if (arg4 && lparg4) (*env)->ReleaseBooleanArrayElements(env, arg4, lparg4, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, SetEventParameter__IIII_3Z_FUNC);
 	return rc;
 }
@@ -12708,7 +12640,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetFrontProcess)
 	if (arg0) if ((lparg0 = (*env)->GetIntArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jint)SetFrontProcess((const ProcessSerialNumber *)lparg0);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseIntArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseIntArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, SetFrontProcess_FUNC);
 	return rc;
 }
@@ -12724,7 +12656,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetFrontProcessWithOptions)
 	if (arg0) if ((lparg0 = (*env)->GetIntArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jint)SetFrontProcessWithOptions((const ProcessSerialNumber *)lparg0, arg1);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseIntArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseIntArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, SetFrontProcessWithOptions_FUNC);
 	return rc;
 }
@@ -13408,7 +13340,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TXNGetTXNObjectControls)
 	rc = (jint)TXNGetTXNObjectControls((TXNObject)arg0, (ItemCount)arg1, (const TXNControlTag *)lparg2, (TXNControlData *)lparg3);
 fail:
 	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
-	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, 0);
+	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, TXNGetTXNObjectControls_FUNC);
 	return rc;
 }
@@ -13507,7 +13439,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(TXNSetBackground)
 	if (arg1) if ((lparg1 = getTXNBackgroundFields(env, arg1, &_arg1)) == NULL) goto fail;
 	rc = (jint)TXNSetBackground((TXNObject)arg0, (const TXNBackground *)lparg1);
 fail:
-	if (arg1 && lparg1) setTXNBackgroundFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, TXNSetBackground_FUNC);
 	return rc;
 }
@@ -13523,7 +13454,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TXNSetData)
 	if (arg2) if ((lparg2 = (*env)->GetCharArrayElements(env, arg2, NULL)) == NULL) goto fail;
 	rc = (jint)TXNSetData((TXNObject)arg0, (TXNDataType)arg1, (const void *)lparg2, (ByteCount)arg3, (TXNOffset)arg4, (TXNOffset)arg5);
 fail:
-	if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, 0);
+	if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, TXNSetData_FUNC);
 	return rc;
 }
@@ -13563,8 +13494,8 @@ JNIEXPORT jint JNICALL OS_NATIVE(TXNSetTXNObjectControls)
 	if (arg4) if ((lparg4 = (*env)->GetIntArrayElements(env, arg4, NULL)) == NULL) goto fail;
 	rc = (jint)TXNSetTXNObjectControls((TXNObject)arg0, (Boolean)arg1, (ItemCount)arg2, (const TXNControlTag *)lparg3, (const TXNControlData *)lparg4);
 fail:
-	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
-	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
+	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, JNI_ABORT);
+	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, TXNSetTXNObjectControls_FUNC);
 	return rc;
 }
@@ -13632,7 +13563,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(TrackDrag)
 	if (arg1) if ((lparg1 = getEventRecordFields(env, arg1, &_arg1)) == NULL) goto fail;
 	rc = (jint)TrackDrag((DragRef)arg0, (const EventRecord *)lparg1, (RgnHandle)arg2);
 fail:
-	if (arg1 && lparg1) setEventRecordFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, TrackDrag_FUNC);
 	return rc;
 }
@@ -13768,7 +13698,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(UpdateDataBrowserItems)
 	if (arg3) if ((lparg3 = (*env)->GetIntArrayElements(env, arg3, NULL)) == NULL) goto fail;
 	rc = (jint)UpdateDataBrowserItems((ControlRef)arg0, (DataBrowserItemID)arg1, (UInt32)arg2, (const DataBrowserItemID *)lparg3, (DataBrowserPropertyID)arg4, (DataBrowserPropertyID)arg5);
 fail:
-	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
+	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, UpdateDataBrowserItems_FUNC);
 	return rc;
 }
@@ -13,8 +13,9 @@
 extern int OS_nativeFunctionCount;
 extern int OS_nativeFunctionCallCount[];
 extern char* OS_nativeFunctionNames[];
-#define OS_NATIVE_ENTER(env, that, func) OS_nativeFunctionCallCount[func]++;
-#define OS_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS OS_nativeStats;
+#define OS_NATIVE_ENTER(env, that, func) nativeStatsEnter(&OS_nativeStats, func);
+#define OS_NATIVE_EXIT(env, that, func) nativeStatsExit(&OS_nativeStats, func);
 #else
 #ifndef OS_NATIVE_ENTER
 #define OS_NATIVE_ENTER(env, that, func) 
@@ -18,7 +18,7 @@
 #endif
 
 #ifndef NO_ATSFontActivateFromFileReference
-JNIEXPORT jint JNICALL OS_NATIVE(ATSFontActivateFromFileReference)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ATSFontActivateFromFileReference)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jintLong arg3, jint arg4, jintLongArray arg5)
 {
 	jbyte *lparg0=NULL;
@@ -38,14 +38,14 @@ JNIEXPORT jint JNICALL OS_NATIVE(ATSFontActivateFromFileReference)
 	}
 fail:
 	if (arg5 && lparg5) (*env)->ReleaseIntLongArrayElements(env, arg5, lparg5, 0);
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, ATSFontActivateFromFileReference_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_AcquireRootMenu
-JNIEXPORT jintLong JNICALL OS_NATIVE(AcquireRootMenu)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(AcquireRootMenu)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -81,7 +81,7 @@ static jintLong CALLBACK_NSTextAttachmentCell_cellSize(jintLong func) {
 	CALLBACK_1NSTextAttachmentCell_1cellSize = func;
 	return (jintLong)proc_CALLBACK_1NSTextAttachmentCell_1cellSize;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1NSTextAttachmentCell_1cellSize)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1NSTextAttachmentCell_1cellSize)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -101,7 +101,7 @@ static jintLong CALLBACK_accessibilityHitTest_(jintLong func) {
 	CALLBACK_1accessibilityHitTest_1 = func;
 	return (jintLong)proc_CALLBACK_1accessibilityHitTest_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1accessibilityHitTest_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1accessibilityHitTest_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -121,7 +121,7 @@ static jintLong CALLBACK_attributedSubstringFromRange_(jintLong func) {
 	CALLBACK_1attributedSubstringFromRange_1 = func;
 	return (jintLong)proc_CALLBACK_1attributedSubstringFromRange_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1attributedSubstringFromRange_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1attributedSubstringFromRange_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -141,7 +141,7 @@ static jintLong CALLBACK_canDragRowsWithIndexes_atPoint_(jintLong func) {
 	CALLBACK_1canDragRowsWithIndexes_1atPoint_1 = func;
 	return (jintLong)proc_CALLBACK_1canDragRowsWithIndexes_1atPoint_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1canDragRowsWithIndexes_1atPoint_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1canDragRowsWithIndexes_1atPoint_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -169,7 +169,7 @@ static jintLong CALLBACK_cellBaselineOffset(jintLong func) {
 	CALLBACK_1cellBaselineOffset = func;
 	return (jintLong)proc_CALLBACK_1cellBaselineOffset;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1cellBaselineOffset)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1cellBaselineOffset)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -197,7 +197,7 @@ static jintLong CALLBACK_cellSize(jintLong func) {
 	CALLBACK_1cellSize = func;
 	return (jintLong)proc_CALLBACK_1cellSize;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1cellSize)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1cellSize)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -225,7 +225,7 @@ static jintLong CALLBACK_cellSizeForBounds_(jintLong func) {
 	CALLBACK_1cellSizeForBounds_1 = func;
 	return (jintLong)proc_CALLBACK_1cellSizeForBounds_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1cellSizeForBounds_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1cellSizeForBounds_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -245,7 +245,7 @@ static jintLong CALLBACK_characterIndexForPoint_(jintLong func) {
 	CALLBACK_1characterIndexForPoint_1 = func;
 	return (jintLong)proc_CALLBACK_1characterIndexForPoint_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1characterIndexForPoint_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1characterIndexForPoint_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -265,7 +265,7 @@ static jintLong CALLBACK_columnAtPoint_(jintLong func) {
 	CALLBACK_1columnAtPoint_1 = func;
 	return (jintLong)proc_CALLBACK_1columnAtPoint_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1columnAtPoint_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1columnAtPoint_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -285,7 +285,7 @@ static jintLong CALLBACK_dragSelectionWithEvent_offset_slideBack_(jintLong func)
 	CALLBACK_1dragSelectionWithEvent_1offset_1slideBack_1 = func;
 	return (jintLong)proc_CALLBACK_1dragSelectionWithEvent_1offset_1slideBack_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1dragSelectionWithEvent_1offset_1slideBack_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1dragSelectionWithEvent_1offset_1slideBack_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -305,7 +305,7 @@ static jintLong CALLBACK_draggedImage_beganAt_(jintLong func) {
 	CALLBACK_1draggedImage_1beganAt_1 = func;
 	return (jintLong)proc_CALLBACK_1draggedImage_1beganAt_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1draggedImage_1beganAt_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1draggedImage_1beganAt_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -325,7 +325,7 @@ static jintLong CALLBACK_draggedImage_endedAt_operation_(jintLong func) {
 	CALLBACK_1draggedImage_1endedAt_1operation_1 = func;
 	return (jintLong)proc_CALLBACK_1draggedImage_1endedAt_1operation_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1draggedImage_1endedAt_1operation_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1draggedImage_1endedAt_1operation_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -345,7 +345,7 @@ static jintLong CALLBACK_drawBackgroundInClipRect_(jintLong func) {
 	CALLBACK_1drawBackgroundInClipRect_1 = func;
 	return (jintLong)proc_CALLBACK_1drawBackgroundInClipRect_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawBackgroundInClipRect_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawBackgroundInClipRect_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -365,7 +365,7 @@ static jintLong CALLBACK_drawImage_withFrame_inView_(jintLong func) {
 	CALLBACK_1drawImage_1withFrame_1inView_1 = func;
 	return (jintLong)proc_CALLBACK_1drawImage_1withFrame_1inView_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawImage_1withFrame_1inView_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawImage_1withFrame_1inView_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -385,7 +385,7 @@ static jintLong CALLBACK_drawInteriorWithFrame_inView_(jintLong func) {
 	CALLBACK_1drawInteriorWithFrame_1inView_1 = func;
 	return (jintLong)proc_CALLBACK_1drawInteriorWithFrame_1inView_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawInteriorWithFrame_1inView_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawInteriorWithFrame_1inView_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -405,7 +405,7 @@ static jintLong CALLBACK_drawLabel_inRect_(jintLong func) {
 	CALLBACK_1drawLabel_1inRect_1 = func;
 	return (jintLong)proc_CALLBACK_1drawLabel_1inRect_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawLabel_1inRect_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawLabel_1inRect_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -425,7 +425,7 @@ static jintLong CALLBACK_drawRect_(jintLong func) {
 	CALLBACK_1drawRect_1 = func;
 	return (jintLong)proc_CALLBACK_1drawRect_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawRect_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawRect_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -453,7 +453,7 @@ static jintLong CALLBACK_drawTitle_withFrame_inView_(jintLong func) {
 	CALLBACK_1drawTitle_1withFrame_1inView_1 = func;
 	return (jintLong)proc_CALLBACK_1drawTitle_1withFrame_1inView_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawTitle_1withFrame_1inView_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawTitle_1withFrame_1inView_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -473,7 +473,7 @@ static jintLong CALLBACK_drawViewBackgroundInRect_(jintLong func) {
 	CALLBACK_1drawViewBackgroundInRect_1 = func;
 	return (jintLong)proc_CALLBACK_1drawViewBackgroundInRect_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawViewBackgroundInRect_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawViewBackgroundInRect_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -493,7 +493,7 @@ static jintLong CALLBACK_drawWithExpansionFrame_inView_(jintLong func) {
 	CALLBACK_1drawWithExpansionFrame_1inView_1 = func;
 	return (jintLong)proc_CALLBACK_1drawWithExpansionFrame_1inView_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawWithExpansionFrame_1inView_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1drawWithExpansionFrame_1inView_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -521,7 +521,7 @@ static jintLong CALLBACK_expansionFrameWithFrame_inView_(jintLong func) {
 	CALLBACK_1expansionFrameWithFrame_1inView_1 = func;
 	return (jintLong)proc_CALLBACK_1expansionFrameWithFrame_1inView_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1expansionFrameWithFrame_1inView_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1expansionFrameWithFrame_1inView_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -549,7 +549,7 @@ static jintLong CALLBACK_firstRectForCharacterRange_(jintLong func) {
 	CALLBACK_1firstRectForCharacterRange_1 = func;
 	return (jintLong)proc_CALLBACK_1firstRectForCharacterRange_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1firstRectForCharacterRange_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1firstRectForCharacterRange_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -577,7 +577,7 @@ static jintLong CALLBACK_headerRectOfColumn_(jintLong func) {
 	CALLBACK_1headerRectOfColumn_1 = func;
 	return (jintLong)proc_CALLBACK_1headerRectOfColumn_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1headerRectOfColumn_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1headerRectOfColumn_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -597,7 +597,7 @@ static jintLong CALLBACK_highlightSelectionInClipRect_(jintLong func) {
 	CALLBACK_1highlightSelectionInClipRect_1 = func;
 	return (jintLong)proc_CALLBACK_1highlightSelectionInClipRect_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1highlightSelectionInClipRect_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1highlightSelectionInClipRect_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -617,7 +617,7 @@ static jintLong CALLBACK_hitTestForEvent_inRect_ofView_(jintLong func) {
 	CALLBACK_1hitTestForEvent_1inRect_1ofView_1 = func;
 	return (jintLong)proc_CALLBACK_1hitTestForEvent_1inRect_1ofView_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1hitTestForEvent_1inRect_1ofView_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1hitTestForEvent_1inRect_1ofView_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -637,7 +637,7 @@ static jintLong CALLBACK_hitTest_(jintLong func) {
 	CALLBACK_1hitTest_1 = func;
 	return (jintLong)proc_CALLBACK_1hitTest_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1hitTest_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1hitTest_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -665,7 +665,7 @@ static jintLong CALLBACK_imageRectForBounds_(jintLong func) {
 	CALLBACK_1imageRectForBounds_1 = func;
 	return (jintLong)proc_CALLBACK_1imageRectForBounds_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1imageRectForBounds_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1imageRectForBounds_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -693,7 +693,7 @@ static jintLong CALLBACK_markedRange(jintLong func) {
 	CALLBACK_1markedRange = func;
 	return (jintLong)proc_CALLBACK_1markedRange;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1markedRange)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1markedRange)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -713,7 +713,7 @@ static jintLong CALLBACK_scrollClipView_toPoint_(jintLong func) {
 	CALLBACK_1scrollClipView_1toPoint_1 = func;
 	return (jintLong)proc_CALLBACK_1scrollClipView_1toPoint_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1scrollClipView_1toPoint_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1scrollClipView_1toPoint_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -741,7 +741,7 @@ static jintLong CALLBACK_selectedRange(jintLong func) {
 	CALLBACK_1selectedRange = func;
 	return (jintLong)proc_CALLBACK_1selectedRange;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1selectedRange)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1selectedRange)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -761,7 +761,7 @@ static jintLong CALLBACK_setFrameOrigin_(jintLong func) {
 	CALLBACK_1setFrameOrigin_1 = func;
 	return (jintLong)proc_CALLBACK_1setFrameOrigin_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1setFrameOrigin_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1setFrameOrigin_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -781,7 +781,7 @@ static jintLong CALLBACK_setFrameSize_(jintLong func) {
 	CALLBACK_1setFrameSize_1 = func;
 	return (jintLong)proc_CALLBACK_1setFrameSize_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1setFrameSize_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1setFrameSize_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -801,7 +801,7 @@ static jintLong CALLBACK_setFrame_(jintLong func) {
 	CALLBACK_1setFrame_1 = func;
 	return (jintLong)proc_CALLBACK_1setFrame_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1setFrame_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1setFrame_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -821,7 +821,7 @@ static jintLong CALLBACK_setMarkedText_selectedRange_(jintLong func) {
 	CALLBACK_1setMarkedText_1selectedRange_1 = func;
 	return (jintLong)proc_CALLBACK_1setMarkedText_1selectedRange_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1setMarkedText_1selectedRange_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1setMarkedText_1selectedRange_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -841,7 +841,7 @@ static jintLong CALLBACK_setNeedsDisplayInRect_(jintLong func) {
 	CALLBACK_1setNeedsDisplayInRect_1 = func;
 	return (jintLong)proc_CALLBACK_1setNeedsDisplayInRect_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1setNeedsDisplayInRect_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1setNeedsDisplayInRect_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -861,7 +861,7 @@ static jintLong CALLBACK_shouldChangeTextInRange_replacementString_(jintLong fun
 	CALLBACK_1shouldChangeTextInRange_1replacementString_1 = func;
 	return (jintLong)proc_CALLBACK_1shouldChangeTextInRange_1replacementString_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1shouldChangeTextInRange_1replacementString_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1shouldChangeTextInRange_1replacementString_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -889,7 +889,7 @@ static jintLong CALLBACK_sizeOfLabel_(jintLong func) {
 	CALLBACK_1sizeOfLabel_1 = func;
 	return (jintLong)proc_CALLBACK_1sizeOfLabel_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1sizeOfLabel_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1sizeOfLabel_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -917,7 +917,7 @@ static jintLong CALLBACK_textView_willChangeSelectionFromCharacterRange_toCharac
 	CALLBACK_1textView_1willChangeSelectionFromCharacterRange_1toCharacterRange_1 = func;
 	return (jintLong)proc_CALLBACK_1textView_1willChangeSelectionFromCharacterRange_1toCharacterRange_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1textView_1willChangeSelectionFromCharacterRange_1toCharacterRange_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1textView_1willChangeSelectionFromCharacterRange_1toCharacterRange_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -945,7 +945,7 @@ static jintLong CALLBACK_titleRectForBounds_(jintLong func) {
 	CALLBACK_1titleRectForBounds_1 = func;
 	return (jintLong)proc_CALLBACK_1titleRectForBounds_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1titleRectForBounds_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1titleRectForBounds_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -965,7 +965,7 @@ static jintLong CALLBACK_view_stringForToolTip_point_userData_(jintLong func) {
 	CALLBACK_1view_1stringForToolTip_1point_1userData_1 = func;
 	return (jintLong)proc_CALLBACK_1view_1stringForToolTip_1point_1userData_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1view_1stringForToolTip_1point_1userData_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1view_1stringForToolTip_1point_1userData_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -985,7 +985,7 @@ static jintLong CALLBACK_webView_setFrame_(jintLong func) {
 	CALLBACK_1webView_1setFrame_1 = func;
 	return (jintLong)proc_CALLBACK_1webView_1setFrame_1;
 }
-JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1webView_1setFrame_1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1webView_1setFrame_1)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -997,7 +997,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CALLBACK_1webView_1setFrame_1)
 #endif
 
 #ifndef NO_CFAttributedStringCreate
-JNIEXPORT jintLong JNICALL OS_NATIVE(CFAttributedStringCreate)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CFAttributedStringCreate)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 {
 	jintLong rc = 0;
@@ -1009,7 +1009,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CFAttributedStringCreate)
 #endif
 
 #ifndef NO_CFDataGetBytePtr
-JNIEXPORT jintLong JNICALL OS_NATIVE(CFDataGetBytePtr)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CFDataGetBytePtr)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -1021,7 +1021,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CFDataGetBytePtr)
 #endif
 
 #ifndef NO_CFDataGetLength
-JNIEXPORT jintLong JNICALL OS_NATIVE(CFDataGetLength)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CFDataGetLength)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -1033,7 +1033,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CFDataGetLength)
 #endif
 
 #ifndef NO_CFDictionaryAddValue
-JNIEXPORT void JNICALL OS_NATIVE(CFDictionaryAddValue)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CFDictionaryAddValue)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 {
 	OS_NATIVE_ENTER(env, that, CFDictionaryAddValue_FUNC);
@@ -1043,7 +1043,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CFDictionaryAddValue)
 #endif
 
 #ifndef NO_CFDictionaryCreateMutable
-JNIEXPORT jintLong JNICALL OS_NATIVE(CFDictionaryCreateMutable)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CFDictionaryCreateMutable)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 {
 	jintLong rc = 0;
@@ -1055,7 +1055,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CFDictionaryCreateMutable)
 #endif
 
 #ifndef NO_CFRange_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CFRange_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CFRange_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -1067,7 +1067,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CFRange_1sizeof)
 #endif
 
 #ifndef NO_CFRelease
-JNIEXPORT void JNICALL OS_NATIVE(CFRelease)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CFRelease)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CFRelease_FUNC);
@@ -1077,7 +1077,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CFRelease)
 #endif
 
 #ifndef NO_CFRunLoopAddObserver
-JNIEXPORT void JNICALL OS_NATIVE(CFRunLoopAddObserver)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CFRunLoopAddObserver)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 {
 	OS_NATIVE_ENTER(env, that, CFRunLoopAddObserver_FUNC);
@@ -1087,7 +1087,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CFRunLoopAddObserver)
 #endif
 
 #ifndef NO_CFRunLoopGetCurrent
-JNIEXPORT jintLong JNICALL OS_NATIVE(CFRunLoopGetCurrent)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CFRunLoopGetCurrent)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -1099,7 +1099,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CFRunLoopGetCurrent)
 #endif
 
 #ifndef NO_CFRunLoopObserverCreate
-JNIEXPORT jintLong JNICALL OS_NATIVE(CFRunLoopObserverCreate)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CFRunLoopObserverCreate)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2, jintLong arg3, jintLong arg4, jintLong arg5)
 {
 	jintLong rc = 0;
@@ -1111,7 +1111,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CFRunLoopObserverCreate)
 #endif
 
 #ifndef NO_CFRunLoopObserverInvalidate
-JNIEXPORT void JNICALL OS_NATIVE(CFRunLoopObserverInvalidate)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CFRunLoopObserverInvalidate)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CFRunLoopObserverInvalidate_FUNC);
@@ -1121,7 +1121,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CFRunLoopObserverInvalidate)
 #endif
 
 #ifndef NO_CFRunLoopRunInMode
-JNIEXPORT jint JNICALL OS_NATIVE(CFRunLoopRunInMode)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CFRunLoopRunInMode)
 	(JNIEnv *env, jclass that, jintLong arg0, jdouble arg1, jboolean arg2)
 {
 	jint rc = 0;
@@ -1133,7 +1133,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CFRunLoopRunInMode)
 #endif
 
 #ifndef NO_CFRunLoopStop
-JNIEXPORT void JNICALL OS_NATIVE(CFRunLoopStop)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CFRunLoopStop)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CFRunLoopStop_FUNC);
@@ -1143,7 +1143,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CFRunLoopStop)
 #endif
 
 #ifndef NO_CFStringCreateWithCharacters
-JNIEXPORT jintLong JNICALL OS_NATIVE(CFStringCreateWithCharacters)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CFStringCreateWithCharacters)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jintLong arg2)
 {
 	jchar *lparg1=NULL;
@@ -1159,7 +1159,7 @@ fail:
 #endif
 
 #ifndef NO_CFURLCreateFromFSRef
-JNIEXPORT jintLong JNICALL OS_NATIVE(CFURLCreateFromFSRef)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CFURLCreateFromFSRef)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1)
 {
 	jbyte *lparg1=NULL;
@@ -1175,7 +1175,7 @@ fail:
 #endif
 
 #ifndef NO_CFURLCreateStringByAddingPercentEscapes
-JNIEXPORT jintLong JNICALL OS_NATIVE(CFURLCreateStringByAddingPercentEscapes)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CFURLCreateStringByAddingPercentEscapes)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jint arg4)
 {
 	jintLong rc = 0;
@@ -1187,7 +1187,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CFURLCreateStringByAddingPercentEscapes)
 #endif
 
 #ifndef NO_CGAffineTransform_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CGAffineTransform_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CGAffineTransform_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -1199,7 +1199,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CGAffineTransform_1sizeof)
 #endif
 
 #ifndef NO_CGBitmapContextCreate
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGBitmapContextCreate)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGBitmapContextCreate)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jint arg6)
 {
 	jintLong rc = 0;
@@ -1211,7 +1211,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGBitmapContextCreate)
 #endif
 
 #ifndef NO_CGBitmapContextCreateImage
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGBitmapContextCreateImage)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGBitmapContextCreateImage)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -1223,7 +1223,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGBitmapContextCreateImage)
 #endif
 
 #ifndef NO_CGBitmapContextGetData
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGBitmapContextGetData)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGBitmapContextGetData)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -1235,7 +1235,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGBitmapContextGetData)
 #endif
 
 #ifndef NO_CGColorCreate
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGColorCreate)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGColorCreate)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloatDoubleArray arg1)
 {
 	jfloatDouble *lparg1=NULL;
@@ -1251,7 +1251,7 @@ fail:
 #endif
 
 #ifndef NO_CGColorRelease
-JNIEXPORT void JNICALL OS_NATIVE(CGColorRelease)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGColorRelease)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CGColorRelease_FUNC);
@@ -1261,7 +1261,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGColorRelease)
 #endif
 
 #ifndef NO_CGColorSpaceCreateDeviceRGB
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGColorSpaceCreateDeviceRGB)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGColorSpaceCreateDeviceRGB)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -1273,7 +1273,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGColorSpaceCreateDeviceRGB)
 #endif
 
 #ifndef NO_CGColorSpaceRelease
-JNIEXPORT void JNICALL OS_NATIVE(CGColorSpaceRelease)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGColorSpaceRelease)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CGColorSpaceRelease_FUNC);
@@ -1283,7 +1283,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGColorSpaceRelease)
 #endif
 
 #ifndef NO_CGContextAddPath
-JNIEXPORT void JNICALL OS_NATIVE(CGContextAddPath)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextAddPath)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	OS_NATIVE_ENTER(env, that, CGContextAddPath_FUNC);
@@ -1293,7 +1293,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextAddPath)
 #endif
 
 #ifndef NO_CGContextBeginTransparencyLayerWithRect
-JNIEXPORT void JNICALL OS_NATIVE(CGContextBeginTransparencyLayerWithRect)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextBeginTransparencyLayerWithRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 {
 	CGRect _arg1, *lparg1=NULL;
@@ -1307,7 +1307,7 @@ fail:
 #endif
 
 #ifndef NO_CGContextCopyPath
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGContextCopyPath)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGContextCopyPath)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -1327,7 +1327,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGContextCopyPath)
 #endif
 
 #ifndef NO_CGContextCopyWindowContentsToRect
-JNIEXPORT void JNICALL OS_NATIVE(CGContextCopyWindowContentsToRect)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextCopyWindowContentsToRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2, jintLong arg3, jobject arg4)
 {
 	CGRect _arg1, *lparg1=NULL;
@@ -1352,7 +1352,7 @@ fail:
 #endif
 
 #ifndef NO_CGContextDrawImage
-JNIEXPORT void JNICALL OS_NATIVE(CGContextDrawImage)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextDrawImage)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 {
 	CGRect _arg1, *lparg1=NULL;
@@ -1366,7 +1366,7 @@ fail:
 #endif
 
 #ifndef NO_CGContextEndTransparencyLayer
-JNIEXPORT void JNICALL OS_NATIVE(CGContextEndTransparencyLayer)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextEndTransparencyLayer)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CGContextEndTransparencyLayer_FUNC);
@@ -1376,7 +1376,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextEndTransparencyLayer)
 #endif
 
 #ifndef NO_CGContextFillRect
-JNIEXPORT void JNICALL OS_NATIVE(CGContextFillRect)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextFillRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	CGRect _arg1, *lparg1=NULL;
@@ -1390,7 +1390,7 @@ fail:
 #endif
 
 #ifndef NO_CGContextRelease
-JNIEXPORT void JNICALL OS_NATIVE(CGContextRelease)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextRelease)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CGContextRelease_FUNC);
@@ -1400,7 +1400,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextRelease)
 #endif
 
 #ifndef NO_CGContextReplacePathWithStrokedPath
-JNIEXPORT void JNICALL OS_NATIVE(CGContextReplacePathWithStrokedPath)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextReplacePathWithStrokedPath)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CGContextReplacePathWithStrokedPath_FUNC);
@@ -1410,7 +1410,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextReplacePathWithStrokedPath)
 #endif
 
 #ifndef NO_CGContextRestoreGState
-JNIEXPORT void JNICALL OS_NATIVE(CGContextRestoreGState)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextRestoreGState)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CGContextRestoreGState_FUNC);
@@ -1420,7 +1420,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextRestoreGState)
 #endif
 
 #ifndef NO_CGContextSaveGState
-JNIEXPORT void JNICALL OS_NATIVE(CGContextSaveGState)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextSaveGState)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CGContextSaveGState_FUNC);
@@ -1430,7 +1430,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextSaveGState)
 #endif
 
 #ifndef NO_CGContextScaleCTM
-JNIEXPORT void JNICALL OS_NATIVE(CGContextScaleCTM)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextScaleCTM)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloatDouble arg1, jfloatDouble arg2)
 {
 	OS_NATIVE_ENTER(env, that, CGContextScaleCTM_FUNC);
@@ -1440,7 +1440,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextScaleCTM)
 #endif
 
 #ifndef NO_CGContextSetBlendMode
-JNIEXPORT void JNICALL OS_NATIVE(CGContextSetBlendMode)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextSetBlendMode)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, CGContextSetBlendMode_FUNC);
@@ -1450,7 +1450,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextSetBlendMode)
 #endif
 
 #ifndef NO_CGContextSetFillColor
-JNIEXPORT void JNICALL OS_NATIVE(CGContextSetFillColor)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextSetFillColor)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloatDoubleArray arg1)
 {
 	jfloatDouble *lparg1=NULL;
@@ -1464,7 +1464,7 @@ fail:
 #endif
 
 #ifndef NO_CGContextSetFillColorSpace
-JNIEXPORT void JNICALL OS_NATIVE(CGContextSetFillColorSpace)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextSetFillColorSpace)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	OS_NATIVE_ENTER(env, that, CGContextSetFillColorSpace_FUNC);
@@ -1474,7 +1474,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextSetFillColorSpace)
 #endif
 
 #ifndef NO_CGContextSetLineCap
-JNIEXPORT void JNICALL OS_NATIVE(CGContextSetLineCap)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextSetLineCap)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, CGContextSetLineCap_FUNC);
@@ -1484,7 +1484,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextSetLineCap)
 #endif
 
 #ifndef NO_CGContextSetLineDash
-JNIEXPORT void JNICALL OS_NATIVE(CGContextSetLineDash)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextSetLineDash)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloatDouble arg1, jfloatArray arg2, jintLong arg3)
 {
 	jfloat *lparg2=NULL;
@@ -1498,7 +1498,7 @@ fail:
 #endif
 
 #ifndef NO_CGContextSetLineJoin
-JNIEXPORT void JNICALL OS_NATIVE(CGContextSetLineJoin)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextSetLineJoin)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, CGContextSetLineJoin_FUNC);
@@ -1508,7 +1508,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextSetLineJoin)
 #endif
 
 #ifndef NO_CGContextSetLineWidth
-JNIEXPORT void JNICALL OS_NATIVE(CGContextSetLineWidth)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextSetLineWidth)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloatDouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, CGContextSetLineWidth_FUNC);
@@ -1518,7 +1518,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextSetLineWidth)
 #endif
 
 #ifndef NO_CGContextSetMiterLimit
-JNIEXPORT void JNICALL OS_NATIVE(CGContextSetMiterLimit)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextSetMiterLimit)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloatDouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, CGContextSetMiterLimit_FUNC);
@@ -1528,7 +1528,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextSetMiterLimit)
 #endif
 
 #ifndef NO_CGContextSetShouldAntialias
-JNIEXPORT void JNICALL OS_NATIVE(CGContextSetShouldAntialias)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextSetShouldAntialias)
 	(JNIEnv *env, jclass that, jintLong arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, CGContextSetShouldAntialias_FUNC);
@@ -1538,7 +1538,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextSetShouldAntialias)
 #endif
 
 #ifndef NO_CGContextSetTextDrawingMode
-JNIEXPORT void JNICALL OS_NATIVE(CGContextSetTextDrawingMode)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextSetTextDrawingMode)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, CGContextSetTextDrawingMode_FUNC);
@@ -1548,7 +1548,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextSetTextDrawingMode)
 #endif
 
 #ifndef NO_CGContextSetTextMatrix
-JNIEXPORT void JNICALL OS_NATIVE(CGContextSetTextMatrix)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextSetTextMatrix)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	CGAffineTransform _arg1, *lparg1=NULL;
@@ -1562,7 +1562,7 @@ fail:
 #endif
 
 #ifndef NO_CGContextSetTextPosition
-JNIEXPORT void JNICALL OS_NATIVE(CGContextSetTextPosition)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextSetTextPosition)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloatDouble arg1, jfloatDouble arg2)
 {
 	OS_NATIVE_ENTER(env, that, CGContextSetTextPosition_FUNC);
@@ -1572,7 +1572,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextSetTextPosition)
 #endif
 
 #ifndef NO_CGContextStrokePath
-JNIEXPORT void JNICALL OS_NATIVE(CGContextStrokePath)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextStrokePath)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CGContextStrokePath_FUNC);
@@ -1582,7 +1582,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextStrokePath)
 #endif
 
 #ifndef NO_CGContextTranslateCTM
-JNIEXPORT void JNICALL OS_NATIVE(CGContextTranslateCTM)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGContextTranslateCTM)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloatDouble arg1, jfloatDouble arg2)
 {
 	OS_NATIVE_ENTER(env, that, CGContextTranslateCTM_FUNC);
@@ -1592,7 +1592,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGContextTranslateCTM)
 #endif
 
 #ifndef NO_CGDataProviderCreateWithData
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGDataProviderCreateWithData)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGDataProviderCreateWithData)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 {
 	jintLong rc = 0;
@@ -1604,7 +1604,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGDataProviderCreateWithData)
 #endif
 
 #ifndef NO_CGDataProviderRelease
-JNIEXPORT void JNICALL OS_NATIVE(CGDataProviderRelease)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGDataProviderRelease)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CGDataProviderRelease_FUNC);
@@ -1614,7 +1614,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGDataProviderRelease)
 #endif
 
 #ifndef NO_CGDisplayBaseAddress
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGDisplayBaseAddress)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGDisplayBaseAddress)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -1634,7 +1634,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGDisplayBaseAddress)
 #endif
 
 #ifndef NO_CGDisplayBitsPerPixel
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGDisplayBitsPerPixel)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGDisplayBitsPerPixel)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -1654,7 +1654,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGDisplayBitsPerPixel)
 #endif
 
 #ifndef NO_CGDisplayBitsPerSample
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGDisplayBitsPerSample)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGDisplayBitsPerSample)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -1674,7 +1674,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGDisplayBitsPerSample)
 #endif
 
 #ifndef NO_CGDisplayBytesPerRow
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGDisplayBytesPerRow)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGDisplayBytesPerRow)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -1694,7 +1694,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGDisplayBytesPerRow)
 #endif
 
 #ifndef NO_CGDisplayCreateImage
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGDisplayCreateImage)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGDisplayCreateImage)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -1714,7 +1714,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGDisplayCreateImage)
 #endif
 
 #ifndef NO_CGDisplayPixelsHigh
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGDisplayPixelsHigh)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGDisplayPixelsHigh)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -1726,7 +1726,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGDisplayPixelsHigh)
 #endif
 
 #ifndef NO_CGDisplayPixelsWide
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGDisplayPixelsWide)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGDisplayPixelsWide)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -1738,7 +1738,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGDisplayPixelsWide)
 #endif
 
 #ifndef NO_CGEventCreateKeyboardEvent
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGEventCreateKeyboardEvent)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGEventCreateKeyboardEvent)
 	(JNIEnv *env, jclass that, jintLong arg0, jshort arg1, jboolean arg2)
 {
 	jintLong rc = 0;
@@ -1750,7 +1750,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGEventCreateKeyboardEvent)
 #endif
 
 #ifndef NO_CGEventCreateMouseEvent
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGEventCreateMouseEvent)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGEventCreateMouseEvent)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2, jint arg3)
 {
 	CGPoint _arg2, *lparg2=NULL;
@@ -1766,7 +1766,7 @@ fail:
 #endif
 
 #ifndef NO_CGEventCreateScrollWheelEvent
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGEventCreateScrollWheelEvent)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGEventCreateScrollWheelEvent)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3)
 {
 	jintLong rc = 0;
@@ -1778,7 +1778,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGEventCreateScrollWheelEvent)
 #endif
 
 #ifndef NO_CGEventGetIntegerValueField
-JNIEXPORT jlong JNICALL OS_NATIVE(CGEventGetIntegerValueField)
+SWT_NATIVE_EXPORT jlong JNICALL OS_NATIVE(CGEventGetIntegerValueField)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jlong rc = 0;
@@ -1790,7 +1790,7 @@ JNIEXPORT jlong JNICALL OS_NATIVE(CGEventGetIntegerValueField)
 #endif
 
 #ifndef NO_CGEventPost
-JNIEXPORT void JNICALL OS_NATIVE(CGEventPost)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGEventPost)
 	(JNIEnv *env, jclass that, jint arg0, jintLong arg1)
 {
 	OS_NATIVE_ENTER(env, that, CGEventPost_FUNC);
@@ -1800,7 +1800,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGEventPost)
 #endif
 
 #ifndef NO_CGEventSourceCreate
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGEventSourceCreate)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGEventSourceCreate)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -1812,7 +1812,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGEventSourceCreate)
 #endif
 
 #ifndef NO_CGGetDisplaysWithRect
-JNIEXPORT jint JNICALL OS_NATIVE(CGGetDisplaysWithRect)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CGGetDisplaysWithRect)
 	(JNIEnv *env, jclass that, jobject arg0, jint arg1, jintLong arg2, jintLong arg3)
 {
 	CGRect _arg0, *lparg0=NULL;
@@ -1828,7 +1828,7 @@ fail:
 #endif
 
 #ifndef NO_CGImageCreate
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGImageCreate)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGImageCreate)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jint arg6, jintLong arg7, jintLong arg8, jboolean arg9, jint arg10)
 {
 	jintLong rc = 0;
@@ -1840,7 +1840,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGImageCreate)
 #endif
 
 #ifndef NO_CGImageGetHeight
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGImageGetHeight)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGImageGetHeight)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -1852,7 +1852,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGImageGetHeight)
 #endif
 
 #ifndef NO_CGImageGetWidth
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGImageGetWidth)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGImageGetWidth)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -1864,7 +1864,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGImageGetWidth)
 #endif
 
 #ifndef NO_CGImageRelease
-JNIEXPORT void JNICALL OS_NATIVE(CGImageRelease)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGImageRelease)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CGImageRelease_FUNC);
@@ -1874,7 +1874,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGImageRelease)
 #endif
 
 #ifndef NO_CGPathAddCurveToPoint
-JNIEXPORT void JNICALL OS_NATIVE(CGPathAddCurveToPoint)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGPathAddCurveToPoint)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDouble arg2, jfloatDouble arg3, jfloatDouble arg4, jfloatDouble arg5, jfloatDouble arg6, jfloatDouble arg7)
 {
 	OS_NATIVE_ENTER(env, that, CGPathAddCurveToPoint_FUNC);
@@ -1884,7 +1884,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGPathAddCurveToPoint)
 #endif
 
 #ifndef NO_CGPathAddLineToPoint
-JNIEXPORT void JNICALL OS_NATIVE(CGPathAddLineToPoint)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGPathAddLineToPoint)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDouble arg2, jfloatDouble arg3)
 {
 	OS_NATIVE_ENTER(env, that, CGPathAddLineToPoint_FUNC);
@@ -1894,7 +1894,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGPathAddLineToPoint)
 #endif
 
 #ifndef NO_CGPathAddRect
-JNIEXPORT void JNICALL OS_NATIVE(CGPathAddRect)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGPathAddRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 {
 	CGRect _arg2, *lparg2=NULL;
@@ -1908,7 +1908,7 @@ fail:
 #endif
 
 #ifndef NO_CGPathApply
-JNIEXPORT void JNICALL OS_NATIVE(CGPathApply)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGPathApply)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 {
 	OS_NATIVE_ENTER(env, that, CGPathApply_FUNC);
@@ -1918,7 +1918,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGPathApply)
 #endif
 
 #ifndef NO_CGPathCloseSubpath
-JNIEXPORT void JNICALL OS_NATIVE(CGPathCloseSubpath)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGPathCloseSubpath)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CGPathCloseSubpath_FUNC);
@@ -1928,7 +1928,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGPathCloseSubpath)
 #endif
 
 #ifndef NO_CGPathCreateCopy
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGPathCreateCopy)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGPathCreateCopy)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -1940,7 +1940,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGPathCreateCopy)
 #endif
 
 #ifndef NO_CGPathCreateMutable
-JNIEXPORT jintLong JNICALL OS_NATIVE(CGPathCreateMutable)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CGPathCreateMutable)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -1952,7 +1952,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CGPathCreateMutable)
 #endif
 
 #ifndef NO_CGPathElement_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CGPathElement_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CGPathElement_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -1964,7 +1964,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CGPathElement_1sizeof)
 #endif
 
 #ifndef NO_CGPathMoveToPoint
-JNIEXPORT void JNICALL OS_NATIVE(CGPathMoveToPoint)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGPathMoveToPoint)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDouble arg2, jfloatDouble arg3)
 {
 	OS_NATIVE_ENTER(env, that, CGPathMoveToPoint_FUNC);
@@ -1974,7 +1974,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGPathMoveToPoint)
 #endif
 
 #ifndef NO_CGPathRelease
-JNIEXPORT void JNICALL OS_NATIVE(CGPathRelease)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CGPathRelease)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CGPathRelease_FUNC);
@@ -1984,7 +1984,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CGPathRelease)
 #endif
 
 #ifndef NO_CGPoint_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CGPoint_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CGPoint_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -1996,7 +1996,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CGPoint_1sizeof)
 #endif
 
 #ifndef NO_CGPostKeyboardEvent
-JNIEXPORT jint JNICALL OS_NATIVE(CGPostKeyboardEvent)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CGPostKeyboardEvent)
 	(JNIEnv *env, jclass that, jshort arg0, jshort arg1, jboolean arg2)
 {
 	jint rc = 0;
@@ -2008,7 +2008,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CGPostKeyboardEvent)
 #endif
 
 #ifndef NO_CGRect_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CGRect_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CGRect_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -2020,7 +2020,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CGRect_1sizeof)
 #endif
 
 #ifndef NO_CGSetLocalEventsFilterDuringSuppressionState
-JNIEXPORT jint JNICALL OS_NATIVE(CGSetLocalEventsFilterDuringSuppressionState)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CGSetLocalEventsFilterDuringSuppressionState)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	jint rc = 0;
@@ -2032,7 +2032,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CGSetLocalEventsFilterDuringSuppressionState)
 #endif
 
 #ifndef NO_CGSetLocalEventsSuppressionInterval
-JNIEXPORT jint JNICALL OS_NATIVE(CGSetLocalEventsSuppressionInterval)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CGSetLocalEventsSuppressionInterval)
 	(JNIEnv *env, jclass that, jdouble arg0)
 {
 	jint rc = 0;
@@ -2044,7 +2044,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CGSetLocalEventsSuppressionInterval)
 #endif
 
 #ifndef NO_CGSize_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CGSize_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CGSize_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -2056,7 +2056,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CGSize_1sizeof)
 #endif
 
 #ifndef NO_CGWarpMouseCursorPosition
-JNIEXPORT jint JNICALL OS_NATIVE(CGWarpMouseCursorPosition)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CGWarpMouseCursorPosition)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	CGPoint _arg0, *lparg0=NULL;
@@ -2072,7 +2072,7 @@ fail:
 #endif
 
 #ifndef NO_CPSSetProcessName
-JNIEXPORT jint JNICALL OS_NATIVE(CPSSetProcessName)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CPSSetProcessName)
 	(JNIEnv *env, jclass that, jintArray arg0, jintLong arg1)
 {
 	jint *lparg0=NULL;
@@ -2088,7 +2088,7 @@ fail:
 #endif
 
 #ifndef NO_CTFontGetAscent
-JNIEXPORT jfloatDouble JNICALL OS_NATIVE(CTFontGetAscent)
+SWT_NATIVE_EXPORT jfloatDouble JNICALL OS_NATIVE(CTFontGetAscent)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jfloatDouble rc = 0;
@@ -2100,7 +2100,7 @@ JNIEXPORT jfloatDouble JNICALL OS_NATIVE(CTFontGetAscent)
 #endif
 
 #ifndef NO_CTFontGetDescent
-JNIEXPORT jfloatDouble JNICALL OS_NATIVE(CTFontGetDescent)
+SWT_NATIVE_EXPORT jfloatDouble JNICALL OS_NATIVE(CTFontGetDescent)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jfloatDouble rc = 0;
@@ -2112,7 +2112,7 @@ JNIEXPORT jfloatDouble JNICALL OS_NATIVE(CTFontGetDescent)
 #endif
 
 #ifndef NO_CTFontGetLeading
-JNIEXPORT jfloatDouble JNICALL OS_NATIVE(CTFontGetLeading)
+SWT_NATIVE_EXPORT jfloatDouble JNICALL OS_NATIVE(CTFontGetLeading)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jfloatDouble rc = 0;
@@ -2124,7 +2124,7 @@ JNIEXPORT jfloatDouble JNICALL OS_NATIVE(CTFontGetLeading)
 #endif
 
 #ifndef NO_CTLineCreateWithAttributedString
-JNIEXPORT jintLong JNICALL OS_NATIVE(CTLineCreateWithAttributedString)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CTLineCreateWithAttributedString)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -2136,7 +2136,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CTLineCreateWithAttributedString)
 #endif
 
 #ifndef NO_CTLineDraw
-JNIEXPORT void JNICALL OS_NATIVE(CTLineDraw)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CTLineDraw)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	OS_NATIVE_ENTER(env, that, CTLineDraw_FUNC);
@@ -2146,7 +2146,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CTLineDraw)
 #endif
 
 #ifndef NO_CTLineGetTypographicBounds
-JNIEXPORT jdouble JNICALL OS_NATIVE(CTLineGetTypographicBounds)
+SWT_NATIVE_EXPORT jdouble JNICALL OS_NATIVE(CTLineGetTypographicBounds)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloatDoubleArray arg1, jfloatDoubleArray arg2, jfloatDoubleArray arg3)
 {
 	jfloatDouble *lparg1=NULL;
@@ -2168,7 +2168,7 @@ fail:
 #endif
 
 #ifndef NO_CTParagraphStyleCreate
-JNIEXPORT jintLong JNICALL OS_NATIVE(CTParagraphStyleCreate)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CTParagraphStyleCreate)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -2180,7 +2180,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CTParagraphStyleCreate)
 #endif
 
 #ifndef NO_CTParagraphStyleSetting_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CTParagraphStyleSetting_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CTParagraphStyleSetting_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -2192,7 +2192,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CTParagraphStyleSetting_1sizeof)
 #endif
 
 #ifndef NO_CTTypesetterCreateLine
-JNIEXPORT jintLong JNICALL OS_NATIVE(CTTypesetterCreateLine)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CTTypesetterCreateLine)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	CFRange _arg1, *lparg1=NULL;
@@ -2208,7 +2208,7 @@ fail:
 #endif
 
 #ifndef NO_CTTypesetterCreateWithAttributedString
-JNIEXPORT jintLong JNICALL OS_NATIVE(CTTypesetterCreateWithAttributedString)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CTTypesetterCreateWithAttributedString)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -2220,7 +2220,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CTTypesetterCreateWithAttributedString)
 #endif
 
 #ifndef NO_CTTypesetterSuggestLineBreak
-JNIEXPORT jintLong JNICALL OS_NATIVE(CTTypesetterSuggestLineBreak)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CTTypesetterSuggestLineBreak)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2)
 {
 	jintLong rc = 0;
@@ -2232,7 +2232,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CTTypesetterSuggestLineBreak)
 #endif
 
 #ifndef NO_CancelMenuTracking
-JNIEXPORT jint JNICALL OS_NATIVE(CancelMenuTracking)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CancelMenuTracking)
 	(JNIEnv *env, jclass that, jintLong arg0, jboolean arg1, jint arg2)
 {
 	jint rc = 0;
@@ -2252,7 +2252,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CancelMenuTracking)
 #endif
 
 #ifndef NO_CloseRgn
-JNIEXPORT void JNICALL OS_NATIVE(CloseRgn)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CloseRgn)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CloseRgn_FUNC);
@@ -2270,7 +2270,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CloseRgn)
 #endif
 
 #ifndef NO_CopyRgn
-JNIEXPORT void JNICALL OS_NATIVE(CopyRgn)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CopyRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	OS_NATIVE_ENTER(env, that, CopyRgn_FUNC);
@@ -2288,7 +2288,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CopyRgn)
 #endif
 
 #ifndef NO_DeleteGlobalRef
-JNIEXPORT void JNICALL OS_NATIVE(DeleteGlobalRef)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(DeleteGlobalRef)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, DeleteGlobalRef_FUNC);
@@ -2298,7 +2298,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DeleteGlobalRef)
 #endif
 
 #ifndef NO_DeleteMenuItem
-JNIEXPORT void JNICALL OS_NATIVE(DeleteMenuItem)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(DeleteMenuItem)
 	(JNIEnv *env, jclass that, jintLong arg0, jshort arg1)
 {
 	OS_NATIVE_ENTER(env, that, DeleteMenuItem_FUNC);
@@ -2316,7 +2316,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DeleteMenuItem)
 #endif
 
 #ifndef NO_DiffRgn
-JNIEXPORT void JNICALL OS_NATIVE(DiffRgn)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(DiffRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 {
 	OS_NATIVE_ENTER(env, that, DiffRgn_FUNC);
@@ -2334,7 +2334,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DiffRgn)
 #endif
 
 #ifndef NO_DisposeRgn
-JNIEXPORT void JNICALL OS_NATIVE(DisposeRgn)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(DisposeRgn)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, DisposeRgn_FUNC);
@@ -2352,7 +2352,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DisposeRgn)
 #endif
 
 #ifndef NO_EmptyRgn
-JNIEXPORT jboolean JNICALL OS_NATIVE(EmptyRgn)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(EmptyRgn)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -2372,7 +2372,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(EmptyRgn)
 #endif
 
 #ifndef NO_FSPathMakeRef
-JNIEXPORT jint JNICALL OS_NATIVE(FSPathMakeRef)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(FSPathMakeRef)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jbooleanArray arg2)
 {
 	jbyte *lparg1=NULL;
@@ -2399,7 +2399,7 @@ fail:
 #endif
 
 #ifndef NO_Gestalt
-JNIEXPORT jint JNICALL OS_NATIVE(Gestalt)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(Gestalt)
 	(JNIEnv *env, jclass that, jint arg0, jintArray arg1)
 {
 	jint *lparg1=NULL;
@@ -2415,7 +2415,7 @@ fail:
 #endif
 
 #ifndef NO_GetCurrentEventButtonState
-JNIEXPORT jint JNICALL OS_NATIVE(GetCurrentEventButtonState)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetCurrentEventButtonState)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -2435,7 +2435,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetCurrentEventButtonState)
 #endif
 
 #ifndef NO_GetCurrentProcess
-JNIEXPORT jint JNICALL OS_NATIVE(GetCurrentProcess)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetCurrentProcess)
 	(JNIEnv *env, jclass that, jintArray arg0)
 {
 	jint *lparg0=NULL;
@@ -2451,7 +2451,7 @@ fail:
 #endif
 
 #ifndef NO_GetDblTime
-JNIEXPORT jint JNICALL OS_NATIVE(GetDblTime)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetDblTime)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -2471,7 +2471,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetDblTime)
 #endif
 
 #ifndef NO_GetIconRefFromTypeInfo
-JNIEXPORT jint JNICALL OS_NATIVE(GetIconRefFromTypeInfo)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetIconRefFromTypeInfo)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jintLong arg2, jintLong arg3, jint arg4, jintLongArray arg5)
 {
 	jintLong *lparg5=NULL;
@@ -2495,7 +2495,7 @@ fail:
 #endif
 
 #ifndef NO_GetIndMenuItemWithCommandID
-JNIEXPORT jint JNICALL OS_NATIVE(GetIndMenuItemWithCommandID)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetIndMenuItemWithCommandID)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jintLongArray arg3, jshortArray arg4)
 {
 	jintLong *lparg3=NULL;
@@ -2522,7 +2522,7 @@ fail:
 #endif
 
 #ifndef NO_GetRegionBounds
-JNIEXPORT void JNICALL OS_NATIVE(GetRegionBounds)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(GetRegionBounds)
 	(JNIEnv *env, jclass that, jintLong arg0, jshortArray arg1)
 {
 	jshort *lparg1=NULL;
@@ -2544,7 +2544,7 @@ fail:
 #endif
 
 #ifndef NO_GetSystemUIMode
-JNIEXPORT jint JNICALL OS_NATIVE(GetSystemUIMode)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetSystemUIMode)
 	(JNIEnv *env, jclass that, jintArray arg0, jintArray arg1)
 {
 	jint *lparg0=NULL;
@@ -2571,7 +2571,7 @@ fail:
 #endif
 
 #ifndef NO_GetThemeMetric
-JNIEXPORT void JNICALL OS_NATIVE(GetThemeMetric)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(GetThemeMetric)
 	(JNIEnv *env, jclass that, jint arg0, jintArray arg1)
 {
 	jint *lparg1=NULL;
@@ -2593,7 +2593,7 @@ fail:
 #endif
 
 #ifndef NO_HIThemeDrawFocusRect
-JNIEXPORT jint JNICALL OS_NATIVE(HIThemeDrawFocusRect)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(HIThemeDrawFocusRect)
 	(JNIEnv *env, jclass that, jobject arg0, jboolean arg1, jintLong arg2, jint arg3)
 {
 	CGRect _arg0, *lparg0=NULL;
@@ -2617,7 +2617,7 @@ fail:
 #endif
 
 #ifndef NO_HIWindowGetCGWindowID
-JNIEXPORT jint JNICALL OS_NATIVE(HIWindowGetCGWindowID)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(HIWindowGetCGWindowID)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -2637,7 +2637,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(HIWindowGetCGWindowID)
 #endif
 
 #ifndef NO_JSEvaluateScript
-JNIEXPORT jintLong JNICALL OS_NATIVE(JSEvaluateScript)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(JSEvaluateScript)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jint arg4, jintLongArray arg5)
 {
 	jintLong *lparg5=NULL;
@@ -2653,7 +2653,7 @@ fail:
 #endif
 
 #ifndef NO_JSStringCreateWithUTF8CString
-JNIEXPORT jintLong JNICALL OS_NATIVE(JSStringCreateWithUTF8CString)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(JSStringCreateWithUTF8CString)
 	(JNIEnv *env, jclass that, jbyteArray arg0)
 {
 	jbyte *lparg0=NULL;
@@ -2662,14 +2662,14 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(JSStringCreateWithUTF8CString)
 	if (arg0) if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jintLong)JSStringCreateWithUTF8CString((const char *)lparg0);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, JSStringCreateWithUTF8CString_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_JSStringRelease
-JNIEXPORT void JNICALL OS_NATIVE(JSStringRelease)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(JSStringRelease)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, JSStringRelease_FUNC);
@@ -2679,7 +2679,7 @@ JNIEXPORT void JNICALL OS_NATIVE(JSStringRelease)
 #endif
 
 #ifndef NO_LMGetKbdType
-JNIEXPORT jbyte JNICALL OS_NATIVE(LMGetKbdType)
+SWT_NATIVE_EXPORT jbyte JNICALL OS_NATIVE(LMGetKbdType)
 	(JNIEnv *env, jclass that)
 {
 	jbyte rc = 0;
@@ -2699,7 +2699,7 @@ JNIEXPORT jbyte JNICALL OS_NATIVE(LMGetKbdType)
 #endif
 
 #ifndef NO_LSGetApplicationForInfo
-JNIEXPORT jintLong JNICALL OS_NATIVE(LSGetApplicationForInfo)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LSGetApplicationForInfo)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jintLong arg2, jint arg3, jbyteArray arg4, jintArray arg5)
 {
 	jbyte *lparg4=NULL;
@@ -2718,7 +2718,7 @@ fail:
 #endif
 
 #ifndef NO_LineTo
-JNIEXPORT void JNICALL OS_NATIVE(LineTo)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(LineTo)
 	(JNIEnv *env, jclass that, jshort arg0, jshort arg1)
 {
 	OS_NATIVE_ENTER(env, that, LineTo_FUNC);
@@ -2736,7 +2736,7 @@ JNIEXPORT void JNICALL OS_NATIVE(LineTo)
 #endif
 
 #ifndef NO_MoveTo
-JNIEXPORT void JNICALL OS_NATIVE(MoveTo)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveTo)
 	(JNIEnv *env, jclass that, jshort arg0, jshort arg1)
 {
 	OS_NATIVE_ENTER(env, that, MoveTo_FUNC);
@@ -2754,7 +2754,7 @@ JNIEXPORT void JNICALL OS_NATIVE(MoveTo)
 #endif
 
 #ifndef NO_NSAccessibilityActionDescription
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityActionDescription)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityActionDescription)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -2766,7 +2766,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityActionDescription)
 #endif
 
 #ifndef NO_NSAccessibilityAttributedStringForRangeParameterizedAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityAttributedStringForRangeParameterizedAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityAttributedStringForRangeParameterizedAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2778,7 +2778,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityAttributedStringForRangePara
 #endif
 
 #ifndef NO_NSAccessibilityBackgroundColorTextAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityBackgroundColorTextAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityBackgroundColorTextAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2790,7 +2790,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityBackgroundColorTextAttribute
 #endif
 
 #ifndef NO_NSAccessibilityBoundsForRangeParameterizedAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityBoundsForRangeParameterizedAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityBoundsForRangeParameterizedAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2802,7 +2802,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityBoundsForRangeParameterizedA
 #endif
 
 #ifndef NO_NSAccessibilityButtonRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityButtonRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityButtonRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2814,7 +2814,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityButtonRole)
 #endif
 
 #ifndef NO_NSAccessibilityCheckBoxRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityCheckBoxRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityCheckBoxRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2826,7 +2826,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityCheckBoxRole)
 #endif
 
 #ifndef NO_NSAccessibilityChildrenAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityChildrenAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityChildrenAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2838,7 +2838,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityChildrenAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityColorWellRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityColorWellRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityColorWellRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2850,7 +2850,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityColorWellRole)
 #endif
 
 #ifndef NO_NSAccessibilityColumnRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityColumnRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityColumnRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2862,7 +2862,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityColumnRole)
 #endif
 
 #ifndef NO_NSAccessibilityColumnsAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityColumnsAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityColumnsAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2874,7 +2874,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityColumnsAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityComboBoxRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityComboBoxRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityComboBoxRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2886,7 +2886,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityComboBoxRole)
 #endif
 
 #ifndef NO_NSAccessibilityConfirmAction
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityConfirmAction)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityConfirmAction)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2898,7 +2898,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityConfirmAction)
 #endif
 
 #ifndef NO_NSAccessibilityContentsAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityContentsAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityContentsAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2910,7 +2910,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityContentsAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityDescriptionAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityDescriptionAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityDescriptionAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2922,7 +2922,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityDescriptionAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityDialogSubrole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityDialogSubrole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityDialogSubrole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2934,7 +2934,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityDialogSubrole)
 #endif
 
 #ifndef NO_NSAccessibilityEnabledAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityEnabledAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityEnabledAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2946,7 +2946,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityEnabledAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityExpandedAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityExpandedAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityExpandedAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2958,7 +2958,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityExpandedAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityFloatingWindowSubrole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFloatingWindowSubrole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFloatingWindowSubrole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2970,7 +2970,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFloatingWindowSubrole)
 #endif
 
 #ifndef NO_NSAccessibilityFocusedAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFocusedAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFocusedAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2982,7 +2982,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFocusedAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityFocusedUIElementChangedNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFocusedUIElementChangedNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFocusedUIElementChangedNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2994,7 +2994,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFocusedUIElementChangedNotif
 #endif
 
 #ifndef NO_NSAccessibilityFocusedWindowChangedNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFocusedWindowChangedNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFocusedWindowChangedNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3006,7 +3006,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFocusedWindowChangedNotifica
 #endif
 
 #ifndef NO_NSAccessibilityFontFamilyKey
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFontFamilyKey)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFontFamilyKey)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3018,7 +3018,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFontFamilyKey)
 #endif
 
 #ifndef NO_NSAccessibilityFontNameKey
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFontNameKey)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFontNameKey)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3030,7 +3030,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFontNameKey)
 #endif
 
 #ifndef NO_NSAccessibilityFontSizeKey
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFontSizeKey)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFontSizeKey)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3042,7 +3042,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFontSizeKey)
 #endif
 
 #ifndef NO_NSAccessibilityFontTextAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFontTextAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFontTextAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3054,7 +3054,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityFontTextAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityForegroundColorTextAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityForegroundColorTextAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityForegroundColorTextAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3066,7 +3066,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityForegroundColorTextAttribute
 #endif
 
 #ifndef NO_NSAccessibilityGridRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityGridRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityGridRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3078,7 +3078,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityGridRole)
 #endif
 
 #ifndef NO_NSAccessibilityGroupRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityGroupRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityGroupRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3090,7 +3090,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityGroupRole)
 #endif
 
 #ifndef NO_NSAccessibilityHeaderAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityHeaderAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityHeaderAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3102,7 +3102,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityHeaderAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityHelpAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityHelpAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityHelpAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3114,7 +3114,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityHelpAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityHelpTagRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityHelpTagRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityHelpTagRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3126,7 +3126,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityHelpTagRole)
 #endif
 
 #ifndef NO_NSAccessibilityHorizontalOrientationValue
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityHorizontalOrientationValue)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityHorizontalOrientationValue)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3138,7 +3138,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityHorizontalOrientationValue)
 #endif
 
 #ifndef NO_NSAccessibilityHorizontalScrollBarAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityHorizontalScrollBarAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityHorizontalScrollBarAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3150,7 +3150,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityHorizontalScrollBarAttribute
 #endif
 
 #ifndef NO_NSAccessibilityImageRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityImageRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityImageRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3162,7 +3162,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityImageRole)
 #endif
 
 #ifndef NO_NSAccessibilityIncrementorRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityIncrementorRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityIncrementorRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3174,7 +3174,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityIncrementorRole)
 #endif
 
 #ifndef NO_NSAccessibilityIndexAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityIndexAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityIndexAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3186,7 +3186,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityIndexAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityInsertionPointLineNumberAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityInsertionPointLineNumberAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityInsertionPointLineNumberAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3198,7 +3198,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityInsertionPointLineNumberAttr
 #endif
 
 #ifndef NO_NSAccessibilityLabelValueAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityLabelValueAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityLabelValueAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3210,7 +3210,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityLabelValueAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityLineForIndexParameterizedAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityLineForIndexParameterizedAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityLineForIndexParameterizedAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3222,7 +3222,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityLineForIndexParameterizedAtt
 #endif
 
 #ifndef NO_NSAccessibilityLinkRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityLinkRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityLinkRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3234,7 +3234,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityLinkRole)
 #endif
 
 #ifndef NO_NSAccessibilityLinkTextAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityLinkTextAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityLinkTextAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3246,7 +3246,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityLinkTextAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityLinkedUIElementsAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityLinkedUIElementsAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityLinkedUIElementsAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3258,7 +3258,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityLinkedUIElementsAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityListRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityListRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityListRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3270,7 +3270,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityListRole)
 #endif
 
 #ifndef NO_NSAccessibilityMaxValueAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMaxValueAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMaxValueAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3282,7 +3282,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMaxValueAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityMenuBarRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMenuBarRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMenuBarRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3294,7 +3294,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMenuBarRole)
 #endif
 
 #ifndef NO_NSAccessibilityMenuButtonRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMenuButtonRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMenuButtonRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3306,7 +3306,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMenuButtonRole)
 #endif
 
 #ifndef NO_NSAccessibilityMenuItemRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMenuItemRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMenuItemRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3318,7 +3318,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMenuItemRole)
 #endif
 
 #ifndef NO_NSAccessibilityMenuRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMenuRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMenuRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3330,7 +3330,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMenuRole)
 #endif
 
 #ifndef NO_NSAccessibilityMinValueAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMinValueAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMinValueAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3342,7 +3342,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMinValueAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityMisspelledTextAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMisspelledTextAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMisspelledTextAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3354,7 +3354,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMisspelledTextAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityMovedNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMovedNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMovedNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3366,7 +3366,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityMovedNotification)
 #endif
 
 #ifndef NO_NSAccessibilityNextContentsAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityNextContentsAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityNextContentsAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3378,7 +3378,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityNextContentsAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityNumberOfCharactersAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityNumberOfCharactersAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityNumberOfCharactersAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3390,7 +3390,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityNumberOfCharactersAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityOrientationAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityOrientationAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityOrientationAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3402,7 +3402,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityOrientationAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityOutlineRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityOutlineRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityOutlineRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3414,7 +3414,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityOutlineRole)
 #endif
 
 #ifndef NO_NSAccessibilityOutlineRowSubrole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityOutlineRowSubrole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityOutlineRowSubrole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3426,7 +3426,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityOutlineRowSubrole)
 #endif
 
 #ifndef NO_NSAccessibilityParentAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityParentAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityParentAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3438,7 +3438,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityParentAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityPopUpButtonRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityPopUpButtonRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityPopUpButtonRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3450,7 +3450,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityPopUpButtonRole)
 #endif
 
 #ifndef NO_NSAccessibilityPositionAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityPositionAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityPositionAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3462,7 +3462,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityPositionAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityPostNotification
-JNIEXPORT void JNICALL OS_NATIVE(NSAccessibilityPostNotification)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(NSAccessibilityPostNotification)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	OS_NATIVE_ENTER(env, that, NSAccessibilityPostNotification_FUNC);
@@ -3472,7 +3472,7 @@ JNIEXPORT void JNICALL OS_NATIVE(NSAccessibilityPostNotification)
 #endif
 
 #ifndef NO_NSAccessibilityPressAction
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityPressAction)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityPressAction)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3484,7 +3484,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityPressAction)
 #endif
 
 #ifndef NO_NSAccessibilityPreviousContentsAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityPreviousContentsAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityPreviousContentsAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3496,7 +3496,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityPreviousContentsAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityProgressIndicatorRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityProgressIndicatorRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityProgressIndicatorRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3508,7 +3508,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityProgressIndicatorRole)
 #endif
 
 #ifndef NO_NSAccessibilityRTFForRangeParameterizedAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRTFForRangeParameterizedAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRTFForRangeParameterizedAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3520,7 +3520,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRTFForRangeParameterizedAttr
 #endif
 
 #ifndef NO_NSAccessibilityRadioButtonRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRadioButtonRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRadioButtonRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3532,7 +3532,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRadioButtonRole)
 #endif
 
 #ifndef NO_NSAccessibilityRadioGroupRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRadioGroupRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRadioGroupRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3544,7 +3544,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRadioGroupRole)
 #endif
 
 #ifndef NO_NSAccessibilityRaiseBadArgumentException
-JNIEXPORT void JNICALL OS_NATIVE(NSAccessibilityRaiseBadArgumentException)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(NSAccessibilityRaiseBadArgumentException)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 {
 	OS_NATIVE_ENTER(env, that, NSAccessibilityRaiseBadArgumentException_FUNC);
@@ -3554,7 +3554,7 @@ JNIEXPORT void JNICALL OS_NATIVE(NSAccessibilityRaiseBadArgumentException)
 #endif
 
 #ifndef NO_NSAccessibilityRangeForIndexParameterizedAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRangeForIndexParameterizedAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRangeForIndexParameterizedAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3566,7 +3566,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRangeForIndexParameterizedAt
 #endif
 
 #ifndef NO_NSAccessibilityRangeForLineParameterizedAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRangeForLineParameterizedAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRangeForLineParameterizedAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3578,7 +3578,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRangeForLineParameterizedAtt
 #endif
 
 #ifndef NO_NSAccessibilityRangeForPositionParameterizedAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRangeForPositionParameterizedAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRangeForPositionParameterizedAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3590,7 +3590,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRangeForPositionParameterize
 #endif
 
 #ifndef NO_NSAccessibilityResizedNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityResizedNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityResizedNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3602,7 +3602,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityResizedNotification)
 #endif
 
 #ifndef NO_NSAccessibilityRoleAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRoleAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRoleAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3614,7 +3614,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRoleAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityRoleDescription
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRoleDescription)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRoleDescription)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -3626,7 +3626,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRoleDescription)
 #endif
 
 #ifndef NO_NSAccessibilityRoleDescriptionAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRoleDescriptionAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRoleDescriptionAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3638,7 +3638,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRoleDescriptionAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityRoleDescriptionForUIElement
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRoleDescriptionForUIElement)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRoleDescriptionForUIElement)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -3650,7 +3650,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRoleDescriptionForUIElement)
 #endif
 
 #ifndef NO_NSAccessibilityRowCountChangedNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRowCountChangedNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRowCountChangedNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3662,7 +3662,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRowCountChangedNotification)
 #endif
 
 #ifndef NO_NSAccessibilityRowRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRowRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRowRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3674,7 +3674,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRowRole)
 #endif
 
 #ifndef NO_NSAccessibilityRowsAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRowsAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRowsAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3686,7 +3686,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRowsAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityScrollAreaRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityScrollAreaRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityScrollAreaRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3698,7 +3698,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityScrollAreaRole)
 #endif
 
 #ifndef NO_NSAccessibilityScrollBarRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityScrollBarRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityScrollBarRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3710,7 +3710,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityScrollBarRole)
 #endif
 
 #ifndef NO_NSAccessibilitySelectedAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3722,7 +3722,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedAttribute)
 #endif
 
 #ifndef NO_NSAccessibilitySelectedChildrenAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedChildrenAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedChildrenAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3734,7 +3734,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedChildrenAttribute)
 #endif
 
 #ifndef NO_NSAccessibilitySelectedChildrenChangedNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedChildrenChangedNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedChildrenChangedNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3746,7 +3746,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedChildrenChangedNotif
 #endif
 
 #ifndef NO_NSAccessibilitySelectedColumnsAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedColumnsAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedColumnsAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3758,7 +3758,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedColumnsAttribute)
 #endif
 
 #ifndef NO_NSAccessibilitySelectedRowsAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedRowsAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedRowsAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3770,7 +3770,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedRowsAttribute)
 #endif
 
 #ifndef NO_NSAccessibilitySelectedRowsChangedNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedRowsChangedNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedRowsChangedNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3782,7 +3782,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedRowsChangedNotificat
 #endif
 
 #ifndef NO_NSAccessibilitySelectedTextAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedTextAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedTextAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3794,7 +3794,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedTextAttribute)
 #endif
 
 #ifndef NO_NSAccessibilitySelectedTextChangedNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedTextChangedNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedTextChangedNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3806,7 +3806,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedTextChangedNotificat
 #endif
 
 #ifndef NO_NSAccessibilitySelectedTextRangeAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedTextRangeAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedTextRangeAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3818,7 +3818,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedTextRangeAttribute)
 #endif
 
 #ifndef NO_NSAccessibilitySelectedTextRangesAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedTextRangesAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedTextRangesAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3830,7 +3830,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySelectedTextRangesAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityServesAsTitleForUIElementsAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityServesAsTitleForUIElementsAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityServesAsTitleForUIElementsAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3842,7 +3842,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityServesAsTitleForUIElementsAt
 #endif
 
 #ifndef NO_NSAccessibilityShowMenuAction
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityShowMenuAction)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityShowMenuAction)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3854,7 +3854,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityShowMenuAction)
 #endif
 
 #ifndef NO_NSAccessibilitySizeAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySizeAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySizeAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3866,7 +3866,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySizeAttribute)
 #endif
 
 #ifndef NO_NSAccessibilitySliderRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySliderRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySliderRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3878,7 +3878,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySliderRole)
 #endif
 
 #ifndef NO_NSAccessibilitySortButtonRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySortButtonRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySortButtonRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3890,7 +3890,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySortButtonRole)
 #endif
 
 #ifndef NO_NSAccessibilitySplitterRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySplitterRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySplitterRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3902,7 +3902,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySplitterRole)
 #endif
 
 #ifndef NO_NSAccessibilityStandardWindowSubrole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStandardWindowSubrole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStandardWindowSubrole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3914,7 +3914,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStandardWindowSubrole)
 #endif
 
 #ifndef NO_NSAccessibilityStaticTextRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStaticTextRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStaticTextRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3926,7 +3926,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStaticTextRole)
 #endif
 
 #ifndef NO_NSAccessibilityStrikethroughColorTextAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStrikethroughColorTextAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStrikethroughColorTextAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3938,7 +3938,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStrikethroughColorTextAttrib
 #endif
 
 #ifndef NO_NSAccessibilityStrikethroughTextAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStrikethroughTextAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStrikethroughTextAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3950,7 +3950,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStrikethroughTextAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityStringForRangeParameterizedAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStringForRangeParameterizedAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStringForRangeParameterizedAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3962,7 +3962,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStringForRangeParameterizedA
 #endif
 
 #ifndef NO_NSAccessibilityStyleRangeForIndexParameterizedAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStyleRangeForIndexParameterizedAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStyleRangeForIndexParameterizedAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3974,7 +3974,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityStyleRangeForIndexParameteri
 #endif
 
 #ifndef NO_NSAccessibilitySubroleAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySubroleAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySubroleAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3986,7 +3986,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySubroleAttribute)
 #endif
 
 #ifndef NO_NSAccessibilitySuperscriptTextAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySuperscriptTextAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySuperscriptTextAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3998,7 +3998,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySuperscriptTextAttribute)
 #endif
 
 #ifndef NO_NSAccessibilitySystemDialogSubrole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySystemDialogSubrole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySystemDialogSubrole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4010,7 +4010,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilitySystemDialogSubrole)
 #endif
 
 #ifndef NO_NSAccessibilityTabGroupRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTabGroupRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTabGroupRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4022,7 +4022,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTabGroupRole)
 #endif
 
 #ifndef NO_NSAccessibilityTableRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTableRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTableRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4034,7 +4034,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTableRole)
 #endif
 
 #ifndef NO_NSAccessibilityTableRowSubrole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTableRowSubrole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTableRowSubrole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4046,7 +4046,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTableRowSubrole)
 #endif
 
 #ifndef NO_NSAccessibilityTabsAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTabsAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTabsAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4058,7 +4058,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTabsAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityTextAreaRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTextAreaRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTextAreaRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4070,7 +4070,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTextAreaRole)
 #endif
 
 #ifndef NO_NSAccessibilityTextFieldRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTextFieldRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTextFieldRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4082,7 +4082,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTextFieldRole)
 #endif
 
 #ifndef NO_NSAccessibilityTextLinkSubrole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTextLinkSubrole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTextLinkSubrole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4094,7 +4094,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTextLinkSubrole)
 #endif
 
 #ifndef NO_NSAccessibilityTitleAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTitleAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTitleAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4106,7 +4106,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTitleAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityTitleChangedNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTitleChangedNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTitleChangedNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4118,7 +4118,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTitleChangedNotification)
 #endif
 
 #ifndef NO_NSAccessibilityTitleUIElementAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTitleUIElementAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTitleUIElementAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4130,7 +4130,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTitleUIElementAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityToolbarRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityToolbarRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityToolbarRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4142,7 +4142,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityToolbarRole)
 #endif
 
 #ifndef NO_NSAccessibilityTopLevelUIElementAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTopLevelUIElementAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTopLevelUIElementAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4154,7 +4154,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityTopLevelUIElementAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityURLAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityURLAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityURLAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4166,7 +4166,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityURLAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityUnderlineColorTextAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnderlineColorTextAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnderlineColorTextAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4178,7 +4178,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnderlineColorTextAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityUnderlineTextAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnderlineTextAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnderlineTextAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4190,7 +4190,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnderlineTextAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityUnignoredAncestor
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnignoredAncestor)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnignoredAncestor)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -4202,7 +4202,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnignoredAncestor)
 #endif
 
 #ifndef NO_NSAccessibilityUnignoredChildren
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnignoredChildren)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnignoredChildren)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -4214,7 +4214,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnignoredChildren)
 #endif
 
 #ifndef NO_NSAccessibilityUnignoredChildrenForOnlyChild
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnignoredChildrenForOnlyChild)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnignoredChildrenForOnlyChild)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -4226,7 +4226,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnignoredChildrenForOnlyChil
 #endif
 
 #ifndef NO_NSAccessibilityUnignoredDescendant
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnignoredDescendant)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnignoredDescendant)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -4238,7 +4238,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnignoredDescendant)
 #endif
 
 #ifndef NO_NSAccessibilityUnknownRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnknownRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnknownRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4250,7 +4250,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnknownRole)
 #endif
 
 #ifndef NO_NSAccessibilityUnknownSubrole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnknownSubrole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnknownSubrole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4262,7 +4262,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityUnknownSubrole)
 #endif
 
 #ifndef NO_NSAccessibilityValueAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityValueAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityValueAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4274,7 +4274,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityValueAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityValueChangedNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityValueChangedNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityValueChangedNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4286,7 +4286,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityValueChangedNotification)
 #endif
 
 #ifndef NO_NSAccessibilityValueDescriptionAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityValueDescriptionAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityValueDescriptionAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4298,7 +4298,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityValueDescriptionAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityValueIndicatorRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityValueIndicatorRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityValueIndicatorRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4310,7 +4310,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityValueIndicatorRole)
 #endif
 
 #ifndef NO_NSAccessibilityVerticalOrientationValue
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVerticalOrientationValue)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVerticalOrientationValue)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4322,7 +4322,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVerticalOrientationValue)
 #endif
 
 #ifndef NO_NSAccessibilityVerticalScrollBarAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVerticalScrollBarAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVerticalScrollBarAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4334,7 +4334,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVerticalScrollBarAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityVisibleCharacterRangeAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVisibleCharacterRangeAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVisibleCharacterRangeAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4346,7 +4346,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVisibleCharacterRangeAttribu
 #endif
 
 #ifndef NO_NSAccessibilityVisibleChildrenAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVisibleChildrenAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVisibleChildrenAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4358,7 +4358,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVisibleChildrenAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityVisibleColumnsAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVisibleColumnsAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVisibleColumnsAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4370,7 +4370,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVisibleColumnsAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityVisibleNameKey
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVisibleNameKey)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVisibleNameKey)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4382,7 +4382,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVisibleNameKey)
 #endif
 
 #ifndef NO_NSAccessibilityVisibleRowsAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVisibleRowsAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVisibleRowsAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4394,7 +4394,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityVisibleRowsAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityWindowAttribute
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityWindowAttribute)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityWindowAttribute)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4406,7 +4406,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityWindowAttribute)
 #endif
 
 #ifndef NO_NSAccessibilityWindowRole
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityWindowRole)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityWindowRole)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4418,7 +4418,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityWindowRole)
 #endif
 
 #ifndef NO_NSAddImage
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAddImage)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAddImage)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1)
 {
 	jbyte *lparg0=NULL;
@@ -4427,14 +4427,14 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAddImage)
 	if (arg0) if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jintLong)NSAddImage((const char*)lparg0, (uint32_t)arg1);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, NSAddImage_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_NSAffineTransformStruct_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NSAffineTransformStruct_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NSAffineTransformStruct_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -4446,7 +4446,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NSAffineTransformStruct_1sizeof)
 #endif
 
 #ifndef NO_NSApplicationDidChangeScreenParametersNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSApplicationDidChangeScreenParametersNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSApplicationDidChangeScreenParametersNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4458,7 +4458,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSApplicationDidChangeScreenParametersNotif
 #endif
 
 #ifndef NO_NSAttachmentAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSAttachmentAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSAttachmentAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4470,7 +4470,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAttachmentAttributeName)
 #endif
 
 #ifndef NO_NSBackgroundColorAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSBackgroundColorAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSBackgroundColorAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4482,7 +4482,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSBackgroundColorAttributeName)
 #endif
 
 #ifndef NO_NSBaselineOffsetAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSBaselineOffsetAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSBaselineOffsetAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4494,7 +4494,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSBaselineOffsetAttributeName)
 #endif
 
 #ifndef NO_NSBeep
-JNIEXPORT void JNICALL OS_NATIVE(NSBeep)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(NSBeep)
 	(JNIEnv *env, jclass that)
 {
 	OS_NATIVE_ENTER(env, that, NSBeep_FUNC);
@@ -4504,7 +4504,7 @@ JNIEXPORT void JNICALL OS_NATIVE(NSBeep)
 #endif
 
 #ifndef NO_NSBitsPerPixelFromDepth
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSBitsPerPixelFromDepth)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSBitsPerPixelFromDepth)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -4516,7 +4516,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSBitsPerPixelFromDepth)
 #endif
 
 #ifndef NO_NSCalibratedRGBColorSpace
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSCalibratedRGBColorSpace)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSCalibratedRGBColorSpace)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4528,7 +4528,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSCalibratedRGBColorSpace)
 #endif
 
 #ifndef NO_NSCopyBits
-JNIEXPORT void JNICALL OS_NATIVE(NSCopyBits)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(NSCopyBits)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jobject arg2)
 {
 	NSRect _arg1, *lparg1=NULL;
@@ -4545,7 +4545,7 @@ fail:
 #endif
 
 #ifndef NO_NSCountWindows
-JNIEXPORT void JNICALL OS_NATIVE(NSCountWindows)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(NSCountWindows)
 	(JNIEnv *env, jclass that, jintLongArray arg0)
 {
 	jintLong *lparg0=NULL;
@@ -4559,7 +4559,7 @@ fail:
 #endif
 
 #ifndef NO_NSCursorAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSCursorAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSCursorAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4571,7 +4571,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSCursorAttributeName)
 #endif
 
 #ifndef NO_NSDefaultRunLoopMode
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSDefaultRunLoopMode)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSDefaultRunLoopMode)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4583,7 +4583,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSDefaultRunLoopMode)
 #endif
 
 #ifndef NO_NSDeviceRGBColorSpace
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSDeviceRGBColorSpace)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSDeviceRGBColorSpace)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4595,7 +4595,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSDeviceRGBColorSpace)
 #endif
 
 #ifndef NO_NSDeviceResolution
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSDeviceResolution)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSDeviceResolution)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4607,7 +4607,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSDeviceResolution)
 #endif
 
 #ifndef NO_NSDragPboard
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSDragPboard)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSDragPboard)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4619,7 +4619,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSDragPboard)
 #endif
 
 #ifndef NO_NSEqualRects
-JNIEXPORT jboolean JNICALL OS_NATIVE(NSEqualRects)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(NSEqualRects)
 	(JNIEnv *env, jclass that, jobject arg0, jobject arg1)
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -4638,7 +4638,7 @@ fail:
 #endif
 
 #ifndef NO_NSErrorFailingURLStringKey
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSErrorFailingURLStringKey)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSErrorFailingURLStringKey)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4650,7 +4650,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSErrorFailingURLStringKey)
 #endif
 
 #ifndef NO_NSEventTrackingRunLoopMode
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSEventTrackingRunLoopMode)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSEventTrackingRunLoopMode)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4662,7 +4662,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSEventTrackingRunLoopMode)
 #endif
 
 #ifndef NO_NSFileTypeForHFSTypeCode
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSFileTypeForHFSTypeCode)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSFileTypeForHFSTypeCode)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -4674,7 +4674,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSFileTypeForHFSTypeCode)
 #endif
 
 #ifndef NO_NSFilenamesPboardType
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSFilenamesPboardType)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSFilenamesPboardType)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4686,7 +4686,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSFilenamesPboardType)
 #endif
 
 #ifndef NO_NSFontAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSFontAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSFontAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4698,7 +4698,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSFontAttributeName)
 #endif
 
 #ifndef NO_NSForegroundColorAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSForegroundColorAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSForegroundColorAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4710,7 +4710,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSForegroundColorAttributeName)
 #endif
 
 #ifndef NO_NSGetSizeAndAlignment
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSGetSizeAndAlignment)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSGetSizeAndAlignment)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLongArray arg1, jintLongArray arg2)
 {
 	jintLong *lparg1=NULL;
@@ -4729,7 +4729,7 @@ fail:
 #endif
 
 #ifndef NO_NSHTMLPboardType
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSHTMLPboardType)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSHTMLPboardType)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4741,7 +4741,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSHTMLPboardType)
 #endif
 
 #ifndef NO_NSLigatureAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSLigatureAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSLigatureAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4753,7 +4753,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSLigatureAttributeName)
 #endif
 
 #ifndef NO_NSLinkAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSLinkAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSLinkAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4765,7 +4765,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSLinkAttributeName)
 #endif
 
 #ifndef NO_NSLocaleLanguageCode
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSLocaleLanguageCode)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSLocaleLanguageCode)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4777,7 +4777,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSLocaleLanguageCode)
 #endif
 
 #ifndef NO_NSModalPanelRunLoopMode
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSModalPanelRunLoopMode)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSModalPanelRunLoopMode)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4789,7 +4789,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSModalPanelRunLoopMode)
 #endif
 
 #ifndef NO_NSNumberOfColorComponents
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSNumberOfColorComponents)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSNumberOfColorComponents)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -4801,7 +4801,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSNumberOfColorComponents)
 #endif
 
 #ifndef NO_NSObliquenessAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSObliquenessAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSObliquenessAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4813,7 +4813,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSObliquenessAttributeName)
 #endif
 
 #ifndef NO_NSOutlineViewColumnDidMoveNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSOutlineViewColumnDidMoveNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSOutlineViewColumnDidMoveNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4825,7 +4825,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSOutlineViewColumnDidMoveNotification)
 #endif
 
 #ifndef NO_NSParagraphStyleAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSParagraphStyleAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSParagraphStyleAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4837,7 +4837,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSParagraphStyleAttributeName)
 #endif
 
 #ifndef NO_NSPointInRect
-JNIEXPORT jboolean JNICALL OS_NATIVE(NSPointInRect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(NSPointInRect)
 	(JNIEnv *env, jclass that, jobject arg0, jobject arg1)
 {
 	NSPoint _arg0, *lparg0=NULL;
@@ -4856,7 +4856,7 @@ fail:
 #endif
 
 #ifndef NO_NSPoint_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NSPoint_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NSPoint_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -4868,7 +4868,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NSPoint_1sizeof)
 #endif
 
 #ifndef NO_NSPrintAllPages
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintAllPages)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSPrintAllPages)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4880,7 +4880,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintAllPages)
 #endif
 
 #ifndef NO_NSPrintCopies
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintCopies)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSPrintCopies)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4892,7 +4892,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintCopies)
 #endif
 
 #ifndef NO_NSPrintFirstPage
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintFirstPage)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSPrintFirstPage)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4904,7 +4904,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintFirstPage)
 #endif
 
 #ifndef NO_NSPrintJobDisposition
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintJobDisposition)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSPrintJobDisposition)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4916,7 +4916,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintJobDisposition)
 #endif
 
 #ifndef NO_NSPrintLastPage
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintLastPage)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSPrintLastPage)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4928,7 +4928,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintLastPage)
 #endif
 
 #ifndef NO_NSPrintMustCollate
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintMustCollate)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSPrintMustCollate)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4940,7 +4940,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintMustCollate)
 #endif
 
 #ifndef NO_NSPrintOrientation
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintOrientation)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSPrintOrientation)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4952,7 +4952,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintOrientation)
 #endif
 
 #ifndef NO_NSPrintPreviewJob
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintPreviewJob)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSPrintPreviewJob)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4964,7 +4964,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintPreviewJob)
 #endif
 
 #ifndef NO_NSPrintSaveJob
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintSaveJob)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSPrintSaveJob)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4976,7 +4976,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintSaveJob)
 #endif
 
 #ifndef NO_NSPrintSavePath
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintSavePath)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSPrintSavePath)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4988,7 +4988,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintSavePath)
 #endif
 
 #ifndef NO_NSPrintScalingFactor
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintScalingFactor)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSPrintScalingFactor)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5000,7 +5000,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintScalingFactor)
 #endif
 
 #ifndef NO_NSPrintSpoolJob
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintSpoolJob)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSPrintSpoolJob)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5012,7 +5012,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSPrintSpoolJob)
 #endif
 
 #ifndef NO_NSRTFPboardType
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSRTFPboardType)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSRTFPboardType)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5024,7 +5024,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSRTFPboardType)
 #endif
 
 #ifndef NO_NSRange_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NSRange_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NSRange_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -5036,7 +5036,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NSRange_1sizeof)
 #endif
 
 #ifndef NO_NSRectFillUsingOperation
-JNIEXPORT void JNICALL OS_NATIVE(NSRectFillUsingOperation)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(NSRectFillUsingOperation)
 	(JNIEnv *env, jclass that, jobject arg0, jintLong arg1)
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -5050,7 +5050,7 @@ fail:
 #endif
 
 #ifndef NO_NSRect_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NSRect_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NSRect_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -5062,7 +5062,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NSRect_1sizeof)
 #endif
 
 #ifndef NO_NSSearchPathForDirectoriesInDomains
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSSearchPathForDirectoriesInDomains)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSSearchPathForDirectoriesInDomains)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2)
 {
 	jintLong rc = 0;
@@ -5074,7 +5074,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSSearchPathForDirectoriesInDomains)
 #endif
 
 #ifndef NO_NSSize_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NSSize_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NSSize_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -5086,7 +5086,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NSSize_1sizeof)
 #endif
 
 #ifndef NO_NSSpellingStateAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSSpellingStateAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSSpellingStateAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5098,7 +5098,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSSpellingStateAttributeName)
 #endif
 
 #ifndef NO_NSStrikethroughColorAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSStrikethroughColorAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSStrikethroughColorAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5110,7 +5110,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSStrikethroughColorAttributeName)
 #endif
 
 #ifndef NO_NSStrikethroughStyleAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSStrikethroughStyleAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSStrikethroughStyleAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5122,7 +5122,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSStrikethroughStyleAttributeName)
 #endif
 
 #ifndef NO_NSStringPboardType
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSStringPboardType)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSStringPboardType)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5134,7 +5134,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSStringPboardType)
 #endif
 
 #ifndef NO_NSStrokeWidthAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSStrokeWidthAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSStrokeWidthAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5146,7 +5146,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSStrokeWidthAttributeName)
 #endif
 
 #ifndef NO_NSSystemColorsDidChangeNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSSystemColorsDidChangeNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSSystemColorsDidChangeNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5158,7 +5158,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSSystemColorsDidChangeNotification)
 #endif
 
 #ifndef NO_NSTIFFPboardType
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSTIFFPboardType)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSTIFFPboardType)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5170,7 +5170,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSTIFFPboardType)
 #endif
 
 #ifndef NO_NSTableViewColumnDidMoveNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSTableViewColumnDidMoveNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSTableViewColumnDidMoveNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5182,7 +5182,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSTableViewColumnDidMoveNotification)
 #endif
 
 #ifndef NO_NSTemporaryDirectory
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSTemporaryDirectory)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSTemporaryDirectory)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5194,7 +5194,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSTemporaryDirectory)
 #endif
 
 #ifndef NO_NSToolbarCustomizeToolbarItemIdentifier
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarCustomizeToolbarItemIdentifier)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSToolbarCustomizeToolbarItemIdentifier)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5206,7 +5206,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarCustomizeToolbarItemIdentifier)
 #endif
 
 #ifndef NO_NSToolbarDidRemoveItemNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarDidRemoveItemNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSToolbarDidRemoveItemNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5218,7 +5218,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarDidRemoveItemNotification)
 #endif
 
 #ifndef NO_NSToolbarFlexibleSpaceItemIdentifier
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarFlexibleSpaceItemIdentifier)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSToolbarFlexibleSpaceItemIdentifier)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5230,7 +5230,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarFlexibleSpaceItemIdentifier)
 #endif
 
 #ifndef NO_NSToolbarPrintItemIdentifier
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarPrintItemIdentifier)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSToolbarPrintItemIdentifier)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5242,7 +5242,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarPrintItemIdentifier)
 #endif
 
 #ifndef NO_NSToolbarSeparatorItemIdentifier
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarSeparatorItemIdentifier)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSToolbarSeparatorItemIdentifier)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5254,7 +5254,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarSeparatorItemIdentifier)
 #endif
 
 #ifndef NO_NSToolbarShowColorsItemIdentifier
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarShowColorsItemIdentifier)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSToolbarShowColorsItemIdentifier)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5266,7 +5266,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarShowColorsItemIdentifier)
 #endif
 
 #ifndef NO_NSToolbarShowFontsItemIdentifier
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarShowFontsItemIdentifier)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSToolbarShowFontsItemIdentifier)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5278,7 +5278,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarShowFontsItemIdentifier)
 #endif
 
 #ifndef NO_NSToolbarSpaceItemIdentifier
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarSpaceItemIdentifier)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSToolbarSpaceItemIdentifier)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5290,7 +5290,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarSpaceItemIdentifier)
 #endif
 
 #ifndef NO_NSToolbarWillAddItemNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarWillAddItemNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSToolbarWillAddItemNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5302,7 +5302,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSToolbarWillAddItemNotification)
 #endif
 
 #ifndef NO_NSURLPboardType
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSURLPboardType)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSURLPboardType)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5314,7 +5314,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSURLPboardType)
 #endif
 
 #ifndef NO_NSUnderlineColorAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSUnderlineColorAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSUnderlineColorAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5326,7 +5326,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSUnderlineColorAttributeName)
 #endif
 
 #ifndef NO_NSUnderlineStyleAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSUnderlineStyleAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSUnderlineStyleAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5338,7 +5338,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSUnderlineStyleAttributeName)
 #endif
 
 #ifndef NO_NSViewGlobalFrameDidChangeNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSViewGlobalFrameDidChangeNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSViewGlobalFrameDidChangeNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5350,7 +5350,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSViewGlobalFrameDidChangeNotification)
 #endif
 
 #ifndef NO_NSWindowDidBecomeKeyNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSWindowDidBecomeKeyNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSWindowDidBecomeKeyNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5362,7 +5362,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSWindowDidBecomeKeyNotification)
 #endif
 
 #ifndef NO_NSWindowDidDeminiaturizeNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSWindowDidDeminiaturizeNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSWindowDidDeminiaturizeNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5374,7 +5374,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSWindowDidDeminiaturizeNotification)
 #endif
 
 #ifndef NO_NSWindowDidMiniaturizeNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSWindowDidMiniaturizeNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSWindowDidMiniaturizeNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5386,7 +5386,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSWindowDidMiniaturizeNotification)
 #endif
 
 #ifndef NO_NSWindowDidMoveNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSWindowDidMoveNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSWindowDidMoveNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5398,7 +5398,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSWindowDidMoveNotification)
 #endif
 
 #ifndef NO_NSWindowDidResignKeyNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSWindowDidResignKeyNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSWindowDidResignKeyNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5410,7 +5410,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSWindowDidResignKeyNotification)
 #endif
 
 #ifndef NO_NSWindowDidResizeNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSWindowDidResizeNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSWindowDidResizeNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5422,7 +5422,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSWindowDidResizeNotification)
 #endif
 
 #ifndef NO_NSWindowList
-JNIEXPORT void JNICALL OS_NATIVE(NSWindowList)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(NSWindowList)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLongArray arg1)
 {
 	jintLong *lparg1=NULL;
@@ -5436,7 +5436,7 @@ fail:
 #endif
 
 #ifndef NO_NSWindowWillCloseNotification
-JNIEXPORT jintLong JNICALL OS_NATIVE(NSWindowWillCloseNotification)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NSWindowWillCloseNotification)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5448,7 +5448,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSWindowWillCloseNotification)
 #endif
 
 #ifndef NO_NewGlobalRef
-JNIEXPORT jintLong JNICALL OS_NATIVE(NewGlobalRef)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NewGlobalRef)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	jintLong rc = 0;
@@ -5460,7 +5460,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NewGlobalRef)
 #endif
 
 #ifndef NO_NewRgn
-JNIEXPORT jintLong JNICALL OS_NATIVE(NewRgn)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(NewRgn)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5480,7 +5480,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NewRgn)
 #endif
 
 #ifndef NO_OffsetRgn
-JNIEXPORT void JNICALL OS_NATIVE(OffsetRgn)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(OffsetRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jshort arg1, jshort arg2)
 {
 	OS_NATIVE_ENTER(env, that, OffsetRgn_FUNC);
@@ -5498,7 +5498,7 @@ JNIEXPORT void JNICALL OS_NATIVE(OffsetRgn)
 #endif
 
 #ifndef NO_OpenRgn
-JNIEXPORT void JNICALL OS_NATIVE(OpenRgn)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(OpenRgn)
 	(JNIEnv *env, jclass that)
 {
 	OS_NATIVE_ENTER(env, that, OpenRgn_FUNC);
@@ -5516,7 +5516,7 @@ JNIEXPORT void JNICALL OS_NATIVE(OpenRgn)
 #endif
 
 #ifndef NO_PMGetDuplex
-JNIEXPORT jintLong JNICALL OS_NATIVE(PMGetDuplex)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(PMGetDuplex)
 	(JNIEnv *env, jclass that, jintLong arg0, jintArray arg1)
 {
 	jint *lparg1=NULL;
@@ -5540,7 +5540,7 @@ fail:
 #endif
 
 #ifndef NO_PMPrinterGetIndexedPrinterResolution
-JNIEXPORT jintLong JNICALL OS_NATIVE(PMPrinterGetIndexedPrinterResolution)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(PMPrinterGetIndexedPrinterResolution)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 {
 	PMResolution _arg2, *lparg2=NULL;
@@ -5564,7 +5564,7 @@ fail:
 #endif
 
 #ifndef NO_PMPrinterGetOutputResolution
-JNIEXPORT jintLong JNICALL OS_NATIVE(PMPrinterGetOutputResolution)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(PMPrinterGetOutputResolution)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 {
 	PMResolution _arg2, *lparg2=NULL;
@@ -5588,7 +5588,7 @@ fail:
 #endif
 
 #ifndef NO_PMPrinterGetPrinterResolutionCount
-JNIEXPORT jintLong JNICALL OS_NATIVE(PMPrinterGetPrinterResolutionCount)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(PMPrinterGetPrinterResolutionCount)
 	(JNIEnv *env, jclass that, jintLong arg0, jintArray arg1)
 {
 	jint *lparg1=NULL;
@@ -5612,7 +5612,7 @@ fail:
 #endif
 
 #ifndef NO_PMSessionGetCurrentPrinter
-JNIEXPORT jintLong JNICALL OS_NATIVE(PMSessionGetCurrentPrinter)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(PMSessionGetCurrentPrinter)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLongArray arg1)
 {
 	jintLong *lparg1=NULL;
@@ -5636,7 +5636,7 @@ fail:
 #endif
 
 #ifndef NO_PMSessionGetDestinationType
-JNIEXPORT jintLong JNICALL OS_NATIVE(PMSessionGetDestinationType)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(PMSessionGetDestinationType)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jshortArray arg2)
 {
 	jshort *lparg2=NULL;
@@ -5660,7 +5660,7 @@ fail:
 #endif
 
 #ifndef NO_PMSetDuplex
-JNIEXPORT jintLong JNICALL OS_NATIVE(PMSetDuplex)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(PMSetDuplex)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jintLong rc = 0;
@@ -5680,7 +5680,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(PMSetDuplex)
 #endif
 
 #ifndef NO_PtInRgn
-JNIEXPORT jboolean JNICALL OS_NATIVE(PtInRgn)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(PtInRgn)
 	(JNIEnv *env, jclass that, jshortArray arg0, jintLong arg1)
 {
 	jshort *lparg0=NULL;
@@ -5704,7 +5704,7 @@ fail:
 #endif
 
 #ifndef NO_QDRegionToRects
-JNIEXPORT jint JNICALL OS_NATIVE(QDRegionToRects)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(QDRegionToRects)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
 {
 	jint rc = 0;
@@ -5724,7 +5724,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(QDRegionToRects)
 #endif
 
 #ifndef NO_RectInRgn
-JNIEXPORT jboolean JNICALL OS_NATIVE(RectInRgn)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(RectInRgn)
 	(JNIEnv *env, jclass that, jshortArray arg0, jintLong arg1)
 {
 	jshort *lparg0=NULL;
@@ -5748,7 +5748,7 @@ fail:
 #endif
 
 #ifndef NO_RectRgn
-JNIEXPORT void JNICALL OS_NATIVE(RectRgn)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(RectRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jshortArray arg1)
 {
 	jshort *lparg1=NULL;
@@ -5770,7 +5770,7 @@ fail:
 #endif
 
 #ifndef NO_SecPolicySearchCopyNext
-JNIEXPORT jint JNICALL OS_NATIVE(SecPolicySearchCopyNext)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SecPolicySearchCopyNext)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLongArray arg1)
 {
 	jintLong *lparg1=NULL;
@@ -5786,7 +5786,7 @@ fail:
 #endif
 
 #ifndef NO_SecPolicySearchCreate
-JNIEXPORT jint JNICALL OS_NATIVE(SecPolicySearchCreate)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SecPolicySearchCreate)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLongArray arg3)
 {
 	jintLong *lparg3=NULL;
@@ -5802,7 +5802,7 @@ fail:
 #endif
 
 #ifndef NO_SecTrustCreateWithCertificates
-JNIEXPORT jint JNICALL OS_NATIVE(SecTrustCreateWithCertificates)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SecTrustCreateWithCertificates)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLongArray arg2)
 {
 	jintLong *lparg2=NULL;
@@ -5818,7 +5818,7 @@ fail:
 #endif
 
 #ifndef NO_SectRgn
-JNIEXPORT void JNICALL OS_NATIVE(SectRgn)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(SectRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 {
 	OS_NATIVE_ENTER(env, that, SectRgn_FUNC);
@@ -5836,7 +5836,7 @@ JNIEXPORT void JNICALL OS_NATIVE(SectRgn)
 #endif
 
 #ifndef NO_SetFrontProcess
-JNIEXPORT jint JNICALL OS_NATIVE(SetFrontProcess)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetFrontProcess)
 	(JNIEnv *env, jclass that, jintArray arg0)
 {
 	jint *lparg0=NULL;
@@ -5852,7 +5852,7 @@ fail:
 #endif
 
 #ifndef NO_SetRect
-JNIEXPORT void JNICALL OS_NATIVE(SetRect)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(SetRect)
 	(JNIEnv *env, jclass that, jshortArray arg0, jshort arg1, jshort arg2, jshort arg3, jshort arg4)
 {
 	jshort *lparg0=NULL;
@@ -5874,7 +5874,7 @@ fail:
 #endif
 
 #ifndef NO_SetSystemUIMode
-JNIEXPORT jint JNICALL OS_NATIVE(SetSystemUIMode)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetSystemUIMode)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	jint rc = 0;
@@ -5894,7 +5894,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetSystemUIMode)
 #endif
 
 #ifndef NO_SetThemeCursor
-JNIEXPORT jint JNICALL OS_NATIVE(SetThemeCursor)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetThemeCursor)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jint rc = 0;
@@ -5914,7 +5914,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetThemeCursor)
 #endif
 
 #ifndef NO_TISCopyCurrentKeyboardInputSource
-JNIEXPORT jintLong JNICALL OS_NATIVE(TISCopyCurrentKeyboardInputSource)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(TISCopyCurrentKeyboardInputSource)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5934,7 +5934,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(TISCopyCurrentKeyboardInputSource)
 #endif
 
 #ifndef NO_TISGetInputSourceProperty
-JNIEXPORT jintLong JNICALL OS_NATIVE(TISGetInputSourceProperty)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(TISGetInputSourceProperty)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -5954,7 +5954,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(TISGetInputSourceProperty)
 #endif
 
 #ifndef NO_TransformProcessType
-JNIEXPORT jint JNICALL OS_NATIVE(TransformProcessType)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TransformProcessType)
 	(JNIEnv *env, jclass that, jintArray arg0, jint arg1)
 {
 	jint *lparg0=NULL;
@@ -5970,7 +5970,7 @@ fail:
 #endif
 
 #ifndef NO_UCKeyTranslate
-JNIEXPORT jint JNICALL OS_NATIVE(UCKeyTranslate)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(UCKeyTranslate)
 	(JNIEnv *env, jclass that, jintLong arg0, jshort arg1, jshort arg2, jint arg3, jint arg4, jint arg5, jintArray arg6, jint arg7, jintArray arg8, jcharArray arg9)
 {
 	jint *lparg6=NULL;
@@ -6000,7 +6000,7 @@ fail:
 #endif
 
 #ifndef NO_UTTypeEqual
-JNIEXPORT jboolean JNICALL OS_NATIVE(UTTypeEqual)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(UTTypeEqual)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jboolean rc = 0;
@@ -6012,7 +6012,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(UTTypeEqual)
 #endif
 
 #ifndef NO_UnionRgn
-JNIEXPORT void JNICALL OS_NATIVE(UnionRgn)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(UnionRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 {
 	OS_NATIVE_ENTER(env, that, UnionRgn_FUNC);
@@ -6030,7 +6030,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UnionRgn)
 #endif
 
 #ifndef NO_call
-JNIEXPORT void JNICALL OS_NATIVE(call)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(call)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 {
 	OS_NATIVE_ENTER(env, that, call_FUNC);
@@ -6040,7 +6040,7 @@ JNIEXPORT void JNICALL OS_NATIVE(call)
 #endif
 
 #ifndef NO_class_1addIvar
-JNIEXPORT jboolean JNICALL OS_NATIVE(class_1addIvar)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(class_1addIvar)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jintLong arg2, jbyte arg3, jbyteArray arg4)
 {
 	jbyte *lparg1=NULL;
@@ -6061,13 +6061,13 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(class_1addIvar)
 fail:
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
-		if (arg4 && lparg4) (*env)->ReleasePrimitiveArrayCritical(env, arg4, lparg4, 0);
-		if (arg1 && lparg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, 0);
+		if (arg4 && lparg4) (*env)->ReleasePrimitiveArrayCritical(env, arg4, lparg4, JNI_ABORT);
+		if (arg1 && lparg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, JNI_ABORT);
 	} else
 #endif
 	{
-		if (arg4 && lparg4) (*env)->ReleaseByteArrayElements(env, arg4, lparg4, 0);
-		if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+		if (arg4 && lparg4) (*env)->ReleaseByteArrayElements(env, arg4, lparg4, JNI_ABORT);
+		if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	}
 	OS_NATIVE_EXIT(env, that, class_1addIvar_FUNC);
 	return rc;
@@ -6075,7 +6075,7 @@ fail:
 #endif
 
 #ifndef NO_class_1addMethod
-JNIEXPORT jboolean JNICALL OS_NATIVE(class_1addMethod)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(class_1addMethod)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jstring arg3)
 {
 	const char *lparg3= NULL;
@@ -6091,7 +6091,7 @@ fail:
 #endif
 
 #ifndef NO_class_1addProtocol
-JNIEXPORT jboolean JNICALL OS_NATIVE(class_1addProtocol)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(class_1addProtocol)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jboolean rc = 0;
@@ -6103,7 +6103,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(class_1addProtocol)
 #endif
 
 #ifndef NO_class_1createInstance
-JNIEXPORT jintLong JNICALL OS_NATIVE(class_1createInstance)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(class_1createInstance)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -6115,7 +6115,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(class_1createInstance)
 #endif
 
 #ifndef NO_class_1getClassMethod
-JNIEXPORT jintLong JNICALL OS_NATIVE(class_1getClassMethod)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(class_1getClassMethod)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -6127,7 +6127,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(class_1getClassMethod)
 #endif
 
 #ifndef NO_class_1getInstanceMethod
-JNIEXPORT jintLong JNICALL OS_NATIVE(class_1getInstanceMethod)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(class_1getInstanceMethod)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -6139,7 +6139,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(class_1getInstanceMethod)
 #endif
 
 #ifndef NO_class_1getMethodImplementation
-JNIEXPORT jintLong JNICALL OS_NATIVE(class_1getMethodImplementation)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(class_1getMethodImplementation)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -6151,7 +6151,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(class_1getMethodImplementation)
 #endif
 
 #ifndef NO_class_1getSuperclass
-JNIEXPORT jintLong JNICALL OS_NATIVE(class_1getSuperclass)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(class_1getSuperclass)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -6163,7 +6163,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(class_1getSuperclass)
 #endif
 
 #ifndef NO_getpid
-JNIEXPORT jint JNICALL OS_NATIVE(getpid)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(getpid)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -6175,7 +6175,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(getpid)
 #endif
 
 #ifndef NO_instrumentObjcMessageSends
-JNIEXPORT void JNICALL OS_NATIVE(instrumentObjcMessageSends)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(instrumentObjcMessageSends)
 	(JNIEnv *env, jclass that, jboolean arg0)
 {
 	OS_NATIVE_ENTER(env, that, instrumentObjcMessageSends_FUNC);
@@ -6193,7 +6193,7 @@ JNIEXPORT void JNICALL OS_NATIVE(instrumentObjcMessageSends)
 #endif
 
 #ifndef NO_kCFAllocatorDefault
-JNIEXPORT jintLong JNICALL OS_NATIVE(kCFAllocatorDefault)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(kCFAllocatorDefault)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -6205,7 +6205,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(kCFAllocatorDefault)
 #endif
 
 #ifndef NO_kCFRunLoopCommonModes
-JNIEXPORT jintLong JNICALL OS_NATIVE(kCFRunLoopCommonModes)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(kCFRunLoopCommonModes)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -6217,7 +6217,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(kCFRunLoopCommonModes)
 #endif
 
 #ifndef NO_kCFTypeDictionaryKeyCallBacks
-JNIEXPORT jintLong JNICALL OS_NATIVE(kCFTypeDictionaryKeyCallBacks)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(kCFTypeDictionaryKeyCallBacks)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -6229,7 +6229,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(kCFTypeDictionaryKeyCallBacks)
 #endif
 
 #ifndef NO_kCFTypeDictionaryValueCallBacks
-JNIEXPORT jintLong JNICALL OS_NATIVE(kCFTypeDictionaryValueCallBacks)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(kCFTypeDictionaryValueCallBacks)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -6241,7 +6241,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(kCFTypeDictionaryValueCallBacks)
 #endif
 
 #ifndef NO_kCTFontAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(kCTFontAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(kCTFontAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -6253,7 +6253,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(kCTFontAttributeName)
 #endif
 
 #ifndef NO_kCTForegroundColorAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(kCTForegroundColorAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(kCTForegroundColorAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -6265,7 +6265,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(kCTForegroundColorAttributeName)
 #endif
 
 #ifndef NO_kCTParagraphStyleAttributeName
-JNIEXPORT jintLong JNICALL OS_NATIVE(kCTParagraphStyleAttributeName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(kCTParagraphStyleAttributeName)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -6277,7 +6277,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(kCTParagraphStyleAttributeName)
 #endif
 
 #ifndef NO_kUTTypeFileURL
-JNIEXPORT jintLong JNICALL OS_NATIVE(kUTTypeFileURL)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(kUTTypeFileURL)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -6289,7 +6289,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(kUTTypeFileURL)
 #endif
 
 #ifndef NO_kUTTypeURL
-JNIEXPORT jintLong JNICALL OS_NATIVE(kUTTypeURL)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(kUTTypeURL)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -6302,9 +6302,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(kUTTypeURL)
 
 #if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_CFRange_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_CFRange_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CFRange_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CFRange_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CFRange_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CFRange_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #endif
 {
 	CFRange _arg1, *lparg1=NULL;
@@ -6327,9 +6327,9 @@ fail:
 
 #if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_CGAffineTransform_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_CGAffineTransform_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CGAffineTransform_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CGAffineTransform_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CGAffineTransform_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CGAffineTransform_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #endif
 {
 	CGAffineTransform _arg1, *lparg1=NULL;
@@ -6352,9 +6352,9 @@ fail:
 
 #if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_CGPathElement_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_CGPathElement_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CGPathElement_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CGPathElement_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CGPathElement_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CGPathElement_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #endif
 {
 	CGPathElement _arg1, *lparg1=NULL;
@@ -6377,9 +6377,9 @@ fail:
 
 #if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_CGPoint_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_CGPoint_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CGPoint_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CGPoint_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CGPoint_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CGPoint_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #endif
 {
 	CGPoint _arg1, *lparg1=NULL;
@@ -6402,9 +6402,9 @@ fail:
 
 #if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_CGRect_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_CGRect_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CGRect_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CGRect_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CGRect_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CGRect_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #endif
 {
 	CGRect _arg1, *lparg1=NULL;
@@ -6427,9 +6427,9 @@ fail:
 
 #if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_CGSize_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_CGSize_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CGSize_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CGSize_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CGSize_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CGSize_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #endif
 {
 	CGSize _arg1, *lparg1=NULL;
@@ -6452,9 +6452,9 @@ fail:
 
 #if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #endif
 {
 	CTParagraphStyleSetting _arg1, *lparg1=NULL;
@@ -6477,9 +6477,9 @@ fail:
 
 #if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #endif
 {
 	NSAffineTransformStruct _arg1, *lparg1=NULL;
@@ -6502,9 +6502,9 @@ fail:
 
 #if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_NSPoint_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_NSPoint_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_NSPoint_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_NSPoint_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_NSPoint_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_NSPoint_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #endif
 {
 	NSPoint _arg1, *lparg1=NULL;
@@ -6527,9 +6527,9 @@ fail:
 
 #if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_NSRange_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_NSRange_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_NSRange_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_NSRange_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_NSRange_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_NSRange_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #endif
 {
 	NSRange _arg1, *lparg1=NULL;
@@ -6552,9 +6552,9 @@ fail:
 
 #if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #endif
 {
 	NSRect _arg1, *lparg1=NULL;
@@ -6577,9 +6577,9 @@ fail:
 
 #if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_NSSize_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_NSSize_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_NSSize_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_NSSize_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_NSSize_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_NSSize_2J)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 #endif
 {
 	NSSize _arg1, *lparg1=NULL;
@@ -6602,9 +6602,9 @@ fail:
 
 #if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CFRange_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CFRange_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CFRange_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CFRange_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CFRange_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CFRange_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	CFRange _arg0, *lparg0=NULL;
@@ -6627,9 +6627,9 @@ fail:
 
 #if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGAffineTransform_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGAffineTransform_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGAffineTransform_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGAffineTransform_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGAffineTransform_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGAffineTransform_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	CGAffineTransform _arg0, *lparg0=NULL;
@@ -6652,9 +6652,9 @@ fail:
 
 #if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGPathElement_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGPathElement_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGPathElement_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGPathElement_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGPathElement_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGPathElement_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	CGPathElement _arg0, *lparg0=NULL;
@@ -6677,9 +6677,9 @@ fail:
 
 #if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGPoint_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGPoint_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGPoint_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGPoint_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGPoint_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGPoint_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	CGPoint _arg0, *lparg0=NULL;
@@ -6702,9 +6702,9 @@ fail:
 
 #if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGRect_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGRect_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGRect_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGRect_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGRect_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGRect_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	CGRect _arg0, *lparg0=NULL;
@@ -6727,9 +6727,9 @@ fail:
 
 #if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGSize_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGSize_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGSize_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGSize_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGSize_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGSize_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	CGSize _arg0, *lparg0=NULL;
@@ -6752,9 +6752,9 @@ fail:
 
 #if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	CTParagraphStyleSetting _arg0, *lparg0=NULL;
@@ -6777,9 +6777,9 @@ fail:
 
 #if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	NSAffineTransformStruct _arg0, *lparg0=NULL;
@@ -6802,9 +6802,9 @@ fail:
 
 #if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSPoint_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSPoint_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSPoint_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	NSPoint _arg0, *lparg0=NULL;
@@ -6827,9 +6827,9 @@ fail:
 
 #if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSRange_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSRange_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSRange_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	NSRange _arg0, *lparg0=NULL;
@@ -6852,9 +6852,9 @@ fail:
 
 #if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSRect_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSRect_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSRect_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -6877,9 +6877,9 @@ fail:
 
 #if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSSize_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSSize_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSSize_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	NSSize _arg0, *lparg0=NULL;
@@ -6901,7 +6901,7 @@ fail:
 #endif
 
 #ifndef NO_method_1setImplementation
-JNIEXPORT jintLong JNICALL OS_NATIVE(method_1setImplementation)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(method_1setImplementation)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -6913,7 +6913,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(method_1setImplementation)
 #endif
 
 #ifndef NO_objc_1allocateClassPair
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1allocateClassPair)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1allocateClassPair)
 	(JNIEnv *env, jclass that, jintLong arg0, jstring arg1, jintLong arg2)
 {
 	const char *lparg1= NULL;
@@ -6929,7 +6929,7 @@ fail:
 #endif
 
 #ifndef NO_objc_1disposeClassPair
-JNIEXPORT void JNICALL OS_NATIVE(objc_1disposeClassPair)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1disposeClassPair)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, objc_1disposeClassPair_FUNC);
@@ -6939,7 +6939,7 @@ JNIEXPORT void JNICALL OS_NATIVE(objc_1disposeClassPair)
 #endif
 
 #ifndef NO_objc_1getClass
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1getClass)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1getClass)
 	(JNIEnv *env, jclass that, jstring arg0)
 {
 	const char *lparg0= NULL;
@@ -6955,7 +6955,7 @@ fail:
 #endif
 
 #ifndef NO_objc_1getMetaClass
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1getMetaClass)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1getMetaClass)
 	(JNIEnv *env, jclass that, jstring arg0)
 {
 	const char *lparg0= NULL;
@@ -6971,7 +6971,7 @@ fail:
 #endif
 
 #ifndef NO_objc_1getProtocol
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1getProtocol)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1getProtocol)
 	(JNIEnv *env, jclass that, jstring arg0)
 {
 	const char *lparg0= NULL;
@@ -6987,7 +6987,7 @@ fail:
 #endif
 
 #ifndef NO_objc_1lookUpClass
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1lookUpClass)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1lookUpClass)
 	(JNIEnv *env, jclass that, jstring arg0)
 {
 	const char *lparg0= NULL;
@@ -7004,9 +7004,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 #endif
 {
 	jintLong rc = 0;
@@ -7027,9 +7027,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ)(JNIEnv *env, jclass that
 
 #if (!defined(NO_objc_1msgSend__IID) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJD) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IID)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IID)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2)
 #endif
 {
 	jintLong rc = 0;
@@ -7050,9 +7050,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJD)(JNIEnv *env, jclass tha
 
 #if (!defined(NO_objc_1msgSend__IIDIIIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJDJJJZ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIDIIIZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2, jintLong arg3, jintLong arg4, jintLong arg5, jboolean arg6)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIDIIIZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2, jintLong arg3, jintLong arg4, jintLong arg5, jboolean arg6)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJDJJJZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2, jintLong arg3, jintLong arg4, jintLong arg5, jboolean arg6)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJDJJJZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2, jintLong arg3, jintLong arg4, jintLong arg5, jboolean arg6)
 #endif
 {
 	jintLong rc = 0;
@@ -7072,7 +7072,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJDJJJZ)(JNIEnv *env, jclass
 #endif
 
 #ifndef NO_objc_1msgSend__IIF
-JNIEXPORT jint JNICALL OS_NATIVE(objc_1msgSend__IIF)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(objc_1msgSend__IIF)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jfloat arg2)
 {
 	jint rc = 0;
@@ -7085,9 +7085,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(objc_1msgSend__IIF)
 
 #if (!defined(NO_objc_1msgSend__IIFF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJDD) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIFF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDouble arg2, jfloatDouble arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIFF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDouble arg2, jfloatDouble arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJDD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDouble arg2, jfloatDouble arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJDD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDouble arg2, jfloatDouble arg3)
 #endif
 {
 	jintLong rc = 0;
@@ -7108,9 +7108,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJDD)(JNIEnv *env, jclass th
 
 #if (!defined(NO_objc_1msgSend__IIFFFF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJDDDD) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIFFFF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDouble arg2, jfloatDouble arg3, jfloatDouble arg4, jfloatDouble arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIFFFF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDouble arg2, jfloatDouble arg3, jfloatDouble arg4, jfloatDouble arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJDDDD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDouble arg2, jfloatDouble arg3, jfloatDouble arg4, jfloatDouble arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJDDDD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDouble arg2, jfloatDouble arg3, jfloatDouble arg4, jfloatDouble arg5)
 #endif
 {
 	jintLong rc = 0;
@@ -7131,9 +7131,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJDDDD)(JNIEnv *env, jclass
 
 #if (!defined(NO_objc_1msgSend__IIFI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJDJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIFI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDouble arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIFI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDouble arg2, jintLong arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJDJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDouble arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJDJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDouble arg2, jintLong arg3)
 #endif
 {
 	jintLong rc = 0;
@@ -7154,9 +7154,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJDJ)(JNIEnv *env, jclass th
 
 #if (!defined(NO_objc_1msgSend__III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	jintLong rc = 0;
@@ -7177,9 +7177,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJ)(JNIEnv *env, jclass tha
 
 #if (!defined(NO_objc_1msgSend__IIIF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJD) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jfloatDouble arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jfloatDouble arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jfloatDouble arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jfloatDouble arg3)
 #endif
 {
 	jintLong rc = 0;
@@ -7200,9 +7200,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJD)(JNIEnv *env, jclass th
 
 #if (!defined(NO_objc_1msgSend__IIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 #endif
 {
 	jintLong rc = 0;
@@ -7223,9 +7223,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJ)(JNIEnv *env, jclass th
 
 #if (!defined(NO_objc_1msgSend__IIIIDI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJDJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIDI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jdouble arg4, jintLong arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIDI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jdouble arg4, jintLong arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJDJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jdouble arg4, jintLong arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJDJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jdouble arg4, jintLong arg5)
 #endif
 {
 	jintLong rc = 0;
@@ -7246,9 +7246,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJDJ)(JNIEnv *env, jclass
 
 #if (!defined(NO_objc_1msgSend__IIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4)
 #endif
 {
 	jintLong rc = 0;
@@ -7269,9 +7269,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJ)(JNIEnv *env, jclass t
 
 #if (!defined(NO_objc_1msgSend__IIIIIF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJD) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIIF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jfloatDouble arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIIF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jfloatDouble arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jfloatDouble arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jfloatDouble arg5)
 #endif
 {
 	jintLong rc = 0;
@@ -7292,9 +7292,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJD)(JNIEnv *env, jclass
 
 #if (!defined(NO_objc_1msgSend__IIIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5)
 #endif
 {
 	jintLong rc = 0;
@@ -7315,9 +7315,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJ)(JNIEnv *env, jclass
 
 #if (!defined(NO_objc_1msgSend__IIIIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6)
 #endif
 {
 	jintLong rc = 0;
@@ -7338,9 +7338,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJJ)(JNIEnv *env, jclass
 
 #if (!defined(NO_objc_1msgSend__IIIIIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jintLong arg7)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jintLong arg7)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jintLong arg7)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jintLong arg7)
 #endif
 {
 	jintLong rc = 0;
@@ -7361,9 +7361,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJJJ)(JNIEnv *env, jclas
 
 #if (!defined(NO_objc_1msgSend__IIIIIIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJJJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jintLong arg7, jintLong arg8)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jintLong arg7, jintLong arg8)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jintLong arg7, jintLong arg8)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jintLong arg7, jintLong arg8)
 #endif
 {
 	jintLong rc = 0;
@@ -7384,9 +7384,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJJJJ)(JNIEnv *env, jcla
 
 #if (!defined(NO_objc_1msgSend__IIIIIIIZZIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJJJZZJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIIIIZZIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jboolean arg7, jboolean arg8, jintLong arg9, jintLong arg10, jintLong arg11)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIIIIZZIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jboolean arg7, jboolean arg8, jintLong arg9, jintLong arg10, jintLong arg11)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJJZZJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jboolean arg7, jboolean arg8, jintLong arg9, jintLong arg10, jintLong arg11)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJJZZJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jboolean arg7, jboolean arg8, jintLong arg9, jintLong arg10, jintLong arg11)
 #endif
 {
 	jintLong rc = 0;
@@ -7407,9 +7407,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJJZZJJJ)(JNIEnv *env, j
 
 #if (!defined(NO_objc_1msgSend__IIIIIIIZZIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJJJZZJJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIIIIZZIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jboolean arg7, jboolean arg8, jintLong arg9, jintLong arg10, jintLong arg11, jintLong arg12)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIIIIZZIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jboolean arg7, jboolean arg8, jintLong arg9, jintLong arg10, jintLong arg11, jintLong arg12)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJJZZJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jboolean arg7, jboolean arg8, jintLong arg9, jintLong arg10, jintLong arg11, jintLong arg12)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJJZZJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jboolean arg7, jboolean arg8, jintLong arg9, jintLong arg10, jintLong arg11, jintLong arg12)
 #endif
 {
 	jintLong rc = 0;
@@ -7430,9 +7430,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJJJZZJJJJ)(JNIEnv *env,
 
 #if (!defined(NO_objc_1msgSend__IIIIIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJZ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIIZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jboolean arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIIZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jboolean arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jboolean arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jboolean arg5)
 #endif
 {
 	jintLong rc = 0;
@@ -7453,9 +7453,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJJZ)(JNIEnv *env, jclass
 
 #if (!defined(NO_objc_1msgSend__IIIILorg_eclipse_swt_internal_cocoa_NSRange_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJLorg_eclipse_swt_internal_cocoa_NSRange_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIILorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jobject arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIILorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jobject arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJLorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jobject arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJLorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jobject arg4)
 #endif
 {
 	NSRange _arg4, *lparg4=NULL;
@@ -7480,9 +7480,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IIIIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJZ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jboolean arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIIZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jboolean arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jboolean arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jboolean arg4)
 #endif
 {
 	jintLong rc = 0;
@@ -7503,9 +7503,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJJZ)(JNIEnv *env, jclass t
 
 #if (!defined(NO_objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	NSPoint _arg3, *lparg3=NULL;
@@ -7530,9 +7530,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #endif
 {
 	NSPoint _arg3, *lparg3=NULL;
@@ -7557,9 +7557,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2IDIIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2JDJJJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2IDIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4, jdouble arg5, jintLong arg6, jintLong arg7, jintLong arg8, jintLong arg9, jintLong arg10)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2IDIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4, jdouble arg5, jintLong arg6, jintLong arg7, jintLong arg8, jintLong arg9, jintLong arg10)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2JDJJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4, jdouble arg5, jintLong arg6, jintLong arg7, jintLong arg8, jintLong arg9, jintLong arg10)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2JDJJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4, jdouble arg5, jintLong arg6, jintLong arg7, jintLong arg8, jintLong arg9, jintLong arg10)
 #endif
 {
 	NSPoint _arg3, *lparg3=NULL;
@@ -7584,9 +7584,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2IDIISII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2JDJJSJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2IDIISII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4, jdouble arg5, jintLong arg6, jintLong arg7, jshort arg8, jintLong arg9, jintLong arg10)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2IDIISII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4, jdouble arg5, jintLong arg6, jintLong arg7, jshort arg8, jintLong arg9, jintLong arg10)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2JDJJSJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4, jdouble arg5, jintLong arg6, jintLong arg7, jshort arg8, jintLong arg9, jintLong arg10)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2JDJJSJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4, jdouble arg5, jintLong arg6, jintLong arg7, jshort arg8, jintLong arg9, jintLong arg10)
 #endif
 {
 	NSPoint _arg3, *lparg3=NULL;
@@ -7611,9 +7611,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSSize_2IIIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSSize_2JJJZ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSSize_2IIIZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jobject arg4, jintLong arg5, jintLong arg6, jintLong arg7, jboolean arg8)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSSize_2IIIZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jobject arg4, jintLong arg5, jintLong arg6, jintLong arg7, jboolean arg8)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSSize_2JJJZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jobject arg4, jintLong arg5, jintLong arg6, jintLong arg7, jboolean arg8)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSSize_2JJJZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jobject arg4, jintLong arg5, jintLong arg6, jintLong arg7, jboolean arg8)
 #endif
 {
 	NSPoint _arg3, *lparg3=NULL;
@@ -7641,9 +7641,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSRange_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSRange_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	NSRange _arg3, *lparg3=NULL;
@@ -7668,9 +7668,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #endif
 {
 	NSRect _arg3, *lparg3=NULL;
@@ -7695,9 +7695,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IIIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJZ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jboolean arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIIZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jboolean arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jboolean arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jboolean arg3)
 #endif
 {
 	jintLong rc = 0;
@@ -7718,9 +7718,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJJZ)(JNIEnv *env, jclass th
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 #endif
 {
 	NSAffineTransformStruct _arg2, *lparg2=NULL;
@@ -7745,9 +7745,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 #endif
 {
 	NSPoint _arg2, *lparg2=NULL;
@@ -7772,9 +7772,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2FFF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2DDD) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2FFF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3, jfloatDouble arg4, jfloatDouble arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2FFF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3, jfloatDouble arg4, jfloatDouble arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2DDD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3, jfloatDouble arg4, jfloatDouble arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2DDD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3, jfloatDouble arg4, jfloatDouble arg5)
 #endif
 {
 	NSPoint _arg2, *lparg2=NULL;
@@ -7799,9 +7799,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2FFFZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2DDDZ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2FFFZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3, jfloatDouble arg4, jfloatDouble arg5, jboolean arg6)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2FFFZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3, jfloatDouble arg4, jfloatDouble arg5, jboolean arg6)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2DDDZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3, jfloatDouble arg4, jfloatDouble arg5, jboolean arg6)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2DDDZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3, jfloatDouble arg4, jfloatDouble arg5, jboolean arg6)
 #endif
 {
 	NSPoint _arg2, *lparg2=NULL;
@@ -7826,9 +7826,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
 #endif
 {
 	NSPoint _arg2, *lparg2=NULL;
@@ -7853,9 +7853,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2I_3F) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J_3D) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2I_3F)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jfloatDoubleArray arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2I_3F)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jfloatDoubleArray arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J_3D)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jfloatDoubleArray arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J_3D)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jfloatDoubleArray arg4)
 #endif
 {
 	NSPoint _arg2, *lparg2=NULL;
@@ -7883,9 +7883,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4)
 #endif
 {
 	NSPoint _arg2, *lparg2=NULL;
@@ -7913,9 +7913,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jobject arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jobject arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jobject arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jobject arg4)
 #endif
 {
 	NSPoint _arg2, *lparg2=NULL;
@@ -7946,9 +7946,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2IF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2JD) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2IF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4, jfloatDouble arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2IF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4, jfloatDouble arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2JD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4, jfloatDouble arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2JD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4, jfloatDouble arg5)
 #endif
 {
 	NSPoint _arg2, *lparg2=NULL;
@@ -7976,9 +7976,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 #endif
 {
 	NSRange _arg2, *lparg2=NULL;
@@ -8003,9 +8003,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
 #endif
 {
 	NSRange _arg2, *lparg2=NULL;
@@ -8030,9 +8030,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2IIII_3B) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2JJJJ_3B) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2IIII_3B)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jbyteArray arg7)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2IIII_3B)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jbyteArray arg7)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2JJJJ_3B)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jbyteArray arg7)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2JJJJ_3B)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jbyteArray arg7)
 #endif
 {
 	NSRange _arg2, *lparg2=NULL;
@@ -8060,9 +8060,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3)
 #endif
 {
 	NSRange _arg2, *lparg2=NULL;
@@ -8090,9 +8090,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRange_2I_3I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRange_2J_3J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRange_2I_3I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4, jintLongArray arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRange_2I_3I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4, jintLongArray arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRange_2J_3J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4, jintLongArray arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRange_2J_3J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4, jintLongArray arg5)
 #endif
 {
 	NSRange _arg2, *lparg2=NULL;
@@ -8123,9 +8123,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 #endif
 {
 	NSRect _arg2, *lparg2=NULL;
@@ -8150,9 +8150,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2F) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2D) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2F)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2F)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2D)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2D)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3)
 #endif
 {
 	NSRect _arg2, *lparg2=NULL;
@@ -8177,9 +8177,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2FF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2DD) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2FF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3, jfloatDouble arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2FF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3, jfloatDouble arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2DD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3, jfloatDouble arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2DD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jfloatDouble arg3, jfloatDouble arg4)
 #endif
 {
 	NSRect _arg2, *lparg2=NULL;
@@ -8204,9 +8204,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
 #endif
 {
 	NSRect _arg2, *lparg2=NULL;
@@ -8231,9 +8231,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4)
 #endif
 {
 	NSRect _arg2, *lparg2=NULL;
@@ -8258,9 +8258,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jintLong arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jintLong arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jintLong arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jintLong arg5)
 #endif
 {
 	NSRect _arg2, *lparg2=NULL;
@@ -8285,9 +8285,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2IIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJZ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2IIZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jboolean arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2IIZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jboolean arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jboolean arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jboolean arg5)
 #endif
 {
 	NSRect _arg2, *lparg2=NULL;
@@ -8312,9 +8312,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2IIZI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJZJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2IIZI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jboolean arg5, jintLong arg6)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2IIZI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jboolean arg5, jintLong arg6)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJZJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jboolean arg5, jintLong arg6)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJZJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jintLong arg4, jboolean arg5, jintLong arg6)
 #endif
 {
 	NSRect _arg2, *lparg2=NULL;
@@ -8339,9 +8339,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2IZI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JZJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2IZI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jboolean arg4, jintLong arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2IZI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jboolean arg4, jintLong arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JZJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jboolean arg4, jintLong arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JZJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3, jboolean arg4, jintLong arg5)
 #endif
 {
 	NSRect _arg2, *lparg2=NULL;
@@ -8366,9 +8366,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3)
 #endif
 {
 	NSRect _arg2, *lparg2=NULL;
@@ -8396,9 +8396,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jobject arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jobject arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jobject arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jobject arg4)
 #endif
 {
 	NSRect _arg2, *lparg2=NULL;
@@ -8429,9 +8429,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRect_2IF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRect_2JD) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRect_2IF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4, jfloatDouble arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRect_2IF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4, jfloatDouble arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRect_2JD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4, jfloatDouble arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRect_2JD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4, jfloatDouble arg5)
 #endif
 {
 	NSRect _arg2, *lparg2=NULL;
@@ -8459,9 +8459,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Z) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Z) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Z)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jboolean arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Z)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jboolean arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Z)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jboolean arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Z)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jboolean arg3)
 #endif
 {
 	NSRect _arg2, *lparg2=NULL;
@@ -8486,9 +8486,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2ZZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2ZZ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2ZZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jboolean arg3, jboolean arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2ZZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jboolean arg3, jboolean arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2ZZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jboolean arg3, jboolean arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2ZZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jboolean arg3, jboolean arg4)
 #endif
 {
 	NSRect _arg2, *lparg2=NULL;
@@ -8513,9 +8513,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSSize_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSSize_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSSize_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSSize_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSSize_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSSize_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 #endif
 {
 	NSSize _arg2, *lparg2=NULL;
@@ -8540,9 +8540,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__IIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJZ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJZ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2)
 #endif
 {
 	jintLong rc = 0;
@@ -8563,9 +8563,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJZ)(JNIEnv *env, jclass tha
 
 #if (!defined(NO_objc_1msgSend__IIZI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJZJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIZI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIZI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2, jintLong arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJZJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJZJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2, jintLong arg3)
 #endif
 {
 	jintLong rc = 0;
@@ -8586,9 +8586,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJZJ)(JNIEnv *env, jclass th
 
 #if (!defined(NO_objc_1msgSend__IIZLorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJZLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIZLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__IIZLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJZLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJZLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2, jobject arg3)
 #endif
 {
 	NSRect _arg3, *lparg3=NULL;
@@ -8613,9 +8613,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__II_3B) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3B) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3B)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jbyteArray arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3B)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jbyteArray arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3B)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jbyteArray arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3B)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jbyteArray arg2)
 #endif
 {
 	jbyte *lparg2=NULL;
@@ -8640,9 +8640,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__II_3BI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3BJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3BI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jbyteArray arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3BI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jbyteArray arg2, jintLong arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3BJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jbyteArray arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3BJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jbyteArray arg2, jintLong arg3)
 #endif
 {
 	jbyte *lparg2=NULL;
@@ -8667,9 +8667,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__II_3C) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3C) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3C)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jcharArray arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3C)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jcharArray arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3C)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jcharArray arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3C)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jcharArray arg2)
 #endif
 {
 	jchar *lparg2=NULL;
@@ -8694,9 +8694,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__II_3CI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3CJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3CI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jcharArray arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3CI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jcharArray arg2, jintLong arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3CJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jcharArray arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3CJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jcharArray arg2, jintLong arg3)
 #endif
 {
 	jchar *lparg2=NULL;
@@ -8721,9 +8721,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__II_3CLorg_eclipse_swt_internal_cocoa_NSRange_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3CLorg_eclipse_swt_internal_cocoa_NSRange_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3CLorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jcharArray arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3CLorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jcharArray arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3CLorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jcharArray arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3CLorg_eclipse_swt_internal_cocoa_NSRange_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jcharArray arg2, jobject arg3)
 #endif
 {
 	jchar *lparg2=NULL;
@@ -8751,9 +8751,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__II_3F) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3D) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3F)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDoubleArray arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3F)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDoubleArray arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3D)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDoubleArray arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3D)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDoubleArray arg2)
 #endif
 {
 	jfloatDouble *lparg2=NULL;
@@ -8778,9 +8778,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__II_3FIF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3DJD) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3FIF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDoubleArray arg2, jintLong arg3, jfloatDouble arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3FIF)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDoubleArray arg2, jintLong arg3, jfloatDouble arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3DJD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDoubleArray arg2, jintLong arg3, jfloatDouble arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3DJD)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDoubleArray arg2, jintLong arg3, jfloatDouble arg4)
 #endif
 {
 	jfloatDouble *lparg2=NULL;
@@ -8805,9 +8805,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__II_3I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLongArray arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLongArray arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLongArray arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLongArray arg2)
 #endif
 {
 	jintLong *lparg2=NULL;
@@ -8832,9 +8832,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__II_3II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3II) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintArray arg2, jint arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintArray arg2, jint arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintArray arg2, jint arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintArray arg2, jint arg3)
 #endif
 {
 	jint *lparg2=NULL;
@@ -8859,9 +8859,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend__II_3III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3JII) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLongArray arg2, jint arg3, jint arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__II_3III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLongArray arg2, jint arg3, jint arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3JII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLongArray arg2, jint arg3, jint arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSend__JJ_3JII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLongArray arg2, jint arg3, jint arg4)
 #endif
 {
 	jintLong *lparg2=NULL;
@@ -8885,7 +8885,7 @@ fail:
 #endif
 
 #ifndef NO_objc_1msgSend__JJI
-JNIEXPORT jlong JNICALL OS_NATIVE(objc_1msgSend__JJI)
+SWT_NATIVE_EXPORT jlong JNICALL OS_NATIVE(objc_1msgSend__JJI)
 	(JNIEnv *env, jclass that, jlong arg0, jlong arg1, jint arg2)
 {
 	jlong rc = 0;
@@ -8897,7 +8897,7 @@ JNIEXPORT jlong JNICALL OS_NATIVE(objc_1msgSend__JJI)
 #endif
 
 #ifndef NO_objc_1msgSend__JJ_3I
-JNIEXPORT jlong JNICALL OS_NATIVE(objc_1msgSend__JJ_3I)
+SWT_NATIVE_EXPORT jlong JNICALL OS_NATIVE(objc_1msgSend__JJ_3I)
 	(JNIEnv *env, jclass that, jlong arg0, jlong arg1, jintArray arg2)
 {
 	jint *lparg2=NULL;
@@ -8913,7 +8913,7 @@ fail:
 #endif
 
 #ifndef NO_objc_1msgSend__JJ_3JJJ
-JNIEXPORT jlong JNICALL OS_NATIVE(objc_1msgSend__JJ_3JJJ)
+SWT_NATIVE_EXPORT jlong JNICALL OS_NATIVE(objc_1msgSend__JJ_3JJJ)
 	(JNIEnv *env, jclass that, jlong arg0, jlong arg1, jlongArray arg2, jlong arg3, jlong arg4)
 {
 	jlong *lparg2=NULL;
@@ -8930,9 +8930,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -8957,9 +8957,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -8984,9 +8984,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2III) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2III)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2III)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -9011,9 +9011,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IIIII)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IIIII)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJJJJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJJJJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -9038,9 +9038,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IIIIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJJJZ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IIIIZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jboolean arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IIIIZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jboolean arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJJJZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jboolean arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJJJZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jboolean arg5)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -9065,9 +9065,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -9095,9 +9095,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -9125,9 +9125,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -9155,9 +9155,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJZ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IIZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jboolean arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IIZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jboolean arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jboolean arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jboolean arg3)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -9182,9 +9182,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -9212,9 +9212,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -9242,9 +9242,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2, jintLong arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2, jintLong arg3)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -9272,9 +9272,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSSize_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSSize_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSSize_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSSize_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSSize_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSSize_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -9302,9 +9302,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JZ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jboolean arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jboolean arg2)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jboolean arg2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jboolean arg2)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -9329,9 +9329,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IZLorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JZLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IZLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jboolean arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IZLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jboolean arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JZLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jboolean arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JZLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jboolean arg2, jobject arg3)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -9359,9 +9359,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -9389,9 +9389,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRange_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRange_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRange_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRange_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2, jintLong arg3)
 #else
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRange_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRange_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jobject arg2, jintLong arg3)
 #endif
 {
 	struct objc_super _arg0, *lparg0=NULL;
@@ -9419,9 +9419,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2II)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2II)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jintLong arg3)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJ)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJ)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jintLong arg3)
 #endif
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -9453,9 +9453,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jintLong arg3, jobject arg4, jintLong arg5)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jintLong arg3, jobject arg4, jintLong arg5)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jintLong arg3, jobject arg4, jintLong arg5)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jintLong arg3, jobject arg4, jintLong arg5)
 #endif
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -9490,9 +9490,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -9527,9 +9527,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #endif
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -9564,9 +9564,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2I)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2I)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2J)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2J)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2)
 #endif
 {
 	NSSize _arg0, *lparg0=NULL;
@@ -9598,9 +9598,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	NSSize _arg0, *lparg0=NULL;
@@ -9635,9 +9635,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2IZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JZ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2IZ)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jboolean arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2IZ)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jboolean arg3)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JZ)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jboolean arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JZ)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jboolean arg3)
 #endif
 {
 	NSSize _arg0, *lparg0=NULL;
@@ -9669,9 +9669,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1bool__II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 #else
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 #endif
 {
 	jboolean rc = 0;
@@ -9692,9 +9692,9 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJ)(JNIEnv *env, jclas
 
 #if (!defined(NO_objc_1msgSend_1bool__III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	jboolean rc = 0;
@@ -9715,9 +9715,9 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJ)(JNIEnv *env, jcla
 
 #if (!defined(NO_objc_1msgSend_1bool__IIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 #else
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 #endif
 {
 	jboolean rc = 0;
@@ -9738,9 +9738,9 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJJ)(JNIEnv *env, jcl
 
 #if (!defined(NO_objc_1msgSend_1bool__IIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4)
 #else
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4)
 #endif
 {
 	jboolean rc = 0;
@@ -9761,9 +9761,9 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJJJ)(JNIEnv *env, jc
 
 #if (!defined(NO_objc_1msgSend_1bool__IIIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJJJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5)
 #else
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5)
 #endif
 {
 	jboolean rc = 0;
@@ -9784,9 +9784,9 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJJJJ)(JNIEnv *env, j
 
 #if (!defined(NO_objc_1msgSend_1bool__IIIIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJJJJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IIIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IIIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6)
 #else
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJJJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6)
 #endif
 {
 	jboolean rc = 0;
@@ -9807,9 +9807,9 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJJJJJ)(JNIEnv *env,
 
 #if (!defined(NO_objc_1msgSend_1bool__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	NSPoint _arg3, *lparg3=NULL;
@@ -9834,9 +9834,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1bool__IIILorg_eclipse_swt_internal_cocoa_NSSize_2Z) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJJLorg_eclipse_swt_internal_cocoa_NSSize_2Z) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IIILorg_eclipse_swt_internal_cocoa_NSSize_2Z)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jboolean arg4)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IIILorg_eclipse_swt_internal_cocoa_NSSize_2Z)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jboolean arg4)
 #else
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJLorg_eclipse_swt_internal_cocoa_NSSize_2Z)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jboolean arg4)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJJLorg_eclipse_swt_internal_cocoa_NSSize_2Z)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3, jboolean arg4)
 #endif
 {
 	NSSize _arg3, *lparg3=NULL;
@@ -9861,9 +9861,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 #else
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 #endif
 {
 	NSPoint _arg2, *lparg2=NULL;
@@ -9888,9 +9888,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3)
 #else
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3)
 #endif
 {
 	NSPoint _arg2, *lparg2=NULL;
@@ -9918,9 +9918,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSRange_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSRange_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSRange_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSRange_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
 #else
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSRange_2J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSRange_2J)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jintLong arg3)
 #endif
 {
 	NSRange _arg2, *lparg2=NULL;
@@ -9945,9 +9945,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 #else
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 #endif
 {
 	NSRect _arg2, *lparg2=NULL;
@@ -9972,9 +9972,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1bool__IIS) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJS) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IIS)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jshort arg2)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__IIS)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jshort arg2)
 #else
-JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJS)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jshort arg2)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJS)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jshort arg2)
 #endif
 {
 	jboolean rc = 0;
@@ -9994,7 +9994,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(objc_1msgSend_1bool__JJS)(JNIEnv *env, jcla
 #endif
 
 #ifndef NO_objc_1msgSend_1floatret
-JNIEXPORT jfloat JNICALL OS_NATIVE(objc_1msgSend_1floatret)
+SWT_NATIVE_EXPORT jfloat JNICALL OS_NATIVE(objc_1msgSend_1floatret)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jfloat rc = 0;
@@ -10007,9 +10007,9 @@ JNIEXPORT jfloat JNICALL OS_NATIVE(objc_1msgSend_1floatret)
 
 #if (!defined(NO_objc_1msgSend_1fpret__II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1fpret__JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jdouble JNICALL OS_NATIVE(objc_1msgSend_1fpret__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
+SWT_NATIVE_EXPORT jdouble JNICALL OS_NATIVE(objc_1msgSend_1fpret__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 #else
-JNIEXPORT jdouble JNICALL OS_NATIVE(objc_1msgSend_1fpret__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
+SWT_NATIVE_EXPORT jdouble JNICALL OS_NATIVE(objc_1msgSend_1fpret__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 #endif
 {
 	jdouble rc = 0;
@@ -10030,9 +10030,9 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(objc_1msgSend_1fpret__JJ)(JNIEnv *env, jclas
 
 #if (!defined(NO_objc_1msgSend_1fpret__III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1fpret__JJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jdouble JNICALL OS_NATIVE(objc_1msgSend_1fpret__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT jdouble JNICALL OS_NATIVE(objc_1msgSend_1fpret__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT jdouble JNICALL OS_NATIVE(objc_1msgSend_1fpret__JJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT jdouble JNICALL OS_NATIVE(objc_1msgSend_1fpret__JJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	jdouble rc = 0;
@@ -10053,9 +10053,9 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(objc_1msgSend_1fpret__JJJ)(JNIEnv *env, jcla
 
 #if (!defined(NO_objc_1msgSend_1fpret__IIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1fpret__JJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jdouble JNICALL OS_NATIVE(objc_1msgSend_1fpret__IIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jdouble JNICALL OS_NATIVE(objc_1msgSend_1fpret__IIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 #else
-JNIEXPORT jdouble JNICALL OS_NATIVE(objc_1msgSend_1fpret__JJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jdouble JNICALL OS_NATIVE(objc_1msgSend_1fpret__JJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 #endif
 {
 	jdouble rc = 0;
@@ -10076,9 +10076,9 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(objc_1msgSend_1fpret__JJJJ)(JNIEnv *env, jcl
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	NSAffineTransformStruct _arg0, *lparg0=NULL;
@@ -10107,9 +10107,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	NSPoint _arg0, *lparg0=NULL;
@@ -10138,9 +10138,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2III)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2III)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 #endif
 {
 	NSPoint _arg0, *lparg0=NULL;
@@ -10169,9 +10169,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	NSPoint _arg0, *lparg0=NULL;
@@ -10203,9 +10203,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #endif
 {
 	NSPoint _arg0, *lparg0=NULL;
@@ -10237,9 +10237,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	NSRange _arg0, *lparg0=NULL;
@@ -10268,9 +10268,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2III)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2III)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 #endif
 {
 	NSRange _arg0, *lparg0=NULL;
@@ -10299,9 +10299,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2IILorg_eclipse_swt_internal_cocoa_NSRange_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJLorg_eclipse_swt_internal_cocoa_NSRange_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2IILorg_eclipse_swt_internal_cocoa_NSRange_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2IILorg_eclipse_swt_internal_cocoa_NSRange_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJLorg_eclipse_swt_internal_cocoa_NSRange_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJLorg_eclipse_swt_internal_cocoa_NSRange_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #endif
 {
 	NSRange _arg0, *lparg0=NULL;
@@ -10333,9 +10333,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2IILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2IILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2IILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	NSRange _arg0, *lparg0=NULL;
@@ -10367,9 +10367,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -10398,9 +10398,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2III)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2III)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3)
 #endif
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -10429,9 +10429,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IIII)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IIII)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4)
 #endif
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -10460,9 +10460,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IIIIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJJZ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IIIIZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jboolean arg5)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IIIIZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jboolean arg5)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJJZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jboolean arg5)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJJZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jboolean arg5)
 #endif
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -10491,9 +10491,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IIILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IIILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jobject arg4, jintLong arg5)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IIILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jobject arg4, jintLong arg5)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jobject arg4, jintLong arg5)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jintLong arg3, jobject arg4, jintLong arg5)
 #endif
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -10525,9 +10525,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSRange_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSRange_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSRange_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSRange_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSRange_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSRange_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #endif
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -10559,9 +10559,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -10593,9 +10593,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSRect_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #endif
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -10627,9 +10627,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSSize_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSSize_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSSize_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #endif
 {
 	NSRect _arg0, *lparg0=NULL;
@@ -10661,9 +10661,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2)
 #endif
 {
 	NSSize _arg0, *lparg0=NULL;
@@ -10692,9 +10692,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	NSSize _arg0, *lparg0=NULL;
@@ -10726,9 +10726,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	NSSize _arg0, *lparg0=NULL;
@@ -10760,9 +10760,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4)
 #endif
 {
 	NSSize _arg0, *lparg0=NULL;
@@ -10794,9 +10794,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2IIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2JJJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2IIIII)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4, jintLong arg5, jintLong arg6, jintLong arg7, jintLong arg8)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2IIIII)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4, jintLong arg5, jintLong arg6, jintLong arg7, jintLong arg8)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2JJJJJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4, jintLong arg5, jintLong arg6, jintLong arg7, jintLong arg8)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2JJJJJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jintLong arg4, jintLong arg5, jintLong arg6, jintLong arg7, jintLong arg8)
 #endif
 {
 	NSSize _arg0, *lparg0=NULL;
@@ -10828,9 +10828,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2ZZI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2ZZJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2ZZI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jboolean arg4, jboolean arg5, jintLong arg6)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2ZZI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jboolean arg4, jboolean arg5, jintLong arg6)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2ZZJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jboolean arg4, jboolean arg5, jintLong arg6)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2ZZJ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jobject arg3, jboolean arg4, jboolean arg5, jintLong arg6)
 #endif
 {
 	NSSize _arg0, *lparg0=NULL;
@@ -10862,9 +10862,9 @@ fail:
 
 #if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJZ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IIZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jboolean arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IIZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jboolean arg3)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jboolean arg3)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJZ)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jintLong arg2, jboolean arg3)
 #endif
 {
 	NSSize _arg0, *lparg0=NULL;
@@ -10892,7 +10892,7 @@ fail:
 #endif
 
 #ifndef NO_objc_1registerClassPair
-JNIEXPORT void JNICALL OS_NATIVE(objc_1registerClassPair)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(objc_1registerClassPair)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, objc_1registerClassPair_FUNC);
@@ -10902,7 +10902,7 @@ JNIEXPORT void JNICALL OS_NATIVE(objc_1registerClassPair)
 #endif
 
 #ifndef NO_objc_1super_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(objc_1super_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(objc_1super_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -10914,7 +10914,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(objc_1super_1sizeof)
 #endif
 
 #ifndef NO_object_1getClass
-JNIEXPORT jintLong JNICALL OS_NATIVE(object_1getClass)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(object_1getClass)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -10926,7 +10926,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(object_1getClass)
 #endif
 
 #ifndef NO_object_1getClassName
-JNIEXPORT jintLong JNICALL OS_NATIVE(object_1getClassName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(object_1getClassName)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -10938,7 +10938,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(object_1getClassName)
 #endif
 
 #ifndef NO_object_1getInstanceVariable
-JNIEXPORT jintLong JNICALL OS_NATIVE(object_1getInstanceVariable)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(object_1getInstanceVariable)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jintLongArray arg2)
 {
 	jbyte *lparg1=NULL;
@@ -10960,12 +10960,12 @@ fail:
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
 		if (arg2 && lparg2) (*env)->ReleasePrimitiveArrayCritical(env, arg2, lparg2, 0);
-		if (arg1 && lparg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, 0);
+		if (arg1 && lparg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, JNI_ABORT);
 	} else
 #endif
 	{
 		if (arg2 && lparg2) (*env)->ReleaseIntLongArrayElements(env, arg2, lparg2, 0);
-		if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+		if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	}
 	OS_NATIVE_EXIT(env, that, object_1getInstanceVariable_FUNC);
 	return rc;
@@ -10973,7 +10973,7 @@ fail:
 #endif
 
 #ifndef NO_object_1setClass
-JNIEXPORT jintLong JNICALL OS_NATIVE(object_1setClass)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(object_1setClass)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -10985,7 +10985,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(object_1setClass)
 #endif
 
 #ifndef NO_object_1setInstanceVariable
-JNIEXPORT jintLong JNICALL OS_NATIVE(object_1setInstanceVariable)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(object_1setInstanceVariable)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jintLong arg2)
 {
 	jbyte *lparg1=NULL;
@@ -11003,11 +11003,11 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(object_1setInstanceVariable)
 fail:
 #ifdef JNI_VERSION_1_2
 	if (IS_JNI_1_2) {
-		if (arg1 && lparg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, 0);
+		if (arg1 && lparg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, JNI_ABORT);
 	} else
 #endif
 	{
-		if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+		if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	}
 	OS_NATIVE_EXIT(env, that, object_1setInstanceVariable_FUNC);
 	return rc;
@@ -11015,7 +11015,7 @@ fail:
 #endif
 
 #ifndef NO_sel_1getName
-JNIEXPORT jintLong JNICALL OS_NATIVE(sel_1getName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(sel_1getName)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -11027,7 +11027,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(sel_1getName)
 #endif
 
 #ifndef NO_sel_1registerName
-JNIEXPORT jintLong JNICALL OS_NATIVE(sel_1registerName)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(sel_1registerName)
 	(JNIEnv *env, jclass that, jstring arg0)
 {
 	const char *lparg0= NULL;
@@ -11042,3 +11042,4195 @@ fail:
 }
 #endif
 
+#ifndef NO_REGISTER_NATIVES
+static JNINativeMethod OS_nativeMethods[] = {
+#ifndef NO_ATSFontActivateFromFileReference
+#ifndef JNI64
+	{(char *)"ATSFontActivateFromFileReference", (char *)"([BIIII[I)I", (void *)OS_NATIVE(ATSFontActivateFromFileReference)},
+#else
+	{(char *)"ATSFontActivateFromFileReference", (char *)"([BIIJI[J)I", (void *)OS_NATIVE(ATSFontActivateFromFileReference)},
+#endif
+#endif
+#ifndef NO_AcquireRootMenu
+#ifndef JNI64
+	{(char *)"AcquireRootMenu", (char *)"()I", (void *)OS_NATIVE(AcquireRootMenu)},
+#else
+	{(char *)"AcquireRootMenu", (char *)"()J", (void *)OS_NATIVE(AcquireRootMenu)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1NSTextAttachmentCell_1cellSize
+#ifndef JNI64
+	{(char *)"CALLBACK_NSTextAttachmentCell_cellSize", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1NSTextAttachmentCell_1cellSize)},
+#else
+	{(char *)"CALLBACK_NSTextAttachmentCell_cellSize", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1NSTextAttachmentCell_1cellSize)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1accessibilityHitTest_1
+#ifndef JNI64
+	{(char *)"CALLBACK_accessibilityHitTest_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1accessibilityHitTest_1)},
+#else
+	{(char *)"CALLBACK_accessibilityHitTest_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1accessibilityHitTest_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1attributedSubstringFromRange_1
+#ifndef JNI64
+	{(char *)"CALLBACK_attributedSubstringFromRange_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1attributedSubstringFromRange_1)},
+#else
+	{(char *)"CALLBACK_attributedSubstringFromRange_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1attributedSubstringFromRange_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1canDragRowsWithIndexes_1atPoint_1
+#ifndef JNI64
+	{(char *)"CALLBACK_canDragRowsWithIndexes_atPoint_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1canDragRowsWithIndexes_1atPoint_1)},
+#else
+	{(char *)"CALLBACK_canDragRowsWithIndexes_atPoint_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1canDragRowsWithIndexes_1atPoint_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1cellBaselineOffset
+#ifndef JNI64
+	{(char *)"CALLBACK_cellBaselineOffset", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1cellBaselineOffset)},
+#else
+	{(char *)"CALLBACK_cellBaselineOffset", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1cellBaselineOffset)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1cellSize
+#ifndef JNI64
+	{(char *)"CALLBACK_cellSize", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1cellSize)},
+#else
+	{(char *)"CALLBACK_cellSize", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1cellSize)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1cellSizeForBounds_1
+#ifndef JNI64
+	{(char *)"CALLBACK_cellSizeForBounds_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1cellSizeForBounds_1)},
+#else
+	{(char *)"CALLBACK_cellSizeForBounds_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1cellSizeForBounds_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1characterIndexForPoint_1
+#ifndef JNI64
+	{(char *)"CALLBACK_characterIndexForPoint_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1characterIndexForPoint_1)},
+#else
+	{(char *)"CALLBACK_characterIndexForPoint_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1characterIndexForPoint_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1columnAtPoint_1
+#ifndef JNI64
+	{(char *)"CALLBACK_columnAtPoint_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1columnAtPoint_1)},
+#else
+	{(char *)"CALLBACK_columnAtPoint_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1columnAtPoint_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1dragSelectionWithEvent_1offset_1slideBack_1
+#ifndef JNI64
+	{(char *)"CALLBACK_dragSelectionWithEvent_offset_slideBack_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1dragSelectionWithEvent_1offset_1slideBack_1)},
+#else
+	{(char *)"CALLBACK_dragSelectionWithEvent_offset_slideBack_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1dragSelectionWithEvent_1offset_1slideBack_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1draggedImage_1beganAt_1
+#ifndef JNI64
+	{(char *)"CALLBACK_draggedImage_beganAt_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1draggedImage_1beganAt_1)},
+#else
+	{(char *)"CALLBACK_draggedImage_beganAt_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1draggedImage_1beganAt_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1draggedImage_1endedAt_1operation_1
+#ifndef JNI64
+	{(char *)"CALLBACK_draggedImage_endedAt_operation_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1draggedImage_1endedAt_1operation_1)},
+#else
+	{(char *)"CALLBACK_draggedImage_endedAt_operation_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1draggedImage_1endedAt_1operation_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1drawBackgroundInClipRect_1
+#ifndef JNI64
+	{(char *)"CALLBACK_drawBackgroundInClipRect_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1drawBackgroundInClipRect_1)},
+#else
+	{(char *)"CALLBACK_drawBackgroundInClipRect_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1drawBackgroundInClipRect_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1drawImage_1withFrame_1inView_1
+#ifndef JNI64
+	{(char *)"CALLBACK_drawImage_withFrame_inView_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1drawImage_1withFrame_1inView_1)},
+#else
+	{(char *)"CALLBACK_drawImage_withFrame_inView_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1drawImage_1withFrame_1inView_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1drawInteriorWithFrame_1inView_1
+#ifndef JNI64
+	{(char *)"CALLBACK_drawInteriorWithFrame_inView_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1drawInteriorWithFrame_1inView_1)},
+#else
+	{(char *)"CALLBACK_drawInteriorWithFrame_inView_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1drawInteriorWithFrame_1inView_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1drawLabel_1inRect_1
+#ifndef JNI64
+	{(char *)"CALLBACK_drawLabel_inRect_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1drawLabel_1inRect_1)},
+#else
+	{(char *)"CALLBACK_drawLabel_inRect_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1drawLabel_1inRect_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1drawRect_1
+#ifndef JNI64
+	{(char *)"CALLBACK_drawRect_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1drawRect_1)},
+#else
+	{(char *)"CALLBACK_drawRect_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1drawRect_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1drawTitle_1withFrame_1inView_1
+#ifndef JNI64
+	{(char *)"CALLBACK_drawTitle_withFrame_inView_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1drawTitle_1withFrame_1inView_1)},
+#else
+	{(char *)"CALLBACK_drawTitle_withFrame_inView_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1drawTitle_1withFrame_1inView_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1drawViewBackgroundInRect_1
+#ifndef JNI64
+	{(char *)"CALLBACK_drawViewBackgroundInRect_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1drawViewBackgroundInRect_1)},
+#else
+	{(char *)"CALLBACK_drawViewBackgroundInRect_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1drawViewBackgroundInRect_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1drawWithExpansionFrame_1inView_1
+#ifndef JNI64
+	{(char *)"CALLBACK_drawWithExpansionFrame_inView_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1drawWithExpansionFrame_1inView_1)},
+#else
+	{(char *)"CALLBACK_drawWithExpansionFrame_inView_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1drawWithExpansionFrame_1inView_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1expansionFrameWithFrame_1inView_1
+#ifndef JNI64
+	{(char *)"CALLBACK_expansionFrameWithFrame_inView_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1expansionFrameWithFrame_1inView_1)},
+#else
+	{(char *)"CALLBACK_expansionFrameWithFrame_inView_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1expansionFrameWithFrame_1inView_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1firstRectForCharacterRange_1
+#ifndef JNI64
+	{(char *)"CALLBACK_firstRectForCharacterRange_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1firstRectForCharacterRange_1)},
+#else
+	{(char *)"CALLBACK_firstRectForCharacterRange_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1firstRectForCharacterRange_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1headerRectOfColumn_1
+#ifndef JNI64
+	{(char *)"CALLBACK_headerRectOfColumn_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1headerRectOfColumn_1)},
+#else
+	{(char *)"CALLBACK_headerRectOfColumn_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1headerRectOfColumn_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1highlightSelectionInClipRect_1
+#ifndef JNI64
+	{(char *)"CALLBACK_highlightSelectionInClipRect_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1highlightSelectionInClipRect_1)},
+#else
+	{(char *)"CALLBACK_highlightSelectionInClipRect_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1highlightSelectionInClipRect_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1hitTestForEvent_1inRect_1ofView_1
+#ifndef JNI64
+	{(char *)"CALLBACK_hitTestForEvent_inRect_ofView_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1hitTestForEvent_1inRect_1ofView_1)},
+#else
+	{(char *)"CALLBACK_hitTestForEvent_inRect_ofView_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1hitTestForEvent_1inRect_1ofView_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1hitTest_1
+#ifndef JNI64
+	{(char *)"CALLBACK_hitTest_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1hitTest_1)},
+#else
+	{(char *)"CALLBACK_hitTest_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1hitTest_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1imageRectForBounds_1
+#ifndef JNI64
+	{(char *)"CALLBACK_imageRectForBounds_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1imageRectForBounds_1)},
+#else
+	{(char *)"CALLBACK_imageRectForBounds_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1imageRectForBounds_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1markedRange
+#ifndef JNI64
+	{(char *)"CALLBACK_markedRange", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1markedRange)},
+#else
+	{(char *)"CALLBACK_markedRange", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1markedRange)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1scrollClipView_1toPoint_1
+#ifndef JNI64
+	{(char *)"CALLBACK_scrollClipView_toPoint_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1scrollClipView_1toPoint_1)},
+#else
+	{(char *)"CALLBACK_scrollClipView_toPoint_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1scrollClipView_1toPoint_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1selectedRange
+#ifndef JNI64
+	{(char *)"CALLBACK_selectedRange", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1selectedRange)},
+#else
+	{(char *)"CALLBACK_selectedRange", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1selectedRange)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1setFrameOrigin_1
+#ifndef JNI64
+	{(char *)"CALLBACK_setFrameOrigin_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1setFrameOrigin_1)},
+#else
+	{(char *)"CALLBACK_setFrameOrigin_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1setFrameOrigin_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1setFrameSize_1
+#ifndef JNI64
+	{(char *)"CALLBACK_setFrameSize_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1setFrameSize_1)},
+#else
+	{(char *)"CALLBACK_setFrameSize_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1setFrameSize_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1setFrame_1
+#ifndef JNI64
+	{(char *)"CALLBACK_setFrame_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1setFrame_1)},
+#else
+	{(char *)"CALLBACK_setFrame_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1setFrame_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1setMarkedText_1selectedRange_1
+#ifndef JNI64
+	{(char *)"CALLBACK_setMarkedText_selectedRange_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1setMarkedText_1selectedRange_1)},
+#else
+	{(char *)"CALLBACK_setMarkedText_selectedRange_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1setMarkedText_1selectedRange_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1setNeedsDisplayInRect_1
+#ifndef JNI64
+	{(char *)"CALLBACK_setNeedsDisplayInRect_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1setNeedsDisplayInRect_1)},
+#else
+	{(char *)"CALLBACK_setNeedsDisplayInRect_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1setNeedsDisplayInRect_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1shouldChangeTextInRange_1replacementString_1
+#ifndef JNI64
+	{(char *)"CALLBACK_shouldChangeTextInRange_replacementString_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1shouldChangeTextInRange_1replacementString_1)},
+#else
+	{(char *)"CALLBACK_shouldChangeTextInRange_replacementString_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1shouldChangeTextInRange_1replacementString_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1sizeOfLabel_1
+#ifndef JNI64
+	{(char *)"CALLBACK_sizeOfLabel_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1sizeOfLabel_1)},
+#else
+	{(char *)"CALLBACK_sizeOfLabel_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1sizeOfLabel_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1textView_1willChangeSelectionFromCharacterRange_1toCharacterRange_1
+#ifndef JNI64
+	{(char *)"CALLBACK_textView_willChangeSelectionFromCharacterRange_toCharacterRange_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1textView_1willChangeSelectionFromCharacterRange_1toCharacterRange_1)},
+#else
+	{(char *)"CALLBACK_textView_willChangeSelectionFromCharacterRange_toCharacterRange_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1textView_1willChangeSelectionFromCharacterRange_1toCharacterRange_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1titleRectForBounds_1
+#ifndef JNI64
+	{(char *)"CALLBACK_titleRectForBounds_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1titleRectForBounds_1)},
+#else
+	{(char *)"CALLBACK_titleRectForBounds_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1titleRectForBounds_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1view_1stringForToolTip_1point_1userData_1
+#ifndef JNI64
+	{(char *)"CALLBACK_view_stringForToolTip_point_userData_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1view_1stringForToolTip_1point_1userData_1)},
+#else
+	{(char *)"CALLBACK_view_stringForToolTip_point_userData_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1view_1stringForToolTip_1point_1userData_1)},
+#endif
+#endif
+#ifndef NO_CALLBACK_1webView_1setFrame_1
+#ifndef JNI64
+	{(char *)"CALLBACK_webView_setFrame_", (char *)"(I)I", (void *)OS_NATIVE(CALLBACK_1webView_1setFrame_1)},
+#else
+	{(char *)"CALLBACK_webView_setFrame_", (char *)"(J)J", (void *)OS_NATIVE(CALLBACK_1webView_1setFrame_1)},
+#endif
+#endif
+#ifndef NO_CFAttributedStringCreate
+#ifndef JNI64
+	{(char *)"CFAttributedStringCreate", (char *)"(III)I", (void *)OS_NATIVE(CFAttributedStringCreate)},
+#else
+	{(char *)"CFAttributedStringCreate", (char *)"(JJJ)J", (void *)OS_NATIVE(CFAttributedStringCreate)},
+#endif
+#endif
+#ifndef NO_CFDataGetBytePtr
+#ifndef JNI64
+	{(char *)"CFDataGetBytePtr", (char *)"(I)I", (void *)OS_NATIVE(CFDataGetBytePtr)},
+#else
+	{(char *)"CFDataGetBytePtr", (char *)"(J)J", (void *)OS_NATIVE(CFDataGetBytePtr)},
+#endif
+#endif
+#ifndef NO_CFDataGetLength
+#ifndef JNI64
+	{(char *)"CFDataGetLength", (char *)"(I)I", (void *)OS_NATIVE(CFDataGetLength)},
+#else
+	{(char *)"CFDataGetLength", (char *)"(J)J", (void *)OS_NATIVE(CFDataGetLength)},
+#endif
+#endif
+#ifndef NO_CFDictionaryAddValue
+#ifndef JNI64
+	{(char *)"CFDictionaryAddValue", (char *)"(III)V", (void *)OS_NATIVE(CFDictionaryAddValue)},
+#else
+	{(char *)"CFDictionaryAddValue", (char *)"(JJJ)V", (void *)OS_NATIVE(CFDictionaryAddValue)},
+#endif
+#endif
+#ifndef NO_CFDictionaryCreateMutable
+#ifndef JNI64
+	{(char *)"CFDictionaryCreateMutable", (char *)"(IIII)I", (void *)OS_NATIVE(CFDictionaryCreateMutable)},
+#else
+	{(char *)"CFDictionaryCreateMutable", (char *)"(JJJJ)J", (void *)OS_NATIVE(CFDictionaryCreateMutable)},
+#endif
+#endif
+#ifndef NO_CFRange_1sizeof
+	{(char *)"CFRange_sizeof", (char *)"()I", (void *)OS_NATIVE(CFRange_1sizeof)},
+#endif
+#ifndef NO_CFRelease
+#ifndef JNI64
+	{(char *)"CFRelease", (char *)"(I)V", (void *)OS_NATIVE(CFRelease)},
+#else
+	{(char *)"CFRelease", (char *)"(J)V", (void *)OS_NATIVE(CFRelease)},
+#endif
+#endif
+#ifndef NO_CFRunLoopAddObserver
+#ifndef JNI64
+	{(char *)"CFRunLoopAddObserver", (char *)"(III)V", (void *)OS_NATIVE(CFRunLoopAddObserver)},
+#else
+	{(char *)"CFRunLoopAddObserver", (char *)"(JJJ)V", (void *)OS_NATIVE(CFRunLoopAddObserver)},
+#endif
+#endif
+#ifndef NO_CFRunLoopGetCurrent
+#ifndef JNI64
+	{(char *)"CFRunLoopGetCurrent", (char *)"()I", (void *)OS_NATIVE(CFRunLoopGetCurrent)},
+#else
+	{(char *)"CFRunLoopGetCurrent", (char *)"()J", (void *)OS_NATIVE(CFRunLoopGetCurrent)},
+#endif
+#endif
+#ifndef NO_CFRunLoopObserverCreate
+#ifndef JNI64
+	{(char *)"CFRunLoopObserverCreate", (char *)"(IIZIII)I", (void *)OS_NATIVE(CFRunLoopObserverCreate)},
+#else
+	{(char *)"CFRunLoopObserverCreate", (char *)"(JJZJJJ)J", (void *)OS_NATIVE(CFRunLoopObserverCreate)},
+#endif
+#endif
+#ifndef NO_CFRunLoopObserverInvalidate
+#ifndef JNI64
+	{(char *)"CFRunLoopObserverInvalidate", (char *)"(I)V", (void *)OS_NATIVE(CFRunLoopObserverInvalidate)},
+#else
+	{(char *)"CFRunLoopObserverInvalidate", (char *)"(J)V", (void *)OS_NATIVE(CFRunLoopObserverInvalidate)},
+#endif
+#endif
+#ifndef NO_CFRunLoopRunInMode
+#ifndef JNI64
+	{(char *)"CFRunLoopRunInMode", (char *)"(IDZ)I", (void *)OS_NATIVE(CFRunLoopRunInMode)},
+#else
+	{(char *)"CFRunLoopRunInMode", (char *)"(JDZ)I", (void *)OS_NATIVE(CFRunLoopRunInMode)},
+#endif
+#endif
+#ifndef NO_CFRunLoopStop
+#ifndef JNI64
+	{(char *)"CFRunLoopStop", (char *)"(I)V", (void *)OS_NATIVE(CFRunLoopStop)},
+#else
+	{(char *)"CFRunLoopStop", (char *)"(J)V", (void *)OS_NATIVE(CFRunLoopStop)},
+#endif
+#endif
+#ifndef NO_CFStringCreateWithCharacters
+#ifndef JNI64
+	{(char *)"CFStringCreateWithCharacters", (char *)"(I[CI)I", (void *)OS_NATIVE(CFStringCreateWithCharacters)},
+#else
+	{(char *)"CFStringCreateWithCharacters", (char *)"(J[CJ)J", (void *)OS_NATIVE(CFStringCreateWithCharacters)},
+#endif
+#endif
+#ifndef NO_CFURLCreateFromFSRef
+#ifndef JNI64
+	{(char *)"CFURLCreateFromFSRef", (char *)"(I[B)I", (void *)OS_NATIVE(CFURLCreateFromFSRef)},
+#else
+	{(char *)"CFURLCreateFromFSRef", (char *)"(J[B)J", (void *)OS_NATIVE(CFURLCreateFromFSRef)},
+#endif
+#endif
+#ifndef NO_CFURLCreateStringByAddingPercentEscapes
+#ifndef JNI64
+	{(char *)"CFURLCreateStringByAddingPercentEscapes", (char *)"(IIIII)I", (void *)OS_NATIVE(CFURLCreateStringByAddingPercentEscapes)},
+#else
+	{(char *)"CFURLCreateStringByAddingPercentEscapes", (char *)"(JJJJI)J", (void *)OS_NATIVE(CFURLCreateStringByAddingPercentEscapes)},
+#endif
+#endif
+#ifndef NO_CGAffineTransform_1sizeof
+	{(char *)"CGAffineTransform_sizeof", (char *)"()I", (void *)OS_NATIVE(CGAffineTransform_1sizeof)},
+#endif
+#ifndef NO_CGBitmapContextCreate
+#ifndef JNI64
+	{(char *)"CGBitmapContextCreate", (char *)"(IIIIIII)I", (void *)OS_NATIVE(CGBitmapContextCreate)},
+#else
+	{(char *)"CGBitmapContextCreate", (char *)"(JJJJJJI)J", (void *)OS_NATIVE(CGBitmapContextCreate)},
+#endif
+#endif
+#ifndef NO_CGBitmapContextCreateImage
+#ifndef JNI64
+	{(char *)"CGBitmapContextCreateImage", (char *)"(I)I", (void *)OS_NATIVE(CGBitmapContextCreateImage)},
+#else
+	{(char *)"CGBitmapContextCreateImage", (char *)"(J)J", (void *)OS_NATIVE(CGBitmapContextCreateImage)},
+#endif
+#endif
+#ifndef NO_CGBitmapContextGetData
+#ifndef JNI64
+	{(char *)"CGBitmapContextGetData", (char *)"(I)I", (void *)OS_NATIVE(CGBitmapContextGetData)},
+#else
+	{(char *)"CGBitmapContextGetData", (char *)"(J)J", (void *)OS_NATIVE(CGBitmapContextGetData)},
+#endif
+#endif
+#ifndef NO_CGColorCreate
+#ifndef JNI64
+	{(char *)"CGColorCreate", (char *)"(I[F)I", (void *)OS_NATIVE(CGColorCreate)},
+#else
+	{(char *)"CGColorCreate", (char *)"(J[D)J", (void *)OS_NATIVE(CGColorCreate)},
+#endif
+#endif
+#ifndef NO_CGColorRelease
+#ifndef JNI64
+	{(char *)"CGColorRelease", (char *)"(I)V", (void *)OS_NATIVE(CGColorRelease)},
+#else
+	{(char *)"CGColorRelease", (char *)"(J)V", (void *)OS_NATIVE(CGColorRelease)},
+#endif
+#endif
+#ifndef NO_CGColorSpaceCreateDeviceRGB
+#ifndef JNI64
+	{(char *)"CGColorSpaceCreateDeviceRGB", (char *)"()I", (void *)OS_NATIVE(CGColorSpaceCreateDeviceRGB)},
+#else
+	{(char *)"CGColorSpaceCreateDeviceRGB", (char *)"()J", (void *)OS_NATIVE(CGColorSpaceCreateDeviceRGB)},
+#endif
+#endif
+#ifndef NO_CGColorSpaceRelease
+#ifndef JNI64
+	{(char *)"CGColorSpaceRelease", (char *)"(I)V", (void *)OS_NATIVE(CGColorSpaceRelease)},
+#else
+	{(char *)"CGColorSpaceRelease", (char *)"(J)V", (void *)OS_NATIVE(CGColorSpaceRelease)},
+#endif
+#endif
+#ifndef NO_CGContextAddPath
+#ifndef JNI64
+	{(char *)"CGContextAddPath", (char *)"(II)V", (void *)OS_NATIVE(CGContextAddPath)},
+#else
+	{(char *)"CGContextAddPath", (char *)"(JJ)V", (void *)OS_NATIVE(CGContextAddPath)},
+#endif
+#endif
+#ifndef NO_CGContextBeginTransparencyLayerWithRect
+#ifndef JNI64
+	{(char *)"CGContextBeginTransparencyLayerWithRect", (char *)"(ILorg/eclipse/swt/internal/cocoa/CGRect;I)V", (void *)OS_NATIVE(CGContextBeginTransparencyLayerWithRect)},
+#else
+	{(char *)"CGContextBeginTransparencyLayerWithRect", (char *)"(JLorg/eclipse/swt/internal/cocoa/CGRect;J)V", (void *)OS_NATIVE(CGContextBeginTransparencyLayerWithRect)},
+#endif
+#endif
+#ifndef NO_CGContextCopyPath
+#ifndef JNI64
+	{(char *)"CGContextCopyPath", (char *)"(I)I", (void *)OS_NATIVE(CGContextCopyPath)},
+#else
+	{(char *)"CGContextCopyPath", (char *)"(J)J", (void *)OS_NATIVE(CGContextCopyPath)},
+#endif
+#endif
+#ifndef NO_CGContextCopyWindowContentsToRect
+#ifndef JNI64
+	{(char *)"CGContextCopyWindowContentsToRect", (char *)"(ILorg/eclipse/swt/internal/cocoa/CGRect;IILorg/eclipse/swt/internal/cocoa/CGRect;)V", (void *)OS_NATIVE(CGContextCopyWindowContentsToRect)},
+#else
+	{(char *)"CGContextCopyWindowContentsToRect", (char *)"(JLorg/eclipse/swt/internal/cocoa/CGRect;JJLorg/eclipse/swt/internal/cocoa/CGRect;)V", (void *)OS_NATIVE(CGContextCopyWindowContentsToRect)},
+#endif
+#endif
+#ifndef NO_CGContextDrawImage
+#ifndef JNI64
+	{(char *)"CGContextDrawImage", (char *)"(ILorg/eclipse/swt/internal/cocoa/CGRect;I)V", (void *)OS_NATIVE(CGContextDrawImage)},
+#else
+	{(char *)"CGContextDrawImage", (char *)"(JLorg/eclipse/swt/internal/cocoa/CGRect;J)V", (void *)OS_NATIVE(CGContextDrawImage)},
+#endif
+#endif
+#ifndef NO_CGContextEndTransparencyLayer
+#ifndef JNI64
+	{(char *)"CGContextEndTransparencyLayer", (char *)"(I)V", (void *)OS_NATIVE(CGContextEndTransparencyLayer)},
+#else
+	{(char *)"CGContextEndTransparencyLayer", (char *)"(J)V", (void *)OS_NATIVE(CGContextEndTransparencyLayer)},
+#endif
+#endif
+#ifndef NO_CGContextFillRect
+#ifndef JNI64
+	{(char *)"CGContextFillRect", (char *)"(ILorg/eclipse/swt/internal/cocoa/CGRect;)V", (void *)OS_NATIVE(CGContextFillRect)},
+#else
+	{(char *)"CGContextFillRect", (char *)"(JLorg/eclipse/swt/internal/cocoa/CGRect;)V", (void *)OS_NATIVE(CGContextFillRect)},
+#endif
+#endif
+#ifndef NO_CGContextRelease
+#ifndef JNI64
+	{(char *)"CGContextRelease", (char *)"(I)V", (void *)OS_NATIVE(CGContextRelease)},
+#else
+	{(char *)"CGContextRelease", (char *)"(J)V", (void *)OS_NATIVE(CGContextRelease)},
+#endif
+#endif
+#ifndef NO_CGContextReplacePathWithStrokedPath
+#ifndef JNI64
+	{(char *)"CGContextReplacePathWithStrokedPath", (char *)"(I)V", (void *)OS_NATIVE(CGContextReplacePathWithStrokedPath)},
+#else
+	{(char *)"CGContextReplacePathWithStrokedPath", (char *)"(J)V", (void *)OS_NATIVE(CGContextReplacePathWithStrokedPath)},
+#endif
+#endif
+#ifndef NO_CGContextRestoreGState
+#ifndef JNI64
+	{(char *)"CGContextRestoreGState", (char *)"(I)V", (void *)OS_NATIVE(CGContextRestoreGState)},
+#else
+	{(char *)"CGContextRestoreGState", (char *)"(J)V", (void *)OS_NATIVE(CGContextRestoreGState)},
+#endif
+#endif
+#ifndef NO_CGContextSaveGState
+#ifndef JNI64
+	{(char *)"CGContextSaveGState", (char *)"(I)V", (void *)OS_NATIVE(CGContextSaveGState)},
+#else
+	{(char *)"CGContextSaveGState", (char *)"(J)V", (void *)OS_NATIVE(CGContextSaveGState)},
+#endif
+#endif
+#ifndef NO_CGContextScaleCTM
+#ifndef JNI64
+	{(char *)"CGContextScaleCTM", (char *)"(IFF)V", (void *)OS_NATIVE(CGContextScaleCTM)},
+#else
+	{(char *)"CGContextScaleCTM", (char *)"(JDD)V", (void *)OS_NATIVE(CGContextScaleCTM)},
+#endif
+#endif
+#ifndef NO_CGContextSetBlendMode
+#ifndef JNI64
+	{(char *)"CGContextSetBlendMode", (char *)"(II)V", (void *)OS_NATIVE(CGContextSetBlendMode)},
+#else
+	{(char *)"CGContextSetBlendMode", (char *)"(JI)V", (void *)OS_NATIVE(CGContextSetBlendMode)},
+#endif
+#endif
+#ifndef NO_CGContextSetFillColor
+#ifndef JNI64
+	{(char *)"CGContextSetFillColor", (char *)"(I[F)V", (void *)OS_NATIVE(CGContextSetFillColor)},
+#else
+	{(char *)"CGContextSetFillColor", (char *)"(J[D)V", (void *)OS_NATIVE(CGContextSetFillColor)},
+#endif
+#endif
+#ifndef NO_CGContextSetFillColorSpace
+#ifndef JNI64
+	{(char *)"CGContextSetFillColorSpace", (char *)"(II)V", (void *)OS_NATIVE(CGContextSetFillColorSpace)},
+#else
+	{(char *)"CGContextSetFillColorSpace", (char *)"(JJ)V", (void *)OS_NATIVE(CGContextSetFillColorSpace)},
+#endif
+#endif
+#ifndef NO_CGContextSetLineCap
+#ifndef JNI64
+	{(char *)"CGContextSetLineCap", (char *)"(II)V", (void *)OS_NATIVE(CGContextSetLineCap)},
+#else
+	{(char *)"CGContextSetLineCap", (char *)"(JI)V", (void *)OS_NATIVE(CGContextSetLineCap)},
+#endif
+#endif
+#ifndef NO_CGContextSetLineDash
+#ifndef JNI64
+	{(char *)"CGContextSetLineDash", (char *)"(IF[FI)V", (void *)OS_NATIVE(CGContextSetLineDash)},
+#else
+	{(char *)"CGContextSetLineDash", (char *)"(JD[FJ)V", (void *)OS_NATIVE(CGContextSetLineDash)},
+#endif
+#endif
+#ifndef NO_CGContextSetLineJoin
+#ifndef JNI64
+	{(char *)"CGContextSetLineJoin", (char *)"(II)V", (void *)OS_NATIVE(CGContextSetLineJoin)},
+#else
+	{(char *)"CGContextSetLineJoin", (char *)"(JI)V", (void *)OS_NATIVE(CGContextSetLineJoin)},
+#endif
+#endif
+#ifndef NO_CGContextSetLineWidth
+#ifndef JNI64
+	{(char *)"CGContextSetLineWidth", (char *)"(IF)V", (void *)OS_NATIVE(CGContextSetLineWidth)},
+#else
+	{(char *)"CGContextSetLineWidth", (char *)"(JD)V", (void *)OS_NATIVE(CGContextSetLineWidth)},
+#endif
+#endif
+#ifndef NO_CGContextSetMiterLimit
+#ifndef JNI64
+	{(char *)"CGContextSetMiterLimit", (char *)"(IF)V", (void *)OS_NATIVE(CGContextSetMiterLimit)},
+#else
+	{(char *)"CGContextSetMiterLimit", (char *)"(JD)V", (void *)OS_NATIVE(CGContextSetMiterLimit)},
+#endif
+#endif
+#ifndef NO_CGContextSetShouldAntialias
+#ifndef JNI64
+	{(char *)"CGContextSetShouldAntialias", (char *)"(IZ)V", (void *)OS_NATIVE(CGContextSetShouldAntialias)},
+#else
+	{(char *)"CGContextSetShouldAntialias", (char *)"(JZ)V", (void *)OS_NATIVE(CGContextSetShouldAntialias)},
+#endif
+#endif
+#ifndef NO_CGContextSetTextDrawingMode
+#ifndef JNI64
+	{(char *)"CGContextSetTextDrawingMode", (char *)"(II)V", (void *)OS_NATIVE(CGContextSetTextDrawingMode)},
+#else
+	{(char *)"CGContextSetTextDrawingMode", (char *)"(JI)V", (void *)OS_NATIVE(CGContextSetTextDrawingMode)},
+#endif
+#endif
+#ifndef NO_CGContextSetTextMatrix
+#ifndef JNI64
+	{(char *)"CGContextSetTextMatrix", (char *)"(ILorg/eclipse/swt/internal/cocoa/CGAffineTransform;)V", (void *)OS_NATIVE(CGContextSetTextMatrix)},
+#else
+	{(char *)"CGContextSetTextMatrix", (char *)"(JLorg/eclipse/swt/internal/cocoa/CGAffineTransform;)V", (void *)OS_NATIVE(CGContextSetTextMatrix)},
+#endif
+#endif
+#ifndef NO_CGContextSetTextPosition
+#ifndef JNI64
+	{(char *)"CGContextSetTextPosition", (char *)"(IFF)V", (void *)OS_NATIVE(CGContextSetTextPosition)},
+#else
+	{(char *)"CGContextSetTextPosition", (char *)"(JDD)V", (void *)OS_NATIVE(CGContextSetTextPosition)},
+#endif
+#endif
+#ifndef NO_CGContextStrokePath
+#ifndef JNI64
+	{(char *)"CGContextStrokePath", (char *)"(I)V", (void *)OS_NATIVE(CGContextStrokePath)},
+#else
+	{(char *)"CGContextStrokePath", (char *)"(J)V", (void *)OS_NATIVE(CGContextStrokePath)},
+#endif
+#endif
+#ifndef NO_CGContextTranslateCTM
+#ifndef JNI64
+	{(char *)"CGContextTranslateCTM", (char *)"(IFF)V", (void *)OS_NATIVE(CGContextTranslateCTM)},
+#else
+	{(char *)"CGContextTranslateCTM", (char *)"(JDD)V", (void *)OS_NATIVE(CGContextTranslateCTM)},
+#endif
+#endif
+#ifndef NO_CGDataProviderCreateWithData
+#ifndef JNI64
+	{(char *)"CGDataProviderCreateWithData", (char *)"(IIII)I", (void *)OS_NATIVE(CGDataProviderCreateWithData)},
+#else
+	{(char *)"CGDataProviderCreateWithData", (char *)"(JJJJ)J", (void *)OS_NATIVE(CGDataProviderCreateWithData)},
+#endif
+#endif
+#ifndef NO_CGDataProviderRelease
+#ifndef JNI64
+	{(char *)"CGDataProviderRelease", (char *)"(I)V", (void *)OS_NATIVE(CGDataProviderRelease)},
+#else
+	{(char *)"CGDataProviderRelease", (char *)"(J)V", (void *)OS_NATIVE(CGDataProviderRelease)},
+#endif
+#endif
+#ifndef NO_CGDisplayBaseAddress
+#ifndef JNI64
+	{(char *)"CGDisplayBaseAddress", (char *)"(I)I", (void *)OS_NATIVE(CGDisplayBaseAddress)},
+#else
+	{(char *)"CGDisplayBaseAddress", (char *)"(I)J", (void *)OS_NATIVE(CGDisplayBaseAddress)},
+#endif
+#endif
+#ifndef NO_CGDisplayBitsPerPixel
+#ifndef JNI64
+	{(char *)"CGDisplayBitsPerPixel", (char *)"(I)I", (void *)OS_NATIVE(CGDisplayBitsPerPixel)},
+#else
+	{(char *)"CGDisplayBitsPerPixel", (char *)"(I)J", (void *)OS_NATIVE(CGDisplayBitsPerPixel)},
+#endif
+#endif
+#ifndef NO_CGDisplayBitsPerSample
+#ifndef JNI64
+	{(char *)"CGDisplayBitsPerSample", (char *)"(I)I", (void *)OS_NATIVE(CGDisplayBitsPerSample)},
+#else
+	{(char *)"CGDisplayBitsPerSample", (char *)"(I)J", (void *)OS_NATIVE(CGDisplayBitsPerSample)},
+#endif
+#endif
+#ifndef NO_CGDisplayBytesPerRow
+#ifndef JNI64
+	{(char *)"CGDisplayBytesPerRow", (char *)"(I)I", (void *)OS_NATIVE(CGDisplayBytesPerRow)},
+#else
+	{(char *)"CGDisplayBytesPerRow", (char *)"(I)J", (void *)OS_NATIVE(CGDisplayBytesPerRow)},
+#endif
+#endif
+#ifndef NO_CGDisplayCreateImage
+#ifndef JNI64
+	{(char *)"CGDisplayCreateImage", (char *)"(I)I", (void *)OS_NATIVE(CGDisplayCreateImage)},
+#else
+	{(char *)"CGDisplayCreateImage", (char *)"(I)J", (void *)OS_NATIVE(CGDisplayCreateImage)},
+#endif
+#endif
+#ifndef NO_CGDisplayPixelsHigh
+#ifndef JNI64
+	{(char *)"CGDisplayPixelsHigh", (char *)"(I)I", (void *)OS_NATIVE(CGDisplayPixelsHigh)},
+#else
+	{(char *)"CGDisplayPixelsHigh", (char *)"(I)J", (void *)OS_NATIVE(CGDisplayPixelsHigh)},
+#endif
+#endif
+#ifndef NO_CGDisplayPixelsWide
+#ifndef JNI64
+	{(char *)"CGDisplayPixelsWide", (char *)"(I)I", (void *)OS_NATIVE(CGDisplayPixelsWide)},
+#else
+	{(char *)"CGDisplayPixelsWide", (char *)"(I)J", (void *)OS_NATIVE(CGDisplayPixelsWide)},
+#endif
+#endif
+#ifndef NO_CGEventCreateKeyboardEvent
+#ifndef JNI64
+	{(char *)"CGEventCreateKeyboardEvent", (char *)"(ISZ)I", (void *)OS_NATIVE(CGEventCreateKeyboardEvent)},
+#else
+	{(char *)"CGEventCreateKeyboardEvent", (char *)"(JSZ)J", (void *)OS_NATIVE(CGEventCreateKeyboardEvent)},
+#endif
+#endif
+#ifndef NO_CGEventCreateMouseEvent
+#ifndef JNI64
+	{(char *)"CGEventCreateMouseEvent", (char *)"(IILorg/eclipse/swt/internal/cocoa/CGPoint;I)I", (void *)OS_NATIVE(CGEventCreateMouseEvent)},
+#else
+	{(char *)"CGEventCreateMouseEvent", (char *)"(JILorg/eclipse/swt/internal/cocoa/CGPoint;I)J", (void *)OS_NATIVE(CGEventCreateMouseEvent)},
+#endif
+#endif
+#ifndef NO_CGEventCreateScrollWheelEvent
+#ifndef JNI64
+	{(char *)"CGEventCreateScrollWheelEvent", (char *)"(IIII)I", (void *)OS_NATIVE(CGEventCreateScrollWheelEvent)},
+#else
+	{(char *)"CGEventCreateScrollWheelEvent", (char *)"(JIII)J", (void *)OS_NATIVE(CGEventCreateScrollWheelEvent)},
+#endif
+#endif
+#ifndef NO_CGEventGetIntegerValueField
+#ifndef JNI64
+	{(char *)"CGEventGetIntegerValueField", (char *)"(II)J", (void *)OS_NATIVE(CGEventGetIntegerValueField)},
+#else
+	{(char *)"CGEventGetIntegerValueField", (char *)"(JI)J", (void *)OS_NATIVE(CGEventGetIntegerValueField)},
+#endif
+#endif
+#ifndef NO_CGEventPost
+#ifndef JNI64
+	{(char *)"CGEventPost", (char *)"(II)V", (void *)OS_NATIVE(CGEventPost)},
+#else
+	{(char *)"CGEventPost", (char *)"(IJ)V", (void *)OS_NATIVE(CGEventPost)},
+#endif
+#endif
+#ifndef NO_CGEventSourceCreate
+#ifndef JNI64
+	{(char *)"CGEventSourceCreate", (char *)"(I)I", (void *)OS_NATIVE(CGEventSourceCreate)},
+#else
+	{(char *)"CGEventSourceCreate", (char *)"(I)J", (void *)OS_NATIVE(CGEventSourceCreate)},
+#endif
+#endif
+#ifndef NO_CGGetDisplaysWithRect
+#ifndef JNI64
+	{(char *)"CGGetDisplaysWithRect", (char *)"(Lorg/eclipse/swt/internal/cocoa/CGRect;III)I", (void *)OS_NATIVE(CGGetDisplaysWithRect)},
+#else
+	{(char *)"CGGetDisplaysWithRect", (char *)"(Lorg/eclipse/swt/internal/cocoa/CGRect;IJJ)I", (void *)OS_NATIVE(CGGetDisplaysWithRect)},
+#endif
+#endif
+#ifndef NO_CGImageCreate
+#ifndef JNI64
+	{(char *)"CGImageCreate", (char *)"(IIIIIIIIIZI)I", (void *)OS_NATIVE(CGImageCreate)},
+#else
+	{(char *)"CGImageCreate", (char *)"(JJJJJJIJJZI)J", (void *)OS_NATIVE(CGImageCreate)},
+#endif
+#endif
+#ifndef NO_CGImageGetHeight
+#ifndef JNI64
+	{(char *)"CGImageGetHeight", (char *)"(I)I", (void *)OS_NATIVE(CGImageGetHeight)},
+#else
+	{(char *)"CGImageGetHeight", (char *)"(J)J", (void *)OS_NATIVE(CGImageGetHeight)},
+#endif
+#endif
+#ifndef NO_CGImageGetWidth
+#ifndef JNI64
+	{(char *)"CGImageGetWidth", (char *)"(I)I", (void *)OS_NATIVE(CGImageGetWidth)},
+#else
+	{(char *)"CGImageGetWidth", (char *)"(J)J", (void *)OS_NATIVE(CGImageGetWidth)},
+#endif
+#endif
+#ifndef NO_CGImageRelease
+#ifndef JNI64
+	{(char *)"CGImageRelease", (char *)"(I)V", (void *)OS_NATIVE(CGImageRelease)},
+#else
+	{(char *)"CGImageRelease", (char *)"(J)V", (void *)OS_NATIVE(CGImageRelease)},
+#endif
+#endif
+#ifndef NO_CGPathAddCurveToPoint
+#ifndef JNI64
+	{(char *)"CGPathAddCurveToPoint", (char *)"(IIFFFFFF)V", (void *)OS_NATIVE(CGPathAddCurveToPoint)},
+#else
+	{(char *)"CGPathAddCurveToPoint", (char *)"(JJDDDDDD)V", (void *)OS_NATIVE(CGPathAddCurveToPoint)},
+#endif
+#endif
+#ifndef NO_CGPathAddLineToPoint
+#ifndef JNI64
+	{(char *)"CGPathAddLineToPoint", (char *)"(IIFF)V", (void *)OS_NATIVE(CGPathAddLineToPoint)},
+#else
+	{(char *)"CGPathAddLineToPoint", (char *)"(JJDD)V", (void *)OS_NATIVE(CGPathAddLineToPoint)},
+#endif
+#endif
+#ifndef NO_CGPathAddRect
+#ifndef JNI64
+	{(char *)"CGPathAddRect", (char *)"(IILorg/eclipse/swt/internal/cocoa/CGRect;)V", (void *)OS_NATIVE(CGPathAddRect)},
+#else
+	{(char *)"CGPathAddRect", (char *)"(JJLorg/eclipse/swt/internal/cocoa/CGRect;)V", (void *)OS_NATIVE(CGPathAddRect)},
+#endif
+#endif
+#ifndef NO_CGPathApply
+#ifndef JNI64
+	{(char *)"CGPathApply", (char *)"(III)V", (void *)OS_NATIVE(CGPathApply)},
+#else
+	{(char *)"CGPathApply", (char *)"(JJJ)V", (void *)OS_NATIVE(CGPathApply)},
+#endif
+#endif
+#ifndef NO_CGPathCloseSubpath
+#ifndef JNI64
+	{(char *)"CGPathCloseSubpath", (char *)"(I)V", (void *)OS_NATIVE(CGPathCloseSubpath)},
+#else
+	{(char *)"CGPathCloseSubpath", (char *)"(J)V", (void *)OS_NATIVE(CGPathCloseSubpath)},
+#endif
+#endif
+#ifndef NO_CGPathCreateCopy
+#ifndef JNI64
+	{(char *)"CGPathCreateCopy", (char *)"(I)I", (void *)OS_NATIVE(CGPathCreateCopy)},
+#else
+	{(char *)"CGPathCreateCopy", (char *)"(J)J", (void *)OS_NATIVE(CGPathCreateCopy)},
+#endif
+#endif
+#ifndef NO_CGPathCreateMutable
+#ifndef JNI64
+	{(char *)"CGPathCreateMutable", (char *)"()I", (void *)OS_NATIVE(CGPathCreateMutable)},
+#else
+	{(char *)"CGPathCreateMutable", (char *)"()J", (void *)OS_NATIVE(CGPathCreateMutable)},
+#endif
+#endif
+#ifndef NO_CGPathElement_1sizeof
+	{(char *)"CGPathElement_sizeof", (char *)"()I", (void *)OS_NATIVE(CGPathElement_1sizeof)},
+#endif
+#ifndef NO_CGPathMoveToPoint
+#ifndef JNI64
+	{(char *)"CGPathMoveToPoint", (char *)"(IIFF)V", (void *)OS_NATIVE(CGPathMoveToPoint)},
+#else
+	{(char *)"CGPathMoveToPoint", (char *)"(JJDD)V", (void *)OS_NATIVE(CGPathMoveToPoint)},
+#endif
+#endif
+#ifndef NO_CGPathRelease
+#ifndef JNI64
+	{(char *)"CGPathRelease", (char *)"(I)V", (void *)OS_NATIVE(CGPathRelease)},
+#else
+	{(char *)"CGPathRelease", (char *)"(J)V", (void *)OS_NATIVE(CGPathRelease)},
+#endif
+#endif
+#ifndef NO_CGPoint_1sizeof
+	{(char *)"CGPoint_sizeof", (char *)"()I", (void *)OS_NATIVE(CGPoint_1sizeof)},
+#endif
+#ifndef NO_CGPostKeyboardEvent
+	{(char *)"CGPostKeyboardEvent", (char *)"(SSZ)I", (void *)OS_NATIVE(CGPostKeyboardEvent)},
+#endif
+#ifndef NO_CGRect_1sizeof
+	{(char *)"CGRect_sizeof", (char *)"()I", (void *)OS_NATIVE(CGRect_1sizeof)},
+#endif
+#ifndef NO_CGSetLocalEventsFilterDuringSuppressionState
+	{(char *)"CGSetLocalEventsFilterDuringSuppressionState", (char *)"(II)I", (void *)OS_NATIVE(CGSetLocalEventsFilterDuringSuppressionState)},
+#endif
+#ifndef NO_CGSetLocalEventsSuppressionInterval
+	{(char *)"CGSetLocalEventsSuppressionInterval", (char *)"(D)I", (void *)OS_NATIVE(CGSetLocalEventsSuppressionInterval)},
+#endif
+#ifndef NO_CGSize_1sizeof
+	{(char *)"CGSize_sizeof", (char *)"()I", (void *)OS_NATIVE(CGSize_1sizeof)},
+#endif
+#ifndef NO_CGWarpMouseCursorPosition
+	{(char *)"CGWarpMouseCursorPosition", (char *)"(Lorg/eclipse/swt/internal/cocoa/CGPoint;)I", (void *)OS_NATIVE(CGWarpMouseCursorPosition)},
+#endif
+#ifndef NO_CPSSetProcessName
+#ifndef JNI64
+	{(char *)"CPSSetProcessName", (char *)"([II)I", (void *)OS_NATIVE(CPSSetProcessName)},
+#else
+	{(char *)"CPSSetProcessName", (char *)"([IJ)I", (void *)OS_NATIVE(CPSSetProcessName)},
+#endif
+#endif
+#ifndef NO_CTFontGetAscent
+#ifndef JNI64
+	{(char *)"CTFontGetAscent", (char *)"(I)F", (void *)OS_NATIVE(CTFontGetAscent)},
+#else
+	{(char *)"CTFontGetAscent", (char *)"(J)D", (void *)OS_NATIVE(CTFontGetAscent)},
+#endif
+#endif
+#ifndef NO_CTFontGetDescent
+#ifndef JNI64
+	{(char *)"CTFontGetDescent", (char *)"(I)F", (void *)OS_NATIVE(CTFontGetDescent)},
+#else
+	{(char *)"CTFontGetDescent", (char *)"(J)D", (void *)OS_NATIVE(CTFontGetDescent)},
+#endif
+#endif
+#ifndef NO_CTFontGetLeading
+#ifndef JNI64
+	{(char *)"CTFontGetLeading", (char *)"(I)F", (void *)OS_NATIVE(CTFontGetLeading)},
+#else
+	{(char *)"CTFontGetLeading", (char *)"(J)D", (void *)OS_NATIVE(CTFontGetLeading)},
+#endif
+#endif
+#ifndef NO_CTLineCreateWithAttributedString
+#ifndef JNI64
+	{(char *)"CTLineCreateWithAttributedString", (char *)"(I)I", (void *)OS_NATIVE(CTLineCreateWithAttributedString)},
+#else
+	{(char *)"CTLineCreateWithAttributedString", (char *)"(J)J", (void *)OS_NATIVE(CTLineCreateWithAttributedString)},
+#endif
+#endif
+#ifndef NO_CTLineDraw
+#ifndef JNI64
+	{(char *)"CTLineDraw", (char *)"(II)V", (void *)OS_NATIVE(CTLineDraw)},
+#else
+	{(char *)"CTLineDraw", (char *)"(JJ)V", (void *)OS_NATIVE(CTLineDraw)},
+#endif
+#endif
+#ifndef NO_CTLineGetTypographicBounds
+#ifndef JNI64
+	{(char *)"CTLineGetTypographicBounds", (char *)"(I[F[F[F)D", (void *)OS_NATIVE(CTLineGetTypographicBounds)},
+#else
+	{(char *)"CTLineGetTypographicBounds", (char *)"(J[D[D[D)D", (void *)OS_NATIVE(CTLineGetTypographicBounds)},
+#endif
+#endif
+#ifndef NO_CTParagraphStyleCreate
+#ifndef JNI64
+	{(char *)"CTParagraphStyleCreate", (char *)"(II)I", (void *)OS_NATIVE(CTParagraphStyleCreate)},
+#else
+	{(char *)"CTParagraphStyleCreate", (char *)"(JJ)J", (void *)OS_NATIVE(CTParagraphStyleCreate)},
+#endif
+#endif
+#ifndef NO_CTParagraphStyleSetting_1sizeof
+	{(char *)"CTParagraphStyleSetting_sizeof", (char *)"()I", (void *)OS_NATIVE(CTParagraphStyleSetting_1sizeof)},
+#endif
+#ifndef NO_CTTypesetterCreateLine
+#ifndef JNI64
+	{(char *)"CTTypesetterCreateLine", (char *)"(ILorg/eclipse/swt/internal/cocoa/CFRange;)I", (void *)OS_NATIVE(CTTypesetterCreateLine)},
+#else
+	{(char *)"CTTypesetterCreateLine", (char *)"(JLorg/eclipse/swt/internal/cocoa/CFRange;)J", (void *)OS_NATIVE(CTTypesetterCreateLine)},
+#endif
+#endif
+#ifndef NO_CTTypesetterCreateWithAttributedString
+#ifndef JNI64
+	{(char *)"CTTypesetterCreateWithAttributedString", (char *)"(I)I", (void *)OS_NATIVE(CTTypesetterCreateWithAttributedString)},
+#else
+	{(char *)"CTTypesetterCreateWithAttributedString", (char *)"(J)J", (void *)OS_NATIVE(CTTypesetterCreateWithAttributedString)},
+#endif
+#endif
+#ifndef NO_CTTypesetterSuggestLineBreak
+#ifndef JNI64
+	{(char *)"CTTypesetterSuggestLineBreak", (char *)"(IID)I", (void *)OS_NATIVE(CTTypesetterSuggestLineBreak)},
+#else
+	{(char *)"CTTypesetterSuggestLineBreak", (char *)"(JJD)J", (void *)OS_NATIVE(CTTypesetterSuggestLineBreak)},
+#endif
+#endif
+#ifndef NO_CancelMenuTracking
+#ifndef JNI64
+	{(char *)"CancelMenuTracking", (char *)"(IZI)I", (void *)OS_NATIVE(CancelMenuTracking)},
+#else
+	{(char *)"CancelMenuTracking", (char *)"(JZI)I", (void *)OS_NATIVE(CancelMenuTracking)},
+#endif
+#endif
+#ifndef NO_CloseRgn
+#ifndef JNI64
+	{(char *)"CloseRgn", (char *)"(I)V", (void *)OS_NATIVE(CloseRgn)},
+#else
+	{(char *)"CloseRgn", (char *)"(J)V", (void *)OS_NATIVE(CloseRgn)},
+#endif
+#endif
+#ifndef NO_CopyRgn
+#ifndef JNI64
+	{(char *)"CopyRgn", (char *)"(II)V", (void *)OS_NATIVE(CopyRgn)},
+#else
+	{(char *)"CopyRgn", (char *)"(JJ)V", (void *)OS_NATIVE(CopyRgn)},
+#endif
+#endif
+#ifndef NO_DeleteGlobalRef
+#ifndef JNI64
+	{(char *)"DeleteGlobalRef", (char *)"(I)V", (void *)OS_NATIVE(DeleteGlobalRef)},
+#else
+	{(char *)"DeleteGlobalRef", (char *)"(J)V", (void *)OS_NATIVE(DeleteGlobalRef)},
+#endif
+#endif
+#ifndef NO_DeleteMenuItem
+#ifndef JNI64
+	{(char *)"DeleteMenuItem", (char *)"(IS)V", (void *)OS_NATIVE(DeleteMenuItem)},
+#else
+	{(char *)"DeleteMenuItem", (char *)"(JS)V", (void *)OS_NATIVE(DeleteMenuItem)},
+#endif
+#endif
+#ifndef NO_DiffRgn
+#ifndef JNI64
+	{(char *)"DiffRgn", (char *)"(III)V", (void *)OS_NATIVE(DiffRgn)},
+#else
+	{(char *)"DiffRgn", (char *)"(JJJ)V", (void *)OS_NATIVE(DiffRgn)},
+#endif
+#endif
+#ifndef NO_DisposeRgn
+#ifndef JNI64
+	{(char *)"DisposeRgn", (char *)"(I)V", (void *)OS_NATIVE(DisposeRgn)},
+#else
+	{(char *)"DisposeRgn", (char *)"(J)V", (void *)OS_NATIVE(DisposeRgn)},
+#endif
+#endif
+#ifndef NO_EmptyRgn
+#ifndef JNI64
+	{(char *)"EmptyRgn", (char *)"(I)Z", (void *)OS_NATIVE(EmptyRgn)},
+#else
+	{(char *)"EmptyRgn", (char *)"(J)Z", (void *)OS_NATIVE(EmptyRgn)},
+#endif
+#endif
+#ifndef NO_FSPathMakeRef
+#ifndef JNI64
+	{(char *)"FSPathMakeRef", (char *)"(I[B[Z)I", (void *)OS_NATIVE(FSPathMakeRef)},
+#else
+	{(char *)"FSPathMakeRef", (char *)"(J[B[Z)I", (void *)OS_NATIVE(FSPathMakeRef)},
+#endif
+#endif
+#ifndef NO_Gestalt
+	{(char *)"Gestalt", (char *)"(I[I)I", (void *)OS_NATIVE(Gestalt)},
+#endif
+#ifndef NO_GetCurrentEventButtonState
+	{(char *)"GetCurrentEventButtonState", (char *)"()I", (void *)OS_NATIVE(GetCurrentEventButtonState)},
+#endif
+#ifndef NO_GetCurrentProcess
+	{(char *)"GetCurrentProcess", (char *)"([I)I", (void *)OS_NATIVE(GetCurrentProcess)},
+#endif
+#ifndef NO_GetDblTime
+	{(char *)"GetDblTime", (char *)"()I", (void *)OS_NATIVE(GetDblTime)},
+#endif
+#ifndef NO_GetIconRefFromTypeInfo
+#ifndef JNI64
+	{(char *)"GetIconRefFromTypeInfo", (char *)"(IIIII[I)I", (void *)OS_NATIVE(GetIconRefFromTypeInfo)},
+#else
+	{(char *)"GetIconRefFromTypeInfo", (char *)"(IIJJI[J)I", (void *)OS_NATIVE(GetIconRefFromTypeInfo)},
+#endif
+#endif
+#ifndef NO_GetIndMenuItemWithCommandID
+#ifndef JNI64
+	{(char *)"GetIndMenuItemWithCommandID", (char *)"(III[I[S)I", (void *)OS_NATIVE(GetIndMenuItemWithCommandID)},
+#else
+	{(char *)"GetIndMenuItemWithCommandID", (char *)"(JII[J[S)I", (void *)OS_NATIVE(GetIndMenuItemWithCommandID)},
+#endif
+#endif
+#ifndef NO_GetRegionBounds
+#ifndef JNI64
+	{(char *)"GetRegionBounds", (char *)"(I[S)V", (void *)OS_NATIVE(GetRegionBounds)},
+#else
+	{(char *)"GetRegionBounds", (char *)"(J[S)V", (void *)OS_NATIVE(GetRegionBounds)},
+#endif
+#endif
+#ifndef NO_GetSystemUIMode
+	{(char *)"GetSystemUIMode", (char *)"([I[I)I", (void *)OS_NATIVE(GetSystemUIMode)},
+#endif
+#ifndef NO_GetThemeMetric
+	{(char *)"GetThemeMetric", (char *)"(I[I)V", (void *)OS_NATIVE(GetThemeMetric)},
+#endif
+#ifndef NO_HIThemeDrawFocusRect
+#ifndef JNI64
+	{(char *)"HIThemeDrawFocusRect", (char *)"(Lorg/eclipse/swt/internal/cocoa/CGRect;ZII)I", (void *)OS_NATIVE(HIThemeDrawFocusRect)},
+#else
+	{(char *)"HIThemeDrawFocusRect", (char *)"(Lorg/eclipse/swt/internal/cocoa/CGRect;ZJI)I", (void *)OS_NATIVE(HIThemeDrawFocusRect)},
+#endif
+#endif
+#ifndef NO_HIWindowGetCGWindowID
+#ifndef JNI64
+	{(char *)"HIWindowGetCGWindowID", (char *)"(I)I", (void *)OS_NATIVE(HIWindowGetCGWindowID)},
+#else
+	{(char *)"HIWindowGetCGWindowID", (char *)"(J)I", (void *)OS_NATIVE(HIWindowGetCGWindowID)},
+#endif
+#endif
+#ifndef NO_JSEvaluateScript
+#ifndef JNI64
+	{(char *)"JSEvaluateScript", (char *)"(IIIII[I)I", (void *)OS_NATIVE(JSEvaluateScript)},
+#else
+	{(char *)"JSEvaluateScript", (char *)"(JJJJI[J)J", (void *)OS_NATIVE(JSEvaluateScript)},
+#endif
+#endif
+#ifndef NO_JSStringCreateWithUTF8CString
+#ifndef JNI64
+	{(char *)"JSStringCreateWithUTF8CString", (char *)"([B)I", (void *)OS_NATIVE(JSStringCreateWithUTF8CString)},
+#else
+	{(char *)"JSStringCreateWithUTF8CString", (char *)"([B)J", (void *)OS_NATIVE(JSStringCreateWithUTF8CString)},
+#endif
+#endif
+#ifndef NO_JSStringRelease
+#ifndef JNI64
+	{(char *)"JSStringRelease", (char *)"(I)V", (void *)OS_NATIVE(JSStringRelease)},
+#else
+	{(char *)"JSStringRelease", (char *)"(J)V", (void *)OS_NATIVE(JSStringRelease)},
+#endif
+#endif
+#ifndef NO_LMGetKbdType
+	{(char *)"LMGetKbdType", (char *)"()B", (void *)OS_NATIVE(LMGetKbdType)},
+#endif
+#ifndef NO_LSGetApplicationForInfo
+#ifndef JNI64
+	{(char *)"LSGetApplicationForInfo", (char *)"(IIII[B[I)I", (void *)OS_NATIVE(LSGetApplicationForInfo)},
+#else
+	{(char *)"LSGetApplicationForInfo", (char *)"(IIJI[B[I)J", (void *)OS_NATIVE(LSGetApplicationForInfo)},
+#endif
+#endif
+#ifndef NO_LineTo
+	{(char *)"LineTo", (char *)"(SS)V", (void *)OS_NATIVE(LineTo)},
+#endif
+#ifndef NO_MoveTo
+	{(char *)"MoveTo", (char *)"(SS)V", (void *)OS_NATIVE(MoveTo)},
+#endif
+#ifndef NO_NSAccessibilityActionDescription
+#ifndef JNI64
+	{(char *)"NSAccessibilityActionDescription", (char *)"(I)I", (void *)OS_NATIVE(NSAccessibilityActionDescription)},
+#else
+	{(char *)"NSAccessibilityActionDescription", (char *)"(J)J", (void *)OS_NATIVE(NSAccessibilityActionDescription)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityAttributedStringForRangeParameterizedAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityAttributedStringForRangeParameterizedAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityAttributedStringForRangeParameterizedAttribute)},
+#else
+	{(char *)"NSAccessibilityAttributedStringForRangeParameterizedAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityAttributedStringForRangeParameterizedAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityBackgroundColorTextAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityBackgroundColorTextAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityBackgroundColorTextAttribute)},
+#else
+	{(char *)"NSAccessibilityBackgroundColorTextAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityBackgroundColorTextAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityBoundsForRangeParameterizedAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityBoundsForRangeParameterizedAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityBoundsForRangeParameterizedAttribute)},
+#else
+	{(char *)"NSAccessibilityBoundsForRangeParameterizedAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityBoundsForRangeParameterizedAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityButtonRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityButtonRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityButtonRole)},
+#else
+	{(char *)"NSAccessibilityButtonRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityButtonRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityCheckBoxRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityCheckBoxRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityCheckBoxRole)},
+#else
+	{(char *)"NSAccessibilityCheckBoxRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityCheckBoxRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityChildrenAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityChildrenAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityChildrenAttribute)},
+#else
+	{(char *)"NSAccessibilityChildrenAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityChildrenAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityColorWellRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityColorWellRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityColorWellRole)},
+#else
+	{(char *)"NSAccessibilityColorWellRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityColorWellRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityColumnRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityColumnRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityColumnRole)},
+#else
+	{(char *)"NSAccessibilityColumnRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityColumnRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityColumnsAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityColumnsAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityColumnsAttribute)},
+#else
+	{(char *)"NSAccessibilityColumnsAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityColumnsAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityComboBoxRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityComboBoxRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityComboBoxRole)},
+#else
+	{(char *)"NSAccessibilityComboBoxRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityComboBoxRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityConfirmAction
+#ifndef JNI64
+	{(char *)"NSAccessibilityConfirmAction", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityConfirmAction)},
+#else
+	{(char *)"NSAccessibilityConfirmAction", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityConfirmAction)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityContentsAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityContentsAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityContentsAttribute)},
+#else
+	{(char *)"NSAccessibilityContentsAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityContentsAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityDescriptionAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityDescriptionAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityDescriptionAttribute)},
+#else
+	{(char *)"NSAccessibilityDescriptionAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityDescriptionAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityDialogSubrole
+#ifndef JNI64
+	{(char *)"NSAccessibilityDialogSubrole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityDialogSubrole)},
+#else
+	{(char *)"NSAccessibilityDialogSubrole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityDialogSubrole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityEnabledAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityEnabledAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityEnabledAttribute)},
+#else
+	{(char *)"NSAccessibilityEnabledAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityEnabledAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityExpandedAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityExpandedAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityExpandedAttribute)},
+#else
+	{(char *)"NSAccessibilityExpandedAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityExpandedAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityFloatingWindowSubrole
+#ifndef JNI64
+	{(char *)"NSAccessibilityFloatingWindowSubrole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityFloatingWindowSubrole)},
+#else
+	{(char *)"NSAccessibilityFloatingWindowSubrole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityFloatingWindowSubrole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityFocusedAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityFocusedAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityFocusedAttribute)},
+#else
+	{(char *)"NSAccessibilityFocusedAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityFocusedAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityFocusedUIElementChangedNotification
+#ifndef JNI64
+	{(char *)"NSAccessibilityFocusedUIElementChangedNotification", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityFocusedUIElementChangedNotification)},
+#else
+	{(char *)"NSAccessibilityFocusedUIElementChangedNotification", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityFocusedUIElementChangedNotification)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityFocusedWindowChangedNotification
+#ifndef JNI64
+	{(char *)"NSAccessibilityFocusedWindowChangedNotification", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityFocusedWindowChangedNotification)},
+#else
+	{(char *)"NSAccessibilityFocusedWindowChangedNotification", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityFocusedWindowChangedNotification)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityFontFamilyKey
+#ifndef JNI64
+	{(char *)"NSAccessibilityFontFamilyKey", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityFontFamilyKey)},
+#else
+	{(char *)"NSAccessibilityFontFamilyKey", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityFontFamilyKey)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityFontNameKey
+#ifndef JNI64
+	{(char *)"NSAccessibilityFontNameKey", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityFontNameKey)},
+#else
+	{(char *)"NSAccessibilityFontNameKey", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityFontNameKey)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityFontSizeKey
+#ifndef JNI64
+	{(char *)"NSAccessibilityFontSizeKey", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityFontSizeKey)},
+#else
+	{(char *)"NSAccessibilityFontSizeKey", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityFontSizeKey)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityFontTextAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityFontTextAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityFontTextAttribute)},
+#else
+	{(char *)"NSAccessibilityFontTextAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityFontTextAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityForegroundColorTextAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityForegroundColorTextAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityForegroundColorTextAttribute)},
+#else
+	{(char *)"NSAccessibilityForegroundColorTextAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityForegroundColorTextAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityGridRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityGridRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityGridRole)},
+#else
+	{(char *)"NSAccessibilityGridRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityGridRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityGroupRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityGroupRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityGroupRole)},
+#else
+	{(char *)"NSAccessibilityGroupRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityGroupRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityHeaderAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityHeaderAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityHeaderAttribute)},
+#else
+	{(char *)"NSAccessibilityHeaderAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityHeaderAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityHelpAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityHelpAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityHelpAttribute)},
+#else
+	{(char *)"NSAccessibilityHelpAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityHelpAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityHelpTagRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityHelpTagRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityHelpTagRole)},
+#else
+	{(char *)"NSAccessibilityHelpTagRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityHelpTagRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityHorizontalOrientationValue
+#ifndef JNI64
+	{(char *)"NSAccessibilityHorizontalOrientationValue", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityHorizontalOrientationValue)},
+#else
+	{(char *)"NSAccessibilityHorizontalOrientationValue", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityHorizontalOrientationValue)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityHorizontalScrollBarAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityHorizontalScrollBarAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityHorizontalScrollBarAttribute)},
+#else
+	{(char *)"NSAccessibilityHorizontalScrollBarAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityHorizontalScrollBarAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityImageRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityImageRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityImageRole)},
+#else
+	{(char *)"NSAccessibilityImageRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityImageRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityIncrementorRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityIncrementorRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityIncrementorRole)},
+#else
+	{(char *)"NSAccessibilityIncrementorRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityIncrementorRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityIndexAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityIndexAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityIndexAttribute)},
+#else
+	{(char *)"NSAccessibilityIndexAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityIndexAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityInsertionPointLineNumberAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityInsertionPointLineNumberAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityInsertionPointLineNumberAttribute)},
+#else
+	{(char *)"NSAccessibilityInsertionPointLineNumberAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityInsertionPointLineNumberAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityLabelValueAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityLabelValueAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityLabelValueAttribute)},
+#else
+	{(char *)"NSAccessibilityLabelValueAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityLabelValueAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityLineForIndexParameterizedAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityLineForIndexParameterizedAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityLineForIndexParameterizedAttribute)},
+#else
+	{(char *)"NSAccessibilityLineForIndexParameterizedAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityLineForIndexParameterizedAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityLinkRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityLinkRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityLinkRole)},
+#else
+	{(char *)"NSAccessibilityLinkRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityLinkRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityLinkTextAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityLinkTextAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityLinkTextAttribute)},
+#else
+	{(char *)"NSAccessibilityLinkTextAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityLinkTextAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityLinkedUIElementsAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityLinkedUIElementsAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityLinkedUIElementsAttribute)},
+#else
+	{(char *)"NSAccessibilityLinkedUIElementsAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityLinkedUIElementsAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityListRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityListRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityListRole)},
+#else
+	{(char *)"NSAccessibilityListRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityListRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityMaxValueAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityMaxValueAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityMaxValueAttribute)},
+#else
+	{(char *)"NSAccessibilityMaxValueAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityMaxValueAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityMenuBarRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityMenuBarRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityMenuBarRole)},
+#else
+	{(char *)"NSAccessibilityMenuBarRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityMenuBarRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityMenuButtonRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityMenuButtonRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityMenuButtonRole)},
+#else
+	{(char *)"NSAccessibilityMenuButtonRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityMenuButtonRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityMenuItemRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityMenuItemRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityMenuItemRole)},
+#else
+	{(char *)"NSAccessibilityMenuItemRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityMenuItemRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityMenuRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityMenuRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityMenuRole)},
+#else
+	{(char *)"NSAccessibilityMenuRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityMenuRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityMinValueAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityMinValueAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityMinValueAttribute)},
+#else
+	{(char *)"NSAccessibilityMinValueAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityMinValueAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityMisspelledTextAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityMisspelledTextAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityMisspelledTextAttribute)},
+#else
+	{(char *)"NSAccessibilityMisspelledTextAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityMisspelledTextAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityMovedNotification
+#ifndef JNI64
+	{(char *)"NSAccessibilityMovedNotification", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityMovedNotification)},
+#else
+	{(char *)"NSAccessibilityMovedNotification", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityMovedNotification)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityNextContentsAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityNextContentsAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityNextContentsAttribute)},
+#else
+	{(char *)"NSAccessibilityNextContentsAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityNextContentsAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityNumberOfCharactersAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityNumberOfCharactersAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityNumberOfCharactersAttribute)},
+#else
+	{(char *)"NSAccessibilityNumberOfCharactersAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityNumberOfCharactersAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityOrientationAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityOrientationAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityOrientationAttribute)},
+#else
+	{(char *)"NSAccessibilityOrientationAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityOrientationAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityOutlineRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityOutlineRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityOutlineRole)},
+#else
+	{(char *)"NSAccessibilityOutlineRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityOutlineRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityOutlineRowSubrole
+#ifndef JNI64
+	{(char *)"NSAccessibilityOutlineRowSubrole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityOutlineRowSubrole)},
+#else
+	{(char *)"NSAccessibilityOutlineRowSubrole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityOutlineRowSubrole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityParentAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityParentAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityParentAttribute)},
+#else
+	{(char *)"NSAccessibilityParentAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityParentAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityPopUpButtonRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityPopUpButtonRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityPopUpButtonRole)},
+#else
+	{(char *)"NSAccessibilityPopUpButtonRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityPopUpButtonRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityPositionAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityPositionAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityPositionAttribute)},
+#else
+	{(char *)"NSAccessibilityPositionAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityPositionAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityPostNotification
+#ifndef JNI64
+	{(char *)"NSAccessibilityPostNotification", (char *)"(II)V", (void *)OS_NATIVE(NSAccessibilityPostNotification)},
+#else
+	{(char *)"NSAccessibilityPostNotification", (char *)"(JJ)V", (void *)OS_NATIVE(NSAccessibilityPostNotification)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityPressAction
+#ifndef JNI64
+	{(char *)"NSAccessibilityPressAction", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityPressAction)},
+#else
+	{(char *)"NSAccessibilityPressAction", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityPressAction)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityPreviousContentsAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityPreviousContentsAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityPreviousContentsAttribute)},
+#else
+	{(char *)"NSAccessibilityPreviousContentsAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityPreviousContentsAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityProgressIndicatorRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityProgressIndicatorRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityProgressIndicatorRole)},
+#else
+	{(char *)"NSAccessibilityProgressIndicatorRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityProgressIndicatorRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityRTFForRangeParameterizedAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityRTFForRangeParameterizedAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityRTFForRangeParameterizedAttribute)},
+#else
+	{(char *)"NSAccessibilityRTFForRangeParameterizedAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityRTFForRangeParameterizedAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityRadioButtonRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityRadioButtonRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityRadioButtonRole)},
+#else
+	{(char *)"NSAccessibilityRadioButtonRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityRadioButtonRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityRadioGroupRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityRadioGroupRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityRadioGroupRole)},
+#else
+	{(char *)"NSAccessibilityRadioGroupRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityRadioGroupRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityRaiseBadArgumentException
+#ifndef JNI64
+	{(char *)"NSAccessibilityRaiseBadArgumentException", (char *)"(III)V", (void *)OS_NATIVE(NSAccessibilityRaiseBadArgumentException)},
+#else
+	{(char *)"NSAccessibilityRaiseBadArgumentException", (char *)"(JJJ)V", (void *)OS_NATIVE(NSAccessibilityRaiseBadArgumentException)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityRangeForIndexParameterizedAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityRangeForIndexParameterizedAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityRangeForIndexParameterizedAttribute)},
+#else
+	{(char *)"NSAccessibilityRangeForIndexParameterizedAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityRangeForIndexParameterizedAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityRangeForLineParameterizedAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityRangeForLineParameterizedAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityRangeForLineParameterizedAttribute)},
+#else
+	{(char *)"NSAccessibilityRangeForLineParameterizedAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityRangeForLineParameterizedAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityRangeForPositionParameterizedAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityRangeForPositionParameterizedAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityRangeForPositionParameterizedAttribute)},
+#else
+	{(char *)"NSAccessibilityRangeForPositionParameterizedAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityRangeForPositionParameterizedAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityResizedNotification
+#ifndef JNI64
+	{(char *)"NSAccessibilityResizedNotification", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityResizedNotification)},
+#else
+	{(char *)"NSAccessibilityResizedNotification", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityResizedNotification)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityRoleAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityRoleAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityRoleAttribute)},
+#else
+	{(char *)"NSAccessibilityRoleAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityRoleAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityRoleDescription
+#ifndef JNI64
+	{(char *)"NSAccessibilityRoleDescription", (char *)"(II)I", (void *)OS_NATIVE(NSAccessibilityRoleDescription)},
+#else
+	{(char *)"NSAccessibilityRoleDescription", (char *)"(JJ)J", (void *)OS_NATIVE(NSAccessibilityRoleDescription)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityRoleDescriptionAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityRoleDescriptionAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityRoleDescriptionAttribute)},
+#else
+	{(char *)"NSAccessibilityRoleDescriptionAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityRoleDescriptionAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityRoleDescriptionForUIElement
+#ifndef JNI64
+	{(char *)"NSAccessibilityRoleDescriptionForUIElement", (char *)"(I)I", (void *)OS_NATIVE(NSAccessibilityRoleDescriptionForUIElement)},
+#else
+	{(char *)"NSAccessibilityRoleDescriptionForUIElement", (char *)"(J)J", (void *)OS_NATIVE(NSAccessibilityRoleDescriptionForUIElement)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityRowCountChangedNotification
+#ifndef JNI64
+	{(char *)"NSAccessibilityRowCountChangedNotification", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityRowCountChangedNotification)},
+#else
+	{(char *)"NSAccessibilityRowCountChangedNotification", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityRowCountChangedNotification)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityRowRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityRowRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityRowRole)},
+#else
+	{(char *)"NSAccessibilityRowRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityRowRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityRowsAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityRowsAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityRowsAttribute)},
+#else
+	{(char *)"NSAccessibilityRowsAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityRowsAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityScrollAreaRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityScrollAreaRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityScrollAreaRole)},
+#else
+	{(char *)"NSAccessibilityScrollAreaRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityScrollAreaRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityScrollBarRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityScrollBarRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityScrollBarRole)},
+#else
+	{(char *)"NSAccessibilityScrollBarRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityScrollBarRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySelectedAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilitySelectedAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySelectedAttribute)},
+#else
+	{(char *)"NSAccessibilitySelectedAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySelectedAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySelectedChildrenAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilitySelectedChildrenAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySelectedChildrenAttribute)},
+#else
+	{(char *)"NSAccessibilitySelectedChildrenAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySelectedChildrenAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySelectedChildrenChangedNotification
+#ifndef JNI64
+	{(char *)"NSAccessibilitySelectedChildrenChangedNotification", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySelectedChildrenChangedNotification)},
+#else
+	{(char *)"NSAccessibilitySelectedChildrenChangedNotification", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySelectedChildrenChangedNotification)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySelectedColumnsAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilitySelectedColumnsAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySelectedColumnsAttribute)},
+#else
+	{(char *)"NSAccessibilitySelectedColumnsAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySelectedColumnsAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySelectedRowsAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilitySelectedRowsAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySelectedRowsAttribute)},
+#else
+	{(char *)"NSAccessibilitySelectedRowsAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySelectedRowsAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySelectedRowsChangedNotification
+#ifndef JNI64
+	{(char *)"NSAccessibilitySelectedRowsChangedNotification", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySelectedRowsChangedNotification)},
+#else
+	{(char *)"NSAccessibilitySelectedRowsChangedNotification", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySelectedRowsChangedNotification)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySelectedTextAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilitySelectedTextAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySelectedTextAttribute)},
+#else
+	{(char *)"NSAccessibilitySelectedTextAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySelectedTextAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySelectedTextChangedNotification
+#ifndef JNI64
+	{(char *)"NSAccessibilitySelectedTextChangedNotification", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySelectedTextChangedNotification)},
+#else
+	{(char *)"NSAccessibilitySelectedTextChangedNotification", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySelectedTextChangedNotification)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySelectedTextRangeAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilitySelectedTextRangeAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySelectedTextRangeAttribute)},
+#else
+	{(char *)"NSAccessibilitySelectedTextRangeAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySelectedTextRangeAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySelectedTextRangesAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilitySelectedTextRangesAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySelectedTextRangesAttribute)},
+#else
+	{(char *)"NSAccessibilitySelectedTextRangesAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySelectedTextRangesAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityServesAsTitleForUIElementsAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityServesAsTitleForUIElementsAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityServesAsTitleForUIElementsAttribute)},
+#else
+	{(char *)"NSAccessibilityServesAsTitleForUIElementsAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityServesAsTitleForUIElementsAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityShowMenuAction
+#ifndef JNI64
+	{(char *)"NSAccessibilityShowMenuAction", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityShowMenuAction)},
+#else
+	{(char *)"NSAccessibilityShowMenuAction", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityShowMenuAction)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySizeAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilitySizeAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySizeAttribute)},
+#else
+	{(char *)"NSAccessibilitySizeAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySizeAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySliderRole
+#ifndef JNI64
+	{(char *)"NSAccessibilitySliderRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySliderRole)},
+#else
+	{(char *)"NSAccessibilitySliderRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySliderRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySortButtonRole
+#ifndef JNI64
+	{(char *)"NSAccessibilitySortButtonRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySortButtonRole)},
+#else
+	{(char *)"NSAccessibilitySortButtonRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySortButtonRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySplitterRole
+#ifndef JNI64
+	{(char *)"NSAccessibilitySplitterRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySplitterRole)},
+#else
+	{(char *)"NSAccessibilitySplitterRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySplitterRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityStandardWindowSubrole
+#ifndef JNI64
+	{(char *)"NSAccessibilityStandardWindowSubrole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityStandardWindowSubrole)},
+#else
+	{(char *)"NSAccessibilityStandardWindowSubrole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityStandardWindowSubrole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityStaticTextRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityStaticTextRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityStaticTextRole)},
+#else
+	{(char *)"NSAccessibilityStaticTextRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityStaticTextRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityStrikethroughColorTextAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityStrikethroughColorTextAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityStrikethroughColorTextAttribute)},
+#else
+	{(char *)"NSAccessibilityStrikethroughColorTextAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityStrikethroughColorTextAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityStrikethroughTextAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityStrikethroughTextAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityStrikethroughTextAttribute)},
+#else
+	{(char *)"NSAccessibilityStrikethroughTextAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityStrikethroughTextAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityStringForRangeParameterizedAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityStringForRangeParameterizedAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityStringForRangeParameterizedAttribute)},
+#else
+	{(char *)"NSAccessibilityStringForRangeParameterizedAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityStringForRangeParameterizedAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityStyleRangeForIndexParameterizedAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityStyleRangeForIndexParameterizedAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityStyleRangeForIndexParameterizedAttribute)},
+#else
+	{(char *)"NSAccessibilityStyleRangeForIndexParameterizedAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityStyleRangeForIndexParameterizedAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySubroleAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilitySubroleAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySubroleAttribute)},
+#else
+	{(char *)"NSAccessibilitySubroleAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySubroleAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySuperscriptTextAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilitySuperscriptTextAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySuperscriptTextAttribute)},
+#else
+	{(char *)"NSAccessibilitySuperscriptTextAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySuperscriptTextAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilitySystemDialogSubrole
+#ifndef JNI64
+	{(char *)"NSAccessibilitySystemDialogSubrole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilitySystemDialogSubrole)},
+#else
+	{(char *)"NSAccessibilitySystemDialogSubrole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilitySystemDialogSubrole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityTabGroupRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityTabGroupRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityTabGroupRole)},
+#else
+	{(char *)"NSAccessibilityTabGroupRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityTabGroupRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityTableRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityTableRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityTableRole)},
+#else
+	{(char *)"NSAccessibilityTableRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityTableRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityTableRowSubrole
+#ifndef JNI64
+	{(char *)"NSAccessibilityTableRowSubrole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityTableRowSubrole)},
+#else
+	{(char *)"NSAccessibilityTableRowSubrole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityTableRowSubrole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityTabsAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityTabsAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityTabsAttribute)},
+#else
+	{(char *)"NSAccessibilityTabsAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityTabsAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityTextAreaRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityTextAreaRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityTextAreaRole)},
+#else
+	{(char *)"NSAccessibilityTextAreaRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityTextAreaRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityTextFieldRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityTextFieldRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityTextFieldRole)},
+#else
+	{(char *)"NSAccessibilityTextFieldRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityTextFieldRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityTextLinkSubrole
+#ifndef JNI64
+	{(char *)"NSAccessibilityTextLinkSubrole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityTextLinkSubrole)},
+#else
+	{(char *)"NSAccessibilityTextLinkSubrole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityTextLinkSubrole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityTitleAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityTitleAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityTitleAttribute)},
+#else
+	{(char *)"NSAccessibilityTitleAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityTitleAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityTitleChangedNotification
+#ifndef JNI64
+	{(char *)"NSAccessibilityTitleChangedNotification", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityTitleChangedNotification)},
+#else
+	{(char *)"NSAccessibilityTitleChangedNotification", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityTitleChangedNotification)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityTitleUIElementAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityTitleUIElementAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityTitleUIElementAttribute)},
+#else
+	{(char *)"NSAccessibilityTitleUIElementAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityTitleUIElementAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityToolbarRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityToolbarRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityToolbarRole)},
+#else
+	{(char *)"NSAccessibilityToolbarRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityToolbarRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityTopLevelUIElementAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityTopLevelUIElementAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityTopLevelUIElementAttribute)},
+#else
+	{(char *)"NSAccessibilityTopLevelUIElementAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityTopLevelUIElementAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityURLAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityURLAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityURLAttribute)},
+#else
+	{(char *)"NSAccessibilityURLAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityURLAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityUnderlineColorTextAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityUnderlineColorTextAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityUnderlineColorTextAttribute)},
+#else
+	{(char *)"NSAccessibilityUnderlineColorTextAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityUnderlineColorTextAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityUnderlineTextAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityUnderlineTextAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityUnderlineTextAttribute)},
+#else
+	{(char *)"NSAccessibilityUnderlineTextAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityUnderlineTextAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityUnignoredAncestor
+#ifndef JNI64
+	{(char *)"NSAccessibilityUnignoredAncestor", (char *)"(I)I", (void *)OS_NATIVE(NSAccessibilityUnignoredAncestor)},
+#else
+	{(char *)"NSAccessibilityUnignoredAncestor", (char *)"(J)J", (void *)OS_NATIVE(NSAccessibilityUnignoredAncestor)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityUnignoredChildren
+#ifndef JNI64
+	{(char *)"NSAccessibilityUnignoredChildren", (char *)"(I)I", (void *)OS_NATIVE(NSAccessibilityUnignoredChildren)},
+#else
+	{(char *)"NSAccessibilityUnignoredChildren", (char *)"(J)J", (void *)OS_NATIVE(NSAccessibilityUnignoredChildren)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityUnignoredChildrenForOnlyChild
+#ifndef JNI64
+	{(char *)"NSAccessibilityUnignoredChildrenForOnlyChild", (char *)"(I)I", (void *)OS_NATIVE(NSAccessibilityUnignoredChildrenForOnlyChild)},
+#else
+	{(char *)"NSAccessibilityUnignoredChildrenForOnlyChild", (char *)"(J)J", (void *)OS_NATIVE(NSAccessibilityUnignoredChildrenForOnlyChild)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityUnignoredDescendant
+#ifndef JNI64
+	{(char *)"NSAccessibilityUnignoredDescendant", (char *)"(I)I", (void *)OS_NATIVE(NSAccessibilityUnignoredDescendant)},
+#else
+	{(char *)"NSAccessibilityUnignoredDescendant", (char *)"(J)J", (void *)OS_NATIVE(NSAccessibilityUnignoredDescendant)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityUnknownRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityUnknownRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityUnknownRole)},
+#else
+	{(char *)"NSAccessibilityUnknownRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityUnknownRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityUnknownSubrole
+#ifndef JNI64
+	{(char *)"NSAccessibilityUnknownSubrole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityUnknownSubrole)},
+#else
+	{(char *)"NSAccessibilityUnknownSubrole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityUnknownSubrole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityValueAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityValueAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityValueAttribute)},
+#else
+	{(char *)"NSAccessibilityValueAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityValueAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityValueChangedNotification
+#ifndef JNI64
+	{(char *)"NSAccessibilityValueChangedNotification", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityValueChangedNotification)},
+#else
+	{(char *)"NSAccessibilityValueChangedNotification", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityValueChangedNotification)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityValueDescriptionAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityValueDescriptionAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityValueDescriptionAttribute)},
+#else
+	{(char *)"NSAccessibilityValueDescriptionAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityValueDescriptionAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityValueIndicatorRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityValueIndicatorRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityValueIndicatorRole)},
+#else
+	{(char *)"NSAccessibilityValueIndicatorRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityValueIndicatorRole)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityVerticalOrientationValue
+#ifndef JNI64
+	{(char *)"NSAccessibilityVerticalOrientationValue", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityVerticalOrientationValue)},
+#else
+	{(char *)"NSAccessibilityVerticalOrientationValue", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityVerticalOrientationValue)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityVerticalScrollBarAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityVerticalScrollBarAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityVerticalScrollBarAttribute)},
+#else
+	{(char *)"NSAccessibilityVerticalScrollBarAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityVerticalScrollBarAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityVisibleCharacterRangeAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityVisibleCharacterRangeAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityVisibleCharacterRangeAttribute)},
+#else
+	{(char *)"NSAccessibilityVisibleCharacterRangeAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityVisibleCharacterRangeAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityVisibleChildrenAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityVisibleChildrenAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityVisibleChildrenAttribute)},
+#else
+	{(char *)"NSAccessibilityVisibleChildrenAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityVisibleChildrenAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityVisibleColumnsAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityVisibleColumnsAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityVisibleColumnsAttribute)},
+#else
+	{(char *)"NSAccessibilityVisibleColumnsAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityVisibleColumnsAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityVisibleNameKey
+#ifndef JNI64
+	{(char *)"NSAccessibilityVisibleNameKey", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityVisibleNameKey)},
+#else
+	{(char *)"NSAccessibilityVisibleNameKey", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityVisibleNameKey)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityVisibleRowsAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityVisibleRowsAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityVisibleRowsAttribute)},
+#else
+	{(char *)"NSAccessibilityVisibleRowsAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityVisibleRowsAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityWindowAttribute
+#ifndef JNI64
+	{(char *)"NSAccessibilityWindowAttribute", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityWindowAttribute)},
+#else
+	{(char *)"NSAccessibilityWindowAttribute", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityWindowAttribute)},
+#endif
+#endif
+#ifndef NO_NSAccessibilityWindowRole
+#ifndef JNI64
+	{(char *)"NSAccessibilityWindowRole", (char *)"()I", (void *)OS_NATIVE(NSAccessibilityWindowRole)},
+#else
+	{(char *)"NSAccessibilityWindowRole", (char *)"()J", (void *)OS_NATIVE(NSAccessibilityWindowRole)},
+#endif
+#endif
+#ifndef NO_NSAddImage
+#ifndef JNI64
+	{(char *)"NSAddImage", (char *)"([BI)I", (void *)OS_NATIVE(NSAddImage)},
+#else
+	{(char *)"NSAddImage", (char *)"([BI)J", (void *)OS_NATIVE(NSAddImage)},
+#endif
+#endif
+#ifndef NO_NSAffineTransformStruct_1sizeof
+	{(char *)"NSAffineTransformStruct_sizeof", (char *)"()I", (void *)OS_NATIVE(NSAffineTransformStruct_1sizeof)},
+#endif
+#ifndef NO_NSApplicationDidChangeScreenParametersNotification
+#ifndef JNI64
+	{(char *)"NSApplicationDidChangeScreenParametersNotification", (char *)"()I", (void *)OS_NATIVE(NSApplicationDidChangeScreenParametersNotification)},
+#else
+	{(char *)"NSApplicationDidChangeScreenParametersNotification", (char *)"()J", (void *)OS_NATIVE(NSApplicationDidChangeScreenParametersNotification)},
+#endif
+#endif
+#ifndef NO_NSAttachmentAttributeName
+#ifndef JNI64
+	{(char *)"NSAttachmentAttributeName", (char *)"()I", (void *)OS_NATIVE(NSAttachmentAttributeName)},
+#else
+	{(char *)"NSAttachmentAttributeName", (char *)"()J", (void *)OS_NATIVE(NSAttachmentAttributeName)},
+#endif
+#endif
+#ifndef NO_NSBackgroundColorAttributeName
+#ifndef JNI64
+	{(char *)"NSBackgroundColorAttributeName", (char *)"()I", (void *)OS_NATIVE(NSBackgroundColorAttributeName)},
+#else
+	{(char *)"NSBackgroundColorAttributeName", (char *)"()J", (void *)OS_NATIVE(NSBackgroundColorAttributeName)},
+#endif
+#endif
+#ifndef NO_NSBaselineOffsetAttributeName
+#ifndef JNI64
+	{(char *)"NSBaselineOffsetAttributeName", (char *)"()I", (void *)OS_NATIVE(NSBaselineOffsetAttributeName)},
+#else
+	{(char *)"NSBaselineOffsetAttributeName", (char *)"()J", (void *)OS_NATIVE(NSBaselineOffsetAttributeName)},
+#endif
+#endif
+#ifndef NO_NSBeep
+	{(char *)"NSBeep", (char *)"()V", (void *)OS_NATIVE(NSBeep)},
+#endif
+#ifndef NO_NSBitsPerPixelFromDepth
+#ifndef JNI64
+	{(char *)"NSBitsPerPixelFromDepth", (char *)"(I)I", (void *)OS_NATIVE(NSBitsPerPixelFromDepth)},
+#else
+	{(char *)"NSBitsPerPixelFromDepth", (char *)"(I)J", (void *)OS_NATIVE(NSBitsPerPixelFromDepth)},
+#endif
+#endif
+#ifndef NO_NSCalibratedRGBColorSpace
+#ifndef JNI64
+	{(char *)"NSCalibratedRGBColorSpace", (char *)"()I", (void *)OS_NATIVE(NSCalibratedRGBColorSpace)},
+#else
+	{(char *)"NSCalibratedRGBColorSpace", (char *)"()J", (void *)OS_NATIVE(NSCalibratedRGBColorSpace)},
+#endif
+#endif
+#ifndef NO_NSCopyBits
+#ifndef JNI64
+	{(char *)"NSCopyBits", (char *)"(ILorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/NSPoint;)V", (void *)OS_NATIVE(NSCopyBits)},
+#else
+	{(char *)"NSCopyBits", (char *)"(JLorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/NSPoint;)V", (void *)OS_NATIVE(NSCopyBits)},
+#endif
+#endif
+#ifndef NO_NSCountWindows
+#ifndef JNI64
+	{(char *)"NSCountWindows", (char *)"([I)V", (void *)OS_NATIVE(NSCountWindows)},
+#else
+	{(char *)"NSCountWindows", (char *)"([J)V", (void *)OS_NATIVE(NSCountWindows)},
+#endif
+#endif
+#ifndef NO_NSCursorAttributeName
+#ifndef JNI64
+	{(char *)"NSCursorAttributeName", (char *)"()I", (void *)OS_NATIVE(NSCursorAttributeName)},
+#else
+	{(char *)"NSCursorAttributeName", (char *)"()J", (void *)OS_NATIVE(NSCursorAttributeName)},
+#endif
+#endif
+#ifndef NO_NSDefaultRunLoopMode
+#ifndef JNI64
+	{(char *)"NSDefaultRunLoopMode", (char *)"()I", (void *)OS_NATIVE(NSDefaultRunLoopMode)},
+#else
+	{(char *)"NSDefaultRunLoopMode", (char *)"()J", (void *)OS_NATIVE(NSDefaultRunLoopMode)},
+#endif
+#endif
+#ifndef NO_NSDeviceRGBColorSpace
+#ifndef JNI64
+	{(char *)"NSDeviceRGBColorSpace", (char *)"()I", (void *)OS_NATIVE(NSDeviceRGBColorSpace)},
+#else
+	{(char *)"NSDeviceRGBColorSpace", (char *)"()J", (void *)OS_NATIVE(NSDeviceRGBColorSpace)},
+#endif
+#endif
+#ifndef NO_NSDeviceResolution
+#ifndef JNI64
+	{(char *)"NSDeviceResolution", (char *)"()I", (void *)OS_NATIVE(NSDeviceResolution)},
+#else
+	{(char *)"NSDeviceResolution", (char *)"()J", (void *)OS_NATIVE(NSDeviceResolution)},
+#endif
+#endif
+#ifndef NO_NSDragPboard
+#ifndef JNI64
+	{(char *)"NSDragPboard", (char *)"()I", (void *)OS_NATIVE(NSDragPboard)},
+#else
+	{(char *)"NSDragPboard", (char *)"()J", (void *)OS_NATIVE(NSDragPboard)},
+#endif
+#endif
+#ifndef NO_NSEqualRects
+	{(char *)"NSEqualRects", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/NSRect;)Z", (void *)OS_NATIVE(NSEqualRects)},
+#endif
+#ifndef NO_NSErrorFailingURLStringKey
+#ifndef JNI64
+	{(char *)"NSErrorFailingURLStringKey", (char *)"()I", (void *)OS_NATIVE(NSErrorFailingURLStringKey)},
+#else
+	{(char *)"NSErrorFailingURLStringKey", (char *)"()J", (void *)OS_NATIVE(NSErrorFailingURLStringKey)},
+#endif
+#endif
+#ifndef NO_NSEventTrackingRunLoopMode
+#ifndef JNI64
+	{(char *)"NSEventTrackingRunLoopMode", (char *)"()I", (void *)OS_NATIVE(NSEventTrackingRunLoopMode)},
+#else
+	{(char *)"NSEventTrackingRunLoopMode", (char *)"()J", (void *)OS_NATIVE(NSEventTrackingRunLoopMode)},
+#endif
+#endif
+#ifndef NO_NSFileTypeForHFSTypeCode
+#ifndef JNI64
+	{(char *)"NSFileTypeForHFSTypeCode", (char *)"(I)I", (void *)OS_NATIVE(NSFileTypeForHFSTypeCode)},
+#else
+	{(char *)"NSFileTypeForHFSTypeCode", (char *)"(I)J", (void *)OS_NATIVE(NSFileTypeForHFSTypeCode)},
+#endif
+#endif
+#ifndef NO_NSFilenamesPboardType
+#ifndef JNI64
+	{(char *)"NSFilenamesPboardType", (char *)"()I", (void *)OS_NATIVE(NSFilenamesPboardType)},
+#else
+	{(char *)"NSFilenamesPboardType", (char *)"()J", (void *)OS_NATIVE(NSFilenamesPboardType)},
+#endif
+#endif
+#ifndef NO_NSFontAttributeName
+#ifndef JNI64
+	{(char *)"NSFontAttributeName", (char *)"()I", (void *)OS_NATIVE(NSFontAttributeName)},
+#else
+	{(char *)"NSFontAttributeName", (char *)"()J", (void *)OS_NATIVE(NSFontAttributeName)},
+#endif
+#endif
+#ifndef NO_NSForegroundColorAttributeName
+#ifndef JNI64
+	{(char *)"NSForegroundColorAttributeName", (char *)"()I", (void *)OS_NATIVE(NSForegroundColorAttributeName)},
+#else
+	{(char *)"NSForegroundColorAttributeName", (char *)"()J", (void *)OS_NATIVE(NSForegroundColorAttributeName)},
+#endif
+#endif
+#ifndef NO_NSGetSizeAndAlignment
+#ifndef JNI64
+	{(char *)"NSGetSizeAndAlignment", (char *)"(I[I[I)I", (void *)OS_NATIVE(NSGetSizeAndAlignment)},
+#else
+	{(char *)"NSGetSizeAndAlignment", (char *)"(J[J[J)J", (void *)OS_NATIVE(NSGetSizeAndAlignment)},
+#endif
+#endif
+#ifndef NO_NSHTMLPboardType
+#ifndef JNI64
+	{(char *)"NSHTMLPboardType", (char *)"()I", (void *)OS_NATIVE(NSHTMLPboardType)},
+#else
+	{(char *)"NSHTMLPboardType", (char *)"()J", (void *)OS_NATIVE(NSHTMLPboardType)},
+#endif
+#endif
+#ifndef NO_NSLigatureAttributeName
+#ifndef JNI64
+	{(char *)"NSLigatureAttributeName", (char *)"()I", (void *)OS_NATIVE(NSLigatureAttributeName)},
+#else
+	{(char *)"NSLigatureAttributeName", (char *)"()J", (void *)OS_NATIVE(NSLigatureAttributeName)},
+#endif
+#endif
+#ifndef NO_NSLinkAttributeName
+#ifndef JNI64
+	{(char *)"NSLinkAttributeName", (char *)"()I", (void *)OS_NATIVE(NSLinkAttributeName)},
+#else
+	{(char *)"NSLinkAttributeName", (char *)"()J", (void *)OS_NATIVE(NSLinkAttributeName)},
+#endif
+#endif
+#ifndef NO_NSLocaleLanguageCode
+#ifndef JNI64
+	{(char *)"NSLocaleLanguageCode", (char *)"()I", (void *)OS_NATIVE(NSLocaleLanguageCode)},
+#else
+	{(char *)"NSLocaleLanguageCode", (char *)"()J", (void *)OS_NATIVE(NSLocaleLanguageCode)},
+#endif
+#endif
+#ifndef NO_NSModalPanelRunLoopMode
+#ifndef JNI64
+	{(char *)"NSModalPanelRunLoopMode", (char *)"()I", (void *)OS_NATIVE(NSModalPanelRunLoopMode)},
+#else
+	{(char *)"NSModalPanelRunLoopMode", (char *)"()J", (void *)OS_NATIVE(NSModalPanelRunLoopMode)},
+#endif
+#endif
+#ifndef NO_NSNumberOfColorComponents
+#ifndef JNI64
+	{(char *)"NSNumberOfColorComponents", (char *)"(I)I", (void *)OS_NATIVE(NSNumberOfColorComponents)},
+#else
+	{(char *)"NSNumberOfColorComponents", (char *)"(J)J", (void *)OS_NATIVE(NSNumberOfColorComponents)},
+#endif
+#endif
+#ifndef NO_NSObliquenessAttributeName
+#ifndef JNI64
+	{(char *)"NSObliquenessAttributeName", (char *)"()I", (void *)OS_NATIVE(NSObliquenessAttributeName)},
+#else
+	{(char *)"NSObliquenessAttributeName", (char *)"()J", (void *)OS_NATIVE(NSObliquenessAttributeName)},
+#endif
+#endif
+#ifndef NO_NSOutlineViewColumnDidMoveNotification
+#ifndef JNI64
+	{(char *)"NSOutlineViewColumnDidMoveNotification", (char *)"()I", (void *)OS_NATIVE(NSOutlineViewColumnDidMoveNotification)},
+#else
+	{(char *)"NSOutlineViewColumnDidMoveNotification", (char *)"()J", (void *)OS_NATIVE(NSOutlineViewColumnDidMoveNotification)},
+#endif
+#endif
+#ifndef NO_NSParagraphStyleAttributeName
+#ifndef JNI64
+	{(char *)"NSParagraphStyleAttributeName", (char *)"()I", (void *)OS_NATIVE(NSParagraphStyleAttributeName)},
+#else
+	{(char *)"NSParagraphStyleAttributeName", (char *)"()J", (void *)OS_NATIVE(NSParagraphStyleAttributeName)},
+#endif
+#endif
+#ifndef NO_NSPointInRect
+	{(char *)"NSPointInRect", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSPoint;Lorg/eclipse/swt/internal/cocoa/NSRect;)Z", (void *)OS_NATIVE(NSPointInRect)},
+#endif
+#ifndef NO_NSPoint_1sizeof
+	{(char *)"NSPoint_sizeof", (char *)"()I", (void *)OS_NATIVE(NSPoint_1sizeof)},
+#endif
+#ifndef NO_NSPrintAllPages
+#ifndef JNI64
+	{(char *)"NSPrintAllPages", (char *)"()I", (void *)OS_NATIVE(NSPrintAllPages)},
+#else
+	{(char *)"NSPrintAllPages", (char *)"()J", (void *)OS_NATIVE(NSPrintAllPages)},
+#endif
+#endif
+#ifndef NO_NSPrintCopies
+#ifndef JNI64
+	{(char *)"NSPrintCopies", (char *)"()I", (void *)OS_NATIVE(NSPrintCopies)},
+#else
+	{(char *)"NSPrintCopies", (char *)"()J", (void *)OS_NATIVE(NSPrintCopies)},
+#endif
+#endif
+#ifndef NO_NSPrintFirstPage
+#ifndef JNI64
+	{(char *)"NSPrintFirstPage", (char *)"()I", (void *)OS_NATIVE(NSPrintFirstPage)},
+#else
+	{(char *)"NSPrintFirstPage", (char *)"()J", (void *)OS_NATIVE(NSPrintFirstPage)},
+#endif
+#endif
+#ifndef NO_NSPrintJobDisposition
+#ifndef JNI64
+	{(char *)"NSPrintJobDisposition", (char *)"()I", (void *)OS_NATIVE(NSPrintJobDisposition)},
+#else
+	{(char *)"NSPrintJobDisposition", (char *)"()J", (void *)OS_NATIVE(NSPrintJobDisposition)},
+#endif
+#endif
+#ifndef NO_NSPrintLastPage
+#ifndef JNI64
+	{(char *)"NSPrintLastPage", (char *)"()I", (void *)OS_NATIVE(NSPrintLastPage)},
+#else
+	{(char *)"NSPrintLastPage", (char *)"()J", (void *)OS_NATIVE(NSPrintLastPage)},
+#endif
+#endif
+#ifndef NO_NSPrintMustCollate
+#ifndef JNI64
+	{(char *)"NSPrintMustCollate", (char *)"()I", (void *)OS_NATIVE(NSPrintMustCollate)},
+#else
+	{(char *)"NSPrintMustCollate", (char *)"()J", (void *)OS_NATIVE(NSPrintMustCollate)},
+#endif
+#endif
+#ifndef NO_NSPrintOrientation
+#ifndef JNI64
+	{(char *)"NSPrintOrientation", (char *)"()I", (void *)OS_NATIVE(NSPrintOrientation)},
+#else
+	{(char *)"NSPrintOrientation", (char *)"()J", (void *)OS_NATIVE(NSPrintOrientation)},
+#endif
+#endif
+#ifndef NO_NSPrintPreviewJob
+#ifndef JNI64
+	{(char *)"NSPrintPreviewJob", (char *)"()I", (void *)OS_NATIVE(NSPrintPreviewJob)},
+#else
+	{(char *)"NSPrintPreviewJob", (char *)"()J", (void *)OS_NATIVE(NSPrintPreviewJob)},
+#endif
+#endif
+#ifndef NO_NSPrintSaveJob
+#ifndef JNI64
+	{(char *)"NSPrintSaveJob", (char *)"()I", (void *)OS_NATIVE(NSPrintSaveJob)},
+#else
+	{(char *)"NSPrintSaveJob", (char *)"()J", (void *)OS_NATIVE(NSPrintSaveJob)},
+#endif
+#endif
+#ifndef NO_NSPrintSavePath
+#ifndef JNI64
+	{(char *)"NSPrintSavePath", (char *)"()I", (void *)OS_NATIVE(NSPrintSavePath)},
+#else
+	{(char *)"NSPrintSavePath", (char *)"()J", (void *)OS_NATIVE(NSPrintSavePath)},
+#endif
+#endif
+#ifndef NO_NSPrintScalingFactor
+#ifndef JNI64
+	{(char *)"NSPrintScalingFactor", (char *)"()I", (void *)OS_NATIVE(NSPrintScalingFactor)},
+#else
+	{(char *)"NSPrintScalingFactor", (char *)"()J", (void *)OS_NATIVE(NSPrintScalingFactor)},
+#endif
+#endif
+#ifndef NO_NSPrintSpoolJob
+#ifndef JNI64
+	{(char *)"NSPrintSpoolJob", (char *)"()I", (void *)OS_NATIVE(NSPrintSpoolJob)},
+#else
+	{(char *)"NSPrintSpoolJob", (char *)"()J", (void *)OS_NATIVE(NSPrintSpoolJob)},
+#endif
+#endif
+#ifndef NO_NSRTFPboardType
+#ifndef JNI64
+	{(char *)"NSRTFPboardType", (char *)"()I", (void *)OS_NATIVE(NSRTFPboardType)},
+#else
+	{(char *)"NSRTFPboardType", (char *)"()J", (void *)OS_NATIVE(NSRTFPboardType)},
+#endif
+#endif
+#ifndef NO_NSRange_1sizeof
+	{(char *)"NSRange_sizeof", (char *)"()I", (void *)OS_NATIVE(NSRange_1sizeof)},
+#endif
+#ifndef NO_NSRectFillUsingOperation
+#ifndef JNI64
+	{(char *)"NSRectFillUsingOperation", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;I)V", (void *)OS_NATIVE(NSRectFillUsingOperation)},
+#else
+	{(char *)"NSRectFillUsingOperation", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;J)V", (void *)OS_NATIVE(NSRectFillUsingOperation)},
+#endif
+#endif
+#ifndef NO_NSRect_1sizeof
+	{(char *)"NSRect_sizeof", (char *)"()I", (void *)OS_NATIVE(NSRect_1sizeof)},
+#endif
+#ifndef NO_NSSearchPathForDirectoriesInDomains
+#ifndef JNI64
+	{(char *)"NSSearchPathForDirectoriesInDomains", (char *)"(IIZ)I", (void *)OS_NATIVE(NSSearchPathForDirectoriesInDomains)},
+#else
+	{(char *)"NSSearchPathForDirectoriesInDomains", (char *)"(JJZ)J", (void *)OS_NATIVE(NSSearchPathForDirectoriesInDomains)},
+#endif
+#endif
+#ifndef NO_NSSize_1sizeof
+	{(char *)"NSSize_sizeof", (char *)"()I", (void *)OS_NATIVE(NSSize_1sizeof)},
+#endif
+#ifndef NO_NSSpellingStateAttributeName
+#ifndef JNI64
+	{(char *)"NSSpellingStateAttributeName", (char *)"()I", (void *)OS_NATIVE(NSSpellingStateAttributeName)},
+#else
+	{(char *)"NSSpellingStateAttributeName", (char *)"()J", (void *)OS_NATIVE(NSSpellingStateAttributeName)},
+#endif
+#endif
+#ifndef NO_NSStrikethroughColorAttributeName
+#ifndef JNI64
+	{(char *)"NSStrikethroughColorAttributeName", (char *)"()I", (void *)OS_NATIVE(NSStrikethroughColorAttributeName)},
+#else
+	{(char *)"NSStrikethroughColorAttributeName", (char *)"()J", (void *)OS_NATIVE(NSStrikethroughColorAttributeName)},
+#endif
+#endif
+#ifndef NO_NSStrikethroughStyleAttributeName
+#ifndef JNI64
+	{(char *)"NSStrikethroughStyleAttributeName", (char *)"()I", (void *)OS_NATIVE(NSStrikethroughStyleAttributeName)},
+#else
+	{(char *)"NSStrikethroughStyleAttributeName", (char *)"()J", (void *)OS_NATIVE(NSStrikethroughStyleAttributeName)},
+#endif
+#endif
+#ifndef NO_NSStringPboardType
+#ifndef JNI64
+	{(char *)"NSStringPboardType", (char *)"()I", (void *)OS_NATIVE(NSStringPboardType)},
+#else
+	{(char *)"NSStringPboardType", (char *)"()J", (void *)OS_NATIVE(NSStringPboardType)},
+#endif
+#endif
+#ifndef NO_NSStrokeWidthAttributeName
+#ifndef JNI64
+	{(char *)"NSStrokeWidthAttributeName", (char *)"()I", (void *)OS_NATIVE(NSStrokeWidthAttributeName)},
+#else
+	{(char *)"NSStrokeWidthAttributeName", (char *)"()J", (void *)OS_NATIVE(NSStrokeWidthAttributeName)},
+#endif
+#endif
+#ifndef NO_NSSystemColorsDidChangeNotification
+#ifndef JNI64
+	{(char *)"NSSystemColorsDidChangeNotification", (char *)"()I", (void *)OS_NATIVE(NSSystemColorsDidChangeNotification)},
+#else
+	{(char *)"NSSystemColorsDidChangeNotification", (char *)"()J", (void *)OS_NATIVE(NSSystemColorsDidChangeNotification)},
+#endif
+#endif
+#ifndef NO_NSTIFFPboardType
+#ifndef JNI64
+	{(char *)"NSTIFFPboardType", (char *)"()I", (void *)OS_NATIVE(NSTIFFPboardType)},
+#else
+	{(char *)"NSTIFFPboardType", (char *)"()J", (void *)OS_NATIVE(NSTIFFPboardType)},
+#endif
+#endif
+#ifndef NO_NSTableViewColumnDidMoveNotification
+#ifndef JNI64
+	{(char *)"NSTableViewColumnDidMoveNotification", (char *)"()I", (void *)OS_NATIVE(NSTableViewColumnDidMoveNotification)},
+#else
+	{(char *)"NSTableViewColumnDidMoveNotification", (char *)"()J", (void *)OS_NATIVE(NSTableViewColumnDidMoveNotification)},
+#endif
+#endif
+#ifndef NO_NSTemporaryDirectory
+#ifndef JNI64
+	{(char *)"NSTemporaryDirectory", (char *)"()I", (void *)OS_NATIVE(NSTemporaryDirectory)},
+#else
+	{(char *)"NSTemporaryDirectory", (char *)"()J", (void *)OS_NATIVE(NSTemporaryDirectory)},
+#endif
+#endif
+#ifndef NO_NSToolbarCustomizeToolbarItemIdentifier
+#ifndef JNI64
+	{(char *)"NSToolbarCustomizeToolbarItemIdentifier", (char *)"()I", (void *)OS_NATIVE(NSToolbarCustomizeToolbarItemIdentifier)},
+#else
+	{(char *)"NSToolbarCustomizeToolbarItemIdentifier", (char *)"()J", (void *)OS_NATIVE(NSToolbarCustomizeToolbarItemIdentifier)},
+#endif
+#endif
+#ifndef NO_NSToolbarDidRemoveItemNotification
+#ifndef JNI64
+	{(char *)"NSToolbarDidRemoveItemNotification", (char *)"()I", (void *)OS_NATIVE(NSToolbarDidRemoveItemNotification)},
+#else
+	{(char *)"NSToolbarDidRemoveItemNotification", (char *)"()J", (void *)OS_NATIVE(NSToolbarDidRemoveItemNotification)},
+#endif
+#endif
+#ifndef NO_NSToolbarFlexibleSpaceItemIdentifier
+#ifndef JNI64
+	{(char *)"NSToolbarFlexibleSpaceItemIdentifier", (char *)"()I", (void *)OS_NATIVE(NSToolbarFlexibleSpaceItemIdentifier)},
+#else
+	{(char *)"NSToolbarFlexibleSpaceItemIdentifier", (char *)"()J", (void *)OS_NATIVE(NSToolbarFlexibleSpaceItemIdentifier)},
+#endif
+#endif
+#ifndef NO_NSToolbarPrintItemIdentifier
+#ifndef JNI64
+	{(char *)"NSToolbarPrintItemIdentifier", (char *)"()I", (void *)OS_NATIVE(NSToolbarPrintItemIdentifier)},
+#else
+	{(char *)"NSToolbarPrintItemIdentifier", (char *)"()J", (void *)OS_NATIVE(NSToolbarPrintItemIdentifier)},
+#endif
+#endif
+#ifndef NO_NSToolbarSeparatorItemIdentifier
+#ifndef JNI64
+	{(char *)"NSToolbarSeparatorItemIdentifier", (char *)"()I", (void *)OS_NATIVE(NSToolbarSeparatorItemIdentifier)},
+#else
+	{(char *)"NSToolbarSeparatorItemIdentifier", (char *)"()J", (void *)OS_NATIVE(NSToolbarSeparatorItemIdentifier)},
+#endif
+#endif
+#ifndef NO_NSToolbarShowColorsItemIdentifier
+#ifndef JNI64
+	{(char *)"NSToolbarShowColorsItemIdentifier", (char *)"()I", (void *)OS_NATIVE(NSToolbarShowColorsItemIdentifier)},
+#else
+	{(char *)"NSToolbarShowColorsItemIdentifier", (char *)"()J", (void *)OS_NATIVE(NSToolbarShowColorsItemIdentifier)},
+#endif
+#endif
+#ifndef NO_NSToolbarShowFontsItemIdentifier
+#ifndef JNI64
+	{(char *)"NSToolbarShowFontsItemIdentifier", (char *)"()I", (void *)OS_NATIVE(NSToolbarShowFontsItemIdentifier)},
+#else
+	{(char *)"NSToolbarShowFontsItemIdentifier", (char *)"()J", (void *)OS_NATIVE(NSToolbarShowFontsItemIdentifier)},
+#endif
+#endif
+#ifndef NO_NSToolbarSpaceItemIdentifier
+#ifndef JNI64
+	{(char *)"NSToolbarSpaceItemIdentifier", (char *)"()I", (void *)OS_NATIVE(NSToolbarSpaceItemIdentifier)},
+#else
+	{(char *)"NSToolbarSpaceItemIdentifier", (char *)"()J", (void *)OS_NATIVE(NSToolbarSpaceItemIdentifier)},
+#endif
+#endif
+#ifndef NO_NSToolbarWillAddItemNotification
+#ifndef JNI64
+	{(char *)"NSToolbarWillAddItemNotification", (char *)"()I", (void *)OS_NATIVE(NSToolbarWillAddItemNotification)},
+#else
+	{(char *)"NSToolbarWillAddItemNotification", (char *)"()J", (void *)OS_NATIVE(NSToolbarWillAddItemNotification)},
+#endif
+#endif
+#ifndef NO_NSURLPboardType
+#ifndef JNI64
+	{(char *)"NSURLPboardType", (char *)"()I", (void *)OS_NATIVE(NSURLPboardType)},
+#else
+	{(char *)"NSURLPboardType", (char *)"()J", (void *)OS_NATIVE(NSURLPboardType)},
+#endif
+#endif
+#ifndef NO_NSUnderlineColorAttributeName
+#ifndef JNI64
+	{(char *)"NSUnderlineColorAttributeName", (char *)"()I", (void *)OS_NATIVE(NSUnderlineColorAttributeName)},
+#else
+	{(char *)"NSUnderlineColorAttributeName", (char *)"()J", (void *)OS_NATIVE(NSUnderlineColorAttributeName)},
+#endif
+#endif
+#ifndef NO_NSUnderlineStyleAttributeName
+#ifndef JNI64
+	{(char *)"NSUnderlineStyleAttributeName", (char *)"()I", (void *)OS_NATIVE(NSUnderlineStyleAttributeName)},
+#else
+	{(char *)"NSUnderlineStyleAttributeName", (char *)"()J", (void *)OS_NATIVE(NSUnderlineStyleAttributeName)},
+#endif
+#endif
+#ifndef NO_NSViewGlobalFrameDidChangeNotification
+#ifndef JNI64
+	{(char *)"NSViewGlobalFrameDidChangeNotification", (char *)"()I", (void *)OS_NATIVE(NSViewGlobalFrameDidChangeNotification)},
+#else
+	{(char *)"NSViewGlobalFrameDidChangeNotification", (char *)"()J", (void *)OS_NATIVE(NSViewGlobalFrameDidChangeNotification)},
+#endif
+#endif
+#ifndef NO_NSWindowDidBecomeKeyNotification
+#ifndef JNI64
+	{(char *)"NSWindowDidBecomeKeyNotification", (char *)"()I", (void *)OS_NATIVE(NSWindowDidBecomeKeyNotification)},
+#else
+	{(char *)"NSWindowDidBecomeKeyNotification", (char *)"()J", (void *)OS_NATIVE(NSWindowDidBecomeKeyNotification)},
+#endif
+#endif
+#ifndef NO_NSWindowDidDeminiaturizeNotification
+#ifndef JNI64
+	{(char *)"NSWindowDidDeminiaturizeNotification", (char *)"()I", (void *)OS_NATIVE(NSWindowDidDeminiaturizeNotification)},
+#else
+	{(char *)"NSWindowDidDeminiaturizeNotification", (char *)"()J", (void *)OS_NATIVE(NSWindowDidDeminiaturizeNotification)},
+#endif
+#endif
+#ifndef NO_NSWindowDidMiniaturizeNotification
+#ifndef JNI64
+	{(char *)"NSWindowDidMiniaturizeNotification", (char *)"()I", (void *)OS_NATIVE(NSWindowDidMiniaturizeNotification)},
+#else
+	{(char *)"NSWindowDidMiniaturizeNotification", (char *)"()J", (void *)OS_NATIVE(NSWindowDidMiniaturizeNotification)},
+#endif
+#endif
+#ifndef NO_NSWindowDidMoveNotification
+#ifndef JNI64
+	{(char *)"NSWindowDidMoveNotification", (char *)"()I", (void *)OS_NATIVE(NSWindowDidMoveNotification)},
+#else
+	{(char *)"NSWindowDidMoveNotification", (char *)"()J", (void *)OS_NATIVE(NSWindowDidMoveNotification)},
+#endif
+#endif
+#ifndef NO_NSWindowDidResignKeyNotification
+#ifndef JNI64
+	{(char *)"NSWindowDidResignKeyNotification", (char *)"()I", (void *)OS_NATIVE(NSWindowDidResignKeyNotification)},
+#else
+	{(char *)"NSWindowDidResignKeyNotification", (char *)"()J", (void *)OS_NATIVE(NSWindowDidResignKeyNotification)},
+#endif
+#endif
+#ifndef NO_NSWindowDidResizeNotification
+#ifndef JNI64
+	{(char *)"NSWindowDidResizeNotification", (char *)"()I", (void *)OS_NATIVE(NSWindowDidResizeNotification)},
+#else
+	{(char *)"NSWindowDidResizeNotification", (char *)"()J", (void *)OS_NATIVE(NSWindowDidResizeNotification)},
+#endif
+#endif
+#ifndef NO_NSWindowList
+#ifndef JNI64
+	{(char *)"NSWindowList", (char *)"(I[I)V", (void *)OS_NATIVE(NSWindowList)},
+#else
+	{(char *)"NSWindowList", (char *)"(J[J)V", (void *)OS_NATIVE(NSWindowList)},
+#endif
+#endif
+#ifndef NO_NSWindowWillCloseNotification
+#ifndef JNI64
+	{(char *)"NSWindowWillCloseNotification", (char *)"()I", (void *)OS_NATIVE(NSWindowWillCloseNotification)},
+#else
+	{(char *)"NSWindowWillCloseNotification", (char *)"()J", (void *)OS_NATIVE(NSWindowWillCloseNotification)},
+#endif
+#endif
+#ifndef NO_NewGlobalRef
+#ifndef JNI64
+	{(char *)"NewGlobalRef", (char *)"(Ljava/lang/Object;)I", (void *)OS_NATIVE(NewGlobalRef)},
+#else
+	{(char *)"NewGlobalRef", (char *)"(Ljava/lang/Object;)J", (void *)OS_NATIVE(NewGlobalRef)},
+#endif
+#endif
+#ifndef NO_NewRgn
+#ifndef JNI64
+	{(char *)"NewRgn", (char *)"()I", (void *)OS_NATIVE(NewRgn)},
+#else
+	{(char *)"NewRgn", (char *)"()J", (void *)OS_NATIVE(NewRgn)},
+#endif
+#endif
+#ifndef NO_OffsetRgn
+#ifndef JNI64
+	{(char *)"OffsetRgn", (char *)"(ISS)V", (void *)OS_NATIVE(OffsetRgn)},
+#else
+	{(char *)"OffsetRgn", (char *)"(JSS)V", (void *)OS_NATIVE(OffsetRgn)},
+#endif
+#endif
+#ifndef NO_OpenRgn
+	{(char *)"OpenRgn", (char *)"()V", (void *)OS_NATIVE(OpenRgn)},
+#endif
+#ifndef NO_PMGetDuplex
+#ifndef JNI64
+	{(char *)"PMGetDuplex", (char *)"(I[I)I", (void *)OS_NATIVE(PMGetDuplex)},
+#else
+	{(char *)"PMGetDuplex", (char *)"(J[I)J", (void *)OS_NATIVE(PMGetDuplex)},
+#endif
+#endif
+#ifndef NO_PMPrinterGetIndexedPrinterResolution
+#ifndef JNI64
+	{(char *)"PMPrinterGetIndexedPrinterResolution", (char *)"(IILorg/eclipse/swt/internal/cocoa/PMResolution;)I", (void *)OS_NATIVE(PMPrinterGetIndexedPrinterResolution)},
+#else
+	{(char *)"PMPrinterGetIndexedPrinterResolution", (char *)"(JILorg/eclipse/swt/internal/cocoa/PMResolution;)J", (void *)OS_NATIVE(PMPrinterGetIndexedPrinterResolution)},
+#endif
+#endif
+#ifndef NO_PMPrinterGetOutputResolution
+#ifndef JNI64
+	{(char *)"PMPrinterGetOutputResolution", (char *)"(IILorg/eclipse/swt/internal/cocoa/PMResolution;)I", (void *)OS_NATIVE(PMPrinterGetOutputResolution)},
+#else
+	{(char *)"PMPrinterGetOutputResolution", (char *)"(JJLorg/eclipse/swt/internal/cocoa/PMResolution;)J", (void *)OS_NATIVE(PMPrinterGetOutputResolution)},
+#endif
+#endif
+#ifndef NO_PMPrinterGetPrinterResolutionCount
+#ifndef JNI64
+	{(char *)"PMPrinterGetPrinterResolutionCount", (char *)"(I[I)I", (void *)OS_NATIVE(PMPrinterGetPrinterResolutionCount)},
+#else
+	{(char *)"PMPrinterGetPrinterResolutionCount", (char *)"(J[I)J", (void *)OS_NATIVE(PMPrinterGetPrinterResolutionCount)},
+#endif
+#endif
+#ifndef NO_PMSessionGetCurrentPrinter
+#ifndef JNI64
+	{(char *)"PMSessionGetCurrentPrinter", (char *)"(I[I)I", (void *)OS_NATIVE(PMSessionGetCurrentPrinter)},
+#else
+	{(char *)"PMSessionGetCurrentPrinter", (char *)"(J[J)J", (void *)OS_NATIVE(PMSessionGetCurrentPrinter)},
+#endif
+#endif
+#ifndef NO_PMSessionGetDestinationType
+#ifndef JNI64
+	{(char *)"PMSessionGetDestinationType", (char *)"(II[S)I", (void *)OS_NATIVE(PMSessionGetDestinationType)},
+#else
+	{(char *)"PMSessionGetDestinationType", (char *)"(JJ[S)J", (void *)OS_NATIVE(PMSessionGetDestinationType)},
+#endif
+#endif
+#ifndef NO_PMSetDuplex
+#ifndef JNI64
+	{(char *)"PMSetDuplex", (char *)"(II)I", (void *)OS_NATIVE(PMSetDuplex)},
+#else
+	{(char *)"PMSetDuplex", (char *)"(JI)J", (void *)OS_NATIVE(PMSetDuplex)},
+#endif
+#endif
+#ifndef NO_PtInRgn
+#ifndef JNI64
+	{(char *)"PtInRgn", (char *)"([SI)Z", (void *)OS_NATIVE(PtInRgn)},
+#else
+	{(char *)"PtInRgn", (char *)"([SJ)Z", (void *)OS_NATIVE(PtInRgn)},
+#endif
+#endif
+#ifndef NO_QDRegionToRects
+#ifndef JNI64
+	{(char *)"QDRegionToRects", (char *)"(IIII)I", (void *)OS_NATIVE(QDRegionToRects)},
+#else
+	{(char *)"QDRegionToRects", (char *)"(JIJJ)I", (void *)OS_NATIVE(QDRegionToRects)},
+#endif
+#endif
+#ifndef NO_RectInRgn
+#ifndef JNI64
+	{(char *)"RectInRgn", (char *)"([SI)Z", (void *)OS_NATIVE(RectInRgn)},
+#else
+	{(char *)"RectInRgn", (char *)"([SJ)Z", (void *)OS_NATIVE(RectInRgn)},
+#endif
+#endif
+#ifndef NO_RectRgn
+#ifndef JNI64
+	{(char *)"RectRgn", (char *)"(I[S)V", (void *)OS_NATIVE(RectRgn)},
+#else
+	{(char *)"RectRgn", (char *)"(J[S)V", (void *)OS_NATIVE(RectRgn)},
+#endif
+#endif
+#ifndef NO_SecPolicySearchCopyNext
+#ifndef JNI64
+	{(char *)"SecPolicySearchCopyNext", (char *)"(I[I)I", (void *)OS_NATIVE(SecPolicySearchCopyNext)},
+#else
+	{(char *)"SecPolicySearchCopyNext", (char *)"(J[J)I", (void *)OS_NATIVE(SecPolicySearchCopyNext)},
+#endif
+#endif
+#ifndef NO_SecPolicySearchCreate
+#ifndef JNI64
+	{(char *)"SecPolicySearchCreate", (char *)"(III[I)I", (void *)OS_NATIVE(SecPolicySearchCreate)},
+#else
+	{(char *)"SecPolicySearchCreate", (char *)"(JJJ[J)I", (void *)OS_NATIVE(SecPolicySearchCreate)},
+#endif
+#endif
+#ifndef NO_SecTrustCreateWithCertificates
+#ifndef JNI64
+	{(char *)"SecTrustCreateWithCertificates", (char *)"(II[I)I", (void *)OS_NATIVE(SecTrustCreateWithCertificates)},
+#else
+	{(char *)"SecTrustCreateWithCertificates", (char *)"(JJ[J)I", (void *)OS_NATIVE(SecTrustCreateWithCertificates)},
+#endif
+#endif
+#ifndef NO_SectRgn
+#ifndef JNI64
+	{(char *)"SectRgn", (char *)"(III)V", (void *)OS_NATIVE(SectRgn)},
+#else
+	{(char *)"SectRgn", (char *)"(JJJ)V", (void *)OS_NATIVE(SectRgn)},
+#endif
+#endif
+#ifndef NO_SetFrontProcess
+	{(char *)"SetFrontProcess", (char *)"([I)I", (void *)OS_NATIVE(SetFrontProcess)},
+#endif
+#ifndef NO_SetRect
+	{(char *)"SetRect", (char *)"([SSSSS)V", (void *)OS_NATIVE(SetRect)},
+#endif
+#ifndef NO_SetSystemUIMode
+	{(char *)"SetSystemUIMode", (char *)"(II)I", (void *)OS_NATIVE(SetSystemUIMode)},
+#endif
+#ifndef NO_SetThemeCursor
+	{(char *)"SetThemeCursor", (char *)"(I)I", (void *)OS_NATIVE(SetThemeCursor)},
+#endif
+#ifndef NO_TISCopyCurrentKeyboardInputSource
+#ifndef JNI64
+	{(char *)"TISCopyCurrentKeyboardInputSource", (char *)"()I", (void *)OS_NATIVE(TISCopyCurrentKeyboardInputSource)},
+#else
+	{(char *)"TISCopyCurrentKeyboardInputSource", (char *)"()J", (void *)OS_NATIVE(TISCopyCurrentKeyboardInputSource)},
+#endif
+#endif
+#ifndef NO_TISGetInputSourceProperty
+#ifndef JNI64
+	{(char *)"TISGetInputSourceProperty", (char *)"(II)I", (void *)OS_NATIVE(TISGetInputSourceProperty)},
+#else
+	{(char *)"TISGetInputSourceProperty", (char *)"(JJ)J", (void *)OS_NATIVE(TISGetInputSourceProperty)},
+#endif
+#endif
+#ifndef NO_TransformProcessType
+	{(char *)"TransformProcessType", (char *)"([II)I", (void *)OS_NATIVE(TransformProcessType)},
+#endif
+#ifndef NO_UCKeyTranslate
+#ifndef JNI64
+	{(char *)"UCKeyTranslate", (char *)"(ISSIII[II[I[C)I", (void *)OS_NATIVE(UCKeyTranslate)},
+#else
+	{(char *)"UCKeyTranslate", (char *)"(JSSIII[II[I[C)I", (void *)OS_NATIVE(UCKeyTranslate)},
+#endif
+#endif
+#ifndef NO_UTTypeEqual
+#ifndef JNI64
+	{(char *)"UTTypeEqual", (char *)"(II)Z", (void *)OS_NATIVE(UTTypeEqual)},
+#else
+	{(char *)"UTTypeEqual", (char *)"(JJ)Z", (void *)OS_NATIVE(UTTypeEqual)},
+#endif
+#endif
+#ifndef NO_UnionRgn
+#ifndef JNI64
+	{(char *)"UnionRgn", (char *)"(III)V", (void *)OS_NATIVE(UnionRgn)},
+#else
+	{(char *)"UnionRgn", (char *)"(JJJ)V", (void *)OS_NATIVE(UnionRgn)},
+#endif
+#endif
+#ifndef NO_call
+#ifndef JNI64
+	{(char *)"call", (char *)"(III)V", (void *)OS_NATIVE(call)},
+#else
+	{(char *)"call", (char *)"(JJJ)V", (void *)OS_NATIVE(call)},
+#endif
+#endif
+#ifndef NO_class_1addIvar
+#ifndef JNI64
+	{(char *)"class_addIvar", (char *)"(I[BIB[B)Z", (void *)OS_NATIVE(class_1addIvar)},
+#else
+	{(char *)"class_addIvar", (char *)"(J[BJB[B)Z", (void *)OS_NATIVE(class_1addIvar)},
+#endif
+#endif
+#ifndef NO_class_1addMethod
+#ifndef JNI64
+	{(char *)"class_addMethod", (char *)"(IIILjava/lang/String;)Z", (void *)OS_NATIVE(class_1addMethod)},
+#else
+	{(char *)"class_addMethod", (char *)"(JJJLjava/lang/String;)Z", (void *)OS_NATIVE(class_1addMethod)},
+#endif
+#endif
+#ifndef NO_class_1addProtocol
+#ifndef JNI64
+	{(char *)"class_addProtocol", (char *)"(II)Z", (void *)OS_NATIVE(class_1addProtocol)},
+#else
+	{(char *)"class_addProtocol", (char *)"(JJ)Z", (void *)OS_NATIVE(class_1addProtocol)},
+#endif
+#endif
+#ifndef NO_class_1createInstance
+#ifndef JNI64
+	{(char *)"class_createInstance", (char *)"(II)I", (void *)OS_NATIVE(class_1createInstance)},
+#else
+	{(char *)"class_createInstance", (char *)"(JJ)J", (void *)OS_NATIVE(class_1createInstance)},
+#endif
+#endif
+#ifndef NO_class_1getClassMethod
+#ifndef JNI64
+	{(char *)"class_getClassMethod", (char *)"(II)I", (void *)OS_NATIVE(class_1getClassMethod)},
+#else
+	{(char *)"class_getClassMethod", (char *)"(JJ)J", (void *)OS_NATIVE(class_1getClassMethod)},
+#endif
+#endif
+#ifndef NO_class_1getInstanceMethod
+#ifndef JNI64
+	{(char *)"class_getInstanceMethod", (char *)"(II)I", (void *)OS_NATIVE(class_1getInstanceMethod)},
+#else
+	{(char *)"class_getInstanceMethod", (char *)"(JJ)J", (void *)OS_NATIVE(class_1getInstanceMethod)},
+#endif
+#endif
+#ifndef NO_class_1getMethodImplementation
+#ifndef JNI64
+	{(char *)"class_getMethodImplementation", (char *)"(II)I", (void *)OS_NATIVE(class_1getMethodImplementation)},
+#else
+	{(char *)"class_getMethodImplementation", (char *)"(JJ)J", (void *)OS_NATIVE(class_1getMethodImplementation)},
+#endif
+#endif
+#ifndef NO_class_1getSuperclass
+#ifndef JNI64
+	{(char *)"class_getSuperclass", (char *)"(I)I", (void *)OS_NATIVE(class_1getSuperclass)},
+#else
+	{(char *)"class_getSuperclass", (char *)"(J)J", (void *)OS_NATIVE(class_1getSuperclass)},
+#endif
+#endif
+#ifndef NO_getpid
+	{(char *)"getpid", (char *)"()I", (void *)OS_NATIVE(getpid)},
+#endif
+#ifndef NO_instrumentObjcMessageSends
+	{(char *)"instrumentObjcMessageSends", (char *)"(Z)V", (void *)OS_NATIVE(instrumentObjcMessageSends)},
+#endif
+#ifndef NO_kCFAllocatorDefault
+#ifndef JNI64
+	{(char *)"kCFAllocatorDefault", (char *)"()I", (void *)OS_NATIVE(kCFAllocatorDefault)},
+#else
+	{(char *)"kCFAllocatorDefault", (char *)"()J", (void *)OS_NATIVE(kCFAllocatorDefault)},
+#endif
+#endif
+#ifndef NO_kCFRunLoopCommonModes
+#ifndef JNI64
+	{(char *)"kCFRunLoopCommonModes", (char *)"()I", (void *)OS_NATIVE(kCFRunLoopCommonModes)},
+#else
+	{(char *)"kCFRunLoopCommonModes", (char *)"()J", (void *)OS_NATIVE(kCFRunLoopCommonModes)},
+#endif
+#endif
+#ifndef NO_kCFTypeDictionaryKeyCallBacks
+#ifndef JNI64
+	{(char *)"kCFTypeDictionaryKeyCallBacks", (char *)"()I", (void *)OS_NATIVE(kCFTypeDictionaryKeyCallBacks)},
+#else
+	{(char *)"kCFTypeDictionaryKeyCallBacks", (char *)"()J", (void *)OS_NATIVE(kCFTypeDictionaryKeyCallBacks)},
+#endif
+#endif
+#ifndef NO_kCFTypeDictionaryValueCallBacks
+#ifndef JNI64
+	{(char *)"kCFTypeDictionaryValueCallBacks", (char *)"()I", (void *)OS_NATIVE(kCFTypeDictionaryValueCallBacks)},
+#else
+	{(char *)"kCFTypeDictionaryValueCallBacks", (char *)"()J", (void *)OS_NATIVE(kCFTypeDictionaryValueCallBacks)},
+#endif
+#endif
+#ifndef NO_kCTFontAttributeName
+#ifndef JNI64
+	{(char *)"kCTFontAttributeName", (char *)"()I", (void *)OS_NATIVE(kCTFontAttributeName)},
+#else
+	{(char *)"kCTFontAttributeName", (char *)"()J", (void *)OS_NATIVE(kCTFontAttributeName)},
+#endif
+#endif
+#ifndef NO_kCTForegroundColorAttributeName
+#ifndef JNI64
+	{(char *)"kCTForegroundColorAttributeName", (char *)"()I", (void *)OS_NATIVE(kCTForegroundColorAttributeName)},
+#else
+	{(char *)"kCTForegroundColorAttributeName", (char *)"()J", (void *)OS_NATIVE(kCTForegroundColorAttributeName)},
+#endif
+#endif
+#ifndef NO_kCTParagraphStyleAttributeName
+#ifndef JNI64
+	{(char *)"kCTParagraphStyleAttributeName", (char *)"()I", (void *)OS_NATIVE(kCTParagraphStyleAttributeName)},
+#else
+	{(char *)"kCTParagraphStyleAttributeName", (char *)"()J", (void *)OS_NATIVE(kCTParagraphStyleAttributeName)},
+#endif
+#endif
+#ifndef NO_kUTTypeFileURL
+#ifndef JNI64
+	{(char *)"kUTTypeFileURL", (char *)"()I", (void *)OS_NATIVE(kUTTypeFileURL)},
+#else
+	{(char *)"kUTTypeFileURL", (char *)"()J", (void *)OS_NATIVE(kUTTypeFileURL)},
+#endif
+#endif
+#ifndef NO_kUTTypeURL
+#ifndef JNI64
+	{(char *)"kUTTypeURL", (char *)"()I", (void *)OS_NATIVE(kUTTypeURL)},
+#else
+	{(char *)"kUTTypeURL", (char *)"()J", (void *)OS_NATIVE(kUTTypeURL)},
+#endif
+#endif
+#if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_CFRange_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_CFRange_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(ILorg/eclipse/swt/internal/cocoa/CFRange;I)V", (void *)OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CFRange_2I)},
+#else
+	{(char *)"memmove", (char *)"(JLorg/eclipse/swt/internal/cocoa/CFRange;J)V", (void *)OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CFRange_2J)},
+#endif
+#endif
+#if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_CGAffineTransform_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_CGAffineTransform_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(ILorg/eclipse/swt/internal/cocoa/CGAffineTransform;I)V", (void *)OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CGAffineTransform_2I)},
+#else
+	{(char *)"memmove", (char *)"(JLorg/eclipse/swt/internal/cocoa/CGAffineTransform;J)V", (void *)OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CGAffineTransform_2J)},
+#endif
+#endif
+#if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_CGPathElement_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_CGPathElement_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(ILorg/eclipse/swt/internal/cocoa/CGPathElement;I)V", (void *)OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CGPathElement_2I)},
+#else
+	{(char *)"memmove", (char *)"(JLorg/eclipse/swt/internal/cocoa/CGPathElement;J)V", (void *)OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CGPathElement_2J)},
+#endif
+#endif
+#if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_CGPoint_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_CGPoint_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(ILorg/eclipse/swt/internal/cocoa/CGPoint;I)V", (void *)OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CGPoint_2I)},
+#else
+	{(char *)"memmove", (char *)"(JLorg/eclipse/swt/internal/cocoa/CGPoint;J)V", (void *)OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CGPoint_2J)},
+#endif
+#endif
+#if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_CGRect_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_CGRect_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(ILorg/eclipse/swt/internal/cocoa/CGRect;I)V", (void *)OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CGRect_2I)},
+#else
+	{(char *)"memmove", (char *)"(JLorg/eclipse/swt/internal/cocoa/CGRect;J)V", (void *)OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CGRect_2J)},
+#endif
+#endif
+#if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_CGSize_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_CGSize_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(ILorg/eclipse/swt/internal/cocoa/CGSize;I)V", (void *)OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CGSize_2I)},
+#else
+	{(char *)"memmove", (char *)"(JLorg/eclipse/swt/internal/cocoa/CGSize;J)V", (void *)OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CGSize_2J)},
+#endif
+#endif
+#if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(ILorg/eclipse/swt/internal/cocoa/CTParagraphStyleSetting;I)V", (void *)OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2I)},
+#else
+	{(char *)"memmove", (char *)"(JLorg/eclipse/swt/internal/cocoa/CTParagraphStyleSetting;J)V", (void *)OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2J)},
+#endif
+#endif
+#if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(ILorg/eclipse/swt/internal/cocoa/NSAffineTransformStruct;I)V", (void *)OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2I)},
+#else
+	{(char *)"memmove", (char *)"(JLorg/eclipse/swt/internal/cocoa/NSAffineTransformStruct;J)V", (void *)OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2J)},
+#endif
+#endif
+#if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_NSPoint_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_NSPoint_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(ILorg/eclipse/swt/internal/cocoa/NSPoint;I)V", (void *)OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_NSPoint_2I)},
+#else
+	{(char *)"memmove", (char *)"(JLorg/eclipse/swt/internal/cocoa/NSPoint;J)V", (void *)OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_NSPoint_2J)},
+#endif
+#endif
+#if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_NSRange_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_NSRange_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(ILorg/eclipse/swt/internal/cocoa/NSRange;I)V", (void *)OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_NSRange_2I)},
+#else
+	{(char *)"memmove", (char *)"(JLorg/eclipse/swt/internal/cocoa/NSRange;J)V", (void *)OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_NSRange_2J)},
+#endif
+#endif
+#if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(ILorg/eclipse/swt/internal/cocoa/NSRect;I)V", (void *)OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_NSRect_2I)},
+#else
+	{(char *)"memmove", (char *)"(JLorg/eclipse/swt/internal/cocoa/NSRect;J)V", (void *)OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_NSRect_2J)},
+#endif
+#endif
+#if (!defined(NO_memmove__ILorg_eclipse_swt_internal_cocoa_NSSize_2I) && !defined(JNI64)) || (!defined(NO_memmove__JLorg_eclipse_swt_internal_cocoa_NSSize_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(ILorg/eclipse/swt/internal/cocoa/NSSize;I)V", (void *)OS_NATIVE(memmove__ILorg_eclipse_swt_internal_cocoa_NSSize_2I)},
+#else
+	{(char *)"memmove", (char *)"(JLorg/eclipse/swt/internal/cocoa/NSSize;J)V", (void *)OS_NATIVE(memmove__JLorg_eclipse_swt_internal_cocoa_NSSize_2J)},
+#endif
+#endif
+#if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CFRange_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CFRange_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/CFRange;II)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CFRange_2II)},
+#else
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/CFRange;JJ)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CFRange_2JJ)},
+#endif
+#endif
+#if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGAffineTransform_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGAffineTransform_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/CGAffineTransform;II)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGAffineTransform_2II)},
+#else
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/CGAffineTransform;JJ)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGAffineTransform_2JJ)},
+#endif
+#endif
+#if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGPathElement_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGPathElement_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/CGPathElement;II)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGPathElement_2II)},
+#else
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/CGPathElement;JJ)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGPathElement_2JJ)},
+#endif
+#endif
+#if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGPoint_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGPoint_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/CGPoint;II)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGPoint_2II)},
+#else
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/CGPoint;JJ)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGPoint_2JJ)},
+#endif
+#endif
+#if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGRect_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGRect_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/CGRect;II)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGRect_2II)},
+#else
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/CGRect;JJ)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGRect_2JJ)},
+#endif
+#endif
+#if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGSize_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CGSize_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/CGSize;II)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGSize_2II)},
+#else
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/CGSize;JJ)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CGSize_2JJ)},
+#endif
+#endif
+#if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/CTParagraphStyleSetting;II)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2II)},
+#else
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/CTParagraphStyleSetting;JJ)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_CTParagraphStyleSetting_2JJ)},
+#endif
+#endif
+#if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSAffineTransformStruct;II)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2II)},
+#else
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSAffineTransformStruct;JJ)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2JJ)},
+#endif
+#endif
+#if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSPoint_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSPoint;II)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSPoint_2II)},
+#else
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSPoint;JJ)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJ)},
+#endif
+#endif
+#if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSRange_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRange;II)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSRange_2II)},
+#else
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRange;JJ)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJ)},
+#endif
+#endif
+#if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSRect_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;II)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSRect_2II)},
+#else
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;JJ)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJ)},
+#endif
+#endif
+#if (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSSize_2II) && !defined(JNI64)) || (!defined(NO_memmove__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;II)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSSize_2II)},
+#else
+	{(char *)"memmove", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;JJ)V", (void *)OS_NATIVE(memmove__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJ)},
+#endif
+#endif
+#ifndef NO_method_1setImplementation
+#ifndef JNI64
+	{(char *)"method_setImplementation", (char *)"(II)I", (void *)OS_NATIVE(method_1setImplementation)},
+#else
+	{(char *)"method_setImplementation", (char *)"(JJ)J", (void *)OS_NATIVE(method_1setImplementation)},
+#endif
+#endif
+#ifndef NO_objc_1allocateClassPair
+#ifndef JNI64
+	{(char *)"objc_allocateClassPair", (char *)"(ILjava/lang/String;I)I", (void *)OS_NATIVE(objc_1allocateClassPair)},
+#else
+	{(char *)"objc_allocateClassPair", (char *)"(JLjava/lang/String;J)J", (void *)OS_NATIVE(objc_1allocateClassPair)},
+#endif
+#endif
+#ifndef NO_objc_1disposeClassPair
+#ifndef JNI64
+	{(char *)"objc_disposeClassPair", (char *)"(I)V", (void *)OS_NATIVE(objc_1disposeClassPair)},
+#else
+	{(char *)"objc_disposeClassPair", (char *)"(J)V", (void *)OS_NATIVE(objc_1disposeClassPair)},
+#endif
+#endif
+#ifndef NO_objc_1getClass
+#ifndef JNI64
+	{(char *)"objc_getClass", (char *)"(Ljava/lang/String;)I", (void *)OS_NATIVE(objc_1getClass)},
+#else
+	{(char *)"objc_getClass", (char *)"(Ljava/lang/String;)J", (void *)OS_NATIVE(objc_1getClass)},
+#endif
+#endif
+#ifndef NO_objc_1getMetaClass
+#ifndef JNI64
+	{(char *)"objc_getMetaClass", (char *)"(Ljava/lang/String;)I", (void *)OS_NATIVE(objc_1getMetaClass)},
+#else
+	{(char *)"objc_getMetaClass", (char *)"(Ljava/lang/String;)J", (void *)OS_NATIVE(objc_1getMetaClass)},
+#endif
+#endif
+#ifndef NO_objc_1getProtocol
+#ifndef JNI64
+	{(char *)"objc_getProtocol", (char *)"(Ljava/lang/String;)I", (void *)OS_NATIVE(objc_1getProtocol)},
+#else
+	{(char *)"objc_getProtocol", (char *)"(Ljava/lang/String;)J", (void *)OS_NATIVE(objc_1getProtocol)},
+#endif
+#endif
+#ifndef NO_objc_1lookUpClass
+#ifndef JNI64
+	{(char *)"objc_lookUpClass", (char *)"(Ljava/lang/String;)I", (void *)OS_NATIVE(objc_1lookUpClass)},
+#else
+	{(char *)"objc_lookUpClass", (char *)"(Ljava/lang/String;)J", (void *)OS_NATIVE(objc_1lookUpClass)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(II)I", (void *)OS_NATIVE(objc_1msgSend__II)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJ)J", (void *)OS_NATIVE(objc_1msgSend__JJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IID) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJD) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IID)I", (void *)OS_NATIVE(objc_1msgSend__IID)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJD)J", (void *)OS_NATIVE(objc_1msgSend__JJD)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIDIIIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJDJJJZ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIDIIIZ)I", (void *)OS_NATIVE(objc_1msgSend__IIDIIIZ)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJDJJJZ)J", (void *)OS_NATIVE(objc_1msgSend__JJDJJJZ)},
+#endif
+#endif
+#ifndef NO_objc_1msgSend__IIF
+	{(char *)"objc_msgSend", (char *)"(IIF)I", (void *)OS_NATIVE(objc_1msgSend__IIF)},
+#endif
+#if (!defined(NO_objc_1msgSend__IIFF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJDD) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIFF)I", (void *)OS_NATIVE(objc_1msgSend__IIFF)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJDD)J", (void *)OS_NATIVE(objc_1msgSend__JJDD)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIFFFF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJDDDD) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIFFFF)I", (void *)OS_NATIVE(objc_1msgSend__IIFFFF)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJDDDD)J", (void *)OS_NATIVE(objc_1msgSend__JJDDDD)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIFI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJDJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIFI)I", (void *)OS_NATIVE(objc_1msgSend__IIFI)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJDJ)J", (void *)OS_NATIVE(objc_1msgSend__JJDJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(III)I", (void *)OS_NATIVE(objc_1msgSend__III)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJ)J", (void *)OS_NATIVE(objc_1msgSend__JJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIIF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJD) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIIF)I", (void *)OS_NATIVE(objc_1msgSend__IIIF)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJD)J", (void *)OS_NATIVE(objc_1msgSend__JJJD)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIII)I", (void *)OS_NATIVE(objc_1msgSend__IIII)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJJ)J", (void *)OS_NATIVE(objc_1msgSend__JJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIIIDI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJDJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIIIDI)I", (void *)OS_NATIVE(objc_1msgSend__IIIIDI)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJJDJ)J", (void *)OS_NATIVE(objc_1msgSend__JJJJDJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIIII)I", (void *)OS_NATIVE(objc_1msgSend__IIIII)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJJJ)J", (void *)OS_NATIVE(objc_1msgSend__JJJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIIIIF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJD) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIIIIF)I", (void *)OS_NATIVE(objc_1msgSend__IIIIIF)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJJJD)J", (void *)OS_NATIVE(objc_1msgSend__JJJJJD)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIIIII)I", (void *)OS_NATIVE(objc_1msgSend__IIIIII)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJJJJ)J", (void *)OS_NATIVE(objc_1msgSend__JJJJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIIIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIIIIII)I", (void *)OS_NATIVE(objc_1msgSend__IIIIIII)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJJJJJ)J", (void *)OS_NATIVE(objc_1msgSend__JJJJJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIIIIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIIIIIII)I", (void *)OS_NATIVE(objc_1msgSend__IIIIIIII)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJJJJJJ)J", (void *)OS_NATIVE(objc_1msgSend__JJJJJJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIIIIIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJJJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIIIIIIII)I", (void *)OS_NATIVE(objc_1msgSend__IIIIIIIII)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJJJJJJJ)J", (void *)OS_NATIVE(objc_1msgSend__JJJJJJJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIIIIIIZZIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJJJZZJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIIIIIIZZIII)I", (void *)OS_NATIVE(objc_1msgSend__IIIIIIIZZIII)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJJJJJZZJJJ)J", (void *)OS_NATIVE(objc_1msgSend__JJJJJJJZZJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIIIIIIZZIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJJJZZJJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIIIIIIZZIIII)I", (void *)OS_NATIVE(objc_1msgSend__IIIIIIIZZIIII)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJJJJJZZJJJJ)J", (void *)OS_NATIVE(objc_1msgSend__JJJJJJJZZJJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIIIIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJJZ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIIIIZ)I", (void *)OS_NATIVE(objc_1msgSend__IIIIIZ)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJJJZ)J", (void *)OS_NATIVE(objc_1msgSend__JJJJJZ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIIILorg_eclipse_swt_internal_cocoa_NSRange_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJLorg_eclipse_swt_internal_cocoa_NSRange_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIIILorg/eclipse/swt/internal/cocoa/NSRange;)I", (void *)OS_NATIVE(objc_1msgSend__IIIILorg_eclipse_swt_internal_cocoa_NSRange_2)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJJLorg/eclipse/swt/internal/cocoa/NSRange;)J", (void *)OS_NATIVE(objc_1msgSend__JJJJLorg_eclipse_swt_internal_cocoa_NSRange_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIIIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJJZ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIIIZ)I", (void *)OS_NATIVE(objc_1msgSend__IIIIZ)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJJZ)J", (void *)OS_NATIVE(objc_1msgSend__JJJJZ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIILorg/eclipse/swt/internal/cocoa/NSPoint;)I", (void *)OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJLorg/eclipse/swt/internal/cocoa/NSPoint;)J", (void *)OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIILorg/eclipse/swt/internal/cocoa/NSPoint;I)I", (void *)OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2I)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJLorg/eclipse/swt/internal/cocoa/NSPoint;J)J", (void *)OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2IDIIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2JDJJJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIILorg/eclipse/swt/internal/cocoa/NSPoint;IDIIIII)I", (void *)OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2IDIIIII)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJLorg/eclipse/swt/internal/cocoa/NSPoint;JDJJJJJ)J", (void *)OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2JDJJJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2IDIISII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2JDJJSJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIILorg/eclipse/swt/internal/cocoa/NSPoint;IDIISII)I", (void *)OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2IDIISII)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJLorg/eclipse/swt/internal/cocoa/NSPoint;JDJJSJJ)J", (void *)OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2JDJJSJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSSize_2IIIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSSize_2JJJZ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIILorg/eclipse/swt/internal/cocoa/NSPoint;Lorg/eclipse/swt/internal/cocoa/NSSize;IIIZ)I", (void *)OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSSize_2IIIZ)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJLorg/eclipse/swt/internal/cocoa/NSPoint;Lorg/eclipse/swt/internal/cocoa/NSSize;JJJZ)J", (void *)OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSSize_2JJJZ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSRange_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSRange_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIILorg/eclipse/swt/internal/cocoa/NSRange;)I", (void *)OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSRange_2)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJLorg/eclipse/swt/internal/cocoa/NSRange;)J", (void *)OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSRange_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIILorg/eclipse/swt/internal/cocoa/NSRect;I)I", (void *)OS_NATIVE(objc_1msgSend__IIILorg_eclipse_swt_internal_cocoa_NSRect_2I)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJLorg/eclipse/swt/internal/cocoa/NSRect;J)J", (void *)OS_NATIVE(objc_1msgSend__JJJLorg_eclipse_swt_internal_cocoa_NSRect_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJJZ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIIZ)I", (void *)OS_NATIVE(objc_1msgSend__IIIZ)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJJZ)J", (void *)OS_NATIVE(objc_1msgSend__JJJZ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSAffineTransformStruct;)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSAffineTransformStruct;)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSPoint;)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSPoint;)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2FFF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2DDD) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSPoint;FFF)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2FFF)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSPoint;DDD)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2DDD)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2FFFZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2DDDZ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSPoint;FFFZ)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2FFFZ)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSPoint;DDDZ)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2DDDZ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSPoint;I)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2I)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSPoint;J)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2I_3F) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J_3D) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSPoint;I[F)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2I_3F)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSPoint;J[D)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J_3D)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSPoint;Lorg/eclipse/swt/internal/cocoa/NSPoint;I)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2I)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSPoint;Lorg/eclipse/swt/internal/cocoa/NSPoint;J)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSPoint;Lorg/eclipse/swt/internal/cocoa/NSPoint;Lorg/eclipse/swt/internal/cocoa/NSPoint;)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSPoint;Lorg/eclipse/swt/internal/cocoa/NSPoint;Lorg/eclipse/swt/internal/cocoa/NSPoint;)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2IF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2JD) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSPoint;Lorg/eclipse/swt/internal/cocoa/NSRect;IF)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2IF)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSPoint;Lorg/eclipse/swt/internal/cocoa/NSRect;JD)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2JD)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRange;)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRange;)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRange;I)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2I)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRange;J)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2IIII_3B) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2JJJJ_3B) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRange;IIII[B)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2IIII_3B)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRange;JJJJ[B)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2JJJJ_3B)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRange;Lorg/eclipse/swt/internal/cocoa/NSPoint;)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRange;Lorg/eclipse/swt/internal/cocoa/NSPoint;)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRange_2I_3I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRange_2J_3J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRange;Lorg/eclipse/swt/internal/cocoa/NSRange;I[I)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRange_2I_3I)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRange;Lorg/eclipse/swt/internal/cocoa/NSRange;J[J)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRange_2J_3J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRect;)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRect;)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2F) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2D) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRect;F)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2F)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRect;D)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2D)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2FF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2DD) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRect;FF)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2FF)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRect;DD)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2DD)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRect;I)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2I)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRect;J)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRect;II)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2II)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRect;JJ)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRect;III)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2III)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRect;JJJ)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2IIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJZ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRect;IIZ)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2IIZ)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRect;JJZ)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJZ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2IIZI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJZJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRect;IIZI)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2IIZI)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRect;JJZJ)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JJZJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2IZI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JZJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRect;IZI)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2IZI)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRect;JZJ)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2JZJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/NSPoint;)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/NSPoint;)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/NSRange;Lorg/eclipse/swt/internal/cocoa/NSRect;)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/NSRange;Lorg/eclipse/swt/internal/cocoa/NSRect;)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRange_2Lorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRect_2IF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRect_2JD) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/NSRect;IF)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRect_2IF)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/NSRect;JD)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_NSRect_2JD)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Z) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Z) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRect;Z)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2Z)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRect;Z)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2Z)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2ZZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2ZZ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRect;ZZ)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSRect_2ZZ)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRect;ZZ)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSRect_2ZZ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSSize_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSSize_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSSize;)I", (void *)OS_NATIVE(objc_1msgSend__IILorg_eclipse_swt_internal_cocoa_NSSize_2)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSSize;)J", (void *)OS_NATIVE(objc_1msgSend__JJLorg_eclipse_swt_internal_cocoa_NSSize_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJZ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIZ)I", (void *)OS_NATIVE(objc_1msgSend__IIZ)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJZ)J", (void *)OS_NATIVE(objc_1msgSend__JJZ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIZI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJZJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIZI)I", (void *)OS_NATIVE(objc_1msgSend__IIZI)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJZJ)J", (void *)OS_NATIVE(objc_1msgSend__JJZJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__IIZLorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJZLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(IIZLorg/eclipse/swt/internal/cocoa/NSRect;)I", (void *)OS_NATIVE(objc_1msgSend__IIZLorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJZLorg/eclipse/swt/internal/cocoa/NSRect;)J", (void *)OS_NATIVE(objc_1msgSend__JJZLorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__II_3B) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3B) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(II[B)I", (void *)OS_NATIVE(objc_1msgSend__II_3B)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJ[B)J", (void *)OS_NATIVE(objc_1msgSend__JJ_3B)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__II_3BI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3BJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(II[BI)I", (void *)OS_NATIVE(objc_1msgSend__II_3BI)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJ[BJ)J", (void *)OS_NATIVE(objc_1msgSend__JJ_3BJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__II_3C) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3C) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(II[C)I", (void *)OS_NATIVE(objc_1msgSend__II_3C)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJ[C)J", (void *)OS_NATIVE(objc_1msgSend__JJ_3C)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__II_3CI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3CJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(II[CI)I", (void *)OS_NATIVE(objc_1msgSend__II_3CI)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJ[CJ)J", (void *)OS_NATIVE(objc_1msgSend__JJ_3CJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__II_3CLorg_eclipse_swt_internal_cocoa_NSRange_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3CLorg_eclipse_swt_internal_cocoa_NSRange_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(II[CLorg/eclipse/swt/internal/cocoa/NSRange;)I", (void *)OS_NATIVE(objc_1msgSend__II_3CLorg_eclipse_swt_internal_cocoa_NSRange_2)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJ[CLorg/eclipse/swt/internal/cocoa/NSRange;)J", (void *)OS_NATIVE(objc_1msgSend__JJ_3CLorg_eclipse_swt_internal_cocoa_NSRange_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__II_3F) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3D) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(II[F)I", (void *)OS_NATIVE(objc_1msgSend__II_3F)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJ[D)J", (void *)OS_NATIVE(objc_1msgSend__JJ_3D)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__II_3FIF) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3DJD) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(II[FIF)I", (void *)OS_NATIVE(objc_1msgSend__II_3FIF)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJ[DJD)J", (void *)OS_NATIVE(objc_1msgSend__JJ_3DJD)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__II_3I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(II[I)I", (void *)OS_NATIVE(objc_1msgSend__II_3I)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJ[J)J", (void *)OS_NATIVE(objc_1msgSend__JJ_3J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__II_3II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3II) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(II[II)I", (void *)OS_NATIVE(objc_1msgSend__II_3II)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJ[II)J", (void *)OS_NATIVE(objc_1msgSend__JJ_3II)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend__II_3III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend__JJ_3JII) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend", (char *)"(II[III)I", (void *)OS_NATIVE(objc_1msgSend__II_3III)},
+#else
+	{(char *)"objc_msgSend", (char *)"(JJ[JII)J", (void *)OS_NATIVE(objc_1msgSend__JJ_3JII)},
+#endif
+#endif
+#ifndef NO_objc_1msgSend__JJI
+	{(char *)"objc_msgSend", (char *)"(JJI)J", (void *)OS_NATIVE(objc_1msgSend__JJI)},
+#endif
+#ifndef NO_objc_1msgSend__JJ_3I
+	{(char *)"objc_msgSend", (char *)"(JJ[I)J", (void *)OS_NATIVE(objc_1msgSend__JJ_3I)},
+#endif
+#ifndef NO_objc_1msgSend__JJ_3JJJ
+	{(char *)"objc_msgSend", (char *)"(JJ[JJJ)J", (void *)OS_NATIVE(objc_1msgSend__JJ_3JJJ)},
+#endif
+#if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;I)I", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2I)},
+#else
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;J)J", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;II)I", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2II)},
+#else
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JJ)J", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2III) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;III)I", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2III)},
+#else
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JJJ)J", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;IIIII)I", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IIIII)},
+#else
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JJJJJ)J", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IIIIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJJJZ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;IIIIZ)I", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IIIIZ)},
+#else
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JJJJZ)J", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJJJZ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;IILorg/eclipse/swt/internal/cocoa/NSPoint;)I", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#else
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JJLorg/eclipse/swt/internal/cocoa/NSPoint;)J", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;IILorg/eclipse/swt/internal/cocoa/NSPoint;I)I", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2I)},
+#else
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JJLorg/eclipse/swt/internal/cocoa/NSPoint;J)J", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;IILorg/eclipse/swt/internal/cocoa/NSRect;I)I", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSRect_2I)},
+#else
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JJLorg/eclipse/swt/internal/cocoa/NSRect;J)J", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJZ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;IIZ)I", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IIZ)},
+#else
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JJZ)J", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJZ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;ILorg/eclipse/swt/internal/cocoa/NSPoint;)I", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#else
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JLorg/eclipse/swt/internal/cocoa/NSPoint;)J", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;ILorg/eclipse/swt/internal/cocoa/NSRect;)I", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#else
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JLorg/eclipse/swt/internal/cocoa/NSRect;)J", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;ILorg/eclipse/swt/internal/cocoa/NSRect;I)I", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2I)},
+#else
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JLorg/eclipse/swt/internal/cocoa/NSRect;J)J", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSSize_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSSize_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;ILorg/eclipse/swt/internal/cocoa/NSSize;)I", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSSize_2)},
+#else
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JLorg/eclipse/swt/internal/cocoa/NSSize;)J", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSSize_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JZ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;IZ)I", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IZ)},
+#else
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JZ)J", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JZ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IZLorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JZLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;IZLorg/eclipse/swt/internal/cocoa/NSRect;)I", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IZLorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#else
+	{(char *)"objc_msgSendSuper", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JZLorg/eclipse/swt/internal/cocoa/NSRect;)J", (void *)OS_NATIVE(objc_1msgSendSuper__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JZLorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper_bool", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;IILorg/eclipse/swt/internal/cocoa/NSPoint;)Z", (void *)OS_NATIVE(objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#else
+	{(char *)"objc_msgSendSuper_bool", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JJLorg/eclipse/swt/internal/cocoa/NSPoint;)Z", (void *)OS_NATIVE(objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRange_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRange_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper_bool", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;ILorg/eclipse/swt/internal/cocoa/NSRange;I)Z", (void *)OS_NATIVE(objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRange_2I)},
+#else
+	{(char *)"objc_msgSendSuper_bool", (char *)"(Lorg/eclipse/swt/internal/cocoa/objc_super;JLorg/eclipse/swt/internal/cocoa/NSRange;J)Z", (void *)OS_NATIVE(objc_1msgSendSuper_1bool__Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRange_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/objc_super;II)V", (void *)OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2II)},
+#else
+	{(char *)"objc_msgSendSuper_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/objc_super;JJ)V", (void *)OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/objc_super;IILorg/eclipse/swt/internal/cocoa/NSRect;I)V", (void *)OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2IILorg_eclipse_swt_internal_cocoa_NSRect_2I)},
+#else
+	{(char *)"objc_msgSendSuper_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/objc_super;JJLorg/eclipse/swt/internal/cocoa/NSRect;J)V", (void *)OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/objc_super;ILorg/eclipse/swt/internal/cocoa/NSRect;)V", (void *)OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#else
+	{(char *)"objc_msgSendSuper_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/objc_super;JLorg/eclipse/swt/internal/cocoa/NSRect;)V", (void *)OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/objc_super;ILorg/eclipse/swt/internal/cocoa/NSRect;I)V", (void *)OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2I)},
+#else
+	{(char *)"objc_msgSendSuper_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;Lorg/eclipse/swt/internal/cocoa/objc_super;JLorg/eclipse/swt/internal/cocoa/NSRect;J)V", (void *)OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;Lorg/eclipse/swt/internal/cocoa/objc_super;I)V", (void *)OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2I)},
+#else
+	{(char *)"objc_msgSendSuper_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;Lorg/eclipse/swt/internal/cocoa/objc_super;J)V", (void *)OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;Lorg/eclipse/swt/internal/cocoa/objc_super;ILorg/eclipse/swt/internal/cocoa/NSRect;)V", (void *)OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2ILorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#else
+	{(char *)"objc_msgSendSuper_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;Lorg/eclipse/swt/internal/cocoa/objc_super;JLorg/eclipse/swt/internal/cocoa/NSRect;)V", (void *)OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JLorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2IZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JZ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSendSuper_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;Lorg/eclipse/swt/internal/cocoa/objc_super;IZ)V", (void *)OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2IZ)},
+#else
+	{(char *)"objc_msgSendSuper_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;Lorg/eclipse/swt/internal/cocoa/objc_super;JZ)V", (void *)OS_NATIVE(objc_1msgSendSuper_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2Lorg_eclipse_swt_internal_cocoa_objc_1super_2JZ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1bool__II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_bool", (char *)"(II)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__II)},
+#else
+	{(char *)"objc_msgSend_bool", (char *)"(JJ)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__JJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1bool__III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_bool", (char *)"(III)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__III)},
+#else
+	{(char *)"objc_msgSend_bool", (char *)"(JJJ)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__JJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1bool__IIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_bool", (char *)"(IIII)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__IIII)},
+#else
+	{(char *)"objc_msgSend_bool", (char *)"(JJJJ)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__JJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1bool__IIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_bool", (char *)"(IIIII)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__IIIII)},
+#else
+	{(char *)"objc_msgSend_bool", (char *)"(JJJJJ)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__JJJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1bool__IIIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJJJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_bool", (char *)"(IIIIII)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__IIIIII)},
+#else
+	{(char *)"objc_msgSend_bool", (char *)"(JJJJJJ)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__JJJJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1bool__IIIIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJJJJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_bool", (char *)"(IIIIIII)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__IIIIIII)},
+#else
+	{(char *)"objc_msgSend_bool", (char *)"(JJJJJJJ)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__JJJJJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1bool__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_bool", (char *)"(IIILorg/eclipse/swt/internal/cocoa/NSPoint;)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__IIILorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#else
+	{(char *)"objc_msgSend_bool", (char *)"(JJJLorg/eclipse/swt/internal/cocoa/NSPoint;)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__JJJLorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1bool__IIILorg_eclipse_swt_internal_cocoa_NSSize_2Z) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJJLorg_eclipse_swt_internal_cocoa_NSSize_2Z) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_bool", (char *)"(IIILorg/eclipse/swt/internal/cocoa/NSSize;Z)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__IIILorg_eclipse_swt_internal_cocoa_NSSize_2Z)},
+#else
+	{(char *)"objc_msgSend_bool", (char *)"(JJJLorg/eclipse/swt/internal/cocoa/NSSize;Z)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__JJJLorg_eclipse_swt_internal_cocoa_NSSize_2Z)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_bool", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSPoint;)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#else
+	{(char *)"objc_msgSend_bool", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSPoint;)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_bool", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSPoint;Lorg/eclipse/swt/internal/cocoa/NSRect;)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#else
+	{(char *)"objc_msgSend_bool", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSPoint;Lorg/eclipse/swt/internal/cocoa/NSRect;)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSPoint_2Lorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSRange_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSRange_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_bool", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRange;I)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSRange_2I)},
+#else
+	{(char *)"objc_msgSend_bool", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRange;J)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSRange_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_bool", (char *)"(IILorg/eclipse/swt/internal/cocoa/NSRect;)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__IILorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#else
+	{(char *)"objc_msgSend_bool", (char *)"(JJLorg/eclipse/swt/internal/cocoa/NSRect;)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__JJLorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1bool__IIS) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1bool__JJS) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_bool", (char *)"(IIS)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__IIS)},
+#else
+	{(char *)"objc_msgSend_bool", (char *)"(JJS)Z", (void *)OS_NATIVE(objc_1msgSend_1bool__JJS)},
+#endif
+#endif
+#ifndef NO_objc_1msgSend_1floatret
+#ifndef JNI64
+	{(char *)"objc_msgSend_floatret", (char *)"(II)F", (void *)OS_NATIVE(objc_1msgSend_1floatret)},
+#else
+	{(char *)"objc_msgSend_floatret", (char *)"(JJ)F", (void *)OS_NATIVE(objc_1msgSend_1floatret)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1fpret__II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1fpret__JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_fpret", (char *)"(II)D", (void *)OS_NATIVE(objc_1msgSend_1fpret__II)},
+#else
+	{(char *)"objc_msgSend_fpret", (char *)"(JJ)D", (void *)OS_NATIVE(objc_1msgSend_1fpret__JJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1fpret__III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1fpret__JJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_fpret", (char *)"(III)D", (void *)OS_NATIVE(objc_1msgSend_1fpret__III)},
+#else
+	{(char *)"objc_msgSend_fpret", (char *)"(JJJ)D", (void *)OS_NATIVE(objc_1msgSend_1fpret__JJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1fpret__IIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1fpret__JJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_fpret", (char *)"(IIII)D", (void *)OS_NATIVE(objc_1msgSend_1fpret__IIII)},
+#else
+	{(char *)"objc_msgSend_fpret", (char *)"(JJJJ)D", (void *)OS_NATIVE(objc_1msgSend_1fpret__JJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSAffineTransformStruct;II)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2II)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSAffineTransformStruct;JJ)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSAffineTransformStruct_2JJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSPoint;II)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2II)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSPoint;JJ)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSPoint;III)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2III)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSPoint;JJJ)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSPoint;IILorg/eclipse/swt/internal/cocoa/NSPoint;)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSPoint;JJLorg/eclipse/swt/internal/cocoa/NSPoint;)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSPoint;IILorg/eclipse/swt/internal/cocoa/NSPoint;I)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2IILorg_eclipse_swt_internal_cocoa_NSPoint_2I)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSPoint;JJLorg/eclipse/swt/internal/cocoa/NSPoint;J)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSPoint_2JJLorg_eclipse_swt_internal_cocoa_NSPoint_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRange;II)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2II)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRange;JJ)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRange;III)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2III)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRange;JJJ)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2IILorg_eclipse_swt_internal_cocoa_NSRange_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJLorg_eclipse_swt_internal_cocoa_NSRange_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRange;IILorg/eclipse/swt/internal/cocoa/NSRange;I)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2IILorg_eclipse_swt_internal_cocoa_NSRange_2I)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRange;JJLorg/eclipse/swt/internal/cocoa/NSRange;J)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJLorg_eclipse_swt_internal_cocoa_NSRange_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2IILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRange;IILorg/eclipse/swt/internal/cocoa/NSRect;)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2IILorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRange;JJLorg/eclipse/swt/internal/cocoa/NSRect;)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRange_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;II)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2II)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;JJ)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2III) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;III)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2III)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;JJJ)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;IIII)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IIII)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;JJJJ)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IIIIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJJZ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;IIIIZ)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IIIIZ)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;JJJJZ)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJJZ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IIILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;IIILorg/eclipse/swt/internal/cocoa/NSRect;I)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IIILorg_eclipse_swt_internal_cocoa_NSRect_2I)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;JJJLorg/eclipse/swt/internal/cocoa/NSRect;J)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJJLorg_eclipse_swt_internal_cocoa_NSRect_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSRange_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSRange_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;IILorg/eclipse/swt/internal/cocoa/NSRange;I)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSRange_2I)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;JJLorg/eclipse/swt/internal/cocoa/NSRange;J)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSRange_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;IILorg/eclipse/swt/internal/cocoa/NSRect;)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;JJLorg/eclipse/swt/internal/cocoa/NSRect;)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSRect_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;IILorg/eclipse/swt/internal/cocoa/NSRect;I)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSRect_2I)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;JJLorg/eclipse/swt/internal/cocoa/NSRect;J)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSSize_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;IILorg/eclipse/swt/internal/cocoa/NSSize;I)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2IILorg_eclipse_swt_internal_cocoa_NSSize_2I)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSRect;JJLorg/eclipse/swt/internal/cocoa/NSSize;J)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSRect_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2II) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;II)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2II)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;JJ)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSRect_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;IILorg/eclipse/swt/internal/cocoa/NSRect;)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;JJLorg/eclipse/swt/internal/cocoa/NSRect;)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSRect_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;IILorg/eclipse/swt/internal/cocoa/NSSize;)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;JJLorg/eclipse/swt/internal/cocoa/NSSize;)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2I) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;IILorg/eclipse/swt/internal/cocoa/NSSize;I)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2I)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;JJLorg/eclipse/swt/internal/cocoa/NSSize;J)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2J)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2IIIII) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2JJJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;IILorg/eclipse/swt/internal/cocoa/NSSize;IIIII)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2IIIII)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;JJLorg/eclipse/swt/internal/cocoa/NSSize;JJJJJ)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2JJJJJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2ZZI) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2ZZJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;IILorg/eclipse/swt/internal/cocoa/NSSize;ZZI)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IILorg_eclipse_swt_internal_cocoa_NSSize_2ZZI)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;JJLorg/eclipse/swt/internal/cocoa/NSSize;ZZJ)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJLorg_eclipse_swt_internal_cocoa_NSSize_2ZZJ)},
+#endif
+#endif
+#if (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IIZ) && !defined(JNI64)) || (!defined(NO_objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJZ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;IIZ)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2IIZ)},
+#else
+	{(char *)"objc_msgSend_stret", (char *)"(Lorg/eclipse/swt/internal/cocoa/NSSize;JJZ)V", (void *)OS_NATIVE(objc_1msgSend_1stret__Lorg_eclipse_swt_internal_cocoa_NSSize_2JJZ)},
+#endif
+#endif
+#ifndef NO_objc_1registerClassPair
+#ifndef JNI64
+	{(char *)"objc_registerClassPair", (char *)"(I)V", (void *)OS_NATIVE(objc_1registerClassPair)},
+#else
+	{(char *)"objc_registerClassPair", (char *)"(J)V", (void *)OS_NATIVE(objc_1registerClassPair)},
+#endif
+#endif
+#ifndef NO_objc_1super_1sizeof
+	{(char *)"objc_super_sizeof", (char *)"()I", (void *)OS_NATIVE(objc_1super_1sizeof)},
+#endif
+#ifndef NO_object_1getClass
+#ifndef JNI64
+	{(char *)"object_getClass", (char *)"(I)I", (void *)OS_NATIVE(object_1getClass)},
+#else
+	{(char *)"object_getClass", (char *)"(J)J", (void *)OS_NATIVE(object_1getClass)},
+#endif
+#endif
+#ifndef NO_object_1getClassName
+#ifndef JNI64
+	{(char *)"object_getClassName", (char *)"(I)I", (void *)OS_NATIVE(object_1getClassName)},
+#else
+	{(char *)"object_getClassName", (char *)"(J)J", (void *)OS_NATIVE(object_1getClassName)},
+#endif
+#endif
+#ifndef NO_object_1getInstanceVariable
+#ifndef JNI64
+	{(char *)"object_getInstanceVariable", (char *)"(I[B[I)I", (void *)OS_NATIVE(object_1getInstanceVariable)},
+#else
+	{(char *)"object_getInstanceVariable", (char *)"(J[B[J)J", (void *)OS_NATIVE(object_1getInstanceVariable)},
+#endif
+#endif
+#ifndef NO_object_1setClass
+#ifndef JNI64
+	{(char *)"object_setClass", (char *)"(II)I", (void *)OS_NATIVE(object_1setClass)},
+#else
+	{(char *)"object_setClass", (char *)"(JJ)J", (void *)OS_NATIVE(object_1setClass)},
+#endif
+#endif
+#ifndef NO_object_1setInstanceVariable
+#ifndef JNI64
+	{(char *)"object_setInstanceVariable", (char *)"(I[BI)I", (void *)OS_NATIVE(object_1setInstanceVariable)},
+#else
+	{(char *)"object_setInstanceVariable", (char *)"(J[BJ)J", (void *)OS_NATIVE(object_1setInstanceVariable)},
+#endif
+#endif
+#ifndef NO_sel_1getName
+#ifndef JNI64
+	{(char *)"sel_getName", (char *)"(I)I", (void *)OS_NATIVE(sel_1getName)},
+#else
+	{(char *)"sel_getName", (char *)"(J)J", (void *)OS_NATIVE(sel_1getName)},
+#endif
+#endif
+#ifndef NO_sel_1registerName
+#ifndef JNI64
+	{(char *)"sel_registerName", (char *)"(Ljava/lang/String;)I", (void *)OS_NATIVE(sel_1registerName)},
+#else
+	{(char *)"sel_registerName", (char *)"(Ljava/lang/String;)J", (void *)OS_NATIVE(sel_1registerName)},
+#endif
+#endif
+	{NULL, NULL, NULL}
+};
+JNIEXPORT SWT_NATIVE_CLASS OS_nativeClasses[] = {
+	{"org/eclipse/swt/internal/cocoa/OS", OS_nativeMethods},
+	{NULL, NULL}
+};
+#endif
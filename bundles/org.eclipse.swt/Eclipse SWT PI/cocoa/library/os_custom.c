@@ -12,6 +12,7 @@
 #include "swt.h"
 #include "os_structs.h"
 #include "os_stats.h"
+#include <pthread.h>
 
 #define OS_NATIVE(func) Java_org_eclipse_swt_internal_cocoa_OS_##func
 
@@ -238,3 +239,495 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(NSAccessibilityRowIndexRangeAttribute)
 }
 #endif
 
+
+/*
+* Typed message sends.  The implementation of each (class, selector) pair
+* is looked up once and cached, and then called through a prototype with
+* the real argument and return types, so the compiler picks the struct
+* return convention.  NSRect is always returned in memory on the supported
+* architectures, so unimplemented messages that return one are forwarded
+* through objc_msgSend_stret.  Structs are passed as
+* doubles and returned in a double array instead of through the fields of
+* a Java struct.  Messages the class does not implement always go through
+* the runtime.  These are only called from the UI thread.
+*/
+#define IMP_CACHE_SIZE 256
+
+typedef struct IMPCacheEntry {
+	Class cls;
+	SEL sel;
+	IMP imp;
+} IMPCacheEntry;
+
+static IMPCacheEntry impCache[IMP_CACHE_SIZE];
+
+static IMP swt_lookupIMP(id obj, SEL sel, BOOL stret)
+{
+	Class cls = object_getClass(obj);
+	IMPCacheEntry *entry = &impCache[(((uintptr_t)cls >> 4) ^ ((uintptr_t)sel >> 2)) & (IMP_CACHE_SIZE - 1)];
+	if (entry->cls == cls && entry->sel == sel) return entry->imp;
+	if (!class_respondsToSelector(cls, sel)) return stret ? (IMP)objc_msgSend_stret : (IMP)objc_msgSend;
+	entry->cls = cls;
+	entry->sel = sel;
+	entry->imp = class_getMethodImplementation(cls, sel);
+	return entry->imp;
+}
+
+static void swt_setRect(JNIEnv *env, jfloatDoubleArray arg, NSRect rect)
+{
+	jfloatDouble values[4];
+	values[0] = rect.origin.x;
+	values[1] = rect.origin.y;
+	values[2] = rect.size.width;
+	values[3] = rect.size.height;
+	(*env)->SetFloatDoubleArrayRegion(env, arg, 0, 4, values);
+}
+
+#ifndef NO_swt_1objc_1msgSend_1getRect
+JNIEXPORT void JNICALL OS_NATIVE(swt_1objc_1msgSend_1getRect)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloatDoubleArray arg2)
+{
+	OS_NATIVE_ENTER(env, that, swt_1objc_1msgSend_1getRect_FUNC);
+	{
+		IMP imp = swt_lookupIMP((id)arg0, (SEL)arg1, YES);
+		swt_setRect(env, arg2, ((NSRect (*)(id, SEL))imp)((id)arg0, (SEL)arg1));
+	}
+	OS_NATIVE_EXIT(env, that, swt_1objc_1msgSend_1getRect_FUNC);
+}
+#endif
+
+#ifndef NO_swt_1objc_1msgSend_1setRect
+JNIEXPORT void JNICALL OS_NATIVE(swt_1objc_1msgSend_1setRect)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2, jdouble arg3, jdouble arg4, jdouble arg5)
+{
+	OS_NATIVE_ENTER(env, that, swt_1objc_1msgSend_1setRect_FUNC);
+	{
+		IMP imp = swt_lookupIMP((id)arg0, (SEL)arg1, NO);
+		((void (*)(id, SEL, NSRect))imp)((id)arg0, (SEL)arg1, NSMakeRect(arg2, arg3, arg4, arg5));
+	}
+	OS_NATIVE_EXIT(env, that, swt_1objc_1msgSend_1setRect_FUNC);
+}
+#endif
+
+#ifndef NO_swt_1objc_1msgSend_1setPoint
+JNIEXPORT void JNICALL OS_NATIVE(swt_1objc_1msgSend_1setPoint)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2, jdouble arg3)
+{
+	OS_NATIVE_ENTER(env, that, swt_1objc_1msgSend_1setPoint_FUNC);
+	{
+		IMP imp = swt_lookupIMP((id)arg0, (SEL)arg1, NO);
+		((void (*)(id, SEL, NSPoint))imp)((id)arg0, (SEL)arg1, NSMakePoint(arg2, arg3));
+	}
+	OS_NATIVE_EXIT(env, that, swt_1objc_1msgSend_1setPoint_FUNC);
+}
+#endif
+
+#ifndef NO_swt_1objc_1msgSend_1setSize
+JNIEXPORT void JNICALL OS_NATIVE(swt_1objc_1msgSend_1setSize)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2, jdouble arg3)
+{
+	OS_NATIVE_ENTER(env, that, swt_1objc_1msgSend_1setSize_FUNC);
+	{
+		IMP imp = swt_lookupIMP((id)arg0, (SEL)arg1, NO);
+		((void (*)(id, SEL, NSSize))imp)((id)arg0, (SEL)arg1, NSMakeSize(arg2, arg3));
+	}
+	OS_NATIVE_EXIT(env, that, swt_1objc_1msgSend_1setSize_FUNC);
+}
+#endif
+
+#ifndef NO_swt_1objc_1msgSend_1convertRect
+JNIEXPORT void JNICALL OS_NATIVE(swt_1objc_1msgSend_1convertRect)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2, jdouble arg3, jdouble arg4, jdouble arg5, jintLong arg6, jfloatDoubleArray arg7)
+{
+	OS_NATIVE_ENTER(env, that, swt_1objc_1msgSend_1convertRect_FUNC);
+	{
+		IMP imp = swt_lookupIMP((id)arg0, (SEL)arg1, YES);
+		NSRect rect = ((NSRect (*)(id, SEL, NSRect, id))imp)((id)arg0, (SEL)arg1, NSMakeRect(arg2, arg3, arg4, arg5), (id)arg6);
+		swt_setRect(env, arg7, rect);
+	}
+	OS_NATIVE_EXIT(env, that, swt_1objc_1msgSend_1convertRect_FUNC);
+}
+#endif
+
+#ifndef NO_swt_1objc_1msgSend_1convertPoint
+JNIEXPORT void JNICALL OS_NATIVE(swt_1objc_1msgSend_1convertPoint)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jdouble arg2, jdouble arg3, jintLong arg4, jfloatDoubleArray arg5)
+{
+	OS_NATIVE_ENTER(env, that, swt_1objc_1msgSend_1convertPoint_FUNC);
+	{
+		IMP imp = swt_lookupIMP((id)arg0, (SEL)arg1, NO);
+		NSPoint point = ((NSPoint (*)(id, SEL, NSPoint, id))imp)((id)arg0, (SEL)arg1, NSMakePoint(arg2, arg3), (id)arg4);
+		jfloatDouble values[2];
+		values[0] = point.x;
+		values[1] = point.y;
+		(*env)->SetFloatDoubleArrayRegion(env, arg5, 0, 2, values);
+	}
+	OS_NATIVE_EXIT(env, that, swt_1objc_1msgSend_1convertPoint_FUNC);
+}
+#endif
+
+/*
+* Converts the pixels of a direct 24 or 32 bit ImageData into the alpha
+* first ARGB layout of an NSBitmapImageRep, writing into the bitmap data
+* in place of going through an intermediate Java buffer.  The alpha is
+* taken from the alpha data, or the global alpha when there is none.
+*/
+#ifndef NO_swt_1ImageData_1toARGB
+JNIEXPORT void JNICALL OS_NATIVE(swt_1ImageData_1toARGB)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jbyteArray arg3, jint arg4, jint arg5, jint arg6, jint arg7, jint arg8, jbyteArray arg9, jint arg10)
+{
+	jbyte *lparg3=NULL;
+	jbyte *lparg9=NULL;
+	OS_NATIVE_ENTER(env, that, swt_1ImageData_1toARGB_FUNC);
+	if (arg3) if ((lparg3 = (*env)->GetPrimitiveArrayCritical(env, arg3, NULL)) == NULL) goto fail;
+	if (arg9) if ((lparg9 = (*env)->GetPrimitiveArrayCritical(env, arg9, NULL)) == NULL) goto fail;
+	{
+		unsigned char *dest = (unsigned char *)arg0;
+		unsigned char globalAlpha = arg10 != -1 ? (unsigned char)arg10 : 0xFF;
+		int bytesPerPixel = arg5 / 8, x, y;
+		for (y = 0; y < arg2; y++) {
+			const unsigned char *src = (const unsigned char *)lparg3 + y * arg4;
+			const unsigned char *alpha = lparg9 != NULL ? (const unsigned char *)lparg9 + y * arg1 : NULL;
+			for (x = 0; x < arg1; x++) {
+				unsigned int pixel;
+				if (bytesPerPixel == 4) {
+					pixel = (unsigned int)src[0] << 24 | (unsigned int)src[1] << 16 | (unsigned int)src[2] << 8 | src[3];
+				} else {
+					pixel = (unsigned int)src[0] << 16 | (unsigned int)src[1] << 8 | src[2];
+				}
+				dest[0] = alpha != NULL ? alpha[x] : globalAlpha;
+				dest[1] = (unsigned char)(pixel >> arg6);
+				dest[2] = (unsigned char)(pixel >> arg7);
+				dest[3] = (unsigned char)(pixel >> arg8);
+				src += bytesPerPixel;
+				dest += 4;
+			}
+		}
+	}
+fail:
+	if (arg9 && lparg9) (*env)->ReleasePrimitiveArrayCritical(env, arg9, lparg9, JNI_ABORT);
+	if (arg3 && lparg3) (*env)->ReleasePrimitiveArrayCritical(env, arg3, lparg3, JNI_ABORT);
+	OS_NATIVE_EXIT(env, that, swt_1ImageData_1toARGB_FUNC);
+}
+#endif
+
+#ifndef NO_swt_1NSApplication_1dispatchEvents
+JNIEXPORT jint JNICALL OS_NATIVE(swt_1NSApplication_1dispatchEvents)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jint arg4)
+{
+	jint rc = 0;
+	OS_NATIVE_ENTER(env, that, swt_1NSApplication_1dispatchEvents_FUNC);
+	/*
+	* Each event is dequeued and sent inside its own pool, so the event and
+	* whatever the handlers autorelease are freed before the next event.  If
+	* an exception is thrown the pool is left to the enclosing pool, which
+	* releases it when it is drained.  Dispatching stops when the queue is
+	* empty or a Java exception is pending.
+	*/
+	while (rc < arg4) {
+		NSAutoreleasePool *pool = [[NSAutoreleasePool alloc] init];
+		NSApplication *application = (NSApplication *)arg0;
+		NSEvent *event = [application nextEventMatchingMask:(NSUInteger)arg1 untilDate:(NSDate *)arg2 inMode:(NSString *)arg3 dequeue:YES];
+		if (event != nil) [application sendEvent:event];
+		[pool release];
+		if (event == nil) break;
+		rc++;
+		if ((*env)->ExceptionCheck(env)) break;
+	}
+	OS_NATIVE_EXIT(env, that, swt_1NSApplication_1dispatchEvents_FUNC);
+	return rc;
+}
+#endif
+
+/*
+* Answers the number of line fragments laid out by the layout manager and
+* stores the used rectangle and first glyph of as many as fit in the
+* arrays, as x, y, width and height in rects.
+*/
+#ifndef NO_swt_1NSLayoutManager_1getLineFragments
+JNIEXPORT jint JNICALL OS_NATIVE(swt_1NSLayoutManager_1getLineFragments)
+	(JNIEnv *env, jclass that, jintLong arg0, jfloatDoubleArray arg1, jintArray arg2)
+{
+	jfloatDouble *lparg1=NULL;
+	jint *lparg2=NULL;
+	jint rc = 0, capacity = 0;
+	OS_NATIVE_ENTER(env, that, swt_1NSLayoutManager_1getLineFragments_FUNC);
+	if (arg1) if ((lparg1 = (*env)->GetFloatDoubleArrayElements(env, arg1, NULL)) == NULL) goto fail;
+	if (arg2) if ((lparg2 = (*env)->GetIntArrayElements(env, arg2, NULL)) == NULL) goto fail;
+	if (arg1 && arg2) {
+		capacity = (*env)->GetArrayLength(env, arg1) / 4;
+		if ((*env)->GetArrayLength(env, arg2) < capacity) capacity = (*env)->GetArrayLength(env, arg2);
+	}
+	{
+		NSLayoutManager *layoutManager = (NSLayoutManager *)arg0;
+		NSUInteger numberOfGlyphs = [layoutManager numberOfGlyphs], index = 0;
+		while (index < numberOfGlyphs) {
+			NSRange range = {0, 0};
+			NSRect rect = [layoutManager lineFragmentUsedRectForGlyphAtIndex:index effectiveRange:&range withoutAdditionalLayout:YES];
+			if (rc < capacity) {
+				lparg1[rc * 4] = rect.origin.x;
+				lparg1[rc * 4 + 1] = rect.origin.y;
+				lparg1[rc * 4 + 2] = rect.size.width;
+				lparg1[rc * 4 + 3] = rect.size.height;
+				lparg2[rc] = (jint)range.location;
+			}
+			rc++;
+			if (range.length == 0) break;
+			index = range.location + range.length;
+		}
+	}
+fail:
+	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, 0);
+	if (arg1 && lparg1) (*env)->ReleaseFloatDoubleArrayElements(env, arg1, lparg1, 0);
+	OS_NATIVE_EXIT(env, that, swt_1NSLayoutManager_1getLineFragments_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_swt_1NSString_1getString
+JNIEXPORT jstring JNICALL OS_NATIVE(swt_1NSString_1getString)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	jstring rc = NULL;
+	OS_NATIVE_ENTER(env, that, swt_1NSString_1getString_FUNC);
+	{
+		NSString *string = (NSString *)arg0;
+		NSUInteger length = [string length];
+		const UniChar *chars = CFStringGetCharactersPtr((CFStringRef)string);
+		if (chars != NULL) {
+			rc = (*env)->NewString(env, (const jchar *)chars, (jsize)length);
+		} else {
+			size_t mark = swtArenaMark();
+			unichar *buffer = swtArenaAlloc(length * sizeof(unichar));
+			if (buffer != NULL) {
+				[string getCharacters:buffer range:NSMakeRange(0, length)];
+				rc = (*env)->NewString(env, (const jchar *)buffer, (jsize)length);
+			}
+			swtArenaRelease(mark);
+		}
+	}
+	OS_NATIVE_EXIT(env, that, swt_1NSString_1getString_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_swt_1NSString_1initWithString
+JNIEXPORT jintLong JNICALL OS_NATIVE(swt_1NSString_1initWithString)
+	(JNIEnv *env, jclass that, jintLong arg0, jstring arg1)
+{
+	const jchar *lparg1 = NULL;
+	jsize length = 0;
+	jintLong rc = 0;
+	OS_NATIVE_ENTER(env, that, swt_1NSString_1initWithString_FUNC);
+	if (arg1) {
+		length = (*env)->GetStringLength(env, arg1);
+		if ((lparg1 = (*env)->GetStringCritical(env, arg1, NULL)) == NULL) goto fail;
+	}
+	rc = (jintLong)[(NSString *)arg0 initWithCharacters:(const unichar *)lparg1 length:(NSUInteger)length];
+fail:
+	if (arg1 && lparg1) (*env)->ReleaseStringCritical(env, arg1, lparg1);
+	OS_NATIVE_EXIT(env, that, swt_1NSString_1initWithString_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_swt_1NSString_1stringWith
+JNIEXPORT jintLong JNICALL OS_NATIVE(swt_1NSString_1stringWith)
+	(JNIEnv *env, jclass that, jstring arg0)
+{
+	const jchar *lparg0 = NULL;
+	jsize length = 0;
+	jintLong rc = 0;
+	OS_NATIVE_ENTER(env, that, swt_1NSString_1stringWith_FUNC);
+	if (arg0) {
+		length = (*env)->GetStringLength(env, arg0);
+		if ((lparg0 = (*env)->GetStringCritical(env, arg0, NULL)) == NULL) goto fail;
+	}
+	/*
+	* The characters are copied by the string, so the Java string is only
+	* pinned while it is created.
+	*/
+	rc = (jintLong)[NSString stringWithCharacters:(const unichar *)lparg0 length:(NSUInteger)length];
+fail:
+	if (arg0 && lparg0) (*env)->ReleaseStringCritical(env, arg0, lparg0);
+	OS_NATIVE_EXIT(env, that, swt_1NSString_1stringWith_FUNC);
+	return rc;
+}
+#endif
+
+/*
+* Clips the current graphics context to the rectangles of the view that are
+* being drawn, rather than their union, and answers how many there are.
+*/
+#ifndef NO_swt_1NSView_1clipToRectsBeingDrawn
+JNIEXPORT jint JNICALL OS_NATIVE(swt_1NSView_1clipToRectsBeingDrawn)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	const NSRect *rects = NULL;
+	NSInteger count = 0;
+	OS_NATIVE_ENTER(env, that, swt_1NSView_1clipToRectsBeingDrawn_FUNC);
+	[(NSView *)arg0 getRectsBeingDrawn:&rects count:&count];
+	if (count > 1) NSRectClipList(rects, count);
+	OS_NATIVE_EXIT(env, that, swt_1NSView_1clipToRectsBeingDrawn_FUNC);
+	return (jint)count;
+}
+#endif
+
+static void swt_lookupNames(JNIEnv *env, jbyteArray arg0, jint arg1, jintLongArray arg2, BOOL classes)
+{
+	jbyte *lparg0=NULL;
+	jintLong *lparg2=NULL;
+	jsize length;
+	const char *name, *end;
+	jint i;
+	if (arg0 == NULL || arg2 == NULL || (*env)->GetArrayLength(env, arg2) < arg1) return;
+	length = (*env)->GetArrayLength(env, arg0);
+	if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) goto fail;
+	if ((lparg2 = (*env)->GetIntLongArrayElements(env, arg2, NULL)) == NULL) goto fail;
+	name = (const char *)lparg0;
+	end = name + length;
+	for (i = 0; i < arg1; i++) {
+		const char *next = memchr(name, 0, end - name);
+		if (next == NULL) break;
+		lparg2[i] = classes ? (jintLong)objc_getClass(name) : (jintLong)sel_registerName(name);
+		name = next + 1;
+	}
+fail:
+	if (lparg2) (*env)->ReleaseIntLongArrayElements(env, arg2, lparg2, 0);
+	if (lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
+}
+
+#ifndef NO_swt_1objc_1getClasses
+JNIEXPORT void JNICALL OS_NATIVE(swt_1objc_1getClasses)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jintLongArray arg2)
+{
+	OS_NATIVE_ENTER(env, that, swt_1objc_1getClasses_FUNC);
+	swt_lookupNames(env, arg0, arg1, arg2, YES);
+	OS_NATIVE_EXIT(env, that, swt_1objc_1getClasses_FUNC);
+}
+#endif
+
+/*
+* Answers the Java object referenced by the SWT_OBJECT instance variable
+* of an object, or NULL when its class has no such variable.  Looking the
+* variable up by name compares the names of the instance variables of the
+* class, so the offset found for each class is cached when called from the
+* main thread, which is where the callbacks of almost every event arrive.
+*/
+#define IVAR_CACHE_SIZE 64
+
+typedef struct IvarCacheEntry {
+	Class cls;
+	ptrdiff_t offset;
+} IvarCacheEntry;
+
+static IvarCacheEntry ivarCache[IVAR_CACHE_SIZE];
+
+static ptrdiff_t swt_lookupSWTObject(Class cls)
+{
+	IvarCacheEntry *entry = NULL;
+	Ivar ivar;
+	if (pthread_main_np()) {
+		entry = &ivarCache[((uintptr_t)cls >> 4) & (IVAR_CACHE_SIZE - 1)];
+		if (entry->cls == cls) return entry->offset;
+	}
+	ivar = class_getInstanceVariable(cls, "SWT_OBJECT");
+	if (entry != NULL) {
+		entry->cls = cls;
+		entry->offset = ivar != NULL ? ivar_getOffset(ivar) : -1;
+		return entry->offset;
+	}
+	return ivar != NULL ? ivar_getOffset(ivar) : -1;
+}
+
+#ifndef NO_swt_1object_1getSWTObject
+JNIEXPORT jobject JNICALL OS_NATIVE(swt_1object_1getSWTObject)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	jobject rc = NULL;
+	OS_NATIVE_ENTER(env, that, swt_1object_1getSWTObject_FUNC);
+	{
+		ptrdiff_t offset = swt_lookupSWTObject(object_getClass((id)arg0));
+		if (offset != -1) rc = (jobject)*(jintLong *)((char *)arg0 + offset);
+	}
+	OS_NATIVE_EXIT(env, that, swt_1object_1getSWTObject_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_swt_1sel_1registerNames
+JNIEXPORT void JNICALL OS_NATIVE(swt_1sel_1registerNames)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jintLongArray arg2)
+{
+	OS_NATIVE_ENTER(env, that, swt_1sel_1registerNames_FUNC);
+	swt_lookupNames(env, arg0, arg1, arg2, NO);
+	OS_NATIVE_EXIT(env, that, swt_1sel_1registerNames_FUNC);
+}
+#endif
+
+/*
+* Wakes the run loop of the UI thread from other threads. The source is
+* signaled only by the wake that finds no wake pending, so that any number
+* of wakes before the UI thread runs again send one message to the run
+* loop. Performing the source on the UI thread clears the flag.
+*/
+typedef struct SWT_WAKE_SOURCE {
+	CFRunLoopSourceRef source;
+	CFRunLoopRef runLoop;
+	volatile int32_t pending;
+} SWT_WAKE_SOURCE;
+
+static void swt_wakePerform(void *info)
+{
+	SWT_WAKE_SOURCE *wake = (SWT_WAKE_SOURCE *)info;
+	__sync_lock_release(&wake->pending);
+}
+
+#ifndef NO_swt_1wake_1source_1new
+JNIEXPORT jintLong JNICALL OS_NATIVE(swt_1wake_1source_1new)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	SWT_WAKE_SOURCE *wake;
+	CFRunLoopSourceContext context;
+	OS_NATIVE_ENTER(env, that, swt_1wake_1source_1new_FUNC);
+	wake = (SWT_WAKE_SOURCE *)calloc(1, sizeof(SWT_WAKE_SOURCE));
+	if (wake != NULL) {
+		memset(&context, 0, sizeof(context));
+		context.info = wake;
+		context.perform = swt_wakePerform;
+		wake->runLoop = (CFRunLoopRef)CFRetain((CFRunLoopRef)arg0);
+		wake->source = CFRunLoopSourceCreate(NULL, 0, &context);
+		CFRunLoopAddSource(wake->runLoop, wake->source, kCFRunLoopCommonModes);
+	}
+	OS_NATIVE_EXIT(env, that, swt_1wake_1source_1new_FUNC);
+	return (jintLong)wake;
+}
+#endif
+
+#ifndef NO_swt_1wake_1source_1signal
+JNIEXPORT void JNICALL OS_NATIVE(swt_1wake_1source_1signal)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	SWT_WAKE_SOURCE *wake = (SWT_WAKE_SOURCE *)arg0;
+	OS_NATIVE_ENTER(env, that, swt_1wake_1source_1signal_FUNC);
+	if (__sync_lock_test_and_set(&wake->pending, 1) == 0) {
+		CFRunLoopSourceSignal(wake->source);
+		CFRunLoopWakeUp(wake->runLoop);
+	}
+	OS_NATIVE_EXIT(env, that, swt_1wake_1source_1signal_FUNC);
+}
+#endif
+
+#ifndef NO_swt_1wake_1source_1free
+JNIEXPORT void JNICALL OS_NATIVE(swt_1wake_1source_1free)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	SWT_WAKE_SOURCE *wake = (SWT_WAKE_SOURCE *)arg0;
+	OS_NATIVE_ENTER(env, that, swt_1wake_1source_1free_FUNC);
+	CFRunLoopSourceInvalidate(wake->source);
+	CFRelease(wake->source);
+	CFRelease(wake->runLoop);
+	free(wake);
+	OS_NATIVE_EXIT(env, that, swt_1wake_1source_1free_FUNC);
+}
+#endif
@@ -1288,10 +1288,32 @@ char * OS_nativeFunctionNames[] = {
 	"object_1setInstanceVariable",
 	"sel_1getName",
 	"sel_1registerName",
+	"swt_1ImageData_1toARGB",
+	"swt_1NSApplication_1dispatchEvents",
+	"swt_1NSLayoutManager_1getLineFragments",
+	"swt_1NSString_1getString",
+	"swt_1NSString_1initWithString",
+	"swt_1NSString_1stringWith",
+	"swt_1NSView_1clipToRectsBeingDrawn",
+	"swt_1objc_1getClasses",
+	"swt_1objc_1msgSend_1convertPoint",
+	"swt_1objc_1msgSend_1convertRect",
+	"swt_1objc_1msgSend_1getRect",
+	"swt_1objc_1msgSend_1setPoint",
+	"swt_1objc_1msgSend_1setRect",
+	"swt_1objc_1msgSend_1setSize",
+	"swt_1object_1getSWTObject",
+	"swt_1sel_1registerNames",
+	"swt_1wake_1source_1free",
+	"swt_1wake_1source_1new",
+	"swt_1wake_1source_1signal",
 };
 #define NATIVE_FUNCTION_COUNT sizeof(OS_nativeFunctionNames) / sizeof(char*)
 int OS_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int OS_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong OS_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT OS_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS OS_nativeStats = {OS_nativeFunctionCallCount, OS_nativeFunctionCallTime, OS_nativeFunctionEvents, 0, "OS", OS_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -1313,4 +1335,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetFunctionCallCount)
 	return OS_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(OS_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return OS_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(OS_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &OS_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(OS_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(OS_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
@@ -13,8 +13,9 @@
 extern int OS_nativeFunctionCount;
 extern int OS_nativeFunctionCallCount[];
 extern char* OS_nativeFunctionNames[];
-#define OS_NATIVE_ENTER(env, that, func) OS_nativeFunctionCallCount[func]++;
-#define OS_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS OS_nativeStats;
+#define OS_NATIVE_ENTER(env, that, func) nativeStatsEnter(&OS_nativeStats, func);
+#define OS_NATIVE_EXIT(env, that, func) nativeStatsExit(&OS_nativeStats, func);
 #else
 #ifndef OS_NATIVE_ENTER
 #define OS_NATIVE_ENTER(env, that, func) 
@@ -1298,4 +1299,23 @@ typedef enum {
 	object_1setInstanceVariable_FUNC,
 	sel_1getName_FUNC,
 	sel_1registerName_FUNC,
+	swt_1ImageData_1toARGB_FUNC,
+	swt_1NSApplication_1dispatchEvents_FUNC,
+	swt_1NSLayoutManager_1getLineFragments_FUNC,
+	swt_1NSString_1getString_FUNC,
+	swt_1NSString_1initWithString_FUNC,
+	swt_1NSString_1stringWith_FUNC,
+	swt_1NSView_1clipToRectsBeingDrawn_FUNC,
+	swt_1objc_1getClasses_FUNC,
+	swt_1objc_1msgSend_1convertPoint_FUNC,
+	swt_1objc_1msgSend_1convertRect_FUNC,
+	swt_1objc_1msgSend_1getRect_FUNC,
+	swt_1objc_1msgSend_1setPoint_FUNC,
+	swt_1objc_1msgSend_1setRect_FUNC,
+	swt_1objc_1msgSend_1setSize_FUNC,
+	swt_1object_1getSWTObject_FUNC,
+	swt_1sel_1registerNames_FUNC,
+	swt_1wake_1source_1free_FUNC,
+	swt_1wake_1source_1new_FUNC,
+	swt_1wake_1source_1signal_FUNC,
 } OS_FUNCS;
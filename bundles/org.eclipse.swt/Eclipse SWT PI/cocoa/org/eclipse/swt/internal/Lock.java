@@ -15,6 +15,17 @@ package org.eclipse.swt.internal;
  * is an empty implementation which does not actually perform locking.
  */
 public class Lock {
+	static final Lock lock = new Lock ();
+
+/**
+ * Returns the lock of the native object with the given handle.
+ *
+ * @param handle the handle of the native object
+ * @return the lock of the object
+ */
+public static Lock forObject(long /*int*/ handle) {
+	return lock;
+}
 
 /**
  * Locks the monitor and returns the lock count. If
@@ -33,4 +44,19 @@ public int lock() {
  */
 public void unlock() {
 }
+
+/**
+ * Locks the monitor for reading and returns the lock count.
+ * 
+ * @return the lock count
+ */
+public int lockRead() {
+	return 0;
+}
+
+/**
+ * Unlocks the monitor locked for reading.
+ */
+public void unlockRead() {
+}
 }
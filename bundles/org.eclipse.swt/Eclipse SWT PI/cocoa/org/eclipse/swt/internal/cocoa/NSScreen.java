@@ -38,9 +38,7 @@ public NSDictionary deviceDescription() {
 }
 
 public NSRect frame() {
-	NSRect result = new NSRect();
-	OS.objc_msgSend_stret(result, this.id, OS.sel_frame);
-	return result;
+	return OS.getRect(this.id, OS.sel_frame);
 }
 
 public static NSScreen mainScreen() {
@@ -10,8 +10,13 @@
  *******************************************************************************/
 package org.eclipse.swt.internal.cocoa;
 
+import java.util.Hashtable;
+
 public class NSString extends NSObject {
 
+	static final int INTERNED_LIMIT = 512;
+	static Hashtable interned;
+
 public NSString() {
 	super();
 }
@@ -25,21 +30,36 @@ public NSString(id id) {
 }
 
 public String getString() {
-	char[] buffer = new char[(int)/*64*/length()];
-	getCharacters(buffer);
-	return new String(buffer);
+	return OS.swt_NSString_getString(this.id);
 }
 
 public NSString initWithString(String str) {
-	char[] buffer = new char[str.length()];
-	str.getChars(0, buffer.length, buffer, 0);
-	return initWithCharacters(buffer, buffer.length);
+	long /*int*/ result = OS.swt_NSString_initWithString(this.id, str);
+	return result == this.id ? this : (result != 0 ? new NSString(result) : null);
 }
 
 public static NSString stringWith(String str) {
-	char[] buffer = new char[str.length()];
-	str.getChars(0, buffer.length, buffer, 0);
-	return stringWithCharacters(buffer, buffer.length);
+	long /*int*/ result = OS.swt_NSString_stringWith(str);
+	return result != 0 ? new NSString(result) : null;
+}
+
+/**
+ * Returns a string that is never released, for keys and names that are
+ * created over and over.  Once <code>INTERNED_LIMIT</code> strings are
+ * kept, new strings are autoreleased as by <code>stringWith</code>.
+ */
+public static NSString internedStringWith(String str) {
+	synchronized (NSString.class) {
+		if (interned == null) interned = new Hashtable();
+		NSString result = (NSString)interned.get(str);
+		if (result != null) return result;
+		result = stringWith(str);
+		if (result != null && interned.size() < INTERNED_LIMIT) {
+			result.retain();
+			interned.put(str, result);
+		}
+		return result;
+	}
 }
 
 public long /*int*/ UTF8String() {
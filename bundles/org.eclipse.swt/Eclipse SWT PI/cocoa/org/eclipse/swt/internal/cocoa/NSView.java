@@ -49,9 +49,7 @@ public void beginPageInRect(NSRect aRect, NSPoint location) {
 }
 
 public NSRect bounds() {
-	NSRect result = new NSRect();
-	OS.objc_msgSend_stret(result, this.id, OS.sel_bounds);
-	return result;
+	return OS.getRect(this.id, OS.sel_bounds);
 }
 
 public boolean canBecomeKeyView() {
@@ -59,14 +57,20 @@ public boolean canBecomeKeyView() {
 }
 
 public NSPoint convertPoint_fromView_(NSPoint aPoint, NSView aView) {
+	double /*float*/ [] values = new double /*float*/ [2];
+	OS.swt_objc_msgSend_convertPoint(this.id, OS.sel_convertPoint_fromView_, aPoint.x, aPoint.y, aView != null ? aView.id : 0, values);
 	NSPoint result = new NSPoint();
-	OS.objc_msgSend_stret(result, this.id, OS.sel_convertPoint_fromView_, aPoint, aView != null ? aView.id : 0);
+	result.x = values[0];
+	result.y = values[1];
 	return result;
 }
 
 public NSPoint convertPoint_toView_(NSPoint aPoint, NSView aView) {
+	double /*float*/ [] values = new double /*float*/ [2];
+	OS.swt_objc_msgSend_convertPoint(this.id, OS.sel_convertPoint_toView_, aPoint.x, aPoint.y, aView != null ? aView.id : 0, values);
 	NSPoint result = new NSPoint();
-	OS.objc_msgSend_stret(result, this.id, OS.sel_convertPoint_toView_, aPoint, aView != null ? aView.id : 0);
+	result.x = values[0];
+	result.y = values[1];
 	return result;
 }
 
@@ -83,15 +87,15 @@ public NSPoint convertPointToBase(NSPoint aPoint) {
 }
 
 public NSRect convertRect_fromView_(NSRect aRect, NSView aView) {
-	NSRect result = new NSRect();
-	OS.objc_msgSend_stret(result, this.id, OS.sel_convertRect_fromView_, aRect, aView != null ? aView.id : 0);
-	return result;
+	double /*float*/ [] values = new double /*float*/ [4];
+	OS.swt_objc_msgSend_convertRect(this.id, OS.sel_convertRect_fromView_, aRect.x, aRect.y, aRect.width, aRect.height, aView != null ? aView.id : 0, values);
+	return OS.toNSRect(values);
 }
 
 public NSRect convertRect_toView_(NSRect aRect, NSView aView) {
-	NSRect result = new NSRect();
-	OS.objc_msgSend_stret(result, this.id, OS.sel_convertRect_toView_, aRect, aView != null ? aView.id : 0);
-	return result;
+	double /*float*/ [] values = new double /*float*/ [4];
+	OS.swt_objc_msgSend_convertRect(this.id, OS.sel_convertRect_toView_, aRect.x, aRect.y, aRect.width, aRect.height, aView != null ? aView.id : 0, values);
+	return OS.toNSRect(values);
 }
 
 public NSRect convertRectFromBase(NSRect aRect) {
@@ -163,9 +167,7 @@ public void endPage() {
 }
 
 public NSRect frame() {
-	NSRect result = new NSRect();
-	OS.objc_msgSend_stret(result, this.id, OS.sel_frame);
-	return result;
+	return OS.getRect(this.id, OS.sel_frame);
 }
 
 public NSView hitTest(NSPoint aPoint) {
@@ -272,15 +274,15 @@ public void setFocusRingType(long /*int*/ focusRingType) {
 }
 
 public void setFrame(NSRect frameRect) {
-	OS.objc_msgSend(this.id, OS.sel_setFrame_, frameRect);
+	OS.swt_objc_msgSend_setRect(this.id, OS.sel_setFrame_, frameRect.x, frameRect.y, frameRect.width, frameRect.height);
 }
 
 public void setFrameOrigin(NSPoint newOrigin) {
-	OS.objc_msgSend(this.id, OS.sel_setFrameOrigin_, newOrigin);
+	OS.swt_objc_msgSend_setPoint(this.id, OS.sel_setFrameOrigin_, newOrigin.x, newOrigin.y);
 }
 
 public void setFrameSize(NSSize newSize) {
-	OS.objc_msgSend(this.id, OS.sel_setFrameSize_, newSize);
+	OS.swt_objc_msgSend_setSize(this.id, OS.sel_setFrameSize_, newSize.width, newSize.height);
 }
 
 public void setHidden(boolean flag) {
@@ -343,9 +345,7 @@ public void viewWillMoveToWindow(NSWindow newWindow) {
 }
 
 public NSRect visibleRect() {
-	NSRect result = new NSRect();
-	OS.objc_msgSend_stret(result, this.id, OS.sel_visibleRect);
-	return result;
+	return OS.getRect(this.id, OS.sel_visibleRect);
 }
 
 public NSWindow window() {
@@ -128,9 +128,7 @@ public void flushWindowIfNeeded() {
 }
 
 public NSRect frame() {
-	NSRect result = new NSRect();
-	OS.objc_msgSend_stret(result, this.id, OS.sel_frame);
-	return result;
+	return OS.getRect(this.id, OS.sel_frame);
 }
 
 public NSRect frameRectForContentRect(NSRect contentRect) {
@@ -390,6 +390,153 @@ public static final native int getpid();
 
 public static final native void call(long /*int*/ proc, long /*int*/ id, long /*int*/ sel);
 
+/**
+ * Converts the pixels of a direct 24 or 32 bit image into alpha first ARGB
+ * at <code>dest</code>.  The shifts give the position of each channel in a
+ * pixel, and <code>alpha</code> is used when <code>alphaData</code> is null.
+ *
+ * @method flags=no_gen
+ */
+public static final native void swt_ImageData_toARGB(long /*int*/ dest, int width, int height, byte[] data, int bytesPerLine, int depth, int redShift, int greenShift, int blueShift, byte[] alphaData, int alpha);
+
+/**
+ * Dequeues and sends up to <code>maxEvents</code> events, each inside its
+ * own autorelease pool, and returns the number of events sent.
+ *
+ * @method flags=no_gen
+ */
+public static final native int swt_NSApplication_dispatchEvents(long /*int*/ application, long /*int*/ mask, long /*int*/ expiration, long /*int*/ mode, int maxEvents);
+
+/**
+ * Returns the number of line fragments of the layout manager and stores
+ * the used rectangle, as x, y, width and height, and the first glyph of
+ * as many of them as fit in the arrays.
+ *
+ * @method flags=no_gen
+ */
+public static final native int swt_NSLayoutManager_getLineFragments(long /*int*/ layoutManager, double[] /*float[]*/ rects, int[] glyphs);
+
+/**
+ * Returns the characters of the string, copied without an intermediate
+ * char array.
+ *
+ * @method flags=no_gen
+ */
+public static final native String swt_NSString_getString(long /*int*/ id);
+/** @method flags=no_gen */
+public static final native long /*int*/ swt_NSString_initWithString(long /*int*/ id, String str);
+/** @method flags=no_gen */
+public static final native long /*int*/ swt_NSString_stringWith(String str);
+
+/*
+ * Clips the current context to the rectangles being drawn by the view and
+ * answers their number.
+ */
+/** @method flags=no_gen */
+public static final native int swt_NSView_clipToRectsBeingDrawn(long /*int*/ view);
+
+/*
+ * A run loop source that wakes the UI thread, coalescing the wakes
+ * signaled before the run loop performs it.
+ */
+/** @method flags=no_gen */
+public static final native long /*int*/ swt_wake_source_new(long /*int*/ runLoop);
+/** @method flags=no_gen */
+public static final native void swt_wake_source_signal(long /*int*/ source);
+/** @method flags=no_gen */
+public static final native void swt_wake_source_free(long /*int*/ source);
+
+/*
+ * Typed message sends that call the cached implementation of the selector
+ * directly.  Rectangles are returned as x, y, width and height and points
+ * as x and y in the result array.
+ */
+/** @method flags=no_gen */
+public static final native void swt_objc_msgSend_getRect(long /*int*/ id, long /*int*/ sel, double[] /*float[]*/ result);
+/** @method flags=no_gen */
+public static final native void swt_objc_msgSend_setRect(long /*int*/ id, long /*int*/ sel, double x, double y, double width, double height);
+/** @method flags=no_gen */
+public static final native void swt_objc_msgSend_setPoint(long /*int*/ id, long /*int*/ sel, double x, double y);
+/** @method flags=no_gen */
+public static final native void swt_objc_msgSend_setSize(long /*int*/ id, long /*int*/ sel, double width, double height);
+/** @method flags=no_gen */
+public static final native void swt_objc_msgSend_convertRect(long /*int*/ id, long /*int*/ sel, double x, double y, double width, double height, long /*int*/ view, double[] /*float[]*/ result);
+/** @method flags=no_gen */
+public static final native void swt_objc_msgSend_convertPoint(long /*int*/ id, long /*int*/ sel, double x, double y, long /*int*/ view, double[] /*float[]*/ result);
+
+/**
+ * Returns the Java object referenced by the SWT_OBJECT instance variable of
+ * the object, or null if its class does not have one.
+ *
+ * @method flags=no_gen
+ */
+public static final native Object swt_object_getSWTObject(long /*int*/ id);
+
+static NSRect getRect(long /*int*/ id, long /*int*/ sel) {
+	double /*float*/ [] values = new double /*float*/ [4];
+	swt_objc_msgSend_getRect(id, sel, values);
+	return toNSRect(values);
+}
+
+static NSRect toNSRect(double /*float*/ [] values) {
+	NSRect result = new NSRect();
+	result.x = values[0];
+	result.y = values[1];
+	result.width = values[2];
+	result.height = values[3];
+	return result;
+}
+
+/*
+ * NSPoint, NSSize and NSRect are laid out as consecutive CGFloats and
+ * NSRange as two NSUIntegers, so they are copied as primitive arrays and
+ * filled in Java instead of through the generated field accessors.
+ */
+public static NSPoint readNSPoint(long /*int*/ ptr) {
+	double /*float*/ [] values = new double /*float*/ [2];
+	memmove(values, ptr, NSPoint.sizeof);
+	NSPoint result = new NSPoint();
+	result.x = values[0];
+	result.y = values[1];
+	return result;
+}
+
+public static NSRange readNSRange(long /*int*/ ptr) {
+	long /*int*/ [] values = new long /*int*/ [2];
+	memmove(values, ptr, NSRange.sizeof);
+	NSRange result = new NSRange();
+	result.location = values[0];
+	result.length = values[1];
+	return result;
+}
+
+public static NSRect readNSRect(long /*int*/ ptr) {
+	double /*float*/ [] values = new double /*float*/ [4];
+	memmove(values, ptr, NSRect.sizeof);
+	return toNSRect(values);
+}
+
+public static NSSize readNSSize(long /*int*/ ptr) {
+	double /*float*/ [] values = new double /*float*/ [2];
+	memmove(values, ptr, NSSize.sizeof);
+	NSSize result = new NSSize();
+	result.width = values[0];
+	result.height = values[1];
+	return result;
+}
+
+public static void writeNSRange(long /*int*/ ptr, NSRange range) {
+	memmove(ptr, new long /*int*/ [] {range.location, range.length}, NSRange.sizeof);
+}
+
+public static void writeNSRect(long /*int*/ ptr, NSRect rect) {
+	memmove(ptr, new double /*float*/ [] {rect.x, rect.y, rect.width, rect.height}, NSRect.sizeof);
+}
+
+public static void writeNSSize(long /*int*/ ptr, NSSize size) {
+	memmove(ptr, new double /*float*/ [] {size.width, size.height}, NSSize.sizeof);
+}
+
 /** @method flags=no_gen */
 public static final native boolean __BIG_ENDIAN__();
 public static final int kCGBitmapByteOrderDefault = 0 << 12;
@@ -630,6 +777,49 @@ public static final native long /*int*/ object_setInstanceVariable(long /*int*/
  */
 public static final native long /*int*/ object_setClass(long /*int*/ obj, long /*int*/ clazz);
 public static final native long /*int*/ sel_registerName(String selectorName);
+/**
+ * Looks up the classes or registers the selectors named in
+ * <code>names</code>, each terminated by a NUL byte, storing them in
+ * <code>result</code>.
+ *
+ * @method flags=no_gen
+ */
+public static final native void swt_objc_getClasses(byte[] names, int count, long /*int*/ [] result);
+/** @method flags=no_gen */
+public static final native void swt_sel_registerNames(byte[] names, int count, long /*int*/ [] result);
+
+/*
+ * The generated classes and selectors are looked up in one call each
+ * instead of converting and pinning every name on its own.  The names
+ * are ASCII and separated by NUL characters.
+ */
+static byte[] packNames(String names, int[] count) {
+	int length = names.length();
+	byte[] buffer = new byte[length];
+	for (int i = 0; i < length; i++) {
+		char c = names.charAt(i);
+		if (c == 0) count[0]++;
+		buffer[i] = (byte)c;
+	}
+	return buffer;
+}
+
+static long /*int*/ [] objc_getClasses(String names) {
+	int[] count = new int[1];
+	byte[] buffer = packNames(names, count);
+	long /*int*/ [] result = new long /*int*/ [count[0]];
+	swt_objc_getClasses(buffer, count[0], result);
+	return result;
+}
+
+static long /*int*/ [] sel_registerNames(String names) {
+	int[] count = new int[1];
+	byte[] buffer = packNames(names, count);
+	long /*int*/ [] result = new long /*int*/ [count[0]];
+	swt_sel_registerNames(buffer, count[0], result);
+	return result;
+}
+
 public static final native int objc_super_sizeof();
 
 /**
@@ -722,156 +912,307 @@ public static final native long /*int*/ CALLBACK_view_stringForToolTip_point_use
 public static final native long /*int*/ CALLBACK_webView_setFrame_(long /*int*/ func);
 
 /** Classes */
-public static final long /*int*/ class_DOMDocument = objc_getClass("DOMDocument");
-public static final long /*int*/ class_DOMEvent = objc_getClass("DOMEvent");
-public static final long /*int*/ class_DOMKeyboardEvent = objc_getClass("DOMKeyboardEvent");
-public static final long /*int*/ class_DOMMouseEvent = objc_getClass("DOMMouseEvent");
-public static final long /*int*/ class_DOMUIEvent = objc_getClass("DOMUIEvent");
-public static final long /*int*/ class_DOMWheelEvent = objc_getClass("DOMWheelEvent");
-public static final long /*int*/ class_NSActionCell = objc_getClass("NSActionCell");
-public static final long /*int*/ class_NSAffineTransform = objc_getClass("NSAffineTransform");
-public static final long /*int*/ class_NSAlert = objc_getClass("NSAlert");
-public static final long /*int*/ class_NSAppleEventDescriptor = objc_getClass("NSAppleEventDescriptor");
-public static final long /*int*/ class_NSApplication = objc_getClass("NSApplication");
-public static final long /*int*/ class_NSArray = objc_getClass("NSArray");
-public static final long /*int*/ class_NSAssertionHandler = objc_getClass("NSAssertionHandler");
-public static final long /*int*/ class_NSAttributedString = objc_getClass("NSAttributedString");
-public static final long /*int*/ class_NSAutoreleasePool = objc_getClass("NSAutoreleasePool");
-public static final long /*int*/ class_NSBezierPath = objc_getClass("NSBezierPath");
-public static final long /*int*/ class_NSBitmapImageRep = objc_getClass("NSBitmapImageRep");
-public static final long /*int*/ class_NSBox = objc_getClass("NSBox");
-public static final long /*int*/ class_NSBrowserCell = objc_getClass("NSBrowserCell");
-public static final long /*int*/ class_NSBundle = objc_getClass("NSBundle");
-public static final long /*int*/ class_NSButton = objc_getClass("NSButton");
-public static final long /*int*/ class_NSButtonCell = objc_getClass("NSButtonCell");
-public static final long /*int*/ class_NSCalendarDate = objc_getClass("NSCalendarDate");
-public static final long /*int*/ class_NSCell = objc_getClass("NSCell");
-public static final long /*int*/ class_NSCharacterSet = objc_getClass("NSCharacterSet");
-public static final long /*int*/ class_NSClipView = objc_getClass("NSClipView");
-public static final long /*int*/ class_NSCoder = objc_getClass("NSCoder");
-public static final long /*int*/ class_NSColor = objc_getClass("NSColor");
-public static final long /*int*/ class_NSColorList = objc_getClass("NSColorList");
-public static final long /*int*/ class_NSColorPanel = objc_getClass("NSColorPanel");
-public static final long /*int*/ class_NSColorSpace = objc_getClass("NSColorSpace");
-public static final long /*int*/ class_NSComboBox = objc_getClass("NSComboBox");
-public static final long /*int*/ class_NSComboBoxCell = objc_getClass("NSComboBoxCell");
-public static final long /*int*/ class_NSControl = objc_getClass("NSControl");
-public static final long /*int*/ class_NSCursor = objc_getClass("NSCursor");
-public static final long /*int*/ class_NSData = objc_getClass("NSData");
-public static final long /*int*/ class_NSDate = objc_getClass("NSDate");
-public static final long /*int*/ class_NSDatePicker = objc_getClass("NSDatePicker");
-public static final long /*int*/ class_NSDictionary = objc_getClass("NSDictionary");
-public static final long /*int*/ class_NSDirectoryEnumerator = objc_getClass("NSDirectoryEnumerator");
-public static final long /*int*/ class_NSDockTile = objc_getClass("NSDockTile");
-public static final long /*int*/ class_NSEnumerator = objc_getClass("NSEnumerator");
-public static final long /*int*/ class_NSError = objc_getClass("NSError");
-public static final long /*int*/ class_NSEvent = objc_getClass("NSEvent");
-public static final long /*int*/ class_NSFileManager = objc_getClass("NSFileManager");
-public static final long /*int*/ class_NSFileWrapper = objc_getClass("NSFileWrapper");
-public static final long /*int*/ class_NSFont = objc_getClass("NSFont");
-public static final long /*int*/ class_NSFontManager = objc_getClass("NSFontManager");
-public static final long /*int*/ class_NSFontPanel = objc_getClass("NSFontPanel");
-public static final long /*int*/ class_NSFormatter = objc_getClass("NSFormatter");
-public static final long /*int*/ class_NSGradient = objc_getClass("NSGradient");
-public static final long /*int*/ class_NSGraphicsContext = objc_getClass("NSGraphicsContext");
-public static final long /*int*/ class_NSHTTPCookie = objc_getClass("NSHTTPCookie");
-public static final long /*int*/ class_NSHTTPCookieStorage = objc_getClass("NSHTTPCookieStorage");
-public static final long /*int*/ class_NSImage = objc_getClass("NSImage");
-public static final long /*int*/ class_NSImageRep = objc_getClass("NSImageRep");
-public static final long /*int*/ class_NSImageView = objc_getClass("NSImageView");
-public static final long /*int*/ class_NSIndexSet = objc_getClass("NSIndexSet");
-public static final long /*int*/ class_NSInputManager = objc_getClass("NSInputManager");
-public static final long /*int*/ class_NSKeyedArchiver = objc_getClass("NSKeyedArchiver");
-public static final long /*int*/ class_NSKeyedUnarchiver = objc_getClass("NSKeyedUnarchiver");
-public static final long /*int*/ class_NSLayoutManager = objc_getClass("NSLayoutManager");
-public static final long /*int*/ class_NSLocale = objc_getClass("NSLocale");
-public static final long /*int*/ class_NSMenu = objc_getClass("NSMenu");
-public static final long /*int*/ class_NSMenuItem = objc_getClass("NSMenuItem");
-public static final long /*int*/ class_NSMutableArray = objc_getClass("NSMutableArray");
-public static final long /*int*/ class_NSMutableAttributedString = objc_getClass("NSMutableAttributedString");
-public static final long /*int*/ class_NSMutableDictionary = objc_getClass("NSMutableDictionary");
-public static final long /*int*/ class_NSMutableIndexSet = objc_getClass("NSMutableIndexSet");
-public static final long /*int*/ class_NSMutableParagraphStyle = objc_getClass("NSMutableParagraphStyle");
-public static final long /*int*/ class_NSMutableSet = objc_getClass("NSMutableSet");
-public static final long /*int*/ class_NSMutableString = objc_getClass("NSMutableString");
-public static final long /*int*/ class_NSMutableURLRequest = objc_getClass("NSMutableURLRequest");
-public static final long /*int*/ class_NSNotification = objc_getClass("NSNotification");
-public static final long /*int*/ class_NSNotificationCenter = objc_getClass("NSNotificationCenter");
-public static final long /*int*/ class_NSNumber = objc_getClass("NSNumber");
-public static final long /*int*/ class_NSNumberFormatter = objc_getClass("NSNumberFormatter");
-public static final long /*int*/ class_NSObject = objc_getClass("NSObject");
-public static final long /*int*/ class_NSOpenGLContext = objc_getClass("NSOpenGLContext");
-public static final long /*int*/ class_NSOpenGLPixelFormat = objc_getClass("NSOpenGLPixelFormat");
-public static final long /*int*/ class_NSOpenPanel = objc_getClass("NSOpenPanel");
-public static final long /*int*/ class_NSOutlineView = objc_getClass("NSOutlineView");
-public static final long /*int*/ class_NSPanel = objc_getClass("NSPanel");
-public static final long /*int*/ class_NSParagraphStyle = objc_getClass("NSParagraphStyle");
-public static final long /*int*/ class_NSPasteboard = objc_getClass("NSPasteboard");
-public static final long /*int*/ class_NSPopUpButton = objc_getClass("NSPopUpButton");
-public static final long /*int*/ class_NSPrintInfo = objc_getClass("NSPrintInfo");
-public static final long /*int*/ class_NSPrintOperation = objc_getClass("NSPrintOperation");
-public static final long /*int*/ class_NSPrintPanel = objc_getClass("NSPrintPanel");
-public static final long /*int*/ class_NSPrinter = objc_getClass("NSPrinter");
-public static final long /*int*/ class_NSProgressIndicator = objc_getClass("NSProgressIndicator");
-public static final long /*int*/ class_NSResponder = objc_getClass("NSResponder");
-public static final long /*int*/ class_NSRunLoop = objc_getClass("NSRunLoop");
-public static final long /*int*/ class_NSSavePanel = objc_getClass("NSSavePanel");
-public static final long /*int*/ class_NSScreen = objc_getClass("NSScreen");
-public static final long /*int*/ class_NSScrollView = objc_getClass("NSScrollView");
-public static final long /*int*/ class_NSScroller = objc_getClass("NSScroller");
-public static final long /*int*/ class_NSSearchField = objc_getClass("NSSearchField");
-public static final long /*int*/ class_NSSearchFieldCell = objc_getClass("NSSearchFieldCell");
-public static final long /*int*/ class_NSSecureTextField = objc_getClass("NSSecureTextField");
-public static final long /*int*/ class_NSSegmentedCell = objc_getClass("NSSegmentedCell");
-public static final long /*int*/ class_NSSet = objc_getClass("NSSet");
-public static final long /*int*/ class_NSSlider = objc_getClass("NSSlider");
-public static final long /*int*/ class_NSStatusBar = objc_getClass("NSStatusBar");
-public static final long /*int*/ class_NSStatusItem = objc_getClass("NSStatusItem");
-public static final long /*int*/ class_NSStepper = objc_getClass("NSStepper");
-public static final long /*int*/ class_NSString = objc_getClass("NSString");
-public static final long /*int*/ class_NSTabView = objc_getClass("NSTabView");
-public static final long /*int*/ class_NSTabViewItem = objc_getClass("NSTabViewItem");
-public static final long /*int*/ class_NSTableColumn = objc_getClass("NSTableColumn");
-public static final long /*int*/ class_NSTableHeaderCell = objc_getClass("NSTableHeaderCell");
-public static final long /*int*/ class_NSTableHeaderView = objc_getClass("NSTableHeaderView");
-public static final long /*int*/ class_NSTableView = objc_getClass("NSTableView");
-public static final long /*int*/ class_NSText = objc_getClass("NSText");
-public static final long /*int*/ class_NSTextAttachment = objc_getClass("NSTextAttachment");
-public static final long /*int*/ class_NSTextContainer = objc_getClass("NSTextContainer");
-public static final long /*int*/ class_NSTextField = objc_getClass("NSTextField");
-public static final long /*int*/ class_NSTextFieldCell = objc_getClass("NSTextFieldCell");
-public static final long /*int*/ class_NSTextStorage = objc_getClass("NSTextStorage");
-public static final long /*int*/ class_NSTextTab = objc_getClass("NSTextTab");
-public static final long /*int*/ class_NSTextView = objc_getClass("NSTextView");
-public static final long /*int*/ class_NSThread = objc_getClass("NSThread");
-public static final long /*int*/ class_NSTimeZone = objc_getClass("NSTimeZone");
-public static final long /*int*/ class_NSTimer = objc_getClass("NSTimer");
-public static final long /*int*/ class_NSToolbar = objc_getClass("NSToolbar");
-public static final long /*int*/ class_NSToolbarItem = objc_getClass("NSToolbarItem");
-public static final long /*int*/ class_NSTouch = objc_getClass("NSTouch");
-public static final long /*int*/ class_NSTrackingArea = objc_getClass("NSTrackingArea");
-public static final long /*int*/ class_NSTypesetter = objc_getClass("NSTypesetter");
-public static final long /*int*/ class_NSURL = objc_getClass("NSURL");
-public static final long /*int*/ class_NSURLAuthenticationChallenge = objc_getClass("NSURLAuthenticationChallenge");
-public static final long /*int*/ class_NSURLCredential = objc_getClass("NSURLCredential");
-public static final long /*int*/ class_NSURLDownload = objc_getClass("NSURLDownload");
-public static final long /*int*/ class_NSURLProtectionSpace = objc_getClass("NSURLProtectionSpace");
-public static final long /*int*/ class_NSURLRequest = objc_getClass("NSURLRequest");
-public static final long /*int*/ class_NSUndoManager = objc_getClass("NSUndoManager");
-public static final long /*int*/ class_NSUserDefaults = objc_getClass("NSUserDefaults");
-public static final long /*int*/ class_NSValue = objc_getClass("NSValue");
-public static final long /*int*/ class_NSView = objc_getClass("NSView");
-public static final long /*int*/ class_NSWindow = objc_getClass("NSWindow");
-public static final long /*int*/ class_NSWorkspace = objc_getClass("NSWorkspace");
-public static final long /*int*/ class_SFCertificatePanel = objc_getClass("SFCertificatePanel");
-public static final long /*int*/ class_SFCertificateTrustPanel = objc_getClass("SFCertificateTrustPanel");
-public static final long /*int*/ class_WebDataSource = objc_getClass("WebDataSource");
-public static final long /*int*/ class_WebFrame = objc_getClass("WebFrame");
-public static final long /*int*/ class_WebFrameView = objc_getClass("WebFrameView");
-public static final long /*int*/ class_WebPreferences = objc_getClass("WebPreferences");
-public static final long /*int*/ class_WebScriptObject = objc_getClass("WebScriptObject");
-public static final long /*int*/ class_WebUndefined = objc_getClass("WebUndefined");
-public static final long /*int*/ class_WebView = objc_getClass("WebView");
+static final long /*int*/ [] CLASSES = objc_getClasses(
+	"DOMDocument\0" +
+	"DOMEvent\0" +
+	"DOMKeyboardEvent\0" +
+	"DOMMouseEvent\0" +
+	"DOMUIEvent\0" +
+	"DOMWheelEvent\0" +
+	"NSActionCell\0" +
+	"NSAffineTransform\0" +
+	"NSAlert\0" +
+	"NSAppleEventDescriptor\0" +
+	"NSApplication\0" +
+	"NSArray\0" +
+	"NSAssertionHandler\0" +
+	"NSAttributedString\0" +
+	"NSAutoreleasePool\0" +
+	"NSBezierPath\0" +
+	"NSBitmapImageRep\0" +
+	"NSBox\0" +
+	"NSBrowserCell\0" +
+	"NSBundle\0" +
+	"NSButton\0" +
+	"NSButtonCell\0" +
+	"NSCalendarDate\0" +
+	"NSCell\0" +
+	"NSCharacterSet\0" +
+	"NSClipView\0" +
+	"NSCoder\0" +
+	"NSColor\0" +
+	"NSColorList\0" +
+	"NSColorPanel\0" +
+	"NSColorSpace\0" +
+	"NSComboBox\0" +
+	"NSComboBoxCell\0" +
+	"NSControl\0" +
+	"NSCursor\0" +
+	"NSData\0" +
+	"NSDate\0" +
+	"NSDatePicker\0" +
+	"NSDictionary\0" +
+	"NSDirectoryEnumerator\0" +
+	"NSDockTile\0" +
+	"NSEnumerator\0" +
+	"NSError\0" +
+	"NSEvent\0" +
+	"NSFileManager\0" +
+	"NSFileWrapper\0" +
+	"NSFont\0" +
+	"NSFontManager\0" +
+	"NSFontPanel\0" +
+	"NSFormatter\0" +
+	"NSGradient\0" +
+	"NSGraphicsContext\0" +
+	"NSHTTPCookie\0" +
+	"NSHTTPCookieStorage\0" +
+	"NSImage\0" +
+	"NSImageRep\0" +
+	"NSImageView\0" +
+	"NSIndexSet\0" +
+	"NSInputManager\0" +
+	"NSKeyedArchiver\0" +
+	"NSKeyedUnarchiver\0" +
+	"NSLayoutManager\0" +
+	"NSLocale\0" +
+	"NSMenu\0" +
+	"NSMenuItem\0" +
+	"NSMutableArray\0" +
+	"NSMutableAttributedString\0" +
+	"NSMutableDictionary\0" +
+	"NSMutableIndexSet\0" +
+	"NSMutableParagraphStyle\0" +
+	"NSMutableSet\0" +
+	"NSMutableString\0" +
+	"NSMutableURLRequest\0" +
+	"NSNotification\0" +
+	"NSNotificationCenter\0" +
+	"NSNumber\0" +
+	"NSNumberFormatter\0" +
+	"NSObject\0" +
+	"NSOpenGLContext\0" +
+	"NSOpenGLPixelFormat\0" +
+	"NSOpenPanel\0" +
+	"NSOutlineView\0" +
+	"NSPanel\0" +
+	"NSParagraphStyle\0" +
+	"NSPasteboard\0" +
+	"NSPopUpButton\0" +
+	"NSPrintInfo\0" +
+	"NSPrintOperation\0" +
+	"NSPrintPanel\0" +
+	"NSPrinter\0" +
+	"NSProgressIndicator\0" +
+	"NSResponder\0" +
+	"NSRunLoop\0" +
+	"NSSavePanel\0" +
+	"NSScreen\0" +
+	"NSScrollView\0" +
+	"NSScroller\0" +
+	"NSSearchField\0" +
+	"NSSearchFieldCell\0" +
+	"NSSecureTextField\0" +
+	"NSSegmentedCell\0" +
+	"NSSet\0" +
+	"NSSlider\0" +
+	"NSStatusBar\0" +
+	"NSStatusItem\0" +
+	"NSStepper\0" +
+	"NSString\0" +
+	"NSTabView\0" +
+	"NSTabViewItem\0" +
+	"NSTableColumn\0" +
+	"NSTableHeaderCell\0" +
+	"NSTableHeaderView\0" +
+	"NSTableView\0" +
+	"NSText\0" +
+	"NSTextAttachment\0" +
+	"NSTextContainer\0" +
+	"NSTextField\0" +
+	"NSTextFieldCell\0" +
+	"NSTextStorage\0" +
+	"NSTextTab\0" +
+	"NSTextView\0" +
+	"NSThread\0" +
+	"NSTimeZone\0" +
+	"NSTimer\0" +
+	"NSToolbar\0" +
+	"NSToolbarItem\0" +
+	"NSTouch\0" +
+	"NSTrackingArea\0" +
+	"NSTypesetter\0" +
+	"NSURL\0" +
+	"NSURLAuthenticationChallenge\0" +
+	"NSURLCredential\0" +
+	"NSURLDownload\0" +
+	"NSURLProtectionSpace\0" +
+	"NSURLRequest\0" +
+	"NSUndoManager\0" +
+	"NSUserDefaults\0" +
+	"NSValue\0" +
+	"NSView\0" +
+	"NSWindow\0" +
+	"NSWorkspace\0" +
+	"SFCertificatePanel\0" +
+	"SFCertificateTrustPanel\0" +
+	"WebDataSource\0" +
+	"WebFrame\0" +
+	"WebFrameView\0" +
+	"WebPreferences\0" +
+	"WebScriptObject\0" +
+	"WebUndefined\0" +
+	"WebView\0");
+public static final long /*int*/ class_DOMDocument = CLASSES[0];
+public static final long /*int*/ class_DOMEvent = CLASSES[1];
+public static final long /*int*/ class_DOMKeyboardEvent = CLASSES[2];
+public static final long /*int*/ class_DOMMouseEvent = CLASSES[3];
+public static final long /*int*/ class_DOMUIEvent = CLASSES[4];
+public static final long /*int*/ class_DOMWheelEvent = CLASSES[5];
+public static final long /*int*/ class_NSActionCell = CLASSES[6];
+public static final long /*int*/ class_NSAffineTransform = CLASSES[7];
+public static final long /*int*/ class_NSAlert = CLASSES[8];
+public static final long /*int*/ class_NSAppleEventDescriptor = CLASSES[9];
+public static final long /*int*/ class_NSApplication = CLASSES[10];
+public static final long /*int*/ class_NSArray = CLASSES[11];
+public static final long /*int*/ class_NSAssertionHandler = CLASSES[12];
+public static final long /*int*/ class_NSAttributedString = CLASSES[13];
+public static final long /*int*/ class_NSAutoreleasePool = CLASSES[14];
+public static final long /*int*/ class_NSBezierPath = CLASSES[15];
+public static final long /*int*/ class_NSBitmapImageRep = CLASSES[16];
+public static final long /*int*/ class_NSBox = CLASSES[17];
+public static final long /*int*/ class_NSBrowserCell = CLASSES[18];
+public static final long /*int*/ class_NSBundle = CLASSES[19];
+public static final long /*int*/ class_NSButton = CLASSES[20];
+public static final long /*int*/ class_NSButtonCell = CLASSES[21];
+public static final long /*int*/ class_NSCalendarDate = CLASSES[22];
+public static final long /*int*/ class_NSCell = CLASSES[23];
+public static final long /*int*/ class_NSCharacterSet = CLASSES[24];
+public static final long /*int*/ class_NSClipView = CLASSES[25];
+public static final long /*int*/ class_NSCoder = CLASSES[26];
+public static final long /*int*/ class_NSColor = CLASSES[27];
+public static final long /*int*/ class_NSColorList = CLASSES[28];
+public static final long /*int*/ class_NSColorPanel = CLASSES[29];
+public static final long /*int*/ class_NSColorSpace = CLASSES[30];
+public static final long /*int*/ class_NSComboBox = CLASSES[31];
+public static final long /*int*/ class_NSComboBoxCell = CLASSES[32];
+public static final long /*int*/ class_NSControl = CLASSES[33];
+public static final long /*int*/ class_NSCursor = CLASSES[34];
+public static final long /*int*/ class_NSData = CLASSES[35];
+public static final long /*int*/ class_NSDate = CLASSES[36];
+public static final long /*int*/ class_NSDatePicker = CLASSES[37];
+public static final long /*int*/ class_NSDictionary = CLASSES[38];
+public static final long /*int*/ class_NSDirectoryEnumerator = CLASSES[39];
+public static final long /*int*/ class_NSDockTile = CLASSES[40];
+public static final long /*int*/ class_NSEnumerator = CLASSES[41];
+public static final long /*int*/ class_NSError = CLASSES[42];
+public static final long /*int*/ class_NSEvent = CLASSES[43];
+public static final long /*int*/ class_NSFileManager = CLASSES[44];
+public static final long /*int*/ class_NSFileWrapper = CLASSES[45];
+public static final long /*int*/ class_NSFont = CLASSES[46];
+public static final long /*int*/ class_NSFontManager = CLASSES[47];
+public static final long /*int*/ class_NSFontPanel = CLASSES[48];
+public static final long /*int*/ class_NSFormatter = CLASSES[49];
+public static final long /*int*/ class_NSGradient = CLASSES[50];
+public static final long /*int*/ class_NSGraphicsContext = CLASSES[51];
+public static final long /*int*/ class_NSHTTPCookie = CLASSES[52];
+public static final long /*int*/ class_NSHTTPCookieStorage = CLASSES[53];
+public static final long /*int*/ class_NSImage = CLASSES[54];
+public static final long /*int*/ class_NSImageRep = CLASSES[55];
+public static final long /*int*/ class_NSImageView = CLASSES[56];
+public static final long /*int*/ class_NSIndexSet = CLASSES[57];
+public static final long /*int*/ class_NSInputManager = CLASSES[58];
+public static final long /*int*/ class_NSKeyedArchiver = CLASSES[59];
+public static final long /*int*/ class_NSKeyedUnarchiver = CLASSES[60];
+public static final long /*int*/ class_NSLayoutManager = CLASSES[61];
+public static final long /*int*/ class_NSLocale = CLASSES[62];
+public static final long /*int*/ class_NSMenu = CLASSES[63];
+public static final long /*int*/ class_NSMenuItem = CLASSES[64];
+public static final long /*int*/ class_NSMutableArray = CLASSES[65];
+public static final long /*int*/ class_NSMutableAttributedString = CLASSES[66];
+public static final long /*int*/ class_NSMutableDictionary = CLASSES[67];
+public static final long /*int*/ class_NSMutableIndexSet = CLASSES[68];
+public static final long /*int*/ class_NSMutableParagraphStyle = CLASSES[69];
+public static final long /*int*/ class_NSMutableSet = CLASSES[70];
+public static final long /*int*/ class_NSMutableString = CLASSES[71];
+public static final long /*int*/ class_NSMutableURLRequest = CLASSES[72];
+public static final long /*int*/ class_NSNotification = CLASSES[73];
+public static final long /*int*/ class_NSNotificationCenter = CLASSES[74];
+public static final long /*int*/ class_NSNumber = CLASSES[75];
+public static final long /*int*/ class_NSNumberFormatter = CLASSES[76];
+public static final long /*int*/ class_NSObject = CLASSES[77];
+public static final long /*int*/ class_NSOpenGLContext = CLASSES[78];
+public static final long /*int*/ class_NSOpenGLPixelFormat = CLASSES[79];
+public static final long /*int*/ class_NSOpenPanel = CLASSES[80];
+public static final long /*int*/ class_NSOutlineView = CLASSES[81];
+public static final long /*int*/ class_NSPanel = CLASSES[82];
+public static final long /*int*/ class_NSParagraphStyle = CLASSES[83];
+public static final long /*int*/ class_NSPasteboard = CLASSES[84];
+public static final long /*int*/ class_NSPopUpButton = CLASSES[85];
+public static final long /*int*/ class_NSPrintInfo = CLASSES[86];
+public static final long /*int*/ class_NSPrintOperation = CLASSES[87];
+public static final long /*int*/ class_NSPrintPanel = CLASSES[88];
+public static final long /*int*/ class_NSPrinter = CLASSES[89];
+public static final long /*int*/ class_NSProgressIndicator = CLASSES[90];
+public static final long /*int*/ class_NSResponder = CLASSES[91];
+public static final long /*int*/ class_NSRunLoop = CLASSES[92];
+public static final long /*int*/ class_NSSavePanel = CLASSES[93];
+public static final long /*int*/ class_NSScreen = CLASSES[94];
+public static final long /*int*/ class_NSScrollView = CLASSES[95];
+public static final long /*int*/ class_NSScroller = CLASSES[96];
+public static final long /*int*/ class_NSSearchField = CLASSES[97];
+public static final long /*int*/ class_NSSearchFieldCell = CLASSES[98];
+public static final long /*int*/ class_NSSecureTextField = CLASSES[99];
+public static final long /*int*/ class_NSSegmentedCell = CLASSES[100];
+public static final long /*int*/ class_NSSet = CLASSES[101];
+public static final long /*int*/ class_NSSlider = CLASSES[102];
+public static final long /*int*/ class_NSStatusBar = CLASSES[103];
+public static final long /*int*/ class_NSStatusItem = CLASSES[104];
+public static final long /*int*/ class_NSStepper = CLASSES[105];
+public static final long /*int*/ class_NSString = CLASSES[106];
+public static final long /*int*/ class_NSTabView = CLASSES[107];
+public static final long /*int*/ class_NSTabViewItem = CLASSES[108];
+public static final long /*int*/ class_NSTableColumn = CLASSES[109];
+public static final long /*int*/ class_NSTableHeaderCell = CLASSES[110];
+public static final long /*int*/ class_NSTableHeaderView = CLASSES[111];
+public static final long /*int*/ class_NSTableView = CLASSES[112];
+public static final long /*int*/ class_NSText = CLASSES[113];
+public static final long /*int*/ class_NSTextAttachment = CLASSES[114];
+public static final long /*int*/ class_NSTextContainer = CLASSES[115];
+public static final long /*int*/ class_NSTextField = CLASSES[116];
+public static final long /*int*/ class_NSTextFieldCell = CLASSES[117];
+public static final long /*int*/ class_NSTextStorage = CLASSES[118];
+public static final long /*int*/ class_NSTextTab = CLASSES[119];
+public static final long /*int*/ class_NSTextView = CLASSES[120];
+public static final long /*int*/ class_NSThread = CLASSES[121];
+public static final long /*int*/ class_NSTimeZone = CLASSES[122];
+public static final long /*int*/ class_NSTimer = CLASSES[123];
+public static final long /*int*/ class_NSToolbar = CLASSES[124];
+public static final long /*int*/ class_NSToolbarItem = CLASSES[125];
+public static final long /*int*/ class_NSTouch = CLASSES[126];
+public static final long /*int*/ class_NSTrackingArea = CLASSES[127];
+public static final long /*int*/ class_NSTypesetter = CLASSES[128];
+public static final long /*int*/ class_NSURL = CLASSES[129];
+public static final long /*int*/ class_NSURLAuthenticationChallenge = CLASSES[130];
+public static final long /*int*/ class_NSURLCredential = CLASSES[131];
+public static final long /*int*/ class_NSURLDownload = CLASSES[132];
+public static final long /*int*/ class_NSURLProtectionSpace = CLASSES[133];
+public static final long /*int*/ class_NSURLRequest = CLASSES[134];
+public static final long /*int*/ class_NSUndoManager = CLASSES[135];
+public static final long /*int*/ class_NSUserDefaults = CLASSES[136];
+public static final long /*int*/ class_NSValue = CLASSES[137];
+public static final long /*int*/ class_NSView = CLASSES[138];
+public static final long /*int*/ class_NSWindow = CLASSES[139];
+public static final long /*int*/ class_NSWorkspace = CLASSES[140];
+public static final long /*int*/ class_SFCertificatePanel = CLASSES[141];
+public static final long /*int*/ class_SFCertificateTrustPanel = CLASSES[142];
+public static final long /*int*/ class_WebDataSource = CLASSES[143];
+public static final long /*int*/ class_WebFrame = CLASSES[144];
+public static final long /*int*/ class_WebFrameView = CLASSES[145];
+public static final long /*int*/ class_WebPreferences = CLASSES[146];
+public static final long /*int*/ class_WebScriptObject = CLASSES[147];
+public static final long /*int*/ class_WebUndefined = CLASSES[148];
+public static final long /*int*/ class_WebView = CLASSES[149];
 
 /** Protocols */
 public static final long /*int*/ protocol_NSAccessibility = objc_getProtocol("NSAccessibility");
@@ -913,1387 +1254,2769 @@ public static final long /*int*/ protocol_WebResourceLoadDelegate = objc_getProt
 public static final long /*int*/ protocol_WebUIDelegate = objc_getProtocol("WebUIDelegate");
 
 /** Selectors */
-public static final long /*int*/ sel_CGEvent = sel_registerName("CGEvent");
-public static final long /*int*/ sel_DOMDocument = sel_registerName("DOMDocument");
-public static final long /*int*/ sel_IBeamCursor = sel_registerName("IBeamCursor");
-public static final long /*int*/ sel_PMPrintSession = sel_registerName("PMPrintSession");
-public static final long /*int*/ sel_PMPrintSettings = sel_registerName("PMPrintSettings");
-public static final long /*int*/ sel_TIFFRepresentation = sel_registerName("TIFFRepresentation");
-public static final long /*int*/ sel_URL = sel_registerName("URL");
-public static final long /*int*/ sel_URLFromPasteboard_ = sel_registerName("URLFromPasteboard:");
-public static final long /*int*/ sel_URLWithString_ = sel_registerName("URLWithString:");
-public static final long /*int*/ sel_URLsForDirectory_inDomains_ = sel_registerName("URLsForDirectory:inDomains:");
-public static final long /*int*/ sel_UTF8String = sel_registerName("UTF8String");
-public static final long /*int*/ sel_abortEditing = sel_registerName("abortEditing");
-public static final long /*int*/ sel_absoluteString = sel_registerName("absoluteString");
-public static final long /*int*/ sel_acceptsFirstMouse_ = sel_registerName("acceptsFirstMouse:");
-public static final long /*int*/ sel_acceptsFirstResponder = sel_registerName("acceptsFirstResponder");
-public static final long /*int*/ sel_accessibilityActionDescription_ = sel_registerName("accessibilityActionDescription:");
-public static final long /*int*/ sel_accessibilityActionNames = sel_registerName("accessibilityActionNames");
-public static final long /*int*/ sel_accessibilityAttributeNames = sel_registerName("accessibilityAttributeNames");
-public static final long /*int*/ sel_accessibilityAttributeValue_ = sel_registerName("accessibilityAttributeValue:");
-public static final long /*int*/ sel_accessibilityAttributeValue_forParameter_ = sel_registerName("accessibilityAttributeValue:forParameter:");
-public static final long /*int*/ sel_accessibilityFocusedUIElement = sel_registerName("accessibilityFocusedUIElement");
-public static final long /*int*/ sel_accessibilityHitTest_ = sel_registerName("accessibilityHitTest:");
-public static final long /*int*/ sel_accessibilityIsAttributeSettable_ = sel_registerName("accessibilityIsAttributeSettable:");
-public static final long /*int*/ sel_accessibilityIsIgnored = sel_registerName("accessibilityIsIgnored");
-public static final long /*int*/ sel_accessibilityParameterizedAttributeNames = sel_registerName("accessibilityParameterizedAttributeNames");
-public static final long /*int*/ sel_accessibilityPerformAction_ = sel_registerName("accessibilityPerformAction:");
-public static final long /*int*/ sel_accessibilitySetOverrideValue_forAttribute_ = sel_registerName("accessibilitySetOverrideValue:forAttribute:");
-public static final long /*int*/ sel_accessibilitySetValue_forAttribute_ = sel_registerName("accessibilitySetValue:forAttribute:");
-public static final long /*int*/ sel_action = sel_registerName("action");
-public static final long /*int*/ sel_activateIgnoringOtherApps_ = sel_registerName("activateIgnoringOtherApps:");
-public static final long /*int*/ sel_addAttribute_value_range_ = sel_registerName("addAttribute:value:range:");
-public static final long /*int*/ sel_addButtonWithTitle_ = sel_registerName("addButtonWithTitle:");
-public static final long /*int*/ sel_addChildWindow_ordered_ = sel_registerName("addChildWindow:ordered:");
-public static final long /*int*/ sel_addClip = sel_registerName("addClip");
-public static final long /*int*/ sel_addEventListener_listener_useCapture_ = sel_registerName("addEventListener:listener:useCapture:");
-public static final long /*int*/ sel_addIndex_ = sel_registerName("addIndex:");
-public static final long /*int*/ sel_addItem_ = sel_registerName("addItem:");
-public static final long /*int*/ sel_addItemWithObjectValue_ = sel_registerName("addItemWithObjectValue:");
-public static final long /*int*/ sel_addItemWithTitle_action_keyEquivalent_ = sel_registerName("addItemWithTitle:action:keyEquivalent:");
-public static final long /*int*/ sel_addLayoutManager_ = sel_registerName("addLayoutManager:");
-public static final long /*int*/ sel_addObject_ = sel_registerName("addObject:");
-public static final long /*int*/ sel_addObjectsFromArray_ = sel_registerName("addObjectsFromArray:");
-public static final long /*int*/ sel_addObserver_selector_name_object_ = sel_registerName("addObserver:selector:name:object:");
-public static final long /*int*/ sel_addRepresentation_ = sel_registerName("addRepresentation:");
-public static final long /*int*/ sel_addSubview_ = sel_registerName("addSubview:");
-public static final long /*int*/ sel_addSubview_positioned_relativeTo_ = sel_registerName("addSubview:positioned:relativeTo:");
-public static final long /*int*/ sel_addTabStop_ = sel_registerName("addTabStop:");
-public static final long /*int*/ sel_addTabViewItem_ = sel_registerName("addTabViewItem:");
-public static final long /*int*/ sel_addTableColumn_ = sel_registerName("addTableColumn:");
-public static final long /*int*/ sel_addTemporaryAttribute_value_forCharacterRange_ = sel_registerName("addTemporaryAttribute:value:forCharacterRange:");
-public static final long /*int*/ sel_addTextContainer_ = sel_registerName("addTextContainer:");
-public static final long /*int*/ sel_addTimer_forMode_ = sel_registerName("addTimer:forMode:");
-public static final long /*int*/ sel_addToolTipRect_owner_userData_ = sel_registerName("addToolTipRect:owner:userData:");
-public static final long /*int*/ sel_addTypes_owner_ = sel_registerName("addTypes:owner:");
-public static final long /*int*/ sel_alignment = sel_registerName("alignment");
-public static final long /*int*/ sel_allKeys = sel_registerName("allKeys");
-public static final long /*int*/ sel_allObjects = sel_registerName("allObjects");
-public static final long /*int*/ sel_alloc = sel_registerName("alloc");
-public static final long /*int*/ sel_allowsColumnReordering = sel_registerName("allowsColumnReordering");
-public static final long /*int*/ sel_allowsFloats = sel_registerName("allowsFloats");
-public static final long /*int*/ sel_alphaComponent = sel_registerName("alphaComponent");
-public static final long /*int*/ sel_alphaValue = sel_registerName("alphaValue");
-public static final long /*int*/ sel_altKey = sel_registerName("altKey");
-public static final long /*int*/ sel_alternateSelectedControlColor = sel_registerName("alternateSelectedControlColor");
-public static final long /*int*/ sel_alternateSelectedControlTextColor = sel_registerName("alternateSelectedControlTextColor");
-public static final long /*int*/ sel_alwaysShowsDecimalSeparator = sel_registerName("alwaysShowsDecimalSeparator");
-public static final long /*int*/ sel_appendAttributedString_ = sel_registerName("appendAttributedString:");
-public static final long /*int*/ sel_appendBezierPath_ = sel_registerName("appendBezierPath:");
-public static final long /*int*/ sel_appendBezierPathWithArcWithCenter_radius_startAngle_endAngle_ = sel_registerName("appendBezierPathWithArcWithCenter:radius:startAngle:endAngle:");
-public static final long /*int*/ sel_appendBezierPathWithArcWithCenter_radius_startAngle_endAngle_clockwise_ = sel_registerName("appendBezierPathWithArcWithCenter:radius:startAngle:endAngle:clockwise:");
-public static final long /*int*/ sel_appendBezierPathWithGlyphs_count_inFont_ = sel_registerName("appendBezierPathWithGlyphs:count:inFont:");
-public static final long /*int*/ sel_appendBezierPathWithOvalInRect_ = sel_registerName("appendBezierPathWithOvalInRect:");
-public static final long /*int*/ sel_appendBezierPathWithRect_ = sel_registerName("appendBezierPathWithRect:");
-public static final long /*int*/ sel_appendBezierPathWithRoundedRect_xRadius_yRadius_ = sel_registerName("appendBezierPathWithRoundedRect:xRadius:yRadius:");
-public static final long /*int*/ sel_appendString_ = sel_registerName("appendString:");
-public static final long /*int*/ sel_application_openFile_ = sel_registerName("application:openFile:");
-public static final long /*int*/ sel_application_openFiles_ = sel_registerName("application:openFiles:");
-public static final long /*int*/ sel_applicationDidBecomeActive_ = sel_registerName("applicationDidBecomeActive:");
-public static final long /*int*/ sel_applicationDidFinishLaunching_ = sel_registerName("applicationDidFinishLaunching:");
-public static final long /*int*/ sel_applicationDidResignActive_ = sel_registerName("applicationDidResignActive:");
-public static final long /*int*/ sel_applicationDockMenu_ = sel_registerName("applicationDockMenu:");
-public static final long /*int*/ sel_applicationIconImage = sel_registerName("applicationIconImage");
-public static final long /*int*/ sel_applicationShouldHandleReopen_hasVisibleWindows_ = sel_registerName("applicationShouldHandleReopen:hasVisibleWindows:");
-public static final long /*int*/ sel_applicationShouldTerminate_ = sel_registerName("applicationShouldTerminate:");
-public static final long /*int*/ sel_applicationWillFinishLaunching_ = sel_registerName("applicationWillFinishLaunching:");
-public static final long /*int*/ sel_applicationWillTerminate_ = sel_registerName("applicationWillTerminate:");
-public static final long /*int*/ sel_archivedDataWithRootObject_ = sel_registerName("archivedDataWithRootObject:");
-public static final long /*int*/ sel_areCursorRectsEnabled = sel_registerName("areCursorRectsEnabled");
-public static final long /*int*/ sel_arrangeInFront_ = sel_registerName("arrangeInFront:");
-public static final long /*int*/ sel_array = sel_registerName("array");
-public static final long /*int*/ sel_arrayWithCapacity_ = sel_registerName("arrayWithCapacity:");
-public static final long /*int*/ sel_arrayWithObject_ = sel_registerName("arrayWithObject:");
-public static final long /*int*/ sel_arrowCursor = sel_registerName("arrowCursor");
-public static final long /*int*/ sel_ascender = sel_registerName("ascender");
-public static final long /*int*/ sel_attachColorList_ = sel_registerName("attachColorList:");
-public static final long /*int*/ sel_attribute_atIndex_effectiveRange_ = sel_registerName("attribute:atIndex:effectiveRange:");
-public static final long /*int*/ sel_attributedStringValue = sel_registerName("attributedStringValue");
-public static final long /*int*/ sel_attributedStringWithAttachment_ = sel_registerName("attributedStringWithAttachment:");
-public static final long /*int*/ sel_attributedSubstringFromRange_ = sel_registerName("attributedSubstringFromRange:");
-public static final long /*int*/ sel_attributedTitle = sel_registerName("attributedTitle");
-public static final long /*int*/ sel_attributesAtIndex_longestEffectiveRange_inRange_ = sel_registerName("attributesAtIndex:longestEffectiveRange:inRange:");
-public static final long /*int*/ sel_autorelease = sel_registerName("autorelease");
-public static final long /*int*/ sel_availableFontFamilies = sel_registerName("availableFontFamilies");
-public static final long /*int*/ sel_availableFonts = sel_registerName("availableFonts");
-public static final long /*int*/ sel_availableMembersOfFontFamily_ = sel_registerName("availableMembersOfFontFamily:");
-public static final long /*int*/ sel_availableTypeFromArray_ = sel_registerName("availableTypeFromArray:");
-public static final long /*int*/ sel_backgroundColor = sel_registerName("backgroundColor");
-public static final long /*int*/ sel_backingScaleFactor = sel_registerName("backingScaleFactor");
-public static final long /*int*/ sel_badgeLabel = sel_registerName("badgeLabel");
-public static final long /*int*/ sel_baselineOffsetInLayoutManager_glyphIndex_ = sel_registerName("baselineOffsetInLayoutManager:glyphIndex:");
-public static final long /*int*/ sel_becomeFirstResponder = sel_registerName("becomeFirstResponder");
-public static final long /*int*/ sel_becomeKeyWindow = sel_registerName("becomeKeyWindow");
-public static final long /*int*/ sel_beginDocument = sel_registerName("beginDocument");
-public static final long /*int*/ sel_beginEditing = sel_registerName("beginEditing");
-public static final long /*int*/ sel_beginGestureWithEvent_ = sel_registerName("beginGestureWithEvent:");
-public static final long /*int*/ sel_beginPageInRect_atPlacement_ = sel_registerName("beginPageInRect:atPlacement:");
-public static final long /*int*/ sel_beginSheet_modalForWindow_modalDelegate_didEndSelector_contextInfo_ = sel_registerName("beginSheet:modalForWindow:modalDelegate:didEndSelector:contextInfo:");
-public static final long /*int*/ sel_beginSheetForWindow_modalDelegate_didEndSelector_contextInfo_trust_message_ = sel_registerName("beginSheetForWindow:modalDelegate:didEndSelector:contextInfo:trust:message:");
-public static final long /*int*/ sel_beginSheetModalForWindow_modalDelegate_didEndSelector_contextInfo_ = sel_registerName("beginSheetModalForWindow:modalDelegate:didEndSelector:contextInfo:");
-public static final long /*int*/ sel_beginSheetWithPrintInfo_modalForWindow_delegate_didEndSelector_contextInfo_ = sel_registerName("beginSheetWithPrintInfo:modalForWindow:delegate:didEndSelector:contextInfo:");
-public static final long /*int*/ sel_bestRepresentationForDevice_ = sel_registerName("bestRepresentationForDevice:");
-public static final long /*int*/ sel_bezierPath = sel_registerName("bezierPath");
-public static final long /*int*/ sel_bezierPathByFlatteningPath = sel_registerName("bezierPathByFlatteningPath");
-public static final long /*int*/ sel_bezierPathWithRect_ = sel_registerName("bezierPathWithRect:");
-public static final long /*int*/ sel_bitmapData = sel_registerName("bitmapData");
-public static final long /*int*/ sel_bitmapFormat = sel_registerName("bitmapFormat");
-public static final long /*int*/ sel_bitsPerPixel = sel_registerName("bitsPerPixel");
-public static final long /*int*/ sel_bitsPerSample = sel_registerName("bitsPerSample");
-public static final long /*int*/ sel_blackColor = sel_registerName("blackColor");
-public static final long /*int*/ sel_blueComponent = sel_registerName("blueComponent");
-public static final long /*int*/ sel_boolValue = sel_registerName("boolValue");
-public static final long /*int*/ sel_borderWidth = sel_registerName("borderWidth");
-public static final long /*int*/ sel_boundingRectForGlyphRange_inTextContainer_ = sel_registerName("boundingRectForGlyphRange:inTextContainer:");
-public static final long /*int*/ sel_boundingRectWithSize_options_ = sel_registerName("boundingRectWithSize:options:");
-public static final long /*int*/ sel_bounds = sel_registerName("bounds");
-public static final long /*int*/ sel_bundleIdentifier = sel_registerName("bundleIdentifier");
-public static final long /*int*/ sel_bundlePath = sel_registerName("bundlePath");
-public static final long /*int*/ sel_bundleWithIdentifier_ = sel_registerName("bundleWithIdentifier:");
-public static final long /*int*/ sel_bundleWithPath_ = sel_registerName("bundleWithPath:");
-public static final long /*int*/ sel_button = sel_registerName("button");
-public static final long /*int*/ sel_buttonNumber = sel_registerName("buttonNumber");
-public static final long /*int*/ sel_bytes = sel_registerName("bytes");
-public static final long /*int*/ sel_bytesPerPlane = sel_registerName("bytesPerPlane");
-public static final long /*int*/ sel_bytesPerRow = sel_registerName("bytesPerRow");
-public static final long /*int*/ sel_calendarDate = sel_registerName("calendarDate");
-public static final long /*int*/ sel_canBecomeKeyView = sel_registerName("canBecomeKeyView");
-public static final long /*int*/ sel_canBecomeKeyWindow = sel_registerName("canBecomeKeyWindow");
-public static final long /*int*/ sel_canDragRowsWithIndexes_atPoint_ = sel_registerName("canDragRowsWithIndexes:atPoint:");
-public static final long /*int*/ sel_canGoBack = sel_registerName("canGoBack");
-public static final long /*int*/ sel_canGoForward = sel_registerName("canGoForward");
-public static final long /*int*/ sel_canRedo = sel_registerName("canRedo");
-public static final long /*int*/ sel_canShowMIMEType_ = sel_registerName("canShowMIMEType:");
-public static final long /*int*/ sel_canUndo = sel_registerName("canUndo");
-public static final long /*int*/ sel_cancel = sel_registerName("cancel");
-public static final long /*int*/ sel_cancelAuthenticationChallenge_ = sel_registerName("cancelAuthenticationChallenge:");
-public static final long /*int*/ sel_cancelButtonCell = sel_registerName("cancelButtonCell");
-public static final long /*int*/ sel_cancelOperation_ = sel_registerName("cancelOperation:");
-public static final long /*int*/ sel_cancelTracking = sel_registerName("cancelTracking");
-public static final long /*int*/ sel_cascadeTopLeftFromPoint_ = sel_registerName("cascadeTopLeftFromPoint:");
-public static final long /*int*/ sel_cell = sel_registerName("cell");
-public static final long /*int*/ sel_cellClass = sel_registerName("cellClass");
-public static final long /*int*/ sel_cellSize = sel_registerName("cellSize");
-public static final long /*int*/ sel_cellSizeForBounds_ = sel_registerName("cellSizeForBounds:");
-public static final long /*int*/ sel_changeColor_ = sel_registerName("changeColor:");
-public static final long /*int*/ sel_changeFont_ = sel_registerName("changeFont:");
-public static final long /*int*/ sel_charCode = sel_registerName("charCode");
-public static final long /*int*/ sel_characterAtIndex_ = sel_registerName("characterAtIndex:");
-public static final long /*int*/ sel_characterIndexForGlyphAtIndex_ = sel_registerName("characterIndexForGlyphAtIndex:");
-public static final long /*int*/ sel_characterIndexForInsertionAtPoint_ = sel_registerName("characterIndexForInsertionAtPoint:");
-public static final long /*int*/ sel_characterIndexForPoint_ = sel_registerName("characterIndexForPoint:");
-public static final long /*int*/ sel_characterIsMember_ = sel_registerName("characterIsMember:");
-public static final long /*int*/ sel_characters = sel_registerName("characters");
-public static final long /*int*/ sel_charactersIgnoringModifiers = sel_registerName("charactersIgnoringModifiers");
-public static final long /*int*/ sel_chooseFilename_ = sel_registerName("chooseFilename:");
-public static final long /*int*/ sel_className = sel_registerName("className");
-public static final long /*int*/ sel_cleanUpOperation = sel_registerName("cleanUpOperation");
-public static final long /*int*/ sel_clearColor = sel_registerName("clearColor");
-public static final long /*int*/ sel_clearCurrentContext = sel_registerName("clearCurrentContext");
-public static final long /*int*/ sel_clearDrawable = sel_registerName("clearDrawable");
-public static final long /*int*/ sel_clickCount = sel_registerName("clickCount");
-public static final long /*int*/ sel_clickedColumn = sel_registerName("clickedColumn");
-public static final long /*int*/ sel_clickedRow = sel_registerName("clickedRow");
-public static final long /*int*/ sel_close = sel_registerName("close");
-public static final long /*int*/ sel_closePath = sel_registerName("closePath");
-public static final long /*int*/ sel_code = sel_registerName("code");
-public static final long /*int*/ sel_collapseItem_ = sel_registerName("collapseItem:");
-public static final long /*int*/ sel_collapseItem_collapseChildren_ = sel_registerName("collapseItem:collapseChildren:");
-public static final long /*int*/ sel_collectionBehavior = sel_registerName("collectionBehavior");
-public static final long /*int*/ sel_color = sel_registerName("color");
-public static final long /*int*/ sel_colorAtX_y_ = sel_registerName("colorAtX:y:");
-public static final long /*int*/ sel_colorListNamed_ = sel_registerName("colorListNamed:");
-public static final long /*int*/ sel_colorSpace = sel_registerName("colorSpace");
-public static final long /*int*/ sel_colorSpaceModel = sel_registerName("colorSpaceModel");
-public static final long /*int*/ sel_colorSpaceName = sel_registerName("colorSpaceName");
-public static final long /*int*/ sel_colorUsingColorSpaceName_ = sel_registerName("colorUsingColorSpaceName:");
-public static final long /*int*/ sel_colorWithCalibratedRed_green_blue_alpha_ = sel_registerName("colorWithCalibratedRed:green:blue:alpha:");
-public static final long /*int*/ sel_colorWithDeviceRed_green_blue_alpha_ = sel_registerName("colorWithDeviceRed:green:blue:alpha:");
-public static final long /*int*/ sel_colorWithKey_ = sel_registerName("colorWithKey:");
-public static final long /*int*/ sel_colorWithPatternImage_ = sel_registerName("colorWithPatternImage:");
-public static final long /*int*/ sel_columnAtPoint_ = sel_registerName("columnAtPoint:");
-public static final long /*int*/ sel_columnIndexesInRect_ = sel_registerName("columnIndexesInRect:");
-public static final long /*int*/ sel_columnWithIdentifier_ = sel_registerName("columnWithIdentifier:");
-public static final long /*int*/ sel_comboBoxSelectionDidChange_ = sel_registerName("comboBoxSelectionDidChange:");
-public static final long /*int*/ sel_comboBoxWillDismiss_ = sel_registerName("comboBoxWillDismiss:");
-public static final long /*int*/ sel_comboBoxWillPopUp_ = sel_registerName("comboBoxWillPopUp:");
-public static final long /*int*/ sel_compare_ = sel_registerName("compare:");
-public static final long /*int*/ sel_concat = sel_registerName("concat");
-public static final long /*int*/ sel_conformsToProtocol_ = sel_registerName("conformsToProtocol:");
-public static final long /*int*/ sel_containerSize = sel_registerName("containerSize");
-public static final long /*int*/ sel_containsIndex_ = sel_registerName("containsIndex:");
-public static final long /*int*/ sel_containsObject_ = sel_registerName("containsObject:");
-public static final long /*int*/ sel_containsPoint_ = sel_registerName("containsPoint:");
-public static final long /*int*/ sel_contentRect = sel_registerName("contentRect");
-public static final long /*int*/ sel_contentSize = sel_registerName("contentSize");
-public static final long /*int*/ sel_contentSizeForFrameSize_hasHorizontalScroller_hasVerticalScroller_borderType_ = sel_registerName("contentSizeForFrameSize:hasHorizontalScroller:hasVerticalScroller:borderType:");
-public static final long /*int*/ sel_contentView = sel_registerName("contentView");
-public static final long /*int*/ sel_contentViewMargins = sel_registerName("contentViewMargins");
-public static final long /*int*/ sel_context = sel_registerName("context");
-public static final long /*int*/ sel_controlBackgroundColor = sel_registerName("controlBackgroundColor");
-public static final long /*int*/ sel_controlContentFontOfSize_ = sel_registerName("controlContentFontOfSize:");
-public static final long /*int*/ sel_controlDarkShadowColor = sel_registerName("controlDarkShadowColor");
-public static final long /*int*/ sel_controlHighlightColor = sel_registerName("controlHighlightColor");
-public static final long /*int*/ sel_controlLightHighlightColor = sel_registerName("controlLightHighlightColor");
-public static final long /*int*/ sel_controlPointBounds = sel_registerName("controlPointBounds");
-public static final long /*int*/ sel_controlShadowColor = sel_registerName("controlShadowColor");
-public static final long /*int*/ sel_controlSize = sel_registerName("controlSize");
-public static final long /*int*/ sel_controlTextColor = sel_registerName("controlTextColor");
-public static final long /*int*/ sel_convertBaseToScreen_ = sel_registerName("convertBaseToScreen:");
-public static final long /*int*/ sel_convertFont_toHaveTrait_ = sel_registerName("convertFont:toHaveTrait:");
-public static final long /*int*/ sel_convertPoint_fromView_ = sel_registerName("convertPoint:fromView:");
-public static final long /*int*/ sel_convertPoint_toView_ = sel_registerName("convertPoint:toView:");
-public static final long /*int*/ sel_convertPointFromBase_ = sel_registerName("convertPointFromBase:");
-public static final long /*int*/ sel_convertPointToBase_ = sel_registerName("convertPointToBase:");
-public static final long /*int*/ sel_convertRect_fromView_ = sel_registerName("convertRect:fromView:");
-public static final long /*int*/ sel_convertRect_toView_ = sel_registerName("convertRect:toView:");
-public static final long /*int*/ sel_convertRectFromBase_ = sel_registerName("convertRectFromBase:");
-public static final long /*int*/ sel_convertRectToBase_ = sel_registerName("convertRectToBase:");
-public static final long /*int*/ sel_convertScreenToBase_ = sel_registerName("convertScreenToBase:");
-public static final long /*int*/ sel_convertSize_fromView_ = sel_registerName("convertSize:fromView:");
-public static final long /*int*/ sel_convertSize_toView_ = sel_registerName("convertSize:toView:");
-public static final long /*int*/ sel_convertSizeFromBase_ = sel_registerName("convertSizeFromBase:");
-public static final long /*int*/ sel_convertSizeToBase_ = sel_registerName("convertSizeToBase:");
-public static final long /*int*/ sel_cookies = sel_registerName("cookies");
-public static final long /*int*/ sel_cookiesForURL_ = sel_registerName("cookiesForURL:");
-public static final long /*int*/ sel_cookiesWithResponseHeaderFields_forURL_ = sel_registerName("cookiesWithResponseHeaderFields:forURL:");
-public static final long /*int*/ sel_copiesOnScroll = sel_registerName("copiesOnScroll");
-public static final long /*int*/ sel_copy = sel_registerName("copy");
-public static final long /*int*/ sel_copy_ = sel_registerName("copy:");
-public static final long /*int*/ sel_count = sel_registerName("count");
-public static final long /*int*/ sel_createContext = sel_registerName("createContext");
-public static final long /*int*/ sel_createFileAtPath_contents_attributes_ = sel_registerName("createFileAtPath:contents:attributes:");
-public static final long /*int*/ sel_credentialWithUser_password_persistence_ = sel_registerName("credentialWithUser:password:persistence:");
-public static final long /*int*/ sel_crosshairCursor = sel_registerName("crosshairCursor");
-public static final long /*int*/ sel_ctrlKey = sel_registerName("ctrlKey");
-public static final long /*int*/ sel_currentContext = sel_registerName("currentContext");
-public static final long /*int*/ sel_currentCursor = sel_registerName("currentCursor");
-public static final long /*int*/ sel_currentEditor = sel_registerName("currentEditor");
-public static final long /*int*/ sel_currentEvent = sel_registerName("currentEvent");
-public static final long /*int*/ sel_currentHandler = sel_registerName("currentHandler");
-public static final long /*int*/ sel_currentInputManager = sel_registerName("currentInputManager");
-public static final long /*int*/ sel_currentPoint = sel_registerName("currentPoint");
-public static final long /*int*/ sel_currentRunLoop = sel_registerName("currentRunLoop");
-public static final long /*int*/ sel_currentThread = sel_registerName("currentThread");
-public static final long /*int*/ sel_cursorUpdate_ = sel_registerName("cursorUpdate:");
-public static final long /*int*/ sel_curveToPoint_controlPoint1_controlPoint2_ = sel_registerName("curveToPoint:controlPoint1:controlPoint2:");
-public static final long /*int*/ sel_cut_ = sel_registerName("cut:");
-public static final long /*int*/ sel_dataCell = sel_registerName("dataCell");
-public static final long /*int*/ sel_dataForType_ = sel_registerName("dataForType:");
-public static final long /*int*/ sel_dataSource = sel_registerName("dataSource");
-public static final long /*int*/ sel_dataWithBytes_length_ = sel_registerName("dataWithBytes:length:");
-public static final long /*int*/ sel_dateValue = sel_registerName("dateValue");
-public static final long /*int*/ sel_dateWithCalendarFormat_timeZone_ = sel_registerName("dateWithCalendarFormat:timeZone:");
-public static final long /*int*/ sel_dateWithTimeIntervalSinceNow_ = sel_registerName("dateWithTimeIntervalSinceNow:");
-public static final long /*int*/ sel_dateWithYear_month_day_hour_minute_second_timeZone_ = sel_registerName("dateWithYear:month:day:hour:minute:second:timeZone:");
-public static final long /*int*/ sel_dayOfMonth = sel_registerName("dayOfMonth");
-public static final long /*int*/ sel_dealloc = sel_registerName("dealloc");
-public static final long /*int*/ sel_decimalDigitCharacterSet = sel_registerName("decimalDigitCharacterSet");
-public static final long /*int*/ sel_decimalSeparator = sel_registerName("decimalSeparator");
-public static final long /*int*/ sel_declareTypes_owner_ = sel_registerName("declareTypes:owner:");
-public static final long /*int*/ sel_defaultBaselineOffsetForFont_ = sel_registerName("defaultBaselineOffsetForFont:");
-public static final long /*int*/ sel_defaultButtonCell = sel_registerName("defaultButtonCell");
-public static final long /*int*/ sel_defaultCenter = sel_registerName("defaultCenter");
-public static final long /*int*/ sel_defaultFlatness = sel_registerName("defaultFlatness");
-public static final long /*int*/ sel_defaultLineHeightForFont_ = sel_registerName("defaultLineHeightForFont:");
-public static final long /*int*/ sel_defaultManager = sel_registerName("defaultManager");
-public static final long /*int*/ sel_defaultParagraphStyle = sel_registerName("defaultParagraphStyle");
-public static final long /*int*/ sel_defaultPrinter = sel_registerName("defaultPrinter");
-public static final long /*int*/ sel_defaultTimeZone = sel_registerName("defaultTimeZone");
-public static final long /*int*/ sel_delegate = sel_registerName("delegate");
-public static final long /*int*/ sel_deleteCookie_ = sel_registerName("deleteCookie:");
-public static final long /*int*/ sel_deliverResult = sel_registerName("deliverResult");
-public static final long /*int*/ sel_deltaX = sel_registerName("deltaX");
-public static final long /*int*/ sel_deltaY = sel_registerName("deltaY");
-public static final long /*int*/ sel_deminiaturize_ = sel_registerName("deminiaturize:");
-public static final long /*int*/ sel_depth = sel_registerName("depth");
-public static final long /*int*/ sel_descender = sel_registerName("descender");
-public static final long /*int*/ sel_description = sel_registerName("description");
-public static final long /*int*/ sel_deselectAll_ = sel_registerName("deselectAll:");
-public static final long /*int*/ sel_deselectItemAtIndex_ = sel_registerName("deselectItemAtIndex:");
-public static final long /*int*/ sel_deselectRow_ = sel_registerName("deselectRow:");
-public static final long /*int*/ sel_destroyContext = sel_registerName("destroyContext");
-public static final long /*int*/ sel_detail = sel_registerName("detail");
-public static final long /*int*/ sel_device = sel_registerName("device");
-public static final long /*int*/ sel_deviceDescription = sel_registerName("deviceDescription");
-public static final long /*int*/ sel_deviceSize = sel_registerName("deviceSize");
-public static final long /*int*/ sel_dictionary = sel_registerName("dictionary");
-public static final long /*int*/ sel_dictionaryWithCapacity_ = sel_registerName("dictionaryWithCapacity:");
-public static final long /*int*/ sel_dictionaryWithObject_forKey_ = sel_registerName("dictionaryWithObject:forKey:");
-public static final long /*int*/ sel_disableCursorRects = sel_registerName("disableCursorRects");
-public static final long /*int*/ sel_disableFlushWindow = sel_registerName("disableFlushWindow");
-public static final long /*int*/ sel_disabledControlTextColor = sel_registerName("disabledControlTextColor");
-public static final long /*int*/ sel_discardCursorRects = sel_registerName("discardCursorRects");
-public static final long /*int*/ sel_display = sel_registerName("display");
-public static final long /*int*/ sel_displayIfNeeded = sel_registerName("displayIfNeeded");
-public static final long /*int*/ sel_displayName = sel_registerName("displayName");
-public static final long /*int*/ sel_displayNameForKey_value_ = sel_registerName("displayNameForKey:value:");
-public static final long /*int*/ sel_displayRectIgnoringOpacity_inContext_ = sel_registerName("displayRectIgnoringOpacity:inContext:");
-public static final long /*int*/ sel_distantFuture = sel_registerName("distantFuture");
-public static final long /*int*/ sel_doCommandBySelector_ = sel_registerName("doCommandBySelector:");
-public static final long /*int*/ sel_dockTile = sel_registerName("dockTile");
-public static final long /*int*/ sel_documentCursor = sel_registerName("documentCursor");
-public static final long /*int*/ sel_documentSource = sel_registerName("documentSource");
-public static final long /*int*/ sel_documentView = sel_registerName("documentView");
-public static final long /*int*/ sel_documentViewShouldHandlePrint = sel_registerName("documentViewShouldHandlePrint");
-public static final long /*int*/ sel_documentVisibleRect = sel_registerName("documentVisibleRect");
-public static final long /*int*/ sel_doubleClickAtIndex_ = sel_registerName("doubleClickAtIndex:");
-public static final long /*int*/ sel_doubleValue = sel_registerName("doubleValue");
-public static final long /*int*/ sel_download = sel_registerName("download");
-public static final long /*int*/ sel_download_decideDestinationWithSuggestedFilename_ = sel_registerName("download:decideDestinationWithSuggestedFilename:");
-public static final long /*int*/ sel_dragImage_at_offset_event_pasteboard_source_slideBack_ = sel_registerName("dragImage:at:offset:event:pasteboard:source:slideBack:");
-public static final long /*int*/ sel_dragImageForRowsWithIndexes_tableColumns_event_offset_ = sel_registerName("dragImageForRowsWithIndexes:tableColumns:event:offset:");
-public static final long /*int*/ sel_dragSelectionWithEvent_offset_slideBack_ = sel_registerName("dragSelectionWithEvent:offset:slideBack:");
-public static final long /*int*/ sel_draggedImage_beganAt_ = sel_registerName("draggedImage:beganAt:");
-public static final long /*int*/ sel_draggedImage_endedAt_operation_ = sel_registerName("draggedImage:endedAt:operation:");
-public static final long /*int*/ sel_draggingDestinationWindow = sel_registerName("draggingDestinationWindow");
-public static final long /*int*/ sel_draggingEnded_ = sel_registerName("draggingEnded:");
-public static final long /*int*/ sel_draggingEntered_ = sel_registerName("draggingEntered:");
-public static final long /*int*/ sel_draggingExited_ = sel_registerName("draggingExited:");
-public static final long /*int*/ sel_draggingLocation = sel_registerName("draggingLocation");
-public static final long /*int*/ sel_draggingPasteboard = sel_registerName("draggingPasteboard");
-public static final long /*int*/ sel_draggingSourceOperationMask = sel_registerName("draggingSourceOperationMask");
-public static final long /*int*/ sel_draggingSourceOperationMaskForLocal_ = sel_registerName("draggingSourceOperationMaskForLocal:");
-public static final long /*int*/ sel_draggingUpdated_ = sel_registerName("draggingUpdated:");
-public static final long /*int*/ sel_drawAtPoint_ = sel_registerName("drawAtPoint:");
-public static final long /*int*/ sel_drawAtPoint_fromRect_operation_fraction_ = sel_registerName("drawAtPoint:fromRect:operation:fraction:");
-public static final long /*int*/ sel_drawBackgroundForGlyphRange_atPoint_ = sel_registerName("drawBackgroundForGlyphRange:atPoint:");
-public static final long /*int*/ sel_drawBackgroundInClipRect_ = sel_registerName("drawBackgroundInClipRect:");
-public static final long /*int*/ sel_drawFromPoint_toPoint_options_ = sel_registerName("drawFromPoint:toPoint:options:");
-public static final long /*int*/ sel_drawGlyphsForGlyphRange_atPoint_ = sel_registerName("drawGlyphsForGlyphRange:atPoint:");
-public static final long /*int*/ sel_drawImage_withFrame_inView_ = sel_registerName("drawImage:withFrame:inView:");
-public static final long /*int*/ sel_drawInRect_ = sel_registerName("drawInRect:");
-public static final long /*int*/ sel_drawInRect_angle_ = sel_registerName("drawInRect:angle:");
-public static final long /*int*/ sel_drawInRect_fromRect_operation_fraction_ = sel_registerName("drawInRect:fromRect:operation:fraction:");
-public static final long /*int*/ sel_drawInteriorWithFrame_inView_ = sel_registerName("drawInteriorWithFrame:inView:");
-public static final long /*int*/ sel_drawLabel_inRect_ = sel_registerName("drawLabel:inRect:");
-public static final long /*int*/ sel_drawRect_ = sel_registerName("drawRect:");
-public static final long /*int*/ sel_drawSortIndicatorWithFrame_inView_ascending_priority_ = sel_registerName("drawSortIndicatorWithFrame:inView:ascending:priority:");
-public static final long /*int*/ sel_drawStatusBarBackgroundInRect_withHighlight_ = sel_registerName("drawStatusBarBackgroundInRect:withHighlight:");
-public static final long /*int*/ sel_drawTitle_withFrame_inView_ = sel_registerName("drawTitle:withFrame:inView:");
-public static final long /*int*/ sel_drawViewBackgroundInRect_ = sel_registerName("drawViewBackgroundInRect:");
-public static final long /*int*/ sel_drawWithExpansionFrame_inView_ = sel_registerName("drawWithExpansionFrame:inView:");
-public static final long /*int*/ sel_drawingRectForBounds_ = sel_registerName("drawingRectForBounds:");
-public static final long /*int*/ sel_elementAtIndex_associatedPoints_ = sel_registerName("elementAtIndex:associatedPoints:");
-public static final long /*int*/ sel_elementCount = sel_registerName("elementCount");
-public static final long /*int*/ sel_enableCursorRects = sel_registerName("enableCursorRects");
-public static final long /*int*/ sel_enableFlushWindow = sel_registerName("enableFlushWindow");
-public static final long /*int*/ sel_endDocument = sel_registerName("endDocument");
-public static final long /*int*/ sel_endEditing = sel_registerName("endEditing");
-public static final long /*int*/ sel_endEditingFor_ = sel_registerName("endEditingFor:");
-public static final long /*int*/ sel_endGestureWithEvent_ = sel_registerName("endGestureWithEvent:");
-public static final long /*int*/ sel_endPage = sel_registerName("endPage");
-public static final long /*int*/ sel_endSheet_returnCode_ = sel_registerName("endSheet:returnCode:");
-public static final long /*int*/ sel_enterExitEventWithType_location_modifierFlags_timestamp_windowNumber_context_eventNumber_trackingNumber_userData_ = sel_registerName("enterExitEventWithType:location:modifierFlags:timestamp:windowNumber:context:eventNumber:trackingNumber:userData:");
-public static final long /*int*/ sel_enumeratorAtPath_ = sel_registerName("enumeratorAtPath:");
-public static final long /*int*/ sel_expandItem_ = sel_registerName("expandItem:");
-public static final long /*int*/ sel_expandItem_expandChildren_ = sel_registerName("expandItem:expandChildren:");
-public static final long /*int*/ sel_expansionFrameWithFrame_inView_ = sel_registerName("expansionFrameWithFrame:inView:");
-public static final long /*int*/ sel_familyName = sel_registerName("familyName");
-public static final long /*int*/ sel_fieldEditor_forObject_ = sel_registerName("fieldEditor:forObject:");
-public static final long /*int*/ sel_fileExistsAtPath_ = sel_registerName("fileExistsAtPath:");
-public static final long /*int*/ sel_fileExistsAtPath_isDirectory_ = sel_registerName("fileExistsAtPath:isDirectory:");
-public static final long /*int*/ sel_fileSystemRepresentation = sel_registerName("fileSystemRepresentation");
-public static final long /*int*/ sel_fileURLWithPath_ = sel_registerName("fileURLWithPath:");
-public static final long /*int*/ sel_filename = sel_registerName("filename");
-public static final long /*int*/ sel_filenames = sel_registerName("filenames");
-public static final long /*int*/ sel_fill = sel_registerName("fill");
-public static final long /*int*/ sel_fillRect_ = sel_registerName("fillRect:");
-public static final long /*int*/ sel_finishLaunching = sel_registerName("finishLaunching");
-public static final long /*int*/ sel_firstIndex = sel_registerName("firstIndex");
-public static final long /*int*/ sel_firstRectForCharacterRange_ = sel_registerName("firstRectForCharacterRange:");
-public static final long /*int*/ sel_firstResponder = sel_registerName("firstResponder");
-public static final long /*int*/ sel_flagsChanged_ = sel_registerName("flagsChanged:");
-public static final long /*int*/ sel_floatValue = sel_registerName("floatValue");
-public static final long /*int*/ sel_flushBuffer = sel_registerName("flushBuffer");
-public static final long /*int*/ sel_flushGraphics = sel_registerName("flushGraphics");
-public static final long /*int*/ sel_flushWindowIfNeeded = sel_registerName("flushWindowIfNeeded");
-public static final long /*int*/ sel_font = sel_registerName("font");
-public static final long /*int*/ sel_fontName = sel_registerName("fontName");
-public static final long /*int*/ sel_fontWithFamily_traits_weight_size_ = sel_registerName("fontWithFamily:traits:weight:size:");
-public static final long /*int*/ sel_fontWithName_size_ = sel_registerName("fontWithName:size:");
-public static final long /*int*/ sel_frame = sel_registerName("frame");
-public static final long /*int*/ sel_frameOfCellAtColumn_row_ = sel_registerName("frameOfCellAtColumn:row:");
-public static final long /*int*/ sel_frameOfOutlineCellAtRow_ = sel_registerName("frameOfOutlineCellAtRow:");
-public static final long /*int*/ sel_frameRectForContentRect_ = sel_registerName("frameRectForContentRect:");
-public static final long /*int*/ sel_frameSizeForContentSize_hasHorizontalScroller_hasVerticalScroller_borderType_ = sel_registerName("frameSizeForContentSize:hasHorizontalScroller:hasVerticalScroller:borderType:");
-public static final long /*int*/ sel_fullPathForApplication_ = sel_registerName("fullPathForApplication:");
-public static final long /*int*/ sel_generalPasteboard = sel_registerName("generalPasteboard");
-public static final long /*int*/ sel_genericRGBColorSpace = sel_registerName("genericRGBColorSpace");
-public static final long /*int*/ sel_getBitmapDataPlanes_ = sel_registerName("getBitmapDataPlanes:");
-public static final long /*int*/ sel_getBytes_ = sel_registerName("getBytes:");
-public static final long /*int*/ sel_getBytes_length_ = sel_registerName("getBytes:length:");
-public static final long /*int*/ sel_getCharacters_ = sel_registerName("getCharacters:");
-public static final long /*int*/ sel_getCharacters_range_ = sel_registerName("getCharacters:range:");
-public static final long /*int*/ sel_getComponents_ = sel_registerName("getComponents:");
-public static final long /*int*/ sel_getGlyphs_range_ = sel_registerName("getGlyphs:range:");
-public static final long /*int*/ sel_getGlyphsInRange_glyphs_characterIndexes_glyphInscriptions_elasticBits_bidiLevels_ = sel_registerName("getGlyphsInRange:glyphs:characterIndexes:glyphInscriptions:elasticBits:bidiLevels:");
-public static final long /*int*/ sel_getIndexes_maxCount_inIndexRange_ = sel_registerName("getIndexes:maxCount:inIndexRange:");
-public static final long /*int*/ sel_getInfoForFile_application_type_ = sel_registerName("getInfoForFile:application:type:");
-public static final long /*int*/ sel_getValues_forAttribute_forVirtualScreen_ = sel_registerName("getValues:forAttribute:forVirtualScreen:");
-public static final long /*int*/ sel_globalContext = sel_registerName("globalContext");
-public static final long /*int*/ sel_glyphIndexForCharacterAtIndex_ = sel_registerName("glyphIndexForCharacterAtIndex:");
-public static final long /*int*/ sel_glyphIndexForPoint_inTextContainer_fractionOfDistanceThroughGlyph_ = sel_registerName("glyphIndexForPoint:inTextContainer:fractionOfDistanceThroughGlyph:");
-public static final long /*int*/ sel_glyphRangeForCharacterRange_actualCharacterRange_ = sel_registerName("glyphRangeForCharacterRange:actualCharacterRange:");
-public static final long /*int*/ sel_glyphRangeForTextContainer_ = sel_registerName("glyphRangeForTextContainer:");
-public static final long /*int*/ sel_goBack = sel_registerName("goBack");
-public static final long /*int*/ sel_goForward = sel_registerName("goForward");
-public static final long /*int*/ sel_graphicsContext = sel_registerName("graphicsContext");
-public static final long /*int*/ sel_graphicsContextWithBitmapImageRep_ = sel_registerName("graphicsContextWithBitmapImageRep:");
-public static final long /*int*/ sel_graphicsContextWithGraphicsPort_flipped_ = sel_registerName("graphicsContextWithGraphicsPort:flipped:");
-public static final long /*int*/ sel_graphicsContextWithWindow_ = sel_registerName("graphicsContextWithWindow:");
-public static final long /*int*/ sel_graphicsPort = sel_registerName("graphicsPort");
-public static final long /*int*/ sel_greenComponent = sel_registerName("greenComponent");
-public static final long /*int*/ sel_handleEvent_ = sel_registerName("handleEvent:");
-public static final long /*int*/ sel_handleFailureInFunction_file_lineNumber_description_ = sel_registerName("handleFailureInFunction:file:lineNumber:description:");
-public static final long /*int*/ sel_handleFailureInMethod_object_file_lineNumber_description_ = sel_registerName("handleFailureInMethod:object:file:lineNumber:description:");
-public static final long /*int*/ sel_handleMouseEvent_ = sel_registerName("handleMouseEvent:");
-public static final long /*int*/ sel_hasAlpha = sel_registerName("hasAlpha");
-public static final long /*int*/ sel_hasMarkedText = sel_registerName("hasMarkedText");
-public static final long /*int*/ sel_hasPassword = sel_registerName("hasPassword");
-public static final long /*int*/ sel_hasShadow = sel_registerName("hasShadow");
-public static final long /*int*/ sel_headerCell = sel_registerName("headerCell");
-public static final long /*int*/ sel_headerRectOfColumn_ = sel_registerName("headerRectOfColumn:");
-public static final long /*int*/ sel_headerView = sel_registerName("headerView");
-public static final long /*int*/ sel_helpRequested_ = sel_registerName("helpRequested:");
-public static final long /*int*/ sel_hide_ = sel_registerName("hide:");
-public static final long /*int*/ sel_hideOtherApplications_ = sel_registerName("hideOtherApplications:");
-public static final long /*int*/ sel_highlightColorInView_ = sel_registerName("highlightColorInView:");
-public static final long /*int*/ sel_highlightColorWithFrame_inView_ = sel_registerName("highlightColorWithFrame:inView:");
-public static final long /*int*/ sel_highlightSelectionInClipRect_ = sel_registerName("highlightSelectionInClipRect:");
-public static final long /*int*/ sel_hitPart = sel_registerName("hitPart");
-public static final long /*int*/ sel_hitTest_ = sel_registerName("hitTest:");
-public static final long /*int*/ sel_hitTestForEvent_inRect_ofView_ = sel_registerName("hitTestForEvent:inRect:ofView:");
-public static final long /*int*/ sel_host = sel_registerName("host");
-public static final long /*int*/ sel_hotSpot = sel_registerName("hotSpot");
-public static final long /*int*/ sel_hourOfDay = sel_registerName("hourOfDay");
-public static final long /*int*/ sel_iconForFile_ = sel_registerName("iconForFile:");
-public static final long /*int*/ sel_iconForFileType_ = sel_registerName("iconForFileType:");
-public static final long /*int*/ sel_ignore = sel_registerName("ignore");
-public static final long /*int*/ sel_ignoreModifierKeysWhileDragging = sel_registerName("ignoreModifierKeysWhileDragging");
-public static final long /*int*/ sel_image = sel_registerName("image");
-public static final long /*int*/ sel_imageInterpolation = sel_registerName("imageInterpolation");
-public static final long /*int*/ sel_imageNamed_ = sel_registerName("imageNamed:");
-public static final long /*int*/ sel_imageRectForBounds_ = sel_registerName("imageRectForBounds:");
-public static final long /*int*/ sel_imageRepWithData_ = sel_registerName("imageRepWithData:");
-public static final long /*int*/ sel_imageablePageBounds = sel_registerName("imageablePageBounds");
-public static final long /*int*/ sel_increment = sel_registerName("increment");
-public static final long /*int*/ sel_indentationPerLevel = sel_registerName("indentationPerLevel");
-public static final long /*int*/ sel_indexOfItemWithTarget_andAction_ = sel_registerName("indexOfItemWithTarget:andAction:");
-public static final long /*int*/ sel_indexOfObjectIdenticalTo_ = sel_registerName("indexOfObjectIdenticalTo:");
-public static final long /*int*/ sel_indexOfSelectedItem = sel_registerName("indexOfSelectedItem");
-public static final long /*int*/ sel_indexSetWithIndex_ = sel_registerName("indexSetWithIndex:");
-public static final long /*int*/ sel_infoDictionary = sel_registerName("infoDictionary");
-public static final long /*int*/ sel_init = sel_registerName("init");
-public static final long /*int*/ sel_initByReferencingFile_ = sel_registerName("initByReferencingFile:");
-public static final long /*int*/ sel_initListDescriptor = sel_registerName("initListDescriptor");
-public static final long /*int*/ sel_initWithAttributes_ = sel_registerName("initWithAttributes:");
-public static final long /*int*/ sel_initWithBitmapDataPlanes_pixelsWide_pixelsHigh_bitsPerSample_samplesPerPixel_hasAlpha_isPlanar_colorSpaceName_bitmapFormat_bytesPerRow_bitsPerPixel_ = sel_registerName("initWithBitmapDataPlanes:pixelsWide:pixelsHigh:bitsPerSample:samplesPerPixel:hasAlpha:isPlanar:colorSpaceName:bitmapFormat:bytesPerRow:bitsPerPixel:");
-public static final long /*int*/ sel_initWithBitmapDataPlanes_pixelsWide_pixelsHigh_bitsPerSample_samplesPerPixel_hasAlpha_isPlanar_colorSpaceName_bytesPerRow_bitsPerPixel_ = sel_registerName("initWithBitmapDataPlanes:pixelsWide:pixelsHigh:bitsPerSample:samplesPerPixel:hasAlpha:isPlanar:colorSpaceName:bytesPerRow:bitsPerPixel:");
-public static final long /*int*/ sel_initWithCapacity_ = sel_registerName("initWithCapacity:");
-public static final long /*int*/ sel_initWithCharacters_length_ = sel_registerName("initWithCharacters:length:");
-public static final long /*int*/ sel_initWithContainerSize_ = sel_registerName("initWithContainerSize:");
-public static final long /*int*/ sel_initWithContentRect_styleMask_backing_defer_ = sel_registerName("initWithContentRect:styleMask:backing:defer:");
-public static final long /*int*/ sel_initWithContentRect_styleMask_backing_defer_screen_ = sel_registerName("initWithContentRect:styleMask:backing:defer:screen:");
-public static final long /*int*/ sel_initWithContentsOfFile_ = sel_registerName("initWithContentsOfFile:");
-public static final long /*int*/ sel_initWithData_ = sel_registerName("initWithData:");
-public static final long /*int*/ sel_initWithDictionary_ = sel_registerName("initWithDictionary:");
-public static final long /*int*/ sel_initWithFileWrapper_ = sel_registerName("initWithFileWrapper:");
-public static final long /*int*/ sel_initWithFocusedViewRect_ = sel_registerName("initWithFocusedViewRect:");
-public static final long /*int*/ sel_initWithFormat_shareContext_ = sel_registerName("initWithFormat:shareContext:");
-public static final long /*int*/ sel_initWithFrame_ = sel_registerName("initWithFrame:");
-public static final long /*int*/ sel_initWithFrame_frameName_groupName_ = sel_registerName("initWithFrame:frameName:groupName:");
-public static final long /*int*/ sel_initWithFrame_pullsDown_ = sel_registerName("initWithFrame:pullsDown:");
-public static final long /*int*/ sel_initWithIconRef_ = sel_registerName("initWithIconRef:");
-public static final long /*int*/ sel_initWithIdentifier_ = sel_registerName("initWithIdentifier:");
-public static final long /*int*/ sel_initWithImage_hotSpot_ = sel_registerName("initWithImage:hotSpot:");
-public static final long /*int*/ sel_initWithIndex_ = sel_registerName("initWithIndex:");
-public static final long /*int*/ sel_initWithIndexSet_ = sel_registerName("initWithIndexSet:");
-public static final long /*int*/ sel_initWithIndexesInRange_ = sel_registerName("initWithIndexesInRange:");
-public static final long /*int*/ sel_initWithItemIdentifier_ = sel_registerName("initWithItemIdentifier:");
-public static final long /*int*/ sel_initWithLocaleIdentifier_ = sel_registerName("initWithLocaleIdentifier:");
-public static final long /*int*/ sel_initWithName_ = sel_registerName("initWithName:");
-public static final long /*int*/ sel_initWithRect_options_owner_userInfo_ = sel_registerName("initWithRect:options:owner:userInfo:");
-public static final long /*int*/ sel_initWithSize_ = sel_registerName("initWithSize:");
-public static final long /*int*/ sel_initWithStartingColor_endingColor_ = sel_registerName("initWithStartingColor:endingColor:");
-public static final long /*int*/ sel_initWithString_ = sel_registerName("initWithString:");
-public static final long /*int*/ sel_initWithString_attributes_ = sel_registerName("initWithString:attributes:");
-public static final long /*int*/ sel_initWithTitle_ = sel_registerName("initWithTitle:");
-public static final long /*int*/ sel_initWithTitle_action_keyEquivalent_ = sel_registerName("initWithTitle:action:keyEquivalent:");
-public static final long /*int*/ sel_initWithTransform_ = sel_registerName("initWithTransform:");
-public static final long /*int*/ sel_initWithType_location_ = sel_registerName("initWithType:location:");
-public static final long /*int*/ sel_initWithURL_ = sel_registerName("initWithURL:");
-public static final long /*int*/ sel_insertColor_key_atIndex_ = sel_registerName("insertColor:key:atIndex:");
-public static final long /*int*/ sel_insertItem_atIndex_ = sel_registerName("insertItem:atIndex:");
-public static final long /*int*/ sel_insertItemWithItemIdentifier_atIndex_ = sel_registerName("insertItemWithItemIdentifier:atIndex:");
-public static final long /*int*/ sel_insertItemWithObjectValue_atIndex_ = sel_registerName("insertItemWithObjectValue:atIndex:");
-public static final long /*int*/ sel_insertTabViewItem_atIndex_ = sel_registerName("insertTabViewItem:atIndex:");
-public static final long /*int*/ sel_insertText_ = sel_registerName("insertText:");
-public static final long /*int*/ sel_intValue = sel_registerName("intValue");
-public static final long /*int*/ sel_integerValue = sel_registerName("integerValue");
-public static final long /*int*/ sel_intercellSpacing = sel_registerName("intercellSpacing");
-public static final long /*int*/ sel_interpretKeyEvents_ = sel_registerName("interpretKeyEvents:");
-public static final long /*int*/ sel_invalidate = sel_registerName("invalidate");
-public static final long /*int*/ sel_invalidateShadow = sel_registerName("invalidateShadow");
-public static final long /*int*/ sel_invert = sel_registerName("invert");
-public static final long /*int*/ sel_isActive = sel_registerName("isActive");
-public static final long /*int*/ sel_isDescendantOf_ = sel_registerName("isDescendantOf:");
-public static final long /*int*/ sel_isDocumentEdited = sel_registerName("isDocumentEdited");
-public static final long /*int*/ sel_isDrawingToScreen = sel_registerName("isDrawingToScreen");
-public static final long /*int*/ sel_isEmpty = sel_registerName("isEmpty");
-public static final long /*int*/ sel_isEnabled = sel_registerName("isEnabled");
-public static final long /*int*/ sel_isEqual_ = sel_registerName("isEqual:");
-public static final long /*int*/ sel_isEqualTo_ = sel_registerName("isEqualTo:");
-public static final long /*int*/ sel_isEqualToString_ = sel_registerName("isEqualToString:");
-public static final long /*int*/ sel_isExecutableFileAtPath_ = sel_registerName("isExecutableFileAtPath:");
-public static final long /*int*/ sel_isFieldEditor = sel_registerName("isFieldEditor");
-public static final long /*int*/ sel_isFilePackageAtPath_ = sel_registerName("isFilePackageAtPath:");
-public static final long /*int*/ sel_isFileURL = sel_registerName("isFileURL");
-public static final long /*int*/ sel_isFlipped = sel_registerName("isFlipped");
-public static final long /*int*/ sel_isHidden = sel_registerName("isHidden");
-public static final long /*int*/ sel_isHiddenOrHasHiddenAncestor = sel_registerName("isHiddenOrHasHiddenAncestor");
-public static final long /*int*/ sel_isHighlighted = sel_registerName("isHighlighted");
-public static final long /*int*/ sel_isItemExpanded_ = sel_registerName("isItemExpanded:");
-public static final long /*int*/ sel_isKeyWindow = sel_registerName("isKeyWindow");
-public static final long /*int*/ sel_isKindOfClass_ = sel_registerName("isKindOfClass:");
-public static final long /*int*/ sel_isMainThread = sel_registerName("isMainThread");
-public static final long /*int*/ sel_isMainWindow = sel_registerName("isMainWindow");
-public static final long /*int*/ sel_isMiniaturized = sel_registerName("isMiniaturized");
-public static final long /*int*/ sel_isOpaque = sel_registerName("isOpaque");
-public static final long /*int*/ sel_isPlanar = sel_registerName("isPlanar");
-public static final long /*int*/ sel_isResting = sel_registerName("isResting");
-public static final long /*int*/ sel_isRowSelected_ = sel_registerName("isRowSelected:");
-public static final long /*int*/ sel_isRunning = sel_registerName("isRunning");
-public static final long /*int*/ sel_isSeparatorItem = sel_registerName("isSeparatorItem");
-public static final long /*int*/ sel_isSessionOnly = sel_registerName("isSessionOnly");
-public static final long /*int*/ sel_isSheet = sel_registerName("isSheet");
-public static final long /*int*/ sel_isVisible = sel_registerName("isVisible");
-public static final long /*int*/ sel_isZoomed = sel_registerName("isZoomed");
-public static final long /*int*/ sel_itemArray = sel_registerName("itemArray");
-public static final long /*int*/ sel_itemAtIndex_ = sel_registerName("itemAtIndex:");
-public static final long /*int*/ sel_itemAtRow_ = sel_registerName("itemAtRow:");
-public static final long /*int*/ sel_itemHeight = sel_registerName("itemHeight");
-public static final long /*int*/ sel_itemIdentifier = sel_registerName("itemIdentifier");
-public static final long /*int*/ sel_itemObjectValueAtIndex_ = sel_registerName("itemObjectValueAtIndex:");
-public static final long /*int*/ sel_itemTitleAtIndex_ = sel_registerName("itemTitleAtIndex:");
-public static final long /*int*/ sel_itemWithTag_ = sel_registerName("itemWithTag:");
-public static final long /*int*/ sel_jobDisposition = sel_registerName("jobDisposition");
-public static final long /*int*/ sel_keyCode = sel_registerName("keyCode");
-public static final long /*int*/ sel_keyDown_ = sel_registerName("keyDown:");
-public static final long /*int*/ sel_keyEquivalent = sel_registerName("keyEquivalent");
-public static final long /*int*/ sel_keyEquivalentModifierMask = sel_registerName("keyEquivalentModifierMask");
-public static final long /*int*/ sel_keyUp_ = sel_registerName("keyUp:");
-public static final long /*int*/ sel_keyWindow = sel_registerName("keyWindow");
-public static final long /*int*/ sel_knobProportion = sel_registerName("knobProportion");
-public static final long /*int*/ sel_knobThickness = sel_registerName("knobThickness");
-public static final long /*int*/ sel_lastPathComponent = sel_registerName("lastPathComponent");
-public static final long /*int*/ sel_layoutManager = sel_registerName("layoutManager");
-public static final long /*int*/ sel_leading = sel_registerName("leading");
-public static final long /*int*/ sel_length = sel_registerName("length");
-public static final long /*int*/ sel_level = sel_registerName("level");
-public static final long /*int*/ sel_levelForItem_ = sel_registerName("levelForItem:");
-public static final long /*int*/ sel_lineFragmentUsedRectForGlyphAtIndex_effectiveRange_ = sel_registerName("lineFragmentUsedRectForGlyphAtIndex:effectiveRange:");
-public static final long /*int*/ sel_lineFragmentUsedRectForGlyphAtIndex_effectiveRange_withoutAdditionalLayout_ = sel_registerName("lineFragmentUsedRectForGlyphAtIndex:effectiveRange:withoutAdditionalLayout:");
-public static final long /*int*/ sel_lineToPoint_ = sel_registerName("lineToPoint:");
-public static final long /*int*/ sel_linkTextAttributes = sel_registerName("linkTextAttributes");
-public static final long /*int*/ sel_loadHTMLString_baseURL_ = sel_registerName("loadHTMLString:baseURL:");
-public static final long /*int*/ sel_loadNibFile_externalNameTable_withZone_ = sel_registerName("loadNibFile:externalNameTable:withZone:");
-public static final long /*int*/ sel_loadRequest_ = sel_registerName("loadRequest:");
-public static final long /*int*/ sel_localizedDescription = sel_registerName("localizedDescription");
-public static final long /*int*/ sel_location = sel_registerName("location");
-public static final long /*int*/ sel_locationForGlyphAtIndex_ = sel_registerName("locationForGlyphAtIndex:");
-public static final long /*int*/ sel_locationInWindow = sel_registerName("locationInWindow");
-public static final long /*int*/ sel_lockFocus = sel_registerName("lockFocus");
-public static final long /*int*/ sel_lowercaseString = sel_registerName("lowercaseString");
-public static final long /*int*/ sel_magnification = sel_registerName("magnification");
-public static final long /*int*/ sel_magnifyWithEvent_ = sel_registerName("magnifyWithEvent:");
-public static final long /*int*/ sel_mainBundle = sel_registerName("mainBundle");
-public static final long /*int*/ sel_mainFrame = sel_registerName("mainFrame");
-public static final long /*int*/ sel_mainMenu = sel_registerName("mainMenu");
-public static final long /*int*/ sel_mainRunLoop = sel_registerName("mainRunLoop");
-public static final long /*int*/ sel_mainScreen = sel_registerName("mainScreen");
-public static final long /*int*/ sel_mainWindow = sel_registerName("mainWindow");
-public static final long /*int*/ sel_makeCurrentContext = sel_registerName("makeCurrentContext");
-public static final long /*int*/ sel_makeFirstResponder_ = sel_registerName("makeFirstResponder:");
-public static final long /*int*/ sel_makeKeyAndOrderFront_ = sel_registerName("makeKeyAndOrderFront:");
-public static final long /*int*/ sel_markedRange = sel_registerName("markedRange");
-public static final long /*int*/ sel_markedTextAttributes = sel_registerName("markedTextAttributes");
-public static final long /*int*/ sel_maxValue = sel_registerName("maxValue");
-public static final long /*int*/ sel_maximum = sel_registerName("maximum");
-public static final long /*int*/ sel_maximumFractionDigits = sel_registerName("maximumFractionDigits");
-public static final long /*int*/ sel_maximumIntegerDigits = sel_registerName("maximumIntegerDigits");
-public static final long /*int*/ sel_menu = sel_registerName("menu");
-public static final long /*int*/ sel_menu_willHighlightItem_ = sel_registerName("menu:willHighlightItem:");
-public static final long /*int*/ sel_menuBarFontOfSize_ = sel_registerName("menuBarFontOfSize:");
-public static final long /*int*/ sel_menuDidClose_ = sel_registerName("menuDidClose:");
-public static final long /*int*/ sel_menuFontOfSize_ = sel_registerName("menuFontOfSize:");
-public static final long /*int*/ sel_menuForEvent_ = sel_registerName("menuForEvent:");
-public static final long /*int*/ sel_menuNeedsUpdate_ = sel_registerName("menuNeedsUpdate:");
-public static final long /*int*/ sel_menuWillOpen_ = sel_registerName("menuWillOpen:");
-public static final long /*int*/ sel_metaKey = sel_registerName("metaKey");
-public static final long /*int*/ sel_minFrameWidthWithTitle_styleMask_ = sel_registerName("minFrameWidthWithTitle:styleMask:");
-public static final long /*int*/ sel_minSize = sel_registerName("minSize");
-public static final long /*int*/ sel_minValue = sel_registerName("minValue");
-public static final long /*int*/ sel_miniaturize_ = sel_registerName("miniaturize:");
-public static final long /*int*/ sel_minimum = sel_registerName("minimum");
-public static final long /*int*/ sel_minimumSize = sel_registerName("minimumSize");
-public static final long /*int*/ sel_minuteOfHour = sel_registerName("minuteOfHour");
-public static final long /*int*/ sel_modifierFlags = sel_registerName("modifierFlags");
-public static final long /*int*/ sel_monthOfYear = sel_registerName("monthOfYear");
-public static final long /*int*/ sel_mouse_inRect_ = sel_registerName("mouse:inRect:");
-public static final long /*int*/ sel_mouseDown_ = sel_registerName("mouseDown:");
-public static final long /*int*/ sel_mouseDownCanMoveWindow = sel_registerName("mouseDownCanMoveWindow");
-public static final long /*int*/ sel_mouseDragged_ = sel_registerName("mouseDragged:");
-public static final long /*int*/ sel_mouseEntered_ = sel_registerName("mouseEntered:");
-public static final long /*int*/ sel_mouseExited_ = sel_registerName("mouseExited:");
-public static final long /*int*/ sel_mouseLocation = sel_registerName("mouseLocation");
-public static final long /*int*/ sel_mouseLocationOutsideOfEventStream = sel_registerName("mouseLocationOutsideOfEventStream");
-public static final long /*int*/ sel_mouseMoved_ = sel_registerName("mouseMoved:");
-public static final long /*int*/ sel_mouseUp_ = sel_registerName("mouseUp:");
-public static final long /*int*/ sel_moveColumn_toColumn_ = sel_registerName("moveColumn:toColumn:");
-public static final long /*int*/ sel_moveToBeginningOfParagraph_ = sel_registerName("moveToBeginningOfParagraph:");
-public static final long /*int*/ sel_moveToEndOfParagraph_ = sel_registerName("moveToEndOfParagraph:");
-public static final long /*int*/ sel_moveToPoint_ = sel_registerName("moveToPoint:");
-public static final long /*int*/ sel_moveUp_ = sel_registerName("moveUp:");
-public static final long /*int*/ sel_mutableCopy = sel_registerName("mutableCopy");
-public static final long /*int*/ sel_mutableString = sel_registerName("mutableString");
-public static final long /*int*/ sel_name = sel_registerName("name");
-public static final long /*int*/ sel_needsPanelToBecomeKey = sel_registerName("needsPanelToBecomeKey");
-public static final long /*int*/ sel_nextEventMatchingMask_untilDate_inMode_dequeue_ = sel_registerName("nextEventMatchingMask:untilDate:inMode:dequeue:");
-public static final long /*int*/ sel_nextObject = sel_registerName("nextObject");
-public static final long /*int*/ sel_nextState = sel_registerName("nextState");
-public static final long /*int*/ sel_nextWordFromIndex_forward_ = sel_registerName("nextWordFromIndex:forward:");
-public static final long /*int*/ sel_noResponderFor_ = sel_registerName("noResponderFor:");
-public static final long /*int*/ sel_normalizedPosition = sel_registerName("normalizedPosition");
-public static final long /*int*/ sel_noteNumberOfRowsChanged = sel_registerName("noteNumberOfRowsChanged");
-public static final long /*int*/ sel_numberOfColumns = sel_registerName("numberOfColumns");
-public static final long /*int*/ sel_numberOfComponents = sel_registerName("numberOfComponents");
-public static final long /*int*/ sel_numberOfGlyphs = sel_registerName("numberOfGlyphs");
-public static final long /*int*/ sel_numberOfItems = sel_registerName("numberOfItems");
-public static final long /*int*/ sel_numberOfPlanes = sel_registerName("numberOfPlanes");
-public static final long /*int*/ sel_numberOfRows = sel_registerName("numberOfRows");
-public static final long /*int*/ sel_numberOfRowsInTableView_ = sel_registerName("numberOfRowsInTableView:");
-public static final long /*int*/ sel_numberOfSelectedRows = sel_registerName("numberOfSelectedRows");
-public static final long /*int*/ sel_numberOfVisibleItems = sel_registerName("numberOfVisibleItems");
-public static final long /*int*/ sel_numberWithBool_ = sel_registerName("numberWithBool:");
-public static final long /*int*/ sel_numberWithDouble_ = sel_registerName("numberWithDouble:");
-public static final long /*int*/ sel_numberWithInt_ = sel_registerName("numberWithInt:");
-public static final long /*int*/ sel_numberWithInteger_ = sel_registerName("numberWithInteger:");
-public static final long /*int*/ sel_objCType = sel_registerName("objCType");
-public static final long /*int*/ sel_object = sel_registerName("object");
-public static final long /*int*/ sel_objectAtIndex_ = sel_registerName("objectAtIndex:");
-public static final long /*int*/ sel_objectEnumerator = sel_registerName("objectEnumerator");
-public static final long /*int*/ sel_objectForInfoDictionaryKey_ = sel_registerName("objectForInfoDictionaryKey:");
-public static final long /*int*/ sel_objectForKey_ = sel_registerName("objectForKey:");
-public static final long /*int*/ sel_objectValues = sel_registerName("objectValues");
-public static final long /*int*/ sel_openFile_withApplication_ = sel_registerName("openFile:withApplication:");
-public static final long /*int*/ sel_openPanel = sel_registerName("openPanel");
-public static final long /*int*/ sel_openURL_ = sel_registerName("openURL:");
-public static final long /*int*/ sel_openURLs_withAppBundleIdentifier_options_additionalEventParamDescriptor_launchIdentifiers_ = sel_registerName("openURLs:withAppBundleIdentifier:options:additionalEventParamDescriptor:launchIdentifiers:");
-public static final long /*int*/ sel_operationNotAllowedCursor = sel_registerName("operationNotAllowedCursor");
-public static final long /*int*/ sel_options = sel_registerName("options");
-public static final long /*int*/ sel_orderBack_ = sel_registerName("orderBack:");
-public static final long /*int*/ sel_orderFront_ = sel_registerName("orderFront:");
-public static final long /*int*/ sel_orderFrontRegardless = sel_registerName("orderFrontRegardless");
-public static final long /*int*/ sel_orderFrontStandardAboutPanel_ = sel_registerName("orderFrontStandardAboutPanel:");
-public static final long /*int*/ sel_orderOut_ = sel_registerName("orderOut:");
-public static final long /*int*/ sel_orderWindow_relativeTo_ = sel_registerName("orderWindow:relativeTo:");
-public static final long /*int*/ sel_orderedWindows = sel_registerName("orderedWindows");
-public static final long /*int*/ sel_otherEventWithType_location_modifierFlags_timestamp_windowNumber_context_subtype_data1_data2_ = sel_registerName("otherEventWithType:location:modifierFlags:timestamp:windowNumber:context:subtype:data1:data2:");
-public static final long /*int*/ sel_otherMouseDown_ = sel_registerName("otherMouseDown:");
-public static final long /*int*/ sel_otherMouseDragged_ = sel_registerName("otherMouseDragged:");
-public static final long /*int*/ sel_otherMouseUp_ = sel_registerName("otherMouseUp:");
-public static final long /*int*/ sel_outlineTableColumn = sel_registerName("outlineTableColumn");
-public static final long /*int*/ sel_outlineView_acceptDrop_item_childIndex_ = sel_registerName("outlineView:acceptDrop:item:childIndex:");
-public static final long /*int*/ sel_outlineView_child_ofItem_ = sel_registerName("outlineView:child:ofItem:");
-public static final long /*int*/ sel_outlineView_didClickTableColumn_ = sel_registerName("outlineView:didClickTableColumn:");
-public static final long /*int*/ sel_outlineView_isItemExpandable_ = sel_registerName("outlineView:isItemExpandable:");
-public static final long /*int*/ sel_outlineView_numberOfChildrenOfItem_ = sel_registerName("outlineView:numberOfChildrenOfItem:");
-public static final long /*int*/ sel_outlineView_objectValueForTableColumn_byItem_ = sel_registerName("outlineView:objectValueForTableColumn:byItem:");
-public static final long /*int*/ sel_outlineView_setObjectValue_forTableColumn_byItem_ = sel_registerName("outlineView:setObjectValue:forTableColumn:byItem:");
-public static final long /*int*/ sel_outlineView_shouldCollapseItem_ = sel_registerName("outlineView:shouldCollapseItem:");
-public static final long /*int*/ sel_outlineView_shouldEditTableColumn_item_ = sel_registerName("outlineView:shouldEditTableColumn:item:");
-public static final long /*int*/ sel_outlineView_shouldExpandItem_ = sel_registerName("outlineView:shouldExpandItem:");
-public static final long /*int*/ sel_outlineView_shouldReorderColumn_toColumn_ = sel_registerName("outlineView:shouldReorderColumn:toColumn:");
-public static final long /*int*/ sel_outlineView_shouldSelectItem_ = sel_registerName("outlineView:shouldSelectItem:");
-public static final long /*int*/ sel_outlineView_shouldTrackCell_forTableColumn_item_ = sel_registerName("outlineView:shouldTrackCell:forTableColumn:item:");
-public static final long /*int*/ sel_outlineView_validateDrop_proposedItem_proposedChildIndex_ = sel_registerName("outlineView:validateDrop:proposedItem:proposedChildIndex:");
-public static final long /*int*/ sel_outlineView_willDisplayCell_forTableColumn_item_ = sel_registerName("outlineView:willDisplayCell:forTableColumn:item:");
-public static final long /*int*/ sel_outlineView_writeItems_toPasteboard_ = sel_registerName("outlineView:writeItems:toPasteboard:");
-public static final long /*int*/ sel_outlineViewColumnDidMove_ = sel_registerName("outlineViewColumnDidMove:");
-public static final long /*int*/ sel_outlineViewColumnDidResize_ = sel_registerName("outlineViewColumnDidResize:");
-public static final long /*int*/ sel_outlineViewItemDidExpand_ = sel_registerName("outlineViewItemDidExpand:");
-public static final long /*int*/ sel_outlineViewSelectionDidChange_ = sel_registerName("outlineViewSelectionDidChange:");
-public static final long /*int*/ sel_outlineViewSelectionIsChanging_ = sel_registerName("outlineViewSelectionIsChanging:");
-public static final long /*int*/ sel_owner = sel_registerName("owner");
-public static final long /*int*/ sel_pageDown_ = sel_registerName("pageDown:");
-public static final long /*int*/ sel_pageTitle = sel_registerName("pageTitle");
-public static final long /*int*/ sel_pageUp_ = sel_registerName("pageUp:");
-public static final long /*int*/ sel_panel_shouldShowFilename_ = sel_registerName("panel:shouldShowFilename:");
-public static final long /*int*/ sel_panelConvertFont_ = sel_registerName("panelConvertFont:");
-public static final long /*int*/ sel_paperSize = sel_registerName("paperSize");
-public static final long /*int*/ sel_paragraphs = sel_registerName("paragraphs");
-public static final long /*int*/ sel_parentWindow = sel_registerName("parentWindow");
-public static final long /*int*/ sel_password = sel_registerName("password");
-public static final long /*int*/ sel_paste_ = sel_registerName("paste:");
-public static final long /*int*/ sel_pasteboard_provideDataForType_ = sel_registerName("pasteboard:provideDataForType:");
-public static final long /*int*/ sel_pasteboardWithName_ = sel_registerName("pasteboardWithName:");
-public static final long /*int*/ sel_path = sel_registerName("path");
-public static final long /*int*/ sel_pathExtension = sel_registerName("pathExtension");
-public static final long /*int*/ sel_pathForResource_ofType_ = sel_registerName("pathForResource:ofType:");
-public static final long /*int*/ sel_pathForResource_ofType_inDirectory_forLocalization_ = sel_registerName("pathForResource:ofType:inDirectory:forLocalization:");
-public static final long /*int*/ sel_performDragOperation_ = sel_registerName("performDragOperation:");
-public static final long /*int*/ sel_performKeyEquivalent_ = sel_registerName("performKeyEquivalent:");
-public static final long /*int*/ sel_performSelector_withObject_afterDelay_inModes_ = sel_registerName("performSelector:withObject:afterDelay:inModes:");
-public static final long /*int*/ sel_performSelectorOnMainThread_withObject_waitUntilDone_ = sel_registerName("performSelectorOnMainThread:withObject:waitUntilDone:");
-public static final long /*int*/ sel_phase = sel_registerName("phase");
-public static final long /*int*/ sel_pixelsHigh = sel_registerName("pixelsHigh");
-public static final long /*int*/ sel_pixelsWide = sel_registerName("pixelsWide");
-public static final long /*int*/ sel_pointSize = sel_registerName("pointSize");
-public static final long /*int*/ sel_pointValue = sel_registerName("pointValue");
-public static final long /*int*/ sel_pointingHandCursor = sel_registerName("pointingHandCursor");
-public static final long /*int*/ sel_pop = sel_registerName("pop");
-public static final long /*int*/ sel_popUpContextMenu_withEvent_forView_ = sel_registerName("popUpContextMenu:withEvent:forView:");
-public static final long /*int*/ sel_popUpStatusItemMenu_ = sel_registerName("popUpStatusItemMenu:");
-public static final long /*int*/ sel_port = sel_registerName("port");
-public static final long /*int*/ sel_postEvent_atStart_ = sel_registerName("postEvent:atStart:");
-public static final long /*int*/ sel_preparedCellAtColumn_row_ = sel_registerName("preparedCellAtColumn:row:");
-public static final long /*int*/ sel_prependTransform_ = sel_registerName("prependTransform:");
-public static final long /*int*/ sel_preventDefault = sel_registerName("preventDefault");
-public static final long /*int*/ sel_previousFailureCount = sel_registerName("previousFailureCount");
-public static final long /*int*/ sel_printDocumentView = sel_registerName("printDocumentView");
-public static final long /*int*/ sel_printOperationWithPrintInfo_ = sel_registerName("printOperationWithPrintInfo:");
-public static final long /*int*/ sel_printOperationWithView_printInfo_ = sel_registerName("printOperationWithView:printInfo:");
-public static final long /*int*/ sel_printPanel = sel_registerName("printPanel");
-public static final long /*int*/ sel_printSettings = sel_registerName("printSettings");
-public static final long /*int*/ sel_printer = sel_registerName("printer");
-public static final long /*int*/ sel_printerNames = sel_registerName("printerNames");
-public static final long /*int*/ sel_printerWithName_ = sel_registerName("printerWithName:");
-public static final long /*int*/ sel_propertyListForType_ = sel_registerName("propertyListForType:");
-public static final long /*int*/ sel_proposedCredential = sel_registerName("proposedCredential");
-public static final long /*int*/ sel_protectionSpace = sel_registerName("protectionSpace");
-public static final long /*int*/ sel_push = sel_registerName("push");
-public static final long /*int*/ sel_rangeValue = sel_registerName("rangeValue");
-public static final long /*int*/ sel_readSelectionFromPasteboard_ = sel_registerName("readSelectionFromPasteboard:");
-public static final long /*int*/ sel_realm = sel_registerName("realm");
-public static final long /*int*/ sel_recentSearches = sel_registerName("recentSearches");
-public static final long /*int*/ sel_rectArrayForCharacterRange_withinSelectedCharacterRange_inTextContainer_rectCount_ = sel_registerName("rectArrayForCharacterRange:withinSelectedCharacterRange:inTextContainer:rectCount:");
-public static final long /*int*/ sel_rectArrayForGlyphRange_withinSelectedGlyphRange_inTextContainer_rectCount_ = sel_registerName("rectArrayForGlyphRange:withinSelectedGlyphRange:inTextContainer:rectCount:");
-public static final long /*int*/ sel_rectForPart_ = sel_registerName("rectForPart:");
-public static final long /*int*/ sel_rectOfColumn_ = sel_registerName("rectOfColumn:");
-public static final long /*int*/ sel_rectOfRow_ = sel_registerName("rectOfRow:");
-public static final long /*int*/ sel_rectValue = sel_registerName("rectValue");
-public static final long /*int*/ sel_redComponent = sel_registerName("redComponent");
-public static final long /*int*/ sel_redo = sel_registerName("redo");
-public static final long /*int*/ sel_reflectScrolledClipView_ = sel_registerName("reflectScrolledClipView:");
-public static final long /*int*/ sel_registerForDraggedTypes_ = sel_registerName("registerForDraggedTypes:");
-public static final long /*int*/ sel_release = sel_registerName("release");
-public static final long /*int*/ sel_reload_ = sel_registerName("reload:");
-public static final long /*int*/ sel_reloadData = sel_registerName("reloadData");
-public static final long /*int*/ sel_reloadItem_reloadChildren_ = sel_registerName("reloadItem:reloadChildren:");
-public static final long /*int*/ sel_removeAllItems = sel_registerName("removeAllItems");
-public static final long /*int*/ sel_removeAllPoints = sel_registerName("removeAllPoints");
-public static final long /*int*/ sel_removeAttribute_range_ = sel_registerName("removeAttribute:range:");
-public static final long /*int*/ sel_removeChildWindow_ = sel_registerName("removeChildWindow:");
-public static final long /*int*/ sel_removeColorWithKey_ = sel_registerName("removeColorWithKey:");
-public static final long /*int*/ sel_removeFromSuperview = sel_registerName("removeFromSuperview");
-public static final long /*int*/ sel_removeIndex_ = sel_registerName("removeIndex:");
-public static final long /*int*/ sel_removeItem_ = sel_registerName("removeItem:");
-public static final long /*int*/ sel_removeItemAtIndex_ = sel_registerName("removeItemAtIndex:");
-public static final long /*int*/ sel_removeItemAtPath_error_ = sel_registerName("removeItemAtPath:error:");
-public static final long /*int*/ sel_removeLastObject = sel_registerName("removeLastObject");
-public static final long /*int*/ sel_removeObject_ = sel_registerName("removeObject:");
-public static final long /*int*/ sel_removeObjectAtIndex_ = sel_registerName("removeObjectAtIndex:");
-public static final long /*int*/ sel_removeObjectForKey_ = sel_registerName("removeObjectForKey:");
-public static final long /*int*/ sel_removeObjectIdenticalTo_ = sel_registerName("removeObjectIdenticalTo:");
-public static final long /*int*/ sel_removeObserver_ = sel_registerName("removeObserver:");
-public static final long /*int*/ sel_removeObserver_name_object_ = sel_registerName("removeObserver:name:object:");
-public static final long /*int*/ sel_removeRepresentation_ = sel_registerName("removeRepresentation:");
-public static final long /*int*/ sel_removeStatusItem_ = sel_registerName("removeStatusItem:");
-public static final long /*int*/ sel_removeTabViewItem_ = sel_registerName("removeTabViewItem:");
-public static final long /*int*/ sel_removeTableColumn_ = sel_registerName("removeTableColumn:");
-public static final long /*int*/ sel_removeTemporaryAttribute_forCharacterRange_ = sel_registerName("removeTemporaryAttribute:forCharacterRange:");
-public static final long /*int*/ sel_removeToolTip_ = sel_registerName("removeToolTip:");
-public static final long /*int*/ sel_removeTrackingArea_ = sel_registerName("removeTrackingArea:");
-public static final long /*int*/ sel_replaceCharactersInRange_withString_ = sel_registerName("replaceCharactersInRange:withString:");
-public static final long /*int*/ sel_replyToOpenOrPrint_ = sel_registerName("replyToOpenOrPrint:");
-public static final long /*int*/ sel_representation = sel_registerName("representation");
-public static final long /*int*/ sel_representations = sel_registerName("representations");
-public static final long /*int*/ sel_request = sel_registerName("request");
-public static final long /*int*/ sel_requestWithURL_ = sel_registerName("requestWithURL:");
-public static final long /*int*/ sel_resetCursorRects = sel_registerName("resetCursorRects");
-public static final long /*int*/ sel_resignFirstResponder = sel_registerName("resignFirstResponder");
-public static final long /*int*/ sel_resizeDownCursor = sel_registerName("resizeDownCursor");
-public static final long /*int*/ sel_resizeLeftCursor = sel_registerName("resizeLeftCursor");
-public static final long /*int*/ sel_resizeLeftRightCursor = sel_registerName("resizeLeftRightCursor");
-public static final long /*int*/ sel_resizeRightCursor = sel_registerName("resizeRightCursor");
-public static final long /*int*/ sel_resizeUpCursor = sel_registerName("resizeUpCursor");
-public static final long /*int*/ sel_resizeUpDownCursor = sel_registerName("resizeUpDownCursor");
-public static final long /*int*/ sel_resizingMask = sel_registerName("resizingMask");
-public static final long /*int*/ sel_resourcePath = sel_registerName("resourcePath");
-public static final long /*int*/ sel_respondsToSelector_ = sel_registerName("respondsToSelector:");
-public static final long /*int*/ sel_restoreGraphicsState = sel_registerName("restoreGraphicsState");
-public static final long /*int*/ sel_retain = sel_registerName("retain");
-public static final long /*int*/ sel_retainCount = sel_registerName("retainCount");
-public static final long /*int*/ sel_rightMouseDown_ = sel_registerName("rightMouseDown:");
-public static final long /*int*/ sel_rightMouseDragged_ = sel_registerName("rightMouseDragged:");
-public static final long /*int*/ sel_rightMouseUp_ = sel_registerName("rightMouseUp:");
-public static final long /*int*/ sel_rotateByDegrees_ = sel_registerName("rotateByDegrees:");
-public static final long /*int*/ sel_rotateWithEvent_ = sel_registerName("rotateWithEvent:");
-public static final long /*int*/ sel_rotation = sel_registerName("rotation");
-public static final long /*int*/ sel_rowAtPoint_ = sel_registerName("rowAtPoint:");
-public static final long /*int*/ sel_rowForItem_ = sel_registerName("rowForItem:");
-public static final long /*int*/ sel_rowHeight = sel_registerName("rowHeight");
-public static final long /*int*/ sel_rowsInRect_ = sel_registerName("rowsInRect:");
-public static final long /*int*/ sel_run = sel_registerName("run");
-public static final long /*int*/ sel_runModal = sel_registerName("runModal");
-public static final long /*int*/ sel_runModalForDirectory_file_ = sel_registerName("runModalForDirectory:file:");
-public static final long /*int*/ sel_runModalForWindow_ = sel_registerName("runModalForWindow:");
-public static final long /*int*/ sel_runModalWithPrintInfo_ = sel_registerName("runModalWithPrintInfo:");
-public static final long /*int*/ sel_runMode_beforeDate_ = sel_registerName("runMode:beforeDate:");
-public static final long /*int*/ sel_runOperation = sel_registerName("runOperation");
-public static final long /*int*/ sel_samplesPerPixel = sel_registerName("samplesPerPixel");
-public static final long /*int*/ sel_saveGraphicsState = sel_registerName("saveGraphicsState");
-public static final long /*int*/ sel_savePanel = sel_registerName("savePanel");
-public static final long /*int*/ sel_scaleXBy_yBy_ = sel_registerName("scaleXBy:yBy:");
-public static final long /*int*/ sel_scheduledTimerWithTimeInterval_target_selector_userInfo_repeats_ = sel_registerName("scheduledTimerWithTimeInterval:target:selector:userInfo:repeats:");
-public static final long /*int*/ sel_screen = sel_registerName("screen");
-public static final long /*int*/ sel_screenX = sel_registerName("screenX");
-public static final long /*int*/ sel_screenY = sel_registerName("screenY");
-public static final long /*int*/ sel_screens = sel_registerName("screens");
-public static final long /*int*/ sel_scrollClipView_toPoint_ = sel_registerName("scrollClipView:toPoint:");
-public static final long /*int*/ sel_scrollColumnToVisible_ = sel_registerName("scrollColumnToVisible:");
-public static final long /*int*/ sel_scrollPoint_ = sel_registerName("scrollPoint:");
-public static final long /*int*/ sel_scrollRangeToVisible_ = sel_registerName("scrollRangeToVisible:");
-public static final long /*int*/ sel_scrollRectToVisible_ = sel_registerName("scrollRectToVisible:");
-public static final long /*int*/ sel_scrollRowToVisible_ = sel_registerName("scrollRowToVisible:");
-public static final long /*int*/ sel_scrollToPoint_ = sel_registerName("scrollToPoint:");
-public static final long /*int*/ sel_scrollWheel_ = sel_registerName("scrollWheel:");
-public static final long /*int*/ sel_scrollerWidth = sel_registerName("scrollerWidth");
-public static final long /*int*/ sel_scrollerWidthForControlSize_ = sel_registerName("scrollerWidthForControlSize:");
-public static final long /*int*/ sel_searchButtonCell = sel_registerName("searchButtonCell");
-public static final long /*int*/ sel_searchTextRectForBounds_ = sel_registerName("searchTextRectForBounds:");
-public static final long /*int*/ sel_secondOfMinute = sel_registerName("secondOfMinute");
-public static final long /*int*/ sel_secondarySelectedControlColor = sel_registerName("secondarySelectedControlColor");
-public static final long /*int*/ sel_selectAll_ = sel_registerName("selectAll:");
-public static final long /*int*/ sel_selectItem_ = sel_registerName("selectItem:");
-public static final long /*int*/ sel_selectItemAtIndex_ = sel_registerName("selectItemAtIndex:");
-public static final long /*int*/ sel_selectRowIndexes_byExtendingSelection_ = sel_registerName("selectRowIndexes:byExtendingSelection:");
-public static final long /*int*/ sel_selectTabViewItemAtIndex_ = sel_registerName("selectTabViewItemAtIndex:");
-public static final long /*int*/ sel_selectText_ = sel_registerName("selectText:");
-public static final long /*int*/ sel_selectedControlColor = sel_registerName("selectedControlColor");
-public static final long /*int*/ sel_selectedControlTextColor = sel_registerName("selectedControlTextColor");
-public static final long /*int*/ sel_selectedRange = sel_registerName("selectedRange");
-public static final long /*int*/ sel_selectedRow = sel_registerName("selectedRow");
-public static final long /*int*/ sel_selectedRowIndexes = sel_registerName("selectedRowIndexes");
-public static final long /*int*/ sel_selectedTabViewItem = sel_registerName("selectedTabViewItem");
-public static final long /*int*/ sel_selectedTextAttributes = sel_registerName("selectedTextAttributes");
-public static final long /*int*/ sel_selectedTextBackgroundColor = sel_registerName("selectedTextBackgroundColor");
-public static final long /*int*/ sel_selectedTextColor = sel_registerName("selectedTextColor");
-public static final long /*int*/ sel_sendAction_to_ = sel_registerName("sendAction:to:");
-public static final long /*int*/ sel_sendAction_to_from_ = sel_registerName("sendAction:to:from:");
-public static final long /*int*/ sel_sendEvent_ = sel_registerName("sendEvent:");
-public static final long /*int*/ sel_sender = sel_registerName("sender");
-public static final long /*int*/ sel_separatorItem = sel_registerName("separatorItem");
-public static final long /*int*/ sel_set = sel_registerName("set");
-public static final long /*int*/ sel_setAcceptsMouseMovedEvents_ = sel_registerName("setAcceptsMouseMovedEvents:");
-public static final long /*int*/ sel_setAcceptsTouchEvents_ = sel_registerName("setAcceptsTouchEvents:");
-public static final long /*int*/ sel_setAccessoryView_ = sel_registerName("setAccessoryView:");
-public static final long /*int*/ sel_setAction_ = sel_registerName("setAction:");
-public static final long /*int*/ sel_setAlertStyle_ = sel_registerName("setAlertStyle:");
-public static final long /*int*/ sel_setAlignment_ = sel_registerName("setAlignment:");
-public static final long /*int*/ sel_setAllowsColumnReordering_ = sel_registerName("setAllowsColumnReordering:");
-public static final long /*int*/ sel_setAllowsFloats_ = sel_registerName("setAllowsFloats:");
-public static final long /*int*/ sel_setAllowsMixedState_ = sel_registerName("setAllowsMixedState:");
-public static final long /*int*/ sel_setAllowsMultipleSelection_ = sel_registerName("setAllowsMultipleSelection:");
-public static final long /*int*/ sel_setAllowsUndo_ = sel_registerName("setAllowsUndo:");
-public static final long /*int*/ sel_setAllowsUserCustomization_ = sel_registerName("setAllowsUserCustomization:");
-public static final long /*int*/ sel_setAlpha_ = sel_registerName("setAlpha:");
-public static final long /*int*/ sel_setAlphaValue_ = sel_registerName("setAlphaValue:");
-public static final long /*int*/ sel_setAlternateButtonTitle_ = sel_registerName("setAlternateButtonTitle:");
-public static final long /*int*/ sel_setApplicationIconImage_ = sel_registerName("setApplicationIconImage:");
-public static final long /*int*/ sel_setApplicationNameForUserAgent_ = sel_registerName("setApplicationNameForUserAgent:");
-public static final long /*int*/ sel_setAttachmentCell_ = sel_registerName("setAttachmentCell:");
-public static final long /*int*/ sel_setAttributedString_ = sel_registerName("setAttributedString:");
-public static final long /*int*/ sel_setAttributedStringValue_ = sel_registerName("setAttributedStringValue:");
-public static final long /*int*/ sel_setAttributedTitle_ = sel_registerName("setAttributedTitle:");
-public static final long /*int*/ sel_setAutoenablesItems_ = sel_registerName("setAutoenablesItems:");
-public static final long /*int*/ sel_setAutohidesScrollers_ = sel_registerName("setAutohidesScrollers:");
-public static final long /*int*/ sel_setAutoresizesOutlineColumn_ = sel_registerName("setAutoresizesOutlineColumn:");
-public static final long /*int*/ sel_setAutoresizesSubviews_ = sel_registerName("setAutoresizesSubviews:");
-public static final long /*int*/ sel_setAutoresizingMask_ = sel_registerName("setAutoresizingMask:");
-public static final long /*int*/ sel_setAutosaveExpandedItems_ = sel_registerName("setAutosaveExpandedItems:");
-public static final long /*int*/ sel_setBackgroundColor_ = sel_registerName("setBackgroundColor:");
-public static final long /*int*/ sel_setBackgroundLayoutEnabled_ = sel_registerName("setBackgroundLayoutEnabled:");
-public static final long /*int*/ sel_setBackgroundStyle_ = sel_registerName("setBackgroundStyle:");
-public static final long /*int*/ sel_setBadgeLabel_ = sel_registerName("setBadgeLabel:");
-public static final long /*int*/ sel_setBaseWritingDirection_ = sel_registerName("setBaseWritingDirection:");
-public static final long /*int*/ sel_setBaseWritingDirection_range_ = sel_registerName("setBaseWritingDirection:range:");
-public static final long /*int*/ sel_setBecomesKeyOnlyIfNeeded_ = sel_registerName("setBecomesKeyOnlyIfNeeded:");
-public static final long /*int*/ sel_setBezelStyle_ = sel_registerName("setBezelStyle:");
-public static final long /*int*/ sel_setBezeled_ = sel_registerName("setBezeled:");
-public static final long /*int*/ sel_setBorderType_ = sel_registerName("setBorderType:");
-public static final long /*int*/ sel_setBorderWidth_ = sel_registerName("setBorderWidth:");
-public static final long /*int*/ sel_setBordered_ = sel_registerName("setBordered:");
-public static final long /*int*/ sel_setBoundsRotation_ = sel_registerName("setBoundsRotation:");
-public static final long /*int*/ sel_setBoxType_ = sel_registerName("setBoxType:");
-public static final long /*int*/ sel_setButtonType_ = sel_registerName("setButtonType:");
-public static final long /*int*/ sel_setCacheMode_ = sel_registerName("setCacheMode:");
-public static final long /*int*/ sel_setCachePolicy_ = sel_registerName("setCachePolicy:");
-public static final long /*int*/ sel_setCanChooseDirectories_ = sel_registerName("setCanChooseDirectories:");
-public static final long /*int*/ sel_setCanChooseFiles_ = sel_registerName("setCanChooseFiles:");
-public static final long /*int*/ sel_setCanCreateDirectories_ = sel_registerName("setCanCreateDirectories:");
-public static final long /*int*/ sel_setCancelButtonCell_ = sel_registerName("setCancelButtonCell:");
-public static final long /*int*/ sel_setCell_ = sel_registerName("setCell:");
-public static final long /*int*/ sel_setCellClass_ = sel_registerName("setCellClass:");
-public static final long /*int*/ sel_setClip = sel_registerName("setClip");
-public static final long /*int*/ sel_setCollectionBehavior_ = sel_registerName("setCollectionBehavior:");
-public static final long /*int*/ sel_setColor_ = sel_registerName("setColor:");
-public static final long /*int*/ sel_setColumnAutoresizingStyle_ = sel_registerName("setColumnAutoresizingStyle:");
-public static final long /*int*/ sel_setCompositingOperation_ = sel_registerName("setCompositingOperation:");
-public static final long /*int*/ sel_setContainerSize_ = sel_registerName("setContainerSize:");
-public static final long /*int*/ sel_setContentView_ = sel_registerName("setContentView:");
-public static final long /*int*/ sel_setContentViewMargins_ = sel_registerName("setContentViewMargins:");
-public static final long /*int*/ sel_setControlSize_ = sel_registerName("setControlSize:");
-public static final long /*int*/ sel_setCookie_ = sel_registerName("setCookie:");
-public static final long /*int*/ sel_setCopiesOnScroll_ = sel_registerName("setCopiesOnScroll:");
-public static final long /*int*/ sel_setCurrentContext_ = sel_registerName("setCurrentContext:");
-public static final long /*int*/ sel_setCurrentOperation_ = sel_registerName("setCurrentOperation:");
-public static final long /*int*/ sel_setCustomUserAgent_ = sel_registerName("setCustomUserAgent:");
-public static final long /*int*/ sel_setData_forType_ = sel_registerName("setData:forType:");
-public static final long /*int*/ sel_setDataCell_ = sel_registerName("setDataCell:");
-public static final long /*int*/ sel_setDataSource_ = sel_registerName("setDataSource:");
-public static final long /*int*/ sel_setDatePickerElements_ = sel_registerName("setDatePickerElements:");
-public static final long /*int*/ sel_setDatePickerStyle_ = sel_registerName("setDatePickerStyle:");
-public static final long /*int*/ sel_setDateValue_ = sel_registerName("setDateValue:");
-public static final long /*int*/ sel_setDefaultButtonCell_ = sel_registerName("setDefaultButtonCell:");
-public static final long /*int*/ sel_setDefaultFlatness_ = sel_registerName("setDefaultFlatness:");
-public static final long /*int*/ sel_setDefaultParagraphStyle_ = sel_registerName("setDefaultParagraphStyle:");
-public static final long /*int*/ sel_setDefaultTabInterval_ = sel_registerName("setDefaultTabInterval:");
-public static final long /*int*/ sel_setDelegate_ = sel_registerName("setDelegate:");
-public static final long /*int*/ sel_setDestination_allowOverwrite_ = sel_registerName("setDestination:allowOverwrite:");
-public static final long /*int*/ sel_setDictionary_ = sel_registerName("setDictionary:");
-public static final long /*int*/ sel_setDirectory_ = sel_registerName("setDirectory:");
-public static final long /*int*/ sel_setDisplayMode_ = sel_registerName("setDisplayMode:");
-public static final long /*int*/ sel_setDisplaysLinkToolTips_ = sel_registerName("setDisplaysLinkToolTips:");
-public static final long /*int*/ sel_setDocumentCursor_ = sel_registerName("setDocumentCursor:");
-public static final long /*int*/ sel_setDocumentEdited_ = sel_registerName("setDocumentEdited:");
-public static final long /*int*/ sel_setDocumentView_ = sel_registerName("setDocumentView:");
-public static final long /*int*/ sel_setDoubleAction_ = sel_registerName("setDoubleAction:");
-public static final long /*int*/ sel_setDoubleValue_ = sel_registerName("setDoubleValue:");
-public static final long /*int*/ sel_setDownloadDelegate_ = sel_registerName("setDownloadDelegate:");
-public static final long /*int*/ sel_setDrawsBackground_ = sel_registerName("setDrawsBackground:");
-public static final long /*int*/ sel_setDropItem_dropChildIndex_ = sel_registerName("setDropItem:dropChildIndex:");
-public static final long /*int*/ sel_setDropRow_dropOperation_ = sel_registerName("setDropRow:dropOperation:");
-public static final long /*int*/ sel_setEditable_ = sel_registerName("setEditable:");
-public static final long /*int*/ sel_setEnabled_ = sel_registerName("setEnabled:");
-public static final long /*int*/ sel_setEnabled_forSegment_ = sel_registerName("setEnabled:forSegment:");
-public static final long /*int*/ sel_setFill = sel_registerName("setFill");
-public static final long /*int*/ sel_setFillColor_ = sel_registerName("setFillColor:");
-public static final long /*int*/ sel_setFireDate_ = sel_registerName("setFireDate:");
-public static final long /*int*/ sel_setFirstLineHeadIndent_ = sel_registerName("setFirstLineHeadIndent:");
-public static final long /*int*/ sel_setFloatingPanel_ = sel_registerName("setFloatingPanel:");
-public static final long /*int*/ sel_setFocusRingType_ = sel_registerName("setFocusRingType:");
-public static final long /*int*/ sel_setFont_ = sel_registerName("setFont:");
-public static final long /*int*/ sel_setFormatter_ = sel_registerName("setFormatter:");
-public static final long /*int*/ sel_setFrame_ = sel_registerName("setFrame:");
-public static final long /*int*/ sel_setFrame_display_ = sel_registerName("setFrame:display:");
-public static final long /*int*/ sel_setFrame_display_animate_ = sel_registerName("setFrame:display:animate:");
-public static final long /*int*/ sel_setFrameFromContentFrame_ = sel_registerName("setFrameFromContentFrame:");
-public static final long /*int*/ sel_setFrameLoadDelegate_ = sel_registerName("setFrameLoadDelegate:");
-public static final long /*int*/ sel_setFrameOrigin_ = sel_registerName("setFrameOrigin:");
-public static final long /*int*/ sel_setFrameSize_ = sel_registerName("setFrameSize:");
-public static final long /*int*/ sel_setGridStyleMask_ = sel_registerName("setGridStyleMask:");
-public static final long /*int*/ sel_setHTTPBody_ = sel_registerName("setHTTPBody:");
-public static final long /*int*/ sel_setHTTPMethod_ = sel_registerName("setHTTPMethod:");
-public static final long /*int*/ sel_setHasHorizontalScroller_ = sel_registerName("setHasHorizontalScroller:");
-public static final long /*int*/ sel_setHasShadow_ = sel_registerName("setHasShadow:");
-public static final long /*int*/ sel_setHasVerticalScroller_ = sel_registerName("setHasVerticalScroller:");
-public static final long /*int*/ sel_setHeadIndent_ = sel_registerName("setHeadIndent:");
-public static final long /*int*/ sel_setHeaderCell_ = sel_registerName("setHeaderCell:");
-public static final long /*int*/ sel_setHeaderView_ = sel_registerName("setHeaderView:");
-public static final long /*int*/ sel_setHelpMenu_ = sel_registerName("setHelpMenu:");
-public static final long /*int*/ sel_setHidden_ = sel_registerName("setHidden:");
-public static final long /*int*/ sel_setHiddenUntilMouseMoves_ = sel_registerName("setHiddenUntilMouseMoves:");
-public static final long /*int*/ sel_setHidesOnDeactivate_ = sel_registerName("setHidesOnDeactivate:");
-public static final long /*int*/ sel_setHighlightMode_ = sel_registerName("setHighlightMode:");
-public static final long /*int*/ sel_setHighlighted_ = sel_registerName("setHighlighted:");
-public static final long /*int*/ sel_setHighlightedTableColumn_ = sel_registerName("setHighlightedTableColumn:");
-public static final long /*int*/ sel_setHighlightsBy_ = sel_registerName("setHighlightsBy:");
-public static final long /*int*/ sel_setHorizontalScroller_ = sel_registerName("setHorizontalScroller:");
-public static final long /*int*/ sel_setHorizontallyResizable_ = sel_registerName("setHorizontallyResizable:");
-public static final long /*int*/ sel_setIcon_ = sel_registerName("setIcon:");
-public static final long /*int*/ sel_setIdentifier_ = sel_registerName("setIdentifier:");
-public static final long /*int*/ sel_setImage_ = sel_registerName("setImage:");
-public static final long /*int*/ sel_setImage_forSegment_ = sel_registerName("setImage:forSegment:");
-public static final long /*int*/ sel_setImageAlignment_ = sel_registerName("setImageAlignment:");
-public static final long /*int*/ sel_setImageInterpolation_ = sel_registerName("setImageInterpolation:");
-public static final long /*int*/ sel_setImagePosition_ = sel_registerName("setImagePosition:");
-public static final long /*int*/ sel_setImageScaling_ = sel_registerName("setImageScaling:");
-public static final long /*int*/ sel_setIncrement_ = sel_registerName("setIncrement:");
-public static final long /*int*/ sel_setIndeterminate_ = sel_registerName("setIndeterminate:");
-public static final long /*int*/ sel_setIndicatorImage_inTableColumn_ = sel_registerName("setIndicatorImage:inTableColumn:");
-public static final long /*int*/ sel_setInteger_forKey_ = sel_registerName("setInteger:forKey:");
-public static final long /*int*/ sel_setIntercellSpacing_ = sel_registerName("setIntercellSpacing:");
-public static final long /*int*/ sel_setJavaEnabled_ = sel_registerName("setJavaEnabled:");
-public static final long /*int*/ sel_setJavaScriptEnabled_ = sel_registerName("setJavaScriptEnabled:");
-public static final long /*int*/ sel_setJobDisposition_ = sel_registerName("setJobDisposition:");
-public static final long /*int*/ sel_setJobTitle_ = sel_registerName("setJobTitle:");
-public static final long /*int*/ sel_setKeyEquivalent_ = sel_registerName("setKeyEquivalent:");
-public static final long /*int*/ sel_setKeyEquivalentModifierMask_ = sel_registerName("setKeyEquivalentModifierMask:");
-public static final long /*int*/ sel_setKnobProportion_ = sel_registerName("setKnobProportion:");
-public static final long /*int*/ sel_setLabel_ = sel_registerName("setLabel:");
-public static final long /*int*/ sel_setLabel_forSegment_ = sel_registerName("setLabel:forSegment:");
-public static final long /*int*/ sel_setLeaf_ = sel_registerName("setLeaf:");
-public static final long /*int*/ sel_setLength_ = sel_registerName("setLength:");
-public static final long /*int*/ sel_setLevel_ = sel_registerName("setLevel:");
-public static final long /*int*/ sel_setLineBreakMode_ = sel_registerName("setLineBreakMode:");
-public static final long /*int*/ sel_setLineCapStyle_ = sel_registerName("setLineCapStyle:");
-public static final long /*int*/ sel_setLineDash_count_phase_ = sel_registerName("setLineDash:count:phase:");
-public static final long /*int*/ sel_setLineFragmentPadding_ = sel_registerName("setLineFragmentPadding:");
-public static final long /*int*/ sel_setLineFragmentRect_forGlyphRange_usedRect_ = sel_registerName("setLineFragmentRect:forGlyphRange:usedRect:");
-public static final long /*int*/ sel_setLineJoinStyle_ = sel_registerName("setLineJoinStyle:");
-public static final long /*int*/ sel_setLineSpacing_ = sel_registerName("setLineSpacing:");
-public static final long /*int*/ sel_setLineWidth_ = sel_registerName("setLineWidth:");
-public static final long /*int*/ sel_setLinkTextAttributes_ = sel_registerName("setLinkTextAttributes:");
-public static final long /*int*/ sel_setMainMenu_ = sel_registerName("setMainMenu:");
-public static final long /*int*/ sel_setMarkedText_selectedRange_ = sel_registerName("setMarkedText:selectedRange:");
-public static final long /*int*/ sel_setMaxSize_ = sel_registerName("setMaxSize:");
-public static final long /*int*/ sel_setMaxValue_ = sel_registerName("setMaxValue:");
-public static final long /*int*/ sel_setMaximum_ = sel_registerName("setMaximum:");
-public static final long /*int*/ sel_setMaximumFractionDigits_ = sel_registerName("setMaximumFractionDigits:");
-public static final long /*int*/ sel_setMaximumIntegerDigits_ = sel_registerName("setMaximumIntegerDigits:");
-public static final long /*int*/ sel_setMenu_ = sel_registerName("setMenu:");
-public static final long /*int*/ sel_setMenu_forSegment_ = sel_registerName("setMenu:forSegment:");
-public static final long /*int*/ sel_setMenuFormRepresentation_ = sel_registerName("setMenuFormRepresentation:");
-public static final long /*int*/ sel_setMessage_ = sel_registerName("setMessage:");
-public static final long /*int*/ sel_setMessageText_ = sel_registerName("setMessageText:");
-public static final long /*int*/ sel_setMinSize_ = sel_registerName("setMinSize:");
-public static final long /*int*/ sel_setMinValue_ = sel_registerName("setMinValue:");
-public static final long /*int*/ sel_setMinWidth_ = sel_registerName("setMinWidth:");
-public static final long /*int*/ sel_setMinimum_ = sel_registerName("setMinimum:");
-public static final long /*int*/ sel_setMinimumFractionDigits_ = sel_registerName("setMinimumFractionDigits:");
-public static final long /*int*/ sel_setMinimumIntegerDigits_ = sel_registerName("setMinimumIntegerDigits:");
-public static final long /*int*/ sel_setMiterLimit_ = sel_registerName("setMiterLimit:");
-public static final long /*int*/ sel_setNeedsDisplay_ = sel_registerName("setNeedsDisplay:");
-public static final long /*int*/ sel_setNeedsDisplayInRect_ = sel_registerName("setNeedsDisplayInRect:");
-public static final long /*int*/ sel_setNumberOfVisibleItems_ = sel_registerName("setNumberOfVisibleItems:");
-public static final long /*int*/ sel_setNumberStyle_ = sel_registerName("setNumberStyle:");
-public static final long /*int*/ sel_setObject_forKey_ = sel_registerName("setObject:forKey:");
-public static final long /*int*/ sel_setObjectValue_ = sel_registerName("setObjectValue:");
-public static final long /*int*/ sel_setOnMouseEntered_ = sel_registerName("setOnMouseEntered:");
-public static final long /*int*/ sel_setOpaque_ = sel_registerName("setOpaque:");
-public static final long /*int*/ sel_setOptions_ = sel_registerName("setOptions:");
-public static final long /*int*/ sel_setOutlineTableColumn_ = sel_registerName("setOutlineTableColumn:");
-public static final long /*int*/ sel_setPaletteLabel_ = sel_registerName("setPaletteLabel:");
-public static final long /*int*/ sel_setPanelFont_isMultiple_ = sel_registerName("setPanelFont:isMultiple:");
-public static final long /*int*/ sel_setPartialStringValidationEnabled_ = sel_registerName("setPartialStringValidationEnabled:");
-public static final long /*int*/ sel_setPatternPhase_ = sel_registerName("setPatternPhase:");
-public static final long /*int*/ sel_setPlaceholderString_ = sel_registerName("setPlaceholderString:");
-public static final long /*int*/ sel_setPolicyDelegate_ = sel_registerName("setPolicyDelegate:");
-public static final long /*int*/ sel_setPreferences_ = sel_registerName("setPreferences:");
-public static final long /*int*/ sel_setPrinter_ = sel_registerName("setPrinter:");
-public static final long /*int*/ sel_setPropertyList_forType_ = sel_registerName("setPropertyList:forType:");
-public static final long /*int*/ sel_setPullsDown_ = sel_registerName("setPullsDown:");
-public static final long /*int*/ sel_setReleasedWhenClosed_ = sel_registerName("setReleasedWhenClosed:");
-public static final long /*int*/ sel_setRepresentedFilename_ = sel_registerName("setRepresentedFilename:");
-public static final long /*int*/ sel_setRepresentedURL_ = sel_registerName("setRepresentedURL:");
-public static final long /*int*/ sel_setResizingMask_ = sel_registerName("setResizingMask:");
-public static final long /*int*/ sel_setResourceLoadDelegate_ = sel_registerName("setResourceLoadDelegate:");
-public static final long /*int*/ sel_setRichText_ = sel_registerName("setRichText:");
-public static final long /*int*/ sel_setRowHeight_ = sel_registerName("setRowHeight:");
-public static final long /*int*/ sel_setScalesWhenResized_ = sel_registerName("setScalesWhenResized:");
-public static final long /*int*/ sel_setScrollable_ = sel_registerName("setScrollable:");
-public static final long /*int*/ sel_setSearchButtonCell_ = sel_registerName("setSearchButtonCell:");
-public static final long /*int*/ sel_setSegmentCount_ = sel_registerName("setSegmentCount:");
-public static final long /*int*/ sel_setSegmentStyle_ = sel_registerName("setSegmentStyle:");
-public static final long /*int*/ sel_setSelectable_ = sel_registerName("setSelectable:");
-public static final long /*int*/ sel_setSelected_forSegment_ = sel_registerName("setSelected:forSegment:");
-public static final long /*int*/ sel_setSelectedItemIdentifier_ = sel_registerName("setSelectedItemIdentifier:");
-public static final long /*int*/ sel_setSelectedRange_ = sel_registerName("setSelectedRange:");
-public static final long /*int*/ sel_setSelectedSegment_ = sel_registerName("setSelectedSegment:");
-public static final long /*int*/ sel_setSelectedTextAttributes_ = sel_registerName("setSelectedTextAttributes:");
-public static final long /*int*/ sel_setServicesMenu_ = sel_registerName("setServicesMenu:");
-public static final long /*int*/ sel_setShouldAntialias_ = sel_registerName("setShouldAntialias:");
-public static final long /*int*/ sel_setShowsHelp_ = sel_registerName("setShowsHelp:");
-public static final long /*int*/ sel_setShowsPrintPanel_ = sel_registerName("setShowsPrintPanel:");
-public static final long /*int*/ sel_setShowsProgressPanel_ = sel_registerName("setShowsProgressPanel:");
-public static final long /*int*/ sel_setShowsResizeIndicator_ = sel_registerName("setShowsResizeIndicator:");
-public static final long /*int*/ sel_setShowsToolbarButton_ = sel_registerName("setShowsToolbarButton:");
-public static final long /*int*/ sel_setSize_ = sel_registerName("setSize:");
-public static final long /*int*/ sel_setState_ = sel_registerName("setState:");
-public static final long /*int*/ sel_setString_ = sel_registerName("setString:");
-public static final long /*int*/ sel_setString_forType_ = sel_registerName("setString:forType:");
-public static final long /*int*/ sel_setStringValue_ = sel_registerName("setStringValue:");
-public static final long /*int*/ sel_setStroke = sel_registerName("setStroke");
-public static final long /*int*/ sel_setSubmenu_ = sel_registerName("setSubmenu:");
-public static final long /*int*/ sel_setSubmenu_forItem_ = sel_registerName("setSubmenu:forItem:");
-public static final long /*int*/ sel_setTabStops_ = sel_registerName("setTabStops:");
-public static final long /*int*/ sel_setTabViewType_ = sel_registerName("setTabViewType:");
-public static final long /*int*/ sel_setTag_ = sel_registerName("setTag:");
-public static final long /*int*/ sel_setTag_forSegment_ = sel_registerName("setTag:forSegment:");
-public static final long /*int*/ sel_setTarget_ = sel_registerName("setTarget:");
-public static final long /*int*/ sel_setTextColor_ = sel_registerName("setTextColor:");
-public static final long /*int*/ sel_setTextStorage_ = sel_registerName("setTextStorage:");
-public static final long /*int*/ sel_setTitle_ = sel_registerName("setTitle:");
-public static final long /*int*/ sel_setTitleFont_ = sel_registerName("setTitleFont:");
-public static final long /*int*/ sel_setTitlePosition_ = sel_registerName("setTitlePosition:");
-public static final long /*int*/ sel_setToolTip_ = sel_registerName("setToolTip:");
-public static final long /*int*/ sel_setToolTip_forSegment_ = sel_registerName("setToolTip:forSegment:");
-public static final long /*int*/ sel_setToolbar_ = sel_registerName("setToolbar:");
-public static final long /*int*/ sel_setTrackingMode_ = sel_registerName("setTrackingMode:");
-public static final long /*int*/ sel_setTransformStruct_ = sel_registerName("setTransformStruct:");
-public static final long /*int*/ sel_setUIDelegate_ = sel_registerName("setUIDelegate:");
-public static final long /*int*/ sel_setURL_ = sel_registerName("setURL:");
-public static final long /*int*/ sel_setUpPrintOperationDefaultValues = sel_registerName("setUpPrintOperationDefaultValues");
-public static final long /*int*/ sel_setUsesAlternatingRowBackgroundColors_ = sel_registerName("setUsesAlternatingRowBackgroundColors:");
-public static final long /*int*/ sel_setUsesFontPanel_ = sel_registerName("setUsesFontPanel:");
-public static final long /*int*/ sel_setUsesScreenFonts_ = sel_registerName("setUsesScreenFonts:");
-public static final long /*int*/ sel_setUsesSingleLineMode_ = sel_registerName("setUsesSingleLineMode:");
-public static final long /*int*/ sel_setUsesThreadedAnimation_ = sel_registerName("setUsesThreadedAnimation:");
-public static final long /*int*/ sel_setValue_forHTTPHeaderField_ = sel_registerName("setValue:forHTTPHeaderField:");
-public static final long /*int*/ sel_setValue_forKey_ = sel_registerName("setValue:forKey:");
-public static final long /*int*/ sel_setValueWraps_ = sel_registerName("setValueWraps:");
-public static final long /*int*/ sel_setValues_forParameter_ = sel_registerName("setValues:forParameter:");
-public static final long /*int*/ sel_setVerticalScroller_ = sel_registerName("setVerticalScroller:");
-public static final long /*int*/ sel_setView_ = sel_registerName("setView:");
-public static final long /*int*/ sel_setVisible_ = sel_registerName("setVisible:");
-public static final long /*int*/ sel_setWantsRestingTouches_ = sel_registerName("setWantsRestingTouches:");
-public static final long /*int*/ sel_setWidth_ = sel_registerName("setWidth:");
-public static final long /*int*/ sel_setWidth_forSegment_ = sel_registerName("setWidth:forSegment:");
-public static final long /*int*/ sel_setWidthTracksTextView_ = sel_registerName("setWidthTracksTextView:");
-public static final long /*int*/ sel_setWindingRule_ = sel_registerName("setWindingRule:");
-public static final long /*int*/ sel_setWorksWhenModal_ = sel_registerName("setWorksWhenModal:");
-public static final long /*int*/ sel_setWraps_ = sel_registerName("setWraps:");
-public static final long /*int*/ sel_sharedApplication = sel_registerName("sharedApplication");
-public static final long /*int*/ sel_sharedCertificateTrustPanel = sel_registerName("sharedCertificateTrustPanel");
-public static final long /*int*/ sel_sharedColorPanel = sel_registerName("sharedColorPanel");
-public static final long /*int*/ sel_sharedFontManager = sel_registerName("sharedFontManager");
-public static final long /*int*/ sel_sharedFontPanel = sel_registerName("sharedFontPanel");
-public static final long /*int*/ sel_sharedHTTPCookieStorage = sel_registerName("sharedHTTPCookieStorage");
-public static final long /*int*/ sel_sharedPrintInfo = sel_registerName("sharedPrintInfo");
-public static final long /*int*/ sel_sharedWorkspace = sel_registerName("sharedWorkspace");
-public static final long /*int*/ sel_shiftKey = sel_registerName("shiftKey");
-public static final long /*int*/ sel_shouldAntialias = sel_registerName("shouldAntialias");
-public static final long /*int*/ sel_shouldChangeTextInRange_replacementString_ = sel_registerName("shouldChangeTextInRange:replacementString:");
-public static final long /*int*/ sel_shouldDelayWindowOrderingForEvent_ = sel_registerName("shouldDelayWindowOrderingForEvent:");
-public static final long /*int*/ sel_shouldDrawInsertionPoint = sel_registerName("shouldDrawInsertionPoint");
-public static final long /*int*/ sel_size = sel_registerName("size");
-public static final long /*int*/ sel_sizeOfLabel_ = sel_registerName("sizeOfLabel:");
-public static final long /*int*/ sel_sizeToFit = sel_registerName("sizeToFit");
-public static final long /*int*/ sel_sizeValue = sel_registerName("sizeValue");
-public static final long /*int*/ sel_skipDescendents = sel_registerName("skipDescendents");
-public static final long /*int*/ sel_smallSystemFontSize = sel_registerName("smallSystemFontSize");
-public static final long /*int*/ sel_sortIndicatorRectForBounds_ = sel_registerName("sortIndicatorRectForBounds:");
-public static final long /*int*/ sel_standardPreferences = sel_registerName("standardPreferences");
-public static final long /*int*/ sel_standardUserDefaults = sel_registerName("standardUserDefaults");
-public static final long /*int*/ sel_standardWindowButton_ = sel_registerName("standardWindowButton:");
-public static final long /*int*/ sel_startAnimation_ = sel_registerName("startAnimation:");
-public static final long /*int*/ sel_state = sel_registerName("state");
-public static final long /*int*/ sel_statusItemWithLength_ = sel_registerName("statusItemWithLength:");
-public static final long /*int*/ sel_stop_ = sel_registerName("stop:");
-public static final long /*int*/ sel_stopAnimation_ = sel_registerName("stopAnimation:");
-public static final long /*int*/ sel_stopLoading_ = sel_registerName("stopLoading:");
-public static final long /*int*/ sel_string = sel_registerName("string");
-public static final long /*int*/ sel_stringByAddingPercentEscapesUsingEncoding_ = sel_registerName("stringByAddingPercentEscapesUsingEncoding:");
-public static final long /*int*/ sel_stringByAppendingPathComponent_ = sel_registerName("stringByAppendingPathComponent:");
-public static final long /*int*/ sel_stringByAppendingPathExtension_ = sel_registerName("stringByAppendingPathExtension:");
-public static final long /*int*/ sel_stringByAppendingString_ = sel_registerName("stringByAppendingString:");
-public static final long /*int*/ sel_stringByDeletingLastPathComponent = sel_registerName("stringByDeletingLastPathComponent");
-public static final long /*int*/ sel_stringByDeletingPathExtension = sel_registerName("stringByDeletingPathExtension");
-public static final long /*int*/ sel_stringByReplacingOccurrencesOfString_withString_ = sel_registerName("stringByReplacingOccurrencesOfString:withString:");
-public static final long /*int*/ sel_stringByReplacingPercentEscapesUsingEncoding_ = sel_registerName("stringByReplacingPercentEscapesUsingEncoding:");
-public static final long /*int*/ sel_stringForObjectValue_ = sel_registerName("stringForObjectValue:");
-public static final long /*int*/ sel_stringForType_ = sel_registerName("stringForType:");
-public static final long /*int*/ sel_stringValue = sel_registerName("stringValue");
-public static final long /*int*/ sel_stringWithCharacters_length_ = sel_registerName("stringWithCharacters:length:");
-public static final long /*int*/ sel_stringWithFormat_ = sel_registerName("stringWithFormat:");
-public static final long /*int*/ sel_stringWithUTF8String_ = sel_registerName("stringWithUTF8String:");
-public static final long /*int*/ sel_stroke = sel_registerName("stroke");
-public static final long /*int*/ sel_strokeRect_ = sel_registerName("strokeRect:");
-public static final long /*int*/ sel_styleMask = sel_registerName("styleMask");
-public static final long /*int*/ sel_submenu = sel_registerName("submenu");
-public static final long /*int*/ sel_subviews = sel_registerName("subviews");
-public static final long /*int*/ sel_superclass = sel_registerName("superclass");
-public static final long /*int*/ sel_superview = sel_registerName("superview");
-public static final long /*int*/ sel_swipeWithEvent_ = sel_registerName("swipeWithEvent:");
-public static final long /*int*/ sel_systemFontOfSize_ = sel_registerName("systemFontOfSize:");
-public static final long /*int*/ sel_systemFontSize = sel_registerName("systemFontSize");
-public static final long /*int*/ sel_systemFontSizeForControlSize_ = sel_registerName("systemFontSizeForControlSize:");
-public static final long /*int*/ sel_systemStatusBar = sel_registerName("systemStatusBar");
-public static final long /*int*/ sel_systemVersion = sel_registerName("systemVersion");
-public static final long /*int*/ sel_tabStopType = sel_registerName("tabStopType");
-public static final long /*int*/ sel_tabStops = sel_registerName("tabStops");
-public static final long /*int*/ sel_tabView_didSelectTabViewItem_ = sel_registerName("tabView:didSelectTabViewItem:");
-public static final long /*int*/ sel_tabView_shouldSelectTabViewItem_ = sel_registerName("tabView:shouldSelectTabViewItem:");
-public static final long /*int*/ sel_tabView_willSelectTabViewItem_ = sel_registerName("tabView:willSelectTabViewItem:");
-public static final long /*int*/ sel_tabViewItemAtPoint_ = sel_registerName("tabViewItemAtPoint:");
-public static final long /*int*/ sel_tableColumns = sel_registerName("tableColumns");
-public static final long /*int*/ sel_tableView_acceptDrop_row_dropOperation_ = sel_registerName("tableView:acceptDrop:row:dropOperation:");
-public static final long /*int*/ sel_tableView_didClickTableColumn_ = sel_registerName("tableView:didClickTableColumn:");
-public static final long /*int*/ sel_tableView_objectValueForTableColumn_row_ = sel_registerName("tableView:objectValueForTableColumn:row:");
-public static final long /*int*/ sel_tableView_setObjectValue_forTableColumn_row_ = sel_registerName("tableView:setObjectValue:forTableColumn:row:");
-public static final long /*int*/ sel_tableView_shouldEditTableColumn_row_ = sel_registerName("tableView:shouldEditTableColumn:row:");
-public static final long /*int*/ sel_tableView_shouldReorderColumn_toColumn_ = sel_registerName("tableView:shouldReorderColumn:toColumn:");
-public static final long /*int*/ sel_tableView_shouldSelectRow_ = sel_registerName("tableView:shouldSelectRow:");
-public static final long /*int*/ sel_tableView_shouldTrackCell_forTableColumn_row_ = sel_registerName("tableView:shouldTrackCell:forTableColumn:row:");
-public static final long /*int*/ sel_tableView_validateDrop_proposedRow_proposedDropOperation_ = sel_registerName("tableView:validateDrop:proposedRow:proposedDropOperation:");
-public static final long /*int*/ sel_tableView_willDisplayCell_forTableColumn_row_ = sel_registerName("tableView:willDisplayCell:forTableColumn:row:");
-public static final long /*int*/ sel_tableView_writeRowsWithIndexes_toPasteboard_ = sel_registerName("tableView:writeRowsWithIndexes:toPasteboard:");
-public static final long /*int*/ sel_tableViewColumnDidMove_ = sel_registerName("tableViewColumnDidMove:");
-public static final long /*int*/ sel_tableViewColumnDidResize_ = sel_registerName("tableViewColumnDidResize:");
-public static final long /*int*/ sel_tableViewSelectionDidChange_ = sel_registerName("tableViewSelectionDidChange:");
-public static final long /*int*/ sel_tableViewSelectionIsChanging_ = sel_registerName("tableViewSelectionIsChanging:");
-public static final long /*int*/ sel_tag = sel_registerName("tag");
-public static final long /*int*/ sel_target = sel_registerName("target");
-public static final long /*int*/ sel_terminate_ = sel_registerName("terminate:");
-public static final long /*int*/ sel_testPart_ = sel_registerName("testPart:");
-public static final long /*int*/ sel_textBackgroundColor = sel_registerName("textBackgroundColor");
-public static final long /*int*/ sel_textColor = sel_registerName("textColor");
-public static final long /*int*/ sel_textContainer = sel_registerName("textContainer");
-public static final long /*int*/ sel_textDidChange_ = sel_registerName("textDidChange:");
-public static final long /*int*/ sel_textDidEndEditing_ = sel_registerName("textDidEndEditing:");
-public static final long /*int*/ sel_textStorage = sel_registerName("textStorage");
-public static final long /*int*/ sel_textView_clickedOnLink_atIndex_ = sel_registerName("textView:clickedOnLink:atIndex:");
-public static final long /*int*/ sel_textView_willChangeSelectionFromCharacterRange_toCharacterRange_ = sel_registerName("textView:willChangeSelectionFromCharacterRange:toCharacterRange:");
-public static final long /*int*/ sel_textViewDidChangeSelection_ = sel_registerName("textViewDidChangeSelection:");
-public static final long /*int*/ sel_thickness = sel_registerName("thickness");
-public static final long /*int*/ sel_threadDictionary = sel_registerName("threadDictionary");
-public static final long /*int*/ sel_tile = sel_registerName("tile");
-public static final long /*int*/ sel_timeZone = sel_registerName("timeZone");
-public static final long /*int*/ sel_timestamp = sel_registerName("timestamp");
-public static final long /*int*/ sel_title = sel_registerName("title");
-public static final long /*int*/ sel_titleCell = sel_registerName("titleCell");
-public static final long /*int*/ sel_titleFont = sel_registerName("titleFont");
-public static final long /*int*/ sel_titleOfSelectedItem = sel_registerName("titleOfSelectedItem");
-public static final long /*int*/ sel_titleRectForBounds_ = sel_registerName("titleRectForBounds:");
-public static final long /*int*/ sel_toggleToolbarShown_ = sel_registerName("toggleToolbarShown:");
-public static final long /*int*/ sel_toolbar = sel_registerName("toolbar");
-public static final long /*int*/ sel_toolbar_itemForItemIdentifier_willBeInsertedIntoToolbar_ = sel_registerName("toolbar:itemForItemIdentifier:willBeInsertedIntoToolbar:");
-public static final long /*int*/ sel_toolbarAllowedItemIdentifiers_ = sel_registerName("toolbarAllowedItemIdentifiers:");
-public static final long /*int*/ sel_toolbarDefaultItemIdentifiers_ = sel_registerName("toolbarDefaultItemIdentifiers:");
-public static final long /*int*/ sel_toolbarDidRemoveItem_ = sel_registerName("toolbarDidRemoveItem:");
-public static final long /*int*/ sel_toolbarSelectableItemIdentifiers_ = sel_registerName("toolbarSelectableItemIdentifiers:");
-public static final long /*int*/ sel_toolbarWillAddItem_ = sel_registerName("toolbarWillAddItem:");
-public static final long /*int*/ sel_touchesBeganWithEvent_ = sel_registerName("touchesBeganWithEvent:");
-public static final long /*int*/ sel_touchesCancelledWithEvent_ = sel_registerName("touchesCancelledWithEvent:");
-public static final long /*int*/ sel_touchesEndedWithEvent_ = sel_registerName("touchesEndedWithEvent:");
-public static final long /*int*/ sel_touchesMatchingPhase_inView_ = sel_registerName("touchesMatchingPhase:inView:");
-public static final long /*int*/ sel_touchesMovedWithEvent_ = sel_registerName("touchesMovedWithEvent:");
-public static final long /*int*/ sel_trackingAreas = sel_registerName("trackingAreas");
-public static final long /*int*/ sel_traitsOfFont_ = sel_registerName("traitsOfFont:");
-public static final long /*int*/ sel_transform = sel_registerName("transform");
-public static final long /*int*/ sel_transformPoint_ = sel_registerName("transformPoint:");
-public static final long /*int*/ sel_transformSize_ = sel_registerName("transformSize:");
-public static final long /*int*/ sel_transformStruct = sel_registerName("transformStruct");
-public static final long /*int*/ sel_transformUsingAffineTransform_ = sel_registerName("transformUsingAffineTransform:");
-public static final long /*int*/ sel_translateXBy_yBy_ = sel_registerName("translateXBy:yBy:");
-public static final long /*int*/ sel_type = sel_registerName("type");
-public static final long /*int*/ sel_type_conformsToType_ = sel_registerName("type:conformsToType:");
-public static final long /*int*/ sel_typeOfFile_error_ = sel_registerName("typeOfFile:error:");
-public static final long /*int*/ sel_types = sel_registerName("types");
-public static final long /*int*/ sel_typesetter = sel_registerName("typesetter");
-public static final long /*int*/ sel_unarchiveObjectWithData_ = sel_registerName("unarchiveObjectWithData:");
-public static final long /*int*/ sel_undefined = sel_registerName("undefined");
-public static final long /*int*/ sel_undo = sel_registerName("undo");
-public static final long /*int*/ sel_undoManager = sel_registerName("undoManager");
-public static final long /*int*/ sel_unhideAllApplications_ = sel_registerName("unhideAllApplications:");
-public static final long /*int*/ sel_unlockFocus = sel_registerName("unlockFocus");
-public static final long /*int*/ sel_unmarkText = sel_registerName("unmarkText");
-public static final long /*int*/ sel_unregisterDraggedTypes = sel_registerName("unregisterDraggedTypes");
-public static final long /*int*/ sel_update = sel_registerName("update");
-public static final long /*int*/ sel_updateFromPMPrintSettings = sel_registerName("updateFromPMPrintSettings");
-public static final long /*int*/ sel_updateTrackingAreas = sel_registerName("updateTrackingAreas");
-public static final long /*int*/ sel_use = sel_registerName("use");
-public static final long /*int*/ sel_useCredential_forAuthenticationChallenge_ = sel_registerName("useCredential:forAuthenticationChallenge:");
-public static final long /*int*/ sel_usedRectForTextContainer_ = sel_registerName("usedRectForTextContainer:");
-public static final long /*int*/ sel_user = sel_registerName("user");
-public static final long /*int*/ sel_userInfo = sel_registerName("userInfo");
-public static final long /*int*/ sel_userSpaceScaleFactor = sel_registerName("userSpaceScaleFactor");
-public static final long /*int*/ sel_usesAlternatingRowBackgroundColors = sel_registerName("usesAlternatingRowBackgroundColors");
-public static final long /*int*/ sel_validAttributesForMarkedText = sel_registerName("validAttributesForMarkedText");
-public static final long /*int*/ sel_validModesForFontPanel_ = sel_registerName("validModesForFontPanel:");
-public static final long /*int*/ sel_validRequestorForSendType_returnType_ = sel_registerName("validRequestorForSendType:returnType:");
-public static final long /*int*/ sel_validateMenuItem_ = sel_registerName("validateMenuItem:");
-public static final long /*int*/ sel_validateVisibleColumns = sel_registerName("validateVisibleColumns");
-public static final long /*int*/ sel_value = sel_registerName("value");
-public static final long /*int*/ sel_valueForKey_ = sel_registerName("valueForKey:");
-public static final long /*int*/ sel_valueWithPoint_ = sel_registerName("valueWithPoint:");
-public static final long /*int*/ sel_valueWithRange_ = sel_registerName("valueWithRange:");
-public static final long /*int*/ sel_valueWithRect_ = sel_registerName("valueWithRect:");
-public static final long /*int*/ sel_valueWithSize_ = sel_registerName("valueWithSize:");
-public static final long /*int*/ sel_view = sel_registerName("view");
-public static final long /*int*/ sel_view_stringForToolTip_point_userData_ = sel_registerName("view:stringForToolTip:point:userData:");
-public static final long /*int*/ sel_viewDidMoveToWindow = sel_registerName("viewDidMoveToWindow");
-public static final long /*int*/ sel_viewWillMoveToWindow_ = sel_registerName("viewWillMoveToWindow:");
-public static final long /*int*/ sel_visibleFrame = sel_registerName("visibleFrame");
-public static final long /*int*/ sel_visibleRect = sel_registerName("visibleRect");
-public static final long /*int*/ sel_wantsPeriodicDraggingUpdates = sel_registerName("wantsPeriodicDraggingUpdates");
-public static final long /*int*/ sel_wantsToHandleMouseEvents = sel_registerName("wantsToHandleMouseEvents");
-public static final long /*int*/ sel_webFrame = sel_registerName("webFrame");
-public static final long /*int*/ sel_webScriptValueAtIndex_ = sel_registerName("webScriptValueAtIndex:");
-public static final long /*int*/ sel_webView_contextMenuItemsForElement_defaultMenuItems_ = sel_registerName("webView:contextMenuItemsForElement:defaultMenuItems:");
-public static final long /*int*/ sel_webView_createWebViewWithRequest_ = sel_registerName("webView:createWebViewWithRequest:");
-public static final long /*int*/ sel_webView_decidePolicyForMIMEType_request_frame_decisionListener_ = sel_registerName("webView:decidePolicyForMIMEType:request:frame:decisionListener:");
-public static final long /*int*/ sel_webView_decidePolicyForNavigationAction_request_frame_decisionListener_ = sel_registerName("webView:decidePolicyForNavigationAction:request:frame:decisionListener:");
-public static final long /*int*/ sel_webView_decidePolicyForNewWindowAction_request_newFrameName_decisionListener_ = sel_registerName("webView:decidePolicyForNewWindowAction:request:newFrameName:decisionListener:");
-public static final long /*int*/ sel_webView_didChangeLocationWithinPageForFrame_ = sel_registerName("webView:didChangeLocationWithinPageForFrame:");
-public static final long /*int*/ sel_webView_didCommitLoadForFrame_ = sel_registerName("webView:didCommitLoadForFrame:");
-public static final long /*int*/ sel_webView_didFailProvisionalLoadWithError_forFrame_ = sel_registerName("webView:didFailProvisionalLoadWithError:forFrame:");
-public static final long /*int*/ sel_webView_didFinishLoadForFrame_ = sel_registerName("webView:didFinishLoadForFrame:");
-public static final long /*int*/ sel_webView_didReceiveTitle_forFrame_ = sel_registerName("webView:didReceiveTitle:forFrame:");
-public static final long /*int*/ sel_webView_didStartProvisionalLoadForFrame_ = sel_registerName("webView:didStartProvisionalLoadForFrame:");
-public static final long /*int*/ sel_webView_identifierForInitialRequest_fromDataSource_ = sel_registerName("webView:identifierForInitialRequest:fromDataSource:");
-public static final long /*int*/ sel_webView_mouseDidMoveOverElement_modifierFlags_ = sel_registerName("webView:mouseDidMoveOverElement:modifierFlags:");
-public static final long /*int*/ sel_webView_printFrameView_ = sel_registerName("webView:printFrameView:");
-public static final long /*int*/ sel_webView_resource_didFailLoadingWithError_fromDataSource_ = sel_registerName("webView:resource:didFailLoadingWithError:fromDataSource:");
-public static final long /*int*/ sel_webView_resource_didFinishLoadingFromDataSource_ = sel_registerName("webView:resource:didFinishLoadingFromDataSource:");
-public static final long /*int*/ sel_webView_resource_didReceiveAuthenticationChallenge_fromDataSource_ = sel_registerName("webView:resource:didReceiveAuthenticationChallenge:fromDataSource:");
-public static final long /*int*/ sel_webView_resource_willSendRequest_redirectResponse_fromDataSource_ = sel_registerName("webView:resource:willSendRequest:redirectResponse:fromDataSource:");
-public static final long /*int*/ sel_webView_runBeforeUnloadConfirmPanelWithMessage_initiatedByFrame_ = sel_registerName("webView:runBeforeUnloadConfirmPanelWithMessage:initiatedByFrame:");
-public static final long /*int*/ sel_webView_runJavaScriptAlertPanelWithMessage_ = sel_registerName("webView:runJavaScriptAlertPanelWithMessage:");
-public static final long /*int*/ sel_webView_runJavaScriptAlertPanelWithMessage_initiatedByFrame_ = sel_registerName("webView:runJavaScriptAlertPanelWithMessage:initiatedByFrame:");
-public static final long /*int*/ sel_webView_runJavaScriptConfirmPanelWithMessage_ = sel_registerName("webView:runJavaScriptConfirmPanelWithMessage:");
-public static final long /*int*/ sel_webView_runJavaScriptConfirmPanelWithMessage_initiatedByFrame_ = sel_registerName("webView:runJavaScriptConfirmPanelWithMessage:initiatedByFrame:");
-public static final long /*int*/ sel_webView_runOpenPanelForFileButtonWithResultListener_ = sel_registerName("webView:runOpenPanelForFileButtonWithResultListener:");
-public static final long /*int*/ sel_webView_setFrame_ = sel_registerName("webView:setFrame:");
-public static final long /*int*/ sel_webView_setResizable_ = sel_registerName("webView:setResizable:");
-public static final long /*int*/ sel_webView_setStatusBarVisible_ = sel_registerName("webView:setStatusBarVisible:");
-public static final long /*int*/ sel_webView_setStatusText_ = sel_registerName("webView:setStatusText:");
-public static final long /*int*/ sel_webView_setToolbarsVisible_ = sel_registerName("webView:setToolbarsVisible:");
-public static final long /*int*/ sel_webView_unableToImplementPolicyWithError_frame_ = sel_registerName("webView:unableToImplementPolicyWithError:frame:");
-public static final long /*int*/ sel_webView_windowScriptObjectAvailable_ = sel_registerName("webView:windowScriptObjectAvailable:");
-public static final long /*int*/ sel_webViewClose_ = sel_registerName("webViewClose:");
-public static final long /*int*/ sel_webViewFocus_ = sel_registerName("webViewFocus:");
-public static final long /*int*/ sel_webViewShow_ = sel_registerName("webViewShow:");
-public static final long /*int*/ sel_webViewUnfocus_ = sel_registerName("webViewUnfocus:");
-public static final long /*int*/ sel_weightOfFont_ = sel_registerName("weightOfFont:");
-public static final long /*int*/ sel_wheelDelta = sel_registerName("wheelDelta");
-public static final long /*int*/ sel_width = sel_registerName("width");
-public static final long /*int*/ sel_window = sel_registerName("window");
-public static final long /*int*/ sel_windowBackgroundColor = sel_registerName("windowBackgroundColor");
-public static final long /*int*/ sel_windowDidBecomeKey_ = sel_registerName("windowDidBecomeKey:");
-public static final long /*int*/ sel_windowDidDeminiaturize_ = sel_registerName("windowDidDeminiaturize:");
-public static final long /*int*/ sel_windowDidMiniaturize_ = sel_registerName("windowDidMiniaturize:");
-public static final long /*int*/ sel_windowDidMove_ = sel_registerName("windowDidMove:");
-public static final long /*int*/ sel_windowDidResignKey_ = sel_registerName("windowDidResignKey:");
-public static final long /*int*/ sel_windowDidResize_ = sel_registerName("windowDidResize:");
-public static final long /*int*/ sel_windowFrameColor = sel_registerName("windowFrameColor");
-public static final long /*int*/ sel_windowFrameTextColor = sel_registerName("windowFrameTextColor");
-public static final long /*int*/ sel_windowNumber = sel_registerName("windowNumber");
-public static final long /*int*/ sel_windowNumberAtPoint_belowWindowWithWindowNumber_ = sel_registerName("windowNumberAtPoint:belowWindowWithWindowNumber:");
-public static final long /*int*/ sel_windowRef = sel_registerName("windowRef");
-public static final long /*int*/ sel_windowShouldClose_ = sel_registerName("windowShouldClose:");
-public static final long /*int*/ sel_windowWillClose_ = sel_registerName("windowWillClose:");
-public static final long /*int*/ sel_windowWithWindowNumber_ = sel_registerName("windowWithWindowNumber:");
-public static final long /*int*/ sel_windows = sel_registerName("windows");
-public static final long /*int*/ sel_worksWhenModal = sel_registerName("worksWhenModal");
-public static final long /*int*/ sel_wraps = sel_registerName("wraps");
-public static final long /*int*/ sel_writeSelectionToPasteboard_types_ = sel_registerName("writeSelectionToPasteboard:types:");
-public static final long /*int*/ sel_writeToPasteboard_ = sel_registerName("writeToPasteboard:");
-public static final long /*int*/ sel_yearOfCommonEra = sel_registerName("yearOfCommonEra");
-public static final long /*int*/ sel_zoom_ = sel_registerName("zoom:");
+static final long /*int*/ [] SELECTORS = sel_registerNames(
+	"CGEvent\0" +
+	"DOMDocument\0" +
+	"IBeamCursor\0" +
+	"PMPrintSession\0" +
+	"PMPrintSettings\0" +
+	"TIFFRepresentation\0" +
+	"URL\0" +
+	"URLFromPasteboard:\0" +
+	"URLWithString:\0" +
+	"URLsForDirectory:inDomains:\0" +
+	"UTF8String\0" +
+	"abortEditing\0" +
+	"absoluteString\0" +
+	"acceptsFirstMouse:\0" +
+	"acceptsFirstResponder\0" +
+	"accessibilityActionDescription:\0" +
+	"accessibilityActionNames\0" +
+	"accessibilityAttributeNames\0" +
+	"accessibilityAttributeValue:\0" +
+	"accessibilityAttributeValue:forParameter:\0" +
+	"accessibilityFocusedUIElement\0" +
+	"accessibilityHitTest:\0" +
+	"accessibilityIsAttributeSettable:\0" +
+	"accessibilityIsIgnored\0" +
+	"accessibilityParameterizedAttributeNames\0" +
+	"accessibilityPerformAction:\0" +
+	"accessibilitySetOverrideValue:forAttribute:\0" +
+	"accessibilitySetValue:forAttribute:\0" +
+	"action\0" +
+	"activateIgnoringOtherApps:\0" +
+	"addAttribute:value:range:\0" +
+	"addButtonWithTitle:\0" +
+	"addChildWindow:ordered:\0" +
+	"addClip\0" +
+	"addEventListener:listener:useCapture:\0" +
+	"addIndex:\0" +
+	"addItem:\0" +
+	"addItemWithObjectValue:\0" +
+	"addItemWithTitle:action:keyEquivalent:\0" +
+	"addLayoutManager:\0" +
+	"addObject:\0" +
+	"addObjectsFromArray:\0" +
+	"addObserver:selector:name:object:\0" +
+	"addRepresentation:\0" +
+	"addSubview:\0" +
+	"addSubview:positioned:relativeTo:\0" +
+	"addTabStop:\0" +
+	"addTabViewItem:\0" +
+	"addTableColumn:\0" +
+	"addTemporaryAttribute:value:forCharacterRange:\0" +
+	"addTextContainer:\0" +
+	"addTimer:forMode:\0" +
+	"addToolTipRect:owner:userData:\0" +
+	"addTypes:owner:\0" +
+	"alignment\0" +
+	"allKeys\0" +
+	"allObjects\0" +
+	"alloc\0" +
+	"allowsColumnReordering\0" +
+	"allowsFloats\0" +
+	"alphaComponent\0" +
+	"alphaValue\0" +
+	"altKey\0" +
+	"alternateSelectedControlColor\0" +
+	"alternateSelectedControlTextColor\0" +
+	"alwaysShowsDecimalSeparator\0" +
+	"appendAttributedString:\0" +
+	"appendBezierPath:\0" +
+	"appendBezierPathWithArcWithCenter:radius:startAngle:endAngle:\0" +
+	"appendBezierPathWithArcWithCenter:radius:startAngle:endAngle:clockwise:\0" +
+	"appendBezierPathWithGlyphs:count:inFont:\0" +
+	"appendBezierPathWithOvalInRect:\0" +
+	"appendBezierPathWithRect:\0" +
+	"appendBezierPathWithRoundedRect:xRadius:yRadius:\0" +
+	"appendString:\0" +
+	"application:openFile:\0" +
+	"application:openFiles:\0" +
+	"applicationDidBecomeActive:\0" +
+	"applicationDidFinishLaunching:\0" +
+	"applicationDidResignActive:\0" +
+	"applicationDockMenu:\0" +
+	"applicationIconImage\0" +
+	"applicationShouldHandleReopen:hasVisibleWindows:\0" +
+	"applicationShouldTerminate:\0" +
+	"applicationWillFinishLaunching:\0" +
+	"applicationWillTerminate:\0" +
+	"archivedDataWithRootObject:\0" +
+	"areCursorRectsEnabled\0" +
+	"arrangeInFront:\0" +
+	"array\0" +
+	"arrayWithCapacity:\0" +
+	"arrayWithObject:\0" +
+	"arrowCursor\0" +
+	"ascender\0" +
+	"attachColorList:\0" +
+	"attribute:atIndex:effectiveRange:\0" +
+	"attributedStringValue\0" +
+	"attributedStringWithAttachment:\0" +
+	"attributedSubstringFromRange:\0" +
+	"attributedTitle\0" +
+	"attributesAtIndex:longestEffectiveRange:inRange:\0" +
+	"autorelease\0" +
+	"availableFontFamilies\0" +
+	"availableFonts\0" +
+	"availableMembersOfFontFamily:\0" +
+	"availableTypeFromArray:\0" +
+	"backgroundColor\0" +
+	"backingScaleFactor\0" +
+	"badgeLabel\0" +
+	"baselineOffsetInLayoutManager:glyphIndex:\0" +
+	"becomeFirstResponder\0" +
+	"becomeKeyWindow\0" +
+	"beginDocument\0" +
+	"beginEditing\0" +
+	"beginGestureWithEvent:\0" +
+	"beginPageInRect:atPlacement:\0" +
+	"beginSheet:modalForWindow:modalDelegate:didEndSelector:contextInfo:\0" +
+	"beginSheetForWindow:modalDelegate:didEndSelector:contextInfo:trust:message:\0" +
+	"beginSheetModalForWindow:modalDelegate:didEndSelector:contextInfo:\0" +
+	"beginSheetWithPrintInfo:modalForWindow:delegate:didEndSelector:contextInfo:\0" +
+	"bestRepresentationForDevice:\0" +
+	"bezierPath\0" +
+	"bezierPathByFlatteningPath\0" +
+	"bezierPathWithRect:\0" +
+	"bitmapData\0" +
+	"bitmapFormat\0" +
+	"bitsPerPixel\0" +
+	"bitsPerSample\0" +
+	"blackColor\0" +
+	"blueComponent\0" +
+	"boolValue\0" +
+	"borderWidth\0" +
+	"boundingRectForGlyphRange:inTextContainer:\0" +
+	"boundingRectWithSize:options:\0" +
+	"bounds\0" +
+	"bundleIdentifier\0" +
+	"bundlePath\0" +
+	"bundleWithIdentifier:\0" +
+	"bundleWithPath:\0" +
+	"button\0" +
+	"buttonNumber\0" +
+	"bytes\0" +
+	"bytesPerPlane\0" +
+	"bytesPerRow\0" +
+	"calendarDate\0" +
+	"canBecomeKeyView\0" +
+	"canBecomeKeyWindow\0" +
+	"canDragRowsWithIndexes:atPoint:\0" +
+	"canGoBack\0" +
+	"canGoForward\0" +
+	"canRedo\0" +
+	"canShowMIMEType:\0" +
+	"canUndo\0" +
+	"cancel\0" +
+	"cancelAuthenticationChallenge:\0" +
+	"cancelButtonCell\0" +
+	"cancelOperation:\0" +
+	"cancelTracking\0" +
+	"cascadeTopLeftFromPoint:\0" +
+	"cell\0" +
+	"cellClass\0" +
+	"cellSize\0" +
+	"cellSizeForBounds:\0" +
+	"changeColor:\0" +
+	"changeFont:\0" +
+	"charCode\0" +
+	"characterAtIndex:\0" +
+	"characterIndexForGlyphAtIndex:\0" +
+	"characterIndexForInsertionAtPoint:\0" +
+	"characterIndexForPoint:\0" +
+	"characterIsMember:\0" +
+	"characters\0" +
+	"charactersIgnoringModifiers\0" +
+	"chooseFilename:\0" +
+	"className\0" +
+	"cleanUpOperation\0" +
+	"clearColor\0" +
+	"clearCurrentContext\0" +
+	"clearDrawable\0" +
+	"clickCount\0" +
+	"clickedColumn\0" +
+	"clickedRow\0" +
+	"close\0" +
+	"closePath\0" +
+	"code\0" +
+	"collapseItem:\0" +
+	"collapseItem:collapseChildren:\0" +
+	"collectionBehavior\0" +
+	"color\0" +
+	"colorAtX:y:\0" +
+	"colorListNamed:\0" +
+	"colorSpace\0" +
+	"colorSpaceModel\0" +
+	"colorSpaceName\0" +
+	"colorUsingColorSpaceName:\0" +
+	"colorWithCalibratedRed:green:blue:alpha:\0" +
+	"colorWithDeviceRed:green:blue:alpha:\0" +
+	"colorWithKey:\0" +
+	"colorWithPatternImage:\0" +
+	"columnAtPoint:\0" +
+	"columnIndexesInRect:\0" +
+	"columnWithIdentifier:\0" +
+	"comboBoxSelectionDidChange:\0" +
+	"comboBoxWillDismiss:\0" +
+	"comboBoxWillPopUp:\0" +
+	"compare:\0" +
+	"concat\0" +
+	"conformsToProtocol:\0" +
+	"containerSize\0" +
+	"containsIndex:\0" +
+	"containsObject:\0" +
+	"containsPoint:\0" +
+	"contentRect\0" +
+	"contentSize\0" +
+	"contentSizeForFrameSize:hasHorizontalScroller:hasVerticalScroller:borderType:\0" +
+	"contentView\0" +
+	"contentViewMargins\0" +
+	"context\0" +
+	"controlBackgroundColor\0" +
+	"controlContentFontOfSize:\0" +
+	"controlDarkShadowColor\0" +
+	"controlHighlightColor\0" +
+	"controlLightHighlightColor\0" +
+	"controlPointBounds\0" +
+	"controlShadowColor\0" +
+	"controlSize\0" +
+	"controlTextColor\0" +
+	"convertBaseToScreen:\0" +
+	"convertFont:toHaveTrait:\0" +
+	"convertPoint:fromView:\0" +
+	"convertPoint:toView:\0" +
+	"convertPointFromBase:\0" +
+	"convertPointToBase:\0" +
+	"convertRect:fromView:\0" +
+	"convertRect:toView:\0" +
+	"convertRectFromBase:\0" +
+	"convertRectToBase:\0" +
+	"convertScreenToBase:\0" +
+	"convertSize:fromView:\0" +
+	"convertSize:toView:\0" +
+	"convertSizeFromBase:\0" +
+	"convertSizeToBase:\0" +
+	"cookies\0" +
+	"cookiesForURL:\0" +
+	"cookiesWithResponseHeaderFields:forURL:\0" +
+	"copiesOnScroll\0" +
+	"copy\0" +
+	"copy:\0" +
+	"count\0" +
+	"createContext\0" +
+	"createFileAtPath:contents:attributes:\0" +
+	"credentialWithUser:password:persistence:\0" +
+	"crosshairCursor\0" +
+	"ctrlKey\0" +
+	"currentContext\0" +
+	"currentCursor\0" +
+	"currentEditor\0" +
+	"currentEvent\0" +
+	"currentHandler\0" +
+	"currentInputManager\0" +
+	"currentPoint\0" +
+	"currentRunLoop\0" +
+	"currentThread\0" +
+	"cursorUpdate:\0" +
+	"curveToPoint:controlPoint1:controlPoint2:\0" +
+	"cut:\0" +
+	"dataCell\0" +
+	"dataForType:\0" +
+	"dataSource\0" +
+	"dataWithBytes:length:\0" +
+	"dateValue\0" +
+	"dateWithCalendarFormat:timeZone:\0" +
+	"dateWithTimeIntervalSinceNow:\0" +
+	"dateWithYear:month:day:hour:minute:second:timeZone:\0" +
+	"dayOfMonth\0" +
+	"dealloc\0" +
+	"decimalDigitCharacterSet\0" +
+	"decimalSeparator\0" +
+	"declareTypes:owner:\0" +
+	"defaultBaselineOffsetForFont:\0" +
+	"defaultButtonCell\0" +
+	"defaultCenter\0" +
+	"defaultFlatness\0" +
+	"defaultLineHeightForFont:\0" +
+	"defaultManager\0" +
+	"defaultParagraphStyle\0" +
+	"defaultPrinter\0" +
+	"defaultTimeZone\0" +
+	"delegate\0" +
+	"deleteCookie:\0" +
+	"deliverResult\0" +
+	"deltaX\0" +
+	"deltaY\0" +
+	"deminiaturize:\0" +
+	"depth\0" +
+	"descender\0" +
+	"description\0" +
+	"deselectAll:\0" +
+	"deselectItemAtIndex:\0" +
+	"deselectRow:\0" +
+	"destroyContext\0" +
+	"detail\0" +
+	"device\0" +
+	"deviceDescription\0" +
+	"deviceSize\0" +
+	"dictionary\0" +
+	"dictionaryWithCapacity:\0" +
+	"dictionaryWithObject:forKey:\0" +
+	"disableCursorRects\0" +
+	"disableFlushWindow\0" +
+	"disabledControlTextColor\0" +
+	"discardCursorRects\0" +
+	"display\0" +
+	"displayIfNeeded\0" +
+	"displayName\0" +
+	"displayNameForKey:value:\0" +
+	"displayRectIgnoringOpacity:inContext:\0" +
+	"distantFuture\0" +
+	"doCommandBySelector:\0" +
+	"dockTile\0" +
+	"documentCursor\0" +
+	"documentSource\0" +
+	"documentView\0" +
+	"documentViewShouldHandlePrint\0" +
+	"documentVisibleRect\0" +
+	"doubleClickAtIndex:\0" +
+	"doubleValue\0" +
+	"download\0" +
+	"download:decideDestinationWithSuggestedFilename:\0" +
+	"dragImage:at:offset:event:pasteboard:source:slideBack:\0" +
+	"dragImageForRowsWithIndexes:tableColumns:event:offset:\0" +
+	"dragSelectionWithEvent:offset:slideBack:\0" +
+	"draggedImage:beganAt:\0" +
+	"draggedImage:endedAt:operation:\0" +
+	"draggingDestinationWindow\0" +
+	"draggingEnded:\0" +
+	"draggingEntered:\0" +
+	"draggingExited:\0" +
+	"draggingLocation\0" +
+	"draggingPasteboard\0" +
+	"draggingSourceOperationMask\0" +
+	"draggingSourceOperationMaskForLocal:\0" +
+	"draggingUpdated:\0" +
+	"drawAtPoint:\0" +
+	"drawAtPoint:fromRect:operation:fraction:\0" +
+	"drawBackgroundForGlyphRange:atPoint:\0" +
+	"drawBackgroundInClipRect:\0" +
+	"drawFromPoint:toPoint:options:\0" +
+	"drawGlyphsForGlyphRange:atPoint:\0" +
+	"drawImage:withFrame:inView:\0" +
+	"drawInRect:\0" +
+	"drawInRect:angle:\0" +
+	"drawInRect:fromRect:operation:fraction:\0" +
+	"drawInteriorWithFrame:inView:\0" +
+	"drawLabel:inRect:\0" +
+	"drawRect:\0" +
+	"drawSortIndicatorWithFrame:inView:ascending:priority:\0" +
+	"drawStatusBarBackgroundInRect:withHighlight:\0" +
+	"drawTitle:withFrame:inView:\0" +
+	"drawViewBackgroundInRect:\0" +
+	"drawWithExpansionFrame:inView:\0" +
+	"drawingRectForBounds:\0" +
+	"elementAtIndex:associatedPoints:\0" +
+	"elementCount\0" +
+	"enableCursorRects\0" +
+	"enableFlushWindow\0" +
+	"endDocument\0" +
+	"endEditing\0" +
+	"endEditingFor:\0" +
+	"endGestureWithEvent:\0" +
+	"endPage\0" +
+	"endSheet:returnCode:\0" +
+	"enterExitEventWithType:location:modifierFlags:timestamp:windowNumber:context:eventNumber:trackingNumber:userData:\0" +
+	"enumeratorAtPath:\0" +
+	"expandItem:\0" +
+	"expandItem:expandChildren:\0" +
+	"expansionFrameWithFrame:inView:\0" +
+	"familyName\0" +
+	"fieldEditor:forObject:\0" +
+	"fileExistsAtPath:\0" +
+	"fileExistsAtPath:isDirectory:\0" +
+	"fileSystemRepresentation\0" +
+	"fileURLWithPath:\0" +
+	"filename\0" +
+	"filenames\0" +
+	"fill\0" +
+	"fillRect:\0" +
+	"finishLaunching\0" +
+	"firstIndex\0" +
+	"firstRectForCharacterRange:\0" +
+	"firstResponder\0" +
+	"flagsChanged:\0" +
+	"floatValue\0" +
+	"flushBuffer\0" +
+	"flushGraphics\0" +
+	"flushWindowIfNeeded\0" +
+	"font\0" +
+	"fontName\0" +
+	"fontWithFamily:traits:weight:size:\0" +
+	"fontWithName:size:\0" +
+	"frame\0" +
+	"frameOfCellAtColumn:row:\0" +
+	"frameOfOutlineCellAtRow:\0" +
+	"frameRectForContentRect:\0" +
+	"frameSizeForContentSize:hasHorizontalScroller:hasVerticalScroller:borderType:\0" +
+	"fullPathForApplication:\0" +
+	"generalPasteboard\0" +
+	"genericRGBColorSpace\0" +
+	"getBitmapDataPlanes:\0" +
+	"getBytes:\0" +
+	"getBytes:length:\0" +
+	"getCharacters:\0" +
+	"getCharacters:range:\0" +
+	"getComponents:\0" +
+	"getGlyphs:range:\0" +
+	"getGlyphsInRange:glyphs:characterIndexes:glyphInscriptions:elasticBits:bidiLevels:\0" +
+	"getIndexes:maxCount:inIndexRange:\0" +
+	"getInfoForFile:application:type:\0" +
+	"getValues:forAttribute:forVirtualScreen:\0" +
+	"globalContext\0" +
+	"glyphIndexForCharacterAtIndex:\0" +
+	"glyphIndexForPoint:inTextContainer:fractionOfDistanceThroughGlyph:\0" +
+	"glyphRangeForCharacterRange:actualCharacterRange:\0" +
+	"glyphRangeForTextContainer:\0" +
+	"goBack\0" +
+	"goForward\0" +
+	"graphicsContext\0" +
+	"graphicsContextWithBitmapImageRep:\0" +
+	"graphicsContextWithGraphicsPort:flipped:\0" +
+	"graphicsContextWithWindow:\0" +
+	"graphicsPort\0" +
+	"greenComponent\0" +
+	"handleEvent:\0" +
+	"handleFailureInFunction:file:lineNumber:description:\0" +
+	"handleFailureInMethod:object:file:lineNumber:description:\0" +
+	"handleMouseEvent:\0" +
+	"hasAlpha\0" +
+	"hasMarkedText\0" +
+	"hasPassword\0" +
+	"hasShadow\0" +
+	"headerCell\0" +
+	"headerRectOfColumn:\0" +
+	"headerView\0" +
+	"helpRequested:\0" +
+	"hide:\0" +
+	"hideOtherApplications:\0" +
+	"highlightColorInView:\0" +
+	"highlightColorWithFrame:inView:\0" +
+	"highlightSelectionInClipRect:\0" +
+	"hitPart\0" +
+	"hitTest:\0" +
+	"hitTestForEvent:inRect:ofView:\0" +
+	"host\0" +
+	"hotSpot\0" +
+	"hourOfDay\0" +
+	"iconForFile:\0" +
+	"iconForFileType:\0" +
+	"ignore\0" +
+	"ignoreModifierKeysWhileDragging\0" +
+	"image\0" +
+	"imageInterpolation\0" +
+	"imageNamed:\0" +
+	"imageRectForBounds:\0" +
+	"imageRepWithData:\0" +
+	"imageablePageBounds\0" +
+	"increment\0" +
+	"indentationPerLevel\0" +
+	"indexOfItemWithTarget:andAction:\0" +
+	"indexOfObjectIdenticalTo:\0" +
+	"indexOfSelectedItem\0" +
+	"indexSetWithIndex:\0" +
+	"infoDictionary\0" +
+	"init\0" +
+	"initByReferencingFile:\0" +
+	"initListDescriptor\0" +
+	"initWithAttributes:\0" +
+	"initWithBitmapDataPlanes:pixelsWide:pixelsHigh:bitsPerSample:samplesPerPixel:hasAlpha:isPlanar:colorSpaceName:bitmapFormat:bytesPerRow:bitsPerPixel:\0" +
+	"initWithBitmapDataPlanes:pixelsWide:pixelsHigh:bitsPerSample:samplesPerPixel:hasAlpha:isPlanar:colorSpaceName:bytesPerRow:bitsPerPixel:\0" +
+	"initWithCapacity:\0" +
+	"initWithCharacters:length:\0" +
+	"initWithContainerSize:\0" +
+	"initWithContentRect:styleMask:backing:defer:\0" +
+	"initWithContentRect:styleMask:backing:defer:screen:\0" +
+	"initWithContentsOfFile:\0" +
+	"initWithData:\0" +
+	"initWithDictionary:\0" +
+	"initWithFileWrapper:\0" +
+	"initWithFocusedViewRect:\0" +
+	"initWithFormat:shareContext:\0" +
+	"initWithFrame:\0" +
+	"initWithFrame:frameName:groupName:\0" +
+	"initWithFrame:pullsDown:\0" +
+	"initWithIconRef:\0" +
+	"initWithIdentifier:\0" +
+	"initWithImage:hotSpot:\0" +
+	"initWithIndex:\0" +
+	"initWithIndexSet:\0" +
+	"initWithIndexesInRange:\0" +
+	"initWithItemIdentifier:\0" +
+	"initWithLocaleIdentifier:\0" +
+	"initWithName:\0" +
+	"initWithRect:options:owner:userInfo:\0" +
+	"initWithSize:\0" +
+	"initWithStartingColor:endingColor:\0" +
+	"initWithString:\0" +
+	"initWithString:attributes:\0" +
+	"initWithTitle:\0" +
+	"initWithTitle:action:keyEquivalent:\0" +
+	"initWithTransform:\0" +
+	"initWithType:location:\0" +
+	"initWithURL:\0" +
+	"insertColor:key:atIndex:\0" +
+	"insertItem:atIndex:\0" +
+	"insertItemWithItemIdentifier:atIndex:\0" +
+	"insertItemWithObjectValue:atIndex:\0" +
+	"insertTabViewItem:atIndex:\0" +
+	"insertText:\0" +
+	"intValue\0" +
+	"integerValue\0" +
+	"intercellSpacing\0" +
+	"interpretKeyEvents:\0" +
+	"invalidate\0" +
+	"invalidateShadow\0" +
+	"invert\0" +
+	"isActive\0" +
+	"isDescendantOf:\0" +
+	"isDocumentEdited\0" +
+	"isDrawingToScreen\0" +
+	"isEmpty\0" +
+	"isEnabled\0" +
+	"isEqual:\0" +
+	"isEqualTo:\0" +
+	"isEqualToString:\0" +
+	"isExecutableFileAtPath:\0" +
+	"isFieldEditor\0" +
+	"isFilePackageAtPath:\0" +
+	"isFileURL\0" +
+	"isFlipped\0" +
+	"isHidden\0" +
+	"isHiddenOrHasHiddenAncestor\0" +
+	"isHighlighted\0" +
+	"isItemExpanded:\0" +
+	"isKeyWindow\0" +
+	"isKindOfClass:\0" +
+	"isMainThread\0" +
+	"isMainWindow\0" +
+	"isMiniaturized\0" +
+	"isOpaque\0" +
+	"isPlanar\0" +
+	"isResting\0" +
+	"isRowSelected:\0" +
+	"isRunning\0" +
+	"isSeparatorItem\0" +
+	"isSessionOnly\0" +
+	"isSheet\0" +
+	"isVisible\0" +
+	"isZoomed\0" +
+	"itemArray\0" +
+	"itemAtIndex:\0" +
+	"itemAtRow:\0" +
+	"itemHeight\0" +
+	"itemIdentifier\0" +
+	"itemObjectValueAtIndex:\0" +
+	"itemTitleAtIndex:\0" +
+	"itemWithTag:\0" +
+	"jobDisposition\0" +
+	"keyCode\0" +
+	"keyDown:\0" +
+	"keyEquivalent\0" +
+	"keyEquivalentModifierMask\0" +
+	"keyUp:\0" +
+	"keyWindow\0" +
+	"knobProportion\0" +
+	"knobThickness\0" +
+	"lastPathComponent\0" +
+	"layoutManager\0" +
+	"leading\0" +
+	"length\0" +
+	"level\0" +
+	"levelForItem:\0" +
+	"lineFragmentUsedRectForGlyphAtIndex:effectiveRange:\0" +
+	"lineFragmentUsedRectForGlyphAtIndex:effectiveRange:withoutAdditionalLayout:\0" +
+	"lineToPoint:\0" +
+	"linkTextAttributes\0" +
+	"loadHTMLString:baseURL:\0" +
+	"loadNibFile:externalNameTable:withZone:\0" +
+	"loadRequest:\0" +
+	"localizedDescription\0" +
+	"location\0" +
+	"locationForGlyphAtIndex:\0" +
+	"locationInWindow\0" +
+	"lockFocus\0" +
+	"lowercaseString\0" +
+	"magnification\0" +
+	"magnifyWithEvent:\0" +
+	"mainBundle\0" +
+	"mainFrame\0" +
+	"mainMenu\0" +
+	"mainRunLoop\0" +
+	"mainScreen\0" +
+	"mainWindow\0" +
+	"makeCurrentContext\0" +
+	"makeFirstResponder:\0" +
+	"makeKeyAndOrderFront:\0" +
+	"markedRange\0" +
+	"markedTextAttributes\0" +
+	"maxValue\0" +
+	"maximum\0" +
+	"maximumFractionDigits\0" +
+	"maximumIntegerDigits\0" +
+	"menu\0" +
+	"menu:willHighlightItem:\0" +
+	"menuBarFontOfSize:\0" +
+	"menuDidClose:\0" +
+	"menuFontOfSize:\0" +
+	"menuForEvent:\0" +
+	"menuNeedsUpdate:\0" +
+	"menuWillOpen:\0" +
+	"metaKey\0" +
+	"minFrameWidthWithTitle:styleMask:\0" +
+	"minSize\0" +
+	"minValue\0" +
+	"miniaturize:\0" +
+	"minimum\0" +
+	"minimumSize\0" +
+	"minuteOfHour\0" +
+	"modifierFlags\0" +
+	"monthOfYear\0" +
+	"mouse:inRect:\0" +
+	"mouseDown:\0" +
+	"mouseDownCanMoveWindow\0" +
+	"mouseDragged:\0" +
+	"mouseEntered:\0" +
+	"mouseExited:\0" +
+	"mouseLocation\0" +
+	"mouseLocationOutsideOfEventStream\0" +
+	"mouseMoved:\0" +
+	"mouseUp:\0" +
+	"moveColumn:toColumn:\0" +
+	"moveToBeginningOfParagraph:\0" +
+	"moveToEndOfParagraph:\0" +
+	"moveToPoint:\0" +
+	"moveUp:\0" +
+	"mutableCopy\0" +
+	"mutableString\0" +
+	"name\0" +
+	"needsPanelToBecomeKey\0" +
+	"nextEventMatchingMask:untilDate:inMode:dequeue:\0" +
+	"nextObject\0" +
+	"nextState\0" +
+	"nextWordFromIndex:forward:\0" +
+	"noResponderFor:\0" +
+	"normalizedPosition\0" +
+	"noteNumberOfRowsChanged\0" +
+	"numberOfColumns\0" +
+	"numberOfComponents\0" +
+	"numberOfGlyphs\0" +
+	"numberOfItems\0" +
+	"numberOfPlanes\0" +
+	"numberOfRows\0" +
+	"numberOfRowsInTableView:\0" +
+	"numberOfSelectedRows\0" +
+	"numberOfVisibleItems\0" +
+	"numberWithBool:\0" +
+	"numberWithDouble:\0" +
+	"numberWithInt:\0" +
+	"numberWithInteger:\0" +
+	"objCType\0" +
+	"object\0" +
+	"objectAtIndex:\0" +
+	"objectEnumerator\0" +
+	"objectForInfoDictionaryKey:\0" +
+	"objectForKey:\0" +
+	"objectValues\0" +
+	"openFile:withApplication:\0" +
+	"openPanel\0" +
+	"openURL:\0" +
+	"openURLs:withAppBundleIdentifier:options:additionalEventParamDescriptor:launchIdentifiers:\0" +
+	"operationNotAllowedCursor\0" +
+	"options\0" +
+	"orderBack:\0" +
+	"orderFront:\0" +
+	"orderFrontRegardless\0" +
+	"orderFrontStandardAboutPanel:\0" +
+	"orderOut:\0" +
+	"orderWindow:relativeTo:\0" +
+	"orderedWindows\0" +
+	"otherEventWithType:location:modifierFlags:timestamp:windowNumber:context:subtype:data1:data2:\0" +
+	"otherMouseDown:\0" +
+	"otherMouseDragged:\0" +
+	"otherMouseUp:\0" +
+	"outlineTableColumn\0" +
+	"outlineView:acceptDrop:item:childIndex:\0" +
+	"outlineView:child:ofItem:\0" +
+	"outlineView:didClickTableColumn:\0" +
+	"outlineView:isItemExpandable:\0" +
+	"outlineView:numberOfChildrenOfItem:\0" +
+	"outlineView:objectValueForTableColumn:byItem:\0" +
+	"outlineView:setObjectValue:forTableColumn:byItem:\0" +
+	"outlineView:shouldCollapseItem:\0" +
+	"outlineView:shouldEditTableColumn:item:\0" +
+	"outlineView:shouldExpandItem:\0" +
+	"outlineView:shouldReorderColumn:toColumn:\0" +
+	"outlineView:shouldSelectItem:\0" +
+	"outlineView:shouldTrackCell:forTableColumn:item:\0" +
+	"outlineView:validateDrop:proposedItem:proposedChildIndex:\0" +
+	"outlineView:willDisplayCell:forTableColumn:item:\0" +
+	"outlineView:writeItems:toPasteboard:\0" +
+	"outlineViewColumnDidMove:\0" +
+	"outlineViewColumnDidResize:\0" +
+	"outlineViewItemDidExpand:\0" +
+	"outlineViewSelectionDidChange:\0" +
+	"outlineViewSelectionIsChanging:\0" +
+	"owner\0" +
+	"pageDown:\0" +
+	"pageTitle\0" +
+	"pageUp:\0" +
+	"panel:shouldShowFilename:\0" +
+	"panelConvertFont:\0" +
+	"paperSize\0" +
+	"paragraphs\0" +
+	"parentWindow\0" +
+	"password\0" +
+	"paste:\0" +
+	"pasteboard:provideDataForType:\0" +
+	"pasteboardWithName:\0" +
+	"path\0" +
+	"pathExtension\0" +
+	"pathForResource:ofType:\0" +
+	"pathForResource:ofType:inDirectory:forLocalization:\0" +
+	"performDragOperation:\0" +
+	"performKeyEquivalent:\0" +
+	"performSelector:withObject:afterDelay:inModes:\0" +
+	"performSelectorOnMainThread:withObject:waitUntilDone:\0" +
+	"phase\0" +
+	"pixelsHigh\0" +
+	"pixelsWide\0" +
+	"pointSize\0" +
+	"pointValue\0" +
+	"pointingHandCursor\0" +
+	"pop\0" +
+	"popUpContextMenu:withEvent:forView:\0" +
+	"popUpStatusItemMenu:\0" +
+	"port\0" +
+	"postEvent:atStart:\0" +
+	"preparedCellAtColumn:row:\0" +
+	"prependTransform:\0" +
+	"preventDefault\0" +
+	"previousFailureCount\0" +
+	"printDocumentView\0" +
+	"printOperationWithPrintInfo:\0" +
+	"printOperationWithView:printInfo:\0" +
+	"printPanel\0" +
+	"printSettings\0" +
+	"printer\0" +
+	"printerNames\0" +
+	"printerWithName:\0" +
+	"propertyListForType:\0" +
+	"proposedCredential\0" +
+	"protectionSpace\0" +
+	"push\0" +
+	"rangeValue\0" +
+	"readSelectionFromPasteboard:\0" +
+	"realm\0" +
+	"recentSearches\0" +
+	"rectArrayForCharacterRange:withinSelectedCharacterRange:inTextContainer:rectCount:\0" +
+	"rectArrayForGlyphRange:withinSelectedGlyphRange:inTextContainer:rectCount:\0" +
+	"rectForPart:\0" +
+	"rectOfColumn:\0" +
+	"rectOfRow:\0" +
+	"rectValue\0" +
+	"redComponent\0" +
+	"redo\0" +
+	"reflectScrolledClipView:\0" +
+	"registerForDraggedTypes:\0" +
+	"release\0" +
+	"reload:\0" +
+	"reloadData\0" +
+	"reloadItem:reloadChildren:\0" +
+	"removeAllItems\0" +
+	"removeAllPoints\0" +
+	"removeAttribute:range:\0" +
+	"removeChildWindow:\0" +
+	"removeColorWithKey:\0" +
+	"removeFromSuperview\0" +
+	"removeIndex:\0" +
+	"removeItem:\0" +
+	"removeItemAtIndex:\0" +
+	"removeItemAtPath:error:\0" +
+	"removeLastObject\0" +
+	"removeObject:\0" +
+	"removeObjectAtIndex:\0" +
+	"removeObjectForKey:\0" +
+	"removeObjectIdenticalTo:\0" +
+	"removeObserver:\0" +
+	"removeObserver:name:object:\0" +
+	"removeRepresentation:\0" +
+	"removeStatusItem:\0" +
+	"removeTabViewItem:\0" +
+	"removeTableColumn:\0" +
+	"removeTemporaryAttribute:forCharacterRange:\0" +
+	"removeToolTip:\0" +
+	"removeTrackingArea:\0" +
+	"replaceCharactersInRange:withString:\0" +
+	"replyToOpenOrPrint:\0" +
+	"representation\0" +
+	"representations\0" +
+	"request\0" +
+	"requestWithURL:\0" +
+	"resetCursorRects\0" +
+	"resignFirstResponder\0" +
+	"resizeDownCursor\0" +
+	"resizeLeftCursor\0" +
+	"resizeLeftRightCursor\0" +
+	"resizeRightCursor\0" +
+	"resizeUpCursor\0" +
+	"resizeUpDownCursor\0" +
+	"resizingMask\0" +
+	"resourcePath\0" +
+	"respondsToSelector:\0" +
+	"restoreGraphicsState\0" +
+	"retain\0" +
+	"retainCount\0" +
+	"rightMouseDown:\0" +
+	"rightMouseDragged:\0" +
+	"rightMouseUp:\0" +
+	"rotateByDegrees:\0" +
+	"rotateWithEvent:\0" +
+	"rotation\0" +
+	"rowAtPoint:\0" +
+	"rowForItem:\0" +
+	"rowHeight\0" +
+	"rowsInRect:\0" +
+	"run\0" +
+	"runModal\0" +
+	"runModalForDirectory:file:\0" +
+	"runModalForWindow:\0" +
+	"runModalWithPrintInfo:\0" +
+	"runMode:beforeDate:\0" +
+	"runOperation\0" +
+	"samplesPerPixel\0" +
+	"saveGraphicsState\0" +
+	"savePanel\0" +
+	"scaleXBy:yBy:\0" +
+	"scheduledTimerWithTimeInterval:target:selector:userInfo:repeats:\0" +
+	"screen\0" +
+	"screenX\0" +
+	"screenY\0" +
+	"screens\0" +
+	"scrollClipView:toPoint:\0" +
+	"scrollColumnToVisible:\0" +
+	"scrollPoint:\0" +
+	"scrollRangeToVisible:\0" +
+	"scrollRectToVisible:\0" +
+	"scrollRowToVisible:\0" +
+	"scrollToPoint:\0" +
+	"scrollWheel:\0" +
+	"scrollerWidth\0" +
+	"scrollerWidthForControlSize:\0" +
+	"searchButtonCell\0" +
+	"searchTextRectForBounds:\0" +
+	"secondOfMinute\0" +
+	"secondarySelectedControlColor\0" +
+	"selectAll:\0" +
+	"selectItem:\0" +
+	"selectItemAtIndex:\0" +
+	"selectRowIndexes:byExtendingSelection:\0" +
+	"selectTabViewItemAtIndex:\0" +
+	"selectText:\0" +
+	"selectedControlColor\0" +
+	"selectedControlTextColor\0" +
+	"selectedRange\0" +
+	"selectedRow\0" +
+	"selectedRowIndexes\0" +
+	"selectedTabViewItem\0" +
+	"selectedTextAttributes\0" +
+	"selectedTextBackgroundColor\0" +
+	"selectedTextColor\0" +
+	"sendAction:to:\0" +
+	"sendAction:to:from:\0" +
+	"sendEvent:\0" +
+	"sender\0" +
+	"separatorItem\0" +
+	"set\0" +
+	"setAcceptsMouseMovedEvents:\0" +
+	"setAcceptsTouchEvents:\0" +
+	"setAccessoryView:\0" +
+	"setAction:\0" +
+	"setAlertStyle:\0" +
+	"setAlignment:\0" +
+	"setAllowsColumnReordering:\0" +
+	"setAllowsFloats:\0" +
+	"setAllowsMixedState:\0" +
+	"setAllowsMultipleSelection:\0" +
+	"setAllowsUndo:\0" +
+	"setAllowsUserCustomization:\0" +
+	"setAlpha:\0" +
+	"setAlphaValue:\0" +
+	"setAlternateButtonTitle:\0" +
+	"setApplicationIconImage:\0" +
+	"setApplicationNameForUserAgent:\0" +
+	"setAttachmentCell:\0" +
+	"setAttributedString:\0" +
+	"setAttributedStringValue:\0" +
+	"setAttributedTitle:\0" +
+	"setAutoenablesItems:\0" +
+	"setAutohidesScrollers:\0" +
+	"setAutoresizesOutlineColumn:\0" +
+	"setAutoresizesSubviews:\0" +
+	"setAutoresizingMask:\0" +
+	"setAutosaveExpandedItems:\0" +
+	"setBackgroundColor:\0" +
+	"setBackgroundLayoutEnabled:\0" +
+	"setBackgroundStyle:\0" +
+	"setBadgeLabel:\0" +
+	"setBaseWritingDirection:\0" +
+	"setBaseWritingDirection:range:\0" +
+	"setBecomesKeyOnlyIfNeeded:\0" +
+	"setBezelStyle:\0" +
+	"setBezeled:\0" +
+	"setBorderType:\0" +
+	"setBorderWidth:\0" +
+	"setBordered:\0" +
+	"setBoundsRotation:\0" +
+	"setBoxType:\0" +
+	"setButtonType:\0" +
+	"setCacheMode:\0" +
+	"setCachePolicy:\0" +
+	"setCanChooseDirectories:\0" +
+	"setCanChooseFiles:\0" +
+	"setCanCreateDirectories:\0" +
+	"setCancelButtonCell:\0" +
+	"setCell:\0" +
+	"setCellClass:\0" +
+	"setClip\0" +
+	"setCollectionBehavior:\0" +
+	"setColor:\0" +
+	"setColumnAutoresizingStyle:\0" +
+	"setCompositingOperation:\0" +
+	"setContainerSize:\0" +
+	"setContentView:\0" +
+	"setContentViewMargins:\0" +
+	"setControlSize:\0" +
+	"setCookie:\0" +
+	"setCopiesOnScroll:\0" +
+	"setCurrentContext:\0" +
+	"setCurrentOperation:\0" +
+	"setCustomUserAgent:\0" +
+	"setData:forType:\0" +
+	"setDataCell:\0" +
+	"setDataSource:\0" +
+	"setDatePickerElements:\0" +
+	"setDatePickerStyle:\0" +
+	"setDateValue:\0" +
+	"setDefaultButtonCell:\0" +
+	"setDefaultFlatness:\0" +
+	"setDefaultParagraphStyle:\0" +
+	"setDefaultTabInterval:\0" +
+	"setDelegate:\0" +
+	"setDestination:allowOverwrite:\0" +
+	"setDictionary:\0" +
+	"setDirectory:\0" +
+	"setDisplayMode:\0" +
+	"setDisplaysLinkToolTips:\0" +
+	"setDocumentCursor:\0" +
+	"setDocumentEdited:\0" +
+	"setDocumentView:\0" +
+	"setDoubleAction:\0" +
+	"setDoubleValue:\0" +
+	"setDownloadDelegate:\0" +
+	"setDrawsBackground:\0" +
+	"setDropItem:dropChildIndex:\0" +
+	"setDropRow:dropOperation:\0" +
+	"setEditable:\0" +
+	"setEnabled:\0" +
+	"setEnabled:forSegment:\0" +
+	"setFill\0" +
+	"setFillColor:\0" +
+	"setFireDate:\0" +
+	"setFirstLineHeadIndent:\0" +
+	"setFloatingPanel:\0" +
+	"setFocusRingType:\0" +
+	"setFont:\0" +
+	"setFormatter:\0" +
+	"setFrame:\0" +
+	"setFrame:display:\0" +
+	"setFrame:display:animate:\0" +
+	"setFrameFromContentFrame:\0" +
+	"setFrameLoadDelegate:\0" +
+	"setFrameOrigin:\0" +
+	"setFrameSize:\0" +
+	"setGridStyleMask:\0" +
+	"setHTTPBody:\0" +
+	"setHTTPMethod:\0" +
+	"setHasHorizontalScroller:\0" +
+	"setHasShadow:\0" +
+	"setHasVerticalScroller:\0" +
+	"setHeadIndent:\0" +
+	"setHeaderCell:\0" +
+	"setHeaderView:\0" +
+	"setHelpMenu:\0" +
+	"setHidden:\0" +
+	"setHiddenUntilMouseMoves:\0" +
+	"setHidesOnDeactivate:\0" +
+	"setHighlightMode:\0" +
+	"setHighlighted:\0" +
+	"setHighlightedTableColumn:\0" +
+	"setHighlightsBy:\0" +
+	"setHorizontalScroller:\0" +
+	"setHorizontallyResizable:\0" +
+	"setIcon:\0" +
+	"setIdentifier:\0" +
+	"setImage:\0" +
+	"setImage:forSegment:\0" +
+	"setImageAlignment:\0" +
+	"setImageInterpolation:\0" +
+	"setImagePosition:\0" +
+	"setImageScaling:\0" +
+	"setIncrement:\0" +
+	"setIndeterminate:\0" +
+	"setIndicatorImage:inTableColumn:\0" +
+	"setInteger:forKey:\0" +
+	"setIntercellSpacing:\0" +
+	"setJavaEnabled:\0" +
+	"setJavaScriptEnabled:\0" +
+	"setJobDisposition:\0" +
+	"setJobTitle:\0" +
+	"setKeyEquivalent:\0" +
+	"setKeyEquivalentModifierMask:\0" +
+	"setKnobProportion:\0" +
+	"setLabel:\0" +
+	"setLabel:forSegment:\0" +
+	"setLeaf:\0" +
+	"setLength:\0" +
+	"setLevel:\0" +
+	"setLineBreakMode:\0" +
+	"setLineCapStyle:\0" +
+	"setLineDash:count:phase:\0" +
+	"setLineFragmentPadding:\0" +
+	"setLineFragmentRect:forGlyphRange:usedRect:\0" +
+	"setLineJoinStyle:\0" +
+	"setLineSpacing:\0" +
+	"setLineWidth:\0" +
+	"setLinkTextAttributes:\0" +
+	"setMainMenu:\0" +
+	"setMarkedText:selectedRange:\0" +
+	"setMaxSize:\0" +
+	"setMaxValue:\0" +
+	"setMaximum:\0" +
+	"setMaximumFractionDigits:\0" +
+	"setMaximumIntegerDigits:\0" +
+	"setMenu:\0" +
+	"setMenu:forSegment:\0" +
+	"setMenuFormRepresentation:\0" +
+	"setMessage:\0" +
+	"setMessageText:\0" +
+	"setMinSize:\0" +
+	"setMinValue:\0" +
+	"setMinWidth:\0" +
+	"setMinimum:\0" +
+	"setMinimumFractionDigits:\0" +
+	"setMinimumIntegerDigits:\0" +
+	"setMiterLimit:\0" +
+	"setNeedsDisplay:\0" +
+	"setNeedsDisplayInRect:\0" +
+	"setNumberOfVisibleItems:\0" +
+	"setNumberStyle:\0" +
+	"setObject:forKey:\0" +
+	"setObjectValue:\0" +
+	"setOnMouseEntered:\0" +
+	"setOpaque:\0" +
+	"setOptions:\0" +
+	"setOutlineTableColumn:\0" +
+	"setPaletteLabel:\0" +
+	"setPanelFont:isMultiple:\0" +
+	"setPartialStringValidationEnabled:\0" +
+	"setPatternPhase:\0" +
+	"setPlaceholderString:\0" +
+	"setPolicyDelegate:\0" +
+	"setPreferences:\0" +
+	"setPrinter:\0" +
+	"setPropertyList:forType:\0" +
+	"setPullsDown:\0" +
+	"setReleasedWhenClosed:\0" +
+	"setRepresentedFilename:\0" +
+	"setRepresentedURL:\0" +
+	"setResizingMask:\0" +
+	"setResourceLoadDelegate:\0" +
+	"setRichText:\0" +
+	"setRowHeight:\0" +
+	"setScalesWhenResized:\0" +
+	"setScrollable:\0" +
+	"setSearchButtonCell:\0" +
+	"setSegmentCount:\0" +
+	"setSegmentStyle:\0" +
+	"setSelectable:\0" +
+	"setSelected:forSegment:\0" +
+	"setSelectedItemIdentifier:\0" +
+	"setSelectedRange:\0" +
+	"setSelectedSegment:\0" +
+	"setSelectedTextAttributes:\0" +
+	"setServicesMenu:\0" +
+	"setShouldAntialias:\0" +
+	"setShowsHelp:\0" +
+	"setShowsPrintPanel:\0" +
+	"setShowsProgressPanel:\0" +
+	"setShowsResizeIndicator:\0" +
+	"setShowsToolbarButton:\0" +
+	"setSize:\0" +
+	"setState:\0" +
+	"setString:\0" +
+	"setString:forType:\0" +
+	"setStringValue:\0" +
+	"setStroke\0" +
+	"setSubmenu:\0" +
+	"setSubmenu:forItem:\0" +
+	"setTabStops:\0" +
+	"setTabViewType:\0" +
+	"setTag:\0" +
+	"setTag:forSegment:\0" +
+	"setTarget:\0" +
+	"setTextColor:\0" +
+	"setTextStorage:\0" +
+	"setTitle:\0" +
+	"setTitleFont:\0" +
+	"setTitlePosition:\0" +
+	"setToolTip:\0" +
+	"setToolTip:forSegment:\0" +
+	"setToolbar:\0" +
+	"setTrackingMode:\0" +
+	"setTransformStruct:\0" +
+	"setUIDelegate:\0" +
+	"setURL:\0" +
+	"setUpPrintOperationDefaultValues\0" +
+	"setUsesAlternatingRowBackgroundColors:\0" +
+	"setUsesFontPanel:\0" +
+	"setUsesScreenFonts:\0" +
+	"setUsesSingleLineMode:\0" +
+	"setUsesThreadedAnimation:\0" +
+	"setValue:forHTTPHeaderField:\0" +
+	"setValue:forKey:\0" +
+	"setValueWraps:\0" +
+	"setValues:forParameter:\0" +
+	"setVerticalScroller:\0" +
+	"setView:\0" +
+	"setVisible:\0" +
+	"setWantsRestingTouches:\0" +
+	"setWidth:\0" +
+	"setWidth:forSegment:\0" +
+	"setWidthTracksTextView:\0" +
+	"setWindingRule:\0" +
+	"setWorksWhenModal:\0" +
+	"setWraps:\0" +
+	"sharedApplication\0" +
+	"sharedCertificateTrustPanel\0" +
+	"sharedColorPanel\0" +
+	"sharedFontManager\0" +
+	"sharedFontPanel\0" +
+	"sharedHTTPCookieStorage\0" +
+	"sharedPrintInfo\0" +
+	"sharedWorkspace\0" +
+	"shiftKey\0" +
+	"shouldAntialias\0" +
+	"shouldChangeTextInRange:replacementString:\0" +
+	"shouldDelayWindowOrderingForEvent:\0" +
+	"shouldDrawInsertionPoint\0" +
+	"size\0" +
+	"sizeOfLabel:\0" +
+	"sizeToFit\0" +
+	"sizeValue\0" +
+	"skipDescendents\0" +
+	"smallSystemFontSize\0" +
+	"sortIndicatorRectForBounds:\0" +
+	"standardPreferences\0" +
+	"standardUserDefaults\0" +
+	"standardWindowButton:\0" +
+	"startAnimation:\0" +
+	"state\0" +
+	"statusItemWithLength:\0" +
+	"stop:\0" +
+	"stopAnimation:\0" +
+	"stopLoading:\0" +
+	"string\0" +
+	"stringByAddingPercentEscapesUsingEncoding:\0" +
+	"stringByAppendingPathComponent:\0" +
+	"stringByAppendingPathExtension:\0" +
+	"stringByAppendingString:\0" +
+	"stringByDeletingLastPathComponent\0" +
+	"stringByDeletingPathExtension\0" +
+	"stringByReplacingOccurrencesOfString:withString:\0" +
+	"stringByReplacingPercentEscapesUsingEncoding:\0" +
+	"stringForObjectValue:\0" +
+	"stringForType:\0" +
+	"stringValue\0" +
+	"stringWithCharacters:length:\0" +
+	"stringWithFormat:\0" +
+	"stringWithUTF8String:\0" +
+	"stroke\0" +
+	"strokeRect:\0" +
+	"styleMask\0" +
+	"submenu\0" +
+	"subviews\0" +
+	"superclass\0" +
+	"superview\0" +
+	"swipeWithEvent:\0" +
+	"systemFontOfSize:\0" +
+	"systemFontSize\0" +
+	"systemFontSizeForControlSize:\0" +
+	"systemStatusBar\0" +
+	"systemVersion\0" +
+	"tabStopType\0" +
+	"tabStops\0" +
+	"tabView:didSelectTabViewItem:\0" +
+	"tabView:shouldSelectTabViewItem:\0" +
+	"tabView:willSelectTabViewItem:\0" +
+	"tabViewItemAtPoint:\0" +
+	"tableColumns\0" +
+	"tableView:acceptDrop:row:dropOperation:\0" +
+	"tableView:didClickTableColumn:\0" +
+	"tableView:objectValueForTableColumn:row:\0" +
+	"tableView:setObjectValue:forTableColumn:row:\0" +
+	"tableView:shouldEditTableColumn:row:\0" +
+	"tableView:shouldReorderColumn:toColumn:\0" +
+	"tableView:shouldSelectRow:\0" +
+	"tableView:shouldTrackCell:forTableColumn:row:\0" +
+	"tableView:validateDrop:proposedRow:proposedDropOperation:\0" +
+	"tableView:willDisplayCell:forTableColumn:row:\0" +
+	"tableView:writeRowsWithIndexes:toPasteboard:\0" +
+	"tableViewColumnDidMove:\0" +
+	"tableViewColumnDidResize:\0" +
+	"tableViewSelectionDidChange:\0" +
+	"tableViewSelectionIsChanging:\0" +
+	"tag\0" +
+	"target\0" +
+	"terminate:\0" +
+	"testPart:\0" +
+	"textBackgroundColor\0" +
+	"textColor\0" +
+	"textContainer\0" +
+	"textDidChange:\0" +
+	"textDidEndEditing:\0" +
+	"textStorage\0" +
+	"textView:clickedOnLink:atIndex:\0" +
+	"textView:willChangeSelectionFromCharacterRange:toCharacterRange:\0" +
+	"textViewDidChangeSelection:\0" +
+	"thickness\0" +
+	"threadDictionary\0" +
+	"tile\0" +
+	"timeZone\0" +
+	"timestamp\0" +
+	"title\0" +
+	"titleCell\0" +
+	"titleFont\0" +
+	"titleOfSelectedItem\0" +
+	"titleRectForBounds:\0" +
+	"toggleToolbarShown:\0" +
+	"toolbar\0" +
+	"toolbar:itemForItemIdentifier:willBeInsertedIntoToolbar:\0" +
+	"toolbarAllowedItemIdentifiers:\0" +
+	"toolbarDefaultItemIdentifiers:\0" +
+	"toolbarDidRemoveItem:\0" +
+	"toolbarSelectableItemIdentifiers:\0" +
+	"toolbarWillAddItem:\0" +
+	"touchesBeganWithEvent:\0" +
+	"touchesCancelledWithEvent:\0" +
+	"touchesEndedWithEvent:\0" +
+	"touchesMatchingPhase:inView:\0" +
+	"touchesMovedWithEvent:\0" +
+	"trackingAreas\0" +
+	"traitsOfFont:\0" +
+	"transform\0" +
+	"transformPoint:\0" +
+	"transformSize:\0" +
+	"transformStruct\0" +
+	"transformUsingAffineTransform:\0" +
+	"translateXBy:yBy:\0" +
+	"type\0" +
+	"type:conformsToType:\0" +
+	"typeOfFile:error:\0" +
+	"types\0" +
+	"typesetter\0" +
+	"unarchiveObjectWithData:\0" +
+	"undefined\0" +
+	"undo\0" +
+	"undoManager\0" +
+	"unhideAllApplications:\0" +
+	"unlockFocus\0" +
+	"unmarkText\0" +
+	"unregisterDraggedTypes\0" +
+	"update\0" +
+	"updateFromPMPrintSettings\0" +
+	"updateTrackingAreas\0" +
+	"use\0" +
+	"useCredential:forAuthenticationChallenge:\0" +
+	"usedRectForTextContainer:\0" +
+	"user\0" +
+	"userInfo\0" +
+	"userSpaceScaleFactor\0" +
+	"usesAlternatingRowBackgroundColors\0" +
+	"validAttributesForMarkedText\0" +
+	"validModesForFontPanel:\0" +
+	"validRequestorForSendType:returnType:\0" +
+	"validateMenuItem:\0" +
+	"validateVisibleColumns\0" +
+	"value\0" +
+	"valueForKey:\0" +
+	"valueWithPoint:\0" +
+	"valueWithRange:\0" +
+	"valueWithRect:\0" +
+	"valueWithSize:\0" +
+	"view\0" +
+	"view:stringForToolTip:point:userData:\0" +
+	"viewDidMoveToWindow\0" +
+	"viewWillMoveToWindow:\0" +
+	"visibleFrame\0" +
+	"visibleRect\0" +
+	"wantsPeriodicDraggingUpdates\0" +
+	"wantsToHandleMouseEvents\0" +
+	"webFrame\0" +
+	"webScriptValueAtIndex:\0" +
+	"webView:contextMenuItemsForElement:defaultMenuItems:\0" +
+	"webView:createWebViewWithRequest:\0" +
+	"webView:decidePolicyForMIMEType:request:frame:decisionListener:\0" +
+	"webView:decidePolicyForNavigationAction:request:frame:decisionListener:\0" +
+	"webView:decidePolicyForNewWindowAction:request:newFrameName:decisionListener:\0" +
+	"webView:didChangeLocationWithinPageForFrame:\0" +
+	"webView:didCommitLoadForFrame:\0" +
+	"webView:didFailProvisionalLoadWithError:forFrame:\0" +
+	"webView:didFinishLoadForFrame:\0" +
+	"webView:didReceiveTitle:forFrame:\0" +
+	"webView:didStartProvisionalLoadForFrame:\0" +
+	"webView:identifierForInitialRequest:fromDataSource:\0" +
+	"webView:mouseDidMoveOverElement:modifierFlags:\0" +
+	"webView:printFrameView:\0" +
+	"webView:resource:didFailLoadingWithError:fromDataSource:\0" +
+	"webView:resource:didFinishLoadingFromDataSource:\0" +
+	"webView:resource:didReceiveAuthenticationChallenge:fromDataSource:\0" +
+	"webView:resource:willSendRequest:redirectResponse:fromDataSource:\0" +
+	"webView:runBeforeUnloadConfirmPanelWithMessage:initiatedByFrame:\0" +
+	"webView:runJavaScriptAlertPanelWithMessage:\0" +
+	"webView:runJavaScriptAlertPanelWithMessage:initiatedByFrame:\0" +
+	"webView:runJavaScriptConfirmPanelWithMessage:\0" +
+	"webView:runJavaScriptConfirmPanelWithMessage:initiatedByFrame:\0" +
+	"webView:runOpenPanelForFileButtonWithResultListener:\0" +
+	"webView:setFrame:\0" +
+	"webView:setResizable:\0" +
+	"webView:setStatusBarVisible:\0" +
+	"webView:setStatusText:\0" +
+	"webView:setToolbarsVisible:\0" +
+	"webView:unableToImplementPolicyWithError:frame:\0" +
+	"webView:windowScriptObjectAvailable:\0" +
+	"webViewClose:\0" +
+	"webViewFocus:\0" +
+	"webViewShow:\0" +
+	"webViewUnfocus:\0" +
+	"weightOfFont:\0" +
+	"wheelDelta\0" +
+	"width\0" +
+	"window\0" +
+	"windowBackgroundColor\0" +
+	"windowDidBecomeKey:\0" +
+	"windowDidDeminiaturize:\0" +
+	"windowDidMiniaturize:\0" +
+	"windowDidMove:\0" +
+	"windowDidResignKey:\0" +
+	"windowDidResize:\0" +
+	"windowFrameColor\0" +
+	"windowFrameTextColor\0" +
+	"windowNumber\0" +
+	"windowNumberAtPoint:belowWindowWithWindowNumber:\0" +
+	"windowRef\0" +
+	"windowShouldClose:\0" +
+	"windowWillClose:\0" +
+	"windowWithWindowNumber:\0" +
+	"windows\0" +
+	"worksWhenModal\0" +
+	"wraps\0" +
+	"writeSelectionToPasteboard:types:\0" +
+	"writeToPasteboard:\0" +
+	"yearOfCommonEra\0" +
+	"zoom:\0");
+public static final long /*int*/ sel_CGEvent = SELECTORS[0];
+public static final long /*int*/ sel_DOMDocument = SELECTORS[1];
+public static final long /*int*/ sel_IBeamCursor = SELECTORS[2];
+public static final long /*int*/ sel_PMPrintSession = SELECTORS[3];
+public static final long /*int*/ sel_PMPrintSettings = SELECTORS[4];
+public static final long /*int*/ sel_TIFFRepresentation = SELECTORS[5];
+public static final long /*int*/ sel_URL = SELECTORS[6];
+public static final long /*int*/ sel_URLFromPasteboard_ = SELECTORS[7];
+public static final long /*int*/ sel_URLWithString_ = SELECTORS[8];
+public static final long /*int*/ sel_URLsForDirectory_inDomains_ = SELECTORS[9];
+public static final long /*int*/ sel_UTF8String = SELECTORS[10];
+public static final long /*int*/ sel_abortEditing = SELECTORS[11];
+public static final long /*int*/ sel_absoluteString = SELECTORS[12];
+public static final long /*int*/ sel_acceptsFirstMouse_ = SELECTORS[13];
+public static final long /*int*/ sel_acceptsFirstResponder = SELECTORS[14];
+public static final long /*int*/ sel_accessibilityActionDescription_ = SELECTORS[15];
+public static final long /*int*/ sel_accessibilityActionNames = SELECTORS[16];
+public static final long /*int*/ sel_accessibilityAttributeNames = SELECTORS[17];
+public static final long /*int*/ sel_accessibilityAttributeValue_ = SELECTORS[18];
+public static final long /*int*/ sel_accessibilityAttributeValue_forParameter_ = SELECTORS[19];
+public static final long /*int*/ sel_accessibilityFocusedUIElement = SELECTORS[20];
+public static final long /*int*/ sel_accessibilityHitTest_ = SELECTORS[21];
+public static final long /*int*/ sel_accessibilityIsAttributeSettable_ = SELECTORS[22];
+public static final long /*int*/ sel_accessibilityIsIgnored = SELECTORS[23];
+public static final long /*int*/ sel_accessibilityParameterizedAttributeNames = SELECTORS[24];
+public static final long /*int*/ sel_accessibilityPerformAction_ = SELECTORS[25];
+public static final long /*int*/ sel_accessibilitySetOverrideValue_forAttribute_ = SELECTORS[26];
+public static final long /*int*/ sel_accessibilitySetValue_forAttribute_ = SELECTORS[27];
+public static final long /*int*/ sel_action = SELECTORS[28];
+public static final long /*int*/ sel_activateIgnoringOtherApps_ = SELECTORS[29];
+public static final long /*int*/ sel_addAttribute_value_range_ = SELECTORS[30];
+public static final long /*int*/ sel_addButtonWithTitle_ = SELECTORS[31];
+public static final long /*int*/ sel_addChildWindow_ordered_ = SELECTORS[32];
+public static final long /*int*/ sel_addClip = SELECTORS[33];
+public static final long /*int*/ sel_addEventListener_listener_useCapture_ = SELECTORS[34];
+public static final long /*int*/ sel_addIndex_ = SELECTORS[35];
+public static final long /*int*/ sel_addItem_ = SELECTORS[36];
+public static final long /*int*/ sel_addItemWithObjectValue_ = SELECTORS[37];
+public static final long /*int*/ sel_addItemWithTitle_action_keyEquivalent_ = SELECTORS[38];
+public static final long /*int*/ sel_addLayoutManager_ = SELECTORS[39];
+public static final long /*int*/ sel_addObject_ = SELECTORS[40];
+public static final long /*int*/ sel_addObjectsFromArray_ = SELECTORS[41];
+public static final long /*int*/ sel_addObserver_selector_name_object_ = SELECTORS[42];
+public static final long /*int*/ sel_addRepresentation_ = SELECTORS[43];
+public static final long /*int*/ sel_addSubview_ = SELECTORS[44];
+public static final long /*int*/ sel_addSubview_positioned_relativeTo_ = SELECTORS[45];
+public static final long /*int*/ sel_addTabStop_ = SELECTORS[46];
+public static final long /*int*/ sel_addTabViewItem_ = SELECTORS[47];
+public static final long /*int*/ sel_addTableColumn_ = SELECTORS[48];
+public static final long /*int*/ sel_addTemporaryAttribute_value_forCharacterRange_ = SELECTORS[49];
+public static final long /*int*/ sel_addTextContainer_ = SELECTORS[50];
+public static final long /*int*/ sel_addTimer_forMode_ = SELECTORS[51];
+public static final long /*int*/ sel_addToolTipRect_owner_userData_ = SELECTORS[52];
+public static final long /*int*/ sel_addTypes_owner_ = SELECTORS[53];
+public static final long /*int*/ sel_alignment = SELECTORS[54];
+public static final long /*int*/ sel_allKeys = SELECTORS[55];
+public static final long /*int*/ sel_allObjects = SELECTORS[56];
+public static final long /*int*/ sel_alloc = SELECTORS[57];
+public static final long /*int*/ sel_allowsColumnReordering = SELECTORS[58];
+public static final long /*int*/ sel_allowsFloats = SELECTORS[59];
+public static final long /*int*/ sel_alphaComponent = SELECTORS[60];
+public static final long /*int*/ sel_alphaValue = SELECTORS[61];
+public static final long /*int*/ sel_altKey = SELECTORS[62];
+public static final long /*int*/ sel_alternateSelectedControlColor = SELECTORS[63];
+public static final long /*int*/ sel_alternateSelectedControlTextColor = SELECTORS[64];
+public static final long /*int*/ sel_alwaysShowsDecimalSeparator = SELECTORS[65];
+public static final long /*int*/ sel_appendAttributedString_ = SELECTORS[66];
+public static final long /*int*/ sel_appendBezierPath_ = SELECTORS[67];
+public static final long /*int*/ sel_appendBezierPathWithArcWithCenter_radius_startAngle_endAngle_ = SELECTORS[68];
+public static final long /*int*/ sel_appendBezierPathWithArcWithCenter_radius_startAngle_endAngle_clockwise_ = SELECTORS[69];
+public static final long /*int*/ sel_appendBezierPathWithGlyphs_count_inFont_ = SELECTORS[70];
+public static final long /*int*/ sel_appendBezierPathWithOvalInRect_ = SELECTORS[71];
+public static final long /*int*/ sel_appendBezierPathWithRect_ = SELECTORS[72];
+public static final long /*int*/ sel_appendBezierPathWithRoundedRect_xRadius_yRadius_ = SELECTORS[73];
+public static final long /*int*/ sel_appendString_ = SELECTORS[74];
+public static final long /*int*/ sel_application_openFile_ = SELECTORS[75];
+public static final long /*int*/ sel_application_openFiles_ = SELECTORS[76];
+public static final long /*int*/ sel_applicationDidBecomeActive_ = SELECTORS[77];
+public static final long /*int*/ sel_applicationDidFinishLaunching_ = SELECTORS[78];
+public static final long /*int*/ sel_applicationDidResignActive_ = SELECTORS[79];
+public static final long /*int*/ sel_applicationDockMenu_ = SELECTORS[80];
+public static final long /*int*/ sel_applicationIconImage = SELECTORS[81];
+public static final long /*int*/ sel_applicationShouldHandleReopen_hasVisibleWindows_ = SELECTORS[82];
+public static final long /*int*/ sel_applicationShouldTerminate_ = SELECTORS[83];
+public static final long /*int*/ sel_applicationWillFinishLaunching_ = SELECTORS[84];
+public static final long /*int*/ sel_applicationWillTerminate_ = SELECTORS[85];
+public static final long /*int*/ sel_archivedDataWithRootObject_ = SELECTORS[86];
+public static final long /*int*/ sel_areCursorRectsEnabled = SELECTORS[87];
+public static final long /*int*/ sel_arrangeInFront_ = SELECTORS[88];
+public static final long /*int*/ sel_array = SELECTORS[89];
+public static final long /*int*/ sel_arrayWithCapacity_ = SELECTORS[90];
+public static final long /*int*/ sel_arrayWithObject_ = SELECTORS[91];
+public static final long /*int*/ sel_arrowCursor = SELECTORS[92];
+public static final long /*int*/ sel_ascender = SELECTORS[93];
+public static final long /*int*/ sel_attachColorList_ = SELECTORS[94];
+public static final long /*int*/ sel_attribute_atIndex_effectiveRange_ = SELECTORS[95];
+public static final long /*int*/ sel_attributedStringValue = SELECTORS[96];
+public static final long /*int*/ sel_attributedStringWithAttachment_ = SELECTORS[97];
+public static final long /*int*/ sel_attributedSubstringFromRange_ = SELECTORS[98];
+public static final long /*int*/ sel_attributedTitle = SELECTORS[99];
+public static final long /*int*/ sel_attributesAtIndex_longestEffectiveRange_inRange_ = SELECTORS[100];
+public static final long /*int*/ sel_autorelease = SELECTORS[101];
+public static final long /*int*/ sel_availableFontFamilies = SELECTORS[102];
+public static final long /*int*/ sel_availableFonts = SELECTORS[103];
+public static final long /*int*/ sel_availableMembersOfFontFamily_ = SELECTORS[104];
+public static final long /*int*/ sel_availableTypeFromArray_ = SELECTORS[105];
+public static final long /*int*/ sel_backgroundColor = SELECTORS[106];
+public static final long /*int*/ sel_backingScaleFactor = SELECTORS[107];
+public static final long /*int*/ sel_badgeLabel = SELECTORS[108];
+public static final long /*int*/ sel_baselineOffsetInLayoutManager_glyphIndex_ = SELECTORS[109];
+public static final long /*int*/ sel_becomeFirstResponder = SELECTORS[110];
+public static final long /*int*/ sel_becomeKeyWindow = SELECTORS[111];
+public static final long /*int*/ sel_beginDocument = SELECTORS[112];
+public static final long /*int*/ sel_beginEditing = SELECTORS[113];
+public static final long /*int*/ sel_beginGestureWithEvent_ = SELECTORS[114];
+public static final long /*int*/ sel_beginPageInRect_atPlacement_ = SELECTORS[115];
+public static final long /*int*/ sel_beginSheet_modalForWindow_modalDelegate_didEndSelector_contextInfo_ = SELECTORS[116];
+public static final long /*int*/ sel_beginSheetForWindow_modalDelegate_didEndSelector_contextInfo_trust_message_ = SELECTORS[117];
+public static final long /*int*/ sel_beginSheetModalForWindow_modalDelegate_didEndSelector_contextInfo_ = SELECTORS[118];
+public static final long /*int*/ sel_beginSheetWithPrintInfo_modalForWindow_delegate_didEndSelector_contextInfo_ = SELECTORS[119];
+public static final long /*int*/ sel_bestRepresentationForDevice_ = SELECTORS[120];
+public static final long /*int*/ sel_bezierPath = SELECTORS[121];
+public static final long /*int*/ sel_bezierPathByFlatteningPath = SELECTORS[122];
+public static final long /*int*/ sel_bezierPathWithRect_ = SELECTORS[123];
+public static final long /*int*/ sel_bitmapData = SELECTORS[124];
+public static final long /*int*/ sel_bitmapFormat = SELECTORS[125];
+public static final long /*int*/ sel_bitsPerPixel = SELECTORS[126];
+public static final long /*int*/ sel_bitsPerSample = SELECTORS[127];
+public static final long /*int*/ sel_blackColor = SELECTORS[128];
+public static final long /*int*/ sel_blueComponent = SELECTORS[129];
+public static final long /*int*/ sel_boolValue = SELECTORS[130];
+public static final long /*int*/ sel_borderWidth = SELECTORS[131];
+public static final long /*int*/ sel_boundingRectForGlyphRange_inTextContainer_ = SELECTORS[132];
+public static final long /*int*/ sel_boundingRectWithSize_options_ = SELECTORS[133];
+public static final long /*int*/ sel_bounds = SELECTORS[134];
+public static final long /*int*/ sel_bundleIdentifier = SELECTORS[135];
+public static final long /*int*/ sel_bundlePath = SELECTORS[136];
+public static final long /*int*/ sel_bundleWithIdentifier_ = SELECTORS[137];
+public static final long /*int*/ sel_bundleWithPath_ = SELECTORS[138];
+public static final long /*int*/ sel_button = SELECTORS[139];
+public static final long /*int*/ sel_buttonNumber = SELECTORS[140];
+public static final long /*int*/ sel_bytes = SELECTORS[141];
+public static final long /*int*/ sel_bytesPerPlane = SELECTORS[142];
+public static final long /*int*/ sel_bytesPerRow = SELECTORS[143];
+public static final long /*int*/ sel_calendarDate = SELECTORS[144];
+public static final long /*int*/ sel_canBecomeKeyView = SELECTORS[145];
+public static final long /*int*/ sel_canBecomeKeyWindow = SELECTORS[146];
+public static final long /*int*/ sel_canDragRowsWithIndexes_atPoint_ = SELECTORS[147];
+public static final long /*int*/ sel_canGoBack = SELECTORS[148];
+public static final long /*int*/ sel_canGoForward = SELECTORS[149];
+public static final long /*int*/ sel_canRedo = SELECTORS[150];
+public static final long /*int*/ sel_canShowMIMEType_ = SELECTORS[151];
+public static final long /*int*/ sel_canUndo = SELECTORS[152];
+public static final long /*int*/ sel_cancel = SELECTORS[153];
+public static final long /*int*/ sel_cancelAuthenticationChallenge_ = SELECTORS[154];
+public static final long /*int*/ sel_cancelButtonCell = SELECTORS[155];
+public static final long /*int*/ sel_cancelOperation_ = SELECTORS[156];
+public static final long /*int*/ sel_cancelTracking = SELECTORS[157];
+public static final long /*int*/ sel_cascadeTopLeftFromPoint_ = SELECTORS[158];
+public static final long /*int*/ sel_cell = SELECTORS[159];
+public static final long /*int*/ sel_cellClass = SELECTORS[160];
+public static final long /*int*/ sel_cellSize = SELECTORS[161];
+public static final long /*int*/ sel_cellSizeForBounds_ = SELECTORS[162];
+public static final long /*int*/ sel_changeColor_ = SELECTORS[163];
+public static final long /*int*/ sel_changeFont_ = SELECTORS[164];
+public static final long /*int*/ sel_charCode = SELECTORS[165];
+public static final long /*int*/ sel_characterAtIndex_ = SELECTORS[166];
+public static final long /*int*/ sel_characterIndexForGlyphAtIndex_ = SELECTORS[167];
+public static final long /*int*/ sel_characterIndexForInsertionAtPoint_ = SELECTORS[168];
+public static final long /*int*/ sel_characterIndexForPoint_ = SELECTORS[169];
+public static final long /*int*/ sel_characterIsMember_ = SELECTORS[170];
+public static final long /*int*/ sel_characters = SELECTORS[171];
+public static final long /*int*/ sel_charactersIgnoringModifiers = SELECTORS[172];
+public static final long /*int*/ sel_chooseFilename_ = SELECTORS[173];
+public static final long /*int*/ sel_className = SELECTORS[174];
+public static final long /*int*/ sel_cleanUpOperation = SELECTORS[175];
+public static final long /*int*/ sel_clearColor = SELECTORS[176];
+public static final long /*int*/ sel_clearCurrentContext = SELECTORS[177];
+public static final long /*int*/ sel_clearDrawable = SELECTORS[178];
+public static final long /*int*/ sel_clickCount = SELECTORS[179];
+public static final long /*int*/ sel_clickedColumn = SELECTORS[180];
+public static final long /*int*/ sel_clickedRow = SELECTORS[181];
+public static final long /*int*/ sel_close = SELECTORS[182];
+public static final long /*int*/ sel_closePath = SELECTORS[183];
+public static final long /*int*/ sel_code = SELECTORS[184];
+public static final long /*int*/ sel_collapseItem_ = SELECTORS[185];
+public static final long /*int*/ sel_collapseItem_collapseChildren_ = SELECTORS[186];
+public static final long /*int*/ sel_collectionBehavior = SELECTORS[187];
+public static final long /*int*/ sel_color = SELECTORS[188];
+public static final long /*int*/ sel_colorAtX_y_ = SELECTORS[189];
+public static final long /*int*/ sel_colorListNamed_ = SELECTORS[190];
+public static final long /*int*/ sel_colorSpace = SELECTORS[191];
+public static final long /*int*/ sel_colorSpaceModel = SELECTORS[192];
+public static final long /*int*/ sel_colorSpaceName = SELECTORS[193];
+public static final long /*int*/ sel_colorUsingColorSpaceName_ = SELECTORS[194];
+public static final long /*int*/ sel_colorWithCalibratedRed_green_blue_alpha_ = SELECTORS[195];
+public static final long /*int*/ sel_colorWithDeviceRed_green_blue_alpha_ = SELECTORS[196];
+public static final long /*int*/ sel_colorWithKey_ = SELECTORS[197];
+public static final long /*int*/ sel_colorWithPatternImage_ = SELECTORS[198];
+public static final long /*int*/ sel_columnAtPoint_ = SELECTORS[199];
+public static final long /*int*/ sel_columnIndexesInRect_ = SELECTORS[200];
+public static final long /*int*/ sel_columnWithIdentifier_ = SELECTORS[201];
+public static final long /*int*/ sel_comboBoxSelectionDidChange_ = SELECTORS[202];
+public static final long /*int*/ sel_comboBoxWillDismiss_ = SELECTORS[203];
+public static final long /*int*/ sel_comboBoxWillPopUp_ = SELECTORS[204];
+public static final long /*int*/ sel_compare_ = SELECTORS[205];
+public static final long /*int*/ sel_concat = SELECTORS[206];
+public static final long /*int*/ sel_conformsToProtocol_ = SELECTORS[207];
+public static final long /*int*/ sel_containerSize = SELECTORS[208];
+public static final long /*int*/ sel_containsIndex_ = SELECTORS[209];
+public static final long /*int*/ sel_containsObject_ = SELECTORS[210];
+public static final long /*int*/ sel_containsPoint_ = SELECTORS[211];
+public static final long /*int*/ sel_contentRect = SELECTORS[212];
+public static final long /*int*/ sel_contentSize = SELECTORS[213];
+public static final long /*int*/ sel_contentSizeForFrameSize_hasHorizontalScroller_hasVerticalScroller_borderType_ = SELECTORS[214];
+public static final long /*int*/ sel_contentView = SELECTORS[215];
+public static final long /*int*/ sel_contentViewMargins = SELECTORS[216];
+public static final long /*int*/ sel_context = SELECTORS[217];
+public static final long /*int*/ sel_controlBackgroundColor = SELECTORS[218];
+public static final long /*int*/ sel_controlContentFontOfSize_ = SELECTORS[219];
+public static final long /*int*/ sel_controlDarkShadowColor = SELECTORS[220];
+public static final long /*int*/ sel_controlHighlightColor = SELECTORS[221];
+public static final long /*int*/ sel_controlLightHighlightColor = SELECTORS[222];
+public static final long /*int*/ sel_controlPointBounds = SELECTORS[223];
+public static final long /*int*/ sel_controlShadowColor = SELECTORS[224];
+public static final long /*int*/ sel_controlSize = SELECTORS[225];
+public static final long /*int*/ sel_controlTextColor = SELECTORS[226];
+public static final long /*int*/ sel_convertBaseToScreen_ = SELECTORS[227];
+public static final long /*int*/ sel_convertFont_toHaveTrait_ = SELECTORS[228];
+public static final long /*int*/ sel_convertPoint_fromView_ = SELECTORS[229];
+public static final long /*int*/ sel_convertPoint_toView_ = SELECTORS[230];
+public static final long /*int*/ sel_convertPointFromBase_ = SELECTORS[231];
+public static final long /*int*/ sel_convertPointToBase_ = SELECTORS[232];
+public static final long /*int*/ sel_convertRect_fromView_ = SELECTORS[233];
+public static final long /*int*/ sel_convertRect_toView_ = SELECTORS[234];
+public static final long /*int*/ sel_convertRectFromBase_ = SELECTORS[235];
+public static final long /*int*/ sel_convertRectToBase_ = SELECTORS[236];
+public static final long /*int*/ sel_convertScreenToBase_ = SELECTORS[237];
+public static final long /*int*/ sel_convertSize_fromView_ = SELECTORS[238];
+public static final long /*int*/ sel_convertSize_toView_ = SELECTORS[239];
+public static final long /*int*/ sel_convertSizeFromBase_ = SELECTORS[240];
+public static final long /*int*/ sel_convertSizeToBase_ = SELECTORS[241];
+public static final long /*int*/ sel_cookies = SELECTORS[242];
+public static final long /*int*/ sel_cookiesForURL_ = SELECTORS[243];
+public static final long /*int*/ sel_cookiesWithResponseHeaderFields_forURL_ = SELECTORS[244];
+public static final long /*int*/ sel_copiesOnScroll = SELECTORS[245];
+public static final long /*int*/ sel_copy = SELECTORS[246];
+public static final long /*int*/ sel_copy_ = SELECTORS[247];
+public static final long /*int*/ sel_count = SELECTORS[248];
+public static final long /*int*/ sel_createContext = SELECTORS[249];
+public static final long /*int*/ sel_createFileAtPath_contents_attributes_ = SELECTORS[250];
+public static final long /*int*/ sel_credentialWithUser_password_persistence_ = SELECTORS[251];
+public static final long /*int*/ sel_crosshairCursor = SELECTORS[252];
+public static final long /*int*/ sel_ctrlKey = SELECTORS[253];
+public static final long /*int*/ sel_currentContext = SELECTORS[254];
+public static final long /*int*/ sel_currentCursor = SELECTORS[255];
+public static final long /*int*/ sel_currentEditor = SELECTORS[256];
+public static final long /*int*/ sel_currentEvent = SELECTORS[257];
+public static final long /*int*/ sel_currentHandler = SELECTORS[258];
+public static final long /*int*/ sel_currentInputManager = SELECTORS[259];
+public static final long /*int*/ sel_currentPoint = SELECTORS[260];
+public static final long /*int*/ sel_currentRunLoop = SELECTORS[261];
+public static final long /*int*/ sel_currentThread = SELECTORS[262];
+public static final long /*int*/ sel_cursorUpdate_ = SELECTORS[263];
+public static final long /*int*/ sel_curveToPoint_controlPoint1_controlPoint2_ = SELECTORS[264];
+public static final long /*int*/ sel_cut_ = SELECTORS[265];
+public static final long /*int*/ sel_dataCell = SELECTORS[266];
+public static final long /*int*/ sel_dataForType_ = SELECTORS[267];
+public static final long /*int*/ sel_dataSource = SELECTORS[268];
+public static final long /*int*/ sel_dataWithBytes_length_ = SELECTORS[269];
+public static final long /*int*/ sel_dateValue = SELECTORS[270];
+public static final long /*int*/ sel_dateWithCalendarFormat_timeZone_ = SELECTORS[271];
+public static final long /*int*/ sel_dateWithTimeIntervalSinceNow_ = SELECTORS[272];
+public static final long /*int*/ sel_dateWithYear_month_day_hour_minute_second_timeZone_ = SELECTORS[273];
+public static final long /*int*/ sel_dayOfMonth = SELECTORS[274];
+public static final long /*int*/ sel_dealloc = SELECTORS[275];
+public static final long /*int*/ sel_decimalDigitCharacterSet = SELECTORS[276];
+public static final long /*int*/ sel_decimalSeparator = SELECTORS[277];
+public static final long /*int*/ sel_declareTypes_owner_ = SELECTORS[278];
+public static final long /*int*/ sel_defaultBaselineOffsetForFont_ = SELECTORS[279];
+public static final long /*int*/ sel_defaultButtonCell = SELECTORS[280];
+public static final long /*int*/ sel_defaultCenter = SELECTORS[281];
+public static final long /*int*/ sel_defaultFlatness = SELECTORS[282];
+public static final long /*int*/ sel_defaultLineHeightForFont_ = SELECTORS[283];
+public static final long /*int*/ sel_defaultManager = SELECTORS[284];
+public static final long /*int*/ sel_defaultParagraphStyle = SELECTORS[285];
+public static final long /*int*/ sel_defaultPrinter = SELECTORS[286];
+public static final long /*int*/ sel_defaultTimeZone = SELECTORS[287];
+public static final long /*int*/ sel_delegate = SELECTORS[288];
+public static final long /*int*/ sel_deleteCookie_ = SELECTORS[289];
+public static final long /*int*/ sel_deliverResult = SELECTORS[290];
+public static final long /*int*/ sel_deltaX = SELECTORS[291];
+public static final long /*int*/ sel_deltaY = SELECTORS[292];
+public static final long /*int*/ sel_deminiaturize_ = SELECTORS[293];
+public static final long /*int*/ sel_depth = SELECTORS[294];
+public static final long /*int*/ sel_descender = SELECTORS[295];
+public static final long /*int*/ sel_description = SELECTORS[296];
+public static final long /*int*/ sel_deselectAll_ = SELECTORS[297];
+public static final long /*int*/ sel_deselectItemAtIndex_ = SELECTORS[298];
+public static final long /*int*/ sel_deselectRow_ = SELECTORS[299];
+public static final long /*int*/ sel_destroyContext = SELECTORS[300];
+public static final long /*int*/ sel_detail = SELECTORS[301];
+public static final long /*int*/ sel_device = SELECTORS[302];
+public static final long /*int*/ sel_deviceDescription = SELECTORS[303];
+public static final long /*int*/ sel_deviceSize = SELECTORS[304];
+public static final long /*int*/ sel_dictionary = SELECTORS[305];
+public static final long /*int*/ sel_dictionaryWithCapacity_ = SELECTORS[306];
+public static final long /*int*/ sel_dictionaryWithObject_forKey_ = SELECTORS[307];
+public static final long /*int*/ sel_disableCursorRects = SELECTORS[308];
+public static final long /*int*/ sel_disableFlushWindow = SELECTORS[309];
+public static final long /*int*/ sel_disabledControlTextColor = SELECTORS[310];
+public static final long /*int*/ sel_discardCursorRects = SELECTORS[311];
+public static final long /*int*/ sel_display = SELECTORS[312];
+public static final long /*int*/ sel_displayIfNeeded = SELECTORS[313];
+public static final long /*int*/ sel_displayName = SELECTORS[314];
+public static final long /*int*/ sel_displayNameForKey_value_ = SELECTORS[315];
+public static final long /*int*/ sel_displayRectIgnoringOpacity_inContext_ = SELECTORS[316];
+public static final long /*int*/ sel_distantFuture = SELECTORS[317];
+public static final long /*int*/ sel_doCommandBySelector_ = SELECTORS[318];
+public static final long /*int*/ sel_dockTile = SELECTORS[319];
+public static final long /*int*/ sel_documentCursor = SELECTORS[320];
+public static final long /*int*/ sel_documentSource = SELECTORS[321];
+public static final long /*int*/ sel_documentView = SELECTORS[322];
+public static final long /*int*/ sel_documentViewShouldHandlePrint = SELECTORS[323];
+public static final long /*int*/ sel_documentVisibleRect = SELECTORS[324];
+public static final long /*int*/ sel_doubleClickAtIndex_ = SELECTORS[325];
+public static final long /*int*/ sel_doubleValue = SELECTORS[326];
+public static final long /*int*/ sel_download = SELECTORS[327];
+public static final long /*int*/ sel_download_decideDestinationWithSuggestedFilename_ = SELECTORS[328];
+public static final long /*int*/ sel_dragImage_at_offset_event_pasteboard_source_slideBack_ = SELECTORS[329];
+public static final long /*int*/ sel_dragImageForRowsWithIndexes_tableColumns_event_offset_ = SELECTORS[330];
+public static final long /*int*/ sel_dragSelectionWithEvent_offset_slideBack_ = SELECTORS[331];
+public static final long /*int*/ sel_draggedImage_beganAt_ = SELECTORS[332];
+public static final long /*int*/ sel_draggedImage_endedAt_operation_ = SELECTORS[333];
+public static final long /*int*/ sel_draggingDestinationWindow = SELECTORS[334];
+public static final long /*int*/ sel_draggingEnded_ = SELECTORS[335];
+public static final long /*int*/ sel_draggingEntered_ = SELECTORS[336];
+public static final long /*int*/ sel_draggingExited_ = SELECTORS[337];
+public static final long /*int*/ sel_draggingLocation = SELECTORS[338];
+public static final long /*int*/ sel_draggingPasteboard = SELECTORS[339];
+public static final long /*int*/ sel_draggingSourceOperationMask = SELECTORS[340];
+public static final long /*int*/ sel_draggingSourceOperationMaskForLocal_ = SELECTORS[341];
+public static final long /*int*/ sel_draggingUpdated_ = SELECTORS[342];
+public static final long /*int*/ sel_drawAtPoint_ = SELECTORS[343];
+public static final long /*int*/ sel_drawAtPoint_fromRect_operation_fraction_ = SELECTORS[344];
+public static final long /*int*/ sel_drawBackgroundForGlyphRange_atPoint_ = SELECTORS[345];
+public static final long /*int*/ sel_drawBackgroundInClipRect_ = SELECTORS[346];
+public static final long /*int*/ sel_drawFromPoint_toPoint_options_ = SELECTORS[347];
+public static final long /*int*/ sel_drawGlyphsForGlyphRange_atPoint_ = SELECTORS[348];
+public static final long /*int*/ sel_drawImage_withFrame_inView_ = SELECTORS[349];
+public static final long /*int*/ sel_drawInRect_ = SELECTORS[350];
+public static final long /*int*/ sel_drawInRect_angle_ = SELECTORS[351];
+public static final long /*int*/ sel_drawInRect_fromRect_operation_fraction_ = SELECTORS[352];
+public static final long /*int*/ sel_drawInteriorWithFrame_inView_ = SELECTORS[353];
+public static final long /*int*/ sel_drawLabel_inRect_ = SELECTORS[354];
+public static final long /*int*/ sel_drawRect_ = SELECTORS[355];
+public static final long /*int*/ sel_drawSortIndicatorWithFrame_inView_ascending_priority_ = SELECTORS[356];
+public static final long /*int*/ sel_drawStatusBarBackgroundInRect_withHighlight_ = SELECTORS[357];
+public static final long /*int*/ sel_drawTitle_withFrame_inView_ = SELECTORS[358];
+public static final long /*int*/ sel_drawViewBackgroundInRect_ = SELECTORS[359];
+public static final long /*int*/ sel_drawWithExpansionFrame_inView_ = SELECTORS[360];
+public static final long /*int*/ sel_drawingRectForBounds_ = SELECTORS[361];
+public static final long /*int*/ sel_elementAtIndex_associatedPoints_ = SELECTORS[362];
+public static final long /*int*/ sel_elementCount = SELECTORS[363];
+public static final long /*int*/ sel_enableCursorRects = SELECTORS[364];
+public static final long /*int*/ sel_enableFlushWindow = SELECTORS[365];
+public static final long /*int*/ sel_endDocument = SELECTORS[366];
+public static final long /*int*/ sel_endEditing = SELECTORS[367];
+public static final long /*int*/ sel_endEditingFor_ = SELECTORS[368];
+public static final long /*int*/ sel_endGestureWithEvent_ = SELECTORS[369];
+public static final long /*int*/ sel_endPage = SELECTORS[370];
+public static final long /*int*/ sel_endSheet_returnCode_ = SELECTORS[371];
+public static final long /*int*/ sel_enterExitEventWithType_location_modifierFlags_timestamp_windowNumber_context_eventNumber_trackingNumber_userData_ = SELECTORS[372];
+public static final long /*int*/ sel_enumeratorAtPath_ = SELECTORS[373];
+public static final long /*int*/ sel_expandItem_ = SELECTORS[374];
+public static final long /*int*/ sel_expandItem_expandChildren_ = SELECTORS[375];
+public static final long /*int*/ sel_expansionFrameWithFrame_inView_ = SELECTORS[376];
+public static final long /*int*/ sel_familyName = SELECTORS[377];
+public static final long /*int*/ sel_fieldEditor_forObject_ = SELECTORS[378];
+public static final long /*int*/ sel_fileExistsAtPath_ = SELECTORS[379];
+public static final long /*int*/ sel_fileExistsAtPath_isDirectory_ = SELECTORS[380];
+public static final long /*int*/ sel_fileSystemRepresentation = SELECTORS[381];
+public static final long /*int*/ sel_fileURLWithPath_ = SELECTORS[382];
+public static final long /*int*/ sel_filename = SELECTORS[383];
+public static final long /*int*/ sel_filenames = SELECTORS[384];
+public static final long /*int*/ sel_fill = SELECTORS[385];
+public static final long /*int*/ sel_fillRect_ = SELECTORS[386];
+public static final long /*int*/ sel_finishLaunching = SELECTORS[387];
+public static final long /*int*/ sel_firstIndex = SELECTORS[388];
+public static final long /*int*/ sel_firstRectForCharacterRange_ = SELECTORS[389];
+public static final long /*int*/ sel_firstResponder = SELECTORS[390];
+public static final long /*int*/ sel_flagsChanged_ = SELECTORS[391];
+public static final long /*int*/ sel_floatValue = SELECTORS[392];
+public static final long /*int*/ sel_flushBuffer = SELECTORS[393];
+public static final long /*int*/ sel_flushGraphics = SELECTORS[394];
+public static final long /*int*/ sel_flushWindowIfNeeded = SELECTORS[395];
+public static final long /*int*/ sel_font = SELECTORS[396];
+public static final long /*int*/ sel_fontName = SELECTORS[397];
+public static final long /*int*/ sel_fontWithFamily_traits_weight_size_ = SELECTORS[398];
+public static final long /*int*/ sel_fontWithName_size_ = SELECTORS[399];
+public static final long /*int*/ sel_frame = SELECTORS[400];
+public static final long /*int*/ sel_frameOfCellAtColumn_row_ = SELECTORS[401];
+public static final long /*int*/ sel_frameOfOutlineCellAtRow_ = SELECTORS[402];
+public static final long /*int*/ sel_frameRectForContentRect_ = SELECTORS[403];
+public static final long /*int*/ sel_frameSizeForContentSize_hasHorizontalScroller_hasVerticalScroller_borderType_ = SELECTORS[404];
+public static final long /*int*/ sel_fullPathForApplication_ = SELECTORS[405];
+public static final long /*int*/ sel_generalPasteboard = SELECTORS[406];
+public static final long /*int*/ sel_genericRGBColorSpace = SELECTORS[407];
+public static final long /*int*/ sel_getBitmapDataPlanes_ = SELECTORS[408];
+public static final long /*int*/ sel_getBytes_ = SELECTORS[409];
+public static final long /*int*/ sel_getBytes_length_ = SELECTORS[410];
+public static final long /*int*/ sel_getCharacters_ = SELECTORS[411];
+public static final long /*int*/ sel_getCharacters_range_ = SELECTORS[412];
+public static final long /*int*/ sel_getComponents_ = SELECTORS[413];
+public static final long /*int*/ sel_getGlyphs_range_ = SELECTORS[414];
+public static final long /*int*/ sel_getGlyphsInRange_glyphs_characterIndexes_glyphInscriptions_elasticBits_bidiLevels_ = SELECTORS[415];
+public static final long /*int*/ sel_getIndexes_maxCount_inIndexRange_ = SELECTORS[416];
+public static final long /*int*/ sel_getInfoForFile_application_type_ = SELECTORS[417];
+public static final long /*int*/ sel_getValues_forAttribute_forVirtualScreen_ = SELECTORS[418];
+public static final long /*int*/ sel_globalContext = SELECTORS[419];
+public static final long /*int*/ sel_glyphIndexForCharacterAtIndex_ = SELECTORS[420];
+public static final long /*int*/ sel_glyphIndexForPoint_inTextContainer_fractionOfDistanceThroughGlyph_ = SELECTORS[421];
+public static final long /*int*/ sel_glyphRangeForCharacterRange_actualCharacterRange_ = SELECTORS[422];
+public static final long /*int*/ sel_glyphRangeForTextContainer_ = SELECTORS[423];
+public static final long /*int*/ sel_goBack = SELECTORS[424];
+public static final long /*int*/ sel_goForward = SELECTORS[425];
+public static final long /*int*/ sel_graphicsContext = SELECTORS[426];
+public static final long /*int*/ sel_graphicsContextWithBitmapImageRep_ = SELECTORS[427];
+public static final long /*int*/ sel_graphicsContextWithGraphicsPort_flipped_ = SELECTORS[428];
+public static final long /*int*/ sel_graphicsContextWithWindow_ = SELECTORS[429];
+public static final long /*int*/ sel_graphicsPort = SELECTORS[430];
+public static final long /*int*/ sel_greenComponent = SELECTORS[431];
+public static final long /*int*/ sel_handleEvent_ = SELECTORS[432];
+public static final long /*int*/ sel_handleFailureInFunction_file_lineNumber_description_ = SELECTORS[433];
+public static final long /*int*/ sel_handleFailureInMethod_object_file_lineNumber_description_ = SELECTORS[434];
+public static final long /*int*/ sel_handleMouseEvent_ = SELECTORS[435];
+public static final long /*int*/ sel_hasAlpha = SELECTORS[436];
+public static final long /*int*/ sel_hasMarkedText = SELECTORS[437];
+public static final long /*int*/ sel_hasPassword = SELECTORS[438];
+public static final long /*int*/ sel_hasShadow = SELECTORS[439];
+public static final long /*int*/ sel_headerCell = SELECTORS[440];
+public static final long /*int*/ sel_headerRectOfColumn_ = SELECTORS[441];
+public static final long /*int*/ sel_headerView = SELECTORS[442];
+public static final long /*int*/ sel_helpRequested_ = SELECTORS[443];
+public static final long /*int*/ sel_hide_ = SELECTORS[444];
+public static final long /*int*/ sel_hideOtherApplications_ = SELECTORS[445];
+public static final long /*int*/ sel_highlightColorInView_ = SELECTORS[446];
+public static final long /*int*/ sel_highlightColorWithFrame_inView_ = SELECTORS[447];
+public static final long /*int*/ sel_highlightSelectionInClipRect_ = SELECTORS[448];
+public static final long /*int*/ sel_hitPart = SELECTORS[449];
+public static final long /*int*/ sel_hitTest_ = SELECTORS[450];
+public static final long /*int*/ sel_hitTestForEvent_inRect_ofView_ = SELECTORS[451];
+public static final long /*int*/ sel_host = SELECTORS[452];
+public static final long /*int*/ sel_hotSpot = SELECTORS[453];
+public static final long /*int*/ sel_hourOfDay = SELECTORS[454];
+public static final long /*int*/ sel_iconForFile_ = SELECTORS[455];
+public static final long /*int*/ sel_iconForFileType_ = SELECTORS[456];
+public static final long /*int*/ sel_ignore = SELECTORS[457];
+public static final long /*int*/ sel_ignoreModifierKeysWhileDragging = SELECTORS[458];
+public static final long /*int*/ sel_image = SELECTORS[459];
+public static final long /*int*/ sel_imageInterpolation = SELECTORS[460];
+public static final long /*int*/ sel_imageNamed_ = SELECTORS[461];
+public static final long /*int*/ sel_imageRectForBounds_ = SELECTORS[462];
+public static final long /*int*/ sel_imageRepWithData_ = SELECTORS[463];
+public static final long /*int*/ sel_imageablePageBounds = SELECTORS[464];
+public static final long /*int*/ sel_increment = SELECTORS[465];
+public static final long /*int*/ sel_indentationPerLevel = SELECTORS[466];
+public static final long /*int*/ sel_indexOfItemWithTarget_andAction_ = SELECTORS[467];
+public static final long /*int*/ sel_indexOfObjectIdenticalTo_ = SELECTORS[468];
+public static final long /*int*/ sel_indexOfSelectedItem = SELECTORS[469];
+public static final long /*int*/ sel_indexSetWithIndex_ = SELECTORS[470];
+public static final long /*int*/ sel_infoDictionary = SELECTORS[471];
+public static final long /*int*/ sel_init = SELECTORS[472];
+public static final long /*int*/ sel_initByReferencingFile_ = SELECTORS[473];
+public static final long /*int*/ sel_initListDescriptor = SELECTORS[474];
+public static final long /*int*/ sel_initWithAttributes_ = SELECTORS[475];
+public static final long /*int*/ sel_initWithBitmapDataPlanes_pixelsWide_pixelsHigh_bitsPerSample_samplesPerPixel_hasAlpha_isPlanar_colorSpaceName_bitmapFormat_bytesPerRow_bitsPerPixel_ = SELECTORS[476];
+public static final long /*int*/ sel_initWithBitmapDataPlanes_pixelsWide_pixelsHigh_bitsPerSample_samplesPerPixel_hasAlpha_isPlanar_colorSpaceName_bytesPerRow_bitsPerPixel_ = SELECTORS[477];
+public static final long /*int*/ sel_initWithCapacity_ = SELECTORS[478];
+public static final long /*int*/ sel_initWithCharacters_length_ = SELECTORS[479];
+public static final long /*int*/ sel_initWithContainerSize_ = SELECTORS[480];
+public static final long /*int*/ sel_initWithContentRect_styleMask_backing_defer_ = SELECTORS[481];
+public static final long /*int*/ sel_initWithContentRect_styleMask_backing_defer_screen_ = SELECTORS[482];
+public static final long /*int*/ sel_initWithContentsOfFile_ = SELECTORS[483];
+public static final long /*int*/ sel_initWithData_ = SELECTORS[484];
+public static final long /*int*/ sel_initWithDictionary_ = SELECTORS[485];
+public static final long /*int*/ sel_initWithFileWrapper_ = SELECTORS[486];
+public static final long /*int*/ sel_initWithFocusedViewRect_ = SELECTORS[487];
+public static final long /*int*/ sel_initWithFormat_shareContext_ = SELECTORS[488];
+public static final long /*int*/ sel_initWithFrame_ = SELECTORS[489];
+public static final long /*int*/ sel_initWithFrame_frameName_groupName_ = SELECTORS[490];
+public static final long /*int*/ sel_initWithFrame_pullsDown_ = SELECTORS[491];
+public static final long /*int*/ sel_initWithIconRef_ = SELECTORS[492];
+public static final long /*int*/ sel_initWithIdentifier_ = SELECTORS[493];
+public static final long /*int*/ sel_initWithImage_hotSpot_ = SELECTORS[494];
+public static final long /*int*/ sel_initWithIndex_ = SELECTORS[495];
+public static final long /*int*/ sel_initWithIndexSet_ = SELECTORS[496];
+public static final long /*int*/ sel_initWithIndexesInRange_ = SELECTORS[497];
+public static final long /*int*/ sel_initWithItemIdentifier_ = SELECTORS[498];
+public static final long /*int*/ sel_initWithLocaleIdentifier_ = SELECTORS[499];
+public static final long /*int*/ sel_initWithName_ = SELECTORS[500];
+public static final long /*int*/ sel_initWithRect_options_owner_userInfo_ = SELECTORS[501];
+public static final long /*int*/ sel_initWithSize_ = SELECTORS[502];
+public static final long /*int*/ sel_initWithStartingColor_endingColor_ = SELECTORS[503];
+public static final long /*int*/ sel_initWithString_ = SELECTORS[504];
+public static final long /*int*/ sel_initWithString_attributes_ = SELECTORS[505];
+public static final long /*int*/ sel_initWithTitle_ = SELECTORS[506];
+public static final long /*int*/ sel_initWithTitle_action_keyEquivalent_ = SELECTORS[507];
+public static final long /*int*/ sel_initWithTransform_ = SELECTORS[508];
+public static final long /*int*/ sel_initWithType_location_ = SELECTORS[509];
+public static final long /*int*/ sel_initWithURL_ = SELECTORS[510];
+public static final long /*int*/ sel_insertColor_key_atIndex_ = SELECTORS[511];
+public static final long /*int*/ sel_insertItem_atIndex_ = SELECTORS[512];
+public static final long /*int*/ sel_insertItemWithItemIdentifier_atIndex_ = SELECTORS[513];
+public static final long /*int*/ sel_insertItemWithObjectValue_atIndex_ = SELECTORS[514];
+public static final long /*int*/ sel_insertTabViewItem_atIndex_ = SELECTORS[515];
+public static final long /*int*/ sel_insertText_ = SELECTORS[516];
+public static final long /*int*/ sel_intValue = SELECTORS[517];
+public static final long /*int*/ sel_integerValue = SELECTORS[518];
+public static final long /*int*/ sel_intercellSpacing = SELECTORS[519];
+public static final long /*int*/ sel_interpretKeyEvents_ = SELECTORS[520];
+public static final long /*int*/ sel_invalidate = SELECTORS[521];
+public static final long /*int*/ sel_invalidateShadow = SELECTORS[522];
+public static final long /*int*/ sel_invert = SELECTORS[523];
+public static final long /*int*/ sel_isActive = SELECTORS[524];
+public static final long /*int*/ sel_isDescendantOf_ = SELECTORS[525];
+public static final long /*int*/ sel_isDocumentEdited = SELECTORS[526];
+public static final long /*int*/ sel_isDrawingToScreen = SELECTORS[527];
+public static final long /*int*/ sel_isEmpty = SELECTORS[528];
+public static final long /*int*/ sel_isEnabled = SELECTORS[529];
+public static final long /*int*/ sel_isEqual_ = SELECTORS[530];
+public static final long /*int*/ sel_isEqualTo_ = SELECTORS[531];
+public static final long /*int*/ sel_isEqualToString_ = SELECTORS[532];
+public static final long /*int*/ sel_isExecutableFileAtPath_ = SELECTORS[533];
+public static final long /*int*/ sel_isFieldEditor = SELECTORS[534];
+public static final long /*int*/ sel_isFilePackageAtPath_ = SELECTORS[535];
+public static final long /*int*/ sel_isFileURL = SELECTORS[536];
+public static final long /*int*/ sel_isFlipped = SELECTORS[537];
+public static final long /*int*/ sel_isHidden = SELECTORS[538];
+public static final long /*int*/ sel_isHiddenOrHasHiddenAncestor = SELECTORS[539];
+public static final long /*int*/ sel_isHighlighted = SELECTORS[540];
+public static final long /*int*/ sel_isItemExpanded_ = SELECTORS[541];
+public static final long /*int*/ sel_isKeyWindow = SELECTORS[542];
+public static final long /*int*/ sel_isKindOfClass_ = SELECTORS[543];
+public static final long /*int*/ sel_isMainThread = SELECTORS[544];
+public static final long /*int*/ sel_isMainWindow = SELECTORS[545];
+public static final long /*int*/ sel_isMiniaturized = SELECTORS[546];
+public static final long /*int*/ sel_isOpaque = SELECTORS[547];
+public static final long /*int*/ sel_isPlanar = SELECTORS[548];
+public static final long /*int*/ sel_isResting = SELECTORS[549];
+public static final long /*int*/ sel_isRowSelected_ = SELECTORS[550];
+public static final long /*int*/ sel_isRunning = SELECTORS[551];
+public static final long /*int*/ sel_isSeparatorItem = SELECTORS[552];
+public static final long /*int*/ sel_isSessionOnly = SELECTORS[553];
+public static final long /*int*/ sel_isSheet = SELECTORS[554];
+public static final long /*int*/ sel_isVisible = SELECTORS[555];
+public static final long /*int*/ sel_isZoomed = SELECTORS[556];
+public static final long /*int*/ sel_itemArray = SELECTORS[557];
+public static final long /*int*/ sel_itemAtIndex_ = SELECTORS[558];
+public static final long /*int*/ sel_itemAtRow_ = SELECTORS[559];
+public static final long /*int*/ sel_itemHeight = SELECTORS[560];
+public static final long /*int*/ sel_itemIdentifier = SELECTORS[561];
+public static final long /*int*/ sel_itemObjectValueAtIndex_ = SELECTORS[562];
+public static final long /*int*/ sel_itemTitleAtIndex_ = SELECTORS[563];
+public static final long /*int*/ sel_itemWithTag_ = SELECTORS[564];
+public static final long /*int*/ sel_jobDisposition = SELECTORS[565];
+public static final long /*int*/ sel_keyCode = SELECTORS[566];
+public static final long /*int*/ sel_keyDown_ = SELECTORS[567];
+public static final long /*int*/ sel_keyEquivalent = SELECTORS[568];
+public static final long /*int*/ sel_keyEquivalentModifierMask = SELECTORS[569];
+public static final long /*int*/ sel_keyUp_ = SELECTORS[570];
+public static final long /*int*/ sel_keyWindow = SELECTORS[571];
+public static final long /*int*/ sel_knobProportion = SELECTORS[572];
+public static final long /*int*/ sel_knobThickness = SELECTORS[573];
+public static final long /*int*/ sel_lastPathComponent = SELECTORS[574];
+public static final long /*int*/ sel_layoutManager = SELECTORS[575];
+public static final long /*int*/ sel_leading = SELECTORS[576];
+public static final long /*int*/ sel_length = SELECTORS[577];
+public static final long /*int*/ sel_level = SELECTORS[578];
+public static final long /*int*/ sel_levelForItem_ = SELECTORS[579];
+public static final long /*int*/ sel_lineFragmentUsedRectForGlyphAtIndex_effectiveRange_ = SELECTORS[580];
+public static final long /*int*/ sel_lineFragmentUsedRectForGlyphAtIndex_effectiveRange_withoutAdditionalLayout_ = SELECTORS[581];
+public static final long /*int*/ sel_lineToPoint_ = SELECTORS[582];
+public static final long /*int*/ sel_linkTextAttributes = SELECTORS[583];
+public static final long /*int*/ sel_loadHTMLString_baseURL_ = SELECTORS[584];
+public static final long /*int*/ sel_loadNibFile_externalNameTable_withZone_ = SELECTORS[585];
+public static final long /*int*/ sel_loadRequest_ = SELECTORS[586];
+public static final long /*int*/ sel_localizedDescription = SELECTORS[587];
+public static final long /*int*/ sel_location = SELECTORS[588];
+public static final long /*int*/ sel_locationForGlyphAtIndex_ = SELECTORS[589];
+public static final long /*int*/ sel_locationInWindow = SELECTORS[590];
+public static final long /*int*/ sel_lockFocus = SELECTORS[591];
+public static final long /*int*/ sel_lowercaseString = SELECTORS[592];
+public static final long /*int*/ sel_magnification = SELECTORS[593];
+public static final long /*int*/ sel_magnifyWithEvent_ = SELECTORS[594];
+public static final long /*int*/ sel_mainBundle = SELECTORS[595];
+public static final long /*int*/ sel_mainFrame = SELECTORS[596];
+public static final long /*int*/ sel_mainMenu = SELECTORS[597];
+public static final long /*int*/ sel_mainRunLoop = SELECTORS[598];
+public static final long /*int*/ sel_mainScreen = SELECTORS[599];
+public static final long /*int*/ sel_mainWindow = SELECTORS[600];
+public static final long /*int*/ sel_makeCurrentContext = SELECTORS[601];
+public static final long /*int*/ sel_makeFirstResponder_ = SELECTORS[602];
+public static final long /*int*/ sel_makeKeyAndOrderFront_ = SELECTORS[603];
+public static final long /*int*/ sel_markedRange = SELECTORS[604];
+public static final long /*int*/ sel_markedTextAttributes = SELECTORS[605];
+public static final long /*int*/ sel_maxValue = SELECTORS[606];
+public static final long /*int*/ sel_maximum = SELECTORS[607];
+public static final long /*int*/ sel_maximumFractionDigits = SELECTORS[608];
+public static final long /*int*/ sel_maximumIntegerDigits = SELECTORS[609];
+public static final long /*int*/ sel_menu = SELECTORS[610];
+public static final long /*int*/ sel_menu_willHighlightItem_ = SELECTORS[611];
+public static final long /*int*/ sel_menuBarFontOfSize_ = SELECTORS[612];
+public static final long /*int*/ sel_menuDidClose_ = SELECTORS[613];
+public static final long /*int*/ sel_menuFontOfSize_ = SELECTORS[614];
+public static final long /*int*/ sel_menuForEvent_ = SELECTORS[615];
+public static final long /*int*/ sel_menuNeedsUpdate_ = SELECTORS[616];
+public static final long /*int*/ sel_menuWillOpen_ = SELECTORS[617];
+public static final long /*int*/ sel_metaKey = SELECTORS[618];
+public static final long /*int*/ sel_minFrameWidthWithTitle_styleMask_ = SELECTORS[619];
+public static final long /*int*/ sel_minSize = SELECTORS[620];
+public static final long /*int*/ sel_minValue = SELECTORS[621];
+public static final long /*int*/ sel_miniaturize_ = SELECTORS[622];
+public static final long /*int*/ sel_minimum = SELECTORS[623];
+public static final long /*int*/ sel_minimumSize = SELECTORS[624];
+public static final long /*int*/ sel_minuteOfHour = SELECTORS[625];
+public static final long /*int*/ sel_modifierFlags = SELECTORS[626];
+public static final long /*int*/ sel_monthOfYear = SELECTORS[627];
+public static final long /*int*/ sel_mouse_inRect_ = SELECTORS[628];
+public static final long /*int*/ sel_mouseDown_ = SELECTORS[629];
+public static final long /*int*/ sel_mouseDownCanMoveWindow = SELECTORS[630];
+public static final long /*int*/ sel_mouseDragged_ = SELECTORS[631];
+public static final long /*int*/ sel_mouseEntered_ = SELECTORS[632];
+public static final long /*int*/ sel_mouseExited_ = SELECTORS[633];
+public static final long /*int*/ sel_mouseLocation = SELECTORS[634];
+public static final long /*int*/ sel_mouseLocationOutsideOfEventStream = SELECTORS[635];
+public static final long /*int*/ sel_mouseMoved_ = SELECTORS[636];
+public static final long /*int*/ sel_mouseUp_ = SELECTORS[637];
+public static final long /*int*/ sel_moveColumn_toColumn_ = SELECTORS[638];
+public static final long /*int*/ sel_moveToBeginningOfParagraph_ = SELECTORS[639];
+public static final long /*int*/ sel_moveToEndOfParagraph_ = SELECTORS[640];
+public static final long /*int*/ sel_moveToPoint_ = SELECTORS[641];
+public static final long /*int*/ sel_moveUp_ = SELECTORS[642];
+public static final long /*int*/ sel_mutableCopy = SELECTORS[643];
+public static final long /*int*/ sel_mutableString = SELECTORS[644];
+public static final long /*int*/ sel_name = SELECTORS[645];
+public static final long /*int*/ sel_needsPanelToBecomeKey = SELECTORS[646];
+public static final long /*int*/ sel_nextEventMatchingMask_untilDate_inMode_dequeue_ = SELECTORS[647];
+public static final long /*int*/ sel_nextObject = SELECTORS[648];
+public static final long /*int*/ sel_nextState = SELECTORS[649];
+public static final long /*int*/ sel_nextWordFromIndex_forward_ = SELECTORS[650];
+public static final long /*int*/ sel_noResponderFor_ = SELECTORS[651];
+public static final long /*int*/ sel_normalizedPosition = SELECTORS[652];
+public static final long /*int*/ sel_noteNumberOfRowsChanged = SELECTORS[653];
+public static final long /*int*/ sel_numberOfColumns = SELECTORS[654];
+public static final long /*int*/ sel_numberOfComponents = SELECTORS[655];
+public static final long /*int*/ sel_numberOfGlyphs = SELECTORS[656];
+public static final long /*int*/ sel_numberOfItems = SELECTORS[657];
+public static final long /*int*/ sel_numberOfPlanes = SELECTORS[658];
+public static final long /*int*/ sel_numberOfRows = SELECTORS[659];
+public static final long /*int*/ sel_numberOfRowsInTableView_ = SELECTORS[660];
+public static final long /*int*/ sel_numberOfSelectedRows = SELECTORS[661];
+public static final long /*int*/ sel_numberOfVisibleItems = SELECTORS[662];
+public static final long /*int*/ sel_numberWithBool_ = SELECTORS[663];
+public static final long /*int*/ sel_numberWithDouble_ = SELECTORS[664];
+public static final long /*int*/ sel_numberWithInt_ = SELECTORS[665];
+public static final long /*int*/ sel_numberWithInteger_ = SELECTORS[666];
+public static final long /*int*/ sel_objCType = SELECTORS[667];
+public static final long /*int*/ sel_object = SELECTORS[668];
+public static final long /*int*/ sel_objectAtIndex_ = SELECTORS[669];
+public static final long /*int*/ sel_objectEnumerator = SELECTORS[670];
+public static final long /*int*/ sel_objectForInfoDictionaryKey_ = SELECTORS[671];
+public static final long /*int*/ sel_objectForKey_ = SELECTORS[672];
+public static final long /*int*/ sel_objectValues = SELECTORS[673];
+public static final long /*int*/ sel_openFile_withApplication_ = SELECTORS[674];
+public static final long /*int*/ sel_openPanel = SELECTORS[675];
+public static final long /*int*/ sel_openURL_ = SELECTORS[676];
+public static final long /*int*/ sel_openURLs_withAppBundleIdentifier_options_additionalEventParamDescriptor_launchIdentifiers_ = SELECTORS[677];
+public static final long /*int*/ sel_operationNotAllowedCursor = SELECTORS[678];
+public static final long /*int*/ sel_options = SELECTORS[679];
+public static final long /*int*/ sel_orderBack_ = SELECTORS[680];
+public static final long /*int*/ sel_orderFront_ = SELECTORS[681];
+public static final long /*int*/ sel_orderFrontRegardless = SELECTORS[682];
+public static final long /*int*/ sel_orderFrontStandardAboutPanel_ = SELECTORS[683];
+public static final long /*int*/ sel_orderOut_ = SELECTORS[684];
+public static final long /*int*/ sel_orderWindow_relativeTo_ = SELECTORS[685];
+public static final long /*int*/ sel_orderedWindows = SELECTORS[686];
+public static final long /*int*/ sel_otherEventWithType_location_modifierFlags_timestamp_windowNumber_context_subtype_data1_data2_ = SELECTORS[687];
+public static final long /*int*/ sel_otherMouseDown_ = SELECTORS[688];
+public static final long /*int*/ sel_otherMouseDragged_ = SELECTORS[689];
+public static final long /*int*/ sel_otherMouseUp_ = SELECTORS[690];
+public static final long /*int*/ sel_outlineTableColumn = SELECTORS[691];
+public static final long /*int*/ sel_outlineView_acceptDrop_item_childIndex_ = SELECTORS[692];
+public static final long /*int*/ sel_outlineView_child_ofItem_ = SELECTORS[693];
+public static final long /*int*/ sel_outlineView_didClickTableColumn_ = SELECTORS[694];
+public static final long /*int*/ sel_outlineView_isItemExpandable_ = SELECTORS[695];
+public static final long /*int*/ sel_outlineView_numberOfChildrenOfItem_ = SELECTORS[696];
+public static final long /*int*/ sel_outlineView_objectValueForTableColumn_byItem_ = SELECTORS[697];
+public static final long /*int*/ sel_outlineView_setObjectValue_forTableColumn_byItem_ = SELECTORS[698];
+public static final long /*int*/ sel_outlineView_shouldCollapseItem_ = SELECTORS[699];
+public static final long /*int*/ sel_outlineView_shouldEditTableColumn_item_ = SELECTORS[700];
+public static final long /*int*/ sel_outlineView_shouldExpandItem_ = SELECTORS[701];
+public static final long /*int*/ sel_outlineView_shouldReorderColumn_toColumn_ = SELECTORS[702];
+public static final long /*int*/ sel_outlineView_shouldSelectItem_ = SELECTORS[703];
+public static final long /*int*/ sel_outlineView_shouldTrackCell_forTableColumn_item_ = SELECTORS[704];
+public static final long /*int*/ sel_outlineView_validateDrop_proposedItem_proposedChildIndex_ = SELECTORS[705];
+public static final long /*int*/ sel_outlineView_willDisplayCell_forTableColumn_item_ = SELECTORS[706];
+public static final long /*int*/ sel_outlineView_writeItems_toPasteboard_ = SELECTORS[707];
+public static final long /*int*/ sel_outlineViewColumnDidMove_ = SELECTORS[708];
+public static final long /*int*/ sel_outlineViewColumnDidResize_ = SELECTORS[709];
+public static final long /*int*/ sel_outlineViewItemDidExpand_ = SELECTORS[710];
+public static final long /*int*/ sel_outlineViewSelectionDidChange_ = SELECTORS[711];
+public static final long /*int*/ sel_outlineViewSelectionIsChanging_ = SELECTORS[712];
+public static final long /*int*/ sel_owner = SELECTORS[713];
+public static final long /*int*/ sel_pageDown_ = SELECTORS[714];
+public static final long /*int*/ sel_pageTitle = SELECTORS[715];
+public static final long /*int*/ sel_pageUp_ = SELECTORS[716];
+public static final long /*int*/ sel_panel_shouldShowFilename_ = SELECTORS[717];
+public static final long /*int*/ sel_panelConvertFont_ = SELECTORS[718];
+public static final long /*int*/ sel_paperSize = SELECTORS[719];
+public static final long /*int*/ sel_paragraphs = SELECTORS[720];
+public static final long /*int*/ sel_parentWindow = SELECTORS[721];
+public static final long /*int*/ sel_password = SELECTORS[722];
+public static final long /*int*/ sel_paste_ = SELECTORS[723];
+public static final long /*int*/ sel_pasteboard_provideDataForType_ = SELECTORS[724];
+public static final long /*int*/ sel_pasteboardWithName_ = SELECTORS[725];
+public static final long /*int*/ sel_path = SELECTORS[726];
+public static final long /*int*/ sel_pathExtension = SELECTORS[727];
+public static final long /*int*/ sel_pathForResource_ofType_ = SELECTORS[728];
+public static final long /*int*/ sel_pathForResource_ofType_inDirectory_forLocalization_ = SELECTORS[729];
+public static final long /*int*/ sel_performDragOperation_ = SELECTORS[730];
+public static final long /*int*/ sel_performKeyEquivalent_ = SELECTORS[731];
+public static final long /*int*/ sel_performSelector_withObject_afterDelay_inModes_ = SELECTORS[732];
+public static final long /*int*/ sel_performSelectorOnMainThread_withObject_waitUntilDone_ = SELECTORS[733];
+public static final long /*int*/ sel_phase = SELECTORS[734];
+public static final long /*int*/ sel_pixelsHigh = SELECTORS[735];
+public static final long /*int*/ sel_pixelsWide = SELECTORS[736];
+public static final long /*int*/ sel_pointSize = SELECTORS[737];
+public static final long /*int*/ sel_pointValue = SELECTORS[738];
+public static final long /*int*/ sel_pointingHandCursor = SELECTORS[739];
+public static final long /*int*/ sel_pop = SELECTORS[740];
+public static final long /*int*/ sel_popUpContextMenu_withEvent_forView_ = SELECTORS[741];
+public static final long /*int*/ sel_popUpStatusItemMenu_ = SELECTORS[742];
+public static final long /*int*/ sel_port = SELECTORS[743];
+public static final long /*int*/ sel_postEvent_atStart_ = SELECTORS[744];
+public static final long /*int*/ sel_preparedCellAtColumn_row_ = SELECTORS[745];
+public static final long /*int*/ sel_prependTransform_ = SELECTORS[746];
+public static final long /*int*/ sel_preventDefault = SELECTORS[747];
+public static final long /*int*/ sel_previousFailureCount = SELECTORS[748];
+public static final long /*int*/ sel_printDocumentView = SELECTORS[749];
+public static final long /*int*/ sel_printOperationWithPrintInfo_ = SELECTORS[750];
+public static final long /*int*/ sel_printOperationWithView_printInfo_ = SELECTORS[751];
+public static final long /*int*/ sel_printPanel = SELECTORS[752];
+public static final long /*int*/ sel_printSettings = SELECTORS[753];
+public static final long /*int*/ sel_printer = SELECTORS[754];
+public static final long /*int*/ sel_printerNames = SELECTORS[755];
+public static final long /*int*/ sel_printerWithName_ = SELECTORS[756];
+public static final long /*int*/ sel_propertyListForType_ = SELECTORS[757];
+public static final long /*int*/ sel_proposedCredential = SELECTORS[758];
+public static final long /*int*/ sel_protectionSpace = SELECTORS[759];
+public static final long /*int*/ sel_push = SELECTORS[760];
+public static final long /*int*/ sel_rangeValue = SELECTORS[761];
+public static final long /*int*/ sel_readSelectionFromPasteboard_ = SELECTORS[762];
+public static final long /*int*/ sel_realm = SELECTORS[763];
+public static final long /*int*/ sel_recentSearches = SELECTORS[764];
+public static final long /*int*/ sel_rectArrayForCharacterRange_withinSelectedCharacterRange_inTextContainer_rectCount_ = SELECTORS[765];
+public static final long /*int*/ sel_rectArrayForGlyphRange_withinSelectedGlyphRange_inTextContainer_rectCount_ = SELECTORS[766];
+public static final long /*int*/ sel_rectForPart_ = SELECTORS[767];
+public static final long /*int*/ sel_rectOfColumn_ = SELECTORS[768];
+public static final long /*int*/ sel_rectOfRow_ = SELECTORS[769];
+public static final long /*int*/ sel_rectValue = SELECTORS[770];
+public static final long /*int*/ sel_redComponent = SELECTORS[771];
+public static final long /*int*/ sel_redo = SELECTORS[772];
+public static final long /*int*/ sel_reflectScrolledClipView_ = SELECTORS[773];
+public static final long /*int*/ sel_registerForDraggedTypes_ = SELECTORS[774];
+public static final long /*int*/ sel_release = SELECTORS[775];
+public static final long /*int*/ sel_reload_ = SELECTORS[776];
+public static final long /*int*/ sel_reloadData = SELECTORS[777];
+public static final long /*int*/ sel_reloadItem_reloadChildren_ = SELECTORS[778];
+public static final long /*int*/ sel_removeAllItems = SELECTORS[779];
+public static final long /*int*/ sel_removeAllPoints = SELECTORS[780];
+public static final long /*int*/ sel_removeAttribute_range_ = SELECTORS[781];
+public static final long /*int*/ sel_removeChildWindow_ = SELECTORS[782];
+public static final long /*int*/ sel_removeColorWithKey_ = SELECTORS[783];
+public static final long /*int*/ sel_removeFromSuperview = SELECTORS[784];
+public static final long /*int*/ sel_removeIndex_ = SELECTORS[785];
+public static final long /*int*/ sel_removeItem_ = SELECTORS[786];
+public static final long /*int*/ sel_removeItemAtIndex_ = SELECTORS[787];
+public static final long /*int*/ sel_removeItemAtPath_error_ = SELECTORS[788];
+public static final long /*int*/ sel_removeLastObject = SELECTORS[789];
+public static final long /*int*/ sel_removeObject_ = SELECTORS[790];
+public static final long /*int*/ sel_removeObjectAtIndex_ = SELECTORS[791];
+public static final long /*int*/ sel_removeObjectForKey_ = SELECTORS[792];
+public static final long /*int*/ sel_removeObjectIdenticalTo_ = SELECTORS[793];
+public static final long /*int*/ sel_removeObserver_ = SELECTORS[794];
+public static final long /*int*/ sel_removeObserver_name_object_ = SELECTORS[795];
+public static final long /*int*/ sel_removeRepresentation_ = SELECTORS[796];
+public static final long /*int*/ sel_removeStatusItem_ = SELECTORS[797];
+public static final long /*int*/ sel_removeTabViewItem_ = SELECTORS[798];
+public static final long /*int*/ sel_removeTableColumn_ = SELECTORS[799];
+public static final long /*int*/ sel_removeTemporaryAttribute_forCharacterRange_ = SELECTORS[800];
+public static final long /*int*/ sel_removeToolTip_ = SELECTORS[801];
+public static final long /*int*/ sel_removeTrackingArea_ = SELECTORS[802];
+public static final long /*int*/ sel_replaceCharactersInRange_withString_ = SELECTORS[803];
+public static final long /*int*/ sel_replyToOpenOrPrint_ = SELECTORS[804];
+public static final long /*int*/ sel_representation = SELECTORS[805];
+public static final long /*int*/ sel_representations = SELECTORS[806];
+public static final long /*int*/ sel_request = SELECTORS[807];
+public static final long /*int*/ sel_requestWithURL_ = SELECTORS[808];
+public static final long /*int*/ sel_resetCursorRects = SELECTORS[809];
+public static final long /*int*/ sel_resignFirstResponder = SELECTORS[810];
+public static final long /*int*/ sel_resizeDownCursor = SELECTORS[811];
+public static final long /*int*/ sel_resizeLeftCursor = SELECTORS[812];
+public static final long /*int*/ sel_resizeLeftRightCursor = SELECTORS[813];
+public static final long /*int*/ sel_resizeRightCursor = SELECTORS[814];
+public static final long /*int*/ sel_resizeUpCursor = SELECTORS[815];
+public static final long /*int*/ sel_resizeUpDownCursor = SELECTORS[816];
+public static final long /*int*/ sel_resizingMask = SELECTORS[817];
+public static final long /*int*/ sel_resourcePath = SELECTORS[818];
+public static final long /*int*/ sel_respondsToSelector_ = SELECTORS[819];
+public static final long /*int*/ sel_restoreGraphicsState = SELECTORS[820];
+public static final long /*int*/ sel_retain = SELECTORS[821];
+public static final long /*int*/ sel_retainCount = SELECTORS[822];
+public static final long /*int*/ sel_rightMouseDown_ = SELECTORS[823];
+public static final long /*int*/ sel_rightMouseDragged_ = SELECTORS[824];
+public static final long /*int*/ sel_rightMouseUp_ = SELECTORS[825];
+public static final long /*int*/ sel_rotateByDegrees_ = SELECTORS[826];
+public static final long /*int*/ sel_rotateWithEvent_ = SELECTORS[827];
+public static final long /*int*/ sel_rotation = SELECTORS[828];
+public static final long /*int*/ sel_rowAtPoint_ = SELECTORS[829];
+public static final long /*int*/ sel_rowForItem_ = SELECTORS[830];
+public static final long /*int*/ sel_rowHeight = SELECTORS[831];
+public static final long /*int*/ sel_rowsInRect_ = SELECTORS[832];
+public static final long /*int*/ sel_run = SELECTORS[833];
+public static final long /*int*/ sel_runModal = SELECTORS[834];
+public static final long /*int*/ sel_runModalForDirectory_file_ = SELECTORS[835];
+public static final long /*int*/ sel_runModalForWindow_ = SELECTORS[836];
+public static final long /*int*/ sel_runModalWithPrintInfo_ = SELECTORS[837];
+public static final long /*int*/ sel_runMode_beforeDate_ = SELECTORS[838];
+public static final long /*int*/ sel_runOperation = SELECTORS[839];
+public static final long /*int*/ sel_samplesPerPixel = SELECTORS[840];
+public static final long /*int*/ sel_saveGraphicsState = SELECTORS[841];
+public static final long /*int*/ sel_savePanel = SELECTORS[842];
+public static final long /*int*/ sel_scaleXBy_yBy_ = SELECTORS[843];
+public static final long /*int*/ sel_scheduledTimerWithTimeInterval_target_selector_userInfo_repeats_ = SELECTORS[844];
+public static final long /*int*/ sel_screen = SELECTORS[845];
+public static final long /*int*/ sel_screenX = SELECTORS[846];
+public static final long /*int*/ sel_screenY = SELECTORS[847];
+public static final long /*int*/ sel_screens = SELECTORS[848];
+public static final long /*int*/ sel_scrollClipView_toPoint_ = SELECTORS[849];
+public static final long /*int*/ sel_scrollColumnToVisible_ = SELECTORS[850];
+public static final long /*int*/ sel_scrollPoint_ = SELECTORS[851];
+public static final long /*int*/ sel_scrollRangeToVisible_ = SELECTORS[852];
+public static final long /*int*/ sel_scrollRectToVisible_ = SELECTORS[853];
+public static final long /*int*/ sel_scrollRowToVisible_ = SELECTORS[854];
+public static final long /*int*/ sel_scrollToPoint_ = SELECTORS[855];
+public static final long /*int*/ sel_scrollWheel_ = SELECTORS[856];
+public static final long /*int*/ sel_scrollerWidth = SELECTORS[857];
+public static final long /*int*/ sel_scrollerWidthForControlSize_ = SELECTORS[858];
+public static final long /*int*/ sel_searchButtonCell = SELECTORS[859];
+public static final long /*int*/ sel_searchTextRectForBounds_ = SELECTORS[860];
+public static final long /*int*/ sel_secondOfMinute = SELECTORS[861];
+public static final long /*int*/ sel_secondarySelectedControlColor = SELECTORS[862];
+public static final long /*int*/ sel_selectAll_ = SELECTORS[863];
+public static final long /*int*/ sel_selectItem_ = SELECTORS[864];
+public static final long /*int*/ sel_selectItemAtIndex_ = SELECTORS[865];
+public static final long /*int*/ sel_selectRowIndexes_byExtendingSelection_ = SELECTORS[866];
+public static final long /*int*/ sel_selectTabViewItemAtIndex_ = SELECTORS[867];
+public static final long /*int*/ sel_selectText_ = SELECTORS[868];
+public static final long /*int*/ sel_selectedControlColor = SELECTORS[869];
+public static final long /*int*/ sel_selectedControlTextColor = SELECTORS[870];
+public static final long /*int*/ sel_selectedRange = SELECTORS[871];
+public static final long /*int*/ sel_selectedRow = SELECTORS[872];
+public static final long /*int*/ sel_selectedRowIndexes = SELECTORS[873];
+public static final long /*int*/ sel_selectedTabViewItem = SELECTORS[874];
+public static final long /*int*/ sel_selectedTextAttributes = SELECTORS[875];
+public static final long /*int*/ sel_selectedTextBackgroundColor = SELECTORS[876];
+public static final long /*int*/ sel_selectedTextColor = SELECTORS[877];
+public static final long /*int*/ sel_sendAction_to_ = SELECTORS[878];
+public static final long /*int*/ sel_sendAction_to_from_ = SELECTORS[879];
+public static final long /*int*/ sel_sendEvent_ = SELECTORS[880];
+public static final long /*int*/ sel_sender = SELECTORS[881];
+public static final long /*int*/ sel_separatorItem = SELECTORS[882];
+public static final long /*int*/ sel_set = SELECTORS[883];
+public static final long /*int*/ sel_setAcceptsMouseMovedEvents_ = SELECTORS[884];
+public static final long /*int*/ sel_setAcceptsTouchEvents_ = SELECTORS[885];
+public static final long /*int*/ sel_setAccessoryView_ = SELECTORS[886];
+public static final long /*int*/ sel_setAction_ = SELECTORS[887];
+public static final long /*int*/ sel_setAlertStyle_ = SELECTORS[888];
+public static final long /*int*/ sel_setAlignment_ = SELECTORS[889];
+public static final long /*int*/ sel_setAllowsColumnReordering_ = SELECTORS[890];
+public static final long /*int*/ sel_setAllowsFloats_ = SELECTORS[891];
+public static final long /*int*/ sel_setAllowsMixedState_ = SELECTORS[892];
+public static final long /*int*/ sel_setAllowsMultipleSelection_ = SELECTORS[893];
+public static final long /*int*/ sel_setAllowsUndo_ = SELECTORS[894];
+public static final long /*int*/ sel_setAllowsUserCustomization_ = SELECTORS[895];
+public static final long /*int*/ sel_setAlpha_ = SELECTORS[896];
+public static final long /*int*/ sel_setAlphaValue_ = SELECTORS[897];
+public static final long /*int*/ sel_setAlternateButtonTitle_ = SELECTORS[898];
+public static final long /*int*/ sel_setApplicationIconImage_ = SELECTORS[899];
+public static final long /*int*/ sel_setApplicationNameForUserAgent_ = SELECTORS[900];
+public static final long /*int*/ sel_setAttachmentCell_ = SELECTORS[901];
+public static final long /*int*/ sel_setAttributedString_ = SELECTORS[902];
+public static final long /*int*/ sel_setAttributedStringValue_ = SELECTORS[903];
+public static final long /*int*/ sel_setAttributedTitle_ = SELECTORS[904];
+public static final long /*int*/ sel_setAutoenablesItems_ = SELECTORS[905];
+public static final long /*int*/ sel_setAutohidesScrollers_ = SELECTORS[906];
+public static final long /*int*/ sel_setAutoresizesOutlineColumn_ = SELECTORS[907];
+public static final long /*int*/ sel_setAutoresizesSubviews_ = SELECTORS[908];
+public static final long /*int*/ sel_setAutoresizingMask_ = SELECTORS[909];
+public static final long /*int*/ sel_setAutosaveExpandedItems_ = SELECTORS[910];
+public static final long /*int*/ sel_setBackgroundColor_ = SELECTORS[911];
+public static final long /*int*/ sel_setBackgroundLayoutEnabled_ = SELECTORS[912];
+public static final long /*int*/ sel_setBackgroundStyle_ = SELECTORS[913];
+public static final long /*int*/ sel_setBadgeLabel_ = SELECTORS[914];
+public static final long /*int*/ sel_setBaseWritingDirection_ = SELECTORS[915];
+public static final long /*int*/ sel_setBaseWritingDirection_range_ = SELECTORS[916];
+public static final long /*int*/ sel_setBecomesKeyOnlyIfNeeded_ = SELECTORS[917];
+public static final long /*int*/ sel_setBezelStyle_ = SELECTORS[918];
+public static final long /*int*/ sel_setBezeled_ = SELECTORS[919];
+public static final long /*int*/ sel_setBorderType_ = SELECTORS[920];
+public static final long /*int*/ sel_setBorderWidth_ = SELECTORS[921];
+public static final long /*int*/ sel_setBordered_ = SELECTORS[922];
+public static final long /*int*/ sel_setBoundsRotation_ = SELECTORS[923];
+public static final long /*int*/ sel_setBoxType_ = SELECTORS[924];
+public static final long /*int*/ sel_setButtonType_ = SELECTORS[925];
+public static final long /*int*/ sel_setCacheMode_ = SELECTORS[926];
+public static final long /*int*/ sel_setCachePolicy_ = SELECTORS[927];
+public static final long /*int*/ sel_setCanChooseDirectories_ = SELECTORS[928];
+public static final long /*int*/ sel_setCanChooseFiles_ = SELECTORS[929];
+public static final long /*int*/ sel_setCanCreateDirectories_ = SELECTORS[930];
+public static final long /*int*/ sel_setCancelButtonCell_ = SELECTORS[931];
+public static final long /*int*/ sel_setCell_ = SELECTORS[932];
+public static final long /*int*/ sel_setCellClass_ = SELECTORS[933];
+public static final long /*int*/ sel_setClip = SELECTORS[934];
+public static final long /*int*/ sel_setCollectionBehavior_ = SELECTORS[935];
+public static final long /*int*/ sel_setColor_ = SELECTORS[936];
+public static final long /*int*/ sel_setColumnAutoresizingStyle_ = SELECTORS[937];
+public static final long /*int*/ sel_setCompositingOperation_ = SELECTORS[938];
+public static final long /*int*/ sel_setContainerSize_ = SELECTORS[939];
+public static final long /*int*/ sel_setContentView_ = SELECTORS[940];
+public static final long /*int*/ sel_setContentViewMargins_ = SELECTORS[941];
+public static final long /*int*/ sel_setControlSize_ = SELECTORS[942];
+public static final long /*int*/ sel_setCookie_ = SELECTORS[943];
+public static final long /*int*/ sel_setCopiesOnScroll_ = SELECTORS[944];
+public static final long /*int*/ sel_setCurrentContext_ = SELECTORS[945];
+public static final long /*int*/ sel_setCurrentOperation_ = SELECTORS[946];
+public static final long /*int*/ sel_setCustomUserAgent_ = SELECTORS[947];
+public static final long /*int*/ sel_setData_forType_ = SELECTORS[948];
+public static final long /*int*/ sel_setDataCell_ = SELECTORS[949];
+public static final long /*int*/ sel_setDataSource_ = SELECTORS[950];
+public static final long /*int*/ sel_setDatePickerElements_ = SELECTORS[951];
+public static final long /*int*/ sel_setDatePickerStyle_ = SELECTORS[952];
+public static final long /*int*/ sel_setDateValue_ = SELECTORS[953];
+public static final long /*int*/ sel_setDefaultButtonCell_ = SELECTORS[954];
+public static final long /*int*/ sel_setDefaultFlatness_ = SELECTORS[955];
+public static final long /*int*/ sel_setDefaultParagraphStyle_ = SELECTORS[956];
+public static final long /*int*/ sel_setDefaultTabInterval_ = SELECTORS[957];
+public static final long /*int*/ sel_setDelegate_ = SELECTORS[958];
+public static final long /*int*/ sel_setDestination_allowOverwrite_ = SELECTORS[959];
+public static final long /*int*/ sel_setDictionary_ = SELECTORS[960];
+public static final long /*int*/ sel_setDirectory_ = SELECTORS[961];
+public static final long /*int*/ sel_setDisplayMode_ = SELECTORS[962];
+public static final long /*int*/ sel_setDisplaysLinkToolTips_ = SELECTORS[963];
+public static final long /*int*/ sel_setDocumentCursor_ = SELECTORS[964];
+public static final long /*int*/ sel_setDocumentEdited_ = SELECTORS[965];
+public static final long /*int*/ sel_setDocumentView_ = SELECTORS[966];
+public static final long /*int*/ sel_setDoubleAction_ = SELECTORS[967];
+public static final long /*int*/ sel_setDoubleValue_ = SELECTORS[968];
+public static final long /*int*/ sel_setDownloadDelegate_ = SELECTORS[969];
+public static final long /*int*/ sel_setDrawsBackground_ = SELECTORS[970];
+public static final long /*int*/ sel_setDropItem_dropChildIndex_ = SELECTORS[971];
+public static final long /*int*/ sel_setDropRow_dropOperation_ = SELECTORS[972];
+public static final long /*int*/ sel_setEditable_ = SELECTORS[973];
+public static final long /*int*/ sel_setEnabled_ = SELECTORS[974];
+public static final long /*int*/ sel_setEnabled_forSegment_ = SELECTORS[975];
+public static final long /*int*/ sel_setFill = SELECTORS[976];
+public static final long /*int*/ sel_setFillColor_ = SELECTORS[977];
+public static final long /*int*/ sel_setFireDate_ = SELECTORS[978];
+public static final long /*int*/ sel_setFirstLineHeadIndent_ = SELECTORS[979];
+public static final long /*int*/ sel_setFloatingPanel_ = SELECTORS[980];
+public static final long /*int*/ sel_setFocusRingType_ = SELECTORS[981];
+public static final long /*int*/ sel_setFont_ = SELECTORS[982];
+public static final long /*int*/ sel_setFormatter_ = SELECTORS[983];
+public static final long /*int*/ sel_setFrame_ = SELECTORS[984];
+public static final long /*int*/ sel_setFrame_display_ = SELECTORS[985];
+public static final long /*int*/ sel_setFrame_display_animate_ = SELECTORS[986];
+public static final long /*int*/ sel_setFrameFromContentFrame_ = SELECTORS[987];
+public static final long /*int*/ sel_setFrameLoadDelegate_ = SELECTORS[988];
+public static final long /*int*/ sel_setFrameOrigin_ = SELECTORS[989];
+public static final long /*int*/ sel_setFrameSize_ = SELECTORS[990];
+public static final long /*int*/ sel_setGridStyleMask_ = SELECTORS[991];
+public static final long /*int*/ sel_setHTTPBody_ = SELECTORS[992];
+public static final long /*int*/ sel_setHTTPMethod_ = SELECTORS[993];
+public static final long /*int*/ sel_setHasHorizontalScroller_ = SELECTORS[994];
+public static final long /*int*/ sel_setHasShadow_ = SELECTORS[995];
+public static final long /*int*/ sel_setHasVerticalScroller_ = SELECTORS[996];
+public static final long /*int*/ sel_setHeadIndent_ = SELECTORS[997];
+public static final long /*int*/ sel_setHeaderCell_ = SELECTORS[998];
+public static final long /*int*/ sel_setHeaderView_ = SELECTORS[999];
+public static final long /*int*/ sel_setHelpMenu_ = SELECTORS[1000];
+public static final long /*int*/ sel_setHidden_ = SELECTORS[1001];
+public static final long /*int*/ sel_setHiddenUntilMouseMoves_ = SELECTORS[1002];
+public static final long /*int*/ sel_setHidesOnDeactivate_ = SELECTORS[1003];
+public static final long /*int*/ sel_setHighlightMode_ = SELECTORS[1004];
+public static final long /*int*/ sel_setHighlighted_ = SELECTORS[1005];
+public static final long /*int*/ sel_setHighlightedTableColumn_ = SELECTORS[1006];
+public static final long /*int*/ sel_setHighlightsBy_ = SELECTORS[1007];
+public static final long /*int*/ sel_setHorizontalScroller_ = SELECTORS[1008];
+public static final long /*int*/ sel_setHorizontallyResizable_ = SELECTORS[1009];
+public static final long /*int*/ sel_setIcon_ = SELECTORS[1010];
+public static final long /*int*/ sel_setIdentifier_ = SELECTORS[1011];
+public static final long /*int*/ sel_setImage_ = SELECTORS[1012];
+public static final long /*int*/ sel_setImage_forSegment_ = SELECTORS[1013];
+public static final long /*int*/ sel_setImageAlignment_ = SELECTORS[1014];
+public static final long /*int*/ sel_setImageInterpolation_ = SELECTORS[1015];
+public static final long /*int*/ sel_setImagePosition_ = SELECTORS[1016];
+public static final long /*int*/ sel_setImageScaling_ = SELECTORS[1017];
+public static final long /*int*/ sel_setIncrement_ = SELECTORS[1018];
+public static final long /*int*/ sel_setIndeterminate_ = SELECTORS[1019];
+public static final long /*int*/ sel_setIndicatorImage_inTableColumn_ = SELECTORS[1020];
+public static final long /*int*/ sel_setInteger_forKey_ = SELECTORS[1021];
+public static final long /*int*/ sel_setIntercellSpacing_ = SELECTORS[1022];
+public static final long /*int*/ sel_setJavaEnabled_ = SELECTORS[1023];
+public static final long /*int*/ sel_setJavaScriptEnabled_ = SELECTORS[1024];
+public static final long /*int*/ sel_setJobDisposition_ = SELECTORS[1025];
+public static final long /*int*/ sel_setJobTitle_ = SELECTORS[1026];
+public static final long /*int*/ sel_setKeyEquivalent_ = SELECTORS[1027];
+public static final long /*int*/ sel_setKeyEquivalentModifierMask_ = SELECTORS[1028];
+public static final long /*int*/ sel_setKnobProportion_ = SELECTORS[1029];
+public static final long /*int*/ sel_setLabel_ = SELECTORS[1030];
+public static final long /*int*/ sel_setLabel_forSegment_ = SELECTORS[1031];
+public static final long /*int*/ sel_setLeaf_ = SELECTORS[1032];
+public static final long /*int*/ sel_setLength_ = SELECTORS[1033];
+public static final long /*int*/ sel_setLevel_ = SELECTORS[1034];
+public static final long /*int*/ sel_setLineBreakMode_ = SELECTORS[1035];
+public static final long /*int*/ sel_setLineCapStyle_ = SELECTORS[1036];
+public static final long /*int*/ sel_setLineDash_count_phase_ = SELECTORS[1037];
+public static final long /*int*/ sel_setLineFragmentPadding_ = SELECTORS[1038];
+public static final long /*int*/ sel_setLineFragmentRect_forGlyphRange_usedRect_ = SELECTORS[1039];
+public static final long /*int*/ sel_setLineJoinStyle_ = SELECTORS[1040];
+public static final long /*int*/ sel_setLineSpacing_ = SELECTORS[1041];
+public static final long /*int*/ sel_setLineWidth_ = SELECTORS[1042];
+public static final long /*int*/ sel_setLinkTextAttributes_ = SELECTORS[1043];
+public static final long /*int*/ sel_setMainMenu_ = SELECTORS[1044];
+public static final long /*int*/ sel_setMarkedText_selectedRange_ = SELECTORS[1045];
+public static final long /*int*/ sel_setMaxSize_ = SELECTORS[1046];
+public static final long /*int*/ sel_setMaxValue_ = SELECTORS[1047];
+public static final long /*int*/ sel_setMaximum_ = SELECTORS[1048];
+public static final long /*int*/ sel_setMaximumFractionDigits_ = SELECTORS[1049];
+public static final long /*int*/ sel_setMaximumIntegerDigits_ = SELECTORS[1050];
+public static final long /*int*/ sel_setMenu_ = SELECTORS[1051];
+public static final long /*int*/ sel_setMenu_forSegment_ = SELECTORS[1052];
+public static final long /*int*/ sel_setMenuFormRepresentation_ = SELECTORS[1053];
+public static final long /*int*/ sel_setMessage_ = SELECTORS[1054];
+public static final long /*int*/ sel_setMessageText_ = SELECTORS[1055];
+public static final long /*int*/ sel_setMinSize_ = SELECTORS[1056];
+public static final long /*int*/ sel_setMinValue_ = SELECTORS[1057];
+public static final long /*int*/ sel_setMinWidth_ = SELECTORS[1058];
+public static final long /*int*/ sel_setMinimum_ = SELECTORS[1059];
+public static final long /*int*/ sel_setMinimumFractionDigits_ = SELECTORS[1060];
+public static final long /*int*/ sel_setMinimumIntegerDigits_ = SELECTORS[1061];
+public static final long /*int*/ sel_setMiterLimit_ = SELECTORS[1062];
+public static final long /*int*/ sel_setNeedsDisplay_ = SELECTORS[1063];
+public static final long /*int*/ sel_setNeedsDisplayInRect_ = SELECTORS[1064];
+public static final long /*int*/ sel_setNumberOfVisibleItems_ = SELECTORS[1065];
+public static final long /*int*/ sel_setNumberStyle_ = SELECTORS[1066];
+public static final long /*int*/ sel_setObject_forKey_ = SELECTORS[1067];
+public static final long /*int*/ sel_setObjectValue_ = SELECTORS[1068];
+public static final long /*int*/ sel_setOnMouseEntered_ = SELECTORS[1069];
+public static final long /*int*/ sel_setOpaque_ = SELECTORS[1070];
+public static final long /*int*/ sel_setOptions_ = SELECTORS[1071];
+public static final long /*int*/ sel_setOutlineTableColumn_ = SELECTORS[1072];
+public static final long /*int*/ sel_setPaletteLabel_ = SELECTORS[1073];
+public static final long /*int*/ sel_setPanelFont_isMultiple_ = SELECTORS[1074];
+public static final long /*int*/ sel_setPartialStringValidationEnabled_ = SELECTORS[1075];
+public static final long /*int*/ sel_setPatternPhase_ = SELECTORS[1076];
+public static final long /*int*/ sel_setPlaceholderString_ = SELECTORS[1077];
+public static final long /*int*/ sel_setPolicyDelegate_ = SELECTORS[1078];
+public static final long /*int*/ sel_setPreferences_ = SELECTORS[1079];
+public static final long /*int*/ sel_setPrinter_ = SELECTORS[1080];
+public static final long /*int*/ sel_setPropertyList_forType_ = SELECTORS[1081];
+public static final long /*int*/ sel_setPullsDown_ = SELECTORS[1082];
+public static final long /*int*/ sel_setReleasedWhenClosed_ = SELECTORS[1083];
+public static final long /*int*/ sel_setRepresentedFilename_ = SELECTORS[1084];
+public static final long /*int*/ sel_setRepresentedURL_ = SELECTORS[1085];
+public static final long /*int*/ sel_setResizingMask_ = SELECTORS[1086];
+public static final long /*int*/ sel_setResourceLoadDelegate_ = SELECTORS[1087];
+public static final long /*int*/ sel_setRichText_ = SELECTORS[1088];
+public static final long /*int*/ sel_setRowHeight_ = SELECTORS[1089];
+public static final long /*int*/ sel_setScalesWhenResized_ = SELECTORS[1090];
+public static final long /*int*/ sel_setScrollable_ = SELECTORS[1091];
+public static final long /*int*/ sel_setSearchButtonCell_ = SELECTORS[1092];
+public static final long /*int*/ sel_setSegmentCount_ = SELECTORS[1093];
+public static final long /*int*/ sel_setSegmentStyle_ = SELECTORS[1094];
+public static final long /*int*/ sel_setSelectable_ = SELECTORS[1095];
+public static final long /*int*/ sel_setSelected_forSegment_ = SELECTORS[1096];
+public static final long /*int*/ sel_setSelectedItemIdentifier_ = SELECTORS[1097];
+public static final long /*int*/ sel_setSelectedRange_ = SELECTORS[1098];
+public static final long /*int*/ sel_setSelectedSegment_ = SELECTORS[1099];
+public static final long /*int*/ sel_setSelectedTextAttributes_ = SELECTORS[1100];
+public static final long /*int*/ sel_setServicesMenu_ = SELECTORS[1101];
+public static final long /*int*/ sel_setShouldAntialias_ = SELECTORS[1102];
+public static final long /*int*/ sel_setShowsHelp_ = SELECTORS[1103];
+public static final long /*int*/ sel_setShowsPrintPanel_ = SELECTORS[1104];
+public static final long /*int*/ sel_setShowsProgressPanel_ = SELECTORS[1105];
+public static final long /*int*/ sel_setShowsResizeIndicator_ = SELECTORS[1106];
+public static final long /*int*/ sel_setShowsToolbarButton_ = SELECTORS[1107];
+public static final long /*int*/ sel_setSize_ = SELECTORS[1108];
+public static final long /*int*/ sel_setState_ = SELECTORS[1109];
+public static final long /*int*/ sel_setString_ = SELECTORS[1110];
+public static final long /*int*/ sel_setString_forType_ = SELECTORS[1111];
+public static final long /*int*/ sel_setStringValue_ = SELECTORS[1112];
+public static final long /*int*/ sel_setStroke = SELECTORS[1113];
+public static final long /*int*/ sel_setSubmenu_ = SELECTORS[1114];
+public static final long /*int*/ sel_setSubmenu_forItem_ = SELECTORS[1115];
+public static final long /*int*/ sel_setTabStops_ = SELECTORS[1116];
+public static final long /*int*/ sel_setTabViewType_ = SELECTORS[1117];
+public static final long /*int*/ sel_setTag_ = SELECTORS[1118];
+public static final long /*int*/ sel_setTag_forSegment_ = SELECTORS[1119];
+public static final long /*int*/ sel_setTarget_ = SELECTORS[1120];
+public static final long /*int*/ sel_setTextColor_ = SELECTORS[1121];
+public static final long /*int*/ sel_setTextStorage_ = SELECTORS[1122];
+public static final long /*int*/ sel_setTitle_ = SELECTORS[1123];
+public static final long /*int*/ sel_setTitleFont_ = SELECTORS[1124];
+public static final long /*int*/ sel_setTitlePosition_ = SELECTORS[1125];
+public static final long /*int*/ sel_setToolTip_ = SELECTORS[1126];
+public static final long /*int*/ sel_setToolTip_forSegment_ = SELECTORS[1127];
+public static final long /*int*/ sel_setToolbar_ = SELECTORS[1128];
+public static final long /*int*/ sel_setTrackingMode_ = SELECTORS[1129];
+public static final long /*int*/ sel_setTransformStruct_ = SELECTORS[1130];
+public static final long /*int*/ sel_setUIDelegate_ = SELECTORS[1131];
+public static final long /*int*/ sel_setURL_ = SELECTORS[1132];
+public static final long /*int*/ sel_setUpPrintOperationDefaultValues = SELECTORS[1133];
+public static final long /*int*/ sel_setUsesAlternatingRowBackgroundColors_ = SELECTORS[1134];
+public static final long /*int*/ sel_setUsesFontPanel_ = SELECTORS[1135];
+public static final long /*int*/ sel_setUsesScreenFonts_ = SELECTORS[1136];
+public static final long /*int*/ sel_setUsesSingleLineMode_ = SELECTORS[1137];
+public static final long /*int*/ sel_setUsesThreadedAnimation_ = SELECTORS[1138];
+public static final long /*int*/ sel_setValue_forHTTPHeaderField_ = SELECTORS[1139];
+public static final long /*int*/ sel_setValue_forKey_ = SELECTORS[1140];
+public static final long /*int*/ sel_setValueWraps_ = SELECTORS[1141];
+public static final long /*int*/ sel_setValues_forParameter_ = SELECTORS[1142];
+public static final long /*int*/ sel_setVerticalScroller_ = SELECTORS[1143];
+public static final long /*int*/ sel_setView_ = SELECTORS[1144];
+public static final long /*int*/ sel_setVisible_ = SELECTORS[1145];
+public static final long /*int*/ sel_setWantsRestingTouches_ = SELECTORS[1146];
+public static final long /*int*/ sel_setWidth_ = SELECTORS[1147];
+public static final long /*int*/ sel_setWidth_forSegment_ = SELECTORS[1148];
+public static final long /*int*/ sel_setWidthTracksTextView_ = SELECTORS[1149];
+public static final long /*int*/ sel_setWindingRule_ = SELECTORS[1150];
+public static final long /*int*/ sel_setWorksWhenModal_ = SELECTORS[1151];
+public static final long /*int*/ sel_setWraps_ = SELECTORS[1152];
+public static final long /*int*/ sel_sharedApplication = SELECTORS[1153];
+public static final long /*int*/ sel_sharedCertificateTrustPanel = SELECTORS[1154];
+public static final long /*int*/ sel_sharedColorPanel = SELECTORS[1155];
+public static final long /*int*/ sel_sharedFontManager = SELECTORS[1156];
+public static final long /*int*/ sel_sharedFontPanel = SELECTORS[1157];
+public static final long /*int*/ sel_sharedHTTPCookieStorage = SELECTORS[1158];
+public static final long /*int*/ sel_sharedPrintInfo = SELECTORS[1159];
+public static final long /*int*/ sel_sharedWorkspace = SELECTORS[1160];
+public static final long /*int*/ sel_shiftKey = SELECTORS[1161];
+public static final long /*int*/ sel_shouldAntialias = SELECTORS[1162];
+public static final long /*int*/ sel_shouldChangeTextInRange_replacementString_ = SELECTORS[1163];
+public static final long /*int*/ sel_shouldDelayWindowOrderingForEvent_ = SELECTORS[1164];
+public static final long /*int*/ sel_shouldDrawInsertionPoint = SELECTORS[1165];
+public static final long /*int*/ sel_size = SELECTORS[1166];
+public static final long /*int*/ sel_sizeOfLabel_ = SELECTORS[1167];
+public static final long /*int*/ sel_sizeToFit = SELECTORS[1168];
+public static final long /*int*/ sel_sizeValue = SELECTORS[1169];
+public static final long /*int*/ sel_skipDescendents = SELECTORS[1170];
+public static final long /*int*/ sel_smallSystemFontSize = SELECTORS[1171];
+public static final long /*int*/ sel_sortIndicatorRectForBounds_ = SELECTORS[1172];
+public static final long /*int*/ sel_standardPreferences = SELECTORS[1173];
+public static final long /*int*/ sel_standardUserDefaults = SELECTORS[1174];
+public static final long /*int*/ sel_standardWindowButton_ = SELECTORS[1175];
+public static final long /*int*/ sel_startAnimation_ = SELECTORS[1176];
+public static final long /*int*/ sel_state = SELECTORS[1177];
+public static final long /*int*/ sel_statusItemWithLength_ = SELECTORS[1178];
+public static final long /*int*/ sel_stop_ = SELECTORS[1179];
+public static final long /*int*/ sel_stopAnimation_ = SELECTORS[1180];
+public static final long /*int*/ sel_stopLoading_ = SELECTORS[1181];
+public static final long /*int*/ sel_string = SELECTORS[1182];
+public static final long /*int*/ sel_stringByAddingPercentEscapesUsingEncoding_ = SELECTORS[1183];
+public static final long /*int*/ sel_stringByAppendingPathComponent_ = SELECTORS[1184];
+public static final long /*int*/ sel_stringByAppendingPathExtension_ = SELECTORS[1185];
+public static final long /*int*/ sel_stringByAppendingString_ = SELECTORS[1186];
+public static final long /*int*/ sel_stringByDeletingLastPathComponent = SELECTORS[1187];
+public static final long /*int*/ sel_stringByDeletingPathExtension = SELECTORS[1188];
+public static final long /*int*/ sel_stringByReplacingOccurrencesOfString_withString_ = SELECTORS[1189];
+public static final long /*int*/ sel_stringByReplacingPercentEscapesUsingEncoding_ = SELECTORS[1190];
+public static final long /*int*/ sel_stringForObjectValue_ = SELECTORS[1191];
+public static final long /*int*/ sel_stringForType_ = SELECTORS[1192];
+public static final long /*int*/ sel_stringValue = SELECTORS[1193];
+public static final long /*int*/ sel_stringWithCharacters_length_ = SELECTORS[1194];
+public static final long /*int*/ sel_stringWithFormat_ = SELECTORS[1195];
+public static final long /*int*/ sel_stringWithUTF8String_ = SELECTORS[1196];
+public static final long /*int*/ sel_stroke = SELECTORS[1197];
+public static final long /*int*/ sel_strokeRect_ = SELECTORS[1198];
+public static final long /*int*/ sel_styleMask = SELECTORS[1199];
+public static final long /*int*/ sel_submenu = SELECTORS[1200];
+public static final long /*int*/ sel_subviews = SELECTORS[1201];
+public static final long /*int*/ sel_superclass = SELECTORS[1202];
+public static final long /*int*/ sel_superview = SELECTORS[1203];
+public static final long /*int*/ sel_swipeWithEvent_ = SELECTORS[1204];
+public static final long /*int*/ sel_systemFontOfSize_ = SELECTORS[1205];
+public static final long /*int*/ sel_systemFontSize = SELECTORS[1206];
+public static final long /*int*/ sel_systemFontSizeForControlSize_ = SELECTORS[1207];
+public static final long /*int*/ sel_systemStatusBar = SELECTORS[1208];
+public static final long /*int*/ sel_systemVersion = SELECTORS[1209];
+public static final long /*int*/ sel_tabStopType = SELECTORS[1210];
+public static final long /*int*/ sel_tabStops = SELECTORS[1211];
+public static final long /*int*/ sel_tabView_didSelectTabViewItem_ = SELECTORS[1212];
+public static final long /*int*/ sel_tabView_shouldSelectTabViewItem_ = SELECTORS[1213];
+public static final long /*int*/ sel_tabView_willSelectTabViewItem_ = SELECTORS[1214];
+public static final long /*int*/ sel_tabViewItemAtPoint_ = SELECTORS[1215];
+public static final long /*int*/ sel_tableColumns = SELECTORS[1216];
+public static final long /*int*/ sel_tableView_acceptDrop_row_dropOperation_ = SELECTORS[1217];
+public static final long /*int*/ sel_tableView_didClickTableColumn_ = SELECTORS[1218];
+public static final long /*int*/ sel_tableView_objectValueForTableColumn_row_ = SELECTORS[1219];
+public static final long /*int*/ sel_tableView_setObjectValue_forTableColumn_row_ = SELECTORS[1220];
+public static final long /*int*/ sel_tableView_shouldEditTableColumn_row_ = SELECTORS[1221];
+public static final long /*int*/ sel_tableView_shouldReorderColumn_toColumn_ = SELECTORS[1222];
+public static final long /*int*/ sel_tableView_shouldSelectRow_ = SELECTORS[1223];
+public static final long /*int*/ sel_tableView_shouldTrackCell_forTableColumn_row_ = SELECTORS[1224];
+public static final long /*int*/ sel_tableView_validateDrop_proposedRow_proposedDropOperation_ = SELECTORS[1225];
+public static final long /*int*/ sel_tableView_willDisplayCell_forTableColumn_row_ = SELECTORS[1226];
+public static final long /*int*/ sel_tableView_writeRowsWithIndexes_toPasteboard_ = SELECTORS[1227];
+public static final long /*int*/ sel_tableViewColumnDidMove_ = SELECTORS[1228];
+public static final long /*int*/ sel_tableViewColumnDidResize_ = SELECTORS[1229];
+public static final long /*int*/ sel_tableViewSelectionDidChange_ = SELECTORS[1230];
+public static final long /*int*/ sel_tableViewSelectionIsChanging_ = SELECTORS[1231];
+public static final long /*int*/ sel_tag = SELECTORS[1232];
+public static final long /*int*/ sel_target = SELECTORS[1233];
+public static final long /*int*/ sel_terminate_ = SELECTORS[1234];
+public static final long /*int*/ sel_testPart_ = SELECTORS[1235];
+public static final long /*int*/ sel_textBackgroundColor = SELECTORS[1236];
+public static final long /*int*/ sel_textColor = SELECTORS[1237];
+public static final long /*int*/ sel_textContainer = SELECTORS[1238];
+public static final long /*int*/ sel_textDidChange_ = SELECTORS[1239];
+public static final long /*int*/ sel_textDidEndEditing_ = SELECTORS[1240];
+public static final long /*int*/ sel_textStorage = SELECTORS[1241];
+public static final long /*int*/ sel_textView_clickedOnLink_atIndex_ = SELECTORS[1242];
+public static final long /*int*/ sel_textView_willChangeSelectionFromCharacterRange_toCharacterRange_ = SELECTORS[1243];
+public static final long /*int*/ sel_textViewDidChangeSelection_ = SELECTORS[1244];
+public static final long /*int*/ sel_thickness = SELECTORS[1245];
+public static final long /*int*/ sel_threadDictionary = SELECTORS[1246];
+public static final long /*int*/ sel_tile = SELECTORS[1247];
+public static final long /*int*/ sel_timeZone = SELECTORS[1248];
+public static final long /*int*/ sel_timestamp = SELECTORS[1249];
+public static final long /*int*/ sel_title = SELECTORS[1250];
+public static final long /*int*/ sel_titleCell = SELECTORS[1251];
+public static final long /*int*/ sel_titleFont = SELECTORS[1252];
+public static final long /*int*/ sel_titleOfSelectedItem = SELECTORS[1253];
+public static final long /*int*/ sel_titleRectForBounds_ = SELECTORS[1254];
+public static final long /*int*/ sel_toggleToolbarShown_ = SELECTORS[1255];
+public static final long /*int*/ sel_toolbar = SELECTORS[1256];
+public static final long /*int*/ sel_toolbar_itemForItemIdentifier_willBeInsertedIntoToolbar_ = SELECTORS[1257];
+public static final long /*int*/ sel_toolbarAllowedItemIdentifiers_ = SELECTORS[1258];
+public static final long /*int*/ sel_toolbarDefaultItemIdentifiers_ = SELECTORS[1259];
+public static final long /*int*/ sel_toolbarDidRemoveItem_ = SELECTORS[1260];
+public static final long /*int*/ sel_toolbarSelectableItemIdentifiers_ = SELECTORS[1261];
+public static final long /*int*/ sel_toolbarWillAddItem_ = SELECTORS[1262];
+public static final long /*int*/ sel_touchesBeganWithEvent_ = SELECTORS[1263];
+public static final long /*int*/ sel_touchesCancelledWithEvent_ = SELECTORS[1264];
+public static final long /*int*/ sel_touchesEndedWithEvent_ = SELECTORS[1265];
+public static final long /*int*/ sel_touchesMatchingPhase_inView_ = SELECTORS[1266];
+public static final long /*int*/ sel_touchesMovedWithEvent_ = SELECTORS[1267];
+public static final long /*int*/ sel_trackingAreas = SELECTORS[1268];
+public static final long /*int*/ sel_traitsOfFont_ = SELECTORS[1269];
+public static final long /*int*/ sel_transform = SELECTORS[1270];
+public static final long /*int*/ sel_transformPoint_ = SELECTORS[1271];
+public static final long /*int*/ sel_transformSize_ = SELECTORS[1272];
+public static final long /*int*/ sel_transformStruct = SELECTORS[1273];
+public static final long /*int*/ sel_transformUsingAffineTransform_ = SELECTORS[1274];
+public static final long /*int*/ sel_translateXBy_yBy_ = SELECTORS[1275];
+public static final long /*int*/ sel_type = SELECTORS[1276];
+public static final long /*int*/ sel_type_conformsToType_ = SELECTORS[1277];
+public static final long /*int*/ sel_typeOfFile_error_ = SELECTORS[1278];
+public static final long /*int*/ sel_types = SELECTORS[1279];
+public static final long /*int*/ sel_typesetter = SELECTORS[1280];
+public static final long /*int*/ sel_unarchiveObjectWithData_ = SELECTORS[1281];
+public static final long /*int*/ sel_undefined = SELECTORS[1282];
+public static final long /*int*/ sel_undo = SELECTORS[1283];
+public static final long /*int*/ sel_undoManager = SELECTORS[1284];
+public static final long /*int*/ sel_unhideAllApplications_ = SELECTORS[1285];
+public static final long /*int*/ sel_unlockFocus = SELECTORS[1286];
+public static final long /*int*/ sel_unmarkText = SELECTORS[1287];
+public static final long /*int*/ sel_unregisterDraggedTypes = SELECTORS[1288];
+public static final long /*int*/ sel_update = SELECTORS[1289];
+public static final long /*int*/ sel_updateFromPMPrintSettings = SELECTORS[1290];
+public static final long /*int*/ sel_updateTrackingAreas = SELECTORS[1291];
+public static final long /*int*/ sel_use = SELECTORS[1292];
+public static final long /*int*/ sel_useCredential_forAuthenticationChallenge_ = SELECTORS[1293];
+public static final long /*int*/ sel_usedRectForTextContainer_ = SELECTORS[1294];
+public static final long /*int*/ sel_user = SELECTORS[1295];
+public static final long /*int*/ sel_userInfo = SELECTORS[1296];
+public static final long /*int*/ sel_userSpaceScaleFactor = SELECTORS[1297];
+public static final long /*int*/ sel_usesAlternatingRowBackgroundColors = SELECTORS[1298];
+public static final long /*int*/ sel_validAttributesForMarkedText = SELECTORS[1299];
+public static final long /*int*/ sel_validModesForFontPanel_ = SELECTORS[1300];
+public static final long /*int*/ sel_validRequestorForSendType_returnType_ = SELECTORS[1301];
+public static final long /*int*/ sel_validateMenuItem_ = SELECTORS[1302];
+public static final long /*int*/ sel_validateVisibleColumns = SELECTORS[1303];
+public static final long /*int*/ sel_value = SELECTORS[1304];
+public static final long /*int*/ sel_valueForKey_ = SELECTORS[1305];
+public static final long /*int*/ sel_valueWithPoint_ = SELECTORS[1306];
+public static final long /*int*/ sel_valueWithRange_ = SELECTORS[1307];
+public static final long /*int*/ sel_valueWithRect_ = SELECTORS[1308];
+public static final long /*int*/ sel_valueWithSize_ = SELECTORS[1309];
+public static final long /*int*/ sel_view = SELECTORS[1310];
+public static final long /*int*/ sel_view_stringForToolTip_point_userData_ = SELECTORS[1311];
+public static final long /*int*/ sel_viewDidMoveToWindow = SELECTORS[1312];
+public static final long /*int*/ sel_viewWillMoveToWindow_ = SELECTORS[1313];
+public static final long /*int*/ sel_visibleFrame = SELECTORS[1314];
+public static final long /*int*/ sel_visibleRect = SELECTORS[1315];
+public static final long /*int*/ sel_wantsPeriodicDraggingUpdates = SELECTORS[1316];
+public static final long /*int*/ sel_wantsToHandleMouseEvents = SELECTORS[1317];
+public static final long /*int*/ sel_webFrame = SELECTORS[1318];
+public static final long /*int*/ sel_webScriptValueAtIndex_ = SELECTORS[1319];
+public static final long /*int*/ sel_webView_contextMenuItemsForElement_defaultMenuItems_ = SELECTORS[1320];
+public static final long /*int*/ sel_webView_createWebViewWithRequest_ = SELECTORS[1321];
+public static final long /*int*/ sel_webView_decidePolicyForMIMEType_request_frame_decisionListener_ = SELECTORS[1322];
+public static final long /*int*/ sel_webView_decidePolicyForNavigationAction_request_frame_decisionListener_ = SELECTORS[1323];
+public static final long /*int*/ sel_webView_decidePolicyForNewWindowAction_request_newFrameName_decisionListener_ = SELECTORS[1324];
+public static final long /*int*/ sel_webView_didChangeLocationWithinPageForFrame_ = SELECTORS[1325];
+public static final long /*int*/ sel_webView_didCommitLoadForFrame_ = SELECTORS[1326];
+public static final long /*int*/ sel_webView_didFailProvisionalLoadWithError_forFrame_ = SELECTORS[1327];
+public static final long /*int*/ sel_webView_didFinishLoadForFrame_ = SELECTORS[1328];
+public static final long /*int*/ sel_webView_didReceiveTitle_forFrame_ = SELECTORS[1329];
+public static final long /*int*/ sel_webView_didStartProvisionalLoadForFrame_ = SELECTORS[1330];
+public static final long /*int*/ sel_webView_identifierForInitialRequest_fromDataSource_ = SELECTORS[1331];
+public static final long /*int*/ sel_webView_mouseDidMoveOverElement_modifierFlags_ = SELECTORS[1332];
+public static final long /*int*/ sel_webView_printFrameView_ = SELECTORS[1333];
+public static final long /*int*/ sel_webView_resource_didFailLoadingWithError_fromDataSource_ = SELECTORS[1334];
+public static final long /*int*/ sel_webView_resource_didFinishLoadingFromDataSource_ = SELECTORS[1335];
+public static final long /*int*/ sel_webView_resource_didReceiveAuthenticationChallenge_fromDataSource_ = SELECTORS[1336];
+public static final long /*int*/ sel_webView_resource_willSendRequest_redirectResponse_fromDataSource_ = SELECTORS[1337];
+public static final long /*int*/ sel_webView_runBeforeUnloadConfirmPanelWithMessage_initiatedByFrame_ = SELECTORS[1338];
+public static final long /*int*/ sel_webView_runJavaScriptAlertPanelWithMessage_ = SELECTORS[1339];
+public static final long /*int*/ sel_webView_runJavaScriptAlertPanelWithMessage_initiatedByFrame_ = SELECTORS[1340];
+public static final long /*int*/ sel_webView_runJavaScriptConfirmPanelWithMessage_ = SELECTORS[1341];
+public static final long /*int*/ sel_webView_runJavaScriptConfirmPanelWithMessage_initiatedByFrame_ = SELECTORS[1342];
+public static final long /*int*/ sel_webView_runOpenPanelForFileButtonWithResultListener_ = SELECTORS[1343];
+public static final long /*int*/ sel_webView_setFrame_ = SELECTORS[1344];
+public static final long /*int*/ sel_webView_setResizable_ = SELECTORS[1345];
+public static final long /*int*/ sel_webView_setStatusBarVisible_ = SELECTORS[1346];
+public static final long /*int*/ sel_webView_setStatusText_ = SELECTORS[1347];
+public static final long /*int*/ sel_webView_setToolbarsVisible_ = SELECTORS[1348];
+public static final long /*int*/ sel_webView_unableToImplementPolicyWithError_frame_ = SELECTORS[1349];
+public static final long /*int*/ sel_webView_windowScriptObjectAvailable_ = SELECTORS[1350];
+public static final long /*int*/ sel_webViewClose_ = SELECTORS[1351];
+public static final long /*int*/ sel_webViewFocus_ = SELECTORS[1352];
+public static final long /*int*/ sel_webViewShow_ = SELECTORS[1353];
+public static final long /*int*/ sel_webViewUnfocus_ = SELECTORS[1354];
+public static final long /*int*/ sel_weightOfFont_ = SELECTORS[1355];
+public static final long /*int*/ sel_wheelDelta = SELECTORS[1356];
+public static final long /*int*/ sel_width = SELECTORS[1357];
+public static final long /*int*/ sel_window = SELECTORS[1358];
+public static final long /*int*/ sel_windowBackgroundColor = SELECTORS[1359];
+public static final long /*int*/ sel_windowDidBecomeKey_ = SELECTORS[1360];
+public static final long /*int*/ sel_windowDidDeminiaturize_ = SELECTORS[1361];
+public static final long /*int*/ sel_windowDidMiniaturize_ = SELECTORS[1362];
+public static final long /*int*/ sel_windowDidMove_ = SELECTORS[1363];
+public static final long /*int*/ sel_windowDidResignKey_ = SELECTORS[1364];
+public static final long /*int*/ sel_windowDidResize_ = SELECTORS[1365];
+public static final long /*int*/ sel_windowFrameColor = SELECTORS[1366];
+public static final long /*int*/ sel_windowFrameTextColor = SELECTORS[1367];
+public static final long /*int*/ sel_windowNumber = SELECTORS[1368];
+public static final long /*int*/ sel_windowNumberAtPoint_belowWindowWithWindowNumber_ = SELECTORS[1369];
+public static final long /*int*/ sel_windowRef = SELECTORS[1370];
+public static final long /*int*/ sel_windowShouldClose_ = SELECTORS[1371];
+public static final long /*int*/ sel_windowWillClose_ = SELECTORS[1372];
+public static final long /*int*/ sel_windowWithWindowNumber_ = SELECTORS[1373];
+public static final long /*int*/ sel_windows = SELECTORS[1374];
+public static final long /*int*/ sel_worksWhenModal = SELECTORS[1375];
+public static final long /*int*/ sel_wraps = SELECTORS[1376];
+public static final long /*int*/ sel_writeSelectionToPasteboard_types_ = SELECTORS[1377];
+public static final long /*int*/ sel_writeToPasteboard_ = SELECTORS[1378];
+public static final long /*int*/ sel_yearOfCommonEra = SELECTORS[1379];
+public static final long /*int*/ sel_zoom_ = SELECTORS[1380];
 
 /** Constants */
 public static final int NSAlertFirstButtonReturn = 1000;
@@ -34,6 +34,7 @@ JNIEXPORT void JNICALL C_NATIVE(free)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	C_NATIVE_ENTER(env, that, free_FUNC);
+	NATIVE_RESOURCE_DESTROY(env, arg0);
 	free((void *)arg0);
 	C_NATIVE_EXIT(env, that, free_FUNC);
 }
@@ -49,7 +50,7 @@ JNIEXPORT jintLong JNICALL C_NATIVE(getenv)
 	if (arg0) if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jintLong)getenv((const char *)lparg0);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	C_NATIVE_EXIT(env, that, getenv_FUNC);
 	return rc;
 }
@@ -62,6 +63,7 @@ JNIEXPORT jintLong JNICALL C_NATIVE(malloc)
 	jintLong rc = 0;
 	C_NATIVE_ENTER(env, that, malloc_FUNC);
 	rc = (jintLong)malloc(arg0);
+	NATIVE_RESOURCE_CREATE(env, "malloc", rc, arg0);
 	C_NATIVE_EXIT(env, that, malloc_FUNC);
 	return rc;
 }
@@ -633,7 +635,7 @@ fail:
 	{
 		if (arg0 && lparg0) (*env)->ReleaseIntArrayElements(env, arg0, lparg0, 0);
 	}
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 #ifndef JNI64
 	C_NATIVE_EXIT(env, that, memmove___3I_3BI_FUNC);
 #else
@@ -720,6 +722,111 @@ fail:
 }
 #endif
 
+#if (!defined(NO_memmove2D__IIIIIIII) && !defined(JNI64)) || (!defined(NO_memmove2D__JIJIIIII) && defined(JNI64))
+#ifndef JNI64
+JNIEXPORT jboolean JNICALL C_NATIVE(memmove2D__IIIIIIII)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7)
+#else
+JNIEXPORT jboolean JNICALL C_NATIVE(memmove2D__JIJIIIII)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7)
+#endif
+{
+	jboolean rc = 0;
+#ifndef JNI64
+	C_NATIVE_ENTER(env, that, memmove2D__IIIIIIII_FUNC);
+#else
+	C_NATIVE_ENTER(env, that, memmove2D__JIJIIIII_FUNC);
+#endif
+	rc = (jboolean)swtMemmove2D((void *)arg0, arg1, (const void *)arg2, arg3, arg4, arg5, arg6, arg7);
+#ifndef JNI64
+	C_NATIVE_EXIT(env, that, memmove2D__IIIIIIII_FUNC);
+#else
+	C_NATIVE_EXIT(env, that, memmove2D__JIJIIIII_FUNC);
+#endif
+	return rc;
+}
+#endif
+
+#if (!defined(NO_memmove2D__II_3BIIIII) && !defined(JNI64)) || (!defined(NO_memmove2D__JI_3BIIIII) && defined(JNI64))
+#ifndef JNI64
+JNIEXPORT jboolean JNICALL C_NATIVE(memmove2D__II_3BIIIII)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jbyteArray arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7)
+#else
+JNIEXPORT jboolean JNICALL C_NATIVE(memmove2D__JI_3BIIIII)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jbyteArray arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7)
+#endif
+{
+	jbyte *lparg2=NULL;
+	jboolean rc = 0;
+#ifndef JNI64
+	C_NATIVE_ENTER(env, that, memmove2D__II_3BIIIII_FUNC);
+#else
+	C_NATIVE_ENTER(env, that, memmove2D__JI_3BIIIII_FUNC);
+#endif
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (arg2) if ((lparg2 = (*env)->GetPrimitiveArrayCritical(env, arg2, NULL)) == NULL) goto fail;
+	} else
+#endif
+	{
+		if (arg2) if ((lparg2 = (*env)->GetByteArrayElements(env, arg2, NULL)) == NULL) goto fail;
+	}
+	rc = (jboolean)swtMemmove2D((void *)arg0, arg1, (const void *)lparg2, arg3, arg4, arg5, arg6, arg7);
+fail:
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (arg2 && lparg2) (*env)->ReleasePrimitiveArrayCritical(env, arg2, lparg2, JNI_ABORT);
+	} else
+#endif
+	{
+		if (arg2 && lparg2) (*env)->ReleaseByteArrayElements(env, arg2, lparg2, JNI_ABORT);
+	}
+#ifndef JNI64
+	C_NATIVE_EXIT(env, that, memmove2D__II_3BIIIII_FUNC);
+#else
+	C_NATIVE_EXIT(env, that, memmove2D__JI_3BIIIII_FUNC);
+#endif
+	return rc;
+}
+#endif
+
+#if (!defined(NO_memmove2D___3BIIIIIII) && !defined(JNI64)) || (!defined(NO_memmove2D___3BIJIIIII) && defined(JNI64))
+#ifndef JNI64
+JNIEXPORT jboolean JNICALL C_NATIVE(memmove2D___3BIIIIIII)(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jintLong arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7)
+#else
+JNIEXPORT jboolean JNICALL C_NATIVE(memmove2D___3BIJIIIII)(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jintLong arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7)
+#endif
+{
+	jbyte *lparg0=NULL;
+	jboolean rc = 0;
+#ifndef JNI64
+	C_NATIVE_ENTER(env, that, memmove2D___3BIIIIIII_FUNC);
+#else
+	C_NATIVE_ENTER(env, that, memmove2D___3BIJIIIII_FUNC);
+#endif
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (arg0) if ((lparg0 = (*env)->GetPrimitiveArrayCritical(env, arg0, NULL)) == NULL) goto fail;
+	} else
+#endif
+	{
+		if (arg0) if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) goto fail;
+	}
+	rc = (jboolean)swtMemmove2D((void *)lparg0, arg1, (const void *)arg2, arg3, arg4, arg5, arg6, arg7);
+fail:
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (arg0 && lparg0) (*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, 0);
+	} else
+#endif
+	{
+		if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	}
+#ifndef JNI64
+	C_NATIVE_EXIT(env, that, memmove2D___3BIIIIIII_FUNC);
+#else
+	C_NATIVE_EXIT(env, that, memmove2D___3BIJIIIII_FUNC);
+#endif
+	return rc;
+}
+#endif
+
 #ifndef NO_memset
 JNIEXPORT jintLong JNICALL C_NATIVE(memset)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
@@ -732,6 +839,58 @@ JNIEXPORT jintLong JNICALL C_NATIVE(memset)
 }
 #endif
 
+#ifndef NO_pool_1free
+JNIEXPORT void JNICALL C_NATIVE(pool_1free)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	C_NATIVE_ENTER(env, that, pool_1free_FUNC);
+	NATIVE_RESOURCE_DESTROY(env, arg0);
+	swtPoolFree((void *)arg0);
+	C_NATIVE_EXIT(env, that, pool_1free_FUNC);
+}
+#endif
+
+#ifndef NO_pool_1free_1all
+JNIEXPORT void JNICALL C_NATIVE(pool_1free_1all)
+	(JNIEnv *env, jclass that, jintLongArray arg0, jint arg1)
+{
+	jintLong *lparg0=NULL;
+	C_NATIVE_ENTER(env, that, pool_1free_1all_FUNC);
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (arg0) if ((lparg0 = (*env)->GetPrimitiveArrayCritical(env, arg0, NULL)) == NULL) goto fail;
+	} else
+#endif
+	{
+		if (arg0) if ((lparg0 = (*env)->GetIntLongArrayElements(env, arg0, NULL)) == NULL) goto fail;
+	}
+	swtPoolFreeAll((jintLong *)lparg0, arg1);
+fail:
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (arg0 && lparg0) (*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, JNI_ABORT);
+	} else
+#endif
+	{
+		if (arg0 && lparg0) (*env)->ReleaseIntLongArrayElements(env, arg0, lparg0, JNI_ABORT);
+	}
+	C_NATIVE_EXIT(env, that, pool_1free_1all_FUNC);
+}
+#endif
+
+#ifndef NO_pool_1malloc
+JNIEXPORT jintLong JNICALL C_NATIVE(pool_1malloc)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	jintLong rc = 0;
+	C_NATIVE_ENTER(env, that, pool_1malloc_FUNC);
+	rc = (jintLong)swtPoolAlloc((size_t)arg0);
+	NATIVE_RESOURCE_CREATE(env, "malloc", rc, arg0);
+	C_NATIVE_EXIT(env, that, pool_1malloc_FUNC);
+	return rc;
+}
+#endif
+
 #ifndef NO_strlen
 JNIEXPORT jint JNICALL C_NATIVE(strlen)
 	(JNIEnv *env, jclass that, jintLong arg0)
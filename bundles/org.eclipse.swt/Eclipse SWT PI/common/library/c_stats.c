@@ -103,13 +103,34 @@ char * C_nativeFunctionNames[] = {
 	"memmove___3SII",
 #else
 	"memmove___3SJJ",
+#endif
+#ifndef JNI64
+	"memmove2D__IIIIIIII",
+#else
+	"memmove2D__JIJIIIII",
+#endif
+#ifndef JNI64
+	"memmove2D__II_3BIIIII",
+#else
+	"memmove2D__JI_3BIIIII",
+#endif
+#ifndef JNI64
+	"memmove2D___3BIIIIIII",
+#else
+	"memmove2D___3BIJIIIII",
 #endif
 	"memset",
+	"pool_1free",
+	"pool_1free_1all",
+	"pool_1malloc",
 	"strlen",
 };
 #define NATIVE_FUNCTION_COUNT sizeof(C_nativeFunctionNames) / sizeof(char*)
 int C_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int C_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong C_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT C_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS C_nativeStats = {C_nativeFunctionCallCount, C_nativeFunctionCallTime, C_nativeFunctionEvents, 0, "C", C_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -131,4 +152,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(C_1GetFunctionCallCount)
 	return C_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(C_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return C_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(C_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(C_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &C_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(C_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(C_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(C_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(C_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(C_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
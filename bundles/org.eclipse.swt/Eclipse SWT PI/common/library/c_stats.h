@@ -13,8 +13,9 @@
 extern int C_nativeFunctionCount;
 extern int C_nativeFunctionCallCount[];
 extern char* C_nativeFunctionNames[];
-#define C_NATIVE_ENTER(env, that, func) C_nativeFunctionCallCount[func]++;
-#define C_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS C_nativeStats;
+#define C_NATIVE_ENTER(env, that, func) nativeStatsEnter(&C_nativeStats, func);
+#define C_NATIVE_EXIT(env, that, func) nativeStatsExit(&C_nativeStats, func);
 #else
 #ifndef C_NATIVE_ENTER
 #define C_NATIVE_ENTER(env, that, func) 
@@ -113,7 +114,25 @@ typedef enum {
 	memmove___3SII_FUNC,
 #else
 	memmove___3SJJ_FUNC,
+#endif
+#ifndef JNI64
+	memmove2D__IIIIIIII_FUNC,
+#else
+	memmove2D__JIJIIIII_FUNC,
+#endif
+#ifndef JNI64
+	memmove2D__II_3BIIIII_FUNC,
+#else
+	memmove2D__JI_3BIIIII_FUNC,
+#endif
+#ifndef JNI64
+	memmove2D___3BIIIIIII_FUNC,
+#else
+	memmove2D___3BIJIIIII_FUNC,
 #endif
 	memset_FUNC,
+	pool_1free_FUNC,
+	pool_1free_1all_FUNC,
+	pool_1malloc_FUNC,
 	strlen_FUNC,
 } C_FUNCS;
@@ -23,10 +23,19 @@ public class C extends Platform {
 
 	public static final int PTR_SIZEOF = PTR_sizeof ();
 
-/** @param ptr cast=(void *) */
+	/** The <code>memmove2D</code> flag that copies the rows bottom up */
+	public static final int MEMMOVE_FLIP = 1;
+	/** The <code>memmove2D</code> flag that rearranges the bytes of each pixel */
+	public static final int MEMMOVE_SWIZZLE = 2;
+
+/**
+ * @method flags=destroy
+ * @param ptr cast=(void *)
+ */
 public static final native void free (long /*int*/ ptr);
 /** @param env cast=(const char *) */
 public static final native long /*int*/ getenv (byte[] env);
+/** @method resource=malloc,size=arg0 */
 public static final native long /*int*/ malloc (long /*int*/ size);
 /**
  * @param dest cast=(void *)
@@ -130,12 +139,63 @@ public static final native void memmove (int[] dest, long /*int*/ src, long /*in
  * @param size cast=(size_t)
  */
 public static final native void memmove (long[] dest, long /*int*/ src, long /*int*/ size);
+/**
+ * Copies <code>rows</code> rows of <code>rowBytes</code> bytes from
+ * <code>src</code> to <code>dest</code>, each row starting
+ * <code>srcStride</code> and <code>destStride</code> bytes after the
+ * previous one.  With <code>MEMMOVE_FLIP</code> the source rows are taken
+ * bottom up.  With <code>MEMMOVE_SWIZZLE</code> the bytes of each 4 byte
+ * pixel are rearranged by <code>map</code>, in the format of
+ * <code>Blit.shuffle</code>, and the rows may not overlap.  Returns
+ * <code>false</code> if the arguments are not valid.
+ *
+ * @method accessor=swtMemmove2D
+ * @param dest cast=(void *)
+ * @param src cast=(const void *)
+ */
+public static final native boolean memmove2D (long /*int*/ dest, int destStride, long /*int*/ src, int srcStride, int rowBytes, int rows, int map, int flags);
+/**
+ * @method accessor=swtMemmove2D
+ * @param dest cast=(void *),flags=no_in critical
+ * @param src cast=(const void *)
+ */
+public static final native boolean memmove2D (byte[] dest, int destStride, long /*int*/ src, int srcStride, int rowBytes, int rows, int map, int flags);
+/**
+ * @method accessor=swtMemmove2D
+ * @param dest cast=(void *)
+ * @param src cast=(const void *),flags=no_out critical
+ */
+public static final native boolean memmove2D (long /*int*/ dest, int destStride, byte[] src, int srcStride, int rowBytes, int rows, int map, int flags);
 /**
  * @param buffer cast=(void *),flags=critical
  * @param num cast=(size_t)
  */
 public static final native long /*int*/ memset (long /*int*/ buffer, int c, long /*int*/ num);
 public static final native int PTR_sizeof ();
+/**
+ * Frees memory allocated with <code>pool_malloc</code>.
+ *
+ * @method flags=destroy,accessor=swtPoolFree
+ * @param ptr cast=(void *)
+ */
+public static final native void pool_free (long /*int*/ ptr);
+/**
+ * Frees the first <code>count</code> blocks of memory allocated with
+ * <code>pool_malloc</code>, skipping the <code>0</code> entries.
+ *
+ * @method accessor=swtPoolFreeAll
+ * @param ptrs cast=(jintLong *),flags=no_out critical
+ */
+public static final native void pool_free_all (long /*int*/[] ptrs, int count);
+/**
+ * Allocates memory from a pool of size classes cached per thread, for
+ * temporaries freed again soon with <code>pool_free</code>. The memory
+ * must not be freed with <code>free</code> or by the native libraries.
+ *
+ * @method accessor=swtPoolAlloc,resource=malloc,size=arg0
+ * @param size cast=(size_t)
+ */
+public static final native long /*int*/ pool_malloc (long /*int*/ size);
 /** @param s cast=(char *) */
 public static final native int strlen (long /*int*/ s);
 }
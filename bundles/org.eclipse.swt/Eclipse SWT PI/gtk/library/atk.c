@@ -385,7 +385,7 @@ JNIEXPORT jint JNICALL ATK_NATIVE(_1atk_1role_1register)
 	if (arg0) if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jint)atk_role_register((const gchar *)lparg0);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	ATK_NATIVE_EXIT(env, that, _1atk_1role_1register_FUNC);
 	return rc;
 }
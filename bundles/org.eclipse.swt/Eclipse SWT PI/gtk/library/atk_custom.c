@@ -19,3 +19,195 @@
 
 #define OS_NATIVE(func) Java_org_eclipse_swt_internal_accessibility_gtk_ATK_##func
 
+/*
+* Accessibility event queue.  State changes, property notifications and
+* signals whose last occurrence supersedes the earlier ones are queued per
+* object instead of being emitted at once.  A repeated event for the same
+* object replaces the queued one, keeping its place in the queue, and the
+* queue is emitted in order from an idle once the main loop has finished
+* dispatching the current events.  Screen readers then see one event for
+* each object and state after a bulk update of the tree instead of one per
+* change.
+*/
+#define QUEUE_STATE 0
+#define QUEUE_NOTIFY 1
+#define QUEUE_SIGNAL 2
+#define QUEUE_SIGNAL_INT 3
+#define QUEUE_BOUNDS 4
+
+typedef struct AtkQueuedEvent {
+	AtkObject *object;
+	jint kind;
+	jint key;
+	jint value;
+	AtkRectangle rect;
+} AtkQueuedEvent;
+
+static GHashTable *atkQueueTable = NULL;
+static GPtrArray *atkQueue = NULL;
+static guint atkQueueIdle = 0;
+
+static guint atkQueueHash(gconstpointer key) {
+	const AtkQueuedEvent *event = (const AtkQueuedEvent *)key;
+	return GPOINTER_TO_UINT(event->object) ^ (event->kind << 24) ^ event->key;
+}
+
+static gboolean atkQueueEqual(gconstpointer a, gconstpointer b) {
+	const AtkQueuedEvent *event1 = (const AtkQueuedEvent *)a, *event2 = (const AtkQueuedEvent *)b;
+	return event1->object == event2->object && event1->kind == event2->kind && event1->key == event2->key;
+}
+
+static void atkQueueEmit(void) {
+	GPtrArray *queue = atkQueue;
+	guint i;
+	if (queue == NULL || queue->len == 0) return;
+	/* Emitting may queue more events, which go to a new queue */
+	atkQueue = NULL;
+	g_hash_table_destroy(atkQueueTable);
+	atkQueueTable = NULL;
+	for (i = 0; i < queue->len; i++) {
+		AtkQueuedEvent *event = (AtkQueuedEvent *)g_ptr_array_index(queue, i);
+		const gchar *name = event->kind == QUEUE_STATE ? NULL : g_quark_to_string((GQuark)event->key);
+		switch (event->kind) {
+			case QUEUE_STATE:
+				atk_object_notify_state_change(event->object, (AtkState)event->key, event->value != 0);
+				break;
+			case QUEUE_NOTIFY:
+				g_object_notify(G_OBJECT(event->object), name);
+				break;
+			case QUEUE_SIGNAL:
+				g_signal_emit_by_name(event->object, name);
+				break;
+			case QUEUE_SIGNAL_INT:
+				g_signal_emit_by_name(event->object, name, event->value);
+				break;
+			case QUEUE_BOUNDS:
+				g_signal_emit_by_name(event->object, name, &event->rect);
+				break;
+		}
+		g_object_unref(event->object);
+		g_free(event);
+	}
+	g_ptr_array_free(queue, TRUE);
+}
+
+static gboolean atkQueueIdleProc(gpointer data) {
+	atkQueueIdle = 0;
+	atkQueueEmit();
+	return FALSE;
+}
+
+static AtkQueuedEvent *atkQueueAdd(AtkObject *object, jint kind, jint key) {
+	AtkQueuedEvent lookup, *event;
+	if (atkQueueTable == NULL) atkQueueTable = g_hash_table_new(atkQueueHash, atkQueueEqual);
+	if (atkQueue == NULL) atkQueue = g_ptr_array_new();
+	lookup.object = object;
+	lookup.kind = kind;
+	lookup.key = key;
+	event = (AtkQueuedEvent *)g_hash_table_lookup(atkQueueTable, &lookup);
+	if (event == NULL) {
+		event = g_new0(AtkQueuedEvent, 1);
+		event->object = g_object_ref(object);
+		event->kind = kind;
+		event->key = key;
+		g_hash_table_insert(atkQueueTable, event, event);
+		g_ptr_array_add(atkQueue, event);
+	}
+	if (atkQueueIdle == 0) atkQueueIdle = g_idle_add(atkQueueIdleProc, NULL);
+	return event;
+}
+
+static jint atkQueueName(JNIEnv *env, jbyteArray name) {
+	jint quark = 0;
+	jbyte *lpname = NULL;
+	if (name == NULL) return 0;
+	if ((lpname = (*env)->GetByteArrayElements(env, name, NULL)) == NULL) return 0;
+	quark = (jint)g_quark_from_string((const gchar *)lpname);
+	(*env)->ReleaseByteArrayElements(env, name, lpname, JNI_ABORT);
+	return quark;
+}
+
+#ifndef NO__1atk_1event_1queue_1bounds
+JNIEXPORT void JNICALL OS_NATIVE(_1atk_1event_1queue_1bounds)
+	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jint arg3, jint arg4, jint arg5)
+{
+	jint quark;
+	AtkQueuedEvent *event;
+	ATK_NATIVE_ENTER(env, that, _1atk_1event_1queue_1bounds_FUNC);
+	quark = atkQueueName(env, arg1);
+	if (quark != 0) {
+		event = atkQueueAdd((AtkObject *)arg0, QUEUE_BOUNDS, quark);
+		event->rect.x = arg2;
+		event->rect.y = arg3;
+		event->rect.width = arg4;
+		event->rect.height = arg5;
+	}
+	ATK_NATIVE_EXIT(env, that, _1atk_1event_1queue_1bounds_FUNC);
+}
+#endif
+
+#ifndef NO__1atk_1event_1queue_1flush
+JNIEXPORT void JNICALL OS_NATIVE(_1atk_1event_1queue_1flush)
+	(JNIEnv *env, jclass that)
+{
+	ATK_NATIVE_ENTER(env, that, _1atk_1event_1queue_1flush_FUNC);
+	if (atkQueueIdle != 0) {
+		g_source_remove(atkQueueIdle);
+		atkQueueIdle = 0;
+	}
+	atkQueueEmit();
+	ATK_NATIVE_EXIT(env, that, _1atk_1event_1queue_1flush_FUNC);
+}
+#endif
+
+#ifndef NO__1atk_1event_1queue_1notify
+JNIEXPORT void JNICALL OS_NATIVE(_1atk_1event_1queue_1notify)
+	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1)
+{
+	jint quark;
+	ATK_NATIVE_ENTER(env, that, _1atk_1event_1queue_1notify_FUNC);
+	quark = atkQueueName(env, arg1);
+	if (quark != 0) atkQueueAdd((AtkObject *)arg0, QUEUE_NOTIFY, quark);
+	ATK_NATIVE_EXIT(env, that, _1atk_1event_1queue_1notify_FUNC);
+}
+#endif
+
+#ifndef NO__1atk_1event_1queue_1signal
+JNIEXPORT void JNICALL OS_NATIVE(_1atk_1event_1queue_1signal)
+	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1)
+{
+	jint quark;
+	ATK_NATIVE_ENTER(env, that, _1atk_1event_1queue_1signal_FUNC);
+	quark = atkQueueName(env, arg1);
+	if (quark != 0) atkQueueAdd((AtkObject *)arg0, QUEUE_SIGNAL, quark);
+	ATK_NATIVE_EXIT(env, that, _1atk_1event_1queue_1signal_FUNC);
+}
+#endif
+
+#ifndef NO__1atk_1event_1queue_1signal_1int
+JNIEXPORT void JNICALL OS_NATIVE(_1atk_1event_1queue_1signal_1int)
+	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2)
+{
+	jint quark;
+	AtkQueuedEvent *event;
+	ATK_NATIVE_ENTER(env, that, _1atk_1event_1queue_1signal_1int_FUNC);
+	quark = atkQueueName(env, arg1);
+	if (quark != 0) {
+		event = atkQueueAdd((AtkObject *)arg0, QUEUE_SIGNAL_INT, quark);
+		event->value = arg2;
+	}
+	ATK_NATIVE_EXIT(env, that, _1atk_1event_1queue_1signal_1int_FUNC);
+}
+#endif
+
+#ifndef NO__1atk_1event_1queue_1state
+JNIEXPORT void JNICALL OS_NATIVE(_1atk_1event_1queue_1state)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jboolean arg2)
+{
+	AtkQueuedEvent *event;
+	ATK_NATIVE_ENTER(env, that, _1atk_1event_1queue_1state_FUNC);
+	event = atkQueueAdd((AtkObject *)arg0, QUEUE_STATE, arg1);
+	event->value = arg2;
+	ATK_NATIVE_EXIT(env, that, _1atk_1event_1queue_1state_FUNC);
+}
+#endif
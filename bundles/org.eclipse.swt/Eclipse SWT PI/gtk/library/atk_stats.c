@@ -43,6 +43,12 @@ char * ATK_nativeFunctionNames[] = {
 	"_1ATK_1TABLE_1GET_1IFACE",
 	"_1ATK_1TEXT_1GET_1IFACE",
 	"_1ATK_1VALUE_1GET_1IFACE",
+	"_1atk_1event_1queue_1bounds",
+	"_1atk_1event_1queue_1flush",
+	"_1atk_1event_1queue_1notify",
+	"_1atk_1event_1queue_1signal",
+	"_1atk_1event_1queue_1signal_1int",
+	"_1atk_1event_1queue_1state",
 	"_1atk_1get_1default_1registry",
 	"_1atk_1object_1factory_1get_1accessible_1type",
 	"_1atk_1object_1initialize",
@@ -213,6 +219,9 @@ char * ATK_nativeFunctionNames[] = {
 #define NATIVE_FUNCTION_COUNT sizeof(ATK_nativeFunctionNames) / sizeof(char*)
 int ATK_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int ATK_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong ATK_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT ATK_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS ATK_nativeStats = {ATK_nativeFunctionCallCount, ATK_nativeFunctionCallTime, ATK_nativeFunctionEvents, 0, "ATK", ATK_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -234,4 +243,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(ATK_1GetFunctionCallCount)
 	return ATK_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(ATK_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return ATK_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(ATK_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(ATK_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &ATK_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(ATK_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(ATK_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(ATK_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(ATK_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(ATK_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
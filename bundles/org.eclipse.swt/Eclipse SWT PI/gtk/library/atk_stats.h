@@ -17,8 +17,9 @@
 extern int ATK_nativeFunctionCount;
 extern int ATK_nativeFunctionCallCount[];
 extern char* ATK_nativeFunctionNames[];
-#define ATK_NATIVE_ENTER(env, that, func) ATK_nativeFunctionCallCount[func]++;
-#define ATK_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS ATK_nativeStats;
+#define ATK_NATIVE_ENTER(env, that, func) nativeStatsEnter(&ATK_nativeStats, func);
+#define ATK_NATIVE_EXIT(env, that, func) nativeStatsExit(&ATK_nativeStats, func);
 #else
 #ifndef ATK_NATIVE_ENTER
 #define ATK_NATIVE_ENTER(env, that, func) 
@@ -53,6 +54,12 @@ typedef enum {
 	_1ATK_1TABLE_1GET_1IFACE_FUNC,
 	_1ATK_1TEXT_1GET_1IFACE_FUNC,
 	_1ATK_1VALUE_1GET_1IFACE_FUNC,
+	_1atk_1event_1queue_1bounds_FUNC,
+	_1atk_1event_1queue_1flush_FUNC,
+	_1atk_1event_1queue_1notify_FUNC,
+	_1atk_1event_1queue_1signal_FUNC,
+	_1atk_1event_1queue_1signal_1int_FUNC,
+	_1atk_1event_1queue_1state_FUNC,
 	_1atk_1get_1default_1registry_FUNC,
 	_1atk_1object_1factory_1get_1accessible_1type_FUNC,
 	_1atk_1object_1initialize_FUNC,
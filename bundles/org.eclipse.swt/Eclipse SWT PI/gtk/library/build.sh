@@ -475,6 +475,14 @@ else
 	fi
 fi
 
+if [ x`pkg-config --exists libjpeg && echo YES` = "xYES" ]; then
+	echo "libjpeg found, compiling SWT support for native JPEG decoding."
+	MAKE_JPEG=make_jpeg
+else
+	echo "libjpeg not found:"
+	echo "    *** JPEG images will be decoded in Java."
+fi
+
 if [ x`pkg-config --exists cairo && echo YES` = "xYES" ]; then
 	echo "Cairo found, compiling SWT support for the cairo graphics library."
 	MAKE_CAIRO=make_cairo
@@ -536,5 +544,5 @@ fi
 if [ "x${1}" = "xclean" ]; then
 	${MAKE_TYPE} -f $MAKEFILE clean
 else
-	${MAKE_TYPE} -f $MAKEFILE all $MAKE_GNOME $MAKE_CAIRO $MAKE_AWT $MAKE_MOZILLA ${1} ${2} ${3} ${4} ${5} ${6} ${7} ${8} ${9}
+	${MAKE_TYPE} -f $MAKEFILE all $MAKE_GNOME $MAKE_CAIRO $MAKE_JPEG $MAKE_AWT $MAKE_MOZILLA ${1} ${2} ${3} ${4} ${5} ${6} ${7} ${8} ${9}
 fi
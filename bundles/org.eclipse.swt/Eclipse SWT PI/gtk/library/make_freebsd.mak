@@ -79,11 +79,11 @@ MOZILLACFLAGS = -O \
 	${SWT_PTR_CFLAGS}
 MOZILLALFLAGS = -shared -Wl,--version-script=mozilla_exports -Bsymbolic
 	
-SWT_OBJECTS = swt.o c.o c_stats.o callback.o
+SWT_OBJECTS = swt.o c.o c_stats.o callback.o blit.o transcode.o pngfilter.o lzw.o tiff.o benchmark.o watchdog.o arena.o pool.o
 CDE_OBJECTS = swt.o cde.o cde_structs.o cde_stats.o
 AWT_OBJECTS = swt_awt.o
 SWTPI_OBJECTS = swt.o os.o os_structs.o os_custom.o os_stats.o
-CAIRO_OBJECTS = swt.o cairo.o cairo_structs.o cairo_stats.o
+CAIRO_OBJECTS = swt.o cairo.o cairo_structs.o cairo_custom.o cairo_stats.o
 ATK_OBJECTS = swt.o atk.o atk_structs.o atk_custom.o atk_stats.o
 GNOME_OBJECTS = swt.o gnome.o gnome_structs.o gnome_stats.o
 MOZILLA_OBJECTS = swt.o xpcom.o xpcom_custom.o xpcom_structs.o xpcom_stats.o
@@ -125,6 +125,24 @@ $(SWTPI_LIB): $(SWTPI_OBJECTS)
 
 swt.o: swt.c swt.h
 	$(CC) $(CFLAGS) -c swt.c
+blit.o: blit.c swt.h
+	$(CC) $(CFLAGS) -c blit.c
+transcode.o: transcode.c swt.h
+	$(CC) $(CFLAGS) -c transcode.c
+pngfilter.o: pngfilter.c swt.h
+	$(CC) $(CFLAGS) -c pngfilter.c
+lzw.o: lzw.c swt.h
+	$(CC) $(CFLAGS) -c lzw.c
+tiff.o: tiff.c swt.h
+	$(CC) $(CFLAGS) -c tiff.c
+benchmark.o: benchmark.c swt.h
+	$(CC) $(CFLAGS) -c benchmark.c
+watchdog.o: watchdog.c swt.h
+	$(CC) $(CFLAGS) -c watchdog.c
+arena.o: arena.c swt.h
+	$(CC) $(CFLAGS) -c arena.c
+pool.o: pool.c swt.h
+	$(CC) $(CFLAGS) -c pool.c
 os.o: os.c os.h swt.h os_custom.h
 	$(CC) $(CFLAGS) $(GTKCFLAGS) -c os.c
 os_structs.o: os_structs.c os_structs.h os.h swt.h
@@ -144,6 +162,8 @@ $(CAIRO_LIB): $(CAIRO_OBJECTS)
 
 cairo.o: cairo.c cairo.h swt.h
 	$(CC) $(CFLAGS) $(CAIROCFLAGS) -c cairo.c
+cairo_custom.o: cairo_custom.c cairo_structs.h cairo.h swt.h
+	$(CC) $(CFLAGS) $(CAIROCFLAGS) -c cairo_custom.c
 cairo_structs.o: cairo_structs.c cairo_structs.h cairo.h swt.h
 	$(CC) $(CFLAGS) $(CAIROCFLAGS) -c cairo_structs.c
 cairo_stats.o: cairo_stats.c cairo_structs.h cairo.h cairo_stats.h swt.h
@@ -35,6 +35,7 @@ XULRUNNER24_PREFIX = swt-xulrunner24
 XPCOMINIT_PREFIX = swt-xpcominit
 WEBKIT_PREFIX = swt-webkit
 GLX_PREFIX = swt-glx
+JPEG_PREFIX = swt-jpeg
 
 SWT_LIB = lib$(SWT_PREFIX)-$(WS_PREFIX)-$(SWT_VERSION).so
 CDE_LIB = lib$(CDE_PREFIX)-$(WS_PREFIX)-$(SWT_VERSION).so
@@ -49,6 +50,7 @@ XULRUNNER24_LIB = lib$(XULRUNNER24_PREFIX)-$(WS_PREFIX)-$(SWT_VERSION).so
 XPCOMINIT_LIB = lib$(XPCOMINIT_PREFIX)-$(WS_PREFIX)-$(SWT_VERSION).so
 WEBKIT_LIB = lib$(WEBKIT_PREFIX)-$(WS_PREFIX)-$(SWT_VERSION).so
 GLX_LIB = lib$(GLX_PREFIX)-$(WS_PREFIX)-$(SWT_VERSION).so
+JPEG_LIB = lib$(JPEG_PREFIX)-$(WS_PREFIX)-$(SWT_VERSION).so
 
 CAIROCFLAGS = `pkg-config --cflags cairo`
 CAIROLIBS = `pkg-config --libs-only-L cairo` -lcairo
@@ -74,6 +76,9 @@ GNOMELIBS = `pkg-config --libs-only-L gnome-vfs-module-2.0 libgnome-2.0 libgnome
 
 GLXLIBS = -lGL -lGLU -lm
 
+JPEGCFLAGS = `pkg-config --cflags libjpeg`
+JPEGLIBS = `pkg-config --libs-only-L libjpeg` -ljpeg
+
 # Uncomment for Native Stats tool
 #NATIVE_STATS = -DNATIVE_STATS
 
@@ -104,19 +109,20 @@ XULRUNNEREXCLUDES = -DNO__1NS_1InitXPCOM2
 
 WEBKITCFLAGS = `pkg-config --cflags glib-2.0`
 
-SWT_OBJECTS = swt.o c.o c_stats.o callback.o
+SWT_OBJECTS = swt.o c.o c_stats.o callback.o blit.o transcode.o pngfilter.o lzw.o tiff.o benchmark.o watchdog.o arena.o pool.o
 CDE_OBJECTS = swt.o cde.o cde_structs.o cde_stats.o
 AWT_OBJECTS = swt_awt.o
 SWTPI_OBJECTS = swt.o os.o os_structs.o os_custom.o os_stats.o
-CAIRO_OBJECTS = swt.o cairo.o cairo_structs.o cairo_stats.o
+CAIRO_OBJECTS = swt.o cairo.o cairo_structs.o cairo_custom.o cairo_stats.o
 ATK_OBJECTS = swt.o atk.o atk_structs.o atk_custom.o atk_stats.o
 GNOME_OBJECTS = swt.o gnome.o gnome_structs.o gnome_stats.o
 MOZILLA_OBJECTS = swt.o xpcom.o xpcom_custom.o xpcom_structs.o xpcom_stats.o
 XULRUNNER_OBJECTS = swt.o xpcomxul.o xpcomxul_custom.o xpcomxul_structs.o xpcomxul_stats.o
 XULRUNNER24_OBJECTS = swt.o xpcom24_custom.o
 XPCOMINIT_OBJECTS = swt.o xpcominit.o xpcominit_structs.o xpcominit_stats.o
-WEBKIT_OBJECTS = swt.o webkit.o webkit_structs.o webkit_stats.o
+WEBKIT_OBJECTS = swt.o webkit.o webkit_structs.o webkit_custom.o webkit_stats.o
 GLX_OBJECTS = swt.o glx.o glx_structs.o glx_stats.o
+JPEG_OBJECTS = swt.o jpeg.o
 
 CFLAGS = -O -Wall \
 		-DSWT_VERSION=$(SWT_VERSION) \
@@ -152,6 +158,24 @@ $(SWTPI_LIB): $(SWTPI_OBJECTS)
 
 swt.o: swt.c swt.h
 	$(CC) $(CFLAGS) -c swt.c
+blit.o: blit.c swt.h
+	$(CC) $(CFLAGS) -c blit.c
+transcode.o: transcode.c swt.h
+	$(CC) $(CFLAGS) -c transcode.c
+pngfilter.o: pngfilter.c swt.h
+	$(CC) $(CFLAGS) -c pngfilter.c
+lzw.o: lzw.c swt.h
+	$(CC) $(CFLAGS) -c lzw.c
+tiff.o: tiff.c swt.h
+	$(CC) $(CFLAGS) -c tiff.c
+benchmark.o: benchmark.c swt.h
+	$(CC) $(CFLAGS) -c benchmark.c
+watchdog.o: watchdog.c swt.h
+	$(CC) $(CFLAGS) -c watchdog.c
+arena.o: arena.c swt.h
+	$(CC) $(CFLAGS) -c arena.c
+pool.o: pool.c swt.h
+	$(CC) $(CFLAGS) -c pool.c
 os.o: os.c os.h swt.h os_custom.h
 	$(CC) $(CFLAGS) $(GTKCFLAGS) -c os.c
 os_structs.o: os_structs.c os_structs.h os.h swt.h
@@ -171,6 +195,8 @@ $(CAIRO_LIB): $(CAIRO_OBJECTS)
 
 cairo.o: cairo.c cairo.h swt.h
 	$(CC) $(CFLAGS) $(CAIROCFLAGS) -c cairo.c
+cairo_custom.o: cairo_custom.c cairo_structs.h cairo.h swt.h
+	$(CC) $(CFLAGS) $(CAIROCFLAGS) -c cairo_custom.c
 cairo_structs.o: cairo_structs.c cairo_structs.h cairo.h swt.h
 	$(CC) $(CFLAGS) $(CAIROCFLAGS) -c cairo_structs.c
 cairo_stats.o: cairo_stats.c cairo_structs.h cairo.h cairo_stats.h swt.h
@@ -308,6 +334,9 @@ webkit.o: webkitgtk.c
 
 webkit_structs.o: webkitgtk_structs.c 
 	$(CC) $(CFLAGS) $(WEBKITCFLAGS) -c webkitgtk_structs.c -o webkit_structs.o
+
+webkit_custom.o: webkitgtk_custom.c webkitgtk_structs.h webkitgtk.h swt.h
+	$(CC) $(CFLAGS) $(WEBKITCFLAGS) -c webkitgtk_custom.c -o webkit_custom.o
 	
 webkit_stats.o: webkitgtk_stats.c webkitgtk_stats.h
 	$(CC) $(CFLAGS) $(WEBKITCFLAGS) -c webkitgtk_stats.c -o webkit_stats.o
@@ -329,6 +358,17 @@ glx_structs.o: glx_structs.c
 glx_stats.o: glx_stats.c glx_stats.h
 	$(CC) $(CFLAGS) $(GLXCFLAGS) -c glx_stats.c
 
+#
+# JPEG lib
+#
+make_jpeg: $(JPEG_LIB)
+
+$(JPEG_LIB): $(JPEG_OBJECTS)
+	$(CC) $(LFLAGS) -o $(JPEG_LIB) $(JPEG_OBJECTS) $(JPEGLIBS)
+
+jpeg.o: jpeg.c swt.h
+	$(CC) $(CFLAGS) $(JPEGCFLAGS) -c jpeg.c
+
 #
 # Install
 #
@@ -68,6 +68,132 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(GDK_1WINDOWING_1X11)
 }
 #endif
 
+#ifndef NO_NewDirectByteBuffer
+JNIEXPORT jobject JNICALL OS_NATIVE(NewDirectByteBuffer)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
+{
+	jobject rc = NULL;
+	OS_NATIVE_ENTER(env, that, NewDirectByteBuffer_FUNC)
+	if (arg0 != 0 && arg1 >= 0) rc = (*env)->NewDirectByteBuffer(env, (void *)arg0, arg1);
+	OS_NATIVE_EXIT(env, that, NewDirectByteBuffer_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_cacheStructFields
+JNIEXPORT void JNICALL OS_NATIVE(cacheStructFields)
+	(JNIEnv *env, jclass that)
+{
+	OS_NATIVE_ENTER(env, that, cacheStructFields_FUNC)
+	cacheOSStructFields(env);
+	OS_NATIVE_EXIT(env, that, cacheStructFields_FUNC)
+}
+#endif
+
+#ifndef NO_decodeEvent
+/*
+* The slots of the buffer filled by decodeEvent(), which match the DECODE_*
+* byte offsets in OS.java.  Coordinates are stored as doubles, everything
+* else as longs.  Slots that do not apply to the event type are zero.
+*/
+#define DECODE_TYPE 0
+#define DECODE_WINDOW 1
+#define DECODE_SEND_EVENT 2
+#define DECODE_TIME 3
+#define DECODE_STATE 4
+#define DECODE_X 5
+#define DECODE_Y 6
+#define DECODE_X_ROOT 7
+#define DECODE_Y_ROOT 8
+#define DECODE_DETAIL 9
+#define DECODE_KEYCODE 10
+#define DECODE_GROUP 11
+#define DECODE_SIZE 12
+
+static void decodeCoordinates(jlong *slots, gdouble x, gdouble y, gdouble x_root, gdouble y_root)
+{
+	*(jdouble *)&slots[DECODE_X] = x;
+	*(jdouble *)&slots[DECODE_Y] = y;
+	*(jdouble *)&slots[DECODE_X_ROOT] = x_root;
+	*(jdouble *)&slots[DECODE_Y_ROOT] = y_root;
+}
+
+JNIEXPORT jboolean JNICALL OS_NATIVE(decodeEvent)
+	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
+{
+	GdkEvent *event = (GdkEvent *)arg0;
+	jlong *slots = NULL;
+	jboolean rc = 0;
+	OS_NATIVE_ENTER(env, that, decodeEvent_FUNC)
+	if (arg1 == NULL) goto fail;
+	if ((*env)->GetDirectBufferCapacity(env, arg1) < DECODE_SIZE * (jlong)sizeof(jlong)) goto fail;
+	if ((slots = (*env)->GetDirectBufferAddress(env, arg1)) == NULL) goto fail;
+	memset(slots, 0, DECODE_SIZE * sizeof(jlong));
+	if (arg0 == 0) goto fail;
+	slots[DECODE_TYPE] = (jlong)event->type;
+	slots[DECODE_WINDOW] = (jlong)(jintLong)event->any.window;
+	slots[DECODE_SEND_EVENT] = (jlong)event->any.send_event;
+	switch (event->type) {
+		case GDK_BUTTON_PRESS:
+		case GDK_2BUTTON_PRESS:
+		case GDK_3BUTTON_PRESS:
+		case GDK_BUTTON_RELEASE: {
+			GdkEventButton *button = &event->button;
+			slots[DECODE_TIME] = (jlong)button->time;
+			slots[DECODE_STATE] = (jlong)button->state;
+			decodeCoordinates(slots, button->x, button->y, button->x_root, button->y_root);
+			slots[DECODE_DETAIL] = (jlong)button->button;
+			break;
+		}
+		case GDK_MOTION_NOTIFY: {
+			GdkEventMotion *motion = &event->motion;
+			slots[DECODE_TIME] = (jlong)motion->time;
+			slots[DECODE_STATE] = (jlong)motion->state;
+			decodeCoordinates(slots, motion->x, motion->y, motion->x_root, motion->y_root);
+			slots[DECODE_DETAIL] = (jlong)motion->is_hint;
+			break;
+		}
+		case GDK_SCROLL: {
+			GdkEventScroll *scroll = &event->scroll;
+			slots[DECODE_TIME] = (jlong)scroll->time;
+			slots[DECODE_STATE] = (jlong)scroll->state;
+			decodeCoordinates(slots, scroll->x, scroll->y, scroll->x_root, scroll->y_root);
+			slots[DECODE_DETAIL] = (jlong)scroll->direction;
+			break;
+		}
+		case GDK_ENTER_NOTIFY:
+		case GDK_LEAVE_NOTIFY: {
+			GdkEventCrossing *crossing = &event->crossing;
+			slots[DECODE_TIME] = (jlong)crossing->time;
+			slots[DECODE_STATE] = (jlong)crossing->state;
+			decodeCoordinates(slots, crossing->x, crossing->y, crossing->x_root, crossing->y_root);
+			slots[DECODE_DETAIL] = (jlong)crossing->detail;
+			slots[DECODE_KEYCODE] = (jlong)crossing->mode;
+			break;
+		}
+		case GDK_KEY_PRESS:
+		case GDK_KEY_RELEASE: {
+			GdkEventKey *key = &event->key;
+			slots[DECODE_TIME] = (jlong)key->time;
+			slots[DECODE_STATE] = (jlong)key->state;
+			slots[DECODE_DETAIL] = (jlong)key->keyval;
+			slots[DECODE_KEYCODE] = (jlong)key->hardware_keycode;
+			slots[DECODE_GROUP] = (jlong)key->group;
+			break;
+		}
+		case GDK_FOCUS_CHANGE:
+			slots[DECODE_DETAIL] = (jlong)event->focus_change.in;
+			break;
+		default:
+			break;
+	}
+	rc = 1;
+fail:
+	OS_NATIVE_EXIT(env, that, decodeEvent_FUNC)
+	return rc;
+}
+#endif
+
 #ifndef NO_imContextNewProc_1CALLBACK
 static jintLong superIMContextNewProc;
 static GtkIMContext* lastIMContext;
@@ -253,6 +379,129 @@ glong g_utf8_offset_to_utf16_offset(const gchar* str, glong offset) {
 	return r;
 }
 
+static GdkEventFunc swt_event_func;
+
+/*
+* Returns TRUE if the next queued event supersedes the event.  The
+* configuration of a window only matters in its latest state, so a run
+* of configure events on the same window is reduced to its last event.
+* Pointer motion is left alone, since listeners such as drawing tools
+* need every point.  Exposures need no handling here because GDK
+* already merges them into the update region of the window.
+*/
+static gboolean swt_event_is_redundant (GdkEvent *event) {
+	GdkEvent *next;
+	gboolean redundant;
+	if (event->type != GDK_CONFIGURE) return FALSE;
+	next = gdk_event_peek ();
+	if (!next) return FALSE;
+	redundant = next->type == GDK_CONFIGURE && next->any.window == event->any.window;
+	gdk_event_free (next);
+	return redundant;
+}
+
+static void swt_event_compress (GdkEvent *event, gpointer data) {
+	if (swt_event_is_redundant (event)) return;
+	swt_event_func (event, data);
+}
+
+/*
+* Sets the GDK event handler, dropping the events that are superseded
+* by the next queued event before they reach func.
+*/
+void swt_event_handler_set (GdkEventFunc func, gpointer data, GDestroyNotify notify) {
+	swt_event_func = func;
+	gdk_event_handler_set (func ? swt_event_compress : NULL, data, notify);
+}
+
+/*
+* Display shares one closure for each signal between all the widgets
+* connected to it, a C closure on a window proc with the index of the
+* signal as data. For the few signals that can be muted or held, the
+* closure is made here instead. Its meta marshal first checks whether the
+* instance muted the signal with swt_closure_mute(), so that a signal SWT
+* handles only for a listener does not call into Java without one. The
+* meta marshal keeps GLib from using its va_list marshaller, so the other
+* signals do not get one. The muted signals are kept in a bit set on the
+* instance, which is freed with it.  The word after the bit set counts the
+* swt_closure_hold() calls in progress on the instance, during which every
+* signal that goes to one of these closures is skipped.
+*/
+#define SWT_CLOSURE_IDS 128
+#define SWT_CLOSURE_HOLD (SWT_CLOSURE_IDS / 32)
+
+static gboolean swt_closure_muting = TRUE;
+
+static GQuark swt_closure_quark (void) {
+	static GQuark quark = 0;
+	if (quark == 0) quark = g_quark_from_static_string ("swt-closure-muted");
+	return quark;
+}
+
+static void swt_closure_meta_marshal (GClosure *closure, GValue *return_value, guint n_param_values, const GValue *param_values, gpointer invocation_hint, gpointer marshal_data) {
+	gint id = GPOINTER_TO_INT (marshal_data);
+	if (n_param_values > 0 && G_VALUE_HOLDS_OBJECT (&param_values [0])) {
+		GObject *instance = g_value_get_object (&param_values [0]);
+		guint32 *muted = instance != NULL ? g_object_get_qdata (instance, swt_closure_quark ()) : NULL;
+		if (muted != NULL) {
+			if (muted [SWT_CLOSURE_HOLD] != 0) return;
+			if (swt_closure_muting && (muted [id / 32] & (1u << (id % 32))) != 0) return;
+		}
+	}
+	closure->marshal (closure, return_value, n_param_values, param_values, invocation_hint, NULL);
+}
+
+GClosure *swt_closure_new (GCallback callback, gint id) {
+	GClosure *closure = g_cclosure_new (callback, GINT_TO_POINTER (id), NULL);
+	if (id >= 0 && id < SWT_CLOSURE_IDS) {
+		g_closure_set_meta_marshal (closure, GINT_TO_POINTER (id), swt_closure_meta_marshal);
+	}
+	return closure;
+}
+
+static guint32 *swt_closure_get_muted (GObject *instance) {
+	guint32 *muted = g_object_get_qdata (instance, swt_closure_quark ());
+	if (muted == NULL) {
+		muted = g_new0 (guint32, SWT_CLOSURE_HOLD + 1);
+		g_object_set_qdata_full (instance, swt_closure_quark (), muted, g_free);
+	}
+	return muted;
+}
+
+void swt_closure_mute (GObject *instance, gint id, gboolean mute) {
+	guint32 *muted;
+	if (instance == NULL || id < 0 || id >= SWT_CLOSURE_IDS) return;
+	if (!mute && g_object_get_qdata (instance, swt_closure_quark ()) == NULL) return;
+	muted = swt_closure_get_muted (instance);
+	if (mute) {
+		muted [id / 32] |= 1u << (id % 32);
+	} else {
+		muted [id / 32] &= ~(1u << (id % 32));
+	}
+}
+
+/*
+* Skips every signal of the instance that goes to a closure made by
+* swt_closure_new() until the matching call with hold FALSE, whether
+* muting is on or not.  It replaces blocking the handlers one signal
+* at a time, which scans the handler list of the instance each time.
+*/
+void swt_closure_hold (GObject *instance, gboolean hold) {
+	guint32 *muted;
+	if (instance == NULL) return;
+	muted = swt_closure_get_muted (instance);
+	if (hold) {
+		muted [SWT_CLOSURE_HOLD]++;
+	} else if (muted [SWT_CLOSURE_HOLD] > 0) {
+		muted [SWT_CLOSURE_HOLD]--;
+	}
+}
+
+/* While muting is off, as when a display filter needs every signal, nothing is muted */
+void swt_closure_set_muting (gboolean muting) {
+	swt_closure_muting = muting;
+}
+
 #ifndef NO_SwtFixed
 
 struct _SwtFixedPrivate {
@@ -637,3 +886,863 @@ static void swt_fixed_forall (GtkContainer *container, gboolean include_internal
 }
 
 #endif
+
+/*
+* Stores the byte index, byte length, logical extents and baseline of the
+* first count lines of the layout in one walk, SWT_PANGO_LINE_SIZE ints
+* per line, and returns the number of lines stored.
+*/
+gint swt_pango_layout_get_lines (PangoLayout *layout, gint *lines, gint count) {
+	PangoLayoutIter *iter;
+	PangoRectangle rect;
+	gint i = 0;
+	if (!lines || count <= 0) return 0;
+	iter = pango_layout_get_iter (layout);
+	if (!iter) return 0;
+	do {
+		PangoLayoutLine *line = pango_layout_iter_get_line (iter);
+		gint *entry = lines + i * SWT_PANGO_LINE_SIZE;
+		pango_layout_iter_get_line_extents (iter, NULL, &rect);
+		entry [0] = line->start_index;
+		entry [1] = line->length;
+		entry [2] = rect.x;
+		entry [3] = rect.y;
+		entry [4] = rect.width;
+		entry [5] = rect.height;
+		entry [6] = pango_layout_iter_get_baseline (iter);
+		i++;
+	} while (i < count && pango_layout_iter_next_line (iter));
+	pango_layout_iter_free (iter);
+	return i;
+}
+
+#ifndef NO_SwtOffsetIndex
+
+/*
+* Converts between the character offsets of a GtkTextBuffer and UTF-16
+* offsets without walking the text.  The two only differ by the number
+* of characters outside the BMP before the offset, so the index keeps
+* the sorted character offsets of those characters and answers with a
+* binary search.  The signal handlers update the table as the buffer
+* is edited.  They use the index as their data so that the handlers
+* blocked by SWT do not match them.
+*/
+struct _SwtOffsetIndex {
+	GtkTextBuffer *buffer;
+	glong *offsets;
+	glong count, capacity;
+	glong deleteStart, deleteEnd;
+	gulong insertHandler, deleteHandler, deletedHandler;
+};
+
+/* Returns non zero if the byte starts a character outside the BMP */
+#define SWT_IS_SUPPLEMENTARY(ch) (0xf0 <= (guchar)(ch) && (guchar)(ch) <= 0xfd)
+
+/* Returns the index of the first entry that is not less than offset */
+static glong swt_offset_index_search (SwtOffsetIndex *index, glong offset) {
+	glong low = 0, high = index->count;
+	while (low < high) {
+		glong mid = (low + high) / 2;
+		if (index->offsets [mid] < offset) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+	return low;
+}
+
+/* Inserts the characters of text at the given character offset */
+static void swt_offset_index_insert (SwtOffsetIndex *index, glong offset, const gchar *text, gint len) {
+	const gchar *s, *end = text + len;
+	glong count = 0, chars = 0, i, first;
+	for (s = text; s < end; s = g_utf8_next_char (s)) {
+		if (SWT_IS_SUPPLEMENTARY (*s)) count++;
+		chars++;
+	}
+	first = swt_offset_index_search (index, offset);
+	for (i = first; i < index->count; i++) index->offsets [i] += chars;
+	if (count == 0) return;
+	if (index->count + count > index->capacity) {
+		index->capacity = MAX (index->capacity * 2, index->count + count);
+		index->offsets = g_renew (glong, index->offsets, index->capacity);
+	}
+	memmove (index->offsets + first + count, index->offsets + first, (index->count - first) * sizeof (glong));
+	index->count += count;
+	for (s = text, chars = offset; s < end; s = g_utf8_next_char (s), chars++) {
+		if (SWT_IS_SUPPLEMENTARY (*s)) index->offsets [first++] = chars;
+	}
+}
+
+/* Removes the characters from start to end */
+static void swt_offset_index_delete (SwtOffsetIndex *index, glong start, glong end) {
+	glong first = swt_offset_index_search (index, start);
+	glong last = swt_offset_index_search (index, end), i;
+	for (i = last; i < index->count; i++) index->offsets [i] -= end - start;
+	memmove (index->offsets + first, index->offsets + last, (index->count - last) * sizeof (glong));
+	index->count -= last - first;
+}
+
+/* The iter points after the inserted text once the default handler has run */
+static void swt_offset_index_insert_text (GtkTextBuffer *buffer, GtkTextIter *iter, gchar *text, gint len, gpointer user_data) {
+	SwtOffsetIndex *index = user_data;
+	glong offset = gtk_text_iter_get_offset (iter) - g_utf8_strlen (text, len);
+	swt_offset_index_insert (index, offset, text, len);
+}
+
+/*
+* The range is recorded before the default handler and applied after it
+* so that deletions that are stopped by another handler are ignored.
+*/
+static void swt_offset_index_delete_range (GtkTextBuffer *buffer, GtkTextIter *start, GtkTextIter *end, gpointer user_data) {
+	SwtOffsetIndex *index = user_data;
+	glong startOffset = gtk_text_iter_get_offset (start), endOffset = gtk_text_iter_get_offset (end);
+	index->deleteStart = MIN (startOffset, endOffset);
+	index->deleteEnd = MAX (startOffset, endOffset);
+}
+
+static void swt_offset_index_deleted_range (GtkTextBuffer *buffer, GtkTextIter *start, GtkTextIter *end, gpointer user_data) {
+	SwtOffsetIndex *index = user_data;
+	if (index->deleteStart == -1) return;
+	swt_offset_index_delete (index, index->deleteStart, index->deleteEnd);
+	index->deleteStart = index->deleteEnd = -1;
+}
+
+SwtOffsetIndex *swt_offset_index_new (GtkTextBuffer *buffer) {
+	SwtOffsetIndex *index = g_new0 (SwtOffsetIndex, 1);
+	GtkTextIter start, end;
+	gchar *text;
+	index->buffer = g_object_ref (buffer);
+	index->deleteStart = index->deleteEnd = -1;
+	gtk_text_buffer_get_bounds (buffer, &start, &end);
+	text = gtk_text_buffer_get_text (buffer, &start, &end, TRUE);
+	swt_offset_index_insert (index, 0, text, strlen (text));
+	g_free (text);
+	index->insertHandler = g_signal_connect_after (buffer, "insert-text", G_CALLBACK (swt_offset_index_insert_text), index);
+	index->deleteHandler = g_signal_connect (buffer, "delete-range", G_CALLBACK (swt_offset_index_delete_range), index);
+	index->deletedHandler = g_signal_connect_after (buffer, "delete-range", G_CALLBACK (swt_offset_index_deleted_range), index);
+	return index;
+}
+
+void swt_offset_index_free (SwtOffsetIndex *index) {
+	g_signal_handler_disconnect (index->buffer, index->insertHandler);
+	g_signal_handler_disconnect (index->buffer, index->deleteHandler);
+	g_signal_handler_disconnect (index->buffer, index->deletedHandler);
+	g_object_unref (index->buffer);
+	g_free (index->offsets);
+	g_free (index);
+}
+
+/* Converts a character offset to a UTF-16 offset */
+glong swt_offset_index_utf8_to_utf16 (SwtOffsetIndex *index, glong offset) {
+	glong length = gtk_text_buffer_get_char_count (index->buffer);
+	if (offset <= 0) return 0;
+	if (offset > length) offset = length;
+	return offset + swt_offset_index_search (index, offset);
+}
+
+/*
+* Converts a UTF-16 offset to a character offset.  An offset between the
+* two halves of a surrogate pair maps after the character, the same as
+* g_utf16_offset_to_utf8_offset().
+*/
+glong swt_offset_index_utf16_to_utf8 (SwtOffsetIndex *index, glong offset) {
+	glong length = gtk_text_buffer_get_char_count (index->buffer);
+	glong low = 0, high = index->count, result;
+	if (offset <= 0) return 0;
+	/* count the characters outside the BMP that start before offset */
+	while (low < high) {
+		glong mid = (low + high) / 2;
+		if (index->offsets [mid] + mid < offset) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+	result = offset - low;
+	if (low > 0 && index->offsets [low - 1] + low == offset) result++;
+	return MIN (result, length);
+}
+
+#endif
+
+/*
+* Inserts count rows into a GtkListStore or GtkTreeStore and sets
+* n_columns columns of each row in the same step, so that each row
+* emits a single row-inserted signal.  The values are column major,
+* values [c * count + r] being the value of columns [c] for row r.
+* For string columns the value is the byte offset of a NUL terminated
+* UTF-8 string in strings, or -1 for NULL.  Other columns take it as an
+* int, a boolean or a pointer according to the column type.  The rows
+* are inserted at index under parent, or appended when index is -1.
+* When iters is not NULL, it receives a newly allocated GtkTreeIter for
+* each row that is freed with g_free().  When view is not NULL, the
+* model is detached from the view during the insert so that the view
+* does not lay out every row as it arrives.
+*/
+/*
+* Answers a new region that is the union of count rectangles stored as
+* four ints each, the x, y, width and height.  On GTK 3 the ints have
+* the layout of cairo_rectangle_int_t and cairo builds the region in one
+* pass instead of merging each rectangle into it.
+*/
+GdkRegion *swt_region_new_rectangles (gint *rects, gint count) {
+#if GTK_CHECK_VERSION(3,0,0)
+	return cairo_region_create_rectangles ((const cairo_rectangle_int_t *) rects, count);
+#else
+	GdkRegion *region = gdk_region_new ();
+	GdkRectangle rect;
+	gint i;
+	for (i = 0; i < count; i++) {
+		rect.x = rects [i * 4];
+		rect.y = rects [i * 4 + 1];
+		rect.width = rects [i * 4 + 2];
+		rect.height = rects [i * 4 + 3];
+		gdk_region_union_with_rect (region, &rect);
+	}
+	return region;
+#endif
+}
+
+/*
+* Inserts length bytes of UTF-8 text into a GtkTextBuffer, placing the
+* cursor and scrolling it onscreen in the same call.  When replace is
+* TRUE, the text replaces the content of the buffer, the SWT closures of
+* the buffer are held while it changes and the cursor is placed at the
+* start.  Otherwise the text is appended, with the signals emitted as
+* usual, and the cursor is placed after it.  The view may be NULL.
+*/
+void swt_text_buffer_insert (GtkTextBuffer *buffer, GtkTextView *view, const gchar *text, gint length, gboolean replace) {
+	GtkTextIter iter;
+	if (replace) {
+		swt_closure_hold (G_OBJECT (buffer), TRUE);
+		gtk_text_buffer_set_text (buffer, text, length);
+		swt_closure_hold (G_OBJECT (buffer), FALSE);
+		gtk_text_buffer_get_start_iter (buffer, &iter);
+	} else {
+		gtk_text_buffer_get_end_iter (buffer, &iter);
+		gtk_text_buffer_insert (buffer, &iter, text, length);
+	}
+	gtk_text_buffer_place_cursor (buffer, &iter);
+	if (view != NULL) gtk_text_view_scroll_mark_onscreen (view, gtk_text_buffer_get_insert (buffer));
+}
+
+void swt_tree_model_insert_rows (GtkTreeView *view, GtkTreeModel *model, GtkTreeIter *parent, gint index, gint count, gint n_columns, gint *columns, gintptr *values, const gchar *strings, gintptr *iters) {
+	GValue *row;
+	GType *types;
+	GtkTreeIter iter, *rowIter;
+	gboolean isList;
+	gint c, r;
+	if (count <= 0) return;
+	if (n_columns < 0 || (n_columns > 0 && (!columns || !values))) return;
+	isList = GTK_IS_LIST_STORE (model);
+	if (!isList && !GTK_IS_TREE_STORE (model)) return;
+	row = g_new0 (GValue, n_columns);
+	types = g_new (GType, n_columns);
+	for (c = 0; c < n_columns; c++) {
+		GType type = gtk_tree_model_get_column_type (model, columns [c]);
+		g_value_init (&row [c], type);
+		types [c] = G_TYPE_FUNDAMENTAL (type);
+	}
+	if (view) {
+		g_object_ref (model);
+		gtk_tree_view_set_model (view, NULL);
+	}
+	for (r = 0; r < count; r++) {
+		for (c = 0; c < n_columns; c++) {
+			gintptr value = values [c * count + r];
+			switch (types [c]) {
+				case G_TYPE_STRING:
+					g_value_set_static_string (&row [c], value == -1 || !strings ? NULL : strings + value);
+					break;
+				case G_TYPE_BOOLEAN: g_value_set_boolean (&row [c], value != 0); break;
+				case G_TYPE_INT: g_value_set_int (&row [c], (gint)value); break;
+				case G_TYPE_UINT: g_value_set_uint (&row [c], (guint)value); break;
+				case G_TYPE_OBJECT: g_value_set_object (&row [c], (gpointer)value); break;
+				case G_TYPE_BOXED: g_value_set_static_boxed (&row [c], (gconstpointer)value); break;
+				case G_TYPE_POINTER: g_value_set_pointer (&row [c], (gpointer)value); break;
+			}
+		}
+		rowIter = iters ? g_new (GtkTreeIter, 1) : &iter;
+		if (isList) {
+			gtk_list_store_insert_with_valuesv (GTK_LIST_STORE (model), rowIter, index == -1 ? -1 : index + r, columns, row, n_columns);
+		} else {
+			gtk_tree_store_insert_with_valuesv (GTK_TREE_STORE (model), rowIter, parent, index == -1 ? -1 : index + r, columns, row, n_columns);
+		}
+		if (iters) iters [r] = (gintptr)rowIter;
+	}
+	if (view) {
+		gtk_tree_view_set_model (view, model);
+		g_object_unref (model);
+	}
+	for (c = 0; c < n_columns; c++) g_value_unset (&row [c]);
+	g_free (types);
+	g_free (row);
+}
+
+static void swt_uri_list_append (GArray *names, const gchar *data, gint size) {
+	gchar *uri, *local_name, *utf8_name;
+	gunichar2 *utf16_name, terminator = 0;
+	glong written = 0;
+	uri = g_strndup (data, size);
+	local_name = g_filename_from_uri (uri, NULL, NULL);
+	g_free (uri);
+	if (local_name == NULL) return;
+	utf8_name = g_filename_to_utf8 (local_name, -1, NULL, NULL, NULL);
+	if (utf8_name == NULL) utf8_name = g_filename_display_name (local_name);
+	g_free (local_name);
+	if (utf8_name == NULL) return;
+	utf16_name = g_utf8_to_utf16 (utf8_name, -1, NULL, &written, NULL);
+	g_free (utf8_name);
+	if (utf16_name == NULL) return;
+	g_array_append_vals (names, utf16_name, written);
+	g_array_append_val (names, terminator);
+	g_free (utf16_name);
+}
+
+/*
+* Converts the file URIs of a text/uri-list, whose lines end with CRLF,
+* or of a x-special/gnome-copied-files list, whose lines end with LF and
+* whose first line is the operation, to the UTF-16 names of the files
+* each followed by a null character.  URIs that are not local files or
+* whose names cannot be converted are skipped.  Answers the names in
+* memory that is freed with g_free() and their length in items_written.
+*/
+gunichar2 *swt_uri_list_to_utf16 (const gchar *data, gint length, gboolean gnome_list, gint *items_written) {
+	GArray *names = g_array_new (FALSE, FALSE, sizeof (gunichar2));
+	gint sep_length = gnome_list ? 1 : 2;
+	gint i, offset = 0;
+	for (i = 0; i < length - 1; i++) {
+		gboolean terminator = gnome_list ? data [i] == '\n' : data [i] == '\r' && data [i + 1] == '\n';
+		if (!terminator) continue;
+		/* The content of the first line in a gnome-list is always either 'copy' or 'cut' */
+		if (!(gnome_list && offset == 0)) swt_uri_list_append (names, data + offset, i - offset);
+		offset = i + sep_length;
+	}
+	if (offset < length - sep_length) swt_uri_list_append (names, data + offset, length - offset);
+	*items_written = names->len;
+	return (gunichar2 *) g_array_free (names, FALSE);
+}
+
+/*
+* Requests the size of count widgets and allocates them the rectangles
+* stored as four ints each in allocations, the x, y, width and height,
+* as a loop of gtk_widget_size_allocate() calls that are each preceded
+* by a size request would.
+*/
+void swt_widget_size_allocate_batch (GtkWidget **widgets, gint *allocations, gint count) {
+	GtkRequisition requisition;
+	GtkAllocation allocation;
+	gint i;
+	for (i = 0; i < count; i++) {
+		gint *rect = allocations + i * 4;
+		if (widgets [i] == NULL) continue;
+#if GTK_CHECK_VERSION(3,0,0)
+		gtk_widget_get_preferred_size (widgets [i], &requisition, NULL);
+#else
+		gtk_widget_size_request (widgets [i], &requisition);
+#endif
+		allocation.x = rect [0];
+		allocation.y = rect [1];
+		allocation.width = rect [2];
+		allocation.height = rect [3];
+		gtk_widget_size_allocate (widgets [i], &allocation);
+	}
+}
+
+#ifndef NO_SwtCellCache
+
+/*
+* Answers the cell data function of the text and pixbuf renderers of a
+* virtual tree without calling into Java for the rows that Java has
+* already filled.  The cache maps the id stored in the id column of a
+* row to the iter handle of its item.  For those rows it stores the
+* handle on the renderer and applies the custom colors and font of the
+* cell straight from the model, which is all the Java function does
+* once the item is cached.  Every other row goes to the Java function,
+* which adds the row with swt_cell_cache_add() when it is done.  The
+* renderers hold a reference to the cache so that it outlives them.
+*/
+struct _SwtCellCache {
+	gint refCount;
+	GtkTreeCellDataFunc func;
+	gpointer data;
+	GQuark quark;
+	gint idColumn;
+	gpointer *rows;
+	gint length;
+};
+
+typedef struct {
+	gint foreground, background, font;
+} SwtCellColumns;
+
+static GQuark swt_cell_cache_quark (void) {
+	static GQuark quark = 0;
+	if (quark == 0) quark = g_quark_from_static_string ("swt-cell-cache");
+	return quark;
+}
+
+static gint swt_cell_cache_get_id (SwtCellCache *cache, GtkTreeModel *model, GtkTreeIter *iter) {
+	gint id = -1;
+	gtk_tree_model_get (model, iter, cache->idColumn, &id, -1);
+	return id;
+}
+
+static void swt_cell_cache_unref (gpointer data) {
+	SwtCellCache *cache = data;
+	if (--cache->refCount > 0) return;
+	g_free (cache->rows);
+	g_free (cache);
+}
+
+static void swt_cell_cache_set_boxed (GtkCellRenderer *cell, const gchar *property, GtkTreeModel *model, GtkTreeIter *iter, gint column) {
+	gpointer value = NULL;
+	if (column < 0) return;
+	gtk_tree_model_get (model, iter, column, &value, -1);
+	if (value == NULL) return;
+	g_object_set (cell, property, value, NULL);
+	g_boxed_free (gtk_tree_model_get_column_type (model, column), value);
+}
+
+static void swt_cell_cache_data_func (GtkTreeViewColumn *column, GtkCellRenderer *cell, GtkTreeModel *model, GtkTreeIter *iter, gpointer data) {
+	SwtCellCache *cache = data;
+	SwtCellColumns *columns;
+	gpointer handle = NULL;
+	gint id;
+	if (cache->func == NULL) return;
+	columns = g_object_get_qdata (G_OBJECT (cell), swt_cell_cache_quark ());
+	id = swt_cell_cache_get_id (cache, model, iter);
+	if (columns != NULL && 0 <= id && id < cache->length) handle = cache->rows [id];
+	if (handle == NULL) {
+		cache->func (column, cell, model, iter, cache->data);
+		return;
+	}
+	g_object_set_qdata (G_OBJECT (cell), cache->quark, handle);
+	if (GTK_IS_CELL_RENDERER_TEXT (cell) && gtk_major_version >= 3) {
+		gtk_cell_renderer_set_fixed_size (cell, -1, -1);
+	}
+	swt_cell_cache_set_boxed (cell, "cell-background-gdk", model, iter, columns->background);
+	swt_cell_cache_set_boxed (cell, "foreground-gdk", model, iter, columns->foreground);
+	swt_cell_cache_set_boxed (cell, "font-desc", model, iter, columns->font);
+}
+
+SwtCellCache *swt_cell_cache_new (GtkTreeCellDataFunc func, gpointer data, GQuark quark, gint id_column) {
+	SwtCellCache *cache = g_new0 (SwtCellCache, 1);
+	cache->refCount = 1;
+	cache->func = func;
+	cache->data = data;
+	cache->quark = quark;
+	cache->idColumn = id_column;
+	return cache;
+}
+
+void swt_cell_cache_free (SwtCellCache *cache) {
+	cache->func = NULL;
+	swt_cell_cache_unref (cache);
+}
+
+/*
+* Makes the cache the cell data function of the renderer.  The colors
+* and font of the cell are read from the given model columns, which are
+* -1 when they do not apply to the renderer.
+*/
+void swt_cell_cache_set_data_func (SwtCellCache *cache, GtkTreeViewColumn *column, GtkCellRenderer *cell, gint foreground, gint background, gint font) {
+	SwtCellColumns *columns = g_new (SwtCellColumns, 1);
+	columns->foreground = foreground;
+	columns->background = background;
+	columns->font = font;
+	g_object_set_qdata_full (G_OBJECT (cell), swt_cell_cache_quark (), columns, g_free);
+	cache->refCount++;
+	gtk_tree_view_column_set_cell_data_func (column, cell, swt_cell_cache_data_func, cache, swt_cell_cache_unref);
+}
+
+void swt_cell_cache_add (SwtCellCache *cache, GtkTreeModel *model, GtkTreeIter *iter, GtkTreeIter *handle) {
+	gint id = swt_cell_cache_get_id (cache, model, iter);
+	if (id < 0) return;
+	if (id >= cache->length) {
+		gint length = MAX (id + 1, cache->length * 2);
+		cache->rows = g_renew (gpointer, cache->rows, length);
+		memset (cache->rows + cache->length, 0, (length - cache->length) * sizeof (gpointer));
+		cache->length = length;
+	}
+	cache->rows [id] = handle;
+}
+
+void swt_cell_cache_remove (SwtCellCache *cache, GtkTreeModel *model, GtkTreeIter *iter) {
+	gint id = swt_cell_cache_get_id (cache, model, iter);
+	if (0 <= id && id < cache->length) cache->rows [id] = NULL;
+}
+
+void swt_cell_cache_clear (SwtCellCache *cache) {
+	if (cache->length > 0) memset (cache->rows, 0, cache->length * sizeof (gpointer));
+}
+
+#endif
+
+#ifndef NO_SwtDecodeQueue
+/*
+* Decodes images with GdkPixbufLoader on the threads of a GThreadPool.
+* The decoded pixbufs are queued for the UI thread, which is woken up
+* with g_main_context_wakeup() and takes them with swt_decode_queue_pop().
+*/
+struct _SwtDecodeQueue {
+	GThreadPool *pool;
+	GAsyncQueue *done;
+	volatile gint cancelled;
+};
+
+typedef struct _SwtDecodeJob {
+	gintptr id;
+	gchar *filename;
+	guchar *data;
+	gsize length;
+	gint width, height;
+	GdkPixbuf *pixbuf;
+} SwtDecodeJob;
+
+static void swt_decode_job_free (SwtDecodeJob *job) {
+	if (job->pixbuf) g_object_unref (job->pixbuf);
+	g_free (job->filename);
+	g_free (job->data);
+	g_free (job);
+}
+
+/* Scales the image to fit in the requested size, keeping its aspect ratio */
+static void swt_decode_size_prepared (GdkPixbufLoader *loader, gint width, gint height, gpointer user_data) {
+	SwtDecodeJob *job = (SwtDecodeJob *) user_data;
+	if (width <= 0 || height <= 0) return;
+	if (width <= job->width && height <= job->height) return;
+	if ((gint64) width * job->height > (gint64) height * job->width) {
+		height = MAX (1, (gint) ((gint64) height * job->width / width));
+		width = job->width;
+	} else {
+		width = MAX (1, (gint) ((gint64) width * job->height / height));
+		height = job->height;
+	}
+	gdk_pixbuf_loader_set_size (loader, width, height);
+}
+
+static void swt_decode_run (gpointer data, gpointer user_data) {
+	SwtDecodeJob *job = (SwtDecodeJob *) data;
+	SwtDecodeQueue *queue = (SwtDecodeQueue *) user_data;
+	if (g_atomic_int_get (&queue->cancelled)) {
+		swt_decode_job_free (job);
+		return;
+	}
+	if (job->filename != NULL) {
+		g_file_get_contents (job->filename, (gchar **) &job->data, &job->length, NULL);
+	}
+	if (job->data != NULL) {
+		GdkPixbufLoader *loader = gdk_pixbuf_loader_new ();
+		gboolean ok;
+		if (job->width > 0 && job->height > 0) {
+			g_signal_connect (loader, "size-prepared", G_CALLBACK (swt_decode_size_prepared), job);
+		}
+		ok = gdk_pixbuf_loader_write (loader, job->data, job->length, NULL);
+		if (gdk_pixbuf_loader_close (loader, NULL) && ok) {
+			job->pixbuf = gdk_pixbuf_loader_get_pixbuf (loader);
+			if (job->pixbuf) g_object_ref (job->pixbuf);
+		}
+		g_object_unref (loader);
+	}
+	g_free (job->filename);
+	g_free (job->data);
+	job->filename = NULL;
+	job->data = NULL;
+	g_async_queue_push (queue->done, job);
+	g_main_context_wakeup (NULL);
+}
+
+SwtDecodeQueue *swt_decode_queue_new (gint max_threads) {
+	SwtDecodeQueue *queue = g_new0 (SwtDecodeQueue, 1);
+	queue->done = g_async_queue_new ();
+	queue->pool = g_thread_pool_new (swt_decode_run, queue, max_threads > 0 ? max_threads : 2, FALSE, NULL);
+	if (queue->pool == NULL) {
+		g_async_queue_unref (queue->done);
+		g_free (queue);
+		return NULL;
+	}
+	return queue;
+}
+
+static void swt_decode_queue_push (SwtDecodeQueue *queue, SwtDecodeJob *job) {
+	if (job->filename == NULL && job->data == NULL) {
+		g_async_queue_push (queue->done, job);
+		g_main_context_wakeup (NULL);
+		return;
+	}
+	g_thread_pool_push (queue->pool, job, NULL);
+}
+
+void swt_decode_queue_push_file (SwtDecodeQueue *queue, gintptr id, const gchar *filename, gint width, gint height) {
+	SwtDecodeJob *job = g_new0 (SwtDecodeJob, 1);
+	job->id = id;
+	job->filename = g_strdup (filename);
+	job->width = width;
+	job->height = height;
+	swt_decode_queue_push (queue, job);
+}
+
+void swt_decode_queue_push_data (SwtDecodeQueue *queue, gintptr id, const guchar *data, gsize length, gint width, gint height) {
+	SwtDecodeJob *job = g_new0 (SwtDecodeJob, 1);
+	job->id = id;
+	job->data = length > 0 ? g_memdup (data, length) : NULL;
+	job->length = length;
+	job->width = width;
+	job->height = height;
+	swt_decode_queue_push (queue, job);
+}
+
+GdkPixbuf *swt_decode_queue_pop (SwtDecodeQueue *queue, gintptr *id) {
+	GdkPixbuf *pixbuf;
+	SwtDecodeJob *job = (SwtDecodeJob *) g_async_queue_try_pop (queue->done);
+	if (job == NULL) {
+		*id = 0;
+		return NULL;
+	}
+	*id = job->id;
+	pixbuf = job->pixbuf;
+	job->pixbuf = NULL;
+	swt_decode_job_free (job);
+	return pixbuf;
+}
+
+void swt_decode_queue_free (SwtDecodeQueue *queue) {
+	SwtDecodeJob *job;
+	/* The jobs that have not started are freed without being decoded */
+	g_atomic_int_set (&queue->cancelled, 1);
+	g_thread_pool_free (queue->pool, FALSE, TRUE);
+	while ((job = (SwtDecodeJob *) g_async_queue_try_pop (queue->done)) != NULL) {
+		swt_decode_job_free (job);
+	}
+	g_async_queue_unref (queue->done);
+	g_free (queue);
+}
+
+#endif
+
+#ifndef NO_SwtTimerQueue
+/*
+* Runs the timers of Display.timerExec() from a single GSource. The
+* timers are kept in a binary heap ordered by their deadline, and the
+* source is ready when the first one expires. Dispatching calls func
+* once, which takes the ids of all the expired timers at once with
+* swt_timer_queue_pop(). Timers that expire at the same time run in
+* the order they were added.
+*/
+typedef struct _SwtTimer {
+	gint64 deadline;
+	guint64 serial;
+	gint id;
+} SwtTimer;
+
+typedef struct _SwtTimerSource {
+	GSource source;
+	SwtTimerQueue *queue;
+} SwtTimerSource;
+
+struct _SwtTimerQueue {
+	GSource *source;
+	GSourceFunc func;
+	gpointer data;
+	SwtTimer *timers;
+	gint count, size;
+	guint64 serial;
+};
+
+static gboolean swt_timer_before (SwtTimer *timer1, SwtTimer *timer2) {
+	if (timer1->deadline != timer2->deadline) return timer1->deadline < timer2->deadline;
+	return timer1->serial < timer2->serial;
+}
+
+static void swt_timer_queue_up (SwtTimerQueue *queue, gint index) {
+	SwtTimer timer = queue->timers [index];
+	while (index > 0) {
+		gint parent = (index - 1) / 2;
+		if (!swt_timer_before (&timer, &queue->timers [parent])) break;
+		queue->timers [index] = queue->timers [parent];
+		index = parent;
+	}
+	queue->timers [index] = timer;
+}
+
+static void swt_timer_queue_down (SwtTimerQueue *queue, gint index) {
+	SwtTimer timer = queue->timers [index];
+	for (;;) {
+		gint child = index * 2 + 1;
+		if (child >= queue->count) break;
+		if (child + 1 < queue->count && swt_timer_before (&queue->timers [child + 1], &queue->timers [child])) child++;
+		if (!swt_timer_before (&queue->timers [child], &timer)) break;
+		queue->timers [index] = queue->timers [child];
+		index = child;
+	}
+	queue->timers [index] = timer;
+}
+
+static void swt_timer_queue_delete (SwtTimerQueue *queue, gint index) {
+	queue->count--;
+	if (index == queue->count) return;
+	queue->timers [index] = queue->timers [queue->count];
+	swt_timer_queue_down (queue, index);
+	swt_timer_queue_up (queue, index);
+}
+
+static gboolean swt_timer_source_prepare (GSource *source, gint *timeout) {
+	SwtTimerQueue *queue = ((SwtTimerSource *) source)->queue;
+	gint64 now, delay;
+	if (queue->count == 0) {
+		*timeout = -1;
+		return FALSE;
+	}
+	now = g_source_get_time (source);
+	delay = queue->timers [0].deadline - now;
+	if (delay <= 0) {
+		*timeout = 0;
+		return TRUE;
+	}
+	/* Round up, so that the timer has expired when the poll returns */
+	delay = (delay + 999) / 1000;
+	*timeout = delay > G_MAXINT ? G_MAXINT : (gint) delay;
+	return FALSE;
+}
+
+static gboolean swt_timer_source_check (GSource *source) {
+	SwtTimerQueue *queue = ((SwtTimerSource *) source)->queue;
+	if (queue->count == 0) return FALSE;
+	return queue->timers [0].deadline <= g_source_get_time (source);
+}
+
+static gboolean swt_timer_source_dispatch (GSource *source, GSourceFunc callback, gpointer user_data) {
+	SwtTimerQueue *queue = ((SwtTimerSource *) source)->queue;
+	queue->func (queue->data);
+	return TRUE;
+}
+
+static GSourceFuncs swt_timer_source_funcs = {
+	swt_timer_source_prepare,
+	swt_timer_source_check,
+	swt_timer_source_dispatch,
+	NULL
+};
+
+SwtTimerQueue *swt_timer_queue_new (GSourceFunc func, gpointer data) {
+	SwtTimerQueue *queue = g_new0 (SwtTimerQueue, 1);
+	queue->func = func;
+	queue->data = data;
+	queue->source = g_source_new (&swt_timer_source_funcs, sizeof (SwtTimerSource));
+	((SwtTimerSource *) queue->source)->queue = queue;
+	/*
+	* A timer may run a nested event loop, as when it opens a dialog,
+	* and the other timers have to keep running in that loop.
+	*/
+	g_source_set_can_recurse (queue->source, TRUE);
+	g_source_attach (queue->source, NULL);
+	return queue;
+}
+
+/* Adds the timer, or moves its deadline when it was already added */
+void swt_timer_queue_add (SwtTimerQueue *queue, gint id, guint milliseconds) {
+	gint i;
+	SwtTimer *timer;
+	for (i = 0; i < queue->count; i++) {
+		if (queue->timers [i].id == id) {
+			swt_timer_queue_delete (queue, i);
+			break;
+		}
+	}
+	if (queue->count == queue->size) {
+		queue->size = queue->size == 0 ? 16 : queue->size * 2;
+		queue->timers = g_renew (SwtTimer, queue->timers, queue->size);
+	}
+	timer = &queue->timers [queue->count];
+	timer->deadline = g_get_monotonic_time () + (gint64) milliseconds * 1000;
+	timer->serial = queue->serial++;
+	timer->id = id;
+	swt_timer_queue_up (queue, queue->count++);
+	/* The source has to compute its timeout again when the first timer changed */
+	g_main_context_wakeup (g_source_get_context (queue->source));
+}
+
+void swt_timer_queue_remove (SwtTimerQueue *queue, gint id) {
+	gint i;
+	for (i = 0; i < queue->count; i++) {
+		if (queue->timers [i].id == id) {
+			swt_timer_queue_delete (queue, i);
+			return;
+		}
+	}
+}
+
+/* Removes up to count expired timers and answers their ids in the order they expired */
+gint swt_timer_queue_pop (SwtTimerQueue *queue, gint *ids, gint count) {
+	gint result = 0;
+	gint64 now = g_get_monotonic_time ();
+	while (result < count && queue->count > 0 && queue->timers [0].deadline <= now) {
+		ids [result++] = queue->timers [0].id;
+		swt_timer_queue_delete (queue, 0);
+	}
+	return result;
+}
+
+void swt_timer_queue_free (SwtTimerQueue *queue) {
+	g_source_destroy (queue->source);
+	g_source_unref (queue->source);
+	g_free (queue->timers);
+	g_free (queue);
+}
+
+#endif
+
+#ifndef NO_SwtWakeSource
+/*
+* Wakes the UI thread from other threads. Only the wake that finds no
+* wake pending calls g_main_context_wakeup(), so that any number of
+* wakes before the UI thread runs again write the wakeup fd of the
+* context once. The source is ready while a wake is pending, so the
+* poll of the UI thread returns, and dispatching it clears the flag.
+*/
+struct _SwtWakeSource {
+	GSource source;
+	volatile gint pending;
+};
+
+static gboolean swt_wake_source_prepare (GSource *source, gint *timeout) {
+	*timeout = -1;
+	return g_atomic_int_get (&((SwtWakeSource *) source)->pending) != 0;
+}
+
+static gboolean swt_wake_source_check (GSource *source) {
+	return g_atomic_int_get (&((SwtWakeSource *) source)->pending) != 0;
+}
+
+static gboolean swt_wake_source_dispatch (GSource *source, GSourceFunc callback, gpointer user_data) {
+	g_atomic_int_set (&((SwtWakeSource *) source)->pending, 0);
+	return TRUE;
+}
+
+static GSourceFuncs swt_wake_source_funcs = {
+	swt_wake_source_prepare,
+	swt_wake_source_check,
+	swt_wake_source_dispatch,
+	NULL
+};
+
+SwtWakeSource *swt_wake_source_new (void) {
+	GSource *source = g_source_new (&swt_wake_source_funcs, sizeof (SwtWakeSource));
+	g_source_attach (source, NULL);
+	return (SwtWakeSource *) source;
+}
+
+void swt_wake_source_signal (SwtWakeSource *source) {
+	if (g_atomic_int_compare_and_exchange (&source->pending, 0, 1)) {
+		g_main_context_wakeup (g_source_get_context ((GSource *) source));
+	}
+}
+
+void swt_wake_source_free (SwtWakeSource *source) {
+	g_source_destroy ((GSource *) source);
+	g_source_unref ((GSource *) source);
+}
+
+#endif
@@ -255,6 +255,7 @@
 #define gdk_cursor_new_from_pixmap_LIB LIB_GDK
 #define gdk_window_get_internal_paint_info_LIB LIB_GDK
 #define gdk_window_invalidate_region_LIB LIB_GDK
+#define gdk_window_move_region_LIB LIB_GDK
 #define gdk_window_shape_combine_region_LIB LIB_GDK
 #define gdk_window_set_back_pixmap_LIB LIB_GDK
 #define gdk_gc_set_background_LIB LIB_GDK
@@ -705,6 +706,13 @@ glong g_utf16_strlen(const gchar*, glong max);
 glong g_utf16_offset_to_utf8_offset(const gchar*, glong);
 glong g_utf8_offset_to_utf16_offset(const gchar*, glong);
 
+void swt_event_handler_set(GdkEventFunc func, gpointer data, GDestroyNotify notify);
+
+GClosure *swt_closure_new(GCallback callback, gint id);
+void swt_closure_mute(GObject *instance, gint id, gboolean mute);
+void swt_closure_hold(GObject *instance, gboolean hold);
+void swt_closure_set_muting(gboolean muting);
+
 #ifndef NO_SwtFixed
 
 #define SWT_TYPE_FIXED (swt_fixed_get_type ())
@@ -740,3 +748,76 @@ void swt_fixed_resize(SwtFixed *fixed, GtkWidget *widget, gint width, gint heigh
 
 #endif
 
+#ifndef NO_SwtOffsetIndex
+
+typedef struct _SwtOffsetIndex SwtOffsetIndex;
+
+SwtOffsetIndex *swt_offset_index_new(GtkTextBuffer *buffer);
+void swt_offset_index_free(SwtOffsetIndex *index);
+glong swt_offset_index_utf8_to_utf16(SwtOffsetIndex *index, glong offset);
+glong swt_offset_index_utf16_to_utf8(SwtOffsetIndex *index, glong offset);
+
+#endif
+
+/* The number of ints stored for each line by swt_pango_layout_get_lines() */
+#define SWT_PANGO_LINE_SIZE 7
+
+gint swt_pango_layout_get_lines(PangoLayout *layout, gint *lines, gint count);
+
+GdkRegion *swt_region_new_rectangles(gint *rects, gint count);
+
+void swt_text_buffer_insert(GtkTextBuffer *buffer, GtkTextView *view, const gchar *text, gint length, gboolean replace);
+
+void swt_tree_model_insert_rows(GtkTreeView *view, GtkTreeModel *model, GtkTreeIter *parent, gint index, gint count, gint n_columns, gint *columns, gintptr *values, const gchar *strings, gintptr *iters);
+
+gunichar2 *swt_uri_list_to_utf16(const gchar *data, gint length, gboolean gnome_list, gint *items_written);
+
+void swt_widget_size_allocate_batch(GtkWidget **widgets, gint *allocations, gint count);
+
+#ifndef NO_SwtCellCache
+
+typedef struct _SwtCellCache SwtCellCache;
+
+SwtCellCache *swt_cell_cache_new(GtkTreeCellDataFunc func, gpointer data, GQuark quark, gint id_column);
+void swt_cell_cache_free(SwtCellCache *cache);
+void swt_cell_cache_set_data_func(SwtCellCache *cache, GtkTreeViewColumn *column, GtkCellRenderer *cell, gint foreground, gint background, gint font);
+void swt_cell_cache_add(SwtCellCache *cache, GtkTreeModel *model, GtkTreeIter *iter, GtkTreeIter *handle);
+void swt_cell_cache_remove(SwtCellCache *cache, GtkTreeModel *model, GtkTreeIter *iter);
+void swt_cell_cache_clear(SwtCellCache *cache);
+
+#endif
+
+#ifndef NO_SwtDecodeQueue
+
+typedef struct _SwtDecodeQueue SwtDecodeQueue;
+
+SwtDecodeQueue *swt_decode_queue_new(gint max_threads);
+void swt_decode_queue_free(SwtDecodeQueue *queue);
+void swt_decode_queue_push_file(SwtDecodeQueue *queue, gintptr id, const gchar *filename, gint width, gint height);
+void swt_decode_queue_push_data(SwtDecodeQueue *queue, gintptr id, const guchar *data, gsize length, gint width, gint height);
+GdkPixbuf *swt_decode_queue_pop(SwtDecodeQueue *queue, gintptr *id);
+
+#endif
+
+
+#ifndef NO_SwtTimerQueue
+
+typedef struct _SwtTimerQueue SwtTimerQueue;
+
+SwtTimerQueue *swt_timer_queue_new(GSourceFunc func, gpointer data);
+void swt_timer_queue_free(SwtTimerQueue *queue);
+void swt_timer_queue_add(SwtTimerQueue *queue, gint id, guint milliseconds);
+void swt_timer_queue_remove(SwtTimerQueue *queue, gint id);
+gint swt_timer_queue_pop(SwtTimerQueue *queue, gint *ids, gint count);
+
+#endif
+
+#ifndef NO_SwtWakeSource
+
+typedef struct _SwtWakeSource SwtWakeSource;
+
+SwtWakeSource *swt_wake_source_new(void);
+void swt_wake_source_signal(SwtWakeSource *source);
+void swt_wake_source_free(SwtWakeSource *source);
+
+#endif
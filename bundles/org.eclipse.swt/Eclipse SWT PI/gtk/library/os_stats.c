@@ -97,6 +97,7 @@ char * OS_nativeFunctionNames[] = {
 	"GtkTargetEntry_1sizeof",
 	"GtkTextIter_1sizeof",
 	"GtkTreeIter_1sizeof",
+	"NewDirectByteBuffer",
 	"PangoAttrColor_1sizeof",
 	"PangoAttrInt_1sizeof",
 	"PangoAttribute_1sizeof",
@@ -576,6 +577,7 @@ char * OS_nativeFunctionNames[] = {
 	"_1gdk_1window_1lookup",
 	"_1gdk_1window_1lower",
 	"_1gdk_1window_1move",
+	"_1gdk_1window_1move_1region",
 	"_1gdk_1window_1move_1resize",
 	"_1gdk_1window_1new",
 	"_1gdk_1window_1process_1all_1updates",
@@ -665,6 +667,7 @@ char * OS_nativeFunctionNames[] = {
 	"_1gtk_1check_1version",
 	"_1gtk_1clipboard_1clear",
 	"_1gtk_1clipboard_1get",
+	"_1gtk_1clipboard_1request_1contents",
 	"_1gtk_1clipboard_1set_1can_1store",
 	"_1gtk_1clipboard_1set_1with_1owner",
 	"_1gtk_1clipboard_1store",
@@ -1545,11 +1548,45 @@ char * OS_nativeFunctionNames[] = {
 	"_1pango_1tab_1array_1get_1tabs",
 	"_1pango_1tab_1array_1new",
 	"_1pango_1tab_1array_1set_1tab",
+	"_1swt_1cell_1cache_1add",
+	"_1swt_1cell_1cache_1clear",
+	"_1swt_1cell_1cache_1free",
+	"_1swt_1cell_1cache_1new",
+	"_1swt_1cell_1cache_1remove",
+	"_1swt_1cell_1cache_1set_1data_1func",
+	"_1swt_1closure_1mute",
+	"_1swt_1closure_1new",
+	"_1swt_1closure_1set_1muting",
+	"_1swt_1decode_1queue_1free",
+	"_1swt_1decode_1queue_1new",
+	"_1swt_1decode_1queue_1pop",
+	"_1swt_1decode_1queue_1push_1data",
+	"_1swt_1decode_1queue_1push_1file",
+	"_1swt_1event_1handler_1set",
 	"_1swt_1fixed_1get_1type",
 	"_1swt_1fixed_1move",
 	"_1swt_1fixed_1resize",
 	"_1swt_1fixed_1restack",
+	"_1swt_1offset_1index_1free",
+	"_1swt_1offset_1index_1new",
+	"_1swt_1offset_1index_1utf16_1to_1utf8",
+	"_1swt_1offset_1index_1utf8_1to_1utf16",
+	"_1swt_1pango_1layout_1get_1lines",
+	"_1swt_1region_1new_1rectangles",
+	"_1swt_1text_1buffer_1insert",
+	"_1swt_1timer_1queue_1add",
+	"_1swt_1timer_1queue_1free",
+	"_1swt_1timer_1queue_1new",
+	"_1swt_1timer_1queue_1pop",
+	"_1swt_1timer_1queue_1remove",
+	"_1swt_1tree_1model_1insert_1rows",
+	"_1swt_1uri_1list_1to_1utf16",
+	"_1swt_1wake_1source_1free",
+	"_1swt_1wake_1source_1new",
+	"_1swt_1widget_1size_1allocate_1batch",
 	"_1ubuntu_1menu_1proxy_1get",
+	"cacheStructFields",
+	"decodeEvent",
 	"g_1main_1context_1wakeup",
 	"g_1value_1get_1double",
 	"g_1value_1get_1float",
@@ -1818,11 +1855,16 @@ char * OS_nativeFunctionNames[] = {
 #endif
 	"pangoLayoutNewProc_1CALLBACK",
 	"realpath",
+	"sizeofs",
 	"strcmp",
+	"swt_1wake_1source_1signal",
 };
 #define NATIVE_FUNCTION_COUNT sizeof(OS_nativeFunctionNames) / sizeof(char*)
 int OS_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int OS_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong OS_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT OS_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS OS_nativeStats = {OS_nativeFunctionCallCount, OS_nativeFunctionCallTime, OS_nativeFunctionEvents, 0, "OS", OS_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -1844,4 +1886,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetFunctionCallCount)
 	return OS_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(OS_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return OS_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(OS_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &OS_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(OS_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(OS_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
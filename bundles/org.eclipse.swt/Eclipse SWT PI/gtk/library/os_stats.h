@@ -17,8 +17,9 @@
 extern int OS_nativeFunctionCount;
 extern int OS_nativeFunctionCallCount[];
 extern char* OS_nativeFunctionNames[];
-#define OS_NATIVE_ENTER(env, that, func) OS_nativeFunctionCallCount[func]++;
-#define OS_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS OS_nativeStats;
+#define OS_NATIVE_ENTER(env, that, func) nativeStatsEnter(&OS_nativeStats, func);
+#define OS_NATIVE_EXIT(env, that, func) nativeStatsExit(&OS_nativeStats, func);
 #else
 #ifndef OS_NATIVE_ENTER
 #define OS_NATIVE_ENTER(env, that, func) 
@@ -107,6 +108,7 @@ typedef enum {
 	GtkTargetEntry_1sizeof_FUNC,
 	GtkTextIter_1sizeof_FUNC,
 	GtkTreeIter_1sizeof_FUNC,
+	NewDirectByteBuffer_FUNC,
 	PangoAttrColor_1sizeof_FUNC,
 	PangoAttrInt_1sizeof_FUNC,
 	PangoAttribute_1sizeof_FUNC,
@@ -586,6 +588,7 @@ typedef enum {
 	_1gdk_1window_1lookup_FUNC,
 	_1gdk_1window_1lower_FUNC,
 	_1gdk_1window_1move_FUNC,
+	_1gdk_1window_1move_1region_FUNC,
 	_1gdk_1window_1move_1resize_FUNC,
 	_1gdk_1window_1new_FUNC,
 	_1gdk_1window_1process_1all_1updates_FUNC,
@@ -675,6 +678,7 @@ typedef enum {
 	_1gtk_1check_1version_FUNC,
 	_1gtk_1clipboard_1clear_FUNC,
 	_1gtk_1clipboard_1get_FUNC,
+	_1gtk_1clipboard_1request_1contents_FUNC,
 	_1gtk_1clipboard_1set_1can_1store_FUNC,
 	_1gtk_1clipboard_1set_1with_1owner_FUNC,
 	_1gtk_1clipboard_1store_FUNC,
@@ -1555,11 +1559,45 @@ typedef enum {
 	_1pango_1tab_1array_1get_1tabs_FUNC,
 	_1pango_1tab_1array_1new_FUNC,
 	_1pango_1tab_1array_1set_1tab_FUNC,
+	_1swt_1cell_1cache_1add_FUNC,
+	_1swt_1cell_1cache_1clear_FUNC,
+	_1swt_1cell_1cache_1free_FUNC,
+	_1swt_1cell_1cache_1new_FUNC,
+	_1swt_1cell_1cache_1remove_FUNC,
+	_1swt_1cell_1cache_1set_1data_1func_FUNC,
+	_1swt_1closure_1mute_FUNC,
+	_1swt_1closure_1new_FUNC,
+	_1swt_1closure_1set_1muting_FUNC,
+	_1swt_1decode_1queue_1free_FUNC,
+	_1swt_1decode_1queue_1new_FUNC,
+	_1swt_1decode_1queue_1pop_FUNC,
+	_1swt_1decode_1queue_1push_1data_FUNC,
+	_1swt_1decode_1queue_1push_1file_FUNC,
+	_1swt_1event_1handler_1set_FUNC,
 	_1swt_1fixed_1get_1type_FUNC,
 	_1swt_1fixed_1move_FUNC,
 	_1swt_1fixed_1resize_FUNC,
 	_1swt_1fixed_1restack_FUNC,
+	_1swt_1offset_1index_1free_FUNC,
+	_1swt_1offset_1index_1new_FUNC,
+	_1swt_1offset_1index_1utf16_1to_1utf8_FUNC,
+	_1swt_1offset_1index_1utf8_1to_1utf16_FUNC,
+	_1swt_1pango_1layout_1get_1lines_FUNC,
+	_1swt_1region_1new_1rectangles_FUNC,
+	_1swt_1text_1buffer_1insert_FUNC,
+	_1swt_1timer_1queue_1add_FUNC,
+	_1swt_1timer_1queue_1free_FUNC,
+	_1swt_1timer_1queue_1new_FUNC,
+	_1swt_1timer_1queue_1pop_FUNC,
+	_1swt_1timer_1queue_1remove_FUNC,
+	_1swt_1tree_1model_1insert_1rows_FUNC,
+	_1swt_1uri_1list_1to_1utf16_FUNC,
+	_1swt_1wake_1source_1free_FUNC,
+	_1swt_1wake_1source_1new_FUNC,
+	_1swt_1widget_1size_1allocate_1batch_FUNC,
 	_1ubuntu_1menu_1proxy_1get_FUNC,
+	cacheStructFields_FUNC,
+	decodeEvent_FUNC,
 	g_1main_1context_1wakeup_FUNC,
 	g_1value_1get_1double_FUNC,
 	g_1value_1get_1float_FUNC,
@@ -1828,5 +1866,7 @@ typedef enum {
 #endif
 	pangoLayoutNewProc_1CALLBACK_FUNC,
 	realpath_FUNC,
+	sizeofs_FUNC,
 	strcmp_FUNC,
+	swt_1wake_1source_1signal_FUNC,
 } OS_FUNCS;
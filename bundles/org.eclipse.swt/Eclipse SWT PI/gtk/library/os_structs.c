@@ -307,7 +307,12 @@ GdkEvent_FID_CACHE GdkEventFc;
 void cacheGdkEventFields(JNIEnv *env, jobject lpObject)
 {
 	if (GdkEventFc.cached) return;
-	GdkEventFc.clazz = (*env)->GetObjectClass(env, lpObject);
+	if (lpObject != NULL) {
+		GdkEventFc.clazz = (*env)->GetObjectClass(env, lpObject);
+	} else {
+		GdkEventFc.clazz = (*env)->FindClass(env, "org/eclipse/swt/internal/gtk/GdkEvent");
+		if (GdkEventFc.clazz == NULL) return;
+	}
 	GdkEventFc.type = (*env)->GetFieldID(env, GdkEventFc.clazz, "type", "I");
 	GdkEventFc.cached = 1;
 }
@@ -376,7 +381,12 @@ void cacheGdkEventButtonFields(JNIEnv *env, jobject lpObject)
 {
 	if (GdkEventButtonFc.cached) return;
 	cacheGdkEventFields(env, lpObject);
-	GdkEventButtonFc.clazz = (*env)->GetObjectClass(env, lpObject);
+	if (lpObject != NULL) {
+		GdkEventButtonFc.clazz = (*env)->GetObjectClass(env, lpObject);
+	} else {
+		GdkEventButtonFc.clazz = (*env)->FindClass(env, "org/eclipse/swt/internal/gtk/GdkEventButton");
+		if (GdkEventButtonFc.clazz == NULL) return;
+	}
 	GdkEventButtonFc.window = (*env)->GetFieldID(env, GdkEventButtonFc.clazz, "window", I_J);
 	GdkEventButtonFc.send_event = (*env)->GetFieldID(env, GdkEventButtonFc.clazz, "send_event", "B");
 	GdkEventButtonFc.time = (*env)->GetFieldID(env, GdkEventButtonFc.clazz, "time", "I");
@@ -660,7 +670,12 @@ void cacheGdkEventMotionFields(JNIEnv *env, jobject lpObject)
 {
 	if (GdkEventMotionFc.cached) return;
 	cacheGdkEventFields(env, lpObject);
-	GdkEventMotionFc.clazz = (*env)->GetObjectClass(env, lpObject);
+	if (lpObject != NULL) {
+		GdkEventMotionFc.clazz = (*env)->GetObjectClass(env, lpObject);
+	} else {
+		GdkEventMotionFc.clazz = (*env)->FindClass(env, "org/eclipse/swt/internal/gtk/GdkEventMotion");
+		if (GdkEventMotionFc.clazz == NULL) return;
+	}
 	GdkEventMotionFc.window = (*env)->GetFieldID(env, GdkEventMotionFc.clazz, "window", I_J);
 	GdkEventMotionFc.send_event = (*env)->GetFieldID(env, GdkEventMotionFc.clazz, "send_event", "B");
 	GdkEventMotionFc.time = (*env)->GetFieldID(env, GdkEventMotionFc.clazz, "time", "I");
@@ -1178,7 +1193,12 @@ GdkRectangle_FID_CACHE GdkRectangleFc;
 void cacheGdkRectangleFields(JNIEnv *env, jobject lpObject)
 {
 	if (GdkRectangleFc.cached) return;
-	GdkRectangleFc.clazz = (*env)->GetObjectClass(env, lpObject);
+	if (lpObject != NULL) {
+		GdkRectangleFc.clazz = (*env)->GetObjectClass(env, lpObject);
+	} else {
+		GdkRectangleFc.clazz = (*env)->FindClass(env, "org/eclipse/swt/internal/gtk/GdkRectangle");
+		if (GdkRectangleFc.clazz == NULL) return;
+	}
 	GdkRectangleFc.x = (*env)->GetFieldID(env, GdkRectangleFc.clazz, "x", "I");
 	GdkRectangleFc.y = (*env)->GetFieldID(env, GdkRectangleFc.clazz, "y", "I");
 	GdkRectangleFc.width = (*env)->GetFieldID(env, GdkRectangleFc.clazz, "width", "I");
@@ -2391,3 +2411,17 @@ void setXWindowChangesFields(JNIEnv *env, jobject lpObject, XWindowChanges *lpSt
 }
 #endif
 
+void cacheOSStructFields(JNIEnv *env)
+{
+#ifndef NO_GdkEventButton
+	cacheGdkEventButtonFields(env, NULL);
+#endif
+#ifndef NO_GdkEventMotion
+	cacheGdkEventMotionFields(env, NULL);
+#endif
+#ifndef NO_GdkRectangle
+	cacheGdkRectangleFields(env, NULL);
+#endif
+	(*env)->ExceptionClear(env);
+}
+
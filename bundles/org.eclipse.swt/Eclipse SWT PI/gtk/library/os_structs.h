@@ -615,3 +615,5 @@ void setXWindowChangesFields(JNIEnv *env, jobject lpObject, XWindowChanges *lpSt
 #define XWindowChanges_sizeof() 0
 #endif
 
+void cacheOSStructFields(JNIEnv *env);
+
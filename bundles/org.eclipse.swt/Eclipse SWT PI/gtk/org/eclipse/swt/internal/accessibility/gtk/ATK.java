@@ -289,6 +289,89 @@ public static final long /*int*/ ATK_VALUE_GET_IFACE (long /*int*/ handle) {
 		lock.unlock();
 	}
 }
+/**
+ * Queues the signal, which takes an AtkRectangle, for the object, replacing
+ * the rectangle of a queued one.
+ * @method flags=no_gen
+ */
+public static final native void _atk_event_queue_bounds (long /*int*/ accessible, byte[] signal, int x, int y, int width, int height);
+public static final void atk_event_queue_bounds (long /*int*/ accessible, byte[] signal, int x, int y, int width, int height) {
+	lock.lock();
+	try {
+		_atk_event_queue_bounds(accessible, signal, x, y, width, height);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * Emits the queued events now, so that the events emitted directly after
+ * this call are seen in order.
+ * @method flags=no_gen
+ */
+public static final native void _atk_event_queue_flush ();
+public static final void atk_event_queue_flush () {
+	lock.lock();
+	try {
+		_atk_event_queue_flush();
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * Queues a notification of the property of the object, unless one is queued.
+ * @method flags=no_gen
+ */
+public static final native void _atk_event_queue_notify (long /*int*/ accessible, byte[] property);
+public static final void atk_event_queue_notify (long /*int*/ accessible, byte[] property) {
+	lock.lock();
+	try {
+		_atk_event_queue_notify(accessible, property);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * Queues the signal, which takes no arguments, for the object, unless one
+ * is queued.
+ * @method flags=no_gen
+ */
+public static final native void _atk_event_queue_signal (long /*int*/ accessible, byte[] signal);
+public static final void atk_event_queue_signal (long /*int*/ accessible, byte[] signal) {
+	lock.lock();
+	try {
+		_atk_event_queue_signal(accessible, signal);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * Queues the signal, which takes an int, for the object, replacing the value
+ * of a queued one.
+ * @method flags=no_gen
+ */
+public static final native void _atk_event_queue_signal_int (long /*int*/ accessible, byte[] signal, int value);
+public static final void atk_event_queue_signal_int (long /*int*/ accessible, byte[] signal, int value) {
+	lock.lock();
+	try {
+		_atk_event_queue_signal_int(accessible, signal, value);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * Queues a change of the state of the object, replacing the value of a
+ * queued change of the same state.
+ * @method flags=no_gen
+ */
+public static final native void _atk_event_queue_state (long /*int*/ accessible, int state, boolean value);
+public static final void atk_event_queue_state (long /*int*/ accessible, int state, boolean value) {
+	lock.lock();
+	try {
+		_atk_event_queue_state(accessible, state, value);
+	} finally {
+		lock.unlock();
+	}
+}
 public static final native long /*int*/ _atk_get_default_registry ();
 public static final long /*int*/ atk_get_default_registry () {
 	lock.lock();
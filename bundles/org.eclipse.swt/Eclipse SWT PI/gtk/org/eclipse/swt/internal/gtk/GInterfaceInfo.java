@@ -22,5 +22,5 @@ public class GInterfaceInfo {
 	public long /*int*/ interface_finalize;
 	/** @field cast=(gpointer) */
 	public long /*int*/ interface_data;
-	public static final int sizeof = OS.GInterfaceInfo_sizeof();
+	public static final int sizeof = OS.sizeof("GInterfaceInfo");
 }
@@ -36,5 +36,5 @@ public class GTypeInfo {
 	public long /*int*/ instance_init;
 	/** @field cast=(GTypeValueTable *) */
 	public long /*int*/ value_table;
-	public static final int sizeof = OS.GTypeInfo_sizeof();	
+	public static final int sizeof = OS.sizeof("GTypeInfo");	
 }
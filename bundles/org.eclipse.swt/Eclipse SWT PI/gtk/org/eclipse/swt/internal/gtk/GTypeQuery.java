@@ -24,5 +24,5 @@ public class GTypeQuery {
 	public int class_size;
 	/** @field cast=(guint) */
 	public int instance_size;
-	public static final int sizeof = OS.GTypeQuery_sizeof();
+	public static final int sizeof = OS.sizeof("GTypeQuery");
 }
@@ -18,5 +18,5 @@ package org.eclipse.swt.internal.gtk;
 public class GdkEvent {
 	/** @field cast=(GdkEventType) */
 	public int type;
-	public static final int sizeof = OS.GdkEvent_sizeof();
+	public static final int sizeof = OS.sizeof("GdkEvent");
 }
@@ -15,6 +15,9 @@
 package org.eclipse.swt.internal.gtk;
 
 
+/**
+ * @jniclass flags=preload
+ */
 public class GdkEventButton extends GdkEvent {
 	/** @field cast=(GdkWindow *) */
 	public long /*int*/ window;
@@ -38,5 +41,5 @@ public class GdkEventButton extends GdkEvent {
 	public double x_root;
 	/** @field cast=(gdouble) */
 	public double y_root;
-	public static final int sizeof = OS.GdkEventButton_sizeof();
+	public static final int sizeof = OS.sizeof("GdkEventButton");
 }
@@ -15,6 +15,9 @@
 package org.eclipse.swt.internal.gtk;
 
 
+/**
+ * @jniclass flags=preload
+ */
 public class GdkEventMotion extends GdkEvent {
 	/** @field cast=(GdkWindow *) */
 	public long /*int*/ window;
@@ -38,5 +41,5 @@ public class GdkEventMotion extends GdkEvent {
 	public double x_root;
 	/** @field cast=(gdouble) */
 	public double y_root;
-	public static final int sizeof = OS.GdkEventMotion_sizeof();
+	public static final int sizeof = OS.sizeof("GdkEventMotion");
 }
@@ -25,5 +25,5 @@ public class GdkEventProperty extends GdkEvent {
 	public int time;
 	/** @field cast=(guint) */
 	public int state;
-	public static final int sizeof = OS.GdkEventProperty_sizeof();
+	public static final int sizeof = OS.sizeof("GdkEventProperty");
 }
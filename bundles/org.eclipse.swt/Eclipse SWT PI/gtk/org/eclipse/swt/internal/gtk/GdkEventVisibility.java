@@ -22,5 +22,5 @@ public class GdkEventVisibility extends GdkEvent {
 	public byte send_event; 
 	/** @field cast=(GdkVisibilityState) */
 	public int state;
-	public static final int sizeof = OS.GdkEventVisibility_sizeof();
+	public static final int sizeof = OS.sizeof("GdkEventVisibility");
 }
@@ -20,5 +20,5 @@ public class GdkRGBA {
 	public double green;
 	public double blue;
 	public double alpha;
-	public static final int sizeof = OS.GdkRGBA_sizeof();
+	public static final int sizeof = OS.sizeof("GdkRGBA");
 }
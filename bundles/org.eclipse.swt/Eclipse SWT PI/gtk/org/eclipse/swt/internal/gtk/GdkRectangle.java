@@ -15,6 +15,9 @@
 package org.eclipse.swt.internal.gtk;
 
 
+/**
+ * @jniclass flags=preload
+ */
 public class GdkRectangle {
 	/** @field cast=(gint) */
 	public int x;
@@ -24,5 +27,5 @@ public class GdkRectangle {
 	public int width;
 	/** @field cast=(gint) */
 	public int height;
-	public static final int sizeof = OS.GdkRectangle_sizeof();
+	public static final int sizeof = OS.sizeof("GdkRectangle");
 }
@@ -18,5 +18,5 @@ package org.eclipse.swt.internal.gtk;
 public class GtkRequisition {
 	public int width;
 	public int height;
-	public static final int sizeof = OS.GtkRequisition_sizeof();
+	public static final int sizeof = OS.sizeof("GtkRequisition");
 }
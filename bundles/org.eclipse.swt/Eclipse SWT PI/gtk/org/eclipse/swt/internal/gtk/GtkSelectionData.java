@@ -28,5 +28,5 @@ public class GtkSelectionData {
 	public long /*int*/  data;  
 	/** @field cast=(gint) */
 	public int  length;
-	public static final int sizeof = OS.GtkSelectionData_sizeof();
+	public static final int sizeof = OS.sizeof("GtkSelectionData");
 }
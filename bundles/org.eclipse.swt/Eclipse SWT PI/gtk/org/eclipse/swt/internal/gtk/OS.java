@@ -17,6 +17,7 @@ package org.eclipse.swt.internal.gtk;
 
 import org.eclipse.swt.internal.C;
 import org.eclipse.swt.internal.Library;
+import org.eclipse.swt.internal.Lock;
 
 public class OS extends C {
 	static {
@@ -44,6 +45,7 @@ public class OS extends C {
 				Library.loadLibrary("swt-pi");
 			}
 		}
+		cacheStructFields();
 	}
 	
 	/** OS Constants */
@@ -70,6 +72,21 @@ public class OS extends C {
 
 	/** Constants */
 	public static final long /*int*/ AnyPropertyType = 0;
+	/* Byte offsets into the buffer filled by decodeEvent() */
+	public static final int DECODE_TYPE = 0;
+	public static final int DECODE_WINDOW = 8;
+	public static final int DECODE_SEND_EVENT = 16;
+	public static final int DECODE_TIME = 24;
+	public static final int DECODE_STATE = 32;
+	public static final int DECODE_X = 40;
+	public static final int DECODE_Y = 48;
+	public static final int DECODE_X_ROOT = 56;
+	public static final int DECODE_Y_ROOT = 64;
+	public static final int DECODE_DETAIL = 72;
+	public static final int DECODE_KEYCODE = 80;
+	public static final int DECODE_MODE = 80;
+	public static final int DECODE_GROUP = 88;
+	public static final int DECODE_SIZE = 96;
 	public static final int G_FILE_TEST_IS_DIR = 1 << 2;
 	public static final int G_FILE_TEST_IS_EXECUTABLE = 1 << 3;
 	public static final int G_SIGNAL_MATCH_FUNC = 1 << 3;
@@ -714,6 +731,47 @@ public static final native int XExposeEvent_sizeof();
 public static final native int XFocusChangeEvent_sizeof();
 public static final native int XVisibilityEvent_sizeof();
 public static final native int XWindowChanges_sizeof();
+/**
+ * Answers the names of the structs with a *_sizeof native, separated by
+ * commas, and copies their sizes into <code>sizes</code> when it is large
+ * enough, so that all the sizes cost one call.
+ * @method flags=sizeof
+ */
+public static final native String sizeofs(int[] sizes);
+static String[] sizeofNames;
+static int[] sizeofSizes;
+
+/**
+ * Answers the size of the struct with the given name, from the sizes
+ * fetched at once by <code>sizeofs</code>.
+ *
+ * @exception UnsatisfiedLinkError if the struct is not known, as when it is compiled out of the library
+ */
+public static synchronized int sizeof (String name) {
+	if (sizeofNames == null) {
+		int[] sizes = new int [128];
+		String names = sizeofs (sizes);
+		int count = 0, index = 0;
+		while ((index = names.indexOf (',', index) + 1) > 0) count++;
+		if (count > sizes.length) {
+			sizes = new int [count];
+			sizeofs (sizes);
+		}
+		String[] result = new String [count];
+		int start = 0;
+		for (int i = 0; i < count; i++) {
+			int end = names.indexOf (',', start);
+			result [i] = names.substring (start, end);
+			start = end + 1;
+		}
+		sizeofSizes = sizes;
+		sizeofNames = result;
+	}
+	for (int i = 0; i < sizeofNames.length; i++) {
+		if (sizeofNames [i].equals (name)) return sizeofSizes [i];
+	}
+	throw new UnsatisfiedLinkError ("No size for struct " + name);
+}
 public static final native long /*int*/ localeconv_decimal_point();
 /**
  * @param path cast=(const char *)
@@ -866,6 +924,29 @@ public static final void call_get_size (long /*int*/ function, long /*int*/ arg0
 }
 /** @method flags=no_gen */
 public static final native boolean GDK_WINDOWING_X11();
+/*
+ * Answers a direct buffer over capacity bytes of native memory at address,
+ * or null when address is null.  The buffer does not own the memory and
+ * must not be used after it is freed.
+ */
+/** @method flags=no_gen */
+public static final native java.nio.ByteBuffer NewDirectByteBuffer(long /*int*/ address, int capacity);
+/* resolves the field IDs of the preload structs */
+/** @method flags=no_gen */
+public static final native void cacheStructFields();
+/*
+ * Copies the fields of the GdkEvent at event into a direct buffer of at
+ * least DECODE_SIZE bytes in native order.  The DECODE_X, DECODE_Y,
+ * DECODE_X_ROOT and DECODE_Y_ROOT slots hold doubles and the others longs.
+ * DECODE_DETAIL holds the button, is_hint, direction, crossing detail,
+ * keyval or focus in field, DECODE_KEYCODE the hardware_keycode of key
+ * events and DECODE_MODE the mode of crossing events.  Slots that do not
+ * apply to the event type are zero.  Returns false when event is null,
+ * in which case every slot is zero, or when the buffer is not direct or
+ * too small.
+ */
+/** @method flags=no_gen */
+public static final native boolean decodeEvent(long /*int*/ event, java.nio.ByteBuffer buffer);
 /** @param pixmap cast=(GdkPixmap *) */
 public static final native long /*int*/ _GDK_PIXMAP_XID(long /*int*/ pixmap);
 public static final long /*int*/ GDK_PIXMAP_XID(long /*int*/ pixmap) {
@@ -4616,54 +4697,69 @@ public static final long /*int*/ gdk_pixbuf_get_from_window(long /*int*/ window,
 		lock.unlock();
 	}
 }
-/** @param pixbuf cast=(const GdkPixbuf *) */
+/**
+ * @method lock=read
+ * @param pixbuf cast=(const GdkPixbuf *)
+ */
 public static final native boolean _gdk_pixbuf_get_has_alpha(long /*int*/ pixbuf);
 public static final boolean gdk_pixbuf_get_has_alpha(long /*int*/ pixbuf) {
-	lock.lock();
+	lock.lockRead();
 	try {
 		return _gdk_pixbuf_get_has_alpha(pixbuf);
 	} finally {
-		lock.unlock();
+		lock.unlockRead();
 	}
 }
-/** @param pixbuf cast=(const GdkPixbuf *) */
+/**
+ * @method flags=leaf,lock=read
+ * @param pixbuf cast=(const GdkPixbuf *)
+ */
 public static final native int _gdk_pixbuf_get_height(long /*int*/ pixbuf);
 public static final int gdk_pixbuf_get_height(long /*int*/ pixbuf) {
-	lock.lock();
+	lock.lockRead();
 	try {
 		return _gdk_pixbuf_get_height(pixbuf);
 	} finally {
-		lock.unlock();
+		lock.unlockRead();
 	}
 }
-/** @param pixbuf cast=(const GdkPixbuf *) */
+/**
+ * @method lock=read
+ * @param pixbuf cast=(const GdkPixbuf *)
+ */
 public static final native long /*int*/ _gdk_pixbuf_get_pixels(long /*int*/ pixbuf);
 public static final long /*int*/ gdk_pixbuf_get_pixels(long /*int*/ pixbuf) {
-	lock.lock();
+	lock.lockRead();
 	try {
 		return _gdk_pixbuf_get_pixels(pixbuf);
 	} finally {
-		lock.unlock();
+		lock.unlockRead();
 	}
 }
-/** @param pixbuf cast=(const GdkPixbuf *) */
+/**
+ * @method lock=read
+ * @param pixbuf cast=(const GdkPixbuf *)
+ */
 public static final native int _gdk_pixbuf_get_rowstride(long /*int*/ pixbuf);
 public static final int gdk_pixbuf_get_rowstride(long /*int*/ pixbuf) {
-	lock.lock();
+	lock.lockRead();
 	try {
 		return _gdk_pixbuf_get_rowstride(pixbuf);
 	} finally {
-		lock.unlock();
+		lock.unlockRead();
 	}
 }
-/** @param pixbuf cast=(const GdkPixbuf *) */
+/**
+ * @method flags=leaf,lock=read
+ * @param pixbuf cast=(const GdkPixbuf *)
+ */
 public static final native int _gdk_pixbuf_get_width(long /*int*/ pixbuf);
 public static final int gdk_pixbuf_get_width(long /*int*/ pixbuf) {
-	lock.lock();
+	lock.lockRead();
 	try {
 		return _gdk_pixbuf_get_width(pixbuf);
 	} finally {
-		lock.unlock();
+		lock.unlockRead();
 	}
 }
 public static final native long /*int*/ _gdk_pixbuf_loader_new();
@@ -4676,11 +4772,13 @@ public static final long /*int*/ gdk_pixbuf_loader_new() {
 	}
 }
 /**
+ * @method lock=object
  * @param loader cast=(GdkPixbufLoader *)
  * @param error cast=(GError **)
  */
 public static final native boolean _gdk_pixbuf_loader_close(long /*int*/ loader, long /*int*/ [] error);
 public static final boolean gdk_pixbuf_loader_close(long /*int*/ loader, long /*int*/ [] error) {
+	Lock lock = Lock.forObject(loader);
 	lock.lock();
 	try {
 		return _gdk_pixbuf_loader_close(loader, error);
@@ -4688,9 +4786,13 @@ public static final boolean gdk_pixbuf_loader_close(long /*int*/ loader, long /*
 		lock.unlock();
 	}
 }
-/** @param loader cast=(GdkPixbufLoader *) */
+/**
+ * @method lock=object
+ * @param loader cast=(GdkPixbufLoader *)
+ */
 public static final native long /*int*/ _gdk_pixbuf_loader_get_pixbuf(long /*int*/ loader);
 public static final long /*int*/ gdk_pixbuf_loader_get_pixbuf(long /*int*/ loader) {
+	Lock lock = Lock.forObject(loader);
 	lock.lock();
 	try {
 		return _gdk_pixbuf_loader_get_pixbuf(loader);
@@ -4699,6 +4801,7 @@ public static final long /*int*/ gdk_pixbuf_loader_get_pixbuf(long /*int*/ loade
 	}
 }
 /**
+ * @method lock=object
  * @param loader cast=(GdkPixbufLoader *)
  * @param buffer cast=(const guchar *)
  * @param count cast=(gsize)
@@ -4706,6 +4809,7 @@ public static final long /*int*/ gdk_pixbuf_loader_get_pixbuf(long /*int*/ loade
  */
 public static final native boolean _gdk_pixbuf_loader_write(long /*int*/ loader, long /*int*/ buffer, int count, long /*int*/ [] error);
 public static final boolean gdk_pixbuf_loader_write(long /*int*/ loader, long /*int*/ buffer, int count, long /*int*/ [] error) {
+	Lock lock = Lock.forObject(loader);
 	lock.lock();
 	try {
 		return _gdk_pixbuf_loader_write(loader, buffer, count, error);
@@ -5019,7 +5123,10 @@ public static final boolean gdk_region_point_in(long /*int*/ region, int x, int
 		lock.unlock();
 	}
 }
-/** @method flags=dynamic */
+/**
+ * @method flags=dynamic
+ * @param points flags=no_out critical
+ */
 public static final native long /*int*/ _gdk_region_polygon(int[] points, int npoints, int fill_rule);
 public static final long /*int*/ gdk_region_polygon(int[] points, int npoints, int fill_rule) {
 	lock.lock();
@@ -5543,6 +5650,21 @@ public static final void gdk_window_move(long /*int*/ window, int x, int y) {
 		lock.unlock();
 	}
 }
+/**
+ * @method flags=dynamic
+ * @param window cast=(GdkWindow *)
+ * @param dx cast=(gint)
+ * @param dy cast=(gint)
+ */
+public static final native void _gdk_window_move_region(long /*int*/ window, long /*int*/ region, int dx, int dy);
+public static final void gdk_window_move_region(long /*int*/ window, long /*int*/ region, int dx, int dy) {
+	lock.lock();
+	try {
+		_gdk_window_move_region(window, region, dx, dy);
+	} finally {
+		lock.unlock();
+	}
+}
 /** @param window cast=(GdkWindow *) */
 public static final native void _gdk_window_move_resize(long /*int*/ window, int x, int y, int width, int height);
 public static final void gdk_window_move_resize(long /*int*/ window, int x, int y, int width, int height) {
@@ -6444,6 +6566,21 @@ public static final long /*int*/ gtk_clipboard_get(long /*int*/ selection) {
 		lock.unlock();
 	}
 }
+/**
+ * @param clipboard cast=(GtkClipboard *)
+ * @param target cast=(GdkAtom)
+ * @param callback cast=(GtkClipboardReceivedFunc)
+ * @param user_data cast=(gpointer)
+ */
+public static final native void _gtk_clipboard_request_contents(long /*int*/ clipboard, long /*int*/ target, long /*int*/ callback, long /*int*/ user_data);
+public static final void gtk_clipboard_request_contents(long /*int*/ clipboard, long /*int*/ target, long /*int*/ callback, long /*int*/ user_data) {
+	lock.lock();
+	try {
+		_gtk_clipboard_request_contents(clipboard, target, callback, user_data);
+	} finally {
+		lock.unlock();
+	}
+}
 /**
  * @param clipboard cast=(GtkClipboard *)
  * @param target cast=(const GtkTargetEntry *)
@@ -16150,6 +16287,208 @@ public static final int access (byte [] path, int amode) {
  */
 public static final native int strcmp (long /*int*/ s1, byte [] s2);
 
+/**
+ * @param cache cast=(SwtCellCache *)
+ * @param model cast=(GtkTreeModel *)
+ * @param iter cast=(GtkTreeIter *)
+ * @param handle cast=(GtkTreeIter *)
+ */
+public static final native void _swt_cell_cache_add(long /*int*/ cache, long /*int*/ model, long /*int*/ iter, long /*int*/ handle);
+public static final void swt_cell_cache_add(long /*int*/ cache, long /*int*/ model, long /*int*/ iter, long /*int*/ handle) {
+	lock.lock();
+	try {
+		_swt_cell_cache_add(cache, model, iter, handle);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param cache cast=(SwtCellCache *)
+ */
+public static final native void _swt_cell_cache_clear(long /*int*/ cache);
+public static final void swt_cell_cache_clear(long /*int*/ cache) {
+	lock.lock();
+	try {
+		_swt_cell_cache_clear(cache);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param cache cast=(SwtCellCache *)
+ */
+public static final native void _swt_cell_cache_free(long /*int*/ cache);
+public static final void swt_cell_cache_free(long /*int*/ cache) {
+	lock.lock();
+	try {
+		_swt_cell_cache_free(cache);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param func cast=(GtkTreeCellDataFunc)
+ * @param data cast=(gpointer)
+ * @param quark cast=(GQuark)
+ * @param id_column cast=(gint)
+ */
+public static final native long /*int*/ _swt_cell_cache_new(long /*int*/ func, long /*int*/ data, int quark, int id_column);
+public static final long /*int*/ swt_cell_cache_new(long /*int*/ func, long /*int*/ data, int quark, int id_column) {
+	lock.lock();
+	try {
+		return _swt_cell_cache_new(func, data, quark, id_column);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param cache cast=(SwtCellCache *)
+ * @param model cast=(GtkTreeModel *)
+ * @param iter cast=(GtkTreeIter *)
+ */
+public static final native void _swt_cell_cache_remove(long /*int*/ cache, long /*int*/ model, long /*int*/ iter);
+public static final void swt_cell_cache_remove(long /*int*/ cache, long /*int*/ model, long /*int*/ iter) {
+	lock.lock();
+	try {
+		_swt_cell_cache_remove(cache, model, iter);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param cache cast=(SwtCellCache *)
+ * @param column cast=(GtkTreeViewColumn *)
+ * @param cell cast=(GtkCellRenderer *)
+ * @param foreground cast=(gint)
+ * @param background cast=(gint)
+ * @param font cast=(gint)
+ */
+public static final native void _swt_cell_cache_set_data_func(long /*int*/ cache, long /*int*/ column, long /*int*/ cell, int foreground, int background, int font);
+public static final void swt_cell_cache_set_data_func(long /*int*/ cache, long /*int*/ column, long /*int*/ cell, int foreground, int background, int font) {
+	lock.lock();
+	try {
+		_swt_cell_cache_set_data_func(cache, column, cell, foreground, background, font);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param instance cast=(GObject *)
+ * @param id cast=(gint)
+ * @param mute cast=(gboolean)
+ */
+public static final native void _swt_closure_mute(long /*int*/ instance, int id, boolean mute);
+public static final void swt_closure_mute(long /*int*/ instance, int id, boolean mute) {
+	lock.lock();
+	try {
+		_swt_closure_mute(instance, id, mute);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param callback cast=(GCallback)
+ * @param id cast=(gint)
+ */
+public static final native long /*int*/ _swt_closure_new(long /*int*/ callback, int id);
+public static final long /*int*/ swt_closure_new(long /*int*/ callback, int id) {
+	lock.lock();
+	try {
+		return _swt_closure_new(callback, id);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @param muting cast=(gboolean) */
+public static final native void _swt_closure_set_muting(boolean muting);
+public static final void swt_closure_set_muting(boolean muting) {
+	lock.lock();
+	try {
+		_swt_closure_set_muting(muting);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @param queue cast=(SwtDecodeQueue *) */
+public static final native void _swt_decode_queue_free(long /*int*/ queue);
+public static final void swt_decode_queue_free(long /*int*/ queue) {
+	lock.lock();
+	try {
+		_swt_decode_queue_free(queue);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @param max_threads cast=(gint) */
+public static final native long /*int*/ _swt_decode_queue_new(int max_threads);
+public static final long /*int*/ swt_decode_queue_new(int max_threads) {
+	lock.lock();
+	try {
+		return _swt_decode_queue_new(max_threads);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param queue cast=(SwtDecodeQueue *)
+ * @param id cast=(gintptr *)
+ */
+public static final native long /*int*/ _swt_decode_queue_pop(long /*int*/ queue, long /*int*/[] id);
+public static final long /*int*/ swt_decode_queue_pop(long /*int*/ queue, long /*int*/[] id) {
+	lock.lock();
+	try {
+		return _swt_decode_queue_pop(queue, id);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param queue cast=(SwtDecodeQueue *)
+ * @param id cast=(gintptr)
+ * @param data cast=(const guchar *),flags=no_out critical
+ * @param length cast=(gsize)
+ * @param width cast=(gint)
+ * @param height cast=(gint)
+ */
+public static final native void _swt_decode_queue_push_data(long /*int*/ queue, long /*int*/ id, byte[] data, long /*int*/ length, int width, int height);
+public static final void swt_decode_queue_push_data(long /*int*/ queue, long /*int*/ id, byte[] data, long /*int*/ length, int width, int height) {
+	lock.lock();
+	try {
+		_swt_decode_queue_push_data(queue, id, data, length, width, height);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param queue cast=(SwtDecodeQueue *)
+ * @param id cast=(gintptr)
+ * @param filename cast=(const gchar *),flags=no_out
+ * @param width cast=(gint)
+ * @param height cast=(gint)
+ */
+public static final native void _swt_decode_queue_push_file(long /*int*/ queue, long /*int*/ id, byte[] filename, int width, int height);
+public static final void swt_decode_queue_push_file(long /*int*/ queue, long /*int*/ id, byte[] filename, int width, int height) {
+	lock.lock();
+	try {
+		_swt_decode_queue_push_file(queue, id, filename, width, height);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param func cast=(GdkEventFunc)
+ * @param data cast=(gpointer)
+ * @param notify cast=(GDestroyNotify)
+ */
+public static final native void _swt_event_handler_set(long /*int*/ func, long /*int*/ data, long /*int*/ notify);
+public static final void swt_event_handler_set(long /*int*/ func, long /*int*/ data, long /*int*/ notify) {
+	lock.lock();
+	try {
+		_swt_event_handler_set(func, data, notify);
+	} finally {
+		lock.unlock();
+	}
+}
 public static final native long /*int*/ _swt_fixed_get_type();
 public static final long /*int*/ swt_fixed_get_type() {
 	lock.lock();
@@ -16199,4 +16538,225 @@ public static final void swt_fixed_resize(long /*int*/ fixed, long /*int*/ widge
 		lock.unlock();
 	}
 }
+/** @param index cast=(SwtOffsetIndex *) */
+public static final native void _swt_offset_index_free(long /*int*/ index);
+public static final void swt_offset_index_free(long /*int*/ index) {
+	lock.lock();
+	try {
+		_swt_offset_index_free(index);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @param buffer cast=(GtkTextBuffer *) */
+public static final native long /*int*/ _swt_offset_index_new(long /*int*/ buffer);
+public static final long /*int*/ swt_offset_index_new(long /*int*/ buffer) {
+	lock.lock();
+	try {
+		return _swt_offset_index_new(buffer);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @param index cast=(SwtOffsetIndex *) */
+public static final native long /*int*/ _swt_offset_index_utf16_to_utf8(long /*int*/ index, long /*int*/ offset);
+public static final long /*int*/ swt_offset_index_utf16_to_utf8(long /*int*/ index, long /*int*/ offset) {
+	lock.lock();
+	try {
+		return _swt_offset_index_utf16_to_utf8(index, offset);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @param index cast=(SwtOffsetIndex *) */
+public static final native long /*int*/ _swt_offset_index_utf8_to_utf16(long /*int*/ index, long /*int*/ offset);
+public static final long /*int*/ swt_offset_index_utf8_to_utf16(long /*int*/ index, long /*int*/ offset) {
+	lock.lock();
+	try {
+		return _swt_offset_index_utf8_to_utf16(index, offset);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param layout cast=(PangoLayout *)
+ * @param lines cast=(gint *)
+ */
+public static final native int _swt_pango_layout_get_lines(long /*int*/ layout, int[] lines, int count);
+public static final int swt_pango_layout_get_lines(long /*int*/ layout, int[] lines, int count) {
+	lock.lock();
+	try {
+		return _swt_pango_layout_get_lines(layout, lines, count);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param rects cast=(gint *),flags=no_out
+ * @param count cast=(gint)
+ */
+public static final native long /*int*/ _swt_region_new_rectangles(int[] rects, int count);
+public static final long /*int*/ swt_region_new_rectangles(int[] rects, int count) {
+	lock.lock();
+	try {
+		return _swt_region_new_rectangles(rects, count);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param buffer cast=(GtkTextBuffer *)
+ * @param view cast=(GtkTextView *)
+ * @param text cast=(const gchar *),flags=no_out
+ * @param length cast=(gint)
+ * @param replace cast=(gboolean)
+ */
+public static final native void _swt_text_buffer_insert(long /*int*/ buffer, long /*int*/ view, byte[] text, int length, boolean replace);
+public static final void swt_text_buffer_insert(long /*int*/ buffer, long /*int*/ view, byte[] text, int length, boolean replace) {
+	lock.lock();
+	try {
+		_swt_text_buffer_insert(buffer, view, text, length, replace);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param queue cast=(SwtTimerQueue *)
+ * @param id cast=(gint)
+ * @param milliseconds cast=(guint)
+ */
+public static final native void _swt_timer_queue_add(long /*int*/ queue, int id, int milliseconds);
+public static final void swt_timer_queue_add(long /*int*/ queue, int id, int milliseconds) {
+	lock.lock();
+	try {
+		_swt_timer_queue_add(queue, id, milliseconds);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @param queue cast=(SwtTimerQueue *) */
+public static final native void _swt_timer_queue_free(long /*int*/ queue);
+public static final void swt_timer_queue_free(long /*int*/ queue) {
+	lock.lock();
+	try {
+		_swt_timer_queue_free(queue);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param func cast=(GSourceFunc)
+ * @param data cast=(gpointer)
+ */
+public static final native long /*int*/ _swt_timer_queue_new(long /*int*/ func, long /*int*/ data);
+public static final long /*int*/ swt_timer_queue_new(long /*int*/ func, long /*int*/ data) {
+	lock.lock();
+	try {
+		return _swt_timer_queue_new(func, data);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param queue cast=(SwtTimerQueue *)
+ * @param ids cast=(gint *)
+ * @param count cast=(gint)
+ */
+public static final native int _swt_timer_queue_pop(long /*int*/ queue, int[] ids, int count);
+public static final int swt_timer_queue_pop(long /*int*/ queue, int[] ids, int count) {
+	lock.lock();
+	try {
+		return _swt_timer_queue_pop(queue, ids, count);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param queue cast=(SwtTimerQueue *)
+ * @param id cast=(gint)
+ */
+public static final native void _swt_timer_queue_remove(long /*int*/ queue, int id);
+public static final void swt_timer_queue_remove(long /*int*/ queue, int id) {
+	lock.lock();
+	try {
+		_swt_timer_queue_remove(queue, id);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param view cast=(GtkTreeView *)
+ * @param model cast=(GtkTreeModel *)
+ * @param parent cast=(GtkTreeIter *)
+ * @param index cast=(gint)
+ * @param count cast=(gint)
+ * @param n_columns cast=(gint)
+ * @param columns cast=(gint *),flags=no_out
+ * @param values cast=(gintptr *),flags=no_out
+ * @param strings cast=(const gchar *),flags=no_out
+ * @param iters cast=(gintptr *)
+ */
+public static final native void _swt_tree_model_insert_rows(long /*int*/ view, long /*int*/ model, long /*int*/ parent, int index, int count, int n_columns, int[] columns, long /*int*/[] values, byte[] strings, long /*int*/[] iters);
+public static final void swt_tree_model_insert_rows(long /*int*/ view, long /*int*/ model, long /*int*/ parent, int index, int count, int n_columns, int[] columns, long /*int*/[] values, byte[] strings, long /*int*/[] iters) {
+	lock.lock();
+	try {
+		_swt_tree_model_insert_rows(view, model, parent, index, count, n_columns, columns, values, strings, iters);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @param data cast=(const gchar *)
+ * @param length cast=(gint)
+ * @param gnome_list cast=(gboolean)
+ * @param items_written cast=(gint *)
+ */
+public static final native long /*int*/ _swt_uri_list_to_utf16(long /*int*/ data, int length, boolean gnome_list, int[] items_written);
+public static final long /*int*/ swt_uri_list_to_utf16(long /*int*/ data, int length, boolean gnome_list, int[] items_written) {
+	lock.lock();
+	try {
+		return _swt_uri_list_to_utf16(data, length, gnome_list, items_written);
+	} finally {
+		lock.unlock();
+	}
+}
+/** @param source cast=(SwtWakeSource *) */
+public static final native void _swt_wake_source_free(long /*int*/ source);
+public static final void swt_wake_source_free(long /*int*/ source) {
+	lock.lock();
+	try {
+		_swt_wake_source_free(source);
+	} finally {
+		lock.unlock();
+	}
+}
+public static final native long /*int*/ _swt_wake_source_new();
+public static final long /*int*/ swt_wake_source_new() {
+	lock.lock();
+	try {
+		return _swt_wake_source_new();
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * Called from other threads without the lock, like g_main_context_wakeup().
+ *
+ * @param source cast=(SwtWakeSource *)
+ */
+public static final native void swt_wake_source_signal(long /*int*/ source);
+/**
+ * @param widgets cast=(GtkWidget **),flags=no_out
+ * @param allocations cast=(gint *),flags=no_out
+ * @param count cast=(gint)
+ */
+public static final native void _swt_widget_size_allocate_batch(long /*int*/[] widgets, int[] allocations, int count);
+public static final void swt_widget_size_allocate_batch(long /*int*/[] widgets, int[] allocations, int count) {
+	lock.lock();
+	try {
+		_swt_widget_size_allocate_batch(widgets, allocations, count);
+	} finally {
+		lock.unlock();
+	}
+}
 }
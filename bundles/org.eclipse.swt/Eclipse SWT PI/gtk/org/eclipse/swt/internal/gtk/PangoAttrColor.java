@@ -22,5 +22,5 @@ public class PangoAttrColor extends PangoAttribute {
 	public short color_green;
 	/** @field accessor=color.blue */
 	public short color_blue;
-	public static final int sizeof = OS.PangoAttrColor_sizeof();
+	public static final int sizeof = OS.sizeof("PangoAttrColor");
 }
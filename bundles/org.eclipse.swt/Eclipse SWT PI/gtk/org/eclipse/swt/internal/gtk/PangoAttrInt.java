@@ -17,5 +17,5 @@ package org.eclipse.swt.internal.gtk;
 
 public class PangoAttrInt extends PangoAttribute {
 	public int value;
-	public static final int sizeof = OS.PangoAttrInt_sizeof();
+	public static final int sizeof = OS.sizeof("PangoAttrInt");
 }
@@ -20,5 +20,5 @@ public class PangoAttribute {
 	public long /*int*/ klass;
 	public int start_index;
 	public int end_index;
-	public static final int sizeof = OS.PangoAttribute_sizeof();
+	public static final int sizeof = OS.sizeof("PangoAttribute");
 }
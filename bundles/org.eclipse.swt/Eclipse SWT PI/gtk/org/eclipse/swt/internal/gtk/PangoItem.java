@@ -30,5 +30,5 @@ public class PangoItem {
 	public long /*int*/ analysis_language;
 	/** @field accessor=analysis.extra_attrs,cast=(GSList *) */
 	public long /*int*/ analysis_extra_attrs;
-	public static final int sizeof = OS.PangoItem_sizeof();
+	public static final int sizeof = OS.sizeof("PangoItem");
 }
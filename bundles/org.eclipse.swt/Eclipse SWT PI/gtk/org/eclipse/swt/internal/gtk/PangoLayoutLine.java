@@ -23,5 +23,5 @@ public class PangoLayoutLine {
 	public long /*int*/ runs;
 //	public boolean is_paragraph_start;
 //	public byte resolved_dir;
-	public static final int sizeof = OS.PangoLayoutLine_sizeof();
+	public static final int sizeof = OS.sizeof("PangoLayoutLine");
 }
@@ -19,5 +19,5 @@ public class PangoLayoutRun {
 	public long /*int*/ item;
 	/** @field cast=(PangoGlyphString *) */
 	public long /*int*/ glyphs;
-	public static final int sizeof = OS.PangoLayoutRun_sizeof();
+	public static final int sizeof = OS.sizeof("PangoLayoutRun");
 }
@@ -26,5 +26,5 @@ public class PangoLogAttr {
 	public boolean is_sentence_boundary;
 	public boolean is_sentence_start;
 	public boolean is_sentence_end;
-	public static final int sizeof = OS.PangoLogAttr_sizeof();
+	public static final int sizeof = OS.sizeof("PangoLogAttr");
 }
@@ -20,5 +20,5 @@ public class PangoRectangle {
 	public int y;
 	public int width;
 	public int height;
-	public static final int sizeof = OS.PangoRectangle_sizeof();
+	public static final int sizeof = OS.sizeof("PangoRectangle");
 }
@@ -18,5 +18,5 @@ public abstract class XAnyEvent extends XEvent {
 	public long /*int*/ display;
 	/** @field cast=(Window) */
 	public long /*int*/ window;
-	public static final int sizeof = OS.XAnyEvent_sizeof();
+	public static final int sizeof = OS.sizeof("XAnyEvent");
 }
@@ -13,5 +13,5 @@ package org.eclipse.swt.internal.gtk;
  
 public class XEvent {
 	public int type;
-	public static final int sizeof = OS.XEvent_sizeof();
+	public static final int sizeof = OS.sizeof("XEvent");
 }
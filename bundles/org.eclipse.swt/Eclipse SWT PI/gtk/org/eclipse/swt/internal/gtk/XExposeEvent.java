@@ -17,5 +17,5 @@ public class XExposeEvent extends XAnyEvent {
 	public int width;
 	public int height;
 	public int count;
-	public static final int sizeof = OS.XExposeEvent_sizeof();
+	public static final int sizeof = OS.sizeof("XExposeEvent");
 }
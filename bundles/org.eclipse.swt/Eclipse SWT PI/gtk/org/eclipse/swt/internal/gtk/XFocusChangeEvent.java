@@ -14,5 +14,5 @@ package org.eclipse.swt.internal.gtk;
 public class XFocusChangeEvent extends XAnyEvent {
 	public int mode;
 	public int detail;
-	public static final int sizeof = OS.XFocusChangeEvent_sizeof();
+	public static final int sizeof = OS.sizeof("XFocusChangeEvent");
 }
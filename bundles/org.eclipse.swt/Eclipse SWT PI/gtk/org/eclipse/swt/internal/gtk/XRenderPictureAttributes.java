@@ -25,5 +25,5 @@ public class XRenderPictureAttributes {
 	public int poly_mode;
 	public long /*int*/ dither;
 	public boolean component_alpha;
-	public static final int sizeof = OS.XRenderPictureAttributes_sizeof();
+	public static final int sizeof = OS.sizeof("XRenderPictureAttributes");
 }
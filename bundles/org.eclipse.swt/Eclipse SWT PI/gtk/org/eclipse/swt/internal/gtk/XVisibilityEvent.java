@@ -13,5 +13,5 @@ package org.eclipse.swt.internal.gtk;
  
 public class XVisibilityEvent extends XAnyEvent {
 	public int state;
-	public static final int sizeof = OS.XVisibilityEvent_sizeof();
+	public static final int sizeof = OS.sizeof("XVisibilityEvent");
 }
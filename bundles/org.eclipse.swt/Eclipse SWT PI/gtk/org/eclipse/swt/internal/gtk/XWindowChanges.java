@@ -19,5 +19,5 @@ public class XWindowChanges {
 	public int border_width;
 	public long /*int*/ sibling;
 	public int stack_mode;
-	public static final int sizeof = OS.XWindowChanges_sizeof();
+	public static final int sizeof = OS.sizeof("XWindowChanges");
 }
@@ -26,7 +26,7 @@ SWT_VERSION=$(maj_ver)$(min_ver)
 SWT_PREFIX = swt
 WS_PREFIX = motif
 SWT_LIB = lib$(SWT_PREFIX)-$(WS_PREFIX)-$(SWT_VERSION).so
-SWT_OBJS = swt.o c.o c_stats.o callback.o os.o os_structs.o os_custom.o os_stats.o
+SWT_OBJS = swt.o c.o c_stats.o callback.o blit.o transcode.o pngfilter.o lzw.o tiff.o benchmark.o watchdog.o arena.o pool.o os.o os_structs.o os_custom.o os_stats.o
 SWT_LIBS = -L$(MOTIF_HOME)/lib -L/usr/lib -R/usr/openwin/lib -G -lXm -lXt -lX11 -lXp -lXtst
 
 CDE_PREFIX = swt-cde
@@ -46,7 +46,7 @@ AWT_LIBS = -G -L$(JAVA_HOME)/jre/lib/sparc -ljawt
 
 CAIRO_PREFIX = swt-cairo
 CAIRO_LIB = lib$(CAIRO_PREFIX)-$(WS_PREFIX)-$(SWT_VERSION).so
-CAIRO_OBJS = swt.o cairo.o cairo_structs.o cairo_stats.o
+CAIRO_OBJS = swt.o cairo.o cairo_structs.o cairo_custom.o cairo_stats.o
 CAIROCFLAGS = `pkg-config --cflags cairo`
 CAIRO_LIBS = -G `pkg-config --libs-only-L cairo` -lcairo
 
@@ -90,6 +90,8 @@ $(CAIRO_LIB): $(CAIRO_OBJS)
 
 cairo.o: cairo.c cairo.h swt.h
 	$(CC)  $(CAIROCFLAGS)  $(CFLAGS) -c cairo.c
+cairo_custom.o: cairo_custom.c cairo_structs.h cairo.h swt.h
+	$(CC)  $(CAIROCFLAGS)  $(CFLAGS) -c cairo_custom.c
 cairo_structs.o: cairo_structs.c cairo_structs.h cairo.h swt.h
 	$(CC)  $(CAIROCFLAGS)  $(CFLAGS) -c cairo_structs.c
 cairo_stats.o: cairo_stats.c cairo_structs.h cairo.h cairo_stats.h swt.h
@@ -5486,7 +5486,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(_1access)
 	if (arg0) if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jint)access((const char*)lparg0, arg1);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, _1access_FUNC);
 	return rc;
 }
@@ -5526,7 +5526,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(_1dlopen)
 	if (arg0) if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jintLong)dlopen((const char *)lparg0, arg1);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, _1dlopen_FUNC);
 	return rc;
 }
@@ -5542,7 +5542,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(_1dlsym)
 	if (arg1) if ((lparg1 = (*env)->GetByteArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	rc = (jintLong)dlsym((void *)arg0, (const char *)lparg1);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, _1dlsym_FUNC);
 	return rc;
 }
@@ -5681,8 +5681,8 @@ JNIEXPORT jint JNICALL OS_NATIVE(iconv_1open)
 	if (arg1) if ((lparg1 = (*env)->GetByteArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	rc = (jint)iconv_open((const char *)lparg0, (const char *)lparg1);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, iconv_1open_FUNC);
 	return rc;
 }
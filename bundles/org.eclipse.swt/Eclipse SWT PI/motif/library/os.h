@@ -32,6 +32,16 @@
 #include <X11/extensions/XTest.h>
 #endif
 
+#ifdef _HPUX
+#define NO__1XShmImageCreate
+#define NO__1XShmImageDestroy
+#define NO__1XShmImagePut
+#else
+#include <X11/extensions/XShm.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#endif
+
 #ifdef NO_XINERAMA_EXTENSIONS
 #define NO_XineramaScreenInfo
 #define NO__1XineramaIsActive
@@ -59,6 +69,7 @@ XtAppContext _XtDefaultAppContext();
 #include <locale.h>
 #include <iconv.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #ifdef	_HPUX
 #include <sys/time.h>
@@ -78,3 +78,233 @@ failTag:
 	OS_NATIVE_EXIT(env, that, _1XtGetValues_FUNC)
 }
 #endif
+
+#ifndef NO__1XtAppNextEventCoalesced
+/*
+* Answers the next event like XtAppNextEvent(), but folds the MotionNotify
+* or Expose events for the same window that are already queued right behind
+* it into it: the last motion, or the union of the exposed areas. Only the
+* events that were already read from the connection are looked at, so this
+* never waits for the server, and events are never reordered.
+*/
+JNIEXPORT void JNICALL OS_NATIVE(_1XtAppNextEventCoalesced)
+	(JNIEnv *env, jclass that, jint appContext, jint event)
+{
+	XEvent *xEvent = (XEvent *)event;
+	XEvent next;
+	Display *display;
+	OS_NATIVE_ENTER(env, that, _1XtAppNextEventCoalesced_FUNC)
+	XtAppNextEvent((XtAppContext)appContext, xEvent);
+	display = xEvent->xany.display;
+	switch (xEvent->type) {
+		case MotionNotify:
+			while (XEventsQueued(display, QueuedAlready) > 0) {
+				XPeekEvent(display, &next);
+				if (next.type != MotionNotify) break;
+				if (next.xmotion.window != xEvent->xmotion.window) break;
+				if (next.xmotion.state != xEvent->xmotion.state) break;
+				XNextEvent(display, xEvent);
+			}
+			break;
+		case Expose:
+			while (XEventsQueued(display, QueuedAlready) > 0) {
+				int x, y, right, bottom;
+				XPeekEvent(display, &next);
+				if (next.type != Expose) break;
+				if (next.xexpose.window != xEvent->xexpose.window) break;
+				XNextEvent(display, &next);
+				x = next.xexpose.x < xEvent->xexpose.x ? next.xexpose.x : xEvent->xexpose.x;
+				y = next.xexpose.y < xEvent->xexpose.y ? next.xexpose.y : xEvent->xexpose.y;
+				right = next.xexpose.x + next.xexpose.width;
+				if (right < xEvent->xexpose.x + xEvent->xexpose.width) right = xEvent->xexpose.x + xEvent->xexpose.width;
+				bottom = next.xexpose.y + next.xexpose.height;
+				if (bottom < xEvent->xexpose.y + xEvent->xexpose.height) bottom = xEvent->xexpose.y + xEvent->xexpose.height;
+				xEvent->xexpose.x = x;
+				xEvent->xexpose.y = y;
+				xEvent->xexpose.width = right - x;
+				xEvent->xexpose.height = bottom - y;
+				xEvent->xexpose.count = next.xexpose.count;
+				xEvent->xexpose.serial = next.xexpose.serial;
+			}
+			break;
+	}
+	OS_NATIVE_EXIT(env, that, _1XtAppNextEventCoalesced_FUNC)
+}
+#endif
+
+#ifndef NO__1XShmImageCreate
+/*
+* MIT-SHM images. The pixels of an XImage created in shared memory reach a
+* local X server without being written to the connection. The extension is
+* loaded dynamically since not every platform links libXext, and is only
+* used once a segment was attached successfully, which fails on a remote
+* display even when the server has the extension.
+*/
+#define SHM_DISPLAYS 4
+
+static Display *shmDisplays[SHM_DISPLAYS];
+static int shmUsable[SHM_DISPLAYS];
+static int shmError;
+
+static Bool shmQueryExtension(Display *display)
+{
+	OS_LOAD_FUNCTION(fp, XShmQueryExtension)
+	if (fp == NULL) return False;
+	return ((Bool (*)(Display *))fp)(display);
+}
+
+static Bool shmAttach(Display *display, XShmSegmentInfo *info)
+{
+	OS_LOAD_FUNCTION(fp, XShmAttach)
+	if (fp == NULL) return False;
+	return ((Bool (*)(Display *, XShmSegmentInfo *))fp)(display, info);
+}
+
+static Bool shmDetach(Display *display, XShmSegmentInfo *info)
+{
+	OS_LOAD_FUNCTION(fp, XShmDetach)
+	if (fp == NULL) return False;
+	return ((Bool (*)(Display *, XShmSegmentInfo *))fp)(display, info);
+}
+
+static XImage *shmCreateImage(Display *display, Visual *visual, unsigned int depth, int format, XShmSegmentInfo *info, unsigned int width, unsigned int height)
+{
+	OS_LOAD_FUNCTION(fp, XShmCreateImage)
+	if (fp == NULL) return NULL;
+	return ((XImage *(*)(Display *, Visual *, unsigned int, int, char *, XShmSegmentInfo *, unsigned int, unsigned int))fp)(display, visual, depth, format, NULL, info, width, height);
+}
+
+static Bool shmPutImage(Display *display, Drawable drawable, GC gc, XImage *image, int srcX, int srcY, int destX, int destY, unsigned int width, unsigned int height)
+{
+	OS_LOAD_FUNCTION(fp, XShmPutImage)
+	if (fp == NULL) return False;
+	return ((Bool (*)(Display *, Drawable, GC, XImage *, int, int, int, int, unsigned int, unsigned int, Bool))fp)(display, drawable, gc, image, srcX, srcY, destX, destY, width, height, False);
+}
+
+static int shmErrorHandler(Display *display, XErrorEvent *event)
+{
+	shmError = 1;
+	return 0;
+}
+
+/* Frees the image and its segment, detaching the segment from the server first if it was attached */
+static void shmDestroy(Display *display, XImage *image, XShmSegmentInfo *info, int attached)
+{
+	if (attached) shmDetach(display, info);
+	if (info->shmaddr != NULL && info->shmaddr != (char *)-1) shmdt(info->shmaddr);
+	if (image != NULL) {
+		image->data = NULL;
+		image->obdata = NULL;
+		XDestroyImage(image);
+	}
+	free(info);
+}
+
+static int shmIsUsable(Display *display)
+{
+	int i;
+	for (i = 0; i < SHM_DISPLAYS; i++) {
+		if (shmDisplays[i] == display) return shmUsable[i];
+	}
+	for (i = 0; i < SHM_DISPLAYS; i++) {
+		if (shmDisplays[i] == NULL) break;
+	}
+	if (i == SHM_DISPLAYS) return 0;
+	shmDisplays[i] = display;
+	shmUsable[i] = shmQueryExtension(display);
+	if (shmUsable[i]) {
+		XShmSegmentInfo info;
+		memset(&info, 0, sizeof(info));
+		info.shmid = shmget(IPC_PRIVATE, 1, IPC_CREAT | 0600);
+		shmUsable[i] = 0;
+		if (info.shmid != -1) {
+			info.shmaddr = shmat(info.shmid, NULL, 0);
+			if (info.shmaddr != (char *)-1) {
+				int (*oldHandler)(Display *, XErrorEvent *);
+				XSync(display, False);
+				shmError = 0;
+				oldHandler = XSetErrorHandler(shmErrorHandler);
+				if (shmAttach(display, &info)) {
+					XSync(display, False);
+					if (!shmError) {
+						shmUsable[i] = 1;
+						shmDetach(display, &info);
+						XSync(display, False);
+					}
+				}
+				XSetErrorHandler(oldHandler);
+				shmdt(info.shmaddr);
+			}
+			shmctl(info.shmid, IPC_RMID, NULL);
+		}
+	}
+	return shmUsable[i];
+}
+
+/*
+* Answers a ZPixmap XImage whose pixels are in shared memory, or 0 when the
+* display cannot use shared memory, in which case the caller falls back to
+* XCreateImage(). The image must be destroyed with XShmImageDestroy().
+*/
+JNIEXPORT jint JNICALL OS_NATIVE(_1XShmImageCreate)
+	(JNIEnv *env, jclass that, jint display, jint visual, jint depth, jint width, jint height)
+{
+	Display *xDisplay = (Display *)display;
+	XShmSegmentInfo *info;
+	XImage *image = NULL;
+	OS_NATIVE_ENTER(env, that, _1XShmImageCreate_FUNC)
+	if (width <= 0 || height <= 0 || !shmIsUsable(xDisplay)) goto fail;
+	if ((info = (XShmSegmentInfo *)calloc(1, sizeof(XShmSegmentInfo))) == NULL) goto fail;
+	info->shmid = -1;
+	if ((image = shmCreateImage(xDisplay, (Visual *)visual, depth, ZPixmap, info, width, height)) == NULL) {
+		shmDestroy(xDisplay, NULL, info, 0);
+		goto fail;
+	}
+	info->shmid = shmget(IPC_PRIVATE, image->bytes_per_line * image->height, IPC_CREAT | 0600);
+	if (info->shmid == -1) {
+		shmDestroy(xDisplay, image, info, 0);
+		image = NULL;
+		goto fail;
+	}
+	info->shmaddr = image->data = shmat(info->shmid, NULL, 0);
+	info->readOnly = False;
+	if (info->shmaddr == (char *)-1 || !shmAttach(xDisplay, info)) {
+		shmctl(info->shmid, IPC_RMID, NULL);
+		shmDestroy(xDisplay, image, info, 0);
+		image = NULL;
+		goto fail;
+	}
+	/* The segment goes away once both the server and this process detach it */
+	XSync(xDisplay, False);
+	shmctl(info->shmid, IPC_RMID, NULL);
+fail:
+	OS_NATIVE_EXIT(env, that, _1XShmImageCreate_FUNC)
+	return (jint)image;
+}
+#endif
+
+#ifndef NO__1XShmImageDestroy
+JNIEXPORT void JNICALL OS_NATIVE(_1XShmImageDestroy)
+	(JNIEnv *env, jclass that, jint display, jint image)
+{
+	XImage *xImage = (XImage *)image;
+	OS_NATIVE_ENTER(env, that, _1XShmImageDestroy_FUNC)
+	if (xImage != NULL) shmDestroy((Display *)display, xImage, (XShmSegmentInfo *)xImage->obdata, 1);
+	OS_NATIVE_EXIT(env, that, _1XShmImageDestroy_FUNC)
+}
+#endif
+
+#ifndef NO__1XShmImagePut
+/*
+* Draws an image created by XShmImageCreate(). Waits for the server to have
+* read the pixels, so that the image may be changed or destroyed on return.
+*/
+JNIEXPORT void JNICALL OS_NATIVE(_1XShmImagePut)
+	(JNIEnv *env, jclass that, jint display, jint drawable, jint gc, jint image, jint srcX, jint srcY, jint destX, jint destY, jint width, jint height)
+{
+	OS_NATIVE_ENTER(env, that, _1XShmImagePut_FUNC)
+	shmPutImage((Display *)display, (Drawable)drawable, (GC)gc, (XImage *)image, srcX, srcY, destX, destY, width, height);
+	XSync((Display *)display, False);
+	OS_NATIVE_EXIT(env, that, _1XShmImagePut_FUNC)
+}
+#endif
@@ -24,4 +24,9 @@
 #define XRenderSetPictureClipRectangles_LIB "libXrender.so"
 #define XRenderSetPictureClipRegion_LIB "libXrender.so"
 #define XRenderSetPictureTransform_LIB "libXrender.so"
+#define XShmAttach_LIB "libXext.so"
+#define XShmCreateImage_LIB "libXext.so"
+#define XShmDetach_LIB "libXext.so"
+#define XShmPutImage_LIB "libXext.so"
+#define XShmQueryExtension_LIB "libXext.so"
 
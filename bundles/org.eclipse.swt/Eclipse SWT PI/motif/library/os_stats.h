@@ -13,8 +13,9 @@
 extern int OS_nativeFunctionCount;
 extern int OS_nativeFunctionCallCount[];
 extern char* OS_nativeFunctionNames[];
-#define OS_NATIVE_ENTER(env, that, func) OS_nativeFunctionCallCount[func]++;
-#define OS_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS OS_nativeStats;
+#define OS_NATIVE_ENTER(env, that, func) nativeStatsEnter(&OS_nativeStats, func);
+#define OS_NATIVE_EXIT(env, that, func) nativeStatsExit(&OS_nativeStats, func);
 #else
 #ifndef OS_NATIVE_ENTER
 #define OS_NATIVE_ENTER(env, that, func) 
@@ -173,6 +174,9 @@ typedef enum {
 	_1XSetWindowBackgroundPixmap_FUNC,
 	_1XShapeCombineMask_FUNC,
 	_1XShapeCombineRegion_FUNC,
+	_1XShmImageCreate_FUNC,
+	_1XShmImageDestroy_FUNC,
+	_1XShmImagePut_FUNC,
 	_1XSubtractRegion_FUNC,
 	_1XSync_FUNC,
 	_1XSynchronize_FUNC,
@@ -368,6 +372,7 @@ typedef enum {
 	_1XtAppCreateShell_FUNC,
 	_1XtAppGetSelectionTimeout_FUNC,
 	_1XtAppNextEvent_FUNC,
+	_1XtAppNextEventCoalesced_FUNC,
 	_1XtAppPeekEvent_FUNC,
 	_1XtAppPending_FUNC,
 	_1XtAppProcessEvent_FUNC,
@@ -14,9 +14,29 @@ package org.eclipse.swt.internal;
  * Instances of this represent a recursive monitor.
  */
 public class Lock {
-	int count, waitCount;
+	int count, waitCount, readCount;
 	Thread owner;
 
+	static final Lock[] stripes = new Lock [16];
+	static {
+		for (int i = 0; i < stripes.length; i++) stripes [i] = new Lock ();
+	}
+
+/**
+ * Returns the lock of the native object with the given handle.
+ * Handles share a fixed number of locks, so calls on distinct
+ * objects mostly do not wait for each other. The lock does not
+ * exclude the callers of the library lock.
+ *
+ * @param handle the handle of the native object
+ * @return the lock of the object
+ */
+public static Lock forObject(long /*int*/ handle) {
+	int hash = (int)(handle >>> 4);
+	hash ^= hash >>> 8;
+	return stripes [hash & (stripes.length - 1)];
+}
+
 /**
  * Locks the monitor and returns the lock count. If
  * the lock is owned by another thread, wait until
@@ -29,7 +49,7 @@ public int lock() {
 		Thread current = Thread.currentThread();
 		if (owner != current) {
 			waitCount++;
-			while (count > 0) {
+			while (count > 0 || readCount > 0) {
 				try {
 					wait();
 				} catch (InterruptedException e) {
@@ -58,4 +78,47 @@ public void unlock() {
 		}
 	}
 }
+
+/**
+ * Locks the monitor for reading and returns the lock count.
+ * Any number of threads can hold the monitor for reading at
+ * once. If the lock is owned by another thread, wait until
+ * the lock is released. The thread must not lock the monitor
+ * with <code>lock()</code> before it is unlocked for reading.
+ * 
+ * @return the lock count
+ */
+public int lockRead() {
+	synchronized (this) {
+		Thread current = Thread.currentThread();
+		if (owner == current) return ++count;
+		waitCount++;
+		while (count > 0) {
+			try {
+				wait();
+			} catch (InterruptedException e) {
+				/* Wait forever, just like synchronized blocks */
+			}
+		}
+		--waitCount;
+		return ++readCount;
+	}
+}
+
+/**
+ * Unlocks the monitor locked for reading.
+ */
+public void unlockRead() {
+	synchronized (this) {
+		Thread current = Thread.currentThread();
+		if (owner == current) {
+			if (--count == 0) {
+				owner = null;
+				if (waitCount > 0) notifyAll();
+			}
+		} else if (readCount > 0) {
+			if (--readCount == 0 && waitCount > 0) notifyAll();
+		}
+	}
+}
 }
@@ -2474,6 +2474,50 @@ public static final void XShapeCombineRegion(int display, int dest, int dest_kin
 		lock.unlock();
 	}
 }
+/**
+ * @method flags=no_gen
+ * @param display cast=(Display *)
+ * @param visual cast=(Visual *)
+ */
+public static final native int _XShmImageCreate(int display, int visual, int depth, int width, int height);
+public static final int XShmImageCreate(int display, int visual, int depth, int width, int height) {
+	lock.lock();
+	try {
+		return _XShmImageCreate(display, visual, depth, width, height);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @method flags=no_gen
+ * @param display cast=(Display *)
+ * @param image cast=(XImage *)
+ */
+public static final native void _XShmImageDestroy(int display, int image);
+public static final void XShmImageDestroy(int display, int image) {
+	lock.lock();
+	try {
+		_XShmImageDestroy(display, image);
+	} finally {
+		lock.unlock();
+	}
+}
+/**
+ * @method flags=no_gen
+ * @param display cast=(Display *)
+ * @param drawable cast=(Drawable)
+ * @param gc cast=(GC)
+ * @param image cast=(XImage *)
+ */
+public static final native void _XShmImagePut(int display, int drawable, int gc, int image, int srcX, int srcY, int destX, int destY, int width, int height);
+public static final void XShmImagePut(int display, int drawable, int gc, int image, int srcX, int srcY, int destX, int destY, int width, int height) {
+	lock.lock();
+	try {
+		_XShmImagePut(display, drawable, gc, image, srcX, srcY, destX, destY, width, height);
+	} finally {
+		lock.unlock();
+	}
+}
 /**
  * @param sra cast=(Region)
  * @param srb cast=(Region)
@@ -4918,6 +4962,20 @@ public static final void XtAppNextEvent(int appContext, int event) {
 		lock.unlock();
 	}
 }
+/**
+ * @method flags=no_gen
+ * @param appContext cast=(XtAppContext)
+ * @param event cast=(XEvent *)
+ */
+public static final native void _XtAppNextEventCoalesced(int appContext, int event);
+public static final void XtAppNextEventCoalesced(int appContext, int event) {
+	lock.lock();
+	try {
+		_XtAppNextEventCoalesced(appContext, event);
+	} finally {
+		lock.unlock();
+	}
+}
 /**
  * @param appContext cast=(XtAppContext)
  * @param event cast=(XEvent *)
@@ -17,8 +17,9 @@
 extern int GTK_nativeFunctionCount;
 extern int GTK_nativeFunctionCallCount[];
 extern char* GTK_nativeFunctionNames[];
-#define GTK_NATIVE_ENTER(env, that, func) GTK_nativeFunctionCallCount[func]++;
-#define GTK_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS GTK_nativeStats;
+#define GTK_NATIVE_ENTER(env, that, func) nativeStatsEnter(&GTK_nativeStats, func);
+#define GTK_NATIVE_EXIT(env, that, func) nativeStatsExit(&GTK_nativeStats, func);
 #else
 #ifndef GTK_NATIVE_ENTER
 #define GTK_NATIVE_ENTER(env, that, func) 
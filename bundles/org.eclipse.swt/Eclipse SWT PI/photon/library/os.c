@@ -68,8 +68,8 @@ JNIEXPORT jint JNICALL OS_NATIVE(PfExtentText__Lorg_eclipse_swt_internal_photon_
 	if (arg3) if ((lparg3 = (*env)->GetByteArrayElements(env, arg3, NULL)) == NULL) goto fail;
 	rc = (jint)PfExtentText(lparg0, lparg1, (const char *)lparg2, (const char *)lparg3, arg4);
 fail:
-	if (arg3 && lparg3) (*env)->ReleaseByteArrayElements(env, arg3, lparg3, 0);
-	if (arg2 && lparg2) (*env)->ReleaseByteArrayElements(env, arg2, lparg2, 0);
+	if (arg3 && lparg3) (*env)->ReleaseByteArrayElements(env, arg3, lparg3, JNI_ABORT);
+	if (arg2 && lparg2) (*env)->ReleaseByteArrayElements(env, arg2, lparg2, JNI_ABORT);
 	if (arg1 && lparg1) setPhPoint_tFields(env, arg1, lparg1);
 	if (arg0 && lparg0) setPhRect_tFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, PfExtentText__Lorg_eclipse_swt_internal_photon_PhRect_1t_2Lorg_eclipse_swt_internal_photon_PhPoint_1t_2_3B_3BI_FUNC);
@@ -93,8 +93,8 @@ JNIEXPORT jint JNICALL OS_NATIVE(PfExtentWideText)
 	if (arg3) if ((lparg3 = (*env)->GetCharArrayElements(env, arg3, NULL)) == NULL) goto fail;
 	rc = (jint)PfExtentWideText(lparg0, lparg1, (const char *)lparg2, (const uint16_t *)lparg3, arg4);
 fail:
-	if (arg3 && lparg3) (*env)->ReleaseCharArrayElements(env, arg3, lparg3, 0);
-	if (arg2 && lparg2) (*env)->ReleaseByteArrayElements(env, arg2, lparg2, 0);
+	if (arg3 && lparg3) (*env)->ReleaseCharArrayElements(env, arg3, lparg3, JNI_ABORT);
+	if (arg2 && lparg2) (*env)->ReleaseByteArrayElements(env, arg2, lparg2, JNI_ABORT);
 	if (arg1 && lparg1) setPhPoint_tFields(env, arg1, lparg1);
 	if (arg0 && lparg0) setPhRect_tFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, PfExtentWideText_FUNC);
@@ -179,7 +179,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PfLoadMetrics)
 	if (arg0) if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jint)PfLoadMetrics((const char *)lparg0);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, PfLoadMetrics_FUNC);
 	return rc;
 }
@@ -198,7 +198,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PfQueryFontInfo)
 	rc = (jint)PfQueryFontInfo((const char *)lparg0, (FontQueryInfo *)lparg1);
 fail:
 	if (arg1 && lparg1) setFontQueryInfoFields(env, arg1, lparg1);
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, PfQueryFontInfo_FUNC);
 	return rc;
 }
@@ -951,8 +951,6 @@ JNIEXPORT void JNICALL OS_NATIVE(PhBlit)
 	if (arg2) if ((lparg2 = getPhPoint_tFields(env, arg2, &_arg2)) == NULL) goto fail;
 	PhBlit((PhRid_t)arg0, (const PhRect_t *)lparg1, (const PhPoint_t *)lparg2);
 fail:
-	if (arg2 && lparg2) setPhPoint_tFields(env, arg2, lparg2);
-	if (arg1 && lparg1) setPhRect_tFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, PhBlit_FUNC);
 }
 #endif
@@ -999,7 +997,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PhClipboardCopyString)
 	if (arg1) if ((lparg1 = (*env)->GetByteArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	rc = (jint)PhClipboardCopyString(arg0, (const char *)lparg1);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, PhClipboardCopyString_FUNC);
 	return rc;
 }
@@ -1228,8 +1226,6 @@ fail:
 	if (arg7 && lparg7) setPhDim_tFields(env, arg7, lparg7);
 	if (arg6 && lparg6) setPhDim_tFields(env, arg6, lparg6);
 	if (arg5 && lparg5) setPhDim_tFields(env, arg5, lparg5);
-	if (arg3 && lparg3) setPhRect_tFields(env, arg3, lparg3);
-	if (arg2 && lparg2) setPhRect_tFields(env, arg2, lparg2);
 	OS_NATIVE_EXIT(env, that, PhInitDrag_FUNC);
 	return rc;
 }
@@ -1357,7 +1353,6 @@ JNIEXPORT jint JNICALL OS_NATIVE(PhQueryRids)
 	rc = (jint)PhQueryRids(arg0, (PhRid_t)arg1, arg2, arg3, arg4, (PhRid_t)arg5, (const PhRect_t *)lparg6, (PhRid_t *)lparg7, arg8);
 fail:
 	if (arg7 && lparg7) (*env)->ReleaseIntArrayElements(env, arg7, lparg7, 0);
-	if (arg6 && lparg6) setPhRect_tFields(env, arg6, lparg6);
 	OS_NATIVE_EXIT(env, that, PhQueryRids_FUNC);
 	return rc;
 }
@@ -2222,10 +2217,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(PtFontSelection)
 	if (arg6) if ((lparg6 = (*env)->GetByteArrayElements(env, arg6, NULL)) == NULL) goto fail;
 	rc = (jint)PtFontSelection((PtWidget_t *)arg0, (const PhPoint_t *)lparg1, (const char *)lparg2, (const char *)lparg3, arg4, arg5, (const char *)lparg6);
 fail:
-	if (arg6 && lparg6) (*env)->ReleaseByteArrayElements(env, arg6, lparg6, 0);
-	if (arg3 && lparg3) (*env)->ReleaseByteArrayElements(env, arg3, lparg3, 0);
-	if (arg2 && lparg2) (*env)->ReleaseByteArrayElements(env, arg2, lparg2, 0);
-	if (arg1 && lparg1) setPhPoint_tFields(env, arg1, lparg1);
+	if (arg6 && lparg6) (*env)->ReleaseByteArrayElements(env, arg6, lparg6, JNI_ABORT);
+	if (arg3 && lparg3) (*env)->ReleaseByteArrayElements(env, arg3, lparg3, JNI_ABORT);
+	if (arg2 && lparg2) (*env)->ReleaseByteArrayElements(env, arg2, lparg2, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, PtFontSelection_FUNC);
 	return rc;
 }
@@ -2562,7 +2556,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PtListItemPos)
 	if (arg1) if ((lparg1 = (*env)->GetByteArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	rc = (jint)PtListItemPos((PtWidget_t *)arg0, (const char *)lparg1);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, PtListItemPos_FUNC);
 	return rc;
 }
@@ -3838,7 +3832,6 @@ JNIEXPORT void JNICALL OS_NATIVE(memmove___3BLorg_eclipse_swt_internal_photon_Ph
 	if (arg1) if ((lparg1 = getPhClipHeaderFields(env, arg1, &_arg1)) == NULL) goto fail;
 	memmove((void *)lparg0, (const void *)lparg1, arg2);
 fail:
-	if (arg1 && lparg1) setPhClipHeaderFields(env, arg1, lparg1);
 	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
 	OS_NATIVE_EXIT(env, that, memmove___3BLorg_eclipse_swt_internal_photon_PhClipHeader_2I_FUNC);
 }
@@ -35,3 +35,69 @@ JNIEXPORT jint JNICALL OS_NATIVE(PhGetTile)
 	return rc;
 }
 #endif
+
+#ifndef NO_PgDrawStream
+/*
+* Draws a stream of primitives recorded by GC in one call. The stream is
+* count ints of opcodes, each followed by its arguments (see the DRAW_STREAM
+* constants in OS), and the strings drawn by DRAW_STREAM_TEXT are in text.
+* Answers the number of ints consumed, which is less than count if the
+* stream is malformed.
+*/
+#define DRAW_STREAM_RECT 1
+#define DRAW_STREAM_LINE 2
+#define DRAW_STREAM_PIXEL 3
+#define DRAW_STREAM_TEXT 4
+
+JNIEXPORT jint JNICALL OS_NATIVE(PgDrawStream)
+	(JNIEnv *env, jclass that, jintArray stream, jint count, jbyteArray text, jint textLength, jboolean flush)
+{
+	jint *lpstream = NULL;
+	jbyte *lptext = NULL;
+	jint i = 0;
+	PhPoint_t pos;
+	OS_NATIVE_ENTER(env, that, PgDrawStream_FUNC)
+	if (stream == NULL || count > (*env)->GetArrayLength(env, stream)) goto fail;
+	if (text != NULL && textLength > (*env)->GetArrayLength(env, text)) goto fail;
+	if ((lpstream = (*env)->GetPrimitiveArrayCritical(env, stream, NULL)) == NULL) goto fail;
+	if (text != NULL) {
+		if ((lptext = (*env)->GetPrimitiveArrayCritical(env, text, NULL)) == NULL) goto fail;
+	}
+	while (i < count) {
+		jint *op = lpstream + i;
+		switch (op[0]) {
+			case DRAW_STREAM_RECT:
+				if (i + 6 > count) goto fail;
+				PgDrawIRect(op[1], op[2], op[3], op[4], op[5]);
+				i += 6;
+				break;
+			case DRAW_STREAM_LINE:
+				if (i + 5 > count) goto fail;
+				PgDrawILine(op[1], op[2], op[3], op[4]);
+				i += 5;
+				break;
+			case DRAW_STREAM_PIXEL:
+				if (i + 3 > count) goto fail;
+				PgDrawIPixel(op[1], op[2]);
+				i += 3;
+				break;
+			case DRAW_STREAM_TEXT:
+				if (i + 6 > count || lptext == NULL) goto fail;
+				if (op[1] < 0 || op[2] < 0 || op[1] + op[2] > textLength) goto fail;
+				pos.x = (short)op[3];
+				pos.y = (short)op[4];
+				PgDrawText((char const *)(lptext + op[1]), op[2], &pos, op[5]);
+				i += 6;
+				break;
+			default:
+				goto fail;
+		}
+	}
+fail:
+	if (text != NULL && lptext != NULL) (*env)->ReleasePrimitiveArrayCritical(env, text, lptext, JNI_ABORT);
+	if (stream != NULL && lpstream != NULL) (*env)->ReleasePrimitiveArrayCritical(env, stream, lpstream, JNI_ABORT);
+	if (flush) PgFlush();
+	OS_NATIVE_EXIT(env, that, PgDrawStream_FUNC)
+	return i;
+}
+#endif
@@ -551,6 +551,12 @@ public class OS extends C {
 	public static final int Pt_WEB_STATUS_PRINT = 5;
 	public static final int Pt_Z_STRING = 0x1;
 
+	/** Opcodes of the streams drawn by PgDrawStream, with the number of ints each takes */
+	public static final int DRAW_STREAM_RECT = 1; /* ulx, uly, lrx, lry, flags */
+	public static final int DRAW_STREAM_LINE = 2; /* x1, y1, x2, y2 */
+	public static final int DRAW_STREAM_PIXEL = 3; /* x, y */
+	public static final int DRAW_STREAM_TEXT = 4; /* offset, length, x, y, flags */
+
 /** Natives */
 public static final native int PfDecomposeStemToID(byte[] pkszStem);
 /**
@@ -635,6 +641,15 @@ public static final native int PgDrawPolygon(short[] ptr, int num, PhPoint_t pos
  * @param radii cast=(PhPoint_t const *)
  */
 public static final native int PgDrawRoundRect(PhRect_t rect, PhPoint_t radii, int flags);
+/**
+ * @method flags=no_gen
+ * @param stream the opcodes and their arguments
+ * @param count the number of ints of stream to draw
+ * @param text the bytes of the strings of DRAW_STREAM_TEXT
+ * @param textLength the number of bytes of text used
+ * @param flush whether to call PgFlush after drawing
+ */
+public static final native int PgDrawStream(int[] stream, int count, byte[] text, int textLength, boolean flush);
 /**
  * @param ptr cast=(void const *)
  * @param pos cast=(PhPoint_t const *)
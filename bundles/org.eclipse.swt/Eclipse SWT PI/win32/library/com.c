@@ -93,7 +93,7 @@ JNIEXPORT jint JNICALL COM_NATIVE(CLSIDFromProgID)
 	rc = (jint)CLSIDFromProgID((LPCOLESTR)lparg0, lparg1);
 fail:
 	if (arg1 && lparg1) setGUIDFields(env, arg1, lparg1);
-	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, JNI_ABORT);
 	COM_NATIVE_EXIT(env, that, CLSIDFromProgID_FUNC);
 	return rc;
 }
@@ -348,7 +348,7 @@ JNIEXPORT jint JNICALL COM_NATIVE(GetClassFile)
 	rc = (jint)GetClassFile((LPCWSTR)lparg0, lparg1);
 fail:
 	if (arg1 && lparg1) setGUIDFields(env, arg1, lparg1);
-	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, JNI_ABORT);
 	COM_NATIVE_EXIT(env, that, GetClassFile_FUNC);
 	return rc;
 }
@@ -373,25 +373,6 @@ fail:
 }
 #endif
 
-#ifndef NO_IsEqualGUID
-JNIEXPORT jboolean JNICALL COM_NATIVE(IsEqualGUID)
-	(JNIEnv *env, jclass that, jobject arg0, jobject arg1)
-{
-	GUID _arg0, *lparg0=NULL;
-	GUID _arg1, *lparg1=NULL;
-	jboolean rc = 0;
-	COM_NATIVE_ENTER(env, that, IsEqualGUID_FUNC);
-	if (arg0) if ((lparg0 = getGUIDFields(env, arg0, &_arg0)) == NULL) goto fail;
-	if (arg1) if ((lparg1 = getGUIDFields(env, arg1, &_arg1)) == NULL) goto fail;
-	rc = (jboolean)IsEqualGUID(lparg0, lparg1);
-fail:
-	if (arg1 && lparg1) setGUIDFields(env, arg1, lparg1);
-	if (arg0 && lparg0) setGUIDFields(env, arg0, lparg0);
-	COM_NATIVE_EXIT(env, that, IsEqualGUID_FUNC);
-	return rc;
-}
-#endif
-
 #ifndef NO_LICINFO_1sizeof
 JNIEXPORT jint JNICALL COM_NATIVE(LICINFO_1sizeof)
 	(JNIEnv *env, jclass that)
@@ -428,6 +409,30 @@ fail:
 }
 #endif
 
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_ole_win32_DISPPARAMS_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_ole_win32_DISPPARAMS_2I) && defined(JNI64))
+#ifndef JNI64
+JNIEXPORT void JNICALL COM_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_ole_win32_DISPPARAMS_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+#else
+JNIEXPORT void JNICALL COM_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_ole_win32_DISPPARAMS_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+#endif
+{
+	DISPPARAMS _arg1, *lparg1=NULL;
+#ifndef JNI64
+	COM_NATIVE_ENTER(env, that, MoveMemory__ILorg_eclipse_swt_internal_ole_win32_DISPPARAMS_2I_FUNC);
+#else
+	COM_NATIVE_ENTER(env, that, MoveMemory__JLorg_eclipse_swt_internal_ole_win32_DISPPARAMS_2I_FUNC);
+#endif
+	if (arg1) if ((lparg1 = getDISPPARAMSFields(env, arg1, &_arg1)) == NULL) goto fail;
+	MoveMemory((PVOID)arg0, (CONST VOID *)lparg1, arg2);
+fail:
+#ifndef JNI64
+	COM_NATIVE_EXIT(env, that, MoveMemory__ILorg_eclipse_swt_internal_ole_win32_DISPPARAMS_2I_FUNC);
+#else
+	COM_NATIVE_EXIT(env, that, MoveMemory__JLorg_eclipse_swt_internal_ole_win32_DISPPARAMS_2I_FUNC);
+#endif
+}
+#endif
+
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_ole_win32_FORMATETC_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_ole_win32_FORMATETC_2I) && defined(JNI64))
 #ifndef JNI64
 JNIEXPORT void JNICALL COM_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_ole_win32_FORMATETC_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
@@ -573,6 +578,31 @@ fail:
 }
 #endif
 
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_ole_win32_EXCEPINFO_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_ole_win32_EXCEPINFO_2JI) && defined(JNI64))
+#ifndef JNI64
+JNIEXPORT void JNICALL COM_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_ole_win32_EXCEPINFO_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+#else
+JNIEXPORT void JNICALL COM_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_ole_win32_EXCEPINFO_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+#endif
+{
+	EXCEPINFO _arg0, *lparg0=NULL;
+#ifndef JNI64
+	COM_NATIVE_ENTER(env, that, MoveMemory__Lorg_eclipse_swt_internal_ole_win32_EXCEPINFO_2II_FUNC);
+#else
+	COM_NATIVE_ENTER(env, that, MoveMemory__Lorg_eclipse_swt_internal_ole_win32_EXCEPINFO_2JI_FUNC);
+#endif
+	if (arg0) if ((lparg0 = &_arg0) == NULL) goto fail;
+	MoveMemory((PVOID)lparg0, (CONST VOID *)arg1, arg2);
+fail:
+	if (arg0 && lparg0) setEXCEPINFOFields(env, arg0, lparg0);
+#ifndef JNI64
+	COM_NATIVE_EXIT(env, that, MoveMemory__Lorg_eclipse_swt_internal_ole_win32_EXCEPINFO_2II_FUNC);
+#else
+	COM_NATIVE_EXIT(env, that, MoveMemory__Lorg_eclipse_swt_internal_ole_win32_EXCEPINFO_2JI_FUNC);
+#endif
+}
+#endif
+
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_ole_win32_FORMATETC_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_ole_win32_FORMATETC_2JI) && defined(JNI64))
 #ifndef JNI64
 JNIEXPORT void JNICALL COM_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_ole_win32_FORMATETC_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
@@ -868,7 +898,7 @@ fail:
 	if (arg7 && lparg7) (*env)->ReleaseIntLongArrayElements(env, arg7, lparg7, 0);
 	if (arg4 && lparg4) setFORMATETCFields(env, arg4, lparg4);
 	if (arg2 && lparg2) setGUIDFields(env, arg2, lparg2);
-	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, JNI_ABORT);
 	if (arg0 && lparg0) setGUIDFields(env, arg0, lparg0);
 	COM_NATIVE_EXIT(env, that, OleCreateFromFile_FUNC);
 	return rc;
@@ -888,7 +918,7 @@ JNIEXPORT jint JNICALL COM_NATIVE(OleCreatePropertyFrame)
 	rc = (jint)OleCreatePropertyFrame((HWND)arg0, arg1, arg2, (LPCOLESTR)lparg3, arg4, (LPUNKNOWN FAR*)lparg5, arg6, (LPCLSID)arg7, (LCID)arg8, arg9, (LPVOID)arg10);
 fail:
 	if (arg5 && lparg5) (*env)->ReleaseIntLongArrayElements(env, arg5, lparg5, 0);
-	if (arg3 && lparg3) (*env)->ReleaseCharArrayElements(env, arg3, lparg3, 0);
+	if (arg3 && lparg3) (*env)->ReleaseCharArrayElements(env, arg3, lparg3, JNI_ABORT);
 	COM_NATIVE_EXIT(env, that, OleCreatePropertyFrame_FUNC);
 	return rc;
 }
@@ -1175,7 +1205,7 @@ JNIEXPORT jint JNICALL COM_NATIVE(StgIsStorageFile)
 	if (arg0) if ((lparg0 = (*env)->GetCharArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jint)StgIsStorageFile((const WCHAR *)lparg0);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, JNI_ABORT);
 	COM_NATIVE_EXIT(env, that, StgIsStorageFile_FUNC);
 	return rc;
 }
@@ -1194,7 +1224,7 @@ JNIEXPORT jint JNICALL COM_NATIVE(StgOpenStorage)
 	rc = (jint)StgOpenStorage((const WCHAR *)lparg0, (IStorage *)arg1, arg2, (SNB)arg3, arg4, (IStorage **)lparg5);
 fail:
 	if (arg5 && lparg5) (*env)->ReleaseIntLongArrayElements(env, arg5, lparg5, 0);
-	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, JNI_ABORT);
 	COM_NATIVE_EXIT(env, that, StgOpenStorage_FUNC);
 	return rc;
 }
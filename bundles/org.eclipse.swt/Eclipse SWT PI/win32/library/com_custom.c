@@ -323,3 +323,684 @@ JNIEXPORT jint JNICALL COM_NATIVE(VtblCall_1VARIANTP)
 	return rc;
 }
 #endif
+
+#ifndef NO_VtblResolve
+JNIEXPORT jintLong JNICALL COM_NATIVE(VtblResolve)
+	(JNIEnv *env, jclass that, jint arg0, jintLong arg1)
+{
+	jintLong rc = 0;
+	COM_NATIVE_ENTER(env, that, VtblResolve_FUNC);
+	rc = (*(jintLong **)arg1)[arg0];
+	COM_NATIVE_EXIT(env, that, VtblResolve_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_VtblCallBound0
+JNIEXPORT jint JNICALL COM_NATIVE(VtblCallBound0)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
+{
+	jint rc = 0;
+	COM_NATIVE_ENTER(env, that, VtblCallBound0_FUNC);
+	rc = (jint)((jint (STDMETHODCALLTYPE *)(jintLong))arg0)(arg1);
+	COM_NATIVE_EXIT(env, that, VtblCallBound0_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_VtblCallBound1
+JNIEXPORT jint JNICALL COM_NATIVE(VtblCallBound1)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
+{
+	jint rc = 0;
+	COM_NATIVE_ENTER(env, that, VtblCallBound1_FUNC);
+	rc = (jint)((jint (STDMETHODCALLTYPE *)(jintLong, jintLong))arg0)(arg1, arg2);
+	COM_NATIVE_EXIT(env, that, VtblCallBound1_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_VtblCallBound2
+JNIEXPORT jint JNICALL COM_NATIVE(VtblCallBound2)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3)
+{
+	jint rc = 0;
+	COM_NATIVE_ENTER(env, that, VtblCallBound2_FUNC);
+	rc = (jint)((jint (STDMETHODCALLTYPE *)(jintLong, jintLong, jintLong))arg0)(arg1, arg2, arg3);
+	COM_NATIVE_EXIT(env, that, VtblCallBound2_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_VtblCallBound3
+JNIEXPORT jint JNICALL COM_NATIVE(VtblCallBound3)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4)
+{
+	jint rc = 0;
+	COM_NATIVE_ENTER(env, that, VtblCallBound3_FUNC);
+	rc = (jint)((jint (STDMETHODCALLTYPE *)(jintLong, jintLong, jintLong, jintLong))arg0)(arg1, arg2, arg3, arg4);
+	COM_NATIVE_EXIT(env, that, VtblCallBound3_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_VtblCallBound4
+JNIEXPORT jint JNICALL COM_NATIVE(VtblCallBound4)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5)
+{
+	jint rc = 0;
+	COM_NATIVE_ENTER(env, that, VtblCallBound4_FUNC);
+	rc = (jint)((jint (STDMETHODCALLTYPE *)(jintLong, jintLong, jintLong, jintLong, jintLong))arg0)(arg1, arg2, arg3, arg4, arg5);
+	COM_NATIVE_EXIT(env, that, VtblCallBound4_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_VtblCallBound5
+JNIEXPORT jint JNICALL COM_NATIVE(VtblCallBound5)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6)
+{
+	jint rc = 0;
+	COM_NATIVE_ENTER(env, that, VtblCallBound5_FUNC);
+	rc = (jint)((jint (STDMETHODCALLTYPE *)(jintLong, jintLong, jintLong, jintLong, jintLong, jintLong))arg0)(arg1, arg2, arg3, arg4, arg5, arg6);
+	COM_NATIVE_EXIT(env, that, VtblCallBound5_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_VtblCallBound6
+JNIEXPORT jint JNICALL COM_NATIVE(VtblCallBound6)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jintLong arg7)
+{
+	jint rc = 0;
+	COM_NATIVE_ENTER(env, that, VtblCallBound6_FUNC);
+	rc = (jint)((jint (STDMETHODCALLTYPE *)(jintLong, jintLong, jintLong, jintLong, jintLong, jintLong, jintLong))arg0)(arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+	COM_NATIVE_EXIT(env, that, VtblCallBound6_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_VtblCallBound7
+JNIEXPORT jint JNICALL COM_NATIVE(VtblCallBound7)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jintLong arg7, jintLong arg8)
+{
+	jint rc = 0;
+	COM_NATIVE_ENTER(env, that, VtblCallBound7_FUNC);
+	rc = (jint)((jint (STDMETHODCALLTYPE *)(jintLong, jintLong, jintLong, jintLong, jintLong, jintLong, jintLong, jintLong))arg0)(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+	COM_NATIVE_EXIT(env, that, VtblCallBound7_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_VtblCallBound8
+JNIEXPORT jint JNICALL COM_NATIVE(VtblCallBound8)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintLong arg6, jintLong arg7, jintLong arg8, jintLong arg9)
+{
+	jint rc = 0;
+	COM_NATIVE_ENTER(env, that, VtblCallBound8_FUNC);
+	rc = (jint)((jint (STDMETHODCALLTYPE *)(jintLong, jintLong, jintLong, jintLong, jintLong, jintLong, jintLong, jintLong, jintLong))arg0)(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+	COM_NATIVE_EXIT(env, that, VtblCallBound8_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_InvokeBatch
+#define INVOKE_HEADER 5
+#define INVOKE_RECORD 4
+#define INVOKE_STACK 16
+
+/*
+* Decodes one packed argument into a VARIANT.  Returns the number of
+* slots read, or 0 if the argument is malformed.
+*/
+static jint decodeInvokeArg(jlong *slots, jint available, VARIANT *pVar)
+{
+	VARTYPE vt;
+	jlong value;
+	jint length;
+	if (available < 2) return 0;
+	vt = (VARTYPE)slots[0];
+	value = slots[1];
+	if (vt & VT_BYREF) {
+		V_VT(pVar) = vt;
+		V_BYREF(pVar) = (PVOID)(jintLong)value;
+		return 2;
+	}
+	switch (vt) {
+		case VT_EMPTY:
+		case VT_NULL: break;
+		case VT_BOOL: V_BOOL(pVar) = value ? VARIANT_TRUE : VARIANT_FALSE; break;
+		case VT_I1: V_I1(pVar) = (CHAR)value; break;
+		case VT_I2: V_I2(pVar) = (SHORT)value; break;
+		case VT_UI2: V_UI2(pVar) = (USHORT)value; break;
+		case VT_I4: V_I4(pVar) = (LONG)value; break;
+		case VT_I8: V_I8(pVar) = (LONGLONG)value; break;
+		case VT_R4: {
+			jint bits = (jint)value;
+			memmove(&V_R4(pVar), &bits, sizeof(bits));
+			break;
+		}
+		case VT_R8: memmove(&V_R8(pVar), &value, sizeof(value)); break;
+		case VT_DISPATCH:
+		case VT_UNKNOWN:
+			/* VariantClear() releases the reference taken here */
+			V_UNKNOWN(pVar) = (IUnknown *)(jintLong)value;
+			if (V_UNKNOWN(pVar) != NULL) V_UNKNOWN(pVar)->lpVtbl->AddRef(V_UNKNOWN(pVar));
+			break;
+		case VT_BSTR:
+			length = (jint)value;
+			if (length < 0 || length > (available - 2) * 4) return 0;
+			if ((V_BSTR(pVar) = SysAllocStringLen((OLECHAR *)(slots + 2), length)) == NULL) return 0;
+			V_VT(pVar) = vt;
+			return 2 + (length * 2 + 7) / 8;
+		default: return 0;
+	}
+	V_VT(pVar) = vt;
+	return 2;
+}
+
+/*
+* Stores the length and up to max characters of a BSTR.  Returns the
+* number of slots used after the length.
+*/
+static jint copyInvokeString(BSTR bstr, jlong *slots, jint max)
+{
+	jint length = (jint)SysStringLen(bstr);
+	if (length > max) length = max;
+	slots[0] = length;
+	memmove(slots + 1, bstr, length * sizeof(OLECHAR));
+	return (length * 2 + 7) / 8;
+}
+
+/*
+* Stores a result VARIANT in a record the way Variant.setData() reads it,
+* coercing other types to VT_R4, VT_I4 or VT_BSTR.  Interfaces, and strings
+* that do not fit in the room left, move to the caller and are removed from
+* the VARIANT.  Returns the number of slots used after the record.
+*/
+static jint encodeInvokeResult(VARIANT *pVar, jlong *record, jint room)
+{
+	VARIANT coerced;
+	VARTYPE vt = V_VT(pVar);
+	jint used = 0;
+	jint bits;
+	if (vt & VT_BYREF) {
+		record[1] = vt;
+		record[2] = (jlong)(jintLong)V_BYREF(pVar);
+		return 0;
+	}
+	switch (vt) {
+		case VT_EMPTY:
+		case VT_NULL: break;
+		case VT_BOOL: record[2] = V_BOOL(pVar) != VARIANT_FALSE; break;
+		case VT_I1: record[2] = V_I1(pVar); break;
+		case VT_I2: record[2] = V_I2(pVar); break;
+		case VT_UI2: record[2] = V_UI2(pVar); break;
+		case VT_I4: record[2] = V_I4(pVar); break;
+		case VT_I8: record[2] = V_I8(pVar); break;
+		case VT_R4:
+			memmove(&bits, &V_R4(pVar), sizeof(bits));
+			record[2] = bits;
+			break;
+		case VT_R8: memmove(&record[2], &V_R8(pVar), sizeof(jlong)); break;
+		case VT_DISPATCH:
+		case VT_UNKNOWN:
+			if (V_UNKNOWN(pVar) == NULL) {
+				vt = VT_EMPTY;
+				break;
+			}
+			record[2] = (jlong)(jintLong)V_UNKNOWN(pVar);
+			V_VT(pVar) = VT_EMPTY;
+			break;
+		case VT_BSTR:
+			if (V_BSTR(pVar) == NULL) {
+				vt = VT_EMPTY;
+				break;
+			}
+			if ((jint)SysStringLen(V_BSTR(pVar)) <= room * 4) {
+				used = copyInvokeString(V_BSTR(pVar), record + 3, room * 4);
+			} else {
+				record[2] = (jlong)(jintLong)V_BSTR(pVar);
+				V_VT(pVar) = VT_EMPTY;
+			}
+			break;
+		default:
+			VariantInit(&coerced);
+			if (VariantChangeType(&coerced, pVar, 0, VT_R4) == S_OK ||
+				VariantChangeType(&coerced, pVar, 0, VT_I4) == S_OK ||
+				VariantChangeType(&coerced, pVar, 0, VT_BSTR) == S_OK) {
+				used = encodeInvokeResult(&coerced, record, room);
+			} else {
+				record[1] = VT_EMPTY;
+			}
+			VariantClear(&coerced);
+			return used;
+	}
+	record[1] = vt;
+	return used;
+}
+
+JNIEXPORT jint JNICALL COM_NATIVE(InvokeBatch)
+	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2, jobject arg3, jint arg4)
+{
+	static const IID nullIID = {0, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0}};
+	IDispatch *dispatch = (IDispatch *)arg0;
+	jlong *in = NULL, *out = NULL;
+	jint inSlots, outSlots, ip = 0, op = 0;
+	jint count = 0;
+	COM_NATIVE_ENTER(env, that, InvokeBatch_FUNC);
+	if (dispatch == NULL || arg1 == NULL || arg3 == NULL || arg2 < 0 || arg4 < 0) goto fail;
+	if ((*env)->GetDirectBufferCapacity(env, arg1) < arg2) goto fail;
+	if ((*env)->GetDirectBufferCapacity(env, arg3) < arg4) goto fail;
+	if ((in = (*env)->GetDirectBufferAddress(env, arg1)) == NULL) goto fail;
+	if ((out = (*env)->GetDirectBufferAddress(env, arg3)) == NULL) goto fail;
+	inSlots = arg2 / sizeof(jlong);
+	outSlots = arg4 / sizeof(jlong);
+	while (inSlots - ip >= INVOKE_HEADER && outSlots - op >= INVOKE_RECORD) {
+		VARIANT stackArgs[INVOKE_STACK], *args = stackArgs, result;
+		DISPID stackNamed[INVOKE_STACK], *named = stackNamed;
+		DISPPARAMS params;
+		EXCEPINFO excepInfo;
+		UINT argErr = 0;
+		HRESULT hr;
+		jlong *header = in + ip, *record = out + op;
+		jint cArgs = (jint)header[2], cNamedArgs = (jint)header[3];
+		jint i, used, decoded = 0;
+		if (cArgs < 0 || cNamedArgs < 0 || cNamedArgs > cArgs) break;
+		if (cNamedArgs > inSlots - ip - INVOKE_HEADER) break;
+		if (cArgs > INVOKE_STACK) {
+			if ((args = HeapAlloc(GetProcessHeap(), 0, cArgs * sizeof(VARIANT))) == NULL) break;
+		}
+		if (cNamedArgs > INVOKE_STACK) {
+			if ((named = HeapAlloc(GetProcessHeap(), 0, cNamedArgs * sizeof(DISPID))) == NULL) {
+				if (args != stackArgs) HeapFree(GetProcessHeap(), 0, args);
+				break;
+			}
+		}
+		ip += INVOKE_HEADER;
+
+		/* Invoke() expects both the arguments and their names in reverse order */
+		for (i = 0; i < cNamedArgs; i++) named[cNamedArgs - 1 - i] = (DISPID)in[ip + i];
+		ip += cNamedArgs;
+		for (; decoded < cArgs; decoded++) {
+			VARIANT *pVar = &args[cArgs - 1 - decoded];
+			VariantInit(pVar);
+			if ((used = decodeInvokeArg(in + ip, inSlots - ip, pVar)) == 0) break;
+			ip += used;
+		}
+		if (decoded == cArgs) {
+			params.rgvarg = cArgs > 0 ? args : NULL;
+			params.rgdispidNamedArgs = cNamedArgs > 0 ? named : NULL;
+			params.cArgs = cArgs;
+			params.cNamedArgs = cNamedArgs;
+			VariantInit(&result);
+			memset(&excepInfo, 0, sizeof(excepInfo));
+			hr = dispatch->lpVtbl->Invoke(dispatch, (DISPID)header[0], &nullIID, LOCALE_USER_DEFAULT, (WORD)header[1], &params, header[4] ? &result : NULL, &excepInfo, &argErr);
+			record[0] = hr;
+			record[1] = VT_EMPTY;
+			record[2] = 0;
+			record[3] = -1;
+			used = 0;
+			if (hr == DISP_E_EXCEPTION) {
+				if (excepInfo.pfnDeferredFillIn != NULL) excepInfo.pfnDeferredFillIn(&excepInfo);
+				record[1] = excepInfo.wCode;
+				record[2] = excepInfo.scode;
+				if (excepInfo.bstrDescription != NULL) {
+					used = copyInvokeString(excepInfo.bstrDescription, record + 3, (outSlots - op - INVOKE_RECORD) * 4);
+				}
+				SysFreeString(excepInfo.bstrSource);
+				SysFreeString(excepInfo.bstrDescription);
+				SysFreeString(excepInfo.bstrHelpFile);
+			} else if (header[4]) {
+				used = encodeInvokeResult(&result, record, outSlots - op - INVOKE_RECORD);
+			}
+			VariantClear(&result);
+			op += INVOKE_RECORD + used;
+			count++;
+		}
+		for (i = 0; i < decoded; i++) VariantClear(&args[cArgs - 1 - i]);
+		if (args != stackArgs) HeapFree(GetProcessHeap(), 0, args);
+		if (named != stackNamed) HeapFree(GetProcessHeap(), 0, named);
+		if (decoded != cArgs) break;
+	}
+fail:
+	COM_NATIVE_EXIT(env, that, InvokeBatch_FUNC);
+	return count;
+}
+#endif
+
+#ifndef NO_BSTRFromString
+JNIEXPORT jintLong JNICALL COM_NATIVE(BSTRFromString)
+	(JNIEnv *env, jclass that, jstring arg0)
+{
+	const jchar *lparg0 = NULL;
+	jsize length;
+	jintLong rc = 0;
+	COM_NATIVE_ENTER(env, that, BSTRFromString_FUNC);
+	if (arg0 == NULL) goto fail;
+	length = (*env)->GetStringLength(env, arg0);
+	if (IS_JNI_1_2) {
+		if ((lparg0 = (*env)->GetStringCritical(env, arg0, NULL)) == NULL) goto fail;
+	} else {
+		if ((lparg0 = (*env)->GetStringChars(env, arg0, NULL)) == NULL) goto fail;
+	}
+	rc = (jintLong)SysAllocStringLen((const OLECHAR *)lparg0, length);
+fail:
+	if (arg0 && lparg0) {
+		if (IS_JNI_1_2) {
+			(*env)->ReleaseStringCritical(env, arg0, lparg0);
+		} else {
+			(*env)->ReleaseStringChars(env, arg0, lparg0);
+		}
+	}
+	COM_NATIVE_EXIT(env, that, BSTRFromString_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_BSTRToString
+JNIEXPORT jstring JNICALL COM_NATIVE(BSTRToString)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	jstring rc = NULL;
+	COM_NATIVE_ENTER(env, that, BSTRToString_FUNC);
+	if (arg0 == 0) goto fail;
+	rc = (*env)->NewString(env, (const jchar *)arg0, (jsize)SysStringLen((BSTR)arg0));
+fail:
+	COM_NATIVE_EXIT(env, that, BSTRToString_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_SysFreeStrings
+JNIEXPORT void JNICALL COM_NATIVE(SysFreeStrings)
+	(JNIEnv *env, jclass that, jintLongArray arg0, jint arg1)
+{
+	jintLong *lparg0 = NULL;
+	jint i;
+	COM_NATIVE_ENTER(env, that, SysFreeStrings_FUNC);
+	if (arg0 == NULL || arg1 < 0 || arg1 > (*env)->GetArrayLength(env, arg0)) goto fail;
+	if ((lparg0 = (*env)->GetIntLongArrayElements(env, arg0, NULL)) == NULL) goto fail;
+	for (i = 0; i < arg1; i++) {
+		if (lparg0[i] != 0) SysFreeString((BSTR)lparg0[i]);
+		lparg0[i] = 0;
+	}
+fail:
+	if (arg0 && lparg0) (*env)->ReleaseIntLongArrayElements(env, arg0, lparg0, 0);
+	COM_NATIVE_EXIT(env, that, SysFreeStrings_FUNC);
+}
+#endif
+
+#ifndef NO_CreateStreamOnBuffer
+/*
+* An IStream over the memory of a direct ByteBuffer.  The stream holds a
+* global reference to the buffer so that the memory stays valid for as
+* long as COM holds the stream.
+*/
+typedef struct BufferStream {
+	IStreamVtbl *lpVtbl;
+	LONG refCount;
+	JavaVM *vm;
+	jobject buffer;
+	BYTE *data;
+	ULONG capacity, size, position;
+	BOOL readOnly;
+} BufferStream;
+
+static const IID bufferStreamIID_IUnknown = {0x00000000, 0x0000, 0x0000, {0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46}};
+static const IID bufferStreamIID_ISequentialStream = {0x0C733A30, 0x2A1C, 0x11CE, {0xAD, 0xE5, 0x00, 0xAA, 0x00, 0x44, 0x77, 0x3D}};
+static const IID bufferStreamIID_IStream = {0x0000000C, 0x0000, 0x0000, {0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46}};
+
+static IStreamVtbl bufferStreamVtbl;
+
+static BufferStream *newBufferStream(JNIEnv *env, JavaVM *vm, jobject buffer, BYTE *data, ULONG capacity, ULONG size, BOOL readOnly)
+{
+	BufferStream *stream = HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(BufferStream));
+	if (stream == NULL) return NULL;
+	if ((stream->buffer = (*env)->NewGlobalRef(env, buffer)) == NULL) {
+		HeapFree(GetProcessHeap(), 0, stream);
+		return NULL;
+	}
+	stream->lpVtbl = &bufferStreamVtbl;
+	stream->refCount = 1;
+	stream->vm = vm;
+	stream->data = data;
+	stream->capacity = capacity;
+	stream->size = size;
+	stream->readOnly = readOnly;
+	return stream;
+}
+
+static HRESULT STDMETHODCALLTYPE bufferStreamQueryInterface(IStream *This, REFIID riid, void **ppvObject)
+{
+	if (ppvObject == NULL) return E_POINTER;
+	if (IsEqualIID(riid, &bufferStreamIID_IUnknown) || IsEqualIID(riid, &bufferStreamIID_ISequentialStream) || IsEqualIID(riid, &bufferStreamIID_IStream)) {
+		*ppvObject = This;
+		InterlockedIncrement(&((BufferStream *)This)->refCount);
+		return S_OK;
+	}
+	*ppvObject = NULL;
+	return E_NOINTERFACE;
+}
+
+static ULONG STDMETHODCALLTYPE bufferStreamAddRef(IStream *This)
+{
+	return InterlockedIncrement(&((BufferStream *)This)->refCount);
+}
+
+static ULONG STDMETHODCALLTYPE bufferStreamRelease(IStream *This)
+{
+	BufferStream *stream = (BufferStream *)This;
+	JNIEnv *env = NULL;
+	JavaVM *vm = stream->vm;
+	LONG refCount = InterlockedDecrement(&stream->refCount);
+	if (refCount != 0) return refCount;
+
+	/* COM may release the stream on a thread that is not attached to the VM */
+	if ((*vm)->GetEnv(vm, (void **)&env, JNI_VERSION_1_2) == JNI_OK) {
+		(*env)->DeleteGlobalRef(env, stream->buffer);
+	} else if ((*vm)->AttachCurrentThread(vm, (void **)&env, NULL) == JNI_OK) {
+		(*env)->DeleteGlobalRef(env, stream->buffer);
+		(*vm)->DetachCurrentThread(vm);
+	}
+	HeapFree(GetProcessHeap(), 0, stream);
+	return 0;
+}
+
+static HRESULT STDMETHODCALLTYPE bufferStreamRead(IStream *This, void *pv, ULONG cb, ULONG *pcbRead)
+{
+	BufferStream *stream = (BufferStream *)This;
+	ULONG count = 0;
+	if (pv == NULL) return STG_E_INVALIDPOINTER;
+	if (stream->position < stream->size) {
+		count = stream->size - stream->position;
+		if (count > cb) count = cb;
+		memmove(pv, stream->data + stream->position, count);
+		stream->position += count;
+	}
+	if (pcbRead != NULL) *pcbRead = count;
+	return S_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE bufferStreamWrite(IStream *This, const void *pv, ULONG cb, ULONG *pcbWritten)
+{
+	BufferStream *stream = (BufferStream *)This;
+	if (pcbWritten != NULL) *pcbWritten = 0;
+	if (pv == NULL) return STG_E_INVALIDPOINTER;
+	if (stream->readOnly) return STG_E_ACCESSDENIED;
+	if (stream->position > stream->capacity || cb > stream->capacity - stream->position) return STG_E_MEDIUMFULL;
+	if (stream->position > stream->size) memset(stream->data + stream->size, 0, stream->position - stream->size);
+	memmove(stream->data + stream->position, pv, cb);
+	stream->position += cb;
+	if (stream->position > stream->size) stream->size = stream->position;
+	if (pcbWritten != NULL) *pcbWritten = cb;
+	return S_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE bufferStreamSeek(IStream *This, LARGE_INTEGER dlibMove, DWORD dwOrigin, ULARGE_INTEGER *plibNewPosition)
+{
+	BufferStream *stream = (BufferStream *)This;
+	LONGLONG position;
+	switch (dwOrigin) {
+		case STREAM_SEEK_SET: position = 0; break;
+		case STREAM_SEEK_CUR: position = stream->position; break;
+		case STREAM_SEEK_END: position = stream->size; break;
+		default: return STG_E_INVALIDFUNCTION;
+	}
+	position += dlibMove.QuadPart;
+	if (position < 0 || position > 0xFFFFFFFF) return STG_E_INVALIDFUNCTION;
+	stream->position = (ULONG)position;
+	if (plibNewPosition != NULL) plibNewPosition->QuadPart = stream->position;
+	return S_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE bufferStreamSetSize(IStream *This, ULARGE_INTEGER libNewSize)
+{
+	BufferStream *stream = (BufferStream *)This;
+	if (stream->readOnly) return STG_E_ACCESSDENIED;
+	if (libNewSize.QuadPart > stream->capacity) return STG_E_MEDIUMFULL;
+	if (libNewSize.LowPart > stream->size) memset(stream->data + stream->size, 0, libNewSize.LowPart - stream->size);
+	stream->size = libNewSize.LowPart;
+	return S_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE bufferStreamCopyTo(IStream *This, IStream *pstm, ULARGE_INTEGER cb, ULARGE_INTEGER *pcbRead, ULARGE_INTEGER *pcbWritten)
+{
+	BufferStream *stream = (BufferStream *)This;
+	ULONG count = 0, written = 0;
+	HRESULT hr = S_OK;
+	if (pstm == NULL) return STG_E_INVALIDPOINTER;
+	if (stream->position < stream->size) {
+		count = stream->size - stream->position;
+		if (cb.QuadPart < count) count = cb.LowPart;
+		/* The target reads straight from the buffer memory */
+		hr = pstm->lpVtbl->Write(pstm, stream->data + stream->position, count, &written);
+		stream->position += count;
+	}
+	if (pcbRead != NULL) pcbRead->QuadPart = count;
+	if (pcbWritten != NULL) pcbWritten->QuadPart = written;
+	return hr;
+}
+
+static HRESULT STDMETHODCALLTYPE bufferStreamCommit(IStream *This, DWORD grfCommitFlags)
+{
+	return S_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE bufferStreamRevert(IStream *This)
+{
+	return S_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE bufferStreamLockRegion(IStream *This, ULARGE_INTEGER libOffset, ULARGE_INTEGER cb, DWORD dwLockType)
+{
+	return STG_E_INVALIDFUNCTION;
+}
+
+static HRESULT STDMETHODCALLTYPE bufferStreamStat(IStream *This, STATSTG *pstatstg, DWORD grfStatFlag)
+{
+	BufferStream *stream = (BufferStream *)This;
+	if (pstatstg == NULL) return STG_E_INVALIDPOINTER;
+	memset(pstatstg, 0, sizeof(STATSTG));
+	pstatstg->type = STGTY_STREAM;
+	pstatstg->cbSize.QuadPart = stream->size;
+	pstatstg->grfMode = stream->readOnly ? STGM_READ : STGM_READWRITE;
+	return S_OK;
+}
+
+static HRESULT STDMETHODCALLTYPE bufferStreamClone(IStream *This, IStream **ppstm)
+{
+	BufferStream *stream = (BufferStream *)This, *clone = NULL;
+	JNIEnv *env = NULL;
+	JavaVM *vm = stream->vm;
+	if (ppstm == NULL) return STG_E_INVALIDPOINTER;
+	*ppstm = NULL;
+	if ((*vm)->GetEnv(vm, (void **)&env, JNI_VERSION_1_2) == JNI_OK) {
+		clone = newBufferStream(env, vm, stream->buffer, stream->data, stream->capacity, stream->size, stream->readOnly);
+	} else if ((*vm)->AttachCurrentThread(vm, (void **)&env, NULL) == JNI_OK) {
+		clone = newBufferStream(env, vm, stream->buffer, stream->data, stream->capacity, stream->size, stream->readOnly);
+		(*vm)->DetachCurrentThread(vm);
+	}
+	if (clone == NULL) return E_OUTOFMEMORY;
+	clone->position = stream->position;
+	*ppstm = (IStream *)clone;
+	return S_OK;
+}
+
+static IStreamVtbl bufferStreamVtbl = {
+	bufferStreamQueryInterface,
+	bufferStreamAddRef,
+	bufferStreamRelease,
+	bufferStreamRead,
+	bufferStreamWrite,
+	bufferStreamSeek,
+	bufferStreamSetSize,
+	bufferStreamCopyTo,
+	bufferStreamCommit,
+	bufferStreamRevert,
+	bufferStreamLockRegion,
+	bufferStreamLockRegion, /* UnlockRegion */
+	bufferStreamStat,
+	bufferStreamClone,
+};
+
+JNIEXPORT jintLong JNICALL COM_NATIVE(CreateStreamOnBuffer)
+	(JNIEnv *env, jclass that, jobject arg0, jint arg1, jboolean arg2)
+{
+	JavaVM *vm = NULL;
+	BYTE *data = NULL;
+	jlong capacity;
+	jintLong rc = 0;
+	COM_NATIVE_ENTER(env, that, CreateStreamOnBuffer_FUNC);
+	if (arg0 == NULL || arg1 < 0) goto fail;
+	if ((capacity = (*env)->GetDirectBufferCapacity(env, arg0)) < arg1 || capacity > 0x7FFFFFFF) goto fail;
+	if ((data = (*env)->GetDirectBufferAddress(env, arg0)) == NULL) goto fail;
+	if ((*env)->GetJavaVM(env, &vm) != 0) goto fail;
+	rc = (jintLong)newBufferStream(env, vm, arg0, data, (ULONG)capacity, (ULONG)arg1, arg2);
+fail:
+	COM_NATIVE_EXIT(env, that, CreateStreamOnBuffer_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_SetVARIANTs
+/*
+* Sets count VARIANTs of the array at rgvar in one call.  Each VARIANT gets
+* the type of types[i], which must be VT_I4, VT_DISPATCH or VT_UNKNOWN, and
+* values[i] as its value.  The VARIANTs are not cleared first, so they must
+* be empty.  Returns FALSE without changing any VARIANT if an argument is
+* not valid.
+*/
+JNIEXPORT jboolean JNICALL COM_NATIVE(SetVARIANTs)
+	(JNIEnv *env, jclass that, jintLong arg0, jshortArray arg1, jintLongArray arg2, jint arg3)
+{
+	jshort *lparg1 = NULL;
+	jintLong *lparg2 = NULL;
+	VARIANT *variants = (VARIANT *)arg0;
+	jint i;
+	jboolean rc = 0;
+	COM_NATIVE_ENTER(env, that, SetVARIANTs_FUNC);
+	if (arg0 == 0 || arg1 == NULL || arg2 == NULL || arg3 < 0) goto fail;
+	if (arg3 > (*env)->GetArrayLength(env, arg1) || arg3 > (*env)->GetArrayLength(env, arg2)) goto fail;
+	if ((lparg1 = (*env)->GetShortArrayElements(env, arg1, NULL)) == NULL) goto fail;
+	if ((lparg2 = (*env)->GetIntLongArrayElements(env, arg2, NULL)) == NULL) goto fail;
+	for (i = 0; i < arg3; i++) {
+		if (lparg1[i] != VT_I4 && lparg1[i] != VT_DISPATCH && lparg1[i] != VT_UNKNOWN) goto fail;
+	}
+	for (i = 0; i < arg3; i++) {
+		VariantInit(&variants[i]);
+		variants[i].vt = (VARTYPE)lparg1[i];
+		if (lparg1[i] == VT_I4) {
+			variants[i].lVal = (LONG)lparg2[i];
+		} else {
+			variants[i].punkVal = (IUnknown *)lparg2[i];
+		}
+	}
+	rc = 1;
+fail:
+	if (arg2 && lparg2) (*env)->ReleaseIntLongArrayElements(env, arg2, lparg2, JNI_ABORT);
+	if (arg1 && lparg1) (*env)->ReleaseShortArrayElements(env, arg1, lparg1, JNI_ABORT);
+	COM_NATIVE_EXIT(env, that, SetVARIANTs_FUNC);
+	return rc;
+}
+#endif
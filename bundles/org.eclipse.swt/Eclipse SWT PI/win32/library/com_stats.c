@@ -17,6 +17,8 @@
 char * COM_nativeFunctionNames[] = {
 	"AccessibleChildren",
 	"AccessibleObjectFromWindow",
+	"BSTRFromString",
+	"BSTRToString",
 	"CALLBACK_1setCurrentValue",
 	"CAUUID_1sizeof",
 	"CLSIDFromProgID",
@@ -28,6 +30,7 @@ char * COM_nativeFunctionNames[] = {
 	"CoGetClassObject",
 	"CoLockObjectExternal",
 	"CreateStdAccessibleObject",
+	"CreateStreamOnBuffer",
 	"DISPPARAMS_1sizeof",
 	"DVTARGETDEVICE_1sizeof",
 	"DoDragDrop",
@@ -38,9 +41,14 @@ char * COM_nativeFunctionNames[] = {
 	"GUID_1sizeof",
 	"GetClassFile",
 	"IIDFromString",
-	"IsEqualGUID",
+	"InvokeBatch",
 	"LICINFO_1sizeof",
 	"LresultFromObject",
+#ifndef JNI64
+	"MoveMemory__ILorg_eclipse_swt_internal_ole_win32_DISPPARAMS_2I",
+#else
+	"MoveMemory__JLorg_eclipse_swt_internal_ole_win32_DISPPARAMS_2I",
+#endif
 #ifndef JNI64
 	"MoveMemory__ILorg_eclipse_swt_internal_ole_win32_FORMATETC_2I",
 #else
@@ -71,6 +79,11 @@ char * COM_nativeFunctionNames[] = {
 #else
 	"MoveMemory__Lorg_eclipse_swt_internal_ole_win32_DISPPARAMS_2JI",
 #endif
+#ifndef JNI64
+	"MoveMemory__Lorg_eclipse_swt_internal_ole_win32_EXCEPINFO_2II",
+#else
+	"MoveMemory__Lorg_eclipse_swt_internal_ole_win32_EXCEPINFO_2JI",
+#endif
 #ifndef JNI64
 	"MoveMemory__Lorg_eclipse_swt_internal_ole_win32_FORMATETC_2II",
 #else
@@ -140,12 +153,14 @@ char * COM_nativeFunctionNames[] = {
 	"SHDoDragDrop",
 	"STATSTG_1sizeof",
 	"STGMEDIUM_1sizeof",
+	"SetVARIANTs",
 	"StgCreateDocfile",
 	"StgIsStorageFile",
 	"StgOpenStorage",
 	"StringFromCLSID",
 	"SysAllocString",
 	"SysFreeString",
+	"SysFreeStrings",
 	"SysStringByteLen",
 	"SysStringLen",
 	"TYPEATTR_1sizeof",
@@ -551,12 +566,22 @@ char * COM_nativeFunctionNames[] = {
 #else
 	"VtblCall__IJJIIIIJ",
 #endif
+	"VtblCallBound0",
+	"VtblCallBound1",
+	"VtblCallBound2",
+	"VtblCallBound3",
+	"VtblCallBound4",
+	"VtblCallBound5",
+	"VtblCallBound6",
+	"VtblCallBound7",
+	"VtblCallBound8",
 	"VtblCall_1IVARIANT",
 	"VtblCall_1IVARIANTP",
 	"VtblCall_1PPPPVARIANT",
 	"VtblCall_1PVARIANTP",
 	"VtblCall_1VARIANT",
 	"VtblCall_1VARIANTP",
+	"VtblResolve",
 	"WriteClassStg",
 	"accDoDefaultAction_1CALLBACK",
 	"accLocation_1CALLBACK",
@@ -578,6 +603,9 @@ char * COM_nativeFunctionNames[] = {
 #define NATIVE_FUNCTION_COUNT sizeof(COM_nativeFunctionNames) / sizeof(char*)
 int COM_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int COM_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong COM_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT COM_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS COM_nativeStats = {COM_nativeFunctionCallCount, COM_nativeFunctionCallTime, COM_nativeFunctionEvents, 0, "COM", COM_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -599,4 +627,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(COM_1GetFunctionCallCount)
 	return COM_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(COM_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return COM_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(COM_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(COM_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &COM_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(COM_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(COM_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(COM_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(COM_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(COM_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
@@ -13,8 +13,9 @@
 extern int COM_nativeFunctionCount;
 extern int COM_nativeFunctionCallCount[];
 extern char* COM_nativeFunctionNames[];
-#define COM_NATIVE_ENTER(env, that, func) COM_nativeFunctionCallCount[func]++;
-#define COM_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS COM_nativeStats;
+#define COM_NATIVE_ENTER(env, that, func) nativeStatsEnter(&COM_nativeStats, func);
+#define COM_NATIVE_EXIT(env, that, func) nativeStatsExit(&COM_nativeStats, func);
 #else
 #ifndef COM_NATIVE_ENTER
 #define COM_NATIVE_ENTER(env, that, func) 
@@ -27,6 +28,8 @@ extern char* COM_nativeFunctionNames[];
 typedef enum {
 	AccessibleChildren_FUNC,
 	AccessibleObjectFromWindow_FUNC,
+	BSTRFromString_FUNC,
+	BSTRToString_FUNC,
 	CALLBACK_1setCurrentValue_FUNC,
 	CAUUID_1sizeof_FUNC,
 	CLSIDFromProgID_FUNC,
@@ -38,6 +41,7 @@ typedef enum {
 	CoGetClassObject_FUNC,
 	CoLockObjectExternal_FUNC,
 	CreateStdAccessibleObject_FUNC,
+	CreateStreamOnBuffer_FUNC,
 	DISPPARAMS_1sizeof_FUNC,
 	DVTARGETDEVICE_1sizeof_FUNC,
 	DoDragDrop_FUNC,
@@ -48,9 +52,14 @@ typedef enum {
 	GUID_1sizeof_FUNC,
 	GetClassFile_FUNC,
 	IIDFromString_FUNC,
-	IsEqualGUID_FUNC,
+	InvokeBatch_FUNC,
 	LICINFO_1sizeof_FUNC,
 	LresultFromObject_FUNC,
+#ifndef JNI64
+	MoveMemory__ILorg_eclipse_swt_internal_ole_win32_DISPPARAMS_2I_FUNC,
+#else
+	MoveMemory__JLorg_eclipse_swt_internal_ole_win32_DISPPARAMS_2I_FUNC,
+#endif
 #ifndef JNI64
 	MoveMemory__ILorg_eclipse_swt_internal_ole_win32_FORMATETC_2I_FUNC,
 #else
@@ -81,6 +90,11 @@ typedef enum {
 #else
 	MoveMemory__Lorg_eclipse_swt_internal_ole_win32_DISPPARAMS_2JI_FUNC,
 #endif
+#ifndef JNI64
+	MoveMemory__Lorg_eclipse_swt_internal_ole_win32_EXCEPINFO_2II_FUNC,
+#else
+	MoveMemory__Lorg_eclipse_swt_internal_ole_win32_EXCEPINFO_2JI_FUNC,
+#endif
 #ifndef JNI64
 	MoveMemory__Lorg_eclipse_swt_internal_ole_win32_FORMATETC_2II_FUNC,
 #else
@@ -150,12 +164,14 @@ typedef enum {
 	SHDoDragDrop_FUNC,
 	STATSTG_1sizeof_FUNC,
 	STGMEDIUM_1sizeof_FUNC,
+	SetVARIANTs_FUNC,
 	StgCreateDocfile_FUNC,
 	StgIsStorageFile_FUNC,
 	StgOpenStorage_FUNC,
 	StringFromCLSID_FUNC,
 	SysAllocString_FUNC,
 	SysFreeString_FUNC,
+	SysFreeStrings_FUNC,
 	SysStringByteLen_FUNC,
 	SysStringLen_FUNC,
 	TYPEATTR_1sizeof_FUNC,
@@ -561,12 +577,22 @@ typedef enum {
 #else
 	VtblCall__IJJIIIIJ_FUNC,
 #endif
+	VtblCallBound0_FUNC,
+	VtblCallBound1_FUNC,
+	VtblCallBound2_FUNC,
+	VtblCallBound3_FUNC,
+	VtblCallBound4_FUNC,
+	VtblCallBound5_FUNC,
+	VtblCallBound6_FUNC,
+	VtblCallBound7_FUNC,
+	VtblCallBound8_FUNC,
 	VtblCall_1IVARIANT_FUNC,
 	VtblCall_1IVARIANTP_FUNC,
 	VtblCall_1PPPPVARIANT_FUNC,
 	VtblCall_1PVARIANTP_FUNC,
 	VtblCall_1VARIANT_FUNC,
 	VtblCall_1VARIANTP_FUNC,
+	VtblResolve_FUNC,
 	WriteClassStg_FUNC,
 	accDoDefaultAction_1CALLBACK_FUNC,
 	accLocation_1CALLBACK_FUNC,
@@ -18,8 +18,8 @@
 #endif
 
 #ifndef NO_BitmapData_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(BitmapData_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(BitmapData_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(BitmapData_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(BitmapData_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, BitmapData_1delete_FUNC);
@@ -29,8 +29,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(BitmapData_1delete)
 #endif
 
 #ifndef NO_BitmapData_1new
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(BitmapData_1new)(JNIEnv *env, jclass that);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(BitmapData_1new)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(BitmapData_1new)(JNIEnv *env, jclass that);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(BitmapData_1new)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -42,8 +42,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(BitmapData_1new)
 #endif
 
 #ifndef NO_Bitmap_1GetHBITMAP
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Bitmap_1GetHBITMAP)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLongArray arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Bitmap_1GetHBITMAP)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Bitmap_1GetHBITMAP)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLongArray arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Bitmap_1GetHBITMAP)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLongArray arg2)
 {
 	jintLong *lparg2=NULL;
@@ -59,8 +59,8 @@ fail:
 #endif
 
 #ifndef NO_Bitmap_1GetHICON
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Bitmap_1GetHICON)(JNIEnv *env, jclass that, jintLong arg0, jintLongArray arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Bitmap_1GetHICON)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Bitmap_1GetHICON)(JNIEnv *env, jclass that, jintLong arg0, jintLongArray arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Bitmap_1GetHICON)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLongArray arg1)
 {
 	jintLong *lparg1=NULL;
@@ -76,8 +76,8 @@ fail:
 #endif
 
 #ifndef NO_Bitmap_1LockBits
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Bitmap_1LockBits)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jintLong arg4);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Bitmap_1LockBits)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Bitmap_1LockBits)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jintLong arg4);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Bitmap_1LockBits)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jintLong arg4)
 {
 	jint rc = 0;
@@ -89,8 +89,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Bitmap_1LockBits)
 #endif
 
 #ifndef NO_Bitmap_1UnlockBits
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Bitmap_1UnlockBits)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Bitmap_1UnlockBits)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Bitmap_1UnlockBits)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Bitmap_1UnlockBits)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jint rc = 0;
@@ -102,8 +102,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Bitmap_1UnlockBits)
 #endif
 
 #ifndef NO_Bitmap_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(Bitmap_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(Bitmap_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Bitmap_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Bitmap_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, Bitmap_1delete_FUNC);
@@ -114,11 +114,11 @@ JNIEXPORT void JNICALL Gdip_NATIVE(Bitmap_1delete)
 
 #if (!defined(NO_Bitmap_1new__I) && !defined(JNI64)) || (!defined(NO_Bitmap_1new__J) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__I)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__I)(JNIEnv *env, jclass that, jintLong arg0)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__I)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__I)(JNIEnv *env, jclass that, jintLong arg0)
 #else
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__J)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__J)(JNIEnv *env, jclass that, jintLong arg0)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__J)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__J)(JNIEnv *env, jclass that, jintLong arg0)
 #endif
 {
 	jintLong rc = 0;
@@ -139,11 +139,11 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__J)(JNIEnv *env, jclass that,
 
 #if (!defined(NO_Bitmap_1new__II) && !defined(JNI64)) || (!defined(NO_Bitmap_1new__JJ) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 #else
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 #endif
 {
 	jintLong rc = 0;
@@ -164,11 +164,11 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__JJ)(JNIEnv *env, jclass that
 
 #if (!defined(NO_Bitmap_1new__IIIII) && !defined(JNI64)) || (!defined(NO_Bitmap_1new__IIIIJ) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__IIIII)(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jintLong arg4);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__IIIII)(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jintLong arg4)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__IIIII)(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jintLong arg4);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__IIIII)(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jintLong arg4)
 #else
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__IIIIJ)(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jintLong arg4);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__IIIIJ)(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jintLong arg4)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__IIIIJ)(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jintLong arg4);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__IIIIJ)(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jintLong arg4)
 #endif
 {
 	jintLong rc = 0;
@@ -188,8 +188,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new__IIIIJ)(JNIEnv *env, jclass t
 #endif
 
 #ifndef NO_Bitmap_1new___3CZ
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new___3CZ)(JNIEnv *env, jclass that, jcharArray arg0, jboolean arg1);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new___3CZ)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new___3CZ)(JNIEnv *env, jclass that, jcharArray arg0, jboolean arg1);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Bitmap_1new___3CZ)
 	(JNIEnv *env, jclass that, jcharArray arg0, jboolean arg1)
 {
 	jchar *lparg0=NULL;
@@ -205,8 +205,8 @@ fail:
 #endif
 
 #ifndef NO_Brush_1Clone
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Brush_1Clone)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Brush_1Clone)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Brush_1Clone)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Brush_1Clone)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -218,8 +218,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Brush_1Clone)
 #endif
 
 #ifndef NO_Brush_1GetType
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Brush_1GetType)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Brush_1GetType)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Brush_1GetType)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Brush_1GetType)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -231,8 +231,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Brush_1GetType)
 #endif
 
 #ifndef NO_ColorPalette_1sizeof
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(ColorPalette_1sizeof)(JNIEnv *env, jclass that);
-JNIEXPORT jint JNICALL Gdip_NATIVE(ColorPalette_1sizeof)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(ColorPalette_1sizeof)(JNIEnv *env, jclass that);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(ColorPalette_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -244,8 +244,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(ColorPalette_1sizeof)
 #endif
 
 #ifndef NO_Color_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(Color_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(Color_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Color_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Color_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, Color_1delete_FUNC);
@@ -255,8 +255,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(Color_1delete)
 #endif
 
 #ifndef NO_Color_1new
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Color_1new)(JNIEnv *env, jclass that, jint arg0);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Color_1new)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Color_1new)(JNIEnv *env, jclass that, jint arg0);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Color_1new)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -268,8 +268,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Color_1new)
 #endif
 
 #ifndef NO_FontFamily_1GetFamilyName
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(FontFamily_1GetFamilyName)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jchar arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(FontFamily_1GetFamilyName)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(FontFamily_1GetFamilyName)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jchar arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(FontFamily_1GetFamilyName)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jchar arg2)
 {
 	jchar *lparg1=NULL;
@@ -285,8 +285,8 @@ fail:
 #endif
 
 #ifndef NO_FontFamily_1IsAvailable
-extern "C" JNIEXPORT jboolean JNICALL Gdip_NATIVE(FontFamily_1IsAvailable)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jboolean JNICALL Gdip_NATIVE(FontFamily_1IsAvailable)
+extern "C" SWT_NATIVE_EXPORT jboolean JNICALL Gdip_NATIVE(FontFamily_1IsAvailable)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jboolean JNICALL Gdip_NATIVE(FontFamily_1IsAvailable)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -298,8 +298,8 @@ JNIEXPORT jboolean JNICALL Gdip_NATIVE(FontFamily_1IsAvailable)
 #endif
 
 #ifndef NO_FontFamily_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(FontFamily_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(FontFamily_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(FontFamily_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(FontFamily_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, FontFamily_1delete_FUNC);
@@ -309,8 +309,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(FontFamily_1delete)
 #endif
 
 #ifndef NO_FontFamily_1new__
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(FontFamily_1new__)(JNIEnv *env, jclass that);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(FontFamily_1new__)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(FontFamily_1new__)(JNIEnv *env, jclass that);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(FontFamily_1new__)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -323,11 +323,11 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(FontFamily_1new__)
 
 #if (!defined(NO_FontFamily_1new___3CI) && !defined(JNI64)) || (!defined(NO_FontFamily_1new___3CJ) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(FontFamily_1new___3CI)(JNIEnv *env, jclass that, jcharArray arg0, jintLong arg1);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(FontFamily_1new___3CI)(JNIEnv *env, jclass that, jcharArray arg0, jintLong arg1)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(FontFamily_1new___3CI)(JNIEnv *env, jclass that, jcharArray arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(FontFamily_1new___3CI)(JNIEnv *env, jclass that, jcharArray arg0, jintLong arg1)
 #else
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(FontFamily_1new___3CJ)(JNIEnv *env, jclass that, jcharArray arg0, jintLong arg1);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(FontFamily_1new___3CJ)(JNIEnv *env, jclass that, jcharArray arg0, jintLong arg1)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(FontFamily_1new___3CJ)(JNIEnv *env, jclass that, jcharArray arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(FontFamily_1new___3CJ)(JNIEnv *env, jclass that, jcharArray arg0, jintLong arg1)
 #endif
 {
 	jchar *lparg0=NULL;
@@ -340,7 +340,7 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(FontFamily_1new___3CJ)(JNIEnv *env, jclas
 	if (arg0) if ((lparg0 = env->GetCharArrayElements(arg0, NULL)) == NULL) goto fail;
 	rc = (jintLong)new FontFamily((const WCHAR *)lparg0, (const FontCollection *)arg1);
 fail:
-	if (arg0 && lparg0) env->ReleaseCharArrayElements(arg0, lparg0, 0);
+	if (arg0 && lparg0) env->ReleaseCharArrayElements(arg0, lparg0, JNI_ABORT);
 #ifndef JNI64
 	Gdip_NATIVE_EXIT(env, that, FontFamily_1new___3CI_FUNC);
 #else
@@ -351,8 +351,8 @@ fail:
 #endif
 
 #ifndef NO_Font_1GetFamily
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Font_1GetFamily)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Font_1GetFamily)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Font_1GetFamily)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Font_1GetFamily)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jint rc = 0;
@@ -364,8 +364,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Font_1GetFamily)
 #endif
 
 #ifndef NO_Font_1GetLogFontW
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Font_1GetLogFontW)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Font_1GetLogFontW)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Font_1GetLogFontW)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Font_1GetLogFontW)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 {
 	jint rc = 0;
@@ -377,8 +377,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Font_1GetLogFontW)
 #endif
 
 #ifndef NO_Font_1GetSize
-extern "C" JNIEXPORT jfloat JNICALL Gdip_NATIVE(Font_1GetSize)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jfloat JNICALL Gdip_NATIVE(Font_1GetSize)
+extern "C" SWT_NATIVE_EXPORT jfloat JNICALL Gdip_NATIVE(Font_1GetSize)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jfloat JNICALL Gdip_NATIVE(Font_1GetSize)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jfloat rc = 0;
@@ -390,8 +390,8 @@ JNIEXPORT jfloat JNICALL Gdip_NATIVE(Font_1GetSize)
 #endif
 
 #ifndef NO_Font_1GetStyle
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Font_1GetStyle)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Font_1GetStyle)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Font_1GetStyle)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Font_1GetStyle)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -403,8 +403,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Font_1GetStyle)
 #endif
 
 #ifndef NO_Font_1IsAvailable
-extern "C" JNIEXPORT jboolean JNICALL Gdip_NATIVE(Font_1IsAvailable)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jboolean JNICALL Gdip_NATIVE(Font_1IsAvailable)
+extern "C" SWT_NATIVE_EXPORT jboolean JNICALL Gdip_NATIVE(Font_1IsAvailable)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jboolean JNICALL Gdip_NATIVE(Font_1IsAvailable)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -416,8 +416,8 @@ JNIEXPORT jboolean JNICALL Gdip_NATIVE(Font_1IsAvailable)
 #endif
 
 #ifndef NO_Font_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(Font_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(Font_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Font_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Font_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, Font_1delete_FUNC);
@@ -428,11 +428,11 @@ JNIEXPORT void JNICALL Gdip_NATIVE(Font_1delete)
 
 #if (!defined(NO_Font_1new__IFII) && !defined(JNI64)) || (!defined(NO_Font_1new__JFII) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__IFII)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jint arg2, jint arg3);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__IFII)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jint arg2, jint arg3)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__IFII)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jint arg2, jint arg3);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__IFII)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jint arg2, jint arg3)
 #else
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__JFII)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jint arg2, jint arg3);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__JFII)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jint arg2, jint arg3)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__JFII)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jint arg2, jint arg3);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__JFII)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jint arg2, jint arg3)
 #endif
 {
 	jintLong rc = 0;
@@ -453,11 +453,11 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__JFII)(JNIEnv *env, jclass that
 
 #if (!defined(NO_Font_1new__II) && !defined(JNI64)) || (!defined(NO_Font_1new__JJ) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 #else
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 #endif
 {
 	jintLong rc = 0;
@@ -478,11 +478,11 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Font_1new__JJ)(JNIEnv *env, jclass that,
 
 #if (!defined(NO_Font_1new___3CFIII) && !defined(JNI64)) || (!defined(NO_Font_1new___3CFIIJ) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Font_1new___3CFIII)(JNIEnv *env, jclass that, jcharArray arg0, jfloat arg1, jint arg2, jint arg3, jintLong arg4);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Font_1new___3CFIII)(JNIEnv *env, jclass that, jcharArray arg0, jfloat arg1, jint arg2, jint arg3, jintLong arg4)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Font_1new___3CFIII)(JNIEnv *env, jclass that, jcharArray arg0, jfloat arg1, jint arg2, jint arg3, jintLong arg4);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Font_1new___3CFIII)(JNIEnv *env, jclass that, jcharArray arg0, jfloat arg1, jint arg2, jint arg3, jintLong arg4)
 #else
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Font_1new___3CFIIJ)(JNIEnv *env, jclass that, jcharArray arg0, jfloat arg1, jint arg2, jint arg3, jintLong arg4);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Font_1new___3CFIIJ)(JNIEnv *env, jclass that, jcharArray arg0, jfloat arg1, jint arg2, jint arg3, jintLong arg4)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Font_1new___3CFIIJ)(JNIEnv *env, jclass that, jcharArray arg0, jfloat arg1, jint arg2, jint arg3, jintLong arg4);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Font_1new___3CFIIJ)(JNIEnv *env, jclass that, jcharArray arg0, jfloat arg1, jint arg2, jint arg3, jintLong arg4)
 #endif
 {
 	jchar *lparg0=NULL;
@@ -495,7 +495,7 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Font_1new___3CFIIJ)(JNIEnv *env, jclass t
 	if (arg0) if ((lparg0 = env->GetCharArrayElements(arg0, NULL)) == NULL) goto fail;
 	rc = (jintLong)new Font((const WCHAR *)lparg0, (REAL)arg1, (INT)arg2, (Unit)arg3, (const FontCollection *)arg4);
 fail:
-	if (arg0 && lparg0) env->ReleaseCharArrayElements(arg0, lparg0, 0);
+	if (arg0 && lparg0) env->ReleaseCharArrayElements(arg0, lparg0, JNI_ABORT);
 #ifndef JNI64
 	Gdip_NATIVE_EXIT(env, that, Font_1new___3CFIII_FUNC);
 #else
@@ -506,8 +506,8 @@ fail:
 #endif
 
 #ifndef NO_GdiplusShutdown
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(GdiplusShutdown)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(GdiplusShutdown)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(GdiplusShutdown)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(GdiplusShutdown)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, GdiplusShutdown_FUNC);
@@ -517,8 +517,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(GdiplusShutdown)
 #endif
 
 #ifndef NO_GdiplusStartup
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GdiplusStartup)(JNIEnv *env, jclass that, jintLongArray arg0, jobject arg1, jintLong arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GdiplusStartup)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GdiplusStartup)(JNIEnv *env, jclass that, jintLongArray arg0, jobject arg1, jintLong arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GdiplusStartup)
 	(JNIEnv *env, jclass that, jintLongArray arg0, jobject arg1, jintLong arg2)
 {
 	jintLong *lparg0=NULL;
@@ -529,7 +529,6 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(GdiplusStartup)
 	if (arg1) if ((lparg1 = getGdiplusStartupInputFields(env, arg1, &_arg1)) == NULL) goto fail;
 	rc = (jint)GdiplusStartup((ULONG_PTR *)lparg0, (const GdiplusStartupInput *)lparg1, (GdiplusStartupOutput *)arg2);
 fail:
-	if (arg1 && lparg1) setGdiplusStartupInputFields(env, arg1, lparg1);
 	if (arg0 && lparg0) env->ReleaseIntLongArrayElements(arg0, lparg0, 0);
 	Gdip_NATIVE_EXIT(env, that, GdiplusStartup_FUNC);
 	return rc;
@@ -537,8 +536,8 @@ fail:
 #endif
 
 #ifndef NO_GdiplusStartupInput_1sizeof
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GdiplusStartupInput_1sizeof)(JNIEnv *env, jclass that);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GdiplusStartupInput_1sizeof)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GdiplusStartupInput_1sizeof)(JNIEnv *env, jclass that);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GdiplusStartupInput_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -550,8 +549,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(GdiplusStartupInput_1sizeof)
 #endif
 
 #ifndef NO_GraphicsPath_1AddArc
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddArc)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jfloat arg3, jfloat arg4, jfloat arg5, jfloat arg6);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddArc)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddArc)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jfloat arg3, jfloat arg4, jfloat arg5, jfloat arg6);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddArc)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jfloat arg3, jfloat arg4, jfloat arg5, jfloat arg6)
 {
 	jint rc = 0;
@@ -563,8 +562,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddArc)
 #endif
 
 #ifndef NO_GraphicsPath_1AddBezier
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddBezier)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jfloat arg3, jfloat arg4, jfloat arg5, jfloat arg6, jfloat arg7, jfloat arg8);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddBezier)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddBezier)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jfloat arg3, jfloat arg4, jfloat arg5, jfloat arg6, jfloat arg7, jfloat arg8);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddBezier)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jfloat arg3, jfloat arg4, jfloat arg5, jfloat arg6, jfloat arg7, jfloat arg8)
 {
 	jint rc = 0;
@@ -576,8 +575,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddBezier)
 #endif
 
 #ifndef NO_GraphicsPath_1AddLine
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddLine)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jfloat arg3, jfloat arg4);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddLine)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddLine)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jfloat arg3, jfloat arg4);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddLine)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jfloat arg3, jfloat arg4)
 {
 	jint rc = 0;
@@ -589,8 +588,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddLine)
 #endif
 
 #ifndef NO_GraphicsPath_1AddPath
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddPath)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddPath)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddPath)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddPath)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2)
 {
 	jint rc = 0;
@@ -602,8 +601,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddPath)
 #endif
 
 #ifndef NO_GraphicsPath_1AddRectangle
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddRectangle)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddRectangle)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddRectangle)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddRectangle)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	RectF _arg1, *lparg1=NULL;
@@ -619,8 +618,8 @@ fail:
 #endif
 
 #ifndef NO_GraphicsPath_1AddString
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddString)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jint arg4, jfloat arg5, jobject arg6, jintLong arg7);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddString)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddString)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jint arg4, jfloat arg5, jobject arg6, jintLong arg7);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddString)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jint arg4, jfloat arg5, jobject arg6, jintLong arg7)
 {
 	jchar *lparg1=NULL;
@@ -631,16 +630,15 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1AddString)
 	if (arg6) if ((lparg6 = getPointFFields(env, arg6, &_arg6)) == NULL) goto fail;
 	rc = (jint)((GraphicsPath *)arg0)->AddString((const WCHAR *)lparg1, (INT)arg2, (const FontFamily *)arg3, (INT)arg4, (REAL)arg5, *(const PointF *)lparg6, (const StringFormat *)arg7);
 fail:
-	if (arg6 && lparg6) setPointFFields(env, arg6, lparg6);
-	if (arg1 && lparg1) env->ReleaseCharArrayElements(arg1, lparg1, 0);
+	if (arg1 && lparg1) env->ReleaseCharArrayElements(arg1, lparg1, JNI_ABORT);
 	Gdip_NATIVE_EXIT(env, that, GraphicsPath_1AddString_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_GraphicsPath_1Clone
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(GraphicsPath_1Clone)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(GraphicsPath_1Clone)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(GraphicsPath_1Clone)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(GraphicsPath_1Clone)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -652,8 +650,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(GraphicsPath_1Clone)
 #endif
 
 #ifndef NO_GraphicsPath_1CloseFigure
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1CloseFigure)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1CloseFigure)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1CloseFigure)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1CloseFigure)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -665,8 +663,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1CloseFigure)
 #endif
 
 #ifndef NO_GraphicsPath_1Flatten
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1Flatten)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloat arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1Flatten)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1Flatten)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloat arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1Flatten)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jfloat arg2)
 {
 	jint rc = 0;
@@ -678,8 +676,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1Flatten)
 #endif
 
 #ifndef NO_GraphicsPath_1GetBounds
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetBounds)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2, jintLong arg3);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetBounds)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetBounds)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2, jintLong arg3);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetBounds)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2, jintLong arg3)
 {
 	RectF _arg1, *lparg1=NULL;
@@ -695,8 +693,8 @@ fail:
 #endif
 
 #ifndef NO_GraphicsPath_1GetLastPoint
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetLastPoint)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetLastPoint)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetLastPoint)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetLastPoint)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	PointF _arg1, *lparg1=NULL;
@@ -712,8 +710,8 @@ fail:
 #endif
 
 #ifndef NO_GraphicsPath_1GetPathTypes
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetPathTypes)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetPathTypes)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetPathTypes)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetPathTypes)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2)
 {
 	jbyte *lparg1=NULL;
@@ -729,8 +727,8 @@ fail:
 #endif
 
 #ifndef NO_GraphicsPath_1GetPointCount
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetPointCount)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetPointCount)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetPointCount)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetPointCount)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -742,8 +740,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetPointCount)
 #endif
 
 #ifndef NO_GraphicsPath_1IsOutlineVisible
-extern "C" JNIEXPORT jboolean JNICALL Gdip_NATIVE(GraphicsPath_1IsOutlineVisible)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jintLong arg3, jintLong arg4);
-JNIEXPORT jboolean JNICALL Gdip_NATIVE(GraphicsPath_1IsOutlineVisible)
+extern "C" SWT_NATIVE_EXPORT jboolean JNICALL Gdip_NATIVE(GraphicsPath_1IsOutlineVisible)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jintLong arg3, jintLong arg4);
+SWT_NATIVE_EXPORT jboolean JNICALL Gdip_NATIVE(GraphicsPath_1IsOutlineVisible)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jintLong arg3, jintLong arg4)
 {
 	jboolean rc = 0;
@@ -755,8 +753,8 @@ JNIEXPORT jboolean JNICALL Gdip_NATIVE(GraphicsPath_1IsOutlineVisible)
 #endif
 
 #ifndef NO_GraphicsPath_1IsVisible
-extern "C" JNIEXPORT jboolean JNICALL Gdip_NATIVE(GraphicsPath_1IsVisible)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jintLong arg3);
-JNIEXPORT jboolean JNICALL Gdip_NATIVE(GraphicsPath_1IsVisible)
+extern "C" SWT_NATIVE_EXPORT jboolean JNICALL Gdip_NATIVE(GraphicsPath_1IsVisible)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jintLong arg3);
+SWT_NATIVE_EXPORT jboolean JNICALL Gdip_NATIVE(GraphicsPath_1IsVisible)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jintLong arg3)
 {
 	jboolean rc = 0;
@@ -768,8 +766,8 @@ JNIEXPORT jboolean JNICALL Gdip_NATIVE(GraphicsPath_1IsVisible)
 #endif
 
 #ifndef NO_GraphicsPath_1SetFillMode
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1SetFillMode)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1SetFillMode)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1SetFillMode)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1SetFillMode)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -781,8 +779,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1SetFillMode)
 #endif
 
 #ifndef NO_GraphicsPath_1StartFigure
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1StartFigure)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1StartFigure)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1StartFigure)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1StartFigure)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -794,8 +792,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1StartFigure)
 #endif
 
 #ifndef NO_GraphicsPath_1Transform
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1Transform)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1Transform)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1Transform)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1Transform)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jint rc = 0;
@@ -807,8 +805,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1Transform)
 #endif
 
 #ifndef NO_GraphicsPath_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(GraphicsPath_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(GraphicsPath_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(GraphicsPath_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(GraphicsPath_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, GraphicsPath_1delete_FUNC);
@@ -818,8 +816,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(GraphicsPath_1delete)
 #endif
 
 #ifndef NO_GraphicsPath_1new__I
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(GraphicsPath_1new__I)(JNIEnv *env, jclass that, jint arg0);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(GraphicsPath_1new__I)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(GraphicsPath_1new__I)(JNIEnv *env, jclass that, jint arg0);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(GraphicsPath_1new__I)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -831,8 +829,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(GraphicsPath_1new__I)
 #endif
 
 #ifndef NO_Graphics_1DrawArc
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawArc)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5, jfloat arg6, jfloat arg7);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawArc)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawArc)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5, jfloat arg6, jfloat arg7);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawArc)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5, jfloat arg6, jfloat arg7)
 {
 	jint rc = 0;
@@ -845,11 +843,11 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawArc)
 
 #if (!defined(NO_Graphics_1DrawDriverString__IIIIILorg_eclipse_swt_internal_gdip_PointF_2II) && !defined(JNI64)) || (!defined(NO_Graphics_1DrawDriverString__JJIJJLorg_eclipse_swt_internal_gdip_PointF_2IJ) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawDriverString__IIIIILorg_eclipse_swt_internal_gdip_PointF_2II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLong arg3, jintLong arg4, jobject arg5, jint arg6, jintLong arg7);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawDriverString__IIIIILorg_eclipse_swt_internal_gdip_PointF_2II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLong arg3, jintLong arg4, jobject arg5, jint arg6, jintLong arg7)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawDriverString__IIIIILorg_eclipse_swt_internal_gdip_PointF_2II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLong arg3, jintLong arg4, jobject arg5, jint arg6, jintLong arg7);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawDriverString__IIIIILorg_eclipse_swt_internal_gdip_PointF_2II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLong arg3, jintLong arg4, jobject arg5, jint arg6, jintLong arg7)
 #else
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawDriverString__JJIJJLorg_eclipse_swt_internal_gdip_PointF_2IJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLong arg3, jintLong arg4, jobject arg5, jint arg6, jintLong arg7);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawDriverString__JJIJJLorg_eclipse_swt_internal_gdip_PointF_2IJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLong arg3, jintLong arg4, jobject arg5, jint arg6, jintLong arg7)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawDriverString__JJIJJLorg_eclipse_swt_internal_gdip_PointF_2IJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLong arg3, jintLong arg4, jobject arg5, jint arg6, jintLong arg7);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawDriverString__JJIJJLorg_eclipse_swt_internal_gdip_PointF_2IJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLong arg3, jintLong arg4, jobject arg5, jint arg6, jintLong arg7)
 #endif
 {
 	PointF _arg5, *lparg5=NULL;
@@ -862,7 +860,6 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawDriverString__JJIJJLorg_eclipse
 	if (arg5) if ((lparg5 = getPointFFields(env, arg5, &_arg5)) == NULL) goto fail;
 	rc = (jint)((Graphics *)arg0)->DrawDriverString((const UINT16 *)arg1, arg2, (const Font *)arg3, (const Brush *)arg4, (const PointF *)lparg5, arg6, (const Matrix *)arg7);
 fail:
-	if (arg5 && lparg5) setPointFFields(env, arg5, lparg5);
 #ifndef JNI64
 	Gdip_NATIVE_EXIT(env, that, Graphics_1DrawDriverString__IIIIILorg_eclipse_swt_internal_gdip_PointF_2II_FUNC);
 #else
@@ -873,8 +870,8 @@ fail:
 #endif
 
 #ifndef NO_Graphics_1DrawEllipse
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawEllipse)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawEllipse)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawEllipse)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawEllipse)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5)
 {
 	jint rc = 0;
@@ -887,11 +884,11 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawEllipse)
 
 #if (!defined(NO_Graphics_1DrawImage__IIII) && !defined(JNI64)) || (!defined(NO_Graphics_1DrawImage__JJII) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__IIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__IIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__IIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__IIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3)
 #else
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__JJII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__JJII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__JJII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__JJII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3)
 #endif
 {
 	jint rc = 0;
@@ -912,11 +909,11 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__JJII)(JNIEnv *env, jclas
 
 #if (!defined(NO_Graphics_1DrawImage__IILorg_eclipse_swt_internal_gdip_Rect_2IIIIIIII) && !defined(JNI64)) || (!defined(NO_Graphics_1DrawImage__JJLorg_eclipse_swt_internal_gdip_Rect_2IIIIIJJJ) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__IILorg_eclipse_swt_internal_gdip_Rect_2IIIIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jintLong arg8, jintLong arg9, jintLong arg10);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__IILorg_eclipse_swt_internal_gdip_Rect_2IIIIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jintLong arg8, jintLong arg9, jintLong arg10)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__IILorg_eclipse_swt_internal_gdip_Rect_2IIIIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jintLong arg8, jintLong arg9, jintLong arg10);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__IILorg_eclipse_swt_internal_gdip_Rect_2IIIIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jintLong arg8, jintLong arg9, jintLong arg10)
 #else
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__JJLorg_eclipse_swt_internal_gdip_Rect_2IIIIIJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jintLong arg8, jintLong arg9, jintLong arg10);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__JJLorg_eclipse_swt_internal_gdip_Rect_2IIIIIJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jintLong arg8, jintLong arg9, jintLong arg10)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__JJLorg_eclipse_swt_internal_gdip_Rect_2IIIIIJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jintLong arg8, jintLong arg9, jintLong arg10);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__JJLorg_eclipse_swt_internal_gdip_Rect_2IIIIIJJJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jintLong arg8, jintLong arg9, jintLong arg10)
 #endif
 {
 	Rect _arg2, *lparg2=NULL;
@@ -929,7 +926,6 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawImage__JJLorg_eclipse_swt_inter
 	if (arg2) if ((lparg2 = getRectFields(env, arg2, &_arg2)) == NULL) goto fail;
 	rc = (jint)((Graphics *)arg0)->DrawImage((Image *)arg1, *(const Rect *)lparg2, (INT)arg3, (INT)arg4, (INT)arg5, (INT)arg6, (Unit)arg7, (ImageAttributes *)arg8, (DrawImageAbort)arg9, (VOID *)arg10);
 fail:
-	if (arg2 && lparg2) setRectFields(env, arg2, lparg2);
 #ifndef JNI64
 	Gdip_NATIVE_EXIT(env, that, Graphics_1DrawImage__IILorg_eclipse_swt_internal_gdip_Rect_2IIIIIIII_FUNC);
 #else
@@ -940,8 +936,8 @@ fail:
 #endif
 
 #ifndef NO_Graphics_1DrawLine
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawLine)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawLine)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawLine)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawLine)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5)
 {
 	jint rc = 0;
@@ -953,8 +949,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawLine)
 #endif
 
 #ifndef NO_Graphics_1DrawPath
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawPath)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawPath)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawPath)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawPath)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 {
 	jint rc = 0;
@@ -966,8 +962,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawPath)
 #endif
 
 #ifndef NO_Graphics_1DrawRectangle
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawRectangle)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawRectangle)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawRectangle)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawRectangle)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5)
 {
 	jint rc = 0;
@@ -980,11 +976,11 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawRectangle)
 
 #if (!defined(NO_Graphics_1DrawString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2I) && !defined(JNI64)) || (!defined(NO_Graphics_1DrawString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2J) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2I)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2I)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2I)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2I)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5)
 #else
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2J)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2J)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2J)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2J)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5)
 #endif
 {
 	jchar *lparg1=NULL;
@@ -1012,11 +1008,11 @@ fail:
 
 #if (!defined(NO_Graphics_1DrawString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2II) && !defined(JNI64)) || (!defined(NO_Graphics_1DrawString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2JJ) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2II)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jintLong arg6);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2II)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jintLong arg6)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2II)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jintLong arg6);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2II)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jintLong arg6)
 #else
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2JJ)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jintLong arg6);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2JJ)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jintLong arg6)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2JJ)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jintLong arg6);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2JJ)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jintLong arg6)
 #endif
 {
 	jchar *lparg1=NULL;
@@ -1043,8 +1039,8 @@ fail:
 #endif
 
 #ifndef NO_Graphics_1FillEllipse
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillEllipse)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillEllipse)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillEllipse)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillEllipse)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5)
 {
 	jint rc = 0;
@@ -1056,8 +1052,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillEllipse)
 #endif
 
 #ifndef NO_Graphics_1FillPath
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillPath)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillPath)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillPath)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillPath)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 {
 	jint rc = 0;
@@ -1069,8 +1065,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillPath)
 #endif
 
 #ifndef NO_Graphics_1FillPie
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillPie)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5, jfloat arg6, jfloat arg7);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillPie)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillPie)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5, jfloat arg6, jfloat arg7);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillPie)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5, jfloat arg6, jfloat arg7)
 {
 	jint rc = 0;
@@ -1082,8 +1078,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillPie)
 #endif
 
 #ifndef NO_Graphics_1FillRectangle
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillRectangle)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillRectangle)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillRectangle)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillRectangle)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5)
 {
 	jint rc = 0;
@@ -1095,8 +1091,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillRectangle)
 #endif
 
 #ifndef NO_Graphics_1Flush
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(Graphics_1Flush)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT void JNICALL Gdip_NATIVE(Graphics_1Flush)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Graphics_1Flush)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Graphics_1Flush)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	Gdip_NATIVE_ENTER(env, that, Graphics_1Flush_FUNC);
@@ -1106,8 +1102,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(Graphics_1Flush)
 #endif
 
 #ifndef NO_Graphics_1GetClip
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClip)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClip)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClip)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClip)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jint rc = 0;
@@ -1120,11 +1116,11 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClip)
 
 #if (!defined(NO_Graphics_1GetClipBounds__ILorg_eclipse_swt_internal_gdip_RectF_2) && !defined(JNI64)) || (!defined(NO_Graphics_1GetClipBounds__JLorg_eclipse_swt_internal_gdip_RectF_2) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__ILorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__ILorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__ILorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__ILorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 #else
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__JLorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__JLorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__JLorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__JLorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 #endif
 {
 	RectF _arg1, *lparg1=NULL;
@@ -1149,11 +1145,11 @@ fail:
 
 #if (!defined(NO_Graphics_1GetClipBounds__ILorg_eclipse_swt_internal_gdip_Rect_2) && !defined(JNI64)) || (!defined(NO_Graphics_1GetClipBounds__JLorg_eclipse_swt_internal_gdip_Rect_2) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__ILorg_eclipse_swt_internal_gdip_Rect_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__ILorg_eclipse_swt_internal_gdip_Rect_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__ILorg_eclipse_swt_internal_gdip_Rect_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__ILorg_eclipse_swt_internal_gdip_Rect_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 #else
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__JLorg_eclipse_swt_internal_gdip_Rect_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__JLorg_eclipse_swt_internal_gdip_Rect_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__JLorg_eclipse_swt_internal_gdip_Rect_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetClipBounds__JLorg_eclipse_swt_internal_gdip_Rect_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 #endif
 {
 	Rect _arg1, *lparg1=NULL;
@@ -1177,8 +1173,8 @@ fail:
 #endif
 
 #ifndef NO_Graphics_1GetHDC
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Graphics_1GetHDC)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Graphics_1GetHDC)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Graphics_1GetHDC)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Graphics_1GetHDC)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -1190,8 +1186,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Graphics_1GetHDC)
 #endif
 
 #ifndef NO_Graphics_1GetInterpolationMode
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetInterpolationMode)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetInterpolationMode)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetInterpolationMode)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetInterpolationMode)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1203,8 +1199,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetInterpolationMode)
 #endif
 
 #ifndef NO_Graphics_1GetSmoothingMode
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetSmoothingMode)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetSmoothingMode)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetSmoothingMode)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetSmoothingMode)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1216,8 +1212,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetSmoothingMode)
 #endif
 
 #ifndef NO_Graphics_1GetTextRenderingHint
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetTextRenderingHint)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetTextRenderingHint)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetTextRenderingHint)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetTextRenderingHint)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1229,8 +1225,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetTextRenderingHint)
 #endif
 
 #ifndef NO_Graphics_1GetTransform
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetTransform)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetTransform)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetTransform)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetTransform)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jint rc = 0;
@@ -1242,8 +1238,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetTransform)
 #endif
 
 #ifndef NO_Graphics_1GetVisibleClipBounds
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetVisibleClipBounds)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetVisibleClipBounds)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetVisibleClipBounds)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1GetVisibleClipBounds)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	Rect _arg1, *lparg1=NULL;
@@ -1260,11 +1256,11 @@ fail:
 
 #if (!defined(NO_Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2ILorg_eclipse_swt_internal_gdip_RectF_2) && !defined(JNI64)) || (!defined(NO_Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2JLorg_eclipse_swt_internal_gdip_RectF_2) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2ILorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jobject arg6);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2ILorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jobject arg6)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2ILorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jobject arg6);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2ILorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jobject arg6)
 #else
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2JLorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jobject arg6);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2JLorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jobject arg6)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2JLorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jobject arg6);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2JLorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jintLong arg5, jobject arg6)
 #endif
 {
 	jchar *lparg1=NULL;
@@ -1282,8 +1278,7 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__J_3CIJLorg_eclipse_s
 	rc = (jint)((Graphics *)arg0)->MeasureString((const WCHAR *)lparg1, (INT)arg2, (const Font *)arg3, *(const PointF *)lparg4, (StringFormat *)arg5, lparg6);
 fail:
 	if (arg6 && lparg6) setRectFFields(env, arg6, lparg6);
-	if (arg4 && lparg4) setPointFFields(env, arg4, lparg4);
-	if (arg1 && lparg1) env->ReleaseCharArrayElements(arg1, lparg1, 0);
+	if (arg1 && lparg1) env->ReleaseCharArrayElements(arg1, lparg1, JNI_ABORT);
 #ifndef JNI64
 	Gdip_NATIVE_EXIT(env, that, Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2ILorg_eclipse_swt_internal_gdip_RectF_2_FUNC);
 #else
@@ -1295,11 +1290,11 @@ fail:
 
 #if (!defined(NO_Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2) && !defined(JNI64)) || (!defined(NO_Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jobject arg5);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jobject arg5)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jobject arg5);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jobject arg5)
 #else
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jobject arg5);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jobject arg5)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jobject arg5);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jintLong arg3, jobject arg4, jobject arg5)
 #endif
 {
 	jchar *lparg1=NULL;
@@ -1317,8 +1312,7 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureString__J_3CIJLorg_eclipse_s
 	rc = (jint)((Graphics *)arg0)->MeasureString((const WCHAR *)lparg1, (INT)arg2, (const Font *)arg3, *(const PointF *)lparg4, (RectF *)lparg5);
 fail:
 	if (arg5 && lparg5) setRectFFields(env, arg5, lparg5);
-	if (arg4 && lparg4) setPointFFields(env, arg4, lparg4);
-	if (arg1 && lparg1) env->ReleaseCharArrayElements(arg1, lparg1, 0);
+	if (arg1 && lparg1) env->ReleaseCharArrayElements(arg1, lparg1, JNI_ABORT);
 #ifndef JNI64
 	Gdip_NATIVE_EXIT(env, that, Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2_FUNC);
 #else
@@ -1329,8 +1323,8 @@ fail:
 #endif
 
 #ifndef NO_Graphics_1ReleaseHDC
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(Graphics_1ReleaseHDC)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT void JNICALL Gdip_NATIVE(Graphics_1ReleaseHDC)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Graphics_1ReleaseHDC)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Graphics_1ReleaseHDC)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	Gdip_NATIVE_ENTER(env, that, Graphics_1ReleaseHDC_FUNC);
@@ -1340,8 +1334,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(Graphics_1ReleaseHDC)
 #endif
 
 #ifndef NO_Graphics_1ResetClip
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1ResetClip)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1ResetClip)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1ResetClip)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1ResetClip)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1353,8 +1347,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1ResetClip)
 #endif
 
 #ifndef NO_Graphics_1Restore
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1Restore)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1Restore)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1Restore)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1Restore)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -1366,8 +1360,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1Restore)
 #endif
 
 #ifndef NO_Graphics_1Save
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1Save)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1Save)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1Save)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1Save)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1379,8 +1373,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1Save)
 #endif
 
 #ifndef NO_Graphics_1ScaleTransform
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1ScaleTransform)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1ScaleTransform)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1ScaleTransform)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1ScaleTransform)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3)
 {
 	jint rc = 0;
@@ -1393,11 +1387,11 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1ScaleTransform)
 
 #if (!defined(NO_Graphics_1SetClip__III) && !defined(JNI64)) || (!defined(NO_Graphics_1SetClip__JJI) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
 #else
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__JJI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__JJI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__JJI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__JJI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
 #endif
 {
 	jint rc = 0;
@@ -1418,11 +1412,11 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__JJI)(JNIEnv *env, jclass t
 
 #if (!defined(NO_Graphics_1SetClip__ILorg_eclipse_swt_internal_gdip_Rect_2I) && !defined(JNI64)) || (!defined(NO_Graphics_1SetClip__JLorg_eclipse_swt_internal_gdip_Rect_2I) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__ILorg_eclipse_swt_internal_gdip_Rect_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__ILorg_eclipse_swt_internal_gdip_Rect_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__ILorg_eclipse_swt_internal_gdip_Rect_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__ILorg_eclipse_swt_internal_gdip_Rect_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__JLorg_eclipse_swt_internal_gdip_Rect_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__JLorg_eclipse_swt_internal_gdip_Rect_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__JLorg_eclipse_swt_internal_gdip_Rect_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClip__JLorg_eclipse_swt_internal_gdip_Rect_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	Rect _arg1, *lparg1=NULL;
@@ -1447,11 +1441,11 @@ fail:
 
 #if (!defined(NO_Graphics_1SetClipPath__II) && !defined(JNI64)) || (!defined(NO_Graphics_1SetClipPath__JJ) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__II)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 #else
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__JJ)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 #endif
 {
 	jint rc = 0;
@@ -1472,11 +1466,11 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__JJ)(JNIEnv *env, jclas
 
 #if (!defined(NO_Graphics_1SetClipPath__III) && !defined(JNI64)) || (!defined(NO_Graphics_1SetClipPath__JJI) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
 #else
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__JJI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__JJI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__JJI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__JJI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
 #endif
 {
 	jint rc = 0;
@@ -1496,8 +1490,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetClipPath__JJI)(JNIEnv *env, jcla
 #endif
 
 #ifndef NO_Graphics_1SetCompositingQuality
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetCompositingQuality)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetCompositingQuality)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetCompositingQuality)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetCompositingQuality)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -1509,8 +1503,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetCompositingQuality)
 #endif
 
 #ifndef NO_Graphics_1SetInterpolationMode
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetInterpolationMode)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetInterpolationMode)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetInterpolationMode)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetInterpolationMode)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -1522,8 +1516,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetInterpolationMode)
 #endif
 
 #ifndef NO_Graphics_1SetPageUnit
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetPageUnit)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetPageUnit)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetPageUnit)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetPageUnit)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -1535,8 +1529,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetPageUnit)
 #endif
 
 #ifndef NO_Graphics_1SetPixelOffsetMode
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetPixelOffsetMode)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetPixelOffsetMode)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetPixelOffsetMode)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetPixelOffsetMode)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -1548,8 +1542,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetPixelOffsetMode)
 #endif
 
 #ifndef NO_Graphics_1SetSmoothingMode
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetSmoothingMode)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetSmoothingMode)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetSmoothingMode)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetSmoothingMode)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -1561,8 +1555,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetSmoothingMode)
 #endif
 
 #ifndef NO_Graphics_1SetTextRenderingHint
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetTextRenderingHint)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetTextRenderingHint)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetTextRenderingHint)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetTextRenderingHint)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -1574,8 +1568,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetTextRenderingHint)
 #endif
 
 #ifndef NO_Graphics_1SetTransform
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetTransform)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetTransform)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetTransform)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetTransform)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jint rc = 0;
@@ -1587,8 +1581,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1SetTransform)
 #endif
 
 #ifndef NO_Graphics_1TranslateTransform
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1TranslateTransform)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1TranslateTransform)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1TranslateTransform)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Graphics_1TranslateTransform)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3)
 {
 	jint rc = 0;
@@ -1600,8 +1594,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1TranslateTransform)
 #endif
 
 #ifndef NO_Graphics_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(Graphics_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(Graphics_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Graphics_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Graphics_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, Graphics_1delete_FUNC);
@@ -1611,8 +1605,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(Graphics_1delete)
 #endif
 
 #ifndef NO_Graphics_1new
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Graphics_1new)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Graphics_1new)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Graphics_1new)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Graphics_1new)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -1624,8 +1618,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Graphics_1new)
 #endif
 
 #ifndef NO_HatchBrush_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(HatchBrush_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(HatchBrush_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(HatchBrush_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(HatchBrush_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, HatchBrush_1delete_FUNC);
@@ -1635,8 +1629,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(HatchBrush_1delete)
 #endif
 
 #ifndef NO_HatchBrush_1new
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(HatchBrush_1new)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintLong arg2);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(HatchBrush_1new)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(HatchBrush_1new)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintLong arg2);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(HatchBrush_1new)
 	(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintLong arg2)
 {
 	jintLong rc = 0;
@@ -1648,8 +1642,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(HatchBrush_1new)
 #endif
 
 #ifndef NO_ImageAttributes_1SetColorMatrix
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(ImageAttributes_1SetColorMatrix)(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1, jint arg2, jint arg3);
-JNIEXPORT jint JNICALL Gdip_NATIVE(ImageAttributes_1SetColorMatrix)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(ImageAttributes_1SetColorMatrix)(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1, jint arg2, jint arg3);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(ImageAttributes_1SetColorMatrix)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1, jint arg2, jint arg3)
 {
 	jfloat *lparg1=NULL;
@@ -1665,8 +1659,8 @@ fail:
 #endif
 
 #ifndef NO_ImageAttributes_1SetWrapMode
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(ImageAttributes_1SetWrapMode)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(ImageAttributes_1SetWrapMode)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(ImageAttributes_1SetWrapMode)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(ImageAttributes_1SetWrapMode)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -1678,8 +1672,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(ImageAttributes_1SetWrapMode)
 #endif
 
 #ifndef NO_ImageAttributes_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(ImageAttributes_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(ImageAttributes_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(ImageAttributes_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(ImageAttributes_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, ImageAttributes_1delete_FUNC);
@@ -1689,8 +1683,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(ImageAttributes_1delete)
 #endif
 
 #ifndef NO_ImageAttributes_1new
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(ImageAttributes_1new)(JNIEnv *env, jclass that);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(ImageAttributes_1new)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(ImageAttributes_1new)(JNIEnv *env, jclass that);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(ImageAttributes_1new)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -1702,8 +1696,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(ImageAttributes_1new)
 #endif
 
 #ifndef NO_Image_1GetHeight
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetHeight)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetHeight)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Image_1GetHeight)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Image_1GetHeight)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1715,8 +1709,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetHeight)
 #endif
 
 #ifndef NO_Image_1GetLastStatus
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetLastStatus)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetLastStatus)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Image_1GetLastStatus)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Image_1GetLastStatus)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1728,8 +1722,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetLastStatus)
 #endif
 
 #ifndef NO_Image_1GetPalette
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetPalette)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetPalette)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Image_1GetPalette)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Image_1GetPalette)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
 {
 	jint rc = 0;
@@ -1741,8 +1735,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetPalette)
 #endif
 
 #ifndef NO_Image_1GetPaletteSize
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetPaletteSize)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetPaletteSize)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Image_1GetPaletteSize)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Image_1GetPaletteSize)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1754,8 +1748,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetPaletteSize)
 #endif
 
 #ifndef NO_Image_1GetPixelFormat
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetPixelFormat)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetPixelFormat)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Image_1GetPixelFormat)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Image_1GetPixelFormat)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1767,8 +1761,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetPixelFormat)
 #endif
 
 #ifndef NO_Image_1GetWidth
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetWidth)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetWidth)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Image_1GetWidth)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Image_1GetWidth)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1780,8 +1774,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Image_1GetWidth)
 #endif
 
 #ifndef NO_LinearGradientBrush_1ResetTransform
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1ResetTransform)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1ResetTransform)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1ResetTransform)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1ResetTransform)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1793,8 +1787,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1ResetTransform)
 #endif
 
 #ifndef NO_LinearGradientBrush_1ScaleTransform
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1ScaleTransform)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
-JNIEXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1ScaleTransform)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1ScaleTransform)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1ScaleTransform)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3)
 {
 	jint rc = 0;
@@ -1806,8 +1800,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1ScaleTransform)
 #endif
 
 #ifndef NO_LinearGradientBrush_1SetWrapMode
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1SetWrapMode)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1SetWrapMode)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1SetWrapMode)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1SetWrapMode)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -1819,8 +1813,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1SetWrapMode)
 #endif
 
 #ifndef NO_LinearGradientBrush_1TranslateTransform
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1TranslateTransform)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
-JNIEXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1TranslateTransform)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1TranslateTransform)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1TranslateTransform)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3)
 {
 	jint rc = 0;
@@ -1832,8 +1826,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1TranslateTransform)
 #endif
 
 #ifndef NO_LinearGradientBrush_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(LinearGradientBrush_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(LinearGradientBrush_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(LinearGradientBrush_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(LinearGradientBrush_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, LinearGradientBrush_1delete_FUNC);
@@ -1843,8 +1837,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(LinearGradientBrush_1delete)
 #endif
 
 #ifndef NO_LinearGradientBrush_1new
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(LinearGradientBrush_1new)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jintLong arg3);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(LinearGradientBrush_1new)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(LinearGradientBrush_1new)(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jintLong arg3);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(LinearGradientBrush_1new)
 	(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jintLong arg2, jintLong arg3)
 {
 	PointF _arg0, *lparg0=NULL;
@@ -1863,8 +1857,8 @@ fail:
 #endif
 
 #ifndef NO_Matrix_1GetElements
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1GetElements)(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1GetElements)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1GetElements)(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1GetElements)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1)
 {
 	jfloat *lparg1=NULL;
@@ -1880,8 +1874,8 @@ fail:
 #endif
 
 #ifndef NO_Matrix_1Invert
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Invert)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Invert)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1Invert)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1Invert)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1893,8 +1887,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Invert)
 #endif
 
 #ifndef NO_Matrix_1IsIdentity
-extern "C" JNIEXPORT jboolean JNICALL Gdip_NATIVE(Matrix_1IsIdentity)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jboolean JNICALL Gdip_NATIVE(Matrix_1IsIdentity)
+extern "C" SWT_NATIVE_EXPORT jboolean JNICALL Gdip_NATIVE(Matrix_1IsIdentity)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jboolean JNICALL Gdip_NATIVE(Matrix_1IsIdentity)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -1906,8 +1900,8 @@ JNIEXPORT jboolean JNICALL Gdip_NATIVE(Matrix_1IsIdentity)
 #endif
 
 #ifndef NO_Matrix_1Multiply
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Multiply)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Multiply)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1Multiply)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1Multiply)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
 {
 	jint rc = 0;
@@ -1919,8 +1913,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Multiply)
 #endif
 
 #ifndef NO_Matrix_1Rotate
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Rotate)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jint arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Rotate)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1Rotate)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jint arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1Rotate)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jint arg2)
 {
 	jint rc = 0;
@@ -1932,8 +1926,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Rotate)
 #endif
 
 #ifndef NO_Matrix_1Scale
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Scale)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Scale)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1Scale)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1Scale)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3)
 {
 	jint rc = 0;
@@ -1945,8 +1939,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Scale)
 #endif
 
 #ifndef NO_Matrix_1SetElements
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1SetElements)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jfloat arg3, jfloat arg4, jfloat arg5, jfloat arg6);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1SetElements)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1SetElements)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jfloat arg3, jfloat arg4, jfloat arg5, jfloat arg6);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1SetElements)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jfloat arg3, jfloat arg4, jfloat arg5, jfloat arg6)
 {
 	jint rc = 0;
@@ -1958,8 +1952,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1SetElements)
 #endif
 
 #ifndef NO_Matrix_1Shear
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Shear)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Shear)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1Shear)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1Shear)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3)
 {
 	jint rc = 0;
@@ -1972,11 +1966,11 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Shear)
 
 #if (!defined(NO_Matrix_1TransformPoints__ILorg_eclipse_swt_internal_gdip_PointF_2I) && !defined(JNI64)) || (!defined(NO_Matrix_1TransformPoints__JLorg_eclipse_swt_internal_gdip_PointF_2I) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1TransformPoints__ILorg_eclipse_swt_internal_gdip_PointF_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1TransformPoints__ILorg_eclipse_swt_internal_gdip_PointF_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1TransformPoints__ILorg_eclipse_swt_internal_gdip_PointF_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1TransformPoints__ILorg_eclipse_swt_internal_gdip_PointF_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1TransformPoints__JLorg_eclipse_swt_internal_gdip_PointF_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1TransformPoints__JLorg_eclipse_swt_internal_gdip_PointF_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1TransformPoints__JLorg_eclipse_swt_internal_gdip_PointF_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1TransformPoints__JLorg_eclipse_swt_internal_gdip_PointF_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	PointF _arg1, *lparg1=NULL;
@@ -2000,8 +1994,8 @@ fail:
 #endif
 
 #ifndef NO_Matrix_1TransformVectors
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1TransformVectors)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1TransformVectors)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1TransformVectors)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1TransformVectors)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 {
 	PointF _arg1, *lparg1=NULL;
@@ -2017,8 +2011,8 @@ fail:
 #endif
 
 #ifndef NO_Matrix_1Translate
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Translate)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Translate)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1Translate)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Matrix_1Translate)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3)
 {
 	jint rc = 0;
@@ -2030,8 +2024,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1Translate)
 #endif
 
 #ifndef NO_Matrix_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(Matrix_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(Matrix_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Matrix_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Matrix_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, Matrix_1delete_FUNC);
@@ -2041,8 +2035,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(Matrix_1delete)
 #endif
 
 #ifndef NO_Matrix_1new
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Matrix_1new)(JNIEnv *env, jclass that, jfloat arg0, jfloat arg1, jfloat arg2, jfloat arg3, jfloat arg4, jfloat arg5);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Matrix_1new)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Matrix_1new)(JNIEnv *env, jclass that, jfloat arg0, jfloat arg1, jfloat arg2, jfloat arg3, jfloat arg4, jfloat arg5);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Matrix_1new)
 	(JNIEnv *env, jclass that, jfloat arg0, jfloat arg1, jfloat arg2, jfloat arg3, jfloat arg4, jfloat arg5)
 {
 	jintLong rc = 0;
@@ -2055,11 +2049,11 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Matrix_1new)
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_gdip_BitmapData_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_gdip_BitmapData_2J) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_BitmapData_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1);
-JNIEXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_BitmapData_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_BitmapData_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_BitmapData_2I)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1)
 #else
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_BitmapData_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1);
-JNIEXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_BitmapData_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_BitmapData_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_BitmapData_2J)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1)
 #endif
 {
 #ifndef JNI64
@@ -2078,11 +2072,11 @@ JNIEXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_Bi
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2JI) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2);
-JNIEXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2);
-JNIEXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	ColorPalette _arg0, *lparg0=NULL;
@@ -2104,8 +2098,8 @@ fail:
 #endif
 
 #ifndef NO_PathGradientBrush_1SetCenterColor
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetCenterColor)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetCenterColor)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetCenterColor)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetCenterColor)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jint rc = 0;
@@ -2117,8 +2111,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetCenterColor)
 #endif
 
 #ifndef NO_PathGradientBrush_1SetCenterPoint
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetCenterPoint)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetCenterPoint)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetCenterPoint)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetCenterPoint)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	PointF _arg1, *lparg1=NULL;
@@ -2134,8 +2128,8 @@ fail:
 #endif
 
 #ifndef NO_PathGradientBrush_1SetGraphicsPath
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetGraphicsPath)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetGraphicsPath)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetGraphicsPath)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetGraphicsPath)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jint rc = 0;
@@ -2147,8 +2141,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetGraphicsPath)
 #endif
 
 #ifndef NO_PathGradientBrush_1SetWrapMode
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetWrapMode)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetWrapMode)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetWrapMode)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetWrapMode)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -2160,8 +2154,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetWrapMode)
 #endif
 
 #ifndef NO_PathGradientBrush_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(PathGradientBrush_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(PathGradientBrush_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(PathGradientBrush_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(PathGradientBrush_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, PathGradientBrush_1delete_FUNC);
@@ -2171,8 +2165,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(PathGradientBrush_1delete)
 #endif
 
 #ifndef NO_PathGradientBrush_1new
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(PathGradientBrush_1new)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(PathGradientBrush_1new)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(PathGradientBrush_1new)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(PathGradientBrush_1new)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -2184,8 +2178,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(PathGradientBrush_1new)
 #endif
 
 #ifndef NO_Pen_1GetBrush
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Pen_1GetBrush)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Pen_1GetBrush)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Pen_1GetBrush)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Pen_1GetBrush)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -2197,8 +2191,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Pen_1GetBrush)
 #endif
 
 #ifndef NO_Pen_1SetBrush
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetBrush)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetBrush)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetBrush)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetBrush)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jint rc = 0;
@@ -2210,8 +2204,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetBrush)
 #endif
 
 #ifndef NO_Pen_1SetDashOffset
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetDashOffset)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetDashOffset)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetDashOffset)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetDashOffset)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1)
 {
 	jint rc = 0;
@@ -2223,8 +2217,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetDashOffset)
 #endif
 
 #ifndef NO_Pen_1SetDashPattern
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetDashPattern)(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1, jint arg2);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetDashPattern)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetDashPattern)(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1, jint arg2);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetDashPattern)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1, jint arg2)
 {
 	jfloat *lparg1=NULL;
@@ -2240,8 +2234,8 @@ fail:
 #endif
 
 #ifndef NO_Pen_1SetDashStyle
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetDashStyle)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetDashStyle)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetDashStyle)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetDashStyle)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -2253,8 +2247,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetDashStyle)
 #endif
 
 #ifndef NO_Pen_1SetLineCap
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetLineCap)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetLineCap)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetLineCap)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetLineCap)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3)
 {
 	jint rc = 0;
@@ -2266,8 +2260,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetLineCap)
 #endif
 
 #ifndef NO_Pen_1SetLineJoin
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetLineJoin)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetLineJoin)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetLineJoin)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetLineJoin)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -2279,8 +2273,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetLineJoin)
 #endif
 
 #ifndef NO_Pen_1SetMiterLimit
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetMiterLimit)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetMiterLimit)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetMiterLimit)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetMiterLimit)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1)
 {
 	jint rc = 0;
@@ -2292,8 +2286,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetMiterLimit)
 #endif
 
 #ifndef NO_Pen_1SetWidth
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetWidth)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetWidth)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetWidth)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(Pen_1SetWidth)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1)
 {
 	jint rc = 0;
@@ -2305,8 +2299,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1SetWidth)
 #endif
 
 #ifndef NO_Pen_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(Pen_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(Pen_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Pen_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Pen_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, Pen_1delete_FUNC);
@@ -2316,8 +2310,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(Pen_1delete)
 #endif
 
 #ifndef NO_Pen_1new
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Pen_1new)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Pen_1new)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Pen_1new)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Pen_1new)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1)
 {
 	jintLong rc = 0;
@@ -2329,8 +2323,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Pen_1new)
 #endif
 
 #ifndef NO_Point_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(Point_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(Point_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Point_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Point_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, Point_1delete_FUNC);
@@ -2340,8 +2334,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(Point_1delete)
 #endif
 
 #ifndef NO_Point_1new
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Point_1new)(JNIEnv *env, jclass that, jint arg0, jint arg1);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Point_1new)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Point_1new)(JNIEnv *env, jclass that, jint arg0, jint arg1);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Point_1new)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	jintLong rc = 0;
@@ -2353,8 +2347,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Point_1new)
 #endif
 
 #ifndef NO_PrivateFontCollection_1AddFontFile
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(PrivateFontCollection_1AddFontFile)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(PrivateFontCollection_1AddFontFile)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(PrivateFontCollection_1AddFontFile)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(PrivateFontCollection_1AddFontFile)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1)
 {
 	jchar *lparg1=NULL;
@@ -2363,15 +2357,15 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(PrivateFontCollection_1AddFontFile)
 	if (arg1) if ((lparg1 = env->GetCharArrayElements(arg1, NULL)) == NULL) goto fail;
 	rc = (jint)((PrivateFontCollection *)arg0)->AddFontFile((const WCHAR *)lparg1);
 fail:
-	if (arg1 && lparg1) env->ReleaseCharArrayElements(arg1, lparg1, 0);
+	if (arg1 && lparg1) env->ReleaseCharArrayElements(arg1, lparg1, JNI_ABORT);
 	Gdip_NATIVE_EXIT(env, that, PrivateFontCollection_1AddFontFile_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_PrivateFontCollection_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(PrivateFontCollection_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(PrivateFontCollection_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(PrivateFontCollection_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(PrivateFontCollection_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, PrivateFontCollection_1delete_FUNC);
@@ -2381,8 +2375,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(PrivateFontCollection_1delete)
 #endif
 
 #ifndef NO_PrivateFontCollection_1new
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(PrivateFontCollection_1new)(JNIEnv *env, jclass that);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(PrivateFontCollection_1new)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(PrivateFontCollection_1new)(JNIEnv *env, jclass that);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(PrivateFontCollection_1new)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2394,8 +2388,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(PrivateFontCollection_1new)
 #endif
 
 #ifndef NO_Region_1GetHRGN
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Region_1GetHRGN)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Region_1GetHRGN)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Region_1GetHRGN)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Region_1GetHRGN)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -2407,8 +2401,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Region_1GetHRGN)
 #endif
 
 #ifndef NO_Region_1IsInfinite
-extern "C" JNIEXPORT jboolean JNICALL Gdip_NATIVE(Region_1IsInfinite)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jboolean JNICALL Gdip_NATIVE(Region_1IsInfinite)
+extern "C" SWT_NATIVE_EXPORT jboolean JNICALL Gdip_NATIVE(Region_1IsInfinite)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jboolean JNICALL Gdip_NATIVE(Region_1IsInfinite)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jboolean rc = 0;
@@ -2420,8 +2414,8 @@ JNIEXPORT jboolean JNICALL Gdip_NATIVE(Region_1IsInfinite)
 #endif
 
 #ifndef NO_Region_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(Region_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(Region_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Region_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(Region_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, Region_1delete_FUNC);
@@ -2431,8 +2425,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(Region_1delete)
 #endif
 
 #ifndef NO_Region_1new__
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Region_1new__)(JNIEnv *env, jclass that);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Region_1new__)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Region_1new__)(JNIEnv *env, jclass that);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Region_1new__)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2445,11 +2439,11 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Region_1new__)
 
 #if (!defined(NO_Region_1new__I) && !defined(JNI64)) || (!defined(NO_Region_1new__J) && defined(JNI64))
 #ifndef JNI64
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Region_1new__I)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Region_1new__I)(JNIEnv *env, jclass that, jintLong arg0)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Region_1new__I)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Region_1new__I)(JNIEnv *env, jclass that, jintLong arg0)
 #else
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Region_1new__J)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Region_1new__J)(JNIEnv *env, jclass that, jintLong arg0)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Region_1new__J)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Region_1new__J)(JNIEnv *env, jclass that, jintLong arg0)
 #endif
 {
 	jintLong rc = 0;
@@ -2469,8 +2463,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Region_1new__J)(JNIEnv *env, jclass that,
 #endif
 
 #ifndef NO_Region_1newGraphicsPath
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(Region_1newGraphicsPath)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(Region_1newGraphicsPath)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Region_1newGraphicsPath)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(Region_1newGraphicsPath)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -2482,8 +2476,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(Region_1newGraphicsPath)
 #endif
 
 #ifndef NO_SolidBrush_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(SolidBrush_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(SolidBrush_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(SolidBrush_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(SolidBrush_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, SolidBrush_1delete_FUNC);
@@ -2493,8 +2487,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(SolidBrush_1delete)
 #endif
 
 #ifndef NO_SolidBrush_1new
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(SolidBrush_1new)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(SolidBrush_1new)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(SolidBrush_1new)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(SolidBrush_1new)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -2506,8 +2500,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(SolidBrush_1new)
 #endif
 
 #ifndef NO_StringFormat_1Clone
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(StringFormat_1Clone)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(StringFormat_1Clone)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(StringFormat_1Clone)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(StringFormat_1Clone)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -2519,8 +2513,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(StringFormat_1Clone)
 #endif
 
 #ifndef NO_StringFormat_1GenericDefault
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(StringFormat_1GenericDefault)(JNIEnv *env, jclass that);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(StringFormat_1GenericDefault)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(StringFormat_1GenericDefault)(JNIEnv *env, jclass that);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(StringFormat_1GenericDefault)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2532,8 +2526,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(StringFormat_1GenericDefault)
 #endif
 
 #ifndef NO_StringFormat_1GenericTypographic
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(StringFormat_1GenericTypographic)(JNIEnv *env, jclass that);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(StringFormat_1GenericTypographic)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(StringFormat_1GenericTypographic)(JNIEnv *env, jclass that);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(StringFormat_1GenericTypographic)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -2545,8 +2539,8 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(StringFormat_1GenericTypographic)
 #endif
 
 #ifndef NO_StringFormat_1GetFormatFlags
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(StringFormat_1GetFormatFlags)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(StringFormat_1GetFormatFlags)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(StringFormat_1GetFormatFlags)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(StringFormat_1GetFormatFlags)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -2558,8 +2552,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(StringFormat_1GetFormatFlags)
 #endif
 
 #ifndef NO_StringFormat_1SetFormatFlags
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(StringFormat_1SetFormatFlags)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(StringFormat_1SetFormatFlags)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(StringFormat_1SetFormatFlags)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(StringFormat_1SetFormatFlags)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -2571,8 +2565,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(StringFormat_1SetFormatFlags)
 #endif
 
 #ifndef NO_StringFormat_1SetHotkeyPrefix
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(StringFormat_1SetHotkeyPrefix)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(StringFormat_1SetHotkeyPrefix)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(StringFormat_1SetHotkeyPrefix)(JNIEnv *env, jclass that, jintLong arg0, jint arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(StringFormat_1SetHotkeyPrefix)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -2584,8 +2578,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(StringFormat_1SetHotkeyPrefix)
 #endif
 
 #ifndef NO_StringFormat_1SetTabStops
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(StringFormat_1SetTabStops)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jint arg2, jfloatArray arg3);
-JNIEXPORT jint JNICALL Gdip_NATIVE(StringFormat_1SetTabStops)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(StringFormat_1SetTabStops)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jint arg2, jfloatArray arg3);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(StringFormat_1SetTabStops)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jint arg2, jfloatArray arg3)
 {
 	jfloat *lparg3=NULL;
@@ -2601,8 +2595,8 @@ fail:
 #endif
 
 #ifndef NO_StringFormat_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(StringFormat_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(StringFormat_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(StringFormat_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(StringFormat_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, StringFormat_1delete_FUNC);
@@ -2612,8 +2606,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(StringFormat_1delete)
 #endif
 
 #ifndef NO_TextureBrush_1ResetTransform
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1ResetTransform)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1ResetTransform)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1ResetTransform)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1ResetTransform)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -2625,8 +2619,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1ResetTransform)
 #endif
 
 #ifndef NO_TextureBrush_1ScaleTransform
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1ScaleTransform)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
-JNIEXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1ScaleTransform)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1ScaleTransform)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1ScaleTransform)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3)
 {
 	jint rc = 0;
@@ -2638,8 +2632,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1ScaleTransform)
 #endif
 
 #ifndef NO_TextureBrush_1SetTransform
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1SetTransform)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
-JNIEXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1SetTransform)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1SetTransform)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1SetTransform)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jint rc = 0;
@@ -2651,8 +2645,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1SetTransform)
 #endif
 
 #ifndef NO_TextureBrush_1TranslateTransform
-extern "C" JNIEXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1TranslateTransform)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
-JNIEXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1TranslateTransform)
+extern "C" SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1TranslateTransform)(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3);
+SWT_NATIVE_EXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1TranslateTransform)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1, jfloat arg2, jint arg3)
 {
 	jint rc = 0;
@@ -2664,8 +2658,8 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(TextureBrush_1TranslateTransform)
 #endif
 
 #ifndef NO_TextureBrush_1delete
-extern "C" JNIEXPORT void JNICALL Gdip_NATIVE(TextureBrush_1delete)(JNIEnv *env, jclass that, jintLong arg0);
-JNIEXPORT void JNICALL Gdip_NATIVE(TextureBrush_1delete)
+extern "C" SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(TextureBrush_1delete)(JNIEnv *env, jclass that, jintLong arg0);
+SWT_NATIVE_EXPORT void JNICALL Gdip_NATIVE(TextureBrush_1delete)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	Gdip_NATIVE_ENTER(env, that, TextureBrush_1delete_FUNC);
@@ -2675,8 +2669,8 @@ JNIEXPORT void JNICALL Gdip_NATIVE(TextureBrush_1delete)
 #endif
 
 #ifndef NO_TextureBrush_1new
-extern "C" JNIEXPORT jintLong JNICALL Gdip_NATIVE(TextureBrush_1new)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jfloat arg2, jfloat arg3, jfloat arg4, jfloat arg5);
-JNIEXPORT jintLong JNICALL Gdip_NATIVE(TextureBrush_1new)
+extern "C" SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(TextureBrush_1new)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jfloat arg2, jfloat arg3, jfloat arg4, jfloat arg5);
+SWT_NATIVE_EXPORT jintLong JNICALL Gdip_NATIVE(TextureBrush_1new)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jfloat arg2, jfloat arg3, jfloat arg4, jfloat arg5)
 {
 	jintLong rc = 0;
@@ -2687,3 +2681,1229 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(TextureBrush_1new)
 }
 #endif
 
+#ifndef NO_REGISTER_NATIVES
+static JNINativeMethod Gdip_nativeMethods[] = {
+#ifndef NO_BitmapData_1delete
+#ifndef JNI64
+	{(char *)"BitmapData_delete", (char *)"(I)V", (void *)Gdip_NATIVE(BitmapData_1delete)},
+#else
+	{(char *)"BitmapData_delete", (char *)"(J)V", (void *)Gdip_NATIVE(BitmapData_1delete)},
+#endif
+#endif
+#ifndef NO_BitmapData_1new
+#ifndef JNI64
+	{(char *)"BitmapData_new", (char *)"()I", (void *)Gdip_NATIVE(BitmapData_1new)},
+#else
+	{(char *)"BitmapData_new", (char *)"()J", (void *)Gdip_NATIVE(BitmapData_1new)},
+#endif
+#endif
+#ifndef NO_Bitmap_1GetHBITMAP
+#ifndef JNI64
+	{(char *)"Bitmap_GetHBITMAP", (char *)"(II[I)I", (void *)Gdip_NATIVE(Bitmap_1GetHBITMAP)},
+#else
+	{(char *)"Bitmap_GetHBITMAP", (char *)"(JJ[J)I", (void *)Gdip_NATIVE(Bitmap_1GetHBITMAP)},
+#endif
+#endif
+#ifndef NO_Bitmap_1GetHICON
+#ifndef JNI64
+	{(char *)"Bitmap_GetHICON", (char *)"(I[I)I", (void *)Gdip_NATIVE(Bitmap_1GetHICON)},
+#else
+	{(char *)"Bitmap_GetHICON", (char *)"(J[J)I", (void *)Gdip_NATIVE(Bitmap_1GetHICON)},
+#endif
+#endif
+#ifndef NO_Bitmap_1LockBits
+#ifndef JNI64
+	{(char *)"Bitmap_LockBits", (char *)"(IIIII)I", (void *)Gdip_NATIVE(Bitmap_1LockBits)},
+#else
+	{(char *)"Bitmap_LockBits", (char *)"(JJIIJ)I", (void *)Gdip_NATIVE(Bitmap_1LockBits)},
+#endif
+#endif
+#ifndef NO_Bitmap_1UnlockBits
+#ifndef JNI64
+	{(char *)"Bitmap_UnlockBits", (char *)"(II)I", (void *)Gdip_NATIVE(Bitmap_1UnlockBits)},
+#else
+	{(char *)"Bitmap_UnlockBits", (char *)"(JJ)I", (void *)Gdip_NATIVE(Bitmap_1UnlockBits)},
+#endif
+#endif
+#ifndef NO_Bitmap_1delete
+#ifndef JNI64
+	{(char *)"Bitmap_delete", (char *)"(I)V", (void *)Gdip_NATIVE(Bitmap_1delete)},
+#else
+	{(char *)"Bitmap_delete", (char *)"(J)V", (void *)Gdip_NATIVE(Bitmap_1delete)},
+#endif
+#endif
+#if (!defined(NO_Bitmap_1new__I) && !defined(JNI64)) || (!defined(NO_Bitmap_1new__J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Bitmap_new", (char *)"(I)I", (void *)Gdip_NATIVE(Bitmap_1new__I)},
+#else
+	{(char *)"Bitmap_new", (char *)"(J)J", (void *)Gdip_NATIVE(Bitmap_1new__J)},
+#endif
+#endif
+#if (!defined(NO_Bitmap_1new__II) && !defined(JNI64)) || (!defined(NO_Bitmap_1new__JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Bitmap_new", (char *)"(II)I", (void *)Gdip_NATIVE(Bitmap_1new__II)},
+#else
+	{(char *)"Bitmap_new", (char *)"(JJ)J", (void *)Gdip_NATIVE(Bitmap_1new__JJ)},
+#endif
+#endif
+#if (!defined(NO_Bitmap_1new__IIIII) && !defined(JNI64)) || (!defined(NO_Bitmap_1new__IIIIJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Bitmap_new", (char *)"(IIIII)I", (void *)Gdip_NATIVE(Bitmap_1new__IIIII)},
+#else
+	{(char *)"Bitmap_new", (char *)"(IIIIJ)J", (void *)Gdip_NATIVE(Bitmap_1new__IIIIJ)},
+#endif
+#endif
+#ifndef NO_Bitmap_1new___3CZ
+#ifndef JNI64
+	{(char *)"Bitmap_new", (char *)"([CZ)I", (void *)Gdip_NATIVE(Bitmap_1new___3CZ)},
+#else
+	{(char *)"Bitmap_new", (char *)"([CZ)J", (void *)Gdip_NATIVE(Bitmap_1new___3CZ)},
+#endif
+#endif
+#ifndef NO_Brush_1Clone
+#ifndef JNI64
+	{(char *)"Brush_Clone", (char *)"(I)I", (void *)Gdip_NATIVE(Brush_1Clone)},
+#else
+	{(char *)"Brush_Clone", (char *)"(J)J", (void *)Gdip_NATIVE(Brush_1Clone)},
+#endif
+#endif
+#ifndef NO_Brush_1GetType
+#ifndef JNI64
+	{(char *)"Brush_GetType", (char *)"(I)I", (void *)Gdip_NATIVE(Brush_1GetType)},
+#else
+	{(char *)"Brush_GetType", (char *)"(J)I", (void *)Gdip_NATIVE(Brush_1GetType)},
+#endif
+#endif
+#ifndef NO_ColorPalette_1sizeof
+	{(char *)"ColorPalette_sizeof", (char *)"()I", (void *)Gdip_NATIVE(ColorPalette_1sizeof)},
+#endif
+#ifndef NO_Color_1delete
+#ifndef JNI64
+	{(char *)"Color_delete", (char *)"(I)V", (void *)Gdip_NATIVE(Color_1delete)},
+#else
+	{(char *)"Color_delete", (char *)"(J)V", (void *)Gdip_NATIVE(Color_1delete)},
+#endif
+#endif
+#ifndef NO_Color_1new
+#ifndef JNI64
+	{(char *)"Color_new", (char *)"(I)I", (void *)Gdip_NATIVE(Color_1new)},
+#else
+	{(char *)"Color_new", (char *)"(I)J", (void *)Gdip_NATIVE(Color_1new)},
+#endif
+#endif
+#ifndef NO_FontFamily_1GetFamilyName
+#ifndef JNI64
+	{(char *)"FontFamily_GetFamilyName", (char *)"(I[CC)I", (void *)Gdip_NATIVE(FontFamily_1GetFamilyName)},
+#else
+	{(char *)"FontFamily_GetFamilyName", (char *)"(J[CC)I", (void *)Gdip_NATIVE(FontFamily_1GetFamilyName)},
+#endif
+#endif
+#ifndef NO_FontFamily_1IsAvailable
+#ifndef JNI64
+	{(char *)"FontFamily_IsAvailable", (char *)"(I)Z", (void *)Gdip_NATIVE(FontFamily_1IsAvailable)},
+#else
+	{(char *)"FontFamily_IsAvailable", (char *)"(J)Z", (void *)Gdip_NATIVE(FontFamily_1IsAvailable)},
+#endif
+#endif
+#ifndef NO_FontFamily_1delete
+#ifndef JNI64
+	{(char *)"FontFamily_delete", (char *)"(I)V", (void *)Gdip_NATIVE(FontFamily_1delete)},
+#else
+	{(char *)"FontFamily_delete", (char *)"(J)V", (void *)Gdip_NATIVE(FontFamily_1delete)},
+#endif
+#endif
+#ifndef NO_FontFamily_1new__
+#ifndef JNI64
+	{(char *)"FontFamily_new", (char *)"()I", (void *)Gdip_NATIVE(FontFamily_1new__)},
+#else
+	{(char *)"FontFamily_new", (char *)"()J", (void *)Gdip_NATIVE(FontFamily_1new__)},
+#endif
+#endif
+#if (!defined(NO_FontFamily_1new___3CI) && !defined(JNI64)) || (!defined(NO_FontFamily_1new___3CJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"FontFamily_new", (char *)"([CI)I", (void *)Gdip_NATIVE(FontFamily_1new___3CI)},
+#else
+	{(char *)"FontFamily_new", (char *)"([CJ)J", (void *)Gdip_NATIVE(FontFamily_1new___3CJ)},
+#endif
+#endif
+#ifndef NO_Font_1GetFamily
+#ifndef JNI64
+	{(char *)"Font_GetFamily", (char *)"(II)I", (void *)Gdip_NATIVE(Font_1GetFamily)},
+#else
+	{(char *)"Font_GetFamily", (char *)"(JJ)I", (void *)Gdip_NATIVE(Font_1GetFamily)},
+#endif
+#endif
+#ifndef NO_Font_1GetLogFontW
+#ifndef JNI64
+	{(char *)"Font_GetLogFontW", (char *)"(III)I", (void *)Gdip_NATIVE(Font_1GetLogFontW)},
+#else
+	{(char *)"Font_GetLogFontW", (char *)"(JJJ)I", (void *)Gdip_NATIVE(Font_1GetLogFontW)},
+#endif
+#endif
+#ifndef NO_Font_1GetSize
+#ifndef JNI64
+	{(char *)"Font_GetSize", (char *)"(I)F", (void *)Gdip_NATIVE(Font_1GetSize)},
+#else
+	{(char *)"Font_GetSize", (char *)"(J)F", (void *)Gdip_NATIVE(Font_1GetSize)},
+#endif
+#endif
+#ifndef NO_Font_1GetStyle
+#ifndef JNI64
+	{(char *)"Font_GetStyle", (char *)"(I)I", (void *)Gdip_NATIVE(Font_1GetStyle)},
+#else
+	{(char *)"Font_GetStyle", (char *)"(J)I", (void *)Gdip_NATIVE(Font_1GetStyle)},
+#endif
+#endif
+#ifndef NO_Font_1IsAvailable
+#ifndef JNI64
+	{(char *)"Font_IsAvailable", (char *)"(I)Z", (void *)Gdip_NATIVE(Font_1IsAvailable)},
+#else
+	{(char *)"Font_IsAvailable", (char *)"(J)Z", (void *)Gdip_NATIVE(Font_1IsAvailable)},
+#endif
+#endif
+#ifndef NO_Font_1delete
+#ifndef JNI64
+	{(char *)"Font_delete", (char *)"(I)V", (void *)Gdip_NATIVE(Font_1delete)},
+#else
+	{(char *)"Font_delete", (char *)"(J)V", (void *)Gdip_NATIVE(Font_1delete)},
+#endif
+#endif
+#if (!defined(NO_Font_1new__IFII) && !defined(JNI64)) || (!defined(NO_Font_1new__JFII) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Font_new", (char *)"(IFII)I", (void *)Gdip_NATIVE(Font_1new__IFII)},
+#else
+	{(char *)"Font_new", (char *)"(JFII)J", (void *)Gdip_NATIVE(Font_1new__JFII)},
+#endif
+#endif
+#if (!defined(NO_Font_1new__II) && !defined(JNI64)) || (!defined(NO_Font_1new__JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Font_new", (char *)"(II)I", (void *)Gdip_NATIVE(Font_1new__II)},
+#else
+	{(char *)"Font_new", (char *)"(JJ)J", (void *)Gdip_NATIVE(Font_1new__JJ)},
+#endif
+#endif
+#if (!defined(NO_Font_1new___3CFIII) && !defined(JNI64)) || (!defined(NO_Font_1new___3CFIIJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Font_new", (char *)"([CFIII)I", (void *)Gdip_NATIVE(Font_1new___3CFIII)},
+#else
+	{(char *)"Font_new", (char *)"([CFIIJ)J", (void *)Gdip_NATIVE(Font_1new___3CFIIJ)},
+#endif
+#endif
+#ifndef NO_GdiplusShutdown
+#ifndef JNI64
+	{(char *)"GdiplusShutdown", (char *)"(I)V", (void *)Gdip_NATIVE(GdiplusShutdown)},
+#else
+	{(char *)"GdiplusShutdown", (char *)"(J)V", (void *)Gdip_NATIVE(GdiplusShutdown)},
+#endif
+#endif
+#ifndef NO_GdiplusStartup
+#ifndef JNI64
+	{(char *)"GdiplusStartup", (char *)"([ILorg/eclipse/swt/internal/gdip/GdiplusStartupInput;I)I", (void *)Gdip_NATIVE(GdiplusStartup)},
+#else
+	{(char *)"GdiplusStartup", (char *)"([JLorg/eclipse/swt/internal/gdip/GdiplusStartupInput;J)I", (void *)Gdip_NATIVE(GdiplusStartup)},
+#endif
+#endif
+#ifndef NO_GdiplusStartupInput_1sizeof
+	{(char *)"GdiplusStartupInput_sizeof", (char *)"()I", (void *)Gdip_NATIVE(GdiplusStartupInput_1sizeof)},
+#endif
+#ifndef NO_GraphicsPath_1AddArc
+#ifndef JNI64
+	{(char *)"GraphicsPath_AddArc", (char *)"(IFFFFFF)I", (void *)Gdip_NATIVE(GraphicsPath_1AddArc)},
+#else
+	{(char *)"GraphicsPath_AddArc", (char *)"(JFFFFFF)I", (void *)Gdip_NATIVE(GraphicsPath_1AddArc)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1AddBezier
+#ifndef JNI64
+	{(char *)"GraphicsPath_AddBezier", (char *)"(IFFFFFFFF)I", (void *)Gdip_NATIVE(GraphicsPath_1AddBezier)},
+#else
+	{(char *)"GraphicsPath_AddBezier", (char *)"(JFFFFFFFF)I", (void *)Gdip_NATIVE(GraphicsPath_1AddBezier)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1AddLine
+#ifndef JNI64
+	{(char *)"GraphicsPath_AddLine", (char *)"(IFFFF)I", (void *)Gdip_NATIVE(GraphicsPath_1AddLine)},
+#else
+	{(char *)"GraphicsPath_AddLine", (char *)"(JFFFF)I", (void *)Gdip_NATIVE(GraphicsPath_1AddLine)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1AddPath
+#ifndef JNI64
+	{(char *)"GraphicsPath_AddPath", (char *)"(IIZ)I", (void *)Gdip_NATIVE(GraphicsPath_1AddPath)},
+#else
+	{(char *)"GraphicsPath_AddPath", (char *)"(JJZ)I", (void *)Gdip_NATIVE(GraphicsPath_1AddPath)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1AddRectangle
+#ifndef JNI64
+	{(char *)"GraphicsPath_AddRectangle", (char *)"(ILorg/eclipse/swt/internal/gdip/RectF;)I", (void *)Gdip_NATIVE(GraphicsPath_1AddRectangle)},
+#else
+	{(char *)"GraphicsPath_AddRectangle", (char *)"(JLorg/eclipse/swt/internal/gdip/RectF;)I", (void *)Gdip_NATIVE(GraphicsPath_1AddRectangle)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1AddString
+#ifndef JNI64
+	{(char *)"GraphicsPath_AddString", (char *)"(I[CIIIFLorg/eclipse/swt/internal/gdip/PointF;I)I", (void *)Gdip_NATIVE(GraphicsPath_1AddString)},
+#else
+	{(char *)"GraphicsPath_AddString", (char *)"(J[CIJIFLorg/eclipse/swt/internal/gdip/PointF;J)I", (void *)Gdip_NATIVE(GraphicsPath_1AddString)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1Clone
+#ifndef JNI64
+	{(char *)"GraphicsPath_Clone", (char *)"(I)I", (void *)Gdip_NATIVE(GraphicsPath_1Clone)},
+#else
+	{(char *)"GraphicsPath_Clone", (char *)"(J)J", (void *)Gdip_NATIVE(GraphicsPath_1Clone)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1CloseFigure
+#ifndef JNI64
+	{(char *)"GraphicsPath_CloseFigure", (char *)"(I)I", (void *)Gdip_NATIVE(GraphicsPath_1CloseFigure)},
+#else
+	{(char *)"GraphicsPath_CloseFigure", (char *)"(J)I", (void *)Gdip_NATIVE(GraphicsPath_1CloseFigure)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1Flatten
+#ifndef JNI64
+	{(char *)"GraphicsPath_Flatten", (char *)"(IIF)I", (void *)Gdip_NATIVE(GraphicsPath_1Flatten)},
+#else
+	{(char *)"GraphicsPath_Flatten", (char *)"(JJF)I", (void *)Gdip_NATIVE(GraphicsPath_1Flatten)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1GetBounds
+#ifndef JNI64
+	{(char *)"GraphicsPath_GetBounds", (char *)"(ILorg/eclipse/swt/internal/gdip/RectF;II)I", (void *)Gdip_NATIVE(GraphicsPath_1GetBounds)},
+#else
+	{(char *)"GraphicsPath_GetBounds", (char *)"(JLorg/eclipse/swt/internal/gdip/RectF;JJ)I", (void *)Gdip_NATIVE(GraphicsPath_1GetBounds)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1GetLastPoint
+#ifndef JNI64
+	{(char *)"GraphicsPath_GetLastPoint", (char *)"(ILorg/eclipse/swt/internal/gdip/PointF;)I", (void *)Gdip_NATIVE(GraphicsPath_1GetLastPoint)},
+#else
+	{(char *)"GraphicsPath_GetLastPoint", (char *)"(JLorg/eclipse/swt/internal/gdip/PointF;)I", (void *)Gdip_NATIVE(GraphicsPath_1GetLastPoint)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1GetPathTypes
+#ifndef JNI64
+	{(char *)"GraphicsPath_GetPathTypes", (char *)"(I[BI)I", (void *)Gdip_NATIVE(GraphicsPath_1GetPathTypes)},
+#else
+	{(char *)"GraphicsPath_GetPathTypes", (char *)"(J[BI)I", (void *)Gdip_NATIVE(GraphicsPath_1GetPathTypes)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1GetPointCount
+#ifndef JNI64
+	{(char *)"GraphicsPath_GetPointCount", (char *)"(I)I", (void *)Gdip_NATIVE(GraphicsPath_1GetPointCount)},
+#else
+	{(char *)"GraphicsPath_GetPointCount", (char *)"(J)I", (void *)Gdip_NATIVE(GraphicsPath_1GetPointCount)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1IsOutlineVisible
+#ifndef JNI64
+	{(char *)"GraphicsPath_IsOutlineVisible", (char *)"(IFFII)Z", (void *)Gdip_NATIVE(GraphicsPath_1IsOutlineVisible)},
+#else
+	{(char *)"GraphicsPath_IsOutlineVisible", (char *)"(JFFJJ)Z", (void *)Gdip_NATIVE(GraphicsPath_1IsOutlineVisible)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1IsVisible
+#ifndef JNI64
+	{(char *)"GraphicsPath_IsVisible", (char *)"(IFFI)Z", (void *)Gdip_NATIVE(GraphicsPath_1IsVisible)},
+#else
+	{(char *)"GraphicsPath_IsVisible", (char *)"(JFFJ)Z", (void *)Gdip_NATIVE(GraphicsPath_1IsVisible)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1SetFillMode
+#ifndef JNI64
+	{(char *)"GraphicsPath_SetFillMode", (char *)"(II)I", (void *)Gdip_NATIVE(GraphicsPath_1SetFillMode)},
+#else
+	{(char *)"GraphicsPath_SetFillMode", (char *)"(JI)I", (void *)Gdip_NATIVE(GraphicsPath_1SetFillMode)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1StartFigure
+#ifndef JNI64
+	{(char *)"GraphicsPath_StartFigure", (char *)"(I)I", (void *)Gdip_NATIVE(GraphicsPath_1StartFigure)},
+#else
+	{(char *)"GraphicsPath_StartFigure", (char *)"(J)I", (void *)Gdip_NATIVE(GraphicsPath_1StartFigure)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1Transform
+#ifndef JNI64
+	{(char *)"GraphicsPath_Transform", (char *)"(II)I", (void *)Gdip_NATIVE(GraphicsPath_1Transform)},
+#else
+	{(char *)"GraphicsPath_Transform", (char *)"(JJ)I", (void *)Gdip_NATIVE(GraphicsPath_1Transform)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1delete
+#ifndef JNI64
+	{(char *)"GraphicsPath_delete", (char *)"(I)V", (void *)Gdip_NATIVE(GraphicsPath_1delete)},
+#else
+	{(char *)"GraphicsPath_delete", (char *)"(J)V", (void *)Gdip_NATIVE(GraphicsPath_1delete)},
+#endif
+#endif
+#ifndef NO_GraphicsPath_1new__I
+#ifndef JNI64
+	{(char *)"GraphicsPath_new", (char *)"(I)I", (void *)Gdip_NATIVE(GraphicsPath_1new__I)},
+#else
+	{(char *)"GraphicsPath_new", (char *)"(I)J", (void *)Gdip_NATIVE(GraphicsPath_1new__I)},
+#endif
+#endif
+#ifndef NO_Graphics_1DrawArc
+#ifndef JNI64
+	{(char *)"Graphics_DrawArc", (char *)"(IIIIIIFF)I", (void *)Gdip_NATIVE(Graphics_1DrawArc)},
+#else
+	{(char *)"Graphics_DrawArc", (char *)"(JJIIIIFF)I", (void *)Gdip_NATIVE(Graphics_1DrawArc)},
+#endif
+#endif
+#if (!defined(NO_Graphics_1DrawDriverString__IIIIILorg_eclipse_swt_internal_gdip_PointF_2II) && !defined(JNI64)) || (!defined(NO_Graphics_1DrawDriverString__JJIJJLorg_eclipse_swt_internal_gdip_PointF_2IJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Graphics_DrawDriverString", (char *)"(IIIIILorg/eclipse/swt/internal/gdip/PointF;II)I", (void *)Gdip_NATIVE(Graphics_1DrawDriverString__IIIIILorg_eclipse_swt_internal_gdip_PointF_2II)},
+#else
+	{(char *)"Graphics_DrawDriverString", (char *)"(JJIJJLorg/eclipse/swt/internal/gdip/PointF;IJ)I", (void *)Gdip_NATIVE(Graphics_1DrawDriverString__JJIJJLorg_eclipse_swt_internal_gdip_PointF_2IJ)},
+#endif
+#endif
+#ifndef NO_Graphics_1DrawEllipse
+#ifndef JNI64
+	{(char *)"Graphics_DrawEllipse", (char *)"(IIIIII)I", (void *)Gdip_NATIVE(Graphics_1DrawEllipse)},
+#else
+	{(char *)"Graphics_DrawEllipse", (char *)"(JJIIII)I", (void *)Gdip_NATIVE(Graphics_1DrawEllipse)},
+#endif
+#endif
+#if (!defined(NO_Graphics_1DrawImage__IIII) && !defined(JNI64)) || (!defined(NO_Graphics_1DrawImage__JJII) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Graphics_DrawImage", (char *)"(IIII)I", (void *)Gdip_NATIVE(Graphics_1DrawImage__IIII)},
+#else
+	{(char *)"Graphics_DrawImage", (char *)"(JJII)I", (void *)Gdip_NATIVE(Graphics_1DrawImage__JJII)},
+#endif
+#endif
+#if (!defined(NO_Graphics_1DrawImage__IILorg_eclipse_swt_internal_gdip_Rect_2IIIIIIII) && !defined(JNI64)) || (!defined(NO_Graphics_1DrawImage__JJLorg_eclipse_swt_internal_gdip_Rect_2IIIIIJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Graphics_DrawImage", (char *)"(IILorg/eclipse/swt/internal/gdip/Rect;IIIIIIII)I", (void *)Gdip_NATIVE(Graphics_1DrawImage__IILorg_eclipse_swt_internal_gdip_Rect_2IIIIIIII)},
+#else
+	{(char *)"Graphics_DrawImage", (char *)"(JJLorg/eclipse/swt/internal/gdip/Rect;IIIIIJJJ)I", (void *)Gdip_NATIVE(Graphics_1DrawImage__JJLorg_eclipse_swt_internal_gdip_Rect_2IIIIIJJJ)},
+#endif
+#endif
+#ifndef NO_Graphics_1DrawLine
+#ifndef JNI64
+	{(char *)"Graphics_DrawLine", (char *)"(IIIIII)I", (void *)Gdip_NATIVE(Graphics_1DrawLine)},
+#else
+	{(char *)"Graphics_DrawLine", (char *)"(JJIIII)I", (void *)Gdip_NATIVE(Graphics_1DrawLine)},
+#endif
+#endif
+#ifndef NO_Graphics_1DrawPath
+#ifndef JNI64
+	{(char *)"Graphics_DrawPath", (char *)"(III)I", (void *)Gdip_NATIVE(Graphics_1DrawPath)},
+#else
+	{(char *)"Graphics_DrawPath", (char *)"(JJJ)I", (void *)Gdip_NATIVE(Graphics_1DrawPath)},
+#endif
+#endif
+#ifndef NO_Graphics_1DrawRectangle
+#ifndef JNI64
+	{(char *)"Graphics_DrawRectangle", (char *)"(IIIIII)I", (void *)Gdip_NATIVE(Graphics_1DrawRectangle)},
+#else
+	{(char *)"Graphics_DrawRectangle", (char *)"(JJIIII)I", (void *)Gdip_NATIVE(Graphics_1DrawRectangle)},
+#endif
+#endif
+#if (!defined(NO_Graphics_1DrawString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2I) && !defined(JNI64)) || (!defined(NO_Graphics_1DrawString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Graphics_DrawString", (char *)"(I[CIILorg/eclipse/swt/internal/gdip/PointF;I)I", (void *)Gdip_NATIVE(Graphics_1DrawString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2I)},
+#else
+	{(char *)"Graphics_DrawString", (char *)"(J[CIJLorg/eclipse/swt/internal/gdip/PointF;J)I", (void *)Gdip_NATIVE(Graphics_1DrawString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2J)},
+#endif
+#endif
+#if (!defined(NO_Graphics_1DrawString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2II) && !defined(JNI64)) || (!defined(NO_Graphics_1DrawString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Graphics_DrawString", (char *)"(I[CIILorg/eclipse/swt/internal/gdip/PointF;II)I", (void *)Gdip_NATIVE(Graphics_1DrawString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2II)},
+#else
+	{(char *)"Graphics_DrawString", (char *)"(J[CIJLorg/eclipse/swt/internal/gdip/PointF;JJ)I", (void *)Gdip_NATIVE(Graphics_1DrawString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2JJ)},
+#endif
+#endif
+#ifndef NO_Graphics_1FillEllipse
+#ifndef JNI64
+	{(char *)"Graphics_FillEllipse", (char *)"(IIIIII)I", (void *)Gdip_NATIVE(Graphics_1FillEllipse)},
+#else
+	{(char *)"Graphics_FillEllipse", (char *)"(JJIIII)I", (void *)Gdip_NATIVE(Graphics_1FillEllipse)},
+#endif
+#endif
+#ifndef NO_Graphics_1FillPath
+#ifndef JNI64
+	{(char *)"Graphics_FillPath", (char *)"(III)I", (void *)Gdip_NATIVE(Graphics_1FillPath)},
+#else
+	{(char *)"Graphics_FillPath", (char *)"(JJJ)I", (void *)Gdip_NATIVE(Graphics_1FillPath)},
+#endif
+#endif
+#ifndef NO_Graphics_1FillPie
+#ifndef JNI64
+	{(char *)"Graphics_FillPie", (char *)"(IIIIIIFF)I", (void *)Gdip_NATIVE(Graphics_1FillPie)},
+#else
+	{(char *)"Graphics_FillPie", (char *)"(JJIIIIFF)I", (void *)Gdip_NATIVE(Graphics_1FillPie)},
+#endif
+#endif
+#ifndef NO_Graphics_1FillRectangle
+#ifndef JNI64
+	{(char *)"Graphics_FillRectangle", (char *)"(IIIIII)I", (void *)Gdip_NATIVE(Graphics_1FillRectangle)},
+#else
+	{(char *)"Graphics_FillRectangle", (char *)"(JJIIII)I", (void *)Gdip_NATIVE(Graphics_1FillRectangle)},
+#endif
+#endif
+#ifndef NO_Graphics_1Flush
+#ifndef JNI64
+	{(char *)"Graphics_Flush", (char *)"(II)V", (void *)Gdip_NATIVE(Graphics_1Flush)},
+#else
+	{(char *)"Graphics_Flush", (char *)"(JI)V", (void *)Gdip_NATIVE(Graphics_1Flush)},
+#endif
+#endif
+#ifndef NO_Graphics_1GetClip
+#ifndef JNI64
+	{(char *)"Graphics_GetClip", (char *)"(II)I", (void *)Gdip_NATIVE(Graphics_1GetClip)},
+#else
+	{(char *)"Graphics_GetClip", (char *)"(JJ)I", (void *)Gdip_NATIVE(Graphics_1GetClip)},
+#endif
+#endif
+#if (!defined(NO_Graphics_1GetClipBounds__ILorg_eclipse_swt_internal_gdip_RectF_2) && !defined(JNI64)) || (!defined(NO_Graphics_1GetClipBounds__JLorg_eclipse_swt_internal_gdip_RectF_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Graphics_GetClipBounds", (char *)"(ILorg/eclipse/swt/internal/gdip/RectF;)I", (void *)Gdip_NATIVE(Graphics_1GetClipBounds__ILorg_eclipse_swt_internal_gdip_RectF_2)},
+#else
+	{(char *)"Graphics_GetClipBounds", (char *)"(JLorg/eclipse/swt/internal/gdip/RectF;)I", (void *)Gdip_NATIVE(Graphics_1GetClipBounds__JLorg_eclipse_swt_internal_gdip_RectF_2)},
+#endif
+#endif
+#if (!defined(NO_Graphics_1GetClipBounds__ILorg_eclipse_swt_internal_gdip_Rect_2) && !defined(JNI64)) || (!defined(NO_Graphics_1GetClipBounds__JLorg_eclipse_swt_internal_gdip_Rect_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Graphics_GetClipBounds", (char *)"(ILorg/eclipse/swt/internal/gdip/Rect;)I", (void *)Gdip_NATIVE(Graphics_1GetClipBounds__ILorg_eclipse_swt_internal_gdip_Rect_2)},
+#else
+	{(char *)"Graphics_GetClipBounds", (char *)"(JLorg/eclipse/swt/internal/gdip/Rect;)I", (void *)Gdip_NATIVE(Graphics_1GetClipBounds__JLorg_eclipse_swt_internal_gdip_Rect_2)},
+#endif
+#endif
+#ifndef NO_Graphics_1GetHDC
+#ifndef JNI64
+	{(char *)"Graphics_GetHDC", (char *)"(I)I", (void *)Gdip_NATIVE(Graphics_1GetHDC)},
+#else
+	{(char *)"Graphics_GetHDC", (char *)"(J)J", (void *)Gdip_NATIVE(Graphics_1GetHDC)},
+#endif
+#endif
+#ifndef NO_Graphics_1GetInterpolationMode
+#ifndef JNI64
+	{(char *)"Graphics_GetInterpolationMode", (char *)"(I)I", (void *)Gdip_NATIVE(Graphics_1GetInterpolationMode)},
+#else
+	{(char *)"Graphics_GetInterpolationMode", (char *)"(J)I", (void *)Gdip_NATIVE(Graphics_1GetInterpolationMode)},
+#endif
+#endif
+#ifndef NO_Graphics_1GetSmoothingMode
+#ifndef JNI64
+	{(char *)"Graphics_GetSmoothingMode", (char *)"(I)I", (void *)Gdip_NATIVE(Graphics_1GetSmoothingMode)},
+#else
+	{(char *)"Graphics_GetSmoothingMode", (char *)"(J)I", (void *)Gdip_NATIVE(Graphics_1GetSmoothingMode)},
+#endif
+#endif
+#ifndef NO_Graphics_1GetTextRenderingHint
+#ifndef JNI64
+	{(char *)"Graphics_GetTextRenderingHint", (char *)"(I)I", (void *)Gdip_NATIVE(Graphics_1GetTextRenderingHint)},
+#else
+	{(char *)"Graphics_GetTextRenderingHint", (char *)"(J)I", (void *)Gdip_NATIVE(Graphics_1GetTextRenderingHint)},
+#endif
+#endif
+#ifndef NO_Graphics_1GetTransform
+#ifndef JNI64
+	{(char *)"Graphics_GetTransform", (char *)"(II)I", (void *)Gdip_NATIVE(Graphics_1GetTransform)},
+#else
+	{(char *)"Graphics_GetTransform", (char *)"(JJ)I", (void *)Gdip_NATIVE(Graphics_1GetTransform)},
+#endif
+#endif
+#ifndef NO_Graphics_1GetVisibleClipBounds
+#ifndef JNI64
+	{(char *)"Graphics_GetVisibleClipBounds", (char *)"(ILorg/eclipse/swt/internal/gdip/Rect;)I", (void *)Gdip_NATIVE(Graphics_1GetVisibleClipBounds)},
+#else
+	{(char *)"Graphics_GetVisibleClipBounds", (char *)"(JLorg/eclipse/swt/internal/gdip/Rect;)I", (void *)Gdip_NATIVE(Graphics_1GetVisibleClipBounds)},
+#endif
+#endif
+#if (!defined(NO_Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2ILorg_eclipse_swt_internal_gdip_RectF_2) && !defined(JNI64)) || (!defined(NO_Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2JLorg_eclipse_swt_internal_gdip_RectF_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Graphics_MeasureString", (char *)"(I[CIILorg/eclipse/swt/internal/gdip/PointF;ILorg/eclipse/swt/internal/gdip/RectF;)I", (void *)Gdip_NATIVE(Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2ILorg_eclipse_swt_internal_gdip_RectF_2)},
+#else
+	{(char *)"Graphics_MeasureString", (char *)"(J[CIJLorg/eclipse/swt/internal/gdip/PointF;JLorg/eclipse/swt/internal/gdip/RectF;)I", (void *)Gdip_NATIVE(Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2JLorg_eclipse_swt_internal_gdip_RectF_2)},
+#endif
+#endif
+#if (!defined(NO_Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2) && !defined(JNI64)) || (!defined(NO_Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Graphics_MeasureString", (char *)"(I[CIILorg/eclipse/swt/internal/gdip/PointF;Lorg/eclipse/swt/internal/gdip/RectF;)I", (void *)Gdip_NATIVE(Graphics_1MeasureString__I_3CIILorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2)},
+#else
+	{(char *)"Graphics_MeasureString", (char *)"(J[CIJLorg/eclipse/swt/internal/gdip/PointF;Lorg/eclipse/swt/internal/gdip/RectF;)I", (void *)Gdip_NATIVE(Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2)},
+#endif
+#endif
+#ifndef NO_Graphics_1ReleaseHDC
+#ifndef JNI64
+	{(char *)"Graphics_ReleaseHDC", (char *)"(II)V", (void *)Gdip_NATIVE(Graphics_1ReleaseHDC)},
+#else
+	{(char *)"Graphics_ReleaseHDC", (char *)"(JJ)V", (void *)Gdip_NATIVE(Graphics_1ReleaseHDC)},
+#endif
+#endif
+#ifndef NO_Graphics_1ResetClip
+#ifndef JNI64
+	{(char *)"Graphics_ResetClip", (char *)"(I)I", (void *)Gdip_NATIVE(Graphics_1ResetClip)},
+#else
+	{(char *)"Graphics_ResetClip", (char *)"(J)I", (void *)Gdip_NATIVE(Graphics_1ResetClip)},
+#endif
+#endif
+#ifndef NO_Graphics_1Restore
+#ifndef JNI64
+	{(char *)"Graphics_Restore", (char *)"(II)I", (void *)Gdip_NATIVE(Graphics_1Restore)},
+#else
+	{(char *)"Graphics_Restore", (char *)"(JI)I", (void *)Gdip_NATIVE(Graphics_1Restore)},
+#endif
+#endif
+#ifndef NO_Graphics_1Save
+#ifndef JNI64
+	{(char *)"Graphics_Save", (char *)"(I)I", (void *)Gdip_NATIVE(Graphics_1Save)},
+#else
+	{(char *)"Graphics_Save", (char *)"(J)I", (void *)Gdip_NATIVE(Graphics_1Save)},
+#endif
+#endif
+#ifndef NO_Graphics_1ScaleTransform
+#ifndef JNI64
+	{(char *)"Graphics_ScaleTransform", (char *)"(IFFI)I", (void *)Gdip_NATIVE(Graphics_1ScaleTransform)},
+#else
+	{(char *)"Graphics_ScaleTransform", (char *)"(JFFI)I", (void *)Gdip_NATIVE(Graphics_1ScaleTransform)},
+#endif
+#endif
+#if (!defined(NO_Graphics_1SetClip__III) && !defined(JNI64)) || (!defined(NO_Graphics_1SetClip__JJI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Graphics_SetClip", (char *)"(III)I", (void *)Gdip_NATIVE(Graphics_1SetClip__III)},
+#else
+	{(char *)"Graphics_SetClip", (char *)"(JJI)I", (void *)Gdip_NATIVE(Graphics_1SetClip__JJI)},
+#endif
+#endif
+#if (!defined(NO_Graphics_1SetClip__ILorg_eclipse_swt_internal_gdip_Rect_2I) && !defined(JNI64)) || (!defined(NO_Graphics_1SetClip__JLorg_eclipse_swt_internal_gdip_Rect_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Graphics_SetClip", (char *)"(ILorg/eclipse/swt/internal/gdip/Rect;I)I", (void *)Gdip_NATIVE(Graphics_1SetClip__ILorg_eclipse_swt_internal_gdip_Rect_2I)},
+#else
+	{(char *)"Graphics_SetClip", (char *)"(JLorg/eclipse/swt/internal/gdip/Rect;I)I", (void *)Gdip_NATIVE(Graphics_1SetClip__JLorg_eclipse_swt_internal_gdip_Rect_2I)},
+#endif
+#endif
+#if (!defined(NO_Graphics_1SetClipPath__II) && !defined(JNI64)) || (!defined(NO_Graphics_1SetClipPath__JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Graphics_SetClipPath", (char *)"(II)I", (void *)Gdip_NATIVE(Graphics_1SetClipPath__II)},
+#else
+	{(char *)"Graphics_SetClipPath", (char *)"(JJ)I", (void *)Gdip_NATIVE(Graphics_1SetClipPath__JJ)},
+#endif
+#endif
+#if (!defined(NO_Graphics_1SetClipPath__III) && !defined(JNI64)) || (!defined(NO_Graphics_1SetClipPath__JJI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Graphics_SetClipPath", (char *)"(III)I", (void *)Gdip_NATIVE(Graphics_1SetClipPath__III)},
+#else
+	{(char *)"Graphics_SetClipPath", (char *)"(JJI)I", (void *)Gdip_NATIVE(Graphics_1SetClipPath__JJI)},
+#endif
+#endif
+#ifndef NO_Graphics_1SetCompositingQuality
+#ifndef JNI64
+	{(char *)"Graphics_SetCompositingQuality", (char *)"(II)I", (void *)Gdip_NATIVE(Graphics_1SetCompositingQuality)},
+#else
+	{(char *)"Graphics_SetCompositingQuality", (char *)"(JI)I", (void *)Gdip_NATIVE(Graphics_1SetCompositingQuality)},
+#endif
+#endif
+#ifndef NO_Graphics_1SetInterpolationMode
+#ifndef JNI64
+	{(char *)"Graphics_SetInterpolationMode", (char *)"(II)I", (void *)Gdip_NATIVE(Graphics_1SetInterpolationMode)},
+#else
+	{(char *)"Graphics_SetInterpolationMode", (char *)"(JI)I", (void *)Gdip_NATIVE(Graphics_1SetInterpolationMode)},
+#endif
+#endif
+#ifndef NO_Graphics_1SetPageUnit
+#ifndef JNI64
+	{(char *)"Graphics_SetPageUnit", (char *)"(II)I", (void *)Gdip_NATIVE(Graphics_1SetPageUnit)},
+#else
+	{(char *)"Graphics_SetPageUnit", (char *)"(JI)I", (void *)Gdip_NATIVE(Graphics_1SetPageUnit)},
+#endif
+#endif
+#ifndef NO_Graphics_1SetPixelOffsetMode
+#ifndef JNI64
+	{(char *)"Graphics_SetPixelOffsetMode", (char *)"(II)I", (void *)Gdip_NATIVE(Graphics_1SetPixelOffsetMode)},
+#else
+	{(char *)"Graphics_SetPixelOffsetMode", (char *)"(JI)I", (void *)Gdip_NATIVE(Graphics_1SetPixelOffsetMode)},
+#endif
+#endif
+#ifndef NO_Graphics_1SetSmoothingMode
+#ifndef JNI64
+	{(char *)"Graphics_SetSmoothingMode", (char *)"(II)I", (void *)Gdip_NATIVE(Graphics_1SetSmoothingMode)},
+#else
+	{(char *)"Graphics_SetSmoothingMode", (char *)"(JI)I", (void *)Gdip_NATIVE(Graphics_1SetSmoothingMode)},
+#endif
+#endif
+#ifndef NO_Graphics_1SetTextRenderingHint
+#ifndef JNI64
+	{(char *)"Graphics_SetTextRenderingHint", (char *)"(II)I", (void *)Gdip_NATIVE(Graphics_1SetTextRenderingHint)},
+#else
+	{(char *)"Graphics_SetTextRenderingHint", (char *)"(JI)I", (void *)Gdip_NATIVE(Graphics_1SetTextRenderingHint)},
+#endif
+#endif
+#ifndef NO_Graphics_1SetTransform
+#ifndef JNI64
+	{(char *)"Graphics_SetTransform", (char *)"(II)I", (void *)Gdip_NATIVE(Graphics_1SetTransform)},
+#else
+	{(char *)"Graphics_SetTransform", (char *)"(JJ)I", (void *)Gdip_NATIVE(Graphics_1SetTransform)},
+#endif
+#endif
+#ifndef NO_Graphics_1TranslateTransform
+#ifndef JNI64
+	{(char *)"Graphics_TranslateTransform", (char *)"(IFFI)I", (void *)Gdip_NATIVE(Graphics_1TranslateTransform)},
+#else
+	{(char *)"Graphics_TranslateTransform", (char *)"(JFFI)I", (void *)Gdip_NATIVE(Graphics_1TranslateTransform)},
+#endif
+#endif
+#ifndef NO_Graphics_1delete
+#ifndef JNI64
+	{(char *)"Graphics_delete", (char *)"(I)V", (void *)Gdip_NATIVE(Graphics_1delete)},
+#else
+	{(char *)"Graphics_delete", (char *)"(J)V", (void *)Gdip_NATIVE(Graphics_1delete)},
+#endif
+#endif
+#ifndef NO_Graphics_1new
+#ifndef JNI64
+	{(char *)"Graphics_new", (char *)"(I)I", (void *)Gdip_NATIVE(Graphics_1new)},
+#else
+	{(char *)"Graphics_new", (char *)"(J)J", (void *)Gdip_NATIVE(Graphics_1new)},
+#endif
+#endif
+#ifndef NO_HatchBrush_1delete
+#ifndef JNI64
+	{(char *)"HatchBrush_delete", (char *)"(I)V", (void *)Gdip_NATIVE(HatchBrush_1delete)},
+#else
+	{(char *)"HatchBrush_delete", (char *)"(J)V", (void *)Gdip_NATIVE(HatchBrush_1delete)},
+#endif
+#endif
+#ifndef NO_HatchBrush_1new
+#ifndef JNI64
+	{(char *)"HatchBrush_new", (char *)"(III)I", (void *)Gdip_NATIVE(HatchBrush_1new)},
+#else
+	{(char *)"HatchBrush_new", (char *)"(IJJ)J", (void *)Gdip_NATIVE(HatchBrush_1new)},
+#endif
+#endif
+#ifndef NO_ImageAttributes_1SetColorMatrix
+#ifndef JNI64
+	{(char *)"ImageAttributes_SetColorMatrix", (char *)"(I[FII)I", (void *)Gdip_NATIVE(ImageAttributes_1SetColorMatrix)},
+#else
+	{(char *)"ImageAttributes_SetColorMatrix", (char *)"(J[FII)I", (void *)Gdip_NATIVE(ImageAttributes_1SetColorMatrix)},
+#endif
+#endif
+#ifndef NO_ImageAttributes_1SetWrapMode
+#ifndef JNI64
+	{(char *)"ImageAttributes_SetWrapMode", (char *)"(II)I", (void *)Gdip_NATIVE(ImageAttributes_1SetWrapMode)},
+#else
+	{(char *)"ImageAttributes_SetWrapMode", (char *)"(JI)I", (void *)Gdip_NATIVE(ImageAttributes_1SetWrapMode)},
+#endif
+#endif
+#ifndef NO_ImageAttributes_1delete
+#ifndef JNI64
+	{(char *)"ImageAttributes_delete", (char *)"(I)V", (void *)Gdip_NATIVE(ImageAttributes_1delete)},
+#else
+	{(char *)"ImageAttributes_delete", (char *)"(J)V", (void *)Gdip_NATIVE(ImageAttributes_1delete)},
+#endif
+#endif
+#ifndef NO_ImageAttributes_1new
+#ifndef JNI64
+	{(char *)"ImageAttributes_new", (char *)"()I", (void *)Gdip_NATIVE(ImageAttributes_1new)},
+#else
+	{(char *)"ImageAttributes_new", (char *)"()J", (void *)Gdip_NATIVE(ImageAttributes_1new)},
+#endif
+#endif
+#ifndef NO_Image_1GetHeight
+#ifndef JNI64
+	{(char *)"Image_GetHeight", (char *)"(I)I", (void *)Gdip_NATIVE(Image_1GetHeight)},
+#else
+	{(char *)"Image_GetHeight", (char *)"(J)I", (void *)Gdip_NATIVE(Image_1GetHeight)},
+#endif
+#endif
+#ifndef NO_Image_1GetLastStatus
+#ifndef JNI64
+	{(char *)"Image_GetLastStatus", (char *)"(I)I", (void *)Gdip_NATIVE(Image_1GetLastStatus)},
+#else
+	{(char *)"Image_GetLastStatus", (char *)"(J)I", (void *)Gdip_NATIVE(Image_1GetLastStatus)},
+#endif
+#endif
+#ifndef NO_Image_1GetPalette
+#ifndef JNI64
+	{(char *)"Image_GetPalette", (char *)"(III)I", (void *)Gdip_NATIVE(Image_1GetPalette)},
+#else
+	{(char *)"Image_GetPalette", (char *)"(JJI)I", (void *)Gdip_NATIVE(Image_1GetPalette)},
+#endif
+#endif
+#ifndef NO_Image_1GetPaletteSize
+#ifndef JNI64
+	{(char *)"Image_GetPaletteSize", (char *)"(I)I", (void *)Gdip_NATIVE(Image_1GetPaletteSize)},
+#else
+	{(char *)"Image_GetPaletteSize", (char *)"(J)I", (void *)Gdip_NATIVE(Image_1GetPaletteSize)},
+#endif
+#endif
+#ifndef NO_Image_1GetPixelFormat
+#ifndef JNI64
+	{(char *)"Image_GetPixelFormat", (char *)"(I)I", (void *)Gdip_NATIVE(Image_1GetPixelFormat)},
+#else
+	{(char *)"Image_GetPixelFormat", (char *)"(J)I", (void *)Gdip_NATIVE(Image_1GetPixelFormat)},
+#endif
+#endif
+#ifndef NO_Image_1GetWidth
+#ifndef JNI64
+	{(char *)"Image_GetWidth", (char *)"(I)I", (void *)Gdip_NATIVE(Image_1GetWidth)},
+#else
+	{(char *)"Image_GetWidth", (char *)"(J)I", (void *)Gdip_NATIVE(Image_1GetWidth)},
+#endif
+#endif
+#ifndef NO_LinearGradientBrush_1ResetTransform
+#ifndef JNI64
+	{(char *)"LinearGradientBrush_ResetTransform", (char *)"(I)I", (void *)Gdip_NATIVE(LinearGradientBrush_1ResetTransform)},
+#else
+	{(char *)"LinearGradientBrush_ResetTransform", (char *)"(J)I", (void *)Gdip_NATIVE(LinearGradientBrush_1ResetTransform)},
+#endif
+#endif
+#ifndef NO_LinearGradientBrush_1ScaleTransform
+#ifndef JNI64
+	{(char *)"LinearGradientBrush_ScaleTransform", (char *)"(IFFI)I", (void *)Gdip_NATIVE(LinearGradientBrush_1ScaleTransform)},
+#else
+	{(char *)"LinearGradientBrush_ScaleTransform", (char *)"(JFFI)I", (void *)Gdip_NATIVE(LinearGradientBrush_1ScaleTransform)},
+#endif
+#endif
+#ifndef NO_LinearGradientBrush_1SetWrapMode
+#ifndef JNI64
+	{(char *)"LinearGradientBrush_SetWrapMode", (char *)"(II)I", (void *)Gdip_NATIVE(LinearGradientBrush_1SetWrapMode)},
+#else
+	{(char *)"LinearGradientBrush_SetWrapMode", (char *)"(JI)I", (void *)Gdip_NATIVE(LinearGradientBrush_1SetWrapMode)},
+#endif
+#endif
+#ifndef NO_LinearGradientBrush_1TranslateTransform
+#ifndef JNI64
+	{(char *)"LinearGradientBrush_TranslateTransform", (char *)"(IFFI)I", (void *)Gdip_NATIVE(LinearGradientBrush_1TranslateTransform)},
+#else
+	{(char *)"LinearGradientBrush_TranslateTransform", (char *)"(JFFI)I", (void *)Gdip_NATIVE(LinearGradientBrush_1TranslateTransform)},
+#endif
+#endif
+#ifndef NO_LinearGradientBrush_1delete
+#ifndef JNI64
+	{(char *)"LinearGradientBrush_delete", (char *)"(I)V", (void *)Gdip_NATIVE(LinearGradientBrush_1delete)},
+#else
+	{(char *)"LinearGradientBrush_delete", (char *)"(J)V", (void *)Gdip_NATIVE(LinearGradientBrush_1delete)},
+#endif
+#endif
+#ifndef NO_LinearGradientBrush_1new
+#ifndef JNI64
+	{(char *)"LinearGradientBrush_new", (char *)"(Lorg/eclipse/swt/internal/gdip/PointF;Lorg/eclipse/swt/internal/gdip/PointF;II)I", (void *)Gdip_NATIVE(LinearGradientBrush_1new)},
+#else
+	{(char *)"LinearGradientBrush_new", (char *)"(Lorg/eclipse/swt/internal/gdip/PointF;Lorg/eclipse/swt/internal/gdip/PointF;JJ)J", (void *)Gdip_NATIVE(LinearGradientBrush_1new)},
+#endif
+#endif
+#ifndef NO_Matrix_1GetElements
+#ifndef JNI64
+	{(char *)"Matrix_GetElements", (char *)"(I[F)I", (void *)Gdip_NATIVE(Matrix_1GetElements)},
+#else
+	{(char *)"Matrix_GetElements", (char *)"(J[F)I", (void *)Gdip_NATIVE(Matrix_1GetElements)},
+#endif
+#endif
+#ifndef NO_Matrix_1Invert
+#ifndef JNI64
+	{(char *)"Matrix_Invert", (char *)"(I)I", (void *)Gdip_NATIVE(Matrix_1Invert)},
+#else
+	{(char *)"Matrix_Invert", (char *)"(J)I", (void *)Gdip_NATIVE(Matrix_1Invert)},
+#endif
+#endif
+#ifndef NO_Matrix_1IsIdentity
+#ifndef JNI64
+	{(char *)"Matrix_IsIdentity", (char *)"(I)Z", (void *)Gdip_NATIVE(Matrix_1IsIdentity)},
+#else
+	{(char *)"Matrix_IsIdentity", (char *)"(J)Z", (void *)Gdip_NATIVE(Matrix_1IsIdentity)},
+#endif
+#endif
+#ifndef NO_Matrix_1Multiply
+#ifndef JNI64
+	{(char *)"Matrix_Multiply", (char *)"(III)I", (void *)Gdip_NATIVE(Matrix_1Multiply)},
+#else
+	{(char *)"Matrix_Multiply", (char *)"(JJI)I", (void *)Gdip_NATIVE(Matrix_1Multiply)},
+#endif
+#endif
+#ifndef NO_Matrix_1Rotate
+#ifndef JNI64
+	{(char *)"Matrix_Rotate", (char *)"(IFI)I", (void *)Gdip_NATIVE(Matrix_1Rotate)},
+#else
+	{(char *)"Matrix_Rotate", (char *)"(JFI)I", (void *)Gdip_NATIVE(Matrix_1Rotate)},
+#endif
+#endif
+#ifndef NO_Matrix_1Scale
+#ifndef JNI64
+	{(char *)"Matrix_Scale", (char *)"(IFFI)I", (void *)Gdip_NATIVE(Matrix_1Scale)},
+#else
+	{(char *)"Matrix_Scale", (char *)"(JFFI)I", (void *)Gdip_NATIVE(Matrix_1Scale)},
+#endif
+#endif
+#ifndef NO_Matrix_1SetElements
+#ifndef JNI64
+	{(char *)"Matrix_SetElements", (char *)"(IFFFFFF)I", (void *)Gdip_NATIVE(Matrix_1SetElements)},
+#else
+	{(char *)"Matrix_SetElements", (char *)"(JFFFFFF)I", (void *)Gdip_NATIVE(Matrix_1SetElements)},
+#endif
+#endif
+#ifndef NO_Matrix_1Shear
+#ifndef JNI64
+	{(char *)"Matrix_Shear", (char *)"(IFFI)I", (void *)Gdip_NATIVE(Matrix_1Shear)},
+#else
+	{(char *)"Matrix_Shear", (char *)"(JFFI)I", (void *)Gdip_NATIVE(Matrix_1Shear)},
+#endif
+#endif
+#if (!defined(NO_Matrix_1TransformPoints__ILorg_eclipse_swt_internal_gdip_PointF_2I) && !defined(JNI64)) || (!defined(NO_Matrix_1TransformPoints__JLorg_eclipse_swt_internal_gdip_PointF_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Matrix_TransformPoints", (char *)"(ILorg/eclipse/swt/internal/gdip/PointF;I)I", (void *)Gdip_NATIVE(Matrix_1TransformPoints__ILorg_eclipse_swt_internal_gdip_PointF_2I)},
+#else
+	{(char *)"Matrix_TransformPoints", (char *)"(JLorg/eclipse/swt/internal/gdip/PointF;I)I", (void *)Gdip_NATIVE(Matrix_1TransformPoints__JLorg_eclipse_swt_internal_gdip_PointF_2I)},
+#endif
+#endif
+#ifndef NO_Matrix_1TransformVectors
+#ifndef JNI64
+	{(char *)"Matrix_TransformVectors", (char *)"(ILorg/eclipse/swt/internal/gdip/PointF;I)I", (void *)Gdip_NATIVE(Matrix_1TransformVectors)},
+#else
+	{(char *)"Matrix_TransformVectors", (char *)"(JLorg/eclipse/swt/internal/gdip/PointF;I)I", (void *)Gdip_NATIVE(Matrix_1TransformVectors)},
+#endif
+#endif
+#ifndef NO_Matrix_1Translate
+#ifndef JNI64
+	{(char *)"Matrix_Translate", (char *)"(IFFI)I", (void *)Gdip_NATIVE(Matrix_1Translate)},
+#else
+	{(char *)"Matrix_Translate", (char *)"(JFFI)I", (void *)Gdip_NATIVE(Matrix_1Translate)},
+#endif
+#endif
+#ifndef NO_Matrix_1delete
+#ifndef JNI64
+	{(char *)"Matrix_delete", (char *)"(I)V", (void *)Gdip_NATIVE(Matrix_1delete)},
+#else
+	{(char *)"Matrix_delete", (char *)"(J)V", (void *)Gdip_NATIVE(Matrix_1delete)},
+#endif
+#endif
+#ifndef NO_Matrix_1new
+#ifndef JNI64
+	{(char *)"Matrix_new", (char *)"(FFFFFF)I", (void *)Gdip_NATIVE(Matrix_1new)},
+#else
+	{(char *)"Matrix_new", (char *)"(FFFFFF)J", (void *)Gdip_NATIVE(Matrix_1new)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_gdip_BitmapData_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_gdip_BitmapData_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/gdip/BitmapData;I)V", (void *)Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_BitmapData_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/gdip/BitmapData;J)V", (void *)Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_BitmapData_2J)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/gdip/ColorPalette;II)V", (void *)Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/gdip/ColorPalette;JI)V", (void *)Gdip_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2JI)},
+#endif
+#endif
+#ifndef NO_PathGradientBrush_1SetCenterColor
+#ifndef JNI64
+	{(char *)"PathGradientBrush_SetCenterColor", (char *)"(II)I", (void *)Gdip_NATIVE(PathGradientBrush_1SetCenterColor)},
+#else
+	{(char *)"PathGradientBrush_SetCenterColor", (char *)"(JJ)I", (void *)Gdip_NATIVE(PathGradientBrush_1SetCenterColor)},
+#endif
+#endif
+#ifndef NO_PathGradientBrush_1SetCenterPoint
+#ifndef JNI64
+	{(char *)"PathGradientBrush_SetCenterPoint", (char *)"(ILorg/eclipse/swt/internal/gdip/PointF;)I", (void *)Gdip_NATIVE(PathGradientBrush_1SetCenterPoint)},
+#else
+	{(char *)"PathGradientBrush_SetCenterPoint", (char *)"(JLorg/eclipse/swt/internal/gdip/PointF;)I", (void *)Gdip_NATIVE(PathGradientBrush_1SetCenterPoint)},
+#endif
+#endif
+#ifndef NO_PathGradientBrush_1SetGraphicsPath
+#ifndef JNI64
+	{(char *)"PathGradientBrush_SetGraphicsPath", (char *)"(II)I", (void *)Gdip_NATIVE(PathGradientBrush_1SetGraphicsPath)},
+#else
+	{(char *)"PathGradientBrush_SetGraphicsPath", (char *)"(JJ)I", (void *)Gdip_NATIVE(PathGradientBrush_1SetGraphicsPath)},
+#endif
+#endif
+#ifndef NO_PathGradientBrush_1SetWrapMode
+#ifndef JNI64
+	{(char *)"PathGradientBrush_SetWrapMode", (char *)"(II)I", (void *)Gdip_NATIVE(PathGradientBrush_1SetWrapMode)},
+#else
+	{(char *)"PathGradientBrush_SetWrapMode", (char *)"(JI)I", (void *)Gdip_NATIVE(PathGradientBrush_1SetWrapMode)},
+#endif
+#endif
+#ifndef NO_PathGradientBrush_1delete
+#ifndef JNI64
+	{(char *)"PathGradientBrush_delete", (char *)"(I)V", (void *)Gdip_NATIVE(PathGradientBrush_1delete)},
+#else
+	{(char *)"PathGradientBrush_delete", (char *)"(J)V", (void *)Gdip_NATIVE(PathGradientBrush_1delete)},
+#endif
+#endif
+#ifndef NO_PathGradientBrush_1new
+#ifndef JNI64
+	{(char *)"PathGradientBrush_new", (char *)"(I)I", (void *)Gdip_NATIVE(PathGradientBrush_1new)},
+#else
+	{(char *)"PathGradientBrush_new", (char *)"(J)J", (void *)Gdip_NATIVE(PathGradientBrush_1new)},
+#endif
+#endif
+#ifndef NO_Pen_1GetBrush
+#ifndef JNI64
+	{(char *)"Pen_GetBrush", (char *)"(I)I", (void *)Gdip_NATIVE(Pen_1GetBrush)},
+#else
+	{(char *)"Pen_GetBrush", (char *)"(J)J", (void *)Gdip_NATIVE(Pen_1GetBrush)},
+#endif
+#endif
+#ifndef NO_Pen_1SetBrush
+#ifndef JNI64
+	{(char *)"Pen_SetBrush", (char *)"(II)I", (void *)Gdip_NATIVE(Pen_1SetBrush)},
+#else
+	{(char *)"Pen_SetBrush", (char *)"(JJ)I", (void *)Gdip_NATIVE(Pen_1SetBrush)},
+#endif
+#endif
+#ifndef NO_Pen_1SetDashOffset
+#ifndef JNI64
+	{(char *)"Pen_SetDashOffset", (char *)"(IF)I", (void *)Gdip_NATIVE(Pen_1SetDashOffset)},
+#else
+	{(char *)"Pen_SetDashOffset", (char *)"(JF)I", (void *)Gdip_NATIVE(Pen_1SetDashOffset)},
+#endif
+#endif
+#ifndef NO_Pen_1SetDashPattern
+#ifndef JNI64
+	{(char *)"Pen_SetDashPattern", (char *)"(I[FI)I", (void *)Gdip_NATIVE(Pen_1SetDashPattern)},
+#else
+	{(char *)"Pen_SetDashPattern", (char *)"(J[FI)I", (void *)Gdip_NATIVE(Pen_1SetDashPattern)},
+#endif
+#endif
+#ifndef NO_Pen_1SetDashStyle
+#ifndef JNI64
+	{(char *)"Pen_SetDashStyle", (char *)"(II)I", (void *)Gdip_NATIVE(Pen_1SetDashStyle)},
+#else
+	{(char *)"Pen_SetDashStyle", (char *)"(JI)I", (void *)Gdip_NATIVE(Pen_1SetDashStyle)},
+#endif
+#endif
+#ifndef NO_Pen_1SetLineCap
+#ifndef JNI64
+	{(char *)"Pen_SetLineCap", (char *)"(IIII)I", (void *)Gdip_NATIVE(Pen_1SetLineCap)},
+#else
+	{(char *)"Pen_SetLineCap", (char *)"(JIII)I", (void *)Gdip_NATIVE(Pen_1SetLineCap)},
+#endif
+#endif
+#ifndef NO_Pen_1SetLineJoin
+#ifndef JNI64
+	{(char *)"Pen_SetLineJoin", (char *)"(II)I", (void *)Gdip_NATIVE(Pen_1SetLineJoin)},
+#else
+	{(char *)"Pen_SetLineJoin", (char *)"(JI)I", (void *)Gdip_NATIVE(Pen_1SetLineJoin)},
+#endif
+#endif
+#ifndef NO_Pen_1SetMiterLimit
+#ifndef JNI64
+	{(char *)"Pen_SetMiterLimit", (char *)"(IF)I", (void *)Gdip_NATIVE(Pen_1SetMiterLimit)},
+#else
+	{(char *)"Pen_SetMiterLimit", (char *)"(JF)I", (void *)Gdip_NATIVE(Pen_1SetMiterLimit)},
+#endif
+#endif
+#ifndef NO_Pen_1SetWidth
+#ifndef JNI64
+	{(char *)"Pen_SetWidth", (char *)"(IF)I", (void *)Gdip_NATIVE(Pen_1SetWidth)},
+#else
+	{(char *)"Pen_SetWidth", (char *)"(JF)I", (void *)Gdip_NATIVE(Pen_1SetWidth)},
+#endif
+#endif
+#ifndef NO_Pen_1delete
+#ifndef JNI64
+	{(char *)"Pen_delete", (char *)"(I)V", (void *)Gdip_NATIVE(Pen_1delete)},
+#else
+	{(char *)"Pen_delete", (char *)"(J)V", (void *)Gdip_NATIVE(Pen_1delete)},
+#endif
+#endif
+#ifndef NO_Pen_1new
+#ifndef JNI64
+	{(char *)"Pen_new", (char *)"(IF)I", (void *)Gdip_NATIVE(Pen_1new)},
+#else
+	{(char *)"Pen_new", (char *)"(JF)J", (void *)Gdip_NATIVE(Pen_1new)},
+#endif
+#endif
+#ifndef NO_Point_1delete
+#ifndef JNI64
+	{(char *)"Point_delete", (char *)"(I)V", (void *)Gdip_NATIVE(Point_1delete)},
+#else
+	{(char *)"Point_delete", (char *)"(J)V", (void *)Gdip_NATIVE(Point_1delete)},
+#endif
+#endif
+#ifndef NO_Point_1new
+#ifndef JNI64
+	{(char *)"Point_new", (char *)"(II)I", (void *)Gdip_NATIVE(Point_1new)},
+#else
+	{(char *)"Point_new", (char *)"(II)J", (void *)Gdip_NATIVE(Point_1new)},
+#endif
+#endif
+#ifndef NO_PrivateFontCollection_1AddFontFile
+#ifndef JNI64
+	{(char *)"PrivateFontCollection_AddFontFile", (char *)"(I[C)I", (void *)Gdip_NATIVE(PrivateFontCollection_1AddFontFile)},
+#else
+	{(char *)"PrivateFontCollection_AddFontFile", (char *)"(J[C)I", (void *)Gdip_NATIVE(PrivateFontCollection_1AddFontFile)},
+#endif
+#endif
+#ifndef NO_PrivateFontCollection_1delete
+#ifndef JNI64
+	{(char *)"PrivateFontCollection_delete", (char *)"(I)V", (void *)Gdip_NATIVE(PrivateFontCollection_1delete)},
+#else
+	{(char *)"PrivateFontCollection_delete", (char *)"(J)V", (void *)Gdip_NATIVE(PrivateFontCollection_1delete)},
+#endif
+#endif
+#ifndef NO_PrivateFontCollection_1new
+#ifndef JNI64
+	{(char *)"PrivateFontCollection_new", (char *)"()I", (void *)Gdip_NATIVE(PrivateFontCollection_1new)},
+#else
+	{(char *)"PrivateFontCollection_new", (char *)"()J", (void *)Gdip_NATIVE(PrivateFontCollection_1new)},
+#endif
+#endif
+#ifndef NO_Region_1GetHRGN
+#ifndef JNI64
+	{(char *)"Region_GetHRGN", (char *)"(II)I", (void *)Gdip_NATIVE(Region_1GetHRGN)},
+#else
+	{(char *)"Region_GetHRGN", (char *)"(JJ)J", (void *)Gdip_NATIVE(Region_1GetHRGN)},
+#endif
+#endif
+#ifndef NO_Region_1IsInfinite
+#ifndef JNI64
+	{(char *)"Region_IsInfinite", (char *)"(II)Z", (void *)Gdip_NATIVE(Region_1IsInfinite)},
+#else
+	{(char *)"Region_IsInfinite", (char *)"(JJ)Z", (void *)Gdip_NATIVE(Region_1IsInfinite)},
+#endif
+#endif
+#ifndef NO_Region_1delete
+#ifndef JNI64
+	{(char *)"Region_delete", (char *)"(I)V", (void *)Gdip_NATIVE(Region_1delete)},
+#else
+	{(char *)"Region_delete", (char *)"(J)V", (void *)Gdip_NATIVE(Region_1delete)},
+#endif
+#endif
+#ifndef NO_Region_1new__
+#ifndef JNI64
+	{(char *)"Region_new", (char *)"()I", (void *)Gdip_NATIVE(Region_1new__)},
+#else
+	{(char *)"Region_new", (char *)"()J", (void *)Gdip_NATIVE(Region_1new__)},
+#endif
+#endif
+#if (!defined(NO_Region_1new__I) && !defined(JNI64)) || (!defined(NO_Region_1new__J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Region_new", (char *)"(I)I", (void *)Gdip_NATIVE(Region_1new__I)},
+#else
+	{(char *)"Region_new", (char *)"(J)J", (void *)Gdip_NATIVE(Region_1new__J)},
+#endif
+#endif
+#ifndef NO_Region_1newGraphicsPath
+#ifndef JNI64
+	{(char *)"Region_newGraphicsPath", (char *)"(I)I", (void *)Gdip_NATIVE(Region_1newGraphicsPath)},
+#else
+	{(char *)"Region_newGraphicsPath", (char *)"(J)J", (void *)Gdip_NATIVE(Region_1newGraphicsPath)},
+#endif
+#endif
+#ifndef NO_SolidBrush_1delete
+#ifndef JNI64
+	{(char *)"SolidBrush_delete", (char *)"(I)V", (void *)Gdip_NATIVE(SolidBrush_1delete)},
+#else
+	{(char *)"SolidBrush_delete", (char *)"(J)V", (void *)Gdip_NATIVE(SolidBrush_1delete)},
+#endif
+#endif
+#ifndef NO_SolidBrush_1new
+#ifndef JNI64
+	{(char *)"SolidBrush_new", (char *)"(I)I", (void *)Gdip_NATIVE(SolidBrush_1new)},
+#else
+	{(char *)"SolidBrush_new", (char *)"(J)J", (void *)Gdip_NATIVE(SolidBrush_1new)},
+#endif
+#endif
+#ifndef NO_StringFormat_1Clone
+#ifndef JNI64
+	{(char *)"StringFormat_Clone", (char *)"(I)I", (void *)Gdip_NATIVE(StringFormat_1Clone)},
+#else
+	{(char *)"StringFormat_Clone", (char *)"(J)J", (void *)Gdip_NATIVE(StringFormat_1Clone)},
+#endif
+#endif
+#ifndef NO_StringFormat_1GenericDefault
+#ifndef JNI64
+	{(char *)"StringFormat_GenericDefault", (char *)"()I", (void *)Gdip_NATIVE(StringFormat_1GenericDefault)},
+#else
+	{(char *)"StringFormat_GenericDefault", (char *)"()J", (void *)Gdip_NATIVE(StringFormat_1GenericDefault)},
+#endif
+#endif
+#ifndef NO_StringFormat_1GenericTypographic
+#ifndef JNI64
+	{(char *)"StringFormat_GenericTypographic", (char *)"()I", (void *)Gdip_NATIVE(StringFormat_1GenericTypographic)},
+#else
+	{(char *)"StringFormat_GenericTypographic", (char *)"()J", (void *)Gdip_NATIVE(StringFormat_1GenericTypographic)},
+#endif
+#endif
+#ifndef NO_StringFormat_1GetFormatFlags
+#ifndef JNI64
+	{(char *)"StringFormat_GetFormatFlags", (char *)"(I)I", (void *)Gdip_NATIVE(StringFormat_1GetFormatFlags)},
+#else
+	{(char *)"StringFormat_GetFormatFlags", (char *)"(J)I", (void *)Gdip_NATIVE(StringFormat_1GetFormatFlags)},
+#endif
+#endif
+#ifndef NO_StringFormat_1SetFormatFlags
+#ifndef JNI64
+	{(char *)"StringFormat_SetFormatFlags", (char *)"(II)I", (void *)Gdip_NATIVE(StringFormat_1SetFormatFlags)},
+#else
+	{(char *)"StringFormat_SetFormatFlags", (char *)"(JI)I", (void *)Gdip_NATIVE(StringFormat_1SetFormatFlags)},
+#endif
+#endif
+#ifndef NO_StringFormat_1SetHotkeyPrefix
+#ifndef JNI64
+	{(char *)"StringFormat_SetHotkeyPrefix", (char *)"(II)I", (void *)Gdip_NATIVE(StringFormat_1SetHotkeyPrefix)},
+#else
+	{(char *)"StringFormat_SetHotkeyPrefix", (char *)"(JI)I", (void *)Gdip_NATIVE(StringFormat_1SetHotkeyPrefix)},
+#endif
+#endif
+#ifndef NO_StringFormat_1SetTabStops
+#ifndef JNI64
+	{(char *)"StringFormat_SetTabStops", (char *)"(IFI[F)I", (void *)Gdip_NATIVE(StringFormat_1SetTabStops)},
+#else
+	{(char *)"StringFormat_SetTabStops", (char *)"(JFI[F)I", (void *)Gdip_NATIVE(StringFormat_1SetTabStops)},
+#endif
+#endif
+#ifndef NO_StringFormat_1delete
+#ifndef JNI64
+	{(char *)"StringFormat_delete", (char *)"(I)V", (void *)Gdip_NATIVE(StringFormat_1delete)},
+#else
+	{(char *)"StringFormat_delete", (char *)"(J)V", (void *)Gdip_NATIVE(StringFormat_1delete)},
+#endif
+#endif
+#ifndef NO_TextureBrush_1ResetTransform
+#ifndef JNI64
+	{(char *)"TextureBrush_ResetTransform", (char *)"(I)I", (void *)Gdip_NATIVE(TextureBrush_1ResetTransform)},
+#else
+	{(char *)"TextureBrush_ResetTransform", (char *)"(J)I", (void *)Gdip_NATIVE(TextureBrush_1ResetTransform)},
+#endif
+#endif
+#ifndef NO_TextureBrush_1ScaleTransform
+#ifndef JNI64
+	{(char *)"TextureBrush_ScaleTransform", (char *)"(IFFI)I", (void *)Gdip_NATIVE(TextureBrush_1ScaleTransform)},
+#else
+	{(char *)"TextureBrush_ScaleTransform", (char *)"(JFFI)I", (void *)Gdip_NATIVE(TextureBrush_1ScaleTransform)},
+#endif
+#endif
+#ifndef NO_TextureBrush_1SetTransform
+#ifndef JNI64
+	{(char *)"TextureBrush_SetTransform", (char *)"(II)I", (void *)Gdip_NATIVE(TextureBrush_1SetTransform)},
+#else
+	{(char *)"TextureBrush_SetTransform", (char *)"(JJ)I", (void *)Gdip_NATIVE(TextureBrush_1SetTransform)},
+#endif
+#endif
+#ifndef NO_TextureBrush_1TranslateTransform
+#ifndef JNI64
+	{(char *)"TextureBrush_TranslateTransform", (char *)"(IFFI)I", (void *)Gdip_NATIVE(TextureBrush_1TranslateTransform)},
+#else
+	{(char *)"TextureBrush_TranslateTransform", (char *)"(JFFI)I", (void *)Gdip_NATIVE(TextureBrush_1TranslateTransform)},
+#endif
+#endif
+#ifndef NO_TextureBrush_1delete
+#ifndef JNI64
+	{(char *)"TextureBrush_delete", (char *)"(I)V", (void *)Gdip_NATIVE(TextureBrush_1delete)},
+#else
+	{(char *)"TextureBrush_delete", (char *)"(J)V", (void *)Gdip_NATIVE(TextureBrush_1delete)},
+#endif
+#endif
+#ifndef NO_TextureBrush_1new
+#ifndef JNI64
+	{(char *)"TextureBrush_new", (char *)"(IIFFFF)I", (void *)Gdip_NATIVE(TextureBrush_1new)},
+#else
+	{(char *)"TextureBrush_new", (char *)"(JIFFFF)J", (void *)Gdip_NATIVE(TextureBrush_1new)},
+#endif
+#endif
+	{NULL, NULL, NULL}
+};
+extern "C" JNIEXPORT SWT_NATIVE_CLASS Gdip_nativeClasses[] = {
+	{"org/eclipse/swt/internal/gdip/Gdip", Gdip_nativeMethods},
+	{NULL, NULL}
+};
+#endif
@@ -17,6 +17,13 @@ extern "C" {
 
 #define Gdip_NATIVE(func) Java_org_eclipse_swt_internal_gdip_Gdip_##func
 
+/*
+* Point and PointF have the layout of an x, y pair of jint and jfloat, so
+* the coordinate arrays are passed to GDI+ in place instead of copied.
+*/
+typedef char Point_layout[sizeof(Point) == 2 * sizeof(jint) ? 1 : -1];
+typedef char PointF_layout[sizeof(PointF) == 2 * sizeof(jfloat) ? 1 : -1];
+
 #ifndef NO_Graphics_1DrawLines
 JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawLines)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintArray arg2, jint arg3)
@@ -26,17 +33,9 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawLines)
 	jint rc = 0;
 	Gdip_NATIVE_ENTER(env, that, Graphics_1DrawLines_FUNC);
 	if (arg2) if ((lparg2 = env->GetIntArrayElements(arg2, NULL)) == NULL) goto fail;
-	if (lparg2) {
-		points = new Point[arg3];
-		for (int i=0, j=0; i<arg3; i++, j+=2) {
-			Point *point = new Point(lparg2[j], lparg2[j + 1]);
-			points[i] = *point;
-			delete point;
-		}
-	}
+	points = (Point *)lparg2;
 	rc = (jint)((Graphics *)arg0)->DrawLines((Pen *)arg1, points, (INT)arg3);
 fail:
-	if (lparg2 && points) delete[] points;
 	if (arg2 && lparg2) env->ReleaseIntArrayElements(arg2, lparg2, JNI_ABORT);
 	Gdip_NATIVE_EXIT(env, that, Graphics_1DrawLines_FUNC);
 	return rc;
@@ -52,17 +51,9 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawPolygon)
 	jint rc = 0;
 	Gdip_NATIVE_ENTER(env, that, Graphics_1DrawPolygon_FUNC);
 	if (arg2) if ((lparg2 = env->GetIntArrayElements(arg2, NULL)) == NULL) goto fail;
-	if (lparg2) {
-		points = new Point[arg3];
-		for (int i=0, j=0; i<arg3; i++, j+=2) {
-			Point *point = new Point(lparg2[j], lparg2[j + 1]);
-			points[i] = *point;
-			delete point;
-		}
-	}
+	points = (Point *)lparg2;
 	rc = (jint)((Graphics *)arg0)->DrawPolygon((Pen *)arg1, points, (INT)arg3);
 fail:
-	if (lparg2 && points) delete[] points;
 	if (arg2 && lparg2) env->ReleaseIntArrayElements(arg2, lparg2, JNI_ABORT);
 	Gdip_NATIVE_EXIT(env, that, Graphics_1DrawPolygon_FUNC);
 	return rc;
@@ -78,17 +69,9 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1FillPolygon)
 	jint rc = 0;
 	Gdip_NATIVE_ENTER(env, that, Graphics_1FillPolygon_FUNC);
 	if (arg2) if ((lparg2 = env->GetIntArrayElements(arg2, NULL)) == NULL) goto fail;
-	if (lparg2) {
-		points = new Point[arg3];
-		for (int i=0, j=0; i<arg3; i++, j+=2) {
-			Point *point = new Point(lparg2[j], lparg2[j + 1]);
-			points[i] = *point;
-			delete point;
-		}
-	}
+	points = (Point *)lparg2;
 	rc = (jint)((Graphics *)arg0)->FillPolygon((Brush *)arg1, points, (INT)arg3, (FillMode)arg4);
 fail:
-	if (lparg2 && points) delete[] points;
 	if (arg2 && lparg2) env->ReleaseIntArrayElements(arg2, lparg2, JNI_ABORT);
 	Gdip_NATIVE_EXIT(env, that, Graphics_1FillPolygon_FUNC);
 	return rc;
@@ -104,24 +87,113 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(GraphicsPath_1GetPathPoints)
 	jint rc = 0;
 	Gdip_NATIVE_ENTER(env, that, GraphicsPath_1GetPathPoints_FUNC);
 	if (arg1) if ((lparg1 = env->GetFloatArrayElements(arg1, NULL)) == NULL) goto fail;
-	if (lparg1) {
-		points = new PointF[arg2];
-	}
+	points = (PointF *)lparg1;
 	rc = (jint)((GraphicsPath *)arg0)->GetPathPoints(points, arg2);
 fail:
-	if (lparg1 && points) {
-		for (int i=0, j=0; i<arg2; i++, j+=2) {
-			lparg1[j] = points[i].X;
-			lparg1[j + 1] = points[i].Y;
-		}
-		delete[] points;
-	}
 	if (arg1 && lparg1) env->ReleaseFloatArrayElements(arg1, lparg1, 0);
 	Gdip_NATIVE_EXIT(env, that, GraphicsPath_1GetPathPoints_FUNC);
 	return rc;
 }
 #endif
 
+#if !defined(NO_GraphicsPath_1IsVisiblePaths) || !defined(NO_GraphicsPath_1IsVisiblePoints)
+/*
+* Returns whether the point is in the area of the path, or in its outline
+* drawn with pen when pen is not NULL, the way Path.contains() tests it.
+* When bounds is not NULL, points outside of it are rejected without
+* testing the path.
+*/
+static BOOL isVisible(GraphicsPath *path, REAL x, REAL y, FillMode fillMode, const Pen *pen, const Graphics *g, const RectF *bounds)
+{
+	if (bounds != NULL && !bounds->Contains(x, y)) return FALSE;
+	path->SetFillMode(fillMode);
+	if (pen != NULL) return path->IsOutlineVisible(x, y, pen, g);
+	return path->IsVisible(x, y, g);
+}
+
+/*
+* Returns the bounds of the path, including the outline drawn with pen
+* when pen is not NULL, for rejecting points in isVisible().  Returns NULL
+* when g has a world transform, since the bounds would then be in other
+* coordinates than the points.
+*/
+static RectF *getVisibleBounds(GraphicsPath *path, const Pen *pen, const Graphics *g, RectF *bounds)
+{
+	Matrix matrix;
+	if (g != NULL) {
+		if (g->GetTransform(&matrix) != Ok || !matrix.IsIdentity()) return NULL;
+	}
+	if (path->GetBounds(bounds, NULL, pen) != Ok) return NULL;
+	/* Allow for the pixel that is hit on the edge of the bounds */
+	bounds->Inflate(1, 1);
+	return bounds;
+}
+#endif
+
+#ifndef NO_GraphicsPath_1IsVisiblePaths
+JNIEXPORT jboolean JNICALL Gdip_NATIVE(GraphicsPath_1IsVisiblePaths)
+	(JNIEnv *env, jclass that, jintLongArray arg0, jfloat arg1, jfloat arg2, jint arg3, jintLong arg4, jintLong arg5, jboolean arg6, jintArray arg7)
+{
+	jintLong *lparg0=NULL;
+	jint *lparg7=NULL;
+	jint count, i;
+	jboolean rc = 0;
+	Gdip_NATIVE_ENTER(env, that, GraphicsPath_1IsVisiblePaths_FUNC);
+	if (arg0 == NULL || arg7 == NULL) goto fail;
+	count = env->GetArrayLength(arg0);
+	if (env->GetArrayLength(arg7) < (count + 31) / 32) goto fail;
+	if ((lparg0 = env->GetIntLongArrayElements(arg0, NULL)) == NULL) goto fail;
+	if ((lparg7 = env->GetIntArrayElements(arg7, NULL)) == NULL) goto fail;
+	memset(lparg7, 0, ((count + 31) / 32) * sizeof(jint));
+	for (i = 0; i < count; i++) {
+		GraphicsPath *path = (GraphicsPath *)lparg0[i];
+		RectF rect, *bounds = NULL;
+		if (path == NULL) continue;
+		if (arg6) bounds = getVisibleBounds(path, (const Pen *)arg4, (const Graphics *)arg5, &rect);
+		if (isVisible(path, arg1, arg2, (FillMode)arg3, (const Pen *)arg4, (const Graphics *)arg5, bounds)) {
+			lparg7[i >> 5] |= 1 << (i & 31);
+		}
+	}
+	rc = 1;
+fail:
+	if (arg7 && lparg7) env->ReleaseIntArrayElements(arg7, lparg7, 0);
+	if (arg0 && lparg0) env->ReleaseIntLongArrayElements(arg0, lparg0, JNI_ABORT);
+	Gdip_NATIVE_EXIT(env, that, GraphicsPath_1IsVisiblePaths_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_GraphicsPath_1IsVisiblePoints
+JNIEXPORT jboolean JNICALL Gdip_NATIVE(GraphicsPath_1IsVisiblePoints)
+	(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1, jint arg2, jintLong arg3, jintLong arg4, jboolean arg5, jintArray arg6)
+{
+	jfloat *lparg1=NULL;
+	jint *lparg6=NULL;
+	jint count, i;
+	jboolean rc = 0;
+	RectF rect, *bounds = NULL;
+	Gdip_NATIVE_ENTER(env, that, GraphicsPath_1IsVisiblePoints_FUNC);
+	if (arg0 == 0 || arg1 == NULL || arg6 == NULL) goto fail;
+	count = env->GetArrayLength(arg1) / 2;
+	if (env->GetArrayLength(arg6) < (count + 31) / 32) goto fail;
+	if ((lparg1 = env->GetFloatArrayElements(arg1, NULL)) == NULL) goto fail;
+	if ((lparg6 = env->GetIntArrayElements(arg6, NULL)) == NULL) goto fail;
+	memset(lparg6, 0, ((count + 31) / 32) * sizeof(jint));
+	if (arg5) bounds = getVisibleBounds((GraphicsPath *)arg0, (const Pen *)arg3, (const Graphics *)arg4, &rect);
+	for (i = 0; i < count; i++) {
+		if (isVisible((GraphicsPath *)arg0, lparg1[i * 2], lparg1[i * 2 + 1], (FillMode)arg2, (const Pen *)arg3, (const Graphics *)arg4, bounds)) {
+			lparg6[i >> 5] |= 1 << (i & 31);
+		}
+	}
+	rc = 1;
+fail:
+	if (arg6 && lparg6) env->ReleaseIntArrayElements(arg6, lparg6, 0);
+	if (arg1 && lparg1) env->ReleaseFloatArrayElements(arg1, lparg1, JNI_ABORT);
+	Gdip_NATIVE_EXIT(env, that, GraphicsPath_1IsVisiblePoints_FUNC);
+	return rc;
+}
+#endif
+
 
 #if (!defined(NO_Matrix_1TransformPoints__I_3FI) && !defined(JNI64)) || (!defined(NO_Matrix_1TransformPoints__J_3FI) && defined(JNI64))
 #ifdef JNI64
@@ -140,23 +212,9 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Matrix_1TransformPoints__I_3FI)
 	Gdip_NATIVE_ENTER(env, that, Matrix_1TransformPoints__I_3FI_FUNC);
 #endif
 	if (arg1) if ((lparg1 = env->GetFloatArrayElements(arg1, NULL)) == NULL) goto fail;
-	if (lparg1) {
-		points = new PointF[arg2];
-		for (int i=0, j=0; i<arg2; i++, j+=2) {
-			PointF *point = new PointF(lparg1[j], lparg1[j + 1]);
-			points[i] = *point;
-			delete point;
-		}
-	}
+	points = (PointF *)lparg1;
 	rc = (jint)((Matrix *)arg0)->TransformPoints(points, arg2);
 fail:
-	if (lparg1 && points) {
-		for (int i=0, j=0; i<arg2; i++, j+=2) {
-			lparg1[j] = points[i].X;
-			lparg1[j + 1] = points[i].Y;
-		}
-		delete[] points;
-	}
 	if (arg1 && lparg1) env->ReleaseFloatArrayElements(arg1, lparg1, 0);
 	Gdip_NATIVE_EXIT(env, that, Matrix_1TransformPoints__I_3FI_FUNC);
 	return rc;
@@ -168,6 +226,7 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1SetInterpolationColors)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLongArray arg1, jfloatArray arg2, jint arg3)
 {
 	Color *colors=NULL;
+	size_t mark=swtArenaMark();
 	jintLong *lparg1=NULL;
 	jfloat *lparg2=NULL;
 	jint rc = 0;
@@ -175,18 +234,17 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(LinearGradientBrush_1SetInterpolationColors)
 	if (arg1) if ((lparg1 = env->GetIntLongArrayElements(arg1, NULL)) == NULL) goto fail;
 	if (arg2) if ((lparg2 = env->GetFloatArrayElements(arg2, NULL)) == NULL) goto fail;
 	if (lparg1) {
-		colors = new Color[arg3];
+		colors = (Color *)swtArenaAlloc(arg3 * sizeof(Color));
+		if (colors == NULL) goto fail;
 		for (int i=0; i<arg3; i++) {
 			colors[i] = *(Color *)lparg1[i];
 		}
 	}
 	rc = (jint)((LinearGradientBrush *)arg0)->SetInterpolationColors(colors, (const REAL *)lparg2, arg3);
 fail:
-	if (lparg1 && colors) {
-		delete[] colors;
-	}
-	if (arg2 && lparg2) env->ReleaseFloatArrayElements(arg2, lparg2, 0);
-	if (arg1 && lparg1) env->ReleaseIntLongArrayElements(arg1, lparg1, 0);
+	swtArenaRelease(mark);
+	if (arg2 && lparg2) env->ReleaseFloatArrayElements(arg2, lparg2, JNI_ABORT);
+	if (arg1 && lparg1) env->ReleaseIntLongArrayElements(arg1, lparg1, JNI_ABORT);
 	Gdip_NATIVE_EXIT(env, that, LinearGradientBrush_1SetInterpolationColors_FUNC);
 	return rc;
 }
@@ -197,6 +255,7 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetInterpolationColors)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLongArray arg1, jfloatArray arg2, jint arg3)
 {
 	Color *colors=NULL;
+	size_t mark=swtArenaMark();
 	jintLong *lparg1=NULL;
 	jfloat *lparg2=NULL;
 	jint rc = 0;
@@ -204,18 +263,17 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetInterpolationColors)
 	if (arg1) if ((lparg1 = env->GetIntLongArrayElements(arg1, NULL)) == NULL) goto fail;
 	if (arg2) if ((lparg2 = env->GetFloatArrayElements(arg2, NULL)) == NULL) goto fail;
 	if (lparg1) {
-		colors = new Color[arg3];
+		colors = (Color *)swtArenaAlloc(arg3 * sizeof(Color));
+		if (colors == NULL) goto fail;
 		for (int i=0; i<arg3; i++) {
 			colors[i] = *(Color *)lparg1[i];
 		}
 	}
 	rc = (jint)((PathGradientBrush *)arg0)->SetInterpolationColors(colors, (const REAL *)lparg2, arg3);
 fail:
-	if (lparg1 && colors) {
-		delete[] colors;
-	}
-	if (arg2 && lparg2) env->ReleaseFloatArrayElements(arg2, lparg2, 0);
-	if (arg1 && lparg1) env->ReleaseIntLongArrayElements(arg1, lparg1, 0);
+	swtArenaRelease(mark);
+	if (arg2 && lparg2) env->ReleaseFloatArrayElements(arg2, lparg2, JNI_ABORT);
+	if (arg1 && lparg1) env->ReleaseIntLongArrayElements(arg1, lparg1, JNI_ABORT);
 	Gdip_NATIVE_EXIT(env, that, PathGradientBrush_1SetInterpolationColors_FUNC);
 	return rc;
 }
@@ -226,6 +284,7 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetSurroundColors)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLongArray arg1, jintArray arg2)
 {
 	Color *colors=NULL;
+	size_t mark=swtArenaMark();
 	jintLong *lparg1=NULL;
 	jint *lparg2=NULL;
 	jint rc = 0;
@@ -233,16 +292,15 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(PathGradientBrush_1SetSurroundColors)
 	if (arg1) if ((lparg1 = env->GetIntLongArrayElements(arg1, NULL)) == NULL) goto fail;
 	if (arg2) if ((lparg2 = env->GetIntArrayElements(arg2, NULL)) == NULL) goto fail;
 	if (lparg1 && lparg2) {
-		colors = new Color[lparg2[0]];
+		colors = (Color *)swtArenaAlloc(lparg2[0] * sizeof(Color));
+		if (colors == NULL) goto fail;
 		for (int i=0; i<lparg2[0]; i++) {
 			colors[i] = *(Color *)lparg1[i];
 		}
 	}
 	rc = (jint)((PathGradientBrush *)arg0)->SetSurroundColors((Color *)colors, (INT *)lparg2);
 fail:
-	if (lparg1 && lparg2 && colors) {
-		delete[] colors;
-	}	
+	swtArenaRelease(mark);
 	if (arg2 && lparg2) env->ReleaseIntArrayElements(arg2, lparg2, 0);
 	if (arg1 && lparg1) env->ReleaseIntLongArrayElements(arg1, lparg1, 0);
 	Gdip_NATIVE_EXIT(env, that, PathGradientBrush_1SetSurroundColors_FUNC);
@@ -260,19 +318,11 @@ JNIEXPORT jintLong JNICALL Gdip_NATIVE(GraphicsPath_1new___3I_3BII)
 	jintLong rc = 0;
 	Gdip_NATIVE_ENTER(env, that, GraphicsPath_1new___3I_3BII_FUNC);
 	if (arg0) if ((lparg0 = env->GetIntArrayElements(arg0, NULL)) == NULL) goto fail;
-	if (lparg0) {
-		points = new Point[arg2];
-		for (int i=0, j=0; i<arg2; i++, j+=2) {
-			Point *point = new Point(lparg0[j], lparg0[j + 1]);
-			points[i] = *point;
-			delete point;
-		}
-	}
+	points = (Point *)lparg0;
 	if (arg1) if ((lparg1 = env->GetByteArrayElements(arg1, NULL)) == NULL) goto fail;
 	rc = (jintLong)new GraphicsPath(points, (BYTE *)lparg1, arg2, (FillMode)arg3);
 fail:
 	if (arg1 && lparg1) env->ReleaseByteArrayElements(arg1, lparg1, 0);
-	if (lparg0 && points) delete[] points;
 	if (arg0 && lparg0) env->ReleaseIntArrayElements(arg0, lparg0, 0);
 	Gdip_NATIVE_EXIT(env, that, GraphicsPath_1new___3I_3BII_FUNC);
 	return rc;
@@ -298,18 +348,10 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1DrawDriverString__IIIII_3FII)(JNIEn
 	Gdip_NATIVE_ENTER(env, that, Graphics_1DrawDriverString__IIIII_3FII_FUNC);
 #endif
 	if (arg5) if ((lparg5 = env->GetFloatArrayElements(arg5, NULL)) == NULL) goto fail;
-	if (lparg5) {
-		points = new PointF[arg2];
-		for (int i=0, j=0; i<arg2; i++, j+=2) {
-			PointF *point = new PointF(lparg5[j], lparg5[j + 1]);
-			points[i] = *point;
-			delete point;
-		}
-	}
+	points = (PointF *)lparg5;
 	rc = (jint)((Graphics *)arg0)->DrawDriverString((const UINT16 *)arg1, arg2, (const Font *)arg3, (const Brush *)arg4, points, arg6, (const Matrix *)arg7);
 fail:
-	if (arg5 && lparg5) env->ReleaseFloatArrayElements(arg5, lparg5, 0);
-	if (lparg5 && points) delete[] points;
+	if (arg5 && lparg5) env->ReleaseFloatArrayElements(arg5, lparg5, JNI_ABORT);
 #ifdef JNI64
 	Gdip_NATIVE_EXIT(env, that, Graphics_1DrawDriverString__JJIJJ_3FIJ_FUNC);
 #else
@@ -330,23 +372,285 @@ JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1MeasureDriverString)
 	jint rc = 0;
 	Gdip_NATIVE_ENTER(env, that, Graphics_1MeasureDriverString_FUNC);
 	if (arg4) if ((lparg4 = env->GetFloatArrayElements(arg4, NULL)) == NULL) goto fail;
-	if (lparg4) {
-		points = new PointF[arg2];
-		for (int i=0, j=0; i<arg2; i++, j+=2) {
-			PointF *point = new PointF(lparg4[j], lparg4[j + 1]);
-			points[i] = *point;
-			delete point;
-		}
-	}
+	points = (PointF *)lparg4;
 	if (arg7) if ((lparg7 = getRectFFields(env, arg7, &_arg7)) == NULL) goto fail;
 	rc = (jint)((Graphics *)arg0)->MeasureDriverString((const UINT16 *)arg1, arg2, (const Font *)arg3, points, arg5, (const Matrix *)arg6, lparg7);
 fail:
 	if (arg7 && lparg7) setRectFFields(env, arg7, lparg7);
-	if (arg4 && lparg4) env->ReleaseFloatArrayElements(arg4, lparg4, 0);
-	if (lparg4 && points) delete[] points;
+	if (arg4 && lparg4) env->ReleaseFloatArrayElements(arg4, lparg4, JNI_ABORT);
 	Gdip_NATIVE_EXIT(env, that, Graphics_1MeasureDriverString_FUNC);
 	return rc;
 }
 #endif
 
+#ifndef NO_Graphics_1Replay
+JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1Replay)
+	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+{
+	Graphics *graphics = (Graphics *)arg0;
+	jlong *commands=NULL, *end=NULL;
+	jint rc = 0;
+	Gdip_NATIVE_ENTER(env, that, Graphics_1Replay_FUNC);
+	if (arg1 == NULL || arg2 < 0 || arg2 > env->GetDirectBufferCapacity(arg1)) {
+		rc = (jint)InvalidParameter;
+		goto fail;
+	}
+	if ((commands = (jlong *)env->GetDirectBufferAddress(arg1)) == NULL) goto fail;
+	end = commands + arg2 / sizeof(jlong);
+	/*
+	* Each command is its opcode followed by its arguments, one jlong each.
+	* Replay stops at the first command that fails or does not fit.
+	*/
+	while (rc == Ok && commands < end) {
+		jlong *args = commands + 1;
+		if (args + 5 > end) {
+			rc = (jint)InvalidParameter;
+			break;
+		}
+		switch ((jint)commands[0]) {
+			case 1: /* ReplayDrawEllipse */
+				rc = (jint)graphics->DrawEllipse((Pen *)(jintLong)args[0], (INT)args[1], (INT)args[2], (INT)args[3], (INT)args[4]);
+				commands = args + 5;
+				break;
+			case 2: /* ReplayDrawLine */
+				rc = (jint)graphics->DrawLine((Pen *)(jintLong)args[0], (INT)args[1], (INT)args[2], (INT)args[3], (INT)args[4]);
+				commands = args + 5;
+				break;
+			case 3: /* ReplayDrawRectangle */
+				rc = (jint)graphics->DrawRectangle((Pen *)(jintLong)args[0], (INT)args[1], (INT)args[2], (INT)args[3], (INT)args[4]);
+				commands = args + 5;
+				break;
+			case 4: { /* ReplayDrawString */
+				if (args + 6 > end) {
+					rc = (jint)InvalidParameter;
+					break;
+				}
+				jint length = (jint)args[5];
+				jlong *next = args + 6 + (length * sizeof(WCHAR) + sizeof(jlong) - 1) / sizeof(jlong);
+				if (length < 0 || next > end) {
+					rc = (jint)InvalidParameter;
+					break;
+				}
+				union { jint bits; jfloat value; } x, y;
+				x.bits = (jint)args[3];
+				y.bits = (jint)args[4];
+				PointF origin(x.value, y.value);
+				rc = (jint)graphics->DrawString((WCHAR *)(args + 6), length, (Font *)(jintLong)args[0], origin, (StringFormat *)(jintLong)args[1], (Brush *)(jintLong)args[2]);
+				commands = next;
+				break;
+			}
+			case 5: /* ReplayFillEllipse */
+				rc = (jint)graphics->FillEllipse((Brush *)(jintLong)args[0], (INT)args[1], (INT)args[2], (INT)args[3], (INT)args[4]);
+				commands = args + 5;
+				break;
+			case 6: /* ReplayFillRectangle */
+				rc = (jint)graphics->FillRectangle((Brush *)(jintLong)args[0], (INT)args[1], (INT)args[2], (INT)args[3], (INT)args[4]);
+				commands = args + 5;
+				break;
+			default:
+				rc = (jint)InvalidParameter;
+				break;
+		}
+	}
+fail:
+	Gdip_NATIVE_EXIT(env, that, Graphics_1Replay_FUNC);
+	return rc;
+}
+#endif
+
+/*
+* Solid brushes are shared through a small cache keyed by their color
+* and the creating thread, so that GC state changes do not allocate a
+* new GDI+ object each time.  An entry is reference counted while in
+* use and reclaimed in least recently used order once released.
+* Callers must not modify a cached object.
+*/
+#define OBJECT_CACHE_SIZE 64
+
+typedef struct ObjectCacheEntry {
+	jint argb;
+	DWORD thread;
+	SolidBrush *object;
+	jint refCount;
+	unsigned int lastUse;
+} ObjectCacheEntry;
+
+static ObjectCacheEntry objectCache[OBJECT_CACHE_SIZE];
+static unsigned int objectCacheClock;
+static CRITICAL_SECTION objectCacheLock;
+static struct ObjectCacheInit {
+	ObjectCacheInit() { InitializeCriticalSection(&objectCacheLock); }
+} objectCacheInit;
+
+static SolidBrush *acquireCachedBrush(jint argb)
+{
+	DWORD thread = GetCurrentThreadId();
+	ObjectCacheEntry *entry = NULL, *victim = NULL;
+	SolidBrush *object = NULL, *evicted = NULL;
+	int i;
+	EnterCriticalSection(&objectCacheLock);
+	for (i = 0; i < OBJECT_CACHE_SIZE; i++) {
+		ObjectCacheEntry *current = &objectCache[i];
+		if (current->object == NULL) {
+			if (victim == NULL || victim->object != NULL) victim = current;
+			continue;
+		}
+		if (current->argb == argb && current->thread == thread) {
+			entry = current;
+			break;
+		}
+		if (current->refCount == 0 && (victim == NULL || (victim->object != NULL && current->lastUse < victim->lastUse))) {
+			victim = current;
+		}
+	}
+	if (entry != NULL) {
+		entry->refCount++;
+		entry->lastUse = ++objectCacheClock;
+		object = entry->object;
+	}
+	LeaveCriticalSection(&objectCacheLock);
+	if (object != NULL) return object;
+
+	Color color(argb);
+	object = new SolidBrush(color);
+	if (object == NULL) return NULL;
+
+	EnterCriticalSection(&objectCacheLock);
+	if (victim != NULL && victim->refCount == 0) {
+		evicted = victim->object;
+		victim->argb = argb;
+		victim->thread = thread;
+		victim->object = object;
+		victim->refCount = 1;
+		victim->lastUse = ++objectCacheClock;
+	}
+	LeaveCriticalSection(&objectCacheLock);
+	if (evicted != NULL) delete evicted;
+	return object;
+}
+
+static void releaseCachedBrush(SolidBrush *object)
+{
+	int i;
+	EnterCriticalSection(&objectCacheLock);
+	for (i = 0; i < OBJECT_CACHE_SIZE; i++) {
+		ObjectCacheEntry *entry = &objectCache[i];
+		if (entry->object == object) {
+			if (entry->refCount > 0) entry->refCount--;
+			LeaveCriticalSection(&objectCacheLock);
+			return;
+		}
+	}
+	LeaveCriticalSection(&objectCacheLock);
+	delete object;
+}
+
+#ifndef NO_ObjectCache_1flush
+JNIEXPORT void JNICALL Gdip_NATIVE(ObjectCache_1flush)
+	(JNIEnv *env, jclass that)
+{
+	DWORD thread = GetCurrentThreadId();
+	int i;
+	Gdip_NATIVE_ENTER(env, that, ObjectCache_1flush_FUNC);
+	EnterCriticalSection(&objectCacheLock);
+	for (i = 0; i < OBJECT_CACHE_SIZE; i++) {
+		ObjectCacheEntry *entry = &objectCache[i];
+		if (entry->object == NULL || entry->thread != thread) continue;
+		/* Objects still in use are deleted by their final release */
+		if (entry->refCount == 0) delete entry->object;
+		entry->object = NULL;
+		entry->refCount = 0;
+	}
+	LeaveCriticalSection(&objectCacheLock);
+	Gdip_NATIVE_EXIT(env, that, ObjectCache_1flush_FUNC);
+}
+#endif
+
+#ifndef NO_SolidBrush_1acquire
+JNIEXPORT jintLong JNICALL Gdip_NATIVE(SolidBrush_1acquire)
+	(JNIEnv *env, jclass that, jint arg0)
+{
+	jintLong rc = 0;
+	Gdip_NATIVE_ENTER(env, that, SolidBrush_1acquire_FUNC);
+	rc = (jintLong)acquireCachedBrush(arg0);
+	Gdip_NATIVE_EXIT(env, that, SolidBrush_1acquire_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_SolidBrush_1release
+JNIEXPORT void JNICALL Gdip_NATIVE(SolidBrush_1release)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	Gdip_NATIVE_ENTER(env, that, SolidBrush_1release_FUNC);
+	if (arg0) releaseCachedBrush((SolidBrush *)arg0);
+	Gdip_NATIVE_EXIT(env, that, SolidBrush_1release_FUNC);
+}
+#endif
+
+#if !defined(NO_Graphics_1updateSmoothingMode) || !defined(NO_Graphics_1updateTextRenderingHint) || !defined(NO_Pen_1updateWidth)
+/*
+* The update natives compare the value with the state GDI+ keeps for the
+* graphics or pen and only call the setter when it changed.  Changing the
+* rendering modes of a graphics discards the state GDI+ derives from them,
+* so redundant calls are not free.  Skipped calls are counted in the
+* native stats as elidedCalls.
+*/
+#define GDIP_ELIDED(env, that) \
+	Gdip_NATIVE_ENTER(env, that, elidedCalls_FUNC); \
+	Gdip_NATIVE_EXIT(env, that, elidedCalls_FUNC);
+#endif
+
+#ifndef NO_Graphics_1updateSmoothingMode
+JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1updateSmoothingMode)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
+{
+	Graphics *g = (Graphics *)arg0;
+	jint rc = 0;
+	Gdip_NATIVE_ENTER(env, that, Graphics_1updateSmoothingMode_FUNC);
+	/* SmoothingModeDefault reads back as the mode it stands for */
+	if (arg1 != SmoothingModeDefault && g->GetSmoothingMode() == (SmoothingMode)arg1) {
+		GDIP_ELIDED(env, that)
+	} else {
+		rc = (jint)g->SetSmoothingMode((SmoothingMode)arg1);
+	}
+	Gdip_NATIVE_EXIT(env, that, Graphics_1updateSmoothingMode_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_Graphics_1updateTextRenderingHint
+JNIEXPORT jint JNICALL Gdip_NATIVE(Graphics_1updateTextRenderingHint)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
+{
+	Graphics *g = (Graphics *)arg0;
+	jint rc = 0;
+	Gdip_NATIVE_ENTER(env, that, Graphics_1updateTextRenderingHint_FUNC);
+	if (g->GetTextRenderingHint() == (TextRenderingHint)arg1) {
+		GDIP_ELIDED(env, that)
+	} else {
+		rc = (jint)g->SetTextRenderingHint((TextRenderingHint)arg1);
+	}
+	Gdip_NATIVE_EXIT(env, that, Graphics_1updateTextRenderingHint_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_Pen_1updateWidth
+JNIEXPORT jint JNICALL Gdip_NATIVE(Pen_1updateWidth)
+	(JNIEnv *env, jclass that, jintLong arg0, jfloat arg1)
+{
+	Pen *pen = (Pen *)arg0;
+	jint rc = 0;
+	Gdip_NATIVE_ENTER(env, that, Pen_1updateWidth_FUNC);
+	if (pen->GetWidth() == (REAL)arg1) {
+		GDIP_ELIDED(env, that)
+	} else {
+		rc = (jint)pen->SetWidth((REAL)arg1);
+	}
+	Gdip_NATIVE_EXIT(env, that, Pen_1updateWidth_FUNC);
+	return rc;
+}
+#endif
+
 }
@@ -92,6 +92,8 @@ char * Gdip_nativeFunctionNames[] = {
 	"GraphicsPath_1GetPointCount",
 	"GraphicsPath_1IsOutlineVisible",
 	"GraphicsPath_1IsVisible",
+	"GraphicsPath_1IsVisiblePaths",
+	"GraphicsPath_1IsVisiblePoints",
 	"GraphicsPath_1SetFillMode",
 	"GraphicsPath_1StartFigure",
 	"GraphicsPath_1Transform",
@@ -170,6 +172,7 @@ char * Gdip_nativeFunctionNames[] = {
 	"Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2",
 #endif
 	"Graphics_1ReleaseHDC",
+	"Graphics_1Replay",
 	"Graphics_1ResetClip",
 	"Graphics_1Restore",
 	"Graphics_1Save",
@@ -204,6 +207,8 @@ char * Gdip_nativeFunctionNames[] = {
 	"Graphics_1TranslateTransform",
 	"Graphics_1delete",
 	"Graphics_1new",
+	"Graphics_1updateSmoothingMode",
+	"Graphics_1updateTextRenderingHint",
 	"HatchBrush_1delete",
 	"HatchBrush_1new",
 	"ImageAttributes_1SetColorMatrix",
@@ -255,6 +260,7 @@ char * Gdip_nativeFunctionNames[] = {
 #else
 	"MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2JI",
 #endif
+	"ObjectCache_1flush",
 	"PathGradientBrush_1SetCenterColor",
 	"PathGradientBrush_1SetCenterPoint",
 	"PathGradientBrush_1SetGraphicsPath",
@@ -274,6 +280,7 @@ char * Gdip_nativeFunctionNames[] = {
 	"Pen_1SetWidth",
 	"Pen_1delete",
 	"Pen_1new",
+	"Pen_1updateWidth",
 	"Point_1delete",
 	"Point_1new",
 	"PrivateFontCollection_1AddFontFile",
@@ -289,8 +296,10 @@ char * Gdip_nativeFunctionNames[] = {
 	"Region_1new__J",
 #endif
 	"Region_1newGraphicsPath",
+	"SolidBrush_1acquire",
 	"SolidBrush_1delete",
 	"SolidBrush_1new",
+	"SolidBrush_1release",
 	"StringFormat_1Clone",
 	"StringFormat_1GenericDefault",
 	"StringFormat_1GenericTypographic",
@@ -305,10 +314,14 @@ char * Gdip_nativeFunctionNames[] = {
 	"TextureBrush_1TranslateTransform",
 	"TextureBrush_1delete",
 	"TextureBrush_1new",
+	"elidedCalls",
 };
 #define NATIVE_FUNCTION_COUNT sizeof(Gdip_nativeFunctionNames) / sizeof(char*)
 int Gdip_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int Gdip_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong Gdip_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT Gdip_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS Gdip_nativeStats = {Gdip_nativeFunctionCallCount, Gdip_nativeFunctionCallTime, Gdip_nativeFunctionEvents, 0, "Gdip", Gdip_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -330,4 +343,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(Gdip_1GetFunctionCallCount)
 	return Gdip_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(Gdip_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return Gdip_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(Gdip_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Gdip_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &Gdip_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Gdip_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(Gdip_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Gdip_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Gdip_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(Gdip_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
@@ -13,8 +13,9 @@
 extern int Gdip_nativeFunctionCount;
 extern int Gdip_nativeFunctionCallCount[];
 extern char* Gdip_nativeFunctionNames[];
-#define Gdip_NATIVE_ENTER(env, that, func) Gdip_nativeFunctionCallCount[func]++;
-#define Gdip_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS Gdip_nativeStats;
+#define Gdip_NATIVE_ENTER(env, that, func) nativeStatsEnter(&Gdip_nativeStats, func);
+#define Gdip_NATIVE_EXIT(env, that, func) nativeStatsExit(&Gdip_nativeStats, func);
 #else
 #ifndef Gdip_NATIVE_ENTER
 #define Gdip_NATIVE_ENTER(env, that, func) 
@@ -102,6 +103,8 @@ typedef enum {
 	GraphicsPath_1GetPointCount_FUNC,
 	GraphicsPath_1IsOutlineVisible_FUNC,
 	GraphicsPath_1IsVisible_FUNC,
+	GraphicsPath_1IsVisiblePaths_FUNC,
+	GraphicsPath_1IsVisiblePoints_FUNC,
 	GraphicsPath_1SetFillMode_FUNC,
 	GraphicsPath_1StartFigure_FUNC,
 	GraphicsPath_1Transform_FUNC,
@@ -180,6 +183,7 @@ typedef enum {
 	Graphics_1MeasureString__J_3CIJLorg_eclipse_swt_internal_gdip_PointF_2Lorg_eclipse_swt_internal_gdip_RectF_2_FUNC,
 #endif
 	Graphics_1ReleaseHDC_FUNC,
+	Graphics_1Replay_FUNC,
 	Graphics_1ResetClip_FUNC,
 	Graphics_1Restore_FUNC,
 	Graphics_1Save_FUNC,
@@ -214,6 +218,8 @@ typedef enum {
 	Graphics_1TranslateTransform_FUNC,
 	Graphics_1delete_FUNC,
 	Graphics_1new_FUNC,
+	Graphics_1updateSmoothingMode_FUNC,
+	Graphics_1updateTextRenderingHint_FUNC,
 	HatchBrush_1delete_FUNC,
 	HatchBrush_1new_FUNC,
 	ImageAttributes_1SetColorMatrix_FUNC,
@@ -265,6 +271,7 @@ typedef enum {
 #else
 	MoveMemory__Lorg_eclipse_swt_internal_gdip_ColorPalette_2JI_FUNC,
 #endif
+	ObjectCache_1flush_FUNC,
 	PathGradientBrush_1SetCenterColor_FUNC,
 	PathGradientBrush_1SetCenterPoint_FUNC,
 	PathGradientBrush_1SetGraphicsPath_FUNC,
@@ -284,6 +291,7 @@ typedef enum {
 	Pen_1SetWidth_FUNC,
 	Pen_1delete_FUNC,
 	Pen_1new_FUNC,
+	Pen_1updateWidth_FUNC,
 	Point_1delete_FUNC,
 	Point_1new_FUNC,
 	PrivateFontCollection_1AddFontFile_FUNC,
@@ -299,8 +307,10 @@ typedef enum {
 	Region_1new__J_FUNC,
 #endif
 	Region_1newGraphicsPath_FUNC,
+	SolidBrush_1acquire_FUNC,
 	SolidBrush_1delete_FUNC,
 	SolidBrush_1new_FUNC,
+	SolidBrush_1release_FUNC,
 	StringFormat_1Clone_FUNC,
 	StringFormat_1GenericDefault_FUNC,
 	StringFormat_1GenericTypographic_FUNC,
@@ -315,4 +325,5 @@ typedef enum {
 	TextureBrush_1TranslateTransform_FUNC,
 	TextureBrush_1delete_FUNC,
 	TextureBrush_1new_FUNC,
+	elidedCalls_FUNC,
 } Gdip_FUNCS;
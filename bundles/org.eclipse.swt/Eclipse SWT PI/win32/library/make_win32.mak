@@ -23,14 +23,14 @@ WS_PREFIX   = win32
 SWT_VERSION = $(maj_ver)$(min_ver)
 SWT_LIB     = $(SWT_PREFIX)-$(WS_PREFIX)-$(SWT_VERSION).dll
 SWT_LIBS    = comctl32.lib shell32.lib imm32.lib oleacc.lib usp10.lib wininet.lib Crypt32.lib Shlwapi.lib
-SWT_OBJS    = swt.obj callback.obj c.obj c_stats.obj \
+SWT_OBJS    = swt.obj callback.obj blit.obj transcode.obj pngfilter.obj lzw.obj tiff.obj benchmark.obj watchdog.obj arena.obj pool.obj c.obj c_stats.obj \
 	os.obj os_structs.obj os_custom.obj os_stats.obj \
 	com_structs.obj com.obj com_stats.obj com_custom.obj
 
 GDIP_PREFIX  = swt-gdip
 GDIP_LIB     = $(GDIP_PREFIX)-$(WS_PREFIX)-$(SWT_VERSION).dll
 GDIP_LIBS    = gdiplus.lib
-GDIP_OBJS    = gdip.obj gdip_structs.obj gdip_stats.obj gdip_custom.obj
+GDIP_OBJS    = swt.obj arena.obj gdip.obj gdip_structs.obj gdip_stats.obj gdip_custom.obj
 
 AWT_PREFIX = swt-awt
 AWT_LIB    = $(AWT_PREFIX)-$(WS_PREFIX)-$(SWT_VERSION).dll
@@ -30,7 +30,7 @@ CFLAGS = /nologo /c /W3 -O1 -DSWT_VERSION=$(SWT_VERSION) -DREDUCED_CALLBACKS -DJ
 RCFLAGS = -DSWT_FILE_VERSION=\"$(maj_ver).$(min_ver)\" -DSWT_COMMA_VERSION=$(comma_ver) -D"WIN32_PLATFORM_PSPC"
 LFLAGS = $(dlllflags) /dll /entry:"_DllMainCRTStartup" /NODEFAULTLIB:libc.lib /nodefaultlib:oldnames.lib
 
-SWT_OBJS = swt.obj c.obj c_stats.obj os.obj os_structs.obj os_custom.obj callback.obj
+SWT_OBJS = swt.obj c.obj c_stats.obj os.obj os_structs.obj os_custom.obj callback.obj blit.obj transcode.obj pngfilter.obj lzw.obj tiff.obj benchmark.obj watchdog.obj arena.obj pool.obj
 
 all: $(SWT_LIB)
 
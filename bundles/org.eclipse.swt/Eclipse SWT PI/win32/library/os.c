@@ -17,8 +17,12 @@
 #define OS_NATIVE(func) Java_org_eclipse_swt_internal_win32_OS_##func
 #endif
 
+#ifndef OS_CRITICAL
+#define OS_CRITICAL(func) JavaCritical_org_eclipse_swt_internal_win32_OS_##func
+#endif
+
 #ifndef NO_ACCEL_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(ACCEL_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ACCEL_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -30,7 +34,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ACCEL_1sizeof)
 #endif
 
 #ifndef NO_ACTCTX_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(ACTCTX_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ACTCTX_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -42,7 +46,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ACTCTX_1sizeof)
 #endif
 
 #ifndef NO_AbortDoc
-JNIEXPORT jint JNICALL OS_NATIVE(AbortDoc)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(AbortDoc)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -54,7 +58,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(AbortDoc)
 #endif
 
 #ifndef NO_ActivateActCtx
-JNIEXPORT jboolean JNICALL OS_NATIVE(ActivateActCtx)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ActivateActCtx)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLongArray arg1)
 {
 	jintLong *lparg1=NULL;
@@ -78,7 +82,7 @@ fail:
 #endif
 
 #ifndef NO_ActivateKeyboardLayout
-JNIEXPORT jintLong JNICALL OS_NATIVE(ActivateKeyboardLayout)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(ActivateKeyboardLayout)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jintLong rc = 0;
@@ -90,7 +94,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(ActivateKeyboardLayout)
 #endif
 
 #ifndef NO_AddFontResourceExA
-JNIEXPORT jint JNICALL OS_NATIVE(AddFontResourceExA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(AddFontResourceExA)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jintLong arg2)
 {
 	jbyte *lparg0=NULL;
@@ -114,7 +118,7 @@ fail:
 #endif
 
 #ifndef NO_AddFontResourceExW
-JNIEXPORT jint JNICALL OS_NATIVE(AddFontResourceExW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(AddFontResourceExW)
 	(JNIEnv *env, jclass that, jcharArray arg0, jint arg1, jintLong arg2)
 {
 	jchar *lparg0=NULL;
@@ -138,7 +142,7 @@ fail:
 #endif
 
 #ifndef NO_AdjustWindowRectEx
-JNIEXPORT jboolean JNICALL OS_NATIVE(AdjustWindowRectEx)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(AdjustWindowRectEx)
 	(JNIEnv *env, jclass that, jobject arg0, jint arg1, jboolean arg2, jint arg3)
 {
 	RECT _arg0, *lparg0=NULL;
@@ -154,7 +158,7 @@ fail:
 #endif
 
 #ifndef NO_AllowSetForegroundWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(AllowSetForegroundWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(AllowSetForegroundWindow)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jboolean rc = 0;
@@ -174,7 +178,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(AllowSetForegroundWindow)
 #endif
 
 #ifndef NO_AlphaBlend
-JNIEXPORT jboolean JNICALL OS_NATIVE(AlphaBlend)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(AlphaBlend)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4, jintLong arg5, jint arg6, jint arg7, jint arg8, jint arg9, jobject arg10)
 {
 	BLENDFUNCTION _arg10, *lparg10=NULL;
@@ -198,7 +202,7 @@ fail:
 #endif
 
 #ifndef NO_AnimateWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(AnimateWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(AnimateWindow)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jboolean rc = 0;
@@ -218,7 +222,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(AnimateWindow)
 #endif
 
 #ifndef NO_Arc
-JNIEXPORT jboolean JNICALL OS_NATIVE(Arc)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(Arc)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jint arg8)
 {
 	jboolean rc = 0;
@@ -230,7 +234,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Arc)
 #endif
 
 #ifndef NO_AssocQueryStringA
-JNIEXPORT jint JNICALL OS_NATIVE(AssocQueryStringA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(AssocQueryStringA)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jbyteArray arg2, jbyteArray arg3, jbyteArray arg4, jintArray arg5)
 {
 	jbyte *lparg2=NULL;
@@ -263,7 +267,7 @@ fail:
 #endif
 
 #ifndef NO_AssocQueryStringW
-JNIEXPORT jint JNICALL OS_NATIVE(AssocQueryStringW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(AssocQueryStringW)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jcharArray arg2, jcharArray arg3, jcharArray arg4, jintArray arg5)
 {
 	jchar *lparg2=NULL;
@@ -296,7 +300,7 @@ fail:
 #endif
 
 #ifndef NO_AttachThreadInput
-JNIEXPORT jboolean JNICALL OS_NATIVE(AttachThreadInput)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(AttachThreadInput)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jboolean arg2)
 {
 	jboolean rc = 0;
@@ -308,7 +312,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(AttachThreadInput)
 #endif
 
 #ifndef NO_BITMAPINFOHEADER_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(BITMAPINFOHEADER_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(BITMAPINFOHEADER_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -320,7 +324,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BITMAPINFOHEADER_1sizeof)
 #endif
 
 #ifndef NO_BITMAP_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(BITMAP_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(BITMAP_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -332,7 +336,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BITMAP_1sizeof)
 #endif
 
 #ifndef NO_BLENDFUNCTION_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(BLENDFUNCTION_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(BLENDFUNCTION_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -344,7 +348,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BLENDFUNCTION_1sizeof)
 #endif
 
 #ifndef NO_BP_1PAINTPARAMS_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(BP_1PAINTPARAMS_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(BP_1PAINTPARAMS_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -356,7 +360,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BP_1PAINTPARAMS_1sizeof)
 #endif
 
 #ifndef NO_BROWSEINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(BROWSEINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(BROWSEINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -368,7 +372,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BROWSEINFO_1sizeof)
 #endif
 
 #ifndef NO_BUTTON_1IMAGELIST_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(BUTTON_1IMAGELIST_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(BUTTON_1IMAGELIST_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -380,7 +384,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BUTTON_1IMAGELIST_1sizeof)
 #endif
 
 #ifndef NO_BeginBufferedPaint
-JNIEXPORT jintLong JNICALL OS_NATIVE(BeginBufferedPaint)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(BeginBufferedPaint)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2, jobject arg3, jintLongArray arg4)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -410,7 +414,7 @@ fail:
 #endif
 
 #ifndef NO_BeginDeferWindowPos
-JNIEXPORT jintLong JNICALL OS_NATIVE(BeginDeferWindowPos)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(BeginDeferWindowPos)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -422,7 +426,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(BeginDeferWindowPos)
 #endif
 
 #ifndef NO_BeginPaint
-JNIEXPORT jintLong JNICALL OS_NATIVE(BeginPaint)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(BeginPaint)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	PAINTSTRUCT _arg1, *lparg1=NULL;
@@ -438,7 +442,7 @@ fail:
 #endif
 
 #ifndef NO_BeginPath
-JNIEXPORT jboolean JNICALL OS_NATIVE(BeginPath)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(BeginPath)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -450,7 +454,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(BeginPath)
 #endif
 
 #ifndef NO_BitBlt
-JNIEXPORT jboolean JNICALL OS_NATIVE(BitBlt)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(BitBlt)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4, jintLong arg5, jint arg6, jint arg7, jint arg8)
 {
 	jboolean rc = 0;
@@ -459,10 +463,16 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(BitBlt)
 	OS_NATIVE_EXIT(env, that, BitBlt_FUNC);
 	return rc;
 }
+
+JNIEXPORT jboolean JNICALL OS_CRITICAL(BitBlt)
+	(jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4, jintLong arg5, jint arg6, jint arg7, jint arg8)
+{
+	return (jboolean)BitBlt((HDC)arg0, arg1, arg2, arg3, arg4, (HDC)arg5, arg6, arg7, arg8);
+}
 #endif
 
 #ifndef NO_BringWindowToTop
-JNIEXPORT jboolean JNICALL OS_NATIVE(BringWindowToTop)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(BringWindowToTop)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -474,7 +484,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(BringWindowToTop)
 #endif
 
 #ifndef NO_BufferedPaintInit
-JNIEXPORT jint JNICALL OS_NATIVE(BufferedPaintInit)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(BufferedPaintInit)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -494,7 +504,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BufferedPaintInit)
 #endif
 
 #ifndef NO_BufferedPaintSetAlpha
-JNIEXPORT jint JNICALL OS_NATIVE(BufferedPaintSetAlpha)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(BufferedPaintSetAlpha)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jbyte arg2)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -518,7 +528,7 @@ fail:
 #endif
 
 #ifndef NO_BufferedPaintUnInit
-JNIEXPORT jint JNICALL OS_NATIVE(BufferedPaintUnInit)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(BufferedPaintUnInit)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -538,7 +548,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BufferedPaintUnInit)
 #endif
 
 #ifndef NO_CANDIDATEFORM_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CANDIDATEFORM_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CANDIDATEFORM_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -550,7 +560,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CANDIDATEFORM_1sizeof)
 #endif
 
 #ifndef NO_CERT_1CONTEXT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CERT_1CONTEXT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CERT_1CONTEXT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -562,7 +572,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CERT_1CONTEXT_1sizeof)
 #endif
 
 #ifndef NO_CERT_1INFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CERT_1INFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CERT_1INFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -574,7 +584,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CERT_1INFO_1sizeof)
 #endif
 
 #ifndef NO_CERT_1NAME_1BLOB_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CERT_1NAME_1BLOB_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CERT_1NAME_1BLOB_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -586,7 +596,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CERT_1NAME_1BLOB_1sizeof)
 #endif
 
 #ifndef NO_CERT_1PUBLIC_1KEY_1INFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CERT_1PUBLIC_1KEY_1INFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CERT_1PUBLIC_1KEY_1INFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -598,7 +608,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CERT_1PUBLIC_1KEY_1INFO_1sizeof)
 #endif
 
 #ifndef NO_CHOOSECOLOR_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CHOOSECOLOR_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CHOOSECOLOR_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -610,7 +620,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CHOOSECOLOR_1sizeof)
 #endif
 
 #ifndef NO_CHOOSEFONT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CHOOSEFONT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CHOOSEFONT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -622,7 +632,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CHOOSEFONT_1sizeof)
 #endif
 
 #ifndef NO_COMBOBOXINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(COMBOBOXINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(COMBOBOXINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -634,7 +644,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(COMBOBOXINFO_1sizeof)
 #endif
 
 #ifndef NO_COMPOSITIONFORM_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(COMPOSITIONFORM_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(COMPOSITIONFORM_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -646,7 +656,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(COMPOSITIONFORM_1sizeof)
 #endif
 
 #ifndef NO_CREATESTRUCT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CREATESTRUCT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CREATESTRUCT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -658,7 +668,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CREATESTRUCT_1sizeof)
 #endif
 
 #ifndef NO_CRYPT_1ALGORITHM_1IDENTIFIER_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CRYPT_1ALGORITHM_1IDENTIFIER_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CRYPT_1ALGORITHM_1IDENTIFIER_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -670,7 +680,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CRYPT_1ALGORITHM_1IDENTIFIER_1sizeof)
 #endif
 
 #ifndef NO_CRYPT_1BIT_1BLOB_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CRYPT_1BIT_1BLOB_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CRYPT_1BIT_1BLOB_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -682,7 +692,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CRYPT_1BIT_1BLOB_1sizeof)
 #endif
 
 #ifndef NO_CRYPT_1INTEGER_1BLOB_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CRYPT_1INTEGER_1BLOB_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CRYPT_1INTEGER_1BLOB_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -694,7 +704,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CRYPT_1INTEGER_1BLOB_1sizeof)
 #endif
 
 #ifndef NO_CRYPT_1OBJID_1BLOB_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(CRYPT_1OBJID_1BLOB_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CRYPT_1OBJID_1BLOB_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -707,9 +717,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(CRYPT_1OBJID_1BLOB_1sizeof)
 
 #if (!defined(NO_Call__I) && !defined(JNI64)) || (!defined(NO_Call__J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(Call__I)(JNIEnv *env, jclass that, jintLong arg0)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(Call__I)(JNIEnv *env, jclass that, jintLong arg0)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(Call__J)(JNIEnv *env, jclass that, jintLong arg0)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(Call__J)(JNIEnv *env, jclass that, jintLong arg0)
 #endif
 {
 	jint rc = 0;
@@ -730,9 +740,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(Call__J)(JNIEnv *env, jclass that, jintLong arg
 
 #if (!defined(NO_Call__ILorg_eclipse_swt_internal_win32_DLLVERSIONINFO_2) && !defined(JNI64)) || (!defined(NO_Call__JLorg_eclipse_swt_internal_win32_DLLVERSIONINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(Call__ILorg_eclipse_swt_internal_win32_DLLVERSIONINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(Call__ILorg_eclipse_swt_internal_win32_DLLVERSIONINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(Call__JLorg_eclipse_swt_internal_win32_DLLVERSIONINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(Call__JLorg_eclipse_swt_internal_win32_DLLVERSIONINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 #endif
 {
 	DLLVERSIONINFO _arg1, *lparg1=NULL;
@@ -756,7 +766,7 @@ fail:
 #endif
 
 #ifndef NO_CallNextHookEx
-JNIEXPORT jintLong JNICALL OS_NATIVE(CallNextHookEx)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CallNextHookEx)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
 {
 	jintLong rc = 0;
@@ -768,7 +778,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CallNextHookEx)
 #endif
 
 #ifndef NO_CallWindowProcA
-JNIEXPORT jintLong JNICALL OS_NATIVE(CallWindowProcA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CallWindowProcA)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLong arg3, jintLong arg4)
 {
 	jintLong rc = 0;
@@ -780,7 +790,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CallWindowProcA)
 #endif
 
 #ifndef NO_CallWindowProcW
-JNIEXPORT jintLong JNICALL OS_NATIVE(CallWindowProcW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CallWindowProcW)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLong arg3, jintLong arg4)
 {
 	jintLong rc = 0;
@@ -792,7 +802,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CallWindowProcW)
 #endif
 
 #ifndef NO_CertNameToStrA
-JNIEXPORT jint JNICALL OS_NATIVE(CertNameToStrA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CertNameToStrA)
 	(JNIEnv *env, jclass that, jint arg0, jobject arg1, jint arg2, jbyteArray arg3, jint arg4)
 {
 	CERT_NAME_BLOB _arg1, *lparg1=NULL;
@@ -811,7 +821,7 @@ fail:
 #endif
 
 #ifndef NO_CertNameToStrW
-JNIEXPORT jint JNICALL OS_NATIVE(CertNameToStrW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CertNameToStrW)
 	(JNIEnv *env, jclass that, jint arg0, jobject arg1, jint arg2, jcharArray arg3, jint arg4)
 {
 	CERT_NAME_BLOB _arg1, *lparg1=NULL;
@@ -830,7 +840,7 @@ fail:
 #endif
 
 #ifndef NO_CharLowerA
-JNIEXPORT jintLong JNICALL OS_NATIVE(CharLowerA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CharLowerA)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -842,7 +852,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CharLowerA)
 #endif
 
 #ifndef NO_CharLowerW
-JNIEXPORT jintLong JNICALL OS_NATIVE(CharLowerW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CharLowerW)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -854,7 +864,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CharLowerW)
 #endif
 
 #ifndef NO_CharUpperA
-JNIEXPORT jintLong JNICALL OS_NATIVE(CharUpperA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CharUpperA)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -866,7 +876,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CharUpperA)
 #endif
 
 #ifndef NO_CharUpperW
-JNIEXPORT jintLong JNICALL OS_NATIVE(CharUpperW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CharUpperW)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -878,7 +888,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CharUpperW)
 #endif
 
 #ifndef NO_CheckMenuItem
-JNIEXPORT jboolean JNICALL OS_NATIVE(CheckMenuItem)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(CheckMenuItem)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jboolean rc = 0;
@@ -890,7 +900,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(CheckMenuItem)
 #endif
 
 #ifndef NO_ChooseColorA
-JNIEXPORT jboolean JNICALL OS_NATIVE(ChooseColorA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ChooseColorA)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	CHOOSECOLOR _arg0, *lparg0=NULL;
@@ -906,7 +916,7 @@ fail:
 #endif
 
 #ifndef NO_ChooseColorW
-JNIEXPORT jboolean JNICALL OS_NATIVE(ChooseColorW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ChooseColorW)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	CHOOSECOLOR _arg0, *lparg0=NULL;
@@ -915,14 +925,13 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ChooseColorW)
 	if (arg0) if ((lparg0 = getCHOOSECOLORFields(env, arg0, &_arg0)) == NULL) goto fail;
 	rc = (jboolean)ChooseColorW((LPCHOOSECOLORW)lparg0);
 fail:
-	if (arg0 && lparg0) setCHOOSECOLORFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, ChooseColorW_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_ChooseFontA
-JNIEXPORT jboolean JNICALL OS_NATIVE(ChooseFontA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ChooseFontA)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	CHOOSEFONT _arg0, *lparg0=NULL;
@@ -938,7 +947,7 @@ fail:
 #endif
 
 #ifndef NO_ChooseFontW
-JNIEXPORT jboolean JNICALL OS_NATIVE(ChooseFontW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ChooseFontW)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	CHOOSEFONT _arg0, *lparg0=NULL;
@@ -947,14 +956,13 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ChooseFontW)
 	if (arg0) if ((lparg0 = getCHOOSEFONTFields(env, arg0, &_arg0)) == NULL) goto fail;
 	rc = (jboolean)ChooseFontW((LPCHOOSEFONTW)lparg0);
 fail:
-	if (arg0 && lparg0) setCHOOSEFONTFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, ChooseFontW_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_ClientToScreen
-JNIEXPORT jboolean JNICALL OS_NATIVE(ClientToScreen)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ClientToScreen)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	POINT _arg1, *lparg1=NULL;
@@ -970,7 +978,7 @@ fail:
 #endif
 
 #ifndef NO_CloseClipboard
-JNIEXPORT jboolean JNICALL OS_NATIVE(CloseClipboard)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(CloseClipboard)
 	(JNIEnv *env, jclass that)
 {
 	jboolean rc = 0;
@@ -982,7 +990,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(CloseClipboard)
 #endif
 
 #ifndef NO_CloseEnhMetaFile
-JNIEXPORT jintLong JNICALL OS_NATIVE(CloseEnhMetaFile)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CloseEnhMetaFile)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -994,7 +1002,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CloseEnhMetaFile)
 #endif
 
 #ifndef NO_CloseGestureInfoHandle
-JNIEXPORT jintLong JNICALL OS_NATIVE(CloseGestureInfoHandle)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CloseGestureInfoHandle)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -1014,7 +1022,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CloseGestureInfoHandle)
 #endif
 
 #ifndef NO_CloseHandle
-JNIEXPORT jboolean JNICALL OS_NATIVE(CloseHandle)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(CloseHandle)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -1026,7 +1034,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(CloseHandle)
 #endif
 
 #ifndef NO_ClosePrinter
-JNIEXPORT jboolean JNICALL OS_NATIVE(ClosePrinter)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ClosePrinter)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -1038,7 +1046,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ClosePrinter)
 #endif
 
 #ifndef NO_CloseThemeData
-JNIEXPORT jint JNICALL OS_NATIVE(CloseThemeData)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CloseThemeData)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1058,7 +1066,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CloseThemeData)
 #endif
 
 #ifndef NO_CloseTouchInputHandle
-JNIEXPORT jboolean JNICALL OS_NATIVE(CloseTouchInputHandle)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(CloseTouchInputHandle)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -1078,7 +1086,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(CloseTouchInputHandle)
 #endif
 
 #ifndef NO_CoCreateInstance
-JNIEXPORT jint JNICALL OS_NATIVE(CoCreateInstance)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CoCreateInstance)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jintLong arg1, jint arg2, jbyteArray arg3, jintLongArray arg4)
 {
 	jbyte *lparg0=NULL;
@@ -1100,7 +1108,7 @@ fail:
 #endif
 
 #ifndef NO_CoInternetIsFeatureEnabled
-JNIEXPORT jint JNICALL OS_NATIVE(CoInternetIsFeatureEnabled)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CoInternetIsFeatureEnabled)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	jint rc = 0;
@@ -1120,7 +1128,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CoInternetIsFeatureEnabled)
 #endif
 
 #ifndef NO_CoInternetSetFeatureEnabled
-JNIEXPORT jint JNICALL OS_NATIVE(CoInternetSetFeatureEnabled)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CoInternetSetFeatureEnabled)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jboolean arg2)
 {
 	jint rc = 0;
@@ -1140,7 +1148,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CoInternetSetFeatureEnabled)
 #endif
 
 #ifndef NO_CoTaskMemAlloc
-JNIEXPORT jintLong JNICALL OS_NATIVE(CoTaskMemAlloc)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CoTaskMemAlloc)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -1152,7 +1160,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CoTaskMemAlloc)
 #endif
 
 #ifndef NO_CoTaskMemFree
-JNIEXPORT void JNICALL OS_NATIVE(CoTaskMemFree)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CoTaskMemFree)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CoTaskMemFree_FUNC);
@@ -1162,7 +1170,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CoTaskMemFree)
 #endif
 
 #ifndef NO_CombineRgn
-JNIEXPORT jint JNICALL OS_NATIVE(CombineRgn)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CombineRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jint arg3)
 {
 	jint rc = 0;
@@ -1174,7 +1182,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CombineRgn)
 #endif
 
 #ifndef NO_CommDlgExtendedError
-JNIEXPORT jint JNICALL OS_NATIVE(CommDlgExtendedError)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CommDlgExtendedError)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -1186,7 +1194,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CommDlgExtendedError)
 #endif
 
 #ifndef NO_CommandBar_1AddAdornments
-JNIEXPORT jboolean JNICALL OS_NATIVE(CommandBar_1AddAdornments)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(CommandBar_1AddAdornments)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jboolean rc = 0;
@@ -1198,7 +1206,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(CommandBar_1AddAdornments)
 #endif
 
 #ifndef NO_CommandBar_1Create
-JNIEXPORT jintLong JNICALL OS_NATIVE(CommandBar_1Create)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CommandBar_1Create)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
 {
 	jintLong rc = 0;
@@ -1210,7 +1218,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CommandBar_1Create)
 #endif
 
 #ifndef NO_CommandBar_1Destroy
-JNIEXPORT void JNICALL OS_NATIVE(CommandBar_1Destroy)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(CommandBar_1Destroy)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, CommandBar_1Destroy_FUNC);
@@ -1220,7 +1228,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CommandBar_1Destroy)
 #endif
 
 #ifndef NO_CommandBar_1DrawMenuBar
-JNIEXPORT jboolean JNICALL OS_NATIVE(CommandBar_1DrawMenuBar)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(CommandBar_1DrawMenuBar)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jboolean rc = 0;
@@ -1232,7 +1240,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(CommandBar_1DrawMenuBar)
 #endif
 
 #ifndef NO_CommandBar_1Height
-JNIEXPORT jint JNICALL OS_NATIVE(CommandBar_1Height)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CommandBar_1Height)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -1244,7 +1252,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CommandBar_1Height)
 #endif
 
 #ifndef NO_CommandBar_1InsertMenubarEx
-JNIEXPORT jboolean JNICALL OS_NATIVE(CommandBar_1InsertMenubarEx)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(CommandBar_1InsertMenubarEx)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jint arg3)
 {
 	jboolean rc = 0;
@@ -1256,7 +1264,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(CommandBar_1InsertMenubarEx)
 #endif
 
 #ifndef NO_CommandBar_1Show
-JNIEXPORT jboolean JNICALL OS_NATIVE(CommandBar_1Show)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(CommandBar_1Show)
 	(JNIEnv *env, jclass that, jintLong arg0, jboolean arg1)
 {
 	jboolean rc = 0;
@@ -1268,7 +1276,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(CommandBar_1Show)
 #endif
 
 #ifndef NO_CopyImage
-JNIEXPORT jintLong JNICALL OS_NATIVE(CopyImage)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CopyImage)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4)
 {
 	jintLong rc = 0;
@@ -1280,7 +1288,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CopyImage)
 #endif
 
 #ifndef NO_CreateAcceleratorTableA
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateAcceleratorTableA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateAcceleratorTableA)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1)
 {
 	jbyte *lparg0=NULL;
@@ -1296,7 +1304,7 @@ fail:
 #endif
 
 #ifndef NO_CreateAcceleratorTableW
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateAcceleratorTableW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateAcceleratorTableW)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1)
 {
 	jbyte *lparg0=NULL;
@@ -1312,7 +1320,7 @@ fail:
 #endif
 
 #ifndef NO_CreateActCtxA
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateActCtxA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateActCtxA)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	ACTCTX _arg0, *lparg0=NULL;
@@ -1335,7 +1343,7 @@ fail:
 #endif
 
 #ifndef NO_CreateActCtxW
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateActCtxW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateActCtxW)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	ACTCTX _arg0, *lparg0=NULL;
@@ -1358,7 +1366,7 @@ fail:
 #endif
 
 #ifndef NO_CreateBitmap
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateBitmap)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateBitmap)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jbyteArray arg4)
 {
 	jbyte *lparg4=NULL;
@@ -1382,13 +1390,14 @@ fail:
 	{
 		if (arg4 && lparg4) (*env)->ReleaseByteArrayElements(env, arg4, lparg4, JNI_ABORT);
 	}
+	NATIVE_RESOURCE_CREATE(env, "HBITMAP", rc, (jlong)arg0*arg1*arg2*arg3/8);
 	OS_NATIVE_EXIT(env, that, CreateBitmap_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_CreateCaret
-JNIEXPORT jboolean JNICALL OS_NATIVE(CreateCaret)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(CreateCaret)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3)
 {
 	jboolean rc = 0;
@@ -1400,31 +1409,33 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(CreateCaret)
 #endif
 
 #ifndef NO_CreateCompatibleBitmap
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateCompatibleBitmap)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateCompatibleBitmap)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jintLong rc = 0;
 	OS_NATIVE_ENTER(env, that, CreateCompatibleBitmap_FUNC);
 	rc = (jintLong)CreateCompatibleBitmap((HDC)arg0, arg1, arg2);
+	NATIVE_RESOURCE_CREATE(env, "HBITMAP", rc, (jlong)arg1*arg2*4);
 	OS_NATIVE_EXIT(env, that, CreateCompatibleBitmap_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_CreateCompatibleDC
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateCompatibleDC)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateCompatibleDC)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
 	OS_NATIVE_ENTER(env, that, CreateCompatibleDC_FUNC);
 	rc = (jintLong)CreateCompatibleDC((HDC)arg0);
+	NATIVE_RESOURCE_CREATE(env, "HDC", rc, 0);
 	OS_NATIVE_EXIT(env, that, CreateCompatibleDC_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_CreateCursor
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateCursor)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateCursor)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4, jbyteArray arg5, jbyteArray arg6)
 {
 	jbyte *lparg5=NULL;
@@ -1459,7 +1470,7 @@ fail:
 #endif
 
 #ifndef NO_CreateDCA
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateDCA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateDCA)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jbyteArray arg1, jintLong arg2, jintLong arg3)
 {
 	jbyte *lparg0=NULL;
@@ -1478,7 +1489,7 @@ fail:
 #endif
 
 #ifndef NO_CreateDCW
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateDCW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateDCW)
 	(JNIEnv *env, jclass that, jcharArray arg0, jcharArray arg1, jintLong arg2, jintLong arg3)
 {
 	jchar *lparg0=NULL;
@@ -1498,9 +1509,9 @@ fail:
 
 #if (!defined(NO_CreateDIBSection__III_3III) && !defined(JNI64)) || (!defined(NO_CreateDIBSection__JJI_3JJI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateDIBSection__III_3III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLongArray arg3, jintLong arg4, jint arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateDIBSection__III_3III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLongArray arg3, jintLong arg4, jint arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateDIBSection__JJI_3JJI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLongArray arg3, jintLong arg4, jint arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateDIBSection__JJI_3JJI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLongArray arg3, jintLong arg4, jint arg5)
 #endif
 {
 	jintLong *lparg3=NULL;
@@ -1528,6 +1539,7 @@ fail:
 	{
 		if (arg3 && lparg3) (*env)->ReleaseIntLongArrayElements(env, arg3, lparg3, 0);
 	}
+	NATIVE_RESOURCE_CREATE(env, "HBITMAP", rc, 0);
 #ifndef JNI64
 	OS_NATIVE_EXIT(env, that, CreateDIBSection__III_3III_FUNC);
 #else
@@ -1539,9 +1551,9 @@ fail:
 
 #if (!defined(NO_CreateDIBSection__I_3BI_3III) && !defined(JNI64)) || (!defined(NO_CreateDIBSection__J_3BI_3JJI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateDIBSection__I_3BI_3III)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jintLongArray arg3, jintLong arg4, jint arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateDIBSection__I_3BI_3III)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jintLongArray arg3, jintLong arg4, jint arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateDIBSection__J_3BI_3JJI)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jintLongArray arg3, jintLong arg4, jint arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateDIBSection__J_3BI_3JJI)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jintLongArray arg3, jintLong arg4, jint arg5)
 #endif
 {
 	jbyte *lparg1=NULL;
@@ -1574,6 +1586,7 @@ fail:
 		if (arg3 && lparg3) (*env)->ReleaseIntLongArrayElements(env, arg3, lparg3, 0);
 		if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	}
+	NATIVE_RESOURCE_CREATE(env, "HBITMAP", rc, 0);
 #ifndef JNI64
 	OS_NATIVE_EXIT(env, that, CreateDIBSection__I_3BI_3III_FUNC);
 #else
@@ -1584,7 +1597,7 @@ fail:
 #endif
 
 #ifndef NO_CreateEnhMetaFileA
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateEnhMetaFileA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateEnhMetaFileA)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jobject arg2, jbyteArray arg3)
 {
 	jbyte *lparg1=NULL;
@@ -1597,16 +1610,16 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CreateEnhMetaFileA)
 	if (arg3) if ((lparg3 = (*env)->GetByteArrayElements(env, arg3, NULL)) == NULL) goto fail;
 	rc = (jintLong)CreateEnhMetaFileA((HDC)arg0, (LPCSTR)lparg1, lparg2, (LPCSTR)lparg3);
 fail:
-	if (arg3 && lparg3) (*env)->ReleaseByteArrayElements(env, arg3, lparg3, 0);
+	if (arg3 && lparg3) (*env)->ReleaseByteArrayElements(env, arg3, lparg3, JNI_ABORT);
 	if (arg2 && lparg2) setRECTFields(env, arg2, lparg2);
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CreateEnhMetaFileA_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_CreateEnhMetaFileW
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateEnhMetaFileW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateEnhMetaFileW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jobject arg2, jcharArray arg3)
 {
 	jchar *lparg1=NULL;
@@ -1619,9 +1632,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CreateEnhMetaFileW)
 	if (arg3) if ((lparg3 = (*env)->GetCharArrayElements(env, arg3, NULL)) == NULL) goto fail;
 	rc = (jintLong)CreateEnhMetaFileW((HDC)arg0, (LPCWSTR)lparg1, lparg2, (LPCWSTR)lparg3);
 fail:
-	if (arg3 && lparg3) (*env)->ReleaseCharArrayElements(env, arg3, lparg3, 0);
+	if (arg3 && lparg3) (*env)->ReleaseCharArrayElements(env, arg3, lparg3, JNI_ABORT);
 	if (arg2 && lparg2) setRECTFields(env, arg2, lparg2);
-	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, CreateEnhMetaFileW_FUNC);
 	return rc;
 }
@@ -1629,9 +1642,9 @@ fail:
 
 #if (!defined(NO_CreateFontIndirectA__I) && !defined(JNI64)) || (!defined(NO_CreateFontIndirectA__J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectA__I)(JNIEnv *env, jclass that, jintLong arg0)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectA__I)(JNIEnv *env, jclass that, jintLong arg0)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectA__J)(JNIEnv *env, jclass that, jintLong arg0)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectA__J)(JNIEnv *env, jclass that, jintLong arg0)
 #endif
 {
 	jintLong rc = 0;
@@ -1641,6 +1654,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectA__J)(JNIEnv *env, jclass
 	OS_NATIVE_ENTER(env, that, CreateFontIndirectA__J_FUNC);
 #endif
 	rc = (jintLong)CreateFontIndirectA((LPLOGFONTA)arg0);
+	NATIVE_RESOURCE_CREATE(env, "HFONT", rc, 0);
 #ifndef JNI64
 	OS_NATIVE_EXIT(env, that, CreateFontIndirectA__I_FUNC);
 #else
@@ -1651,7 +1665,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectA__J)(JNIEnv *env, jclass
 #endif
 
 #ifndef NO_CreateFontIndirectA__Lorg_eclipse_swt_internal_win32_LOGFONTA_2
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectA__Lorg_eclipse_swt_internal_win32_LOGFONTA_2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectA__Lorg_eclipse_swt_internal_win32_LOGFONTA_2)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	LOGFONTA _arg0, *lparg0=NULL;
@@ -1660,6 +1674,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectA__Lorg_eclipse_swt_inter
 	if (arg0) if ((lparg0 = getLOGFONTAFields(env, arg0, &_arg0)) == NULL) goto fail;
 	rc = (jintLong)CreateFontIndirectA(lparg0);
 fail:
+	NATIVE_RESOURCE_CREATE(env, "HFONT", rc, 0);
 	OS_NATIVE_EXIT(env, that, CreateFontIndirectA__Lorg_eclipse_swt_internal_win32_LOGFONTA_2_FUNC);
 	return rc;
 }
@@ -1667,9 +1682,9 @@ fail:
 
 #if (!defined(NO_CreateFontIndirectW__I) && !defined(JNI64)) || (!defined(NO_CreateFontIndirectW__J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectW__I)(JNIEnv *env, jclass that, jintLong arg0)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectW__I)(JNIEnv *env, jclass that, jintLong arg0)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectW__J)(JNIEnv *env, jclass that, jintLong arg0)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectW__J)(JNIEnv *env, jclass that, jintLong arg0)
 #endif
 {
 	jintLong rc = 0;
@@ -1679,6 +1694,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectW__J)(JNIEnv *env, jclass
 	OS_NATIVE_ENTER(env, that, CreateFontIndirectW__J_FUNC);
 #endif
 	rc = (jintLong)CreateFontIndirectW((LPLOGFONTW)arg0);
+	NATIVE_RESOURCE_CREATE(env, "HFONT", rc, 0);
 #ifndef JNI64
 	OS_NATIVE_EXIT(env, that, CreateFontIndirectW__I_FUNC);
 #else
@@ -1689,7 +1705,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectW__J)(JNIEnv *env, jclass
 #endif
 
 #ifndef NO_CreateFontIndirectW__Lorg_eclipse_swt_internal_win32_LOGFONTW_2
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectW__Lorg_eclipse_swt_internal_win32_LOGFONTW_2)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectW__Lorg_eclipse_swt_internal_win32_LOGFONTW_2)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	LOGFONTW _arg0, *lparg0=NULL;
@@ -1698,13 +1714,14 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CreateFontIndirectW__Lorg_eclipse_swt_inter
 	if (arg0) if ((lparg0 = getLOGFONTWFields(env, arg0, &_arg0)) == NULL) goto fail;
 	rc = (jintLong)CreateFontIndirectW(lparg0);
 fail:
+	NATIVE_RESOURCE_CREATE(env, "HFONT", rc, 0);
 	OS_NATIVE_EXIT(env, that, CreateFontIndirectW__Lorg_eclipse_swt_internal_win32_LOGFONTW_2_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_CreateIconIndirect
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateIconIndirect)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateIconIndirect)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	ICONINFO _arg0, *lparg0=NULL;
@@ -1719,7 +1736,7 @@ fail:
 #endif
 
 #ifndef NO_CreateMenu
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateMenu)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateMenu)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -1731,7 +1748,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CreateMenu)
 #endif
 
 #ifndef NO_CreatePalette
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreatePalette)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreatePalette)
 	(JNIEnv *env, jclass that, jbyteArray arg0)
 {
 	jbyte *lparg0=NULL;
@@ -1761,47 +1778,64 @@ fail:
 #endif
 
 #ifndef NO_CreatePatternBrush
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreatePatternBrush)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreatePatternBrush)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
 	OS_NATIVE_ENTER(env, that, CreatePatternBrush_FUNC);
 	rc = (jintLong)CreatePatternBrush((HBITMAP)arg0);
+	NATIVE_RESOURCE_CREATE(env, "HBRUSH", rc, 0);
 	OS_NATIVE_EXIT(env, that, CreatePatternBrush_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_CreatePen
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreatePen)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreatePen)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	jintLong rc = 0;
 	OS_NATIVE_ENTER(env, that, CreatePen_FUNC);
 	rc = (jintLong)CreatePen(arg0, arg1, (COLORREF)arg2);
+	NATIVE_RESOURCE_CREATE(env, "HPEN", rc, 0);
 	OS_NATIVE_EXIT(env, that, CreatePen_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_CreatePolygonRgn
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreatePolygonRgn)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreatePolygonRgn)
 	(JNIEnv *env, jclass that, jintArray arg0, jint arg1, jint arg2)
 {
 	jint *lparg0=NULL;
 	jintLong rc = 0;
 	OS_NATIVE_ENTER(env, that, CreatePolygonRgn_FUNC);
-	if (arg0) if ((lparg0 = (*env)->GetIntArrayElements(env, arg0, NULL)) == NULL) goto fail;
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (arg0) if ((lparg0 = (*env)->GetPrimitiveArrayCritical(env, arg0, NULL)) == NULL) goto fail;
+	} else
+#endif
+	{
+		if (arg0) if ((lparg0 = (*env)->GetIntArrayElements(env, arg0, NULL)) == NULL) goto fail;
+	}
 	rc = (jintLong)CreatePolygonRgn((CONST POINT *)lparg0, arg1, arg2);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseIntArrayElements(env, arg0, lparg0, 0);
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (arg0 && lparg0) (*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, JNI_ABORT);
+	} else
+#endif
+	{
+		if (arg0 && lparg0) (*env)->ReleaseIntArrayElements(env, arg0, lparg0, JNI_ABORT);
+	}
+	NATIVE_RESOURCE_CREATE(env, "HRGN", rc, 0);
 	OS_NATIVE_EXIT(env, that, CreatePolygonRgn_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_CreatePopupMenu
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreatePopupMenu)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreatePopupMenu)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -1813,7 +1847,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(CreatePopupMenu)
 #endif
 
 #ifndef NO_CreateProcessA
-JNIEXPORT jboolean JNICALL OS_NATIVE(CreateProcessA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(CreateProcessA)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jboolean arg4, jint arg5, jintLong arg6, jintLong arg7, jobject arg8, jobject arg9)
 {
 	STARTUPINFO _arg8, *lparg8=NULL;
@@ -1832,7 +1866,7 @@ fail:
 #endif
 
 #ifndef NO_CreateProcessW
-JNIEXPORT jboolean JNICALL OS_NATIVE(CreateProcessW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(CreateProcessW)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jboolean arg4, jint arg5, jintLong arg6, jintLong arg7, jobject arg8, jobject arg9)
 {
 	STARTUPINFO _arg8, *lparg8=NULL;
@@ -1851,31 +1885,33 @@ fail:
 #endif
 
 #ifndef NO_CreateRectRgn
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateRectRgn)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateRectRgn)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3)
 {
 	jintLong rc = 0;
 	OS_NATIVE_ENTER(env, that, CreateRectRgn_FUNC);
 	rc = (jintLong)CreateRectRgn(arg0, arg1, arg2, arg3);
+	NATIVE_RESOURCE_CREATE(env, "HRGN", rc, 0);
 	OS_NATIVE_EXIT(env, that, CreateRectRgn_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_CreateSolidBrush
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateSolidBrush)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateSolidBrush)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
 	OS_NATIVE_ENTER(env, that, CreateSolidBrush_FUNC);
 	rc = (jintLong)CreateSolidBrush((COLORREF)arg0);
+	NATIVE_RESOURCE_CREATE(env, "HBRUSH", rc, 0);
 	OS_NATIVE_EXIT(env, that, CreateSolidBrush_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_CreateStreamOnHGlobal
-JNIEXPORT jint JNICALL OS_NATIVE(CreateStreamOnHGlobal)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(CreateStreamOnHGlobal)
 	(JNIEnv *env, jclass that, jintLong arg0, jboolean arg1, jintLongArray arg2)
 {
 	jintLong *lparg2=NULL;
@@ -1891,7 +1927,7 @@ fail:
 #endif
 
 #ifndef NO_CreateWindowExA
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateWindowExA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateWindowExA)
 	(JNIEnv *env, jclass that, jint arg0, jbyteArray arg1, jbyteArray arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jintLong arg8, jintLong arg9, jintLong arg10, jobject arg11)
 {
 	jbyte *lparg1=NULL;
@@ -1913,7 +1949,7 @@ fail:
 #endif
 
 #ifndef NO_CreateWindowExW
-JNIEXPORT jintLong JNICALL OS_NATIVE(CreateWindowExW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(CreateWindowExW)
 	(JNIEnv *env, jclass that, jint arg0, jcharArray arg1, jcharArray arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jintLong arg8, jintLong arg9, jintLong arg10, jobject arg11)
 {
 	jchar *lparg1=NULL;
@@ -1935,7 +1971,7 @@ fail:
 #endif
 
 #ifndef NO_DEVMODEA_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(DEVMODEA_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DEVMODEA_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -1947,7 +1983,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DEVMODEA_1sizeof)
 #endif
 
 #ifndef NO_DEVMODEW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(DEVMODEW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DEVMODEW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -1959,7 +1995,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DEVMODEW_1sizeof)
 #endif
 
 #ifndef NO_DIBSECTION_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(DIBSECTION_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DIBSECTION_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -1971,7 +2007,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DIBSECTION_1sizeof)
 #endif
 
 #ifndef NO_DLLVERSIONINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(DLLVERSIONINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DLLVERSIONINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -1983,7 +2019,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DLLVERSIONINFO_1sizeof)
 #endif
 
 #ifndef NO_DOCHOSTUIINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(DOCHOSTUIINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DOCHOSTUIINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -1995,7 +2031,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DOCHOSTUIINFO_1sizeof)
 #endif
 
 #ifndef NO_DOCINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(DOCINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DOCINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -2007,7 +2043,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DOCINFO_1sizeof)
 #endif
 
 #ifndef NO_DPtoLP
-JNIEXPORT jboolean JNICALL OS_NATIVE(DPtoLP)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DPtoLP)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 {
 	POINT _arg1, *lparg1=NULL;
@@ -2023,7 +2059,7 @@ fail:
 #endif
 
 #ifndef NO_DRAWITEMSTRUCT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(DRAWITEMSTRUCT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DRAWITEMSTRUCT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -2035,7 +2071,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DRAWITEMSTRUCT_1sizeof)
 #endif
 
 #ifndef NO_DROPFILES_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(DROPFILES_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DROPFILES_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -2047,7 +2083,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DROPFILES_1sizeof)
 #endif
 
 #ifndef NO_DTTOPTS_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(DTTOPTS_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DTTOPTS_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -2059,7 +2095,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DTTOPTS_1sizeof)
 #endif
 
 #ifndef NO_DWM_1BLURBEHIND_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(DWM_1BLURBEHIND_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DWM_1BLURBEHIND_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -2071,7 +2107,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DWM_1BLURBEHIND_1sizeof)
 #endif
 
 #ifndef NO_DefFrameProcA
-JNIEXPORT jintLong JNICALL OS_NATIVE(DefFrameProcA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(DefFrameProcA)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLong arg3, jintLong arg4)
 {
 	jintLong rc = 0;
@@ -2083,7 +2119,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(DefFrameProcA)
 #endif
 
 #ifndef NO_DefFrameProcW
-JNIEXPORT jintLong JNICALL OS_NATIVE(DefFrameProcW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(DefFrameProcW)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLong arg3, jintLong arg4)
 {
 	jintLong rc = 0;
@@ -2095,7 +2131,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(DefFrameProcW)
 #endif
 
 #ifndef NO_DefMDIChildProcA
-JNIEXPORT jintLong JNICALL OS_NATIVE(DefMDIChildProcA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(DefMDIChildProcA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
 {
 	jintLong rc = 0;
@@ -2107,7 +2143,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(DefMDIChildProcA)
 #endif
 
 #ifndef NO_DefMDIChildProcW
-JNIEXPORT jintLong JNICALL OS_NATIVE(DefMDIChildProcW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(DefMDIChildProcW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
 {
 	jintLong rc = 0;
@@ -2119,7 +2155,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(DefMDIChildProcW)
 #endif
 
 #ifndef NO_DefWindowProcA
-JNIEXPORT jintLong JNICALL OS_NATIVE(DefWindowProcA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(DefWindowProcA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
 {
 	jintLong rc = 0;
@@ -2131,7 +2167,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(DefWindowProcA)
 #endif
 
 #ifndef NO_DefWindowProcW
-JNIEXPORT jintLong JNICALL OS_NATIVE(DefWindowProcW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(DefWindowProcW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
 {
 	jintLong rc = 0;
@@ -2143,7 +2179,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(DefWindowProcW)
 #endif
 
 #ifndef NO_DeferWindowPos
-JNIEXPORT jintLong JNICALL OS_NATIVE(DeferWindowPos)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(DeferWindowPos)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7)
 {
 	jintLong rc = 0;
@@ -2155,11 +2191,12 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(DeferWindowPos)
 #endif
 
 #ifndef NO_DeleteDC
-JNIEXPORT jboolean JNICALL OS_NATIVE(DeleteDC)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DeleteDC)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, DeleteDC_FUNC);
+	NATIVE_RESOURCE_DESTROY(env, arg0);
 	rc = (jboolean)DeleteDC((HDC)arg0);
 	OS_NATIVE_EXIT(env, that, DeleteDC_FUNC);
 	return rc;
@@ -2167,7 +2204,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DeleteDC)
 #endif
 
 #ifndef NO_DeleteEnhMetaFile
-JNIEXPORT jboolean JNICALL OS_NATIVE(DeleteEnhMetaFile)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DeleteEnhMetaFile)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -2179,7 +2216,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DeleteEnhMetaFile)
 #endif
 
 #ifndef NO_DeleteMenu
-JNIEXPORT jboolean JNICALL OS_NATIVE(DeleteMenu)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DeleteMenu)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jboolean rc = 0;
@@ -2191,11 +2228,12 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DeleteMenu)
 #endif
 
 #ifndef NO_DeleteObject
-JNIEXPORT jboolean JNICALL OS_NATIVE(DeleteObject)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DeleteObject)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, DeleteObject_FUNC);
+	NATIVE_RESOURCE_DESTROY(env, arg0);
 	rc = (jboolean)DeleteObject((HGDIOBJ)arg0);
 	OS_NATIVE_EXIT(env, that, DeleteObject_FUNC);
 	return rc;
@@ -2203,7 +2241,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DeleteObject)
 #endif
 
 #ifndef NO_DestroyAcceleratorTable
-JNIEXPORT jboolean JNICALL OS_NATIVE(DestroyAcceleratorTable)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DestroyAcceleratorTable)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -2215,7 +2253,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DestroyAcceleratorTable)
 #endif
 
 #ifndef NO_DestroyCaret
-JNIEXPORT jboolean JNICALL OS_NATIVE(DestroyCaret)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DestroyCaret)
 	(JNIEnv *env, jclass that)
 {
 	jboolean rc = 0;
@@ -2227,7 +2265,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DestroyCaret)
 #endif
 
 #ifndef NO_DestroyCursor
-JNIEXPORT jboolean JNICALL OS_NATIVE(DestroyCursor)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DestroyCursor)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -2239,7 +2277,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DestroyCursor)
 #endif
 
 #ifndef NO_DestroyIcon
-JNIEXPORT jboolean JNICALL OS_NATIVE(DestroyIcon)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DestroyIcon)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -2251,7 +2289,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DestroyIcon)
 #endif
 
 #ifndef NO_DestroyMenu
-JNIEXPORT jboolean JNICALL OS_NATIVE(DestroyMenu)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DestroyMenu)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -2263,7 +2301,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DestroyMenu)
 #endif
 
 #ifndef NO_DestroyWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(DestroyWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DestroyWindow)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -2275,7 +2313,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DestroyWindow)
 #endif
 
 #ifndef NO_DispatchMessageA
-JNIEXPORT jintLong JNICALL OS_NATIVE(DispatchMessageA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(DispatchMessageA)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	MSG _arg0, *lparg0=NULL;
@@ -2291,7 +2329,7 @@ fail:
 #endif
 
 #ifndef NO_DispatchMessageW
-JNIEXPORT jintLong JNICALL OS_NATIVE(DispatchMessageW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(DispatchMessageW)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	MSG _arg0, *lparg0=NULL;
@@ -2307,7 +2345,7 @@ fail:
 #endif
 
 #ifndef NO_DocumentPropertiesA
-JNIEXPORT jint JNICALL OS_NATIVE(DocumentPropertiesA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DocumentPropertiesA)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jbyteArray arg2, jintLong arg3, jintLong arg4, jint arg5)
 {
 	jbyte *lparg2=NULL;
@@ -2323,7 +2361,7 @@ fail:
 #endif
 
 #ifndef NO_DocumentPropertiesW
-JNIEXPORT jint JNICALL OS_NATIVE(DocumentPropertiesW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DocumentPropertiesW)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jcharArray arg2, jintLong arg3, jintLong arg4, jint arg5)
 {
 	jchar *lparg2=NULL;
@@ -2339,7 +2377,7 @@ fail:
 #endif
 
 #ifndef NO_DragDetect
-JNIEXPORT jboolean JNICALL OS_NATIVE(DragDetect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DragDetect)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	POINT _arg1, *lparg1=NULL;
@@ -2355,7 +2393,7 @@ fail:
 #endif
 
 #ifndef NO_DragFinish
-JNIEXPORT void JNICALL OS_NATIVE(DragFinish)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(DragFinish)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	OS_NATIVE_ENTER(env, that, DragFinish_FUNC);
@@ -2365,7 +2403,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DragFinish)
 #endif
 
 #ifndef NO_DragQueryFileA
-JNIEXPORT jint JNICALL OS_NATIVE(DragQueryFileA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DragQueryFileA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jbyteArray arg2, jint arg3)
 {
 	jbyte *lparg2=NULL;
@@ -2381,7 +2419,7 @@ fail:
 #endif
 
 #ifndef NO_DragQueryFileW
-JNIEXPORT jint JNICALL OS_NATIVE(DragQueryFileW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DragQueryFileW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jcharArray arg2, jint arg3)
 {
 	jchar *lparg2=NULL;
@@ -2397,7 +2435,7 @@ fail:
 #endif
 
 #ifndef NO_DrawAnimatedRects
-JNIEXPORT jboolean JNICALL OS_NATIVE(DrawAnimatedRects)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DrawAnimatedRects)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2, jobject arg3)
 {
 	RECT _arg2, *lparg2=NULL;
@@ -2416,7 +2454,7 @@ fail:
 #endif
 
 #ifndef NO_DrawEdge
-JNIEXPORT jboolean JNICALL OS_NATIVE(DrawEdge)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DrawEdge)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2, jint arg3)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -2432,7 +2470,7 @@ fail:
 #endif
 
 #ifndef NO_DrawFocusRect
-JNIEXPORT jboolean JNICALL OS_NATIVE(DrawFocusRect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DrawFocusRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -2448,7 +2486,7 @@ fail:
 #endif
 
 #ifndef NO_DrawFrameControl
-JNIEXPORT jboolean JNICALL OS_NATIVE(DrawFrameControl)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DrawFrameControl)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2, jint arg3)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -2464,7 +2502,7 @@ fail:
 #endif
 
 #ifndef NO_DrawIconEx
-JNIEXPORT jboolean JNICALL OS_NATIVE(DrawIconEx)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DrawIconEx)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jintLong arg3, jint arg4, jint arg5, jint arg6, jintLong arg7, jint arg8)
 {
 	jboolean rc = 0;
@@ -2476,7 +2514,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DrawIconEx)
 #endif
 
 #ifndef NO_DrawMenuBar
-JNIEXPORT jboolean JNICALL OS_NATIVE(DrawMenuBar)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DrawMenuBar)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -2488,7 +2526,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DrawMenuBar)
 #endif
 
 #ifndef NO_DrawStateA
-JNIEXPORT jboolean JNICALL OS_NATIVE(DrawStateA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DrawStateA)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jint arg5, jint arg6, jint arg7, jint arg8, jint arg9)
 {
 	jboolean rc = 0;
@@ -2500,7 +2538,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DrawStateA)
 #endif
 
 #ifndef NO_DrawStateW
-JNIEXPORT jboolean JNICALL OS_NATIVE(DrawStateW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DrawStateW)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jintLong arg4, jint arg5, jint arg6, jint arg7, jint arg8, jint arg9)
 {
 	jboolean rc = 0;
@@ -2512,7 +2550,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DrawStateW)
 #endif
 
 #ifndef NO_DrawTextA
-JNIEXPORT jint JNICALL OS_NATIVE(DrawTextA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DrawTextA)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jobject arg3, jint arg4)
 {
 	jbyte *lparg1=NULL;
@@ -2545,7 +2583,7 @@ fail:
 #endif
 
 #ifndef NO_DrawTextW
-JNIEXPORT jint JNICALL OS_NATIVE(DrawTextW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DrawTextW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jobject arg3, jint arg4)
 {
 	jchar *lparg1=NULL;
@@ -2578,7 +2616,7 @@ fail:
 #endif
 
 #ifndef NO_DrawThemeBackground
-JNIEXPORT jint JNICALL OS_NATIVE(DrawThemeBackground)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DrawThemeBackground)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jobject arg4, jobject arg5)
 {
 	RECT _arg4, *lparg4=NULL;
@@ -2597,15 +2635,13 @@ JNIEXPORT jint JNICALL OS_NATIVE(DrawThemeBackground)
 		}
 	}
 fail:
-	if (arg5 && lparg5) setRECTFields(env, arg5, lparg5);
-	if (arg4 && lparg4) setRECTFields(env, arg4, lparg4);
 	OS_NATIVE_EXIT(env, that, DrawThemeBackground_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_DrawThemeEdge
-JNIEXPORT jint JNICALL OS_NATIVE(DrawThemeEdge)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DrawThemeEdge)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jobject arg4, jint arg5, jint arg6, jobject arg7)
 {
 	RECT _arg4, *lparg4=NULL;
@@ -2632,7 +2668,7 @@ fail:
 #endif
 
 #ifndef NO_DrawThemeIcon
-JNIEXPORT jint JNICALL OS_NATIVE(DrawThemeIcon)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DrawThemeIcon)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jobject arg4, jintLong arg5, jint arg6)
 {
 	RECT _arg4, *lparg4=NULL;
@@ -2656,7 +2692,7 @@ fail:
 #endif
 
 #ifndef NO_DrawThemeParentBackground
-JNIEXPORT jint JNICALL OS_NATIVE(DrawThemeParentBackground)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DrawThemeParentBackground)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 {
 	RECT _arg2, *lparg2=NULL;
@@ -2680,7 +2716,7 @@ fail:
 #endif
 
 #ifndef NO_DrawThemeText
-JNIEXPORT jint JNICALL OS_NATIVE(DrawThemeText)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DrawThemeText)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jcharArray arg4, jint arg5, jint arg6, jint arg7, jobject arg8)
 {
 	jchar *lparg4=NULL;
@@ -2707,7 +2743,7 @@ fail:
 #endif
 
 #ifndef NO_DrawThemeTextEx
-JNIEXPORT jint JNICALL OS_NATIVE(DrawThemeTextEx)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DrawThemeTextEx)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jcharArray arg4, jint arg5, jint arg6, jobject arg7, jobject arg8)
 {
 	jchar *lparg4=NULL;
@@ -2737,7 +2773,7 @@ fail:
 #endif
 
 #ifndef NO_DuplicateHandle
-JNIEXPORT jboolean JNICALL OS_NATIVE(DuplicateHandle)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(DuplicateHandle)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLongArray arg3, jint arg4, jboolean arg5, jint arg6)
 {
 	jintLong *lparg3=NULL;
@@ -2753,7 +2789,7 @@ fail:
 #endif
 
 #ifndef NO_DwmEnableBlurBehindWindow
-JNIEXPORT jint JNICALL OS_NATIVE(DwmEnableBlurBehindWindow)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DwmEnableBlurBehindWindow)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	DWM_BLURBEHIND _arg1, *lparg1=NULL;
@@ -2777,7 +2813,7 @@ fail:
 #endif
 
 #ifndef NO_DwmExtendFrameIntoClientArea
-JNIEXPORT jint JNICALL OS_NATIVE(DwmExtendFrameIntoClientArea)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DwmExtendFrameIntoClientArea)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	MARGINS _arg1, *lparg1=NULL;
@@ -2801,7 +2837,7 @@ fail:
 #endif
 
 #ifndef NO_DwmIsCompositionEnabled
-JNIEXPORT jint JNICALL OS_NATIVE(DwmIsCompositionEnabled)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(DwmIsCompositionEnabled)
 	(JNIEnv *env, jclass that, jbooleanArray arg0)
 {
 	jboolean *lparg0=NULL;
@@ -2825,7 +2861,7 @@ fail:
 #endif
 
 #ifndef NO_EMREXTCREATEFONTINDIRECTW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(EMREXTCREATEFONTINDIRECTW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(EMREXTCREATEFONTINDIRECTW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -2837,7 +2873,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(EMREXTCREATEFONTINDIRECTW_1sizeof)
 #endif
 
 #ifndef NO_EMR_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(EMR_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(EMR_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -2849,7 +2885,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(EMR_1sizeof)
 #endif
 
 #ifndef NO_EXTLOGFONTW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(EXTLOGFONTW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(EXTLOGFONTW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -2861,7 +2897,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(EXTLOGFONTW_1sizeof)
 #endif
 
 #ifndef NO_EXTLOGPEN_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(EXTLOGPEN_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(EXTLOGPEN_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -2873,7 +2909,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(EXTLOGPEN_1sizeof)
 #endif
 
 #ifndef NO_Ellipse
-JNIEXPORT jboolean JNICALL OS_NATIVE(Ellipse)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(Ellipse)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4)
 {
 	jboolean rc = 0;
@@ -2885,7 +2921,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Ellipse)
 #endif
 
 #ifndef NO_EnableMenuItem
-JNIEXPORT jboolean JNICALL OS_NATIVE(EnableMenuItem)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(EnableMenuItem)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jboolean rc = 0;
@@ -2897,7 +2933,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(EnableMenuItem)
 #endif
 
 #ifndef NO_EnableScrollBar
-JNIEXPORT jboolean JNICALL OS_NATIVE(EnableScrollBar)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(EnableScrollBar)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jboolean rc = 0;
@@ -2909,7 +2945,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(EnableScrollBar)
 #endif
 
 #ifndef NO_EnableWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(EnableWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(EnableWindow)
 	(JNIEnv *env, jclass that, jintLong arg0, jboolean arg1)
 {
 	jboolean rc = 0;
@@ -2921,7 +2957,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(EnableWindow)
 #endif
 
 #ifndef NO_EndBufferedPaint
-JNIEXPORT jint JNICALL OS_NATIVE(EndBufferedPaint)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(EndBufferedPaint)
 	(JNIEnv *env, jclass that, jintLong arg0, jboolean arg1)
 {
 	jint rc = 0;
@@ -2941,7 +2977,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(EndBufferedPaint)
 #endif
 
 #ifndef NO_EndDeferWindowPos
-JNIEXPORT jboolean JNICALL OS_NATIVE(EndDeferWindowPos)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(EndDeferWindowPos)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -2953,7 +2989,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(EndDeferWindowPos)
 #endif
 
 #ifndef NO_EndDoc
-JNIEXPORT jint JNICALL OS_NATIVE(EndDoc)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(EndDoc)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -2965,7 +3001,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(EndDoc)
 #endif
 
 #ifndef NO_EndPage
-JNIEXPORT jint JNICALL OS_NATIVE(EndPage)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(EndPage)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -2977,7 +3013,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(EndPage)
 #endif
 
 #ifndef NO_EndPaint
-JNIEXPORT jint JNICALL OS_NATIVE(EndPaint)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(EndPaint)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	PAINTSTRUCT _arg1, *lparg1=NULL;
@@ -2993,7 +3029,7 @@ fail:
 #endif
 
 #ifndef NO_EndPath
-JNIEXPORT jboolean JNICALL OS_NATIVE(EndPath)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(EndPath)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -3005,7 +3041,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(EndPath)
 #endif
 
 #ifndef NO_EnumDisplayMonitors
-JNIEXPORT jboolean JNICALL OS_NATIVE(EnumDisplayMonitors)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(EnumDisplayMonitors)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2, jint arg3)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -3022,14 +3058,13 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(EnumDisplayMonitors)
 		}
 	}
 fail:
-	if (arg1 && lparg1) setRECTFields(env, arg1, lparg1);
 	OS_NATIVE_EXIT(env, that, EnumDisplayMonitors_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_EnumEnhMetaFile
-JNIEXPORT jboolean JNICALL OS_NATIVE(EnumEnhMetaFile)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(EnumEnhMetaFile)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jintLong arg3, jobject arg4)
 {
 	RECT _arg4, *lparg4=NULL;
@@ -3045,7 +3080,7 @@ fail:
 #endif
 
 #ifndef NO_EnumFontFamiliesA
-JNIEXPORT jint JNICALL OS_NATIVE(EnumFontFamiliesA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(EnumFontFamiliesA)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jintLong arg2, jintLong arg3)
 {
 	jbyte *lparg1=NULL;
@@ -3061,7 +3096,7 @@ fail:
 #endif
 
 #ifndef NO_EnumFontFamiliesExA
-JNIEXPORT jint JNICALL OS_NATIVE(EnumFontFamiliesExA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(EnumFontFamiliesExA)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2, jintLong arg3, jint arg4)
 {
 	LOGFONTA _arg1, *lparg1=NULL;
@@ -3077,7 +3112,7 @@ fail:
 #endif
 
 #ifndef NO_EnumFontFamiliesExW
-JNIEXPORT jint JNICALL OS_NATIVE(EnumFontFamiliesExW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(EnumFontFamiliesExW)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2, jintLong arg3, jint arg4)
 {
 	LOGFONTW _arg1, *lparg1=NULL;
@@ -3093,7 +3128,7 @@ fail:
 #endif
 
 #ifndef NO_EnumFontFamiliesW
-JNIEXPORT jint JNICALL OS_NATIVE(EnumFontFamiliesW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(EnumFontFamiliesW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jintLong arg2, jintLong arg3)
 {
 	jchar *lparg1=NULL;
@@ -3102,14 +3137,14 @@ JNIEXPORT jint JNICALL OS_NATIVE(EnumFontFamiliesW)
 	if (arg1) if ((lparg1 = (*env)->GetCharArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	rc = (jint)EnumFontFamiliesW((HDC)arg0, (LPCWSTR)lparg1, (FONTENUMPROCW)arg2, (LPARAM)arg3);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, EnumFontFamiliesW_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_EnumSystemLanguageGroupsA
-JNIEXPORT jboolean JNICALL OS_NATIVE(EnumSystemLanguageGroupsA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(EnumSystemLanguageGroupsA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
 {
 	jboolean rc = 0;
@@ -3129,7 +3164,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(EnumSystemLanguageGroupsA)
 #endif
 
 #ifndef NO_EnumSystemLanguageGroupsW
-JNIEXPORT jboolean JNICALL OS_NATIVE(EnumSystemLanguageGroupsW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(EnumSystemLanguageGroupsW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
 {
 	jboolean rc = 0;
@@ -3149,7 +3184,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(EnumSystemLanguageGroupsW)
 #endif
 
 #ifndef NO_EnumSystemLocalesA
-JNIEXPORT jboolean JNICALL OS_NATIVE(EnumSystemLocalesA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(EnumSystemLocalesA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jboolean rc = 0;
@@ -3161,7 +3196,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(EnumSystemLocalesA)
 #endif
 
 #ifndef NO_EnumSystemLocalesW
-JNIEXPORT jboolean JNICALL OS_NATIVE(EnumSystemLocalesW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(EnumSystemLocalesW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jboolean rc = 0;
@@ -3173,7 +3208,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(EnumSystemLocalesW)
 #endif
 
 #ifndef NO_EqualRect
-JNIEXPORT jboolean JNICALL OS_NATIVE(EqualRect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(EqualRect)
 	(JNIEnv *env, jclass that, jobject arg0, jobject arg1)
 {
 	RECT _arg0, *lparg0=NULL;
@@ -3190,7 +3225,7 @@ fail:
 #endif
 
 #ifndef NO_EqualRgn
-JNIEXPORT jboolean JNICALL OS_NATIVE(EqualRgn)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(EqualRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jboolean rc = 0;
@@ -3202,7 +3237,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(EqualRgn)
 #endif
 
 #ifndef NO_ExcludeClipRect
-JNIEXPORT jint JNICALL OS_NATIVE(ExcludeClipRect)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ExcludeClipRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4)
 {
 	jint rc = 0;
@@ -3214,7 +3249,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ExcludeClipRect)
 #endif
 
 #ifndef NO_ExpandEnvironmentStringsA
-JNIEXPORT jint JNICALL OS_NATIVE(ExpandEnvironmentStringsA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ExpandEnvironmentStringsA)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jbyteArray arg1, jint arg2)
 {
 	jbyte *lparg0=NULL;
@@ -3233,7 +3268,7 @@ fail:
 #endif
 
 #ifndef NO_ExpandEnvironmentStringsW
-JNIEXPORT jint JNICALL OS_NATIVE(ExpandEnvironmentStringsW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ExpandEnvironmentStringsW)
 	(JNIEnv *env, jclass that, jcharArray arg0, jcharArray arg1, jint arg2)
 {
 	jchar *lparg0=NULL;
@@ -3252,7 +3287,7 @@ fail:
 #endif
 
 #ifndef NO_ExtCreatePen
-JNIEXPORT jintLong JNICALL OS_NATIVE(ExtCreatePen)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(ExtCreatePen)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jobject arg2, jint arg3, jintArray arg4)
 {
 	LOGBRUSH _arg2, *lparg2=NULL;
@@ -3263,15 +3298,14 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(ExtCreatePen)
 	if (arg4) if ((lparg4 = (*env)->GetIntArrayElements(env, arg4, NULL)) == NULL) goto fail;
 	rc = (jintLong)ExtCreatePen(arg0, arg1, (CONST LOGBRUSH *)lparg2, arg3, (CONST DWORD *)lparg4);
 fail:
-	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
-	if (arg2 && lparg2) setLOGBRUSHFields(env, arg2, lparg2);
+	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, ExtCreatePen_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_ExtCreateRegion
-JNIEXPORT jintLong JNICALL OS_NATIVE(ExtCreateRegion)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(ExtCreateRegion)
 	(JNIEnv *env, jclass that, jfloatArray arg0, jint arg1, jintArray arg2)
 {
 	jfloat *lparg0=NULL;
@@ -3282,7 +3316,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(ExtCreateRegion)
 	if (arg2) if ((lparg2 = (*env)->GetIntArrayElements(env, arg2, NULL)) == NULL) goto fail;
 	rc = (jintLong)ExtCreateRegion((XFORM *)lparg0, arg1, (CONST RGNDATA *)lparg2);
 fail:
-	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, 0);
+	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, JNI_ABORT);
 	if (arg0 && lparg0) (*env)->ReleaseFloatArrayElements(env, arg0, lparg0, 0);
 	OS_NATIVE_EXIT(env, that, ExtCreateRegion_FUNC);
 	return rc;
@@ -3290,7 +3324,7 @@ fail:
 #endif
 
 #ifndef NO_ExtTextOutA
-JNIEXPORT jboolean JNICALL OS_NATIVE(ExtTextOutA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ExtTextOutA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jobject arg4, jbyteArray arg5, jint arg6, jintArray arg7)
 {
 	RECT _arg4, *lparg4=NULL;
@@ -3327,7 +3361,7 @@ fail:
 #endif
 
 #ifndef NO_ExtTextOutW
-JNIEXPORT jboolean JNICALL OS_NATIVE(ExtTextOutW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ExtTextOutW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jobject arg4, jcharArray arg5, jint arg6, jintArray arg7)
 {
 	RECT _arg4, *lparg4=NULL;
@@ -3364,7 +3398,7 @@ fail:
 #endif
 
 #ifndef NO_ExtractIconExA
-JNIEXPORT jint JNICALL OS_NATIVE(ExtractIconExA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ExtractIconExA)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jintLongArray arg2, jintLongArray arg3, jint arg4)
 {
 	jbyte *lparg0=NULL;
@@ -3386,7 +3420,7 @@ fail:
 #endif
 
 #ifndef NO_ExtractIconExW
-JNIEXPORT jint JNICALL OS_NATIVE(ExtractIconExW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ExtractIconExW)
 	(JNIEnv *env, jclass that, jcharArray arg0, jint arg1, jintLongArray arg2, jintLongArray arg3, jint arg4)
 {
 	jchar *lparg0=NULL;
@@ -3408,7 +3442,7 @@ fail:
 #endif
 
 #ifndef NO_FILETIME_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(FILETIME_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(FILETIME_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -3420,7 +3454,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FILETIME_1sizeof)
 #endif
 
 #ifndef NO_FLICK_1DATA_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(FLICK_1DATA_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(FLICK_1DATA_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -3432,7 +3466,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FLICK_1DATA_1sizeof)
 #endif
 
 #ifndef NO_FLICK_1POINT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(FLICK_1POINT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(FLICK_1POINT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -3444,7 +3478,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FLICK_1POINT_1sizeof)
 #endif
 
 #ifndef NO_FileTimeToSystemTime
-JNIEXPORT jboolean JNICALL OS_NATIVE(FileTimeToSystemTime)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(FileTimeToSystemTime)
 	(JNIEnv *env, jclass that, jobject arg0, jobject arg1)
 {
 	FILETIME _arg0, *lparg0=NULL;
@@ -3463,7 +3497,7 @@ fail:
 #endif
 
 #ifndef NO_FillPath
-JNIEXPORT jboolean JNICALL OS_NATIVE(FillPath)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(FillPath)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -3475,7 +3509,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(FillPath)
 #endif
 
 #ifndef NO_FillRect
-JNIEXPORT jint JNICALL OS_NATIVE(FillRect)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(FillRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -3490,7 +3524,7 @@ fail:
 #endif
 
 #ifndef NO_FindWindowA
-JNIEXPORT jintLong JNICALL OS_NATIVE(FindWindowA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(FindWindowA)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jbyteArray arg1)
 {
 	jbyte *lparg0=NULL;
@@ -3509,7 +3543,7 @@ fail:
 #endif
 
 #ifndef NO_FindWindowW
-JNIEXPORT jintLong JNICALL OS_NATIVE(FindWindowW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(FindWindowW)
 	(JNIEnv *env, jclass that, jcharArray arg0, jcharArray arg1)
 {
 	jchar *lparg0=NULL;
@@ -3528,7 +3562,7 @@ fail:
 #endif
 
 #ifndef NO_FormatMessageA
-JNIEXPORT jint JNICALL OS_NATIVE(FormatMessageA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(FormatMessageA)
 	(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3, jintLongArray arg4, jint arg5, jintLong arg6)
 {
 	jintLong *lparg4=NULL;
@@ -3544,7 +3578,7 @@ fail:
 #endif
 
 #ifndef NO_FormatMessageW
-JNIEXPORT jint JNICALL OS_NATIVE(FormatMessageW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(FormatMessageW)
 	(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3, jintLongArray arg4, jint arg5, jintLong arg6)
 {
 	jintLong *lparg4=NULL;
@@ -3560,7 +3594,7 @@ fail:
 #endif
 
 #ifndef NO_FreeLibrary
-JNIEXPORT jboolean JNICALL OS_NATIVE(FreeLibrary)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(FreeLibrary)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -3572,7 +3606,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(FreeLibrary)
 #endif
 
 #ifndef NO_GCP_1RESULTS_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(GCP_1RESULTS_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GCP_1RESULTS_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -3584,7 +3618,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GCP_1RESULTS_1sizeof)
 #endif
 
 #ifndef NO_GESTURECONFIG_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(GESTURECONFIG_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GESTURECONFIG_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -3596,7 +3630,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GESTURECONFIG_1sizeof)
 #endif
 
 #ifndef NO_GESTUREINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(GESTUREINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GESTUREINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -3608,7 +3642,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GESTUREINFO_1sizeof)
 #endif
 
 #ifndef NO_GET_1WHEEL_1DELTA_1WPARAM
-JNIEXPORT jint JNICALL OS_NATIVE(GET_1WHEEL_1DELTA_1WPARAM)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GET_1WHEEL_1DELTA_1WPARAM)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -3620,7 +3654,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GET_1WHEEL_1DELTA_1WPARAM)
 #endif
 
 #ifndef NO_GET_1X_1LPARAM
-JNIEXPORT jint JNICALL OS_NATIVE(GET_1X_1LPARAM)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GET_1X_1LPARAM)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -3632,7 +3666,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GET_1X_1LPARAM)
 #endif
 
 #ifndef NO_GET_1Y_1LPARAM
-JNIEXPORT jint JNICALL OS_NATIVE(GET_1Y_1LPARAM)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GET_1Y_1LPARAM)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -3644,7 +3678,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GET_1Y_1LPARAM)
 #endif
 
 #ifndef NO_GID_1ROTATE_1ANGLE_1FROM_1ARGUMENT
-JNIEXPORT jdouble JNICALL OS_NATIVE(GID_1ROTATE_1ANGLE_1FROM_1ARGUMENT)
+SWT_NATIVE_EXPORT jdouble JNICALL OS_NATIVE(GID_1ROTATE_1ANGLE_1FROM_1ARGUMENT)
 	(JNIEnv *env, jclass that, jlong arg0)
 {
 	jdouble rc = 0;
@@ -3656,7 +3690,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(GID_1ROTATE_1ANGLE_1FROM_1ARGUMENT)
 #endif
 
 #ifndef NO_GRADIENT_1RECT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(GRADIENT_1RECT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GRADIENT_1RECT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -3668,7 +3702,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GRADIENT_1RECT_1sizeof)
 #endif
 
 #ifndef NO_GUITHREADINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(GUITHREADINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GUITHREADINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -3680,7 +3714,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GUITHREADINFO_1sizeof)
 #endif
 
 #ifndef NO_GdiSetBatchLimit
-JNIEXPORT jint JNICALL OS_NATIVE(GdiSetBatchLimit)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GdiSetBatchLimit)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jint rc = 0;
@@ -3692,7 +3726,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GdiSetBatchLimit)
 #endif
 
 #ifndef NO_GetACP
-JNIEXPORT jint JNICALL OS_NATIVE(GetACP)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetACP)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -3704,7 +3738,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetACP)
 #endif
 
 #ifndef NO_GetActiveWindow
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetActiveWindow)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetActiveWindow)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3716,7 +3750,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetActiveWindow)
 #endif
 
 #ifndef NO_GetAsyncKeyState
-JNIEXPORT jshort JNICALL OS_NATIVE(GetAsyncKeyState)
+SWT_NATIVE_EXPORT jshort JNICALL OS_NATIVE(GetAsyncKeyState)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jshort rc = 0;
@@ -3728,7 +3762,7 @@ JNIEXPORT jshort JNICALL OS_NATIVE(GetAsyncKeyState)
 #endif
 
 #ifndef NO_GetBkColor
-JNIEXPORT jint JNICALL OS_NATIVE(GetBkColor)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetBkColor)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -3740,7 +3774,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetBkColor)
 #endif
 
 #ifndef NO_GetCapture
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetCapture)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetCapture)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -3752,7 +3786,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetCapture)
 #endif
 
 #ifndef NO_GetCaretPos
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetCaretPos)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetCaretPos)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	POINT _arg0, *lparg0=NULL;
@@ -3768,7 +3802,7 @@ fail:
 #endif
 
 #ifndef NO_GetCharABCWidthsA
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetCharABCWidthsA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetCharABCWidthsA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jintArray arg3)
 {
 	jint *lparg3=NULL;
@@ -3798,7 +3832,7 @@ fail:
 #endif
 
 #ifndef NO_GetCharABCWidthsW
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetCharABCWidthsW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetCharABCWidthsW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jintArray arg3)
 {
 	jint *lparg3=NULL;
@@ -3828,7 +3862,7 @@ fail:
 #endif
 
 #ifndef NO_GetCharWidthA
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetCharWidthA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetCharWidthA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jintArray arg3)
 {
 	jint *lparg3=NULL;
@@ -3858,7 +3892,7 @@ fail:
 #endif
 
 #ifndef NO_GetCharWidthW
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetCharWidthW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetCharWidthW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jintArray arg3)
 {
 	jint *lparg3=NULL;
@@ -3888,7 +3922,7 @@ fail:
 #endif
 
 #ifndef NO_GetCharacterPlacementA
-JNIEXPORT jint JNICALL OS_NATIVE(GetCharacterPlacementA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetCharacterPlacementA)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jint arg3, jobject arg4, jint arg5)
 {
 	jbyte *lparg1=NULL;
@@ -3921,7 +3955,7 @@ fail:
 #endif
 
 #ifndef NO_GetCharacterPlacementW
-JNIEXPORT jint JNICALL OS_NATIVE(GetCharacterPlacementW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetCharacterPlacementW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jint arg3, jobject arg4, jint arg5)
 {
 	jchar *lparg1=NULL;
@@ -3954,7 +3988,7 @@ fail:
 #endif
 
 #ifndef NO_GetClassInfoA
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetClassInfoA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetClassInfoA)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jobject arg2)
 {
 	jbyte *lparg1=NULL;
@@ -3973,7 +4007,7 @@ fail:
 #endif
 
 #ifndef NO_GetClassInfoW
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetClassInfoW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetClassInfoW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jobject arg2)
 {
 	jchar *lparg1=NULL;
@@ -3992,7 +4026,7 @@ fail:
 #endif
 
 #ifndef NO_GetClassNameA
-JNIEXPORT jint JNICALL OS_NATIVE(GetClassNameA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetClassNameA)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2)
 {
 	jbyte *lparg1=NULL;
@@ -4008,7 +4042,7 @@ fail:
 #endif
 
 #ifndef NO_GetClassNameW
-JNIEXPORT jint JNICALL OS_NATIVE(GetClassNameW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetClassNameW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2)
 {
 	jchar *lparg1=NULL;
@@ -4024,7 +4058,7 @@ fail:
 #endif
 
 #ifndef NO_GetClientRect
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetClientRect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetClientRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -4040,7 +4074,7 @@ fail:
 #endif
 
 #ifndef NO_GetClipBox
-JNIEXPORT jint JNICALL OS_NATIVE(GetClipBox)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetClipBox)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -4056,7 +4090,7 @@ fail:
 #endif
 
 #ifndef NO_GetClipRgn
-JNIEXPORT jint JNICALL OS_NATIVE(GetClipRgn)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetClipRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jint rc = 0;
@@ -4068,7 +4102,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetClipRgn)
 #endif
 
 #ifndef NO_GetClipboardData
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetClipboardData)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetClipboardData)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -4080,7 +4114,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetClipboardData)
 #endif
 
 #ifndef NO_GetClipboardFormatNameA
-JNIEXPORT jint JNICALL OS_NATIVE(GetClipboardFormatNameA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetClipboardFormatNameA)
 	(JNIEnv *env, jclass that, jint arg0, jbyteArray arg1, jint arg2)
 {
 	jbyte *lparg1=NULL;
@@ -4096,7 +4130,7 @@ fail:
 #endif
 
 #ifndef NO_GetClipboardFormatNameW
-JNIEXPORT jint JNICALL OS_NATIVE(GetClipboardFormatNameW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetClipboardFormatNameW)
 	(JNIEnv *env, jclass that, jint arg0, jcharArray arg1, jint arg2)
 {
 	jchar *lparg1=NULL;
@@ -4112,7 +4146,7 @@ fail:
 #endif
 
 #ifndef NO_GetComboBoxInfo
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetComboBoxInfo)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetComboBoxInfo)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	COMBOBOXINFO _arg1, *lparg1=NULL;
@@ -4136,7 +4170,7 @@ fail:
 #endif
 
 #ifndef NO_GetCurrentObject
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetCurrentObject)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetCurrentObject)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jintLong rc = 0;
@@ -4148,7 +4182,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetCurrentObject)
 #endif
 
 #ifndef NO_GetCurrentProcess
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetCurrentProcess)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetCurrentProcess)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4160,7 +4194,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetCurrentProcess)
 #endif
 
 #ifndef NO_GetCurrentProcessExplicitAppUserModelID
-JNIEXPORT jint JNICALL OS_NATIVE(GetCurrentProcessExplicitAppUserModelID)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetCurrentProcessExplicitAppUserModelID)
 	(JNIEnv *env, jclass that, jintLongArray arg0)
 {
 	jintLong *lparg0=NULL;
@@ -4184,7 +4218,7 @@ fail:
 #endif
 
 #ifndef NO_GetCurrentProcessId
-JNIEXPORT jint JNICALL OS_NATIVE(GetCurrentProcessId)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetCurrentProcessId)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -4196,7 +4230,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetCurrentProcessId)
 #endif
 
 #ifndef NO_GetCurrentThreadId
-JNIEXPORT jint JNICALL OS_NATIVE(GetCurrentThreadId)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetCurrentThreadId)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -4208,7 +4242,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetCurrentThreadId)
 #endif
 
 #ifndef NO_GetCursor
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetCursor)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetCursor)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4220,7 +4254,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetCursor)
 #endif
 
 #ifndef NO_GetCursorPos
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetCursorPos)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetCursorPos)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	POINT _arg0, *lparg0=NULL;
@@ -4236,7 +4270,7 @@ fail:
 #endif
 
 #ifndef NO_GetDC
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetDC)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetDC)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -4248,7 +4282,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetDC)
 #endif
 
 #ifndef NO_GetDCEx
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetDCEx)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetDCEx)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
 {
 	jintLong rc = 0;
@@ -4260,7 +4294,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetDCEx)
 #endif
 
 #ifndef NO_GetDIBColorTable
-JNIEXPORT jint JNICALL OS_NATIVE(GetDIBColorTable)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetDIBColorTable)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jbyteArray arg3)
 {
 	jbyte *lparg3=NULL;
@@ -4290,7 +4324,7 @@ fail:
 #endif
 
 #ifndef NO_GetDIBits
-JNIEXPORT jint JNICALL OS_NATIVE(GetDIBits)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetDIBits)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jbyteArray arg4, jbyteArray arg5, jint arg6)
 {
 	jbyte *lparg4=NULL;
@@ -4325,7 +4359,7 @@ fail:
 #endif
 
 #ifndef NO_GetDateFormatA
-JNIEXPORT jint JNICALL OS_NATIVE(GetDateFormatA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetDateFormatA)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jobject arg2, jbyteArray arg3, jbyteArray arg4, jint arg5)
 {
 	SYSTEMTIME _arg2, *lparg2=NULL;
@@ -4347,7 +4381,7 @@ fail:
 #endif
 
 #ifndef NO_GetDateFormatW
-JNIEXPORT jint JNICALL OS_NATIVE(GetDateFormatW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetDateFormatW)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jobject arg2, jcharArray arg3, jcharArray arg4, jint arg5)
 {
 	SYSTEMTIME _arg2, *lparg2=NULL;
@@ -4369,7 +4403,7 @@ fail:
 #endif
 
 #ifndef NO_GetDesktopWindow
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetDesktopWindow)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetDesktopWindow)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4381,7 +4415,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetDesktopWindow)
 #endif
 
 #ifndef NO_GetDeviceCaps
-JNIEXPORT jint JNICALL OS_NATIVE(GetDeviceCaps)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetDeviceCaps)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -4393,7 +4427,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetDeviceCaps)
 #endif
 
 #ifndef NO_GetDialogBaseUnits
-JNIEXPORT jint JNICALL OS_NATIVE(GetDialogBaseUnits)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetDialogBaseUnits)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -4405,7 +4439,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetDialogBaseUnits)
 #endif
 
 #ifndef NO_GetDlgItem
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetDlgItem)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetDlgItem)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jintLong rc = 0;
@@ -4417,7 +4451,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetDlgItem)
 #endif
 
 #ifndef NO_GetDoubleClickTime
-JNIEXPORT jint JNICALL OS_NATIVE(GetDoubleClickTime)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetDoubleClickTime)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -4429,7 +4463,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetDoubleClickTime)
 #endif
 
 #ifndef NO_GetFocus
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetFocus)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetFocus)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4441,7 +4475,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetFocus)
 #endif
 
 #ifndef NO_GetFontLanguageInfo
-JNIEXPORT jint JNICALL OS_NATIVE(GetFontLanguageInfo)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetFontLanguageInfo)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -4453,7 +4487,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetFontLanguageInfo)
 #endif
 
 #ifndef NO_GetForegroundWindow
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetForegroundWindow)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetForegroundWindow)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -4465,7 +4499,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetForegroundWindow)
 #endif
 
 #ifndef NO_GetGUIThreadInfo
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetGUIThreadInfo)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetGUIThreadInfo)
 	(JNIEnv *env, jclass that, jint arg0, jobject arg1)
 {
 	GUITHREADINFO _arg1, *lparg1=NULL;
@@ -4481,7 +4515,7 @@ fail:
 #endif
 
 #ifndef NO_GetGestureInfo
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetGestureInfo)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetGestureInfo)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	GESTUREINFO _arg1, *lparg1=NULL;
@@ -4505,7 +4539,7 @@ fail:
 #endif
 
 #ifndef NO_GetGlyphIndicesW
-JNIEXPORT jint JNICALL OS_NATIVE(GetGlyphIndicesW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetGlyphIndicesW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jshortArray arg3, jint arg4)
 {
 	jchar *lparg1=NULL;
@@ -4524,7 +4558,7 @@ fail:
 #endif
 
 #ifndef NO_GetGraphicsMode
-JNIEXPORT jint JNICALL OS_NATIVE(GetGraphicsMode)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetGraphicsMode)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -4536,7 +4570,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetGraphicsMode)
 #endif
 
 #ifndef NO_GetIconInfo
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetIconInfo)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetIconInfo)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	ICONINFO _arg1, *lparg1=NULL;
@@ -4552,7 +4586,7 @@ fail:
 #endif
 
 #ifndef NO_GetKeyNameTextA
-JNIEXPORT jint JNICALL OS_NATIVE(GetKeyNameTextA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetKeyNameTextA)
 	(JNIEnv *env, jclass that, jint arg0, jbyteArray arg1, jint arg2)
 {
 	jbyte *lparg1=NULL;
@@ -4568,7 +4602,7 @@ fail:
 #endif
 
 #ifndef NO_GetKeyNameTextW
-JNIEXPORT jint JNICALL OS_NATIVE(GetKeyNameTextW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetKeyNameTextW)
 	(JNIEnv *env, jclass that, jint arg0, jcharArray arg1, jint arg2)
 {
 	jchar *lparg1=NULL;
@@ -4584,7 +4618,7 @@ fail:
 #endif
 
 #ifndef NO_GetKeyState
-JNIEXPORT jshort JNICALL OS_NATIVE(GetKeyState)
+SWT_NATIVE_EXPORT jshort JNICALL OS_NATIVE(GetKeyState)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jshort rc = 0;
@@ -4596,7 +4630,7 @@ JNIEXPORT jshort JNICALL OS_NATIVE(GetKeyState)
 #endif
 
 #ifndef NO_GetKeyboardLayout
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetKeyboardLayout)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetKeyboardLayout)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -4608,7 +4642,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetKeyboardLayout)
 #endif
 
 #ifndef NO_GetKeyboardLayoutList
-JNIEXPORT jint JNICALL OS_NATIVE(GetKeyboardLayoutList)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetKeyboardLayoutList)
 	(JNIEnv *env, jclass that, jint arg0, jintLongArray arg1)
 {
 	jintLong *lparg1=NULL;
@@ -4624,7 +4658,7 @@ fail:
 #endif
 
 #ifndef NO_GetKeyboardState
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetKeyboardState)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetKeyboardState)
 	(JNIEnv *env, jclass that, jbyteArray arg0)
 {
 	jbyte *lparg0=NULL;
@@ -4640,7 +4674,7 @@ fail:
 #endif
 
 #ifndef NO_GetLastActivePopup
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetLastActivePopup)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetLastActivePopup)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -4652,7 +4686,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetLastActivePopup)
 #endif
 
 #ifndef NO_GetLastError
-JNIEXPORT jint JNICALL OS_NATIVE(GetLastError)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetLastError)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -4664,7 +4698,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetLastError)
 #endif
 
 #ifndef NO_GetLayeredWindowAttributes
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetLayeredWindowAttributes)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetLayeredWindowAttributes)
 	(JNIEnv *env, jclass that, jintLong arg0, jintArray arg1, jbyteArray arg2, jintArray arg3)
 {
 	jint *lparg1=NULL;
@@ -4694,7 +4728,7 @@ fail:
 #endif
 
 #ifndef NO_GetLayout
-JNIEXPORT jint JNICALL OS_NATIVE(GetLayout)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetLayout)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -4714,7 +4748,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetLayout)
 #endif
 
 #ifndef NO_GetLocaleInfoA
-JNIEXPORT jint JNICALL OS_NATIVE(GetLocaleInfoA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetLocaleInfoA)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jbyteArray arg2, jint arg3)
 {
 	jbyte *lparg2=NULL;
@@ -4730,7 +4764,7 @@ fail:
 #endif
 
 #ifndef NO_GetLocaleInfoW
-JNIEXPORT jint JNICALL OS_NATIVE(GetLocaleInfoW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetLocaleInfoW)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jcharArray arg2, jint arg3)
 {
 	jchar *lparg2=NULL;
@@ -4746,7 +4780,7 @@ fail:
 #endif
 
 #ifndef NO_GetMapMode
-JNIEXPORT jint JNICALL OS_NATIVE(GetMapMode)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetMapMode)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -4758,7 +4792,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetMapMode)
 #endif
 
 #ifndef NO_GetMenu
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetMenu)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetMenu)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -4770,7 +4804,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetMenu)
 #endif
 
 #ifndef NO_GetMenuBarInfo
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetMenuBarInfo)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetMenuBarInfo)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jobject arg3)
 {
 	MENUBARINFO _arg3, *lparg3=NULL;
@@ -4794,7 +4828,7 @@ fail:
 #endif
 
 #ifndef NO_GetMenuDefaultItem
-JNIEXPORT jint JNICALL OS_NATIVE(GetMenuDefaultItem)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetMenuDefaultItem)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jint rc = 0;
@@ -4806,7 +4840,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetMenuDefaultItem)
 #endif
 
 #ifndef NO_GetMenuInfo
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetMenuInfo)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetMenuInfo)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	MENUINFO _arg1, *lparg1=NULL;
@@ -4830,7 +4864,7 @@ fail:
 #endif
 
 #ifndef NO_GetMenuItemCount
-JNIEXPORT jint JNICALL OS_NATIVE(GetMenuItemCount)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetMenuItemCount)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -4842,7 +4876,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetMenuItemCount)
 #endif
 
 #ifndef NO_GetMenuItemInfoA
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetMenuItemInfoA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetMenuItemInfoA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jboolean arg2, jobject arg3)
 {
 	MENUITEMINFO _arg3, *lparg3=NULL;
@@ -4858,7 +4892,7 @@ fail:
 #endif
 
 #ifndef NO_GetMenuItemInfoW
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetMenuItemInfoW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetMenuItemInfoW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jboolean arg2, jobject arg3)
 {
 	MENUITEMINFO _arg3, *lparg3=NULL;
@@ -4874,7 +4908,7 @@ fail:
 #endif
 
 #ifndef NO_GetMenuItemRect
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetMenuItemRect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetMenuItemRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jobject arg3)
 {
 	RECT _arg3, *lparg3=NULL;
@@ -4890,7 +4924,7 @@ fail:
 #endif
 
 #ifndef NO_GetMessageA
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetMessageA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetMessageA)
 	(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2, jint arg3)
 {
 	MSG _arg0, *lparg0=NULL;
@@ -4906,7 +4940,7 @@ fail:
 #endif
 
 #ifndef NO_GetMessagePos
-JNIEXPORT jint JNICALL OS_NATIVE(GetMessagePos)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetMessagePos)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -4918,7 +4952,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetMessagePos)
 #endif
 
 #ifndef NO_GetMessageTime
-JNIEXPORT jint JNICALL OS_NATIVE(GetMessageTime)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetMessageTime)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -4930,7 +4964,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetMessageTime)
 #endif
 
 #ifndef NO_GetMessageW
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetMessageW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetMessageW)
 	(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2, jint arg3)
 {
 	MSG _arg0, *lparg0=NULL;
@@ -4946,7 +4980,7 @@ fail:
 #endif
 
 #ifndef NO_GetMetaRgn
-JNIEXPORT jint JNICALL OS_NATIVE(GetMetaRgn)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetMetaRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jint rc = 0;
@@ -4958,7 +4992,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetMetaRgn)
 #endif
 
 #ifndef NO_GetModuleFileNameA
-JNIEXPORT jint JNICALL OS_NATIVE(GetModuleFileNameA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetModuleFileNameA)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2)
 {
 	jbyte *lparg1=NULL;
@@ -4974,7 +5008,7 @@ fail:
 #endif
 
 #ifndef NO_GetModuleFileNameW
-JNIEXPORT jint JNICALL OS_NATIVE(GetModuleFileNameW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetModuleFileNameW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2)
 {
 	jchar *lparg1=NULL;
@@ -4990,7 +5024,7 @@ fail:
 #endif
 
 #ifndef NO_GetModuleHandleA
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetModuleHandleA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetModuleHandleA)
 	(JNIEnv *env, jclass that, jbyteArray arg0)
 {
 	jbyte *lparg0=NULL;
@@ -5006,7 +5040,7 @@ fail:
 #endif
 
 #ifndef NO_GetModuleHandleW
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetModuleHandleW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetModuleHandleW)
 	(JNIEnv *env, jclass that, jcharArray arg0)
 {
 	jchar *lparg0=NULL;
@@ -5022,7 +5056,7 @@ fail:
 #endif
 
 #ifndef NO_GetMonitorInfoA
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetMonitorInfoA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetMonitorInfoA)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	MONITORINFO _arg1, *lparg1=NULL;
@@ -5046,7 +5080,7 @@ fail:
 #endif
 
 #ifndef NO_GetMonitorInfoW
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetMonitorInfoW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetMonitorInfoW)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	MONITORINFO _arg1, *lparg1=NULL;
@@ -5070,7 +5104,7 @@ fail:
 #endif
 
 #ifndef NO_GetNearestPaletteIndex
-JNIEXPORT jint JNICALL OS_NATIVE(GetNearestPaletteIndex)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetNearestPaletteIndex)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -5083,9 +5117,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetNearestPaletteIndex)
 
 #if (!defined(NO_GetObjectA__III) && !defined(JNI64)) || (!defined(NO_GetObjectA__JIJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectA__III)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectA__III)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectA__JIJ)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectA__JIJ)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
 #endif
 {
 	jint rc = 0;
@@ -5106,9 +5140,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetObjectA__JIJ)(JNIEnv *env, jclass that, jint
 
 #if (!defined(NO_GetObjectA__IILorg_eclipse_swt_internal_win32_BITMAP_2) && !defined(JNI64)) || (!defined(NO_GetObjectA__JILorg_eclipse_swt_internal_win32_BITMAP_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_BITMAP_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_BITMAP_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_BITMAP_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_BITMAP_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #endif
 {
 	BITMAP _arg2, *lparg2=NULL;
@@ -5133,9 +5167,9 @@ fail:
 
 #if (!defined(NO_GetObjectA__IILorg_eclipse_swt_internal_win32_DIBSECTION_2) && !defined(JNI64)) || (!defined(NO_GetObjectA__JILorg_eclipse_swt_internal_win32_DIBSECTION_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_DIBSECTION_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_DIBSECTION_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_DIBSECTION_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_DIBSECTION_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #endif
 {
 	DIBSECTION _arg2, *lparg2=NULL;
@@ -5160,9 +5194,9 @@ fail:
 
 #if (!defined(NO_GetObjectA__IILorg_eclipse_swt_internal_win32_EXTLOGPEN_2) && !defined(JNI64)) || (!defined(NO_GetObjectA__JILorg_eclipse_swt_internal_win32_EXTLOGPEN_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_EXTLOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_EXTLOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_EXTLOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_EXTLOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #endif
 {
 	EXTLOGPEN _arg2, *lparg2=NULL;
@@ -5187,9 +5221,9 @@ fail:
 
 #if (!defined(NO_GetObjectA__IILorg_eclipse_swt_internal_win32_LOGBRUSH_2) && !defined(JNI64)) || (!defined(NO_GetObjectA__JILorg_eclipse_swt_internal_win32_LOGBRUSH_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_LOGBRUSH_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_LOGBRUSH_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_LOGBRUSH_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_LOGBRUSH_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #endif
 {
 	LOGBRUSH _arg2, *lparg2=NULL;
@@ -5214,9 +5248,9 @@ fail:
 
 #if (!defined(NO_GetObjectA__IILorg_eclipse_swt_internal_win32_LOGFONTA_2) && !defined(JNI64)) || (!defined(NO_GetObjectA__JILorg_eclipse_swt_internal_win32_LOGFONTA_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_LOGFONTA_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_LOGFONTA_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_LOGFONTA_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_LOGFONTA_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #endif
 {
 	LOGFONTA _arg2, *lparg2=NULL;
@@ -5241,9 +5275,9 @@ fail:
 
 #if (!defined(NO_GetObjectA__IILorg_eclipse_swt_internal_win32_LOGPEN_2) && !defined(JNI64)) || (!defined(NO_GetObjectA__JILorg_eclipse_swt_internal_win32_LOGPEN_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_LOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_LOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_LOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_LOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #endif
 {
 	LOGPEN _arg2, *lparg2=NULL;
@@ -5268,9 +5302,9 @@ fail:
 
 #if (!defined(NO_GetObjectW__III) && !defined(JNI64)) || (!defined(NO_GetObjectW__JIJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectW__III)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectW__III)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectW__JIJ)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectW__JIJ)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
 #endif
 {
 	jint rc = 0;
@@ -5291,9 +5325,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetObjectW__JIJ)(JNIEnv *env, jclass that, jint
 
 #if (!defined(NO_GetObjectW__IILorg_eclipse_swt_internal_win32_BITMAP_2) && !defined(JNI64)) || (!defined(NO_GetObjectW__JILorg_eclipse_swt_internal_win32_BITMAP_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_BITMAP_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_BITMAP_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_BITMAP_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_BITMAP_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #endif
 {
 	BITMAP _arg2, *lparg2=NULL;
@@ -5318,9 +5352,9 @@ fail:
 
 #if (!defined(NO_GetObjectW__IILorg_eclipse_swt_internal_win32_DIBSECTION_2) && !defined(JNI64)) || (!defined(NO_GetObjectW__JILorg_eclipse_swt_internal_win32_DIBSECTION_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_DIBSECTION_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_DIBSECTION_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_DIBSECTION_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_DIBSECTION_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #endif
 {
 	DIBSECTION _arg2, *lparg2=NULL;
@@ -5345,9 +5379,9 @@ fail:
 
 #if (!defined(NO_GetObjectW__IILorg_eclipse_swt_internal_win32_EXTLOGPEN_2) && !defined(JNI64)) || (!defined(NO_GetObjectW__JILorg_eclipse_swt_internal_win32_EXTLOGPEN_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_EXTLOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_EXTLOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_EXTLOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_EXTLOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #endif
 {
 	EXTLOGPEN _arg2, *lparg2=NULL;
@@ -5372,9 +5406,9 @@ fail:
 
 #if (!defined(NO_GetObjectW__IILorg_eclipse_swt_internal_win32_LOGBRUSH_2) && !defined(JNI64)) || (!defined(NO_GetObjectW__JILorg_eclipse_swt_internal_win32_LOGBRUSH_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_LOGBRUSH_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_LOGBRUSH_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_LOGBRUSH_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_LOGBRUSH_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #endif
 {
 	LOGBRUSH _arg2, *lparg2=NULL;
@@ -5399,9 +5433,9 @@ fail:
 
 #if (!defined(NO_GetObjectW__IILorg_eclipse_swt_internal_win32_LOGFONTW_2) && !defined(JNI64)) || (!defined(NO_GetObjectW__JILorg_eclipse_swt_internal_win32_LOGFONTW_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_LOGFONTW_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_LOGFONTW_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_LOGFONTW_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_LOGFONTW_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #endif
 {
 	LOGFONTW _arg2, *lparg2=NULL;
@@ -5426,9 +5460,9 @@ fail:
 
 #if (!defined(NO_GetObjectW__IILorg_eclipse_swt_internal_win32_LOGPEN_2) && !defined(JNI64)) || (!defined(NO_GetObjectW__JILorg_eclipse_swt_internal_win32_LOGPEN_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_LOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_LOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_LOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_LOGPEN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 #endif
 {
 	LOGPEN _arg2, *lparg2=NULL;
@@ -5452,7 +5486,7 @@ fail:
 #endif
 
 #ifndef NO_GetOpenFileNameA
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetOpenFileNameA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetOpenFileNameA)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	OPENFILENAME _arg0, *lparg0=NULL;
@@ -5468,7 +5502,7 @@ fail:
 #endif
 
 #ifndef NO_GetOpenFileNameW
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetOpenFileNameW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetOpenFileNameW)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	OPENFILENAME _arg0, *lparg0=NULL;
@@ -5484,7 +5518,7 @@ fail:
 #endif
 
 #ifndef NO_GetOutlineTextMetricsA
-JNIEXPORT jint JNICALL OS_NATIVE(GetOutlineTextMetricsA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetOutlineTextMetricsA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 {
 	OUTLINETEXTMETRICA _arg2, *lparg2=NULL;
@@ -5500,7 +5534,7 @@ fail:
 #endif
 
 #ifndef NO_GetOutlineTextMetricsW
-JNIEXPORT jint JNICALL OS_NATIVE(GetOutlineTextMetricsW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetOutlineTextMetricsW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 {
 	OUTLINETEXTMETRICW _arg2, *lparg2=NULL;
@@ -5516,7 +5550,7 @@ fail:
 #endif
 
 #ifndef NO_GetPaletteEntries
-JNIEXPORT jint JNICALL OS_NATIVE(GetPaletteEntries)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetPaletteEntries)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jbyteArray arg3)
 {
 	jbyte *lparg3=NULL;
@@ -5546,7 +5580,7 @@ fail:
 #endif
 
 #ifndef NO_GetParent
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetParent)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetParent)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -5558,7 +5592,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetParent)
 #endif
 
 #ifndef NO_GetPath
-JNIEXPORT jint JNICALL OS_NATIVE(GetPath)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetPath)
 	(JNIEnv *env, jclass that, jintLong arg0, jintArray arg1, jbyteArray arg2, jint arg3)
 {
 	jint *lparg1=NULL;
@@ -5577,7 +5611,7 @@ fail:
 #endif
 
 #ifndef NO_GetPixel
-JNIEXPORT jint JNICALL OS_NATIVE(GetPixel)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetPixel)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jint rc = 0;
@@ -5589,7 +5623,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetPixel)
 #endif
 
 #ifndef NO_GetPolyFillMode
-JNIEXPORT jint JNICALL OS_NATIVE(GetPolyFillMode)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetPolyFillMode)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -5601,7 +5635,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetPolyFillMode)
 #endif
 
 #ifndef NO_GetProcAddress
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetProcAddress)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetProcAddress)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1)
 {
 	jbyte *lparg1=NULL;
@@ -5610,14 +5644,14 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetProcAddress)
 	if (arg1) if ((lparg1 = (*env)->GetByteArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	rc = (jintLong)GetProcAddress((HMODULE)arg0, (LPCTSTR)lparg1);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, GetProcAddress_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_GetProcessHeap
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetProcessHeap)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetProcessHeap)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -5629,7 +5663,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetProcessHeap)
 #endif
 
 #ifndef NO_GetProcessHeaps
-JNIEXPORT jint JNICALL OS_NATIVE(GetProcessHeaps)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetProcessHeaps)
 	(JNIEnv *env, jclass that, jint arg0, jintLongArray arg1)
 {
 	jintLong *lparg1=NULL;
@@ -5645,7 +5679,7 @@ fail:
 #endif
 
 #ifndef NO_GetProfileStringA
-JNIEXPORT jint JNICALL OS_NATIVE(GetProfileStringA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetProfileStringA)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jbyteArray arg1, jbyteArray arg2, jbyteArray arg3, jint arg4)
 {
 	jbyte *lparg0=NULL;
@@ -5670,7 +5704,7 @@ fail:
 #endif
 
 #ifndef NO_GetProfileStringW
-JNIEXPORT jint JNICALL OS_NATIVE(GetProfileStringW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetProfileStringW)
 	(JNIEnv *env, jclass that, jcharArray arg0, jcharArray arg1, jcharArray arg2, jcharArray arg3, jint arg4)
 {
 	jchar *lparg0=NULL;
@@ -5695,7 +5729,7 @@ fail:
 #endif
 
 #ifndef NO_GetPropA
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetPropA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetPropA)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -5707,7 +5741,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetPropA)
 #endif
 
 #ifndef NO_GetPropW
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetPropW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetPropW)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -5719,7 +5753,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetPropW)
 #endif
 
 #ifndef NO_GetROP2
-JNIEXPORT jint JNICALL OS_NATIVE(GetROP2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetROP2)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -5731,7 +5765,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetROP2)
 #endif
 
 #ifndef NO_GetRandomRgn
-JNIEXPORT jint JNICALL OS_NATIVE(GetRandomRgn)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetRandomRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
 {
 	jint rc = 0;
@@ -5743,7 +5777,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetRandomRgn)
 #endif
 
 #ifndef NO_GetRegionData
-JNIEXPORT jint JNICALL OS_NATIVE(GetRegionData)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetRegionData)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintArray arg2)
 {
 	jint *lparg2=NULL;
@@ -5773,7 +5807,7 @@ fail:
 #endif
 
 #ifndef NO_GetRgnBox
-JNIEXPORT jint JNICALL OS_NATIVE(GetRgnBox)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetRgnBox)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -5789,7 +5823,7 @@ fail:
 #endif
 
 #ifndef NO_GetSaveFileNameA
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetSaveFileNameA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetSaveFileNameA)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	OPENFILENAME _arg0, *lparg0=NULL;
@@ -5805,7 +5839,7 @@ fail:
 #endif
 
 #ifndef NO_GetSaveFileNameW
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetSaveFileNameW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetSaveFileNameW)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	OPENFILENAME _arg0, *lparg0=NULL;
@@ -5821,7 +5855,7 @@ fail:
 #endif
 
 #ifndef NO_GetScrollBarInfo
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetScrollBarInfo)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetScrollBarInfo)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 {
 	SCROLLBARINFO _arg2, *lparg2=NULL;
@@ -5837,7 +5871,7 @@ fail:
 #endif
 
 #ifndef NO_GetScrollInfo
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetScrollInfo)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetScrollInfo)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2)
 {
 	SCROLLINFO _arg2, *lparg2=NULL;
@@ -5853,7 +5887,7 @@ fail:
 #endif
 
 #ifndef NO_GetStartupInfoA
-JNIEXPORT void JNICALL OS_NATIVE(GetStartupInfoA)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(GetStartupInfoA)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	STARTUPINFO _arg0, *lparg0=NULL;
@@ -5867,7 +5901,7 @@ fail:
 #endif
 
 #ifndef NO_GetStartupInfoW
-JNIEXPORT void JNICALL OS_NATIVE(GetStartupInfoW)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(GetStartupInfoW)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	STARTUPINFO _arg0, *lparg0=NULL;
@@ -5881,7 +5915,7 @@ fail:
 #endif
 
 #ifndef NO_GetStockObject
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetStockObject)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetStockObject)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -5893,7 +5927,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetStockObject)
 #endif
 
 #ifndef NO_GetSysColor
-JNIEXPORT jint JNICALL OS_NATIVE(GetSysColor)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetSysColor)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jint rc = 0;
@@ -5905,7 +5939,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetSysColor)
 #endif
 
 #ifndef NO_GetSysColorBrush
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetSysColorBrush)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetSysColorBrush)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jintLong rc = 0;
@@ -5917,7 +5951,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetSysColorBrush)
 #endif
 
 #ifndef NO_GetSystemDefaultUILanguage
-JNIEXPORT jshort JNICALL OS_NATIVE(GetSystemDefaultUILanguage)
+SWT_NATIVE_EXPORT jshort JNICALL OS_NATIVE(GetSystemDefaultUILanguage)
 	(JNIEnv *env, jclass that)
 {
 	jshort rc = 0;
@@ -5937,7 +5971,7 @@ JNIEXPORT jshort JNICALL OS_NATIVE(GetSystemDefaultUILanguage)
 #endif
 
 #ifndef NO_GetSystemMenu
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetSystemMenu)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetSystemMenu)
 	(JNIEnv *env, jclass that, jintLong arg0, jboolean arg1)
 {
 	jintLong rc = 0;
@@ -5949,7 +5983,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetSystemMenu)
 #endif
 
 #ifndef NO_GetSystemMetrics
-JNIEXPORT jint JNICALL OS_NATIVE(GetSystemMetrics)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetSystemMetrics)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jint rc = 0;
@@ -5961,7 +5995,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetSystemMetrics)
 #endif
 
 #ifndef NO_GetSystemPaletteEntries
-JNIEXPORT jint JNICALL OS_NATIVE(GetSystemPaletteEntries)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetSystemPaletteEntries)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jbyteArray arg3)
 {
 	jbyte *lparg3=NULL;
@@ -5991,7 +6025,7 @@ fail:
 #endif
 
 #ifndef NO_GetTextCharset
-JNIEXPORT jint JNICALL OS_NATIVE(GetTextCharset)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetTextCharset)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -6003,7 +6037,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetTextCharset)
 #endif
 
 #ifndef NO_GetTextColor
-JNIEXPORT jint JNICALL OS_NATIVE(GetTextColor)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetTextColor)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -6015,7 +6049,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetTextColor)
 #endif
 
 #ifndef NO_GetTextExtentPoint32A
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetTextExtentPoint32A)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetTextExtentPoint32A)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jobject arg3)
 {
 	jbyte *lparg1=NULL;
@@ -6048,7 +6082,7 @@ fail:
 #endif
 
 #ifndef NO_GetTextExtentPoint32W
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetTextExtentPoint32W)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetTextExtentPoint32W)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jobject arg3)
 {
 	jchar *lparg1=NULL;
@@ -6081,7 +6115,7 @@ fail:
 #endif
 
 #ifndef NO_GetTextMetricsA
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetTextMetricsA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetTextMetricsA)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	TEXTMETRICA _arg1, *lparg1=NULL;
@@ -6097,7 +6131,7 @@ fail:
 #endif
 
 #ifndef NO_GetTextMetricsW
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetTextMetricsW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetTextMetricsW)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	TEXTMETRICW _arg1, *lparg1=NULL;
@@ -6113,7 +6147,7 @@ fail:
 #endif
 
 #ifndef NO_GetThemeBackgroundContentRect
-JNIEXPORT jint JNICALL OS_NATIVE(GetThemeBackgroundContentRect)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetThemeBackgroundContentRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jobject arg4, jobject arg5)
 {
 	RECT _arg4, *lparg4=NULL;
@@ -6140,7 +6174,7 @@ fail:
 #endif
 
 #ifndef NO_GetThemeBackgroundExtent
-JNIEXPORT jint JNICALL OS_NATIVE(GetThemeBackgroundExtent)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetThemeBackgroundExtent)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jobject arg4, jobject arg5)
 {
 	RECT _arg4, *lparg4=NULL;
@@ -6166,7 +6200,7 @@ fail:
 #endif
 
 #ifndef NO_GetThemeBitmap
-JNIEXPORT jint JNICALL OS_NATIVE(GetThemeBitmap)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetThemeBitmap)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4, jintLongArray arg5)
 {
 	jintLong *lparg5=NULL;
@@ -6190,7 +6224,7 @@ fail:
 #endif
 
 #ifndef NO_GetThemeColor
-JNIEXPORT jint JNICALL OS_NATIVE(GetThemeColor)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetThemeColor)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jintArray arg4)
 {
 	jint *lparg4=NULL;
@@ -6214,7 +6248,7 @@ fail:
 #endif
 
 #ifndef NO_GetThemeInt
-JNIEXPORT jint JNICALL OS_NATIVE(GetThemeInt)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetThemeInt)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jintArray arg4)
 {
 	jint *lparg4=NULL;
@@ -6238,7 +6272,7 @@ fail:
 #endif
 
 #ifndef NO_GetThemeMargins
-JNIEXPORT jint JNICALL OS_NATIVE(GetThemeMargins)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetThemeMargins)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jobject arg5, jobject arg6)
 {
 	RECT _arg5, *lparg5=NULL;
@@ -6265,7 +6299,7 @@ fail:
 #endif
 
 #ifndef NO_GetThemeMetric
-JNIEXPORT jint JNICALL OS_NATIVE(GetThemeMetric)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetThemeMetric)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jintArray arg5)
 {
 	jint *lparg5=NULL;
@@ -6289,7 +6323,7 @@ fail:
 #endif
 
 #ifndef NO_GetThemePartSize
-JNIEXPORT jint JNICALL OS_NATIVE(GetThemePartSize)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetThemePartSize)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jobject arg4, jint arg5, jobject arg6)
 {
 	RECT _arg4, *lparg4=NULL;
@@ -6316,7 +6350,7 @@ fail:
 #endif
 
 #ifndef NO_GetThemeRect
-JNIEXPORT jint JNICALL OS_NATIVE(GetThemeRect)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetThemeRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jobject arg4)
 {
 	RECT _arg4, *lparg4=NULL;
@@ -6340,7 +6374,7 @@ fail:
 #endif
 
 #ifndef NO_GetThemeSysSize
-JNIEXPORT jint JNICALL OS_NATIVE(GetThemeSysSize)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetThemeSysSize)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -6360,7 +6394,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetThemeSysSize)
 #endif
 
 #ifndef NO_GetThemeTextExtent
-JNIEXPORT jint JNICALL OS_NATIVE(GetThemeTextExtent)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetThemeTextExtent)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jcharArray arg4, jint arg5, jint arg6, jobject arg7, jobject arg8)
 {
 	jchar *lparg4=NULL;
@@ -6390,7 +6424,7 @@ fail:
 #endif
 
 #ifndef NO_GetTickCount
-JNIEXPORT jint JNICALL OS_NATIVE(GetTickCount)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetTickCount)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -6402,7 +6436,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetTickCount)
 #endif
 
 #ifndef NO_GetTimeFormatA
-JNIEXPORT jint JNICALL OS_NATIVE(GetTimeFormatA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetTimeFormatA)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jobject arg2, jbyteArray arg3, jbyteArray arg4, jint arg5)
 {
 	SYSTEMTIME _arg2, *lparg2=NULL;
@@ -6424,7 +6458,7 @@ fail:
 #endif
 
 #ifndef NO_GetTimeFormatW
-JNIEXPORT jint JNICALL OS_NATIVE(GetTimeFormatW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetTimeFormatW)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jobject arg2, jcharArray arg3, jcharArray arg4, jint arg5)
 {
 	SYSTEMTIME _arg2, *lparg2=NULL;
@@ -6446,7 +6480,7 @@ fail:
 #endif
 
 #ifndef NO_GetTouchInputInfo
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetTouchInputInfo)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetTouchInputInfo)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jint arg3)
 {
 	jboolean rc = 0;
@@ -6466,7 +6500,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(GetTouchInputInfo)
 #endif
 
 #ifndef NO_GetUpdateRect
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetUpdateRect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetUpdateRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jboolean arg2)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -6482,7 +6516,7 @@ fail:
 #endif
 
 #ifndef NO_GetUpdateRgn
-JNIEXPORT jint JNICALL OS_NATIVE(GetUpdateRgn)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetUpdateRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2)
 {
 	jint rc = 0;
@@ -6494,7 +6528,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetUpdateRgn)
 #endif
 
 #ifndef NO_GetVersionExA__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOA_2
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetVersionExA__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOA_2)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetVersionExA__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOA_2)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	OSVERSIONINFOA _arg0, *lparg0=NULL;
@@ -6510,7 +6544,7 @@ fail:
 #endif
 
 #ifndef NO_GetVersionExA__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOEXA_2
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetVersionExA__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOEXA_2)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetVersionExA__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOEXA_2)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	OSVERSIONINFOEXA _arg0, *lparg0=NULL;
@@ -6526,7 +6560,7 @@ fail:
 #endif
 
 #ifndef NO_GetVersionExW__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOEXW_2
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetVersionExW__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOEXW_2)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetVersionExW__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOEXW_2)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	OSVERSIONINFOEXW _arg0, *lparg0=NULL;
@@ -6542,7 +6576,7 @@ fail:
 #endif
 
 #ifndef NO_GetVersionExW__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOW_2
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetVersionExW__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOW_2)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetVersionExW__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOW_2)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	OSVERSIONINFOW _arg0, *lparg0=NULL;
@@ -6558,7 +6592,7 @@ fail:
 #endif
 
 #ifndef NO_GetWindow
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetWindow)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetWindow)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jintLong rc = 0;
@@ -6570,7 +6604,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetWindow)
 #endif
 
 #ifndef NO_GetWindowDC
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetWindowDC)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetWindowDC)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -6582,7 +6616,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetWindowDC)
 #endif
 
 #ifndef NO_GetWindowLongA
-JNIEXPORT jint JNICALL OS_NATIVE(GetWindowLongA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetWindowLongA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -6594,7 +6628,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetWindowLongA)
 #endif
 
 #ifndef NO_GetWindowLongPtrA
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetWindowLongPtrA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetWindowLongPtrA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jintLong rc = 0;
@@ -6606,7 +6640,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetWindowLongPtrA)
 #endif
 
 #ifndef NO_GetWindowLongPtrW
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetWindowLongPtrW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetWindowLongPtrW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jintLong rc = 0;
@@ -6618,7 +6652,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetWindowLongPtrW)
 #endif
 
 #ifndef NO_GetWindowLongW
-JNIEXPORT jint JNICALL OS_NATIVE(GetWindowLongW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetWindowLongW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -6630,7 +6664,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetWindowLongW)
 #endif
 
 #ifndef NO_GetWindowOrgEx
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetWindowOrgEx)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetWindowOrgEx)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	POINT _arg1, *lparg1=NULL;
@@ -6646,7 +6680,7 @@ fail:
 #endif
 
 #ifndef NO_GetWindowPlacement
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetWindowPlacement)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetWindowPlacement)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	WINDOWPLACEMENT _arg1, *lparg1=NULL;
@@ -6662,7 +6696,7 @@ fail:
 #endif
 
 #ifndef NO_GetWindowRect
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetWindowRect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetWindowRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -6678,7 +6712,7 @@ fail:
 #endif
 
 #ifndef NO_GetWindowRgn
-JNIEXPORT jint JNICALL OS_NATIVE(GetWindowRgn)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetWindowRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jint rc = 0;
@@ -6690,7 +6724,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetWindowRgn)
 #endif
 
 #ifndef NO_GetWindowTextA
-JNIEXPORT jint JNICALL OS_NATIVE(GetWindowTextA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetWindowTextA)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2)
 {
 	jbyte *lparg1=NULL;
@@ -6706,7 +6740,7 @@ fail:
 #endif
 
 #ifndef NO_GetWindowTextLengthA
-JNIEXPORT jint JNICALL OS_NATIVE(GetWindowTextLengthA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetWindowTextLengthA)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -6718,7 +6752,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetWindowTextLengthA)
 #endif
 
 #ifndef NO_GetWindowTextLengthW
-JNIEXPORT jint JNICALL OS_NATIVE(GetWindowTextLengthW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetWindowTextLengthW)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -6730,7 +6764,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GetWindowTextLengthW)
 #endif
 
 #ifndef NO_GetWindowTextW
-JNIEXPORT jint JNICALL OS_NATIVE(GetWindowTextW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetWindowTextW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2)
 {
 	jchar *lparg1=NULL;
@@ -6746,7 +6780,7 @@ fail:
 #endif
 
 #ifndef NO_GetWindowTheme
-JNIEXPORT jintLong JNICALL OS_NATIVE(GetWindowTheme)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GetWindowTheme)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -6766,7 +6800,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetWindowTheme)
 #endif
 
 #ifndef NO_GetWindowThreadProcessId
-JNIEXPORT jint JNICALL OS_NATIVE(GetWindowThreadProcessId)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GetWindowThreadProcessId)
 	(JNIEnv *env, jclass that, jintLong arg0, jintArray arg1)
 {
 	jint *lparg1=NULL;
@@ -6782,7 +6816,7 @@ fail:
 #endif
 
 #ifndef NO_GetWorldTransform
-JNIEXPORT jboolean JNICALL OS_NATIVE(GetWorldTransform)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GetWorldTransform)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1)
 {
 	jfloat *lparg1=NULL;
@@ -6798,7 +6832,7 @@ fail:
 #endif
 
 #ifndef NO_GlobalAddAtomA
-JNIEXPORT jint JNICALL OS_NATIVE(GlobalAddAtomA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GlobalAddAtomA)
 	(JNIEnv *env, jclass that, jbyteArray arg0)
 {
 	jbyte *lparg0=NULL;
@@ -6807,14 +6841,14 @@ JNIEXPORT jint JNICALL OS_NATIVE(GlobalAddAtomA)
 	if (arg0) if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jint)GlobalAddAtomA((LPCTSTR)lparg0);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, GlobalAddAtomA_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_GlobalAddAtomW
-JNIEXPORT jint JNICALL OS_NATIVE(GlobalAddAtomW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GlobalAddAtomW)
 	(JNIEnv *env, jclass that, jcharArray arg0)
 {
 	jchar *lparg0=NULL;
@@ -6823,14 +6857,14 @@ JNIEXPORT jint JNICALL OS_NATIVE(GlobalAddAtomW)
 	if (arg0) if ((lparg0 = (*env)->GetCharArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jint)GlobalAddAtomW((LPCWSTR)lparg0);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, GlobalAddAtomW_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_GlobalAlloc
-JNIEXPORT jintLong JNICALL OS_NATIVE(GlobalAlloc)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GlobalAlloc)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	jintLong rc = 0;
@@ -6842,7 +6876,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GlobalAlloc)
 #endif
 
 #ifndef NO_GlobalFree
-JNIEXPORT jintLong JNICALL OS_NATIVE(GlobalFree)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GlobalFree)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -6854,7 +6888,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GlobalFree)
 #endif
 
 #ifndef NO_GlobalLock
-JNIEXPORT jintLong JNICALL OS_NATIVE(GlobalLock)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(GlobalLock)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -6866,7 +6900,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GlobalLock)
 #endif
 
 #ifndef NO_GlobalSize
-JNIEXPORT jint JNICALL OS_NATIVE(GlobalSize)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(GlobalSize)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -6878,7 +6912,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GlobalSize)
 #endif
 
 #ifndef NO_GlobalUnlock
-JNIEXPORT jboolean JNICALL OS_NATIVE(GlobalUnlock)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GlobalUnlock)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -6890,7 +6924,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(GlobalUnlock)
 #endif
 
 #ifndef NO_GradientFill
-JNIEXPORT jboolean JNICALL OS_NATIVE(GradientFill)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(GradientFill)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLong arg3, jint arg4, jint arg5)
 {
 	jboolean rc = 0;
@@ -6910,7 +6944,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(GradientFill)
 #endif
 
 #ifndef NO_HDHITTESTINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(HDHITTESTINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(HDHITTESTINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -6922,7 +6956,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(HDHITTESTINFO_1sizeof)
 #endif
 
 #ifndef NO_HDITEM_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(HDITEM_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(HDITEM_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -6934,7 +6968,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(HDITEM_1sizeof)
 #endif
 
 #ifndef NO_HDLAYOUT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(HDLAYOUT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(HDLAYOUT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -6946,7 +6980,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(HDLAYOUT_1sizeof)
 #endif
 
 #ifndef NO_HELPINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(HELPINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(HELPINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -6958,7 +6992,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(HELPINFO_1sizeof)
 #endif
 
 #ifndef NO_HIGHCONTRAST_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(HIGHCONTRAST_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(HIGHCONTRAST_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -6970,7 +7004,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(HIGHCONTRAST_1sizeof)
 #endif
 
 #ifndef NO_HIWORD
-JNIEXPORT jint JNICALL OS_NATIVE(HIWORD)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(HIWORD)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -6982,7 +7016,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(HIWORD)
 #endif
 
 #ifndef NO_HeapAlloc
-JNIEXPORT jintLong JNICALL OS_NATIVE(HeapAlloc)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(HeapAlloc)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jintLong rc = 0;
@@ -6994,7 +7028,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(HeapAlloc)
 #endif
 
 #ifndef NO_HeapFree
-JNIEXPORT jboolean JNICALL OS_NATIVE(HeapFree)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(HeapFree)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
 {
 	jboolean rc = 0;
@@ -7006,7 +7040,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(HeapFree)
 #endif
 
 #ifndef NO_HeapValidate
-JNIEXPORT jboolean JNICALL OS_NATIVE(HeapValidate)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(HeapValidate)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
 {
 	jboolean rc = 0;
@@ -7018,7 +7052,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(HeapValidate)
 #endif
 
 #ifndef NO_HideCaret
-JNIEXPORT jboolean JNICALL OS_NATIVE(HideCaret)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(HideCaret)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -7030,7 +7064,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(HideCaret)
 #endif
 
 #ifndef NO_HitTestThemeBackground
-JNIEXPORT jint JNICALL OS_NATIVE(HitTestThemeBackground)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(HitTestThemeBackground)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jobject arg5, jintLong arg6, jobject arg7, jshortArray arg8)
 {
 	RECT _arg5, *lparg5=NULL;
@@ -7060,7 +7094,7 @@ fail:
 #endif
 
 #ifndef NO_ICONINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(ICONINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ICONINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -7072,7 +7106,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ICONINFO_1sizeof)
 #endif
 
 #ifndef NO_IIDFromString
-JNIEXPORT jint JNICALL OS_NATIVE(IIDFromString)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(IIDFromString)
 	(JNIEnv *env, jclass that, jcharArray arg0, jbyteArray arg1)
 {
 	jchar *lparg0=NULL;
@@ -7091,7 +7125,7 @@ fail:
 #endif
 
 #ifndef NO_INITCOMMONCONTROLSEX_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(INITCOMMONCONTROLSEX_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(INITCOMMONCONTROLSEX_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -7103,7 +7137,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(INITCOMMONCONTROLSEX_1sizeof)
 #endif
 
 #ifndef NO_INPUT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(INPUT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(INPUT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -7115,7 +7149,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(INPUT_1sizeof)
 #endif
 
 #ifndef NO_ImageList_1Add
-JNIEXPORT jint JNICALL OS_NATIVE(ImageList_1Add)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ImageList_1Add)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 {
 	jint rc = 0;
@@ -7127,7 +7161,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ImageList_1Add)
 #endif
 
 #ifndef NO_ImageList_1AddMasked
-JNIEXPORT jint JNICALL OS_NATIVE(ImageList_1AddMasked)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ImageList_1AddMasked)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
 {
 	jint rc = 0;
@@ -7139,7 +7173,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ImageList_1AddMasked)
 #endif
 
 #ifndef NO_ImageList_1BeginDrag
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1BeginDrag)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImageList_1BeginDrag)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3)
 {
 	jboolean rc = 0;
@@ -7151,7 +7185,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1BeginDrag)
 #endif
 
 #ifndef NO_ImageList_1Create
-JNIEXPORT jintLong JNICALL OS_NATIVE(ImageList_1Create)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(ImageList_1Create)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jint arg4)
 {
 	jintLong rc = 0;
@@ -7163,7 +7197,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(ImageList_1Create)
 #endif
 
 #ifndef NO_ImageList_1Destroy
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1Destroy)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImageList_1Destroy)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -7175,7 +7209,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1Destroy)
 #endif
 
 #ifndef NO_ImageList_1DragEnter
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1DragEnter)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImageList_1DragEnter)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jboolean rc = 0;
@@ -7187,7 +7221,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1DragEnter)
 #endif
 
 #ifndef NO_ImageList_1DragLeave
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1DragLeave)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImageList_1DragLeave)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -7199,7 +7233,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1DragLeave)
 #endif
 
 #ifndef NO_ImageList_1DragMove
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1DragMove)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImageList_1DragMove)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	jboolean rc = 0;
@@ -7211,7 +7245,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1DragMove)
 #endif
 
 #ifndef NO_ImageList_1DragShowNolock
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1DragShowNolock)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImageList_1DragShowNolock)
 	(JNIEnv *env, jclass that, jboolean arg0)
 {
 	jboolean rc = 0;
@@ -7223,7 +7257,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1DragShowNolock)
 #endif
 
 #ifndef NO_ImageList_1Draw
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1Draw)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImageList_1Draw)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jint arg3, jint arg4, jint arg5)
 {
 	jboolean rc = 0;
@@ -7235,7 +7269,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1Draw)
 #endif
 
 #ifndef NO_ImageList_1EndDrag
-JNIEXPORT void JNICALL OS_NATIVE(ImageList_1EndDrag)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(ImageList_1EndDrag)
 	(JNIEnv *env, jclass that)
 {
 	OS_NATIVE_ENTER(env, that, ImageList_1EndDrag_FUNC);
@@ -7245,7 +7279,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ImageList_1EndDrag)
 #endif
 
 #ifndef NO_ImageList_1GetDragImage
-JNIEXPORT jintLong JNICALL OS_NATIVE(ImageList_1GetDragImage)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(ImageList_1GetDragImage)
 	(JNIEnv *env, jclass that, jobject arg0, jobject arg1)
 {
 	POINT _arg0, *lparg0=NULL;
@@ -7264,7 +7298,7 @@ fail:
 #endif
 
 #ifndef NO_ImageList_1GetIcon
-JNIEXPORT jintLong JNICALL OS_NATIVE(ImageList_1GetIcon)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(ImageList_1GetIcon)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jintLong rc = 0;
@@ -7276,7 +7310,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(ImageList_1GetIcon)
 #endif
 
 #ifndef NO_ImageList_1GetIconSize
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1GetIconSize)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImageList_1GetIconSize)
 	(JNIEnv *env, jclass that, jintLong arg0, jintArray arg1, jintArray arg2)
 {
 	jint *lparg1=NULL;
@@ -7295,7 +7329,7 @@ fail:
 #endif
 
 #ifndef NO_ImageList_1GetImageCount
-JNIEXPORT jint JNICALL OS_NATIVE(ImageList_1GetImageCount)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ImageList_1GetImageCount)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -7307,7 +7341,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ImageList_1GetImageCount)
 #endif
 
 #ifndef NO_ImageList_1Remove
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1Remove)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImageList_1Remove)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jboolean rc = 0;
@@ -7319,7 +7353,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1Remove)
 #endif
 
 #ifndef NO_ImageList_1Replace
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1Replace)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImageList_1Replace)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
 {
 	jboolean rc = 0;
@@ -7331,7 +7365,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1Replace)
 #endif
 
 #ifndef NO_ImageList_1ReplaceIcon
-JNIEXPORT jint JNICALL OS_NATIVE(ImageList_1ReplaceIcon)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ImageList_1ReplaceIcon)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
 {
 	jint rc = 0;
@@ -7343,7 +7377,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ImageList_1ReplaceIcon)
 #endif
 
 #ifndef NO_ImageList_1SetIconSize
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1SetIconSize)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImageList_1SetIconSize)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jboolean rc = 0;
@@ -7355,7 +7389,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImageList_1SetIconSize)
 #endif
 
 #ifndef NO_ImmAssociateContext
-JNIEXPORT jintLong JNICALL OS_NATIVE(ImmAssociateContext)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(ImmAssociateContext)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -7367,7 +7401,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(ImmAssociateContext)
 #endif
 
 #ifndef NO_ImmCreateContext
-JNIEXPORT jintLong JNICALL OS_NATIVE(ImmCreateContext)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(ImmCreateContext)
 	(JNIEnv *env, jclass that)
 {
 	jintLong rc = 0;
@@ -7379,7 +7413,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(ImmCreateContext)
 #endif
 
 #ifndef NO_ImmDestroyContext
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImmDestroyContext)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImmDestroyContext)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -7391,7 +7425,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImmDestroyContext)
 #endif
 
 #ifndef NO_ImmDisableTextFrameService
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImmDisableTextFrameService)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImmDisableTextFrameService)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jboolean rc = 0;
@@ -7411,7 +7445,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImmDisableTextFrameService)
 #endif
 
 #ifndef NO_ImmEscapeA
-JNIEXPORT jintLong JNICALL OS_NATIVE(ImmEscapeA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(ImmEscapeA)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jbyteArray arg3)
 {
 	jbyte *lparg3=NULL;
@@ -7427,7 +7461,7 @@ fail:
 #endif
 
 #ifndef NO_ImmEscapeW
-JNIEXPORT jintLong JNICALL OS_NATIVE(ImmEscapeW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(ImmEscapeW)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jcharArray arg3)
 {
 	jchar *lparg3=NULL;
@@ -7443,7 +7477,7 @@ fail:
 #endif
 
 #ifndef NO_ImmGetCompositionFontA
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImmGetCompositionFontA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImmGetCompositionFontA)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	LOGFONTA _arg1, *lparg1=NULL;
@@ -7459,7 +7493,7 @@ fail:
 #endif
 
 #ifndef NO_ImmGetCompositionFontW
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImmGetCompositionFontW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImmGetCompositionFontW)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	LOGFONTW _arg1, *lparg1=NULL;
@@ -7476,9 +7510,9 @@ fail:
 
 #if (!defined(NO_ImmGetCompositionStringA__II_3BI) && !defined(JNI64)) || (!defined(NO_ImmGetCompositionStringA__JI_3BI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringA__II_3BI)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jbyteArray arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringA__II_3BI)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jbyteArray arg2, jint arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringA__JI_3BI)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jbyteArray arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringA__JI_3BI)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jbyteArray arg2, jint arg3)
 #endif
 {
 	jbyte *lparg2=NULL;
@@ -7503,9 +7537,9 @@ fail:
 
 #if (!defined(NO_ImmGetCompositionStringA__II_3II) && !defined(JNI64)) || (!defined(NO_ImmGetCompositionStringA__JI_3II) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringA__II_3II)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintArray arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringA__II_3II)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintArray arg2, jint arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringA__JI_3II)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintArray arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringA__JI_3II)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintArray arg2, jint arg3)
 #endif
 {
 	jint *lparg2=NULL;
@@ -7530,9 +7564,9 @@ fail:
 
 #if (!defined(NO_ImmGetCompositionStringW__II_3BI) && !defined(JNI64)) || (!defined(NO_ImmGetCompositionStringW__JI_3BI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringW__II_3BI)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jbyteArray arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringW__II_3BI)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jbyteArray arg2, jint arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringW__JI_3BI)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jbyteArray arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringW__JI_3BI)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jbyteArray arg2, jint arg3)
 #endif
 {
 	jbyte *lparg2=NULL;
@@ -7557,9 +7591,9 @@ fail:
 
 #if (!defined(NO_ImmGetCompositionStringW__II_3CI) && !defined(JNI64)) || (!defined(NO_ImmGetCompositionStringW__JI_3CI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringW__II_3CI)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jcharArray arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringW__II_3CI)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jcharArray arg2, jint arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringW__JI_3CI)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jcharArray arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringW__JI_3CI)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jcharArray arg2, jint arg3)
 #endif
 {
 	jchar *lparg2=NULL;
@@ -7584,9 +7618,9 @@ fail:
 
 #if (!defined(NO_ImmGetCompositionStringW__II_3II) && !defined(JNI64)) || (!defined(NO_ImmGetCompositionStringW__JI_3II) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringW__II_3II)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintArray arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringW__II_3II)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintArray arg2, jint arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringW__JI_3II)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintArray arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ImmGetCompositionStringW__JI_3II)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintArray arg2, jint arg3)
 #endif
 {
 	jint *lparg2=NULL;
@@ -7610,7 +7644,7 @@ fail:
 #endif
 
 #ifndef NO_ImmGetContext
-JNIEXPORT jintLong JNICALL OS_NATIVE(ImmGetContext)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(ImmGetContext)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -7622,7 +7656,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(ImmGetContext)
 #endif
 
 #ifndef NO_ImmGetConversionStatus
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImmGetConversionStatus)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImmGetConversionStatus)
 	(JNIEnv *env, jclass that, jintLong arg0, jintArray arg1, jintArray arg2)
 {
 	jint *lparg1=NULL;
@@ -7641,7 +7675,7 @@ fail:
 #endif
 
 #ifndef NO_ImmGetDefaultIMEWnd
-JNIEXPORT jintLong JNICALL OS_NATIVE(ImmGetDefaultIMEWnd)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(ImmGetDefaultIMEWnd)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -7653,7 +7687,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(ImmGetDefaultIMEWnd)
 #endif
 
 #ifndef NO_ImmGetOpenStatus
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImmGetOpenStatus)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImmGetOpenStatus)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -7665,7 +7699,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImmGetOpenStatus)
 #endif
 
 #ifndef NO_ImmNotifyIME
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImmNotifyIME)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImmNotifyIME)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3)
 {
 	jboolean rc = 0;
@@ -7677,7 +7711,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImmNotifyIME)
 #endif
 
 #ifndef NO_ImmReleaseContext
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImmReleaseContext)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImmReleaseContext)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jboolean rc = 0;
@@ -7689,7 +7723,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImmReleaseContext)
 #endif
 
 #ifndef NO_ImmSetCandidateWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImmSetCandidateWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImmSetCandidateWindow)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	CANDIDATEFORM _arg1, *lparg1=NULL;
@@ -7705,7 +7739,7 @@ fail:
 #endif
 
 #ifndef NO_ImmSetCompositionFontA
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImmSetCompositionFontA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImmSetCompositionFontA)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	LOGFONTA _arg1, *lparg1=NULL;
@@ -7721,7 +7755,7 @@ fail:
 #endif
 
 #ifndef NO_ImmSetCompositionFontW
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImmSetCompositionFontW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImmSetCompositionFontW)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	LOGFONTW _arg1, *lparg1=NULL;
@@ -7737,7 +7771,7 @@ fail:
 #endif
 
 #ifndef NO_ImmSetCompositionWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImmSetCompositionWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImmSetCompositionWindow)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	COMPOSITIONFORM _arg1, *lparg1=NULL;
@@ -7753,7 +7787,7 @@ fail:
 #endif
 
 #ifndef NO_ImmSetConversionStatus
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImmSetConversionStatus)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImmSetConversionStatus)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jboolean rc = 0;
@@ -7765,7 +7799,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImmSetConversionStatus)
 #endif
 
 #ifndef NO_ImmSetOpenStatus
-JNIEXPORT jboolean JNICALL OS_NATIVE(ImmSetOpenStatus)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ImmSetOpenStatus)
 	(JNIEnv *env, jclass that, jintLong arg0, jboolean arg1)
 {
 	jboolean rc = 0;
@@ -7777,7 +7811,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ImmSetOpenStatus)
 #endif
 
 #ifndef NO_InSendMessage
-JNIEXPORT jboolean JNICALL OS_NATIVE(InSendMessage)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(InSendMessage)
 	(JNIEnv *env, jclass that)
 {
 	jboolean rc = 0;
@@ -7789,7 +7823,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(InSendMessage)
 #endif
 
 #ifndef NO_InitCommonControls
-JNIEXPORT void JNICALL OS_NATIVE(InitCommonControls)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(InitCommonControls)
 	(JNIEnv *env, jclass that)
 {
 	OS_NATIVE_ENTER(env, that, InitCommonControls_FUNC);
@@ -7799,7 +7833,7 @@ JNIEXPORT void JNICALL OS_NATIVE(InitCommonControls)
 #endif
 
 #ifndef NO_InitCommonControlsEx
-JNIEXPORT jboolean JNICALL OS_NATIVE(InitCommonControlsEx)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(InitCommonControlsEx)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	INITCOMMONCONTROLSEX _arg0, *lparg0=NULL;
@@ -7815,7 +7849,7 @@ fail:
 #endif
 
 #ifndef NO_InsertMenuA
-JNIEXPORT jboolean JNICALL OS_NATIVE(InsertMenuA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(InsertMenuA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jintLong arg3, jbyteArray arg4)
 {
 	jbyte *lparg4=NULL;
@@ -7831,7 +7865,7 @@ fail:
 #endif
 
 #ifndef NO_InsertMenuItemA
-JNIEXPORT jboolean JNICALL OS_NATIVE(InsertMenuItemA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(InsertMenuItemA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jboolean arg2, jobject arg3)
 {
 	MENUITEMINFO _arg3, *lparg3=NULL;
@@ -7847,7 +7881,7 @@ fail:
 #endif
 
 #ifndef NO_InsertMenuItemW
-JNIEXPORT jboolean JNICALL OS_NATIVE(InsertMenuItemW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(InsertMenuItemW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jboolean arg2, jobject arg3)
 {
 	MENUITEMINFO _arg3, *lparg3=NULL;
@@ -7863,7 +7897,7 @@ fail:
 #endif
 
 #ifndef NO_InsertMenuW
-JNIEXPORT jboolean JNICALL OS_NATIVE(InsertMenuW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(InsertMenuW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jintLong arg3, jcharArray arg4)
 {
 	jchar *lparg4=NULL;
@@ -7879,7 +7913,7 @@ fail:
 #endif
 
 #ifndef NO_InternetGetCookieA
-JNIEXPORT jboolean JNICALL OS_NATIVE(InternetGetCookieA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(InternetGetCookieA)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jbyteArray arg1, jbyteArray arg2, jintArray arg3)
 {
 	jbyte *lparg0=NULL;
@@ -7896,15 +7930,15 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(InternetGetCookieA)
 fail:
 	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
 	if (arg2 && lparg2) (*env)->ReleaseByteArrayElements(env, arg2, lparg2, 0);
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, InternetGetCookieA_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_InternetGetCookieW
-JNIEXPORT jboolean JNICALL OS_NATIVE(InternetGetCookieW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(InternetGetCookieW)
 	(JNIEnv *env, jclass that, jcharArray arg0, jcharArray arg1, jcharArray arg2, jintArray arg3)
 {
 	jchar *lparg0=NULL;
@@ -7921,15 +7955,15 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(InternetGetCookieW)
 fail:
 	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
 	if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, 0);
-	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, 0);
-	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, 0);
+	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, JNI_ABORT);
+	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, InternetGetCookieW_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_InternetSetCookieA
-JNIEXPORT jboolean JNICALL OS_NATIVE(InternetSetCookieA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(InternetSetCookieA)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jbyteArray arg1, jbyteArray arg2)
 {
 	jbyte *lparg0=NULL;
@@ -7942,16 +7976,16 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(InternetSetCookieA)
 	if (arg2) if ((lparg2 = (*env)->GetByteArrayElements(env, arg2, NULL)) == NULL) goto fail;
 	rc = (jboolean)InternetSetCookieA((LPCTSTR)lparg0, (LPCTSTR)lparg1, (LPCTSTR)lparg2);
 fail:
-	if (arg2 && lparg2) (*env)->ReleaseByteArrayElements(env, arg2, lparg2, 0);
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg2 && lparg2) (*env)->ReleaseByteArrayElements(env, arg2, lparg2, JNI_ABORT);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, InternetSetCookieA_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_InternetSetCookieW
-JNIEXPORT jboolean JNICALL OS_NATIVE(InternetSetCookieW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(InternetSetCookieW)
 	(JNIEnv *env, jclass that, jcharArray arg0, jcharArray arg1, jcharArray arg2)
 {
 	jchar *lparg0=NULL;
@@ -7964,16 +7998,16 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(InternetSetCookieW)
 	if (arg2) if ((lparg2 = (*env)->GetCharArrayElements(env, arg2, NULL)) == NULL) goto fail;
 	rc = (jboolean)InternetSetCookieW((LPCWSTR)lparg0, (LPCWSTR)lparg1, (LPCWSTR)lparg2);
 fail:
-	if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, 0);
-	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, 0);
-	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, 0);
+	if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, JNI_ABORT);
+	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, JNI_ABORT);
+	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, InternetSetCookieW_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_InternetSetOption
-JNIEXPORT jboolean JNICALL OS_NATIVE(InternetSetOption)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(InternetSetOption)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jint arg3)
 {
 	jboolean rc = 0;
@@ -7985,7 +8019,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(InternetSetOption)
 #endif
 
 #ifndef NO_IntersectClipRect
-JNIEXPORT jint JNICALL OS_NATIVE(IntersectClipRect)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(IntersectClipRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4)
 {
 	jint rc = 0;
@@ -7997,7 +8031,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(IntersectClipRect)
 #endif
 
 #ifndef NO_IntersectRect
-JNIEXPORT jboolean JNICALL OS_NATIVE(IntersectRect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(IntersectRect)
 	(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jobject arg2)
 {
 	RECT _arg0, *lparg0=NULL;
@@ -8017,7 +8051,7 @@ fail:
 #endif
 
 #ifndef NO_InvalidateRect
-JNIEXPORT jboolean JNICALL OS_NATIVE(InvalidateRect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(InvalidateRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jboolean arg2)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -8033,7 +8067,7 @@ fail:
 #endif
 
 #ifndef NO_InvalidateRgn
-JNIEXPORT jboolean JNICALL OS_NATIVE(InvalidateRgn)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(InvalidateRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2)
 {
 	jboolean rc = 0;
@@ -8045,7 +8079,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(InvalidateRgn)
 #endif
 
 #ifndef NO_IsAppThemed
-JNIEXPORT jboolean JNICALL OS_NATIVE(IsAppThemed)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(IsAppThemed)
 	(JNIEnv *env, jclass that)
 {
 	jboolean rc = 0;
@@ -8065,7 +8099,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(IsAppThemed)
 #endif
 
 #ifndef NO_IsBadReadPtr
-JNIEXPORT jboolean JNICALL OS_NATIVE(IsBadReadPtr)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(IsBadReadPtr)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jboolean rc = 0;
@@ -8077,7 +8111,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(IsBadReadPtr)
 #endif
 
 #ifndef NO_IsBadWritePtr
-JNIEXPORT jboolean JNICALL OS_NATIVE(IsBadWritePtr)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(IsBadWritePtr)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jboolean rc = 0;
@@ -8089,7 +8123,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(IsBadWritePtr)
 #endif
 
 #ifndef NO_IsDBCSLeadByte
-JNIEXPORT jboolean JNICALL OS_NATIVE(IsDBCSLeadByte)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(IsDBCSLeadByte)
 	(JNIEnv *env, jclass that, jbyte arg0)
 {
 	jboolean rc = 0;
@@ -8101,7 +8135,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(IsDBCSLeadByte)
 #endif
 
 #ifndef NO_IsHungAppWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(IsHungAppWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(IsHungAppWindow)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -8121,7 +8155,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(IsHungAppWindow)
 #endif
 
 #ifndef NO_IsIconic
-JNIEXPORT jboolean JNICALL OS_NATIVE(IsIconic)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(IsIconic)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -8133,7 +8167,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(IsIconic)
 #endif
 
 #ifndef NO_IsTouchWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(IsTouchWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(IsTouchWindow)
 	(JNIEnv *env, jclass that, jintLong arg0, jlongArray arg1)
 {
 	jlong *lparg1=NULL;
@@ -8157,7 +8191,7 @@ fail:
 #endif
 
 #ifndef NO_IsWindowEnabled
-JNIEXPORT jboolean JNICALL OS_NATIVE(IsWindowEnabled)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(IsWindowEnabled)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -8169,7 +8203,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(IsWindowEnabled)
 #endif
 
 #ifndef NO_IsWindowVisible
-JNIEXPORT jboolean JNICALL OS_NATIVE(IsWindowVisible)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(IsWindowVisible)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -8181,7 +8215,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(IsWindowVisible)
 #endif
 
 #ifndef NO_IsZoomed
-JNIEXPORT jboolean JNICALL OS_NATIVE(IsZoomed)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(IsZoomed)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -8193,7 +8227,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(IsZoomed)
 #endif
 
 #ifndef NO_KEYBDINPUT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(KEYBDINPUT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(KEYBDINPUT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8205,7 +8239,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(KEYBDINPUT_1sizeof)
 #endif
 
 #ifndef NO_KillTimer
-JNIEXPORT jboolean JNICALL OS_NATIVE(KillTimer)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(KillTimer)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jboolean rc = 0;
@@ -8217,7 +8251,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(KillTimer)
 #endif
 
 #ifndef NO_LITEM_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(LITEM_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(LITEM_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8229,7 +8263,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(LITEM_1sizeof)
 #endif
 
 #ifndef NO_LODWORD
-JNIEXPORT jint JNICALL OS_NATIVE(LODWORD)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(LODWORD)
 	(JNIEnv *env, jclass that, jlong arg0)
 {
 	jint rc = 0;
@@ -8241,7 +8275,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(LODWORD)
 #endif
 
 #ifndef NO_LOGBRUSH_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(LOGBRUSH_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(LOGBRUSH_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8253,7 +8287,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(LOGBRUSH_1sizeof)
 #endif
 
 #ifndef NO_LOGFONTA_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(LOGFONTA_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(LOGFONTA_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8265,7 +8299,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(LOGFONTA_1sizeof)
 #endif
 
 #ifndef NO_LOGFONTW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(LOGFONTW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(LOGFONTW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8277,7 +8311,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(LOGFONTW_1sizeof)
 #endif
 
 #ifndef NO_LOGPEN_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(LOGPEN_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(LOGPEN_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8289,7 +8323,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(LOGPEN_1sizeof)
 #endif
 
 #ifndef NO_LOWORD
-JNIEXPORT jint JNICALL OS_NATIVE(LOWORD)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(LOWORD)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -8301,7 +8335,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(LOWORD)
 #endif
 
 #ifndef NO_LPtoDP
-JNIEXPORT jboolean JNICALL OS_NATIVE(LPtoDP)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(LPtoDP)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 {
 	POINT _arg1, *lparg1=NULL;
@@ -8317,7 +8351,7 @@ fail:
 #endif
 
 #ifndef NO_LVCOLUMN_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(LVCOLUMN_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(LVCOLUMN_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8329,7 +8363,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(LVCOLUMN_1sizeof)
 #endif
 
 #ifndef NO_LVHITTESTINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(LVHITTESTINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(LVHITTESTINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8341,7 +8375,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(LVHITTESTINFO_1sizeof)
 #endif
 
 #ifndef NO_LVINSERTMARK_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(LVINSERTMARK_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(LVINSERTMARK_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8353,7 +8387,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(LVINSERTMARK_1sizeof)
 #endif
 
 #ifndef NO_LVITEM_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(LVITEM_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(LVITEM_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8365,7 +8399,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(LVITEM_1sizeof)
 #endif
 
 #ifndef NO_LineTo
-JNIEXPORT jboolean JNICALL OS_NATIVE(LineTo)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(LineTo)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jboolean rc = 0;
@@ -8377,7 +8411,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(LineTo)
 #endif
 
 #ifndef NO_LoadBitmapA
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadBitmapA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadBitmapA)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -8389,7 +8423,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(LoadBitmapA)
 #endif
 
 #ifndef NO_LoadBitmapW
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadBitmapW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadBitmapW)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -8401,7 +8435,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(LoadBitmapW)
 #endif
 
 #ifndef NO_LoadCursorA
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadCursorA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadCursorA)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -8413,7 +8447,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(LoadCursorA)
 #endif
 
 #ifndef NO_LoadCursorW
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadCursorW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadCursorW)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -8425,7 +8459,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(LoadCursorW)
 #endif
 
 #ifndef NO_LoadIconA
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadIconA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadIconA)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -8437,7 +8471,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(LoadIconA)
 #endif
 
 #ifndef NO_LoadIconW
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadIconW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadIconW)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -8450,9 +8484,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(LoadIconW)
 
 #if (!defined(NO_LoadImageA__IIIIII) && !defined(JNI64)) || (!defined(NO_LoadImageA__JJIIII) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadImageA__IIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadImageA__IIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadImageA__JJIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadImageA__JJIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5)
 #endif
 {
 	jintLong rc = 0;
@@ -8473,9 +8507,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(LoadImageA__JJIIII)(JNIEnv *env, jclass tha
 
 #if (!defined(NO_LoadImageA__I_3BIIII) && !defined(JNI64)) || (!defined(NO_LoadImageA__J_3BIIII) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadImageA__I_3BIIII)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jint arg3, jint arg4, jint arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadImageA__I_3BIIII)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jint arg3, jint arg4, jint arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadImageA__J_3BIIII)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jint arg3, jint arg4, jint arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadImageA__J_3BIIII)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jint arg3, jint arg4, jint arg5)
 #endif
 {
 	jbyte *lparg1=NULL;
@@ -8500,9 +8534,9 @@ fail:
 
 #if (!defined(NO_LoadImageW__IIIIII) && !defined(JNI64)) || (!defined(NO_LoadImageW__JJIIII) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadImageW__IIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadImageW__IIIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadImageW__JJIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadImageW__JJIIII)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5)
 #endif
 {
 	jintLong rc = 0;
@@ -8523,9 +8557,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(LoadImageW__JJIIII)(JNIEnv *env, jclass tha
 
 #if (!defined(NO_LoadImageW__I_3CIIII) && !defined(JNI64)) || (!defined(NO_LoadImageW__J_3CIIII) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadImageW__I_3CIIII)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jint arg3, jint arg4, jint arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadImageW__I_3CIIII)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jint arg3, jint arg4, jint arg5)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadImageW__J_3CIIII)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jint arg3, jint arg4, jint arg5)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadImageW__J_3CIIII)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jint arg3, jint arg4, jint arg5)
 #endif
 {
 	jchar *lparg1=NULL;
@@ -8549,7 +8583,7 @@ fail:
 #endif
 
 #ifndef NO_LoadLibraryA
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadLibraryA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadLibraryA)
 	(JNIEnv *env, jclass that, jbyteArray arg0)
 {
 	jbyte *lparg0=NULL;
@@ -8565,7 +8599,7 @@ fail:
 #endif
 
 #ifndef NO_LoadLibraryW
-JNIEXPORT jintLong JNICALL OS_NATIVE(LoadLibraryW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LoadLibraryW)
 	(JNIEnv *env, jclass that, jcharArray arg0)
 {
 	jchar *lparg0=NULL;
@@ -8581,7 +8615,7 @@ fail:
 #endif
 
 #ifndef NO_LoadStringA
-JNIEXPORT jint JNICALL OS_NATIVE(LoadStringA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(LoadStringA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jbyteArray arg2, jint arg3)
 {
 	jbyte *lparg2=NULL;
@@ -8597,7 +8631,7 @@ fail:
 #endif
 
 #ifndef NO_LoadStringW
-JNIEXPORT jint JNICALL OS_NATIVE(LoadStringW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(LoadStringW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jcharArray arg2, jint arg3)
 {
 	jchar *lparg2=NULL;
@@ -8613,7 +8647,7 @@ fail:
 #endif
 
 #ifndef NO_LocalFree
-JNIEXPORT jintLong JNICALL OS_NATIVE(LocalFree)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(LocalFree)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -8625,7 +8659,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(LocalFree)
 #endif
 
 #ifndef NO_LockWindowUpdate
-JNIEXPORT jboolean JNICALL OS_NATIVE(LockWindowUpdate)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(LockWindowUpdate)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -8637,7 +8671,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(LockWindowUpdate)
 #endif
 
 #ifndef NO_MAKELPARAM
-JNIEXPORT jintLong JNICALL OS_NATIVE(MAKELPARAM)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(MAKELPARAM)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	jintLong rc = 0;
@@ -8649,7 +8683,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(MAKELPARAM)
 #endif
 
 #ifndef NO_MAKELRESULT
-JNIEXPORT jintLong JNICALL OS_NATIVE(MAKELRESULT)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(MAKELRESULT)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	jintLong rc = 0;
@@ -8661,7 +8695,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(MAKELRESULT)
 #endif
 
 #ifndef NO_MAKEWORD
-JNIEXPORT jint JNICALL OS_NATIVE(MAKEWORD)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MAKEWORD)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	jint rc = 0;
@@ -8673,7 +8707,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MAKEWORD)
 #endif
 
 #ifndef NO_MAKEWPARAM
-JNIEXPORT jintLong JNICALL OS_NATIVE(MAKEWPARAM)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(MAKEWPARAM)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	jintLong rc = 0;
@@ -8685,7 +8719,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(MAKEWPARAM)
 #endif
 
 #ifndef NO_MARGINS_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(MARGINS_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MARGINS_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8697,7 +8731,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MARGINS_1sizeof)
 #endif
 
 #ifndef NO_MCHITTESTINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(MCHITTESTINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MCHITTESTINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8709,7 +8743,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MCHITTESTINFO_1sizeof)
 #endif
 
 #ifndef NO_MCIWndRegisterClass
-JNIEXPORT jboolean JNICALL OS_NATIVE(MCIWndRegisterClass)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(MCIWndRegisterClass)
 	(JNIEnv *env, jclass that)
 {
 	jboolean rc = 0;
@@ -8729,7 +8763,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(MCIWndRegisterClass)
 #endif
 
 #ifndef NO_MEASUREITEMSTRUCT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(MEASUREITEMSTRUCT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MEASUREITEMSTRUCT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8741,7 +8775,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MEASUREITEMSTRUCT_1sizeof)
 #endif
 
 #ifndef NO_MENUBARINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(MENUBARINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MENUBARINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8753,7 +8787,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MENUBARINFO_1sizeof)
 #endif
 
 #ifndef NO_MENUINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(MENUINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MENUINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8765,7 +8799,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MENUINFO_1sizeof)
 #endif
 
 #ifndef NO_MENUITEMINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(MENUITEMINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MENUITEMINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8777,7 +8811,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MENUITEMINFO_1sizeof)
 #endif
 
 #ifndef NO_MINMAXINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(MINMAXINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MINMAXINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8789,7 +8823,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MINMAXINFO_1sizeof)
 #endif
 
 #ifndef NO_MONITORINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(MONITORINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MONITORINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8801,7 +8835,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MONITORINFO_1sizeof)
 #endif
 
 #ifndef NO_MOUSEINPUT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(MOUSEINPUT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MOUSEINPUT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8813,7 +8847,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MOUSEINPUT_1sizeof)
 #endif
 
 #ifndef NO_MSG_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(MSG_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MSG_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -8825,7 +8859,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MSG_1sizeof)
 #endif
 
 #ifndef NO_MapViewOfFile
-JNIEXPORT jintLong JNICALL OS_NATIVE(MapViewOfFile)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(MapViewOfFile)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4)
 {
 	jintLong rc = 0;
@@ -8837,7 +8871,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(MapViewOfFile)
 #endif
 
 #ifndef NO_MapVirtualKeyA
-JNIEXPORT jint JNICALL OS_NATIVE(MapVirtualKeyA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MapVirtualKeyA)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	jint rc = 0;
@@ -8849,7 +8883,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MapVirtualKeyA)
 #endif
 
 #ifndef NO_MapVirtualKeyW
-JNIEXPORT jint JNICALL OS_NATIVE(MapVirtualKeyW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MapVirtualKeyW)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	jint rc = 0;
@@ -8862,9 +8896,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(MapVirtualKeyW)
 
 #if (!defined(NO_MapWindowPoints__IILorg_eclipse_swt_internal_win32_POINT_2I) && !defined(JNI64)) || (!defined(NO_MapWindowPoints__JJLorg_eclipse_swt_internal_win32_POINT_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(MapWindowPoints__IILorg_eclipse_swt_internal_win32_POINT_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MapWindowPoints__IILorg_eclipse_swt_internal_win32_POINT_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(MapWindowPoints__JJLorg_eclipse_swt_internal_win32_POINT_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MapWindowPoints__JJLorg_eclipse_swt_internal_win32_POINT_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3)
 #endif
 {
 	POINT _arg2, *lparg2=NULL;
@@ -8889,9 +8923,9 @@ fail:
 
 #if (!defined(NO_MapWindowPoints__IILorg_eclipse_swt_internal_win32_RECT_2I) && !defined(JNI64)) || (!defined(NO_MapWindowPoints__JJLorg_eclipse_swt_internal_win32_RECT_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(MapWindowPoints__IILorg_eclipse_swt_internal_win32_RECT_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MapWindowPoints__IILorg_eclipse_swt_internal_win32_RECT_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(MapWindowPoints__JJLorg_eclipse_swt_internal_win32_RECT_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MapWindowPoints__JJLorg_eclipse_swt_internal_win32_RECT_2I)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jint arg3)
 #endif
 {
 	RECT _arg2, *lparg2=NULL;
@@ -8915,7 +8949,7 @@ fail:
 #endif
 
 #ifndef NO_MessageBeep
-JNIEXPORT jboolean JNICALL OS_NATIVE(MessageBeep)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(MessageBeep)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jboolean rc = 0;
@@ -8927,7 +8961,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(MessageBeep)
 #endif
 
 #ifndef NO_MessageBoxA
-JNIEXPORT jint JNICALL OS_NATIVE(MessageBoxA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MessageBoxA)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jbyteArray arg2, jint arg3)
 {
 	jbyte *lparg1=NULL;
@@ -8946,7 +8980,7 @@ fail:
 #endif
 
 #ifndef NO_MessageBoxW
-JNIEXPORT jint JNICALL OS_NATIVE(MessageBoxW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MessageBoxW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jcharArray arg2, jint arg3)
 {
 	jchar *lparg1=NULL;
@@ -8965,7 +8999,7 @@ fail:
 #endif
 
 #ifndef NO_ModifyWorldTransform
-JNIEXPORT jboolean JNICALL OS_NATIVE(ModifyWorldTransform)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ModifyWorldTransform)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1, jint arg2)
 {
 	jfloat *lparg1=NULL;
@@ -8981,7 +9015,7 @@ fail:
 #endif
 
 #ifndef NO_MonitorFromWindow
-JNIEXPORT jintLong JNICALL OS_NATIVE(MonitorFromWindow)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(MonitorFromWindow)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jintLong rc = 0;
@@ -9002,9 +9036,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(MonitorFromWindow)
 
 #if (!defined(NO_MoveMemory__III) && !defined(JNI64)) || (!defined(NO_MoveMemory__JJI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__III)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JJI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JJI)(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
 #endif
 {
 #ifndef JNI64
@@ -9023,9 +9057,9 @@ JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JJI)(JNIEnv *env, jclass that, jint
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_DEVMODEA_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_DEVMODEA_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_DEVMODEA_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_DEVMODEA_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_DEVMODEA_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_DEVMODEA_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	DEVMODEA _arg1, *lparg1=NULL;
@@ -9047,9 +9081,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_DEVMODEW_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_DEVMODEW_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_DEVMODEW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_DEVMODEW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_DEVMODEW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_DEVMODEW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	DEVMODEW _arg1, *lparg1=NULL;
@@ -9071,9 +9105,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	DOCHOSTUIINFO _arg1, *lparg1=NULL;
@@ -9095,9 +9129,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_DROPFILES_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_DROPFILES_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_DROPFILES_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_DROPFILES_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_DROPFILES_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_DROPFILES_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	DROPFILES _arg1, *lparg1=NULL;
@@ -9119,9 +9153,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_GESTURECONFIG_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_GESTURECONFIG_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_GESTURECONFIG_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_GESTURECONFIG_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_GESTURECONFIG_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_GESTURECONFIG_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	GESTURECONFIG _arg1, *lparg1=NULL;
@@ -9143,9 +9177,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_GRADIENT_1RECT_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_GRADIENT_1RECT_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_GRADIENT_1RECT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_GRADIENT_1RECT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_GRADIENT_1RECT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_GRADIENT_1RECT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	GRADIENT_RECT _arg1, *lparg1=NULL;
@@ -9167,9 +9201,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_KEYBDINPUT_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_KEYBDINPUT_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_KEYBDINPUT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_KEYBDINPUT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_KEYBDINPUT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_KEYBDINPUT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	KEYBDINPUT _arg1, *lparg1=NULL;
@@ -9191,9 +9225,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_LOGFONTA_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_LOGFONTA_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_LOGFONTA_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_LOGFONTA_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_LOGFONTA_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_LOGFONTA_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	LOGFONTA _arg1, *lparg1=NULL;
@@ -9215,9 +9249,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_LOGFONTW_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_LOGFONTW_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_LOGFONTW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_LOGFONTW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_LOGFONTW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_LOGFONTW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	LOGFONTW _arg1, *lparg1=NULL;
@@ -9239,9 +9273,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	MEASUREITEMSTRUCT _arg1, *lparg1=NULL;
@@ -9263,9 +9297,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_MINMAXINFO_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_MINMAXINFO_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_MINMAXINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_MINMAXINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_MINMAXINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_MINMAXINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	MINMAXINFO _arg1, *lparg1=NULL;
@@ -9287,9 +9321,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_MOUSEINPUT_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_MOUSEINPUT_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_MOUSEINPUT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_MOUSEINPUT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_MOUSEINPUT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_MOUSEINPUT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	MOUSEINPUT _arg1, *lparg1=NULL;
@@ -9311,9 +9345,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_MSG_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_MSG_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_MSG_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_MSG_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_MSG_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_MSG_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	MSG _arg1, *lparg1=NULL;
@@ -9335,9 +9369,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	NMLVCUSTOMDRAW _arg1, *lparg1=NULL;
@@ -9359,9 +9393,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_NMLVDISPINFO_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_NMLVDISPINFO_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMLVDISPINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMLVDISPINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMLVDISPINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMLVDISPINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	NMLVDISPINFO _arg1, *lparg1=NULL;
@@ -9383,9 +9417,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	NMTTCUSTOMDRAW _arg1, *lparg1=NULL;
@@ -9407,9 +9441,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	NMTTDISPINFOA _arg1, *lparg1=NULL;
@@ -9431,9 +9465,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	NMTTDISPINFOW _arg1, *lparg1=NULL;
@@ -9455,9 +9489,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	NMTVCUSTOMDRAW _arg1, *lparg1=NULL;
@@ -9479,9 +9513,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_NMTVDISPINFO_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_NMTVDISPINFO_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMTVDISPINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMTVDISPINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMTVDISPINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMTVDISPINFO_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	NMTVDISPINFO _arg1, *lparg1=NULL;
@@ -9503,9 +9537,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_OPENFILENAME_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_OPENFILENAME_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_OPENFILENAME_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_OPENFILENAME_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_OPENFILENAME_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_OPENFILENAME_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	OPENFILENAME _arg1, *lparg1=NULL;
@@ -9517,7 +9551,6 @@ JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_OP
 	if (arg1) if ((lparg1 = getOPENFILENAMEFields(env, arg1, &_arg1)) == NULL) goto fail;
 	MoveMemory((PVOID)arg0, (CONST VOID *)lparg1, arg2);
 fail:
-	if (arg1 && lparg1) setOPENFILENAMEFields(env, arg1, lparg1);
 #ifndef JNI64
 	OS_NATIVE_EXIT(env, that, MoveMemory__ILorg_eclipse_swt_internal_win32_OPENFILENAME_2I_FUNC);
 #else
@@ -9528,9 +9561,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_RECT_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_RECT_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_RECT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_RECT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_RECT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_RECT_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	RECT _arg1, *lparg1=NULL;
@@ -9552,9 +9585,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_SAFEARRAY_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_SAFEARRAY_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_SAFEARRAY_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_SAFEARRAY_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_SAFEARRAY_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_SAFEARRAY_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	SAFEARRAY _arg1, *lparg1=NULL;
@@ -9576,9 +9609,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	SHDRAGIMAGE _arg1, *lparg1=NULL;
@@ -9600,9 +9633,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_TRIVERTEX_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_TRIVERTEX_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_TRIVERTEX_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_TRIVERTEX_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_TRIVERTEX_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_TRIVERTEX_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	TRIVERTEX _arg1, *lparg1=NULL;
@@ -9624,9 +9657,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_UDACCEL_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_UDACCEL_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_UDACCEL_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_UDACCEL_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_UDACCEL_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_UDACCEL_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	UDACCEL _arg1, *lparg1=NULL;
@@ -9648,9 +9681,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_WINDOWPOS_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_WINDOWPOS_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_WINDOWPOS_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_WINDOWPOS_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_WINDOWPOS_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_WINDOWPOS_2I)(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jint arg2)
 #endif
 {
 	WINDOWPOS _arg1, *lparg1=NULL;
@@ -9672,9 +9705,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__I_3BI) && !defined(JNI64)) || (!defined(NO_MoveMemory__J_3BI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__I_3BI)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__I_3BI)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__J_3BI)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__J_3BI)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2)
 #endif
 {
 	jbyte *lparg1=NULL;
@@ -9711,9 +9744,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__I_3CI) && !defined(JNI64)) || (!defined(NO_MoveMemory__J_3CI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__I_3CI)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__I_3CI)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__J_3CI)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__J_3CI)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2)
 #endif
 {
 	jchar *lparg1=NULL;
@@ -9750,9 +9783,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__I_3DI) && !defined(JNI64)) || (!defined(NO_MoveMemory__J_3DI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__I_3DI)(JNIEnv *env, jclass that, jintLong arg0, jdoubleArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__I_3DI)(JNIEnv *env, jclass that, jintLong arg0, jdoubleArray arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__J_3DI)(JNIEnv *env, jclass that, jintLong arg0, jdoubleArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__J_3DI)(JNIEnv *env, jclass that, jintLong arg0, jdoubleArray arg1, jint arg2)
 #endif
 {
 	jdouble *lparg1=NULL;
@@ -9789,9 +9822,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__I_3FI) && !defined(JNI64)) || (!defined(NO_MoveMemory__J_3FI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__I_3FI)(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__I_3FI)(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__J_3FI)(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__J_3FI)(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1, jint arg2)
 #endif
 {
 	jfloat *lparg1=NULL;
@@ -9828,9 +9861,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__I_3II) && !defined(JNI64)) || (!defined(NO_MoveMemory__J_3II) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__I_3II)(JNIEnv *env, jclass that, jintLong arg0, jintArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__I_3II)(JNIEnv *env, jclass that, jintLong arg0, jintArray arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__J_3II)(JNIEnv *env, jclass that, jintLong arg0, jintArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__J_3II)(JNIEnv *env, jclass that, jintLong arg0, jintArray arg1, jint arg2)
 #endif
 {
 	jint *lparg1=NULL;
@@ -9867,9 +9900,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__I_3JI) && !defined(JNI64)) || (!defined(NO_MoveMemory__J_3JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__I_3JI)(JNIEnv *env, jclass that, jintLong arg0, jlongArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__I_3JI)(JNIEnv *env, jclass that, jintLong arg0, jlongArray arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__J_3JI)(JNIEnv *env, jclass that, jintLong arg0, jlongArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__J_3JI)(JNIEnv *env, jclass that, jintLong arg0, jlongArray arg1, jint arg2)
 #endif
 {
 	jlong *lparg1=NULL;
@@ -9906,9 +9939,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__I_3SI) && !defined(JNI64)) || (!defined(NO_MoveMemory__J_3SI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__I_3SI)(JNIEnv *env, jclass that, jintLong arg0, jshortArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__I_3SI)(JNIEnv *env, jclass that, jintLong arg0, jshortArray arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__J_3SI)(JNIEnv *env, jclass that, jintLong arg0, jshortArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__J_3SI)(JNIEnv *env, jclass that, jintLong arg0, jshortArray arg1, jint arg2)
 #endif
 {
 	jshort *lparg1=NULL;
@@ -9945,9 +9978,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	BITMAPINFOHEADER _arg0, *lparg0=NULL;
@@ -9969,7 +10002,7 @@ fail:
 #endif
 
 #ifndef NO_MoveMemory__Lorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2_3BI
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2_3BI)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2_3BI)
 	(JNIEnv *env, jclass that, jobject arg0, jbyteArray arg1, jint arg2)
 {
 	BITMAPINFOHEADER _arg0, *lparg0=NULL;
@@ -10001,9 +10034,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1CONTEXT_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1CONTEXT_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1CONTEXT_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1CONTEXT_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1CONTEXT_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1CONTEXT_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	CERT_CONTEXT _arg0, *lparg0=NULL;
@@ -10026,9 +10059,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1INFO_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1INFO_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1INFO_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1INFO_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1INFO_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1INFO_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	CERT_INFO _arg0, *lparg0=NULL;
@@ -10051,9 +10084,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEA_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEA_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEA_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEA_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEA_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEA_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	DEVMODEA _arg0, *lparg0=NULL;
@@ -10076,9 +10109,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEW_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	DEVMODEW _arg0, *lparg0=NULL;
@@ -10101,9 +10134,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	DOCHOSTUIINFO _arg0, *lparg0=NULL;
@@ -10126,9 +10159,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DRAWITEMSTRUCT_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DRAWITEMSTRUCT_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DRAWITEMSTRUCT_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DRAWITEMSTRUCT_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DRAWITEMSTRUCT_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DRAWITEMSTRUCT_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	DRAWITEMSTRUCT _arg0, *lparg0=NULL;
@@ -10151,9 +10184,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_EMREXTCREATEFONTINDIRECTW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_EMREXTCREATEFONTINDIRECTW_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EMREXTCREATEFONTINDIRECTW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EMREXTCREATEFONTINDIRECTW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EMREXTCREATEFONTINDIRECTW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EMREXTCREATEFONTINDIRECTW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	EMREXTCREATEFONTINDIRECTW _arg0, *lparg0=NULL;
@@ -10176,9 +10209,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_EMR_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_EMR_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EMR_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EMR_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EMR_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EMR_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	EMR _arg0, *lparg0=NULL;
@@ -10201,9 +10234,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_EXTLOGPEN_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_EXTLOGPEN_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EXTLOGPEN_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EXTLOGPEN_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EXTLOGPEN_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EXTLOGPEN_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	EXTLOGPEN _arg0, *lparg0=NULL;
@@ -10226,9 +10259,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1DATA_2_3II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1DATA_2_3JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1DATA_2_3II)(JNIEnv *env, jclass that, jobject arg0, jintLongArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1DATA_2_3II)(JNIEnv *env, jclass that, jobject arg0, jintLongArray arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1DATA_2_3JI)(JNIEnv *env, jclass that, jobject arg0, jintLongArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1DATA_2_3JI)(JNIEnv *env, jclass that, jobject arg0, jintLongArray arg1, jint arg2)
 #endif
 {
 	FLICK_DATA _arg0, *lparg0=NULL;
@@ -10254,9 +10287,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1POINT_2_3II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1POINT_2_3JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1POINT_2_3II)(JNIEnv *env, jclass that, jobject arg0, jintLongArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1POINT_2_3II)(JNIEnv *env, jclass that, jobject arg0, jintLongArray arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1POINT_2_3JI)(JNIEnv *env, jclass that, jobject arg0, jintLongArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1POINT_2_3JI)(JNIEnv *env, jclass that, jobject arg0, jintLongArray arg1, jint arg2)
 #endif
 {
 	FLICK_POINT _arg0, *lparg0=NULL;
@@ -10282,9 +10315,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_HDITEM_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_HDITEM_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_HDITEM_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_HDITEM_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_HDITEM_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_HDITEM_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	HDITEM _arg0, *lparg0=NULL;
@@ -10307,9 +10340,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_HELPINFO_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_HELPINFO_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_HELPINFO_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_HELPINFO_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_HELPINFO_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_HELPINFO_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	HELPINFO _arg0, *lparg0=NULL;
@@ -10332,9 +10365,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTA_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTA_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTA_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTA_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTA_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTA_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	LOGFONTA _arg0, *lparg0=NULL;
@@ -10357,9 +10390,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTW_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	LOGFONTW _arg0, *lparg0=NULL;
@@ -10382,9 +10415,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	MEASUREITEMSTRUCT _arg0, *lparg0=NULL;
@@ -10407,9 +10440,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_MINMAXINFO_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_MINMAXINFO_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MINMAXINFO_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MINMAXINFO_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MINMAXINFO_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MINMAXINFO_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	MINMAXINFO _arg0, *lparg0=NULL;
@@ -10432,9 +10465,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_MSG_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_MSG_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MSG_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MSG_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MSG_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MSG_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	MSG _arg0, *lparg0=NULL;
@@ -10457,9 +10490,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMCUSTOMDRAW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMCUSTOMDRAW_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMCUSTOMDRAW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMCUSTOMDRAW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMCUSTOMDRAW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMCUSTOMDRAW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMCUSTOMDRAW _arg0, *lparg0=NULL;
@@ -10482,9 +10515,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMHDR_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMHDR_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMHDR_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMHDR_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMHDR_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMHDR_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMHDR _arg0, *lparg0=NULL;
@@ -10507,9 +10540,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMHEADER_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMHEADER_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMHEADER_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMHEADER_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMHEADER_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMHEADER_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMHEADER _arg0, *lparg0=NULL;
@@ -10532,9 +10565,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLINK_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLINK_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLINK_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLINK_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLINK_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLINK_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMLINK _arg0, *lparg0=NULL;
@@ -10557,9 +10590,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLISTVIEW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLISTVIEW_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLISTVIEW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLISTVIEW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLISTVIEW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLISTVIEW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMLISTVIEW _arg0, *lparg0=NULL;
@@ -10582,9 +10615,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMLVCUSTOMDRAW _arg0, *lparg0=NULL;
@@ -10607,9 +10640,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVDISPINFO_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVDISPINFO_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVDISPINFO_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVDISPINFO_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVDISPINFO_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVDISPINFO_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMLVDISPINFO _arg0, *lparg0=NULL;
@@ -10632,9 +10665,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVFINDITEM_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVFINDITEM_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVFINDITEM_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVFINDITEM_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVFINDITEM_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVFINDITEM_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMLVFINDITEM _arg0, *lparg0=NULL;
@@ -10657,9 +10690,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVODSTATECHANGE_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVODSTATECHANGE_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVODSTATECHANGE_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVODSTATECHANGE_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVODSTATECHANGE_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVODSTATECHANGE_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMLVODSTATECHANGE _arg0, *lparg0=NULL;
@@ -10682,9 +10715,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHEVRON_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHEVRON_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHEVRON_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHEVRON_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHEVRON_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHEVRON_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMREBARCHEVRON _arg0, *lparg0=NULL;
@@ -10707,9 +10740,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHILDSIZE_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHILDSIZE_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHILDSIZE_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHILDSIZE_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHILDSIZE_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHILDSIZE_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMREBARCHILDSIZE _arg0, *lparg0=NULL;
@@ -10732,9 +10765,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMRGINFO_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMRGINFO_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMRGINFO_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMRGINFO_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMRGINFO_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMRGINFO_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMRGINFO _arg0, *lparg0=NULL;
@@ -10757,9 +10790,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTBHOTITEM_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTBHOTITEM_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTBHOTITEM_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTBHOTITEM_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTBHOTITEM_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTBHOTITEM_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMTBHOTITEM _arg0, *lparg0=NULL;
@@ -10782,9 +10815,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTOOLBAR_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTOOLBAR_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTOOLBAR_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTOOLBAR_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTOOLBAR_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTOOLBAR_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMTOOLBAR _arg0, *lparg0=NULL;
@@ -10807,9 +10840,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTREEVIEW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTREEVIEW_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTREEVIEW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTREEVIEW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTREEVIEW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTREEVIEW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMTREEVIEW _arg0, *lparg0=NULL;
@@ -10832,9 +10865,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMTTCUSTOMDRAW _arg0, *lparg0=NULL;
@@ -10857,9 +10890,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMTTDISPINFOA _arg0, *lparg0=NULL;
@@ -10882,9 +10915,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMTTDISPINFOW _arg0, *lparg0=NULL;
@@ -10907,9 +10940,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMTVCUSTOMDRAW _arg0, *lparg0=NULL;
@@ -10932,9 +10965,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVDISPINFO_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVDISPINFO_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVDISPINFO_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVDISPINFO_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVDISPINFO_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVDISPINFO_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMTVDISPINFO _arg0, *lparg0=NULL;
@@ -10957,9 +10990,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVITEMCHANGE_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVITEMCHANGE_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVITEMCHANGE_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVITEMCHANGE_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVITEMCHANGE_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVITEMCHANGE_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMTVITEMCHANGE _arg0, *lparg0=NULL;
@@ -10982,9 +11015,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMUPDOWN_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMUPDOWN_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMUPDOWN_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMUPDOWN_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMUPDOWN_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMUPDOWN_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	NMUPDOWN _arg0, *lparg0=NULL;
@@ -11007,9 +11040,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_OFNOTIFY_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_OFNOTIFY_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_OFNOTIFY_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_OFNOTIFY_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_OFNOTIFY_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_OFNOTIFY_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	OFNOTIFY _arg0, *lparg0=NULL;
@@ -11032,9 +11065,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_OPENFILENAME_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_OPENFILENAME_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_OPENFILENAME_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_OPENFILENAME_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_OPENFILENAME_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_OPENFILENAME_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	OPENFILENAME _arg0, *lparg0=NULL;
@@ -11057,9 +11090,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_POINT_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_POINT_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_POINT_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_POINT_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_POINT_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_POINT_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	POINT _arg0, *lparg0=NULL;
@@ -11081,7 +11114,7 @@ fail:
 #endif
 
 #ifndef NO_MoveMemory__Lorg_eclipse_swt_internal_win32_POINT_2_3JI
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_POINT_2_3JI)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_POINT_2_3JI)
 	(JNIEnv *env, jclass that, jobject arg0, jlongArray arg1, jint arg2)
 {
 	POINT _arg0, *lparg0=NULL;
@@ -11113,9 +11146,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_RECT_2_3II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_RECT_2_3JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_RECT_2_3II)(JNIEnv *env, jclass that, jobject arg0, jintLongArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_RECT_2_3II)(JNIEnv *env, jclass that, jobject arg0, jintLongArray arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_RECT_2_3JI)(JNIEnv *env, jclass that, jobject arg0, jintLongArray arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_RECT_2_3JI)(JNIEnv *env, jclass that, jobject arg0, jintLongArray arg1, jint arg2)
 #endif
 {
 	RECT _arg0, *lparg0=NULL;
@@ -11141,9 +11174,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SAFEARRAY_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SAFEARRAY_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SAFEARRAY_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SAFEARRAY_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SAFEARRAY_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SAFEARRAY_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	SAFEARRAY _arg0, *lparg0=NULL;
@@ -11166,9 +11199,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1ITEM_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1ITEM_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1ITEM_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1ITEM_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1ITEM_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1ITEM_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	SCRIPT_ITEM _arg0, *lparg0=NULL;
@@ -11191,9 +11224,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1LOGATTR_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1LOGATTR_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1LOGATTR_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1LOGATTR_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1LOGATTR_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1LOGATTR_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	SCRIPT_LOGATTR _arg0, *lparg0=NULL;
@@ -11216,9 +11249,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1PROPERTIES_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1PROPERTIES_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1PROPERTIES_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1PROPERTIES_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1PROPERTIES_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1PROPERTIES_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	SCRIPT_PROPERTIES _arg0, *lparg0=NULL;
@@ -11241,9 +11274,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	SHDRAGIMAGE _arg0, *lparg0=NULL;
@@ -11266,9 +11299,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICA_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICA_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICA_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICA_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICA_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICA_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	TEXTMETRICA _arg0, *lparg0=NULL;
@@ -11291,9 +11324,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICW_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICW_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICW_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	TEXTMETRICW _arg0, *lparg0=NULL;
@@ -11316,9 +11349,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TOUCHINPUT_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TOUCHINPUT_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TOUCHINPUT_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TOUCHINPUT_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TOUCHINPUT_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TOUCHINPUT_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	TOUCHINPUT _arg0, *lparg0=NULL;
@@ -11341,9 +11374,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TVITEM_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TVITEM_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TVITEM_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TVITEM_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TVITEM_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TVITEM_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	TVITEM _arg0, *lparg0=NULL;
@@ -11366,9 +11399,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_UDACCEL_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_UDACCEL_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_UDACCEL_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_UDACCEL_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_UDACCEL_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_UDACCEL_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	UDACCEL _arg0, *lparg0=NULL;
@@ -11391,9 +11424,9 @@ fail:
 
 #if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_WINDOWPOS_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_WINDOWPOS_2JI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_WINDOWPOS_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_WINDOWPOS_2II)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_WINDOWPOS_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_WINDOWPOS_2JI)(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2)
 #endif
 {
 	WINDOWPOS _arg0, *lparg0=NULL;
@@ -11416,9 +11449,9 @@ fail:
 
 #if (!defined(NO_MoveMemory___3BII) && !defined(JNI64)) || (!defined(NO_MoveMemory___3BJI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3BII)(JNIEnv *env, jclass that, jbyteArray arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3BII)(JNIEnv *env, jclass that, jbyteArray arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3BJI)(JNIEnv *env, jclass that, jbyteArray arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3BJI)(JNIEnv *env, jclass that, jbyteArray arg0, jintLong arg1, jint arg2)
 #endif
 {
 	jbyte *lparg0=NULL;
@@ -11454,7 +11487,7 @@ fail:
 #endif
 
 #ifndef NO_MoveMemory___3BLorg_eclipse_swt_internal_win32_ACCEL_2I
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3BLorg_eclipse_swt_internal_win32_ACCEL_2I)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3BLorg_eclipse_swt_internal_win32_ACCEL_2I)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jobject arg1, jint arg2)
 {
 	jbyte *lparg0=NULL;
@@ -11484,7 +11517,7 @@ fail:
 #endif
 
 #ifndef NO_MoveMemory___3BLorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2I
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3BLorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2I)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3BLorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2I)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jobject arg1, jint arg2)
 {
 	jbyte *lparg0=NULL;
@@ -11515,9 +11548,9 @@ fail:
 
 #if (!defined(NO_MoveMemory___3CII) && !defined(JNI64)) || (!defined(NO_MoveMemory___3CJI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3CII)(JNIEnv *env, jclass that, jcharArray arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3CII)(JNIEnv *env, jclass that, jcharArray arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3CJI)(JNIEnv *env, jclass that, jcharArray arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3CJI)(JNIEnv *env, jclass that, jcharArray arg0, jintLong arg1, jint arg2)
 #endif
 {
 	jchar *lparg0=NULL;
@@ -11554,9 +11587,9 @@ fail:
 
 #if (!defined(NO_MoveMemory___3DII) && !defined(JNI64)) || (!defined(NO_MoveMemory___3DJI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3DII)(JNIEnv *env, jclass that, jdoubleArray arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3DII)(JNIEnv *env, jclass that, jdoubleArray arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3DJI)(JNIEnv *env, jclass that, jdoubleArray arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3DJI)(JNIEnv *env, jclass that, jdoubleArray arg0, jintLong arg1, jint arg2)
 #endif
 {
 	jdouble *lparg0=NULL;
@@ -11593,9 +11626,9 @@ fail:
 
 #if (!defined(NO_MoveMemory___3FII) && !defined(JNI64)) || (!defined(NO_MoveMemory___3FJI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3FII)(JNIEnv *env, jclass that, jfloatArray arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3FII)(JNIEnv *env, jclass that, jfloatArray arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3FJI)(JNIEnv *env, jclass that, jfloatArray arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3FJI)(JNIEnv *env, jclass that, jfloatArray arg0, jintLong arg1, jint arg2)
 #endif
 {
 	jfloat *lparg0=NULL;
@@ -11632,9 +11665,9 @@ fail:
 
 #if (!defined(NO_MoveMemory___3III) && !defined(JNI64)) || (!defined(NO_MoveMemory___3IJI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3III)(JNIEnv *env, jclass that, jintArray arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3III)(JNIEnv *env, jclass that, jintArray arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3IJI)(JNIEnv *env, jclass that, jintArray arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3IJI)(JNIEnv *env, jclass that, jintArray arg0, jintLong arg1, jint arg2)
 #endif
 {
 	jint *lparg0=NULL;
@@ -11671,9 +11704,9 @@ fail:
 
 #if (!defined(NO_MoveMemory___3JII) && !defined(JNI64)) || (!defined(NO_MoveMemory___3JJI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3JII)(JNIEnv *env, jclass that, jlongArray arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3JII)(JNIEnv *env, jclass that, jlongArray arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3JJI)(JNIEnv *env, jclass that, jlongArray arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3JJI)(JNIEnv *env, jclass that, jlongArray arg0, jintLong arg1, jint arg2)
 #endif
 {
 	jlong *lparg0=NULL;
@@ -11710,9 +11743,9 @@ fail:
 
 #if (!defined(NO_MoveMemory___3SII) && !defined(JNI64)) || (!defined(NO_MoveMemory___3SJI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3SII)(JNIEnv *env, jclass that, jshortArray arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3SII)(JNIEnv *env, jclass that, jshortArray arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT void JNICALL OS_NATIVE(MoveMemory___3SJI)(JNIEnv *env, jclass that, jshortArray arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(MoveMemory___3SJI)(JNIEnv *env, jclass that, jshortArray arg0, jintLong arg1, jint arg2)
 #endif
 {
 	jshort *lparg0=NULL;
@@ -11748,7 +11781,7 @@ fail:
 #endif
 
 #ifndef NO_MoveToEx
-JNIEXPORT jboolean JNICALL OS_NATIVE(MoveToEx)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(MoveToEx)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jintLong arg3)
 {
 	jboolean rc = 0;
@@ -11760,7 +11793,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(MoveToEx)
 #endif
 
 #ifndef NO_MsgWaitForMultipleObjectsEx
-JNIEXPORT jint JNICALL OS_NATIVE(MsgWaitForMultipleObjectsEx)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MsgWaitForMultipleObjectsEx)
 	(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3, jint arg4)
 {
 	jint rc = 0;
@@ -11773,9 +11806,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(MsgWaitForMultipleObjectsEx)
 
 #if (!defined(NO_MultiByteToWideChar__IIII_3CI) && !defined(JNI64)) || (!defined(NO_MultiByteToWideChar__IIJI_3CI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(MultiByteToWideChar__IIII_3CI)(JNIEnv *env, jclass that, jint arg0, jint arg1, jintLong arg2, jint arg3, jcharArray arg4, jint arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MultiByteToWideChar__IIII_3CI)(JNIEnv *env, jclass that, jint arg0, jint arg1, jintLong arg2, jint arg3, jcharArray arg4, jint arg5)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(MultiByteToWideChar__IIJI_3CI)(JNIEnv *env, jclass that, jint arg0, jint arg1, jintLong arg2, jint arg3, jcharArray arg4, jint arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MultiByteToWideChar__IIJI_3CI)(JNIEnv *env, jclass that, jint arg0, jint arg1, jintLong arg2, jint arg3, jcharArray arg4, jint arg5)
 #endif
 {
 	jchar *lparg4=NULL;
@@ -11813,7 +11846,7 @@ fail:
 #endif
 
 #ifndef NO_MultiByteToWideChar__II_3BI_3CI
-JNIEXPORT jint JNICALL OS_NATIVE(MultiByteToWideChar__II_3BI_3CI)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(MultiByteToWideChar__II_3BI_3CI)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jbyteArray arg2, jint arg3, jcharArray arg4, jint arg5)
 {
 	jbyte *lparg2=NULL;
@@ -11848,7 +11881,7 @@ fail:
 #endif
 
 #ifndef NO_NMCUSTOMDRAW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMCUSTOMDRAW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMCUSTOMDRAW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -11860,7 +11893,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMCUSTOMDRAW_1sizeof)
 #endif
 
 #ifndef NO_NMHDR_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMHDR_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMHDR_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -11872,7 +11905,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMHDR_1sizeof)
 #endif
 
 #ifndef NO_NMHEADER_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMHEADER_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMHEADER_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -11884,7 +11917,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMHEADER_1sizeof)
 #endif
 
 #ifndef NO_NMLINK_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMLINK_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMLINK_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -11896,7 +11929,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMLINK_1sizeof)
 #endif
 
 #ifndef NO_NMLISTVIEW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMLISTVIEW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMLISTVIEW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -11908,7 +11941,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMLISTVIEW_1sizeof)
 #endif
 
 #ifndef NO_NMLVCUSTOMDRAW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMLVCUSTOMDRAW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMLVCUSTOMDRAW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -11920,7 +11953,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMLVCUSTOMDRAW_1sizeof)
 #endif
 
 #ifndef NO_NMLVDISPINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMLVDISPINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMLVDISPINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -11932,7 +11965,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMLVDISPINFO_1sizeof)
 #endif
 
 #ifndef NO_NMLVFINDITEM_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMLVFINDITEM_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMLVFINDITEM_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -11944,7 +11977,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMLVFINDITEM_1sizeof)
 #endif
 
 #ifndef NO_NMLVODSTATECHANGE_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMLVODSTATECHANGE_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMLVODSTATECHANGE_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -11956,7 +11989,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMLVODSTATECHANGE_1sizeof)
 #endif
 
 #ifndef NO_NMREBARCHEVRON_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMREBARCHEVRON_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMREBARCHEVRON_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -11968,7 +12001,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMREBARCHEVRON_1sizeof)
 #endif
 
 #ifndef NO_NMREBARCHILDSIZE_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMREBARCHILDSIZE_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMREBARCHILDSIZE_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -11980,7 +12013,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMREBARCHILDSIZE_1sizeof)
 #endif
 
 #ifndef NO_NMRGINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMRGINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMRGINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -11992,7 +12025,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMRGINFO_1sizeof)
 #endif
 
 #ifndef NO_NMTBHOTITEM_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMTBHOTITEM_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMTBHOTITEM_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12004,7 +12037,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMTBHOTITEM_1sizeof)
 #endif
 
 #ifndef NO_NMTOOLBAR_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMTOOLBAR_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMTOOLBAR_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12016,7 +12049,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMTOOLBAR_1sizeof)
 #endif
 
 #ifndef NO_NMTREEVIEW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMTREEVIEW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMTREEVIEW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12028,7 +12061,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMTREEVIEW_1sizeof)
 #endif
 
 #ifndef NO_NMTTCUSTOMDRAW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMTTCUSTOMDRAW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMTTCUSTOMDRAW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12040,7 +12073,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMTTCUSTOMDRAW_1sizeof)
 #endif
 
 #ifndef NO_NMTTDISPINFOA_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMTTDISPINFOA_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMTTDISPINFOA_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12052,7 +12085,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMTTDISPINFOA_1sizeof)
 #endif
 
 #ifndef NO_NMTTDISPINFOW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMTTDISPINFOW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMTTDISPINFOW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12064,7 +12097,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMTTDISPINFOW_1sizeof)
 #endif
 
 #ifndef NO_NMTVCUSTOMDRAW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMTVCUSTOMDRAW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMTVCUSTOMDRAW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12076,7 +12109,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMTVCUSTOMDRAW_1sizeof)
 #endif
 
 #ifndef NO_NMTVDISPINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMTVDISPINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMTVDISPINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12088,7 +12121,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMTVDISPINFO_1sizeof)
 #endif
 
 #ifndef NO_NMTVITEMCHANGE_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMTVITEMCHANGE_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMTVITEMCHANGE_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12100,7 +12133,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMTVITEMCHANGE_1sizeof)
 #endif
 
 #ifndef NO_NMUPDOWN_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NMUPDOWN_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NMUPDOWN_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12112,7 +12145,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NMUPDOWN_1sizeof)
 #endif
 
 #ifndef NO_NONCLIENTMETRICSA_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NONCLIENTMETRICSA_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NONCLIENTMETRICSA_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12124,7 +12157,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NONCLIENTMETRICSA_1sizeof)
 #endif
 
 #ifndef NO_NONCLIENTMETRICSW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(NONCLIENTMETRICSW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NONCLIENTMETRICSW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12136,7 +12169,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NONCLIENTMETRICSW_1sizeof)
 #endif
 
 #ifndef NO_NOTIFYICONDATAA_1V2_1SIZE
-JNIEXPORT jint JNICALL OS_NATIVE(NOTIFYICONDATAA_1V2_1SIZE)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NOTIFYICONDATAA_1V2_1SIZE)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12148,7 +12181,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NOTIFYICONDATAA_1V2_1SIZE)
 #endif
 
 #ifndef NO_NOTIFYICONDATAW_1V2_1SIZE
-JNIEXPORT jint JNICALL OS_NATIVE(NOTIFYICONDATAW_1V2_1SIZE)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(NOTIFYICONDATAW_1V2_1SIZE)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12160,7 +12193,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(NOTIFYICONDATAW_1V2_1SIZE)
 #endif
 
 #ifndef NO_NotifyWinEvent
-JNIEXPORT void JNICALL OS_NATIVE(NotifyWinEvent)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(NotifyWinEvent)
 	(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3)
 {
 	OS_NATIVE_ENTER(env, that, NotifyWinEvent_FUNC);
@@ -12178,7 +12211,7 @@ JNIEXPORT void JNICALL OS_NATIVE(NotifyWinEvent)
 #endif
 
 #ifndef NO_OFNOTIFY_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(OFNOTIFY_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(OFNOTIFY_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12190,7 +12223,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(OFNOTIFY_1sizeof)
 #endif
 
 #ifndef NO_OPENFILENAME_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(OPENFILENAME_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(OPENFILENAME_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12202,7 +12235,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(OPENFILENAME_1sizeof)
 #endif
 
 #ifndef NO_OSVERSIONINFOA_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(OSVERSIONINFOA_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(OSVERSIONINFOA_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12214,7 +12247,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(OSVERSIONINFOA_1sizeof)
 #endif
 
 #ifndef NO_OSVERSIONINFOEXA_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(OSVERSIONINFOEXA_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(OSVERSIONINFOEXA_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12226,7 +12259,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(OSVERSIONINFOEXA_1sizeof)
 #endif
 
 #ifndef NO_OSVERSIONINFOEXW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(OSVERSIONINFOEXW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(OSVERSIONINFOEXW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12238,7 +12271,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(OSVERSIONINFOEXW_1sizeof)
 #endif
 
 #ifndef NO_OSVERSIONINFOW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(OSVERSIONINFOW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(OSVERSIONINFOW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12250,7 +12283,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(OSVERSIONINFOW_1sizeof)
 #endif
 
 #ifndef NO_OUTLINETEXTMETRICA_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(OUTLINETEXTMETRICA_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(OUTLINETEXTMETRICA_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12262,7 +12295,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(OUTLINETEXTMETRICA_1sizeof)
 #endif
 
 #ifndef NO_OUTLINETEXTMETRICW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(OUTLINETEXTMETRICW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(OUTLINETEXTMETRICW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12274,7 +12307,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(OUTLINETEXTMETRICW_1sizeof)
 #endif
 
 #ifndef NO_OffsetRect
-JNIEXPORT jboolean JNICALL OS_NATIVE(OffsetRect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(OffsetRect)
 	(JNIEnv *env, jclass that, jobject arg0, jint arg1, jint arg2)
 {
 	RECT _arg0, *lparg0=NULL;
@@ -12290,7 +12323,7 @@ fail:
 #endif
 
 #ifndef NO_OffsetRgn
-JNIEXPORT jint JNICALL OS_NATIVE(OffsetRgn)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(OffsetRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jint rc = 0;
@@ -12302,7 +12335,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(OffsetRgn)
 #endif
 
 #ifndef NO_OleInitialize
-JNIEXPORT jint JNICALL OS_NATIVE(OleInitialize)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(OleInitialize)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -12314,7 +12347,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(OleInitialize)
 #endif
 
 #ifndef NO_OleUninitialize
-JNIEXPORT void JNICALL OS_NATIVE(OleUninitialize)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(OleUninitialize)
 	(JNIEnv *env, jclass that)
 {
 	OS_NATIVE_ENTER(env, that, OleUninitialize_FUNC);
@@ -12324,7 +12357,7 @@ JNIEXPORT void JNICALL OS_NATIVE(OleUninitialize)
 #endif
 
 #ifndef NO_OpenClipboard
-JNIEXPORT jboolean JNICALL OS_NATIVE(OpenClipboard)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(OpenClipboard)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -12336,7 +12369,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(OpenClipboard)
 #endif
 
 #ifndef NO_OpenPrinterA
-JNIEXPORT jboolean JNICALL OS_NATIVE(OpenPrinterA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(OpenPrinterA)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jintLongArray arg1, jintLong arg2)
 {
 	jbyte *lparg0=NULL;
@@ -12355,7 +12388,7 @@ fail:
 #endif
 
 #ifndef NO_OpenPrinterW
-JNIEXPORT jboolean JNICALL OS_NATIVE(OpenPrinterW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(OpenPrinterW)
 	(JNIEnv *env, jclass that, jcharArray arg0, jintLongArray arg1, jintLong arg2)
 {
 	jchar *lparg0=NULL;
@@ -12374,7 +12407,7 @@ fail:
 #endif
 
 #ifndef NO_OpenProcess
-JNIEXPORT jintLong JNICALL OS_NATIVE(OpenProcess)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(OpenProcess)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1, jint arg2)
 {
 	jintLong rc = 0;
@@ -12386,7 +12419,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(OpenProcess)
 #endif
 
 #ifndef NO_OpenThemeData
-JNIEXPORT jintLong JNICALL OS_NATIVE(OpenThemeData)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(OpenThemeData)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1)
 {
 	jchar *lparg1=NULL;
@@ -12403,14 +12436,14 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(OpenThemeData)
 		}
 	}
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, OpenThemeData_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_PAINTSTRUCT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(PAINTSTRUCT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(PAINTSTRUCT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12422,7 +12455,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PAINTSTRUCT_1sizeof)
 #endif
 
 #ifndef NO_PANOSE_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(PANOSE_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(PANOSE_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12434,7 +12467,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PANOSE_1sizeof)
 #endif
 
 #ifndef NO_POINTSTOPOINT
-JNIEXPORT void JNICALL OS_NATIVE(POINTSTOPOINT)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(POINTSTOPOINT)
 	(JNIEnv *env, jclass that, jobject arg0, jintLong arg1)
 {
 	POINT _arg0, *lparg0=NULL;
@@ -12448,7 +12481,7 @@ fail:
 #endif
 
 #ifndef NO_POINT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(POINT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(POINT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12460,7 +12493,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(POINT_1sizeof)
 #endif
 
 #ifndef NO_PRIMARYLANGID
-JNIEXPORT jshort JNICALL OS_NATIVE(PRIMARYLANGID)
+SWT_NATIVE_EXPORT jshort JNICALL OS_NATIVE(PRIMARYLANGID)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jshort rc = 0;
@@ -12472,7 +12505,7 @@ JNIEXPORT jshort JNICALL OS_NATIVE(PRIMARYLANGID)
 #endif
 
 #ifndef NO_PRINTDLG_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(PRINTDLG_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(PRINTDLG_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12484,7 +12517,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PRINTDLG_1sizeof)
 #endif
 
 #ifndef NO_PROCESS_1INFORMATION_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(PROCESS_1INFORMATION_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(PROCESS_1INFORMATION_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12496,7 +12529,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PROCESS_1INFORMATION_1sizeof)
 #endif
 
 #ifndef NO_PROPERTYKEY_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(PROPERTYKEY_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(PROPERTYKEY_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12508,7 +12541,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PROPERTYKEY_1sizeof)
 #endif
 
 #ifndef NO_PROPVARIANT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(PROPVARIANT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(PROPVARIANT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12520,7 +12553,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PROPVARIANT_1sizeof)
 #endif
 
 #ifndef NO_PSPropertyKeyFromString
-JNIEXPORT jint JNICALL OS_NATIVE(PSPropertyKeyFromString)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(PSPropertyKeyFromString)
 	(JNIEnv *env, jclass that, jcharArray arg0, jobject arg1)
 {
 	jchar *lparg0=NULL;
@@ -12547,7 +12580,7 @@ fail:
 #endif
 
 #ifndef NO_PatBlt
-JNIEXPORT jboolean JNICALL OS_NATIVE(PatBlt)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(PatBlt)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5)
 {
 	jboolean rc = 0;
@@ -12559,7 +12592,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(PatBlt)
 #endif
 
 #ifndef NO_PathIsExe
-JNIEXPORT jboolean JNICALL OS_NATIVE(PathIsExe)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(PathIsExe)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -12571,7 +12604,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(PathIsExe)
 #endif
 
 #ifndef NO_PeekMessageA
-JNIEXPORT jboolean JNICALL OS_NATIVE(PeekMessageA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(PeekMessageA)
 	(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2, jint arg3, jint arg4)
 {
 	MSG _arg0, *lparg0=NULL;
@@ -12587,7 +12620,7 @@ fail:
 #endif
 
 #ifndef NO_PeekMessageW
-JNIEXPORT jboolean JNICALL OS_NATIVE(PeekMessageW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(PeekMessageW)
 	(JNIEnv *env, jclass that, jobject arg0, jintLong arg1, jint arg2, jint arg3, jint arg4)
 {
 	MSG _arg0, *lparg0=NULL;
@@ -12603,7 +12636,7 @@ fail:
 #endif
 
 #ifndef NO_Pie
-JNIEXPORT jboolean JNICALL OS_NATIVE(Pie)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(Pie)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6, jint arg7, jint arg8)
 {
 	jboolean rc = 0;
@@ -12615,7 +12648,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Pie)
 #endif
 
 #ifndef NO_Polygon
-JNIEXPORT jboolean JNICALL OS_NATIVE(Polygon)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(Polygon)
 	(JNIEnv *env, jclass that, jintLong arg0, jintArray arg1, jint arg2)
 {
 	jint *lparg1=NULL;
@@ -12645,7 +12678,7 @@ fail:
 #endif
 
 #ifndef NO_Polyline
-JNIEXPORT jboolean JNICALL OS_NATIVE(Polyline)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(Polyline)
 	(JNIEnv *env, jclass that, jintLong arg0, jintArray arg1, jint arg2)
 {
 	jint *lparg1=NULL;
@@ -12675,7 +12708,7 @@ fail:
 #endif
 
 #ifndef NO_PostMessageA
-JNIEXPORT jboolean JNICALL OS_NATIVE(PostMessageA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(PostMessageA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
 {
 	jboolean rc = 0;
@@ -12687,7 +12720,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(PostMessageA)
 #endif
 
 #ifndef NO_PostMessageW
-JNIEXPORT jboolean JNICALL OS_NATIVE(PostMessageW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(PostMessageW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
 {
 	jboolean rc = 0;
@@ -12699,7 +12732,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(PostMessageW)
 #endif
 
 #ifndef NO_PostThreadMessageA
-JNIEXPORT jboolean JNICALL OS_NATIVE(PostThreadMessageA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(PostThreadMessageA)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jintLong arg2, jintLong arg3)
 {
 	jboolean rc = 0;
@@ -12711,7 +12744,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(PostThreadMessageA)
 #endif
 
 #ifndef NO_PostThreadMessageW
-JNIEXPORT jboolean JNICALL OS_NATIVE(PostThreadMessageW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(PostThreadMessageW)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jintLong arg2, jintLong arg3)
 {
 	jboolean rc = 0;
@@ -12723,7 +12756,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(PostThreadMessageW)
 #endif
 
 #ifndef NO_PrintDlgA
-JNIEXPORT jboolean JNICALL OS_NATIVE(PrintDlgA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(PrintDlgA)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	PRINTDLG _arg0, *lparg0=NULL;
@@ -12739,7 +12772,7 @@ fail:
 #endif
 
 #ifndef NO_PrintDlgW
-JNIEXPORT jboolean JNICALL OS_NATIVE(PrintDlgW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(PrintDlgW)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	PRINTDLG _arg0, *lparg0=NULL;
@@ -12755,7 +12788,7 @@ fail:
 #endif
 
 #ifndef NO_PrintWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(PrintWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(PrintWindow)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2)
 {
 	jboolean rc = 0;
@@ -12775,7 +12808,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(PrintWindow)
 #endif
 
 #ifndef NO_PtInRect
-JNIEXPORT jboolean JNICALL OS_NATIVE(PtInRect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(PtInRect)
 	(JNIEnv *env, jclass that, jobject arg0, jobject arg1)
 {
 	RECT _arg0, *lparg0=NULL;
@@ -12792,7 +12825,7 @@ fail:
 #endif
 
 #ifndef NO_PtInRegion
-JNIEXPORT jboolean JNICALL OS_NATIVE(PtInRegion)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(PtInRegion)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jboolean rc = 0;
@@ -12804,7 +12837,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(PtInRegion)
 #endif
 
 #ifndef NO_REBARBANDINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(REBARBANDINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(REBARBANDINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12816,7 +12849,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(REBARBANDINFO_1sizeof)
 #endif
 
 #ifndef NO_RECT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(RECT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RECT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -12828,7 +12861,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(RECT_1sizeof)
 #endif
 
 #ifndef NO_RealizePalette
-JNIEXPORT jint JNICALL OS_NATIVE(RealizePalette)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RealizePalette)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -12840,7 +12873,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(RealizePalette)
 #endif
 
 #ifndef NO_RectInRegion
-JNIEXPORT jboolean JNICALL OS_NATIVE(RectInRegion)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(RectInRegion)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -12855,7 +12888,7 @@ fail:
 #endif
 
 #ifndef NO_Rectangle
-JNIEXPORT jboolean JNICALL OS_NATIVE(Rectangle)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(Rectangle)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4)
 {
 	jboolean rc = 0;
@@ -12867,7 +12900,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Rectangle)
 #endif
 
 #ifndef NO_RedrawWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(RedrawWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(RedrawWindow)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1, jintLong arg2, jint arg3)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -12883,7 +12916,7 @@ fail:
 #endif
 
 #ifndef NO_RegCloseKey
-JNIEXPORT jint JNICALL OS_NATIVE(RegCloseKey)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegCloseKey)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -12895,7 +12928,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(RegCloseKey)
 #endif
 
 #ifndef NO_RegCreateKeyExA
-JNIEXPORT jint JNICALL OS_NATIVE(RegCreateKeyExA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegCreateKeyExA)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jbyteArray arg3, jint arg4, jint arg5, jintLong arg6, jintLongArray arg7, jintLongArray arg8)
 {
 	jbyte *lparg1=NULL;
@@ -12920,7 +12953,7 @@ fail:
 #endif
 
 #ifndef NO_RegCreateKeyExW
-JNIEXPORT jint JNICALL OS_NATIVE(RegCreateKeyExW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegCreateKeyExW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jcharArray arg3, jint arg4, jint arg5, jintLong arg6, jintLongArray arg7, jintLongArray arg8)
 {
 	jchar *lparg1=NULL;
@@ -12945,7 +12978,7 @@ fail:
 #endif
 
 #ifndef NO_RegDeleteValueA
-JNIEXPORT jint JNICALL OS_NATIVE(RegDeleteValueA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegDeleteValueA)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1)
 {
 	jbyte *lparg1=NULL;
@@ -12961,7 +12994,7 @@ fail:
 #endif
 
 #ifndef NO_RegDeleteValueW
-JNIEXPORT jint JNICALL OS_NATIVE(RegDeleteValueW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegDeleteValueW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1)
 {
 	jchar *lparg1=NULL;
@@ -12977,7 +13010,7 @@ fail:
 #endif
 
 #ifndef NO_RegEnumKeyExA
-JNIEXPORT jint JNICALL OS_NATIVE(RegEnumKeyExA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegEnumKeyExA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jbyteArray arg2, jintArray arg3, jintArray arg4, jbyteArray arg5, jintArray arg6, jobject arg7)
 {
 	jbyte *lparg2=NULL;
@@ -13008,7 +13041,7 @@ fail:
 #endif
 
 #ifndef NO_RegEnumKeyExW
-JNIEXPORT jint JNICALL OS_NATIVE(RegEnumKeyExW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegEnumKeyExW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jcharArray arg2, jintArray arg3, jintArray arg4, jcharArray arg5, jintArray arg6, jobject arg7)
 {
 	jchar *lparg2=NULL;
@@ -13039,7 +13072,7 @@ fail:
 #endif
 
 #ifndef NO_RegOpenKeyExA
-JNIEXPORT jint JNICALL OS_NATIVE(RegOpenKeyExA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegOpenKeyExA)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jint arg3, jintLongArray arg4)
 {
 	jbyte *lparg1=NULL;
@@ -13058,7 +13091,7 @@ fail:
 #endif
 
 #ifndef NO_RegOpenKeyExW
-JNIEXPORT jint JNICALL OS_NATIVE(RegOpenKeyExW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegOpenKeyExW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jint arg3, jintLongArray arg4)
 {
 	jchar *lparg1=NULL;
@@ -13077,7 +13110,7 @@ fail:
 #endif
 
 #ifndef NO_RegQueryInfoKeyA
-JNIEXPORT jint JNICALL OS_NATIVE(RegQueryInfoKeyA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegQueryInfoKeyA)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintArray arg2, jintLong arg3, jintArray arg4, jintArray arg5, jintArray arg6, jintArray arg7, jintArray arg8, jintArray arg9, jintArray arg10, jintLong arg11)
 {
 	jint *lparg2=NULL;
@@ -13114,7 +13147,7 @@ fail:
 #endif
 
 #ifndef NO_RegQueryInfoKeyW
-JNIEXPORT jint JNICALL OS_NATIVE(RegQueryInfoKeyW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegQueryInfoKeyW)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintArray arg2, jintLong arg3, jintArray arg4, jintArray arg5, jintArray arg6, jintArray arg7, jintArray arg8, jintArray arg9, jintArray arg10, jintLong arg11)
 {
 	jint *lparg2=NULL;
@@ -13152,9 +13185,9 @@ fail:
 
 #if (!defined(NO_RegQueryValueExA__I_3BI_3I_3B_3I) && !defined(JNI64)) || (!defined(NO_RegQueryValueExA__J_3BJ_3I_3B_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(RegQueryValueExA__I_3BI_3I_3B_3I)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jintLong arg2, jintArray arg3, jbyteArray arg4, jintArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegQueryValueExA__I_3BI_3I_3B_3I)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jintLong arg2, jintArray arg3, jbyteArray arg4, jintArray arg5)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(RegQueryValueExA__J_3BJ_3I_3B_3I)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jintLong arg2, jintArray arg3, jbyteArray arg4, jintArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegQueryValueExA__J_3BJ_3I_3B_3I)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jintLong arg2, jintArray arg3, jbyteArray arg4, jintArray arg5)
 #endif
 {
 	jbyte *lparg1=NULL;
@@ -13188,9 +13221,9 @@ fail:
 
 #if (!defined(NO_RegQueryValueExA__I_3BI_3I_3I_3I) && !defined(JNI64)) || (!defined(NO_RegQueryValueExA__J_3BJ_3I_3I_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(RegQueryValueExA__I_3BI_3I_3I_3I)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jintLong arg2, jintArray arg3, jintArray arg4, jintArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegQueryValueExA__I_3BI_3I_3I_3I)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jintLong arg2, jintArray arg3, jintArray arg4, jintArray arg5)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(RegQueryValueExA__J_3BJ_3I_3I_3I)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jintLong arg2, jintArray arg3, jintArray arg4, jintArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegQueryValueExA__J_3BJ_3I_3I_3I)(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jintLong arg2, jintArray arg3, jintArray arg4, jintArray arg5)
 #endif
 {
 	jbyte *lparg1=NULL;
@@ -13224,9 +13257,9 @@ fail:
 
 #if (!defined(NO_RegQueryValueExW__I_3CI_3I_3C_3I) && !defined(JNI64)) || (!defined(NO_RegQueryValueExW__J_3CJ_3I_3C_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(RegQueryValueExW__I_3CI_3I_3C_3I)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jintLong arg2, jintArray arg3, jcharArray arg4, jintArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegQueryValueExW__I_3CI_3I_3C_3I)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jintLong arg2, jintArray arg3, jcharArray arg4, jintArray arg5)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(RegQueryValueExW__J_3CJ_3I_3C_3I)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jintLong arg2, jintArray arg3, jcharArray arg4, jintArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegQueryValueExW__J_3CJ_3I_3C_3I)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jintLong arg2, jintArray arg3, jcharArray arg4, jintArray arg5)
 #endif
 {
 	jchar *lparg1=NULL;
@@ -13260,9 +13293,9 @@ fail:
 
 #if (!defined(NO_RegQueryValueExW__I_3CI_3I_3I_3I) && !defined(JNI64)) || (!defined(NO_RegQueryValueExW__J_3CJ_3I_3I_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(RegQueryValueExW__I_3CI_3I_3I_3I)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jintLong arg2, jintArray arg3, jintArray arg4, jintArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegQueryValueExW__I_3CI_3I_3I_3I)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jintLong arg2, jintArray arg3, jintArray arg4, jintArray arg5)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(RegQueryValueExW__J_3CJ_3I_3I_3I)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jintLong arg2, jintArray arg3, jintArray arg4, jintArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegQueryValueExW__J_3CJ_3I_3I_3I)(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jintLong arg2, jintArray arg3, jintArray arg4, jintArray arg5)
 #endif
 {
 	jchar *lparg1=NULL;
@@ -13295,7 +13328,7 @@ fail:
 #endif
 
 #ifndef NO_RegSetValueExA
-JNIEXPORT jint JNICALL OS_NATIVE(RegSetValueExA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegSetValueExA)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2, jint arg3, jintArray arg4, jint arg5)
 {
 	jbyte *lparg1=NULL;
@@ -13306,7 +13339,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(RegSetValueExA)
 	if (arg4) if ((lparg4 = (*env)->GetIntArrayElements(env, arg4, NULL)) == NULL) goto fail;
 	rc = (jint)RegSetValueExA((HKEY)arg0, (LPSTR)lparg1, arg2, arg3, (const BYTE*)lparg4, arg5);
 fail:
-	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
+	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, JNI_ABORT);
 	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
 	OS_NATIVE_EXIT(env, that, RegSetValueExA_FUNC);
 	return rc;
@@ -13314,7 +13347,7 @@ fail:
 #endif
 
 #ifndef NO_RegSetValueExW
-JNIEXPORT jint JNICALL OS_NATIVE(RegSetValueExW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegSetValueExW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jint arg3, jintArray arg4, jint arg5)
 {
 	jchar *lparg1=NULL;
@@ -13325,7 +13358,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(RegSetValueExW)
 	if (arg4) if ((lparg4 = (*env)->GetIntArrayElements(env, arg4, NULL)) == NULL) goto fail;
 	rc = (jint)RegSetValueExW((HKEY)arg0, (LPWSTR)lparg1, arg2, arg3, (const BYTE*)lparg4, arg5);
 fail:
-	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
+	if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, JNI_ABORT);
 	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, 0);
 	OS_NATIVE_EXIT(env, that, RegSetValueExW_FUNC);
 	return rc;
@@ -13333,7 +13366,7 @@ fail:
 #endif
 
 #ifndef NO_RegisterClassA
-JNIEXPORT jint JNICALL OS_NATIVE(RegisterClassA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegisterClassA)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	WNDCLASS _arg0, *lparg0=NULL;
@@ -13349,7 +13382,7 @@ fail:
 #endif
 
 #ifndef NO_RegisterClassW
-JNIEXPORT jint JNICALL OS_NATIVE(RegisterClassW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegisterClassW)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	WNDCLASS _arg0, *lparg0=NULL;
@@ -13365,7 +13398,7 @@ fail:
 #endif
 
 #ifndef NO_RegisterClipboardFormatA
-JNIEXPORT jint JNICALL OS_NATIVE(RegisterClipboardFormatA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegisterClipboardFormatA)
 	(JNIEnv *env, jclass that, jbyteArray arg0)
 {
 	jbyte *lparg0=NULL;
@@ -13381,7 +13414,7 @@ fail:
 #endif
 
 #ifndef NO_RegisterClipboardFormatW
-JNIEXPORT jint JNICALL OS_NATIVE(RegisterClipboardFormatW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegisterClipboardFormatW)
 	(JNIEnv *env, jclass that, jcharArray arg0)
 {
 	jchar *lparg0=NULL;
@@ -13397,7 +13430,7 @@ fail:
 #endif
 
 #ifndef NO_RegisterTouchWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(RegisterTouchWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(RegisterTouchWindow)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jboolean rc = 0;
@@ -13417,7 +13450,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(RegisterTouchWindow)
 #endif
 
 #ifndef NO_RegisterWindowMessageA
-JNIEXPORT jint JNICALL OS_NATIVE(RegisterWindowMessageA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegisterWindowMessageA)
 	(JNIEnv *env, jclass that, jbyteArray arg0)
 {
 	jbyte *lparg0=NULL;
@@ -13433,7 +13466,7 @@ fail:
 #endif
 
 #ifndef NO_RegisterWindowMessageW
-JNIEXPORT jint JNICALL OS_NATIVE(RegisterWindowMessageW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(RegisterWindowMessageW)
 	(JNIEnv *env, jclass that, jcharArray arg0)
 {
 	jchar *lparg0=NULL;
@@ -13449,7 +13482,7 @@ fail:
 #endif
 
 #ifndef NO_ReleaseCapture
-JNIEXPORT jboolean JNICALL OS_NATIVE(ReleaseCapture)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ReleaseCapture)
 	(JNIEnv *env, jclass that)
 {
 	jboolean rc = 0;
@@ -13461,7 +13494,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ReleaseCapture)
 #endif
 
 #ifndef NO_ReleaseDC
-JNIEXPORT jint JNICALL OS_NATIVE(ReleaseDC)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ReleaseDC)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jint rc = 0;
@@ -13473,7 +13506,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ReleaseDC)
 #endif
 
 #ifndef NO_RemoveMenu
-JNIEXPORT jboolean JNICALL OS_NATIVE(RemoveMenu)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(RemoveMenu)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jboolean rc = 0;
@@ -13485,7 +13518,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(RemoveMenu)
 #endif
 
 #ifndef NO_RemovePropA
-JNIEXPORT jintLong JNICALL OS_NATIVE(RemovePropA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(RemovePropA)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -13497,7 +13530,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(RemovePropA)
 #endif
 
 #ifndef NO_RemovePropW
-JNIEXPORT jintLong JNICALL OS_NATIVE(RemovePropW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(RemovePropW)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -13509,7 +13542,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(RemovePropW)
 #endif
 
 #ifndef NO_ReplyMessage
-JNIEXPORT jboolean JNICALL OS_NATIVE(ReplyMessage)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ReplyMessage)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -13521,7 +13554,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ReplyMessage)
 #endif
 
 #ifndef NO_RestoreDC
-JNIEXPORT jboolean JNICALL OS_NATIVE(RestoreDC)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(RestoreDC)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jboolean rc = 0;
@@ -13533,7 +13566,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(RestoreDC)
 #endif
 
 #ifndef NO_RoundRect
-JNIEXPORT jboolean JNICALL OS_NATIVE(RoundRect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(RoundRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6)
 {
 	jboolean rc = 0;
@@ -13545,7 +13578,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(RoundRect)
 #endif
 
 #ifndef NO_SAFEARRAYBOUND_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SAFEARRAYBOUND_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SAFEARRAYBOUND_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13557,7 +13590,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SAFEARRAYBOUND_1sizeof)
 #endif
 
 #ifndef NO_SAFEARRAY_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SAFEARRAY_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SAFEARRAY_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13569,7 +13602,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SAFEARRAY_1sizeof)
 #endif
 
 #ifndef NO_SCRIPT_1ANALYSIS_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1ANALYSIS_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SCRIPT_1ANALYSIS_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13581,7 +13614,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1ANALYSIS_1sizeof)
 #endif
 
 #ifndef NO_SCRIPT_1CONTROL_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1CONTROL_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SCRIPT_1CONTROL_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13593,7 +13626,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1CONTROL_1sizeof)
 #endif
 
 #ifndef NO_SCRIPT_1DIGITSUBSTITUTE_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1DIGITSUBSTITUTE_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SCRIPT_1DIGITSUBSTITUTE_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13605,7 +13638,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1DIGITSUBSTITUTE_1sizeof)
 #endif
 
 #ifndef NO_SCRIPT_1FONTPROPERTIES_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1FONTPROPERTIES_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SCRIPT_1FONTPROPERTIES_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13617,7 +13650,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1FONTPROPERTIES_1sizeof)
 #endif
 
 #ifndef NO_SCRIPT_1ITEM_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1ITEM_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SCRIPT_1ITEM_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13629,7 +13662,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1ITEM_1sizeof)
 #endif
 
 #ifndef NO_SCRIPT_1LOGATTR_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1LOGATTR_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SCRIPT_1LOGATTR_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13641,7 +13674,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1LOGATTR_1sizeof)
 #endif
 
 #ifndef NO_SCRIPT_1PROPERTIES_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1PROPERTIES_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SCRIPT_1PROPERTIES_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13653,7 +13686,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1PROPERTIES_1sizeof)
 #endif
 
 #ifndef NO_SCRIPT_1STATE_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1STATE_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SCRIPT_1STATE_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13665,7 +13698,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1STATE_1sizeof)
 #endif
 
 #ifndef NO_SCRIPT_1STRING_1ANALYSIS_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1STRING_1ANALYSIS_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SCRIPT_1STRING_1ANALYSIS_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13677,7 +13710,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SCRIPT_1STRING_1ANALYSIS_1sizeof)
 #endif
 
 #ifndef NO_SCROLLBARINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SCROLLBARINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SCROLLBARINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13689,7 +13722,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SCROLLBARINFO_1sizeof)
 #endif
 
 #ifndef NO_SCROLLINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SCROLLINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SCROLLINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13701,7 +13734,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SCROLLINFO_1sizeof)
 #endif
 
 #ifndef NO_SHACTIVATEINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SHACTIVATEINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SHACTIVATEINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13713,7 +13746,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SHACTIVATEINFO_1sizeof)
 #endif
 
 #ifndef NO_SHBrowseForFolderA
-JNIEXPORT jintLong JNICALL OS_NATIVE(SHBrowseForFolderA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SHBrowseForFolderA)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	BROWSEINFO _arg0, *lparg0=NULL;
@@ -13729,7 +13762,7 @@ fail:
 #endif
 
 #ifndef NO_SHBrowseForFolderW
-JNIEXPORT jintLong JNICALL OS_NATIVE(SHBrowseForFolderW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SHBrowseForFolderW)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	BROWSEINFO _arg0, *lparg0=NULL;
@@ -13745,7 +13778,7 @@ fail:
 #endif
 
 #ifndef NO_SHCreateItemFromRelativeName
-JNIEXPORT jint JNICALL OS_NATIVE(SHCreateItemFromRelativeName)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SHCreateItemFromRelativeName)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jintLong arg2, jbyteArray arg3, jintLongArray arg4)
 {
 	jchar *lparg1=NULL;
@@ -13775,7 +13808,7 @@ fail:
 #endif
 
 #ifndef NO_SHCreateItemInKnownFolder
-JNIEXPORT jint JNICALL OS_NATIVE(SHCreateItemInKnownFolder)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SHCreateItemInKnownFolder)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jcharArray arg2, jbyteArray arg3, jintLongArray arg4)
 {
 	jbyte *lparg0=NULL;
@@ -13808,7 +13841,7 @@ fail:
 #endif
 
 #ifndef NO_SHCreateMenuBar
-JNIEXPORT jboolean JNICALL OS_NATIVE(SHCreateMenuBar)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SHCreateMenuBar)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	SHMENUBARINFO _arg0, *lparg0=NULL;
@@ -13824,7 +13857,7 @@ fail:
 #endif
 
 #ifndef NO_SHDRAGIMAGE_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SHDRAGIMAGE_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SHDRAGIMAGE_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13836,7 +13869,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SHDRAGIMAGE_1sizeof)
 #endif
 
 #ifndef NO_SHELLEXECUTEINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SHELLEXECUTEINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SHELLEXECUTEINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13848,7 +13881,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SHELLEXECUTEINFO_1sizeof)
 #endif
 
 #ifndef NO_SHFILEINFOA_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SHFILEINFOA_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SHFILEINFOA_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13860,7 +13893,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SHFILEINFOA_1sizeof)
 #endif
 
 #ifndef NO_SHFILEINFOW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SHFILEINFOW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SHFILEINFOW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -13872,7 +13905,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SHFILEINFOW_1sizeof)
 #endif
 
 #ifndef NO_SHGetFileInfoA
-JNIEXPORT jintLong JNICALL OS_NATIVE(SHGetFileInfoA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SHGetFileInfoA)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jobject arg2, jint arg3, jint arg4)
 {
 	jbyte *lparg0=NULL;
@@ -13884,14 +13917,14 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SHGetFileInfoA)
 	rc = (jintLong)SHGetFileInfoA((LPCSTR)lparg0, arg1, (SHFILEINFOA *)lparg2, arg3, arg4);
 fail:
 	if (arg2 && lparg2) setSHFILEINFOAFields(env, arg2, lparg2);
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, SHGetFileInfoA_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_SHGetFileInfoW
-JNIEXPORT jintLong JNICALL OS_NATIVE(SHGetFileInfoW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SHGetFileInfoW)
 	(JNIEnv *env, jclass that, jcharArray arg0, jint arg1, jobject arg2, jint arg3, jint arg4)
 {
 	jchar *lparg0=NULL;
@@ -13903,14 +13936,14 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SHGetFileInfoW)
 	rc = (jintLong)SHGetFileInfoW((LPCWSTR)lparg0, arg1, (SHFILEINFOW *)lparg2, arg3, arg4);
 fail:
 	if (arg2 && lparg2) setSHFILEINFOWFields(env, arg2, lparg2);
-	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, SHGetFileInfoW_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_SHGetFolderPathA
-JNIEXPORT jint JNICALL OS_NATIVE(SHGetFolderPathA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SHGetFolderPathA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jint arg3, jbyteArray arg4)
 {
 	jbyte *lparg4=NULL;
@@ -13926,7 +13959,7 @@ fail:
 #endif
 
 #ifndef NO_SHGetFolderPathW
-JNIEXPORT jint JNICALL OS_NATIVE(SHGetFolderPathW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SHGetFolderPathW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jint arg3, jcharArray arg4)
 {
 	jchar *lparg4=NULL;
@@ -13942,7 +13975,7 @@ fail:
 #endif
 
 #ifndef NO_SHGetMalloc
-JNIEXPORT jint JNICALL OS_NATIVE(SHGetMalloc)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SHGetMalloc)
 	(JNIEnv *env, jclass that, jintLongArray arg0)
 {
 	jintLong *lparg0=NULL;
@@ -13958,7 +13991,7 @@ fail:
 #endif
 
 #ifndef NO_SHGetPathFromIDListA
-JNIEXPORT jboolean JNICALL OS_NATIVE(SHGetPathFromIDListA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SHGetPathFromIDListA)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1)
 {
 	jbyte *lparg1=NULL;
@@ -13974,7 +14007,7 @@ fail:
 #endif
 
 #ifndef NO_SHGetPathFromIDListW
-JNIEXPORT jboolean JNICALL OS_NATIVE(SHGetPathFromIDListW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SHGetPathFromIDListW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1)
 {
 	jchar *lparg1=NULL;
@@ -13990,7 +14023,7 @@ fail:
 #endif
 
 #ifndef NO_SHHandleWMSettingChange
-JNIEXPORT jboolean JNICALL OS_NATIVE(SHHandleWMSettingChange)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SHHandleWMSettingChange)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jobject arg3)
 {
 	SHACTIVATEINFO _arg3, *lparg3=NULL;
@@ -14006,7 +14039,7 @@ fail:
 #endif
 
 #ifndef NO_SHMENUBARINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SHMENUBARINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SHMENUBARINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -14018,7 +14051,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SHMENUBARINFO_1sizeof)
 #endif
 
 #ifndef NO_SHRGINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SHRGINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SHRGINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -14030,7 +14063,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SHRGINFO_1sizeof)
 #endif
 
 #ifndef NO_SHRecognizeGesture
-JNIEXPORT jint JNICALL OS_NATIVE(SHRecognizeGesture)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SHRecognizeGesture)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	SHRGINFO _arg0, *lparg0=NULL;
@@ -14046,7 +14079,7 @@ fail:
 #endif
 
 #ifndef NO_SHSendBackToFocusWindow
-JNIEXPORT void JNICALL OS_NATIVE(SHSendBackToFocusWindow)
+SWT_NATIVE_EXPORT void JNICALL OS_NATIVE(SHSendBackToFocusWindow)
 	(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintLong arg2)
 {
 	OS_NATIVE_ENTER(env, that, SHSendBackToFocusWindow_FUNC);
@@ -14056,7 +14089,7 @@ JNIEXPORT void JNICALL OS_NATIVE(SHSendBackToFocusWindow)
 #endif
 
 #ifndef NO_SHSetAppKeyWndAssoc
-JNIEXPORT jboolean JNICALL OS_NATIVE(SHSetAppKeyWndAssoc)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SHSetAppKeyWndAssoc)
 	(JNIEnv *env, jclass that, jbyte arg0, jintLong arg1)
 {
 	jboolean rc = 0;
@@ -14068,7 +14101,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(SHSetAppKeyWndAssoc)
 #endif
 
 #ifndef NO_SHSipPreference
-JNIEXPORT jboolean JNICALL OS_NATIVE(SHSipPreference)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SHSipPreference)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jboolean rc = 0;
@@ -14080,7 +14113,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(SHSipPreference)
 #endif
 
 #ifndef NO_SIPINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SIPINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SIPINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -14092,7 +14125,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SIPINFO_1sizeof)
 #endif
 
 #ifndef NO_SIZE_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SIZE_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SIZE_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -14104,7 +14137,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SIZE_1sizeof)
 #endif
 
 #ifndef NO_STARTUPINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(STARTUPINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(STARTUPINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -14116,7 +14149,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(STARTUPINFO_1sizeof)
 #endif
 
 #ifndef NO_SYSTEMTIME_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(SYSTEMTIME_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SYSTEMTIME_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -14128,7 +14161,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SYSTEMTIME_1sizeof)
 #endif
 
 #ifndef NO_SaveDC
-JNIEXPORT jint JNICALL OS_NATIVE(SaveDC)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SaveDC)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -14140,7 +14173,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SaveDC)
 #endif
 
 #ifndef NO_ScreenToClient
-JNIEXPORT jboolean JNICALL OS_NATIVE(ScreenToClient)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ScreenToClient)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	POINT _arg1, *lparg1=NULL;
@@ -14156,7 +14189,7 @@ fail:
 #endif
 
 #ifndef NO_ScriptApplyDigitSubstitution
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptApplyDigitSubstitution)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptApplyDigitSubstitution)
 	(JNIEnv *env, jclass that, jobject arg0, jobject arg1, jobject arg2)
 {
 	SCRIPT_DIGITSUBSTITUTE _arg0, *lparg0=NULL;
@@ -14171,14 +14204,13 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScriptApplyDigitSubstitution)
 fail:
 	if (arg2 && lparg2) setSCRIPT_STATEFields(env, arg2, lparg2);
 	if (arg1 && lparg1) setSCRIPT_CONTROLFields(env, arg1, lparg1);
-	if (arg0 && lparg0) setSCRIPT_DIGITSUBSTITUTEFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, ScriptApplyDigitSubstitution_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_ScriptBreak
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptBreak)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptBreak)
 	(JNIEnv *env, jclass that, jcharArray arg0, jint arg1, jobject arg2, jintLong arg3)
 {
 	jchar *lparg0=NULL;
@@ -14189,15 +14221,14 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScriptBreak)
 	if (arg2) if ((lparg2 = getSCRIPT_ANALYSISFields(env, arg2, &_arg2)) == NULL) goto fail;
 	rc = (jint)ScriptBreak((const WCHAR *)lparg0, arg1, (const SCRIPT_ANALYSIS *)lparg2, (SCRIPT_LOGATTR *)arg3);
 fail:
-	if (arg2 && lparg2) setSCRIPT_ANALYSISFields(env, arg2, lparg2);
-	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, ScriptBreak_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_ScriptCPtoX
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptCPtoX)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptCPtoX)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1, jint arg2, jint arg3, jintLong arg4, jintLong arg5, jintLong arg6, jobject arg7, jintArray arg8)
 {
 	SCRIPT_ANALYSIS _arg7, *lparg7=NULL;
@@ -14209,14 +14240,13 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScriptCPtoX)
 	rc = (jint)ScriptCPtoX(arg0, arg1, arg2, arg3, (const WORD *)arg4, (const SCRIPT_VISATTR *)arg5, (const int *)arg6, (const SCRIPT_ANALYSIS *)lparg7, (int *)lparg8);
 fail:
 	if (arg8 && lparg8) (*env)->ReleaseIntArrayElements(env, arg8, lparg8, 0);
-	if (arg7 && lparg7) setSCRIPT_ANALYSISFields(env, arg7, lparg7);
 	OS_NATIVE_EXIT(env, that, ScriptCPtoX_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_ScriptCacheGetHeight
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptCacheGetHeight)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptCacheGetHeight)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintArray arg2)
 {
 	jint *lparg2=NULL;
@@ -14232,7 +14262,7 @@ fail:
 #endif
 
 #ifndef NO_ScriptFreeCache
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptFreeCache)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptFreeCache)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -14244,7 +14274,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScriptFreeCache)
 #endif
 
 #ifndef NO_ScriptGetCMap
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptGetCMap)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptGetCMap)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jcharArray arg2, jint arg3, jint arg4, jshortArray arg5)
 {
 	jchar *lparg2=NULL;
@@ -14256,14 +14286,14 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScriptGetCMap)
 	rc = (jint)ScriptGetCMap((HDC)arg0, (SCRIPT_CACHE *)arg1, (const WCHAR *)lparg2, arg3, arg4, (WORD*)lparg5);
 fail:
 	if (arg5 && lparg5) (*env)->ReleaseShortArrayElements(env, arg5, lparg5, 0);
-	if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, 0);
+	if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, ScriptGetCMap_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_ScriptGetFontProperties
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptGetFontProperties)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptGetFontProperties)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 {
 	SCRIPT_FONTPROPERTIES _arg2, *lparg2=NULL;
@@ -14279,7 +14309,7 @@ fail:
 #endif
 
 #ifndef NO_ScriptGetLogicalWidths
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptGetLogicalWidths)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptGetLogicalWidths)
 	(JNIEnv *env, jclass that, jobject arg0, jint arg1, jint arg2, jintLong arg3, jintLong arg4, jintLong arg5, jintArray arg6)
 {
 	SCRIPT_ANALYSIS _arg0, *lparg0=NULL;
@@ -14291,14 +14321,13 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScriptGetLogicalWidths)
 	rc = (jint)ScriptGetLogicalWidths((const SCRIPT_ANALYSIS *)lparg0, arg1, arg2, (const int *)arg3, (const WORD *)arg4, (const SCRIPT_VISATTR *)arg5, (int *)lparg6);
 fail:
 	if (arg6 && lparg6) (*env)->ReleaseIntArrayElements(env, arg6, lparg6, 0);
-	if (arg0 && lparg0) setSCRIPT_ANALYSISFields(env, arg0, lparg0);
 	OS_NATIVE_EXIT(env, that, ScriptGetLogicalWidths_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_ScriptGetProperties
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptGetProperties)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptGetProperties)
 	(JNIEnv *env, jclass that, jintLongArray arg0, jintArray arg1)
 {
 	jintLong *lparg0=NULL;
@@ -14317,7 +14346,7 @@ fail:
 #endif
 
 #ifndef NO_ScriptItemize
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptItemize)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptItemize)
 	(JNIEnv *env, jclass that, jcharArray arg0, jint arg1, jint arg2, jobject arg3, jobject arg4, jintLong arg5, jintArray arg6)
 {
 	jchar *lparg0=NULL;
@@ -14333,16 +14362,14 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScriptItemize)
 	rc = (jint)ScriptItemize((const WCHAR *)lparg0, arg1, arg2, (const SCRIPT_CONTROL *)lparg3, (const SCRIPT_STATE *)lparg4, (SCRIPT_ITEM *)arg5, (int *)lparg6);
 fail:
 	if (arg6 && lparg6) (*env)->ReleaseIntArrayElements(env, arg6, lparg6, 0);
-	if (arg4 && lparg4) setSCRIPT_STATEFields(env, arg4, lparg4);
-	if (arg3 && lparg3) setSCRIPT_CONTROLFields(env, arg3, lparg3);
-	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, ScriptItemize_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_ScriptJustify
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptJustify)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptJustify)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jintLong arg5)
 {
 	jint rc = 0;
@@ -14354,7 +14381,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScriptJustify)
 #endif
 
 #ifndef NO_ScriptLayout
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptLayout)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptLayout)
 	(JNIEnv *env, jclass that, jint arg0, jbyteArray arg1, jintArray arg2, jintArray arg3)
 {
 	jbyte *lparg1=NULL;
@@ -14369,14 +14396,14 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScriptLayout)
 fail:
 	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
 	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, 0);
-	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, ScriptLayout_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_ScriptPlace
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptPlace)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptPlace)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2, jint arg3, jintLong arg4, jobject arg5, jintLong arg6, jintLong arg7, jintArray arg8)
 {
 	SCRIPT_ANALYSIS _arg5, *lparg5=NULL;
@@ -14395,7 +14422,7 @@ fail:
 #endif
 
 #ifndef NO_ScriptRecordDigitSubstitution
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptRecordDigitSubstitution)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptRecordDigitSubstitution)
 	(JNIEnv *env, jclass that, jint arg0, jobject arg1)
 {
 	SCRIPT_DIGITSUBSTITUTE _arg1, *lparg1=NULL;
@@ -14411,7 +14438,7 @@ fail:
 #endif
 
 #ifndef NO_ScriptShape
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptShape)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptShape)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jcharArray arg2, jint arg3, jint arg4, jobject arg5, jintLong arg6, jintLong arg7, jintLong arg8, jintArray arg9)
 {
 	jchar *lparg2=NULL;
@@ -14426,14 +14453,14 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScriptShape)
 fail:
 	if (arg9 && lparg9) (*env)->ReleaseIntArrayElements(env, arg9, lparg9, 0);
 	if (arg5 && lparg5) setSCRIPT_ANALYSISFields(env, arg5, lparg5);
-	if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, 0);
+	if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, ScriptShape_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_ScriptStringAnalyse
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptStringAnalyse)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptStringAnalyse)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6, jobject arg7, jobject arg8, jintLong arg9, jintLong arg10, jintLong arg11, jintLong arg12)
 {
 	jchar *lparg1=NULL;
@@ -14448,14 +14475,14 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScriptStringAnalyse)
 fail:
 	if (arg8 && lparg8) setSCRIPT_STATEFields(env, arg8, lparg8);
 	if (arg7 && lparg7) setSCRIPT_CONTROLFields(env, arg7, lparg7);
-	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, ScriptStringAnalyse_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_ScriptStringFree
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptStringFree)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptStringFree)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -14467,7 +14494,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScriptStringFree)
 #endif
 
 #ifndef NO_ScriptStringOut
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptStringOut)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptStringOut)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jobject arg4, jint arg5, jint arg6, jboolean arg7)
 {
 	RECT _arg4, *lparg4=NULL;
@@ -14483,7 +14510,7 @@ fail:
 #endif
 
 #ifndef NO_ScriptTextOut
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptTextOut)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptTextOut)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jobject arg5, jobject arg6, jintLong arg7, jint arg8, jintLong arg9, jint arg10, jintLong arg11, jintLong arg12, jintLong arg13)
 {
 	RECT _arg5, *lparg5=NULL;
@@ -14494,15 +14521,13 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScriptTextOut)
 	if (arg6) if ((lparg6 = getSCRIPT_ANALYSISFields(env, arg6, &_arg6)) == NULL) goto fail;
 	rc = (jint)ScriptTextOut((const HDC)arg0, (SCRIPT_CACHE *)arg1, arg2, arg3, arg4, (const RECT *)lparg5, (const SCRIPT_ANALYSIS *)lparg6, (const WCHAR *)arg7, arg8, (const WORD *)arg9, arg10, (const int *)arg11, (const int *)arg12, (const GOFFSET *)arg13);
 fail:
-	if (arg6 && lparg6) setSCRIPT_ANALYSISFields(env, arg6, lparg6);
-	if (arg5 && lparg5) setRECTFields(env, arg5, lparg5);
 	OS_NATIVE_EXIT(env, that, ScriptTextOut_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_ScriptXtoCP
-JNIEXPORT jint JNICALL OS_NATIVE(ScriptXtoCP)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScriptXtoCP)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jintLong arg3, jintLong arg4, jintLong arg5, jobject arg6, jintArray arg7, jintArray arg8)
 {
 	SCRIPT_ANALYSIS _arg6, *lparg6=NULL;
@@ -14517,14 +14542,13 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScriptXtoCP)
 fail:
 	if (arg8 && lparg8) (*env)->ReleaseIntArrayElements(env, arg8, lparg8, 0);
 	if (arg7 && lparg7) (*env)->ReleaseIntArrayElements(env, arg7, lparg7, 0);
-	if (arg6 && lparg6) setSCRIPT_ANALYSISFields(env, arg6, lparg6);
 	OS_NATIVE_EXIT(env, that, ScriptXtoCP_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_ScrollWindowEx
-JNIEXPORT jint JNICALL OS_NATIVE(ScrollWindowEx)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ScrollWindowEx)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jobject arg3, jobject arg4, jintLong arg5, jobject arg6, jint arg7)
 {
 	RECT _arg3, *lparg3=NULL;
@@ -14546,7 +14570,7 @@ fail:
 #endif
 
 #ifndef NO_SelectClipRgn
-JNIEXPORT jint JNICALL OS_NATIVE(SelectClipRgn)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SelectClipRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jint rc = 0;
@@ -14558,7 +14582,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SelectClipRgn)
 #endif
 
 #ifndef NO_SelectObject
-JNIEXPORT jintLong JNICALL OS_NATIVE(SelectObject)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SelectObject)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -14570,7 +14594,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SelectObject)
 #endif
 
 #ifndef NO_SelectPalette
-JNIEXPORT jintLong JNICALL OS_NATIVE(SelectPalette)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SelectPalette)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2)
 {
 	jintLong rc = 0;
@@ -14582,7 +14606,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SelectPalette)
 #endif
 
 #ifndef NO_SendInput
-JNIEXPORT jint JNICALL OS_NATIVE(SendInput)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SendInput)
 	(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2)
 {
 	jint rc = 0;
@@ -14595,9 +14619,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(SendInput)
 
 #if (!defined(NO_SendMessageA__IIII) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIII)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIII)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJJ)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJJ)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
 #endif
 {
 	jintLong rc = 0;
@@ -14618,9 +14642,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJJ)(JNIEnv *env, jclass tha
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	BUTTON_IMAGELIST _arg3, *lparg3=NULL;
@@ -14645,9 +14669,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_HDHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_HDHITTESTINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_HDHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_HDHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_HDHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_HDHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	HDHITTESTINFO _arg3, *lparg3=NULL;
@@ -14672,9 +14696,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_HDITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_HDITEM_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_HDITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_HDITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_HDITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_HDITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	HDITEM _arg3, *lparg3=NULL;
@@ -14699,9 +14723,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_HDLAYOUT_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_HDLAYOUT_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_HDLAYOUT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_HDLAYOUT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_HDLAYOUT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_HDLAYOUT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	HDLAYOUT _arg3, *lparg3=NULL;
@@ -14726,9 +14750,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_LITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_LITEM_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_LITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_LITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_LITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_LITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	LITEM _arg3, *lparg3=NULL;
@@ -14753,9 +14777,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_LVCOLUMN_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVCOLUMN_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_LVCOLUMN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_LVCOLUMN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVCOLUMN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVCOLUMN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	LVCOLUMN _arg3, *lparg3=NULL;
@@ -14780,9 +14804,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_LVHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVHITTESTINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_LVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_LVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	LVHITTESTINFO _arg3, *lparg3=NULL;
@@ -14807,9 +14831,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_LVINSERTMARK_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVINSERTMARK_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_LVINSERTMARK_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_LVINSERTMARK_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVINSERTMARK_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVINSERTMARK_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	LVINSERTMARK _arg3, *lparg3=NULL;
@@ -14834,9 +14858,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_LVITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVITEM_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_LVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_LVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	LVITEM _arg3, *lparg3=NULL;
@@ -14861,9 +14885,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_MARGINS_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_MARGINS_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_MARGINS_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_MARGINS_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_MARGINS_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_MARGINS_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	MARGINS _arg3, *lparg3=NULL;
@@ -14888,9 +14912,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_MCHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_MCHITTESTINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_MCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_MCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_MCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_MCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	MCHITTESTINFO _arg3, *lparg3=NULL;
@@ -14915,9 +14939,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_POINT_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_POINT_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_POINT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_POINT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_POINT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_POINT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	POINT _arg3, *lparg3=NULL;
@@ -14942,9 +14966,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_REBARBANDINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_REBARBANDINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_REBARBANDINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_REBARBANDINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_REBARBANDINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_REBARBANDINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	REBARBANDINFO _arg3, *lparg3=NULL;
@@ -14969,9 +14993,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_RECT_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_RECT_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_RECT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_RECT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_RECT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_RECT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	RECT _arg3, *lparg3=NULL;
@@ -14996,9 +15020,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	SHDRAGIMAGE _arg3, *lparg3=NULL;
@@ -15023,9 +15047,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_SIZE_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_SIZE_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_SIZE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_SIZE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_SIZE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_SIZE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	SIZE _arg3, *lparg3=NULL;
@@ -15050,9 +15074,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_SYSTEMTIME_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_SYSTEMTIME_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_SYSTEMTIME_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_SYSTEMTIME_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_SYSTEMTIME_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_SYSTEMTIME_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	SYSTEMTIME _arg3, *lparg3=NULL;
@@ -15077,9 +15101,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TBBUTTONINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TBBUTTONINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TBBUTTONINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TBBUTTONINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TBBUTTONINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TBBUTTONINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TBBUTTONINFO _arg3, *lparg3=NULL;
@@ -15104,9 +15128,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TBBUTTON_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TBBUTTON_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TBBUTTON_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TBBUTTON_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TBBUTTON_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TBBUTTON_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TBBUTTON _arg3, *lparg3=NULL;
@@ -15131,9 +15155,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TCHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TCHITTESTINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TCHITTESTINFO _arg3, *lparg3=NULL;
@@ -15158,9 +15182,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TCITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TCITEM_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TCITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TCITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TCITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TCITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TCITEM _arg3, *lparg3=NULL;
@@ -15185,9 +15209,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TOOLINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TOOLINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TOOLINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TOOLINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TOOLINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TOOLINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TOOLINFO _arg3, *lparg3=NULL;
@@ -15212,9 +15236,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TVHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVHITTESTINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TVHITTESTINFO _arg3, *lparg3=NULL;
@@ -15239,9 +15263,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TVINSERTSTRUCT _arg3, *lparg3=NULL;
@@ -15266,9 +15290,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TVITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVITEM_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TVITEM _arg3, *lparg3=NULL;
@@ -15293,9 +15317,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TVSORTCB_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVSORTCB_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TVSORTCB_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TVSORTCB_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVSORTCB_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVSORTCB_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TVSORTCB _arg3, *lparg3=NULL;
@@ -15320,9 +15344,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_UDACCEL_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_UDACCEL_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_UDACCEL_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_UDACCEL_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_UDACCEL_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_UDACCEL_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	UDACCEL _arg3, *lparg3=NULL;
@@ -15347,9 +15371,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__III_3B) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJ_3B) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__III_3B)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jbyteArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__III_3B)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jbyteArray arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJ_3B)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jbyteArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJ_3B)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jbyteArray arg3)
 #endif
 {
 	jbyte *lparg3=NULL;
@@ -15374,9 +15398,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__III_3C) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJ_3C) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__III_3C)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jcharArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__III_3C)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jcharArray arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJ_3C)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jcharArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJ_3C)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jcharArray arg3)
 #endif
 {
 	jchar *lparg3=NULL;
@@ -15401,9 +15425,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__III_3I) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJ_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__III_3I)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__III_3I)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintArray arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJ_3I)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJ_3I)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintArray arg3)
 #endif
 {
 	jint *lparg3=NULL;
@@ -15428,9 +15452,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__III_3S) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJ_3S) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__III_3S)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jshortArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__III_3S)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jshortArray arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJ_3S)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jshortArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JIJ_3S)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jshortArray arg3)
 #endif
 {
 	jshort *lparg3=NULL;
@@ -15455,9 +15479,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__II_3II) && !defined(JNI64)) || (!defined(NO_SendMessageA__JI_3JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__II_3II)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLongArray arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__II_3II)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLongArray arg2, jintLong arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JI_3JJ)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLongArray arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JI_3JJ)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLongArray arg2, jintLong arg3)
 #endif
 {
 	jintLong *lparg2=NULL;
@@ -15482,9 +15506,9 @@ fail:
 
 #if (!defined(NO_SendMessageA__II_3I_3I) && !defined(JNI64)) || (!defined(NO_SendMessageA__JI_3I_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__II_3I_3I)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintArray arg2, jintArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__II_3I_3I)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintArray arg2, jintArray arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JI_3I_3I)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintArray arg2, jintArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageA__JI_3I_3I)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintArray arg2, jintArray arg3)
 #endif
 {
 	jint *lparg2=NULL;
@@ -15512,9 +15536,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIII) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIII)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIII)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJJ)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJJ)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintLong arg3)
 #endif
 {
 	jintLong rc = 0;
@@ -15535,9 +15559,9 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJJ)(JNIEnv *env, jclass tha
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	BUTTON_IMAGELIST _arg3, *lparg3=NULL;
@@ -15562,9 +15586,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_HDHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_HDHITTESTINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_HDHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_HDHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_HDHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_HDHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	HDHITTESTINFO _arg3, *lparg3=NULL;
@@ -15589,9 +15613,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_HDITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_HDITEM_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_HDITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_HDITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_HDITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_HDITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	HDITEM _arg3, *lparg3=NULL;
@@ -15616,9 +15640,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_HDLAYOUT_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_HDLAYOUT_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_HDLAYOUT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_HDLAYOUT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_HDLAYOUT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_HDLAYOUT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	HDLAYOUT _arg3, *lparg3=NULL;
@@ -15643,9 +15667,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_LITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_LITEM_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_LITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_LITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_LITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_LITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	LITEM _arg3, *lparg3=NULL;
@@ -15670,9 +15694,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_LVCOLUMN_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVCOLUMN_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_LVCOLUMN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_LVCOLUMN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVCOLUMN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVCOLUMN_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	LVCOLUMN _arg3, *lparg3=NULL;
@@ -15697,9 +15721,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_LVHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVHITTESTINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_LVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_LVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	LVHITTESTINFO _arg3, *lparg3=NULL;
@@ -15724,9 +15748,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_LVINSERTMARK_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVINSERTMARK_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_LVINSERTMARK_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_LVINSERTMARK_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVINSERTMARK_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVINSERTMARK_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	LVINSERTMARK _arg3, *lparg3=NULL;
@@ -15751,9 +15775,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_LVITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVITEM_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_LVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_LVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	LVITEM _arg3, *lparg3=NULL;
@@ -15778,9 +15802,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_MARGINS_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_MARGINS_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_MARGINS_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_MARGINS_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_MARGINS_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_MARGINS_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	MARGINS _arg3, *lparg3=NULL;
@@ -15805,9 +15829,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_MCHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_MCHITTESTINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_MCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_MCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_MCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_MCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	MCHITTESTINFO _arg3, *lparg3=NULL;
@@ -15832,9 +15856,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_POINT_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_POINT_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_POINT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_POINT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_POINT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_POINT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	POINT _arg3, *lparg3=NULL;
@@ -15859,9 +15883,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_REBARBANDINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_REBARBANDINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_REBARBANDINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_REBARBANDINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_REBARBANDINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_REBARBANDINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	REBARBANDINFO _arg3, *lparg3=NULL;
@@ -15886,9 +15910,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_RECT_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_RECT_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_RECT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_RECT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_RECT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_RECT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	RECT _arg3, *lparg3=NULL;
@@ -15913,9 +15937,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	SHDRAGIMAGE _arg3, *lparg3=NULL;
@@ -15940,9 +15964,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_SIZE_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_SIZE_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_SIZE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_SIZE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_SIZE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_SIZE_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	SIZE _arg3, *lparg3=NULL;
@@ -15967,9 +15991,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_SYSTEMTIME_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_SYSTEMTIME_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_SYSTEMTIME_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_SYSTEMTIME_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_SYSTEMTIME_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_SYSTEMTIME_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	SYSTEMTIME _arg3, *lparg3=NULL;
@@ -15994,9 +16018,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TBBUTTONINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TBBUTTONINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TBBUTTONINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TBBUTTONINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TBBUTTONINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TBBUTTONINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TBBUTTONINFO _arg3, *lparg3=NULL;
@@ -16021,9 +16045,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TBBUTTON_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TBBUTTON_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TBBUTTON_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TBBUTTON_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TBBUTTON_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TBBUTTON_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TBBUTTON _arg3, *lparg3=NULL;
@@ -16048,9 +16072,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TCHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TCHITTESTINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TCHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TCHITTESTINFO _arg3, *lparg3=NULL;
@@ -16075,9 +16099,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TCITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TCITEM_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TCITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TCITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TCITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TCITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TCITEM _arg3, *lparg3=NULL;
@@ -16102,9 +16126,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TOOLINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TOOLINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TOOLINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TOOLINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TOOLINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TOOLINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TOOLINFO _arg3, *lparg3=NULL;
@@ -16129,9 +16153,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TVHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVHITTESTINFO_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVHITTESTINFO_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TVHITTESTINFO _arg3, *lparg3=NULL;
@@ -16156,9 +16180,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TVINSERTSTRUCT _arg3, *lparg3=NULL;
@@ -16183,9 +16207,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TVITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVITEM_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVITEM_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TVITEM _arg3, *lparg3=NULL;
@@ -16210,9 +16234,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TVSORTCB_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVSORTCB_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TVSORTCB_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TVSORTCB_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVSORTCB_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVSORTCB_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	TVSORTCB _arg3, *lparg3=NULL;
@@ -16237,9 +16261,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_UDACCEL_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_UDACCEL_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_UDACCEL_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_UDACCEL_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_UDACCEL_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_UDACCEL_2)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jobject arg3)
 #endif
 {
 	UDACCEL _arg3, *lparg3=NULL;
@@ -16264,9 +16288,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__III_3C) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJ_3C) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__III_3C)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jcharArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__III_3C)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jcharArray arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJ_3C)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jcharArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJ_3C)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jcharArray arg3)
 #endif
 {
 	jchar *lparg3=NULL;
@@ -16291,9 +16315,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__III_3I) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJ_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__III_3I)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__III_3I)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintArray arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJ_3I)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJ_3I)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jintArray arg3)
 #endif
 {
 	jint *lparg3=NULL;
@@ -16318,9 +16342,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__III_3S) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJ_3S) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__III_3S)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jshortArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__III_3S)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jshortArray arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJ_3S)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jshortArray arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JIJ_3S)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2, jshortArray arg3)
 #endif
 {
 	jshort *lparg3=NULL;
@@ -16345,9 +16369,9 @@ fail:
 
 #if (!defined(NO_SendMessageW__II_3II) && !defined(JNI64)) || (!defined(NO_SendMessageW__JI_3JJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__II_3II)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLongArray arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__II_3II)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLongArray arg2, jintLong arg3)
 #else
-JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JI_3JJ)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLongArray arg2, jintLong arg3)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JI_3JJ)(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLongArray arg2, jintLong arg3)
 #endif
 {
 	jintLong *lparg2=NULL;
@@ -16371,7 +16395,7 @@ fail:
 #endif
 
 #ifndef NO_SetActiveWindow
-JNIEXPORT jintLong JNICALL OS_NATIVE(SetActiveWindow)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SetActiveWindow)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -16383,7 +16407,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SetActiveWindow)
 #endif
 
 #ifndef NO_SetBkColor
-JNIEXPORT jint JNICALL OS_NATIVE(SetBkColor)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetBkColor)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -16395,7 +16419,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetBkColor)
 #endif
 
 #ifndef NO_SetBkMode
-JNIEXPORT jint JNICALL OS_NATIVE(SetBkMode)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetBkMode)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -16407,7 +16431,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetBkMode)
 #endif
 
 #ifndef NO_SetBrushOrgEx
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetBrushOrgEx)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetBrushOrgEx)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jobject arg3)
 {
 	POINT _arg3, *lparg3=NULL;
@@ -16423,7 +16447,7 @@ fail:
 #endif
 
 #ifndef NO_SetCapture
-JNIEXPORT jintLong JNICALL OS_NATIVE(SetCapture)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SetCapture)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -16435,7 +16459,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SetCapture)
 #endif
 
 #ifndef NO_SetCaretPos
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetCaretPos)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetCaretPos)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	jboolean rc = 0;
@@ -16447,7 +16471,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(SetCaretPos)
 #endif
 
 #ifndef NO_SetClipboardData
-JNIEXPORT jintLong JNICALL OS_NATIVE(SetClipboardData)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SetClipboardData)
 	(JNIEnv *env, jclass that, jint arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -16459,7 +16483,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SetClipboardData)
 #endif
 
 #ifndef NO_SetCurrentProcessExplicitAppUserModelID
-JNIEXPORT jint JNICALL OS_NATIVE(SetCurrentProcessExplicitAppUserModelID)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetCurrentProcessExplicitAppUserModelID)
 	(JNIEnv *env, jclass that, jcharArray arg0)
 {
 	jchar *lparg0=NULL;
@@ -16483,7 +16507,7 @@ fail:
 #endif
 
 #ifndef NO_SetCursor
-JNIEXPORT jintLong JNICALL OS_NATIVE(SetCursor)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SetCursor)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -16495,7 +16519,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SetCursor)
 #endif
 
 #ifndef NO_SetCursorPos
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetCursorPos)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetCursorPos)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	jboolean rc = 0;
@@ -16507,7 +16531,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(SetCursorPos)
 #endif
 
 #ifndef NO_SetDIBColorTable
-JNIEXPORT jint JNICALL OS_NATIVE(SetDIBColorTable)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetDIBColorTable)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jbyteArray arg3)
 {
 	jbyte *lparg3=NULL;
@@ -16537,7 +16561,7 @@ fail:
 #endif
 
 #ifndef NO_SetDllDirectoryA
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetDllDirectoryA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetDllDirectoryA)
 	(JNIEnv *env, jclass that, jbyteArray arg0)
 {
 	jbyte *lparg0=NULL;
@@ -16561,7 +16585,7 @@ fail:
 #endif
 
 #ifndef NO_SetDllDirectoryW
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetDllDirectoryW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetDllDirectoryW)
 	(JNIEnv *env, jclass that, jcharArray arg0)
 {
 	jchar *lparg0=NULL;
@@ -16585,7 +16609,7 @@ fail:
 #endif
 
 #ifndef NO_SetErrorMode
-JNIEXPORT jint JNICALL OS_NATIVE(SetErrorMode)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetErrorMode)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	jint rc = 0;
@@ -16597,7 +16621,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetErrorMode)
 #endif
 
 #ifndef NO_SetFocus
-JNIEXPORT jintLong JNICALL OS_NATIVE(SetFocus)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SetFocus)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -16609,7 +16633,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SetFocus)
 #endif
 
 #ifndef NO_SetForegroundWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetForegroundWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetForegroundWindow)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -16621,7 +16645,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(SetForegroundWindow)
 #endif
 
 #ifndef NO_SetGestureConfig
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetGestureConfig)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetGestureConfig)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jintLong arg3, jint arg4)
 {
 	jboolean rc = 0;
@@ -16641,7 +16665,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(SetGestureConfig)
 #endif
 
 #ifndef NO_SetGraphicsMode
-JNIEXPORT jint JNICALL OS_NATIVE(SetGraphicsMode)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetGraphicsMode)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -16653,7 +16677,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetGraphicsMode)
 #endif
 
 #ifndef NO_SetLayeredWindowAttributes
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetLayeredWindowAttributes)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetLayeredWindowAttributes)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jbyte arg2, jint arg3)
 {
 	jboolean rc = 0;
@@ -16673,7 +16697,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(SetLayeredWindowAttributes)
 #endif
 
 #ifndef NO_SetLayout
-JNIEXPORT jint JNICALL OS_NATIVE(SetLayout)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetLayout)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -16693,7 +16717,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetLayout)
 #endif
 
 #ifndef NO_SetMapMode
-JNIEXPORT jint JNICALL OS_NATIVE(SetMapMode)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetMapMode)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -16705,7 +16729,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetMapMode)
 #endif
 
 #ifndef NO_SetMapperFlags
-JNIEXPORT jint JNICALL OS_NATIVE(SetMapperFlags)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetMapperFlags)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -16717,7 +16741,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetMapperFlags)
 #endif
 
 #ifndef NO_SetMenu
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetMenu)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetMenu)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jboolean rc = 0;
@@ -16729,7 +16753,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(SetMenu)
 #endif
 
 #ifndef NO_SetMenuDefaultItem
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetMenuDefaultItem)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetMenuDefaultItem)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jboolean rc = 0;
@@ -16741,7 +16765,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(SetMenuDefaultItem)
 #endif
 
 #ifndef NO_SetMenuInfo
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetMenuInfo)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetMenuInfo)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	MENUINFO _arg1, *lparg1=NULL;
@@ -16765,7 +16789,7 @@ fail:
 #endif
 
 #ifndef NO_SetMenuItemInfoA
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetMenuItemInfoA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetMenuItemInfoA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jboolean arg2, jobject arg3)
 {
 	MENUITEMINFO _arg3, *lparg3=NULL;
@@ -16781,7 +16805,7 @@ fail:
 #endif
 
 #ifndef NO_SetMenuItemInfoW
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetMenuItemInfoW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetMenuItemInfoW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jboolean arg2, jobject arg3)
 {
 	MENUITEMINFO _arg3, *lparg3=NULL;
@@ -16797,7 +16821,7 @@ fail:
 #endif
 
 #ifndef NO_SetMetaRgn
-JNIEXPORT jint JNICALL OS_NATIVE(SetMetaRgn)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetMetaRgn)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -16809,7 +16833,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetMetaRgn)
 #endif
 
 #ifndef NO_SetPaletteEntries
-JNIEXPORT jint JNICALL OS_NATIVE(SetPaletteEntries)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetPaletteEntries)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jbyteArray arg3)
 {
 	jbyte *lparg3=NULL;
@@ -16839,7 +16863,7 @@ fail:
 #endif
 
 #ifndef NO_SetParent
-JNIEXPORT jintLong JNICALL OS_NATIVE(SetParent)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SetParent)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
 {
 	jintLong rc = 0;
@@ -16851,7 +16875,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SetParent)
 #endif
 
 #ifndef NO_SetPixel
-JNIEXPORT jint JNICALL OS_NATIVE(SetPixel)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetPixel)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3)
 {
 	jint rc = 0;
@@ -16863,7 +16887,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetPixel)
 #endif
 
 #ifndef NO_SetPolyFillMode
-JNIEXPORT jint JNICALL OS_NATIVE(SetPolyFillMode)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetPolyFillMode)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -16875,7 +16899,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetPolyFillMode)
 #endif
 
 #ifndef NO_SetProcessDPIAware
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetProcessDPIAware)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetProcessDPIAware)
 	(JNIEnv *env, jclass that)
 {
 	jboolean rc = 0;
@@ -16895,7 +16919,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(SetProcessDPIAware)
 #endif
 
 #ifndef NO_SetPropA
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetPropA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetPropA)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 {
 	jboolean rc = 0;
@@ -16907,7 +16931,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(SetPropA)
 #endif
 
 #ifndef NO_SetPropW
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetPropW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetPropW)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
 {
 	jboolean rc = 0;
@@ -16919,7 +16943,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(SetPropW)
 #endif
 
 #ifndef NO_SetROP2
-JNIEXPORT jint JNICALL OS_NATIVE(SetROP2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetROP2)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -16931,7 +16955,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetROP2)
 #endif
 
 #ifndef NO_SetRect
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetRect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetRect)
 	(JNIEnv *env, jclass that, jobject arg0, jint arg1, jint arg2, jint arg3, jint arg4)
 {
 	RECT _arg0, *lparg0=NULL;
@@ -16947,7 +16971,7 @@ fail:
 #endif
 
 #ifndef NO_SetRectRgn
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetRectRgn)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetRectRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4)
 {
 	jboolean rc = 0;
@@ -16959,7 +16983,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(SetRectRgn)
 #endif
 
 #ifndef NO_SetScrollInfo
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetScrollInfo)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetScrollInfo)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jobject arg2, jboolean arg3)
 {
 	SCROLLINFO _arg2, *lparg2=NULL;
@@ -16975,7 +16999,7 @@ fail:
 #endif
 
 #ifndef NO_SetStretchBltMode
-JNIEXPORT jint JNICALL OS_NATIVE(SetStretchBltMode)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetStretchBltMode)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -16987,7 +17011,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetStretchBltMode)
 #endif
 
 #ifndef NO_SetTextAlign
-JNIEXPORT jint JNICALL OS_NATIVE(SetTextAlign)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetTextAlign)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -16999,7 +17023,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetTextAlign)
 #endif
 
 #ifndef NO_SetTextColor
-JNIEXPORT jint JNICALL OS_NATIVE(SetTextColor)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetTextColor)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jint rc = 0;
@@ -17011,7 +17035,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetTextColor)
 #endif
 
 #ifndef NO_SetTimer
-JNIEXPORT jintLong JNICALL OS_NATIVE(SetTimer)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SetTimer)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jintLong arg3)
 {
 	jintLong rc = 0;
@@ -17023,7 +17047,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SetTimer)
 #endif
 
 #ifndef NO_SetViewportExtEx
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetViewportExtEx)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetViewportExtEx)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jobject arg3)
 {
 	SIZE _arg3, *lparg3=NULL;
@@ -17039,7 +17063,7 @@ fail:
 #endif
 
 #ifndef NO_SetViewportOrgEx
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetViewportOrgEx)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetViewportOrgEx)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jobject arg3)
 {
 	POINT _arg3, *lparg3=NULL;
@@ -17055,7 +17079,7 @@ fail:
 #endif
 
 #ifndef NO_SetWindowExtEx
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetWindowExtEx)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetWindowExtEx)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jobject arg3)
 {
 	SIZE _arg3, *lparg3=NULL;
@@ -17071,7 +17095,7 @@ fail:
 #endif
 
 #ifndef NO_SetWindowLongA
-JNIEXPORT jint JNICALL OS_NATIVE(SetWindowLongA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetWindowLongA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jint rc = 0;
@@ -17083,7 +17107,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetWindowLongA)
 #endif
 
 #ifndef NO_SetWindowLongPtrA
-JNIEXPORT jintLong JNICALL OS_NATIVE(SetWindowLongPtrA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SetWindowLongPtrA)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
 {
 	jintLong rc = 0;
@@ -17095,7 +17119,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SetWindowLongPtrA)
 #endif
 
 #ifndef NO_SetWindowLongPtrW
-JNIEXPORT jintLong JNICALL OS_NATIVE(SetWindowLongPtrW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SetWindowLongPtrW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jintLong arg2)
 {
 	jintLong rc = 0;
@@ -17107,7 +17131,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SetWindowLongPtrW)
 #endif
 
 #ifndef NO_SetWindowLongW
-JNIEXPORT jint JNICALL OS_NATIVE(SetWindowLongW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetWindowLongW)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2)
 {
 	jint rc = 0;
@@ -17119,7 +17143,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetWindowLongW)
 #endif
 
 #ifndef NO_SetWindowOrgEx
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetWindowOrgEx)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetWindowOrgEx)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jobject arg3)
 {
 	POINT _arg3, *lparg3=NULL;
@@ -17135,7 +17159,7 @@ fail:
 #endif
 
 #ifndef NO_SetWindowPlacement
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetWindowPlacement)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetWindowPlacement)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	WINDOWPLACEMENT _arg1, *lparg1=NULL;
@@ -17151,7 +17175,7 @@ fail:
 #endif
 
 #ifndef NO_SetWindowPos
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetWindowPos)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetWindowPos)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6)
 {
 	jboolean rc = 0;
@@ -17163,7 +17187,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(SetWindowPos)
 #endif
 
 #ifndef NO_SetWindowRgn
-JNIEXPORT jint JNICALL OS_NATIVE(SetWindowRgn)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetWindowRgn)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2)
 {
 	jint rc = 0;
@@ -17175,7 +17199,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetWindowRgn)
 #endif
 
 #ifndef NO_SetWindowTextA
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetWindowTextA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetWindowTextA)
 	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1)
 {
 	jbyte *lparg1=NULL;
@@ -17191,7 +17215,7 @@ fail:
 #endif
 
 #ifndef NO_SetWindowTextW
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetWindowTextW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetWindowTextW)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1)
 {
 	jchar *lparg1=NULL;
@@ -17207,7 +17231,7 @@ fail:
 #endif
 
 #ifndef NO_SetWindowTheme
-JNIEXPORT jint JNICALL OS_NATIVE(SetWindowTheme)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(SetWindowTheme)
 	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jcharArray arg2)
 {
 	jchar *lparg1=NULL;
@@ -17226,15 +17250,15 @@ JNIEXPORT jint JNICALL OS_NATIVE(SetWindowTheme)
 		}
 	}
 fail:
-	if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, 0);
-	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, 0);
+	if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, JNI_ABORT);
+	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, SetWindowTheme_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_SetWindowsHookExA
-JNIEXPORT jintLong JNICALL OS_NATIVE(SetWindowsHookExA)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SetWindowsHookExA)
 	(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintLong arg2, jint arg3)
 {
 	jintLong rc = 0;
@@ -17246,7 +17270,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SetWindowsHookExA)
 #endif
 
 #ifndef NO_SetWindowsHookExW
-JNIEXPORT jintLong JNICALL OS_NATIVE(SetWindowsHookExW)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(SetWindowsHookExW)
 	(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintLong arg2, jint arg3)
 {
 	jintLong rc = 0;
@@ -17258,7 +17282,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(SetWindowsHookExW)
 #endif
 
 #ifndef NO_SetWorldTransform
-JNIEXPORT jboolean JNICALL OS_NATIVE(SetWorldTransform)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SetWorldTransform)
 	(JNIEnv *env, jclass that, jintLong arg0, jfloatArray arg1)
 {
 	jfloat *lparg1=NULL;
@@ -17274,7 +17298,7 @@ fail:
 #endif
 
 #ifndef NO_ShellExecuteExA
-JNIEXPORT jboolean JNICALL OS_NATIVE(ShellExecuteExA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ShellExecuteExA)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	SHELLEXECUTEINFO _arg0, *lparg0=NULL;
@@ -17290,7 +17314,7 @@ fail:
 #endif
 
 #ifndef NO_ShellExecuteExW
-JNIEXPORT jboolean JNICALL OS_NATIVE(ShellExecuteExW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ShellExecuteExW)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	SHELLEXECUTEINFO _arg0, *lparg0=NULL;
@@ -17306,7 +17330,7 @@ fail:
 #endif
 
 #ifndef NO_Shell_1NotifyIconA
-JNIEXPORT jboolean JNICALL OS_NATIVE(Shell_1NotifyIconA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(Shell_1NotifyIconA)
 	(JNIEnv *env, jclass that, jint arg0, jobject arg1)
 {
 	NOTIFYICONDATAA _arg1, *lparg1=NULL;
@@ -17322,7 +17346,7 @@ fail:
 #endif
 
 #ifndef NO_Shell_1NotifyIconW
-JNIEXPORT jboolean JNICALL OS_NATIVE(Shell_1NotifyIconW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(Shell_1NotifyIconW)
 	(JNIEnv *env, jclass that, jint arg0, jobject arg1)
 {
 	NOTIFYICONDATAW _arg1, *lparg1=NULL;
@@ -17338,7 +17362,7 @@ fail:
 #endif
 
 #ifndef NO_ShowCaret
-JNIEXPORT jboolean JNICALL OS_NATIVE(ShowCaret)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ShowCaret)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -17350,7 +17374,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ShowCaret)
 #endif
 
 #ifndef NO_ShowCursor
-JNIEXPORT jint JNICALL OS_NATIVE(ShowCursor)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ShowCursor)
 	(JNIEnv *env, jclass that, jboolean arg0)
 {
 	jint rc = 0;
@@ -17362,7 +17386,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ShowCursor)
 #endif
 
 #ifndef NO_ShowOwnedPopups
-JNIEXPORT jboolean JNICALL OS_NATIVE(ShowOwnedPopups)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ShowOwnedPopups)
 	(JNIEnv *env, jclass that, jintLong arg0, jboolean arg1)
 {
 	jboolean rc = 0;
@@ -17374,7 +17398,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ShowOwnedPopups)
 #endif
 
 #ifndef NO_ShowScrollBar
-JNIEXPORT jboolean JNICALL OS_NATIVE(ShowScrollBar)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ShowScrollBar)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jboolean arg2)
 {
 	jboolean rc = 0;
@@ -17386,7 +17410,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ShowScrollBar)
 #endif
 
 #ifndef NO_ShowWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(ShowWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ShowWindow)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
 {
 	jboolean rc = 0;
@@ -17398,7 +17422,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ShowWindow)
 #endif
 
 #ifndef NO_SipGetInfo
-JNIEXPORT jboolean JNICALL OS_NATIVE(SipGetInfo)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SipGetInfo)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	SIPINFO _arg0, *lparg0=NULL;
@@ -17414,7 +17438,7 @@ fail:
 #endif
 
 #ifndef NO_StartDocA
-JNIEXPORT jint JNICALL OS_NATIVE(StartDocA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(StartDocA)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	DOCINFO _arg1, *lparg1=NULL;
@@ -17430,7 +17454,7 @@ fail:
 #endif
 
 #ifndef NO_StartDocW
-JNIEXPORT jint JNICALL OS_NATIVE(StartDocW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(StartDocW)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	DOCINFO _arg1, *lparg1=NULL;
@@ -17446,7 +17470,7 @@ fail:
 #endif
 
 #ifndef NO_StartPage
-JNIEXPORT jint JNICALL OS_NATIVE(StartPage)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(StartPage)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jint rc = 0;
@@ -17458,7 +17482,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(StartPage)
 #endif
 
 #ifndef NO_StretchBlt
-JNIEXPORT jboolean JNICALL OS_NATIVE(StretchBlt)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(StretchBlt)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4, jintLong arg5, jint arg6, jint arg7, jint arg8, jint arg9, jint arg10)
 {
 	jboolean rc = 0;
@@ -17470,7 +17494,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(StretchBlt)
 #endif
 
 #ifndef NO_StrokePath
-JNIEXPORT jboolean JNICALL OS_NATIVE(StrokePath)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(StrokePath)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -17482,7 +17506,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(StrokePath)
 #endif
 
 #ifndef NO_SystemParametersInfoA__IILorg_eclipse_swt_internal_win32_HIGHCONTRAST_2I
-JNIEXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoA__IILorg_eclipse_swt_internal_win32_HIGHCONTRAST_2I)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoA__IILorg_eclipse_swt_internal_win32_HIGHCONTRAST_2I)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jobject arg2, jint arg3)
 {
 	HIGHCONTRAST _arg2, *lparg2=NULL;
@@ -17498,7 +17522,7 @@ fail:
 #endif
 
 #ifndef NO_SystemParametersInfoA__IILorg_eclipse_swt_internal_win32_NONCLIENTMETRICSA_2I
-JNIEXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoA__IILorg_eclipse_swt_internal_win32_NONCLIENTMETRICSA_2I)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoA__IILorg_eclipse_swt_internal_win32_NONCLIENTMETRICSA_2I)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jobject arg2, jint arg3)
 {
 	NONCLIENTMETRICSA _arg2, *lparg2=NULL;
@@ -17514,7 +17538,7 @@ fail:
 #endif
 
 #ifndef NO_SystemParametersInfoA__IILorg_eclipse_swt_internal_win32_RECT_2I
-JNIEXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoA__IILorg_eclipse_swt_internal_win32_RECT_2I)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoA__IILorg_eclipse_swt_internal_win32_RECT_2I)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jobject arg2, jint arg3)
 {
 	RECT _arg2, *lparg2=NULL;
@@ -17530,7 +17554,7 @@ fail:
 #endif
 
 #ifndef NO_SystemParametersInfoA__II_3II
-JNIEXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoA__II_3II)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoA__II_3II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jintArray arg2, jint arg3)
 {
 	jint *lparg2=NULL;
@@ -17546,7 +17570,7 @@ fail:
 #endif
 
 #ifndef NO_SystemParametersInfoW__IILorg_eclipse_swt_internal_win32_HIGHCONTRAST_2I
-JNIEXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoW__IILorg_eclipse_swt_internal_win32_HIGHCONTRAST_2I)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoW__IILorg_eclipse_swt_internal_win32_HIGHCONTRAST_2I)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jobject arg2, jint arg3)
 {
 	HIGHCONTRAST _arg2, *lparg2=NULL;
@@ -17562,7 +17586,7 @@ fail:
 #endif
 
 #ifndef NO_SystemParametersInfoW__IILorg_eclipse_swt_internal_win32_NONCLIENTMETRICSW_2I
-JNIEXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoW__IILorg_eclipse_swt_internal_win32_NONCLIENTMETRICSW_2I)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoW__IILorg_eclipse_swt_internal_win32_NONCLIENTMETRICSW_2I)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jobject arg2, jint arg3)
 {
 	NONCLIENTMETRICSW _arg2, *lparg2=NULL;
@@ -17578,7 +17602,7 @@ fail:
 #endif
 
 #ifndef NO_SystemParametersInfoW__IILorg_eclipse_swt_internal_win32_RECT_2I
-JNIEXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoW__IILorg_eclipse_swt_internal_win32_RECT_2I)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoW__IILorg_eclipse_swt_internal_win32_RECT_2I)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jobject arg2, jint arg3)
 {
 	RECT _arg2, *lparg2=NULL;
@@ -17594,7 +17618,7 @@ fail:
 #endif
 
 #ifndef NO_SystemParametersInfoW__II_3II
-JNIEXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoW__II_3II)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(SystemParametersInfoW__II_3II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jintArray arg2, jint arg3)
 {
 	jint *lparg2=NULL;
@@ -17610,7 +17634,7 @@ fail:
 #endif
 
 #ifndef NO_TBBUTTONINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TBBUTTONINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TBBUTTONINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17622,7 +17646,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TBBUTTONINFO_1sizeof)
 #endif
 
 #ifndef NO_TBBUTTON_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TBBUTTON_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TBBUTTON_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17634,7 +17658,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TBBUTTON_1sizeof)
 #endif
 
 #ifndef NO_TCHITTESTINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TCHITTESTINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TCHITTESTINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17646,7 +17670,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TCHITTESTINFO_1sizeof)
 #endif
 
 #ifndef NO_TCITEM_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TCITEM_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TCITEM_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17658,7 +17682,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TCITEM_1sizeof)
 #endif
 
 #ifndef NO_TEXTMETRICA_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TEXTMETRICA_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TEXTMETRICA_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17670,7 +17694,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TEXTMETRICA_1sizeof)
 #endif
 
 #ifndef NO_TEXTMETRICW_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TEXTMETRICW_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TEXTMETRICW_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17682,7 +17706,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TEXTMETRICW_1sizeof)
 #endif
 
 #ifndef NO_TF_1DA_1COLOR_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TF_1DA_1COLOR_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TF_1DA_1COLOR_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17694,7 +17718,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TF_1DA_1COLOR_1sizeof)
 #endif
 
 #ifndef NO_TF_1DISPLAYATTRIBUTE_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TF_1DISPLAYATTRIBUTE_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TF_1DISPLAYATTRIBUTE_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17706,7 +17730,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TF_1DISPLAYATTRIBUTE_1sizeof)
 #endif
 
 #ifndef NO_TOOLINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TOOLINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TOOLINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17718,7 +17742,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TOOLINFO_1sizeof)
 #endif
 
 #ifndef NO_TOUCHINPUT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TOUCHINPUT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TOUCHINPUT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17730,7 +17754,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TOUCHINPUT_1sizeof)
 #endif
 
 #ifndef NO_TOUCH_1COORD_1TO_1PIXEL
-JNIEXPORT jlong JNICALL OS_NATIVE(TOUCH_1COORD_1TO_1PIXEL)
+SWT_NATIVE_EXPORT jlong JNICALL OS_NATIVE(TOUCH_1COORD_1TO_1PIXEL)
 	(JNIEnv *env, jclass that, jlong arg0)
 {
 	jlong rc = 0;
@@ -17742,7 +17766,7 @@ JNIEXPORT jlong JNICALL OS_NATIVE(TOUCH_1COORD_1TO_1PIXEL)
 #endif
 
 #ifndef NO_TRACKMOUSEEVENT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TRACKMOUSEEVENT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TRACKMOUSEEVENT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17754,7 +17778,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TRACKMOUSEEVENT_1sizeof)
 #endif
 
 #ifndef NO_TRIVERTEX_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TRIVERTEX_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TRIVERTEX_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17766,7 +17790,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TRIVERTEX_1sizeof)
 #endif
 
 #ifndef NO_TVHITTESTINFO_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TVHITTESTINFO_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TVHITTESTINFO_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17778,7 +17802,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TVHITTESTINFO_1sizeof)
 #endif
 
 #ifndef NO_TVINSERTSTRUCT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TVINSERTSTRUCT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TVINSERTSTRUCT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17790,7 +17814,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TVINSERTSTRUCT_1sizeof)
 #endif
 
 #ifndef NO_TVITEMEX_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TVITEMEX_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TVITEMEX_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17802,7 +17826,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TVITEMEX_1sizeof)
 #endif
 
 #ifndef NO_TVITEM_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TVITEM_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TVITEM_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17814,7 +17838,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TVITEM_1sizeof)
 #endif
 
 #ifndef NO_TVSORTCB_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(TVSORTCB_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TVSORTCB_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -17826,7 +17850,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TVSORTCB_1sizeof)
 #endif
 
 #ifndef NO_ToAscii
-JNIEXPORT jint JNICALL OS_NATIVE(ToAscii)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ToAscii)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jbyteArray arg2, jshortArray arg3, jint arg4)
 {
 	jbyte *lparg2=NULL;
@@ -17845,7 +17869,7 @@ fail:
 #endif
 
 #ifndef NO_ToUnicode
-JNIEXPORT jint JNICALL OS_NATIVE(ToUnicode)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(ToUnicode)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jbyteArray arg2, jcharArray arg3, jint arg4, jint arg5)
 {
 	jbyte *lparg2=NULL;
@@ -17864,7 +17888,7 @@ fail:
 #endif
 
 #ifndef NO_TrackMouseEvent
-JNIEXPORT jboolean JNICALL OS_NATIVE(TrackMouseEvent)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(TrackMouseEvent)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	TRACKMOUSEEVENT _arg0, *lparg0=NULL;
@@ -17880,7 +17904,7 @@ fail:
 #endif
 
 #ifndef NO_TrackPopupMenu
-JNIEXPORT jboolean JNICALL OS_NATIVE(TrackPopupMenu)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(TrackPopupMenu)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4, jintLong arg5, jobject arg6)
 {
 	RECT _arg6, *lparg6=NULL;
@@ -17896,7 +17920,7 @@ fail:
 #endif
 
 #ifndef NO_TranslateAcceleratorA
-JNIEXPORT jint JNICALL OS_NATIVE(TranslateAcceleratorA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TranslateAcceleratorA)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 {
 	MSG _arg2, *lparg2=NULL;
@@ -17912,7 +17936,7 @@ fail:
 #endif
 
 #ifndef NO_TranslateAcceleratorW
-JNIEXPORT jint JNICALL OS_NATIVE(TranslateAcceleratorW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(TranslateAcceleratorW)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
 {
 	MSG _arg2, *lparg2=NULL;
@@ -17928,7 +17952,7 @@ fail:
 #endif
 
 #ifndef NO_TranslateCharsetInfo
-JNIEXPORT jboolean JNICALL OS_NATIVE(TranslateCharsetInfo)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(TranslateCharsetInfo)
 	(JNIEnv *env, jclass that, jintLong arg0, jintArray arg1, jint arg2)
 {
 	jint *lparg1=NULL;
@@ -17937,14 +17961,14 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(TranslateCharsetInfo)
 	if (arg1) if ((lparg1 = (*env)->GetIntArrayElements(env, arg1, NULL)) == NULL) goto fail;
 	rc = (jboolean)TranslateCharsetInfo((DWORD *)arg0, (LPCHARSETINFO)lparg1, arg2);
 fail:
-	if (arg1 && lparg1) (*env)->ReleaseIntArrayElements(env, arg1, lparg1, 0);
+	if (arg1 && lparg1) (*env)->ReleaseIntArrayElements(env, arg1, lparg1, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, TranslateCharsetInfo_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_TranslateMDISysAccel
-JNIEXPORT jboolean JNICALL OS_NATIVE(TranslateMDISysAccel)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(TranslateMDISysAccel)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	MSG _arg1, *lparg1=NULL;
@@ -17960,7 +17984,7 @@ fail:
 #endif
 
 #ifndef NO_TranslateMessage
-JNIEXPORT jboolean JNICALL OS_NATIVE(TranslateMessage)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(TranslateMessage)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	MSG _arg0, *lparg0=NULL;
@@ -17976,7 +18000,7 @@ fail:
 #endif
 
 #ifndef NO_TransparentBlt
-JNIEXPORT jboolean JNICALL OS_NATIVE(TransparentBlt)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(TransparentBlt)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4, jintLong arg5, jint arg6, jint arg7, jint arg8, jint arg9, jint arg10)
 {
 	jboolean rc = 0;
@@ -17996,7 +18020,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(TransparentBlt)
 #endif
 
 #ifndef NO_TransparentImage
-JNIEXPORT jboolean JNICALL OS_NATIVE(TransparentImage)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(TransparentImage)
 	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jint arg3, jint arg4, jintLong arg5, jint arg6, jint arg7, jint arg8, jint arg9, jint arg10)
 {
 	jboolean rc = 0;
@@ -18008,7 +18032,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(TransparentImage)
 #endif
 
 #ifndef NO_TreeView_1GetItemRect
-JNIEXPORT jboolean JNICALL OS_NATIVE(TreeView_1GetItemRect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(TreeView_1GetItemRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jboolean arg3)
 {
 	RECT _arg2, *lparg2=NULL;
@@ -18024,7 +18048,7 @@ fail:
 #endif
 
 #ifndef NO_UDACCEL_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(UDACCEL_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(UDACCEL_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -18036,7 +18060,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(UDACCEL_1sizeof)
 #endif
 
 #ifndef NO_UnhookWindowsHookEx
-JNIEXPORT jboolean JNICALL OS_NATIVE(UnhookWindowsHookEx)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(UnhookWindowsHookEx)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -18048,7 +18072,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(UnhookWindowsHookEx)
 #endif
 
 #ifndef NO_UnmapViewOfFile
-JNIEXPORT jboolean JNICALL OS_NATIVE(UnmapViewOfFile)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(UnmapViewOfFile)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -18060,7 +18084,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(UnmapViewOfFile)
 #endif
 
 #ifndef NO_UnregisterClassA
-JNIEXPORT jboolean JNICALL OS_NATIVE(UnregisterClassA)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(UnregisterClassA)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jintLong arg1)
 {
 	jbyte *lparg0=NULL;
@@ -18076,7 +18100,7 @@ fail:
 #endif
 
 #ifndef NO_UnregisterClassW
-JNIEXPORT jboolean JNICALL OS_NATIVE(UnregisterClassW)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(UnregisterClassW)
 	(JNIEnv *env, jclass that, jcharArray arg0, jintLong arg1)
 {
 	jchar *lparg0=NULL;
@@ -18092,7 +18116,7 @@ fail:
 #endif
 
 #ifndef NO_UnregisterTouchWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(UnregisterTouchWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(UnregisterTouchWindow)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -18112,7 +18136,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(UnregisterTouchWindow)
 #endif
 
 #ifndef NO_UpdateLayeredWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(UpdateLayeredWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(UpdateLayeredWindow)
 	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2, jobject arg3, jintLong arg4, jobject arg5, jint arg6, jobject arg7, jint arg8)
 {
 	POINT _arg2, *lparg2=NULL;
@@ -18145,7 +18169,7 @@ fail:
 #endif
 
 #ifndef NO_UpdateWindow
-JNIEXPORT jboolean JNICALL OS_NATIVE(UpdateWindow)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(UpdateWindow)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jboolean rc = 0;
@@ -18157,7 +18181,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(UpdateWindow)
 #endif
 
 #ifndef NO_UrlCreateFromPathA
-JNIEXPORT jint JNICALL OS_NATIVE(UrlCreateFromPathA)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(UrlCreateFromPathA)
 	(JNIEnv *env, jclass that, jbyteArray arg0, jbyteArray arg1, jintArray arg2, jint arg3)
 {
 	jbyte *lparg0=NULL;
@@ -18172,14 +18196,14 @@ JNIEXPORT jint JNICALL OS_NATIVE(UrlCreateFromPathA)
 fail:
 	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, 0);
 	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, 0);
-	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, UrlCreateFromPathA_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_UrlCreateFromPathW
-JNIEXPORT jint JNICALL OS_NATIVE(UrlCreateFromPathW)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(UrlCreateFromPathW)
 	(JNIEnv *env, jclass that, jcharArray arg0, jcharArray arg1, jintArray arg2, jint arg3)
 {
 	jchar *lparg0=NULL;
@@ -18194,14 +18218,14 @@ JNIEXPORT jint JNICALL OS_NATIVE(UrlCreateFromPathW)
 fail:
 	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, 0);
 	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, 0);
-	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, UrlCreateFromPathW_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_ValidateRect
-JNIEXPORT jboolean JNICALL OS_NATIVE(ValidateRect)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(ValidateRect)
 	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
 {
 	RECT _arg1, *lparg1=NULL;
@@ -18217,7 +18241,7 @@ fail:
 #endif
 
 #ifndef NO_VkKeyScanA
-JNIEXPORT jshort JNICALL OS_NATIVE(VkKeyScanA)
+SWT_NATIVE_EXPORT jshort JNICALL OS_NATIVE(VkKeyScanA)
 	(JNIEnv *env, jclass that, jshort arg0)
 {
 	jshort rc = 0;
@@ -18229,7 +18253,7 @@ JNIEXPORT jshort JNICALL OS_NATIVE(VkKeyScanA)
 #endif
 
 #ifndef NO_VkKeyScanW
-JNIEXPORT jshort JNICALL OS_NATIVE(VkKeyScanW)
+SWT_NATIVE_EXPORT jshort JNICALL OS_NATIVE(VkKeyScanW)
 	(JNIEnv *env, jclass that, jshort arg0)
 {
 	jshort rc = 0;
@@ -18242,9 +18266,9 @@ JNIEXPORT jshort JNICALL OS_NATIVE(VkKeyScanW)
 
 #if (!defined(NO_VtblCall__II) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__II)(JNIEnv *env, jclass that, jint arg0, jintLong arg1)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__II)(JNIEnv *env, jclass that, jint arg0, jintLong arg1)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1)
 #endif
 {
 	jint rc = 0;
@@ -18265,9 +18289,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJ)(JNIEnv *env, jclass that, jint ar
 
 #if (!defined(NO_VtblCall__III) && !defined(JNI64)) || (!defined(NO_VtblCall__IJI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__III)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__III)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJI)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJI)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2)
 #endif
 {
 	jint rc = 0;
@@ -18288,9 +18312,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJI)(JNIEnv *env, jclass that, jint a
 
 #if (!defined(NO_VtblCall__IIII) && !defined(JNI64)) || (!defined(NO_VtblCall__IJII) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIII)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIII)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJII)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJII)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3)
 #endif
 {
 	jint rc = 0;
@@ -18311,9 +18335,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJII)(JNIEnv *env, jclass that, jint
 
 #if (!defined(NO_VtblCall__IIIII) && !defined(JNI64)) || (!defined(NO_VtblCall__IJIII) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIIII)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3, jint arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIIII)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3, jint arg4)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJIII)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3, jint arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJIII)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3, jint arg4)
 #endif
 {
 	jint rc = 0;
@@ -18334,9 +18358,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJIII)(JNIEnv *env, jclass that, jint
 
 #if (!defined(NO_VtblCall__IIIII_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJIII_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIIII_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jintArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIIII_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jintArray arg5)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJIII_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jintArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJIII_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jintArray arg5)
 #endif
 {
 	jint *lparg5=NULL;
@@ -18361,9 +18385,9 @@ fail:
 
 #if (!defined(NO_VtblCall__IIII_3C_3CI) && !defined(JNI64)) || (!defined(NO_VtblCall__IJII_3C_3CI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIII_3C_3CI)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3, jcharArray arg4, jcharArray arg5, jint arg6)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIII_3C_3CI)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3, jcharArray arg4, jcharArray arg5, jint arg6)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJII_3C_3CI)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3, jcharArray arg4, jcharArray arg5, jint arg6)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJII_3C_3CI)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jint arg3, jcharArray arg4, jcharArray arg5, jint arg6)
 #endif
 {
 	jchar *lparg4=NULL;
@@ -18391,9 +18415,9 @@ fail:
 
 #if (!defined(NO_VtblCall__IIIJ) && !defined(JNI64)) || (!defined(NO_VtblCall__IJIJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIIJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlong arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIIJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlong arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJIJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlong arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJIJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlong arg3)
 #endif
 {
 	jint rc = 0;
@@ -18414,9 +18438,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJIJ)(JNIEnv *env, jclass that, jint
 
 #if (!defined(NO_VtblCall__IIIJI_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJIJI_3J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIIJI_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlong arg3, jint arg4, jlongArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIIJI_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlong arg3, jint arg4, jlongArray arg5)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJIJI_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlong arg3, jint arg4, jlongArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJIJI_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlong arg3, jint arg4, jlongArray arg5)
 #endif
 {
 	jlong *lparg5=NULL;
@@ -18441,9 +18465,9 @@ fail:
 
 #if (!defined(NO_VtblCall__IIIJJ) && !defined(JNI64)) || (!defined(NO_VtblCall__IJIJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIIJJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlong arg3, jlong arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIIJJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlong arg3, jlong arg4)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJIJJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlong arg3, jlong arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJIJJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlong arg3, jlong arg4)
 #endif
 {
 	jint rc = 0;
@@ -18464,9 +18488,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJIJJ)(JNIEnv *env, jclass that, jint
 
 #if (!defined(NO_VtblCall__III_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJI_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__III_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jintArray arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__III_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jintArray arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJI_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jintArray arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJI_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jintArray arg3)
 #endif
 {
 	jint *lparg3=NULL;
@@ -18491,9 +18515,9 @@ fail:
 
 #if (!defined(NO_VtblCall__III_3I_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJI_3J_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__III_3I_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jintLongArray arg3, jintArray arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__III_3I_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jintLongArray arg3, jintArray arg4)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJI_3J_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jintLongArray arg3, jintArray arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJI_3J_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jintLongArray arg3, jintArray arg4)
 #endif
 {
 	jintLong *lparg3=NULL;
@@ -18521,9 +18545,9 @@ fail:
 
 #if (!defined(NO_VtblCall__III_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJI_3J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__III_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlongArray arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__III_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlongArray arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJI_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlongArray arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJI_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jint arg2, jlongArray arg3)
 #endif
 {
 	jlong *lparg3=NULL;
@@ -18548,9 +18572,9 @@ fail:
 
 #if (!defined(NO_VtblCall__IIJ) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2)
 #endif
 {
 	jint rc = 0;
@@ -18571,9 +18595,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJJ)(JNIEnv *env, jclass that, jint a
 
 #if (!defined(NO_VtblCall__IIJI) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIJI)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIJI)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJJI)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJJI)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3)
 #endif
 {
 	jint rc = 0;
@@ -18594,9 +18618,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJJI)(JNIEnv *env, jclass that, jint
 
 #if (!defined(NO_VtblCall__IIJII_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJII_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIJII_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3, jint arg4, jintArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIJII_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3, jint arg4, jintArray arg5)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJJII_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3, jint arg4, jintArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJJII_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3, jint arg4, jintArray arg5)
 #endif
 {
 	jint *lparg5=NULL;
@@ -18621,9 +18645,9 @@ fail:
 
 #if (!defined(NO_VtblCall__IIJII_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJII_3J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIJII_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3, jint arg4, jlongArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIJII_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3, jint arg4, jlongArray arg5)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJJII_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3, jint arg4, jlongArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJJII_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3, jint arg4, jlongArray arg5)
 #endif
 {
 	jlong *lparg5=NULL;
@@ -18648,9 +18672,9 @@ fail:
 
 #if (!defined(NO_VtblCall__IIJI_3C_3CJ) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJI_3C_3CJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIJI_3C_3CJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3, jcharArray arg4, jcharArray arg5, jlong arg6)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIJI_3C_3CJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3, jcharArray arg4, jcharArray arg5, jlong arg6)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJJI_3C_3CJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3, jcharArray arg4, jcharArray arg5, jlong arg6)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJJI_3C_3CJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jint arg3, jcharArray arg4, jcharArray arg5, jlong arg6)
 #endif
 {
 	jchar *lparg4=NULL;
@@ -18678,9 +18702,9 @@ fail:
 
 #if (!defined(NO_VtblCall__IIJJ) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIJJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlong arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIJJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlong arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJJJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlong arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJJJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlong arg3)
 #endif
 {
 	jint rc = 0;
@@ -18701,9 +18725,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJJJ)(JNIEnv *env, jclass that, jint
 
 #if (!defined(NO_VtblCall__IIJJI_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJJI_3J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIJJI_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlong arg3, jint arg4, jlongArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIJJI_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlong arg3, jint arg4, jlongArray arg5)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJJJI_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlong arg3, jint arg4, jlongArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJJJI_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlong arg3, jint arg4, jlongArray arg5)
 #endif
 {
 	jlong *lparg5=NULL;
@@ -18728,9 +18752,9 @@ fail:
 
 #if (!defined(NO_VtblCall__IIJJJ) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJJJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIJJJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlong arg3, jlong arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIJJJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlong arg3, jlong arg4)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJJJJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlong arg3, jlong arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJJJJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlong arg3, jlong arg4)
 #endif
 {
 	jint rc = 0;
@@ -18751,9 +18775,9 @@ JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJJJJ)(JNIEnv *env, jclass that, jint
 
 #if (!defined(NO_VtblCall__IIJ_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJ_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIJ_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jintArray arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIJ_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jintArray arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJJ_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jintArray arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJJ_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jintArray arg3)
 #endif
 {
 	jint *lparg3=NULL;
@@ -18778,9 +18802,9 @@ fail:
 
 #if (!defined(NO_VtblCall__IIJ_3I_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJ_3I_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIJ_3I_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jintArray arg3, jintArray arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIJ_3I_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jintArray arg3, jintArray arg4)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJJ_3I_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jintArray arg3, jintArray arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJJ_3I_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jintArray arg3, jintArray arg4)
 #endif
 {
 	jint *lparg3=NULL;
@@ -18808,9 +18832,9 @@ fail:
 
 #if (!defined(NO_VtblCall__IIJ_3J_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJ_3J_3J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIJ_3J_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlongArray arg3, jlongArray arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIJ_3J_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlongArray arg3, jlongArray arg4)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJJ_3J_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlongArray arg3, jlongArray arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJJ_3J_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlong arg2, jlongArray arg3, jlongArray arg4)
 #endif
 {
 	jlong *lparg3=NULL;
@@ -18838,9 +18862,9 @@ fail:
 
 #if (!defined(NO_VtblCall__IILorg_eclipse_swt_internal_win32_PROPERTYKEY_2I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJLorg_eclipse_swt_internal_win32_PROPERTYKEY_2I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IILorg_eclipse_swt_internal_win32_PROPERTYKEY_2I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jobject arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IILorg_eclipse_swt_internal_win32_PROPERTYKEY_2I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jobject arg2, jint arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJLorg_eclipse_swt_internal_win32_PROPERTYKEY_2I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jobject arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJLorg_eclipse_swt_internal_win32_PROPERTYKEY_2I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jobject arg2, jint arg3)
 #endif
 {
 	PROPERTYKEY _arg2, *lparg2=NULL;
@@ -18865,9 +18889,9 @@ fail:
 
 #if (!defined(NO_VtblCall__IILorg_eclipse_swt_internal_win32_PROPERTYKEY_2J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJLorg_eclipse_swt_internal_win32_PROPERTYKEY_2J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IILorg_eclipse_swt_internal_win32_PROPERTYKEY_2J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jobject arg2, jlong arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IILorg_eclipse_swt_internal_win32_PROPERTYKEY_2J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jobject arg2, jlong arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJLorg_eclipse_swt_internal_win32_PROPERTYKEY_2J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jobject arg2, jlong arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJLorg_eclipse_swt_internal_win32_PROPERTYKEY_2J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jobject arg2, jlong arg3)
 #endif
 {
 	PROPERTYKEY _arg2, *lparg2=NULL;
@@ -18892,9 +18916,9 @@ fail:
 
 #if (!defined(NO_VtblCall__IILorg_eclipse_swt_internal_win32_TF_1DISPLAYATTRIBUTE_2) && !defined(JNI64)) || (!defined(NO_VtblCall__IJLorg_eclipse_swt_internal_win32_TF_1DISPLAYATTRIBUTE_2) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IILorg_eclipse_swt_internal_win32_TF_1DISPLAYATTRIBUTE_2)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IILorg_eclipse_swt_internal_win32_TF_1DISPLAYATTRIBUTE_2)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jobject arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJLorg_eclipse_swt_internal_win32_TF_1DISPLAYATTRIBUTE_2)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jobject arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJLorg_eclipse_swt_internal_win32_TF_1DISPLAYATTRIBUTE_2)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jobject arg2)
 #endif
 {
 	TF_DISPLAYATTRIBUTE _arg2, *lparg2=NULL;
@@ -18919,9 +18943,9 @@ fail:
 
 #if (!defined(NO_VtblCall__IIS_3B_3B_3B) && !defined(JNI64)) || (!defined(NO_VtblCall__IJS_3B_3B_3B) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IIS_3B_3B_3B)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jshort arg2, jbyteArray arg3, jbyteArray arg4, jbyteArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IIS_3B_3B_3B)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jshort arg2, jbyteArray arg3, jbyteArray arg4, jbyteArray arg5)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJS_3B_3B_3B)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jshort arg2, jbyteArray arg3, jbyteArray arg4, jbyteArray arg5)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJS_3B_3B_3B)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jshort arg2, jbyteArray arg3, jbyteArray arg4, jbyteArray arg5)
 #endif
 {
 	jbyte *lparg3=NULL;
@@ -18952,9 +18976,9 @@ fail:
 
 #if (!defined(NO_VtblCall__II_3B_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3B_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__II_3B_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jbyteArray arg2, jintArray arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__II_3B_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jbyteArray arg2, jintArray arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3B_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jbyteArray arg2, jintArray arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3B_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jbyteArray arg2, jintArray arg3)
 #endif
 {
 	jbyte *lparg2=NULL;
@@ -18982,9 +19006,9 @@ fail:
 
 #if (!defined(NO_VtblCall__II_3B_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3B_3J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__II_3B_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jbyteArray arg2, jlongArray arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__II_3B_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jbyteArray arg2, jlongArray arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3B_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jbyteArray arg2, jlongArray arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3B_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jbyteArray arg2, jlongArray arg3)
 #endif
 {
 	jbyte *lparg2=NULL;
@@ -19012,9 +19036,9 @@ fail:
 
 #if (!defined(NO_VtblCall__II_3C) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3C) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__II_3C)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__II_3C)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3C)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3C)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2)
 #endif
 {
 	jchar *lparg2=NULL;
@@ -19039,9 +19063,9 @@ fail:
 
 #if (!defined(NO_VtblCall__II_3CI) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3CI) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__II_3CI)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__II_3CI)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2, jint arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3CI)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2, jint arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3CI)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2, jint arg3)
 #endif
 {
 	jchar *lparg2=NULL;
@@ -19066,9 +19090,9 @@ fail:
 
 #if (!defined(NO_VtblCall__II_3CII_3I_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3CII_3I_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__II_3CII_3I_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2, jint arg3, jint arg4, jintArray arg5, jintArray arg6)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__II_3CII_3I_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2, jint arg3, jint arg4, jintArray arg5, jintArray arg6)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3CII_3I_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2, jint arg3, jint arg4, jintArray arg5, jintArray arg6)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3CII_3I_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2, jint arg3, jint arg4, jintArray arg5, jintArray arg6)
 #endif
 {
 	jchar *lparg2=NULL;
@@ -19099,9 +19123,9 @@ fail:
 
 #if (!defined(NO_VtblCall__II_3CJ) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3CJ) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__II_3CJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2, jlong arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__II_3CJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2, jlong arg3)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3CJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2, jlong arg3)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3CJ)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jcharArray arg2, jlong arg3)
 #endif
 {
 	jchar *lparg2=NULL;
@@ -19126,9 +19150,9 @@ fail:
 
 #if (!defined(NO_VtblCall__II_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__II_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintArray arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__II_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintArray arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintArray arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintArray arg2)
 #endif
 {
 	jint *lparg2=NULL;
@@ -19153,9 +19177,9 @@ fail:
 
 #if (!defined(NO_VtblCall__II_3I_3B_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3I_3B_3I) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__II_3I_3B_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintArray arg2, jbyteArray arg3, jintArray arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__II_3I_3B_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintArray arg2, jbyteArray arg3, jintArray arg4)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3I_3B_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintArray arg2, jbyteArray arg3, jintArray arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3I_3B_3I)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintArray arg2, jbyteArray arg3, jintArray arg4)
 #endif
 {
 	jint *lparg2=NULL;
@@ -19186,9 +19210,9 @@ fail:
 
 #if (!defined(NO_VtblCall__II_3I_3B_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3I_3B_3J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__II_3I_3B_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintArray arg2, jbyteArray arg3, jlongArray arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__II_3I_3B_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintArray arg2, jbyteArray arg3, jlongArray arg4)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3I_3B_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintArray arg2, jbyteArray arg3, jlongArray arg4)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3I_3B_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jintArray arg2, jbyteArray arg3, jlongArray arg4)
 #endif
 {
 	jint *lparg2=NULL;
@@ -19219,9 +19243,9 @@ fail:
 
 #if (!defined(NO_VtblCall__II_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3J) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__II_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlongArray arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__II_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlongArray arg2)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlongArray arg2)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(VtblCall__IJ_3J)(JNIEnv *env, jclass that, jint arg0, jintLong arg1, jlongArray arg2)
 #endif
 {
 	jlong *lparg2=NULL;
@@ -19245,7 +19269,7 @@ fail:
 #endif
 
 #ifndef NO_WINDOWPLACEMENT_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(WINDOWPLACEMENT_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(WINDOWPLACEMENT_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -19257,7 +19281,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(WINDOWPLACEMENT_1sizeof)
 #endif
 
 #ifndef NO_WINDOWPOS_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(WINDOWPOS_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(WINDOWPOS_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -19269,7 +19293,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(WINDOWPOS_1sizeof)
 #endif
 
 #ifndef NO_WNDCLASS_1sizeof
-JNIEXPORT jint JNICALL OS_NATIVE(WNDCLASS_1sizeof)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(WNDCLASS_1sizeof)
 	(JNIEnv *env, jclass that)
 {
 	jint rc = 0;
@@ -19281,7 +19305,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(WNDCLASS_1sizeof)
 #endif
 
 #ifndef NO_WaitMessage
-JNIEXPORT jboolean JNICALL OS_NATIVE(WaitMessage)
+SWT_NATIVE_EXPORT jboolean JNICALL OS_NATIVE(WaitMessage)
 	(JNIEnv *env, jclass that)
 {
 	jboolean rc = 0;
@@ -19294,9 +19318,9 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(WaitMessage)
 
 #if (!defined(NO_WideCharToMultiByte__II_3CIII_3B_3Z) && !defined(JNI64)) || (!defined(NO_WideCharToMultiByte__II_3CIJI_3B_3Z) && defined(JNI64))
 #ifndef JNI64
-JNIEXPORT jint JNICALL OS_NATIVE(WideCharToMultiByte__II_3CIII_3B_3Z)(JNIEnv *env, jclass that, jint arg0, jint arg1, jcharArray arg2, jint arg3, jintLong arg4, jint arg5, jbyteArray arg6, jbooleanArray arg7)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(WideCharToMultiByte__II_3CIII_3B_3Z)(JNIEnv *env, jclass that, jint arg0, jint arg1, jcharArray arg2, jint arg3, jintLong arg4, jint arg5, jbyteArray arg6, jbooleanArray arg7)
 #else
-JNIEXPORT jint JNICALL OS_NATIVE(WideCharToMultiByte__II_3CIJI_3B_3Z)(JNIEnv *env, jclass that, jint arg0, jint arg1, jcharArray arg2, jint arg3, jintLong arg4, jint arg5, jbyteArray arg6, jbooleanArray arg7)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(WideCharToMultiByte__II_3CIJI_3B_3Z)(JNIEnv *env, jclass that, jint arg0, jint arg1, jcharArray arg2, jint arg3, jintLong arg4, jint arg5, jbyteArray arg6, jbooleanArray arg7)
 #endif
 {
 	jchar *lparg2=NULL;
@@ -19329,7 +19353,7 @@ fail:
 		if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, JNI_ABORT);
 	}
 	if (arg7 && lparg7) (*env)->ReleaseBooleanArrayElements(env, arg7, lparg7, 0);
-	if (arg6 && lparg6) (*env)->ReleaseByteArrayElements(env, arg6, lparg6, 0);
+	if (arg6 && lparg6) (*env)->ReleaseByteArrayElements(env, arg6, lparg6, JNI_ABORT);
 #ifndef JNI64
 	OS_NATIVE_EXIT(env, that, WideCharToMultiByte__II_3CIII_3B_3Z_FUNC);
 #else
@@ -19340,7 +19364,7 @@ fail:
 #endif
 
 #ifndef NO_WideCharToMultiByte__II_3CI_3BI_3B_3Z
-JNIEXPORT jint JNICALL OS_NATIVE(WideCharToMultiByte__II_3CI_3BI_3B_3Z)
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(WideCharToMultiByte__II_3CI_3BI_3B_3Z)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jcharArray arg2, jint arg3, jbyteArray arg4, jint arg5, jbyteArray arg6, jbooleanArray arg7)
 {
 	jchar *lparg2=NULL;
@@ -19374,14 +19398,14 @@ fail:
 		if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, JNI_ABORT);
 	}
 	if (arg7 && lparg7) (*env)->ReleaseBooleanArrayElements(env, arg7, lparg7, 0);
-	if (arg6 && lparg6) (*env)->ReleaseByteArrayElements(env, arg6, lparg6, 0);
+	if (arg6 && lparg6) (*env)->ReleaseByteArrayElements(env, arg6, lparg6, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, WideCharToMultiByte__II_3CI_3BI_3B_3Z_FUNC);
 	return rc;
 }
 #endif
 
 #ifndef NO_WindowFromDC
-JNIEXPORT jintLong JNICALL OS_NATIVE(WindowFromDC)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(WindowFromDC)
 	(JNIEnv *env, jclass that, jintLong arg0)
 {
 	jintLong rc = 0;
@@ -19393,7 +19417,7 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(WindowFromDC)
 #endif
 
 #ifndef NO_WindowFromPoint
-JNIEXPORT jintLong JNICALL OS_NATIVE(WindowFromPoint)
+SWT_NATIVE_EXPORT jintLong JNICALL OS_NATIVE(WindowFromPoint)
 	(JNIEnv *env, jclass that, jobject arg0)
 {
 	POINT _arg0, *lparg0=NULL;
@@ -19408,15 +19432,7264 @@ fail:
 }
 #endif
 
-#ifndef NO_wcslen
-JNIEXPORT jint JNICALL OS_NATIVE(wcslen)
-	(JNIEnv *env, jclass that, jintLong arg0)
+#ifndef NO_sizeofs
+SWT_NATIVE_EXPORT jstring JNICALL OS_NATIVE(sizeofs)
+	(JNIEnv *env, jclass that, jintArray arg0)
 {
-	jint rc = 0;
-	OS_NATIVE_ENTER(env, that, wcslen_FUNC);
-	rc = (jint)wcslen((const wchar_t *)arg0);
-	OS_NATIVE_EXIT(env, that, wcslen_FUNC);
-	return rc;
-}
+	static const char *names =
+#ifndef NO_ACCEL_1sizeof
+		"ACCEL,"
+#endif
+#ifndef NO_ACTCTX_1sizeof
+		"ACTCTX,"
+#endif
+#ifndef NO_BITMAP_1sizeof
+		"BITMAP,"
+#endif
+#ifndef NO_BITMAPINFOHEADER_1sizeof
+		"BITMAPINFOHEADER,"
+#endif
+#ifndef NO_BLENDFUNCTION_1sizeof
+		"BLENDFUNCTION,"
+#endif
+#ifndef NO_BP_1PAINTPARAMS_1sizeof
+		"BP_PAINTPARAMS,"
+#endif
+#ifndef NO_BROWSEINFO_1sizeof
+		"BROWSEINFO,"
+#endif
+#ifndef NO_BUTTON_1IMAGELIST_1sizeof
+		"BUTTON_IMAGELIST,"
+#endif
+#ifndef NO_CANDIDATEFORM_1sizeof
+		"CANDIDATEFORM,"
+#endif
+#ifndef NO_CERT_1CONTEXT_1sizeof
+		"CERT_CONTEXT,"
+#endif
+#ifndef NO_CERT_1INFO_1sizeof
+		"CERT_INFO,"
+#endif
+#ifndef NO_CERT_1NAME_1BLOB_1sizeof
+		"CERT_NAME_BLOB,"
+#endif
+#ifndef NO_CERT_1PUBLIC_1KEY_1INFO_1sizeof
+		"CERT_PUBLIC_KEY_INFO,"
+#endif
+#ifndef NO_CHOOSECOLOR_1sizeof
+		"CHOOSECOLOR,"
+#endif
+#ifndef NO_CHOOSEFONT_1sizeof
+		"CHOOSEFONT,"
+#endif
+#ifndef NO_COMBOBOXINFO_1sizeof
+		"COMBOBOXINFO,"
+#endif
+#ifndef NO_COMPOSITIONFORM_1sizeof
+		"COMPOSITIONFORM,"
+#endif
+#ifndef NO_CREATESTRUCT_1sizeof
+		"CREATESTRUCT,"
+#endif
+#ifndef NO_CRYPT_1ALGORITHM_1IDENTIFIER_1sizeof
+		"CRYPT_ALGORITHM_IDENTIFIER,"
+#endif
+#ifndef NO_CRYPT_1BIT_1BLOB_1sizeof
+		"CRYPT_BIT_BLOB,"
+#endif
+#ifndef NO_CRYPT_1INTEGER_1BLOB_1sizeof
+		"CRYPT_INTEGER_BLOB,"
+#endif
+#ifndef NO_CRYPT_1OBJID_1BLOB_1sizeof
+		"CRYPT_OBJID_BLOB,"
+#endif
+#ifndef NO_DEVMODEA_1sizeof
+		"DEVMODEA,"
+#endif
+#ifndef NO_DEVMODEW_1sizeof
+		"DEVMODEW,"
+#endif
+#ifndef NO_DIBSECTION_1sizeof
+		"DIBSECTION,"
+#endif
+#ifndef NO_DLLVERSIONINFO_1sizeof
+		"DLLVERSIONINFO,"
+#endif
+#ifndef NO_DOCHOSTUIINFO_1sizeof
+		"DOCHOSTUIINFO,"
+#endif
+#ifndef NO_DOCINFO_1sizeof
+		"DOCINFO,"
+#endif
+#ifndef NO_DRAWITEMSTRUCT_1sizeof
+		"DRAWITEMSTRUCT,"
+#endif
+#ifndef NO_DROPFILES_1sizeof
+		"DROPFILES,"
+#endif
+#ifndef NO_DTTOPTS_1sizeof
+		"DTTOPTS,"
+#endif
+#ifndef NO_DWM_1BLURBEHIND_1sizeof
+		"DWM_BLURBEHIND,"
+#endif
+#ifndef NO_EMR_1sizeof
+		"EMR,"
+#endif
+#ifndef NO_EMREXTCREATEFONTINDIRECTW_1sizeof
+		"EMREXTCREATEFONTINDIRECTW,"
+#endif
+#ifndef NO_EXTLOGFONTW_1sizeof
+		"EXTLOGFONTW,"
+#endif
+#ifndef NO_EXTLOGPEN_1sizeof
+		"EXTLOGPEN,"
+#endif
+#ifndef NO_FILETIME_1sizeof
+		"FILETIME,"
+#endif
+#ifndef NO_FLICK_1DATA_1sizeof
+		"FLICK_DATA,"
+#endif
+#ifndef NO_FLICK_1POINT_1sizeof
+		"FLICK_POINT,"
+#endif
+#ifndef NO_GCP_1RESULTS_1sizeof
+		"GCP_RESULTS,"
+#endif
+#ifndef NO_GESTURECONFIG_1sizeof
+		"GESTURECONFIG,"
+#endif
+#ifndef NO_GESTUREINFO_1sizeof
+		"GESTUREINFO,"
+#endif
+#ifndef NO_GRADIENT_1RECT_1sizeof
+		"GRADIENT_RECT,"
+#endif
+#ifndef NO_GUITHREADINFO_1sizeof
+		"GUITHREADINFO,"
+#endif
+#ifndef NO_HDHITTESTINFO_1sizeof
+		"HDHITTESTINFO,"
+#endif
+#ifndef NO_HDITEM_1sizeof
+		"HDITEM,"
+#endif
+#ifndef NO_HDLAYOUT_1sizeof
+		"HDLAYOUT,"
+#endif
+#ifndef NO_HELPINFO_1sizeof
+		"HELPINFO,"
+#endif
+#ifndef NO_HIGHCONTRAST_1sizeof
+		"HIGHCONTRAST,"
+#endif
+#ifndef NO_ICONINFO_1sizeof
+		"ICONINFO,"
+#endif
+#ifndef NO_INITCOMMONCONTROLSEX_1sizeof
+		"INITCOMMONCONTROLSEX,"
+#endif
+#ifndef NO_INPUT_1sizeof
+		"INPUT,"
+#endif
+#ifndef NO_KEYBDINPUT_1sizeof
+		"KEYBDINPUT,"
+#endif
+#ifndef NO_LITEM_1sizeof
+		"LITEM,"
+#endif
+#ifndef NO_LOGBRUSH_1sizeof
+		"LOGBRUSH,"
+#endif
+#ifndef NO_LOGFONTA_1sizeof
+		"LOGFONTA,"
+#endif
+#ifndef NO_LOGFONTW_1sizeof
+		"LOGFONTW,"
+#endif
+#ifndef NO_LOGPEN_1sizeof
+		"LOGPEN,"
+#endif
+#ifndef NO_LVCOLUMN_1sizeof
+		"LVCOLUMN,"
+#endif
+#ifndef NO_LVHITTESTINFO_1sizeof
+		"LVHITTESTINFO,"
+#endif
+#ifndef NO_LVINSERTMARK_1sizeof
+		"LVINSERTMARK,"
+#endif
+#ifndef NO_LVITEM_1sizeof
+		"LVITEM,"
+#endif
+#ifndef NO_MARGINS_1sizeof
+		"MARGINS,"
+#endif
+#ifndef NO_MCHITTESTINFO_1sizeof
+		"MCHITTESTINFO,"
+#endif
+#ifndef NO_MEASUREITEMSTRUCT_1sizeof
+		"MEASUREITEMSTRUCT,"
+#endif
+#ifndef NO_MENUBARINFO_1sizeof
+		"MENUBARINFO,"
+#endif
+#ifndef NO_MENUINFO_1sizeof
+		"MENUINFO,"
+#endif
+#ifndef NO_MENUITEMINFO_1sizeof
+		"MENUITEMINFO,"
+#endif
+#ifndef NO_MINMAXINFO_1sizeof
+		"MINMAXINFO,"
+#endif
+#ifndef NO_MONITORINFO_1sizeof
+		"MONITORINFO,"
+#endif
+#ifndef NO_MOUSEINPUT_1sizeof
+		"MOUSEINPUT,"
+#endif
+#ifndef NO_MSG_1sizeof
+		"MSG,"
+#endif
+#ifndef NO_NMCUSTOMDRAW_1sizeof
+		"NMCUSTOMDRAW,"
+#endif
+#ifndef NO_NMHDR_1sizeof
+		"NMHDR,"
+#endif
+#ifndef NO_NMHEADER_1sizeof
+		"NMHEADER,"
+#endif
+#ifndef NO_NMLINK_1sizeof
+		"NMLINK,"
+#endif
+#ifndef NO_NMLISTVIEW_1sizeof
+		"NMLISTVIEW,"
+#endif
+#ifndef NO_NMLVCUSTOMDRAW_1sizeof
+		"NMLVCUSTOMDRAW,"
+#endif
+#ifndef NO_NMLVDISPINFO_1sizeof
+		"NMLVDISPINFO,"
+#endif
+#ifndef NO_NMLVFINDITEM_1sizeof
+		"NMLVFINDITEM,"
+#endif
+#ifndef NO_NMLVODSTATECHANGE_1sizeof
+		"NMLVODSTATECHANGE,"
+#endif
+#ifndef NO_NMREBARCHEVRON_1sizeof
+		"NMREBARCHEVRON,"
+#endif
+#ifndef NO_NMREBARCHILDSIZE_1sizeof
+		"NMREBARCHILDSIZE,"
+#endif
+#ifndef NO_NMRGINFO_1sizeof
+		"NMRGINFO,"
+#endif
+#ifndef NO_NMTBHOTITEM_1sizeof
+		"NMTBHOTITEM,"
+#endif
+#ifndef NO_NMTOOLBAR_1sizeof
+		"NMTOOLBAR,"
+#endif
+#ifndef NO_NMTREEVIEW_1sizeof
+		"NMTREEVIEW,"
+#endif
+#ifndef NO_NMTTCUSTOMDRAW_1sizeof
+		"NMTTCUSTOMDRAW,"
+#endif
+#ifndef NO_NMTTDISPINFOA_1sizeof
+		"NMTTDISPINFOA,"
+#endif
+#ifndef NO_NMTTDISPINFOW_1sizeof
+		"NMTTDISPINFOW,"
+#endif
+#ifndef NO_NMTVCUSTOMDRAW_1sizeof
+		"NMTVCUSTOMDRAW,"
+#endif
+#ifndef NO_NMTVDISPINFO_1sizeof
+		"NMTVDISPINFO,"
+#endif
+#ifndef NO_NMTVITEMCHANGE_1sizeof
+		"NMTVITEMCHANGE,"
+#endif
+#ifndef NO_NMUPDOWN_1sizeof
+		"NMUPDOWN,"
+#endif
+#ifndef NO_NONCLIENTMETRICSA_1sizeof
+		"NONCLIENTMETRICSA,"
+#endif
+#ifndef NO_NONCLIENTMETRICSW_1sizeof
+		"NONCLIENTMETRICSW,"
+#endif
+#ifndef NO_OFNOTIFY_1sizeof
+		"OFNOTIFY,"
+#endif
+#ifndef NO_OPENFILENAME_1sizeof
+		"OPENFILENAME,"
+#endif
+#ifndef NO_OSVERSIONINFOA_1sizeof
+		"OSVERSIONINFOA,"
+#endif
+#ifndef NO_OSVERSIONINFOEXA_1sizeof
+		"OSVERSIONINFOEXA,"
+#endif
+#ifndef NO_OSVERSIONINFOEXW_1sizeof
+		"OSVERSIONINFOEXW,"
+#endif
+#ifndef NO_OSVERSIONINFOW_1sizeof
+		"OSVERSIONINFOW,"
+#endif
+#ifndef NO_OUTLINETEXTMETRICA_1sizeof
+		"OUTLINETEXTMETRICA,"
+#endif
+#ifndef NO_OUTLINETEXTMETRICW_1sizeof
+		"OUTLINETEXTMETRICW,"
+#endif
+#ifndef NO_PAINTSTRUCT_1sizeof
+		"PAINTSTRUCT,"
+#endif
+#ifndef NO_PANOSE_1sizeof
+		"PANOSE,"
+#endif
+#ifndef NO_POINT_1sizeof
+		"POINT,"
+#endif
+#ifndef NO_PRINTDLG_1sizeof
+		"PRINTDLG,"
+#endif
+#ifndef NO_PROCESS_1INFORMATION_1sizeof
+		"PROCESS_INFORMATION,"
+#endif
+#ifndef NO_PROPERTYKEY_1sizeof
+		"PROPERTYKEY,"
+#endif
+#ifndef NO_PROPVARIANT_1sizeof
+		"PROPVARIANT,"
+#endif
+#ifndef NO_REBARBANDINFO_1sizeof
+		"REBARBANDINFO,"
+#endif
+#ifndef NO_RECT_1sizeof
+		"RECT,"
+#endif
+#ifndef NO_SAFEARRAY_1sizeof
+		"SAFEARRAY,"
+#endif
+#ifndef NO_SAFEARRAYBOUND_1sizeof
+		"SAFEARRAYBOUND,"
+#endif
+#ifndef NO_SCRIPT_1ANALYSIS_1sizeof
+		"SCRIPT_ANALYSIS,"
+#endif
+#ifndef NO_SCRIPT_1CONTROL_1sizeof
+		"SCRIPT_CONTROL,"
+#endif
+#ifndef NO_SCRIPT_1DIGITSUBSTITUTE_1sizeof
+		"SCRIPT_DIGITSUBSTITUTE,"
+#endif
+#ifndef NO_SCRIPT_1FONTPROPERTIES_1sizeof
+		"SCRIPT_FONTPROPERTIES,"
+#endif
+#ifndef NO_SCRIPT_1ITEM_1sizeof
+		"SCRIPT_ITEM,"
+#endif
+#ifndef NO_SCRIPT_1LOGATTR_1sizeof
+		"SCRIPT_LOGATTR,"
+#endif
+#ifndef NO_SCRIPT_1PROPERTIES_1sizeof
+		"SCRIPT_PROPERTIES,"
+#endif
+#ifndef NO_SCRIPT_1STATE_1sizeof
+		"SCRIPT_STATE,"
+#endif
+#ifndef NO_SCRIPT_1STRING_1ANALYSIS_1sizeof
+		"SCRIPT_STRING_ANALYSIS,"
+#endif
+#ifndef NO_SCROLLBARINFO_1sizeof
+		"SCROLLBARINFO,"
+#endif
+#ifndef NO_SCROLLINFO_1sizeof
+		"SCROLLINFO,"
+#endif
+#ifndef NO_SHACTIVATEINFO_1sizeof
+		"SHACTIVATEINFO,"
+#endif
+#ifndef NO_SHDRAGIMAGE_1sizeof
+		"SHDRAGIMAGE,"
+#endif
+#ifndef NO_SHELLEXECUTEINFO_1sizeof
+		"SHELLEXECUTEINFO,"
+#endif
+#ifndef NO_SHFILEINFOA_1sizeof
+		"SHFILEINFOA,"
+#endif
+#ifndef NO_SHFILEINFOW_1sizeof
+		"SHFILEINFOW,"
+#endif
+#ifndef NO_SHMENUBARINFO_1sizeof
+		"SHMENUBARINFO,"
+#endif
+#ifndef NO_SHRGINFO_1sizeof
+		"SHRGINFO,"
+#endif
+#ifndef NO_SIPINFO_1sizeof
+		"SIPINFO,"
+#endif
+#ifndef NO_SIZE_1sizeof
+		"SIZE,"
+#endif
+#ifndef NO_STARTUPINFO_1sizeof
+		"STARTUPINFO,"
+#endif
+#ifndef NO_SYSTEMTIME_1sizeof
+		"SYSTEMTIME,"
+#endif
+#ifndef NO_TBBUTTON_1sizeof
+		"TBBUTTON,"
+#endif
+#ifndef NO_TBBUTTONINFO_1sizeof
+		"TBBUTTONINFO,"
+#endif
+#ifndef NO_TCHITTESTINFO_1sizeof
+		"TCHITTESTINFO,"
+#endif
+#ifndef NO_TCITEM_1sizeof
+		"TCITEM,"
+#endif
+#ifndef NO_TEXTMETRICA_1sizeof
+		"TEXTMETRICA,"
+#endif
+#ifndef NO_TEXTMETRICW_1sizeof
+		"TEXTMETRICW,"
+#endif
+#ifndef NO_TF_1DA_1COLOR_1sizeof
+		"TF_DA_COLOR,"
+#endif
+#ifndef NO_TF_1DISPLAYATTRIBUTE_1sizeof
+		"TF_DISPLAYATTRIBUTE,"
+#endif
+#ifndef NO_TOOLINFO_1sizeof
+		"TOOLINFO,"
+#endif
+#ifndef NO_TOUCHINPUT_1sizeof
+		"TOUCHINPUT,"
+#endif
+#ifndef NO_TRACKMOUSEEVENT_1sizeof
+		"TRACKMOUSEEVENT,"
+#endif
+#ifndef NO_TRIVERTEX_1sizeof
+		"TRIVERTEX,"
+#endif
+#ifndef NO_TVHITTESTINFO_1sizeof
+		"TVHITTESTINFO,"
+#endif
+#ifndef NO_TVINSERTSTRUCT_1sizeof
+		"TVINSERTSTRUCT,"
+#endif
+#ifndef NO_TVITEM_1sizeof
+		"TVITEM,"
+#endif
+#ifndef NO_TVITEMEX_1sizeof
+		"TVITEMEX,"
+#endif
+#ifndef NO_TVSORTCB_1sizeof
+		"TVSORTCB,"
+#endif
+#ifndef NO_UDACCEL_1sizeof
+		"UDACCEL,"
+#endif
+#ifndef NO_WINDOWPLACEMENT_1sizeof
+		"WINDOWPLACEMENT,"
+#endif
+#ifndef NO_WINDOWPOS_1sizeof
+		"WINDOWPOS,"
+#endif
+#ifndef NO_WNDCLASS_1sizeof
+		"WNDCLASS,"
+#endif
+		"";
+	jint sizes[] = {
+#ifndef NO_ACCEL_1sizeof
+		(jint)ACCEL_sizeof(),
+#endif
+#ifndef NO_ACTCTX_1sizeof
+		(jint)ACTCTX_sizeof(),
+#endif
+#ifndef NO_BITMAP_1sizeof
+		(jint)BITMAP_sizeof(),
+#endif
+#ifndef NO_BITMAPINFOHEADER_1sizeof
+		(jint)BITMAPINFOHEADER_sizeof(),
+#endif
+#ifndef NO_BLENDFUNCTION_1sizeof
+		(jint)BLENDFUNCTION_sizeof(),
+#endif
+#ifndef NO_BP_1PAINTPARAMS_1sizeof
+		(jint)BP_PAINTPARAMS_sizeof(),
+#endif
+#ifndef NO_BROWSEINFO_1sizeof
+		(jint)BROWSEINFO_sizeof(),
+#endif
+#ifndef NO_BUTTON_1IMAGELIST_1sizeof
+		(jint)BUTTON_IMAGELIST_sizeof(),
+#endif
+#ifndef NO_CANDIDATEFORM_1sizeof
+		(jint)CANDIDATEFORM_sizeof(),
+#endif
+#ifndef NO_CERT_1CONTEXT_1sizeof
+		(jint)CERT_CONTEXT_sizeof(),
+#endif
+#ifndef NO_CERT_1INFO_1sizeof
+		(jint)CERT_INFO_sizeof(),
+#endif
+#ifndef NO_CERT_1NAME_1BLOB_1sizeof
+		(jint)CERT_NAME_BLOB_sizeof(),
+#endif
+#ifndef NO_CERT_1PUBLIC_1KEY_1INFO_1sizeof
+		(jint)CERT_PUBLIC_KEY_INFO_sizeof(),
+#endif
+#ifndef NO_CHOOSECOLOR_1sizeof
+		(jint)CHOOSECOLOR_sizeof(),
+#endif
+#ifndef NO_CHOOSEFONT_1sizeof
+		(jint)CHOOSEFONT_sizeof(),
+#endif
+#ifndef NO_COMBOBOXINFO_1sizeof
+		(jint)COMBOBOXINFO_sizeof(),
+#endif
+#ifndef NO_COMPOSITIONFORM_1sizeof
+		(jint)COMPOSITIONFORM_sizeof(),
+#endif
+#ifndef NO_CREATESTRUCT_1sizeof
+		(jint)CREATESTRUCT_sizeof(),
+#endif
+#ifndef NO_CRYPT_1ALGORITHM_1IDENTIFIER_1sizeof
+		(jint)CRYPT_ALGORITHM_IDENTIFIER_sizeof(),
+#endif
+#ifndef NO_CRYPT_1BIT_1BLOB_1sizeof
+		(jint)CRYPT_BIT_BLOB_sizeof(),
+#endif
+#ifndef NO_CRYPT_1INTEGER_1BLOB_1sizeof
+		(jint)CRYPT_INTEGER_BLOB_sizeof(),
+#endif
+#ifndef NO_CRYPT_1OBJID_1BLOB_1sizeof
+		(jint)CRYPT_OBJID_BLOB_sizeof(),
+#endif
+#ifndef NO_DEVMODEA_1sizeof
+		(jint)DEVMODEA_sizeof(),
+#endif
+#ifndef NO_DEVMODEW_1sizeof
+		(jint)DEVMODEW_sizeof(),
+#endif
+#ifndef NO_DIBSECTION_1sizeof
+		(jint)DIBSECTION_sizeof(),
+#endif
+#ifndef NO_DLLVERSIONINFO_1sizeof
+		(jint)DLLVERSIONINFO_sizeof(),
+#endif
+#ifndef NO_DOCHOSTUIINFO_1sizeof
+		(jint)DOCHOSTUIINFO_sizeof(),
+#endif
+#ifndef NO_DOCINFO_1sizeof
+		(jint)DOCINFO_sizeof(),
+#endif
+#ifndef NO_DRAWITEMSTRUCT_1sizeof
+		(jint)DRAWITEMSTRUCT_sizeof(),
+#endif
+#ifndef NO_DROPFILES_1sizeof
+		(jint)DROPFILES_sizeof(),
+#endif
+#ifndef NO_DTTOPTS_1sizeof
+		(jint)DTTOPTS_sizeof(),
+#endif
+#ifndef NO_DWM_1BLURBEHIND_1sizeof
+		(jint)DWM_BLURBEHIND_sizeof(),
+#endif
+#ifndef NO_EMR_1sizeof
+		(jint)EMR_sizeof(),
+#endif
+#ifndef NO_EMREXTCREATEFONTINDIRECTW_1sizeof
+		(jint)EMREXTCREATEFONTINDIRECTW_sizeof(),
+#endif
+#ifndef NO_EXTLOGFONTW_1sizeof
+		(jint)EXTLOGFONTW_sizeof(),
+#endif
+#ifndef NO_EXTLOGPEN_1sizeof
+		(jint)EXTLOGPEN_sizeof(),
+#endif
+#ifndef NO_FILETIME_1sizeof
+		(jint)FILETIME_sizeof(),
+#endif
+#ifndef NO_FLICK_1DATA_1sizeof
+		(jint)FLICK_DATA_sizeof(),
+#endif
+#ifndef NO_FLICK_1POINT_1sizeof
+		(jint)FLICK_POINT_sizeof(),
+#endif
+#ifndef NO_GCP_1RESULTS_1sizeof
+		(jint)GCP_RESULTS_sizeof(),
+#endif
+#ifndef NO_GESTURECONFIG_1sizeof
+		(jint)GESTURECONFIG_sizeof(),
+#endif
+#ifndef NO_GESTUREINFO_1sizeof
+		(jint)GESTUREINFO_sizeof(),
+#endif
+#ifndef NO_GRADIENT_1RECT_1sizeof
+		(jint)GRADIENT_RECT_sizeof(),
+#endif
+#ifndef NO_GUITHREADINFO_1sizeof
+		(jint)GUITHREADINFO_sizeof(),
+#endif
+#ifndef NO_HDHITTESTINFO_1sizeof
+		(jint)HDHITTESTINFO_sizeof(),
+#endif
+#ifndef NO_HDITEM_1sizeof
+		(jint)HDITEM_sizeof(),
+#endif
+#ifndef NO_HDLAYOUT_1sizeof
+		(jint)HDLAYOUT_sizeof(),
+#endif
+#ifndef NO_HELPINFO_1sizeof
+		(jint)HELPINFO_sizeof(),
+#endif
+#ifndef NO_HIGHCONTRAST_1sizeof
+		(jint)HIGHCONTRAST_sizeof(),
+#endif
+#ifndef NO_ICONINFO_1sizeof
+		(jint)ICONINFO_sizeof(),
+#endif
+#ifndef NO_INITCOMMONCONTROLSEX_1sizeof
+		(jint)INITCOMMONCONTROLSEX_sizeof(),
+#endif
+#ifndef NO_INPUT_1sizeof
+		(jint)INPUT_sizeof(),
+#endif
+#ifndef NO_KEYBDINPUT_1sizeof
+		(jint)KEYBDINPUT_sizeof(),
+#endif
+#ifndef NO_LITEM_1sizeof
+		(jint)LITEM_sizeof(),
+#endif
+#ifndef NO_LOGBRUSH_1sizeof
+		(jint)LOGBRUSH_sizeof(),
+#endif
+#ifndef NO_LOGFONTA_1sizeof
+		(jint)LOGFONTA_sizeof(),
+#endif
+#ifndef NO_LOGFONTW_1sizeof
+		(jint)LOGFONTW_sizeof(),
+#endif
+#ifndef NO_LOGPEN_1sizeof
+		(jint)LOGPEN_sizeof(),
+#endif
+#ifndef NO_LVCOLUMN_1sizeof
+		(jint)LVCOLUMN_sizeof(),
+#endif
+#ifndef NO_LVHITTESTINFO_1sizeof
+		(jint)LVHITTESTINFO_sizeof(),
+#endif
+#ifndef NO_LVINSERTMARK_1sizeof
+		(jint)LVINSERTMARK_sizeof(),
+#endif
+#ifndef NO_LVITEM_1sizeof
+		(jint)LVITEM_sizeof(),
+#endif
+#ifndef NO_MARGINS_1sizeof
+		(jint)MARGINS_sizeof(),
+#endif
+#ifndef NO_MCHITTESTINFO_1sizeof
+		(jint)MCHITTESTINFO_sizeof(),
+#endif
+#ifndef NO_MEASUREITEMSTRUCT_1sizeof
+		(jint)MEASUREITEMSTRUCT_sizeof(),
+#endif
+#ifndef NO_MENUBARINFO_1sizeof
+		(jint)MENUBARINFO_sizeof(),
+#endif
+#ifndef NO_MENUINFO_1sizeof
+		(jint)MENUINFO_sizeof(),
+#endif
+#ifndef NO_MENUITEMINFO_1sizeof
+		(jint)MENUITEMINFO_sizeof(),
+#endif
+#ifndef NO_MINMAXINFO_1sizeof
+		(jint)MINMAXINFO_sizeof(),
+#endif
+#ifndef NO_MONITORINFO_1sizeof
+		(jint)MONITORINFO_sizeof(),
+#endif
+#ifndef NO_MOUSEINPUT_1sizeof
+		(jint)MOUSEINPUT_sizeof(),
+#endif
+#ifndef NO_MSG_1sizeof
+		(jint)MSG_sizeof(),
+#endif
+#ifndef NO_NMCUSTOMDRAW_1sizeof
+		(jint)NMCUSTOMDRAW_sizeof(),
+#endif
+#ifndef NO_NMHDR_1sizeof
+		(jint)NMHDR_sizeof(),
+#endif
+#ifndef NO_NMHEADER_1sizeof
+		(jint)NMHEADER_sizeof(),
+#endif
+#ifndef NO_NMLINK_1sizeof
+		(jint)NMLINK_sizeof(),
+#endif
+#ifndef NO_NMLISTVIEW_1sizeof
+		(jint)NMLISTVIEW_sizeof(),
+#endif
+#ifndef NO_NMLVCUSTOMDRAW_1sizeof
+		(jint)NMLVCUSTOMDRAW_sizeof(),
+#endif
+#ifndef NO_NMLVDISPINFO_1sizeof
+		(jint)NMLVDISPINFO_sizeof(),
+#endif
+#ifndef NO_NMLVFINDITEM_1sizeof
+		(jint)NMLVFINDITEM_sizeof(),
+#endif
+#ifndef NO_NMLVODSTATECHANGE_1sizeof
+		(jint)NMLVODSTATECHANGE_sizeof(),
+#endif
+#ifndef NO_NMREBARCHEVRON_1sizeof
+		(jint)NMREBARCHEVRON_sizeof(),
+#endif
+#ifndef NO_NMREBARCHILDSIZE_1sizeof
+		(jint)NMREBARCHILDSIZE_sizeof(),
+#endif
+#ifndef NO_NMRGINFO_1sizeof
+		(jint)NMRGINFO_sizeof(),
+#endif
+#ifndef NO_NMTBHOTITEM_1sizeof
+		(jint)NMTBHOTITEM_sizeof(),
+#endif
+#ifndef NO_NMTOOLBAR_1sizeof
+		(jint)NMTOOLBAR_sizeof(),
+#endif
+#ifndef NO_NMTREEVIEW_1sizeof
+		(jint)NMTREEVIEW_sizeof(),
+#endif
+#ifndef NO_NMTTCUSTOMDRAW_1sizeof
+		(jint)NMTTCUSTOMDRAW_sizeof(),
+#endif
+#ifndef NO_NMTTDISPINFOA_1sizeof
+		(jint)NMTTDISPINFOA_sizeof(),
+#endif
+#ifndef NO_NMTTDISPINFOW_1sizeof
+		(jint)NMTTDISPINFOW_sizeof(),
+#endif
+#ifndef NO_NMTVCUSTOMDRAW_1sizeof
+		(jint)NMTVCUSTOMDRAW_sizeof(),
+#endif
+#ifndef NO_NMTVDISPINFO_1sizeof
+		(jint)NMTVDISPINFO_sizeof(),
+#endif
+#ifndef NO_NMTVITEMCHANGE_1sizeof
+		(jint)NMTVITEMCHANGE_sizeof(),
+#endif
+#ifndef NO_NMUPDOWN_1sizeof
+		(jint)NMUPDOWN_sizeof(),
+#endif
+#ifndef NO_NONCLIENTMETRICSA_1sizeof
+		(jint)NONCLIENTMETRICSA_sizeof(),
+#endif
+#ifndef NO_NONCLIENTMETRICSW_1sizeof
+		(jint)NONCLIENTMETRICSW_sizeof(),
+#endif
+#ifndef NO_OFNOTIFY_1sizeof
+		(jint)OFNOTIFY_sizeof(),
+#endif
+#ifndef NO_OPENFILENAME_1sizeof
+		(jint)OPENFILENAME_sizeof(),
+#endif
+#ifndef NO_OSVERSIONINFOA_1sizeof
+		(jint)OSVERSIONINFOA_sizeof(),
+#endif
+#ifndef NO_OSVERSIONINFOEXA_1sizeof
+		(jint)OSVERSIONINFOEXA_sizeof(),
+#endif
+#ifndef NO_OSVERSIONINFOEXW_1sizeof
+		(jint)OSVERSIONINFOEXW_sizeof(),
+#endif
+#ifndef NO_OSVERSIONINFOW_1sizeof
+		(jint)OSVERSIONINFOW_sizeof(),
+#endif
+#ifndef NO_OUTLINETEXTMETRICA_1sizeof
+		(jint)OUTLINETEXTMETRICA_sizeof(),
+#endif
+#ifndef NO_OUTLINETEXTMETRICW_1sizeof
+		(jint)OUTLINETEXTMETRICW_sizeof(),
+#endif
+#ifndef NO_PAINTSTRUCT_1sizeof
+		(jint)PAINTSTRUCT_sizeof(),
+#endif
+#ifndef NO_PANOSE_1sizeof
+		(jint)PANOSE_sizeof(),
+#endif
+#ifndef NO_POINT_1sizeof
+		(jint)POINT_sizeof(),
+#endif
+#ifndef NO_PRINTDLG_1sizeof
+		(jint)PRINTDLG_sizeof(),
+#endif
+#ifndef NO_PROCESS_1INFORMATION_1sizeof
+		(jint)PROCESS_INFORMATION_sizeof(),
+#endif
+#ifndef NO_PROPERTYKEY_1sizeof
+		(jint)PROPERTYKEY_sizeof(),
+#endif
+#ifndef NO_PROPVARIANT_1sizeof
+		(jint)PROPVARIANT_sizeof(),
+#endif
+#ifndef NO_REBARBANDINFO_1sizeof
+		(jint)REBARBANDINFO_sizeof(),
+#endif
+#ifndef NO_RECT_1sizeof
+		(jint)RECT_sizeof(),
+#endif
+#ifndef NO_SAFEARRAY_1sizeof
+		(jint)SAFEARRAY_sizeof(),
+#endif
+#ifndef NO_SAFEARRAYBOUND_1sizeof
+		(jint)SAFEARRAYBOUND_sizeof(),
+#endif
+#ifndef NO_SCRIPT_1ANALYSIS_1sizeof
+		(jint)SCRIPT_ANALYSIS_sizeof(),
+#endif
+#ifndef NO_SCRIPT_1CONTROL_1sizeof
+		(jint)SCRIPT_CONTROL_sizeof(),
+#endif
+#ifndef NO_SCRIPT_1DIGITSUBSTITUTE_1sizeof
+		(jint)SCRIPT_DIGITSUBSTITUTE_sizeof(),
+#endif
+#ifndef NO_SCRIPT_1FONTPROPERTIES_1sizeof
+		(jint)SCRIPT_FONTPROPERTIES_sizeof(),
+#endif
+#ifndef NO_SCRIPT_1ITEM_1sizeof
+		(jint)SCRIPT_ITEM_sizeof(),
+#endif
+#ifndef NO_SCRIPT_1LOGATTR_1sizeof
+		(jint)SCRIPT_LOGATTR_sizeof(),
+#endif
+#ifndef NO_SCRIPT_1PROPERTIES_1sizeof
+		(jint)SCRIPT_PROPERTIES_sizeof(),
+#endif
+#ifndef NO_SCRIPT_1STATE_1sizeof
+		(jint)SCRIPT_STATE_sizeof(),
+#endif
+#ifndef NO_SCRIPT_1STRING_1ANALYSIS_1sizeof
+		(jint)SCRIPT_STRING_ANALYSIS_sizeof(),
+#endif
+#ifndef NO_SCROLLBARINFO_1sizeof
+		(jint)SCROLLBARINFO_sizeof(),
+#endif
+#ifndef NO_SCROLLINFO_1sizeof
+		(jint)SCROLLINFO_sizeof(),
+#endif
+#ifndef NO_SHACTIVATEINFO_1sizeof
+		(jint)SHACTIVATEINFO_sizeof(),
+#endif
+#ifndef NO_SHDRAGIMAGE_1sizeof
+		(jint)SHDRAGIMAGE_sizeof(),
+#endif
+#ifndef NO_SHELLEXECUTEINFO_1sizeof
+		(jint)SHELLEXECUTEINFO_sizeof(),
+#endif
+#ifndef NO_SHFILEINFOA_1sizeof
+		(jint)SHFILEINFOA_sizeof(),
+#endif
+#ifndef NO_SHFILEINFOW_1sizeof
+		(jint)SHFILEINFOW_sizeof(),
+#endif
+#ifndef NO_SHMENUBARINFO_1sizeof
+		(jint)SHMENUBARINFO_sizeof(),
+#endif
+#ifndef NO_SHRGINFO_1sizeof
+		(jint)SHRGINFO_sizeof(),
+#endif
+#ifndef NO_SIPINFO_1sizeof
+		(jint)SIPINFO_sizeof(),
+#endif
+#ifndef NO_SIZE_1sizeof
+		(jint)SIZE_sizeof(),
+#endif
+#ifndef NO_STARTUPINFO_1sizeof
+		(jint)STARTUPINFO_sizeof(),
+#endif
+#ifndef NO_SYSTEMTIME_1sizeof
+		(jint)SYSTEMTIME_sizeof(),
+#endif
+#ifndef NO_TBBUTTON_1sizeof
+		(jint)TBBUTTON_sizeof(),
+#endif
+#ifndef NO_TBBUTTONINFO_1sizeof
+		(jint)TBBUTTONINFO_sizeof(),
+#endif
+#ifndef NO_TCHITTESTINFO_1sizeof
+		(jint)TCHITTESTINFO_sizeof(),
+#endif
+#ifndef NO_TCITEM_1sizeof
+		(jint)TCITEM_sizeof(),
+#endif
+#ifndef NO_TEXTMETRICA_1sizeof
+		(jint)TEXTMETRICA_sizeof(),
+#endif
+#ifndef NO_TEXTMETRICW_1sizeof
+		(jint)TEXTMETRICW_sizeof(),
+#endif
+#ifndef NO_TF_1DA_1COLOR_1sizeof
+		(jint)TF_DA_COLOR_sizeof(),
+#endif
+#ifndef NO_TF_1DISPLAYATTRIBUTE_1sizeof
+		(jint)TF_DISPLAYATTRIBUTE_sizeof(),
+#endif
+#ifndef NO_TOOLINFO_1sizeof
+		(jint)TOOLINFO_sizeof(),
+#endif
+#ifndef NO_TOUCHINPUT_1sizeof
+		(jint)TOUCHINPUT_sizeof(),
+#endif
+#ifndef NO_TRACKMOUSEEVENT_1sizeof
+		(jint)TRACKMOUSEEVENT_sizeof(),
+#endif
+#ifndef NO_TRIVERTEX_1sizeof
+		(jint)TRIVERTEX_sizeof(),
+#endif
+#ifndef NO_TVHITTESTINFO_1sizeof
+		(jint)TVHITTESTINFO_sizeof(),
+#endif
+#ifndef NO_TVINSERTSTRUCT_1sizeof
+		(jint)TVINSERTSTRUCT_sizeof(),
+#endif
+#ifndef NO_TVITEM_1sizeof
+		(jint)TVITEM_sizeof(),
+#endif
+#ifndef NO_TVITEMEX_1sizeof
+		(jint)TVITEMEX_sizeof(),
+#endif
+#ifndef NO_TVSORTCB_1sizeof
+		(jint)TVSORTCB_sizeof(),
+#endif
+#ifndef NO_UDACCEL_1sizeof
+		(jint)UDACCEL_sizeof(),
+#endif
+#ifndef NO_WINDOWPLACEMENT_1sizeof
+		(jint)WINDOWPLACEMENT_sizeof(),
+#endif
+#ifndef NO_WINDOWPOS_1sizeof
+		(jint)WINDOWPOS_sizeof(),
+#endif
+#ifndef NO_WNDCLASS_1sizeof
+		(jint)WNDCLASS_sizeof(),
+#endif
+		0
+	};
+	jint count = (jint)(sizeof(sizes) / sizeof(sizes[0])) - 1;
+	jstring rc = NULL;
+	OS_NATIVE_ENTER(env, that, sizeofs_FUNC);
+	if (arg0 && (*env)->GetArrayLength(env, arg0) >= count) (*env)->SetIntArrayRegion(env, arg0, 0, count, sizes);
+	rc = (*env)->NewStringUTF(env, names);
+	OS_NATIVE_EXIT(env, that, sizeofs_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_wcslen
+SWT_NATIVE_EXPORT jint JNICALL OS_NATIVE(wcslen)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	jint rc = 0;
+	OS_NATIVE_ENTER(env, that, wcslen_FUNC);
+	rc = (jint)wcslen((const wchar_t *)arg0);
+	OS_NATIVE_EXIT(env, that, wcslen_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_REGISTER_NATIVES
+static JNINativeMethod OS_nativeMethods[] = {
+#ifndef NO_ACCEL_1sizeof
+	{(char *)"ACCEL_sizeof", (char *)"()I", (void *)OS_NATIVE(ACCEL_1sizeof)},
+#endif
+#ifndef NO_ACTCTX_1sizeof
+	{(char *)"ACTCTX_sizeof", (char *)"()I", (void *)OS_NATIVE(ACTCTX_1sizeof)},
+#endif
+#ifndef NO_AbortDoc
+#ifndef JNI64
+	{(char *)"AbortDoc", (char *)"(I)I", (void *)OS_NATIVE(AbortDoc)},
+#else
+	{(char *)"AbortDoc", (char *)"(J)I", (void *)OS_NATIVE(AbortDoc)},
+#endif
+#endif
+#ifndef NO_ActivateActCtx
+#ifndef JNI64
+	{(char *)"ActivateActCtx", (char *)"(I[I)Z", (void *)OS_NATIVE(ActivateActCtx)},
+#else
+	{(char *)"ActivateActCtx", (char *)"(J[J)Z", (void *)OS_NATIVE(ActivateActCtx)},
+#endif
+#endif
+#ifndef NO_ActivateKeyboardLayout
+#ifndef JNI64
+	{(char *)"ActivateKeyboardLayout", (char *)"(II)I", (void *)OS_NATIVE(ActivateKeyboardLayout)},
+#else
+	{(char *)"ActivateKeyboardLayout", (char *)"(JI)J", (void *)OS_NATIVE(ActivateKeyboardLayout)},
+#endif
+#endif
+#ifndef NO_AddFontResourceExA
+#ifndef JNI64
+	{(char *)"AddFontResourceExA", (char *)"([BII)I", (void *)OS_NATIVE(AddFontResourceExA)},
+#else
+	{(char *)"AddFontResourceExA", (char *)"([BIJ)I", (void *)OS_NATIVE(AddFontResourceExA)},
+#endif
+#endif
+#ifndef NO_AddFontResourceExW
+#ifndef JNI64
+	{(char *)"AddFontResourceExW", (char *)"([CII)I", (void *)OS_NATIVE(AddFontResourceExW)},
+#else
+	{(char *)"AddFontResourceExW", (char *)"([CIJ)I", (void *)OS_NATIVE(AddFontResourceExW)},
+#endif
+#endif
+#ifndef NO_AdjustWindowRectEx
+	{(char *)"AdjustWindowRectEx", (char *)"(Lorg/eclipse/swt/internal/win32/RECT;IZI)Z", (void *)OS_NATIVE(AdjustWindowRectEx)},
+#endif
+#ifndef NO_AllowSetForegroundWindow
+	{(char *)"AllowSetForegroundWindow", (char *)"(I)Z", (void *)OS_NATIVE(AllowSetForegroundWindow)},
+#endif
+#ifndef NO_AlphaBlend
+#ifndef JNI64
+	{(char *)"AlphaBlend", (char *)"(IIIIIIIIIILorg/eclipse/swt/internal/win32/BLENDFUNCTION;)Z", (void *)OS_NATIVE(AlphaBlend)},
+#else
+	{(char *)"AlphaBlend", (char *)"(JIIIIJIIIILorg/eclipse/swt/internal/win32/BLENDFUNCTION;)Z", (void *)OS_NATIVE(AlphaBlend)},
+#endif
+#endif
+#ifndef NO_AnimateWindow
+#ifndef JNI64
+	{(char *)"AnimateWindow", (char *)"(III)Z", (void *)OS_NATIVE(AnimateWindow)},
+#else
+	{(char *)"AnimateWindow", (char *)"(JII)Z", (void *)OS_NATIVE(AnimateWindow)},
+#endif
+#endif
+#ifndef NO_Arc
+#ifndef JNI64
+	{(char *)"Arc", (char *)"(IIIIIIIII)Z", (void *)OS_NATIVE(Arc)},
+#else
+	{(char *)"Arc", (char *)"(JIIIIIIII)Z", (void *)OS_NATIVE(Arc)},
+#endif
+#endif
+#ifndef NO_AssocQueryStringA
+	{(char *)"AssocQueryStringA", (char *)"(II[B[B[B[I)I", (void *)OS_NATIVE(AssocQueryStringA)},
+#endif
+#ifndef NO_AssocQueryStringW
+	{(char *)"AssocQueryStringW", (char *)"(II[C[C[C[I)I", (void *)OS_NATIVE(AssocQueryStringW)},
+#endif
+#ifndef NO_AttachThreadInput
+	{(char *)"AttachThreadInput", (char *)"(IIZ)Z", (void *)OS_NATIVE(AttachThreadInput)},
+#endif
+#ifndef NO_BITMAPINFOHEADER_1sizeof
+	{(char *)"BITMAPINFOHEADER_sizeof", (char *)"()I", (void *)OS_NATIVE(BITMAPINFOHEADER_1sizeof)},
+#endif
+#ifndef NO_BITMAP_1sizeof
+	{(char *)"BITMAP_sizeof", (char *)"()I", (void *)OS_NATIVE(BITMAP_1sizeof)},
+#endif
+#ifndef NO_BLENDFUNCTION_1sizeof
+	{(char *)"BLENDFUNCTION_sizeof", (char *)"()I", (void *)OS_NATIVE(BLENDFUNCTION_1sizeof)},
+#endif
+#ifndef NO_BP_1PAINTPARAMS_1sizeof
+	{(char *)"BP_PAINTPARAMS_sizeof", (char *)"()I", (void *)OS_NATIVE(BP_1PAINTPARAMS_1sizeof)},
+#endif
+#ifndef NO_BROWSEINFO_1sizeof
+	{(char *)"BROWSEINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(BROWSEINFO_1sizeof)},
+#endif
+#ifndef NO_BUTTON_1IMAGELIST_1sizeof
+	{(char *)"BUTTON_IMAGELIST_sizeof", (char *)"()I", (void *)OS_NATIVE(BUTTON_1IMAGELIST_1sizeof)},
+#endif
+#ifndef NO_BeginBufferedPaint
+#ifndef JNI64
+	{(char *)"BeginBufferedPaint", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;ILorg/eclipse/swt/internal/win32/BP_PAINTPARAMS;[I)I", (void *)OS_NATIVE(BeginBufferedPaint)},
+#else
+	{(char *)"BeginBufferedPaint", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;ILorg/eclipse/swt/internal/win32/BP_PAINTPARAMS;[J)J", (void *)OS_NATIVE(BeginBufferedPaint)},
+#endif
+#endif
+#ifndef NO_BeginDeferWindowPos
+#ifndef JNI64
+	{(char *)"BeginDeferWindowPos", (char *)"(I)I", (void *)OS_NATIVE(BeginDeferWindowPos)},
+#else
+	{(char *)"BeginDeferWindowPos", (char *)"(I)J", (void *)OS_NATIVE(BeginDeferWindowPos)},
+#endif
+#endif
+#ifndef NO_BeginPaint
+#ifndef JNI64
+	{(char *)"BeginPaint", (char *)"(ILorg/eclipse/swt/internal/win32/PAINTSTRUCT;)I", (void *)OS_NATIVE(BeginPaint)},
+#else
+	{(char *)"BeginPaint", (char *)"(JLorg/eclipse/swt/internal/win32/PAINTSTRUCT;)J", (void *)OS_NATIVE(BeginPaint)},
+#endif
+#endif
+#ifndef NO_BeginPath
+#ifndef JNI64
+	{(char *)"BeginPath", (char *)"(I)Z", (void *)OS_NATIVE(BeginPath)},
+#else
+	{(char *)"BeginPath", (char *)"(J)Z", (void *)OS_NATIVE(BeginPath)},
+#endif
+#endif
+#ifndef NO_BitBlt
+#ifndef JNI64
+	{(char *)"BitBlt", (char *)"(IIIIIIIII)Z", (void *)OS_NATIVE(BitBlt)},
+#else
+	{(char *)"BitBlt", (char *)"(JIIIIJIII)Z", (void *)OS_NATIVE(BitBlt)},
+#endif
+#endif
+#ifndef NO_BringWindowToTop
+#ifndef JNI64
+	{(char *)"BringWindowToTop", (char *)"(I)Z", (void *)OS_NATIVE(BringWindowToTop)},
+#else
+	{(char *)"BringWindowToTop", (char *)"(J)Z", (void *)OS_NATIVE(BringWindowToTop)},
+#endif
+#endif
+#ifndef NO_BufferedPaintInit
+	{(char *)"BufferedPaintInit", (char *)"()I", (void *)OS_NATIVE(BufferedPaintInit)},
+#endif
+#ifndef NO_BufferedPaintSetAlpha
+#ifndef JNI64
+	{(char *)"BufferedPaintSetAlpha", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;B)I", (void *)OS_NATIVE(BufferedPaintSetAlpha)},
+#else
+	{(char *)"BufferedPaintSetAlpha", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;B)I", (void *)OS_NATIVE(BufferedPaintSetAlpha)},
+#endif
+#endif
+#ifndef NO_BufferedPaintUnInit
+	{(char *)"BufferedPaintUnInit", (char *)"()I", (void *)OS_NATIVE(BufferedPaintUnInit)},
+#endif
+#ifndef NO_CANDIDATEFORM_1sizeof
+	{(char *)"CANDIDATEFORM_sizeof", (char *)"()I", (void *)OS_NATIVE(CANDIDATEFORM_1sizeof)},
+#endif
+#ifndef NO_CERT_1CONTEXT_1sizeof
+	{(char *)"CERT_CONTEXT_sizeof", (char *)"()I", (void *)OS_NATIVE(CERT_1CONTEXT_1sizeof)},
+#endif
+#ifndef NO_CERT_1INFO_1sizeof
+	{(char *)"CERT_INFO_sizeof", (char *)"()I", (void *)OS_NATIVE(CERT_1INFO_1sizeof)},
+#endif
+#ifndef NO_CERT_1NAME_1BLOB_1sizeof
+	{(char *)"CERT_NAME_BLOB_sizeof", (char *)"()I", (void *)OS_NATIVE(CERT_1NAME_1BLOB_1sizeof)},
+#endif
+#ifndef NO_CERT_1PUBLIC_1KEY_1INFO_1sizeof
+	{(char *)"CERT_PUBLIC_KEY_INFO_sizeof", (char *)"()I", (void *)OS_NATIVE(CERT_1PUBLIC_1KEY_1INFO_1sizeof)},
+#endif
+#ifndef NO_CHOOSECOLOR_1sizeof
+	{(char *)"CHOOSECOLOR_sizeof", (char *)"()I", (void *)OS_NATIVE(CHOOSECOLOR_1sizeof)},
+#endif
+#ifndef NO_CHOOSEFONT_1sizeof
+	{(char *)"CHOOSEFONT_sizeof", (char *)"()I", (void *)OS_NATIVE(CHOOSEFONT_1sizeof)},
+#endif
+#ifndef NO_COMBOBOXINFO_1sizeof
+	{(char *)"COMBOBOXINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(COMBOBOXINFO_1sizeof)},
+#endif
+#ifndef NO_COMPOSITIONFORM_1sizeof
+	{(char *)"COMPOSITIONFORM_sizeof", (char *)"()I", (void *)OS_NATIVE(COMPOSITIONFORM_1sizeof)},
+#endif
+#ifndef NO_CREATESTRUCT_1sizeof
+	{(char *)"CREATESTRUCT_sizeof", (char *)"()I", (void *)OS_NATIVE(CREATESTRUCT_1sizeof)},
+#endif
+#ifndef NO_CRYPT_1ALGORITHM_1IDENTIFIER_1sizeof
+	{(char *)"CRYPT_ALGORITHM_IDENTIFIER_sizeof", (char *)"()I", (void *)OS_NATIVE(CRYPT_1ALGORITHM_1IDENTIFIER_1sizeof)},
+#endif
+#ifndef NO_CRYPT_1BIT_1BLOB_1sizeof
+	{(char *)"CRYPT_BIT_BLOB_sizeof", (char *)"()I", (void *)OS_NATIVE(CRYPT_1BIT_1BLOB_1sizeof)},
+#endif
+#ifndef NO_CRYPT_1INTEGER_1BLOB_1sizeof
+	{(char *)"CRYPT_INTEGER_BLOB_sizeof", (char *)"()I", (void *)OS_NATIVE(CRYPT_1INTEGER_1BLOB_1sizeof)},
+#endif
+#ifndef NO_CRYPT_1OBJID_1BLOB_1sizeof
+	{(char *)"CRYPT_OBJID_BLOB_sizeof", (char *)"()I", (void *)OS_NATIVE(CRYPT_1OBJID_1BLOB_1sizeof)},
+#endif
+#if (!defined(NO_Call__I) && !defined(JNI64)) || (!defined(NO_Call__J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Call", (char *)"(I)I", (void *)OS_NATIVE(Call__I)},
+#else
+	{(char *)"Call", (char *)"(J)I", (void *)OS_NATIVE(Call__J)},
+#endif
+#endif
+#if (!defined(NO_Call__ILorg_eclipse_swt_internal_win32_DLLVERSIONINFO_2) && !defined(JNI64)) || (!defined(NO_Call__JLorg_eclipse_swt_internal_win32_DLLVERSIONINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"Call", (char *)"(ILorg/eclipse/swt/internal/win32/DLLVERSIONINFO;)I", (void *)OS_NATIVE(Call__ILorg_eclipse_swt_internal_win32_DLLVERSIONINFO_2)},
+#else
+	{(char *)"Call", (char *)"(JLorg/eclipse/swt/internal/win32/DLLVERSIONINFO;)I", (void *)OS_NATIVE(Call__JLorg_eclipse_swt_internal_win32_DLLVERSIONINFO_2)},
+#endif
+#endif
+#ifndef NO_CallNextHookEx
+#ifndef JNI64
+	{(char *)"CallNextHookEx", (char *)"(IIII)I", (void *)OS_NATIVE(CallNextHookEx)},
+#else
+	{(char *)"CallNextHookEx", (char *)"(JIJJ)J", (void *)OS_NATIVE(CallNextHookEx)},
+#endif
+#endif
+#ifndef NO_CallWindowProcA
+#ifndef JNI64
+	{(char *)"CallWindowProcA", (char *)"(IIIII)I", (void *)OS_NATIVE(CallWindowProcA)},
+#else
+	{(char *)"CallWindowProcA", (char *)"(JJIJJ)J", (void *)OS_NATIVE(CallWindowProcA)},
+#endif
+#endif
+#ifndef NO_CallWindowProcW
+#ifndef JNI64
+	{(char *)"CallWindowProcW", (char *)"(IIIII)I", (void *)OS_NATIVE(CallWindowProcW)},
+#else
+	{(char *)"CallWindowProcW", (char *)"(JJIJJ)J", (void *)OS_NATIVE(CallWindowProcW)},
+#endif
+#endif
+#ifndef NO_CertNameToStrA
+	{(char *)"CertNameToStrA", (char *)"(ILorg/eclipse/swt/internal/win32/CERT_NAME_BLOB;I[BI)I", (void *)OS_NATIVE(CertNameToStrA)},
+#endif
+#ifndef NO_CertNameToStrW
+	{(char *)"CertNameToStrW", (char *)"(ILorg/eclipse/swt/internal/win32/CERT_NAME_BLOB;I[CI)I", (void *)OS_NATIVE(CertNameToStrW)},
+#endif
+#ifndef NO_CharLowerA
+#ifndef JNI64
+	{(char *)"CharLowerA", (char *)"(I)I", (void *)OS_NATIVE(CharLowerA)},
+#else
+	{(char *)"CharLowerA", (char *)"(J)J", (void *)OS_NATIVE(CharLowerA)},
+#endif
+#endif
+#ifndef NO_CharLowerW
+#ifndef JNI64
+	{(char *)"CharLowerW", (char *)"(I)I", (void *)OS_NATIVE(CharLowerW)},
+#else
+	{(char *)"CharLowerW", (char *)"(J)J", (void *)OS_NATIVE(CharLowerW)},
+#endif
+#endif
+#ifndef NO_CharUpperA
+#ifndef JNI64
+	{(char *)"CharUpperA", (char *)"(I)I", (void *)OS_NATIVE(CharUpperA)},
+#else
+	{(char *)"CharUpperA", (char *)"(J)J", (void *)OS_NATIVE(CharUpperA)},
+#endif
+#endif
+#ifndef NO_CharUpperW
+#ifndef JNI64
+	{(char *)"CharUpperW", (char *)"(I)I", (void *)OS_NATIVE(CharUpperW)},
+#else
+	{(char *)"CharUpperW", (char *)"(J)J", (void *)OS_NATIVE(CharUpperW)},
+#endif
+#endif
+#ifndef NO_CheckMenuItem
+#ifndef JNI64
+	{(char *)"CheckMenuItem", (char *)"(III)Z", (void *)OS_NATIVE(CheckMenuItem)},
+#else
+	{(char *)"CheckMenuItem", (char *)"(JII)Z", (void *)OS_NATIVE(CheckMenuItem)},
+#endif
+#endif
+#ifndef NO_ChooseColorA
+	{(char *)"ChooseColorA", (char *)"(Lorg/eclipse/swt/internal/win32/CHOOSECOLOR;)Z", (void *)OS_NATIVE(ChooseColorA)},
+#endif
+#ifndef NO_ChooseColorW
+	{(char *)"ChooseColorW", (char *)"(Lorg/eclipse/swt/internal/win32/CHOOSECOLOR;)Z", (void *)OS_NATIVE(ChooseColorW)},
+#endif
+#ifndef NO_ChooseFontA
+	{(char *)"ChooseFontA", (char *)"(Lorg/eclipse/swt/internal/win32/CHOOSEFONT;)Z", (void *)OS_NATIVE(ChooseFontA)},
+#endif
+#ifndef NO_ChooseFontW
+	{(char *)"ChooseFontW", (char *)"(Lorg/eclipse/swt/internal/win32/CHOOSEFONT;)Z", (void *)OS_NATIVE(ChooseFontW)},
+#endif
+#ifndef NO_ClientToScreen
+#ifndef JNI64
+	{(char *)"ClientToScreen", (char *)"(ILorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(ClientToScreen)},
+#else
+	{(char *)"ClientToScreen", (char *)"(JLorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(ClientToScreen)},
+#endif
+#endif
+#ifndef NO_CloseClipboard
+	{(char *)"CloseClipboard", (char *)"()Z", (void *)OS_NATIVE(CloseClipboard)},
+#endif
+#ifndef NO_CloseEnhMetaFile
+#ifndef JNI64
+	{(char *)"CloseEnhMetaFile", (char *)"(I)I", (void *)OS_NATIVE(CloseEnhMetaFile)},
+#else
+	{(char *)"CloseEnhMetaFile", (char *)"(J)J", (void *)OS_NATIVE(CloseEnhMetaFile)},
+#endif
+#endif
+#ifndef NO_CloseGestureInfoHandle
+#ifndef JNI64
+	{(char *)"CloseGestureInfoHandle", (char *)"(I)I", (void *)OS_NATIVE(CloseGestureInfoHandle)},
+#else
+	{(char *)"CloseGestureInfoHandle", (char *)"(J)J", (void *)OS_NATIVE(CloseGestureInfoHandle)},
+#endif
+#endif
+#ifndef NO_CloseHandle
+#ifndef JNI64
+	{(char *)"CloseHandle", (char *)"(I)Z", (void *)OS_NATIVE(CloseHandle)},
+#else
+	{(char *)"CloseHandle", (char *)"(J)Z", (void *)OS_NATIVE(CloseHandle)},
+#endif
+#endif
+#ifndef NO_ClosePrinter
+#ifndef JNI64
+	{(char *)"ClosePrinter", (char *)"(I)Z", (void *)OS_NATIVE(ClosePrinter)},
+#else
+	{(char *)"ClosePrinter", (char *)"(J)Z", (void *)OS_NATIVE(ClosePrinter)},
+#endif
+#endif
+#ifndef NO_CloseThemeData
+#ifndef JNI64
+	{(char *)"CloseThemeData", (char *)"(I)I", (void *)OS_NATIVE(CloseThemeData)},
+#else
+	{(char *)"CloseThemeData", (char *)"(J)I", (void *)OS_NATIVE(CloseThemeData)},
+#endif
+#endif
+#ifndef NO_CloseTouchInputHandle
+#ifndef JNI64
+	{(char *)"CloseTouchInputHandle", (char *)"(I)Z", (void *)OS_NATIVE(CloseTouchInputHandle)},
+#else
+	{(char *)"CloseTouchInputHandle", (char *)"(J)Z", (void *)OS_NATIVE(CloseTouchInputHandle)},
+#endif
+#endif
+#ifndef NO_CoCreateInstance
+#ifndef JNI64
+	{(char *)"CoCreateInstance", (char *)"([BII[B[I)I", (void *)OS_NATIVE(CoCreateInstance)},
+#else
+	{(char *)"CoCreateInstance", (char *)"([BJI[B[J)I", (void *)OS_NATIVE(CoCreateInstance)},
+#endif
+#endif
+#ifndef NO_CoInternetIsFeatureEnabled
+	{(char *)"CoInternetIsFeatureEnabled", (char *)"(II)I", (void *)OS_NATIVE(CoInternetIsFeatureEnabled)},
+#endif
+#ifndef NO_CoInternetSetFeatureEnabled
+	{(char *)"CoInternetSetFeatureEnabled", (char *)"(IIZ)I", (void *)OS_NATIVE(CoInternetSetFeatureEnabled)},
+#endif
+#ifndef NO_CoTaskMemAlloc
+#ifndef JNI64
+	{(char *)"CoTaskMemAlloc", (char *)"(I)I", (void *)OS_NATIVE(CoTaskMemAlloc)},
+#else
+	{(char *)"CoTaskMemAlloc", (char *)"(I)J", (void *)OS_NATIVE(CoTaskMemAlloc)},
+#endif
+#endif
+#ifndef NO_CoTaskMemFree
+#ifndef JNI64
+	{(char *)"CoTaskMemFree", (char *)"(I)V", (void *)OS_NATIVE(CoTaskMemFree)},
+#else
+	{(char *)"CoTaskMemFree", (char *)"(J)V", (void *)OS_NATIVE(CoTaskMemFree)},
+#endif
+#endif
+#ifndef NO_CombineRgn
+#ifndef JNI64
+	{(char *)"CombineRgn", (char *)"(IIII)I", (void *)OS_NATIVE(CombineRgn)},
+#else
+	{(char *)"CombineRgn", (char *)"(JJJI)I", (void *)OS_NATIVE(CombineRgn)},
+#endif
+#endif
+#ifndef NO_CommDlgExtendedError
+	{(char *)"CommDlgExtendedError", (char *)"()I", (void *)OS_NATIVE(CommDlgExtendedError)},
+#endif
+#ifndef NO_CommandBar_1AddAdornments
+#ifndef JNI64
+	{(char *)"CommandBar_AddAdornments", (char *)"(III)Z", (void *)OS_NATIVE(CommandBar_1AddAdornments)},
+#else
+	{(char *)"CommandBar_AddAdornments", (char *)"(JII)Z", (void *)OS_NATIVE(CommandBar_1AddAdornments)},
+#endif
+#endif
+#ifndef NO_CommandBar_1Create
+#ifndef JNI64
+	{(char *)"CommandBar_Create", (char *)"(III)I", (void *)OS_NATIVE(CommandBar_1Create)},
+#else
+	{(char *)"CommandBar_Create", (char *)"(JJI)J", (void *)OS_NATIVE(CommandBar_1Create)},
+#endif
+#endif
+#ifndef NO_CommandBar_1Destroy
+#ifndef JNI64
+	{(char *)"CommandBar_Destroy", (char *)"(I)V", (void *)OS_NATIVE(CommandBar_1Destroy)},
+#else
+	{(char *)"CommandBar_Destroy", (char *)"(J)V", (void *)OS_NATIVE(CommandBar_1Destroy)},
+#endif
+#endif
+#ifndef NO_CommandBar_1DrawMenuBar
+#ifndef JNI64
+	{(char *)"CommandBar_DrawMenuBar", (char *)"(II)Z", (void *)OS_NATIVE(CommandBar_1DrawMenuBar)},
+#else
+	{(char *)"CommandBar_DrawMenuBar", (char *)"(JI)Z", (void *)OS_NATIVE(CommandBar_1DrawMenuBar)},
+#endif
+#endif
+#ifndef NO_CommandBar_1Height
+#ifndef JNI64
+	{(char *)"CommandBar_Height", (char *)"(I)I", (void *)OS_NATIVE(CommandBar_1Height)},
+#else
+	{(char *)"CommandBar_Height", (char *)"(J)I", (void *)OS_NATIVE(CommandBar_1Height)},
+#endif
+#endif
+#ifndef NO_CommandBar_1InsertMenubarEx
+#ifndef JNI64
+	{(char *)"CommandBar_InsertMenubarEx", (char *)"(IIII)Z", (void *)OS_NATIVE(CommandBar_1InsertMenubarEx)},
+#else
+	{(char *)"CommandBar_InsertMenubarEx", (char *)"(JJJI)Z", (void *)OS_NATIVE(CommandBar_1InsertMenubarEx)},
+#endif
+#endif
+#ifndef NO_CommandBar_1Show
+#ifndef JNI64
+	{(char *)"CommandBar_Show", (char *)"(IZ)Z", (void *)OS_NATIVE(CommandBar_1Show)},
+#else
+	{(char *)"CommandBar_Show", (char *)"(JZ)Z", (void *)OS_NATIVE(CommandBar_1Show)},
+#endif
+#endif
+#ifndef NO_CopyImage
+#ifndef JNI64
+	{(char *)"CopyImage", (char *)"(IIIII)I", (void *)OS_NATIVE(CopyImage)},
+#else
+	{(char *)"CopyImage", (char *)"(JIIII)J", (void *)OS_NATIVE(CopyImage)},
+#endif
+#endif
+#ifndef NO_CreateAcceleratorTableA
+#ifndef JNI64
+	{(char *)"CreateAcceleratorTableA", (char *)"([BI)I", (void *)OS_NATIVE(CreateAcceleratorTableA)},
+#else
+	{(char *)"CreateAcceleratorTableA", (char *)"([BI)J", (void *)OS_NATIVE(CreateAcceleratorTableA)},
+#endif
+#endif
+#ifndef NO_CreateAcceleratorTableW
+#ifndef JNI64
+	{(char *)"CreateAcceleratorTableW", (char *)"([BI)I", (void *)OS_NATIVE(CreateAcceleratorTableW)},
+#else
+	{(char *)"CreateAcceleratorTableW", (char *)"([BI)J", (void *)OS_NATIVE(CreateAcceleratorTableW)},
+#endif
+#endif
+#ifndef NO_CreateActCtxA
+#ifndef JNI64
+	{(char *)"CreateActCtxA", (char *)"(Lorg/eclipse/swt/internal/win32/ACTCTX;)I", (void *)OS_NATIVE(CreateActCtxA)},
+#else
+	{(char *)"CreateActCtxA", (char *)"(Lorg/eclipse/swt/internal/win32/ACTCTX;)J", (void *)OS_NATIVE(CreateActCtxA)},
+#endif
+#endif
+#ifndef NO_CreateActCtxW
+#ifndef JNI64
+	{(char *)"CreateActCtxW", (char *)"(Lorg/eclipse/swt/internal/win32/ACTCTX;)I", (void *)OS_NATIVE(CreateActCtxW)},
+#else
+	{(char *)"CreateActCtxW", (char *)"(Lorg/eclipse/swt/internal/win32/ACTCTX;)J", (void *)OS_NATIVE(CreateActCtxW)},
+#endif
+#endif
+#ifndef NO_CreateBitmap
+#ifndef JNI64
+	{(char *)"CreateBitmap", (char *)"(IIII[B)I", (void *)OS_NATIVE(CreateBitmap)},
+#else
+	{(char *)"CreateBitmap", (char *)"(IIII[B)J", (void *)OS_NATIVE(CreateBitmap)},
+#endif
+#endif
+#ifndef NO_CreateCaret
+#ifndef JNI64
+	{(char *)"CreateCaret", (char *)"(IIII)Z", (void *)OS_NATIVE(CreateCaret)},
+#else
+	{(char *)"CreateCaret", (char *)"(JJII)Z", (void *)OS_NATIVE(CreateCaret)},
+#endif
+#endif
+#ifndef NO_CreateCompatibleBitmap
+#ifndef JNI64
+	{(char *)"CreateCompatibleBitmap", (char *)"(III)I", (void *)OS_NATIVE(CreateCompatibleBitmap)},
+#else
+	{(char *)"CreateCompatibleBitmap", (char *)"(JII)J", (void *)OS_NATIVE(CreateCompatibleBitmap)},
+#endif
+#endif
+#ifndef NO_CreateCompatibleDC
+#ifndef JNI64
+	{(char *)"CreateCompatibleDC", (char *)"(I)I", (void *)OS_NATIVE(CreateCompatibleDC)},
+#else
+	{(char *)"CreateCompatibleDC", (char *)"(J)J", (void *)OS_NATIVE(CreateCompatibleDC)},
+#endif
+#endif
+#ifndef NO_CreateCursor
+#ifndef JNI64
+	{(char *)"CreateCursor", (char *)"(IIIII[B[B)I", (void *)OS_NATIVE(CreateCursor)},
+#else
+	{(char *)"CreateCursor", (char *)"(JIIII[B[B)J", (void *)OS_NATIVE(CreateCursor)},
+#endif
+#endif
+#ifndef NO_CreateDCA
+#ifndef JNI64
+	{(char *)"CreateDCA", (char *)"([B[BII)I", (void *)OS_NATIVE(CreateDCA)},
+#else
+	{(char *)"CreateDCA", (char *)"([B[BJJ)J", (void *)OS_NATIVE(CreateDCA)},
+#endif
+#endif
+#ifndef NO_CreateDCW
+#ifndef JNI64
+	{(char *)"CreateDCW", (char *)"([C[CII)I", (void *)OS_NATIVE(CreateDCW)},
+#else
+	{(char *)"CreateDCW", (char *)"([C[CJJ)J", (void *)OS_NATIVE(CreateDCW)},
+#endif
+#endif
+#if (!defined(NO_CreateDIBSection__III_3III) && !defined(JNI64)) || (!defined(NO_CreateDIBSection__JJI_3JJI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"CreateDIBSection", (char *)"(III[III)I", (void *)OS_NATIVE(CreateDIBSection__III_3III)},
+#else
+	{(char *)"CreateDIBSection", (char *)"(JJI[JJI)J", (void *)OS_NATIVE(CreateDIBSection__JJI_3JJI)},
+#endif
+#endif
+#if (!defined(NO_CreateDIBSection__I_3BI_3III) && !defined(JNI64)) || (!defined(NO_CreateDIBSection__J_3BI_3JJI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"CreateDIBSection", (char *)"(I[BI[III)I", (void *)OS_NATIVE(CreateDIBSection__I_3BI_3III)},
+#else
+	{(char *)"CreateDIBSection", (char *)"(J[BI[JJI)J", (void *)OS_NATIVE(CreateDIBSection__J_3BI_3JJI)},
+#endif
+#endif
+#ifndef NO_CreateEnhMetaFileA
+#ifndef JNI64
+	{(char *)"CreateEnhMetaFileA", (char *)"(I[BLorg/eclipse/swt/internal/win32/RECT;[B)I", (void *)OS_NATIVE(CreateEnhMetaFileA)},
+#else
+	{(char *)"CreateEnhMetaFileA", (char *)"(J[BLorg/eclipse/swt/internal/win32/RECT;[B)J", (void *)OS_NATIVE(CreateEnhMetaFileA)},
+#endif
+#endif
+#ifndef NO_CreateEnhMetaFileW
+#ifndef JNI64
+	{(char *)"CreateEnhMetaFileW", (char *)"(I[CLorg/eclipse/swt/internal/win32/RECT;[C)I", (void *)OS_NATIVE(CreateEnhMetaFileW)},
+#else
+	{(char *)"CreateEnhMetaFileW", (char *)"(J[CLorg/eclipse/swt/internal/win32/RECT;[C)J", (void *)OS_NATIVE(CreateEnhMetaFileW)},
+#endif
+#endif
+#if (!defined(NO_CreateFontIndirectA__I) && !defined(JNI64)) || (!defined(NO_CreateFontIndirectA__J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"CreateFontIndirectA", (char *)"(I)I", (void *)OS_NATIVE(CreateFontIndirectA__I)},
+#else
+	{(char *)"CreateFontIndirectA", (char *)"(J)J", (void *)OS_NATIVE(CreateFontIndirectA__J)},
+#endif
+#endif
+#ifndef NO_CreateFontIndirectA__Lorg_eclipse_swt_internal_win32_LOGFONTA_2
+#ifndef JNI64
+	{(char *)"CreateFontIndirectA", (char *)"(Lorg/eclipse/swt/internal/win32/LOGFONTA;)I", (void *)OS_NATIVE(CreateFontIndirectA__Lorg_eclipse_swt_internal_win32_LOGFONTA_2)},
+#else
+	{(char *)"CreateFontIndirectA", (char *)"(Lorg/eclipse/swt/internal/win32/LOGFONTA;)J", (void *)OS_NATIVE(CreateFontIndirectA__Lorg_eclipse_swt_internal_win32_LOGFONTA_2)},
+#endif
+#endif
+#if (!defined(NO_CreateFontIndirectW__I) && !defined(JNI64)) || (!defined(NO_CreateFontIndirectW__J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"CreateFontIndirectW", (char *)"(I)I", (void *)OS_NATIVE(CreateFontIndirectW__I)},
+#else
+	{(char *)"CreateFontIndirectW", (char *)"(J)J", (void *)OS_NATIVE(CreateFontIndirectW__J)},
+#endif
+#endif
+#ifndef NO_CreateFontIndirectW__Lorg_eclipse_swt_internal_win32_LOGFONTW_2
+#ifndef JNI64
+	{(char *)"CreateFontIndirectW", (char *)"(Lorg/eclipse/swt/internal/win32/LOGFONTW;)I", (void *)OS_NATIVE(CreateFontIndirectW__Lorg_eclipse_swt_internal_win32_LOGFONTW_2)},
+#else
+	{(char *)"CreateFontIndirectW", (char *)"(Lorg/eclipse/swt/internal/win32/LOGFONTW;)J", (void *)OS_NATIVE(CreateFontIndirectW__Lorg_eclipse_swt_internal_win32_LOGFONTW_2)},
+#endif
+#endif
+#ifndef NO_CreateIconIndirect
+#ifndef JNI64
+	{(char *)"CreateIconIndirect", (char *)"(Lorg/eclipse/swt/internal/win32/ICONINFO;)I", (void *)OS_NATIVE(CreateIconIndirect)},
+#else
+	{(char *)"CreateIconIndirect", (char *)"(Lorg/eclipse/swt/internal/win32/ICONINFO;)J", (void *)OS_NATIVE(CreateIconIndirect)},
+#endif
+#endif
+#ifndef NO_CreateMenu
+#ifndef JNI64
+	{(char *)"CreateMenu", (char *)"()I", (void *)OS_NATIVE(CreateMenu)},
+#else
+	{(char *)"CreateMenu", (char *)"()J", (void *)OS_NATIVE(CreateMenu)},
+#endif
+#endif
+#ifndef NO_CreatePalette
+#ifndef JNI64
+	{(char *)"CreatePalette", (char *)"([B)I", (void *)OS_NATIVE(CreatePalette)},
+#else
+	{(char *)"CreatePalette", (char *)"([B)J", (void *)OS_NATIVE(CreatePalette)},
+#endif
+#endif
+#ifndef NO_CreatePatternBrush
+#ifndef JNI64
+	{(char *)"CreatePatternBrush", (char *)"(I)I", (void *)OS_NATIVE(CreatePatternBrush)},
+#else
+	{(char *)"CreatePatternBrush", (char *)"(J)J", (void *)OS_NATIVE(CreatePatternBrush)},
+#endif
+#endif
+#ifndef NO_CreatePen
+#ifndef JNI64
+	{(char *)"CreatePen", (char *)"(III)I", (void *)OS_NATIVE(CreatePen)},
+#else
+	{(char *)"CreatePen", (char *)"(III)J", (void *)OS_NATIVE(CreatePen)},
+#endif
+#endif
+#ifndef NO_CreatePolygonRgn
+#ifndef JNI64
+	{(char *)"CreatePolygonRgn", (char *)"([III)I", (void *)OS_NATIVE(CreatePolygonRgn)},
+#else
+	{(char *)"CreatePolygonRgn", (char *)"([III)J", (void *)OS_NATIVE(CreatePolygonRgn)},
+#endif
+#endif
+#ifndef NO_CreatePopupMenu
+#ifndef JNI64
+	{(char *)"CreatePopupMenu", (char *)"()I", (void *)OS_NATIVE(CreatePopupMenu)},
+#else
+	{(char *)"CreatePopupMenu", (char *)"()J", (void *)OS_NATIVE(CreatePopupMenu)},
+#endif
+#endif
+#ifndef NO_CreateProcessA
+#ifndef JNI64
+	{(char *)"CreateProcessA", (char *)"(IIIIZIIILorg/eclipse/swt/internal/win32/STARTUPINFO;Lorg/eclipse/swt/internal/win32/PROCESS_INFORMATION;)Z", (void *)OS_NATIVE(CreateProcessA)},
+#else
+	{(char *)"CreateProcessA", (char *)"(JJJJZIJJLorg/eclipse/swt/internal/win32/STARTUPINFO;Lorg/eclipse/swt/internal/win32/PROCESS_INFORMATION;)Z", (void *)OS_NATIVE(CreateProcessA)},
+#endif
+#endif
+#ifndef NO_CreateProcessW
+#ifndef JNI64
+	{(char *)"CreateProcessW", (char *)"(IIIIZIIILorg/eclipse/swt/internal/win32/STARTUPINFO;Lorg/eclipse/swt/internal/win32/PROCESS_INFORMATION;)Z", (void *)OS_NATIVE(CreateProcessW)},
+#else
+	{(char *)"CreateProcessW", (char *)"(JJJJZIJJLorg/eclipse/swt/internal/win32/STARTUPINFO;Lorg/eclipse/swt/internal/win32/PROCESS_INFORMATION;)Z", (void *)OS_NATIVE(CreateProcessW)},
+#endif
+#endif
+#ifndef NO_CreateRectRgn
+#ifndef JNI64
+	{(char *)"CreateRectRgn", (char *)"(IIII)I", (void *)OS_NATIVE(CreateRectRgn)},
+#else
+	{(char *)"CreateRectRgn", (char *)"(IIII)J", (void *)OS_NATIVE(CreateRectRgn)},
+#endif
+#endif
+#ifndef NO_CreateSolidBrush
+#ifndef JNI64
+	{(char *)"CreateSolidBrush", (char *)"(I)I", (void *)OS_NATIVE(CreateSolidBrush)},
+#else
+	{(char *)"CreateSolidBrush", (char *)"(I)J", (void *)OS_NATIVE(CreateSolidBrush)},
+#endif
+#endif
+#ifndef NO_CreateStreamOnHGlobal
+#ifndef JNI64
+	{(char *)"CreateStreamOnHGlobal", (char *)"(IZ[I)I", (void *)OS_NATIVE(CreateStreamOnHGlobal)},
+#else
+	{(char *)"CreateStreamOnHGlobal", (char *)"(JZ[J)I", (void *)OS_NATIVE(CreateStreamOnHGlobal)},
+#endif
+#endif
+#ifndef NO_CreateWindowExA
+#ifndef JNI64
+	{(char *)"CreateWindowExA", (char *)"(I[B[BIIIIIIIILorg/eclipse/swt/internal/win32/CREATESTRUCT;)I", (void *)OS_NATIVE(CreateWindowExA)},
+#else
+	{(char *)"CreateWindowExA", (char *)"(I[B[BIIIIIJJJLorg/eclipse/swt/internal/win32/CREATESTRUCT;)J", (void *)OS_NATIVE(CreateWindowExA)},
+#endif
+#endif
+#ifndef NO_CreateWindowExW
+#ifndef JNI64
+	{(char *)"CreateWindowExW", (char *)"(I[C[CIIIIIIIILorg/eclipse/swt/internal/win32/CREATESTRUCT;)I", (void *)OS_NATIVE(CreateWindowExW)},
+#else
+	{(char *)"CreateWindowExW", (char *)"(I[C[CIIIIIJJJLorg/eclipse/swt/internal/win32/CREATESTRUCT;)J", (void *)OS_NATIVE(CreateWindowExW)},
+#endif
+#endif
+#ifndef NO_DEVMODEA_1sizeof
+	{(char *)"DEVMODEA_sizeof", (char *)"()I", (void *)OS_NATIVE(DEVMODEA_1sizeof)},
+#endif
+#ifndef NO_DEVMODEW_1sizeof
+	{(char *)"DEVMODEW_sizeof", (char *)"()I", (void *)OS_NATIVE(DEVMODEW_1sizeof)},
+#endif
+#ifndef NO_DIBSECTION_1sizeof
+	{(char *)"DIBSECTION_sizeof", (char *)"()I", (void *)OS_NATIVE(DIBSECTION_1sizeof)},
+#endif
+#ifndef NO_DLLVERSIONINFO_1sizeof
+	{(char *)"DLLVERSIONINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(DLLVERSIONINFO_1sizeof)},
+#endif
+#ifndef NO_DOCHOSTUIINFO_1sizeof
+	{(char *)"DOCHOSTUIINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(DOCHOSTUIINFO_1sizeof)},
+#endif
+#ifndef NO_DOCINFO_1sizeof
+	{(char *)"DOCINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(DOCINFO_1sizeof)},
+#endif
+#ifndef NO_DPtoLP
+#ifndef JNI64
+	{(char *)"DPtoLP", (char *)"(ILorg/eclipse/swt/internal/win32/POINT;I)Z", (void *)OS_NATIVE(DPtoLP)},
+#else
+	{(char *)"DPtoLP", (char *)"(JLorg/eclipse/swt/internal/win32/POINT;I)Z", (void *)OS_NATIVE(DPtoLP)},
+#endif
+#endif
+#ifndef NO_DRAWITEMSTRUCT_1sizeof
+	{(char *)"DRAWITEMSTRUCT_sizeof", (char *)"()I", (void *)OS_NATIVE(DRAWITEMSTRUCT_1sizeof)},
+#endif
+#ifndef NO_DROPFILES_1sizeof
+	{(char *)"DROPFILES_sizeof", (char *)"()I", (void *)OS_NATIVE(DROPFILES_1sizeof)},
+#endif
+#ifndef NO_DTTOPTS_1sizeof
+	{(char *)"DTTOPTS_sizeof", (char *)"()I", (void *)OS_NATIVE(DTTOPTS_1sizeof)},
+#endif
+#ifndef NO_DWM_1BLURBEHIND_1sizeof
+	{(char *)"DWM_BLURBEHIND_sizeof", (char *)"()I", (void *)OS_NATIVE(DWM_1BLURBEHIND_1sizeof)},
+#endif
+#ifndef NO_DefFrameProcA
+#ifndef JNI64
+	{(char *)"DefFrameProcA", (char *)"(IIIII)I", (void *)OS_NATIVE(DefFrameProcA)},
+#else
+	{(char *)"DefFrameProcA", (char *)"(JJIJJ)J", (void *)OS_NATIVE(DefFrameProcA)},
+#endif
+#endif
+#ifndef NO_DefFrameProcW
+#ifndef JNI64
+	{(char *)"DefFrameProcW", (char *)"(IIIII)I", (void *)OS_NATIVE(DefFrameProcW)},
+#else
+	{(char *)"DefFrameProcW", (char *)"(JJIJJ)J", (void *)OS_NATIVE(DefFrameProcW)},
+#endif
+#endif
+#ifndef NO_DefMDIChildProcA
+#ifndef JNI64
+	{(char *)"DefMDIChildProcA", (char *)"(IIII)I", (void *)OS_NATIVE(DefMDIChildProcA)},
+#else
+	{(char *)"DefMDIChildProcA", (char *)"(JIJJ)J", (void *)OS_NATIVE(DefMDIChildProcA)},
+#endif
+#endif
+#ifndef NO_DefMDIChildProcW
+#ifndef JNI64
+	{(char *)"DefMDIChildProcW", (char *)"(IIII)I", (void *)OS_NATIVE(DefMDIChildProcW)},
+#else
+	{(char *)"DefMDIChildProcW", (char *)"(JIJJ)J", (void *)OS_NATIVE(DefMDIChildProcW)},
+#endif
+#endif
+#ifndef NO_DefWindowProcA
+#ifndef JNI64
+	{(char *)"DefWindowProcA", (char *)"(IIII)I", (void *)OS_NATIVE(DefWindowProcA)},
+#else
+	{(char *)"DefWindowProcA", (char *)"(JIJJ)J", (void *)OS_NATIVE(DefWindowProcA)},
+#endif
+#endif
+#ifndef NO_DefWindowProcW
+#ifndef JNI64
+	{(char *)"DefWindowProcW", (char *)"(IIII)I", (void *)OS_NATIVE(DefWindowProcW)},
+#else
+	{(char *)"DefWindowProcW", (char *)"(JIJJ)J", (void *)OS_NATIVE(DefWindowProcW)},
+#endif
+#endif
+#ifndef NO_DeferWindowPos
+#ifndef JNI64
+	{(char *)"DeferWindowPos", (char *)"(IIIIIIII)I", (void *)OS_NATIVE(DeferWindowPos)},
+#else
+	{(char *)"DeferWindowPos", (char *)"(JJJIIIII)J", (void *)OS_NATIVE(DeferWindowPos)},
+#endif
+#endif
+#ifndef NO_DeleteDC
+#ifndef JNI64
+	{(char *)"DeleteDC", (char *)"(I)Z", (void *)OS_NATIVE(DeleteDC)},
+#else
+	{(char *)"DeleteDC", (char *)"(J)Z", (void *)OS_NATIVE(DeleteDC)},
+#endif
+#endif
+#ifndef NO_DeleteEnhMetaFile
+#ifndef JNI64
+	{(char *)"DeleteEnhMetaFile", (char *)"(I)Z", (void *)OS_NATIVE(DeleteEnhMetaFile)},
+#else
+	{(char *)"DeleteEnhMetaFile", (char *)"(J)Z", (void *)OS_NATIVE(DeleteEnhMetaFile)},
+#endif
+#endif
+#ifndef NO_DeleteMenu
+#ifndef JNI64
+	{(char *)"DeleteMenu", (char *)"(III)Z", (void *)OS_NATIVE(DeleteMenu)},
+#else
+	{(char *)"DeleteMenu", (char *)"(JII)Z", (void *)OS_NATIVE(DeleteMenu)},
+#endif
+#endif
+#ifndef NO_DeleteObject
+#ifndef JNI64
+	{(char *)"DeleteObject", (char *)"(I)Z", (void *)OS_NATIVE(DeleteObject)},
+#else
+	{(char *)"DeleteObject", (char *)"(J)Z", (void *)OS_NATIVE(DeleteObject)},
+#endif
+#endif
+#ifndef NO_DestroyAcceleratorTable
+#ifndef JNI64
+	{(char *)"DestroyAcceleratorTable", (char *)"(I)Z", (void *)OS_NATIVE(DestroyAcceleratorTable)},
+#else
+	{(char *)"DestroyAcceleratorTable", (char *)"(J)Z", (void *)OS_NATIVE(DestroyAcceleratorTable)},
+#endif
+#endif
+#ifndef NO_DestroyCaret
+	{(char *)"DestroyCaret", (char *)"()Z", (void *)OS_NATIVE(DestroyCaret)},
+#endif
+#ifndef NO_DestroyCursor
+#ifndef JNI64
+	{(char *)"DestroyCursor", (char *)"(I)Z", (void *)OS_NATIVE(DestroyCursor)},
+#else
+	{(char *)"DestroyCursor", (char *)"(J)Z", (void *)OS_NATIVE(DestroyCursor)},
+#endif
+#endif
+#ifndef NO_DestroyIcon
+#ifndef JNI64
+	{(char *)"DestroyIcon", (char *)"(I)Z", (void *)OS_NATIVE(DestroyIcon)},
+#else
+	{(char *)"DestroyIcon", (char *)"(J)Z", (void *)OS_NATIVE(DestroyIcon)},
+#endif
+#endif
+#ifndef NO_DestroyMenu
+#ifndef JNI64
+	{(char *)"DestroyMenu", (char *)"(I)Z", (void *)OS_NATIVE(DestroyMenu)},
+#else
+	{(char *)"DestroyMenu", (char *)"(J)Z", (void *)OS_NATIVE(DestroyMenu)},
+#endif
+#endif
+#ifndef NO_DestroyWindow
+#ifndef JNI64
+	{(char *)"DestroyWindow", (char *)"(I)Z", (void *)OS_NATIVE(DestroyWindow)},
+#else
+	{(char *)"DestroyWindow", (char *)"(J)Z", (void *)OS_NATIVE(DestroyWindow)},
+#endif
+#endif
+#ifndef NO_DispatchMessageA
+#ifndef JNI64
+	{(char *)"DispatchMessageA", (char *)"(Lorg/eclipse/swt/internal/win32/MSG;)I", (void *)OS_NATIVE(DispatchMessageA)},
+#else
+	{(char *)"DispatchMessageA", (char *)"(Lorg/eclipse/swt/internal/win32/MSG;)J", (void *)OS_NATIVE(DispatchMessageA)},
+#endif
+#endif
+#ifndef NO_DispatchMessageW
+#ifndef JNI64
+	{(char *)"DispatchMessageW", (char *)"(Lorg/eclipse/swt/internal/win32/MSG;)I", (void *)OS_NATIVE(DispatchMessageW)},
+#else
+	{(char *)"DispatchMessageW", (char *)"(Lorg/eclipse/swt/internal/win32/MSG;)J", (void *)OS_NATIVE(DispatchMessageW)},
+#endif
+#endif
+#ifndef NO_DocumentPropertiesA
+#ifndef JNI64
+	{(char *)"DocumentPropertiesA", (char *)"(II[BIII)I", (void *)OS_NATIVE(DocumentPropertiesA)},
+#else
+	{(char *)"DocumentPropertiesA", (char *)"(JJ[BJJI)I", (void *)OS_NATIVE(DocumentPropertiesA)},
+#endif
+#endif
+#ifndef NO_DocumentPropertiesW
+#ifndef JNI64
+	{(char *)"DocumentPropertiesW", (char *)"(II[CIII)I", (void *)OS_NATIVE(DocumentPropertiesW)},
+#else
+	{(char *)"DocumentPropertiesW", (char *)"(JJ[CJJI)I", (void *)OS_NATIVE(DocumentPropertiesW)},
+#endif
+#endif
+#ifndef NO_DragDetect
+#ifndef JNI64
+	{(char *)"DragDetect", (char *)"(ILorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(DragDetect)},
+#else
+	{(char *)"DragDetect", (char *)"(JLorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(DragDetect)},
+#endif
+#endif
+#ifndef NO_DragFinish
+#ifndef JNI64
+	{(char *)"DragFinish", (char *)"(I)V", (void *)OS_NATIVE(DragFinish)},
+#else
+	{(char *)"DragFinish", (char *)"(J)V", (void *)OS_NATIVE(DragFinish)},
+#endif
+#endif
+#ifndef NO_DragQueryFileA
+#ifndef JNI64
+	{(char *)"DragQueryFileA", (char *)"(II[BI)I", (void *)OS_NATIVE(DragQueryFileA)},
+#else
+	{(char *)"DragQueryFileA", (char *)"(JI[BI)I", (void *)OS_NATIVE(DragQueryFileA)},
+#endif
+#endif
+#ifndef NO_DragQueryFileW
+#ifndef JNI64
+	{(char *)"DragQueryFileW", (char *)"(II[CI)I", (void *)OS_NATIVE(DragQueryFileW)},
+#else
+	{(char *)"DragQueryFileW", (char *)"(JI[CI)I", (void *)OS_NATIVE(DragQueryFileW)},
+#endif
+#endif
+#ifndef NO_DrawAnimatedRects
+#ifndef JNI64
+	{(char *)"DrawAnimatedRects", (char *)"(IILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(DrawAnimatedRects)},
+#else
+	{(char *)"DrawAnimatedRects", (char *)"(JILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(DrawAnimatedRects)},
+#endif
+#endif
+#ifndef NO_DrawEdge
+#ifndef JNI64
+	{(char *)"DrawEdge", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;II)Z", (void *)OS_NATIVE(DrawEdge)},
+#else
+	{(char *)"DrawEdge", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;II)Z", (void *)OS_NATIVE(DrawEdge)},
+#endif
+#endif
+#ifndef NO_DrawFocusRect
+#ifndef JNI64
+	{(char *)"DrawFocusRect", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(DrawFocusRect)},
+#else
+	{(char *)"DrawFocusRect", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(DrawFocusRect)},
+#endif
+#endif
+#ifndef NO_DrawFrameControl
+#ifndef JNI64
+	{(char *)"DrawFrameControl", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;II)Z", (void *)OS_NATIVE(DrawFrameControl)},
+#else
+	{(char *)"DrawFrameControl", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;II)Z", (void *)OS_NATIVE(DrawFrameControl)},
+#endif
+#endif
+#ifndef NO_DrawIconEx
+#ifndef JNI64
+	{(char *)"DrawIconEx", (char *)"(IIIIIIIII)Z", (void *)OS_NATIVE(DrawIconEx)},
+#else
+	{(char *)"DrawIconEx", (char *)"(JIIJIIIJI)Z", (void *)OS_NATIVE(DrawIconEx)},
+#endif
+#endif
+#ifndef NO_DrawMenuBar
+#ifndef JNI64
+	{(char *)"DrawMenuBar", (char *)"(I)Z", (void *)OS_NATIVE(DrawMenuBar)},
+#else
+	{(char *)"DrawMenuBar", (char *)"(J)Z", (void *)OS_NATIVE(DrawMenuBar)},
+#endif
+#endif
+#ifndef NO_DrawStateA
+#ifndef JNI64
+	{(char *)"DrawStateA", (char *)"(IIIIIIIIII)Z", (void *)OS_NATIVE(DrawStateA)},
+#else
+	{(char *)"DrawStateA", (char *)"(JJJJJIIIII)Z", (void *)OS_NATIVE(DrawStateA)},
+#endif
+#endif
+#ifndef NO_DrawStateW
+#ifndef JNI64
+	{(char *)"DrawStateW", (char *)"(IIIIIIIIII)Z", (void *)OS_NATIVE(DrawStateW)},
+#else
+	{(char *)"DrawStateW", (char *)"(JJJJJIIIII)Z", (void *)OS_NATIVE(DrawStateW)},
+#endif
+#endif
+#ifndef NO_DrawTextA
+#ifndef JNI64
+	{(char *)"DrawTextA", (char *)"(I[BILorg/eclipse/swt/internal/win32/RECT;I)I", (void *)OS_NATIVE(DrawTextA)},
+#else
+	{(char *)"DrawTextA", (char *)"(J[BILorg/eclipse/swt/internal/win32/RECT;I)I", (void *)OS_NATIVE(DrawTextA)},
+#endif
+#endif
+#ifndef NO_DrawTextW
+#ifndef JNI64
+	{(char *)"DrawTextW", (char *)"(I[CILorg/eclipse/swt/internal/win32/RECT;I)I", (void *)OS_NATIVE(DrawTextW)},
+#else
+	{(char *)"DrawTextW", (char *)"(J[CILorg/eclipse/swt/internal/win32/RECT;I)I", (void *)OS_NATIVE(DrawTextW)},
+#endif
+#endif
+#ifndef NO_DrawThemeBackground
+#ifndef JNI64
+	{(char *)"DrawThemeBackground", (char *)"(IIIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(DrawThemeBackground)},
+#else
+	{(char *)"DrawThemeBackground", (char *)"(JJIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(DrawThemeBackground)},
+#endif
+#endif
+#ifndef NO_DrawThemeEdge
+#ifndef JNI64
+	{(char *)"DrawThemeEdge", (char *)"(IIIILorg/eclipse/swt/internal/win32/RECT;IILorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(DrawThemeEdge)},
+#else
+	{(char *)"DrawThemeEdge", (char *)"(JJIILorg/eclipse/swt/internal/win32/RECT;IILorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(DrawThemeEdge)},
+#endif
+#endif
+#ifndef NO_DrawThemeIcon
+#ifndef JNI64
+	{(char *)"DrawThemeIcon", (char *)"(IIIILorg/eclipse/swt/internal/win32/RECT;II)I", (void *)OS_NATIVE(DrawThemeIcon)},
+#else
+	{(char *)"DrawThemeIcon", (char *)"(JJIILorg/eclipse/swt/internal/win32/RECT;JI)I", (void *)OS_NATIVE(DrawThemeIcon)},
+#endif
+#endif
+#ifndef NO_DrawThemeParentBackground
+#ifndef JNI64
+	{(char *)"DrawThemeParentBackground", (char *)"(IILorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(DrawThemeParentBackground)},
+#else
+	{(char *)"DrawThemeParentBackground", (char *)"(JJLorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(DrawThemeParentBackground)},
+#endif
+#endif
+#ifndef NO_DrawThemeText
+#ifndef JNI64
+	{(char *)"DrawThemeText", (char *)"(IIII[CIIILorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(DrawThemeText)},
+#else
+	{(char *)"DrawThemeText", (char *)"(JJII[CIIILorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(DrawThemeText)},
+#endif
+#endif
+#ifndef NO_DrawThemeTextEx
+#ifndef JNI64
+	{(char *)"DrawThemeTextEx", (char *)"(IIII[CIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/DTTOPTS;)I", (void *)OS_NATIVE(DrawThemeTextEx)},
+#else
+	{(char *)"DrawThemeTextEx", (char *)"(JJII[CIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/DTTOPTS;)I", (void *)OS_NATIVE(DrawThemeTextEx)},
+#endif
+#endif
+#ifndef NO_DuplicateHandle
+#ifndef JNI64
+	{(char *)"DuplicateHandle", (char *)"(III[IIZI)Z", (void *)OS_NATIVE(DuplicateHandle)},
+#else
+	{(char *)"DuplicateHandle", (char *)"(JJJ[JIZI)Z", (void *)OS_NATIVE(DuplicateHandle)},
+#endif
+#endif
+#ifndef NO_DwmEnableBlurBehindWindow
+#ifndef JNI64
+	{(char *)"DwmEnableBlurBehindWindow", (char *)"(ILorg/eclipse/swt/internal/win32/DWM_BLURBEHIND;)I", (void *)OS_NATIVE(DwmEnableBlurBehindWindow)},
+#else
+	{(char *)"DwmEnableBlurBehindWindow", (char *)"(JLorg/eclipse/swt/internal/win32/DWM_BLURBEHIND;)I", (void *)OS_NATIVE(DwmEnableBlurBehindWindow)},
+#endif
+#endif
+#ifndef NO_DwmExtendFrameIntoClientArea
+#ifndef JNI64
+	{(char *)"DwmExtendFrameIntoClientArea", (char *)"(ILorg/eclipse/swt/internal/win32/MARGINS;)I", (void *)OS_NATIVE(DwmExtendFrameIntoClientArea)},
+#else
+	{(char *)"DwmExtendFrameIntoClientArea", (char *)"(JLorg/eclipse/swt/internal/win32/MARGINS;)I", (void *)OS_NATIVE(DwmExtendFrameIntoClientArea)},
+#endif
+#endif
+#ifndef NO_DwmIsCompositionEnabled
+	{(char *)"DwmIsCompositionEnabled", (char *)"([Z)I", (void *)OS_NATIVE(DwmIsCompositionEnabled)},
+#endif
+#ifndef NO_EMREXTCREATEFONTINDIRECTW_1sizeof
+	{(char *)"EMREXTCREATEFONTINDIRECTW_sizeof", (char *)"()I", (void *)OS_NATIVE(EMREXTCREATEFONTINDIRECTW_1sizeof)},
+#endif
+#ifndef NO_EMR_1sizeof
+	{(char *)"EMR_sizeof", (char *)"()I", (void *)OS_NATIVE(EMR_1sizeof)},
+#endif
+#ifndef NO_EXTLOGFONTW_1sizeof
+	{(char *)"EXTLOGFONTW_sizeof", (char *)"()I", (void *)OS_NATIVE(EXTLOGFONTW_1sizeof)},
+#endif
+#ifndef NO_EXTLOGPEN_1sizeof
+	{(char *)"EXTLOGPEN_sizeof", (char *)"()I", (void *)OS_NATIVE(EXTLOGPEN_1sizeof)},
+#endif
+#ifndef NO_Ellipse
+#ifndef JNI64
+	{(char *)"Ellipse", (char *)"(IIIII)Z", (void *)OS_NATIVE(Ellipse)},
+#else
+	{(char *)"Ellipse", (char *)"(JIIII)Z", (void *)OS_NATIVE(Ellipse)},
+#endif
+#endif
+#ifndef NO_EnableMenuItem
+#ifndef JNI64
+	{(char *)"EnableMenuItem", (char *)"(III)Z", (void *)OS_NATIVE(EnableMenuItem)},
+#else
+	{(char *)"EnableMenuItem", (char *)"(JII)Z", (void *)OS_NATIVE(EnableMenuItem)},
+#endif
+#endif
+#ifndef NO_EnableScrollBar
+#ifndef JNI64
+	{(char *)"EnableScrollBar", (char *)"(III)Z", (void *)OS_NATIVE(EnableScrollBar)},
+#else
+	{(char *)"EnableScrollBar", (char *)"(JII)Z", (void *)OS_NATIVE(EnableScrollBar)},
+#endif
+#endif
+#ifndef NO_EnableWindow
+#ifndef JNI64
+	{(char *)"EnableWindow", (char *)"(IZ)Z", (void *)OS_NATIVE(EnableWindow)},
+#else
+	{(char *)"EnableWindow", (char *)"(JZ)Z", (void *)OS_NATIVE(EnableWindow)},
+#endif
+#endif
+#ifndef NO_EndBufferedPaint
+#ifndef JNI64
+	{(char *)"EndBufferedPaint", (char *)"(IZ)I", (void *)OS_NATIVE(EndBufferedPaint)},
+#else
+	{(char *)"EndBufferedPaint", (char *)"(JZ)I", (void *)OS_NATIVE(EndBufferedPaint)},
+#endif
+#endif
+#ifndef NO_EndDeferWindowPos
+#ifndef JNI64
+	{(char *)"EndDeferWindowPos", (char *)"(I)Z", (void *)OS_NATIVE(EndDeferWindowPos)},
+#else
+	{(char *)"EndDeferWindowPos", (char *)"(J)Z", (void *)OS_NATIVE(EndDeferWindowPos)},
+#endif
+#endif
+#ifndef NO_EndDoc
+#ifndef JNI64
+	{(char *)"EndDoc", (char *)"(I)I", (void *)OS_NATIVE(EndDoc)},
+#else
+	{(char *)"EndDoc", (char *)"(J)I", (void *)OS_NATIVE(EndDoc)},
+#endif
+#endif
+#ifndef NO_EndPage
+#ifndef JNI64
+	{(char *)"EndPage", (char *)"(I)I", (void *)OS_NATIVE(EndPage)},
+#else
+	{(char *)"EndPage", (char *)"(J)I", (void *)OS_NATIVE(EndPage)},
+#endif
+#endif
+#ifndef NO_EndPaint
+#ifndef JNI64
+	{(char *)"EndPaint", (char *)"(ILorg/eclipse/swt/internal/win32/PAINTSTRUCT;)I", (void *)OS_NATIVE(EndPaint)},
+#else
+	{(char *)"EndPaint", (char *)"(JLorg/eclipse/swt/internal/win32/PAINTSTRUCT;)I", (void *)OS_NATIVE(EndPaint)},
+#endif
+#endif
+#ifndef NO_EndPath
+#ifndef JNI64
+	{(char *)"EndPath", (char *)"(I)Z", (void *)OS_NATIVE(EndPath)},
+#else
+	{(char *)"EndPath", (char *)"(J)Z", (void *)OS_NATIVE(EndPath)},
+#endif
+#endif
+#ifndef NO_EnumDisplayMonitors
+#ifndef JNI64
+	{(char *)"EnumDisplayMonitors", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;II)Z", (void *)OS_NATIVE(EnumDisplayMonitors)},
+#else
+	{(char *)"EnumDisplayMonitors", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;JI)Z", (void *)OS_NATIVE(EnumDisplayMonitors)},
+#endif
+#endif
+#ifndef NO_EnumEnhMetaFile
+#ifndef JNI64
+	{(char *)"EnumEnhMetaFile", (char *)"(IIIILorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(EnumEnhMetaFile)},
+#else
+	{(char *)"EnumEnhMetaFile", (char *)"(JJJJLorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(EnumEnhMetaFile)},
+#endif
+#endif
+#ifndef NO_EnumFontFamiliesA
+#ifndef JNI64
+	{(char *)"EnumFontFamiliesA", (char *)"(I[BII)I", (void *)OS_NATIVE(EnumFontFamiliesA)},
+#else
+	{(char *)"EnumFontFamiliesA", (char *)"(J[BJJ)I", (void *)OS_NATIVE(EnumFontFamiliesA)},
+#endif
+#endif
+#ifndef NO_EnumFontFamiliesExA
+#ifndef JNI64
+	{(char *)"EnumFontFamiliesExA", (char *)"(ILorg/eclipse/swt/internal/win32/LOGFONTA;III)I", (void *)OS_NATIVE(EnumFontFamiliesExA)},
+#else
+	{(char *)"EnumFontFamiliesExA", (char *)"(JLorg/eclipse/swt/internal/win32/LOGFONTA;JJI)I", (void *)OS_NATIVE(EnumFontFamiliesExA)},
+#endif
+#endif
+#ifndef NO_EnumFontFamiliesExW
+#ifndef JNI64
+	{(char *)"EnumFontFamiliesExW", (char *)"(ILorg/eclipse/swt/internal/win32/LOGFONTW;III)I", (void *)OS_NATIVE(EnumFontFamiliesExW)},
+#else
+	{(char *)"EnumFontFamiliesExW", (char *)"(JLorg/eclipse/swt/internal/win32/LOGFONTW;JJI)I", (void *)OS_NATIVE(EnumFontFamiliesExW)},
+#endif
+#endif
+#ifndef NO_EnumFontFamiliesW
+#ifndef JNI64
+	{(char *)"EnumFontFamiliesW", (char *)"(I[CII)I", (void *)OS_NATIVE(EnumFontFamiliesW)},
+#else
+	{(char *)"EnumFontFamiliesW", (char *)"(J[CJJ)I", (void *)OS_NATIVE(EnumFontFamiliesW)},
+#endif
+#endif
+#ifndef NO_EnumSystemLanguageGroupsA
+#ifndef JNI64
+	{(char *)"EnumSystemLanguageGroupsA", (char *)"(III)Z", (void *)OS_NATIVE(EnumSystemLanguageGroupsA)},
+#else
+	{(char *)"EnumSystemLanguageGroupsA", (char *)"(JIJ)Z", (void *)OS_NATIVE(EnumSystemLanguageGroupsA)},
+#endif
+#endif
+#ifndef NO_EnumSystemLanguageGroupsW
+#ifndef JNI64
+	{(char *)"EnumSystemLanguageGroupsW", (char *)"(III)Z", (void *)OS_NATIVE(EnumSystemLanguageGroupsW)},
+#else
+	{(char *)"EnumSystemLanguageGroupsW", (char *)"(JIJ)Z", (void *)OS_NATIVE(EnumSystemLanguageGroupsW)},
+#endif
+#endif
+#ifndef NO_EnumSystemLocalesA
+#ifndef JNI64
+	{(char *)"EnumSystemLocalesA", (char *)"(II)Z", (void *)OS_NATIVE(EnumSystemLocalesA)},
+#else
+	{(char *)"EnumSystemLocalesA", (char *)"(JI)Z", (void *)OS_NATIVE(EnumSystemLocalesA)},
+#endif
+#endif
+#ifndef NO_EnumSystemLocalesW
+#ifndef JNI64
+	{(char *)"EnumSystemLocalesW", (char *)"(II)Z", (void *)OS_NATIVE(EnumSystemLocalesW)},
+#else
+	{(char *)"EnumSystemLocalesW", (char *)"(JI)Z", (void *)OS_NATIVE(EnumSystemLocalesW)},
+#endif
+#endif
+#ifndef NO_EqualRect
+	{(char *)"EqualRect", (char *)"(Lorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(EqualRect)},
+#endif
+#ifndef NO_EqualRgn
+#ifndef JNI64
+	{(char *)"EqualRgn", (char *)"(II)Z", (void *)OS_NATIVE(EqualRgn)},
+#else
+	{(char *)"EqualRgn", (char *)"(JJ)Z", (void *)OS_NATIVE(EqualRgn)},
+#endif
+#endif
+#ifndef NO_ExcludeClipRect
+#ifndef JNI64
+	{(char *)"ExcludeClipRect", (char *)"(IIIII)I", (void *)OS_NATIVE(ExcludeClipRect)},
+#else
+	{(char *)"ExcludeClipRect", (char *)"(JIIII)I", (void *)OS_NATIVE(ExcludeClipRect)},
+#endif
+#endif
+#ifndef NO_ExpandEnvironmentStringsA
+	{(char *)"ExpandEnvironmentStringsA", (char *)"([B[BI)I", (void *)OS_NATIVE(ExpandEnvironmentStringsA)},
+#endif
+#ifndef NO_ExpandEnvironmentStringsW
+	{(char *)"ExpandEnvironmentStringsW", (char *)"([C[CI)I", (void *)OS_NATIVE(ExpandEnvironmentStringsW)},
+#endif
+#ifndef NO_ExtCreatePen
+#ifndef JNI64
+	{(char *)"ExtCreatePen", (char *)"(IILorg/eclipse/swt/internal/win32/LOGBRUSH;I[I)I", (void *)OS_NATIVE(ExtCreatePen)},
+#else
+	{(char *)"ExtCreatePen", (char *)"(IILorg/eclipse/swt/internal/win32/LOGBRUSH;I[I)J", (void *)OS_NATIVE(ExtCreatePen)},
+#endif
+#endif
+#ifndef NO_ExtCreateRegion
+#ifndef JNI64
+	{(char *)"ExtCreateRegion", (char *)"([FI[I)I", (void *)OS_NATIVE(ExtCreateRegion)},
+#else
+	{(char *)"ExtCreateRegion", (char *)"([FI[I)J", (void *)OS_NATIVE(ExtCreateRegion)},
+#endif
+#endif
+#ifndef NO_ExtTextOutA
+#ifndef JNI64
+	{(char *)"ExtTextOutA", (char *)"(IIIILorg/eclipse/swt/internal/win32/RECT;[BI[I)Z", (void *)OS_NATIVE(ExtTextOutA)},
+#else
+	{(char *)"ExtTextOutA", (char *)"(JIIILorg/eclipse/swt/internal/win32/RECT;[BI[I)Z", (void *)OS_NATIVE(ExtTextOutA)},
+#endif
+#endif
+#ifndef NO_ExtTextOutW
+#ifndef JNI64
+	{(char *)"ExtTextOutW", (char *)"(IIIILorg/eclipse/swt/internal/win32/RECT;[CI[I)Z", (void *)OS_NATIVE(ExtTextOutW)},
+#else
+	{(char *)"ExtTextOutW", (char *)"(JIIILorg/eclipse/swt/internal/win32/RECT;[CI[I)Z", (void *)OS_NATIVE(ExtTextOutW)},
+#endif
+#endif
+#ifndef NO_ExtractIconExA
+#ifndef JNI64
+	{(char *)"ExtractIconExA", (char *)"([BI[I[II)I", (void *)OS_NATIVE(ExtractIconExA)},
+#else
+	{(char *)"ExtractIconExA", (char *)"([BI[J[JI)I", (void *)OS_NATIVE(ExtractIconExA)},
+#endif
+#endif
+#ifndef NO_ExtractIconExW
+#ifndef JNI64
+	{(char *)"ExtractIconExW", (char *)"([CI[I[II)I", (void *)OS_NATIVE(ExtractIconExW)},
+#else
+	{(char *)"ExtractIconExW", (char *)"([CI[J[JI)I", (void *)OS_NATIVE(ExtractIconExW)},
+#endif
+#endif
+#ifndef NO_FILETIME_1sizeof
+	{(char *)"FILETIME_sizeof", (char *)"()I", (void *)OS_NATIVE(FILETIME_1sizeof)},
+#endif
+#ifndef NO_FLICK_1DATA_1sizeof
+	{(char *)"FLICK_DATA_sizeof", (char *)"()I", (void *)OS_NATIVE(FLICK_1DATA_1sizeof)},
+#endif
+#ifndef NO_FLICK_1POINT_1sizeof
+	{(char *)"FLICK_POINT_sizeof", (char *)"()I", (void *)OS_NATIVE(FLICK_1POINT_1sizeof)},
+#endif
+#ifndef NO_FileTimeToSystemTime
+	{(char *)"FileTimeToSystemTime", (char *)"(Lorg/eclipse/swt/internal/win32/FILETIME;Lorg/eclipse/swt/internal/win32/SYSTEMTIME;)Z", (void *)OS_NATIVE(FileTimeToSystemTime)},
+#endif
+#ifndef NO_FillPath
+#ifndef JNI64
+	{(char *)"FillPath", (char *)"(I)Z", (void *)OS_NATIVE(FillPath)},
+#else
+	{(char *)"FillPath", (char *)"(J)Z", (void *)OS_NATIVE(FillPath)},
+#endif
+#endif
+#ifndef NO_FillRect
+#ifndef JNI64
+	{(char *)"FillRect", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;I)I", (void *)OS_NATIVE(FillRect)},
+#else
+	{(char *)"FillRect", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;J)I", (void *)OS_NATIVE(FillRect)},
+#endif
+#endif
+#ifndef NO_FindWindowA
+#ifndef JNI64
+	{(char *)"FindWindowA", (char *)"([B[B)I", (void *)OS_NATIVE(FindWindowA)},
+#else
+	{(char *)"FindWindowA", (char *)"([B[B)J", (void *)OS_NATIVE(FindWindowA)},
+#endif
+#endif
+#ifndef NO_FindWindowW
+#ifndef JNI64
+	{(char *)"FindWindowW", (char *)"([C[C)I", (void *)OS_NATIVE(FindWindowW)},
+#else
+	{(char *)"FindWindowW", (char *)"([C[C)J", (void *)OS_NATIVE(FindWindowW)},
+#endif
+#endif
+#ifndef NO_FormatMessageA
+#ifndef JNI64
+	{(char *)"FormatMessageA", (char *)"(IIII[III)I", (void *)OS_NATIVE(FormatMessageA)},
+#else
+	{(char *)"FormatMessageA", (char *)"(IJII[JIJ)I", (void *)OS_NATIVE(FormatMessageA)},
+#endif
+#endif
+#ifndef NO_FormatMessageW
+#ifndef JNI64
+	{(char *)"FormatMessageW", (char *)"(IIII[III)I", (void *)OS_NATIVE(FormatMessageW)},
+#else
+	{(char *)"FormatMessageW", (char *)"(IJII[JIJ)I", (void *)OS_NATIVE(FormatMessageW)},
+#endif
+#endif
+#ifndef NO_FreeLibrary
+#ifndef JNI64
+	{(char *)"FreeLibrary", (char *)"(I)Z", (void *)OS_NATIVE(FreeLibrary)},
+#else
+	{(char *)"FreeLibrary", (char *)"(J)Z", (void *)OS_NATIVE(FreeLibrary)},
+#endif
+#endif
+#ifndef NO_GCP_1RESULTS_1sizeof
+	{(char *)"GCP_RESULTS_sizeof", (char *)"()I", (void *)OS_NATIVE(GCP_1RESULTS_1sizeof)},
+#endif
+#ifndef NO_GESTURECONFIG_1sizeof
+	{(char *)"GESTURECONFIG_sizeof", (char *)"()I", (void *)OS_NATIVE(GESTURECONFIG_1sizeof)},
+#endif
+#ifndef NO_GESTUREINFO_1sizeof
+	{(char *)"GESTUREINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(GESTUREINFO_1sizeof)},
+#endif
+#ifndef NO_GET_1WHEEL_1DELTA_1WPARAM
+#ifndef JNI64
+	{(char *)"GET_WHEEL_DELTA_WPARAM", (char *)"(I)I", (void *)OS_NATIVE(GET_1WHEEL_1DELTA_1WPARAM)},
+#else
+	{(char *)"GET_WHEEL_DELTA_WPARAM", (char *)"(J)I", (void *)OS_NATIVE(GET_1WHEEL_1DELTA_1WPARAM)},
+#endif
+#endif
+#ifndef NO_GET_1X_1LPARAM
+#ifndef JNI64
+	{(char *)"GET_X_LPARAM", (char *)"(I)I", (void *)OS_NATIVE(GET_1X_1LPARAM)},
+#else
+	{(char *)"GET_X_LPARAM", (char *)"(J)I", (void *)OS_NATIVE(GET_1X_1LPARAM)},
+#endif
+#endif
+#ifndef NO_GET_1Y_1LPARAM
+#ifndef JNI64
+	{(char *)"GET_Y_LPARAM", (char *)"(I)I", (void *)OS_NATIVE(GET_1Y_1LPARAM)},
+#else
+	{(char *)"GET_Y_LPARAM", (char *)"(J)I", (void *)OS_NATIVE(GET_1Y_1LPARAM)},
+#endif
+#endif
+#ifndef NO_GID_1ROTATE_1ANGLE_1FROM_1ARGUMENT
+	{(char *)"GID_ROTATE_ANGLE_FROM_ARGUMENT", (char *)"(J)D", (void *)OS_NATIVE(GID_1ROTATE_1ANGLE_1FROM_1ARGUMENT)},
+#endif
+#ifndef NO_GRADIENT_1RECT_1sizeof
+	{(char *)"GRADIENT_RECT_sizeof", (char *)"()I", (void *)OS_NATIVE(GRADIENT_1RECT_1sizeof)},
+#endif
+#ifndef NO_GUITHREADINFO_1sizeof
+	{(char *)"GUITHREADINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(GUITHREADINFO_1sizeof)},
+#endif
+#ifndef NO_GdiSetBatchLimit
+	{(char *)"GdiSetBatchLimit", (char *)"(I)I", (void *)OS_NATIVE(GdiSetBatchLimit)},
+#endif
+#ifndef NO_GetACP
+	{(char *)"GetACP", (char *)"()I", (void *)OS_NATIVE(GetACP)},
+#endif
+#ifndef NO_GetActiveWindow
+#ifndef JNI64
+	{(char *)"GetActiveWindow", (char *)"()I", (void *)OS_NATIVE(GetActiveWindow)},
+#else
+	{(char *)"GetActiveWindow", (char *)"()J", (void *)OS_NATIVE(GetActiveWindow)},
+#endif
+#endif
+#ifndef NO_GetAsyncKeyState
+	{(char *)"GetAsyncKeyState", (char *)"(I)S", (void *)OS_NATIVE(GetAsyncKeyState)},
+#endif
+#ifndef NO_GetBkColor
+#ifndef JNI64
+	{(char *)"GetBkColor", (char *)"(I)I", (void *)OS_NATIVE(GetBkColor)},
+#else
+	{(char *)"GetBkColor", (char *)"(J)I", (void *)OS_NATIVE(GetBkColor)},
+#endif
+#endif
+#ifndef NO_GetCapture
+#ifndef JNI64
+	{(char *)"GetCapture", (char *)"()I", (void *)OS_NATIVE(GetCapture)},
+#else
+	{(char *)"GetCapture", (char *)"()J", (void *)OS_NATIVE(GetCapture)},
+#endif
+#endif
+#ifndef NO_GetCaretPos
+	{(char *)"GetCaretPos", (char *)"(Lorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(GetCaretPos)},
+#endif
+#ifndef NO_GetCharABCWidthsA
+#ifndef JNI64
+	{(char *)"GetCharABCWidthsA", (char *)"(III[I)Z", (void *)OS_NATIVE(GetCharABCWidthsA)},
+#else
+	{(char *)"GetCharABCWidthsA", (char *)"(JII[I)Z", (void *)OS_NATIVE(GetCharABCWidthsA)},
+#endif
+#endif
+#ifndef NO_GetCharABCWidthsW
+#ifndef JNI64
+	{(char *)"GetCharABCWidthsW", (char *)"(III[I)Z", (void *)OS_NATIVE(GetCharABCWidthsW)},
+#else
+	{(char *)"GetCharABCWidthsW", (char *)"(JII[I)Z", (void *)OS_NATIVE(GetCharABCWidthsW)},
+#endif
+#endif
+#ifndef NO_GetCharWidthA
+#ifndef JNI64
+	{(char *)"GetCharWidthA", (char *)"(III[I)Z", (void *)OS_NATIVE(GetCharWidthA)},
+#else
+	{(char *)"GetCharWidthA", (char *)"(JII[I)Z", (void *)OS_NATIVE(GetCharWidthA)},
+#endif
+#endif
+#ifndef NO_GetCharWidthW
+#ifndef JNI64
+	{(char *)"GetCharWidthW", (char *)"(III[I)Z", (void *)OS_NATIVE(GetCharWidthW)},
+#else
+	{(char *)"GetCharWidthW", (char *)"(JII[I)Z", (void *)OS_NATIVE(GetCharWidthW)},
+#endif
+#endif
+#ifndef NO_GetCharacterPlacementA
+#ifndef JNI64
+	{(char *)"GetCharacterPlacementA", (char *)"(I[BIILorg/eclipse/swt/internal/win32/GCP_RESULTS;I)I", (void *)OS_NATIVE(GetCharacterPlacementA)},
+#else
+	{(char *)"GetCharacterPlacementA", (char *)"(J[BIILorg/eclipse/swt/internal/win32/GCP_RESULTS;I)I", (void *)OS_NATIVE(GetCharacterPlacementA)},
+#endif
+#endif
+#ifndef NO_GetCharacterPlacementW
+#ifndef JNI64
+	{(char *)"GetCharacterPlacementW", (char *)"(I[CIILorg/eclipse/swt/internal/win32/GCP_RESULTS;I)I", (void *)OS_NATIVE(GetCharacterPlacementW)},
+#else
+	{(char *)"GetCharacterPlacementW", (char *)"(J[CIILorg/eclipse/swt/internal/win32/GCP_RESULTS;I)I", (void *)OS_NATIVE(GetCharacterPlacementW)},
+#endif
+#endif
+#ifndef NO_GetClassInfoA
+#ifndef JNI64
+	{(char *)"GetClassInfoA", (char *)"(I[BLorg/eclipse/swt/internal/win32/WNDCLASS;)Z", (void *)OS_NATIVE(GetClassInfoA)},
+#else
+	{(char *)"GetClassInfoA", (char *)"(J[BLorg/eclipse/swt/internal/win32/WNDCLASS;)Z", (void *)OS_NATIVE(GetClassInfoA)},
+#endif
+#endif
+#ifndef NO_GetClassInfoW
+#ifndef JNI64
+	{(char *)"GetClassInfoW", (char *)"(I[CLorg/eclipse/swt/internal/win32/WNDCLASS;)Z", (void *)OS_NATIVE(GetClassInfoW)},
+#else
+	{(char *)"GetClassInfoW", (char *)"(J[CLorg/eclipse/swt/internal/win32/WNDCLASS;)Z", (void *)OS_NATIVE(GetClassInfoW)},
+#endif
+#endif
+#ifndef NO_GetClassNameA
+#ifndef JNI64
+	{(char *)"GetClassNameA", (char *)"(I[BI)I", (void *)OS_NATIVE(GetClassNameA)},
+#else
+	{(char *)"GetClassNameA", (char *)"(J[BI)I", (void *)OS_NATIVE(GetClassNameA)},
+#endif
+#endif
+#ifndef NO_GetClassNameW
+#ifndef JNI64
+	{(char *)"GetClassNameW", (char *)"(I[CI)I", (void *)OS_NATIVE(GetClassNameW)},
+#else
+	{(char *)"GetClassNameW", (char *)"(J[CI)I", (void *)OS_NATIVE(GetClassNameW)},
+#endif
+#endif
+#ifndef NO_GetClientRect
+#ifndef JNI64
+	{(char *)"GetClientRect", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(GetClientRect)},
+#else
+	{(char *)"GetClientRect", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(GetClientRect)},
+#endif
+#endif
+#ifndef NO_GetClipBox
+#ifndef JNI64
+	{(char *)"GetClipBox", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(GetClipBox)},
+#else
+	{(char *)"GetClipBox", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(GetClipBox)},
+#endif
+#endif
+#ifndef NO_GetClipRgn
+#ifndef JNI64
+	{(char *)"GetClipRgn", (char *)"(II)I", (void *)OS_NATIVE(GetClipRgn)},
+#else
+	{(char *)"GetClipRgn", (char *)"(JJ)I", (void *)OS_NATIVE(GetClipRgn)},
+#endif
+#endif
+#ifndef NO_GetClipboardData
+#ifndef JNI64
+	{(char *)"GetClipboardData", (char *)"(I)I", (void *)OS_NATIVE(GetClipboardData)},
+#else
+	{(char *)"GetClipboardData", (char *)"(I)J", (void *)OS_NATIVE(GetClipboardData)},
+#endif
+#endif
+#ifndef NO_GetClipboardFormatNameA
+	{(char *)"GetClipboardFormatNameA", (char *)"(I[BI)I", (void *)OS_NATIVE(GetClipboardFormatNameA)},
+#endif
+#ifndef NO_GetClipboardFormatNameW
+	{(char *)"GetClipboardFormatNameW", (char *)"(I[CI)I", (void *)OS_NATIVE(GetClipboardFormatNameW)},
+#endif
+#ifndef NO_GetComboBoxInfo
+#ifndef JNI64
+	{(char *)"GetComboBoxInfo", (char *)"(ILorg/eclipse/swt/internal/win32/COMBOBOXINFO;)Z", (void *)OS_NATIVE(GetComboBoxInfo)},
+#else
+	{(char *)"GetComboBoxInfo", (char *)"(JLorg/eclipse/swt/internal/win32/COMBOBOXINFO;)Z", (void *)OS_NATIVE(GetComboBoxInfo)},
+#endif
+#endif
+#ifndef NO_GetCurrentObject
+#ifndef JNI64
+	{(char *)"GetCurrentObject", (char *)"(II)I", (void *)OS_NATIVE(GetCurrentObject)},
+#else
+	{(char *)"GetCurrentObject", (char *)"(JI)J", (void *)OS_NATIVE(GetCurrentObject)},
+#endif
+#endif
+#ifndef NO_GetCurrentProcess
+#ifndef JNI64
+	{(char *)"GetCurrentProcess", (char *)"()I", (void *)OS_NATIVE(GetCurrentProcess)},
+#else
+	{(char *)"GetCurrentProcess", (char *)"()J", (void *)OS_NATIVE(GetCurrentProcess)},
+#endif
+#endif
+#ifndef NO_GetCurrentProcessExplicitAppUserModelID
+#ifndef JNI64
+	{(char *)"GetCurrentProcessExplicitAppUserModelID", (char *)"([I)I", (void *)OS_NATIVE(GetCurrentProcessExplicitAppUserModelID)},
+#else
+	{(char *)"GetCurrentProcessExplicitAppUserModelID", (char *)"([J)I", (void *)OS_NATIVE(GetCurrentProcessExplicitAppUserModelID)},
+#endif
+#endif
+#ifndef NO_GetCurrentProcessId
+	{(char *)"GetCurrentProcessId", (char *)"()I", (void *)OS_NATIVE(GetCurrentProcessId)},
+#endif
+#ifndef NO_GetCurrentThreadId
+	{(char *)"GetCurrentThreadId", (char *)"()I", (void *)OS_NATIVE(GetCurrentThreadId)},
+#endif
+#ifndef NO_GetCursor
+#ifndef JNI64
+	{(char *)"GetCursor", (char *)"()I", (void *)OS_NATIVE(GetCursor)},
+#else
+	{(char *)"GetCursor", (char *)"()J", (void *)OS_NATIVE(GetCursor)},
+#endif
+#endif
+#ifndef NO_GetCursorPos
+	{(char *)"GetCursorPos", (char *)"(Lorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(GetCursorPos)},
+#endif
+#ifndef NO_GetDC
+#ifndef JNI64
+	{(char *)"GetDC", (char *)"(I)I", (void *)OS_NATIVE(GetDC)},
+#else
+	{(char *)"GetDC", (char *)"(J)J", (void *)OS_NATIVE(GetDC)},
+#endif
+#endif
+#ifndef NO_GetDCEx
+#ifndef JNI64
+	{(char *)"GetDCEx", (char *)"(III)I", (void *)OS_NATIVE(GetDCEx)},
+#else
+	{(char *)"GetDCEx", (char *)"(JJI)J", (void *)OS_NATIVE(GetDCEx)},
+#endif
+#endif
+#ifndef NO_GetDIBColorTable
+#ifndef JNI64
+	{(char *)"GetDIBColorTable", (char *)"(III[B)I", (void *)OS_NATIVE(GetDIBColorTable)},
+#else
+	{(char *)"GetDIBColorTable", (char *)"(JII[B)I", (void *)OS_NATIVE(GetDIBColorTable)},
+#endif
+#endif
+#ifndef NO_GetDIBits
+#ifndef JNI64
+	{(char *)"GetDIBits", (char *)"(IIII[B[BI)I", (void *)OS_NATIVE(GetDIBits)},
+#else
+	{(char *)"GetDIBits", (char *)"(JJII[B[BI)I", (void *)OS_NATIVE(GetDIBits)},
+#endif
+#endif
+#ifndef NO_GetDateFormatA
+	{(char *)"GetDateFormatA", (char *)"(IILorg/eclipse/swt/internal/win32/SYSTEMTIME;[B[BI)I", (void *)OS_NATIVE(GetDateFormatA)},
+#endif
+#ifndef NO_GetDateFormatW
+	{(char *)"GetDateFormatW", (char *)"(IILorg/eclipse/swt/internal/win32/SYSTEMTIME;[C[CI)I", (void *)OS_NATIVE(GetDateFormatW)},
+#endif
+#ifndef NO_GetDesktopWindow
+#ifndef JNI64
+	{(char *)"GetDesktopWindow", (char *)"()I", (void *)OS_NATIVE(GetDesktopWindow)},
+#else
+	{(char *)"GetDesktopWindow", (char *)"()J", (void *)OS_NATIVE(GetDesktopWindow)},
+#endif
+#endif
+#ifndef NO_GetDeviceCaps
+#ifndef JNI64
+	{(char *)"GetDeviceCaps", (char *)"(II)I", (void *)OS_NATIVE(GetDeviceCaps)},
+#else
+	{(char *)"GetDeviceCaps", (char *)"(JI)I", (void *)OS_NATIVE(GetDeviceCaps)},
+#endif
+#endif
+#ifndef NO_GetDialogBaseUnits
+	{(char *)"GetDialogBaseUnits", (char *)"()I", (void *)OS_NATIVE(GetDialogBaseUnits)},
+#endif
+#ifndef NO_GetDlgItem
+#ifndef JNI64
+	{(char *)"GetDlgItem", (char *)"(II)I", (void *)OS_NATIVE(GetDlgItem)},
+#else
+	{(char *)"GetDlgItem", (char *)"(JI)J", (void *)OS_NATIVE(GetDlgItem)},
+#endif
+#endif
+#ifndef NO_GetDoubleClickTime
+	{(char *)"GetDoubleClickTime", (char *)"()I", (void *)OS_NATIVE(GetDoubleClickTime)},
+#endif
+#ifndef NO_GetFocus
+#ifndef JNI64
+	{(char *)"GetFocus", (char *)"()I", (void *)OS_NATIVE(GetFocus)},
+#else
+	{(char *)"GetFocus", (char *)"()J", (void *)OS_NATIVE(GetFocus)},
+#endif
+#endif
+#ifndef NO_GetFontLanguageInfo
+#ifndef JNI64
+	{(char *)"GetFontLanguageInfo", (char *)"(I)I", (void *)OS_NATIVE(GetFontLanguageInfo)},
+#else
+	{(char *)"GetFontLanguageInfo", (char *)"(J)I", (void *)OS_NATIVE(GetFontLanguageInfo)},
+#endif
+#endif
+#ifndef NO_GetForegroundWindow
+#ifndef JNI64
+	{(char *)"GetForegroundWindow", (char *)"()I", (void *)OS_NATIVE(GetForegroundWindow)},
+#else
+	{(char *)"GetForegroundWindow", (char *)"()J", (void *)OS_NATIVE(GetForegroundWindow)},
+#endif
+#endif
+#ifndef NO_GetGUIThreadInfo
+	{(char *)"GetGUIThreadInfo", (char *)"(ILorg/eclipse/swt/internal/win32/GUITHREADINFO;)Z", (void *)OS_NATIVE(GetGUIThreadInfo)},
+#endif
+#ifndef NO_GetGestureInfo
+#ifndef JNI64
+	{(char *)"GetGestureInfo", (char *)"(ILorg/eclipse/swt/internal/win32/GESTUREINFO;)Z", (void *)OS_NATIVE(GetGestureInfo)},
+#else
+	{(char *)"GetGestureInfo", (char *)"(JLorg/eclipse/swt/internal/win32/GESTUREINFO;)Z", (void *)OS_NATIVE(GetGestureInfo)},
+#endif
+#endif
+#ifndef NO_GetGlyphIndicesW
+#ifndef JNI64
+	{(char *)"GetGlyphIndicesW", (char *)"(I[CI[SI)I", (void *)OS_NATIVE(GetGlyphIndicesW)},
+#else
+	{(char *)"GetGlyphIndicesW", (char *)"(J[CI[SI)I", (void *)OS_NATIVE(GetGlyphIndicesW)},
+#endif
+#endif
+#ifndef NO_GetGraphicsMode
+#ifndef JNI64
+	{(char *)"GetGraphicsMode", (char *)"(I)I", (void *)OS_NATIVE(GetGraphicsMode)},
+#else
+	{(char *)"GetGraphicsMode", (char *)"(J)I", (void *)OS_NATIVE(GetGraphicsMode)},
+#endif
+#endif
+#ifndef NO_GetIconInfo
+#ifndef JNI64
+	{(char *)"GetIconInfo", (char *)"(ILorg/eclipse/swt/internal/win32/ICONINFO;)Z", (void *)OS_NATIVE(GetIconInfo)},
+#else
+	{(char *)"GetIconInfo", (char *)"(JLorg/eclipse/swt/internal/win32/ICONINFO;)Z", (void *)OS_NATIVE(GetIconInfo)},
+#endif
+#endif
+#ifndef NO_GetKeyNameTextA
+	{(char *)"GetKeyNameTextA", (char *)"(I[BI)I", (void *)OS_NATIVE(GetKeyNameTextA)},
+#endif
+#ifndef NO_GetKeyNameTextW
+	{(char *)"GetKeyNameTextW", (char *)"(I[CI)I", (void *)OS_NATIVE(GetKeyNameTextW)},
+#endif
+#ifndef NO_GetKeyState
+	{(char *)"GetKeyState", (char *)"(I)S", (void *)OS_NATIVE(GetKeyState)},
+#endif
+#ifndef NO_GetKeyboardLayout
+#ifndef JNI64
+	{(char *)"GetKeyboardLayout", (char *)"(I)I", (void *)OS_NATIVE(GetKeyboardLayout)},
+#else
+	{(char *)"GetKeyboardLayout", (char *)"(I)J", (void *)OS_NATIVE(GetKeyboardLayout)},
+#endif
+#endif
+#ifndef NO_GetKeyboardLayoutList
+#ifndef JNI64
+	{(char *)"GetKeyboardLayoutList", (char *)"(I[I)I", (void *)OS_NATIVE(GetKeyboardLayoutList)},
+#else
+	{(char *)"GetKeyboardLayoutList", (char *)"(I[J)I", (void *)OS_NATIVE(GetKeyboardLayoutList)},
+#endif
+#endif
+#ifndef NO_GetKeyboardState
+	{(char *)"GetKeyboardState", (char *)"([B)Z", (void *)OS_NATIVE(GetKeyboardState)},
+#endif
+#ifndef NO_GetLastActivePopup
+#ifndef JNI64
+	{(char *)"GetLastActivePopup", (char *)"(I)I", (void *)OS_NATIVE(GetLastActivePopup)},
+#else
+	{(char *)"GetLastActivePopup", (char *)"(J)J", (void *)OS_NATIVE(GetLastActivePopup)},
+#endif
+#endif
+#ifndef NO_GetLastError
+	{(char *)"GetLastError", (char *)"()I", (void *)OS_NATIVE(GetLastError)},
+#endif
+#ifndef NO_GetLayeredWindowAttributes
+#ifndef JNI64
+	{(char *)"GetLayeredWindowAttributes", (char *)"(I[I[B[I)Z", (void *)OS_NATIVE(GetLayeredWindowAttributes)},
+#else
+	{(char *)"GetLayeredWindowAttributes", (char *)"(J[I[B[I)Z", (void *)OS_NATIVE(GetLayeredWindowAttributes)},
+#endif
+#endif
+#ifndef NO_GetLayout
+#ifndef JNI64
+	{(char *)"GetLayout", (char *)"(I)I", (void *)OS_NATIVE(GetLayout)},
+#else
+	{(char *)"GetLayout", (char *)"(J)I", (void *)OS_NATIVE(GetLayout)},
+#endif
+#endif
+#ifndef NO_GetLocaleInfoA
+	{(char *)"GetLocaleInfoA", (char *)"(II[BI)I", (void *)OS_NATIVE(GetLocaleInfoA)},
+#endif
+#ifndef NO_GetLocaleInfoW
+	{(char *)"GetLocaleInfoW", (char *)"(II[CI)I", (void *)OS_NATIVE(GetLocaleInfoW)},
+#endif
+#ifndef NO_GetMapMode
+#ifndef JNI64
+	{(char *)"GetMapMode", (char *)"(I)I", (void *)OS_NATIVE(GetMapMode)},
+#else
+	{(char *)"GetMapMode", (char *)"(J)I", (void *)OS_NATIVE(GetMapMode)},
+#endif
+#endif
+#ifndef NO_GetMenu
+#ifndef JNI64
+	{(char *)"GetMenu", (char *)"(I)I", (void *)OS_NATIVE(GetMenu)},
+#else
+	{(char *)"GetMenu", (char *)"(J)J", (void *)OS_NATIVE(GetMenu)},
+#endif
+#endif
+#ifndef NO_GetMenuBarInfo
+#ifndef JNI64
+	{(char *)"GetMenuBarInfo", (char *)"(IIILorg/eclipse/swt/internal/win32/MENUBARINFO;)Z", (void *)OS_NATIVE(GetMenuBarInfo)},
+#else
+	{(char *)"GetMenuBarInfo", (char *)"(JIILorg/eclipse/swt/internal/win32/MENUBARINFO;)Z", (void *)OS_NATIVE(GetMenuBarInfo)},
+#endif
+#endif
+#ifndef NO_GetMenuDefaultItem
+#ifndef JNI64
+	{(char *)"GetMenuDefaultItem", (char *)"(III)I", (void *)OS_NATIVE(GetMenuDefaultItem)},
+#else
+	{(char *)"GetMenuDefaultItem", (char *)"(JII)I", (void *)OS_NATIVE(GetMenuDefaultItem)},
+#endif
+#endif
+#ifndef NO_GetMenuInfo
+#ifndef JNI64
+	{(char *)"GetMenuInfo", (char *)"(ILorg/eclipse/swt/internal/win32/MENUINFO;)Z", (void *)OS_NATIVE(GetMenuInfo)},
+#else
+	{(char *)"GetMenuInfo", (char *)"(JLorg/eclipse/swt/internal/win32/MENUINFO;)Z", (void *)OS_NATIVE(GetMenuInfo)},
+#endif
+#endif
+#ifndef NO_GetMenuItemCount
+#ifndef JNI64
+	{(char *)"GetMenuItemCount", (char *)"(I)I", (void *)OS_NATIVE(GetMenuItemCount)},
+#else
+	{(char *)"GetMenuItemCount", (char *)"(J)I", (void *)OS_NATIVE(GetMenuItemCount)},
+#endif
+#endif
+#ifndef NO_GetMenuItemInfoA
+#ifndef JNI64
+	{(char *)"GetMenuItemInfoA", (char *)"(IIZLorg/eclipse/swt/internal/win32/MENUITEMINFO;)Z", (void *)OS_NATIVE(GetMenuItemInfoA)},
+#else
+	{(char *)"GetMenuItemInfoA", (char *)"(JIZLorg/eclipse/swt/internal/win32/MENUITEMINFO;)Z", (void *)OS_NATIVE(GetMenuItemInfoA)},
+#endif
+#endif
+#ifndef NO_GetMenuItemInfoW
+#ifndef JNI64
+	{(char *)"GetMenuItemInfoW", (char *)"(IIZLorg/eclipse/swt/internal/win32/MENUITEMINFO;)Z", (void *)OS_NATIVE(GetMenuItemInfoW)},
+#else
+	{(char *)"GetMenuItemInfoW", (char *)"(JIZLorg/eclipse/swt/internal/win32/MENUITEMINFO;)Z", (void *)OS_NATIVE(GetMenuItemInfoW)},
+#endif
+#endif
+#ifndef NO_GetMenuItemRect
+#ifndef JNI64
+	{(char *)"GetMenuItemRect", (char *)"(IIILorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(GetMenuItemRect)},
+#else
+	{(char *)"GetMenuItemRect", (char *)"(JJILorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(GetMenuItemRect)},
+#endif
+#endif
+#ifndef NO_GetMessageA
+#ifndef JNI64
+	{(char *)"GetMessageA", (char *)"(Lorg/eclipse/swt/internal/win32/MSG;III)Z", (void *)OS_NATIVE(GetMessageA)},
+#else
+	{(char *)"GetMessageA", (char *)"(Lorg/eclipse/swt/internal/win32/MSG;JII)Z", (void *)OS_NATIVE(GetMessageA)},
+#endif
+#endif
+#ifndef NO_GetMessagePos
+	{(char *)"GetMessagePos", (char *)"()I", (void *)OS_NATIVE(GetMessagePos)},
+#endif
+#ifndef NO_GetMessageTime
+	{(char *)"GetMessageTime", (char *)"()I", (void *)OS_NATIVE(GetMessageTime)},
+#endif
+#ifndef NO_GetMessageW
+#ifndef JNI64
+	{(char *)"GetMessageW", (char *)"(Lorg/eclipse/swt/internal/win32/MSG;III)Z", (void *)OS_NATIVE(GetMessageW)},
+#else
+	{(char *)"GetMessageW", (char *)"(Lorg/eclipse/swt/internal/win32/MSG;JII)Z", (void *)OS_NATIVE(GetMessageW)},
+#endif
+#endif
+#ifndef NO_GetMetaRgn
+#ifndef JNI64
+	{(char *)"GetMetaRgn", (char *)"(II)I", (void *)OS_NATIVE(GetMetaRgn)},
+#else
+	{(char *)"GetMetaRgn", (char *)"(JJ)I", (void *)OS_NATIVE(GetMetaRgn)},
+#endif
+#endif
+#ifndef NO_GetModuleFileNameA
+#ifndef JNI64
+	{(char *)"GetModuleFileNameA", (char *)"(I[BI)I", (void *)OS_NATIVE(GetModuleFileNameA)},
+#else
+	{(char *)"GetModuleFileNameA", (char *)"(J[BI)I", (void *)OS_NATIVE(GetModuleFileNameA)},
+#endif
+#endif
+#ifndef NO_GetModuleFileNameW
+#ifndef JNI64
+	{(char *)"GetModuleFileNameW", (char *)"(I[CI)I", (void *)OS_NATIVE(GetModuleFileNameW)},
+#else
+	{(char *)"GetModuleFileNameW", (char *)"(J[CI)I", (void *)OS_NATIVE(GetModuleFileNameW)},
+#endif
+#endif
+#ifndef NO_GetModuleHandleA
+#ifndef JNI64
+	{(char *)"GetModuleHandleA", (char *)"([B)I", (void *)OS_NATIVE(GetModuleHandleA)},
+#else
+	{(char *)"GetModuleHandleA", (char *)"([B)J", (void *)OS_NATIVE(GetModuleHandleA)},
+#endif
+#endif
+#ifndef NO_GetModuleHandleW
+#ifndef JNI64
+	{(char *)"GetModuleHandleW", (char *)"([C)I", (void *)OS_NATIVE(GetModuleHandleW)},
+#else
+	{(char *)"GetModuleHandleW", (char *)"([C)J", (void *)OS_NATIVE(GetModuleHandleW)},
+#endif
+#endif
+#ifndef NO_GetMonitorInfoA
+#ifndef JNI64
+	{(char *)"GetMonitorInfoA", (char *)"(ILorg/eclipse/swt/internal/win32/MONITORINFO;)Z", (void *)OS_NATIVE(GetMonitorInfoA)},
+#else
+	{(char *)"GetMonitorInfoA", (char *)"(JLorg/eclipse/swt/internal/win32/MONITORINFO;)Z", (void *)OS_NATIVE(GetMonitorInfoA)},
+#endif
+#endif
+#ifndef NO_GetMonitorInfoW
+#ifndef JNI64
+	{(char *)"GetMonitorInfoW", (char *)"(ILorg/eclipse/swt/internal/win32/MONITORINFO;)Z", (void *)OS_NATIVE(GetMonitorInfoW)},
+#else
+	{(char *)"GetMonitorInfoW", (char *)"(JLorg/eclipse/swt/internal/win32/MONITORINFO;)Z", (void *)OS_NATIVE(GetMonitorInfoW)},
+#endif
+#endif
+#ifndef NO_GetNearestPaletteIndex
+#ifndef JNI64
+	{(char *)"GetNearestPaletteIndex", (char *)"(II)I", (void *)OS_NATIVE(GetNearestPaletteIndex)},
+#else
+	{(char *)"GetNearestPaletteIndex", (char *)"(JI)I", (void *)OS_NATIVE(GetNearestPaletteIndex)},
+#endif
+#endif
+#if (!defined(NO_GetObjectA__III) && !defined(JNI64)) || (!defined(NO_GetObjectA__JIJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"GetObjectA", (char *)"(III)I", (void *)OS_NATIVE(GetObjectA__III)},
+#else
+	{(char *)"GetObjectA", (char *)"(JIJ)I", (void *)OS_NATIVE(GetObjectA__JIJ)},
+#endif
+#endif
+#if (!defined(NO_GetObjectA__IILorg_eclipse_swt_internal_win32_BITMAP_2) && !defined(JNI64)) || (!defined(NO_GetObjectA__JILorg_eclipse_swt_internal_win32_BITMAP_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"GetObjectA", (char *)"(IILorg/eclipse/swt/internal/win32/BITMAP;)I", (void *)OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_BITMAP_2)},
+#else
+	{(char *)"GetObjectA", (char *)"(JILorg/eclipse/swt/internal/win32/BITMAP;)I", (void *)OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_BITMAP_2)},
+#endif
+#endif
+#if (!defined(NO_GetObjectA__IILorg_eclipse_swt_internal_win32_DIBSECTION_2) && !defined(JNI64)) || (!defined(NO_GetObjectA__JILorg_eclipse_swt_internal_win32_DIBSECTION_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"GetObjectA", (char *)"(IILorg/eclipse/swt/internal/win32/DIBSECTION;)I", (void *)OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_DIBSECTION_2)},
+#else
+	{(char *)"GetObjectA", (char *)"(JILorg/eclipse/swt/internal/win32/DIBSECTION;)I", (void *)OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_DIBSECTION_2)},
+#endif
+#endif
+#if (!defined(NO_GetObjectA__IILorg_eclipse_swt_internal_win32_EXTLOGPEN_2) && !defined(JNI64)) || (!defined(NO_GetObjectA__JILorg_eclipse_swt_internal_win32_EXTLOGPEN_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"GetObjectA", (char *)"(IILorg/eclipse/swt/internal/win32/EXTLOGPEN;)I", (void *)OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_EXTLOGPEN_2)},
+#else
+	{(char *)"GetObjectA", (char *)"(JILorg/eclipse/swt/internal/win32/EXTLOGPEN;)I", (void *)OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_EXTLOGPEN_2)},
+#endif
+#endif
+#if (!defined(NO_GetObjectA__IILorg_eclipse_swt_internal_win32_LOGBRUSH_2) && !defined(JNI64)) || (!defined(NO_GetObjectA__JILorg_eclipse_swt_internal_win32_LOGBRUSH_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"GetObjectA", (char *)"(IILorg/eclipse/swt/internal/win32/LOGBRUSH;)I", (void *)OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_LOGBRUSH_2)},
+#else
+	{(char *)"GetObjectA", (char *)"(JILorg/eclipse/swt/internal/win32/LOGBRUSH;)I", (void *)OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_LOGBRUSH_2)},
+#endif
+#endif
+#if (!defined(NO_GetObjectA__IILorg_eclipse_swt_internal_win32_LOGFONTA_2) && !defined(JNI64)) || (!defined(NO_GetObjectA__JILorg_eclipse_swt_internal_win32_LOGFONTA_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"GetObjectA", (char *)"(IILorg/eclipse/swt/internal/win32/LOGFONTA;)I", (void *)OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_LOGFONTA_2)},
+#else
+	{(char *)"GetObjectA", (char *)"(JILorg/eclipse/swt/internal/win32/LOGFONTA;)I", (void *)OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_LOGFONTA_2)},
+#endif
+#endif
+#if (!defined(NO_GetObjectA__IILorg_eclipse_swt_internal_win32_LOGPEN_2) && !defined(JNI64)) || (!defined(NO_GetObjectA__JILorg_eclipse_swt_internal_win32_LOGPEN_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"GetObjectA", (char *)"(IILorg/eclipse/swt/internal/win32/LOGPEN;)I", (void *)OS_NATIVE(GetObjectA__IILorg_eclipse_swt_internal_win32_LOGPEN_2)},
+#else
+	{(char *)"GetObjectA", (char *)"(JILorg/eclipse/swt/internal/win32/LOGPEN;)I", (void *)OS_NATIVE(GetObjectA__JILorg_eclipse_swt_internal_win32_LOGPEN_2)},
+#endif
+#endif
+#if (!defined(NO_GetObjectW__III) && !defined(JNI64)) || (!defined(NO_GetObjectW__JIJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"GetObjectW", (char *)"(III)I", (void *)OS_NATIVE(GetObjectW__III)},
+#else
+	{(char *)"GetObjectW", (char *)"(JIJ)I", (void *)OS_NATIVE(GetObjectW__JIJ)},
+#endif
+#endif
+#if (!defined(NO_GetObjectW__IILorg_eclipse_swt_internal_win32_BITMAP_2) && !defined(JNI64)) || (!defined(NO_GetObjectW__JILorg_eclipse_swt_internal_win32_BITMAP_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"GetObjectW", (char *)"(IILorg/eclipse/swt/internal/win32/BITMAP;)I", (void *)OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_BITMAP_2)},
+#else
+	{(char *)"GetObjectW", (char *)"(JILorg/eclipse/swt/internal/win32/BITMAP;)I", (void *)OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_BITMAP_2)},
+#endif
+#endif
+#if (!defined(NO_GetObjectW__IILorg_eclipse_swt_internal_win32_DIBSECTION_2) && !defined(JNI64)) || (!defined(NO_GetObjectW__JILorg_eclipse_swt_internal_win32_DIBSECTION_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"GetObjectW", (char *)"(IILorg/eclipse/swt/internal/win32/DIBSECTION;)I", (void *)OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_DIBSECTION_2)},
+#else
+	{(char *)"GetObjectW", (char *)"(JILorg/eclipse/swt/internal/win32/DIBSECTION;)I", (void *)OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_DIBSECTION_2)},
+#endif
+#endif
+#if (!defined(NO_GetObjectW__IILorg_eclipse_swt_internal_win32_EXTLOGPEN_2) && !defined(JNI64)) || (!defined(NO_GetObjectW__JILorg_eclipse_swt_internal_win32_EXTLOGPEN_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"GetObjectW", (char *)"(IILorg/eclipse/swt/internal/win32/EXTLOGPEN;)I", (void *)OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_EXTLOGPEN_2)},
+#else
+	{(char *)"GetObjectW", (char *)"(JILorg/eclipse/swt/internal/win32/EXTLOGPEN;)I", (void *)OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_EXTLOGPEN_2)},
+#endif
+#endif
+#if (!defined(NO_GetObjectW__IILorg_eclipse_swt_internal_win32_LOGBRUSH_2) && !defined(JNI64)) || (!defined(NO_GetObjectW__JILorg_eclipse_swt_internal_win32_LOGBRUSH_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"GetObjectW", (char *)"(IILorg/eclipse/swt/internal/win32/LOGBRUSH;)I", (void *)OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_LOGBRUSH_2)},
+#else
+	{(char *)"GetObjectW", (char *)"(JILorg/eclipse/swt/internal/win32/LOGBRUSH;)I", (void *)OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_LOGBRUSH_2)},
+#endif
+#endif
+#if (!defined(NO_GetObjectW__IILorg_eclipse_swt_internal_win32_LOGFONTW_2) && !defined(JNI64)) || (!defined(NO_GetObjectW__JILorg_eclipse_swt_internal_win32_LOGFONTW_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"GetObjectW", (char *)"(IILorg/eclipse/swt/internal/win32/LOGFONTW;)I", (void *)OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_LOGFONTW_2)},
+#else
+	{(char *)"GetObjectW", (char *)"(JILorg/eclipse/swt/internal/win32/LOGFONTW;)I", (void *)OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_LOGFONTW_2)},
+#endif
+#endif
+#if (!defined(NO_GetObjectW__IILorg_eclipse_swt_internal_win32_LOGPEN_2) && !defined(JNI64)) || (!defined(NO_GetObjectW__JILorg_eclipse_swt_internal_win32_LOGPEN_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"GetObjectW", (char *)"(IILorg/eclipse/swt/internal/win32/LOGPEN;)I", (void *)OS_NATIVE(GetObjectW__IILorg_eclipse_swt_internal_win32_LOGPEN_2)},
+#else
+	{(char *)"GetObjectW", (char *)"(JILorg/eclipse/swt/internal/win32/LOGPEN;)I", (void *)OS_NATIVE(GetObjectW__JILorg_eclipse_swt_internal_win32_LOGPEN_2)},
+#endif
+#endif
+#ifndef NO_GetOpenFileNameA
+	{(char *)"GetOpenFileNameA", (char *)"(Lorg/eclipse/swt/internal/win32/OPENFILENAME;)Z", (void *)OS_NATIVE(GetOpenFileNameA)},
+#endif
+#ifndef NO_GetOpenFileNameW
+	{(char *)"GetOpenFileNameW", (char *)"(Lorg/eclipse/swt/internal/win32/OPENFILENAME;)Z", (void *)OS_NATIVE(GetOpenFileNameW)},
+#endif
+#ifndef NO_GetOutlineTextMetricsA
+#ifndef JNI64
+	{(char *)"GetOutlineTextMetricsA", (char *)"(IILorg/eclipse/swt/internal/win32/OUTLINETEXTMETRICA;)I", (void *)OS_NATIVE(GetOutlineTextMetricsA)},
+#else
+	{(char *)"GetOutlineTextMetricsA", (char *)"(JILorg/eclipse/swt/internal/win32/OUTLINETEXTMETRICA;)I", (void *)OS_NATIVE(GetOutlineTextMetricsA)},
+#endif
+#endif
+#ifndef NO_GetOutlineTextMetricsW
+#ifndef JNI64
+	{(char *)"GetOutlineTextMetricsW", (char *)"(IILorg/eclipse/swt/internal/win32/OUTLINETEXTMETRICW;)I", (void *)OS_NATIVE(GetOutlineTextMetricsW)},
+#else
+	{(char *)"GetOutlineTextMetricsW", (char *)"(JILorg/eclipse/swt/internal/win32/OUTLINETEXTMETRICW;)I", (void *)OS_NATIVE(GetOutlineTextMetricsW)},
+#endif
+#endif
+#ifndef NO_GetPaletteEntries
+#ifndef JNI64
+	{(char *)"GetPaletteEntries", (char *)"(III[B)I", (void *)OS_NATIVE(GetPaletteEntries)},
+#else
+	{(char *)"GetPaletteEntries", (char *)"(JII[B)I", (void *)OS_NATIVE(GetPaletteEntries)},
+#endif
+#endif
+#ifndef NO_GetParent
+#ifndef JNI64
+	{(char *)"GetParent", (char *)"(I)I", (void *)OS_NATIVE(GetParent)},
+#else
+	{(char *)"GetParent", (char *)"(J)J", (void *)OS_NATIVE(GetParent)},
+#endif
+#endif
+#ifndef NO_GetPath
+#ifndef JNI64
+	{(char *)"GetPath", (char *)"(I[I[BI)I", (void *)OS_NATIVE(GetPath)},
+#else
+	{(char *)"GetPath", (char *)"(J[I[BI)I", (void *)OS_NATIVE(GetPath)},
+#endif
+#endif
+#ifndef NO_GetPixel
+#ifndef JNI64
+	{(char *)"GetPixel", (char *)"(III)I", (void *)OS_NATIVE(GetPixel)},
+#else
+	{(char *)"GetPixel", (char *)"(JII)I", (void *)OS_NATIVE(GetPixel)},
+#endif
+#endif
+#ifndef NO_GetPolyFillMode
+#ifndef JNI64
+	{(char *)"GetPolyFillMode", (char *)"(I)I", (void *)OS_NATIVE(GetPolyFillMode)},
+#else
+	{(char *)"GetPolyFillMode", (char *)"(J)I", (void *)OS_NATIVE(GetPolyFillMode)},
+#endif
+#endif
+#ifndef NO_GetProcAddress
+#ifndef JNI64
+	{(char *)"GetProcAddress", (char *)"(I[B)I", (void *)OS_NATIVE(GetProcAddress)},
+#else
+	{(char *)"GetProcAddress", (char *)"(J[B)J", (void *)OS_NATIVE(GetProcAddress)},
+#endif
+#endif
+#ifndef NO_GetProcessHeap
+#ifndef JNI64
+	{(char *)"GetProcessHeap", (char *)"()I", (void *)OS_NATIVE(GetProcessHeap)},
+#else
+	{(char *)"GetProcessHeap", (char *)"()J", (void *)OS_NATIVE(GetProcessHeap)},
+#endif
+#endif
+#ifndef NO_GetProcessHeaps
+#ifndef JNI64
+	{(char *)"GetProcessHeaps", (char *)"(I[I)I", (void *)OS_NATIVE(GetProcessHeaps)},
+#else
+	{(char *)"GetProcessHeaps", (char *)"(I[J)I", (void *)OS_NATIVE(GetProcessHeaps)},
+#endif
+#endif
+#ifndef NO_GetProfileStringA
+	{(char *)"GetProfileStringA", (char *)"([B[B[B[BI)I", (void *)OS_NATIVE(GetProfileStringA)},
+#endif
+#ifndef NO_GetProfileStringW
+	{(char *)"GetProfileStringW", (char *)"([C[C[C[CI)I", (void *)OS_NATIVE(GetProfileStringW)},
+#endif
+#ifndef NO_GetPropA
+#ifndef JNI64
+	{(char *)"GetPropA", (char *)"(II)I", (void *)OS_NATIVE(GetPropA)},
+#else
+	{(char *)"GetPropA", (char *)"(JJ)J", (void *)OS_NATIVE(GetPropA)},
+#endif
+#endif
+#ifndef NO_GetPropW
+#ifndef JNI64
+	{(char *)"GetPropW", (char *)"(II)I", (void *)OS_NATIVE(GetPropW)},
+#else
+	{(char *)"GetPropW", (char *)"(JJ)J", (void *)OS_NATIVE(GetPropW)},
+#endif
+#endif
+#ifndef NO_GetROP2
+#ifndef JNI64
+	{(char *)"GetROP2", (char *)"(I)I", (void *)OS_NATIVE(GetROP2)},
+#else
+	{(char *)"GetROP2", (char *)"(J)I", (void *)OS_NATIVE(GetROP2)},
+#endif
+#endif
+#ifndef NO_GetRandomRgn
+#ifndef JNI64
+	{(char *)"GetRandomRgn", (char *)"(III)I", (void *)OS_NATIVE(GetRandomRgn)},
+#else
+	{(char *)"GetRandomRgn", (char *)"(JJI)I", (void *)OS_NATIVE(GetRandomRgn)},
+#endif
+#endif
+#ifndef NO_GetRegionData
+#ifndef JNI64
+	{(char *)"GetRegionData", (char *)"(II[I)I", (void *)OS_NATIVE(GetRegionData)},
+#else
+	{(char *)"GetRegionData", (char *)"(JI[I)I", (void *)OS_NATIVE(GetRegionData)},
+#endif
+#endif
+#ifndef NO_GetRgnBox
+#ifndef JNI64
+	{(char *)"GetRgnBox", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(GetRgnBox)},
+#else
+	{(char *)"GetRgnBox", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(GetRgnBox)},
+#endif
+#endif
+#ifndef NO_GetSaveFileNameA
+	{(char *)"GetSaveFileNameA", (char *)"(Lorg/eclipse/swt/internal/win32/OPENFILENAME;)Z", (void *)OS_NATIVE(GetSaveFileNameA)},
+#endif
+#ifndef NO_GetSaveFileNameW
+	{(char *)"GetSaveFileNameW", (char *)"(Lorg/eclipse/swt/internal/win32/OPENFILENAME;)Z", (void *)OS_NATIVE(GetSaveFileNameW)},
+#endif
+#ifndef NO_GetScrollBarInfo
+#ifndef JNI64
+	{(char *)"GetScrollBarInfo", (char *)"(IILorg/eclipse/swt/internal/win32/SCROLLBARINFO;)Z", (void *)OS_NATIVE(GetScrollBarInfo)},
+#else
+	{(char *)"GetScrollBarInfo", (char *)"(JILorg/eclipse/swt/internal/win32/SCROLLBARINFO;)Z", (void *)OS_NATIVE(GetScrollBarInfo)},
+#endif
+#endif
+#ifndef NO_GetScrollInfo
+#ifndef JNI64
+	{(char *)"GetScrollInfo", (char *)"(IILorg/eclipse/swt/internal/win32/SCROLLINFO;)Z", (void *)OS_NATIVE(GetScrollInfo)},
+#else
+	{(char *)"GetScrollInfo", (char *)"(JILorg/eclipse/swt/internal/win32/SCROLLINFO;)Z", (void *)OS_NATIVE(GetScrollInfo)},
+#endif
+#endif
+#ifndef NO_GetStartupInfoA
+	{(char *)"GetStartupInfoA", (char *)"(Lorg/eclipse/swt/internal/win32/STARTUPINFO;)V", (void *)OS_NATIVE(GetStartupInfoA)},
+#endif
+#ifndef NO_GetStartupInfoW
+	{(char *)"GetStartupInfoW", (char *)"(Lorg/eclipse/swt/internal/win32/STARTUPINFO;)V", (void *)OS_NATIVE(GetStartupInfoW)},
+#endif
+#ifndef NO_GetStockObject
+#ifndef JNI64
+	{(char *)"GetStockObject", (char *)"(I)I", (void *)OS_NATIVE(GetStockObject)},
+#else
+	{(char *)"GetStockObject", (char *)"(I)J", (void *)OS_NATIVE(GetStockObject)},
+#endif
+#endif
+#ifndef NO_GetSysColor
+	{(char *)"GetSysColor", (char *)"(I)I", (void *)OS_NATIVE(GetSysColor)},
+#endif
+#ifndef NO_GetSysColorBrush
+#ifndef JNI64
+	{(char *)"GetSysColorBrush", (char *)"(I)I", (void *)OS_NATIVE(GetSysColorBrush)},
+#else
+	{(char *)"GetSysColorBrush", (char *)"(I)J", (void *)OS_NATIVE(GetSysColorBrush)},
+#endif
+#endif
+#ifndef NO_GetSystemDefaultUILanguage
+	{(char *)"GetSystemDefaultUILanguage", (char *)"()S", (void *)OS_NATIVE(GetSystemDefaultUILanguage)},
+#endif
+#ifndef NO_GetSystemMenu
+#ifndef JNI64
+	{(char *)"GetSystemMenu", (char *)"(IZ)I", (void *)OS_NATIVE(GetSystemMenu)},
+#else
+	{(char *)"GetSystemMenu", (char *)"(JZ)J", (void *)OS_NATIVE(GetSystemMenu)},
+#endif
+#endif
+#ifndef NO_GetSystemMetrics
+	{(char *)"GetSystemMetrics", (char *)"(I)I", (void *)OS_NATIVE(GetSystemMetrics)},
+#endif
+#ifndef NO_GetSystemPaletteEntries
+#ifndef JNI64
+	{(char *)"GetSystemPaletteEntries", (char *)"(III[B)I", (void *)OS_NATIVE(GetSystemPaletteEntries)},
+#else
+	{(char *)"GetSystemPaletteEntries", (char *)"(JII[B)I", (void *)OS_NATIVE(GetSystemPaletteEntries)},
+#endif
+#endif
+#ifndef NO_GetTextCharset
+#ifndef JNI64
+	{(char *)"GetTextCharset", (char *)"(I)I", (void *)OS_NATIVE(GetTextCharset)},
+#else
+	{(char *)"GetTextCharset", (char *)"(J)I", (void *)OS_NATIVE(GetTextCharset)},
+#endif
+#endif
+#ifndef NO_GetTextColor
+#ifndef JNI64
+	{(char *)"GetTextColor", (char *)"(I)I", (void *)OS_NATIVE(GetTextColor)},
+#else
+	{(char *)"GetTextColor", (char *)"(J)I", (void *)OS_NATIVE(GetTextColor)},
+#endif
+#endif
+#ifndef NO_GetTextExtentPoint32A
+#ifndef JNI64
+	{(char *)"GetTextExtentPoint32A", (char *)"(I[BILorg/eclipse/swt/internal/win32/SIZE;)Z", (void *)OS_NATIVE(GetTextExtentPoint32A)},
+#else
+	{(char *)"GetTextExtentPoint32A", (char *)"(J[BILorg/eclipse/swt/internal/win32/SIZE;)Z", (void *)OS_NATIVE(GetTextExtentPoint32A)},
+#endif
+#endif
+#ifndef NO_GetTextExtentPoint32W
+#ifndef JNI64
+	{(char *)"GetTextExtentPoint32W", (char *)"(I[CILorg/eclipse/swt/internal/win32/SIZE;)Z", (void *)OS_NATIVE(GetTextExtentPoint32W)},
+#else
+	{(char *)"GetTextExtentPoint32W", (char *)"(J[CILorg/eclipse/swt/internal/win32/SIZE;)Z", (void *)OS_NATIVE(GetTextExtentPoint32W)},
+#endif
+#endif
+#ifndef NO_GetTextMetricsA
+#ifndef JNI64
+	{(char *)"GetTextMetricsA", (char *)"(ILorg/eclipse/swt/internal/win32/TEXTMETRICA;)Z", (void *)OS_NATIVE(GetTextMetricsA)},
+#else
+	{(char *)"GetTextMetricsA", (char *)"(JLorg/eclipse/swt/internal/win32/TEXTMETRICA;)Z", (void *)OS_NATIVE(GetTextMetricsA)},
+#endif
+#endif
+#ifndef NO_GetTextMetricsW
+#ifndef JNI64
+	{(char *)"GetTextMetricsW", (char *)"(ILorg/eclipse/swt/internal/win32/TEXTMETRICW;)Z", (void *)OS_NATIVE(GetTextMetricsW)},
+#else
+	{(char *)"GetTextMetricsW", (char *)"(JLorg/eclipse/swt/internal/win32/TEXTMETRICW;)Z", (void *)OS_NATIVE(GetTextMetricsW)},
+#endif
+#endif
+#ifndef NO_GetThemeBackgroundContentRect
+#ifndef JNI64
+	{(char *)"GetThemeBackgroundContentRect", (char *)"(IIIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(GetThemeBackgroundContentRect)},
+#else
+	{(char *)"GetThemeBackgroundContentRect", (char *)"(JJIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(GetThemeBackgroundContentRect)},
+#endif
+#endif
+#ifndef NO_GetThemeBackgroundExtent
+#ifndef JNI64
+	{(char *)"GetThemeBackgroundExtent", (char *)"(IIIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(GetThemeBackgroundExtent)},
+#else
+	{(char *)"GetThemeBackgroundExtent", (char *)"(JJIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(GetThemeBackgroundExtent)},
+#endif
+#endif
+#ifndef NO_GetThemeBitmap
+#ifndef JNI64
+	{(char *)"GetThemeBitmap", (char *)"(IIIII[I)I", (void *)OS_NATIVE(GetThemeBitmap)},
+#else
+	{(char *)"GetThemeBitmap", (char *)"(JIIII[J)I", (void *)OS_NATIVE(GetThemeBitmap)},
+#endif
+#endif
+#ifndef NO_GetThemeColor
+#ifndef JNI64
+	{(char *)"GetThemeColor", (char *)"(IIII[I)I", (void *)OS_NATIVE(GetThemeColor)},
+#else
+	{(char *)"GetThemeColor", (char *)"(JIII[I)I", (void *)OS_NATIVE(GetThemeColor)},
+#endif
+#endif
+#ifndef NO_GetThemeInt
+#ifndef JNI64
+	{(char *)"GetThemeInt", (char *)"(IIII[I)I", (void *)OS_NATIVE(GetThemeInt)},
+#else
+	{(char *)"GetThemeInt", (char *)"(JIII[I)I", (void *)OS_NATIVE(GetThemeInt)},
+#endif
+#endif
+#ifndef NO_GetThemeMargins
+#ifndef JNI64
+	{(char *)"GetThemeMargins", (char *)"(IIIIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/MARGINS;)I", (void *)OS_NATIVE(GetThemeMargins)},
+#else
+	{(char *)"GetThemeMargins", (char *)"(JJIIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/MARGINS;)I", (void *)OS_NATIVE(GetThemeMargins)},
+#endif
+#endif
+#ifndef NO_GetThemeMetric
+#ifndef JNI64
+	{(char *)"GetThemeMetric", (char *)"(IIIII[I)I", (void *)OS_NATIVE(GetThemeMetric)},
+#else
+	{(char *)"GetThemeMetric", (char *)"(JJIII[I)I", (void *)OS_NATIVE(GetThemeMetric)},
+#endif
+#endif
+#ifndef NO_GetThemePartSize
+#ifndef JNI64
+	{(char *)"GetThemePartSize", (char *)"(IIIILorg/eclipse/swt/internal/win32/RECT;ILorg/eclipse/swt/internal/win32/SIZE;)I", (void *)OS_NATIVE(GetThemePartSize)},
+#else
+	{(char *)"GetThemePartSize", (char *)"(JJIILorg/eclipse/swt/internal/win32/RECT;ILorg/eclipse/swt/internal/win32/SIZE;)I", (void *)OS_NATIVE(GetThemePartSize)},
+#endif
+#endif
+#ifndef NO_GetThemeRect
+#ifndef JNI64
+	{(char *)"GetThemeRect", (char *)"(IIIILorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(GetThemeRect)},
+#else
+	{(char *)"GetThemeRect", (char *)"(JIIILorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(GetThemeRect)},
+#endif
+#endif
+#ifndef NO_GetThemeSysSize
+#ifndef JNI64
+	{(char *)"GetThemeSysSize", (char *)"(II)I", (void *)OS_NATIVE(GetThemeSysSize)},
+#else
+	{(char *)"GetThemeSysSize", (char *)"(JI)I", (void *)OS_NATIVE(GetThemeSysSize)},
+#endif
+#endif
+#ifndef NO_GetThemeTextExtent
+#ifndef JNI64
+	{(char *)"GetThemeTextExtent", (char *)"(IIII[CIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(GetThemeTextExtent)},
+#else
+	{(char *)"GetThemeTextExtent", (char *)"(JJII[CIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(GetThemeTextExtent)},
+#endif
+#endif
+#ifndef NO_GetTickCount
+	{(char *)"GetTickCount", (char *)"()I", (void *)OS_NATIVE(GetTickCount)},
+#endif
+#ifndef NO_GetTimeFormatA
+	{(char *)"GetTimeFormatA", (char *)"(IILorg/eclipse/swt/internal/win32/SYSTEMTIME;[B[BI)I", (void *)OS_NATIVE(GetTimeFormatA)},
+#endif
+#ifndef NO_GetTimeFormatW
+	{(char *)"GetTimeFormatW", (char *)"(IILorg/eclipse/swt/internal/win32/SYSTEMTIME;[C[CI)I", (void *)OS_NATIVE(GetTimeFormatW)},
+#endif
+#ifndef NO_GetTouchInputInfo
+#ifndef JNI64
+	{(char *)"GetTouchInputInfo", (char *)"(IIII)Z", (void *)OS_NATIVE(GetTouchInputInfo)},
+#else
+	{(char *)"GetTouchInputInfo", (char *)"(JIJI)Z", (void *)OS_NATIVE(GetTouchInputInfo)},
+#endif
+#endif
+#ifndef NO_GetUpdateRect
+#ifndef JNI64
+	{(char *)"GetUpdateRect", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;Z)Z", (void *)OS_NATIVE(GetUpdateRect)},
+#else
+	{(char *)"GetUpdateRect", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;Z)Z", (void *)OS_NATIVE(GetUpdateRect)},
+#endif
+#endif
+#ifndef NO_GetUpdateRgn
+#ifndef JNI64
+	{(char *)"GetUpdateRgn", (char *)"(IIZ)I", (void *)OS_NATIVE(GetUpdateRgn)},
+#else
+	{(char *)"GetUpdateRgn", (char *)"(JJZ)I", (void *)OS_NATIVE(GetUpdateRgn)},
+#endif
+#endif
+#ifndef NO_GetVersionExA__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOA_2
+	{(char *)"GetVersionExA", (char *)"(Lorg/eclipse/swt/internal/win32/OSVERSIONINFOA;)Z", (void *)OS_NATIVE(GetVersionExA__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOA_2)},
+#endif
+#ifndef NO_GetVersionExA__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOEXA_2
+	{(char *)"GetVersionExA", (char *)"(Lorg/eclipse/swt/internal/win32/OSVERSIONINFOEXA;)Z", (void *)OS_NATIVE(GetVersionExA__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOEXA_2)},
+#endif
+#ifndef NO_GetVersionExW__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOEXW_2
+	{(char *)"GetVersionExW", (char *)"(Lorg/eclipse/swt/internal/win32/OSVERSIONINFOEXW;)Z", (void *)OS_NATIVE(GetVersionExW__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOEXW_2)},
+#endif
+#ifndef NO_GetVersionExW__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOW_2
+	{(char *)"GetVersionExW", (char *)"(Lorg/eclipse/swt/internal/win32/OSVERSIONINFOW;)Z", (void *)OS_NATIVE(GetVersionExW__Lorg_eclipse_swt_internal_win32_OSVERSIONINFOW_2)},
+#endif
+#ifndef NO_GetWindow
+#ifndef JNI64
+	{(char *)"GetWindow", (char *)"(II)I", (void *)OS_NATIVE(GetWindow)},
+#else
+	{(char *)"GetWindow", (char *)"(JI)J", (void *)OS_NATIVE(GetWindow)},
+#endif
+#endif
+#ifndef NO_GetWindowDC
+#ifndef JNI64
+	{(char *)"GetWindowDC", (char *)"(I)I", (void *)OS_NATIVE(GetWindowDC)},
+#else
+	{(char *)"GetWindowDC", (char *)"(J)J", (void *)OS_NATIVE(GetWindowDC)},
+#endif
+#endif
+#ifndef NO_GetWindowLongA
+#ifndef JNI64
+	{(char *)"GetWindowLongA", (char *)"(II)I", (void *)OS_NATIVE(GetWindowLongA)},
+#else
+	{(char *)"GetWindowLongA", (char *)"(JI)I", (void *)OS_NATIVE(GetWindowLongA)},
+#endif
+#endif
+#ifndef NO_GetWindowLongPtrA
+#ifndef JNI64
+	{(char *)"GetWindowLongPtrA", (char *)"(II)I", (void *)OS_NATIVE(GetWindowLongPtrA)},
+#else
+	{(char *)"GetWindowLongPtrA", (char *)"(JI)J", (void *)OS_NATIVE(GetWindowLongPtrA)},
+#endif
+#endif
+#ifndef NO_GetWindowLongPtrW
+#ifndef JNI64
+	{(char *)"GetWindowLongPtrW", (char *)"(II)I", (void *)OS_NATIVE(GetWindowLongPtrW)},
+#else
+	{(char *)"GetWindowLongPtrW", (char *)"(JI)J", (void *)OS_NATIVE(GetWindowLongPtrW)},
+#endif
+#endif
+#ifndef NO_GetWindowLongW
+#ifndef JNI64
+	{(char *)"GetWindowLongW", (char *)"(II)I", (void *)OS_NATIVE(GetWindowLongW)},
+#else
+	{(char *)"GetWindowLongW", (char *)"(JI)I", (void *)OS_NATIVE(GetWindowLongW)},
+#endif
+#endif
+#ifndef NO_GetWindowOrgEx
+#ifndef JNI64
+	{(char *)"GetWindowOrgEx", (char *)"(ILorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(GetWindowOrgEx)},
+#else
+	{(char *)"GetWindowOrgEx", (char *)"(JLorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(GetWindowOrgEx)},
+#endif
+#endif
+#ifndef NO_GetWindowPlacement
+#ifndef JNI64
+	{(char *)"GetWindowPlacement", (char *)"(ILorg/eclipse/swt/internal/win32/WINDOWPLACEMENT;)Z", (void *)OS_NATIVE(GetWindowPlacement)},
+#else
+	{(char *)"GetWindowPlacement", (char *)"(JLorg/eclipse/swt/internal/win32/WINDOWPLACEMENT;)Z", (void *)OS_NATIVE(GetWindowPlacement)},
+#endif
+#endif
+#ifndef NO_GetWindowRect
+#ifndef JNI64
+	{(char *)"GetWindowRect", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(GetWindowRect)},
+#else
+	{(char *)"GetWindowRect", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(GetWindowRect)},
+#endif
+#endif
+#ifndef NO_GetWindowRgn
+#ifndef JNI64
+	{(char *)"GetWindowRgn", (char *)"(II)I", (void *)OS_NATIVE(GetWindowRgn)},
+#else
+	{(char *)"GetWindowRgn", (char *)"(JJ)I", (void *)OS_NATIVE(GetWindowRgn)},
+#endif
+#endif
+#ifndef NO_GetWindowTextA
+#ifndef JNI64
+	{(char *)"GetWindowTextA", (char *)"(I[BI)I", (void *)OS_NATIVE(GetWindowTextA)},
+#else
+	{(char *)"GetWindowTextA", (char *)"(J[BI)I", (void *)OS_NATIVE(GetWindowTextA)},
+#endif
+#endif
+#ifndef NO_GetWindowTextLengthA
+#ifndef JNI64
+	{(char *)"GetWindowTextLengthA", (char *)"(I)I", (void *)OS_NATIVE(GetWindowTextLengthA)},
+#else
+	{(char *)"GetWindowTextLengthA", (char *)"(J)I", (void *)OS_NATIVE(GetWindowTextLengthA)},
+#endif
+#endif
+#ifndef NO_GetWindowTextLengthW
+#ifndef JNI64
+	{(char *)"GetWindowTextLengthW", (char *)"(I)I", (void *)OS_NATIVE(GetWindowTextLengthW)},
+#else
+	{(char *)"GetWindowTextLengthW", (char *)"(J)I", (void *)OS_NATIVE(GetWindowTextLengthW)},
+#endif
+#endif
+#ifndef NO_GetWindowTextW
+#ifndef JNI64
+	{(char *)"GetWindowTextW", (char *)"(I[CI)I", (void *)OS_NATIVE(GetWindowTextW)},
+#else
+	{(char *)"GetWindowTextW", (char *)"(J[CI)I", (void *)OS_NATIVE(GetWindowTextW)},
+#endif
+#endif
+#ifndef NO_GetWindowTheme
+#ifndef JNI64
+	{(char *)"GetWindowTheme", (char *)"(I)I", (void *)OS_NATIVE(GetWindowTheme)},
+#else
+	{(char *)"GetWindowTheme", (char *)"(J)J", (void *)OS_NATIVE(GetWindowTheme)},
+#endif
+#endif
+#ifndef NO_GetWindowThreadProcessId
+#ifndef JNI64
+	{(char *)"GetWindowThreadProcessId", (char *)"(I[I)I", (void *)OS_NATIVE(GetWindowThreadProcessId)},
+#else
+	{(char *)"GetWindowThreadProcessId", (char *)"(J[I)I", (void *)OS_NATIVE(GetWindowThreadProcessId)},
+#endif
+#endif
+#ifndef NO_GetWorldTransform
+#ifndef JNI64
+	{(char *)"GetWorldTransform", (char *)"(I[F)Z", (void *)OS_NATIVE(GetWorldTransform)},
+#else
+	{(char *)"GetWorldTransform", (char *)"(J[F)Z", (void *)OS_NATIVE(GetWorldTransform)},
+#endif
+#endif
+#ifndef NO_GlobalAddAtomA
+	{(char *)"GlobalAddAtomA", (char *)"([B)I", (void *)OS_NATIVE(GlobalAddAtomA)},
+#endif
+#ifndef NO_GlobalAddAtomW
+	{(char *)"GlobalAddAtomW", (char *)"([C)I", (void *)OS_NATIVE(GlobalAddAtomW)},
+#endif
+#ifndef NO_GlobalAlloc
+#ifndef JNI64
+	{(char *)"GlobalAlloc", (char *)"(II)I", (void *)OS_NATIVE(GlobalAlloc)},
+#else
+	{(char *)"GlobalAlloc", (char *)"(II)J", (void *)OS_NATIVE(GlobalAlloc)},
+#endif
+#endif
+#ifndef NO_GlobalFree
+#ifndef JNI64
+	{(char *)"GlobalFree", (char *)"(I)I", (void *)OS_NATIVE(GlobalFree)},
+#else
+	{(char *)"GlobalFree", (char *)"(J)J", (void *)OS_NATIVE(GlobalFree)},
+#endif
+#endif
+#ifndef NO_GlobalLock
+#ifndef JNI64
+	{(char *)"GlobalLock", (char *)"(I)I", (void *)OS_NATIVE(GlobalLock)},
+#else
+	{(char *)"GlobalLock", (char *)"(J)J", (void *)OS_NATIVE(GlobalLock)},
+#endif
+#endif
+#ifndef NO_GlobalSize
+#ifndef JNI64
+	{(char *)"GlobalSize", (char *)"(I)I", (void *)OS_NATIVE(GlobalSize)},
+#else
+	{(char *)"GlobalSize", (char *)"(J)I", (void *)OS_NATIVE(GlobalSize)},
+#endif
+#endif
+#ifndef NO_GlobalUnlock
+#ifndef JNI64
+	{(char *)"GlobalUnlock", (char *)"(I)Z", (void *)OS_NATIVE(GlobalUnlock)},
+#else
+	{(char *)"GlobalUnlock", (char *)"(J)Z", (void *)OS_NATIVE(GlobalUnlock)},
+#endif
+#endif
+#ifndef NO_GradientFill
+#ifndef JNI64
+	{(char *)"GradientFill", (char *)"(IIIIII)Z", (void *)OS_NATIVE(GradientFill)},
+#else
+	{(char *)"GradientFill", (char *)"(JJIJII)Z", (void *)OS_NATIVE(GradientFill)},
+#endif
+#endif
+#ifndef NO_HDHITTESTINFO_1sizeof
+	{(char *)"HDHITTESTINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(HDHITTESTINFO_1sizeof)},
+#endif
+#ifndef NO_HDITEM_1sizeof
+	{(char *)"HDITEM_sizeof", (char *)"()I", (void *)OS_NATIVE(HDITEM_1sizeof)},
+#endif
+#ifndef NO_HDLAYOUT_1sizeof
+	{(char *)"HDLAYOUT_sizeof", (char *)"()I", (void *)OS_NATIVE(HDLAYOUT_1sizeof)},
+#endif
+#ifndef NO_HELPINFO_1sizeof
+	{(char *)"HELPINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(HELPINFO_1sizeof)},
+#endif
+#ifndef NO_HIGHCONTRAST_1sizeof
+	{(char *)"HIGHCONTRAST_sizeof", (char *)"()I", (void *)OS_NATIVE(HIGHCONTRAST_1sizeof)},
+#endif
+#ifndef NO_HIWORD
+#ifndef JNI64
+	{(char *)"HIWORD", (char *)"(I)I", (void *)OS_NATIVE(HIWORD)},
+#else
+	{(char *)"HIWORD", (char *)"(J)I", (void *)OS_NATIVE(HIWORD)},
+#endif
+#endif
+#ifndef NO_HeapAlloc
+#ifndef JNI64
+	{(char *)"HeapAlloc", (char *)"(III)I", (void *)OS_NATIVE(HeapAlloc)},
+#else
+	{(char *)"HeapAlloc", (char *)"(JII)J", (void *)OS_NATIVE(HeapAlloc)},
+#endif
+#endif
+#ifndef NO_HeapFree
+#ifndef JNI64
+	{(char *)"HeapFree", (char *)"(III)Z", (void *)OS_NATIVE(HeapFree)},
+#else
+	{(char *)"HeapFree", (char *)"(JIJ)Z", (void *)OS_NATIVE(HeapFree)},
+#endif
+#endif
+#ifndef NO_HeapValidate
+#ifndef JNI64
+	{(char *)"HeapValidate", (char *)"(III)Z", (void *)OS_NATIVE(HeapValidate)},
+#else
+	{(char *)"HeapValidate", (char *)"(JIJ)Z", (void *)OS_NATIVE(HeapValidate)},
+#endif
+#endif
+#ifndef NO_HideCaret
+#ifndef JNI64
+	{(char *)"HideCaret", (char *)"(I)Z", (void *)OS_NATIVE(HideCaret)},
+#else
+	{(char *)"HideCaret", (char *)"(J)Z", (void *)OS_NATIVE(HideCaret)},
+#endif
+#endif
+#ifndef NO_HitTestThemeBackground
+#ifndef JNI64
+	{(char *)"HitTestThemeBackground", (char *)"(IIIIILorg/eclipse/swt/internal/win32/RECT;ILorg/eclipse/swt/internal/win32/POINT;[S)I", (void *)OS_NATIVE(HitTestThemeBackground)},
+#else
+	{(char *)"HitTestThemeBackground", (char *)"(JJIIILorg/eclipse/swt/internal/win32/RECT;JLorg/eclipse/swt/internal/win32/POINT;[S)I", (void *)OS_NATIVE(HitTestThemeBackground)},
+#endif
+#endif
+#ifndef NO_ICONINFO_1sizeof
+	{(char *)"ICONINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(ICONINFO_1sizeof)},
+#endif
+#ifndef NO_IIDFromString
+	{(char *)"IIDFromString", (char *)"([C[B)I", (void *)OS_NATIVE(IIDFromString)},
+#endif
+#ifndef NO_INITCOMMONCONTROLSEX_1sizeof
+	{(char *)"INITCOMMONCONTROLSEX_sizeof", (char *)"()I", (void *)OS_NATIVE(INITCOMMONCONTROLSEX_1sizeof)},
+#endif
+#ifndef NO_INPUT_1sizeof
+	{(char *)"INPUT_sizeof", (char *)"()I", (void *)OS_NATIVE(INPUT_1sizeof)},
+#endif
+#ifndef NO_ImageList_1Add
+#ifndef JNI64
+	{(char *)"ImageList_Add", (char *)"(III)I", (void *)OS_NATIVE(ImageList_1Add)},
+#else
+	{(char *)"ImageList_Add", (char *)"(JJJ)I", (void *)OS_NATIVE(ImageList_1Add)},
+#endif
+#endif
+#ifndef NO_ImageList_1AddMasked
+#ifndef JNI64
+	{(char *)"ImageList_AddMasked", (char *)"(III)I", (void *)OS_NATIVE(ImageList_1AddMasked)},
+#else
+	{(char *)"ImageList_AddMasked", (char *)"(JJI)I", (void *)OS_NATIVE(ImageList_1AddMasked)},
+#endif
+#endif
+#ifndef NO_ImageList_1BeginDrag
+#ifndef JNI64
+	{(char *)"ImageList_BeginDrag", (char *)"(IIII)Z", (void *)OS_NATIVE(ImageList_1BeginDrag)},
+#else
+	{(char *)"ImageList_BeginDrag", (char *)"(JIII)Z", (void *)OS_NATIVE(ImageList_1BeginDrag)},
+#endif
+#endif
+#ifndef NO_ImageList_1Create
+#ifndef JNI64
+	{(char *)"ImageList_Create", (char *)"(IIIII)I", (void *)OS_NATIVE(ImageList_1Create)},
+#else
+	{(char *)"ImageList_Create", (char *)"(IIIII)J", (void *)OS_NATIVE(ImageList_1Create)},
+#endif
+#endif
+#ifndef NO_ImageList_1Destroy
+#ifndef JNI64
+	{(char *)"ImageList_Destroy", (char *)"(I)Z", (void *)OS_NATIVE(ImageList_1Destroy)},
+#else
+	{(char *)"ImageList_Destroy", (char *)"(J)Z", (void *)OS_NATIVE(ImageList_1Destroy)},
+#endif
+#endif
+#ifndef NO_ImageList_1DragEnter
+#ifndef JNI64
+	{(char *)"ImageList_DragEnter", (char *)"(III)Z", (void *)OS_NATIVE(ImageList_1DragEnter)},
+#else
+	{(char *)"ImageList_DragEnter", (char *)"(JII)Z", (void *)OS_NATIVE(ImageList_1DragEnter)},
+#endif
+#endif
+#ifndef NO_ImageList_1DragLeave
+#ifndef JNI64
+	{(char *)"ImageList_DragLeave", (char *)"(I)Z", (void *)OS_NATIVE(ImageList_1DragLeave)},
+#else
+	{(char *)"ImageList_DragLeave", (char *)"(J)Z", (void *)OS_NATIVE(ImageList_1DragLeave)},
+#endif
+#endif
+#ifndef NO_ImageList_1DragMove
+	{(char *)"ImageList_DragMove", (char *)"(II)Z", (void *)OS_NATIVE(ImageList_1DragMove)},
+#endif
+#ifndef NO_ImageList_1DragShowNolock
+	{(char *)"ImageList_DragShowNolock", (char *)"(Z)Z", (void *)OS_NATIVE(ImageList_1DragShowNolock)},
+#endif
+#ifndef NO_ImageList_1Draw
+#ifndef JNI64
+	{(char *)"ImageList_Draw", (char *)"(IIIIII)Z", (void *)OS_NATIVE(ImageList_1Draw)},
+#else
+	{(char *)"ImageList_Draw", (char *)"(JIJIII)Z", (void *)OS_NATIVE(ImageList_1Draw)},
+#endif
+#endif
+#ifndef NO_ImageList_1EndDrag
+	{(char *)"ImageList_EndDrag", (char *)"()V", (void *)OS_NATIVE(ImageList_1EndDrag)},
+#endif
+#ifndef NO_ImageList_1GetDragImage
+#ifndef JNI64
+	{(char *)"ImageList_GetDragImage", (char *)"(Lorg/eclipse/swt/internal/win32/POINT;Lorg/eclipse/swt/internal/win32/POINT;)I", (void *)OS_NATIVE(ImageList_1GetDragImage)},
+#else
+	{(char *)"ImageList_GetDragImage", (char *)"(Lorg/eclipse/swt/internal/win32/POINT;Lorg/eclipse/swt/internal/win32/POINT;)J", (void *)OS_NATIVE(ImageList_1GetDragImage)},
+#endif
+#endif
+#ifndef NO_ImageList_1GetIcon
+#ifndef JNI64
+	{(char *)"ImageList_GetIcon", (char *)"(III)I", (void *)OS_NATIVE(ImageList_1GetIcon)},
+#else
+	{(char *)"ImageList_GetIcon", (char *)"(JII)J", (void *)OS_NATIVE(ImageList_1GetIcon)},
+#endif
+#endif
+#ifndef NO_ImageList_1GetIconSize
+#ifndef JNI64
+	{(char *)"ImageList_GetIconSize", (char *)"(I[I[I)Z", (void *)OS_NATIVE(ImageList_1GetIconSize)},
+#else
+	{(char *)"ImageList_GetIconSize", (char *)"(J[I[I)Z", (void *)OS_NATIVE(ImageList_1GetIconSize)},
+#endif
+#endif
+#ifndef NO_ImageList_1GetImageCount
+#ifndef JNI64
+	{(char *)"ImageList_GetImageCount", (char *)"(I)I", (void *)OS_NATIVE(ImageList_1GetImageCount)},
+#else
+	{(char *)"ImageList_GetImageCount", (char *)"(J)I", (void *)OS_NATIVE(ImageList_1GetImageCount)},
+#endif
+#endif
+#ifndef NO_ImageList_1Remove
+#ifndef JNI64
+	{(char *)"ImageList_Remove", (char *)"(II)Z", (void *)OS_NATIVE(ImageList_1Remove)},
+#else
+	{(char *)"ImageList_Remove", (char *)"(JI)Z", (void *)OS_NATIVE(ImageList_1Remove)},
+#endif
+#endif
+#ifndef NO_ImageList_1Replace
+#ifndef JNI64
+	{(char *)"ImageList_Replace", (char *)"(IIII)Z", (void *)OS_NATIVE(ImageList_1Replace)},
+#else
+	{(char *)"ImageList_Replace", (char *)"(JIJJ)Z", (void *)OS_NATIVE(ImageList_1Replace)},
+#endif
+#endif
+#ifndef NO_ImageList_1ReplaceIcon
+#ifndef JNI64
+	{(char *)"ImageList_ReplaceIcon", (char *)"(III)I", (void *)OS_NATIVE(ImageList_1ReplaceIcon)},
+#else
+	{(char *)"ImageList_ReplaceIcon", (char *)"(JIJ)I", (void *)OS_NATIVE(ImageList_1ReplaceIcon)},
+#endif
+#endif
+#ifndef NO_ImageList_1SetIconSize
+#ifndef JNI64
+	{(char *)"ImageList_SetIconSize", (char *)"(III)Z", (void *)OS_NATIVE(ImageList_1SetIconSize)},
+#else
+	{(char *)"ImageList_SetIconSize", (char *)"(JII)Z", (void *)OS_NATIVE(ImageList_1SetIconSize)},
+#endif
+#endif
+#ifndef NO_ImmAssociateContext
+#ifndef JNI64
+	{(char *)"ImmAssociateContext", (char *)"(II)I", (void *)OS_NATIVE(ImmAssociateContext)},
+#else
+	{(char *)"ImmAssociateContext", (char *)"(JJ)J", (void *)OS_NATIVE(ImmAssociateContext)},
+#endif
+#endif
+#ifndef NO_ImmCreateContext
+#ifndef JNI64
+	{(char *)"ImmCreateContext", (char *)"()I", (void *)OS_NATIVE(ImmCreateContext)},
+#else
+	{(char *)"ImmCreateContext", (char *)"()J", (void *)OS_NATIVE(ImmCreateContext)},
+#endif
+#endif
+#ifndef NO_ImmDestroyContext
+#ifndef JNI64
+	{(char *)"ImmDestroyContext", (char *)"(I)Z", (void *)OS_NATIVE(ImmDestroyContext)},
+#else
+	{(char *)"ImmDestroyContext", (char *)"(J)Z", (void *)OS_NATIVE(ImmDestroyContext)},
+#endif
+#endif
+#ifndef NO_ImmDisableTextFrameService
+	{(char *)"ImmDisableTextFrameService", (char *)"(I)Z", (void *)OS_NATIVE(ImmDisableTextFrameService)},
+#endif
+#ifndef NO_ImmEscapeA
+#ifndef JNI64
+	{(char *)"ImmEscapeA", (char *)"(III[B)I", (void *)OS_NATIVE(ImmEscapeA)},
+#else
+	{(char *)"ImmEscapeA", (char *)"(JJI[B)J", (void *)OS_NATIVE(ImmEscapeA)},
+#endif
+#endif
+#ifndef NO_ImmEscapeW
+#ifndef JNI64
+	{(char *)"ImmEscapeW", (char *)"(III[C)I", (void *)OS_NATIVE(ImmEscapeW)},
+#else
+	{(char *)"ImmEscapeW", (char *)"(JJI[C)J", (void *)OS_NATIVE(ImmEscapeW)},
+#endif
+#endif
+#ifndef NO_ImmGetCompositionFontA
+#ifndef JNI64
+	{(char *)"ImmGetCompositionFontA", (char *)"(ILorg/eclipse/swt/internal/win32/LOGFONTA;)Z", (void *)OS_NATIVE(ImmGetCompositionFontA)},
+#else
+	{(char *)"ImmGetCompositionFontA", (char *)"(JLorg/eclipse/swt/internal/win32/LOGFONTA;)Z", (void *)OS_NATIVE(ImmGetCompositionFontA)},
+#endif
+#endif
+#ifndef NO_ImmGetCompositionFontW
+#ifndef JNI64
+	{(char *)"ImmGetCompositionFontW", (char *)"(ILorg/eclipse/swt/internal/win32/LOGFONTW;)Z", (void *)OS_NATIVE(ImmGetCompositionFontW)},
+#else
+	{(char *)"ImmGetCompositionFontW", (char *)"(JLorg/eclipse/swt/internal/win32/LOGFONTW;)Z", (void *)OS_NATIVE(ImmGetCompositionFontW)},
+#endif
+#endif
+#if (!defined(NO_ImmGetCompositionStringA__II_3BI) && !defined(JNI64)) || (!defined(NO_ImmGetCompositionStringA__JI_3BI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"ImmGetCompositionStringA", (char *)"(II[BI)I", (void *)OS_NATIVE(ImmGetCompositionStringA__II_3BI)},
+#else
+	{(char *)"ImmGetCompositionStringA", (char *)"(JI[BI)I", (void *)OS_NATIVE(ImmGetCompositionStringA__JI_3BI)},
+#endif
+#endif
+#if (!defined(NO_ImmGetCompositionStringA__II_3II) && !defined(JNI64)) || (!defined(NO_ImmGetCompositionStringA__JI_3II) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"ImmGetCompositionStringA", (char *)"(II[II)I", (void *)OS_NATIVE(ImmGetCompositionStringA__II_3II)},
+#else
+	{(char *)"ImmGetCompositionStringA", (char *)"(JI[II)I", (void *)OS_NATIVE(ImmGetCompositionStringA__JI_3II)},
+#endif
+#endif
+#if (!defined(NO_ImmGetCompositionStringW__II_3BI) && !defined(JNI64)) || (!defined(NO_ImmGetCompositionStringW__JI_3BI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"ImmGetCompositionStringW", (char *)"(II[BI)I", (void *)OS_NATIVE(ImmGetCompositionStringW__II_3BI)},
+#else
+	{(char *)"ImmGetCompositionStringW", (char *)"(JI[BI)I", (void *)OS_NATIVE(ImmGetCompositionStringW__JI_3BI)},
+#endif
+#endif
+#if (!defined(NO_ImmGetCompositionStringW__II_3CI) && !defined(JNI64)) || (!defined(NO_ImmGetCompositionStringW__JI_3CI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"ImmGetCompositionStringW", (char *)"(II[CI)I", (void *)OS_NATIVE(ImmGetCompositionStringW__II_3CI)},
+#else
+	{(char *)"ImmGetCompositionStringW", (char *)"(JI[CI)I", (void *)OS_NATIVE(ImmGetCompositionStringW__JI_3CI)},
+#endif
+#endif
+#if (!defined(NO_ImmGetCompositionStringW__II_3II) && !defined(JNI64)) || (!defined(NO_ImmGetCompositionStringW__JI_3II) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"ImmGetCompositionStringW", (char *)"(II[II)I", (void *)OS_NATIVE(ImmGetCompositionStringW__II_3II)},
+#else
+	{(char *)"ImmGetCompositionStringW", (char *)"(JI[II)I", (void *)OS_NATIVE(ImmGetCompositionStringW__JI_3II)},
+#endif
+#endif
+#ifndef NO_ImmGetContext
+#ifndef JNI64
+	{(char *)"ImmGetContext", (char *)"(I)I", (void *)OS_NATIVE(ImmGetContext)},
+#else
+	{(char *)"ImmGetContext", (char *)"(J)J", (void *)OS_NATIVE(ImmGetContext)},
+#endif
+#endif
+#ifndef NO_ImmGetConversionStatus
+#ifndef JNI64
+	{(char *)"ImmGetConversionStatus", (char *)"(I[I[I)Z", (void *)OS_NATIVE(ImmGetConversionStatus)},
+#else
+	{(char *)"ImmGetConversionStatus", (char *)"(J[I[I)Z", (void *)OS_NATIVE(ImmGetConversionStatus)},
+#endif
+#endif
+#ifndef NO_ImmGetDefaultIMEWnd
+#ifndef JNI64
+	{(char *)"ImmGetDefaultIMEWnd", (char *)"(I)I", (void *)OS_NATIVE(ImmGetDefaultIMEWnd)},
+#else
+	{(char *)"ImmGetDefaultIMEWnd", (char *)"(J)J", (void *)OS_NATIVE(ImmGetDefaultIMEWnd)},
+#endif
+#endif
+#ifndef NO_ImmGetOpenStatus
+#ifndef JNI64
+	{(char *)"ImmGetOpenStatus", (char *)"(I)Z", (void *)OS_NATIVE(ImmGetOpenStatus)},
+#else
+	{(char *)"ImmGetOpenStatus", (char *)"(J)Z", (void *)OS_NATIVE(ImmGetOpenStatus)},
+#endif
+#endif
+#ifndef NO_ImmNotifyIME
+#ifndef JNI64
+	{(char *)"ImmNotifyIME", (char *)"(IIII)Z", (void *)OS_NATIVE(ImmNotifyIME)},
+#else
+	{(char *)"ImmNotifyIME", (char *)"(JIII)Z", (void *)OS_NATIVE(ImmNotifyIME)},
+#endif
+#endif
+#ifndef NO_ImmReleaseContext
+#ifndef JNI64
+	{(char *)"ImmReleaseContext", (char *)"(II)Z", (void *)OS_NATIVE(ImmReleaseContext)},
+#else
+	{(char *)"ImmReleaseContext", (char *)"(JJ)Z", (void *)OS_NATIVE(ImmReleaseContext)},
+#endif
+#endif
+#ifndef NO_ImmSetCandidateWindow
+#ifndef JNI64
+	{(char *)"ImmSetCandidateWindow", (char *)"(ILorg/eclipse/swt/internal/win32/CANDIDATEFORM;)Z", (void *)OS_NATIVE(ImmSetCandidateWindow)},
+#else
+	{(char *)"ImmSetCandidateWindow", (char *)"(JLorg/eclipse/swt/internal/win32/CANDIDATEFORM;)Z", (void *)OS_NATIVE(ImmSetCandidateWindow)},
+#endif
+#endif
+#ifndef NO_ImmSetCompositionFontA
+#ifndef JNI64
+	{(char *)"ImmSetCompositionFontA", (char *)"(ILorg/eclipse/swt/internal/win32/LOGFONTA;)Z", (void *)OS_NATIVE(ImmSetCompositionFontA)},
+#else
+	{(char *)"ImmSetCompositionFontA", (char *)"(JLorg/eclipse/swt/internal/win32/LOGFONTA;)Z", (void *)OS_NATIVE(ImmSetCompositionFontA)},
+#endif
+#endif
+#ifndef NO_ImmSetCompositionFontW
+#ifndef JNI64
+	{(char *)"ImmSetCompositionFontW", (char *)"(ILorg/eclipse/swt/internal/win32/LOGFONTW;)Z", (void *)OS_NATIVE(ImmSetCompositionFontW)},
+#else
+	{(char *)"ImmSetCompositionFontW", (char *)"(JLorg/eclipse/swt/internal/win32/LOGFONTW;)Z", (void *)OS_NATIVE(ImmSetCompositionFontW)},
+#endif
+#endif
+#ifndef NO_ImmSetCompositionWindow
+#ifndef JNI64
+	{(char *)"ImmSetCompositionWindow", (char *)"(ILorg/eclipse/swt/internal/win32/COMPOSITIONFORM;)Z", (void *)OS_NATIVE(ImmSetCompositionWindow)},
+#else
+	{(char *)"ImmSetCompositionWindow", (char *)"(JLorg/eclipse/swt/internal/win32/COMPOSITIONFORM;)Z", (void *)OS_NATIVE(ImmSetCompositionWindow)},
+#endif
+#endif
+#ifndef NO_ImmSetConversionStatus
+#ifndef JNI64
+	{(char *)"ImmSetConversionStatus", (char *)"(III)Z", (void *)OS_NATIVE(ImmSetConversionStatus)},
+#else
+	{(char *)"ImmSetConversionStatus", (char *)"(JII)Z", (void *)OS_NATIVE(ImmSetConversionStatus)},
+#endif
+#endif
+#ifndef NO_ImmSetOpenStatus
+#ifndef JNI64
+	{(char *)"ImmSetOpenStatus", (char *)"(IZ)Z", (void *)OS_NATIVE(ImmSetOpenStatus)},
+#else
+	{(char *)"ImmSetOpenStatus", (char *)"(JZ)Z", (void *)OS_NATIVE(ImmSetOpenStatus)},
+#endif
+#endif
+#ifndef NO_InSendMessage
+	{(char *)"InSendMessage", (char *)"()Z", (void *)OS_NATIVE(InSendMessage)},
+#endif
+#ifndef NO_InitCommonControls
+	{(char *)"InitCommonControls", (char *)"()V", (void *)OS_NATIVE(InitCommonControls)},
+#endif
+#ifndef NO_InitCommonControlsEx
+	{(char *)"InitCommonControlsEx", (char *)"(Lorg/eclipse/swt/internal/win32/INITCOMMONCONTROLSEX;)Z", (void *)OS_NATIVE(InitCommonControlsEx)},
+#endif
+#ifndef NO_InsertMenuA
+#ifndef JNI64
+	{(char *)"InsertMenuA", (char *)"(IIII[B)Z", (void *)OS_NATIVE(InsertMenuA)},
+#else
+	{(char *)"InsertMenuA", (char *)"(JIIJ[B)Z", (void *)OS_NATIVE(InsertMenuA)},
+#endif
+#endif
+#ifndef NO_InsertMenuItemA
+#ifndef JNI64
+	{(char *)"InsertMenuItemA", (char *)"(IIZLorg/eclipse/swt/internal/win32/MENUITEMINFO;)Z", (void *)OS_NATIVE(InsertMenuItemA)},
+#else
+	{(char *)"InsertMenuItemA", (char *)"(JIZLorg/eclipse/swt/internal/win32/MENUITEMINFO;)Z", (void *)OS_NATIVE(InsertMenuItemA)},
+#endif
+#endif
+#ifndef NO_InsertMenuItemW
+#ifndef JNI64
+	{(char *)"InsertMenuItemW", (char *)"(IIZLorg/eclipse/swt/internal/win32/MENUITEMINFO;)Z", (void *)OS_NATIVE(InsertMenuItemW)},
+#else
+	{(char *)"InsertMenuItemW", (char *)"(JIZLorg/eclipse/swt/internal/win32/MENUITEMINFO;)Z", (void *)OS_NATIVE(InsertMenuItemW)},
+#endif
+#endif
+#ifndef NO_InsertMenuW
+#ifndef JNI64
+	{(char *)"InsertMenuW", (char *)"(IIII[C)Z", (void *)OS_NATIVE(InsertMenuW)},
+#else
+	{(char *)"InsertMenuW", (char *)"(JIIJ[C)Z", (void *)OS_NATIVE(InsertMenuW)},
+#endif
+#endif
+#ifndef NO_InternetGetCookieA
+	{(char *)"InternetGetCookieA", (char *)"([B[B[B[I)Z", (void *)OS_NATIVE(InternetGetCookieA)},
+#endif
+#ifndef NO_InternetGetCookieW
+	{(char *)"InternetGetCookieW", (char *)"([C[C[C[I)Z", (void *)OS_NATIVE(InternetGetCookieW)},
+#endif
+#ifndef NO_InternetSetCookieA
+	{(char *)"InternetSetCookieA", (char *)"([B[B[B)Z", (void *)OS_NATIVE(InternetSetCookieA)},
+#endif
+#ifndef NO_InternetSetCookieW
+	{(char *)"InternetSetCookieW", (char *)"([C[C[C)Z", (void *)OS_NATIVE(InternetSetCookieW)},
+#endif
+#ifndef NO_InternetSetOption
+#ifndef JNI64
+	{(char *)"InternetSetOption", (char *)"(IIII)Z", (void *)OS_NATIVE(InternetSetOption)},
+#else
+	{(char *)"InternetSetOption", (char *)"(JIJI)Z", (void *)OS_NATIVE(InternetSetOption)},
+#endif
+#endif
+#ifndef NO_IntersectClipRect
+#ifndef JNI64
+	{(char *)"IntersectClipRect", (char *)"(IIIII)I", (void *)OS_NATIVE(IntersectClipRect)},
+#else
+	{(char *)"IntersectClipRect", (char *)"(JIIII)I", (void *)OS_NATIVE(IntersectClipRect)},
+#endif
+#endif
+#ifndef NO_IntersectRect
+	{(char *)"IntersectRect", (char *)"(Lorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(IntersectRect)},
+#endif
+#ifndef NO_InvalidateRect
+#ifndef JNI64
+	{(char *)"InvalidateRect", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;Z)Z", (void *)OS_NATIVE(InvalidateRect)},
+#else
+	{(char *)"InvalidateRect", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;Z)Z", (void *)OS_NATIVE(InvalidateRect)},
+#endif
+#endif
+#ifndef NO_InvalidateRgn
+#ifndef JNI64
+	{(char *)"InvalidateRgn", (char *)"(IIZ)Z", (void *)OS_NATIVE(InvalidateRgn)},
+#else
+	{(char *)"InvalidateRgn", (char *)"(JJZ)Z", (void *)OS_NATIVE(InvalidateRgn)},
+#endif
+#endif
+#ifndef NO_IsAppThemed
+	{(char *)"IsAppThemed", (char *)"()Z", (void *)OS_NATIVE(IsAppThemed)},
+#endif
+#ifndef NO_IsBadReadPtr
+#ifndef JNI64
+	{(char *)"IsBadReadPtr", (char *)"(II)Z", (void *)OS_NATIVE(IsBadReadPtr)},
+#else
+	{(char *)"IsBadReadPtr", (char *)"(JI)Z", (void *)OS_NATIVE(IsBadReadPtr)},
+#endif
+#endif
+#ifndef NO_IsBadWritePtr
+#ifndef JNI64
+	{(char *)"IsBadWritePtr", (char *)"(II)Z", (void *)OS_NATIVE(IsBadWritePtr)},
+#else
+	{(char *)"IsBadWritePtr", (char *)"(JI)Z", (void *)OS_NATIVE(IsBadWritePtr)},
+#endif
+#endif
+#ifndef NO_IsDBCSLeadByte
+	{(char *)"IsDBCSLeadByte", (char *)"(B)Z", (void *)OS_NATIVE(IsDBCSLeadByte)},
+#endif
+#ifndef NO_IsHungAppWindow
+#ifndef JNI64
+	{(char *)"IsHungAppWindow", (char *)"(I)Z", (void *)OS_NATIVE(IsHungAppWindow)},
+#else
+	{(char *)"IsHungAppWindow", (char *)"(J)Z", (void *)OS_NATIVE(IsHungAppWindow)},
+#endif
+#endif
+#ifndef NO_IsIconic
+#ifndef JNI64
+	{(char *)"IsIconic", (char *)"(I)Z", (void *)OS_NATIVE(IsIconic)},
+#else
+	{(char *)"IsIconic", (char *)"(J)Z", (void *)OS_NATIVE(IsIconic)},
+#endif
+#endif
+#ifndef NO_IsTouchWindow
+#ifndef JNI64
+	{(char *)"IsTouchWindow", (char *)"(I[J)Z", (void *)OS_NATIVE(IsTouchWindow)},
+#else
+	{(char *)"IsTouchWindow", (char *)"(J[J)Z", (void *)OS_NATIVE(IsTouchWindow)},
+#endif
+#endif
+#ifndef NO_IsWindowEnabled
+#ifndef JNI64
+	{(char *)"IsWindowEnabled", (char *)"(I)Z", (void *)OS_NATIVE(IsWindowEnabled)},
+#else
+	{(char *)"IsWindowEnabled", (char *)"(J)Z", (void *)OS_NATIVE(IsWindowEnabled)},
+#endif
+#endif
+#ifndef NO_IsWindowVisible
+#ifndef JNI64
+	{(char *)"IsWindowVisible", (char *)"(I)Z", (void *)OS_NATIVE(IsWindowVisible)},
+#else
+	{(char *)"IsWindowVisible", (char *)"(J)Z", (void *)OS_NATIVE(IsWindowVisible)},
+#endif
+#endif
+#ifndef NO_IsZoomed
+#ifndef JNI64
+	{(char *)"IsZoomed", (char *)"(I)Z", (void *)OS_NATIVE(IsZoomed)},
+#else
+	{(char *)"IsZoomed", (char *)"(J)Z", (void *)OS_NATIVE(IsZoomed)},
+#endif
+#endif
+#ifndef NO_KEYBDINPUT_1sizeof
+	{(char *)"KEYBDINPUT_sizeof", (char *)"()I", (void *)OS_NATIVE(KEYBDINPUT_1sizeof)},
+#endif
+#ifndef NO_KillTimer
+#ifndef JNI64
+	{(char *)"KillTimer", (char *)"(II)Z", (void *)OS_NATIVE(KillTimer)},
+#else
+	{(char *)"KillTimer", (char *)"(JJ)Z", (void *)OS_NATIVE(KillTimer)},
+#endif
+#endif
+#ifndef NO_LITEM_1sizeof
+	{(char *)"LITEM_sizeof", (char *)"()I", (void *)OS_NATIVE(LITEM_1sizeof)},
+#endif
+#ifndef NO_LODWORD
+	{(char *)"LODWORD", (char *)"(J)I", (void *)OS_NATIVE(LODWORD)},
+#endif
+#ifndef NO_LOGBRUSH_1sizeof
+	{(char *)"LOGBRUSH_sizeof", (char *)"()I", (void *)OS_NATIVE(LOGBRUSH_1sizeof)},
+#endif
+#ifndef NO_LOGFONTA_1sizeof
+	{(char *)"LOGFONTA_sizeof", (char *)"()I", (void *)OS_NATIVE(LOGFONTA_1sizeof)},
+#endif
+#ifndef NO_LOGFONTW_1sizeof
+	{(char *)"LOGFONTW_sizeof", (char *)"()I", (void *)OS_NATIVE(LOGFONTW_1sizeof)},
+#endif
+#ifndef NO_LOGPEN_1sizeof
+	{(char *)"LOGPEN_sizeof", (char *)"()I", (void *)OS_NATIVE(LOGPEN_1sizeof)},
+#endif
+#ifndef NO_LOWORD
+#ifndef JNI64
+	{(char *)"LOWORD", (char *)"(I)I", (void *)OS_NATIVE(LOWORD)},
+#else
+	{(char *)"LOWORD", (char *)"(J)I", (void *)OS_NATIVE(LOWORD)},
+#endif
+#endif
+#ifndef NO_LPtoDP
+#ifndef JNI64
+	{(char *)"LPtoDP", (char *)"(ILorg/eclipse/swt/internal/win32/POINT;I)Z", (void *)OS_NATIVE(LPtoDP)},
+#else
+	{(char *)"LPtoDP", (char *)"(JLorg/eclipse/swt/internal/win32/POINT;I)Z", (void *)OS_NATIVE(LPtoDP)},
+#endif
+#endif
+#ifndef NO_LVCOLUMN_1sizeof
+	{(char *)"LVCOLUMN_sizeof", (char *)"()I", (void *)OS_NATIVE(LVCOLUMN_1sizeof)},
+#endif
+#ifndef NO_LVHITTESTINFO_1sizeof
+	{(char *)"LVHITTESTINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(LVHITTESTINFO_1sizeof)},
+#endif
+#ifndef NO_LVINSERTMARK_1sizeof
+	{(char *)"LVINSERTMARK_sizeof", (char *)"()I", (void *)OS_NATIVE(LVINSERTMARK_1sizeof)},
+#endif
+#ifndef NO_LVITEM_1sizeof
+	{(char *)"LVITEM_sizeof", (char *)"()I", (void *)OS_NATIVE(LVITEM_1sizeof)},
+#endif
+#ifndef NO_LineTo
+#ifndef JNI64
+	{(char *)"LineTo", (char *)"(III)Z", (void *)OS_NATIVE(LineTo)},
+#else
+	{(char *)"LineTo", (char *)"(JII)Z", (void *)OS_NATIVE(LineTo)},
+#endif
+#endif
+#ifndef NO_LoadBitmapA
+#ifndef JNI64
+	{(char *)"LoadBitmapA", (char *)"(II)I", (void *)OS_NATIVE(LoadBitmapA)},
+#else
+	{(char *)"LoadBitmapA", (char *)"(JJ)J", (void *)OS_NATIVE(LoadBitmapA)},
+#endif
+#endif
+#ifndef NO_LoadBitmapW
+#ifndef JNI64
+	{(char *)"LoadBitmapW", (char *)"(II)I", (void *)OS_NATIVE(LoadBitmapW)},
+#else
+	{(char *)"LoadBitmapW", (char *)"(JJ)J", (void *)OS_NATIVE(LoadBitmapW)},
+#endif
+#endif
+#ifndef NO_LoadCursorA
+#ifndef JNI64
+	{(char *)"LoadCursorA", (char *)"(II)I", (void *)OS_NATIVE(LoadCursorA)},
+#else
+	{(char *)"LoadCursorA", (char *)"(JJ)J", (void *)OS_NATIVE(LoadCursorA)},
+#endif
+#endif
+#ifndef NO_LoadCursorW
+#ifndef JNI64
+	{(char *)"LoadCursorW", (char *)"(II)I", (void *)OS_NATIVE(LoadCursorW)},
+#else
+	{(char *)"LoadCursorW", (char *)"(JJ)J", (void *)OS_NATIVE(LoadCursorW)},
+#endif
+#endif
+#ifndef NO_LoadIconA
+#ifndef JNI64
+	{(char *)"LoadIconA", (char *)"(II)I", (void *)OS_NATIVE(LoadIconA)},
+#else
+	{(char *)"LoadIconA", (char *)"(JJ)J", (void *)OS_NATIVE(LoadIconA)},
+#endif
+#endif
+#ifndef NO_LoadIconW
+#ifndef JNI64
+	{(char *)"LoadIconW", (char *)"(II)I", (void *)OS_NATIVE(LoadIconW)},
+#else
+	{(char *)"LoadIconW", (char *)"(JJ)J", (void *)OS_NATIVE(LoadIconW)},
+#endif
+#endif
+#if (!defined(NO_LoadImageA__IIIIII) && !defined(JNI64)) || (!defined(NO_LoadImageA__JJIIII) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"LoadImageA", (char *)"(IIIIII)I", (void *)OS_NATIVE(LoadImageA__IIIIII)},
+#else
+	{(char *)"LoadImageA", (char *)"(JJIIII)J", (void *)OS_NATIVE(LoadImageA__JJIIII)},
+#endif
+#endif
+#if (!defined(NO_LoadImageA__I_3BIIII) && !defined(JNI64)) || (!defined(NO_LoadImageA__J_3BIIII) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"LoadImageA", (char *)"(I[BIIII)I", (void *)OS_NATIVE(LoadImageA__I_3BIIII)},
+#else
+	{(char *)"LoadImageA", (char *)"(J[BIIII)J", (void *)OS_NATIVE(LoadImageA__J_3BIIII)},
+#endif
+#endif
+#if (!defined(NO_LoadImageW__IIIIII) && !defined(JNI64)) || (!defined(NO_LoadImageW__JJIIII) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"LoadImageW", (char *)"(IIIIII)I", (void *)OS_NATIVE(LoadImageW__IIIIII)},
+#else
+	{(char *)"LoadImageW", (char *)"(JJIIII)J", (void *)OS_NATIVE(LoadImageW__JJIIII)},
+#endif
+#endif
+#if (!defined(NO_LoadImageW__I_3CIIII) && !defined(JNI64)) || (!defined(NO_LoadImageW__J_3CIIII) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"LoadImageW", (char *)"(I[CIIII)I", (void *)OS_NATIVE(LoadImageW__I_3CIIII)},
+#else
+	{(char *)"LoadImageW", (char *)"(J[CIIII)J", (void *)OS_NATIVE(LoadImageW__J_3CIIII)},
+#endif
+#endif
+#ifndef NO_LoadLibraryA
+#ifndef JNI64
+	{(char *)"LoadLibraryA", (char *)"([B)I", (void *)OS_NATIVE(LoadLibraryA)},
+#else
+	{(char *)"LoadLibraryA", (char *)"([B)J", (void *)OS_NATIVE(LoadLibraryA)},
+#endif
+#endif
+#ifndef NO_LoadLibraryW
+#ifndef JNI64
+	{(char *)"LoadLibraryW", (char *)"([C)I", (void *)OS_NATIVE(LoadLibraryW)},
+#else
+	{(char *)"LoadLibraryW", (char *)"([C)J", (void *)OS_NATIVE(LoadLibraryW)},
+#endif
+#endif
+#ifndef NO_LoadStringA
+#ifndef JNI64
+	{(char *)"LoadStringA", (char *)"(II[BI)I", (void *)OS_NATIVE(LoadStringA)},
+#else
+	{(char *)"LoadStringA", (char *)"(JI[BI)I", (void *)OS_NATIVE(LoadStringA)},
+#endif
+#endif
+#ifndef NO_LoadStringW
+#ifndef JNI64
+	{(char *)"LoadStringW", (char *)"(II[CI)I", (void *)OS_NATIVE(LoadStringW)},
+#else
+	{(char *)"LoadStringW", (char *)"(JI[CI)I", (void *)OS_NATIVE(LoadStringW)},
+#endif
+#endif
+#ifndef NO_LocalFree
+#ifndef JNI64
+	{(char *)"LocalFree", (char *)"(I)I", (void *)OS_NATIVE(LocalFree)},
+#else
+	{(char *)"LocalFree", (char *)"(J)J", (void *)OS_NATIVE(LocalFree)},
+#endif
+#endif
+#ifndef NO_LockWindowUpdate
+#ifndef JNI64
+	{(char *)"LockWindowUpdate", (char *)"(I)Z", (void *)OS_NATIVE(LockWindowUpdate)},
+#else
+	{(char *)"LockWindowUpdate", (char *)"(J)Z", (void *)OS_NATIVE(LockWindowUpdate)},
+#endif
+#endif
+#ifndef NO_MAKELPARAM
+#ifndef JNI64
+	{(char *)"MAKELPARAM", (char *)"(II)I", (void *)OS_NATIVE(MAKELPARAM)},
+#else
+	{(char *)"MAKELPARAM", (char *)"(II)J", (void *)OS_NATIVE(MAKELPARAM)},
+#endif
+#endif
+#ifndef NO_MAKELRESULT
+#ifndef JNI64
+	{(char *)"MAKELRESULT", (char *)"(II)I", (void *)OS_NATIVE(MAKELRESULT)},
+#else
+	{(char *)"MAKELRESULT", (char *)"(II)J", (void *)OS_NATIVE(MAKELRESULT)},
+#endif
+#endif
+#ifndef NO_MAKEWORD
+	{(char *)"MAKEWORD", (char *)"(II)I", (void *)OS_NATIVE(MAKEWORD)},
+#endif
+#ifndef NO_MAKEWPARAM
+#ifndef JNI64
+	{(char *)"MAKEWPARAM", (char *)"(II)I", (void *)OS_NATIVE(MAKEWPARAM)},
+#else
+	{(char *)"MAKEWPARAM", (char *)"(II)J", (void *)OS_NATIVE(MAKEWPARAM)},
+#endif
+#endif
+#ifndef NO_MARGINS_1sizeof
+	{(char *)"MARGINS_sizeof", (char *)"()I", (void *)OS_NATIVE(MARGINS_1sizeof)},
+#endif
+#ifndef NO_MCHITTESTINFO_1sizeof
+	{(char *)"MCHITTESTINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(MCHITTESTINFO_1sizeof)},
+#endif
+#ifndef NO_MCIWndRegisterClass
+	{(char *)"MCIWndRegisterClass", (char *)"()Z", (void *)OS_NATIVE(MCIWndRegisterClass)},
+#endif
+#ifndef NO_MEASUREITEMSTRUCT_1sizeof
+	{(char *)"MEASUREITEMSTRUCT_sizeof", (char *)"()I", (void *)OS_NATIVE(MEASUREITEMSTRUCT_1sizeof)},
+#endif
+#ifndef NO_MENUBARINFO_1sizeof
+	{(char *)"MENUBARINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(MENUBARINFO_1sizeof)},
+#endif
+#ifndef NO_MENUINFO_1sizeof
+	{(char *)"MENUINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(MENUINFO_1sizeof)},
+#endif
+#ifndef NO_MENUITEMINFO_1sizeof
+	{(char *)"MENUITEMINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(MENUITEMINFO_1sizeof)},
+#endif
+#ifndef NO_MINMAXINFO_1sizeof
+	{(char *)"MINMAXINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(MINMAXINFO_1sizeof)},
+#endif
+#ifndef NO_MONITORINFO_1sizeof
+	{(char *)"MONITORINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(MONITORINFO_1sizeof)},
+#endif
+#ifndef NO_MOUSEINPUT_1sizeof
+	{(char *)"MOUSEINPUT_sizeof", (char *)"()I", (void *)OS_NATIVE(MOUSEINPUT_1sizeof)},
+#endif
+#ifndef NO_MSG_1sizeof
+	{(char *)"MSG_sizeof", (char *)"()I", (void *)OS_NATIVE(MSG_1sizeof)},
+#endif
+#ifndef NO_MapViewOfFile
+#ifndef JNI64
+	{(char *)"MapViewOfFile", (char *)"(IIIII)I", (void *)OS_NATIVE(MapViewOfFile)},
+#else
+	{(char *)"MapViewOfFile", (char *)"(JIIII)J", (void *)OS_NATIVE(MapViewOfFile)},
+#endif
+#endif
+#ifndef NO_MapVirtualKeyA
+	{(char *)"MapVirtualKeyA", (char *)"(II)I", (void *)OS_NATIVE(MapVirtualKeyA)},
+#endif
+#ifndef NO_MapVirtualKeyW
+	{(char *)"MapVirtualKeyW", (char *)"(II)I", (void *)OS_NATIVE(MapVirtualKeyW)},
+#endif
+#if (!defined(NO_MapWindowPoints__IILorg_eclipse_swt_internal_win32_POINT_2I) && !defined(JNI64)) || (!defined(NO_MapWindowPoints__JJLorg_eclipse_swt_internal_win32_POINT_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MapWindowPoints", (char *)"(IILorg/eclipse/swt/internal/win32/POINT;I)I", (void *)OS_NATIVE(MapWindowPoints__IILorg_eclipse_swt_internal_win32_POINT_2I)},
+#else
+	{(char *)"MapWindowPoints", (char *)"(JJLorg/eclipse/swt/internal/win32/POINT;I)I", (void *)OS_NATIVE(MapWindowPoints__JJLorg_eclipse_swt_internal_win32_POINT_2I)},
+#endif
+#endif
+#if (!defined(NO_MapWindowPoints__IILorg_eclipse_swt_internal_win32_RECT_2I) && !defined(JNI64)) || (!defined(NO_MapWindowPoints__JJLorg_eclipse_swt_internal_win32_RECT_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MapWindowPoints", (char *)"(IILorg/eclipse/swt/internal/win32/RECT;I)I", (void *)OS_NATIVE(MapWindowPoints__IILorg_eclipse_swt_internal_win32_RECT_2I)},
+#else
+	{(char *)"MapWindowPoints", (char *)"(JJLorg/eclipse/swt/internal/win32/RECT;I)I", (void *)OS_NATIVE(MapWindowPoints__JJLorg_eclipse_swt_internal_win32_RECT_2I)},
+#endif
+#endif
+#ifndef NO_MessageBeep
+	{(char *)"MessageBeep", (char *)"(I)Z", (void *)OS_NATIVE(MessageBeep)},
+#endif
+#ifndef NO_MessageBoxA
+#ifndef JNI64
+	{(char *)"MessageBoxA", (char *)"(I[B[BI)I", (void *)OS_NATIVE(MessageBoxA)},
+#else
+	{(char *)"MessageBoxA", (char *)"(J[B[BI)I", (void *)OS_NATIVE(MessageBoxA)},
+#endif
+#endif
+#ifndef NO_MessageBoxW
+#ifndef JNI64
+	{(char *)"MessageBoxW", (char *)"(I[C[CI)I", (void *)OS_NATIVE(MessageBoxW)},
+#else
+	{(char *)"MessageBoxW", (char *)"(J[C[CI)I", (void *)OS_NATIVE(MessageBoxW)},
+#endif
+#endif
+#ifndef NO_ModifyWorldTransform
+#ifndef JNI64
+	{(char *)"ModifyWorldTransform", (char *)"(I[FI)Z", (void *)OS_NATIVE(ModifyWorldTransform)},
+#else
+	{(char *)"ModifyWorldTransform", (char *)"(J[FI)Z", (void *)OS_NATIVE(ModifyWorldTransform)},
+#endif
+#endif
+#ifndef NO_MonitorFromWindow
+#ifndef JNI64
+	{(char *)"MonitorFromWindow", (char *)"(II)I", (void *)OS_NATIVE(MonitorFromWindow)},
+#else
+	{(char *)"MonitorFromWindow", (char *)"(JI)J", (void *)OS_NATIVE(MonitorFromWindow)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__III) && !defined(JNI64)) || (!defined(NO_MoveMemory__JJI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(III)V", (void *)OS_NATIVE(MoveMemory__III)},
+#else
+	{(char *)"MoveMemory", (char *)"(JJI)V", (void *)OS_NATIVE(MoveMemory__JJI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_DEVMODEA_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_DEVMODEA_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/DEVMODEA;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_DEVMODEA_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/DEVMODEA;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_DEVMODEA_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_DEVMODEW_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_DEVMODEW_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/DEVMODEW;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_DEVMODEW_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/DEVMODEW;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_DEVMODEW_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/DOCHOSTUIINFO;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/DOCHOSTUIINFO;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_DROPFILES_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_DROPFILES_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/DROPFILES;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_DROPFILES_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/DROPFILES;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_DROPFILES_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_GESTURECONFIG_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_GESTURECONFIG_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/GESTURECONFIG;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_GESTURECONFIG_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/GESTURECONFIG;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_GESTURECONFIG_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_GRADIENT_1RECT_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_GRADIENT_1RECT_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/GRADIENT_RECT;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_GRADIENT_1RECT_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/GRADIENT_RECT;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_GRADIENT_1RECT_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_KEYBDINPUT_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_KEYBDINPUT_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/KEYBDINPUT;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_KEYBDINPUT_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/KEYBDINPUT;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_KEYBDINPUT_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_LOGFONTA_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_LOGFONTA_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/LOGFONTA;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_LOGFONTA_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/LOGFONTA;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_LOGFONTA_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_LOGFONTW_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_LOGFONTW_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/LOGFONTW;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_LOGFONTW_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/LOGFONTW;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_LOGFONTW_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/MEASUREITEMSTRUCT;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/MEASUREITEMSTRUCT;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_MINMAXINFO_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_MINMAXINFO_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/MINMAXINFO;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_MINMAXINFO_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/MINMAXINFO;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_MINMAXINFO_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_MOUSEINPUT_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_MOUSEINPUT_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/MOUSEINPUT;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_MOUSEINPUT_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/MOUSEINPUT;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_MOUSEINPUT_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_MSG_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_MSG_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/MSG;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_MSG_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/MSG;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_MSG_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/NMLVCUSTOMDRAW;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/NMLVCUSTOMDRAW;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_NMLVDISPINFO_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_NMLVDISPINFO_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/NMLVDISPINFO;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMLVDISPINFO_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/NMLVDISPINFO;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMLVDISPINFO_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/NMTTCUSTOMDRAW;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/NMTTCUSTOMDRAW;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/NMTTDISPINFOA;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/NMTTDISPINFOA;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/NMTTDISPINFOW;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/NMTTDISPINFOW;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/NMTVCUSTOMDRAW;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/NMTVCUSTOMDRAW;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_NMTVDISPINFO_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_NMTVDISPINFO_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/NMTVDISPINFO;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_NMTVDISPINFO_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/NMTVDISPINFO;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_NMTVDISPINFO_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_OPENFILENAME_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_OPENFILENAME_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/OPENFILENAME;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_OPENFILENAME_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/OPENFILENAME;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_OPENFILENAME_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_RECT_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_RECT_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_RECT_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_RECT_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_SAFEARRAY_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_SAFEARRAY_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/SAFEARRAY;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_SAFEARRAY_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/SAFEARRAY;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_SAFEARRAY_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/SHDRAGIMAGE;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/SHDRAGIMAGE;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_TRIVERTEX_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_TRIVERTEX_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/TRIVERTEX;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_TRIVERTEX_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/TRIVERTEX;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_TRIVERTEX_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_UDACCEL_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_UDACCEL_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/UDACCEL;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_UDACCEL_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/UDACCEL;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_UDACCEL_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__ILorg_eclipse_swt_internal_win32_WINDOWPOS_2I) && !defined(JNI64)) || (!defined(NO_MoveMemory__JLorg_eclipse_swt_internal_win32_WINDOWPOS_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(ILorg/eclipse/swt/internal/win32/WINDOWPOS;I)V", (void *)OS_NATIVE(MoveMemory__ILorg_eclipse_swt_internal_win32_WINDOWPOS_2I)},
+#else
+	{(char *)"MoveMemory", (char *)"(JLorg/eclipse/swt/internal/win32/WINDOWPOS;I)V", (void *)OS_NATIVE(MoveMemory__JLorg_eclipse_swt_internal_win32_WINDOWPOS_2I)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__I_3BI) && !defined(JNI64)) || (!defined(NO_MoveMemory__J_3BI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(I[BI)V", (void *)OS_NATIVE(MoveMemory__I_3BI)},
+#else
+	{(char *)"MoveMemory", (char *)"(J[BI)V", (void *)OS_NATIVE(MoveMemory__J_3BI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__I_3CI) && !defined(JNI64)) || (!defined(NO_MoveMemory__J_3CI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(I[CI)V", (void *)OS_NATIVE(MoveMemory__I_3CI)},
+#else
+	{(char *)"MoveMemory", (char *)"(J[CI)V", (void *)OS_NATIVE(MoveMemory__J_3CI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__I_3DI) && !defined(JNI64)) || (!defined(NO_MoveMemory__J_3DI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(I[DI)V", (void *)OS_NATIVE(MoveMemory__I_3DI)},
+#else
+	{(char *)"MoveMemory", (char *)"(J[DI)V", (void *)OS_NATIVE(MoveMemory__J_3DI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__I_3FI) && !defined(JNI64)) || (!defined(NO_MoveMemory__J_3FI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(I[FI)V", (void *)OS_NATIVE(MoveMemory__I_3FI)},
+#else
+	{(char *)"MoveMemory", (char *)"(J[FI)V", (void *)OS_NATIVE(MoveMemory__J_3FI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__I_3II) && !defined(JNI64)) || (!defined(NO_MoveMemory__J_3II) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(I[II)V", (void *)OS_NATIVE(MoveMemory__I_3II)},
+#else
+	{(char *)"MoveMemory", (char *)"(J[II)V", (void *)OS_NATIVE(MoveMemory__J_3II)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__I_3JI) && !defined(JNI64)) || (!defined(NO_MoveMemory__J_3JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(I[JI)V", (void *)OS_NATIVE(MoveMemory__I_3JI)},
+#else
+	{(char *)"MoveMemory", (char *)"(J[JI)V", (void *)OS_NATIVE(MoveMemory__J_3JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__I_3SI) && !defined(JNI64)) || (!defined(NO_MoveMemory__J_3SI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(I[SI)V", (void *)OS_NATIVE(MoveMemory__I_3SI)},
+#else
+	{(char *)"MoveMemory", (char *)"(J[SI)V", (void *)OS_NATIVE(MoveMemory__J_3SI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/BITMAPINFOHEADER;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/BITMAPINFOHEADER;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2JI)},
+#endif
+#endif
+#ifndef NO_MoveMemory__Lorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2_3BI
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/BITMAPINFOHEADER;[BI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2_3BI)},
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1CONTEXT_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1CONTEXT_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/CERT_CONTEXT;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1CONTEXT_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/CERT_CONTEXT;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1CONTEXT_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1INFO_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1INFO_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/CERT_INFO;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1INFO_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/CERT_INFO;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_CERT_1INFO_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEA_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEA_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/DEVMODEA;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEA_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/DEVMODEA;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEA_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEW_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/DEVMODEW;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEW_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/DEVMODEW;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DEVMODEW_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/DOCHOSTUIINFO;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/DOCHOSTUIINFO;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DOCHOSTUIINFO_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DRAWITEMSTRUCT_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_DRAWITEMSTRUCT_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/DRAWITEMSTRUCT;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DRAWITEMSTRUCT_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/DRAWITEMSTRUCT;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_DRAWITEMSTRUCT_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_EMREXTCREATEFONTINDIRECTW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_EMREXTCREATEFONTINDIRECTW_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/EMREXTCREATEFONTINDIRECTW;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EMREXTCREATEFONTINDIRECTW_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/EMREXTCREATEFONTINDIRECTW;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EMREXTCREATEFONTINDIRECTW_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_EMR_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_EMR_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/EMR;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EMR_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/EMR;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EMR_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_EXTLOGPEN_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_EXTLOGPEN_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/EXTLOGPEN;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EXTLOGPEN_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/EXTLOGPEN;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_EXTLOGPEN_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1DATA_2_3II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1DATA_2_3JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/FLICK_DATA;[II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1DATA_2_3II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/FLICK_DATA;[JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1DATA_2_3JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1POINT_2_3II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1POINT_2_3JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/FLICK_POINT;[II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1POINT_2_3II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/FLICK_POINT;[JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_FLICK_1POINT_2_3JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_HDITEM_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_HDITEM_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/HDITEM;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_HDITEM_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/HDITEM;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_HDITEM_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_HELPINFO_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_HELPINFO_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/HELPINFO;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_HELPINFO_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/HELPINFO;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_HELPINFO_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTA_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTA_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/LOGFONTA;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTA_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/LOGFONTA;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTA_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTW_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/LOGFONTW;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTW_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/LOGFONTW;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_LOGFONTW_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/MEASUREITEMSTRUCT;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/MEASUREITEMSTRUCT;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MEASUREITEMSTRUCT_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_MINMAXINFO_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_MINMAXINFO_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/MINMAXINFO;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MINMAXINFO_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/MINMAXINFO;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MINMAXINFO_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_MSG_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_MSG_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/MSG;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MSG_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/MSG;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_MSG_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMCUSTOMDRAW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMCUSTOMDRAW_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMCUSTOMDRAW;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMCUSTOMDRAW_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMCUSTOMDRAW;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMCUSTOMDRAW_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMHDR_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMHDR_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMHDR;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMHDR_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMHDR;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMHDR_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMHEADER_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMHEADER_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMHEADER;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMHEADER_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMHEADER;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMHEADER_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLINK_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLINK_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMLINK;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLINK_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMLINK;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLINK_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLISTVIEW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLISTVIEW_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMLISTVIEW;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLISTVIEW_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMLISTVIEW;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLISTVIEW_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMLVCUSTOMDRAW;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMLVCUSTOMDRAW;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVCUSTOMDRAW_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVDISPINFO_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVDISPINFO_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMLVDISPINFO;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVDISPINFO_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMLVDISPINFO;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVDISPINFO_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVFINDITEM_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVFINDITEM_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMLVFINDITEM;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVFINDITEM_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMLVFINDITEM;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVFINDITEM_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVODSTATECHANGE_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVODSTATECHANGE_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMLVODSTATECHANGE;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVODSTATECHANGE_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMLVODSTATECHANGE;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMLVODSTATECHANGE_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHEVRON_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHEVRON_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMREBARCHEVRON;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHEVRON_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMREBARCHEVRON;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHEVRON_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHILDSIZE_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHILDSIZE_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMREBARCHILDSIZE;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHILDSIZE_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMREBARCHILDSIZE;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMREBARCHILDSIZE_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMRGINFO_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMRGINFO_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMRGINFO;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMRGINFO_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMRGINFO;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMRGINFO_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTBHOTITEM_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTBHOTITEM_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTBHOTITEM;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTBHOTITEM_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTBHOTITEM;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTBHOTITEM_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTOOLBAR_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTOOLBAR_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTOOLBAR;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTOOLBAR_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTOOLBAR;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTOOLBAR_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTREEVIEW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTREEVIEW_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTREEVIEW;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTREEVIEW_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTREEVIEW;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTREEVIEW_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTTCUSTOMDRAW;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTTCUSTOMDRAW;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTCUSTOMDRAW_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTTDISPINFOA;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTTDISPINFOA;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOA_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTTDISPINFOW;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTTDISPINFOW;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTTDISPINFOW_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTVCUSTOMDRAW;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTVCUSTOMDRAW;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVCUSTOMDRAW_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVDISPINFO_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVDISPINFO_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTVDISPINFO;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVDISPINFO_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTVDISPINFO;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVDISPINFO_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVITEMCHANGE_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVITEMCHANGE_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTVITEMCHANGE;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVITEMCHANGE_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMTVITEMCHANGE;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMTVITEMCHANGE_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMUPDOWN_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_NMUPDOWN_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMUPDOWN;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMUPDOWN_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/NMUPDOWN;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_NMUPDOWN_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_OFNOTIFY_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_OFNOTIFY_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/OFNOTIFY;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_OFNOTIFY_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/OFNOTIFY;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_OFNOTIFY_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_OPENFILENAME_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_OPENFILENAME_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/OPENFILENAME;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_OPENFILENAME_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/OPENFILENAME;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_OPENFILENAME_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_POINT_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_POINT_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/POINT;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_POINT_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/POINT;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_POINT_2JI)},
+#endif
+#endif
+#ifndef NO_MoveMemory__Lorg_eclipse_swt_internal_win32_POINT_2_3JI
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/POINT;[JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_POINT_2_3JI)},
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_RECT_2_3II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_RECT_2_3JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/RECT;[II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_RECT_2_3II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/RECT;[JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_RECT_2_3JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SAFEARRAY_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SAFEARRAY_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/SAFEARRAY;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SAFEARRAY_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/SAFEARRAY;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SAFEARRAY_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1ITEM_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1ITEM_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/SCRIPT_ITEM;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1ITEM_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/SCRIPT_ITEM;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1ITEM_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1LOGATTR_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1LOGATTR_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/SCRIPT_LOGATTR;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1LOGATTR_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/SCRIPT_LOGATTR;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1LOGATTR_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1PROPERTIES_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1PROPERTIES_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/SCRIPT_PROPERTIES;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1PROPERTIES_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/SCRIPT_PROPERTIES;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SCRIPT_1PROPERTIES_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/SHDRAGIMAGE;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/SHDRAGIMAGE;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICA_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICA_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/TEXTMETRICA;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICA_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/TEXTMETRICA;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICA_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICW_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICW_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/TEXTMETRICW;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICW_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/TEXTMETRICW;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TEXTMETRICW_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TOUCHINPUT_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TOUCHINPUT_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/TOUCHINPUT;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TOUCHINPUT_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/TOUCHINPUT;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TOUCHINPUT_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TVITEM_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_TVITEM_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/TVITEM;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TVITEM_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/TVITEM;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_TVITEM_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_UDACCEL_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_UDACCEL_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/UDACCEL;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_UDACCEL_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/UDACCEL;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_UDACCEL_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_WINDOWPOS_2II) && !defined(JNI64)) || (!defined(NO_MoveMemory__Lorg_eclipse_swt_internal_win32_WINDOWPOS_2JI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/WINDOWPOS;II)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_WINDOWPOS_2II)},
+#else
+	{(char *)"MoveMemory", (char *)"(Lorg/eclipse/swt/internal/win32/WINDOWPOS;JI)V", (void *)OS_NATIVE(MoveMemory__Lorg_eclipse_swt_internal_win32_WINDOWPOS_2JI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory___3BII) && !defined(JNI64)) || (!defined(NO_MoveMemory___3BJI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"([BII)V", (void *)OS_NATIVE(MoveMemory___3BII)},
+#else
+	{(char *)"MoveMemory", (char *)"([BJI)V", (void *)OS_NATIVE(MoveMemory___3BJI)},
+#endif
+#endif
+#ifndef NO_MoveMemory___3BLorg_eclipse_swt_internal_win32_ACCEL_2I
+	{(char *)"MoveMemory", (char *)"([BLorg/eclipse/swt/internal/win32/ACCEL;I)V", (void *)OS_NATIVE(MoveMemory___3BLorg_eclipse_swt_internal_win32_ACCEL_2I)},
+#endif
+#ifndef NO_MoveMemory___3BLorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2I
+	{(char *)"MoveMemory", (char *)"([BLorg/eclipse/swt/internal/win32/BITMAPINFOHEADER;I)V", (void *)OS_NATIVE(MoveMemory___3BLorg_eclipse_swt_internal_win32_BITMAPINFOHEADER_2I)},
+#endif
+#if (!defined(NO_MoveMemory___3CII) && !defined(JNI64)) || (!defined(NO_MoveMemory___3CJI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"([CII)V", (void *)OS_NATIVE(MoveMemory___3CII)},
+#else
+	{(char *)"MoveMemory", (char *)"([CJI)V", (void *)OS_NATIVE(MoveMemory___3CJI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory___3DII) && !defined(JNI64)) || (!defined(NO_MoveMemory___3DJI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"([DII)V", (void *)OS_NATIVE(MoveMemory___3DII)},
+#else
+	{(char *)"MoveMemory", (char *)"([DJI)V", (void *)OS_NATIVE(MoveMemory___3DJI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory___3FII) && !defined(JNI64)) || (!defined(NO_MoveMemory___3FJI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"([FII)V", (void *)OS_NATIVE(MoveMemory___3FII)},
+#else
+	{(char *)"MoveMemory", (char *)"([FJI)V", (void *)OS_NATIVE(MoveMemory___3FJI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory___3III) && !defined(JNI64)) || (!defined(NO_MoveMemory___3IJI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"([III)V", (void *)OS_NATIVE(MoveMemory___3III)},
+#else
+	{(char *)"MoveMemory", (char *)"([IJI)V", (void *)OS_NATIVE(MoveMemory___3IJI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory___3JII) && !defined(JNI64)) || (!defined(NO_MoveMemory___3JJI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"([JII)V", (void *)OS_NATIVE(MoveMemory___3JII)},
+#else
+	{(char *)"MoveMemory", (char *)"([JJI)V", (void *)OS_NATIVE(MoveMemory___3JJI)},
+#endif
+#endif
+#if (!defined(NO_MoveMemory___3SII) && !defined(JNI64)) || (!defined(NO_MoveMemory___3SJI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MoveMemory", (char *)"([SII)V", (void *)OS_NATIVE(MoveMemory___3SII)},
+#else
+	{(char *)"MoveMemory", (char *)"([SJI)V", (void *)OS_NATIVE(MoveMemory___3SJI)},
+#endif
+#endif
+#ifndef NO_MoveToEx
+#ifndef JNI64
+	{(char *)"MoveToEx", (char *)"(IIII)Z", (void *)OS_NATIVE(MoveToEx)},
+#else
+	{(char *)"MoveToEx", (char *)"(JIIJ)Z", (void *)OS_NATIVE(MoveToEx)},
+#endif
+#endif
+#ifndef NO_MsgWaitForMultipleObjectsEx
+#ifndef JNI64
+	{(char *)"MsgWaitForMultipleObjectsEx", (char *)"(IIIII)I", (void *)OS_NATIVE(MsgWaitForMultipleObjectsEx)},
+#else
+	{(char *)"MsgWaitForMultipleObjectsEx", (char *)"(IJIII)I", (void *)OS_NATIVE(MsgWaitForMultipleObjectsEx)},
+#endif
+#endif
+#if (!defined(NO_MultiByteToWideChar__IIII_3CI) && !defined(JNI64)) || (!defined(NO_MultiByteToWideChar__IIJI_3CI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"MultiByteToWideChar", (char *)"(IIII[CI)I", (void *)OS_NATIVE(MultiByteToWideChar__IIII_3CI)},
+#else
+	{(char *)"MultiByteToWideChar", (char *)"(IIJI[CI)I", (void *)OS_NATIVE(MultiByteToWideChar__IIJI_3CI)},
+#endif
+#endif
+#ifndef NO_MultiByteToWideChar__II_3BI_3CI
+	{(char *)"MultiByteToWideChar", (char *)"(II[BI[CI)I", (void *)OS_NATIVE(MultiByteToWideChar__II_3BI_3CI)},
+#endif
+#ifndef NO_NMCUSTOMDRAW_1sizeof
+	{(char *)"NMCUSTOMDRAW_sizeof", (char *)"()I", (void *)OS_NATIVE(NMCUSTOMDRAW_1sizeof)},
+#endif
+#ifndef NO_NMHDR_1sizeof
+	{(char *)"NMHDR_sizeof", (char *)"()I", (void *)OS_NATIVE(NMHDR_1sizeof)},
+#endif
+#ifndef NO_NMHEADER_1sizeof
+	{(char *)"NMHEADER_sizeof", (char *)"()I", (void *)OS_NATIVE(NMHEADER_1sizeof)},
+#endif
+#ifndef NO_NMLINK_1sizeof
+	{(char *)"NMLINK_sizeof", (char *)"()I", (void *)OS_NATIVE(NMLINK_1sizeof)},
+#endif
+#ifndef NO_NMLISTVIEW_1sizeof
+	{(char *)"NMLISTVIEW_sizeof", (char *)"()I", (void *)OS_NATIVE(NMLISTVIEW_1sizeof)},
+#endif
+#ifndef NO_NMLVCUSTOMDRAW_1sizeof
+	{(char *)"NMLVCUSTOMDRAW_sizeof", (char *)"()I", (void *)OS_NATIVE(NMLVCUSTOMDRAW_1sizeof)},
+#endif
+#ifndef NO_NMLVDISPINFO_1sizeof
+	{(char *)"NMLVDISPINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(NMLVDISPINFO_1sizeof)},
+#endif
+#ifndef NO_NMLVFINDITEM_1sizeof
+	{(char *)"NMLVFINDITEM_sizeof", (char *)"()I", (void *)OS_NATIVE(NMLVFINDITEM_1sizeof)},
+#endif
+#ifndef NO_NMLVODSTATECHANGE_1sizeof
+	{(char *)"NMLVODSTATECHANGE_sizeof", (char *)"()I", (void *)OS_NATIVE(NMLVODSTATECHANGE_1sizeof)},
+#endif
+#ifndef NO_NMREBARCHEVRON_1sizeof
+	{(char *)"NMREBARCHEVRON_sizeof", (char *)"()I", (void *)OS_NATIVE(NMREBARCHEVRON_1sizeof)},
+#endif
+#ifndef NO_NMREBARCHILDSIZE_1sizeof
+	{(char *)"NMREBARCHILDSIZE_sizeof", (char *)"()I", (void *)OS_NATIVE(NMREBARCHILDSIZE_1sizeof)},
+#endif
+#ifndef NO_NMRGINFO_1sizeof
+	{(char *)"NMRGINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(NMRGINFO_1sizeof)},
+#endif
+#ifndef NO_NMTBHOTITEM_1sizeof
+	{(char *)"NMTBHOTITEM_sizeof", (char *)"()I", (void *)OS_NATIVE(NMTBHOTITEM_1sizeof)},
+#endif
+#ifndef NO_NMTOOLBAR_1sizeof
+	{(char *)"NMTOOLBAR_sizeof", (char *)"()I", (void *)OS_NATIVE(NMTOOLBAR_1sizeof)},
+#endif
+#ifndef NO_NMTREEVIEW_1sizeof
+	{(char *)"NMTREEVIEW_sizeof", (char *)"()I", (void *)OS_NATIVE(NMTREEVIEW_1sizeof)},
+#endif
+#ifndef NO_NMTTCUSTOMDRAW_1sizeof
+	{(char *)"NMTTCUSTOMDRAW_sizeof", (char *)"()I", (void *)OS_NATIVE(NMTTCUSTOMDRAW_1sizeof)},
+#endif
+#ifndef NO_NMTTDISPINFOA_1sizeof
+	{(char *)"NMTTDISPINFOA_sizeof", (char *)"()I", (void *)OS_NATIVE(NMTTDISPINFOA_1sizeof)},
+#endif
+#ifndef NO_NMTTDISPINFOW_1sizeof
+	{(char *)"NMTTDISPINFOW_sizeof", (char *)"()I", (void *)OS_NATIVE(NMTTDISPINFOW_1sizeof)},
+#endif
+#ifndef NO_NMTVCUSTOMDRAW_1sizeof
+	{(char *)"NMTVCUSTOMDRAW_sizeof", (char *)"()I", (void *)OS_NATIVE(NMTVCUSTOMDRAW_1sizeof)},
+#endif
+#ifndef NO_NMTVDISPINFO_1sizeof
+	{(char *)"NMTVDISPINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(NMTVDISPINFO_1sizeof)},
+#endif
+#ifndef NO_NMTVITEMCHANGE_1sizeof
+	{(char *)"NMTVITEMCHANGE_sizeof", (char *)"()I", (void *)OS_NATIVE(NMTVITEMCHANGE_1sizeof)},
+#endif
+#ifndef NO_NMUPDOWN_1sizeof
+	{(char *)"NMUPDOWN_sizeof", (char *)"()I", (void *)OS_NATIVE(NMUPDOWN_1sizeof)},
+#endif
+#ifndef NO_NONCLIENTMETRICSA_1sizeof
+	{(char *)"NONCLIENTMETRICSA_sizeof", (char *)"()I", (void *)OS_NATIVE(NONCLIENTMETRICSA_1sizeof)},
+#endif
+#ifndef NO_NONCLIENTMETRICSW_1sizeof
+	{(char *)"NONCLIENTMETRICSW_sizeof", (char *)"()I", (void *)OS_NATIVE(NONCLIENTMETRICSW_1sizeof)},
+#endif
+#ifndef NO_NOTIFYICONDATAA_1V2_1SIZE
+	{(char *)"NOTIFYICONDATAA_V2_SIZE", (char *)"()I", (void *)OS_NATIVE(NOTIFYICONDATAA_1V2_1SIZE)},
+#endif
+#ifndef NO_NOTIFYICONDATAW_1V2_1SIZE
+	{(char *)"NOTIFYICONDATAW_V2_SIZE", (char *)"()I", (void *)OS_NATIVE(NOTIFYICONDATAW_1V2_1SIZE)},
+#endif
+#ifndef NO_NotifyWinEvent
+#ifndef JNI64
+	{(char *)"NotifyWinEvent", (char *)"(IIII)V", (void *)OS_NATIVE(NotifyWinEvent)},
+#else
+	{(char *)"NotifyWinEvent", (char *)"(IJII)V", (void *)OS_NATIVE(NotifyWinEvent)},
+#endif
+#endif
+#ifndef NO_OFNOTIFY_1sizeof
+	{(char *)"OFNOTIFY_sizeof", (char *)"()I", (void *)OS_NATIVE(OFNOTIFY_1sizeof)},
+#endif
+#ifndef NO_OPENFILENAME_1sizeof
+	{(char *)"OPENFILENAME_sizeof", (char *)"()I", (void *)OS_NATIVE(OPENFILENAME_1sizeof)},
+#endif
+#ifndef NO_OSVERSIONINFOA_1sizeof
+	{(char *)"OSVERSIONINFOA_sizeof", (char *)"()I", (void *)OS_NATIVE(OSVERSIONINFOA_1sizeof)},
+#endif
+#ifndef NO_OSVERSIONINFOEXA_1sizeof
+	{(char *)"OSVERSIONINFOEXA_sizeof", (char *)"()I", (void *)OS_NATIVE(OSVERSIONINFOEXA_1sizeof)},
+#endif
+#ifndef NO_OSVERSIONINFOEXW_1sizeof
+	{(char *)"OSVERSIONINFOEXW_sizeof", (char *)"()I", (void *)OS_NATIVE(OSVERSIONINFOEXW_1sizeof)},
+#endif
+#ifndef NO_OSVERSIONINFOW_1sizeof
+	{(char *)"OSVERSIONINFOW_sizeof", (char *)"()I", (void *)OS_NATIVE(OSVERSIONINFOW_1sizeof)},
+#endif
+#ifndef NO_OUTLINETEXTMETRICA_1sizeof
+	{(char *)"OUTLINETEXTMETRICA_sizeof", (char *)"()I", (void *)OS_NATIVE(OUTLINETEXTMETRICA_1sizeof)},
+#endif
+#ifndef NO_OUTLINETEXTMETRICW_1sizeof
+	{(char *)"OUTLINETEXTMETRICW_sizeof", (char *)"()I", (void *)OS_NATIVE(OUTLINETEXTMETRICW_1sizeof)},
+#endif
+#ifndef NO_OffsetRect
+	{(char *)"OffsetRect", (char *)"(Lorg/eclipse/swt/internal/win32/RECT;II)Z", (void *)OS_NATIVE(OffsetRect)},
+#endif
+#ifndef NO_OffsetRgn
+#ifndef JNI64
+	{(char *)"OffsetRgn", (char *)"(III)I", (void *)OS_NATIVE(OffsetRgn)},
+#else
+	{(char *)"OffsetRgn", (char *)"(JII)I", (void *)OS_NATIVE(OffsetRgn)},
+#endif
+#endif
+#ifndef NO_OleInitialize
+#ifndef JNI64
+	{(char *)"OleInitialize", (char *)"(I)I", (void *)OS_NATIVE(OleInitialize)},
+#else
+	{(char *)"OleInitialize", (char *)"(J)I", (void *)OS_NATIVE(OleInitialize)},
+#endif
+#endif
+#ifndef NO_OleUninitialize
+	{(char *)"OleUninitialize", (char *)"()V", (void *)OS_NATIVE(OleUninitialize)},
+#endif
+#ifndef NO_OpenClipboard
+#ifndef JNI64
+	{(char *)"OpenClipboard", (char *)"(I)Z", (void *)OS_NATIVE(OpenClipboard)},
+#else
+	{(char *)"OpenClipboard", (char *)"(J)Z", (void *)OS_NATIVE(OpenClipboard)},
+#endif
+#endif
+#ifndef NO_OpenPrinterA
+#ifndef JNI64
+	{(char *)"OpenPrinterA", (char *)"([B[II)Z", (void *)OS_NATIVE(OpenPrinterA)},
+#else
+	{(char *)"OpenPrinterA", (char *)"([B[JJ)Z", (void *)OS_NATIVE(OpenPrinterA)},
+#endif
+#endif
+#ifndef NO_OpenPrinterW
+#ifndef JNI64
+	{(char *)"OpenPrinterW", (char *)"([C[II)Z", (void *)OS_NATIVE(OpenPrinterW)},
+#else
+	{(char *)"OpenPrinterW", (char *)"([C[JJ)Z", (void *)OS_NATIVE(OpenPrinterW)},
+#endif
+#endif
+#ifndef NO_OpenProcess
+#ifndef JNI64
+	{(char *)"OpenProcess", (char *)"(IZI)I", (void *)OS_NATIVE(OpenProcess)},
+#else
+	{(char *)"OpenProcess", (char *)"(IZI)J", (void *)OS_NATIVE(OpenProcess)},
+#endif
+#endif
+#ifndef NO_OpenThemeData
+#ifndef JNI64
+	{(char *)"OpenThemeData", (char *)"(I[C)I", (void *)OS_NATIVE(OpenThemeData)},
+#else
+	{(char *)"OpenThemeData", (char *)"(J[C)J", (void *)OS_NATIVE(OpenThemeData)},
+#endif
+#endif
+#ifndef NO_PAINTSTRUCT_1sizeof
+	{(char *)"PAINTSTRUCT_sizeof", (char *)"()I", (void *)OS_NATIVE(PAINTSTRUCT_1sizeof)},
+#endif
+#ifndef NO_PANOSE_1sizeof
+	{(char *)"PANOSE_sizeof", (char *)"()I", (void *)OS_NATIVE(PANOSE_1sizeof)},
+#endif
+#ifndef NO_POINTSTOPOINT
+#ifndef JNI64
+	{(char *)"POINTSTOPOINT", (char *)"(Lorg/eclipse/swt/internal/win32/POINT;I)V", (void *)OS_NATIVE(POINTSTOPOINT)},
+#else
+	{(char *)"POINTSTOPOINT", (char *)"(Lorg/eclipse/swt/internal/win32/POINT;J)V", (void *)OS_NATIVE(POINTSTOPOINT)},
+#endif
+#endif
+#ifndef NO_POINT_1sizeof
+	{(char *)"POINT_sizeof", (char *)"()I", (void *)OS_NATIVE(POINT_1sizeof)},
+#endif
+#ifndef NO_PRIMARYLANGID
+	{(char *)"PRIMARYLANGID", (char *)"(I)S", (void *)OS_NATIVE(PRIMARYLANGID)},
+#endif
+#ifndef NO_PRINTDLG_1sizeof
+	{(char *)"PRINTDLG_sizeof", (char *)"()I", (void *)OS_NATIVE(PRINTDLG_1sizeof)},
+#endif
+#ifndef NO_PROCESS_1INFORMATION_1sizeof
+	{(char *)"PROCESS_INFORMATION_sizeof", (char *)"()I", (void *)OS_NATIVE(PROCESS_1INFORMATION_1sizeof)},
+#endif
+#ifndef NO_PROPERTYKEY_1sizeof
+	{(char *)"PROPERTYKEY_sizeof", (char *)"()I", (void *)OS_NATIVE(PROPERTYKEY_1sizeof)},
+#endif
+#ifndef NO_PROPVARIANT_1sizeof
+	{(char *)"PROPVARIANT_sizeof", (char *)"()I", (void *)OS_NATIVE(PROPVARIANT_1sizeof)},
+#endif
+#ifndef NO_PSPropertyKeyFromString
+	{(char *)"PSPropertyKeyFromString", (char *)"([CLorg/eclipse/swt/internal/win32/PROPERTYKEY;)I", (void *)OS_NATIVE(PSPropertyKeyFromString)},
+#endif
+#ifndef NO_PatBlt
+#ifndef JNI64
+	{(char *)"PatBlt", (char *)"(IIIIII)Z", (void *)OS_NATIVE(PatBlt)},
+#else
+	{(char *)"PatBlt", (char *)"(JIIIII)Z", (void *)OS_NATIVE(PatBlt)},
+#endif
+#endif
+#ifndef NO_PathIsExe
+#ifndef JNI64
+	{(char *)"PathIsExe", (char *)"(I)Z", (void *)OS_NATIVE(PathIsExe)},
+#else
+	{(char *)"PathIsExe", (char *)"(J)Z", (void *)OS_NATIVE(PathIsExe)},
+#endif
+#endif
+#ifndef NO_PeekMessageA
+#ifndef JNI64
+	{(char *)"PeekMessageA", (char *)"(Lorg/eclipse/swt/internal/win32/MSG;IIII)Z", (void *)OS_NATIVE(PeekMessageA)},
+#else
+	{(char *)"PeekMessageA", (char *)"(Lorg/eclipse/swt/internal/win32/MSG;JIII)Z", (void *)OS_NATIVE(PeekMessageA)},
+#endif
+#endif
+#ifndef NO_PeekMessageW
+#ifndef JNI64
+	{(char *)"PeekMessageW", (char *)"(Lorg/eclipse/swt/internal/win32/MSG;IIII)Z", (void *)OS_NATIVE(PeekMessageW)},
+#else
+	{(char *)"PeekMessageW", (char *)"(Lorg/eclipse/swt/internal/win32/MSG;JIII)Z", (void *)OS_NATIVE(PeekMessageW)},
+#endif
+#endif
+#ifndef NO_Pie
+#ifndef JNI64
+	{(char *)"Pie", (char *)"(IIIIIIIII)Z", (void *)OS_NATIVE(Pie)},
+#else
+	{(char *)"Pie", (char *)"(JIIIIIIII)Z", (void *)OS_NATIVE(Pie)},
+#endif
+#endif
+#ifndef NO_Polygon
+#ifndef JNI64
+	{(char *)"Polygon", (char *)"(I[II)Z", (void *)OS_NATIVE(Polygon)},
+#else
+	{(char *)"Polygon", (char *)"(J[II)Z", (void *)OS_NATIVE(Polygon)},
+#endif
+#endif
+#ifndef NO_Polyline
+#ifndef JNI64
+	{(char *)"Polyline", (char *)"(I[II)Z", (void *)OS_NATIVE(Polyline)},
+#else
+	{(char *)"Polyline", (char *)"(J[II)Z", (void *)OS_NATIVE(Polyline)},
+#endif
+#endif
+#ifndef NO_PostMessageA
+#ifndef JNI64
+	{(char *)"PostMessageA", (char *)"(IIII)Z", (void *)OS_NATIVE(PostMessageA)},
+#else
+	{(char *)"PostMessageA", (char *)"(JIJJ)Z", (void *)OS_NATIVE(PostMessageA)},
+#endif
+#endif
+#ifndef NO_PostMessageW
+#ifndef JNI64
+	{(char *)"PostMessageW", (char *)"(IIII)Z", (void *)OS_NATIVE(PostMessageW)},
+#else
+	{(char *)"PostMessageW", (char *)"(JIJJ)Z", (void *)OS_NATIVE(PostMessageW)},
+#endif
+#endif
+#ifndef NO_PostThreadMessageA
+#ifndef JNI64
+	{(char *)"PostThreadMessageA", (char *)"(IIII)Z", (void *)OS_NATIVE(PostThreadMessageA)},
+#else
+	{(char *)"PostThreadMessageA", (char *)"(IIJJ)Z", (void *)OS_NATIVE(PostThreadMessageA)},
+#endif
+#endif
+#ifndef NO_PostThreadMessageW
+#ifndef JNI64
+	{(char *)"PostThreadMessageW", (char *)"(IIII)Z", (void *)OS_NATIVE(PostThreadMessageW)},
+#else
+	{(char *)"PostThreadMessageW", (char *)"(IIJJ)Z", (void *)OS_NATIVE(PostThreadMessageW)},
+#endif
+#endif
+#ifndef NO_PrintDlgA
+	{(char *)"PrintDlgA", (char *)"(Lorg/eclipse/swt/internal/win32/PRINTDLG;)Z", (void *)OS_NATIVE(PrintDlgA)},
+#endif
+#ifndef NO_PrintDlgW
+	{(char *)"PrintDlgW", (char *)"(Lorg/eclipse/swt/internal/win32/PRINTDLG;)Z", (void *)OS_NATIVE(PrintDlgW)},
+#endif
+#ifndef NO_PrintWindow
+#ifndef JNI64
+	{(char *)"PrintWindow", (char *)"(III)Z", (void *)OS_NATIVE(PrintWindow)},
+#else
+	{(char *)"PrintWindow", (char *)"(JJI)Z", (void *)OS_NATIVE(PrintWindow)},
+#endif
+#endif
+#ifndef NO_PtInRect
+	{(char *)"PtInRect", (char *)"(Lorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(PtInRect)},
+#endif
+#ifndef NO_PtInRegion
+#ifndef JNI64
+	{(char *)"PtInRegion", (char *)"(III)Z", (void *)OS_NATIVE(PtInRegion)},
+#else
+	{(char *)"PtInRegion", (char *)"(JII)Z", (void *)OS_NATIVE(PtInRegion)},
+#endif
+#endif
+#ifndef NO_REBARBANDINFO_1sizeof
+	{(char *)"REBARBANDINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(REBARBANDINFO_1sizeof)},
+#endif
+#ifndef NO_RECT_1sizeof
+	{(char *)"RECT_sizeof", (char *)"()I", (void *)OS_NATIVE(RECT_1sizeof)},
+#endif
+#ifndef NO_RealizePalette
+#ifndef JNI64
+	{(char *)"RealizePalette", (char *)"(I)I", (void *)OS_NATIVE(RealizePalette)},
+#else
+	{(char *)"RealizePalette", (char *)"(J)I", (void *)OS_NATIVE(RealizePalette)},
+#endif
+#endif
+#ifndef NO_RectInRegion
+#ifndef JNI64
+	{(char *)"RectInRegion", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(RectInRegion)},
+#else
+	{(char *)"RectInRegion", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(RectInRegion)},
+#endif
+#endif
+#ifndef NO_Rectangle
+#ifndef JNI64
+	{(char *)"Rectangle", (char *)"(IIIII)Z", (void *)OS_NATIVE(Rectangle)},
+#else
+	{(char *)"Rectangle", (char *)"(JIIII)Z", (void *)OS_NATIVE(Rectangle)},
+#endif
+#endif
+#ifndef NO_RedrawWindow
+#ifndef JNI64
+	{(char *)"RedrawWindow", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;II)Z", (void *)OS_NATIVE(RedrawWindow)},
+#else
+	{(char *)"RedrawWindow", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;JI)Z", (void *)OS_NATIVE(RedrawWindow)},
+#endif
+#endif
+#ifndef NO_RegCloseKey
+#ifndef JNI64
+	{(char *)"RegCloseKey", (char *)"(I)I", (void *)OS_NATIVE(RegCloseKey)},
+#else
+	{(char *)"RegCloseKey", (char *)"(J)I", (void *)OS_NATIVE(RegCloseKey)},
+#endif
+#endif
+#ifndef NO_RegCreateKeyExA
+#ifndef JNI64
+	{(char *)"RegCreateKeyExA", (char *)"(I[BI[BIII[I[I)I", (void *)OS_NATIVE(RegCreateKeyExA)},
+#else
+	{(char *)"RegCreateKeyExA", (char *)"(J[BI[BIIJ[J[J)I", (void *)OS_NATIVE(RegCreateKeyExA)},
+#endif
+#endif
+#ifndef NO_RegCreateKeyExW
+#ifndef JNI64
+	{(char *)"RegCreateKeyExW", (char *)"(I[CI[CIII[I[I)I", (void *)OS_NATIVE(RegCreateKeyExW)},
+#else
+	{(char *)"RegCreateKeyExW", (char *)"(J[CI[CIIJ[J[J)I", (void *)OS_NATIVE(RegCreateKeyExW)},
+#endif
+#endif
+#ifndef NO_RegDeleteValueA
+#ifndef JNI64
+	{(char *)"RegDeleteValueA", (char *)"(I[B)I", (void *)OS_NATIVE(RegDeleteValueA)},
+#else
+	{(char *)"RegDeleteValueA", (char *)"(J[B)I", (void *)OS_NATIVE(RegDeleteValueA)},
+#endif
+#endif
+#ifndef NO_RegDeleteValueW
+#ifndef JNI64
+	{(char *)"RegDeleteValueW", (char *)"(I[C)I", (void *)OS_NATIVE(RegDeleteValueW)},
+#else
+	{(char *)"RegDeleteValueW", (char *)"(J[C)I", (void *)OS_NATIVE(RegDeleteValueW)},
+#endif
+#endif
+#ifndef NO_RegEnumKeyExA
+#ifndef JNI64
+	{(char *)"RegEnumKeyExA", (char *)"(II[B[I[I[B[ILorg/eclipse/swt/internal/win32/FILETIME;)I", (void *)OS_NATIVE(RegEnumKeyExA)},
+#else
+	{(char *)"RegEnumKeyExA", (char *)"(JI[B[I[I[B[ILorg/eclipse/swt/internal/win32/FILETIME;)I", (void *)OS_NATIVE(RegEnumKeyExA)},
+#endif
+#endif
+#ifndef NO_RegEnumKeyExW
+#ifndef JNI64
+	{(char *)"RegEnumKeyExW", (char *)"(II[C[I[I[C[ILorg/eclipse/swt/internal/win32/FILETIME;)I", (void *)OS_NATIVE(RegEnumKeyExW)},
+#else
+	{(char *)"RegEnumKeyExW", (char *)"(JI[C[I[I[C[ILorg/eclipse/swt/internal/win32/FILETIME;)I", (void *)OS_NATIVE(RegEnumKeyExW)},
+#endif
+#endif
+#ifndef NO_RegOpenKeyExA
+#ifndef JNI64
+	{(char *)"RegOpenKeyExA", (char *)"(I[BII[I)I", (void *)OS_NATIVE(RegOpenKeyExA)},
+#else
+	{(char *)"RegOpenKeyExA", (char *)"(J[BII[J)I", (void *)OS_NATIVE(RegOpenKeyExA)},
+#endif
+#endif
+#ifndef NO_RegOpenKeyExW
+#ifndef JNI64
+	{(char *)"RegOpenKeyExW", (char *)"(I[CII[I)I", (void *)OS_NATIVE(RegOpenKeyExW)},
+#else
+	{(char *)"RegOpenKeyExW", (char *)"(J[CII[J)I", (void *)OS_NATIVE(RegOpenKeyExW)},
+#endif
+#endif
+#ifndef NO_RegQueryInfoKeyA
+#ifndef JNI64
+	{(char *)"RegQueryInfoKeyA", (char *)"(II[II[I[I[I[I[I[I[II)I", (void *)OS_NATIVE(RegQueryInfoKeyA)},
+#else
+	{(char *)"RegQueryInfoKeyA", (char *)"(JJ[IJ[I[I[I[I[I[I[IJ)I", (void *)OS_NATIVE(RegQueryInfoKeyA)},
+#endif
+#endif
+#ifndef NO_RegQueryInfoKeyW
+#ifndef JNI64
+	{(char *)"RegQueryInfoKeyW", (char *)"(II[II[I[I[I[I[I[I[II)I", (void *)OS_NATIVE(RegQueryInfoKeyW)},
+#else
+	{(char *)"RegQueryInfoKeyW", (char *)"(JJ[IJ[I[I[I[I[I[I[IJ)I", (void *)OS_NATIVE(RegQueryInfoKeyW)},
+#endif
+#endif
+#if (!defined(NO_RegQueryValueExA__I_3BI_3I_3B_3I) && !defined(JNI64)) || (!defined(NO_RegQueryValueExA__J_3BJ_3I_3B_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"RegQueryValueExA", (char *)"(I[BI[I[B[I)I", (void *)OS_NATIVE(RegQueryValueExA__I_3BI_3I_3B_3I)},
+#else
+	{(char *)"RegQueryValueExA", (char *)"(J[BJ[I[B[I)I", (void *)OS_NATIVE(RegQueryValueExA__J_3BJ_3I_3B_3I)},
+#endif
+#endif
+#if (!defined(NO_RegQueryValueExA__I_3BI_3I_3I_3I) && !defined(JNI64)) || (!defined(NO_RegQueryValueExA__J_3BJ_3I_3I_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"RegQueryValueExA", (char *)"(I[BI[I[I[I)I", (void *)OS_NATIVE(RegQueryValueExA__I_3BI_3I_3I_3I)},
+#else
+	{(char *)"RegQueryValueExA", (char *)"(J[BJ[I[I[I)I", (void *)OS_NATIVE(RegQueryValueExA__J_3BJ_3I_3I_3I)},
+#endif
+#endif
+#if (!defined(NO_RegQueryValueExW__I_3CI_3I_3C_3I) && !defined(JNI64)) || (!defined(NO_RegQueryValueExW__J_3CJ_3I_3C_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"RegQueryValueExW", (char *)"(I[CI[I[C[I)I", (void *)OS_NATIVE(RegQueryValueExW__I_3CI_3I_3C_3I)},
+#else
+	{(char *)"RegQueryValueExW", (char *)"(J[CJ[I[C[I)I", (void *)OS_NATIVE(RegQueryValueExW__J_3CJ_3I_3C_3I)},
+#endif
+#endif
+#if (!defined(NO_RegQueryValueExW__I_3CI_3I_3I_3I) && !defined(JNI64)) || (!defined(NO_RegQueryValueExW__J_3CJ_3I_3I_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"RegQueryValueExW", (char *)"(I[CI[I[I[I)I", (void *)OS_NATIVE(RegQueryValueExW__I_3CI_3I_3I_3I)},
+#else
+	{(char *)"RegQueryValueExW", (char *)"(J[CJ[I[I[I)I", (void *)OS_NATIVE(RegQueryValueExW__J_3CJ_3I_3I_3I)},
+#endif
+#endif
+#ifndef NO_RegSetValueExA
+#ifndef JNI64
+	{(char *)"RegSetValueExA", (char *)"(I[BII[II)I", (void *)OS_NATIVE(RegSetValueExA)},
+#else
+	{(char *)"RegSetValueExA", (char *)"(J[BII[II)I", (void *)OS_NATIVE(RegSetValueExA)},
+#endif
+#endif
+#ifndef NO_RegSetValueExW
+#ifndef JNI64
+	{(char *)"RegSetValueExW", (char *)"(I[CII[II)I", (void *)OS_NATIVE(RegSetValueExW)},
+#else
+	{(char *)"RegSetValueExW", (char *)"(J[CII[II)I", (void *)OS_NATIVE(RegSetValueExW)},
+#endif
+#endif
+#ifndef NO_RegisterClassA
+	{(char *)"RegisterClassA", (char *)"(Lorg/eclipse/swt/internal/win32/WNDCLASS;)I", (void *)OS_NATIVE(RegisterClassA)},
+#endif
+#ifndef NO_RegisterClassW
+	{(char *)"RegisterClassW", (char *)"(Lorg/eclipse/swt/internal/win32/WNDCLASS;)I", (void *)OS_NATIVE(RegisterClassW)},
+#endif
+#ifndef NO_RegisterClipboardFormatA
+	{(char *)"RegisterClipboardFormatA", (char *)"([B)I", (void *)OS_NATIVE(RegisterClipboardFormatA)},
+#endif
+#ifndef NO_RegisterClipboardFormatW
+	{(char *)"RegisterClipboardFormatW", (char *)"([C)I", (void *)OS_NATIVE(RegisterClipboardFormatW)},
+#endif
+#ifndef NO_RegisterTouchWindow
+#ifndef JNI64
+	{(char *)"RegisterTouchWindow", (char *)"(II)Z", (void *)OS_NATIVE(RegisterTouchWindow)},
+#else
+	{(char *)"RegisterTouchWindow", (char *)"(JI)Z", (void *)OS_NATIVE(RegisterTouchWindow)},
+#endif
+#endif
+#ifndef NO_RegisterWindowMessageA
+	{(char *)"RegisterWindowMessageA", (char *)"([B)I", (void *)OS_NATIVE(RegisterWindowMessageA)},
+#endif
+#ifndef NO_RegisterWindowMessageW
+	{(char *)"RegisterWindowMessageW", (char *)"([C)I", (void *)OS_NATIVE(RegisterWindowMessageW)},
+#endif
+#ifndef NO_ReleaseCapture
+	{(char *)"ReleaseCapture", (char *)"()Z", (void *)OS_NATIVE(ReleaseCapture)},
+#endif
+#ifndef NO_ReleaseDC
+#ifndef JNI64
+	{(char *)"ReleaseDC", (char *)"(II)I", (void *)OS_NATIVE(ReleaseDC)},
+#else
+	{(char *)"ReleaseDC", (char *)"(JJ)I", (void *)OS_NATIVE(ReleaseDC)},
+#endif
+#endif
+#ifndef NO_RemoveMenu
+#ifndef JNI64
+	{(char *)"RemoveMenu", (char *)"(III)Z", (void *)OS_NATIVE(RemoveMenu)},
+#else
+	{(char *)"RemoveMenu", (char *)"(JII)Z", (void *)OS_NATIVE(RemoveMenu)},
+#endif
+#endif
+#ifndef NO_RemovePropA
+#ifndef JNI64
+	{(char *)"RemovePropA", (char *)"(II)I", (void *)OS_NATIVE(RemovePropA)},
+#else
+	{(char *)"RemovePropA", (char *)"(JJ)J", (void *)OS_NATIVE(RemovePropA)},
+#endif
+#endif
+#ifndef NO_RemovePropW
+#ifndef JNI64
+	{(char *)"RemovePropW", (char *)"(II)I", (void *)OS_NATIVE(RemovePropW)},
+#else
+	{(char *)"RemovePropW", (char *)"(JJ)J", (void *)OS_NATIVE(RemovePropW)},
+#endif
+#endif
+#ifndef NO_ReplyMessage
+#ifndef JNI64
+	{(char *)"ReplyMessage", (char *)"(I)Z", (void *)OS_NATIVE(ReplyMessage)},
+#else
+	{(char *)"ReplyMessage", (char *)"(J)Z", (void *)OS_NATIVE(ReplyMessage)},
+#endif
+#endif
+#ifndef NO_RestoreDC
+#ifndef JNI64
+	{(char *)"RestoreDC", (char *)"(II)Z", (void *)OS_NATIVE(RestoreDC)},
+#else
+	{(char *)"RestoreDC", (char *)"(JI)Z", (void *)OS_NATIVE(RestoreDC)},
+#endif
+#endif
+#ifndef NO_RoundRect
+#ifndef JNI64
+	{(char *)"RoundRect", (char *)"(IIIIIII)Z", (void *)OS_NATIVE(RoundRect)},
+#else
+	{(char *)"RoundRect", (char *)"(JIIIIII)Z", (void *)OS_NATIVE(RoundRect)},
+#endif
+#endif
+#ifndef NO_SAFEARRAYBOUND_1sizeof
+	{(char *)"SAFEARRAYBOUND_sizeof", (char *)"()I", (void *)OS_NATIVE(SAFEARRAYBOUND_1sizeof)},
+#endif
+#ifndef NO_SAFEARRAY_1sizeof
+	{(char *)"SAFEARRAY_sizeof", (char *)"()I", (void *)OS_NATIVE(SAFEARRAY_1sizeof)},
+#endif
+#ifndef NO_SCRIPT_1ANALYSIS_1sizeof
+	{(char *)"SCRIPT_ANALYSIS_sizeof", (char *)"()I", (void *)OS_NATIVE(SCRIPT_1ANALYSIS_1sizeof)},
+#endif
+#ifndef NO_SCRIPT_1CONTROL_1sizeof
+	{(char *)"SCRIPT_CONTROL_sizeof", (char *)"()I", (void *)OS_NATIVE(SCRIPT_1CONTROL_1sizeof)},
+#endif
+#ifndef NO_SCRIPT_1DIGITSUBSTITUTE_1sizeof
+	{(char *)"SCRIPT_DIGITSUBSTITUTE_sizeof", (char *)"()I", (void *)OS_NATIVE(SCRIPT_1DIGITSUBSTITUTE_1sizeof)},
+#endif
+#ifndef NO_SCRIPT_1FONTPROPERTIES_1sizeof
+	{(char *)"SCRIPT_FONTPROPERTIES_sizeof", (char *)"()I", (void *)OS_NATIVE(SCRIPT_1FONTPROPERTIES_1sizeof)},
+#endif
+#ifndef NO_SCRIPT_1ITEM_1sizeof
+	{(char *)"SCRIPT_ITEM_sizeof", (char *)"()I", (void *)OS_NATIVE(SCRIPT_1ITEM_1sizeof)},
+#endif
+#ifndef NO_SCRIPT_1LOGATTR_1sizeof
+	{(char *)"SCRIPT_LOGATTR_sizeof", (char *)"()I", (void *)OS_NATIVE(SCRIPT_1LOGATTR_1sizeof)},
+#endif
+#ifndef NO_SCRIPT_1PROPERTIES_1sizeof
+	{(char *)"SCRIPT_PROPERTIES_sizeof", (char *)"()I", (void *)OS_NATIVE(SCRIPT_1PROPERTIES_1sizeof)},
+#endif
+#ifndef NO_SCRIPT_1STATE_1sizeof
+	{(char *)"SCRIPT_STATE_sizeof", (char *)"()I", (void *)OS_NATIVE(SCRIPT_1STATE_1sizeof)},
+#endif
+#ifndef NO_SCRIPT_1STRING_1ANALYSIS_1sizeof
+	{(char *)"SCRIPT_STRING_ANALYSIS_sizeof", (char *)"()I", (void *)OS_NATIVE(SCRIPT_1STRING_1ANALYSIS_1sizeof)},
+#endif
+#ifndef NO_SCROLLBARINFO_1sizeof
+	{(char *)"SCROLLBARINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(SCROLLBARINFO_1sizeof)},
+#endif
+#ifndef NO_SCROLLINFO_1sizeof
+	{(char *)"SCROLLINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(SCROLLINFO_1sizeof)},
+#endif
+#ifndef NO_SHACTIVATEINFO_1sizeof
+	{(char *)"SHACTIVATEINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(SHACTIVATEINFO_1sizeof)},
+#endif
+#ifndef NO_SHBrowseForFolderA
+#ifndef JNI64
+	{(char *)"SHBrowseForFolderA", (char *)"(Lorg/eclipse/swt/internal/win32/BROWSEINFO;)I", (void *)OS_NATIVE(SHBrowseForFolderA)},
+#else
+	{(char *)"SHBrowseForFolderA", (char *)"(Lorg/eclipse/swt/internal/win32/BROWSEINFO;)J", (void *)OS_NATIVE(SHBrowseForFolderA)},
+#endif
+#endif
+#ifndef NO_SHBrowseForFolderW
+#ifndef JNI64
+	{(char *)"SHBrowseForFolderW", (char *)"(Lorg/eclipse/swt/internal/win32/BROWSEINFO;)I", (void *)OS_NATIVE(SHBrowseForFolderW)},
+#else
+	{(char *)"SHBrowseForFolderW", (char *)"(Lorg/eclipse/swt/internal/win32/BROWSEINFO;)J", (void *)OS_NATIVE(SHBrowseForFolderW)},
+#endif
+#endif
+#ifndef NO_SHCreateItemFromRelativeName
+#ifndef JNI64
+	{(char *)"SHCreateItemFromRelativeName", (char *)"(I[CI[B[I)I", (void *)OS_NATIVE(SHCreateItemFromRelativeName)},
+#else
+	{(char *)"SHCreateItemFromRelativeName", (char *)"(J[CJ[B[J)I", (void *)OS_NATIVE(SHCreateItemFromRelativeName)},
+#endif
+#endif
+#ifndef NO_SHCreateItemInKnownFolder
+#ifndef JNI64
+	{(char *)"SHCreateItemInKnownFolder", (char *)"([BI[C[B[I)I", (void *)OS_NATIVE(SHCreateItemInKnownFolder)},
+#else
+	{(char *)"SHCreateItemInKnownFolder", (char *)"([BI[C[B[J)I", (void *)OS_NATIVE(SHCreateItemInKnownFolder)},
+#endif
+#endif
+#ifndef NO_SHCreateMenuBar
+	{(char *)"SHCreateMenuBar", (char *)"(Lorg/eclipse/swt/internal/win32/SHMENUBARINFO;)Z", (void *)OS_NATIVE(SHCreateMenuBar)},
+#endif
+#ifndef NO_SHDRAGIMAGE_1sizeof
+	{(char *)"SHDRAGIMAGE_sizeof", (char *)"()I", (void *)OS_NATIVE(SHDRAGIMAGE_1sizeof)},
+#endif
+#ifndef NO_SHELLEXECUTEINFO_1sizeof
+	{(char *)"SHELLEXECUTEINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(SHELLEXECUTEINFO_1sizeof)},
+#endif
+#ifndef NO_SHFILEINFOA_1sizeof
+	{(char *)"SHFILEINFOA_sizeof", (char *)"()I", (void *)OS_NATIVE(SHFILEINFOA_1sizeof)},
+#endif
+#ifndef NO_SHFILEINFOW_1sizeof
+	{(char *)"SHFILEINFOW_sizeof", (char *)"()I", (void *)OS_NATIVE(SHFILEINFOW_1sizeof)},
+#endif
+#ifndef NO_SHGetFileInfoA
+#ifndef JNI64
+	{(char *)"SHGetFileInfoA", (char *)"([BILorg/eclipse/swt/internal/win32/SHFILEINFOA;II)I", (void *)OS_NATIVE(SHGetFileInfoA)},
+#else
+	{(char *)"SHGetFileInfoA", (char *)"([BILorg/eclipse/swt/internal/win32/SHFILEINFOA;II)J", (void *)OS_NATIVE(SHGetFileInfoA)},
+#endif
+#endif
+#ifndef NO_SHGetFileInfoW
+#ifndef JNI64
+	{(char *)"SHGetFileInfoW", (char *)"([CILorg/eclipse/swt/internal/win32/SHFILEINFOW;II)I", (void *)OS_NATIVE(SHGetFileInfoW)},
+#else
+	{(char *)"SHGetFileInfoW", (char *)"([CILorg/eclipse/swt/internal/win32/SHFILEINFOW;II)J", (void *)OS_NATIVE(SHGetFileInfoW)},
+#endif
+#endif
+#ifndef NO_SHGetFolderPathA
+#ifndef JNI64
+	{(char *)"SHGetFolderPathA", (char *)"(IIII[B)I", (void *)OS_NATIVE(SHGetFolderPathA)},
+#else
+	{(char *)"SHGetFolderPathA", (char *)"(JIJI[B)I", (void *)OS_NATIVE(SHGetFolderPathA)},
+#endif
+#endif
+#ifndef NO_SHGetFolderPathW
+#ifndef JNI64
+	{(char *)"SHGetFolderPathW", (char *)"(IIII[C)I", (void *)OS_NATIVE(SHGetFolderPathW)},
+#else
+	{(char *)"SHGetFolderPathW", (char *)"(JIJI[C)I", (void *)OS_NATIVE(SHGetFolderPathW)},
+#endif
+#endif
+#ifndef NO_SHGetMalloc
+#ifndef JNI64
+	{(char *)"SHGetMalloc", (char *)"([I)I", (void *)OS_NATIVE(SHGetMalloc)},
+#else
+	{(char *)"SHGetMalloc", (char *)"([J)I", (void *)OS_NATIVE(SHGetMalloc)},
+#endif
+#endif
+#ifndef NO_SHGetPathFromIDListA
+#ifndef JNI64
+	{(char *)"SHGetPathFromIDListA", (char *)"(I[B)Z", (void *)OS_NATIVE(SHGetPathFromIDListA)},
+#else
+	{(char *)"SHGetPathFromIDListA", (char *)"(J[B)Z", (void *)OS_NATIVE(SHGetPathFromIDListA)},
+#endif
+#endif
+#ifndef NO_SHGetPathFromIDListW
+#ifndef JNI64
+	{(char *)"SHGetPathFromIDListW", (char *)"(I[C)Z", (void *)OS_NATIVE(SHGetPathFromIDListW)},
+#else
+	{(char *)"SHGetPathFromIDListW", (char *)"(J[C)Z", (void *)OS_NATIVE(SHGetPathFromIDListW)},
+#endif
+#endif
+#ifndef NO_SHHandleWMSettingChange
+#ifndef JNI64
+	{(char *)"SHHandleWMSettingChange", (char *)"(IIILorg/eclipse/swt/internal/win32/SHACTIVATEINFO;)Z", (void *)OS_NATIVE(SHHandleWMSettingChange)},
+#else
+	{(char *)"SHHandleWMSettingChange", (char *)"(JJJLorg/eclipse/swt/internal/win32/SHACTIVATEINFO;)Z", (void *)OS_NATIVE(SHHandleWMSettingChange)},
+#endif
+#endif
+#ifndef NO_SHMENUBARINFO_1sizeof
+	{(char *)"SHMENUBARINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(SHMENUBARINFO_1sizeof)},
+#endif
+#ifndef NO_SHRGINFO_1sizeof
+	{(char *)"SHRGINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(SHRGINFO_1sizeof)},
+#endif
+#ifndef NO_SHRecognizeGesture
+	{(char *)"SHRecognizeGesture", (char *)"(Lorg/eclipse/swt/internal/win32/SHRGINFO;)I", (void *)OS_NATIVE(SHRecognizeGesture)},
+#endif
+#ifndef NO_SHSendBackToFocusWindow
+#ifndef JNI64
+	{(char *)"SHSendBackToFocusWindow", (char *)"(III)V", (void *)OS_NATIVE(SHSendBackToFocusWindow)},
+#else
+	{(char *)"SHSendBackToFocusWindow", (char *)"(IJJ)V", (void *)OS_NATIVE(SHSendBackToFocusWindow)},
+#endif
+#endif
+#ifndef NO_SHSetAppKeyWndAssoc
+#ifndef JNI64
+	{(char *)"SHSetAppKeyWndAssoc", (char *)"(BI)Z", (void *)OS_NATIVE(SHSetAppKeyWndAssoc)},
+#else
+	{(char *)"SHSetAppKeyWndAssoc", (char *)"(BJ)Z", (void *)OS_NATIVE(SHSetAppKeyWndAssoc)},
+#endif
+#endif
+#ifndef NO_SHSipPreference
+#ifndef JNI64
+	{(char *)"SHSipPreference", (char *)"(II)Z", (void *)OS_NATIVE(SHSipPreference)},
+#else
+	{(char *)"SHSipPreference", (char *)"(JI)Z", (void *)OS_NATIVE(SHSipPreference)},
+#endif
+#endif
+#ifndef NO_SIPINFO_1sizeof
+	{(char *)"SIPINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(SIPINFO_1sizeof)},
+#endif
+#ifndef NO_SIZE_1sizeof
+	{(char *)"SIZE_sizeof", (char *)"()I", (void *)OS_NATIVE(SIZE_1sizeof)},
+#endif
+#ifndef NO_STARTUPINFO_1sizeof
+	{(char *)"STARTUPINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(STARTUPINFO_1sizeof)},
+#endif
+#ifndef NO_SYSTEMTIME_1sizeof
+	{(char *)"SYSTEMTIME_sizeof", (char *)"()I", (void *)OS_NATIVE(SYSTEMTIME_1sizeof)},
+#endif
+#ifndef NO_SaveDC
+#ifndef JNI64
+	{(char *)"SaveDC", (char *)"(I)I", (void *)OS_NATIVE(SaveDC)},
+#else
+	{(char *)"SaveDC", (char *)"(J)I", (void *)OS_NATIVE(SaveDC)},
+#endif
+#endif
+#ifndef NO_ScreenToClient
+#ifndef JNI64
+	{(char *)"ScreenToClient", (char *)"(ILorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(ScreenToClient)},
+#else
+	{(char *)"ScreenToClient", (char *)"(JLorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(ScreenToClient)},
+#endif
+#endif
+#ifndef NO_ScriptApplyDigitSubstitution
+	{(char *)"ScriptApplyDigitSubstitution", (char *)"(Lorg/eclipse/swt/internal/win32/SCRIPT_DIGITSUBSTITUTE;Lorg/eclipse/swt/internal/win32/SCRIPT_CONTROL;Lorg/eclipse/swt/internal/win32/SCRIPT_STATE;)I", (void *)OS_NATIVE(ScriptApplyDigitSubstitution)},
+#endif
+#ifndef NO_ScriptBreak
+#ifndef JNI64
+	{(char *)"ScriptBreak", (char *)"([CILorg/eclipse/swt/internal/win32/SCRIPT_ANALYSIS;I)I", (void *)OS_NATIVE(ScriptBreak)},
+#else
+	{(char *)"ScriptBreak", (char *)"([CILorg/eclipse/swt/internal/win32/SCRIPT_ANALYSIS;J)I", (void *)OS_NATIVE(ScriptBreak)},
+#endif
+#endif
+#ifndef NO_ScriptCPtoX
+#ifndef JNI64
+	{(char *)"ScriptCPtoX", (char *)"(IZIIIIILorg/eclipse/swt/internal/win32/SCRIPT_ANALYSIS;[I)I", (void *)OS_NATIVE(ScriptCPtoX)},
+#else
+	{(char *)"ScriptCPtoX", (char *)"(IZIIJJJLorg/eclipse/swt/internal/win32/SCRIPT_ANALYSIS;[I)I", (void *)OS_NATIVE(ScriptCPtoX)},
+#endif
+#endif
+#ifndef NO_ScriptCacheGetHeight
+#ifndef JNI64
+	{(char *)"ScriptCacheGetHeight", (char *)"(II[I)I", (void *)OS_NATIVE(ScriptCacheGetHeight)},
+#else
+	{(char *)"ScriptCacheGetHeight", (char *)"(JJ[I)I", (void *)OS_NATIVE(ScriptCacheGetHeight)},
+#endif
+#endif
+#ifndef NO_ScriptFreeCache
+#ifndef JNI64
+	{(char *)"ScriptFreeCache", (char *)"(I)I", (void *)OS_NATIVE(ScriptFreeCache)},
+#else
+	{(char *)"ScriptFreeCache", (char *)"(J)I", (void *)OS_NATIVE(ScriptFreeCache)},
+#endif
+#endif
+#ifndef NO_ScriptGetCMap
+#ifndef JNI64
+	{(char *)"ScriptGetCMap", (char *)"(II[CII[S)I", (void *)OS_NATIVE(ScriptGetCMap)},
+#else
+	{(char *)"ScriptGetCMap", (char *)"(JJ[CII[S)I", (void *)OS_NATIVE(ScriptGetCMap)},
+#endif
+#endif
+#ifndef NO_ScriptGetFontProperties
+#ifndef JNI64
+	{(char *)"ScriptGetFontProperties", (char *)"(IILorg/eclipse/swt/internal/win32/SCRIPT_FONTPROPERTIES;)I", (void *)OS_NATIVE(ScriptGetFontProperties)},
+#else
+	{(char *)"ScriptGetFontProperties", (char *)"(JJLorg/eclipse/swt/internal/win32/SCRIPT_FONTPROPERTIES;)I", (void *)OS_NATIVE(ScriptGetFontProperties)},
+#endif
+#endif
+#ifndef NO_ScriptGetLogicalWidths
+#ifndef JNI64
+	{(char *)"ScriptGetLogicalWidths", (char *)"(Lorg/eclipse/swt/internal/win32/SCRIPT_ANALYSIS;IIIII[I)I", (void *)OS_NATIVE(ScriptGetLogicalWidths)},
+#else
+	{(char *)"ScriptGetLogicalWidths", (char *)"(Lorg/eclipse/swt/internal/win32/SCRIPT_ANALYSIS;IIJJJ[I)I", (void *)OS_NATIVE(ScriptGetLogicalWidths)},
+#endif
+#endif
+#ifndef NO_ScriptGetProperties
+#ifndef JNI64
+	{(char *)"ScriptGetProperties", (char *)"([I[I)I", (void *)OS_NATIVE(ScriptGetProperties)},
+#else
+	{(char *)"ScriptGetProperties", (char *)"([J[I)I", (void *)OS_NATIVE(ScriptGetProperties)},
+#endif
+#endif
+#ifndef NO_ScriptItemize
+#ifndef JNI64
+	{(char *)"ScriptItemize", (char *)"([CIILorg/eclipse/swt/internal/win32/SCRIPT_CONTROL;Lorg/eclipse/swt/internal/win32/SCRIPT_STATE;I[I)I", (void *)OS_NATIVE(ScriptItemize)},
+#else
+	{(char *)"ScriptItemize", (char *)"([CIILorg/eclipse/swt/internal/win32/SCRIPT_CONTROL;Lorg/eclipse/swt/internal/win32/SCRIPT_STATE;J[I)I", (void *)OS_NATIVE(ScriptItemize)},
+#endif
+#endif
+#ifndef NO_ScriptJustify
+#ifndef JNI64
+	{(char *)"ScriptJustify", (char *)"(IIIIII)I", (void *)OS_NATIVE(ScriptJustify)},
+#else
+	{(char *)"ScriptJustify", (char *)"(JJIIIJ)I", (void *)OS_NATIVE(ScriptJustify)},
+#endif
+#endif
+#ifndef NO_ScriptLayout
+	{(char *)"ScriptLayout", (char *)"(I[B[I[I)I", (void *)OS_NATIVE(ScriptLayout)},
+#endif
+#ifndef NO_ScriptPlace
+#ifndef JNI64
+	{(char *)"ScriptPlace", (char *)"(IIIIILorg/eclipse/swt/internal/win32/SCRIPT_ANALYSIS;II[I)I", (void *)OS_NATIVE(ScriptPlace)},
+#else
+	{(char *)"ScriptPlace", (char *)"(JJJIJLorg/eclipse/swt/internal/win32/SCRIPT_ANALYSIS;JJ[I)I", (void *)OS_NATIVE(ScriptPlace)},
+#endif
+#endif
+#ifndef NO_ScriptRecordDigitSubstitution
+	{(char *)"ScriptRecordDigitSubstitution", (char *)"(ILorg/eclipse/swt/internal/win32/SCRIPT_DIGITSUBSTITUTE;)I", (void *)OS_NATIVE(ScriptRecordDigitSubstitution)},
+#endif
+#ifndef NO_ScriptShape
+#ifndef JNI64
+	{(char *)"ScriptShape", (char *)"(II[CIILorg/eclipse/swt/internal/win32/SCRIPT_ANALYSIS;III[I)I", (void *)OS_NATIVE(ScriptShape)},
+#else
+	{(char *)"ScriptShape", (char *)"(JJ[CIILorg/eclipse/swt/internal/win32/SCRIPT_ANALYSIS;JJJ[I)I", (void *)OS_NATIVE(ScriptShape)},
+#endif
+#endif
+#ifndef NO_ScriptStringAnalyse
+#ifndef JNI64
+	{(char *)"ScriptStringAnalyse", (char *)"(I[CIIIIILorg/eclipse/swt/internal/win32/SCRIPT_CONTROL;Lorg/eclipse/swt/internal/win32/SCRIPT_STATE;IIII)I", (void *)OS_NATIVE(ScriptStringAnalyse)},
+#else
+	{(char *)"ScriptStringAnalyse", (char *)"(J[CIIIIILorg/eclipse/swt/internal/win32/SCRIPT_CONTROL;Lorg/eclipse/swt/internal/win32/SCRIPT_STATE;JJJJ)I", (void *)OS_NATIVE(ScriptStringAnalyse)},
+#endif
+#endif
+#ifndef NO_ScriptStringFree
+#ifndef JNI64
+	{(char *)"ScriptStringFree", (char *)"(I)I", (void *)OS_NATIVE(ScriptStringFree)},
+#else
+	{(char *)"ScriptStringFree", (char *)"(J)I", (void *)OS_NATIVE(ScriptStringFree)},
+#endif
+#endif
+#ifndef NO_ScriptStringOut
+#ifndef JNI64
+	{(char *)"ScriptStringOut", (char *)"(IIIILorg/eclipse/swt/internal/win32/RECT;IIZ)I", (void *)OS_NATIVE(ScriptStringOut)},
+#else
+	{(char *)"ScriptStringOut", (char *)"(JIIILorg/eclipse/swt/internal/win32/RECT;IIZ)I", (void *)OS_NATIVE(ScriptStringOut)},
+#endif
+#endif
+#ifndef NO_ScriptTextOut
+#ifndef JNI64
+	{(char *)"ScriptTextOut", (char *)"(IIIIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/SCRIPT_ANALYSIS;IIIIIII)I", (void *)OS_NATIVE(ScriptTextOut)},
+#else
+	{(char *)"ScriptTextOut", (char *)"(JJIIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/SCRIPT_ANALYSIS;JIJIJJJ)I", (void *)OS_NATIVE(ScriptTextOut)},
+#endif
+#endif
+#ifndef NO_ScriptXtoCP
+#ifndef JNI64
+	{(char *)"ScriptXtoCP", (char *)"(IIIIIILorg/eclipse/swt/internal/win32/SCRIPT_ANALYSIS;[I[I)I", (void *)OS_NATIVE(ScriptXtoCP)},
+#else
+	{(char *)"ScriptXtoCP", (char *)"(IIIJJJLorg/eclipse/swt/internal/win32/SCRIPT_ANALYSIS;[I[I)I", (void *)OS_NATIVE(ScriptXtoCP)},
+#endif
+#endif
+#ifndef NO_ScrollWindowEx
+#ifndef JNI64
+	{(char *)"ScrollWindowEx", (char *)"(IIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/RECT;ILorg/eclipse/swt/internal/win32/RECT;I)I", (void *)OS_NATIVE(ScrollWindowEx)},
+#else
+	{(char *)"ScrollWindowEx", (char *)"(JIILorg/eclipse/swt/internal/win32/RECT;Lorg/eclipse/swt/internal/win32/RECT;JLorg/eclipse/swt/internal/win32/RECT;I)I", (void *)OS_NATIVE(ScrollWindowEx)},
+#endif
+#endif
+#ifndef NO_SelectClipRgn
+#ifndef JNI64
+	{(char *)"SelectClipRgn", (char *)"(II)I", (void *)OS_NATIVE(SelectClipRgn)},
+#else
+	{(char *)"SelectClipRgn", (char *)"(JJ)I", (void *)OS_NATIVE(SelectClipRgn)},
+#endif
+#endif
+#ifndef NO_SelectObject
+#ifndef JNI64
+	{(char *)"SelectObject", (char *)"(II)I", (void *)OS_NATIVE(SelectObject)},
+#else
+	{(char *)"SelectObject", (char *)"(JJ)J", (void *)OS_NATIVE(SelectObject)},
+#endif
+#endif
+#ifndef NO_SelectPalette
+#ifndef JNI64
+	{(char *)"SelectPalette", (char *)"(IIZ)I", (void *)OS_NATIVE(SelectPalette)},
+#else
+	{(char *)"SelectPalette", (char *)"(JJZ)J", (void *)OS_NATIVE(SelectPalette)},
+#endif
+#endif
+#ifndef NO_SendInput
+#ifndef JNI64
+	{(char *)"SendInput", (char *)"(III)I", (void *)OS_NATIVE(SendInput)},
+#else
+	{(char *)"SendInput", (char *)"(IJI)I", (void *)OS_NATIVE(SendInput)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIII) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIII)I", (void *)OS_NATIVE(SendMessageA__IIII)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJJ)J", (void *)OS_NATIVE(SendMessageA__JIJJ)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/BUTTON_IMAGELIST;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/BUTTON_IMAGELIST;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_HDHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_HDHITTESTINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/HDHITTESTINFO;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_HDHITTESTINFO_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/HDHITTESTINFO;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_HDHITTESTINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_HDITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_HDITEM_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/HDITEM;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_HDITEM_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/HDITEM;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_HDITEM_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_HDLAYOUT_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_HDLAYOUT_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/HDLAYOUT;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_HDLAYOUT_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/HDLAYOUT;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_HDLAYOUT_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_LITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_LITEM_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/LITEM;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_LITEM_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/LITEM;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_LITEM_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_LVCOLUMN_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVCOLUMN_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/LVCOLUMN;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_LVCOLUMN_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/LVCOLUMN;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVCOLUMN_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_LVHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVHITTESTINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/LVHITTESTINFO;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_LVHITTESTINFO_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/LVHITTESTINFO;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVHITTESTINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_LVINSERTMARK_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVINSERTMARK_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/LVINSERTMARK;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_LVINSERTMARK_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/LVINSERTMARK;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVINSERTMARK_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_LVITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVITEM_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/LVITEM;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_LVITEM_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/LVITEM;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_LVITEM_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_MARGINS_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_MARGINS_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/MARGINS;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_MARGINS_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/MARGINS;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_MARGINS_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_MCHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_MCHITTESTINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/MCHITTESTINFO;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_MCHITTESTINFO_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/MCHITTESTINFO;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_MCHITTESTINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_POINT_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_POINT_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/POINT;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_POINT_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/POINT;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_POINT_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_REBARBANDINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_REBARBANDINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/REBARBANDINFO;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_REBARBANDINFO_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/REBARBANDINFO;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_REBARBANDINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_RECT_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_RECT_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_RECT_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/RECT;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_RECT_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/SHDRAGIMAGE;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/SHDRAGIMAGE;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_SIZE_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_SIZE_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/SIZE;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_SIZE_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/SIZE;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_SIZE_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_SYSTEMTIME_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_SYSTEMTIME_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/SYSTEMTIME;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_SYSTEMTIME_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/SYSTEMTIME;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_SYSTEMTIME_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TBBUTTONINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TBBUTTONINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/TBBUTTONINFO;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TBBUTTONINFO_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/TBBUTTONINFO;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TBBUTTONINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TBBUTTON_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TBBUTTON_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/TBBUTTON;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TBBUTTON_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/TBBUTTON;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TBBUTTON_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TCHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TCHITTESTINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/TCHITTESTINFO;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TCHITTESTINFO_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/TCHITTESTINFO;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TCHITTESTINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TCITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TCITEM_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/TCITEM;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TCITEM_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/TCITEM;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TCITEM_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TOOLINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TOOLINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/TOOLINFO;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TOOLINFO_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/TOOLINFO;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TOOLINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TVHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVHITTESTINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/TVHITTESTINFO;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TVHITTESTINFO_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/TVHITTESTINFO;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVHITTESTINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/TVINSERTSTRUCT;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/TVINSERTSTRUCT;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TVITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVITEM_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/TVITEM;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TVITEM_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/TVITEM;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVITEM_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_TVSORTCB_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVSORTCB_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/TVSORTCB;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_TVSORTCB_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/TVSORTCB;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_TVSORTCB_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__IIILorg_eclipse_swt_internal_win32_UDACCEL_2) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJLorg_eclipse_swt_internal_win32_UDACCEL_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(IIILorg/eclipse/swt/internal/win32/UDACCEL;)I", (void *)OS_NATIVE(SendMessageA__IIILorg_eclipse_swt_internal_win32_UDACCEL_2)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJLorg/eclipse/swt/internal/win32/UDACCEL;)J", (void *)OS_NATIVE(SendMessageA__JIJLorg_eclipse_swt_internal_win32_UDACCEL_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__III_3B) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJ_3B) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(III[B)I", (void *)OS_NATIVE(SendMessageA__III_3B)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJ[B)J", (void *)OS_NATIVE(SendMessageA__JIJ_3B)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__III_3C) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJ_3C) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(III[C)I", (void *)OS_NATIVE(SendMessageA__III_3C)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJ[C)J", (void *)OS_NATIVE(SendMessageA__JIJ_3C)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__III_3I) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJ_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(III[I)I", (void *)OS_NATIVE(SendMessageA__III_3I)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJ[I)J", (void *)OS_NATIVE(SendMessageA__JIJ_3I)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__III_3S) && !defined(JNI64)) || (!defined(NO_SendMessageA__JIJ_3S) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(III[S)I", (void *)OS_NATIVE(SendMessageA__III_3S)},
+#else
+	{(char *)"SendMessageA", (char *)"(JIJ[S)J", (void *)OS_NATIVE(SendMessageA__JIJ_3S)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__II_3II) && !defined(JNI64)) || (!defined(NO_SendMessageA__JI_3JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(II[II)I", (void *)OS_NATIVE(SendMessageA__II_3II)},
+#else
+	{(char *)"SendMessageA", (char *)"(JI[JJ)J", (void *)OS_NATIVE(SendMessageA__JI_3JJ)},
+#endif
+#endif
+#if (!defined(NO_SendMessageA__II_3I_3I) && !defined(JNI64)) || (!defined(NO_SendMessageA__JI_3I_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageA", (char *)"(II[I[I)I", (void *)OS_NATIVE(SendMessageA__II_3I_3I)},
+#else
+	{(char *)"SendMessageA", (char *)"(JI[I[I)J", (void *)OS_NATIVE(SendMessageA__JI_3I_3I)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIII) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIII)I", (void *)OS_NATIVE(SendMessageW__IIII)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJJ)J", (void *)OS_NATIVE(SendMessageW__JIJJ)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/BUTTON_IMAGELIST;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/BUTTON_IMAGELIST;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_BUTTON_1IMAGELIST_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_HDHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_HDHITTESTINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/HDHITTESTINFO;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_HDHITTESTINFO_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/HDHITTESTINFO;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_HDHITTESTINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_HDITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_HDITEM_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/HDITEM;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_HDITEM_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/HDITEM;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_HDITEM_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_HDLAYOUT_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_HDLAYOUT_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/HDLAYOUT;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_HDLAYOUT_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/HDLAYOUT;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_HDLAYOUT_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_LITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_LITEM_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/LITEM;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_LITEM_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/LITEM;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_LITEM_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_LVCOLUMN_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVCOLUMN_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/LVCOLUMN;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_LVCOLUMN_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/LVCOLUMN;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVCOLUMN_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_LVHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVHITTESTINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/LVHITTESTINFO;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_LVHITTESTINFO_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/LVHITTESTINFO;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVHITTESTINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_LVINSERTMARK_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVINSERTMARK_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/LVINSERTMARK;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_LVINSERTMARK_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/LVINSERTMARK;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVINSERTMARK_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_LVITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVITEM_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/LVITEM;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_LVITEM_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/LVITEM;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_LVITEM_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_MARGINS_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_MARGINS_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/MARGINS;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_MARGINS_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/MARGINS;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_MARGINS_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_MCHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_MCHITTESTINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/MCHITTESTINFO;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_MCHITTESTINFO_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/MCHITTESTINFO;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_MCHITTESTINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_POINT_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_POINT_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/POINT;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_POINT_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/POINT;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_POINT_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_REBARBANDINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_REBARBANDINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/REBARBANDINFO;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_REBARBANDINFO_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/REBARBANDINFO;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_REBARBANDINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_RECT_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_RECT_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/RECT;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_RECT_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/RECT;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_RECT_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/SHDRAGIMAGE;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/SHDRAGIMAGE;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_SHDRAGIMAGE_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_SIZE_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_SIZE_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/SIZE;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_SIZE_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/SIZE;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_SIZE_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_SYSTEMTIME_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_SYSTEMTIME_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/SYSTEMTIME;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_SYSTEMTIME_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/SYSTEMTIME;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_SYSTEMTIME_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TBBUTTONINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TBBUTTONINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/TBBUTTONINFO;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TBBUTTONINFO_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/TBBUTTONINFO;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TBBUTTONINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TBBUTTON_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TBBUTTON_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/TBBUTTON;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TBBUTTON_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/TBBUTTON;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TBBUTTON_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TCHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TCHITTESTINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/TCHITTESTINFO;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TCHITTESTINFO_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/TCHITTESTINFO;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TCHITTESTINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TCITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TCITEM_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/TCITEM;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TCITEM_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/TCITEM;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TCITEM_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TOOLINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TOOLINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/TOOLINFO;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TOOLINFO_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/TOOLINFO;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TOOLINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TVHITTESTINFO_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVHITTESTINFO_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/TVHITTESTINFO;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TVHITTESTINFO_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/TVHITTESTINFO;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVHITTESTINFO_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/TVINSERTSTRUCT;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/TVINSERTSTRUCT;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVINSERTSTRUCT_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TVITEM_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVITEM_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/TVITEM;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TVITEM_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/TVITEM;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVITEM_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_TVSORTCB_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVSORTCB_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/TVSORTCB;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_TVSORTCB_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/TVSORTCB;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_TVSORTCB_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__IIILorg_eclipse_swt_internal_win32_UDACCEL_2) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJLorg_eclipse_swt_internal_win32_UDACCEL_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(IIILorg/eclipse/swt/internal/win32/UDACCEL;)I", (void *)OS_NATIVE(SendMessageW__IIILorg_eclipse_swt_internal_win32_UDACCEL_2)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJLorg/eclipse/swt/internal/win32/UDACCEL;)J", (void *)OS_NATIVE(SendMessageW__JIJLorg_eclipse_swt_internal_win32_UDACCEL_2)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__III_3C) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJ_3C) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(III[C)I", (void *)OS_NATIVE(SendMessageW__III_3C)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJ[C)J", (void *)OS_NATIVE(SendMessageW__JIJ_3C)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__III_3I) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJ_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(III[I)I", (void *)OS_NATIVE(SendMessageW__III_3I)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJ[I)J", (void *)OS_NATIVE(SendMessageW__JIJ_3I)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__III_3S) && !defined(JNI64)) || (!defined(NO_SendMessageW__JIJ_3S) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(III[S)I", (void *)OS_NATIVE(SendMessageW__III_3S)},
+#else
+	{(char *)"SendMessageW", (char *)"(JIJ[S)J", (void *)OS_NATIVE(SendMessageW__JIJ_3S)},
+#endif
+#endif
+#if (!defined(NO_SendMessageW__II_3II) && !defined(JNI64)) || (!defined(NO_SendMessageW__JI_3JJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"SendMessageW", (char *)"(II[II)I", (void *)OS_NATIVE(SendMessageW__II_3II)},
+#else
+	{(char *)"SendMessageW", (char *)"(JI[JJ)J", (void *)OS_NATIVE(SendMessageW__JI_3JJ)},
+#endif
+#endif
+#ifndef NO_SetActiveWindow
+#ifndef JNI64
+	{(char *)"SetActiveWindow", (char *)"(I)I", (void *)OS_NATIVE(SetActiveWindow)},
+#else
+	{(char *)"SetActiveWindow", (char *)"(J)J", (void *)OS_NATIVE(SetActiveWindow)},
+#endif
+#endif
+#ifndef NO_SetBkColor
+#ifndef JNI64
+	{(char *)"SetBkColor", (char *)"(II)I", (void *)OS_NATIVE(SetBkColor)},
+#else
+	{(char *)"SetBkColor", (char *)"(JI)I", (void *)OS_NATIVE(SetBkColor)},
+#endif
+#endif
+#ifndef NO_SetBkMode
+#ifndef JNI64
+	{(char *)"SetBkMode", (char *)"(II)I", (void *)OS_NATIVE(SetBkMode)},
+#else
+	{(char *)"SetBkMode", (char *)"(JI)I", (void *)OS_NATIVE(SetBkMode)},
+#endif
+#endif
+#ifndef NO_SetBrushOrgEx
+#ifndef JNI64
+	{(char *)"SetBrushOrgEx", (char *)"(IIILorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(SetBrushOrgEx)},
+#else
+	{(char *)"SetBrushOrgEx", (char *)"(JIILorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(SetBrushOrgEx)},
+#endif
+#endif
+#ifndef NO_SetCapture
+#ifndef JNI64
+	{(char *)"SetCapture", (char *)"(I)I", (void *)OS_NATIVE(SetCapture)},
+#else
+	{(char *)"SetCapture", (char *)"(J)J", (void *)OS_NATIVE(SetCapture)},
+#endif
+#endif
+#ifndef NO_SetCaretPos
+	{(char *)"SetCaretPos", (char *)"(II)Z", (void *)OS_NATIVE(SetCaretPos)},
+#endif
+#ifndef NO_SetClipboardData
+#ifndef JNI64
+	{(char *)"SetClipboardData", (char *)"(II)I", (void *)OS_NATIVE(SetClipboardData)},
+#else
+	{(char *)"SetClipboardData", (char *)"(IJ)J", (void *)OS_NATIVE(SetClipboardData)},
+#endif
+#endif
+#ifndef NO_SetCurrentProcessExplicitAppUserModelID
+	{(char *)"SetCurrentProcessExplicitAppUserModelID", (char *)"([C)I", (void *)OS_NATIVE(SetCurrentProcessExplicitAppUserModelID)},
+#endif
+#ifndef NO_SetCursor
+#ifndef JNI64
+	{(char *)"SetCursor", (char *)"(I)I", (void *)OS_NATIVE(SetCursor)},
+#else
+	{(char *)"SetCursor", (char *)"(J)J", (void *)OS_NATIVE(SetCursor)},
+#endif
+#endif
+#ifndef NO_SetCursorPos
+	{(char *)"SetCursorPos", (char *)"(II)Z", (void *)OS_NATIVE(SetCursorPos)},
+#endif
+#ifndef NO_SetDIBColorTable
+#ifndef JNI64
+	{(char *)"SetDIBColorTable", (char *)"(III[B)I", (void *)OS_NATIVE(SetDIBColorTable)},
+#else
+	{(char *)"SetDIBColorTable", (char *)"(JII[B)I", (void *)OS_NATIVE(SetDIBColorTable)},
+#endif
+#endif
+#ifndef NO_SetDllDirectoryA
+	{(char *)"SetDllDirectoryA", (char *)"([B)Z", (void *)OS_NATIVE(SetDllDirectoryA)},
+#endif
+#ifndef NO_SetDllDirectoryW
+	{(char *)"SetDllDirectoryW", (char *)"([C)Z", (void *)OS_NATIVE(SetDllDirectoryW)},
+#endif
+#ifndef NO_SetErrorMode
+	{(char *)"SetErrorMode", (char *)"(I)I", (void *)OS_NATIVE(SetErrorMode)},
+#endif
+#ifndef NO_SetFocus
+#ifndef JNI64
+	{(char *)"SetFocus", (char *)"(I)I", (void *)OS_NATIVE(SetFocus)},
+#else
+	{(char *)"SetFocus", (char *)"(J)J", (void *)OS_NATIVE(SetFocus)},
+#endif
+#endif
+#ifndef NO_SetForegroundWindow
+#ifndef JNI64
+	{(char *)"SetForegroundWindow", (char *)"(I)Z", (void *)OS_NATIVE(SetForegroundWindow)},
+#else
+	{(char *)"SetForegroundWindow", (char *)"(J)Z", (void *)OS_NATIVE(SetForegroundWindow)},
+#endif
+#endif
+#ifndef NO_SetGestureConfig
+#ifndef JNI64
+	{(char *)"SetGestureConfig", (char *)"(IIIII)Z", (void *)OS_NATIVE(SetGestureConfig)},
+#else
+	{(char *)"SetGestureConfig", (char *)"(JIIJI)Z", (void *)OS_NATIVE(SetGestureConfig)},
+#endif
+#endif
+#ifndef NO_SetGraphicsMode
+#ifndef JNI64
+	{(char *)"SetGraphicsMode", (char *)"(II)I", (void *)OS_NATIVE(SetGraphicsMode)},
+#else
+	{(char *)"SetGraphicsMode", (char *)"(JI)I", (void *)OS_NATIVE(SetGraphicsMode)},
+#endif
+#endif
+#ifndef NO_SetLayeredWindowAttributes
+#ifndef JNI64
+	{(char *)"SetLayeredWindowAttributes", (char *)"(IIBI)Z", (void *)OS_NATIVE(SetLayeredWindowAttributes)},
+#else
+	{(char *)"SetLayeredWindowAttributes", (char *)"(JIBI)Z", (void *)OS_NATIVE(SetLayeredWindowAttributes)},
+#endif
+#endif
+#ifndef NO_SetLayout
+#ifndef JNI64
+	{(char *)"SetLayout", (char *)"(II)I", (void *)OS_NATIVE(SetLayout)},
+#else
+	{(char *)"SetLayout", (char *)"(JI)I", (void *)OS_NATIVE(SetLayout)},
+#endif
+#endif
+#ifndef NO_SetMapMode
+#ifndef JNI64
+	{(char *)"SetMapMode", (char *)"(II)I", (void *)OS_NATIVE(SetMapMode)},
+#else
+	{(char *)"SetMapMode", (char *)"(JI)I", (void *)OS_NATIVE(SetMapMode)},
+#endif
+#endif
+#ifndef NO_SetMapperFlags
+#ifndef JNI64
+	{(char *)"SetMapperFlags", (char *)"(II)I", (void *)OS_NATIVE(SetMapperFlags)},
+#else
+	{(char *)"SetMapperFlags", (char *)"(JI)I", (void *)OS_NATIVE(SetMapperFlags)},
+#endif
+#endif
+#ifndef NO_SetMenu
+#ifndef JNI64
+	{(char *)"SetMenu", (char *)"(II)Z", (void *)OS_NATIVE(SetMenu)},
+#else
+	{(char *)"SetMenu", (char *)"(JJ)Z", (void *)OS_NATIVE(SetMenu)},
+#endif
+#endif
+#ifndef NO_SetMenuDefaultItem
+#ifndef JNI64
+	{(char *)"SetMenuDefaultItem", (char *)"(III)Z", (void *)OS_NATIVE(SetMenuDefaultItem)},
+#else
+	{(char *)"SetMenuDefaultItem", (char *)"(JII)Z", (void *)OS_NATIVE(SetMenuDefaultItem)},
+#endif
+#endif
+#ifndef NO_SetMenuInfo
+#ifndef JNI64
+	{(char *)"SetMenuInfo", (char *)"(ILorg/eclipse/swt/internal/win32/MENUINFO;)Z", (void *)OS_NATIVE(SetMenuInfo)},
+#else
+	{(char *)"SetMenuInfo", (char *)"(JLorg/eclipse/swt/internal/win32/MENUINFO;)Z", (void *)OS_NATIVE(SetMenuInfo)},
+#endif
+#endif
+#ifndef NO_SetMenuItemInfoA
+#ifndef JNI64
+	{(char *)"SetMenuItemInfoA", (char *)"(IIZLorg/eclipse/swt/internal/win32/MENUITEMINFO;)Z", (void *)OS_NATIVE(SetMenuItemInfoA)},
+#else
+	{(char *)"SetMenuItemInfoA", (char *)"(JIZLorg/eclipse/swt/internal/win32/MENUITEMINFO;)Z", (void *)OS_NATIVE(SetMenuItemInfoA)},
+#endif
+#endif
+#ifndef NO_SetMenuItemInfoW
+#ifndef JNI64
+	{(char *)"SetMenuItemInfoW", (char *)"(IIZLorg/eclipse/swt/internal/win32/MENUITEMINFO;)Z", (void *)OS_NATIVE(SetMenuItemInfoW)},
+#else
+	{(char *)"SetMenuItemInfoW", (char *)"(JIZLorg/eclipse/swt/internal/win32/MENUITEMINFO;)Z", (void *)OS_NATIVE(SetMenuItemInfoW)},
+#endif
+#endif
+#ifndef NO_SetMetaRgn
+#ifndef JNI64
+	{(char *)"SetMetaRgn", (char *)"(I)I", (void *)OS_NATIVE(SetMetaRgn)},
+#else
+	{(char *)"SetMetaRgn", (char *)"(J)I", (void *)OS_NATIVE(SetMetaRgn)},
+#endif
+#endif
+#ifndef NO_SetPaletteEntries
+#ifndef JNI64
+	{(char *)"SetPaletteEntries", (char *)"(III[B)I", (void *)OS_NATIVE(SetPaletteEntries)},
+#else
+	{(char *)"SetPaletteEntries", (char *)"(JII[B)I", (void *)OS_NATIVE(SetPaletteEntries)},
+#endif
+#endif
+#ifndef NO_SetParent
+#ifndef JNI64
+	{(char *)"SetParent", (char *)"(II)I", (void *)OS_NATIVE(SetParent)},
+#else
+	{(char *)"SetParent", (char *)"(JJ)J", (void *)OS_NATIVE(SetParent)},
+#endif
+#endif
+#ifndef NO_SetPixel
+#ifndef JNI64
+	{(char *)"SetPixel", (char *)"(IIII)I", (void *)OS_NATIVE(SetPixel)},
+#else
+	{(char *)"SetPixel", (char *)"(JIII)I", (void *)OS_NATIVE(SetPixel)},
+#endif
+#endif
+#ifndef NO_SetPolyFillMode
+#ifndef JNI64
+	{(char *)"SetPolyFillMode", (char *)"(II)I", (void *)OS_NATIVE(SetPolyFillMode)},
+#else
+	{(char *)"SetPolyFillMode", (char *)"(JI)I", (void *)OS_NATIVE(SetPolyFillMode)},
+#endif
+#endif
+#ifndef NO_SetProcessDPIAware
+	{(char *)"SetProcessDPIAware", (char *)"()Z", (void *)OS_NATIVE(SetProcessDPIAware)},
+#endif
+#ifndef NO_SetPropA
+#ifndef JNI64
+	{(char *)"SetPropA", (char *)"(III)Z", (void *)OS_NATIVE(SetPropA)},
+#else
+	{(char *)"SetPropA", (char *)"(JJJ)Z", (void *)OS_NATIVE(SetPropA)},
+#endif
+#endif
+#ifndef NO_SetPropW
+#ifndef JNI64
+	{(char *)"SetPropW", (char *)"(III)Z", (void *)OS_NATIVE(SetPropW)},
+#else
+	{(char *)"SetPropW", (char *)"(JJJ)Z", (void *)OS_NATIVE(SetPropW)},
+#endif
+#endif
+#ifndef NO_SetROP2
+#ifndef JNI64
+	{(char *)"SetROP2", (char *)"(II)I", (void *)OS_NATIVE(SetROP2)},
+#else
+	{(char *)"SetROP2", (char *)"(JI)I", (void *)OS_NATIVE(SetROP2)},
+#endif
+#endif
+#ifndef NO_SetRect
+	{(char *)"SetRect", (char *)"(Lorg/eclipse/swt/internal/win32/RECT;IIII)Z", (void *)OS_NATIVE(SetRect)},
+#endif
+#ifndef NO_SetRectRgn
+#ifndef JNI64
+	{(char *)"SetRectRgn", (char *)"(IIIII)Z", (void *)OS_NATIVE(SetRectRgn)},
+#else
+	{(char *)"SetRectRgn", (char *)"(JIIII)Z", (void *)OS_NATIVE(SetRectRgn)},
+#endif
+#endif
+#ifndef NO_SetScrollInfo
+#ifndef JNI64
+	{(char *)"SetScrollInfo", (char *)"(IILorg/eclipse/swt/internal/win32/SCROLLINFO;Z)Z", (void *)OS_NATIVE(SetScrollInfo)},
+#else
+	{(char *)"SetScrollInfo", (char *)"(JILorg/eclipse/swt/internal/win32/SCROLLINFO;Z)Z", (void *)OS_NATIVE(SetScrollInfo)},
+#endif
+#endif
+#ifndef NO_SetStretchBltMode
+#ifndef JNI64
+	{(char *)"SetStretchBltMode", (char *)"(II)I", (void *)OS_NATIVE(SetStretchBltMode)},
+#else
+	{(char *)"SetStretchBltMode", (char *)"(JI)I", (void *)OS_NATIVE(SetStretchBltMode)},
+#endif
+#endif
+#ifndef NO_SetTextAlign
+#ifndef JNI64
+	{(char *)"SetTextAlign", (char *)"(II)I", (void *)OS_NATIVE(SetTextAlign)},
+#else
+	{(char *)"SetTextAlign", (char *)"(JI)I", (void *)OS_NATIVE(SetTextAlign)},
+#endif
+#endif
+#ifndef NO_SetTextColor
+#ifndef JNI64
+	{(char *)"SetTextColor", (char *)"(II)I", (void *)OS_NATIVE(SetTextColor)},
+#else
+	{(char *)"SetTextColor", (char *)"(JI)I", (void *)OS_NATIVE(SetTextColor)},
+#endif
+#endif
+#ifndef NO_SetTimer
+#ifndef JNI64
+	{(char *)"SetTimer", (char *)"(IIII)I", (void *)OS_NATIVE(SetTimer)},
+#else
+	{(char *)"SetTimer", (char *)"(JJIJ)J", (void *)OS_NATIVE(SetTimer)},
+#endif
+#endif
+#ifndef NO_SetViewportExtEx
+#ifndef JNI64
+	{(char *)"SetViewportExtEx", (char *)"(IIILorg/eclipse/swt/internal/win32/SIZE;)Z", (void *)OS_NATIVE(SetViewportExtEx)},
+#else
+	{(char *)"SetViewportExtEx", (char *)"(JIILorg/eclipse/swt/internal/win32/SIZE;)Z", (void *)OS_NATIVE(SetViewportExtEx)},
+#endif
+#endif
+#ifndef NO_SetViewportOrgEx
+#ifndef JNI64
+	{(char *)"SetViewportOrgEx", (char *)"(IIILorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(SetViewportOrgEx)},
+#else
+	{(char *)"SetViewportOrgEx", (char *)"(JIILorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(SetViewportOrgEx)},
+#endif
+#endif
+#ifndef NO_SetWindowExtEx
+#ifndef JNI64
+	{(char *)"SetWindowExtEx", (char *)"(IIILorg/eclipse/swt/internal/win32/SIZE;)Z", (void *)OS_NATIVE(SetWindowExtEx)},
+#else
+	{(char *)"SetWindowExtEx", (char *)"(JIILorg/eclipse/swt/internal/win32/SIZE;)Z", (void *)OS_NATIVE(SetWindowExtEx)},
+#endif
+#endif
+#ifndef NO_SetWindowLongA
+#ifndef JNI64
+	{(char *)"SetWindowLongA", (char *)"(III)I", (void *)OS_NATIVE(SetWindowLongA)},
+#else
+	{(char *)"SetWindowLongA", (char *)"(JII)I", (void *)OS_NATIVE(SetWindowLongA)},
+#endif
+#endif
+#ifndef NO_SetWindowLongPtrA
+#ifndef JNI64
+	{(char *)"SetWindowLongPtrA", (char *)"(III)I", (void *)OS_NATIVE(SetWindowLongPtrA)},
+#else
+	{(char *)"SetWindowLongPtrA", (char *)"(JIJ)J", (void *)OS_NATIVE(SetWindowLongPtrA)},
+#endif
+#endif
+#ifndef NO_SetWindowLongPtrW
+#ifndef JNI64
+	{(char *)"SetWindowLongPtrW", (char *)"(III)I", (void *)OS_NATIVE(SetWindowLongPtrW)},
+#else
+	{(char *)"SetWindowLongPtrW", (char *)"(JIJ)J", (void *)OS_NATIVE(SetWindowLongPtrW)},
+#endif
+#endif
+#ifndef NO_SetWindowLongW
+#ifndef JNI64
+	{(char *)"SetWindowLongW", (char *)"(III)I", (void *)OS_NATIVE(SetWindowLongW)},
+#else
+	{(char *)"SetWindowLongW", (char *)"(JII)I", (void *)OS_NATIVE(SetWindowLongW)},
+#endif
+#endif
+#ifndef NO_SetWindowOrgEx
+#ifndef JNI64
+	{(char *)"SetWindowOrgEx", (char *)"(IIILorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(SetWindowOrgEx)},
+#else
+	{(char *)"SetWindowOrgEx", (char *)"(JIILorg/eclipse/swt/internal/win32/POINT;)Z", (void *)OS_NATIVE(SetWindowOrgEx)},
+#endif
+#endif
+#ifndef NO_SetWindowPlacement
+#ifndef JNI64
+	{(char *)"SetWindowPlacement", (char *)"(ILorg/eclipse/swt/internal/win32/WINDOWPLACEMENT;)Z", (void *)OS_NATIVE(SetWindowPlacement)},
+#else
+	{(char *)"SetWindowPlacement", (char *)"(JLorg/eclipse/swt/internal/win32/WINDOWPLACEMENT;)Z", (void *)OS_NATIVE(SetWindowPlacement)},
+#endif
+#endif
+#ifndef NO_SetWindowPos
+#ifndef JNI64
+	{(char *)"SetWindowPos", (char *)"(IIIIIII)Z", (void *)OS_NATIVE(SetWindowPos)},
+#else
+	{(char *)"SetWindowPos", (char *)"(JJIIIII)Z", (void *)OS_NATIVE(SetWindowPos)},
+#endif
+#endif
+#ifndef NO_SetWindowRgn
+#ifndef JNI64
+	{(char *)"SetWindowRgn", (char *)"(IIZ)I", (void *)OS_NATIVE(SetWindowRgn)},
+#else
+	{(char *)"SetWindowRgn", (char *)"(JJZ)I", (void *)OS_NATIVE(SetWindowRgn)},
+#endif
+#endif
+#ifndef NO_SetWindowTextA
+#ifndef JNI64
+	{(char *)"SetWindowTextA", (char *)"(I[B)Z", (void *)OS_NATIVE(SetWindowTextA)},
+#else
+	{(char *)"SetWindowTextA", (char *)"(J[B)Z", (void *)OS_NATIVE(SetWindowTextA)},
+#endif
+#endif
+#ifndef NO_SetWindowTextW
+#ifndef JNI64
+	{(char *)"SetWindowTextW", (char *)"(I[C)Z", (void *)OS_NATIVE(SetWindowTextW)},
+#else
+	{(char *)"SetWindowTextW", (char *)"(J[C)Z", (void *)OS_NATIVE(SetWindowTextW)},
+#endif
+#endif
+#ifndef NO_SetWindowTheme
+#ifndef JNI64
+	{(char *)"SetWindowTheme", (char *)"(I[C[C)I", (void *)OS_NATIVE(SetWindowTheme)},
+#else
+	{(char *)"SetWindowTheme", (char *)"(J[C[C)I", (void *)OS_NATIVE(SetWindowTheme)},
+#endif
+#endif
+#ifndef NO_SetWindowsHookExA
+#ifndef JNI64
+	{(char *)"SetWindowsHookExA", (char *)"(IIII)I", (void *)OS_NATIVE(SetWindowsHookExA)},
+#else
+	{(char *)"SetWindowsHookExA", (char *)"(IJJI)J", (void *)OS_NATIVE(SetWindowsHookExA)},
+#endif
+#endif
+#ifndef NO_SetWindowsHookExW
+#ifndef JNI64
+	{(char *)"SetWindowsHookExW", (char *)"(IIII)I", (void *)OS_NATIVE(SetWindowsHookExW)},
+#else
+	{(char *)"SetWindowsHookExW", (char *)"(IJJI)J", (void *)OS_NATIVE(SetWindowsHookExW)},
+#endif
+#endif
+#ifndef NO_SetWorldTransform
+#ifndef JNI64
+	{(char *)"SetWorldTransform", (char *)"(I[F)Z", (void *)OS_NATIVE(SetWorldTransform)},
+#else
+	{(char *)"SetWorldTransform", (char *)"(J[F)Z", (void *)OS_NATIVE(SetWorldTransform)},
+#endif
+#endif
+#ifndef NO_ShellExecuteExA
+	{(char *)"ShellExecuteExA", (char *)"(Lorg/eclipse/swt/internal/win32/SHELLEXECUTEINFO;)Z", (void *)OS_NATIVE(ShellExecuteExA)},
+#endif
+#ifndef NO_ShellExecuteExW
+	{(char *)"ShellExecuteExW", (char *)"(Lorg/eclipse/swt/internal/win32/SHELLEXECUTEINFO;)Z", (void *)OS_NATIVE(ShellExecuteExW)},
+#endif
+#ifndef NO_Shell_1NotifyIconA
+	{(char *)"Shell_NotifyIconA", (char *)"(ILorg/eclipse/swt/internal/win32/NOTIFYICONDATAA;)Z", (void *)OS_NATIVE(Shell_1NotifyIconA)},
+#endif
+#ifndef NO_Shell_1NotifyIconW
+	{(char *)"Shell_NotifyIconW", (char *)"(ILorg/eclipse/swt/internal/win32/NOTIFYICONDATAW;)Z", (void *)OS_NATIVE(Shell_1NotifyIconW)},
+#endif
+#ifndef NO_ShowCaret
+#ifndef JNI64
+	{(char *)"ShowCaret", (char *)"(I)Z", (void *)OS_NATIVE(ShowCaret)},
+#else
+	{(char *)"ShowCaret", (char *)"(J)Z", (void *)OS_NATIVE(ShowCaret)},
+#endif
+#endif
+#ifndef NO_ShowCursor
+	{(char *)"ShowCursor", (char *)"(Z)I", (void *)OS_NATIVE(ShowCursor)},
+#endif
+#ifndef NO_ShowOwnedPopups
+#ifndef JNI64
+	{(char *)"ShowOwnedPopups", (char *)"(IZ)Z", (void *)OS_NATIVE(ShowOwnedPopups)},
+#else
+	{(char *)"ShowOwnedPopups", (char *)"(JZ)Z", (void *)OS_NATIVE(ShowOwnedPopups)},
+#endif
+#endif
+#ifndef NO_ShowScrollBar
+#ifndef JNI64
+	{(char *)"ShowScrollBar", (char *)"(IIZ)Z", (void *)OS_NATIVE(ShowScrollBar)},
+#else
+	{(char *)"ShowScrollBar", (char *)"(JIZ)Z", (void *)OS_NATIVE(ShowScrollBar)},
+#endif
+#endif
+#ifndef NO_ShowWindow
+#ifndef JNI64
+	{(char *)"ShowWindow", (char *)"(II)Z", (void *)OS_NATIVE(ShowWindow)},
+#else
+	{(char *)"ShowWindow", (char *)"(JI)Z", (void *)OS_NATIVE(ShowWindow)},
+#endif
+#endif
+#ifndef NO_SipGetInfo
+	{(char *)"SipGetInfo", (char *)"(Lorg/eclipse/swt/internal/win32/SIPINFO;)Z", (void *)OS_NATIVE(SipGetInfo)},
+#endif
+#ifndef NO_StartDocA
+#ifndef JNI64
+	{(char *)"StartDocA", (char *)"(ILorg/eclipse/swt/internal/win32/DOCINFO;)I", (void *)OS_NATIVE(StartDocA)},
+#else
+	{(char *)"StartDocA", (char *)"(JLorg/eclipse/swt/internal/win32/DOCINFO;)I", (void *)OS_NATIVE(StartDocA)},
+#endif
+#endif
+#ifndef NO_StartDocW
+#ifndef JNI64
+	{(char *)"StartDocW", (char *)"(ILorg/eclipse/swt/internal/win32/DOCINFO;)I", (void *)OS_NATIVE(StartDocW)},
+#else
+	{(char *)"StartDocW", (char *)"(JLorg/eclipse/swt/internal/win32/DOCINFO;)I", (void *)OS_NATIVE(StartDocW)},
+#endif
+#endif
+#ifndef NO_StartPage
+#ifndef JNI64
+	{(char *)"StartPage", (char *)"(I)I", (void *)OS_NATIVE(StartPage)},
+#else
+	{(char *)"StartPage", (char *)"(J)I", (void *)OS_NATIVE(StartPage)},
+#endif
+#endif
+#ifndef NO_StretchBlt
+#ifndef JNI64
+	{(char *)"StretchBlt", (char *)"(IIIIIIIIIII)Z", (void *)OS_NATIVE(StretchBlt)},
+#else
+	{(char *)"StretchBlt", (char *)"(JIIIIJIIIII)Z", (void *)OS_NATIVE(StretchBlt)},
+#endif
+#endif
+#ifndef NO_StrokePath
+#ifndef JNI64
+	{(char *)"StrokePath", (char *)"(I)Z", (void *)OS_NATIVE(StrokePath)},
+#else
+	{(char *)"StrokePath", (char *)"(J)Z", (void *)OS_NATIVE(StrokePath)},
+#endif
+#endif
+#ifndef NO_SystemParametersInfoA__IILorg_eclipse_swt_internal_win32_HIGHCONTRAST_2I
+	{(char *)"SystemParametersInfoA", (char *)"(IILorg/eclipse/swt/internal/win32/HIGHCONTRAST;I)Z", (void *)OS_NATIVE(SystemParametersInfoA__IILorg_eclipse_swt_internal_win32_HIGHCONTRAST_2I)},
+#endif
+#ifndef NO_SystemParametersInfoA__IILorg_eclipse_swt_internal_win32_NONCLIENTMETRICSA_2I
+	{(char *)"SystemParametersInfoA", (char *)"(IILorg/eclipse/swt/internal/win32/NONCLIENTMETRICSA;I)Z", (void *)OS_NATIVE(SystemParametersInfoA__IILorg_eclipse_swt_internal_win32_NONCLIENTMETRICSA_2I)},
+#endif
+#ifndef NO_SystemParametersInfoA__IILorg_eclipse_swt_internal_win32_RECT_2I
+	{(char *)"SystemParametersInfoA", (char *)"(IILorg/eclipse/swt/internal/win32/RECT;I)Z", (void *)OS_NATIVE(SystemParametersInfoA__IILorg_eclipse_swt_internal_win32_RECT_2I)},
+#endif
+#ifndef NO_SystemParametersInfoA__II_3II
+	{(char *)"SystemParametersInfoA", (char *)"(II[II)Z", (void *)OS_NATIVE(SystemParametersInfoA__II_3II)},
+#endif
+#ifndef NO_SystemParametersInfoW__IILorg_eclipse_swt_internal_win32_HIGHCONTRAST_2I
+	{(char *)"SystemParametersInfoW", (char *)"(IILorg/eclipse/swt/internal/win32/HIGHCONTRAST;I)Z", (void *)OS_NATIVE(SystemParametersInfoW__IILorg_eclipse_swt_internal_win32_HIGHCONTRAST_2I)},
+#endif
+#ifndef NO_SystemParametersInfoW__IILorg_eclipse_swt_internal_win32_NONCLIENTMETRICSW_2I
+	{(char *)"SystemParametersInfoW", (char *)"(IILorg/eclipse/swt/internal/win32/NONCLIENTMETRICSW;I)Z", (void *)OS_NATIVE(SystemParametersInfoW__IILorg_eclipse_swt_internal_win32_NONCLIENTMETRICSW_2I)},
+#endif
+#ifndef NO_SystemParametersInfoW__IILorg_eclipse_swt_internal_win32_RECT_2I
+	{(char *)"SystemParametersInfoW", (char *)"(IILorg/eclipse/swt/internal/win32/RECT;I)Z", (void *)OS_NATIVE(SystemParametersInfoW__IILorg_eclipse_swt_internal_win32_RECT_2I)},
+#endif
+#ifndef NO_SystemParametersInfoW__II_3II
+	{(char *)"SystemParametersInfoW", (char *)"(II[II)Z", (void *)OS_NATIVE(SystemParametersInfoW__II_3II)},
+#endif
+#ifndef NO_TBBUTTONINFO_1sizeof
+	{(char *)"TBBUTTONINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(TBBUTTONINFO_1sizeof)},
+#endif
+#ifndef NO_TBBUTTON_1sizeof
+	{(char *)"TBBUTTON_sizeof", (char *)"()I", (void *)OS_NATIVE(TBBUTTON_1sizeof)},
+#endif
+#ifndef NO_TCHITTESTINFO_1sizeof
+	{(char *)"TCHITTESTINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(TCHITTESTINFO_1sizeof)},
+#endif
+#ifndef NO_TCITEM_1sizeof
+	{(char *)"TCITEM_sizeof", (char *)"()I", (void *)OS_NATIVE(TCITEM_1sizeof)},
+#endif
+#ifndef NO_TEXTMETRICA_1sizeof
+	{(char *)"TEXTMETRICA_sizeof", (char *)"()I", (void *)OS_NATIVE(TEXTMETRICA_1sizeof)},
+#endif
+#ifndef NO_TEXTMETRICW_1sizeof
+	{(char *)"TEXTMETRICW_sizeof", (char *)"()I", (void *)OS_NATIVE(TEXTMETRICW_1sizeof)},
+#endif
+#ifndef NO_TF_1DA_1COLOR_1sizeof
+	{(char *)"TF_DA_COLOR_sizeof", (char *)"()I", (void *)OS_NATIVE(TF_1DA_1COLOR_1sizeof)},
+#endif
+#ifndef NO_TF_1DISPLAYATTRIBUTE_1sizeof
+	{(char *)"TF_DISPLAYATTRIBUTE_sizeof", (char *)"()I", (void *)OS_NATIVE(TF_1DISPLAYATTRIBUTE_1sizeof)},
+#endif
+#ifndef NO_TOOLINFO_1sizeof
+	{(char *)"TOOLINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(TOOLINFO_1sizeof)},
+#endif
+#ifndef NO_TOUCHINPUT_1sizeof
+	{(char *)"TOUCHINPUT_sizeof", (char *)"()I", (void *)OS_NATIVE(TOUCHINPUT_1sizeof)},
+#endif
+#ifndef NO_TOUCH_1COORD_1TO_1PIXEL
+	{(char *)"TOUCH_COORD_TO_PIXEL", (char *)"(J)J", (void *)OS_NATIVE(TOUCH_1COORD_1TO_1PIXEL)},
+#endif
+#ifndef NO_TRACKMOUSEEVENT_1sizeof
+	{(char *)"TRACKMOUSEEVENT_sizeof", (char *)"()I", (void *)OS_NATIVE(TRACKMOUSEEVENT_1sizeof)},
+#endif
+#ifndef NO_TRIVERTEX_1sizeof
+	{(char *)"TRIVERTEX_sizeof", (char *)"()I", (void *)OS_NATIVE(TRIVERTEX_1sizeof)},
+#endif
+#ifndef NO_TVHITTESTINFO_1sizeof
+	{(char *)"TVHITTESTINFO_sizeof", (char *)"()I", (void *)OS_NATIVE(TVHITTESTINFO_1sizeof)},
+#endif
+#ifndef NO_TVINSERTSTRUCT_1sizeof
+	{(char *)"TVINSERTSTRUCT_sizeof", (char *)"()I", (void *)OS_NATIVE(TVINSERTSTRUCT_1sizeof)},
+#endif
+#ifndef NO_TVITEMEX_1sizeof
+	{(char *)"TVITEMEX_sizeof", (char *)"()I", (void *)OS_NATIVE(TVITEMEX_1sizeof)},
+#endif
+#ifndef NO_TVITEM_1sizeof
+	{(char *)"TVITEM_sizeof", (char *)"()I", (void *)OS_NATIVE(TVITEM_1sizeof)},
+#endif
+#ifndef NO_TVSORTCB_1sizeof
+	{(char *)"TVSORTCB_sizeof", (char *)"()I", (void *)OS_NATIVE(TVSORTCB_1sizeof)},
+#endif
+#ifndef NO_ToAscii
+	{(char *)"ToAscii", (char *)"(II[B[SI)I", (void *)OS_NATIVE(ToAscii)},
+#endif
+#ifndef NO_ToUnicode
+	{(char *)"ToUnicode", (char *)"(II[B[CII)I", (void *)OS_NATIVE(ToUnicode)},
+#endif
+#ifndef NO_TrackMouseEvent
+	{(char *)"TrackMouseEvent", (char *)"(Lorg/eclipse/swt/internal/win32/TRACKMOUSEEVENT;)Z", (void *)OS_NATIVE(TrackMouseEvent)},
+#endif
+#ifndef NO_TrackPopupMenu
+#ifndef JNI64
+	{(char *)"TrackPopupMenu", (char *)"(IIIIIILorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(TrackPopupMenu)},
+#else
+	{(char *)"TrackPopupMenu", (char *)"(JIIIIJLorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(TrackPopupMenu)},
+#endif
+#endif
+#ifndef NO_TranslateAcceleratorA
+#ifndef JNI64
+	{(char *)"TranslateAcceleratorA", (char *)"(IILorg/eclipse/swt/internal/win32/MSG;)I", (void *)OS_NATIVE(TranslateAcceleratorA)},
+#else
+	{(char *)"TranslateAcceleratorA", (char *)"(JJLorg/eclipse/swt/internal/win32/MSG;)I", (void *)OS_NATIVE(TranslateAcceleratorA)},
+#endif
+#endif
+#ifndef NO_TranslateAcceleratorW
+#ifndef JNI64
+	{(char *)"TranslateAcceleratorW", (char *)"(IILorg/eclipse/swt/internal/win32/MSG;)I", (void *)OS_NATIVE(TranslateAcceleratorW)},
+#else
+	{(char *)"TranslateAcceleratorW", (char *)"(JJLorg/eclipse/swt/internal/win32/MSG;)I", (void *)OS_NATIVE(TranslateAcceleratorW)},
+#endif
+#endif
+#ifndef NO_TranslateCharsetInfo
+#ifndef JNI64
+	{(char *)"TranslateCharsetInfo", (char *)"(I[II)Z", (void *)OS_NATIVE(TranslateCharsetInfo)},
+#else
+	{(char *)"TranslateCharsetInfo", (char *)"(J[II)Z", (void *)OS_NATIVE(TranslateCharsetInfo)},
+#endif
+#endif
+#ifndef NO_TranslateMDISysAccel
+#ifndef JNI64
+	{(char *)"TranslateMDISysAccel", (char *)"(ILorg/eclipse/swt/internal/win32/MSG;)Z", (void *)OS_NATIVE(TranslateMDISysAccel)},
+#else
+	{(char *)"TranslateMDISysAccel", (char *)"(JLorg/eclipse/swt/internal/win32/MSG;)Z", (void *)OS_NATIVE(TranslateMDISysAccel)},
+#endif
+#endif
+#ifndef NO_TranslateMessage
+	{(char *)"TranslateMessage", (char *)"(Lorg/eclipse/swt/internal/win32/MSG;)Z", (void *)OS_NATIVE(TranslateMessage)},
+#endif
+#ifndef NO_TransparentBlt
+#ifndef JNI64
+	{(char *)"TransparentBlt", (char *)"(IIIIIIIIIII)Z", (void *)OS_NATIVE(TransparentBlt)},
+#else
+	{(char *)"TransparentBlt", (char *)"(JIIIIJIIIII)Z", (void *)OS_NATIVE(TransparentBlt)},
+#endif
+#endif
+#ifndef NO_TransparentImage
+#ifndef JNI64
+	{(char *)"TransparentImage", (char *)"(IIIIIIIIIII)Z", (void *)OS_NATIVE(TransparentImage)},
+#else
+	{(char *)"TransparentImage", (char *)"(JIIIIJIIIII)Z", (void *)OS_NATIVE(TransparentImage)},
+#endif
+#endif
+#ifndef NO_TreeView_1GetItemRect
+#ifndef JNI64
+	{(char *)"TreeView_GetItemRect", (char *)"(IILorg/eclipse/swt/internal/win32/RECT;Z)Z", (void *)OS_NATIVE(TreeView_1GetItemRect)},
+#else
+	{(char *)"TreeView_GetItemRect", (char *)"(JJLorg/eclipse/swt/internal/win32/RECT;Z)Z", (void *)OS_NATIVE(TreeView_1GetItemRect)},
+#endif
+#endif
+#ifndef NO_UDACCEL_1sizeof
+	{(char *)"UDACCEL_sizeof", (char *)"()I", (void *)OS_NATIVE(UDACCEL_1sizeof)},
+#endif
+#ifndef NO_UnhookWindowsHookEx
+#ifndef JNI64
+	{(char *)"UnhookWindowsHookEx", (char *)"(I)Z", (void *)OS_NATIVE(UnhookWindowsHookEx)},
+#else
+	{(char *)"UnhookWindowsHookEx", (char *)"(J)Z", (void *)OS_NATIVE(UnhookWindowsHookEx)},
+#endif
+#endif
+#ifndef NO_UnmapViewOfFile
+#ifndef JNI64
+	{(char *)"UnmapViewOfFile", (char *)"(I)Z", (void *)OS_NATIVE(UnmapViewOfFile)},
+#else
+	{(char *)"UnmapViewOfFile", (char *)"(J)Z", (void *)OS_NATIVE(UnmapViewOfFile)},
+#endif
+#endif
+#ifndef NO_UnregisterClassA
+#ifndef JNI64
+	{(char *)"UnregisterClassA", (char *)"([BI)Z", (void *)OS_NATIVE(UnregisterClassA)},
+#else
+	{(char *)"UnregisterClassA", (char *)"([BJ)Z", (void *)OS_NATIVE(UnregisterClassA)},
+#endif
+#endif
+#ifndef NO_UnregisterClassW
+#ifndef JNI64
+	{(char *)"UnregisterClassW", (char *)"([CI)Z", (void *)OS_NATIVE(UnregisterClassW)},
+#else
+	{(char *)"UnregisterClassW", (char *)"([CJ)Z", (void *)OS_NATIVE(UnregisterClassW)},
+#endif
+#endif
+#ifndef NO_UnregisterTouchWindow
+#ifndef JNI64
+	{(char *)"UnregisterTouchWindow", (char *)"(I)Z", (void *)OS_NATIVE(UnregisterTouchWindow)},
+#else
+	{(char *)"UnregisterTouchWindow", (char *)"(J)Z", (void *)OS_NATIVE(UnregisterTouchWindow)},
+#endif
+#endif
+#ifndef NO_UpdateLayeredWindow
+#ifndef JNI64
+	{(char *)"UpdateLayeredWindow", (char *)"(IILorg/eclipse/swt/internal/win32/POINT;Lorg/eclipse/swt/internal/win32/SIZE;ILorg/eclipse/swt/internal/win32/POINT;ILorg/eclipse/swt/internal/win32/BLENDFUNCTION;I)Z", (void *)OS_NATIVE(UpdateLayeredWindow)},
+#else
+	{(char *)"UpdateLayeredWindow", (char *)"(JJLorg/eclipse/swt/internal/win32/POINT;Lorg/eclipse/swt/internal/win32/SIZE;JLorg/eclipse/swt/internal/win32/POINT;ILorg/eclipse/swt/internal/win32/BLENDFUNCTION;I)Z", (void *)OS_NATIVE(UpdateLayeredWindow)},
+#endif
+#endif
+#ifndef NO_UpdateWindow
+#ifndef JNI64
+	{(char *)"UpdateWindow", (char *)"(I)Z", (void *)OS_NATIVE(UpdateWindow)},
+#else
+	{(char *)"UpdateWindow", (char *)"(J)Z", (void *)OS_NATIVE(UpdateWindow)},
+#endif
+#endif
+#ifndef NO_UrlCreateFromPathA
+	{(char *)"UrlCreateFromPathA", (char *)"([B[B[II)I", (void *)OS_NATIVE(UrlCreateFromPathA)},
+#endif
+#ifndef NO_UrlCreateFromPathW
+	{(char *)"UrlCreateFromPathW", (char *)"([C[C[II)I", (void *)OS_NATIVE(UrlCreateFromPathW)},
+#endif
+#ifndef NO_ValidateRect
+#ifndef JNI64
+	{(char *)"ValidateRect", (char *)"(ILorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(ValidateRect)},
+#else
+	{(char *)"ValidateRect", (char *)"(JLorg/eclipse/swt/internal/win32/RECT;)Z", (void *)OS_NATIVE(ValidateRect)},
+#endif
+#endif
+#ifndef NO_VkKeyScanA
+	{(char *)"VkKeyScanA", (char *)"(S)S", (void *)OS_NATIVE(VkKeyScanA)},
+#endif
+#ifndef NO_VkKeyScanW
+	{(char *)"VkKeyScanW", (char *)"(S)S", (void *)OS_NATIVE(VkKeyScanW)},
+#endif
+#if (!defined(NO_VtblCall__II) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(II)I", (void *)OS_NATIVE(VtblCall__II)},
+#else
+	{(char *)"VtblCall", (char *)"(IJ)I", (void *)OS_NATIVE(VtblCall__IJ)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__III) && !defined(JNI64)) || (!defined(NO_VtblCall__IJI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(III)I", (void *)OS_NATIVE(VtblCall__III)},
+#else
+	{(char *)"VtblCall", (char *)"(IJI)I", (void *)OS_NATIVE(VtblCall__IJI)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIII) && !defined(JNI64)) || (!defined(NO_VtblCall__IJII) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIII)I", (void *)OS_NATIVE(VtblCall__IIII)},
+#else
+	{(char *)"VtblCall", (char *)"(IJII)I", (void *)OS_NATIVE(VtblCall__IJII)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIIII) && !defined(JNI64)) || (!defined(NO_VtblCall__IJIII) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIIII)I", (void *)OS_NATIVE(VtblCall__IIIII)},
+#else
+	{(char *)"VtblCall", (char *)"(IJIII)I", (void *)OS_NATIVE(VtblCall__IJIII)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIIII_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJIII_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIIII[I)I", (void *)OS_NATIVE(VtblCall__IIIII_3I)},
+#else
+	{(char *)"VtblCall", (char *)"(IJIII[I)I", (void *)OS_NATIVE(VtblCall__IJIII_3I)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIII_3C_3CI) && !defined(JNI64)) || (!defined(NO_VtblCall__IJII_3C_3CI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIII[C[CI)I", (void *)OS_NATIVE(VtblCall__IIII_3C_3CI)},
+#else
+	{(char *)"VtblCall", (char *)"(IJII[C[CI)I", (void *)OS_NATIVE(VtblCall__IJII_3C_3CI)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIIJ) && !defined(JNI64)) || (!defined(NO_VtblCall__IJIJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIIJ)I", (void *)OS_NATIVE(VtblCall__IIIJ)},
+#else
+	{(char *)"VtblCall", (char *)"(IJIJ)I", (void *)OS_NATIVE(VtblCall__IJIJ)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIIJI_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJIJI_3J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIIJI[J)I", (void *)OS_NATIVE(VtblCall__IIIJI_3J)},
+#else
+	{(char *)"VtblCall", (char *)"(IJIJI[J)I", (void *)OS_NATIVE(VtblCall__IJIJI_3J)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIIJJ) && !defined(JNI64)) || (!defined(NO_VtblCall__IJIJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIIJJ)I", (void *)OS_NATIVE(VtblCall__IIIJJ)},
+#else
+	{(char *)"VtblCall", (char *)"(IJIJJ)I", (void *)OS_NATIVE(VtblCall__IJIJJ)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__III_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJI_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(III[I)I", (void *)OS_NATIVE(VtblCall__III_3I)},
+#else
+	{(char *)"VtblCall", (char *)"(IJI[I)I", (void *)OS_NATIVE(VtblCall__IJI_3I)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__III_3I_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJI_3J_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(III[I[I)I", (void *)OS_NATIVE(VtblCall__III_3I_3I)},
+#else
+	{(char *)"VtblCall", (char *)"(IJI[J[I)I", (void *)OS_NATIVE(VtblCall__IJI_3J_3I)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__III_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJI_3J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(III[J)I", (void *)OS_NATIVE(VtblCall__III_3J)},
+#else
+	{(char *)"VtblCall", (char *)"(IJI[J)I", (void *)OS_NATIVE(VtblCall__IJI_3J)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIJ) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIJ)I", (void *)OS_NATIVE(VtblCall__IIJ)},
+#else
+	{(char *)"VtblCall", (char *)"(IJJ)I", (void *)OS_NATIVE(VtblCall__IJJ)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIJI) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIJI)I", (void *)OS_NATIVE(VtblCall__IIJI)},
+#else
+	{(char *)"VtblCall", (char *)"(IJJI)I", (void *)OS_NATIVE(VtblCall__IJJI)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIJII_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJII_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIJII[I)I", (void *)OS_NATIVE(VtblCall__IIJII_3I)},
+#else
+	{(char *)"VtblCall", (char *)"(IJJII[I)I", (void *)OS_NATIVE(VtblCall__IJJII_3I)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIJII_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJII_3J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIJII[J)I", (void *)OS_NATIVE(VtblCall__IIJII_3J)},
+#else
+	{(char *)"VtblCall", (char *)"(IJJII[J)I", (void *)OS_NATIVE(VtblCall__IJJII_3J)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIJI_3C_3CJ) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJI_3C_3CJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIJI[C[CJ)I", (void *)OS_NATIVE(VtblCall__IIJI_3C_3CJ)},
+#else
+	{(char *)"VtblCall", (char *)"(IJJI[C[CJ)I", (void *)OS_NATIVE(VtblCall__IJJI_3C_3CJ)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIJJ) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIJJ)I", (void *)OS_NATIVE(VtblCall__IIJJ)},
+#else
+	{(char *)"VtblCall", (char *)"(IJJJ)I", (void *)OS_NATIVE(VtblCall__IJJJ)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIJJI_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJJI_3J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIJJI[J)I", (void *)OS_NATIVE(VtblCall__IIJJI_3J)},
+#else
+	{(char *)"VtblCall", (char *)"(IJJJI[J)I", (void *)OS_NATIVE(VtblCall__IJJJI_3J)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIJJJ) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJJJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIJJJ)I", (void *)OS_NATIVE(VtblCall__IIJJJ)},
+#else
+	{(char *)"VtblCall", (char *)"(IJJJJ)I", (void *)OS_NATIVE(VtblCall__IJJJJ)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIJ_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJ_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIJ[I)I", (void *)OS_NATIVE(VtblCall__IIJ_3I)},
+#else
+	{(char *)"VtblCall", (char *)"(IJJ[I)I", (void *)OS_NATIVE(VtblCall__IJJ_3I)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIJ_3I_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJ_3I_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIJ[I[I)I", (void *)OS_NATIVE(VtblCall__IIJ_3I_3I)},
+#else
+	{(char *)"VtblCall", (char *)"(IJJ[I[I)I", (void *)OS_NATIVE(VtblCall__IJJ_3I_3I)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIJ_3J_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJJ_3J_3J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIJ[J[J)I", (void *)OS_NATIVE(VtblCall__IIJ_3J_3J)},
+#else
+	{(char *)"VtblCall", (char *)"(IJJ[J[J)I", (void *)OS_NATIVE(VtblCall__IJJ_3J_3J)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IILorg_eclipse_swt_internal_win32_PROPERTYKEY_2I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJLorg_eclipse_swt_internal_win32_PROPERTYKEY_2I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IILorg/eclipse/swt/internal/win32/PROPERTYKEY;I)I", (void *)OS_NATIVE(VtblCall__IILorg_eclipse_swt_internal_win32_PROPERTYKEY_2I)},
+#else
+	{(char *)"VtblCall", (char *)"(IJLorg/eclipse/swt/internal/win32/PROPERTYKEY;I)I", (void *)OS_NATIVE(VtblCall__IJLorg_eclipse_swt_internal_win32_PROPERTYKEY_2I)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IILorg_eclipse_swt_internal_win32_PROPERTYKEY_2J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJLorg_eclipse_swt_internal_win32_PROPERTYKEY_2J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IILorg/eclipse/swt/internal/win32/PROPERTYKEY;J)I", (void *)OS_NATIVE(VtblCall__IILorg_eclipse_swt_internal_win32_PROPERTYKEY_2J)},
+#else
+	{(char *)"VtblCall", (char *)"(IJLorg/eclipse/swt/internal/win32/PROPERTYKEY;J)I", (void *)OS_NATIVE(VtblCall__IJLorg_eclipse_swt_internal_win32_PROPERTYKEY_2J)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IILorg_eclipse_swt_internal_win32_TF_1DISPLAYATTRIBUTE_2) && !defined(JNI64)) || (!defined(NO_VtblCall__IJLorg_eclipse_swt_internal_win32_TF_1DISPLAYATTRIBUTE_2) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IILorg/eclipse/swt/internal/win32/TF_DISPLAYATTRIBUTE;)I", (void *)OS_NATIVE(VtblCall__IILorg_eclipse_swt_internal_win32_TF_1DISPLAYATTRIBUTE_2)},
+#else
+	{(char *)"VtblCall", (char *)"(IJLorg/eclipse/swt/internal/win32/TF_DISPLAYATTRIBUTE;)I", (void *)OS_NATIVE(VtblCall__IJLorg_eclipse_swt_internal_win32_TF_1DISPLAYATTRIBUTE_2)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__IIS_3B_3B_3B) && !defined(JNI64)) || (!defined(NO_VtblCall__IJS_3B_3B_3B) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(IIS[B[B[B)I", (void *)OS_NATIVE(VtblCall__IIS_3B_3B_3B)},
+#else
+	{(char *)"VtblCall", (char *)"(IJS[B[B[B)I", (void *)OS_NATIVE(VtblCall__IJS_3B_3B_3B)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__II_3B_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3B_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(II[B[I)I", (void *)OS_NATIVE(VtblCall__II_3B_3I)},
+#else
+	{(char *)"VtblCall", (char *)"(IJ[B[I)I", (void *)OS_NATIVE(VtblCall__IJ_3B_3I)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__II_3B_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3B_3J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(II[B[J)I", (void *)OS_NATIVE(VtblCall__II_3B_3J)},
+#else
+	{(char *)"VtblCall", (char *)"(IJ[B[J)I", (void *)OS_NATIVE(VtblCall__IJ_3B_3J)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__II_3C) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3C) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(II[C)I", (void *)OS_NATIVE(VtblCall__II_3C)},
+#else
+	{(char *)"VtblCall", (char *)"(IJ[C)I", (void *)OS_NATIVE(VtblCall__IJ_3C)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__II_3CI) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3CI) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(II[CI)I", (void *)OS_NATIVE(VtblCall__II_3CI)},
+#else
+	{(char *)"VtblCall", (char *)"(IJ[CI)I", (void *)OS_NATIVE(VtblCall__IJ_3CI)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__II_3CII_3I_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3CII_3I_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(II[CII[I[I)I", (void *)OS_NATIVE(VtblCall__II_3CII_3I_3I)},
+#else
+	{(char *)"VtblCall", (char *)"(IJ[CII[I[I)I", (void *)OS_NATIVE(VtblCall__IJ_3CII_3I_3I)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__II_3CJ) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3CJ) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(II[CJ)I", (void *)OS_NATIVE(VtblCall__II_3CJ)},
+#else
+	{(char *)"VtblCall", (char *)"(IJ[CJ)I", (void *)OS_NATIVE(VtblCall__IJ_3CJ)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__II_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(II[I)I", (void *)OS_NATIVE(VtblCall__II_3I)},
+#else
+	{(char *)"VtblCall", (char *)"(IJ[I)I", (void *)OS_NATIVE(VtblCall__IJ_3I)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__II_3I_3B_3I) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3I_3B_3I) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(II[I[B[I)I", (void *)OS_NATIVE(VtblCall__II_3I_3B_3I)},
+#else
+	{(char *)"VtblCall", (char *)"(IJ[I[B[I)I", (void *)OS_NATIVE(VtblCall__IJ_3I_3B_3I)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__II_3I_3B_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3I_3B_3J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(II[I[B[J)I", (void *)OS_NATIVE(VtblCall__II_3I_3B_3J)},
+#else
+	{(char *)"VtblCall", (char *)"(IJ[I[B[J)I", (void *)OS_NATIVE(VtblCall__IJ_3I_3B_3J)},
+#endif
+#endif
+#if (!defined(NO_VtblCall__II_3J) && !defined(JNI64)) || (!defined(NO_VtblCall__IJ_3J) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"VtblCall", (char *)"(II[J)I", (void *)OS_NATIVE(VtblCall__II_3J)},
+#else
+	{(char *)"VtblCall", (char *)"(IJ[J)I", (void *)OS_NATIVE(VtblCall__IJ_3J)},
+#endif
+#endif
+#ifndef NO_WINDOWPLACEMENT_1sizeof
+	{(char *)"WINDOWPLACEMENT_sizeof", (char *)"()I", (void *)OS_NATIVE(WINDOWPLACEMENT_1sizeof)},
+#endif
+#ifndef NO_WINDOWPOS_1sizeof
+	{(char *)"WINDOWPOS_sizeof", (char *)"()I", (void *)OS_NATIVE(WINDOWPOS_1sizeof)},
+#endif
+#ifndef NO_WNDCLASS_1sizeof
+	{(char *)"WNDCLASS_sizeof", (char *)"()I", (void *)OS_NATIVE(WNDCLASS_1sizeof)},
+#endif
+#ifndef NO_WaitMessage
+	{(char *)"WaitMessage", (char *)"()Z", (void *)OS_NATIVE(WaitMessage)},
+#endif
+#if (!defined(NO_WideCharToMultiByte__II_3CIII_3B_3Z) && !defined(JNI64)) || (!defined(NO_WideCharToMultiByte__II_3CIJI_3B_3Z) && defined(JNI64))
+#ifndef JNI64
+	{(char *)"WideCharToMultiByte", (char *)"(II[CIII[B[Z)I", (void *)OS_NATIVE(WideCharToMultiByte__II_3CIII_3B_3Z)},
+#else
+	{(char *)"WideCharToMultiByte", (char *)"(II[CIJI[B[Z)I", (void *)OS_NATIVE(WideCharToMultiByte__II_3CIJI_3B_3Z)},
+#endif
+#endif
+#ifndef NO_WideCharToMultiByte__II_3CI_3BI_3B_3Z
+	{(char *)"WideCharToMultiByte", (char *)"(II[CI[BI[B[Z)I", (void *)OS_NATIVE(WideCharToMultiByte__II_3CI_3BI_3B_3Z)},
+#endif
+#ifndef NO_WindowFromDC
+#ifndef JNI64
+	{(char *)"WindowFromDC", (char *)"(I)I", (void *)OS_NATIVE(WindowFromDC)},
+#else
+	{(char *)"WindowFromDC", (char *)"(J)J", (void *)OS_NATIVE(WindowFromDC)},
+#endif
+#endif
+#ifndef NO_WindowFromPoint
+#ifndef JNI64
+	{(char *)"WindowFromPoint", (char *)"(Lorg/eclipse/swt/internal/win32/POINT;)I", (void *)OS_NATIVE(WindowFromPoint)},
+#else
+	{(char *)"WindowFromPoint", (char *)"(Lorg/eclipse/swt/internal/win32/POINT;)J", (void *)OS_NATIVE(WindowFromPoint)},
+#endif
+#endif
+#ifndef NO_sizeofs
+	{(char *)"sizeofs", (char *)"([I)Ljava/lang/String;", (void *)OS_NATIVE(sizeofs)},
+#endif
+#ifndef NO_wcslen
+#ifndef JNI64
+	{(char *)"wcslen", (char *)"(I)I", (void *)OS_NATIVE(wcslen)},
+#else
+	{(char *)"wcslen", (char *)"(J)I", (void *)OS_NATIVE(wcslen)},
+#endif
+#endif
+	{NULL, NULL, NULL}
+};
+JNIEXPORT SWT_NATIVE_CLASS OS_nativeClasses[] = {
+	{"org/eclipse/swt/internal/win32/OS", OS_nativeMethods},
+	{NULL, NULL}
+};
 #endif
-
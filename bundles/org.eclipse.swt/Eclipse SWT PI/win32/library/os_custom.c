@@ -10,9 +10,15 @@
  *******************************************************************************/
 
 #include "swt.h"
+#include "callback.h"
 #include "os_structs.h"
 #include "os_stats.h"
 
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
 #define OS_NATIVE(func) Java_org_eclipse_swt_internal_win32_OS_##func
 
 __declspec(dllexport) HRESULT DllGetVersion(DLLVERSIONINFO *dvi);
@@ -25,15 +31,1152 @@ HRESULT DllGetVersion(DLLVERSIONINFO *dvi)
 	return 1;
 }
 
+/*
+* Back buffers kept for each window by BeginCachedPaint.  The size of a
+* buffer is rounded up to PAINT_BUFFER_GRANULARITY and only ever grows,
+* so that a window being resized reuses the same bitmap.  When the table
+* is full the least recently used buffer that is not painting is freed.
+*/
+#define PAINT_BUFFER_COUNT 16
+#define PAINT_BUFFER_GRANULARITY 64
+
+typedef struct PAINT_BUFFER {
+	HWND hwnd;
+	DWORD threadId;
+	HDC hdc;
+	HBITMAP hBitmap, hOldBitmap;
+	int width, height, savedDC;
+	RECT rect;
+	DWORD lastUse;
+	BOOL painting, released;
+} PAINT_BUFFER;
+
+static PAINT_BUFFER paintBuffers[PAINT_BUFFER_COUNT];
+static DWORD paintBufferTick = 0;
+static CRITICAL_SECTION paintBufferLock;
+
+static void freePaintBuffer(PAINT_BUFFER *buffer)
+{
+	if (buffer->hdc != NULL) {
+		if (buffer->hOldBitmap != NULL) SelectObject(buffer->hdc, buffer->hOldBitmap);
+		DeleteDC(buffer->hdc);
+	}
+	if (buffer->hBitmap != NULL) DeleteObject(buffer->hBitmap);
+	memset(buffer, 0, sizeof(PAINT_BUFFER));
+}
+
+static PAINT_BUFFER *findPaintBuffer(HWND hwnd)
+{
+	int i;
+	for (i = 0; i < PAINT_BUFFER_COUNT; i++) {
+		if (paintBuffers[i].hwnd == hwnd) return &paintBuffers[i];
+	}
+	return NULL;
+}
+
+/*
+* The threads that have a wake WM_NULL posted by PostWakeMessage that has
+* not been removed from their queue yet, so that any number of wakes from
+* other threads post a single message.  A thread leaves the set when its
+* message is removed or when it next sleeps, whichever comes first.
+*/
+#define WAKE_THREAD_COUNT 16
+
+static DWORD wakeThreads[WAKE_THREAD_COUNT];
+static CRITICAL_SECTION wakeLock;
+
+static BOOL clearWake(DWORD threadId)
+{
+	BOOL pending = FALSE;
+	int i;
+	EnterCriticalSection(&wakeLock);
+	for (i = 0; i < WAKE_THREAD_COUNT; i++) {
+		if (wakeThreads[i] == threadId) {
+			wakeThreads[i] = 0;
+			pending = TRUE;
+			break;
+		}
+	}
+	LeaveCriticalSection(&wakeLock);
+	return pending;
+}
+
+/*
+* Fonts created by CreateFontCached, shared by every font created from
+* the same LOGFONTW and deleted when the last of them is released.  The
+* first time a cached font is measured on a device its TEXTMETRICW and
+* the advance widths of the printable ASCII characters are kept, so that
+* GetTextMetricsCached and GetTextExtentPoint32Cached answer without GDI
+* while the font stays selected in DCs of the same resolution.
+*/
+#define FONT_CACHE_COUNT 64
+#define FONT_ASCII_FIRST 0x20
+#define FONT_ASCII_LAST 0x7E
+
+typedef struct FONT_ENTRY {
+	HFONT hFont;
+	int refCount;
+	LOGFONTW logFont;
+	BOOL hasMetrics;
+	int dpi;
+	TEXTMETRICW metrics;
+	INT widths[FONT_ASCII_LAST - FONT_ASCII_FIRST + 1];
+} FONT_ENTRY;
+
+static FONT_ENTRY fontCache[FONT_CACHE_COUNT];
+static CRITICAL_SECTION fontCacheLock;
+
+static FONT_ENTRY *findFont(HFONT hFont)
+{
+	int i;
+	if (hFont == NULL) return NULL;
+	for (i = 0; i < FONT_CACHE_COUNT; i++) {
+		if (fontCache[i].hFont == hFont) return &fontCache[i];
+	}
+	return NULL;
+}
+
+/* Answers the cached font selected in hdc with its metrics for hdc, called with the lock held */
+static FONT_ENTRY *findFontMetrics(HDC hdc)
+{
+#ifndef _WIN32_WCE
+	FONT_ENTRY *entry = findFont((HFONT)GetCurrentObject(hdc, OBJ_FONT));
+	int dpi;
+	if (entry == NULL || GetMapMode(hdc) != MM_TEXT) return NULL;
+	dpi = GetDeviceCaps(hdc, LOGPIXELSY);
+	if (!entry->hasMetrics || entry->dpi != dpi) {
+		entry->hasMetrics = FALSE;
+		if (!GetTextMetricsW(hdc, &entry->metrics)) return NULL;
+		if (!GetCharWidth32W(hdc, FONT_ASCII_FIRST, FONT_ASCII_LAST, entry->widths)) return NULL;
+		entry->dpi = dpi;
+		entry->hasMetrics = TRUE;
+	}
+	return entry;
+#else
+	return NULL;
+#endif
+}
+
+/*
+* Opaque theme parts drawn by DrawThemeBackgroundCached, rendered once
+* into a DIB for each theme handle, part, state and size and copied with
+* BitBlt afterwards.  Only the long lived theme handles of the display
+* are drawn through the cache and FlushThemeCache is called before they
+* are closed, so a handle is never reused for another theme while its
+* parts are cached.  Parts that are partially transparent, larger than
+* THEME_CACHE_MAX_PIXELS or drawn on a mirrored, scaled or rotated DC
+* are drawn directly.  The least recently used entry is replaced when
+* the cache is full.
+*/
+#define THEME_CACHE_COUNT 64
+#define THEME_CACHE_MAX_PIXELS (256 * 256)
+
+typedef struct THEME_ENTRY {
+	jintLong hTheme;
+	jint partId, stateId, width, height;
+	HBITMAP hBitmap;
+	unsigned int lastUse;
+} THEME_ENTRY;
+
+static THEME_ENTRY themeCache[THEME_CACHE_COUNT];
+static unsigned int themeCacheClock;
+static CRITICAL_SECTION themeCacheLock;
+
+/* Answers the cached bitmap of a part, rendering it when missing, called with the lock held */
+static HBITMAP findThemePart(jintLong hTheme, HDC hdc, jint partId, jint stateId, jint width, jint height)
+{
+	THEME_ENTRY *entry = NULL;
+	BITMAPINFOHEADER bmiHeader;
+	HBITMAP hBitmap, oldBitmap;
+	HDC memHdc;
+	RECT rect;
+	void *bits = NULL;
+	int i;
+	for (i = 0; i < THEME_CACHE_COUNT; i++) {
+		THEME_ENTRY *next = &themeCache[i];
+		if (next->hBitmap != NULL && next->hTheme == hTheme && next->partId == partId && next->stateId == stateId && next->width == width && next->height == height) {
+			next->lastUse = ++themeCacheClock;
+			return next->hBitmap;
+		}
+		if (entry == NULL || next->hBitmap == NULL || (entry->hBitmap != NULL && next->lastUse < entry->lastUse)) entry = next;
+	}
+	memset(&bmiHeader, 0, sizeof(bmiHeader));
+	bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+	bmiHeader.biWidth = width;
+	bmiHeader.biHeight = -height;
+	bmiHeader.biPlanes = 1;
+	bmiHeader.biBitCount = 32;
+	bmiHeader.biCompression = BI_RGB;
+	if ((hBitmap = CreateDIBSection(NULL, (BITMAPINFO *)&bmiHeader, DIB_RGB_COLORS, &bits, NULL, 0)) == NULL) return NULL;
+	if ((memHdc = CreateCompatibleDC(hdc)) == NULL) {
+		DeleteObject(hBitmap);
+		return NULL;
+	}
+	oldBitmap = SelectObject(memHdc, hBitmap);
+	rect.left = rect.top = 0;
+	rect.right = width;
+	rect.bottom = height;
+	{
+		OS_LOAD_FUNCTION(fp, DrawThemeBackground)
+		if (fp) {
+			((HRESULT (CALLING_CONVENTION*)(HTHEME, HDC, int, int, const RECT *, const RECT *))fp)((HTHEME)hTheme, memHdc, partId, stateId, &rect, NULL);
+		}
+	}
+	SelectObject(memHdc, oldBitmap);
+	DeleteDC(memHdc);
+	if (entry->hBitmap != NULL) DeleteObject(entry->hBitmap);
+	entry->hTheme = hTheme;
+	entry->partId = partId;
+	entry->stateId = stateId;
+	entry->width = width;
+	entry->height = height;
+	entry->hBitmap = hBitmap;
+	entry->lastUse = ++themeCacheClock;
+	return hBitmap;
+}
+
 HINSTANCE g_hInstance = NULL;
 BOOL WINAPI DllMain(HANDLE hInstDLL, DWORD dwReason, LPVOID lpvReserved)
 {
 	if (dwReason == DLL_PROCESS_ATTACH) {
 		if (g_hInstance == NULL) g_hInstance = hInstDLL;
+		InitializeCriticalSection(&paintBufferLock);
+		InitializeCriticalSection(&wakeLock);
+		InitializeCriticalSection(&fontCacheLock);
+		InitializeCriticalSection(&themeCacheLock);
+	}
+	if (dwReason == DLL_THREAD_DETACH) {
+		callback_thread_detach();
+		swtArenaThreadDetach();
+		swtPoolThreadDetach();
+	}
+	return TRUE;
+}
+
+#ifndef NO_BeginCachedPaint
+JNIEXPORT jintLong JNICALL OS_NATIVE(BeginCachedPaint)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jobject arg2)
+{
+	HWND hwnd = (HWND)arg0;
+	HDC hdcTarget = (HDC)arg1;
+	RECT _arg2, *lparg2=NULL;
+	PAINT_BUFFER *buffer = NULL;
+	int i, width, height;
+	jintLong rc = 0;
+	OS_NATIVE_ENTER(env, that, BeginCachedPaint_FUNC)
+	if (hwnd == NULL || hdcTarget == NULL) goto fail;
+	if (arg2) if ((lparg2 = getRECTFields(env, arg2, &_arg2)) == NULL) goto fail;
+	if (lparg2 == NULL) goto fail;
+	width = lparg2->right - lparg2->left;
+	height = lparg2->bottom - lparg2->top;
+	if (width <= 0 || height <= 0) goto fail;
+	EnterCriticalSection(&paintBufferLock);
+	buffer = findPaintBuffer(hwnd);
+	if (buffer != NULL && buffer->painting) {
+		buffer = NULL;
+	} else {
+		if (buffer == NULL) {
+			for (i = 0; i < PAINT_BUFFER_COUNT; i++) {
+				PAINT_BUFFER *entry = &paintBuffers[i];
+				if (entry->hwnd == NULL) {
+					buffer = entry;
+					break;
+				}
+				if (!entry->painting && (buffer == NULL || entry->lastUse < buffer->lastUse)) buffer = entry;
+			}
+			if (buffer != NULL && buffer->hwnd != NULL) freePaintBuffer(buffer);
+		}
+		if (buffer != NULL && (buffer->width < width || buffer->height < height)) {
+			int newWidth = (width + PAINT_BUFFER_GRANULARITY - 1) / PAINT_BUFFER_GRANULARITY * PAINT_BUFFER_GRANULARITY;
+			int newHeight = (height + PAINT_BUFFER_GRANULARITY - 1) / PAINT_BUFFER_GRANULARITY * PAINT_BUFFER_GRANULARITY;
+			if (newWidth < buffer->width) newWidth = buffer->width;
+			if (newHeight < buffer->height) newHeight = buffer->height;
+			freePaintBuffer(buffer);
+			buffer->hdc = CreateCompatibleDC(hdcTarget);
+			if (buffer->hdc != NULL) buffer->hBitmap = CreateCompatibleBitmap(hdcTarget, newWidth, newHeight);
+			if (buffer->hBitmap == NULL) {
+				freePaintBuffer(buffer);
+				buffer = NULL;
+			} else {
+				buffer->hOldBitmap = SelectObject(buffer->hdc, buffer->hBitmap);
+				buffer->width = newWidth;
+				buffer->height = newHeight;
+			}
+		}
+	}
+	if (buffer != NULL) {
+		buffer->hwnd = hwnd;
+		buffer->threadId = GetCurrentThreadId();
+		buffer->rect = *lparg2;
+		buffer->lastUse = ++paintBufferTick;
+		buffer->painting = TRUE;
+		buffer->released = FALSE;
+		buffer->savedDC = SaveDC(buffer->hdc);
+		SetWindowOrgEx(buffer->hdc, lparg2->left, lparg2->top, NULL);
+		IntersectClipRect(buffer->hdc, lparg2->left, lparg2->top, lparg2->right, lparg2->bottom);
+		rc = (jintLong)buffer->hdc;
+	}
+	LeaveCriticalSection(&paintBufferLock);
+fail:
+	OS_NATIVE_EXIT(env, that, BeginCachedPaint_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_BitBltBatch
+JNIEXPORT jint JNICALL OS_NATIVE(BitBltBatch)
+	(JNIEnv *env, jclass that, jlongArray arg0, jint arg1, jint arg2)
+{
+	jlong *lparg0=NULL;
+	DWORD oldLimit = 0;
+	jint i, rc = 0;
+	OS_NATIVE_ENTER(env, that, BitBltBatch_FUNC)
+	if (arg0 == NULL || arg1 < 0 || arg1 > (*env)->GetArrayLength(env, arg0) / 12) goto fail;
+	if ((lparg0 = (*env)->GetLongArrayElements(env, arg0, NULL)) == NULL) goto fail;
+#ifndef _WIN32_WCE
+	if (arg2 > 0) oldLimit = GdiSetBatchLimit((DWORD)arg2);
+#endif
+	for (i = 0; i < arg1; i++) {
+		jlong *blit = lparg0 + i * 12;
+		HDC hdcDest = (HDC)(jintLong)blit[1], hdcSrc = (HDC)(jintLong)blit[6];
+		int xDest = (int)blit[2], yDest = (int)blit[3], widthDest = (int)blit[4], heightDest = (int)blit[5];
+		int xSrc = (int)blit[7], ySrc = (int)blit[8], widthSrc = (int)blit[9], heightSrc = (int)blit[10];
+		BOOL result = FALSE;
+		switch ((int)blit[0]) {
+			case 0: /* BATCH_BITBLT */
+				result = BitBlt(hdcDest, xDest, yDest, widthDest, heightDest, hdcSrc, xSrc, ySrc, (DWORD)blit[11]);
+				break;
+			case 1: /* BATCH_STRETCHBLT */
+				result = StretchBlt(hdcDest, xDest, yDest, widthDest, heightDest, hdcSrc, xSrc, ySrc, widthSrc, heightSrc, (DWORD)blit[11]);
+				break;
+			case 2: { /* BATCH_ALPHABLEND */
+				jint blend = (jint)blit[11];
+				BLENDFUNCTION blendFunction;
+				blendFunction.BlendOp = (BYTE)(blend & 0xFF);
+				blendFunction.BlendFlags = (BYTE)((blend >> 8) & 0xFF);
+				blendFunction.SourceConstantAlpha = (BYTE)((blend >> 16) & 0xFF);
+				blendFunction.AlphaFormat = (BYTE)((blend >> 24) & 0xFF);
+				{
+					OS_LOAD_FUNCTION(fp, AlphaBlend)
+					if (fp) {
+						result = ((BOOL (CALLING_CONVENTION*)(HDC, int, int, int, int, HDC, int, int, int, int, BLENDFUNCTION))fp)(hdcDest, xDest, yDest, widthDest, heightDest, hdcSrc, xSrc, ySrc, widthSrc, heightSrc, blendFunction);
+					}
+				}
+				break;
+			}
+		}
+		if (result) rc++;
+	}
+#ifndef _WIN32_WCE
+	if (arg2 > 0) {
+		GdiFlush();
+		GdiSetBatchLimit(oldLimit);
 	}
+#endif
+fail:
+	if (arg0 && lparg0) (*env)->ReleaseLongArrayElements(env, arg0, lparg0, JNI_ABORT);
+	OS_NATIVE_EXIT(env, that, BitBltBatch_FUNC)
+	return rc;
+}
+#endif
+
+/*
+* Text and image answers for the cells of list views, kept in native
+* memory so that LVN_GETDISPINFOW can be served from a subclass of the
+* parent window without calling into Java.  Cells are hashed by row and
+* column with open addressing.  Strings are appended to one arena and
+* stored as offsets, so the arena can be reallocated.  The whole cache
+* is cleared when either the table or the arena reaches its limit.
+*/
+#define LVCACHE_UNKNOWN -1
+#define LVCACHE_NONE -2
+#define LVCACHE_MAX_CELLS 65536
+#define LVCACHE_MAX_CHARS (1024 * 1024)
+
+typedef struct LVCACHE_CELL {
+	jint row, column, used;
+	jint textOffset, textLength, image;
+} LVCACHE_CELL;
+
+typedef struct LVCACHE {
+	HWND hwndList, hwndParent;
+	LVCACHE_CELL *cells;
+	jint capacity, count, deleted, maxColumn;
+	WCHAR *chars;
+	jint charCount, charCapacity;
+} LVCACHE;
+
+typedef LRESULT (CALLING_CONVENTION *LVCACHE_SUBCLASSPROC)(HWND, UINT, WPARAM, LPARAM, UINT_PTR, DWORD_PTR);
+static FARPROC lvCacheSetSubclass, lvCacheRemoveSubclass, lvCacheDefProc;
+static const WCHAR LVCACHE_PROP[] = L"SWT.ListViewCache";
+
+static jint lvCacheHash(LVCACHE *cache, jint row, jint column)
+{
+	return (jint)(((unsigned int)row * 0x9E3779B1u) ^ ((unsigned int)column * 0x85EBCA77u)) & (cache->capacity - 1);
+}
+
+static LVCACHE_CELL *lvCacheFind(LVCACHE *cache, jint row, jint column)
+{
+	jint i;
+	if (cache->cells == NULL) return NULL;
+	for (i = lvCacheHash(cache, row, column); cache->cells[i].used != 0; i = (i + 1) & (cache->capacity - 1)) {
+		LVCACHE_CELL *cell = &cache->cells[i];
+		if (cell->used == 1 && cell->row == row && cell->column == column) return cell;
+	}
+	return NULL;
+}
+
+static void lvCacheClear(LVCACHE *cache)
+{
+	if (cache->cells != NULL) free(cache->cells);
+	if (cache->chars != NULL) free(cache->chars);
+	cache->cells = NULL;
+	cache->chars = NULL;
+	cache->capacity = cache->count = cache->deleted = cache->maxColumn = 0;
+	cache->charCount = cache->charCapacity = 0;
+}
+
+static BOOL lvCacheRehash(LVCACHE *cache)
+{
+	LVCACHE_CELL *oldCells = cache->cells;
+	jint i, oldCapacity = cache->capacity;
+	jint capacity = oldCapacity == 0 ? 1024 : (cache->count * 4 >= oldCapacity ? oldCapacity * 2 : oldCapacity);
+	LVCACHE_CELL *cells = calloc(capacity, sizeof(LVCACHE_CELL));
+	if (cells == NULL) return FALSE;
+	cache->cells = cells;
+	cache->capacity = capacity;
+	cache->count = cache->deleted = 0;
+	for (i = 0; i < oldCapacity; i++) {
+		LVCACHE_CELL *cell = &oldCells[i];
+		if (cell->used == 1) {
+			jint j = lvCacheHash(cache, cell->row, cell->column);
+			while (cells[j].used != 0) j = (j + 1) & (capacity - 1);
+			cells[j] = *cell;
+			cache->count++;
+		}
+	}
+	if (oldCells != NULL) free(oldCells);
 	return TRUE;
 }
 
+static void lvCachePut(LVCACHE *cache, jint row, jint column, const jchar *text, jint length, jint image)
+{
+	LVCACHE_CELL *cell = lvCacheFind(cache, row, column);
+	if (cell == NULL) {
+		jint i;
+		if (cache->count >= LVCACHE_MAX_CELLS) lvCacheClear(cache);
+		if ((cache->count + cache->deleted) * 2 >= cache->capacity && !lvCacheRehash(cache)) return;
+		i = lvCacheHash(cache, row, column);
+		while (cache->cells[i].used == 1) i = (i + 1) & (cache->capacity - 1);
+		cell = &cache->cells[i];
+		if (cell->used == 2) cache->deleted--;
+		cell->row = row;
+		cell->column = column;
+		cell->used = 1;
+		cache->count++;
+		if (column > cache->maxColumn) cache->maxColumn = column;
+	}
+	cell->textOffset = length >= 0 ? cache->charCount : length;
+	cell->textLength = 0;
+	cell->image = image;
+	if (length > 0) {
+		if (cache->charCount + length > cache->charCapacity) {
+			jint capacity = cache->charCapacity == 0 ? 4096 : cache->charCapacity;
+			WCHAR *chars;
+			while (capacity < cache->charCount + length) capacity *= 2;
+			if (capacity > LVCACHE_MAX_CHARS || (chars = realloc(cache->chars, capacity * sizeof(WCHAR))) == NULL) {
+				cell->textOffset = LVCACHE_UNKNOWN;
+				return;
+			}
+			cache->chars = chars;
+			cache->charCapacity = capacity;
+		}
+		memcpy(cache->chars + cache->charCount, text, length * sizeof(WCHAR));
+		cache->charCount += length;
+		cell->textLength = length;
+	}
+}
+
+static void lvCacheRemoveRow(LVCACHE *cache, jint row)
+{
+	jint column;
+	for (column = 0; column <= cache->maxColumn; column++) {
+		LVCACHE_CELL *cell = lvCacheFind(cache, row, column);
+		if (cell != NULL) {
+			cell->used = 2;
+			cache->count--;
+			cache->deleted++;
+		}
+	}
+}
+
+static BOOL lvCacheServe(LVCACHE *cache, LVITEMW *item)
+{
+	LVCACHE_CELL *cell;
+	if ((item->mask & ~(LVIF_TEXT | LVIF_IMAGE)) != 0) return FALSE;
+	if ((cell = lvCacheFind(cache, item->iItem, item->iSubItem)) == NULL) return FALSE;
+	if ((item->mask & LVIF_TEXT) && cell->textOffset == LVCACHE_UNKNOWN) return FALSE;
+	if ((item->mask & LVIF_IMAGE) && cell->image == LVCACHE_UNKNOWN) return FALSE;
+	if ((item->mask & LVIF_TEXT) && cell->textOffset != LVCACHE_NONE) {
+		jint length = cell->textLength;
+		if (item->pszText == NULL || item->cchTextMax <= 0) return FALSE;
+		if (length > item->cchTextMax - 1) length = item->cchTextMax - 1;
+		memcpy(item->pszText, cache->chars + cell->textOffset, length * sizeof(WCHAR));
+		item->pszText[length] = 0;
+	}
+	if ((item->mask & LVIF_IMAGE) && cell->image != LVCACHE_NONE) item->iImage = cell->image;
+	return TRUE;
+}
+
+static LRESULT CALLBACK lvCacheProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam, UINT_PTR uIdSubclass, DWORD_PTR dwRefData)
+{
+	LVCACHE *cache = (LVCACHE *)dwRefData;
+	switch (uMsg) {
+		case WM_NOTIFY: {
+			NMLVDISPINFOW *info = (NMLVDISPINFOW *)lParam;
+			if (info->hdr.hwndFrom == cache->hwndList && info->hdr.code == LVN_GETDISPINFOW) {
+				if (lvCacheServe(cache, &info->item)) return 0;
+			}
+			break;
+		}
+		case WM_NCDESTROY:
+			((BOOL (CALLING_CONVENTION*)(HWND, LVCACHE_SUBCLASSPROC, UINT_PTR))lvCacheRemoveSubclass)(hwnd, (LVCACHE_SUBCLASSPROC)lvCacheProc, uIdSubclass);
+			cache->hwndParent = NULL;
+			break;
+	}
+	return ((LRESULT (CALLING_CONVENTION*)(HWND, UINT, WPARAM, LPARAM))lvCacheDefProc)(hwnd, uMsg, wParam, lParam);
+}
+
+static void lvCacheAttach(LVCACHE *cache, HWND hwndParent)
+{
+	if (cache->hwndParent == hwndParent) return;
+	if (cache->hwndParent != NULL) {
+		((BOOL (CALLING_CONVENTION*)(HWND, LVCACHE_SUBCLASSPROC, UINT_PTR))lvCacheRemoveSubclass)(cache->hwndParent, (LVCACHE_SUBCLASSPROC)lvCacheProc, (UINT_PTR)cache);
+		cache->hwndParent = NULL;
+	}
+	if (hwndParent != NULL) {
+		if (((BOOL (CALLING_CONVENTION*)(HWND, LVCACHE_SUBCLASSPROC, UINT_PTR, DWORD_PTR))lvCacheSetSubclass)(hwndParent, (LVCACHE_SUBCLASSPROC)lvCacheProc, (UINT_PTR)cache, (DWORD_PTR)cache)) {
+			cache->hwndParent = hwndParent;
+		}
+	}
+}
+
+#ifndef NO_ClearWakeMessage
+JNIEXPORT jboolean JNICALL OS_NATIVE(ClearWakeMessage)
+	(JNIEnv *env, jclass that)
+{
+	jboolean rc = 0;
+	OS_NATIVE_ENTER(env, that, ClearWakeMessage_FUNC)
+	rc = (jboolean)clearWake(GetCurrentThreadId());
+	OS_NATIVE_EXIT(env, that, ClearWakeMessage_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_CreateFontCached
+JNIEXPORT jintLong JNICALL OS_NATIVE(CreateFontCached)
+	(JNIEnv *env, jclass that, jobject arg0)
+{
+	LOGFONTW _arg0, *lparg0=NULL;
+	FONT_ENTRY *entry = NULL;
+	HFONT hFont = NULL;
+	int i;
+	OS_NATIVE_ENTER(env, that, CreateFontCached_FUNC)
+	if (arg0 == NULL) goto fail;
+	if ((lparg0 = getLOGFONTWFields(env, arg0, &_arg0)) == NULL) goto fail;
+	EnterCriticalSection(&fontCacheLock);
+	for (i = 0; i < FONT_CACHE_COUNT; i++) {
+		FONT_ENTRY *current = &fontCache[i];
+		if (current->hFont == NULL) {
+			if (entry == NULL) entry = current;
+			continue;
+		}
+		if (memcmp(&current->logFont, lparg0, offsetof(LOGFONTW, lfFaceName)) == 0 && wcsncmp(current->logFont.lfFaceName, lparg0->lfFaceName, LF_FACESIZE) == 0) {
+			current->refCount++;
+			hFont = current->hFont;
+			break;
+		}
+	}
+	if (hFont == NULL) {
+		/* A font that does not fit in the cache is not shared */
+		hFont = CreateFontIndirectW(lparg0);
+		if (hFont != NULL && entry != NULL) {
+			memset(entry, 0, sizeof(FONT_ENTRY));
+			entry->hFont = hFont;
+			entry->refCount = 1;
+			entry->logFont = *lparg0;
+		}
+	}
+	LeaveCriticalSection(&fontCacheLock);
+fail:
+	OS_NATIVE_EXIT(env, that, CreateFontCached_FUNC)
+	return (jintLong)hFont;
+}
+#endif
+
+/*
+* A surface for a layered window that is presented with
+* UpdateLayeredWindow: a premultiplied 32-bit top down DIB section
+* selected into a memory DC, kept for the life of the window so that
+* presenting a frame does not allocate anything.
+*/
+typedef struct LAYERED_SURFACE {
+	HDC hdc;
+	HBITMAP hBitmap, hOldBitmap;
+	DWORD *bits;
+	int width, height;
+} LAYERED_SURFACE;
+
+/* UPDATELAYEREDWINDOWINFO, which older SDKs only define for Vista and later */
+typedef struct SWT_UPDATELAYEREDWINDOWINFO {
+	DWORD cbSize;
+	HDC hdcDst;
+	const POINT *pptDst;
+	const SIZE *psize;
+	HDC hdcSrc;
+	const POINT *pptSrc;
+	COLORREF crKey;
+	const BLENDFUNCTION *pblend;
+	DWORD dwFlags;
+	const RECT *prcDirty;
+} SWT_UPDATELAYEREDWINDOWINFO;
+
+#ifndef NO_CreateLayeredSurface
+JNIEXPORT jintLong JNICALL OS_NATIVE(CreateLayeredSurface)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1)
+{
+	LAYERED_SURFACE *surface = NULL;
+	BITMAPINFOHEADER bmiHeader;
+	OS_NATIVE_ENTER(env, that, CreateLayeredSurface_FUNC)
+	if (arg0 <= 0 || arg1 <= 0) goto fail;
+	if ((surface = calloc(1, sizeof(LAYERED_SURFACE))) == NULL) goto fail;
+	memset(&bmiHeader, 0, sizeof(bmiHeader));
+	bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+	bmiHeader.biWidth = arg0;
+	bmiHeader.biHeight = -arg1;
+	bmiHeader.biPlanes = 1;
+	bmiHeader.biBitCount = 32;
+	bmiHeader.biCompression = BI_RGB;
+	surface->hBitmap = CreateDIBSection(NULL, (BITMAPINFO *)&bmiHeader, DIB_RGB_COLORS, (void **)&surface->bits, NULL, 0);
+	if (surface->hBitmap == NULL || (surface->hdc = CreateCompatibleDC(NULL)) == NULL) {
+		if (surface->hBitmap != NULL) DeleteObject(surface->hBitmap);
+		free(surface);
+		surface = NULL;
+		goto fail;
+	}
+	surface->hOldBitmap = SelectObject(surface->hdc, surface->hBitmap);
+	surface->width = arg0;
+	surface->height = arg1;
+fail:
+	OS_NATIVE_EXIT(env, that, CreateLayeredSurface_FUNC)
+	return (jintLong)surface;
+}
+#endif
+
+#ifndef NO_CreateListViewCache
+JNIEXPORT jboolean JNICALL OS_NATIVE(CreateListViewCache)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	LVCACHE *cache;
+	jboolean rc = 0;
+	OS_NATIVE_ENTER(env, that, CreateListViewCache_FUNC)
+	{
+		OS_LOAD_FUNCTION(fp, SetWindowSubclass)
+		lvCacheSetSubclass = fp;
+	}
+	{
+		OS_LOAD_FUNCTION(fp, RemoveWindowSubclass)
+		lvCacheRemoveSubclass = fp;
+	}
+	{
+		OS_LOAD_FUNCTION(fp, DefSubclassProc)
+		lvCacheDefProc = fp;
+	}
+	if (arg0 == 0 || !lvCacheSetSubclass || !lvCacheRemoveSubclass || !lvCacheDefProc) goto fail;
+	if (GetPropW((HWND)arg0, LVCACHE_PROP) != NULL) goto fail;
+	if ((cache = calloc(1, sizeof(LVCACHE))) == NULL) goto fail;
+	cache->hwndList = (HWND)arg0;
+	if (!SetPropW((HWND)arg0, LVCACHE_PROP, cache)) {
+		free(cache);
+		goto fail;
+	}
+	rc = 1;
+fail:
+	OS_NATIVE_EXIT(env, that, CreateListViewCache_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_CreateRectRgnBatch
+/*
+* ExtCreateRegion() fails for large RGNDATA on some versions of Windows,
+* so the rectangles are passed in chunks that are combined.
+*/
+#define RGN_BATCH_SIZE 2000
+
+JNIEXPORT jintLong JNICALL OS_NATIVE(CreateRectRgnBatch)
+	(JNIEnv *env, jclass that, jintArray arg0, jint arg1)
+{
+	jint *lparg0=NULL;
+	RGNDATA *data = NULL;
+	HRGN hrgn = NULL;
+	jint i, j, count;
+	OS_NATIVE_ENTER(env, that, CreateRectRgnBatch_FUNC)
+	if (arg0 == NULL || arg1 < 0 || arg1 > (*env)->GetArrayLength(env, arg0) / 4) goto fail;
+	if ((lparg0 = (*env)->GetIntArrayElements(env, arg0, NULL)) == NULL) goto fail;
+	count = arg1 < RGN_BATCH_SIZE ? arg1 : RGN_BATCH_SIZE;
+	if ((data = (RGNDATA *)malloc(sizeof(RGNDATAHEADER) + (count > 0 ? count : 1) * sizeof(RECT))) == NULL) goto fail;
+	for (i = 0; i == 0 || i < arg1; i += count) {
+		RECT *rects = (RECT *)data->Buffer;
+		jint n = arg1 - i < count ? arg1 - i : count;
+		HRGN chunk;
+		SetRect(&data->rdh.rcBound, 0, 0, 0, 0);
+		for (j = 0; j < n; j++) {
+			jint *rect = lparg0 + (i + j) * 4;
+			SetRect(&rects[j], rect[0], rect[1], rect[0] + rect[2], rect[1] + rect[3]);
+			UnionRect(&data->rdh.rcBound, &data->rdh.rcBound, &rects[j]);
+		}
+		data->rdh.dwSize = sizeof(RGNDATAHEADER);
+		data->rdh.iType = RDH_RECTANGLES;
+		data->rdh.nCount = n;
+		data->rdh.nRgnSize = n * sizeof(RECT);
+		if ((chunk = ExtCreateRegion(NULL, sizeof(RGNDATAHEADER) + n * sizeof(RECT), data)) == NULL) {
+			if (hrgn != NULL) DeleteObject(hrgn);
+			hrgn = NULL;
+			goto fail;
+		}
+		if (hrgn == NULL) {
+			hrgn = chunk;
+		} else {
+			CombineRgn(hrgn, hrgn, chunk, RGN_OR);
+			DeleteObject(chunk);
+		}
+		if (count == 0) break;
+	}
+fail:
+	if (data != NULL) free(data);
+	if (arg0 && lparg0) (*env)->ReleaseIntArrayElements(env, arg0, lparg0, JNI_ABORT);
+	OS_NATIVE_EXIT(env, that, CreateRectRgnBatch_FUNC)
+	return (jintLong)hrgn;
+}
+#endif
+
+#ifndef NO_DecodeNotify
+JNIEXPORT jboolean JNICALL OS_NATIVE(DecodeNotify)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jobject arg3)
+{
+	union {
+		NMHDR hdr;
+		NMLVCUSTOMDRAW lvcd;
+		NMTVCUSTOMDRAW tvcd;
+	} _arg0;
+	jlong *slots = NULL;
+	size_t size;
+	jboolean rc = 0;
+	OS_NATIVE_ENTER(env, that, DecodeNotify_FUNC)
+	if (arg0 == 0 || arg2 < 0 || arg3 == NULL) goto fail;
+	if ((*env)->GetDirectBufferCapacity(env, arg3) < 26 * (jlong)sizeof(jlong)) goto fail;
+	if ((slots = (*env)->GetDirectBufferAddress(env, arg3)) == NULL) goto fail;
+	switch (arg1) {
+		case 0: size = sizeof(NMHDR); break; /* DECODE_NMHDR */
+		case 1: size = sizeof(NMLVCUSTOMDRAW); break; /* DECODE_NMLVCUSTOMDRAW */
+		case 2: size = sizeof(NMTVCUSTOMDRAW); break; /* DECODE_NMTVCUSTOMDRAW */
+		default: goto fail;
+	}
+	/* Copy no more than the caller asked for, as MoveMemory() does */
+	memset(&_arg0, 0, sizeof(_arg0));
+	memmove(&_arg0, (void *)arg0, (size_t)arg2 < size ? (size_t)arg2 : size);
+	slots[0] = (jlong)(jintLong)_arg0.hdr.hwndFrom;
+	slots[1] = (jlong)_arg0.hdr.idFrom;
+	slots[2] = (jlong)(jint)_arg0.hdr.code;
+	if (arg1 != 0) {
+		NMCUSTOMDRAW *nmcd = &_arg0.lvcd.nmcd;
+		slots[3] = (jlong)nmcd->dwDrawStage;
+		slots[4] = (jlong)(jintLong)nmcd->hdc;
+		slots[5] = (jlong)nmcd->rc.left;
+		slots[6] = (jlong)nmcd->rc.top;
+		slots[7] = (jlong)nmcd->rc.right;
+		slots[8] = (jlong)nmcd->rc.bottom;
+		slots[9] = (jlong)nmcd->dwItemSpec;
+		slots[10] = (jlong)nmcd->uItemState;
+		slots[11] = (jlong)nmcd->lItemlParam;
+	}
+	if (arg1 == 1) {
+		NMLVCUSTOMDRAW *lvcd = &_arg0.lvcd;
+		slots[12] = (jlong)(jint)lvcd->clrText;
+		slots[13] = (jlong)(jint)lvcd->clrTextBk;
+		slots[14] = (jlong)lvcd->iSubItem;
+#ifndef _WIN32_WCE
+		slots[15] = (jlong)lvcd->dwItemType;
+		slots[16] = (jlong)(jint)lvcd->clrFace;
+		slots[17] = (jlong)lvcd->iIconEffect;
+		slots[18] = (jlong)lvcd->iIconPhase;
+		slots[19] = (jlong)lvcd->iPartId;
+		slots[20] = (jlong)lvcd->iStateId;
+		slots[21] = (jlong)lvcd->rcText.left;
+		slots[22] = (jlong)lvcd->rcText.top;
+		slots[23] = (jlong)lvcd->rcText.right;
+		slots[24] = (jlong)lvcd->rcText.bottom;
+		slots[25] = (jlong)lvcd->uAlign;
+#endif
+	}
+	if (arg1 == 2) {
+		NMTVCUSTOMDRAW *tvcd = &_arg0.tvcd;
+		slots[12] = (jlong)(jint)tvcd->clrText;
+		slots[13] = (jlong)(jint)tvcd->clrTextBk;
+#ifndef _WIN32_WCE
+		slots[14] = (jlong)tvcd->iLevel;
+#endif
+	}
+	rc = 1;
+fail:
+	OS_NATIVE_EXIT(env, that, DecodeNotify_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_DeferWindowPosBatch
+JNIEXPORT jboolean JNICALL OS_NATIVE(DeferWindowPosBatch)
+	(JNIEnv *env, jclass that, jlongArray arg0, jint arg1)
+{
+	jlong *lparg0=NULL;
+	HDWP hdwp;
+	jint i;
+	jboolean rc = 0;
+	OS_NATIVE_ENTER(env, that, DeferWindowPosBatch_FUNC)
+	if (arg0 == NULL || arg1 < 0 || arg1 > (*env)->GetArrayLength(env, arg0) / 6) goto fail;
+	if ((lparg0 = (*env)->GetLongArrayElements(env, arg0, NULL)) == NULL) goto fail;
+	if ((hdwp = BeginDeferWindowPos(arg1)) == NULL) goto fail;
+	for (i = 0; i < arg1; i++) {
+		jlong *position = lparg0 + i * 6;
+		if (position[0] == 0) continue;
+		/* A failed DeferWindowPos frees the structure, the caller falls back to SetWindowPos */
+		hdwp = DeferWindowPos(hdwp, (HWND)(jintLong)position[0], NULL, (int)position[1], (int)position[2], (int)position[3], (int)position[4], (UINT)position[5]);
+		if (hdwp == NULL) goto fail;
+	}
+	rc = (jboolean)EndDeferWindowPos(hdwp);
+fail:
+	if (arg0 && lparg0) (*env)->ReleaseLongArrayElements(env, arg0, lparg0, JNI_ABORT);
+	OS_NATIVE_EXIT(env, that, DeferWindowPosBatch_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_DestroyLayeredSurface
+JNIEXPORT void JNICALL OS_NATIVE(DestroyLayeredSurface)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	LAYERED_SURFACE *surface = (LAYERED_SURFACE *)arg0;
+	OS_NATIVE_ENTER(env, that, DestroyLayeredSurface_FUNC)
+	if (surface != NULL) {
+		SelectObject(surface->hdc, surface->hOldBitmap);
+		DeleteDC(surface->hdc);
+		DeleteObject(surface->hBitmap);
+		free(surface);
+	}
+	OS_NATIVE_EXIT(env, that, DestroyLayeredSurface_FUNC)
+}
+#endif
+
+#ifndef NO_DestroyListViewCache
+JNIEXPORT void JNICALL OS_NATIVE(DestroyListViewCache)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	LVCACHE *cache;
+	OS_NATIVE_ENTER(env, that, DestroyListViewCache_FUNC)
+	if ((cache = (LVCACHE *)RemovePropW((HWND)arg0, LVCACHE_PROP)) != NULL) {
+		lvCacheAttach(cache, NULL);
+		lvCacheClear(cache);
+		free(cache);
+	}
+	OS_NATIVE_EXIT(env, that, DestroyListViewCache_FUNC)
+}
+#endif
+
+/*
+* Answers the names of the files of a CF_HDROP handle in one string, each
+* followed by a null character, read straight from its DROPFILES rather
+* than with a pair of DragQueryFile calls for each file.  Answers null
+* when the handle cannot be locked or its file list is not terminated.
+*/
+#ifndef NO_DragQueryFiles
+JNIEXPORT jstring JNICALL OS_NATIVE(DragQueryFiles)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	DROPFILES *dropfiles;
+	SIZE_T size, length = 0;
+	jstring rc = NULL;
+	OS_NATIVE_ENTER(env, that, DragQueryFiles_FUNC)
+	size = GlobalSize((HGLOBAL)arg0);
+	if (size < sizeof(DROPFILES)) goto fail;
+	if ((dropfiles = (DROPFILES *)GlobalLock((HGLOBAL)arg0)) == NULL) goto fail;
+	if (dropfiles->pFiles >= sizeof(DROPFILES) && dropfiles->pFiles < size) {
+		BYTE *files = (BYTE *)dropfiles + dropfiles->pFiles;
+		size -= dropfiles->pFiles;
+		if (dropfiles->fWide) {
+			/* The list ends with an empty name */
+			const jchar *chars = (const jchar *)files;
+			SIZE_T count = size / sizeof(jchar);
+			while (length < count && chars[length] != 0) {
+				while (length < count && chars[length] != 0) length++;
+				length++;
+			}
+			if (length < count && length <= 0x7FFFFFFF) rc = (*env)->NewString(env, chars, (jsize)length);
+		} else {
+			const char *bytes = (const char *)files;
+			while (length < size && bytes[length] != 0) {
+				while (length < size && bytes[length] != 0) length++;
+				length++;
+			}
+			if (length < size && length <= 0x7FFFFFFF) {
+				int count = length != 0 ? MultiByteToWideChar(CP_ACP, 0, bytes, (int)length, NULL, 0) : 0;
+				WCHAR *chars = (WCHAR *)malloc((count + 1) * sizeof(WCHAR));
+				if (chars != NULL) {
+					if (count != 0) MultiByteToWideChar(CP_ACP, 0, bytes, (int)length, chars, count);
+					rc = (*env)->NewString(env, (const jchar *)chars, count);
+					free(chars);
+				}
+			}
+		}
+	}
+	GlobalUnlock((HGLOBAL)arg0);
+fail:
+	OS_NATIVE_EXIT(env, that, DragQueryFiles_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_DrawThemeBackgroundCached
+JNIEXPORT jint JNICALL OS_NATIVE(DrawThemeBackgroundCached)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jobject arg4, jobject arg5)
+{
+	RECT _arg4, *lparg4=NULL;
+	RECT _arg5, *lparg5=NULL;
+	jint rc = 0;
+	BOOL cached = FALSE;
+	OS_NATIVE_ENTER(env, that, DrawThemeBackgroundCached_FUNC)
+	if (arg4) if ((lparg4 = getRECTFields(env, arg4, &_arg4)) == NULL) goto fail;
+	if (arg5) if ((lparg5 = getRECTFields(env, arg5, &_arg5)) == NULL) goto fail;
+#ifndef _WIN32_WCE
+	if (arg0 != 0 && lparg4 != NULL && GetMapMode((HDC)arg1) == MM_TEXT && GetGraphicsMode((HDC)arg1) == GM_COMPATIBLE && GetDeviceCaps((HDC)arg1, TECHNOLOGY) == DT_RASDISPLAY) {
+		jint width = lparg4->right - lparg4->left, height = lparg4->bottom - lparg4->top;
+		DWORD layout = 0;
+		BOOL transparent = TRUE;
+		{
+			OS_LOAD_FUNCTION(fp, GetLayout)
+			if (fp) layout = ((DWORD (CALLING_CONVENTION*)(HDC))fp)((HDC)arg1);
+		}
+		{
+			OS_LOAD_FUNCTION(fp, IsThemeBackgroundPartiallyTransparent)
+			if (fp) transparent = ((BOOL (CALLING_CONVENTION*)(HTHEME, int, int))fp)((HTHEME)arg0, arg2, arg3);
+		}
+		if (layout == 0 && !transparent && width > 0 && height > 0 && width * height <= THEME_CACHE_MAX_PIXELS) {
+			RECT rect = *lparg4;
+			if (lparg5 == NULL || IntersectRect(&rect, lparg4, lparg5)) {
+				HDC memHdc;
+				HBITMAP hBitmap, oldBitmap;
+				EnterCriticalSection(&themeCacheLock);
+				hBitmap = findThemePart(arg0, (HDC)arg1, arg2, arg3, width, height);
+				if (hBitmap != NULL && (memHdc = CreateCompatibleDC((HDC)arg1)) != NULL) {
+					oldBitmap = SelectObject(memHdc, hBitmap);
+					cached = BitBlt((HDC)arg1, rect.left, rect.top, rect.right - rect.left, rect.bottom - rect.top, memHdc, rect.left - lparg4->left, rect.top - lparg4->top, SRCCOPY);
+					SelectObject(memHdc, oldBitmap);
+					DeleteDC(memHdc);
+				}
+				LeaveCriticalSection(&themeCacheLock);
+			} else {
+				/* Nothing of the part is inside the clipping rectangle */
+				cached = TRUE;
+			}
+		}
+	}
+#endif
+	if (!cached) {
+		OS_LOAD_FUNCTION(fp, DrawThemeBackground)
+		if (fp) {
+			rc = (jint)((jint (CALLING_CONVENTION*)(HTHEME, HDC, jint, jint, const RECT *, const RECT *))fp)((HTHEME)arg0, (HDC)arg1, arg2, arg3, (const RECT *)lparg4, (const RECT *)lparg5);
+		}
+	}
+fail:
+	OS_NATIVE_EXIT(env, that, DrawThemeBackgroundCached_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_Edit_1GetString
+JNIEXPORT jstring JNICALL OS_NATIVE(Edit_1GetString)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	HLOCAL hText = NULL;
+	const jchar *chars = NULL;
+	jchar *buffer = NULL;
+	int length;
+	jstring rc = NULL;
+	OS_NATIVE_ENTER(env, that, Edit_1GetString_FUNC)
+	length = GetWindowTextLengthW((HWND)arg0);
+	if (length == 0) {
+		rc = (*env)->NewString(env, (const jchar *)L"", 0);
+		goto fail;
+	}
+	/* A multi line edit control lends its own buffer, which saves a copy of the text */
+	if ((GetWindowLongW((HWND)arg0, GWL_STYLE) & ES_MULTILINE) != 0) {
+		hText = (HLOCAL)SendMessageW((HWND)arg0, EM_GETHANDLE, 0, 0);
+		if (hText != NULL) chars = (const jchar *)LocalLock(hText);
+	}
+	if (chars == NULL) {
+		if ((buffer = (jchar *)HeapAlloc(GetProcessHeap(), 0, ((SIZE_T)length + 1) * sizeof(jchar))) == NULL) goto fail;
+		length = GetWindowTextW((HWND)arg0, (LPWSTR)buffer, length + 1);
+		chars = buffer;
+	}
+	rc = (*env)->NewString(env, chars, (jsize)length);
+	if (buffer != NULL) {
+		HeapFree(GetProcessHeap(), 0, buffer);
+	} else {
+		LocalUnlock(hText);
+	}
+fail:
+	OS_NATIVE_EXIT(env, that, Edit_1GetString_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_EndCachedPaint
+JNIEXPORT jboolean JNICALL OS_NATIVE(EndCachedPaint)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jboolean arg2)
+{
+	PAINT_BUFFER *buffer;
+	jboolean rc = 0;
+	OS_NATIVE_ENTER(env, that, EndCachedPaint_FUNC)
+	EnterCriticalSection(&paintBufferLock);
+	buffer = findPaintBuffer((HWND)arg0);
+	if (buffer != NULL && buffer->painting) {
+		RECT *rect = &buffer->rect;
+		rc = 1;
+		if (arg2 && arg1 != 0) {
+			rc = (jboolean)BitBlt((HDC)arg1, rect->left, rect->top, rect->right - rect->left, rect->bottom - rect->top, buffer->hdc, rect->left, rect->top, SRCCOPY);
+		}
+		RestoreDC(buffer->hdc, buffer->savedDC);
+		buffer->painting = FALSE;
+		if (buffer->released) freePaintBuffer(buffer);
+	}
+	LeaveCriticalSection(&paintBufferLock);
+	OS_NATIVE_EXIT(env, that, EndCachedPaint_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_ExtTextOutRuns
+JNIEXPORT jboolean JNICALL OS_NATIVE(ExtTextOutRuns)
+	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jlongArray arg2, jint arg3, jintArray arg4)
+{
+	HDC hdc = (HDC)arg0;
+	HFONT hOldFont = NULL;
+	COLORREF oldColor = CLR_INVALID;
+	jchar *lparg1=NULL;
+	jlong *lparg2=NULL;
+	jint *lparg4=NULL;
+	jsize textLength;
+	jint i;
+	jboolean rc = 0;
+	OS_NATIVE_ENTER(env, that, ExtTextOutRuns_FUNC)
+	if (arg1 == NULL || arg2 == NULL || arg3 < 0) goto fail;
+	if (arg3 > (*env)->GetArrayLength(env, arg2) / 7) goto fail;
+	if (arg4 && arg3 > (*env)->GetArrayLength(env, arg4) / 2) goto fail;
+	textLength = (*env)->GetArrayLength(env, arg1);
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if ((lparg1 = (*env)->GetPrimitiveArrayCritical(env, arg1, NULL)) == NULL) goto fail;
+		if ((lparg2 = (*env)->GetPrimitiveArrayCritical(env, arg2, NULL)) == NULL) goto fail;
+		if (arg4) if ((lparg4 = (*env)->GetPrimitiveArrayCritical(env, arg4, NULL)) == NULL) goto fail;
+	} else
+#endif
+	{
+		if ((lparg1 = (*env)->GetCharArrayElements(env, arg1, NULL)) == NULL) goto fail;
+		if ((lparg2 = (*env)->GetLongArrayElements(env, arg2, NULL)) == NULL) goto fail;
+		if (arg4) if ((lparg4 = (*env)->GetIntArrayElements(env, arg4, NULL)) == NULL) goto fail;
+	}
+	/*
+	* Each run is offset, length, x, y, font, color and options.  A zero
+	* font or a color of -1 keeps the one currently selected.  When an
+	* extents array is given the runs are measured instead of drawn.
+	*/
+	rc = 1;
+	for (i = 0; i < arg3 && rc; i++) {
+		jlong *run = lparg2 + i * 7;
+		jint offset = (jint)run[0], length = (jint)run[1];
+		HFONT hFont = (HFONT)(jintLong)run[4];
+		if (offset < 0 || length < 0 || offset > textLength - length) {
+			rc = 0;
+			break;
+		}
+		if (hFont != NULL) {
+			HFONT hPrevFont = SelectObject(hdc, hFont);
+			if (hOldFont == NULL) hOldFont = hPrevFont;
+		}
+		if (lparg4 != NULL) {
+			SIZE size = {0, 0};
+			rc = (jboolean)GetTextExtentPoint32W(hdc, (LPWSTR)(lparg1 + offset), length, &size);
+			lparg4[i * 2] = size.cx;
+			lparg4[i * 2 + 1] = size.cy;
+		} else {
+			if (run[5] != -1) {
+				COLORREF prevColor = SetTextColor(hdc, (COLORREF)run[5]);
+				if (oldColor == CLR_INVALID) oldColor = prevColor;
+			}
+			rc = (jboolean)ExtTextOutW(hdc, (jint)run[2], (jint)run[3], (UINT)run[6], NULL, (LPWSTR)(lparg1 + offset), length, NULL);
+		}
+	}
+	if (hOldFont != NULL) SelectObject(hdc, hOldFont);
+	if (oldColor != CLR_INVALID) SetTextColor(hdc, oldColor);
+fail:
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (arg4 && lparg4) (*env)->ReleasePrimitiveArrayCritical(env, arg4, lparg4, 0);
+		if (arg2 && lparg2) (*env)->ReleasePrimitiveArrayCritical(env, arg2, lparg2, JNI_ABORT);
+		if (arg1 && lparg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, JNI_ABORT);
+	} else
+#endif
+	{
+		if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, 0);
+		if (arg2 && lparg2) (*env)->ReleaseLongArrayElements(env, arg2, lparg2, JNI_ABORT);
+		if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, JNI_ABORT);
+	}
+	OS_NATIVE_EXIT(env, that, ExtTextOutRuns_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_FlushThemeCache
+JNIEXPORT void JNICALL OS_NATIVE(FlushThemeCache)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	int i;
+	OS_NATIVE_ENTER(env, that, FlushThemeCache_FUNC)
+	EnterCriticalSection(&themeCacheLock);
+	for (i = 0; i < THEME_CACHE_COUNT; i++) {
+		THEME_ENTRY *entry = &themeCache[i];
+		if (entry->hBitmap != NULL && (arg0 == 0 || entry->hTheme == arg0)) {
+			DeleteObject(entry->hBitmap);
+			entry->hBitmap = NULL;
+		}
+	}
+	LeaveCriticalSection(&themeCacheLock);
+	OS_NATIVE_EXIT(env, that, FlushThemeCache_FUNC)
+}
+#endif
+
+#ifndef NO_GetLayeredSurfaceDC
+JNIEXPORT jintLong JNICALL OS_NATIVE(GetLayeredSurfaceDC)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	jintLong rc = 0;
+	OS_NATIVE_ENTER(env, that, GetLayeredSurfaceDC_FUNC)
+	if (arg0 != 0) rc = (jintLong)((LAYERED_SURFACE *)arg0)->hdc;
+	OS_NATIVE_EXIT(env, that, GetLayeredSurfaceDC_FUNC)
+	return rc;
+}
+#endif
+
 #ifndef NO_GetLibraryHandle
 JNIEXPORT jintLong JNICALL OS_NATIVE(GetLibraryHandle)
 	(JNIEnv *env, jclass that)
@@ -46,6 +1189,252 @@ JNIEXPORT jintLong JNICALL OS_NATIVE(GetLibraryHandle)
 }
 #endif
 
+#ifndef NO_GetTextExtentPoint32Cached
+JNIEXPORT jboolean JNICALL OS_NATIVE(GetTextExtentPoint32Cached)
+	(JNIEnv *env, jclass that, jintLong arg0, jcharArray arg1, jint arg2, jobject arg3)
+{
+	jchar *lparg1=NULL;
+	SIZE _arg3;
+	FONT_ENTRY *entry;
+	jint i;
+	jboolean rc = 0;
+	OS_NATIVE_ENTER(env, that, GetTextExtentPoint32Cached_FUNC)
+	if (arg1 == NULL || arg3 == NULL || arg2 < 0 || arg2 > (*env)->GetArrayLength(env, arg1)) goto fail;
+	if ((lparg1 = (*env)->GetCharArrayElements(env, arg1, NULL)) == NULL) goto fail;
+	EnterCriticalSection(&fontCacheLock);
+	entry = findFontMetrics((HDC)arg0);
+	if (entry != NULL && entry->metrics.tmOverhang == 0 && GetTextCharacterExtra((HDC)arg0) == 0) {
+		_arg3.cx = 0;
+		_arg3.cy = entry->metrics.tmHeight;
+		for (i = 0; i < arg2; i++) {
+			jchar c = lparg1[i];
+			if (c < FONT_ASCII_FIRST || c > FONT_ASCII_LAST) break;
+			_arg3.cx += entry->widths[c - FONT_ASCII_FIRST];
+		}
+		rc = i == arg2;
+	}
+	LeaveCriticalSection(&fontCacheLock);
+	if (!rc) rc = (jboolean)GetTextExtentPoint32W((HDC)arg0, (LPCWSTR)lparg1, arg2, &_arg3);
+	if (rc) setSIZEFields(env, arg3, &_arg3);
+fail:
+	if (arg1 && lparg1) (*env)->ReleaseCharArrayElements(env, arg1, lparg1, JNI_ABORT);
+	OS_NATIVE_EXIT(env, that, GetTextExtentPoint32Cached_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_GetTextMetricsCached
+JNIEXPORT jboolean JNICALL OS_NATIVE(GetTextMetricsCached)
+	(JNIEnv *env, jclass that, jintLong arg0, jobject arg1)
+{
+	TEXTMETRICW _arg1;
+	FONT_ENTRY *entry;
+	jboolean rc = 0;
+	OS_NATIVE_ENTER(env, that, GetTextMetricsCached_FUNC)
+	if (arg1 == NULL) goto fail;
+	EnterCriticalSection(&fontCacheLock);
+	if ((entry = findFontMetrics((HDC)arg0)) != NULL) {
+		_arg1 = entry->metrics;
+		rc = 1;
+	}
+	LeaveCriticalSection(&fontCacheLock);
+	if (!rc) rc = (jboolean)GetTextMetricsW((HDC)arg0, &_arg1);
+	if (rc) setTEXTMETRICWFields(env, arg1, &_arg1);
+fail:
+	OS_NATIVE_EXIT(env, that, GetTextMetricsCached_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_GlobalAllocDIB
+JNIEXPORT jintLong JNICALL OS_NATIVE(GlobalAllocDIB)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jbyteArray arg1, jint arg2, jint arg3)
+{
+	jbyte *lparg0=NULL;
+	jbyte *lparg1=NULL;
+	jint headerSize, i;
+	BYTE *dest;
+	jintLong rc = 0;
+	OS_NATIVE_ENTER(env, that, GlobalAllocDIB_FUNC)
+	if (arg0 == NULL || arg1 == NULL || arg2 <= 0 || arg3 <= 0) goto fail;
+	headerSize = (*env)->GetArrayLength(env, arg0);
+	if (arg3 > (*env)->GetArrayLength(env, arg1) / arg2) goto fail;
+	if ((rc = (jintLong)GlobalAlloc(GMEM_FIXED, headerSize + (SIZE_T)arg2 * arg3)) == 0) goto fail;
+	dest = (BYTE *)rc;
+	(*env)->GetByteArrayRegion(env, arg0, 0, headerSize, (jbyte *)dest);
+	/* Packed DIBs are bottom up, so the rows are copied in reverse order */
+	if ((lparg1 = (*env)->GetPrimitiveArrayCritical(env, arg1, NULL)) == NULL) {
+		GlobalFree((HGLOBAL)rc);
+		rc = 0;
+		goto fail;
+	}
+	dest += headerSize + (SIZE_T)arg2 * (arg3 - 1);
+	for (i = 0; i < arg3; i++) {
+		memcpy(dest, lparg1 + (SIZE_T)arg2 * i, arg2);
+		dest -= arg2;
+	}
+fail:
+	if (arg1 && lparg1) (*env)->ReleasePrimitiveArrayCritical(env, arg1, lparg1, JNI_ABORT);
+	OS_NATIVE_EXIT(env, that, GlobalAllocDIB_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_GlobalAllocString
+JNIEXPORT jintLong JNICALL OS_NATIVE(GlobalAllocString)
+	(JNIEnv *env, jclass that, jstring arg0)
+{
+	jsize length;
+	jintLong rc = 0;
+	OS_NATIVE_ENTER(env, that, GlobalAllocString_FUNC)
+	if (arg0 == NULL) goto fail;
+	length = (*env)->GetStringLength(env, arg0);
+	if ((rc = (jintLong)GlobalAlloc(GMEM_FIXED, ((SIZE_T)length + 1) * sizeof(jchar))) == 0) goto fail;
+	(*env)->GetStringRegion(env, arg0, 0, length, (jchar *)rc);
+	((jchar *)rc)[length] = 0;
+fail:
+	OS_NATIVE_EXIT(env, that, GlobalAllocString_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_GlobalGetString
+JNIEXPORT jstring JNICALL OS_NATIVE(GlobalGetString)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	const jchar *chars;
+	SIZE_T size, length = 0;
+	jstring rc = NULL;
+	OS_NATIVE_ENTER(env, that, GlobalGetString_FUNC)
+	size = GlobalSize((HGLOBAL)arg0) / sizeof(jchar);
+	if (size == 0 || size > 0x7FFFFFFF) goto fail;
+	if ((chars = (const jchar *)GlobalLock((HGLOBAL)arg0)) == NULL) goto fail;
+	while (length < size && chars[length] != 0) length++;
+	rc = (*env)->NewString(env, chars, (jsize)length);
+	GlobalUnlock((HGLOBAL)arg0);
+fail:
+	OS_NATIVE_EXIT(env, that, GlobalGetString_FUNC)
+	return rc;
+}
+#endif
+
+/*
+* Appends bitmaps to an image list the way ImageList.copyWithAlpha() does
+* for each of them, sharing the device contexts between the images.  Each
+* bitmap is copied into a 32-bit DIB, its alpha data is merged in place or
+* the copy is made opaque when there is none, and the copy is stretched to
+* the icon size of the list.  Answers the number of bitmaps added, stopping
+* at the first that fails so that the indices of the list stay consecutive.
+*/
+static HBITMAP createDIB32(int width, int height, BYTE **bits)
+{
+	BITMAPINFOHEADER bmiHeader;
+	memset(&bmiHeader, 0, sizeof(bmiHeader));
+	bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+	bmiHeader.biWidth = width;
+	bmiHeader.biHeight = -height;
+	bmiHeader.biPlanes = 1;
+	bmiHeader.biBitCount = 32;
+	bmiHeader.biCompression = BI_RGB;
+	return CreateDIBSection(NULL, (BITMAPINFO *)&bmiHeader, DIB_RGB_COLORS, (void **)bits, NULL, 0);
+}
+
+#ifndef NO_ImageList_1AddBatch
+JNIEXPORT jint JNICALL OS_NATIVE(ImageList_1AddBatch)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLongArray arg1, jobjectArray arg2, jint arg3)
+{
+	jintLong *lparg1=NULL;
+	HDC hdc = NULL, srcHdc = NULL, memHdc = NULL, memHdc2 = NULL;
+	int cx = 0, cy = 0;
+	jint i, rc = 0;
+	OS_NATIVE_ENTER(env, that, ImageList_1AddBatch_FUNC)
+	if (arg1 == NULL || arg3 < 0 || arg3 > (*env)->GetArrayLength(env, arg1)) goto fail;
+	if (arg2 != NULL && arg3 > (*env)->GetArrayLength(env, arg2)) goto fail;
+	if (!ImageList_GetIconSize((HIMAGELIST)arg0, &cx, &cy)) goto fail;
+	if ((lparg1 = (*env)->GetIntLongArrayElements(env, arg1, NULL)) == NULL) goto fail;
+	if ((hdc = GetDC(NULL)) == NULL) goto fail;
+	srcHdc = CreateCompatibleDC(hdc);
+	memHdc = CreateCompatibleDC(hdc);
+	memHdc2 = CreateCompatibleDC(hdc);
+	if (srcHdc == NULL || memHdc == NULL || memHdc2 == NULL) goto fail;
+#ifndef _WIN32_WCE
+	SetStretchBltMode(memHdc2, COLORONCOLOR);
+#endif
+	for (i = 0; i < arg3; i++) {
+		HBITMAP hBitmap = (HBITMAP)lparg1[i], memDib, memDib2 = NULL, oldBitmap, oldMemBitmap;
+		jbyteArray alphaData = NULL;
+		jbyte *alpha = NULL;
+		BYTE *bits = NULL;
+		BITMAP bm;
+		int index = -1, pixels, p;
+		if (GetObject(hBitmap, sizeof(BITMAP), &bm) == 0) break;
+		if ((memDib = createDIB32(bm.bmWidth, bm.bmHeight, &bits)) == NULL) break;
+		pixels = bm.bmWidth * bm.bmHeight;
+
+		/* Get the foreground pixels */
+		oldBitmap = SelectObject(srcHdc, hBitmap);
+		oldMemBitmap = SelectObject(memHdc, memDib);
+		BitBlt(memHdc, 0, 0, bm.bmWidth, bm.bmHeight, srcHdc, 0, 0, SRCCOPY);
+		SelectObject(srcHdc, oldBitmap);
+		GdiFlush();
+
+		/* Merge the alpha channel in place */
+		if (arg2 != NULL) alphaData = (jbyteArray)(*env)->GetObjectArrayElement(env, arg2, i);
+		if (alphaData != NULL && (*env)->GetArrayLength(env, alphaData) >= pixels) {
+			alpha = (*env)->GetByteArrayElements(env, alphaData, NULL);
+		}
+		for (p = 0; p < pixels; p++) {
+			bits[p * 4 + 3] = alpha != NULL ? (BYTE)alpha[p] : 0xFF;
+		}
+		if (alpha != NULL) (*env)->ReleaseByteArrayElements(env, alphaData, alpha, JNI_ABORT);
+		if (alphaData != NULL) (*env)->DeleteLocalRef(env, alphaData);
+
+		/* Stretch to the icon size and add */
+		if (bm.bmWidth != cx || bm.bmHeight != cy) {
+			BYTE *bits2 = NULL;
+			if ((memDib2 = createDIB32(cx, cy, &bits2)) != NULL) {
+				oldBitmap = SelectObject(memHdc2, memDib2);
+				StretchBlt(memHdc2, 0, 0, cx, cy, memHdc, 0, 0, bm.bmWidth, bm.bmHeight, SRCCOPY);
+				SelectObject(memHdc2, oldBitmap);
+			}
+		}
+		SelectObject(memHdc, oldMemBitmap);
+		if (memDib2 != NULL || (bm.bmWidth == cx && bm.bmHeight == cy)) {
+			index = ImageList_Add((HIMAGELIST)arg0, memDib2 != NULL ? memDib2 : memDib, NULL);
+		}
+		if (memDib2 != NULL) DeleteObject(memDib2);
+		DeleteObject(memDib);
+		if (index == -1) break;
+		rc++;
+	}
+fail:
+	if (memHdc2) DeleteDC(memHdc2);
+	if (memHdc) DeleteDC(memHdc);
+	if (srcHdc) DeleteDC(srcHdc);
+	if (hdc) ReleaseDC(NULL, hdc);
+	if (arg1 && lparg1) (*env)->ReleaseIntLongArrayElements(env, arg1, lparg1, JNI_ABORT);
+	OS_NATIVE_EXIT(env, that, ImageList_1AddBatch_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_InvalidateListViewCache
+JNIEXPORT void JNICALL OS_NATIVE(InvalidateListViewCache)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
+{
+	LVCACHE *cache;
+	OS_NATIVE_ENTER(env, that, InvalidateListViewCache_FUNC)
+	if ((cache = (LVCACHE *)GetPropW((HWND)arg0, LVCACHE_PROP)) != NULL) {
+		if (arg1 < 0) {
+			lvCacheClear(cache);
+		} else {
+			lvCacheRemoveRow(cache, arg1);
+		}
+	}
+	OS_NATIVE_EXIT(env, that, InvalidateListViewCache_FUNC)
+}
+#endif
+
 #ifndef NO_IsPPC
 JNIEXPORT jboolean JNICALL OS_NATIVE(IsPPC)
 	(JNIEnv *env, jclass that)
@@ -78,6 +1467,347 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(IsSP)
 }
 #endif
 
+#ifndef NO_LockDIBits
+JNIEXPORT jobject JNICALL OS_NATIVE(LockDIBits)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	DIBSECTION dib;
+	jobject rc = NULL;
+	OS_NATIVE_ENTER(env, that, LockDIBits_FUNC)
+	/*
+	* GDI may still be drawing into the section, so pending calls
+	* are flushed before the bits are handed out for direct access.
+	*/
+#ifndef _WIN32_WCE
+	GdiFlush();
+#endif
+	if (GetObject((HBITMAP)arg0, sizeof(dib), &dib) == sizeof(dib) && dib.dsBm.bmBits != NULL) {
+		jlong size = (jlong)dib.dsBm.bmWidthBytes * abs(dib.dsBm.bmHeight);
+		rc = (*env)->NewDirectByteBuffer(env, dib.dsBm.bmBits, size);
+	}
+	OS_NATIVE_EXIT(env, that, LockDIBits_FUNC)
+	return rc;
+}
+#endif
+
+/*
+* Copies the pixels of an uncompressed packed DIB, locked at arg1 with a
+* size of arg2 bytes, into arg0 top down.  Fails when the DIB is
+* compressed, truncated or larger than arg0.
+*/
+#ifndef NO_MoveDIBBits
+JNIEXPORT jboolean JNICALL OS_NATIVE(MoveDIBBits)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jintLong arg1, jint arg2)
+{
+	BITMAPINFOHEADER *header = (BITMAPINFOHEADER *)arg1;
+	jbyte *lparg0=NULL;
+	SIZE_T offset, stride, height, i;
+	DWORD colors;
+	jboolean rc = 0;
+	OS_NATIVE_ENTER(env, that, MoveDIBBits_FUNC)
+	if (arg0 == NULL || header == NULL || arg2 < (jint)sizeof(BITMAPINFOHEADER)) goto fail;
+	if (header->biSize < sizeof(BITMAPINFOHEADER) || header->biSize > (DWORD)arg2) goto fail;
+	if (header->biCompression != BI_RGB && header->biCompression != BI_BITFIELDS) goto fail;
+	if (header->biWidth <= 0 || header->biHeight == 0 || header->biBitCount == 0) goto fail;
+	colors = header->biClrUsed;
+	if (colors == 0 && header->biBitCount <= 8) colors = 1 << header->biBitCount;
+	if (colors > 256) goto fail;
+	offset = header->biSize + colors * sizeof(RGBQUAD);
+	if (header->biCompression == BI_BITFIELDS && header->biSize == sizeof(BITMAPINFOHEADER)) offset += 3 * sizeof(DWORD);
+	stride = (((SIZE_T)header->biWidth * header->biBitCount + 31) / 32) * 4;
+	height = header->biHeight < 0 ? (SIZE_T)(-(LONGLONG)header->biHeight) : (SIZE_T)header->biHeight;
+	if (offset > (SIZE_T)arg2 || height > ((SIZE_T)arg2 - offset) / stride) goto fail;
+	if (height > (SIZE_T)(*env)->GetArrayLength(env, arg0) / stride) goto fail;
+	if ((lparg0 = (*env)->GetPrimitiveArrayCritical(env, arg0, NULL)) == NULL) goto fail;
+	if (header->biHeight < 0) {
+		memcpy(lparg0, (BYTE *)arg1 + offset, stride * height);
+	} else {
+		for (i = 0; i < height; i++) {
+			memcpy(lparg0 + stride * i, (BYTE *)arg1 + offset + stride * (height - 1 - i), stride);
+		}
+	}
+	rc = 1;
+fail:
+	if (arg0 && lparg0) (*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, 0);
+	OS_NATIVE_EXIT(env, that, MoveDIBBits_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_NewDirectByteBuffer
+JNIEXPORT jobject JNICALL OS_NATIVE(NewDirectByteBuffer)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
+{
+	jobject rc = NULL;
+	OS_NATIVE_ENTER(env, that, NewDirectByteBuffer_FUNC)
+	if (arg0 != 0 && arg1 >= 0) rc = (*env)->NewDirectByteBuffer(env, (void *)arg0, arg1);
+	OS_NATIVE_EXIT(env, that, NewDirectByteBuffer_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_PostWakeMessage
+JNIEXPORT jboolean JNICALL OS_NATIVE(PostWakeMessage)
+	(JNIEnv *env, jclass that, jint arg0)
+{
+	jboolean rc = 0;
+	int i, slot = -1;
+	OS_NATIVE_ENTER(env, that, PostWakeMessage_FUNC)
+	EnterCriticalSection(&wakeLock);
+	for (i = 0; i < WAKE_THREAD_COUNT; i++) {
+		if (wakeThreads[i] == (DWORD)arg0) break;
+		if (wakeThreads[i] == 0 && slot == -1) slot = i;
+	}
+	if (i < WAKE_THREAD_COUNT) {
+		rc = 1;
+	} else {
+		/* Post without coalescing when the set is full */
+		if (slot != -1) wakeThreads[slot] = (DWORD)arg0;
+		rc = (jboolean)PostThreadMessage((DWORD)arg0, WM_NULL, 0, 0);
+		if (!rc && slot != -1) wakeThreads[slot] = 0;
+	}
+	LeaveCriticalSection(&wakeLock);
+	OS_NATIVE_EXIT(env, that, PostWakeMessage_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_PumpMessageW
+JNIEXPORT jint JNICALL OS_NATIVE(PumpMessageW)
+	(JNIEnv *env, jclass that, jobject arg0, jint arg1)
+{
+	MSG _arg0;
+	jint rc = 0;
+	OS_NATIVE_ENTER(env, that, PumpMessageW_FUNC)
+	if (arg0 == NULL) goto fail;
+	if (!PeekMessageW(&_arg0, NULL, 0, 0, PM_REMOVE)) goto fail;
+	if (_arg0.message == WM_NULL && _arg0.hwnd == NULL) clearWake(GetCurrentThreadId());
+	rc = 2;
+	if ((arg1 & 0x4) && _arg0.hwnd != NULL && !IsWindow(_arg0.hwnd)) goto fail; /* PUMP_SKIP_DESTROYED */
+	if ((arg1 & 0x1) && _arg0.message == WM_MOUSEMOVE) { /* PUMP_COALESCE */
+		MSG next;
+		while (PeekMessageW(&next, _arg0.hwnd, WM_MOUSEMOVE, WM_MOUSEMOVE, PM_REMOVE)) _arg0 = next;
+	}
+	if ((arg1 & 0x2) && (_arg0.message < WM_KEYFIRST || _arg0.message > WM_KEYLAST)) { /* PUMP_DISPATCH */
+		TranslateMessage(&_arg0);
+		DispatchMessageW(&_arg0);
+		goto fail;
+	}
+	setMSGFields(env, arg0, &_arg0);
+	rc = 1;
+fail:
+	OS_NATIVE_EXIT(env, that, PumpMessageW_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_ReleaseCachedFont
+JNIEXPORT jboolean JNICALL OS_NATIVE(ReleaseCachedFont)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	FONT_ENTRY *entry;
+	jboolean rc = 0;
+	OS_NATIVE_ENTER(env, that, ReleaseCachedFont_FUNC)
+	EnterCriticalSection(&fontCacheLock);
+	if ((entry = findFont((HFONT)arg0)) != NULL) {
+		if (--entry->refCount == 0) {
+			DeleteObject(entry->hFont);
+			memset(entry, 0, sizeof(FONT_ENTRY));
+		}
+		rc = 1;
+	}
+	LeaveCriticalSection(&fontCacheLock);
+	OS_NATIVE_EXIT(env, that, ReleaseCachedFont_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_ReleaseCachedPaint
+JNIEXPORT void JNICALL OS_NATIVE(ReleaseCachedPaint)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	DWORD threadId = GetCurrentThreadId();
+	int i;
+	OS_NATIVE_ENTER(env, that, ReleaseCachedPaint_FUNC)
+	EnterCriticalSection(&paintBufferLock);
+	for (i = 0; i < PAINT_BUFFER_COUNT; i++) {
+		PAINT_BUFFER *buffer = &paintBuffers[i];
+		if (buffer->hwnd == NULL) continue;
+		if (arg0 != 0 ? buffer->hwnd == (HWND)arg0 : buffer->threadId == threadId) {
+			if (buffer->painting) {
+				buffer->released = TRUE;
+			} else {
+				freePaintBuffer(buffer);
+			}
+		}
+	}
+	LeaveCriticalSection(&paintBufferLock);
+	OS_NATIVE_EXIT(env, that, ReleaseCachedPaint_FUNC)
+}
+#endif
+
+#ifndef NO_SetListViewCacheItem
+JNIEXPORT void JNICALL OS_NATIVE(SetListViewCacheItem)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jcharArray arg2, jintArray arg3, jintArray arg4, jint arg5)
+{
+	LVCACHE *cache;
+	jchar *lparg2=NULL;
+	jint *lparg3=NULL;
+	jint *lparg4=NULL;
+	jsize textLength;
+	jint i;
+	OS_NATIVE_ENTER(env, that, SetListViewCacheItem_FUNC)
+	if ((cache = (LVCACHE *)GetPropW((HWND)arg0, LVCACHE_PROP)) == NULL) goto fail;
+	if (arg1 < 0 || arg2 == NULL || arg3 == NULL || arg4 == NULL || arg5 < 0) goto fail;
+	if (arg5 > (*env)->GetArrayLength(env, arg3) / 2 || arg5 > (*env)->GetArrayLength(env, arg4)) goto fail;
+	textLength = (*env)->GetArrayLength(env, arg2);
+	lvCacheAttach(cache, GetParent((HWND)arg0));
+	if (cache->hwndParent == NULL) goto fail;
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if ((lparg2 = (*env)->GetPrimitiveArrayCritical(env, arg2, NULL)) == NULL) goto fail;
+		if ((lparg3 = (*env)->GetPrimitiveArrayCritical(env, arg3, NULL)) == NULL) goto fail;
+		if ((lparg4 = (*env)->GetPrimitiveArrayCritical(env, arg4, NULL)) == NULL) goto fail;
+	} else
+#endif
+	{
+		if ((lparg2 = (*env)->GetCharArrayElements(env, arg2, NULL)) == NULL) goto fail;
+		if ((lparg3 = (*env)->GetIntArrayElements(env, arg3, NULL)) == NULL) goto fail;
+		if ((lparg4 = (*env)->GetIntArrayElements(env, arg4, NULL)) == NULL) goto fail;
+	}
+	/*
+	* Column i is described by the offset and the length of its text
+	* in lparg3[2*i] and lparg3[2*i+1] and by its image in lparg4[i].
+	* A length or an image of LVCACHE_UNKNOWN is answered by Java and
+	* LVCACHE_NONE leaves the field unchanged.
+	*/
+	for (i = 0; i < arg5; i++) {
+		jint offset = lparg3[i * 2], length = lparg3[i * 2 + 1];
+		if (length >= 0 && (offset < 0 || offset > textLength - length)) length = LVCACHE_UNKNOWN;
+		if (length < LVCACHE_NONE) length = LVCACHE_UNKNOWN;
+		lvCachePut(cache, arg1, i, lparg2 + (length > 0 ? offset : 0), length, lparg4[i] < LVCACHE_NONE ? LVCACHE_UNKNOWN : lparg4[i]);
+	}
+fail:
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if (arg4 && lparg4) (*env)->ReleasePrimitiveArrayCritical(env, arg4, lparg4, JNI_ABORT);
+		if (arg3 && lparg3) (*env)->ReleasePrimitiveArrayCritical(env, arg3, lparg3, JNI_ABORT);
+		if (arg2 && lparg2) (*env)->ReleasePrimitiveArrayCritical(env, arg2, lparg2, JNI_ABORT);
+	} else
+#endif
+	{
+		if (arg4 && lparg4) (*env)->ReleaseIntArrayElements(env, arg4, lparg4, JNI_ABORT);
+		if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, JNI_ABORT);
+		if (arg2 && lparg2) (*env)->ReleaseCharArrayElements(env, arg2, lparg2, JNI_ABORT);
+	}
+	OS_NATIVE_EXIT(env, that, SetListViewCacheItem_FUNC)
+}
+#endif
+
+#ifndef NO_SetWindowTextString
+JNIEXPORT jboolean JNICALL OS_NATIVE(SetWindowTextString)
+	(JNIEnv *env, jclass that, jintLong arg0, jstring arg1)
+{
+	jchar *buffer;
+	jsize length;
+	jboolean rc = 0;
+	OS_NATIVE_ENTER(env, that, SetWindowTextString_FUNC)
+	if (arg1 == NULL) goto fail;
+	length = (*env)->GetStringLength(env, arg1);
+	if ((buffer = (jchar *)HeapAlloc(GetProcessHeap(), 0, ((SIZE_T)length + 1) * sizeof(jchar))) == NULL) goto fail;
+	(*env)->GetStringRegion(env, arg1, 0, length, buffer);
+	buffer[length] = 0;
+	rc = (jboolean)SetWindowTextW((HWND)arg0, (LPCWSTR)buffer);
+	HeapFree(GetProcessHeap(), 0, buffer);
+fail:
+	OS_NATIVE_EXIT(env, that, SetWindowTextString_FUNC)
+	return rc;
+}
+#endif
+
+/*
+* Presents the dirty rectangle of a layered surface in a layered window.
+* GDI leaves the alpha of the pixels it draws undefined, so the pixels of
+* the rectangle that match the transparent color are made transparent and
+* the others opaque first, which keeps them premultiplied.  Only the dirty
+* rectangle is sent when UpdateLayeredWindowIndirect is available.
+*/
+#ifndef NO_UpdateLayeredSurface
+JNIEXPORT jboolean JNICALL OS_NATIVE(UpdateLayeredSurface)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6)
+{
+	LAYERED_SURFACE *surface = (LAYERED_SURFACE *)arg1;
+	RECT dirty, bounds, window;
+	POINT ptDst, ptSrc = {0, 0};
+	SIZE size;
+	BLENDFUNCTION blend;
+	DWORD key;
+	int x, y;
+	jboolean rc = 0;
+	OS_NATIVE_ENTER(env, that, UpdateLayeredSurface_FUNC)
+	if (surface == NULL) goto fail;
+	SetRect(&bounds, 0, 0, surface->width, surface->height);
+	SetRect(&dirty, arg2, arg3, arg2 + arg4, arg3 + arg5);
+	if (!IntersectRect(&dirty, &dirty, &bounds)) {
+		rc = 1;
+		goto fail;
+	}
+	GdiFlush();
+	key = RGB(GetBValue(arg6), GetGValue(arg6), GetRValue(arg6));
+	for (y = dirty.top; y < dirty.bottom; y++) {
+		DWORD *pixel = surface->bits + y * surface->width + dirty.left;
+		for (x = dirty.left; x < dirty.right; x++, pixel++) {
+			*pixel = (*pixel & 0xFFFFFF) == key ? 0 : *pixel | 0xFF000000;
+		}
+	}
+	if (!GetWindowRect((HWND)arg0, &window)) goto fail;
+	ptDst.x = window.left;
+	ptDst.y = window.top;
+	size.cx = surface->width;
+	size.cy = surface->height;
+	blend.BlendOp = AC_SRC_OVER;
+	blend.BlendFlags = 0;
+	blend.SourceConstantAlpha = 0xFF;
+	blend.AlphaFormat = AC_SRC_ALPHA;
+	{
+		OS_LOAD_FUNCTION(fp, UpdateLayeredWindowIndirect)
+		if (fp) {
+			SWT_UPDATELAYEREDWINDOWINFO info;
+			memset(&info, 0, sizeof(info));
+			info.cbSize = sizeof(info);
+			info.pptDst = &ptDst;
+			info.psize = &size;
+			info.hdcSrc = surface->hdc;
+			info.pptSrc = &ptSrc;
+			info.pblend = &blend;
+			info.dwFlags = ULW_ALPHA;
+			info.prcDirty = &dirty;
+			rc = (jboolean)((BOOL (CALLING_CONVENTION*)(HWND, const SWT_UPDATELAYEREDWINDOWINFO *))fp)((HWND)arg0, &info);
+			goto fail;
+		}
+	}
+	{
+		OS_LOAD_FUNCTION(fp, UpdateLayeredWindow)
+		if (fp) {
+			rc = (jboolean)((BOOL (CALLING_CONVENTION*)(HWND, HDC, POINT *, SIZE *, HDC, POINT *, COLORREF, BLENDFUNCTION *, DWORD))fp)((HWND)arg0, NULL, &ptDst, &size, surface->hdc, &ptSrc, 0, &blend, ULW_ALPHA);
+		}
+	}
+fail:
+	OS_NATIVE_EXIT(env, that, UpdateLayeredSurface_FUNC)
+	return rc;
+}
+#endif
+
+#ifndef NO_cacheStructFields
+JNIEXPORT void JNICALL OS_NATIVE(cacheStructFields)
+	(JNIEnv *env, jclass that)
+{
+	OS_NATIVE_ENTER(env, that, cacheStructFields_FUNC)
+	cacheOSStructFields(env);
+	OS_NATIVE_EXIT(env, that, cacheStructFields_FUNC)
+}
+#endif
+
 #if (!defined(NO_SendMessageW__II_3I_3I) && !defined(JNI64)) || (!defined(SendMessageW__JI_3I_3I) && defined(JNI64))
 #ifdef JNI64
 JNIEXPORT jintLong JNICALL OS_NATIVE(SendMessageW__JI_3I_3I)
@@ -33,6 +33,7 @@
 #define CoInternetSetFeatureEnabled_LIB "urlmon.dll"
 #define CreateActCtxW_LIB "kernel32.dll"
 #define CreateActCtxA_LIB "kernel32.dll"
+#define DefSubclassProc_LIB "comctl32.dll"
 #define DrawThemeBackground_LIB "uxtheme.dll"
 #define DrawThemeEdge_LIB "uxtheme.dll"
 #define DrawThemeIcon_LIB "uxtheme.dll"
@@ -74,6 +75,7 @@
 #define ImmDisableTextFrameService_LIB "imm32.dll"
 #define IsAppThemed_LIB "uxtheme.dll"
 #define IsHungAppWindow_LIB "user32.dll"
+#define IsThemeBackgroundPartiallyTransparent_LIB "uxtheme.dll"
 #define IsTouchWindow_LIB "user32.dll"
 #define MCIWndRegisterClass_LIB "msvfw32.dll"
 #define MonitorFromWindow_LIB "user32.dll"
@@ -82,6 +84,7 @@
 #define PrintWindow_LIB "user32.dll"
 #define PSPropertyKeyFromString_LIB "propsys.dll"
 #define RegisterTouchWindow_LIB "user32.dll"
+#define RemoveWindowSubclass_LIB "comctl32.dll"
 #define SetCurrentProcessExplicitAppUserModelID_LIB "shell32.dll"
 #define SetDllDirectoryA_LIB "Kernel32.dll"
 #define SetDllDirectoryW_LIB "Kernel32.dll"
@@ -90,9 +93,11 @@
 #define SetLayout_LIB "gdi32.dll"
 #define SetMenuInfo_LIB "user32.dll"
 #define SetProcessDPIAware_LIB "user32.dll"
+#define SetWindowSubclass_LIB "comctl32.dll"
 #define SetWindowTheme_LIB "uxtheme.dll"
 #define SHCreateItemFromRelativeName_LIB "shell32.dll"
 #define SHCreateItemInKnownFolder_LIB "shell32.dll"
 #define TransparentBlt_LIB "msimg32.dll"
 #define UnregisterTouchWindow_LIB "user32.dll"
 #define UpdateLayeredWindow_LIB "user32.dll"
+#define UpdateLayeredWindowIndirect_LIB "user32.dll"
@@ -37,10 +37,12 @@ char * OS_nativeFunctionNames[] = {
 	"BROWSEINFO_1sizeof",
 	"BUTTON_1IMAGELIST_1sizeof",
 	"BeginBufferedPaint",
+	"BeginCachedPaint",
 	"BeginDeferWindowPos",
 	"BeginPaint",
 	"BeginPath",
 	"BitBlt",
+	"BitBltBatch",
 	"BringWindowToTop",
 	"BufferedPaintInit",
 	"BufferedPaintSetAlpha",
@@ -83,6 +85,7 @@ char * OS_nativeFunctionNames[] = {
 	"ChooseColorW",
 	"ChooseFontA",
 	"ChooseFontW",
+	"ClearWakeMessage",
 	"ClientToScreen",
 	"CloseClipboard",
 	"CloseEnhMetaFile",
@@ -129,6 +132,7 @@ char * OS_nativeFunctionNames[] = {
 #endif
 	"CreateEnhMetaFileA",
 	"CreateEnhMetaFileW",
+	"CreateFontCached",
 #ifndef JNI64
 	"CreateFontIndirectA__I",
 #else
@@ -142,6 +146,8 @@ char * OS_nativeFunctionNames[] = {
 #endif
 	"CreateFontIndirectW__Lorg_eclipse_swt_internal_win32_LOGFONTW_2",
 	"CreateIconIndirect",
+	"CreateLayeredSurface",
+	"CreateListViewCache",
 	"CreateMenu",
 	"CreatePalette",
 	"CreatePatternBrush",
@@ -151,6 +157,7 @@ char * OS_nativeFunctionNames[] = {
 	"CreateProcessA",
 	"CreateProcessW",
 	"CreateRectRgn",
+	"CreateRectRgnBatch",
 	"CreateSolidBrush",
 	"CreateStreamOnHGlobal",
 	"CreateWindowExA",
@@ -166,6 +173,7 @@ char * OS_nativeFunctionNames[] = {
 	"DROPFILES_1sizeof",
 	"DTTOPTS_1sizeof",
 	"DWM_1BLURBEHIND_1sizeof",
+	"DecodeNotify",
 	"DefFrameProcA",
 	"DefFrameProcW",
 	"DefMDIChildProcA",
@@ -173,6 +181,7 @@ char * OS_nativeFunctionNames[] = {
 	"DefWindowProcA",
 	"DefWindowProcW",
 	"DeferWindowPos",
+	"DeferWindowPosBatch",
 	"DeleteDC",
 	"DeleteEnhMetaFile",
 	"DeleteMenu",
@@ -181,6 +190,8 @@ char * OS_nativeFunctionNames[] = {
 	"DestroyCaret",
 	"DestroyCursor",
 	"DestroyIcon",
+	"DestroyLayeredSurface",
+	"DestroyListViewCache",
 	"DestroyMenu",
 	"DestroyWindow",
 	"DispatchMessageA",
@@ -191,6 +202,7 @@ char * OS_nativeFunctionNames[] = {
 	"DragFinish",
 	"DragQueryFileA",
 	"DragQueryFileW",
+	"DragQueryFiles",
 	"DrawAnimatedRects",
 	"DrawEdge",
 	"DrawFocusRect",
@@ -202,6 +214,7 @@ char * OS_nativeFunctionNames[] = {
 	"DrawTextA",
 	"DrawTextW",
 	"DrawThemeBackground",
+	"DrawThemeBackgroundCached",
 	"DrawThemeEdge",
 	"DrawThemeIcon",
 	"DrawThemeParentBackground",
@@ -215,11 +228,13 @@ char * OS_nativeFunctionNames[] = {
 	"EMR_1sizeof",
 	"EXTLOGFONTW_1sizeof",
 	"EXTLOGPEN_1sizeof",
+	"Edit_1GetString",
 	"Ellipse",
 	"EnableMenuItem",
 	"EnableScrollBar",
 	"EnableWindow",
 	"EndBufferedPaint",
+	"EndCachedPaint",
 	"EndDeferWindowPos",
 	"EndDoc",
 	"EndPage",
@@ -243,6 +258,7 @@ char * OS_nativeFunctionNames[] = {
 	"ExtCreatePen",
 	"ExtCreateRegion",
 	"ExtTextOutA",
+	"ExtTextOutRuns",
 	"ExtTextOutW",
 	"ExtractIconExA",
 	"ExtractIconExW",
@@ -254,6 +270,7 @@ char * OS_nativeFunctionNames[] = {
 	"FillRect",
 	"FindWindowA",
 	"FindWindowW",
+	"FlushThemeCache",
 	"FormatMessageA",
 	"FormatMessageW",
 	"FreeLibrary",
@@ -324,6 +341,7 @@ char * OS_nativeFunctionNames[] = {
 	"GetKeyboardState",
 	"GetLastActivePopup",
 	"GetLastError",
+	"GetLayeredSurfaceDC",
 	"GetLayeredWindowAttributes",
 	"GetLayout",
 	"GetLibraryHandle",
@@ -456,8 +474,10 @@ char * OS_nativeFunctionNames[] = {
 	"GetTextCharset",
 	"GetTextColor",
 	"GetTextExtentPoint32A",
+	"GetTextExtentPoint32Cached",
 	"GetTextExtentPoint32W",
 	"GetTextMetricsA",
+	"GetTextMetricsCached",
 	"GetTextMetricsW",
 	"GetThemeBackgroundContentRect",
 	"GetThemeBackgroundExtent",
@@ -500,7 +520,10 @@ char * OS_nativeFunctionNames[] = {
 	"GlobalAddAtomA",
 	"GlobalAddAtomW",
 	"GlobalAlloc",
+	"GlobalAllocDIB",
+	"GlobalAllocString",
 	"GlobalFree",
+	"GlobalGetString",
 	"GlobalLock",
 	"GlobalSize",
 	"GlobalUnlock",
@@ -521,6 +544,7 @@ char * OS_nativeFunctionNames[] = {
 	"INITCOMMONCONTROLSEX_1sizeof",
 	"INPUT_1sizeof",
 	"ImageList_1Add",
+	"ImageList_1AddBatch",
 	"ImageList_1AddMasked",
 	"ImageList_1BeginDrag",
 	"ImageList_1Create",
@@ -598,6 +622,7 @@ char * OS_nativeFunctionNames[] = {
 	"InternetSetOption",
 	"IntersectClipRect",
 	"IntersectRect",
+	"InvalidateListViewCache",
 	"InvalidateRect",
 	"InvalidateRgn",
 	"IsAppThemed",
@@ -658,6 +683,7 @@ char * OS_nativeFunctionNames[] = {
 	"LoadStringA",
 	"LoadStringW",
 	"LocalFree",
+	"LockDIBits",
 	"LockWindowUpdate",
 	"MAKELPARAM",
 	"MAKELRESULT",
@@ -692,6 +718,7 @@ char * OS_nativeFunctionNames[] = {
 	"MessageBoxW",
 	"ModifyWorldTransform",
 	"MonitorFromWindow",
+	"MoveDIBBits",
 #ifndef JNI64
 	"MoveMemory__III",
 #else
@@ -1220,6 +1247,7 @@ char * OS_nativeFunctionNames[] = {
 	"NONCLIENTMETRICSW_1sizeof",
 	"NOTIFYICONDATAA_1V2_1SIZE",
 	"NOTIFYICONDATAW_1V2_1SIZE",
+	"NewDirectByteBuffer",
 	"NotifyWinEvent",
 	"OFNOTIFY_1sizeof",
 	"OPENFILENAME_1sizeof",
@@ -1259,11 +1287,13 @@ char * OS_nativeFunctionNames[] = {
 	"PostMessageW",
 	"PostThreadMessageA",
 	"PostThreadMessageW",
+	"PostWakeMessage",
 	"PrintDlgA",
 	"PrintDlgW",
 	"PrintWindow",
 	"PtInRect",
 	"PtInRegion",
+	"PumpMessageW",
 	"REBARBANDINFO_1sizeof",
 	"RECT_1sizeof",
 	"RealizePalette",
@@ -1310,6 +1340,8 @@ char * OS_nativeFunctionNames[] = {
 	"RegisterTouchWindow",
 	"RegisterWindowMessageA",
 	"RegisterWindowMessageW",
+	"ReleaseCachedFont",
+	"ReleaseCachedPaint",
 	"ReleaseCapture",
 	"ReleaseDC",
 	"RemoveMenu",
@@ -1741,6 +1773,7 @@ char * OS_nativeFunctionNames[] = {
 	"SetGraphicsMode",
 	"SetLayeredWindowAttributes",
 	"SetLayout",
+	"SetListViewCacheItem",
 	"SetMapMode",
 	"SetMapperFlags",
 	"SetMenu",
@@ -1776,6 +1809,7 @@ char * OS_nativeFunctionNames[] = {
 	"SetWindowPos",
 	"SetWindowRgn",
 	"SetWindowTextA",
+	"SetWindowTextString",
 	"SetWindowTextW",
 	"SetWindowTheme",
 	"SetWindowsHookExA",
@@ -1840,6 +1874,7 @@ char * OS_nativeFunctionNames[] = {
 	"UnregisterClassA",
 	"UnregisterClassW",
 	"UnregisterTouchWindow",
+	"UpdateLayeredSurface",
 	"UpdateLayeredWindow",
 	"UpdateWindow",
 	"UrlCreateFromPathA",
@@ -2044,11 +2079,16 @@ char * OS_nativeFunctionNames[] = {
 	"WideCharToMultiByte__II_3CI_3BI_3B_3Z",
 	"WindowFromDC",
 	"WindowFromPoint",
+	"cacheStructFields",
+	"sizeofs",
 	"wcslen",
 };
 #define NATIVE_FUNCTION_COUNT sizeof(OS_nativeFunctionNames) / sizeof(char*)
 int OS_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int OS_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong OS_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT OS_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS OS_nativeStats = {OS_nativeFunctionCallCount, OS_nativeFunctionCallTime, OS_nativeFunctionEvents, 0, "OS", OS_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -2070,4 +2110,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetFunctionCallCount)
 	return OS_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(OS_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return OS_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(OS_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &OS_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(OS_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(OS_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
@@ -13,8 +13,9 @@
 extern int OS_nativeFunctionCount;
 extern int OS_nativeFunctionCallCount[];
 extern char* OS_nativeFunctionNames[];
-#define OS_NATIVE_ENTER(env, that, func) OS_nativeFunctionCallCount[func]++;
-#define OS_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS OS_nativeStats;
+#define OS_NATIVE_ENTER(env, that, func) nativeStatsEnter(&OS_nativeStats, func);
+#define OS_NATIVE_EXIT(env, that, func) nativeStatsExit(&OS_nativeStats, func);
 #else
 #ifndef OS_NATIVE_ENTER
 #define OS_NATIVE_ENTER(env, that, func) 
@@ -47,10 +48,12 @@ typedef enum {
 	BROWSEINFO_1sizeof_FUNC,
 	BUTTON_1IMAGELIST_1sizeof_FUNC,
 	BeginBufferedPaint_FUNC,
+	BeginCachedPaint_FUNC,
 	BeginDeferWindowPos_FUNC,
 	BeginPaint_FUNC,
 	BeginPath_FUNC,
 	BitBlt_FUNC,
+	BitBltBatch_FUNC,
 	BringWindowToTop_FUNC,
 	BufferedPaintInit_FUNC,
 	BufferedPaintSetAlpha_FUNC,
@@ -93,6 +96,7 @@ typedef enum {
 	ChooseColorW_FUNC,
 	ChooseFontA_FUNC,
 	ChooseFontW_FUNC,
+	ClearWakeMessage_FUNC,
 	ClientToScreen_FUNC,
 	CloseClipboard_FUNC,
 	CloseEnhMetaFile_FUNC,
@@ -139,6 +143,7 @@ typedef enum {
 #endif
 	CreateEnhMetaFileA_FUNC,
 	CreateEnhMetaFileW_FUNC,
+	CreateFontCached_FUNC,
 #ifndef JNI64
 	CreateFontIndirectA__I_FUNC,
 #else
@@ -152,6 +157,8 @@ typedef enum {
 #endif
 	CreateFontIndirectW__Lorg_eclipse_swt_internal_win32_LOGFONTW_2_FUNC,
 	CreateIconIndirect_FUNC,
+	CreateLayeredSurface_FUNC,
+	CreateListViewCache_FUNC,
 	CreateMenu_FUNC,
 	CreatePalette_FUNC,
 	CreatePatternBrush_FUNC,
@@ -161,6 +168,7 @@ typedef enum {
 	CreateProcessA_FUNC,
 	CreateProcessW_FUNC,
 	CreateRectRgn_FUNC,
+	CreateRectRgnBatch_FUNC,
 	CreateSolidBrush_FUNC,
 	CreateStreamOnHGlobal_FUNC,
 	CreateWindowExA_FUNC,
@@ -176,6 +184,7 @@ typedef enum {
 	DROPFILES_1sizeof_FUNC,
 	DTTOPTS_1sizeof_FUNC,
 	DWM_1BLURBEHIND_1sizeof_FUNC,
+	DecodeNotify_FUNC,
 	DefFrameProcA_FUNC,
 	DefFrameProcW_FUNC,
 	DefMDIChildProcA_FUNC,
@@ -183,6 +192,7 @@ typedef enum {
 	DefWindowProcA_FUNC,
 	DefWindowProcW_FUNC,
 	DeferWindowPos_FUNC,
+	DeferWindowPosBatch_FUNC,
 	DeleteDC_FUNC,
 	DeleteEnhMetaFile_FUNC,
 	DeleteMenu_FUNC,
@@ -191,6 +201,8 @@ typedef enum {
 	DestroyCaret_FUNC,
 	DestroyCursor_FUNC,
 	DestroyIcon_FUNC,
+	DestroyLayeredSurface_FUNC,
+	DestroyListViewCache_FUNC,
 	DestroyMenu_FUNC,
 	DestroyWindow_FUNC,
 	DispatchMessageA_FUNC,
@@ -201,6 +213,7 @@ typedef enum {
 	DragFinish_FUNC,
 	DragQueryFileA_FUNC,
 	DragQueryFileW_FUNC,
+	DragQueryFiles_FUNC,
 	DrawAnimatedRects_FUNC,
 	DrawEdge_FUNC,
 	DrawFocusRect_FUNC,
@@ -212,6 +225,7 @@ typedef enum {
 	DrawTextA_FUNC,
 	DrawTextW_FUNC,
 	DrawThemeBackground_FUNC,
+	DrawThemeBackgroundCached_FUNC,
 	DrawThemeEdge_FUNC,
 	DrawThemeIcon_FUNC,
 	DrawThemeParentBackground_FUNC,
@@ -225,11 +239,13 @@ typedef enum {
 	EMR_1sizeof_FUNC,
 	EXTLOGFONTW_1sizeof_FUNC,
 	EXTLOGPEN_1sizeof_FUNC,
+	Edit_1GetString_FUNC,
 	Ellipse_FUNC,
 	EnableMenuItem_FUNC,
 	EnableScrollBar_FUNC,
 	EnableWindow_FUNC,
 	EndBufferedPaint_FUNC,
+	EndCachedPaint_FUNC,
 	EndDeferWindowPos_FUNC,
 	EndDoc_FUNC,
 	EndPage_FUNC,
@@ -253,6 +269,7 @@ typedef enum {
 	ExtCreatePen_FUNC,
 	ExtCreateRegion_FUNC,
 	ExtTextOutA_FUNC,
+	ExtTextOutRuns_FUNC,
 	ExtTextOutW_FUNC,
 	ExtractIconExA_FUNC,
 	ExtractIconExW_FUNC,
@@ -264,6 +281,7 @@ typedef enum {
 	FillRect_FUNC,
 	FindWindowA_FUNC,
 	FindWindowW_FUNC,
+	FlushThemeCache_FUNC,
 	FormatMessageA_FUNC,
 	FormatMessageW_FUNC,
 	FreeLibrary_FUNC,
@@ -334,6 +352,7 @@ typedef enum {
 	GetKeyboardState_FUNC,
 	GetLastActivePopup_FUNC,
 	GetLastError_FUNC,
+	GetLayeredSurfaceDC_FUNC,
 	GetLayeredWindowAttributes_FUNC,
 	GetLayout_FUNC,
 	GetLibraryHandle_FUNC,
@@ -466,8 +485,10 @@ typedef enum {
 	GetTextCharset_FUNC,
 	GetTextColor_FUNC,
 	GetTextExtentPoint32A_FUNC,
+	GetTextExtentPoint32Cached_FUNC,
 	GetTextExtentPoint32W_FUNC,
 	GetTextMetricsA_FUNC,
+	GetTextMetricsCached_FUNC,
 	GetTextMetricsW_FUNC,
 	GetThemeBackgroundContentRect_FUNC,
 	GetThemeBackgroundExtent_FUNC,
@@ -510,7 +531,10 @@ typedef enum {
 	GlobalAddAtomA_FUNC,
 	GlobalAddAtomW_FUNC,
 	GlobalAlloc_FUNC,
+	GlobalAllocDIB_FUNC,
+	GlobalAllocString_FUNC,
 	GlobalFree_FUNC,
+	GlobalGetString_FUNC,
 	GlobalLock_FUNC,
 	GlobalSize_FUNC,
 	GlobalUnlock_FUNC,
@@ -531,6 +555,7 @@ typedef enum {
 	INITCOMMONCONTROLSEX_1sizeof_FUNC,
 	INPUT_1sizeof_FUNC,
 	ImageList_1Add_FUNC,
+	ImageList_1AddBatch_FUNC,
 	ImageList_1AddMasked_FUNC,
 	ImageList_1BeginDrag_FUNC,
 	ImageList_1Create_FUNC,
@@ -608,6 +633,7 @@ typedef enum {
 	InternetSetOption_FUNC,
 	IntersectClipRect_FUNC,
 	IntersectRect_FUNC,
+	InvalidateListViewCache_FUNC,
 	InvalidateRect_FUNC,
 	InvalidateRgn_FUNC,
 	IsAppThemed_FUNC,
@@ -668,6 +694,7 @@ typedef enum {
 	LoadStringA_FUNC,
 	LoadStringW_FUNC,
 	LocalFree_FUNC,
+	LockDIBits_FUNC,
 	LockWindowUpdate_FUNC,
 	MAKELPARAM_FUNC,
 	MAKELRESULT_FUNC,
@@ -702,6 +729,7 @@ typedef enum {
 	MessageBoxW_FUNC,
 	ModifyWorldTransform_FUNC,
 	MonitorFromWindow_FUNC,
+	MoveDIBBits_FUNC,
 #ifndef JNI64
 	MoveMemory__III_FUNC,
 #else
@@ -1230,6 +1258,7 @@ typedef enum {
 	NONCLIENTMETRICSW_1sizeof_FUNC,
 	NOTIFYICONDATAA_1V2_1SIZE_FUNC,
 	NOTIFYICONDATAW_1V2_1SIZE_FUNC,
+	NewDirectByteBuffer_FUNC,
 	NotifyWinEvent_FUNC,
 	OFNOTIFY_1sizeof_FUNC,
 	OPENFILENAME_1sizeof_FUNC,
@@ -1269,11 +1298,13 @@ typedef enum {
 	PostMessageW_FUNC,
 	PostThreadMessageA_FUNC,
 	PostThreadMessageW_FUNC,
+	PostWakeMessage_FUNC,
 	PrintDlgA_FUNC,
 	PrintDlgW_FUNC,
 	PrintWindow_FUNC,
 	PtInRect_FUNC,
 	PtInRegion_FUNC,
+	PumpMessageW_FUNC,
 	REBARBANDINFO_1sizeof_FUNC,
 	RECT_1sizeof_FUNC,
 	RealizePalette_FUNC,
@@ -1320,6 +1351,8 @@ typedef enum {
 	RegisterTouchWindow_FUNC,
 	RegisterWindowMessageA_FUNC,
 	RegisterWindowMessageW_FUNC,
+	ReleaseCachedFont_FUNC,
+	ReleaseCachedPaint_FUNC,
 	ReleaseCapture_FUNC,
 	ReleaseDC_FUNC,
 	RemoveMenu_FUNC,
@@ -1751,6 +1784,7 @@ typedef enum {
 	SetGraphicsMode_FUNC,
 	SetLayeredWindowAttributes_FUNC,
 	SetLayout_FUNC,
+	SetListViewCacheItem_FUNC,
 	SetMapMode_FUNC,
 	SetMapperFlags_FUNC,
 	SetMenu_FUNC,
@@ -1786,6 +1820,7 @@ typedef enum {
 	SetWindowPos_FUNC,
 	SetWindowRgn_FUNC,
 	SetWindowTextA_FUNC,
+	SetWindowTextString_FUNC,
 	SetWindowTextW_FUNC,
 	SetWindowTheme_FUNC,
 	SetWindowsHookExA_FUNC,
@@ -1850,6 +1885,7 @@ typedef enum {
 	UnregisterClassA_FUNC,
 	UnregisterClassW_FUNC,
 	UnregisterTouchWindow_FUNC,
+	UpdateLayeredSurface_FUNC,
 	UpdateLayeredWindow_FUNC,
 	UpdateWindow_FUNC,
 	UrlCreateFromPathA_FUNC,
@@ -2054,5 +2090,7 @@ typedef enum {
 	WideCharToMultiByte__II_3CI_3BI_3B_3Z_FUNC,
 	WindowFromDC_FUNC,
 	WindowFromPoint_FUNC,
+	cacheStructFields_FUNC,
+	sizeofs_FUNC,
 	wcslen_FUNC,
 } OS_FUNCS;
@@ -3934,7 +3934,12 @@ MSG_FID_CACHE MSGFc;
 void cacheMSGFields(JNIEnv *env, jobject lpObject)
 {
 	if (MSGFc.cached) return;
-	MSGFc.clazz = (*env)->GetObjectClass(env, lpObject);
+	if (lpObject != NULL) {
+		MSGFc.clazz = (*env)->GetObjectClass(env, lpObject);
+	} else {
+		MSGFc.clazz = (*env)->FindClass(env, "org/eclipse/swt/internal/win32/MSG");
+		if (MSGFc.clazz == NULL) return;
+	}
 	MSGFc.hwnd = (*env)->GetFieldID(env, MSGFc.clazz, "hwnd", I_J);
 	MSGFc.message = (*env)->GetFieldID(env, MSGFc.clazz, "message", "I");
 	MSGFc.wParam = (*env)->GetFieldID(env, MSGFc.clazz, "wParam", I_J);
@@ -6782,7 +6787,12 @@ POINT_FID_CACHE POINTFc;
 void cachePOINTFields(JNIEnv *env, jobject lpObject)
 {
 	if (POINTFc.cached) return;
-	POINTFc.clazz = (*env)->GetObjectClass(env, lpObject);
+	if (lpObject != NULL) {
+		POINTFc.clazz = (*env)->GetObjectClass(env, lpObject);
+	} else {
+		POINTFc.clazz = (*env)->FindClass(env, "org/eclipse/swt/internal/win32/POINT");
+		if (POINTFc.clazz == NULL) return;
+	}
 	POINTFc.x = (*env)->GetFieldID(env, POINTFc.clazz, "x", "I");
 	POINTFc.y = (*env)->GetFieldID(env, POINTFc.clazz, "y", "I");
 	POINTFc.cached = 1;
@@ -7073,7 +7083,12 @@ RECT_FID_CACHE RECTFc;
 void cacheRECTFields(JNIEnv *env, jobject lpObject)
 {
 	if (RECTFc.cached) return;
-	RECTFc.clazz = (*env)->GetObjectClass(env, lpObject);
+	if (lpObject != NULL) {
+		RECTFc.clazz = (*env)->GetObjectClass(env, lpObject);
+	} else {
+		RECTFc.clazz = (*env)->FindClass(env, "org/eclipse/swt/internal/win32/RECT");
+		if (RECTFc.clazz == NULL) return;
+	}
 	RECTFc.left = (*env)->GetFieldID(env, RECTFc.clazz, "left", "I");
 	RECTFc.top = (*env)->GetFieldID(env, RECTFc.clazz, "top", "I");
 	RECTFc.right = (*env)->GetFieldID(env, RECTFc.clazz, "right", "I");
@@ -9520,3 +9535,17 @@ void setWNDCLASSFields(JNIEnv *env, jobject lpObject, WNDCLASS *lpStruct)
 }
 #endif
 
+void cacheOSStructFields(JNIEnv *env)
+{
+#ifndef NO_MSG
+	cacheMSGFields(env, NULL);
+#endif
+#ifndef NO_POINT
+	cachePOINTFields(env, NULL);
+#endif
+#ifndef NO_RECT
+	cacheRECTFields(env, NULL);
+#endif
+	(*env)->ExceptionClear(env);
+}
+
@@ -2027,3 +2027,5 @@ void setWNDCLASSFields(JNIEnv *env, jobject lpObject, WNDCLASS *lpStruct);
 #define WNDCLASS_sizeof() 0
 #endif
 
+void cacheOSStructFields(JNIEnv *env);
+
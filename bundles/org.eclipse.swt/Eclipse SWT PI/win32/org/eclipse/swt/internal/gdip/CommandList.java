@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.internal.gdip;
+
+import java.nio.*;
+
+/**
+ * Records GDI+ drawing operations into a direct buffer so that they can
+ * be replayed against a <code>Graphics</code> with a single native call.
+ * <p>
+ * Every command is a sequence of 64 bit slots in native byte order: the
+ * opcode, followed by its arguments.  The characters of a string follow
+ * its length and are padded to the next slot.
+ * </p>
+ */
+public class CommandList {
+	ByteBuffer buffer;
+
+	static final int SLOT = 8;
+
+public CommandList () {
+	this (4096);
+}
+
+public CommandList (int capacity) {
+	buffer = ByteBuffer.allocateDirect (Math.max (capacity, SLOT) & ~(SLOT - 1));
+	buffer.order (ByteOrder.nativeOrder ());
+}
+
+void ensure (int slots) {
+	int size = slots * SLOT;
+	if (buffer.remaining () >= size) return;
+	int capacity = buffer.capacity ();
+	while (capacity - buffer.position () < size) capacity *= 2;
+	ByteBuffer newBuffer = ByteBuffer.allocateDirect (capacity);
+	newBuffer.order (ByteOrder.nativeOrder ());
+	buffer.flip ();
+	newBuffer.put (buffer);
+	buffer = newBuffer;
+}
+
+void shape (int opcode, long /*int*/ handle, int x, int y, int width, int height) {
+	ensure (6);
+	buffer.putLong (opcode);
+	buffer.putLong (handle);
+	buffer.putLong (x);
+	buffer.putLong (y);
+	buffer.putLong (width);
+	buffer.putLong (height);
+}
+
+public void drawEllipse (long /*int*/ pen, int x, int y, int width, int height) {
+	shape (Gdip.ReplayDrawEllipse, pen, x, y, width, height);
+}
+
+public void drawLine (long /*int*/ pen, int x1, int y1, int x2, int y2) {
+	shape (Gdip.ReplayDrawLine, pen, x1, y1, x2, y2);
+}
+
+public void drawRectangle (long /*int*/ pen, int x, int y, int width, int height) {
+	shape (Gdip.ReplayDrawRectangle, pen, x, y, width, height);
+}
+
+public void drawString (char[] string, int length, long /*int*/ font, float x, float y, long /*int*/ format, long /*int*/ brush) {
+	int charSlots = (length * 2 + SLOT - 1) / SLOT;
+	ensure (7 + charSlots);
+	buffer.putLong (Gdip.ReplayDrawString);
+	buffer.putLong (font);
+	buffer.putLong (format);
+	buffer.putLong (brush);
+	buffer.putLong (Float.floatToIntBits (x));
+	buffer.putLong (Float.floatToIntBits (y));
+	buffer.putLong (length);
+	int position = buffer.position ();
+	for (int i = 0; i < length; i++) buffer.putChar (string [i]);
+	buffer.position (position + charSlots * SLOT);
+}
+
+public void fillEllipse (long /*int*/ brush, int x, int y, int width, int height) {
+	shape (Gdip.ReplayFillEllipse, brush, x, y, width, height);
+}
+
+public void fillRectangle (long /*int*/ brush, int x, int y, int width, int height) {
+	shape (Gdip.ReplayFillRectangle, brush, x, y, width, height);
+}
+
+/**
+ * Returns <code>true</code> if no commands have been recorded since the
+ * list was created or last reset.
+ */
+public boolean isEmpty () {
+	return buffer.position () == 0;
+}
+
+/**
+ * Replays the recorded commands against the given graphics in order,
+ * stopping at the first command that fails.
+ *
+ * @return the status of the failing command, or <code>0</code> (Ok)
+ */
+public int replay (long /*int*/ graphics) {
+	if (buffer.position () == 0) return 0;
+	return Gdip.Graphics_Replay (graphics, buffer, buffer.position ());
+}
+
+/**
+ * Discards the recorded commands.  The buffer is kept for reuse.
+ */
+public void reset () {
+	buffer.clear ();
+}
+}
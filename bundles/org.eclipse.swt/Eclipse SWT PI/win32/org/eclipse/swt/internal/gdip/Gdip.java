@@ -108,6 +108,12 @@ public class Gdip extends Platform {
 	public static final int PixelFormatMax = 16;
 	public static final int PixelOffsetModeNone = QualityModeHigh + 1;
 	public static final int PixelOffsetModeHalf = QualityModeHigh + 2;
+	public static final int ReplayDrawEllipse = 1;
+	public static final int ReplayDrawLine = 2;
+	public static final int ReplayDrawRectangle = 3;
+	public static final int ReplayDrawString = 4;
+	public static final int ReplayFillEllipse = 5;
+	public static final int ReplayFillRectangle = 6;
 	public static final int SmoothingModeDefault = QualityModeDefault;
 	public static final int SmoothingModeHighSpeed = QualityModeLow;
 	public static final int SmoothingModeHighQuality = QualityModeHigh;
@@ -505,6 +511,11 @@ public static final native long /*int*/ Graphics_GetHDC(long /*int*/ graphics);
  * @param hdc cast=(HDC)
  */
 public static final native void Graphics_ReleaseHDC(long /*int*/ graphics, long /*int*/ hdc);
+/**
+ * @method flags=no_gen cpp
+ * @param graphics cast=(Graphics *)
+ */
+public static final native int Graphics_Replay(long /*int*/ graphics, java.nio.ByteBuffer commands, int length);
 /**
  * @method flags=cpp
  * @param graphics cast=(Graphics *)
@@ -650,6 +661,18 @@ public static final native int Graphics_SetTextRenderingHint(long /*int*/ graphi
  * @param order cast=(MatrixOrder)
  */
 public static final native int Graphics_TranslateTransform(long /*int*/ graphics, float dx, float dy, int order);
+/**
+ * @method flags=no_gen cpp
+ * @param graphics cast=(Graphics *)
+ * @param smoothingMode cast=(SmoothingMode)
+ */
+public static final native int Graphics_updateSmoothingMode(long /*int*/ graphics, int smoothingMode);
+/**
+ * @method flags=no_gen cpp
+ * @param graphics cast=(Graphics *)
+ * @param mode cast=(TextRenderingHint)
+ */
+public static final native int Graphics_updateTextRenderingHint(long /*int*/ graphics, int mode);
 /**
  * @method flags=new
  * @param fillMode cast=(FillMode)
@@ -779,6 +802,21 @@ public static final native boolean GraphicsPath_IsOutlineVisible(long /*int*/ pa
  * @param g cast=(const Graphics *)
  */
 public static final native boolean GraphicsPath_IsVisible(long /*int*/ path, float x, float y, long /*int*/ g);
+/**
+ * @method flags=no_gen cpp
+ * @param fillMode cast=(FillMode)
+ * @param pen cast=(const Pen *)
+ * @param g cast=(const Graphics *)
+ */
+public static final native boolean GraphicsPath_IsVisiblePaths(long /*int*/[] paths, float x, float y, int fillMode, long /*int*/ pen, long /*int*/ g, boolean prefilter, int[] mask);
+/**
+ * @method flags=no_gen cpp
+ * @param path cast=(GraphicsPath *)
+ * @param fillMode cast=(FillMode)
+ * @param pen cast=(const Pen *)
+ * @param g cast=(const Graphics *)
+ */
+public static final native boolean GraphicsPath_IsVisiblePoints(long /*int*/ path, float[] points, int fillMode, long /*int*/ pen, long /*int*/ g, boolean prefilter, int[] mask);
 /**
  * @method flags=cpp
  * @param path cast=(GraphicsPath *)
@@ -993,6 +1031,8 @@ public static final native void MoveMemory(ColorPalette Destination, long /*int*
  * @param SourcePtr cast=(CONST VOID*)
  */
 public static final native void MoveMemory(BitmapData Destination, long /*int*/ SourcePtr);
+/** @method flags=no_gen cpp */
+public static final native void ObjectCache_flush();
 /**
  * @method flags=new
  * @param path cast=(GraphicsPath *)
@@ -1046,6 +1086,12 @@ public static final native int PathGradientBrush_SetWrapMode(long /*int*/ brush,
 public static final native long /*int*/ Pen_new(long /*int*/ brush, float width);
 /** @method flags=delete */
 public static final native void Pen_delete(long /*int*/ pen);
+/**
+ * @method flags=no_gen cpp
+ * @param pen cast=(Pen *)
+ * @param width cast=(REAL)
+ */
+public static final native int Pen_updateWidth(long /*int*/ pen, float width);
 /**
  * @method flags=cpp
  * @param pen cast=(Pen *)
@@ -1137,6 +1183,13 @@ public static final native boolean Region_IsInfinite(long /*int*/ region, long /
 public static final native long /*int*/ SolidBrush_new(long /*int*/ color);
 /** @method flags=delete */
 public static final native void SolidBrush_delete(long /*int*/ brush);
+/**
+ * @method flags=no_gen cpp
+ * @param argb cast=(ARGB)
+ */
+public static final native long /*int*/ SolidBrush_acquire(int argb);
+/** @method flags=no_gen cpp */
+public static final native void SolidBrush_release(long /*int*/ brush);
 /** @method flags=delete */
 public static final native void StringFormat_delete(long /*int*/ format);
 /**
@@ -10,6 +10,8 @@
  *******************************************************************************/
 package org.eclipse.swt.internal.ole.win32;
 
+import java.nio.*;
+
 import org.eclipse.swt.internal.win32.*;
 
 public class COM extends OS {
@@ -166,6 +168,7 @@ public class COM extends OS {
 	public static final int CF_TIFF = 6;
 	public static final int CF_OEMTEXT = 7;
 	public static final int CF_DIB = 8;
+	public static final int CF_DIBV5 = 17;
 	public static final int CF_PALETTE = 9;
 	public static final int CF_PENDATA = 10;
 	public static final int CF_RIFF = 11;
@@ -432,6 +435,19 @@ private static GUID IIDFromString(String lpsz) {
 	return null;
 }
 
+/*
+* GUIDs are compared in Java, a native would copy both structs in and
+* back out again for every interface a QueryInterface checks for.
+*/
+public static boolean IsEqualGUID(GUID rguid1, GUID rguid2) {
+	if (rguid1.Data1 != rguid2.Data1 || rguid1.Data2 != rguid2.Data2 || rguid1.Data3 != rguid2.Data3) return false;
+	byte[] data1 = rguid1.Data4, data2 = rguid2.Data4;
+	for (int i = 0; i < data1.length; i++) {
+		if (data1[i] != data2[i]) return false;
+	}
+	return true;
+}
+
 /** Natives */
 
 /** @param lpszProgID cast=(LPCOLESTR) */
@@ -465,7 +481,11 @@ public static final native int DoDragDrop(long /*int*/ pDataObject, long /*int*/
 public static final native int GetClassFile(char[] szFileName, GUID clsid);
 /** @param lpsz cast=(LPOLESTR) */
 public static final native int IIDFromString(char[] lpsz, GUID lpiid);
-public static final native boolean IsEqualGUID(GUID rguid1, GUID rguid2);
+/**
+ * @param Destination cast=(PVOID)
+ * @param Source cast=(CONST VOID *),flags=no_out
+ */
+public static final native void MoveMemory(long /*int*/ Destination, DISPPARAMS Source, int Length);
 /**
  * @param Destination cast=(PVOID)
  * @param Source cast=(CONST VOID *),flags=no_out
@@ -501,6 +521,11 @@ public static final native void MoveMemory(STGMEDIUM Destination, long /*int*/ S
  * @param SourcePtr cast=(CONST VOID *)
  */
 public static final native void MoveMemory(DISPPARAMS Destination, long /*int*/ SourcePtr, int Length);
+/**
+ * @param Destination cast=(PVOID),flags=no_in
+ * @param SourcePtr cast=(CONST VOID *)
+ */
+public static final native void MoveMemory(EXCEPINFO Destination, long /*int*/ SourcePtr, int Length);
 /**
  * @param Destination cast=(PVOID),flags=no_in
  * @param Source cast=(CONST VOID *)
@@ -1028,6 +1053,86 @@ public static final native long /*int*/ put_accValue_CALLBACK(long /*int*/ func)
 /** @method flags=no_gen,callback_types=HRESULT;VARIANT;,callback_flags=none;struct; */
 public static final native long /*int*/ CALLBACK_setCurrentValue(long /*int*/ func);
 
+/** Bound vtable natives */
+
+/* Returns the function at index fnNumber of the vtable of ppVtbl. */
+/** @method flags=no_gen */
+public static final native long /*int*/ VtblResolve(int fnNumber, long /*int*/ ppVtbl);
+/* Calls a function returned by VtblResolve with ppVtbl and pointer sized arguments. */
+/** @method flags=no_gen */
+public static final native int VtblCallBound0(long /*int*/ fn, long /*int*/ ppVtbl);
+/** @method flags=no_gen */
+public static final native int VtblCallBound1(long /*int*/ fn, long /*int*/ ppVtbl, long /*int*/ arg0);
+/** @method flags=no_gen */
+public static final native int VtblCallBound2(long /*int*/ fn, long /*int*/ ppVtbl, long /*int*/ arg0, long /*int*/ arg1);
+/** @method flags=no_gen */
+public static final native int VtblCallBound3(long /*int*/ fn, long /*int*/ ppVtbl, long /*int*/ arg0, long /*int*/ arg1, long /*int*/ arg2);
+/** @method flags=no_gen */
+public static final native int VtblCallBound4(long /*int*/ fn, long /*int*/ ppVtbl, long /*int*/ arg0, long /*int*/ arg1, long /*int*/ arg2, long /*int*/ arg3);
+/** @method flags=no_gen */
+public static final native int VtblCallBound5(long /*int*/ fn, long /*int*/ ppVtbl, long /*int*/ arg0, long /*int*/ arg1, long /*int*/ arg2, long /*int*/ arg3, long /*int*/ arg4);
+/** @method flags=no_gen */
+public static final native int VtblCallBound6(long /*int*/ fn, long /*int*/ ppVtbl, long /*int*/ arg0, long /*int*/ arg1, long /*int*/ arg2, long /*int*/ arg3, long /*int*/ arg4, long /*int*/ arg5);
+/** @method flags=no_gen */
+public static final native int VtblCallBound7(long /*int*/ fn, long /*int*/ ppVtbl, long /*int*/ arg0, long /*int*/ arg1, long /*int*/ arg2, long /*int*/ arg3, long /*int*/ arg4, long /*int*/ arg5, long /*int*/ arg6);
+/** @method flags=no_gen */
+public static final native int VtblCallBound8(long /*int*/ fn, long /*int*/ ppVtbl, long /*int*/ arg0, long /*int*/ arg1, long /*int*/ arg2, long /*int*/ arg3, long /*int*/ arg4, long /*int*/ arg5, long /*int*/ arg6, long /*int*/ arg7);
+
+/** Batched automation natives */
+
+/*
+ * Performs the IDispatch::Invoke() calls packed in args against pDispatch
+ * and stores one record per call in results.  Returns the number of calls
+ * performed.
+ *
+ * Every call is a sequence of 64 bit slots in native byte order: the
+ * DISPID, the flags, the number of arguments, the number of named arguments,
+ * 1 if a result is wanted, the DISPIDs of the named arguments and then the
+ * arguments as a VARTYPE followed by its value.  A VT_BSTR value is its
+ * length followed by its characters padded to the next slot.  VT_R4 and
+ * VT_R8 values are stored as their bits, VT_BOOL values as 0 or 1.
+ *
+ * Every record holds the HRESULT, the VARTYPE of the result, its value and
+ * the length of the characters that follow, or -1.  A VT_BSTR result that
+ * does not fit is returned as a BSTR which the caller frees.  For
+ * DISP_E_EXCEPTION the record holds wCode, scode and the description.
+ */
+/** @method flags=no_gen */
+public static final native int InvokeBatch(long /*int*/ pDispatch, ByteBuffer args, int argsLength, ByteBuffer results, int resultsLength);
+
+/** BSTR natives */
+
+/* Allocates a BSTR with the characters of a String, or returns 0 for null. */
+/** @method flags=no_gen */
+public static final native long /*int*/ BSTRFromString(String string);
+/* Returns the characters of a BSTR as a String, or null for 0. */
+/** @method flags=no_gen */
+public static final native String BSTRToString(long /*int*/ bstr);
+/* Frees the first count BSTRs of an array and clears their entries. */
+/** @method flags=no_gen */
+public static final native void SysFreeStrings(long /*int*/[] bstrs, int count);
+
+/** VARIANT natives */
+
+/*
+ * Sets the first count VARIANTs of an array to the types, which must be
+ * VT_I4, VT_DISPATCH or VT_UNKNOWN, and values.  Interface values are not
+ * AddRef'd.  Returns false without changing the array if an argument is
+ * not valid.
+ */
+/** @method flags=no_gen */
+public static final native boolean SetVARIANTs(long /*int*/ rgvar, short[] types, long /*int*/[] values, int count);
+
+/** Stream natives */
+
+/*
+ * Returns an IStream over the memory of a direct buffer, or 0.  The stream
+ * starts with length bytes and may grow up to the capacity of the buffer
+ * unless it is read only.  The buffer is kept alive by the stream.
+ */
+/** @method flags=no_gen */
+public static final native long /*int*/ CreateStreamOnBuffer(ByteBuffer buffer, int length, boolean readOnly);
+
 /* sizeof's */
 public static final native int CAUUID_sizeof();
 public static final native int CONTROLINFO_sizeof();
@@ -13,6 +13,7 @@ package org.eclipse.swt.internal.ole.win32;
 import org.eclipse.swt.internal.win32.*;
 
 public class IDispatch extends IUnknown {
+	long /*int*/ invoke;
 
 public IDispatch(long /*int*/ address) {
 	super(address);
@@ -63,4 +64,8 @@ public int GetTypeInfoCount(int [] pctinfo ){
 public int Invoke(int dispIdMember, GUID riid, int lcid, int dwFlags, DISPPARAMS pDispParams, long /*int*/ pVarResult, EXCEPINFO pExcepInfo, int[] pArgErr) {
 	return COM.VtblCall(6, address, dispIdMember, riid, lcid, dwFlags, pDispParams, pVarResult, pExcepInfo, pArgErr);
 }
+public int Invoke(int dispIdMember, long /*int*/ riid, int lcid, int dwFlags, long /*int*/ pDispParams, long /*int*/ pVarResult, long /*int*/ pExcepInfo, long /*int*/ pArgErr) {
+	if (invoke == 0) invoke = COM.VtblResolve(6, address);
+	return COM.VtblCallBound8(invoke, address, dispIdMember, riid, lcid, dwFlags, pDispParams, pVarResult, pExcepInfo, pArgErr);
+}
 }
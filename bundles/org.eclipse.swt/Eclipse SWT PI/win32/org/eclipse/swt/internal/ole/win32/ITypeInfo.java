@@ -28,12 +28,9 @@ public int GetDocumentation(int index, String[] name, String[] docString, int[]
 	if (helpFile != null) pBstrHelpFile = new long /*int*/[1];
 	int rc = COM.VtblCall(12, address, index, pBstrName, pBstrDocString, pdwHelpContext, pBstrHelpFile);
 	if (name != null && pBstrName[0] != 0) {
-		int size = COM.SysStringByteLen(pBstrName[0]);
-		if (size > 0){
-			// get the unicode character array from the global memory and create a String
-			char[] buffer = new char[(size + 1) /2]; // add one to avoid rounding errors
-			COM.MoveMemory(buffer, pBstrName[0], size);
-			name[0] = new String(buffer);
+		String string = COM.BSTRToString(pBstrName[0]);
+		if (string != null && string.length() > 0){
+			name[0] = string;
 			int subindex = name[0].indexOf("\0");
 			if (subindex > 0)
 				name[0] = name[0].substring(0, subindex);
@@ -41,12 +38,9 @@ public int GetDocumentation(int index, String[] name, String[] docString, int[]
 		COM.SysFreeString(pBstrName[0]);
 	}
 	if (docString != null && pBstrDocString[0] != 0) {
-		int size = COM.SysStringByteLen(pBstrDocString[0]);
-		if (size > 0){
-			// get the unicode character array from the global memory and create a String
-			char[] buffer = new char[(size + 1) /2]; // add one to avoid rounding errors
-			COM.MoveMemory(buffer, pBstrDocString[0], size);
-			docString[0] = new String(buffer);
+		String string = COM.BSTRToString(pBstrDocString[0]);
+		if (string != null && string.length() > 0){
+			docString[0] = string;
 			int subindex = docString[0].indexOf("\0");
 			if (subindex > 0)
 				docString[0] = docString[0].substring(0, subindex);
@@ -54,12 +48,9 @@ public int GetDocumentation(int index, String[] name, String[] docString, int[]
 		COM.SysFreeString(pBstrDocString[0]);
 	}
 	if (helpFile != null && pBstrHelpFile[0] != 0) {
-		int size = COM.SysStringByteLen(pBstrHelpFile[0]);
-		if (size > 0){
-			// get the unicode character array from the global memory and create a String
-			char[] buffer = new char[(size + 1) /2]; // add one to avoid rounding errors
-			COM.MoveMemory(buffer, pBstrHelpFile[0], size);
-			helpFile[0] = new String(buffer);
+		String string = COM.BSTRToString(pBstrHelpFile[0]);
+		if (string != null && string.length() > 0){
+			helpFile[0] = string;
 			int subindex = helpFile[0].indexOf("\0");
 			if (subindex > 0)
 				helpFile[0] = helpFile[0].substring(0, subindex);
@@ -120,18 +111,15 @@ public int GetNames(int memid, String[] names, int cMaxNames, int[] pcNames){
 	
 	if (rc == COM.S_OK) {
 		for (int i = 0; i < pcNames[0]; i++) {
-			int size = COM.SysStringByteLen(rgBstrNames[i]);
-			if (size > 0){
-				// get the unicode character array from the global memory and create a String
-				char[] buffer = new char[(size + 1) /2]; // add one to avoid rounding errors
-				COM.MoveMemory(buffer, rgBstrNames[i], size);
-				names[i] = new String(buffer);
+			String string = COM.BSTRToString(rgBstrNames[i]);
+			if (string != null && string.length() > 0){
+				names[i] = string;
 				int subindex = names[i].indexOf("\0");
 				if (subindex > 0)
 					names[i] = names[i].substring(0, subindex);
 			}
-			COM.SysFreeString(rgBstrNames[i]);
 		}
+		COM.SysFreeStrings(rgBstrNames, pcNames[0]);
 	}
 	
 	return rc;
@@ -25,5 +25,5 @@ public class ACTCTX {
 	public long /*int*/ lpApplicationName;
 	/** @field cast=(HMODULE) */
 	public long /*int*/ hModule;
-	public static final int sizeof = OS.ACTCTX_sizeof ();
+	public static final int sizeof = OS.sizeof ("ACTCTX");
 }
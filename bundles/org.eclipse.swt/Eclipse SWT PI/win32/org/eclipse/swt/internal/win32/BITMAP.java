@@ -19,5 +19,5 @@ public class BITMAP {
 	public short bmBitsPixel;
 	/** @field cast=(LPVOID) */
 	public long /*int*/ bmBits;
-	public static final int sizeof = OS.BITMAP_sizeof ();
+	public static final int sizeof = OS.sizeof ("BITMAP");
 }
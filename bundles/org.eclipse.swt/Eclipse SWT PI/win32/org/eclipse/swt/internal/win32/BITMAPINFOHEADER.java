@@ -22,5 +22,5 @@ public class BITMAPINFOHEADER {
 	public int biYPelsPerMeter;
 	public int biClrUsed;
 	public int biClrImportant;
-	public static final int sizeof = OS.BITMAPINFOHEADER_sizeof ();
+	public static final int sizeof = OS.sizeof ("BITMAPINFOHEADER");
 }
@@ -17,5 +17,5 @@ public class BP_PAINTPARAMS {
 	public long /*int*/ prcExclude;
 	/** @field cast=(BLENDFUNCTION*) */
 	public long /*int*/ pBlendFunction;
-	public static final int sizeof = OS.BP_PAINTPARAMS_sizeof ();
+	public static final int sizeof = OS.sizeof ("BP_PAINTPARAMS");
 }
@@ -24,5 +24,5 @@ public class BROWSEINFO {
 	public long /*int*/ lpfn;
 	public long /*int*/ lParam;
 	public int iImage;
-	public static final int sizeof = OS.BROWSEINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("BROWSEINFO");
 }
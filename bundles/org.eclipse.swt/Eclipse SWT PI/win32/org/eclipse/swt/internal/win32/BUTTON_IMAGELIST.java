@@ -23,5 +23,5 @@ public class BUTTON_IMAGELIST {
 	public int margin_bottom; 
 	/** @field cast=(UINT) */
 	public int uAlign;
-	public static final int sizeof = OS.BUTTON_IMAGELIST_sizeof ();
+	public static final int sizeof = OS.sizeof ("BUTTON_IMAGELIST");
 }
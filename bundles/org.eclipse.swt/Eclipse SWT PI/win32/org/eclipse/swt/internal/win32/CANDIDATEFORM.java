@@ -15,5 +15,5 @@ public class CANDIDATEFORM {
 	public int dwStyle;
 	public POINT ptCurrentPos = new POINT();
 	public RECT rcArea = new RECT();  
-	public static final int sizeof = OS.CANDIDATEFORM_sizeof ();
+	public static final int sizeof = OS.sizeof ("CANDIDATEFORM");
 }
@@ -21,5 +21,5 @@ public class CERT_CONTEXT {
 	/** @field cast=(HCERTSTORE) */
 	public long /*int*/ hCertStore;
 
-	public static final int sizeof = OS.CERT_CONTEXT_sizeof ();
+	public static final int sizeof = OS.sizeof ("CERT_CONTEXT");
 }
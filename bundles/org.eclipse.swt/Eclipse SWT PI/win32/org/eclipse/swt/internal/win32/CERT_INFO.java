@@ -26,5 +26,5 @@ public class CERT_INFO {
 	/** @field cast=(PCERT_EXTENSION) */
 	public long /*int*/ rgExtension;
 
-	public static final int sizeof = OS.CERT_INFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("CERT_INFO");
 }
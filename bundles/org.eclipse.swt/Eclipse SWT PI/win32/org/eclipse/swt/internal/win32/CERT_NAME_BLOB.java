@@ -16,5 +16,5 @@ public class CERT_NAME_BLOB {
 	/** @field cast=(BYTE *) */
 	public long /*int*/ pbData;
 
-	static final public int sizeof = OS.CERT_NAME_BLOB_sizeof ();
+	static final public int sizeof = OS.sizeof ("CERT_NAME_BLOB");
 }
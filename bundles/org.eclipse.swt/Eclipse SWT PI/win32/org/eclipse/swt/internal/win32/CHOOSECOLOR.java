@@ -25,5 +25,5 @@ public class CHOOSECOLOR {
 	public long /*int*/ lpfnHook; 
 	/** @field cast=(LPCTSTR) */
 	public long /*int*/ lpTemplateName;
-	public static final int sizeof = OS.CHOOSECOLOR_sizeof ();
+	public static final int sizeof = OS.sizeof ("CHOOSECOLOR");
 }
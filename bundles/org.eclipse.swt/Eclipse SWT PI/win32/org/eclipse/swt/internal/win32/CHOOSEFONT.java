@@ -33,5 +33,5 @@ public class CHOOSEFONT {
 	public short nFontType;
 	public int nSizeMin;
 	public int nSizeMax;
-	public static final int sizeof = OS.CHOOSEFONT_sizeof ();
+	public static final int sizeof = OS.sizeof ("CHOOSEFONT");
 }
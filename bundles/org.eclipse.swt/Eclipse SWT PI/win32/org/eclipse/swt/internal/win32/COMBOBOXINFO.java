@@ -35,5 +35,5 @@ public class COMBOBOXINFO {
 	public long /*int*/ hwndItem;
 	/** @field cast=(HWND) */
 	public long /*int*/ hwndList;
-	public static final int sizeof = OS.COMBOBOXINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("COMBOBOXINFO");
 }
@@ -26,5 +26,5 @@ public class COMPOSITIONFORM {
 	public int right;
 	/** @field accessor=rcArea.bottom */
 	public int bottom;
-	public static final int sizeof = OS.COMPOSITIONFORM_sizeof ();
+	public static final int sizeof = OS.sizeof ("COMPOSITIONFORM");
 }
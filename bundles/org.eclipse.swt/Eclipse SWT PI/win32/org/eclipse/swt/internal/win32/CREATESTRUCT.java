@@ -29,5 +29,5 @@ public class CREATESTRUCT {
 	/** @field cast=(LPCTSTR) */
 	public long /*int*/ lpszClass; 
 	public int dwExStyle;
-	public static final int sizeof = OS.CREATESTRUCT_sizeof ();
+	public static final int sizeof = OS.sizeof ("CREATESTRUCT");
 }
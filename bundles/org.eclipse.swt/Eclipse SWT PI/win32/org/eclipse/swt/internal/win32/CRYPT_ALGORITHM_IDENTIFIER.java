@@ -16,5 +16,5 @@ public class CRYPT_ALGORITHM_IDENTIFIER {
 	public long /*int*/ pszObjId;
 	public CRYPT_OBJID_BLOB Parameters = new CRYPT_OBJID_BLOB ();
 
-	static final public int sizeof = OS.CRYPT_ALGORITHM_IDENTIFIER_sizeof ();
+	static final public int sizeof = OS.sizeof ("CRYPT_ALGORITHM_IDENTIFIER");
 }
@@ -17,5 +17,5 @@ public class CRYPT_BIT_BLOB {
 	public long /*int*/ pbData;
 	public int cUnusedBits;
 
-	static final public int sizeof = OS.CRYPT_BIT_BLOB_sizeof ();
+	static final public int sizeof = OS.sizeof ("CRYPT_BIT_BLOB");
 }
@@ -16,5 +16,5 @@ public class CRYPT_INTEGER_BLOB {
 	/** @field cast=(BYTE *) */
 	public long /*int*/ pbData;
 
-	static final public int sizeof = OS.CRYPT_INTEGER_BLOB_sizeof ();
+	static final public int sizeof = OS.sizeof ("CRYPT_INTEGER_BLOB");
 }
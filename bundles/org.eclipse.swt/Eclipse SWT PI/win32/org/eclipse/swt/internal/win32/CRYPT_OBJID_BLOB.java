@@ -16,5 +16,5 @@ public class CRYPT_OBJID_BLOB {
 	/** @field cast=(BYTE *) */
 	public long /*int*/ pbData;
 
-	static final public int sizeof = OS.CRYPT_OBJID_BLOB_sizeof ();
+	static final public int sizeof = OS.sizeof ("CRYPT_OBJID_BLOB");
 }
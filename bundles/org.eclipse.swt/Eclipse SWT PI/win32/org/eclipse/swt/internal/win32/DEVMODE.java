@@ -43,5 +43,5 @@ public abstract class DEVMODE {
 	public int dmReserved2;
 	public int dmPanningWidth;
 	public int dmPanningHeight;
-	public static final int sizeof = OS.IsUnicode ? OS.DEVMODEW_sizeof () : OS.DEVMODEA_sizeof ();
+	public static final int sizeof = OS.IsUnicode ? OS.sizeof ("DEVMODEW") : OS.sizeof ("DEVMODEA");
 }
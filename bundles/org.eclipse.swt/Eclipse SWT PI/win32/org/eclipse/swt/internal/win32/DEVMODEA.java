@@ -13,5 +13,5 @@ package org.eclipse.swt.internal.win32;
 public class DEVMODEA extends DEVMODE {
 	public byte[] dmDeviceName = new byte[OS.CCHDEVICENAME];
 	public byte[] dmFormName = new byte[OS.CCHFORMNAME];
-	public static final int sizeof = OS.DEVMODEA_sizeof ();
+	public static final int sizeof = OS.sizeof ("DEVMODEA");
 }
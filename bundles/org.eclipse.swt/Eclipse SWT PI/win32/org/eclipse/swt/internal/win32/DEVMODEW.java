@@ -13,5 +13,5 @@ package org.eclipse.swt.internal.win32;
 public class DEVMODEW extends DEVMODE {
 	public char[] dmDeviceName = new char[OS.CCHDEVICENAME];
 	public char[] dmFormName = new char[OS.CCHFORMNAME];
-	public static final int sizeof = OS.DEVMODEW_sizeof ();
+	public static final int sizeof = OS.sizeof ("DEVMODEW");
 }
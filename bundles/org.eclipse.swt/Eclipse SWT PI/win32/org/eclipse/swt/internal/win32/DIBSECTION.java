@@ -42,5 +42,5 @@ public class DIBSECTION extends BITMAP {
 	/** @field cast=(HANDLE) */
 	public long /*int*/ dshSection;
 	public int dsOffset;
-	public static final int sizeof = OS.DIBSECTION_sizeof ();
+	public static final int sizeof = OS.sizeof ("DIBSECTION");
 }
@@ -16,5 +16,5 @@ public class DLLVERSIONINFO {
 	public int dwMinorVersion;
 	public int dwBuildNumber;
 	public int dwPlatformID;
-	public static final int sizeof = OS.DLLVERSIONINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("DLLVERSIONINFO");
 }
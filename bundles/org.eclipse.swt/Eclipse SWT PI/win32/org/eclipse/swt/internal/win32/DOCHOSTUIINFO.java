@@ -18,5 +18,5 @@ public class DOCHOSTUIINFO {
 	public long /*int*/ pchHostCss;
 	/** @field cast=(OLECHAR*),flags=no_wince */
 	public long /*int*/ pchHostNS;
-	public static final int sizeof = OS.DOCHOSTUIINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("DOCHOSTUIINFO");
 }
@@ -19,5 +19,5 @@ public class DOCINFO {
 	/** @field cast=(LPCTSTR) */
 	public long /*int*/ lpszDatatype;// LPCTSTR
 	public int fwType; // DWORD
-	public static final int sizeof = OS.DOCINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("DOCINFO");
 }
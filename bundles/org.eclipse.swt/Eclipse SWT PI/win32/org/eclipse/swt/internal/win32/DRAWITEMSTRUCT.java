@@ -30,5 +30,5 @@ public class DRAWITEMSTRUCT {
 	/** @field accessor=rcItem.right */
 	public int right;
 	public long /*int*/ itemData;
-	public static final int sizeof = OS.DRAWITEMSTRUCT_sizeof ();
+	public static final int sizeof = OS.sizeof ("DRAWITEMSTRUCT");
 }
@@ -23,5 +23,5 @@ public class DROPFILES {
 	public int fWide; // Value that indicates whether the file contains ANSI or Unicode 
 					  // characters. If it is zero, it contains ANSI characters. Otherwise, it 
 				      // contains Unicode characters.
-	public static final int sizeof = OS.DROPFILES_sizeof ();
+	public static final int sizeof = OS.sizeof ("DROPFILES");
 }
@@ -28,5 +28,5 @@ public class DTTOPTS {
 	/** @field cast=(DTT_CALLBACK_PROC) */
 	public long /*int*/ pfnDrawTextCallback;
 	public long /*int*/ lParam;
-	public static final int sizeof = OS.DTTOPTS_sizeof ();
+	public static final int sizeof = OS.sizeof ("DTTOPTS");
 }
\ No newline at end of file
@@ -16,5 +16,5 @@ public class DWM_BLURBEHIND {
 	/** @field cast=(HRGN) */
 	public long /*int*/ hRgnBlur;
 	public boolean fTransitionOnMaximized;
-	public static final int sizeof = OS.DWM_BLURBEHIND_sizeof ();
+	public static final int sizeof = OS.sizeof ("DWM_BLURBEHIND");
 }
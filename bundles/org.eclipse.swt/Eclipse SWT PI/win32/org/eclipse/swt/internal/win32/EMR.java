@@ -13,5 +13,5 @@ package org.eclipse.swt.internal.win32;
 public class EMR {
 	public int iType;
 	public int nSize;  
-	public static final int sizeof = OS.EMR_sizeof ();
+	public static final int sizeof = OS.sizeof ("EMR");
 }
@@ -14,5 +14,5 @@ public class EMREXTCREATEFONTINDIRECTW {
 	public EMR emr = new EMR();
 	public int ihFont;
 	public EXTLOGFONTW elfw = new EXTLOGFONTW();
-	public static final int sizeof = OS.EMREXTCREATEFONTINDIRECTW_sizeof ();
+	public static final int sizeof = OS.sizeof ("EMREXTCREATEFONTINDIRECTW");
 }
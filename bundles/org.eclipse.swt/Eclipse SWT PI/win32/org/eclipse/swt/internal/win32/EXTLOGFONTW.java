@@ -21,5 +21,5 @@ public class EXTLOGFONTW {
 	public byte[] elfVendorId = new byte[OS.ELF_VENDOR_SIZE];
 	public int elfCulture;
 	public PANOSE elfPanose = new PANOSE();
-	public static final int sizeof = OS.EXTLOGFONTW_sizeof ();
+	public static final int sizeof = OS.sizeof ("EXTLOGFONTW");
 }
@@ -18,5 +18,5 @@ public class EXTLOGPEN {
 	public long /*int*/ elpHatch;
 	public int elpNumEntries;
 	public int[] elpStyleEntry = new int[1];
-	public static final int sizeof = OS.EXTLOGPEN_sizeof ();
+	public static final int sizeof = OS.sizeof ("EXTLOGPEN");
 }
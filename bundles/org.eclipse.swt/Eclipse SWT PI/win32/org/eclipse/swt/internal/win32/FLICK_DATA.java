@@ -22,5 +22,5 @@ public class FLICK_DATA {
 	public int iReserved;
 	public boolean fOnInkingSurface;
 	public int iActionArgument;
-	public static final int sizeof = OS.FLICK_DATA_sizeof();
+	public static final int sizeof = OS.sizeof ("FLICK_DATA");
 }
@@ -13,5 +13,5 @@ package org.eclipse.swt.internal.win32;
 public class FLICK_POINT {
 	public int x;
 	public int y;
-	public static final int sizeof = OS.FLICK_POINT_sizeof();
+	public static final int sizeof = OS.sizeof ("FLICK_POINT");
 }
@@ -26,6 +26,6 @@ public class GCP_RESULTS {
 	public long /*int*/ lpGlyphs;
 	public int nGlyphs;
 	public int nMaxFit;
-	public static final int sizeof = OS.GCP_RESULTS_sizeof ();
+	public static final int sizeof = OS.sizeof ("GCP_RESULTS");
 }
 
@@ -25,5 +25,5 @@ public class GESTUREINFO {
 	 public int dwSequenceID;
 	 public long ullArguments;
 	 public int cbExtraArgs;
-	 public static final int sizeof = OS.GESTUREINFO_sizeof ();
+	 public static final int sizeof = OS.sizeof ("GESTUREINFO");
 }
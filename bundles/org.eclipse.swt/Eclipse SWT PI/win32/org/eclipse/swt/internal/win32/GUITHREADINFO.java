@@ -36,5 +36,5 @@ public class GUITHREADINFO {
 	public int right; 
 	/** @field accessor=rcCaret.bottom */
 	public int bottom;
-	public static int sizeof = OS.GUITHREADINFO_sizeof ();
+	public static int sizeof = OS.sizeof ("GUITHREADINFO");
 }
@@ -18,5 +18,5 @@ public class HDHITTESTINFO {
 	public int y;
 	public int flags;
 	public int iItem;
-	public static int sizeof = OS.HDHITTESTINFO_sizeof ();
+	public static int sizeof = OS.sizeof ("HDHITTESTINFO");
 }
@@ -26,5 +26,5 @@ public class HDITEM {
 	public int type;
 	/** @field cast=(void *),flags=no_wince */
 	public long /*int*/ pvFilter; 
-	public static int sizeof = OS.HDITEM_sizeof ();
+	public static int sizeof = OS.sizeof ("HDITEM");
 }
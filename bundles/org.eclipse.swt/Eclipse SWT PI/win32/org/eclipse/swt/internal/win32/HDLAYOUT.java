@@ -15,5 +15,5 @@ public class HDLAYOUT {
 	public long /*int*/ prc;
 	/** @field cast=(WINDOWPOS *) */
 	public long /*int*/ pwpos;
-	public static final int sizeof = OS.HDLAYOUT_sizeof ();
+	public static final int sizeof = OS.sizeof ("HDLAYOUT");
 }
@@ -22,5 +22,5 @@ public class HELPINFO {
 	public int x;
 	/** @field accessor=MousePos.y */
 	public int y;
-	public static final int sizeof = OS.HELPINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("HELPINFO");
 }
@@ -15,5 +15,5 @@ public class HIGHCONTRAST {
 	public int dwFlags;
 	/** @field cast=(LPTSTR) */
 	public long /*int*/ lpszDefaultScheme;
-	public static final int sizeof = OS.HIGHCONTRAST_sizeof ();
+	public static final int sizeof = OS.sizeof ("HIGHCONTRAST");
 }
@@ -18,5 +18,5 @@ public class ICONINFO {
 	public long /*int*/ hbmMask;
 	/** @field cast=(HBITMAP) */
 	public long /*int*/ hbmColor;
-	public static final int sizeof = OS.ICONINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("ICONINFO");
 }
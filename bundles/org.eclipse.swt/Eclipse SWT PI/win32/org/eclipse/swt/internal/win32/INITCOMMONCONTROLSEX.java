@@ -13,5 +13,5 @@ package org.eclipse.swt.internal.win32;
 public class INITCOMMONCONTROLSEX {
 	public int dwSize; 
 	public int dwICC;
-	public static final int sizeof = OS.INITCOMMONCONTROLSEX_sizeof ();
+	public static final int sizeof = OS.sizeof ("INITCOMMONCONTROLSEX");
 }
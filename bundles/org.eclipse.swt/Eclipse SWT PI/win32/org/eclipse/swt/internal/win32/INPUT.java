@@ -12,5 +12,5 @@ package org.eclipse.swt.internal.win32;
 
 public class INPUT {
 	public int type;
-	public static final int sizeof = OS.INPUT_sizeof ();
+	public static final int sizeof = OS.sizeof ("INPUT");
 }
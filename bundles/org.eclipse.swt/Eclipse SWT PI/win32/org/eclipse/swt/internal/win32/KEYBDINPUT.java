@@ -16,5 +16,5 @@ public class KEYBDINPUT {
 	public int dwFlags;
 	public int time;
 	public long /*int*/ dwExtraInfo;
-	public static final int sizeof = OS.KEYBDINPUT_sizeof ();
+	public static final int sizeof = OS.sizeof ("KEYBDINPUT");
 }
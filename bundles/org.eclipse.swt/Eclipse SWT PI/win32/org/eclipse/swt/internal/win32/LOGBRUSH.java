@@ -14,5 +14,5 @@ public class LOGBRUSH {
 	public int lbStyle;
 	public int lbColor;
 	public long /*int*/ lbHatch;
-	public static final int sizeof = OS.LOGBRUSH_sizeof ();
+	public static final int sizeof = OS.sizeof ("LOGBRUSH");
 }
@@ -24,5 +24,5 @@ public abstract class LOGFONT {
 	public byte lfClipPrecision;
 	public byte lfQuality;
 	public byte lfPitchAndFamily;
-	public static final int sizeof = OS.IsUnicode ? OS.LOGFONTW_sizeof () : OS.LOGFONTA_sizeof ();
+	public static final int sizeof = OS.IsUnicode ? OS.sizeof ("LOGFONTW") : OS.sizeof ("LOGFONTA");
 }
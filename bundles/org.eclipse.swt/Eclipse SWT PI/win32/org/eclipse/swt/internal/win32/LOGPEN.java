@@ -18,5 +18,5 @@ public class LOGPEN {
 	/** @field accessor=lopnWidth.y */
 	public int y;
 	public int lopnColor;
-	public static final int sizeof = OS.LOGPEN_sizeof ();
+	public static final int sizeof = OS.sizeof ("LOGPEN");
 }
@@ -20,5 +20,5 @@ public class LVCOLUMN {
 	public int iSubItem;
 	public int iImage;
 	public int iOrder;
-	public static final int sizeof = OS.LVCOLUMN_sizeof ();
+	public static final int sizeof = OS.sizeof ("LVCOLUMN");
 }
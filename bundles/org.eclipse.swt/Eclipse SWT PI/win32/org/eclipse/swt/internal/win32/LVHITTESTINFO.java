@@ -19,5 +19,5 @@ public class LVHITTESTINFO {
 	public int flags;
 	public int iItem;
 	public int iSubItem;
-	public static int sizeof = OS.LVHITTESTINFO_sizeof ();
+	public static int sizeof = OS.sizeof ("LVHITTESTINFO");
 }
@@ -15,5 +15,5 @@ public class LVINSERTMARK {
 	public int dwFlags;
 	public int iItem;
 	public int dwReserved;
-	public static final int sizeof = OS.LVINSERTMARK_sizeof ();
+	public static final int sizeof = OS.sizeof ("LVINSERTMARK");
 }
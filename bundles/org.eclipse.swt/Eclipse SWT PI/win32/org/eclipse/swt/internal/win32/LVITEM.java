@@ -28,5 +28,5 @@ public class LVITEM {
 	public int cColumns;
 	/** @field cast=(PUINT),flags=no_wince */
 	public long /*int*/ puColumns;
-	public static final int sizeof = !OS.IsWinCE && OS.WIN32_VERSION >= OS.VERSION (5, 1) ? OS.LVITEM_sizeof () : 40;
+	public static final int sizeof = !OS.IsWinCE && OS.WIN32_VERSION >= OS.VERSION (5, 1) ? OS.sizeof ("LVITEM") : 40;
 }
@@ -19,5 +19,5 @@ public class MCHITTESTINFO {
 //	public int iOffset;
 //	public int iRow;
 //	public int iCol;
-	public static final int sizeof = OS.MCHITTESTINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("MCHITTESTINFO");
 }
\ No newline at end of file
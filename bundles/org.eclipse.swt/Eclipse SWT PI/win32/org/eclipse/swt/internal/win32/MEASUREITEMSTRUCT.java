@@ -17,5 +17,5 @@ public class MEASUREITEMSTRUCT {
 	public int itemWidth;
 	public int itemHeight; 
 	public long /*int*/ itemData;
-	public static final int sizeof = OS.MEASUREITEMSTRUCT_sizeof ();
+	public static final int sizeof = OS.sizeof ("MEASUREITEMSTRUCT");
 }
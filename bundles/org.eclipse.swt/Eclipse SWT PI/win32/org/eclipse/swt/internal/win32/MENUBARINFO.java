@@ -27,5 +27,5 @@ public class MENUBARINFO {
 	public long /*int*/ hwndMenu;
 	public boolean fBarFocused;
 	public boolean fFocused;
-	public static final int sizeof = OS.MENUBARINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("MENUBARINFO");
 }
@@ -19,5 +19,5 @@ public class MENUINFO {
 	public long /*int*/ hbrBack;
 	public int dwContextHelpID;
 	public long /*int*/ dwMenuData;
-	public static final int sizeof = OS.MENUINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("MENUINFO");
 }
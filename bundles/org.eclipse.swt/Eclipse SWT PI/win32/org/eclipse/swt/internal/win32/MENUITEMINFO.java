@@ -35,5 +35,5 @@ public class MENUITEMINFO {
 	* calls fail when the struct size is too large.  The fix is to ensure
 	* that the correct struct size is used for the Windows platform.
 	*/
-	public static final int sizeof = !OS.IsWinCE && OS.WIN32_VERSION >= OS.VERSION (5, 0) ? OS.MENUITEMINFO_sizeof () : 44;
+	public static final int sizeof = !OS.IsWinCE && OS.WIN32_VERSION >= OS.VERSION (5, 0) ? OS.sizeof ("MENUITEMINFO") : 44;
 }
@@ -36,5 +36,5 @@ public class MINMAXINFO {
 	public int ptMaxTrackSize_x;
 	/** @field accessor=ptMaxTrackSize.y */
 	public int ptMaxTrackSize_y;
-	public static final int sizeof = OS.MINMAXINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("MINMAXINFO");
 }
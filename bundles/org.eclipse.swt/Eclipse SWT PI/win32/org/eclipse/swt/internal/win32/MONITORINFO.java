@@ -31,5 +31,5 @@ public class MONITORINFO {
 	/** @field accessor=rcWork.bottom */
 	public int rcWork_bottom;
 	public int dwFlags;
-	public static final int sizeof = OS.MONITORINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("MONITORINFO");
 }
@@ -17,5 +17,5 @@ public class MOUSEINPUT {
 	public int dwFlags;
 	public int time;
 	public long /*int*/ dwExtraInfo;
-	public static final int sizeof = OS.MOUSEINPUT_sizeof ();
+	public static final int sizeof = OS.sizeof ("MOUSEINPUT");
 }
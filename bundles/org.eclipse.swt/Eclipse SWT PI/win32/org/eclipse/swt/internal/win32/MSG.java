@@ -10,6 +10,9 @@
  *******************************************************************************/
 package org.eclipse.swt.internal.win32;
 
+/**
+ * @jniclass flags=preload
+ */
 public class MSG {
 	/** @field cast=(HWND) */
 	public long /*int*/ hwnd;
@@ -22,5 +25,5 @@ public class MSG {
 	public int x; 
 	/** @field accessor=pt.y */
 	public int y;
-	public static final int sizeof = OS.MSG_sizeof ();
+	public static final int sizeof = OS.sizeof ("MSG");
 }
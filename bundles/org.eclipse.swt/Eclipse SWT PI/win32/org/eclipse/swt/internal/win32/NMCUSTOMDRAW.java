@@ -26,5 +26,5 @@ public class NMCUSTOMDRAW extends NMHDR {
 	public long /*int*/ dwItemSpec;
 	public int uItemState;
 	public long /*int*/ lItemlParam;
-	public static final int sizeof = OS.NMCUSTOMDRAW_sizeof ();
+	public static final int sizeof = OS.sizeof ("NMCUSTOMDRAW");
 }
@@ -15,5 +15,5 @@ public class NMHDR {
 	public long /*int*/ hwndFrom; 
 	public long /*int*/ idFrom; 
 	public int code;
-	public static final int sizeof = OS.NMHDR_sizeof ();
+	public static final int sizeof = OS.sizeof ("NMHDR");
 }
@@ -15,5 +15,5 @@ public class NMHEADER extends NMHDR {
 	public int iButton; 
 	/** @field cast=(HDITEM FAR *) */
 	public long /*int*/ pitem; 
-	public static int sizeof = OS.NMHEADER_sizeof ();
+	public static int sizeof = OS.sizeof ("NMHEADER");
 }
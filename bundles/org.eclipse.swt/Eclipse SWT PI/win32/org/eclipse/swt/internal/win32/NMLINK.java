@@ -24,5 +24,5 @@ public class NMLINK extends NMHDR {
 	public char[] szID = new char[OS.MAX_LINKID_TEXT];
 	/** @field accessor=item.szUrl */
 	public char[] szUrl = new char[OS.L_MAX_URL_LENGTH];
-	public static final int sizeof = OS.NMLINK_sizeof ();
+	public static final int sizeof = OS.sizeof ("NMLINK");
 }
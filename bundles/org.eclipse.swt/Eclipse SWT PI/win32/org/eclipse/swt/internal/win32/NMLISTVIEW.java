@@ -22,5 +22,5 @@ public class NMLISTVIEW extends NMHDR {
 	/** @field accessor=ptAction.y */
 	public int y;
 	public long /*int*/ lParam;
-	public static int sizeof = OS.NMLISTVIEW_sizeof ();
+	public static int sizeof = OS.sizeof ("NMLISTVIEW");
 }
@@ -37,5 +37,5 @@ public class NMLVCUSTOMDRAW extends NMCUSTOMDRAW {
 	public int rcText_bottom;
 	/** @field flags=no_wince */
 	public int uAlign; 
-	public static final int sizeof = !OS.IsWinCE && OS.WIN32_VERSION >= OS.VERSION (5, 1) ? OS.NMLVCUSTOMDRAW_sizeof () : 60;
+	public static final int sizeof = !OS.IsWinCE && OS.WIN32_VERSION >= OS.VERSION (5, 1) ? OS.sizeof ("NMLVCUSTOMDRAW") : 60;
 }
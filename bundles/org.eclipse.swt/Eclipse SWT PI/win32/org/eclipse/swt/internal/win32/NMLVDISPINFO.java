@@ -38,5 +38,5 @@ public class NMLVDISPINFO extends NMHDR {
 	public int cColumns;
 	/** @field accessor=item.puColumns,cast=(PUINT),flags=no_wince */
 	public long /*int*/ puColumns;
-	public static final int sizeof = !OS.IsWinCE && OS.WIN32_VERSION >= OS.VERSION (5, 1) ? OS.NMLVDISPINFO_sizeof () : 52;
+	public static final int sizeof = !OS.IsWinCE && OS.WIN32_VERSION >= OS.VERSION (5, 1) ? OS.sizeof ("NMLVDISPINFO") : 52;
 }
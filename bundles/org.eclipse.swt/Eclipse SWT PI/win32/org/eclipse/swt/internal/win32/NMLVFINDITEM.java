@@ -26,5 +26,5 @@ public class NMLVFINDITEM extends NMHDR {
 	public int y;
 	/** @field accessor=lvfi.vkDirection */
 	public int vkDirection;
-	public static final int sizeof = OS.NMLVFINDITEM_sizeof ();
+	public static final int sizeof = OS.sizeof ("NMLVFINDITEM");
 }
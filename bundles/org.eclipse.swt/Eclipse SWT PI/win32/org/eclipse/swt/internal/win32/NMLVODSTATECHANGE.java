@@ -16,5 +16,5 @@ public class NMLVODSTATECHANGE extends NMHDR {
 	public int iTo;
 	public int uNewState;
 	public int uOldState;
-	public static final int sizeof = OS.NMLVODSTATECHANGE_sizeof ();
+	public static final int sizeof = OS.sizeof ("NMLVODSTATECHANGE");
 }
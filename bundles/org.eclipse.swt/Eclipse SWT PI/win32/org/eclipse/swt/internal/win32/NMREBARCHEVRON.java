@@ -24,5 +24,5 @@ public class NMREBARCHEVRON extends NMHDR {
 	/** @field accessor=rc.bottom */
 	public int bottom;
 	public long /*int*/ lParamNM;
-	public static int sizeof = OS.NMREBARCHEVRON_sizeof ();
+	public static int sizeof = OS.sizeof ("NMREBARCHEVRON");
 }
@@ -31,5 +31,5 @@ public class NMREBARCHILDSIZE extends NMHDR {
 	public int rcBand_right;
 	/** @field accessor=rcBand.bottom */
 	public int rcBand_bottom;
-	public static final int sizeof = OS.NMREBARCHILDSIZE_sizeof ();
+	public static final int sizeof = OS.sizeof ("NMREBARCHILDSIZE");
 }
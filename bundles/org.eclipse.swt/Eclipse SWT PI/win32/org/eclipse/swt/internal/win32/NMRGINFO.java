@@ -17,5 +17,5 @@ public class NMRGINFO extends NMHDR {
 	/** @field accessor=ptAction.y */
 	public int y;
 	public int dwItemSpec;
-	public static int sizeof = OS.NMRGINFO_sizeof ();
+	public static int sizeof = OS.sizeof ("NMRGINFO");
 }
@@ -14,5 +14,5 @@ public class NMTBHOTITEM extends NMHDR {
 	public int idOld;
 	public int idNew;
 	public int dwFlags;
-	public static final int sizeof = OS.NMTBHOTITEM_sizeof ();
+	public static final int sizeof = OS.sizeof ("NMTBHOTITEM");
 }
@@ -38,5 +38,5 @@ public class NMTOOLBAR extends NMHDR {
 	/** @field accessor=rcButton.bottom,flags=no_wince */
 	public int bottom;
 	/* Note in WinCE.  The field rcButton is not defined. */
-	public static final int sizeof = OS.NMTOOLBAR_sizeof ();
+	public static final int sizeof = OS.sizeof ("NMTOOLBAR");
 }
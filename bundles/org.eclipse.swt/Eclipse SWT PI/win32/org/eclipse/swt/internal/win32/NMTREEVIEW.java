@@ -16,5 +16,5 @@ public class NMTREEVIEW {
 	public TVITEM itemOld = new TVITEM ();
 	public TVITEM itemNew = new TVITEM ();
 	public POINT ptDrag = new POINT ();
-	public static final int sizeof = OS.NMTREEVIEW_sizeof ();
+	public static final int sizeof = OS.sizeof ("NMTREEVIEW");
 }
@@ -12,5 +12,5 @@ package org.eclipse.swt.internal.win32;
 
 public class NMTTCUSTOMDRAW extends NMCUSTOMDRAW {
 	public int uDrawFlags;
-	public static final int sizeof = OS.NMTTCUSTOMDRAW_sizeof ();
+	public static final int sizeof = OS.sizeof ("NMTTCUSTOMDRAW");
 }
\ No newline at end of file
@@ -17,5 +17,5 @@ public abstract class NMTTDISPINFO extends NMHDR {
 	public long /*int*/ hinst;   
 	public int uFlags;
 	public long /*int*/ lParam;
-	public static final int sizeof = OS.IsUnicode ? OS.NMTTDISPINFOW_sizeof () : OS.NMTTDISPINFOA_sizeof ();
+	public static final int sizeof = OS.IsUnicode ? OS.sizeof ("NMTTDISPINFOW") : OS.sizeof ("NMTTDISPINFOA");
 }
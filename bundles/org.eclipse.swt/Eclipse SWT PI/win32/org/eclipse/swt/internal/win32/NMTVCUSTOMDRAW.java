@@ -15,5 +15,5 @@ public class NMTVCUSTOMDRAW extends NMCUSTOMDRAW {
 	public int clrTextBk;
 	/** @field flags=no_wince */
 	public int iLevel; // the iLevel field does not appear on WinCE
-	public static final int sizeof = OS.NMTVCUSTOMDRAW_sizeof ();
+	public static final int sizeof = OS.sizeof ("NMTVCUSTOMDRAW");
 }
@@ -32,5 +32,5 @@ public class NMTVDISPINFO extends NMHDR {
 	public int cChildren;
 	/** @field accessor=item.lParam */
 	public long /*int*/ lParam;
-	public static final int sizeof = OS.NMTVDISPINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("NMTVDISPINFO");
 }
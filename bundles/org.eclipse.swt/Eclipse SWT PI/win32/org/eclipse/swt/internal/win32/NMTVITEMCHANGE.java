@@ -17,5 +17,5 @@ public class NMTVITEMCHANGE extends NMHDR {
 	public int uStateNew;
 	public int uStateOld;
 	public long /*int*/ lParam;
-	public static int sizeof = OS.NMTVITEMCHANGE_sizeof ();
+	public static int sizeof = OS.sizeof ("NMTVITEMCHANGE");
 }
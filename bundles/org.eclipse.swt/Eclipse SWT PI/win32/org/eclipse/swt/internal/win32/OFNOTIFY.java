@@ -15,5 +15,5 @@ public class OFNOTIFY extends NMHDR {
 	public long /*int*/ lpOFN;
 	/** @field cast=(LPTSTR) */
 	public long /*int*/ pszFile;
-	public static int sizeof = OS.OFNOTIFY_sizeof ();
+	public static int sizeof = OS.sizeof ("OFNOTIFY");
 }
@@ -48,5 +48,5 @@ public class OPENFILENAME {
 	public int dwReserved;
 	/** @field flags=no_wince */
 	public int FlagsEx;   
-	public static final int sizeof = !OS.IsWinCE && OS.WIN32_VERSION >= OS.VERSION (5, 0) ? OS.OPENFILENAME_sizeof () : 76;
+	public static final int sizeof = !OS.IsWinCE && OS.WIN32_VERSION >= OS.VERSION (5, 0) ? OS.sizeof ("OPENFILENAME") : 76;
 }
@@ -16,6 +16,7 @@ import org.eclipse.swt.internal.*;
 public class OS extends C {
 	static {
 		Library.loadLibrary ("swt"); //$NON-NLS-1$
+		cacheStructFields ();
 	}
 	
 	/*
@@ -256,6 +257,10 @@ public class OS extends C {
 	public static final int ATTR_TARGET_NOTCONVERTED = 0x03;
 	public static final int ATTR_INPUT_ERROR = 0x04;
 	public static final int ATTR_FIXEDCONVERTED = 0x05;
+	public static final int BATCH_ALPHABLEND = 2;
+	public static final int BATCH_BITBLT = 0;
+	public static final int BATCH_SIZE = 12;
+	public static final int BATCH_STRETCHBLT = 1;
 	public static final int BCM_FIRST = 0x1600;
 	public static final int BCM_GETIDEALSIZE = BCM_FIRST + 0x1;
 	public static final int BCM_GETIMAGELIST = BCM_FIRST + 0x3;
@@ -521,8 +526,13 @@ public class OS extends C {
 	public static final int DCX_CLIPSIBLINGS = 0x10;
 	public static final int DCX_INTERSECTRGN = 0x80;
 	public static final int DCX_WINDOW = 0x1;
+	public static final int DECODE_NMHDR = 0;
+	public static final int DECODE_NMLVCUSTOMDRAW = 1;
+	public static final int DECODE_NMTVCUSTOMDRAW = 2;
+	public static final int DECODE_SIZE = 26;
 	public static final int DEFAULT_CHARSET = 0x1;
 	public static final int DEFAULT_GUI_FONT = 0x11;
+	public static final int DEFER_SIZE = 6;
 	public static final int DFCS_BUTTONCHECK = 0x0;
 	public static final int DFCS_CHECKED = 0x400;
 	public static final int DFCS_FLAT = 0x4000;
@@ -1011,6 +1021,8 @@ public class OS extends C {
 	public static final int LPSTR_TEXTCALLBACK = 0xffffffff;
 	public static final int LR_DEFAULTCOLOR = 0x0;
 	public static final int LR_SHARED = 0x8000;
+	public static final int LVCACHE_NONE = -2;
+	public static final int LVCACHE_UNKNOWN = -1;
 	public static final int LVCFMT_BITMAP_ON_RIGHT = 0x1000;
 	public static final int LVCFMT_CENTER = 0x2;
 	public static final int LVCFMT_IMAGE = 0x800;
@@ -1392,6 +1404,12 @@ public class OS extends C {
 	public static final int PS_STYLE_MASK = 0xf;
 	public static final int PS_TYPE_MASK = 0x000f0000;
 	public static final int PS_USERSTYLE = 0x7;
+	public static final int PUMP_COALESCE = 0x1;
+	public static final int PUMP_DISPATCH = 0x2;
+	public static final int PUMP_HANDLED = 2;
+	public static final int PUMP_MESSAGE = 1;
+	public static final int PUMP_NONE = 0;
+	public static final int PUMP_SKIP_DESTROYED = 0x4;
 	public static final int R2_COPYPEN = 0xd;
 	public static final int R2_XORPEN = 0x7;
 	public static final int RASTERCAPS = 0x26;
@@ -2414,6 +2432,47 @@ public static final native int UDACCEL_sizeof ();
 public static final native int WINDOWPLACEMENT_sizeof ();
 public static final native int WINDOWPOS_sizeof ();
 public static final native int WNDCLASS_sizeof ();
+/**
+ * Answers the names of the structs with a *_sizeof native, separated by
+ * commas, and copies their sizes into <code>sizes</code> when it is large
+ * enough, so that all the sizes cost one call.
+ * @method flags=sizeof
+ */
+public static final native String sizeofs (int [] sizes);
+static String [] sizeofNames;
+static int [] sizeofSizes;
+
+/**
+ * Answers the size of the struct with the given name, from the sizes
+ * fetched at once by <code>sizeofs</code>.
+ *
+ * @exception UnsatisfiedLinkError if the struct is not known, as when it is compiled out of the library
+ */
+public static synchronized int sizeof (String name) {
+	if (sizeofNames == null) {
+		int [] sizes = new int [256];
+		String names = sizeofs (sizes);
+		int count = 0, index = 0;
+		while ((index = names.indexOf (',', index) + 1) > 0) count++;
+		if (count > sizes.length) {
+			sizes = new int [count];
+			sizeofs (sizes);
+		}
+		String [] result = new String [count];
+		int start = 0;
+		for (int i = 0; i < count; i++) {
+			int end = names.indexOf (',', start);
+			result [i] = names.substring (start, end);
+			start = end + 1;
+		}
+		sizeofSizes = sizes;
+		sizeofNames = result;
+	}
+	for (int i = 0; i < sizeofNames.length; i++) {
+		if (sizeofNames [i].equals (name)) return sizeofSizes [i];
+	}
+	throw new UnsatisfiedLinkError ("No size for struct " + name);
+}
 
 /** Ansi/Unicode wrappers */
 
@@ -3618,16 +3677,35 @@ public static final native boolean AttachThreadInput (int idAttach, int idAttach
  * @param phdc cast=(HDC*)
  */
 public static final native long /*int*/ BeginBufferedPaint (long /*int*/ hdcTarget, RECT prcTarget, int dwFormat, BP_PAINTPARAMS pPaintParams, long /*int*/ [] phdc);
+/*
+ * Returns a memory HDC from a back buffer cached for hWnd, or 0 when no
+ * buffer is available.  The buffer is at least as large as prcTarget and
+ * its window origin is the top left corner of prcTarget, so that it is
+ * drawn in the coordinates of the target.  The state of the HDC is saved
+ * and restored by EndCachedPaint.
+ */
+/** @method flags=no_gen */
+public static final native long /*int*/ BeginCachedPaint (long /*int*/ hWnd, long /*int*/ hdcTarget, RECT prcTarget);
 public static final native long /*int*/ BeginDeferWindowPos (int nNumWindows);
 /** @param hWnd cast=(HWND) */
 public static final native long /*int*/ BeginPaint (long /*int*/ hWnd, PAINTSTRUCT lpPaint);
 /** @param hdc cast=(HDC) */
 public static final native boolean BeginPath(long /*int*/ hdc);
 /**
+ * @method flags=leaf
  * @param hdcDest cast=(HDC)
  * @param hdcSrc cast=(HDC)
  */
 public static final native boolean BitBlt (long /*int*/ hdcDest, int nXDest, int nYDest, int nWidth, int nHeight, long /*int*/ hdcSrc, int nXSrc, int nYSrc, int dwRop);
+/*
+ * Runs count blits of BATCH_SIZE longs each: the BATCH_* kind, hdcDest,
+ * x, y, width and height, hdcSrc, x, y, width and height, then the raster
+ * operation, or the BLENDFUNCTION packed into an int for AlphaBlend.  A
+ * positive batchLimit is set with GdiSetBatchLimit around the calls,
+ * which are then flushed.  Returns the number of blits that succeeded.
+ */
+/** @method flags=no_gen */
+public static final native int BitBltBatch (long[] blits, int count, int batchLimit);
 /** @param hWnd cast=(HWND) */
 public static final native boolean BringWindowToTop (long /*int*/ hWnd);
 /** @method flags=dynamic */
@@ -3688,6 +3766,12 @@ public static final native boolean ChooseColorA (CHOOSECOLOR lpcc);
 /** @param chooseFont cast=(LPCHOOSEFONTW) */
 public static final native boolean ChooseFontW (CHOOSEFONT chooseFont);
 public static final native boolean ChooseFontA (CHOOSEFONT chooseFont);
+/*
+ * Removes the calling thread from the threads with a wake message pending,
+ * see PostWakeMessage.  Returns true if a wake was pending.
+ */
+/** @method flags=no_gen */
+public static final native boolean ClearWakeMessage ();
 /** @param hWnd cast=(HWND) */
 public static final native boolean ClientToScreen (long /*int*/ hWnd, POINT lpPoint);
 public static final native boolean CloseClipboard ();
@@ -3781,16 +3865,25 @@ public static final native long /*int*/ CreateActCtxW (ACTCTX pActCtx);
  * @param pActCtx flags=no_out
  */
 public static final native long /*int*/ CreateActCtxA (ACTCTX pActCtx);
-/** @param lpvBits cast=(CONST VOID *),flags=no_out critical */
+/**
+ * @method resource=HBITMAP,size=(jlong)arg0*arg1*arg2*arg3/8
+ * @param lpvBits cast=(CONST VOID *),flags=no_out critical
+ */
 public static final native long /*int*/ CreateBitmap (int nWidth, int nHeight, int cPlanes, int cBitsPerPel, byte [] lpvBits);
 /**
  * @param hWnd cast=(HWND)
  * @param hBitmap cast=(HBITMAP)
  */
 public static final native boolean CreateCaret (long /*int*/ hWnd, long /*int*/ hBitmap, int nWidth, int nHeight);
-/** @param hdc cast=(HDC) */
+/**
+ * @method resource=HBITMAP,size=(jlong)arg1*arg2*4
+ * @param hdc cast=(HDC)
+ */
 public static final native long /*int*/ CreateCompatibleBitmap (long /*int*/ hdc, int nWidth, int nHeight);
-/** @param hdc cast=(HDC) */
+/**
+ * @method resource=HDC
+ * @param hdc cast=(HDC)
+ */
 public static final native long /*int*/ CreateCompatibleDC (long /*int*/ hdc);
 /**
  * @param hInst cast=(HINSTANCE)
@@ -3813,6 +3906,7 @@ public static final native long /*int*/ CreateDCW (char [] lpszDriver, char [] l
  */
 public static final native long /*int*/ CreateDCA (byte [] lpszDriver, byte [] lpszDevice, long /*int*/ lpszOutput, long /*int*/ lpInitData);  
 /**
+ * @method resource=HBITMAP
  * @param hdc cast=(HDC)
  * @param pbmi cast=(BITMAPINFO *),flags=no_out critical
  * @param ppvBits cast=(VOID **),flags=no_in critical
@@ -3820,6 +3914,7 @@ public static final native long /*int*/ CreateDCA (byte [] lpszDriver, byte [] l
  */
 public static final native long /*int*/ CreateDIBSection(long /*int*/ hdc, byte[] pbmi, int iUsage, long /*int*/[] ppvBits, long /*int*/ hSection, int dwOffset);
 /**
+ * @method resource=HBITMAP
  * @param hdc cast=(HDC)
  * @param pbmi cast=(BITMAPINFO *),flags=no_out critical
  * @param ppvBits cast=(VOID **),flags=no_in critical
@@ -3838,24 +3933,66 @@ public static final native long /*int*/ CreateEnhMetaFileW(long /*int*/ hdcRef,
  * @param lpDescription cast=(LPCSTR)
  */
 public static final native long /*int*/ CreateEnhMetaFileA(long /*int*/ hdcRef, byte[] lpFilename, RECT lpRect, byte[] lpDescription);
-/** @param lplf cast=(LPLOGFONTW) */
+/**
+ * @method resource=HFONT
+ * @param lplf cast=(LPLOGFONTW)
+ */
 public static final native long /*int*/ CreateFontIndirectW (long /*int*/ lplf);
-/** @param lplf cast=(LPLOGFONTA) */
+/**
+ * @method resource=HFONT
+ * @param lplf cast=(LPLOGFONTA)
+ */
 public static final native long /*int*/ CreateFontIndirectA (long /*int*/ lplf);
-/** @param lplf flags=no_out */
+/**
+ * @method resource=HFONT
+ * @param lplf flags=no_out
+ */
 public static final native long /*int*/ CreateFontIndirectW (LOGFONTW lplf);
-/** @param lplf flags=no_out */
+/**
+ * @method resource=HFONT
+ * @param lplf flags=no_out
+ */
 public static final native long /*int*/ CreateFontIndirectA (LOGFONTA lplf);
+/*
+ * Answers the font cached for an equal LOGFONTW, or creates one with
+ * CreateFontIndirectW and caches it.  The font is shared and must be
+ * released with ReleaseCachedFont instead of DeleteObject.
+ */
+/** @method flags=no_gen */
+public static final native long /*int*/ CreateFontCached (LOGFONTW lplf);
 /** @param lplf flags=no_out */
 public static final native long /*int*/ CreateIconIndirect (ICONINFO lplf);
+/*
+ * Creates a surface of the given size for a layered window presented
+ * with UpdateLayeredSurface.  Returns zero when it cannot be created.
+ */
+/** @method flags=no_gen */
+public static final native long /*int*/ CreateLayeredSurface (int width, int height);
+/*
+ * Creates a cache of cell text and images for the list view hWnd.
+ * LVN_GETDISPINFOW notifications for cached cells are answered by a
+ * subclass of the parent window and do not reach the window proc.
+ * Returns false when the cache cannot be created.
+ */
+/** @method flags=no_gen */
+public static final native boolean CreateListViewCache (long /*int*/ hWnd);
 public static final native long /*int*/ CreateMenu ();
 /** @param logPalette cast=(LOGPALETTE *),flags=no_out critical */
 public static final native long /*int*/ CreatePalette (byte[] logPalette);
-/** @param hbmp cast=(HBITMAP) */
+/**
+ * @method resource=HBRUSH
+ * @param hbmp cast=(HBITMAP)
+ */
 public static final native long /*int*/ CreatePatternBrush (long /*int*/ hbmp);
-/** @param crColor cast=(COLORREF) */
+/**
+ * @method resource=HPEN
+ * @param crColor cast=(COLORREF)
+ */
 public static final native long /*int*/ CreatePen (int fnPenStyle, int nWidth, int crColor);
-/** @param lppt cast=(CONST POINT *) */
+/**
+ * @method resource=HRGN
+ * @param lppt cast=(CONST POINT *),flags=no_out critical
+ */
 public static final native long /*int*/ CreatePolygonRgn(int[] lppt, int cPoints, int fnPolyFillMode);
 public static final native long /*int*/ CreatePopupMenu ();
 /**
@@ -3880,8 +4017,19 @@ public static final native boolean CreateProcessW (long /*int*/ lpApplicationNam
  * @param lpProcessInformation cast=(LPPROCESS_INFORMATION)
  */
 public static final native boolean CreateProcessA (long /*int*/ lpApplicationName, long /*int*/ lpCommandLine, long /*int*/ lpProcessAttributes, long /*int*/ lpThreadAttributes, boolean bInheritHandles, int dwCreationFlags, long /*int*/ lpEnvironment, long /*int*/ lpCurrentDirectory, STARTUPINFO lpStartupInfo, PROCESS_INFORMATION lpProcessInformation);
+/** @method resource=HRGN */
 public static final native long /*int*/ CreateRectRgn (int left, int top, int right, int bottom);
-/** @param colorRef cast=(COLORREF) */
+/*
+ * Creates a region that is the union of count rectangles stored as four
+ * ints each, the x, y, width and height, with ExtCreateRegion instead of
+ * combining a region for each rectangle.  Returns 0 on failure.
+ */
+/** @method flags=no_gen */
+public static final native long /*int*/ CreateRectRgnBatch (int[] lpRects, int nCount);
+/**
+ * @method resource=HBRUSH
+ * @param colorRef cast=(COLORREF)
+ */
 public static final native long /*int*/ CreateSolidBrush (int colorRef);
 /**
  * @param hGlobal cast=(HGLOBAL)
@@ -3904,12 +4052,29 @@ public static final native long /*int*/ CreateWindowExW (int dwExStyle, char []
  * @param hInstance cast=(HINSTANCE)
  */
 public static final native long /*int*/ CreateWindowExA (int dwExStyle, byte [] lpClassName, byte [] lpWindowName, int dwStyle, int X, int Y, int nWidth, int nHeight, long /*int*/ hWndParent, long /*int*/ hMenu, long /*int*/ hInstance, CREATESTRUCT lpParam);
+/*
+ * Copies Length bytes of the DECODE_* notification structure at lParam
+ * into the long slots of a direct buffer that holds DECODE_SIZE longs, in
+ * the order of the fields of the Java class.  Returns false when the buffer
+ * is not direct or too small.
+ */
+/** @method flags=no_gen */
+public static final native boolean DecodeNotify (long /*int*/ lParam, int kind, int Length, java.nio.ByteBuffer buffer);
 /**
  * @param hWinPosInfo cast=(HDWP)
  * @param hWnd cast=(HWND)
  * @param hWndInsertAfter cast=(HWND)
  */
 public static final native long /*int*/ DeferWindowPos (long /*int*/ hWinPosInfo, long /*int*/ hWnd, long /*int*/ hWndInsertAfter, int X, int Y, int cx, int cy, int uFlags);
+/*
+ * Moves count windows of DEFER_SIZE longs each, the hwnd, x, y, width,
+ * height and SWP_* flags, in a single BeginDeferWindowPos and
+ * EndDeferWindowPos.  A zero hwnd is skipped.  Returns false when the
+ * positions could not be deferred, in which case none or only some of
+ * the windows may have moved and the caller should use SetWindowPos.
+ */
+/** @method flags=no_gen */
+public static final native boolean DeferWindowPosBatch (long[] positions, int count);
 /**
  * @param hWnd cast=(HWND)
  * @param wParam cast=(WPARAM)
@@ -3948,13 +4113,19 @@ public static final native long /*int*/ DefWindowProcW (long /*int*/ hWnd, int M
  * @param lParam cast=(LPARAM)
  */
 public static final native long /*int*/ DefWindowProcA (long /*int*/ hWnd, int Msg, long /*int*/ wParam, long /*int*/ lParam);
-/** @param hdc cast=(HDC) */
+/**
+ * @method flags=destroy
+ * @param hdc cast=(HDC)
+ */
 public static final native boolean DeleteDC (long /*int*/ hdc);
 /** @param hemf cast=(HENHMETAFILE) */
 public static final native boolean DeleteEnhMetaFile (long /*int*/ hemf);
 /** @param hMenu cast=(HMENU) */
 public static final native boolean DeleteMenu (long /*int*/ hMenu, int uPosition, int uFlags);
-/** @param hGdiObj cast=(HGDIOBJ) */
+/**
+ * @method flags=destroy
+ * @param hGdiObj cast=(HGDIOBJ)
+ */
 public static final native boolean DeleteObject (long /*int*/ hGdiObj);
 /** @param hAccel cast=(HACCEL) */
 public static final native boolean DestroyAcceleratorTable (long /*int*/ hAccel);
@@ -3963,6 +4134,10 @@ public static final native boolean DestroyCaret ();
 public static final native boolean DestroyCursor (long /*int*/ hCursor);
 /** @param hIcon cast=(HICON) */
 public static final native boolean DestroyIcon (long /*int*/ hIcon);
+/** @method flags=no_gen */
+public static final native void DestroyLayeredSurface (long /*int*/ surface);
+/** @method flags=no_gen */
+public static final native void DestroyListViewCache (long /*int*/ hWnd);
 /** @param hMenu cast=(HMENU) */
 public static final native boolean DestroyMenu (long /*int*/ hMenu);
 /** @param hWnd cast=(HWND) */
@@ -4004,6 +4179,12 @@ public static final native int DragQueryFileA (long /*int*/ hDrop, int iFile, by
  * @param lpszFile cast=(LPWSTR)
  */
 public static final native int DragQueryFileW (long /*int*/ hDrop, int iFile, char[] lpszFile, int cch);
+/*
+ * Returns the names of the files of hDrop in one string, each followed
+ * by a null character, or null when they cannot be read.
+ */
+/** @method flags=no_gen */
+public static final native String DragQueryFiles (long /*int*/ hDrop);
 /** @param hwnd cast=(HWND) */
 public static final native boolean DrawAnimatedRects (long /*int*/ hwnd, int idAni, RECT lprcFrom, RECT lprcTo);
 /** @param hdc cast=(HDC) */
@@ -4054,6 +4235,14 @@ public static final native int DrawTextA (long /*int*/ hDC, byte [] lpString, in
  * @param pClipRect cast=(const RECT *)
  */
 public static final native int DrawThemeBackground (long /*int*/ hTheme, long /*int*/ hdc, int iPartId, int iStateId, RECT pRect, RECT pClipRect);
+/*
+ * Draws like DrawThemeBackground, copying opaque parts from a DIB that
+ * is rendered the first time a part is drawn in a state and size.  Only
+ * theme handles that are flushed with FlushThemeCache before they are
+ * closed may be passed.
+ */
+/** @method flags=no_gen */
+public static final native int DrawThemeBackgroundCached (long /*int*/ hTheme, long /*int*/ hdc, int iPartId, int iStateId, RECT pRect, RECT pClipRect);
 /** @method flags=dynamic */
 public static final native int DrawThemeEdge (long /*int*/ hTheme, long /*int*/ hdc, int iPartId, int iStateId, RECT pDestRect, int uEdge, int uFlags, RECT pContentRect);
 /** @method flags=dynamic */
@@ -4076,6 +4265,13 @@ public static final native int DwmEnableBlurBehindWindow (long /*int*/ hWnd, DWM
 public static final native int DwmExtendFrameIntoClientArea (long /*int*/ hWnd, MARGINS pMarInset);
 /** @method flags=dynamic */
 public static final native int DwmIsCompositionEnabled (boolean[] pfEnabled); 
+/*
+ * Returns the text of an edit control.  A multi line control lends its
+ * own buffer, so that the characters are copied once, into the string.
+ * Returns null when the string cannot be allocated.
+ */
+/** @method flags=no_gen */
+public static final native String Edit_GetString (long /*int*/ hWnd);
 /** @param hdc cast=(HDC) */
 public static final native boolean Ellipse (long /*int*/ hdc, int nLeftRect, int nTopRect, int nRightRect, int nBottomRect);
 /** @param hMenu cast=(HMENU) */
@@ -4107,6 +4303,12 @@ public static final native boolean EndDeferWindowPos (long /*int*/ hWinPosInfo);
  * @param hBufferedPaint cast=(HPAINTBUFFER)
  */
 public static final native int EndBufferedPaint (long /*int*/ hBufferedPaint, boolean fUpdateTarget);
+/*
+ * Ends the paint started by BeginCachedPaint for hWnd, copies the buffer
+ * to hdcTarget when fUpdateTarget is set and keeps it for the next paint.
+ */
+/** @method flags=no_gen */
+public static final native boolean EndCachedPaint (long /*int*/ hWnd, long /*int*/ hdcTarget, boolean fUpdateTarget);
 /** @param hdc cast=(HDC) */
 public static final native int EndDoc (long /*int*/ hdc);
 /** @param hdc cast=(HDC) */
@@ -4173,6 +4375,7 @@ public static final native int ExcludeClipRect (long /*int*/ hdc, int nLeftRect,
 public static final native int ExpandEnvironmentStringsW (char [] lpSrc, char [] lsDst, int nSize);
 public static final native int ExpandEnvironmentStringsA (byte [] lpSrc, byte [] lsDst, int nSize);
 /**
+ * @method resource=HPEN
  * @param lplb cast=(CONST LOGBRUSH *)
  * @param lpStyle cast=(CONST DWORD *)
  */
@@ -4182,6 +4385,14 @@ public static final native long /*int*/ ExtCreatePen (int dwPenStyle, int dwWidt
  * @param lpRgnData cast=(CONST RGNDATA *)
  */
 public static final native long /*int*/ ExtCreateRegion (float[] lpXform, int nCount, int[] lpRgnData);
+/*
+ * Draws or measures count runs of lpString in one call.  Each run is seven
+ * longs: offset, length, x, y, font, color and ExtTextOut options.  A zero
+ * font or a color of -1 keeps the current one.  When lpExtents is not null
+ * it receives the width and height of every run and nothing is drawn.
+ */
+/** @method flags=no_gen */
+public static final native boolean ExtTextOutRuns (long /*int*/ hdc, char[] lpString, long[] runs, int count, int[] lpExtents);
 /**
  * @param hdc cast=(HDC)
  * @param lprc flags=no_out
@@ -4227,6 +4438,12 @@ public static final native long /*int*/ FindWindowA (byte [] lpClassName, byte [
  * @param lpWindowName cast=(LPWSTR)
  */
 public static final native long /*int*/ FindWindowW (char [] lpClassName, char [] lpWindowName);
+/*
+ * Discards the parts DrawThemeBackgroundCached rendered with hTheme,
+ * or every part when hTheme is zero.
+ */
+/** @method flags=no_gen */
+public static final native void FlushThemeCache (long /*int*/ hTheme);
 /**
  * @param lpSource cast=(LPCVOID)
  * @param lpBuffer cast=(LPSTR)
@@ -4405,6 +4622,9 @@ public static final native int GetKeyNameTextA (int lParam, byte [] lpString, in
 /** @param hWnd cast=(HWND) */
 public static final native long /*int*/ GetLastActivePopup (long /*int*/ hWnd);
 public static final native int GetLastError ();
+/* Returns the memory DC of the surface, to draw the next frame into */
+/** @method flags=no_gen */
+public static final native long /*int*/ GetLayeredSurfaceDC (long /*int*/ surface);
 /**
  * @method flags=dynamic
  * @param hwnd cast=(HWND)
@@ -4695,6 +4915,13 @@ public static final native boolean GetTextExtentPoint32W (long /*int*/ hdc, char
  * @param lpSize flags=no_in
  */
 public static final native boolean GetTextExtentPoint32A (long /*int*/ hdc, byte [] lpString, int cbString, SIZE lpSize);
+/*
+ * Same as GetTextExtentPoint32W, but a string of printable ASCII
+ * characters is measured from the advance widths kept for the cached
+ * font selected in hdc, see CreateFontCached.
+ */
+/** @method flags=no_gen */
+public static final native boolean GetTextExtentPoint32Cached (long /*int*/ hdc, char [] lpString, int cbString, SIZE lpSize);
 /**
  * @param hdc cast=(HDC)
  * @param lptm flags=no_in
@@ -4705,6 +4932,12 @@ public static final native boolean GetTextMetricsW (long /*int*/ hdc, TEXTMETRIC
  * @param lptm flags=no_in
  */
 public static final native boolean GetTextMetricsA (long /*int*/ hdc, TEXTMETRICA lptm);
+/*
+ * Same as GetTextMetricsW, but answers the metrics kept for the cached
+ * font selected in hdc, see CreateFontCached.
+ */
+/** @method flags=no_gen */
+public static final native boolean GetTextMetricsCached (long /*int*/ hdc, TEXTMETRICW lptm);
 /** @method flags=dynamic */
 public static final native int GetThemeInt (long /*int*/ hTheme, int iPartId, int iStateId, int iPropId, int[] piVal);
 /** @method flags=dynamic */
@@ -4820,8 +5053,28 @@ public static final native int GlobalAddAtomW (char [] lpString);
 /** @param lpString cast=(LPCTSTR) */
 public static final native int GlobalAddAtomA (byte [] lpString);
 public static final native long /*int*/ GlobalAlloc (int uFlags, int dwBytes);
+/*
+ * Allocates a fixed packed DIB with the header and color table in bmi
+ * followed by height rows of bytesPerLine bytes from bits, which are top
+ * down and stored bottom up.  Returns zero when it cannot be allocated.
+ */
+/** @method flags=no_gen */
+public static final native long /*int*/ GlobalAllocDIB (byte[] bmi, byte[] bits, int bytesPerLine, int height);
+/*
+ * Allocates fixed memory holding the characters of string and a null
+ * terminator, copied without an intermediate char array.  Returns zero
+ * when it cannot be allocated.
+ */
+/** @method flags=no_gen */
+public static final native long /*int*/ GlobalAllocString (String string);
 /** @param hMem cast=(HANDLE) */
 public static final native long /*int*/ GlobalFree (long /*int*/ hMem);
+/*
+ * Returns the characters of hMem up to the first null character, or
+ * null when the memory is empty or cannot be locked.
+ */
+/** @method flags=no_gen */
+public static final native String GlobalGetString (long /*int*/ hMem);
 /** @param hMem cast=(HANDLE) */
 public static final native long /*int*/ GlobalLock (long /*int*/ hMem);
 /** @param hMem cast=(HANDLE) */
@@ -4869,6 +5122,15 @@ public static final native int IIDFromString (char[] lpsz, byte[] lpiid);
  * @param hbmMask cast=(HBITMAP)
  */
 public static final native int ImageList_Add (long /*int*/ himl, long /*int*/ hbmImage, long /*int*/ hbmMask);
+/*
+ * Adds count bitmaps to the end of an image list, each copied into a
+ * 32-bit DIB with the matching entry of alphaData, or made opaque when
+ * the entry or the array is null, and stretched to the icon size.
+ * Returns the number of bitmaps added, which is less than count when
+ * one could not be added.
+ */
+/** @method flags=no_gen */
+public static final native int ImageList_AddBatch (long /*int*/ himl, long /*int*/[] hBitmaps, byte[][] alphaData, int count);
 /**
  * @param himl cast=(HIMAGELIST)
  * @param hbmImage cast=(HBITMAP)
@@ -5059,6 +5321,12 @@ public static final native int IntersectClipRect (long /*int*/ hdc, int nLeftRec
  * @param lprcSrc2 flags=no_out
  */
 public static final native boolean IntersectRect (RECT lprcDst, RECT lprcSrc1, RECT lprcSrc2);
+/*
+ * Removes the cells of row iItem from the list view cache of hWnd, or
+ * every cell when iItem is -1.
+ */
+/** @method flags=no_gen */
+public static final native void InvalidateListViewCache (long /*int*/ hWnd, int iItem);
 /** @param hWnd cast=(HWND) */
 public static final native boolean InvalidateRect (long /*int*/ hWnd, RECT lpRect, boolean bErase);
 /**
@@ -5172,6 +5440,13 @@ public static final native long /*int*/ LoadLibraryW (char [] lpLibFileName);
 public static final native long /*int*/ LoadLibraryA (byte [] lpLibFileName);
 /** @param hMem cast=(HLOCAL) */
 public static final native long /*int*/ LocalFree (long /*int*/ hMem);
+/*
+ * Flushes pending GDI calls and returns the bits of a DIB section as a
+ * direct buffer, or null if hBitmap is not a DIB section.  The buffer is
+ * only valid for as long as the bitmap is and no GDI call draws into it.
+ */
+/** @method flags=no_gen */
+public static final native java.nio.ByteBuffer LockDIBits (long /*int*/ hBitmap);
 /** @param hWndLock cast=(HWND) */
 public static final native boolean LockWindowUpdate (long /*int*/ hWndLock);
 public static final native int LODWORD (long l);
@@ -5218,6 +5493,13 @@ public static final native int MessageBoxA (long /*int*/ hWnd, byte [] lpText, b
 public static final native boolean ModifyWorldTransform(long /*int*/ hdc, float [] lpXform, int iMode);
 /** @method flags=dynamic */
 public static final native long /*int*/ MonitorFromWindow (long /*int*/ hwnd, int dwFlags);
+/*
+ * Copies the rows of the uncompressed packed DIB of size bytes at
+ * packedDIB into bits top down.  Returns false when the DIB is
+ * compressed, truncated or does not fit into bits.
+ */
+/** @method flags=no_gen */
+public static final native boolean MoveDIBBits (byte[] bits, long /*int*/ packedDIB, int size);
 /**
  * @param Destination cast=(PVOID),flags=no_in critical
  * @param SourcePtr cast=(CONST VOID *)
@@ -5747,6 +6029,8 @@ public static final native int MultiByteToWideChar (int CodePage, int dwFlags, b
  * @param lpWideCharStr cast=(LPWSTR),flags=no_in critical
  */
 public static final native int MultiByteToWideChar (int CodePage, int dwFlags, long /*int*/ lpMultiByteStr, int cchMultiByte, char [] lpWideCharStr, int cchWideChar);
+/** @method flags=no_gen */
+public static final native java.nio.ByteBuffer NewDirectByteBuffer (long /*int*/ address, int capacity);
 /**
  * @method flags=dynamic
  * @param event cast=(DWORD)
@@ -5813,6 +6097,14 @@ public static final native boolean PostThreadMessageW (int idThread, int Msg, lo
  * @param lParam cast=(LPARAM)
  */
 public static final native boolean PostThreadMessageA (int idThread, int Msg, long /*int*/ wParam, long /*int*/ lParam);
+/*
+ * Posts WM_NULL to the queue of the thread unless a wake posted before is
+ * still pending, so that any number of wakes queue a single message.  The
+ * wake is pending until the message is removed by PumpMessageW or until
+ * ClearWakeMessage is called on the thread.
+ */
+/** @method flags=no_gen */
+public static final native boolean PostWakeMessage (int idThread);
 public static final native short PRIMARYLANGID (int lgid);
 /** @param lppd cast=(LPPRINTDLGW) */
 public static final native boolean PrintDlgW (PRINTDLG lppd);
@@ -5832,6 +6124,17 @@ public static final native int PSPropertyKeyFromString (char[] pszString, PROPER
 public static final native boolean PtInRect (RECT rect, POINT pt);
 /** @param hrgn cast=(HRGN) */
 public static final native boolean PtInRegion (long /*int*/ hrgn, int X, int Y);
+/*
+ * Removes the next message from the queue of the calling thread with
+ * PeekMessageW.  The PUMP_* filter flags drop messages for windows that
+ * have been destroyed, replace a WM_MOUSEMOVE by the latest one queued
+ * for the same window and translate and dispatch every message that is
+ * not a keyboard message.  Returns PUMP_NONE when the queue is empty,
+ * PUMP_HANDLED when the message was consumed and PUMP_MESSAGE when it
+ * was stored in lpMsg to be handled by the caller.
+ */
+/** @method flags=no_gen */
+public static final native int PumpMessageW (MSG lpMsg, int wFilterFlags);
 /** @param hDC cast=(HDC) */
 public static final native int RealizePalette (long /*int*/ hDC);
 /** @param hdc cast=(HDC) */
@@ -6001,6 +6304,18 @@ public static final native int RegSetValueExA (long /*int*/ hKey, byte[] lpValue
  * @param lpcbData cast=(LPDWORD)
  */
 public static final native int RegQueryValueExA (long /*int*/ hKey, byte[] lpValueName, long /*int*/ lpReserved, int[] lpType, int [] lpData, int[] lpcbData);
+/*
+ * Releases a font answered by CreateFontCached, deleting it when it is
+ * no longer used.  Returns false when hFont is not a cached font.
+ */
+/** @method flags=no_gen */
+public static final native boolean ReleaseCachedFont (long /*int*/ hFont);
+/*
+ * Frees the back buffer cached for hWnd, or every buffer cached by the
+ * calling thread when hWnd is 0.
+ */
+/** @method flags=no_gen */
+public static final native void ReleaseCachedPaint (long /*int*/ hWnd);
 public static final native boolean ReleaseCapture ();
 /**
  * @param hWnd cast=(HWND)
@@ -6654,6 +6969,15 @@ public static final native boolean SetLayeredWindowAttributes(long /*int*/ hwnd,
  * @param dwLayout cast=(DWORD)
  */
 public static final native int SetLayout (long /*int*/ hdc, int dwLayout);
+/*
+ * Stores count columns of row iItem in the list view cache of hWnd and
+ * attaches the cache to the current parent of hWnd.  The text of column
+ * i starts at offsets [2*i] in chars and is offsets [2*i+1] long, and
+ * its image index is images [i].  A length or an image of LVCACHE_NONE
+ * leaves the field unchanged and LVCACHE_UNKNOWN is answered by Java.
+ */
+/** @method flags=no_gen */
+public static final native void SetListViewCacheItem (long /*int*/ hWnd, int iItem, char [] chars, int [] offsets, int [] images, int count);
 /** @param hdc cast=(HDC) */
 public static final native int SetMapMode (long /*int*/ hdc, int fnMapMode);
 /**
@@ -6766,6 +7090,12 @@ public static final native boolean SetWindowPos(long /*int*/ hWnd, long /*int*/
  * @param hRgn cast=(HRGN)
  */
 public static final native int SetWindowRgn (long /*int*/ hWnd, long /*int*/ hRgn, boolean bRedraw);
+/*
+ * Sets the text of a window to the characters of string, copied once
+ * into null terminated native memory without an intermediate char array.
+ */
+/** @method flags=no_gen */
+public static final native boolean SetWindowTextString (long /*int*/ hWnd, String string);
 /**
  * @param hWnd cast=(HWND)
  * @param lpString cast=(LPWSTR)
@@ -6954,6 +7284,13 @@ public static final native boolean UnregisterClassW (char [] lpClassName, long /
  * @param hInstance cast=(HINSTANCE)
  */
 public static final native boolean UnregisterClassA (byte [] lpClassName, long /*int*/ hInstance);
+/*
+ * Presents the rectangle of the surface that changed in the layered
+ * window hwnd, which must not have layered attributes.  The pixels of
+ * the rectangle that are crKey are made transparent and the others opaque.
+ */
+/** @method flags=no_gen */
+public static final native boolean UpdateLayeredSurface (long /*int*/ hwnd, long /*int*/ surface, int x, int y, int width, int height, int crKey);
 /**
  * @method flags=dynamic
  * @param hwnd cast=(HWND)
@@ -7048,6 +7385,9 @@ public static final native int WideCharToMultiByte (int CodePage, int dwFlags, c
 public static final native long /*int*/ WindowFromDC (long /*int*/ hDC);
 /** @param lpPoint flags=struct */
 public static final native long /*int*/ WindowFromPoint (POINT lpPoint);
+/* resolves the field IDs of the preload structs */
+/** @method flags=no_gen */
+public static final native void cacheStructFields ();
 /** @param string cast=(const wchar_t *) */
 public static final native int wcslen (long /*int*/ string);
 
@@ -16,5 +16,5 @@ public abstract class OSVERSIONINFO {
 	public int dwMinorVersion;
 	public int dwBuildNumber;
 	public int dwPlatformId;
-	public static /*final*/ int sizeof = OS.IsUnicode ? OS.OSVERSIONINFOW_sizeof () : OS.OSVERSIONINFOA_sizeof ();
+	public static /*final*/ int sizeof = OS.IsUnicode ? OS.sizeof ("OSVERSIONINFOW") : OS.sizeof ("OSVERSIONINFOA");
 }
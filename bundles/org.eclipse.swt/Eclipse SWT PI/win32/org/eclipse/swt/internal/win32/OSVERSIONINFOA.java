@@ -12,5 +12,5 @@ package org.eclipse.swt.internal.win32;
 
 public class OSVERSIONINFOA extends OSVERSIONINFO {
 	public byte[] szCSDVersion = new byte[128];
-	public static final int sizeof = OS.OSVERSIONINFOA_sizeof ();
+	public static final int sizeof = OS.sizeof ("OSVERSIONINFOA");
 }
@@ -16,5 +16,5 @@ public abstract class OSVERSIONINFOEX extends OSVERSIONINFO {
 	public short wSuiteMask;
 	public byte wProductType;
 	public byte wReserved;
-	public static /*final*/ int sizeof = OS.IsUnicode ? OS.OSVERSIONINFOEXW_sizeof () : OS.OSVERSIONINFOEXA_sizeof ();
+	public static /*final*/ int sizeof = OS.IsUnicode ? OS.sizeof ("OSVERSIONINFOEXW") : OS.sizeof ("OSVERSIONINFOEXA");
 }
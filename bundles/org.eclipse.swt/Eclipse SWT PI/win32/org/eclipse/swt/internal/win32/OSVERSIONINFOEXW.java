@@ -12,5 +12,5 @@ package org.eclipse.swt.internal.win32;
 
 public class OSVERSIONINFOEXW extends OSVERSIONINFOEX {
 	public char[] szCSDVersion = new char[128];
-	public static final int sizeof = OS.OSVERSIONINFOEXW_sizeof ();
+	public static final int sizeof = OS.sizeof ("OSVERSIONINFOEXW");
 }
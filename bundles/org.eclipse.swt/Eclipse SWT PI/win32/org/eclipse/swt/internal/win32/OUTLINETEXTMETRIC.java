@@ -65,5 +65,5 @@ public class OUTLINETEXTMETRIC {
 	public long /*int*/ otmpStyleName;
     /** @field cast=(PSTR) */
 	public long /*int*/ otmpFullName;
-    public static final int sizeof = OS.IsUnicode ? OS.OUTLINETEXTMETRICW_sizeof ():  OS.OUTLINETEXTMETRICA_sizeof ();
+    public static final int sizeof = OS.IsUnicode ? OS.sizeof ("OUTLINETEXTMETRICW"):  OS.sizeof ("OUTLINETEXTMETRICA");
 }
@@ -12,5 +12,5 @@ package org.eclipse.swt.internal.win32;
 
 public class OUTLINETEXTMETRICA extends OUTLINETEXTMETRIC {
 	public TEXTMETRICA otmTextMetrics = new TEXTMETRICA ();
-	public static final int sizeof = OS.OUTLINETEXTMETRICA_sizeof ();
+	public static final int sizeof = OS.sizeof ("OUTLINETEXTMETRICA");
 }
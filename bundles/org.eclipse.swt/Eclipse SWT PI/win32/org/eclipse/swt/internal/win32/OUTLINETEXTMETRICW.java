@@ -12,5 +12,5 @@ package org.eclipse.swt.internal.win32;
 
 public class OUTLINETEXTMETRICW extends OUTLINETEXTMETRIC {
 	public TEXTMETRICW otmTextMetrics = new TEXTMETRICW ();
-	public static final int sizeof = OS.OUTLINETEXTMETRICW_sizeof ();
+	public static final int sizeof = OS.sizeof ("OUTLINETEXTMETRICW");
 }
@@ -26,5 +26,5 @@ public class PAINTSTRUCT {
 	public boolean fRestore; 
 	public boolean fIncUpdate; 
 	public byte[] rgbReserved = new byte[32];
-	public static final int sizeof = OS.PAINTSTRUCT_sizeof ();
+	public static final int sizeof = OS.sizeof ("PAINTSTRUCT");
 }
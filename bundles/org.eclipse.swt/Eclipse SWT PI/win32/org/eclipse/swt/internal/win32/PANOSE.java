@@ -21,5 +21,5 @@ public class PANOSE {
 	public byte bLetterform;
 	public byte bMidline;
 	public byte bXHeight; 
-	public static final int sizeof = OS.PANOSE_sizeof ();
+	public static final int sizeof = OS.sizeof ("PANOSE");
 }
@@ -10,8 +10,11 @@
  *******************************************************************************/
 package org.eclipse.swt.internal.win32;
 
+/**
+ * @jniclass flags=preload
+ */
 public class POINT {
 	public int x;
 	public int y;
-	public static final int sizeof = OS.POINT_sizeof ();
+	public static final int sizeof = OS.sizeof ("POINT");
 }
@@ -41,5 +41,5 @@ public class PRINTDLG {
 	public long /*int*/ hPrintTemplate; // HGLOBAL
 	/** @field cast=(HGLOBAL) */
 	public long /*int*/ hSetupTemplate; // HGLOBAL
-	public static final int sizeof = OS.PRINTDLG_sizeof ();
+	public static final int sizeof = OS.sizeof ("PRINTDLG");
 }
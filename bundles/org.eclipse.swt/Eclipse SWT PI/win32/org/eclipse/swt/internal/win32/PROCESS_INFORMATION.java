@@ -17,5 +17,5 @@ public class PROCESS_INFORMATION {
 	public long /*int*/ hThread;
 	public int dwProcessId;
 	public int dwThreadId;
-	public static int sizeof = OS.PROCESS_INFORMATION_sizeof ();
+	public static int sizeof = OS.sizeof ("PROCESS_INFORMATION");
 }
@@ -14,5 +14,5 @@ public class PROPERTYKEY {
 	/** @field flags=struct */
 	public byte [] fmtid = new byte [16];
 	public int pid;
-	public static final int sizeof = OS.PROPERTYKEY_sizeof ();
+	public static final int sizeof = OS.sizeof ("PROPERTYKEY");
 }
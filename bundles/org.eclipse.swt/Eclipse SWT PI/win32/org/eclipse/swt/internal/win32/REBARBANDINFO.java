@@ -36,5 +36,5 @@ public class REBARBANDINFO {
 	/** @field flags=no_wince */
 	public int cxHeader;
 	/* Note in WinCE.  The field cxHeader is not defined. */ 
-	public static final int sizeof = OS.REBARBANDINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("REBARBANDINFO");
 }
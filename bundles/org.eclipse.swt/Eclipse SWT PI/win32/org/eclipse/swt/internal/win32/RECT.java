@@ -10,10 +10,13 @@
  *******************************************************************************/
 package org.eclipse.swt.internal.win32;
 
+/**
+ * @jniclass flags=preload
+ */
 public class RECT {
 	public int left;
 	public int top;
 	public int right;
 	public int bottom;
-	public static final int sizeof = OS.RECT_sizeof ();
+	public static final int sizeof = OS.sizeof ("RECT");
 }
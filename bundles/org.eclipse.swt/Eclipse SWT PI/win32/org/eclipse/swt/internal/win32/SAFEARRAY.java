@@ -20,5 +20,5 @@ public class SAFEARRAY {
 	/** @field accessor=rgsabound[0] */
 	public SAFEARRAYBOUND rgsabound;
 
-	public static final int sizeof = OS.SAFEARRAY_sizeof ();
+	public static final int sizeof = OS.sizeof ("SAFEARRAY");
 }
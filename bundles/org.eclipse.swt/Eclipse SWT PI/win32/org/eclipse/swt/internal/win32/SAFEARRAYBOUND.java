@@ -13,5 +13,5 @@ package org.eclipse.swt.internal.win32;
 public class SAFEARRAYBOUND {
 	public int cElements;
 	public int lLbound;
-	public static final int sizeof = OS.SAFEARRAYBOUND_sizeof ();
+	public static final int sizeof = OS.sizeof ("SAFEARRAYBOUND");
 }
@@ -21,5 +21,5 @@ public class SCRIPT_CONTROL {
 	public boolean fNumericOverride;
 	public boolean fLegacyBidiClass;
 	public int fReserved;
-	public static final int sizeof = OS.SCRIPT_CONTROL_sizeof ();
+	public static final int sizeof = OS.sizeof ("SCRIPT_CONTROL");
 }
@@ -17,5 +17,5 @@ public class SCRIPT_FONTPROPERTIES {
 	public short wgInvalid;
 	public short wgKashida; 
 	public int iKashidaWidth;
-	public static final int sizeof = OS.SCRIPT_FONTPROPERTIES_sizeof ();
+	public static final int sizeof = OS.sizeof ("SCRIPT_FONTPROPERTIES");
 }
@@ -13,5 +13,5 @@ package org.eclipse.swt.internal.win32;
 public class SCRIPT_ITEM {
 	public int iCharPos;
 	public SCRIPT_ANALYSIS a = new SCRIPT_ANALYSIS(); 
-	public static final int sizeof = OS.SCRIPT_ITEM_sizeof ();
+	public static final int sizeof = OS.sizeof ("SCRIPT_ITEM");
 }
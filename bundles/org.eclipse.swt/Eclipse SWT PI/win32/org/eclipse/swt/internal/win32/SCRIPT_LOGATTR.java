@@ -17,5 +17,5 @@ public class SCRIPT_LOGATTR {
 	public boolean fWordStop; 
 	public boolean fInvalid; 
 	public byte fReserved;	
-	public static final int sizeof = OS.SCRIPT_LOGATTR_sizeof ();
+	public static final int sizeof = OS.sizeof ("SCRIPT_LOGATTR");
 }
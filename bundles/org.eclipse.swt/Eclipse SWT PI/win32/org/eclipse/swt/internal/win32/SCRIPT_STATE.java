@@ -22,5 +22,5 @@ public class SCRIPT_STATE {
 	public boolean fGcpClusters; 
 	public boolean fReserved; 
 	public short fEngineReserved;
-	public static final int sizeof = OS.SCRIPT_STATE_sizeof ();
+	public static final int sizeof = OS.sizeof ("SCRIPT_STATE");
 }
@@ -18,5 +18,5 @@ public class SCROLLBARINFO {
 	public int xyThumbBottom;
 	public int reserved;
 	public int [] rgstate = new int [OS.CCHILDREN_SCROLLBAR + 1];
-	public static final int sizeof = OS.SCROLLBARINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("SCROLLBARINFO");
 }
@@ -18,5 +18,5 @@ public class SHACTIVATEINFO {
 	public int fSipOnDeactivation; // :1
 	public int fActive; // :1
 	public int fReserved; // :29
-	public static final int sizeof = OS.SHACTIVATEINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("SHACTIVATEINFO");
 }
@@ -16,5 +16,5 @@ public final class SHDRAGIMAGE {
 	/** @field cast=(HBITMAP) */
 	public long /*int*/ hbmpDragImage;
 	public int crColorKey;
-	public static final int sizeof = OS.SHDRAGIMAGE_sizeof ();
+	public static final int sizeof = OS.sizeof ("SHDRAGIMAGE");
 }
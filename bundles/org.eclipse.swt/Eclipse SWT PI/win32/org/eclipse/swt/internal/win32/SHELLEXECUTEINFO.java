@@ -42,6 +42,6 @@ public class SHELLEXECUTEINFO {
 	public long /*int*/ hIcon;
 	/** @field cast=(HANDLE) */
 	public long /*int*/ hProcess; 
-	public static final int sizeof = OS.SHELLEXECUTEINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("SHELLEXECUTEINFO");
 }
 
@@ -15,5 +15,5 @@ public class SHFILEINFO {
 	public long /*int*/ hIcon;
 	public int iIcon;
 	public int dwAttributes;
-	public static int sizeof = OS.IsUnicode ? OS.SHFILEINFOW_sizeof ():  OS.SHFILEINFOA_sizeof ();
+	public static int sizeof = OS.IsUnicode ? OS.sizeof ("SHFILEINFOW"):  OS.sizeof ("SHFILEINFOA");
 }
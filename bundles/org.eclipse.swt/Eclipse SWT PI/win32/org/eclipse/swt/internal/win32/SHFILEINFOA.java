@@ -13,5 +13,5 @@ package org.eclipse.swt.internal.win32;
 public class SHFILEINFOA extends SHFILEINFO {
 	public byte [] szDisplayName = new byte [OS.MAX_PATH];
 	public byte [] szTypeName = new byte [80];
-	public static int sizeof = OS.SHFILEINFOA_sizeof ();
+	public static int sizeof = OS.sizeof ("SHFILEINFOA");
 }
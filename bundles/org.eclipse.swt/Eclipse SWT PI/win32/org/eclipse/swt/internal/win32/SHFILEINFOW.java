@@ -13,5 +13,5 @@ package org.eclipse.swt.internal.win32;
 public class SHFILEINFOW extends SHFILEINFO {
 	public char [] szDisplayName = new char [OS.MAX_PATH];
 	public char [] szTypeName = new char [80];
-	public static int sizeof = OS.SHFILEINFOW_sizeof ();
+	public static int sizeof = OS.sizeof ("SHFILEINFOW");
 }
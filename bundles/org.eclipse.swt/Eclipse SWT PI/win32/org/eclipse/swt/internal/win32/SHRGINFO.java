@@ -20,5 +20,5 @@ public class SHRGINFO {
 	/** @field accessor=ptDown.y */
 	public int ptDown_y;
 	public int dwFlags;
-	public static final int sizeof = OS.SHRGINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("SHRGINFO");
 }
@@ -34,5 +34,5 @@ public class SIPINFO {
 	public int dwImDataSize;
 	/** @field cast=(void *) */
 	public long /*int*/ pvImData;
-	public static final int sizeof = OS.SIPINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("SIPINFO");
 }
@@ -36,5 +36,5 @@ public class STARTUPINFO {
 	public long /*int*/ hStdOutput;
 	/** @field cast=(HANDLE) */
 	public long /*int*/ hStdError;
-	public static int sizeof = OS.STARTUPINFO_sizeof ();
+	public static int sizeof = OS.sizeof ("STARTUPINFO");
 }
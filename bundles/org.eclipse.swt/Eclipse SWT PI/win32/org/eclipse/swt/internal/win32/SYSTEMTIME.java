@@ -19,5 +19,5 @@ public class SYSTEMTIME {
 	public short wMinute;
 	public short wSecond;
 	public short wMilliseconds;
-	public static final int sizeof = OS.SYSTEMTIME_sizeof ();
+	public static final int sizeof = OS.sizeof ("SYSTEMTIME");
 }
\ No newline at end of file
@@ -17,5 +17,5 @@ public class TBBUTTON {
 	public byte fsStyle;
 	public long /*int*/ dwData;
 	public long /*int*/ iString;
-	public static final int sizeof = OS.TBBUTTON_sizeof ();
+	public static final int sizeof = OS.sizeof ("TBBUTTON");
 }
@@ -22,5 +22,5 @@ public class TBBUTTONINFO {
 	/** @field cast=(LPTSTR) */
 	public long /*int*/ pszText;
 	public int cchText;
-	public static final int sizeof = OS.TBBUTTONINFO_sizeof ();
+	public static final int sizeof = OS.sizeof ("TBBUTTONINFO");
 }
@@ -17,5 +17,5 @@ public class TCHITTESTINFO {
 	/** @field accessor=pt.y */
 	public int y;
 	public int flags;
-	public static int sizeof = OS.TCHITTESTINFO_sizeof ();
+	public static int sizeof = OS.sizeof ("TCHITTESTINFO");
 }
@@ -19,5 +19,5 @@ public class TCITEM {
 	public int cchTextMax;
 	public int iImage;
 	public long /*int*/ lParam;
-	public static final int sizeof = OS.TCITEM_sizeof ();
+	public static final int sizeof = OS.sizeof ("TCITEM");
 }
@@ -15,5 +15,5 @@ public class TEXTMETRICA extends TEXTMETRIC {
 	public byte tmLastChar;
 	public byte tmDefaultChar; 
 	public byte tmBreakChar;
-	public static final int sizeof = OS.TEXTMETRICA_sizeof ();
+	public static final int sizeof = OS.sizeof ("TEXTMETRICA");
 }
@@ -13,5 +13,5 @@ package org.eclipse.swt.internal.win32;
 public class TF_DA_COLOR {
 	public int type;
 	public int cr;
-	public static final int sizeof = OS.TF_DA_COLOR_sizeof ();
+	public static final int sizeof = OS.sizeof ("TF_DA_COLOR");
 }
@@ -17,5 +17,5 @@ public class TF_DISPLAYATTRIBUTE {
 	public boolean fBoldLine;
 	public TF_DA_COLOR crLine = new TF_DA_COLOR();
 	public int bAttr;
-	public static final int sizeof = OS.TF_DISPLAYATTRIBUTE_sizeof ();
+	public static final int sizeof = OS.sizeof ("TF_DISPLAYATTRIBUTE");
 }
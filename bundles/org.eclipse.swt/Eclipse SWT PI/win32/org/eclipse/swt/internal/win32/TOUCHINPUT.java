@@ -22,5 +22,5 @@ public class TOUCHINPUT {
 	public long /*int*/ dwExtraInfo;
 	public int cxContact;
 	public int cyContact;
-	public static final int sizeof = OS.TOUCHINPUT_sizeof();
+	public static final int sizeof = OS.sizeof ("TOUCHINPUT");
 }
@@ -16,5 +16,5 @@ public class TRACKMOUSEEVENT {
 	/** @field cast=(HWND) */
 	public long /*int*/ hwndTrack;
 	public int dwHoverTime;
-	public static final int sizeof = OS.TRACKMOUSEEVENT_sizeof ();
+	public static final int sizeof = OS.sizeof ("TRACKMOUSEEVENT");
 }
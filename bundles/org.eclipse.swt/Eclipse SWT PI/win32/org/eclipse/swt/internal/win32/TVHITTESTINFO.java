@@ -19,5 +19,5 @@ public class TVHITTESTINFO {
 	public int flags;
 	/** @field cast=(HTREEITEM) */
 	public long /*int*/ hItem;
-	public static int sizeof = OS.TVHITTESTINFO_sizeof ();
+	public static int sizeof = OS.sizeof ("TVHITTESTINFO");
 }
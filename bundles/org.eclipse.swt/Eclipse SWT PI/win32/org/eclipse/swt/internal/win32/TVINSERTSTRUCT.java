@@ -38,5 +38,5 @@ public class TVINSERTSTRUCT {
 	public long /*int*/ lParam;
 	/** @field accessor=itemex.iIntegral,flags=no_wince */
 	public int iIntegral;
-	public static final int sizeof = OS.TVINSERTSTRUCT_sizeof ();
+	public static final int sizeof = OS.sizeof ("TVINSERTSTRUCT");
 }
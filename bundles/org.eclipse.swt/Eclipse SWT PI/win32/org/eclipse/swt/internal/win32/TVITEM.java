@@ -23,5 +23,5 @@ public class TVITEM {
   	public int iSelectedImage;
 	public int cChildren;
 	public long /*int*/ lParam;
-	public static final int sizeof = OS.TVITEM_sizeof ();
+	public static final int sizeof = OS.sizeof ("TVITEM");
 }
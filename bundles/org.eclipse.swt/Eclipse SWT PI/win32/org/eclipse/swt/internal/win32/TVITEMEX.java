@@ -12,5 +12,5 @@ package org.eclipse.swt.internal.win32;
 
 public class TVITEMEX extends TVITEM {
 	public int iIntegral;
-	public static final int sizeof = OS.TVITEMEX_sizeof ();
+	public static final int sizeof = OS.sizeof ("TVITEMEX");
 }
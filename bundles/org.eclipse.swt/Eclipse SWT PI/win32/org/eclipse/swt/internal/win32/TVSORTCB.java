@@ -17,5 +17,5 @@ public class TVSORTCB {
 	public long /*int*/ lpfnCompare;
 	/** @field cast=(LPARAM) */
 	public long /*int*/ lParam;
-	public static final int sizeof = OS.TVSORTCB_sizeof ();
+	public static final int sizeof = OS.sizeof ("TVSORTCB");
 }
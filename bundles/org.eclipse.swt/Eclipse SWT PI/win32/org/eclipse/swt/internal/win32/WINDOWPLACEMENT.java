@@ -33,5 +33,5 @@ public class WINDOWPLACEMENT {
 	public int right;
 	/** @field accessor=rcNormalPosition.bottom */
 	public int bottom;
-	public static final int sizeof = OS.WINDOWPLACEMENT_sizeof ();
+	public static final int sizeof = OS.sizeof ("WINDOWPLACEMENT");
 }
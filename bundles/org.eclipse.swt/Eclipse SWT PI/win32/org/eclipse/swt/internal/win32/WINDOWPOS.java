@@ -20,5 +20,5 @@ public class WINDOWPOS {
 	public int cx;
 	public int cy;
 	public int flags;  
-	public static final int sizeof = OS.WINDOWPOS_sizeof ();
+	public static final int sizeof = OS.sizeof ("WINDOWPOS");
 }
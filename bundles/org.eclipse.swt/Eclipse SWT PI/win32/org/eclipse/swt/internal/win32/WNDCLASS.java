@@ -28,5 +28,5 @@ public class WNDCLASS {
 	public long /*int*/ lpszMenuName; 
 	/** @field cast=(LPCTSTR) */
 	public long /*int*/ lpszClassName; 
-	public static final int sizeof = OS.WNDCLASS_sizeof ();
+	public static final int sizeof = OS.sizeof ("WNDCLASS");
 }
@@ -24,7 +24,7 @@ JNIEXPORT jchar JNICALL OS_NATIVE(AccessText_1AccessKey)
 {
 	jchar rc = 0;
 	OS_NATIVE_ENTER(env, that, AccessText_1AccessKey_FUNC);
-	rc = (jchar)((AccessText^)TO_OBJECT(arg0))->AccessKey;
+	rc = (jchar)(TO_OBJECT_AS(AccessText^, arg0))->AccessKey;
 	OS_NATIVE_EXIT(env, that, AccessText_1AccessKey_FUNC);
 	return rc;
 }
@@ -36,7 +36,7 @@ JNIEXPORT void JNICALL OS_NATIVE(AccessText_1Text)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, AccessText_1Text_FUNC);
-	((AccessText^)TO_OBJECT(arg0))->Text = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(AccessText^, arg0))->Text = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, AccessText_1Text_FUNC);
 }
 #endif
@@ -47,7 +47,7 @@ JNIEXPORT void JNICALL OS_NATIVE(AccessText_1TextWrapping)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, AccessText_1TextWrapping_FUNC);
-	((AccessText^)TO_OBJECT(arg0))->TextWrapping = ((TextWrapping)arg1);
+	(TO_OBJECT_AS(AccessText^, arg0))->TextWrapping = ((TextWrapping)arg1);
 	OS_NATIVE_EXIT(env, that, AccessText_1TextWrapping_FUNC);
 }
 #endif
@@ -124,7 +124,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Application_1Dispatcher)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Application_1Dispatcher_FUNC);
-	rc = (jint)TO_HANDLE(((Application ^)TO_OBJECT(arg0))->Dispatcher);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Application ^, arg0))->Dispatcher);
 	OS_NATIVE_EXIT(env, that, Application_1Dispatcher_FUNC);
 	return rc;
 }
@@ -137,7 +137,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Application_1Resources__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Application_1Resources__I_FUNC);
-	rc = (jint)TO_HANDLE(((Application^)TO_OBJECT(arg0))->Resources);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Application^, arg0))->Resources);
 	OS_NATIVE_EXIT(env, that, Application_1Resources__I_FUNC);
 	return rc;
 }
@@ -149,7 +149,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Application_1Resources__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Application_1Resources__II_FUNC);
-	((Application^)TO_OBJECT(arg0))->Resources = ((ResourceDictionary^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Application^, arg0))->Resources = ((ResourceDictionary^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Application_1Resources__II_FUNC);
 }
 #endif
@@ -160,7 +160,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Application_1Run)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, Application_1Run_FUNC);
-	((Application^)TO_OBJECT(arg0))->Run();
+	(TO_OBJECT_AS(Application^, arg0))->Run();
 	OS_NATIVE_EXIT(env, that, Application_1Run_FUNC);
 }
 #endif
@@ -171,7 +171,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Application_1Shutdown)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, Application_1Shutdown_FUNC);
-	((Application^)TO_OBJECT(arg0))->Shutdown();
+	(TO_OBJECT_AS(Application^, arg0))->Shutdown();
 	OS_NATIVE_EXIT(env, that, Application_1Shutdown_FUNC);
 }
 #endif
@@ -182,7 +182,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Application_1ShutdownMode)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Application_1ShutdownMode_FUNC);
-	((Application^)TO_OBJECT(arg0))->ShutdownMode = ((ShutdownMode)arg1);
+	(TO_OBJECT_AS(Application^, arg0))->ShutdownMode = ((ShutdownMode)arg1);
 	OS_NATIVE_EXIT(env, that, Application_1ShutdownMode_FUNC);
 }
 #endif
@@ -194,7 +194,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Application_1Windows)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Application_1Windows_FUNC);
-	rc = (jint)TO_HANDLE(((Application^)TO_OBJECT(arg0))->Windows);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Application^, arg0))->Windows);
 	OS_NATIVE_EXIT(env, that, Application_1Windows_FUNC);
 	return rc;
 }
@@ -206,7 +206,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ArrayList_1Clear)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, ArrayList_1Clear_FUNC);
-	((ArrayList^)TO_OBJECT(arg0))->Clear();
+	(TO_OBJECT_AS(ArrayList^, arg0))->Clear();
 	OS_NATIVE_EXIT(env, that, ArrayList_1Clear_FUNC);
 }
 #endif
@@ -218,7 +218,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ArrayList_1Count)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ArrayList_1Count_FUNC);
-	rc = (jint)((ArrayList^)TO_OBJECT(arg0))->Count;
+	rc = (jint)(TO_OBJECT_AS(ArrayList^, arg0))->Count;
 	OS_NATIVE_EXIT(env, that, ArrayList_1Count_FUNC);
 	return rc;
 }
@@ -230,7 +230,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ArrayList_1Insert)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, ArrayList_1Insert_FUNC);
-	((ArrayList^)TO_OBJECT(arg0))->Insert(arg1, (Object^)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(ArrayList^, arg0))->Insert(arg1, (Object^)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, ArrayList_1Insert_FUNC);
 }
 #endif
@@ -241,7 +241,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ArrayList_1RemoveAt)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ArrayList_1RemoveAt_FUNC);
-	((ArrayList^)TO_OBJECT(arg0))->RemoveAt(arg1);
+	(TO_OBJECT_AS(ArrayList^, arg0))->RemoveAt(arg1);
 	OS_NATIVE_EXIT(env, that, ArrayList_1RemoveAt_FUNC);
 }
 #endif
@@ -253,7 +253,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ArrayList_1ToArray)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ArrayList_1ToArray_FUNC);
-	rc = (jint)TO_HANDLE(((ArrayList^)TO_OBJECT(arg0))->ToArray());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(ArrayList^, arg0))->ToArray());
 	OS_NATIVE_EXIT(env, that, ArrayList_1ToArray_FUNC);
 	return rc;
 }
@@ -266,7 +266,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ArrayList_1default__II)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ArrayList_1default__II_FUNC);
-	rc = (jint)TO_HANDLE(((ArrayList^)TO_OBJECT(arg0))->default[arg1]);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(ArrayList^, arg0))->default[arg1]);
 	OS_NATIVE_EXIT(env, that, ArrayList_1default__II_FUNC);
 	return rc;
 }
@@ -278,7 +278,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ArrayList_1default__III)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, ArrayList_1default__III_FUNC);
-	((ArrayList^)TO_OBJECT(arg0))->default[arg1] = ((Object^)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(ArrayList^, arg0))->default[arg1] = ((Object^)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, ArrayList_1default__III_FUNC);
 }
 #endif
@@ -303,7 +303,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Array_1GetLength)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Array_1GetLength_FUNC);
-	rc = (jint)((Array^)TO_OBJECT(arg0))->GetLength(arg1);
+	rc = (jint)(TO_OBJECT_AS(Array^, arg0))->GetLength(arg1);
 	OS_NATIVE_EXIT(env, that, Array_1GetLength_FUNC);
 	return rc;
 }
@@ -316,7 +316,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Array_1GetValue)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Array_1GetValue_FUNC);
-	rc = (jint)TO_HANDLE(((Array^)TO_OBJECT(arg0))->GetValue(arg1));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Array^, arg0))->GetValue(arg1));
 	OS_NATIVE_EXIT(env, that, Array_1GetValue_FUNC);
 	return rc;
 }
@@ -328,7 +328,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Array_1SetValue)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, Array_1SetValue_FUNC);
-	((Array^)TO_OBJECT(arg0))->SetValue((Object^)TO_OBJECT(arg1), arg2);
+	(TO_OBJECT_AS(Array^, arg0))->SetValue((Object^)TO_OBJECT(arg1), arg2);
 	OS_NATIVE_EXIT(env, that, Array_1SetValue_FUNC);
 }
 #endif
@@ -340,7 +340,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(BevelBitmapEffect_1BevelWidth__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, BevelBitmapEffect_1BevelWidth__I_FUNC);
-	rc = (jdouble)((BevelBitmapEffect^)TO_OBJECT(arg0))->BevelWidth;
+	rc = (jdouble)(TO_OBJECT_AS(BevelBitmapEffect^, arg0))->BevelWidth;
 	OS_NATIVE_EXIT(env, that, BevelBitmapEffect_1BevelWidth__I_FUNC);
 	return rc;
 }
@@ -352,7 +352,7 @@ JNIEXPORT void JNICALL OS_NATIVE(BevelBitmapEffect_1BevelWidth__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, BevelBitmapEffect_1BevelWidth__ID_FUNC);
-	((BevelBitmapEffect^)TO_OBJECT(arg0))->BevelWidth = (arg1);
+	(TO_OBJECT_AS(BevelBitmapEffect^, arg0))->BevelWidth = (arg1);
 	OS_NATIVE_EXIT(env, that, BevelBitmapEffect_1BevelWidth__ID_FUNC);
 }
 #endif
@@ -364,7 +364,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(BevelBitmapEffect_1LightAngle__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, BevelBitmapEffect_1LightAngle__I_FUNC);
-	rc = (jdouble)((BevelBitmapEffect^)TO_OBJECT(arg0))->LightAngle;
+	rc = (jdouble)(TO_OBJECT_AS(BevelBitmapEffect^, arg0))->LightAngle;
 	OS_NATIVE_EXIT(env, that, BevelBitmapEffect_1LightAngle__I_FUNC);
 	return rc;
 }
@@ -376,7 +376,7 @@ JNIEXPORT void JNICALL OS_NATIVE(BevelBitmapEffect_1LightAngle__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, BevelBitmapEffect_1LightAngle__ID_FUNC);
-	((BevelBitmapEffect^)TO_OBJECT(arg0))->LightAngle = (arg1);
+	(TO_OBJECT_AS(BevelBitmapEffect^, arg0))->LightAngle = (arg1);
 	OS_NATIVE_EXIT(env, that, BevelBitmapEffect_1LightAngle__ID_FUNC);
 }
 #endif
@@ -388,7 +388,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(BevelBitmapEffect_1Smoothness__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, BevelBitmapEffect_1Smoothness__I_FUNC);
-	rc = (jdouble)((BevelBitmapEffect^)TO_OBJECT(arg0))->Smoothness;
+	rc = (jdouble)(TO_OBJECT_AS(BevelBitmapEffect^, arg0))->Smoothness;
 	OS_NATIVE_EXIT(env, that, BevelBitmapEffect_1Smoothness__I_FUNC);
 	return rc;
 }
@@ -400,7 +400,7 @@ JNIEXPORT void JNICALL OS_NATIVE(BevelBitmapEffect_1Smoothness__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, BevelBitmapEffect_1Smoothness__ID_FUNC);
-	((BevelBitmapEffect^)TO_OBJECT(arg0))->Smoothness = (arg1);
+	(TO_OBJECT_AS(BevelBitmapEffect^, arg0))->Smoothness = (arg1);
 	OS_NATIVE_EXIT(env, that, BevelBitmapEffect_1Smoothness__ID_FUNC);
 }
 #endif
@@ -411,7 +411,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Binding_1RelativeSource)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Binding_1RelativeSource_FUNC);
-	((Binding^)TO_OBJECT(arg0))->RelativeSource = ((RelativeSource^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Binding^, arg0))->RelativeSource = ((RelativeSource^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Binding_1RelativeSource_FUNC);
 }
 #endif
@@ -436,7 +436,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BitmapDecoder_1Frames)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, BitmapDecoder_1Frames_FUNC);
-	rc = (jint)TO_HANDLE(((BitmapDecoder^)TO_OBJECT(arg0))->Frames);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(BitmapDecoder^, arg0))->Frames);
 	OS_NATIVE_EXIT(env, that, BitmapDecoder_1Frames_FUNC);
 	return rc;
 }
@@ -449,7 +449,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BitmapEffectGroup_1Children)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, BitmapEffectGroup_1Children_FUNC);
-	rc = (jint)TO_HANDLE(((BitmapEffectGroup^)TO_OBJECT(arg0))->Children);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(BitmapEffectGroup^, arg0))->Children);
 	OS_NATIVE_EXIT(env, that, BitmapEffectGroup_1Children_FUNC);
 	return rc;
 }
@@ -462,7 +462,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BitmapEncoder_1Frames)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, BitmapEncoder_1Frames_FUNC);
-	rc = (jint)TO_HANDLE(((BitmapEncoder^)TO_OBJECT(arg0))->Frames);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(BitmapEncoder^, arg0))->Frames);
 	OS_NATIVE_EXIT(env, that, BitmapEncoder_1Frames_FUNC);
 	return rc;
 }
@@ -474,7 +474,7 @@ JNIEXPORT void JNICALL OS_NATIVE(BitmapEncoder_1Save)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, BitmapEncoder_1Save_FUNC);
-	((BitmapEncoder^)TO_OBJECT(arg0))->Save((System::IO::Stream^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(BitmapEncoder^, arg0))->Save((System::IO::Stream^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, BitmapEncoder_1Save_FUNC);
 }
 #endif
@@ -485,7 +485,7 @@ JNIEXPORT void JNICALL OS_NATIVE(BitmapFrameCollection_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, BitmapFrameCollection_1Add_FUNC);
-	((System::Collections::Generic::IList<BitmapFrame^>^)TO_OBJECT(arg0))->Add((BitmapFrame^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Collections::Generic::IList<BitmapFrame^>^, arg0))->Add((BitmapFrame^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, BitmapFrameCollection_1Add_FUNC);
 }
 #endif
@@ -497,7 +497,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BitmapFrameCollection_1default)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, BitmapFrameCollection_1default_FUNC);
-	rc = (jint)TO_HANDLE(((System::Collections::Generic::IList<BitmapFrame^>^)TO_OBJECT(arg0))->default[arg1]);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Collections::Generic::IList<BitmapFrame^>^, arg0))->default[arg1]);
 	OS_NATIVE_EXIT(env, that, BitmapFrameCollection_1default_FUNC);
 	return rc;
 }
@@ -522,7 +522,7 @@ JNIEXPORT void JNICALL OS_NATIVE(BitmapImage_1BeginInit)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, BitmapImage_1BeginInit_FUNC);
-	((BitmapImage^)TO_OBJECT(arg0))->BeginInit();
+	(TO_OBJECT_AS(BitmapImage^, arg0))->BeginInit();
 	OS_NATIVE_EXIT(env, that, BitmapImage_1BeginInit_FUNC);
 }
 #endif
@@ -533,7 +533,7 @@ JNIEXPORT void JNICALL OS_NATIVE(BitmapImage_1CreateOptions)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, BitmapImage_1CreateOptions_FUNC);
-	((BitmapImage^)TO_OBJECT(arg0))->CreateOptions = ((BitmapCreateOptions)arg1);
+	(TO_OBJECT_AS(BitmapImage^, arg0))->CreateOptions = ((BitmapCreateOptions)arg1);
 	OS_NATIVE_EXIT(env, that, BitmapImage_1CreateOptions_FUNC);
 }
 #endif
@@ -544,7 +544,7 @@ JNIEXPORT void JNICALL OS_NATIVE(BitmapImage_1EndInit)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, BitmapImage_1EndInit_FUNC);
-	((BitmapImage^)TO_OBJECT(arg0))->EndInit();
+	(TO_OBJECT_AS(BitmapImage^, arg0))->EndInit();
 	OS_NATIVE_EXIT(env, that, BitmapImage_1EndInit_FUNC);
 }
 #endif
@@ -555,7 +555,7 @@ JNIEXPORT void JNICALL OS_NATIVE(BitmapImage_1UriSource)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, BitmapImage_1UriSource_FUNC);
-	((BitmapImage^)TO_OBJECT(arg0))->UriSource = ((Uri^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(BitmapImage^, arg0))->UriSource = ((Uri^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, BitmapImage_1UriSource_FUNC);
 }
 #endif
@@ -567,7 +567,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BitmapPalette_1Colors)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, BitmapPalette_1Colors_FUNC);
-	rc = (jint)TO_HANDLE(((BitmapPalette^)TO_OBJECT(arg0))->Colors);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(BitmapPalette^, arg0))->Colors);
 	OS_NATIVE_EXIT(env, that, BitmapPalette_1Colors_FUNC);
 	return rc;
 }
@@ -580,7 +580,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BitmapSource_1Clone)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, BitmapSource_1Clone_FUNC);
-	rc = (jint)TO_HANDLE(((BitmapSource^)TO_OBJECT(arg0))->Clone());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(BitmapSource^, arg0))->Clone());
 	OS_NATIVE_EXIT(env, that, BitmapSource_1Clone_FUNC);
 	return rc;
 }
@@ -594,7 +594,7 @@ JNIEXPORT void JNICALL OS_NATIVE(BitmapSource_1CopyPixels)
 	jbyte *lparg2=NULL;
 	OS_NATIVE_ENTER(env, that, BitmapSource_1CopyPixels_FUNC);
 	if (arg2) if ((lparg2 = env->GetByteArrayElements(arg2, NULL)) == NULL) goto fail;
-	((BitmapSource^)TO_OBJECT(arg0))->CopyPixels((Int32Rect)TO_OBJECT(arg1), (IntPtr)lparg2, arg3, arg4);
+	(TO_OBJECT_AS(BitmapSource^, arg0))->CopyPixels((Int32Rect)TO_OBJECT(arg1), (IntPtr)lparg2, arg3, arg4);
 fail:
 	if (arg2 && lparg2) env->ReleaseByteArrayElements(arg2, lparg2, 0);
 	OS_NATIVE_EXIT(env, that, BitmapSource_1CopyPixels_FUNC);
@@ -625,7 +625,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BitmapSource_1Format)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, BitmapSource_1Format_FUNC);
-	rc = (jint)TO_HANDLE(((BitmapSource^)TO_OBJECT(arg0))->Format);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(BitmapSource^, arg0))->Format);
 	OS_NATIVE_EXIT(env, that, BitmapSource_1Format_FUNC);
 	return rc;
 }
@@ -638,7 +638,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BitmapSource_1Palette)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, BitmapSource_1Palette_FUNC);
-	rc = (jint)TO_HANDLE(((BitmapSource^)TO_OBJECT(arg0))->Palette);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(BitmapSource^, arg0))->Palette);
 	OS_NATIVE_EXIT(env, that, BitmapSource_1Palette_FUNC);
 	return rc;
 }
@@ -651,7 +651,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BitmapSource_1PixelHeight)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, BitmapSource_1PixelHeight_FUNC);
-	rc = (jint)((BitmapSource^)TO_OBJECT(arg0))->PixelHeight;
+	rc = (jint)(TO_OBJECT_AS(BitmapSource^, arg0))->PixelHeight;
 	OS_NATIVE_EXIT(env, that, BitmapSource_1PixelHeight_FUNC);
 	return rc;
 }
@@ -664,7 +664,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(BitmapSource_1PixelWidth)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, BitmapSource_1PixelWidth_FUNC);
-	rc = (jint)((BitmapSource^)TO_OBJECT(arg0))->PixelWidth;
+	rc = (jint)(TO_OBJECT_AS(BitmapSource^, arg0))->PixelWidth;
 	OS_NATIVE_EXIT(env, that, BitmapSource_1PixelWidth_FUNC);
 	return rc;
 }
@@ -677,7 +677,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(BlurBitmapEffect_1Radius__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, BlurBitmapEffect_1Radius__I_FUNC);
-	rc = (jdouble)((BlurBitmapEffect^)TO_OBJECT(arg0))->Radius;
+	rc = (jdouble)(TO_OBJECT_AS(BlurBitmapEffect^, arg0))->Radius;
 	OS_NATIVE_EXIT(env, that, BlurBitmapEffect_1Radius__I_FUNC);
 	return rc;
 }
@@ -689,7 +689,7 @@ JNIEXPORT void JNICALL OS_NATIVE(BlurBitmapEffect_1Radius__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, BlurBitmapEffect_1Radius__ID_FUNC);
-	((BlurBitmapEffect^)TO_OBJECT(arg0))->Radius = (arg1);
+	(TO_OBJECT_AS(BlurBitmapEffect^, arg0))->Radius = (arg1);
 	OS_NATIVE_EXIT(env, that, BlurBitmapEffect_1Radius__ID_FUNC);
 }
 #endif
@@ -713,7 +713,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Brush_1Opacity)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Brush_1Opacity_FUNC);
-	((Brush^)TO_OBJECT(arg0))->Opacity = (arg1);
+	(TO_OBJECT_AS(Brush^, arg0))->Opacity = (arg1);
 	OS_NATIVE_EXIT(env, that, Brush_1Opacity_FUNC);
 }
 #endif
@@ -802,7 +802,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ButtonBase_1Click)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ButtonBase_1Click_FUNC);
-	((ButtonBase^)TO_OBJECT(arg0))->Click += ((RoutedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ButtonBase^, arg0))->Click += ((RoutedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ButtonBase_1Click_FUNC);
 }
 #endif
@@ -827,7 +827,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Button_1IsDefault__I)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Button_1IsDefault__I_FUNC);
-	rc = (jboolean)((Button^)TO_OBJECT(arg0))->IsDefault;
+	rc = (jboolean)(TO_OBJECT_AS(Button^, arg0))->IsDefault;
 	OS_NATIVE_EXIT(env, that, Button_1IsDefault__I_FUNC);
 	return rc;
 }
@@ -839,7 +839,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Button_1IsDefault__IZ)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, Button_1IsDefault__IZ_FUNC);
-	((Button^)TO_OBJECT(arg0))->IsDefault = (arg1);
+	(TO_OBJECT_AS(Button^, arg0))->IsDefault = (arg1);
 	OS_NATIVE_EXIT(env, that, Button_1IsDefault__IZ_FUNC);
 }
 #endif
@@ -863,7 +863,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CancelEventArgs_1Cancel)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, CancelEventArgs_1Cancel_FUNC);
-	((CancelEventArgs^)TO_OBJECT(arg0))->Cancel = (arg1);
+	(TO_OBJECT_AS(CancelEventArgs^, arg0))->Cancel = (arg1);
 	OS_NATIVE_EXIT(env, that, CancelEventArgs_1Cancel_FUNC);
 }
 #endif
@@ -962,7 +962,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CharacterHit_1FirstCharacterIndex)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, CharacterHit_1FirstCharacterIndex_FUNC);
-	rc = (jint)((CharacterHit^)TO_OBJECT(arg0))->FirstCharacterIndex;
+	rc = (jint)(TO_OBJECT_AS(CharacterHit^, arg0))->FirstCharacterIndex;
 	OS_NATIVE_EXIT(env, that, CharacterHit_1FirstCharacterIndex_FUNC);
 	return rc;
 }
@@ -975,7 +975,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CharacterHit_1TrailingLength)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, CharacterHit_1TrailingLength_FUNC);
-	rc = (jint)((CharacterHit^)TO_OBJECT(arg0))->TrailingLength;
+	rc = (jint)(TO_OBJECT_AS(CharacterHit^, arg0))->TrailingLength;
 	OS_NATIVE_EXIT(env, that, CharacterHit_1TrailingLength_FUNC);
 	return rc;
 }
@@ -1085,7 +1085,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ColorDialog_1AnyColor)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, ColorDialog_1AnyColor_FUNC);
-	((System::Windows::Forms::ColorDialog^)TO_OBJECT(arg0))->AnyColor = (arg1);
+	(TO_OBJECT_AS(System::Windows::Forms::ColorDialog^, arg0))->AnyColor = (arg1);
 	OS_NATIVE_EXIT(env, that, ColorDialog_1AnyColor_FUNC);
 }
 #endif
@@ -1097,7 +1097,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ColorDialog_1Color__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ColorDialog_1Color__I_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::ColorDialog^)TO_OBJECT(arg0))->Color);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::ColorDialog^, arg0))->Color);
 	OS_NATIVE_EXIT(env, that, ColorDialog_1Color__I_FUNC);
 	return rc;
 }
@@ -1109,7 +1109,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ColorDialog_1Color__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ColorDialog_1Color__II_FUNC);
-	((System::Windows::Forms::ColorDialog^)TO_OBJECT(arg0))->Color = ((System::Drawing::Color)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::ColorDialog^, arg0))->Color = ((System::Drawing::Color)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ColorDialog_1Color__II_FUNC);
 }
 #endif
@@ -1121,7 +1121,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ColorDialog_1CustomColors__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ColorDialog_1CustomColors__I_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::ColorDialog^)TO_OBJECT(arg0))->CustomColors);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::ColorDialog^, arg0))->CustomColors);
 	OS_NATIVE_EXIT(env, that, ColorDialog_1CustomColors__I_FUNC);
 	return rc;
 }
@@ -1133,7 +1133,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ColorDialog_1CustomColors__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ColorDialog_1CustomColors__II_FUNC);
-	((System::Windows::Forms::ColorDialog^)TO_OBJECT(arg0))->CustomColors = ((array<int>^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::ColorDialog^, arg0))->CustomColors = ((array<int>^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ColorDialog_1CustomColors__II_FUNC);
 }
 #endif
@@ -1144,7 +1144,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ColorList_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ColorList_1Add_FUNC);
-	((System::Collections::Generic::List<Color>^)TO_OBJECT(arg0))->Add((Color)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Collections::Generic::List<Color>^, arg0))->Add((Color)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ColorList_1Add_FUNC);
 }
 #endif
@@ -1156,7 +1156,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ColorList_1Count)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ColorList_1Count_FUNC);
-	rc = (jint)((System::Collections::Generic::IList<Color>^)TO_OBJECT(arg0))->Count;
+	rc = (jint)(TO_OBJECT_AS(System::Collections::Generic::IList<Color>^, arg0))->Count;
 	OS_NATIVE_EXIT(env, that, ColorList_1Count_FUNC);
 	return rc;
 }
@@ -1169,7 +1169,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ColorList_1Current)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ColorList_1Current_FUNC);
-	rc = (jint)TO_HANDLE(((System::Collections::Generic::IEnumerator<Color>^)TO_OBJECT(arg0))->Current);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Collections::Generic::IEnumerator<Color>^, arg0))->Current);
 	OS_NATIVE_EXIT(env, that, ColorList_1Current_FUNC);
 	return rc;
 }
@@ -1182,7 +1182,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ColorList_1GetEnumerator)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ColorList_1GetEnumerator_FUNC);
-	rc = (jint)TO_HANDLE(((System::Collections::Generic::IEnumerable<Color>^)TO_OBJECT(arg0))->GetEnumerator());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Collections::Generic::IEnumerable<Color>^, arg0))->GetEnumerator());
 	OS_NATIVE_EXIT(env, that, ColorList_1GetEnumerator_FUNC);
 	return rc;
 }
@@ -1195,7 +1195,7 @@ JNIEXPORT jbyte JNICALL OS_NATIVE(Color_1A)
 {
 	jbyte rc = 0;
 	OS_NATIVE_ENTER(env, that, Color_1A_FUNC);
-	rc = (jbyte)((Color^)TO_OBJECT(arg0))->A;
+	rc = (jbyte)(TO_OBJECT_AS(Color^, arg0))->A;
 	OS_NATIVE_EXIT(env, that, Color_1A_FUNC);
 	return rc;
 }
@@ -1208,7 +1208,7 @@ JNIEXPORT jbyte JNICALL OS_NATIVE(Color_1B)
 {
 	jbyte rc = 0;
 	OS_NATIVE_ENTER(env, that, Color_1B_FUNC);
-	rc = (jbyte)((Color^)TO_OBJECT(arg0))->B;
+	rc = (jbyte)(TO_OBJECT_AS(Color^, arg0))->B;
 	OS_NATIVE_EXIT(env, that, Color_1B_FUNC);
 	return rc;
 }
@@ -1234,7 +1234,7 @@ JNIEXPORT jbyte JNICALL OS_NATIVE(Color_1G)
 {
 	jbyte rc = 0;
 	OS_NATIVE_ENTER(env, that, Color_1G_FUNC);
-	rc = (jbyte)((Color^)TO_OBJECT(arg0))->G;
+	rc = (jbyte)(TO_OBJECT_AS(Color^, arg0))->G;
 	OS_NATIVE_EXIT(env, that, Color_1G_FUNC);
 	return rc;
 }
@@ -1247,7 +1247,7 @@ JNIEXPORT jbyte JNICALL OS_NATIVE(Color_1R)
 {
 	jbyte rc = 0;
 	OS_NATIVE_ENTER(env, that, Color_1R_FUNC);
-	rc = (jbyte)((Color^)TO_OBJECT(arg0))->R;
+	rc = (jbyte)(TO_OBJECT_AS(Color^, arg0))->R;
 	OS_NATIVE_EXIT(env, that, Color_1R_FUNC);
 	return rc;
 }
@@ -1493,7 +1493,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ColumnDefinitionCollection_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ColumnDefinitionCollection_1Add_FUNC);
-	((ColumnDefinitionCollection^)TO_OBJECT(arg0))->Add((ColumnDefinition^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ColumnDefinitionCollection^, arg0))->Add((ColumnDefinition^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ColumnDefinitionCollection_1Add_FUNC);
 }
 #endif
@@ -1504,7 +1504,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ColumnDefinition_1Width)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ColumnDefinition_1Width_FUNC);
-	((ColumnDefinition^)TO_OBJECT(arg0))->Width = ((GridLength)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ColumnDefinition^, arg0))->Width = ((GridLength)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ColumnDefinition_1Width_FUNC);
 }
 #endif
@@ -1516,7 +1516,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ComboBox_1IsDropDownOpen__I)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, ComboBox_1IsDropDownOpen__I_FUNC);
-	rc = (jboolean)((ComboBox^)TO_OBJECT(arg0))->IsDropDownOpen;
+	rc = (jboolean)(TO_OBJECT_AS(ComboBox^, arg0))->IsDropDownOpen;
 	OS_NATIVE_EXIT(env, that, ComboBox_1IsDropDownOpen__I_FUNC);
 	return rc;
 }
@@ -1528,7 +1528,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ComboBox_1IsDropDownOpen__IZ)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, ComboBox_1IsDropDownOpen__IZ_FUNC);
-	((ComboBox^)TO_OBJECT(arg0))->IsDropDownOpen = (arg1);
+	(TO_OBJECT_AS(ComboBox^, arg0))->IsDropDownOpen = (arg1);
 	OS_NATIVE_EXIT(env, that, ComboBox_1IsDropDownOpen__IZ_FUNC);
 }
 #endif
@@ -1539,7 +1539,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ComboBox_1IsEditable)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, ComboBox_1IsEditable_FUNC);
-	((ComboBox^)TO_OBJECT(arg0))->IsEditable = (arg1);
+	(TO_OBJECT_AS(ComboBox^, arg0))->IsEditable = (arg1);
 	OS_NATIVE_EXIT(env, that, ComboBox_1IsEditable_FUNC);
 }
 #endif
@@ -1551,7 +1551,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ComboBox_1SelectionBoxItem)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ComboBox_1SelectionBoxItem_FUNC);
-	rc = (jint)TO_HANDLE(((ComboBox^)TO_OBJECT(arg0))->SelectionBoxItem);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(ComboBox^, arg0))->SelectionBoxItem);
 	OS_NATIVE_EXIT(env, that, ComboBox_1SelectionBoxItem_FUNC);
 	return rc;
 }
@@ -1575,7 +1575,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(CommonDialog_1ShowDialog)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, CommonDialog_1ShowDialog_FUNC);
-	rc = (jboolean)((CommonDialog^)TO_OBJECT(arg0))->ShowDialog((Window^)TO_OBJECT(arg1));
+	rc = (jboolean)(TO_OBJECT_AS(CommonDialog^, arg0))->ShowDialog((Window^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, CommonDialog_1ShowDialog_FUNC);
 	return rc;
 }
@@ -1588,7 +1588,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(CompositeCollection_1IndexOf)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, CompositeCollection_1IndexOf_FUNC);
-	rc = (jint)((CompositeCollection^)TO_OBJECT(arg0))->IndexOf((Object^)TO_OBJECT(arg1));
+	rc = (jint)(TO_OBJECT_AS(CompositeCollection^, arg0))->IndexOf((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, CompositeCollection_1IndexOf_FUNC);
 	return rc;
 }
@@ -1600,7 +1600,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CompositeCollection_1Insert)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, CompositeCollection_1Insert_FUNC);
-	((CompositeCollection^)TO_OBJECT(arg0))->Insert(arg1, (Object^)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(CompositeCollection^, arg0))->Insert(arg1, (Object^)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, CompositeCollection_1Insert_FUNC);
 }
 #endif
@@ -1611,7 +1611,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CompositeCollection_1Remove)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, CompositeCollection_1Remove_FUNC);
-	((CompositeCollection^)TO_OBJECT(arg0))->Remove((Object^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(CompositeCollection^, arg0))->Remove((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, CompositeCollection_1Remove_FUNC);
 }
 #endif
@@ -1622,7 +1622,7 @@ JNIEXPORT void JNICALL OS_NATIVE(CompositeCollection_1RemoveAt)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, CompositeCollection_1RemoveAt_FUNC);
-	((CompositeCollection^)TO_OBJECT(arg0))->RemoveAt(arg1);
+	(TO_OBJECT_AS(CompositeCollection^, arg0))->RemoveAt(arg1);
 	OS_NATIVE_EXIT(env, that, CompositeCollection_1RemoveAt_FUNC);
 }
 #endif
@@ -1645,7 +1645,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ContainerVisual_1Clip__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ContainerVisual_1Clip__I_FUNC);
-	rc = (jint)TO_HANDLE(((ContainerVisual^)TO_OBJECT(arg0))->Clip);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(ContainerVisual^, arg0))->Clip);
 	OS_NATIVE_EXIT(env, that, ContainerVisual_1Clip__I_FUNC);
 	return rc;
 }
@@ -1657,7 +1657,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ContainerVisual_1Clip__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ContainerVisual_1Clip__II_FUNC);
-	((ContainerVisual^)TO_OBJECT(arg0))->Clip = ((Geometry^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ContainerVisual^, arg0))->Clip = ((Geometry^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ContainerVisual_1Clip__II_FUNC);
 }
 #endif
@@ -1669,7 +1669,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ContentControl_1Content__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ContentControl_1Content__I_FUNC);
-	rc = (jint)TO_HANDLE(((ContentControl^)TO_OBJECT(arg0))->Content);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(ContentControl^, arg0))->Content);
 	OS_NATIVE_EXIT(env, that, ContentControl_1Content__I_FUNC);
 	return rc;
 }
@@ -1681,7 +1681,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ContentControl_1Content__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ContentControl_1Content__II_FUNC);
-	((ContentControl^)TO_OBJECT(arg0))->Content = ((Object^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ContentControl^, arg0))->Content = ((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ContentControl_1Content__II_FUNC);
 }
 #endif
@@ -1693,7 +1693,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ContentPresenter_1Content)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ContentPresenter_1Content_FUNC);
-	rc = (jint)TO_HANDLE(((ContentPresenter^)TO_OBJECT(arg0))->Content);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(ContentPresenter^, arg0))->Content);
 	OS_NATIVE_EXIT(env, that, ContentPresenter_1Content_FUNC);
 	return rc;
 }
@@ -1719,7 +1719,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(ContextMenuEventArgs_1CursorLeft)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, ContextMenuEventArgs_1CursorLeft_FUNC);
-	rc = (jdouble)((ContextMenuEventArgs^)TO_OBJECT(arg0))->CursorLeft;
+	rc = (jdouble)(TO_OBJECT_AS(ContextMenuEventArgs^, arg0))->CursorLeft;
 	OS_NATIVE_EXIT(env, that, ContextMenuEventArgs_1CursorLeft_FUNC);
 	return rc;
 }
@@ -1732,7 +1732,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(ContextMenuEventArgs_1CursorTop)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, ContextMenuEventArgs_1CursorTop_FUNC);
-	rc = (jdouble)((ContextMenuEventArgs^)TO_OBJECT(arg0))->CursorTop;
+	rc = (jdouble)(TO_OBJECT_AS(ContextMenuEventArgs^, arg0))->CursorTop;
 	OS_NATIVE_EXIT(env, that, ContextMenuEventArgs_1CursorTop_FUNC);
 	return rc;
 }
@@ -1744,7 +1744,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ContextMenu_1Closed)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ContextMenu_1Closed_FUNC);
-	((ContextMenu^)TO_OBJECT(arg0))->Closed += ((RoutedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ContextMenu^, arg0))->Closed += ((RoutedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ContextMenu_1Closed_FUNC);
 }
 #endif
@@ -1755,7 +1755,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ContextMenu_1HorizontalOffset)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ContextMenu_1HorizontalOffset_FUNC);
-	((ContextMenu^)TO_OBJECT(arg0))->HorizontalOffset = (arg1);
+	(TO_OBJECT_AS(ContextMenu^, arg0))->HorizontalOffset = (arg1);
 	OS_NATIVE_EXIT(env, that, ContextMenu_1HorizontalOffset_FUNC);
 }
 #endif
@@ -1766,7 +1766,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ContextMenu_1IsOpen)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, ContextMenu_1IsOpen_FUNC);
-	((ContextMenu^)TO_OBJECT(arg0))->IsOpen = (arg1);
+	(TO_OBJECT_AS(ContextMenu^, arg0))->IsOpen = (arg1);
 	OS_NATIVE_EXIT(env, that, ContextMenu_1IsOpen_FUNC);
 }
 #endif
@@ -1777,7 +1777,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ContextMenu_1Opened)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ContextMenu_1Opened_FUNC);
-	((ContextMenu^)TO_OBJECT(arg0))->Opened += ((RoutedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ContextMenu^, arg0))->Opened += ((RoutedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ContextMenu_1Opened_FUNC);
 }
 #endif
@@ -1788,7 +1788,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ContextMenu_1Placement)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ContextMenu_1Placement_FUNC);
-	((ContextMenu^)TO_OBJECT(arg0))->Placement = ((PlacementMode)arg1);
+	(TO_OBJECT_AS(ContextMenu^, arg0))->Placement = ((PlacementMode)arg1);
 	OS_NATIVE_EXIT(env, that, ContextMenu_1Placement_FUNC);
 }
 #endif
@@ -1799,7 +1799,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ContextMenu_1VerticalOffset)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ContextMenu_1VerticalOffset_FUNC);
-	((ContextMenu^)TO_OBJECT(arg0))->VerticalOffset = (arg1);
+	(TO_OBJECT_AS(ContextMenu^, arg0))->VerticalOffset = (arg1);
 	OS_NATIVE_EXIT(env, that, ContextMenu_1VerticalOffset_FUNC);
 }
 #endif
@@ -1810,7 +1810,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Control_1Background)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Control_1Background_FUNC);
-	((Control^)TO_OBJECT(arg0))->Background = ((Brush^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Control^, arg0))->Background = ((Brush^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Control_1Background_FUNC);
 }
 #endif
@@ -1847,7 +1847,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Control_1BorderThickness)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Control_1BorderThickness_FUNC);
-	((Control^)TO_OBJECT(arg0))->BorderThickness = ((Thickness)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Control^, arg0))->BorderThickness = ((Thickness)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Control_1BorderThickness_FUNC);
 }
 #endif
@@ -1872,7 +1872,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Control_1FontFamily__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Control_1FontFamily__I_FUNC);
-	rc = (jint)TO_HANDLE(((Control^)TO_OBJECT(arg0))->FontFamily);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Control^, arg0))->FontFamily);
 	OS_NATIVE_EXIT(env, that, Control_1FontFamily__I_FUNC);
 	return rc;
 }
@@ -1884,7 +1884,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Control_1FontFamily__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Control_1FontFamily__II_FUNC);
-	((Control^)TO_OBJECT(arg0))->FontFamily = ((FontFamily^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Control^, arg0))->FontFamily = ((FontFamily^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Control_1FontFamily__II_FUNC);
 }
 #endif
@@ -1909,7 +1909,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Control_1FontSize__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Control_1FontSize__I_FUNC);
-	rc = (jdouble)((Control^)TO_OBJECT(arg0))->FontSize;
+	rc = (jdouble)(TO_OBJECT_AS(Control^, arg0))->FontSize;
 	OS_NATIVE_EXIT(env, that, Control_1FontSize__I_FUNC);
 	return rc;
 }
@@ -1921,7 +1921,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Control_1FontSize__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Control_1FontSize__ID_FUNC);
-	((Control^)TO_OBJECT(arg0))->FontSize = (arg1);
+	(TO_OBJECT_AS(Control^, arg0))->FontSize = (arg1);
 	OS_NATIVE_EXIT(env, that, Control_1FontSize__ID_FUNC);
 }
 #endif
@@ -1945,7 +1945,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Control_1FontStretch)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Control_1FontStretch_FUNC);
-	((Control^)TO_OBJECT(arg0))->FontStretch = ((FontStretch)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Control^, arg0))->FontStretch = ((FontStretch)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Control_1FontStretch_FUNC);
 }
 #endif
@@ -1969,7 +1969,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Control_1FontStyle)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Control_1FontStyle_FUNC);
-	((Control^)TO_OBJECT(arg0))->FontStyle = ((FontStyle)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Control^, arg0))->FontStyle = ((FontStyle)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Control_1FontStyle_FUNC);
 }
 #endif
@@ -1993,7 +1993,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Control_1FontWeight)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Control_1FontWeight_FUNC);
-	((Control^)TO_OBJECT(arg0))->FontWeight = ((FontWeight)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Control^, arg0))->FontWeight = ((FontWeight)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Control_1FontWeight_FUNC);
 }
 #endif
@@ -2017,7 +2017,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Control_1Foreground)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Control_1Foreground_FUNC);
-	((Control^)TO_OBJECT(arg0))->Foreground = ((Brush^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Control^, arg0))->Foreground = ((Brush^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Control_1Foreground_FUNC);
 }
 #endif
@@ -2042,7 +2042,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Control_1HorizontalContentAlignment__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Control_1HorizontalContentAlignment__I_FUNC);
-	rc = (jint)((Control ^)TO_OBJECT(arg0))->HorizontalContentAlignment;
+	rc = (jint)(TO_OBJECT_AS(Control ^, arg0))->HorizontalContentAlignment;
 	OS_NATIVE_EXIT(env, that, Control_1HorizontalContentAlignment__I_FUNC);
 	return rc;
 }
@@ -2054,7 +2054,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Control_1HorizontalContentAlignment__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Control_1HorizontalContentAlignment__II_FUNC);
-	((Control ^)TO_OBJECT(arg0))->HorizontalContentAlignment = ((HorizontalAlignment)arg1);
+	(TO_OBJECT_AS(Control ^, arg0))->HorizontalContentAlignment = ((HorizontalAlignment)arg1);
 	OS_NATIVE_EXIT(env, that, Control_1HorizontalContentAlignment__II_FUNC);
 }
 #endif
@@ -2065,7 +2065,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Control_1MouseDoubleClick)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Control_1MouseDoubleClick_FUNC);
-	((Control^)TO_OBJECT(arg0))->MouseDoubleClick += ((MouseButtonEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Control^, arg0))->MouseDoubleClick += ((MouseButtonEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Control_1MouseDoubleClick_FUNC);
 }
 #endif
@@ -2090,7 +2090,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Control_1Padding__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Control_1Padding__I_FUNC);
-	rc = (jint)TO_HANDLE(((Control^)TO_OBJECT(arg0))->Padding);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Control^, arg0))->Padding);
 	OS_NATIVE_EXIT(env, that, Control_1Padding__I_FUNC);
 	return rc;
 }
@@ -2102,7 +2102,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Control_1Padding__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Control_1Padding__II_FUNC);
-	((Control^)TO_OBJECT(arg0))->Padding = ((Thickness)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Control^, arg0))->Padding = ((Thickness)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Control_1Padding__II_FUNC);
 }
 #endif
@@ -2113,7 +2113,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Control_1PreviewMouseDoubleClick)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Control_1PreviewMouseDoubleClick_FUNC);
-	((Control^)TO_OBJECT(arg0))->PreviewMouseDoubleClick += ((MouseButtonEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Control^, arg0))->PreviewMouseDoubleClick += ((MouseButtonEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Control_1PreviewMouseDoubleClick_FUNC);
 }
 #endif
@@ -2125,7 +2125,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Control_1Template__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Control_1Template__I_FUNC);
-	rc = (jint)TO_HANDLE(((Control^)TO_OBJECT(arg0))->Template);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Control^, arg0))->Template);
 	OS_NATIVE_EXIT(env, that, Control_1Template__I_FUNC);
 	return rc;
 }
@@ -2137,7 +2137,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Control_1Template__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Control_1Template__II_FUNC);
-	((Control^)TO_OBJECT(arg0))->Template = ((ControlTemplate^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Control^, arg0))->Template = ((ControlTemplate^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Control_1Template__II_FUNC);
 }
 #endif
@@ -2161,7 +2161,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Control_1VerticalContentAlignment)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Control_1VerticalContentAlignment_FUNC);
-	((Control^)TO_OBJECT(arg0))->VerticalContentAlignment = ((VerticalAlignment)arg1);
+	(TO_OBJECT_AS(Control^, arg0))->VerticalContentAlignment = ((VerticalAlignment)arg1);
 	OS_NATIVE_EXIT(env, that, Control_1VerticalContentAlignment_FUNC);
 }
 #endif
@@ -2615,7 +2615,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DataObject_1GetData)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DataObject_1GetData_FUNC);
-	rc = (jint)TO_HANDLE(((DataObject^)TO_OBJECT(arg0))->GetData((String^)TO_OBJECT(arg1), arg2));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(DataObject^, arg0))->GetData((String^)TO_OBJECT(arg1), arg2));
 	OS_NATIVE_EXIT(env, that, DataObject_1GetData_FUNC);
 	return rc;
 }
@@ -2628,7 +2628,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DataObject_1GetDataPresent)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, DataObject_1GetDataPresent_FUNC);
-	rc = (jboolean)((DataObject^)TO_OBJECT(arg0))->GetDataPresent((String^)TO_OBJECT(arg1), arg2);
+	rc = (jboolean)(TO_OBJECT_AS(DataObject^, arg0))->GetDataPresent((String^)TO_OBJECT(arg1), arg2);
 	OS_NATIVE_EXIT(env, that, DataObject_1GetDataPresent_FUNC);
 	return rc;
 }
@@ -2641,7 +2641,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DataObject_1GetFormats)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DataObject_1GetFormats_FUNC);
-	rc = (jint)TO_HANDLE(((DataObject^)TO_OBJECT(arg0))->GetFormats(arg1));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(DataObject^, arg0))->GetFormats(arg1));
 	OS_NATIVE_EXIT(env, that, DataObject_1GetFormats_FUNC);
 	return rc;
 }
@@ -2653,7 +2653,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DataObject_1SetData)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jboolean arg3)
 {
 	OS_NATIVE_ENTER(env, that, DataObject_1SetData_FUNC);
-	((DataObject^)TO_OBJECT(arg0))->SetData((String^)TO_OBJECT(arg1), (Object^)TO_OBJECT(arg2), arg3);
+	(TO_OBJECT_AS(DataObject^, arg0))->SetData((String^)TO_OBJECT(arg1), (Object^)TO_OBJECT(arg2), arg3);
 	OS_NATIVE_EXIT(env, that, DataObject_1SetData_FUNC);
 }
 #endif
@@ -2675,7 +2675,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DependencyObject_1ClearValue)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, DependencyObject_1ClearValue_FUNC);
-	((DependencyObject^)TO_OBJECT(arg0))->ClearValue((DependencyProperty^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(DependencyObject^, arg0))->ClearValue((DependencyProperty^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, DependencyObject_1ClearValue_FUNC);
 }
 #endif
@@ -2687,7 +2687,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DependencyObject_1GetValue)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DependencyObject_1GetValue_FUNC);
-	rc = (jint)TO_HANDLE(((DependencyObject^)TO_OBJECT(arg0))->GetValue((DependencyProperty^)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(DependencyObject^, arg0))->GetValue((DependencyProperty^)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, DependencyObject_1GetValue_FUNC);
 	return rc;
 }
@@ -2700,7 +2700,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(DependencyObject_1GetValueDouble)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, DependencyObject_1GetValueDouble_FUNC);
-	rc = (jdouble)((DependencyObject^)TO_OBJECT(arg0))->GetValue((DependencyProperty^)TO_OBJECT(arg1));
+	rc = (jdouble)(TO_OBJECT_AS(DependencyObject^, arg0))->GetValue((DependencyProperty^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, DependencyObject_1GetValueDouble_FUNC);
 	return rc;
 }
@@ -2713,7 +2713,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DependencyObject_1GetValueInt)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DependencyObject_1GetValueInt_FUNC);
-	rc = (jint)((DependencyObject^)TO_OBJECT(arg0))->GetValue((DependencyProperty^)TO_OBJECT(arg1));
+	rc = (jint)(TO_OBJECT_AS(DependencyObject^, arg0))->GetValue((DependencyProperty^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, DependencyObject_1GetValueInt_FUNC);
 	return rc;
 }
@@ -2725,7 +2725,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DependencyObject_1SetValue)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, DependencyObject_1SetValue_FUNC);
-	((DependencyObject^)TO_OBJECT(arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (Object^)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(DependencyObject^, arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (Object^)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, DependencyObject_1SetValue_FUNC);
 }
 #endif
@@ -2737,7 +2737,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(DependencyPropertyChangedEventArgs_1NewValue
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, DependencyPropertyChangedEventArgs_1NewValueDouble_FUNC);
-	rc = (jdouble)((DependencyPropertyChangedEventArgs^)TO_OBJECT(arg0))->NewValue;
+	rc = (jdouble)(TO_OBJECT_AS(DependencyPropertyChangedEventArgs^, arg0))->NewValue;
 	OS_NATIVE_EXIT(env, that, DependencyPropertyChangedEventArgs_1NewValueDouble_FUNC);
 	return rc;
 }
@@ -2750,7 +2750,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DependencyPropertyChangedEventArgs_1NewValueInt
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DependencyPropertyChangedEventArgs_1NewValueInt_FUNC);
-	rc = (jint)((DependencyPropertyChangedEventArgs^)TO_OBJECT(arg0))->NewValue;
+	rc = (jint)(TO_OBJECT_AS(DependencyPropertyChangedEventArgs^, arg0))->NewValue;
 	OS_NATIVE_EXIT(env, that, DependencyPropertyChangedEventArgs_1NewValueInt_FUNC);
 	return rc;
 }
@@ -2763,7 +2763,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(DependencyPropertyChangedEventArgs_1OldValue
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, DependencyPropertyChangedEventArgs_1OldValueDouble_FUNC);
-	rc = (jdouble)((DependencyPropertyChangedEventArgs^)TO_OBJECT(arg0))->OldValue;
+	rc = (jdouble)(TO_OBJECT_AS(DependencyPropertyChangedEventArgs^, arg0))->OldValue;
 	OS_NATIVE_EXIT(env, that, DependencyPropertyChangedEventArgs_1OldValueDouble_FUNC);
 	return rc;
 }
@@ -2776,7 +2776,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DependencyPropertyChangedEventArgs_1OldValueInt
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DependencyPropertyChangedEventArgs_1OldValueInt_FUNC);
-	rc = (jint)((DependencyPropertyChangedEventArgs^)TO_OBJECT(arg0))->OldValue;
+	rc = (jint)(TO_OBJECT_AS(DependencyPropertyChangedEventArgs^, arg0))->OldValue;
 	OS_NATIVE_EXIT(env, that, DependencyPropertyChangedEventArgs_1OldValueInt_FUNC);
 	return rc;
 }
@@ -2788,7 +2788,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DependencyPropertyDescriptor_1AddValueChanged)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, DependencyPropertyDescriptor_1AddValueChanged_FUNC);
-	((DependencyPropertyDescriptor^)TO_OBJECT(arg0))->AddValueChanged((Object^)TO_OBJECT(arg1), (EventHandler^)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(DependencyPropertyDescriptor^, arg0))->AddValueChanged((Object^)TO_OBJECT(arg1), (EventHandler^)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, DependencyPropertyDescriptor_1AddValueChanged_FUNC);
 }
 #endif
@@ -2800,7 +2800,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DependencyPropertyDescriptor_1DependencyPropert
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DependencyPropertyDescriptor_1DependencyProperty_FUNC);
-	rc = (jint)TO_HANDLE(((DependencyPropertyDescriptor^)TO_OBJECT(arg0))->DependencyProperty);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(DependencyPropertyDescriptor^, arg0))->DependencyProperty);
 	OS_NATIVE_EXIT(env, that, DependencyPropertyDescriptor_1DependencyProperty_FUNC);
 	return rc;
 }
@@ -2865,7 +2865,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DispatcherFrame_1Continue__I)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, DispatcherFrame_1Continue__I_FUNC);
-	rc = (jboolean)((DispatcherFrame^)TO_OBJECT(arg0))->Continue;
+	rc = (jboolean)(TO_OBJECT_AS(DispatcherFrame^, arg0))->Continue;
 	OS_NATIVE_EXIT(env, that, DispatcherFrame_1Continue__I_FUNC);
 	return rc;
 }
@@ -2877,7 +2877,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DispatcherFrame_1Continue__IZ)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, DispatcherFrame_1Continue__IZ_FUNC);
-	((DispatcherFrame^)TO_OBJECT(arg0))->Continue = (arg1);
+	(TO_OBJECT_AS(DispatcherFrame^, arg0))->Continue = (arg1);
 	OS_NATIVE_EXIT(env, that, DispatcherFrame_1Continue__IZ_FUNC);
 }
 #endif
@@ -2889,7 +2889,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DispatcherHookEventArgs_1Operation)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DispatcherHookEventArgs_1Operation_FUNC);
-	rc = (jint)TO_HANDLE(((DispatcherHookEventArgs ^)TO_OBJECT(arg0))->Operation);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(DispatcherHookEventArgs ^, arg0))->Operation);
 	OS_NATIVE_EXIT(env, that, DispatcherHookEventArgs_1Operation_FUNC);
 	return rc;
 }
@@ -2901,7 +2901,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DispatcherHooks_1DispatcherInactive)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, DispatcherHooks_1DispatcherInactive_FUNC);
-	((DispatcherHooks ^)TO_OBJECT(arg0))->DispatcherInactive += ((EventHandler ^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(DispatcherHooks ^, arg0))->DispatcherInactive += ((EventHandler ^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, DispatcherHooks_1DispatcherInactive_FUNC);
 }
 #endif
@@ -2912,7 +2912,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DispatcherHooks_1OperationAborted)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, DispatcherHooks_1OperationAborted_FUNC);
-	((DispatcherHooks ^)TO_OBJECT(arg0))->OperationAborted += ((DispatcherHookEventHandler ^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(DispatcherHooks ^, arg0))->OperationAborted += ((DispatcherHookEventHandler ^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, DispatcherHooks_1OperationAborted_FUNC);
 }
 #endif
@@ -2923,7 +2923,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DispatcherHooks_1OperationCompleted)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, DispatcherHooks_1OperationCompleted_FUNC);
-	((DispatcherHooks ^)TO_OBJECT(arg0))->OperationCompleted += ((DispatcherHookEventHandler ^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(DispatcherHooks ^, arg0))->OperationCompleted += ((DispatcherHookEventHandler ^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, DispatcherHooks_1OperationCompleted_FUNC);
 }
 #endif
@@ -2934,7 +2934,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DispatcherHooks_1OperationPosted)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, DispatcherHooks_1OperationPosted_FUNC);
-	((DispatcherHooks ^)TO_OBJECT(arg0))->OperationPosted += ((DispatcherHookEventHandler ^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(DispatcherHooks ^, arg0))->OperationPosted += ((DispatcherHookEventHandler ^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, DispatcherHooks_1OperationPosted_FUNC);
 }
 #endif
@@ -2946,7 +2946,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(DispatcherOperation_1Abort)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, DispatcherOperation_1Abort_FUNC);
-	rc = (jboolean)((DispatcherOperation^)TO_OBJECT(arg0))->Abort();
+	rc = (jboolean)(TO_OBJECT_AS(DispatcherOperation^, arg0))->Abort();
 	OS_NATIVE_EXIT(env, that, DispatcherOperation_1Abort_FUNC);
 	return rc;
 }
@@ -2959,7 +2959,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DispatcherOperation_1Priority__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DispatcherOperation_1Priority__I_FUNC);
-	rc = (jint)((DispatcherOperation ^)TO_OBJECT(arg0))->Priority;
+	rc = (jint)(TO_OBJECT_AS(DispatcherOperation ^, arg0))->Priority;
 	OS_NATIVE_EXIT(env, that, DispatcherOperation_1Priority__I_FUNC);
 	return rc;
 }
@@ -2971,7 +2971,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DispatcherOperation_1Priority__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, DispatcherOperation_1Priority__II_FUNC);
-	((DispatcherOperation ^)TO_OBJECT(arg0))->Priority = ((DispatcherPriority)arg1);
+	(TO_OBJECT_AS(DispatcherOperation ^, arg0))->Priority = ((DispatcherPriority)arg1);
 	OS_NATIVE_EXIT(env, that, DispatcherOperation_1Priority__II_FUNC);
 }
 #endif
@@ -2983,7 +2983,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DispatcherOperation_1Wait)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DispatcherOperation_1Wait_FUNC);
-	rc = (jint)((DispatcherOperation^)TO_OBJECT(arg0))->Wait();
+	rc = (jint)(TO_OBJECT_AS(DispatcherOperation^, arg0))->Wait();
 	OS_NATIVE_EXIT(env, that, DispatcherOperation_1Wait_FUNC);
 	return rc;
 }
@@ -2995,7 +2995,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DispatcherTimer_1Interval)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, DispatcherTimer_1Interval_FUNC);
-	((DispatcherTimer^)TO_OBJECT(arg0))->Interval = ((TimeSpan)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(DispatcherTimer^, arg0))->Interval = ((TimeSpan)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, DispatcherTimer_1Interval_FUNC);
 }
 #endif
@@ -3006,7 +3006,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DispatcherTimer_1Start)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, DispatcherTimer_1Start_FUNC);
-	((DispatcherTimer^)TO_OBJECT(arg0))->Start();
+	(TO_OBJECT_AS(DispatcherTimer^, arg0))->Start();
 	OS_NATIVE_EXIT(env, that, DispatcherTimer_1Start_FUNC);
 }
 #endif
@@ -3017,7 +3017,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DispatcherTimer_1Stop)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, DispatcherTimer_1Stop_FUNC);
-	((DispatcherTimer^)TO_OBJECT(arg0))->Stop();
+	(TO_OBJECT_AS(DispatcherTimer^, arg0))->Stop();
 	OS_NATIVE_EXIT(env, that, DispatcherTimer_1Stop_FUNC);
 }
 #endif
@@ -3029,7 +3029,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DispatcherTimer_1Tag__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DispatcherTimer_1Tag__I_FUNC);
-	rc = (jint)((DispatcherTimer^)TO_OBJECT(arg0))->Tag;
+	rc = (jint)(TO_OBJECT_AS(DispatcherTimer^, arg0))->Tag;
 	OS_NATIVE_EXIT(env, that, DispatcherTimer_1Tag__I_FUNC);
 	return rc;
 }
@@ -3041,7 +3041,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DispatcherTimer_1Tag__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, DispatcherTimer_1Tag__II_FUNC);
-	((DispatcherTimer^)TO_OBJECT(arg0))->Tag = (arg1);
+	(TO_OBJECT_AS(DispatcherTimer^, arg0))->Tag = (arg1);
 	OS_NATIVE_EXIT(env, that, DispatcherTimer_1Tag__II_FUNC);
 }
 #endif
@@ -3052,7 +3052,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DispatcherTimer_1Tick)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, DispatcherTimer_1Tick_FUNC);
-	((DispatcherTimer^)TO_OBJECT(arg0))->Tick += ((EventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(DispatcherTimer^, arg0))->Tick += ((EventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, DispatcherTimer_1Tick_FUNC);
 }
 #endif
@@ -3064,7 +3064,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Dispatcher_1BeginInvoke)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Dispatcher_1BeginInvoke_FUNC);
-	rc = (jint)TO_HANDLE(((Dispatcher ^)TO_OBJECT(arg0))->BeginInvoke((DispatcherPriority)arg1, (Delegate ^)TO_OBJECT(arg2)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Dispatcher ^, arg0))->BeginInvoke((DispatcherPriority)arg1, (Delegate ^)TO_OBJECT(arg2)));
 	OS_NATIVE_EXIT(env, that, Dispatcher_1BeginInvoke_FUNC);
 	return rc;
 }
@@ -3077,7 +3077,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Dispatcher_1Hooks)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Dispatcher_1Hooks_FUNC);
-	rc = (jint)TO_HANDLE(((Dispatcher ^)TO_OBJECT(arg0))->Hooks);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Dispatcher ^, arg0))->Hooks);
 	OS_NATIVE_EXIT(env, that, Dispatcher_1Hooks_FUNC);
 	return rc;
 }
@@ -3127,7 +3127,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DoubleAnimationUsingKeyFrames_1KeyFrames)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DoubleAnimationUsingKeyFrames_1KeyFrames_FUNC);
-	rc = (jint)TO_HANDLE(((DoubleAnimationUsingKeyFrames^)TO_OBJECT(arg0))->KeyFrames);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(DoubleAnimationUsingKeyFrames^, arg0))->KeyFrames);
 	OS_NATIVE_EXIT(env, that, DoubleAnimationUsingKeyFrames_1KeyFrames_FUNC);
 	return rc;
 }
@@ -3140,7 +3140,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(DoubleAnimation_1From__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, DoubleAnimation_1From__I_FUNC);
-	rc = (jdouble)((DoubleAnimation^)TO_OBJECT(arg0))->From;
+	rc = (jdouble)(TO_OBJECT_AS(DoubleAnimation^, arg0))->From;
 	OS_NATIVE_EXIT(env, that, DoubleAnimation_1From__I_FUNC);
 	return rc;
 }
@@ -3152,7 +3152,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DoubleAnimation_1From__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, DoubleAnimation_1From__ID_FUNC);
-	((DoubleAnimation^)TO_OBJECT(arg0))->From = (arg1);
+	(TO_OBJECT_AS(DoubleAnimation^, arg0))->From = (arg1);
 	OS_NATIVE_EXIT(env, that, DoubleAnimation_1From__ID_FUNC);
 }
 #endif
@@ -3164,7 +3164,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(DoubleAnimation_1To__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, DoubleAnimation_1To__I_FUNC);
-	rc = (jdouble)((DoubleAnimation^)TO_OBJECT(arg0))->To;
+	rc = (jdouble)(TO_OBJECT_AS(DoubleAnimation^, arg0))->To;
 	OS_NATIVE_EXIT(env, that, DoubleAnimation_1To__I_FUNC);
 	return rc;
 }
@@ -3176,7 +3176,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DoubleAnimation_1To__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, DoubleAnimation_1To__ID_FUNC);
-	((DoubleAnimation^)TO_OBJECT(arg0))->To = (arg1);
+	(TO_OBJECT_AS(DoubleAnimation^, arg0))->To = (arg1);
 	OS_NATIVE_EXIT(env, that, DoubleAnimation_1To__ID_FUNC);
 }
 #endif
@@ -3187,7 +3187,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DoubleCollection_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, DoubleCollection_1Add_FUNC);
-	((DoubleCollection^)TO_OBJECT(arg0))->Add(arg1);
+	(TO_OBJECT_AS(DoubleCollection^, arg0))->Add(arg1);
 	OS_NATIVE_EXIT(env, that, DoubleCollection_1Add_FUNC);
 }
 #endif
@@ -3199,7 +3199,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DoubleKeyFrameCollection_1Add)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DoubleKeyFrameCollection_1Add_FUNC);
-	rc = (jint)((DoubleKeyFrameCollection^)TO_OBJECT(arg0))->Add((DoubleKeyFrame^)TO_OBJECT(arg1));
+	rc = (jint)(TO_OBJECT_AS(DoubleKeyFrameCollection^, arg0))->Add((DoubleKeyFrame^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, DoubleKeyFrameCollection_1Add_FUNC);
 	return rc;
 }
@@ -3211,7 +3211,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DoubleKeyFrame_1KeyTime)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, DoubleKeyFrame_1KeyTime_FUNC);
-	((DoubleKeyFrame^)TO_OBJECT(arg0))->KeyTime = ((KeyTime)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(DoubleKeyFrame^, arg0))->KeyTime = ((KeyTime)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, DoubleKeyFrame_1KeyTime_FUNC);
 }
 #endif
@@ -3222,7 +3222,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DoubleKeyFrame_1Value)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, DoubleKeyFrame_1Value_FUNC);
-	((DoubleKeyFrame^)TO_OBJECT(arg0))->Value = (arg1);
+	(TO_OBJECT_AS(DoubleKeyFrame^, arg0))->Value = (arg1);
 	OS_NATIVE_EXIT(env, that, DoubleKeyFrame_1Value_FUNC);
 }
 #endif
@@ -3234,7 +3234,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DragDeltaEventArgs_1HorizontalChange)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DragDeltaEventArgs_1HorizontalChange_FUNC);
-	rc = (jint)((DragDeltaEventArgs^)TO_OBJECT(arg0))->HorizontalChange;
+	rc = (jint)(TO_OBJECT_AS(DragDeltaEventArgs^, arg0))->HorizontalChange;
 	OS_NATIVE_EXIT(env, that, DragDeltaEventArgs_1HorizontalChange_FUNC);
 	return rc;
 }
@@ -3247,7 +3247,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DragDeltaEventArgs_1VerticalChange)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DragDeltaEventArgs_1VerticalChange_FUNC);
-	rc = (jint)((DragDeltaEventArgs^)TO_OBJECT(arg0))->VerticalChange;
+	rc = (jint)(TO_OBJECT_AS(DragDeltaEventArgs^, arg0))->VerticalChange;
 	OS_NATIVE_EXIT(env, that, DragDeltaEventArgs_1VerticalChange_FUNC);
 	return rc;
 }
@@ -3273,7 +3273,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DragEventArgs_1AllowedEffects)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DragEventArgs_1AllowedEffects_FUNC);
-	rc = (jint)((DragEventArgs^)TO_OBJECT(arg0))->AllowedEffects;
+	rc = (jint)(TO_OBJECT_AS(DragEventArgs^, arg0))->AllowedEffects;
 	OS_NATIVE_EXIT(env, that, DragEventArgs_1AllowedEffects_FUNC);
 	return rc;
 }
@@ -3286,7 +3286,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DragEventArgs_1Data)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DragEventArgs_1Data_FUNC);
-	rc = (jint)TO_HANDLE(((DragEventArgs^)TO_OBJECT(arg0))->Data);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(DragEventArgs^, arg0))->Data);
 	OS_NATIVE_EXIT(env, that, DragEventArgs_1Data_FUNC);
 	return rc;
 }
@@ -3299,7 +3299,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DragEventArgs_1Effects__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DragEventArgs_1Effects__I_FUNC);
-	rc = (jint)((DragEventArgs^)TO_OBJECT(arg0))->Effects;
+	rc = (jint)(TO_OBJECT_AS(DragEventArgs^, arg0))->Effects;
 	OS_NATIVE_EXIT(env, that, DragEventArgs_1Effects__I_FUNC);
 	return rc;
 }
@@ -3311,7 +3311,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DragEventArgs_1Effects__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, DragEventArgs_1Effects__II_FUNC);
-	((DragEventArgs^)TO_OBJECT(arg0))->Effects = ((DragDropEffects)arg1);
+	(TO_OBJECT_AS(DragEventArgs^, arg0))->Effects = ((DragDropEffects)arg1);
 	OS_NATIVE_EXIT(env, that, DragEventArgs_1Effects__II_FUNC);
 }
 #endif
@@ -3323,7 +3323,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DragEventArgs_1GetPosition)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DragEventArgs_1GetPosition_FUNC);
-	rc = (jint)TO_HANDLE(((DragEventArgs^)TO_OBJECT(arg0))->GetPosition((IInputElement^)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(DragEventArgs^, arg0))->GetPosition((IInputElement^)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, DragEventArgs_1GetPosition_FUNC);
 	return rc;
 }
@@ -3336,7 +3336,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DragEventArgs_1KeyStates)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DragEventArgs_1KeyStates_FUNC);
-	rc = (jint)((DragEventArgs^)TO_OBJECT(arg0))->KeyStates;
+	rc = (jint)(TO_OBJECT_AS(DragEventArgs^, arg0))->KeyStates;
 	OS_NATIVE_EXIT(env, that, DragEventArgs_1KeyStates_FUNC);
 	return rc;
 }
@@ -3362,7 +3362,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DrawingColor_1ToArgb)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DrawingColor_1ToArgb_FUNC);
-	rc = (jint)((System::Drawing::Color^)TO_OBJECT(arg0))->ToArgb();
+	rc = (jint)(TO_OBJECT_AS(System::Drawing::Color^, arg0))->ToArgb();
 	OS_NATIVE_EXIT(env, that, DrawingColor_1ToArgb_FUNC);
 	return rc;
 }
@@ -3374,7 +3374,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DrawingContext_1Close)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, DrawingContext_1Close_FUNC);
-	((DrawingContext^)TO_OBJECT(arg0))->Close();
+	(TO_OBJECT_AS(DrawingContext^, arg0))->Close();
 	OS_NATIVE_EXIT(env, that, DrawingContext_1Close_FUNC);
 }
 #endif
@@ -3385,7 +3385,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DrawingContext_1DrawDrawing)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, DrawingContext_1DrawDrawing_FUNC);
-	((DrawingContext^)TO_OBJECT(arg0))->DrawDrawing((System::Windows::Media::Drawing^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(DrawingContext^, arg0))->DrawDrawing((System::Windows::Media::Drawing^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, DrawingContext_1DrawDrawing_FUNC);
 }
 #endif
@@ -3396,7 +3396,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DrawingContext_1DrawEllipse)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jdouble arg4, jdouble arg5)
 {
 	OS_NATIVE_ENTER(env, that, DrawingContext_1DrawEllipse_FUNC);
-	((DrawingContext^)TO_OBJECT(arg0))->DrawEllipse((Brush^)TO_OBJECT(arg1), (Pen^)TO_OBJECT(arg2), (Point)TO_OBJECT(arg3), arg4, arg5);
+	(TO_OBJECT_AS(DrawingContext^, arg0))->DrawEllipse((Brush^)TO_OBJECT(arg1), (Pen^)TO_OBJECT(arg2), (Point)TO_OBJECT(arg3), arg4, arg5);
 	OS_NATIVE_EXIT(env, that, DrawingContext_1DrawEllipse_FUNC);
 }
 #endif
@@ -3407,7 +3407,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DrawingContext_1DrawGeometry)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3)
 {
 	OS_NATIVE_ENTER(env, that, DrawingContext_1DrawGeometry_FUNC);
-	((DrawingContext^)TO_OBJECT(arg0))->DrawGeometry((Brush^)TO_OBJECT(arg1), (Pen^)TO_OBJECT(arg2), (Geometry^)TO_OBJECT(arg3));
+	(TO_OBJECT_AS(DrawingContext^, arg0))->DrawGeometry((Brush^)TO_OBJECT(arg1), (Pen^)TO_OBJECT(arg2), (Geometry^)TO_OBJECT(arg3));
 	OS_NATIVE_EXIT(env, that, DrawingContext_1DrawGeometry_FUNC);
 }
 #endif
@@ -3418,7 +3418,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DrawingContext_1DrawImage)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, DrawingContext_1DrawImage_FUNC);
-	((DrawingContext^)TO_OBJECT(arg0))->DrawImage((ImageSource^)TO_OBJECT(arg1), (Rect)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(DrawingContext^, arg0))->DrawImage((ImageSource^)TO_OBJECT(arg1), (Rect)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, DrawingContext_1DrawImage_FUNC);
 }
 #endif
@@ -3429,7 +3429,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DrawingContext_1DrawLine)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3)
 {
 	OS_NATIVE_ENTER(env, that, DrawingContext_1DrawLine_FUNC);
-	((DrawingContext^)TO_OBJECT(arg0))->DrawLine((Pen^)TO_OBJECT(arg1), (Point)TO_OBJECT(arg2), (Point)TO_OBJECT(arg3));
+	(TO_OBJECT_AS(DrawingContext^, arg0))->DrawLine((Pen^)TO_OBJECT(arg1), (Point)TO_OBJECT(arg2), (Point)TO_OBJECT(arg3));
 	OS_NATIVE_EXIT(env, that, DrawingContext_1DrawLine_FUNC);
 }
 #endif
@@ -3440,7 +3440,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DrawingContext_1DrawRectangle)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3)
 {
 	OS_NATIVE_ENTER(env, that, DrawingContext_1DrawRectangle_FUNC);
-	((DrawingContext^)TO_OBJECT(arg0))->DrawRectangle((Brush^)TO_OBJECT(arg1), (Pen^)TO_OBJECT(arg2), (Rect)TO_OBJECT(arg3));
+	(TO_OBJECT_AS(DrawingContext^, arg0))->DrawRectangle((Brush^)TO_OBJECT(arg1), (Pen^)TO_OBJECT(arg2), (Rect)TO_OBJECT(arg3));
 	OS_NATIVE_EXIT(env, that, DrawingContext_1DrawRectangle_FUNC);
 }
 #endif
@@ -3451,7 +3451,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DrawingContext_1DrawRoundedRectangle)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3, jdouble arg4, jdouble arg5)
 {
 	OS_NATIVE_ENTER(env, that, DrawingContext_1DrawRoundedRectangle_FUNC);
-	((DrawingContext^)TO_OBJECT(arg0))->DrawRoundedRectangle((Brush^)TO_OBJECT(arg1), (Pen^)TO_OBJECT(arg2), (Rect)TO_OBJECT(arg3), arg4, arg5);
+	(TO_OBJECT_AS(DrawingContext^, arg0))->DrawRoundedRectangle((Brush^)TO_OBJECT(arg1), (Pen^)TO_OBJECT(arg2), (Rect)TO_OBJECT(arg3), arg4, arg5);
 	OS_NATIVE_EXIT(env, that, DrawingContext_1DrawRoundedRectangle_FUNC);
 }
 #endif
@@ -3462,7 +3462,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DrawingContext_1DrawText)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, DrawingContext_1DrawText_FUNC);
-	((DrawingContext^)TO_OBJECT(arg0))->DrawText((FormattedText^)TO_OBJECT(arg1), (Point)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(DrawingContext^, arg0))->DrawText((FormattedText^)TO_OBJECT(arg1), (Point)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, DrawingContext_1DrawText_FUNC);
 }
 #endif
@@ -3473,7 +3473,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DrawingContext_1Pop)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, DrawingContext_1Pop_FUNC);
-	((DrawingContext^)TO_OBJECT(arg0))->Pop();
+	(TO_OBJECT_AS(DrawingContext^, arg0))->Pop();
 	OS_NATIVE_EXIT(env, that, DrawingContext_1Pop_FUNC);
 }
 #endif
@@ -3484,7 +3484,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DrawingContext_1PushClip)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, DrawingContext_1PushClip_FUNC);
-	((DrawingContext^)TO_OBJECT(arg0))->PushClip((Geometry^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(DrawingContext^, arg0))->PushClip((Geometry^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, DrawingContext_1PushClip_FUNC);
 }
 #endif
@@ -3495,7 +3495,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DrawingContext_1PushOpacity)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, DrawingContext_1PushOpacity_FUNC);
-	((DrawingContext^)TO_OBJECT(arg0))->PushOpacity(arg1);
+	(TO_OBJECT_AS(DrawingContext^, arg0))->PushOpacity(arg1);
 	OS_NATIVE_EXIT(env, that, DrawingContext_1PushOpacity_FUNC);
 }
 #endif
@@ -3506,7 +3506,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DrawingContext_1PushTransform)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, DrawingContext_1PushTransform_FUNC);
-	((DrawingContext^)TO_OBJECT(arg0))->PushTransform((Transform^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(DrawingContext^, arg0))->PushTransform((Transform^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, DrawingContext_1PushTransform_FUNC);
 }
 #endif
@@ -3518,7 +3518,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DrawingFontFamily_1Name)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DrawingFontFamily_1Name_FUNC);
-	rc = (jint)TO_HANDLE(((System::Drawing::FontFamily^)TO_OBJECT(arg0))->Name);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Drawing::FontFamily^, arg0))->Name);
 	OS_NATIVE_EXIT(env, that, DrawingFontFamily_1Name_FUNC);
 	return rc;
 }
@@ -3531,7 +3531,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DrawingVisual_1Drawing)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DrawingVisual_1Drawing_FUNC);
-	rc = (jint)TO_HANDLE(((DrawingVisual^)TO_OBJECT(arg0))->Drawing);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(DrawingVisual^, arg0))->Drawing);
 	OS_NATIVE_EXIT(env, that, DrawingVisual_1Drawing_FUNC);
 	return rc;
 }
@@ -3544,7 +3544,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DrawingVisual_1RenderOpen)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DrawingVisual_1RenderOpen_FUNC);
-	rc = (jint)TO_HANDLE(((DrawingVisual^)TO_OBJECT(arg0))->RenderOpen());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(DrawingVisual^, arg0))->RenderOpen());
 	OS_NATIVE_EXIT(env, that, DrawingVisual_1RenderOpen_FUNC);
 	return rc;
 }
@@ -3570,7 +3570,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(DropShadowBitmapEffect_1Color__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, DropShadowBitmapEffect_1Color__I_FUNC);
-	rc = (jint)TO_HANDLE(((DropShadowBitmapEffect^)TO_OBJECT(arg0))->Color);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(DropShadowBitmapEffect^, arg0))->Color);
 	OS_NATIVE_EXIT(env, that, DropShadowBitmapEffect_1Color__I_FUNC);
 	return rc;
 }
@@ -3582,7 +3582,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DropShadowBitmapEffect_1Color__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, DropShadowBitmapEffect_1Color__II_FUNC);
-	((DropShadowBitmapEffect^)TO_OBJECT(arg0))->Color = ((Color)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(DropShadowBitmapEffect^, arg0))->Color = ((Color)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, DropShadowBitmapEffect_1Color__II_FUNC);
 }
 #endif
@@ -3594,7 +3594,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(DropShadowBitmapEffect_1Direction__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, DropShadowBitmapEffect_1Direction__I_FUNC);
-	rc = (jdouble)((DropShadowBitmapEffect^)TO_OBJECT(arg0))->Direction;
+	rc = (jdouble)(TO_OBJECT_AS(DropShadowBitmapEffect^, arg0))->Direction;
 	OS_NATIVE_EXIT(env, that, DropShadowBitmapEffect_1Direction__I_FUNC);
 	return rc;
 }
@@ -3606,7 +3606,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DropShadowBitmapEffect_1Direction__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, DropShadowBitmapEffect_1Direction__ID_FUNC);
-	((DropShadowBitmapEffect^)TO_OBJECT(arg0))->Direction = (arg1);
+	(TO_OBJECT_AS(DropShadowBitmapEffect^, arg0))->Direction = (arg1);
 	OS_NATIVE_EXIT(env, that, DropShadowBitmapEffect_1Direction__ID_FUNC);
 }
 #endif
@@ -3618,7 +3618,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(DropShadowBitmapEffect_1Opacity__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, DropShadowBitmapEffect_1Opacity__I_FUNC);
-	rc = (jdouble)((DropShadowBitmapEffect^)TO_OBJECT(arg0))->Opacity;
+	rc = (jdouble)(TO_OBJECT_AS(DropShadowBitmapEffect^, arg0))->Opacity;
 	OS_NATIVE_EXIT(env, that, DropShadowBitmapEffect_1Opacity__I_FUNC);
 	return rc;
 }
@@ -3630,7 +3630,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DropShadowBitmapEffect_1Opacity__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, DropShadowBitmapEffect_1Opacity__ID_FUNC);
-	((DropShadowBitmapEffect^)TO_OBJECT(arg0))->Opacity = (arg1);
+	(TO_OBJECT_AS(DropShadowBitmapEffect^, arg0))->Opacity = (arg1);
 	OS_NATIVE_EXIT(env, that, DropShadowBitmapEffect_1Opacity__ID_FUNC);
 }
 #endif
@@ -3642,7 +3642,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(DropShadowBitmapEffect_1ShadowDepth__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, DropShadowBitmapEffect_1ShadowDepth__I_FUNC);
-	rc = (jdouble)((DropShadowBitmapEffect^)TO_OBJECT(arg0))->ShadowDepth;
+	rc = (jdouble)(TO_OBJECT_AS(DropShadowBitmapEffect^, arg0))->ShadowDepth;
 	OS_NATIVE_EXIT(env, that, DropShadowBitmapEffect_1ShadowDepth__I_FUNC);
 	return rc;
 }
@@ -3654,7 +3654,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DropShadowBitmapEffect_1ShadowDepth__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, DropShadowBitmapEffect_1ShadowDepth__ID_FUNC);
-	((DropShadowBitmapEffect^)TO_OBJECT(arg0))->ShadowDepth = (arg1);
+	(TO_OBJECT_AS(DropShadowBitmapEffect^, arg0))->ShadowDepth = (arg1);
 	OS_NATIVE_EXIT(env, that, DropShadowBitmapEffect_1ShadowDepth__ID_FUNC);
 }
 #endif
@@ -3666,7 +3666,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(DropShadowBitmapEffect_1Softness__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, DropShadowBitmapEffect_1Softness__I_FUNC);
-	rc = (jdouble)((DropShadowBitmapEffect^)TO_OBJECT(arg0))->Softness;
+	rc = (jdouble)(TO_OBJECT_AS(DropShadowBitmapEffect^, arg0))->Softness;
 	OS_NATIVE_EXIT(env, that, DropShadowBitmapEffect_1Softness__I_FUNC);
 	return rc;
 }
@@ -3678,7 +3678,7 @@ JNIEXPORT void JNICALL OS_NATIVE(DropShadowBitmapEffect_1Softness__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, DropShadowBitmapEffect_1Softness__ID_FUNC);
-	((DropShadowBitmapEffect^)TO_OBJECT(arg0))->Softness = (arg1);
+	(TO_OBJECT_AS(DropShadowBitmapEffect^, arg0))->Softness = (arg1);
 	OS_NATIVE_EXIT(env, that, DropShadowBitmapEffect_1Softness__ID_FUNC);
 }
 #endif
@@ -3690,7 +3690,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Duration_1TimeSpan)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Duration_1TimeSpan_FUNC);
-	rc = (jint)TO_HANDLE(((Duration^)TO_OBJECT(arg0))->TimeSpan);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Duration^, arg0))->TimeSpan);
 	OS_NATIVE_EXIT(env, that, Duration_1TimeSpan_FUNC);
 	return rc;
 }
@@ -3768,7 +3768,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ExecutedRoutedEventArgs_1Command)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ExecutedRoutedEventArgs_1Command_FUNC);
-	rc = (jint)TO_HANDLE(((ExecutedRoutedEventArgs^)TO_OBJECT(arg0))->Command);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(ExecutedRoutedEventArgs^, arg0))->Command);
 	OS_NATIVE_EXIT(env, that, ExecutedRoutedEventArgs_1Command_FUNC);
 	return rc;
 }
@@ -3780,7 +3780,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ExecutedRoutedEventArgs_1Handled)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, ExecutedRoutedEventArgs_1Handled_FUNC);
-	((ExecutedRoutedEventArgs^)TO_OBJECT(arg0))->Handled = (arg1);
+	(TO_OBJECT_AS(ExecutedRoutedEventArgs^, arg0))->Handled = (arg1);
 	OS_NATIVE_EXIT(env, that, ExecutedRoutedEventArgs_1Handled_FUNC);
 }
 #endif
@@ -3791,7 +3791,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Expander_1Collapsed)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Expander_1Collapsed_FUNC);
-	((Expander^)TO_OBJECT(arg0))->Collapsed += ((RoutedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Expander^, arg0))->Collapsed += ((RoutedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Expander_1Collapsed_FUNC);
 }
 #endif
@@ -3802,7 +3802,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Expander_1Expanded)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Expander_1Expanded_FUNC);
-	((Expander^)TO_OBJECT(arg0))->Expanded += ((RoutedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Expander^, arg0))->Expanded += ((RoutedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Expander_1Expanded_FUNC);
 }
 #endif
@@ -3814,7 +3814,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Expander_1IsExpanded__I)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Expander_1IsExpanded__I_FUNC);
-	rc = (jboolean)((Expander^)TO_OBJECT(arg0))->IsExpanded;
+	rc = (jboolean)(TO_OBJECT_AS(Expander^, arg0))->IsExpanded;
 	OS_NATIVE_EXIT(env, that, Expander_1IsExpanded__I_FUNC);
 	return rc;
 }
@@ -3826,7 +3826,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Expander_1IsExpanded__IZ)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, Expander_1IsExpanded__IZ_FUNC);
-	((Expander^)TO_OBJECT(arg0))->IsExpanded = (arg1);
+	(TO_OBJECT_AS(Expander^, arg0))->IsExpanded = (arg1);
 	OS_NATIVE_EXIT(env, that, Expander_1IsExpanded__IZ_FUNC);
 }
 #endif
@@ -3837,7 +3837,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FileDialog_1FileName)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FileDialog_1FileName_FUNC);
-	((FileDialog^)TO_OBJECT(arg0))->FileName = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FileDialog^, arg0))->FileName = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FileDialog_1FileName_FUNC);
 }
 #endif
@@ -3849,7 +3849,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FileDialog_1FileNames)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FileDialog_1FileNames_FUNC);
-	rc = (jint)TO_HANDLE(((FileDialog^)TO_OBJECT(arg0))->FileNames);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FileDialog^, arg0))->FileNames);
 	OS_NATIVE_EXIT(env, that, FileDialog_1FileNames_FUNC);
 	return rc;
 }
@@ -3861,7 +3861,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FileDialog_1Filter)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FileDialog_1Filter_FUNC);
-	((FileDialog^)TO_OBJECT(arg0))->Filter = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FileDialog^, arg0))->Filter = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FileDialog_1Filter_FUNC);
 }
 #endif
@@ -3873,7 +3873,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FileDialog_1FilterIndex__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FileDialog_1FilterIndex__I_FUNC);
-	rc = (jint)((FileDialog^)TO_OBJECT(arg0))->FilterIndex;
+	rc = (jint)(TO_OBJECT_AS(FileDialog^, arg0))->FilterIndex;
 	OS_NATIVE_EXIT(env, that, FileDialog_1FilterIndex__I_FUNC);
 	return rc;
 }
@@ -3885,7 +3885,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FileDialog_1FilterIndex__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FileDialog_1FilterIndex__II_FUNC);
-	((FileDialog^)TO_OBJECT(arg0))->FilterIndex = (arg1);
+	(TO_OBJECT_AS(FileDialog^, arg0))->FilterIndex = (arg1);
 	OS_NATIVE_EXIT(env, that, FileDialog_1FilterIndex__II_FUNC);
 }
 #endif
@@ -3896,7 +3896,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FileDialog_1InitialDirectory)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FileDialog_1InitialDirectory_FUNC);
-	((FileDialog^)TO_OBJECT(arg0))->InitialDirectory = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FileDialog^, arg0))->InitialDirectory = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FileDialog_1InitialDirectory_FUNC);
 }
 #endif
@@ -3907,7 +3907,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FileDialog_1Title)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FileDialog_1Title_FUNC);
-	((FileDialog^)TO_OBJECT(arg0))->Title = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FileDialog^, arg0))->Title = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FileDialog_1Title_FUNC);
 }
 #endif
@@ -3919,7 +3919,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FileInfo_1DirectoryName)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FileInfo_1DirectoryName_FUNC);
-	rc = (jint)TO_HANDLE(((System::IO::FileInfo^)TO_OBJECT(arg0))->DirectoryName);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::IO::FileInfo^, arg0))->DirectoryName);
 	OS_NATIVE_EXIT(env, that, FileInfo_1DirectoryName_FUNC);
 	return rc;
 }
@@ -3932,7 +3932,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FileInfo_1Name)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FileInfo_1Name_FUNC);
-	rc = (jint)TO_HANDLE(((System::IO::FileInfo^)TO_OBJECT(arg0))->Name);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::IO::FileInfo^, arg0))->Name);
 	OS_NATIVE_EXIT(env, that, FileInfo_1Name_FUNC);
 	return rc;
 }
@@ -3996,7 +3996,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FolderBrowserDialog_1Description)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FolderBrowserDialog_1Description_FUNC);
-	((System::Windows::Forms::FolderBrowserDialog^)TO_OBJECT(arg0))->Description = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::FolderBrowserDialog^, arg0))->Description = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FolderBrowserDialog_1Description_FUNC);
 }
 #endif
@@ -4008,7 +4008,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FolderBrowserDialog_1SelectedPath__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FolderBrowserDialog_1SelectedPath__I_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::FolderBrowserDialog^)TO_OBJECT(arg0))->SelectedPath);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::FolderBrowserDialog^, arg0))->SelectedPath);
 	OS_NATIVE_EXIT(env, that, FolderBrowserDialog_1SelectedPath__I_FUNC);
 	return rc;
 }
@@ -4020,7 +4020,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FolderBrowserDialog_1SelectedPath__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FolderBrowserDialog_1SelectedPath__II_FUNC);
-	((System::Windows::Forms::FolderBrowserDialog^)TO_OBJECT(arg0))->SelectedPath = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::FolderBrowserDialog^, arg0))->SelectedPath = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FolderBrowserDialog_1SelectedPath__II_FUNC);
 }
 #endif
@@ -4032,7 +4032,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FontDialog_1Color__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FontDialog_1Color__I_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::FontDialog^)TO_OBJECT(arg0))->Color);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::FontDialog^, arg0))->Color);
 	OS_NATIVE_EXIT(env, that, FontDialog_1Color__I_FUNC);
 	return rc;
 }
@@ -4044,7 +4044,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FontDialog_1Color__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FontDialog_1Color__II_FUNC);
-	((System::Windows::Forms::FontDialog^)TO_OBJECT(arg0))->Color = ((System::Drawing::Color)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::FontDialog^, arg0))->Color = ((System::Drawing::Color)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FontDialog_1Color__II_FUNC);
 }
 #endif
@@ -4056,7 +4056,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FontDialog_1Font__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FontDialog_1Font__I_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::FontDialog^)TO_OBJECT(arg0))->Font);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::FontDialog^, arg0))->Font);
 	OS_NATIVE_EXIT(env, that, FontDialog_1Font__I_FUNC);
 	return rc;
 }
@@ -4068,7 +4068,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FontDialog_1Font__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FontDialog_1Font__II_FUNC);
-	((System::Windows::Forms::FontDialog^)TO_OBJECT(arg0))->Font = ((System::Drawing::Font^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::FontDialog^, arg0))->Font = ((System::Drawing::Font^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FontDialog_1Font__II_FUNC);
 }
 #endif
@@ -4079,7 +4079,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FontDialog_1ShowColor)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, FontDialog_1ShowColor_FUNC);
-	((System::Windows::Forms::FontDialog^)TO_OBJECT(arg0))->ShowColor = (arg1);
+	(TO_OBJECT_AS(System::Windows::Forms::FontDialog^, arg0))->ShowColor = (arg1);
 	OS_NATIVE_EXIT(env, that, FontDialog_1ShowColor_FUNC);
 }
 #endif
@@ -4091,7 +4091,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FontFamily_1GetTypefaces)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FontFamily_1GetTypefaces_FUNC);
-	rc = (jint)TO_HANDLE(((FontFamily^)TO_OBJECT(arg0))->GetTypefaces());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FontFamily^, arg0))->GetTypefaces());
 	OS_NATIVE_EXIT(env, that, FontFamily_1GetTypefaces_FUNC);
 	return rc;
 }
@@ -4104,7 +4104,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(FontFamily_1LineSpacing)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, FontFamily_1LineSpacing_FUNC);
-	rc = (jdouble)((FontFamily^)TO_OBJECT(arg0))->LineSpacing;
+	rc = (jdouble)(TO_OBJECT_AS(FontFamily^, arg0))->LineSpacing;
 	OS_NATIVE_EXIT(env, that, FontFamily_1LineSpacing_FUNC);
 	return rc;
 }
@@ -4117,7 +4117,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FontFamily_1Source)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FontFamily_1Source_FUNC);
-	rc = (jint)TO_HANDLE(((FontFamily^)TO_OBJECT(arg0))->Source);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FontFamily^, arg0))->Source);
 	OS_NATIVE_EXIT(env, that, FontFamily_1Source_FUNC);
 	return rc;
 }
@@ -4143,7 +4143,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FontStretch_1ToOpenTypeStretch)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FontStretch_1ToOpenTypeStretch_FUNC);
-	rc = (jint)((FontStretch^)TO_OBJECT(arg0))->ToOpenTypeStretch();
+	rc = (jint)(TO_OBJECT_AS(FontStretch^, arg0))->ToOpenTypeStretch();
 	OS_NATIVE_EXIT(env, that, FontStretch_1ToOpenTypeStretch_FUNC);
 	return rc;
 }
@@ -4221,7 +4221,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FontWeight_1ToOpenTypeWeight)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FontWeight_1ToOpenTypeWeight_FUNC);
-	rc = (jint)((FontWeight^)TO_OBJECT(arg0))->ToOpenTypeWeight();
+	rc = (jint)(TO_OBJECT_AS(FontWeight^, arg0))->ToOpenTypeWeight();
 	OS_NATIVE_EXIT(env, that, FontWeight_1ToOpenTypeWeight_FUNC);
 	return rc;
 }
@@ -4260,7 +4260,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Font_1FontFamily)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Font_1FontFamily_FUNC);
-	rc = (jint)TO_HANDLE(((System::Drawing::Font^)TO_OBJECT(arg0))->FontFamily);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Drawing::Font^, arg0))->FontFamily);
 	OS_NATIVE_EXIT(env, that, Font_1FontFamily_FUNC);
 	return rc;
 }
@@ -4273,7 +4273,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Font_1Size)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Font_1Size_FUNC);
-	rc = (jint)((System::Drawing::Font^)TO_OBJECT(arg0))->Size;
+	rc = (jint)(TO_OBJECT_AS(System::Drawing::Font^, arg0))->Size;
 	OS_NATIVE_EXIT(env, that, Font_1Size_FUNC);
 	return rc;
 }
@@ -4286,7 +4286,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Font_1Style)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Font_1Style_FUNC);
-	rc = (jint)((System::Drawing::Font^)TO_OBJECT(arg0))->Style;
+	rc = (jint)(TO_OBJECT_AS(System::Drawing::Font^, arg0))->Style;
 	OS_NATIVE_EXIT(env, that, Font_1Style_FUNC);
 	return rc;
 }
@@ -4325,7 +4325,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(FormattedText_1Baseline)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, FormattedText_1Baseline_FUNC);
-	rc = (jdouble)((FormattedText^)TO_OBJECT(arg0))->Baseline;
+	rc = (jdouble)(TO_OBJECT_AS(FormattedText^, arg0))->Baseline;
 	OS_NATIVE_EXIT(env, that, FormattedText_1Baseline_FUNC);
 	return rc;
 }
@@ -4338,7 +4338,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FormattedText_1BuildGeometry)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FormattedText_1BuildGeometry_FUNC);
-	rc = (jint)TO_HANDLE(((FormattedText^)TO_OBJECT(arg0))->BuildGeometry((Point)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FormattedText^, arg0))->BuildGeometry((Point)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, FormattedText_1BuildGeometry_FUNC);
 	return rc;
 }
@@ -4351,7 +4351,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FormattedText_1BuildHighlightGeometry)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FormattedText_1BuildHighlightGeometry_FUNC);
-	rc = (jint)TO_HANDLE(((FormattedText^)TO_OBJECT(arg0))->BuildHighlightGeometry((Point)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FormattedText^, arg0))->BuildHighlightGeometry((Point)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, FormattedText_1BuildHighlightGeometry_FUNC);
 	return rc;
 }
@@ -4364,7 +4364,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(FormattedText_1Height)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, FormattedText_1Height_FUNC);
-	rc = (jdouble)((FormattedText^)TO_OBJECT(arg0))->Height;
+	rc = (jdouble)(TO_OBJECT_AS(FormattedText^, arg0))->Height;
 	OS_NATIVE_EXIT(env, that, FormattedText_1Height_FUNC);
 	return rc;
 }
@@ -4376,7 +4376,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FormattedText_1SetTextDecorations)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3)
 {
 	OS_NATIVE_ENTER(env, that, FormattedText_1SetTextDecorations_FUNC);
-	((FormattedText^)TO_OBJECT(arg0))->SetTextDecorations((TextDecorationCollection^)TO_OBJECT(arg1), arg2, arg3);
+	(TO_OBJECT_AS(FormattedText^, arg0))->SetTextDecorations((TextDecorationCollection^)TO_OBJECT(arg1), arg2, arg3);
 	OS_NATIVE_EXIT(env, that, FormattedText_1SetTextDecorations_FUNC);
 }
 #endif
@@ -4388,7 +4388,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(FormattedText_1WidthIncludingTrailingWhitesp
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, FormattedText_1WidthIncludingTrailingWhitespace_FUNC);
-	rc = (jdouble)((FormattedText^)TO_OBJECT(arg0))->WidthIncludingTrailingWhitespace;
+	rc = (jdouble)(TO_OBJECT_AS(FormattedText^, arg0))->WidthIncludingTrailingWhitespace;
 	OS_NATIVE_EXIT(env, that, FormattedText_1WidthIncludingTrailingWhitespace_FUNC);
 	return rc;
 }
@@ -4401,7 +4401,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FormsCommonDialog_1ShowDialog)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FormsCommonDialog_1ShowDialog_FUNC);
-	rc = (jint)((System::Windows::Forms::CommonDialog^)TO_OBJECT(arg0))->ShowDialog();
+	rc = (jint)(TO_OBJECT_AS(System::Windows::Forms::CommonDialog^, arg0))->ShowDialog();
 	OS_NATIVE_EXIT(env, that, FormsCommonDialog_1ShowDialog_FUNC);
 	return rc;
 }
@@ -4414,7 +4414,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FormsMouseEventArgs_1Button)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FormsMouseEventArgs_1Button_FUNC);
-	rc = (jint)((System::Windows::Forms::MouseEventArgs^)TO_OBJECT(arg0))->Button;
+	rc = (jint)(TO_OBJECT_AS(System::Windows::Forms::MouseEventArgs^, arg0))->Button;
 	OS_NATIVE_EXIT(env, that, FormsMouseEventArgs_1Button_FUNC);
 	return rc;
 }
@@ -4427,7 +4427,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Frame_1CanGoBack)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Frame_1CanGoBack_FUNC);
-	rc = (jboolean)((Frame^)TO_OBJECT(arg0))->CanGoBack;
+	rc = (jboolean)(TO_OBJECT_AS(Frame^, arg0))->CanGoBack;
 	OS_NATIVE_EXIT(env, that, Frame_1CanGoBack_FUNC);
 	return rc;
 }
@@ -4440,7 +4440,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Frame_1CanGoForward)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Frame_1CanGoForward_FUNC);
-	rc = (jboolean)((Frame^)TO_OBJECT(arg0))->CanGoForward;
+	rc = (jboolean)(TO_OBJECT_AS(Frame^, arg0))->CanGoForward;
 	OS_NATIVE_EXIT(env, that, Frame_1CanGoForward_FUNC);
 	return rc;
 }
@@ -4453,7 +4453,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Frame_1CurrentSource)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Frame_1CurrentSource_FUNC);
-	rc = (jint)TO_HANDLE(((Frame^)TO_OBJECT(arg0))->CurrentSource);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Frame^, arg0))->CurrentSource);
 	OS_NATIVE_EXIT(env, that, Frame_1CurrentSource_FUNC);
 	return rc;
 }
@@ -4465,7 +4465,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Frame_1GoBack)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, Frame_1GoBack_FUNC);
-	((Frame^)TO_OBJECT(arg0))->GoBack();
+	(TO_OBJECT_AS(Frame^, arg0))->GoBack();
 	OS_NATIVE_EXIT(env, that, Frame_1GoBack_FUNC);
 }
 #endif
@@ -4476,7 +4476,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Frame_1GoForward)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, Frame_1GoForward_FUNC);
-	((Frame^)TO_OBJECT(arg0))->GoForward();
+	(TO_OBJECT_AS(Frame^, arg0))->GoForward();
 	OS_NATIVE_EXIT(env, that, Frame_1GoForward_FUNC);
 }
 #endif
@@ -4488,7 +4488,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Frame_1Navigate)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Frame_1Navigate_FUNC);
-	rc = (jboolean)((Frame^)TO_OBJECT(arg0))->Navigate((Uri^)TO_OBJECT(arg1));
+	rc = (jboolean)(TO_OBJECT_AS(Frame^, arg0))->Navigate((Uri^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Frame_1Navigate_FUNC);
 	return rc;
 }
@@ -4500,7 +4500,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Frame_1NavigationUIVisibility)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Frame_1NavigationUIVisibility_FUNC);
-	((Frame^)TO_OBJECT(arg0))->NavigationUIVisibility = ((System::Windows::Navigation::NavigationUIVisibility)arg1);
+	(TO_OBJECT_AS(Frame^, arg0))->NavigationUIVisibility = ((System::Windows::Navigation::NavigationUIVisibility)arg1);
 	OS_NATIVE_EXIT(env, that, Frame_1NavigationUIVisibility_FUNC);
 }
 #endif
@@ -4511,7 +4511,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Frame_1Refresh)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, Frame_1Refresh_FUNC);
-	((Frame^)TO_OBJECT(arg0))->Refresh();
+	(TO_OBJECT_AS(Frame^, arg0))->Refresh();
 	OS_NATIVE_EXIT(env, that, Frame_1Refresh_FUNC);
 }
 #endif
@@ -4523,7 +4523,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Frame_1Source__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Frame_1Source__I_FUNC);
-	rc = (jint)TO_HANDLE(((Frame^)TO_OBJECT(arg0))->Source);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Frame^, arg0))->Source);
 	OS_NATIVE_EXIT(env, that, Frame_1Source__I_FUNC);
 	return rc;
 }
@@ -4535,7 +4535,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Frame_1Source__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Frame_1Source__II_FUNC);
-	((Frame^)TO_OBJECT(arg0))->Source = ((Uri^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Frame^, arg0))->Source = ((Uri^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Frame_1Source__II_FUNC);
 }
 #endif
@@ -4546,7 +4546,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Frame_1StopLoading)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, Frame_1StopLoading_FUNC);
-	((Frame^)TO_OBJECT(arg0))->StopLoading();
+	(TO_OBJECT_AS(Frame^, arg0))->StopLoading();
 	OS_NATIVE_EXIT(env, that, Frame_1StopLoading_FUNC);
 }
 #endif
@@ -4558,7 +4558,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FrameworkContentElement_1Parent)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkContentElement_1Parent_FUNC);
-	rc = (jint)TO_HANDLE(((FrameworkContentElement^)TO_OBJECT(arg0))->Parent);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FrameworkContentElement^, arg0))->Parent);
 	OS_NATIVE_EXIT(env, that, FrameworkContentElement_1Parent_FUNC);
 	return rc;
 }
@@ -4571,7 +4571,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FrameworkContentElement_1Tag__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkContentElement_1Tag__I_FUNC);
-	rc = (jint)((FrameworkContentElement^)TO_OBJECT(arg0))->Tag;
+	rc = (jint)(TO_OBJECT_AS(FrameworkContentElement^, arg0))->Tag;
 	OS_NATIVE_EXIT(env, that, FrameworkContentElement_1Tag__I_FUNC);
 	return rc;
 }
@@ -4583,7 +4583,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkContentElement_1Tag__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkContentElement_1Tag__II_FUNC);
-	((FrameworkContentElement^)TO_OBJECT(arg0))->Tag = (arg1);
+	(TO_OBJECT_AS(FrameworkContentElement^, arg0))->Tag = (arg1);
 	OS_NATIVE_EXIT(env, that, FrameworkContentElement_1Tag__II_FUNC);
 }
 #endif
@@ -4607,7 +4607,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElementFactory_1AppendChild)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElementFactory_1AppendChild_FUNC);
-	((FrameworkElementFactory^)TO_OBJECT(arg0))->AppendChild((FrameworkElementFactory^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkElementFactory^, arg0))->AppendChild((FrameworkElementFactory^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkElementFactory_1AppendChild_FUNC);
 }
 #endif
@@ -4618,7 +4618,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElementFactory_1SetBinding)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElementFactory_1SetBinding_FUNC);
-	((FrameworkElementFactory^)TO_OBJECT(arg0))->SetBinding((DependencyProperty^)TO_OBJECT(arg1), (BindingBase^)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(FrameworkElementFactory^, arg0))->SetBinding((DependencyProperty^)TO_OBJECT(arg1), (BindingBase^)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, FrameworkElementFactory_1SetBinding_FUNC);
 }
 #endif
@@ -4629,7 +4629,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElementFactory_1SetValue__III)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElementFactory_1SetValue__III_FUNC);
-	((FrameworkElementFactory^)TO_OBJECT(arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (Object^)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(FrameworkElementFactory^, arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (Object^)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, FrameworkElementFactory_1SetValue__III_FUNC);
 }
 #endif
@@ -4640,7 +4640,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElementFactory_1SetValue__IIZ)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jboolean arg2)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElementFactory_1SetValue__IIZ_FUNC);
-	((FrameworkElementFactory^)TO_OBJECT(arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (Boolean)arg2);
+	(TO_OBJECT_AS(FrameworkElementFactory^, arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (Boolean)arg2);
 	OS_NATIVE_EXIT(env, that, FrameworkElementFactory_1SetValue__IIZ_FUNC);
 }
 #endif
@@ -4651,7 +4651,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElementFactory_1SetValueDock)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElementFactory_1SetValueDock_FUNC);
-	((FrameworkElementFactory^)TO_OBJECT(arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (Dock)arg2);
+	(TO_OBJECT_AS(FrameworkElementFactory^, arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (Dock)arg2);
 	OS_NATIVE_EXIT(env, that, FrameworkElementFactory_1SetValueDock_FUNC);
 }
 #endif
@@ -4662,7 +4662,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElementFactory_1SetValueInt)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElementFactory_1SetValueInt_FUNC);
-	((FrameworkElementFactory^)TO_OBJECT(arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), arg2);
+	(TO_OBJECT_AS(FrameworkElementFactory^, arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), arg2);
 	OS_NATIVE_EXIT(env, that, FrameworkElementFactory_1SetValueInt_FUNC);
 }
 #endif
@@ -4673,7 +4673,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElementFactory_1SetValueOrientation)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElementFactory_1SetValueOrientation_FUNC);
-	((FrameworkElementFactory^)TO_OBJECT(arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (Orientation)arg2);
+	(TO_OBJECT_AS(FrameworkElementFactory^, arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (Orientation)arg2);
 	OS_NATIVE_EXIT(env, that, FrameworkElementFactory_1SetValueOrientation_FUNC);
 }
 #endif
@@ -4684,7 +4684,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElementFactory_1SetValueStretch)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElementFactory_1SetValueStretch_FUNC);
-	((FrameworkElementFactory^)TO_OBJECT(arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (Stretch)arg2);
+	(TO_OBJECT_AS(FrameworkElementFactory^, arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (Stretch)arg2);
 	OS_NATIVE_EXIT(env, that, FrameworkElementFactory_1SetValueStretch_FUNC);
 }
 #endif
@@ -4695,7 +4695,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElementFactory_1SetValueVerticalAlignm
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElementFactory_1SetValueVerticalAlignment_FUNC);
-	((FrameworkElementFactory^)TO_OBJECT(arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (VerticalAlignment)arg2);
+	(TO_OBJECT_AS(FrameworkElementFactory^, arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (VerticalAlignment)arg2);
 	OS_NATIVE_EXIT(env, that, FrameworkElementFactory_1SetValueVerticalAlignment_FUNC);
 }
 #endif
@@ -4706,7 +4706,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElementFactory_1SetValueVisibility)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jbyte arg2)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElementFactory_1SetValueVisibility_FUNC);
-	((FrameworkElementFactory^)TO_OBJECT(arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (Visibility)arg2);
+	(TO_OBJECT_AS(FrameworkElementFactory^, arg0))->SetValue((DependencyProperty^)TO_OBJECT(arg1), (Visibility)arg2);
 	OS_NATIVE_EXIT(env, that, FrameworkElementFactory_1SetValueVisibility_FUNC);
 }
 #endif
@@ -4718,7 +4718,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(FrameworkElement_1ActualHeight)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1ActualHeight_FUNC);
-	rc = (jdouble)((FrameworkElement^)TO_OBJECT(arg0))->ActualHeight;
+	rc = (jdouble)(TO_OBJECT_AS(FrameworkElement^, arg0))->ActualHeight;
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1ActualHeight_FUNC);
 	return rc;
 }
@@ -4744,7 +4744,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(FrameworkElement_1ActualWidth)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1ActualWidth_FUNC);
-	rc = (jdouble)((FrameworkElement^)TO_OBJECT(arg0))->ActualWidth;
+	rc = (jdouble)(TO_OBJECT_AS(FrameworkElement^, arg0))->ActualWidth;
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1ActualWidth_FUNC);
 	return rc;
 }
@@ -4769,7 +4769,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1BeginInit)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1BeginInit_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->BeginInit();
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->BeginInit();
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1BeginInit_FUNC);
 }
 #endif
@@ -4780,7 +4780,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1BringIntoView)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1BringIntoView_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->BringIntoView();
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->BringIntoView();
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1BringIntoView_FUNC);
 }
 #endif
@@ -4791,7 +4791,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1ContextMenu)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1ContextMenu_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->ContextMenu = ((ContextMenu^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->ContextMenu = ((ContextMenu^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1ContextMenu_FUNC);
 }
 #endif
@@ -4802,7 +4802,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1ContextMenuClosing)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1ContextMenuClosing_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->ContextMenuClosing += ((ContextMenuEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->ContextMenuClosing += ((ContextMenuEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1ContextMenuClosing_FUNC);
 }
 #endif
@@ -4813,7 +4813,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1ContextMenuOpening)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1ContextMenuOpening_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->ContextMenuOpening += ((ContextMenuEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->ContextMenuOpening += ((ContextMenuEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1ContextMenuOpening_FUNC);
 }
 #endif
@@ -4824,7 +4824,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1Cursor)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Cursor_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->Cursor = ((Cursor^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->Cursor = ((Cursor^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Cursor_FUNC);
 }
 #endif
@@ -4849,7 +4849,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FrameworkElement_1FindResource)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1FindResource_FUNC);
-	rc = (jint)TO_HANDLE(((FrameworkElement^)TO_OBJECT(arg0))->FindResource((Object^)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FrameworkElement^, arg0))->FindResource((Object^)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1FindResource_FUNC);
 	return rc;
 }
@@ -4862,7 +4862,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FrameworkElement_1FlowDirection__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1FlowDirection__I_FUNC);
-	rc = (jint)((FrameworkElement^)TO_OBJECT(arg0))->FlowDirection;
+	rc = (jint)(TO_OBJECT_AS(FrameworkElement^, arg0))->FlowDirection;
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1FlowDirection__I_FUNC);
 	return rc;
 }
@@ -4874,7 +4874,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1FlowDirection__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1FlowDirection__II_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->FlowDirection = ((FlowDirection)arg1);
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->FlowDirection = ((FlowDirection)arg1);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1FlowDirection__II_FUNC);
 }
 #endif
@@ -4885,7 +4885,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1FocusVisualStyle)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1FocusVisualStyle_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->FocusVisualStyle = ((Style^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->FocusVisualStyle = ((Style^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1FocusVisualStyle_FUNC);
 }
 #endif
@@ -4897,7 +4897,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FrameworkElement_1GetBindingExpression)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1GetBindingExpression_FUNC);
-	rc = (jint)TO_HANDLE(((FrameworkElement^)TO_OBJECT(arg0))->GetBindingExpression((DependencyProperty^)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FrameworkElement^, arg0))->GetBindingExpression((DependencyProperty^)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1GetBindingExpression_FUNC);
 	return rc;
 }
@@ -4910,7 +4910,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(FrameworkElement_1Height__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Height__I_FUNC);
-	rc = (jdouble)((FrameworkElement^)TO_OBJECT(arg0))->Height;
+	rc = (jdouble)(TO_OBJECT_AS(FrameworkElement^, arg0))->Height;
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Height__I_FUNC);
 	return rc;
 }
@@ -4922,7 +4922,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1Height__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Height__ID_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->Height = (arg1);
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->Height = (arg1);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Height__ID_FUNC);
 }
 #endif
@@ -4946,7 +4946,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1HorizontalAlignment)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1HorizontalAlignment_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->HorizontalAlignment = ((HorizontalAlignment)arg1);
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->HorizontalAlignment = ((HorizontalAlignment)arg1);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1HorizontalAlignment_FUNC);
 }
 #endif
@@ -4958,7 +4958,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(FrameworkElement_1IsLoaded)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1IsLoaded_FUNC);
-	rc = (jboolean)((FrameworkElement^)TO_OBJECT(arg0))->IsLoaded;
+	rc = (jboolean)(TO_OBJECT_AS(FrameworkElement^, arg0))->IsLoaded;
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1IsLoaded_FUNC);
 	return rc;
 }
@@ -4970,7 +4970,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1LayoutTransform)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1LayoutTransform_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->LayoutTransform = ((Transform^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->LayoutTransform = ((Transform^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1LayoutTransform_FUNC);
 }
 #endif
@@ -4981,7 +4981,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1Loaded)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Loaded_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->Loaded += ((RoutedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->Loaded += ((RoutedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Loaded_FUNC);
 }
 #endif
@@ -4993,7 +4993,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FrameworkElement_1Margin__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Margin__I_FUNC);
-	rc = (jint)TO_HANDLE(((FrameworkElement^)TO_OBJECT(arg0))->Margin);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FrameworkElement^, arg0))->Margin);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Margin__I_FUNC);
 	return rc;
 }
@@ -5005,7 +5005,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1Margin__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Margin__II_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->Margin = ((Thickness)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->Margin = ((Thickness)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Margin__II_FUNC);
 }
 #endif
@@ -5030,7 +5030,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(FrameworkElement_1MaxHeight__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1MaxHeight__I_FUNC);
-	rc = (jdouble)((FrameworkElement^)TO_OBJECT(arg0))->MaxHeight;
+	rc = (jdouble)(TO_OBJECT_AS(FrameworkElement^, arg0))->MaxHeight;
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1MaxHeight__I_FUNC);
 	return rc;
 }
@@ -5042,7 +5042,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1MaxHeight__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1MaxHeight__ID_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->MaxHeight = (arg1);
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->MaxHeight = (arg1);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1MaxHeight__ID_FUNC);
 }
 #endif
@@ -5054,7 +5054,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(FrameworkElement_1MaxWidth__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1MaxWidth__I_FUNC);
-	rc = (jdouble)((FrameworkElement^)TO_OBJECT(arg0))->MaxWidth;
+	rc = (jdouble)(TO_OBJECT_AS(FrameworkElement^, arg0))->MaxWidth;
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1MaxWidth__I_FUNC);
 	return rc;
 }
@@ -5066,7 +5066,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1MaxWidth__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1MaxWidth__ID_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->MaxWidth = (arg1);
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->MaxWidth = (arg1);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1MaxWidth__ID_FUNC);
 }
 #endif
@@ -5078,7 +5078,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(FrameworkElement_1MinHeight__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1MinHeight__I_FUNC);
-	rc = (jdouble)((FrameworkElement^)TO_OBJECT(arg0))->MinHeight;
+	rc = (jdouble)(TO_OBJECT_AS(FrameworkElement^, arg0))->MinHeight;
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1MinHeight__I_FUNC);
 	return rc;
 }
@@ -5090,7 +5090,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1MinHeight__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1MinHeight__ID_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->MinHeight = (arg1);
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->MinHeight = (arg1);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1MinHeight__ID_FUNC);
 }
 #endif
@@ -5102,7 +5102,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(FrameworkElement_1MinWidth__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1MinWidth__I_FUNC);
-	rc = (jdouble)((FrameworkElement^)TO_OBJECT(arg0))->MinWidth;
+	rc = (jdouble)(TO_OBJECT_AS(FrameworkElement^, arg0))->MinWidth;
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1MinWidth__I_FUNC);
 	return rc;
 }
@@ -5114,7 +5114,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1MinWidth__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1MinWidth__ID_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->MinWidth = (arg1);
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->MinWidth = (arg1);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1MinWidth__ID_FUNC);
 }
 #endif
@@ -5126,7 +5126,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FrameworkElement_1Name)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Name_FUNC);
-	rc = (jint)TO_HANDLE(((FrameworkElement^)TO_OBJECT(arg0))->Name);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FrameworkElement^, arg0))->Name);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Name_FUNC);
 	return rc;
 }
@@ -5152,7 +5152,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FrameworkElement_1Parent)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Parent_FUNC);
-	rc = (jint)TO_HANDLE(((FrameworkElement^)TO_OBJECT(arg0))->Parent);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FrameworkElement^, arg0))->Parent);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Parent_FUNC);
 	return rc;
 }
@@ -5164,7 +5164,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1RegisterName)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1RegisterName_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->RegisterName((String^)TO_OBJECT(arg1), (Object^)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->RegisterName((String^)TO_OBJECT(arg1), (Object^)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1RegisterName_FUNC);
 }
 #endif
@@ -5176,7 +5176,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FrameworkElement_1RenderTransform__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1RenderTransform__I_FUNC);
-	rc = (jint)TO_HANDLE(((FrameworkElement^)TO_OBJECT(arg0))->RenderTransform);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FrameworkElement^, arg0))->RenderTransform);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1RenderTransform__I_FUNC);
 	return rc;
 }
@@ -5188,7 +5188,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1RenderTransform__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1RenderTransform__II_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->RenderTransform = ((Transform^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->RenderTransform = ((Transform^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1RenderTransform__II_FUNC);
 }
 #endif
@@ -5200,7 +5200,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FrameworkElement_1Resources__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Resources__I_FUNC);
-	rc = (jint)TO_HANDLE(((FrameworkElement^)TO_OBJECT(arg0))->Resources);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FrameworkElement^, arg0))->Resources);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Resources__I_FUNC);
 	return rc;
 }
@@ -5212,7 +5212,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1Resources__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Resources__II_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->Resources = ((ResourceDictionary^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->Resources = ((ResourceDictionary^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Resources__II_FUNC);
 }
 #endif
@@ -5223,7 +5223,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1SizeChanged)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1SizeChanged_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->SizeChanged += ((SizeChangedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->SizeChanged += ((SizeChangedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1SizeChanged_FUNC);
 }
 #endif
@@ -5248,7 +5248,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FrameworkElement_1Style__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Style__I_FUNC);
-	rc = (jint)TO_HANDLE(((FrameworkElement^)TO_OBJECT(arg0))->Style);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FrameworkElement^, arg0))->Style);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Style__I_FUNC);
 	return rc;
 }
@@ -5260,7 +5260,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1Style__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Style__II_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->Style = ((Style^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->Style = ((Style^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Style__II_FUNC);
 }
 #endif
@@ -5285,7 +5285,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FrameworkElement_1Tag__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Tag__I_FUNC);
-	rc = (jint)TO_HANDLE(((FrameworkElement^)TO_OBJECT(arg0))->Tag);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FrameworkElement^, arg0))->Tag);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Tag__I_FUNC);
 	return rc;
 }
@@ -5297,7 +5297,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1Tag__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Tag__II_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->Tag = ((Object^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->Tag = ((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Tag__II_FUNC);
 }
 #endif
@@ -5322,7 +5322,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FrameworkElement_1ToolTip__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1ToolTip__I_FUNC);
-	rc = (jint)TO_HANDLE(((FrameworkElement^)TO_OBJECT(arg0))->ToolTip);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FrameworkElement^, arg0))->ToolTip);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1ToolTip__I_FUNC);
 	return rc;
 }
@@ -5334,7 +5334,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1ToolTip__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1ToolTip__II_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->ToolTip = ((Object^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->ToolTip = ((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1ToolTip__II_FUNC);
 }
 #endif
@@ -5345,7 +5345,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1VerticalAlignment)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1VerticalAlignment_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->VerticalAlignment = ((VerticalAlignment)arg1);
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->VerticalAlignment = ((VerticalAlignment)arg1);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1VerticalAlignment_FUNC);
 }
 #endif
@@ -5370,7 +5370,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(FrameworkElement_1Width__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Width__I_FUNC);
-	rc = (jdouble)((FrameworkElement^)TO_OBJECT(arg0))->Width;
+	rc = (jdouble)(TO_OBJECT_AS(FrameworkElement^, arg0))->Width;
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Width__I_FUNC);
 	return rc;
 }
@@ -5382,7 +5382,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkElement_1Width__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkElement_1Width__ID_FUNC);
-	((FrameworkElement^)TO_OBJECT(arg0))->Width = (arg1);
+	(TO_OBJECT_AS(FrameworkElement^, arg0))->Width = (arg1);
 	OS_NATIVE_EXIT(env, that, FrameworkElement_1Width__ID_FUNC);
 }
 #endif
@@ -5420,7 +5420,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(FrameworkTemplate_1FindName)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, FrameworkTemplate_1FindName_FUNC);
-	rc = (jint)TO_HANDLE(((FrameworkTemplate^)TO_OBJECT(arg0))->FindName((String^)TO_OBJECT(arg1), (FrameworkElement^)TO_OBJECT(arg2)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(FrameworkTemplate^, arg0))->FindName((String^)TO_OBJECT(arg1), (FrameworkElement^)TO_OBJECT(arg2)));
 	OS_NATIVE_EXIT(env, that, FrameworkTemplate_1FindName_FUNC);
 	return rc;
 }
@@ -5432,7 +5432,7 @@ JNIEXPORT void JNICALL OS_NATIVE(FrameworkTemplate_1VisualTree)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, FrameworkTemplate_1VisualTree_FUNC);
-	((FrameworkTemplate^)TO_OBJECT(arg0))->VisualTree = ((FrameworkElementFactory^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(FrameworkTemplate^, arg0))->VisualTree = ((FrameworkElementFactory^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, FrameworkTemplate_1VisualTree_FUNC);
 }
 #endif
@@ -5444,7 +5444,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Freezable_1CanFreeze)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Freezable_1CanFreeze_FUNC);
-	rc = (jboolean)((Freezable^)TO_OBJECT(arg0))->CanFreeze;
+	rc = (jboolean)(TO_OBJECT_AS(Freezable^, arg0))->CanFreeze;
 	OS_NATIVE_EXIT(env, that, Freezable_1CanFreeze_FUNC);
 	return rc;
 }
@@ -5457,7 +5457,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Freezable_1Clone)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Freezable_1Clone_FUNC);
-	rc = (jint)TO_HANDLE(((Freezable^)TO_OBJECT(arg0))->Clone());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Freezable^, arg0))->Clone());
 	OS_NATIVE_EXIT(env, that, Freezable_1Clone_FUNC);
 	return rc;
 }
@@ -5469,7 +5469,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Freezable_1Freeze)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, Freezable_1Freeze_FUNC);
-	((Freezable^)TO_OBJECT(arg0))->Freeze();
+	(TO_OBJECT_AS(Freezable^, arg0))->Freeze();
 	OS_NATIVE_EXIT(env, that, Freezable_1Freeze_FUNC);
 }
 #endif
@@ -5480,7 +5480,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GeometryCollection_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, GeometryCollection_1Add_FUNC);
-	((GeometryCollection^)TO_OBJECT(arg0))->Add((Geometry^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(GeometryCollection^, arg0))->Add((Geometry^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, GeometryCollection_1Add_FUNC);
 }
 #endif
@@ -5491,7 +5491,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GeometryCollection_1Clear)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, GeometryCollection_1Clear_FUNC);
-	((GeometryCollection^)TO_OBJECT(arg0))->Clear();
+	(TO_OBJECT_AS(GeometryCollection^, arg0))->Clear();
 	OS_NATIVE_EXIT(env, that, GeometryCollection_1Clear_FUNC);
 }
 #endif
@@ -5503,7 +5503,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GeometryCollection_1Count)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, GeometryCollection_1Count_FUNC);
-	rc = (jint)((GeometryCollection^)TO_OBJECT(arg0))->Count;
+	rc = (jint)(TO_OBJECT_AS(GeometryCollection^, arg0))->Count;
 	OS_NATIVE_EXIT(env, that, GeometryCollection_1Count_FUNC);
 	return rc;
 }
@@ -5515,7 +5515,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GeometryCollection_1Remove)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, GeometryCollection_1Remove_FUNC);
-	((GeometryCollection^)TO_OBJECT(arg0))->Remove((Geometry^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(GeometryCollection^, arg0))->Remove((Geometry^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, GeometryCollection_1Remove_FUNC);
 }
 #endif
@@ -5527,7 +5527,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GeometryGroup_1Children__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, GeometryGroup_1Children__I_FUNC);
-	rc = (jint)TO_HANDLE(((GeometryGroup^)TO_OBJECT(arg0))->Children);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(GeometryGroup^, arg0))->Children);
 	OS_NATIVE_EXIT(env, that, GeometryGroup_1Children__I_FUNC);
 	return rc;
 }
@@ -5540,7 +5540,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GeometryGroup_1Children__II)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, GeometryGroup_1Children__II_FUNC);
-	rc = (jint)TO_HANDLE(((GeometryGroup^)TO_OBJECT(arg0))->Children[arg1]);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(GeometryGroup^, arg0))->Children[arg1]);
 	OS_NATIVE_EXIT(env, that, GeometryGroup_1Children__II_FUNC);
 	return rc;
 }
@@ -5553,7 +5553,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Geometry_1Bounds)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Geometry_1Bounds_FUNC);
-	rc = (jint)TO_HANDLE(((Geometry^)TO_OBJECT(arg0))->Bounds);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Geometry^, arg0))->Bounds);
 	OS_NATIVE_EXIT(env, that, Geometry_1Bounds_FUNC);
 	return rc;
 }
@@ -5566,7 +5566,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Geometry_1Clone)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Geometry_1Clone_FUNC);
-	rc = (jint)TO_HANDLE(((Geometry^)TO_OBJECT(arg0))->Clone());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Geometry^, arg0))->Clone());
 	OS_NATIVE_EXIT(env, that, Geometry_1Clone_FUNC);
 	return rc;
 }
@@ -5579,7 +5579,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Geometry_1FillContains)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Geometry_1FillContains_FUNC);
-	rc = (jboolean)((Geometry^)TO_OBJECT(arg0))->FillContains((Point)TO_OBJECT(arg1));
+	rc = (jboolean)(TO_OBJECT_AS(Geometry^, arg0))->FillContains((Point)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Geometry_1FillContains_FUNC);
 	return rc;
 }
@@ -5592,7 +5592,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Geometry_1FillContainsWithDetail)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Geometry_1FillContainsWithDetail_FUNC);
-	rc = (jint)((Geometry^)TO_OBJECT(arg0))->FillContainsWithDetail((Geometry^)TO_OBJECT(arg1));
+	rc = (jint)(TO_OBJECT_AS(Geometry^, arg0))->FillContainsWithDetail((Geometry^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Geometry_1FillContainsWithDetail_FUNC);
 	return rc;
 }
@@ -5605,7 +5605,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Geometry_1GetFlattenedPathGeometry__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Geometry_1GetFlattenedPathGeometry__I_FUNC);
-	rc = (jint)TO_HANDLE(((Geometry^)TO_OBJECT(arg0))->GetFlattenedPathGeometry());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Geometry^, arg0))->GetFlattenedPathGeometry());
 	OS_NATIVE_EXIT(env, that, Geometry_1GetFlattenedPathGeometry__I_FUNC);
 	return rc;
 }
@@ -5618,7 +5618,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Geometry_1GetFlattenedPathGeometry__IDI)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Geometry_1GetFlattenedPathGeometry__IDI_FUNC);
-	rc = (jint)TO_HANDLE(((Geometry^)TO_OBJECT(arg0))->GetFlattenedPathGeometry(arg1, (ToleranceType)arg2));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Geometry^, arg0))->GetFlattenedPathGeometry(arg1, (ToleranceType)arg2));
 	OS_NATIVE_EXIT(env, that, Geometry_1GetFlattenedPathGeometry__IDI_FUNC);
 	return rc;
 }
@@ -5631,7 +5631,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Geometry_1IsEmpty)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Geometry_1IsEmpty_FUNC);
-	rc = (jboolean)((Geometry^)TO_OBJECT(arg0))->IsEmpty();
+	rc = (jboolean)(TO_OBJECT_AS(Geometry^, arg0))->IsEmpty();
 	OS_NATIVE_EXIT(env, that, Geometry_1IsEmpty_FUNC);
 	return rc;
 }
@@ -5644,7 +5644,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Geometry_1StrokeContains)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Geometry_1StrokeContains_FUNC);
-	rc = (jboolean)((Geometry^)TO_OBJECT(arg0))->StrokeContains((Pen^)TO_OBJECT(arg1), (Point)TO_OBJECT(arg2));
+	rc = (jboolean)(TO_OBJECT_AS(Geometry^, arg0))->StrokeContains((Pen^)TO_OBJECT(arg1), (Point)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, Geometry_1StrokeContains_FUNC);
 	return rc;
 }
@@ -5657,7 +5657,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Geometry_1Transform__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Geometry_1Transform__I_FUNC);
-	rc = (jint)TO_HANDLE(((Geometry^)TO_OBJECT(arg0))->Transform);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Geometry^, arg0))->Transform);
 	OS_NATIVE_EXIT(env, that, Geometry_1Transform__I_FUNC);
 	return rc;
 }
@@ -5669,7 +5669,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Geometry_1Transform__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Geometry_1Transform__II_FUNC);
-	((Geometry^)TO_OBJECT(arg0))->Transform = ((Transform^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Geometry^, arg0))->Transform = ((Transform^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Geometry_1Transform__II_FUNC);
 }
 #endif
@@ -5681,7 +5681,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GiveFeedbackEventArgs_1Effects)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, GiveFeedbackEventArgs_1Effects_FUNC);
-	rc = (jint)((GiveFeedbackEventArgs^)TO_OBJECT(arg0))->Effects;
+	rc = (jint)(TO_OBJECT_AS(GiveFeedbackEventArgs^, arg0))->Effects;
 	OS_NATIVE_EXIT(env, that, GiveFeedbackEventArgs_1Effects_FUNC);
 	return rc;
 }
@@ -5694,7 +5694,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GlyphRun_1BidiLevel)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, GlyphRun_1BidiLevel_FUNC);
-	rc = (jint)((GlyphRun^)TO_OBJECT(arg0))->BidiLevel;
+	rc = (jint)(TO_OBJECT_AS(GlyphRun^, arg0))->BidiLevel;
 	OS_NATIVE_EXIT(env, that, GlyphRun_1BidiLevel_FUNC);
 	return rc;
 }
@@ -5706,7 +5706,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GradientBrush_1MappingMode)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, GradientBrush_1MappingMode_FUNC);
-	((GradientBrush^)TO_OBJECT(arg0))->MappingMode = ((BrushMappingMode)arg1);
+	(TO_OBJECT_AS(GradientBrush^, arg0))->MappingMode = ((BrushMappingMode)arg1);
 	OS_NATIVE_EXIT(env, that, GradientBrush_1MappingMode_FUNC);
 }
 #endif
@@ -5717,7 +5717,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GradientBrush_1SpreadMethod)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, GradientBrush_1SpreadMethod_FUNC);
-	((GradientBrush^)TO_OBJECT(arg0))->SpreadMethod = ((GradientSpreadMethod)arg1);
+	(TO_OBJECT_AS(GradientBrush^, arg0))->SpreadMethod = ((GradientSpreadMethod)arg1);
 	OS_NATIVE_EXIT(env, that, GradientBrush_1SpreadMethod_FUNC);
 }
 #endif
@@ -5728,7 +5728,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GridViewColumnCollection_1Clear)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, GridViewColumnCollection_1Clear_FUNC);
-	((GridViewColumnCollection^)TO_OBJECT(arg0))->Clear();
+	(TO_OBJECT_AS(GridViewColumnCollection^, arg0))->Clear();
 	OS_NATIVE_EXIT(env, that, GridViewColumnCollection_1Clear_FUNC);
 }
 #endif
@@ -5740,7 +5740,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GridViewColumnCollection_1Count)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, GridViewColumnCollection_1Count_FUNC);
-	rc = (jint)((GridViewColumnCollection^)TO_OBJECT(arg0))->Count;
+	rc = (jint)(TO_OBJECT_AS(GridViewColumnCollection^, arg0))->Count;
 	OS_NATIVE_EXIT(env, that, GridViewColumnCollection_1Count_FUNC);
 	return rc;
 }
@@ -5753,7 +5753,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GridViewColumnCollection_1IndexOf)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, GridViewColumnCollection_1IndexOf_FUNC);
-	rc = (jint)((GridViewColumnCollection ^)TO_OBJECT(arg0))->IndexOf((GridViewColumn^)TO_OBJECT(arg1));
+	rc = (jint)(TO_OBJECT_AS(GridViewColumnCollection ^, arg0))->IndexOf((GridViewColumn^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, GridViewColumnCollection_1IndexOf_FUNC);
 	return rc;
 }
@@ -5765,7 +5765,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GridViewColumnCollection_1Insert)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, GridViewColumnCollection_1Insert_FUNC);
-	((GridViewColumnCollection^)TO_OBJECT(arg0))->Insert(arg1, (GridViewColumn^)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(GridViewColumnCollection^, arg0))->Insert(arg1, (GridViewColumn^)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, GridViewColumnCollection_1Insert_FUNC);
 }
 #endif
@@ -5777,7 +5777,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(GridViewColumnCollection_1Remove)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, GridViewColumnCollection_1Remove_FUNC);
-	rc = (jboolean)((GridViewColumnCollection^)TO_OBJECT(arg0))->Remove((GridViewColumn^)TO_OBJECT(arg1));
+	rc = (jboolean)(TO_OBJECT_AS(GridViewColumnCollection^, arg0))->Remove((GridViewColumn^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, GridViewColumnCollection_1Remove_FUNC);
 	return rc;
 }
@@ -5790,7 +5790,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GridViewColumnCollection_1default)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, GridViewColumnCollection_1default_FUNC);
-	rc = (jint)TO_HANDLE(((GridViewColumnCollection^)TO_OBJECT(arg0))->default[arg1]);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(GridViewColumnCollection^, arg0))->default[arg1]);
 	OS_NATIVE_EXIT(env, that, GridViewColumnCollection_1default_FUNC);
 	return rc;
 }
@@ -5802,7 +5802,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GridViewColumnHeader_1Content)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, GridViewColumnHeader_1Content_FUNC);
-	((GridViewColumnHeader^)TO_OBJECT(arg0))->Content = ((Object^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(GridViewColumnHeader^, arg0))->Content = ((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, GridViewColumnHeader_1Content_FUNC);
 }
 #endif
@@ -5814,7 +5814,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(GridViewColumn_1ActualWidth)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, GridViewColumn_1ActualWidth_FUNC);
-	rc = (jdouble)((GridViewColumn^)TO_OBJECT(arg0))->ActualWidth;
+	rc = (jdouble)(TO_OBJECT_AS(GridViewColumn^, arg0))->ActualWidth;
 	OS_NATIVE_EXIT(env, that, GridViewColumn_1ActualWidth_FUNC);
 	return rc;
 }
@@ -5827,7 +5827,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GridViewColumn_1CellTemplate__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, GridViewColumn_1CellTemplate__I_FUNC);
-	rc = (jint)TO_HANDLE(((GridViewColumn^)TO_OBJECT(arg0))->CellTemplate);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(GridViewColumn^, arg0))->CellTemplate);
 	OS_NATIVE_EXIT(env, that, GridViewColumn_1CellTemplate__I_FUNC);
 	return rc;
 }
@@ -5839,7 +5839,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GridViewColumn_1CellTemplate__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, GridViewColumn_1CellTemplate__II_FUNC);
-	((GridViewColumn^)TO_OBJECT(arg0))->CellTemplate = ((DataTemplate^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(GridViewColumn^, arg0))->CellTemplate = ((DataTemplate^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, GridViewColumn_1CellTemplate__II_FUNC);
 }
 #endif
@@ -5851,7 +5851,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GridViewColumn_1Header__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, GridViewColumn_1Header__I_FUNC);
-	rc = (jint)TO_HANDLE(((GridViewColumn^)TO_OBJECT(arg0))->Header);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(GridViewColumn^, arg0))->Header);
 	OS_NATIVE_EXIT(env, that, GridViewColumn_1Header__I_FUNC);
 	return rc;
 }
@@ -5863,7 +5863,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GridViewColumn_1Header__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, GridViewColumn_1Header__II_FUNC);
-	((GridViewColumn^)TO_OBJECT(arg0))->Header = ((Object^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(GridViewColumn^, arg0))->Header = ((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, GridViewColumn_1Header__II_FUNC);
 }
 #endif
@@ -5875,7 +5875,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GridViewColumn_1HeaderTemplate__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, GridViewColumn_1HeaderTemplate__I_FUNC);
-	rc = (jint)TO_HANDLE(((GridViewColumn^)TO_OBJECT(arg0))->HeaderTemplate);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(GridViewColumn^, arg0))->HeaderTemplate);
 	OS_NATIVE_EXIT(env, that, GridViewColumn_1HeaderTemplate__I_FUNC);
 	return rc;
 }
@@ -5887,7 +5887,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GridViewColumn_1HeaderTemplate__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, GridViewColumn_1HeaderTemplate__II_FUNC);
-	((GridViewColumn^)TO_OBJECT(arg0))->HeaderTemplate = ((DataTemplate^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(GridViewColumn^, arg0))->HeaderTemplate = ((DataTemplate^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, GridViewColumn_1HeaderTemplate__II_FUNC);
 }
 #endif
@@ -5899,7 +5899,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(GridViewColumn_1Width__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, GridViewColumn_1Width__I_FUNC);
-	rc = (jdouble)((GridViewColumn^)TO_OBJECT(arg0))->Width;
+	rc = (jdouble)(TO_OBJECT_AS(GridViewColumn^, arg0))->Width;
 	OS_NATIVE_EXIT(env, that, GridViewColumn_1Width__I_FUNC);
 	return rc;
 }
@@ -5911,7 +5911,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GridViewColumn_1Width__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, GridViewColumn_1Width__ID_FUNC);
-	((GridViewColumn^)TO_OBJECT(arg0))->Width = (arg1);
+	(TO_OBJECT_AS(GridViewColumn^, arg0))->Width = (arg1);
 	OS_NATIVE_EXIT(env, that, GridViewColumn_1Width__ID_FUNC);
 }
 #endif
@@ -5948,7 +5948,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GridViewRowPresenterBase_1Columns)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, GridViewRowPresenterBase_1Columns_FUNC);
-	((GridViewRowPresenterBase^)TO_OBJECT(arg0))->Columns = ((GridViewColumnCollection^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(GridViewRowPresenterBase^, arg0))->Columns = ((GridViewColumnCollection^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, GridViewRowPresenterBase_1Columns_FUNC);
 }
 #endif
@@ -5973,7 +5973,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GridViewRowPresenter_1Content__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, GridViewRowPresenter_1Content__I_FUNC);
-	rc = (jint)TO_HANDLE(((GridViewRowPresenter^)TO_OBJECT(arg0))->Content);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(GridViewRowPresenter^, arg0))->Content);
 	OS_NATIVE_EXIT(env, that, GridViewRowPresenter_1Content__I_FUNC);
 	return rc;
 }
@@ -5985,7 +5985,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GridViewRowPresenter_1Content__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, GridViewRowPresenter_1Content__II_FUNC);
-	((GridViewRowPresenter^)TO_OBJECT(arg0))->Content = ((Object^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(GridViewRowPresenter^, arg0))->Content = ((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, GridViewRowPresenter_1Content__II_FUNC);
 }
 #endif
@@ -6009,7 +6009,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GridView_1AllowsColumnReorder)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, GridView_1AllowsColumnReorder_FUNC);
-	((GridView^)TO_OBJECT(arg0))->AllowsColumnReorder = (arg1);
+	(TO_OBJECT_AS(GridView^, arg0))->AllowsColumnReorder = (arg1);
 	OS_NATIVE_EXIT(env, that, GridView_1AllowsColumnReorder_FUNC);
 }
 #endif
@@ -6020,7 +6020,7 @@ JNIEXPORT void JNICALL OS_NATIVE(GridView_1ColumnHeaderContainerStyle)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, GridView_1ColumnHeaderContainerStyle_FUNC);
-	((GridView^)TO_OBJECT(arg0))->ColumnHeaderContainerStyle = ((Style^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(GridView^, arg0))->ColumnHeaderContainerStyle = ((Style^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, GridView_1ColumnHeaderContainerStyle_FUNC);
 }
 #endif
@@ -6032,7 +6032,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(GridView_1Columns)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, GridView_1Columns_FUNC);
-	rc = (jint)TO_HANDLE(((GridView^)TO_OBJECT(arg0))->Columns);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(GridView^, arg0))->Columns);
 	OS_NATIVE_EXIT(env, that, GridView_1Columns_FUNC);
 	return rc;
 }
@@ -6045,7 +6045,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Grid_1ColumnDefinitions)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Grid_1ColumnDefinitions_FUNC);
-	rc = (jint)TO_HANDLE(((Grid^)TO_OBJECT(arg0))->ColumnDefinitions);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Grid^, arg0))->ColumnDefinitions);
 	OS_NATIVE_EXIT(env, that, Grid_1ColumnDefinitions_FUNC);
 	return rc;
 }
@@ -6058,7 +6058,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Grid_1RowDefinitions)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Grid_1RowDefinitions_FUNC);
-	rc = (jint)TO_HANDLE(((Grid^)TO_OBJECT(arg0))->RowDefinitions);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Grid^, arg0))->RowDefinitions);
 	OS_NATIVE_EXIT(env, that, Grid_1RowDefinitions_FUNC);
 	return rc;
 }
@@ -6115,7 +6115,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(HeaderedContentControl_1Header__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, HeaderedContentControl_1Header__I_FUNC);
-	rc = (jint)TO_HANDLE(((HeaderedContentControl^)TO_OBJECT(arg0))->Header);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(HeaderedContentControl^, arg0))->Header);
 	OS_NATIVE_EXIT(env, that, HeaderedContentControl_1Header__I_FUNC);
 	return rc;
 }
@@ -6127,7 +6127,7 @@ JNIEXPORT void JNICALL OS_NATIVE(HeaderedContentControl_1Header__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, HeaderedContentControl_1Header__II_FUNC);
-	((HeaderedContentControl^)TO_OBJECT(arg0))->Header = ((Object^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(HeaderedContentControl^, arg0))->Header = ((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, HeaderedContentControl_1Header__II_FUNC);
 }
 #endif
@@ -6139,7 +6139,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(HeaderedItemsControl_1Header__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, HeaderedItemsControl_1Header__I_FUNC);
-	rc = (jint)TO_HANDLE(((HeaderedItemsControl^)TO_OBJECT(arg0))->Header);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(HeaderedItemsControl^, arg0))->Header);
 	OS_NATIVE_EXIT(env, that, HeaderedItemsControl_1Header__I_FUNC);
 	return rc;
 }
@@ -6151,7 +6151,7 @@ JNIEXPORT void JNICALL OS_NATIVE(HeaderedItemsControl_1Header__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, HeaderedItemsControl_1Header__II_FUNC);
-	((HeaderedItemsControl^)TO_OBJECT(arg0))->Header = ((Object^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(HeaderedItemsControl^, arg0))->Header = ((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, HeaderedItemsControl_1Header__II_FUNC);
 }
 #endif
@@ -6176,7 +6176,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(HtmlDocument_1InvokeScript)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, HtmlDocument_1InvokeScript_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::HtmlDocument^)TO_OBJECT(arg0))->InvokeScript((String^)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::HtmlDocument^, arg0))->InvokeScript((String^)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, HtmlDocument_1InvokeScript_FUNC);
 	return rc;
 }
@@ -6189,7 +6189,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(HwndSource_1CompositionTarget)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, HwndSource_1CompositionTarget_FUNC);
-	rc = (jint)TO_HANDLE(((HwndSource^)TO_OBJECT(arg0))->CompositionTarget);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(HwndSource^, arg0))->CompositionTarget);
 	OS_NATIVE_EXIT(env, that, HwndSource_1CompositionTarget_FUNC);
 	return rc;
 }
@@ -6202,7 +6202,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(HwndSource_1Handle)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, HwndSource_1Handle_FUNC);
-	rc = (jint)TO_HANDLE(((HwndSource^)TO_OBJECT(arg0))->Handle);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(HwndSource^, arg0))->Handle);
 	OS_NATIVE_EXIT(env, that, HwndSource_1Handle_FUNC);
 	return rc;
 }
@@ -6214,7 +6214,7 @@ JNIEXPORT void JNICALL OS_NATIVE(HwndTarget_1BackgroundColor)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, HwndTarget_1BackgroundColor_FUNC);
-	((HwndTarget^)TO_OBJECT(arg0))->BackgroundColor = ((Color)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(HwndTarget^, arg0))->BackgroundColor = ((Color)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, HwndTarget_1BackgroundColor_FUNC);
 }
 #endif
@@ -6225,7 +6225,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Hyperlink_1Click)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Hyperlink_1Click_FUNC);
-	((Hyperlink^)TO_OBJECT(arg0))->Click += ((RoutedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Hyperlink^, arg0))->Click += ((RoutedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Hyperlink_1Click_FUNC);
 }
 #endif
@@ -6237,7 +6237,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ICollection_1Count)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ICollection_1Count_FUNC);
-	rc = (jint)((ICollection^)TO_OBJECT(arg0))->Count;
+	rc = (jint)(TO_OBJECT_AS(ICollection^, arg0))->Count;
 	OS_NATIVE_EXIT(env, that, ICollection_1Count_FUNC);
 	return rc;
 }
@@ -6250,7 +6250,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(IEnumerable_1GetEnumerator)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, IEnumerable_1GetEnumerator_FUNC);
-	rc = (jint)TO_HANDLE(((IEnumerable ^)TO_OBJECT(arg0))->GetEnumerator());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(IEnumerable ^, arg0))->GetEnumerator());
 	OS_NATIVE_EXIT(env, that, IEnumerable_1GetEnumerator_FUNC);
 	return rc;
 }
@@ -6263,7 +6263,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(IEnumerator_1Current)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, IEnumerator_1Current_FUNC);
-	rc = (jint)TO_HANDLE(((IEnumerator^)TO_OBJECT(arg0))->Current);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(IEnumerator^, arg0))->Current);
 	OS_NATIVE_EXIT(env, that, IEnumerator_1Current_FUNC);
 	return rc;
 }
@@ -6276,7 +6276,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(IEnumerator_1MoveNext)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, IEnumerator_1MoveNext_FUNC);
-	rc = (jboolean)((IEnumerator^)TO_OBJECT(arg0))->MoveNext();
+	rc = (jboolean)(TO_OBJECT_AS(IEnumerator^, arg0))->MoveNext();
 	OS_NATIVE_EXIT(env, that, IEnumerator_1MoveNext_FUNC);
 	return rc;
 }
@@ -6288,7 +6288,7 @@ JNIEXPORT void JNICALL OS_NATIVE(IList_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, IList_1Add_FUNC);
-	((IList^)TO_OBJECT(arg0))->Add((Object^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(IList^, arg0))->Add((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, IList_1Add_FUNC);
 }
 #endif
@@ -6299,7 +6299,7 @@ JNIEXPORT void JNICALL OS_NATIVE(IList_1Clear)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, IList_1Clear_FUNC);
-	((IList^)TO_OBJECT(arg0))->Clear();
+	(TO_OBJECT_AS(IList^, arg0))->Clear();
 	OS_NATIVE_EXIT(env, that, IList_1Clear_FUNC);
 }
 #endif
@@ -6311,7 +6311,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(IList_1GetEnumerator)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, IList_1GetEnumerator_FUNC);
-	rc = (jint)TO_HANDLE(((IList^)TO_OBJECT(arg0))->GetEnumerator());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(IList^, arg0))->GetEnumerator());
 	OS_NATIVE_EXIT(env, that, IList_1GetEnumerator_FUNC);
 	return rc;
 }
@@ -6324,7 +6324,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(IList_1IndexOf)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, IList_1IndexOf_FUNC);
-	rc = (jint)((IList^)TO_OBJECT(arg0))->IndexOf((Object^)TO_OBJECT(arg1));
+	rc = (jint)(TO_OBJECT_AS(IList^, arg0))->IndexOf((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, IList_1IndexOf_FUNC);
 	return rc;
 }
@@ -6336,7 +6336,7 @@ JNIEXPORT void JNICALL OS_NATIVE(IList_1Insert)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, IList_1Insert_FUNC);
-	((IList^)TO_OBJECT(arg0))->Insert(arg1, (Object^)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(IList^, arg0))->Insert(arg1, (Object^)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, IList_1Insert_FUNC);
 }
 #endif
@@ -6347,7 +6347,7 @@ JNIEXPORT void JNICALL OS_NATIVE(IList_1Remove)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, IList_1Remove_FUNC);
-	((IList^)TO_OBJECT(arg0))->Remove((Object^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(IList^, arg0))->Remove((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, IList_1Remove_FUNC);
 }
 #endif
@@ -6359,7 +6359,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(IList_1default)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, IList_1default_FUNC);
-	rc = (jint)TO_HANDLE(((IList^)TO_OBJECT(arg0))->default[arg1]);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(IList^, arg0))->default[arg1]);
 	OS_NATIVE_EXIT(env, that, IList_1default_FUNC);
 	return rc;
 }
@@ -6385,7 +6385,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Image_1Source__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Image_1Source__I_FUNC);
-	rc = (jint)TO_HANDLE(((Image^)TO_OBJECT(arg0))->Source);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Image^, arg0))->Source);
 	OS_NATIVE_EXIT(env, that, Image_1Source__I_FUNC);
 	return rc;
 }
@@ -6397,7 +6397,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Image_1Source__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Image_1Source__II_FUNC);
-	((Image^)TO_OBJECT(arg0))->Source = ((ImageSource^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Image^, arg0))->Source = ((ImageSource^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Image_1Source__II_FUNC);
 }
 #endif
@@ -6421,7 +6421,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Image_1Stretch)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Image_1Stretch_FUNC);
-	((Image^)TO_OBJECT(arg0))->Stretch = ((Stretch)arg1);
+	(TO_OBJECT_AS(Image^, arg0))->Stretch = ((Stretch)arg1);
 	OS_NATIVE_EXIT(env, that, Image_1Stretch_FUNC);
 }
 #endif
@@ -6472,7 +6472,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(IndexedGlyphRunCollection_1Current)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, IndexedGlyphRunCollection_1Current_FUNC);
-	rc = (jint)TO_HANDLE(((IEnumerator^)TO_OBJECT(arg0))->Current);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(IEnumerator^, arg0))->Current);
 	OS_NATIVE_EXIT(env, that, IndexedGlyphRunCollection_1Current_FUNC);
 	return rc;
 }
@@ -6485,7 +6485,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(IndexedGlyphRunCollection_1GetEnumerator)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, IndexedGlyphRunCollection_1GetEnumerator_FUNC);
-	rc = (jint)TO_HANDLE(((IEnumerable^)TO_OBJECT(arg0))->GetEnumerator());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(IEnumerable^, arg0))->GetEnumerator());
 	OS_NATIVE_EXIT(env, that, IndexedGlyphRunCollection_1GetEnumerator_FUNC);
 	return rc;
 }
@@ -6498,7 +6498,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(IndexedGlyphRun_1GlyphRun)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, IndexedGlyphRun_1GlyphRun_FUNC);
-	rc = (jint)TO_HANDLE(((IndexedGlyphRun^)TO_OBJECT(arg0))->GlyphRun);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(IndexedGlyphRun^, arg0))->GlyphRun);
 	OS_NATIVE_EXIT(env, that, IndexedGlyphRun_1GlyphRun_FUNC);
 	return rc;
 }
@@ -6511,7 +6511,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(IndexedGlyphRun_1TextSourceCharacterIndex)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, IndexedGlyphRun_1TextSourceCharacterIndex_FUNC);
-	rc = (jint)((IndexedGlyphRun^)TO_OBJECT(arg0))->TextSourceCharacterIndex;
+	rc = (jint)(TO_OBJECT_AS(IndexedGlyphRun^, arg0))->TextSourceCharacterIndex;
 	OS_NATIVE_EXIT(env, that, IndexedGlyphRun_1TextSourceCharacterIndex_FUNC);
 	return rc;
 }
@@ -6524,7 +6524,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(IndexedGlyphRun_1TextSourceLength)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, IndexedGlyphRun_1TextSourceLength_FUNC);
-	rc = (jint)((IndexedGlyphRun^)TO_OBJECT(arg0))->TextSourceLength;
+	rc = (jint)(TO_OBJECT_AS(IndexedGlyphRun^, arg0))->TextSourceLength;
 	OS_NATIVE_EXIT(env, that, IndexedGlyphRun_1TextSourceLength_FUNC);
 	return rc;
 }
@@ -6536,7 +6536,7 @@ JNIEXPORT void JNICALL OS_NATIVE(InlineCollection_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, InlineCollection_1Add_FUNC);
-	((InlineCollection^)TO_OBJECT(arg0))->Add((Inline^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(InlineCollection^, arg0))->Add((Inline^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, InlineCollection_1Add_FUNC);
 }
 #endif
@@ -6547,7 +6547,7 @@ JNIEXPORT void JNICALL OS_NATIVE(InlineCollection_1Clear)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, InlineCollection_1Clear_FUNC);
-	((InlineCollection^)TO_OBJECT(arg0))->Clear();
+	(TO_OBJECT_AS(InlineCollection^, arg0))->Clear();
 	OS_NATIVE_EXIT(env, that, InlineCollection_1Clear_FUNC);
 }
 #endif
@@ -6559,7 +6559,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(InputEventArgs_1Timestamp)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, InputEventArgs_1Timestamp_FUNC);
-	rc = (jint)((InputEventArgs^)TO_OBJECT(arg0))->Timestamp;
+	rc = (jint)(TO_OBJECT_AS(InputEventArgs^, arg0))->Timestamp;
 	OS_NATIVE_EXIT(env, that, InputEventArgs_1Timestamp_FUNC);
 	return rc;
 }
@@ -6572,7 +6572,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Int32AnimationUsingKeyFrames_1KeyFrames)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Int32AnimationUsingKeyFrames_1KeyFrames_FUNC);
-	rc = (jint)TO_HANDLE(((Int32AnimationUsingKeyFrames^)TO_OBJECT(arg0))->KeyFrames);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Int32AnimationUsingKeyFrames^, arg0))->KeyFrames);
 	OS_NATIVE_EXIT(env, that, Int32AnimationUsingKeyFrames_1KeyFrames_FUNC);
 	return rc;
 }
@@ -6585,7 +6585,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Int32Animation_1From__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Int32Animation_1From__I_FUNC);
-	rc = (jint)((Int32Animation^)TO_OBJECT(arg0))->From;
+	rc = (jint)(TO_OBJECT_AS(Int32Animation^, arg0))->From;
 	OS_NATIVE_EXIT(env, that, Int32Animation_1From__I_FUNC);
 	return rc;
 }
@@ -6597,7 +6597,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Int32Animation_1From__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Int32Animation_1From__II_FUNC);
-	((Int32Animation^)TO_OBJECT(arg0))->From = (arg1);
+	(TO_OBJECT_AS(Int32Animation^, arg0))->From = (arg1);
 	OS_NATIVE_EXIT(env, that, Int32Animation_1From__II_FUNC);
 }
 #endif
@@ -6609,7 +6609,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Int32Animation_1To__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Int32Animation_1To__I_FUNC);
-	rc = (jint)((Int32Animation^)TO_OBJECT(arg0))->To;
+	rc = (jint)(TO_OBJECT_AS(Int32Animation^, arg0))->To;
 	OS_NATIVE_EXIT(env, that, Int32Animation_1To__I_FUNC);
 	return rc;
 }
@@ -6621,7 +6621,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Int32Animation_1To__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Int32Animation_1To__II_FUNC);
-	((Int32Animation^)TO_OBJECT(arg0))->To = (arg1);
+	(TO_OBJECT_AS(Int32Animation^, arg0))->To = (arg1);
 	OS_NATIVE_EXIT(env, that, Int32Animation_1To__II_FUNC);
 }
 #endif
@@ -6632,7 +6632,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Int32KeyFrame_1KeyTime)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Int32KeyFrame_1KeyTime_FUNC);
-	((Int32KeyFrame^)TO_OBJECT(arg0))->KeyTime = ((KeyTime)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Int32KeyFrame^, arg0))->KeyTime = ((KeyTime)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Int32KeyFrame_1KeyTime_FUNC);
 }
 #endif
@@ -6643,7 +6643,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Int32KeyFrame_1Value)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Int32KeyFrame_1Value_FUNC);
-	((Int32KeyFrame^)TO_OBJECT(arg0))->Value = (arg1);
+	(TO_OBJECT_AS(Int32KeyFrame^, arg0))->Value = (arg1);
 	OS_NATIVE_EXIT(env, that, Int32KeyFrame_1Value_FUNC);
 }
 #endif
@@ -6668,7 +6668,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(IntPtr_1ToInt32)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, IntPtr_1ToInt32_FUNC);
-	rc = (jint)((IntPtr^)TO_OBJECT(arg0))->ToInt32();
+	rc = (jint)(TO_OBJECT_AS(IntPtr^, arg0))->ToInt32();
 	OS_NATIVE_EXIT(env, that, IntPtr_1ToInt32_FUNC);
 	return rc;
 }
@@ -6680,7 +6680,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ItemCollection_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ItemCollection_1Add_FUNC);
-	((ItemCollection^)TO_OBJECT(arg0))->Add((Object^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ItemCollection^, arg0))->Add((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ItemCollection_1Add_FUNC);
 }
 #endif
@@ -6691,7 +6691,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ItemCollection_1Clear)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, ItemCollection_1Clear_FUNC);
-	((ItemCollection^)TO_OBJECT(arg0))->Clear();
+	(TO_OBJECT_AS(ItemCollection^, arg0))->Clear();
 	OS_NATIVE_EXIT(env, that, ItemCollection_1Clear_FUNC);
 }
 #endif
@@ -6703,7 +6703,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ItemCollection_1Count)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ItemCollection_1Count_FUNC);
-	rc = (jint)((ItemCollection^)TO_OBJECT(arg0))->Count;
+	rc = (jint)(TO_OBJECT_AS(ItemCollection^, arg0))->Count;
 	OS_NATIVE_EXIT(env, that, ItemCollection_1Count_FUNC);
 	return rc;
 }
@@ -6716,7 +6716,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ItemCollection_1CurrentItem)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ItemCollection_1CurrentItem_FUNC);
-	rc = (jint)TO_HANDLE(((ItemCollection^)TO_OBJECT(arg0))->CurrentItem);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(ItemCollection^, arg0))->CurrentItem);
 	OS_NATIVE_EXIT(env, that, ItemCollection_1CurrentItem_FUNC);
 	return rc;
 }
@@ -6729,7 +6729,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ItemCollection_1CurrentPosition)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ItemCollection_1CurrentPosition_FUNC);
-	rc = (jint)((ItemCollection^)TO_OBJECT(arg0))->CurrentPosition;
+	rc = (jint)(TO_OBJECT_AS(ItemCollection^, arg0))->CurrentPosition;
 	OS_NATIVE_EXIT(env, that, ItemCollection_1CurrentPosition_FUNC);
 	return rc;
 }
@@ -6742,7 +6742,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ItemCollection_1GetItemAt)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ItemCollection_1GetItemAt_FUNC);
-	rc = (jint)TO_HANDLE(((ItemCollection^)TO_OBJECT(arg0))->GetItemAt(arg1));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(ItemCollection^, arg0))->GetItemAt(arg1));
 	OS_NATIVE_EXIT(env, that, ItemCollection_1GetItemAt_FUNC);
 	return rc;
 }
@@ -6755,7 +6755,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ItemCollection_1IndexOf)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ItemCollection_1IndexOf_FUNC);
-	rc = (jint)((ItemCollection^)TO_OBJECT(arg0))->IndexOf((Object^)TO_OBJECT(arg1));
+	rc = (jint)(TO_OBJECT_AS(ItemCollection^, arg0))->IndexOf((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ItemCollection_1IndexOf_FUNC);
 	return rc;
 }
@@ -6767,7 +6767,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ItemCollection_1Insert)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, ItemCollection_1Insert_FUNC);
-	((ItemCollection^)TO_OBJECT(arg0))->Insert(arg1, (Object^)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(ItemCollection^, arg0))->Insert(arg1, (Object^)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, ItemCollection_1Insert_FUNC);
 }
 #endif
@@ -6778,7 +6778,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ItemCollection_1Remove)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ItemCollection_1Remove_FUNC);
-	((ItemCollection^)TO_OBJECT(arg0))->Remove((Object^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ItemCollection^, arg0))->Remove((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ItemCollection_1Remove_FUNC);
 }
 #endif
@@ -6789,7 +6789,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ItemCollection_1RemoveAt)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ItemCollection_1RemoveAt_FUNC);
-	((ItemCollection^)TO_OBJECT(arg0))->RemoveAt(arg1);
+	(TO_OBJECT_AS(ItemCollection^, arg0))->RemoveAt(arg1);
 	OS_NATIVE_EXIT(env, that, ItemCollection_1RemoveAt_FUNC);
 }
 #endif
@@ -6801,7 +6801,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ItemsControl_1HasItems)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, ItemsControl_1HasItems_FUNC);
-	rc = (jboolean)((ItemsControl^)TO_OBJECT(arg0))->HasItems;
+	rc = (jboolean)(TO_OBJECT_AS(ItemsControl^, arg0))->HasItems;
 	OS_NATIVE_EXIT(env, that, ItemsControl_1HasItems_FUNC);
 	return rc;
 }
@@ -6813,7 +6813,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ItemsControl_1IsTextSearchEnabled)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, ItemsControl_1IsTextSearchEnabled_FUNC);
-	((ItemsControl^)TO_OBJECT(arg0))->IsTextSearchEnabled = (arg1);
+	(TO_OBJECT_AS(ItemsControl^, arg0))->IsTextSearchEnabled = (arg1);
 	OS_NATIVE_EXIT(env, that, ItemsControl_1IsTextSearchEnabled_FUNC);
 }
 #endif
@@ -6825,7 +6825,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ItemsControl_1ItemTemplate__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ItemsControl_1ItemTemplate__I_FUNC);
-	rc = (jint)TO_HANDLE(((ItemsControl^)TO_OBJECT(arg0))->ItemTemplate);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(ItemsControl^, arg0))->ItemTemplate);
 	OS_NATIVE_EXIT(env, that, ItemsControl_1ItemTemplate__I_FUNC);
 	return rc;
 }
@@ -6837,7 +6837,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ItemsControl_1ItemTemplate__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ItemsControl_1ItemTemplate__II_FUNC);
-	((ItemsControl^)TO_OBJECT(arg0))->ItemTemplate = ((DataTemplate^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ItemsControl^, arg0))->ItemTemplate = ((DataTemplate^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ItemsControl_1ItemTemplate__II_FUNC);
 }
 #endif
@@ -6849,7 +6849,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ItemsControl_1Items)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ItemsControl_1Items_FUNC);
-	rc = (jint)TO_HANDLE(((ItemsControl^)TO_OBJECT(arg0))->Items);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(ItemsControl^, arg0))->Items);
 	OS_NATIVE_EXIT(env, that, ItemsControl_1Items_FUNC);
 	return rc;
 }
@@ -6861,7 +6861,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ItemsControl_1ItemsSource)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ItemsControl_1ItemsSource_FUNC);
-	((ItemsControl^)TO_OBJECT(arg0))->ItemsSource = ((IEnumerable^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ItemsControl^, arg0))->ItemsSource = ((IEnumerable^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ItemsControl_1ItemsSource_FUNC);
 }
 #endif
@@ -6886,7 +6886,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(KeyEventArgs_1IsDown)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, KeyEventArgs_1IsDown_FUNC);
-	rc = (jboolean)((KeyEventArgs^)TO_OBJECT(arg0))->IsDown;
+	rc = (jboolean)(TO_OBJECT_AS(KeyEventArgs^, arg0))->IsDown;
 	OS_NATIVE_EXIT(env, that, KeyEventArgs_1IsDown_FUNC);
 	return rc;
 }
@@ -6899,7 +6899,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(KeyEventArgs_1IsRepeat)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, KeyEventArgs_1IsRepeat_FUNC);
-	rc = (jboolean)((KeyEventArgs^)TO_OBJECT(arg0))->IsRepeat;
+	rc = (jboolean)(TO_OBJECT_AS(KeyEventArgs^, arg0))->IsRepeat;
 	OS_NATIVE_EXIT(env, that, KeyEventArgs_1IsRepeat_FUNC);
 	return rc;
 }
@@ -6912,7 +6912,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(KeyEventArgs_1IsToggled)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, KeyEventArgs_1IsToggled_FUNC);
-	rc = (jboolean)((KeyEventArgs^)TO_OBJECT(arg0))->IsToggled;
+	rc = (jboolean)(TO_OBJECT_AS(KeyEventArgs^, arg0))->IsToggled;
 	OS_NATIVE_EXIT(env, that, KeyEventArgs_1IsToggled_FUNC);
 	return rc;
 }
@@ -6925,7 +6925,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(KeyEventArgs_1Key)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, KeyEventArgs_1Key_FUNC);
-	rc = (jint)((KeyEventArgs^)TO_OBJECT(arg0))->Key;
+	rc = (jint)(TO_OBJECT_AS(KeyEventArgs^, arg0))->Key;
 	OS_NATIVE_EXIT(env, that, KeyEventArgs_1Key_FUNC);
 	return rc;
 }
@@ -6938,7 +6938,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(KeyEventArgs_1SystemKey)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, KeyEventArgs_1SystemKey_FUNC);
-	rc = (jint)((KeyEventArgs^)TO_OBJECT(arg0))->SystemKey;
+	rc = (jint)(TO_OBJECT_AS(KeyEventArgs^, arg0))->SystemKey;
 	OS_NATIVE_EXIT(env, that, KeyEventArgs_1SystemKey_FUNC);
 	return rc;
 }
@@ -6990,7 +6990,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(KeyboardDevice_1Modifiers)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, KeyboardDevice_1Modifiers_FUNC);
-	rc = (jint)((KeyboardDevice^)TO_OBJECT(arg0))->Modifiers;
+	rc = (jint)(TO_OBJECT_AS(KeyboardDevice^, arg0))->Modifiers;
 	OS_NATIVE_EXIT(env, that, KeyboardDevice_1Modifiers_FUNC);
 	return rc;
 }
@@ -7003,7 +7003,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(KeyboardEventArgs_1KeyboardDevice)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, KeyboardEventArgs_1KeyboardDevice_FUNC);
-	rc = (jint)TO_HANDLE(((KeyboardEventArgs^)TO_OBJECT(arg0))->KeyboardDevice);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(KeyboardEventArgs^, arg0))->KeyboardDevice);
 	OS_NATIVE_EXIT(env, that, KeyboardEventArgs_1KeyboardDevice_FUNC);
 	return rc;
 }
@@ -7112,7 +7112,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ListBoxItem_1IsSelected__I)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, ListBoxItem_1IsSelected__I_FUNC);
-	rc = (jboolean)((ListBoxItem^)TO_OBJECT(arg0))->IsSelected;
+	rc = (jboolean)(TO_OBJECT_AS(ListBoxItem^, arg0))->IsSelected;
 	OS_NATIVE_EXIT(env, that, ListBoxItem_1IsSelected__I_FUNC);
 	return rc;
 }
@@ -7124,7 +7124,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ListBoxItem_1IsSelected__IZ)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, ListBoxItem_1IsSelected__IZ_FUNC);
-	((ListBoxItem^)TO_OBJECT(arg0))->IsSelected = (arg1);
+	(TO_OBJECT_AS(ListBoxItem^, arg0))->IsSelected = (arg1);
 	OS_NATIVE_EXIT(env, that, ListBoxItem_1IsSelected__IZ_FUNC);
 }
 #endif
@@ -7135,7 +7135,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ListBox_1ScrollIntoView)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ListBox_1ScrollIntoView_FUNC);
-	((ListBox^)TO_OBJECT(arg0))->ScrollIntoView((Object^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ListBox^, arg0))->ScrollIntoView((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ListBox_1ScrollIntoView_FUNC);
 }
 #endif
@@ -7146,7 +7146,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ListBox_1SelectAll)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, ListBox_1SelectAll_FUNC);
-	((ListBox^)TO_OBJECT(arg0))->SelectAll();
+	(TO_OBJECT_AS(ListBox^, arg0))->SelectAll();
 	OS_NATIVE_EXIT(env, that, ListBox_1SelectAll_FUNC);
 }
 #endif
@@ -7158,7 +7158,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ListBox_1SelectedItems)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ListBox_1SelectedItems_FUNC);
-	rc = (jint)TO_HANDLE(((ListBox^)TO_OBJECT(arg0))->SelectedItems);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(ListBox^, arg0))->SelectedItems);
 	OS_NATIVE_EXIT(env, that, ListBox_1SelectedItems_FUNC);
 	return rc;
 }
@@ -7170,7 +7170,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ListBox_1SelectionMode)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ListBox_1SelectionMode_FUNC);
-	((ListBox^)TO_OBJECT(arg0))->SelectionMode = ((SelectionMode)arg1);
+	(TO_OBJECT_AS(ListBox^, arg0))->SelectionMode = ((SelectionMode)arg1);
 	OS_NATIVE_EXIT(env, that, ListBox_1SelectionMode_FUNC);
 }
 #endif
@@ -7181,7 +7181,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ListBox_1UnselectAll)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, ListBox_1UnselectAll_FUNC);
-	((ListBox^)TO_OBJECT(arg0))->UnselectAll();
+	(TO_OBJECT_AS(ListBox^, arg0))->UnselectAll();
 	OS_NATIVE_EXIT(env, that, ListBox_1UnselectAll_FUNC);
 }
 #endif
@@ -7205,7 +7205,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ListView_1View)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ListView_1View_FUNC);
-	((ListView^)TO_OBJECT(arg0))->View = ((ViewBase^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ListView^, arg0))->View = ((ViewBase^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ListView_1View_FUNC);
 }
 #endif
@@ -7217,7 +7217,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MatrixTransform_1Matrix__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, MatrixTransform_1Matrix__I_FUNC);
-	rc = (jint)TO_HANDLE(((MatrixTransform^)TO_OBJECT(arg0))->Matrix);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(MatrixTransform^, arg0))->Matrix);
 	OS_NATIVE_EXIT(env, that, MatrixTransform_1Matrix__I_FUNC);
 	return rc;
 }
@@ -7229,7 +7229,7 @@ JNIEXPORT void JNICALL OS_NATIVE(MatrixTransform_1Matrix__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, MatrixTransform_1Matrix__II_FUNC);
-	((MatrixTransform^)TO_OBJECT(arg0))->Matrix = ((Matrix)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(MatrixTransform^, arg0))->Matrix = ((Matrix)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, MatrixTransform_1Matrix__II_FUNC);
 }
 #endif
@@ -7240,7 +7240,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Matrix_1Invert)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, Matrix_1Invert_FUNC);
-	((Matrix^)TO_OBJECT(arg0))->Invert();
+	(TO_OBJECT_AS(Matrix^, arg0))->Invert();
 	OS_NATIVE_EXIT(env, that, Matrix_1Invert_FUNC);
 }
 #endif
@@ -7252,7 +7252,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Matrix_1IsIdentity)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Matrix_1IsIdentity_FUNC);
-	rc = (jboolean)((Matrix^)TO_OBJECT(arg0))->IsIdentity;
+	rc = (jboolean)(TO_OBJECT_AS(Matrix^, arg0))->IsIdentity;
 	OS_NATIVE_EXIT(env, that, Matrix_1IsIdentity_FUNC);
 	return rc;
 }
@@ -7265,7 +7265,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Matrix_1M11__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Matrix_1M11__I_FUNC);
-	rc = (jdouble)((Matrix^)TO_OBJECT(arg0))->M11;
+	rc = (jdouble)(TO_OBJECT_AS(Matrix^, arg0))->M11;
 	OS_NATIVE_EXIT(env, that, Matrix_1M11__I_FUNC);
 	return rc;
 }
@@ -7277,7 +7277,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Matrix_1M11__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Matrix_1M11__ID_FUNC);
-	((Matrix^)TO_OBJECT(arg0))->M11 = (arg1);
+	(TO_OBJECT_AS(Matrix^, arg0))->M11 = (arg1);
 	OS_NATIVE_EXIT(env, that, Matrix_1M11__ID_FUNC);
 }
 #endif
@@ -7289,7 +7289,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Matrix_1M12__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Matrix_1M12__I_FUNC);
-	rc = (jdouble)((Matrix^)TO_OBJECT(arg0))->M12;
+	rc = (jdouble)(TO_OBJECT_AS(Matrix^, arg0))->M12;
 	OS_NATIVE_EXIT(env, that, Matrix_1M12__I_FUNC);
 	return rc;
 }
@@ -7301,7 +7301,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Matrix_1M12__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Matrix_1M12__ID_FUNC);
-	((Matrix^)TO_OBJECT(arg0))->M12 = (arg1);
+	(TO_OBJECT_AS(Matrix^, arg0))->M12 = (arg1);
 	OS_NATIVE_EXIT(env, that, Matrix_1M12__ID_FUNC);
 }
 #endif
@@ -7313,7 +7313,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Matrix_1M21__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Matrix_1M21__I_FUNC);
-	rc = (jdouble)((Matrix^)TO_OBJECT(arg0))->M21;
+	rc = (jdouble)(TO_OBJECT_AS(Matrix^, arg0))->M21;
 	OS_NATIVE_EXIT(env, that, Matrix_1M21__I_FUNC);
 	return rc;
 }
@@ -7325,7 +7325,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Matrix_1M21__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Matrix_1M21__ID_FUNC);
-	((Matrix^)TO_OBJECT(arg0))->M21 = (arg1);
+	(TO_OBJECT_AS(Matrix^, arg0))->M21 = (arg1);
 	OS_NATIVE_EXIT(env, that, Matrix_1M21__ID_FUNC);
 }
 #endif
@@ -7337,7 +7337,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Matrix_1M22__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Matrix_1M22__I_FUNC);
-	rc = (jdouble)((Matrix^)TO_OBJECT(arg0))->M22;
+	rc = (jdouble)(TO_OBJECT_AS(Matrix^, arg0))->M22;
 	OS_NATIVE_EXIT(env, that, Matrix_1M22__I_FUNC);
 	return rc;
 }
@@ -7349,7 +7349,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Matrix_1M22__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Matrix_1M22__ID_FUNC);
-	((Matrix^)TO_OBJECT(arg0))->M22 = (arg1);
+	(TO_OBJECT_AS(Matrix^, arg0))->M22 = (arg1);
 	OS_NATIVE_EXIT(env, that, Matrix_1M22__ID_FUNC);
 }
 #endif
@@ -7374,7 +7374,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Matrix_1OffsetX__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Matrix_1OffsetX__I_FUNC);
-	rc = (jdouble)((Matrix^)TO_OBJECT(arg0))->OffsetX;
+	rc = (jdouble)(TO_OBJECT_AS(Matrix^, arg0))->OffsetX;
 	OS_NATIVE_EXIT(env, that, Matrix_1OffsetX__I_FUNC);
 	return rc;
 }
@@ -7386,7 +7386,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Matrix_1OffsetX__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Matrix_1OffsetX__ID_FUNC);
-	((Matrix^)TO_OBJECT(arg0))->OffsetX = (arg1);
+	(TO_OBJECT_AS(Matrix^, arg0))->OffsetX = (arg1);
 	OS_NATIVE_EXIT(env, that, Matrix_1OffsetX__ID_FUNC);
 }
 #endif
@@ -7398,7 +7398,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Matrix_1OffsetY__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Matrix_1OffsetY__I_FUNC);
-	rc = (jdouble)((Matrix^)TO_OBJECT(arg0))->OffsetY;
+	rc = (jdouble)(TO_OBJECT_AS(Matrix^, arg0))->OffsetY;
 	OS_NATIVE_EXIT(env, that, Matrix_1OffsetY__I_FUNC);
 	return rc;
 }
@@ -7410,7 +7410,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Matrix_1OffsetY__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Matrix_1OffsetY__ID_FUNC);
-	((Matrix^)TO_OBJECT(arg0))->OffsetY = (arg1);
+	(TO_OBJECT_AS(Matrix^, arg0))->OffsetY = (arg1);
 	OS_NATIVE_EXIT(env, that, Matrix_1OffsetY__ID_FUNC);
 }
 #endif
@@ -7421,7 +7421,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Matrix_1RotatePrepend)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Matrix_1RotatePrepend_FUNC);
-	((Matrix^)TO_OBJECT(arg0))->RotatePrepend(arg1);
+	(TO_OBJECT_AS(Matrix^, arg0))->RotatePrepend(arg1);
 	OS_NATIVE_EXIT(env, that, Matrix_1RotatePrepend_FUNC);
 }
 #endif
@@ -7432,7 +7432,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Matrix_1ScalePrepend)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1, jdouble arg2)
 {
 	OS_NATIVE_ENTER(env, that, Matrix_1ScalePrepend_FUNC);
-	((Matrix^)TO_OBJECT(arg0))->ScalePrepend(arg1, arg2);
+	(TO_OBJECT_AS(Matrix^, arg0))->ScalePrepend(arg1, arg2);
 	OS_NATIVE_EXIT(env, that, Matrix_1ScalePrepend_FUNC);
 }
 #endif
@@ -7443,7 +7443,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Matrix_1SetIdentity)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, Matrix_1SetIdentity_FUNC);
-	((Matrix^)TO_OBJECT(arg0))->SetIdentity();
+	(TO_OBJECT_AS(Matrix^, arg0))->SetIdentity();
 	OS_NATIVE_EXIT(env, that, Matrix_1SetIdentity_FUNC);
 }
 #endif
@@ -7454,7 +7454,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Matrix_1SkewPrepend)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1, jdouble arg2)
 {
 	OS_NATIVE_ENTER(env, that, Matrix_1SkewPrepend_FUNC);
-	((Matrix^)TO_OBJECT(arg0))->SkewPrepend(arg1, arg2);
+	(TO_OBJECT_AS(Matrix^, arg0))->SkewPrepend(arg1, arg2);
 	OS_NATIVE_EXIT(env, that, Matrix_1SkewPrepend_FUNC);
 }
 #endif
@@ -7466,7 +7466,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Matrix_1Transform)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Matrix_1Transform_FUNC);
-	rc = (jint)TO_HANDLE(((Matrix^)TO_OBJECT(arg0))->Transform((Point)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Matrix^, arg0))->Transform((Point)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, Matrix_1Transform_FUNC);
 	return rc;
 }
@@ -7478,7 +7478,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Matrix_1TranslatePrepend)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1, jdouble arg2)
 {
 	OS_NATIVE_ENTER(env, that, Matrix_1TranslatePrepend_FUNC);
-	((Matrix^)TO_OBJECT(arg0))->TranslatePrepend(arg1, arg2);
+	(TO_OBJECT_AS(Matrix^, arg0))->TranslatePrepend(arg1, arg2);
 	OS_NATIVE_EXIT(env, that, Matrix_1TranslatePrepend_FUNC);
 }
 #endif
@@ -7490,7 +7490,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MemberDescriptor_1Name)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, MemberDescriptor_1Name_FUNC);
-	rc = (jint)TO_HANDLE(((MemberDescriptor^)TO_OBJECT(arg0))->Name);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(MemberDescriptor^, arg0))->Name);
 	OS_NATIVE_EXIT(env, that, MemberDescriptor_1Name_FUNC);
 	return rc;
 }
@@ -7503,7 +7503,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MemoryStream_1ToArray)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, MemoryStream_1ToArray_FUNC);
-	rc = (jint)TO_HANDLE(((System::IO::MemoryStream^)TO_OBJECT(arg0))->ToArray());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::IO::MemoryStream^, arg0))->ToArray());
 	OS_NATIVE_EXIT(env, that, MemoryStream_1ToArray_FUNC);
 	return rc;
 }
@@ -7515,7 +7515,7 @@ JNIEXPORT void JNICALL OS_NATIVE(MemoryStream_1Write)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3)
 {
 	OS_NATIVE_ENTER(env, that, MemoryStream_1Write_FUNC);
-	((System::IO::MemoryStream^)TO_OBJECT(arg0))->Write((array<Byte>^)TO_OBJECT(arg1), arg2, arg3);
+	(TO_OBJECT_AS(System::IO::MemoryStream^, arg0))->Write((array<Byte>^)TO_OBJECT(arg1), arg2, arg3);
 	OS_NATIVE_EXIT(env, that, MemoryStream_1Write_FUNC);
 }
 #endif
@@ -7526,7 +7526,7 @@ JNIEXPORT void JNICALL OS_NATIVE(MenuItem_1Click)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, MenuItem_1Click_FUNC);
-	((MenuItem^)TO_OBJECT(arg0))->Click += ((RoutedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(MenuItem^, arg0))->Click += ((RoutedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, MenuItem_1Click_FUNC);
 }
 #endif
@@ -7537,7 +7537,7 @@ JNIEXPORT void JNICALL OS_NATIVE(MenuItem_1Icon)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, MenuItem_1Icon_FUNC);
-	((MenuItem^)TO_OBJECT(arg0))->Icon = ((Image^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(MenuItem^, arg0))->Icon = ((Image^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, MenuItem_1Icon_FUNC);
 }
 #endif
@@ -7548,7 +7548,7 @@ JNIEXPORT void JNICALL OS_NATIVE(MenuItem_1InputGestureText)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, MenuItem_1InputGestureText_FUNC);
-	((MenuItem^)TO_OBJECT(arg0))->InputGestureText = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(MenuItem^, arg0))->InputGestureText = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, MenuItem_1InputGestureText_FUNC);
 }
 #endif
@@ -7559,7 +7559,7 @@ JNIEXPORT void JNICALL OS_NATIVE(MenuItem_1IsCheckable)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, MenuItem_1IsCheckable_FUNC);
-	((MenuItem^)TO_OBJECT(arg0))->IsCheckable = (arg1);
+	(TO_OBJECT_AS(MenuItem^, arg0))->IsCheckable = (arg1);
 	OS_NATIVE_EXIT(env, that, MenuItem_1IsCheckable_FUNC);
 }
 #endif
@@ -7571,7 +7571,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(MenuItem_1IsChecked__I)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, MenuItem_1IsChecked__I_FUNC);
-	rc = (jboolean)((MenuItem^)TO_OBJECT(arg0))->IsChecked;
+	rc = (jboolean)(TO_OBJECT_AS(MenuItem^, arg0))->IsChecked;
 	OS_NATIVE_EXIT(env, that, MenuItem_1IsChecked__I_FUNC);
 	return rc;
 }
@@ -7583,7 +7583,7 @@ JNIEXPORT void JNICALL OS_NATIVE(MenuItem_1IsChecked__IZ)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, MenuItem_1IsChecked__IZ_FUNC);
-	((MenuItem^)TO_OBJECT(arg0))->IsChecked = (arg1);
+	(TO_OBJECT_AS(MenuItem^, arg0))->IsChecked = (arg1);
 	OS_NATIVE_EXIT(env, that, MenuItem_1IsChecked__IZ_FUNC);
 }
 #endif
@@ -7594,7 +7594,7 @@ JNIEXPORT void JNICALL OS_NATIVE(MenuItem_1SubmenuClosed)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, MenuItem_1SubmenuClosed_FUNC);
-	((MenuItem^)TO_OBJECT(arg0))->SubmenuClosed += ((RoutedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(MenuItem^, arg0))->SubmenuClosed += ((RoutedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, MenuItem_1SubmenuClosed_FUNC);
 }
 #endif
@@ -7605,7 +7605,7 @@ JNIEXPORT void JNICALL OS_NATIVE(MenuItem_1SubmenuOpened)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, MenuItem_1SubmenuOpened_FUNC);
-	((MenuItem^)TO_OBJECT(arg0))->SubmenuOpened += ((RoutedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(MenuItem^, arg0))->SubmenuOpened += ((RoutedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, MenuItem_1SubmenuOpened_FUNC);
 }
 #endif
@@ -7616,7 +7616,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Menu_1IsMainMenu)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, Menu_1IsMainMenu_FUNC);
-	((Menu^)TO_OBJECT(arg0))->IsMainMenu = (arg1);
+	(TO_OBJECT_AS(Menu^, arg0))->IsMainMenu = (arg1);
 	OS_NATIVE_EXIT(env, that, Menu_1IsMainMenu_FUNC);
 }
 #endif
@@ -7641,7 +7641,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MethodInfo_1Invoke)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, MethodInfo_1Invoke_FUNC);
-	rc = (jint)TO_HANDLE(((MethodInfo^)TO_OBJECT(arg0))->Invoke((Object^)TO_OBJECT(arg1), (array<Object^>^)TO_OBJECT(arg2)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(MethodInfo^, arg0))->Invoke((Object^)TO_OBJECT(arg1), (array<Object^>^)TO_OBJECT(arg2)));
 	OS_NATIVE_EXIT(env, that, MethodInfo_1Invoke_FUNC);
 	return rc;
 }
@@ -7654,7 +7654,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MouseButtonEventArgs_1ButtonState)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, MouseButtonEventArgs_1ButtonState_FUNC);
-	rc = (jint)((MouseButtonEventArgs^)TO_OBJECT(arg0))->ButtonState;
+	rc = (jint)(TO_OBJECT_AS(MouseButtonEventArgs^, arg0))->ButtonState;
 	OS_NATIVE_EXIT(env, that, MouseButtonEventArgs_1ButtonState_FUNC);
 	return rc;
 }
@@ -7667,7 +7667,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MouseButtonEventArgs_1ChangedButton)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, MouseButtonEventArgs_1ChangedButton_FUNC);
-	rc = (jint)((MouseButtonEventArgs^)TO_OBJECT(arg0))->ChangedButton;
+	rc = (jint)(TO_OBJECT_AS(MouseButtonEventArgs^, arg0))->ChangedButton;
 	OS_NATIVE_EXIT(env, that, MouseButtonEventArgs_1ChangedButton_FUNC);
 	return rc;
 }
@@ -7680,7 +7680,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MouseButtonEventArgs_1ClickCount)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, MouseButtonEventArgs_1ClickCount_FUNC);
-	rc = (jint)((MouseButtonEventArgs^)TO_OBJECT(arg0))->ClickCount;
+	rc = (jint)(TO_OBJECT_AS(MouseButtonEventArgs^, arg0))->ClickCount;
 	OS_NATIVE_EXIT(env, that, MouseButtonEventArgs_1ClickCount_FUNC);
 	return rc;
 }
@@ -7693,7 +7693,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MouseEventArgs_1GetPosition)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, MouseEventArgs_1GetPosition_FUNC);
-	rc = (jint)TO_HANDLE(((MouseEventArgs^)TO_OBJECT(arg0))->GetPosition((IInputElement^)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(MouseEventArgs^, arg0))->GetPosition((IInputElement^)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, MouseEventArgs_1GetPosition_FUNC);
 	return rc;
 }
@@ -7706,7 +7706,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MouseEventArgs_1LeftButton)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, MouseEventArgs_1LeftButton_FUNC);
-	rc = (jint)((MouseEventArgs^)TO_OBJECT(arg0))->LeftButton;
+	rc = (jint)(TO_OBJECT_AS(MouseEventArgs^, arg0))->LeftButton;
 	OS_NATIVE_EXIT(env, that, MouseEventArgs_1LeftButton_FUNC);
 	return rc;
 }
@@ -7719,7 +7719,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MouseEventArgs_1MiddleButton)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, MouseEventArgs_1MiddleButton_FUNC);
-	rc = (jint)((MouseEventArgs^)TO_OBJECT(arg0))->MiddleButton;
+	rc = (jint)(TO_OBJECT_AS(MouseEventArgs^, arg0))->MiddleButton;
 	OS_NATIVE_EXIT(env, that, MouseEventArgs_1MiddleButton_FUNC);
 	return rc;
 }
@@ -7732,7 +7732,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MouseEventArgs_1RightButton)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, MouseEventArgs_1RightButton_FUNC);
-	rc = (jint)((MouseEventArgs^)TO_OBJECT(arg0))->RightButton;
+	rc = (jint)(TO_OBJECT_AS(MouseEventArgs^, arg0))->RightButton;
 	OS_NATIVE_EXIT(env, that, MouseEventArgs_1RightButton_FUNC);
 	return rc;
 }
@@ -7745,7 +7745,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MouseEventArgs_1XButton1)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, MouseEventArgs_1XButton1_FUNC);
-	rc = (jint)((MouseEventArgs^)TO_OBJECT(arg0))->XButton1;
+	rc = (jint)(TO_OBJECT_AS(MouseEventArgs^, arg0))->XButton1;
 	OS_NATIVE_EXIT(env, that, MouseEventArgs_1XButton1_FUNC);
 	return rc;
 }
@@ -7758,7 +7758,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MouseEventArgs_1XButton2)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, MouseEventArgs_1XButton2_FUNC);
-	rc = (jint)((MouseEventArgs^)TO_OBJECT(arg0))->XButton2;
+	rc = (jint)(TO_OBJECT_AS(MouseEventArgs^, arg0))->XButton2;
 	OS_NATIVE_EXIT(env, that, MouseEventArgs_1XButton2_FUNC);
 	return rc;
 }
@@ -7771,7 +7771,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(MouseWheelEventArgs_1Delta)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, MouseWheelEventArgs_1Delta_FUNC);
-	rc = (jint)((MouseWheelEventArgs^)TO_OBJECT(arg0))->Delta;
+	rc = (jint)(TO_OBJECT_AS(MouseWheelEventArgs^, arg0))->Delta;
 	OS_NATIVE_EXIT(env, that, MouseWheelEventArgs_1Delta_FUNC);
 	return rc;
 }
@@ -7913,7 +7913,7 @@ JNIEXPORT void JNICALL OS_NATIVE(NameScope_1RegisterName)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, NameScope_1RegisterName_FUNC);
-	((NameScope^)TO_OBJECT(arg0))->RegisterName((String^)TO_OBJECT(arg1), (Object^)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(NameScope^, arg0))->RegisterName((String^)TO_OBJECT(arg1), (Object^)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, NameScope_1RegisterName_FUNC);
 }
 #endif
@@ -7948,7 +7948,7 @@ JNIEXPORT void JNICALL OS_NATIVE(NotifyIcon_1DoubleClick)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, NotifyIcon_1DoubleClick_FUNC);
-	((System::Windows::Forms::NotifyIcon^)TO_OBJECT(arg0))->DoubleClick += ((EventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::NotifyIcon^, arg0))->DoubleClick += ((EventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, NotifyIcon_1DoubleClick_FUNC);
 }
 #endif
@@ -7959,7 +7959,7 @@ JNIEXPORT void JNICALL OS_NATIVE(NotifyIcon_1Icon)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, NotifyIcon_1Icon_FUNC);
-	((System::Windows::Forms::NotifyIcon^)TO_OBJECT(arg0))->Icon = ((System::Drawing::Icon^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::NotifyIcon^, arg0))->Icon = ((System::Drawing::Icon^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, NotifyIcon_1Icon_FUNC);
 }
 #endif
@@ -7970,7 +7970,7 @@ JNIEXPORT void JNICALL OS_NATIVE(NotifyIcon_1MouseDown)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, NotifyIcon_1MouseDown_FUNC);
-	((System::Windows::Forms::NotifyIcon^)TO_OBJECT(arg0))->MouseDown += ((System::Windows::Forms::MouseEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::NotifyIcon^, arg0))->MouseDown += ((System::Windows::Forms::MouseEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, NotifyIcon_1MouseDown_FUNC);
 }
 #endif
@@ -7981,7 +7981,7 @@ JNIEXPORT void JNICALL OS_NATIVE(NotifyIcon_1MouseUp)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, NotifyIcon_1MouseUp_FUNC);
-	((System::Windows::Forms::NotifyIcon^)TO_OBJECT(arg0))->MouseUp += ((System::Windows::Forms::MouseEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::NotifyIcon^, arg0))->MouseUp += ((System::Windows::Forms::MouseEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, NotifyIcon_1MouseUp_FUNC);
 }
 #endif
@@ -7992,7 +7992,7 @@ JNIEXPORT void JNICALL OS_NATIVE(NotifyIcon_1Text)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, NotifyIcon_1Text_FUNC);
-	((System::Windows::Forms::NotifyIcon^)TO_OBJECT(arg0))->Text = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::NotifyIcon^, arg0))->Text = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, NotifyIcon_1Text_FUNC);
 }
 #endif
@@ -8003,7 +8003,7 @@ JNIEXPORT void JNICALL OS_NATIVE(NotifyIcon_1Visible)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, NotifyIcon_1Visible_FUNC);
-	((System::Windows::Forms::NotifyIcon^)TO_OBJECT(arg0))->Visible = (arg1);
+	(TO_OBJECT_AS(System::Windows::Forms::NotifyIcon^, arg0))->Visible = (arg1);
 	OS_NATIVE_EXIT(env, that, NotifyIcon_1Visible_FUNC);
 }
 #endif
@@ -8015,7 +8015,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Object_1Equals)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Object_1Equals_FUNC);
-	rc = (jboolean)((Object ^)TO_OBJECT(arg0))->Equals((Object ^)TO_OBJECT(arg1));
+	rc = (jboolean)(TO_OBJECT_AS(Object ^, arg0))->Equals((Object ^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Object_1Equals_FUNC);
 	return rc;
 }
@@ -8028,7 +8028,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Object_1GetType)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Object_1GetType_FUNC);
-	rc = (jint)TO_HANDLE(((Object ^)TO_OBJECT(arg0))->GetType());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Object ^, arg0))->GetType());
 	OS_NATIVE_EXIT(env, that, Object_1GetType_FUNC);
 	return rc;
 }
@@ -8041,7 +8041,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Object_1ToString)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Object_1ToString_FUNC);
-	rc = (jint)TO_HANDLE(((Object ^)TO_OBJECT(arg0))->ToString());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Object ^, arg0))->ToString());
 	OS_NATIVE_EXIT(env, that, Object_1ToString_FUNC);
 	return rc;
 }
@@ -8053,7 +8053,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ObservableCollectionGridViewColumn_1Move)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, ObservableCollectionGridViewColumn_1Move_FUNC);
-	((ObservableCollection<GridViewColumn^>^)TO_OBJECT(arg0))->Move(arg1, arg2);
+	(TO_OBJECT_AS(ObservableCollection<GridViewColumn^>^, arg0))->Move(arg1, arg2);
 	OS_NATIVE_EXIT(env, that, ObservableCollectionGridViewColumn_1Move_FUNC);
 }
 #endif
@@ -8064,7 +8064,7 @@ JNIEXPORT void JNICALL OS_NATIVE(OpenFileDialog_1Multiselect)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, OpenFileDialog_1Multiselect_FUNC);
-	((OpenFileDialog^)TO_OBJECT(arg0))->Multiselect = (arg1);
+	(TO_OBJECT_AS(OpenFileDialog^, arg0))->Multiselect = (arg1);
 	OS_NATIVE_EXIT(env, that, OpenFileDialog_1Multiselect_FUNC);
 }
 #endif
@@ -8076,7 +8076,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(OuterGlowBitmapEffect_1GlowColor__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, OuterGlowBitmapEffect_1GlowColor__I_FUNC);
-	rc = (jint)TO_HANDLE(((OuterGlowBitmapEffect^)TO_OBJECT(arg0))->GlowColor);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(OuterGlowBitmapEffect^, arg0))->GlowColor);
 	OS_NATIVE_EXIT(env, that, OuterGlowBitmapEffect_1GlowColor__I_FUNC);
 	return rc;
 }
@@ -8088,7 +8088,7 @@ JNIEXPORT void JNICALL OS_NATIVE(OuterGlowBitmapEffect_1GlowColor__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, OuterGlowBitmapEffect_1GlowColor__II_FUNC);
-	((OuterGlowBitmapEffect^)TO_OBJECT(arg0))->GlowColor = ((Color)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(OuterGlowBitmapEffect^, arg0))->GlowColor = ((Color)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, OuterGlowBitmapEffect_1GlowColor__II_FUNC);
 }
 #endif
@@ -8100,7 +8100,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(OuterGlowBitmapEffect_1GlowSize__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, OuterGlowBitmapEffect_1GlowSize__I_FUNC);
-	rc = (jdouble)((OuterGlowBitmapEffect^)TO_OBJECT(arg0))->GlowSize;
+	rc = (jdouble)(TO_OBJECT_AS(OuterGlowBitmapEffect^, arg0))->GlowSize;
 	OS_NATIVE_EXIT(env, that, OuterGlowBitmapEffect_1GlowSize__I_FUNC);
 	return rc;
 }
@@ -8112,7 +8112,7 @@ JNIEXPORT void JNICALL OS_NATIVE(OuterGlowBitmapEffect_1GlowSize__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, OuterGlowBitmapEffect_1GlowSize__ID_FUNC);
-	((OuterGlowBitmapEffect^)TO_OBJECT(arg0))->GlowSize = (arg1);
+	(TO_OBJECT_AS(OuterGlowBitmapEffect^, arg0))->GlowSize = (arg1);
 	OS_NATIVE_EXIT(env, that, OuterGlowBitmapEffect_1GlowSize__ID_FUNC);
 }
 #endif
@@ -8137,7 +8137,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(OuterGlowBitmapEffect_1Opacity__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, OuterGlowBitmapEffect_1Opacity__I_FUNC);
-	rc = (jdouble)((OuterGlowBitmapEffect^)TO_OBJECT(arg0))->Opacity;
+	rc = (jdouble)(TO_OBJECT_AS(OuterGlowBitmapEffect^, arg0))->Opacity;
 	OS_NATIVE_EXIT(env, that, OuterGlowBitmapEffect_1Opacity__I_FUNC);
 	return rc;
 }
@@ -8149,7 +8149,7 @@ JNIEXPORT void JNICALL OS_NATIVE(OuterGlowBitmapEffect_1Opacity__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, OuterGlowBitmapEffect_1Opacity__ID_FUNC);
-	((OuterGlowBitmapEffect^)TO_OBJECT(arg0))->Opacity = (arg1);
+	(TO_OBJECT_AS(OuterGlowBitmapEffect^, arg0))->Opacity = (arg1);
 	OS_NATIVE_EXIT(env, that, OuterGlowBitmapEffect_1Opacity__ID_FUNC);
 }
 #endif
@@ -8161,7 +8161,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Panel_1Background__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Panel_1Background__I_FUNC);
-	rc = (jint)TO_HANDLE(((Panel^)TO_OBJECT(arg0))->Background);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Panel^, arg0))->Background);
 	OS_NATIVE_EXIT(env, that, Panel_1Background__I_FUNC);
 	return rc;
 }
@@ -8173,7 +8173,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Panel_1Background__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Panel_1Background__II_FUNC);
-	((Panel^)TO_OBJECT(arg0))->Background = ((Brush^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Panel^, arg0))->Background = ((Brush^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Panel_1Background__II_FUNC);
 }
 #endif
@@ -8198,7 +8198,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Panel_1Children)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Panel_1Children_FUNC);
-	rc = (jint)TO_HANDLE(((Panel^)TO_OBJECT(arg0))->Children);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Panel^, arg0))->Children);
 	OS_NATIVE_EXIT(env, that, Panel_1Children_FUNC);
 	return rc;
 }
@@ -8261,7 +8261,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PasswordBox_1MaxLength__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, PasswordBox_1MaxLength__I_FUNC);
-	rc = (jint)((PasswordBox^)TO_OBJECT(arg0))->MaxLength;
+	rc = (jint)(TO_OBJECT_AS(PasswordBox^, arg0))->MaxLength;
 	OS_NATIVE_EXIT(env, that, PasswordBox_1MaxLength__I_FUNC);
 	return rc;
 }
@@ -8273,7 +8273,7 @@ JNIEXPORT void JNICALL OS_NATIVE(PasswordBox_1MaxLength__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, PasswordBox_1MaxLength__II_FUNC);
-	((PasswordBox^)TO_OBJECT(arg0))->MaxLength = (arg1);
+	(TO_OBJECT_AS(PasswordBox^, arg0))->MaxLength = (arg1);
 	OS_NATIVE_EXIT(env, that, PasswordBox_1MaxLength__II_FUNC);
 }
 #endif
@@ -8285,7 +8285,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PasswordBox_1Password__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, PasswordBox_1Password__I_FUNC);
-	rc = (jint)TO_HANDLE(((PasswordBox^)TO_OBJECT(arg0))->Password);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(PasswordBox^, arg0))->Password);
 	OS_NATIVE_EXIT(env, that, PasswordBox_1Password__I_FUNC);
 	return rc;
 }
@@ -8297,7 +8297,7 @@ JNIEXPORT void JNICALL OS_NATIVE(PasswordBox_1Password__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, PasswordBox_1Password__II_FUNC);
-	((PasswordBox^)TO_OBJECT(arg0))->Password = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(PasswordBox^, arg0))->Password = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, PasswordBox_1Password__II_FUNC);
 }
 #endif
@@ -8308,7 +8308,7 @@ JNIEXPORT void JNICALL OS_NATIVE(PasswordBox_1PasswordChanged)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, PasswordBox_1PasswordChanged_FUNC);
-	((PasswordBox^)TO_OBJECT(arg0))->PasswordChanged += ((RoutedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(PasswordBox^, arg0))->PasswordChanged += ((RoutedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, PasswordBox_1PasswordChanged_FUNC);
 }
 #endif
@@ -8320,7 +8320,7 @@ JNIEXPORT jchar JNICALL OS_NATIVE(PasswordBox_1PasswordChar__I)
 {
 	jchar rc = 0;
 	OS_NATIVE_ENTER(env, that, PasswordBox_1PasswordChar__I_FUNC);
-	rc = (jchar)((PasswordBox^)TO_OBJECT(arg0))->PasswordChar;
+	rc = (jchar)(TO_OBJECT_AS(PasswordBox^, arg0))->PasswordChar;
 	OS_NATIVE_EXIT(env, that, PasswordBox_1PasswordChar__I_FUNC);
 	return rc;
 }
@@ -8332,7 +8332,7 @@ JNIEXPORT void JNICALL OS_NATIVE(PasswordBox_1PasswordChar__IC)
 	(JNIEnv *env, jclass that, jint arg0, jchar arg1)
 {
 	OS_NATIVE_ENTER(env, that, PasswordBox_1PasswordChar__IC_FUNC);
-	((PasswordBox^)TO_OBJECT(arg0))->PasswordChar = (arg1);
+	(TO_OBJECT_AS(PasswordBox^, arg0))->PasswordChar = (arg1);
 	OS_NATIVE_EXIT(env, that, PasswordBox_1PasswordChar__IC_FUNC);
 }
 #endif
@@ -8343,7 +8343,7 @@ JNIEXPORT void JNICALL OS_NATIVE(PasswordBox_1Paste)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, PasswordBox_1Paste_FUNC);
-	((PasswordBox^)TO_OBJECT(arg0))->Paste();
+	(TO_OBJECT_AS(PasswordBox^, arg0))->Paste();
 	OS_NATIVE_EXIT(env, that, PasswordBox_1Paste_FUNC);
 }
 #endif
@@ -8354,7 +8354,7 @@ JNIEXPORT void JNICALL OS_NATIVE(PathFigureCollection_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, PathFigureCollection_1Add_FUNC);
-	((PathFigureCollection^)TO_OBJECT(arg0))->Add((PathFigure^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(PathFigureCollection^, arg0))->Add((PathFigure^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, PathFigureCollection_1Add_FUNC);
 }
 #endif
@@ -8366,7 +8366,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PathFigureCollection_1Count)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, PathFigureCollection_1Count_FUNC);
-	rc = (jint)((PathFigureCollection^)TO_OBJECT(arg0))->Count;
+	rc = (jint)(TO_OBJECT_AS(PathFigureCollection^, arg0))->Count;
 	OS_NATIVE_EXIT(env, that, PathFigureCollection_1Count_FUNC);
 	return rc;
 }
@@ -8379,7 +8379,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(PathFigure_1IsClosed__I)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, PathFigure_1IsClosed__I_FUNC);
-	rc = (jboolean)((PathFigure^)TO_OBJECT(arg0))->IsClosed;
+	rc = (jboolean)(TO_OBJECT_AS(PathFigure^, arg0))->IsClosed;
 	OS_NATIVE_EXIT(env, that, PathFigure_1IsClosed__I_FUNC);
 	return rc;
 }
@@ -8391,7 +8391,7 @@ JNIEXPORT void JNICALL OS_NATIVE(PathFigure_1IsClosed__IZ)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, PathFigure_1IsClosed__IZ_FUNC);
-	((PathFigure^)TO_OBJECT(arg0))->IsClosed = (arg1);
+	(TO_OBJECT_AS(PathFigure^, arg0))->IsClosed = (arg1);
 	OS_NATIVE_EXIT(env, that, PathFigure_1IsClosed__IZ_FUNC);
 }
 #endif
@@ -8403,7 +8403,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PathFigure_1Segments__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, PathFigure_1Segments__I_FUNC);
-	rc = (jint)TO_HANDLE(((PathFigure^)TO_OBJECT(arg0))->Segments);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(PathFigure^, arg0))->Segments);
 	OS_NATIVE_EXIT(env, that, PathFigure_1Segments__I_FUNC);
 	return rc;
 }
@@ -8416,7 +8416,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PathFigure_1Segments__II)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, PathFigure_1Segments__II_FUNC);
-	rc = (jint)TO_HANDLE(((PathFigure^)TO_OBJECT(arg0))->Segments[arg1]);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(PathFigure^, arg0))->Segments[arg1]);
 	OS_NATIVE_EXIT(env, that, PathFigure_1Segments__II_FUNC);
 	return rc;
 }
@@ -8428,7 +8428,7 @@ JNIEXPORT void JNICALL OS_NATIVE(PathFigure_1StartPoint)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, PathFigure_1StartPoint_FUNC);
-	((PathFigure^)TO_OBJECT(arg0))->StartPoint = ((Point)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(PathFigure^, arg0))->StartPoint = ((Point)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, PathFigure_1StartPoint_FUNC);
 }
 #endif
@@ -8439,7 +8439,7 @@ JNIEXPORT void JNICALL OS_NATIVE(PathGeometry_1AddGeometry)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, PathGeometry_1AddGeometry_FUNC);
-	((PathGeometry^)TO_OBJECT(arg0))->AddGeometry((Geometry^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(PathGeometry^, arg0))->AddGeometry((Geometry^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, PathGeometry_1AddGeometry_FUNC);
 }
 #endif
@@ -8451,7 +8451,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PathGeometry_1Bounds)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, PathGeometry_1Bounds_FUNC);
-	rc = (jint)TO_HANDLE(((PathGeometry^)TO_OBJECT(arg0))->Bounds);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(PathGeometry^, arg0))->Bounds);
 	OS_NATIVE_EXIT(env, that, PathGeometry_1Bounds_FUNC);
 	return rc;
 }
@@ -8464,7 +8464,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PathGeometry_1Clone)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, PathGeometry_1Clone_FUNC);
-	rc = (jint)TO_HANDLE(((PathGeometry^)TO_OBJECT(arg0))->Clone());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(PathGeometry^, arg0))->Clone());
 	OS_NATIVE_EXIT(env, that, PathGeometry_1Clone_FUNC);
 	return rc;
 }
@@ -8477,7 +8477,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PathGeometry_1Figures__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, PathGeometry_1Figures__I_FUNC);
-	rc = (jint)TO_HANDLE(((PathGeometry^)TO_OBJECT(arg0))->Figures);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(PathGeometry^, arg0))->Figures);
 	OS_NATIVE_EXIT(env, that, PathGeometry_1Figures__I_FUNC);
 	return rc;
 }
@@ -8490,7 +8490,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PathGeometry_1Figures__II)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, PathGeometry_1Figures__II_FUNC);
-	rc = (jint)TO_HANDLE(((PathGeometry^)TO_OBJECT(arg0))->Figures[arg1]);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(PathGeometry^, arg0))->Figures[arg1]);
 	OS_NATIVE_EXIT(env, that, PathGeometry_1Figures__II_FUNC);
 	return rc;
 }
@@ -8502,7 +8502,7 @@ JNIEXPORT void JNICALL OS_NATIVE(PathGeometry_1FillRule)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, PathGeometry_1FillRule_FUNC);
-	((PathGeometry^)TO_OBJECT(arg0))->FillRule = ((FillRule)arg1);
+	(TO_OBJECT_AS(PathGeometry^, arg0))->FillRule = ((FillRule)arg1);
 	OS_NATIVE_EXIT(env, that, PathGeometry_1FillRule_FUNC);
 }
 #endif
@@ -8513,7 +8513,7 @@ JNIEXPORT void JNICALL OS_NATIVE(PathSegmentCollection_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, PathSegmentCollection_1Add_FUNC);
-	((PathSegmentCollection^)TO_OBJECT(arg0))->Add((PathSegment^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(PathSegmentCollection^, arg0))->Add((PathSegment^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, PathSegmentCollection_1Add_FUNC);
 }
 #endif
@@ -8525,7 +8525,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PathSegmentCollection_1Count)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, PathSegmentCollection_1Count_FUNC);
-	rc = (jint)((PathSegmentCollection^)TO_OBJECT(arg0))->Count;
+	rc = (jint)(TO_OBJECT_AS(PathSegmentCollection^, arg0))->Count;
 	OS_NATIVE_EXIT(env, that, PathSegmentCollection_1Count_FUNC);
 	return rc;
 }
@@ -8537,7 +8537,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Path_1Data)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Path_1Data_FUNC);
-	((Path^)TO_OBJECT(arg0))->Data = ((Geometry^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Path^, arg0))->Data = ((Geometry^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Path_1Data_FUNC);
 }
 #endif
@@ -8548,7 +8548,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Path_1Fill)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Path_1Fill_FUNC);
-	((Path^)TO_OBJECT(arg0))->Fill = ((Brush^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Path^, arg0))->Fill = ((Brush^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Path_1Fill_FUNC);
 }
 #endif
@@ -8559,7 +8559,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Path_1Stretch)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Path_1Stretch_FUNC);
-	((Path^)TO_OBJECT(arg0))->Stretch = ((Stretch)arg1);
+	(TO_OBJECT_AS(Path^, arg0))->Stretch = ((Stretch)arg1);
 	OS_NATIVE_EXIT(env, that, Path_1Stretch_FUNC);
 }
 #endif
@@ -8571,7 +8571,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Pen_1Brush__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Pen_1Brush__I_FUNC);
-	rc = (jint)TO_HANDLE(((Pen^)TO_OBJECT(arg0))->Brush);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Pen^, arg0))->Brush);
 	OS_NATIVE_EXIT(env, that, Pen_1Brush__I_FUNC);
 	return rc;
 }
@@ -8583,7 +8583,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Pen_1Brush__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Pen_1Brush__II_FUNC);
-	((Pen^)TO_OBJECT(arg0))->Brush = ((Brush^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Pen^, arg0))->Brush = ((Brush^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Pen_1Brush__II_FUNC);
 }
 #endif
@@ -8594,7 +8594,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Pen_1DashCap)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Pen_1DashCap_FUNC);
-	((Pen^)TO_OBJECT(arg0))->DashCap = ((PenLineCap)arg1);
+	(TO_OBJECT_AS(Pen^, arg0))->DashCap = ((PenLineCap)arg1);
 	OS_NATIVE_EXIT(env, that, Pen_1DashCap_FUNC);
 }
 #endif
@@ -8605,7 +8605,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Pen_1DashStyle)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Pen_1DashStyle_FUNC);
-	((Pen^)TO_OBJECT(arg0))->DashStyle = ((DashStyle^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Pen^, arg0))->DashStyle = ((DashStyle^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Pen_1DashStyle_FUNC);
 }
 #endif
@@ -8616,7 +8616,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Pen_1EndLineCap)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Pen_1EndLineCap_FUNC);
-	((Pen^)TO_OBJECT(arg0))->EndLineCap = ((PenLineCap)arg1);
+	(TO_OBJECT_AS(Pen^, arg0))->EndLineCap = ((PenLineCap)arg1);
 	OS_NATIVE_EXIT(env, that, Pen_1EndLineCap_FUNC);
 }
 #endif
@@ -8627,7 +8627,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Pen_1LineJoin)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Pen_1LineJoin_FUNC);
-	((Pen^)TO_OBJECT(arg0))->LineJoin = ((PenLineJoin)arg1);
+	(TO_OBJECT_AS(Pen^, arg0))->LineJoin = ((PenLineJoin)arg1);
 	OS_NATIVE_EXIT(env, that, Pen_1LineJoin_FUNC);
 }
 #endif
@@ -8638,7 +8638,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Pen_1MiterLimit)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Pen_1MiterLimit_FUNC);
-	((Pen^)TO_OBJECT(arg0))->MiterLimit = (arg1);
+	(TO_OBJECT_AS(Pen^, arg0))->MiterLimit = (arg1);
 	OS_NATIVE_EXIT(env, that, Pen_1MiterLimit_FUNC);
 }
 #endif
@@ -8649,7 +8649,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Pen_1StartLineCap)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Pen_1StartLineCap_FUNC);
-	((Pen^)TO_OBJECT(arg0))->StartLineCap = ((PenLineCap)arg1);
+	(TO_OBJECT_AS(Pen^, arg0))->StartLineCap = ((PenLineCap)arg1);
 	OS_NATIVE_EXIT(env, that, Pen_1StartLineCap_FUNC);
 }
 #endif
@@ -8660,7 +8660,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Pen_1Thickness)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Pen_1Thickness_FUNC);
-	((Pen^)TO_OBJECT(arg0))->Thickness = (arg1);
+	(TO_OBJECT_AS(Pen^, arg0))->Thickness = (arg1);
 	OS_NATIVE_EXIT(env, that, Pen_1Thickness_FUNC);
 }
 #endif
@@ -8672,7 +8672,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PixelFormat_1BitsPerPixel)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, PixelFormat_1BitsPerPixel_FUNC);
-	rc = (jint)((PixelFormat^)TO_OBJECT(arg0))->BitsPerPixel;
+	rc = (jint)(TO_OBJECT_AS(PixelFormat^, arg0))->BitsPerPixel;
 	OS_NATIVE_EXIT(env, that, PixelFormat_1BitsPerPixel_FUNC);
 	return rc;
 }
@@ -8866,7 +8866,7 @@ JNIEXPORT void JNICALL OS_NATIVE(PointCollection_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, PointCollection_1Add_FUNC);
-	((PointCollection^)TO_OBJECT(arg0))->Add((Point)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(PointCollection^, arg0))->Add((Point)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, PointCollection_1Add_FUNC);
 }
 #endif
@@ -8878,7 +8878,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Point_1X)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Point_1X_FUNC);
-	rc = (jdouble)((Point^)TO_OBJECT(arg0))->X;
+	rc = (jdouble)(TO_OBJECT_AS(Point^, arg0))->X;
 	OS_NATIVE_EXIT(env, that, Point_1X_FUNC);
 	return rc;
 }
@@ -8891,7 +8891,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Point_1Y)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Point_1Y_FUNC);
-	rc = (jdouble)((Point^)TO_OBJECT(arg0))->Y;
+	rc = (jdouble)(TO_OBJECT_AS(Point^, arg0))->Y;
 	OS_NATIVE_EXIT(env, that, Point_1Y_FUNC);
 	return rc;
 }
@@ -8903,7 +8903,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Popup_1AllowsTransparency)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, Popup_1AllowsTransparency_FUNC);
-	((Popup^)TO_OBJECT(arg0))->AllowsTransparency = (arg1);
+	(TO_OBJECT_AS(Popup^, arg0))->AllowsTransparency = (arg1);
 	OS_NATIVE_EXIT(env, that, Popup_1AllowsTransparency_FUNC);
 }
 #endif
@@ -8915,7 +8915,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Popup_1Child__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Popup_1Child__I_FUNC);
-	rc = (jint)TO_HANDLE(((Popup^)TO_OBJECT(arg0))->Child);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Popup^, arg0))->Child);
 	OS_NATIVE_EXIT(env, that, Popup_1Child__I_FUNC);
 	return rc;
 }
@@ -8927,7 +8927,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Popup_1Child__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Popup_1Child__II_FUNC);
-	((Popup^)TO_OBJECT(arg0))->Child = ((UIElement^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Popup^, arg0))->Child = ((UIElement^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Popup_1Child__II_FUNC);
 }
 #endif
@@ -8938,7 +8938,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Popup_1Closed)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Popup_1Closed_FUNC);
-	((Popup^)TO_OBJECT(arg0))->Closed += ((EventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Popup^, arg0))->Closed += ((EventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Popup_1Closed_FUNC);
 }
 #endif
@@ -8950,7 +8950,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Popup_1HorizontalOffset__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Popup_1HorizontalOffset__I_FUNC);
-	rc = (jdouble)((Popup^)TO_OBJECT(arg0))->HorizontalOffset;
+	rc = (jdouble)(TO_OBJECT_AS(Popup^, arg0))->HorizontalOffset;
 	OS_NATIVE_EXIT(env, that, Popup_1HorizontalOffset__I_FUNC);
 	return rc;
 }
@@ -8962,7 +8962,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Popup_1HorizontalOffset__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Popup_1HorizontalOffset__ID_FUNC);
-	((Popup^)TO_OBJECT(arg0))->HorizontalOffset = (arg1);
+	(TO_OBJECT_AS(Popup^, arg0))->HorizontalOffset = (arg1);
 	OS_NATIVE_EXIT(env, that, Popup_1HorizontalOffset__ID_FUNC);
 }
 #endif
@@ -8974,7 +8974,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Popup_1IsOpen__I)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Popup_1IsOpen__I_FUNC);
-	rc = (jboolean)((Popup^)TO_OBJECT(arg0))->IsOpen;
+	rc = (jboolean)(TO_OBJECT_AS(Popup^, arg0))->IsOpen;
 	OS_NATIVE_EXIT(env, that, Popup_1IsOpen__I_FUNC);
 	return rc;
 }
@@ -8986,7 +8986,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Popup_1IsOpen__IZ)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, Popup_1IsOpen__IZ_FUNC);
-	((Popup^)TO_OBJECT(arg0))->IsOpen = (arg1);
+	(TO_OBJECT_AS(Popup^, arg0))->IsOpen = (arg1);
 	OS_NATIVE_EXIT(env, that, Popup_1IsOpen__IZ_FUNC);
 }
 #endif
@@ -8997,7 +8997,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Popup_1Opened)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Popup_1Opened_FUNC);
-	((Popup^)TO_OBJECT(arg0))->Opened += ((EventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Popup^, arg0))->Opened += ((EventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Popup_1Opened_FUNC);
 }
 #endif
@@ -9009,7 +9009,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Popup_1VerticalOffset__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Popup_1VerticalOffset__I_FUNC);
-	rc = (jdouble)((Popup^)TO_OBJECT(arg0))->VerticalOffset;
+	rc = (jdouble)(TO_OBJECT_AS(Popup^, arg0))->VerticalOffset;
 	OS_NATIVE_EXIT(env, that, Popup_1VerticalOffset__I_FUNC);
 	return rc;
 }
@@ -9021,7 +9021,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Popup_1VerticalOffset__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Popup_1VerticalOffset__ID_FUNC);
-	((Popup^)TO_OBJECT(arg0))->VerticalOffset = (arg1);
+	(TO_OBJECT_AS(Popup^, arg0))->VerticalOffset = (arg1);
 	OS_NATIVE_EXIT(env, that, Popup_1VerticalOffset__ID_FUNC);
 }
 #endif
@@ -9059,7 +9059,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(PresentationSource_1RootVisual)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, PresentationSource_1RootVisual_FUNC);
-	rc = (jint)TO_HANDLE(((PresentationSource^)TO_OBJECT(arg0))->RootVisual);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(PresentationSource^, arg0))->RootVisual);
 	OS_NATIVE_EXIT(env, that, PresentationSource_1RootVisual_FUNC);
 	return rc;
 }
@@ -9071,7 +9071,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ProgressBar_1IsIndeterminate__I)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, ProgressBar_1IsIndeterminate__I_FUNC);
-	((ProgressBar ^)TO_OBJECT(arg0))->IsIndeterminate;
+	(TO_OBJECT_AS(ProgressBar ^, arg0))->IsIndeterminate;
 	OS_NATIVE_EXIT(env, that, ProgressBar_1IsIndeterminate__I_FUNC);
 }
 #endif
@@ -9082,7 +9082,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ProgressBar_1IsIndeterminate__IZ)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, ProgressBar_1IsIndeterminate__IZ_FUNC);
-	((ProgressBar ^)TO_OBJECT(arg0))->IsIndeterminate = (arg1);
+	(TO_OBJECT_AS(ProgressBar ^, arg0))->IsIndeterminate = (arg1);
 	OS_NATIVE_EXIT(env, that, ProgressBar_1IsIndeterminate__IZ_FUNC);
 }
 #endif
@@ -9093,7 +9093,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ProgressBar_1Orientation)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ProgressBar_1Orientation_FUNC);
-	((ProgressBar ^)TO_OBJECT(arg0))->Orientation = ((Orientation)arg1);
+	(TO_OBJECT_AS(ProgressBar ^, arg0))->Orientation = ((Orientation)arg1);
 	OS_NATIVE_EXIT(env, that, ProgressBar_1Orientation_FUNC);
 }
 #endif
@@ -9104,7 +9104,7 @@ JNIEXPORT void JNICALL OS_NATIVE(PropertyInfo_1SetValue)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3)
 {
 	OS_NATIVE_ENTER(env, that, PropertyInfo_1SetValue_FUNC);
-	((PropertyInfo^)TO_OBJECT(arg0))->SetValue((Object^)TO_OBJECT(arg1), (Object^)TO_OBJECT(arg2), (array<Object^>^)TO_OBJECT(arg3));
+	(TO_OBJECT_AS(PropertyInfo^, arg0))->SetValue((Object^)TO_OBJECT(arg1), (Object^)TO_OBJECT(arg2), (array<Object^>^)TO_OBJECT(arg3));
 	OS_NATIVE_EXIT(env, that, PropertyInfo_1SetValue_FUNC);
 }
 #endif
@@ -9115,7 +9115,7 @@ JNIEXPORT void JNICALL OS_NATIVE(PropertyInfo_1SetValueBoolean)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jboolean arg2, jint arg3)
 {
 	OS_NATIVE_ENTER(env, that, PropertyInfo_1SetValueBoolean_FUNC);
-	((PropertyInfo^)TO_OBJECT(arg0))->PropertyInfo::SetValue((Object^)TO_OBJECT(arg1), (bool)arg2, (array<Object^>^)TO_OBJECT(arg3));
+	(TO_OBJECT_AS(PropertyInfo^, arg0))->PropertyInfo::SetValue((Object^)TO_OBJECT(arg1), (bool)arg2, (array<Object^>^)TO_OBJECT(arg3));
 	OS_NATIVE_EXIT(env, that, PropertyInfo_1SetValueBoolean_FUNC);
 }
 #endif
@@ -9126,7 +9126,7 @@ JNIEXPORT void JNICALL OS_NATIVE(QueryContinueDragEventArgs_1Action)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, QueryContinueDragEventArgs_1Action_FUNC);
-	((QueryContinueDragEventArgs^)TO_OBJECT(arg0))->Action = ((DragAction)arg1);
+	(TO_OBJECT_AS(QueryContinueDragEventArgs^, arg0))->Action = ((DragAction)arg1);
 	OS_NATIVE_EXIT(env, that, QueryContinueDragEventArgs_1Action_FUNC);
 }
 #endif
@@ -9138,7 +9138,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(QueryContinueDragEventArgs_1EscapePressed)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, QueryContinueDragEventArgs_1EscapePressed_FUNC);
-	rc = (jboolean)((QueryContinueDragEventArgs^)TO_OBJECT(arg0))->EscapePressed;
+	rc = (jboolean)(TO_OBJECT_AS(QueryContinueDragEventArgs^, arg0))->EscapePressed;
 	OS_NATIVE_EXIT(env, that, QueryContinueDragEventArgs_1EscapePressed_FUNC);
 	return rc;
 }
@@ -9151,7 +9151,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(RangeBase_1LargeChange__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, RangeBase_1LargeChange__I_FUNC);
-	rc = (jdouble)((RangeBase ^)TO_OBJECT(arg0))->LargeChange;
+	rc = (jdouble)(TO_OBJECT_AS(RangeBase ^, arg0))->LargeChange;
 	OS_NATIVE_EXIT(env, that, RangeBase_1LargeChange__I_FUNC);
 	return rc;
 }
@@ -9163,7 +9163,7 @@ JNIEXPORT void JNICALL OS_NATIVE(RangeBase_1LargeChange__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, RangeBase_1LargeChange__ID_FUNC);
-	((RangeBase ^)TO_OBJECT(arg0))->LargeChange = (arg1);
+	(TO_OBJECT_AS(RangeBase ^, arg0))->LargeChange = (arg1);
 	OS_NATIVE_EXIT(env, that, RangeBase_1LargeChange__ID_FUNC);
 }
 #endif
@@ -9175,7 +9175,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(RangeBase_1Maximum__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, RangeBase_1Maximum__I_FUNC);
-	rc = (jdouble)((RangeBase ^)TO_OBJECT(arg0))->Maximum;
+	rc = (jdouble)(TO_OBJECT_AS(RangeBase ^, arg0))->Maximum;
 	OS_NATIVE_EXIT(env, that, RangeBase_1Maximum__I_FUNC);
 	return rc;
 }
@@ -9187,7 +9187,7 @@ JNIEXPORT void JNICALL OS_NATIVE(RangeBase_1Maximum__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, RangeBase_1Maximum__ID_FUNC);
-	((RangeBase ^)TO_OBJECT(arg0))->Maximum = (arg1);
+	(TO_OBJECT_AS(RangeBase ^, arg0))->Maximum = (arg1);
 	OS_NATIVE_EXIT(env, that, RangeBase_1Maximum__ID_FUNC);
 }
 #endif
@@ -9199,7 +9199,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(RangeBase_1Minimum__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, RangeBase_1Minimum__I_FUNC);
-	rc = (jdouble)((RangeBase ^)TO_OBJECT(arg0))->Minimum;
+	rc = (jdouble)(TO_OBJECT_AS(RangeBase ^, arg0))->Minimum;
 	OS_NATIVE_EXIT(env, that, RangeBase_1Minimum__I_FUNC);
 	return rc;
 }
@@ -9211,7 +9211,7 @@ JNIEXPORT void JNICALL OS_NATIVE(RangeBase_1Minimum__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, RangeBase_1Minimum__ID_FUNC);
-	((RangeBase ^)TO_OBJECT(arg0))->Minimum = (arg1);
+	(TO_OBJECT_AS(RangeBase ^, arg0))->Minimum = (arg1);
 	OS_NATIVE_EXIT(env, that, RangeBase_1Minimum__ID_FUNC);
 }
 #endif
@@ -9223,7 +9223,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(RangeBase_1SmallChange__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, RangeBase_1SmallChange__I_FUNC);
-	rc = (jdouble)((RangeBase ^)TO_OBJECT(arg0))->SmallChange;
+	rc = (jdouble)(TO_OBJECT_AS(RangeBase ^, arg0))->SmallChange;
 	OS_NATIVE_EXIT(env, that, RangeBase_1SmallChange__I_FUNC);
 	return rc;
 }
@@ -9235,7 +9235,7 @@ JNIEXPORT void JNICALL OS_NATIVE(RangeBase_1SmallChange__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, RangeBase_1SmallChange__ID_FUNC);
-	((RangeBase ^)TO_OBJECT(arg0))->SmallChange = (arg1);
+	(TO_OBJECT_AS(RangeBase ^, arg0))->SmallChange = (arg1);
 	OS_NATIVE_EXIT(env, that, RangeBase_1SmallChange__ID_FUNC);
 }
 #endif
@@ -9247,7 +9247,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(RangeBase_1Value__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, RangeBase_1Value__I_FUNC);
-	rc = (jdouble)((RangeBase ^)TO_OBJECT(arg0))->Value;
+	rc = (jdouble)(TO_OBJECT_AS(RangeBase ^, arg0))->Value;
 	OS_NATIVE_EXIT(env, that, RangeBase_1Value__I_FUNC);
 	return rc;
 }
@@ -9259,7 +9259,7 @@ JNIEXPORT void JNICALL OS_NATIVE(RangeBase_1Value__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, RangeBase_1Value__ID_FUNC);
-	((RangeBase ^)TO_OBJECT(arg0))->Value = (arg1);
+	(TO_OBJECT_AS(RangeBase ^, arg0))->Value = (arg1);
 	OS_NATIVE_EXIT(env, that, RangeBase_1Value__ID_FUNC);
 }
 #endif
@@ -9270,7 +9270,7 @@ JNIEXPORT void JNICALL OS_NATIVE(RangeBase_1ValueChanged)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, RangeBase_1ValueChanged_FUNC);
-	((RangeBase ^)TO_OBJECT(arg0))->ValueChanged += ((RoutedPropertyChangedEventHandler<double> ^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(RangeBase ^, arg0))->ValueChanged += ((RoutedPropertyChangedEventHandler<double> ^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, RangeBase_1ValueChanged_FUNC);
 }
 #endif
@@ -9282,7 +9282,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Rect_1Contains)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Rect_1Contains_FUNC);
-	rc = (jboolean)((Rect^)TO_OBJECT(arg0))->Contains((Point)TO_OBJECT(arg1));
+	rc = (jboolean)(TO_OBJECT_AS(Rect^, arg0))->Contains((Point)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Rect_1Contains_FUNC);
 	return rc;
 }
@@ -9295,7 +9295,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Rect_1Height__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Rect_1Height__I_FUNC);
-	rc = (jdouble)((Rect^)TO_OBJECT(arg0))->Height;
+	rc = (jdouble)(TO_OBJECT_AS(Rect^, arg0))->Height;
 	OS_NATIVE_EXIT(env, that, Rect_1Height__I_FUNC);
 	return rc;
 }
@@ -9307,7 +9307,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Rect_1Height__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Rect_1Height__ID_FUNC);
-	((Rect^)TO_OBJECT(arg0))->Height = (arg1);
+	(TO_OBJECT_AS(Rect^, arg0))->Height = (arg1);
 	OS_NATIVE_EXIT(env, that, Rect_1Height__ID_FUNC);
 }
 #endif
@@ -9318,7 +9318,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Rect_1Intersect)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Rect_1Intersect_FUNC);
-	((Rect^)TO_OBJECT(arg0))->Intersect((Rect)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Rect^, arg0))->Intersect((Rect)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Rect_1Intersect_FUNC);
 }
 #endif
@@ -9329,7 +9329,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Rect_1Union)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Rect_1Union_FUNC);
-	((Rect^)TO_OBJECT(arg0))->Union((Rect)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Rect^, arg0))->Union((Rect)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Rect_1Union_FUNC);
 }
 #endif
@@ -9341,7 +9341,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Rect_1Width__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Rect_1Width__I_FUNC);
-	rc = (jdouble)((Rect^)TO_OBJECT(arg0))->Width;
+	rc = (jdouble)(TO_OBJECT_AS(Rect^, arg0))->Width;
 	OS_NATIVE_EXIT(env, that, Rect_1Width__I_FUNC);
 	return rc;
 }
@@ -9353,7 +9353,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Rect_1Width__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Rect_1Width__ID_FUNC);
-	((Rect^)TO_OBJECT(arg0))->Width = (arg1);
+	(TO_OBJECT_AS(Rect^, arg0))->Width = (arg1);
 	OS_NATIVE_EXIT(env, that, Rect_1Width__ID_FUNC);
 }
 #endif
@@ -9365,7 +9365,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Rect_1X__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Rect_1X__I_FUNC);
-	rc = (jdouble)((Rect^)TO_OBJECT(arg0))->X;
+	rc = (jdouble)(TO_OBJECT_AS(Rect^, arg0))->X;
 	OS_NATIVE_EXIT(env, that, Rect_1X__I_FUNC);
 	return rc;
 }
@@ -9377,7 +9377,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Rect_1X__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Rect_1X__ID_FUNC);
-	((Rect^)TO_OBJECT(arg0))->X = (arg1);
+	(TO_OBJECT_AS(Rect^, arg0))->X = (arg1);
 	OS_NATIVE_EXIT(env, that, Rect_1X__ID_FUNC);
 }
 #endif
@@ -9389,7 +9389,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Rect_1Y__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Rect_1Y__I_FUNC);
-	rc = (jdouble)((Rect^)TO_OBJECT(arg0))->Y;
+	rc = (jdouble)(TO_OBJECT_AS(Rect^, arg0))->Y;
 	OS_NATIVE_EXIT(env, that, Rect_1Y__I_FUNC);
 	return rc;
 }
@@ -9401,7 +9401,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Rect_1Y__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Rect_1Y__ID_FUNC);
-	((Rect^)TO_OBJECT(arg0))->Y = (arg1);
+	(TO_OBJECT_AS(Rect^, arg0))->Y = (arg1);
 	OS_NATIVE_EXIT(env, that, Rect_1Y__ID_FUNC);
 }
 #endif
@@ -9413,7 +9413,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Rectangle_1Height)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Rectangle_1Height_FUNC);
-	rc = (jint)((System::Drawing::Rectangle^)TO_OBJECT(arg0))->Height;
+	rc = (jint)(TO_OBJECT_AS(System::Drawing::Rectangle^, arg0))->Height;
 	OS_NATIVE_EXIT(env, that, Rectangle_1Height_FUNC);
 	return rc;
 }
@@ -9426,7 +9426,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Rectangle_1Width)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Rectangle_1Width_FUNC);
-	rc = (jint)((System::Drawing::Rectangle^)TO_OBJECT(arg0))->Width;
+	rc = (jint)(TO_OBJECT_AS(System::Drawing::Rectangle^, arg0))->Width;
 	OS_NATIVE_EXIT(env, that, Rectangle_1Width_FUNC);
 	return rc;
 }
@@ -9439,7 +9439,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Rectangle_1X)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Rectangle_1X_FUNC);
-	rc = (jint)((System::Drawing::Rectangle^)TO_OBJECT(arg0))->X;
+	rc = (jint)(TO_OBJECT_AS(System::Drawing::Rectangle^, arg0))->X;
 	OS_NATIVE_EXIT(env, that, Rectangle_1X_FUNC);
 	return rc;
 }
@@ -9452,7 +9452,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Rectangle_1Y)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Rectangle_1Y_FUNC);
-	rc = (jint)((System::Drawing::Rectangle^)TO_OBJECT(arg0))->Y;
+	rc = (jint)(TO_OBJECT_AS(System::Drawing::Rectangle^, arg0))->Y;
 	OS_NATIVE_EXIT(env, that, Rectangle_1Y_FUNC);
 	return rc;
 }
@@ -9465,7 +9465,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(RegistryKey_1GetSubKeyNames)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, RegistryKey_1GetSubKeyNames_FUNC);
-	rc = (jint)TO_HANDLE(((RegistryKey^)TO_OBJECT(arg0))->GetSubKeyNames());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(RegistryKey^, arg0))->GetSubKeyNames());
 	OS_NATIVE_EXIT(env, that, RegistryKey_1GetSubKeyNames_FUNC);
 	return rc;
 }
@@ -9478,7 +9478,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(RegistryKey_1GetValue)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, RegistryKey_1GetValue_FUNC);
-	rc = (jint)TO_HANDLE(((RegistryKey^)TO_OBJECT(arg0))->GetValue((String^)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(RegistryKey^, arg0))->GetValue((String^)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, RegistryKey_1GetValue_FUNC);
 	return rc;
 }
@@ -9491,7 +9491,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(RegistryKey_1OpenSubKey)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, RegistryKey_1OpenSubKey_FUNC);
-	rc = (jint)TO_HANDLE(((RegistryKey^)TO_OBJECT(arg0))->OpenSubKey((String^)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(RegistryKey^, arg0))->OpenSubKey((String^)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, RegistryKey_1OpenSubKey_FUNC);
 	return rc;
 }
@@ -9516,7 +9516,7 @@ JNIEXPORT void JNICALL OS_NATIVE(RelativeSource_1AncestorType)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, RelativeSource_1AncestorType_FUNC);
-	((RelativeSource^)TO_OBJECT(arg0))->AncestorType = ((Type^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(RelativeSource^, arg0))->AncestorType = ((Type^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, RelativeSource_1AncestorType_FUNC);
 }
 #endif
@@ -9562,7 +9562,7 @@ JNIEXPORT void JNICALL OS_NATIVE(RenderTargetBitmap_1Render)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, RenderTargetBitmap_1Render_FUNC);
-	((RenderTargetBitmap^)TO_OBJECT(arg0))->Render((Visual^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(RenderTargetBitmap^, arg0))->Render((Visual^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, RenderTargetBitmap_1Render_FUNC);
 }
 #endif
@@ -9586,7 +9586,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ResourceDictionary_1Source)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ResourceDictionary_1Source_FUNC);
-	((ResourceDictionary^)TO_OBJECT(arg0))->Source = ((Uri^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ResourceDictionary^, arg0))->Source = ((Uri^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ResourceDictionary_1Source_FUNC);
 }
 #endif
@@ -9597,7 +9597,7 @@ JNIEXPORT void JNICALL OS_NATIVE(RoutedEventArgs_1Handled)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, RoutedEventArgs_1Handled_FUNC);
-	((RoutedEventArgs^)TO_OBJECT(arg0))->Handled = (arg1);
+	(TO_OBJECT_AS(RoutedEventArgs^, arg0))->Handled = (arg1);
 	OS_NATIVE_EXIT(env, that, RoutedEventArgs_1Handled_FUNC);
 }
 #endif
@@ -9609,7 +9609,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(RoutedEventArgs_1OriginalSource)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, RoutedEventArgs_1OriginalSource_FUNC);
-	rc = (jint)TO_HANDLE(((RoutedEventArgs^)TO_OBJECT(arg0))->OriginalSource);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(RoutedEventArgs^, arg0))->OriginalSource);
 	OS_NATIVE_EXIT(env, that, RoutedEventArgs_1OriginalSource_FUNC);
 	return rc;
 }
@@ -9622,7 +9622,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(RoutedEventArgs_1Source)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, RoutedEventArgs_1Source_FUNC);
-	rc = (jint)TO_HANDLE(((RoutedEventArgs^)TO_OBJECT(arg0))->Source);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(RoutedEventArgs^, arg0))->Source);
 	OS_NATIVE_EXIT(env, that, RoutedEventArgs_1Source_FUNC);
 	return rc;
 }
@@ -9648,7 +9648,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(RoutedPropertyChangedEventArgs_1NewValue)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, RoutedPropertyChangedEventArgs_1NewValue_FUNC);
-	rc = (jint)TO_HANDLE(((RoutedPropertyChangedEventArgs<Object^>^)TO_OBJECT(arg0))->NewValue);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(RoutedPropertyChangedEventArgs<Object^>^, arg0))->NewValue);
 	OS_NATIVE_EXIT(env, that, RoutedPropertyChangedEventArgs_1NewValue_FUNC);
 	return rc;
 }
@@ -9661,7 +9661,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(RoutedPropertyChangedEventArgs_1OldValue)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, RoutedPropertyChangedEventArgs_1OldValue_FUNC);
-	rc = (jint)TO_HANDLE(((RoutedPropertyChangedEventArgs<Object^>^)TO_OBJECT(arg0))->OldValue);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(RoutedPropertyChangedEventArgs<Object^>^, arg0))->OldValue);
 	OS_NATIVE_EXIT(env, that, RoutedPropertyChangedEventArgs_1OldValue_FUNC);
 	return rc;
 }
@@ -9673,7 +9673,7 @@ JNIEXPORT void JNICALL OS_NATIVE(RowDefinitionCollection_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, RowDefinitionCollection_1Add_FUNC);
-	((RowDefinitionCollection^)TO_OBJECT(arg0))->Add((RowDefinition^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(RowDefinitionCollection^, arg0))->Add((RowDefinition^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, RowDefinitionCollection_1Add_FUNC);
 }
 #endif
@@ -9684,7 +9684,7 @@ JNIEXPORT void JNICALL OS_NATIVE(RowDefinition_1Height)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, RowDefinition_1Height_FUNC);
-	((RowDefinition^)TO_OBJECT(arg0))->Height = ((GridLength)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(RowDefinition^, arg0))->Height = ((GridLength)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, RowDefinition_1Height_FUNC);
 }
 #endif
@@ -9695,7 +9695,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Run_1Text)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Run_1Text_FUNC);
-	((Run^)TO_OBJECT(arg0))->Text = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Run^, arg0))->Text = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Run_1Text_FUNC);
 }
 #endif
@@ -9706,7 +9706,7 @@ JNIEXPORT void JNICALL OS_NATIVE(SaveFileDialog_1OverwritePrompt)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, SaveFileDialog_1OverwritePrompt_FUNC);
-	((SaveFileDialog^)TO_OBJECT(arg0))->OverwritePrompt = (arg1);
+	(TO_OBJECT_AS(SaveFileDialog^, arg0))->OverwritePrompt = (arg1);
 	OS_NATIVE_EXIT(env, that, SaveFileDialog_1OverwritePrompt_FUNC);
 }
 #endif
@@ -9731,7 +9731,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Screen_1Bounds)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Screen_1Bounds_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::Screen^)TO_OBJECT(arg0))->Bounds);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::Screen^, arg0))->Bounds);
 	OS_NATIVE_EXIT(env, that, Screen_1Bounds_FUNC);
 	return rc;
 }
@@ -9757,7 +9757,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Screen_1WorkingArea)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Screen_1WorkingArea_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::Screen^)TO_OBJECT(arg0))->WorkingArea);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::Screen^, arg0))->WorkingArea);
 	OS_NATIVE_EXIT(env, that, Screen_1WorkingArea_FUNC);
 	return rc;
 }
@@ -9770,7 +9770,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScrollBar_1Orientation__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ScrollBar_1Orientation__I_FUNC);
-	rc = (jint)((ScrollBar^)TO_OBJECT(arg0))->Orientation;
+	rc = (jint)(TO_OBJECT_AS(ScrollBar^, arg0))->Orientation;
 	OS_NATIVE_EXIT(env, that, ScrollBar_1Orientation__I_FUNC);
 	return rc;
 }
@@ -9782,7 +9782,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ScrollBar_1Orientation__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ScrollBar_1Orientation__II_FUNC);
-	((ScrollBar^)TO_OBJECT(arg0))->Orientation = ((Orientation)arg1);
+	(TO_OBJECT_AS(ScrollBar^, arg0))->Orientation = ((Orientation)arg1);
 	OS_NATIVE_EXIT(env, that, ScrollBar_1Orientation__II_FUNC);
 }
 #endif
@@ -9793,7 +9793,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ScrollBar_1Scroll)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ScrollBar_1Scroll_FUNC);
-	((ScrollBar^)TO_OBJECT(arg0))->Scroll += ((ScrollEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ScrollBar^, arg0))->Scroll += ((ScrollEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ScrollBar_1Scroll_FUNC);
 }
 #endif
@@ -9805,7 +9805,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScrollBar_1Track)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ScrollBar_1Track_FUNC);
-	rc = (jint)TO_HANDLE(((ScrollBar^)TO_OBJECT(arg0))->Track);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(ScrollBar^, arg0))->Track);
 	OS_NATIVE_EXIT(env, that, ScrollBar_1Track_FUNC);
 	return rc;
 }
@@ -9818,7 +9818,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(ScrollBar_1ViewportSize__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, ScrollBar_1ViewportSize__I_FUNC);
-	rc = (jdouble)((ScrollBar^)TO_OBJECT(arg0))->ViewportSize;
+	rc = (jdouble)(TO_OBJECT_AS(ScrollBar^, arg0))->ViewportSize;
 	OS_NATIVE_EXIT(env, that, ScrollBar_1ViewportSize__I_FUNC);
 	return rc;
 }
@@ -9830,7 +9830,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ScrollBar_1ViewportSize__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, ScrollBar_1ViewportSize__ID_FUNC);
-	((ScrollBar^)TO_OBJECT(arg0))->ViewportSize = (arg1);
+	(TO_OBJECT_AS(ScrollBar^, arg0))->ViewportSize = (arg1);
 	OS_NATIVE_EXIT(env, that, ScrollBar_1ViewportSize__ID_FUNC);
 }
 #endif
@@ -9855,7 +9855,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ScrollEventArgs_1ScrollEventType)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ScrollEventArgs_1ScrollEventType_FUNC);
-	rc = (jint)((ScrollEventArgs^)TO_OBJECT(arg0))->ScrollEventType;
+	rc = (jint)(TO_OBJECT_AS(ScrollEventArgs^, arg0))->ScrollEventType;
 	OS_NATIVE_EXIT(env, that, ScrollEventArgs_1ScrollEventType_FUNC);
 	return rc;
 }
@@ -9867,7 +9867,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ScrollViewer_1ScrollToVerticalOffset)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, ScrollViewer_1ScrollToVerticalOffset_FUNC);
-	((ScrollViewer^)TO_OBJECT(arg0))->ScrollToVerticalOffset(arg1);
+	(TO_OBJECT_AS(ScrollViewer^, arg0))->ScrollToVerticalOffset(arg1);
 	OS_NATIVE_EXIT(env, that, ScrollViewer_1ScrollToVerticalOffset_FUNC);
 }
 #endif
@@ -9901,7 +9901,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(ScrollViewer_1VerticalOffset)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, ScrollViewer_1VerticalOffset_FUNC);
-	rc = (jdouble)((ScrollViewer^)TO_OBJECT(arg0))->VerticalOffset;
+	rc = (jdouble)(TO_OBJECT_AS(ScrollViewer^, arg0))->VerticalOffset;
 	OS_NATIVE_EXIT(env, that, ScrollViewer_1VerticalOffset_FUNC);
 	return rc;
 }
@@ -9927,7 +9927,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SelectionChangedEventArgs_1AddedItems)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, SelectionChangedEventArgs_1AddedItems_FUNC);
-	rc = (jint)TO_HANDLE(((SelectionChangedEventArgs^)TO_OBJECT(arg0))->AddedItems);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(SelectionChangedEventArgs^, arg0))->AddedItems);
 	OS_NATIVE_EXIT(env, that, SelectionChangedEventArgs_1AddedItems_FUNC);
 	return rc;
 }
@@ -9940,7 +9940,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SelectionChangedEventArgs_1RemovedItems)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, SelectionChangedEventArgs_1RemovedItems_FUNC);
-	rc = (jint)TO_HANDLE(((SelectionChangedEventArgs^)TO_OBJECT(arg0))->RemovedItems);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(SelectionChangedEventArgs^, arg0))->RemovedItems);
 	OS_NATIVE_EXIT(env, that, SelectionChangedEventArgs_1RemovedItems_FUNC);
 	return rc;
 }
@@ -9952,7 +9952,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Selector_1IsSynchronizedWithCurrentItem)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, Selector_1IsSynchronizedWithCurrentItem_FUNC);
-	((Selector^)TO_OBJECT(arg0))->IsSynchronizedWithCurrentItem = (arg1);
+	(TO_OBJECT_AS(Selector^, arg0))->IsSynchronizedWithCurrentItem = (arg1);
 	OS_NATIVE_EXIT(env, that, Selector_1IsSynchronizedWithCurrentItem_FUNC);
 }
 #endif
@@ -9964,7 +9964,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Selector_1SelectedIndex__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Selector_1SelectedIndex__I_FUNC);
-	rc = (jint)((Selector^)TO_OBJECT(arg0))->SelectedIndex;
+	rc = (jint)(TO_OBJECT_AS(Selector^, arg0))->SelectedIndex;
 	OS_NATIVE_EXIT(env, that, Selector_1SelectedIndex__I_FUNC);
 	return rc;
 }
@@ -9976,7 +9976,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Selector_1SelectedIndex__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Selector_1SelectedIndex__II_FUNC);
-	((Selector^)TO_OBJECT(arg0))->SelectedIndex = (arg1);
+	(TO_OBJECT_AS(Selector^, arg0))->SelectedIndex = (arg1);
 	OS_NATIVE_EXIT(env, that, Selector_1SelectedIndex__II_FUNC);
 }
 #endif
@@ -9988,7 +9988,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Selector_1SelectedItem)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Selector_1SelectedItem_FUNC);
-	rc = (jint)TO_HANDLE(((Selector^)TO_OBJECT(arg0))->SelectedItem);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Selector^, arg0))->SelectedItem);
 	OS_NATIVE_EXIT(env, that, Selector_1SelectedItem_FUNC);
 	return rc;
 }
@@ -10001,7 +10001,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Selector_1SelectedValue)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Selector_1SelectedValue_FUNC);
-	rc = (jint)TO_HANDLE(((Selector^)TO_OBJECT(arg0))->SelectedValue);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Selector^, arg0))->SelectedValue);
 	OS_NATIVE_EXIT(env, that, Selector_1SelectedValue_FUNC);
 	return rc;
 }
@@ -10013,7 +10013,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Selector_1SelectionChanged)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Selector_1SelectionChanged_FUNC);
-	((Selector^)TO_OBJECT(arg0))->SelectionChanged += ((SelectionChangedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Selector^, arg0))->SelectionChanged += ((SelectionChangedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Selector_1SelectionChanged_FUNC);
 }
 #endif
@@ -10024,7 +10024,7 @@ JNIEXPORT void JNICALL OS_NATIVE(SetterBaseCollection_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, SetterBaseCollection_1Add_FUNC);
-	((SetterBaseCollection^)TO_OBJECT(arg0))->Add((SetterBase^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(SetterBaseCollection^, arg0))->Add((SetterBase^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, SetterBaseCollection_1Add_FUNC);
 }
 #endif
@@ -10035,7 +10035,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Shape_1Fill)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Shape_1Fill_FUNC);
-	((Shape^)TO_OBJECT(arg0))->Fill = ((Brush^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Shape^, arg0))->Fill = ((Brush^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Shape_1Fill_FUNC);
 }
 #endif
@@ -10046,7 +10046,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Shape_1Stroke)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Shape_1Stroke_FUNC);
-	((Shape^)TO_OBJECT(arg0))->Stroke = ((Brush^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Shape^, arg0))->Stroke = ((Brush^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Shape_1Stroke_FUNC);
 }
 #endif
@@ -10057,7 +10057,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Shape_1StrokeThickness)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Shape_1StrokeThickness_FUNC);
-	((Shape^)TO_OBJECT(arg0))->StrokeThickness = (arg1);
+	(TO_OBJECT_AS(Shape^, arg0))->StrokeThickness = (arg1);
 	OS_NATIVE_EXIT(env, that, Shape_1StrokeThickness_FUNC);
 }
 #endif
@@ -10069,7 +10069,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SizeChangedEventArgs_1NewSize)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, SizeChangedEventArgs_1NewSize_FUNC);
-	rc = (jint)TO_HANDLE(((SizeChangedEventArgs^)TO_OBJECT(arg0))->NewSize);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(SizeChangedEventArgs^, arg0))->NewSize);
 	OS_NATIVE_EXIT(env, that, SizeChangedEventArgs_1NewSize_FUNC);
 	return rc;
 }
@@ -10082,7 +10082,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SizeChangedEventArgs_1PreviousSize)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, SizeChangedEventArgs_1PreviousSize_FUNC);
-	rc = (jint)TO_HANDLE(((SizeChangedEventArgs^)TO_OBJECT(arg0))->PreviousSize);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(SizeChangedEventArgs^, arg0))->PreviousSize);
 	OS_NATIVE_EXIT(env, that, SizeChangedEventArgs_1PreviousSize_FUNC);
 	return rc;
 }
@@ -10095,7 +10095,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Size_1Height__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Size_1Height__I_FUNC);
-	rc = (jdouble)((Size ^)TO_OBJECT(arg0))->Height;
+	rc = (jdouble)(TO_OBJECT_AS(Size ^, arg0))->Height;
 	OS_NATIVE_EXIT(env, that, Size_1Height__I_FUNC);
 	return rc;
 }
@@ -10107,7 +10107,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Size_1Height__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Size_1Height__ID_FUNC);
-	((Size ^)TO_OBJECT(arg0))->Height = (arg1);
+	(TO_OBJECT_AS(Size ^, arg0))->Height = (arg1);
 	OS_NATIVE_EXIT(env, that, Size_1Height__ID_FUNC);
 }
 #endif
@@ -10119,7 +10119,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Size_1Width__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Size_1Width__I_FUNC);
-	rc = (jdouble)((Size ^)TO_OBJECT(arg0))->Width;
+	rc = (jdouble)(TO_OBJECT_AS(Size ^, arg0))->Width;
 	OS_NATIVE_EXIT(env, that, Size_1Width__I_FUNC);
 	return rc;
 }
@@ -10131,7 +10131,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Size_1Width__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Size_1Width__ID_FUNC);
-	((Size ^)TO_OBJECT(arg0))->Width = (arg1);
+	(TO_OBJECT_AS(Size ^, arg0))->Width = (arg1);
 	OS_NATIVE_EXIT(env, that, Size_1Width__ID_FUNC);
 }
 #endif
@@ -10142,7 +10142,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Slider_1Orientation)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Slider_1Orientation_FUNC);
-	((Slider ^)TO_OBJECT(arg0))->Orientation = ((Orientation)arg1);
+	(TO_OBJECT_AS(Slider ^, arg0))->Orientation = ((Orientation)arg1);
 	OS_NATIVE_EXIT(env, that, Slider_1Orientation_FUNC);
 }
 #endif
@@ -10153,7 +10153,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Slider_1TickFrequency)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Slider_1TickFrequency_FUNC);
-	((Slider^)TO_OBJECT(arg0))->TickFrequency = (arg1);
+	(TO_OBJECT_AS(Slider^, arg0))->TickFrequency = (arg1);
 	OS_NATIVE_EXIT(env, that, Slider_1TickFrequency_FUNC);
 }
 #endif
@@ -10164,7 +10164,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Slider_1TickPlacement)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Slider_1TickPlacement_FUNC);
-	((Slider^)TO_OBJECT(arg0))->TickPlacement = ((TickPlacement)arg1);
+	(TO_OBJECT_AS(Slider^, arg0))->TickPlacement = ((TickPlacement)arg1);
 	OS_NATIVE_EXIT(env, that, Slider_1TickPlacement_FUNC);
 }
 #endif
@@ -10175,7 +10175,7 @@ JNIEXPORT void JNICALL OS_NATIVE(SplineDoubleKeyFrame_1KeySpline)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, SplineDoubleKeyFrame_1KeySpline_FUNC);
-	((SplineDoubleKeyFrame^)TO_OBJECT(arg0))->KeySpline = ((KeySpline^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(SplineDoubleKeyFrame^, arg0))->KeySpline = ((KeySpline^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, SplineDoubleKeyFrame_1KeySpline_FUNC);
 }
 #endif
@@ -10186,7 +10186,7 @@ JNIEXPORT void JNICALL OS_NATIVE(SplineInt32KeyFrame_1KeySpline)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, SplineInt32KeyFrame_1KeySpline_FUNC);
-	((SplineInt32KeyFrame^)TO_OBJECT(arg0))->KeySpline = ((KeySpline^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(SplineInt32KeyFrame^, arg0))->KeySpline = ((KeySpline^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, SplineInt32KeyFrame_1KeySpline_FUNC);
 }
 #endif
@@ -10197,7 +10197,7 @@ JNIEXPORT void JNICALL OS_NATIVE(StackPanel_1Orientation)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, StackPanel_1Orientation_FUNC);
-	((StackPanel^)TO_OBJECT(arg0))->Orientation = ((Orientation)arg1);
+	(TO_OBJECT_AS(StackPanel^, arg0))->Orientation = ((Orientation)arg1);
 	OS_NATIVE_EXIT(env, that, StackPanel_1Orientation_FUNC);
 }
 #endif
@@ -10234,7 +10234,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Storyboard_1Begin)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jboolean arg2)
 {
 	OS_NATIVE_ENTER(env, that, Storyboard_1Begin_FUNC);
-	((Storyboard^)TO_OBJECT(arg0))->Begin((FrameworkElement^)TO_OBJECT(arg1), arg2);
+	(TO_OBJECT_AS(Storyboard^, arg0))->Begin((FrameworkElement^)TO_OBJECT(arg1), arg2);
 	OS_NATIVE_EXIT(env, that, Storyboard_1Begin_FUNC);
 }
 #endif
@@ -10245,7 +10245,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Storyboard_1Pause)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Storyboard_1Pause_FUNC);
-	((Storyboard^)TO_OBJECT(arg0))->Pause((FrameworkElement^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Storyboard^, arg0))->Pause((FrameworkElement^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Storyboard_1Pause_FUNC);
 }
 #endif
@@ -10256,7 +10256,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Storyboard_1Resume)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Storyboard_1Resume_FUNC);
-	((Storyboard^)TO_OBJECT(arg0))->Resume((FrameworkElement^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Storyboard^, arg0))->Resume((FrameworkElement^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Storyboard_1Resume_FUNC);
 }
 #endif
@@ -10289,7 +10289,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Storyboard_1Stop)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Storyboard_1Stop_FUNC);
-	((Storyboard^)TO_OBJECT(arg0))->Stop((FrameworkElement^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Storyboard^, arg0))->Stop((FrameworkElement^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Storyboard_1Stop_FUNC);
 }
 #endif
@@ -10300,7 +10300,7 @@ JNIEXPORT void JNICALL OS_NATIVE(StreamGeometryContext_1BeginFigure)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jboolean arg2, jboolean arg3)
 {
 	OS_NATIVE_ENTER(env, that, StreamGeometryContext_1BeginFigure_FUNC);
-	((StreamGeometryContext^)TO_OBJECT(arg0))->BeginFigure((Point)TO_OBJECT(arg1), arg2, arg3);
+	(TO_OBJECT_AS(StreamGeometryContext^, arg0))->BeginFigure((Point)TO_OBJECT(arg1), arg2, arg3);
 	OS_NATIVE_EXIT(env, that, StreamGeometryContext_1BeginFigure_FUNC);
 }
 #endif
@@ -10311,7 +10311,7 @@ JNIEXPORT void JNICALL OS_NATIVE(StreamGeometryContext_1Close)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, StreamGeometryContext_1Close_FUNC);
-	((StreamGeometryContext^)TO_OBJECT(arg0))->Close();
+	(TO_OBJECT_AS(StreamGeometryContext^, arg0))->Close();
 	OS_NATIVE_EXIT(env, that, StreamGeometryContext_1Close_FUNC);
 }
 #endif
@@ -10322,7 +10322,7 @@ JNIEXPORT void JNICALL OS_NATIVE(StreamGeometryContext_1LineTo)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jboolean arg2, jboolean arg3)
 {
 	OS_NATIVE_ENTER(env, that, StreamGeometryContext_1LineTo_FUNC);
-	((StreamGeometryContext^)TO_OBJECT(arg0))->LineTo((Point)TO_OBJECT(arg1), arg2, arg3);
+	(TO_OBJECT_AS(StreamGeometryContext^, arg0))->LineTo((Point)TO_OBJECT(arg1), arg2, arg3);
 	OS_NATIVE_EXIT(env, that, StreamGeometryContext_1LineTo_FUNC);
 }
 #endif
@@ -10334,7 +10334,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(StreamGeometry_1Open)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, StreamGeometry_1Open_FUNC);
-	rc = (jint)TO_HANDLE(((StreamGeometry^)TO_OBJECT(arg0))->Open());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(StreamGeometry^, arg0))->Open());
 	OS_NATIVE_EXIT(env, that, StreamGeometry_1Open_FUNC);
 	return rc;
 }
@@ -10347,7 +10347,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(String_1Length)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, String_1Length_FUNC);
-	rc = (jint)((String^)TO_OBJECT(arg0))->Length;
+	rc = (jint)(TO_OBJECT_AS(String^, arg0))->Length;
 	OS_NATIVE_EXIT(env, that, String_1Length_FUNC);
 	return rc;
 }
@@ -10360,7 +10360,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(String_1ToCharArray)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, String_1ToCharArray_FUNC);
-	rc = (jint)TO_HANDLE(((String^)TO_OBJECT(arg0))->ToCharArray());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(String^, arg0))->ToCharArray());
 	OS_NATIVE_EXIT(env, that, String_1ToCharArray_FUNC);
 	return rc;
 }
@@ -10386,7 +10386,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Style_1Setters)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Style_1Setters_FUNC);
-	rc = (jint)TO_HANDLE(((Style^)TO_OBJECT(arg0))->Setters);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Style^, arg0))->Setters);
 	OS_NATIVE_EXIT(env, that, Style_1Setters_FUNC);
 	return rc;
 }
@@ -10970,7 +10970,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TabControl_1TabStripPlacement)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TabControl_1TabStripPlacement_FUNC);
-	((TabControl^)TO_OBJECT(arg0))->TabStripPlacement = ((Dock)arg1);
+	(TO_OBJECT_AS(TabControl^, arg0))->TabStripPlacement = ((Dock)arg1);
 	OS_NATIVE_EXIT(env, that, TabControl_1TabStripPlacement_FUNC);
 }
 #endif
@@ -10982,7 +10982,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(TabItem_1IsSelected)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, TabItem_1IsSelected_FUNC);
-	rc = (jboolean)((TabItem^)TO_OBJECT(arg0))->IsSelected;
+	rc = (jboolean)(TO_OBJECT_AS(TabItem^, arg0))->IsSelected;
 	OS_NATIVE_EXIT(env, that, TabItem_1IsSelected_FUNC);
 	return rc;
 }
@@ -10994,7 +10994,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBlock_1Background)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBlock_1Background_FUNC);
-	((TextBlock^)TO_OBJECT(arg0))->Background = ((Brush^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TextBlock^, arg0))->Background = ((Brush^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TextBlock_1Background_FUNC);
 }
 #endif
@@ -11018,7 +11018,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBlock_1FontFamily)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBlock_1FontFamily_FUNC);
-	((TextBlock^)TO_OBJECT(arg0))->FontFamily = ((FontFamily^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TextBlock^, arg0))->FontFamily = ((FontFamily^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TextBlock_1FontFamily_FUNC);
 }
 #endif
@@ -11042,7 +11042,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBlock_1FontSize)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBlock_1FontSize_FUNC);
-	((TextBlock^)TO_OBJECT(arg0))->FontSize = (arg1);
+	(TO_OBJECT_AS(TextBlock^, arg0))->FontSize = (arg1);
 	OS_NATIVE_EXIT(env, that, TextBlock_1FontSize_FUNC);
 }
 #endif
@@ -11066,7 +11066,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBlock_1FontStretch)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBlock_1FontStretch_FUNC);
-	((TextBlock^)TO_OBJECT(arg0))->FontStretch = ((FontStretch)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TextBlock^, arg0))->FontStretch = ((FontStretch)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TextBlock_1FontStretch_FUNC);
 }
 #endif
@@ -11090,7 +11090,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBlock_1FontStyle)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBlock_1FontStyle_FUNC);
-	((TextBlock^)TO_OBJECT(arg0))->FontStyle = ((FontStyle)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TextBlock^, arg0))->FontStyle = ((FontStyle)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TextBlock_1FontStyle_FUNC);
 }
 #endif
@@ -11114,7 +11114,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBlock_1FontWeight)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBlock_1FontWeight_FUNC);
-	((TextBlock^)TO_OBJECT(arg0))->FontWeight = ((FontWeight)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TextBlock^, arg0))->FontWeight = ((FontWeight)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TextBlock_1FontWeight_FUNC);
 }
 #endif
@@ -11138,7 +11138,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBlock_1Foreground)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBlock_1Foreground_FUNC);
-	((TextBlock^)TO_OBJECT(arg0))->Foreground = ((Brush^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TextBlock^, arg0))->Foreground = ((Brush^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TextBlock_1Foreground_FUNC);
 }
 #endif
@@ -11163,7 +11163,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextBlock_1Inlines)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBlock_1Inlines_FUNC);
-	rc = (jint)TO_HANDLE(((TextBlock^)TO_OBJECT(arg0))->Inlines);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextBlock^, arg0))->Inlines);
 	OS_NATIVE_EXIT(env, that, TextBlock_1Inlines_FUNC);
 	return rc;
 }
@@ -11176,7 +11176,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextBlock_1Text__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBlock_1Text__I_FUNC);
-	rc = (jint)TO_HANDLE(((TextBlock^)TO_OBJECT(arg0))->Text);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextBlock^, arg0))->Text);
 	OS_NATIVE_EXIT(env, that, TextBlock_1Text__I_FUNC);
 	return rc;
 }
@@ -11188,7 +11188,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBlock_1Text__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBlock_1Text__II_FUNC);
-	((TextBlock^)TO_OBJECT(arg0))->Text = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TextBlock^, arg0))->Text = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TextBlock_1Text__II_FUNC);
 }
 #endif
@@ -11226,7 +11226,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextBoundsCollection_1Current)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBoundsCollection_1Current_FUNC);
-	rc = (jint)TO_HANDLE(((IEnumerator^)TO_OBJECT(arg0))->Current);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(IEnumerator^, arg0))->Current);
 	OS_NATIVE_EXIT(env, that, TextBoundsCollection_1Current_FUNC);
 	return rc;
 }
@@ -11239,7 +11239,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextBoundsCollection_1GetEnumerator)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBoundsCollection_1GetEnumerator_FUNC);
-	rc = (jint)TO_HANDLE(((IEnumerable^)TO_OBJECT(arg0))->GetEnumerator());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(IEnumerable^, arg0))->GetEnumerator());
 	OS_NATIVE_EXIT(env, that, TextBoundsCollection_1GetEnumerator_FUNC);
 	return rc;
 }
@@ -11252,7 +11252,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextBounds_1Rectangle)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBounds_1Rectangle_FUNC);
-	rc = (jint)TO_HANDLE(((TextBounds^)TO_OBJECT(arg0))->Rectangle);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextBounds^, arg0))->Rectangle);
 	OS_NATIVE_EXIT(env, that, TextBounds_1Rectangle_FUNC);
 	return rc;
 }
@@ -11264,7 +11264,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBoxBase_1AcceptsReturn)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBoxBase_1AcceptsReturn_FUNC);
-	((TextBoxBase^)TO_OBJECT(arg0))->AcceptsReturn = (arg1);
+	(TO_OBJECT_AS(TextBoxBase^, arg0))->AcceptsReturn = (arg1);
 	OS_NATIVE_EXIT(env, that, TextBoxBase_1AcceptsReturn_FUNC);
 }
 #endif
@@ -11275,7 +11275,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBoxBase_1AcceptsTab)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBoxBase_1AcceptsTab_FUNC);
-	((TextBoxBase^)TO_OBJECT(arg0))->AcceptsTab = (arg1);
+	(TO_OBJECT_AS(TextBoxBase^, arg0))->AcceptsTab = (arg1);
 	OS_NATIVE_EXIT(env, that, TextBoxBase_1AcceptsTab_FUNC);
 }
 #endif
@@ -11286,7 +11286,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBoxBase_1AppendText)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBoxBase_1AppendText_FUNC);
-	((TextBoxBase^)TO_OBJECT(arg0))->AppendText((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TextBoxBase^, arg0))->AppendText((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TextBoxBase_1AppendText_FUNC);
 }
 #endif
@@ -11297,7 +11297,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBoxBase_1Copy)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, TextBoxBase_1Copy_FUNC);
-	((TextBoxBase^)TO_OBJECT(arg0))->Copy();
+	(TO_OBJECT_AS(TextBoxBase^, arg0))->Copy();
 	OS_NATIVE_EXIT(env, that, TextBoxBase_1Copy_FUNC);
 }
 #endif
@@ -11308,7 +11308,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBoxBase_1Cut)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, TextBoxBase_1Cut_FUNC);
-	((TextBoxBase^)TO_OBJECT(arg0))->Cut();
+	(TO_OBJECT_AS(TextBoxBase^, arg0))->Cut();
 	OS_NATIVE_EXIT(env, that, TextBoxBase_1Cut_FUNC);
 }
 #endif
@@ -11319,7 +11319,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBoxBase_1HorizontalScrollBarVisibility)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBoxBase_1HorizontalScrollBarVisibility_FUNC);
-	((TextBoxBase^)TO_OBJECT(arg0))->HorizontalScrollBarVisibility = ((ScrollBarVisibility)arg1);
+	(TO_OBJECT_AS(TextBoxBase^, arg0))->HorizontalScrollBarVisibility = ((ScrollBarVisibility)arg1);
 	OS_NATIVE_EXIT(env, that, TextBoxBase_1HorizontalScrollBarVisibility_FUNC);
 }
 #endif
@@ -11331,7 +11331,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(TextBoxBase_1IsReadOnly__I)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBoxBase_1IsReadOnly__I_FUNC);
-	rc = (jboolean)((TextBoxBase^)TO_OBJECT(arg0))->IsReadOnly;
+	rc = (jboolean)(TO_OBJECT_AS(TextBoxBase^, arg0))->IsReadOnly;
 	OS_NATIVE_EXIT(env, that, TextBoxBase_1IsReadOnly__I_FUNC);
 	return rc;
 }
@@ -11343,7 +11343,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBoxBase_1IsReadOnly__IZ)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBoxBase_1IsReadOnly__IZ_FUNC);
-	((TextBoxBase^)TO_OBJECT(arg0))->IsReadOnly = (arg1);
+	(TO_OBJECT_AS(TextBoxBase^, arg0))->IsReadOnly = (arg1);
 	OS_NATIVE_EXIT(env, that, TextBoxBase_1IsReadOnly__IZ_FUNC);
 }
 #endif
@@ -11354,7 +11354,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBoxBase_1Paste)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, TextBoxBase_1Paste_FUNC);
-	((TextBoxBase^)TO_OBJECT(arg0))->Paste();
+	(TO_OBJECT_AS(TextBoxBase^, arg0))->Paste();
 	OS_NATIVE_EXIT(env, that, TextBoxBase_1Paste_FUNC);
 }
 #endif
@@ -11365,7 +11365,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBoxBase_1ScrollToEnd)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, TextBoxBase_1ScrollToEnd_FUNC);
-	((TextBoxBase^)TO_OBJECT(arg0))->ScrollToEnd();
+	(TO_OBJECT_AS(TextBoxBase^, arg0))->ScrollToEnd();
 	OS_NATIVE_EXIT(env, that, TextBoxBase_1ScrollToEnd_FUNC);
 }
 #endif
@@ -11376,7 +11376,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBoxBase_1ScrollToVerticalOffset)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBoxBase_1ScrollToVerticalOffset_FUNC);
-	((TextBoxBase^)TO_OBJECT(arg0))->ScrollToVerticalOffset(arg1);
+	(TO_OBJECT_AS(TextBoxBase^, arg0))->ScrollToVerticalOffset(arg1);
 	OS_NATIVE_EXIT(env, that, TextBoxBase_1ScrollToVerticalOffset_FUNC);
 }
 #endif
@@ -11387,7 +11387,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBoxBase_1SelectAll)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, TextBoxBase_1SelectAll_FUNC);
-	((TextBoxBase^)TO_OBJECT(arg0))->SelectAll();
+	(TO_OBJECT_AS(TextBoxBase^, arg0))->SelectAll();
 	OS_NATIVE_EXIT(env, that, TextBoxBase_1SelectAll_FUNC);
 }
 #endif
@@ -11398,7 +11398,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBoxBase_1TextChanged)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBoxBase_1TextChanged_FUNC);
-	((TextBoxBase^)TO_OBJECT(arg0))->TextChanged += ((TextChangedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TextBoxBase^, arg0))->TextChanged += ((TextChangedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TextBoxBase_1TextChanged_FUNC);
 }
 #endif
@@ -11410,7 +11410,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(TextBoxBase_1VerticalOffset)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBoxBase_1VerticalOffset_FUNC);
-	rc = (jdouble)((TextBoxBase^)TO_OBJECT(arg0))->VerticalOffset;
+	rc = (jdouble)(TO_OBJECT_AS(TextBoxBase^, arg0))->VerticalOffset;
 	OS_NATIVE_EXIT(env, that, TextBoxBase_1VerticalOffset_FUNC);
 	return rc;
 }
@@ -11422,7 +11422,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBoxBase_1VerticalScrollBarVisibility)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBoxBase_1VerticalScrollBarVisibility_FUNC);
-	((TextBoxBase^)TO_OBJECT(arg0))->VerticalScrollBarVisibility = ((ScrollBarVisibility)arg1);
+	(TO_OBJECT_AS(TextBoxBase^, arg0))->VerticalScrollBarVisibility = ((ScrollBarVisibility)arg1);
 	OS_NATIVE_EXIT(env, that, TextBoxBase_1VerticalScrollBarVisibility_FUNC);
 }
 #endif
@@ -11434,7 +11434,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextBox_1CaretIndex__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBox_1CaretIndex__I_FUNC);
-	rc = (jint)((TextBox^)TO_OBJECT(arg0))->CaretIndex;
+	rc = (jint)(TO_OBJECT_AS(TextBox^, arg0))->CaretIndex;
 	OS_NATIVE_EXIT(env, that, TextBox_1CaretIndex__I_FUNC);
 	return rc;
 }
@@ -11446,7 +11446,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBox_1CaretIndex__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBox_1CaretIndex__II_FUNC);
-	((TextBox^)TO_OBJECT(arg0))->CaretIndex = (arg1);
+	(TO_OBJECT_AS(TextBox^, arg0))->CaretIndex = (arg1);
 	OS_NATIVE_EXIT(env, that, TextBox_1CaretIndex__II_FUNC);
 }
 #endif
@@ -11458,7 +11458,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextBox_1GetFirstVisibleLineIndex)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBox_1GetFirstVisibleLineIndex_FUNC);
-	rc = (jint)((TextBox^)TO_OBJECT(arg0))->GetFirstVisibleLineIndex();
+	rc = (jint)(TO_OBJECT_AS(TextBox^, arg0))->GetFirstVisibleLineIndex();
 	OS_NATIVE_EXIT(env, that, TextBox_1GetFirstVisibleLineIndex_FUNC);
 	return rc;
 }
@@ -11471,7 +11471,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextBox_1GetLineIndexFromCharacterIndex)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBox_1GetLineIndexFromCharacterIndex_FUNC);
-	rc = (jint)((TextBox^)TO_OBJECT(arg0))->GetLineIndexFromCharacterIndex(arg1);
+	rc = (jint)(TO_OBJECT_AS(TextBox^, arg0))->GetLineIndexFromCharacterIndex(arg1);
 	OS_NATIVE_EXIT(env, that, TextBox_1GetLineIndexFromCharacterIndex_FUNC);
 	return rc;
 }
@@ -11484,7 +11484,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextBox_1GetRectFromCharacterIndex)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBox_1GetRectFromCharacterIndex_FUNC);
-	rc = (jint)TO_HANDLE(((TextBox^)TO_OBJECT(arg0))->GetRectFromCharacterIndex(arg1));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextBox^, arg0))->GetRectFromCharacterIndex(arg1));
 	OS_NATIVE_EXIT(env, that, TextBox_1GetRectFromCharacterIndex_FUNC);
 	return rc;
 }
@@ -11497,7 +11497,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextBox_1LineCount)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBox_1LineCount_FUNC);
-	rc = (jint)((TextBox^)TO_OBJECT(arg0))->LineCount;
+	rc = (jint)(TO_OBJECT_AS(TextBox^, arg0))->LineCount;
 	OS_NATIVE_EXIT(env, that, TextBox_1LineCount_FUNC);
 	return rc;
 }
@@ -11510,7 +11510,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextBox_1MaxLength__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBox_1MaxLength__I_FUNC);
-	rc = (jint)((TextBox^)TO_OBJECT(arg0))->MaxLength;
+	rc = (jint)(TO_OBJECT_AS(TextBox^, arg0))->MaxLength;
 	OS_NATIVE_EXIT(env, that, TextBox_1MaxLength__I_FUNC);
 	return rc;
 }
@@ -11522,7 +11522,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBox_1MaxLength__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBox_1MaxLength__II_FUNC);
-	((TextBox^)TO_OBJECT(arg0))->MaxLength = (arg1);
+	(TO_OBJECT_AS(TextBox^, arg0))->MaxLength = (arg1);
 	OS_NATIVE_EXIT(env, that, TextBox_1MaxLength__II_FUNC);
 }
 #endif
@@ -11533,7 +11533,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBox_1ScrollToLine)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBox_1ScrollToLine_FUNC);
-	((TextBox^)TO_OBJECT(arg0))->ScrollToLine(arg1);
+	(TO_OBJECT_AS(TextBox^, arg0))->ScrollToLine(arg1);
 	OS_NATIVE_EXIT(env, that, TextBox_1ScrollToLine_FUNC);
 }
 #endif
@@ -11544,7 +11544,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBox_1Select)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, TextBox_1Select_FUNC);
-	((TextBox^)TO_OBJECT(arg0))->Select(arg1, arg2);
+	(TO_OBJECT_AS(TextBox^, arg0))->Select(arg1, arg2);
 	OS_NATIVE_EXIT(env, that, TextBox_1Select_FUNC);
 }
 #endif
@@ -11556,7 +11556,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextBox_1SelectedText__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBox_1SelectedText__I_FUNC);
-	rc = (jint)TO_HANDLE(((TextBox^)TO_OBJECT(arg0))->SelectedText);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextBox^, arg0))->SelectedText);
 	OS_NATIVE_EXIT(env, that, TextBox_1SelectedText__I_FUNC);
 	return rc;
 }
@@ -11568,7 +11568,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBox_1SelectedText__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBox_1SelectedText__II_FUNC);
-	((TextBox^)TO_OBJECT(arg0))->SelectedText = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TextBox^, arg0))->SelectedText = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TextBox_1SelectedText__II_FUNC);
 }
 #endif
@@ -11580,7 +11580,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextBox_1SelectionLength__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBox_1SelectionLength__I_FUNC);
-	rc = (jint)((TextBox^)TO_OBJECT(arg0))->SelectionLength;
+	rc = (jint)(TO_OBJECT_AS(TextBox^, arg0))->SelectionLength;
 	OS_NATIVE_EXIT(env, that, TextBox_1SelectionLength__I_FUNC);
 	return rc;
 }
@@ -11592,7 +11592,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBox_1SelectionLength__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBox_1SelectionLength__II_FUNC);
-	((TextBox^)TO_OBJECT(arg0))->SelectionLength = (arg1);
+	(TO_OBJECT_AS(TextBox^, arg0))->SelectionLength = (arg1);
 	OS_NATIVE_EXIT(env, that, TextBox_1SelectionLength__II_FUNC);
 }
 #endif
@@ -11604,7 +11604,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextBox_1SelectionStart__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBox_1SelectionStart__I_FUNC);
-	rc = (jint)((TextBox^)TO_OBJECT(arg0))->SelectionStart;
+	rc = (jint)(TO_OBJECT_AS(TextBox^, arg0))->SelectionStart;
 	OS_NATIVE_EXIT(env, that, TextBox_1SelectionStart__I_FUNC);
 	return rc;
 }
@@ -11616,7 +11616,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBox_1SelectionStart__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBox_1SelectionStart__II_FUNC);
-	((TextBox^)TO_OBJECT(arg0))->SelectionStart = (arg1);
+	(TO_OBJECT_AS(TextBox^, arg0))->SelectionStart = (arg1);
 	OS_NATIVE_EXIT(env, that, TextBox_1SelectionStart__II_FUNC);
 }
 #endif
@@ -11628,7 +11628,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextBox_1Text__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextBox_1Text__I_FUNC);
-	rc = (jint)TO_HANDLE(((TextBox^)TO_OBJECT(arg0))->Text);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextBox^, arg0))->Text);
 	OS_NATIVE_EXIT(env, that, TextBox_1Text__I_FUNC);
 	return rc;
 }
@@ -11640,7 +11640,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBox_1Text__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBox_1Text__II_FUNC);
-	((TextBox^)TO_OBJECT(arg0))->Text = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TextBox^, arg0))->Text = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TextBox_1Text__II_FUNC);
 }
 #endif
@@ -11651,7 +11651,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextBox_1TextWrapping)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextBox_1TextWrapping_FUNC);
-	((TextBox^)TO_OBJECT(arg0))->TextWrapping = ((TextWrapping)arg1);
+	(TO_OBJECT_AS(TextBox^, arg0))->TextWrapping = ((TextWrapping)arg1);
 	OS_NATIVE_EXIT(env, that, TextBox_1TextWrapping_FUNC);
 }
 #endif
@@ -11663,7 +11663,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextCompositionEventArgs_1ControlText)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextCompositionEventArgs_1ControlText_FUNC);
-	rc = (jint)TO_HANDLE(((TextCompositionEventArgs^)TO_OBJECT(arg0))->ControlText);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextCompositionEventArgs^, arg0))->ControlText);
 	OS_NATIVE_EXIT(env, that, TextCompositionEventArgs_1ControlText_FUNC);
 	return rc;
 }
@@ -11675,7 +11675,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextCompositionEventArgs_1Handled)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextCompositionEventArgs_1Handled_FUNC);
-	((TextCompositionEventArgs^)TO_OBJECT(arg0))->Handled = (arg1);
+	(TO_OBJECT_AS(TextCompositionEventArgs^, arg0))->Handled = (arg1);
 	OS_NATIVE_EXIT(env, that, TextCompositionEventArgs_1Handled_FUNC);
 }
 #endif
@@ -11687,7 +11687,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextCompositionEventArgs_1SystemText)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextCompositionEventArgs_1SystemText_FUNC);
-	rc = (jint)TO_HANDLE(((TextCompositionEventArgs^)TO_OBJECT(arg0))->SystemText);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextCompositionEventArgs^, arg0))->SystemText);
 	OS_NATIVE_EXIT(env, that, TextCompositionEventArgs_1SystemText_FUNC);
 	return rc;
 }
@@ -11700,7 +11700,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextCompositionEventArgs_1Text)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextCompositionEventArgs_1Text_FUNC);
-	rc = (jint)TO_HANDLE(((TextCompositionEventArgs^)TO_OBJECT(arg0))->Text);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextCompositionEventArgs^, arg0))->Text);
 	OS_NATIVE_EXIT(env, that, TextCompositionEventArgs_1Text_FUNC);
 	return rc;
 }
@@ -11712,7 +11712,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextDecorationCollection_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextDecorationCollection_1Add_FUNC);
-	((TextDecorationCollection^)TO_OBJECT(arg0))->Add((TextDecoration^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TextDecorationCollection^, arg0))->Add((TextDecoration^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TextDecorationCollection_1Add_FUNC);
 }
 #endif
@@ -11763,7 +11763,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextFormatter_1FormatLine)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextFormatter_1FormatLine_FUNC);
-	rc = (jint)TO_HANDLE(((TextFormatter^)TO_OBJECT(arg0))->FormatLine((TextSource^)TO_OBJECT(arg1), arg2, arg3, (TextParagraphProperties^)TO_OBJECT(arg4), (TextLineBreak^)TO_OBJECT(arg5)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextFormatter^, arg0))->FormatLine((TextSource^)TO_OBJECT(arg1), arg2, arg3, (TextParagraphProperties^)TO_OBJECT(arg4), (TextLineBreak^)TO_OBJECT(arg5)));
 	OS_NATIVE_EXIT(env, that, TextFormatter_1FormatLine_FUNC);
 	return rc;
 }
@@ -11776,7 +11776,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(TextLine_1Baseline)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, TextLine_1Baseline_FUNC);
-	rc = (jdouble)((TextLine^)TO_OBJECT(arg0))->Baseline;
+	rc = (jdouble)(TO_OBJECT_AS(TextLine^, arg0))->Baseline;
 	OS_NATIVE_EXIT(env, that, TextLine_1Baseline_FUNC);
 	return rc;
 }
@@ -11788,7 +11788,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextLine_1Draw)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jint arg3)
 {
 	OS_NATIVE_ENTER(env, that, TextLine_1Draw_FUNC);
-	((TextLine^)TO_OBJECT(arg0))->Draw((DrawingContext^)TO_OBJECT(arg1), (Point)TO_OBJECT(arg2), (InvertAxes)arg3);
+	(TO_OBJECT_AS(TextLine^, arg0))->Draw((DrawingContext^)TO_OBJECT(arg1), (Point)TO_OBJECT(arg2), (InvertAxes)arg3);
 	OS_NATIVE_EXIT(env, that, TextLine_1Draw_FUNC);
 }
 #endif
@@ -11800,7 +11800,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextLine_1GetCharacterHitFromDistance)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextLine_1GetCharacterHitFromDistance_FUNC);
-	rc = (jint)TO_HANDLE(((TextLine^)TO_OBJECT(arg0))->GetCharacterHitFromDistance(arg1));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextLine^, arg0))->GetCharacterHitFromDistance(arg1));
 	OS_NATIVE_EXIT(env, that, TextLine_1GetCharacterHitFromDistance_FUNC);
 	return rc;
 }
@@ -11813,7 +11813,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(TextLine_1GetDistanceFromCharacterHit)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, TextLine_1GetDistanceFromCharacterHit_FUNC);
-	rc = (jdouble)((TextLine^)TO_OBJECT(arg0))->GetDistanceFromCharacterHit((CharacterHit)TO_OBJECT(arg1));
+	rc = (jdouble)(TO_OBJECT_AS(TextLine^, arg0))->GetDistanceFromCharacterHit((CharacterHit)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TextLine_1GetDistanceFromCharacterHit_FUNC);
 	return rc;
 }
@@ -11826,7 +11826,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextLine_1GetIndexedGlyphRuns)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextLine_1GetIndexedGlyphRuns_FUNC);
-	rc = (jint)TO_HANDLE(((TextLine^)TO_OBJECT(arg0))->GetIndexedGlyphRuns());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextLine^, arg0))->GetIndexedGlyphRuns());
 	OS_NATIVE_EXIT(env, that, TextLine_1GetIndexedGlyphRuns_FUNC);
 	return rc;
 }
@@ -11839,7 +11839,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextLine_1GetNextCaretCharacterHit)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextLine_1GetNextCaretCharacterHit_FUNC);
-	rc = (jint)TO_HANDLE(((TextLine^)TO_OBJECT(arg0))->GetNextCaretCharacterHit((CharacterHit)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextLine^, arg0))->GetNextCaretCharacterHit((CharacterHit)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, TextLine_1GetNextCaretCharacterHit_FUNC);
 	return rc;
 }
@@ -11852,7 +11852,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextLine_1GetPreviousCaretCharacterHit)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextLine_1GetPreviousCaretCharacterHit_FUNC);
-	rc = (jint)TO_HANDLE(((TextLine^)TO_OBJECT(arg0))->GetPreviousCaretCharacterHit((CharacterHit)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextLine^, arg0))->GetPreviousCaretCharacterHit((CharacterHit)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, TextLine_1GetPreviousCaretCharacterHit_FUNC);
 	return rc;
 }
@@ -11865,7 +11865,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextLine_1GetTextBounds)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextLine_1GetTextBounds_FUNC);
-	rc = (jint)TO_HANDLE(((TextLine^)TO_OBJECT(arg0))->GetTextBounds(arg1, arg2));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextLine^, arg0))->GetTextBounds(arg1, arg2));
 	OS_NATIVE_EXIT(env, that, TextLine_1GetTextBounds_FUNC);
 	return rc;
 }
@@ -11878,7 +11878,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextLine_1GetTextLineBreak)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextLine_1GetTextLineBreak_FUNC);
-	rc = (jint)TO_HANDLE(((TextLine^)TO_OBJECT(arg0))->GetTextLineBreak());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TextLine^, arg0))->GetTextLineBreak());
 	OS_NATIVE_EXIT(env, that, TextLine_1GetTextLineBreak_FUNC);
 	return rc;
 }
@@ -11891,7 +11891,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(TextLine_1Height)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, TextLine_1Height_FUNC);
-	rc = (jdouble)((TextLine^)TO_OBJECT(arg0))->Height;
+	rc = (jdouble)(TO_OBJECT_AS(TextLine^, arg0))->Height;
 	OS_NATIVE_EXIT(env, that, TextLine_1Height_FUNC);
 	return rc;
 }
@@ -11904,7 +11904,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextLine_1Length)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextLine_1Length_FUNC);
-	rc = (jint)((TextLine^)TO_OBJECT(arg0))->Length;
+	rc = (jint)(TO_OBJECT_AS(TextLine^, arg0))->Length;
 	OS_NATIVE_EXIT(env, that, TextLine_1Length_FUNC);
 	return rc;
 }
@@ -11917,7 +11917,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TextLine_1NewlineLength)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TextLine_1NewlineLength_FUNC);
-	rc = (jint)((TextLine^)TO_OBJECT(arg0))->NewlineLength;
+	rc = (jint)(TO_OBJECT_AS(TextLine^, arg0))->NewlineLength;
 	OS_NATIVE_EXIT(env, that, TextLine_1NewlineLength_FUNC);
 	return rc;
 }
@@ -11930,7 +11930,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(TextLine_1Start)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, TextLine_1Start_FUNC);
-	rc = (jdouble)((TextLine^)TO_OBJECT(arg0))->Start;
+	rc = (jdouble)(TO_OBJECT_AS(TextLine^, arg0))->Start;
 	OS_NATIVE_EXIT(env, that, TextLine_1Start_FUNC);
 	return rc;
 }
@@ -11943,7 +11943,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(TextLine_1Width)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, TextLine_1Width_FUNC);
-	rc = (jdouble)((TextLine^)TO_OBJECT(arg0))->Width;
+	rc = (jdouble)(TO_OBJECT_AS(TextLine^, arg0))->Width;
 	OS_NATIVE_EXIT(env, that, TextLine_1Width_FUNC);
 	return rc;
 }
@@ -11956,7 +11956,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(TextLine_1WidthIncludingTrailingWhitespace)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, TextLine_1WidthIncludingTrailingWhitespace_FUNC);
-	rc = (jdouble)((TextLine^)TO_OBJECT(arg0))->WidthIncludingTrailingWhitespace;
+	rc = (jdouble)(TO_OBJECT_AS(TextLine^, arg0))->WidthIncludingTrailingWhitespace;
 	OS_NATIVE_EXIT(env, that, TextLine_1WidthIncludingTrailingWhitespace_FUNC);
 	return rc;
 }
@@ -11968,7 +11968,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TextTabPropertiesCollection_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TextTabPropertiesCollection_1Add_FUNC);
-	((System::Collections::Generic::IList<TextTabProperties^>^)TO_OBJECT(arg0))->Add((TextTabProperties^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Collections::Generic::IList<TextTabProperties^>^, arg0))->Add((TextTabProperties^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TextTabPropertiesCollection_1Add_FUNC);
 }
 #endif
@@ -11980,7 +11980,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Thickness_1Bottom)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Thickness_1Bottom_FUNC);
-	rc = (jdouble)((Thickness^)TO_OBJECT(arg0))->Bottom;
+	rc = (jdouble)(TO_OBJECT_AS(Thickness^, arg0))->Bottom;
 	OS_NATIVE_EXIT(env, that, Thickness_1Bottom_FUNC);
 	return rc;
 }
@@ -11993,7 +11993,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Thickness_1Left)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Thickness_1Left_FUNC);
-	rc = (jdouble)((Thickness^)TO_OBJECT(arg0))->Left;
+	rc = (jdouble)(TO_OBJECT_AS(Thickness^, arg0))->Left;
 	OS_NATIVE_EXIT(env, that, Thickness_1Left_FUNC);
 	return rc;
 }
@@ -12006,7 +12006,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Thickness_1Right)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Thickness_1Right_FUNC);
-	rc = (jdouble)((Thickness^)TO_OBJECT(arg0))->Right;
+	rc = (jdouble)(TO_OBJECT_AS(Thickness^, arg0))->Right;
 	OS_NATIVE_EXIT(env, that, Thickness_1Right_FUNC);
 	return rc;
 }
@@ -12019,7 +12019,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Thickness_1Top)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Thickness_1Top_FUNC);
-	rc = (jdouble)((Thickness^)TO_OBJECT(arg0))->Top;
+	rc = (jdouble)(TO_OBJECT_AS(Thickness^, arg0))->Top;
 	OS_NATIVE_EXIT(env, that, Thickness_1Top_FUNC);
 	return rc;
 }
@@ -12044,7 +12044,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TileBrush_1AlignmentX)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TileBrush_1AlignmentX_FUNC);
-	((TileBrush^)TO_OBJECT(arg0))->AlignmentX = ((AlignmentX)arg1);
+	(TO_OBJECT_AS(TileBrush^, arg0))->AlignmentX = ((AlignmentX)arg1);
 	OS_NATIVE_EXIT(env, that, TileBrush_1AlignmentX_FUNC);
 }
 #endif
@@ -12055,7 +12055,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TileBrush_1AlignmentY)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TileBrush_1AlignmentY_FUNC);
-	((TileBrush^)TO_OBJECT(arg0))->AlignmentY = ((AlignmentY)arg1);
+	(TO_OBJECT_AS(TileBrush^, arg0))->AlignmentY = ((AlignmentY)arg1);
 	OS_NATIVE_EXIT(env, that, TileBrush_1AlignmentY_FUNC);
 }
 #endif
@@ -12066,7 +12066,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TileBrush_1Stretch)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TileBrush_1Stretch_FUNC);
-	((TileBrush^)TO_OBJECT(arg0))->Stretch = ((Stretch)arg1);
+	(TO_OBJECT_AS(TileBrush^, arg0))->Stretch = ((Stretch)arg1);
 	OS_NATIVE_EXIT(env, that, TileBrush_1Stretch_FUNC);
 }
 #endif
@@ -12077,7 +12077,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TileBrush_1TileMode)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TileBrush_1TileMode_FUNC);
-	((TileBrush^)TO_OBJECT(arg0))->TileMode = ((TileMode)arg1);
+	(TO_OBJECT_AS(TileBrush^, arg0))->TileMode = ((TileMode)arg1);
 	OS_NATIVE_EXIT(env, that, TileBrush_1TileMode_FUNC);
 }
 #endif
@@ -12088,7 +12088,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TileBrush_1Viewport)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TileBrush_1Viewport_FUNC);
-	((TileBrush^)TO_OBJECT(arg0))->Viewport = ((Rect)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TileBrush^, arg0))->Viewport = ((Rect)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TileBrush_1Viewport_FUNC);
 }
 #endif
@@ -12099,7 +12099,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TileBrush_1ViewportUnits)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TileBrush_1ViewportUnits_FUNC);
-	((TileBrush^)TO_OBJECT(arg0))->ViewportUnits = ((BrushMappingMode)arg1);
+	(TO_OBJECT_AS(TileBrush^, arg0))->ViewportUnits = ((BrushMappingMode)arg1);
 	OS_NATIVE_EXIT(env, that, TileBrush_1ViewportUnits_FUNC);
 }
 #endif
@@ -12124,7 +12124,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(TimeSpan_1TotalMilliseconds)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, TimeSpan_1TotalMilliseconds_FUNC);
-	rc = (jdouble)((TimeSpan^)TO_OBJECT(arg0))->TotalMilliseconds;
+	rc = (jdouble)(TO_OBJECT_AS(TimeSpan^, arg0))->TotalMilliseconds;
 	OS_NATIVE_EXIT(env, that, TimeSpan_1TotalMilliseconds_FUNC);
 	return rc;
 }
@@ -12137,7 +12137,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TimelineGroup_1Children)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TimelineGroup_1Children_FUNC);
-	rc = (jint)TO_HANDLE(((TimelineGroup^)TO_OBJECT(arg0))->Children);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TimelineGroup^, arg0))->Children);
 	OS_NATIVE_EXIT(env, that, TimelineGroup_1Children_FUNC);
 	return rc;
 }
@@ -12150,7 +12150,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Timeline_1AccelerationRatio__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Timeline_1AccelerationRatio__I_FUNC);
-	rc = (jdouble)((Timeline^)TO_OBJECT(arg0))->AccelerationRatio;
+	rc = (jdouble)(TO_OBJECT_AS(Timeline^, arg0))->AccelerationRatio;
 	OS_NATIVE_EXIT(env, that, Timeline_1AccelerationRatio__I_FUNC);
 	return rc;
 }
@@ -12162,7 +12162,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Timeline_1AccelerationRatio__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Timeline_1AccelerationRatio__ID_FUNC);
-	((Timeline^)TO_OBJECT(arg0))->AccelerationRatio = (arg1);
+	(TO_OBJECT_AS(Timeline^, arg0))->AccelerationRatio = (arg1);
 	OS_NATIVE_EXIT(env, that, Timeline_1AccelerationRatio__ID_FUNC);
 }
 #endif
@@ -12173,7 +12173,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Timeline_1AutoReverse)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, Timeline_1AutoReverse_FUNC);
-	((Timeline^)TO_OBJECT(arg0))->AutoReverse = (arg1);
+	(TO_OBJECT_AS(Timeline^, arg0))->AutoReverse = (arg1);
 	OS_NATIVE_EXIT(env, that, Timeline_1AutoReverse_FUNC);
 }
 #endif
@@ -12185,7 +12185,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Timeline_1BeginTime__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Timeline_1BeginTime__I_FUNC);
-	rc = (jint)TO_HANDLE(((Timeline^)TO_OBJECT(arg0))->BeginTime);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Timeline^, arg0))->BeginTime);
 	OS_NATIVE_EXIT(env, that, Timeline_1BeginTime__I_FUNC);
 	return rc;
 }
@@ -12197,7 +12197,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Timeline_1Completed)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Timeline_1Completed_FUNC);
-	((Timeline^)TO_OBJECT(arg0))->Completed += ((EventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Timeline^, arg0))->Completed += ((EventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Timeline_1Completed_FUNC);
 }
 #endif
@@ -12209,7 +12209,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Timeline_1DecelerationRatio__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Timeline_1DecelerationRatio__I_FUNC);
-	rc = (jdouble)((Timeline^)TO_OBJECT(arg0))->DecelerationRatio;
+	rc = (jdouble)(TO_OBJECT_AS(Timeline^, arg0))->DecelerationRatio;
 	OS_NATIVE_EXIT(env, that, Timeline_1DecelerationRatio__I_FUNC);
 	return rc;
 }
@@ -12221,7 +12221,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Timeline_1DecelerationRatio__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Timeline_1DecelerationRatio__ID_FUNC);
-	((Timeline^)TO_OBJECT(arg0))->DecelerationRatio = (arg1);
+	(TO_OBJECT_AS(Timeline^, arg0))->DecelerationRatio = (arg1);
 	OS_NATIVE_EXIT(env, that, Timeline_1DecelerationRatio__ID_FUNC);
 }
 #endif
@@ -12233,7 +12233,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Timeline_1Duration__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Timeline_1Duration__I_FUNC);
-	rc = (jint)TO_HANDLE(((Timeline^)TO_OBJECT(arg0))->Duration);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Timeline^, arg0))->Duration);
 	OS_NATIVE_EXIT(env, that, Timeline_1Duration__I_FUNC);
 	return rc;
 }
@@ -12245,7 +12245,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Timeline_1Duration__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Timeline_1Duration__II_FUNC);
-	((Timeline^)TO_OBJECT(arg0))->Duration = ((Duration)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Timeline^, arg0))->Duration = ((Duration)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Timeline_1Duration__II_FUNC);
 }
 #endif
@@ -12256,7 +12256,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Timeline_1RepeatBehavior)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Timeline_1RepeatBehavior_FUNC);
-	((Timeline^)TO_OBJECT(arg0))->RepeatBehavior = ((RepeatBehavior)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Timeline^, arg0))->RepeatBehavior = ((RepeatBehavior)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Timeline_1RepeatBehavior_FUNC);
 }
 #endif
@@ -12267,7 +12267,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ToggleButton_1Checked)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ToggleButton_1Checked_FUNC);
-	((ToggleButton^)TO_OBJECT(arg0))->Checked += ((RoutedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ToggleButton^, arg0))->Checked += ((RoutedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ToggleButton_1Checked_FUNC);
 }
 #endif
@@ -12305,7 +12305,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ToggleButton_1IsChecked__I)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, ToggleButton_1IsChecked__I_FUNC);
-	rc = (jboolean)((ToggleButton ^)TO_OBJECT(arg0))->IsChecked;
+	rc = (jboolean)(TO_OBJECT_AS(ToggleButton ^, arg0))->IsChecked;
 	OS_NATIVE_EXIT(env, that, ToggleButton_1IsChecked__I_FUNC);
 	return rc;
 }
@@ -12317,7 +12317,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ToggleButton_1IsChecked__IZ)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, ToggleButton_1IsChecked__IZ_FUNC);
-	((ToggleButton ^)TO_OBJECT(arg0))->IsChecked = (arg1);
+	(TO_OBJECT_AS(ToggleButton ^, arg0))->IsChecked = (arg1);
 	OS_NATIVE_EXIT(env, that, ToggleButton_1IsChecked__IZ_FUNC);
 }
 #endif
@@ -12354,7 +12354,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ToggleButton_1Unchecked)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ToggleButton_1Unchecked_FUNC);
-	((ToggleButton^)TO_OBJECT(arg0))->Unchecked += ((RoutedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ToggleButton^, arg0))->Unchecked += ((RoutedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ToggleButton_1Unchecked_FUNC);
 }
 #endif
@@ -12378,7 +12378,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ToolBarTray_1Background)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ToolBarTray_1Background_FUNC);
-	((ToolBarTray^)TO_OBJECT(arg0))->Background = ((Brush^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(ToolBarTray^, arg0))->Background = ((Brush^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, ToolBarTray_1Background_FUNC);
 }
 #endif
@@ -12390,7 +12390,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ToolBarTray_1IsLocked__I)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, ToolBarTray_1IsLocked__I_FUNC);
-	rc = (jboolean)((ToolBarTray^)TO_OBJECT(arg0))->IsLocked;
+	rc = (jboolean)(TO_OBJECT_AS(ToolBarTray^, arg0))->IsLocked;
 	OS_NATIVE_EXIT(env, that, ToolBarTray_1IsLocked__I_FUNC);
 	return rc;
 }
@@ -12402,7 +12402,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ToolBarTray_1IsLocked__IZ)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, ToolBarTray_1IsLocked__IZ_FUNC);
-	((ToolBarTray^)TO_OBJECT(arg0))->IsLocked = (arg1);
+	(TO_OBJECT_AS(ToolBarTray^, arg0))->IsLocked = (arg1);
 	OS_NATIVE_EXIT(env, that, ToolBarTray_1IsLocked__IZ_FUNC);
 }
 #endif
@@ -12413,7 +12413,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ToolBarTray_1Orientation)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ToolBarTray_1Orientation_FUNC);
-	((ToolBarTray^)TO_OBJECT(arg0))->Orientation = ((Orientation)arg1);
+	(TO_OBJECT_AS(ToolBarTray^, arg0))->Orientation = ((Orientation)arg1);
 	OS_NATIVE_EXIT(env, that, ToolBarTray_1Orientation_FUNC);
 }
 #endif
@@ -12425,7 +12425,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ToolBarTray_1ToolBars)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ToolBarTray_1ToolBars_FUNC);
-	rc = (jint)TO_HANDLE(((ToolBarTray^)TO_OBJECT(arg0))->ToolBars);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(ToolBarTray^, arg0))->ToolBars);
 	OS_NATIVE_EXIT(env, that, ToolBarTray_1ToolBars_FUNC);
 	return rc;
 }
@@ -12438,7 +12438,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ToolBar_1Band__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ToolBar_1Band__I_FUNC);
-	rc = (jint)((ToolBar^)TO_OBJECT(arg0))->Band;
+	rc = (jint)(TO_OBJECT_AS(ToolBar^, arg0))->Band;
 	OS_NATIVE_EXIT(env, that, ToolBar_1Band__I_FUNC);
 	return rc;
 }
@@ -12450,7 +12450,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ToolBar_1Band__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ToolBar_1Band__II_FUNC);
-	((ToolBar^)TO_OBJECT(arg0))->Band = (arg1);
+	(TO_OBJECT_AS(ToolBar^, arg0))->Band = (arg1);
 	OS_NATIVE_EXIT(env, that, ToolBar_1Band__II_FUNC);
 }
 #endif
@@ -12462,7 +12462,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(ToolBar_1BandIndex__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, ToolBar_1BandIndex__I_FUNC);
-	rc = (jint)((ToolBar^)TO_OBJECT(arg0))->BandIndex;
+	rc = (jint)(TO_OBJECT_AS(ToolBar^, arg0))->BandIndex;
 	OS_NATIVE_EXIT(env, that, ToolBar_1BandIndex__I_FUNC);
 	return rc;
 }
@@ -12474,7 +12474,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ToolBar_1BandIndex__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, ToolBar_1BandIndex__II_FUNC);
-	((ToolBar^)TO_OBJECT(arg0))->BandIndex = (arg1);
+	(TO_OBJECT_AS(ToolBar^, arg0))->BandIndex = (arg1);
 	OS_NATIVE_EXIT(env, that, ToolBar_1BandIndex__II_FUNC);
 }
 #endif
@@ -12525,7 +12525,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(ToolBar_1HasOverflowItems)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, ToolBar_1HasOverflowItems_FUNC);
-	rc = (jboolean)((ToolBar^)TO_OBJECT(arg0))->HasOverflowItems;
+	rc = (jboolean)(TO_OBJECT_AS(ToolBar^, arg0))->HasOverflowItems;
 	OS_NATIVE_EXIT(env, that, ToolBar_1HasOverflowItems_FUNC);
 	return rc;
 }
@@ -12588,7 +12588,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Track_1Thumb)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Track_1Thumb_FUNC);
-	rc = (jint)TO_HANDLE(((Track^)TO_OBJECT(arg0))->Thumb);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Track^, arg0))->Thumb);
 	OS_NATIVE_EXIT(env, that, Track_1Thumb_FUNC);
 	return rc;
 }
@@ -12600,7 +12600,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TransformCollection_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TransformCollection_1Add_FUNC);
-	((TransformCollection^)TO_OBJECT(arg0))->Add((Transform^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TransformCollection^, arg0))->Add((Transform^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TransformCollection_1Add_FUNC);
 }
 #endif
@@ -12612,7 +12612,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TransformGroup_1Children)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TransformGroup_1Children_FUNC);
-	rc = (jint)TO_HANDLE(((TransformGroup^)TO_OBJECT(arg0))->Children);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TransformGroup^, arg0))->Children);
 	OS_NATIVE_EXIT(env, that, TransformGroup_1Children_FUNC);
 	return rc;
 }
@@ -12625,7 +12625,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Transform_1Clone)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Transform_1Clone_FUNC);
-	rc = (jint)TO_HANDLE(((Transform^)TO_OBJECT(arg0))->Clone());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Transform^, arg0))->Clone());
 	OS_NATIVE_EXIT(env, that, Transform_1Clone_FUNC);
 	return rc;
 }
@@ -12664,7 +12664,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TreeViewItem_1HeaderTemplate__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TreeViewItem_1HeaderTemplate__I_FUNC);
-	rc = (jint)TO_HANDLE(((TreeViewItem^)TO_OBJECT(arg0))->HeaderTemplate);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TreeViewItem^, arg0))->HeaderTemplate);
 	OS_NATIVE_EXIT(env, that, TreeViewItem_1HeaderTemplate__I_FUNC);
 	return rc;
 }
@@ -12676,7 +12676,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TreeViewItem_1HeaderTemplate__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TreeViewItem_1HeaderTemplate__II_FUNC);
-	((TreeViewItem^)TO_OBJECT(arg0))->HeaderTemplate = ((DataTemplate^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TreeViewItem^, arg0))->HeaderTemplate = ((DataTemplate^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TreeViewItem_1HeaderTemplate__II_FUNC);
 }
 #endif
@@ -12701,7 +12701,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(TreeViewItem_1IsExpanded__I)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, TreeViewItem_1IsExpanded__I_FUNC);
-	rc = (jboolean)((TreeViewItem^)TO_OBJECT(arg0))->IsExpanded;
+	rc = (jboolean)(TO_OBJECT_AS(TreeViewItem^, arg0))->IsExpanded;
 	OS_NATIVE_EXIT(env, that, TreeViewItem_1IsExpanded__I_FUNC);
 	return rc;
 }
@@ -12713,7 +12713,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TreeViewItem_1IsExpanded__IZ)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, TreeViewItem_1IsExpanded__IZ_FUNC);
-	((TreeViewItem^)TO_OBJECT(arg0))->IsExpanded = (arg1);
+	(TO_OBJECT_AS(TreeViewItem^, arg0))->IsExpanded = (arg1);
 	OS_NATIVE_EXIT(env, that, TreeViewItem_1IsExpanded__IZ_FUNC);
 }
 #endif
@@ -12725,7 +12725,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(TreeViewItem_1IsSelected__I)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, TreeViewItem_1IsSelected__I_FUNC);
-	rc = (jboolean)((TreeViewItem^)TO_OBJECT(arg0))->IsSelected;
+	rc = (jboolean)(TO_OBJECT_AS(TreeViewItem^, arg0))->IsSelected;
 	OS_NATIVE_EXIT(env, that, TreeViewItem_1IsSelected__I_FUNC);
 	return rc;
 }
@@ -12737,7 +12737,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TreeViewItem_1IsSelected__IZ)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, TreeViewItem_1IsSelected__IZ_FUNC);
-	((TreeViewItem^)TO_OBJECT(arg0))->IsSelected = (arg1);
+	(TO_OBJECT_AS(TreeViewItem^, arg0))->IsSelected = (arg1);
 	OS_NATIVE_EXIT(env, that, TreeViewItem_1IsSelected__IZ_FUNC);
 }
 #endif
@@ -12762,7 +12762,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TreeView_1SelectedItem)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TreeView_1SelectedItem_FUNC);
-	rc = (jint)TO_HANDLE(((TreeView^)TO_OBJECT(arg0))->SelectedItem);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TreeView^, arg0))->SelectedItem);
 	OS_NATIVE_EXIT(env, that, TreeView_1SelectedItem_FUNC);
 	return rc;
 }
@@ -12774,7 +12774,7 @@ JNIEXPORT void JNICALL OS_NATIVE(TreeView_1SelectedItemChanged)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, TreeView_1SelectedItemChanged_FUNC);
-	((TreeView^)TO_OBJECT(arg0))->SelectedItemChanged += ((RoutedPropertyChangedEventHandler<Object^>^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(TreeView^, arg0))->SelectedItemChanged += ((RoutedPropertyChangedEventHandler<Object^>^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, TreeView_1SelectedItemChanged_FUNC);
 }
 #endif
@@ -12799,7 +12799,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TypeConverter_1ConvertFromString)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TypeConverter_1ConvertFromString_FUNC);
-	rc = (jint)TO_HANDLE(((TypeConverter^)TO_OBJECT(arg0))->ConvertFromString((String^)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TypeConverter^, arg0))->ConvertFromString((String^)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, TypeConverter_1ConvertFromString_FUNC);
 	return rc;
 }
@@ -12812,7 +12812,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TypeConverter_1ConvertToString)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TypeConverter_1ConvertToString_FUNC);
-	rc = (jint)TO_HANDLE(((TypeConverter^)TO_OBJECT(arg0))->ConvertToString((Object^)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(TypeConverter^, arg0))->ConvertToString((Object^)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, TypeConverter_1ConvertToString_FUNC);
 	return rc;
 }
@@ -12851,7 +12851,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Type_1FullName)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Type_1FullName_FUNC);
-	rc = (jint)TO_HANDLE(((Type^)TO_OBJECT(arg0))->FullName);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Type^, arg0))->FullName);
 	OS_NATIVE_EXIT(env, that, Type_1FullName_FUNC);
 	return rc;
 }
@@ -12864,7 +12864,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Type_1GetMethod)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Type_1GetMethod_FUNC);
-	rc = (jint)TO_HANDLE(((Type^)TO_OBJECT(arg0))->GetMethod((String^)TO_OBJECT(arg1), (BindingFlags)arg2));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Type^, arg0))->GetMethod((String^)TO_OBJECT(arg1), (BindingFlags)arg2));
 	OS_NATIVE_EXIT(env, that, Type_1GetMethod_FUNC);
 	return rc;
 }
@@ -12877,7 +12877,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Type_1GetProperty)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Type_1GetProperty_FUNC);
-	rc = (jint)TO_HANDLE(((Type^)TO_OBJECT(arg0))->GetProperty((String^)TO_OBJECT(arg1), (BindingFlags)arg2));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Type^, arg0))->GetProperty((String^)TO_OBJECT(arg1), (BindingFlags)arg2));
 	OS_NATIVE_EXIT(env, that, Type_1GetProperty_FUNC);
 	return rc;
 }
@@ -12903,7 +12903,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Type_1IsInstanceOfType)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Type_1IsInstanceOfType_FUNC);
-	rc = (jboolean)((Type^)TO_OBJECT(arg0))->IsInstanceOfType((Object^)TO_OBJECT(arg1));
+	rc = (jboolean)(TO_OBJECT_AS(Type^, arg0))->IsInstanceOfType((Object^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Type_1IsInstanceOfType_FUNC);
 	return rc;
 }
@@ -12916,7 +12916,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TypefaceCollection_1Count)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TypefaceCollection_1Count_FUNC);
-	rc = (jint)((System::Collections::Generic::ICollection<Typeface^>^)TO_OBJECT(arg0))->Count;
+	rc = (jint)(TO_OBJECT_AS(System::Collections::Generic::ICollection<Typeface^>^, arg0))->Count;
 	OS_NATIVE_EXIT(env, that, TypefaceCollection_1Count_FUNC);
 	return rc;
 }
@@ -12929,7 +12929,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TypefaceCollection_1Current)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TypefaceCollection_1Current_FUNC);
-	rc = (jint)TO_HANDLE(((System::Collections::Generic::IEnumerator<Typeface^>^)TO_OBJECT(arg0))->Current);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Collections::Generic::IEnumerator<Typeface^>^, arg0))->Current);
 	OS_NATIVE_EXIT(env, that, TypefaceCollection_1Current_FUNC);
 	return rc;
 }
@@ -12942,7 +12942,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(TypefaceCollection_1GetEnumerator)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, TypefaceCollection_1GetEnumerator_FUNC);
-	rc = (jint)TO_HANDLE(((System::Collections::Generic::IEnumerable<Typeface^>^)TO_OBJECT(arg0))->GetEnumerator());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Collections::Generic::IEnumerable<Typeface^>^, arg0))->GetEnumerator());
 	OS_NATIVE_EXIT(env, that, TypefaceCollection_1GetEnumerator_FUNC);
 	return rc;
 }
@@ -12955,7 +12955,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Typeface_1FontFamily)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Typeface_1FontFamily_FUNC);
-	rc = (jint)TO_HANDLE(((Typeface^)TO_OBJECT(arg0))->FontFamily);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Typeface^, arg0))->FontFamily);
 	OS_NATIVE_EXIT(env, that, Typeface_1FontFamily_FUNC);
 	return rc;
 }
@@ -12968,7 +12968,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Typeface_1Stretch)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Typeface_1Stretch_FUNC);
-	rc = (jint)TO_HANDLE(((Typeface^)TO_OBJECT(arg0))->Stretch);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Typeface^, arg0))->Stretch);
 	OS_NATIVE_EXIT(env, that, Typeface_1Stretch_FUNC);
 	return rc;
 }
@@ -12981,7 +12981,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Typeface_1Style)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Typeface_1Style_FUNC);
-	rc = (jint)TO_HANDLE(((Typeface^)TO_OBJECT(arg0))->Style);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Typeface^, arg0))->Style);
 	OS_NATIVE_EXIT(env, that, Typeface_1Style_FUNC);
 	return rc;
 }
@@ -12994,7 +12994,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Typeface_1Weight)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Typeface_1Weight_FUNC);
-	rc = (jint)TO_HANDLE(((Typeface^)TO_OBJECT(arg0))->Weight);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Typeface^, arg0))->Weight);
 	OS_NATIVE_EXIT(env, that, Typeface_1Weight_FUNC);
 	return rc;
 }
@@ -13006,7 +13006,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElementCollection_1Add)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElementCollection_1Add_FUNC);
-	((UIElementCollection^)TO_OBJECT(arg0))->Add((UIElement^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElementCollection^, arg0))->Add((UIElement^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElementCollection_1Add_FUNC);
 }
 #endif
@@ -13017,7 +13017,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElementCollection_1Clear)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, UIElementCollection_1Clear_FUNC);
-	((UIElementCollection^)TO_OBJECT(arg0))->Clear();
+	(TO_OBJECT_AS(UIElementCollection^, arg0))->Clear();
 	OS_NATIVE_EXIT(env, that, UIElementCollection_1Clear_FUNC);
 }
 #endif
@@ -13029,7 +13029,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(UIElementCollection_1Contains)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElementCollection_1Contains_FUNC);
-	rc = (jboolean)((UIElementCollection^)TO_OBJECT(arg0))->Contains((UIElement^)TO_OBJECT(arg1));
+	rc = (jboolean)(TO_OBJECT_AS(UIElementCollection^, arg0))->Contains((UIElement^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElementCollection_1Contains_FUNC);
 	return rc;
 }
@@ -13042,7 +13042,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(UIElementCollection_1Count)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElementCollection_1Count_FUNC);
-	rc = (jint)((UIElementCollection^)TO_OBJECT(arg0))->Count;
+	rc = (jint)(TO_OBJECT_AS(UIElementCollection^, arg0))->Count;
 	OS_NATIVE_EXIT(env, that, UIElementCollection_1Count_FUNC);
 	return rc;
 }
@@ -13055,7 +13055,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(UIElementCollection_1Current)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElementCollection_1Current_FUNC);
-	rc = (jint)TO_HANDLE(((IEnumerator^)TO_OBJECT(arg0))->Current);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(IEnumerator^, arg0))->Current);
 	OS_NATIVE_EXIT(env, that, UIElementCollection_1Current_FUNC);
 	return rc;
 }
@@ -13068,7 +13068,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(UIElementCollection_1GetEnumerator)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElementCollection_1GetEnumerator_FUNC);
-	rc = (jint)TO_HANDLE(((IEnumerable^)TO_OBJECT(arg0))->GetEnumerator());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(IEnumerable^, arg0))->GetEnumerator());
 	OS_NATIVE_EXIT(env, that, UIElementCollection_1GetEnumerator_FUNC);
 	return rc;
 }
@@ -13081,7 +13081,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(UIElementCollection_1IndexOf)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElementCollection_1IndexOf_FUNC);
-	rc = (jint)((UIElementCollection^)TO_OBJECT(arg0))->IndexOf((UIElement^)TO_OBJECT(arg1));
+	rc = (jint)(TO_OBJECT_AS(UIElementCollection^, arg0))->IndexOf((UIElement^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElementCollection_1IndexOf_FUNC);
 	return rc;
 }
@@ -13093,7 +13093,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElementCollection_1Insert)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, UIElementCollection_1Insert_FUNC);
-	((UIElementCollection^)TO_OBJECT(arg0))->Insert(arg1, (UIElement^)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(UIElementCollection^, arg0))->Insert(arg1, (UIElement^)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, UIElementCollection_1Insert_FUNC);
 }
 #endif
@@ -13104,7 +13104,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElementCollection_1Remove)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElementCollection_1Remove_FUNC);
-	((UIElementCollection^)TO_OBJECT(arg0))->Remove((UIElement^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElementCollection^, arg0))->Remove((UIElement^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElementCollection_1Remove_FUNC);
 }
 #endif
@@ -13116,7 +13116,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(UIElementCollection_1default)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElementCollection_1default_FUNC);
-	rc = (jint)TO_HANDLE(((UIElementCollection^)TO_OBJECT(arg0))->default[arg1]);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(UIElementCollection^, arg0))->default[arg1]);
 	OS_NATIVE_EXIT(env, that, UIElementCollection_1default_FUNC);
 	return rc;
 }
@@ -13128,7 +13128,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1AddHandler)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jboolean arg3)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1AddHandler_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->AddHandler((RoutedEvent^)TO_OBJECT(arg1), (Delegate^)TO_OBJECT(arg2), arg3);
+	(TO_OBJECT_AS(UIElement^, arg0))->AddHandler((RoutedEvent^)TO_OBJECT(arg1), (Delegate^)TO_OBJECT(arg2), arg3);
 	OS_NATIVE_EXIT(env, that, UIElement_1AddHandler_FUNC);
 }
 #endif
@@ -13139,7 +13139,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1AllowDrop)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1AllowDrop_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->AllowDrop = (arg1);
+	(TO_OBJECT_AS(UIElement^, arg0))->AllowDrop = (arg1);
 	OS_NATIVE_EXIT(env, that, UIElement_1AllowDrop_FUNC);
 }
 #endif
@@ -13150,7 +13150,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1BeginAnimation)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1BeginAnimation_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->BeginAnimation((DependencyProperty^)TO_OBJECT(arg1), (AnimationTimeline^)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(UIElement^, arg0))->BeginAnimation((DependencyProperty^)TO_OBJECT(arg1), (AnimationTimeline^)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, UIElement_1BeginAnimation_FUNC);
 }
 #endif
@@ -13162,7 +13162,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(UIElement_1BitmapEffect__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1BitmapEffect__I_FUNC);
-	rc = (jint)TO_HANDLE(((UIElement^)TO_OBJECT(arg0))->BitmapEffect);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(UIElement^, arg0))->BitmapEffect);
 	OS_NATIVE_EXIT(env, that, UIElement_1BitmapEffect__I_FUNC);
 	return rc;
 }
@@ -13174,7 +13174,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1BitmapEffect__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1BitmapEffect__II_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->BitmapEffect = ((BitmapEffect^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->BitmapEffect = ((BitmapEffect^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1BitmapEffect__II_FUNC);
 }
 #endif
@@ -13186,7 +13186,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(UIElement_1CaptureMouse)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1CaptureMouse_FUNC);
-	rc = (jboolean)((UIElement^)TO_OBJECT(arg0))->CaptureMouse();
+	rc = (jboolean)(TO_OBJECT_AS(UIElement^, arg0))->CaptureMouse();
 	OS_NATIVE_EXIT(env, that, UIElement_1CaptureMouse_FUNC);
 	return rc;
 }
@@ -13198,7 +13198,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1Clip)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1Clip_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->Clip = ((Geometry^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->Clip = ((Geometry^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1Clip_FUNC);
 }
 #endif
@@ -13209,7 +13209,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1ClipToBounds)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1ClipToBounds_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->ClipToBounds = (arg1);
+	(TO_OBJECT_AS(UIElement^, arg0))->ClipToBounds = (arg1);
 	OS_NATIVE_EXIT(env, that, UIElement_1ClipToBounds_FUNC);
 }
 #endif
@@ -13234,7 +13234,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(UIElement_1DesiredSize)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1DesiredSize_FUNC);
-	rc = (jint)TO_HANDLE(((UIElement^)TO_OBJECT(arg0))->DesiredSize);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(UIElement^, arg0))->DesiredSize);
 	OS_NATIVE_EXIT(env, that, UIElement_1DesiredSize_FUNC);
 	return rc;
 }
@@ -13246,7 +13246,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1DragEnter)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1DragEnter_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->DragEnter += ((DragEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->DragEnter += ((DragEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1DragEnter_FUNC);
 }
 #endif
@@ -13270,7 +13270,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1DragLeave)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1DragLeave_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->DragLeave += ((DragEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->DragLeave += ((DragEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1DragLeave_FUNC);
 }
 #endif
@@ -13294,7 +13294,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1DragOver)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1DragOver_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->DragOver += ((DragEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->DragOver += ((DragEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1DragOver_FUNC);
 }
 #endif
@@ -13318,7 +13318,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1Drop)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1Drop_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->Drop += ((DragEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->Drop += ((DragEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1Drop_FUNC);
 }
 #endif
@@ -13343,7 +13343,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(UIElement_1Focus)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1Focus_FUNC);
-	rc = (jboolean)((UIElement^)TO_OBJECT(arg0))->Focus();
+	rc = (jboolean)(TO_OBJECT_AS(UIElement^, arg0))->Focus();
 	OS_NATIVE_EXIT(env, that, UIElement_1Focus_FUNC);
 	return rc;
 }
@@ -13355,7 +13355,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1Focusable)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1Focusable_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->Focusable = (arg1);
+	(TO_OBJECT_AS(UIElement^, arg0))->Focusable = (arg1);
 	OS_NATIVE_EXIT(env, that, UIElement_1Focusable_FUNC);
 }
 #endif
@@ -13366,7 +13366,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1GiveFeedback)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1GiveFeedback_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->GiveFeedback += ((GiveFeedbackEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->GiveFeedback += ((GiveFeedbackEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1GiveFeedback_FUNC);
 }
 #endif
@@ -13391,7 +13391,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(UIElement_1InputHitTest)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1InputHitTest_FUNC);
-	rc = (jint)TO_HANDLE(((UIElement^)TO_OBJECT(arg0))->InputHitTest((Point)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(UIElement^, arg0))->InputHitTest((Point)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, UIElement_1InputHitTest_FUNC);
 	return rc;
 }
@@ -13403,7 +13403,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1InvalidateVisual)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1InvalidateVisual_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->InvalidateVisual();
+	(TO_OBJECT_AS(UIElement^, arg0))->InvalidateVisual();
 	OS_NATIVE_EXIT(env, that, UIElement_1InvalidateVisual_FUNC);
 }
 #endif
@@ -13415,7 +13415,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(UIElement_1IsEnabled__I)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1IsEnabled__I_FUNC);
-	rc = (jboolean)((UIElement^)TO_OBJECT(arg0))->IsEnabled;
+	rc = (jboolean)(TO_OBJECT_AS(UIElement^, arg0))->IsEnabled;
 	OS_NATIVE_EXIT(env, that, UIElement_1IsEnabled__I_FUNC);
 	return rc;
 }
@@ -13427,7 +13427,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1IsEnabled__IZ)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1IsEnabled__IZ_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->IsEnabled = (arg1);
+	(TO_OBJECT_AS(UIElement^, arg0))->IsEnabled = (arg1);
 	OS_NATIVE_EXIT(env, that, UIElement_1IsEnabled__IZ_FUNC);
 }
 #endif
@@ -13439,7 +13439,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(UIElement_1IsFocused)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1IsFocused_FUNC);
-	rc = (jboolean)((UIElement^)TO_OBJECT(arg0))->IsFocused;
+	rc = (jboolean)(TO_OBJECT_AS(UIElement^, arg0))->IsFocused;
 	OS_NATIVE_EXIT(env, that, UIElement_1IsFocused_FUNC);
 	return rc;
 }
@@ -13451,7 +13451,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1IsHitTestVisible)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1IsHitTestVisible_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->IsHitTestVisible = (arg1);
+	(TO_OBJECT_AS(UIElement^, arg0))->IsHitTestVisible = (arg1);
 	OS_NATIVE_EXIT(env, that, UIElement_1IsHitTestVisible_FUNC);
 }
 #endif
@@ -13463,7 +13463,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(UIElement_1IsKeyboardFocusWithin)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1IsKeyboardFocusWithin_FUNC);
-	rc = (jboolean)((UIElement^)TO_OBJECT(arg0))->IsKeyboardFocusWithin;
+	rc = (jboolean)(TO_OBJECT_AS(UIElement^, arg0))->IsKeyboardFocusWithin;
 	OS_NATIVE_EXIT(env, that, UIElement_1IsKeyboardFocusWithin_FUNC);
 	return rc;
 }
@@ -13476,7 +13476,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(UIElement_1IsKeyboardFocused)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1IsKeyboardFocused_FUNC);
-	rc = (jboolean)((UIElement^)TO_OBJECT(arg0))->IsKeyboardFocused;
+	rc = (jboolean)(TO_OBJECT_AS(UIElement^, arg0))->IsKeyboardFocused;
 	OS_NATIVE_EXIT(env, that, UIElement_1IsKeyboardFocused_FUNC);
 	return rc;
 }
@@ -13489,7 +13489,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(UIElement_1IsMeasureValid)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1IsMeasureValid_FUNC);
-	rc = (jboolean)((UIElement^)TO_OBJECT(arg0))->IsMeasureValid;
+	rc = (jboolean)(TO_OBJECT_AS(UIElement^, arg0))->IsMeasureValid;
 	OS_NATIVE_EXIT(env, that, UIElement_1IsMeasureValid_FUNC);
 	return rc;
 }
@@ -13502,7 +13502,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(UIElement_1IsMouseOver)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1IsMouseOver_FUNC);
-	rc = (jboolean)((UIElement^)TO_OBJECT(arg0))->IsMouseOver;
+	rc = (jboolean)(TO_OBJECT_AS(UIElement^, arg0))->IsMouseOver;
 	OS_NATIVE_EXIT(env, that, UIElement_1IsMouseOver_FUNC);
 	return rc;
 }
@@ -13515,7 +13515,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(UIElement_1IsVisible)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1IsVisible_FUNC);
-	rc = (jboolean)((UIElement^)TO_OBJECT(arg0))->IsVisible;
+	rc = (jboolean)(TO_OBJECT_AS(UIElement^, arg0))->IsVisible;
 	OS_NATIVE_EXIT(env, that, UIElement_1IsVisible_FUNC);
 	return rc;
 }
@@ -13527,7 +13527,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1KeyDown)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1KeyDown_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->KeyDown += ((KeyEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->KeyDown += ((KeyEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1KeyDown_FUNC);
 }
 #endif
@@ -13538,7 +13538,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1KeyUp)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1KeyUp_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->KeyUp += ((KeyEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->KeyUp += ((KeyEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1KeyUp_FUNC);
 }
 #endif
@@ -13549,7 +13549,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1LayoutUpdated)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1LayoutUpdated_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->LayoutUpdated += ((EventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->LayoutUpdated += ((EventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1LayoutUpdated_FUNC);
 }
 #endif
@@ -13560,7 +13560,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1LostKeyboardFocus)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1LostKeyboardFocus_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->LostKeyboardFocus += ((KeyboardFocusChangedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->LostKeyboardFocus += ((KeyboardFocusChangedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1LostKeyboardFocus_FUNC);
 }
 #endif
@@ -13571,7 +13571,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1Measure)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1Measure_FUNC);
-	((UIElement ^)TO_OBJECT(arg0))->Measure((Size)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement ^, arg0))->Measure((Size)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1Measure_FUNC);
 }
 #endif
@@ -13582,7 +13582,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1MouseDown)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1MouseDown_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->MouseDown += ((MouseButtonEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->MouseDown += ((MouseButtonEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1MouseDown_FUNC);
 }
 #endif
@@ -13593,7 +13593,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1MouseEnter)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1MouseEnter_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->MouseEnter += ((MouseEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->MouseEnter += ((MouseEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1MouseEnter_FUNC);
 }
 #endif
@@ -13604,7 +13604,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1MouseLeave)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1MouseLeave_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->MouseLeave += ((MouseEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->MouseLeave += ((MouseEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1MouseLeave_FUNC);
 }
 #endif
@@ -13615,7 +13615,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1MouseMove)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1MouseMove_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->MouseMove += ((MouseEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->MouseMove += ((MouseEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1MouseMove_FUNC);
 }
 #endif
@@ -13626,7 +13626,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1MouseUp)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1MouseUp_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->MouseUp += ((MouseButtonEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->MouseUp += ((MouseButtonEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1MouseUp_FUNC);
 }
 #endif
@@ -13637,7 +13637,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1MouseWheel)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1MouseWheel_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->MouseWheel += ((MouseWheelEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->MouseWheel += ((MouseWheelEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1MouseWheel_FUNC);
 }
 #endif
@@ -13648,7 +13648,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1MoveFocus)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1MoveFocus_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->MoveFocus((TraversalRequest^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->MoveFocus((TraversalRequest^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1MoveFocus_FUNC);
 }
 #endif
@@ -13660,7 +13660,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(UIElement_1Opacity__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1Opacity__I_FUNC);
-	rc = (jdouble)((UIElement^)TO_OBJECT(arg0))->Opacity;
+	rc = (jdouble)(TO_OBJECT_AS(UIElement^, arg0))->Opacity;
 	OS_NATIVE_EXIT(env, that, UIElement_1Opacity__I_FUNC);
 	return rc;
 }
@@ -13672,7 +13672,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1Opacity__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1Opacity__ID_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->Opacity = (arg1);
+	(TO_OBJECT_AS(UIElement^, arg0))->Opacity = (arg1);
 	OS_NATIVE_EXIT(env, that, UIElement_1Opacity__ID_FUNC);
 }
 #endif
@@ -13696,7 +13696,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1PreviewGotKeyboardFocus)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1PreviewGotKeyboardFocus_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->PreviewGotKeyboardFocus += ((KeyboardFocusChangedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->PreviewGotKeyboardFocus += ((KeyboardFocusChangedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1PreviewGotKeyboardFocus_FUNC);
 }
 #endif
@@ -13707,7 +13707,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1PreviewKeyDown)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1PreviewKeyDown_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->PreviewKeyDown += ((KeyEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->PreviewKeyDown += ((KeyEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1PreviewKeyDown_FUNC);
 }
 #endif
@@ -13718,7 +13718,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1PreviewKeyUp)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1PreviewKeyUp_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->PreviewKeyUp += ((KeyEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->PreviewKeyUp += ((KeyEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1PreviewKeyUp_FUNC);
 }
 #endif
@@ -13729,7 +13729,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1PreviewLostKeyboardFocus)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1PreviewLostKeyboardFocus_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->PreviewLostKeyboardFocus += ((KeyboardFocusChangedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->PreviewLostKeyboardFocus += ((KeyboardFocusChangedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1PreviewLostKeyboardFocus_FUNC);
 }
 #endif
@@ -13740,7 +13740,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1PreviewMouseDown)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1PreviewMouseDown_FUNC);
-	((UIElement ^)TO_OBJECT(arg0))->PreviewMouseDown += ((MouseButtonEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement ^, arg0))->PreviewMouseDown += ((MouseButtonEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1PreviewMouseDown_FUNC);
 }
 #endif
@@ -13751,7 +13751,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1PreviewMouseMove)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1PreviewMouseMove_FUNC);
-	((UIElement ^)TO_OBJECT(arg0))->PreviewMouseMove += ((MouseEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement ^, arg0))->PreviewMouseMove += ((MouseEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1PreviewMouseMove_FUNC);
 }
 #endif
@@ -13762,7 +13762,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1PreviewMouseUp)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1PreviewMouseUp_FUNC);
-	((UIElement ^)TO_OBJECT(arg0))->PreviewMouseUp += ((MouseButtonEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement ^, arg0))->PreviewMouseUp += ((MouseButtonEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1PreviewMouseUp_FUNC);
 }
 #endif
@@ -13773,7 +13773,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1PreviewMouseWheel)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1PreviewMouseWheel_FUNC);
-	((UIElement ^)TO_OBJECT(arg0))->PreviewMouseWheel += ((MouseWheelEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement ^, arg0))->PreviewMouseWheel += ((MouseWheelEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1PreviewMouseWheel_FUNC);
 }
 #endif
@@ -13784,7 +13784,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1PreviewTextInput)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1PreviewTextInput_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->PreviewTextInput += ((TextCompositionEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->PreviewTextInput += ((TextCompositionEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1PreviewTextInput_FUNC);
 }
 #endif
@@ -13795,7 +13795,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1QueryContinueDrag)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1QueryContinueDrag_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->QueryContinueDrag += ((QueryContinueDragEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->QueryContinueDrag += ((QueryContinueDragEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1QueryContinueDrag_FUNC);
 }
 #endif
@@ -13819,7 +13819,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1ReleaseMouseCapture)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1ReleaseMouseCapture_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->ReleaseMouseCapture();
+	(TO_OBJECT_AS(UIElement^, arg0))->ReleaseMouseCapture();
 	OS_NATIVE_EXIT(env, that, UIElement_1ReleaseMouseCapture_FUNC);
 }
 #endif
@@ -13830,7 +13830,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1RemoveHandler)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1RemoveHandler_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->RemoveHandler((RoutedEvent^)TO_OBJECT(arg1), (Delegate^)TO_OBJECT(arg2));
+	(TO_OBJECT_AS(UIElement^, arg0))->RemoveHandler((RoutedEvent^)TO_OBJECT(arg1), (Delegate^)TO_OBJECT(arg2));
 	OS_NATIVE_EXIT(env, that, UIElement_1RemoveHandler_FUNC);
 }
 #endif
@@ -13842,7 +13842,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(UIElement_1RenderSize)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1RenderSize_FUNC);
-	rc = (jint)TO_HANDLE(((UIElement^)TO_OBJECT(arg0))->RenderSize);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(UIElement^, arg0))->RenderSize);
 	OS_NATIVE_EXIT(env, that, UIElement_1RenderSize_FUNC);
 	return rc;
 }
@@ -13854,7 +13854,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1SnapsToDevicePixels)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1SnapsToDevicePixels_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->SnapsToDevicePixels = (arg1);
+	(TO_OBJECT_AS(UIElement^, arg0))->SnapsToDevicePixels = (arg1);
 	OS_NATIVE_EXIT(env, that, UIElement_1SnapsToDevicePixels_FUNC);
 }
 #endif
@@ -13865,7 +13865,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1TextInput)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1TextInput_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->TextInput += ((TextCompositionEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(UIElement^, arg0))->TextInput += ((TextCompositionEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, UIElement_1TextInput_FUNC);
 }
 #endif
@@ -13877,7 +13877,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(UIElement_1TranslatePoint)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1TranslatePoint_FUNC);
-	rc = (jint)TO_HANDLE(((UIElement^)TO_OBJECT(arg0))->TranslatePoint((Point)TO_OBJECT(arg1), (UIElement^)TO_OBJECT(arg2)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(UIElement^, arg0))->TranslatePoint((Point)TO_OBJECT(arg1), (UIElement^)TO_OBJECT(arg2)));
 	OS_NATIVE_EXIT(env, that, UIElement_1TranslatePoint_FUNC);
 	return rc;
 }
@@ -13889,7 +13889,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1UpdateLayout)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1UpdateLayout_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->UpdateLayout();
+	(TO_OBJECT_AS(UIElement^, arg0))->UpdateLayout();
 	OS_NATIVE_EXIT(env, that, UIElement_1UpdateLayout_FUNC);
 }
 #endif
@@ -13901,7 +13901,7 @@ JNIEXPORT jbyte JNICALL OS_NATIVE(UIElement_1Visibility__I)
 {
 	jbyte rc = 0;
 	OS_NATIVE_ENTER(env, that, UIElement_1Visibility__I_FUNC);
-	rc = (jbyte)((UIElement^)TO_OBJECT(arg0))->Visibility;
+	rc = (jbyte)(TO_OBJECT_AS(UIElement^, arg0))->Visibility;
 	OS_NATIVE_EXIT(env, that, UIElement_1Visibility__I_FUNC);
 	return rc;
 }
@@ -13913,7 +13913,7 @@ JNIEXPORT void JNICALL OS_NATIVE(UIElement_1Visibility__IB)
 	(JNIEnv *env, jclass that, jint arg0, jbyte arg1)
 {
 	OS_NATIVE_ENTER(env, that, UIElement_1Visibility__IB_FUNC);
-	((UIElement^)TO_OBJECT(arg0))->Visibility = ((Visibility)arg1);
+	(TO_OBJECT_AS(UIElement^, arg0))->Visibility = ((Visibility)arg1);
 	OS_NATIVE_EXIT(env, that, UIElement_1Visibility__IB_FUNC);
 }
 #endif
@@ -13938,7 +13938,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(VirtualizingStackPanel_1VerticalOffset)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, VirtualizingStackPanel_1VerticalOffset_FUNC);
-	rc = (jdouble)((VirtualizingStackPanel^)TO_OBJECT(arg0))->VerticalOffset;
+	rc = (jdouble)(TO_OBJECT_AS(VirtualizingStackPanel^, arg0))->VerticalOffset;
 	OS_NATIVE_EXIT(env, that, VirtualizingStackPanel_1VerticalOffset_FUNC);
 	return rc;
 }
@@ -13990,7 +13990,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Visual_1IsAncestorOf)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Visual_1IsAncestorOf_FUNC);
-	rc = (jboolean)((Visual^)TO_OBJECT(arg0))->IsAncestorOf((DependencyObject^)TO_OBJECT(arg1));
+	rc = (jboolean)(TO_OBJECT_AS(Visual^, arg0))->IsAncestorOf((DependencyObject^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Visual_1IsAncestorOf_FUNC);
 	return rc;
 }
@@ -14003,7 +14003,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Visual_1IsDescendantOf)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Visual_1IsDescendantOf_FUNC);
-	rc = (jboolean)((Visual^)TO_OBJECT(arg0))->IsDescendantOf((DependencyObject^)TO_OBJECT(arg1));
+	rc = (jboolean)(TO_OBJECT_AS(Visual^, arg0))->IsDescendantOf((DependencyObject^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Visual_1IsDescendantOf_FUNC);
 	return rc;
 }
@@ -14016,7 +14016,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Visual_1PointFromScreen)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Visual_1PointFromScreen_FUNC);
-	rc = (jint)TO_HANDLE(((Visual^)TO_OBJECT(arg0))->PointFromScreen((Point)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Visual^, arg0))->PointFromScreen((Point)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, Visual_1PointFromScreen_FUNC);
 	return rc;
 }
@@ -14029,7 +14029,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Visual_1PointToScreen)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Visual_1PointToScreen_FUNC);
-	rc = (jint)TO_HANDLE(((Visual^)TO_OBJECT(arg0))->PointToScreen((Point)TO_OBJECT(arg1)));
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Visual^, arg0))->PointToScreen((Point)TO_OBJECT(arg1)));
 	OS_NATIVE_EXIT(env, that, Visual_1PointToScreen_FUNC);
 	return rc;
 }
@@ -14042,7 +14042,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(WebBrowserDocumentCompletedEventArgs_1Url)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, WebBrowserDocumentCompletedEventArgs_1Url_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::WebBrowserDocumentCompletedEventArgs^)TO_OBJECT(arg0))->Url);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::WebBrowserDocumentCompletedEventArgs^, arg0))->Url);
 	OS_NATIVE_EXIT(env, that, WebBrowserDocumentCompletedEventArgs_1Url_FUNC);
 	return rc;
 }
@@ -14055,7 +14055,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(WebBrowserNavigatedEventArgs_1Url)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, WebBrowserNavigatedEventArgs_1Url_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::WebBrowserNavigatedEventArgs^)TO_OBJECT(arg0))->Url);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::WebBrowserNavigatedEventArgs^, arg0))->Url);
 	OS_NATIVE_EXIT(env, that, WebBrowserNavigatedEventArgs_1Url_FUNC);
 	return rc;
 }
@@ -14068,7 +14068,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(WebBrowserNavigatingEventArgs_1Url)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, WebBrowserNavigatingEventArgs_1Url_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::WebBrowserNavigatingEventArgs^)TO_OBJECT(arg0))->Url);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::WebBrowserNavigatingEventArgs^, arg0))->Url);
 	OS_NATIVE_EXIT(env, that, WebBrowserNavigatingEventArgs_1Url_FUNC);
 	return rc;
 }
@@ -14081,7 +14081,7 @@ JNIEXPORT jlong JNICALL OS_NATIVE(WebBrowserProgressChangedEventArgs_1CurrentPro
 {
 	jlong rc = 0;
 	OS_NATIVE_ENTER(env, that, WebBrowserProgressChangedEventArgs_1CurrentProgress_FUNC);
-	rc = (jlong)((System::Windows::Forms::WebBrowserProgressChangedEventArgs^)TO_OBJECT(arg0))->CurrentProgress;
+	rc = (jlong)(TO_OBJECT_AS(System::Windows::Forms::WebBrowserProgressChangedEventArgs^, arg0))->CurrentProgress;
 	OS_NATIVE_EXIT(env, that, WebBrowserProgressChangedEventArgs_1CurrentProgress_FUNC);
 	return rc;
 }
@@ -14094,7 +14094,7 @@ JNIEXPORT jlong JNICALL OS_NATIVE(WebBrowserProgressChangedEventArgs_1MaximumPro
 {
 	jlong rc = 0;
 	OS_NATIVE_ENTER(env, that, WebBrowserProgressChangedEventArgs_1MaximumProgress_FUNC);
-	rc = (jlong)((System::Windows::Forms::WebBrowserProgressChangedEventArgs^)TO_OBJECT(arg0))->MaximumProgress;
+	rc = (jlong)(TO_OBJECT_AS(System::Windows::Forms::WebBrowserProgressChangedEventArgs^, arg0))->MaximumProgress;
 	OS_NATIVE_EXIT(env, that, WebBrowserProgressChangedEventArgs_1MaximumProgress_FUNC);
 	return rc;
 }
@@ -14107,7 +14107,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(WebBrowser_1CanGoBack)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, WebBrowser_1CanGoBack_FUNC);
-	rc = (jboolean)((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->CanGoBack;
+	rc = (jboolean)(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->CanGoBack;
 	OS_NATIVE_EXIT(env, that, WebBrowser_1CanGoBack_FUNC);
 	return rc;
 }
@@ -14120,7 +14120,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(WebBrowser_1CanGoForward)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, WebBrowser_1CanGoForward_FUNC);
-	rc = (jboolean)((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->CanGoForward;
+	rc = (jboolean)(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->CanGoForward;
 	OS_NATIVE_EXIT(env, that, WebBrowser_1CanGoForward_FUNC);
 	return rc;
 }
@@ -14133,7 +14133,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(WebBrowser_1Document)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, WebBrowser_1Document_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->Document);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->Document);
 	OS_NATIVE_EXIT(env, that, WebBrowser_1Document_FUNC);
 	return rc;
 }
@@ -14145,7 +14145,7 @@ JNIEXPORT void JNICALL OS_NATIVE(WebBrowser_1DocumentCompleted)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, WebBrowser_1DocumentCompleted_FUNC);
-	((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->DocumentCompleted += ((System::Windows::Forms::WebBrowserDocumentCompletedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->DocumentCompleted += ((System::Windows::Forms::WebBrowserDocumentCompletedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, WebBrowser_1DocumentCompleted_FUNC);
 }
 #endif
@@ -14157,7 +14157,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(WebBrowser_1DocumentText__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, WebBrowser_1DocumentText__I_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->DocumentText);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->DocumentText);
 	OS_NATIVE_EXIT(env, that, WebBrowser_1DocumentText__I_FUNC);
 	return rc;
 }
@@ -14169,7 +14169,7 @@ JNIEXPORT void JNICALL OS_NATIVE(WebBrowser_1DocumentText__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, WebBrowser_1DocumentText__II_FUNC);
-	((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->DocumentText = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->DocumentText = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, WebBrowser_1DocumentText__II_FUNC);
 }
 #endif
@@ -14181,7 +14181,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(WebBrowser_1DocumentTitle)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, WebBrowser_1DocumentTitle_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->DocumentTitle);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->DocumentTitle);
 	OS_NATIVE_EXIT(env, that, WebBrowser_1DocumentTitle_FUNC);
 	return rc;
 }
@@ -14193,7 +14193,7 @@ JNIEXPORT void JNICALL OS_NATIVE(WebBrowser_1DocumentTitleChanged)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, WebBrowser_1DocumentTitleChanged_FUNC);
-	((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->DocumentTitleChanged += ((EventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->DocumentTitleChanged += ((EventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, WebBrowser_1DocumentTitleChanged_FUNC);
 }
 #endif
@@ -14205,7 +14205,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(WebBrowser_1GoBack)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, WebBrowser_1GoBack_FUNC);
-	rc = (jboolean)((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->GoBack();
+	rc = (jboolean)(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->GoBack();
 	OS_NATIVE_EXIT(env, that, WebBrowser_1GoBack_FUNC);
 	return rc;
 }
@@ -14218,7 +14218,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(WebBrowser_1GoForward)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, WebBrowser_1GoForward_FUNC);
-	rc = (jboolean)((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->GoForward();
+	rc = (jboolean)(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->GoForward();
 	OS_NATIVE_EXIT(env, that, WebBrowser_1GoForward_FUNC);
 	return rc;
 }
@@ -14230,7 +14230,7 @@ JNIEXPORT void JNICALL OS_NATIVE(WebBrowser_1Navigate)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, WebBrowser_1Navigate_FUNC);
-	((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->Navigate((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->Navigate((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, WebBrowser_1Navigate_FUNC);
 }
 #endif
@@ -14241,7 +14241,7 @@ JNIEXPORT void JNICALL OS_NATIVE(WebBrowser_1Navigated)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, WebBrowser_1Navigated_FUNC);
-	((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->Navigated += ((System::Windows::Forms::WebBrowserNavigatedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->Navigated += ((System::Windows::Forms::WebBrowserNavigatedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, WebBrowser_1Navigated_FUNC);
 }
 #endif
@@ -14252,7 +14252,7 @@ JNIEXPORT void JNICALL OS_NATIVE(WebBrowser_1Navigating)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, WebBrowser_1Navigating_FUNC);
-	((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->Navigating += ((System::Windows::Forms::WebBrowserNavigatingEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->Navigating += ((System::Windows::Forms::WebBrowserNavigatingEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, WebBrowser_1Navigating_FUNC);
 }
 #endif
@@ -14263,7 +14263,7 @@ JNIEXPORT void JNICALL OS_NATIVE(WebBrowser_1ProgressChanged)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, WebBrowser_1ProgressChanged_FUNC);
-	((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->ProgressChanged += ((System::Windows::Forms::WebBrowserProgressChangedEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->ProgressChanged += ((System::Windows::Forms::WebBrowserProgressChangedEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, WebBrowser_1ProgressChanged_FUNC);
 }
 #endif
@@ -14275,7 +14275,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(WebBrowser_1ReadyState)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, WebBrowser_1ReadyState_FUNC);
-	rc = (jint)((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->ReadyState;
+	rc = (jint)(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->ReadyState;
 	OS_NATIVE_EXIT(env, that, WebBrowser_1ReadyState_FUNC);
 	return rc;
 }
@@ -14287,7 +14287,7 @@ JNIEXPORT void JNICALL OS_NATIVE(WebBrowser_1Refresh)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, WebBrowser_1Refresh_FUNC);
-	((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->Refresh();
+	(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->Refresh();
 	OS_NATIVE_EXIT(env, that, WebBrowser_1Refresh_FUNC);
 }
 #endif
@@ -14298,7 +14298,7 @@ JNIEXPORT void JNICALL OS_NATIVE(WebBrowser_1ScriptErrorsSuppressed)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, WebBrowser_1ScriptErrorsSuppressed_FUNC);
-	((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->ScriptErrorsSuppressed = (arg1);
+	(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->ScriptErrorsSuppressed = (arg1);
 	OS_NATIVE_EXIT(env, that, WebBrowser_1ScriptErrorsSuppressed_FUNC);
 }
 #endif
@@ -14310,7 +14310,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(WebBrowser_1StatusText)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, WebBrowser_1StatusText_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->StatusText);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->StatusText);
 	OS_NATIVE_EXIT(env, that, WebBrowser_1StatusText_FUNC);
 	return rc;
 }
@@ -14322,7 +14322,7 @@ JNIEXPORT void JNICALL OS_NATIVE(WebBrowser_1StatusTextChanged)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, WebBrowser_1StatusTextChanged_FUNC);
-	((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->StatusTextChanged += ((EventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->StatusTextChanged += ((EventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, WebBrowser_1StatusTextChanged_FUNC);
 }
 #endif
@@ -14333,7 +14333,7 @@ JNIEXPORT void JNICALL OS_NATIVE(WebBrowser_1Stop)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, WebBrowser_1Stop_FUNC);
-	((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->Stop();
+	(TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->Stop();
 	OS_NATIVE_EXIT(env, that, WebBrowser_1Stop_FUNC);
 }
 #endif
@@ -14345,7 +14345,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(WebBrowser_1Url)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, WebBrowser_1Url_FUNC);
-	rc = (jint)TO_HANDLE(((System::Windows::Forms::WebBrowser^)TO_OBJECT(arg0))->Url);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(System::Windows::Forms::WebBrowser^, arg0))->Url);
 	OS_NATIVE_EXIT(env, that, WebBrowser_1Url_FUNC);
 	return rc;
 }
@@ -14358,7 +14358,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(WindowCollection_1Count)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, WindowCollection_1Count_FUNC);
-	rc = (jint)((WindowCollection^)TO_OBJECT(arg0))->Count;
+	rc = (jint)(TO_OBJECT_AS(WindowCollection^, arg0))->Count;
 	OS_NATIVE_EXIT(env, that, WindowCollection_1Count_FUNC);
 	return rc;
 }
@@ -14371,7 +14371,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(WindowCollection_1Current)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, WindowCollection_1Current_FUNC);
-	rc = (jint)TO_HANDLE(((IEnumerator^)TO_OBJECT(arg0))->Current);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(IEnumerator^, arg0))->Current);
 	OS_NATIVE_EXIT(env, that, WindowCollection_1Current_FUNC);
 	return rc;
 }
@@ -14384,7 +14384,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(WindowCollection_1GetEnumerator)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, WindowCollection_1GetEnumerator_FUNC);
-	rc = (jint)TO_HANDLE(((IEnumerable^)TO_OBJECT(arg0))->GetEnumerator());
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(IEnumerable^, arg0))->GetEnumerator());
 	OS_NATIVE_EXIT(env, that, WindowCollection_1GetEnumerator_FUNC);
 	return rc;
 }
@@ -14396,7 +14396,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1Activate)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, Window_1Activate_FUNC);
-	((Window^)TO_OBJECT(arg0))->Activate();
+	(TO_OBJECT_AS(Window^, arg0))->Activate();
 	OS_NATIVE_EXIT(env, that, Window_1Activate_FUNC);
 }
 #endif
@@ -14407,7 +14407,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1Activated)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Window_1Activated_FUNC);
-	((Window^)TO_OBJECT(arg0))->Activated += ((EventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Window^, arg0))->Activated += ((EventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Window_1Activated_FUNC);
 }
 #endif
@@ -14418,7 +14418,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1AllowsTransparency)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, Window_1AllowsTransparency_FUNC);
-	((Window^)TO_OBJECT(arg0))->AllowsTransparency = (arg1);
+	(TO_OBJECT_AS(Window^, arg0))->AllowsTransparency = (arg1);
 	OS_NATIVE_EXIT(env, that, Window_1AllowsTransparency_FUNC);
 }
 #endif
@@ -14429,7 +14429,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1Close)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, Window_1Close_FUNC);
-	((Window^)TO_OBJECT(arg0))->Close();
+	(TO_OBJECT_AS(Window^, arg0))->Close();
 	OS_NATIVE_EXIT(env, that, Window_1Close_FUNC);
 }
 #endif
@@ -14440,7 +14440,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1Closing)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Window_1Closing_FUNC);
-	((Window^)TO_OBJECT(arg0))->Closing += ((CancelEventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Window^, arg0))->Closing += ((CancelEventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Window_1Closing_FUNC);
 }
 #endif
@@ -14451,7 +14451,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1Deactivated)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Window_1Deactivated_FUNC);
-	((Window^)TO_OBJECT(arg0))->Deactivated += ((EventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Window^, arg0))->Deactivated += ((EventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Window_1Deactivated_FUNC);
 }
 #endif
@@ -14475,7 +14475,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1Hide)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, Window_1Hide_FUNC);
-	((Window^)TO_OBJECT(arg0))->Hide();
+	(TO_OBJECT_AS(Window^, arg0))->Hide();
 	OS_NATIVE_EXIT(env, that, Window_1Hide_FUNC);
 }
 #endif
@@ -14486,7 +14486,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1Icon)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Window_1Icon_FUNC);
-	((Window^)TO_OBJECT(arg0))->Icon = ((ImageSource^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Window^, arg0))->Icon = ((ImageSource^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Window_1Icon_FUNC);
 }
 #endif
@@ -14498,7 +14498,7 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(Window_1IsActive)
 {
 	jboolean rc = 0;
 	OS_NATIVE_ENTER(env, that, Window_1IsActive_FUNC);
-	rc = (jboolean)((Window^)TO_OBJECT(arg0))->IsActive;
+	rc = (jboolean)(TO_OBJECT_AS(Window^, arg0))->IsActive;
 	OS_NATIVE_EXIT(env, that, Window_1IsActive_FUNC);
 	return rc;
 }
@@ -14511,7 +14511,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Window_1Left__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Window_1Left__I_FUNC);
-	rc = (jdouble)((Window^)TO_OBJECT(arg0))->Left;
+	rc = (jdouble)(TO_OBJECT_AS(Window^, arg0))->Left;
 	OS_NATIVE_EXIT(env, that, Window_1Left__I_FUNC);
 	return rc;
 }
@@ -14523,7 +14523,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1Left__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Window_1Left__ID_FUNC);
-	((Window^)TO_OBJECT(arg0))->Left = (arg1);
+	(TO_OBJECT_AS(Window^, arg0))->Left = (arg1);
 	OS_NATIVE_EXIT(env, that, Window_1Left__ID_FUNC);
 }
 #endif
@@ -14534,7 +14534,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1LocationChanged)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Window_1LocationChanged_FUNC);
-	((Window^)TO_OBJECT(arg0))->LocationChanged += ((EventHandler^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Window^, arg0))->LocationChanged += ((EventHandler^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Window_1LocationChanged_FUNC);
 }
 #endif
@@ -14545,7 +14545,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1Owner)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Window_1Owner_FUNC);
-	((Window^)TO_OBJECT(arg0))->Owner = ((Window^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Window^, arg0))->Owner = ((Window^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Window_1Owner_FUNC);
 }
 #endif
@@ -14556,7 +14556,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1ResizeMode)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Window_1ResizeMode_FUNC);
-	((Window^)TO_OBJECT(arg0))->ResizeMode = ((ResizeMode)arg1);
+	(TO_OBJECT_AS(Window^, arg0))->ResizeMode = ((ResizeMode)arg1);
 	OS_NATIVE_EXIT(env, that, Window_1ResizeMode_FUNC);
 }
 #endif
@@ -14567,7 +14567,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1Show)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, Window_1Show_FUNC);
-	((Window^)TO_OBJECT(arg0))->Show();
+	(TO_OBJECT_AS(Window^, arg0))->Show();
 	OS_NATIVE_EXIT(env, that, Window_1Show_FUNC);
 }
 #endif
@@ -14578,7 +14578,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1ShowInTaskbar)
 	(JNIEnv *env, jclass that, jint arg0, jboolean arg1)
 {
 	OS_NATIVE_ENTER(env, that, Window_1ShowInTaskbar_FUNC);
-	((Window^)TO_OBJECT(arg0))->ShowInTaskbar = (arg1);
+	(TO_OBJECT_AS(Window^, arg0))->ShowInTaskbar = (arg1);
 	OS_NATIVE_EXIT(env, that, Window_1ShowInTaskbar_FUNC);
 }
 #endif
@@ -14590,7 +14590,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Window_1Title__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Window_1Title__I_FUNC);
-	rc = (jint)TO_HANDLE(((Window^)TO_OBJECT(arg0))->Title);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(Window^, arg0))->Title);
 	OS_NATIVE_EXIT(env, that, Window_1Title__I_FUNC);
 	return rc;
 }
@@ -14602,7 +14602,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1Title__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Window_1Title__II_FUNC);
-	((Window^)TO_OBJECT(arg0))->Title = ((String^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(Window^, arg0))->Title = ((String^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, Window_1Title__II_FUNC);
 }
 #endif
@@ -14614,7 +14614,7 @@ JNIEXPORT jdouble JNICALL OS_NATIVE(Window_1Top__I)
 {
 	jdouble rc = 0;
 	OS_NATIVE_ENTER(env, that, Window_1Top__I_FUNC);
-	rc = (jdouble)((Window ^)TO_OBJECT(arg0))->Top;
+	rc = (jdouble)(TO_OBJECT_AS(Window ^, arg0))->Top;
 	OS_NATIVE_EXIT(env, that, Window_1Top__I_FUNC);
 	return rc;
 }
@@ -14626,7 +14626,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1Top__ID)
 	(JNIEnv *env, jclass that, jint arg0, jdouble arg1)
 {
 	OS_NATIVE_ENTER(env, that, Window_1Top__ID_FUNC);
-	((Window ^)TO_OBJECT(arg0))->Top = (arg1);
+	(TO_OBJECT_AS(Window ^, arg0))->Top = (arg1);
 	OS_NATIVE_EXIT(env, that, Window_1Top__ID_FUNC);
 }
 #endif
@@ -14638,7 +14638,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Window_1WindowState__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Window_1WindowState__I_FUNC);
-	rc = (jint)((Window^)TO_OBJECT(arg0))->WindowState;
+	rc = (jint)(TO_OBJECT_AS(Window^, arg0))->WindowState;
 	OS_NATIVE_EXIT(env, that, Window_1WindowState__I_FUNC);
 	return rc;
 }
@@ -14650,7 +14650,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1WindowState__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Window_1WindowState__II_FUNC);
-	((Window^)TO_OBJECT(arg0))->WindowState = ((WindowState)arg1);
+	(TO_OBJECT_AS(Window^, arg0))->WindowState = ((WindowState)arg1);
 	OS_NATIVE_EXIT(env, that, Window_1WindowState__II_FUNC);
 }
 #endif
@@ -14662,7 +14662,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Window_1WindowStyle__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Window_1WindowStyle__I_FUNC);
-	rc = (jint)((Window^)TO_OBJECT(arg0))->WindowStyle;
+	rc = (jint)(TO_OBJECT_AS(Window^, arg0))->WindowStyle;
 	OS_NATIVE_EXIT(env, that, Window_1WindowStyle__I_FUNC);
 	return rc;
 }
@@ -14674,7 +14674,7 @@ JNIEXPORT void JNICALL OS_NATIVE(Window_1WindowStyle__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, Window_1WindowStyle__II_FUNC);
-	((Window^)TO_OBJECT(arg0))->WindowStyle = ((WindowStyle)arg1);
+	(TO_OBJECT_AS(Window^, arg0))->WindowStyle = ((WindowStyle)arg1);
 	OS_NATIVE_EXIT(env, that, Window_1WindowStyle__II_FUNC);
 }
 #endif
@@ -14685,11 +14685,57 @@ JNIEXPORT void JNICALL OS_NATIVE(WindowsFormsHost_1Child)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, WindowsFormsHost_1Child_FUNC);
-	((System::Windows::Forms::Integration::WindowsFormsHost^)TO_OBJECT(arg0))->Child = ((System::Windows::Forms::Control^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(System::Windows::Forms::Integration::WindowsFormsHost^, arg0))->Child = ((System::Windows::Forms::Control^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, WindowsFormsHost_1Child_FUNC);
 }
 #endif
 
+#ifndef NO_WriteableBitmap_1AddDirtyRect
+extern "C" JNIEXPORT void JNICALL OS_NATIVE(WriteableBitmap_1AddDirtyRect)(JNIEnv *env, jclass that, jint arg0, jint arg1);
+JNIEXPORT void JNICALL OS_NATIVE(WriteableBitmap_1AddDirtyRect)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1)
+{
+	OS_NATIVE_ENTER(env, that, WriteableBitmap_1AddDirtyRect_FUNC);
+	(TO_OBJECT_AS(WriteableBitmap^, arg0))->AddDirtyRect((Int32Rect)TO_OBJECT(arg1));
+	OS_NATIVE_EXIT(env, that, WriteableBitmap_1AddDirtyRect_FUNC);
+}
+#endif
+
+#ifndef NO_WriteableBitmap_1BackBufferStride
+extern "C" JNIEXPORT jint JNICALL OS_NATIVE(WriteableBitmap_1BackBufferStride)(JNIEnv *env, jclass that, jint arg0);
+JNIEXPORT jint JNICALL OS_NATIVE(WriteableBitmap_1BackBufferStride)
+	(JNIEnv *env, jclass that, jint arg0)
+{
+	jint rc = 0;
+	OS_NATIVE_ENTER(env, that, WriteableBitmap_1BackBufferStride_FUNC);
+	rc = (jint)(TO_OBJECT_AS(WriteableBitmap^, arg0))->BackBufferStride;
+	OS_NATIVE_EXIT(env, that, WriteableBitmap_1BackBufferStride_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_WriteableBitmap_1Lock
+extern "C" JNIEXPORT void JNICALL OS_NATIVE(WriteableBitmap_1Lock)(JNIEnv *env, jclass that, jint arg0);
+JNIEXPORT void JNICALL OS_NATIVE(WriteableBitmap_1Lock)
+	(JNIEnv *env, jclass that, jint arg0)
+{
+	OS_NATIVE_ENTER(env, that, WriteableBitmap_1Lock_FUNC);
+	(TO_OBJECT_AS(WriteableBitmap^, arg0))->Lock();
+	OS_NATIVE_EXIT(env, that, WriteableBitmap_1Lock_FUNC);
+}
+#endif
+
+#ifndef NO_WriteableBitmap_1Unlock
+extern "C" JNIEXPORT void JNICALL OS_NATIVE(WriteableBitmap_1Unlock)(JNIEnv *env, jclass that, jint arg0);
+JNIEXPORT void JNICALL OS_NATIVE(WriteableBitmap_1Unlock)
+	(JNIEnv *env, jclass that, jint arg0)
+{
+	OS_NATIVE_ENTER(env, that, WriteableBitmap_1Unlock_FUNC);
+	(TO_OBJECT_AS(WriteableBitmap^, arg0))->Unlock();
+	OS_NATIVE_EXIT(env, that, WriteableBitmap_1Unlock_FUNC);
+}
+#endif
+
 #ifndef NO_WriteableBitmap_1WritePixels
 extern "C" JNIEXPORT void JNICALL OS_NATIVE(WriteableBitmap_1WritePixels)(JNIEnv *env, jclass that, jint arg0, jint arg1, jbyteArray arg2, jint arg3, jint arg4);
 JNIEXPORT void JNICALL OS_NATIVE(WriteableBitmap_1WritePixels)
@@ -14698,7 +14744,7 @@ JNIEXPORT void JNICALL OS_NATIVE(WriteableBitmap_1WritePixels)
 	jbyte *lparg2=NULL;
 	OS_NATIVE_ENTER(env, that, WriteableBitmap_1WritePixels_FUNC);
 	if (arg2) if ((lparg2 = env->GetByteArrayElements(arg2, NULL)) == NULL) goto fail;
-	((WriteableBitmap^)TO_OBJECT(arg0))->WritePixels((Int32Rect)TO_OBJECT(arg1), (IntPtr)lparg2, arg3, arg4);
+	(TO_OBJECT_AS(WriteableBitmap^, arg0))->WritePixels((Int32Rect)TO_OBJECT(arg1), (IntPtr)lparg2, arg3, arg4);
 fail:
 	if (arg2 && lparg2) env->ReleaseByteArrayElements(arg2, lparg2, 0);
 	OS_NATIVE_EXIT(env, that, WriteableBitmap_1WritePixels_FUNC);
@@ -16423,7 +16469,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(gcnew_1String___3C)
 	if (arg0) if ((lparg0 = env->GetCharArrayElements(arg0, NULL)) == NULL) goto fail;
 	rc = (jint)TO_HANDLE(gcnew String((const wchar_t *)lparg0));
 fail:
-	if (arg0 && lparg0) env->ReleaseCharArrayElements(arg0, lparg0, 0);
+	if (arg0 && lparg0) env->ReleaseCharArrayElements(arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, gcnew_1String___3C_FUNC);
 	return rc;
 }
@@ -16440,7 +16486,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(gcnew_1String___3CII)
 	if (arg0) if ((lparg0 = env->GetCharArrayElements(arg0, NULL)) == NULL) goto fail;
 	rc = (jint)TO_HANDLE(gcnew String((const wchar_t *)lparg0, arg1, arg2));
 fail:
-	if (arg0 && lparg0) env->ReleaseCharArrayElements(arg0, lparg0, 0);
+	if (arg0 && lparg0) env->ReleaseCharArrayElements(arg0, lparg0, JNI_ABORT);
 	OS_NATIVE_EXIT(env, that, gcnew_1String___3CII_FUNC);
 	return rc;
 }
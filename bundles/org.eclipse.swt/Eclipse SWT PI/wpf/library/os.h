@@ -72,6 +72,17 @@ extern void SWTObjectTable_Free(int handle);
 
 #endif
 
+/*
+* The receiver of a generated accessor is always a handle created for
+* that type by the Java wrapper, so the runtime checked cast is skipped.
+* Define CHECKED_CASTS to restore the check when debugging.
+*/
+#ifdef CHECKED_CASTS
+#define TO_OBJECT_AS(type, arg) safe_cast<type>(TO_OBJECT(arg))
+#else
+#define TO_OBJECT_AS(type, arg) static_cast<type>(TO_OBJECT(arg))
+#endif
+
 #ifndef NATIVE_STATS
 #define OS_NATIVE_ENTER(env, that, func) \
 	try {  
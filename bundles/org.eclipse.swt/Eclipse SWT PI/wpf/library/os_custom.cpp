@@ -23,13 +23,23 @@ static JavaVM *jvm = NULL;
 /*												*/
 #ifndef GCHANDLE_TABLE
 #define GCHANDLE_STACKS
+/*
+* Handles are looked up without the lock.  The table is only written
+* while holding the lock and is replaced rather than resized when it
+* grows, so a reader always sees a complete table that contains every
+* handle that was returned before the read.  The allocation stack of
+* each handle is only captured when SWT_GCHANDLE_STACKS is set in the
+* environment.
+*/
 public ref class SWTObjectTable {
 private:
-	static int nextHandle = 0;
+	static int nextHandle = -1;
 	static array<Object^>^table = nullptr;
+	static array<int>^freeList = nullptr;
 	static Object^ mutex = gcnew Object();
 
 #ifdef GCHANDLE_STACKS
+	static bool captureStacks = System::Environment::GetEnvironmentVariable("SWT_GCHANDLE_STACKS") != nullptr;
 	static array<int>^exceptions = nullptr;
 #endif
 	
@@ -37,25 +47,30 @@ public:
 static int ToHandle(Object^ obj) {
 	if (obj == nullptr) return 0;
 	System::Threading::Monitor::Enter(mutex);
-	if (table == nullptr || nextHandle == -1) {
+	if (nextHandle == -1) {
 		int length = 0;
-		if (table != nullptr) length = table->GetLength(0);		
+		if (table != nullptr) length = table->Length;
 		int newLength = length * 2;
 		if (newLength < 1024) newLength = 1024;
 //		System::Console::Error->WriteLine("\t\t***grow={1}", length, newLength);
-		Array::Resize(table, newLength);
+		array<Object^>^newTable = gcnew array<Object^>(newLength);
+		if (table != nullptr) Array::Copy(table, newTable, length);
+		Array::Resize(freeList, newLength);
 #ifdef GCHANDLE_STACKS
-		Array::Resize(exceptions, newLength);
+		if (captureStacks) Array::Resize(exceptions, newLength);
 #endif
-		for (int i=length; i<newLength-1; i++) table[i] = i + 1;
-		table[newLength-1] = -1;
+		for (int i=length; i<newLength-1; i++) freeList[i] = i + 1;
+		freeList[newLength-1] = -1;
 		nextHandle = length;
+		/* publish the table only after it has been filled */
+		System::Threading::Thread::MemoryBarrier();
+		table = newTable;
 	}
 	int handle = nextHandle;
-	nextHandle = (int)(Int32)table[handle];
+	nextHandle = freeList[handle];
 	table[handle] = obj;
 #ifdef GCHANDLE_STACKS
-	if (jvm) {
+	if (captureStacks && jvm) {
 		JNIEnv* env;
 		if (IS_JNI_1_2) {
 			jvm->GetEnv((void **)&env, JNI_VERSION_1_2);
@@ -69,20 +84,19 @@ static int ToHandle(Object^ obj) {
 }
 
 static Object^ ToObject(int handle) {
-	System::Threading::Monitor::Enter(mutex);
-	Object^ result = nullptr;
-	if (handle > 0) result = table[handle - 1];
-	System::Threading::Monitor::Exit(mutex);
-	return result;
+	array<Object^>^current = table;
+	if (handle <= 0 || current == nullptr || handle > current->Length) return nullptr;
+	return current[handle - 1];
 }
 
 static void Free(int handle) {
 	System::Threading::Monitor::Enter(mutex);
 	if (handle > 0) {
-		table[handle - 1] = nextHandle;
+		table[handle - 1] = nullptr;
+		freeList[handle - 1] = nextHandle;
 		nextHandle = handle - 1;
 #ifdef GCHANDLE_STACKS
-		if (exceptions[handle - 1] != 0) {
+		if (captureStacks && exceptions[handle - 1] != 0) {
 			JNIEnv* env;
 			if (IS_JNI_1_2) {
 				jvm->GetEnv((void **)&env, JNI_VERSION_1_2);
@@ -97,11 +111,11 @@ static void Free(int handle) {
 
 static void Dump() {
 	System::Threading::Monitor::Enter(mutex);
-	for (int i=0; i<table->GetLength(0); i++) {
-		if (table[i]->GetType() != Int32::typeid) {
+	for (int i=0; table != nullptr && i<table->Length; i++) {
+		if (table[i] != nullptr) {
 			System::Console::Error->WriteLine("LEAK -> {0}={1} type={2}", i + 1, table[i], table[i]->GetType());
 #ifdef GCHANDLE_STACKS
-			if (exceptions[i] != 0) {
+			if (captureStacks && exceptions[i] != 0) {
 				JNIEnv* env;
 				jvm->GetEnv((void **)&env, JNI_VERSION_1_2);
 				jclass exceptionClass = env->FindClass("java/lang/Throwable");
@@ -1290,7 +1304,7 @@ JNIEXPORT void JNICALL OS_NATIVE(SWTTextRunProperties_1ForegroundBrush)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, SWTTextRunProperties_1ForegroundBrush_FUNC);
-	((SWTTextRunProperties^)TO_OBJECT(arg0))->ForegroundBrush = ((Brush^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(SWTTextRunProperties^, arg0))->ForegroundBrush = ((Brush^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, SWTTextRunProperties_1ForegroundBrush_FUNC);
 }
 #endif
@@ -1302,7 +1316,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(SWTCanvas_1Visual__I)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, SWTCanvas_1Visual__I_FUNC);
-	rc = (jint)TO_HANDLE(((SWTCanvas^)TO_OBJECT(arg0))->Visual);
+	rc = (jint)TO_HANDLE((TO_OBJECT_AS(SWTCanvas^, arg0))->Visual);
 	OS_NATIVE_EXIT(env, that, SWTCanvas_1Visual__I_FUNC);
 	return rc;
 }
@@ -1314,7 +1328,7 @@ JNIEXPORT void JNICALL OS_NATIVE(SWTCanvas_1Visual__II)
 	(JNIEnv *env, jclass that, jint arg0, jint arg1)
 {
 	OS_NATIVE_ENTER(env, that, SWTCanvas_1Visual__II_FUNC);
-	((SWTCanvas^)TO_OBJECT(arg0))->Visual = ((DrawingVisual^)TO_OBJECT(arg1));
+	(TO_OBJECT_AS(SWTCanvas^, arg0))->Visual = ((DrawingVisual^)TO_OBJECT(arg1));
 	OS_NATIVE_EXIT(env, that, SWTCanvas_1Visual__II_FUNC);
 }
 #endif
@@ -1387,7 +1401,7 @@ JNIEXPORT jint JNICALL OS_NATIVE(Bitmap_1GetHicon)
 {
 	jint rc = 0;
 	OS_NATIVE_ENTER(env, that, Bitmap_1GetHicon_FUNC);
-	rc = (jint)(int)((System::Drawing::Bitmap^)TO_OBJECT(arg0))->GetHicon();
+	rc = (jint)(int)(TO_OBJECT_AS(System::Drawing::Bitmap^, arg0))->GetHicon();
 	OS_NATIVE_EXIT(env, that, Bitmap_1GetHicon_FUNC);
 	return rc;
 }
@@ -1511,7 +1525,7 @@ JNIEXPORT void JNICALL OS_NATIVE(ToggleButton_1IsCheckedNullSetter)
 	(JNIEnv *env, jclass that, jint arg0)
 {
 	OS_NATIVE_ENTER(env, that, ToggleButton_1IsCheckedNullSetter_FUNC);
-	((ToggleButton^)TO_OBJECT(arg0))->IsChecked = Nullable<bool>(); 
+	(TO_OBJECT_AS(ToggleButton^, arg0))->IsChecked = Nullable<bool>(); 
 	OS_NATIVE_EXIT(env, that, ToggleButton_1IsCheckedNullSetter_FUNC);
 }
 #endif
@@ -1567,3 +1581,235 @@ JNIEXPORT jint JNICALL OS_NATIVE(gcnew_1SWTAnimation)
 	return rc;
 }
 #endif
+
+#ifndef NO_ItemCollection_1AddItems
+extern "C" JNIEXPORT jint JNICALL OS_NATIVE(ItemCollection_1AddItems)(JNIEnv *env, jclass that, jint arg0, jint arg1, jcharArray arg2, jint arg3);
+JNIEXPORT jint JNICALL OS_NATIVE(ItemCollection_1AddItems)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jcharArray arg2, jint arg3)
+{
+	jchar *lparg2=NULL;
+	jint length = 0, offset = 0;
+	ItemCollection^ items;
+	jint rc = 0;
+	OS_NATIVE_ENTER(env, that, ItemCollection_1AddItems_FUNC);
+	if (arg2) {
+		length = env->GetArrayLength(arg2);
+		if ((lparg2 = env->GetCharArrayElements(arg2, NULL)) == NULL) goto fail;
+	}
+	items = (ItemCollection^)TO_OBJECT(arg0);
+	if (items == nullptr) goto fail;
+	/*
+	* Create and add every item in one call instead of making a round
+	* trip and handle table lookup for each item and its content.  The
+	* collection raises a change notification for each Add either way,
+	* the layout it triggers is deferred to the next render pass.
+	*/
+	for (; rc < arg3; rc++) {
+		ContentControl^ item;
+		switch (arg1) {
+			case 0: item = gcnew ListBoxItem(); break;
+			case 1: item = gcnew ComboBoxItem(); break;
+			case 2: item = gcnew ListViewItem(); break;
+			default: goto fail;
+		}
+		if (lparg2) {
+			jint end = offset;
+			while (end < length && lparg2[end] != 0) end++;
+			if (end == length) goto fail;
+			item->Content = gcnew String((const wchar_t *)lparg2, offset, end - offset);
+			offset = end + 1;
+		}
+		items->Add(item);
+	}
+fail:
+	if (arg2 && lparg2) env->ReleaseCharArrayElements(arg2, lparg2, JNI_ABORT);
+	OS_NATIVE_EXIT(env, that, ItemCollection_1AddItems_FUNC);
+	return rc;
+}
+#endif
+
+/*												*/
+/* Drawing Commands								*/
+/*												*/
+
+#define DRAW_LINE 0
+#define DRAW_POINT 1
+#define DRAW_RECTANGLE 2
+#define DRAW_ROUNDED_RECTANGLE 3
+#define DRAW_ELLIPSE 4
+#define DRAW_POLYLINE 5
+#define DRAW_POLYLINE_CLOSED 1
+#define DRAW_POLYLINE_EVEN_ODD 2
+
+/*
+* Solid color brushes are frozen and shared between all callers asking for
+* the same color.  Frozen brushes can be used from any thread and are not
+* watched for changes by the visuals that render them.
+*/
+public ref class SWTBrushCache {
+	static Object^ mutex = gcnew Object();
+	static Hashtable^ brushes = gcnew Hashtable();
+public:
+	static SolidColorBrush^ Get(Color color) {
+		System::Threading::Monitor::Enter(mutex);
+		try {
+			SolidColorBrush^ brush = (SolidColorBrush^)brushes[color];
+			if (brush == nullptr) {
+				if (brushes->Count >= 256) brushes->Clear();
+				brush = gcnew SolidColorBrush(color);
+				brush->Freeze();
+				brushes[color] = brush;
+			}
+			return brush;
+		} finally {
+			System::Threading::Monitor::Exit(mutex);
+		}
+	}
+};
+
+#ifndef NO_SWTBrushCache_1Get
+extern "C" JNIEXPORT jint JNICALL OS_NATIVE(SWTBrushCache_1Get)(JNIEnv *env, jclass that, jint arg0);
+JNIEXPORT jint JNICALL OS_NATIVE(SWTBrushCache_1Get)
+	(JNIEnv *env, jclass that, jint arg0)
+{
+	jint rc = 0;
+	OS_NATIVE_ENTER(env, that, SWTBrushCache_1Get_FUNC);
+	rc = (jint)TO_HANDLE(SWTBrushCache::Get((Color)TO_OBJECT(arg0)));
+	OS_NATIVE_EXIT(env, that, SWTBrushCache_1Get_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_DrawingContext_1DrawCommands
+extern "C" JNIEXPORT jint JNICALL OS_NATIVE(DrawingContext_1DrawCommands)(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jdoubleArray arg3, jint arg4);
+JNIEXPORT jint JNICALL OS_NATIVE(DrawingContext_1DrawCommands)
+	(JNIEnv *env, jclass that, jint arg0, jint arg1, jint arg2, jdoubleArray arg3, jint arg4)
+{
+	jdouble *lparg3=NULL;
+	DrawingContext^ context;
+	Brush^ brush;
+	Pen^ pen;
+	jint i = 0;
+	jint rc = 0;
+	OS_NATIVE_ENTER(env, that, DrawingContext_1DrawCommands_FUNC);
+	if (arg3 == NULL || arg4 < 0 || arg4 > env->GetArrayLength(arg3)) goto fail;
+	if ((lparg3 = env->GetDoubleArrayElements(arg3, NULL)) == NULL) goto fail;
+	context = (DrawingContext^)TO_OBJECT(arg0);
+	brush = (Brush^)TO_OBJECT(arg1);
+	pen = (Pen^)TO_OBJECT(arg2);
+	/*
+	* Each command is its opcode followed by its coordinates.  Polylines
+	* are built into a frozen StreamGeometry instead of a PathGeometry
+	* with a PathFigure, a PolyLineSegment and a PointCollection that
+	* each need a handle of their own.
+	*/
+	while (i < arg4) {
+		jdouble *args = lparg3 + i + 1;
+		jint remaining = arg4 - i - 1;
+		switch ((int)lparg3[i]) {
+			case DRAW_LINE:
+				if (remaining < 4) goto fail;
+				context->DrawLine(pen, Point(args[0], args[1]), Point(args[2], args[3]));
+				i += 5;
+				break;
+			case DRAW_POINT:
+				if (remaining < 2 || pen == nullptr) goto fail;
+				context->DrawRectangle(pen->Brush, nullptr, Rect(args[0], args[1], 1, 1));
+				i += 3;
+				break;
+			case DRAW_RECTANGLE:
+				if (remaining < 4) goto fail;
+				context->DrawRectangle(brush, pen, Rect(args[0], args[1], args[2], args[3]));
+				i += 5;
+				break;
+			case DRAW_ROUNDED_RECTANGLE:
+				if (remaining < 6) goto fail;
+				context->DrawRoundedRectangle(brush, pen, Rect(args[0], args[1], args[2], args[3]), args[4], args[5]);
+				i += 7;
+				break;
+			case DRAW_ELLIPSE:
+				if (remaining < 4) goto fail;
+				context->DrawEllipse(brush, pen, Point(args[0], args[1]), args[2], args[3]);
+				i += 5;
+				break;
+			case DRAW_POLYLINE: {
+				if (remaining < 2) goto fail;
+				int flags = (int)args[0], count = (int)args[1];
+				if (count < 1 || remaining - 2 < count * 2) goto fail;
+				StreamGeometry^ geometry = gcnew StreamGeometry();
+				geometry->FillRule = (flags & DRAW_POLYLINE_EVEN_ODD) != 0 ? FillRule::EvenOdd : FillRule::Nonzero;
+				StreamGeometryContext^ geometryContext = geometry->Open();
+				geometryContext->BeginFigure(Point(args[2], args[3]), brush != nullptr, (flags & DRAW_POLYLINE_CLOSED) != 0);
+				for (int j = 1; j < count; j++) {
+					geometryContext->LineTo(Point(args[2 + j * 2], args[3 + j * 2]), pen != nullptr, false);
+				}
+				geometryContext->Close();
+				geometry->Freeze();
+				context->DrawGeometry(brush, pen, geometry);
+				i += 3 + count * 2;
+				break;
+			}
+			default:
+				goto fail;
+		}
+		rc++;
+	}
+fail:
+	if (arg3 && lparg3) env->ReleaseDoubleArrayElements(arg3, lparg3, JNI_ABORT);
+	OS_NATIVE_EXIT(env, that, DrawingContext_1DrawCommands_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_WriteableBitmap_1BackBuffer
+extern "C" JNIEXPORT jobject JNICALL OS_NATIVE(WriteableBitmap_1BackBuffer)(JNIEnv *env, jclass that, jint arg0);
+JNIEXPORT jobject JNICALL OS_NATIVE(WriteableBitmap_1BackBuffer)
+	(JNIEnv *env, jclass that, jint arg0)
+{
+	WriteableBitmap^ bitmap;
+	jobject rc = NULL;
+	OS_NATIVE_ENTER(env, that, WriteableBitmap_1BackBuffer_FUNC);
+	/*
+	* The back buffer only stays valid while the bitmap is locked, so
+	* the buffer must not be used after WriteableBitmap_Unlock().
+	*/
+	bitmap = (WriteableBitmap^)TO_OBJECT(arg0);
+	rc = env->NewDirectByteBuffer(bitmap->BackBuffer.ToPointer(), (jlong)bitmap->BackBufferStride * bitmap->PixelHeight);
+	OS_NATIVE_EXIT(env, that, WriteableBitmap_1BackBuffer_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO_TextLine_1GetMetrics
+extern "C" JNIEXPORT void JNICALL OS_NATIVE(TextLine_1GetMetrics)(JNIEnv *env, jclass that, jintArray arg0, jint arg1, jdoubleArray arg2);
+JNIEXPORT void JNICALL OS_NATIVE(TextLine_1GetMetrics)
+	(JNIEnv *env, jclass that, jintArray arg0, jint arg1, jdoubleArray arg2)
+{
+	jint *lparg0=NULL;
+	jdouble *lparg2=NULL;
+	OS_NATIVE_ENTER(env, that, TextLine_1GetMetrics_FUNC);
+	if (arg0 == NULL || arg2 == NULL || arg1 < 0) goto fail;
+	if (arg1 > env->GetArrayLength(arg0) || arg1 * 6 > env->GetArrayLength(arg2)) goto fail;
+	if ((lparg0 = env->GetIntArrayElements(arg0, NULL)) == NULL) goto fail;
+	if ((lparg2 = env->GetDoubleArrayElements(arg2, NULL)) == NULL) goto fail;
+	/*
+	* The metrics of each line are stored in the order of the LINE_*
+	* constants in TextLayout: length, newline length, start, width
+	* including trailing whitespace, height and baseline.
+	*/
+	for (jint i = 0; i < arg1; i++) {
+		TextLine^ line = (TextLine^)TO_OBJECT(lparg0[i]);
+		jdouble *metrics = lparg2 + i * 6;
+		metrics[0] = line->Length;
+		metrics[1] = line->NewlineLength;
+		metrics[2] = line->Start;
+		metrics[3] = line->WidthIncludingTrailingWhitespace;
+		metrics[4] = line->Height;
+		metrics[5] = line->Baseline;
+	}
+fail:
+	if (arg2 && lparg2) env->ReleaseDoubleArrayElements(arg2, lparg2, 0);
+	if (arg0 && lparg0) env->ReleaseIntArrayElements(arg0, lparg0, JNI_ABORT);
+	OS_NATIVE_EXIT(env, that, TextLine_1GetMetrics_FUNC);
+}
+#endif
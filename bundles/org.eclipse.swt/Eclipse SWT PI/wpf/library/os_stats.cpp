@@ -288,6 +288,7 @@ char * OS_nativeFunctionNames[] = {
 	"DrawingColor_1FromArgb",
 	"DrawingColor_1ToArgb",
 	"DrawingContext_1Close",
+	"DrawingContext_1DrawCommands",
 	"DrawingContext_1DrawDrawing",
 	"DrawingContext_1DrawEllipse",
 	"DrawingContext_1DrawGeometry",
@@ -565,6 +566,7 @@ char * OS_nativeFunctionNames[] = {
 	"Int32Rect_1Empty",
 	"IntPtr_1ToInt32",
 	"ItemCollection_1Add",
+	"ItemCollection_1AddItems",
 	"ItemCollection_1Clear",
 	"ItemCollection_1Count",
 	"ItemCollection_1CurrentItem",
@@ -817,6 +819,7 @@ char * OS_nativeFunctionNames[] = {
 	"Run_1Text",
 	"SWTAnimator_1DoubleValueProperty",
 	"SWTAnimator_1IntValueProperty",
+	"SWTBrushCache_1Get",
 	"SWTCanvas_1Visual__I",
 	"SWTCanvas_1Visual__II",
 	"SWTDockPanel_1JNIRefProperty",
@@ -996,6 +999,7 @@ char * OS_nativeFunctionNames[] = {
 	"TextLine_1GetCharacterHitFromDistance",
 	"TextLine_1GetDistanceFromCharacterHit",
 	"TextLine_1GetIndexedGlyphRuns",
+	"TextLine_1GetMetrics",
 	"TextLine_1GetNextCaretCharacterHit",
 	"TextLine_1GetPreviousCaretCharacterHit",
 	"TextLine_1GetTextBounds",
@@ -1234,6 +1238,11 @@ char * OS_nativeFunctionNames[] = {
 	"Window_1WindowStyle__I",
 	"Window_1WindowStyle__II",
 	"WindowsFormsHost_1Child",
+	"WriteableBitmap_1AddDirtyRect",
+	"WriteableBitmap_1BackBuffer",
+	"WriteableBitmap_1BackBufferStride",
+	"WriteableBitmap_1Lock",
+	"WriteableBitmap_1Unlock",
 	"WriteableBitmap_1WritePixels",
 	"XamlReader_1Load",
 	"XmlReader_1Create",
@@ -1447,6 +1456,9 @@ char * OS_nativeFunctionNames[] = {
 #define NATIVE_FUNCTION_COUNT sizeof(OS_nativeFunctionNames) / sizeof(char*)
 int OS_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int OS_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong OS_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT OS_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS OS_nativeStats = {OS_nativeFunctionCallCount, OS_nativeFunctionCallTime, OS_nativeFunctionEvents, 0, "OS", OS_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -1468,4 +1480,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetFunctionCallCount)
 	return OS_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(OS_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return OS_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(OS_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &OS_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(OS_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(OS_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(OS_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
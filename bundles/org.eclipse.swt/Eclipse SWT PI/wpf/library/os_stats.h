@@ -13,8 +13,9 @@
 extern int OS_nativeFunctionCount;
 extern int OS_nativeFunctionCallCount[];
 extern char* OS_nativeFunctionNames[];
-#define OS_NATIVE_ENTER(env, that, func) OS_nativeFunctionCallCount[func]++;
-#define OS_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS OS_nativeStats;
+#define OS_NATIVE_ENTER(env, that, func) nativeStatsEnter(&OS_nativeStats, func);
+#define OS_NATIVE_EXIT(env, that, func) nativeStatsExit(&OS_nativeStats, func);
 #else
 #ifndef OS_NATIVE_ENTER
 #define OS_NATIVE_ENTER(env, that, func) 
@@ -298,6 +299,7 @@ typedef enum {
 	DrawingColor_1FromArgb_FUNC,
 	DrawingColor_1ToArgb_FUNC,
 	DrawingContext_1Close_FUNC,
+	DrawingContext_1DrawCommands_FUNC,
 	DrawingContext_1DrawDrawing_FUNC,
 	DrawingContext_1DrawEllipse_FUNC,
 	DrawingContext_1DrawGeometry_FUNC,
@@ -575,6 +577,7 @@ typedef enum {
 	Int32Rect_1Empty_FUNC,
 	IntPtr_1ToInt32_FUNC,
 	ItemCollection_1Add_FUNC,
+	ItemCollection_1AddItems_FUNC,
 	ItemCollection_1Clear_FUNC,
 	ItemCollection_1Count_FUNC,
 	ItemCollection_1CurrentItem_FUNC,
@@ -827,6 +830,7 @@ typedef enum {
 	Run_1Text_FUNC,
 	SWTAnimator_1DoubleValueProperty_FUNC,
 	SWTAnimator_1IntValueProperty_FUNC,
+	SWTBrushCache_1Get_FUNC,
 	SWTCanvas_1Visual__I_FUNC,
 	SWTCanvas_1Visual__II_FUNC,
 	SWTDockPanel_1JNIRefProperty_FUNC,
@@ -1006,6 +1010,7 @@ typedef enum {
 	TextLine_1GetCharacterHitFromDistance_FUNC,
 	TextLine_1GetDistanceFromCharacterHit_FUNC,
 	TextLine_1GetIndexedGlyphRuns_FUNC,
+	TextLine_1GetMetrics_FUNC,
 	TextLine_1GetNextCaretCharacterHit_FUNC,
 	TextLine_1GetPreviousCaretCharacterHit_FUNC,
 	TextLine_1GetTextBounds_FUNC,
@@ -1244,6 +1249,11 @@ typedef enum {
 	Window_1WindowStyle__I_FUNC,
 	Window_1WindowStyle__II_FUNC,
 	WindowsFormsHost_1Child_FUNC,
+	WriteableBitmap_1AddDirtyRect_FUNC,
+	WriteableBitmap_1BackBuffer_FUNC,
+	WriteableBitmap_1BackBufferStride_FUNC,
+	WriteableBitmap_1Lock_FUNC,
+	WriteableBitmap_1Unlock_FUNC,
 	WriteableBitmap_1WritePixels_FUNC,
 	XamlReader_1Load_FUNC,
 	XmlReader_1Create_FUNC,
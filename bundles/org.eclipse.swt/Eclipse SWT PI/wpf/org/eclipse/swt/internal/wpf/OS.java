@@ -40,6 +40,21 @@ public class OS extends C {
 	public static final int FontStyle_Strikeout = 8;
 	public static final int FontStyle_Underline = 4;
 
+	/* DrawingContext_DrawCommands opcodes */
+	public static final int DrawCommand_Ellipse = 4;
+	public static final int DrawCommand_Line = 0;
+	public static final int DrawCommand_Point = 1;
+	public static final int DrawCommand_Polyline = 5;
+	public static final int DrawCommand_PolylineClosed = 1;
+	public static final int DrawCommand_PolylineEvenOdd = 2;
+	public static final int DrawCommand_Rectangle = 2;
+	public static final int DrawCommand_RoundedRectangle = 3;
+
+	/* ItemCollection_AddItems kinds */
+	public static final int ItemKind_ComboBoxItem = 1;
+	public static final int ItemKind_ListBoxItem = 0;
+	public static final int ItemKind_ListViewItem = 2;
+
 	public static final int Key_LeftAlt = 120;
 	public static final int Key_RightAlt = 121;
 	public static final int Key_LeftCtrl = 118;
@@ -1502,6 +1517,20 @@ public static final native int DrawingColor_ToArgb(int sender);
  * @param sender cast=(DrawingContext^),flags=object
  */
 public static final native void DrawingContext_Close(int sender);
+/**
+ * Draws the first <code>length</code> values of <code>commands</code>,
+ * each command being a <code>DrawCommand_</code> opcode followed by its
+ * arguments: <code>x1, y1, x2, y2</code> for lines, <code>x, y</code>
+ * for points, <code>x, y, width, height</code> for rectangles followed
+ * by <code>radiusX, radiusY</code> for rounded rectangles, <code>centerX,
+ * centerY, radiusX, radiusY</code> for ellipses and <code>flags, count,
+ * x1, y1, ...</code> for polylines.  Points are filled with the brush of
+ * the pen.  Returns the number of commands drawn.
+ *
+ * @method flags=no_gen
+ * @param commands flags=no_out
+ */
+public static final native int DrawingContext_DrawCommands(int sender, int brush, int pen, double[] commands, int length);
 /**
  * @method flags=cpp
  * @param sender cast=(DrawingContext^),flags=object
@@ -2758,6 +2787,16 @@ public static final native int IntPtr_ToInt32 (int value);
  * @param item cast=(Object^),flags=object
  */
 public static final native void ItemCollection_Add(int sender, int item);
+/**
+ * Creates <code>count</code> items of the given kind and adds them to the
+ * collection, setting the content of each item to the next NUL terminated
+ * string of <code>strings</code> when it is not <code>null</code>.  Returns
+ * the number of items added.
+ *
+ * @method flags=no_gen
+ * @param strings flags=no_out
+ */
+public static final native int ItemCollection_AddItems(int sender, int kind, char[] strings, int count);
 /**
  * @method flags=cpp
  * @param sender cast=(ItemCollection^),flags=object
@@ -4147,6 +4186,12 @@ public static final native int String_Length(int sender);
  * @param sender cast=(Style^),flags=object
  */
 public static final native int Style_Setters(int sender);
+/**
+ * Returns a frozen brush shared by all callers asking for the same color.
+ *
+ * @method flags=no_gen
+ */
+public static final native int SWTBrushCache_Get(int color);
 /**
  * @method flags=getter no_gen object
  * @param sender cast=(SWTCanvas^),flags=object
@@ -4595,6 +4640,12 @@ public static final native double TextLine_Height(int sender);
  * @param sender cast=(TextLine^),flags=object
  */
 public static final native int TextLine_NewlineLength(int sender);
+/**
+ * @method flags=no_gen
+ * @param lines flags=no_out
+ * @param metrics flags=no_in
+ */
+public static final native void TextLine_GetMetrics(int[] lines, int count, double[] metrics);
 /**
  * @method flags=cpp object
  * @param sender cast=(TextLine^),flags=object
@@ -5723,6 +5774,32 @@ public static final native void Window_Title(int sender, int string);
  * @param child cast=(System::Windows::Forms::Control^),flags=object
  */
 public static final native void WindowsFormsHost_Child(int sender, int child);
+/**
+ * @method flags=cpp
+ * @param sender cast=(WriteableBitmap^),flags=object
+ * @param dirtyRect cast=(Int32Rect),flags=object
+ */
+public static final native void WriteableBitmap_AddDirtyRect(int sender, int dirtyRect);
+/**
+ * @method flags=no_gen
+ * @param sender cast=(WriteableBitmap^),flags=object
+ */
+public static final native java.nio.ByteBuffer WriteableBitmap_BackBuffer(int sender);
+/**
+ * @method flags=getter
+ * @param sender cast=(WriteableBitmap^),flags=object
+ */
+public static final native int WriteableBitmap_BackBufferStride(int sender);
+/**
+ * @method flags=cpp
+ * @param sender cast=(WriteableBitmap^),flags=object
+ */
+public static final native void WriteableBitmap_Lock(int sender);
+/**
+ * @method flags=cpp
+ * @param sender cast=(WriteableBitmap^),flags=object
+ */
+public static final native void WriteableBitmap_Unlock(int sender);
 /**
  * @method flags=cpp
  * @param sender cast=(WriteableBitmap^),flags=object
@@ -152,7 +152,7 @@ JNIEXPORT jint JNICALL Win32_NATIVE(ExtractIconExW)
 fail:
 	if (arg3 && lparg3) (*env)->ReleaseIntArrayElements(env, arg3, lparg3, 0);
 	if (arg2 && lparg2) (*env)->ReleaseIntArrayElements(env, arg2, lparg2, 0);
-	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, JNI_ABORT);
 	Win32_NATIVE_EXIT(env, that, ExtractIconExW_FUNC);
 	return rc;
 }
@@ -214,7 +214,7 @@ JNIEXPORT jint JNICALL Win32_NATIVE(GetModuleHandleW)
 	if (arg0) if ((lparg0 = (*env)->GetCharArrayElements(env, arg0, NULL)) == NULL) goto fail;
 	rc = (jint)GetModuleHandleW((LPCWSTR)lparg0);
 fail:
-	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, 0);
+	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, JNI_ABORT);
 	Win32_NATIVE_EXIT(env, that, GetModuleHandleW_FUNC);
 	return rc;
 }
@@ -45,6 +45,9 @@ char * Win32_nativeFunctionNames[] = {
 #define NATIVE_FUNCTION_COUNT sizeof(Win32_nativeFunctionNames) / sizeof(char*)
 int Win32_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int Win32_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong Win32_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT Win32_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS Win32_nativeStats = {Win32_nativeFunctionCallCount, Win32_nativeFunctionCallTime, Win32_nativeFunctionEvents, 0, "Win32", Win32_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -66,4 +69,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(Win32_1GetFunctionCallCount)
 	return Win32_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(Win32_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return Win32_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(Win32_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Win32_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &Win32_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Win32_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(Win32_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Win32_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(Win32_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(Win32_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
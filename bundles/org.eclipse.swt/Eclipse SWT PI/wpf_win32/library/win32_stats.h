@@ -13,8 +13,9 @@
 extern int Win32_nativeFunctionCount;
 extern int Win32_nativeFunctionCallCount[];
 extern char* Win32_nativeFunctionNames[];
-#define Win32_NATIVE_ENTER(env, that, func) Win32_nativeFunctionCallCount[func]++;
-#define Win32_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS Win32_nativeStats;
+#define Win32_NATIVE_ENTER(env, that, func) nativeStatsEnter(&Win32_nativeStats, func);
+#define Win32_NATIVE_EXIT(env, that, func) nativeStatsExit(&Win32_nativeStats, func);
 #else
 #ifndef Win32_NATIVE_ENTER
 #define Win32_NATIVE_ENTER(env, that, func) 
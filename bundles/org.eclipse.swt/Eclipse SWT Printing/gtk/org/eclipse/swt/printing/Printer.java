@@ -11,6 +11,8 @@
 package org.eclipse.swt.printing;
 
 
+import java.io.*;
+
 import org.eclipse.swt.*;
 import org.eclipse.swt.graphics.*;
 import org.eclipse.swt.internal.Callback;
@@ -54,6 +56,14 @@ public final class Printer extends Device {
 	long /*int*/ pageSetup;
 	long /*int*/ surface;
 	long /*int*/ cairo;
+
+	/**
+	 * the file and callback that a PDF or PostScript file is
+	 * written through while a job is printed to it directly
+	 */
+	OutputStream stream;
+	Callback writeCallback;
+	byte [] writeBuffer;
 	
 	/**
 	 * whether or not a GC was created for this printer
@@ -66,6 +76,9 @@ public final class Printer extends Device {
 	static final String GTK_LPR_BACKEND = "GtkPrintBackendLpr"; //$NON-NLS-1$
 	static final String GTK_FILE_BACKEND = "GtkPrintBackendFile"; //$NON-NLS-1$
 
+	/* The largest chunk that is copied from cairo to the file at a time */
+	static final int WRITE_BUFFER_SIZE = 64 * 1024;
+
 	static boolean disablePrinting = System.getProperty("org.eclipse.swt.internal.gtk.disablePrinting") != null; //$NON-NLS-1$
 	
 static void gtk_init() {
@@ -493,6 +506,7 @@ public void internal_dispose_GC(long /*int*/ hDC, GCData data) {
  */
 public boolean startJob(String jobName) {
 	checkDevice();
+	if (startStreamJob()) return true;
 	byte [] buffer = Converter.wcsToMbcs (null, jobName, true);
 	printJob = OS.gtk_print_job_new (buffer, printer, settings, pageSetup);
 	if (printJob == 0) return false;
@@ -511,6 +525,72 @@ public boolean startJob(String jobName) {
 	return true;
 }
 
+/*
+* When printing to a PDF or PostScript file, cairo writes the pages to the
+* file in chunks as each page is shown, instead of to the spool file of a
+* GTK print job that is copied to the file when the job is sent.
+*/
+boolean startStreamJob() {
+	if (!data.printToFile || data.fileName == null) return false;
+	String name = data.fileName.toLowerCase();
+	boolean pdf = name.endsWith(".pdf"), ps = name.endsWith(".ps"); //$NON-NLS-1$ //$NON-NLS-2$
+	if (!pdf && !ps) return false;
+	try {
+		stream = new FileOutputStream(data.fileName);
+	} catch (IOException e) {
+		return false;
+	}
+	writeCallback = new Callback(this, "cairoWriteFunc", 3); //$NON-NLS-1$
+	long /*int*/ writeFunc = writeCallback.getAddress();
+	if (writeFunc == 0) SWT.error(SWT.ERROR_NO_MORE_CALLBACKS);
+	double width = OS.gtk_page_setup_get_paper_width (pageSetup, OS.GTK_UNIT_POINTS);
+	double height = OS.gtk_page_setup_get_paper_height (pageSetup, OS.GTK_UNIT_POINTS);
+	if (pdf) {
+		surface = Cairo.cairo_pdf_surface_create_for_stream(writeFunc, 0, width, height);
+	} else {
+		surface = Cairo.cairo_ps_surface_create_for_stream(writeFunc, 0, width, height);
+	}
+	if (surface != 0) cairo = Cairo.cairo_create(surface);
+	if (cairo == 0) {
+		endStreamJob();
+		return false;
+	}
+	return true;
+}
+
+void endStreamJob() {
+	if (surface != 0) {
+		Cairo.cairo_surface_finish(surface);
+		Cairo.cairo_surface_destroy(surface);
+		surface = 0;
+	}
+	try {
+		if (stream != null) stream.close();
+	} catch (IOException e) {
+	}
+	stream = null;
+	writeBuffer = null;
+	if (writeCallback != null) writeCallback.dispose();
+	writeCallback = null;
+}
+
+long /*int*/ cairoWriteFunc(long /*int*/ closure, long /*int*/ data, long /*int*/ length) {
+	if (stream == null) return Cairo.CAIRO_STATUS_WRITE_ERROR;
+	/* The length is an unsigned int, so only its low 32 bits are valid */
+	long size = length & 0xFFFFFFFFL;
+	if (writeBuffer == null) writeBuffer = new byte [WRITE_BUFFER_SIZE];
+	try {
+		for (long offset = 0; offset < size; offset += WRITE_BUFFER_SIZE) {
+			int count = (int)Math.min(WRITE_BUFFER_SIZE, size - offset);
+			OS.memmove(writeBuffer, data + offset, count);
+			stream.write(writeBuffer, 0, count);
+		}
+	} catch (IOException e) {
+		return Cairo.CAIRO_STATUS_WRITE_ERROR;
+	}
+	return Cairo.CAIRO_STATUS_SUCCESS;
+}
+
 /**	 
  * Destroys the printer handle.
  * This method is called internally by the dispose
@@ -523,6 +603,7 @@ protected void destroy () {
 	if (pageSetup != 0) OS.g_object_unref (pageSetup);
 	if (cairo != 0) Cairo.cairo_destroy (cairo);
 	if (printJob != 0) OS.g_object_unref (printJob);
+	if (writeCallback != null) endStreamJob();
 	printer = settings = pageSetup = cairo = printJob = 0;
 }
 
@@ -539,6 +620,10 @@ protected void destroy () {
  */
 public void endJob() {
 	checkDevice();
+	if (writeCallback != null) {
+		endStreamJob();
+		return;
+	}
 	if (printJob == 0) return;
 	Cairo.cairo_surface_finish(surface);
 	OS.gtk_print_job_send(printJob, 0, 0, 0);
@@ -555,6 +640,11 @@ public void endJob() {
  */
 public void cancelJob() {
 	checkDevice();
+	if (writeCallback != null) {
+		endStreamJob();
+		new File(data.fileName).delete();
+		return;
+	}
 	if (printJob == 0) return;
 	//TODO: Need to implement (waiting on gtk bug 339323) 
 	Cairo.cairo_surface_finish(surface);
@@ -582,7 +672,7 @@ public void cancelJob() {
  */
 public boolean startPage() {
 	checkDevice();
-	if (printJob == 0) return false;
+	if (printJob == 0 && writeCallback == null) return false;
 	double width = OS.gtk_page_setup_get_paper_width (pageSetup, OS.GTK_UNIT_POINTS);
 	double height = OS.gtk_page_setup_get_paper_height (pageSetup, OS.GTK_UNIT_POINTS);
 	int type = Cairo.cairo_surface_get_type (surface);
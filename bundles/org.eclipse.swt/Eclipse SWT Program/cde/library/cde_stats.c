@@ -38,6 +38,9 @@ char * CDE_nativeFunctionNames[] = {
 #define NATIVE_FUNCTION_COUNT sizeof(CDE_nativeFunctionNames) / sizeof(char*)
 int CDE_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int CDE_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong CDE_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT CDE_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS CDE_nativeStats = {CDE_nativeFunctionCallCount, CDE_nativeFunctionCallTime, CDE_nativeFunctionEvents, 0, "CDE", CDE_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -59,4 +62,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(CDE_1GetFunctionCallCount)
 	return CDE_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(CDE_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return CDE_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(CDE_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(CDE_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &CDE_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(CDE_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(CDE_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(CDE_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(CDE_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(CDE_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
@@ -13,8 +13,9 @@
 extern int CDE_nativeFunctionCount;
 extern int CDE_nativeFunctionCallCount[];
 extern char* CDE_nativeFunctionNames[];
-#define CDE_NATIVE_ENTER(env, that, func) CDE_nativeFunctionCallCount[func]++;
-#define CDE_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS CDE_nativeStats;
+#define CDE_NATIVE_ENTER(env, that, func) nativeStatsEnter(&CDE_nativeStats, func);
+#define CDE_NATIVE_EXIT(env, that, func) nativeStatsExit(&CDE_nativeStats, func);
 #else
 #ifndef CDE_NATIVE_ENTER
 #define CDE_NATIVE_ENTER(env, that, func) 
@@ -21,6 +21,7 @@
 char * GNOME_nativeFunctionNames[] = {
 	"GnomeVFSMimeApplication_1sizeof",
 	"_1gnome_1icon_1lookup",
+	"_1gnome_1icon_1theme_1has_1updated",
 	"_1gnome_1icon_1theme_1lookup_1icon",
 	"_1gnome_1icon_1theme_1new",
 	"_1gnome_1vfs_1get_1mime_1type",
@@ -39,6 +40,9 @@ char * GNOME_nativeFunctionNames[] = {
 #define NATIVE_FUNCTION_COUNT sizeof(GNOME_nativeFunctionNames) / sizeof(char*)
 int GNOME_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int GNOME_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong GNOME_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT GNOME_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS GNOME_nativeStats = {GNOME_nativeFunctionCallCount, GNOME_nativeFunctionCallTime, GNOME_nativeFunctionEvents, 0, "GNOME", GNOME_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -60,4 +64,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(GNOME_1GetFunctionCallCount)
 	return GNOME_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(GNOME_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return GNOME_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(GNOME_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(GNOME_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &GNOME_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(GNOME_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(GNOME_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(GNOME_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(GNOME_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(GNOME_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
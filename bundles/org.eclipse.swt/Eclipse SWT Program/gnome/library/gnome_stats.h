@@ -17,8 +17,9 @@
 extern int GNOME_nativeFunctionCount;
 extern int GNOME_nativeFunctionCallCount[];
 extern char* GNOME_nativeFunctionNames[];
-#define GNOME_NATIVE_ENTER(env, that, func) GNOME_nativeFunctionCallCount[func]++;
-#define GNOME_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS GNOME_nativeStats;
+#define GNOME_NATIVE_ENTER(env, that, func) nativeStatsEnter(&GNOME_nativeStats, func);
+#define GNOME_NATIVE_EXIT(env, that, func) nativeStatsExit(&GNOME_nativeStats, func);
 #else
 #ifndef GNOME_NATIVE_ENTER
 #define GNOME_NATIVE_ENTER(env, that, func) 
@@ -31,6 +32,7 @@ extern char* GNOME_nativeFunctionNames[];
 typedef enum {
 	GnomeVFSMimeApplication_1sizeof_FUNC,
 	_1gnome_1icon_1lookup_FUNC,
+	_1gnome_1icon_1theme_1has_1updated_FUNC,
 	_1gnome_1icon_1theme_1lookup_1icon_FUNC,
 	_1gnome_1icon_1theme_1new_FUNC,
 	_1gnome_1vfs_1get_1mime_1type_FUNC,
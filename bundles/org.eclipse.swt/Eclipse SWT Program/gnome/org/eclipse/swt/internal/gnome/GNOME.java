@@ -57,6 +57,17 @@ public static final long /*int*/ gnome_icon_lookup(long /*int*/ icon_theme, long
 		lock.unlock();
 	}
 }
+/** @param icon_theme cast=(GnomeIconTheme *) */
+public static final native boolean _gnome_icon_theme_has_updated(long /*int*/ icon_theme);
+public static final boolean gnome_icon_theme_has_updated(long /*int*/ icon_theme) {
+	lock.lock();
+	try {
+		return _gnome_icon_theme_has_updated(icon_theme);
+	} finally {
+		lock.unlock();
+	}
+}
+
 /**
  * @param theme cast=(GnomeIconTheme *)
  * @param icon_name cast=(const char *)
@@ -52,6 +52,8 @@ public final class Program {
 	static final String[] CDE_MASK_EXT = { ".m_m.bm", ".l_m.bm", ".s_m.bm", ".t_m.bm" }; //$NON-NLS-1$ //$NON-NLS-2$ //$NON-NLS-3$ //$NON-NLS-4$
 	static final String DESKTOP_DATA = "Program_DESKTOP"; //$NON-NLS-1$
 	static final String ICON_THEME_DATA = "Program_GNOME_ICON_THEME"; //$NON-NLS-1$
+	static final String PROGRAM_CACHE_DATA = "Program_GNOME_PROGRAM_CACHE"; //$NON-NLS-1$
+	static final String IMAGE_CACHE_DATA = "Program_GNOME_IMAGE_CACHE"; //$NON-NLS-1$
 	static final String PREFIX_HTTP = "http://"; //$NON-NLS-1$
 	static final String PREFIX_HTTPS = "https://"; //$NON-NLS-1$
 	static final int DESKTOP_UNKNOWN = 0;
@@ -118,6 +120,7 @@ static int getDesktop(final Display display) {
 				long /*int*/ g_app_info_launch_default_for_uri = OS.dlsym(libgio, buffer);
 				if (g_app_info_launch_default_for_uri != 0) {
 					desktop = DESKTOP_GIO;
+					gio_preloadMimeInfo();
 				}
 				OS.dlclose(libgio);
 			}
@@ -398,10 +401,54 @@ static boolean gnome_launch(String fileName) {
  */ 
 ImageData gnome_getImageData() {
 	if (iconPath == null) return null;
-	try {
-		return new ImageData(iconPath);
-	} catch (Exception e) {}
-	return null;
+	Hashtable cache = gnome_getCache(display, IMAGE_CACHE_DATA);
+	Object value = cache.get(iconPath);
+	if (value == null) {
+		try {
+			value = new ImageData(iconPath);
+		} catch (Exception e) {
+			value = iconPath;
+		}
+		cache.put(iconPath, value);
+	}
+	/* The cached image data is copied since callers are free to modify it */
+	return value instanceof ImageData ? (ImageData)((ImageData)value).clone() : null;
+}
+
+/*
+ * Returns the cache stored in the display under the given key.  The
+ * lookups made through gnome-vfs and the icon theme are expensive and
+ * views that list files make them for every file, so their results are
+ * kept until the display is disposed or the icon theme changes.
+ */
+static Hashtable gnome_getCache(Display display, String key) {
+	LONG gnomeIconTheme = (LONG)display.getData(ICON_THEME_DATA);
+	if (gnomeIconTheme != null && GNOME.gnome_icon_theme_has_updated(gnomeIconTheme.value)) {
+		display.setData(PROGRAM_CACHE_DATA, null);
+		display.setData(IMAGE_CACHE_DATA, null);
+	}
+	Hashtable cache = (Hashtable)display.getData(key);
+	if (cache == null) {
+		cache = new Hashtable();
+		display.setData(key, cache);
+	}
+	return cache;
+}
+
+/*
+ * Extensions that have no program are cached too.  They map to
+ * themselves since a Hashtable cannot hold null values.
+ */
+static Program gnome_findProgram(Display display, String extension) {
+	Hashtable cache = gnome_getCache(display, PROGRAM_CACHE_DATA);
+	Object value = cache.get(extension);
+	if (value == null) {
+		String mimeType = gnome_getMimeType(extension);
+		Program program = mimeType != null ? gnome_getProgram(display, mimeType) : null;
+		value = program != null ? (Object)program : extension;
+		cache.put(extension, value);
+	}
+	return value instanceof Program ? (Program)value : null;
 }
 
 
@@ -518,17 +565,16 @@ static Program findProgram(Display display, String extension) {
 	if (extension.length() == 0) return null;
 	if (extension.charAt(0) != '.') extension = "." + extension;
 	int desktop = getDesktop(display);
+	if (desktop == DESKTOP_GNOME) return gnome_findProgram(display, extension);
 	String mimeType = null;
 	switch (desktop) {
 		case DESKTOP_GIO: mimeType = gio_getMimeType(extension); break;
-		case DESKTOP_GNOME: mimeType = gnome_getMimeType(extension); break;
 		case DESKTOP_CDE: mimeType = cde_getMimeType(extension); break;
 	}
 	if (mimeType == null) return null;
 	Program program = null;
 	switch (desktop) {
 		case DESKTOP_GIO: program = gio_getProgram(display, mimeType); break;
-		case DESKTOP_GNOME: program = gnome_getProgram(display, mimeType); break;
 		case DESKTOP_CDE: program = cde_getProgram(display, mimeType); break;
 	}
 	return program;
@@ -667,7 +713,7 @@ ImageData gio_getImageData() {
 	return data;
 }
 
-static Hashtable gio_getMimeInfo() {
+static synchronized Hashtable gio_getMimeInfo() {
 	long /*int*/ mimeDatabase = 0, fileInfo = 0;
 	/*
 	* The file 'globs' contain the file extensions  
@@ -736,6 +782,22 @@ static Hashtable gio_getMimeInfo() {
 	}
 }
 
+/*
+ * Parsing the globs file takes long enough to be noticed when the first
+ * program is looked up, so it is started in the background as soon as
+ * the desktop is known.  A lookup made before it finishes waits for it
+ * instead of parsing the file again.
+ */
+static void gio_preloadMimeInfo() {
+	Thread thread = new Thread("SWT Program MIME preloader") { //$NON-NLS-1$
+		public void run() {
+			gio_getMimeInfo();
+		}
+	};
+	thread.setDaemon(true);
+	thread.start();
+}
+
 static String gio_getMimeType(String extension) {
 	String mimeType = null;
 	Hashtable h = gio_getMimeInfo();
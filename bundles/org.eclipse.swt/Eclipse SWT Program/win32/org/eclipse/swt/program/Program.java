@@ -10,9 +10,12 @@
  *******************************************************************************/
 package org.eclipse.swt.program;
 
+import java.util.Hashtable;
+
 import org.eclipse.swt.internal.win32.*;
 import org.eclipse.swt.*;
 import org.eclipse.swt.graphics.*;
+import org.eclipse.swt.widgets.*;
 
 /**
  * Instances of this class represent programs and
@@ -28,6 +31,8 @@ public final class Program {
 	String iconName;
 	String extension;
 	static final String [] ARGUMENTS = new String [] {"%1", "%l", "%L"}; //$NON-NLS-1$ //$NON-NLS-2$ //$NON-NLS-3$
+	static final String PROGRAM_CACHE_DATA = "Program_WIN32_PROGRAM_CACHE"; //$NON-NLS-1$
+	static final String IMAGE_CACHE_DATA = "Program_WIN32_IMAGE_CACHE"; //$NON-NLS-1$
 
 /**
  * Prevents uninitialized instances from being created outside the package.
@@ -79,6 +84,23 @@ public static Program findProgram (String extension) {
 	if (extension == null) SWT.error (SWT.ERROR_NULL_ARGUMENT);
 	if (extension.length () == 0) return null;
 	if (extension.charAt (0) != '.') extension = "." + extension; //$NON-NLS-1$
+	Hashtable cache = getCache (PROGRAM_CACHE_DATA);
+	if (cache == null) return findProgramNoCache (extension);
+	/*
+	* Extensions that have no program are cached too.  They map to
+	* themselves since a Hashtable cannot hold null values.
+	*/
+	String cacheKey = extension.toLowerCase ();
+	Object value = cache.get (cacheKey);
+	if (value == null) {
+		Program program = findProgramNoCache (extension);
+		value = program != null ? (Object) program : cacheKey;
+		cache.put (cacheKey, value);
+	}
+	return value instanceof Program ? (Program) value : null;
+}
+
+static Program findProgramNoCache (String extension) {
 	/* Use the character encoding for the default locale */
 	TCHAR key = new TCHAR (0, extension, true);
 	Program program = null;
@@ -149,6 +171,24 @@ public static String [] getExtensions () {
 	return extensions;
 }
 
+/*
+ * Returns the cache stored in the current display under the given key,
+ * or null when called outside of the user-interface thread.  The registry
+ * and shell lookups behind findProgram() and getImageData() are expensive
+ * and views that list files make them for every file, so their results
+ * are kept until the display is disposed.
+ */
+static Hashtable getCache (String key) {
+	Display display = Display.getCurrent ();
+	if (display == null) return null;
+	Hashtable cache = (Hashtable) display.getData (key);
+	if (cache == null) {
+		cache = new Hashtable ();
+		display.setData (key, cache);
+	}
+	return cache;
+}
+
 static String getKeyValue (String string, boolean expand) {
 	/* Use the character encoding for the default locale */
 	TCHAR key = new TCHAR (0, string, true);
@@ -368,6 +408,20 @@ public boolean execute (String fileName) {
  * @return the image data for the program, may be null
  */
 public ImageData getImageData () {
+	Hashtable cache = getCache (IMAGE_CACHE_DATA);
+	if (cache == null) return getImageDataNoCache ();
+	String cacheKey = (extension != null ? extension.toLowerCase () : "") + "|" + iconName; //$NON-NLS-1$ //$NON-NLS-2$
+	Object value = cache.get (cacheKey);
+	if (value == null) {
+		ImageData imageData = getImageDataNoCache ();
+		value = imageData != null ? (Object) imageData : cacheKey;
+		cache.put (cacheKey, value);
+	}
+	/* The cached image data is copied since callers are free to modify it */
+	return value instanceof ImageData ? (ImageData) ((ImageData) value).clone () : null;
+}
+
+ImageData getImageDataNoCache () {
 	if (extension != null) {
 		SHFILEINFO shfi = OS.IsUnicode ? (SHFILEINFO) new SHFILEINFOW () : new SHFILEINFOA ();
 		int flags = OS.SHGFI_ICON | OS.SHGFI_SMALLICON | OS.SHGFI_USEFILEATTRIBUTES;
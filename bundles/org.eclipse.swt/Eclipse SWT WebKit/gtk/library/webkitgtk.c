@@ -254,6 +254,30 @@ fail:
 }
 #endif
 
+#ifndef NO__1JSStringCreateWithCharacters
+JNIEXPORT jintLong JNICALL WebKitGTK_NATIVE(_1JSStringCreateWithCharacters)
+	(JNIEnv *env, jclass that, jcharArray arg0, jintLong arg1)
+{
+	jchar *lparg0=NULL;
+	jintLong rc = 0;
+	WebKitGTK_NATIVE_ENTER(env, that, _1JSStringCreateWithCharacters_FUNC);
+	if (arg0) if ((lparg0 = (*env)->GetCharArrayElements(env, arg0, NULL)) == NULL) goto fail;
+/*
+	rc = (jintLong)JSStringCreateWithCharacters(lparg0, arg1);
+*/
+	{
+		WebKitGTK_LOAD_FUNCTION(fp, JSStringCreateWithCharacters)
+		if (fp) {
+			rc = (jintLong)((jintLong (CALLING_CONVENTION*)(jchar *, jintLong))fp)(lparg0, arg1);
+		}
+	}
+fail:
+	if (arg0 && lparg0) (*env)->ReleaseCharArrayElements(env, arg0, lparg0, JNI_ABORT);
+	WebKitGTK_NATIVE_EXIT(env, that, _1JSStringCreateWithCharacters_FUNC);
+	return rc;
+}
+#endif
+
 #ifndef NO__1JSStringCreateWithUTF8CString
 JNIEXPORT jintLong JNICALL WebKitGTK_NATIVE(_1JSStringCreateWithUTF8CString)
 	(JNIEnv *env, jclass that, jbyteArray arg0)
@@ -0,0 +1,575 @@
+/*******************************************************************************
+ * Copyright (c) 2009, 2014 IBM Corporation and others. All rights reserved.
+ * The contents of this file are made available under the terms
+ * of the GNU Lesser General Public License (LGPL) Version 2.1 that
+ * accompanies this distribution (lgpl-v21.txt).  The LGPL is also
+ * available at http://www.gnu.org/licenses/lgpl.html.  If the version
+ * of the LGPL at http://www.gnu.org is different to the version of
+ * the LGPL accompanying this distribution and there is any conflict
+ * between the two license versions, the terms of the LGPL accompanying
+ * this distribution shall govern.
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+
+#include "swt.h"
+#include "webkitgtk_structs.h"
+#include "webkitgtk_stats.h"
+
+#ifndef WebKitGTK_NATIVE
+#define WebKitGTK_NATIVE(func) Java_org_eclipse_swt_internal_webkit_WebKitGTK_##func
+#endif
+
+#define SWT_WEBKIT_FUNCTION(name) \
+static void *load_##name() { \
+	WebKitGTK_LOAD_FUNCTION(fp, name) \
+	return fp; \
+}
+
+#if !defined(NO__1swt_1JSStringGetString) || !defined(NO__1swt_1JSValueSerialize)
+SWT_WEBKIT_FUNCTION(JSStringGetCharactersPtr)
+SWT_WEBKIT_FUNCTION(JSStringGetLength)
+#endif
+
+#ifndef NO__1swt_1JSStringGetString
+JNIEXPORT jstring JNICALL WebKitGTK_NATIVE(_1swt_1JSStringGetString)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	jstring rc = NULL;
+	WebKitGTK_NATIVE_ENTER(env, that, _1swt_1JSStringGetString_FUNC);
+	{
+		const jchar *(*getCharactersPtr)(jintLong) = load_JSStringGetCharactersPtr();
+		size_t (*getLength)(jintLong) = load_JSStringGetLength();
+		if (arg0 && getCharactersPtr && getLength) {
+			rc = (*env)->NewString(env, getCharactersPtr(arg0), (jsize)getLength(arg0));
+		}
+	}
+	WebKitGTK_NATIVE_EXIT(env, that, _1swt_1JSStringGetString_FUNC);
+	return rc;
+}
+#endif
+
+#if !defined(NO__1swt_1JSValueDeserialize) || !defined(NO__1swt_1JSValueSerialize) || !defined(NO__1swt_1JSValueSerializeArguments)
+
+/* The tags of the values in serialized buffers */
+#define SWT_JS_NULL 0
+#define SWT_JS_BOOLEAN 1
+#define SWT_JS_NUMBER 2
+#define SWT_JS_STRING 3
+#define SWT_JS_ARRAY 4
+
+/* Deeper arrays are left to the Java conversions */
+#define SWT_JS_MAX_DEPTH 64
+
+SWT_WEBKIT_FUNCTION(JSValueGetType)
+SWT_WEBKIT_FUNCTION(JSValueToNumber)
+SWT_WEBKIT_FUNCTION(JSValueToStringCopy)
+SWT_WEBKIT_FUNCTION(JSStringCreateWithUTF8CString)
+SWT_WEBKIT_FUNCTION(JSStringRelease)
+SWT_WEBKIT_FUNCTION(JSObjectGetProperty)
+SWT_WEBKIT_FUNCTION(JSObjectGetPropertyAtIndex)
+SWT_WEBKIT_FUNCTION(JSStringCreateWithCharacters)
+SWT_WEBKIT_FUNCTION(JSValueMakeUndefined)
+SWT_WEBKIT_FUNCTION(JSValueMakeBoolean)
+SWT_WEBKIT_FUNCTION(JSValueMakeNumber)
+SWT_WEBKIT_FUNCTION(JSValueMakeString)
+SWT_WEBKIT_FUNCTION(JSObjectMakeArray)
+
+typedef struct SwtJSFunctions {
+	jint (*JSValueGetType)(jintLong, jintLong);
+	jdouble (*JSValueToNumber)(jintLong, jintLong, jintLong *);
+	jintLong (*JSValueToStringCopy)(jintLong, jintLong, jintLong *);
+	jintLong (*JSStringCreateWithUTF8CString)(const char *);
+	const jchar *(*JSStringGetCharactersPtr)(jintLong);
+	size_t (*JSStringGetLength)(jintLong);
+	void (*JSStringRelease)(jintLong);
+	jintLong (*JSObjectGetProperty)(jintLong, jintLong, jintLong, jintLong *);
+	jintLong (*JSObjectGetPropertyAtIndex)(jintLong, jintLong, jint, jintLong *);
+	jintLong (*JSStringCreateWithCharacters)(const jchar *, size_t);
+	jintLong (*JSValueMakeUndefined)(jintLong);
+	jintLong (*JSValueMakeBoolean)(jintLong, jint);
+	jintLong (*JSValueMakeNumber)(jintLong, jdouble);
+	jintLong (*JSValueMakeString)(jintLong, jintLong);
+	jintLong (*JSObjectMakeArray)(jintLong, size_t, const jintLong *, jintLong *);
+	jintLong length;
+	int canSerialize, canDeserialize;
+} SwtJSFunctions;
+
+typedef struct SwtJSBuffer {
+	char *data;
+	size_t size, capacity;
+} SwtJSBuffer;
+
+static SwtJSFunctions *swt_js_functions() {
+	static int initialized = 0;
+	static SwtJSFunctions fns;
+	if (!initialized) {
+		fns.JSValueGetType = load_JSValueGetType();
+		fns.JSValueToNumber = load_JSValueToNumber();
+		fns.JSValueToStringCopy = load_JSValueToStringCopy();
+		fns.JSStringCreateWithUTF8CString = load_JSStringCreateWithUTF8CString();
+		fns.JSStringGetCharactersPtr = load_JSStringGetCharactersPtr();
+		fns.JSStringGetLength = load_JSStringGetLength();
+		fns.JSStringRelease = load_JSStringRelease();
+		fns.JSObjectGetProperty = load_JSObjectGetProperty();
+		fns.JSObjectGetPropertyAtIndex = load_JSObjectGetPropertyAtIndex();
+		fns.JSStringCreateWithCharacters = load_JSStringCreateWithCharacters();
+		fns.JSValueMakeUndefined = load_JSValueMakeUndefined();
+		fns.JSValueMakeBoolean = load_JSValueMakeBoolean();
+		fns.JSValueMakeNumber = load_JSValueMakeNumber();
+		fns.JSValueMakeString = load_JSValueMakeString();
+		fns.JSObjectMakeArray = load_JSObjectMakeArray();
+		if (fns.JSStringCreateWithUTF8CString) {
+			fns.length = fns.JSStringCreateWithUTF8CString("length");
+		}
+		fns.canSerialize = fns.JSValueGetType && fns.JSValueToNumber && fns.JSValueToStringCopy
+			&& fns.JSStringGetCharactersPtr && fns.JSStringGetLength && fns.JSStringRelease
+			&& fns.JSObjectGetProperty && fns.JSObjectGetPropertyAtIndex && fns.length;
+		fns.canDeserialize = fns.JSStringCreateWithCharacters && fns.JSStringRelease
+			&& fns.JSValueMakeUndefined && fns.JSValueMakeBoolean && fns.JSValueMakeNumber
+			&& fns.JSValueMakeString && fns.JSObjectMakeArray;
+		initialized = 1;
+	}
+	return &fns;
+}
+
+static char *swt_js_reserve(SwtJSBuffer *buffer, size_t size) {
+	char *result;
+	if (buffer->capacity - buffer->size < size) {
+		size_t capacity = buffer->capacity ? buffer->capacity : 256;
+		char *data;
+		while (capacity - buffer->size < size) capacity *= 2;
+		data = realloc(buffer->data, capacity);
+		if (data == NULL) return NULL;
+		buffer->data = data;
+		buffer->capacity = capacity;
+	}
+	result = buffer->data + buffer->size;
+	buffer->size += size;
+	return result;
+}
+
+static int swt_js_put(SwtJSBuffer *buffer, jbyte tag, const void *value, size_t size) {
+	char *data = swt_js_reserve(buffer, 1 + size);
+	if (data == NULL) return 0;
+	data[0] = tag;
+	if (size) memcpy(data + 1, value, size);
+	return 1;
+}
+
+static int swt_js_serialize(SwtJSFunctions *fns, jintLong ctx, jintLong value, SwtJSBuffer *buffer, int depth) {
+	switch (fns->JSValueGetType(ctx, value)) {
+		case 0: /* kJSTypeUndefined */
+		case 1: /* kJSTypeNull */
+			return swt_js_put(buffer, SWT_JS_NULL, NULL, 0);
+		case 2: { /* kJSTypeBoolean */
+			jbyte result = (jint)fns->JSValueToNumber(ctx, value, NULL) != 0;
+			return swt_js_put(buffer, SWT_JS_BOOLEAN, &result, 1);
+		}
+		case 3: { /* kJSTypeNumber */
+			jdouble result = fns->JSValueToNumber(ctx, value, NULL);
+			return swt_js_put(buffer, SWT_JS_NUMBER, &result, sizeof(result));
+		}
+		case 4: { /* kJSTypeString */
+			jint length = 0;
+			char *data;
+			jintLong string = fns->JSValueToStringCopy(ctx, value, NULL);
+			if (string != 0) length = (jint)fns->JSStringGetLength(string);
+			data = swt_js_reserve(buffer, 1 + sizeof(length) + length * sizeof(jchar));
+			if (data != NULL) {
+				data[0] = SWT_JS_STRING;
+				memcpy(data + 1, &length, sizeof(length));
+				if (length) memcpy(data + 1 + sizeof(length), fns->JSStringGetCharactersPtr(string), length * sizeof(jchar));
+			}
+			if (string != 0) fns->JSStringRelease(string);
+			return data != NULL;
+		}
+		case 5: { /* kJSTypeObject */
+			jint i, length;
+			jintLong lengthValue;
+			if (depth >= SWT_JS_MAX_DEPTH) return 0;
+			lengthValue = fns->JSObjectGetProperty(ctx, value, fns->length, NULL);
+			if (lengthValue == 0 || fns->JSValueGetType(ctx, lengthValue) != 3) return 0;
+			length = (jint)fns->JSValueToNumber(ctx, lengthValue, NULL);
+			if (length < 0) length = 0;
+			if (!swt_js_put(buffer, SWT_JS_ARRAY, &length, sizeof(length))) return 0;
+			for (i = 0; i < length; i++) {
+				jintLong current = fns->JSObjectGetPropertyAtIndex(ctx, value, i, NULL);
+				if (current == 0) {
+					if (!swt_js_put(buffer, SWT_JS_NULL, NULL, 0)) return 0;
+				} else {
+					if (!swt_js_serialize(fns, ctx, current, buffer, depth + 1)) return 0;
+				}
+			}
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static jbyteArray swt_js_new_array(JNIEnv *env, SwtJSBuffer *buffer) {
+	jbyteArray result = (*env)->NewByteArray(env, (jsize)buffer->size);
+	if (result != NULL) {
+		(*env)->SetByteArrayRegion(env, result, 0, (jsize)buffer->size, (jbyte *)buffer->data);
+	}
+	return result;
+}
+
+static int swt_js_get(const char **data, const char *end, void *value, size_t size) {
+	if ((size_t)(end - *data) < size) return 0;
+	memcpy(value, *data, size);
+	*data += size;
+	return 1;
+}
+
+static jintLong swt_js_deserialize(SwtJSFunctions *fns, jintLong ctx, const char **data, const char *end, int depth) {
+	jbyte tag;
+	if (!swt_js_get(data, end, &tag, 1)) return 0;
+	switch (tag) {
+		case SWT_JS_NULL:
+			return fns->JSValueMakeUndefined(ctx);
+		case SWT_JS_BOOLEAN: {
+			jbyte value;
+			if (!swt_js_get(data, end, &value, 1)) return 0;
+			return fns->JSValueMakeBoolean(ctx, value != 0);
+		}
+		case SWT_JS_NUMBER: {
+			jdouble value;
+			if (!swt_js_get(data, end, &value, sizeof(value))) return 0;
+			return fns->JSValueMakeNumber(ctx, value);
+		}
+		case SWT_JS_STRING: {
+			jint length;
+			jchar *chars;
+			jintLong string, result = 0;
+			if (!swt_js_get(data, end, &length, sizeof(length))) return 0;
+			if (length < 0 || (size_t)(end - *data) / sizeof(jchar) < (size_t)length) return 0;
+			/* the characters are not aligned in the buffer */
+			if ((chars = malloc(length * sizeof(jchar) + 1)) == NULL) return 0;
+			swt_js_get(data, end, chars, length * sizeof(jchar));
+			string = fns->JSStringCreateWithCharacters(chars, length);
+			free(chars);
+			if (string != 0) {
+				result = fns->JSValueMakeString(ctx, string);
+				fns->JSStringRelease(string);
+			}
+			return result;
+		}
+		case SWT_JS_ARRAY: {
+			jint i, length;
+			jintLong *values, result = 0;
+			if (depth >= SWT_JS_MAX_DEPTH) return 0;
+			if (!swt_js_get(data, end, &length, sizeof(length))) return 0;
+			/* every value takes at least one byte */
+			if (length < 0 || end - *data < length) return 0;
+			if ((values = malloc(length * sizeof(jintLong) + 1)) == NULL) return 0;
+			for (i = 0; i < length; i++) {
+				if ((values[i] = swt_js_deserialize(fns, ctx, data, end, depth + 1)) == 0) break;
+			}
+			if (i == length) result = fns->JSObjectMakeArray(ctx, length, values, NULL);
+			free(values);
+			return result;
+		}
+	}
+	return 0;
+}
+#endif
+
+#ifndef NO__1swt_1JSValueDeserialize
+JNIEXPORT jintLong JNICALL WebKitGTK_NATIVE(_1swt_1JSValueDeserialize)
+	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2)
+{
+	jbyte *lparg1=NULL;
+	jintLong rc = 0;
+	SwtJSFunctions *fns;
+	WebKitGTK_NATIVE_ENTER(env, that, _1swt_1JSValueDeserialize_FUNC);
+	fns = swt_js_functions();
+	if (!fns->canDeserialize) goto fail;
+	if (arg2 < 0 || arg2 > (*env)->GetArrayLength(env, arg1)) goto fail;
+	if ((lparg1 = (*env)->GetByteArrayElements(env, arg1, NULL)) == NULL) goto fail;
+	{
+		const char *data = (const char *)lparg1;
+		rc = swt_js_deserialize(fns, arg0, &data, data + arg2, 0);
+		if (data != (const char *)lparg1 + arg2) rc = 0;
+	}
+fail:
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
+	WebKitGTK_NATIVE_EXIT(env, that, _1swt_1JSValueDeserialize_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1swt_1JSValueSerialize
+JNIEXPORT jbyteArray JNICALL WebKitGTK_NATIVE(_1swt_1JSValueSerialize)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1)
+{
+	jbyteArray rc = NULL;
+	SwtJSFunctions *fns;
+	SwtJSBuffer buffer = {NULL, 0, 0};
+	WebKitGTK_NATIVE_ENTER(env, that, _1swt_1JSValueSerialize_FUNC);
+	fns = swt_js_functions();
+	if (!fns->canSerialize) goto fail;
+	if (!swt_js_serialize(fns, arg0, arg1, &buffer, 0)) goto fail;
+	rc = swt_js_new_array(env, &buffer);
+fail:
+	if (buffer.data) free(buffer.data);
+	WebKitGTK_NATIVE_EXIT(env, that, _1swt_1JSValueSerialize_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1swt_1JSValueSerializeArguments
+JNIEXPORT jbyteArray JNICALL WebKitGTK_NATIVE(_1swt_1JSValueSerializeArguments)
+	(JNIEnv *env, jclass that, jintLong arg0, jintLong arg1, jintLong arg2)
+{
+	jbyteArray rc = NULL;
+	SwtJSFunctions *fns;
+	SwtJSBuffer buffer = {NULL, 0, 0};
+	jint i, length = (jint)arg1;
+	const jintLong *arguments = (const jintLong *)arg2;
+	WebKitGTK_NATIVE_ENTER(env, that, _1swt_1JSValueSerializeArguments_FUNC);
+	fns = swt_js_functions();
+	if (!fns->canSerialize || length < 0 || (length > 0 && arguments == NULL)) goto fail;
+	if (!swt_js_put(&buffer, SWT_JS_ARRAY, &length, sizeof(length))) goto fail;
+	for (i = 0; i < length; i++) {
+		if (!swt_js_serialize(fns, arg0, arguments[i], &buffer, 1)) goto fail;
+	}
+	rc = swt_js_new_array(env, &buffer);
+fail:
+	if (buffer.data) free(buffer.data);
+	WebKitGTK_NATIVE_EXIT(env, that, _1swt_1JSValueSerializeArguments_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1swt_1soup_1cookie_1jar_1add_1cookies
+SWT_WEBKIT_FUNCTION(soup_uri_new)
+SWT_WEBKIT_FUNCTION(soup_uri_free)
+SWT_WEBKIT_FUNCTION(soup_cookie_parse)
+SWT_WEBKIT_FUNCTION(soup_cookie_jar_add_cookie)
+
+JNIEXPORT jint JNICALL WebKitGTK_NATIVE(_1swt_1soup_1cookie_1jar_1add_1cookies)
+	(JNIEnv *env, jclass that, jintLong arg0, jbyteArray arg1, jint arg2)
+{
+	jbyte *lparg1=NULL;
+	jint rc = -1;
+	WebKitGTK_NATIVE_ENTER(env, that, _1swt_1soup_1cookie_1jar_1add_1cookies_FUNC);
+	if (arg2 < 0 || arg2 > (*env)->GetArrayLength(env, arg1)) goto fail;
+	if ((lparg1 = (*env)->GetByteArrayElements(env, arg1, NULL)) == NULL) goto fail;
+	{
+		gpointer (*uri_new)(const char *) = load_soup_uri_new();
+		void (*uri_free)(gpointer) = load_soup_uri_free();
+		SoupCookie *(*cookie_parse)(const char *, gpointer) = load_soup_cookie_parse();
+		void (*add_cookie)(gpointer, SoupCookie *) = load_soup_cookie_jar_add_cookie();
+		if (arg0 && uri_new && uri_free && cookie_parse && add_cookie) {
+			const char *data = (const char *)lparg1, *end = data + arg2;
+			rc = 0;
+			while (data < end) {
+				const char *url = data, *value, *terminator;
+				gpointer uri;
+				if ((terminator = memchr(url, 0, end - url)) == NULL) break;
+				value = terminator + 1;
+				if (value >= end || (terminator = memchr(value, 0, end - value)) == NULL) break;
+				data = terminator + 1;
+				if ((uri = uri_new(url)) != NULL) {
+					SoupCookie *cookie = cookie_parse(value, uri);
+					if (cookie != NULL) {
+						/* the jar takes the cookie */
+						add_cookie((gpointer)arg0, cookie);
+						rc++;
+					}
+					uri_free(uri);
+				}
+			}
+		}
+	}
+fail:
+	if (arg1 && lparg1) (*env)->ReleaseByteArrayElements(env, arg1, lparg1, JNI_ABORT);
+	WebKitGTK_NATIVE_EXIT(env, that, _1swt_1soup_1cookie_1jar_1add_1cookies_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1swt_1soup_1cookie_1jar_1delete_1session_1cookies
+SWT_WEBKIT_FUNCTION(soup_cookie_jar_all_cookies)
+SWT_WEBKIT_FUNCTION(soup_cookie_jar_delete_cookie)
+SWT_WEBKIT_FUNCTION(soup_cookie_free)
+SWT_WEBKIT_FUNCTION(g_slist_free)
+
+JNIEXPORT jint JNICALL WebKitGTK_NATIVE(_1swt_1soup_1cookie_1jar_1delete_1session_1cookies)
+	(JNIEnv *env, jclass that, jintLong arg0)
+{
+	jint rc = -1;
+	WebKitGTK_NATIVE_ENTER(env, that, _1swt_1soup_1cookie_1jar_1delete_1session_1cookies_FUNC);
+	{
+		GSList *(*all_cookies)(gpointer) = load_soup_cookie_jar_all_cookies();
+		void (*delete_cookie)(gpointer, SoupCookie *) = load_soup_cookie_jar_delete_cookie();
+		void (*cookie_free)(SoupCookie *) = load_soup_cookie_free();
+		void (*slist_free)(GSList *) = load_g_slist_free();
+		if (arg0 && all_cookies && delete_cookie && cookie_free && slist_free) {
+			GSList *cookies = all_cookies((gpointer)arg0), *current;
+			rc = 0;
+			for (current = cookies; current != NULL; current = current->next) {
+				SoupCookie *cookie = (SoupCookie *)current->data;
+				if (cookie->expires == NULL) {
+					/* indicates a session cookie */
+					delete_cookie((gpointer)arg0, cookie);
+					rc++;
+				}
+				cookie_free(cookie);
+			}
+			slist_free(cookies);
+		}
+	}
+	WebKitGTK_NATIVE_EXIT(env, that, _1swt_1soup_1cookie_1jar_1delete_1session_1cookies_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1swt_1soup_1message_1body_1get_1chunk
+typedef struct SwtSoupBuffer {
+	const char *data;
+	gsize length;
+} SwtSoupBuffer;
+
+SWT_WEBKIT_FUNCTION(soup_message_body_get_chunk)
+SWT_WEBKIT_FUNCTION(soup_buffer_free)
+
+JNIEXPORT jobject JNICALL WebKitGTK_NATIVE(_1swt_1soup_1message_1body_1get_1chunk)
+	(JNIEnv *env, jclass that, jintLong arg0, jlong arg1)
+{
+	jobject rc = NULL;
+	WebKitGTK_NATIVE_ENTER(env, that, _1swt_1soup_1message_1body_1get_1chunk_FUNC);
+	{
+		SwtSoupBuffer *(*get_chunk)(gpointer, gint64) = load_soup_message_body_get_chunk();
+		void (*buffer_free)(SwtSoupBuffer *) = load_soup_buffer_free();
+		if (arg0 && arg1 >= 0 && get_chunk && buffer_free) {
+			SwtSoupBuffer *chunk = get_chunk((gpointer)arg0, arg1);
+			if (chunk != NULL) {
+				/* the body keeps the memory of its chunks */
+				if (chunk->length > 0) {
+					rc = (*env)->NewDirectByteBuffer(env, (void *)chunk->data, (jlong)chunk->length);
+				}
+				buffer_free(chunk);
+			}
+		}
+	}
+	WebKitGTK_NATIVE_EXIT(env, that, _1swt_1soup_1message_1body_1get_1chunk_FUNC);
+	return rc;
+}
+#endif
+
+#ifndef NO__1swt_1webkit_1web_1view_1load_1text
+SWT_WEBKIT_FUNCTION(webkit_web_view_load_html)
+SWT_WEBKIT_FUNCTION(webkit_web_view_load_string)
+
+/* The characters of a string that are converted at a time */
+#define SWT_TEXT_CHUNK 4096
+
+static size_t swt_utf8_put(char *data, size_t size, jint c)
+{
+	char bytes[4];
+	size_t count;
+	if (c < 0x80) {
+		bytes[0] = (char)c;
+		count = 1;
+	} else if (c < 0x800) {
+		bytes[0] = (char)(0xC0 | (c >> 6));
+		bytes[1] = (char)(0x80 | (c & 0x3F));
+		count = 2;
+	} else if (c < 0x10000) {
+		bytes[0] = (char)(0xE0 | (c >> 12));
+		bytes[1] = (char)(0x80 | ((c >> 6) & 0x3F));
+		bytes[2] = (char)(0x80 | (c & 0x3F));
+		count = 3;
+	} else {
+		bytes[0] = (char)(0xF0 | (c >> 18));
+		bytes[1] = (char)(0x80 | ((c >> 12) & 0x3F));
+		bytes[2] = (char)(0x80 | ((c >> 6) & 0x3F));
+		bytes[3] = (char)(0x80 | (c & 0x3F));
+		count = 4;
+	}
+	if (data != NULL) memcpy(data + size, bytes, count);
+	return size + count;
+}
+
+/*
+* Converts the characters of str to UTF-8 into data, or only counts the
+* bytes when data is NULL.  The characters are read a chunk at a time, so
+* the string is never pinned or copied whole.  Unpaired surrogates become
+* '?', as they do in String.getBytes().
+*/
+static size_t swt_utf16_to_utf8(JNIEnv *env, jstring str, jsize length, char *data)
+{
+	jchar chars[SWT_TEXT_CHUNK];
+	size_t size = 0;
+	jint high = 0;
+	jsize start, i;
+	for (start = 0; start < length; start += SWT_TEXT_CHUNK) {
+		jsize count = length - start < SWT_TEXT_CHUNK ? length - start : SWT_TEXT_CHUNK;
+		(*env)->GetStringRegion(env, str, start, count, chars);
+		for (i = 0; i < count; i++) {
+			jint c = chars[i];
+			if (high != 0) {
+				if (c >= 0xDC00 && c <= 0xDFFF) {
+					size = swt_utf8_put(data, size, 0x10000 + ((high - 0xD800) << 10) + (c - 0xDC00));
+					high = 0;
+					continue;
+				}
+				size = swt_utf8_put(data, size, '?');
+				high = 0;
+			}
+			if (c >= 0xD800 && c <= 0xDBFF) {
+				high = c;
+			} else {
+				size = swt_utf8_put(data, size, c >= 0xDC00 && c <= 0xDFFF ? '?' : c);
+			}
+		}
+	}
+	if (high != 0) size = swt_utf8_put(data, size, '?');
+	return size;
+}
+
+/*
+* Loads the HTML in a Java string into a web view with whichever of
+* webkit_web_view_load_html() and webkit_web_view_load_string() the loaded
+* WebKit has.  The text is converted to UTF-8 a chunk at a time straight
+* into the one buffer handed to WebKit, instead of going through a Java
+* byte array that JNI copies again.
+*/
+JNIEXPORT jboolean JNICALL WebKitGTK_NATIVE(_1swt_1webkit_1web_1view_1load_1text)
+	(JNIEnv *env, jclass that, jintLong arg0, jstring arg1, jbyteArray arg2)
+{
+	jbyte *lparg2 = NULL;
+	jboolean rc = 0;
+	WebKitGTK_NATIVE_ENTER(env, that, _1swt_1webkit_1web_1view_1load_1text_FUNC);
+	if (arg2) if ((lparg2 = (*env)->GetByteArrayElements(env, arg2, NULL)) == NULL) goto fail;
+	{
+		void (*load_html)(jintLong, const char *, const jbyte *) = load_webkit_web_view_load_html();
+		void (*load_string)(jintLong, const char *, const char *, const char *, const jbyte *) = load_webkit_web_view_load_string();
+		if (arg0 && arg1 && (load_html || load_string)) {
+			jsize length = (*env)->GetStringLength(env, arg1);
+			size_t size = swt_utf16_to_utf8(env, arg1, length, NULL);
+			char *data = malloc(size + 1);
+			if (data == NULL) {
+				throwOutOfMemory(env);
+				goto fail;
+			}
+			swt_utf16_to_utf8(env, arg1, length, data);
+			data[size] = '\0';
+			if (load_html) {
+				load_html(arg0, data, lparg2);
+			} else {
+				load_string(arg0, data, "text/html", "UTF-8", lparg2);
+			}
+			free(data);
+			rc = 1;
+		}
+	}
+fail:
+	if (arg2 && lparg2) (*env)->ReleaseByteArrayElements(env, arg2, lparg2, JNI_ABORT);
+	WebKitGTK_NATIVE_EXIT(env, that, _1swt_1webkit_1web_1view_1load_1text_FUNC);
+	return rc;
+}
+#endif
@@ -30,6 +30,7 @@ char * WebKitGTK_nativeFunctionNames[] = {
 	"_1JSObjectMakeArray",
 	"_1JSObjectMakeFunctionWithCallback",
 	"_1JSObjectSetProperty",
+	"_1JSStringCreateWithCharacters",
 	"_1JSStringCreateWithUTF8CString",
 	"_1JSStringGetLength",
 	"_1JSStringGetMaximumUTF8CStringSize",
@@ -70,6 +71,14 @@ char * WebKitGTK_nativeFunctionNames[] = {
 	"_1soup_1uri_1free",
 	"_1soup_1uri_1new",
 	"_1soup_1uri_1to_1string",
+	"_1swt_1JSStringGetString",
+	"_1swt_1JSValueDeserialize",
+	"_1swt_1JSValueSerialize",
+	"_1swt_1JSValueSerializeArguments",
+	"_1swt_1soup_1cookie_1jar_1add_1cookies",
+	"_1swt_1soup_1cookie_1jar_1delete_1session_1cookies",
+	"_1swt_1soup_1message_1body_1get_1chunk",
+	"_1swt_1webkit_1web_1view_1load_1text",
 	"_1webkit_1authentication_1request_1authenticate",
 	"_1webkit_1authentication_1request_1cancel",
 	"_1webkit_1authentication_1request_1is_1retry",
@@ -164,6 +173,9 @@ char * WebKitGTK_nativeFunctionNames[] = {
 #define NATIVE_FUNCTION_COUNT sizeof(WebKitGTK_nativeFunctionNames) / sizeof(char*)
 int WebKitGTK_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int WebKitGTK_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong WebKitGTK_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT WebKitGTK_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS WebKitGTK_nativeStats = {WebKitGTK_nativeFunctionCallCount, WebKitGTK_nativeFunctionCallTime, WebKitGTK_nativeFunctionEvents, 0, "WebKitGTK", WebKitGTK_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -185,4 +197,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(WebKitGTK_1GetFunctionCallCount)
 	return WebKitGTK_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(WebKitGTK_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return WebKitGTK_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(WebKitGTK_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(WebKitGTK_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &WebKitGTK_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(WebKitGTK_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(WebKitGTK_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(WebKitGTK_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(WebKitGTK_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(WebKitGTK_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
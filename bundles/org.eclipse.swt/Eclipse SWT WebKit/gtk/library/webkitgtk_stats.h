@@ -17,8 +17,9 @@
 extern int WebKitGTK_nativeFunctionCount;
 extern int WebKitGTK_nativeFunctionCallCount[];
 extern char* WebKitGTK_nativeFunctionNames[];
-#define WebKitGTK_NATIVE_ENTER(env, that, func) WebKitGTK_nativeFunctionCallCount[func]++;
-#define WebKitGTK_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS WebKitGTK_nativeStats;
+#define WebKitGTK_NATIVE_ENTER(env, that, func) nativeStatsEnter(&WebKitGTK_nativeStats, func);
+#define WebKitGTK_NATIVE_EXIT(env, that, func) nativeStatsExit(&WebKitGTK_nativeStats, func);
 #else
 #ifndef WebKitGTK_NATIVE_ENTER
 #define WebKitGTK_NATIVE_ENTER(env, that, func) 
@@ -40,6 +41,7 @@ typedef enum {
 	_1JSObjectMakeArray_FUNC,
 	_1JSObjectMakeFunctionWithCallback_FUNC,
 	_1JSObjectSetProperty_FUNC,
+	_1JSStringCreateWithCharacters_FUNC,
 	_1JSStringCreateWithUTF8CString_FUNC,
 	_1JSStringGetLength_FUNC,
 	_1JSStringGetMaximumUTF8CStringSize_FUNC,
@@ -80,6 +82,14 @@ typedef enum {
 	_1soup_1uri_1free_FUNC,
 	_1soup_1uri_1new_FUNC,
 	_1soup_1uri_1to_1string_FUNC,
+	_1swt_1JSStringGetString_FUNC,
+	_1swt_1JSValueDeserialize_FUNC,
+	_1swt_1JSValueSerialize_FUNC,
+	_1swt_1JSValueSerializeArguments_FUNC,
+	_1swt_1soup_1cookie_1jar_1add_1cookies_FUNC,
+	_1swt_1soup_1cookie_1jar_1delete_1session_1cookies_FUNC,
+	_1swt_1soup_1message_1body_1get_1chunk_FUNC,
+	_1swt_1webkit_1web_1view_1load_1text_FUNC,
 	_1webkit_1authentication_1request_1authenticate_FUNC,
 	_1webkit_1authentication_1request_1cancel_FUNC,
 	_1webkit_1authentication_1request_1is_1retry_FUNC,
@@ -14,9 +14,12 @@ package org.eclipse.swt.browser;
 import java.io.UnsupportedEncodingException;
 import java.net.MalformedURLException;
 import java.net.URL;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.util.Enumeration;
 import java.util.Hashtable;
 import java.util.StringTokenizer;
+import java.util.Vector;
 
 import org.eclipse.swt.SWT;
 import org.eclipse.swt.SWTException;
@@ -53,7 +56,7 @@ class WebKit extends WebBrowser {
 	String postData;
 	String[] headers;
 	boolean ignoreDispose, loadingText, untrustedText;
-	byte[] htmlBytes;
+	String htmlText;
 	BrowserFunction eventFunction;
 
 	static int DisabledJSCount;
@@ -163,6 +166,7 @@ class WebKit extends WebBrowser {
 					long /*int*/ type = WebKitGTK.soup_cookie_jar_get_type ();
 					long /*int*/ jar = WebKitGTK.soup_session_get_feature (session, type);
 					if (jar == 0) return;
+					if (WebKitGTK.swt_soup_cookie_jar_delete_session_cookies (jar) != -1) return;
 					long /*int*/ cookies = WebKitGTK.soup_cookie_jar_all_cookies (jar);
 					int length = OS.g_slist_length (cookies);
 					long /*int*/ current = cookies;
@@ -241,7 +245,9 @@ class WebKit extends WebBrowser {
 			};
 
 			if (NativePendingCookies != null) {
-				SetPendingCookies (NativePendingCookies);
+				if (!AddPendingCookies (NativePendingCookies)) {
+					SetPendingCookies (NativePendingCookies);
+				}
 				NativePendingCookies = null;
 			}
 		}
@@ -299,6 +305,33 @@ static long /*int*/ JSObjectCallAsFunctionProc (long /*int*/ ctx, long /*int*/ f
 	return webkit.callJava (ctx, function, thisObject, argumentCount, arguments, exception);
 }
 
+static boolean AddPendingCookies (Vector pendingCookies) {
+	long /*int*/ session = WebKitGTK.webkit_get_default_session ();
+	long /*int*/ type = WebKitGTK.soup_cookie_jar_get_type ();
+	long /*int*/ jar = WebKitGTK.soup_session_get_feature (session, type);
+	if (jar == 0) {
+		/* this happens if a navigation has not occurred yet */
+		WebKitGTK.soup_session_add_feature_by_type (session, type);
+		jar = WebKitGTK.soup_session_get_feature (session, type);
+	}
+	if (jar == 0) return false;
+	int count = pendingCookies.size (), length = 0;
+	byte[][] strings = new byte[count * 2][];
+	for (int i = 0; i < count; i++) {
+		String[] current = (String[])pendingCookies.elementAt (i);
+		strings[i * 2] = Converter.wcsToMbcs (null, current[1], true);
+		strings[i * 2 + 1] = Converter.wcsToMbcs (null, current[0], true);
+		length += strings[i * 2].length + strings[i * 2 + 1].length;
+	}
+	byte[] data = new byte[length];
+	int offset = 0;
+	for (int i = 0; i < strings.length; i++) {
+		System.arraycopy (strings[i], 0, data, offset, strings[i].length);
+		offset += strings[i].length;
+	}
+	return WebKitGTK.swt_soup_cookie_jar_add_cookies (jar, data, length) != -1;
+}
+
 static long /*int*/ JSObjectGetPropertyProc (long /*int*/ ctx, long /*int*/ object, long /*int*/ propertyName, long /*int*/ exception) {
 	byte[] bytes = null;
 	try {
@@ -946,12 +979,18 @@ boolean close (boolean showPrompters) {
 @Override
 public boolean execute (String script) {
 	byte[] bytes = null;
-	try {
-		bytes = (script + '\0').getBytes (CHARSET_UTF8); //$NON-NLS-1$
-	} catch (UnsupportedEncodingException e) {
-		bytes = Converter.wcsToMbcs (null, script, true);
+	long /*int*/ scriptString;
+	if (WEBKIT2) {
+		try {
+			bytes = (script + '\0').getBytes (CHARSET_UTF8); //$NON-NLS-1$
+		} catch (UnsupportedEncodingException e) {
+			bytes = Converter.wcsToMbcs (null, script, true);
+		}
+		scriptString = WebKitGTK.JSStringCreateWithUTF8CString (bytes);
+	} else {
+		char[] chars = script.toCharArray ();
+		scriptString = WebKitGTK.JSStringCreateWithCharacters (chars, chars.length);
 	}
-	long /*int*/ scriptString = WebKitGTK.JSStringCreateWithUTF8CString (bytes);
 
 	try {
 		bytes = (getUrl () + '\0').getBytes (CHARSET_UTF8); //$NON-NLS-1$
@@ -1433,7 +1472,7 @@ long /*int*/ handleLoadCommitted (long /*int*/ uri, boolean top) {
 	* this is the first webkit_notify_load_status callback received for a setText()
 	* invocation then do not send any events or re-install registered BrowserFunctions. 
 	*/
-	if (top && url.startsWith(ABOUT_BLANK) && htmlBytes != null) return 0;
+	if (top && url.startsWith(ABOUT_BLANK) && htmlText != null) return 0;
 
 	LocationEvent event = new LocationEvent (browser);
 	event.display = browser.getDisplay ();
@@ -1486,22 +1525,21 @@ long /*int*/ handleLoadFinished (long /*int*/ uri, boolean top) {
 	}
 
 	/*
-	 * If htmlBytes is not null then there is html from a previous setText() call
+	 * If htmlText is not null then there is html from a previous setText() call
 	 * waiting to be set into the about:blank page once it has completed loading. 
 	 */
-	if (top && htmlBytes != null) {
+	if (top && htmlText != null) {
 		if (url.startsWith(ABOUT_BLANK)) {
 			loadingText = true;
-			byte[] mimeType = Converter.wcsToMbcs (null, "text/html", true);  //$NON-NLS-1$
-			byte[] encoding = Converter.wcsToMbcs (null, CHARSET_UTF8, true);  //$NON-NLS-1$
 			byte[] uriBytes;
 			if (untrustedText) {
 				uriBytes = Converter.wcsToMbcs (null, ABOUT_BLANK, true);
 			} else {
 				uriBytes = Converter.wcsToMbcs (null, URI_FILEROOT, true);
 			}
-			WebKitGTK.webkit_web_view_load_string (webView, htmlBytes, mimeType, encoding, uriBytes);
-			htmlBytes = null;
+			/* loads the text with webkit_web_view_load_string() */
+			WebKitGTK.swt_webkit_web_view_load_text (webView, htmlText, uriBytes);
+			htmlText = null;
 		}
 	}
 
@@ -1567,7 +1605,7 @@ void onDispose (Event e) {
 	C.free (webViewData);
 	postData = null;
 	headers = null;
-	htmlBytes = null;
+	htmlText = null;
 }
 
 void onResize (Event e) {
@@ -1672,20 +1710,12 @@ public void refresh () {
 
 @Override
 public boolean setText (String html, boolean trusted) {
-	/* convert the String containing HTML to an array of bytes with UTF-8 data */
-	byte[] bytes = null;
-	try {
-		bytes = (html + '\0').getBytes (CHARSET_UTF8); //$NON-NLS-1$
-	} catch (UnsupportedEncodingException e) {
-		bytes = Converter.wcsToMbcs (null, html, true);
-	}
-
 	/*
-	* If this.htmlBytes is not null then the about:blank page is already being loaded,
+	* If this.htmlText is not null then the about:blank page is already being loaded,
 	* so no navigate is required.  Just set the html that is to be shown.
 	*/
-	boolean blankLoading = htmlBytes != null;
-	htmlBytes = bytes;
+	boolean blankLoading = htmlText != null;
+	htmlText = html;
 	untrustedText = !trusted;
 
 	if (WEBKIT2) {
@@ -1695,7 +1725,11 @@ public boolean setText (String html, boolean trusted) {
 		} else {
 			uriBytes = Converter.wcsToMbcs (null, URI_FILEROOT, true);
 		}
-		WebKitGTK.webkit_web_view_load_html (webView, htmlBytes, uriBytes);
+		/*
+		* The text is converted to UTF-8 in native code a chunk at a time,
+		* straight into the buffer given to webkit_web_view_load_html().
+		*/
+		WebKitGTK.swt_webkit_web_view_load_text (webView, htmlText, uriBytes);
 	} else {
 		if (blankLoading) return true;
 
@@ -2335,6 +2369,20 @@ long /*int*/ webkit_window_object_cleared (long /*int*/ web_view, long /*int*/ f
 long /*int*/ callJava (long /*int*/ ctx, long /*int*/ func, long /*int*/ thisObject, long /*int*/ argumentCount, long /*int*/ arguments, long /*int*/ exception) {
 	Object returnValue = null;
 	if (argumentCount == 3) {
+		byte[] serialized = WebKitGTK.swt_JSValueSerializeArguments (ctx, argumentCount, arguments);
+		if (serialized != null) {
+			ByteBuffer buffer = ByteBuffer.wrap (serialized);
+			buffer.order (ByteOrder.nativeOrder ());
+			Object[] values = (Object[])readSerialized (buffer);
+			if (values[0] instanceof Double && values[1] instanceof String) {
+				Object key = new Integer (((Double)values[0]).intValue ());
+				BrowserFunction function = (BrowserFunction)functions.get (key);
+				if (function != null && values[1].equals (function.token) && values[2] instanceof Object[]) {
+					returnValue = callFunction (function, (Object[])values[2]);
+				}
+			}
+			return convertToJS (ctx, returnValue);
+		}
 		long /*int*/[] result = new long /*int*/[1];
 		C.memmove (result, arguments, C.PTR_SIZEOF);
 		int type = WebKitGTK.JSValueGetType (ctx, result[0]);
@@ -2352,13 +2400,7 @@ long /*int*/ callJava (long /*int*/ ctx, long /*int*/ func, long /*int*/ thisObj
 						C.memmove (result, arguments + 2 * C.PTR_SIZEOF, C.PTR_SIZEOF);
 						Object temp = convertToJava (ctx, result[0]);
 						if (temp instanceof Object[]) {
-							Object[] args = (Object[])temp;
-							try {
-								returnValue = function.function (args);
-							} catch (Exception e) {
-								/* exception during function invocation */
-								returnValue = WebBrowser.CreateErrorString (e.getLocalizedMessage ());
-							}
+							returnValue = callFunction (function, (Object[])temp);
 						}
 					} catch (IllegalArgumentException e) {
 						/* invalid argument value type */
@@ -2375,18 +2417,22 @@ long /*int*/ callJava (long /*int*/ ctx, long /*int*/ func, long /*int*/ thisObj
 	return convertToJS (ctx, returnValue);
 }
 
+Object callFunction (BrowserFunction function, Object[] args) {
+	try {
+		return function.function (args);
+	} catch (Exception e) {
+		/* exception during function invocation */
+		return WebBrowser.CreateErrorString (e.getLocalizedMessage ());
+	}
+}
+
 long /*int*/ convertToJS (long /*int*/ ctx, Object value) {
 	if (value == null) {
 		return WebKitGTK.JSValueMakeUndefined (ctx);
 	}
 	if (value instanceof String) {
-		byte[] bytes = null;
-		try {
-			bytes = ((String)value + '\0').getBytes (CHARSET_UTF8); //$NON-NLS-1$
-		} catch (UnsupportedEncodingException e) {
-			bytes = Converter.wcsToMbcs (null, (String)value, true);
-		}
-		long /*int*/ stringRef = WebKitGTK.JSStringCreateWithUTF8CString (bytes);
+		char[] chars = ((String)value).toCharArray ();
+		long /*int*/ stringRef = WebKitGTK.JSStringCreateWithCharacters (chars, chars.length);
 		long /*int*/ result = WebKitGTK.JSValueMakeString (ctx, stringRef);
 		WebKitGTK.JSStringRelease (stringRef);
 		return result;
@@ -2398,6 +2444,14 @@ long /*int*/ convertToJS (long /*int*/ ctx, Object value) {
 		return WebKitGTK.JSValueMakeNumber (ctx, ((Number)value).doubleValue ());
 	}
 	if (value instanceof Object[]) {
+		int size = serializedSize (value);
+		if (size != -1) {
+			ByteBuffer buffer = ByteBuffer.allocate (size);
+			buffer.order (ByteOrder.nativeOrder ());
+			writeSerialized (buffer, value);
+			long /*int*/ result = WebKitGTK.swt_JSValueDeserialize (ctx, buffer.array (), size);
+			if (result != 0) return result;
+		}
 		Object[] arrayValue = (Object[]) value;
 		int length = arrayValue.length;
 		long /*int*/[] arguments = new long /*int*/[length];
@@ -2413,6 +2467,12 @@ long /*int*/ convertToJS (long /*int*/ ctx, Object value) {
 }
 
 Object convertToJava (long /*int*/ ctx, long /*int*/ value) {
+	byte[] serialized = WebKitGTK.swt_JSValueSerialize (ctx, value);
+	if (serialized != null) {
+		ByteBuffer buffer = ByteBuffer.wrap (serialized);
+		buffer.order (ByteOrder.nativeOrder ());
+		return readSerialized (buffer);
+	}
 	int type = WebKitGTK.JSValueGetType (ctx, value);
 	switch (type) {
 		case WebKitGTK.kJSTypeBoolean: {
@@ -2426,16 +2486,9 @@ Object convertToJava (long /*int*/ ctx, long /*int*/ value) {
 		case WebKitGTK.kJSTypeString: {
 			long /*int*/ string = WebKitGTK.JSValueToStringCopy (ctx, value, null);
 			if (string == 0) return ""; //$NON-NLS-1$
-			long /*int*/ length = WebKitGTK.JSStringGetMaximumUTF8CStringSize (string);
-			byte[] bytes = new byte[(int)/*64*/length];
-			length = WebKitGTK.JSStringGetUTF8CString (string, bytes, length);
+			String result = WebKitGTK.swt_JSStringGetString (string);
 			WebKitGTK.JSStringRelease (string);
-			try {
-				/* length-1 is needed below to exclude the terminator character */
-				return new String (bytes, 0, (int)/*64*/length - 1, CHARSET_UTF8);
-			} catch (UnsupportedEncodingException e) {
-				return new String (Converter.mbcsToWcs (null, bytes));
-			}
+			return result != null ? result : ""; //$NON-NLS-1$
 		}
 		case WebKitGTK.kJSTypeNull:
 			// FALL THROUGH
@@ -2468,4 +2521,71 @@ Object convertToJava (long /*int*/ ctx, long /*int*/ value) {
 	return null;
 }
 
+
+/* Returns -1 when the value cannot be converted to JavaScript */
+int serializedSize (Object value) {
+	if (value == null) return 1;
+	if (value instanceof String) return 5 + ((String)value).length () * 2;
+	if (value instanceof Boolean) return 2;
+	if (value instanceof Number) return 9;
+	if (value instanceof Object[]) {
+		Object[] arrayValue = (Object[])value;
+		int size = 5;
+		for (int i = 0; i < arrayValue.length; i++) {
+			int elementSize = serializedSize (arrayValue[i]);
+			if (elementSize == -1) return -1;
+			size += elementSize;
+		}
+		return size;
+	}
+	return -1;
+}
+
+void writeSerialized (ByteBuffer buffer, Object value) {
+	if (value == null) {
+		buffer.put ((byte)WebKitGTK.SERIALIZE_NULL);
+	} else if (value instanceof String) {
+		String string = (String)value;
+		buffer.put ((byte)WebKitGTK.SERIALIZE_STRING);
+		buffer.putInt (string.length ());
+		for (int i = 0; i < string.length (); i++) {
+			buffer.putChar (string.charAt (i));
+		}
+	} else if (value instanceof Boolean) {
+		buffer.put ((byte)WebKitGTK.SERIALIZE_BOOLEAN);
+		buffer.put ((byte)(((Boolean)value).booleanValue () ? 1 : 0));
+	} else if (value instanceof Number) {
+		buffer.put ((byte)WebKitGTK.SERIALIZE_NUMBER);
+		buffer.putDouble (((Number)value).doubleValue ());
+	} else {
+		Object[] arrayValue = (Object[])value;
+		buffer.put ((byte)WebKitGTK.SERIALIZE_ARRAY);
+		buffer.putInt (arrayValue.length);
+		for (int i = 0; i < arrayValue.length; i++) {
+			writeSerialized (buffer, arrayValue[i]);
+		}
+	}
+}
+
+Object readSerialized (ByteBuffer buffer) {
+	switch (buffer.get ()) {
+		case WebKitGTK.SERIALIZE_BOOLEAN: return new Boolean (buffer.get () != 0);
+		case WebKitGTK.SERIALIZE_NUMBER: return new Double (buffer.getDouble ());
+		case WebKitGTK.SERIALIZE_STRING: {
+			char[] chars = new char[buffer.getInt ()];
+			buffer.asCharBuffer ().get (chars);
+			buffer.position (buffer.position () + chars.length * 2);
+			return new String (chars);
+		}
+		case WebKitGTK.SERIALIZE_ARRAY: {
+			Object[] result = new Object[buffer.getInt ()];
+			for (int i = 0; i < result.length; i++) {
+				result[i] = readSerialized (buffer);
+			}
+			return result;
+		}
+	}
+	return null;
+}
+
 }
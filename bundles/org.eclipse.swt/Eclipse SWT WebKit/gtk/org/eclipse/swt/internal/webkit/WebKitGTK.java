@@ -15,6 +15,8 @@
 package org.eclipse.swt.internal.webkit;
 
 
+import java.nio.ByteBuffer;
+
 import org.eclipse.swt.internal.C;
 
 public class WebKitGTK extends C {
@@ -26,6 +28,11 @@ public class WebKitGTK extends C {
 	public static final int kJSTypeNumber = 3;
 	public static final int kJSTypeString = 4;
 	public static final int kJSTypeObject = 5;
+	public static final int SERIALIZE_NULL = 0;
+	public static final int SERIALIZE_BOOLEAN = 1;
+	public static final int SERIALIZE_NUMBER = 2;
+	public static final int SERIALIZE_STRING = 3;
+	public static final int SERIALIZE_ARRAY = 4;
 	public static final int SOUP_MEMORY_TAKE = 1;
 	public static final int WEBKIT_DOWNLOAD_STATUS_ERROR = -1;
 	public static final int WEBKIT_DOWNLOAD_STATUS_CANCELLED = 2;
@@ -224,6 +231,20 @@ public static final void JSObjectSetProperty (long /*int*/ ctx, long /*int*/ obj
 	}
 }
 
+/**
+ * @method flags=dynamic
+ * @param chars flags=no_out
+ */
+public static final native long /*int*/ _JSStringCreateWithCharacters (char[] chars, long /*int*/ numChars);
+public static final long /*int*/ JSStringCreateWithCharacters (char[] chars, long /*int*/ numChars) {
+	lock.lock();
+	try {
+		return _JSStringCreateWithCharacters (chars, numChars);
+	} finally {
+		lock.unlock();
+	}
+}
+
 /** @method flags=dynamic */
 public static final native long /*int*/ _JSStringCreateWithUTF8CString (byte[] string);
 public static final long /*int*/ JSStringCreateWithUTF8CString (byte[] string) {
@@ -622,6 +643,145 @@ public static final long /*int*/ soup_uri_to_string (long /*int*/ uri, int just_
 	}
 }
 
+/**
+ * Returns the UTF-16 characters of a JSStringRef as a Java string.
+ *
+ * @method flags=no_gen
+ */
+public static final native String _swt_JSStringGetString (long /*int*/ string);
+public static final String swt_JSStringGetString (long /*int*/ string) {
+	lock.lock();
+	try {
+		return _swt_JSStringGetString (string);
+	} finally {
+		lock.unlock();
+	}
+}
+
+/**
+ * Creates a JavaScript value from a buffer in the format written by
+ * <code>swt_JSValueSerialize</code>, with undefined for SERIALIZE_NULL,
+ * or returns 0 when the buffer is not valid.
+ *
+ * @method flags=no_gen
+ */
+public static final native long /*int*/ _swt_JSValueDeserialize (long /*int*/ ctx, byte[] data, int length);
+public static final long /*int*/ swt_JSValueDeserialize (long /*int*/ ctx, byte[] data, int length) {
+	lock.lock();
+	try {
+		return _swt_JSValueDeserialize (ctx, data, length);
+	} finally {
+		lock.unlock();
+	}
+}
+
+/**
+ * Serializes a JavaScript value into one buffer in native byte order, or
+ * returns <code>null</code> when the value is not a boolean, number,
+ * string, null, undefined or an array of these.  Each value is a tag byte
+ * followed by a byte for SERIALIZE_BOOLEAN, a double for SERIALIZE_NUMBER,
+ * an int length and that many UTF-16 characters for SERIALIZE_STRING, or an
+ * int count and that many values for SERIALIZE_ARRAY.
+ *
+ * @method flags=no_gen
+ */
+public static final native byte[] _swt_JSValueSerialize (long /*int*/ ctx, long /*int*/ value);
+public static final byte[] swt_JSValueSerialize (long /*int*/ ctx, long /*int*/ value) {
+	lock.lock();
+	try {
+		return _swt_JSValueSerialize (ctx, value);
+	} finally {
+		lock.unlock();
+	}
+}
+
+/**
+ * Serializes the arguments of a JavaScript function call as one array,
+ * the same way as <code>swt_JSValueSerialize</code>.
+ *
+ * @method flags=no_gen
+ */
+public static final native byte[] _swt_JSValueSerializeArguments (long /*int*/ ctx, long /*int*/ argumentCount, long /*int*/ arguments);
+public static final byte[] swt_JSValueSerializeArguments (long /*int*/ ctx, long /*int*/ argumentCount, long /*int*/ arguments) {
+	lock.lock();
+	try {
+		return _swt_JSValueSerializeArguments (ctx, argumentCount, arguments);
+	} finally {
+		lock.unlock();
+	}
+}
+
+/**
+ * Parses each pair of NUL terminated URL and cookie strings in the data
+ * and adds the cookie to the jar, returning the number of cookies added
+ * or -1 when libsoup is not available.
+ *
+ * @method flags=no_gen
+ */
+public static final native int _swt_soup_cookie_jar_add_cookies (long /*int*/ jar, byte[] data, int length);
+public static final int swt_soup_cookie_jar_add_cookies (long /*int*/ jar, byte[] data, int length) {
+	lock.lock();
+	try {
+		return _swt_soup_cookie_jar_add_cookies (jar, data, length);
+	} finally {
+		lock.unlock();
+	}
+}
+
+/**
+ * Deletes the cookies of the jar that have no expiry date, returning the
+ * number of cookies deleted or -1 when libsoup is not available.
+ *
+ * @method flags=no_gen
+ */
+public static final native int _swt_soup_cookie_jar_delete_session_cookies (long /*int*/ jar);
+public static final int swt_soup_cookie_jar_delete_session_cookies (long /*int*/ jar) {
+	lock.lock();
+	try {
+		return _swt_soup_cookie_jar_delete_session_cookies (jar);
+	} finally {
+		lock.unlock();
+	}
+}
+
+/**
+ * Returns the chunk of the message body that starts at the offset as a
+ * direct buffer over the memory of the body, or <code>null</code> past
+ * the end of the body.  Reading the chunks by increasing the offset by
+ * the capacity of each buffer visits the body without copying it.  The
+ * buffers are only valid while the body is not changed or freed.
+ *
+ * @method flags=no_gen
+ */
+public static final native ByteBuffer _swt_soup_message_body_get_chunk (long /*int*/ body, long offset);
+public static final ByteBuffer swt_soup_message_body_get_chunk (long /*int*/ body, long offset) {
+	lock.lock();
+	try {
+		return _swt_soup_message_body_get_chunk (body, offset);
+	} finally {
+		lock.unlock();
+	}
+}
+
+/**
+ * Loads the HTML into the web view with <code>webkit_web_view_load_html</code>
+ * or <code>webkit_web_view_load_string</code>, whichever the loaded WebKit
+ * has.  The string is converted to UTF-8 a chunk at a time straight into the
+ * buffer given to WebKit.  Returns false if neither function is available.
+ *
+ * @method flags=no_gen
+ * @param base_uri cast=(const gchar *)
+ */
+public static final native boolean _swt_webkit_web_view_load_text (long /*int*/ web_view, String content, byte[] base_uri);
+public static final boolean swt_webkit_web_view_load_text (long /*int*/ web_view, String content, byte[] base_uri) {
+	lock.lock();
+	try {
+		return _swt_webkit_web_view_load_text (web_view, content, base_uri);
+	} finally {
+		lock.unlock();
+	}
+}
+
 /* --------------------- start WebKitGTK natives --------------------- */
 
 /** @method flags=dynamic */
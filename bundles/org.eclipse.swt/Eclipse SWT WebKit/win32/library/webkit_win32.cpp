@@ -58,7 +58,7 @@ JNIEXPORT jintLong JNICALL WebKit_win32_NATIVE(CFDataCreate)
 	if (arg1) if ((lparg1 = env->GetByteArrayElements(arg1, NULL)) == NULL) goto fail;
 	rc = (jintLong)CFDataCreate((CFAllocatorRef)arg0, (const UInt8 *)lparg1, (CFIndex)arg2);
 fail:
-	if (arg1 && lparg1) env->ReleaseByteArrayElements(arg1, lparg1, 0);
+	if (arg1 && lparg1) env->ReleaseByteArrayElements(arg1, lparg1, JNI_ABORT);
 	WebKit_win32_NATIVE_EXIT(env, that, CFDataCreate_FUNC);
 	return rc;
 }
@@ -232,7 +232,7 @@ JNIEXPORT jint JNICALL WebKit_win32_NATIVE(CFStringCreateWithCharacters)
 	if (arg1) if ((lparg1 = env->GetCharArrayElements(arg1, NULL)) == NULL) goto fail;
 	rc = (jint)CFStringCreateWithCharacters((CFAllocatorRef)arg0, (const UniChar *)lparg1, (CFIndex)arg2);
 fail:
-	if (arg1 && lparg1) env->ReleaseCharArrayElements(arg1, lparg1, 0);
+	if (arg1 && lparg1) env->ReleaseCharArrayElements(arg1, lparg1, JNI_ABORT);
 	WebKit_win32_NATIVE_EXIT(env, that, CFStringCreateWithCharacters_FUNC);
 	return rc;
 }
@@ -539,7 +539,7 @@ JNIEXPORT jintLong JNICALL WebKit_win32_NATIVE(JSStringCreateWithUTF8CString)
 	if (arg0) if ((lparg0 = env->GetByteArrayElements(arg0, NULL)) == NULL) goto fail;
 	rc = (jintLong)JSStringCreateWithUTF8CString((const char*)lparg0);
 fail:
-	if (arg0 && lparg0) env->ReleaseByteArrayElements(arg0, lparg0, 0);
+	if (arg0 && lparg0) env->ReleaseByteArrayElements(arg0, lparg0, JNI_ABORT);
 	WebKit_win32_NATIVE_EXIT(env, that, JSStringCreateWithUTF8CString_FUNC);
 	return rc;
 }
@@ -599,7 +599,7 @@ JNIEXPORT jint JNICALL WebKit_win32_NATIVE(JSStringIsEqualToUTF8CString)
 	if (arg1) if ((lparg1 = env->GetByteArrayElements(arg1, NULL)) == NULL) goto fail;
 	rc = (jint)JSStringIsEqualToUTF8CString((JSStringRef)arg0, (const char *)lparg1);
 fail:
-	if (arg1 && lparg1) env->ReleaseByteArrayElements(arg1, lparg1, 0);
+	if (arg1 && lparg1) env->ReleaseByteArrayElements(arg1, lparg1, JNI_ABORT);
 	WebKit_win32_NATIVE_EXIT(env, that, JSStringIsEqualToUTF8CString_FUNC);
 	return rc;
 }
@@ -83,6 +83,9 @@ char * WebKit_win32_nativeFunctionNames[] = {
 #define NATIVE_FUNCTION_COUNT sizeof(WebKit_win32_nativeFunctionNames) / sizeof(char*)
 int WebKit_win32_nativeFunctionCount = NATIVE_FUNCTION_COUNT;
 int WebKit_win32_nativeFunctionCallCount[NATIVE_FUNCTION_COUNT];
+jlong WebKit_win32_nativeFunctionCallTime[NATIVE_FUNCTION_COUNT];
+NATIVE_STATS_EVENT WebKit_win32_nativeFunctionEvents[NATIVE_STATS_EVENT_COUNT];
+NATIVE_STATS_CLASS WebKit_win32_nativeStats = {WebKit_win32_nativeFunctionCallCount, WebKit_win32_nativeFunctionCallTime, WebKit_win32_nativeFunctionEvents, 0, "WebKit_win32", WebKit_win32_nativeFunctionNames};
 
 #define STATS_NATIVE(func) Java_org_eclipse_swt_tools_internal_NativeStats_##func
 
@@ -104,4 +107,54 @@ JNIEXPORT jint JNICALL STATS_NATIVE(WebKit_1win32_1GetFunctionCallCount)
 	return WebKit_win32_nativeFunctionCallCount[index];
 }
 
+JNIEXPORT jlong JNICALL STATS_NATIVE(WebKit_1win32_1GetFunctionCallTime)
+	(JNIEnv *env, jclass that, jint index)
+{
+	return WebKit_win32_nativeFunctionCallTime[index];
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(WebKit_1win32_1SetTracing)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsTracing = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(WebKit_1win32_1GetEvents)
+	(JNIEnv *env, jclass that, jlongArray buffer)
+{
+	return nativeStatsGetEvents(env, &WebKit_win32_nativeStats, buffer);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(WebKit_1win32_1GetLoads)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetLoads(env, names, values);
+}
+
+JNIEXPORT void JNICALL STATS_NATIVE(WebKit_1win32_1SetResourceStacks)
+	(JNIEnv *env, jclass that, jboolean enabled)
+{
+	nativeStatsResourceStacks = enabled;
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(WebKit_1win32_1GetResources)
+	(JNIEnv *env, jclass that, jobjectArray names, jlongArray values)
+{
+	return nativeStatsGetResources(env, names, values);
+}
+
+JNIEXPORT jint JNICALL STATS_NATIVE(WebKit_1win32_1GetLiveResources)
+	(JNIEnv *env, jclass that, jobjectArray objects, jlongArray values)
+{
+	return nativeStatsGetLiveResources(env, objects, values);
+}
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+JNIEXPORT jlong JNICALL WATCHDOG_NATIVE(WebKit_1win32_1Watch)
+	(JNIEnv *env, jclass that)
+{
+	return nativeStatsWatch();
+}
+
 #endif
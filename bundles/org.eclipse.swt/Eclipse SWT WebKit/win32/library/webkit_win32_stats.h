@@ -17,8 +17,9 @@
 extern int WebKit_win32_nativeFunctionCount;
 extern int WebKit_win32_nativeFunctionCallCount[];
 extern char* WebKit_win32_nativeFunctionNames[];
-#define WebKit_win32_NATIVE_ENTER(env, that, func) WebKit_win32_nativeFunctionCallCount[func]++;
-#define WebKit_win32_NATIVE_EXIT(env, that, func) 
+extern NATIVE_STATS_CLASS WebKit_win32_nativeStats;
+#define WebKit_win32_NATIVE_ENTER(env, that, func) nativeStatsEnter(&WebKit_win32_nativeStats, func);
+#define WebKit_win32_NATIVE_EXIT(env, that, func) nativeStatsExit(&WebKit_win32_nativeStats, func);
 #else
 #ifndef WebKit_win32_NATIVE_ENTER
 #define WebKit_win32_NATIVE_ENTER(env, that, func) 
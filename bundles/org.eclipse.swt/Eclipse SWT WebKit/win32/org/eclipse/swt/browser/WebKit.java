@@ -280,8 +280,7 @@ static {
 }
 
 static long /*int*/ createBSTR (String string) {
-	char[] data = (string + '\0').toCharArray ();
-	return COM.SysAllocString (data);
+	return COM.BSTRFromString (String.valueOf (string));
 }
 
 static String error (int code) {
@@ -289,11 +288,8 @@ static String error (int code) {
 }
 
 static String extractBSTR (long /*int*/ bstrString) {
-	int size = COM.SysStringByteLen (bstrString);
-	if (size == 0) return EMPTY_STRING;
-	char[] buffer = new char[(size + 1) / 2]; // add one to avoid rounding errors
-	COM.MoveMemory (buffer, bstrString, size);
-	return new String (buffer);
+	if (bstrString == 0) return EMPTY_STRING;
+	return COM.BSTRToString (bstrString);
 }
 
 static Browser findBrowser (long /*int*/ webView) {
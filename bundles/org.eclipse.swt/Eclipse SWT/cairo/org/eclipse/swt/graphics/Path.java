@@ -10,6 +10,8 @@
  *******************************************************************************/
 package org.eclipse.swt.graphics;
 
+import java.nio.*;
+
 import org.eclipse.swt.*;
 import org.eclipse.swt.internal.*;
 import org.eclipse.swt.internal.cairo.*;
@@ -364,6 +366,72 @@ public boolean contains(float x, float y, GC gc, boolean outline) {
 	return result;
 }
 
+/**
+ * Tests the points, given as x, y pairs, for containment in the receiver
+ * the way <code>contains(float, float, GC, boolean)</code> does, and
+ * returns a mask with bit <code>i % 32</code> of element <code>i / 32</code>
+ * set for each point <code>i</code> that is contained.  When prefilter is
+ * <code>true</code>, points outside of the bounds of the receiver are
+ * rejected without testing the path.
+ * <p>
+ * <b>IMPORTANT:</b> This method is <em>not</em> part of the public
+ * API for <code>Path</code>. It is marked public only so that it
+ * can be shared within the packages provided by SWT. It is not
+ * available on all platforms, and should never be called from
+ * application code.
+ * </p>
+ *
+ * @noreference This method is not intended to be referenced by clients.
+ */
+public int[] internal_contains(float[] points, GC gc, boolean outline, boolean prefilter) {
+	if (isDisposed()) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
+	if (points == null || gc == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
+	if (gc.isDisposed()) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	gc.initCairo();
+	gc.checkGC(GC.LINE_CAP | GC.LINE_JOIN | GC.LINE_STYLE | GC.LINE_WIDTH);
+	int count = points.length / 2;
+	double[] doublePoints = new double[count * 2];
+	for (int i = 0; i < doublePoints.length; i++) {
+		doublePoints[i] = points[i];
+	}
+	int[] mask = new int[(count + 31) / 32];
+	Cairo.swt_cairo_path_contains_points(gc.data.cairo, handle, doublePoints, outline, prefilter, mask);
+	return mask;
+}
+
+/**
+ * Tests the point for containment in each of the paths the way
+ * <code>contains(float, float, GC, boolean)</code> does, and returns a
+ * mask with bit <code>i % 32</code> of element <code>i / 32</code> set for
+ * each path <code>i</code> that contains it.  When prefilter is
+ * <code>true</code>, paths whose bounds do not contain the point are
+ * rejected without testing them.
+ * <p>
+ * <b>IMPORTANT:</b> This method is <em>not</em> part of the public
+ * API for <code>Path</code>. It is marked public only so that it
+ * can be shared within the packages provided by SWT. It is not
+ * available on all platforms, and should never be called from
+ * application code.
+ * </p>
+ *
+ * @noreference This method is not intended to be referenced by clients.
+ */
+public static int[] internal_contains(Path[] paths, float x, float y, GC gc, boolean outline, boolean prefilter) {
+	if (paths == null || gc == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
+	if (gc.isDisposed()) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	long /*int*/[] handles = new long /*int*/[paths.length];
+	for (int i = 0; i < paths.length; i++) {
+		if (paths[i] == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
+		if (paths[i].isDisposed()) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+		handles[i] = paths[i].handle;
+	}
+	gc.initCairo();
+	gc.checkGC(GC.LINE_CAP | GC.LINE_JOIN | GC.LINE_STYLE | GC.LINE_WIDTH);
+	int[] mask = new int[(paths.length + 31) / 32];
+	Cairo.swt_cairo_paths_contain(gc.data.cairo, handles, x, y, outline, prefilter, mask);
+	return mask;
+}
+
 /**
  * Adds to the receiver a cubic bezier curve based on the parameters.
  *
@@ -411,51 +479,32 @@ public void getBounds(float[] bounds) {
 	if (bounds.length < 4) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
 	long /*int*/ copy = Cairo.cairo_copy_path(handle);
 	if (copy == 0) SWT.error(SWT.ERROR_NO_HANDLES);
-	cairo_path_t path = new cairo_path_t();
-	Cairo.memmove(path, copy, cairo_path_t.sizeof);
+	ByteBuffer buffer = Cairo.cairo_path_buffer(copy);
 	double minX = 0, minY = 0, maxX = 0, maxY = 0;
-	if (path.num_data > 0) {
+	if (buffer != null) {
+		buffer.order(ByteOrder.nativeOrder());
+		int num_data = buffer.capacity() / cairo_path_data_t.sizeof;
 		minX = minY = Double.POSITIVE_INFINITY;
 		maxX = maxY = Double.NEGATIVE_INFINITY;
 		int i = 0;
-		double[] points = new double[6]; 
-		cairo_path_data_t data = new cairo_path_data_t();
-		while (i < path.num_data) {
-			long /*int*/ offset = path.data + i * cairo_path_data_t.sizeof;
-			Cairo.memmove(data, offset, cairo_path_data_t.sizeof);
-			switch (data.type) {
+		while (i < num_data) {
+			int offset = i * cairo_path_data_t.sizeof;
+			int count = 0;
+			switch (buffer.getInt(offset)) {
 				case Cairo.CAIRO_PATH_MOVE_TO:
-					Cairo.memmove(points, offset + cairo_path_data_t.sizeof, cairo_path_data_t.sizeof);
-					minX = Math.min(minX, points[0]);
-					minY = Math.min(minY, points[1]);
-					maxX = Math.max(maxX, points[0]);
-					maxY = Math.max(maxY, points[1]);
-					break;
-				case Cairo.CAIRO_PATH_LINE_TO:
-					Cairo.memmove(points, offset + cairo_path_data_t.sizeof, cairo_path_data_t.sizeof);
-					minX = Math.min(minX, points[0]);
-					minY = Math.min(minY, points[1]);
-					maxX = Math.max(maxX, points[0]);
-					maxY = Math.max(maxY, points[1]);
-					break;
-				case Cairo.CAIRO_PATH_CURVE_TO:
-					Cairo.memmove(points, offset + cairo_path_data_t.sizeof, cairo_path_data_t.sizeof * 3);
-					minX = Math.min(minX, points[0]);
-					minY = Math.min(minY, points[1]);
-					maxX = Math.max(maxX, points[0]);
-					maxY = Math.max(maxY, points[1]);
-					minX = Math.min(minX, points[2]);
-					minY = Math.min(minY, points[3]);
-					maxX = Math.max(maxX, points[2]);
-					maxY = Math.max(maxY, points[3]);
-					minX = Math.min(minX, points[4]);
-					minY = Math.min(minY, points[5]);
-					maxX = Math.max(maxX, points[4]);
-					maxY = Math.max(maxY, points[5]);
-					break;
+				case Cairo.CAIRO_PATH_LINE_TO: count = 1; break;
+				case Cairo.CAIRO_PATH_CURVE_TO: count = 3; break;
 				case Cairo.CAIRO_PATH_CLOSE_PATH: break;
 			}
-			i += data.length;
+			for (int j = 1; j <= count; j++) {
+				double x = buffer.getDouble(offset + j * cairo_path_data_t.sizeof);
+				double y = buffer.getDouble(offset + j * cairo_path_data_t.sizeof + 8);
+				minX = Math.min(minX, x);
+				minY = Math.min(minY, y);
+				maxX = Math.max(maxX, x);
+				maxY = Math.max(maxY, y);
+			}
+			i += buffer.getInt(offset + 4);
 		}
 	}
 	bounds[0] = (float)minX;
@@ -504,47 +553,41 @@ public PathData getPathData() {
 	if (isDisposed()) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
 	long /*int*/ copy = Cairo.cairo_copy_path(handle);
 	if (copy == 0) SWT.error(SWT.ERROR_NO_HANDLES);
-	cairo_path_t path = new cairo_path_t();
-	Cairo.memmove(path, copy, cairo_path_t.sizeof);
-	byte[] types = new byte[path.num_data];
-	float[] pts = new float[path.num_data * 6];
+	ByteBuffer buffer = Cairo.cairo_path_buffer(copy);
+	int num_data = 0;
+	if (buffer != null) {
+		buffer.order(ByteOrder.nativeOrder());
+		num_data = buffer.capacity() / cairo_path_data_t.sizeof;
+	}
+	byte[] types = new byte[num_data];
+	float[] pts = new float[num_data * 6];
 	int typeIndex = 0, ptsIndex = 0;
-	if (path.num_data > 0) {
-		int i = 0;
-		double[] points = new double[6]; 
-		cairo_path_data_t data = new cairo_path_data_t();
-		while (i < path.num_data) {
-			long /*int*/ offset = path.data + i * cairo_path_data_t.sizeof;
-			Cairo.memmove(data, offset, cairo_path_data_t.sizeof);
-			switch (data.type) {
-				case Cairo.CAIRO_PATH_MOVE_TO:
-					types[typeIndex++] = SWT.PATH_MOVE_TO;
-					Cairo.memmove(points, offset + cairo_path_data_t.sizeof, cairo_path_data_t.sizeof);
-					pts[ptsIndex++] = (float)points[0];
-					pts[ptsIndex++] = (float)points[1];
-					break;
-				case Cairo.CAIRO_PATH_LINE_TO:
-					types[typeIndex++] = SWT.PATH_LINE_TO;
-					Cairo.memmove(points, offset + cairo_path_data_t.sizeof, cairo_path_data_t.sizeof);
-					pts[ptsIndex++] = (float)points[0];
-					pts[ptsIndex++] = (float)points[1];
-					break;
-				case Cairo.CAIRO_PATH_CURVE_TO:
-					types[typeIndex++] = SWT.PATH_CUBIC_TO;
-					Cairo.memmove(points, offset + cairo_path_data_t.sizeof, cairo_path_data_t.sizeof * 3);
-					pts[ptsIndex++] = (float)points[0];
-					pts[ptsIndex++] = (float)points[1];
-					pts[ptsIndex++] = (float)points[2];
-					pts[ptsIndex++] = (float)points[3];
-					pts[ptsIndex++] = (float)points[4];
-					pts[ptsIndex++] = (float)points[5];
-					break;
-				case Cairo.CAIRO_PATH_CLOSE_PATH:
-					types[typeIndex++] = SWT.PATH_CLOSE;
-					break;
-			}
-			i += data.length;
+	int i = 0;
+	while (i < num_data) {
+		int offset = i * cairo_path_data_t.sizeof;
+		int count = 0;
+		switch (buffer.getInt(offset)) {
+			case Cairo.CAIRO_PATH_MOVE_TO:
+				types[typeIndex++] = SWT.PATH_MOVE_TO;
+				count = 1;
+				break;
+			case Cairo.CAIRO_PATH_LINE_TO:
+				types[typeIndex++] = SWT.PATH_LINE_TO;
+				count = 1;
+				break;
+			case Cairo.CAIRO_PATH_CURVE_TO:
+				types[typeIndex++] = SWT.PATH_CUBIC_TO;
+				count = 3;
+				break;
+			case Cairo.CAIRO_PATH_CLOSE_PATH:
+				types[typeIndex++] = SWT.PATH_CLOSE;
+				break;
 		}
+		for (int j = 1; j <= count; j++) {
+			pts[ptsIndex++] = (float)buffer.getDouble(offset + j * cairo_path_data_t.sizeof);
+			pts[ptsIndex++] = (float)buffer.getDouble(offset + j * cairo_path_data_t.sizeof + 8);
+		}
+		i += buffer.getInt(offset + 4);
 	}
 	if (typeIndex != types.length) {
 		byte[] newTypes = new byte[typeIndex];
@@ -651,6 +694,12 @@ void destroy() {
 void init(PathData data) {
 	byte[] types = data.types;
 	float[] points = data.points;
+	int[] state = {moved ? 1 : 0, closed ? 1 : 0};
+	if (Cairo.cairo_append_path_data(handle, types, points, state)) {
+		moved = state[0] != 0;
+		closed = state[1] != 0;
+		return;
+	}
 	for (int i = 0, j = 0; i < types.length; i++) {
 		switch (types[i]) {
 			case SWT.PATH_MOVE_TO:
@@ -348,15 +348,7 @@ public void shear(float shearX, float shearY) {
 public void transform(float[] pointArray) {
 	if (isDisposed()) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
 	if (pointArray == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
-	double[] dx = new double[1], dy = new double[1];
-	int length = pointArray.length / 2;
-	for (int i = 0, j = 0; i < length; i++, j += 2) {
-		dx[0] = pointArray[j];
-		dy[0] = pointArray[j + 1];
-		Cairo.cairo_matrix_transform_point(handle, dx, dy);
-		pointArray[j] = (float)dx[0];
-		pointArray[j + 1] = (float)dy[0];
-	}
+	Cairo.swt_cairo_matrix_transform_points(handle, pointArray, pointArray.length / 2);
 }
 
 /**
@@ -3250,6 +3250,22 @@ int readImageRef(int path) {
 	return image;
 }
 
+/*
+* Mouse moved and dragged events are only dispatched when no newer event of
+* the same kind is waiting in the queue, so a fast mouse or a window drag
+* does not run the Java handlers for every position in between.
+*/
+boolean isCoalesced (int theEvent) {
+	if (OS.GetEventClass (theEvent) != OS.kEventClassMouse) return false;
+	int eventKind = OS.GetEventKind (theEvent);
+	if (eventKind != OS.kEventMouseMoved && eventKind != OS.kEventMouseDragged) return false;
+	int [] mask = new int [] {OS.kEventClassMouse, eventKind};
+	int nextEvent = OS.AcquireFirstMatchingEventInQueue (OS.GetCurrentEventQueue (), mask.length / 2, mask, OS.kEventQueueOptionsNone);
+	if (nextEvent == 0) return false;
+	OS.ReleaseEvent (nextEvent);
+	return true;
+}
+
 /**
  * Reads an event from the operating system's event queue,
  * dispatches it appropriately, and returns <code>true</code>
@@ -3286,7 +3302,7 @@ public boolean readAndDispatch () {
 	int status = OS.ReceiveNextEvent (0, null, OS.kEventDurationNoWait, true, outEvent);
 	if (status == OS.noErr) {
 		events = true;
-		OS.SendEventToEventTarget (outEvent [0], OS.GetEventDispatcherTarget ());
+		if (!isCoalesced (outEvent [0])) OS.SendEventToEventTarget (outEvent [0], OS.GetEventDispatcherTarget ());
 		OS.ReleaseEvent (outEvent [0]);
 
 		/*
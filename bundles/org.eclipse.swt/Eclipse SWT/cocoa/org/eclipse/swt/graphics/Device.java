@@ -117,7 +117,7 @@ public Device(DeviceData data) {
 			NSAutoreleasePool pool = (NSAutoreleasePool) new NSAutoreleasePool().alloc().init();
 			NSThread nsthread = NSThread.currentThread();
 			NSMutableDictionary dictionary = nsthread.threadDictionary();
-			NSString key = NSString.stringWith("SWT_NSAutoreleasePool");
+			NSString key = NSString.internedStringWith("SWT_NSAutoreleasePool");
 			id obj = dictionary.objectForKey(key);
 			if (obj == null) {
 				NSNumber nsnumber = NSNumber.numberWithInteger(pool.id);
@@ -479,7 +479,7 @@ public void copyArea(Image image, int x, int y) {
 			NSString key = null;
 			if (OS.VERSION >= 0x1070) {
 				screens = NSScreen.screens();
-				key = NSString.stringWith("NSScreenNumber");
+				key = NSString.internedStringWith("NSScreenNumber");
 			}
 			CGRect rect = new CGRect();
 			rect.origin.x = x;
@@ -861,9 +861,34 @@ void init(ImageData image) {
 	
 	/* Create the image */
 	int dataSize = width * height * 4;
+	int bpr = width * 4;
+
+	/*
+	* Direct 24 and 32 bit pixels without a transparency mask are converted
+	* straight into the bitmap data, without an intermediate Java buffer.
+	*/
+	if (palette.isDirect && (image.depth == 24 || image.depth == 32) && image.getTransparencyType() != SWT.TRANSPARENCY_MASK
+			&& (image.alphaData == null || image.alphaData.length >= width * height)) {
+		int redShift = getByteShift(palette.redMask);
+		int greenShift = getByteShift(palette.greenMask);
+		int blueShift = getByteShift(palette.blueMask);
+		if (redShift != -1 && greenShift != -1 && blueShift != -1) {
+			this.type = SWT.BITMAP;
+			if (image.alpha != -1) {
+				this.alpha = image.alpha;
+			} else if (image.alphaData != null) {
+				this.alphaData = new byte[image.alphaData.length];
+				System.arraycopy(image.alphaData, 0, this.alphaData, 0, alphaData.length);
+			}
+			boolean hasAlpha = image.alpha != -1 || image.alphaData != null;
+			NSBitmapImageRep rep = createRepresentation(hasAlpha, bpr);
+			OS.swt_ImageData_toARGB(rep.bitmapData(), width, height, image.data, image.bytesPerLine, image.depth, redShift, greenShift, blueShift, alphaData, alpha);
+			rep.release();
+			return;
+		}
+	}
 	
 	/* Initialize data */
-	int bpr = width * 4;
 	byte[] buffer = new byte[dataSize];
 	if (palette.isDirect) {
 		ImageData.blit(ImageData.BLIT_SRC,
@@ -949,6 +974,21 @@ void init(ImageData image) {
 		}
 	}
 	
+	NSBitmapImageRep rep = createRepresentation(hasAlpha, bpr);
+	OS.memmove(rep.bitmapData(), buffer, dataSize);	
+	rep.release();
+}
+
+/* Answers the shift of a mask that covers exactly one byte, or -1 */
+static int getByteShift(int mask) {
+	for (int shift = 0; shift <= 24; shift += 8) {
+		if (mask == 0xFF << shift) return shift;
+	}
+	return -1;
+}
+
+/* Replaces the handle with an image holding a new ARGB bitmap, the caller releases the answered bitmap */
+NSBitmapImageRep createRepresentation(boolean hasAlpha, int bpr) {
 	if (handle != null) handle.release();
 	
 	handle = (NSImage)new NSImage().alloc();
@@ -958,10 +998,9 @@ void init(ImageData image) {
 	handle = handle.initWithSize(size);
 	NSBitmapImageRep rep = (NSBitmapImageRep)new NSBitmapImageRep().alloc();
 	rep = rep.initWithBitmapDataPlanes(0, width, height, 8, hasAlpha ? 4 : 3, hasAlpha, false, OS.NSDeviceRGBColorSpace, OS.NSAlphaFirstBitmapFormat | OS.NSAlphaNonpremultipliedBitmapFormat, bpr, 32);
-	OS.memmove(rep.bitmapData(), buffer, dataSize);	
 	handle.addRepresentation(rep);
-	rep.release();
 	handle.setCacheMode(OS.NSImageCacheNever);
+	return rep;
 }
 
 void initNative(String filename) {
@@ -236,7 +236,7 @@ public void addArc(float x, float y, float width, float height, float startAngle
 
 void appendBezierPath (NSBezierPath path) {
 	int count = (int)/*64*/path.elementCount();
-	long /*int*/ points = OS.malloc(3 * NSPoint.sizeof);
+	long /*int*/ points = OS.pool_malloc(3 * NSPoint.sizeof);
 	if (points == 0) SWT.error(SWT.ERROR_NO_HANDLES);
 	NSPoint pt1 = new NSPoint();
 	NSPoint pt2 = new NSPoint();
@@ -270,7 +270,7 @@ void appendBezierPath (NSBezierPath path) {
 				break;
 		}
 	}
-	OS.free(points);
+	OS.pool_free(points);
 }
 
 /**
@@ -383,7 +383,7 @@ public void addString(String string, float x, float y, Font font) {
 		attrStr.release();
 		range = layoutManager.glyphRangeForTextContainer(textContainer);
 		if (range.length != 0) {
-			long /*int*/ glyphs = OS.malloc((range.length + 1) * 4);
+			long /*int*/ glyphs = OS.pool_malloc((range.length + 1) * 4);
 			long /*int*/ count = layoutManager.getGlyphs(glyphs, range);
 			NSBezierPath path = NSBezierPath.bezierPath();
 			for (int i = 0; i < count; i++) {
@@ -395,7 +395,7 @@ public void addString(String string, float x, float y, Font font) {
 				path.moveToPoint(pt);
 				path.appendBezierPathWithGlyphs(glyphs + (i * 4), 1, actualFont);
 			}
-			OS.free(glyphs);
+			OS.pool_free(glyphs);
 			NSAffineTransform transform = NSAffineTransform.transform();
 			transform.scaleXBy(1, -1);
 			path.transformUsingAffineTransform(transform);
@@ -462,7 +462,7 @@ public boolean contains(float x, float y, GC gc, boolean outline) {
 	try {
 		//TODO - see windows
 		if (outline) {
-			long /*int*/ pixel = OS.malloc(4);
+			long /*int*/ pixel = OS.pool_malloc(4);
 			if (pixel == 0) SWT.error(SWT.ERROR_NO_HANDLES);
 			int[] buffer = new int[]{0xFFFFFFFF};
 			OS.memmove(pixel, buffer, 4);
@@ -470,7 +470,7 @@ public boolean contains(float x, float y, GC gc, boolean outline) {
 			long /*int*/ context = OS.CGBitmapContextCreate(pixel, 1, 1, 8, 4, colorspace, OS.kCGImageAlphaNoneSkipFirst);
 			OS.CGColorSpaceRelease(colorspace);
 			if (context == 0) {
-				OS.free(pixel);
+				OS.pool_free(pixel);
 				SWT.error(SWT.ERROR_NO_HANDLES);
 			}
 			GCData data = gc.data;
@@ -496,7 +496,7 @@ public boolean contains(float x, float y, GC gc, boolean outline) {
 			OS.CGContextStrokePath(context);
 			OS.CGContextRelease(context);
 			OS.memmove(buffer, pixel, 4);
-			OS.free(pixel);	
+			OS.pool_free(pixel);	
 			return buffer[0] != 0xFFFFFFFF;			
 		} else {
 			NSPoint point = new NSPoint();
@@ -630,7 +630,7 @@ public PathData getPathData() {
 		int pointCount = 0, typeCount = 0;
 		byte[] types = new byte[count];
 		float[] pointArray = new float[count * 6];
-		long /*int*/ points = OS.malloc(3 * NSPoint.sizeof);
+		long /*int*/ points = OS.pool_malloc(3 * NSPoint.sizeof);
 		if (points == 0) SWT.error(SWT.ERROR_NO_HANDLES);
 		NSPoint pt = new NSPoint();
 		for (int i = 0; i < count; i++) {
@@ -665,7 +665,7 @@ public PathData getPathData() {
 					break;
 			}
 		}
-		OS.free(points);
+		OS.pool_free(points);
 		if (pointCount != pointArray.length) {
 			float[] temp = new float[pointCount];
 			System.arraycopy(pointArray, 0, temp, 0, pointCount);
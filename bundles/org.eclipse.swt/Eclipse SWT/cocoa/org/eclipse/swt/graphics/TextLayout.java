@@ -59,6 +59,7 @@ public final class TextLayout extends Resource {
 	static final byte[] SWT_OBJECT = {'S', 'W', 'T', '_', 'O', 'B', 'J', 'E', 'C', 'T', '\0'};
 	
 	static final int TAB_COUNT = 32;
+	static final int LINE_FRAGMENTS = 16;
 	static final int UNDERLINE_THICK = 1 << 16;
 	static final RGB LINK_FOREGROUND = new RGB (0, 51, 153);
 	int[] invalidOffsets;
@@ -312,25 +313,30 @@ void computeRuns() {
 	textStorage.setAttributedString(attrStr);
 	attrStr.release();
 	
-	int numberOfLines;
 	layoutManager.glyphRangeForTextContainer(textContainer);
-	long /*int*/ numberOfGlyphs = layoutManager.numberOfGlyphs(), index;
-	long /*int*/ rangePtr = OS.malloc(NSRange.sizeof);
-	NSRange lineRange = new NSRange();
-	for (numberOfLines = 0, index = 0; index < numberOfGlyphs; numberOfLines++){
-	    layoutManager.lineFragmentUsedRectForGlyphAtIndex(index, rangePtr, true);
-	    OS.memmove(lineRange, rangePtr, NSRange.sizeof);
-	    index = lineRange.location + lineRange.length;
+
+	/* Fetch the line fragments in one call, again if there are more than guessed */
+	int capacity = LINE_FRAGMENTS;
+	double /*float*/ [] rects = new double /*float*/ [capacity * 4];
+	int[] glyphs = new int[capacity];
+	int numberOfLines = OS.swt_NSLayoutManager_getLineFragments(layoutManager.id, rects, glyphs);
+	if (numberOfLines > capacity) {
+		capacity = numberOfLines;
+		rects = new double /*float*/ [capacity * 4];
+		glyphs = new int[capacity];
+		numberOfLines = OS.swt_NSLayoutManager_getLineFragments(layoutManager.id, rects, glyphs);
 	}
-	if (numberOfLines == 0) numberOfLines++;
-	int[] offsets = new int[numberOfLines + 1];
-	NSRect[] bounds = new NSRect[numberOfLines];
-	for (numberOfLines = 0, index = 0; index < numberOfGlyphs; numberOfLines++){
-		bounds[numberOfLines] = layoutManager.lineFragmentUsedRectForGlyphAtIndex(index, rangePtr, true);
-		if (numberOfLines < bounds.length - 1) bounds[numberOfLines].height -= spacing;
-	    OS.memmove(lineRange, rangePtr, NSRange.sizeof);
-	    offsets[numberOfLines] = (int)/*64*/lineRange.location;
-	    index = lineRange.location + lineRange.length;
+	int[] offsets = new int[Math.max(numberOfLines, 1) + 1];
+	NSRect[] bounds = new NSRect[Math.max(numberOfLines, 1)];
+	for (int i = 0; i < numberOfLines; i++) {
+		NSRect rect = new NSRect();
+		rect.x = rects[i * 4];
+		rect.y = rects[i * 4 + 1];
+		rect.width = rects[i * 4 + 2];
+		rect.height = rects[i * 4 + 3];
+		if (i < bounds.length - 1) rect.height -= spacing;
+		bounds[i] = rect;
+		offsets[i] = glyphs[i];
 	}
 	if (numberOfLines == 0) {
 		Font font = this.font != null ? this.font : device.systemFont;
@@ -338,7 +344,6 @@ void computeRuns() {
 		bounds[0] = new NSRect();
 		bounds[0].height = Math.max(layoutManager.defaultLineHeightForFont(nsFont), ascent + descent);
 	}
-	OS.free(rangePtr);
 	offsets[numberOfLines] = (int)/*64*/textStorage.length();
 	this.lineOffsets = offsets;
 	this.lineBounds = bounds;
@@ -29,6 +29,7 @@ import org.eclipse.swt.graphics.Rectangle;
 import org.eclipse.swt.internal.C;
 import org.eclipse.swt.internal.Callback;
 import org.eclipse.swt.internal.LONG;
+import org.eclipse.swt.internal.Watchdog;
 import org.eclipse.swt.internal.cocoa.CGPoint;
 import org.eclipse.swt.internal.cocoa.NSApplication;
 import org.eclipse.swt.internal.cocoa.NSArray;
@@ -237,7 +238,7 @@ public class Display extends Device {
 	int[] screenID = new int[32];
 	NSPoint[] screenCascade = new NSPoint[32];
 	
-	long /*int*/ runLoopObserver;
+	long /*int*/ runLoopObserver, wakeSource;
 	Callback observerCallback;
 	
 	boolean lockCursor = true;
@@ -581,7 +582,7 @@ void addPool (NSAutoreleasePool pool) {
 	}
 	if (poolCount == 0) {
 		NSMutableDictionary dictionary = NSThread.currentThread().threadDictionary();
-		dictionary.setObject(NSNumber.numberWithInteger(pool.id), NSString.stringWith("SWT_NSAutoreleasePool"));
+		dictionary.setObject(NSNumber.numberWithInteger(pool.id), NSString.internedStringWith("SWT_NSAutoreleasePool"));
 	}
 	pools [poolCount++] = pool;
 }
@@ -672,7 +673,7 @@ public void beep () {
 
 void cascadeWindow (NSWindow window, NSScreen screen) {
 	NSDictionary dictionary = screen.deviceDescription();
-	int screenNumber = new NSNumber(dictionary.objectForKey(NSString.stringWith("NSScreenNumber")).id).intValue();
+	int screenNumber = new NSNumber(dictionary.objectForKey(NSString.internedStringWith("NSScreenNumber")).id).intValue();
 	int index = 0;
 	while (screenID[index] != 0 && screenID[index] != screenNumber) index++;
 	screenID[index] = screenNumber;
@@ -881,6 +882,7 @@ protected void create (DeviceData data) {
 	checkSubclass ();
 	checkDisplay (thread = Thread.currentThread (), false);
 	createDisplay (data);
+	if (Watchdog.THRESHOLD > 0) Watchdog.start (Watchdog.THRESHOLD);
 	register (this);
 	synchronizer = new Synchronizer (this);
 	if (Default == null) Default = this;
@@ -901,7 +903,7 @@ void createDisplay (DeviceData data) {
 	}
 	
 	NSMutableDictionary dictionary = nsthread.threadDictionary();
-	NSString key = NSString.stringWith("SWT_NSAutoreleasePool");
+	NSString key = NSString.internedStringWith("SWT_NSAutoreleasePool");
 	NSNumber id = new NSNumber(dictionary.objectForKey(key));
 	addPool(new NSAutoreleasePool(id.integerValue()));
 
@@ -2218,18 +2220,14 @@ Widget getWidget (long /*int*/ id) {
 
 static Widget GetWidget (long /*int*/ id) {
 	if (id == 0) return null;
-	long /*int*/ [] jniRef = new long /*int*/ [1];
-	long /*int*/ iVar = OS.object_getInstanceVariable(id, SWT_OBJECT, jniRef);
-	if (iVar == 0) {
-		if (dynamicObjectMap != null) {
-			NSObject key = new NSObject(id);
-			LONG dynJNIRef = (LONG) dynamicObjectMap.get(key);
-			if (dynJNIRef != null) jniRef[0] = dynJNIRef.value;
-		}
+	/* One native call reads the instance variable and answers the object it references */
+	Object object = OS.swt_object_getSWTObject(id);
+	if (object == null && dynamicObjectMap != null) {
+		NSObject key = new NSObject(id);
+		LONG dynJNIRef = (LONG) dynamicObjectMap.get(key);
+		if (dynJNIRef != null && dynJNIRef.value != 0) object = OS.JNIGetObject(dynJNIRef.value);
 	}
-
-	if (jniRef[0] == 0) return null;
-	return (Widget)OS.JNIGetObject(jniRef[0]);
+	return (Widget)object;
 }
 
 Widget getWidget (NSView view) {
@@ -2323,6 +2321,8 @@ protected void init () {
 	runLoopObserver = OS.CFRunLoopObserverCreate (0, activities, true, 0, observerProc, 0);
 	if (runLoopObserver == 0) error (SWT.ERROR_NO_HANDLES);
 	OS.CFRunLoopAddObserver (OS.CFRunLoopGetCurrent (), runLoopObserver, OS.kCFRunLoopCommonModes ());
+	wakeSource = OS.swt_wake_source_new (OS.CFRunLoopGetCurrent ());
+	if (wakeSource == 0) error (SWT.ERROR_NO_HANDLES);
 
 	// Add AWT Runloop mode for SWT/AWT.
 	long /*int*/ cls = OS.objc_lookUpClass("JNFRunLoop"); //$NON-NLS-1$
@@ -3752,10 +3752,8 @@ public boolean readAndDispatch () {
 		events |= runTimers ();
 		events |= runContexts ();
 		events |= runPopups ();
-		NSEvent event = application.nextEventMatchingMask(0, null, OS.NSDefaultRunLoopMode, true);
-		if (event != null) {
+		if (OS.swt_NSApplication_dispatchEvents(application.id, 0, 0, OS.NSDefaultRunLoopMode.id, 1) != 0) {
 			events = true;
-			application.sendEvent(event);
 		}
 		events |= runPaint ();
 		events |= runDeferredEvents ();
@@ -3839,6 +3837,7 @@ protected void release () {
 }
 
 void releaseDisplay () {	
+	Watchdog.stop ();
 	/* Release the System Images */
 	if (errorImage != null) errorImage.dispose ();
 	if (infoImage != null) infoImage.dispose ();
@@ -3954,6 +3953,10 @@ void releaseDisplay () {
 		OS.CFRelease (runLoopObserver);
 	}
 	runLoopObserver = 0;
+	synchronized (Device.class) {
+		if (wakeSource != 0) OS.swt_wake_source_free (wakeSource);
+		wakeSource = 0;
+	}
 	if (observerCallback != null) observerCallback.dispose();
 	observerCallback = null;
 }
@@ -4067,7 +4070,7 @@ void removePool () {
 	pools [--poolCount] = null;
 	if (poolCount == 0) {
 		NSMutableDictionary dictionary = NSThread.currentThread().threadDictionary();
-		dictionary.removeObjectForKey(NSString.stringWith("SWT_NSAutoreleasePool"));
+		dictionary.removeObjectForKey(NSString.internedStringWith("SWT_NSAutoreleasePool"));
 	}
 	pool.release ();
 }
@@ -4307,9 +4310,11 @@ void sendSleepEvent() {
   if (this.eventTable != null && this.eventTable.hooks(SWT.Sleep)) {
     sendEvent(SWT.Sleep, null);
   }
+  Watchdog.idle(true);
 }
 
 void sendWakeupEvent() {
+  Watchdog.idle(false);
   if (this.eventTable != null && this.eventTable.hooks(SWT.Wakeup)) {
     sendEvent(SWT.Wakeup, null);
   }
@@ -4979,9 +4984,10 @@ public void wake () {
 }
 
 void wakeThread () {
-	//new pool?
-	NSObject object = new NSObject().alloc().init();
-	object.performSelectorOnMainThread(OS.sel_release, null, false);
+	/* The source is freed when the display is released, under the same lock */
+	synchronized (Device.class) {
+		if (wakeSource != 0) OS.swt_wake_source_signal (wakeSource);
+	}
 }
 
 Control findControl (boolean checkTrim) {
@@ -5587,19 +5593,19 @@ static long /*int*/ windowProc(long /*int*/ id, long /*int*/ sel) {
 		NSRange range = widget.markedRange (id, sel);
 		/* NOTE that this is freed in C */
 		long /*int*/ result = OS.malloc (NSRange.sizeof);
-		OS.memmove (result, range, NSRange.sizeof);
+		OS.writeNSRange(result, range);
 		return result;
 	} else if (sel == OS.sel_selectedRange) {
 		NSRange range = widget.selectedRange (id, sel);
 		/* NOTE that this is freed in C */
 		long /*int*/ result = OS.malloc (NSRange.sizeof);
-		OS.memmove (result, range, NSRange.sizeof);
+		OS.writeNSRange(result, range);
 		return result;
 	} else if (sel == OS.sel_cellSize) {
 		NSSize size = widget.cellSize (id, sel);
 		/* NOTE that this is freed in C */
 		long /*int*/ result = OS.malloc (NSSize.sizeof);
-		OS.memmove (result, size, NSSize.sizeof);
+		OS.writeNSSize(result, size);
 		return result;
 	} else if (sel == OS.sel_hasMarkedText) {
 		return widget.hasMarkedText (id, sel) ? 1 : 0;
@@ -5682,26 +5688,21 @@ static long /*int*/ windowProc(long /*int*/ id, long /*int*/ sel, long /*int*/ a
 	if (sel == OS.sel_windowWillClose_) {
 		widget.windowWillClose(id, sel, arg0);
 	} else if (sel == OS.sel_drawRect_) {
-		NSRect rect = new NSRect();
-		OS.memmove(rect, arg0, NSRect.sizeof);
+		NSRect rect = OS.readNSRect(arg0);
 		widget.drawRect(id, sel, rect);
 	} else if (sel == OS.sel_columnAtPoint_) {
-		NSPoint point = new NSPoint();
-		OS.memmove(point, arg0, NSPoint.sizeof);
+		NSPoint point = OS.readNSPoint(arg0);
 		return widget.columnAtPoint(id, sel, point);
 	} else if (sel == OS.sel__drawThemeProgressArea_) {
 		widget._drawThemeProgressArea(id, sel, arg0);
 	} else if (sel == OS.sel_setFrameOrigin_) {
-		NSPoint point = new NSPoint();
-		OS.memmove(point, arg0, NSPoint.sizeof);
+		NSPoint point = OS.readNSPoint(arg0);
 		widget.setFrameOrigin(id, sel, point);
 	} else if (sel == OS.sel_setFrameSize_) {
-		NSSize size = new NSSize();
-		OS.memmove(size, arg0, NSSize.sizeof);
+		NSSize size = OS.readNSSize(arg0);
 		widget.setFrameSize(id, sel, size);
 	} else if (sel == OS.sel_hitTest_) {
-		NSPoint point = new NSPoint();
-		OS.memmove(point, arg0, NSPoint.sizeof);
+		NSPoint point = OS.readNSPoint(arg0);
 		return widget.hitTest(id, sel, point);
 	} else if (sel == OS.sel_windowShouldClose_) {
 		return widget.windowShouldClose(id, sel, arg0) ? 1 : 0;
@@ -5793,7 +5794,7 @@ static long /*int*/ windowProc(long /*int*/ id, long /*int*/ sel, long /*int*/ a
 		NSRect rect = widget.firstRectForCharacterRange (id, sel, arg0);
 		/* NOTE that this is freed in C */
 		long /*int*/ result = OS.malloc (NSRect.sizeof);
-		OS.memmove (result, rect, NSRect.sizeof);
+		OS.writeNSRect(result, rect);
 		return result;
 	} else if (sel == OS.sel_insertText_) {
 		return widget.insertText (id, sel, arg0) ? 1 : 0;
@@ -5804,8 +5805,7 @@ static long /*int*/ windowProc(long /*int*/ id, long /*int*/ sel, long /*int*/ a
 	} else if (sel == OS.sel_reflectScrolledClipView_) {
 		widget.reflectScrolledClipView (id, sel, arg0);
 	} else if (sel == OS.sel_accessibilityHitTest_) {
-		NSPoint point = new NSPoint();
-		OS.memmove(point, arg0, NSPoint.sizeof);
+		NSPoint point = OS.readNSPoint(arg0);
 		return widget.accessibilityHitTest(id, sel, point);
 	} else if (sel == OS.sel_accessibilityAttributeValue_) {
 		return widget.accessibilityAttributeValue(id, sel, arg0);
@@ -5835,31 +5835,28 @@ static long /*int*/ windowProc(long /*int*/ id, long /*int*/ sel, long /*int*/ a
 		NSRect rect = widget.headerRectOfColumn(id, sel, arg0);
 		/* NOTE that this is freed in C */
 		long /*int*/ result = OS.malloc (NSRect.sizeof);
-		OS.memmove (result, rect, NSRect.sizeof);
+		OS.writeNSRect(result, rect);
 		return result;
 	} else if (sel == OS.sel_imageRectForBounds_) {
-		NSRect rect = new NSRect();
-		OS.memmove(rect, arg0, NSRect.sizeof);
+		NSRect rect = OS.readNSRect(arg0);
 		rect = widget.imageRectForBounds(id, sel, rect);
 		/* NOTE that this is freed in C */
 		long /*int*/ result = OS.malloc (NSRect.sizeof);
-		OS.memmove (result, rect, NSRect.sizeof);
+		OS.writeNSRect(result, rect);
 		return result;
 	} else if (sel == OS.sel_titleRectForBounds_) {
-		NSRect rect = new NSRect();
-		OS.memmove(rect, arg0, NSRect.sizeof);
+		NSRect rect = OS.readNSRect(arg0);
 		rect = widget.titleRectForBounds(id, sel, rect);
 		/* NOTE that this is freed in C */
 		long /*int*/ result = OS.malloc (NSRect.sizeof);
-		OS.memmove (result, rect, NSRect.sizeof);
+		OS.writeNSRect(result, rect);
 		return result;
 	} else if (sel == OS.sel_cellSizeForBounds_) {
-		NSRect rect = new NSRect();
-		OS.memmove(rect, arg0, NSRect.sizeof);
+		NSRect rect = OS.readNSRect(arg0);
 		NSSize size = widget.cellSizeForBounds(id, sel, rect);
 		/* NOTE that this is freed in C */
 		long /*int*/ result = OS.malloc (NSSize.sizeof);
-		OS.memmove (result, size, NSSize.sizeof);
+		OS.writeNSSize(result, size);
 		return result;
 	} else if (sel == OS.sel_setObjectValue_) {
 		widget.setObjectValue(id, sel, arg0);
@@ -5869,7 +5866,7 @@ static long /*int*/ windowProc(long /*int*/ id, long /*int*/ sel, long /*int*/ a
 		NSSize size = widget.sizeOfLabel(id, sel, arg0 != 0);
 		/* NOTE that this is freed in C */
 		long /*int*/ result = OS.malloc(NSSize.sizeof);
-		OS.memmove(result, size, NSSize.sizeof);
+		OS.writeNSSize(result, size);
 		return result;
 	} else if (sel == OS.sel_comboBoxSelectionDidChange_) {
 		widget.comboBoxSelectionDidChange(id, sel, arg0);
@@ -5878,12 +5875,10 @@ static long /*int*/ windowProc(long /*int*/ id, long /*int*/ sel, long /*int*/ a
 	} else if (sel == OS.sel_comboBoxWillPopUp_) {
 		widget.comboBoxWillPopUp(id, sel, arg0);
 	} else if (sel == OS.sel_drawViewBackgroundInRect_) {
-		NSRect rect = new NSRect();
-		OS.memmove(rect, arg0, NSRect.sizeof);
+		NSRect rect = OS.readNSRect(arg0);
 		widget.drawViewBackgroundInRect(id, sel, rect);
 	} else if (sel == OS.sel_drawBackgroundInClipRect_) {
-		NSRect rect = new NSRect();
-		OS.memmove(rect, arg0, NSRect.sizeof);
+		NSRect rect = OS.readNSRect(arg0);
 		widget.drawBackgroundInClipRect(id, sel, rect);
 	} else if (sel == OS.sel_windowDidMiniaturize_) {
 		widget.windowDidMiniturize(id, sel, arg0);
@@ -5949,12 +5944,10 @@ static long /*int*/ windowProc(long /*int*/ id, long /*int*/ sel, long /*int*/ a
 	} else if (sel == OS.sel_setMarkedText_selectedRange_) {
 		widget.setMarkedText_selectedRange (id, sel, arg0, arg1);
 	} else if (sel == OS.sel_drawInteriorWithFrame_inView_) {
-		NSRect rect = new NSRect ();
-		OS.memmove (rect, arg0, NSRect.sizeof);
+		NSRect rect = OS.readNSRect(arg0);
 		widget.drawInteriorWithFrame_inView (id, sel, rect, arg1);
 	} else if (sel == OS.sel_drawWithExpansionFrame_inView_) {
-		NSRect rect = new NSRect();
-		OS.memmove(rect, arg0, NSRect.sizeof);
+		NSRect rect = OS.readNSRect(arg0);
 		widget.drawWithExpansionFrame_inView (id, sel, rect, arg1);
 	} else if (sel == OS.sel_accessibilityAttributeValue_forParameter_) {
 		return widget.accessibilityAttributeValue_forParameter(id, sel, arg0, arg1);
@@ -5965,28 +5958,24 @@ static long /*int*/ windowProc(long /*int*/ id, long /*int*/ sel, long /*int*/ a
 	} else if (sel == OS.sel_shouldChangeTextInRange_replacementString_) {
 		return widget.shouldChangeTextInRange_replacementString(id, sel, arg0, arg1) ? 1 : 0;
 	} else if (sel == OS.sel_canDragRowsWithIndexes_atPoint_) {
-		NSPoint clickPoint = new NSPoint();
-		OS.memmove(clickPoint, arg1, NSPoint.sizeof);
+		NSPoint clickPoint = OS.readNSPoint(arg1);
 		return widget.canDragRowsWithIndexes_atPoint(id, sel, arg0, clickPoint) ? 1 : 0;
 	} else if (sel == OS.sel_expandItem_expandChildren_) {
 		widget.expandItem_expandChildren(id, sel, arg0, arg1 != 0);
 	} else if (sel == OS.sel_collapseItem_collapseChildren_) {
 		widget.collapseItem_collapseChildren(id, sel, arg0, arg1 != 0);
 	} else if (sel == OS.sel_expansionFrameWithFrame_inView_) {
-		NSRect rect = new NSRect();
-		OS.memmove(rect, arg0, NSRect.sizeof);
+		NSRect rect = OS.readNSRect(arg0);
 		rect = widget.expansionFrameWithFrame_inView(id, sel, rect, arg1);
 		/* NOTE that this is freed in C */
 		long /*int*/ result = OS.malloc (NSRect.sizeof);
-		OS.memmove (result, rect, NSRect.sizeof);
+		OS.writeNSRect(result, rect);
 		return result;
 	} else if (sel == OS.sel_drawLabel_inRect_) {
-		NSRect rect = new NSRect();
-		OS.memmove(rect, arg1, NSRect.sizeof);
+		NSRect rect = OS.readNSRect(arg1);
 		widget.drawLabelInRect(id, sel, arg0==1, rect);
 	} else if (sel == OS.sel_scrollClipView_toPoint_) {
-		NSPoint point = new NSPoint();
-		OS.memmove(point, arg1, NSPoint.sizeof);
+		NSPoint point = OS.readNSPoint(arg1);
 		widget.scrollClipViewToPoint (id, sel, arg0, point);
 	} else if (sel == OS.sel_accessibilitySetValue_forAttribute_) {
 		widget.accessibilitySetValue_forAttribute(id, sel, arg0, arg1);
@@ -6025,27 +6014,23 @@ static long /*int*/ windowProc(long /*int*/ id, long /*int*/ sel, long /*int*/ a
 		NSRange range = widget.textView_willChangeSelectionFromCharacterRange_toCharacterRange(id, sel, arg0, arg1, arg2);
 		/* NOTE that this is freed in C */
 		long /*int*/ result = OS.malloc (NSRange.sizeof);
-		OS.memmove (result, range, NSRange.sizeof);
+		OS.writeNSRange(result, range);
 		return result;
 	} else if (sel == OS.sel_dragSelectionWithEvent_offset_slideBack_) {
-		NSSize offset = new NSSize();
-		OS.memmove(offset, arg0, NSSize.sizeof);
+		NSSize offset = OS.readNSSize(arg0);
 		return (widget.dragSelectionWithEvent(id, sel, arg0, arg1, arg2) ? 1 : 0);
 	} else if (sel == OS.sel_drawImage_withFrame_inView_) {
-		NSRect rect = new NSRect ();
-		OS.memmove (rect, arg1, NSRect.sizeof);
+		NSRect rect = OS.readNSRect(arg1);
 		widget.drawImageWithFrameInView (id, sel, arg0, rect, arg2);
 	} else if (sel == OS.sel_drawTitle_withFrame_inView_) {
-		NSRect rect = new NSRect ();
-		OS.memmove (rect, arg1, NSRect.sizeof);
+		NSRect rect = OS.readNSRect(arg1);
 		rect = widget.drawTitleWithFrameInView (id, sel, arg0, rect, arg2);
 		/* NOTE that this is freed in C */
 		long /*int*/ result = OS.malloc (NSRect.sizeof);
-		OS.memmove (result, rect, NSRect.sizeof);
+		OS.writeNSRect(result, rect);
 		return result;
 	} else if (sel == OS.sel_hitTestForEvent_inRect_ofView_) {
-		NSRect rect = new NSRect ();
-		OS.memmove (rect, arg1, NSRect.sizeof);
+		NSRect rect = OS.readNSRect(arg1);
 		return widget.hitTestForEvent (id, sel, arg0, rect, arg2);
 	} else if (sel == OS.sel_tableView_writeRowsWithIndexes_toPasteboard_) {
 		return (widget.tableView_writeRowsWithIndexes_toPasteboard(id, sel, arg0, arg1, arg2) ? 1 : 0);
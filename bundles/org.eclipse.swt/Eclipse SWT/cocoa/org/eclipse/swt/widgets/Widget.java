@@ -735,6 +735,8 @@ void drawRect (long /*int*/ id, long /*int*/ sel, NSRect rect) {
 	NSGraphicsContext context = NSGraphicsContext.currentContext();
 	context.saveGraphicsState();
 	setClipRegion(view);
+	/* Draw only the damaged rectangles, not all of their union */
+	OS.swt_NSView_clipToRectsBeingDrawn(id);
 	drawBackground (id, context, rect);
 	objc_super super_struct = new objc_super();
 	super_struct.receiver = id;
@@ -0,0 +1,189 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2014 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+
+#include "swt.h"
+
+#include <stdlib.h>
+#if defined (_WIN32) || defined (_WIN32_WCE)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+/*
+* Scratch memory for the temporaries of a native. Each thread bumps a
+* pointer through a chain of blocks, and a native gives everything it
+* allocated back at once when it returns:
+*
+*	size_t mark = swtArenaMark();
+*	Color *colors = (Color *)swtArenaAlloc(count * sizeof(Color));
+*	...
+*	swtArenaRelease(mark);
+*
+* Marks nest, so a native that calls back into Java which calls another
+* native releases only its own temporaries. Released blocks stay cached
+* on the thread, except those past the first one once the thread leaves
+* the outermost native, so a thread that once needed a large temporary
+* does not keep it forever.
+*/
+
+#define ARENA_BLOCK_SIZE (64 * 1024)
+#define ARENA_ALIGN 16
+
+typedef struct ARENA_BLOCK {
+	struct ARENA_BLOCK *prev, *next;
+	size_t size, used, start;
+} ARENA_BLOCK;
+
+typedef struct ARENA {
+	ARENA_BLOCK *current;
+} ARENA;
+
+#define ARENA_HEADER ((sizeof(ARENA_BLOCK) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+#define ARENA_DATA(block) ((char *)(block) + ARENA_HEADER)
+
+static void arenaFree(void *data)
+{
+	ARENA *arena = (ARENA *)data;
+	ARENA_BLOCK *block;
+	if (arena == NULL) return;
+	block = arena->current;
+	if (block != NULL) {
+		while (block->prev != NULL) block = block->prev;
+		while (block != NULL) {
+			ARENA_BLOCK *next = block->next;
+			free(block);
+			block = next;
+		}
+	}
+	free(arena);
+}
+
+#if defined (_WIN32) || defined (_WIN32_WCE)
+static DWORD arenaKey = TLS_OUT_OF_INDEXES;
+static volatile LONG arenaKeyState = 0;
+
+static ARENA *arenaGet(int create)
+{
+	ARENA *arena;
+	if (arenaKeyState != 2) {
+		if (!create) return NULL;
+		if (InterlockedCompareExchange(&arenaKeyState, 1, 0) == 0) {
+			arenaKey = TlsAlloc();
+			InterlockedExchange(&arenaKeyState, 2);
+		}
+		while (arenaKeyState != 2) Sleep(0);
+	}
+	if (arenaKey == TLS_OUT_OF_INDEXES) return NULL;
+	arena = (ARENA *)TlsGetValue(arenaKey);
+	if (arena == NULL && create) {
+		arena = (ARENA *)calloc(1, sizeof(ARENA));
+		if (arena != NULL) TlsSetValue(arenaKey, arena);
+	}
+	return arena;
+}
+
+/* Called from DllMain, Windows has no destructors for TLS slots */
+void swtArenaThreadDetach()
+{
+	ARENA *arena = arenaGet(0);
+	if (arena == NULL) return;
+	TlsSetValue(arenaKey, NULL);
+	arenaFree(arena);
+}
+#else
+static pthread_key_t arenaKey;
+static pthread_once_t arenaOnce = PTHREAD_ONCE_INIT;
+static int arenaKeyFailed = 0;
+
+static void arenaInit()
+{
+	if (pthread_key_create(&arenaKey, arenaFree) != 0) arenaKeyFailed = 1;
+}
+
+static ARENA *arenaGet(int create)
+{
+	ARENA *arena;
+	pthread_once(&arenaOnce, arenaInit);
+	if (arenaKeyFailed) return NULL;
+	arena = (ARENA *)pthread_getspecific(arenaKey);
+	if (arena == NULL && create) {
+		arena = (ARENA *)calloc(1, sizeof(ARENA));
+		if (arena != NULL) pthread_setspecific(arenaKey, arena);
+	}
+	return arena;
+}
+#endif
+
+size_t swtArenaMark()
+{
+	ARENA *arena = arenaGet(1);
+	if (arena == NULL || arena->current == NULL) return 0;
+	return arena->current->start + arena->current->used;
+}
+
+void *swtArenaAlloc(size_t size)
+{
+	ARENA *arena = arenaGet(1);
+	ARENA_BLOCK *block;
+	size_t used;
+	if (arena == NULL || size > (size_t)-1 - ARENA_ALIGN) return NULL;
+	size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+	block = arena->current;
+	if (block != NULL && block->size - block->used >= size) {
+		used = block->used;
+		block->used += size;
+		return ARENA_DATA(block) + used;
+	}
+	/* Move on to the next cached block, or allocate one large enough */
+	if (block != NULL && block->next != NULL && block->next->size >= size) {
+		block = block->next;
+	} else {
+		ARENA_BLOCK *newBlock;
+		size_t blockSize = size > ARENA_BLOCK_SIZE ? size : ARENA_BLOCK_SIZE;
+		if (blockSize > (size_t)-1 - ARENA_HEADER) return NULL;
+		newBlock = (ARENA_BLOCK *)malloc(ARENA_HEADER + blockSize);
+		if (newBlock == NULL) return NULL;
+		newBlock->size = blockSize;
+		newBlock->prev = block;
+		newBlock->next = block != NULL ? block->next : NULL;
+		if (newBlock->next != NULL) newBlock->next->prev = newBlock;
+		if (block != NULL) block->next = newBlock;
+		block = newBlock;
+	}
+	block->start = block->prev != NULL ? block->prev->start + block->prev->size : 0;
+	block->used = size;
+	arena->current = block;
+	return ARENA_DATA(block);
+}
+
+void swtArenaRelease(size_t mark)
+{
+	ARENA *arena = arenaGet(0);
+	ARENA_BLOCK *block;
+	if (arena == NULL || (block = arena->current) == NULL) return;
+	while (block->prev != NULL && mark <= block->start) {
+		block->used = 0;
+		block = block->prev;
+	}
+	block->used = mark > block->start ? mark - block->start : 0;
+	arena->current = block;
+	if (mark == 0) {
+		/* Leaving the outermost native, trim the cache to the first block */
+		ARENA_BLOCK *next = block->next;
+		block->next = NULL;
+		while (next != NULL) {
+			ARENA_BLOCK *temp = next->next;
+			free(next);
+			next = temp;
+		}
+	}
+}
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+
+/**
+ * benchmark.c
+ *
+ * This file contains the natives used by the performance tests to
+ * measure the cost of the JNI transitions that the generated bindings
+ * make: an empty call, pinning an array the way the generated natives
+ * do, and calling back into Java through a Callback.
+ */
+
+#include "swt.h"
+
+#include <stddef.h>
+
+#define BENCHMARK_NATIVE(func) Java_org_eclipse_swt_internal_Benchmark_##func
+
+typedef jintLong (CALLING_CONVENTION *CallbackProc)(jintLong);
+
+#ifndef NO_empty
+JNIEXPORT void JNICALL BENCHMARK_NATIVE(empty)
+	(JNIEnv *env, jclass that)
+{
+}
+#endif
+
+#ifndef NO_pin
+JNIEXPORT jint JNICALL BENCHMARK_NATIVE(pin)
+	(JNIEnv *env, jclass that, jbyteArray arg0)
+{
+	jbyte *lparg0 = NULL;
+	jint rc = 0;
+	if (arg0 == NULL) return -1;
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		if ((lparg0 = (*env)->GetPrimitiveArrayCritical(env, arg0, NULL)) == NULL) return -1;
+	} else
+#endif
+	{
+		if ((lparg0 = (*env)->GetByteArrayElements(env, arg0, NULL)) == NULL) return -1;
+	}
+	rc = lparg0[0];
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		(*env)->ReleasePrimitiveArrayCritical(env, arg0, lparg0, JNI_ABORT);
+	} else
+#endif
+	{
+		(*env)->ReleaseByteArrayElements(env, arg0, lparg0, JNI_ABORT);
+	}
+	return rc;
+}
+#endif
+
+#ifndef NO_call
+JNIEXPORT jintLong JNICALL BENCHMARK_NATIVE(call)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1)
+{
+	CallbackProc proc = (CallbackProc)arg0;
+	jintLong rc = 0;
+	jint i;
+	if (proc == NULL) return -1;
+	for (i = 0; i < arg1; i++) {
+		rc += proc((jintLong)i);
+	}
+	return rc;
+}
+#endif
@@ -0,0 +1,829 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+
+/**
+ * blit.c
+ *
+ * This file contains the pixel conversion kernels used by ImageData
+ * for byte aligned 24 and 32 bit direct palette images, and by the
+ * platform code to convert between native pixel formats.
+ *
+ * The vector paths are selected when the compiler targets them:
+ * AVX2 and SSSE3 use byte shuffles, SSE2 uses shifts and masks, and
+ * NEON uses interleaved loads and stores.  Every kernel falls back to
+ * scalar code for the remaining pixels of a row.
+ */
+
+#include "swt.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+#define BLIT_AVX2
+#endif
+#if defined(__AVX2__) || defined(__SSSE3__)
+#define BLIT_SSSE3
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BLIT_SSE2
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define BLIT_NEON
+#endif
+
+#if defined(BLIT_AVX2)
+#include <immintrin.h>
+#elif defined(BLIT_SSSE3)
+#include <tmmintrin.h>
+#elif defined(BLIT_SSE2)
+#include <emmintrin.h>
+#elif defined(BLIT_NEON)
+#include <arm_neon.h>
+#endif
+
+#define BLIT_NATIVE(func) Java_org_eclipse_swt_internal_Blit_##func
+
+/* Returns non zero if every row of the region lies inside the array */
+static int checkRegion(jsize length, jint offset, jint stride, jint rowBytes, jint height)
+{
+	jlong first = offset, last = offset + (jlong)(height - 1) * stride;
+	if (rowBytes < 0 || height <= 0) return 0;
+	if (first < 0 || last < 0) return 0;
+	if (first + rowBytes > length || last + rowBytes > length) return 0;
+	return 1;
+}
+
+/*
+* Unpacks a byte map for pixels of the given sizes.  Returns zero if a
+* size is not 3 or 4 or the map reads outside of a source pixel.
+*/
+static int parseMap(jint bits, jint sbpp, jint dbpp, int *map, int *identity)
+{
+	int k;
+	if (sbpp < 3 || sbpp > 4 || dbpp < 3 || dbpp > 4) return 0;
+	*identity = sbpp == dbpp;
+	for (k = 0; k < 4; k++) {
+		int index = (bits >> (k * 8)) & 0xFF;
+		map[k] = index == 0xFF ? -1 : index;
+		if (k < dbpp && map[k] >= sbpp) return 0;
+		if (k < dbpp && map[k] != k) *identity = 0;
+	}
+	return 1;
+}
+
+/*
+* Writes byte k of every destination pixel from byte map[k] of the
+* source pixel, or zero when map[k] is negative.
+*/
+static void shuffleRow(const unsigned char *src, int sbpp, unsigned char *dest, int dbpp, int width, const int *map)
+{
+	int x = 0, k;
+#if defined(BLIT_SSSE3)
+	if (sbpp >= 3 && dbpp >= 3) {
+		/* one 16 byte shuffle converts four pixels */
+		char bytes[16];
+		__m128i mask;
+		int i;
+		memset(bytes, 0x80, sizeof(bytes));
+		for (i = 0; i < 4; i++) {
+			for (k = 0; k < dbpp; k++) {
+				if (map[k] >= 0) bytes[i * dbpp + k] = (char)(i * sbpp + map[k]);
+			}
+		}
+		mask = _mm_loadu_si128((const __m128i *)bytes);
+		if (sbpp == 4 && dbpp == 4) {
+#if defined(BLIT_AVX2)
+			__m256i mask2 = _mm256_broadcastsi128_si256(mask);
+			for (; x + 8 <= width; x += 8) {
+				__m256i v = _mm256_loadu_si256((const __m256i *)(src + x * 4));
+				_mm256_storeu_si256((__m256i *)(dest + x * 4), _mm256_shuffle_epi8(v, mask2));
+			}
+#endif
+			for (; x + 4 <= width; x += 4) {
+				__m128i v = _mm_loadu_si128((const __m128i *)(src + x * 4));
+				_mm_storeu_si128((__m128i *)(dest + x * 4), _mm_shuffle_epi8(v, mask));
+			}
+		} else {
+			/*
+			* A 24 bit side only uses 12 of the 16 bytes loaded or stored,
+			* so stop early enough for both to stay inside the row.  The
+			* extra bytes stored are rewritten by the next pixels.
+			*/
+			for (; x + 6 <= width; x += 4) {
+				__m128i v = _mm_loadu_si128((const __m128i *)(src + x * sbpp));
+				_mm_storeu_si128((__m128i *)(dest + x * dbpp), _mm_shuffle_epi8(v, mask));
+			}
+		}
+	}
+#elif defined(BLIT_SSE2)
+	if (sbpp == 4 && dbpp == 4) {
+		__m128i right[4], left[4], low = _mm_set1_epi32(0xFF);
+		int count = 0, i;
+		for (k = 0; k < 4; k++) {
+			if (map[k] < 0) continue;
+			right[count] = _mm_cvtsi32_si128(map[k] * 8);
+			left[count] = _mm_cvtsi32_si128(k * 8);
+			count++;
+		}
+		for (; x + 4 <= width; x += 4) {
+			__m128i v = _mm_loadu_si128((const __m128i *)(src + x * 4));
+			__m128i result = _mm_setzero_si128();
+			for (i = 0; i < count; i++) {
+				__m128i t = _mm_and_si128(_mm_srl_epi32(v, right[i]), low);
+				result = _mm_or_si128(result, _mm_sll_epi32(t, left[i]));
+			}
+			_mm_storeu_si128((__m128i *)(dest + x * 4), result);
+		}
+	}
+#elif defined(BLIT_NEON)
+	if (sbpp >= 3 && dbpp >= 3) {
+		for (; x + 16 <= width; x += 16) {
+			uint8x16_t planes[4], out[4], zero = vdupq_n_u8(0);
+			if (sbpp == 4) {
+				uint8x16x4_t v = vld4q_u8(src + x * 4);
+				planes[0] = v.val[0]; planes[1] = v.val[1]; planes[2] = v.val[2]; planes[3] = v.val[3];
+			} else {
+				uint8x16x3_t v = vld3q_u8(src + x * 3);
+				planes[0] = v.val[0]; planes[1] = v.val[1]; planes[2] = v.val[2]; planes[3] = zero;
+			}
+			for (k = 0; k < dbpp; k++) out[k] = map[k] >= 0 ? planes[map[k]] : zero;
+			if (dbpp == 4) {
+				uint8x16x4_t w;
+				w.val[0] = out[0]; w.val[1] = out[1]; w.val[2] = out[2]; w.val[3] = out[3];
+				vst4q_u8(dest + x * 4, w);
+			} else {
+				uint8x16x3_t w;
+				w.val[0] = out[0]; w.val[1] = out[1]; w.val[2] = out[2];
+				vst3q_u8(dest + x * 3, w);
+			}
+		}
+	}
+#endif
+	for (; x < width; x++) {
+		const unsigned char *s = src + x * sbpp;
+		unsigned char *d = dest + x * dbpp;
+		for (k = 0; k < dbpp; k++) d[k] = map[k] >= 0 ? s[map[k]] : 0;
+	}
+}
+
+/* c * a / 255 rounded, the same approximation the platform images use */
+#define PREMULTIPLY(c, a) ((((c) * (a) + 128) + (((c) * (a) + 128) >> 8)) >> 8)
+
+static void premultiplyRow(unsigned char *data, int width, int alphaIndex)
+{
+	int x = 0, k;
+#if defined(BLIT_SSE2)
+	__m128i alphaLanes, round = _mm_set1_epi16(128), zero = _mm_setzero_si128();
+	switch (alphaIndex) {
+		case 0: alphaLanes = _mm_set_epi16(0, 0, 0, -1, 0, 0, 0, -1); break;
+		case 1: alphaLanes = _mm_set_epi16(0, 0, -1, 0, 0, 0, -1, 0); break;
+		case 2: alphaLanes = _mm_set_epi16(0, -1, 0, 0, 0, -1, 0, 0); break;
+		default: alphaLanes = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0); break;
+	}
+	for (; x + 4 <= width; x += 4) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(data + x * 4));
+		__m128i halves[2];
+		int h;
+		halves[0] = _mm_unpacklo_epi8(v, zero);
+		halves[1] = _mm_unpackhi_epi8(v, zero);
+		for (h = 0; h < 2; h++) {
+			__m128i c = halves[h], a, t;
+			switch (alphaIndex) {
+				case 0: a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(c, 0x00), 0x00); break;
+				case 1: a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(c, 0x55), 0x55); break;
+				case 2: a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(c, 0xAA), 0xAA); break;
+				default: a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(c, 0xFF), 0xFF); break;
+			}
+			t = _mm_add_epi16(_mm_mullo_epi16(c, a), round);
+			t = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+			halves[h] = _mm_or_si128(_mm_andnot_si128(alphaLanes, t), _mm_and_si128(alphaLanes, c));
+		}
+		_mm_storeu_si128((__m128i *)(data + x * 4), _mm_packus_epi16(halves[0], halves[1]));
+	}
+#elif defined(BLIT_NEON)
+	for (; x + 16 <= width; x += 16) {
+		uint8x16x4_t v = vld4q_u8(data + x * 4);
+		uint8x16_t a = v.val[alphaIndex];
+		uint16x8_t round = vdupq_n_u16(128);
+		for (k = 0; k < 4; k++) {
+			uint16x8_t lo, hi;
+			if (k == alphaIndex) continue;
+			lo = vaddq_u16(vmull_u8(vget_low_u8(v.val[k]), vget_low_u8(a)), round);
+			hi = vaddq_u16(vmull_u8(vget_high_u8(v.val[k]), vget_high_u8(a)), round);
+			lo = vaddq_u16(lo, vshrq_n_u16(lo, 8));
+			hi = vaddq_u16(hi, vshrq_n_u16(hi, 8));
+			v.val[k] = vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+		}
+		vst4q_u8(data + x * 4, v);
+	}
+#endif
+	for (; x < width; x++) {
+		unsigned char *p = data + x * 4;
+		int a = p[alphaIndex];
+		for (k = 0; k < 4; k++) {
+			if (k != alphaIndex) p[k] = (unsigned char)PREMULTIPLY(p[k], a);
+		}
+	}
+}
+
+/* Division does not vectorize usefully, so this kernel stays scalar */
+static void unpremultiplyRow(unsigned char *data, int width, int alphaIndex)
+{
+	int x, k;
+	for (x = 0; x < width; x++) {
+		unsigned char *p = data + x * 4;
+		int a = p[alphaIndex];
+		if (a == 0xFF) continue;
+		for (k = 0; k < 4; k++) {
+			if (k == alphaIndex) continue;
+			if (a == 0) {
+				p[k] = 0;
+			} else {
+				int c = (p[k] * 0xFF + a / 2) / a;
+				p[k] = (unsigned char)(c > 0xFF ? 0xFF : c);
+			}
+		}
+	}
+}
+
+#ifndef NO_shuffle
+JNIEXPORT jboolean JNICALL BLIT_NATIVE(shuffle)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jint arg3, jbyteArray arg4, jint arg5, jint arg6, jint arg7, jint arg8, jint arg9, jint arg10)
+{
+	jbyte *src = NULL, *dest = NULL;
+	int map[4], identity;
+	jint y;
+	if (arg0 == NULL || arg4 == NULL || arg8 <= 0) return JNI_FALSE;
+	if (!parseMap(arg10, arg3, arg7, map, &identity)) return JNI_FALSE;
+	if (!checkRegion((*env)->GetArrayLength(env, arg0), arg1, arg2, arg8 * arg3, arg9)) return JNI_FALSE;
+	if (!checkRegion((*env)->GetArrayLength(env, arg4), arg5, arg6, arg8 * arg7, arg9)) return JNI_FALSE;
+	if ((src = lockArray(env, arg0, 'B')) == NULL) return JNI_FALSE;
+	if ((dest = lockArray(env, arg4, 'B')) == NULL) {
+		unlockArray(env, arg0, src, 'B', JNI_ABORT);
+		return JNI_FALSE;
+	}
+	for (y = 0; y < arg9; y++) {
+		const unsigned char *s = (const unsigned char *)src + arg1 + (jlong)y * arg2;
+		unsigned char *d = (unsigned char *)dest + arg5 + (jlong)y * arg6;
+		if (identity) {
+			memmove(d, s, arg8 * arg3);
+		} else {
+			shuffleRow(s, arg3, d, arg7, arg8, map);
+		}
+	}
+	unlockArray(env, arg4, dest, 'B', 0);
+	unlockArray(env, arg0, src, 'B', JNI_ABORT);
+	return JNI_TRUE;
+}
+#endif
+
+#ifndef NO_premultiply
+JNIEXPORT jboolean JNICALL BLIT_NATIVE(premultiply)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5)
+{
+	jbyte *data = NULL;
+	jint y;
+	if (arg0 == NULL || arg3 <= 0 || arg5 < 0 || arg5 > 3) return JNI_FALSE;
+	if (!checkRegion((*env)->GetArrayLength(env, arg0), arg1, arg2, arg3 * 4, arg4)) return JNI_FALSE;
+	if ((data = lockArray(env, arg0, 'B')) == NULL) return JNI_FALSE;
+	for (y = 0; y < arg4; y++) {
+		premultiplyRow((unsigned char *)data + arg1 + (jlong)y * arg2, arg3, arg5);
+	}
+	unlockArray(env, arg0, data, 'B', 0);
+	return JNI_TRUE;
+}
+#endif
+
+#ifndef NO_unpremultiply
+JNIEXPORT jboolean JNICALL BLIT_NATIVE(unpremultiply)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5)
+{
+	jbyte *data = NULL;
+	jint y;
+	if (arg0 == NULL || arg3 <= 0 || arg5 < 0 || arg5 > 3) return JNI_FALSE;
+	if (!checkRegion((*env)->GetArrayLength(env, arg0), arg1, arg2, arg3 * 4, arg4)) return JNI_FALSE;
+	if ((data = lockArray(env, arg0, 'B')) == NULL) return JNI_FALSE;
+	for (y = 0; y < arg4; y++) {
+		unpremultiplyRow((unsigned char *)data + arg1 + (jlong)y * arg2, arg3, arg5);
+	}
+	unlockArray(env, arg0, data, 'B', 0);
+	return JNI_TRUE;
+}
+#endif
+
+#ifndef NO_mergeAlpha
+JNIEXPORT jboolean JNICALL BLIT_NATIVE(mergeAlpha)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jbyteArray arg6, jint arg7, jint arg8)
+{
+	jbyte *data = NULL, *alpha = NULL;
+	jint x, y;
+	if (arg0 == NULL || arg6 == NULL || arg3 <= 0 || arg5 < 0 || arg5 > 3) return JNI_FALSE;
+	if (!checkRegion((*env)->GetArrayLength(env, arg0), arg1, arg2, arg3 * 4, arg4)) return JNI_FALSE;
+	if (!checkRegion((*env)->GetArrayLength(env, arg6), arg7, arg8, arg3, arg4)) return JNI_FALSE;
+	if ((alpha = lockArray(env, arg6, 'B')) == NULL) return JNI_FALSE;
+	if ((data = lockArray(env, arg0, 'B')) == NULL) {
+		unlockArray(env, arg6, alpha, 'B', JNI_ABORT);
+		return JNI_FALSE;
+	}
+	/* A strided byte store is memory bound, the scalar loop is enough */
+	for (y = 0; y < arg4; y++) {
+		jbyte *d = data + arg1 + (jlong)y * arg2 + arg5;
+		const jbyte *a = alpha + arg7 + (jlong)y * arg8;
+		for (x = 0; x < arg3; x++) d[x * 4] = a[x];
+	}
+	unlockArray(env, arg0, data, 'B', 0);
+	unlockArray(env, arg6, alpha, 'B', JNI_ABORT);
+	return JNI_TRUE;
+}
+#endif
+
+/* Filters of scale(), as defined in Blit.java */
+#define BLIT_BILINEAR 1
+#define BLIT_BOX 2
+
+/*
+* Samples one axis at the destination pixel centers for the bilinear
+* filter.  index is the first source pixel and weight is the 8 bit
+* weight of the next one, clamped at the edges.
+*/
+static void bilinearAxis(jint srcSize, jint destSize, int *index, int *weight)
+{
+	jint i;
+	for (i = 0; i < destSize; i++) {
+		jlong pos = ((jlong)(2 * i + 1) * srcSize * 256) / (2 * (jlong)destSize) - 128;
+		if (pos < 0) pos = 0;
+		index[i] = (int)(pos >> 8);
+		weight[i] = (int)(pos & 0xFF);
+		if (index[i] >= srcSize - 1) {
+			index[i] = srcSize - 1;
+			weight[i] = 0;
+		}
+	}
+}
+
+/*
+* The weights are gathered per pixel, which does not vectorize usefully
+* for pixels of 1 to 4 bytes, so this kernel stays scalar.
+*/
+static void scaleBilinear(const unsigned char *src, jint srcStride, jint srcWidth, jint srcHeight, unsigned char *dest, jint destStride, jint destWidth, jint destHeight, jint bpp, int *buffer)
+{
+	int *xIndex = buffer, *xWeight = buffer + destWidth;
+	int *yIndex = xWeight + destWidth, *yWeight = yIndex + destHeight;
+	jint x, y, k;
+	bilinearAxis(srcWidth, destWidth, xIndex, xWeight);
+	bilinearAxis(srcHeight, destHeight, yIndex, yWeight);
+	for (y = 0; y < destHeight; y++) {
+		const unsigned char *row0 = src + (jlong)yIndex[y] * srcStride;
+		const unsigned char *row1 = yWeight[y] != 0 ? row0 + srcStride : row0;
+		unsigned char *d = dest + (jlong)y * destStride;
+		int wy = yWeight[y];
+		for (x = 0; x < destWidth; x++) {
+			int i0 = xIndex[x] * bpp, i1 = xWeight[x] != 0 ? i0 + bpp : i0;
+			int wx = xWeight[x];
+			for (k = 0; k < bpp; k++) {
+				int top = row0[i0 + k] * 256 + (row0[i1 + k] - row0[i0 + k]) * wx;
+				int bottom = row1[i0 + k] * 256 + (row1[i1 + k] - row1[i0 + k]) * wx;
+				d[k] = (unsigned char)((top * 256 + (bottom - top) * wy + 32768) >> 16);
+			}
+			d += bpp;
+		}
+	}
+}
+
+/* Averages the source pixels covered by each destination pixel */
+static void scaleBox(const unsigned char *src, jint srcStride, jint srcWidth, jint srcHeight, unsigned char *dest, jint destStride, jint destWidth, jint destHeight, jint bpp)
+{
+	jint x, y, k, sx, sy;
+	for (y = 0; y < destHeight; y++) {
+		jint y0 = (jint)((jlong)y * srcHeight / destHeight);
+		jint y1 = (jint)((jlong)(y + 1) * srcHeight / destHeight);
+		unsigned char *d = dest + (jlong)y * destStride;
+		if (y1 <= y0) y1 = y0 + 1;
+		for (x = 0; x < destWidth; x++) {
+			jint x0 = (jint)((jlong)x * srcWidth / destWidth);
+			jint x1 = (jint)((jlong)(x + 1) * srcWidth / destWidth);
+			unsigned int sum[4] = {0, 0, 0, 0}, count;
+			if (x1 <= x0) x1 = x0 + 1;
+			for (sy = y0; sy < y1; sy++) {
+				const unsigned char *s = src + (jlong)sy * srcStride + x0 * bpp;
+				for (sx = x0; sx < x1; sx++) {
+					for (k = 0; k < bpp; k++) sum[k] += s[k];
+					s += bpp;
+				}
+			}
+			count = (unsigned int)((x1 - x0) * (y1 - y0));
+			for (k = 0; k < bpp; k++) d[k] = (unsigned char)((sum[k] + count / 2) / count);
+			d += bpp;
+		}
+	}
+}
+
+#ifndef NO_scale
+JNIEXPORT jboolean JNICALL BLIT_NATIVE(scale)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jint arg3, jint arg4, jbyteArray arg5, jint arg6, jint arg7, jint arg8, jint arg9, jint arg10, jint arg11)
+{
+	jbyte *src = NULL, *dest = NULL;
+	int *buffer = NULL;
+	if (arg0 == NULL || arg5 == NULL || (*env)->IsSameObject(env, arg0, arg5)) return JNI_FALSE;
+	if (arg3 <= 0 || arg4 <= 0 || arg8 <= 0 || arg9 <= 0 || arg10 < 1 || arg10 > 4) return JNI_FALSE;
+	if (arg11 != BLIT_BILINEAR && arg11 != BLIT_BOX) return JNI_FALSE;
+	if (!checkRegion((*env)->GetArrayLength(env, arg0), arg1, arg2, arg3 * arg10, arg4)) return JNI_FALSE;
+	if (!checkRegion((*env)->GetArrayLength(env, arg5), arg6, arg7, arg8 * arg10, arg9)) return JNI_FALSE;
+	if (arg11 == BLIT_BILINEAR) {
+		if ((buffer = (int *)malloc(sizeof(int) * 2 * ((size_t)arg8 + arg9))) == NULL) return JNI_FALSE;
+	}
+	if ((src = lockArray(env, arg0, 'B')) == NULL) {
+		free(buffer);
+		return JNI_FALSE;
+	}
+	if ((dest = lockArray(env, arg5, 'B')) == NULL) {
+		unlockArray(env, arg0, src, 'B', JNI_ABORT);
+		free(buffer);
+		return JNI_FALSE;
+	}
+	if (arg11 == BLIT_BILINEAR) {
+		scaleBilinear((unsigned char *)src + arg1, arg2, arg3, arg4, (unsigned char *)dest + arg6, arg7, arg8, arg9, arg10, buffer);
+	} else {
+		scaleBox((unsigned char *)src + arg1, arg2, arg3, arg4, (unsigned char *)dest + arg6, arg7, arg8, arg9, arg10);
+	}
+	unlockArray(env, arg5, dest, 'B', 0);
+	unlockArray(env, arg0, src, 'B', JNI_ABORT);
+	free(buffer);
+	return JNI_TRUE;
+}
+#endif
+
+/*
+* The pixels of ImageData are stored most significant byte first for
+* 24 and 32 bit, least significant byte first for 16 bit and most
+* significant bits first within a byte below 8 bit.  The vector paths
+* assume a little endian target, where a 32 bit pixel is its bytes
+* reversed.
+*/
+#if (defined(BLIT_SSE2) || defined(BLIT_NEON)) && !defined(__BIG_ENDIAN__) && !defined(__ARMEB__)
+#define BLIT_PIXELS_VECTOR
+#endif
+
+/* Reads count pixels of a row starting at pixel x */
+static void unpackPixels(const unsigned char *row, jint depth, jint x, jint count, jint *pixels)
+{
+	jint i = 0;
+	switch (depth) {
+		case 32: {
+			const unsigned char *s = row + x * 4;
+#if defined(BLIT_PIXELS_VECTOR) && defined(BLIT_SSSE3)
+			__m128i swap = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+			for (; i + 4 <= count; i += 4) {
+				__m128i v = _mm_loadu_si128((const __m128i *)(s + i * 4));
+				_mm_storeu_si128((__m128i *)(pixels + i), _mm_shuffle_epi8(v, swap));
+			}
+#elif defined(BLIT_PIXELS_VECTOR) && defined(BLIT_NEON)
+			for (; i + 4 <= count; i += 4) {
+				uint8x16_t v = vrev32q_u8(vld1q_u8(s + i * 4));
+				vst1q_s32(pixels + i, vreinterpretq_s32_u8(v));
+			}
+#endif
+			for (; i < count; i++) {
+				const unsigned char *p = s + i * 4;
+				pixels[i] = (jint)(((unsigned int)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3]);
+			}
+			break;
+		}
+		case 24: {
+			const unsigned char *s = row + x * 3;
+			for (; i < count; i++, s += 3) pixels[i] = (s[0] << 16) | (s[1] << 8) | s[2];
+			break;
+		}
+		case 16: {
+			const unsigned char *s = row + x * 2;
+			for (; i < count; i++, s += 2) pixels[i] = s[0] | (s[1] << 8);
+			break;
+		}
+		case 8: {
+			const unsigned char *s = row + x;
+#if defined(BLIT_PIXELS_VECTOR) && defined(BLIT_SSE2)
+			__m128i zero = _mm_setzero_si128();
+			for (; i + 16 <= count; i += 16) {
+				__m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+				__m128i lo = _mm_unpacklo_epi8(v, zero), hi = _mm_unpackhi_epi8(v, zero);
+				_mm_storeu_si128((__m128i *)(pixels + i), _mm_unpacklo_epi16(lo, zero));
+				_mm_storeu_si128((__m128i *)(pixels + i + 4), _mm_unpackhi_epi16(lo, zero));
+				_mm_storeu_si128((__m128i *)(pixels + i + 8), _mm_unpacklo_epi16(hi, zero));
+				_mm_storeu_si128((__m128i *)(pixels + i + 12), _mm_unpackhi_epi16(hi, zero));
+			}
+#elif defined(BLIT_PIXELS_VECTOR) && defined(BLIT_NEON)
+			for (; i + 16 <= count; i += 16) {
+				uint8x16_t v = vld1q_u8(s + i);
+				uint16x8_t lo = vmovl_u8(vget_low_u8(v)), hi = vmovl_u8(vget_high_u8(v));
+				vst1q_s32(pixels + i, vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(lo))));
+				vst1q_s32(pixels + i + 4, vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(lo))));
+				vst1q_s32(pixels + i + 8, vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(hi))));
+				vst1q_s32(pixels + i + 12, vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(hi))));
+			}
+#endif
+			for (; i < count; i++) pixels[i] = s[i];
+			break;
+		}
+		default: {
+			jint mask = (1 << depth) - 1;
+			for (; i < count; i++) {
+				jint bit = (x + i) * depth;
+				pixels[i] = (row[bit >> 3] >> (8 - depth - (bit & 7))) & mask;
+			}
+			break;
+		}
+	}
+}
+
+/* Writes count pixels of a row starting at pixel x, keeping the other bits of partial bytes */
+static void packPixels(unsigned char *row, jint depth, jint x, jint count, const jint *pixels)
+{
+	jint i = 0;
+	switch (depth) {
+		case 32: {
+			unsigned char *d = row + x * 4;
+#if defined(BLIT_PIXELS_VECTOR) && defined(BLIT_SSSE3)
+			__m128i swap = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+			for (; i + 4 <= count; i += 4) {
+				__m128i v = _mm_loadu_si128((const __m128i *)(pixels + i));
+				_mm_storeu_si128((__m128i *)(d + i * 4), _mm_shuffle_epi8(v, swap));
+			}
+#elif defined(BLIT_PIXELS_VECTOR) && defined(BLIT_NEON)
+			for (; i + 4 <= count; i += 4) {
+				uint8x16_t v = vrev32q_u8(vreinterpretq_u8_s32(vld1q_s32(pixels + i)));
+				vst1q_u8(d + i * 4, v);
+			}
+#endif
+			for (; i < count; i++) {
+				unsigned char *p = d + i * 4;
+				p[0] = (unsigned char)(pixels[i] >> 24);
+				p[1] = (unsigned char)(pixels[i] >> 16);
+				p[2] = (unsigned char)(pixels[i] >> 8);
+				p[3] = (unsigned char)pixels[i];
+			}
+			break;
+		}
+		case 24: {
+			unsigned char *d = row + x * 3;
+			for (; i < count; i++, d += 3) {
+				d[0] = (unsigned char)(pixels[i] >> 16);
+				d[1] = (unsigned char)(pixels[i] >> 8);
+				d[2] = (unsigned char)pixels[i];
+			}
+			break;
+		}
+		case 16: {
+			unsigned char *d = row + x * 2;
+			for (; i < count; i++, d += 2) {
+				d[0] = (unsigned char)pixels[i];
+				d[1] = (unsigned char)(pixels[i] >> 8);
+			}
+			break;
+		}
+		case 8: {
+			unsigned char *d = row + x;
+#if defined(BLIT_PIXELS_VECTOR) && defined(BLIT_SSE2)
+			__m128i low = _mm_set1_epi32(0xFF);
+			for (; i + 16 <= count; i += 16) {
+				__m128i a = _mm_and_si128(_mm_loadu_si128((const __m128i *)(pixels + i)), low);
+				__m128i b = _mm_and_si128(_mm_loadu_si128((const __m128i *)(pixels + i + 4)), low);
+				__m128i c = _mm_and_si128(_mm_loadu_si128((const __m128i *)(pixels + i + 8)), low);
+				__m128i e = _mm_and_si128(_mm_loadu_si128((const __m128i *)(pixels + i + 12)), low);
+				__m128i v = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, e));
+				_mm_storeu_si128((__m128i *)(d + i), v);
+			}
+#elif defined(BLIT_PIXELS_VECTOR) && defined(BLIT_NEON)
+			for (; i + 16 <= count; i += 16) {
+				uint16x8_t lo = vcombine_u16(vmovn_u32(vreinterpretq_u32_s32(vld1q_s32(pixels + i))), vmovn_u32(vreinterpretq_u32_s32(vld1q_s32(pixels + i + 4))));
+				uint16x8_t hi = vcombine_u16(vmovn_u32(vreinterpretq_u32_s32(vld1q_s32(pixels + i + 8))), vmovn_u32(vreinterpretq_u32_s32(vld1q_s32(pixels + i + 12))));
+				vst1q_u8(d + i, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+			}
+#endif
+			for (; i < count; i++) d[i] = (unsigned char)pixels[i];
+			break;
+		}
+		default: {
+			jint mask = (1 << depth) - 1;
+			for (; i < count; i++) {
+				jint bit = (x + i) * depth, shift = 8 - depth - (bit & 7);
+				unsigned char *d = row + (bit >> 3);
+				*d = (unsigned char)((*d & ~(mask << shift)) | ((pixels[i] & mask) << shift));
+			}
+			break;
+		}
+	}
+}
+
+/*
+* Checks the arguments of getPixels() and setPixels().  Every row from
+* y to the row of the last pixel must be complete in data, so a span
+* that would run off the end is left to the Java code to report.
+*/
+static int checkPixels(JNIEnv *env, jbyteArray data, jint bytesPerLine, jint width, jint depth, jint x, jint y, jint count, jintArray pixels, jint startIndex)
+{
+	jlong offset, lastRow;
+	if (data == NULL || pixels == NULL || bytesPerLine <= 0) return 0;
+	if (depth != 1 && depth != 2 && depth != 4 && depth != 8 && depth != 16 && depth != 24 && depth != 32) return 0;
+	if (width <= 0 || x < 0 || x >= width || y < 0 || count <= 0 || startIndex < 0) return 0;
+	if ((jlong)startIndex + count > (*env)->GetArrayLength(env, pixels)) return 0;
+	lastRow = y + ((jlong)x + count - 1) / width;
+	offset = (jlong)y * bytesPerLine;
+	if (lastRow > 0x7FFFFFFF || offset > 0x7FFFFFFF) return 0;
+	return checkRegion((*env)->GetArrayLength(env, data), (jint)offset, bytesPerLine, (jint)(((jlong)width * depth + 7) / 8), (jint)(lastRow - y + 1));
+}
+
+#ifndef NO_getPixels
+JNIEXPORT jboolean JNICALL BLIT_NATIVE(getPixels)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6, jintArray arg7, jint arg8)
+{
+	jbyte *data = NULL;
+	jint *pixels = NULL;
+	jint x = arg4, y = arg5, n = arg6, i = arg8;
+	if (!checkPixels(env, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8)) return JNI_FALSE;
+	if ((data = lockArray(env, arg0, 'B')) == NULL) return JNI_FALSE;
+	if ((pixels = lockArray(env, arg7, 'I')) == NULL) {
+		unlockArray(env, arg0, data, 'B', JNI_ABORT);
+		return JNI_FALSE;
+	}
+	while (n > 0) {
+		jint span = arg2 - x < n ? arg2 - x : n;
+		unpackPixels((unsigned char *)data + (jlong)y * arg1, arg3, x, span, pixels + i);
+		i += span;
+		n -= span;
+		x = 0;
+		y++;
+	}
+	unlockArray(env, arg7, pixels, 'I', 0);
+	unlockArray(env, arg0, data, 'B', JNI_ABORT);
+	return JNI_TRUE;
+}
+#endif
+
+#ifndef NO_setPixels
+JNIEXPORT jboolean JNICALL BLIT_NATIVE(setPixels)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jint arg6, jintArray arg7, jint arg8)
+{
+	jbyte *data = NULL;
+	jint *pixels = NULL;
+	jint x = arg4, y = arg5, n = arg6, i = arg8;
+	if (!checkPixels(env, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8)) return JNI_FALSE;
+	if ((data = lockArray(env, arg0, 'B')) == NULL) return JNI_FALSE;
+	if ((pixels = lockArray(env, arg7, 'I')) == NULL) {
+		unlockArray(env, arg0, data, 'B', JNI_ABORT);
+		return JNI_FALSE;
+	}
+	while (n > 0) {
+		jint span = arg2 - x < n ? arg2 - x : n;
+		packPixels((unsigned char *)data + (jlong)y * arg1, arg3, x, span, pixels + i);
+		i += span;
+		n -= span;
+		x = 0;
+		y++;
+	}
+	unlockArray(env, arg7, pixels, 'I', JNI_ABORT);
+	unlockArray(env, arg0, data, 'B', 0);
+	return JNI_TRUE;
+}
+#endif
+
+/* Flags of convert() and convertToArray(), as defined in Blit.java */
+#define BLIT_PREMULTIPLY 1
+#define BLIT_UNPREMULTIPLY 2
+
+/*
+* Converts rows of pixels in one pass.  When the source has an alpha
+* byte, each row is copied to row, premultiplied or unpremultiplied
+* there, and its alpha bytes are stored into alpha, before the bytes
+* are rearranged into the destination.  In that case the source and
+* destination may also be the same memory.
+*/
+static void convertRows(const unsigned char *src, jint srcStride, jint sbpp, unsigned char *dest, jint destStride, jint dbpp, jint width, jint height, const int *map, int identity, jint alphaIndex, jint flags, unsigned char *alpha, jint alphaStride, unsigned char *row)
+{
+	jint x, y;
+	for (y = 0; y < height; y++) {
+		const unsigned char *s = src + (jlong)y * srcStride;
+		unsigned char *d = dest + (jlong)y * destStride;
+		if (row != NULL) {
+			memcpy(row, s, width * 4);
+			if (flags & BLIT_UNPREMULTIPLY) unpremultiplyRow(row, width, alphaIndex);
+			if (flags & BLIT_PREMULTIPLY) premultiplyRow(row, width, alphaIndex);
+			if (alpha != NULL) {
+				unsigned char *a = alpha + (jlong)y * alphaStride;
+				for (x = 0; x < width; x++) a[x] = row[x * 4 + alphaIndex];
+			}
+			s = row;
+		}
+		if (identity) {
+			memmove(d, s, width * sbpp);
+		} else {
+			shuffleRow(s, sbpp, d, dbpp, width, map);
+		}
+	}
+}
+
+/* Checks the alpha arguments of convert() and convertToArray() */
+static int checkAlpha(JNIEnv *env, jint sbpp, jint width, jint height, jint alphaIndex, jint flags, jbyteArray alpha, jint alphaOffset, jint alphaStride, int *useRow)
+{
+	*useRow = flags != 0 || alpha != NULL;
+	if (flags & ~(BLIT_PREMULTIPLY | BLIT_UNPREMULTIPLY)) return 0;
+	if (!*useRow) return 1;
+	if (sbpp != 4 || alphaIndex < 0 || alphaIndex > 3) return 0;
+	if (alpha != NULL && !checkRegion((*env)->GetArrayLength(env, alpha), alphaOffset, alphaStride, width, height)) return 0;
+	return 1;
+}
+
+#ifndef NO_convert
+JNIEXPORT jboolean JNICALL BLIT_NATIVE(convert)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jintLong arg3, jint arg4, jint arg5, jint arg6, jint arg7, jint arg8, jint arg9, jint arg10, jbyteArray arg11, jint arg12, jint arg13)
+{
+	jbyte *alpha = NULL;
+	unsigned char *row = NULL;
+	int map[4], identity, useRow;
+	if (arg0 == 0 || arg3 == 0 || arg6 <= 0 || arg7 <= 0) return JNI_FALSE;
+	if (!parseMap(arg8, arg2, arg5, map, &identity)) return JNI_FALSE;
+	if (!checkAlpha(env, arg2, arg6, arg7, arg9, arg10, arg11, arg12, arg13, &useRow)) return JNI_FALSE;
+	if (useRow && (row = malloc(arg6 * 4)) == NULL) return JNI_FALSE;
+	if (arg11 != NULL && (alpha = lockArray(env, arg11, 'B')) == NULL) {
+		free(row);
+		return JNI_FALSE;
+	}
+	convertRows((const unsigned char *)arg0, arg1, arg2, (unsigned char *)arg3, arg4, arg5, arg6, arg7, map, identity, arg9, arg10, alpha != NULL ? (unsigned char *)alpha + arg12 : NULL, arg13, row);
+	if (alpha != NULL) unlockArray(env, arg11, alpha, 'B', 0);
+	free(row);
+	return JNI_TRUE;
+}
+#endif
+
+#ifndef NO_convertToArray
+JNIEXPORT jboolean JNICALL BLIT_NATIVE(convertToArray)
+	(JNIEnv *env, jclass that, jintLong arg0, jint arg1, jint arg2, jbyteArray arg3, jint arg4, jint arg5, jint arg6, jint arg7, jint arg8, jint arg9, jint arg10, jint arg11, jbyteArray arg12, jint arg13, jint arg14)
+{
+	jbyte *dest = NULL, *alpha = NULL;
+	unsigned char *row = NULL;
+	int map[4], identity, useRow;
+	if (arg0 == 0 || arg3 == NULL || arg7 <= 0 || arg8 <= 0) return JNI_FALSE;
+	if (!parseMap(arg9, arg2, arg6, map, &identity)) return JNI_FALSE;
+	if (!checkRegion((*env)->GetArrayLength(env, arg3), arg4, arg5, arg7 * arg6, arg8)) return JNI_FALSE;
+	if (!checkAlpha(env, arg2, arg7, arg8, arg10, arg11, arg12, arg13, arg14, &useRow)) return JNI_FALSE;
+	if (useRow && (row = malloc(arg7 * 4)) == NULL) return JNI_FALSE;
+	if ((dest = lockArray(env, arg3, 'B')) == NULL) {
+		free(row);
+		return JNI_FALSE;
+	}
+	if (arg12 != NULL && (alpha = lockArray(env, arg12, 'B')) == NULL) {
+		unlockArray(env, arg3, dest, 'B', JNI_ABORT);
+		free(row);
+		return JNI_FALSE;
+	}
+	convertRows((const unsigned char *)arg0, arg1, arg2, (unsigned char *)dest + arg4, arg5, arg6, arg7, arg8, map, identity, arg10, arg11, alpha != NULL ? (unsigned char *)alpha + arg13 : NULL, arg14, row);
+	if (alpha != NULL) unlockArray(env, arg12, alpha, 'B', 0);
+	unlockArray(env, arg3, dest, 'B', 0);
+	free(row);
+	return JNI_TRUE;
+}
+#endif
+
+/* Flags of C.memmove2D(), as defined in C.java */
+#define MEMMOVE_FLIP 1
+#define MEMMOVE_SWIZZLE 2
+
+/*
+* Copies rows bytes wide from src to dest, taking the source rows bottom
+* up with MEMMOVE_FLIP and rearranging the bytes of each 4 byte pixel
+* by map, in the format of Blit.shuffle(), with MEMMOVE_SWIZZLE.  Only a
+* plain copy may overlap.  Returns zero if the arguments are not valid.
+*/
+jboolean swtMemmove2D(void *dest, jint destStride, const void *src, jint srcStride, jint rowBytes, jint rows, jint map, jint flags)
+{
+	int byteMap[4], identity = 1;
+	jint y;
+	if (dest == NULL || src == NULL || rowBytes < 0 || rows < 0) return JNI_FALSE;
+	if (flags & ~(MEMMOVE_FLIP | MEMMOVE_SWIZZLE)) return JNI_FALSE;
+	if (flags & MEMMOVE_SWIZZLE) {
+		if ((rowBytes & 3) != 0 || !parseMap(map, 4, 4, byteMap, &identity)) return JNI_FALSE;
+	}
+	if (identity && !(flags & MEMMOVE_FLIP) && srcStride == rowBytes && destStride == rowBytes) {
+		memmove(dest, src, (size_t)rowBytes * rows);
+		return JNI_TRUE;
+	}
+	for (y = 0; y < rows; y++) {
+		jint row = (flags & MEMMOVE_FLIP) ? rows - 1 - y : y;
+		const unsigned char *s = (const unsigned char *)src + (jlong)row * srcStride;
+		unsigned char *d = (unsigned char *)dest + (jlong)y * destStride;
+		if (identity) {
+			memmove(d, s, rowBytes);
+		} else {
+			shuffleRow(s, 4, d, 4, rowBytes / 4, byteMap);
+		}
+	}
+	return JNI_TRUE;
+}
@@ -13,6 +13,7 @@
  * Callback implementation.
  */
 #include "callback.h"
+#include <stdlib.h>
 #include <string.h>
 
 #ifndef CALLBACK_NATIVE
@@ -25,35 +26,662 @@
 /* --------------- callback globals ----------------- */
 
 static JavaVM *jvm = NULL;
-static CALLBACK_DATA callbackData[MAX_CALLBACKS];
-static int callbackEnabled = 1;
-static int callbackEntryCount = 0;
+static CALLBACK_CHUNK *callbackChunks = NULL;
+static volatile int callbackChunkCount = 0;
+static int callbackChunkCapacity = 0;
+static int callbackFreeSlot = -1;
+static int callbackRetiredSlot = -1;
+static jfieldID slotID = NULL;
+static volatile int callbackEnabled = 1;
+static volatile int callbackEntryCount = 0;
+static volatile int callbackStatsEnabled = 0;
 static int initialized = 0;
 static jint JNI_VERSION = 0;
 
+#define CALLBACK_SLOT(index) (&callbackChunks[(index) / MAX_CALLBACKS].data[(index) % MAX_CALLBACKS])
+
 #ifdef DEBUG_CALL_PRINTS
 static int counter = 0;
 #endif
 
-#ifdef ATOMIC
+/*
+* Bind, unbind and reset are serialized by the Callback class, but
+* callbacks are dispatched from any thread without locking. ATOMIC_INC,
+* ATOMIC_DEC and ATOMIC_STORE are full barriers, ATOMIC_LOAD is a plain
+* volatile read.
+*/
+#if defined (_WIN32) || defined (_WIN32_WCE)
+#define ATOMIC_INC(value) InterlockedIncrement((LONG volatile *)&value);
+#define ATOMIC_DEC(value) InterlockedDecrement((LONG volatile *)&value);
+#define MEMORY_BARRIER() { LONG barrier; InterlockedExchange(&barrier, 0); }
+#elif defined ATOMIC
 #include <libkern/OSAtomic.h>
-#define ATOMIC_INC(value) OSAtomicIncrement32(&value);
-#define ATOMIC_DEC(value) OSAtomicDecrement32(&value);
+#define ATOMIC_INC(value) OSAtomicIncrement32Barrier(&value);
+#define ATOMIC_DEC(value) OSAtomicDecrement32Barrier(&value);
+#define MEMORY_BARRIER() OSMemoryBarrier();
+#elif defined (__GNUC__)
+#define ATOMIC_INC(value) __sync_add_and_fetch(&value, 1);
+#define ATOMIC_DEC(value) __sync_sub_and_fetch(&value, 1);
+#define MEMORY_BARRIER() __sync_synchronize();
 #else
 #define ATOMIC_INC(value) value++;
 #define ATOMIC_DEC(value) value--;
+#define MEMORY_BARRIER()
+#endif
+#define ATOMIC_STORE(value, newValue) MEMORY_BARRIER(); value = newValue; MEMORY_BARRIER();
+#define ATOMIC_LOAD(value) (*(volatile int *)&(value))
+
+#ifdef JNI64
+#define INT_LONG_VALUE(value) (value).j
+#else
+#define INT_LONG_VALUE(value) (value).i
 #endif
 
+#define MAX_FAST_ARGS 6
+
 jintLong callback(int index, ...);
+static jintLong callback0(int index);
+static jintLong callback1(int index, jintLong p1);
+static jintLong callback2(int index, jintLong p1, jintLong p2);
+static jintLong callback3(int index, jintLong p1, jintLong p2, jintLong p3);
+static jintLong callback4(int index, jintLong p1, jintLong p2, jintLong p3, jintLong p4);
+static jintLong callback5(int index, jintLong p1, jintLong p2, jintLong p3, jintLong p4, jintLong p5);
+static jintLong callback6(int index, jintLong p1, jintLong p2, jintLong p3, jintLong p4, jintLong p5, jintLong p6);
+
+/* --------------- callback thread data ----------------- */
+
+/*
+* The JNIEnv of a native thread that had to be attached to the VM
+* is kept in thread local storage, so that further callbacks on the
+* same thread do not attach and detach again. The thread is detached
+* by the destructor of the thread key when it exits. On Windows, the
+* only notification of a thread exit is DLL_THREAD_DETACH, which runs
+* under the loader lock where the VM must not be called, so threads
+* are not kept attached there.
+*
+* The argument arrays of array based callbacks are cached per thread,
+* for each argument count and nesting level, but only on threads that
+* are kept attached here. The arrays of a thread owned by the VM could
+* not be released once the VM has detached it.
+*
+* Each thread also counts its own entries and can disable the callbacks
+* it receives, so that the user-interface threads of several displays
+* do not see each other.
+*/
+#define MAX_ARRAY_DEPTH 4
+
+typedef struct CALLBACK_THREAD {
+	JNIEnv *env;
+	int disabled;
+	int entryCount;
+	int depth[MAX_ARGS + 1];
+	jintLongArray arrays[MAX_ARGS + 1][MAX_ARRAY_DEPTH];
+} CALLBACK_THREAD;
+
+#if defined (_WIN32) || defined (_WIN32_WCE)
+static DWORD threadKey = TLS_OUT_OF_INDEXES;
+#define THREAD_KEY_CREATED (threadKey != TLS_OUT_OF_INDEXES)
+#define GET_THREAD_DATA() ((CALLBACK_THREAD *)TlsGetValue(threadKey))
+#define SET_THREAD_DATA(data) TlsSetValue(threadKey, (LPVOID)data)
+#else
+#include <pthread.h>
+static pthread_key_t threadKey;
+static int threadKeyCreated = 0;
+#define THREAD_KEY_CREATED threadKeyCreated
+#define GET_THREAD_DATA() ((CALLBACK_THREAD *)pthread_getspecific(threadKey))
+#define SET_THREAD_DATA(data) pthread_setspecific(threadKey, (void *)data)
+#endif
+
+#if !(defined (_WIN32) || defined (_WIN32_WCE))
+static void freeThreadData(void *data)
+{
+	int i, j;
+	CALLBACK_THREAD *thread = (CALLBACK_THREAD *)data;
+	JNIEnv *env = thread->env;
+	if (env != NULL) {
+		for (i=0; i<=MAX_ARGS; i++) {
+			for (j=0; j<MAX_ARRAY_DEPTH; j++) {
+				if (thread->arrays[i][j] != NULL) (*env)->DeleteGlobalRef(env, thread->arrays[i][j]);
+			}
+		}
+		(*jvm)->DetachCurrentThread(jvm);
+	}
+	free(thread);
+}
+#endif
+
+static void createThreadKey()
+{
+	if (THREAD_KEY_CREATED) return;
+#if defined (_WIN32) || defined (_WIN32_WCE)
+	threadKey = TlsAlloc();
+#else
+	if (pthread_key_create(&threadKey, freeThreadData) == 0) threadKeyCreated = 1;
+#endif
+}
+
+static CALLBACK_THREAD *newThreadData()
+{
+	CALLBACK_THREAD *thread;
+	if (!THREAD_KEY_CREATED) return NULL;
+	if ((thread = (CALLBACK_THREAD *)calloc(1, sizeof(CALLBACK_THREAD))) == NULL) return NULL;
+	SET_THREAD_DATA(thread);
+	return thread;
+}
+
+static CALLBACK_THREAD *getThreadData(int create)
+{
+	CALLBACK_THREAD *thread;
+	if (!THREAD_KEY_CREATED) return NULL;
+	thread = GET_THREAD_DATA();
+	if (thread == NULL && create) thread = newThreadData();
+	return thread;
+}
+
+void callback_thread_detach()
+{
+#if defined (_WIN32) || defined (_WIN32_WCE)
+	CALLBACK_THREAD *thread;
+	if (!THREAD_KEY_CREATED) return;
+	thread = GET_THREAD_DATA();
+	if (thread != NULL) {
+		/* The thread was never kept attached, so only its memory is released */
+		SET_THREAD_DATA(NULL);
+		free(thread);
+	}
+#endif
+}
 
 #ifdef USE_ASSEMBLER
 
 #if !(defined (_WIN32) || defined (_WIN32_WCE))
 #include <sys/mman.h>
 #endif
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+static const jintLong fastCallbacks[MAX_FAST_ARGS + 1] = {
+	(jintLong)callback0,
+	(jintLong)callback1,
+	(jintLong)callback2,
+	(jintLong)callback3,
+	(jintLong)callback4,
+	(jintLong)callback5,
+	(jintLong)callback6,
+};
 
-static unsigned char *callbackCode = NULL;
+#ifdef THUNK_X86
 #define CALLBACK_THUNK_SIZE 64
+#else
+#define CALLBACK_THUNK_SIZE 128
+#endif
+#define CALLBACK_CODE(index) (callbackChunks[(index) / MAX_CALLBACKS].code + ((index) % MAX_CALLBACKS) * CALLBACK_THUNK_SIZE)
+#define CALLBACK_WRITE_CODE(index) (callbackChunks[(index) / MAX_CALLBACKS].writeCode + ((index) % MAX_CALLBACKS) * CALLBACK_THUNK_SIZE)
+
+#ifdef THUNK_WIN64
+/* the unwind info shared by all thunks is stored after the thunks of a chunk */
+#define CALLBACK_CODE_SIZE (CALLBACK_THUNK_SIZE * MAX_CALLBACKS + sizeof(thunkUnwindInfo))
+#else
+#define CALLBACK_CODE_SIZE (CALLBACK_THUNK_SIZE * MAX_CALLBACKS)
+#endif
+
+/* Darwin on AArch64 only allows writable and executable pages mapped for JIT */
+#if defined (__APPLE__) && defined (THUNK_AARCH64)
+#include <pthread.h>
+#define BEGIN_WRITE_CODE() pthread_jit_write_protect_np(0)
+#define END_WRITE_CODE() pthread_jit_write_protect_np(1)
+#else
+#define BEGIN_WRITE_CODE()
+#define END_WRITE_CODE()
+#endif
+#ifndef MAP_JIT
+#define MAP_JIT 0
+#endif
+
+/*
+* Each thunk calls the dispatcher with its slot index as the first
+* argument, followed by the arguments it was called with. The variadic
+* flag tells whether the dispatcher takes variable arguments. Returns
+* the number of bytes written.
+*/
+#ifdef THUNK_X86
+static int emitThunk(unsigned char *code, int index, int argCount, jintLong target, int variadic)
+{
+	int j = 0, k;
+#ifdef __APPLE__
+	int pad = 0;
+#endif
+
+	//PUSH EBP - 1 byte
+	code[j++] = 0x55;
+
+	//MOV EBP,ESP - 2 bytes
+	code[j++] = 0x8b;
+	code[j++] = 0xec;
+
+#ifdef __APPLE__
+	/* darwin calling conventions require that the stack be aligned on a 16-byte boundary. */
+	k = (argCount+3)*sizeof(jintLong);
+	pad = ((k + 15) & ~15) - k;
+	if (pad > 0) {
+		//SUB ESP,pad - 3 bytes
+		code[j++] = 0x83;
+		code[j++] = 0xec;
+		code[j++] = pad;
+	}
+#endif
+
+	// 3*argCount bytes
+	for (k=(argCount + 1) * sizeof(jintLong); k >= sizeof(jintLong)*2; k -= sizeof(jintLong)) {
+		//PUSH SS:[EBP+k]
+		code[j++] = 0xff;
+		code[j++] = 0x75;
+		code[j++] = k;
+	}
+
+	if (index > 127) {
+		//PUSH index - 5 bytes
+		code[j++] = 0x68;
+		code[j++] = ((index >> 0) & 0xFF);
+		code[j++] = ((index >> 8) & 0xFF);
+		code[j++] = ((index >> 16) & 0xFF);
+		code[j++] = ((index >> 24) & 0xFF);
+	} else {
+		//PUSH index - 2 bytes
+		code[j++] = 0x6a;
+		code[j++] = index;
+	}
+
+	//MOV EAX target - 1 + sizeof(jintLong) bytes
+	code[j++] = 0xb8;
+	((jintLong *)&code[j])[0] = target;
+	j += sizeof(jintLong);
+
+	//CALL EAX - 2 bytes
+	code[j++] = 0xff;
+	code[j++] = 0xd0;
+
+	//ADD ESP,(argCount + 1) * sizeof(jintLong) - 3 bytes
+	code[j++] = 0x83;
+	code[j++] = 0xc4;
+#ifdef __APPLE__
+	code[j++] = (unsigned char)(pad + ((argCount + 1) * sizeof(jintLong)));
+#else
+	code[j++] = (unsigned char)((argCount + 1) * sizeof(jintLong));
+#endif
+
+	//POP EBP - 1 byte
+	code[j++] = 0x5d;
+
+#if defined (_WIN32) || defined (_WIN32_WCE)
+	//RETN argCount * sizeof(jintLong) - 3 bytes
+	code[j++] = 0xc2;
+	code[j++] = (unsigned char)(argCount * sizeof(jintLong));
+	code[j++] = 0x00;
+#else
+	//RETN - 1 byte
+	code[j++] = 0xc3;
+#endif
+	return j;
+}
+#endif /* THUNK_X86 */
+
+#if defined (THUNK_X86_64) || defined (THUNK_WIN64)
+
+#define RAX 0
+#define RCX 1
+#define RDX 2
+#define RSP 4
+#define RBP 5
+#define RSI 6
+#define RDI 7
+#define R8 8
+#define R9 9
+#define R10 10
+#define R11 11
+
+#ifdef THUNK_WIN64
+#define REGISTER_ARGS 4
+#define SHADOW_SPACE 32
+static const int argRegs[REGISTER_ARGS] = {RCX, RDX, R8, R9};
+#else
+#define REGISTER_ARGS 6
+#define SHADOW_SPACE 0
+static const int argRegs[REGISTER_ARGS] = {RDI, RSI, RDX, RCX, R8, R9};
+#endif
+
+//MOV dst,src - 3 bytes
+static int emitMov(unsigned char *code, int j, int dst, int src)
+{
+	code[j++] = 0x48 | ((src >> 3) << 2) | (dst >> 3);
+	code[j++] = 0x89;
+	code[j++] = 0xc0 | ((src & 7) << 3) | (dst & 7);
+	return j;
+}
+
+//MOV R10,[RBP+offset] - 4 bytes
+//MOV [RSP+offset],R10 - 5 bytes
+static int emitCopyStackArg(unsigned char *code, int j, int from, int to)
+{
+	code[j++] = 0x4c;
+	code[j++] = 0x8b;
+	code[j++] = 0x55;
+	code[j++] = (unsigned char)from;
+	code[j++] = 0x4c;
+	code[j++] = 0x89;
+	code[j++] = 0x54;
+	code[j++] = 0x24;
+	code[j++] = (unsigned char)to;
+	return j;
+}
+
+#ifdef THUNK_WIN64
+/*
+* Every thunk starts with PUSH RBP; MOV RBP,RSP and restores RSP from RBP
+* before returning, so a single UNWIND_INFO describes all of them.
+*/
+static const unsigned char thunkUnwindInfo[] = {
+	0x01, /* version 1, no flags */
+	0x04, /* size of prolog */
+	0x02, /* count of unwind codes */
+	0x05, /* frame register RBP, no offset */
+	0x04, 0x03, /* UWOP_SET_FPREG at offset 4 */
+	0x01, 0x50, /* UWOP_PUSH_NONVOL RBP at offset 1 */
+};
+
+static int registerUnwindInfo(unsigned char *code, unsigned char *writeCode)
+{
+	int i;
+	DWORD unwindData = CALLBACK_THUNK_SIZE * MAX_CALLBACKS;
+	RUNTIME_FUNCTION *table = (RUNTIME_FUNCTION *)malloc(sizeof(RUNTIME_FUNCTION) * MAX_CALLBACKS);
+	if (table == NULL) return 0;
+	memcpy(writeCode + unwindData, thunkUnwindInfo, sizeof(thunkUnwindInfo));
+	for (i=0; i<MAX_CALLBACKS; i++) {
+		table[i].BeginAddress = i * CALLBACK_THUNK_SIZE;
+		table[i].EndAddress = (i + 1) * CALLBACK_THUNK_SIZE;
+		table[i].UnwindData = unwindData;
+	}
+	if (!RtlAddFunctionTable(table, MAX_CALLBACKS, (DWORD64)code)) {
+		free(table);
+		return 0;
+	}
+	return 1;
+}
+#endif /* THUNK_WIN64 */
+
+static int emitThunk(unsigned char *code, int index, int argCount, jintLong target, int variadic)
+{
+	int j = 0, k;
+	/* the arguments that no longer fit in registers once the index is inserted */
+	int stackArgs = argCount + 1 - REGISTER_ARGS;
+#ifdef THUNK_WIN64
+	/* a frame is always built so that all thunks share the same unwind info */
+	int frame = 1;
+#else
+	int frame = stackArgs > 0;
+#endif
+	if (stackArgs < 0) stackArgs = 0;
+
+	if (frame) {
+		int size = (SHADOW_SPACE + stackArgs * sizeof(jintLong) + 15) & ~15;
+
+		//PUSH RBP - 1 byte
+		code[j++] = 0x55;
+
+		//MOV RBP,RSP - 3 bytes
+		j = emitMov(code, j, RBP, RSP);
+
+		//SUB RSP,size - 7 bytes
+		code[j++] = 0x48;
+		code[j++] = 0x81;
+		code[j++] = 0xec;
+		code[j++] = ((size >> 0) & 0xFF);
+		code[j++] = ((size >> 8) & 0xFF);
+		code[j++] = ((size >> 16) & 0xFF);
+		code[j++] = ((size >> 24) & 0xFF);
+
+		if (stackArgs > 0) {
+			//MOV [RSP+SHADOW_SPACE],R9 - 5 bytes
+			code[j++] = 0x4c;
+			code[j++] = 0x89;
+			code[j++] = 0x4c;
+			code[j++] = 0x24;
+			code[j++] = SHADOW_SPACE;
+		}
+
+		/* 16 bytes for the saved RBP and the return address */
+		for (k=1; k<stackArgs; k++) {
+			j = emitCopyStackArg(code, j, 16 + SHADOW_SPACE + (k - 1) * sizeof(jintLong), SHADOW_SPACE + k * sizeof(jintLong));
+		}
+	}
+
+	/* shift the register arguments to make room for the index */
+	for (k=argCount < REGISTER_ARGS - 1 ? argCount : REGISTER_ARGS - 1; k>0; k--) {
+		j = emitMov(code, j, argRegs[k], argRegs[k - 1]);
+	}
+
+	//MOV E(first argument),index - 5 bytes
+	code[j++] = 0xb8 + argRegs[0];
+	code[j++] = ((index >> 0) & 0xFF);
+	code[j++] = ((index >> 8) & 0xFF);
+	code[j++] = ((index >> 16) & 0xFF);
+	code[j++] = ((index >> 24) & 0xFF);
+
+#ifdef THUNK_X86_64
+	if (variadic) {
+		//XOR EAX,EAX - 2 bytes (no vector registers are used by the variable arguments)
+		code[j++] = 0x31;
+		code[j++] = 0xc0;
+	}
+#endif
+
+	//MOV R11,target - 10 bytes
+	code[j++] = 0x49;
+	code[j++] = 0xbb;
+	memcpy(&code[j], &target, sizeof(jintLong));
+	j += sizeof(jintLong);
+
+	if (frame) {
+		//CALL R11 - 3 bytes
+		code[j++] = 0x41;
+		code[j++] = 0xff;
+		code[j++] = 0xd3;
+
+		//LEA RSP,[RBP] - 4 bytes
+		code[j++] = 0x48;
+		code[j++] = 0x8d;
+		code[j++] = 0x65;
+		code[j++] = 0x00;
+
+		//POP RBP - 1 byte
+		code[j++] = 0x5d;
+
+		//RET - 1 byte
+		code[j++] = 0xc3;
+	} else {
+		//JMP R11 - 3 bytes
+		code[j++] = 0x41;
+		code[j++] = 0xff;
+		code[j++] = 0xe3;
+	}
+	return j;
+}
+#endif /* THUNK_X86_64 || THUNK_WIN64 */
+
+#ifdef THUNK_AARCH64
+
+#define X0 0
+#define X7 7
+#define X9 9
+#define X16 16
+#define X29 29
+#define SP 31
+
+#define REGISTER_ARGS 8
+
+/* Darwin passes variable arguments on the stack instead of in registers */
+#ifdef __APPLE__
+#define VARIADIC_REGISTER_ARGS 1
+#else
+#define VARIADIC_REGISTER_ARGS REGISTER_ARGS
+#endif
+
+static int emitInstruction(unsigned char *code, int j, unsigned int instruction)
+{
+	memcpy(&code[j], &instruction, sizeof(instruction));
+	return j + sizeof(instruction);
+}
+
+static int emitThunk(unsigned char *code, int index, int argCount, jintLong target, int variadic)
+{
+	int j = 0, k, literal;
+	int registerArgs = variadic ? VARIADIC_REGISTER_ARGS : REGISTER_ARGS;
+	/* the arguments that are passed on the stack to the dispatcher */
+	int stackArgs = argCount + 1 - registerArgs;
+	if (stackArgs < 0) stackArgs = 0;
+
+	if (stackArgs > 0) {
+		int size = (stackArgs * sizeof(jintLong) + 15) & ~15;
+		int first = registerArgs - 1;
+
+		//STP X29,X30,[SP,#-16]!
+		j = emitInstruction(code, j, 0xa9bf7bfd);
+
+		//MOV X29,SP
+		j = emitInstruction(code, j, 0x910003fd);
+
+		//SUB SP,SP,#size
+		j = emitInstruction(code, j, 0xd10003ff | (size << 10));
+
+		/* the register arguments that go on the stack, then the arguments already on the stack */
+		for (k=first; k<argCount; k++) {
+			int to = (k - first) * sizeof(jintLong);
+			if (k <= X7) {
+				//STR Xk,[SP,#to]
+				j = emitInstruction(code, j, 0xf90003e0 | ((to / 8) << 10) | k);
+			} else {
+				int from = 16 + (k - 8) * sizeof(jintLong);
+				//LDR X9,[X29,#from]
+				j = emitInstruction(code, j, 0xf9400000 | ((from / 8) << 10) | (X29 << 5) | X9);
+				//STR X9,[SP,#to]
+				j = emitInstruction(code, j, 0xf90003e0 | ((to / 8) << 10) | X9);
+			}
+		}
+	}
+
+	/* shift the register arguments to make room for the index */
+	for (k=argCount < registerArgs - 1 ? argCount : registerArgs - 1; k>0; k--) {
+		//MOV Xk,Xk-1
+		j = emitInstruction(code, j, 0xaa0003e0 | ((k - 1) << 16) | k);
+	}
+
+	//MOVZ X0,#index
+	j = emitInstruction(code, j, 0xd2800000 | ((index & 0xFFFF) << 5) | X0);
+	if (index > 0xFFFF) {
+		//MOVK X0,#index,LSL #16
+		j = emitInstruction(code, j, 0xf2a00000 | (((index >> 16) & 0xFFFF) << 5) | X0);
+	}
+
+	//LDR X16,target (patched below)
+	literal = j;
+	j = emitInstruction(code, j, 0);
+
+	if (stackArgs > 0) {
+		//BLR X16
+		j = emitInstruction(code, j, 0xd63f0200);
+
+		//MOV SP,X29
+		j = emitInstruction(code, j, 0x910003bf);
+
+		//LDP X29,X30,[SP],#16
+		j = emitInstruction(code, j, 0xa8c17bfd);
+
+		//RET
+		j = emitInstruction(code, j, 0xd65f03c0);
+	} else {
+		//BR X16
+		j = emitInstruction(code, j, 0xd61f0200);
+	}
+
+	if (j & 7) {
+		//NOP
+		j = emitInstruction(code, j, 0xd503201f);
+	}
+	emitInstruction(code, literal, 0x58000000 | (((j - literal) / 4) << 5) | X16);
+	memcpy(&code[j], &target, sizeof(jintLong));
+	return j + sizeof(jintLong);
+}
+#endif /* THUNK_AARCH64 */
+
+/*
+* The thunks of a chunk are mapped twice where possible: once writable,
+* where bind() emits them, and once executable, where they are called
+* from. No page is ever writable and executable at the same time, and no
+* protection has to change when a thunk is bound. Systems that refuse
+* the second mapping get a single writable and executable mapping, which
+* on Darwin is a JIT mapping. Returns the executable address, or NULL.
+*/
+static unsigned char *mapCode(unsigned char **writeCode)
+{
+	unsigned char *code;
+#if defined (_WIN32) || defined (_WIN32_WCE)
+#ifndef _WIN32_WCE
+	HANDLE mapping = CreateFileMapping(INVALID_HANDLE_VALUE, NULL, PAGE_EXECUTE_READWRITE, 0, CALLBACK_CODE_SIZE, NULL);
+	if (mapping != NULL) {
+		*writeCode = (unsigned char *)MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, CALLBACK_CODE_SIZE);
+		code = NULL;
+		if (*writeCode != NULL) {
+			code = (unsigned char *)MapViewOfFile(mapping, FILE_MAP_READ | FILE_MAP_EXECUTE, 0, 0, CALLBACK_CODE_SIZE);
+			if (code == NULL) UnmapViewOfFile(*writeCode);
+		}
+		/* The views keep the section alive */
+		CloseHandle(mapping);
+		if (code != NULL) return code;
+	}
+#endif /* _WIN32_WCE */
+	code = (unsigned char *)VirtualAlloc(NULL, CALLBACK_CODE_SIZE, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+#else
+#ifdef SYS_memfd_create
+	int fd = (int)syscall(SYS_memfd_create, "swt-callbacks", 1 /* MFD_CLOEXEC */);
+	if (fd != -1) {
+		code = MAP_FAILED;
+		if (ftruncate(fd, CALLBACK_CODE_SIZE) == 0) {
+			*writeCode = (unsigned char *)mmap(NULL, CALLBACK_CODE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			if (*writeCode != MAP_FAILED) {
+				code = (unsigned char *)mmap(NULL, CALLBACK_CODE_SIZE, PROT_READ | PROT_EXEC, MAP_SHARED, fd, 0);
+				if (code == MAP_FAILED) munmap(*writeCode, CALLBACK_CODE_SIZE);
+			}
+		}
+		/* The mappings keep the file alive */
+		close(fd);
+		if (code != MAP_FAILED) return code;
+	}
+#endif /* SYS_memfd_create */
+	code = (unsigned char *)mmap(NULL, CALLBACK_CODE_SIZE, PROT_EXEC | PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON | MAP_JIT, -1, 0);
+	if (code == MAP_FAILED) code = NULL;
+#endif
+	*writeCode = code;
+	return code;
+}
+
+#ifdef THUNK_WIN64
+static void unmapCode(unsigned char *code, unsigned char *writeCode)
+{
+#if defined (_WIN32) || defined (_WIN32_WCE)
+	if (writeCode != code) {
+		UnmapViewOfFile(writeCode);
+		UnmapViewOfFile(code);
+	} else {
+		VirtualFree(code, 0, MEM_RELEASE);
+	}
+#else
+	if (writeCode != code) munmap(writeCode, CALLBACK_CODE_SIZE);
+	munmap(code, CALLBACK_CODE_SIZE);
+#endif
+}
+#endif /* THUNK_WIN64 */
 
 #else
 
@@ -71,25 +699,25 @@ static unsigned char *callbackCode = NULL;
  */
 
 /* Function template with no arguments */
-#define FN_0(index) RETURN_TYPE FN(index, 0)() { return RETURN_CAST callback(index); }
+#define FN_0(index) RETURN_TYPE FN(index, 0)() { return RETURN_CAST callback0(index); }
 
 /* Function template with 1 argument */
-#define FN_1(index) RETURN_TYPE FN(index, 1)(jintLong p1) { return RETURN_CAST callback(index, p1); }
+#define FN_1(index) RETURN_TYPE FN(index, 1)(jintLong p1) { return RETURN_CAST callback1(index, p1); }
 
 /* Function template with 2 arguments */
-#define FN_2(index) RETURN_TYPE FN(index, 2)(jintLong p1, jintLong p2) { return RETURN_CAST callback(index, p1, p2); }
+#define FN_2(index) RETURN_TYPE FN(index, 2)(jintLong p1, jintLong p2) { return RETURN_CAST callback2(index, p1, p2); }
 
 /* Function template with 3 arguments */
-#define FN_3(index) RETURN_TYPE FN(index, 3)(jintLong p1, jintLong p2, jintLong p3) { return RETURN_CAST callback(index, p1, p2, p3); }
+#define FN_3(index) RETURN_TYPE FN(index, 3)(jintLong p1, jintLong p2, jintLong p3) { return RETURN_CAST callback3(index, p1, p2, p3); }
 
 /* Function template with 4 arguments */
-#define FN_4(index) RETURN_TYPE FN(index, 4)(jintLong p1, jintLong p2, jintLong p3, jintLong p4) { return RETURN_CAST callback(index, p1, p2, p3, p4); }
+#define FN_4(index) RETURN_TYPE FN(index, 4)(jintLong p1, jintLong p2, jintLong p3, jintLong p4) { return RETURN_CAST callback4(index, p1, p2, p3, p4); }
 
 /* Function template with 5 arguments */
-#define FN_5(index) RETURN_TYPE FN(index, 5)(jintLong p1, jintLong p2, jintLong p3, jintLong p4, jintLong p5) { return RETURN_CAST callback(index, p1, p2, p3, p4, p5); }
+#define FN_5(index) RETURN_TYPE FN(index, 5)(jintLong p1, jintLong p2, jintLong p3, jintLong p4, jintLong p5) { return RETURN_CAST callback5(index, p1, p2, p3, p4, p5); }
 
 /* Function template with 6 arguments */
-#define FN_6(index) RETURN_TYPE FN(index, 6)(jintLong p1, jintLong p2, jintLong p3, jintLong p4, jintLong p5, jintLong p6) { return RETURN_CAST callback(index, p1, p2, p3, p4, p5, p6); }
+#define FN_6(index) RETURN_TYPE FN(index, 6)(jintLong p1, jintLong p2, jintLong p3, jintLong p4, jintLong p5, jintLong p6) { return RETURN_CAST callback6(index, p1, p2, p3, p4, p5, p6); }
 
 /* Function template with 7 arguments */
 #define FN_7(index) RETURN_TYPE FN(index, 7)(jintLong p1, jintLong p2, jintLong p3, jintLong p4, jintLong p5, jintLong p6, jintLong p7) { return RETURN_CAST callback(index, p1, p2, p3, p4, p5, p6, p7); }
@@ -981,19 +1609,288 @@ jintLong fnx_array[MAX_ARGS+1][MAX_CALLBACKS] = {
 
 #endif /* USE_ASSEMBLER */
 
+/* --------------- callback slot table --------------- */
+
+/*
+* Slots are allocated in chunks of MAX_CALLBACKS entries. Unused slots
+* are linked in a free list, so bind and unbind do not scan the table.
+*/
+static void initCallbackChunk(int chunk)
+{
+	int i, base = chunk * MAX_CALLBACKS;
+	CALLBACK_DATA *data = callbackChunks[chunk].data;
+	memset(data, 0, sizeof(CALLBACK_DATA) * MAX_CALLBACKS);
+	for (i=0; i<MAX_CALLBACKS - 1; i++) {
+		data[i].nextFree = base + i + 1;
+	}
+	data[MAX_CALLBACKS - 1].nextFree = callbackFreeSlot;
+	callbackFreeSlot = base;
+}
+
+static int growCallbackChunks()
+{
+	CALLBACK_DATA *data;
+#ifdef USE_ASSEMBLER
+	unsigned char *code, *writeCode;
+#else
+	/* There are only MAX_CALLBACKS functions for each argument count */
+	if (callbackChunkCount > 0) return 0;
+#endif
+	if (callbackChunkCount == callbackChunkCapacity) {
+		int capacity = callbackChunkCapacity == 0 ? 4 : callbackChunkCapacity * 2;
+		CALLBACK_CHUNK *chunks = (CALLBACK_CHUNK *)malloc(capacity * sizeof(CALLBACK_CHUNK));
+		if (chunks == NULL) return 0;
+		if (callbackChunks != NULL) memcpy(chunks, callbackChunks, callbackChunkCount * sizeof(CALLBACK_CHUNK));
+		/*
+		* The previous table is not freed because a callback running in
+		* another thread may still be reading from it.
+		*/
+		MEMORY_BARRIER();
+		callbackChunks = chunks;
+		callbackChunkCapacity = capacity;
+	}
+	if ((data = (CALLBACK_DATA *)malloc(sizeof(CALLBACK_DATA) * MAX_CALLBACKS)) == NULL) return 0;
+#ifdef USE_ASSEMBLER
+	if ((code = mapCode(&writeCode)) == NULL) {
+		free(data);
+		return 0;
+	}
+#ifdef THUNK_WIN64
+	if (!registerUnwindInfo(code, writeCode)) {
+		unmapCode(code, writeCode);
+		free(data);
+		return 0;
+	}
+#endif
+	callbackChunks[callbackChunkCount].code = code;
+	callbackChunks[callbackChunkCount].writeCode = writeCode;
+#endif /* USE_ASSEMBLER */
+	callbackChunks[callbackChunkCount].data = data;
+	initCallbackChunk(callbackChunkCount);
+	/* Publish the chunk before its first slot can be handed out */
+	ATOMIC_STORE(callbackChunkCount, callbackChunkCount + 1);
+	return 1;
+}
+
+/* --------------- callback stats --------------- */
+
+#if defined (_WIN32) || defined (_WIN32_WCE)
+static jlong currentTime()
+{
+	static LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+	if (frequency.QuadPart == 0) QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (jlong)(counter.QuadPart * 1000000000.0 / frequency.QuadPart);
+}
+#elif defined (__APPLE__)
+#include <mach/mach_time.h>
+static jlong currentTime()
+{
+	static mach_timebase_info_data_t timebase;
+	if (timebase.denom == 0) mach_timebase_info(&timebase);
+	return (jlong)(mach_absolute_time() * timebase.numer / timebase.denom);
+}
+#else
+#include <time.h>
+static jlong currentTime()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (jlong)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+#endif
+
+static void recordStats(CALLBACK_STATS *stats, jlong time)
+{
+	int bucket, bits = 0;
+	jlong value = time;
+	while (value > 3) {
+		value >>= 1;
+		bits++;
+	}
+	bucket = bits * 4 + (int)(bits == 0 ? time : time >> (bits - 1) & 3);
+	if (bucket >= STATS_BUCKETS) bucket = STATS_BUCKETS - 1;
+	stats->count++;
+	stats->totalTime += time;
+	if (time > stats->maxTime) stats->maxTime = time;
+	stats->histogram[bucket]++;
+}
+
+/*
+* The stats of a slot are allocated the first time stats are enabled while
+* it is bound and stay allocated until the slot is unbound, so that a
+* callback running in another thread never sees them freed.
+*/
+static void allocStats(CALLBACK_DATA *data)
+{
+	if (data->stats == NULL) {
+		CALLBACK_STATS *stats = (CALLBACK_STATS *)calloc(1, sizeof(CALLBACK_STATS));
+		MEMORY_BARRIER();
+		data->stats = stats;
+	}
+}
+
+/* --------------- weak callbacks --------------- */
+
+/*
+* A callback bound with isWeak holds its object with a weak global
+* reference, so that a callback which is never disposed does not keep
+* the object and everything it references from being collected. Once
+* the object is collected the callback returns its error result.
+*/
+static jobject newObjectRef(JNIEnv *env, jobject object, jboolean isWeak)
+{
+#ifdef JNI_VERSION_1_2
+	if (isWeak) return (*env)->NewWeakGlobalRef(env, object);
+#endif
+	return (*env)->NewGlobalRef(env, object);
+}
+
+static void deleteObjectRef(JNIEnv *env, CALLBACK_DATA *data)
+{
+#ifdef JNI_VERSION_1_2
+	if (data->isWeak) {
+		(*env)->DeleteWeakGlobalRef(env, data->object);
+		return;
+	}
+#endif
+	(*env)->DeleteGlobalRef(env, data->object);
+}
+
+/* --------------- callback slot retirement --------------- */
+
+/*
+* An unbound slot is retired rather than freed. A callback entering the
+* slot increments its busy count and then checks whether it was retired,
+* while retiring sets the flag and then checks the busy count, so either
+* the callback sees the flag and backs out, or the slot stays retired
+* until the callback returns. Retired slots are reclaimed from bind and
+* unbind once nothing is running in them.
+*/
+static void retireCallbackSlot(int index)
+{
+	CALLBACK_DATA *data = CALLBACK_SLOT(index);
+	ATOMIC_STORE(data->retired, 1);
+	data->nextFree = callbackRetiredSlot;
+	callbackRetiredSlot = index;
+}
+
+static void reclaimCallbackSlots(JNIEnv *env)
+{
+	int i = callbackRetiredSlot, *link = &callbackRetiredSlot;
+	while (i != -1) {
+		CALLBACK_DATA *data = CALLBACK_SLOT(i);
+		int next = data->nextFree;
+		if (ATOMIC_LOAD(data->busy) == 0) {
+			*link = next;
+			(*env)->DeleteGlobalRef(env, data->callback);
+			if (data->object != NULL) deleteObjectRef(env, data);
+			if (data->stats != NULL) free(data->stats);
+			memset(data, 0, sizeof(CALLBACK_DATA));
+			data->nextFree = callbackFreeSlot;
+			callbackFreeSlot = i;
+		} else {
+			link = &data->nextFree;
+		}
+		i = next;
+	}
+}
+
+/* --------------- callback targets --------------- */
+
+/*
+* The targets map native handles to Java objects, so that a callback
+* bound with resolvesTarget receives the object registered for its
+* first argument without calling back into native code to find it.
+* The map is an open addressing hash table with linear probing that
+* holds a global reference to each target. An entry whose target was
+* removed keeps its handle, so that probes continue past it, until the
+* table is rebuilt. Like the callbacks themselves, the targets are set
+* and resolved on the thread that created them.
+*/
+typedef struct CALLBACK_TARGET {
+	jintLong handle;
+	jobject target;
+} CALLBACK_TARGET;
+
+#define MIN_TARGETS 256
+
+static CALLBACK_TARGET *callbackTargets = NULL;
+static int targetCapacity = 0;
+static int targetCount = 0;
+static int targetUsed = 0;
+
+static int targetHash(jintLong handle)
+{
+	/* Handles are pointers, the low bits are mostly alignment */
+	unsigned int hash = (unsigned int)(handle >> 3);
+#ifdef JNI64
+	hash ^= (unsigned int)((jlong)handle >> 35);
+#endif
+	return (int)((hash * 0x9E3779B1u) & (targetCapacity - 1));
+}
+
+static CALLBACK_TARGET *findTarget(jintLong handle)
+{
+	int i;
+	if (callbackTargets == NULL || handle == 0) return NULL;
+	for (i = targetHash(handle);; i = (i + 1) & (targetCapacity - 1)) {
+		CALLBACK_TARGET *entry = &callbackTargets[i];
+		if (entry->handle == handle) return entry;
+		if (entry->handle == 0) return NULL;
+	}
+}
+
+static int growTargets(int capacity)
+{
+	int i;
+	CALLBACK_TARGET *oldTargets = callbackTargets;
+	int oldCapacity = targetCapacity;
+	CALLBACK_TARGET *newTargets = (CALLBACK_TARGET *)calloc(capacity, sizeof(CALLBACK_TARGET));
+	if (newTargets == NULL) return 0;
+	callbackTargets = newTargets;
+	targetCapacity = capacity;
+	targetUsed = targetCount;
+	for (i = 0; i < oldCapacity; i++) {
+		CALLBACK_TARGET *entry = &oldTargets[i];
+		if (entry->target != NULL) {
+			int j = targetHash(entry->handle);
+			while (callbackTargets[j].handle != 0) j = (j + 1) & (targetCapacity - 1);
+			callbackTargets[j] = *entry;
+		}
+	}
+	free(oldTargets);
+	return 1;
+}
+
+static void clearTargets(JNIEnv *env)
+{
+	int i;
+	for (i = 0; i < targetCapacity; i++) {
+		if (callbackTargets[i].target != NULL) (*env)->DeleteGlobalRef(env, callbackTargets[i].target);
+	}
+	free(callbackTargets);
+	callbackTargets = NULL;
+	targetCapacity = targetCount = targetUsed = 0;
+}
+
 /* --------------- callback class calls --------------- */
 
 JNIEXPORT jintLong JNICALL CALLBACK_NATIVE(bind)
-  (JNIEnv *env, jclass that, jobject callbackObject, jobject object, jstring method, jstring signature, jint argCount, jboolean isStatic, jboolean isArrayBased, jintLong errorResult)
+  (JNIEnv *env, jclass that, jobject callbackObject, jobject object, jstring method, jstring signature, jint argCount, jboolean isStatic, jboolean isArrayBased, jboolean resolvesTarget, jboolean isWeak, jintLong errorResult)
 {
 	int i;
+	CALLBACK_DATA *data;
 	jmethodID mid = NULL;
 	jclass javaClass = that;
 	const char *methodString = NULL, *sigString = NULL;
 	if (jvm == NULL) (*env)->GetJavaVM(env, &jvm);
 	if (JNI_VERSION == 0) JNI_VERSION = (*env)->GetVersion(env);
 	if (!initialized) {
-		memset(&callbackData, 0, sizeof(callbackData));
+		slotID = (*env)->GetFieldID(env, that, "slot", "I");
+		if (slotID == NULL) goto fail;
+		createThreadKey();
 		initialized = 1;
 	}
 	if (method) methodString = (const char *) (*env)->GetStringUTFChars(env, method, NULL);
@@ -1008,117 +1905,57 @@ JNIEXPORT jintLong JNICALL CALLBACK_NATIVE(bind)
 	}
 	if (method && methodString) (*env)->ReleaseStringUTFChars(env, method, methodString);
 	if (signature && sigString) (*env)->ReleaseStringUTFChars(env, signature, sigString);
-	if (mid == 0) goto fail;
-	for (i=0; i<MAX_CALLBACKS; i++) {
-		if (!callbackData[i].callback) {
-			if ((callbackData[i].callback = (*env)->NewGlobalRef(env, callbackObject)) == NULL) goto fail;
-			if ((callbackData[i].object = (*env)->NewGlobalRef(env, object)) == NULL) goto fail;
-			callbackData[i].isStatic = isStatic;
-			callbackData[i].isArrayBased = isArrayBased;
-			callbackData[i].argCount = argCount;
-			callbackData[i].errorResult = errorResult;
-			callbackData[i].methodID = mid;
-#ifndef USE_ASSEMBLER
-			return (jintLong) fnx_array[argCount][i];
-#else
-			{
-			int j = 0, k;
-			unsigned char* code;
-#ifdef __APPLE__
-			int pad = 0;
-#endif
-			if (callbackCode == NULL) {
-#if defined (_WIN32) || defined (_WIN32_WCE)
-				callbackCode = VirtualAlloc(NULL, CALLBACK_THUNK_SIZE * MAX_CALLBACKS, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
-				if (callbackCode == NULL) return 0;
-#else 
-				callbackCode = mmap(NULL, CALLBACK_THUNK_SIZE * MAX_CALLBACKS, PROT_EXEC | PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
-				if (callbackCode == MAP_FAILED) return 0;
-#endif
-			}
-			code = (unsigned char *)(callbackCode + (i * CALLBACK_THUNK_SIZE));
-
-			//PUSH EBP - 1 byte
-			code[j++] = 0x55;
-
-			//MOV EBP,ESP - 2 bytes
-			code[j++] = 0x8b;
-			code[j++] = 0xec;
-
-#ifdef __APPLE__
-			/* darwin calling conventions require that the stack be aligned on a 16-byte boundary. */
-			k = (argCount+3)*sizeof(jintLong);
-			pad = ((k + 15) & ~15) - k;
-			if (pad > 0) {
-				//SUB ESP,pad - 3 bytes
-				code[j++] = 0x83;
-				code[j++] = 0xec;
-				code[j++] = pad;
-			}
-#endif
-
-			// 3*argCount bytes
-			for (k=(argCount + 1) * sizeof(jintLong); k >= sizeof(jintLong)*2; k -= sizeof(jintLong)) {
-				//PUSH SS:[EBP+k]
-				code[j++] = 0xff;
-				code[j++] = 0x75;
-				code[j++] = k;
-			}
-
-			if (i > 127) {
-				//PUSH i - 5 bytes
-				code[j++] = 0x68;
-				code[j++] = ((i >> 0) & 0xFF);
-				code[j++] = ((i >> 8) & 0xFF);
-				code[j++] = ((i >> 16) & 0xFF);
-				code[j++] = ((i >> 24) & 0xFF);
-			} else {
-				//PUSH i - 2 bytes
-				code[j++] = 0x6a;
-				code[j++] = i;
-			}
-
-			//MOV EAX callback - 1 + sizeof(jintLong) bytes
-			code[j++] = 0xb8;
-			((jintLong *)&code[j])[0] = (jintLong)&callback;
-			j += sizeof(jintLong);
-
-			//CALL EAX - 2 bytes
-			code[j++] = 0xff;
-			code[j++] = 0xd0;
-
-			//ADD ESP,(argCount + 1) * sizeof(jintLong) - 3 bytes
-			code[j++] = 0x83;
-			code[j++] = 0xc4;
-#ifdef __APPLE__
-			code[j++] = (unsigned char)(pad + ((argCount + 1) * sizeof(jintLong)));
+	if (mid == 0 || argCount < 0 || argCount > MAX_ARGS) goto fail;
+	if (callbackFreeSlot == -1) reclaimCallbackSlots(env);
+	if (callbackFreeSlot == -1 && !growCallbackChunks()) goto fail;
+	i = callbackFreeSlot;
+	data = CALLBACK_SLOT(i);
+	if ((data->callback = (*env)->NewGlobalRef(env, callbackObject)) == NULL) goto fail;
+#ifdef JNI_VERSION_1_2
+	if (!IS_JNI_1_2) isWeak = 0;
 #else
-			code[j++] = (unsigned char)((argCount + 1) * sizeof(jintLong));
+	isWeak = 0;
 #endif
-
-			//POP EBP - 1 byte
-			code[j++] = 0x5d;
-
-#if defined (_WIN32) || defined (_WIN32_WCE)
-			//RETN argCount * sizeof(jintLong) - 3 bytes
-			code[j++] = 0xc2;
-			code[j++] = (unsigned char)(argCount * sizeof(jintLong));
-			code[j++] = 0x00;
+	if ((data->object = newObjectRef(env, object, isWeak)) == NULL) {
+		(*env)->DeleteGlobalRef(env, data->callback);
+		data->callback = NULL;
+		goto fail;
+	}
+	callbackFreeSlot = data->nextFree;
+	data->isStatic = isStatic;
+	data->isArrayBased = isArrayBased;
+	data->resolvesTarget = resolvesTarget && !isArrayBased && argCount > 0;
+	data->isWeak = isWeak;
+	data->argCount = argCount;
+	data->errorResult = errorResult;
+	data->methodID = mid;
+	if (callbackStatsEnabled) allocStats(data);
+	/* Publish the slot before its thunk can be called */
+	MEMORY_BARRIER();
+	(*env)->SetIntField(env, callbackObject, slotID, i);
+#ifndef USE_ASSEMBLER
+	return (jintLong) fnx_array[argCount][i];
 #else
-			//RETN - 1 byte
-			code[j++] = 0xc3;
+	{
+	int size;
+	unsigned char *code = CALLBACK_CODE(i);
+	BEGIN_WRITE_CODE();
+	if (argCount <= MAX_FAST_ARGS) {
+		size = emitThunk(CALLBACK_WRITE_CODE(i), i, argCount, fastCallbacks[argCount], 0);
+	} else {
+		size = emitThunk(CALLBACK_WRITE_CODE(i), i, argCount, (jintLong)&callback, 1);
+	}
+	END_WRITE_CODE();
+	if (size > CALLBACK_THUNK_SIZE) {
+		jclass errorClass = (*env)->FindClass(env, "java/lang/Error");
+		(*env)->ThrowNew(env, errorClass, "Callback thunk overflow");
+	}
+#ifdef THUNK_AARCH64
+	__builtin___clear_cache((char *)code, (char *)code + CALLBACK_THUNK_SIZE);
 #endif
-
-			if (j > CALLBACK_THUNK_SIZE) {
-				jclass errorClass = (*env)->FindClass(env, "java/lang/Error");
-				(*env)->ThrowNew(env, errorClass, "Callback thunk overflow");
-			}
-
-			return (jintLong)code;
-			}
-#endif /* USE_ASSEMBLER */
-		}
+	return (jintLong)code;
 	}
+#endif /* USE_ASSEMBLER */
 fail:
     return 0;
 }
@@ -1127,76 +1964,213 @@ JNIEXPORT void JNICALL CALLBACK_NATIVE(unbind)
   (JNIEnv *env, jclass that, jobject callback)
 {
 	int i;
-    for (i=0; i<MAX_CALLBACKS; i++) {
-        if (callbackData[i].callback != NULL && (*env)->IsSameObject(env, callback, callbackData[i].callback)) {
-            if (callbackData[i].callback != NULL) (*env)->DeleteGlobalRef(env, callbackData[i].callback);
-            if (callbackData[i].object != NULL) (*env)->DeleteGlobalRef(env, callbackData[i].object);
-            memset(&callbackData[i], 0, sizeof(CALLBACK_DATA));
-        }
-    }
+	CALLBACK_DATA *data;
+	if (!initialized) return;
+	i = (*env)->GetIntField(env, callback, slotID);
+	if (i < 0 || i >= callbackChunkCount * MAX_CALLBACKS) return;
+	data = CALLBACK_SLOT(i);
+	if (data->callback != NULL && !data->retired && (*env)->IsSameObject(env, callback, data->callback)) {
+		retireCallbackSlot(i);
+		reclaimCallbackSlots(env);
+	}
+	(*env)->SetIntField(env, callback, slotID, -1);
 }
 
 JNIEXPORT jboolean JNICALL CALLBACK_NATIVE(getEnabled)
   (JNIEnv *env, jclass that)
 {
-	return (jboolean)callbackEnabled;
+	CALLBACK_THREAD *thread = getThreadData(0);
+	return (jboolean)(callbackEnabled && (thread == NULL || !thread->disabled));
 }
 
 JNIEXPORT jint JNICALL CALLBACK_NATIVE(getEntryCount)
   (JNIEnv *env, jclass that)
 {
-	return (jint)callbackEntryCount;
+	CALLBACK_THREAD *thread = getThreadData(0);
+	return (jint)(callbackEntryCount + (thread != NULL ? thread->entryCount : 0));
 }
 
+/*
+* Enables or disables the callbacks received by the calling thread only,
+* so that the user-interface thread of one display does not switch off
+* the callbacks of another.
+*/
 JNIEXPORT void JNICALL CALLBACK_NATIVE(setEnabled)
   (JNIEnv *env, jclass that, jboolean enable)
 {
-	callbackEnabled = enable;
+	CALLBACK_THREAD *thread;
+	createThreadKey();
+	if ((thread = getThreadData(!enable)) != NULL) thread->disabled = !enable;
+}
+
+JNIEXPORT void JNICALL CALLBACK_NATIVE(setGlobalEnabled)
+  (JNIEnv *env, jclass that, jboolean enable)
+{
+	ATOMIC_STORE(callbackEnabled, enable);
+}
+
+JNIEXPORT void JNICALL CALLBACK_NATIVE(setStatsEnabled)
+  (JNIEnv *env, jclass that, jboolean enable)
+{
+	int i;
+	if (enable) {
+		for (i=0; i<callbackChunkCount * MAX_CALLBACKS; i++) {
+			CALLBACK_DATA *data = CALLBACK_SLOT(i);
+			if (data->callback != NULL && !data->retired) allocStats(data);
+		}
+	}
+	ATOMIC_STORE(callbackStatsEnabled, enable);
+}
+
+JNIEXPORT jint JNICALL CALLBACK_NATIVE(getSlotCount)
+  (JNIEnv *env, jclass that)
+{
+	return (jint)(callbackChunkCount * MAX_CALLBACKS);
+}
+
+JNIEXPORT jobject JNICALL CALLBACK_NATIVE(getStats)
+  (JNIEnv *env, jclass that, jint slot, jlongArray stats)
+{
+	CALLBACK_DATA *data;
+	if (slot < 0 || slot >= callbackChunkCount * MAX_CALLBACKS) return NULL;
+	data = CALLBACK_SLOT(slot);
+	if (data->callback == NULL || data->retired) return NULL;
+	if (stats != NULL && data->stats != NULL) {
+		jint length = (*env)->GetArrayLength(env, stats);
+		jlong values[3 + STATS_BUCKETS];
+		values[0] = data->stats->count;
+		values[1] = data->stats->totalTime;
+		values[2] = data->stats->maxTime;
+		memcpy(&values[3], data->stats->histogram, sizeof(data->stats->histogram));
+		if (length > 3 + STATS_BUCKETS) length = 3 + STATS_BUCKETS;
+		(*env)->SetLongArrayRegion(env, stats, 0, length, values);
+	}
+	return (*env)->NewLocalRef(env, data->callback);
+}
+
+JNIEXPORT jboolean JNICALL CALLBACK_NATIVE(isCollected)
+  (JNIEnv *env, jclass that, jint slot)
+{
+	CALLBACK_DATA *data;
+	if (slot < 0 || slot >= callbackChunkCount * MAX_CALLBACKS) return JNI_FALSE;
+	data = CALLBACK_SLOT(slot);
+	if (data->callback == NULL || data->retired || !data->isWeak) return JNI_FALSE;
+	return (*env)->IsSameObject(env, data->object, NULL);
 }
 
 JNIEXPORT void JNICALL CALLBACK_NATIVE(reset)
   (JNIEnv *env, jclass that)
 {
-    memset((void *)&callbackData, 0, sizeof(callbackData));
+	int i;
+	for (i=0; i<callbackChunkCount * MAX_CALLBACKS; i++) {
+		CALLBACK_DATA *data = CALLBACK_SLOT(i);
+		if (data->callback != NULL && !data->retired) retireCallbackSlot(i);
+	}
+	reclaimCallbackSlots(env);
+	clearTargets(env);
 }
 
-jintLong callback(int index, ...)
+JNIEXPORT jboolean JNICALL CALLBACK_NATIVE(setTarget)
+  (JNIEnv *env, jclass that, jintLong handle, jobject target)
+{
+	CALLBACK_TARGET *entry;
+	if (handle == 0) return JNI_FALSE;
+	entry = findTarget(handle);
+	if (entry != NULL && entry->target != NULL) {
+		(*env)->DeleteGlobalRef(env, entry->target);
+		entry->target = NULL;
+		targetCount--;
+	}
+	if (target == NULL) return JNI_TRUE;
+	if (entry == NULL) {
+		int i;
+		/* Keep the table at most half full, counting removed entries */
+		if ((targetUsed + 1) * 2 > targetCapacity) {
+			int capacity = targetCapacity < MIN_TARGETS ? MIN_TARGETS : targetCapacity;
+			while ((targetCount + 1) * 4 > capacity) capacity *= 2;
+			if (!growTargets(capacity)) return JNI_FALSE;
+		}
+		i = targetHash(handle);
+		while (callbackTargets[i].handle != 0) i = (i + 1) & (targetCapacity - 1);
+		entry = &callbackTargets[i];
+		entry->handle = handle;
+		targetUsed++;
+	}
+	if ((entry->target = (*env)->NewGlobalRef(env, target)) == NULL) return JNI_FALSE;
+	targetCount++;
+	return JNI_TRUE;
+}
+
+JNIEXPORT jobject JNICALL CALLBACK_NATIVE(getTarget)
+  (JNIEnv *env, jclass that, jintLong handle)
+{
+	CALLBACK_TARGET *entry = findTarget(handle);
+	return entry != NULL ? entry->target : NULL;
+}
+
+static jintLong callbackA(int index, jvalue *args)
 {
-	if (!callbackEnabled) return 0;
+	CALLBACK_DATA *data = CALLBACK_SLOT(index);
+	CALLBACK_THREAD *thread = getThreadData(0);
+	if (!callbackEnabled || (thread != NULL && thread->disabled)) return 0;
+
+	/* Keep the slot from being reclaimed while the callback runs */
+	ATOMIC_INC(data->busy);
+	if (ATOMIC_LOAD(data->retired)) {
+		jintLong result = data->errorResult;
+		ATOMIC_DEC(data->busy);
+		return result;
+	}
 
 	{
 	JNIEnv *env = NULL;
-	jmethodID mid = callbackData[index].methodID;
-	jobject object = callbackData[index].object;
-	jboolean isStatic = callbackData[index].isStatic;
-	jboolean isArrayBased = callbackData[index].isArrayBased;
-	jint argCount = callbackData[index].argCount;
-	jintLong result = callbackData[index].errorResult;
+	CALLBACK_STATS *stats = NULL;
+	jlong startTime = 0;
+	jmethodID mid = data->methodID;
+	jobject object = data->object;
+	jboolean isStatic = data->isStatic;
+	jboolean isArrayBased = data->isArrayBased;
+	jint argCount = data->argCount;
+	jintLong result = data->errorResult;
 	jthrowable ex;
 	int detach = 0;
-	va_list vl;
 
 #ifdef DEBUG_CALL_PRINTS
 	fprintf(stderr, "* callback starting %d\n", counter++);
 #endif
 
+	/* A thread attached by a previous callback keeps its env */
+	if (thread != NULL) env = thread->env;
+
 #ifdef JNI_VERSION_1_2
-	if (IS_JNI_1_2) {
-		(*jvm)->GetEnv(jvm, (void **)&env, JNI_VERSION_1_2);
+	if (env == NULL) {
+		if (IS_JNI_1_2) {
+			(*jvm)->GetEnv(jvm, (void **)&env, JNI_VERSION_1_2);
+		}
 	}
 #endif
 	
-#ifdef JNI_VERSION_1_4
 	if (env == NULL) {
+#ifdef JNI_VERSION_1_4
 		if (JNI_VERSION >= JNI_VERSION_1_4) {
 			(*jvm)->AttachCurrentThreadAsDaemon(jvm, (void **)&env, NULL);
 		}
-	}
 #endif
-	
-	if (env == NULL) {
-		(*jvm)->AttachCurrentThread(jvm, (void **)&env, NULL);
-		if (IS_JNI_1_2) detach = 1;
+		if (env == NULL) {
+			(*jvm)->AttachCurrentThread(jvm, (void **)&env, NULL);
+			if (IS_JNI_1_2) detach = 1;
+		}
+
+#if !(defined (_WIN32) || defined (_WIN32_WCE))
+		/* Keep the thread attached until it exits */
+		if (env != NULL) {
+			if (thread == NULL) thread = newThreadData();
+			if (thread != NULL) {
+				thread->env = env;
+				detach = 0;
+			}
+		}
+#endif
 	}
 	
 	/* If the current thread is not attached to the VM, it is not possible to call into the VM */
@@ -1213,40 +2187,85 @@ jintLong callback(int index, ...)
 		goto done;
 	}
 
+	/* If the object of a weak callback was collected, return the error result. */
+#ifdef JNI_VERSION_1_2
+	if (data->isWeak) {
+		if ((object = (*env)->NewLocalRef(env, object)) == NULL) goto done;
+	}
+#endif
+
 	/* Call into the VM. */
-	ATOMIC_INC(callbackEntryCount);
-	va_start(vl, index);
+	if (thread == NULL) thread = newThreadData();
+	if (thread != NULL) {
+		thread->entryCount++;
+	} else {
+		ATOMIC_INC(callbackEntryCount);
+	}
+	WATCHDOG_CALLBACK_ENTER(index)
+	if (callbackStatsEnabled && (stats = data->stats) != NULL) startTime = currentTime();
 	if (isArrayBased) {
-		int i;
-		jintLongArray argsArray = (*env)->NewIntLongArray(env, argCount);
-		if (argsArray != NULL) {
-			jintLong *elements = (*env)->GetIntLongArrayElements(env, argsArray, NULL);
-			if (elements != NULL) {
-				for (i=0; i<argCount; i++) {
-					elements[i] = va_arg(vl, jintLong); 
-				}
-				(*env)->ReleaseIntLongArrayElements(env, argsArray, elements, 0);
-				if (isStatic) {
-					result = (*env)->CallStaticIntLongMethod(env, object, mid, argsArray);
-				} else {
-					result = (*env)->CallIntLongMethod(env, object, mid, argsArray);
+		int i, depth = -1;
+		jintLong elements[MAX_ARGS];
+		jintLongArray argsArray = NULL;
+		if (thread != NULL && thread->env != NULL) {
+			depth = thread->depth[argCount]++;
+			if (depth < MAX_ARRAY_DEPTH) {
+				argsArray = thread->arrays[argCount][depth];
+				if (argsArray == NULL) {
+					jintLongArray array = (*env)->NewIntLongArray(env, argCount);
+					if (array != NULL) {
+						argsArray = thread->arrays[argCount][depth] = (*env)->NewGlobalRef(env, array);
+						(*env)->DeleteLocalRef(env, array);
+					}
 				}
 			}
+		}
+		if (depth == -1 || depth >= MAX_ARRAY_DEPTH) argsArray = (*env)->NewIntLongArray(env, argCount);
+		if (argsArray != NULL) {
+			for (i=0; i<argCount; i++) {
+				elements[i] = INT_LONG_VALUE(args[i]);
+			}
+			(*env)->SetIntLongArrayRegion(env, argsArray, 0, argCount, elements);
+			if (isStatic) {
+				result = (*env)->CallStaticIntLongMethod(env, object, mid, argsArray);
+			} else {
+				result = (*env)->CallIntLongMethod(env, object, mid, argsArray);
+			}
 			/*
 			* This function may be called many times before returning to Java,
 			* explicitly delete local references to avoid GP's in certain VMs.
 			*/
-			(*env)->DeleteLocalRef(env, argsArray);
+			if (depth == -1 || depth >= MAX_ARRAY_DEPTH) (*env)->DeleteLocalRef(env, argsArray);
+		}
+		if (depth != -1) thread->depth[argCount]--;
+	} else if (data->resolvesTarget) {
+		int i;
+		jvalue targetArgs[MAX_ARGS + 1];
+		CALLBACK_TARGET *entry = findTarget(INT_LONG_VALUE(args[0]));
+		targetArgs[0].l = entry != NULL ? entry->target : NULL;
+		for (i=0; i<argCount; i++) {
+			targetArgs[i + 1] = args[i];
+		}
+		if (isStatic) {
+			result = (*env)->CallStaticIntLongMethodA(env, object, mid, targetArgs);
+		} else {
+			result = (*env)->CallIntLongMethodA(env, object, mid, targetArgs);
 		}
 	} else {
 		if (isStatic) {
-			result = (*env)->CallStaticIntLongMethodV(env, object, mid, vl);
+			result = (*env)->CallStaticIntLongMethodA(env, object, mid, args);
 		} else {
-			result = (*env)->CallIntLongMethodV(env, object, mid, vl);
+			result = (*env)->CallIntLongMethodA(env, object, mid, args);
 		}
 	}
-	va_end(vl);
-	ATOMIC_DEC(callbackEntryCount);
+	if (stats != NULL) recordStats(stats, currentTime() - startTime);
+	if (data->isWeak) (*env)->DeleteLocalRef(env, object);
+	WATCHDOG_CALLBACK_EXIT()
+	if (thread != NULL) {
+		thread->entryCount--;
+	} else {
+		ATOMIC_DEC(callbackEntryCount);
+	}
 
 done:
 	/* If an exception has occurred in Java, return the error result. */
@@ -1256,7 +2275,7 @@ done:
 		fprintf(stderr, "* java exception occurred\n");
 		(*env)->ExceptionDescribe(env);
 #endif
-		result = callbackData[index].errorResult;
+		result = data->errorResult;
 	}
 
 	if (detach) {
@@ -1265,6 +2284,7 @@ done:
 	}
 
 noEnv:
+	ATOMIC_DEC(data->busy);
 
 #ifdef DEBUG_CALL_PRINTS
 	fprintf(stderr, "* callback exiting %d\n", --counter);
@@ -1274,4 +2294,83 @@ noEnv:
 	}
 }
 
+jintLong callback(int index, ...)
+{
+	int i;
+	jvalue args[MAX_ARGS];
+	va_list vl;
+	va_start(vl, index);
+	for (i=0; i<CALLBACK_SLOT(index)->argCount; i++) {
+		INT_LONG_VALUE(args[i]) = va_arg(vl, jintLong);
+	}
+	va_end(vl);
+	return callbackA(index, args);
+}
+
+/*
+* The dispatchers for callbacks with up to MAX_FAST_ARGS arguments are
+* not variadic and do not decode a va_list.
+*/
+static jintLong callback0(int index)
+{
+	return callbackA(index, NULL);
+}
+
+static jintLong callback1(int index, jintLong p1)
+{
+	jvalue args[1];
+	INT_LONG_VALUE(args[0]) = p1;
+	return callbackA(index, args);
+}
+
+static jintLong callback2(int index, jintLong p1, jintLong p2)
+{
+	jvalue args[2];
+	INT_LONG_VALUE(args[0]) = p1;
+	INT_LONG_VALUE(args[1]) = p2;
+	return callbackA(index, args);
+}
+
+static jintLong callback3(int index, jintLong p1, jintLong p2, jintLong p3)
+{
+	jvalue args[3];
+	INT_LONG_VALUE(args[0]) = p1;
+	INT_LONG_VALUE(args[1]) = p2;
+	INT_LONG_VALUE(args[2]) = p3;
+	return callbackA(index, args);
+}
+
+static jintLong callback4(int index, jintLong p1, jintLong p2, jintLong p3, jintLong p4)
+{
+	jvalue args[4];
+	INT_LONG_VALUE(args[0]) = p1;
+	INT_LONG_VALUE(args[1]) = p2;
+	INT_LONG_VALUE(args[2]) = p3;
+	INT_LONG_VALUE(args[3]) = p4;
+	return callbackA(index, args);
+}
+
+static jintLong callback5(int index, jintLong p1, jintLong p2, jintLong p3, jintLong p4, jintLong p5)
+{
+	jvalue args[5];
+	INT_LONG_VALUE(args[0]) = p1;
+	INT_LONG_VALUE(args[1]) = p2;
+	INT_LONG_VALUE(args[2]) = p3;
+	INT_LONG_VALUE(args[3]) = p4;
+	INT_LONG_VALUE(args[4]) = p5;
+	return callbackA(index, args);
+}
+
+static jintLong callback6(int index, jintLong p1, jintLong p2, jintLong p3, jintLong p4, jintLong p5, jintLong p6)
+{
+	jvalue args[6];
+	INT_LONG_VALUE(args[0]) = p1;
+	INT_LONG_VALUE(args[1]) = p2;
+	INT_LONG_VALUE(args[2]) = p3;
+	INT_LONG_VALUE(args[3]) = p4;
+	INT_LONG_VALUE(args[4]) = p5;
+	INT_LONG_VALUE(args[5]) = p6;
+	return callbackA(index, args);
+}
+
 /* ------------- callback class calls end --------------- */
@@ -36,9 +36,17 @@
 #endif
 
 /*
-* Note that only x86 assembler is supported
+* Note that only x86, x86-64 and AArch64 assembler is supported
 */
-#if !(defined(__i386__) || defined(_M_IX86) || defined(_X86_))
+#if defined(__i386__) || defined(_M_IX86) || defined(_X86_)
+#define THUNK_X86
+#elif (defined(__x86_64__) || defined(_M_X64)) && defined(_WIN64)
+#define THUNK_WIN64
+#elif defined(__x86_64__)
+#define THUNK_X86_64
+#elif defined(__aarch64__) && !defined(_WIN32)
+#define THUNK_AARCH64
+#else
 #undef USE_ASSEMBLER
 #endif
 
@@ -54,15 +62,45 @@
 
 #define MAX_ARGS 12
 
+/*
+* Latency histogram buckets: values below 4ns have their own bucket,
+* every following power of two is split in 4 linear buckets.
+*/
+#define STATS_BUCKETS 128
+
+typedef struct CALLBACK_STATS {
+	jlong count;
+	jlong totalTime;
+	jlong maxTime;
+	jlong histogram[STATS_BUCKETS];
+} CALLBACK_STATS;
+
 typedef struct CALLBACK_DATA {
     jobject callback;
     jmethodID methodID;
   	jobject object;
 	jboolean isStatic;
 	jboolean isArrayBased; 
+	jboolean resolvesTarget;
+	jboolean isWeak;
 	jint argCount;
 	jintLong errorResult;
+	CALLBACK_STATS *stats;
+	int nextFree;
+	volatile int busy;
+	volatile int retired;
 } CALLBACK_DATA;
 
+typedef struct CALLBACK_CHUNK {
+	CALLBACK_DATA *data;
+#ifdef USE_ASSEMBLER
+	unsigned char *code;
+	unsigned char *writeCode;
+#endif
+} CALLBACK_CHUNK;
+
+/* Frees the callback state of the current thread, without calling the VM */
+void callback_thread_detach();
+
 #endif /* ifndef INC_callback_H */
 
@@ -0,0 +1,195 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+
+/**
+ * jpeg.c
+ *
+ * This file contains the JPEG decoder used by JPEGFileFormat when the
+ * system libjpeg is available.  The image is decoded from a copy of the
+ * Java byte array, reduced in the DCT domain when a scale is given, and
+ * written row by row into the image data, so that no Java array is
+ * pinned while libjpeg runs.
+ *
+ * Errors reported by libjpeg unwind to the native that started the
+ * decode, which then returns false.
+ */
+
+#include "swt.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include <jpeglib.h>
+
+#define JPEG_NATIVE(func) Java_org_eclipse_swt_internal_JPEGCodec_##func
+
+typedef struct {
+	struct jpeg_error_mgr pub;
+	jmp_buf setjmp_buffer;
+} error_mgr;
+
+static void errorExit(j_common_ptr cinfo)
+{
+	longjmp(((error_mgr *)cinfo->err)->setjmp_buffer, 1);
+}
+
+static void outputMessage(j_common_ptr cinfo)
+{
+}
+
+static const JOCTET EOI_MARKER[2] = {0xFF, JPEG_EOI};
+
+static void initSource(j_decompress_ptr cinfo)
+{
+}
+
+/* Called only when the data is truncated, ends the image as libjpeg does */
+static boolean fillInputBuffer(j_decompress_ptr cinfo)
+{
+	cinfo->src->next_input_byte = EOI_MARKER;
+	cinfo->src->bytes_in_buffer = 2;
+	return TRUE;
+}
+
+static void skipInputData(j_decompress_ptr cinfo, long count)
+{
+	struct jpeg_source_mgr *src = cinfo->src;
+	if (count <= 0) return;
+	if ((size_t)count > src->bytes_in_buffer) {
+		fillInputBuffer(cinfo);
+	} else {
+		src->next_input_byte += count;
+		src->bytes_in_buffer -= count;
+	}
+}
+
+static void termSource(j_decompress_ptr cinfo)
+{
+}
+
+/*
+* Reads the header and computes the output size for the scale, storing
+* the width, height, bytes per pixel and progressive flag in result.
+* When pixels is not NULL, the image is then decoded into it, BGR for
+* color images and one byte per pixel for grayscale ones.
+*/
+static jboolean decodeImage(JNIEnv *env, jbyteArray data, jint offset, jint length, jint scale, jint *result, jbyteArray pixels, jint pixelsOffset, jint stride)
+{
+	struct jpeg_decompress_struct cinfo;
+	struct jpeg_source_mgr src;
+	error_mgr err;
+	JOCTET * volatile input = NULL;
+	JSAMPLE * volatile row = NULL;
+	volatile jboolean created = JNI_FALSE;
+	jboolean rc = JNI_FALSE;
+	jint rowBytes;
+	if (data == NULL || offset < 0 || length <= 0) return JNI_FALSE;
+	if (scale != 1 && scale != 2 && scale != 4 && scale != 8) return JNI_FALSE;
+	if (offset > (*env)->GetArrayLength(env, data) - length) return JNI_FALSE;
+	if ((input = malloc(length)) == NULL) return JNI_FALSE;
+	(*env)->GetByteArrayRegion(env, data, offset, length, (jbyte *)input);
+
+	cinfo.err = jpeg_std_error(&err.pub);
+	err.pub.error_exit = errorExit;
+	err.pub.output_message = outputMessage;
+	if (setjmp(err.setjmp_buffer)) goto fail;
+	jpeg_create_decompress(&cinfo);
+	created = JNI_TRUE;
+	src.init_source = initSource;
+	src.fill_input_buffer = fillInputBuffer;
+	src.skip_input_data = skipInputData;
+	src.resync_to_restart = jpeg_resync_to_restart;
+	src.term_source = termSource;
+	src.next_input_byte = input;
+	src.bytes_in_buffer = length;
+	cinfo.src = &src;
+
+	jpeg_read_header(&cinfo, TRUE);
+	switch (cinfo.jpeg_color_space) {
+		case JCS_GRAYSCALE:
+			cinfo.out_color_space = JCS_GRAYSCALE;
+			break;
+		case JCS_RGB:
+		case JCS_YCbCr:
+#ifdef JCS_EXTENSIONS
+			cinfo.out_color_space = JCS_EXT_BGR;
+#else
+			cinfo.out_color_space = JCS_RGB;
+#endif
+			break;
+		default:
+			/* CMYK and YCCK are left to the Java decoder */
+			goto fail;
+	}
+	cinfo.scale_num = 1;
+	cinfo.scale_denom = scale;
+	jpeg_calc_output_dimensions(&cinfo);
+	result[0] = cinfo.output_width;
+	result[1] = cinfo.output_height;
+	result[2] = cinfo.output_components;
+	result[3] = jpeg_has_multiple_scans(&cinfo);
+
+	if (pixels != NULL) {
+		rowBytes = cinfo.output_width * cinfo.output_components;
+		if (pixelsOffset < 0 || stride < rowBytes) goto fail;
+		if (pixelsOffset + (jlong)(cinfo.output_height - 1) * stride + rowBytes > (*env)->GetArrayLength(env, pixels)) goto fail;
+		if ((row = malloc(rowBytes)) == NULL) goto fail;
+		jpeg_start_decompress(&cinfo);
+		while (cinfo.output_scanline < cinfo.output_height) {
+			JSAMPROW rows[1];
+			jint y = cinfo.output_scanline;
+			rows[0] = row;
+			if (jpeg_read_scanlines(&cinfo, rows, 1) != 1) goto fail;
+#ifndef JCS_EXTENSIONS
+			if (cinfo.output_components == 3) {
+				jint x;
+				for (x = 0; x < rowBytes; x += 3) {
+					JSAMPLE red = row[x];
+					row[x] = row[x + 2];
+					row[x + 2] = red;
+				}
+			}
+#endif
+			(*env)->SetByteArrayRegion(env, pixels, pixelsOffset + y * stride, rowBytes, (jbyte *)row);
+		}
+		jpeg_finish_decompress(&cinfo);
+	}
+	rc = JNI_TRUE;
+
+fail:
+	if (created) jpeg_destroy_decompress(&cinfo);
+	free(row);
+	free(input);
+	return rc;
+}
+
+#ifndef NO_getInfo
+JNIEXPORT jboolean JNICALL JPEG_NATIVE(getInfo)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jint arg3, jintArray arg4)
+{
+	jint info[4];
+	if (arg4 == NULL || (*env)->GetArrayLength(env, arg4) < 4) return JNI_FALSE;
+	if (!decodeImage(env, arg0, arg1, arg2, arg3, info, NULL, 0, 0)) return JNI_FALSE;
+	(*env)->SetIntArrayRegion(env, arg4, 0, 4, info);
+	return JNI_TRUE;
+}
+#endif
+
+#ifndef NO_decode
+JNIEXPORT jboolean JNICALL JPEG_NATIVE(decode)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jint arg3, jbyteArray arg4, jint arg5, jint arg6)
+{
+	jint info[4];
+	if (arg4 == NULL) return JNI_FALSE;
+	return decodeImage(env, arg0, arg1, arg2, arg3, info, arg4, arg5, arg6);
+}
+#endif
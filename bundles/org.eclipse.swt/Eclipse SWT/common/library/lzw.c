@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+
+/**
+ * lzw.c
+ *
+ * This file contains the LZW decoder used by the GIF decoder.  It
+ * follows LZWCodec.decode() code for code, but reads the codes from
+ * the data sub-blocks of a frame that were read into memory and writes
+ * the pixels straight into the rows of the image, in interlaced order
+ * when the frame is interlaced.
+ */
+
+#include "swt.h"
+
+#include <string.h>
+
+#define LZW_NATIVE(func) Java_org_eclipse_swt_internal_LZW_##func
+
+#define MAX_CODES 4096
+
+typedef struct {
+	unsigned char *pixels;
+	jint width, height, stride, interlaced;
+	jint x, line, pass, count;
+	unsigned char *row;
+} output;
+
+/* Moves to the next row, in the order of the GIF interlace passes */
+static void nextRow(output *out)
+{
+	out->x = 0;
+	if (out->interlaced) {
+		static const jint step[] = {8, 8, 4, 2}, start[] = {0, 4, 2, 1};
+		out->line += step[out->pass];
+		while (out->line >= out->height && out->pass < 3) {
+			out->pass++;
+			out->line = start[out->pass];
+		}
+	} else {
+		out->line++;
+	}
+	out->row = out->line < out->height ? out->pixels + (jlong)out->line * out->stride : NULL;
+}
+
+/* Stores a pixel, returns 0 once the image is full */
+static int putPixel(output *out, int pixel)
+{
+	if (out->row == NULL) return 0;
+	out->row[out->x++] = (unsigned char)pixel;
+	out->count++;
+	if (out->x == out->width) nextRow(out);
+	return out->row != NULL;
+}
+
+static jint decode(const unsigned char *data, jint length, jint bitsPerPixel, output *out)
+{
+	unsigned short prefix[MAX_CODES];
+	unsigned char suffix[MAX_CODES], stack[MAX_CODES + 1];
+	jint clearCode = 1 << bitsPerPixel, endCode = clearCode + 1, newCodes = endCode + 1;
+	jint codeSize = bitsPerPixel + 1, codeMask = (1 << codeSize) - 1;
+	jint topSlot = 1 << codeSize, currentSlot = newCodes;
+	jint oc = 0, fc = 0, index = 0, blockLeft = 0, bits = 0, c;
+	unsigned int buffer = 0;
+
+	/* Codes that corrupt data refers to before defining them decode to 0 */
+	memset(prefix, 0, sizeof(prefix));
+	memset(suffix, 0, sizeof(suffix));
+	for (;;) {
+		while (bits < codeSize) {
+			/* Each sub-block starts with its size, the last one is empty */
+			if (blockLeft == 0) {
+				if (index >= length || (blockLeft = data[index++]) == 0) return out->count;
+			}
+			if (index >= length) return out->count;
+			buffer |= (unsigned int)data[index++] << bits;
+			bits += 8;
+			blockLeft--;
+		}
+		c = buffer & codeMask;
+		buffer >>= codeSize;
+		bits -= codeSize;
+		if (c == endCode) break;
+		if (c == clearCode) {
+			codeSize = bitsPerPixel + 1;
+			codeMask = (1 << codeSize) - 1;
+			currentSlot = newCodes;
+			topSlot = 1 << codeSize;
+			oc = -1;
+			continue;
+		}
+		if (oc == -1) {
+			/* The first code after a clear code is a pixel */
+			oc = fc = c;
+			if (!putPixel(out, c)) break;
+		} else {
+			jint code = c, stackIndex = 0;
+			if (code >= currentSlot) {
+				code = oc;
+				stack[stackIndex++] = fc;
+			}
+			while (code >= newCodes) {
+				if (stackIndex == MAX_CODES) return -1;
+				stack[stackIndex++] = suffix[code];
+				code = prefix[code];
+			}
+			stack[stackIndex++] = code;
+			if (currentSlot < topSlot) {
+				fc = code;
+				suffix[currentSlot] = fc;
+				prefix[currentSlot] = oc;
+				currentSlot++;
+				oc = c;
+			}
+			if (currentSlot >= topSlot && codeSize < 12) {
+				codeSize++;
+				codeMask = (1 << codeSize) - 1;
+				topSlot += topSlot;
+			}
+			while (stackIndex > 0) {
+				if (!putPixel(out, stack[--stackIndex])) return out->count;
+			}
+		}
+	}
+	return out->count;
+}
+
+#ifndef NO_decode
+JNIEXPORT jint JNICALL LZW_NATIVE(decode)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jint arg3, jbyteArray arg4, jint arg5, jint arg6, jint arg7, jint arg8, jboolean arg9)
+{
+	jbyte *data = NULL, *pixels = NULL;
+	output out;
+	jint rc;
+	if (arg0 == NULL || arg4 == NULL) return -1;
+	if (arg1 < 0 || arg2 < 0 || arg1 > (*env)->GetArrayLength(env, arg0) - arg2) return -1;
+	if (arg3 < 1 || arg3 > 11) return -1;
+	if (arg6 <= 0 || arg7 <= 0 || arg8 < arg6) return -1;
+	if (arg5 < 0 || arg5 + (jlong)(arg7 - 1) * arg8 + arg6 > (*env)->GetArrayLength(env, arg4)) return -1;
+	if ((data = lockArray(env, arg0, 'B')) == NULL) return -1;
+	if ((pixels = lockArray(env, arg4, 'B')) == NULL) {
+		unlockArray(env, arg0, data, 'B', JNI_ABORT);
+		return -1;
+	}
+	out.pixels = (unsigned char *)pixels + arg5;
+	out.width = arg6;
+	out.height = arg7;
+	out.stride = arg8;
+	out.interlaced = arg9;
+	out.x = out.line = out.pass = out.count = 0;
+	out.row = out.pixels;
+	rc = decode((unsigned char *)data + arg1, arg2, arg3, &out);
+	unlockArray(env, arg4, pixels, 'B', 0);
+	unlockArray(env, arg0, data, 'B', JNI_ABORT);
+	return rc;
+}
+#endif
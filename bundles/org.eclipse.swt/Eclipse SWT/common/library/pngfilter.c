@@ -0,0 +1,294 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+
+/**
+ * pngfilter.c
+ *
+ * This file contains the scanline unfiltering used by the PNG decoder
+ * and the adaptive filtering used by the PNG encoder.
+ *
+ * The Sub, Average and Paeth filters depend on the pixel to the left,
+ * so their vector paths work one pixel at a time with all of its bytes
+ * in one register.  They are used for 3 and 4 byte pixels when the
+ * compiler targets SSE2.  The Up filter has no such dependency and
+ * works 16 bytes at a time.
+ *
+ * The encoder tries every filter on each row and keeps the one whose
+ * bytes, taken as signed values, have the smallest sum of magnitudes.
+ */
+
+#include "swt.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PNGFILTER_SSE2
+#include <emmintrin.h>
+#endif
+
+#define PNGFILTER_NATIVE(func) Java_org_eclipse_swt_internal_PngFilter_##func
+
+#define FILTER_NONE 0
+#define FILTER_SUB 1
+#define FILTER_UP 2
+#define FILTER_AVERAGE 3
+#define FILTER_PAETH 4
+
+#if defined(PNGFILTER_SSE2)
+static __m128i loadPixel(const unsigned char *p, int bpp)
+{
+	int value = 0;
+	memcpy(&value, p, bpp);
+	return _mm_cvtsi32_si128(value);
+}
+
+static void storePixel(unsigned char *p, __m128i pixel, int bpp)
+{
+	int value = _mm_cvtsi128_si32(pixel);
+	memcpy(p, &value, bpp);
+}
+
+static __m128i abs16(__m128i x)
+{
+	return _mm_max_epi16(x, _mm_sub_epi16(_mm_setzero_si128(), x));
+}
+
+static __m128i select128(__m128i mask, __m128i a, __m128i b)
+{
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+#endif
+
+static void unfilterSub(unsigned char *row, jint length, jint bpp)
+{
+	jint i = bpp;
+#if defined(PNGFILTER_SSE2)
+	if (bpp == 3 || bpp == 4) {
+		__m128i a = _mm_setzero_si128();
+		for (i = 0; i + bpp <= length; i += bpp) {
+			a = _mm_add_epi8(a, loadPixel(row + i, bpp));
+			storePixel(row + i, a, bpp);
+		}
+		if (i < bpp) i = bpp;
+	}
+#endif
+	for (; i < length; i++) {
+		row[i] = (unsigned char)(row[i] + row[i - bpp]);
+	}
+}
+
+static void unfilterUp(unsigned char *row, const unsigned char *prev, jint length)
+{
+	jint i = 0;
+#if defined(PNGFILTER_SSE2)
+	for (; i + 16 <= length; i += 16) {
+		__m128i x = _mm_loadu_si128((const __m128i *)(row + i));
+		__m128i b = _mm_loadu_si128((const __m128i *)(prev + i));
+		_mm_storeu_si128((__m128i *)(row + i), _mm_add_epi8(x, b));
+	}
+#endif
+	for (; i < length; i++) {
+		row[i] = (unsigned char)(row[i] + prev[i]);
+	}
+}
+
+static void unfilterAverage(unsigned char *row, const unsigned char *prev, jint length, jint bpp)
+{
+	jint i = 0;
+#if defined(PNGFILTER_SSE2)
+	if (bpp == 3 || bpp == 4) {
+		__m128i a = _mm_setzero_si128(), one = _mm_set1_epi8(1);
+		for (; i + bpp <= length; i += bpp) {
+			__m128i b = loadPixel(prev + i, bpp);
+			/* _mm_avg_epu8 rounds up, the filter rounds down */
+			__m128i average = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+			a = _mm_add_epi8(loadPixel(row + i, bpp), average);
+			storePixel(row + i, a, bpp);
+		}
+	}
+#endif
+	for (; i < length && i < bpp; i++) {
+		row[i] = (unsigned char)(row[i] + (prev[i] >> 1));
+	}
+	for (; i < length; i++) {
+		row[i] = (unsigned char)(row[i] + ((row[i - bpp] + prev[i]) >> 1));
+	}
+}
+
+static void unfilterPaeth(unsigned char *row, const unsigned char *prev, jint length, jint bpp)
+{
+	jint i = 0;
+#if defined(PNGFILTER_SSE2)
+	if (bpp == 3 || bpp == 4) {
+		__m128i zero = _mm_setzero_si128(), a = zero, c = zero;
+		for (; i + bpp <= length; i += bpp) {
+			__m128i b = _mm_unpacklo_epi8(loadPixel(prev + i, bpp), zero);
+			__m128i x = _mm_unpacklo_epi8(loadPixel(row + i, bpp), zero);
+			__m128i pa = _mm_sub_epi16(b, c);
+			__m128i pb = _mm_sub_epi16(a, c);
+			__m128i pc = abs16(_mm_add_epi16(pa, pb));
+			__m128i smallest;
+			pa = abs16(pa);
+			pb = abs16(pb);
+			smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+			/* Ties favor the left byte, then the byte above */
+			x = _mm_add_epi8(x, select128(_mm_cmpeq_epi16(smallest, pa), a, select128(_mm_cmpeq_epi16(smallest, pb), b, c)));
+			storePixel(row + i, _mm_packus_epi16(x, x), bpp);
+			a = x;
+			c = b;
+		}
+	}
+#endif
+	for (; i < length && i < bpp; i++) {
+		row[i] = (unsigned char)(row[i] + prev[i]);
+	}
+	for (; i < length; i++) {
+		int left = row[i - bpp], above = prev[i], aboveLeft = prev[i - bpp];
+		int pa = abs(above - aboveLeft), pb = abs(left - aboveLeft), pc = abs(left + above - 2 * aboveLeft);
+		int predictor = (pa <= pb && pa <= pc) ? left : (pb <= pc ? above : aboveLeft);
+		row[i] = (unsigned char)(row[i] + predictor);
+	}
+}
+
+#ifndef NO_unfilter
+JNIEXPORT jboolean JNICALL PNGFILTER_NATIVE(unfilter)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jbyteArray arg6, jint arg7)
+{
+	jbyte *data = NULL, *filters = NULL;
+	unsigned char *zero;
+	jint y;
+	if (arg0 == NULL || arg6 == NULL) return JNI_FALSE;
+	if (arg3 <= 0 || arg4 <= 0 || arg2 < arg3 || arg5 < 1 || arg5 > 8) return JNI_FALSE;
+	if (arg1 < 0 || arg1 + (jlong)(arg4 - 1) * arg2 + arg3 > (*env)->GetArrayLength(env, arg0)) return JNI_FALSE;
+	if (arg7 < 0 || arg7 + (jlong)arg4 > (*env)->GetArrayLength(env, arg6)) return JNI_FALSE;
+	/* The first row is filtered against a row of zeros */
+	if ((zero = calloc(arg3, 1)) == NULL) return JNI_FALSE;
+	if ((filters = lockArray(env, arg6, 'B')) == NULL) {
+		free(zero);
+		return JNI_FALSE;
+	}
+	if ((data = lockArray(env, arg0, 'B')) == NULL) {
+		unlockArray(env, arg6, filters, 'B', JNI_ABORT);
+		free(zero);
+		return JNI_FALSE;
+	}
+	for (y = 0; y < arg4; y++) {
+		unsigned char *row = (unsigned char *)data + arg1 + (jlong)y * arg2;
+		const unsigned char *prev = y == 0 ? zero : row - arg2;
+		switch (filters[arg7 + y]) {
+			case FILTER_SUB: unfilterSub(row, arg3, arg5); break;
+			case FILTER_UP: unfilterUp(row, prev, arg3); break;
+			case FILTER_AVERAGE: unfilterAverage(row, prev, arg3, arg5); break;
+			case FILTER_PAETH: unfilterPaeth(row, prev, arg3, arg5); break;
+		}
+	}
+	unlockArray(env, arg0, data, 'B', 0);
+	unlockArray(env, arg6, filters, 'B', JNI_ABORT);
+	free(zero);
+	return JNI_TRUE;
+}
+#endif
+
+static void filterRow(const unsigned char *row, const unsigned char *prev, jint length, jint bpp, jint type, unsigned char *out)
+{
+	jint i;
+	switch (type) {
+		case FILTER_SUB:
+			for (i = 0; i < length; i++) {
+				out[i] = (unsigned char)(row[i] - (i < bpp ? 0 : row[i - bpp]));
+			}
+			break;
+		case FILTER_UP:
+			for (i = 0; i < length; i++) {
+				out[i] = (unsigned char)(row[i] - prev[i]);
+			}
+			break;
+		case FILTER_AVERAGE:
+			for (i = 0; i < length; i++) {
+				out[i] = (unsigned char)(row[i] - (((i < bpp ? 0 : row[i - bpp]) + prev[i]) >> 1));
+			}
+			break;
+		case FILTER_PAETH:
+			for (i = 0; i < length; i++) {
+				int left = i < bpp ? 0 : row[i - bpp], above = prev[i], aboveLeft = i < bpp ? 0 : prev[i - bpp];
+				int pa = abs(above - aboveLeft), pb = abs(left - aboveLeft), pc = abs(left + above - 2 * aboveLeft);
+				int predictor = (pa <= pb && pa <= pc) ? left : (pb <= pc ? above : aboveLeft);
+				out[i] = (unsigned char)(row[i] - predictor);
+			}
+			break;
+		default:
+			memcpy(out, row, length);
+	}
+}
+
+static jlong filterCost(const unsigned char *out, jint length)
+{
+	jlong cost = 0;
+	jint i;
+	for (i = 0; i < length; i++) {
+		cost += out[i] < 128 ? out[i] : 256 - out[i];
+	}
+	return cost;
+}
+
+#ifndef NO_filter
+JNIEXPORT jboolean JNICALL PNGFILTER_NATIVE(filter)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jint arg3, jint arg4, jint arg5, jbyteArray arg6, jint arg7)
+{
+	jbyte *src = NULL, *dest = NULL;
+	unsigned char *zero, *best, *candidate;
+	jint y, type;
+	if (arg0 == NULL || arg6 == NULL) return JNI_FALSE;
+	if (arg3 <= 0 || arg4 <= 0 || arg2 < arg3 || arg5 < 1 || arg5 > 8) return JNI_FALSE;
+	if (arg1 < 0 || arg1 + (jlong)(arg4 - 1) * arg2 + arg3 > (*env)->GetArrayLength(env, arg0)) return JNI_FALSE;
+	if (arg7 < 0 || arg7 + (jlong)arg4 * (arg3 + 1) > (*env)->GetArrayLength(env, arg6)) return JNI_FALSE;
+	if ((zero = calloc(3 * (size_t)arg3, 1)) == NULL) return JNI_FALSE;
+	best = zero + arg3;
+	candidate = best + arg3;
+	if ((src = lockArray(env, arg0, 'B')) == NULL) {
+		free(zero);
+		return JNI_FALSE;
+	}
+	if ((dest = lockArray(env, arg6, 'B')) == NULL) {
+		unlockArray(env, arg0, src, 'B', JNI_ABORT);
+		free(zero);
+		return JNI_FALSE;
+	}
+	for (y = 0; y < arg4; y++) {
+		const unsigned char *row = (const unsigned char *)src + arg1 + (jlong)y * arg2;
+		const unsigned char *prev = y == 0 ? zero : row - arg2;
+		unsigned char *out = (unsigned char *)dest + arg7 + (jlong)y * (arg3 + 1);
+		jint bestType = FILTER_NONE;
+		jlong bestCost;
+		filterRow(row, prev, arg3, arg5, FILTER_NONE, best);
+		bestCost = filterCost(best, arg3);
+		for (type = FILTER_SUB; type <= FILTER_PAETH; type++) {
+			jlong cost;
+			filterRow(row, prev, arg3, arg5, type, candidate);
+			cost = filterCost(candidate, arg3);
+			if (cost < bestCost) {
+				unsigned char *swap = best;
+				best = candidate;
+				candidate = swap;
+				bestCost = cost;
+				bestType = type;
+			}
+		}
+		out[0] = (unsigned char)bestType;
+		memcpy(out + 1, best, arg3);
+	}
+	unlockArray(env, arg6, dest, 'B', 0);
+	unlockArray(env, arg0, src, 'B', JNI_ABORT);
+	free(zero);
+	return JNI_TRUE;
+}
+#endif
@@ -0,0 +1,276 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2014 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+
+#include "swt.h"
+
+#include <stdlib.h>
+#if defined (_WIN32) || defined (_WIN32_WCE)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+/*
+* A size class allocator for the short lived memory Java allocates with
+* C.pool_malloc, typically a struct or a string it copies in with memmove
+* and frees again within the same method.
+*
+* Each block has a header with its size class in front of it. A freed
+* block of a class goes on the free list of the calling thread, and the
+* blocks past POOL_THREAD_LIMIT go on a shared free list under a lock,
+* which in turn hands blocks past POOL_SHARED_LIMIT back to the system.
+* A thread takes from its own list first, then from the shared one, and
+* allocates from the system last. Blocks larger than the largest class
+* bypass the pool. The memory of a class is never handed to another, so
+* a pool never grows past the largest number of blocks of each class in
+* use at once plus the limits.
+*/
+
+#define POOL_CLASSES 6
+#define POOL_LARGE POOL_CLASSES
+#define POOL_HEADER 16
+#define POOL_THREAD_LIMIT 64
+#define POOL_SHARED_LIMIT 256
+
+static const size_t poolSizes[POOL_CLASSES] = {16, 32, 64, 128, 256, 1024};
+
+typedef union POOL_BLOCK {
+	union POOL_BLOCK *next;
+	int sizeClass;
+	char header[POOL_HEADER];
+} POOL_BLOCK;
+
+typedef struct POOL_LIST {
+	POOL_BLOCK *head;
+	int count;
+} POOL_LIST;
+
+typedef struct POOL_CACHE {
+	POOL_LIST lists[POOL_CLASSES];
+} POOL_CACHE;
+
+static POOL_LIST poolShared[POOL_CLASSES];
+
+#define POOL_DATA(block) ((void *)((char *)(block) + POOL_HEADER))
+#define POOL_BLOCK_OF(ptr) ((POOL_BLOCK *)((char *)(ptr) - POOL_HEADER))
+
+static void poolCacheFree(void *data);
+
+#if defined (_WIN32) || defined (_WIN32_WCE)
+static DWORD poolKey = TLS_OUT_OF_INDEXES;
+static volatile LONG poolKeyState = 0;
+static CRITICAL_SECTION poolLock;
+#define POOL_LOCK() EnterCriticalSection(&poolLock)
+#define POOL_UNLOCK() LeaveCriticalSection(&poolLock)
+
+static POOL_CACHE *poolGetCache(int create)
+{
+	POOL_CACHE *cache;
+	if (poolKeyState != 2) {
+		if (!create) return NULL;
+		if (InterlockedCompareExchange(&poolKeyState, 1, 0) == 0) {
+			InitializeCriticalSection(&poolLock);
+			poolKey = TlsAlloc();
+			InterlockedExchange(&poolKeyState, 2);
+		}
+		while (poolKeyState != 2) Sleep(0);
+	}
+	if (poolKey == TLS_OUT_OF_INDEXES) return NULL;
+	cache = (POOL_CACHE *)TlsGetValue(poolKey);
+	if (cache == NULL && create) {
+		cache = (POOL_CACHE *)calloc(1, sizeof(POOL_CACHE));
+		if (cache != NULL) TlsSetValue(poolKey, cache);
+	}
+	return cache;
+}
+
+/* Called from DllMain, Windows has no destructors for TLS slots */
+void swtPoolThreadDetach()
+{
+	POOL_CACHE *cache = poolGetCache(0);
+	if (cache == NULL) return;
+	TlsSetValue(poolKey, NULL);
+	poolCacheFree(cache);
+}
+#else
+static pthread_key_t poolKey;
+static pthread_once_t poolOnce = PTHREAD_ONCE_INIT;
+static int poolKeyFailed = 0;
+static pthread_mutex_t poolLock = PTHREAD_MUTEX_INITIALIZER;
+#define POOL_LOCK() pthread_mutex_lock(&poolLock)
+#define POOL_UNLOCK() pthread_mutex_unlock(&poolLock)
+
+static void poolInit()
+{
+	if (pthread_key_create(&poolKey, poolCacheFree) != 0) poolKeyFailed = 1;
+}
+
+static POOL_CACHE *poolGetCache(int create)
+{
+	POOL_CACHE *cache;
+	pthread_once(&poolOnce, poolInit);
+	if (poolKeyFailed) return NULL;
+	cache = (POOL_CACHE *)pthread_getspecific(poolKey);
+	if (cache == NULL && create) {
+		cache = (POOL_CACHE *)calloc(1, sizeof(POOL_CACHE));
+		if (cache != NULL) pthread_setspecific(poolKey, cache);
+	}
+	return cache;
+}
+#endif
+
+/* Gives a block to the shared list, or back to the system when the list is full */
+static void poolFreeShared(POOL_BLOCK *block, int sizeClass)
+{
+	POOL_LIST *list = &poolShared[sizeClass];
+	POOL_LOCK();
+	if (list->count < POOL_SHARED_LIMIT) {
+		block->next = list->head;
+		list->head = block;
+		list->count++;
+		block = NULL;
+	}
+	POOL_UNLOCK();
+	if (block != NULL) free(block);
+}
+
+/* The blocks of an exiting thread go to the shared lists */
+static void poolCacheFree(void *data)
+{
+	POOL_CACHE *cache = (POOL_CACHE *)data;
+	int i;
+	if (cache == NULL) return;
+	for (i = 0; i < POOL_CLASSES; i++) {
+		POOL_BLOCK *block = cache->lists[i].head;
+		while (block != NULL) {
+			POOL_BLOCK *next = block->next;
+			poolFreeShared(block, i);
+			block = next;
+		}
+	}
+	free(cache);
+}
+
+static int poolSizeClass(size_t size)
+{
+	int i;
+	for (i = 0; i < POOL_CLASSES; i++) {
+		if (size <= poolSizes[i]) return i;
+	}
+	return POOL_LARGE;
+}
+
+void *swtPoolAlloc(size_t size)
+{
+	int sizeClass = poolSizeClass(size);
+	POOL_BLOCK *block = NULL;
+	if (sizeClass != POOL_LARGE) {
+		POOL_CACHE *cache = poolGetCache(1);
+		if (cache != NULL && cache->lists[sizeClass].head != NULL) {
+			POOL_LIST *list = &cache->lists[sizeClass];
+			block = list->head;
+			list->head = block->next;
+			list->count--;
+		} else {
+			POOL_LIST *list = &poolShared[sizeClass];
+			POOL_LOCK();
+			if ((block = list->head) != NULL) {
+				list->head = block->next;
+				list->count--;
+			}
+			POOL_UNLOCK();
+		}
+		if (block == NULL) block = (POOL_BLOCK *)malloc(POOL_HEADER + poolSizes[sizeClass]);
+	} else {
+		if (size > (size_t)-1 - POOL_HEADER) return NULL;
+		block = (POOL_BLOCK *)malloc(POOL_HEADER + size);
+	}
+	if (block == NULL) return NULL;
+	block->sizeClass = sizeClass;
+	return POOL_DATA(block);
+}
+
+void swtPoolFree(void *ptr)
+{
+	POOL_BLOCK *block;
+	POOL_CACHE *cache;
+	int sizeClass;
+	if (ptr == NULL) return;
+	block = POOL_BLOCK_OF(ptr);
+	sizeClass = block->sizeClass;
+	if (sizeClass == POOL_LARGE) {
+		free(block);
+		return;
+	}
+	cache = poolGetCache(1);
+	if (cache != NULL && cache->lists[sizeClass].count < POOL_THREAD_LIMIT) {
+		POOL_LIST *list = &cache->lists[sizeClass];
+		block->next = list->head;
+		list->head = block;
+		list->count++;
+		return;
+	}
+	poolFreeShared(block, sizeClass);
+}
+
+/* Frees count blocks at once, taking the lock of the shared lists at most once */
+void swtPoolFreeAll(jintLong *ptrs, jint count)
+{
+	POOL_BLOCK *overflow[POOL_CLASSES], *excess = NULL;
+	POOL_CACHE *cache = poolGetCache(1);
+	int i;
+	for (i = 0; i < POOL_CLASSES; i++) overflow[i] = NULL;
+	for (i = 0; i < count; i++) {
+		POOL_BLOCK *block;
+		int sizeClass;
+		if (ptrs[i] == 0) continue;
+		block = POOL_BLOCK_OF((void *)ptrs[i]);
+		sizeClass = block->sizeClass;
+		if (sizeClass == POOL_LARGE) {
+			free(block);
+		} else if (cache != NULL && cache->lists[sizeClass].count < POOL_THREAD_LIMIT) {
+			POOL_LIST *list = &cache->lists[sizeClass];
+			block->next = list->head;
+			list->head = block;
+			list->count++;
+		} else {
+			block->next = overflow[sizeClass];
+			overflow[sizeClass] = block;
+		}
+	}
+	for (i = 0; i < POOL_CLASSES; i++) {
+		if (overflow[i] != NULL) break;
+	}
+	if (i == POOL_CLASSES) return;
+	POOL_LOCK();
+	for (i = 0; i < POOL_CLASSES; i++) {
+		POOL_LIST *list = &poolShared[i];
+		POOL_BLOCK *block = overflow[i];
+		while (block != NULL) {
+			POOL_BLOCK *next = block->next;
+			if (list->count < POOL_SHARED_LIMIT) {
+				block->next = list->head;
+				list->head = block;
+				list->count++;
+			} else {
+				block->next = excess;
+				excess = block;
+			}
+			block = next;
+		}
+	}
+	POOL_UNLOCK();
+	while (excess != NULL) {
+		POOL_BLOCK *next = excess->next;
+		free(excess);
+		excess = next;
+	}
+}
@@ -9,15 +9,167 @@
  *     IBM Corporation - initial API and implementation
  *******************************************************************************/
  
+#if defined (__linux__) && !defined (_GNU_SOURCE)
+#define _GNU_SOURCE /* dladdr */
+#endif
 #include "swt.h"
 
+#ifdef NATIVE_STATS
+#include <stdlib.h>
+#include <string.h>
+#if defined (_WIN32) || defined (_WIN32_WCE)
+#include <windows.h>
+#else
+#include <pthread.h>
+#ifdef __APPLE__
+#include <mach/mach_time.h>
+#else
+#include <time.h>
+#endif
+#endif
+static void nativeStatsInit();
+#endif
+
 int IS_JNI_1_2 = 0;
 
 #ifdef JNI_VERSION_1_2
+static void registerNatives(JNIEnv *env);
+
 JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *vm, void *reserved) {
+	JNIEnv *env = NULL;
 	IS_JNI_1_2 = 1;
+#ifdef NATIVE_STATS
+	nativeStatsInit();
+#endif
+	if ((*vm)->GetEnv(vm, (void **)&env, JNI_VERSION_1_2) == JNI_OK) registerNatives(env);
 	return JNI_VERSION_1_2;
 }
+
+/*
+* Binds the generated natives of this library with RegisterNatives, so that
+* the VM does not search the exported symbols for the mangled name of each
+* one on its first call. The table of each generated source is found by the
+* name of its main class, which must be listed here. The natives written
+* by hand are not in the tables and are still looked up by name.
+*/
+static const char *nativeClassTables[] = {
+	"OS_nativeClasses", "C_nativeClasses", "COM_nativeClasses", "Gdip_nativeClasses",
+	"ATK_nativeClasses", "Cairo_nativeClasses", "CDE_nativeClasses", "GNOME_nativeClasses",
+	"GTK_nativeClasses", "XPCOM_nativeClasses", "XPCOMInit_nativeClasses", "GLX_nativeClasses",
+	"WGL_nativeClasses", "AGL_nativeClasses", "Cocoa_nativeClasses", "Win32_nativeClasses",
+	"WebKitGTK_nativeClasses", "WebKit_win32_nativeClasses", "CEF3_nativeClasses",
+};
+
+#ifdef SWT_HIDE_NATIVES
+#include <stdio.h>
+#endif
+
+#if defined (_WIN32) || defined (_WIN32_WCE)
+#include <windows.h>
+static HMODULE nativeClassModule() {
+	MEMORY_BASIC_INFORMATION info;
+	if (VirtualQuery((LPCVOID)registerNatives, &info, sizeof(info)) == 0) return NULL;
+	return (HMODULE)info.AllocationBase;
+}
+#define NATIVE_CLASS_OPEN() nativeClassModule()
+#define NATIVE_CLASS_FIND(handle, name) (SWT_NATIVE_CLASS *)GetProcAddress(handle, name)
+#define NATIVE_CLASS_CLOSE(handle)
+#elif defined (__linux__) || defined (__APPLE__) || defined (__FreeBSD__) || defined (__sun)
+#include <dlfcn.h>
+static void *nativeClassModule() {
+	Dl_info info;
+	if (dladdr((void *)registerNatives, &info) == 0 || info.dli_fname == NULL) return NULL;
+	return dlopen(info.dli_fname, RTLD_LAZY);
+}
+#define NATIVE_CLASS_OPEN() nativeClassModule()
+#define NATIVE_CLASS_FIND(handle, name) (SWT_NATIVE_CLASS *)dlsym(handle, name)
+#define NATIVE_CLASS_CLOSE(handle) dlclose(handle)
+#endif
+
+static void registerNatives(JNIEnv *env) {
+#ifdef NATIVE_CLASS_OPEN
+	int i, j;
+	SWT_NATIVE_CLASS *classes;
+	jclass clazz;
+	void *handle = (void *)NATIVE_CLASS_OPEN();
+	if (handle == NULL) return;
+	for (i = 0; i < (int)(sizeof(nativeClassTables) / sizeof(nativeClassTables[0])); i++) {
+		classes = NATIVE_CLASS_FIND(handle, nativeClassTables[i]);
+		if (classes == NULL) continue;
+		for (; classes->name != NULL; classes++) {
+			jint count = 0;
+			while (classes->methods[count].name != NULL) count++;
+			if (count == 0) continue;
+			clazz = (*env)->FindClass(env, classes->name);
+			if (clazz == NULL) {
+				(*env)->ExceptionClear(env);
+				continue;
+			}
+			/*
+			* RegisterNatives stops at the first entry that does not match
+			* a native of the class, so retry the entries one by one to
+			* bind all the others. A native that cannot be registered is
+			* still looked up by name unless the natives are hidden.
+			*/
+			if ((*env)->RegisterNatives(env, clazz, classes->methods, count) != 0) {
+				(*env)->ExceptionClear(env);
+				for (j = 0; j < count; j++) {
+					if ((*env)->RegisterNatives(env, clazz, &classes->methods[j], 1) != 0) {
+						(*env)->ExceptionClear(env);
+#ifdef SWT_HIDE_NATIVES
+						fprintf(stderr, "SWT: cannot register native %s.%s%s\n", classes->name, classes->methods[j].name, classes->methods[j].signature);
+#endif
+					}
+				}
+			}
+			(*env)->DeleteLocalRef(env, clazz);
+		}
+	}
+	NATIVE_CLASS_CLOSE(handle);
+#endif
+}
+#endif
+
+#if !defined (__APPLE__) && !defined (_WIN32) && !defined (_WIN32_WCE)
+#include <dlfcn.h>
+#include <string.h>
+#include <pthread.h>
+
+#define LIBRARY_COUNT 32
+
+static struct {
+	const char *name;
+	void *handle;
+} libraries[LIBRARY_COUNT];
+static int libraryCount = 0;
+static pthread_mutex_t librariesLock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+* Answers the handle of the named library, opening it the first time.
+* LOAD_FUNCTION calls this once per symbol, so each library is only
+* searched for by dlopen once instead of once per function.
+*/
+void *openLibrary(const char *name) {
+	int i;
+	void *handle = NULL;
+	pthread_mutex_lock(&librariesLock);
+	for (i = 0; i < libraryCount; i++) {
+		if (libraries[i].name == name || strcmp(libraries[i].name, name) == 0) {
+			handle = libraries[i].handle;
+			break;
+		}
+	}
+	if (i == libraryCount) {
+		handle = dlopen(name, LOAD_FLAGS);
+		if (handle != NULL && libraryCount < LIBRARY_COUNT) {
+			libraries[libraryCount].name = name;
+			libraries[libraryCount].handle = handle;
+			libraryCount++;
+		}
+	}
+	pthread_mutex_unlock(&librariesLock);
+	return handle;
+}
 #endif
 
 void throwOutOfMemory(JNIEnv *env) {
@@ -26,3 +178,548 @@ void throwOutOfMemory(JNIEnv *env) {
 		(*env)->ThrowNew(env, clazz, "");
 	}
 }
+
+void *lockArray(JNIEnv *env, jarray array, char type) {
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) return (*env)->GetPrimitiveArrayCritical(env, array, NULL);
+#endif
+	switch (type) {
+		case 'C': return (*env)->GetCharArrayElements(env, (jcharArray)array, NULL);
+		case 'I': return (*env)->GetIntArrayElements(env, (jintArray)array, NULL);
+		default: return (*env)->GetByteArrayElements(env, (jbyteArray)array, NULL);
+	}
+}
+
+void unlockArray(JNIEnv *env, jarray array, void *elements, char type, jint mode) {
+#ifdef JNI_VERSION_1_2
+	if (IS_JNI_1_2) {
+		(*env)->ReleasePrimitiveArrayCritical(env, array, elements, mode);
+		return;
+	}
+#endif
+	switch (type) {
+		case 'C': (*env)->ReleaseCharArrayElements(env, (jcharArray)array, (jchar *)elements, mode); break;
+		case 'I': (*env)->ReleaseIntArrayElements(env, (jintArray)array, (jint *)elements, mode); break;
+		default: (*env)->ReleaseByteArrayElements(env, (jbyteArray)array, (jbyte *)elements, mode); break;
+	}
+}
+
+#ifdef NATIVE_STATS
+
+/*
+* Every native brackets its body with nativeStatsEnter() and nativeStatsExit().
+* The calling thread keeps a stack of the natives it is in, so that nested
+* calls (natives called from callbacks) are timed and traced with their depth.
+* Call counts and times are kept per function for the whole process. While
+* tracing is on, each completed call is also written to the class ring buffer.
+*/
+
+#define NATIVE_STATS_DEPTH 128
+
+#if defined (_WIN32) || defined (_WIN32_WCE)
+#define STATS_INC(v) InterlockedIncrement((LONG volatile *)&(v))
+#ifdef _WIN64
+#define STATS_ADD(v, n) InterlockedExchangeAdd64((LONGLONG volatile *)&(v), n)
+#endif
+#elif defined (__GNUC__)
+#define STATS_INC(v) __sync_add_and_fetch(&(v), 1)
+#if defined (__x86_64__) || defined (__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+#define STATS_ADD(v, n) __sync_add_and_fetch(&(v), n)
+#endif
+#else
+#define STATS_INC(v) (++(v))
+#endif
+#ifndef STATS_ADD
+#define STATS_ADD(v, n) ((v) += (n))
+#endif
+
+typedef struct NATIVE_STATS_FRAME {
+	NATIVE_STATS_CLASS *stats;
+	int func;
+	jlong start;
+} NATIVE_STATS_FRAME;
+
+typedef struct NATIVE_STATS_THREAD {
+	int id, depth;
+	volatile unsigned int transitions;
+	NATIVE_STATS_FRAME frames[NATIVE_STATS_DEPTH];
+} NATIVE_STATS_THREAD;
+
+volatile int nativeStatsTracing = 0;
+static int nativeStatsKeyValid = 0;
+#if defined (_WIN32) || defined (_WIN32_WCE)
+static DWORD nativeStatsKey;
+#else
+static pthread_key_t nativeStatsKey;
+#endif
+
+static void nativeStatsResourceInit();
+
+static void nativeStatsInit() {
+	if (nativeStatsKeyValid) return;
+	nativeStatsResourceInit();
+#if defined (_WIN32) || defined (_WIN32_WCE)
+	nativeStatsKey = TlsAlloc();
+	nativeStatsKeyValid = nativeStatsKey != TLS_OUT_OF_INDEXES;
+#else
+	nativeStatsKeyValid = pthread_key_create(&nativeStatsKey, free) == 0;
+#endif
+}
+
+/* Monotonic time in nanoseconds */
+static jlong nativeStatsTime() {
+#if defined (_WIN32) || defined (_WIN32_WCE)
+	static LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+	if (frequency.QuadPart == 0) QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (jlong)(counter.QuadPart / frequency.QuadPart * 1000000000 + counter.QuadPart % frequency.QuadPart * 1000000000 / frequency.QuadPart);
+#elif defined (__APPLE__)
+	static mach_timebase_info_data_t timebase;
+	if (timebase.denom == 0) mach_timebase_info(&timebase);
+	return (jlong)(mach_absolute_time() * timebase.numer / timebase.denom);
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (jlong)now.tv_sec * 1000000000 + now.tv_nsec;
+#endif
+}
+
+static NATIVE_STATS_THREAD *nativeStatsThread() {
+	NATIVE_STATS_THREAD *thread;
+	if (!nativeStatsKeyValid) return NULL;
+#if defined (_WIN32) || defined (_WIN32_WCE)
+	thread = (NATIVE_STATS_THREAD *)TlsGetValue(nativeStatsKey);
+#else
+	thread = (NATIVE_STATS_THREAD *)pthread_getspecific(nativeStatsKey);
+#endif
+	if (thread == NULL) {
+		thread = (NATIVE_STATS_THREAD *)calloc(1, sizeof(NATIVE_STATS_THREAD));
+		if (thread == NULL) return NULL;
+#if defined (_WIN32) || defined (_WIN32_WCE)
+		thread->id = (int)GetCurrentThreadId();
+		TlsSetValue(nativeStatsKey, thread);
+#else
+		thread->id = (int)(jintLong)pthread_self();
+		pthread_setspecific(nativeStatsKey, thread);
+#endif
+	}
+	return thread;
+}
+
+void nativeStatsEnter(NATIVE_STATS_CLASS *stats, int func) {
+	NATIVE_STATS_THREAD *thread = nativeStatsThread();
+	STATS_INC(stats->callCount[func]);
+	if (thread == NULL) return;
+	thread->transitions++;
+	if (thread->depth < NATIVE_STATS_DEPTH) {
+		NATIVE_STATS_FRAME *frame = &thread->frames[thread->depth];
+		frame->stats = stats;
+		frame->func = func;
+		frame->start = nativeStatsTime();
+	}
+	thread->depth++;
+}
+
+void nativeStatsExit(NATIVE_STATS_CLASS *stats, int func) {
+	jlong end = nativeStatsTime();
+	NATIVE_STATS_THREAD *thread = nativeStatsThread();
+	NATIVE_STATS_FRAME *frame;
+	int depth;
+	if (thread == NULL || thread->depth == 0) return;
+	thread->transitions++;
+	if (thread->depth > NATIVE_STATS_DEPTH) {
+		thread->depth--;
+		return;
+	}
+	/* Discard the frames of natives that returned without an exit */
+	depth = thread->depth - 1;
+	while (depth >= 0) {
+		frame = &thread->frames[depth];
+		if (frame->stats == stats && frame->func == func) break;
+		depth--;
+	}
+	if (depth < 0) return;
+	thread->depth = depth;
+	STATS_ADD(stats->callTime[func], end - frame->start);
+	if (nativeStatsTracing) {
+		int index = STATS_INC(stats->eventCount) - 1;
+		NATIVE_STATS_EVENT *event = &stats->events[index & (NATIVE_STATS_EVENT_COUNT - 1)];
+		event->func = func;
+		event->thread = thread->id;
+		event->depth = depth;
+		event->start = frame->start;
+		event->duration = end - frame->start;
+	}
+}
+
+/*
+* The watched thread is read by another thread while it runs, so a sample
+* may mix two consecutive states of the thread. That is good enough to tell
+* which native a thread that has not made progress for a while is in.
+*/
+static NATIVE_STATS_THREAD * volatile nativeStatsWatched = NULL;
+
+static int nativeStatsSample(unsigned int *transitions, const char **className, const char **function, jlong *start) {
+	NATIVE_STATS_THREAD *thread = nativeStatsWatched;
+	NATIVE_STATS_FRAME frame;
+	int depth;
+	if (thread == NULL) return 0;
+	*transitions = thread->transitions;
+	depth = thread->depth;
+	if (depth <= 0) return 0;
+	frame = thread->frames[(depth > NATIVE_STATS_DEPTH ? NATIVE_STATS_DEPTH : depth) - 1];
+	if (frame.stats == NULL) return 0;
+	*className = frame.stats->className;
+	*function = frame.stats->functionNames != NULL ? frame.stats->functionNames[frame.func] : NULL;
+	*start = frame.start;
+	return depth;
+}
+
+/* Watches the calling thread and answers the NATIVE_STATS_SAMPLER that samples it */
+jlong nativeStatsWatch() {
+	nativeStatsWatched = nativeStatsThread();
+	return (jlong)(jintLong)nativeStatsSample;
+}
+
+/*
+* Copies the most recent events of the class into buffer, five longs per event
+* (function, thread, depth, start, duration) from the oldest to the newest, and
+* empties the ring buffer. Tracing should be off while the events are read.
+*/
+jint nativeStatsGetEvents(JNIEnv *env, NATIVE_STATS_CLASS *stats, jlongArray buffer) {
+	unsigned int i, count = (unsigned int)stats->eventCount, first, length;
+	jlong *values;
+	if (buffer == NULL) return 0;
+	length = (unsigned int)(*env)->GetArrayLength(env, buffer) / 5;
+	first = count;
+	if (count > NATIVE_STATS_EVENT_COUNT) count = NATIVE_STATS_EVENT_COUNT;
+	if (count > length) count = length;
+	first -= count;
+	if ((values = (*env)->GetLongArrayElements(env, buffer, NULL)) == NULL) return 0;
+	for (i = 0; i < count; i++) {
+		NATIVE_STATS_EVENT *event = &stats->events[(first + i) & (NATIVE_STATS_EVENT_COUNT - 1)];
+		values[i * 5] = event->func;
+		values[i * 5 + 1] = event->thread;
+		values[i * 5 + 2] = event->depth;
+		values[i * 5 + 3] = event->start;
+		values[i * 5 + 4] = event->duration;
+	}
+	(*env)->ReleaseLongArrayElements(env, buffer, values, 0);
+	stats->eventCount = 0;
+	return (jint)count;
+}
+
+typedef struct NATIVE_STATS_LOAD {
+	const char *library, *symbol;
+	jlong time;
+	int found;
+} NATIVE_STATS_LOAD;
+
+static NATIVE_STATS_LOAD nativeStatsLoads[NATIVE_STATS_LOAD_COUNT];
+static volatile int nativeStatsLoadCount = 0;
+
+jlong nativeStatsLoadStart() {
+	return nativeStatsTime();
+}
+
+/* Records one run of LOAD_FUNCTION, i.e. the first call to a dynamic function */
+void nativeStatsLoad(jlong start, const char *library, const char *symbol, int found) {
+	jlong time = nativeStatsTime() - start;
+	int index = STATS_INC(nativeStatsLoadCount) - 1;
+	NATIVE_STATS_LOAD *load;
+	if (index >= NATIVE_STATS_LOAD_COUNT) return;
+	load = &nativeStatsLoads[index];
+	load->library = library;
+	load->symbol = symbol;
+	load->time = time;
+	load->found = found;
+}
+
+/*
+* Copies the recorded resolutions of the library, library and symbol names
+* into names and the time in nanoseconds and 1 if the symbol was found into
+* values, and forgets them so that the classes of a library report each
+* resolution once. Answers the number of resolutions copied.
+*/
+jint nativeStatsGetLoads(JNIEnv *env, jobjectArray names, jlongArray values) {
+	int i, count = nativeStatsLoadCount;
+	jlong *lpvalues;
+	if (names == NULL || values == NULL) return 0;
+	if (count > NATIVE_STATS_LOAD_COUNT) count = NATIVE_STATS_LOAD_COUNT;
+	if (count > (*env)->GetArrayLength(env, names) / 2) count = (*env)->GetArrayLength(env, names) / 2;
+	if (count > (*env)->GetArrayLength(env, values) / 2) count = (*env)->GetArrayLength(env, values) / 2;
+	if ((lpvalues = (*env)->GetLongArrayElements(env, values, NULL)) == NULL) return 0;
+	for (i = 0; i < count; i++) {
+		NATIVE_STATS_LOAD *load = &nativeStatsLoads[i];
+		jstring library = (*env)->NewStringUTF(env, load->library);
+		jstring symbol = (*env)->NewStringUTF(env, load->symbol);
+		if (library == NULL || symbol == NULL) break;
+		(*env)->SetObjectArrayElement(env, names, i * 2, library);
+		(*env)->SetObjectArrayElement(env, names, i * 2 + 1, symbol);
+		(*env)->DeleteLocalRef(env, library);
+		(*env)->DeleteLocalRef(env, symbol);
+		lpvalues[i * 2] = load->time;
+		lpvalues[i * 2 + 1] = load->found;
+	}
+	(*env)->ReleaseLongArrayElements(env, values, lpvalues, 0);
+	nativeStatsLoadCount = 0;
+	return i;
+}
+
+/*
+* Every live resource is kept in an open addressing hash table keyed by its
+* handle, with the index of its type, its size in bytes and, while stacks
+* are captured, a global reference to an Error created when it was. The
+* counters of each type are kept for the whole process.
+*/
+
+#define NATIVE_STATS_RESOURCE_TYPES 64
+
+typedef struct NATIVE_STATS_RESOURCE_TYPE {
+	const char *name;
+	jlong count, bytes, created, peak;
+} NATIVE_STATS_RESOURCE_TYPE;
+
+typedef struct NATIVE_STATS_RESOURCE {
+	jintLong handle;
+	jlong size;
+	int type;
+	jobject stack;
+} NATIVE_STATS_RESOURCE;
+
+volatile int nativeStatsResourceStacks = 0;
+static NATIVE_STATS_RESOURCE_TYPE nativeStatsResourceTypes[NATIVE_STATS_RESOURCE_TYPES];
+static int nativeStatsResourceTypeCount = 0;
+static NATIVE_STATS_RESOURCE *nativeStatsResources = NULL;
+static unsigned int nativeStatsResourceCapacity = 0, nativeStatsResourceCount = 0;
+#if defined (_WIN32) || defined (_WIN32_WCE)
+static CRITICAL_SECTION nativeStatsResourceLock;
+#define RESOURCE_LOCK() EnterCriticalSection(&nativeStatsResourceLock)
+#define RESOURCE_UNLOCK() LeaveCriticalSection(&nativeStatsResourceLock)
+#else
+static pthread_mutex_t nativeStatsResourceLock = PTHREAD_MUTEX_INITIALIZER;
+#define RESOURCE_LOCK() pthread_mutex_lock(&nativeStatsResourceLock)
+#define RESOURCE_UNLOCK() pthread_mutex_unlock(&nativeStatsResourceLock)
+#endif
+
+static void nativeStatsResourceInit() {
+#if defined (_WIN32) || defined (_WIN32_WCE)
+	InitializeCriticalSection(&nativeStatsResourceLock);
+#endif
+}
+
+static unsigned int nativeStatsResourceHash(jintLong handle) {
+	jlong value = (jlong)handle;
+	unsigned int hash = (unsigned int)(value ^ (value >> 32));
+	hash ^= hash >> 4;
+	hash *= 2654435761U;
+	return hash ^ (hash >> 16);
+}
+
+/* Answers the slot of the handle, or the empty slot where it belongs */
+static unsigned int nativeStatsResourceSlot(jintLong handle) {
+	unsigned int mask = nativeStatsResourceCapacity - 1;
+	unsigned int i = nativeStatsResourceHash(handle) & mask;
+	while (nativeStatsResources[i].handle != 0 && nativeStatsResources[i].handle != handle) {
+		i = (i + 1) & mask;
+	}
+	return i;
+}
+
+static int nativeStatsResourceGrow() {
+	NATIVE_STATS_RESOURCE *resources = nativeStatsResources;
+	unsigned int i, capacity = nativeStatsResourceCapacity;
+	NATIVE_STATS_RESOURCE *newResources = (NATIVE_STATS_RESOURCE *)calloc(capacity != 0 ? capacity * 2 : 1024, sizeof(NATIVE_STATS_RESOURCE));
+	if (newResources == NULL) return 0;
+	nativeStatsResources = newResources;
+	nativeStatsResourceCapacity = capacity != 0 ? capacity * 2 : 1024;
+	for (i = 0; i < capacity; i++) {
+		if (resources[i].handle != 0) {
+			nativeStatsResources[nativeStatsResourceSlot(resources[i].handle)] = resources[i];
+		}
+	}
+	free(resources);
+	return 1;
+}
+
+static int nativeStatsResourceType(const char *name) {
+	int i;
+	for (i = 0; i < nativeStatsResourceTypeCount; i++) {
+		const char *typeName = nativeStatsResourceTypes[i].name;
+		if (typeName == name || strcmp(typeName, name) == 0) return i;
+	}
+	if (i == NATIVE_STATS_RESOURCE_TYPES) return -1;
+	nativeStatsResourceTypes[i].name = name;
+	nativeStatsResourceTypeCount++;
+	return i;
+}
+
+/* Removes the resource in slot i, moving back the entries that probed past it */
+static void nativeStatsResourceRemove(unsigned int i) {
+	unsigned int mask = nativeStatsResourceCapacity - 1, j = i, k;
+	NATIVE_STATS_RESOURCE_TYPE *type = &nativeStatsResourceTypes[nativeStatsResources[i].type];
+	type->count--;
+	type->bytes -= nativeStatsResources[i].size;
+	while (1) {
+		j = (j + 1) & mask;
+		if (nativeStatsResources[j].handle == 0) break;
+		k = nativeStatsResourceHash(nativeStatsResources[j].handle) & mask;
+		if (i <= j ? (i < k && k <= j) : (i < k || k <= j)) continue;
+		nativeStatsResources[i] = nativeStatsResources[j];
+		i = j;
+	}
+	nativeStatsResources[i].handle = 0;
+	nativeStatsResources[i].stack = NULL;
+	nativeStatsResourceCount--;
+}
+
+/* Records a resource created by a native, see NATIVE_RESOURCE_CREATE */
+void nativeStatsCreate(JNIEnv *env, const char *name, jintLong handle, jlong size) {
+	jobject stack = NULL, oldStack = NULL;
+	NATIVE_STATS_RESOURCE *resource;
+	NATIVE_STATS_RESOURCE_TYPE *type;
+	int typeIndex;
+	unsigned int i;
+	if (handle == 0) return;
+#ifdef JNI_VERSION_1_2
+	if (nativeStatsResourceStacks && IS_JNI_1_2 && !(*env)->ExceptionCheck(env)) {
+		jclass clazz = (*env)->FindClass(env, "java/lang/Error");
+		if (clazz != NULL) {
+			jmethodID init = (*env)->GetMethodID(env, clazz, "<init>", "()V");
+			jobject error = init != NULL ? (*env)->NewObject(env, clazz, init) : NULL;
+			if (error != NULL) {
+				stack = (*env)->NewGlobalRef(env, error);
+				(*env)->DeleteLocalRef(env, error);
+			}
+			(*env)->DeleteLocalRef(env, clazz);
+		}
+		if ((*env)->ExceptionCheck(env)) (*env)->ExceptionClear(env);
+	}
+#endif
+	RESOURCE_LOCK();
+	typeIndex = nativeStatsResourceType(name);
+	if (typeIndex == -1 || ((nativeStatsResourceCount + 1) * 2 > nativeStatsResourceCapacity && !nativeStatsResourceGrow())) {
+		RESOURCE_UNLOCK();
+		if (stack != NULL) (*env)->DeleteGlobalRef(env, stack);
+		return;
+	}
+	i = nativeStatsResourceSlot(handle);
+	resource = &nativeStatsResources[i];
+	if (resource->handle != 0) {
+		/* The handle was released without a destroy native and reused */
+		oldStack = resource->stack;
+		nativeStatsResourceRemove(i);
+		i = nativeStatsResourceSlot(handle);
+		resource = &nativeStatsResources[i];
+	}
+	resource->handle = handle;
+	resource->size = size;
+	resource->type = typeIndex;
+	resource->stack = stack;
+	nativeStatsResourceCount++;
+	type = &nativeStatsResourceTypes[typeIndex];
+	type->count++;
+	type->bytes += size;
+	type->created++;
+	if (type->count > type->peak) type->peak = type->count;
+	RESOURCE_UNLOCK();
+	if (oldStack != NULL) (*env)->DeleteGlobalRef(env, oldStack);
+}
+
+/* Forgets a resource released by a native, see NATIVE_RESOURCE_DESTROY */
+void nativeStatsDestroy(JNIEnv *env, jintLong handle) {
+	jobject stack = NULL;
+	unsigned int i;
+	if (handle == 0) return;
+	RESOURCE_LOCK();
+	if (nativeStatsResourceCount != 0) {
+		i = nativeStatsResourceSlot(handle);
+		if (nativeStatsResources[i].handle == handle) {
+			stack = nativeStatsResources[i].stack;
+			nativeStatsResourceRemove(i);
+		}
+	}
+	RESOURCE_UNLOCK();
+	if (stack != NULL) (*env)->DeleteGlobalRef(env, stack);
+}
+
+/*
+* Copies the counters of each resource type, its name into names and four
+* longs into values from index 1 (live resources, live bytes, resources
+* created and peak of live resources), and answers the number of types.
+* values[0] is set to an identifier of the table, which is shared by the
+* classes of a library, so that they can be counted once.
+*/
+jint nativeStatsGetResources(JNIEnv *env, jobjectArray names, jlongArray values) {
+	NATIVE_STATS_RESOURCE_TYPE types[NATIVE_STATS_RESOURCE_TYPES];
+	int i, count;
+	jlong *lpvalues;
+	if (names == NULL || values == NULL || (*env)->GetArrayLength(env, values) < 1) return 0;
+	RESOURCE_LOCK();
+	count = nativeStatsResourceTypeCount;
+	memcpy(types, nativeStatsResourceTypes, count * sizeof(NATIVE_STATS_RESOURCE_TYPE));
+	RESOURCE_UNLOCK();
+	if (count > (*env)->GetArrayLength(env, names)) count = (*env)->GetArrayLength(env, names);
+	if (count > ((*env)->GetArrayLength(env, values) - 1) / 4) count = ((*env)->GetArrayLength(env, values) - 1) / 4;
+	if ((lpvalues = (*env)->GetLongArrayElements(env, values, NULL)) == NULL) return 0;
+	lpvalues[0] = (jlong)(jintLong)nativeStatsResourceTypes;
+	for (i = 0; i < count; i++) {
+		jstring name = (*env)->NewStringUTF(env, types[i].name);
+		if (name == NULL) break;
+		(*env)->SetObjectArrayElement(env, names, i, name);
+		(*env)->DeleteLocalRef(env, name);
+		lpvalues[1 + i * 4] = types[i].count;
+		lpvalues[1 + i * 4 + 1] = types[i].bytes;
+		lpvalues[1 + i * 4 + 2] = types[i].created;
+		lpvalues[1 + i * 4 + 3] = types[i].peak;
+	}
+	(*env)->ReleaseLongArrayElements(env, values, lpvalues, 0);
+	return i;
+}
+
+/*
+* Copies the live resources, their type name and creation stack (an Error,
+* or null when stacks were not captured) into objects and their handle and
+* size into values from index 1, and answers the number of resources copied.
+* values[0] is set to the identifier of the table, see nativeStatsGetResources().
+*/
+jint nativeStatsGetLiveResources(JNIEnv *env, jobjectArray objects, jlongArray values) {
+	NATIVE_STATS_RESOURCE *resources;
+	unsigned int i, count = 0, length;
+	jlong *lpvalues;
+	if (objects == NULL || values == NULL || (*env)->GetArrayLength(env, values) < 1) return 0;
+	length = (unsigned int)(*env)->GetArrayLength(env, objects) / 2;
+	if (length > (unsigned int)((*env)->GetArrayLength(env, values) - 1) / 2) length = (unsigned int)((*env)->GetArrayLength(env, values) - 1) / 2;
+	RESOURCE_LOCK();
+	resources = (NATIVE_STATS_RESOURCE *)malloc((nativeStatsResourceCount + 1) * sizeof(NATIVE_STATS_RESOURCE));
+	if (resources != NULL) {
+		for (i = 0; i < nativeStatsResourceCapacity && count < length; i++) {
+			if (nativeStatsResources[i].handle == 0) continue;
+			resources[count] = nativeStatsResources[i];
+			if (resources[count].stack != NULL) resources[count].stack = (*env)->NewLocalRef(env, resources[count].stack);
+			count++;
+		}
+	}
+	RESOURCE_UNLOCK();
+	if (resources == NULL) return 0;
+	if ((lpvalues = (*env)->GetLongArrayElements(env, values, NULL)) != NULL) {
+		lpvalues[0] = (jlong)(jintLong)nativeStatsResourceTypes;
+		for (i = 0; i < count; i++) {
+			jstring name = (*env)->NewStringUTF(env, nativeStatsResourceTypes[resources[i].type].name);
+			(*env)->SetObjectArrayElement(env, objects, i * 2, name);
+			(*env)->SetObjectArrayElement(env, objects, i * 2 + 1, resources[i].stack);
+			if (name != NULL) (*env)->DeleteLocalRef(env, name);
+			lpvalues[1 + i * 2] = (jlong)resources[i].handle;
+			lpvalues[1 + i * 2 + 1] = resources[i].size;
+		}
+		(*env)->ReleaseLongArrayElements(env, values, lpvalues, 0);
+	}
+	for (i = 0; i < count; i++) {
+		if (resources[i].stack != NULL) (*env)->DeleteLocalRef(env, resources[i].stack);
+	}
+	free(resources);
+	return count;
+}
+
+#endif
@@ -49,6 +49,8 @@ extern int IS_JNI_1_2;
 #define CallIntLongMethod CallIntMethod
 #define CallStaticIntLongMethodV CallStaticIntMethodV
 #define CallIntLongMethodV CallIntMethodV
+#define CallStaticIntLongMethodA CallStaticIntMethodA
+#define CallIntLongMethodA CallIntMethodA
 #define jintLongArray jintArray
 #define jintLong jint
 #define I_J "I"
@@ -60,6 +62,7 @@ extern int IS_JNI_1_2;
 #define GetFloatDoubleArrayElements GetFloatArrayElements
 #define ReleaseFloatDoubleArrayElements ReleaseFloatArrayElements
 #define GetFloatDoubleArrayRegion GetFloatArrayRegion
+#define SetFloatDoubleArrayRegion SetFloatArrayRegion
 #define jfloatDoubleArray jfloatArray
 #define jfloatDouble jfloat
 #define F_D "F"
@@ -79,6 +82,8 @@ extern int IS_JNI_1_2;
 #define CallIntLongMethod CallLongMethod
 #define CallStaticIntLongMethodV CallStaticLongMethodV
 #define CallIntLongMethodV CallLongMethodV
+#define CallStaticIntLongMethodA CallStaticLongMethodA
+#define CallIntLongMethodA CallLongMethodA
 #define jintLongArray jlongArray
 #define jintLong jlong
 #define I_J "J"
@@ -90,6 +95,7 @@ extern int IS_JNI_1_2;
 #define GetFloatDoubleArrayElements GetDoubleArrayElements
 #define ReleaseFloatDoubleArrayElements ReleaseDoubleArrayElements
 #define GetFloatDoubleArrayRegion GetDoubleArrayRegion
+#define SetFloatDoubleArrayRegion SetDoubleArrayRegion
 #define jfloatDoubleArray jdoubleArray
 #define jfloatDouble jdouble
 #define F_D "D"
@@ -103,9 +109,11 @@ extern int IS_JNI_1_2;
 		static int initialized = 0; \
 		static void *var = NULL; \
 		if (!initialized) { \
+			LOAD_STATS_START \
 			CFBundleRef bundle = CFBundleGetBundleWithIdentifier(CFSTR(name##_LIB)); \
 			if (bundle) var = CFBundleGetFunctionPointerForName(bundle, CFSTR(#name)); \
 			initialized = 1; \
+			LOAD_STATS_END(name##_LIB, #name, var) \
 		} 
 #elif defined (_WIN32) || defined (_WIN32_WCE)
 #define CALLING_CONVENTION CALLBACK
@@ -113,9 +121,11 @@ extern int IS_JNI_1_2;
 		static int initialized = 0; \
 		static FARPROC var = NULL; \
 		if (!initialized) { \
+			LOAD_STATS_START \
 			HMODULE hm = LoadLibrary(name##_LIB); \
 			if (hm) var = GetProcAddress(hm, #name); \
 			initialized = 1; \
+			LOAD_STATS_END(name##_LIB, #name, var) \
 		}
 #else
 #define CALLING_CONVENTION
@@ -128,14 +138,149 @@ extern int IS_JNI_1_2;
 		static int initialized = 0; \
 		static void *var = NULL; \
 		if (!initialized) { \
-			void* handle = dlopen(name##_LIB, LOAD_FLAGS); \
+			LOAD_STATS_START \
+			void* handle = openLibrary(name##_LIB); \
 			if (handle) var = dlsym(handle, #name); \
 			initialized = 1; \
+			LOAD_STATS_END(name##_LIB, #name, var) \
 		}
+void *openLibrary(const char *name);
 #endif
 
 void throwOutOfMemory(JNIEnv *env);
 
+/*
+* Locks the elements of a byte, char or int array, given by its JNI type
+* ('B', 'C' or 'I'), for a native that does not call back into the VM.
+* The elements are not copied where the VM allows it. unlockArray()
+* releases them with the mode of ReleasePrimitiveArrayCritical().
+*/
+void *lockArray(JNIEnv *env, jarray array, char type);
+void unlockArray(JNIEnv *env, jarray array, void *elements, char type, jint mode);
+
+/*
+* The generated natives of the classes of a library, which JNI_OnLoad
+* registers with RegisterNatives. Each generated source exports an array
+* of them named after its main class, ending with an empty entry.
+*/
+typedef struct SWT_NATIVE_CLASS {
+	const char *name;
+	JNINativeMethod *methods;
+} SWT_NATIVE_CLASS;
+
+/*
+* The generated natives are bound through their tables, but stay exported
+* so that a native whose entry fails to register is still found by name.
+* A library whose tables are known to register completely can be built
+* with SWT_HIDE_NATIVES to stop exporting them. It must link swt.c, which
+* holds the JNI_OnLoad that registers the tables.
+*/
+#if defined (SWT_HIDE_NATIVES) && !defined (NO_REGISTER_NATIVES) && (defined (_WIN32) || defined (_WIN32_WCE))
+#define SWT_NATIVE_EXPORT
+#elif defined (SWT_HIDE_NATIVES) && !defined (NO_REGISTER_NATIVES) && defined (__GNUC__) && (defined (__linux__) || defined (__APPLE__) || defined (__FreeBSD__) || defined (__sun))
+#define SWT_NATIVE_EXPORT __attribute__((visibility("hidden")))
+#else
+#define SWT_NATIVE_EXPORT JNIEXPORT
+#endif
+
+#ifdef NATIVE_STATS
+
+/* Native call tracing, see NativeStats */
+#define NATIVE_STATS_EVENT_COUNT 8192 /* must be a power of two */
+
+typedef struct NATIVE_STATS_EVENT {
+	jint func, thread, depth;
+	jlong start, duration;
+} NATIVE_STATS_EVENT;
+
+typedef struct NATIVE_STATS_CLASS {
+	int *callCount;
+	jlong *callTime;
+	NATIVE_STATS_EVENT *events;
+	volatile int eventCount;
+	const char *className;
+	char **functionNames;
+} NATIVE_STATS_CLASS;
+
+extern volatile int nativeStatsTracing;
+
+void nativeStatsEnter(NATIVE_STATS_CLASS *stats, int func);
+void nativeStatsExit(NATIVE_STATS_CLASS *stats, int func);
+jint nativeStatsGetEvents(JNIEnv *env, NATIVE_STATS_CLASS *stats, jlongArray buffer);
+
+/*
+* Watches the calling thread and answers the NATIVE_STATS_SAMPLER of the
+* library, see Watchdog.
+*/
+jlong nativeStatsWatch();
+
+/* Dynamic function resolution, see LOAD_FUNCTION */
+#define NATIVE_STATS_LOAD_COUNT 2048
+
+jlong nativeStatsLoadStart();
+void nativeStatsLoad(jlong start, const char *library, const char *symbol, int found);
+jint nativeStatsGetLoads(JNIEnv *env, jobjectArray names, jlongArray values);
+
+#define LOAD_STATS_START jlong loadStart = nativeStatsLoadStart();
+#define LOAD_STATS_END(library, symbol, var) nativeStatsLoad(loadStart, library, symbol, var != NULL);
+
+/*
+* Native resource accounting. The natives whose metadata names the type of
+* the resource they answer (resource=) call NATIVE_RESOURCE_CREATE with their
+* result, and those that release the resource passed as their first argument
+* (flags=destroy) call NATIVE_RESOURCE_DESTROY with it.
+*/
+extern volatile int nativeStatsResourceStacks;
+
+void nativeStatsCreate(JNIEnv *env, const char *type, jintLong handle, jlong size);
+void nativeStatsDestroy(JNIEnv *env, jintLong handle);
+jint nativeStatsGetResources(JNIEnv *env, jobjectArray names, jlongArray values);
+jint nativeStatsGetLiveResources(JNIEnv *env, jobjectArray objects, jlongArray values);
+
+#define NATIVE_RESOURCE_CREATE(env, type, handle, size) nativeStatsCreate(env, type, (jintLong)(handle), (jlong)(size));
+#define NATIVE_RESOURCE_DESTROY(env, handle) nativeStatsDestroy(env, (jintLong)(handle));
+#else
+#define LOAD_STATS_START
+#define LOAD_STATS_END(library, symbol, var)
+#define NATIVE_RESOURCE_CREATE(env, type, handle, size)
+#define NATIVE_RESOURCE_DESTROY(env, handle)
+#endif
+
+/*
+* UI thread stall detection, see Watchdog. The NATIVE_STATS_SAMPLER of a
+* library built with NATIVE_STATS copies the number of times the watched
+* thread entered or returned from a native of the library so far and its
+* innermost native with the time it was entered, and answers how deep the
+* thread is in natives.
+*/
+typedef int (*NATIVE_STATS_SAMPLER)(unsigned int *transitions, const char **className, const char **function, jlong *start);
+
+extern volatile int watchdogEnabled;
+
+void watchdogCallbackEnter(int slot);
+void watchdogCallbackExit();
+
+#define WATCHDOG_CALLBACK_ENTER(slot) if (watchdogEnabled) watchdogCallbackEnter(slot);
+#define WATCHDOG_CALLBACK_EXIT() if (watchdogEnabled) watchdogCallbackExit();
+
+/* Thread-local scratch memory for the temporaries of a native, see arena.c */
+size_t swtArenaMark();
+void *swtArenaAlloc(size_t size);
+void swtArenaRelease(size_t mark);
+
+/* Strided copy behind C.memmove2D, see blit.c */
+jboolean swtMemmove2D(void *dest, jint destStride, const void *src, jint srcStride, jint rowBytes, jint rows, jint map, jint flags);
+
+/* Size class pool behind C.pool_malloc, see pool.c */
+void *swtPoolAlloc(size_t size);
+void swtPoolFree(void *ptr);
+void swtPoolFreeAll(jintLong *ptrs, jint count);
+
+#if defined (_WIN32) || defined (_WIN32_WCE)
+void swtArenaThreadDetach();
+void swtPoolThreadDetach();
+#endif
+
 #define CHECK_NULL_VOID(ptr) \
 	if ((ptr) == NULL) { \
 		throwOutOfMemory(env); \
@@ -0,0 +1,293 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+
+/**
+ * tiff.c
+ *
+ * This file contains the PackBits and CCITT Group 3 1-Dimensional
+ * Modified Huffman strip decoders used by the TIFF decoder.  They
+ * follow TIFFDirectory.decodePackBits() and TIFFModifiedHuffmanCodec
+ * code for code, and keep no state between calls, so that the strips
+ * of an image can be decoded on several threads at once.
+ *
+ * The Huffman decoder looks the next 13 bits of the strip up in a table
+ * that gives the length and run of the code they start with, instead of
+ * reading the code one bit at a time.
+ */
+
+#include "swt.h"
+
+#include <string.h>
+
+#define TIFF_NATIVE(func) Java_org_eclipse_swt_internal_TIFFCodec_##func
+
+#define MAX_BITS 13
+#define EOL -1
+
+/* Returns the number of bytes written, or -1 if the data is invalid */
+static jint decodePackBits(const signed char *src, jint srcLength, unsigned char *dest, jint destLength)
+{
+	jint srcIndex = 0, destIndex = 0, count;
+	while (srcIndex < srcLength) {
+		jint n = src[srcIndex];
+		if (n >= 0) {
+			/* Copy next n+1 bytes literally */
+			count = n + 1;
+			if (count > srcLength - srcIndex - 1 || count > destLength - destIndex) return -1;
+			memcpy(dest + destIndex, src + srcIndex + 1, count);
+			srcIndex += count + 1;
+			destIndex += count;
+		} else if (n >= -127) {
+			/* Copy next byte -n+1 times */
+			count = -n + 1;
+			if (srcIndex + 1 >= srcLength || count > destLength - destIndex) return -1;
+			memset(dest + destIndex, src[srcIndex + 1], count);
+			srcIndex += 2;
+			destIndex += count;
+		} else {
+			/* Noop when n == -128 */
+			srcIndex++;
+		}
+	}
+	return destIndex;
+}
+
+typedef struct {
+	jint bits;
+	const short (*codes)[2];
+	jint count;
+} codes;
+
+/* {code, run} pairs, by code length */
+static const short WHITE_4[][2] = {{7, 2}, {8, 3}, {11, 4}, {12, 5}, {14, 6}, {15, 7}};
+static const short WHITE_5[][2] = {{7, 10}, {8, 11}, {18, 128}, {19, 8}, {20, 9}, {27, 64}};
+static const short WHITE_6[][2] = {{3, 13}, {7, 1}, {8, 12}, {23, 192}, {24, 1664}, {42, 16}, {43, 17}, {52, 14},
+	{53, 15}};
+static const short WHITE_7[][2] = {{3, 22}, {4, 23}, {8, 20}, {12, 19}, {19, 26}, {23, 21}, {24, 28}, {36, 27},
+	{39, 18}, {40, 24}, {43, 25}, {55, 256}};
+static const short WHITE_8[][2] = {{2, 29}, {3, 30}, {4, 45}, {5, 46}, {10, 47}, {11, 48}, {18, 33}, {19, 34},
+	{20, 35}, {21, 36}, {22, 37}, {23, 38}, {26, 31}, {27, 32}, {36, 53}, {37, 54},
+	{40, 39}, {41, 40}, {42, 41}, {43, 42}, {44, 43}, {45, 44}, {50, 61}, {51, 62},
+	{52, 63}, {53, 0}, {54, 320}, {55, 384}, {74, 59}, {75, 60}, {82, 49}, {83, 50},
+	{84, 51}, {85, 52}, {88, 55}, {89, 56}, {90, 57}, {91, 58}, {100, 448},
+	{101, 512}, {103, 640}, {104, 576}};
+static const short WHITE_9[][2] = {{152, 1472}, {153, 1536}, {154, 1600}, {155, 1728}, {204, 704}, {205, 768},
+	{210, 832}, {211, 896}, {212, 960}, {213, 1024}, {214, 1088}, {215, 1152},
+	{216, 1216}, {217, 1280}, {218, 1344}, {219, 1408}};
+static const short WHITE_11[][2] = {{8, 1792}, {12, 1856}, {13, 1920}};
+static const short WHITE_12[][2] = {{1, EOL}, {18, 1984}, {19, 2048}, {20, 2112}, {21, 2176}, {22, 2240}, {23, 2304},
+	{28, 2368}, {29, 2432}, {30, 2496}, {31, 2560}};
+
+static const short BLACK_2[][2] = {{2, 3}, {3, 2}};
+static const short BLACK_3[][2] = {{2, 1}, {3, 4}};
+static const short BLACK_4[][2] = {{2, 6}, {3, 5}};
+static const short BLACK_5[][2] = {{3, 7}};
+static const short BLACK_6[][2] = {{4, 9}, {5, 8}};
+static const short BLACK_7[][2] = {{4, 10}, {5, 11}, {7, 12}};
+static const short BLACK_8[][2] = {{4, 13}, {7, 14}};
+static const short BLACK_9[][2] = {{24, 15}};
+static const short BLACK_10[][2] = {{8, 18}, {15, 64}, {23, 16}, {24, 17}, {55, 0}};
+static const short BLACK_11[][2] = {{0, EOL}, {8, 1792}, {23, 24}, {24, 25}, {40, 23}, {55, 22}, {103, 19},
+	{104, 20}, {108, 21}, {12, 1856}, {13, 1920}};
+static const short BLACK_12[][2] = {{18, 1984}, {19, 2048}, {20, 2112}, {21, 2176}, {22, 2240}, {23, 2304},
+	{28, 2368}, {29, 2432}, {30, 2496}, {31, 2560}, {36, 52}, {39, 55}, {40, 56},
+	{43, 59}, {44, 60}, {51, 320}, {52, 384}, {53, 448}, {55, 53}, {56, 54}, {82, 50},
+	{83, 51}, {84, 44}, {85, 45}, {86, 46}, {87, 47}, {88, 57}, {89, 58}, {90, 61},
+	{91, 256}, {100, 48}, {101, 49}, {102, 62}, {103, 63}, {104, 30}, {105, 31},
+	{106, 32}, {107, 33}, {108, 40}, {109, 41}, {200, 128}, {201, 192}, {202, 26},
+	{203, 27}, {204, 28}, {205, 29}, {210, 34}, {211, 35}, {212, 36}, {213, 37},
+	{214, 38}, {215, 39}, {218, 42}, {219, 43}};
+static const short BLACK_13[][2] = {{74, 640}, {75, 704}, {76, 768}, {77, 832}, {82, 1280}, {83, 1344}, {84, 1408},
+	{85, 1472}, {90, 1536}, {91, 1600}, {100, 1664}, {101, 1728}, {108, 512},
+	{109, 576}, {114, 896}, {115, 960}, {116, 1024}, {117, 1088}, {118, 1152},
+	{119, 1216}};
+
+#define CODES(table, bits) {bits, table, sizeof(table) / sizeof(table[0])}
+
+static const codes WHITE_CODES[] = {
+	CODES(WHITE_4, 4), CODES(WHITE_5, 5), CODES(WHITE_6, 6), CODES(WHITE_7, 7),
+	CODES(WHITE_8, 8), CODES(WHITE_9, 9), CODES(WHITE_11, 11), CODES(WHITE_12, 12)
+};
+static const codes BLACK_CODES[] = {
+	CODES(BLACK_2, 2), CODES(BLACK_3, 3), CODES(BLACK_4, 4), CODES(BLACK_5, 5),
+	CODES(BLACK_6, 6), CODES(BLACK_7, 7), CODES(BLACK_8, 8), CODES(BLACK_9, 9),
+	CODES(BLACK_10, 10), CODES(BLACK_11, 11), CODES(BLACK_12, 12), CODES(BLACK_13, 13)
+};
+
+/*
+ * Each entry of a lookup table holds the length of the code that the
+ * 13 bits of its index start with and its run plus 2, or 0 for none.
+ */
+typedef unsigned short lookup[1 << MAX_BITS];
+
+#define ENTRY_BITS(entry) ((entry) >> 12)
+#define ENTRY_RUN(entry) (((entry) & 0xFFF) - 2)
+
+static void fillLookup(unsigned short *table, const codes *lengths, jint count)
+{
+	jint i, j, k;
+	memset(table, 0, sizeof(lookup));
+	for (i = 0; i < count; i++) {
+		jint bits = lengths[i].bits, fill = 1 << (MAX_BITS - bits);
+		for (j = 0; j < lengths[i].count; j++) {
+			jint first = lengths[i].codes[j][0] << (MAX_BITS - bits);
+			unsigned short entry = (unsigned short)((bits << 12) | (lengths[i].codes[j][1] + 2));
+			for (k = 0; k < fill; k++) {
+				if (table[first + k] == 0) table[first + k] = entry;
+			}
+		}
+	}
+}
+
+typedef struct {
+	const unsigned char *src;
+	jint srcBits, srcBit;
+	unsigned char *dest;
+	jint destLength, destByte, destBit;
+} huffman;
+
+/* Answers the next 13 bits, padded with zeros past the end of the strip */
+static jint peekBits(huffman *h)
+{
+	jint byte = h->srcBit >> 3, value = 0, i;
+	for (i = 0; i < 3; i++) {
+		value <<= 8;
+		if ((byte + i) * 8 < h->srcBits) value |= h->src[byte + i];
+	}
+	return (value >> (24 - MAX_BITS - (h->srcBit & 7))) & ((1 << MAX_BITS) - 1);
+}
+
+/* Writes count bits of the given value, returns 0 past the end of the image */
+static int setBits(huffman *h, jint value, jint count)
+{
+	unsigned char fill = value ? 0xFF : 0;
+	if (count > ((jlong)h->destLength - h->destByte) * 8 - h->destBit) return 0;
+	while (h->destBit > 0 && count > 0) {
+		unsigned char mask = (unsigned char)(1 << (7 - h->destBit));
+		h->dest[h->destByte] = (unsigned char)(value ? h->dest[h->destByte] | mask : h->dest[h->destByte] & ~mask);
+		count--;
+		if (++h->destBit == 8) {
+			h->destByte++;
+			h->destBit = 0;
+		}
+	}
+	if (count >= 8) {
+		memset(h->dest + h->destByte, fill, count >> 3);
+		h->destByte += count >> 3;
+		count &= 7;
+	}
+	while (count > 0) {
+		unsigned char mask = (unsigned char)(1 << (7 - h->destBit));
+		h->dest[h->destByte] = (unsigned char)(value ? h->dest[h->destByte] | mask : h->dest[h->destByte] & ~mask);
+		count--;
+		h->destBit++;
+	}
+	return 1;
+}
+
+#define RUN_END -1
+#define RUN_ERROR -2
+
+/* Returns the next run length, RUN_END at the final EOL or RUN_ERROR */
+static jint decodeRunLength(huffman *h, const unsigned short *table)
+{
+	jint runLength = 0;
+	for (;;) {
+		unsigned short entry = table[peekBits(h)];
+		jint bits = ENTRY_BITS(entry), run = ENTRY_RUN(entry);
+		if (entry == 0 || h->srcBit + bits > h->srcBits) return RUN_ERROR;
+		h->srcBit += bits;
+		if (run == EOL) {
+			/* Stop when reaching final EOL on last byte */
+			if (h->srcBit >> 3 == (h->srcBits >> 3) - 1) return RUN_END;
+			/* Group 3 starts each row with an EOL - ignore it */
+		} else {
+			runLength += run;
+			if (run < 64) return runLength;
+		}
+	}
+}
+
+/* Returns the number of bytes written, or -1 if the data is invalid */
+static jint decodeModifiedHuffman(huffman *h, jint rowSize, jint rows)
+{
+	lookup white, black;
+	jint row;
+	fillLookup(white, WHITE_CODES, sizeof(WHITE_CODES) / sizeof(WHITE_CODES[0]));
+	fillLookup(black, BLACK_CODES, sizeof(BLACK_CODES) / sizeof(BLACK_CODES[0]));
+	for (row = 0; row < rows; row++) {
+		jint n = 0, isWhite = 1, runLength;
+		while (n < rowSize) {
+			runLength = decodeRunLength(h, isWhite ? white : black);
+			if (runLength == RUN_ERROR) return -1;
+			if (runLength == RUN_END) return h->destByte;
+			n += runLength;
+			if (!setBits(h, isWhite ? 0 : 1, runLength)) return -1;
+			isWhite = !isWhite;
+		}
+		/* byte aligned */
+		if (h->destBit > 0) {
+			h->destByte++;
+			h->destBit = 0;
+		}
+	}
+	return h->destByte;
+}
+
+#ifndef NO_decodePackBits
+JNIEXPORT jint JNICALL TIFF_NATIVE(decodePackBits)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jbyteArray arg3, jint arg4, jint arg5)
+{
+	jbyte *src = NULL, *dest = NULL;
+	jint rc;
+	if (arg0 == NULL || arg3 == NULL) return -1;
+	if (arg1 < 0 || arg2 < 0 || arg1 > (*env)->GetArrayLength(env, arg0) - arg2) return -1;
+	if (arg4 < 0 || arg5 < 0 || arg4 > (*env)->GetArrayLength(env, arg3) - arg5) return -1;
+	if ((src = lockArray(env, arg0, 'B')) == NULL) return -1;
+	if ((dest = lockArray(env, arg3, 'B')) == NULL) {
+		unlockArray(env, arg0, src, 'B', JNI_ABORT);
+		return -1;
+	}
+	rc = decodePackBits((signed char *)src + arg1, arg2, (unsigned char *)dest + arg4, arg5);
+	unlockArray(env, arg3, dest, 'B', 0);
+	unlockArray(env, arg0, src, 'B', JNI_ABORT);
+	return rc;
+}
+#endif
+
+#ifndef NO_decodeModifiedHuffman
+JNIEXPORT jint JNICALL TIFF_NATIVE(decodeModifiedHuffman)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jbyteArray arg3, jint arg4, jint arg5, jint arg6, jint arg7)
+{
+	jbyte *src = NULL, *dest = NULL;
+	huffman h;
+	jint rc;
+	if (arg0 == NULL || arg3 == NULL) return -1;
+	if (arg1 < 0 || arg2 < 0 || arg1 > (*env)->GetArrayLength(env, arg0) - arg2 || arg2 > 0x0FFFFFFF) return -1;
+	if (arg4 < 0 || arg5 < 0 || arg4 > (*env)->GetArrayLength(env, arg3) - arg5) return -1;
+	if (arg6 <= 0 || arg7 < 0) return -1;
+	if ((src = lockArray(env, arg0, 'B')) == NULL) return -1;
+	if ((dest = lockArray(env, arg3, 'B')) == NULL) {
+		unlockArray(env, arg0, src, 'B', JNI_ABORT);
+		return -1;
+	}
+	h.src = (unsigned char *)src + arg1;
+	h.srcBits = arg2 * 8;
+	h.srcBit = 0;
+	h.dest = (unsigned char *)dest + arg4;
+	h.destLength = arg5;
+	h.destByte = h.destBit = 0;
+	rc = decodeModifiedHuffman(&h, arg6, arg7);
+	unlockArray(env, arg3, dest, 'B', 0);
+	unlockArray(env, arg0, src, 'B', JNI_ABORT);
+	return rc;
+}
+#endif
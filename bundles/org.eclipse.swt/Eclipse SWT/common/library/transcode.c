@@ -0,0 +1,378 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+
+/**
+ * transcode.c
+ *
+ * This file contains the UTF-16 and UTF-8 conversions used by the
+ * platform converters.
+ *
+ * Runs of ASCII characters are checked and widened or narrowed eight
+ * or sixteen at a time with SSE2 or NEON when the compiler targets them,
+ * everything else is converted one character at a time.  Like the glib
+ * conversions they replace, the conversions stop at the first NUL and
+ * fail on malformed input.  A high surrogate at the very end of UTF-16
+ * input is left unconverted.
+ */
+
+#include "swt.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TRANSCODE_SSE2
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define TRANSCODE_NEON
+#endif
+
+#if defined(TRANSCODE_SSE2)
+#include <emmintrin.h>
+#elif defined(TRANSCODE_NEON)
+#include <arm_neon.h>
+#endif
+
+#define TRANSCODE_NATIVE(func) Java_org_eclipse_swt_internal_Transcode_##func
+
+/* Conversions of up to this many bytes go through the stack */
+#define STACK_SIZE 1024
+
+/* Returns non zero if the range lies inside the array */
+static int checkRange(jsize length, jint offset, jint count)
+{
+	if (offset < 0 || count < 0) return 0;
+	return (jlong)offset + count <= length;
+}
+
+/*
+* Returns the number of leading characters of src that are ASCII and not
+* NUL, narrowing them into dest when it is not NULL.
+*/
+static jint asciiRun16(const jchar *src, jint length, unsigned char *dest)
+{
+	jint i = 0;
+#if defined(TRANSCODE_SSE2)
+	__m128i high = _mm_set1_epi16((short)0xFF80), zero = _mm_setzero_si128();
+	for (; i + 8 <= length; i += 8) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+		int ascii = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, high), zero));
+		int nul = _mm_movemask_epi8(_mm_cmpeq_epi16(v, zero));
+		if ((ascii & ~nul) != 0xFFFF) break;
+		if (dest != NULL) _mm_storel_epi64((__m128i *)(dest + i), _mm_packus_epi16(v, v));
+	}
+#elif defined(TRANSCODE_NEON)
+	uint16x8_t one = vdupq_n_u16(1), limit = vdupq_n_u16(0x7F);
+	for (; i + 8 <= length; i += 8) {
+		uint16x8_t v = vld1q_u16(src + i);
+		/* c - 1 < 0x7F also rejects NUL, which wraps around */
+		uint16x8_t ok = vcltq_u16(vsubq_u16(v, one), limit);
+		uint16x4_t all = vand_u16(vget_low_u16(ok), vget_high_u16(ok));
+		if (vget_lane_u64(vreinterpret_u64_u16(all), 0) != ~(uint64_t)0) break;
+		if (dest != NULL) vst1_u8(dest + i, vmovn_u16(v));
+	}
+#endif
+	for (; i < length; i++) {
+		jchar c = src[i];
+		if (c == 0 || c >= 0x80) break;
+		if (dest != NULL) dest[i] = (unsigned char)c;
+	}
+	return i;
+}
+
+/*
+* Returns the number of leading bytes of src that are ASCII and not NUL,
+* widening them into dest when it is not NULL.
+*/
+static jint asciiRun8(const unsigned char *src, jint length, jchar *dest)
+{
+	jint i = 0;
+#if defined(TRANSCODE_SSE2)
+	__m128i zero = _mm_setzero_si128();
+	for (; i + 16 <= length; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+		if (_mm_movemask_epi8(v) | _mm_movemask_epi8(_mm_cmpeq_epi8(v, zero))) break;
+		if (dest != NULL) {
+			_mm_storeu_si128((__m128i *)(dest + i), _mm_unpacklo_epi8(v, zero));
+			_mm_storeu_si128((__m128i *)(dest + i + 8), _mm_unpackhi_epi8(v, zero));
+		}
+	}
+#elif defined(TRANSCODE_NEON)
+	uint8x16_t one = vdupq_n_u8(1), limit = vdupq_n_u8(0x7F);
+	for (; i + 16 <= length; i += 16) {
+		uint8x16_t v = vld1q_u8(src + i);
+		uint8x16_t ok = vcltq_u8(vsubq_u8(v, one), limit);
+		uint8x8_t all = vand_u8(vget_low_u8(ok), vget_high_u8(ok));
+		if (vget_lane_u64(vreinterpret_u64_u8(all), 0) != ~(uint64_t)0) break;
+		if (dest != NULL) {
+			vst1q_u16(dest + i, vmovl_u8(vget_low_u8(v)));
+			vst1q_u16(dest + i + 8, vmovl_u8(vget_high_u8(v)));
+		}
+	}
+#endif
+	for (; i < length; i++) {
+		unsigned char c = src[i];
+		if (c == 0 || c >= 0x80) break;
+		if (dest != NULL) dest[i] = c;
+	}
+	return i;
+}
+
+/*
+* Converts UTF-16 to UTF-8, or only counts the bytes when dest is NULL.
+* Returns the number of bytes, or -1 if the input is malformed.
+*/
+static jint utf16ToUtf8(const jchar *src, jint length, unsigned char *dest)
+{
+	jint i = 0, count = 0;
+	while (i < length) {
+		jint c = src[i], n;
+		if (c == 0) break;
+		if (c < 0x80) {
+			jint run = asciiRun16(src + i, length - i, dest != NULL ? dest + count : NULL);
+			i += run;
+			count += run;
+			continue;
+		}
+		if (c < 0x800) {
+			n = 2;
+		} else if (c < 0xD800 || c > 0xDFFF) {
+			n = 3;
+		} else {
+			jint low;
+			if (c >= 0xDC00) return -1;
+			if (i + 1 == length) break;
+			low = src[i + 1];
+			if (low < 0xDC00 || low > 0xDFFF) return -1;
+			c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+			n = 4;
+			i++;
+		}
+		i++;
+		if (dest != NULL) {
+			unsigned char *d = dest + count;
+			switch (n) {
+				case 2:
+					d[0] = (unsigned char)(0xC0 | (c >> 6));
+					d[1] = (unsigned char)(0x80 | (c & 0x3F));
+					break;
+				case 3:
+					d[0] = (unsigned char)(0xE0 | (c >> 12));
+					d[1] = (unsigned char)(0x80 | ((c >> 6) & 0x3F));
+					d[2] = (unsigned char)(0x80 | (c & 0x3F));
+					break;
+				default:
+					d[0] = (unsigned char)(0xF0 | (c >> 18));
+					d[1] = (unsigned char)(0x80 | ((c >> 12) & 0x3F));
+					d[2] = (unsigned char)(0x80 | ((c >> 6) & 0x3F));
+					d[3] = (unsigned char)(0x80 | (c & 0x3F));
+					break;
+			}
+		}
+		count += n;
+	}
+	return count;
+}
+
+/*
+* Converts UTF-8 to UTF-16, or only counts the characters when dest is
+* NULL.  Returns the number of characters, or -1 if the input is
+* malformed or truncated.
+*/
+static jint utf8ToUtf16(const unsigned char *src, jint length, jchar *dest)
+{
+	jint i = 0, count = 0;
+	while (i < length) {
+		jint c = src[i], n, min, k;
+		if (c == 0) break;
+		if (c < 0x80) {
+			jint run = asciiRun8(src + i, length - i, dest != NULL ? dest + count : NULL);
+			i += run;
+			count += run;
+			continue;
+		}
+		if (c < 0xC2) {
+			return -1;
+		} else if (c < 0xE0) {
+			n = 1; min = 0x80; c &= 0x1F;
+		} else if (c < 0xF0) {
+			n = 2; min = 0x800; c &= 0x0F;
+		} else if (c < 0xF5) {
+			n = 3; min = 0x10000; c &= 0x07;
+		} else {
+			return -1;
+		}
+		if (length - i <= n) return -1;
+		for (k = 1; k <= n; k++) {
+			jint b = src[i + k];
+			if ((b & 0xC0) != 0x80) return -1;
+			c = (c << 6) | (b & 0x3F);
+		}
+		if (c < min || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) return -1;
+		i += n + 1;
+		if (c >= 0x10000) {
+			if (dest != NULL) {
+				c -= 0x10000;
+				dest[count] = (jchar)(0xD800 + (c >> 10));
+				dest[count + 1] = (jchar)(0xDC00 + (c & 0x3FF));
+			}
+			count += 2;
+		} else {
+			if (dest != NULL) dest[count] = (jchar)c;
+			count++;
+		}
+	}
+	return count;
+}
+
+#ifndef NO_utf8Length
+JNIEXPORT jint JNICALL TRANSCODE_NATIVE(utf8Length)
+	(JNIEnv *env, jclass that, jcharArray arg0, jint arg1, jint arg2)
+{
+	jchar *chars = NULL;
+	jint rc = -1;
+	if (arg0 == NULL || !checkRange((*env)->GetArrayLength(env, arg0), arg1, arg2)) return -1;
+	if ((chars = lockArray(env, arg0, 'C')) == NULL) return -1;
+	rc = utf16ToUtf8(chars + arg1, arg2, NULL);
+	unlockArray(env, arg0, chars, 'C', JNI_ABORT);
+	return rc;
+}
+#endif
+
+#ifndef NO_utf16Length
+JNIEXPORT jint JNICALL TRANSCODE_NATIVE(utf16Length)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2)
+{
+	jbyte *bytes = NULL;
+	jint rc = -1;
+	if (arg0 == NULL || !checkRange((*env)->GetArrayLength(env, arg0), arg1, arg2)) return -1;
+	if ((bytes = lockArray(env, arg0, 'B')) == NULL) return -1;
+	rc = utf8ToUtf16((const unsigned char *)bytes + arg1, arg2, NULL);
+	unlockArray(env, arg0, bytes, 'B', JNI_ABORT);
+	return rc;
+}
+#endif
+
+#ifndef NO_utf16ToUtf8
+JNIEXPORT jint JNICALL TRANSCODE_NATIVE(utf16ToUtf8)
+	(JNIEnv *env, jclass that, jcharArray arg0, jint arg1, jint arg2, jbyteArray arg3, jint arg4, jint arg5)
+{
+	jchar *chars = NULL;
+	jbyte *bytes = NULL;
+	jint rc = -1;
+	if (arg0 == NULL || !checkRange((*env)->GetArrayLength(env, arg0), arg1, arg2)) return -1;
+	if (arg3 == NULL || !checkRange((*env)->GetArrayLength(env, arg3), arg4, arg5)) return -1;
+	if ((chars = lockArray(env, arg0, 'C')) == NULL) return -1;
+	/* every character needs at most three bytes, measure only when they might not fit */
+	if ((jlong)arg2 * 3 > arg5) {
+		jint count = utf16ToUtf8(chars + arg1, arg2, NULL);
+		if (count < 0 || count > arg5) goto fail;
+	}
+	if ((bytes = lockArray(env, arg3, 'B')) == NULL) goto fail;
+	rc = utf16ToUtf8(chars + arg1, arg2, (unsigned char *)bytes + arg4);
+fail:
+	if (bytes != NULL) unlockArray(env, arg3, bytes, 'B', 0);
+	unlockArray(env, arg0, chars, 'C', JNI_ABORT);
+	return rc;
+}
+#endif
+
+#ifndef NO_utf8ToUtf16
+JNIEXPORT jint JNICALL TRANSCODE_NATIVE(utf8ToUtf16)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2, jcharArray arg3, jint arg4, jint arg5)
+{
+	jbyte *bytes = NULL;
+	jchar *chars = NULL;
+	jint rc = -1;
+	if (arg0 == NULL || !checkRange((*env)->GetArrayLength(env, arg0), arg1, arg2)) return -1;
+	if (arg3 == NULL || !checkRange((*env)->GetArrayLength(env, arg3), arg4, arg5)) return -1;
+	if ((bytes = lockArray(env, arg0, 'B')) == NULL) return -1;
+	/* every byte produces at most one character */
+	if (arg2 > arg5) {
+		jint count = utf8ToUtf16((const unsigned char *)bytes + arg1, arg2, NULL);
+		if (count < 0 || count > arg5) goto fail;
+	}
+	if ((chars = lockArray(env, arg3, 'C')) == NULL) goto fail;
+	rc = utf8ToUtf16((const unsigned char *)bytes + arg1, arg2, chars + arg4);
+fail:
+	if (chars != NULL) unlockArray(env, arg3, chars, 'C', 0);
+	unlockArray(env, arg0, bytes, 'B', JNI_ABORT);
+	return rc;
+}
+#endif
+
+#ifndef NO_toUtf8
+JNIEXPORT jbyteArray JNICALL TRANSCODE_NATIVE(toUtf8)
+	(JNIEnv *env, jclass that, jcharArray arg0, jint arg1, jint arg2, jboolean arg3)
+{
+	unsigned char buffer[STACK_SIZE];
+	jchar *chars = NULL;
+	jbyte *bytes = NULL;
+	jbyteArray result = NULL;
+	jint count, extra = arg3 ? 1 : 0;
+	if (arg0 == NULL || !checkRange((*env)->GetArrayLength(env, arg0), arg1, arg2)) return NULL;
+	if ((chars = lockArray(env, arg0, 'C')) == NULL) return NULL;
+	if ((jlong)arg2 * 3 <= STACK_SIZE) {
+		/* short strings are converted in a single pass and copied */
+		count = utf16ToUtf8(chars + arg1, arg2, buffer);
+		unlockArray(env, arg0, chars, 'C', JNI_ABORT);
+		if (count < 0) return NULL;
+		if ((result = (*env)->NewByteArray(env, count + extra)) == NULL) return NULL;
+		(*env)->SetByteArrayRegion(env, result, 0, count, (jbyte *)buffer);
+		return result;
+	}
+	count = utf16ToUtf8(chars + arg1, arg2, NULL);
+	unlockArray(env, arg0, chars, 'C', JNI_ABORT);
+	if (count < 0) return NULL;
+	if ((result = (*env)->NewByteArray(env, count + extra)) == NULL) return NULL;
+	if ((chars = lockArray(env, arg0, 'C')) == NULL) return NULL;
+	if ((bytes = lockArray(env, result, 'B')) != NULL) {
+		utf16ToUtf8(chars + arg1, arg2, (unsigned char *)bytes);
+		unlockArray(env, result, bytes, 'B', 0);
+	} else {
+		result = NULL;
+	}
+	unlockArray(env, arg0, chars, 'C', JNI_ABORT);
+	return result;
+}
+#endif
+
+#ifndef NO_toUtf16
+JNIEXPORT jcharArray JNICALL TRANSCODE_NATIVE(toUtf16)
+	(JNIEnv *env, jclass that, jbyteArray arg0, jint arg1, jint arg2)
+{
+	jchar buffer[STACK_SIZE];
+	jbyte *bytes = NULL;
+	jchar *chars = NULL;
+	jcharArray result = NULL;
+	jint count;
+	if (arg0 == NULL || !checkRange((*env)->GetArrayLength(env, arg0), arg1, arg2)) return NULL;
+	if ((bytes = lockArray(env, arg0, 'B')) == NULL) return NULL;
+	if (arg2 <= STACK_SIZE) {
+		count = utf8ToUtf16((const unsigned char *)bytes + arg1, arg2, buffer);
+		unlockArray(env, arg0, bytes, 'B', JNI_ABORT);
+		if (count < 0) return NULL;
+		if ((result = (*env)->NewCharArray(env, count)) == NULL) return NULL;
+		(*env)->SetCharArrayRegion(env, result, 0, count, buffer);
+		return result;
+	}
+	count = utf8ToUtf16((const unsigned char *)bytes + arg1, arg2, NULL);
+	unlockArray(env, arg0, bytes, 'B', JNI_ABORT);
+	if (count < 0) return NULL;
+	if ((result = (*env)->NewCharArray(env, count)) == NULL) return NULL;
+	if ((bytes = lockArray(env, arg0, 'B')) == NULL) return NULL;
+	if ((chars = lockArray(env, result, 'C')) != NULL) {
+		utf8ToUtf16((const unsigned char *)bytes + arg1, arg2, chars);
+		unlockArray(env, result, chars, 'C', 0);
+	} else {
+		result = NULL;
+	}
+	unlockArray(env, arg0, bytes, 'B', JNI_ABORT);
+	return result;
+}
+#endif
@@ -0,0 +1,318 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+
+#include "swt.h"
+
+#include <stddef.h>
+#include <string.h>
+#if defined (_WIN32) || defined (_WIN32_WCE)
+#include <windows.h>
+#else
+#include <pthread.h>
+#ifdef __APPLE__
+#include <mach/mach_time.h>
+#endif
+#include <time.h>
+#endif
+
+#define WATCHDOG_NATIVE(func) Java_org_eclipse_swt_internal_Watchdog_##func
+
+/*
+* The watchdog watches one thread, the user-interface thread. That thread
+* counts its transitions: the callbacks it enters and returns from, the
+* times it goes idle and wakes up and, in the libraries built with
+* NATIVE_STATS, the natives it enters and returns from. A native thread
+* samples the counts a few times per threshold. When they have not changed
+* for the threshold while the thread is not idle, the thread is stalled and
+* the sampler records where: the innermost callback slot and, when known,
+* the innermost native. The end of the stall is recorded too.
+*
+* The sampler reads the state of the watched thread while it runs, so a
+* sample may mix two consecutive states. That is good enough to tell where
+* a thread that has not made progress for a while is.
+*/
+
+#define WATCHDOG_DEPTH 64
+#define WATCHDOG_SAMPLERS 16
+#define WATCHDOG_STALLS 32
+
+typedef struct WATCHDOG_STALL {
+	int ended, slot, depth, nativeDepth;
+	jlong duration;
+	const char *className, *function;
+} WATCHDOG_STALL;
+
+volatile int watchdogEnabled = 0;
+static volatile jlong watchdogThreshold = 0;
+static volatile unsigned int watchdogTransitions = 0;
+static volatile int watchdogIdle = 0;
+static volatile int watchdogIdleDepth = 0;
+static volatile int watchdogDepth = 0;
+static volatile int watchdogSlots[WATCHDOG_DEPTH];
+static NATIVE_STATS_SAMPLER watchdogSamplers[WATCHDOG_SAMPLERS];
+static volatile int watchdogSamplerCount = 0;
+static WATCHDOG_STALL watchdogStalls[WATCHDOG_STALLS];
+static int watchdogStallCount = 0;
+static int watchdogStarted = 0;
+#if defined (_WIN32) || defined (_WIN32_WCE)
+static DWORD watchdogThread;
+static CRITICAL_SECTION watchdogLock;
+#define WATCHDOG_LOCK() EnterCriticalSection(&watchdogLock)
+#define WATCHDOG_UNLOCK() LeaveCriticalSection(&watchdogLock)
+#else
+static pthread_t watchdogThread;
+static pthread_mutex_t watchdogLock = PTHREAD_MUTEX_INITIALIZER;
+#define WATCHDOG_LOCK() pthread_mutex_lock(&watchdogLock)
+#define WATCHDOG_UNLOCK() pthread_mutex_unlock(&watchdogLock)
+#endif
+
+/* Monotonic time in nanoseconds, on the clock of the NATIVE_STATS samplers */
+static jlong watchdogTime()
+{
+#if defined (_WIN32) || defined (_WIN32_WCE)
+	static LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+	if (frequency.QuadPart == 0) QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (jlong)(counter.QuadPart / frequency.QuadPart * 1000000000 + counter.QuadPart % frequency.QuadPart * 1000000000 / frequency.QuadPart);
+#elif defined (__APPLE__)
+	static mach_timebase_info_data_t timebase;
+	if (timebase.denom == 0) mach_timebase_info(&timebase);
+	return (jlong)(mach_absolute_time() * timebase.numer / timebase.denom);
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (jlong)now.tv_sec * 1000000000 + now.tv_nsec;
+#endif
+}
+
+static void watchdogSleep(jlong nanos)
+{
+#if defined (_WIN32) || defined (_WIN32_WCE)
+	Sleep((DWORD)(nanos / 1000000));
+#else
+	struct timespec delay;
+	delay.tv_sec = (time_t)(nanos / 1000000000);
+	delay.tv_nsec = (long)(nanos % 1000000000);
+	nanosleep(&delay, NULL);
+#endif
+}
+
+static int watchdogIsWatched()
+{
+#if defined (_WIN32) || defined (_WIN32_WCE)
+	return GetCurrentThreadId() == watchdogThread;
+#else
+	return pthread_equal(pthread_self(), watchdogThread);
+#endif
+}
+
+/* Called by callback.c around the calls into Java, see WATCHDOG_CALLBACK_ENTER */
+void watchdogCallbackEnter(int slot)
+{
+	int depth;
+	if (!watchdogIsWatched()) return;
+	depth = watchdogDepth;
+	if (depth < WATCHDOG_DEPTH) watchdogSlots[depth] = slot;
+	watchdogDepth = depth + 1;
+	watchdogTransitions++;
+}
+
+void watchdogCallbackExit()
+{
+	if (!watchdogIsWatched()) return;
+	if (watchdogDepth > 0) watchdogDepth--;
+	watchdogTransitions++;
+}
+
+static void watchdogRecord(int ended, jlong duration, const char *className, const char *function, int nativeDepth)
+{
+	WATCHDOG_STALL *stall;
+	int depth = watchdogDepth;
+	WATCHDOG_LOCK();
+	if (watchdogStallCount < WATCHDOG_STALLS) {
+		stall = &watchdogStalls[watchdogStallCount++];
+		stall->ended = ended;
+		stall->duration = duration;
+		stall->depth = depth;
+		stall->slot = depth > 0 && depth <= WATCHDOG_DEPTH ? watchdogSlots[depth - 1] : -1;
+		stall->nativeDepth = nativeDepth;
+		stall->className = className;
+		stall->function = function;
+	}
+	WATCHDOG_UNLOCK();
+}
+
+static void watchdogRun()
+{
+	unsigned int last = 0;
+	jlong progress = watchdogTime();
+	int stalled = 0;
+	while (1) {
+		int i, nativeDepth = 0;
+		unsigned int transitions;
+		const char *className = NULL, *function = NULL;
+		jlong now, innermost = 0, threshold = watchdogThreshold;
+		watchdogSleep(threshold > 0 ? threshold / 4 + 1 : 100000000);
+		now = watchdogTime();
+		if (!watchdogEnabled) {
+			stalled = 0;
+			progress = now;
+			continue;
+		}
+		transitions = watchdogTransitions;
+		for (i = 0; i < watchdogSamplerCount; i++) {
+			unsigned int count = 0;
+			const char *samplerClass = NULL, *samplerFunction = NULL;
+			jlong start = 0;
+			int depth = watchdogSamplers[i](&count, &samplerClass, &samplerFunction, &start);
+			transitions += count;
+			if (depth > 0 && start >= innermost) {
+				innermost = start;
+				nativeDepth = depth;
+				className = samplerClass;
+				function = samplerFunction;
+			}
+		}
+		/* A thread that sleeps is not stalled, unless a callback it runs while it sleeps is */
+		if (transitions != last || (watchdogIdle && watchdogDepth <= watchdogIdleDepth)) {
+			if (stalled) watchdogRecord(1, now - progress, NULL, NULL, 0);
+			stalled = 0;
+			last = transitions;
+			progress = now;
+			continue;
+		}
+		if (!stalled && now - progress >= threshold) {
+			stalled = 1;
+			watchdogRecord(0, now - progress, className, function, nativeDepth);
+		}
+	}
+}
+
+#if defined (_WIN32) || defined (_WIN32_WCE)
+static DWORD WINAPI watchdogMain(LPVOID arg)
+{
+	watchdogRun();
+	return 0;
+}
+#else
+static void *watchdogMain(void *arg)
+{
+	watchdogRun();
+	return NULL;
+}
+#endif
+
+/*
+* Watches the calling thread. The sampler thread is created the first time
+* and lives as long as the process, idle while the watchdog is stopped.
+*/
+JNIEXPORT jboolean JNICALL WATCHDOG_NATIVE(_1start)
+	(JNIEnv *env, jclass that, jint threshold)
+{
+	watchdogEnabled = 0;
+#if defined (_WIN32) || defined (_WIN32_WCE)
+	watchdogThread = GetCurrentThreadId();
+#else
+	watchdogThread = pthread_self();
+#endif
+	watchdogThreshold = (jlong)threshold * 1000000;
+	watchdogDepth = 0;
+	watchdogIdle = 0;
+	watchdogTransitions++;
+	if (!watchdogStarted) {
+#if defined (_WIN32) || defined (_WIN32_WCE)
+		HANDLE handle;
+		InitializeCriticalSection(&watchdogLock);
+		if ((handle = CreateThread(NULL, 0, watchdogMain, NULL, 0, NULL)) == NULL) return JNI_FALSE;
+		CloseHandle(handle);
+#else
+		pthread_t sampler;
+		if (pthread_create(&sampler, NULL, watchdogMain, NULL) != 0) return JNI_FALSE;
+		pthread_detach(sampler);
+#endif
+		watchdogStarted = 1;
+	}
+	watchdogEnabled = 1;
+	return JNI_TRUE;
+}
+
+JNIEXPORT void JNICALL WATCHDOG_NATIVE(_1stop)
+	(JNIEnv *env, jclass that)
+{
+	watchdogEnabled = 0;
+	watchdogSamplerCount = 0;
+}
+
+/* Adds a NATIVE_STATS_SAMPLER answered by the Watch native of a stats class */
+JNIEXPORT void JNICALL WATCHDOG_NATIVE(_1addSampler)
+	(JNIEnv *env, jclass that, jlong sampler)
+{
+	int i, count = watchdogSamplerCount;
+	if (sampler == 0) return;
+	for (i = 0; i < count; i++) {
+		if (watchdogSamplers[i] == (NATIVE_STATS_SAMPLER)(jintLong)sampler) return;
+	}
+	if (count == WATCHDOG_SAMPLERS) return;
+	watchdogSamplers[count] = (NATIVE_STATS_SAMPLER)(jintLong)sampler;
+	watchdogSamplerCount = count + 1;
+}
+
+JNIEXPORT void JNICALL WATCHDOG_NATIVE(_1setIdle)
+	(JNIEnv *env, jclass that, jboolean idle)
+{
+	watchdogIdleDepth = watchdogDepth;
+	watchdogIdle = idle;
+	watchdogTransitions++;
+}
+
+/*
+* Copies the recorded stalls into values, five longs per stall (1 if the
+* stall ended, its length so far in nanoseconds, the innermost callback slot
+* or -1, the depth in callbacks and the depth in natives) and the class and
+* function of the innermost native, when known, into names. Answers the
+* number of stalls copied and forgets them.
+*/
+JNIEXPORT jint JNICALL WATCHDOG_NATIVE(_1getStalls)
+	(JNIEnv *env, jclass that, jlongArray values, jobjectArray names)
+{
+	int i, count;
+	jlong *lpvalues;
+	WATCHDOG_STALL stalls[WATCHDOG_STALLS];
+	if (!watchdogStarted || values == NULL || names == NULL) return 0;
+	count = WATCHDOG_STALLS;
+	if (count > (*env)->GetArrayLength(env, values) / 5) count = (*env)->GetArrayLength(env, values) / 5;
+	if (count > (*env)->GetArrayLength(env, names) / 2) count = (*env)->GetArrayLength(env, names) / 2;
+	WATCHDOG_LOCK();
+	if (count > watchdogStallCount) count = watchdogStallCount;
+	memcpy(stalls, watchdogStalls, count * sizeof(WATCHDOG_STALL));
+	watchdogStallCount = 0;
+	WATCHDOG_UNLOCK();
+	if (count == 0) return 0;
+	if ((lpvalues = (*env)->GetLongArrayElements(env, values, NULL)) == NULL) return 0;
+	for (i = 0; i < count; i++) {
+		lpvalues[i * 5] = stalls[i].ended;
+		lpvalues[i * 5 + 1] = stalls[i].duration;
+		lpvalues[i * 5 + 2] = stalls[i].slot;
+		lpvalues[i * 5 + 3] = stalls[i].depth;
+		lpvalues[i * 5 + 4] = stalls[i].nativeDepth;
+	}
+	(*env)->ReleaseLongArrayElements(env, values, lpvalues, 0);
+	for (i = 0; i < count; i++) {
+		jstring className = stalls[i].className != NULL ? (*env)->NewStringUTF(env, stalls[i].className) : NULL;
+		jstring function = stalls[i].function != NULL ? (*env)->NewStringUTF(env, stalls[i].function) : NULL;
+		(*env)->SetObjectArrayElement(env, names, i * 2, className);
+		(*env)->SetObjectArrayElement(env, names, i * 2 + 1, function);
+		if (className != NULL) (*env)->DeleteLocalRef(env, className);
+		if (function != NULL) (*env)->DeleteLocalRef(env, function);
+	}
+	return count;
+}
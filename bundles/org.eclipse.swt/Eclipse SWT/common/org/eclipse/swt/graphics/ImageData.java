@@ -13,6 +13,7 @@ package org.eclipse.swt.graphics;
 
 import java.io.*;
 import org.eclipse.swt.*;
+import org.eclipse.swt.internal.Blit;
 import org.eclipse.swt.internal.CloneableCompatibility;
 
 /**
@@ -876,6 +877,7 @@ public void getPixels(int x, int y, int getWidth, int[] pixels, int startIndex)
 	if (pixels == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
 	if (getWidth < 0 || x >= width || y >= height || x < 0 || y < 0) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
 	if (getWidth == 0) return;
+	if (getWidth >= BLIT_PIXELS && Blit.LOADED && Blit.getPixels(data, bytesPerLine, width, depth, x, y, getWidth, pixels, startIndex)) return;
 	int index;
 	int theByte;
 	int mask;
@@ -1158,6 +1160,81 @@ public ImageData scaledTo(int width, int height) {
 	return dest;
 }
 
+/**
+ * Returns a copy of the receiver which has been stretched or
+ * shrunk to the specified size, filtering the pixels with the
+ * specified interpolation. If either the width or height is
+ * negative, the resulting image will be inverted in the
+ * associated axis.
+ * <p>
+ * <code>SWT.LOW</code> interpolates between neighboring pixels.
+ * <code>SWT.HIGH</code> also averages all the pixels that are
+ * covered by each pixel of a smaller image. Images whose pixels
+ * cannot be filtered, such as images with a palette or with a
+ * transparency mask, and inverted images are scaled as by
+ * <code>scaledTo(int, int)</code>, which is also the behavior
+ * of <code>SWT.DEFAULT</code> and <code>SWT.NONE</code>.
+ * </p>
+ *
+ * @param width the width of the new ImageData
+ * @param height the height of the new ImageData
+ * @param interpolation the interpolation, one of <code>SWT.DEFAULT</code>,
+ * <code>SWT.NONE</code>, <code>SWT.LOW</code> or <code>SWT.HIGH</code>
+ * @return a scaled copy of the image
+ *
+ * @exception IllegalArgumentException <ul>
+ *    <li>ERROR_INVALID_ARGUMENT - if the interpolation is not one of the values listed above</li>
+ * </ul>
+ *
+ * @since 3.103
+ */
+public ImageData scaledTo(int width, int height, int interpolation) {
+	switch (interpolation) {
+		case SWT.DEFAULT:
+		case SWT.NONE:
+			break;
+		case SWT.LOW:
+		case SWT.HIGH: {
+			ImageData dest = filteredScaledTo(width, height, interpolation);
+			if (dest != null) return dest;
+			break;
+		}
+		default:
+			SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	}
+	return scaledTo(width, height);
+}
+
+/**
+ * Scales the receiver with the native filters, or returns
+ * <code>null</code> when its pixels are not whole bytes per
+ * channel or the natives are not available.
+ */
+ImageData filteredScaledTo(int width, int height, int interpolation) {
+	if (width <= 0 || height <= 0 || !Blit.LOADED) return null;
+	if (!palette.isDirect || (depth != 8 && depth != 24 && depth != 32)) return null;
+	if (!isByteMask(palette.redMask) || !isByteMask(palette.greenMask) || !isByteMask(palette.blueMask)) return null;
+	if (maskData != null || transparentPixel != -1) return null;
+	int filter = interpolation == SWT.HIGH && width <= this.width && height <= this.height ? Blit.BOX : Blit.BILINEAR;
+	ImageData dest = new ImageData(
+		width, height, depth, palette,
+		scanlinePad, null, 0, null,
+		null, -1, transparentPixel, type,
+		x, y, disposalMethod, delayTime);
+	if (!Blit.scale(data, 0, bytesPerLine, this.width, this.height, dest.data, 0, dest.bytesPerLine, width, height, depth / 8, filter)) return null;
+	if (alpha != -1) {
+		dest.alpha = alpha;
+	} else if (alphaData != null) {
+		dest.alphaData = new byte[width * height];
+		if (!Blit.scale(alphaData, 0, this.width, this.width, this.height, dest.alphaData, 0, width, width, height, 1, filter)) return null;
+	}
+	return dest;
+}
+
+static boolean isByteMask(int mask) {
+	return mask == 0xFF || mask == 0xFF00 || mask == 0xFF0000 || mask == 0xFF000000;
+}
+
 /**
  * Sets the alpha value at offset <code>x</code> in
  * scanline <code>y</code> in the receiver's alpha data.
@@ -1433,6 +1510,7 @@ public void setPixels(int x, int y, int putWidth, int[] pixels, int startIndex)
 	if (pixels == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
 	if (putWidth < 0 || x >= width || y >= height || x < 0 || y < 0) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
 	if (putWidth == 0) return;
+	if (putWidth >= BLIT_PIXELS && Blit.LOADED && Blit.setPixels(data, bytesPerLine, width, depth, x, y, putWidth, pixels, startIndex)) return;
 	int index;
 	int theByte;
 	int mask;
@@ -1698,6 +1776,11 @@ static final int
 	ALPHA_MASK_INDEX = -5,        // Consider source palette indices transparent if in alphaData array
 	ALPHA_MASK_RGB = -6;          // Consider source RGBs transparent if in RGB888 format alphaData array
 
+/**
+ * Spans of at least this many pixels are read and written by Blit.
+ */
+static final int BLIT_PIXELS = 32;
+
 /**
  * Byte and bit order constants.
  */
@@ -1876,6 +1959,13 @@ static void blit(int op,
 	/*** Blit ***/
 	int dp = dpr;
 	int sp = spr;
+	if ((alphaMode == 0x10000) && (sbpp >= 3) && (dbpp >= 3) && !flipX &&
+		(srcWidth == destWidth) && (srcHeight == destHeight) &&
+		(srcData != destData) && Blit.LOADED) {
+		/*** Native blit (byte aligned channels, no scaling) ***/
+		int map = getByteMap(stype, srcRedMask, srcGreenMask, srcBlueMask, dtype, destRedMask, destGreenMask, destBlueMask);
+		if (map != -1 && Blit.shuffle(srcData, spr, srcStride, sbpp, destData, dpr, dpryi, dbpp, destWidth, destHeight, map)) return;
+	}
 	if ((alphaMode == 0x10000) && (stype == dtype) &&
 		(srcRedMask == destRedMask) && (srcGreenMask == destGreenMask) &&
 		(srcBlueMask == destBlueMask) && (srcAlphaMask == destAlphaMask)) {
@@ -2179,6 +2269,50 @@ static void blit(int op,
 	}			
 }
 
+/**
+ * Returns the index of the byte holding the given 8 bit channel within
+ * a pixel of the given type, or -1 if the channel is not byte aligned.
+ */
+static int getByteIndex(int type, int mask) {
+	for (int n = 0; n < 4; n++) {
+		if (mask != 0xFF << (n * 8)) continue;
+		switch (type) {
+			case TYPE_GENERIC_24: return n < 3 ? 2 - n : -1;
+			case TYPE_GENERIC_32_MSB: return 3 - n;
+			case TYPE_GENERIC_32_LSB: return n;
+		}
+	}
+	return -1;
+}
+
+/**
+ * Returns the byte map for Blit.shuffle that converts between two
+ * direct palette formats, or -1 if a channel is not byte aligned.
+ * Destination bytes without a channel are cleared, matching the
+ * comprehensive blit.
+ */
+static int getByteMap(int stype, int srcRedMask, int srcGreenMask, int srcBlueMask,
+	int dtype, int destRedMask, int destGreenMask, int destBlueMask) {
+	if (stype == dtype && srcRedMask == destRedMask && srcGreenMask == destGreenMask && srcBlueMask == destBlueMask) {
+		return 0x03020100;
+	}
+	int srcRed = getByteIndex(stype, srcRedMask), destRed = getByteIndex(dtype, destRedMask);
+	int srcGreen = getByteIndex(stype, srcGreenMask), destGreen = getByteIndex(dtype, destGreenMask);
+	int srcBlue = getByteIndex(stype, srcBlueMask), destBlue = getByteIndex(dtype, destBlueMask);
+	if (srcRed == -1 || srcGreen == -1 || srcBlue == -1) return -1;
+	if (destRed == -1 || destGreen == -1 || destBlue == -1) return -1;
+	if (destRed == destGreen || destRed == destBlue || destGreen == destBlue) return -1;
+	int map = 0;
+	for (int k = 0; k < 4; k++) {
+		int index = Blit.ZERO;
+		if (k == destRed) index = srcRed;
+		if (k == destGreen) index = srcGreen;
+		if (k == destBlue) index = srcBlue;
+		map |= index << (k * 8);
+	}
+	return map;
+}
+
 /**
  * Blits an index palette image into an index palette image.
  * <p>
@@ -142,12 +142,91 @@ void reset() {
  * </ul>
  */
 public ImageData[] load(InputStream stream) {
+	return load(stream, 1);
+}
+
+/**
+ * Loads an array of <code>ImageData</code> objects from the
+ * specified input stream, reducing jpeg images to
+ * <code>1/scaleDenominator</code> of their width and height,
+ * rounded up. Throws an error if either an error occurs while
+ * loading the images, or if the images are not of a supported
+ * type. Returns the loaded image data array.
+ * <p>
+ * The scale denominator is 1, 2, 4 or 8; other values are rounded
+ * down to one of these, and 1 loads images at full size. Images in
+ * other formats are always loaded at full size. Where the platform
+ * decodes jpeg files natively, the reduction happens while the image
+ * is decoded, which is much faster than scaling the full size image
+ * afterwards.
+ * </p>
+ *
+ * @param stream the input stream to load the images from
+ * @param scaleDenominator the reduction applied to jpeg images
+ * @return an array of <code>ImageData</code> objects loaded from the specified input stream
+ *
+ * @exception IllegalArgumentException <ul>
+ *    <li>ERROR_NULL_ARGUMENT - if the stream is null</li>
+ * </ul>
+ * @exception SWTException <ul>
+ *    <li>ERROR_IO - if an IO error occurs while reading from the stream</li>
+ *    <li>ERROR_INVALID_IMAGE - if the image stream contains invalid data</li>
+ *    <li>ERROR_UNSUPPORTED_FORMAT - if the image stream contains an unrecognized format</li>
+ * </ul>
+ *
+ * @since 3.103
+ */
+public ImageData[] load(InputStream stream, int scaleDenominator) {
 	if (stream == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
 	reset();
-	data = FileFormat.load(stream, this);
+	data = FileFormat.load(stream, this, scaleDenominator);
 	return data;
 }
 
+/**
+ * Loads the first image from the specified input stream a band of
+ * rows at a time, so that large images can be processed without
+ * holding all of their pixels in memory. Throws an error if either
+ * an error occurs while loading the image, or if the image is not
+ * of a supported type.
+ * <p>
+ * Each band is sent to the image loader listeners as an
+ * <code>ImageLoaderEvent</code> whose <code>imageData</code> holds
+ * at most <code>bandHeight</code> rows of the image, with its
+ * <code>y</code> field set to the row of the image where the band
+ * starts, and whose <code>endOfImage</code> flag is set for the last
+ * band. The <code>logicalScreenWidth</code> and <code>logicalScreenHeight</code>
+ * fields are set to the size of the image before the first band is
+ * sent. The <code>data</code> field is not set.
+ * </p><p>
+ * Non-interlaced PNG images are decoded one band at a time. Other
+ * images are decoded completely before their bands are sent.
+ * </p>
+ *
+ * @param stream the input stream to load the image from
+ * @param bandHeight the maximum number of rows in each band
+ *
+ * @exception IllegalArgumentException <ul>
+ *    <li>ERROR_NULL_ARGUMENT - if the stream is null</li>
+ *    <li>ERROR_INVALID_ARGUMENT - if the band height is less than one</li>
+ * </ul>
+ * @exception SWTException <ul>
+ *    <li>ERROR_IO - if an IO error occurs while reading from the stream</li>
+ *    <li>ERROR_INVALID_IMAGE - if the image stream contains invalid data</li>
+ *    <li>ERROR_UNSUPPORTED_FORMAT - if the image stream contains an unrecognized format</li>
+ * </ul>
+ *
+ * @see ImageLoaderListener
+ *
+ * @since 3.103
+ */
+public void loadBands(InputStream stream, int bandHeight) {
+	if (stream == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
+	if (bandHeight < 1) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	reset();
+	FileFormat.loadBands(stream, this, bandHeight);
+}
+
 /**
  * Loads an array of <code>ImageData</code> objects from the
  * file with the specified name. Throws an error if either
@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.internal;
+
+/**
+ * Natives used by the performance tests to measure the cost of the
+ * JNI transitions made by the generated bindings, apart from the work
+ * done by the functions they call.
+ * <p>
+ * These natives are not used by SWT itself.
+ * </p>
+ */
+public class Benchmark {
+
+	/**
+	 * <code>true</code> if the natives are available.
+	 */
+	public static final boolean LOADED;
+
+	static {
+		boolean loaded = false;
+		try {
+			Library.loadLibrary ("swt"); //$NON-NLS-1$
+			loaded = true;
+		} catch (Throwable e) {}
+		LOADED = loaded;
+	}
+
+/**
+ * Returns immediately.
+ */
+public static final native void empty ();
+
+/**
+ * Pins <code>array</code> the way the generated natives do and releases it
+ * without copying it back.  Returns the first byte of the array, or
+ * <code>-1</code> if the array is <code>null</code>.
+ */
+public static final native int pin (byte[] array);
+
+/**
+ * Calls the function at <code>address</code>, usually the address of a
+ * <code>Callback</code> that takes one argument, <code>count</code> times
+ * with the arguments <code>0</code> to <code>count - 1</code>.  Returns the
+ * sum of the results, or <code>-1</code> if the address is <code>0</code>.
+ */
+public static final native long /*int*/ call (long /*int*/ address, int count);
+}
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.internal;
+
+/**
+ * Native pixel conversion kernels for byte aligned 24 and 32 bit
+ * direct palette images.
+ * <p>
+ * Every kernel returns <code>false</code> without touching the data
+ * when its arguments do not describe a region inside the arrays, so
+ * that callers can fall back to their Java implementation.
+ * </p>
+ */
+public class Blit {
+
+	/**
+	 * <code>true</code> if the natives are available.
+	 */
+	public static final boolean LOADED;
+
+	/**
+	 * The map entry for a destination byte that is set to zero.
+	 */
+	public static final int ZERO = 0xFF;
+
+	/**
+	 * The <code>convert</code> flag that premultiplies the color bytes
+	 * by the alpha byte.
+	 */
+	public static final int PREMULTIPLY = 1;
+
+	/**
+	 * The <code>convert</code> flag that divides the color bytes by the
+	 * alpha byte.
+	 */
+	public static final int UNPREMULTIPLY = 2;
+
+	/**
+	 * The <code>scale</code> filter that interpolates between the four
+	 * source pixels nearest to each destination pixel.
+	 */
+	public static final int BILINEAR = 1;
+
+	/**
+	 * The <code>scale</code> filter that averages the source pixels
+	 * covered by each destination pixel.
+	 */
+	public static final int BOX = 2;
+
+	static {
+		boolean loaded = false;
+		try {
+			Library.loadLibrary ("swt"); //$NON-NLS-1$
+			loaded = true;
+		} catch (Throwable e) {}
+		LOADED = loaded;
+	}
+
+/**
+ * Converts pixels between byte aligned formats.  Byte <code>k</code> of
+ * each destination pixel is copied from the source byte whose index is
+ * stored in bits <code>8*k</code> to <code>8*k+7</code> of the map, or
+ * set to zero when that index is <code>ZERO</code>.  Strides may be
+ * negative to flip the rows.
+ */
+public static final native boolean shuffle (byte[] src, int srcOffset, int srcStride, int srcBytesPerPixel, byte[] dest, int destOffset, int destStride, int destBytesPerPixel, int width, int height, int map);
+
+/**
+ * Multiplies the color bytes of 32 bit pixels by the alpha byte.
+ */
+public static final native boolean premultiply (byte[] data, int offset, int stride, int width, int height, int alphaIndex);
+
+/**
+ * Divides the color bytes of 32 bit pixels by the alpha byte.
+ */
+public static final native boolean unpremultiply (byte[] data, int offset, int stride, int width, int height, int alphaIndex);
+
+/**
+ * Stores one byte per pixel of <code>alpha</code> into the alpha byte of
+ * 32 bit pixels.
+ */
+public static final native boolean mergeAlpha (byte[] data, int offset, int stride, int width, int height, int alphaIndex, byte[] alpha, int alphaOffset, int alphaStride);
+
+/**
+ * Scales pixels of 1 to 4 bytes with the <code>BILINEAR</code> or
+ * <code>BOX</code> filter, filtering every byte of a pixel separately.
+ * The source and destination must be different arrays.
+ */
+public static final native boolean scale (byte[] src, int srcOffset, int srcStride, int srcWidth, int srcHeight, byte[] dest, int destOffset, int destStride, int destWidth, int destHeight, int bytesPerPixel, int filter);
+
+/**
+ * Reads <code>count</code> pixels of the given depth into
+ * <code>pixels</code>, starting at pixel <code>x</code> of row
+ * <code>y</code> and continuing on the following rows, the same way as
+ * <code>ImageData.getPixels</code>.
+ */
+public static final native boolean getPixels (byte[] data, int bytesPerLine, int width, int depth, int x, int y, int count, int[] pixels, int startIndex);
+
+/**
+ * Writes <code>count</code> pixels of the given depth from
+ * <code>pixels</code>, the same way as <code>ImageData.setPixels</code>.
+ */
+public static final native boolean setPixels (byte[] data, int bytesPerLine, int width, int depth, int x, int y, int count, int[] pixels, int startIndex);
+
+/**
+ * Converts pixels in native memory in one pass, the same way as
+ * <code>shuffle</code>.  When <code>flags</code> is not zero or
+ * <code>alpha</code> is not <code>null</code>, the source must have
+ * 32 bit pixels whose alpha byte is <code>alphaIndex</code>: the flags
+ * are applied to the source pixels and their alpha bytes are stored
+ * into <code>alpha</code> before they are converted.  The source and
+ * destination may then be the same memory.
+ */
+public static final native boolean convert (long /*int*/ src, int srcStride, int srcBytesPerPixel, long /*int*/ dest, int destStride, int destBytesPerPixel, int width, int height, int map, int alphaIndex, int flags, byte[] alpha, int alphaOffset, int alphaStride);
+
+/**
+ * Converts pixels in native memory into an array, the same way as
+ * <code>convert</code>.
+ */
+public static final native boolean convertToArray (long /*int*/ src, int srcStride, int srcBytesPerPixel, byte[] dest, int destOffset, int destStride, int destBytesPerPixel, int width, int height, int map, int alphaIndex, int flags, byte[] alpha, int alphaOffset, int alphaStride);
+}
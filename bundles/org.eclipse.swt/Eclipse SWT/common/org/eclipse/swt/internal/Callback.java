@@ -27,9 +27,9 @@ public class Callback {
 	
 	Object object;
 	String method, signature;
-	int argCount;
+	int argCount, slot = -1;
 	long /*int*/ address, errorResult;
-	boolean isStatic, isArrayBased;
+	boolean isStatic, isArrayBased, resolvesTarget, isWeak;
 
 	static final String PTR_SIGNATURE = C.PTR_SIZEOF == 4 ? "I" : "J"; //$NON-NLS-1$  //$NON-NLS-2$
 	static final String SIGNATURE_0 = getSignature(0);
@@ -39,6 +39,14 @@ public class Callback {
 	static final String SIGNATURE_4 = getSignature(4);
 	static final String SIGNATURE_N = "(["+PTR_SIGNATURE+")"+PTR_SIGNATURE; //$NON-NLS-1$  //$NON-NLS-2$
 
+	/* Indices into the array filled by getStats() */
+	public static final int STATS_COUNT = 0;
+	public static final int STATS_TOTAL_TIME = 1;
+	public static final int STATS_MAX_TIME = 2;
+	public static final int STATS_HISTOGRAM = 3;
+	public static final int STATS_BUCKETS = 128;
+	public static final int STATS_SIZE = STATS_HISTOGRAM + STATS_BUCKETS;
+
 /**
  * Constructs a new instance of this class given an object
  * to send the message to, a string naming the method to
@@ -89,18 +97,82 @@ public Callback (Object object, String method, int argCount, boolean isArrayBase
  * @param errorResult the return value if the java code throws an exception
  */
 public Callback (Object object, String method, int argCount, boolean isArrayBased, long /*int*/ errorResult) {
+	this (object, method, argCount, isArrayBased, errorResult, false);
+}
+
+/**
+ * Constructs a new instance of this class given an object
+ * to send the message to, a string naming the method to
+ * invoke, an argument count, a flag indicating whether
+ * or not the arguments will be passed in an array, a value
+ * to return when an exception happens and a flag indicating
+ * whether or not the method receives the target of the call.
+ * The method of a callback that resolves its target takes an
+ * <code>Object</code> before the native arguments: the target
+ * registered with <code>setTarget()</code> for the first native
+ * argument, or <code>null</code> if there is none. Callbacks
+ * with arguments passed in an array do not resolve targets.
+ * Note that, if the object is an instance of <code>Class</code>
+ * it is assumed that the method is a static method on that
+ * class.
+ *
+ * @param object the object to send the message to
+ * @param method the name of the method to invoke
+ * @param argCount the number of arguments that the method takes
+ * @param isArrayBased <code>true</code> if the arguments should be passed in an array and false otherwise
+ * @param errorResult the return value if the java code throws an exception
+ * @param resolvesTarget <code>true</code> if the method receives the target of the call and false otherwise
+ *
+ * @see #setTarget(long, Object)
+ */
+public Callback (Object object, String method, int argCount, boolean isArrayBased, long /*int*/ errorResult, boolean resolvesTarget) {
+	this (object, method, argCount, isArrayBased, errorResult, resolvesTarget, false);
+}
+
+/**
+ * Constructs a new instance of this class given an object
+ * to send the message to, a string naming the method to
+ * invoke, an argument count, a flag indicating whether
+ * or not the arguments will be passed in an array, a value
+ * to return when an exception happens, a flag indicating
+ * whether or not the method receives the target of the call
+ * and a flag indicating whether or not the object is held
+ * weakly. A callback that holds its object weakly does not
+ * keep it from being garbage collected, and returns the error
+ * result once it has been. The callback must still be disposed
+ * to release its native resources.
+ * Note that, if the object is an instance of <code>Class</code>
+ * it is assumed that the method is a static method on that
+ * class.
+ *
+ * @param object the object to send the message to
+ * @param method the name of the method to invoke
+ * @param argCount the number of arguments that the method takes
+ * @param isArrayBased <code>true</code> if the arguments should be passed in an array and false otherwise
+ * @param errorResult the return value if the java code throws an exception
+ * @param resolvesTarget <code>true</code> if the method receives the target of the call and false otherwise
+ * @param isWeak <code>true</code> if the object should be held weakly and false otherwise
+ *
+ * @see #isCollected(int)
+ */
+public Callback (Object object, String method, int argCount, boolean isArrayBased, long /*int*/ errorResult, boolean resolvesTarget, boolean isWeak) {
 
 	/* Set the callback fields */
-	this.object = object;
+	this.object = isWeak ? null : object;
 	this.method = method;
 	this.argCount = argCount;
 	this.isStatic = object instanceof Class;
 	this.isArrayBased = isArrayBased;
+	if (isArrayBased || argCount == 0) resolvesTarget = false;
+	this.resolvesTarget = resolvesTarget;
+	this.isWeak = isWeak;
 	this.errorResult = errorResult;
 	
 	/* Inline the common cases */
 	if (isArrayBased) {
 		signature = SIGNATURE_N;
+	} else if (resolvesTarget) {
+		signature = "(Ljava/lang/Object;" + getSignature(argCount).substring(1); //$NON-NLS-1$
 	} else {
 		switch (argCount) {
 			case 0: signature = SIGNATURE_0; break; //$NON-NLS-1$
@@ -114,7 +186,7 @@ public Callback (Object object, String method, int argCount, boolean isArrayBase
 	}
 	
 	/* Bind the address */
-	address = bind (this, object, method, signature, argCount, isStatic, isArrayBased, errorResult);
+	address = bind (this, object, method, signature, argCount, isStatic, isArrayBased, resolvesTarget, isWeak, errorResult);
 }
 
 /**
@@ -129,9 +201,11 @@ public Callback (Object object, String method, int argCount, boolean isArrayBase
  * @param argCount the callback's method argument count
  * @param isStatic whether the callback's method is static
  * @param isArrayBased whether the callback's method is array based
+ * @param resolvesTarget whether the callback's method receives the target of the call
+ * @param isWeak whether the callback's object is held weakly
  * @param errorResult the callback's error result
  */
-static native synchronized long /*int*/ bind (Callback callback, Object object, String method, String signature, int argCount, boolean isStatic, boolean isArrayBased, long /*int*/ errorResult);
+static native synchronized long /*int*/ bind (Callback callback, Object object, String method, String signature, int argCount, boolean isStatic, boolean isArrayBased, boolean resolvesTarget, boolean isWeak, long /*int*/ errorResult);
 
 /**
  * Releases the native level resources associated with the callback,
@@ -140,7 +214,7 @@ static native synchronized long /*int*/ bind (Callback callback, Object object,
  * from accidentally holding onto extraneous garbage.
  */
 public void dispose () {
-	if (object == null) return;
+	if (method == null) return;
 	unbind (this);
 	object = method = signature = null;
 	address = 0;
@@ -156,6 +230,18 @@ public long /*int*/ getAddress () {
 	return address;
 }
 
+/**
+ * Copies the call statistics of the receiver into the given array.
+ *
+ * @param stats an array of at least <code>STATS_SIZE</code> elements
+ * @return <code>true</code> if the receiver is bound and false otherwise
+ *
+ * @see #getStats(int, long[])
+ */
+public boolean getStats (long[] stats) {
+	return getStats (slot, stats) == this;
+}
+
 /**
  * Returns the SWT platform name.
  *
@@ -165,7 +251,7 @@ public static native String getPlatform ();
 
 /**
  * Returns the number of times the system has been recursively entered
- * through a callback.
+ * through a callback on the calling thread.
  * <p>
  * Note: This should not be called by application code.
  * </p>
@@ -185,10 +271,12 @@ static String getSignature(int argCount) {
 
 /**
  * Indicates whether or not callbacks which are triggered at the
- * native level should cause the messages described by the matching
- * <code>Callback</code> objects to be invoked. This method is used
- * to safely shut down SWT when it is run within environments
- * which can generate spurious events.
+ * native level on the calling thread should cause the messages
+ * described by the matching <code>Callback</code> objects to be
+ * invoked. This method is used to safely shut down SWT when it
+ * is run within environments which can generate spurious events.
+ * It does not affect the callbacks received by other threads, such
+ * as the user-interface thread of another display.
  * <p>
  * Note: This should not be called by application code.
  * </p>
@@ -199,18 +287,27 @@ public static final native synchronized void setEnabled (boolean enable);
 
 /**
  * Returns whether or not callbacks which are triggered at the
- * native level should cause the messages described by the matching
- * <code>Callback</code> objects to be invoked. This method is used
- * to safely shut down SWT when it is run within environments
- * which can generate spurious events.
+ * native level on the calling thread should cause the messages
+ * described by the matching <code>Callback</code> objects to be
+ * invoked. This method is used to safely shut down SWT when it
+ * is run within environments which can generate spurious events.
  * <p>
  * Note: This should not be called by application code.
  * </p>
  *
- * @return true if callbacks should not be invoked
+ * @return true if callbacks should be invoked
  */
 public static final native synchronized boolean getEnabled ();
 
+/**
+ * Indicates whether or not callbacks which are triggered at the
+ * native level on any thread should cause the messages described
+ * by the matching <code>Callback</code> objects to be invoked.
+ *
+ * @param enable true if callbacks should be invoked
+ */
+static final native synchronized void setGlobalEnabled (boolean enable);
+
 /**
  * This might be called directly from native code in environments
  * which can generate spurious events. Check before removing it.
@@ -221,12 +318,98 @@ public static final native synchronized boolean getEnabled ();
  */
 @Deprecated
 static final void ignoreCallbacks (boolean ignore) {
-	setEnabled (!ignore);
+	setGlobalEnabled (!ignore);
 } 
 
+/**
+ * Enables or disables the collection of call counts and latencies
+ * for every bound callback. Statistics collected before the collection
+ * was disabled are kept.
+ * <p>
+ * Note: This should not be called by application code.
+ * </p>
+ *
+ * @param enable true if statistics should be collected
+ */
+public static final native synchronized void setStatsEnabled (boolean enable);
+
+/**
+ * Returns the number of callback slots allocated at the native level.
+ * <p>
+ * Note: This should not be called by application code.
+ * </p>
+ *
+ * @return the number of slots
+ */
+public static final native synchronized int getSlotCount ();
+
+/**
+ * Returns the callback bound to the given slot and copies its call
+ * statistics into the given array. The array contains the call count
+ * at <code>STATS_COUNT</code>, the total and maximum time spent in
+ * Java, in nanoseconds, at <code>STATS_TOTAL_TIME</code> and
+ * <code>STATS_MAX_TIME</code>, followed by <code>STATS_BUCKETS</code>
+ * histogram counts starting at <code>STATS_HISTOGRAM</code>. Bucket
+ * <code>b</code> counts the calls that took <code>b</code> nanoseconds
+ * when <code>b &lt; 4</code>, and otherwise the calls that took from
+ * <code>(4 + b % 4) &lt;&lt; (b / 4 - 1)</code> nanoseconds up to the
+ * start of the next bucket.
+ * <p>
+ * Note: This should not be called by application code.
+ * </p>
+ *
+ * @param slot the slot index, between 0 and <code>getSlotCount()</code>
+ * @param stats the array to fill, or <code>null</code>
+ * @return the callback bound to the slot, or <code>null</code>
+ */
+public static final native synchronized Callback getStats (int slot, long[] stats);
+
+/**
+ * Returns <code>true</code> if the callback bound to the given slot
+ * holds its object weakly and the object has been garbage collected.
+ * Such a callback was not disposed when its object was released, and
+ * is only reachable from native code.
+ * <p>
+ * Note: This should not be called by application code.
+ * </p>
+ *
+ * @param slot the slot index, between 0 and <code>getSlotCount()</code>
+ * @return <code>true</code> if the object of the callback was collected and false otherwise
+ *
+ * @see #getCollected()
+ */
+public static final native synchronized boolean isCollected (int slot);
+
+/**
+ * Returns the callbacks that are still bound although their object
+ * was garbage collected, in slot order. The method name of each
+ * callback identifies where it was created.
+ * <p>
+ * Note: This should not be called by application code.
+ * </p>
+ *
+ * @return the leaked callbacks
+ *
+ * @see #isCollected(int)
+ */
+public static synchronized Callback [] getCollected () {
+	int count = getSlotCount (), length = 0;
+	Callback [] result = new Callback [count];
+	for (int i = 0; i < count; i++) {
+		if (isCollected (i)) {
+			Callback callback = getStats (i, null);
+			if (callback != null) result [length++] = callback;
+		}
+	}
+	Callback [] newResult = new Callback [length];
+	System.arraycopy (result, 0, newResult, 0, length);
+	return newResult;
+}
+
 /**
  * Immediately wipes out all native level state associated
- * with <em>all</em> callbacks.
+ * with <em>all</em> callbacks. The state of a callback that
+ * is running in another thread is released when it returns.
  * <p>
  * <b>WARNING:</b> This operation is <em>extremely</em> dangerous,
  * and should never be performed by application code.
@@ -234,6 +417,34 @@ static final void ignoreCallbacks (boolean ignore) {
  */
 public static final native synchronized void reset ();
 
+/**
+ * Registers the object that the callbacks which resolve their target
+ * receive when they are called with the given native handle as their
+ * first argument, or removes it when the object is <code>null</code>.
+ * The target is held strongly until it is removed. This must be called
+ * from the thread that triggers the callbacks.
+ * <p>
+ * Note: This should not be called by application code.
+ * </p>
+ *
+ * @param handle the native handle
+ * @param target the object to receive, or <code>null</code>
+ * @return <code>false</code> if the target could not be registered and true otherwise
+ */
+public static final native boolean setTarget (long /*int*/ handle, Object target);
+
+/**
+ * Returns the object registered for the given native handle with
+ * <code>setTarget()</code>, or <code>null</code> if there is none.
+ * <p>
+ * Note: This should not be called by application code.
+ * </p>
+ *
+ * @param handle the native handle
+ * @return the target or <code>null</code>
+ */
+public static final native Object getTarget (long /*int*/ handle);
+
 /**
  * Releases the native level resources associated with the callback.
  *
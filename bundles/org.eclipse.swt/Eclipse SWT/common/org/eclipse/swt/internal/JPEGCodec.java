@@ -0,0 +1,53 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.internal;
+
+/**
+ * Native JPEG decoding through the system libjpeg.
+ * <p>
+ * The natives return <code>false</code> when libjpeg reports an error,
+ * when the image is not grayscale, RGB or YCbCr, or when the arguments
+ * do not describe a region inside the arrays, so that callers can fall
+ * back to their Java implementation.  The scale must be 1, 2, 4 or 8.
+ * </p>
+ */
+public class JPEGCodec {
+
+	/**
+	 * <code>true</code> if the natives are available.
+	 */
+	public static final boolean LOADED;
+
+	static {
+		boolean loaded = false;
+		try {
+			Library.loadLibrary ("swt-jpeg"); //$NON-NLS-1$
+			loaded = true;
+		} catch (Throwable e) {}
+		LOADED = loaded;
+	}
+
+/**
+ * Reads the header of the image and stores the width and height of
+ * the image decoded at <code>1/scale</code> of its size, its bytes per
+ * pixel and <code>1</code> if it is progressive into the first four
+ * elements of <code>info</code>.
+ */
+public static final native boolean getInfo (byte[] data, int offset, int length, int scale, int[] info);
+
+/**
+ * Decodes the image at <code>1/scale</code> of its size into rows of
+ * <code>pixels</code> that are <code>stride</code> bytes apart.  Color
+ * pixels are stored as blue, green and red bytes and grayscale pixels
+ * as one byte.
+ */
+public static final native boolean decode (byte[] data, int offset, int length, int scale, byte[] pixels, int pixelsOffset, int stride);
+}
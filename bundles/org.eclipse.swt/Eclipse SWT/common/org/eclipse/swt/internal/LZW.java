@@ -0,0 +1,48 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.internal;
+
+/**
+ * Native LZW decoding for the GIF decoder.
+ * <p>
+ * The natives return <code>-1</code> without touching the pixels
+ * when their arguments do not describe a region inside the arrays, so
+ * that callers can fall back to their Java implementation.
+ * </p>
+ */
+public class LZW {
+
+	/**
+	 * <code>true</code> if the natives are available.
+	 */
+	public static final boolean LOADED;
+
+	static {
+		boolean loaded = false;
+		try {
+			Library.loadLibrary ("swt"); //$NON-NLS-1$
+			loaded = true;
+		} catch (Throwable e) {}
+		LOADED = loaded;
+	}
+
+/**
+ * Decodes the GIF data sub-blocks of <code>length</code> bytes that start
+ * at <code>offset</code> in <code>data</code>, each one preceded by its size,
+ * using the initial code size <code>bitsPerPixel</code>.  One byte is written
+ * per pixel, row <code>y</code> of the image starting at
+ * <code>pixelsOffset + y * stride</code> in <code>pixels</code>.  Interlaced
+ * images are written in the order of the four GIF passes.  Returns the number
+ * of pixels written, which is less than <code>width * height</code> when the
+ * data is truncated.
+ */
+public static final native int decode (byte[] data, int offset, int length, int bitsPerPixel, byte[] pixels, int pixelsOffset, int width, int height, int stride, boolean interlaced);
+}
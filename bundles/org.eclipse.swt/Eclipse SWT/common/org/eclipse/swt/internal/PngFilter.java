@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.internal;
+
+/**
+ * Native scanline filtering for the PNG encoder and unfiltering for
+ * the PNG decoder.
+ * <p>
+ * The natives return <code>false</code> without touching the data
+ * when their arguments do not describe a region inside the arrays, so
+ * that callers can fall back to their Java implementation.
+ * </p>
+ */
+public class PngFilter {
+
+	/**
+	 * <code>true</code> if the natives are available.
+	 */
+	public static final boolean LOADED;
+
+	static {
+		boolean loaded = false;
+		try {
+			Library.loadLibrary ("swt"); //$NON-NLS-1$
+			loaded = true;
+		} catch (Throwable e) {}
+		LOADED = loaded;
+	}
+
+/**
+ * Reverses the filter of each row in place.  Row <code>y</code> starts at
+ * <code>offset + y * stride</code>, is <code>rowBytes</code> long and
+ * was filtered with the method stored at <code>filtersOffset + y</code>
+ * in <code>filters</code>.  The row above the first row is taken to be
+ * zero.  Unknown filter methods leave their row unchanged.
+ */
+public static final native boolean unfilter (byte[] data, int offset, int stride, int rowBytes, int height, int bytesPerPixel, byte[] filters, int filtersOffset);
+
+/**
+ * Filters each row with the method that gives the smallest sum of its
+ * bytes taken as signed values.  Row <code>y</code> of the source starts
+ * at <code>offset + y * stride</code> and is <code>rowBytes</code> long.
+ * It is stored at <code>destOffset + y * (rowBytes + 1)</code>, preceded
+ * by the method that was chosen for it.
+ */
+public static final native boolean filter (byte[] data, int offset, int stride, int rowBytes, int height, int bytesPerPixel, byte[] dest, int destOffset);
+}
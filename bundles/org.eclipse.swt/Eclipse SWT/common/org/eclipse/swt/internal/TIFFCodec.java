@@ -0,0 +1,57 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.internal;
+
+/**
+ * Native strip decoding for the TIFF decoder.
+ * <p>
+ * The natives keep no state between calls, so the strips of an image
+ * can be decoded on several threads at once. They return <code>-1</code>
+ * when their arguments do not describe a region inside the arrays or
+ * the strip is invalid, so that callers can fall back to their Java
+ * implementation.
+ * </p>
+ */
+public class TIFFCodec {
+
+	/**
+	 * <code>true</code> if the natives are available.
+	 */
+	public static final boolean LOADED;
+
+	static {
+		boolean loaded = false;
+		try {
+			Library.loadLibrary ("swt"); //$NON-NLS-1$
+			loaded = true;
+		} catch (Throwable e) {}
+		LOADED = loaded;
+	}
+
+/**
+ * Decodes the PackBits strip of <code>srcLength</code> bytes that starts at
+ * <code>srcOffset</code> in <code>src</code> into at most <code>destLength</code>
+ * bytes starting at <code>destOffset</code> in <code>dest</code>.  Returns the
+ * number of bytes written.
+ */
+public static final native int decodePackBits (byte[] src, int srcOffset, int srcLength, byte[] dest, int destOffset, int destLength);
+
+/**
+ * Decodes <code>rows</code> rows of <code>width</code> pixels from the CCITT
+ * Group 3 1-Dimensional Modified Huffman strip of <code>srcLength</code> bytes
+ * that starts at <code>srcOffset</code> in <code>src</code>.  Each row is written
+ * at one bit per pixel, starting on a byte boundary, into at most
+ * <code>destLength</code> bytes starting at <code>destOffset</code> in
+ * <code>dest</code>.  Returns the number of bytes written, which is less than
+ * <code>rows</code> rows when the strip ends with an EOL code.
+ */
+public static final native int decodeModifiedHuffman (byte[] src, int srcOffset, int srcLength, byte[] dest, int destOffset, int destLength, int width, int rows);
+}
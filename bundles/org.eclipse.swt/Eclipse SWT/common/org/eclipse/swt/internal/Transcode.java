@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.internal;
+
+/**
+ * Native conversions between UTF-16 and UTF-8.
+ * <p>
+ * The conversions stop at the first NUL character and fail on malformed
+ * input, returning <code>-1</code> or <code>null</code>, the same way
+ * the glib conversions do.  A high surrogate at the very end of UTF-16
+ * input is not converted.  The conversions also fail when the ranges do
+ * not lie inside the arrays.
+ * </p>
+ */
+public class Transcode {
+
+	/**
+	 * <code>true</code> if the natives are available.
+	 */
+	public static final boolean LOADED;
+
+	static {
+		boolean loaded = false;
+		try {
+			Library.loadLibrary ("swt"); //$NON-NLS-1$
+			loaded = true;
+		} catch (Throwable e) {}
+		LOADED = loaded;
+	}
+
+/**
+ * Returns the number of bytes needed to convert the characters to UTF-8.
+ */
+public static final native int utf8Length (char[] chars, int offset, int length);
+
+/**
+ * Returns the number of characters needed to convert the UTF-8 bytes.
+ */
+public static final native int utf16Length (byte[] bytes, int offset, int length);
+
+/**
+ * Converts the characters to UTF-8 into the given range of bytes and
+ * returns the number of bytes written, or <code>-1</code> when the
+ * result does not fit, in which case nothing is written.
+ */
+public static final native int utf16ToUtf8 (char[] chars, int offset, int length, byte[] bytes, int bytesOffset, int bytesLength);
+
+/**
+ * Converts the UTF-8 bytes into the given range of characters and
+ * returns the number of characters written, or <code>-1</code> when
+ * the result does not fit, in which case nothing is written.
+ */
+public static final native int utf8ToUtf16 (byte[] bytes, int offset, int length, char[] chars, int charsOffset, int charsLength);
+
+/**
+ * Returns the characters converted to UTF-8, followed by a NUL byte when
+ * <code>terminate</code> is <code>true</code>.
+ */
+public static final native byte[] toUtf8 (char[] chars, int offset, int length, boolean terminate);
+
+/**
+ * Returns the UTF-8 bytes converted to characters.
+ */
+public static final native char[] toUtf16 (byte[] bytes, int offset, int length);
+}
@@ -0,0 +1,261 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.internal;
+
+import java.lang.reflect.Method;
+
+/**
+ * Detects stalls of the user-interface thread without a profiler.
+ * <p>
+ * A native thread samples whether the watched thread has entered or
+ * returned from a callback, gone idle or woken up within the threshold.
+ * When it has not, the thread is stalled and the watchdog reports the
+ * innermost callback it is in and, when the library was built with
+ * <code>NATIVE_STATS</code>, the innermost native. The stalls are
+ * reported to the listeners or, when there are none, printed to
+ * <code>System.err</code>.
+ * </p><p>
+ * The display starts the watchdog on its thread when the system property
+ * <code>org.eclipse.swt.internal.watchdog</code> is set to the threshold
+ * in milliseconds.
+ * </p>
+ */
+public class Watchdog {
+
+	/**
+	 * <code>true</code> if the natives are available.
+	 */
+	public static final boolean LOADED;
+
+	/**
+	 * The threshold in milliseconds from the system property, or
+	 * <code>0</code> if the watchdog is not enabled.
+	 */
+	public static final int THRESHOLD;
+
+	static Thread thread;
+	static volatile boolean running;
+	static volatile int generation;
+	static StallListener[] listeners = new StallListener[0];
+
+	static final String[] CLASSES = new String[]{"OS", "C", "ATK", "CDE", "GNOME", "GTK", "XPCOM", "COM", "AGL", "Gdip", "GLX", "Cairo", "WGL"};
+	static final int MAX_STALLS = 32;
+
+	static {
+		boolean loaded = false;
+		try {
+			Library.loadLibrary ("swt"); //$NON-NLS-1$
+			loaded = true;
+		} catch (Throwable e) {}
+		LOADED = loaded;
+		int threshold = 0;
+		try {
+			String value = System.getProperty ("org.eclipse.swt.internal.watchdog"); //$NON-NLS-1$
+			if (value != null) threshold = Math.max (0, Integer.parseInt (value));
+		} catch (Throwable e) {}
+		THRESHOLD = threshold;
+	}
+
+/**
+ * Receives the stalls of the watched thread, on the thread of the watchdog.
+ */
+public interface StallListener {
+	public void stalled (Stall stall);
+}
+
+/**
+ * A stall of the watched thread, or its end.
+ */
+public static class Stall {
+	/** <code>true</code> if the thread has made progress again */
+	public boolean ended;
+	/** The time the thread made no progress, in milliseconds */
+	public long duration;
+	/** The innermost callback, or <code>null</code> if the thread is in none */
+	public String callback;
+	/** The number of callbacks the thread is in */
+	public int depth;
+	/** The innermost native as "Class.function", or <code>null</code> if unknown */
+	public String function;
+	/** The number of natives of the library of <code>function</code> the thread is in */
+	public int nativeDepth;
+	/** The Java stack of the thread when the stall was detected, or <code>null</code> */
+	public StackTraceElement[] stack;
+
+	public String toString () {
+		StringBuffer buffer = new StringBuffer ();
+		if (ended) {
+			buffer.append ("UI thread stall ended after "); //$NON-NLS-1$
+			buffer.append (duration);
+			buffer.append (" ms"); //$NON-NLS-1$
+			return buffer.toString ();
+		}
+		buffer.append ("UI thread stalled for "); //$NON-NLS-1$
+		buffer.append (duration);
+		buffer.append (" ms"); //$NON-NLS-1$
+		if (function != null) {
+			buffer.append (" in native "); //$NON-NLS-1$
+			buffer.append (function);
+			buffer.append (" (depth "); //$NON-NLS-1$
+			buffer.append (nativeDepth);
+			buffer.append (")"); //$NON-NLS-1$
+		}
+		if (callback != null) {
+			buffer.append (" in callback "); //$NON-NLS-1$
+			buffer.append (callback);
+			buffer.append (" (depth "); //$NON-NLS-1$
+			buffer.append (depth);
+			buffer.append (")"); //$NON-NLS-1$
+		}
+		if (stack != null) {
+			for (int i = 0; i < stack.length; i++) {
+				buffer.append ("\n\tat "); //$NON-NLS-1$
+				buffer.append (stack [i]);
+			}
+		}
+		return buffer.toString ();
+	}
+}
+
+/**
+ * Starts watching the calling thread, reporting the times it makes no
+ * progress for <code>threshold</code> milliseconds.  Returns
+ * <code>false</code> if the natives are not available.
+ */
+public static synchronized boolean start (int threshold) {
+	if (!LOADED || threshold <= 0) return false;
+	if (!_start (threshold)) return false;
+	for (int i = 0; i < CLASSES.length; i++) {
+		try {
+			Method method = Watchdog.class.getDeclaredMethod (CLASSES [i] + "_Watch", new Class [0]); //$NON-NLS-1$
+			long sampler = ((Long) method.invoke (null, new Object [0])).longValue ();
+			_addSampler (sampler);
+		} catch (Throwable e) {
+			/* The library of the class is not loaded or was built without NATIVE_STATS */
+		}
+	}
+	thread = Thread.currentThread ();
+	running = true;
+	final int interval = Math.max (threshold / 2, 10), current = ++generation;
+	Thread reporter = new Thread ("SWT Watchdog") { //$NON-NLS-1$
+		public void run () {
+			report (interval, current);
+		}
+	};
+	reporter.setDaemon (true);
+	reporter.start ();
+	return true;
+}
+
+/**
+ * Stops watching.  Does nothing unless called from the watched thread.
+ */
+public static synchronized void stop () {
+	if (!running || Thread.currentThread () != thread) return;
+	running = false;
+	_stop ();
+}
+
+/**
+ * Tells the watchdog that the watched thread is going to sleep waiting for
+ * events, or has woken up.  A thread that sleeps is not stalled.
+ */
+public static void idle (boolean idle) {
+	if (!running || Thread.currentThread () != thread) return;
+	_setIdle (idle);
+}
+
+public static synchronized void addListener (StallListener listener) {
+	StallListener[] newListeners = new StallListener [listeners.length + 1];
+	System.arraycopy (listeners, 0, newListeners, 0, listeners.length);
+	newListeners [listeners.length] = listener;
+	listeners = newListeners;
+}
+
+public static synchronized void removeListener (StallListener listener) {
+	for (int i = 0; i < listeners.length; i++) {
+		if (listeners [i] == listener) {
+			StallListener[] newListeners = new StallListener [listeners.length - 1];
+			System.arraycopy (listeners, 0, newListeners, 0, i);
+			System.arraycopy (listeners, i + 1, newListeners, i, listeners.length - i - 1);
+			listeners = newListeners;
+			return;
+		}
+	}
+}
+
+static void report (int interval, int current) {
+	Thread watched = thread;
+	long[] values = new long [MAX_STALLS * 5];
+	String[] names = new String [MAX_STALLS * 2];
+	while (running && current == generation) {
+		try {
+			Thread.sleep (interval);
+		} catch (InterruptedException e) {}
+		int count = _getStalls (values, names);
+		for (int i = 0; i < count; i++) {
+			Stall stall = new Stall ();
+			stall.ended = values [i * 5] != 0;
+			stall.duration = values [i * 5 + 1] / 1000000;
+			int slot = (int) values [i * 5 + 2];
+			stall.depth = (int) values [i * 5 + 3];
+			stall.nativeDepth = (int) values [i * 5 + 4];
+			if (slot != -1) stall.callback = callbackName (slot);
+			if (names [i * 2 + 1] != null) stall.function = names [i * 2] + "." + names [i * 2 + 1]; //$NON-NLS-1$
+			if (!stall.ended) stall.stack = watched.getStackTrace ();
+			names [i * 2] = names [i * 2 + 1] = null;
+			StallListener[] listeners = Watchdog.listeners;
+			if (listeners.length == 0) {
+				System.err.println (stall);
+			} else {
+				for (int j = 0; j < listeners.length; j++) {
+					try {
+						listeners [j].stalled (stall);
+					} catch (Throwable e) {
+						e.printStackTrace ();
+					}
+				}
+			}
+		}
+	}
+}
+
+static String callbackName (int slot) {
+	Callback callback = Callback.getStats (slot, null);
+	if (callback == null) return "slot " + slot; //$NON-NLS-1$
+	Object object = callback.object;
+	/* A callback that holds its object weakly does not keep it */
+	if (object == null) return callback.method + " in slot " + slot; //$NON-NLS-1$
+	String className = object instanceof Class ? ((Class) object).getName () : object.getClass ().getName ();
+	return className + "." + callback.method; //$NON-NLS-1$
+}
+
+static final native boolean _start (int threshold);
+static final native void _stop ();
+static final native void _addSampler (long sampler);
+static final native void _setIdle (boolean idle);
+static final native int _getStalls (long[] values, String[] names);
+
+/* Answer the sampler of the natives of each class, in the libraries built with NATIVE_STATS */
+static final native long OS_Watch ();
+static final native long C_Watch ();
+static final native long ATK_Watch ();
+static final native long CDE_Watch ();
+static final native long GNOME_Watch ();
+static final native long GTK_Watch ();
+static final native long XPCOM_Watch ();
+static final native long COM_Watch ();
+static final native long AGL_Watch ();
+static final native long Gdip_Watch ();
+static final native long GLX_Watch ();
+static final native long Cairo_Watch ();
+static final native long WGL_Watch ();
+}
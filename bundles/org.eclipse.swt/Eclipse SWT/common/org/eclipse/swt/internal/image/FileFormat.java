@@ -25,11 +25,21 @@ public abstract class FileFormat {
 	static final String FORMAT_PACKAGE = "org.eclipse.swt.internal.image"; //$NON-NLS-1$
 	static final String FORMAT_SUFFIX = "FileFormat"; //$NON-NLS-1$
 	static final String[] FORMATS = {"WinBMP", "WinBMP", "GIF", "WinICO", "JPEG", "PNG", "TIFF", "OS2BMP"}; //$NON-NLS-1$//$NON-NLS-2$ //$NON-NLS-3$ //$NON-NLS-4$//$NON-NLS-5$ //$NON-NLS-6$//$NON-NLS-7$//$NON-NLS-8$
+
+	/**
+	 * Whether the decoders and encoders use the native codecs of the swt
+	 * library when it provides them. Setting the system property
+	 * <code>org.eclipse.swt.internal.image.javaCodecs</code> clears it, so
+	 * that only the Java implementation is used; the performance tests
+	 * clear it to compare both.
+	 */
+	public static boolean NATIVE_CODECS = System.getProperty("org.eclipse.swt.internal.image.javaCodecs") == null; //$NON-NLS-1$
 	
 	LEDataInputStream inputStream;
 	LEDataOutputStream outputStream;
 	ImageLoader loader;
 	int compression;
+	int scaleDenominator = 1;
 
 static FileFormat getFileFormat (LEDataInputStream stream, String format) throws Exception {
 	Class clazz = Class.forName(FORMAT_PACKAGE + '.' + format + FORMAT_SUFFIX);
@@ -65,12 +75,99 @@ public ImageData[] loadFromStream(LEDataInputStream stream) {
 }
 
 /**
- * Read the specified input stream using the specified loader, and
- * return the device independent image array represented by the stream.
+ * Read the first image of the specified input stream and send it to
+ * the listeners of the loader in bands of at most bandHeight rows.
  */	
-public static ImageData[] load(InputStream is, ImageLoader loader) {
+public void loadBandsFromStream(LEDataInputStream stream, int bandHeight) {
+	try {
+		inputStream = stream;
+		loadBandsFromByteStream(bandHeight);
+	} catch (Exception e) {
+		if (e instanceof IOException) {
+			SWT.error(SWT.ERROR_IO, e);
+		} else {
+			SWT.error(SWT.ERROR_INVALID_IMAGE, e);
+		}
+	}
+}
+
+/**
+ * Load the first image and send it to the listeners of the loader in
+ * bands of at most bandHeight rows.  Formats that can decode a band at
+ * a time override this; the default loads the whole image without
+ * sending the incremental events of the format and then splits it.
+ */
+void loadBandsFromByteStream(int bandHeight) throws IOException {
+	ImageLoader listenerLoader = loader;
+	loader = new ImageLoader();
+	ImageData[] images;
+	try {
+		images = loadFromByteStream();
+	} finally {
+		loader = listenerLoader;
+	}
+	if (images == null || images.length == 0) SWT.error(SWT.ERROR_INVALID_IMAGE);
+	fireBandEvents(images[0], bandHeight);
+}
+
+/**
+ * Split the specified image into bands of at most bandHeight rows
+ * and send them to the listeners of the loader.
+ */
+void fireBandEvents(ImageData image, int bandHeight) {
+	loader.logicalScreenWidth = image.width;
+	loader.logicalScreenHeight = image.height;
+	int maskBytesPerLine = 0;
+	if (image.maskData != null) {
+		maskBytesPerLine = (((image.width + 7) / 8) + (image.maskPad - 1)) / image.maskPad * image.maskPad;
+	}
+	for (int y = 0, count = 0; y < image.height; y += bandHeight, count++) {
+		int rows = Math.min(bandHeight, image.height - y);
+		byte[] data = new byte[image.bytesPerLine * rows];
+		System.arraycopy(image.data, y * image.bytesPerLine, data, 0, data.length);
+		byte[] maskData = null;
+		if (image.maskData != null) {
+			maskData = new byte[maskBytesPerLine * rows];
+			System.arraycopy(image.maskData, y * maskBytesPerLine, maskData, 0, maskData.length);
+		}
+		byte[] alphaData = null;
+		if (image.alphaData != null) {
+			alphaData = new byte[image.width * rows];
+			System.arraycopy(image.alphaData, y * image.width, alphaData, 0, alphaData.length);
+		}
+		ImageData band = ImageData.internal_new(
+			image.width,
+			rows,
+			image.depth,
+			image.palette,
+			image.scanlinePad,
+			data,
+			image.maskPad,
+			maskData,
+			alphaData,
+			image.alpha,
+			image.transparentPixel,
+			image.type,
+			0,
+			y,
+			0,
+			0);
+		fireBandEvent(band, count, y + rows == image.height);
+	}
+}
+
+/**
+ * Send a band of rows of the image being loaded to the listeners.
+ */
+void fireBandEvent(ImageData band, int count, boolean last) {
+	loader.notifyListeners(new ImageLoaderEvent(loader, band, count, last));
+}
+
+/**
+ * Return the file format of the specified input stream.
+ */	
+static FileFormat getFileFormat(LEDataInputStream stream) {
 	FileFormat fileFormat = null;
-	LEDataInputStream stream = new LEDataInputStream(is);
 	for (int i = 1; i < FORMATS.length; i++) {
 		if (FORMATS[i] != null) {
 			try {
@@ -83,10 +180,42 @@ public static ImageData[] load(InputStream is, ImageLoader loader) {
 		}
 	}
 	if (fileFormat == null) SWT.error(SWT.ERROR_UNSUPPORTED_FORMAT);
+	return fileFormat;
+}
+
+/**
+ * Read the specified input stream using the specified loader, and
+ * return the device independent image array represented by the stream.
+ */	
+public static ImageData[] load(InputStream is, ImageLoader loader) {
+	return load(is, loader, 1);
+}
+
+/**
+ * Read the specified input stream using the specified loader, reducing
+ * the images of the formats that support it by the scale denominator,
+ * and return the device independent image array represented by the stream.
+ */	
+public static ImageData[] load(InputStream is, ImageLoader loader, int scaleDenominator) {
+	LEDataInputStream stream = new LEDataInputStream(is);
+	FileFormat fileFormat = getFileFormat(stream);
 	fileFormat.loader = loader;
+	fileFormat.scaleDenominator = scaleDenominator;
 	return fileFormat.loadFromStream(stream);
 }
 
+/**
+ * Read the first image of the specified input stream using the
+ * specified loader, and send it to the listeners of the loader in
+ * bands of at most bandHeight rows.
+ */	
+public static void loadBands(InputStream is, ImageLoader loader, int bandHeight) {
+	LEDataInputStream stream = new LEDataInputStream(is);
+	FileFormat fileFormat = getFileFormat(stream);
+	fileFormat.loader = loader;
+	fileFormat.loadBandsFromStream(stream, bandHeight);
+}
+
 /**
  * Write the device independent image array stored in the specified loader
  * to the specified output stream using the specified file format.
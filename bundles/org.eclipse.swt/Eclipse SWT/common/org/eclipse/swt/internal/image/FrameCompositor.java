@@ -0,0 +1,283 @@
+/*******************************************************************************
+ * Copyright (c) 2014 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.internal.image;
+
+
+import org.eclipse.swt.*;
+import org.eclipse.swt.graphics.*;
+
+/**
+ * Instances of this class compose the frames of an animated image,
+ * such as the <code>ImageData</code> objects loaded from an animated
+ * GIF, onto a persistent canvas the size of the logical screen.
+ * <p>
+ * Each call to <code>compose</code> first disposes of the previous
+ * frame as its <code>disposalMethod</code> asks, then draws the new
+ * frame at its <code>x</code> and <code>y</code> position, and answers
+ * the part of the canvas that changed. Only that part needs to be
+ * redrawn on the screen, so frames that update a small area of the
+ * image cost no more than that area.
+ * </p><p>
+ * The canvas is a 24 bit direct image with alpha data. It starts out
+ * transparent, and <code>DM_FILL_BACKGROUND</code> makes the area of
+ * the frame transparent again unless a background color is set.
+ * </p>
+ * <p>
+ * Note: This is not API, it is used by the ImageAnalyzer example.
+ * </p>
+ *
+ * @see ImageData#disposalMethod
+ */
+public final class FrameCompositor {
+	ImageData canvas;
+	RGB background;
+	boolean reset;
+
+	/* The area and disposal method of the last frame, and what it covered */
+	Rectangle previousBounds;
+	int previousDisposal;
+	byte[] savedData, savedAlpha;
+
+/**
+ * Constructs a new compositor with a transparent canvas of the
+ * given size.
+ *
+ * @param width the width of the canvas, usually the <code>logicalScreenWidth</code> of an <code>ImageLoader</code>
+ * @param height the height of the canvas, usually the <code>logicalScreenHeight</code> of an <code>ImageLoader</code>
+ *
+ * @exception IllegalArgumentException <ul>
+ *    <li>ERROR_INVALID_ARGUMENT - if the width or height is not positive</li>
+ * </ul>
+ */
+public FrameCompositor(int width, int height) {
+	if (width <= 0 || height <= 0) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	canvas = new ImageData(width, height, 24, new PaletteData(0xFF0000, 0xFF00, 0xFF));
+	canvas.alphaData = new byte[width * height];
+	reset = true;
+}
+
+/**
+ * Disposes of the previous frame, draws the given frame onto the
+ * canvas and answers the bounds of the area of the canvas that
+ * changed. The first call after the compositor is constructed or
+ * reset answers the bounds of the whole canvas.
+ * <p>
+ * Pixels of the frame that are transparent leave the canvas unchanged,
+ * and pixels with an alpha value between 0 and 255 are blended with it.
+ * </p>
+ *
+ * @param frame the frame to draw
+ * @return the bounds of the area of the canvas that changed
+ *
+ * @exception IllegalArgumentException <ul>
+ *    <li>ERROR_NULL_ARGUMENT - if the frame is null</li>
+ * </ul>
+ */
+public Rectangle compose(ImageData frame) {
+	if (frame == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
+	Rectangle changed = null;
+	if (previousBounds != null) {
+		switch (previousDisposal) {
+			case SWT.DM_FILL_BACKGROUND: fill(previousBounds); changed = previousBounds; break;
+			case SWT.DM_FILL_PREVIOUS: restore(previousBounds); changed = previousBounds; break;
+		}
+	}
+	Rectangle bounds = new Rectangle(frame.x, frame.y, frame.width, frame.height).intersection(getBounds());
+	previousBounds = null;
+	savedData = savedAlpha = null;
+	if (!bounds.isEmpty()) {
+		if (frame.disposalMethod == SWT.DM_FILL_PREVIOUS) save(bounds);
+		draw(frame, bounds);
+		previousBounds = bounds;
+		previousDisposal = frame.disposalMethod;
+		changed = changed == null ? bounds : changed.union(bounds);
+	}
+	if (reset) {
+		reset = false;
+		changed = getBounds();
+	}
+	return changed != null ? changed : new Rectangle(0, 0, 0, 0);
+}
+
+/**
+ * Answers the bounds of the canvas.
+ *
+ * @return the bounds of the canvas
+ */
+public Rectangle getBounds() {
+	return new Rectangle(0, 0, canvas.width, canvas.height);
+}
+
+/**
+ * Answers the image data of the canvas.
+ * <p>
+ * The image data is the canvas itself, so it is updated by
+ * <code>compose</code> and must not be modified.
+ * </p>
+ *
+ * @return the image data of the canvas
+ */
+public ImageData getImageData() {
+	return canvas;
+}
+
+/**
+ * Answers a copy of the given area of the canvas, usually the bounds
+ * answered by <code>compose</code>, as a new image data at the position
+ * of the area.
+ *
+ * @param bounds the area of the canvas to copy
+ * @return a copy of the area of the canvas
+ *
+ * @exception IllegalArgumentException <ul>
+ *    <li>ERROR_NULL_ARGUMENT - if the bounds are null</li>
+ *    <li>ERROR_INVALID_ARGUMENT - if the bounds are empty or not inside the canvas</li>
+ * </ul>
+ */
+public ImageData getImageData(Rectangle bounds) {
+	if (bounds == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
+	if (bounds.isEmpty() || !getBounds().intersection(bounds).equals(bounds)) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	ImageData region = new ImageData(bounds.width, bounds.height, 24, new PaletteData(0xFF0000, 0xFF00, 0xFF));
+	region.alphaData = new byte[bounds.width * bounds.height];
+	region.x = bounds.x;
+	region.y = bounds.y;
+	for (int y = 0; y < bounds.height; y++) {
+		System.arraycopy(canvas.data, (bounds.y + y) * canvas.bytesPerLine + bounds.x * 3, region.data, y * region.bytesPerLine, bounds.width * 3);
+		System.arraycopy(canvas.alphaData, (bounds.y + y) * canvas.width + bounds.x, region.alphaData, y * bounds.width, bounds.width);
+	}
+	return region;
+}
+
+/**
+ * Makes the whole canvas transparent, or fills it with the background
+ * color when one is set, and forgets the previous frame, so that the
+ * next frame is drawn as the first one.
+ */
+public void reset() {
+	fill(getBounds());
+	previousBounds = null;
+	savedData = savedAlpha = null;
+	reset = true;
+}
+
+/**
+ * Sets the color that <code>DM_FILL_BACKGROUND</code> and <code>reset</code>
+ * fill the canvas with. The default is <code>null</code>, which makes the
+ * canvas transparent instead.
+ *
+ * @param background the background color, or <code>null</code>
+ */
+public void setBackground(RGB background) {
+	this.background = background;
+}
+
+void draw(ImageData frame, Rectangle bounds) {
+	byte[] data = canvas.data, alphaData = canvas.alphaData;
+	PaletteData palette = frame.palette;
+	byte[] reds = null, greens = null, blues = null;
+	if (!palette.isDirect) {
+		RGB[] rgbs = palette.colors;
+		int size = Math.max(1 << Math.min(frame.depth, 8), rgbs.length);
+		reds = new byte[size];
+		greens = new byte[size];
+		blues = new byte[size];
+		for (int i = 0; i < rgbs.length; i++) {
+			reds[i] = (byte)rgbs[i].red;
+			greens[i] = (byte)rgbs[i].green;
+			blues[i] = (byte)rgbs[i].blue;
+		}
+	}
+	ImageData mask = frame.maskData != null ? frame.getTransparencyMask() : null;
+	int transparentPixel = frame.transparentPixel, frameAlpha = frame.alpha;
+	int sx = bounds.x - frame.x, sy = bounds.y - frame.y;
+	int[] pixels = new int[bounds.width];
+	int[] maskPixels = mask != null ? new int[bounds.width] : null;
+	for (int y = 0; y < bounds.height; y++) {
+		frame.getPixels(sx, sy + y, bounds.width, pixels, 0);
+		if (mask != null) mask.getPixels(sx, sy + y, bounds.width, maskPixels, 0);
+		int dp = (bounds.y + y) * canvas.bytesPerLine + bounds.x * 3;
+		int ap = (bounds.y + y) * canvas.width + bounds.x;
+		int fp = (sy + y) * frame.width + sx;
+		for (int x = 0; x < bounds.width; x++, dp += 3, ap++, fp++) {
+			int pixel = pixels[x];
+			if (pixel == transparentPixel) continue;
+			if (mask != null && maskPixels[x] == 0) continue;
+			int alpha = frameAlpha != -1 ? frameAlpha : frame.alphaData != null ? frame.alphaData[fp] & 0xFF : 0xFF;
+			if (alpha == 0) continue;
+			int r, g, b;
+			if (reds != null) {
+				if (pixel >= reds.length) pixel = 0;
+				r = reds[pixel] & 0xFF;
+				g = greens[pixel] & 0xFF;
+				b = blues[pixel] & 0xFF;
+			} else {
+				r = pixel & palette.redMask;
+				r = (palette.redShift < 0) ? r >>> -palette.redShift : r << palette.redShift;
+				g = pixel & palette.greenMask;
+				g = (palette.greenShift < 0) ? g >>> -palette.greenShift : g << palette.greenShift;
+				b = pixel & palette.blueMask;
+				b = (palette.blueShift < 0) ? b >>> -palette.blueShift : b << palette.blueShift;
+			}
+			if (alpha != 0xFF) {
+				int dstAlpha = (alphaData[ap] & 0xFF) * (0xFF - alpha) / 0xFF;
+				int outAlpha = alpha + dstAlpha;
+				r = (r * alpha + (data[dp] & 0xFF) * dstAlpha) / outAlpha;
+				g = (g * alpha + (data[dp + 1] & 0xFF) * dstAlpha) / outAlpha;
+				b = (b * alpha + (data[dp + 2] & 0xFF) * dstAlpha) / outAlpha;
+				alpha = outAlpha;
+			}
+			data[dp] = (byte)r;
+			data[dp + 1] = (byte)g;
+			data[dp + 2] = (byte)b;
+			alphaData[ap] = (byte)alpha;
+		}
+	}
+}
+
+void fill(Rectangle bounds) {
+	byte[] data = canvas.data, alphaData = canvas.alphaData;
+	byte r = 0, g = 0, b = 0, alpha = 0;
+	if (background != null) {
+		r = (byte)background.red;
+		g = (byte)background.green;
+		b = (byte)background.blue;
+		alpha = (byte)0xFF;
+	}
+	for (int y = bounds.y; y < bounds.y + bounds.height; y++) {
+		int dp = y * canvas.bytesPerLine + bounds.x * 3;
+		for (int x = 0; x < bounds.width; x++, dp += 3) {
+			data[dp] = r;
+			data[dp + 1] = g;
+			data[dp + 2] = b;
+		}
+		int ap = y * canvas.width + bounds.x;
+		for (int x = 0; x < bounds.width; x++) {
+			alphaData[ap + x] = alpha;
+		}
+	}
+}
+
+void restore(Rectangle bounds) {
+	for (int y = 0; y < bounds.height; y++) {
+		System.arraycopy(savedData, y * bounds.width * 3, canvas.data, (bounds.y + y) * canvas.bytesPerLine + bounds.x * 3, bounds.width * 3);
+		System.arraycopy(savedAlpha, y * bounds.width, canvas.alphaData, (bounds.y + y) * canvas.width + bounds.x, bounds.width);
+	}
+}
+
+void save(Rectangle bounds) {
+	savedData = new byte[bounds.width * bounds.height * 3];
+	savedAlpha = new byte[bounds.width * bounds.height];
+	for (int y = 0; y < bounds.height; y++) {
+		System.arraycopy(canvas.data, (bounds.y + y) * canvas.bytesPerLine + bounds.x * 3, savedData, y * bounds.width * 3, bounds.width * 3);
+		System.arraycopy(canvas.alphaData, (bounds.y + y) * canvas.width + bounds.x, savedAlpha, y * bounds.width, bounds.width);
+	}
+}
+}
@@ -17,6 +17,7 @@ package org.eclipse.swt.internal.image;
 
 import org.eclipse.swt.*;
 import org.eclipse.swt.graphics.*;
+import org.eclipse.swt.internal.*;
 import java.io.*;
 
 public final class JPEGFileFormat extends FileFormat {
@@ -1383,11 +1384,72 @@ boolean isZeroInRow(int[] dataUnit, int rIndex) {
 			&& dataUnit[rIndex + 5] == 0 && dataUnit[rIndex + 6] == 0
 			&& dataUnit[rIndex + 7] == 0;
 }
+/**
+ * Decode the image with the native codec, which reduces it by the scale
+ * while decoding. Answer null if the codec rejects the image, or if the
+ * image is progressive and the loader reports each of its scans, so that
+ * the Java decoder is used instead.
+ */
+ImageData[] loadNative(byte[] bytes, int scale) {
+	int[] info = new int[4];
+	if (!JPEGCodec.getInfo(bytes, 0, bytes.length, scale, info)) return null;
+	if (info[3] != 0 && loader.hasListeners()) return null;
+	int width = info[0], height = info[1], bytesPerPixel = info[2];
+	PaletteData palette;
+	if (bytesPerPixel == 3) {
+		palette = new PaletteData(0xFF, 0xFF00, 0xFF0000);
+	} else {
+		RGB[] colors = new RGB[256];
+		for (int i = 0; i < colors.length; i++) {
+			colors[i] = new RGB(i, i, i);
+		}
+		palette = new PaletteData(colors);
+	}
+	int scanlinePad = 4;
+	int stride = (width * bytesPerPixel + (scanlinePad - 1)) / scanlinePad * scanlinePad;
+	byte[] data = new byte[stride * height];
+	if (!JPEGCodec.decode(bytes, 0, bytes.length, scale, data, 0, stride)) return null;
+	ImageData imageData = ImageData.internal_new(
+			width, height, bytesPerPixel * 8, palette, scanlinePad, data,
+			0, null, null, -1, -1, SWT.IMAGE_JPEG, 0, 0, 0, 0);
+	return new ImageData[]{imageData};
+}
+/**
+ * Read the rest of the stream into a byte array.
+ */
+static byte[] readAll(InputStream stream) throws IOException {
+	ByteArrayOutputStream out = new ByteArrayOutputStream();
+	byte[] buffer = new byte[8192];
+	int count;
+	while ((count = stream.read(buffer)) > 0) {
+		out.write(buffer, 0, count);
+	}
+	return out.toByteArray();
+}
 @Override
 ImageData[] loadFromByteStream() {
 	//TEMPORARY CODE
 	if (System.getProperty("org.eclipse.swt.internal.image.JPEGFileFormat_3.2") == null) {
-		return JPEGDecoder.loadFromByteStream(inputStream, loader);
+		int scale = scaleDenominator >= 8 ? 8 : scaleDenominator >= 4 ? 4 : scaleDenominator >= 2 ? 2 : 1;
+		InputStream stream = inputStream;
+		if (NATIVE_CODECS && JPEGCodec.LOADED) {
+			byte[] bytes;
+			try {
+				bytes = readAll(inputStream);
+			} catch (IOException e) {
+				SWT.error(SWT.ERROR_IO, e);
+				return null;
+			}
+			ImageData[] result = loadNative(bytes, scale);
+			if (result != null) return result;
+			stream = new ByteArrayInputStream(bytes);
+		}
+		ImageData[] result = JPEGDecoder.loadFromByteStream(stream, loader);
+		if (scale > 1) {
+			ImageData data = result[0];
+			result[0] = data.scaledTo((data.width + scale - 1) / scale, (data.height + scale - 1) / scale);
+		}
+		return result;
 	}
 	JPEGStartOfImage soi = new JPEGStartOfImage(inputStream);
 	if (!soi.verify()) SWT.error(SWT.ERROR_INVALID_IMAGE);
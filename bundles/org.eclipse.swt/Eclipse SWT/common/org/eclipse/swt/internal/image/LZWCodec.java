@@ -11,8 +11,10 @@
 package org.eclipse.swt.internal.image;
 
 
+import java.io.*;
 import org.eclipse.swt.*;
 import org.eclipse.swt.graphics.*;
+import org.eclipse.swt.internal.*;
 
 final class LZWCodec {
 	int bitsPerPixel, blockSize, blockIndex, currentByte, bitsLeft,
@@ -25,7 +27,7 @@ final class LZWCodec {
 	LEDataOutputStream outputStream;
 	ImageData image;
 	ImageLoader loader;
-	boolean interlaced;
+	boolean interlaced, truncated;
 	static final int[] MASK_TABLE = new int[] {
 		0x1, 0x3, 0x7, 0xF, 0x1F, 0x3F, 0x7F,
 		0xFF, 0x1FF, 0x3FF, 0x7FF, 0xFFF
@@ -111,9 +113,47 @@ public void decode(LEDataInputStream inputStream, ImageLoader loader, ImageData
 	this.image = image;
 	this.interlaced = interlaced;
 	this.bitsPerPixel = depth;
+	/*
+	* The native decoder is not used when listeners are interested in
+	* the passes of an interlaced image, since it writes all of them at
+	* once.  When it rejects the data, the data sub-blocks that were read
+	* into memory are decoded in Java instead.
+	*/
+	if (FileFormat.NATIVE_CODECS && LZW.LOADED && !(interlaced && loader.hasListeners())) {
+		int length = readBlocks();
+		byte[] data = block;
+		if (decodeNative(data, length)) return;
+		this.inputStream = new LEDataInputStream(new ByteArrayInputStream(data, 0, length));
+	}
 	initializeForDecoding();
 	decode();
 }
+/**
+ * Decode the data sub-blocks that were read into memory
+ * with the native decoder.  Answer false if the decoder
+ * rejected them.
+ */
+boolean decodeNative(byte[] data, int length) {
+	int width = image.width, height = image.height;
+	byte[] pixels;
+	int stride;
+	if (image.depth == 8) {
+		pixels = image.data;
+		stride = image.bytesPerLine;
+	} else {
+		pixels = new byte[width * height];
+		stride = width;
+	}
+	int count = LZW.decode(data, 0, length, bitsPerPixel, pixels, 0, width, height, stride, interlaced);
+	if (count == -1) return false;
+	if (truncated && count < width * height) SWT.error(SWT.ERROR_INVALID_IMAGE);
+	if (pixels != image.data) {
+		for (int y = 0; y < height; y++) {
+			image.setPixels(0, y, width, pixels, y * width);
+		}
+	}
+	return true;
+}
 /**
  * Encode the image.
  */
@@ -463,6 +503,42 @@ int readBlock() {
 	}
 	return size;
 }
+/**
+ * Read the data sub-blocks of the image, each preceded by its
+ * size, and the empty block that ends them into block.
+ * Answer the number of bytes read.
+ */
+int readBlocks() {
+	byte[] data = new byte[4096];
+	int length = 0;
+	try {
+		int size;
+		while ((size = inputStream.read()) > 0) {
+			if (length + size + 2 > data.length) {
+				byte[] newData = new byte[Math.max(data.length * 2, length + size + 2)];
+				System.arraycopy(data, 0, newData, 0, length);
+				data = newData;
+			}
+			data[length++] = (byte)size;
+			int read = inputStream.read(data, length, size);
+			if (read < size) {
+				if (read > 0) length += read;
+				truncated = true;
+				break;
+			}
+			length += size;
+		}
+		if (size == -1) {
+			truncated = true;
+		} else if (size == 0) {
+			data[length++] = 0;
+		}
+	} catch (IOException e) {
+		SWT.error(SWT.ERROR_IO, e);
+	}
+	block = data;
+	return length;
+}
 /**
  * Write a block to the byte stream.
  * Throw an exception if the block could not be written.
@@ -27,6 +27,7 @@ public final class PNGFileFormat extends FileFormat {
 	byte headerByte1;
 	byte headerByte2;
 	int adler;
+	int bandHeight;
 
 /**
  * Skip over signature data. This has already been
@@ -47,11 +48,20 @@ ImageData[] loadFromByteStream() {
 		headerChunk = chunkReader.getIhdrChunk();
 		int width = headerChunk.getWidth(), height = headerChunk.getHeight();
 		if (width <= 0 || height <= 0) SWT.error(SWT.ERROR_INVALID_IMAGE);
-		int imageSize = getAlignedBytesPerRow() * height;
+		/*
+		* When loading in bands, the rows of a non-interlaced image
+		* are sent to the listeners as they are decoded, so only one
+		* row is allocated to hold the palette and transparency.
+		*/
+		int imageHeight = height;
+		if (bandHeight > 0 && headerChunk.getInterlaceMethod() == PngIhdrChunk.INTERLACE_METHOD_NONE) {
+			imageHeight = 1;
+		}
+		int imageSize = getAlignedBytesPerRow() * imageHeight;
 		data = new byte[imageSize];		
 		imageData = ImageData.internal_new(
 			width,
-			height,
+			imageHeight,
 			headerChunk.getSwtBitsPerPixel(),
 			new PaletteData(0, 0, 0),
 			4,
@@ -82,6 +92,18 @@ ImageData[] loadFromByteStream() {
 		return null;
 	}
 }
+/**
+ * Load the PNG image from the byte stream in bands. Interlaced
+ * images are loaded completely and then split.
+ */
+@Override
+void loadBandsFromByteStream(int bandHeight) throws IOException {
+	this.bandHeight = bandHeight;
+	ImageData[] images = loadFromByteStream();
+	if (headerChunk.getInterlaceMethod() != PngIhdrChunk.INTERLACE_METHOD_NONE) {
+		fireBandEvents(images[0], bandHeight);
+	}
+}
 /**
  * Read and handle the next chunk of data from the 
  * PNG file.
@@ -315,7 +337,11 @@ void readPixelData(PngIdatChunk chunk, PngChunkReader chunkReader) throws IOExce
 	}
 	int interlaceMethod = headerChunk.getInterlaceMethod();
 	if (interlaceMethod == PngIhdrChunk.INTERLACE_METHOD_NONE) {
-		readNonInterlacedImage(stream);
+		if (bandHeight > 0) {
+			readNonInterlacedBands(stream);
+		} else {
+			readNonInterlacedImage(stream);
+		}
 	} else {
 		readInterlacedImage(stream);
 	}
@@ -454,7 +480,7 @@ void readInterlacedImage(InputStream inputStream) throws IOException {
  * loading, false if there are more frames to come.
  */
 void fireInterlacedFrameEvent(int frameCount) {
-	if (loader.hasListeners()) {
+	if (loader.hasListeners() && bandHeight == 0) {
 		ImageData image = (ImageData) imageData.clone();
 		boolean finalFrame = frameCount == 6;
 		loader.notifyListeners(new ImageLoaderEvent(loader, image, frameCount, finalFrame));
@@ -469,25 +495,91 @@ void readNonInterlacedImage(InputStream inputStream) throws IOException {
 	int dataOffset = 0;
 	int alignedBytesPerRow = getAlignedBytesPerRow();
 	int bytesPerRow = getBytesPerRow();
-	byte[] row1 = new byte[bytesPerRow];
-	byte[] row2 = new byte[bytesPerRow];
-	byte[] currentRow = row1;	
-	byte[] lastRow = row2;
 	int height = headerChunk.getHeight();
+	byte[] filterTypes = new byte[height];
 	for (int row = 0; row < height; row++) {
-		byte filterType = (byte)inputStream.read();
+		filterTypes[row] = (byte)inputStream.read();
 		int read = 0;
 		while (read != bytesPerRow) {
-			read += inputStream.read(currentRow, read, bytesPerRow - read);
+			read += inputStream.read(data, dataOffset + read, bytesPerRow - read);
 		}
-		filterRow(currentRow, lastRow, filterType);
-		System.arraycopy(currentRow, 0, data, dataOffset, bytesPerRow);
 		dataOffset += alignedBytesPerRow;
-		currentRow = (currentRow == row1) ? row2 : row1;
-		lastRow = (lastRow == row1) ? row2 : row1;
+	}
+	/*
+	* The rows are read into the image data first and then unfiltered
+	* in place, natively when possible.
+	*/
+	int byteOffset = headerChunk.getFilterByteOffset();
+	if (!NATIVE_CODECS || !PngFilter.LOADED || !PngFilter.unfilter(data, 0, alignedBytesPerRow, bytesPerRow, height, byteOffset, filterTypes, 0)) {
+		byte[] zeroRow = new byte[bytesPerRow];
+		for (int row = 0; row < height; row++) {
+			byte[] previousRow = row == 0 ? zeroRow : data;
+			int previousOffset = row == 0 ? 0 : (row - 1) * alignedBytesPerRow;
+			filterRow(data, row * alignedBytesPerRow, previousRow, previousOffset, bytesPerRow, filterTypes[row]);
+		}
 	}
 	setImageDataValues(data, imageData);
 }
+/**
+ * Read the pixel data for a non-interlaced image from the
+ * data stream a band of rows at a time, and send each band
+ * to the image loader's listeners.
+ */
+void readNonInterlacedBands(InputStream inputStream) throws IOException {
+	int width = headerChunk.getWidth();
+	int height = headerChunk.getHeight();
+	int alignedBytesPerRow = getAlignedBytesPerRow();
+	int bytesPerRow = getBytesPerRow();
+	int byteOffset = headerChunk.getFilterByteOffset();
+	loader.logicalScreenWidth = width;
+	loader.logicalScreenHeight = height;
+	/*
+	* The first row of the buffer holds the last row of the
+	* previous band, or zeros, so that each band is unfiltered
+	* against the row above it.
+	*/
+	byte[] rows = new byte[alignedBytesPerRow * (bandHeight + 1)];
+	byte[] filterTypes = new byte[bandHeight + 1];
+	for (int y = 0, count = 0; y < height; y += bandHeight, count++) {
+		int bandRows = Math.min(bandHeight, height - y);
+		int dataOffset = alignedBytesPerRow;
+		for (int row = 1; row <= bandRows; row++) {
+			filterTypes[row] = (byte)inputStream.read();
+			int read = 0;
+			while (read != bytesPerRow) {
+				read += inputStream.read(rows, dataOffset + read, bytesPerRow - read);
+			}
+			dataOffset += alignedBytesPerRow;
+		}
+		if (!NATIVE_CODECS || !PngFilter.LOADED || !PngFilter.unfilter(rows, 0, alignedBytesPerRow, bytesPerRow, bandRows + 1, byteOffset, filterTypes, 0)) {
+			for (int row = 1; row <= bandRows; row++) {
+				filterRow(rows, row * alignedBytesPerRow, rows, (row - 1) * alignedBytesPerRow, bytesPerRow, filterTypes[row]);
+			}
+		}
+		byte[] bandData = new byte[alignedBytesPerRow * bandRows];
+		System.arraycopy(rows, alignedBytesPerRow, bandData, 0, bandData.length);
+		System.arraycopy(rows, bandRows * alignedBytesPerRow, rows, 0, alignedBytesPerRow);
+		ImageData band = ImageData.internal_new(
+			width,
+			bandRows,
+			imageData.depth,
+			imageData.palette,
+			4,
+			null,
+			0,
+			null,
+			null,
+			-1,
+			imageData.transparentPixel,
+			SWT.IMAGE_PNG,
+			0,
+			y,
+			0,
+			0);
+		setImageDataValues(bandData, band);
+		fireBandEvent(band, count, y + bandRows == height);
+	}
+}
 /**
  * SWT does not support 16-bit depth color formats.
  * Convert the 16-bit data to 8-bit data.
@@ -534,37 +626,45 @@ static int compress16BitDepthTo8BitDepth(int value) {
  * based on the filterType.
  */
 void filterRow(byte[] row, byte[] previousRow, int filterType) {
+	filterRow(row, 0, previousRow, 0, row.length, filterType);
+}
+/**
+ * Unfilters the row of the given length that starts at rowOffset,
+ * using the row that starts at previousOffset in previousRow as
+ * the row above it.
+ */
+void filterRow(byte[] row, int rowOffset, byte[] previousRow, int previousOffset, int length, int filterType) {
 	int byteOffset = headerChunk.getFilterByteOffset();
 	switch (filterType) {
 		case PngIhdrChunk.FILTER_NONE:
 			break;
 		case PngIhdrChunk.FILTER_SUB:
-			for (int i = byteOffset; i < row.length; i++) {
-				int current = row[i] & 0xFF;
-				int left = row[i - byteOffset] & 0xFF;
-				row[i] = (byte)((current + left) & 0xFF);
+			for (int i = byteOffset; i < length; i++) {
+				int current = row[rowOffset + i] & 0xFF;
+				int left = row[rowOffset + i - byteOffset] & 0xFF;
+				row[rowOffset + i] = (byte)((current + left) & 0xFF);
 			}
 			break;
 		case PngIhdrChunk.FILTER_UP:
-			for (int i = 0; i < row.length; i++) {
-				int current = row[i] & 0xFF;
-				int above = previousRow[i] & 0xFF;				
-				row[i] = (byte)((current + above) & 0xFF);
+			for (int i = 0; i < length; i++) {
+				int current = row[rowOffset + i] & 0xFF;
+				int above = previousRow[previousOffset + i] & 0xFF;				
+				row[rowOffset + i] = (byte)((current + above) & 0xFF);
 			}
 			break;
 		case PngIhdrChunk.FILTER_AVERAGE:
-			for (int i = 0; i < row.length; i++) {
-				int left = (i < byteOffset) ? 0 : row[i - byteOffset] & 0xFF;
-				int above = previousRow[i] & 0xFF;
-				int current = row[i] & 0xFF;
-				row[i] = (byte)((current + ((left + above) / 2)) & 0xFF);
+			for (int i = 0; i < length; i++) {
+				int left = (i < byteOffset) ? 0 : row[rowOffset + i - byteOffset] & 0xFF;
+				int above = previousRow[previousOffset + i] & 0xFF;
+				int current = row[rowOffset + i] & 0xFF;
+				row[rowOffset + i] = (byte)((current + ((left + above) / 2)) & 0xFF);
 			}
 			break;
 		case PngIhdrChunk.FILTER_PAETH:
-			for (int i = 0; i < row.length; i++) {
-				int left = (i < byteOffset) ? 0 : row[i - byteOffset] & 0xFF;
-				int aboveLeft = (i < byteOffset) ? 0 : previousRow[i - byteOffset] & 0xFF;
-				int above = previousRow[i] & 0xFF;
+			for (int i = 0; i < length; i++) {
+				int left = (i < byteOffset) ? 0 : row[rowOffset + i - byteOffset] & 0xFF;
+				int aboveLeft = (i < byteOffset) ? 0 : previousRow[previousOffset + i - byteOffset] & 0xFF;
+				int above = previousRow[previousOffset + i] & 0xFF;
 				
 				int a = Math.abs(above - aboveLeft);
 				int b = Math.abs(left - aboveLeft);
@@ -579,8 +679,8 @@ void filterRow(byte[] row, byte[] previousRow, int filterType) {
 					preductor = aboveLeft;
 				}
 				
-				int currentValue = row[i] & 0xFF;
-				row[i] = (byte) ((currentValue + preductor) & 0xFF);
+				int currentValue = row[rowOffset + i] & 0xFF;
+				row[rowOffset + i] = (byte) ((currentValue + preductor) & 0xFF);
 			}
 			break;
 	}
@@ -12,13 +12,13 @@ package org.eclipse.swt.internal.image;
 
 import java.io.ByteArrayOutputStream;
 import java.io.IOException;
-import java.io.OutputStream;
 
 import org.eclipse.swt.SWT;
 import org.eclipse.swt.graphics.ImageData;
 import org.eclipse.swt.graphics.ImageLoader;
 import org.eclipse.swt.graphics.RGB;
 import org.eclipse.swt.internal.Compatibility;
+import org.eclipse.swt.internal.PngFilter;
 
 final class PngEncoder extends Object {
 
@@ -236,36 +236,32 @@ void writeTransparency() {
 
 void writeImageData() throws IOException {
 
-	ByteArrayOutputStream baos = new ByteArrayOutputStream(1024);
-	OutputStream os = null;
+	int level;
 	switch (loader.compression) {
 	case 0:
-		os = Compatibility.newDeflaterOutputStream(baos, NO_COMPRESSION);
+		level = NO_COMPRESSION;
 		break;
 	case 1:
-		os = Compatibility.newDeflaterOutputStream(baos, BEST_SPEED);
+		level = BEST_SPEED;
 		break;
 	case 3:
-		os = Compatibility.newDeflaterOutputStream(baos, BEST_COMPRESSION);
+		level = BEST_COMPRESSION;
 		break;
 	default:
-		os = Compatibility.newDeflaterOutputStream(baos, DEFAULT_COMPRESSION);
+		level = DEFAULT_COMPRESSION;
 		break;
 	}
-	if (os == null) os = baos; // returns null for J2ME
+	
+	byte[] filtered;
 	
 	if (colorType == 3) {
 	
-		byte[] lineData = new byte[width];
+		/* Palette images compress best without filters */
+		filtered = new byte[(width + 1) * height];
 		
 		for (int y = 0; y < height; y++) {
 			
-			int filter = 0;
-			os.write(filter);
-			
-			data.getPixels(0, y, width, lineData, 0);
-			
-			os.write(lineData);
+			data.getPixels(0, y, width, filtered, y * (width + 1) + 1);
 		
 		}
 	
@@ -286,60 +282,126 @@ void writeImageData() throws IOException {
 		int blueShift = data.palette.blueShift;
 		int blueMask = data.palette.blueMask;
 		
-		byte[] lineBytes = new byte[width * (colorType == 6 ? 4 : 3)];
+		int bytesPerPixel = colorType == 6 ? 4 : 3;
+		int bytesPerRow = width * bytesPerPixel;
+		byte[] pixels = new byte[bytesPerRow * height];
 		
+		int offset = 0;
 		for (int y = 0; y < height; y++) {
 		
-			int filter = 0;
-			os.write(filter);
-			
 			data.getPixels(0, y, width, lineData, 0);
 			
 			if (colorType == 6) {
 				data.getAlphas(0, y, width, alphaData, 0);
 			}
 			
-			int offset = 0;
 			for (int x = 0; x < lineData.length; x++) {
 			
 				int pixel = lineData[x];
 				
 				int r = pixel & redMask;
-				lineBytes[offset++] = (byte) ((redShift < 0) ? r >>> -redShift
+				pixels[offset++] = (byte) ((redShift < 0) ? r >>> -redShift
 						: r << redShift);
 				int g = pixel & greenMask;
-				lineBytes[offset++] = (byte) ((greenShift < 0) ? g >>> -greenShift
+				pixels[offset++] = (byte) ((greenShift < 0) ? g >>> -greenShift
 						: g << greenShift);
 				int b = pixel & blueMask;
-				lineBytes[offset++] = (byte) ((blueShift < 0) ? b >>> -blueShift
+				pixels[offset++] = (byte) ((blueShift < 0) ? b >>> -blueShift
 						: b << blueShift);
 				
 				if (colorType == 6) {
-					lineBytes[offset++] = alphaData[x];
+					pixels[offset++] = alphaData[x];
 				}
 			
 			}
 			
-			os.write(lineBytes);
-			
+		}
+		
+		filtered = new byte[(bytesPerRow + 1) * height];
+		if (!FileFormat.NATIVE_CODECS || !PngFilter.LOADED || !PngFilter.filter(pixels, 0, bytesPerRow, bytesPerRow, height, bytesPerPixel, filtered, 0)) {
+			filterRows(pixels, bytesPerRow, bytesPerPixel, filtered);
 		}
 	
 	}
 	
-	os.flush();
-	os.close();
-	
-	byte[] compressed = baos.toByteArray();
-	if (os == baos) {
+	byte[] compressed = Compatibility.deflate(filtered, level);
+	if (compressed == null) {
 		/* Use PngDeflater for J2ME. */
 		PngDeflater deflater = new PngDeflater();
-		compressed = deflater.deflate(compressed);
+		compressed = deflater.deflate(filtered);
 	}
 	
 	writeChunk(TAG_IDAT, compressed);
 
 }
 
+/*
+ * Filters each row with the method that gives the smallest sum of its bytes
+ * taken as signed values, the same way as PngFilter.filter.
+ */
+void filterRows(byte[] pixels, int bytesPerRow, int bytesPerPixel, byte[] filtered) {
+
+	byte[] zeroRow = new byte[bytesPerRow];
+	byte[] best = new byte[bytesPerRow];
+	byte[] candidate = new byte[bytesPerRow];
+	
+	for (int y = 0; y < height; y++) {
+	
+		byte[] previous = y == 0 ? zeroRow : pixels;
+		int rowOffset = y * bytesPerRow, previousOffset = y == 0 ? 0 : rowOffset - bytesPerRow;
+		int bestType = PngIhdrChunk.FILTER_NONE;
+		long bestCost = Long.MAX_VALUE;
+		
+		for (int type = PngIhdrChunk.FILTER_NONE; type <= PngIhdrChunk.FILTER_PAETH; type++) {
+		
+			long cost = 0;
+			for (int i = 0; i < bytesPerRow; i++) {
+			
+				int current = pixels[rowOffset + i] & 0xFF;
+				int left = i < bytesPerPixel ? 0 : pixels[rowOffset + i - bytesPerPixel] & 0xFF;
+				int above = previous[previousOffset + i] & 0xFF;
+				int aboveLeft = i < bytesPerPixel ? 0 : previous[previousOffset + i - bytesPerPixel] & 0xFF;
+				int predictor = 0;
+				switch (type) {
+				case PngIhdrChunk.FILTER_SUB:
+					predictor = left;
+					break;
+				case PngIhdrChunk.FILTER_UP:
+					predictor = above;
+					break;
+				case PngIhdrChunk.FILTER_AVERAGE:
+					predictor = (left + above) / 2;
+					break;
+				case PngIhdrChunk.FILTER_PAETH:
+					int a = Math.abs(above - aboveLeft);
+					int b = Math.abs(left - aboveLeft);
+					int c = Math.abs(left + above - 2 * aboveLeft);
+					predictor = (a <= b && a <= c) ? left : (b <= c) ? above : aboveLeft;
+					break;
+				}
+				int value = (current - predictor) & 0xFF;
+				candidate[i] = (byte) value;
+				cost += value < 128 ? value : 256 - value;
+			
+			}
+			
+			if (cost < bestCost) {
+				byte[] swap = best;
+				best = candidate;
+				candidate = swap;
+				bestCost = cost;
+				bestType = type;
+			}
+		
+		}
+		
+		filtered[y * (bytesPerRow + 1)] = (byte) bestType;
+		System.arraycopy(best, 0, filtered, y * (bytesPerRow + 1) + 1, bytesPerRow);
+	
+	}
+
+}
+
 void writeEnd() {
 
 	writeChunk(TAG_IEND, null);
@@ -13,6 +13,7 @@ package org.eclipse.swt.internal.image;
 
 import org.eclipse.swt.*;
 import org.eclipse.swt.graphics.*;
+import org.eclipse.swt.internal.*;
 import java.io.*;
 
 final class TIFFDirectory {
@@ -85,6 +86,9 @@ final class TIFFDirectory {
 	
 	static final int IFD_ENTRY_SIZE = 12;
 	
+	/* Smallest decoded image whose strips are decoded on several threads */
+	static final int PARALLEL_DECODE_SIZE = 1 << 18;
+	
 public TIFFDirectory(TIFFRandomFileAccess file, boolean isLittleEndian, ImageLoader loader) {
 	this.file = file;
 	this.isLittleEndian = isLittleEndian;
@@ -151,35 +155,92 @@ void getEntryValue(int type, byte[] buffer, int index, int[] values) throws IOEx
 
 void decodePixels(ImageData image) throws IOException {
 	/* Each row is byte aligned */ 
-	byte[] imageData = new byte[(imageWidth * depth + 7) / 8 * imageLength];
+	int rowBytes = (imageWidth * depth + 7) / 8;
+	final byte[] imageData = new byte[rowBytes * imageLength];
 	image.data = imageData;
-	int destIndex = 0;
-	int length = stripOffsets.length;
+	final int length = stripOffsets.length;
+	/* The file is read by one thread, so all of the strips are read first */
+	final byte[][] strips = new byte[length][];
+	final int[] destOffsets = new int[length];
 	for (int i = 0; i < length; i++) {
-		/* Read a strip */
-		byte[] data = new byte[stripByteCounts[i]];
+		strips[i] = new byte[stripByteCounts[i]];
 		file.seek(stripOffsets[i]);
-		file.read(data);
-		if (compression == COMPRESSION_NONE) {
-			System.arraycopy(data, 0, imageData, destIndex, data.length);
-			destIndex += data.length;
-		} else if (compression == COMPRESSION_PACKBITS) {
-			destIndex += decodePackBits(data, imageData, destIndex);
-		} else if (compression == COMPRESSION_CCITT_3_1 || compression == 3) {
-			TIFFModifiedHuffmanCodec codec = new TIFFModifiedHuffmanCodec();
-			int nRows = rowsPerStrip;
-			if (i == length -1) {
-				int n = imageLength % rowsPerStrip;
-				if (n != 0) nRows = n;
+		file.read(strips[i]);
+		destOffsets[i] = (int)Math.min((long)i * rowsPerStrip, imageLength) * rowBytes;
+	}
+	/*
+	* Strips are independent, so compressed strips of large images are
+	* decoded on several threads when no listener needs them in order.
+	*/
+	int threadCount = Math.min(length, Compatibility.availableProcessors());
+	if (compression != COMPRESSION_NONE && threadCount > 1 && imageData.length >= PARALLEL_DECODE_SIZE && !loader.hasListeners()) {
+		final Throwable[] error = new Throwable[1];
+		Thread[] threads = new Thread[threadCount];
+		for (int i = 0; i < threadCount; i++) {
+			final int first = i, step = threadCount;
+			threads[i] = new Thread("SWT TIFF Decoder") { //$NON-NLS-1$
+				public void run() {
+					try {
+						for (int strip = first; strip < length && error[0] == null; strip += step) {
+							decodeStrip(strip, strips[strip], imageData, destOffsets[strip]);
+							strips[strip] = null;
+						}
+					} catch (Throwable e) {
+						error[0] = e;
+					}
+				}
+			};
+		}
+		/* The calling thread decodes the first share of the strips itself */
+		for (int i = 1; i < threadCount; i++) {
+			threads[i].start();
+		}
+		threads[0].run();
+		for (int i = 1; i < threadCount; i++) {
+			try {
+				threads[i].join();
+			} catch (InterruptedException e) {
+				if (error[0] == null) error[0] = e;
+				Compatibility.interrupt();
 			}
-			destIndex += codec.decode(data, imageData, destIndex, imageWidth, nRows);
 		}
+		if (error[0] != null) SWT.error(SWT.ERROR_INVALID_IMAGE, error[0]);
+		return;
+	}
+	for (int i = 0; i < length; i++) {
+		decodeStrip(i, strips[i], imageData, destOffsets[i]);
+		strips[i] = null;
 		if (loader.hasListeners()) {
 			loader.notifyListeners(new ImageLoaderEvent(loader, image, i, i == length - 1));
 		}
 	}
 }
 
+/*
+* Decodes the given strip into the image data at destIndex. It only
+* writes to the rows of the strip, so strips can be decoded at once.
+*/
+void decodeStrip(int i, byte[] data, byte[] imageData, int destIndex) {
+	int destLength = imageData.length - destIndex;
+	if (compression == COMPRESSION_NONE) {
+		System.arraycopy(data, 0, imageData, destIndex, Math.min(data.length, destLength));
+	} else if (compression == COMPRESSION_PACKBITS) {
+		if (!FileFormat.NATIVE_CODECS || !TIFFCodec.LOADED || TIFFCodec.decodePackBits(data, 0, data.length, imageData, destIndex, destLength) == -1) {
+			decodePackBits(data, imageData, destIndex);
+		}
+	} else if (compression == COMPRESSION_CCITT_3_1 || compression == 3) {
+		int nRows = rowsPerStrip;
+		if (i == stripOffsets.length - 1) {
+			int n = imageLength % rowsPerStrip;
+			if (n != 0) nRows = n;
+		}
+		if (!FileFormat.NATIVE_CODECS || !TIFFCodec.LOADED || TIFFCodec.decodeModifiedHuffman(data, 0, data.length, imageData, destIndex, destLength, imageWidth, nRows) == -1) {
+			TIFFModifiedHuffmanCodec codec = new TIFFModifiedHuffmanCodec();
+			codec.decode(data, imageData, destIndex, imageWidth, nRows);
+		}
+	}
+}
+
 PaletteData getColorMap() throws IOException {
 	int numColors = 1 << bitsPerSample[0];
 	/* R, G, B entries are 16 bit wide (2 bytes) */
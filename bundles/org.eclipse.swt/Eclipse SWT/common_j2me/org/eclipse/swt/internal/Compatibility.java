@@ -203,6 +203,17 @@ public static OutputStream newDeflaterOutputStream(OutputStream stream, int leve
 	return null;
 }
 
+/**
+ * Compress the data into a zlib stream if such things are supported.
+ * 
+ * @param data the data to compress
+ * @param level the compression level
+ * @return the compressed data or <code>null</code>
+ */
+public static byte[] deflate(byte[] data, int level) {
+	return null;
+}
+
 /**
  * Open a file if such things are supported.
  * 
@@ -431,6 +442,18 @@ public static String getMessage(String key, Object[] args) {
 	return key;
 }
 
+/**
+ * Answers the number of processors available to the virtual machine.
+ * <p>
+ * Note that this is not available on CLDC, which answers 1.
+ * </p>
+ *
+ * @return the number of available processors
+ */
+public static int availableProcessors() {
+	return 1;
+}
+
 /**
  * Interrupt the current thread. 
  * <p>
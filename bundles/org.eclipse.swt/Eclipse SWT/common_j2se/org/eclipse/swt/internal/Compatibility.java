@@ -15,6 +15,7 @@ import java.io.*;
 import java.text.MessageFormat;
 import java.util.MissingResourceException;
 import java.util.ResourceBundle;
+import java.util.zip.Adler32;
 import java.util.zip.Deflater;
 import java.util.zip.InflaterInputStream;
 import java.util.zip.DeflaterOutputStream;
@@ -172,6 +173,129 @@ public static OutputStream newDeflaterOutputStream(OutputStream stream, int leve
 	return new DeflaterOutputStream(stream, new Deflater(level));
 }
 
+static final int DEFLATE_BLOCK_SIZE = 1 << 17;
+static final int DEFLATE_WINDOW_SIZE = 1 << 15;
+
+/**
+ * Compress the data into a zlib stream if such things are supported.
+ * <p>
+ * Data that spans several blocks is compressed on several threads.
+ * Each block is primed with the window that precedes it and all but
+ * the last one end with a sync flush, so that the blocks join into a
+ * single stream that compresses almost as well as a serial one.
+ * </p>
+ * 
+ * @param data the data to compress
+ * @param level the compression level
+ * @return the compressed data or <code>null</code>
+ */
+public static byte[] deflate(byte[] data, int level) {
+	int blockCount = (data.length + DEFLATE_BLOCK_SIZE - 1) / DEFLATE_BLOCK_SIZE;
+	int threadCount = Math.min(blockCount, Runtime.getRuntime().availableProcessors());
+	if (threadCount > 1) {
+		byte[] result = deflateBlocks(data, level, blockCount, threadCount);
+		if (result != null) return result;
+	}
+	Deflater deflater = new Deflater(level);
+	try {
+		deflater.setInput(data);
+		deflater.finish();
+		ByteArrayOutputStream out = new ByteArrayOutputStream(data.length / 4 + 64);
+		byte[] buffer = new byte[DEFLATE_BLOCK_SIZE];
+		while (!deflater.finished()) {
+			out.write(buffer, 0, deflater.deflate(buffer));
+		}
+		return out.toByteArray();
+	} finally {
+		deflater.end();
+	}
+}
+
+static byte[] deflateBlocks(final byte[] data, final int level, final int blockCount, final int threadCount) {
+	final byte[][] blocks = new byte[blockCount][];
+	final boolean[] failed = new boolean[1];
+	Thread[] threads = new Thread[threadCount];
+	for (int i = 0; i < threadCount; i++) {
+		final int first = i;
+		threads[i] = new Thread("SWT Deflater") { //$NON-NLS-1$
+			public void run() {
+				try {
+					for (int block = first; block < blockCount && !failed[0]; block += threadCount) {
+						blocks[block] = deflateBlock(data, level, block, block == blockCount - 1);
+					}
+				} catch (Throwable e) {
+					/* Deflater.SYNC_FLUSH needs Java 7, fall back to a serial stream */
+					failed[0] = true;
+				}
+			}
+		};
+	}
+	/* The calling thread compresses the first share of the blocks itself */
+	for (int i = 1; i < threadCount; i++) {
+		threads[i].start();
+	}
+	threads[0].run();
+	for (int i = 1; i < threadCount; i++) {
+		try {
+			threads[i].join();
+		} catch (InterruptedException e) {
+			failed[0] = true;
+			Thread.currentThread().interrupt();
+		}
+	}
+	if (failed[0]) return null;
+	int length = 0;
+	for (int i = 0; i < blockCount; i++) {
+		length += blocks[i].length;
+	}
+	byte[] result = new byte[2 + length + 4];
+	result[0] = 0x78;
+	result[1] = (byte)0x9C;
+	int offset = 2;
+	for (int i = 0; i < blockCount; i++) {
+		System.arraycopy(blocks[i], 0, result, offset, blocks[i].length);
+		offset += blocks[i].length;
+	}
+	Adler32 adler = new Adler32();
+	adler.update(data, 0, data.length);
+	int checksum = (int)adler.getValue();
+	result[offset++] = (byte)(checksum >> 24);
+	result[offset++] = (byte)(checksum >> 16);
+	result[offset++] = (byte)(checksum >> 8);
+	result[offset] = (byte)checksum;
+	return result;
+}
+
+static byte[] deflateBlock(byte[] data, int level, int block, boolean last) {
+	int start = block * DEFLATE_BLOCK_SIZE;
+	int length = Math.min(DEFLATE_BLOCK_SIZE, data.length - start);
+	Deflater deflater = new Deflater(level, true);
+	try {
+		if (start > 0) {
+			int window = Math.min(start, DEFLATE_WINDOW_SIZE);
+			deflater.setDictionary(data, start - window, window);
+		}
+		deflater.setInput(data, start, length);
+		ByteArrayOutputStream out = new ByteArrayOutputStream(length / 4 + 64);
+		byte[] buffer = new byte[DEFLATE_BLOCK_SIZE];
+		if (last) {
+			deflater.finish();
+			while (!deflater.finished()) {
+				out.write(buffer, 0, deflater.deflate(buffer));
+			}
+		} else {
+			int count;
+			do {
+				count = deflater.deflate(buffer, 0, buffer.length, Deflater.SYNC_FLUSH);
+				out.write(buffer, 0, count);
+			} while (count == buffer.length);
+		}
+		return out.toByteArray();
+	} finally {
+		deflater.end();
+	}
+}
+
 /**
  * Open a file if such things are supported.
  * 
@@ -364,6 +488,18 @@ public static String getMessage(String key, Object[] args) {
 	return answer;
 }
 
+/**
+ * Answers the number of processors available to the virtual machine.
+ * <p>
+ * Note that this is not available on CLDC, which answers 1.
+ * </p>
+ *
+ * @return the number of available processors
+ */
+public static int availableProcessors() {
+	return Runtime.getRuntime().availableProcessors();
+}
+
 /**
  * Interrupt the current thread. 
  * <p>
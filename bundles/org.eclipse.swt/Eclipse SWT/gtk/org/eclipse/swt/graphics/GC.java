@@ -266,7 +266,7 @@ void checkGC (int mask) {
 					Cairo.cairo_set_source(cairo, pattern.handle);
 				}
 			} else {
-				Cairo.cairo_set_source_rgba(cairo, (color.red & 0xFFFF) / (float)0xFFFF, (color.green & 0xFFFF) / (float)0xFFFF, (color.blue & 0xFFFF) / (float)0xFFFF, data.alpha / (float)0xFF);
+				Cairo.swt_cairo_set_source_rgba(cairo, (color.red & 0xFFFF) / (float)0xFFFF, (color.green & 0xFFFF) / (float)0xFFFF, (color.blue & 0xFFFF) / (float)0xFFFF, data.alpha / (float)0xFF);
 			}
 		}
 		if ((state & FONT) != 0) {
@@ -294,7 +294,7 @@ void checkGC (int mask) {
 			Cairo.cairo_set_line_join(cairo, join_style);
 		}
 		if ((state & LINE_WIDTH) != 0) {
-			Cairo.cairo_set_line_width(cairo, data.lineWidth == 0 ? 1 : data.lineWidth);
+			Cairo.swt_cairo_set_line_width(cairo, data.lineWidth == 0 ? 1 : data.lineWidth);
 			switch (data.lineStyle) {
 				case SWT.LINE_DOT:
 				case SWT.LINE_DASH:
@@ -418,31 +418,28 @@ long /*int*/ convertRgn(long /*int*/ rgn, double[] matrix) {
 		OS.gdk_region_union(newRgn, rgn);
 		return newRgn;
 	}
-	int[] nRects = new int[1];
-	long /*int*/[] rects = new long /*int*/[1];
-	Region.gdk_region_get_rectangles(rgn, rects, nRects);
-	GdkRectangle rect = new GdkRectangle();
+	int[] rects = Region.getRectangles(rgn);
 	int[] pointArray = new int[8];
 	double[] x = new double[1], y = new double[1];
-	for (int i=0; i<nRects[0]; i++) {
-		OS.memmove(rect, rects[0] + (i * GdkRectangle.sizeof), GdkRectangle.sizeof);
-		x[0] = rect.x;
-		y[0] = rect.y;
+	for (int i=0; i<rects.length; i+=4) {
+		int rectX = rects[i], rectY = rects[i+1], rectWidth = rects[i+2], rectHeight = rects[i+3];
+		x[0] = rectX;
+		y[0] = rectY;
 		Cairo.cairo_matrix_transform_point(matrix, x, y);
 		pointArray[0] = (int)x[0];
 		pointArray[1] = (int)y[0];
-		x[0] = rect.x + rect.width;
-		y[0] = rect.y;
+		x[0] = rectX + rectWidth;
+		y[0] = rectY;
 		Cairo.cairo_matrix_transform_point(matrix, x, y);
 		pointArray[2] = (int)Math.round(x[0]);
 		pointArray[3] = (int)y[0];
-		x[0] = rect.x + rect.width;
-		y[0] = rect.y + rect.height;
+		x[0] = rectX + rectWidth;
+		y[0] = rectY + rectHeight;
 		Cairo.cairo_matrix_transform_point(matrix, x, y);
 		pointArray[4] = (int)Math.round(x[0]);
 		pointArray[5] = (int)Math.round(y[0]);
-		x[0] = rect.x;
-		y[0] = rect.y + rect.height;
+		x[0] = rectX;
+		y[0] = rectY + rectHeight;
 		Cairo.cairo_matrix_transform_point(matrix, x, y);
 		pointArray[6] = (int)x[0];
 		pointArray[7] = (int)Math.round(y[0]);
@@ -450,7 +447,6 @@ long /*int*/ convertRgn(long /*int*/ rgn, double[] matrix) {
 		OS.gdk_region_union(newRgn, polyRgn);
 		OS.gdk_region_destroy(polyRgn);
 	}
-	if (rects[0] != 0) OS.g_free(rects[0]);
 	return newRgn;
 }
 
@@ -557,10 +553,16 @@ public void copyArea(int srcX, int srcY, int width, int height, int destX, int d
 	long /*int*/ drawable = data.drawable;
 	if (OS.USE_CAIRO) {
 		if (data.image != null) {
-			Cairo.cairo_set_source_surface(handle, data.image.surface, deltaX, deltaY);
-			Cairo.cairo_rectangle(handle, destX, destY, width, height);
-			Cairo.cairo_set_operator(handle, Cairo.CAIRO_OPERATOR_SOURCE);
-			Cairo.cairo_fill(handle);
+			/*
+			* Painting the surface onto itself makes cairo snapshot the
+			* whole surface first, so move the pixels in place if possible.
+			*/
+			if (!Cairo.swt_cairo_copy_area(handle, srcX, srcY, width, height, destX, destY)) {
+				Cairo.cairo_set_source_surface(handle, data.image.surface, deltaX, deltaY);
+				Cairo.cairo_rectangle(handle, destX, destY, width, height);
+				Cairo.cairo_set_operator(handle, Cairo.CAIRO_OPERATOR_SOURCE);
+				Cairo.cairo_fill(handle);
+			}
 		} else if (drawable != 0) {
 			Cairo.cairo_save(handle);
 			Cairo.cairo_rectangle(handle, destX, destY, width, height);
@@ -912,14 +914,6 @@ void drawImage(Image srcImage, int srcX, int srcY, int srcWidth, int srcHeight,
 			}
 			Cairo.cairo_rectangle(cairo, destX , destY, destWidth, destHeight);
 			Cairo.cairo_clip(cairo);
-			if (srcWidth != destWidth || srcHeight != destHeight) {
-				float scaleX = destWidth / (float)srcWidth;
-				float scaleY = destHeight / (float)srcHeight;
-				Cairo.cairo_translate(cairo, destX - (int)(srcX * scaleX), destY - (int)(srcY * scaleY));
-				Cairo.cairo_scale(cairo, scaleX, scaleY);
-			} else {
-				Cairo.cairo_translate(cairo, destX - srcX, destY - srcY);
-			}
 			int filter = Cairo.CAIRO_FILTER_GOOD;
 			switch (data.interpolation) {
 				case SWT.DEFAULT: filter = Cairo.CAIRO_FILTER_GOOD; break;
@@ -927,9 +921,32 @@ void drawImage(Image srcImage, int srcX, int srcY, int srcWidth, int srcHeight,
 				case SWT.LOW: filter = Cairo.CAIRO_FILTER_FAST; break;
 				case SWT.HIGH: filter = Cairo.CAIRO_FILTER_BEST; break;
 			}
-			long /*int*/ pattern = Cairo.cairo_pattern_create_for_surface(srcImage.surface);
+			/*
+			* When the whole image is stretched, draw a copy that is scaled
+			* once and kept by the image instead of filtering the original
+			* every time it is painted (e.g. icons on high-DPI monitors).
+			* The copy relies on CAIRO_EXTEND_PAD, which works on Cairo 1.8.x
+			* and greater.
+			*/
+			long /*int*/ scaledSurface = 0;
+			if ((srcWidth != destWidth || srcHeight != destHeight) && srcX == 0 && srcY == 0 && srcWidth == imgWidth && srcHeight == imgHeight) {
+				if (Cairo.cairo_version() >= Cairo.CAIRO_VERSION_ENCODE(1, 8, 0)) {
+					scaledSurface = srcImage.getScaledSurface(destWidth, destHeight, filter);
+				}
+			}
+			if (scaledSurface != 0) {
+				Cairo.cairo_translate(cairo, destX, destY);
+			} else if (srcWidth != destWidth || srcHeight != destHeight) {
+				float scaleX = destWidth / (float)srcWidth;
+				float scaleY = destHeight / (float)srcHeight;
+				Cairo.cairo_translate(cairo, destX - (int)(srcX * scaleX), destY - (int)(srcY * scaleY));
+				Cairo.cairo_scale(cairo, scaleX, scaleY);
+			} else {
+				Cairo.cairo_translate(cairo, destX - srcX, destY - srcY);
+			}
+			long /*int*/ pattern = Cairo.cairo_pattern_create_for_surface(scaledSurface != 0 ? scaledSurface : srcImage.surface);
 			if (pattern == 0) SWT.error(SWT.ERROR_NO_HANDLES);
-			if (srcWidth != destWidth || srcHeight != destHeight) {
+			if (scaledSurface == 0 && (srcWidth != destWidth || srcHeight != destHeight)) {
 				/*
 				* Bug in Cairo.  When drawing the image stretched with an interpolation
 				* algorithm, the edges of the image are faded.  This is not a bug, but
@@ -1199,23 +1216,18 @@ void drawImageXRender(Image srcImage, int srcX, int srcY, int srcWidth, int srcH
 		}
 	}
 	if (clipping != 0) {
-		int[] nRects = new int[1];
-		long /*int*/[] rects = new long /*int*/[1];
-		OS.gdk_region_get_rectangles(clipping, rects, nRects);
-		GdkRectangle rect = new GdkRectangle();
-		short[] xRects = new short[nRects[0] * 4];
-		for (int i=0, j=0; i<nRects[0]; i++, j+=4) {
-			OS.memmove(rect, rects[0] + (i * GdkRectangle.sizeof), GdkRectangle.sizeof);
-			xRects[j] = (short)(translateX + rect.x);
-			xRects[j+1] = (short)(translateY + rect.y);
-			xRects[j+2] = (short)rect.width;
-			xRects[j+3] = (short)rect.height;
+		int[] rects = Region.getRectangles(clipping);
+		short[] xRects = new short[rects.length];
+		for (int j=0; j<rects.length; j+=4) {
+			xRects[j] = (short)(translateX + rects[j]);
+			xRects[j+1] = (short)(translateY + rects[j+1]);
+			xRects[j+2] = (short)rects[j+2];
+			xRects[j+3] = (short)rects[j+3];
 		}
-		OS.XRenderSetPictureClipRectangles(xDisplay, destPict, 0, 0, xRects, nRects[0]);
+		OS.XRenderSetPictureClipRectangles(xDisplay, destPict, 0, 0, xRects, rects.length / 4);
 		if (clipping != data.clipRgn && clipping != data.damageRgn) {
 			OS.gdk_region_destroy(clipping);
 		}
-		if (rects[0] != 0) OS.g_free(rects[0]);
 	}
 	OS.XRenderComposite(xDisplay, maskPict != 0 ? OS.PictOpOver : OS.PictOpSrc, srcPict, maskPict, destPict, srcX, srcY, srcX, srcY, destX + translateX, destY + translateY, destWidth, destHeight);
 	OS.XRenderFreePicture(xDisplay, destPict);
@@ -1444,8 +1456,13 @@ void drawPolyline(long /*int*/ cairo, int[] pointArray, boolean close) {
 	if (count == 0) return;
 	double xOffset = data.cairoXoffset, yOffset = data.cairoYoffset;
 	Cairo.cairo_move_to(cairo, pointArray[0] + xOffset, pointArray[1] + yOffset);
-	for (int i = 1, j=2; i < count; i++, j += 2) {
-		Cairo.cairo_line_to(cairo, pointArray[j] + xOffset, pointArray[j + 1] + yOffset);
+	if (count > 1) {
+		double[] x = new double[count - 1], y = new double[count - 1];
+		for (int i = 1, j=2; i < count; i++, j += 2) {
+			x[i - 1] = pointArray[j] + xOffset;
+			y[i - 1] = pointArray[j + 1] + yOffset;
+		}
+		Cairo.cairo_line_to_batch(cairo, x, y);
 	}
 	if (close) Cairo.cairo_close_path(cairo);
 }
@@ -1926,14 +1943,12 @@ public void fillGradientRectangle(int x, int y, int width, int height, boolean v
 	}
 	long /*int*/ cairo = data.cairo;
 	if (cairo != 0) {
-		long /*int*/ pattern;
-		if (vertical) {
-			pattern = Cairo.cairo_pattern_create_linear (0.0, 0.0, 0.0, 1.0);
-		} else {
-			pattern = Cairo.cairo_pattern_create_linear (0.0, 0.0, 1.0, 0.0);
-		}
-		Cairo.cairo_pattern_add_color_stop_rgba (pattern, 0, fromRGB.red / 255f, fromRGB.green / 255f, fromRGB.blue / 255f, data.alpha / 255f);
-		Cairo.cairo_pattern_add_color_stop_rgba (pattern, 1, toRGB.red / 255f, toRGB.green / 255f, toRGB.blue / 255f, data.alpha / 255f);
+		double[] stops = {
+			0, fromRGB.red / 255f, fromRGB.green / 255f, fromRGB.blue / 255f, data.alpha / 255f,
+			1, toRGB.red / 255f, toRGB.green / 255f, toRGB.blue / 255f, data.alpha / 255f,
+		};
+		long /*int*/ pattern = Cairo.swt_cairo_pattern_create_linear_cached (0.0, 0.0, vertical ? 0.0 : 1.0, vertical ? 1.0 : 0.0, Cairo.CAIRO_EXTEND_PAD, stops);
+		if (pattern == 0) SWT.error(SWT.ERROR_NO_HANDLES);
 		Cairo.cairo_save(cairo);
 		Cairo.cairo_translate(cairo, x, y);
 		Cairo.cairo_scale(cairo, width, height);
@@ -17,6 +17,7 @@ import org.eclipse.swt.internal.gtk.*;
 import org.eclipse.swt.*;
 
 import java.io.*;
+import java.nio.*;
  
 /**
  * Instances of this class are graphics which have been prepared
@@ -136,6 +137,13 @@ public final class Image extends Resource implements Drawable {
 	 */
 	GC memGC;
 
+	/**
+	 * The copy of the surface last scaled by GC.drawImage(), and the
+	 * size and cairo filter it was scaled with.
+	 */
+	long /*int*/ scaledSurface;
+	int scaledWidth, scaledHeight, scaledFilter;
+
 	/**
 	 * The alpha data of the image.
 	 */
@@ -161,6 +169,11 @@ public final class Image extends Resource implements Drawable {
 	 */
 	static final int DEFAULT_SCANLINE_PAD = 4;
 
+	/**
+	 * The largest scaled copy, in pixels, that is kept by the image.
+	 */
+	static final int MAX_SCALED_PIXELS = 512 * 512;
+
 Image(Device device) {
 	super(device);
 }
@@ -270,7 +283,7 @@ public Image(Device device, Image srcImage, int flag) {
 		Cairo.cairo_destroy(cairo);
 		if (flag != SWT.IMAGE_COPY) {
 			int stride = Cairo.cairo_image_surface_get_stride(surface);
-			long /*int*/ data = Cairo.cairo_image_surface_get_data(surface);
+			ByteBuffer data = Cairo.swt_cairo_image_surface_buffer(surface);
 			int oa, or, og, ob;
 			if (OS.BIG_ENDIAN) {
 				oa = 0; or = 1; og = 2; ob = 3;
@@ -289,14 +302,12 @@ public Image(Device device, Image srcImage, int flag) {
 					int oneRed = oneRGB.red;
 					int oneGreen = oneRGB.green;
 					int oneBlue = oneRGB.blue;
-					byte[] line = new byte[stride];
 					for (int y=0; y<height; y++) {
-						OS.memmove(line, data + (y * stride), stride);
-						for (int x=0, offset=0; x<width; x++, offset += 4) {
-							int a = line[offset + oa] & 0xFF;
-							int r = line[offset + or] & 0xFF;
-							int g = line[offset + og] & 0xFF;
-							int b = line[offset + ob] & 0xFF;
+						for (int x=0, offset=y * stride; x<width; x++, offset += 4) {
+							int a = data.get(offset + oa) & 0xFF;
+							int r = data.get(offset + or) & 0xFF;
+							int g = data.get(offset + og) & 0xFF;
+							int b = data.get(offset + ob) & 0xFF;
 							if (hasAlpha && a != 0) {
 								r = ((r * 0xFF) + a / 2) / a;
 								g = ((g * 0xFF) + a / 2) / a;
@@ -321,23 +332,20 @@ public Image(Device device, Image srcImage, int flag) {
 								b = (b * a) + 128;
 								b = (b + (b >> 8)) >> 8;
 							}
-							line[offset + or] = (byte)r;
-							line[offset + og] = (byte)g;
-							line[offset + ob] = (byte)b;
+							data.put(offset + or, (byte)r);
+							data.put(offset + og, (byte)g);
+							data.put(offset + ob, (byte)b);
 						}
-						OS.memmove(data + (y * stride), line, stride);
 					}
 					break;
 				}
 				case SWT.IMAGE_GRAY: {			
-					byte[] line = new byte[stride];
 					for (int y=0; y<height; y++) {
-						OS.memmove(line, data + (y * stride), stride);
-						for (int x=0, offset = 0; x<width; x++, offset += 4) {
-							int a = line[offset + oa] & 0xFF;
-							int r = line[offset + or] & 0xFF;
-							int g = line[offset + og] & 0xFF;
-							int b = line[offset + ob] & 0xFF;
+						for (int x=0, offset = y * stride; x<width; x++, offset += 4) {
+							int a = data.get(offset + oa) & 0xFF;
+							int r = data.get(offset + or) & 0xFF;
+							int g = data.get(offset + og) & 0xFF;
+							int b = data.get(offset + ob) & 0xFF;
 							if (hasAlpha && a != 0) {
 								r = ((r * 0xFF) + a / 2) / a;
 								g = ((g * 0xFF) + a / 2) / a;
@@ -349,13 +357,15 @@ public Image(Device device, Image srcImage, int flag) {
 								intensity = (intensity * a) + 128;
 								intensity = (intensity + (intensity >> 8)) >> 8;
 							}
-							line[offset+or] = line[offset+og] = line[offset+ob] = (byte)intensity;
+							data.put(offset+or, (byte)intensity);
+							data.put(offset+og, (byte)intensity);
+							data.put(offset+ob, (byte)intensity);
 						}
-						OS.memmove(data + (y * stride), line, stride);
 					}
 					break;
 				}
 			}
+			Cairo.cairo_surface_mark_dirty(surface);
 		}
 		init();
 		return;
@@ -701,15 +711,7 @@ void createAlphaMask (int width, int height) {
 			if (imagePtr == 0) SWT.error(SWT.ERROR_NO_HANDLES);
 			GdkImage gdkImage = new GdkImage();
 			OS.memmove(gdkImage, imagePtr);
-			if (gdkImage.bpl == width) {
-				OS.memmove(gdkImage.mem, alphaData, alphaData.length);
-			} else {
-				byte[] line = new byte[gdkImage.bpl];
-				for (int y = 0; y < height; y++) {
-					System.arraycopy(alphaData, width * y, line, 0, width);
-					OS.memmove(gdkImage.mem + (gdkImage.bpl * y), line, gdkImage.bpl);
-				}
-			}
+			OS.memmove2D(gdkImage.mem, gdkImage.bpl, alphaData, width, width, height, 0, 0);
 			OS.gdk_draw_image(mask, gc, imagePtr, 0, 0, 0, 0, width, height);
 			OS.g_object_unref(imagePtr);
 		}		
@@ -739,37 +741,43 @@ void createFromPixbuf(int type, long /*int*/ pixbuf) {
 		byte[] line = new byte[stride];
 		if (hasAlpha) {
 			alphaData = new byte[width * height];
-			for (int y = 0, alphaOffset = 0; y < height; y++) {
-				OS.memmove(line, pixels + (y * stride), stride);
-				for (int x = 0, offset = 0; x < width; x++, offset += 4) {
-					int a = line[offset + 3] & 0xFF;
-					int r = ((line[offset + 0] & 0xFF) * a) + 128;
-					r = (r + (r >> 8)) >> 8;
-					int g = ((line[offset + 1] & 0xFF) * a) + 128;
-					g = (g + (g >> 8)) >> 8;
-					int b = ((line[offset + 2] & 0xFF) * a) + 128;
-					b = (b + (b >> 8)) >> 8;
-					line[offset + oa] = (byte)a;
-					line[offset + or] = (byte)r;
-					line[offset + og] = (byte)g;
-					line[offset + ob] = (byte)b;
-					alphaData[alphaOffset++] = (byte)a;
+			int map = ImageList.getByteMap(oa, or, og, ob, 3, 0, 1, 2);
+			if (!Blit.LOADED || !Blit.convert(pixels, stride, 4, data, cairoStride, 4, width, height, map, 3, Blit.PREMULTIPLY, alphaData, 0, width)) {
+				for (int y = 0, alphaOffset = 0; y < height; y++) {
+					OS.memmove(line, pixels + (y * stride), stride);
+					for (int x = 0, offset = 0; x < width; x++, offset += 4) {
+						int a = line[offset + 3] & 0xFF;
+						int r = ((line[offset + 0] & 0xFF) * a) + 128;
+						r = (r + (r >> 8)) >> 8;
+						int g = ((line[offset + 1] & 0xFF) * a) + 128;
+						g = (g + (g >> 8)) >> 8;
+						int b = ((line[offset + 2] & 0xFF) * a) + 128;
+						b = (b + (b >> 8)) >> 8;
+						line[offset + oa] = (byte)a;
+						line[offset + or] = (byte)r;
+						line[offset + og] = (byte)g;
+						line[offset + ob] = (byte)b;
+						alphaData[alphaOffset++] = (byte)a;
+					}
+					OS.memmove(data + (y * stride), line, stride);
 				}
-				OS.memmove(data + (y * stride), line, stride);
 			}
 		} else {
-			byte[] cairoLine = new byte[cairoStride];
-			for (int y = 0; y < height; y++) {
-				OS.memmove(line, pixels + (y * stride), stride);
-				for (int x = 0, offset = 0, cairoOffset = 0; x < width; x++, offset += 3, cairoOffset += 4) {
-					int r = line[offset + 0] & 0xFF;
-					int g = line[offset + 1] & 0xFF;
-					int b = line[offset + 2] & 0xFF;
-					cairoLine[cairoOffset + or] = (byte)r;
-					cairoLine[cairoOffset + og] = (byte)g;
-					cairoLine[cairoOffset + ob] = (byte)b;
+			int map = ImageList.getByteMap(-1, or, og, ob, Blit.ZERO, 0, 1, 2);
+			if (!Blit.LOADED || !Blit.convert(pixels, stride, 3, data, cairoStride, 4, width, height, map, -1, 0, null, 0, 0)) {
+				byte[] cairoLine = new byte[cairoStride];
+				for (int y = 0; y < height; y++) {
+					OS.memmove(line, pixels + (y * stride), stride);
+					for (int x = 0, offset = 0, cairoOffset = 0; x < width; x++, offset += 3, cairoOffset += 4) {
+						int r = line[offset + 0] & 0xFF;
+						int g = line[offset + 1] & 0xFF;
+						int b = line[offset + 2] & 0xFF;
+						cairoLine[cairoOffset + or] = (byte)r;
+						cairoLine[cairoOffset + og] = (byte)g;
+						cairoLine[cairoOffset + ob] = (byte)b;
+					}
+					OS.memmove(data + (y * cairoStride), cairoLine, cairoStride);
 				}
-				OS.memmove(data + (y * cairoStride), cairoLine, cairoStride);
 			}
 		}
 		Cairo.cairo_surface_mark_dirty(surface);
@@ -813,7 +821,8 @@ void createMask() {
 		int width = this.width;
 		int height = this.height;
 		int stride = Cairo.cairo_image_surface_get_stride(surface);
-		long /*int*/ surfaceData = Cairo.cairo_image_surface_get_data(surface);
+		ByteBuffer surfaceData = Cairo.swt_cairo_image_surface_buffer(surface);
+		if (surfaceData == null) return;
 		int oa, or, og, ob, tr, tg, tb;
 		if (OS.BIG_ENDIAN) {
 			oa = 0; or = 1; og = 2; ob = 3;
@@ -826,27 +835,19 @@ void createMask() {
 			tg = (transparentPixel >> 8) & 0xFF;
 			tb = (transparentPixel >> 0) & 0xFF;
 		}
-		byte[] srcData = new byte[stride * height];
-		OS.memmove(srcData, surfaceData, srcData.length);
-		int offset = 0;
 		for (int y = 0; y < height; y++) {
-			for (int x = 0; x < width; x++, offset += 4) {
-				int a = srcData[offset + oa] & 0xFF;
-				int r = srcData[offset + or] & 0xFF;
-				int g = srcData[offset + og] & 0xFF;
-				int b = srcData[offset + ob] & 0xFF;
+			for (int x = 0, offset = y * stride; x < width; x++, offset += 4) {
+				int r = surfaceData.get(offset + or) & 0xFF;
+				int g = surfaceData.get(offset + og) & 0xFF;
+				int b = surfaceData.get(offset + ob) & 0xFF;
 				if (r == tr && g == tg && b == tb) {
-					a = r = g = b = 0;
+					surfaceData.putInt(offset, 0);
 				} else {
-					a = 0xff;
+					surfaceData.put(offset + oa, (byte)0xff);
 				}
-				srcData[offset + oa] = (byte)a;
-				srcData[offset + or] = (byte)r;
-				srcData[offset + og] = (byte)g;
-				srcData[offset + ob] = (byte)b;
 			}
 		}
-		OS.memmove(surfaceData, srcData, srcData.length);
+		Cairo.cairo_surface_mark_dirty(surface);
 		return;
 	}
 	if (mask != 0) return;
@@ -999,6 +1000,15 @@ void createSurface() {
 	if (transparentPixel != -1 && memGC != null) destroyMask();
 }
 
+/**
+ * Destroy the receiver's scaled copy if it exists.
+ */
+void destroyScaledSurface() {
+	if (scaledSurface == 0) return;
+	Cairo.cairo_surface_destroy(scaledSurface);
+	scaledSurface = 0;
+}
+
 /**
  * Destroy the receiver's mask if it exists.
  */
@@ -1014,6 +1024,7 @@ void destroy() {
 	if (pixmap != 0) OS.g_object_unref(pixmap);
 	if (mask != 0) OS.g_object_unref(mask);
 	if (surface != 0) Cairo.cairo_surface_destroy(surface);
+	destroyScaledSurface();
 	surface = pixmap = mask = 0;
 	memGC = null;
 }
@@ -1091,6 +1102,40 @@ public Rectangle getBounds() {
 	return new Rectangle(0, 0, width = w[0], height = h[0]);
 }
 
+/**
+ * Returns a copy of the surface scaled to the given size with the given
+ * cairo filter.  The copy is created the first time and drawn again by
+ * later calls for the same size and filter, so an image stretched on
+ * every paint is only filtered once.  Returns 0 when the image is
+ * selected into a GC, since its contents may still change, or when the
+ * copy would be too large to keep.
+ */
+long /*int*/ getScaledSurface(int width, int height, int filter) {
+	if (memGC != null || (long)width * height > MAX_SCALED_PIXELS) return 0;
+	if (scaledSurface != 0) {
+		if (scaledWidth == width && scaledHeight == height && scaledFilter == filter) return scaledSurface;
+		destroyScaledSurface();
+	}
+	createSurface();
+	int format = Cairo.cairo_surface_get_content(surface) == Cairo.CAIRO_CONTENT_COLOR ? Cairo.CAIRO_FORMAT_RGB24 : Cairo.CAIRO_FORMAT_ARGB32;
+	long /*int*/ newSurface = Cairo.cairo_image_surface_create(format, width, height);
+	if (newSurface == 0) return 0;
+	long /*int*/ cairo = Cairo.cairo_create(newSurface);
+	long /*int*/ pattern = Cairo.cairo_pattern_create_for_surface(surface);
+	Cairo.cairo_pattern_set_extend(pattern, Cairo.CAIRO_EXTEND_PAD);
+	Cairo.cairo_pattern_set_filter(pattern, filter);
+	Cairo.cairo_scale(cairo, width / (float)this.width, height / (float)this.height);
+	Cairo.cairo_set_source(cairo, pattern);
+	Cairo.cairo_paint(cairo);
+	Cairo.cairo_pattern_destroy(pattern);
+	Cairo.cairo_destroy(cairo);
+	scaledSurface = newSurface;
+	scaledWidth = width;
+	scaledHeight = height;
+	scaledFilter = filter;
+	return scaledSurface;
+}
+
 /**
  * Returns an <code>ImageData</code> based on the receiver
  * Modifications made to this <code>ImageData</code> will not
@@ -1123,40 +1168,46 @@ public ImageData getImageData() {
 			oa = 3; or = 2; og = 1; ob = 0;
 		}
 		byte[] srcData = new byte[stride * height];
-		OS.memmove(srcData, surfaceData, srcData.length);
 		PaletteData palette = new PaletteData(0xFF0000, 0xFF00, 0xFF);
 		ImageData data = new ImageData(width, height, 32, palette, 4, srcData);
+		int map = ImageList.getByteMap(-1, 1, 2, 3, Blit.ZERO, or, og, ob);
 		if (hasAlpha) {
 			byte[] alphaData = data.alphaData = new byte[width * height];
-			for (int y = 0, offset = 0, alphaOffset = 0; y < height; y++) {
-				for (int x = 0; x < width; x++, offset += 4) {
-					int a = srcData[offset + oa] & 0xFF;
-					int r = srcData[offset + or] & 0xFF;
-					int g = srcData[offset + og] & 0xFF;
-					int b = srcData[offset + ob] & 0xFF;
-					srcData[offset + 0] = 0;
-					alphaData[alphaOffset++] = (byte)a;
-					if (a != 0) {
-						srcData[offset + 1] = (byte)(((r * 0xFF) + a / 2) / a);
-						srcData[offset + 2] = (byte)(((g * 0xFF) + a / 2) / a);
-						srcData[offset + 3] = (byte)(((b * 0xFF) + a / 2) / a);
+			if (!Blit.LOADED || !Blit.convertToArray(surfaceData, stride, 4, srcData, 0, stride, 4, width, height, map, oa, Blit.UNPREMULTIPLY, alphaData, 0, width)) {
+				OS.memmove(srcData, surfaceData, srcData.length);
+				for (int y = 0, offset = 0, alphaOffset = 0; y < height; y++) {
+					for (int x = 0; x < width; x++, offset += 4) {
+						int a = srcData[offset + oa] & 0xFF;
+						int r = srcData[offset + or] & 0xFF;
+						int g = srcData[offset + og] & 0xFF;
+						int b = srcData[offset + ob] & 0xFF;
+						srcData[offset + 0] = 0;
+						alphaData[alphaOffset++] = (byte)a;
+						if (a != 0) {
+							srcData[offset + 1] = (byte)(((r * 0xFF) + a / 2) / a);
+							srcData[offset + 2] = (byte)(((g * 0xFF) + a / 2) / a);
+							srcData[offset + 3] = (byte)(((b * 0xFF) + a / 2) / a);
+						}
 					}
 				}
 			}
 		} else {
-			for (int y = 0, offset = 0; y < height; y++) {
-				for (int x = 0; x < width; x++, offset += 4) {
-					byte r = srcData[offset + or];
-					byte g = srcData[offset + og];
-					byte b = srcData[offset + ob];
-					srcData[offset + 0] = 0;
-					srcData[offset + 1] = r;
-					srcData[offset + 2] = g;
-					srcData[offset + 3] = b;
+			if (!Blit.LOADED || !Blit.convertToArray(surfaceData, stride, 4, srcData, 0, stride, 4, width, height, map, -1, 0, null, 0, 0)) {
+				OS.memmove(srcData, surfaceData, srcData.length);
+				for (int y = 0, offset = 0; y < height; y++) {
+					for (int x = 0; x < width; x++, offset += 4) {
+						byte r = srcData[offset + or];
+						byte g = srcData[offset + og];
+						byte b = srcData[offset + ob];
+						srcData[offset + 0] = 0;
+						srcData[offset + 1] = r;
+						srcData[offset + 2] = g;
+						srcData[offset + 3] = b;
+					}
 				}
 			}
 		}
-		Cairo.cairo_surface_destroy(surface);
+		ImageList.releaseSurface(this, surface);
 		return data;
 	}
 	int[] w = new int[1], h = new int[1];
@@ -1572,6 +1623,7 @@ public long /*int*/ internal_new_GC (GCData data) {
 	if (type != SWT.BITMAP || memGC != null) {
 		SWT.error(SWT.ERROR_INVALID_ARGUMENT);
 	}
+	destroyScaledSurface();
 	long /*int*/ gc;
 	if (OS.USE_CAIRO) {
 		gc = Cairo.cairo_create(surface);
@@ -100,7 +100,7 @@ static long /*int*/ gdk_region_polygon(int[] pointArray, int npoints, int fill_r
 		if (y < minY) minY = y;
 		if (y > maxY) maxY = y;
 	}
-	long /*int*/ surface = Cairo.cairo_image_surface_create(Cairo.CAIRO_FORMAT_ARGB32, maxX - minX, maxY - minY);
+	long /*int*/ surface = Cairo.swt_cairo_surface_checkout(Cairo.CAIRO_FORMAT_ARGB32, maxX - minX, maxY - minY);
 	if (surface == 0) SWT.error(SWT.ERROR_NO_HANDLES);
 	long /*int*/ cairo = Cairo.cairo_create(surface);
 	if (cairo == 0) SWT.error(SWT.ERROR_NO_HANDLES);
@@ -119,21 +119,28 @@ static long /*int*/ gdk_region_polygon(int[] pointArray, int npoints, int fill_r
 	Cairo.cairo_destroy(cairo);
 	long /*int*/ polyRgn = OS.gdk_cairo_region_create_from_surface(surface);
 	OS.gdk_region_offset (polyRgn, minX, minY);
-	Cairo.cairo_surface_destroy(surface);
+	Cairo.swt_cairo_surface_return(surface, Cairo.CAIRO_FORMAT_ARGB32, maxX - minX, maxY - minY);
 	return polyRgn;
 }
 
-static void gdk_region_get_rectangles(long /*int*/ region, long /*int*/[] rectangles, int[] n_rectangles) {
-	if (!OS.GTK3) {
-		OS.gdk_region_get_rectangles (region, rectangles, n_rectangles);
-		return;
+/*
+* Returns the rectangles of a region as x, y, width and height
+* quadruples.
+*/
+static int[] getRectangles(long /*int*/ region) {
+	if (OS.GTK3) {
+		int[] rects = Cairo.swt_cairo_region_get_rectangles(region);
+		return rects != null ? rects : new int[0];
 	}
-	int num = Cairo.cairo_region_num_rectangles (region);
-	if (n_rectangles != null) n_rectangles[0] = num;
-	rectangles[0] = OS.g_malloc(GdkRectangle.sizeof * num);
-	for (int n = 0; n < num; n++) {
-		Cairo.cairo_region_get_rectangle (region, n, rectangles[0] + (n * GdkRectangle.sizeof));
+	int[] nRects = new int[1];
+	long /*int*/[] rects = new long /*int*/[1];
+	OS.gdk_region_get_rectangles(region, rects, nRects);
+	int[] result = new int[nRects[0] * 4];
+	if (rects[0] != 0) {
+		OS.memmove(result, rects[0], nRects[0] * GdkRectangle.sizeof);
+		OS.g_free(rects[0]);
 	}
+	return result;
 }
 
 /**
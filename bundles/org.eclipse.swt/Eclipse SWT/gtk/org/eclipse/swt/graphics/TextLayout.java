@@ -57,6 +57,11 @@ public final class TextLayout extends Resource {
 	int stylesCount;
 	long /*int*/ layout, context, attrList, selAttrList;
 	int[] invalidOffsets;
+	/* The text has been set since the runs were last freed */
+	boolean textSet;
+	/* The lines returned by swt_pango_layout_get_lines(), or null */
+	int[] lines;
+	static final int LINE_SIZE = 7;
 	static final char LTR_MARK = '\u200E', RTL_MARK = '\u200F', ZWS = '\u200B', ZWNBS = '\uFEFF';
 
 /**	 
@@ -100,10 +105,11 @@ void checkLayout() {
 }
 
 void computeRuns () {
-	if (attrList != 0) return;
+	if (attrList != 0 || textSet) return;
 	String segmentsText = getSegmentsText();
 	byte[] buffer = Converter.wcsToMbcs(null, segmentsText, false);
 	OS.pango_layout_set_text (layout, buffer, buffer.length);
+	textSet = true;
 	if (stylesCount == 2 && styles[0].style == null && ascent == -1 && descent == -1 && segments == null) return;
 	long /*int*/ ptr = OS.pango_layout_get_text(layout);
 	attrList = OS.pango_attr_list_new();	
@@ -634,10 +640,7 @@ void drawBorder(GC gc, int x, int y, GdkColor selectionColor) {
 			int[] ranges = new int[]{byteStart, byteEnd};
 			long /*int*/ rgn = OS.gdk_pango_layout_get_clip_region(layout, x, y, ranges, ranges.length / 2);
 			if (rgn != 0) {
-				int[] nRects = new int[1];
-				long /*int*/[] rects = new long /*int*/[1];
-				Region.gdk_region_get_rectangles(rgn, rects, nRects);
-				GdkRectangle rect = new GdkRectangle();
+				int[] rects = Region.getRectangles(rgn);
 				GdkColor color = null;
 				if (color == null && style.borderColor != null) color = style.borderColor.handle;
 				if (color == null && selectionColor != null) color = selectionColor;
@@ -662,9 +665,8 @@ void drawBorder(GC gc, int x, int y, GdkColor selectionColor) {
 					} else {
 						Cairo.cairo_set_dash(cairo, null, 0, 0);
 					}
-					for (int j=0; j<nRects[0]; j++) {
-						OS.memmove(rect, rects[0] + (j * GdkRectangle.sizeof), GdkRectangle.sizeof);
-						Cairo.cairo_rectangle(cairo, rect.x + 0.5, rect.y + 0.5, rect.width - 1, rect.height - 1);
+					for (int j=0; j<rects.length; j+=4) {
+						Cairo.cairo_rectangle(cairo, rects[j] + 0.5, rects[j+1] + 0.5, rects[j+2] - 1, rects[j+3] - 1);
 					}
 					Cairo.cairo_stroke(cairo);
 				} else {
@@ -687,12 +689,10 @@ void drawBorder(GC gc, int x, int y, GdkColor selectionColor) {
 						line_style = OS.GDK_LINE_SOLID;
 					}
 					OS.gdk_gc_set_line_attributes(gdkGC, width, line_style, cap_style, join_style);
-					for (int j=0; j<nRects[0]; j++) {
-						OS.memmove(rect, rects[0] + (j * GdkRectangle.sizeof), GdkRectangle.sizeof);
-						OS.gdk_draw_rectangle(data.drawable, gdkGC, 0, rect.x, rect.y, rect.width - 1, rect.height - 1);
+					for (int j=0; j<rects.length; j+=4) {
+						OS.gdk_draw_rectangle(data.drawable, gdkGC, 0, rects[j], rects[j+1], rects[j+2] - 1, rects[j+3] - 1);
 					}
 				}
-				if (rects[0] != 0) OS.g_free(rects[0]);
 				OS.gdk_region_destroy(rgn);
 			}
 		}
@@ -708,6 +708,8 @@ void drawBorder(GC gc, int x, int y, GdkColor selectionColor) {
 }
 
 void freeRuns() {
+	textSet = false;
+	lines = null;
 	if (attrList == 0) return;
 	OS.pango_layout_set_attributes(layout, 0);
 	OS.pango_attr_list_unref(attrList);
@@ -719,6 +721,20 @@ void freeRuns() {
 	invalidOffsets = null;
 }
 
+/*
+* Returns the byte index, byte length, logical extents and baseline of
+* every line, LINE_SIZE values per line.  The layout is walked once and
+* the result is kept until the layout changes.
+*/
+int[] getLines() {
+	if (lines == null) {
+		int lineCount = OS.pango_layout_get_line_count(layout);
+		lines = new int[lineCount * LINE_SIZE];
+		OS.swt_pango_layout_get_lines(layout, lines, lineCount);
+	}
+	return lines;
+}
+
 /** 
  * Returns the receiver's horizontal text alignment, which will be one
  * of <code>SWT.LEFT</code>, <code>SWT.CENTER</code> or
@@ -830,29 +846,26 @@ public Rectangle getBounds(int start, int end) {
 	* includes areas from lines outside of the requested range.  The fix
 	* is to subtract these areas from the clip region.
 	*/
-	PangoRectangle pangoRect = new PangoRectangle();
-	long /*int*/ iter = OS.pango_layout_get_iter(layout);
-	if (iter == 0) SWT.error(SWT.ERROR_NO_HANDLES);
-	long /*int*/ linesRegion = OS.gdk_region_new();
-	if (linesRegion == 0) SWT.error(SWT.ERROR_NO_HANDLES);
-	int lineEnd = 0;
-	do {
-		OS.pango_layout_iter_get_line_extents(iter, null, pangoRect);
-		if (OS.pango_layout_iter_next_line(iter)) {
-			lineEnd = OS.pango_layout_iter_get_index(iter) - 1;
-		} else {
-			lineEnd = strlen;
+	int[] lines = getLines();
+	int lineCount = lines.length / LINE_SIZE;
+	int[] lineRects = new int[lineCount * 4];
+	int rectCount = 0;
+	for (int i = 0; i < lineCount; i++) {
+		int index = i * LINE_SIZE;
+		int lineEnd = i + 1 < lineCount ? lines[index + LINE_SIZE] - 1 : strlen;
+		if (byteStart <= lineEnd) {
+			lineRects[rectCount * 4] = OS.PANGO_PIXELS(lines[index + 2]);
+			lineRects[rectCount * 4 + 1] = OS.PANGO_PIXELS(lines[index + 3]);
+			lineRects[rectCount * 4 + 2] = OS.PANGO_PIXELS(lines[index + 4]);
+			lineRects[rectCount * 4 + 3] = OS.PANGO_PIXELS(lines[index + 5]);
+			rectCount++;
 		}
-		if (byteStart > lineEnd) continue;
-		rect.x = OS.PANGO_PIXELS(pangoRect.x);
-		rect.y = OS.PANGO_PIXELS(pangoRect.y);
-		rect.width = OS.PANGO_PIXELS(pangoRect.width);
-		rect.height = OS.PANGO_PIXELS(pangoRect.height);
-		OS.gdk_region_union_with_rect(linesRegion, rect);
-	} while (lineEnd + 1 <= byteEnd);
+		if (lineEnd + 1 > byteEnd) break;
+	}
+	long /*int*/ linesRegion = OS.swt_region_new_rectangles(lineRects, rectCount);
+	if (linesRegion == 0) SWT.error(SWT.ERROR_NO_HANDLES);
 	OS.gdk_region_intersect(clipRegion, linesRegion);
 	OS.gdk_region_destroy(linesRegion);
-	OS.pango_layout_iter_free(iter);
 	
 	OS.gdk_region_get_clipbox(clipRegion, rect);
 	OS.gdk_region_destroy(clipRegion);
@@ -991,16 +1004,12 @@ public Rectangle getLineBounds(int lineIndex) {
 	computeRuns();
 	int lineCount = OS.pango_layout_get_line_count(layout);
 	if (!(0 <= lineIndex && lineIndex < lineCount)) SWT.error(SWT.ERROR_INVALID_RANGE);
-	long /*int*/ iter = OS.pango_layout_get_iter(layout);
-	if (iter == 0) SWT.error(SWT.ERROR_NO_HANDLES);
-	for (int i = 0; i < lineIndex; i++) OS.pango_layout_iter_next_line(iter);
-	PangoRectangle rect = new PangoRectangle();
-	OS.pango_layout_iter_get_line_extents(iter, null, rect);
-	OS.pango_layout_iter_free(iter);
-	int x = OS.PANGO_PIXELS(rect.x);
-	int y = OS.PANGO_PIXELS(rect.y);
-	int width = OS.PANGO_PIXELS(rect.width);
-	int height = OS.PANGO_PIXELS(rect.height);
+	int[] lines = getLines();
+	int index = lineIndex * LINE_SIZE;
+	int x = OS.PANGO_PIXELS(lines[index + 2]);
+	int y = OS.PANGO_PIXELS(lines[index + 3]);
+	int width = OS.PANGO_PIXELS(lines[index + 4]);
+	int height = OS.PANGO_PIXELS(lines[index + 5]);
 	if (ascent != -1 && descent != -1) {
 		height = Math.max (height, ascent + descent);
 	}
@@ -1052,13 +1061,17 @@ public int getLineIndex(int offset) {
 	long /*int*/ byteOffset = OS.g_utf16_offset_to_pointer(ptr,offset) - ptr;
 	int strlen = OS.strlen(ptr);
 	byteOffset = Math.min(byteOffset, strlen);
-	long /*int*/ iter = OS.pango_layout_get_iter(layout);
-	if (iter == 0) SWT.error(SWT.ERROR_NO_HANDLES);
-	while (OS.pango_layout_iter_next_line(iter)) {
-		if (OS.pango_layout_iter_get_index(iter) > byteOffset) break;
-		line++;
+	/* find the last line that starts at or before the offset */
+	int[] lines = getLines();
+	int high = lines.length / LINE_SIZE - 1;
+	while (line < high) {
+		int mid = (line + high + 1) / 2;
+		if (lines[mid * LINE_SIZE] <= byteOffset) {
+			line = mid;
+		} else {
+			high = mid - 1;
+		}
 	}
-	OS.pango_layout_iter_free(iter);
 	return line;
 }
 
@@ -1115,14 +1128,16 @@ public FontMetrics getLineMetrics (int lineIndex) {
 public int[] getLineOffsets() {
 	checkLayout();
 	computeRuns();
-	int lineCount = OS.pango_layout_get_line_count(layout);
+	int[] lines = getLines();
+	int lineCount = lines.length / LINE_SIZE;
 	int[] offsets = new int [lineCount + 1];
 	long /*int*/ ptr = OS.pango_layout_get_text(layout);
-	PangoLayoutLine line = new PangoLayoutLine();
+	int pos = 0, lastIndex = 0;
 	for (int i = 0; i < lineCount; i++) {
-		long /*int*/ linePtr = OS.pango_layout_get_line(layout, i);
-		OS.memmove(line, linePtr, PangoLayoutLine.sizeof);
-		int pos = (int)/*64*/OS.g_utf16_pointer_to_offset(ptr, ptr + line.start_index);
+		/* count from the previous line so that the text is only walked once */
+		int startIndex = lines[i * LINE_SIZE];
+		pos += (int)/*64*/OS.g_utf16_pointer_to_offset(ptr + lastIndex, ptr + startIndex);
+		lastIndex = startIndex;
 		offsets[i] = untranslateOffset(pos);
 	}
 	offsets[lineCount] = text.length();
@@ -1670,6 +1685,7 @@ public void setAlignment (int alignment) {
 			break;
 	}
 	OS.pango_layout_set_alignment(layout, align);
+	lines = null;
 }
 
 /**
@@ -1772,6 +1788,7 @@ public void setIndent (int indent) {
 	this.indent = indent;
 	OS.pango_layout_set_indent(layout, (indent - wrapIndent) * OS.PANGO_SCALE);
 	if (wrapWidth != -1) setWidth();
+	lines = null;
 }
 
 /**
@@ -1789,6 +1806,7 @@ public void setIndent (int indent) {
 public void setJustify (boolean justify) {
 	checkLayout();
 	OS.pango_layout_set_justify(layout, justify);
+	lines = null;
 }
 
 /**
@@ -1836,6 +1854,7 @@ public void setSpacing (int spacing) {
 	checkLayout();
 	if (spacing < 0) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
 	OS.pango_layout_set_spacing(layout, spacing * OS.PANGO_SCALE);
+	lines = null;
 }
 
 /**
@@ -2061,6 +2080,7 @@ public void setTabs(int[] tabs) {
 	* lines cache. The fix to use pango_layout_context_changed() to free the lines cache.
 	*/
 	OS.pango_layout_context_changed(layout);
+	lines = null;
 }
 
 /**
@@ -2150,6 +2170,7 @@ public void setWrapIndent (int wrapIndent) {
 	this.wrapIndent = wrapIndent;
 	OS.pango_layout_set_indent(layout, (indent - wrapIndent) * OS.PANGO_SCALE);
 	if (wrapWidth != -1) setWidth();
+	lines = null;
 }
 
 static final boolean isLam(int ch) {
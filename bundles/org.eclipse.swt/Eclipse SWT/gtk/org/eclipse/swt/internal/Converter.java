@@ -37,6 +37,10 @@ public static String defaultCodePage () {
 }
 
 public static char [] mbcsToWcs (String codePage, byte [] buffer) {
+	if (Transcode.LOADED) {
+		char [] chars = Transcode.toUtf16 (buffer, 0, buffer.length);
+		return chars != null ? chars : EmptyCharArray;
+	}
 	long /*int*/ [] items_written = new long /*int*/ [1];
 	long /*int*/ ptr = OS.g_utf8_to_utf16 (buffer, buffer.length, null, items_written, null);
 	if (ptr == 0) return EmptyCharArray;
@@ -55,6 +59,11 @@ public static byte [] wcsToMbcs (String codePage, String string, boolean termina
 }
 
 public static byte [] wcsToMbcs (String codePage, char [] buffer, boolean terminate) {
+	if (Transcode.LOADED) {
+		byte [] bytes = Transcode.toUtf8 (buffer, 0, buffer.length, terminate);
+		if (bytes != null) return bytes;
+		return terminate ? NullByteArray : EmptyByteArray;
+	}
 	long /*int*/ [] items_read = new long /*int*/ [1], items_written = new long /*int*/ [1];
 	/*
 	* Note that g_utf16_to_utf8()  stops converting 
@@ -32,7 +32,7 @@ public static long /*int*/ convertSurface(Image image) {
 	if (type != Cairo.CAIRO_SURFACE_TYPE_IMAGE) {
 		Rectangle bounds = image.getBounds();
 		int format = Cairo.cairo_surface_get_content(newSurface) == Cairo.CAIRO_CONTENT_COLOR ? Cairo.CAIRO_FORMAT_RGB24 : Cairo.CAIRO_FORMAT_ARGB32;
-		newSurface = Cairo.cairo_image_surface_create(format, bounds.width, bounds.height);
+		newSurface = Cairo.swt_cairo_surface_checkout(format, bounds.width, bounds.height);
 		if (newSurface == 0) SWT.error(SWT.ERROR_NO_HANDLES);
 		long /*int*/ cairo = Cairo.cairo_create(newSurface);
 		if (cairo == 0) SWT.error(SWT.ERROR_NO_HANDLES);
@@ -46,6 +46,40 @@ public static long /*int*/ convertSurface(Image image) {
 	return newSurface;
 }
 
+/*
+* Returns the Blit map that stores the source alpha, red, green and blue
+* bytes at the given destination byte indices.  A destination index of
+* -1 has no channel, and the destination bytes without a channel are
+* cleared.
+*/
+public static int getByteMap(int destA, int destR, int destG, int destB, int srcA, int srcR, int srcG, int srcB) {
+	int map = 0;
+	for (int k = 0; k < 4; k++) {
+		int index = Blit.ZERO;
+		if (k == destA) index = srcA;
+		if (k == destR) index = srcR;
+		if (k == destG) index = srcG;
+		if (k == destB) index = srcB;
+		map |= index << (k * 8);
+	}
+	return map;
+}
+
+/*
+* Releases a surface returned by convertSurface(), giving a converted
+* copy back to the surface pool.
+*/
+public static void releaseSurface(Image image, long /*int*/ surface) {
+	if (surface == image.surface) {
+		Cairo.cairo_surface_destroy(surface);
+	} else {
+		int format = Cairo.cairo_image_surface_get_format(surface);
+		int width = Cairo.cairo_image_surface_get_width(surface);
+		int height = Cairo.cairo_image_surface_get_height(surface);
+		Cairo.swt_cairo_surface_return(surface, format, width, height);
+	}
+}
+
 public static long /*int*/ createPixbuf(Image image) {
 	long /*int*/ pixbuf;
 	if (OS.USE_CAIRO) {
@@ -64,42 +98,48 @@ public static long /*int*/ createPixbuf(Image image) {
 		} else {
 			oa = 3; or = 2; og = 1; ob = 0;
 		}
-		byte[] line = new byte[stride];
 		long /*int*/ surfaceData = Cairo.cairo_image_surface_get_data(surface);
+		int cairoStride = Cairo.cairo_image_surface_get_stride(surface);
+		byte[] line = new byte[stride];
 		if (hasAlpha) {
-			for (int y = 0; y < height; y++) {
-				OS.memmove (line, surfaceData + (y * stride), stride);
-				for (int x = 0, offset = 0; x < width; x++, offset += 4) {
-					int a = line[offset + oa] & 0xFF;
-					int r = line[offset + or] & 0xFF;
-					int g = line[offset + og] & 0xFF;
-					int b = line[offset + ob] & 0xFF;
-					line[offset + 3] = (byte)a;
-					if (a != 0) {
-						line[offset + 0] = (byte)(((r * 0xFF) + a / 2) / a);
-						line[offset + 1] = (byte)(((g * 0xFF) + a / 2) / a);
-						line[offset + 2] = (byte)(((b * 0xFF) + a / 2) / a);
+			int map = getByteMap(3, 0, 1, 2, oa, or, og, ob);
+			if (!Blit.LOADED || !Blit.convert(surfaceData, cairoStride, 4, pixels, stride, 4, width, height, map, oa, Blit.UNPREMULTIPLY, null, 0, 0)) {
+				for (int y = 0; y < height; y++) {
+					OS.memmove (line, surfaceData + (y * stride), stride);
+					for (int x = 0, offset = 0; x < width; x++, offset += 4) {
+						int a = line[offset + oa] & 0xFF;
+						int r = line[offset + or] & 0xFF;
+						int g = line[offset + og] & 0xFF;
+						int b = line[offset + ob] & 0xFF;
+						line[offset + 3] = (byte)a;
+						if (a != 0) {
+							line[offset + 0] = (byte)(((r * 0xFF) + a / 2) / a);
+							line[offset + 1] = (byte)(((g * 0xFF) + a / 2) / a);
+							line[offset + 2] = (byte)(((b * 0xFF) + a / 2) / a);
+						}
 					}
+					OS.memmove (pixels + (y * stride), line, stride);
 				}
-				OS.memmove (pixels + (y * stride), line, stride);
 			}
 		} else {
-			int cairoStride = Cairo.cairo_image_surface_get_stride(surface);
-			byte[] cairoLine = new byte[cairoStride];
-			for (int y = 0; y < height; y++) {
-				OS.memmove (cairoLine, surfaceData + (y * cairoStride), cairoStride);
-				for (int x = 0, offset = 0, cairoOffset = 0; x < width; x++, offset += 3, cairoOffset += 4) {
-					byte r = cairoLine[cairoOffset + or];
-					byte g = cairoLine[cairoOffset + og];
-					byte b = cairoLine[cairoOffset + ob];
-					line[offset + 0] = r;
-					line[offset + 1] = g;
-					line[offset + 2] = b;
+			int map = getByteMap(-1, 0, 1, 2, Blit.ZERO, or, og, ob);
+			if (!Blit.LOADED || !Blit.convert(surfaceData, cairoStride, 4, pixels, stride, 3, width, height, map, -1, 0, null, 0, 0)) {
+				byte[] cairoLine = new byte[cairoStride];
+				for (int y = 0; y < height; y++) {
+					OS.memmove (cairoLine, surfaceData + (y * cairoStride), cairoStride);
+					for (int x = 0, offset = 0, cairoOffset = 0; x < width; x++, offset += 3, cairoOffset += 4) {
+						byte r = cairoLine[cairoOffset + or];
+						byte g = cairoLine[cairoOffset + og];
+						byte b = cairoLine[cairoOffset + ob];
+						line[offset + 0] = r;
+						line[offset + 1] = g;
+						line[offset + 2] = b;
+					}
+					OS.memmove (pixels + (y * stride), line, stride);
 				}
-				OS.memmove (pixels + (y * stride), line, stride);
 			}
 		}
-		Cairo.cairo_surface_destroy(surface);
+		releaseSurface(image, surface);
 	} else {
 		int [] w = new int [1], h = new int [1];
 		if (OS.GTK_VERSION >= OS.VERSION(2, 24, 0)) {
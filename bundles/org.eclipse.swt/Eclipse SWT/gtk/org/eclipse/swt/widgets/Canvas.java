@@ -12,7 +12,6 @@ package org.eclipse.swt.widgets;
 
 
 import org.eclipse.swt.graphics.*;
-import org.eclipse.swt.internal.cairo.Cairo;
 import org.eclipse.swt.internal.gtk.*;
 import org.eclipse.swt.*;
 
@@ -298,21 +297,15 @@ public void scroll (int destX, int destY, int x, int y, int width, int height, b
 		redrawWidget (destX, destY, width, height, false, false, false);
 	} else {
 		if (OS.GTK3) {
-			long /*int*/ cairo = OS.gdk_cairo_create(window);
-			if (Cairo.cairo_version() < Cairo.CAIRO_VERSION_ENCODE(1, 12, 0)) {
-				OS.gdk_cairo_set_source_window(cairo, window, 0, 0);
-			} else {
-				Cairo.cairo_push_group(cairo);
-				OS.gdk_cairo_set_source_window(cairo, window, 0, 0);
-				Cairo.cairo_paint(cairo);
-				Cairo.cairo_pop_group_to_source(cairo);
+			/*
+			* Let GDK copy the visible part of the source in place.  Painting
+			* the window into a cairo group first copied the whole window
+			* on every scroll.  gdk_window_move_region() also moves the
+			* pending update region and invalidates what it uncovers.
+			*/
+			if (copyRect.width != 0 && copyRect.height != 0) {
+				OS.gdk_window_move_region(window, copyRegion, deltaX, deltaY);
 			}
-			double[] matrix = {1, 0, 0, 1, -deltaX, -deltaY};
-			Cairo.cairo_pattern_set_matrix(Cairo.cairo_get_source(cairo), matrix);
-			Cairo.cairo_rectangle(cairo, copyRect.x + deltaX, copyRect.y + deltaY, copyRect.width, copyRect.height);
-			Cairo.cairo_clip(cairo);
-			Cairo.cairo_paint(cairo);
-			Cairo.cairo_destroy(cairo);
 		} else {
 			long /*int*/ gdkGC = OS.gdk_gc_new (window);
 			OS.gdk_gc_set_exposures (gdkGC, true);
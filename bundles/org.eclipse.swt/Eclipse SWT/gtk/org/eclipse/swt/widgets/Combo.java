@@ -703,6 +703,7 @@ void hookEvents () {
 		int blockMask =  OS.G_SIGNAL_MATCH_DATA | OS.G_SIGNAL_MATCH_ID;
 		OS.g_signal_handlers_block_matched (imContext, blockMask, id, 0, 0, 0, entryHandle);
 	}
+	updateMutedSignals ();
 }
 
 void hookEvents(long /*int*/ [] handles) {
@@ -2224,6 +2225,15 @@ boolean translateTraversal (GdkEventKey keyEvent) {
 	return super.translateTraversal (keyEvent);
 }
 
+@Override
+void updateMutedSignals () {
+	/* The text signals are only handled to send SWT.Verify */
+	if (entryHandle == 0) return;
+	boolean mute = !hooks (SWT.Verify);
+	OS.swt_closure_mute (entryHandle, INSERT_TEXT, mute);
+	OS.swt_closure_mute (entryHandle, DELETE_TEXT, mute);
+}
+
 String verifyText (String string, int start, int end) {
 	if (string.length () == 0 && start == end) return null;
 	Event event = new Event ();
@@ -1254,6 +1254,13 @@ void moveBelow (long /*int*/ child, long /*int*/ sibling) {
 @Override
 void moveChildren(int oldWidth) {
 	Control[] children = _getChildren ();
+	/*
+	* Allocate every child in one native call once they have all been
+	* moved.  Note that all calls to gtk_widget_size_allocate() must be
+	* preceded by a call to gtk_widget_size_request().
+	*/
+	long /*int*/ [] widgets = new long /*int*/ [children.length];
+	int [] allocations = new int [children.length * 4];
 	for (int i = 0; i < children.length; i++) {
 		Control child = children[i];
 		long /*int*/ topHandle = child.topHandle ();
@@ -1269,16 +1276,15 @@ void moveChildren(int oldWidth) {
 			OS.gdk_window_move (child.enableWindow, x, y);
 		}
 		child.moveHandle (x, y);
-		/*
-		* Cause a size allocation this widget's topHandle.  Note that
-		* all calls to gtk_widget_size_allocate() must be preceded by
-		* a call to gtk_widget_size_request().
-		*/
-		GtkRequisition requisition = new GtkRequisition ();
-		gtk_widget_size_request (topHandle, requisition);
-		allocation.x = x;
-		allocation.y = y;
-		OS.gtk_widget_size_allocate (topHandle, allocation);
+		widgets [i] = topHandle;
+		allocations [i * 4] = x;
+		allocations [i * 4 + 1] = y;
+		allocations [i * 4 + 2] = allocation.width;
+		allocations [i * 4 + 3] = allocation.height;
+	}
+	OS.swt_widget_size_allocate_batch (widgets, allocations, children.length);
+	for (int i = 0; i < children.length; i++) {
+		Control child = children[i];
 		Control control = child.findBackgroundControl ();
 		if (control != null && control.backgroundImage != null) {
 			if (child.isVisible ()) child.redrawWidget (0, 0, 0, 0, true, true, true);
@@ -11,6 +11,8 @@
 package org.eclipse.swt.widgets;
 
 
+import java.nio.*;
+
 import org.eclipse.swt.*;
 import org.eclipse.swt.accessibility.*;
 import org.eclipse.swt.events.*;
@@ -2961,9 +2963,14 @@ long /*int*/ gtk_button_press_event (long /*int*/ widget, long /*int*/ event) {
 }
 
 long /*int*/ gtk_button_press_event (long /*int*/ widget, long /*int*/ event, boolean sendMouseDown) {
-	GdkEventButton gdkEvent = new GdkEventButton ();
-	OS.memmove (gdkEvent, event, GdkEventButton.sizeof);
-	if (gdkEvent.type == OS.GDK_3BUTTON_PRESS) return 0;
+	ByteBuffer buffer = display.decodeEvent (event);
+	int type = (int) buffer.getLong (OS.DECODE_TYPE);
+	if (type == OS.GDK_3BUTTON_PRESS) return 0;
+	int button = (int) buffer.getLong (OS.DECODE_DETAIL);
+	int time = (int) buffer.getLong (OS.DECODE_TIME);
+	int eventState = (int) buffer.getLong (OS.DECODE_STATE);
+	double x = buffer.getDouble (OS.DECODE_X), y = buffer.getDouble (OS.DECODE_Y);
+	double x_root = buffer.getDouble (OS.DECODE_X_ROOT), y_root = buffer.getDouble (OS.DECODE_Y_ROOT);
 	
 	/*
 	* When a shell is created with SWT.ON_TOP and SWT.NO_FOCUS,
@@ -2976,7 +2983,7 @@ long /*int*/ gtk_button_press_event (long /*int*/ widget, long /*int*/ event, bo
 		shell.forceActive();
 	}
 	long /*int*/ result = 0;
-	if (gdkEvent.type == OS.GDK_BUTTON_PRESS) {
+	if (type == OS.GDK_BUTTON_PRESS) {
 		display.clickCount = 1;
 		long /*int*/ nextEvent = OS.gdk_event_peek ();
 		if (nextEvent != 0) {
@@ -2987,21 +2994,21 @@ long /*int*/ gtk_button_press_event (long /*int*/ widget, long /*int*/ event, bo
 		}
 		boolean dragging = false;
 		if ((state & DRAG_DETECT) != 0 && hooks (SWT.DragDetect)) {
-			if (gdkEvent.button == 1) {
+			if (button == 1) {
 				boolean [] consume = new boolean [1];
-				if (dragDetect ((int) gdkEvent.x, (int) gdkEvent.y, true, true, consume)) {
+				if (dragDetect ((int) x, (int) y, true, true, consume)) {
 					dragging = true;
 					if (consume [0]) result = 1;
 				}
 				if (isDisposed ()) return 1;
 			}
 		}
-		if (sendMouseDown && !sendMouseEvent (SWT.MouseDown, gdkEvent.button, display.clickCount, 0, false, gdkEvent.time, gdkEvent.x_root, gdkEvent.y_root, false, gdkEvent.state)) {
+		if (sendMouseDown && !sendMouseEvent (SWT.MouseDown, button, display.clickCount, 0, false, time, x_root, y_root, false, eventState)) {
 			result = 1;
 		}
 		if (isDisposed ()) return 1;
 		if (dragging) {
-			sendDragEvent (gdkEvent.button, gdkEvent.state, (int) gdkEvent.x, (int) gdkEvent.y, false);
+			sendDragEvent (button, eventState, (int) x, (int) y, false);
 			if (isDisposed ()) return 1;
 		}
 		/*
@@ -3010,15 +3017,15 @@ long /*int*/ gtk_button_press_event (long /*int*/ widget, long /*int*/ event, bo
 		* operating system from displaying the menu if necessary.
 		*/
 		if ((state & MENU) != 0) {
-			if (gdkEvent.button == 3) {
-				if (showMenu ((int)gdkEvent.x_root, (int)gdkEvent.y_root)) {
+			if (button == 3) {
+				if (showMenu ((int)x_root, (int)y_root)) {
 					result = 1;
 				}
 			}
 		}
 	} else {
 		display.clickCount = 2;
-		result = sendMouseEvent (SWT.MouseDoubleClick, gdkEvent.button, display.clickCount, 0, false, gdkEvent.time, gdkEvent.x_root, gdkEvent.y_root, false, gdkEvent.state) ? 0 : 1;
+		result = sendMouseEvent (SWT.MouseDoubleClick, button, display.clickCount, 0, false, time, x_root, y_root, false, eventState) ? 0 : 1;
 		if (isDisposed ()) return 1;
 	}
 	if (!shell.isDisposed ()) shell.setActiveControl (this, SWT.MouseDown);
@@ -3027,9 +3034,12 @@ long /*int*/ gtk_button_press_event (long /*int*/ widget, long /*int*/ event, bo
 
 @Override
 long /*int*/ gtk_button_release_event (long /*int*/ widget, long /*int*/ event) {
-	GdkEventButton gdkEvent = new GdkEventButton ();
-	OS.memmove (gdkEvent, event, GdkEventButton.sizeof);
-	return sendMouseEvent (SWT.MouseUp, gdkEvent.button, display.clickCount, 0, false, gdkEvent.time, gdkEvent.x_root, gdkEvent.y_root, false, gdkEvent.state) ? 0 : 1;
+	ByteBuffer buffer = display.decodeEvent (event);
+	int button = (int) buffer.getLong (OS.DECODE_DETAIL);
+	int time = (int) buffer.getLong (OS.DECODE_TIME);
+	int state = (int) buffer.getLong (OS.DECODE_STATE);
+	double x_root = buffer.getDouble (OS.DECODE_X_ROOT), y_root = buffer.getDouble (OS.DECODE_Y_ROOT);
+	return sendMouseEvent (SWT.MouseUp, button, display.clickCount, 0, false, time, x_root, y_root, false, state) ? 0 : 1;
 }
 
 @Override
@@ -3316,14 +3326,15 @@ long /*int*/ gtk_mnemonic_activate (long /*int*/ widget, long /*int*/ arg1) {
 
 @Override
 long /*int*/ gtk_motion_notify_event (long /*int*/ widget, long /*int*/ event) {
-	GdkEventMotion gdkEvent = new GdkEventMotion ();
-	OS.memmove (gdkEvent, event, GdkEventMotion.sizeof);
+	ByteBuffer buffer = display.decodeEvent (event);
+	int time = (int) buffer.getLong (OS.DECODE_TIME);
+	boolean isHint = buffer.getLong (OS.DECODE_DETAIL) != 0;
+	double x = buffer.getDouble (OS.DECODE_X_ROOT), y = buffer.getDouble (OS.DECODE_Y_ROOT);
+	int state = (int) buffer.getLong (OS.DECODE_STATE);
 	if (this == display.currentControl && (hooks (SWT.MouseHover) || filters (SWT.MouseHover))) {
 		display.addMouseHoverTimeout (handle);
 	}
-	double x = gdkEvent.x_root, y = gdkEvent.y_root;
-	int state = gdkEvent.state;
-	if (gdkEvent.is_hint != 0) {
+	if (isHint) {
 		int [] pointer_x = new int [1], pointer_y = new int [1], mask = new int [1];
 		long /*int*/ window = eventWindow ();
 		gdk_window_get_device_position (window, pointer_x, pointer_y, mask);
@@ -3334,14 +3345,14 @@ long /*int*/ gtk_motion_notify_event (long /*int*/ widget, long /*int*/ event) {
 	if (OS.GTK3 && this != display.currentControl) {
 		if (display.currentControl != null && !display.currentControl.isDisposed ()) {
 			display.removeMouseHoverTimeout (display.currentControl.handle);
-			display.currentControl.sendMouseEvent (SWT.MouseExit,  0, gdkEvent.time, x, y, false, state);
+			display.currentControl.sendMouseEvent (SWT.MouseExit,  0, time, x, y, false, state);
 		}
 		if (!isDisposed ()) {
 			display.currentControl = this;
-			sendMouseEvent (SWT.MouseEnter, 0, gdkEvent.time, x, y, false, state);
+			sendMouseEvent (SWT.MouseEnter, 0, time, x, y, false, state);
 		}
 	}
-	int result = sendMouseEvent (SWT.MouseMove, 0, gdkEvent.time, x, y, gdkEvent.is_hint != 0, state) ? 0 : 1;
+	int result = sendMouseEvent (SWT.MouseMove, 0, time, x, y, isHint, state) ? 0 : 1;
 	return result;
 }
 
@@ -3374,26 +3385,28 @@ long /*int*/ gtk_realize (long /*int*/ widget) {
 
 @Override
 long /*int*/ gtk_scroll_event (long /*int*/ widget, long /*int*/ eventPtr) {
-	GdkEventScroll gdkEvent = new GdkEventScroll ();
-	OS.memmove (gdkEvent, eventPtr, GdkEventScroll.sizeof);
-	switch (gdkEvent.direction) {
+	ByteBuffer buffer = display.decodeEvent (eventPtr);
+	int time = (int) buffer.getLong (OS.DECODE_TIME);
+	int state = (int) buffer.getLong (OS.DECODE_STATE);
+	double x_root = buffer.getDouble (OS.DECODE_X_ROOT), y_root = buffer.getDouble (OS.DECODE_Y_ROOT);
+	switch ((int) buffer.getLong (OS.DECODE_DETAIL)) {
 		case OS.GDK_SCROLL_UP:
-			return sendMouseEvent (SWT.MouseWheel, 0, 3, SWT.SCROLL_LINE, true, gdkEvent.time, gdkEvent.x_root, gdkEvent.y_root, false, gdkEvent.state) ? 0 : 1;
+			return sendMouseEvent (SWT.MouseWheel, 0, 3, SWT.SCROLL_LINE, true, time, x_root, y_root, false, state) ? 0 : 1;
 		case OS.GDK_SCROLL_DOWN:
-			return sendMouseEvent (SWT.MouseWheel, 0, -3, SWT.SCROLL_LINE, true, gdkEvent.time, gdkEvent.x_root, gdkEvent.y_root, false, gdkEvent.state) ? 0 : 1;
+			return sendMouseEvent (SWT.MouseWheel, 0, -3, SWT.SCROLL_LINE, true, time, x_root, y_root, false, state) ? 0 : 1;
 		case OS.GDK_SCROLL_LEFT:
-			return sendMouseEvent (SWT.MouseHorizontalWheel, 0, 3, 0, true, gdkEvent.time, gdkEvent.x_root, gdkEvent.y_root, false, gdkEvent.state) ? 0 : 1;
+			return sendMouseEvent (SWT.MouseHorizontalWheel, 0, 3, 0, true, time, x_root, y_root, false, state) ? 0 : 1;
 		case OS.GDK_SCROLL_RIGHT:
-			return sendMouseEvent (SWT.MouseHorizontalWheel, 0, -3, 0, true, gdkEvent.time, gdkEvent.x_root, gdkEvent.y_root, false, gdkEvent.state) ? 0 : 1;
+			return sendMouseEvent (SWT.MouseHorizontalWheel, 0, -3, 0, true, time, x_root, y_root, false, state) ? 0 : 1;
 		case OS.GDK_SCROLL_SMOOTH:
 			long /*int*/ result = 0;
 			double[] delta_x = new double[1], delta_y = new double [1];
 			if (OS.gdk_event_get_scroll_deltas (eventPtr, delta_x, delta_y)) {
 				if (delta_x [0] != 0) {
-					result = (sendMouseEvent (SWT.MouseHorizontalWheel, 0, (int)(-3 * delta_x [0]), 0, true, gdkEvent.time, gdkEvent.x_root, gdkEvent.y_root, false, gdkEvent.state) ? 0 : 1);
+					result = (sendMouseEvent (SWT.MouseHorizontalWheel, 0, (int)(-3 * delta_x [0]), 0, true, time, x_root, y_root, false, state) ? 0 : 1);
 				}
 				if (delta_y [0] != 0) {
-					result = (sendMouseEvent (SWT.MouseWheel, 0, (int)(-3 * delta_y [0]), SWT.SCROLL_LINE, true, gdkEvent.time, gdkEvent.x_root, gdkEvent.y_root, false, gdkEvent.state) ? 0 : 1);
+					result = (sendMouseEvent (SWT.MouseWheel, 0, (int)(-3 * delta_y [0]), SWT.SCROLL_LINE, true, time, x_root, y_root, false, state) ? 0 : 1);
 				}
 			}
 			return result;
@@ -11,6 +11,8 @@
 package org.eclipse.swt.widgets;
 
 
+import java.nio.*;
+
 import org.eclipse.swt.*;
 import org.eclipse.swt.internal.*;
 import org.eclipse.swt.internal.cairo.*;
@@ -107,6 +109,7 @@ public class Display extends Device {
 	long /*int*/ fds;
 	int allocated_nfds;
 	boolean wake;
+	long /*int*/ wakeSource;
 	int [] max_priority = new int [1], timeout = new int [1];
 	Callback eventCallback, filterCallback;
 	long /*int*/ eventProc, filterProc, windowProc2, windowProc3, windowProc4, windowProc5;
@@ -178,7 +181,8 @@ public class Display extends Device {
 	int [] timerIds;
 	Runnable [] timerList;
 	Callback timerCallback;
-	long /*int*/ timerProc;
+	long /*int*/ timerProc, timerQueue;
+	int timerSerial;
 	Callback windowTimerCallback;
 	long /*int*/ windowTimerProc;
 	
@@ -219,6 +223,10 @@ public class Display extends Device {
 	Object idleLock = new Object();
 	boolean idleNeeded;
 	
+	/* Images decoded on worker threads */
+	long /*int*/ decodeQueue;
+	Listener [] decodeListeners;
+	
 	/* GtkTreeView callbacks */
 	long /*int*/ cellDataProc;
 	Callback cellDataCallback;
@@ -281,6 +289,9 @@ public class Display extends Device {
 	
 	/* Click count*/
 	int clickCount = 1;
+
+	/* Decoded event fields */
+	ByteBuffer eventBuffer;
 	
 	/* Entry inner border */
 	static final int INNER_BORDER = 2;
@@ -418,6 +429,9 @@ public class Display extends Device {
 	Widget [] skinList = new Widget [GROW_SIZE];
 	int skinCount;
 	
+	/* Load the native libraries that are not needed by gtk_init in the background */
+	static final boolean LOAD_LIBRARIES = "true".equals (System.getProperty ("org.eclipse.swt.internal.gtk.loadLibrariesInBackground")); //$NON-NLS-1$ //$NON-NLS-2$
+
 	/* Package name */
 	static final String PACKAGE_PREFIX = "org.eclipse.swt.widgets."; //$NON-NLS-1$
 	/* This code is intentionally commented.
@@ -550,6 +564,7 @@ public void addFilter (int eventType, Listener listener) {
 	if (listener == null) error (SWT.ERROR_NULL_ARGUMENT);
 	if (filterTable == null) filterTable = new EventTable ();
 	filterTable.hook (eventType, listener);
+	if (eventType == SWT.Verify) OS.swt_closure_set_muting (false);
 }
 
 void addLayoutDeferred (Composite comp) {
@@ -689,6 +704,7 @@ void addWidget (long /*int*/ handle, Widget widget) {
 	}
 	int index = freeSlot + 1;
 	OS.g_object_set_qdata (handle, SWT_OBJECT_INDEX, index);
+	Callback.setTarget (handle, widget);
 	int oldSlot = freeSlot;
 	freeSlot = indexTable[oldSlot];
 	indexTable [oldSlot] = -2;
@@ -911,6 +927,7 @@ protected void create (DeviceData data) {
 	checkSubclass ();
 	checkDisplay(thread = Thread.currentThread (), false);
 	createDisplay (data);
+	if (Watchdog.THRESHOLD > 0) Watchdog.start (Watchdog.THRESHOLD);
 	register (this);
 	if (Default == null) Default = this;
 }
@@ -925,6 +942,7 @@ void createDisplay (DeviceData data) {
 	if (OS.GTK_VERSION < OS.VERSION(2, 24, 0)) {
 	    OS.gtk_set_locale();
 	}
+	if (LOAD_LIBRARIES) loadLibraries ();
 	if (!OS.gtk_init_check (new long /*int*/ [] {0}, null)) {
 		SWT.error (SWT.ERROR_NO_HANDLES, null, " [gtk_init_check() failed]"); //$NON-NLS-1$
 	}
@@ -1044,7 +1062,7 @@ void createDisplay (DeviceData data) {
 	eventCallback = new Callback (this, "eventProc", 2); //$NON-NLS-1$
 	eventProc = eventCallback.getAddress ();
 	if (eventProc == 0) error (SWT.ERROR_NO_MORE_CALLBACKS);
-	OS.gdk_event_handler_set (eventProc, 0, 0);
+	OS.swt_event_handler_set (eventProc, 0, 0);
 	filterCallback = new Callback (this, "filterProc", 3); //$NON-NLS-1$
 	filterProc = filterCallback.getAddress ();
 	if (filterProc == 0) error (SWT.ERROR_NO_MORE_CALLBACKS);
@@ -1120,6 +1138,21 @@ static void deregister (Display display) {
 	}
 }
 
+/*
+* Decode the fields of a GdkEvent into the event buffer, which is
+* read with the OS.DECODE_* offsets.  The buffer is overwritten by
+* the next event, so callers copy the fields they need before running
+* any code that may dispatch events.
+*/
+ByteBuffer decodeEvent (long /*int*/ event) {
+	if (eventBuffer == null) {
+		eventBuffer = ByteBuffer.allocateDirect (OS.DECODE_SIZE);
+		eventBuffer.order (ByteOrder.nativeOrder ());
+	}
+	OS.decodeEvent (event, eventBuffer);
+	return eventBuffer;
+}
+
 /**
  * Destroys the device in the operating system and releases
  * the device's handle.  If the device does not have a handle,
@@ -1469,10 +1502,28 @@ int getCaretBlinkTime () {
 	return buffer [0] / 2;
 }
 
+/*
+* Only the signals that Text and Combo mute for Verify, and the signals
+* of a text buffer that OS.swt_text_buffer_insert() holds, go through the
+* closures of OS.swt_closure_new(). Their meta marshal keeps GLib from
+* using the faster va_list marshaller, so the other signals do not.
+*/
+long /*int*/ newClosure (int id) {
+	switch (id) {
+		case Widget.CHANGED:
+		case Widget.DELETE_RANGE:
+		case Widget.DELETE_TEXT:
+		case Widget.INSERT_TEXT:
+		case Widget.TEXT_BUFFER_INSERT_TEXT:
+			return OS.swt_closure_new (closuresProc [id], id);
+	}
+	return OS.g_cclosure_new (closuresProc [id], id, 0);
+}
+
 long /*int*/ getClosure (int id) {
 	if (OS.GLIB_VERSION >= OS.VERSION(2, 36, 0) && ++closuresCount [id] >= 255) {
 		if (closures [id] != 0) OS.g_closure_unref (closures [id]);
-		closures [id] = OS.g_cclosure_new (closuresProc [id], id, 0);
+		closures [id] = newClosure (id);
 		OS.g_closure_ref (closures [id]);
 		OS.g_closure_sink (closures [id]);
 		closuresCount [id] = 0;
@@ -1707,6 +1758,69 @@ long /*int*/ gtk_cell_renderer_toggle_get_type () {
 	return toggle_renderer_type;
 }
 
+int addDecodeListener (Listener listener) {
+	if (listener == null) error (SWT.ERROR_NULL_ARGUMENT);
+	if (decodeQueue == 0) {
+		decodeQueue = OS.swt_decode_queue_new (2);
+		if (decodeQueue == 0) error (SWT.ERROR_NO_HANDLES);
+		decodeListeners = new Listener [4];
+	}
+	int index = 0;
+	while (index < decodeListeners.length && decodeListeners [index] != null) index++;
+	if (index == decodeListeners.length) {
+		Listener [] newListeners = new Listener [decodeListeners.length + 4];
+		System.arraycopy (decodeListeners, 0, newListeners, 0, decodeListeners.length);
+		decodeListeners = newListeners;
+	}
+	decodeListeners [index] = listener;
+	return index + 1;
+}
+
+/**
+ * Decodes the image file on a worker thread, scaling it to fit the
+ * given size when it is positive, and notifies the listener from
+ * <code>readAndDispatch()</code> with the image in <code>event.image</code>,
+ * or <code>null</code> when the file could not be decoded.  The listener
+ * owns the image.
+ * <p>
+ * <b>IMPORTANT:</b> This method is <em>not</em> part of the public
+ * API for <code>Display</code>. It is marked public only so that it
+ * can be shared within the packages provided by SWT. It is not
+ * available on all platforms, and should never be called from
+ * application code.
+ * </p>
+ *
+ * @noreference This method is not intended to be referenced by clients.
+ */
+public void gtk_decode_image (String filename, int width, int height, Listener listener) {
+	checkDevice ();
+	if (filename == null) error (SWT.ERROR_NULL_ARGUMENT);
+	int id = addDecodeListener (listener);
+	byte [] buffer = Converter.wcsToMbcs (null, filename, true);
+	OS.swt_decode_queue_push_file (decodeQueue, id, buffer, width, height);
+}
+
+/**
+ * Decodes the image data on a worker thread, the same way as
+ * <code>gtk_decode_image(String, int, int, Listener)</code>.  The data
+ * is copied before this method returns.
+ * <p>
+ * <b>IMPORTANT:</b> This method is <em>not</em> part of the public
+ * API for <code>Display</code>. It is marked public only so that it
+ * can be shared within the packages provided by SWT. It is not
+ * available on all platforms, and should never be called from
+ * application code.
+ * </p>
+ *
+ * @noreference This method is not intended to be referenced by clients.
+ */
+public void gtk_decode_image (byte [] data, int width, int height, Listener listener) {
+	checkDevice ();
+	if (data == null) error (SWT.ERROR_NULL_ARGUMENT);
+	int id = addDecodeListener (listener);
+	OS.swt_decode_queue_push_data (decodeQueue, id, data, data.length, width, height);
+}
+
 /**
  * Returns the default display. One is created (making the
  * thread that invokes this method its user-interface thread)
@@ -2303,7 +2417,7 @@ void getBackgroundColor (long /*int*/ context, int state, GdkRGBA rgba) {
 	*/
 	OS.gtk_style_context_save (context);
 	OS.gtk_style_context_set_state (context, state);
-	long /*int*/ surface = Cairo.cairo_image_surface_create (Cairo.CAIRO_FORMAT_RGB24, 1, 1);
+	long /*int*/ surface = Cairo.swt_cairo_surface_checkout (Cairo.CAIRO_FORMAT_RGB24, 1, 1);
 	long /*int*/ cairo = Cairo.cairo_create (surface);
 	OS.gtk_render_background (context, cairo, -50, -50, 100, 100);
 	Cairo.cairo_fill (cairo);
@@ -2314,8 +2428,8 @@ void getBackgroundColor (long /*int*/ context, int state, GdkRGBA rgba) {
 	rgba.green = buffer[1] / 255f;
 	rgba.blue = buffer[0] / 255f;
 	rgba.alpha = 1;
-	Cairo.cairo_surface_destroy (surface);
 	Cairo.cairo_destroy (cairo);
+	Cairo.swt_cairo_surface_return (surface, Cairo.CAIRO_FORMAT_RGB24, 1, 1);
 	OS.gtk_style_context_restore (context);
 }
 
@@ -2624,7 +2738,7 @@ void initializeCallbacks () {
 	signalIds [Widget.VISIBILITY_NOTIFY_EVENT] = OS.g_signal_lookup (OS.visibility_notify_event, OS.GTK_TYPE_WIDGET ());
 	signalIds [Widget.WINDOW_STATE_EVENT] = OS.g_signal_lookup (OS.window_state_event, OS.GTK_TYPE_WIDGET ());
 
-	windowCallback2 = new Callback (this, "windowProc", 2); //$NON-NLS-1$
+	windowCallback2 = new Callback (this, "windowProc", 2, false, 0, true); //$NON-NLS-1$
 	windowProc2 = windowCallback2.getAddress ();
 	if (windowProc2 == 0) error (SWT.ERROR_NO_MORE_CALLBACKS);
 
@@ -2659,7 +2773,7 @@ void initializeCallbacks () {
 	closuresProc [Widget.PASTE_CLIPBOARD] = windowProc2;
 	closuresProc [Widget.PASTE_CLIPBOARD_INVERSE] = windowProc2;
 
-	windowCallback3 = new Callback (this, "windowProc", 3); //$NON-NLS-1$
+	windowCallback3 = new Callback (this, "windowProc", 3, false, 0, true); //$NON-NLS-1$
 	windowProc3 = windowCallback3.getAddress ();
 	if (windowProc3 == 0) error (SWT.ERROR_NO_MORE_CALLBACKS);	
 
@@ -2699,7 +2813,7 @@ void initializeCallbacks () {
 	closuresProc [Widget.ROW_DELETED] = windowProc3;
 	closuresProc [Widget.DIRECTION_CHANGED] = windowProc3;
 
-	windowCallback4 = new Callback (this, "windowProc", 4); //$NON-NLS-1$
+	windowCallback4 = new Callback (this, "windowProc", 4, false, 0, true); //$NON-NLS-1$
 	windowProc4 = windowCallback4.getAddress ();
 	if (windowProc4 == 0) error (SWT.ERROR_NO_MORE_CALLBACKS);	
 
@@ -2716,7 +2830,7 @@ void initializeCallbacks () {
 	closuresProc [Widget.DELETE_FROM_CURSOR] = windowProc4;
 	closuresProc [Widget.DELETE_FROM_CURSOR_INVERSE] = windowProc4;
 
-	windowCallback5 = new Callback (this, "windowProc", 5); //$NON-NLS-1$
+	windowCallback5 = new Callback (this, "windowProc", 5, false, 0, true); //$NON-NLS-1$
 	windowProc5 = windowCallback5.getAddress ();
 	if (windowProc5 == 0) error (SWT.ERROR_NO_MORE_CALLBACKS);
 
@@ -2729,7 +2843,7 @@ void initializeCallbacks () {
 
 	for (int i = 0; i < Widget.LAST_SIGNAL; i++) {
 		if (closuresProc[i] != 0) {
-			closures [i] = OS.g_cclosure_new(closuresProc [i], i, 0);
+			closures [i] = newClosure (i);
 		}
 		if (closures [i] != 0) {
 			OS.g_closure_ref (closures [i]);
@@ -2740,6 +2854,8 @@ void initializeCallbacks () {
 	timerCallback = new Callback (this, "timerProc", 1); //$NON-NLS-1$
 	timerProc = timerCallback.getAddress ();
 	if (timerProc == 0) error (SWT.ERROR_NO_MORE_CALLBACKS);
+	timerQueue = OS.swt_timer_queue_new (timerProc, 0);
+	wakeSource = OS.swt_wake_source_new ();
 
 	windowTimerCallback = new Callback (this, "windowTimerProc", 1); //$NON-NLS-1$
 	windowTimerProc = windowTimerCallback.getAddress ();
@@ -2936,6 +3052,43 @@ boolean isValidThread () {
 	return thread == Thread.currentThread ();
 }
 
+/*
+ * Loads the cairo and accessibility libraries on a background thread while
+ * GTK initializes, instead of on first use from the user interface thread.
+ * Initializing the classes loads the libraries, and the class initialization
+ * lock makes the user interface thread wait if it needs one of them before
+ * the loader is done. Cairo is also warmed up by painting an image surface,
+ * which binds the functions that the first paint would otherwise resolve.
+ * GTK itself is not touched, since it may only be called from the user
+ * interface thread.
+ */
+static void loadLibraries () {
+	Thread thread = new Thread ("SWT Library Loader") { //$NON-NLS-1$
+		@Override
+		public void run () {
+			try {
+				if (OS.INIT_CAIRO) {
+					long /*int*/ surface = Cairo.cairo_image_surface_create (Cairo.CAIRO_FORMAT_ARGB32, 1, 1);
+					if (surface != 0) {
+						long /*int*/ cairo = Cairo.cairo_create (surface);
+						if (cairo != 0) {
+							Cairo.cairo_set_source_rgba (cairo, 0, 0, 0, 1);
+							Cairo.cairo_paint (cairo);
+							Cairo.cairo_destroy (cairo);
+						}
+						Cairo.cairo_surface_destroy (surface);
+					}
+				}
+				Class.forName ("org.eclipse.swt.internal.accessibility.gtk.ATK"); //$NON-NLS-1$
+			} catch (Throwable e) {
+				/* A library that failed to load is reported when its class is first used */
+			}
+		}
+	};
+	thread.setDaemon (true);
+	thread.start ();
+}
+
 /**
  * Maps a point from one coordinate system to another.
  * When the control is null, coordinates are mapped to
@@ -3389,6 +3542,7 @@ public boolean readAndDispatch () {
 	*/
 	OS.gdk_threads_leave();
 	events |= OS.g_main_context_iteration (0, false);
+	events |= runDecodedImages ();
 	if (events) {
 		runDeferredEvents ();
 		return true;
@@ -3459,6 +3613,7 @@ protected void release () {
 }
 
 void releaseDisplay () {
+	Watchdog.stop ();
 	windowCallback2.dispose ();  windowCallback2 = null;
 	windowCallback3.dispose ();  windowCallback3 = null;
 	windowCallback4.dispose ();  windowCallback4 = null;
@@ -3500,6 +3655,11 @@ void releaseDisplay () {
 	if (idleHandle != 0) OS.g_source_remove (idleHandle);
 	idleHandle = 0;
 	
+	/* Dispose the image decode queue */
+	if (decodeQueue != 0) OS.swt_decode_queue_free (decodeQueue);
+	decodeQueue = 0;
+	decodeListeners = null;
+	
 	/* Dispose GtkTreeView callbacks */
 	cellDataCallback.dispose (); cellDataCallback = null;
 	cellDataProc = 0;
@@ -3530,10 +3690,11 @@ void releaseDisplay () {
 	if (shellMapProcClosure != 0) OS.g_closure_unref (shellMapProcClosure);
 
 	/* Dispose the timer callback */
-	if (timerIds != null) {
-		for (int i=0; i<timerIds.length; i++) {
-			if (timerIds [i] != 0) OS.g_source_remove (timerIds [i]);
-		}
+	if (timerQueue != 0) OS.swt_timer_queue_free (timerQueue);
+	timerQueue = 0;
+	synchronized (Device.class) {
+		if (wakeSource != 0) OS.swt_wake_source_free (wakeSource);
+		wakeSource = 0;
 	}
 	timerIds = null;
 	timerList = null;
@@ -3572,6 +3733,12 @@ void releaseDisplay () {
 		resources = null;
 	}
 
+	/* Release the pooled cairo surfaces */
+	Cairo.swt_cairo_surface_pool_clear ();
+
+	/* Release the cached cairo patterns */
+	Cairo.swt_cairo_pattern_cache_clear ();
+
 	/* Release the System Colors */
 	COLOR_WIDGET_DARK_SHADOW = COLOR_WIDGET_NORMAL_SHADOW = COLOR_WIDGET_LIGHT_SHADOW =
 	COLOR_WIDGET_HIGHLIGHT_SHADOW = COLOR_WIDGET_BACKGROUND = COLOR_WIDGET_BORDER =
@@ -3582,7 +3749,7 @@ void releaseDisplay () {
 	COLOR_INFO_BACKGROUND = COLOR_INFO_FOREGROUND = COLOR_LINK_FOREGROUND = null;
 
 	/* Dispose the event callback */
-	OS.gdk_event_handler_set (0, 0, 0);
+	OS.swt_event_handler_set (0, 0, 0);
 	eventCallback.dispose ();  eventCallback = null;
 	
 	/* Dispose the hidden shell */
@@ -3659,6 +3826,7 @@ public void removeFilter (int eventType, Listener listener) {
 	if (filterTable == null) return;
 	filterTable.unhook (eventType, listener);
 	if (filterTable.size () == 0) filterTable = null;
+	if (eventType == SWT.Verify) OS.swt_closure_set_muting (!filters (SWT.Verify));
 }
 
 long /*int*/ removeGdkEvent () {
@@ -3740,6 +3908,7 @@ Widget removeWidget (long /*int*/ handle) {
 		indexTable [index] = freeSlot;
 		freeSlot = index;
 		OS.g_object_set_qdata (handle, SWT_OBJECT_INDEX, 0);
+		Callback.setTarget (handle, null);
 	}
 	return widget;	
 }
@@ -3748,6 +3917,34 @@ boolean runAsyncMessages (boolean all) {
 	return synchronizer.runAsyncMessages (all);
 }
 
+boolean runDecodedImages () {
+	if (decodeQueue == 0) return false;
+	boolean run = false;
+	long /*int*/ [] id = new long /*int*/ [1];
+	while (true) {
+		long /*int*/ pixbuf = OS.swt_decode_queue_pop (decodeQueue, id);
+		if (id [0] == 0) break;
+		int index = (int) id [0] - 1;
+		Listener listener = decodeListeners [index];
+		decodeListeners [index] = null;
+		Image image = null;
+		if (pixbuf != 0) {
+			image = Image.gtk_new_from_pixbuf (this, SWT.BITMAP, pixbuf);
+			OS.g_object_unref (pixbuf);
+		}
+		if (listener != null) {
+			Event event = new Event ();
+			event.display = this;
+			event.image = image;
+			listener.handleEvent (event);
+		} else {
+			if (image != null) image.dispose ();
+		}
+		run = true;
+	}
+	return run;
+}
+
 boolean runDeferredEvents () {
 	boolean run = false;
 	/*
@@ -4314,7 +4511,7 @@ public void timerExec (int milliseconds, Runnable runnable) {
 		index++;
 	}
 	if (index != timerList.length) {
-		OS.g_source_remove (timerIds [index]);
+		OS.swt_timer_queue_remove (timerQueue, timerIds [index]);
 		timerList [index] = null;
 		timerIds [index] = 0;
 		if (milliseconds < 0) return;
@@ -4334,21 +4531,32 @@ public void timerExec (int milliseconds, Runnable runnable) {
 			timerIds = newTimerIds;
 		}
 	}
-	int timerId = OS.g_timeout_add (milliseconds, timerProc, index);
-	if (timerId != 0) {
-		timerIds [index] = timerId;
-		timerList [index] = runnable;
-	}
+	/*
+	* The timers share one GSource. Each one is given a new id, so
+	* that a timer which is reset while the ids of the expired timers
+	* are being run is not run early.
+	*/
+	if (++timerSerial == 0) timerSerial = 1;
+	OS.swt_timer_queue_add (timerQueue, timerSerial, milliseconds);
+	timerIds [index] = timerSerial;
+	timerList [index] = runnable;
 }
 
-long /*int*/ timerProc (long /*int*/ i) {
+long /*int*/ timerProc (long /*int*/ data) {
 	if (timerList == null) return 0;
-	int index = (int)/*64*/i;
-	if (0 <= index && index < timerList.length) {
-		Runnable runnable = timerList [index];
-		timerList [index] = null;
-		timerIds [index] = 0;
-		if (runnable != null) runnable.run ();
+	int [] ids = new int [timerList.length];
+	int count = OS.swt_timer_queue_pop (timerQueue, ids, ids.length);
+	for (int i = 0; i < count; i++) {
+		if (timerList == null) break;
+		for (int index = 0; index < timerIds.length; index++) {
+			if (timerIds [index] == ids [i]) {
+				Runnable runnable = timerList [index];
+				timerList [index] = null;
+				timerIds [index] = 0;
+				if (runnable != null) runnable.run ();
+				break;
+			}
+		}
 	}
 	return 0;
 }
@@ -4448,9 +4656,11 @@ void sendSleepEvent() {
   if (this.eventTable != null && this.eventTable.hooks(SWT.Sleep)) {
     sendEvent(SWT.Sleep, null);
   }
+  Watchdog.idle(true);
 }
 
 void sendWakeupEvent() {
+  Watchdog.idle(false);
   if (this.eventTable != null && this.eventTable.hooks(SWT.Wakeup)) {
     sendEvent(SWT.Wakeup, null);
   }
@@ -4612,7 +4822,10 @@ public void wake () {
 }
 
 void wakeThread () {
-	OS.g_main_context_wakeup (0);
+	/* The source is freed when the display is released, under the same lock */
+	synchronized (Device.class) {
+		if (wakeSource != 0) OS.swt_wake_source_signal (wakeSource);
+	}
 	wake = true;
 }
 
@@ -4627,6 +4840,35 @@ static char wcsToMbcs (char ch) {
 	return 0;
 }
 
+/*
+* The window procs receive the widget of the handle from the callback,
+* which keeps a table of the widgets added with addWidget(), so that
+* dispatching a signal does not call g_object_get_qdata().
+*/
+long /*int*/ windowProc (Object target, long /*int*/ handle, long /*int*/ user_data) {
+	Widget widget = target != null ? (Widget) target : getWidget (handle);
+	if (widget == null) return 0;
+	return widget.windowProc (handle, user_data);
+}
+
+long /*int*/ windowProc (Object target, long /*int*/ handle, long /*int*/ arg0, long /*int*/ user_data) {
+	Widget widget = target != null ? (Widget) target : getWidget (handle);
+	if (widget == null) return 0;
+	return widget.windowProc (handle, arg0, user_data);
+}
+
+long /*int*/ windowProc (Object target, long /*int*/ handle, long /*int*/ arg0, long /*int*/ arg1, long /*int*/ user_data) {
+	Widget widget = target != null ? (Widget) target : getWidget (handle);
+	if (widget == null) return 0;
+	return widget.windowProc (handle, arg0, arg1, user_data);
+}
+
+long /*int*/ windowProc (Object target, long /*int*/ handle, long /*int*/ arg0, long /*int*/ arg1, long /*int*/ arg2, long /*int*/ user_data) {
+	Widget widget = target != null ? (Widget) target : getWidget (handle);
+	if (widget == null) return 0;
+	return widget.windowProc (handle, arg0, arg1, arg2, user_data);
+}
+
 long /*int*/ windowProc (long /*int*/ handle, long /*int*/ user_data) {
 	Widget widget = getWidget (handle);
 	if (widget == null) return 0;
@@ -3104,25 +3104,30 @@ public void setItemCount (int count) {
 	TableItem [] newItems = new TableItem [length];
 	System.arraycopy (items, 0, newItems, 0, itemCount);
 	items = newItems;
+	/*
+	* Add the new rows with a single native call.  When the table
+	* is empty, the view is detached from the model while the rows
+	* are added, which is safe because there is no selection or
+	* scroll position to lose.
+	*/
+	long /*int*/ view = itemCount == 0 ? handle : 0;
 	if (isVirtual) {
-		long /*int*/ iter = OS.g_malloc (OS.GtkTreeIter_sizeof ());
-		if (iter == 0) error (SWT.ERROR_NO_HANDLES);
 		if (fixAccessibility ()) {
 			ignoreAccessibility = true;
 		}
-		for (int i=itemCount; i<count; i++) {
-			OS.gtk_list_store_append (modelHandle, iter);
-		}
+		OS.swt_tree_model_insert_rows (view, modelHandle, 0, -1, count - itemCount, 0, null, null, null, null);
 		if (fixAccessibility ()) {
 			ignoreAccessibility = false;
 			OS.g_object_notify (handle, OS.model);
 		}
-		OS.g_free (iter);
 		itemCount = count;
 	} else {
-		for (int i=itemCount; i<count; i++) {
-			new TableItem (this, SWT.NONE, i, true);
+		long /*int*/ [] iters = new long /*int*/ [count - itemCount];
+		OS.swt_tree_model_insert_rows (view, modelHandle, 0, -1, iters.length, 0, null, null, null, iters);
+		for (int i=0; i<iters.length; i++) {
+			items [itemCount + i] = new TableItem (this, SWT.NONE, iters, i);
 		}
+		itemCount = count;
 	}
 	if (!isVirtual) setRedraw (true);
 }
@@ -121,6 +121,13 @@ TableItem (Table parent, int style, int index, boolean create) {
 	}
 }
 
+/* Takes over a row created by the parent with OS.swt_tree_model_insert_rows() */
+TableItem (Table parent, int style, long /*int*/ [] iters, int index) {
+	super (parent, style);
+	this.parent = parent;
+	handle = iters [index];
+}
+
 static Table checkNull (Table control) {
 	if (control == null) SWT.error (SWT.ERROR_NULL_ARGUMENT);
 	return control;
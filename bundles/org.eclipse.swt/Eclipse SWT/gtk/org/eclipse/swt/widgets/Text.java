@@ -57,7 +57,7 @@ import org.eclipse.swt.events.*;
  * @noextend This class is not intended to be subclassed by clients.
  */
 public class Text extends Scrollable {
-	long /*int*/ bufferHandle;
+	long /*int*/ bufferHandle, offsetIndex;
 	long /*int*/ imContext;
 	int tabs = 8, lastEventTime = 0;
 	long /*int*/ gdkEventKey = 0;
@@ -216,6 +216,7 @@ void createHandle (int index) {
 		if (handle == 0) error (SWT.ERROR_NO_HANDLES);
 		bufferHandle = OS.gtk_text_view_get_buffer (handle);
 		if (bufferHandle == 0) error (SWT.ERROR_NO_HANDLES);
+		offsetIndex = OS.swt_offset_index_new (bufferHandle);
 		OS.gtk_container_add (fixedHandle, scrolledHandle);
 		OS.gtk_container_add (scrolledHandle, handle);
 		OS.gtk_text_view_set_editable (handle, (style & SWT.READ_ONLY) == 0);
@@ -404,12 +405,7 @@ public void append (String string) {
 		OS.gtk_editable_insert_text (handle, buffer, buffer.length, new int[]{-1});
 		OS.gtk_editable_set_position (handle, -1);
 	} else {
-		byte [] position =  new byte [ITER_SIZEOF];
-		OS.gtk_text_buffer_get_end_iter (bufferHandle, position);
-		OS.gtk_text_buffer_insert (bufferHandle, position, buffer, buffer.length);
-		OS.gtk_text_buffer_place_cursor (bufferHandle, position);
-		long /*int*/ mark = OS.gtk_text_buffer_get_insert (bufferHandle);
-		OS.gtk_text_view_scroll_mark_onscreen (handle, mark);
+		OS.swt_text_buffer_insert (bufferHandle, handle, buffer, buffer.length, false);
 	}
 	applySegments ();
 }
@@ -455,13 +451,8 @@ void applySegments () {
 		OS.g_signal_handlers_block_matched (bufferHandle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, CHANGED);
 		OS.g_signal_handlers_block_matched (bufferHandle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, TEXT_BUFFER_INSERT_TEXT);
 		byte [] pos = new byte [ITER_SIZEOF];
-		byte [] startIter =  new byte [ITER_SIZEOF];
-		byte [] endIter =  new byte [ITER_SIZEOF];
 		for (int i = 0; i < nSegments; i++) {
-			OS.gtk_text_buffer_get_bounds (bufferHandle, startIter, endIter);
-			long /*int*/ ptr = OS.gtk_text_buffer_get_text (bufferHandle, startIter, endIter, true);
-			OS.gtk_text_buffer_get_iter_at_offset (bufferHandle, pos, (int)/*64*/OS.g_utf16_offset_to_utf8_offset (ptr, segments[i] + i));
-			OS.g_free (ptr);
+			OS.gtk_text_buffer_get_iter_at_offset (bufferHandle, pos, (int)/*64*/OS.swt_offset_index_utf16_to_utf8 (offsetIndex, segments[i] + i));
 			if (segmentsChars != null && segmentsChars.length > i) {
 				separator [0] = segmentsChars [i];
 			}
@@ -498,14 +489,10 @@ void clearSegments (boolean applyText) {
 		OS.g_signal_handlers_block_matched (bufferHandle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, CHANGED);
 		OS.g_signal_handlers_block_matched (bufferHandle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, DELETE_RANGE);
 		byte [] start = new byte [ITER_SIZEOF], end = new byte [ITER_SIZEOF];
-		byte [] startIter =  new byte [ITER_SIZEOF], endIter =  new byte [ITER_SIZEOF];
 		for (int i = 0; i < nSegments; i++) {
-			OS.gtk_text_buffer_get_bounds (bufferHandle, startIter, endIter);
-			long /*int*/ ptr = OS.gtk_text_buffer_get_text (bufferHandle, startIter, endIter, true);
-			OS.gtk_text_buffer_get_iter_at_offset (bufferHandle, start, (int)/*64*/OS.g_utf16_offset_to_utf8_offset (ptr, segments[i]));
-			OS.gtk_text_buffer_get_iter_at_offset (bufferHandle, end, (int)/*64*/OS.g_utf16_offset_to_utf8_offset (ptr, segments[i] + 1));
+			OS.gtk_text_buffer_get_iter_at_offset (bufferHandle, start, (int)/*64*/OS.swt_offset_index_utf16_to_utf8 (offsetIndex, segments[i]));
+			OS.gtk_text_buffer_get_iter_at_offset (bufferHandle, end, (int)/*64*/OS.swt_offset_index_utf16_to_utf8 (offsetIndex, segments[i] + 1));
 			OS.gtk_text_buffer_delete (bufferHandle, start, end);
-			OS.g_free (ptr);
 		}
 		OS.g_signal_handlers_unblock_matched (bufferHandle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, DELETE_RANGE);
 		OS.g_signal_handlers_unblock_matched (bufferHandle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, CHANGED);
@@ -895,11 +882,7 @@ public int getCaretPosition () {
 		byte [] position = new byte [ITER_SIZEOF];
 		long /*int*/ mark = OS.gtk_text_buffer_get_insert (bufferHandle);
 		OS.gtk_text_buffer_get_iter_at_mark (bufferHandle, position, mark);
-		byte [] zero = new byte [ITER_SIZEOF];
-		OS.gtk_text_buffer_get_iter_at_offset(bufferHandle, zero, 0);
-		long /*int*/ ptr = OS.gtk_text_buffer_get_text (bufferHandle, zero, position, true);
-		result = (int)/*64*/OS.g_utf8_offset_to_utf16_offset (ptr, OS.gtk_text_iter_get_offset (position));
-		OS.g_free (ptr);
+		result = (int)/*64*/OS.swt_offset_index_utf8_to_utf16 (offsetIndex, OS.gtk_text_iter_get_offset (position));
 	}
 	return untranslateOffset (result);
 }
@@ -924,9 +907,7 @@ public int getCharCount () {
 		byte [] startIter =  new byte [ITER_SIZEOF];
 		byte [] endIter =  new byte [ITER_SIZEOF];
 		OS.gtk_text_buffer_get_bounds (bufferHandle, startIter, endIter);
-		long /*int*/ ptr = OS.gtk_text_buffer_get_text (bufferHandle, startIter, endIter, true);
-		result = (int)/*64*/OS.g_utf16_strlen(ptr, -1);
-		OS.g_free (ptr);
+		result = (int)/*64*/OS.swt_offset_index_utf8_to_utf16 (offsetIndex, OS.gtk_text_iter_get_offset (endIter));
 	}
 	return untranslateOffset (result);
 }
@@ -1102,11 +1083,7 @@ public int getOrientation () {
 	} else {
 		byte [] p = new byte [ITER_SIZEOF];
 		OS.gtk_text_view_get_iter_at_location (handle, p, point.x, point.y);
-		byte [] zero = new byte [ITER_SIZEOF];
-		OS.gtk_text_buffer_get_iter_at_offset(bufferHandle, zero, 0);
-		long /*int*/ ptr = OS.gtk_text_buffer_get_text (bufferHandle, zero, p, true);
-		position = (int)/*64*/OS.g_utf8_offset_to_utf16_offset (ptr, OS.gtk_text_iter_get_offset (p));
-		OS.g_free (ptr);
+		position = (int)/*64*/OS.swt_offset_index_utf8_to_utf16 (offsetIndex, OS.gtk_text_iter_get_offset (p));
 	}
 	return untranslateOffset (position);
 }
@@ -1144,12 +1121,8 @@ public Point getSelection () {
 		byte [] startIter =  new byte [ITER_SIZEOF];
 		byte [] endIter =  new byte [ITER_SIZEOF];
 		OS.gtk_text_buffer_get_selection_bounds (bufferHandle, startIter, endIter);
-		byte [] zero = new byte [ITER_SIZEOF];
-		OS.gtk_text_buffer_get_iter_at_offset(bufferHandle, zero, 0);
-		long /*int*/ ptr = OS.gtk_text_buffer_get_text (bufferHandle, zero, endIter, true);
-		int start = (int)/*64*/OS.g_utf8_offset_to_utf16_offset (ptr, OS.gtk_text_iter_get_offset (startIter));
-		int end = (int)/*64*/OS.g_utf8_offset_to_utf16_offset (ptr, OS.gtk_text_iter_get_offset (endIter));
-		OS.g_free (ptr);
+		int start = (int)/*64*/OS.swt_offset_index_utf8_to_utf16 (offsetIndex, OS.gtk_text_iter_get_offset (startIter));
+		int end = (int)/*64*/OS.swt_offset_index_utf8_to_utf16 (offsetIndex, OS.gtk_text_iter_get_offset (endIter));
 		selection = new Point (start, end);
 	}
 	selection.x = untranslateOffset (selection.x);
@@ -1504,12 +1477,8 @@ long /*int*/ gtk_delete_range (long /*int*/ widget, long /*int*/ iter1, long /*i
 	OS.memmove (endIter, iter2, endIter.length);
 	int start = OS.gtk_text_iter_get_offset (startIter);
 	int end = OS.gtk_text_iter_get_offset (endIter);
-	byte [] zero = new byte [ITER_SIZEOF];
-	OS.gtk_text_buffer_get_iter_at_offset(bufferHandle, zero, 0);
-	long /*int*/ ptr = OS.gtk_text_buffer_get_text (bufferHandle, zero, endIter, true);
-	start = (int)/*64*/OS.g_utf8_offset_to_utf16_offset (ptr, start);
-	end = (int)/*64*/OS.g_utf8_offset_to_utf16_offset (ptr, end);
-	OS.g_free (ptr);
+	start = (int)/*64*/OS.swt_offset_index_utf8_to_utf16 (offsetIndex, start);
+	end = (int)/*64*/OS.swt_offset_index_utf8_to_utf16 (offsetIndex, end);
 	String newText = verifyText ("", start, end);
 	if (newText == null) {
 		/* Remember the selection when the text was deleted */
@@ -1818,12 +1787,8 @@ long /*int*/ gtk_text_buffer_insert_text (long /*int*/ widget, long /*int*/ iter
 		end = fixEnd;
 		fixStart = fixEnd = -1;
 	}
-	byte [] zero = new byte [ITER_SIZEOF];
-	OS.gtk_text_buffer_get_iter_at_offset(bufferHandle, zero, 0);
-	long /*int*/ ptr = OS.gtk_text_buffer_get_text (bufferHandle, zero, position, true);
-	start = (int)/*64*/OS.g_utf8_offset_to_utf16_offset (ptr, start);
-	end = (int)/*64*/OS.g_utf8_offset_to_utf16_offset (ptr, end);
-	OS.g_free(ptr);
+	start = (int)/*64*/OS.swt_offset_index_utf8_to_utf16 (offsetIndex, start);
+	end = (int)/*64*/OS.swt_offset_index_utf8_to_utf16 (offsetIndex, end);
 	byte [] buffer = new byte [(int)/*64*/length];
 	OS.memmove (buffer, text, buffer.length);
 	String oldText = new String (Converter.mbcsToWcs (null, buffer));
@@ -1881,6 +1846,7 @@ void hookEvents () {
 	OS.g_signal_connect_closure (handle, OS.move_cursor, display.getClosure (MOVE_CURSOR), false);
 	OS.g_signal_connect_closure (handle, OS.move_cursor, display.getClosure (MOVE_CURSOR_INVERSE), true);
 	OS.g_signal_connect_closure (handle, OS.direction_changed, display.getClosure (DIRECTION_CHANGED), true);
+	updateMutedSignals ();
 }
 
 long /*int*/ imContext () {
@@ -1991,6 +1957,8 @@ void register () {
 void releaseWidget () {
 	super.releaseWidget ();
 	fixIM ();	
+	if (offsetIndex != 0) OS.swt_offset_index_free (offsetIndex);
+	offsetIndex = 0;
 	message = null;
 }
 
@@ -2312,11 +2280,7 @@ public void setSelection (int start) {
 		OS.gtk_editable_set_position (handle, start);
 	} else {
 		byte [] startIter =  new byte [ITER_SIZEOF];
-		byte [] endIter =  new byte [ITER_SIZEOF];
-		OS.gtk_text_buffer_get_bounds (bufferHandle, startIter, endIter);
-		long /*int*/ ptr = OS.gtk_text_buffer_get_text (bufferHandle, startIter, endIter, true);
-		start = (int)/*64*/OS.g_utf16_offset_to_utf8_offset (ptr, start);
-		OS.g_free (ptr);
+		start = (int)/*64*/OS.swt_offset_index_utf16_to_utf8 (offsetIndex, start);
 		OS.gtk_text_buffer_get_iter_at_offset (bufferHandle, startIter, start);
 		OS.gtk_text_buffer_place_cursor (bufferHandle, startIter);
 		long /*int*/ mark = OS.gtk_text_buffer_get_insert (bufferHandle);
@@ -2362,11 +2326,8 @@ public void setSelection (int start, int end) {
 	} else {
 		byte [] startIter =  new byte [ITER_SIZEOF];
 		byte [] endIter =  new byte [ITER_SIZEOF];
-		OS.gtk_text_buffer_get_bounds (bufferHandle, startIter, endIter);
-		long /*int*/ ptr = OS.gtk_text_buffer_get_text (bufferHandle, startIter, endIter, true);
-		start = (int)/*64*/OS.g_utf16_offset_to_utf8_offset (ptr, start);
-		end = (int)/*64*/OS.g_utf16_offset_to_utf8_offset (ptr, end);
-		OS.g_free (ptr);
+		start = (int)/*64*/OS.swt_offset_index_utf16_to_utf8 (offsetIndex, start);
+		end = (int)/*64*/OS.swt_offset_index_utf16_to_utf8 (offsetIndex, end);
 		OS.gtk_text_buffer_get_iter_at_offset (bufferHandle, startIter, start);
 		OS.gtk_text_buffer_get_iter_at_offset (bufferHandle, endIter, end);
 		OS.gtk_text_buffer_select_range(bufferHandle, startIter, endIter);
@@ -2525,18 +2486,8 @@ void setText (char [] text) {
 		OS.g_signal_handlers_unblock_matched (handle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, INSERT_TEXT);
 	} else {
 		byte [] buffer = Converter.wcsToMbcs (null, text, false);
-		byte [] position =  new byte [ITER_SIZEOF];
-		OS.g_signal_handlers_block_matched (bufferHandle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, CHANGED);
-		OS.g_signal_handlers_block_matched (bufferHandle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, DELETE_RANGE);
-		OS.g_signal_handlers_block_matched (bufferHandle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, TEXT_BUFFER_INSERT_TEXT);
-		OS.gtk_text_buffer_set_text (bufferHandle, buffer, buffer.length);
-		OS.g_signal_handlers_unblock_matched (bufferHandle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, CHANGED);
-		OS.g_signal_handlers_unblock_matched (bufferHandle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, DELETE_RANGE);
-		OS.g_signal_handlers_unblock_matched (bufferHandle, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, TEXT_BUFFER_INSERT_TEXT);
-		OS.gtk_text_buffer_get_iter_at_offset (bufferHandle, position, 0);
-		OS.gtk_text_buffer_place_cursor (bufferHandle, position);
-		long /*int*/ mark = OS.gtk_text_buffer_get_insert (bufferHandle);
-		OS.gtk_text_view_scroll_mark_onscreen (handle, mark);
+		/* Replaces the text with the signals of the buffer held */
+		OS.swt_text_buffer_insert (bufferHandle, handle, buffer, buffer.length, true);
 	}
 	sendEvent (SWT.Modify);
 	if ((style & SWT.SEARCH) != 0) {
@@ -2674,6 +2625,21 @@ int untranslateOffset (int offset) {
 	return offset;
 }
 
+@Override
+void updateMutedSignals () {
+	/* The text signals are only handled to send SWT.Verify */
+	boolean mute = !hooks (SWT.Verify);
+	if ((style & SWT.SINGLE) != 0) {
+		if (handle == 0) return;
+		OS.swt_closure_mute (handle, INSERT_TEXT, mute);
+		OS.swt_closure_mute (handle, DELETE_TEXT, mute);
+	} else {
+		if (bufferHandle == 0) return;
+		OS.swt_closure_mute (bufferHandle, TEXT_BUFFER_INSERT_TEXT, mute);
+		OS.swt_closure_mute (bufferHandle, DELETE_RANGE, mute);
+	}
+}
+
 String verifyText (String string, int start, int end) {
 	if (string != null && string.length () == 0 && start == end) return null;
 	Event event = new Event ();
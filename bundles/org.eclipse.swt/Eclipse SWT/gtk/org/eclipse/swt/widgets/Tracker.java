@@ -314,26 +314,19 @@ void drawRectangles (Rectangle [] rects) {
 	if (OS.GTK3) {
 		if (overlay == 0) return;
 		OS.gtk_widget_shape_combine_region (overlay, 0);
-		long /*int*/ region = OS.gdk_region_new ();
-		GdkRectangle rect = new GdkRectangle();
+		/* The top, left, right and bottom edge of each rectangle */
+		int[] edges = new int[rects.length * 16];
 		for (int i = 0; i < rects.length; i++) {
 			Rectangle r = parent != null ? display.map(parent, null, rects[i]) : rects[i];
-			rect.x = r.x;
-			rect.y = r.y;
-			rect.width = r.width + 1;
-			rect.height = 1;
-			OS.gdk_region_union_with_rect(region, rect);
-			rect.width = 1;
-			rect.height = r.height + 1;
-			OS.gdk_region_union_with_rect(region, rect);
-			rect.x = r.x + r.width;
-			OS.gdk_region_union_with_rect(region, rect);
-			rect.x = r.x;
-			rect.y = r.y + r.height;
-			rect.width = r.width + 1;
-			rect.height = 1;
-			OS.gdk_region_union_with_rect(region, rect);
+			int[] rect = {
+				r.x, r.y, r.width + 1, 1,
+				r.x, r.y, 1, r.height + 1,
+				r.x + r.width, r.y, 1, r.height + 1,
+				r.x, r.y + r.height, r.width + 1, 1,
+			};
+			System.arraycopy(rect, 0, edges, i * 16, rect.length);
 		}
+		long /*int*/ region = OS.swt_region_new_rectangles (edges, rects.length * 4);
 		OS.gtk_widget_shape_combine_region (overlay, region);
 		OS.gdk_region_destroy (region);
 		long /*int*/ overlayWindow = OS.gtk_widget_get_window (overlay);
@@ -397,7 +390,15 @@ public boolean getStippled () {
 
 boolean grab () {
 	long /*int*/ cursor = this.cursor != null ? this.cursor.handle : 0;
-	int result = gdk_pointer_grab (window, OS.GDK_OWNERSHIP_NONE, false, OS.GDK_POINTER_MOTION_MASK | OS.GDK_BUTTON_RELEASE_MASK, window, cursor, OS.GDK_CURRENT_TIME);
+	/*
+	* Feature in GTK.  Every pointer motion is queued as a separate
+	* event and each one redraws the rectangles, so a tracker with many
+	* rectangles falls behind the pointer.  The fix is to ask for motion
+	* hints, so that the server sends a single motion event until the
+	* pointer position is queried again in gtk_mouse().
+	*/
+	int mask = OS.GDK_POINTER_MOTION_MASK | OS.GDK_POINTER_MOTION_HINT_MASK | OS.GDK_BUTTON_RELEASE_MASK;
+	int result = gdk_pointer_grab (window, OS.GDK_OWNERSHIP_NONE, false, mask, window, cursor, OS.GDK_CURRENT_TIME);
 	return result == OS.GDK_GRAB_SUCCESS;
 }
 
@@ -90,6 +90,7 @@ public class Tree extends Composite {
 	int drawState, drawFlags;
 	GdkColor drawForeground;
 	boolean ownerDraw, ignoreSize, ignoreAccessibility;
+	long /*int*/ cellCache;
 	
 	static final int ID_COLUMN = 0;
 	static final int CHECKED_COLUMN = 1;
@@ -297,6 +298,9 @@ long /*int*/ cellDataProc (long /*int*/ tree_column, long /*int*/ cell, long /*i
 		setScrollWidth (tree_column, item);
 		ignoreCell = 0;
 	}
+	if (cellCache != 0 && item.cached && !item.isDisposed ()) {
+		OS.swt_cell_cache_add (cellCache, tree_model, iter, item.handle);
+	}
 	return 0;
 }
 
@@ -714,6 +718,14 @@ void createHandle (int index) {
 	if (modelHandle == 0) error (SWT.ERROR_NO_HANDLES);
 	handle = OS.gtk_tree_view_new_with_model (modelHandle);
 	if (handle == 0) error (SWT.ERROR_NO_HANDLES);
+	/*
+	* Answer the cell data function of the items that are already
+	* cached in native code, so that scrolling a virtual tree does
+	* not call into Java for every cell.
+	*/
+	if ((style & SWT.VIRTUAL) != 0) {
+		cellCache = OS.swt_cell_cache_new (display.cellDataProc, handle, Display.SWT_OBJECT_INDEX2, ID_COLUMN);
+	}
 	if ((style & SWT.CHECK) != 0) {
 		checkRenderer = OS.gtk_cell_renderer_toggle_new ();
 		if (checkRenderer == 0) error (SWT.ERROR_NO_HANDLES);
@@ -896,7 +908,11 @@ void createRenderers (long /*int*/ columnHandle, int modelIndex, boolean check,
 			}
 		}
 	}
-	if ((style & SWT.VIRTUAL) != 0 || customDraw || ownerDraw) {
+	if (cellCache != 0) {
+		int background = ownerDraw ? -1 : modelIndex + CELL_BACKGROUND;
+		OS.swt_cell_cache_set_data_func (cellCache, columnHandle, textRenderer, modelIndex + CELL_FOREGROUND, background, modelIndex + CELL_FONT);
+		OS.swt_cell_cache_set_data_func (cellCache, columnHandle, pixbufRenderer, -1, background, -1);
+	} else if (customDraw || ownerDraw) {
 		OS.gtk_tree_view_column_set_cell_data_func (columnHandle, textRenderer, display.cellDataProc, handle, 0);
 		OS.gtk_tree_view_column_set_cell_data_func (columnHandle, pixbufRenderer, display.cellDataProc, handle, 0);
 	}
@@ -2300,6 +2316,7 @@ void releaseItem (TreeItem item, boolean release) {
 	if (index [0] == -1) return;
 	if (release) item.release (false);
 	items [index [0]] = null;
+	if (cellCache != 0) OS.swt_cell_cache_remove (cellCache, modelHandle, item.handle);
 }
 
 void releaseItems (long /*int*/ parentIter) {
@@ -2350,6 +2367,8 @@ void releaseWidget () {
 	modelHandle = 0;
 	if (checkRenderer != 0) OS.g_object_unref (checkRenderer);
 	checkRenderer = 0;
+	if (cellCache != 0) OS.swt_cell_cache_free (cellCache);
+	cellCache = 0;
 	if (imageList != null) imageList.dispose ();
 	if (headerImageList != null) headerImageList.dispose ();
 	imageList = headerImageList = null;
@@ -2403,6 +2422,7 @@ public void removeAll () {
 		if (item != null && !item.isDisposed ()) item.release (false);
 	}
 	items = new TreeItem[4];
+	if (cellCache != 0) OS.swt_cell_cache_clear (cellCache);
 	long /*int*/ selection = OS.gtk_tree_view_get_selection (handle);
 	OS.g_signal_handlers_block_matched (selection, OS.G_SIGNAL_MATCH_DATA, 0, 0, 0, 0, CHANGED);
 	if (fixAccessibility ()) {
@@ -2858,13 +2878,17 @@ void setItemCount (long /*int*/ parentIter, int count) {
 		if (fixAccessibility ()) {
 			ignoreAccessibility = true;
 		}
-		for (int i=itemCount; i<count; i++) {
-			long /*int*/ iter = OS.g_malloc (OS.GtkTreeIter_sizeof ());
-			if (iter == 0) error (SWT.ERROR_NO_HANDLES);
-			OS.gtk_tree_store_append (modelHandle, iter, parentIter);
-			OS.gtk_tree_store_set (modelHandle, iter, ID_COLUMN, -1, -1);
-			OS.g_free (iter);
-		}
+		/*
+		* Add the new rows with a single native call.  When the tree
+		* is empty, the view is detached from the model while the rows
+		* are added, which is safe because there is no selection,
+		* expanded item or scroll position to lose.
+		*/
+		int added = count - itemCount;
+		long /*int*/ [] ids = new long /*int*/ [added];
+		for (int i=0; i<added; i++) ids [i] = -1;
+		long /*int*/ view = parentIter == 0 && itemCount == 0 ? handle : 0;
+		OS.swt_tree_model_insert_rows (view, modelHandle, parentIter, -1, added, 1, new int [] {ID_COLUMN}, ids, null, null);
 		if (fixAccessibility ()) {
 			ignoreAccessibility = false;
 			OS.g_object_notify (handle, OS.model);
@@ -3094,6 +3118,7 @@ void setModel (long /*int*/ newModel) {
 	OS.g_object_unref (modelHandle);
 	modelHandle = newModel;
 	display.addWidget (modelHandle, this);
+	if (cellCache != 0) OS.swt_cell_cache_clear (cellCache);
 	if (fixAccessibility ()) {
 		OS.g_signal_connect_closure (modelHandle, OS.row_inserted, display.getClosure (ROW_INSERTED), true);
 		OS.g_signal_connect_closure (modelHandle, OS.row_deleted, display.getClosure (ROW_DELETED), true);
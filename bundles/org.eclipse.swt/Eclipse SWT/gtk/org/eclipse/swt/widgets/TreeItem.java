@@ -305,6 +305,7 @@ void clear () {
 		}
 	}
 	cached = false;
+	if (parent.cellCache != 0) OS.swt_cell_cache_remove (parent.cellCache, parent.modelHandle, handle);
 	font = null;
 	cellFont = null;
 }
@@ -241,6 +241,7 @@ public Widget (Widget parent, int style) {
 void _addListener (int eventType, Listener listener) {
 	if (eventTable == null) eventTable = new EventTable ();
 	eventTable.hook (eventType, listener);
+	updateMutedSignals ();
 }
 
 /**
@@ -1262,6 +1263,7 @@ public void removeListener (int eventType, Listener listener) {
 	if (listener == null) error (SWT.ERROR_NULL_ARGUMENT);
 	if (eventTable == null) return;
 	eventTable.unhook (eventType, listener);
+	updateMutedSignals ();
 }
 
 /**
@@ -1296,6 +1298,7 @@ protected void removeListener (int eventType, SWTEventListener handler) {
 	if (handler == null) error (SWT.ERROR_NULL_ARGUMENT);
 	if (eventTable == null) return;
 	eventTable.unhook (eventType, handler);
+	updateMutedSignals ();
 }
 
 long /*int*/ rendererGetPreferredWidthProc (long /*int*/ cell, long /*int*/ handle, long /*int*/ minimun_size, long /*int*/ natural_size) {
@@ -2025,6 +2028,14 @@ boolean translateTraversal (int event) {
 	return false;
 }
 
+/*
+* Mutes the signals that are only handled to send an event while
+* the receiver has no listener for it, so that the shared closure
+* returns without calling into Java.
+*/
+void updateMutedSignals () {
+}
+
 long /*int*/ windowProc (long /*int*/ handle, long /*int*/ user_data) {
 	switch ((int)/*64*/user_data) {
 		case ACTIVATE: return gtk_activate (handle);
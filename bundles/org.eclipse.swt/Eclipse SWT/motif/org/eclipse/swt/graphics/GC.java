@@ -955,18 +955,18 @@ void drawImageMask(Image srcImage, int srcX, int srcY, int srcWidth, int srcHeig
 					/* Create color scaled pixmaps */
 					colorPixmap = OS.XCreatePixmap(xDisplay, xDrawable, destWidth, destHeight, depth);
 					int tempGC = OS.XCreateGC(xDisplay, colorPixmap, 0, null);
-					OS.XPutImage(xDisplay, colorPixmap, tempGC, xImagePtr, 0, 0, 0, 0, destWidth, destHeight);
+					Image.putXImage(xDisplay, colorPixmap, tempGC, xImagePtr, 0, 0, destWidth, destHeight);
 					OS.XFreeGC(xDisplay, tempGC);
 			
 					/* Create mask scaled pixmaps */
 					maskPixmap = OS.XCreatePixmap(xDisplay, xDrawable, destWidth, destHeight, 1);
 					tempGC = OS.XCreateGC(xDisplay, maskPixmap, 0, null);
-					OS.XPutImage(xDisplay, maskPixmap, tempGC, xMaskPtr, 0, 0, 0, 0, destWidth, destHeight);
+					Image.putXImage(xDisplay, maskPixmap, tempGC, xMaskPtr, 0, 0, destWidth, destHeight);
 					OS.XFreeGC(xDisplay, tempGC);
 	
-					OS.XDestroyImage(xMaskPtr);
+					Image.destroyXImage(xDisplay, xMaskPtr);
 				}
-				OS.XDestroyImage(xImagePtr);
+				Image.destroyXImage(xDisplay, xImagePtr);
 			}
 			
 			/* Change the source rectangle */
@@ -1066,8 +1066,8 @@ void drawImage(Image srcImage, int srcX, int srcY, int srcWidth, int srcHeight,
 	/* Streching case */
 	int xImagePtr = scalePixmap(xDisplay, srcImage.pixmap, srcX, srcY, srcWidth, srcHeight, destX, destY, destWidth, destHeight, false, false);
 	if (xImagePtr != 0) {
-		OS.XPutImage(xDisplay, xDrawable, handle, xImagePtr, 0, 0, destX, destY, destWidth, destHeight);
-		OS.XDestroyImage(xImagePtr);
+		Image.putXImage(xDisplay, xDrawable, handle, xImagePtr, destX, destY, destWidth, destHeight);
+		Image.destroyXImage(xDisplay, xImagePtr);
 	}
 }
 static int scalePixmap(int display, int pixmap, int srcX, int srcY, int srcWidth, int srcHeight, int destX, int destY, int destWidth, int destHeight, boolean flipX, boolean flipY) {
@@ -1111,18 +1111,12 @@ static int scalePixmap(int display, int pixmap, int srcX, int srcY, int srcWidth
 		case 16:
 		case 24:
 		case 32: {
-			xImagePtr = OS.XCreateImage(display, visual, xSrcImage.depth, OS.ZPixmap, 0, 0, destWidth, destHeight, xSrcImage.bitmap_pad, 0);
+			xImagePtr = Image.createXImage(display, visual, xSrcImage.depth, destWidth, destHeight, xSrcImage.bitmap_pad);
 			if (xImagePtr == 0) return 0;
 			XImage xImage = new XImage();
 			OS.memmove(xImage, xImagePtr, XImage.sizeof);
 			int bufSize = xImage.bytes_per_line * xImage.height;
-			if (bufSize < 0) {
-				OS.XDestroyImage(xImagePtr);
-				return 0;
-			} 
-			int bufPtr = OS.XtMalloc(bufSize);
-			xImage.data = bufPtr;
-			OS.memmove(xImagePtr, xImage, XImage.sizeof);
+			int bufPtr = xImage.data;
 			byte[] buf = new byte[bufSize];
 			ImageData.blit(ImageData.BLIT_SRC,
 				srcData, xSrcImage.bits_per_pixel, xSrcImage.bytes_per_line, xSrcImage.byte_order, 0, 0, srcWidth, srcHeight, 0, 0, 0,
@@ -1323,14 +1323,11 @@ static int putImage(ImageData image, int srcX, int srcY, int srcWidth, int srcHe
 	}
 	
 	/* Depths other than 1 */
-	int xImagePtr = OS.XCreateImage(display, visual, screenDepth, OS.ZPixmap, 0, 0, destWidth, destHeight, image.scanlinePad * 8, 0);
+	int xImagePtr = createXImage(display, visual, screenDepth, destWidth, destHeight, image.scanlinePad * 8);
 	if (xImagePtr == 0) return SWT.ERROR_NO_HANDLES;
 	XImage xImage = new XImage();
 	OS.memmove(xImage, xImagePtr, XImage.sizeof);
 	int bufSize = xImage.bytes_per_line * xImage.height;
-	int bufPtr = OS.XtMalloc(bufSize);
-	xImage.data = bufPtr;
-	OS.memmove(xImagePtr, xImage, XImage.sizeof);
 	byte[] buf = new byte[bufSize];
 	if (palette.isDirect) {
 		if (screenDirect) {
@@ -1362,10 +1359,61 @@ static int putImage(ImageData image, int srcX, int srcY, int srcWidth, int srcHe
 		}
 	}
 	OS.memmove(xImage.data, buf, bufSize);
-	OS.XPutImage(display, drawable, gc, xImagePtr, 0, 0, destX, destY, destWidth, destHeight);
-	OS.XDestroyImage(xImagePtr);
+	putXImage(display, drawable, gc, xImagePtr, destX, destY, destWidth, destHeight);
+	destroyXImage(display, xImagePtr);
 	return 0;
 }
+/**
+ * Create a ZPixmap XImage with room for its pixels, which are going to be
+ * put once.  Over a local connection the pixels are in memory shared with
+ * the X server, so that putting them does not copy them through the socket.
+ * Answers 0 if the image could not be created.
+ */
+static int createXImage(int display, int visual, int depth, int width, int height, int pad) {
+	int xImagePtr = OS.XShmImageCreate(display, visual, depth, width, height);
+	if (xImagePtr != 0) return xImagePtr;
+	xImagePtr = OS.XCreateImage(display, visual, depth, OS.ZPixmap, 0, 0, width, height, pad, 0);
+	if (xImagePtr == 0) return 0;
+	XImage xImage = new XImage();
+	OS.memmove(xImage, xImagePtr, XImage.sizeof);
+	int bufSize = xImage.bytes_per_line * xImage.height;
+	if (bufSize < 0) {
+		OS.XDestroyImage(xImagePtr);
+		return 0;
+	}
+	xImage.data = OS.XtMalloc(bufSize);
+	OS.memmove(xImagePtr, xImage, XImage.sizeof);
+	return xImagePtr;
+}
+/**
+ * Destroy an XImage created by createXImage().
+ */
+static void destroyXImage(int display, int xImagePtr) {
+	if (isSharedXImage(xImagePtr)) {
+		OS.XShmImageDestroy(display, xImagePtr);
+	} else {
+		OS.XDestroyImage(xImagePtr);
+	}
+}
+/*
+* Only XShmCreateImage() sets the obdata of an XImage, to the shared
+* memory segment of its pixels.
+*/
+static boolean isSharedXImage(int xImagePtr) {
+	XImage xImage = new XImage();
+	OS.memmove(xImage, xImagePtr, XImage.sizeof);
+	return xImage.obdata != 0;
+}
+/**
+ * Put the pixels of an XImage created by createXImage() into a drawable.
+ */
+static void putXImage(int display, int drawable, int gc, int xImagePtr, int destX, int destY, int width, int height) {
+	if (isSharedXImage(xImagePtr)) {
+		OS.XShmImagePut(display, drawable, gc, xImagePtr, 0, 0, destX, destY, width, height);
+	} else {
+		OS.XPutImage(display, drawable, gc, xImagePtr, 0, 0, destX, destY, width, height);
+	}
+}
 /**
  * Sets the color to which to map the transparent pixel.
  * <p>
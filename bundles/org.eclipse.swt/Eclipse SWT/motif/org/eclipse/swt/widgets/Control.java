@@ -1853,7 +1853,7 @@ void realizeChildren () {
 			int xDisplay = OS.XtDisplay (handle);
 			if (xDisplay == 0) return;
 			OS.XDefineCursor (xDisplay, xWindow, cursor.handle);
-			OS.XFlush (xDisplay);
+			display.flushLater ();
 		}
 	} else {
 		propagateWidget (false);
@@ -99,6 +99,7 @@ public class Display extends Device {
 	/* Motif Only Public Fields */
 	public int xEvent;
 	int lastSerial;
+	boolean flushPending;
 	
 	/* Windows, Events and Callbacks */
 	Callback windowCallback;
@@ -1228,6 +1229,22 @@ boolean fixKey (int[] keysym, byte[] buffer, int state) {
 	}
 	return isNull;
 }
+/*
+* Flushes the X requests made since the last flush.  Requests made while
+* widgets are realized or events are dispatched call flushLater() instead
+* of XFlush(), so that over a remote connection they go out together at
+* the end of the event loop iteration rather than one write each.  Calls
+* that may be followed by a long operation outside of the event loop, like
+* Control.setCursor() under BusyIndicator, still flush right away.
+*/
+void flushDeferred () {
+	if (!flushPending) return;
+	flushPending = false;
+	OS.XFlush (xDisplay);
+}
+void flushLater () {
+	flushPending = true;
+}
 int focusProc (int w, int client_data, int call_data, int continue_to_dispatch) {
 	Widget widget = getWidget (client_data);
 	if (widget == null) return 0;
@@ -2939,14 +2956,21 @@ public boolean readAndDispatch () {
 			status = OS.XtAppPending (xtContext);
 		}
 		if ((status & OS.XtIMXEvent) != 0) {
-			OS.XtAppNextEvent (xtContext, xEvent);
+			/*
+			* Fold the motion and expose events that are queued behind
+			* this one for the same window into it, so that a burst of
+			* them over a slow connection is dispatched and painted once.
+			*/
+			OS.XtAppNextEventCoalesced (xtContext, xEvent);
 			if (!filterEvent (xEvent)) OS.XtDispatchEvent (xEvent);
 		}
 	}
 	if (events) {
 		runDeferredEvents ();
+		flushDeferred ();
 		return true;
 	}
+	flushDeferred ();
 	return isDisposed () || runAsyncMessages (false);
 }
 static void register (Display display) {
@@ -3710,6 +3734,7 @@ void showToolTip (int handle, String toolTipText) {
 public boolean sleep () {
 	checkDevice ();
 	if (getMessageCount () != 0) return true;
+	flushDeferred ();
 	
 	/*
 	* This code is intentionally commented.
@@ -180,7 +180,7 @@ void realizeChildren () {
 	}
 	if (super.cursor == null && isEnabled ()) {
 		OS.XDefineCursor (xDisplay, xWindow, cursor);
-		OS.XFlush (xDisplay);
+		display.flushLater ();
 	}
 }
 void releaseWidget () {
@@ -2281,7 +2281,7 @@ int XPointerMotion (int w, int client_data, int call_data, int continue_to_dispa
 					} else {
 						OS.XUndefineCursor (xDisplay, xWindow);
 					}
-					OS.XFlush (xDisplay);
+					display.flushLater ();
 					display.resizeMode = mode;
 				}
 			}
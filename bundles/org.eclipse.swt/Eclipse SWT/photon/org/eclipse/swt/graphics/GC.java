@@ -97,6 +97,13 @@ public final class GC extends Resource {
 	static final int DIRTY_LINEJOIN = 1 << 7;
 	static final int DIRTY_XORMODE = 1 << 8;
 	
+	/* The primitives recorded by paint GCs, see OS.PgDrawStream */
+	int[] stream;
+	byte[] streamText;
+	int streamCount, streamTextCount;
+	static final int STREAM_SIZE = 1024;
+	static final int STREAM_TEXT_SIZE = 4096;
+	
 GC() {
 }
 
@@ -393,6 +400,7 @@ public void copyArea(int x, int y, int width, int height, int destX, int destY,
 void destroy() {
 	int flags = OS.PtEnter(0);
 	try {
+		flushStream(true);
 		int clipRects = data.clipRects;
 		if (clipRects != 0) {
 			OS.free(clipRects);
@@ -960,6 +968,15 @@ static int scaleImage(Image image, PhImage_t phImage, int srcX, int srcY, int sr
  */
 public void drawLine (int x1, int y1, int x2, int y2) {
 	if (handle == 0) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
+	if (isStreamed()) {
+		int index = reserveStream(5, 0);
+		stream[index] = OS.DRAW_STREAM_LINE;
+		stream[index + 1] = x1;
+		stream[index + 2] = y1;
+		stream[index + 3] = x2;
+		stream[index + 4] = y2;
+		return;
+	}
 	int flags = OS.PtEnter(0);
 	try {
 		int prevContext = setGC();
@@ -1061,6 +1078,13 @@ public void drawPath(Path path) {
  */
 public void drawPoint (int x, int y) {
 	if (handle == 0) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
+	if (isStreamed()) {
+		int index = reserveStream(3, 0);
+		stream[index] = OS.DRAW_STREAM_PIXEL;
+		stream[index + 1] = x;
+		stream[index + 2] = y;
+		return;
+	}
 	int flags = OS.PtEnter(0);
 	try {
 		int prevContext = setGC();
@@ -1166,6 +1190,11 @@ public void drawPolyline(int[] pointArray) {
  */
 public void drawRectangle (int x, int y, int width, int height) {
 	if (handle == 0) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
+	if (isStreamed()) {
+		// Don't subtract one, so that the bottom/right edges are drawn
+		streamRect(x, y, x + width, y + height, OS.Pg_DRAW_STROKE);
+		return;
+	}
 	int flags = OS.PtEnter(0);
 	try {
 		int prevContext = setGC();
@@ -1291,6 +1320,18 @@ public void drawString (String string, int x, int y, boolean isTransparent) {
 	int drawFlags = OS.Pg_TEXT_LEFT | OS.Pg_TEXT_TOP;
 	if (!isTransparent) drawFlags |= OS.Pg_BACK_FILL;
 	byte[] buffer = Converter.wcsToMbcs(null, string, false);
+	if (isStreamed() && buffer.length <= STREAM_TEXT_SIZE) {
+		int index = reserveStream(6, buffer.length);
+		System.arraycopy(buffer, 0, streamText, streamTextCount, buffer.length);
+		stream[index] = OS.DRAW_STREAM_TEXT;
+		stream[index + 1] = streamTextCount;
+		stream[index + 2] = buffer.length;
+		stream[index + 3] = x;
+		stream[index + 4] = y;
+		stream[index + 5] = drawFlags;
+		streamTextCount += buffer.length;
+		return;
+	}
 
 	int flags = OS.PtEnter(0);
 	try {
@@ -1811,6 +1852,10 @@ public void fillPolygon(int[] pointArray) {
 public void fillRectangle (int x, int y, int width, int height) {
 	if (handle == 0) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
 	if (width == 0 || height == 0) return;
+	if (isStreamed()) {
+		streamRect(x, y, x + width - 1, y + height - 1, OS.Pg_DRAW_FILL);
+		return;
+	}
 	int flags = OS.PtEnter(0);
 	try {
 		int prevContext = setGC();	
@@ -2694,6 +2739,7 @@ public void setBackground (Color color) {
 	if (handle == 0) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
 	if (color == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
 	if (color.isDisposed()) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	flushStream(false);
 	data.background = color.handle;
 	dirtyBits |= DIRTY_BACKGROUND;
 }
@@ -2752,6 +2798,7 @@ public void setClipping (int x, int y, int width, int height) {
 		y = y + height;
 		height = -height;
 	}
+	flushStream(false);
 	int clipRects = data.clipRects;
 	if (clipRects != 0)
 		OS.free(clipRects);
@@ -2815,6 +2862,7 @@ public void setClipping(Path path) {
 public void setClipping (Rectangle rect) {
 	if (handle == 0) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
 	if (rect == null) {
+		flushStream(false);
 		int clipRects = data.clipRects;
 		if (clipRects != 0)
 			OS.free(clipRects);
@@ -2844,6 +2892,7 @@ public void setClipping (Rectangle rect) {
 public void setClipping (Region region) {
 	if (handle == 0) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
 	if (region != null && region.isDisposed()) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	flushStream(false);
 	int clipRects = data.clipRects;
 	int clipRectsCount = data.clipRectsCount;
 	if (clipRects != 0)
@@ -2910,6 +2959,7 @@ public void setFillRule(int rule) {
 public void setFont (Font font) {
 	if (handle == 0) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
 	if (font != null && font.isDisposed()) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	flushStream(false);
 	data.font = font == null ? data.device.systemFont : font;
 	dirtyBits |= DIRTY_FONT;
 }
@@ -2932,6 +2982,7 @@ public void setForeground (Color color) {
 	if (handle == 0) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
 	if (color == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
 	if (color.isDisposed()) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	flushStream(false);
 	data.foreground = color.handle;
 	dirtyBits |= DIRTY_FOREGROUND;
 }
@@ -3060,6 +3111,7 @@ public void setLineCap(int cap) {
 		default:
 			SWT.error(SWT.ERROR_INVALID_ARGUMENT);
 	}
+	flushStream(false);
 	data.lineCap = cap;
 	dirtyBits |= DIRTY_LINECAP;
 }
@@ -3083,6 +3135,7 @@ public void setLineCap(int cap) {
  */
 public void setLineDash(int[] dashes) {
 	if (handle == 0) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
+	flushStream(false);
 	if (dashes != null && dashes.length != 0) {
 		byte[] dashList = new byte[dashes.length];
 		for (int i = 0; i < dashes.length; i++) {
@@ -3123,6 +3176,7 @@ public void setLineJoin(int join) {
 		default:
 			SWT.error(SWT.ERROR_INVALID_ARGUMENT);
 	}
+	flushStream(false);
 	data.lineJoin = join;
 	dirtyBits |= DIRTY_LINEJOIN;
 }
@@ -3158,6 +3212,7 @@ public void setLineStyle(int lineStyle) {
 			SWT.error (SWT.ERROR_INVALID_ARGUMENT);
 			return;
 	}
+	flushStream(false);
 	data.lineStyle = lineStyle;
 	dirtyBits |= DIRTY_LINESTYLE;
 }
@@ -3182,11 +3237,13 @@ public void setLineStyle(int lineStyle) {
  */
 public void setLineWidth(int lineWidth) {
 	if (handle == 0) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
+	flushStream(false);
 	data.lineWidth = lineWidth;
 	dirtyBits |= DIRTY_LINEWIDTH;
 }
 
 int setGC() {
+	flushStream(false);
 	int result = 0;
 	if (data.image != null) result = OS.PmMemStart(handle);
 	else if (data.rid == OS.Ph_DEV_RID || data.widget != 0) result = OS.PgSetGC(handle);
@@ -3250,6 +3307,53 @@ int setGC() {
 	return result;
 }
 
+/*
+* Paint GCs record lines, points, rectangles and strings and draw them in
+* one call to PgDrawStream when they draw anything else, their state
+* changes or they are disposed.  Images are always drawn at once since
+* their pixels may change or be freed before the stream is drawn.
+*/
+void flushStream(boolean flush) {
+	if (streamCount == 0) return;
+	int count = streamCount, textCount = streamTextCount;
+	streamCount = streamTextCount = 0;
+	int flags = OS.PtEnter(0);
+	try {
+		int prevContext = setGC();
+		setGCTranslation();
+		setGCClipping();
+		OS.PgDrawStream(stream, count, streamText, textCount, flush);
+		unsetGC(prevContext);
+	} finally {
+		if (flags >= 0) OS.PtLeave(flags);
+	}
+}
+
+boolean isStreamed() {
+	return data.paint && data.image == null && !data.xorMode;
+}
+
+int reserveStream(int count, int textCount) {
+	if (stream == null) stream = new int[STREAM_SIZE];
+	if (textCount > 0 && streamText == null) streamText = new byte[STREAM_TEXT_SIZE];
+	if (streamCount + count > stream.length || streamTextCount + textCount > STREAM_TEXT_SIZE) {
+		flushStream(false);
+	}
+	int index = streamCount;
+	streamCount += count;
+	return index;
+}
+
+void streamRect(int ulx, int uly, int lrx, int lry, int drawFlags) {
+	int index = reserveStream(6, 0);
+	stream[index] = OS.DRAW_STREAM_RECT;
+	stream[index + 1] = ulx;
+	stream[index + 2] = uly;
+	stream[index + 3] = lrx;
+	stream[index + 4] = lry;
+	stream[index + 5] = drawFlags;
+}
+
 void setGCClipping() {
 	int rid = data.rid;
     int widget = data.widget;
@@ -3515,6 +3619,7 @@ public void setTransform(Transform transform) {
  */
 public void setXORMode(boolean xor) {
 	if (handle == 0) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
+	flushStream(false);
 	data.xorMode = xor;
 	dirtyBits |= DIRTY_XORMODE;
 }
@@ -781,7 +781,9 @@ int drawProc (int widget, int damage) {
 			event.height = tile.rect_lr_y - tile.rect_ul_y + 1;
 			event.x = tile.rect_ul_x;
 			event.y = tile.rect_ul_y; 
-			GC gc = event.gc = new GC (this);
+			GCData data = new GCData ();
+			data.paint = true;
+			GC gc = event.gc = GC.photon_new (this, data);
 			gc.setClipping(event.x, event.y, event.width, event.height);
 			sendEvent (SWT.Paint, event);
 			if (isDisposed ()) break;
@@ -806,7 +808,9 @@ int drawProc (int widget, int damage) {
 			event.y = widRect.ul_y; 
 			event.width = widRect.lr_x - widRect.ul_x + 1;
 			event.height = widRect.lr_y - widRect.ul_y + 1;
-            GC gc = event.gc = new GC (this);
+            GCData data = new GCData ();
+            data.paint = true;
+            GC gc = event.gc = GC.photon_new (this, data);
             gc.setClipping(event.x, event.y, event.width, event.height );
 			sendEvent (SWT.Paint, event);
 			gc.dispose ();
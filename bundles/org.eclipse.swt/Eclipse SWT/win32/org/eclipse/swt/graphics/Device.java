@@ -58,6 +58,10 @@ public abstract class Device implements Drawable {
 	TEXTMETRIC metrics;
 	int[] pixels;
 
+	/* Font List Cache */
+	java.util.Hashtable fontLists;
+	long fontListStamp;
+
 	/* Scripts */
 	long /*int*/ [] scripts;
 
@@ -66,6 +70,14 @@ public abstract class Device implements Drawable {
 	long /*int*/ fontCollection;
 	String[] loadedFonts;
 
+	/* Glyph placement cache for GC.drawText() */
+	static final int GLYPH_CACHE_SIZE = 64;
+	long /*int*/ [] glyphCacheFonts;
+	String [] glyphCacheTexts;
+	boolean [] glyphCacheMirrored;
+	Object [][] glyphCacheRuns;
+	int glyphCacheNext;
+
 	boolean disposed;
 
 	/*
@@ -318,6 +330,22 @@ void dispose_Object (Object object) {
 	}
 }
 
+/*
+ * Forgets the glyph runs cached for the font, since its
+ * handle may be reused for a different font once it has
+ * been deleted.
+ */
+void flushGlyphRuns (long /*int*/ hFont) {
+	if (glyphCacheFonts == null) return;
+	for (int i = 0; i < GLYPH_CACHE_SIZE; i++) {
+		if (glyphCacheFonts [i] == hFont) {
+			glyphCacheFonts [i] = 0;
+			glyphCacheTexts [i] = null;
+			glyphCacheRuns [i] = null;
+		}
+	}
+}
+
 long /*int*/ EnumFontFamProc (long /*int*/ lpelfe, long /*int*/ lpntme, long /*int*/ FontType, long /*int*/ lParam) {
 	boolean isScalable = ((int)/*64*/FontType & OS.RASTER_FONTTYPE) == 0;
 	boolean scalable = lParam == 1;
@@ -486,7 +514,58 @@ public Point getDPI () {
  */
 public FontData [] getFontList (String faceName, boolean scalable) {
 	checkDevice ();
-	
+
+	/*
+	* Enumerating the fonts is slow on machines with many fonts
+	* installed, so the lists are kept until the fonts change.  The
+	* installed fonts are registered in the Fonts key of the registry,
+	* so its last write time tells when the cached lists are stale.
+	*/
+	long stamp = getFontListStamp ();
+	if (stamp == 0) return enumerateFonts (faceName, scalable);
+	if (fontLists == null || stamp != fontListStamp) {
+		fontLists = new java.util.Hashtable ();
+		fontListStamp = stamp;
+	}
+	String key = (scalable ? "S" : "B") + (faceName != null ? "|" + faceName : ""); //$NON-NLS-1$ //$NON-NLS-2$ //$NON-NLS-3$
+	FontData [] list = (FontData []) fontLists.get (key);
+	if (list == null) {
+		list = enumerateFonts (faceName, scalable);
+		fontLists.put (key, list);
+	}
+	FontData [] result = new FontData [list.length];
+	for (int i=0; i<list.length; i++) {
+		result [i] = FontData.win32_new (copyLogFont (list [i].data), list [i].height);
+	}
+	return result;
+}
+
+LOGFONT copyLogFont (LOGFONT data) {
+	LOGFONT logFont = OS.IsUnicode ? (LOGFONT) new LOGFONTW () : new LOGFONTA ();
+	logFont.lfHeight = data.lfHeight;
+	logFont.lfWidth = data.lfWidth;
+	logFont.lfEscapement = data.lfEscapement;
+	logFont.lfOrientation = data.lfOrientation;
+	logFont.lfWeight = data.lfWeight;
+	logFont.lfItalic = data.lfItalic;
+	logFont.lfUnderline = data.lfUnderline;
+	logFont.lfStrikeOut = data.lfStrikeOut;
+	logFont.lfCharSet = data.lfCharSet;
+	logFont.lfOutPrecision = data.lfOutPrecision;
+	logFont.lfClipPrecision = data.lfClipPrecision;
+	logFont.lfQuality = data.lfQuality;
+	logFont.lfPitchAndFamily = data.lfPitchAndFamily;
+	if (OS.IsUnicode) {
+		char [] faceName = ((LOGFONTW) data).lfFaceName;
+		System.arraycopy (faceName, 0, ((LOGFONTW) logFont).lfFaceName, 0, faceName.length);
+	} else {
+		byte [] faceName = ((LOGFONTA) data).lfFaceName;
+		System.arraycopy (faceName, 0, ((LOGFONTA) logFont).lfFaceName, 0, faceName.length);
+	}
+	return logFont;
+}
+
+FontData [] enumerateFonts (String faceName, boolean scalable) {
 	/* Create the callback */
 	Callback callback = new Callback (this, "EnumFontFamProc", 4); //$NON-NLS-1$
 	long /*int*/ lpEnumFontFamProc = callback.getAddress ();
@@ -565,6 +644,49 @@ public FontData [] getFontList (String faceName, boolean scalable) {
 	return result;
 }
 
+/*
+ * Returns the last write time of the Fonts keys of the machine
+ * and of the user, or 0 if they cannot be read.
+ */
+long getFontListStamp () {
+	long /*int*/ hHeap = OS.GetProcessHeap ();
+	long /*int*/ lpftLastWriteTime = OS.HeapAlloc (hHeap, OS.HEAP_ZERO_MEMORY, FILETIME.sizeof);
+	if (lpftLastWriteTime == 0) return 0;
+	TCHAR key = new TCHAR (0, "SOFTWARE\\Microsoft\\Windows NT\\CurrentVersion\\Fonts", true); //$NON-NLS-1$
+	long /*int*/ [] roots = {OS.HKEY_LOCAL_MACHINE, OS.HKEY_CURRENT_USER};
+	long stamp = 0;
+	int [] time = new int [2];
+	for (int i=0; i<roots.length; i++) {
+		long /*int*/ [] phkResult = new long /*int*/ [1];
+		if (OS.RegOpenKeyEx (roots [i], key, 0, OS.KEY_READ, phkResult) != 0) {
+			if (i == 0) break;
+			continue;
+		}
+		if (OS.RegQueryInfoKey (phkResult [0], 0, null, 0, null, null, null, null, null, null, null, lpftLastWriteTime) == 0) {
+			OS.MoveMemory (time, lpftLastWriteTime, FILETIME.sizeof);
+			stamp = stamp * 31 + (((long) time [1] << 32) | (time [0] & 0xFFFFFFFFL));
+		}
+		OS.RegCloseKey (phkResult [0]);
+	}
+	OS.HeapFree (hHeap, 0, lpftLastWriteTime);
+	return stamp;
+}
+
+/*
+ * Returns the glyphs, advances and visual order that
+ * GetCharacterPlacement() computed for the text in the
+ * font, or null if they are not cached.
+ */
+Object [] getGlyphRun (long /*int*/ hFont, String text, boolean mirrored) {
+	if (glyphCacheFonts == null) return null;
+	for (int i = 0; i < GLYPH_CACHE_SIZE; i++) {
+		if (glyphCacheFonts [i] == hFont && glyphCacheMirrored [i] == mirrored && text.equals (glyphCacheTexts [i])) {
+			return glyphCacheRuns [i];
+		}
+	}
+	return null;
+}
+
 String getLastError () {
 	int error = OS.GetLastError();
 	if (error == 0) return ""; //$NON-NLS-1$
@@ -833,6 +955,7 @@ public boolean loadFont (String path) {
 		TCHAR lpszFilename = new TCHAR (0, path, true);
 		boolean loaded = OS.AddFontResourceEx (lpszFilename, OS.FR_PRIVATE, 0) != 0;
 		if (loaded) {
+			fontLists = null;
 			if (gdipToken != null) {
 				if (fontCollection == 0) {
 					fontCollection = Gdip.PrivateFontCollection_new();
@@ -871,6 +994,21 @@ void new_Object (Object object) {
 	}
 }
 
+void putGlyphRun (long /*int*/ hFont, String text, boolean mirrored, Object [] run) {
+	if (glyphCacheFonts == null) {
+		glyphCacheFonts = new long /*int*/ [GLYPH_CACHE_SIZE];
+		glyphCacheTexts = new String [GLYPH_CACHE_SIZE];
+		glyphCacheMirrored = new boolean [GLYPH_CACHE_SIZE];
+		glyphCacheRuns = new Object [GLYPH_CACHE_SIZE][];
+	}
+	int index = glyphCacheNext;
+	glyphCacheNext = (glyphCacheNext + 1) % GLYPH_CACHE_SIZE;
+	glyphCacheFonts [index] = hFont;
+	glyphCacheTexts [index] = text;
+	glyphCacheMirrored [index] = mirrored;
+	glyphCacheRuns [index] = run;
+}
+
 void printErrors () {
 	if (!DEBUG) return;
 	if (tracking) {
@@ -948,15 +1086,21 @@ protected void release () {
 			Gdip.PrivateFontCollection_delete(fontCollection);
 		}
 		fontCollection = 0;
+		Gdip.ObjectCache_flush ();
 		Gdip.GdiplusShutdown (gdipToken[0]);
 	}
 	gdipToken = null;
 	scripts = null;
+	glyphCacheFonts = null;
+	glyphCacheTexts = null;
+	glyphCacheMirrored = null;
+	glyphCacheRuns = null;
 	if (hPalette != 0) OS.DeleteObject (hPalette);
 	hPalette = 0;
 	colorRefCount = null;
 	logFonts = null;
 	nFonts = 0;
+	fontLists = null;
 }
 
 /**
@@ -147,7 +147,8 @@ public Font(Device device, String name, int height, int style) {
 	init();	
 }
 void destroy() {
-	OS.DeleteObject(handle);
+	device.flushGlyphRuns(handle);
+	if (!OS.ReleaseCachedFont(handle)) OS.DeleteObject(handle);
 	handle = 0;
 }
 
@@ -206,7 +207,7 @@ void init (FontData fd) {
 	LOGFONT logFont = fd.data;
 	int lfHeight = logFont.lfHeight;
 	logFont.lfHeight = device.computePixels(fd.height);
-	handle = OS.CreateFontIndirect(logFont);
+	handle = OS.IsUnicode ? OS.CreateFontCached((LOGFONTW)logFont) : OS.CreateFontIndirect(logFont);
 	logFont.lfHeight = lfHeight;
 	if (handle == 0) SWT.error(SWT.ERROR_NO_HANDLES);
 }
@@ -99,6 +99,8 @@ public final class GC extends Resource {
 	static final float[] LINE_DASHDOT_ZERO = new float[]{9, 6, 3, 6};
 	static final float[] LINE_DASHDOTDOT_ZERO = new float[]{9, 3, 3, 3, 3, 3};
 
+	static final int GLYPH_CACHE_MAX_LENGTH = 64;
+
 /**
  * Prevents uninitialized instances from being created outside the package.
  */
@@ -186,7 +188,7 @@ void checkGC(int mask) {
 		long /*int*/ pen = data.gdipPen;
 		float width = data.lineWidth;
 		if ((state & FOREGROUND) != 0 || (pen == 0 && (state & (LINE_WIDTH | LINE_STYLE | LINE_MITERLIMIT | LINE_JOIN | LINE_CAP)) != 0)) {
-			if (data.gdipFgBrush != 0) Gdip.SolidBrush_delete(data.gdipFgBrush);
+			if (data.gdipFgBrush != 0) Gdip.SolidBrush_release(data.gdipFgBrush);
 			data.gdipFgBrush = 0;
 			long /*int*/ brush;
 			Pattern pattern = data.foregroundPattern;
@@ -204,11 +206,8 @@ void checkGC(int mask) {
 			} else {
 				int foreground = data.foreground;
 				int rgb = ((foreground >> 16) & 0xFF) | (foreground & 0xFF00) | ((foreground & 0xFF) << 16);
-				long /*int*/ color = Gdip.Color_new(data.alpha << 24 | rgb);
-				if (color == 0) SWT.error(SWT.ERROR_NO_HANDLES);
-				brush = Gdip.SolidBrush_new(color);
+				brush = Gdip.SolidBrush_acquire(data.alpha << 24 | rgb);
 				if (brush == 0) SWT.error(SWT.ERROR_NO_HANDLES);
-				Gdip.Color_delete(color);
 				data.gdipFgBrush = brush;
 			}
 			if (pen != 0) {
@@ -218,7 +217,7 @@ void checkGC(int mask) {
 			}
 		}
 		if ((state & LINE_WIDTH) != 0) {
-			Gdip.Pen_SetWidth(pen, width);
+			Gdip.Pen_updateWidth(pen, width);
 			switch (data.lineStyle) {
 				case SWT.LINE_CUSTOM:
 					state |= LINE_STYLE;
@@ -276,7 +275,7 @@ void checkGC(int mask) {
 			Gdip.Pen_SetLineCap(pen, capStyle, capStyle, dashCap);
 		}
 		if ((state & BACKGROUND) != 0) {
-			if (data.gdipBgBrush != 0) Gdip.SolidBrush_delete(data.gdipBgBrush);
+			if (data.gdipBgBrush != 0) Gdip.SolidBrush_release(data.gdipBgBrush);
 			data.gdipBgBrush = 0;
 			Pattern pattern = data.backgroundPattern;
 			if (pattern != null) {
@@ -293,11 +292,8 @@ void checkGC(int mask) {
 			} else {
 				int background = data.background;
 				int rgb = ((background >> 16) & 0xFF) | (background & 0xFF00) | ((background & 0xFF) << 16);
-				long /*int*/ color = Gdip.Color_new(data.alpha << 24 | rgb);
-				if (color == 0) SWT.error(SWT.ERROR_NO_HANDLES);
-				long /*int*/ brush = Gdip.SolidBrush_new(color);
+				long /*int*/ brush = Gdip.SolidBrush_acquire(data.alpha << 24 | rgb);
 				if (brush == 0) SWT.error(SWT.ERROR_NO_HANDLES);
-				Gdip.Color_delete(color);
 				data.gdipBrush = data.gdipBgBrush = brush;
 			}
 		}
@@ -618,7 +614,7 @@ static void destroyGdipBrush(long /*int*/ brush) {
 	int type = Gdip.Brush_GetType(brush);
 	switch (type) {
 		case Gdip.BrushTypeSolidColor:
-			Gdip.SolidBrush_delete(brush);
+			Gdip.SolidBrush_release(brush);
 			break;
 		case Gdip.BrushTypeHatchFill:
 			Gdip.HatchBrush_delete(brush);
@@ -1384,14 +1380,43 @@ void drawBitmapAlpha(Image srcImage, int srcX, int srcY, int srcWidth, int srcHe
 }
 
 void drawBitmapTransparentByClipping(long /*int*/ srcHdc, long /*int*/ maskHdc, int srcX, int srcY, int srcWidth, int srcHeight, int destX, int destY, int destWidth, int destHeight, boolean simple, int imgWidth, int imgHeight) {
-	/* Create a clipping region from the mask */
-	long /*int*/ rgn = OS.CreateRectRgn(0, 0, 0, 0);
-	for (int y=0; y<imgHeight; y++) {
-		for (int x=0; x<imgWidth; x++) {
-			if (OS.GetPixel(maskHdc, x, y) == 0) {
-				long /*int*/ tempRgn = OS.CreateRectRgn(x, y, x+1, y+1);
-				OS.CombineRgn(rgn, rgn, tempRgn, OS.RGN_OR);
-				OS.DeleteObject(tempRgn);
+	/* Create a clipping region from the runs of opaque pixels of the mask */
+	long /*int*/ rgn = 0;
+	if (!OS.IsWinCE) {
+		int[] rects = new int[64];
+		int count = 0;
+		for (int y=0; y<imgHeight; y++) {
+			int x = 0;
+			while (x < imgWidth) {
+				if (OS.GetPixel(maskHdc, x, y) != 0) {
+					x++;
+					continue;
+				}
+				int start = x;
+				while (x < imgWidth && OS.GetPixel(maskHdc, x, y) == 0) x++;
+				if ((count + 1) * 4 > rects.length) {
+					int[] newRects = new int[rects.length * 2];
+					System.arraycopy(rects, 0, newRects, 0, count * 4);
+					rects = newRects;
+				}
+				rects[count * 4] = start;
+				rects[count * 4 + 1] = y;
+				rects[count * 4 + 2] = x - start;
+				rects[count * 4 + 3] = 1;
+				count++;
+			}
+		}
+		rgn = OS.CreateRectRgnBatch(rects, count);
+	}
+	if (rgn == 0) {
+		rgn = OS.CreateRectRgn(0, 0, 0, 0);
+		for (int y=0; y<imgHeight; y++) {
+			for (int x=0; x<imgWidth; x++) {
+				if (OS.GetPixel(maskHdc, x, y) == 0) {
+					long /*int*/ tempRgn = OS.CreateRectRgn(x, y, x+1, y+1);
+					OS.CombineRgn(rgn, rgn, tempRgn, OS.RGN_OR);
+					OS.DeleteObject(tempRgn);
+				}
 			}
 		}
 	}
@@ -2460,37 +2485,29 @@ RectF drawText(long /*int*/ gdipGraphics, char[] buffer, int start, int length,
 		}
 		return bounds;
 	}
-	int nGlyphs = (length * 3 / 2) + 16;
-	GCP_RESULTS result = new GCP_RESULTS();
-	result.lStructSize = GCP_RESULTS.sizeof;
-	result.nGlyphs = nGlyphs;
-	long /*int*/ hHeap = OS.GetProcessHeap();
-	long /*int*/ lpDx = result.lpDx = OS.HeapAlloc(hHeap, OS.HEAP_ZERO_MEMORY, nGlyphs * 4);
-	long /*int*/ lpGlyphs = result.lpGlyphs = OS.HeapAlloc(hHeap, OS.HEAP_ZERO_MEMORY, nGlyphs * 2);
-	long /*int*/ lpOrder = 0;
-	int dwFlags = OS.GCP_GLYPHSHAPE | OS.GCP_REORDER | OS.GCP_LIGATE;
-	if (drawMnemonic) {
-		lpOrder = result.lpOrder = OS.HeapAlloc(hHeap, OS.HEAP_ZERO_MEMORY, nGlyphs * 4);
-	}
-	long /*int*/ hdc = Gdip.Graphics_GetHDC(gdipGraphics);
 	long /*int*/ hFont = data.hGDIFont;
 	if (hFont == 0 && data.font != null) hFont = data.font.handle;
-	long /*int*/ oldFont = 0;
-	if (hFont != 0) oldFont = OS.SelectObject(hdc, hFont);
-	if (start != 0) {
-		char[] temp = new char[length];
-		System.arraycopy(buffer, start, temp, 0, length);
-		buffer = temp;
-	}
-	if ((data.style & SWT.MIRRORED) != 0) OS.SetLayout(hdc, OS.GetLayout(hdc) | OS.LAYOUT_RTL);
-	OS.GetCharacterPlacementW(hdc, buffer, length, 0, result, dwFlags);
-	if ((data.style & SWT.MIRRORED) != 0) OS.SetLayout(hdc, OS.GetLayout(hdc) & ~OS.LAYOUT_RTL);
-	if (hFont != 0) OS.SelectObject(hdc, oldFont);
-	Gdip.Graphics_ReleaseHDC(gdipGraphics, hdc);
-	nGlyphs = result.nGlyphs;
+	boolean mirrored = (data.style & SWT.MIRRORED) != 0;
+	/*
+	* Placing the glyphs needs the HDC of the graphics, which makes GDI+
+	* flush, and GetCharacterPlacement() shapes the text on every call.
+	* Short strings like labels and numbers are drawn over and over, so
+	* their placement is cached in the device.
+	*/
+	String text = length <= GLYPH_CACHE_MAX_LENGTH ? new String(buffer, start, length) : null;
+	Object[] run = text != null ? device.getGlyphRun(hFont, text, mirrored) : null;
+	if (run == null) {
+		run = getGlyphRun(gdipGraphics, hFont, buffer, start, length, mirrored);
+		if (text != null) device.putGlyphRun(hFont, text, mirrored, run);
+	}
+	char[] glyphs = (char[])run[0];
+	int[] dx = (int[])run[1];
+	int[] order = (int[])run[2];
+	int nGlyphs = glyphs.length;
+	long /*int*/ hHeap = OS.GetProcessHeap();
+	long /*int*/ lpGlyphs = OS.HeapAlloc(hHeap, 0, Math.max(1, nGlyphs) * 2);
+	OS.MoveMemory(lpGlyphs, glyphs, nGlyphs * 2);
 	int drawX = x, drawY = y + lptm.tmAscent;
-	int[] dx = new int[nGlyphs];
-	OS.MoveMemory(dx, result.lpDx, nGlyphs * 4);
 	float[] points = new float[dx.length * 2];
 	for (int i = 0, j = 0; i < dx.length; i++) {
 		points[j++] = drawX;
@@ -2523,7 +2540,7 @@ RectF drawText(long /*int*/ gdipGraphics, char[] buffer, int start, int length,
 			Gdip.Graphics_ScaleTransform(gdipGraphics, -1, 1, Gdip.MatrixOrderPrepend);
 			Gdip.Graphics_TranslateTransform(gdipGraphics, - 2 * x - bounds.Width, 0, Gdip.MatrixOrderPrepend);		 		 		 
 		}
-		Gdip.Graphics_DrawDriverString(gdipGraphics, lpGlyphs, result.nGlyphs, data.gdipFont, brush, points, 0, 0);
+		Gdip.Graphics_DrawDriverString(gdipGraphics, lpGlyphs, nGlyphs, data.gdipFont, brush, points, 0, 0);
 		if ((data.style & SWT.MIRRORED) != 0) {
 			switch (Gdip.Brush_GetType(brush)) {
 				case Gdip.BrushTypeLinearGradient:
@@ -2538,15 +2555,14 @@ RectF drawText(long /*int*/ gdipGraphics, char[] buffer, int start, int length,
 		if (drawMnemonic) {
 			long /*int*/ pen = Gdip.Pen_new(brush, 1);
 			if (pen != 0) {
-				int[] order = new int[1];
-				OS.MoveMemory(order, result.lpOrder + mnemonicIndex * 4, 4);
+				int glyph = order[mnemonicIndex];
 				int mnemonicLeft, mnemonicRight;
 				if ((data.style & SWT.MIRRORED) != 0) {
-					mnemonicLeft = (int)Math.ceil(bounds.Width) - (int)points[order[0] * 2] + 2 * x;
-					mnemonicRight = mnemonicLeft - dx[order[0]];
+					mnemonicLeft = (int)Math.ceil(bounds.Width) - (int)points[glyph * 2] + 2 * x;
+					mnemonicRight = mnemonicLeft - dx[glyph];
 				} else {
-					mnemonicLeft = (int)points[order[0] * 2];
-					mnemonicRight = mnemonicLeft + dx[order[0]];
+					mnemonicLeft = (int)points[glyph * 2];
+					mnemonicRight = mnemonicLeft + dx[glyph];
 				}
 				int mnemonicY = y + lptm.tmAscent + 2;
 				int smoothingMode = Gdip.Graphics_GetSmoothingMode(gdipGraphics);
@@ -2557,9 +2573,7 @@ RectF drawText(long /*int*/ gdipGraphics, char[] buffer, int start, int length,
 			}
 		}
 	}
-	if (lpOrder != 0) OS.HeapFree(hHeap, 0, lpOrder);
 	OS.HeapFree(hHeap, 0, lpGlyphs);
-	OS.HeapFree(hHeap, 0, lpDx);
 	return bounds;
 }
 
@@ -3505,7 +3519,12 @@ public Font getFont () {
 public FontMetrics getFontMetrics() {
 	if (handle == 0) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
 	checkGC(FONT);
-	TEXTMETRIC lptm = OS.IsUnicode ? (TEXTMETRIC)new TEXTMETRICW() : new TEXTMETRICA();
+	if (OS.IsUnicode) {
+		TEXTMETRICW lptm = new TEXTMETRICW();
+		OS.GetTextMetricsCached(handle, lptm);
+		return FontMetrics.win32_new(lptm);
+	}
+	TEXTMETRIC lptm = new TEXTMETRICA();
 	OS.GetTextMetrics(handle, lptm);
 	return FontMetrics.win32_new(lptm);
 }
@@ -3570,6 +3589,46 @@ public GCData getGCData() {
 	return data;
 }
 
+/*
+ * Returns the glyphs, advances and visual order of the characters
+ * that GetCharacterPlacement() computes for the text in the font.
+ */
+Object[] getGlyphRun(long /*int*/ gdipGraphics, long /*int*/ hFont, char[] buffer, int start, int length, boolean mirrored) {
+	int nGlyphs = (length * 3 / 2) + 16;
+	GCP_RESULTS result = new GCP_RESULTS();
+	result.lStructSize = GCP_RESULTS.sizeof;
+	result.nGlyphs = nGlyphs;
+	long /*int*/ hHeap = OS.GetProcessHeap();
+	long /*int*/ lpDx = result.lpDx = OS.HeapAlloc(hHeap, OS.HEAP_ZERO_MEMORY, nGlyphs * 4);
+	long /*int*/ lpGlyphs = result.lpGlyphs = OS.HeapAlloc(hHeap, OS.HEAP_ZERO_MEMORY, nGlyphs * 2);
+	long /*int*/ lpOrder = result.lpOrder = OS.HeapAlloc(hHeap, OS.HEAP_ZERO_MEMORY, nGlyphs * 4);
+	int dwFlags = OS.GCP_GLYPHSHAPE | OS.GCP_REORDER | OS.GCP_LIGATE;
+	long /*int*/ hdc = Gdip.Graphics_GetHDC(gdipGraphics);
+	long /*int*/ oldFont = 0;
+	if (hFont != 0) oldFont = OS.SelectObject(hdc, hFont);
+	if (start != 0) {
+		char[] temp = new char[length];
+		System.arraycopy(buffer, start, temp, 0, length);
+		buffer = temp;
+	}
+	if (mirrored) OS.SetLayout(hdc, OS.GetLayout(hdc) | OS.LAYOUT_RTL);
+	OS.GetCharacterPlacementW(hdc, buffer, length, 0, result, dwFlags);
+	if (mirrored) OS.SetLayout(hdc, OS.GetLayout(hdc) & ~OS.LAYOUT_RTL);
+	if (hFont != 0) OS.SelectObject(hdc, oldFont);
+	Gdip.Graphics_ReleaseHDC(gdipGraphics, hdc);
+	nGlyphs = result.nGlyphs;
+	char[] glyphs = new char[nGlyphs];
+	OS.MoveMemory(glyphs, lpGlyphs, nGlyphs * 2);
+	int[] dx = new int[nGlyphs];
+	OS.MoveMemory(dx, lpDx, nGlyphs * 4);
+	int[] order = new int[length];
+	OS.MoveMemory(order, lpOrder, length * 4);
+	OS.HeapFree(hHeap, 0, lpOrder);
+	OS.HeapFree(hHeap, 0, lpGlyphs);
+	OS.HeapFree(hHeap, 0, lpDx);
+	return new Object[] {glyphs, dx, order};
+}
+
 /** 
  * Returns the receiver's interpolation setting, which will be one of
  * <code>SWT.DEFAULT</code>, <code>SWT.NONE</code>, 
@@ -4137,7 +4196,7 @@ public void setAntialias(int antialias) {
 			SWT.error(SWT.ERROR_INVALID_ARGUMENT);
 	}
 	initGdip();
-	Gdip.Graphics_SetSmoothingMode(data.gdipGraphics, mode);
+	Gdip.Graphics_updateSmoothingMode(data.gdipGraphics, mode);
 }
 
 /**
@@ -4863,7 +4922,7 @@ public void setTextAntialias(int antialias) {
 			SWT.error(SWT.ERROR_INVALID_ARGUMENT);
 	}
 	initGdip();
-	Gdip.Graphics_SetTextRenderingHint(data.gdipGraphics, textMode);
+	Gdip.Graphics_updateTextRenderingHint(data.gdipGraphics, textMode);
 }
 
 /**
@@ -4939,13 +4998,13 @@ public Point stringExtent(String string) {
 	SIZE size = new SIZE();
 	if (length == 0) {
 //		OS.GetTextExtentPoint32(handle, SPACE, SPACE.length(), size);
-		OS.GetTextExtentPoint32W(handle, new char[]{' '}, 1, size);
+		OS.GetTextExtentPoint32Cached(handle, new char[]{' '}, 1, size);
 		return new Point(0, size.cy);
 	} else {
 //		TCHAR buffer = new TCHAR (getCodePage(), string, false);
 		char[] buffer = new char [length];
 		string.getChars(0, length, buffer, 0);
-		OS.GetTextExtentPoint32W(handle, buffer, length, size);
+		OS.GetTextExtentPoint32Cached(handle, buffer, length, size);
 		return new Point(size.cx, size.cy);
 	}
 }
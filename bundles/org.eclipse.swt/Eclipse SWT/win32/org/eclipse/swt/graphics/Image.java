@@ -16,6 +16,7 @@ import org.eclipse.swt.internal.win32.*;
 import org.eclipse.swt.*;
 
 import java.io.*;
+import java.nio.*;
 
 /**
  * Instances of this class are graphics which have been prepared
@@ -925,40 +926,40 @@ long /*int*/ [] createGdipImage() {
 				OS.SelectObject(memHdc, oldMemBitmap);
 				OS.DeleteObject(srcHdc);
 				OS.DeleteObject(memHdc);
-			 	byte[] srcData = new byte[sizeInBytes];
-				OS.MoveMemory(srcData, dibBM.bmBits, sizeInBytes);
+				long /*int*/ hHeap = OS.GetProcessHeap();
+				long /*int*/ pixels = OS.HeapAlloc(hHeap, OS.HEAP_ZERO_MEMORY, sizeInBytes);
+				if (pixels == 0) SWT.error(SWT.ERROR_NO_HANDLES);
+				/* Work on the native pixels directly instead of a Java copy */
+				ByteBuffer srcData = OS.NewDirectByteBuffer(pixels, sizeInBytes);
+				srcData.put(OS.LockDIBits(memDib));
 				OS.DeleteObject(memDib);
 				device.internal_dispose_GC(hDC, null);
 				if (alpha != -1) {
 					for (int y = 0, dp = 0; y < imgHeight; ++y) {
 						for (int x = 0; x < imgWidth; ++x) {
-							srcData[dp + 3] = (byte)alpha;
+							srcData.put(dp + 3, (byte)alpha);
 							dp += 4;
 						}
 					}
 				} else if (alphaData != null) {
 					for (int y = 0, dp = 0, ap = 0; y < imgHeight; ++y) {
 						for (int x = 0; x < imgWidth; ++x) {
-							srcData[dp + 3] = alphaData[ap++];
+							srcData.put(dp + 3, alphaData[ap++]);
 							dp += 4;
 						}
 					}
 				} else if (transparentPixel != -1) {
 					for (int y = 0, dp = 0; y < imgHeight; ++y) {
 						for (int x = 0; x < imgWidth; ++x) {
-							if (srcData[dp] == blue && srcData[dp + 1] == green && srcData[dp + 2] == red) {
-								srcData[dp + 3] = (byte)0;
+							if (srcData.get(dp) == blue && srcData.get(dp + 1) == green && srcData.get(dp + 2) == red) {
+								srcData.put(dp + 3, (byte)0);
 							} else {
-								srcData[dp + 3] = (byte)0xFF;
+								srcData.put(dp + 3, (byte)0xFF);
 							}
 							dp += 4;
 						}
 					}
 				}
-				long /*int*/ hHeap = OS.GetProcessHeap();
-				long /*int*/ pixels = OS.HeapAlloc(hHeap, OS.HEAP_ZERO_MEMORY, srcData.length);
-				if (pixels == 0) SWT.error(SWT.ERROR_NO_HANDLES);
-				OS.MoveMemory(pixels, srcData, sizeInBytes);
 				return new long /*int*/ []{Gdip.Bitmap_new(imgWidth, imgHeight, dibBM.bmWidthBytes, Gdip.PixelFormat32bppARGB, pixels), pixels};
 			}
 			return new long /*int*/ []{Gdip.Bitmap_new(handle, 0), 0};
@@ -1002,17 +1003,21 @@ long /*int*/ [] createGdipImage() {
 			 	OS.BitBlt(memHdc, 0, 0, imgWidth, imgHeight, srcHdc, 0, hBitmap == iconInfo.hbmMask ? imgHeight : 0, OS.SRCCOPY);
 				OS.SelectObject(memHdc, oldMemBitmap);
 				OS.DeleteObject(memHdc);
-			 	byte[] srcData = new byte[dibBM.bmWidthBytes * dibBM.bmHeight];
-				OS.MoveMemory(srcData, dibBM.bmBits, srcData.length);
+				int sizeInBytes = dibBM.bmWidthBytes * dibBM.bmHeight;
+				long /*int*/ hHeap = OS.GetProcessHeap();
+				pixels = OS.HeapAlloc(hHeap, OS.HEAP_ZERO_MEMORY, sizeInBytes);
+				if (pixels == 0) SWT.error(SWT.ERROR_NO_HANDLES);
+				ByteBuffer srcData = OS.NewDirectByteBuffer(pixels, sizeInBytes);
+				srcData.put(OS.LockDIBits(memDib));
 				OS.DeleteObject(memDib);
 				OS.SelectObject(srcHdc, iconInfo.hbmMask);
 				for (int y = 0, dp = 3; y < imgHeight; ++y) {
 					for (int x = 0; x < imgWidth; ++x) {
-						if (srcData[dp] == 0) {
+						if (srcData.get(dp) == 0) {
 							if (OS.GetPixel(srcHdc, x, y) != 0) {
-								srcData[dp] = (byte)0;
+								srcData.put(dp, (byte)0);
 							} else {
-								srcData[dp] = (byte)0xFF;
+								srcData.put(dp, (byte)0xFF);
 							}
 						}
 						dp += 4;
@@ -1021,10 +1026,6 @@ long /*int*/ [] createGdipImage() {
 				OS.SelectObject(srcHdc, oldSrcBitmap);
 				OS.DeleteObject(srcHdc);
 				device.internal_dispose_GC(hDC, null);
-				long /*int*/ hHeap = OS.GetProcessHeap();
-				pixels = OS.HeapAlloc(hHeap, OS.HEAP_ZERO_MEMORY, srcData.length);
-				if (pixels == 0) SWT.error(SWT.ERROR_NO_HANDLES);
-				OS.MoveMemory(pixels, srcData, srcData.length);
 				img = Gdip.Bitmap_new(imgWidth, imgHeight, dibBM.bmWidthBytes, Gdip.PixelFormat32bppARGB, pixels);
 			} else {
 				img = Gdip.Bitmap_new(handle);
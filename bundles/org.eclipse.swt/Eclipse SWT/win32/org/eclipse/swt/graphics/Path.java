@@ -360,6 +360,69 @@ public boolean contains(float x, float y, GC gc, boolean outline) {
 	}
 }
 
+/**
+ * Tests the points, given as x, y pairs, for containment in the receiver
+ * the way <code>contains(float, float, GC, boolean)</code> does, and
+ * returns a mask with bit <code>i % 32</code> of element <code>i / 32</code>
+ * set for each point <code>i</code> that is contained.  When prefilter is
+ * <code>true</code>, points outside of the bounds of the receiver are
+ * rejected without testing the path.
+ * <p>
+ * <b>IMPORTANT:</b> This method is <em>not</em> part of the public
+ * API for <code>Path</code>. It is marked public only so that it
+ * can be shared within the packages provided by SWT. It is not
+ * available on all platforms, and should never be called from
+ * application code.
+ * </p>
+ *
+ * @noreference This method is not intended to be referenced by clients.
+ */
+public int[] internal_contains(float[] points, GC gc, boolean outline, boolean prefilter) {
+	if (isDisposed()) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
+	if (points == null || gc == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
+	if (gc.isDisposed()) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	gc.initGdip();
+	gc.checkGC(GC.LINE_CAP | GC.LINE_JOIN | GC.LINE_STYLE | GC.LINE_WIDTH);
+	int mode = OS.GetPolyFillMode(gc.handle) == OS.WINDING ? Gdip.FillModeWinding : Gdip.FillModeAlternate;
+	int[] mask = new int[(points.length / 2 + 31) / 32];
+	Gdip.GraphicsPath_IsVisiblePoints(handle, points, mode, outline ? gc.data.gdipPen : 0, gc.data.gdipGraphics, prefilter, mask);
+	return mask;
+}
+
+/**
+ * Tests the point for containment in each of the paths the way
+ * <code>contains(float, float, GC, boolean)</code> does, and returns a
+ * mask with bit <code>i % 32</code> of element <code>i / 32</code> set for
+ * each path <code>i</code> that contains it.  When prefilter is
+ * <code>true</code>, paths whose bounds do not contain the point are
+ * rejected without testing them.
+ * <p>
+ * <b>IMPORTANT:</b> This method is <em>not</em> part of the public
+ * API for <code>Path</code>. It is marked public only so that it
+ * can be shared within the packages provided by SWT. It is not
+ * available on all platforms, and should never be called from
+ * application code.
+ * </p>
+ *
+ * @noreference This method is not intended to be referenced by clients.
+ */
+public static int[] internal_contains(Path[] paths, float x, float y, GC gc, boolean outline, boolean prefilter) {
+	if (paths == null || gc == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
+	if (gc.isDisposed()) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+	long /*int*/[] handles = new long /*int*/[paths.length];
+	for (int i = 0; i < paths.length; i++) {
+		if (paths[i] == null) SWT.error(SWT.ERROR_NULL_ARGUMENT);
+		if (paths[i].isDisposed()) SWT.error(SWT.ERROR_INVALID_ARGUMENT);
+		handles[i] = paths[i].handle;
+	}
+	gc.initGdip();
+	gc.checkGC(GC.LINE_CAP | GC.LINE_JOIN | GC.LINE_STYLE | GC.LINE_WIDTH);
+	int mode = OS.GetPolyFillMode(gc.handle) == OS.WINDING ? Gdip.FillModeWinding : Gdip.FillModeAlternate;
+	int[] mask = new int[(paths.length + 31) / 32];
+	Gdip.GraphicsPath_IsVisiblePaths(handles, x, y, mode, outline ? gc.data.gdipPen : 0, gc.data.gdipGraphics, prefilter, mask);
+	return mask;
+}
+
 /**
  * Adds to the receiver a cubic bezier curve based on the parameters.
  *
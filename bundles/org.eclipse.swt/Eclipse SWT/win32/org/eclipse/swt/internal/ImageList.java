@@ -77,6 +77,55 @@ public int add (Image image) {
 	return index;
 }
 
+/*
+* Adds the images in order and answers their indices.  Once the free slots
+* are used, runs of bitmaps that are opaque or have alpha data are appended
+* with a single OS.ImageList_AddBatch() on common controls 6.0, which takes
+* their alpha channel directly.  The other images, and those the batch could
+* not add, are added one at a time.
+*/
+public int [] add (Image [] images) {
+	int [] indices = new int [images.length];
+	int start = 0;
+	while (start < images.length && (OS.IsWinCE || OS.COMCTL32_MAJOR < 6 || hasFreeIndex ())) {
+		indices [start] = add (images [start]);
+		start++;
+	}
+	long /*int*/ [] hBitmaps = new long /*int*/ [images.length - start];
+	byte [][] alphaData = new byte [images.length - start][];
+	int batched = 0;
+	for (int i = start; i <= images.length; i++) {
+		Image image = i < images.length ? images [i] : null;
+		if (image != null && image.type == SWT.BITMAP && OS.ImageList_GetImageCount (handle) != 0) {
+			ImageData data = image.getImageData ();
+			int transparency = data.getTransparencyType ();
+			if (transparency == SWT.TRANSPARENCY_NONE || (transparency == SWT.TRANSPARENCY_ALPHA && data.alphaData != null)) {
+				hBitmaps [batched] = image.handle;
+				alphaData [batched] = transparency == SWT.TRANSPARENCY_ALPHA ? data.alphaData : null;
+				batched++;
+				continue;
+			}
+		}
+		if (batched > 0) {
+			int count = OS.ImageList_GetImageCount (handle);
+			int added = OS.ImageList_AddBatch (handle, hBitmaps, alphaData, batched);
+			for (int j = 0; j < batched; j++) {
+				int index = i - batched + j;
+				if (j < added) {
+					indices [index] = count + j;
+					store (count + j, images [index]);
+				} else {
+					indices [index] = add (images [index]);
+				}
+				alphaData [j] = null;
+			}
+			batched = 0;
+		}
+		if (image != null) indices [i] = add (image);
+	}
+	return indices;
+}
+
 public int addRef() {
 	return ++refCount;
 }
@@ -338,6 +387,15 @@ long /*int*/ createMask (long /*int*/ hBitmap, int destWidth, int destHeight, in
 	return hMask;
 }
 
+boolean hasFreeIndex () {
+	int count = OS.ImageList_GetImageCount (handle);
+	for (int i=0; i<count; i++) {
+		if (images [i] != null && images [i].isDisposed ()) images [i] = null;
+		if (images [i] == null) return true;
+	}
+	return false;
+}
+
 public void dispose () {
 	if (handle != 0) OS.ImageList_Destroy (handle);
 	handle = 0;
@@ -448,6 +506,15 @@ void set (int index, Image image, int count) {
 	}
 }
 
+void store (int index, Image image) {
+	if (index >= images.length) {
+		Image [] newImages = new Image [Math.max (index + 1, images.length + 4)];
+		System.arraycopy (images, 0, newImages, 0, images.length);
+		images = newImages;
+	}
+	images [index] = image;
+}
+
 public int size () {
 	int result = 0;
 	int count = OS.ImageList_GetImageCount (handle);
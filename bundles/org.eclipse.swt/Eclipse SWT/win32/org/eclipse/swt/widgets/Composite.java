@@ -889,6 +889,11 @@ void releaseWidget () {
 			}
 		}
 	}
+	if ((state & CANVAS) != 0 && (style & SWT.DOUBLE_BUFFERED) != 0) {
+		if (!OS.IsWinCE && OS.WIN32_VERSION >= OS.VERSION (6, 0)) {
+			OS.ReleaseCachedPaint (handle);
+		}
+	}
 	layout = null;
 	tabList = null;
 	lpwp = null;
@@ -922,6 +927,27 @@ void resizeChildren () {
 boolean resizeChildren (boolean defer, WINDOWPOS [] pwp) {
 	if (pwp == null) return true;
 	long /*int*/ hdwp = 0;
+	if (defer && !OS.IsWinCE) {
+		/*
+		* Move every child in one native call rather than calling
+		* DeferWindowPos from Java for each of them.
+		*/
+		long [] positions = new long [pwp.length * OS.DEFER_SIZE];
+		int count = 0;
+		for (int i=0; i<pwp.length; i++) {
+			WINDOWPOS wp = pwp [i];
+			if (wp != null) {
+				int index = count++ * OS.DEFER_SIZE;
+				positions [index] = wp.hwnd;
+				positions [index + 1] = wp.x;
+				positions [index + 2] = wp.y;
+				positions [index + 3] = wp.cx;
+				positions [index + 4] = wp.cy;
+				positions [index + 5] = wp.flags;
+			}
+		}
+		return OS.DeferWindowPosBatch (positions, count);
+	}
 	if (defer) {
 		hdwp = OS.BeginDeferWindowPos (pwp.length);
 		if (hdwp == 0) return false;
@@ -1464,7 +1490,9 @@ LRESULT WM_PAINT (long /*int*/ wParam, long /*int*/ lParam) {
 				int flags = OS.BPBF_COMPATIBLEBITMAP;
 				RECT prcTarget = new RECT ();
 				OS.SetRect (prcTarget, ps.left, ps.top, ps.right, ps.bottom);
-				long /*int*/ hBufferedPaint = OS.BeginBufferedPaint (hDC, prcTarget, flags, null, phdc);
+				long /*int*/ hwnd = handle, hBufferedPaint = 0;
+				phdc [0] = OS.BeginCachedPaint (hwnd, hDC, prcTarget);
+				if (phdc [0] == 0) hBufferedPaint = OS.BeginBufferedPaint (hDC, prcTarget, flags, null, phdc);
 				GCData data = new GCData ();
 				data.device = display;
 				data.foreground = getForegroundPixel ();
@@ -1491,7 +1519,11 @@ LRESULT WM_PAINT (long /*int*/ wParam, long /*int*/ lParam) {
 				sendEvent (SWT.Paint, event);
 				if (data.focusDrawn && !isDisposed ()) updateUIState ();
 				gc.dispose ();
-				OS.EndBufferedPaint (hBufferedPaint, true);
+				if (hBufferedPaint != 0) {
+					OS.EndBufferedPaint (hBufferedPaint, true);
+				} else {
+					OS.EndCachedPaint (hwnd, hDC, true);
+				}
 			}
 			OS.EndPaint (handle, ps);
 		} else {
@@ -1807,7 +1839,7 @@ LRESULT wmNCPaint (long /*int*/ hwnd, long /*int*/ wParam, long /*int*/ lParam)
 				rect.left = rect.top = 0;
 				int border = OS.GetSystemMetrics (OS.SM_CXEDGE);
 				OS.ExcludeClipRect (hDC, border, border, rect.right - border, rect.bottom - border);
-				OS.DrawThemeBackground (display.hEditTheme (), hDC, OS.EP_EDITTEXT, OS.ETS_NORMAL, rect, null);
+				OS.DrawThemeBackgroundCached (display.hEditTheme (), hDC, OS.EP_EDITTEXT, OS.ETS_NORMAL, rect, null);
 				OS.ReleaseDC (hwnd, hDC);
 				return new LRESULT (code);
 			}
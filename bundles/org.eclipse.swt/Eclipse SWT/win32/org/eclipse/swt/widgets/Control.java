@@ -5165,7 +5165,7 @@ LRESULT WM_NCPAINT (long /*int*/ wParam, long /*int*/ lParam) {
 
 LRESULT WM_NOTIFY (long /*int*/ wParam, long /*int*/ lParam) {
 	NMHDR hdr = new NMHDR ();
-	OS.MoveMemory (hdr, lParam, NMHDR.sizeof);
+	display.decodeNotify (hdr, lParam);
 	return wmNotify (hdr, wParam, lParam);
 }
 
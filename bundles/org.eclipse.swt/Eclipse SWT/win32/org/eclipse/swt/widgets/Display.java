@@ -11,6 +11,8 @@
 package org.eclipse.swt.widgets;
 
 
+import java.nio.*;
+
 import org.eclipse.swt.internal.*;
 import org.eclipse.swt.internal.win32.*;
 import org.eclipse.swt.*;
@@ -111,6 +113,9 @@ public class Display extends Device {
 	 */
 	public MSG msg = new MSG ();
 
+	/* Notification decoding */
+	ByteBuffer notifyBuffer;
+
 	static String APP_NAME = "SWT"; //$NON-NLS-1$
 	static String APP_VERSION = ""; //$NON-NLS-1$
 	
@@ -820,6 +825,12 @@ public void close () {
 	if (event.doit) dispose ();
 }
 
+void closeThemeData (long /*int*/ hTheme) {
+	if (hTheme == 0) return;
+	OS.FlushThemeCache (hTheme);
+	OS.CloseThemeData (hTheme);
+}
+
 /**
  * Creates the device in the operating system.  If the device
  * does not have a handle, this method may do nothing depending
@@ -836,6 +847,7 @@ protected void create (DeviceData data) {
 	checkSubclass ();
 	checkDisplay (thread = Thread.currentThread (), true);
 	createDisplay (data);
+	if (Watchdog.THRESHOLD > 0) Watchdog.start (Watchdog.THRESHOLD);
 	register (this);
 	if (Default == null) Default = this;
 }
@@ -1177,6 +1189,82 @@ static void deregister (Display display) {
  * @see Device#dispose
  * @see #release
  */
+boolean decodeNotify (long /*int*/ lParam, int kind, int length) {
+	if (notifyBuffer == null) {
+		notifyBuffer = ByteBuffer.allocateDirect (OS.DECODE_SIZE * 8);
+		notifyBuffer.order (ByteOrder.nativeOrder ());
+	}
+	return OS.DecodeNotify (lParam, kind, length, notifyBuffer);
+}
+
+void decodeNotify (NMHDR hdr, long /*int*/ lParam) {
+	if (!decodeNotify (lParam, OS.DECODE_NMHDR, NMHDR.sizeof)) {
+		OS.MoveMemory (hdr, lParam, NMHDR.sizeof);
+		return;
+	}
+	decodeNotify (hdr);
+}
+
+void decodeNotify (NMHDR hdr) {
+	ByteBuffer buffer = notifyBuffer;
+	hdr.hwndFrom = (long /*int*/) buffer.getLong (0);
+	hdr.idFrom = (long /*int*/) buffer.getLong (8);
+	hdr.code = (int) buffer.getLong (16);
+}
+
+void decodeNotify (NMCUSTOMDRAW nmcd) {
+	ByteBuffer buffer = notifyBuffer;
+	decodeNotify ((NMHDR) nmcd);
+	nmcd.dwDrawStage = (int) buffer.getLong (24);
+	nmcd.hdc = (long /*int*/) buffer.getLong (32);
+	nmcd.left = (int) buffer.getLong (40);
+	nmcd.top = (int) buffer.getLong (48);
+	nmcd.right = (int) buffer.getLong (56);
+	nmcd.bottom = (int) buffer.getLong (64);
+	nmcd.dwItemSpec = (long /*int*/) buffer.getLong (72);
+	nmcd.uItemState = (int) buffer.getLong (80);
+	nmcd.lItemlParam = (long /*int*/) buffer.getLong (88);
+}
+
+/*
+* Fill the custom draw structures from the notify buffer in pure Java
+* instead of setting every field of the object from native code.
+*/
+void decodeNotify (NMLVCUSTOMDRAW nmcd, long /*int*/ lParam) {
+	if (!decodeNotify (lParam, OS.DECODE_NMLVCUSTOMDRAW, NMLVCUSTOMDRAW.sizeof)) {
+		OS.MoveMemory (nmcd, lParam, NMLVCUSTOMDRAW.sizeof);
+		return;
+	}
+	ByteBuffer buffer = notifyBuffer;
+	decodeNotify ((NMCUSTOMDRAW) nmcd);
+	nmcd.clrText = (int) buffer.getLong (96);
+	nmcd.clrTextBk = (int) buffer.getLong (104);
+	nmcd.iSubItem = (int) buffer.getLong (112);
+	nmcd.dwItemType = (int) buffer.getLong (120);
+	nmcd.clrFace = (int) buffer.getLong (128);
+	nmcd.iIconEffect = (int) buffer.getLong (136);
+	nmcd.iIconPhase = (int) buffer.getLong (144);
+	nmcd.iPartId = (int) buffer.getLong (152);
+	nmcd.iStateId = (int) buffer.getLong (160);
+	nmcd.rcText_left = (int) buffer.getLong (168);
+	nmcd.rcText_top = (int) buffer.getLong (176);
+	nmcd.rcText_right = (int) buffer.getLong (184);
+	nmcd.rcText_bottom = (int) buffer.getLong (192);
+	nmcd.uAlign = (int) buffer.getLong (200);
+}
+
+void decodeNotify (NMTVCUSTOMDRAW nmcd, long /*int*/ lParam) {
+	if (!decodeNotify (lParam, OS.DECODE_NMTVCUSTOMDRAW, NMTVCUSTOMDRAW.sizeof)) {
+		OS.MoveMemory (nmcd, lParam, NMTVCUSTOMDRAW.sizeof);
+		return;
+	}
+	ByteBuffer buffer = notifyBuffer;
+	decodeNotify ((NMCUSTOMDRAW) nmcd);
+	nmcd.clrText = (int) buffer.getLong (96);
+	nmcd.clrTextBk = (int) buffer.getLong (104);
+	nmcd.iLevel = (int) buffer.getLong (112);
+}
+
 protected void destroy () {
 	if (this == Default) Default = null;
 	deregister (this);
@@ -2467,7 +2555,7 @@ public Font getSystemFont () {
 		info.cbSize = NONCLIENTMETRICS.sizeof;
 		if (OS.SystemParametersInfo (OS.SPI_GETNONCLIENTMETRICS, 0, info, 0)) {
 			LOGFONT logFont = OS.IsUnicode ? (LOGFONT) ((NONCLIENTMETRICSW)info).lfMessageFont : ((NONCLIENTMETRICSA)info).lfMessageFont;
-			hFont = OS.CreateFontIndirect (logFont);
+			hFont = OS.IsUnicode ? OS.CreateFontCached ((LOGFONTW) logFont) : OS.CreateFontIndirect (logFont);
 			lfSystemFont = hFont != 0 ? logFont : null;
 		}
 	}
@@ -3342,11 +3430,11 @@ long /*int*/ messageProc (long /*int*/ hwnd, long /*int*/ msg, long /*int*/ wPar
 		}
 		case OS.WM_THEMECHANGED: {
 			if (OS.COMCTL32_MAJOR >= 6) {
-				if (hButtonTheme != 0) OS.CloseThemeData (hButtonTheme);
-				if (hEditTheme != 0) OS.CloseThemeData (hEditTheme);
-				if (hExplorerBarTheme != 0) OS.CloseThemeData (hExplorerBarTheme);
-				if (hScrollBarTheme != 0) OS.CloseThemeData (hScrollBarTheme);
-				if (hTabTheme != 0) OS.CloseThemeData (hTabTheme);
+				closeThemeData (hButtonTheme);
+				closeThemeData (hEditTheme);
+				closeThemeData (hExplorerBarTheme);
+				closeThemeData (hScrollBarTheme);
+				closeThemeData (hTabTheme);
 				hButtonTheme = hEditTheme = hExplorerBarTheme = hScrollBarTheme = hTabTheme = 0;
 			}
 			break;
@@ -3473,6 +3561,7 @@ long /*int*/ msgFilterProc (long /*int*/ code, long /*int*/ wParam, long /*int*/
 			if (runMessages) {
 				OS.MoveMemory (hookMsg, lParam, MSG.sizeof);
 				if (hookMsg.message == OS.WM_NULL) {
+					if (!OS.IsWinCE && hookMsg.hwnd == 0) OS.ClearWakeMessage ();
 					MSG msg = new MSG ();
 					int flags = OS.PM_NOREMOVE | OS.PM_NOYIELD | OS.PM_QS_INPUT | OS.PM_QS_POSTMESSAGE;
 					if (!OS.PeekMessage (msg, 0, 0, 0, flags)) {
@@ -3753,8 +3842,21 @@ public boolean readAndDispatch () {
 	runSkin ();
 	runDeferredLayouts ();
 	runPopups ();
-	if (OS.PeekMessage (msg, 0, 0, 0, OS.PM_REMOVE)) {
-		if (!filterMessage (msg)) {
+	/*
+	* Only keyboard messages are filtered in Java.  Let the pump
+	* dispatch every other message without copying it to the MSG.
+	*/
+	int result = OS.PUMP_NONE;
+	if (OS.IsUnicode) {
+		result = OS.PumpMessageW (msg, OS.PUMP_COALESCE | OS.PUMP_DISPATCH | OS.PUMP_SKIP_DESTROYED);
+	} else {
+		if (OS.PeekMessage (msg, 0, 0, 0, OS.PM_REMOVE)) {
+			if (msg.message == OS.WM_NULL && msg.hwnd == 0) OS.ClearWakeMessage ();
+			result = OS.PUMP_MESSAGE;
+		}
+	}
+	if (result != OS.PUMP_NONE) {
+		if (result == OS.PUMP_MESSAGE && !filterMessage (msg)) {
 			OS.TranslateMessage (msg);
 			OS.DispatchMessage (msg);
 		}
@@ -3828,17 +3930,18 @@ protected void release () {
 }
 
 void releaseDisplay () {
+	Watchdog.stop ();
 	if (embeddedHwnd != 0) {
 		OS.PostMessage (embeddedHwnd, SWT_DESTROY, 0, 0);
 	}
 	
 	/* Release XP Themes */
 	if (OS.COMCTL32_MAJOR >= 6) {
-		if (hButtonTheme != 0) OS.CloseThemeData (hButtonTheme);
-		if (hEditTheme != 0) OS.CloseThemeData (hEditTheme);
-		if (hExplorerBarTheme != 0) OS.CloseThemeData (hExplorerBarTheme);
-		if (hScrollBarTheme != 0) OS.CloseThemeData (hScrollBarTheme);
-		if (hTabTheme != 0) OS.CloseThemeData (hTabTheme);
+		closeThemeData (hButtonTheme);
+		closeThemeData (hEditTheme);
+		closeThemeData (hExplorerBarTheme);
+		closeThemeData (hScrollBarTheme);
+		closeThemeData (hTabTheme);
 		hButtonTheme = hEditTheme = hExplorerBarTheme = hScrollBarTheme = hTabTheme = 0;
 	}
 	
@@ -3929,6 +4032,7 @@ void releaseDisplay () {
 
 	/* Uninitialize buffered painting */
 	if (!OS.IsWinCE && OS.WIN32_VERSION >= OS.VERSION (6, 0)) {
+		OS.ReleaseCachedPaint (0);
 		OS.BufferedPaintUnInit ();
 	}
 	
@@ -4376,9 +4480,11 @@ void sendSleepEvent() {
   if (this.eventTable != null && this.eventTable.hooks(SWT.Sleep)) {
     sendEvent(SWT.Sleep, null);
   }
+  Watchdog.idle(true);
 }
 
 void sendWakeupEvent() {
+  Watchdog.idle(false);
   if (this.eventTable != null && this.eventTable.hooks(SWT.Wakeup)) {
     sendEvent(SWT.Wakeup, null);
   }
@@ -4689,6 +4795,13 @@ int shiftedKey (int key) {
 public boolean sleep () {
 	checkDevice ();
 	if (runMessages && getMessageCount () != 0) return true;
+	/*
+	* Feature in Windows.  A wake message removed by a message loop that
+	* is not ours never clears the pending wake, which would stop every
+	* later wake from being posted.  The fix is to clear it before waiting
+	* and to return when a wake was pending.
+	*/
+	if (!OS.IsWinCE && OS.ClearWakeMessage ()) return true;
 	sendSleepEvent();
 	if (OS.IsWinCE) {
 		OS.MsgWaitForMultipleObjectsEx (0, 0, OS.INFINITE, OS.QS_ALLINPUT, OS.MWMO_INPUTAVAILABLE);
@@ -4928,7 +5041,7 @@ void wakeThread () {
 	if (OS.IsWinCE) {
 		OS.PostMessage (hwndMessage, OS.WM_NULL, 0, 0);
 	} else {
-		OS.PostThreadMessage (threadId, OS.WM_NULL, 0, 0);
+		OS.PostWakeMessage (threadId);
 	}
 }
 
@@ -241,7 +241,7 @@ void drawThemeBackground (long /*int*/ hDC, long /*int*/ hwnd, RECT rect) {
 	RECT rect2 = new RECT ();
 	OS.GetClientRect (handle, rect2);
 	OS.MapWindowPoints (handle, hwnd, rect2, 2);
-	OS.DrawThemeBackground (display.hExplorerBarTheme (), hDC, OS.EBP_NORMALGROUPBACKGROUND, 0, rect2, null);
+	OS.DrawThemeBackgroundCached (display.hExplorerBarTheme (), hDC, OS.EBP_NORMALGROUPBACKGROUND, 0, rect2, null);
 }
 
 void drawWidget (GC gc, RECT clipRect) {
@@ -252,7 +252,7 @@ void drawWidget (GC gc, RECT clipRect) {
 	if (hTheme != 0) {
 		RECT rect = new RECT ();
 		OS.GetClientRect (handle, rect);
-		OS.DrawThemeBackground (hTheme, gc.handle, OS.EBP_HEADERBACKGROUND, 0, rect, clipRect);
+		OS.DrawThemeBackgroundCached (hTheme, gc.handle, OS.EBP_HEADERBACKGROUND, 0, rect, clipRect);
 	} else {
 		drawBackground (gc.handle);
 	}
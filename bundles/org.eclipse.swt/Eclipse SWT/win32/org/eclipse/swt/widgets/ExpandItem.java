@@ -180,7 +180,7 @@ void drawItem (GC gc, long /*int*/ hTheme, RECT clipRect, boolean drawFocus) {
 	RECT rect = new RECT ();
 	OS.SetRect (rect, x, y, x + width, y + headerHeight);
 	if (hTheme != 0) {
-		OS.DrawThemeBackground (hTheme, hDC, OS.EBP_NORMALGROUPHEAD, 0, rect, clipRect);
+		OS.DrawThemeBackgroundCached (hTheme, hDC, OS.EBP_NORMALGROUPHEAD, 0, rect, clipRect);
 	} else {
 		long /*int*/ oldBrush = OS.SelectObject (hDC, OS.GetSysColorBrush (OS.COLOR_BTNFACE));
 		OS.PatBlt (hDC, rect.left, rect.top, rect.right - rect.left, rect.bottom - rect.top, OS.PATCOPY);
@@ -223,7 +223,7 @@ void drawItem (GC gc, long /*int*/ hTheme, RECT clipRect, boolean drawFocus) {
 	if (hTheme != 0) {
 		int partID = expanded ? OS.EBP_NORMALGROUPCOLLAPSE : OS.EBP_NORMALGROUPEXPAND;
 		int stateID = hover ? OS.EBNGC_HOT : OS.EBNGC_NORMAL;
-		OS.DrawThemeBackground (hTheme, hDC, partID, stateID, rect, clipRect);
+		OS.DrawThemeBackgroundCached (hTheme, hDC, partID, stateID, rect, clipRect);
 	} else {
 		drawChevron (hDC, rect);
 	} 
@@ -386,7 +386,7 @@ LRESULT wmNCPaint (long /*int*/ hwnd, long /*int*/ wParam, long /*int*/ lParam)
 							drawGripper = shellRect.right == windowRect.right && shellRect.bottom == windowRect.bottom;
 						}
 						if (drawGripper) {
-							OS.DrawThemeBackground (display.hScrollBarTheme(), hDC, OS.SBP_SIZEBOX, 0, cornerRect, null);
+							OS.DrawThemeBackgroundCached (display.hScrollBarTheme(), hDC, OS.SBP_SIZEBOX, 0, cornerRect, null);
 						}
 					}
 					OS.ReleaseDC (hwnd, hDC);
@@ -312,7 +312,7 @@ void drawThemeBackground (long /*int*/ hDC, long /*int*/ hwnd, RECT rect) {
 	OS.GetClientRect (handle, rect2);
 	OS.MapWindowPoints (handle, hwnd, rect2, 2);
 	if (OS.IntersectRect (new RECT (), rect2, rect)) {
-		OS.DrawThemeBackground (display.hTabTheme (), hDC, OS.TABP_BODY, 0, rect2, null);
+		OS.DrawThemeBackgroundCached (display.hTabTheme (), hDC, OS.TABP_BODY, 0, rect2, null);
 	}
 }
 
@@ -80,9 +80,9 @@ public class Table extends Composite {
 	RECT focusRect;
 	long /*int*/ headerToolTipHandle;
 	boolean ignoreCustomDraw, ignoreDrawForeground, ignoreDrawBackground, ignoreDrawFocus, ignoreDrawSelection, ignoreDrawHot;
-	boolean customDraw, dragStarted, explorerTheme, firstColumnImage, fixScrollWidth, tipRequested, wasSelected, wasResized, painted;
+	boolean customDraw, dragStarted, explorerTheme, firstColumnImage, fixScrollWidth, listViewCache, tipRequested, wasSelected, wasResized, painted;
 	boolean ignoreActivate, ignoreSelect, ignoreShrink, ignoreResize, ignoreColumnMove, ignoreColumnResize, fullRowSelect;
-	int itemHeight, lastIndexOf, lastWidth, sortDirection, resizeCount, selectionForeground, hotIndex;
+	int itemHeight, lastIndexOf, lastWidth, sortDirection, resizeCount, selectionForeground, hotIndex, cacheStamp;
 	static /*final*/ long /*int*/ HeaderProc;
 	static final int INSET = 4;
 	static final int GRID_WIDTH = 1;
@@ -1143,6 +1143,46 @@ LRESULT CDDS_SUBITEMPREPAINT (NMLVCUSTOMDRAW nmcd, long /*int*/ wParam, long /*i
 	return new LRESULT (code);
 }
 
+void cacheItem (TableItem item, int index, int column, int image) {
+	/*
+	* Answer the text of every column of the row from the native cache.
+	* Strings that contain line delimiters or that are empty in the first
+	* column are answered differently for tool tips and are left to Java.
+	*/
+	int count = Math.max (1, columnCount), length = 0;
+	String [] strings = new String [count];
+	for (int i=0; i<count; i++) {
+		if (i == 0) {
+			strings [i] = item.text;
+		} else {
+			if (item.strings != null && i < item.strings.length) strings [i] = item.strings [i];
+		}
+		if (strings [i] != null) length += strings [i].length ();
+	}
+	char [] chars = new char [length];
+	int [] offsets = new int [count * 2], images = new int [count];
+	int offset = 0;
+	for (int i=0; i<count; i++) {
+		String string = strings [i];
+		images [i] = i == column ? image : OS.LVCACHE_UNKNOWN;
+		if (string == null) {
+			offsets [i * 2 + 1] = OS.LVCACHE_NONE;
+			continue;
+		}
+		int stringLength = string.length ();
+		if ((i == 0 && stringLength == 0) || string.indexOf ('\r') != -1 || string.indexOf ('\n') != -1) {
+			offsets [i * 2 + 1] = OS.LVCACHE_UNKNOWN;
+			continue;
+		}
+		string.getChars (0, stringLength, chars, offset);
+		offsets [i * 2] = offset;
+		offsets [i * 2 + 1] = stringLength;
+		offset += stringLength;
+	}
+	OS.SetListViewCacheItem (handle, index, chars, offsets, images, count);
+	item.cacheStamp = cacheStamp;
+}
+
 void checkBuffered () {
 	super.checkBuffered ();
 	if (OS.COMCTL32_MAJOR >= 6) style |= SWT.DOUBLE_BUFFERED;
@@ -1209,6 +1249,7 @@ public void clear (int index) {
 	checkWidget ();
 	int count = (int)/*64*/OS.SendMessage (handle, OS.LVM_GETITEMCOUNT, 0, 0);
 	if (!(0 <= index && index < count)) error (SWT.ERROR_INVALID_RANGE);
+	invalidateCache (index);
 	TableItem item = _getItem (index, false);
 	if (item != null) {
 		if (item != currentItem) item.clear ();
@@ -1263,6 +1304,7 @@ public void clear (int index) {
  */
 public void clear (int start, int end) {
 	checkWidget ();
+	invalidateCache (-1);
 	if (start > end) return;
 	int count = (int)/*64*/OS.SendMessage (handle, OS.LVM_GETITEMCOUNT, 0, 0);
 	if (!(0 <= start && start <= end && end < count)) {
@@ -1337,6 +1379,7 @@ public void clear (int start, int end) {
  */
 public void clear (int [] indices) {
 	checkWidget ();
+	invalidateCache (-1);
 	if (indices == null) error (SWT.ERROR_NULL_ARGUMENT);
 	if (indices.length == 0) return;
 	int count = (int)/*64*/OS.SendMessage (handle, OS.LVM_GETITEMCOUNT, 0, 0);
@@ -1402,6 +1445,7 @@ public void clear (int [] indices) {
  */
 public void clearAll () {
 	checkWidget ();
+	invalidateCache (-1);
 	LVITEM lvItem = null;
 	boolean cleared = false;
 	int count = (int)/*64*/OS.SendMessage (handle, OS.LVM_GETITEMCOUNT, 0, 0);
@@ -1611,6 +1655,12 @@ void createHandle () {
 			OS.SetWindowLong (hwndTooltop, OS.GWL_EXSTYLE, bits3 | OS.WS_EX_LAYOUTRTL);
 		}
 	}
+	
+	/* Answer the text and images of virtual items natively */
+	if ((style & SWT.VIRTUAL) != 0 && OS.IsUnicode) {
+		listViewCache = OS.CreateListViewCache (handle);
+		cacheStamp = 1;
+	}
 }
 
 void createHeaderToolTips () {
@@ -1642,6 +1692,7 @@ void createHeaderToolTips () {
 }
 
 void createItem (TableColumn column, int index) {
+	invalidateCache (-1);
 	if (!(0 <= index && index <= columnCount)) error (SWT.ERROR_INVALID_RANGE);
 	int oldColumn = (int)/*64*/OS.SendMessage (handle, OS.LVM_GETSELECTEDCOLUMN, 0, 0);
 	if (oldColumn >= index) {
@@ -1806,6 +1857,7 @@ void createItem (TableColumn column, int index) {
 }
 
 void createItem (TableItem item, int index) {
+	invalidateCache (-1);
 	int count = (int)/*64*/OS.SendMessage (handle, OS.LVM_GETITEMCOUNT, 0, 0);
 	if (!(0 <= index && index <= count)) error (SWT.ERROR_INVALID_RANGE);
 	_checkGrow (count);
@@ -1972,6 +2024,7 @@ public void deselectAll () {
 }
 
 void destroyItem (TableColumn column) {
+	invalidateCache (-1);
 	int index = 0;
 	while (index < columnCount) {
 		if (columns [index] == column) break;
@@ -2188,6 +2241,7 @@ void destroyItem (TableColumn column) {
 }
 
 void destroyItem (TableItem item) {
+	invalidateCache (-1);
 	int count = (int)/*64*/OS.SendMessage (handle, OS.LVM_GETITEMCOUNT, 0, 0);
 	int index = 0;
 	while (index < count) {
@@ -3017,6 +3071,19 @@ public int indexOf (TableItem item) {
 	return -1;
 }
 
+void invalidateCache (int index) {
+	if (!listViewCache) return;
+	if (index == -1) cacheStamp++;
+	OS.InvalidateListViewCache (handle, index);
+}
+
+void invalidateCache (TableItem item) {
+	if (!listViewCache || item.cacheStamp != cacheStamp) return;
+	item.cacheStamp = 0;
+	int index = indexOf (item);
+	if (index != -1) OS.InvalidateListViewCache (handle, index);
+}
+
 boolean isCustomToolTip () {
 	return hooks (SWT.MeasureItem);
 }
@@ -3112,6 +3179,10 @@ void releaseWidget () {
 	super.releaseWidget ();
 	customDraw = false;
 	currentItem = null;
+	if (listViewCache) {
+		OS.DestroyListViewCache (handle);
+		listViewCache = false;
+	}
 	if (imageList != null) {
 		OS.SendMessage (handle, OS.LVM_SETIMAGELIST, OS.LVSIL_SMALL, 0);
 		display.releaseImageList (imageList);
@@ -3146,6 +3217,7 @@ void releaseWidget () {
  */
 public void remove (int [] indices) {
 	checkWidget ();
+	invalidateCache (-1);
 	if (indices == null) error (SWT.ERROR_NULL_ARGUMENT);
 	if (indices.length == 0) return;
 	int [] newIndices = new int [indices.length];
@@ -3192,6 +3264,7 @@ public void remove (int [] indices) {
  */
 public void remove (int index) {
 	checkWidget ();
+	invalidateCache (-1);
 	int count = (int)/*64*/OS.SendMessage (handle, OS.LVM_GETITEMCOUNT, 0, 0);
 	if (!(0 <= index && index < count)) error (SWT.ERROR_INVALID_RANGE);
 	TableItem item = _getItem (index, false);
@@ -3225,6 +3298,7 @@ public void remove (int index) {
  */
 public void remove (int start, int end) {
 	checkWidget ();
+	invalidateCache (-1);
 	if (start > end) return;
 	int count = (int)/*64*/OS.SendMessage (handle, OS.LVM_GETITEMCOUNT, 0, 0);
 	if (!(0 <= start && start <= end && end < count)) {
@@ -3266,6 +3340,7 @@ public void remove (int start, int end) {
  */
 public void removeAll () {
 	checkWidget ();
+	invalidateCache (-1);
 	int itemCount = (int)/*64*/OS.SendMessage (handle, OS.LVM_GETITEMCOUNT, 0, 0);
 	for (int i=0; i<itemCount; i++) {
 		TableItem item = _getItem (i, false);
@@ -4619,6 +4694,7 @@ public void setHeaderVisible (boolean show) {
  */
 public void setItemCount (int count) {
 	checkWidget ();
+	invalidateCache (-1);
 	count = Math.max (0, count);
 	int itemCount = (int)/*64*/OS.SendMessage (handle, OS.LVM_GETITEMCOUNT, 0, 0);
 	if (count == itemCount) return;
@@ -5668,16 +5744,34 @@ void updateOrientation () {
 		display.releaseImageList (imageList);
 		imageList = display.getImageList (style & SWT.RIGHT_TO_LEFT, size.x, size.y);
 		int count = (int)/*64*/OS.SendMessage (handle, OS.LVM_GETITEMCOUNT, 0, 0);
+		Image [] images = new Image [4];
+		int imageCount = 0;
 		for (int i = 0; i < count; i++) {
 		    TableItem item = _getItem (i, false);
 			if (item != null) {
 				Image image = item.image;
-				if (image != null) {
-					int index = imageList.indexOf (image);
-					if (index == -1) imageList.add (image);	
+				if (image != null && imageList.indexOf (image) == -1) {
+					int index = 0;
+					while (index < imageCount && !images [index].equals (image)) index++;
+					if (index == imageCount) {
+						if (imageCount == images.length) {
+							Image [] newImages = new Image [imageCount + 4];
+							System.arraycopy (images, 0, newImages, 0, imageCount);
+							images = newImages;
+						}
+						images [imageCount++] = image;
+					}
 				}
 			}
 		}
+		if (imageCount != 0) {
+			if (imageCount != images.length) {
+				Image [] newImages = new Image [imageCount];
+				System.arraycopy (images, 0, newImages, 0, imageCount);
+				images = newImages;
+			}
+			imageList.add (images);
+		}
 		long /*int*/ hImageList = imageList.getHandle ();
 		OS.SendMessage (handle, OS.LVM_SETIMAGELIST, OS.LVSIL_SMALL, hImageList);
 	}	
@@ -6831,6 +6925,7 @@ LRESULT wmNotifyChild (NMHDR hdr, long /*int*/ wParam, long /*int*/ lParam) {
 				}
 			}
 			boolean move = false;
+			int cacheImage = OS.LVCACHE_UNKNOWN;
 			if ((plvfi.mask & OS.LVIF_IMAGE) != 0) {
 				Image image = null;
 				if (plvfi.iSubItem == 0) {
@@ -6839,8 +6934,9 @@ LRESULT wmNotifyChild (NMHDR hdr, long /*int*/ wParam, long /*int*/ lParam) {
 					Image [] images = item.images;
 					if (images != null && plvfi.iSubItem < images.length) image = images [plvfi.iSubItem];
 				}
+				cacheImage = OS.LVCACHE_NONE;
 				if (image != null) {
-					plvfi.iImage = imageIndex (image, plvfi.iSubItem);
+					plvfi.iImage = cacheImage = imageIndex (image, plvfi.iSubItem);
 					move = true;
 				}
 			}
@@ -6862,6 +6958,9 @@ LRESULT wmNotifyChild (NMHDR hdr, long /*int*/ wParam, long /*int*/ lParam) {
 				}
 			}
 			if (move) OS.MoveMemory (lParam, plvfi, NMLVDISPINFO.sizeof);
+			if (listViewCache && !tipRequested && !isDisposed () && !item.isDisposed ()) {
+				cacheItem (item, plvfi.iItem, plvfi.iSubItem, cacheImage);
+			}
 			break;
 		}
 		case OS.NM_CUSTOMDRAW: {
@@ -6884,7 +6983,7 @@ LRESULT wmNotifyChild (NMHDR hdr, long /*int*/ wParam, long /*int*/ lParam) {
 				}
 			}
 			NMLVCUSTOMDRAW nmcd = new NMLVCUSTOMDRAW ();
-			OS.MoveMemory (nmcd, lParam, NMLVCUSTOMDRAW.sizeof);
+			display.decodeNotify (nmcd, lParam);
 			switch (nmcd.dwDrawStage) {
 				case OS.CDDS_PREPAINT: return CDDS_PREPAINT (nmcd, wParam, lParam);
 				case OS.CDDS_ITEMPREPAINT: return CDDS_ITEMPREPAINT (nmcd, wParam, lParam);
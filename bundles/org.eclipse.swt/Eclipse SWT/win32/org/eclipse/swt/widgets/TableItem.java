@@ -39,7 +39,7 @@ public class TableItem extends Item {
 	Font font;
 	Font [] cellFont;
 	boolean checked, grayed, cached;
-	int imageIndent, background = -1, foreground = -1; 
+	int imageIndent, background = -1, foreground = -1, cacheStamp;
 	int [] cellBackground, cellForeground; 
 
 /**
@@ -1094,6 +1094,7 @@ public void setImage (int index, Image image) {
 		images [index] = image;
 	}
 	if ((parent.style & SWT.VIRTUAL) != 0) cached = true;
+	parent.invalidateCache (this);
 	
 	/* Ensure that the image list is created */
 	parent.imageIndex (image, index);
@@ -1197,6 +1198,7 @@ public void setText (int index, String string) {
 		strings [index] = string;
 	}
 	if ((parent.style & SWT.VIRTUAL) != 0) cached = true;
+	parent.invalidateCache (this);
 	if (index == 0) {
 		/*
 		* Bug in Windows.  Despite the fact that every item in the
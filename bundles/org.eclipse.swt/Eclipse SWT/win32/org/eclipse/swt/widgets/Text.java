@@ -1343,6 +1343,10 @@ int getTabWidth (int tabs) {
  */
 public String getText () {
 	checkWidget ();
+	if (OS.IsUnicode && segments == null) {
+		String string = OS.Edit_GetString (handle);
+		if (string != null) return string;
+	}
 	int length = OS.GetWindowTextLength (handle);
 	if (length == 0) return "";
 	TCHAR buffer = new TCHAR (getCodePage (), length + 1);
@@ -2248,8 +2252,12 @@ public void setText (String string) {
 	clearSegments (false);
 	int limit = (int)/*64*/OS.SendMessage (handle, OS.EM_GETLIMITTEXT, 0, 0) & 0x7FFFFFFF;
 	if (string.length () > limit) string = string.substring (0, limit);
-	TCHAR buffer = new TCHAR (getCodePage (), string, true);
-	OS.SetWindowText (handle, buffer);
+	if (OS.IsUnicode) {
+		OS.SetWindowTextString (handle, string);
+	} else {
+		TCHAR buffer = new TCHAR (getCodePage (), string, true);
+		OS.SetWindowText (handle, buffer);
+	}
 	applySegments ();
 	/*
 	* Bug in Windows.  When the widget is multi line
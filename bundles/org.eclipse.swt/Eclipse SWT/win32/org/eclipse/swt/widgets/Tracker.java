@@ -51,6 +51,7 @@ public class Tracker extends Widget {
 	boolean inEvent = false;
 	boolean drawn;
 	long /*int*/ hwndTransparent, hwndOpaque, oldTransparentProc, oldOpaqueProc;
+	long /*int*/ layeredSurface;
 	int oldX, oldY;
 	
 	static boolean IsVista = !OS.IsWinCE && OS.WIN32_VERSION >= OS.VERSION (6, 0);
@@ -485,7 +486,10 @@ public boolean open () {
 	* perform well. The fix is to draw on layered window instead.
 	* 
 	* Note that one window (almost opaque) is used for catching all events and a
-	* second window is used for drawing the rectangles. 
+	* second window is used for drawing the rectangles.  The rectangles are
+	* drawn into a surface that is kept while tracking and only the part that
+	* changed is presented with UpdateLayeredWindow, instead of the system
+	* redirecting the paint of a window the size of the screen.
 	*/
 	if (IsVista && parent == null) {
 		Rectangle bounds = display.getBounds();
@@ -512,7 +516,10 @@ public boolean open () {
 			0,
 			OS.GetModuleHandle (null),
 			null);
-		OS.SetLayeredWindowAttributes (hwndOpaque, 0xFFFFFF, (byte)0, OS.LWA_COLORKEY | OS.LWA_ALPHA);
+		layeredSurface = OS.CreateLayeredSurface (bounds.width, bounds.height);
+		if (layeredSurface == 0) {
+			OS.SetLayeredWindowAttributes (hwndOpaque, 0xFFFFFF, (byte)0, OS.LWA_COLORKEY | OS.LWA_ALPHA);
+		}
 		drawn = false;
 		newProc = new Callback (this, "transparentProc", 4); //$NON-NLS-1$
 		long /*int*/ newProcAddress = newProc.getAddress ();
@@ -625,6 +632,10 @@ public boolean open () {
 			hwndTransparent = 0;
 		}
 		hwndOpaque = 0;
+		if (layeredSurface != 0) {
+			OS.DestroyLayeredSurface (layeredSurface);
+			layeredSurface = 0;
+		}
 		if (newProc != null) {
 			newProc.dispose ();
 			oldTransparentProc = oldOpaqueProc = 0;
@@ -899,6 +910,11 @@ long /*int*/ transparentProc (long /*int*/ hwnd, long /*int*/ msg, long /*int*/
 			if (hwndOpaque == hwnd) {
 				PAINTSTRUCT ps = new PAINTSTRUCT();
 				long /*int*/ hDC = OS.BeginPaint (hwnd, ps);
+				if (layeredSurface != 0) {
+					hDC = OS.GetLayeredSurfaceDC (layeredSurface);
+					OS.SaveDC (hDC);
+					OS.IntersectClipRect (hDC, ps.left, ps.top, ps.right, ps.bottom);
+				}
 				long /*int*/ hBitmap = 0, hBrush = 0, oldBrush = 0;			
 				long /*int*/ transparentBrush = OS.CreateSolidBrush(0xFFFFFF);
 				oldBrush = OS.SelectObject (hDC, transparentBrush);
@@ -937,9 +953,15 @@ long /*int*/ transparentProc (long /*int*/ hwnd, long /*int*/ msg, long /*int*/
 					OS.DeleteObject (hBrush);
 					OS.DeleteObject (hBitmap);
 				}
+				if (layeredSurface != 0) {
+					OS.RestoreDC (hDC, -1);
+					OS.UpdateLayeredSurface (hwndOpaque, layeredSurface, ps.left, ps.top, ps.right - ps.left, ps.bottom - ps.top, 0xFFFFFF);
+				}
 				OS.EndPaint (hwnd, ps);
 				if (!drawn) {
-					OS.SetLayeredWindowAttributes (hwndOpaque, 0xFFFFFF, (byte)0xFF, OS.LWA_COLORKEY | OS.LWA_ALPHA);
+					if (layeredSurface == 0) {
+						OS.SetLayeredWindowAttributes (hwndOpaque, 0xFFFFFF, (byte)0xFF, OS.LWA_COLORKEY | OS.LWA_ALPHA);
+					}
 					drawn = true;
 				}
 				return 0;
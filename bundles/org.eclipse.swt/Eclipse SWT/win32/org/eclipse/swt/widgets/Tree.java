@@ -5656,16 +5656,34 @@ void updateOrientation () {
 		Point size = imageList.getImageSize ();
 		display.releaseImageList (imageList);
 		imageList = display.getImageList (style & SWT.RIGHT_TO_LEFT, size.x, size.y);
+		Image [] images = new Image [4];
+		int imageCount = 0;
 		for (int i = 0; i < items.length; i++) {
 			TreeItem item = items[i];
 			if (item != null) {
 				Image image = item.image;
-				if (image != null) {
-					int index = imageList.indexOf (image);
-					if (index == -1) imageList.add (image);	
+				if (image != null && imageList.indexOf (image) == -1) {
+					int index = 0;
+					while (index < imageCount && !images [index].equals (image)) index++;
+					if (index == imageCount) {
+						if (imageCount == images.length) {
+							Image [] newImages = new Image [imageCount + 4];
+							System.arraycopy (images, 0, newImages, 0, imageCount);
+							images = newImages;
+						}
+						images [imageCount++] = image;
+					}
 				}
 			}
 		}
+		if (imageCount != 0) {
+			if (imageCount != images.length) {
+				Image [] newImages = new Image [imageCount];
+				System.arraycopy (images, 0, newImages, 0, imageCount);
+				images = newImages;
+			}
+			imageList.add (images);
+		}
 		long /*int*/ hImageList = imageList.getHandle ();
 		OS.SendMessage (handle, OS.TVM_SETIMAGELIST, OS.TVSIL_NORMAL, hImageList);
 	}
@@ -7463,7 +7481,7 @@ LRESULT wmNotifyChild (NMHDR hdr, long /*int*/ wParam, long /*int*/ lParam) {
 				}
 			}
 			NMTVCUSTOMDRAW nmcd = new NMTVCUSTOMDRAW ();
-			OS.MoveMemory (nmcd, lParam, NMTVCUSTOMDRAW.sizeof);		
+			display.decodeNotify (nmcd, lParam);
 			switch (nmcd.dwDrawStage) {
 				case OS.CDDS_PREPAINT: return CDDS_PREPAINT (nmcd, wParam, lParam);
 				case OS.CDDS_ITEMPREPAINT: return CDDS_ITEMPREPAINT (nmcd, wParam, lParam);
@@ -72,6 +72,7 @@ public final class GC extends Resource {
 
 	Drawable drawable;
 	GCData data;
+	double[] commands = new double[7];
 
 	static final int FOREGROUND = 1 << 0;
 	static final int BACKGROUND = 1 << 1;
@@ -186,7 +187,7 @@ void checkGC(int mask) {
 			brush = pattern.handle;
 		} else {
 			int foreground = data.foreground;
-			brush = OS.gcnew_SolidColorBrush(foreground);
+			brush = OS.SWTBrushCache_Get(foreground);
 			if (brush == 0) SWT.error(SWT.ERROR_NO_HANDLES);
 		}
 		OS.Pen_Brush(pen, brush);
@@ -241,6 +242,7 @@ void checkGC(int mask) {
 		OS.Pen_EndLineCap(pen, capStyle);
 		OS.Pen_StartLineCap(pen, capStyle);
 		OS.Pen_MiterLimit(pen, data.lineMiterLimit);
+		if (pattern == null) OS.Freezable_Freeze(pen);
 	}
 	if ((state & BACKGROUND) != 0) {
 		if (data.brush != 0) OS.GCHandle_Free(data.brush);
@@ -250,7 +252,7 @@ void checkGC(int mask) {
 			data.currentBrush = pattern.handle;
 		} else {
 			int background = data.background;
-			int brush = OS.gcnew_SolidColorBrush(background);
+			int brush = OS.SWTBrushCache_Get(background);
 			if (brush == 0) SWT.error(SWT.ERROR_NO_HANDLES);
 			data.currentBrush = data.brush = brush;
 		}
@@ -459,9 +461,7 @@ public void drawArc (int x, int y, int width, int height, int startAngle, int ar
 	double offset = 0;
 	if (data.lineWidth == 0 || (data.lineWidth % 2) == 1) offset = 0.5;
 	if (arcAngle >= 360 || arcAngle <= -360) {
-		int center = OS.gcnew_Point(x + offset + width / 2f, y + offset + height / 2f);
-		OS.DrawingContext_DrawEllipse(handle, 0, data.pen, center, width / 2f, height / 2f);
-		OS.GCHandle_Free(center);
+		drawCommand(0, data.pen, OS.DrawCommand_Ellipse, x + offset + width / 2f, y + offset + height / 2f, width / 2f, height / 2f);
 		return;
 	}
 	boolean isNegative = arcAngle < 0;
@@ -650,11 +650,7 @@ public void drawLine (int x1, int y1, int x2, int y2) {
 	checkGC(DRAW);
 	double offset = 0;
 	if (data.lineWidth == 0 || (data.lineWidth % 2) == 1) offset = 0.5;
-	int point0 = OS.gcnew_Point(x1 + offset, y1 + offset);
-	int point1 = OS.gcnew_Point(x2 + offset, y2 + offset);
-	OS.DrawingContext_DrawLine(handle, data.pen, point0, point1);
-	OS.GCHandle_Free(point0);
-	OS.GCHandle_Free(point1);
+	drawCommand(0, data.pen, OS.DrawCommand_Line, x1 + offset, y1 + offset, x2 + offset, y2 + offset);
 }
 
 /** 
@@ -691,9 +687,7 @@ public void drawOval (int x, int y, int width, int height) {
 	}
 	double offset = 0;
 	if (data.lineWidth == 0 || (data.lineWidth % 2) == 1) offset = 0.5;
-	int center = OS.gcnew_Point(x + offset + width / 2f, y + offset + height / 2f);
-	OS.DrawingContext_DrawEllipse(handle, 0, data.pen, center, width / 2f, height / 2f);
-	OS.GCHandle_Free(center);
+	drawCommand(0, data.pen, OS.DrawCommand_Ellipse, x + offset + width / 2f, y + offset + height / 2f, width / 2f, height / 2f);
 }
 
 /** 
@@ -749,11 +743,7 @@ public void drawPath (Path path) {
 public void drawPoint (int x, int y) {
 	if (handle == 0) SWT.error(SWT.ERROR_GRAPHIC_DISPOSED);
 	checkGC(DRAW);
-	int rect = OS.gcnew_Rect(x, y, 1, 1);
-	int brush = OS.Pen_Brush(data.pen);
-	OS.DrawingContext_DrawRectangle(handle, brush, 0, rect);
-	OS.GCHandle_Free(brush);
-	OS.GCHandle_Free(rect);
+	drawCommand(0, data.pen, OS.DrawCommand_Point, x, y, 0, 0);
 }
 
 /** 
@@ -782,40 +772,44 @@ public void drawPolygon(int[] pointArray) {
 
 void drawPolyLineSegment(int[] pointArray, boolean closed, boolean stroked) {
 	if (pointArray.length < 4) return;
-	int list = OS.gcnew_PointCollection(pointArray.length / 2);
+	int count = pointArray.length / 2;
+	int length = 3 + count * 2;
+	double[] commands = this.commands;
+	if (commands.length < length) commands = new double[length];
 	double offset = 0;
 	if (stroked && (data.lineWidth == 0 || (data.lineWidth % 2) == 1)) offset = 0.5;
-	for (int i = 2; i < pointArray.length; i += 2) {
-		int point = OS.gcnew_Point(pointArray[i] + offset, pointArray[i + 1] + offset);
-		OS.PointCollection_Add(list, point);
-		OS.GCHandle_Free(point);
+	int flags = 0;
+	if (closed) flags |= OS.DrawCommand_PolylineClosed;
+	if (!stroked && data.fillRule == SWT.FILL_EVEN_ODD) flags |= OS.DrawCommand_PolylineEvenOdd;
+	commands[0] = OS.DrawCommand_Polyline;
+	commands[1] = flags;
+	commands[2] = count;
+	for (int i = 0; i < count * 2; i++) {
+		commands[3 + i] = pointArray[i] + offset;
 	}
-	int poly = OS.gcnew_PolyLineSegment(list, stroked);
-	OS.GCHandle_Free(list);
-	int figure = OS.gcnew_PathFigure();
-	int startPoint = OS.gcnew_Point(pointArray[0] + offset, pointArray[1] + offset);
-	OS.PathFigure_StartPoint(figure, startPoint);
-	OS.PathFigure_IsClosed(figure, closed);
-	int segments = OS.PathFigure_Segments(figure);
-	OS.PathSegmentCollection_Add(segments, poly);
-	int path = OS.gcnew_PathGeometry();
-//	int mode = 0;
-//	switch (data.antialias) {
-//		case SWT.DEFAULT:
-//		case SWT.ON: mode = OS.EdgeMode_Unspecified; break;
-//		case SWT.OFF: mode = OS.EdgeMode_Aliased; break;
-//	}
-//	OS.RenderOptions_SetEdgeMode(path, mode);
-	if (!stroked) OS.PathGeometry_FillRule(path, data.fillRule == SWT.FILL_EVEN_ODD ? OS.FillRule_EvenOdd : OS.FillRule_Nonzero);
-	int figures = OS.PathGeometry_Figures(path);
-	OS.PathFigureCollection_Add(figures, figure);
-	OS.DrawingContext_DrawGeometry(handle, stroked ? 0 : data.currentBrush, stroked ? data.pen : 0, path);
-	OS.GCHandle_Free(figures);
-	OS.GCHandle_Free(path);
-	OS.GCHandle_Free(segments);
-	OS.GCHandle_Free(figure);
-	OS.GCHandle_Free(startPoint);
-	OS.GCHandle_Free(poly);
+	OS.DrawingContext_DrawCommands(handle, stroked ? 0 : data.currentBrush, stroked ? data.pen : 0, commands, length);
+}
+
+void drawCommand(int brush, int pen, int command, double arg0, double arg1, double arg2, double arg3) {
+	double[] commands = this.commands;
+	commands[0] = command;
+	commands[1] = arg0;
+	commands[2] = arg1;
+	commands[3] = arg2;
+	commands[4] = arg3;
+	OS.DrawingContext_DrawCommands(handle, brush, pen, commands, command == OS.DrawCommand_Point ? 3 : 5);
+}
+
+void drawRoundedRectangle(int brush, int pen, double x, double y, double width, double height, double radiusX, double radiusY) {
+	double[] commands = this.commands;
+	commands[0] = OS.DrawCommand_RoundedRectangle;
+	commands[1] = x;
+	commands[2] = y;
+	commands[3] = width;
+	commands[4] = height;
+	commands[5] = radiusX;
+	commands[6] = radiusY;
+	OS.DrawingContext_DrawCommands(handle, brush, pen, commands, 7);
 }
 
 /** 
@@ -870,9 +864,7 @@ public void drawRectangle (int x, int y, int width, int height) {
 	}
 	double offset = 0;
 	if (data.lineWidth == 0 || (data.lineWidth % 2) == 1) offset = 0.5;
-	int rect = OS.gcnew_Rect(x + offset, y + offset, width, height);
-	OS.DrawingContext_DrawRectangle(handle, 0, data.pen, rect);
-	OS.GCHandle_Free(rect);
+	drawCommand(0, data.pen, OS.DrawCommand_Rectangle, x + offset, y + offset, width, height);
 }
 
 /** 
@@ -933,9 +925,7 @@ public void drawRoundRectangle (int x, int y, int width, int height, int arcWidt
 	if (arcHeight < 0) arcHeight = -arcHeight;
 	double offset = 0;
 	if (data.lineWidth == 0 || (data.lineWidth % 2) == 1) offset = 0.5;
-	int rect = OS.gcnew_Rect(x + offset, y + offset, width, height);
-	OS.DrawingContext_DrawRoundedRectangle(handle, 0, data.pen, rect, arcWidth / 2f, arcHeight / 2f);
-	OS.GCHandle_Free(rect);
+	drawRoundedRectangle(0, data.pen, x + offset, y + offset, width, height, arcWidth / 2f, arcHeight / 2f);
 }
 
 /** 
@@ -1191,9 +1181,7 @@ public void fillArc (int x, int y, int width, int height, int startAngle, int ar
 	}
 	if (width == 0 || height == 0 || arcAngle == 0) return;
 	if (arcAngle >= 360 || arcAngle <= -360) {
-		int center = OS.gcnew_Point(x + width / 2f, y + height / 2f);
-		OS.DrawingContext_DrawEllipse(handle, data.currentBrush, 0, center, width / 2f, height / 2f);
-		OS.GCHandle_Free(center);
+		drawCommand(data.currentBrush, 0, OS.DrawCommand_Ellipse, x + width / 2f, y + height / 2f, width / 2f, height / 2f);
 		return;
 	}
 	boolean isNegative = arcAngle < 0;
@@ -1311,9 +1299,7 @@ public void fillOval (int x, int y, int width, int height) {
 		y = y + height;
 		height = -height;
 	}
-	int center = OS.gcnew_Point(x + width / 2f, y + height / 2f);
-	OS.DrawingContext_DrawEllipse(handle, data.currentBrush, 0, center, width / 2f, height / 2f);
-	OS.GCHandle_Free(center);
+	drawCommand(data.currentBrush, 0, OS.DrawCommand_Ellipse, x + width / 2f, y + height / 2f, width / 2f, height / 2f);
 }
 
 /** 
@@ -1400,9 +1386,7 @@ public void fillRectangle (int x, int y, int width, int height) {
 		y = y + height;
 		height = -height;
 	}
-	int rect = OS.gcnew_Rect(x, y, width, height);
-	OS.DrawingContext_DrawRectangle(handle, data.currentBrush, 0, rect);
-	OS.GCHandle_Free(rect);
+	drawCommand(data.currentBrush, 0, OS.DrawCommand_Rectangle, x, y, width, height);
 }
 
 /** 
@@ -1455,9 +1439,7 @@ public void fillRoundRectangle (int x, int y, int width, int height, int arcWidt
 	}
 	if (arcWidth < 0) arcWidth = -arcWidth;
 	if (arcHeight < 0) arcHeight = -arcHeight;
-	int rect = OS.gcnew_Rect(x, y, width, height);
-	OS.DrawingContext_DrawRoundedRectangle(handle, data.currentBrush, 0, rect, arcWidth / 2f, arcHeight / 2f);
-	OS.GCHandle_Free(rect);
+	drawRoundedRectangle(data.currentBrush, 0, x, y, width, height, arcWidth / 2f, arcHeight / 2f);
 }
 
 /**
@@ -52,10 +52,12 @@ public final class TextLayout extends Resource {
 	int string, defaultTextProperties;
 	int[] runs;
 	int[] lines;
+	double[] lineMetrics;
 
 	static final RGB LINK_FOREGROUND = new RGB (0, 51, 153);
 	static final char LTR_MARK = '\u200E', RTL_MARK = '\u200F';
 	static final int TAB_COUNT = 32;
+	static final int LINE_LENGTH = 0, LINE_NEWLINE_LENGTH = 1, LINE_START = 2, LINE_WIDTH = 3, LINE_HEIGHT = 4, LINE_BASELINE = 5, LINE_METRICS = 6;
 	
 class StyleItem {
 	TextStyle style;
@@ -259,6 +261,8 @@ void computeRuns () {
 		System.arraycopy(lines, 0, tmpLines, 0, index);
 		lines = tmpLines;
 	}
+	lineMetrics = new double[lines.length * LINE_METRICS];
+	OS.TextLine_GetMetrics(lines, lines.length, lineMetrics);
 	if (tabCollection != 0) OS.GCHandle_Free(tabCollection);
 	OS.GCHandle_Free(paragraphProperties);
 	OS.GCHandle_Free(firstParagraphProperties);
@@ -391,13 +395,13 @@ public void draw (GC gc, int x, int y, int selectionStart, int selectionEnd, Col
 		int line = lines[i];
 		if (line == 0) break;
 		lineStart = lineEnd;
-		lineEnd = lineStart + OS.TextLine_Length(line);
+		lineEnd = lineStart + lineLength(i);
 		double nextDrawY, selY = drawY;
-		int lineHeight = (int)OS.TextLine_Height(line);
+		int lineHeight = (int)lineMetrics[i * LINE_METRICS + LINE_HEIGHT];
 		if (ascent != -1 && descent != -1) {
 			lineHeight = Math.max(lineHeight, ascent + descent);
 			nextDrawY = drawY + lineHeight + lineSpacing;
-			int baseline = (int)OS.TextLine_Baseline(line);
+			int baseline = (int)lineMetrics[i * LINE_METRICS + LINE_BASELINE];
 			if (ascent > baseline) drawY += ascent - baseline;
 		} else {
 			nextDrawY = drawY + lineHeight + lineSpacing;
@@ -416,7 +420,7 @@ public void draw (GC gc, int x, int y, int selectionStart, int selectionEnd, Col
 			if (i == lines.length - 1 && (flags & SWT.LAST_LINE_SELECTION) != 0) {
 				extent = true;
 			} else {
-				int breakLength = OS.TextLine_NewlineLength(line);
+				int breakLength = (int)lineMetrics[i * LINE_METRICS + LINE_NEWLINE_LENGTH];
 				if (breakLength != 0) {
 					if (selectionStart <= lineEnd && lineEnd <= selectionEnd) extent = true;
 				} else {
@@ -427,7 +431,7 @@ public void draw (GC gc, int x, int y, int selectionStart, int selectionEnd, Col
 			}
 			if (extent) {
 				int extentWidth = (flags & SWT.FULL_SELECTION) != 0 ? 0x7ffffff : lineHeight / 3;
-				int textRect = OS.gcnew_Rect(OS.TextLine_WidthIncludingTrailingWhitespace(line) + x, selY, extentWidth, lineHeight);
+				int textRect = OS.gcnew_Rect(lineMetrics[i * LINE_METRICS + LINE_WIDTH] + x, selY, extentWidth, lineHeight);
 				int geometry = OS.gcnew_RectangleGeometry(textRect);
 				OS.GeometryCollection_Add(geometries, geometry);
 				OS.GCHandle_Free(geometry);
@@ -489,7 +493,7 @@ public void draw (GC gc, int x, int y, int selectionStart, int selectionEnd, Col
 			int lineY = y;
 			lineStart = lineEnd = 0;
 			for (int j = 0; j < lines.length; j++) {
-				int lineLength = OS.TextLine_Length(lines[j]);
+				int lineLength = lineLength(j);
 				lineStart = lineEnd;
 				lineEnd = lineStart + lineLength;
 				if (start < lineEnd) {
@@ -514,7 +518,7 @@ public void draw (GC gc, int x, int y, int selectionStart, int selectionEnd, Col
 					}
 					OS.GCHandle_Free(rects);
 				}
-				int lineHeight = (int)OS.TextLine_Height(lines[j]);
+				int lineHeight = (int)lineMetrics[j * LINE_METRICS + LINE_HEIGHT];
 				if (ascent != -1 && descent != -1) lineHeight = Math.max(lineHeight, ascent + descent);
 				lineY += lineHeight + lineSpacing;
 			}
@@ -541,6 +545,7 @@ void freeRuns () {
 		}
 	}
 	lines = null;
+	lineMetrics = null;
 	if (runs != null) {
 		for (int i = 0; i < runs.length; i++) {
 			if (runs[i] == 0) break;
@@ -612,8 +617,8 @@ public Rectangle getBounds () {
 	double width = 0;
 	double height = 0;
 	for (int line=0; line<lines.length; line++) {
-		if (wrapWidth == -1) width = Math.max(width, OS.TextLine_WidthIncludingTrailingWhitespace(lines[line]));
-		int lineHeight = (int)OS.TextLine_Height(lines[line]);
+		if (wrapWidth == -1) width = Math.max(width, lineMetrics[line * LINE_METRICS + LINE_WIDTH]);
+		int lineHeight = (int)lineMetrics[line * LINE_METRICS + LINE_HEIGHT];
 		if (ascent != -1 && descent != -1) lineHeight = Math.max(lineHeight, ascent + descent);
 		height += lineHeight + lineSpacing;
 	}
@@ -648,7 +653,7 @@ public Rectangle getBounds (int start, int end) {
 	int lineStart = 0, lineEnd = 0, lineY = 0;
 	int rect = 0;
 	for (int i = 0; i < lines.length; i++) {
-		int lineLength = OS.TextLine_Length(lines[i]);
+		int lineLength = lineLength(i);
 		lineStart = lineEnd;
 		lineEnd = lineStart + lineLength;
 		if (start < lineEnd) {
@@ -674,7 +679,7 @@ public Rectangle getBounds (int start, int end) {
 			}
 			OS.GCHandle_Free(rects);
 		}
-		int lineHeight = (int)OS.TextLine_Height(lines[i]);
+		int lineHeight = (int)lineMetrics[i * LINE_METRICS + LINE_HEIGHT];
 		if (ascent != -1 && descent != -1) lineHeight = Math.max(lineHeight, ascent + descent);
 		lineY += lineHeight + lineSpacing;
 	}
@@ -772,7 +777,7 @@ public int getLevel (int offset) {
 	offset = translateOffset(offset);
 	int level = (orientation & SWT.RIGHT_TO_LEFT) != 0 ? 1 : 0;
 	for (int i = 0; i < lines.length; i++) {
-		int lineLength = OS.TextLine_Length(lines[i]);
+		int lineLength = lineLength(i);
 		if (lineLength > offset) {
 			int runs = OS.TextLine_GetIndexedGlyphRuns (lines[i]);
 			int enumerator = OS.IndexedGlyphRunCollection_GetEnumerator(runs);
@@ -817,15 +822,14 @@ public Rectangle getLineBounds(int lineIndex) {
 	int offset = 0;
 	double y = 0;
 	for (int i=0; i<lineIndex; i++) {
-		offset += OS.TextLine_Length(lines[i]);
-		int lineHeight = (int)OS.TextLine_Height(lines[i]);
+		offset += lineLength(i);
+		int lineHeight = (int)lineMetrics[i * LINE_METRICS + LINE_HEIGHT];
 		if (ascent != -1 && descent != -1) lineHeight = Math.max(lineHeight, ascent + descent);
 		y += lineHeight + lineSpacing;
 	}
-	int line = lines[lineIndex];
-	double x = OS.TextLine_Start(line);
-	double width = OS.TextLine_WidthIncludingTrailingWhitespace(line);
-	double height = OS.TextLine_Height(line);
+	double x = lineMetrics[lineIndex * LINE_METRICS + LINE_START];
+	double width = lineMetrics[lineIndex * LINE_METRICS + LINE_WIDTH];
+	double height = lineMetrics[lineIndex * LINE_METRICS + LINE_HEIGHT];
 	if (ascent != -1 && descent != -1) height = Math.max(height, ascent + descent);
 	char ch;
 	boolean firstLine = offset == 0 || (ch = segmentsText.charAt(offset - 1)) == '\r' || ch == '\n';
@@ -877,7 +881,7 @@ public int getLineIndex (int offset) {
 	offset = translateOffset(offset);
 	int start = 0;
 	for (int line=0; line<lines.length; line++) {
-		int lineLength = OS.TextLine_Length(lines[line]);
+		int lineLength = lineLength(line);
 		if (start + lineLength > offset) return line;
 		start += lineLength;
 	}
@@ -917,8 +921,8 @@ public FontMetrics getLineMetrics (int lineIndex) {
 		OS.GCHandle_Free(brush);
 		OS.GCHandle_Free(culture);
 	} else {
-		baseline = OS.TextLine_Baseline(lines[lineIndex]);
-		height = OS.TextLine_Height(lines[lineIndex]);
+		baseline = lineMetrics[lineIndex * LINE_METRICS + LINE_BASELINE];
+		height = lineMetrics[lineIndex * LINE_METRICS + LINE_HEIGHT];
 		if (ascent != -1 && descent != -1) {
 			baseline = Math.max(baseline, ascent);
 			height = Math.max(height, ascent + descent);
@@ -944,7 +948,7 @@ public int[] getLineOffsets () {
 	int start = 0;
 	int[] offsets = new int[lines.length+1];
 	for (int i = 0; i < lines.length; i++) {
-		start += OS.TextLine_Length(lines[i]);
+		start += lineLength(i);
 		offsets[i+1] = untranslateOffset(start);
 	}
 	return offsets;
@@ -975,10 +979,10 @@ public Point getLocation (int offset, boolean trailing) {
 	double y = 0;
 	int start = 0, line;	
 	for (line=0; line<lines.length; line++) {
-		int lineLength = OS.TextLine_Length(lines[line]);
+		int lineLength = lineLength(line);
 		if (start + lineLength > offset) break;
 		start += lineLength;
-		int lineHeight = (int)OS.TextLine_Height(lines[line]);
+		int lineHeight = (int)lineMetrics[line * LINE_METRICS + LINE_HEIGHT];
 		if (ascent != -1 && descent != -1) lineHeight = Math.max(lineHeight, ascent + descent);
 		y += lineHeight + lineSpacing;
 	}
@@ -1023,13 +1027,13 @@ int _getOffset(int offset, int movement, boolean forward) {
 	offset = translateOffset(offset);
 	int lineStart = 0, lineIndex;	
 	for (lineIndex=0; lineIndex<lines.length; lineIndex++) {
-		int lineLength = OS.TextLine_Length(lines[lineIndex]);
+		int lineLength = lineLength(lineIndex);
 		if (lineStart + lineLength > offset) break;
 		lineStart += lineLength;
 	}
 	int line = lines[lineIndex];
-	int lineLength = OS.TextLine_Length(line);
-	int lineBreak = OS.TextLine_NewlineLength (line);
+	int lineLength = lineLength(lineIndex);
+	int lineBreak = (int)lineMetrics[lineIndex * LINE_METRICS + LINE_NEWLINE_LENGTH];
 	while (lineStart <= offset && offset <= lineStart + lineLength) {
 		int resultCharHit;
 		int characterHit = OS.gcnew_CharacterHit(offset, 0);
@@ -1052,7 +1056,7 @@ int _getOffset(int offset, int movement, boolean forward) {
 			if (newOffset + trailing == lineStart) {
 				if (lineIndex == 0) return 0;
 				int lineEnd = 0;
-				if (newOffset + trailing == offset) lineEnd = OS.TextLine_NewlineLength(lines[lineIndex - 1]);
+				if (newOffset + trailing == offset) lineEnd = (int)lineMetrics[(lineIndex - 1) * LINE_METRICS + LINE_NEWLINE_LENGTH];
 				return untranslateOffset(Math.max(0, newOffset + trailing - lineEnd)); 
 			}
 		}
@@ -1148,7 +1152,7 @@ public int getOffset (int x, int y, int[] trailing) {
 	double lineY = 0;
 	int line;	
 	for (line=0; line<lines.length; line++) {
-		double lineHeight = OS.TextLine_Length(lines[line]);
+		double lineHeight = lineLength(line);
 		if (lineY + lineHeight > y) break;
 		lineY += lineHeight;
 	}
@@ -1473,6 +1477,10 @@ public boolean isDisposed () {
 	return device == null;
 }
 
+int lineLength (int lineIndex) {
+	return (int)lineMetrics[lineIndex * LINE_METRICS + LINE_LENGTH];
+}
+
 /**
  * Sets the text alignment for the receiver. The alignment controls
  * how a line of text is positioned horizontally. The argument should
@@ -1236,16 +1236,10 @@ public void setItems (String [] items) {
 	int itemCollection = OS.ItemsControl_Items(handle);
 	ignoreSelection = true;
 	OS.ItemCollection_Clear(itemCollection);
-	for (int i = 0; i < items.length; i++) {
-		int itemHandle = OS.gcnew_ComboBoxItem ();
-		int strPtr = createDotNetString (items [i], false);
-		OS.ContentControl_Content (itemHandle, strPtr);
-		OS.GCHandle_Free (strPtr);
-		OS.ItemCollection_Add (itemCollection, itemHandle);
-		OS.GCHandle_Free (itemHandle);
-	}
+	int count = OS.ItemCollection_AddItems (itemCollection, OS.ItemKind_ComboBoxItem, createDotNetStrings (items), items.length);
 	ignoreSelection = false;
 	OS.GCHandle_Free(itemCollection);
+	if (count != items.length) error (SWT.ERROR_ITEM_NOT_ADDED);
 }
 
 /**
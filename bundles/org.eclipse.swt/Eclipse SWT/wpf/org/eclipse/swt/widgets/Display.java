@@ -97,6 +97,7 @@ import org.eclipse.swt.graphics.*;
 public class Display extends Device {
 
 	int application, dispatcher, frame, jniRef, nameScope;
+	int idleHandler, sleepHandler;
 	boolean idle;
 	int sleepOperation, operation;
 	int operationCount;
@@ -1816,6 +1817,9 @@ protected void init () {
 	OS.GCHandle_Free (handler);
 	OS.GCHandle_Free (hooks);
 	timerHandler = OS.gcnew_TimerHandler(jniRef, "timerProc");
+	/* The delegates invoked by every readAndDispatch() and sleep() are created once */
+	idleHandler = OS.gcnew_NoArgsDelegate (jniRef, "setIdleHandler");
+	sleepHandler = OS.gcnew_NoArgsDelegate (jniRef, "sleep_noop");
 	
 
 	/* Create the standard colors */
@@ -2323,10 +2327,8 @@ public boolean readAndDispatch () {
 	runDeferredLayouts ();
 	runPopups ();
 	idle = false;
-	int handler = OS.gcnew_NoArgsDelegate(jniRef, "setIdleHandler");
-	operation = OS.Dispatcher_BeginInvoke(dispatcher, 2, handler);
+	operation = OS.Dispatcher_BeginInvoke(dispatcher, 2, idleHandler);
 	OS.DispatcherOperation_Wait(operation);
-	OS.GCHandle_Free(handler);
 	OS.GCHandle_Free(operation);
 	operation = 0;
 	if (!idle) {
@@ -2404,6 +2406,9 @@ void releaseDisplay () {
 	/* Release the timers */
 	OS.GCHandle_Free (timerHandler);
 	timerHandler = 0;
+	OS.GCHandle_Free (idleHandler);
+	OS.GCHandle_Free (sleepHandler);
+	idleHandler = sleepHandler = 0;
 	if (timerHandles != null) {
 		for (int i = 0; i < timerHandles.length; i++) {
 			int timer = timerHandles [i];
@@ -3018,10 +3023,8 @@ public void setSynchronizer (Synchronizer synchronizer) {
  */
 public boolean sleep () {
 	checkDevice ();
-	int handler = OS.gcnew_NoArgsDelegate (jniRef, "sleep_noop");
-	sleepOperation = OS.Dispatcher_BeginInvoke(dispatcher, OS.DispatcherPriority_Inactive, handler);
+	sleepOperation = OS.Dispatcher_BeginInvoke(dispatcher, OS.DispatcherPriority_Inactive, sleepHandler);
 	OS.DispatcherOperation_Wait(sleepOperation);
-	OS.GCHandle_Free(handler);
 	OS.GCHandle_Free(sleepOperation);
 	sleepOperation = 0;
 	return true;
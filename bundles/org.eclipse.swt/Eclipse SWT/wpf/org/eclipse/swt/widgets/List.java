@@ -996,17 +996,10 @@ public void setItems (String [] items) {
 	int itemCollection = OS.ItemsControl_Items (handle);
 	ignoreSelection = true;
 	OS.ItemCollection_Clear (itemCollection);
-	for (int i = 0; i < items.length; i++) {
-		String string = items [i];
-		int item = OS.gcnew_ListBoxItem ();
-		int strPtr = createDotNetString (string, false);
-		OS.ContentControl_Content (item, strPtr);
-		OS.GCHandle_Free (strPtr);
-		OS.ItemCollection_Add (itemCollection, item);
-		OS.GCHandle_Free (item);
-	}
+	int count = OS.ItemCollection_AddItems (itemCollection, OS.ItemKind_ListBoxItem, createDotNetStrings (items), items.length);
 	ignoreSelection = false;
 	OS.GCHandle_Free (itemCollection);
+	if (count != items.length) error (SWT.ERROR_ITEM_NOT_ADDED);
 }
 
 /**
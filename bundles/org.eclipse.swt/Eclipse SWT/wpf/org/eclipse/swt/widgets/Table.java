@@ -2052,12 +2052,7 @@ public void setItemCount (int count) {
 	}
 	if (OS.ItemCollection_Count (items) > count) error (SWT.ERROR_ITEM_NOT_REMOVED);
 	if ((style & SWT.VIRTUAL) != 0) {
-		for (int i=itemCount; i<count; i++) {
-			int item = OS.gcnew_ListViewItem ();
-			if (item == 0) error (SWT.ERROR_NO_HANDLES);
-			OS.ItemCollection_Add (items, item);
-			OS.GCHandle_Free (item);
-		}
+		OS.ItemCollection_AddItems (items, OS.ItemKind_ListViewItem, null, count - itemCount);
 	} else {
 		for (int i=itemCount; i<count; i++) {
 			new TableItem (this, SWT.NONE, i);
@@ -378,6 +378,21 @@ int createDotNetString (String string, boolean fixMnemonic) {
 	return ptr;
 }
 
+char [] createDotNetStrings (String [] strings) {
+	int length = 0;
+	for (int i = 0; i < strings.length; i++) {
+		length += strings [i].length () + 1;
+	}
+	char [] buffer = new char [length];
+	int offset = 0;
+	for (int i = 0; i < strings.length; i++) {
+		String string = strings [i];
+		string.getChars (0, string.length (), buffer, offset);
+		offset += string.length () + 1;
+	}
+	return buffer;
+}
+
 static String createJavaString (int ptr) {
 	int charArray = OS.String_ToCharArray (ptr);
 	char[] chars = new char[OS.String_Length (ptr)];
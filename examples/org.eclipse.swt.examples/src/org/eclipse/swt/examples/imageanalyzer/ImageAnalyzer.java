@@ -18,6 +18,7 @@ import org.eclipse.swt.layout.*;
 import org.eclipse.swt.graphics.*;
 import org.eclipse.swt.printing.*;
 import org.eclipse.swt.custom.*;
+import org.eclipse.swt.internal.image.FrameCompositor;
 
 import java.util.*;
 import java.net.*;
@@ -1604,6 +1605,10 @@ public class ImageAnalyzer {
 		Image offScreenImage = new Image(display, loader.logicalScreenWidth, loader.logicalScreenHeight);
 		GC offScreenImageGC = new GC(offScreenImage);
 		
+		// The compositor keeps the frames drawn so far, so that only the
+		// area that each frame changes has to be drawn again.
+		FrameCompositor compositor = new FrameCompositor(loader.logicalScreenWidth, loader.logicalScreenHeight);
+		
 		try {
 			// Use syncExec to get the background color of the imageCanvas.
 			display.syncExec(new Runnable() {
@@ -1612,81 +1617,42 @@ public class ImageAnalyzer {
 				}
 			});
 
-			// Fill the off-screen image with the background color of the canvas.
+			// Areas disposed with DM_FILL_BACKGROUND show the background
+			// color of the canvas, unless the GIF background is shown.
 			offScreenImageGC.setBackground(canvasBackground);
-			offScreenImageGC.fillRectangle(
-				0,
-				0,
-				loader.logicalScreenWidth,
-				loader.logicalScreenHeight);
+			int backgroundPixel = loader.backgroundPixel;
+			if (showBackground && backgroundPixel != -1) {
+				compositor.setBackground(imageData.palette.getRGB(backgroundPixel));
+			}
 					
 			// Draw the current image onto the off-screen image.
-			offScreenImageGC.drawImage(
-				image,
-				0,
-				0,
-				imageData.width,
-				imageData.height,
-				imageData.x,
-				imageData.y,
-				imageData.width,
-				imageData.height);
+			drawComposedArea(compositor, compositor.compose(imageData), offScreenImageGC);
 
 			int repeatCount = loader.repeatCount;
 			while (animate && (loader.repeatCount == 0 || repeatCount > 0)) {
-				if (imageData.disposalMethod == SWT.DM_FILL_BACKGROUND) {
-					// Fill with the background color before drawing.
-					Color bgColor = null;
-					int backgroundPixel = loader.backgroundPixel;
-					if (showBackground && backgroundPixel != -1) {
-						// Fill with the background color.
-						RGB backgroundRGB = imageData.palette.getRGB(backgroundPixel);
-						bgColor = new Color(null, backgroundRGB);
-					}
-					try {
-						offScreenImageGC.setBackground(bgColor != null ? bgColor : canvasBackground);
-						offScreenImageGC.fillRectangle(
-							imageData.x,
-							imageData.y,
-							imageData.width,
-							imageData.height);
-					} finally {
-						if (bgColor != null) bgColor.dispose();
-					}
-				} else if (imageData.disposalMethod == SWT.DM_FILL_PREVIOUS) {
-					// Restore the previous image before drawing.
-					offScreenImageGC.drawImage(
-						image,
-						0,
-						0,
-						imageData.width,
-						imageData.height,
-						imageData.x,
-						imageData.y,
-						imageData.width,
-						imageData.height);
-				}
-									
 				// Get the next image data.
 				imageDataIndex = (imageDataIndex + 1) % imageDataArray.length;
 				imageData = imageDataArray[imageDataIndex];
 				image.dispose();
 				image = new Image(display, imageData);
 				
-				// Draw the new image data.
-				offScreenImageGC.drawImage(
-					image,
-					0,
-					0,
-					imageData.width,
-					imageData.height,
-					imageData.x,
-					imageData.y,
-					imageData.width,
-					imageData.height);
-				
-				// Draw the off-screen image to the screen.
-				imageCanvasGC.drawImage(offScreenImage, 0, 0);
+				// Dispose of the previous image data as it asks, and draw the new one.
+				Rectangle bounds = compositor.compose(imageData);
+				if (!bounds.isEmpty()) {
+					drawComposedArea(compositor, bounds, offScreenImageGC);
+					
+					// Draw the area that changed to the screen.
+					imageCanvasGC.drawImage(
+						offScreenImage,
+						bounds.x,
+						bounds.y,
+						bounds.width,
+						bounds.height,
+						bounds.x,
+						bounds.y,
+						bounds.width,
+						bounds.height);
+				}
 				
 				// Sleep for the specified delay time before drawing again.
 				try {
@@ -1704,6 +1670,20 @@ public class ImageAnalyzer {
 		}
 	}
 
+	/*
+	 * Draw the given area of the frames composed so far
+	 * over the background of the off-screen image.
+	 */
+	void drawComposedArea(FrameCompositor compositor, Rectangle bounds, GC offScreenImageGC) {
+		Image area = new Image(display, compositor.getImageData(bounds));
+		try {
+			offScreenImageGC.fillRectangle(bounds.x, bounds.y, bounds.width, bounds.height);
+			offScreenImageGC.drawImage(area, bounds.x, bounds.y);
+		} finally {
+			area.dispose();
+		}
+	}
+
 	/*
 	 * Pre animation setup.
 	 */
@@ -31,13 +31,15 @@ import org.junit.runners.Suite;
 		Test_org_eclipse_swt_graphics_Image.class,
 		Test_org_eclipse_swt_graphics_ImageData.class,
 		Test_org_eclipse_swt_graphics_PaletteData.class,
+		Test_org_eclipse_swt_graphics_Path.class,
 		Test_org_eclipse_swt_graphics_Point.class,
 		Test_org_eclipse_swt_graphics_Rectangle.class,
 		Test_org_eclipse_swt_graphics_Region.class,
 		Test_org_eclipse_swt_graphics_RGB.class,
 		Test_org_eclipse_swt_graphics_TextLayout.class,
 		Test_org_eclipse_swt_graphics_ImageLoader.class,
-		Test_org_eclipse_swt_graphics_ImageLoaderEvent.class })
+		Test_org_eclipse_swt_graphics_ImageLoaderEvent.class,
+		Test_org_eclipse_swt_internal_image_FrameCompositor.class })
 public class AllGraphicsTests {
 	public static void main(String[] args) {
 		TestRunner.run(suite());
@@ -47,6 +47,7 @@ public AllTests() {
 	addTestSuite(Test_org_eclipse_swt_SWT.class);
 	addTestSuite(Test_org_eclipse_swt_SWTException.class);
 	addTestSuite(Test_org_eclipse_swt_SWTError.class);
+	addTestSuite(Test_org_eclipse_swt_internal_Callback.class);
 
 	/* NOTE: If the Display test suite is run, it must be run
 	 * before any other tests that need a display (i.e. graphics
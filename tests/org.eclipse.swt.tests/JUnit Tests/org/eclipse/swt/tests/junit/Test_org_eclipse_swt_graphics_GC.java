@@ -135,6 +135,15 @@ public void test_copyAreaIIIIII() {
 	assertEquals(":d:", whiteRGB, palette.getRGB(pixel));
 }
 
+public void test_copyAreaIIIIII_scroll() {
+	Rectangle clip = new Rectangle(30, 40, 100, 90);
+	int[][] deltas = {{7, 13}, {-7, -13}, {0, 9}, {-11, 0}};
+	for (int i = 0; i < deltas.length; i++) {
+		checkScroll(deltas[i][0], deltas[i][1], null);
+		checkScroll(deltas[i][0], deltas[i][1], clip);
+	}
+}
+
 public void test_copyAreaLorg_eclipse_swt_graphics_ImageII() {
 	Color white = display.getSystemColor(SWT.COLOR_WHITE);
 	Color blue = display.getSystemColor(SWT.COLOR_BLUE);
@@ -572,6 +581,37 @@ Shell shell;
 Image image;
 GC gc;
 
+/**
+ * Scrolls the image by deltaX and deltaY with copyArea() and checks every
+ * pixel against the image before the scroll.
+ */
+void checkScroll(int deltaX, int deltaY, Rectangle clip) {
+	Rectangle bounds = image.getBounds();
+	gc.setClipping((Rectangle)null);
+	gc.setForeground(display.getSystemColor(SWT.COLOR_BLUE));
+	gc.setBackground(display.getSystemColor(SWT.COLOR_WHITE));
+	gc.fillGradientRectangle(0, 0, bounds.width, bounds.height, false);
+	gc.setBackground(display.getSystemColor(SWT.COLOR_RED));
+	gc.fillRectangle(20, 25, 30, 15);
+	gc.fillRectangle(110, 90, 15, 40);
+	ImageData before = image.getImageData();
+
+	gc.setClipping(clip);
+	int srcX = Math.max(0, -deltaX), srcY = Math.max(0, -deltaY);
+	Rectangle dest = new Rectangle(srcX + deltaX, srcY + deltaY, bounds.width - Math.abs(deltaX), bounds.height - Math.abs(deltaY));
+	gc.copyArea(srcX, srcY, dest.width, dest.height, dest.x, dest.y);
+	ImageData after = image.getImageData();
+
+	String message = "scroll " + deltaX + "," + deltaY + (clip == null ? "" : " clipped");
+	for (int y = 0; y < bounds.height; y++) {
+		for (int x = 0; x < bounds.width; x++) {
+			boolean moved = dest.contains(x, y) && (clip == null || clip.contains(x, y));
+			int expected = moved ? before.getPixel(x - deltaX, y - deltaY) : before.getPixel(x, y);
+			assertEquals(message + " at " + x + "," + y, expected, after.getPixel(x, y));
+		}
+	}
+}
+
 /**
  * Return the actual RGB value used for rendering for the given Color.
  * This may be different from the Color's RGB value on lower-color displays 
@@ -16,6 +16,7 @@ import static org.junit.Assert.assertArrayEquals;
 
 import java.io.IOException;
 import java.io.InputStream;
+import java.util.Random;
 
 import junit.framework.TestCase;
 
@@ -25,6 +26,7 @@ import org.eclipse.swt.graphics.Image;
 import org.eclipse.swt.graphics.ImageData;
 import org.eclipse.swt.graphics.PaletteData;
 import org.eclipse.swt.graphics.RGB;
+import org.eclipse.swt.internal.Blit;
 import org.eclipse.swt.widgets.Display;
 
 /**
@@ -697,6 +699,25 @@ public void test_getPixelsIII$II() {
 	}
 }
 
+public void test_getPixelsIII$II_span() {
+	/* spans of 32 pixels or more are read natively, compare them with getPixel */
+	for (int i = 0; i < SPAN_DEPTHS.length; i++) {
+		int depth = SPAN_DEPTHS[i];
+		ImageData data = randomImageData(depth, depth);
+		for (int x = 0; x < 9; x++) {
+			int count = data.width * 2 - x - 1;
+			int[] pixels = new int[count + 2];
+			data.getPixels(x, 0, count, pixels, 1);
+			assertEquals("depth " + depth + " x " + x + ": pixel before startIndex written", 0, pixels[0]);
+			assertEquals("depth " + depth + " x " + x + ": pixel after the span written", 0, pixels[count + 1]);
+			for (int j = 0; j < count; j++) {
+				int px = (x + j) % data.width, py = (x + j) / data.width;
+				assertEquals("depth " + depth + " x " + x + ": pixel " + px + "," + py, data.getPixel(px, py), pixels[j + 1]);
+			}
+		}
+	}
+}
+
 public void test_getRGBs() {
 	assertNull(":a:", imageData.getRGBs());
 	RGB[] rgbs = new RGB[]{new RGB(0, 0, 0), new RGB(255, 255, 255)};
@@ -775,6 +796,60 @@ public void test_scaledToII() {
 	assertArrayEquals(":d:", expectedPixelData, scaledPixelData);
 }
 
+public void test_scaledToIII() {
+	/* a gray gradient of 0, 64, 128, 192 stretched to twice its width */
+	ImageData gradient = grayImageData(4, 1, 64);
+	ImageData scaledImageData = gradient.scaledTo(8, 1, SWT.LOW);
+	assertEquals(":a:", 8, scaledImageData.width);
+	assertEquals(":b:", 1, scaledImageData.height);
+	if (Blit.LOADED) {
+		int[] expectedGrays = new int[] {0, 16, 48, 80, 112, 144, 176, 192};
+		assertArrayEquals(":c:", expectedGrays, grays(scaledImageData));
+		/* HIGH only averages when shrinking, otherwise it interpolates as LOW */
+		assertArrayEquals(":d:", expectedGrays, grays(gradient.scaledTo(8, 1, SWT.HIGH)));
+	}
+
+	/* a gray gradient of 0, 32, ..., 224 on two rows shrunk to half its size */
+	gradient = grayImageData(8, 2, 32);
+	scaledImageData = gradient.scaledTo(4, 1, SWT.HIGH);
+	assertEquals(":e:", 4, scaledImageData.width);
+	assertEquals(":f:", 1, scaledImageData.height);
+	if (Blit.LOADED) {
+		assertArrayEquals(":g:", new int[] {16, 80, 144, 208}, grays(scaledImageData));
+	}
+
+	/* DEFAULT and NONE scale as scaledTo(int, int) */
+	assertScaledAsUnfiltered(":h:", gradient, 5, 3, SWT.DEFAULT);
+	assertScaledAsUnfiltered(":i:", gradient, 5, 3, SWT.NONE);
+
+	/* images that cannot be filtered fall back to scaledTo(int, int) */
+	RGB[] rgbs = new RGB[256];
+	for (int i = 0; i < rgbs.length; i++) rgbs[i] = new RGB(i, i, i);
+	ImageData indexed = new ImageData(8, 2, 8, new PaletteData(rgbs));
+	for (int y = 0; y < indexed.height; y++) {
+		for (int x = 0; x < indexed.width; x++) {
+			indexed.setPixel(x, y, x * 32);
+		}
+	}
+	assertScaledAsUnfiltered(":j:", indexed, 4, 1, SWT.HIGH);
+	assertScaledAsUnfiltered(":k:", indexed, 16, 4, SWT.LOW);
+	ImageData transparent = grayImageData(8, 2, 32);
+	transparent.transparentPixel = 0;
+	assertScaledAsUnfiltered(":l:", transparent, 4, 1, SWT.HIGH);
+	assertScaledAsUnfiltered(":m:", gradient, -8, 2, SWT.LOW);
+	assertScaledAsUnfiltered(":n:", gradient, 8, -2, SWT.HIGH);
+
+	int[] invalidInterpolations = new int[] {-2, 3, SWT.LEFT};
+	for (int i = 0; i < invalidInterpolations.length; i++) {
+		try {
+			gradient.scaledTo(4, 1, invalidInterpolations[i]);
+			fail("No exception thrown for interpolation " + invalidInterpolations[i]);
+		} catch (IllegalArgumentException e) {
+			assertSWTProblem("Incorrect exception thrown for interpolation " + invalidInterpolations[i], SWT.ERROR_INVALID_ARGUMENT, e);
+		}
+	}
+}
+
 public void test_setAlphaIII() {
 	int value;
 	
@@ -871,6 +946,27 @@ public void test_setAlphasIII$BI() {
 	}	
 }
 
+public void test_setPixelsIII$II_span() {
+	/* spans of 32 pixels or more are written natively, compare them with setPixel */
+	Random random = new Random(0);
+	for (int i = 0; i < SPAN_DEPTHS.length; i++) {
+		int depth = SPAN_DEPTHS[i];
+		int pixelMask = depth == 32 ? -1 : (1 << depth) - 1;
+		for (int x = 0; x < 9; x++) {
+			ImageData data = randomImageData(depth, depth + x);
+			ImageData expected = (ImageData)data.clone();
+			int count = data.width * 2 - x - 1;
+			int[] pixels = new int[count + 1];
+			for (int j = 0; j < pixels.length; j++) pixels[j] = random.nextInt() & pixelMask;
+			data.setPixels(x, 0, count, pixels, 1);
+			for (int j = 0; j < count; j++) {
+				expected.setPixel((x + j) % data.width, (x + j) / data.width, pixels[j + 1]);
+			}
+			assertArrayEquals("depth " + depth + " x " + x, expected.data, data.data);
+		}
+	}
+}
+
 public void test_setPixelIII() {
 	int value;
 	
@@ -1155,5 +1251,58 @@ public void test_setPixelsIII$II() {
 /* custom */
 ImageData imageData;
 final int IMAGE_DIMENSION = 10;
+static final int[] SPAN_DEPTHS = new int[] {1, 2, 4, 8, 16, 24, 32};
+
+/* Returns a 24 bit image whose gray value increases by step from one column to the next */
+ImageData grayImageData(int width, int height, int step) {
+	ImageData data = new ImageData(width, height, 24, new PaletteData(0xFF0000, 0xFF00, 0xFF));
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			int gray = x * step;
+			data.setPixel(x, y, gray << 16 | gray << 8 | gray);
+		}
+	}
+	return data;
+}
+
+/* Returns the gray values of the first row, failing if a pixel is not gray */
+int[] grays(ImageData data) {
+	int[] grays = new int[data.width];
+	for (int x = 0; x < data.width; x++) {
+		RGB rgb = data.palette.getRGB(data.getPixel(x, 0));
+		assertEquals("Pixel " + x + " is not gray", rgb.red, rgb.green);
+		assertEquals("Pixel " + x + " is not gray", rgb.red, rgb.blue);
+		grays[x] = rgb.red;
+	}
+	return grays;
+}
+
+/*
+* Returns an image of the given depth filled with random bytes, whose
+* odd width leaves spans of 1, 2 and 4 bit pixels at bit offsets.
+*/
+ImageData randomImageData(int depth, int seed) {
+	PaletteData palette;
+	if (depth > 8) {
+		palette = depth == 16 ? new PaletteData(0x7C00, 0x3E0, 0x1F) : new PaletteData(0xFF0000, 0xFF00, 0xFF);
+	} else {
+		RGB[] rgbs = new RGB[1 << depth];
+		for (int i = 0; i < rgbs.length; i++) rgbs[i] = new RGB(i, i, i);
+		palette = new PaletteData(rgbs);
+	}
+	ImageData data = new ImageData(45, 3, depth, palette);
+	new Random(seed).nextBytes(data.data);
+	return data;
+}
+
+void assertScaledAsUnfiltered(String message, ImageData data, int width, int height, int interpolation) {
+	ImageData expected = data.scaledTo(width, height);
+	ImageData actual = data.scaledTo(width, height, interpolation);
+	assertEquals(message, expected.width, actual.width);
+	assertEquals(message, expected.height, actual.height);
+	assertEquals(message, expected.depth, actual.depth);
+	assertEquals(message, expected.transparentPixel, actual.transparentPixel);
+	assertArrayEquals(message, expected.data, actual.data);
+}
 
 }
@@ -11,16 +11,20 @@
 package org.eclipse.swt.tests.junit;
 
 
+import java.io.ByteArrayInputStream;
 import java.io.ByteArrayOutputStream;
 import java.io.IOException;
 import java.io.InputStream;
 
 import junit.framework.TestCase;
 
+import org.eclipse.swt.SWT;
 import org.eclipse.swt.SWTException;
+import org.eclipse.swt.graphics.ImageData;
 import org.eclipse.swt.graphics.ImageLoader;
 import org.eclipse.swt.graphics.ImageLoaderEvent;
 import org.eclipse.swt.graphics.ImageLoaderListener;
+import org.eclipse.swt.graphics.PaletteData;
 
 /**
  * Automated Test Suite for class org.eclipse.swt.graphics.ImageLoader
@@ -113,6 +117,134 @@ public void test_loadLjava_io_InputStream() {
 	}
 }
 
+public void test_loadLjava_io_InputStreamI() {
+	ImageLoader loader = new ImageLoader();
+	try {
+		loader.load(null, 2);
+		fail("No exception thrown for load inputStream == null");
+	} catch (IllegalArgumentException e) {
+	}
+
+	ImageData full = loadImage(loader, "folder.jpg", 1);
+	for (int scale = 1; scale <= 8; scale *= 2) {
+		ImageData scaled = loadImage(loader, "folder.jpg", scale);
+		assertEquals((full.width + scale - 1) / scale, scaled.width);
+		assertEquals((full.height + scale - 1) / scale, scaled.height);
+	}
+	ImageData rounded = loadImage(loader, "folder.jpg", 3);
+	assertEquals((full.width + 1) / 2, rounded.width);
+
+	/* The reduction only applies to the load that asks for it */
+	loadImage(loader, "folder.jpg", 4);
+	ImageData next = loadImage(loader, "folder.jpg", 1);
+	assertEquals(full.width, next.width);
+	assertEquals(full.height, next.height);
+
+	/* Other formats are loaded at full size */
+	ImageData png = loadImage(loader, "folder.png", 1);
+	ImageData scaledPng = loadImage(loader, "folder.png", 2);
+	assertEquals(png.width, scaledPng.width);
+	assertEquals(png.height, scaledPng.height);
+}
+
+public void test_loadBandsLjava_io_InputStreamI() {
+	ImageLoader loader = new ImageLoader();
+	try {
+		loader.loadBands(null, 1);
+		fail("No exception thrown for load inputStream == null");
+	} catch (IllegalArgumentException e) {
+	}
+	try {
+		loader.loadBands(new ByteArrayInputStream(new byte[0]), 0);
+		fail("No exception thrown for band height == 0");
+	} catch (IllegalArgumentException e) {
+	}
+	
+	int width = 50, height = 37;
+	ImageData data = new ImageData(width, height, 24, new PaletteData(0xFF0000, 0xFF00, 0xFF));
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			data.setPixel(x, y, x * 5 << 16 | y * 7 << 8 | (x ^ y));
+			data.setAlpha(x, y, x + y);
+		}
+	}
+	loader.data = new ImageData[] {data};
+	ByteArrayOutputStream outStream = new ByteArrayOutputStream();
+	loader.save(outStream, SWT.IMAGE_PNG);
+	final ImageData image = new ImageLoader().load(new ByteArrayInputStream(outStream.toByteArray()))[0];
+	final int bandHeight = 8;
+	final int[] nextRow = new int[1];
+	loader = new ImageLoader();
+	loader.addImageLoaderListener(new ImageLoaderListener() {
+		public void imageDataLoaded(ImageLoaderEvent e) {
+			ImageData band = e.imageData;
+			assertEquals(nextRow[0], band.y);
+			assertEquals(Math.min(bandHeight, image.height - band.y), band.height);
+			assertEquals(band.y + band.height == image.height, e.endOfImage);
+			for (int y = 0; y < band.height; y++) {
+				for (int x = 0; x < band.width; x++) {
+					assertEquals(image.getPixel(x, band.y + y), band.getPixel(x, y));
+					assertEquals(image.getAlpha(x, band.y + y), band.getAlpha(x, y));
+				}
+			}
+			nextRow[0] += band.height;
+		}
+	});
+	loader.loadBands(new ByteArrayInputStream(outStream.toByteArray()), bandHeight);
+	assertEquals(height, nextRow[0]);
+	assertEquals(width, loader.logicalScreenWidth);
+	assertEquals(height, loader.logicalScreenHeight);
+}
+
+public void test_loadBandsLjava_io_InputStreamI_formats() {
+	String[] names = {"interlaced_target.png"};
+	String[] files = new String[SwtTestUtil.imageFilenames.length * SwtTestUtil.imageFormats.length + names.length];
+	int count = 0;
+	for (int i = 0; i < SwtTestUtil.imageFilenames.length; i++) {
+		for (int j = 0; j < SwtTestUtil.imageFormats.length; j++) {
+			files[count++] = SwtTestUtil.imageFilenames[i] + "." + SwtTestUtil.imageFormats[j];
+		}
+	}
+	System.arraycopy(names, 0, files, count, names.length);
+	for (int i = 0; i < files.length; i++) {
+		final String file = files[i];
+		final ImageData image = loadImage(new ImageLoader(), file, 1);
+		for (int bandHeight = 1; bandHeight <= image.height + 1; bandHeight += Math.max(1, image.height / 3)) {
+			final int rows = bandHeight;
+			final int[] nextRow = new int[1];
+			final boolean[] ended = new boolean[1];
+			ImageLoader loader = new ImageLoader();
+			loader.addImageLoaderListener(new ImageLoaderListener() {
+				public void imageDataLoaded(ImageLoaderEvent e) {
+					ImageData band = e.imageData;
+					assertFalse(file, ended[0]);
+					assertEquals(file, nextRow[0], band.y);
+					assertEquals(file, image.width, band.width);
+					assertEquals(file, Math.min(rows, image.height - band.y), band.height);
+					for (int y = 0; y < band.height; y++) {
+						for (int x = 0; x < band.width; x++) {
+							assertEquals(file, image.palette.getRGB(image.getPixel(x, band.y + y)), band.palette.getRGB(band.getPixel(x, y)));
+							assertEquals(file, image.getAlpha(x, band.y + y), band.getAlpha(x, y));
+						}
+					}
+					nextRow[0] += band.height;
+					ended[0] = e.endOfImage;
+				}
+			});
+			InputStream stream = SwtTestUtil.class.getResourceAsStream(file);
+			try {
+				loader.loadBands(stream, rows);
+			} finally {
+				try {
+					stream.close();
+				} catch (IOException e) {}
+			}
+			assertEquals(file, image.height, nextRow[0]);
+			assertTrue(file, ended[0]);
+		}
+	}
+}
+
 public void test_loadLjava_lang_String() {
 	ImageLoader loader = new ImageLoader();
 	String filename = null;
@@ -186,4 +318,45 @@ public void test_saveLjava_lang_StringI() {
 
 /* custom */
 boolean loaderListenerCalled;
+
+ImageData loadImage(ImageLoader loader, String name, int scaleDenominator) {
+	InputStream stream = SwtTestUtil.class.getResourceAsStream(name);
+	try {
+		return loader.load(stream, scaleDenominator)[0];
+	} finally {
+		try {
+			stream.close();
+		} catch (IOException e) {}
+	}
+}
+
+public void test_saveLjava_io_OutputStreamI_png() {
+	// large enough to be filtered and compressed in several blocks
+	int width = 400, height = 300;
+	ImageData data = new ImageData(width, height, 24, new PaletteData(0xFF0000, 0xFF00, 0xFF));
+	byte[] alphas = new byte[width * height];
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			data.setPixel(x, y, (x * 7 + y * 3) << 16 | (x ^ y) << 8 | ((x * y) & 0xFF));
+			alphas[y * width + x] = (byte) (x + y);
+		}
+	}
+	data.alphaData = alphas;
+	for (int compression = 0; compression <= 3; compression++) {
+		ImageLoader loader = new ImageLoader();
+		loader.data = new ImageData[] {data};
+		loader.compression = compression;
+		ByteArrayOutputStream outStream = new ByteArrayOutputStream();
+		loader.save(outStream, SWT.IMAGE_PNG);
+		ImageData result = new ImageLoader().load(new ByteArrayInputStream(outStream.toByteArray()))[0];
+		assertEquals(width, result.width);
+		assertEquals(height, result.height);
+		for (int y = 0; y < height; y++) {
+			for (int x = 0; x < width; x++) {
+				assertEquals(data.palette.getRGB(data.getPixel(x, y)), result.palette.getRGB(result.getPixel(x, y)));
+				assertEquals(data.getAlpha(x, y), result.getAlpha(x, y));
+			}
+		}
+	}
+}
 }
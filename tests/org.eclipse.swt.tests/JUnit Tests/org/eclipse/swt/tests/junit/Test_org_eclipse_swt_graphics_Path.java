@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * Copyright (c) 2014 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit;
+
+
+import java.lang.reflect.InvocationTargetException;
+import java.lang.reflect.Method;
+
+import junit.framework.TestCase;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.graphics.GC;
+import org.eclipse.swt.graphics.Image;
+import org.eclipse.swt.graphics.Path;
+import org.eclipse.swt.graphics.Transform;
+import org.eclipse.swt.widgets.Display;
+
+/**
+ * Automated Test Suite for class org.eclipse.swt.graphics.Path
+ *
+ * @see org.eclipse.swt.graphics.Path
+ */
+public class Test_org_eclipse_swt_graphics_Path extends TestCase {
+
+@Override
+protected void setUp() {
+	display = Display.getDefault();
+	image = new Image(display, 100, 100);
+	gc = new GC(image);
+	paths = new Path[] {new Path(display), new Path(display), new Path(display)};
+	paths[0].addRectangle(10, 10, 40, 30);
+	/* a self intersecting star, whose center depends on the fill rule */
+	paths[1].moveTo(50, 5);
+	paths[1].lineTo(79, 95);
+	paths[1].lineTo(3, 39);
+	paths[1].lineTo(97, 39);
+	paths[1].lineTo(21, 95);
+	paths[1].close();
+	paths[2].addArc(50, 40, 30, 30, 0, 360);
+}
+
+@Override
+protected void tearDown() {
+	for (int i = 0; i < paths.length; i++) paths[i].dispose();
+	gc.dispose();
+	image.dispose();
+}
+
+public void test_internal_contains$FLorg_eclipse_swt_graphics_GCZZ() throws Exception {
+	/* only some platforms hit-test points in one native call */
+	Method method;
+	try {
+		method = Path.class.getMethod("internal_contains", float[].class, GC.class, boolean.class, boolean.class);
+	} catch (NoSuchMethodException e) {
+		return;
+	}
+	float[] points = hitPoints();
+	for (int state = 0; state < STATES; state++) {
+		setState(state);
+		for (int i = 0; i < paths.length; i++) {
+			for (int flags = 0; flags < 4; flags++) {
+				boolean outline = (flags & 1) != 0, prefilter = (flags & 2) != 0;
+				int[] mask = (int[])invoke(method, paths[i], new Object[] {points, gc, Boolean.valueOf(outline), Boolean.valueOf(prefilter)});
+				assertEquals(":a:", (points.length / 2 + 31) / 32, mask.length);
+				for (int j = 0; j < points.length / 2; j++) {
+					float x = points[j * 2], y = points[j * 2 + 1];
+					assertEquals("state " + state + " path " + i + " outline " + outline + " prefilter " + prefilter + " point " + x + "," + y,
+						paths[i].contains(x, y, gc, outline), (mask[j / 32] & (1 << (j % 32))) != 0);
+				}
+			}
+		}
+	}
+}
+
+public void test_internal_contains$Lorg_eclipse_swt_graphics_PathFFLorg_eclipse_swt_graphics_GCZZ() throws Exception {
+	Method method;
+	try {
+		method = Path.class.getMethod("internal_contains", Path[].class, float.class, float.class, GC.class, boolean.class, boolean.class);
+	} catch (NoSuchMethodException e) {
+		return;
+	}
+	/* repeat the paths so that the mask takes more than one int */
+	Path[] manyPaths = new Path[paths.length * 12];
+	for (int i = 0; i < manyPaths.length; i++) manyPaths[i] = paths[i % paths.length];
+	float[] points = hitPoints();
+	for (int state = 0; state < STATES; state++) {
+		setState(state);
+		for (int j = 0; j < points.length / 2; j++) {
+			float x = points[j * 2], y = points[j * 2 + 1];
+			for (int flags = 0; flags < 4; flags++) {
+				boolean outline = (flags & 1) != 0, prefilter = (flags & 2) != 0;
+				int[] mask = (int[])invoke(method, null, new Object[] {manyPaths, new Float(x), new Float(y), gc, Boolean.valueOf(outline), Boolean.valueOf(prefilter)});
+				assertEquals(":a:", (manyPaths.length + 31) / 32, mask.length);
+				for (int i = 0; i < manyPaths.length; i++) {
+					assertEquals("state " + state + " path " + i + " outline " + outline + " prefilter " + prefilter + " point " + x + "," + y,
+						manyPaths[i].contains(x, y, gc, outline), (mask[i / 32] & (1 << (i % 32))) != 0);
+				}
+			}
+		}
+	}
+}
+
+/* custom */
+Display display;
+Image image;
+GC gc;
+Path[] paths;
+
+/* The GC states setState() cycles through */
+static final int STATES = 3;
+
+/*
+* Sets the line attributes, fill rule and transformation of the GC,
+* which the hit-tests must use the same way as Path.contains().
+*/
+void setState(int state) {
+	gc.setLineWidth(state == 0 ? 1 : 6);
+	gc.setLineJoin(state == 1 ? SWT.JOIN_MITER : SWT.JOIN_ROUND);
+	gc.setFillRule(state == 1 ? SWT.FILL_WINDING : SWT.FILL_EVEN_ODD);
+	Transform transform = null;
+	if (state == 2) {
+		transform = new Transform(display);
+		transform.translate(20, -10);
+		transform.rotate(30);
+		transform.scale(1.5f, 0.75f);
+	}
+	gc.setTransform(transform);
+	if (transform != null) transform.dispose();
+}
+
+/*
+* Returns x, y pairs on a grid that runs through the corners and edges
+* of the rectangle, the top of the star and the extremes of the circle,
+* points just inside and outside of the edges of the rectangle, and
+* points far outside of every path.
+*/
+static float[] hitPoints() {
+	float[] offsets = new float[] {-0.01f, 0, 0.01f};
+	float[] points = new float[(21 * 21 + 8 * offsets.length + 2) * 2];
+	int index = 0;
+	for (int y = 0; y <= 100; y += 5) {
+		for (int x = 0; x <= 100; x += 5) {
+			points[index++] = x;
+			points[index++] = y;
+		}
+	}
+	float[] edges = new float[] {10, 10, 30, 10, 50, 10, 50, 25, 50, 40, 30, 40, 10, 40, 10, 25};
+	for (int i = 0; i < edges.length; i += 2) {
+		for (int j = 0; j < offsets.length; j++) {
+			points[index++] = edges[i] + offsets[j];
+			points[index++] = edges[i + 1] + offsets[j];
+		}
+	}
+	points[index++] = -1000;
+	points[index++] = -1000;
+	points[index++] = 1000;
+	points[index++] = 40;
+	return points;
+}
+
+static Object invoke(Method method, Object receiver, Object[] args) throws Exception {
+	try {
+		return method.invoke(receiver, args);
+	} catch (InvocationTargetException e) {
+		Throwable cause = e.getCause();
+		if (cause instanceof Exception) throw (Exception)cause;
+		throw (Error)cause;
+	}
+}
+}
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright (c) 2014 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit;
+
+
+import java.lang.ref.WeakReference;
+
+import junit.framework.TestCase;
+
+import org.eclipse.swt.internal.Benchmark;
+import org.eclipse.swt.internal.Callback;
+
+/**
+ * Automated Test Suite for class org.eclipse.swt.internal.Callback
+ *
+ * @see org.eclipse.swt.internal.Callback
+ */
+public class Test_org_eclipse_swt_internal_Callback extends TestCase {
+
+public void test_ConstructorLjava_lang_ObjectLjava_lang_StringIZJZZ() {
+	/* Benchmark.call() calls the callback from native code */
+	if (!Benchmark.LOADED) return;
+	Callback callback = newWeakCallback();
+	try {
+		long /*int*/ address = callback.getAddress();
+		int slot = slotOf(callback);
+		assertTrue(":a:", slot != -1);
+		collectTarget();
+		assertTrue(":b:", Callback.isCollected(slot));
+		assertEquals(":c:", ERROR_RESULT, Benchmark.call(address, 1));
+		Callback[] collected = Callback.getCollected();
+		boolean found = false;
+		for (int i = 0; i < collected.length; i++) {
+			if (collected[i] == callback) found = true;
+		}
+		assertTrue(":d:", found);
+	} finally {
+		callback.dispose();
+	}
+}
+
+public void test_isCollectedI() {
+	if (!Benchmark.LOADED) return;
+	Upcall upcall = new Upcall();
+	Callback callback = new Callback(upcall, "upcall", 1);
+	try {
+		int slot = slotOf(callback);
+		assertTrue(":a:", slot != -1);
+		target = new WeakReference<Object>(new Object());
+		collectTarget();
+		assertFalse("A strong callback is reported as collected", Callback.isCollected(slot));
+		assertEquals(":b:", 1, Benchmark.call(callback.getAddress(), 1));
+	} finally {
+		callback.dispose();
+	}
+	assertFalse(":c:", Callback.isCollected(-1));
+	assertFalse(":d:", Callback.isCollected(Callback.getSlotCount()));
+}
+
+/* custom */
+static final long /*int*/ ERROR_RESULT = 42;
+
+WeakReference<Object> target;
+
+static class Upcall {
+	long /*int*/ upcall(long /*int*/ arg) {
+		return arg + 1;
+	}
+}
+
+/*
+* Binds a weak callback to an object that is only reachable from the
+* callback, checking that it is called while the object is alive.
+*/
+Callback newWeakCallback() {
+	Upcall upcall = new Upcall();
+	target = new WeakReference<Object>(upcall);
+	Callback callback = new Callback(upcall, "upcall", 1, false, ERROR_RESULT, false, true);
+	long /*int*/ address = callback.getAddress();
+	if (address == 0) {
+		callback.dispose();
+		fail("No callbacks available");
+	}
+	assertFalse("The object of a weak callback is reported as collected while alive", Callback.isCollected(slotOf(callback)));
+	assertEquals("A weak callback does not call its object while alive", 1, Benchmark.call(address, 1));
+	return callback;
+}
+
+/* Runs the garbage collector until the target has been collected */
+void collectTarget() {
+	for (int i = 0; i < 100 && target.get() != null; i++) {
+		System.gc();
+		System.runFinalization();
+		byte[][] garbage = new byte[64][];
+		for (int j = 0; j < garbage.length; j++) garbage[j] = new byte[16384];
+	}
+	assertNull("The target was not garbage collected", target.get());
+}
+
+static int slotOf(Callback callback) {
+	int count = Callback.getSlotCount();
+	for (int i = 0; i < count; i++) {
+		if (Callback.getStats(i, null) == callback) return i;
+	}
+	return -1;
+}
+}
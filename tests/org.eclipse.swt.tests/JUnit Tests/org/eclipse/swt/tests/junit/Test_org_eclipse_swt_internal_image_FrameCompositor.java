@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright (c) 2014 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit;
+
+
+import junit.framework.TestCase;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.graphics.ImageData;
+import org.eclipse.swt.graphics.PaletteData;
+import org.eclipse.swt.graphics.RGB;
+import org.eclipse.swt.graphics.Rectangle;
+import org.eclipse.swt.internal.image.FrameCompositor;
+
+/**
+ * Automated Test Suite for class org.eclipse.swt.internal.image.FrameCompositor
+ *
+ * @see org.eclipse.swt.internal.image.FrameCompositor
+ */
+public class Test_org_eclipse_swt_internal_image_FrameCompositor extends TestCase {
+
+public void test_ConstructorII() {
+	try {
+		new FrameCompositor(0, 1);
+		fail("No exception thrown for width == 0");
+	} catch (IllegalArgumentException e) {
+	}
+	try {
+		new FrameCompositor(1, -1);
+		fail("No exception thrown for height < 0");
+	} catch (IllegalArgumentException e) {
+	}
+	FrameCompositor compositor = new FrameCompositor(4, 3);
+	assertEquals(new Rectangle(0, 0, 4, 3), compositor.getBounds());
+	ImageData canvas = compositor.getImageData();
+	assertEquals(0, canvas.getAlpha(0, 0));
+	assertEquals(0, canvas.getAlpha(3, 2));
+}
+
+public void test_composeLorg_eclipse_swt_graphics_ImageData() {
+	FrameCompositor compositor = new FrameCompositor(8, 8);
+	try {
+		compositor.compose(null);
+		fail("No exception thrown for frame == null");
+	} catch (IllegalArgumentException e) {
+	}
+
+	// The first frame changes the whole canvas
+	ImageData first = frame(0, 0, 8, 8, 1, SWT.DM_FILL_NONE);
+	assertEquals(new Rectangle(0, 0, 8, 8), compositor.compose(first));
+	assertEquals(RED, rgb(compositor, 5, 5));
+
+	// A sub-rectangle only changes its own area
+	ImageData second = frame(2, 2, 2, 2, 2, SWT.DM_FILL_BACKGROUND);
+	assertEquals(new Rectangle(2, 2, 2, 2), compositor.compose(second));
+	assertEquals(GREEN, rgb(compositor, 3, 3));
+	assertEquals(RED, rgb(compositor, 4, 4));
+
+	// The background disposal clears the previous area before the next frame
+	ImageData third = frame(5, 5, 1, 1, 2, SWT.DM_FILL_PREVIOUS);
+	assertEquals(new Rectangle(2, 2, 4, 4), compositor.compose(third));
+	assertEquals(0, compositor.getImageData().getAlpha(3, 3));
+	assertEquals(GREEN, rgb(compositor, 5, 5));
+
+	// The previous disposal restores what the frame covered
+	ImageData fourth = frame(0, 0, 1, 1, 2, SWT.DM_FILL_NONE);
+	assertEquals(new Rectangle(0, 0, 6, 6), compositor.compose(fourth));
+	assertEquals(RED, rgb(compositor, 5, 5));
+	assertEquals(GREEN, rgb(compositor, 0, 0));
+}
+
+public void test_composeTransparentPixel() {
+	FrameCompositor compositor = new FrameCompositor(2, 1);
+	compositor.compose(frame(0, 0, 2, 1, 1, SWT.DM_FILL_NONE));
+	ImageData frame = frame(0, 0, 2, 1, 2, SWT.DM_FILL_NONE);
+	frame.setPixel(1, 0, 0);
+	frame.transparentPixel = 0;
+	compositor.compose(frame);
+	assertEquals(GREEN, rgb(compositor, 0, 0));
+	assertEquals(RED, rgb(compositor, 1, 0));
+}
+
+public void test_getImageDataLorg_eclipse_swt_graphics_Rectangle() {
+	FrameCompositor compositor = new FrameCompositor(4, 4);
+	try {
+		compositor.getImageData(null);
+		fail("No exception thrown for bounds == null");
+	} catch (IllegalArgumentException e) {
+	}
+	try {
+		compositor.getImageData(new Rectangle(2, 2, 4, 4));
+		fail("No exception thrown for bounds outside the canvas");
+	} catch (IllegalArgumentException e) {
+	}
+	compositor.compose(frame(1, 1, 2, 2, 1, SWT.DM_FILL_NONE));
+	ImageData region = compositor.getImageData(new Rectangle(1, 1, 3, 3));
+	assertEquals(1, region.x);
+	assertEquals(1, region.y);
+	assertEquals(3, region.width);
+	assertEquals(RED, region.palette.getRGB(region.getPixel(1, 1)));
+	assertEquals(255, region.getAlpha(1, 1));
+	assertEquals(0, region.getAlpha(2, 2));
+}
+
+public void test_reset() {
+	FrameCompositor compositor = new FrameCompositor(3, 3);
+	compositor.compose(frame(0, 0, 3, 3, 1, SWT.DM_FILL_NONE));
+	compositor.setBackground(BLUE);
+	compositor.reset();
+	assertEquals(BLUE, rgb(compositor, 1, 1));
+	assertEquals(new Rectangle(0, 0, 3, 3), compositor.compose(frame(1, 1, 1, 1, 2, SWT.DM_FILL_NONE)));
+	assertEquals(GREEN, rgb(compositor, 1, 1));
+	assertEquals(BLUE, rgb(compositor, 0, 0));
+}
+
+/* custom */
+static final RGB RED = new RGB(255, 0, 0);
+static final RGB GREEN = new RGB(0, 255, 0);
+static final RGB BLUE = new RGB(0, 0, 255);
+
+ImageData frame(int x, int y, int width, int height, int pixel, int disposalMethod) {
+	PaletteData palette = new PaletteData(new RGB[] {BLUE, RED, GREEN});
+	ImageData frame = new ImageData(width, height, 8, palette);
+	for (int i = 0; i < width; i++) {
+		for (int j = 0; j < height; j++) {
+			frame.setPixel(i, j, pixel);
+		}
+	}
+	frame.x = x;
+	frame.y = y;
+	frame.disposalMethod = disposalMethod;
+	return frame;
+}
+
+RGB rgb(FrameCompositor compositor, int x, int y) {
+	ImageData canvas = compositor.getImageData();
+	return canvas.palette.getRGB(canvas.getPixel(x, y));
+}
+}
@@ -0,0 +1,224 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2014 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.EOFException;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.util.Vector;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.graphics.Point;
+import org.eclipse.swt.widgets.Control;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Event;
+import org.eclipse.swt.widgets.Listener;
+
+/**
+ * Records the key and mouse events of a session and replays them.
+ * <p>
+ * The events are captured with a display filter, so they are the events
+ * SWT dispatched after translating the native ones, and are replayed with
+ * <code>Display.post()</code>, so that they go through the native event
+ * queue and the same dispatch path again. Only the events that can be
+ * posted are recorded: key down and up, mouse down, up, move and wheel.
+ * Mouse locations are kept in display coordinates.
+ * </p><p>
+ * The recording is written as a small binary file: a header, then for each
+ * event its type, the milliseconds since the previous event and the fields
+ * that matter for that type.
+ * </p>
+ */
+public class EventRecording implements Listener {
+	Display display;
+	Vector<int[]> events = new Vector<int[]>();
+	long lastTime = -1;
+
+	static final int MAGIC = 0x53575445; // "SWTE"
+	static final int VERSION = 1;
+	static final int[] TYPES = {SWT.KeyDown, SWT.KeyUp, SWT.MouseDown, SWT.MouseUp, SWT.MouseMove, SWT.MouseWheel};
+
+	/* The fields of a recorded event */
+	static final int TYPE = 0, DELAY = 1, X = 2, Y = 3, BUTTON = 4, COUNT = 5, KEY_CODE = 6, CHARACTER = 7;
+	static final int FIELDS = 8;
+
+EventRecording() {
+}
+
+/**
+ * Starts recording the events of the display.
+ */
+public static EventRecording record(Display display) {
+	EventRecording recording = new EventRecording();
+	recording.display = display;
+	for (int i = 0; i < TYPES.length; i++) {
+		display.addFilter(TYPES[i], recording);
+	}
+	return recording;
+}
+
+/**
+ * Reads a recording written by <code>write()</code>.
+ */
+public static EventRecording read(InputStream stream) throws IOException {
+	DataInputStream input = new DataInputStream(stream);
+	if (input.readInt() != MAGIC || input.readUnsignedByte() != VERSION) {
+		throw new IOException("Not an event recording");
+	}
+	EventRecording recording = new EventRecording();
+	while (true) {
+		int type;
+		try {
+			type = input.readUnsignedByte();
+		} catch (EOFException e) {
+			break;
+		}
+		int[] event = new int[FIELDS];
+		event[TYPE] = type;
+		event[DELAY] = input.readInt();
+		switch (type) {
+			case SWT.KeyDown:
+			case SWT.KeyUp:
+				event[KEY_CODE] = input.readInt();
+				event[CHARACTER] = input.readChar();
+				break;
+			case SWT.MouseDown:
+			case SWT.MouseUp:
+				event[BUTTON] = input.readUnsignedByte();
+				break;
+			case SWT.MouseMove:
+				event[X] = input.readInt();
+				event[Y] = input.readInt();
+				break;
+			case SWT.MouseWheel:
+				event[COUNT] = input.readInt();
+				break;
+			default:
+				throw new IOException("Unknown event type " + type);
+		}
+		recording.events.addElement(event);
+	}
+	return recording;
+}
+
+/**
+ * Answers the number of recorded events.
+ */
+public int getEventCount() {
+	return events.size();
+}
+
+public void handleEvent(Event e) {
+	long time = System.currentTimeMillis();
+	int[] event = new int[FIELDS];
+	event[TYPE] = e.type;
+	event[DELAY] = lastTime == -1 ? 0 : (int)(time - lastTime);
+	lastTime = time;
+	switch (e.type) {
+		case SWT.KeyDown:
+		case SWT.KeyUp:
+			event[KEY_CODE] = e.keyCode;
+			event[CHARACTER] = e.character;
+			break;
+		case SWT.MouseDown:
+		case SWT.MouseUp:
+			event[BUTTON] = e.button;
+			break;
+		case SWT.MouseMove:
+			Point location = e.widget instanceof Control ? ((Control)e.widget).toDisplay(e.x, e.y) : new Point(e.x, e.y);
+			event[X] = location.x;
+			event[Y] = location.y;
+			break;
+		case SWT.MouseWheel:
+			event[COUNT] = e.count;
+			break;
+	}
+	events.addElement(event);
+}
+
+/**
+ * Posts the recorded events to the display, processing the events they
+ * cause after each one. When <code>timed</code> is true the delays between
+ * the events are kept, otherwise the events follow each other as soon as
+ * the display is idle, which makes the replay independent of how fast the
+ * session was recorded.
+ */
+public void replay(Display display, boolean timed) {
+	for (int i = 0; i < events.size(); i++) {
+		int[] recorded = events.elementAt(i);
+		if (timed) {
+			long end = System.currentTimeMillis() + recorded[DELAY];
+			while (System.currentTimeMillis() < end) {
+				if (!display.readAndDispatch()) Thread.yield();
+			}
+		}
+		Event event = new Event();
+		event.type = recorded[TYPE];
+		event.x = recorded[X];
+		event.y = recorded[Y];
+		event.button = recorded[BUTTON];
+		event.count = recorded[COUNT];
+		event.keyCode = recorded[KEY_CODE];
+		event.character = (char)recorded[CHARACTER];
+		display.post(event);
+		while (display.readAndDispatch());
+	}
+}
+
+/**
+ * Stops recording.
+ */
+public void stop() {
+	if (display == null) return;
+	if (!display.isDisposed()) {
+		for (int i = 0; i < TYPES.length; i++) {
+			display.removeFilter(TYPES[i], this);
+		}
+	}
+	display = null;
+}
+
+/**
+ * Writes the recording to the stream.
+ */
+public void write(OutputStream stream) throws IOException {
+	DataOutputStream output = new DataOutputStream(stream);
+	output.writeInt(MAGIC);
+	output.writeByte(VERSION);
+	for (int i = 0; i < events.size(); i++) {
+		int[] event = events.elementAt(i);
+		output.writeByte(event[TYPE]);
+		output.writeInt(event[DELAY]);
+		switch (event[TYPE]) {
+			case SWT.KeyDown:
+			case SWT.KeyUp:
+				output.writeInt(event[KEY_CODE]);
+				output.writeChar(event[CHARACTER]);
+				break;
+			case SWT.MouseDown:
+			case SWT.MouseUp:
+				output.writeByte(event[BUTTON]);
+				break;
+			case SWT.MouseMove:
+				output.writeInt(event[X]);
+				output.writeInt(event[Y]);
+				break;
+			case SWT.MouseWheel:
+				output.writeInt(event[COUNT]);
+				break;
+		}
+	}
+	output.flush();
+}
+}
@@ -29,5 +29,8 @@ public static Test suite() {
 public PerformanceTests() {
 	super();
 	addTest(Test_situational.suite());
+	addTest(Test_natives.suite());
+	addTest(Test_imageCodecs.suite());
+	addTest(Test_eventReplay.suite());
 }
 }
@@ -0,0 +1,298 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2014 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.FileInputStream;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+
+import junit.framework.*;
+import junit.textui.*;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.graphics.Point;
+import org.eclipse.swt.graphics.Rectangle;
+import org.eclipse.swt.layout.FillLayout;
+import org.eclipse.swt.widgets.Display;
+import org.eclipse.swt.widgets.Event;
+import org.eclipse.swt.widgets.Shell;
+import org.eclipse.swt.widgets.Table;
+import org.eclipse.swt.widgets.TableColumn;
+import org.eclipse.swt.widgets.TableItem;
+import org.eclipse.swt.widgets.Text;
+import org.eclipse.test.performance.PerformanceMeter;
+
+/**
+ * Automated Performance Test Suite for replayed user sessions.
+ * <p>
+ * A session of mouse and key events is recorded on a shell with a table
+ * and a text, and then replayed through the native event queue under a
+ * meter, so that a change in the cost of dispatching the same input shows
+ * up as a regression. Each scenario reports the time per event and, when
+ * the library is built with NATIVE_STATS and the NativeStats tool is on
+ * the class path, the natives called per event.
+ * </p><p>
+ * The session is synthesized by default. A recorded one can be replayed
+ * instead by naming its file in the <code>org.eclipse.swt.tests.eventRecording</code>
+ * system property, and the synthesized one is saved to the file named in
+ * <code>org.eclipse.swt.tests.eventRecording.save</code>.
+ * </p>
+ *
+ * @see EventRecording
+ */
+public class Test_eventReplay extends SwtPerformanceTestCase {
+	Display display;
+
+public Test_eventReplay(String name) {
+	super(name);
+}
+
+public static void main(String[] args) {
+	TestRunner.run(suite());
+}
+
+@Override
+protected void setUp() throws Exception {
+	super.setUp();
+	display = Display.getDefault();
+}
+
+public void test_replay() throws IOException {
+	replay("Replay session", false);
+}
+
+public void test_replayTimed() throws IOException {
+	replay("Replay session (timed)", true);
+}
+
+@Override
+protected void runTest() throws Throwable {
+	if (getName().equals("test_replay")) test_replay();
+	else if (getName().equals("test_replayTimed")) test_replayTimed();
+}
+
+public static Test suite() {
+	TestSuite suite = new TestSuite();
+	java.util.Vector<String> methodNames = methodNames();
+	java.util.Enumeration<String> e = methodNames.elements();
+	while (e.hasMoreElements()) {
+		suite.addTest(new Test_eventReplay(e.nextElement()));
+	}
+	return suite;
+}
+public static java.util.Vector<String> methodNames() {
+	java.util.Vector<String> methodNames = new java.util.Vector<String>();
+	methodNames.addElement("test_replay");
+	methodNames.addElement("test_replayTimed");
+	return methodNames;
+}
+
+/* custom */
+static final String RECORDING_PROPERTY = "org.eclipse.swt.tests.eventRecording";
+static final String SAVE_PROPERTY = "org.eclipse.swt.tests.eventRecording.save";
+static final int ROWS = 500;
+static final int WARMUP = 1;
+static final int SAMPLES = 5;
+static final int TIMED_SAMPLES = 1;
+
+/*
+ * Replays the session on a fresh shell for each sample, so that every sample
+ * starts from the same widget state, and reports the time and the natives
+ * per event.
+ */
+void replay(String id, boolean timed) throws IOException {
+	Shell shell = createShell();
+	EventRecording recording = loadRecording(shell);
+	shell.dispose();
+	int events = recording.getEventCount();
+	assertTrue(events > 0);
+
+	PerformanceMeter meter = createMeterWithoutSummary(id);
+	int warmup = timed ? 0 : WARMUP, samples = timed ? TIMED_SAMPLES : SAMPLES;
+	long time = 0;
+	int calls = -1;
+	for (int i = 0; i < warmup + samples; i++) {
+		shell = createShell();
+		Object stats = nativeStats();
+		long start = System.nanoTime();
+		if (i >= warmup) meter.start();
+		recording.replay(display, timed);
+		if (i >= warmup) meter.stop();
+		if (i >= warmup) time += System.nanoTime() - start;
+		calls = nativeCalls(stats);
+		shell.dispose();
+		while (display.readAndDispatch()){/*empty*/}
+	}
+	disposeMeter(meter);
+
+	String report = id + ": " + events + " events, " + Math.round(time / 1e3 / samples / events) / 1e3 + " ms per event";
+	if (calls != -1) report += ", " + calls / events + " natives per event";
+	System.out.println(report);
+}
+
+Shell createShell() {
+	Shell shell = new Shell(display);
+	shell.setLayout(new FillLayout(SWT.VERTICAL));
+	Table table = new Table(shell, SWT.MULTI | SWT.FULL_SELECTION | SWT.BORDER);
+	table.setHeaderVisible(true);
+	for (int i = 0; i < 4; i++) {
+		TableColumn column = new TableColumn(table, SWT.NONE);
+		column.setText("Column " + i);
+		column.setWidth(100);
+	}
+	for (int i = 0; i < ROWS; i++) {
+		TableItem item = new TableItem(table, SWT.NONE);
+		item.setText(new String[] {"Item " + i, String.valueOf(i * 7), String.valueOf(i * 13), String.valueOf(i * 31)});
+	}
+	new Text(shell, SWT.MULTI | SWT.BORDER);
+	shell.setBounds(50, 50, 450, 400);
+	shell.open();
+	while (display.readAndDispatch()){/*empty*/}
+	return shell;
+}
+
+/*
+ * Answers the recording named by the system property, or records a
+ * synthesized session on the shell, passing it through the file format
+ * so that replaying it exercises the same path as a saved one.
+ */
+EventRecording loadRecording(Shell shell) throws IOException {
+	String path = System.getProperty(RECORDING_PROPERTY);
+	if (path != null) {
+		InputStream stream = new FileInputStream(path);
+		try {
+			return EventRecording.read(stream);
+		} finally {
+			stream.close();
+		}
+	}
+	EventRecording recording = EventRecording.record(display);
+	try {
+		synthesize(shell);
+	} finally {
+		recording.stop();
+	}
+	String savePath = System.getProperty(SAVE_PROPERTY);
+	if (savePath != null) {
+		OutputStream stream = new FileOutputStream(savePath);
+		try {
+			recording.write(stream);
+		} finally {
+			stream.close();
+		}
+	}
+	ByteArrayOutputStream bytes = new ByteArrayOutputStream();
+	recording.write(bytes);
+	return EventRecording.read(new ByteArrayInputStream(bytes.toByteArray()));
+}
+
+/*
+ * Posts a reproducible session: sweeping the mouse over the table, clicking
+ * and shift clicking rows, scrolling with the wheel and the keyboard, then
+ * typing into the text.
+ */
+void synthesize(Shell shell) {
+	Rectangle table = shell.getChildren()[0].getBounds();
+	Rectangle text = shell.getChildren()[1].getBounds();
+	Point origin = shell.toDisplay(0, 0);
+	for (int y = 30; y < table.height - 10; y += 8) {
+		post(mouseMove(origin.x + table.x + 20 + y % 300, origin.y + table.y + y));
+	}
+	for (int i = 0; i < 10; i++) {
+		int y = origin.y + table.y + 40 + i * 20;
+		post(mouseMove(origin.x + table.x + 50, y));
+		if (i % 3 == 2) post(key(SWT.KeyDown, SWT.SHIFT, (char)0));
+		post(mouse(SWT.MouseDown, 1));
+		post(mouse(SWT.MouseUp, 1));
+		if (i % 3 == 2) post(key(SWT.KeyUp, SWT.SHIFT, (char)0));
+	}
+	for (int i = 0; i < 20; i++) {
+		Event event = new Event();
+		event.type = SWT.MouseWheel;
+		event.count = i < 10 ? -3 : 3;
+		post(event);
+	}
+	for (int i = 0; i < 30; i++) {
+		int keyCode = i < 20 ? SWT.ARROW_DOWN : SWT.PAGE_UP;
+		post(key(SWT.KeyDown, keyCode, (char)0));
+		post(key(SWT.KeyUp, keyCode, (char)0));
+	}
+	post(mouseMove(origin.x + text.x + 20, origin.y + text.y + 20));
+	post(mouse(SWT.MouseDown, 1));
+	post(mouse(SWT.MouseUp, 1));
+	String typed = "the quick brown fox jumps over the lazy dog\r";
+	for (int i = 0; i < typed.length() * 3; i++) {
+		char character = typed.charAt(i % typed.length());
+		post(key(SWT.KeyDown, 0, character));
+		post(key(SWT.KeyUp, 0, character));
+	}
+}
+
+void post(Event event) {
+	display.post(event);
+	while (display.readAndDispatch()){/*empty*/}
+}
+
+static Event key(int type, int keyCode, char character) {
+	Event event = new Event();
+	event.type = type;
+	event.keyCode = keyCode;
+	event.character = character;
+	return event;
+}
+
+static Event mouse(int type, int button) {
+	Event event = new Event();
+	event.type = type;
+	event.button = button;
+	return event;
+}
+
+static Event mouseMove(int x, int y) {
+	Event event = new Event();
+	event.type = SWT.MouseMove;
+	event.x = x;
+	event.y = y;
+	return event;
+}
+
+Object nativeStats() {
+	try {
+		return Class.forName("org.eclipse.swt.tools.internal.NativeStats").newInstance();
+	} catch (Throwable e) {
+		return null;
+	}
+}
+
+/* Answers the natives called since the stats were created, or -1 if they are not counted */
+int nativeCalls(Object stats) {
+	if (stats == null) return -1;
+	try {
+		java.util.Hashtable<?, ?> diff = (java.util.Hashtable<?, ?>)stats.getClass().getMethod("diff", new Class[0]).invoke(stats, new Object[0]);
+		if (diff.isEmpty()) return -1;
+		int calls = 0;
+		java.util.Enumeration<?> e = diff.elements();
+		while (e.hasMoreElements()) {
+			Object[] funcs = (Object[])e.nextElement();
+			for (int i = 0; i < funcs.length; i++) {
+				calls += ((Integer)funcs[i].getClass().getMethod("getCallCount", new Class[0]).invoke(funcs[i], new Object[0])).intValue();
+			}
+		}
+		return calls;
+	} catch (Throwable e) {
+		return -1;
+	}
+}
+}
@@ -0,0 +1,250 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.lang.management.ManagementFactory;
+import java.lang.management.MemoryPoolMXBean;
+import java.lang.management.MemoryType;
+import java.lang.reflect.Method;
+import java.util.Iterator;
+
+import junit.framework.*;
+import junit.textui.*;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.graphics.ImageData;
+import org.eclipse.swt.graphics.ImageLoader;
+import org.eclipse.swt.graphics.PaletteData;
+import org.eclipse.swt.graphics.RGB;
+import org.eclipse.swt.internal.image.FileFormat;
+import org.eclipse.test.performance.PerformanceMeter;
+
+/**
+ * Automated Performance Test Suite for the image decoders and encoders.
+ * <p>
+ * Each scenario decodes or encodes an image, from the test data or a
+ * synthetic one, through one of the file formats, first with the native
+ * codecs and then with the Java implementation only. Each one reports the
+ * throughput in MB of pixel data per second, the bytes allocated per image
+ * when the VM can count them, and the peak heap.
+ * </p>
+ *
+ * @see org.eclipse.swt.graphics.ImageLoader
+ */
+public class Test_imageCodecs extends SwtPerformanceTestCase {
+
+public Test_imageCodecs(String name) {
+	super(name);
+}
+
+public static void main(String[] args) {
+	TestRunner.run(suite());
+}
+
+public void test_decodeFiles() throws IOException {
+	for (int i = 0; i < CORPUS.length; i++) {
+		byte[] bytes = read(getPath(CORPUS[i]));
+		ImageData image = new ImageLoader().load(new ByteArrayInputStream(bytes))[0];
+		measureDecode("Decode " + CORPUS[i], bytes, image);
+	}
+}
+
+public void test_decodeSynthetic() {
+	for (int i = 0; i < FORMATS.length; i++) {
+		ImageData image = synthetic(FORMATS[i]);
+		ImageLoader loader = new ImageLoader();
+		loader.data = new ImageData[] {image};
+		ByteArrayOutputStream stream = new ByteArrayOutputStream();
+		loader.save(stream, FORMATS[i]);
+		measureDecode("Decode synthetic " + FORMAT_NAMES[i], stream.toByteArray(), image);
+	}
+}
+
+public void test_encodeSynthetic() {
+	for (int i = 0; i < FORMATS.length; i++) {
+		final int format = FORMATS[i];
+		final ImageData image = synthetic(format);
+		measure("Encode synthetic " + FORMAT_NAMES[i], pixelBytes(image), new Runnable() {
+			public void run() {
+				ImageLoader loader = new ImageLoader();
+				loader.data = new ImageData[] {image};
+				loader.save(new ByteArrayOutputStream(), format);
+			}
+		});
+	}
+}
+
+@Override
+protected void runTest() throws Throwable {
+	if (getName().equals("test_decodeFiles")) test_decodeFiles();
+	else if (getName().equals("test_decodeSynthetic")) test_decodeSynthetic();
+	else if (getName().equals("test_encodeSynthetic")) test_encodeSynthetic();
+}
+
+public static Test suite() {
+	TestSuite suite = new TestSuite();
+	java.util.Vector<String> methodNames = methodNames();
+	java.util.Enumeration<String> e = methodNames.elements();
+	while (e.hasMoreElements()) {
+		suite.addTest(new Test_imageCodecs(e.nextElement()));
+	}
+	return suite;
+}
+public static java.util.Vector<String> methodNames() {
+	java.util.Vector<String> methodNames = new java.util.Vector<String>();
+	methodNames.addElement("test_decodeFiles");
+	methodNames.addElement("test_decodeSynthetic");
+	methodNames.addElement("test_encodeSynthetic");
+	return methodNames;
+}
+
+/* custom */
+static final String[] CORPUS = {"target.bmp", "target.gif", "target.jpg", "target.png", "folder.jpg", "transparent.png"};
+static final int[] FORMATS = {SWT.IMAGE_BMP, SWT.IMAGE_BMP_RLE, SWT.IMAGE_OS2_BMP, SWT.IMAGE_GIF, SWT.IMAGE_ICO, SWT.IMAGE_JPEG, SWT.IMAGE_PNG, SWT.IMAGE_TIFF};
+static final String[] FORMAT_NAMES = {"BMP", "BMP RLE", "OS/2 BMP", "GIF", "ICO", "JPEG", "PNG", "TIFF"};
+static final int SYNTHETIC_SIZE = 1024;
+static final int ICON_SIZE = 128;
+static final int WARMUP = 2;
+static final int SAMPLES = 10;
+
+void measureDecode(String id, final byte[] bytes, ImageData image) {
+	measure(id, pixelBytes(image), new Runnable() {
+		public void run() {
+			new ImageLoader().load(new ByteArrayInputStream(bytes));
+		}
+	});
+}
+
+/*
+ * Runs the operation with the native codecs, then with the Java implementation
+ * only, and reports its throughput over the given number of bytes of pixel data.
+ */
+void measure(String name, int pixelBytes, Runnable operation) {
+	boolean nativeCodecs = FileFormat.NATIVE_CODECS;
+	try {
+		for (int pass = 0; pass < 2; pass++) {
+			FileFormat.NATIVE_CODECS = pass == 0;
+			String id = name + (pass == 0 ? " (native)" : " (Java)");
+			PerformanceMeter meter = createMeterWithoutSummary(id);
+			for (int samples = 0; samples < WARMUP; samples++) {
+				operation.run();
+			}
+			resetPeakHeap();
+			long allocated = allocatedBytes(), time = 0;
+			for (int samples = 0; samples < SAMPLES; samples++) {
+				long start = System.nanoTime();
+				meter.start();
+				operation.run();
+				meter.stop();
+				time += System.nanoTime() - start;
+			}
+			long allocatedAfter = allocatedBytes();
+			long peak = peakHeap();
+			disposeMeter(meter);
+
+			double mbPerSecond = (double)pixelBytes * SAMPLES / (1 << 20) / (Math.max(time, 1) / 1e9);
+			String report = id + ": " + Math.round(mbPerSecond * 10) / 10.0 + " MB/s";
+			if (allocated != -1 && allocatedAfter != -1) report += ", " + (allocatedAfter - allocated) / SAMPLES / 1024 + " KB allocated per image";
+			report += ", " + peak / (1 << 20) + " MB peak heap";
+			System.out.println(report);
+		}
+	} finally {
+		FileFormat.NATIVE_CODECS = nativeCodecs;
+	}
+}
+
+/* Answers the bytes allocated by the current thread so far, or -1 if the VM does not count them */
+static long allocatedBytes() {
+	try {
+		Class<?> clazz = Class.forName("com.sun.management.ThreadMXBean");
+		Method method = clazz.getMethod("getThreadAllocatedBytes", new Class[] {long.class});
+		Object bean = ManagementFactory.getThreadMXBean();
+		if (!clazz.isInstance(bean)) return -1;
+		return ((Long)method.invoke(bean, new Object[] {new Long(Thread.currentThread().getId())})).longValue();
+	} catch (Throwable e) {
+		return -1;
+	}
+}
+
+static void resetPeakHeap() {
+	for (Iterator<MemoryPoolMXBean> i = ManagementFactory.getMemoryPoolMXBeans().iterator(); i.hasNext();) {
+		MemoryPoolMXBean pool = i.next();
+		if (pool.getType() == MemoryType.HEAP) pool.resetPeakUsage();
+	}
+}
+
+static long peakHeap() {
+	long peak = 0;
+	for (Iterator<MemoryPoolMXBean> i = ManagementFactory.getMemoryPoolMXBeans().iterator(); i.hasNext();) {
+		MemoryPoolMXBean pool = i.next();
+		if (pool.getType() == MemoryType.HEAP) peak += pool.getPeakUsage().getUsed();
+	}
+	return peak;
+}
+
+static int pixelBytes(ImageData image) {
+	return image.width * image.height * ((image.depth + 7) / 8);
+}
+
+static byte[] read(String path) throws IOException {
+	InputStream stream = new FileInputStream(path);
+	try {
+		ByteArrayOutputStream out = new ByteArrayOutputStream();
+		byte[] buffer = new byte[4096];
+		int count;
+		while ((count = stream.read(buffer)) != -1) {
+			out.write(buffer, 0, count);
+		}
+		return out.toByteArray();
+	} finally {
+		stream.close();
+	}
+}
+
+/*
+ * Answers a reproducible image that the given format can encode: an 8 bit
+ * indexed image for the formats that need a palette, and a 24 bit direct one
+ * for the others. The pattern mixes gradients and noise, so that it neither
+ * compresses to nothing nor defeats compression entirely.
+ */
+static ImageData synthetic(int format) {
+	int size = format == SWT.IMAGE_ICO ? ICON_SIZE : SYNTHETIC_SIZE;
+	boolean indexed = format == SWT.IMAGE_GIF || format == SWT.IMAGE_BMP_RLE;
+	ImageData image;
+	if (indexed) {
+		RGB[] rgbs = new RGB[256];
+		for (int i = 0; i < rgbs.length; i++) {
+			rgbs[i] = new RGB(i, (i * 7) & 0xFF, 255 - i);
+		}
+		image = new ImageData(size, size, 8, new PaletteData(rgbs));
+	} else {
+		image = new ImageData(size, size, 24, new PaletteData(0xFF0000, 0xFF00, 0xFF));
+	}
+	int seed = 0x12345678;
+	for (int y = 0; y < size; y++) {
+		for (int x = 0; x < size; x++) {
+			seed = seed * 1103515245 + 12345;
+			int noise = (seed >>> 16) & 0xF;
+			if (indexed) {
+				image.setPixel(x, y, ((x + y) / 8 + noise) & 0xFF);
+			} else {
+				image.setPixel(x, y, ((x / 4 + noise) & 0xFF) << 16 | ((y / 4) & 0xFF) << 8 | ((x ^ y) & 0xFF));
+			}
+		}
+	}
+	return image;
+}
+}
@@ -0,0 +1,270 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2012 IBM Corporation and others.
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the Eclipse Public License v1.0
+ * which accompanies this distribution, and is available at
+ * http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Contributors:
+ *     IBM Corporation - initial API and implementation
+ *******************************************************************************/
+package org.eclipse.swt.tests.junit.performance;
+
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+
+import junit.framework.*;
+import junit.textui.*;
+
+import org.eclipse.swt.SWT;
+import org.eclipse.swt.internal.Benchmark;
+import org.eclipse.swt.internal.C;
+import org.eclipse.swt.internal.Callback;
+import org.eclipse.test.performance.PerformanceMeter;
+
+/**
+ * Automated Performance Test Suite for the JNI transitions made by the
+ * generated bindings.
+ * <p>
+ * Each scenario times CALLS calls of one kind of native. The platform
+ * scenarios are called through reflection, so that this class compiles
+ * on every platform, and are measured next to a reflective call of an
+ * empty native that gives the cost of the reflection itself.
+ * </p>
+ *
+ * @see org.eclipse.swt.internal.Benchmark
+ */
+public class Test_natives extends SwtPerformanceTestCase {
+
+public Test_natives(String name) {
+	super(name);
+}
+
+public static void main(String[] args) {
+	TestRunner.run(suite());
+}
+
+public void test_emptyCall() {
+	if (!Benchmark.LOADED) return;
+	PerformanceMeter meter = createMeterWithoutSummary("JNI empty call");
+	for (int samples = 0; samples < WARMUP + SAMPLES; samples++) {
+		if (samples >= WARMUP) meter.start();
+		for (int i = 0; i < CALLS; i++) {
+			Benchmark.empty();
+		}
+		if (samples >= WARMUP) meter.stop();
+	}
+	disposeMeter(meter);
+}
+
+public void test_generatedCall() {
+	PerformanceMeter meter = createMeterWithoutSummary("JNI generated call");
+	for (int samples = 0; samples < WARMUP + SAMPLES; samples++) {
+		if (samples >= WARMUP) meter.start();
+		for (int i = 0; i < CALLS; i++) {
+			C.PTR_sizeof();
+		}
+		if (samples >= WARMUP) meter.stop();
+	}
+	disposeMeter(meter);
+}
+
+public void test_pinnedArray() {
+	if (!Benchmark.LOADED) return;
+	byte[] array = new byte[PIN_SIZE];
+	PerformanceMeter meter = createMeterWithoutSummary("JNI pinned array");
+	for (int samples = 0; samples < WARMUP + SAMPLES; samples++) {
+		if (samples >= WARMUP) meter.start();
+		for (int i = 0; i < CALLS; i++) {
+			Benchmark.pin(array);
+		}
+		if (samples >= WARMUP) meter.stop();
+	}
+	disposeMeter(meter);
+
+	long /*int*/ buffer = C.malloc(PIN_SIZE);
+	try {
+		meter = createMeterWithoutSummary("JNI pinned array copy");
+		for (int samples = 0; samples < WARMUP + SAMPLES; samples++) {
+			if (samples >= WARMUP) meter.start();
+			for (int i = 0; i < CALLS; i++) {
+				C.memmove(array, buffer, PIN_SIZE);
+			}
+			if (samples >= WARMUP) meter.stop();
+		}
+		disposeMeter(meter);
+	} finally {
+		C.free(buffer);
+	}
+}
+
+public void test_callback() {
+	if (!Benchmark.LOADED) return;
+	Callback callback = new Callback(this, "upcall", 1);
+	long /*int*/ address = callback.getAddress();
+	if (address == 0) {
+		callback.dispose();
+		fail("No callbacks available");
+	}
+	try {
+		PerformanceMeter meter = createMeterWithoutSummary("JNI callback");
+		for (int samples = 0; samples < WARMUP + SAMPLES; samples++) {
+			if (samples >= WARMUP) meter.start();
+			Benchmark.call(address, CALLS);
+			if (samples >= WARMUP) meter.stop();
+		}
+		disposeMeter(meter);
+	} finally {
+		callback.dispose();
+	}
+}
+
+public void test_platformCalls() throws Exception {
+	if (!Benchmark.LOADED) return;
+	measure("JNI reflective empty call", method(Benchmark.class, "empty", 0, null), new Object[0]);
+	String platform = SWT.getPlatform();
+	if (platform.equals("win32")) {
+		measureWin32();
+	} else if (platform.equals("cocoa")) {
+		measureCocoa();
+	}
+}
+
+@Override
+protected void runTest() throws Throwable {
+	if (getName().equals("test_emptyCall")) test_emptyCall();
+	else if (getName().equals("test_generatedCall")) test_generatedCall();
+	else if (getName().equals("test_pinnedArray")) test_pinnedArray();
+	else if (getName().equals("test_callback")) test_callback();
+	else if (getName().equals("test_platformCalls")) test_platformCalls();
+}
+
+public static Test suite() {
+	TestSuite suite = new TestSuite();
+	java.util.Vector<String> methodNames = methodNames();
+	java.util.Enumeration<String> e = methodNames.elements();
+	while (e.hasMoreElements()) {
+		suite.addTest(new Test_natives(e.nextElement()));
+	}
+	return suite;
+}
+public static java.util.Vector<String> methodNames() {
+	java.util.Vector<String> methodNames = new java.util.Vector<String>();
+	methodNames.addElement("test_emptyCall");
+	methodNames.addElement("test_generatedCall");
+	methodNames.addElement("test_pinnedArray");
+	methodNames.addElement("test_callback");
+	methodNames.addElement("test_platformCalls");
+	return methodNames;
+}
+
+/* custom */
+static final int CALLS = 100000;
+static final int WARMUP = 2;
+static final int SAMPLES = 20;
+static final int PIN_SIZE = 4096;
+static final int BITMAP_SIZE = 64;
+
+long /*int*/ upcall(long /*int*/ arg) {
+	return arg;
+}
+
+void measure(String id, Method method, Object[] args) throws Exception {
+	PerformanceMeter meter = createMeterWithoutSummary(id);
+	for (int samples = 0; samples < WARMUP + SAMPLES; samples++) {
+		if (samples >= WARMUP) meter.start();
+		for (int i = 0; i < CALLS; i++) {
+			method.invoke(null, args);
+		}
+		if (samples >= WARMUP) meter.stop();
+	}
+	disposeMeter(meter);
+}
+
+void measureWin32() throws Exception {
+	Class<?> os = Class.forName("org.eclipse.swt.internal.win32.OS");
+	Class<?> rectClass = Class.forName("org.eclipse.swt.internal.win32.RECT");
+	Object rect = rectClass.newInstance();
+	measure("JNI struct fields", method(os, "SetRect", 5, rectClass), new Object[] {rect, new Integer(1), new Integer(2), new Integer(3), new Integer(4)});
+
+	/* GetDIBits copies the bitmap into an array that is pinned for the call */
+	Object hdc = method(os, "GetDC", 1, null).invoke(null, new Object[] {new Integer(0)});
+	Object hBitmap = method(os, "CreateCompatibleBitmap", 3, null).invoke(null, new Object[] {hdc, new Integer(BITMAP_SIZE), new Integer(BITMAP_SIZE)});
+	try {
+		byte[] bmi = new byte[40];
+		setInt(bmi, 0, bmi.length);
+		setInt(bmi, 4, BITMAP_SIZE);
+		setInt(bmi, 8, -BITMAP_SIZE);
+		bmi[12] = 1;
+		bmi[14] = 32;
+		byte[] bits = new byte[BITMAP_SIZE * BITMAP_SIZE * 4];
+		Object[] args = new Object[] {hdc, hBitmap, new Integer(0), new Integer(BITMAP_SIZE), bits, bmi, new Integer(0)};
+		measure("JNI pinned array bitmap bits", method(os, "GetDIBits", 7, null), args);
+	} finally {
+		method(os, "DeleteObject", 1, null).invoke(null, new Object[] {hBitmap});
+		method(os, "ReleaseDC", 2, null).invoke(null, new Object[] {new Integer(0), hdc});
+	}
+
+	/* VtblCall through a vtable whose only entry is a callback */
+	Callback callback = new Callback(this, "upcall", 1);
+	long /*int*/ vtbl = C.malloc(C.PTR_SIZEOF), object = C.malloc(C.PTR_SIZEOF);
+	try {
+		setPointer(vtbl, callback.getAddress());
+		setPointer(object, vtbl);
+		measure("JNI vtable call", method(os, "VtblCall", 2, null), new Object[] {new Integer(0), box(object)});
+	} finally {
+		C.free(object);
+		C.free(vtbl);
+		callback.dispose();
+	}
+}
+
+void measureCocoa() throws Exception {
+	Class<?> os = Class.forName("org.eclipse.swt.internal.cocoa.OS");
+	Object screen = method(os, "objc_msgSend", 2, null).invoke(null, new Object[] {field(os, "class_NSScreen"), field(os, "sel_mainScreen")});
+	Class<?> nsRect = Class.forName("org.eclipse.swt.internal.cocoa.NSRect");
+	Object rect = nsRect.newInstance();
+	measure("JNI struct return", method(os, "objc_msgSend_stret", 3, nsRect), new Object[] {rect, screen, field(os, "sel_frame")});
+}
+
+static Object box(long /*int*/ value) {
+	return C.PTR_SIZEOF == 8 ? (Object)new Long(value) : (Object)new Integer((int)value);
+}
+
+static Object field(Class<?> clazz, String name) throws Exception {
+	Field field = clazz.getField(name);
+	return field.get(null);
+}
+
+/*
+ * Answers the method with the given name, number of parameters and, when not null,
+ * type of first parameter, so that the 32 and 64 bit signatures both match
+ */
+static Method method(Class<?> clazz, String name, int count, Class<?> first) {
+	Method[] methods = clazz.getMethods();
+	for (int i = 0; i < methods.length; i++) {
+		Method method = methods[i];
+		Class<?>[] types = method.getParameterTypes();
+		if (method.getName().equals(name) && types.length == count) {
+			if (first == null || types[0] == first) return method;
+		}
+	}
+	fail("No method " + name);
+	return null;
+}
+
+static void setInt(byte[] data, int offset, int value) {
+	data[offset] = (byte)value;
+	data[offset + 1] = (byte)(value >> 8);
+	data[offset + 2] = (byte)(value >> 16);
+	data[offset + 3] = (byte)(value >> 24);
+}
+
+static void setPointer(long /*int*/ ptr, long /*int*/ value) {
+	if (C.PTR_SIZEOF == 8) {
+		C.memmove(ptr, new long[] {value}, 8);
+	} else {
+		C.memmove(ptr, new int[] {(int)value}, 4);
+	}
+}
+}
@@ -287,6 +287,34 @@ public void test_windowDrawing() {
 	disposeMeter(meter);
 }
 
+public void test_polylineDrawing() {
+	PerformanceMeter meter = createMeter("Draw polylines using advanced graphics");
+	int samples;
+
+	int width = 640;
+	int height = 480;
+	int[] pointArray = new int[100000 * 2];
+	for (int i = 0; i < pointArray.length; i += 2) {
+		pointArray[i] = (i / 2) % width;
+		pointArray[i + 1] = (i / 2 * 7) % height;
+	}
+	for(samples = 0; samples < 10; samples++) {
+		Image image = new Image(display, width, height);
+		meter.start();
+		GC gc = new GC(image);
+		gc.setAdvanced(true);
+		for(int i = 0; i < 10; i++) {
+			gc.drawPolyline(pointArray);
+			gc.fillPolygon(pointArray);
+		}
+		gc.dispose();
+		meter.stop();
+		image.dispose();
+		while(display.readAndDispatch()){/*empty*/}
+	}
+	disposeMeter(meter);
+}
+
 public void test_stringDrawing() {
 	PerformanceMeter meter = createMeterWithoutSummary("Draw strings using GC.drawText");
 	int samples;
@@ -382,6 +410,103 @@ public void test_fastStringDrawing() {
 	disposeMeter(meter);
 }
 
+public void test_paintPolylines() {
+	final int[][] pointArrays = new int[][] {points(10000), points(100000), points(1000000)};
+	for (int i = 0; i < pointArrays.length; i++) {
+		final int[] pointArray = pointArrays[i];
+		paint("polyline " + pointArray.length / 2 + " vertices", false, new Painter() {
+			public void paint(GC gc, int frame) {
+				gc.drawPolyline(pointArray);
+			}
+		});
+	}
+}
+
+public void test_paintPolygons() {
+	final int[][] pointArrays = new int[][] {points(10000), points(100000), points(1000000)};
+	for (int i = 0; i < pointArrays.length; i++) {
+		final int[] pointArray = pointArrays[i];
+		paint("polygon " + pointArray.length / 2 + " vertices", false, new Painter() {
+			public void paint(GC gc, int frame) {
+				gc.fillPolygon(pointArray);
+			}
+		});
+	}
+}
+
+public void test_paintText() {
+	final Font font = new Font(display, "Helvetica", 12, SWT.NONE);
+	final String testString = "The quick brown SWT jumped foxily over the lazy dog.";
+	paint("text runs", false, new Painter() {
+		public void paint(GC gc, int frame) {
+			gc.setFont(font);
+			for (int y = 0; y < PAINT_HEIGHT; y += 16) {
+				gc.drawString(testString, (y + frame) % 64, y, true);
+			}
+		}
+	});
+	font.dispose();
+}
+
+public void test_paintGradients() {
+	final Color color1 = new Color(display, 0xff, 0, 0xff);
+	final Color color2 = new Color(display, 0, 0xff, 0xff);
+	paint("gradient fills", false, new Painter() {
+		public void paint(GC gc, int frame) {
+			gc.setForeground(color1);
+			gc.setBackground(color2);
+			for (int i = 0; i < 100; i++) {
+				int x = (i * 37 + frame) % (PAINT_WIDTH - 100), y = (i * 53 + frame) % (PAINT_HEIGHT - 100);
+				gc.fillGradientRectangle(x, y, 100, 100, (i & 1) == 0);
+			}
+		}
+	});
+	color1.dispose();
+	color2.dispose();
+}
+
+public void test_paintAlphaImages() {
+	ImageData data = new ImageData(64, 64, 24, new PaletteData(0xFF0000, 0xFF00, 0xFF));
+	for (int y = 0; y < data.height; y++) {
+		for (int x = 0; x < data.width; x++) {
+			data.setPixel(x, y, (x * 4) << 16 | (y * 4) << 8);
+			data.setAlpha(x, y, (x + y) * 2);
+		}
+	}
+	final Image image = new Image(display, data);
+	paint("alpha image blits", false, new Painter() {
+		public void paint(GC gc, int frame) {
+			for (int i = 0; i < 100; i++) {
+				int x = (i * 37 + frame) % (PAINT_WIDTH - 128), y = (i * 53 + frame) % (PAINT_HEIGHT - 128);
+				if ((i & 1) == 0) {
+					gc.drawImage(image, x, y);
+				} else {
+					gc.drawImage(image, 0, 0, 64, 64, x, y, 128, 128);
+				}
+			}
+		}
+	});
+	image.dispose();
+}
+
+public void test_paintPaths() {
+	paint("path construction", true, new Painter() {
+		public void paint(GC gc, int frame) {
+			Path path = new Path(display);
+			for (int i = 0; i < 200; i++) {
+				float x = (i * 37 + frame) % PAINT_WIDTH, y = (i * 53 + frame) % PAINT_HEIGHT;
+				path.moveTo(x, y);
+				path.lineTo(x + 20, y);
+				path.cubicTo(x + 30, y + 10, x + 10, y + 30, x, y + 20);
+				path.addArc(x, y, 20, 20, 0, 270);
+				path.close();
+			}
+			gc.drawPath(path);
+			path.dispose();
+		}
+	});
+}
+
 public static Test suite() {
 	TestSuite suite = new TestSuite();
 	java.util.Vector<String> methodNames = methodNames();
@@ -397,9 +522,16 @@ public static java.util.Vector<String> methodNames() {
 	methodNames.addElement("test_createWidgets");
 	methodNames.addElement("test_imageDrawing");
 	methodNames.addElement("test_windowDrawing");
+	methodNames.addElement("test_polylineDrawing");
 	methodNames.addElement("test_stringDrawing");
 	methodNames.addElement("test_fastStringDrawing");
 	methodNames.addElement("test_layout");
+	methodNames.addElement("test_paintPolylines");
+	methodNames.addElement("test_paintPolygons");
+	methodNames.addElement("test_paintText");
+	methodNames.addElement("test_paintGradients");
+	methodNames.addElement("test_paintAlphaImages");
+	methodNames.addElement("test_paintPaths");
 	return methodNames;
 }
 @Override
@@ -409,10 +541,116 @@ protected void runTest() throws Throwable {
 	else if (getName().equals("test_layout")) test_layout();
 	else if (getName().equals("test_imageDrawing")) test_imageDrawing();
 	else if (getName().equals("test_windowDrawing")) test_windowDrawing();
+	else if (getName().equals("test_polylineDrawing")) test_polylineDrawing();
 	else if (getName().equals("test_stringDrawing")) test_stringDrawing();
 	else if (getName().equals("test_fastStringDrawing")) test_fastStringDrawing();
+	else if (getName().equals("test_paintPolylines")) test_paintPolylines();
+	else if (getName().equals("test_paintPolygons")) test_paintPolygons();
+	else if (getName().equals("test_paintText")) test_paintText();
+	else if (getName().equals("test_paintGradients")) test_paintGradients();
+	else if (getName().equals("test_paintAlphaImages")) test_paintAlphaImages();
+	else if (getName().equals("test_paintPaths")) test_paintPaths();
 }
 
 /* custom */
 Display display;
+
+static final int PAINT_WIDTH = 640;
+static final int PAINT_HEIGHT = 480;
+static final int PAINT_SAMPLES = 5;
+static final int PAINT_FRAMES = 10;
+
+interface Painter {
+	void paint(GC gc, int frame);
+}
+
+/*
+ * Paints the frames of a scenario into an image with each GC backend of the
+ * platform, the advanced one first, and reports the frames per second and the
+ * natives called per frame. The natives are only counted when the library is
+ * built with NATIVE_STATS and the NativeStats tool is on the class path.
+ */
+void paint(String name, boolean advancedOnly, Painter painter) {
+	String[] backends = backends();
+	for (int i = backends.length - 1; i >= 0; i--) {
+		if (advancedOnly && i == 0 && backends.length > 1) break;
+		boolean advanced = i == backends.length - 1;
+		String id = "Paint " + name + " (" + backends[i] + ")";
+		PerformanceMeter meter = createMeterWithoutSummary(id);
+		Image image = new Image(display, PAINT_WIDTH, PAINT_HEIGHT);
+		GC gc = new GC(image);
+		gc.setAdvanced(advanced);
+
+		// Warm up and count the natives called by one frame.
+		Object stats = nativeStats();
+		painter.paint(gc, 0);
+		int calls = nativeCalls(stats);
+
+		long time = 0;
+		for (int samples = 0; samples < PAINT_SAMPLES; samples++) {
+			long start = System.nanoTime();
+			meter.start();
+			for (int frame = 0; frame < PAINT_FRAMES; frame++) {
+				painter.paint(gc, frame);
+			}
+			meter.stop();
+			time += System.nanoTime() - start;
+		}
+		gc.dispose();
+		image.dispose();
+		while(display.readAndDispatch()){/*empty*/}
+		disposeMeter(meter);
+
+		double fps = PAINT_SAMPLES * PAINT_FRAMES * 1e9 / Math.max(time, 1);
+		System.out.println(id + ": " + Math.round(fps * 10) / 10.0 + " fps" + (calls != -1 ? ", " + calls + " native calls per frame" : ""));
+	}
+}
+
+/* The GC backends, the one used by a GC that is not advanced first */
+String[] backends() {
+	String platform = SWT.getPlatform();
+	if (platform.equals("win32")) return new String[] {"GDI", "GDI+"};
+	if (platform.equals("gtk")) return new String[] {"GDK", "cairo"};
+	if (platform.equals("motif")) return new String[] {"X", "cairo"};
+	if (platform.equals("cocoa")) return new String[] {"Cocoa"};
+	if (platform.equals("wpf")) return new String[] {"WPF"};
+	return new String[] {platform};
+}
+
+Object nativeStats() {
+	try {
+		return Class.forName("org.eclipse.swt.tools.internal.NativeStats").newInstance();
+	} catch (Throwable e) {
+		return null;
+	}
+}
+
+/* Answers the natives called since the stats were created, or -1 if they are not counted */
+int nativeCalls(Object stats) {
+	if (stats == null) return -1;
+	try {
+		java.util.Hashtable<?, ?> diff = (java.util.Hashtable<?, ?>)stats.getClass().getMethod("diff", new Class[0]).invoke(stats, new Object[0]);
+		if (diff.isEmpty()) return -1;
+		int calls = 0;
+		java.util.Enumeration<?> e = diff.elements();
+		while (e.hasMoreElements()) {
+			Object[] funcs = (Object[])e.nextElement();
+			for (int i = 0; i < funcs.length; i++) {
+				calls += ((Integer)funcs[i].getClass().getMethod("getCallCount", new Class[0]).invoke(funcs[i], new Object[0])).intValue();
+			}
+		}
+		return calls;
+	} catch (Throwable e) {
+		return -1;
+	}
+}
+
+static int[] points(int count) {
+	int[] pointArray = new int[count * 2];
+	for (int i = 0; i < pointArray.length; i += 2) {
+		pointArray[i] = (i / 2) % PAINT_WIDTH;
+		pointArray[i + 1] = (i / 2 * 7) % PAINT_HEIGHT;
+	}
+	return pointArray;
+}
 }